@@ -50,6 +50,31 @@ void Srvr__flush()
 #include "buff.h"       // POST request data accumulator
 #include "epd.h"        // e-Paper driver
 
+/* Windowed transfer of image data ---------------------------------------------*/
+// Besides one-byte commands 'I', 'L', 'N' and 'S' answered by "Ok!", image data
+// can be sent by windows without waiting for an answer to each of them.
+// A window is a 12-byte header and its data (little-endian values):
+//   'W', flags, seq(2), rawLen(2), dataLen(2), crc(4)
+//   flags   - bit 0: the data is PackBits (see Buff__unpack), otherwise raw
+//   seq     - number of the window since the last 'I' or 'N', from 0
+//   rawLen  - image data bytes in the window, up to Srvr__WIN_SIZE
+//             (even for all windows but the last one of a channel)
+//   dataLen - bytes following the header
+//   crc     - CRC-32 (as zlib's crc32) of the unpacked image data
+// Every accepted window is loaded into e-Paper's memory at once and answered
+// by 'A', seq(2). A broken or unexpected window is answered by 'R', seq(2)
+// with the number of the window expected next; the next windows are dropped
+// silently until that one comes again (go-back-N). The client keeps up to
+// a few windows unanswered, so Bluetooth is busy while e-Paper is written.
+#define Srvr__WIN_SIZE    4096  // Maximal image data bytes in a window
+#define Srvr__WIN_HDR     12    // Header length
+#define Srvr__WIN_PACK    0x01  // Flag: the data is PackBits
+#define Srvr__WIN_TIMEOUT 1000  // Milliseconds to wait for the rest of a window
+
+uint8_t Srvr__winArr[Srvr__WIN_SIZE + Srvr__WIN_SIZE / 128 + 1]; // Received data
+int  Srvr__winSeq; // Number of the next expected window
+bool Srvr__winNak; // It's true when 'R' is sent and the expected window hasn't come yet
+
 bool Srvr__btSetup()                                              
 {
     // Name shown in bluetooth device list of App part (PC or smartphone)
@@ -65,10 +90,94 @@ bool Srvr__btSetup()
     // There is no connection yet
     Srvr__btConn = false;
 
+    // Parts of a window must come in this time
+    Srvr__btClient.setTimeout(Srvr__WIN_TIMEOUT);
+
     // Return the connection result
     return Srvr__btIsOn;
 }
 
+/* Answering a window ----------------------------------------------------------*/
+void Srvr__winReply(char code, int seq)
+{
+    uint8_t msg[3] = { (uint8_t)code, (uint8_t)seq, (uint8_t)(seq >> 8) };
+    if (Srvr__btIsOn) Srvr__btClient.write(msg, 3);
+}
+
+/* Asking to send again from the expected window -------------------------------*/
+void Srvr__winRetry()
+{
+    Srvr__winNak = true;
+    Srvr__winReply('R', Srvr__winSeq);
+}
+
+/* Receiving and loading a window of image data ------------------------------*/
+bool Srvr__window()
+{
+    uint8_t hdr[Srvr__WIN_HDR];
+
+    // Read the header, it begins with 'W'
+    if (Srvr__btClient.readBytes(hdr, Srvr__WIN_HDR) != Srvr__WIN_HDR)
+    {
+        Serial.print("<<<WIN - timeout!>>>");
+        Srvr__flush();
+        Srvr__winRetry();
+        return true;
+    }
+
+    int flags   = hdr[1];
+    int seq     = hdr[2] + (hdr[3] << 8);
+    int rawLen  = hdr[4] + (hdr[5] << 8);
+    int dataLen = hdr[6] + (hdr[7] << 8);
+    uint32_t crc = (uint32_t)hdr[8] | ((uint32_t)hdr[9] << 8) |
+                   ((uint32_t)hdr[10] << 16) | ((uint32_t)hdr[11] << 24);
+
+    // The stream is out of sync if lengths are impossible
+    if ((rawLen > Srvr__WIN_SIZE) || (dataLen > (int)sizeof(Srvr__winArr)) ||
+        (!(flags & Srvr__WIN_PACK) && (dataLen != rawLen)) ||
+        (Srvr__btClient.readBytes(Srvr__winArr, dataLen) != (size_t)dataLen))
+    {
+        Serial.print("<<<WIN - broken!>>>");
+        Srvr__flush();
+        Srvr__winRetry();
+        return true;
+    }
+
+    // Drop the windows sent after a broken one
+    if (seq != Srvr__winSeq)
+    {
+        if (!Srvr__winNak) Srvr__winRetry();
+        return true;
+    }
+
+    // Unpack the data right after the place of 'L' request header,
+    // so loading functions of 'epd.h' take it as usual
+    int len = dataLen;
+    if (flags & Srvr__WIN_PACK)
+        len = Buff__unpack(6, Srvr__winArr, dataLen, Srvr__WIN_SIZE);
+    else
+        memcpy(&Buff__bufArr[6], Srvr__winArr, dataLen);
+
+    if ((len != rawLen) || (Buff__crc32(6, len) != crc))
+    {
+        Serial.printf("<<<WIN %d - CRC failed!>>>", seq);
+        Srvr__winRetry();
+        return true;
+    }
+
+    // Load data into the e-Paper
+    // if there is loading function for current channel (black or red)
+    Buff__bufInd = 6 + len;
+    if (EPD_dispLoad != 0) EPD_dispLoad();
+    Buff__bufInd = 0;
+
+    Srvr__length += len;
+    Srvr__winSeq = (Srvr__winSeq + 1) & 0xFFFF;
+    Srvr__winNak = false;
+    Srvr__winReply('A', seq);
+    return true;
+}
+
 /* The server state observation loop -------------------------------------------*/
 bool Srvr__loop() 
 {
@@ -95,6 +204,9 @@ bool Srvr__loop()
         delay(1);
     }
 
+    // A window of image data has its own length
+    if (Srvr__btClient.peek() == 'W') return Srvr__window();
+
     // Set buffer's index to zero
     // It means the buffer is empty initially
     Buff__bufInd = 0;
@@ -107,16 +219,14 @@ bool Srvr__loop()
 
         // Save it in the buffer and increment its index
         Buff__bufArr[Buff__bufInd++] = (byte)q;
-        Serial.printf("0x%x ,",(byte)q);
-        if(Buff__bufInd % 16 == 0)
-            Serial.println();
     }
-    Serial.println();
 
     // Initialization
     if (Buff__bufArr[0] == 'I')
     {
         Srvr__length = 0;
+        Srvr__winSeq = 0;
+        Srvr__winNak = false;
 
         // Getting of e-Paper's type
         EPD_dispIndex = Buff__bufArr[1];
@@ -192,6 +302,10 @@ bool Srvr__loop()
         // Setup the function for loading choosen channel's data
         EPD_dispLoad = EPD_dispMass[EPD_dispIndex].chRd;
 
+        // Windows of the next channel are numbered from 0 again
+        Srvr__winSeq = 0;
+        Srvr__winNak = false;
+
         Buff__bufInd = 0;
         Srvr__flush();
     }
@@ -28,6 +28,9 @@ void setup()
     // SPI initialization
     EPD_initSPI();
 
+    // Streaming upload initialization
+    Strm__setup();
+
     // Initialization is complete
     Serial.print("\r\nOk!\r\n");
 }
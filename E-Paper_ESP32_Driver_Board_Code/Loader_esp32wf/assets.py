@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Precompress the web assets of the loader.
+
+Collects the text that sendCSS() and sendJS_A()..sendJS_D() print (the string
+literals of css.h and scripts.h), gzips it, and writes assets_gz.h with the
+results as flash arrays. srvr.h serves those with 'Content-Encoding: gzip'.
+Run again after editing css.h or scripts.h:
+
+    python3 assets.py
+"""
+
+import gzip
+import os
+import re
+
+ASSETS = [
+    # (array name, source file, sending function)
+    ("Gz__css", "css.h", "sendCSS"),
+    ("Gz__jsA", "scripts.h", "sendJS_A"),
+    ("Gz__jsB", "scripts.h", "sendJS_B"),
+    ("Gz__jsC", "scripts.h", "sendJS_C"),
+    ("Gz__jsD", "scripts.h", "sendJS_D"),
+]
+
+ESCAPES = {"\n": "", "n": "\n", "r": "\r", "t": "\t", "\\": "\\", '"': '"', "'": "'", "0": "\0"}
+
+
+def function_body(text, name):
+    m = re.search(r"void\s+%s\s*\([^)]*\)\s*\{" % name, text)
+    if not m:
+        raise SystemExit("%s not found" % name)
+    depth, i = 1, m.end()
+    in_str = False
+    while depth:
+        c = text[i]
+        if in_str:
+            if c == "\\":
+                i += 1
+            elif c == '"':
+                in_str = False
+        elif c == '"':
+            in_str = True
+        elif text.startswith("//", i):
+            i = text.index("\n", i)
+        elif text.startswith("/*", i):
+            i = text.index("*/", i) + 1
+        elif c == "{":
+            depth += 1
+        elif c == "}":
+            depth -= 1
+        i += 1
+    return text[m.end():i - 1]
+
+
+def printed_text(body):
+    """Concatenate string literals as the compiler would, plus println's CRLF."""
+    out, i = [], 0
+    while i < len(body):
+        if body.startswith("//", i):
+            i = body.index("\n", i)
+        elif body.startswith("/*", i):
+            i = body.index("*/", i) + 2
+        elif body[i] == '"':
+            i += 1
+            while body[i] != '"':
+                if body[i] == "\\":
+                    out.append(ESCAPES[body[i + 1]])
+                    i += 2
+                else:
+                    out.append(body[i])
+                    i += 1
+            i += 1
+        else:
+            i += 1
+    text = "".join(out)
+    if "println" in body:
+        text += "\r\n"
+    return text
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    lines = [
+        "/**",
+        "  ******************************************************************************",
+        "  * @file    assets_gz.h",
+        "  * @brief   Gzip-precompressed styles and scripts, generated by assets.py",
+        "  *          from css.h and scripts.h. Do not edit.",
+        "  *",
+        "  ******************************************************************************",
+        "  */",
+        "",
+    ]
+    for array, source, func in ASSETS:
+        with open(os.path.join(here, source), encoding="utf-8") as f:
+            raw = printed_text(function_body(f.read(), func)).encode("utf-8")
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        lines.append("/* %s: %d bytes, %d gzipped */" % (func, len(raw), len(packed)))
+        lines.append("const uint8_t %s[] PROGMEM = {" % array)
+        for pos in range(0, len(packed), 16):
+            lines.append("    " + ", ".join("0x%02x" % b for b in packed[pos:pos + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+    with open(os.path.join(here, "assets_gz.h"), "w", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,338 @@
+/**
+  ******************************************************************************
+  * @file    assets_gz.h
+  * @brief   Gzip-precompressed styles and scripts, generated by assets.py
+  *          from css.h and scripts.h. Do not edit.
+  *
+  ******************************************************************************
+  */
+
+/* sendCSS: 1761 bytes, 682 gzipped */
+const uint8_t Gz__css[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x54, 0xc1, 0x6e, 0xa3, 0x30,
+    0x14, 0xbc, 0x47, 0xca, 0x3f, 0x58, 0xaa, 0x22, 0xb5, 0x52, 0xe8, 0x42, 0x9a, 0xa4, 0x89, 0xf7,
+    0xd4, 0xcd, 0x36, 0x5f, 0xb0, 0xda, 0x6b, 0xf5, 0x82, 0x0d, 0x58, 0x35, 0x36, 0xb2, 0xcd, 0x36,
+    0x69, 0xb5, 0xff, 0xbe, 0xcf, 0x18, 0x12, 0x48, 0x9b, 0xed, 0xa1, 0x1c, 0x10, 0x36, 0x78, 0xe6,
+    0xcd, 0xbc, 0x79, 0xdc, 0x96, 0x5c, 0xd5, 0x4f, 0xbb, 0xda, 0x39, 0xad, 0xc8, 0xdb, 0x78, 0xf4,
+    0x22, 0x98, 0x2b, 0x28, 0x49, 0xe2, 0x78, 0xf2, 0x7d, 0x3c, 0x2a, 0xb8, 0xc8, 0x0b, 0x47, 0xc9,
+    0x22, 0xae, 0xf6, 0xb8, 0xdc, 0x69, 0xc3, 0xb8, 0x89, 0x0c, 0x30, 0x51, 0x5b, 0x4a, 0xe6, 0xcd,
+    0xa6, 0xe3, 0x7b, 0x17, 0x81, 0x14, 0xb9, 0xa2, 0x24, 0xe5, 0xca, 0x71, 0x83, 0x9b, 0x69, 0x6d,
+    0xac, 0x36, 0x94, 0x54, 0x5a, 0xb4, 0x3b, 0x4c, 0xd8, 0x4a, 0xc2, 0x81, 0x92, 0x9d, 0xd4, 0xe9,
+    0x33, 0x6e, 0x94, 0x60, 0x72, 0xa1, 0xa2, 0x9d, 0x46, 0xea, 0x92, 0x2e, 0x1a, 0xac, 0x4c, 0x2b,
+    0x64, 0x4b, 0x10, 0xf8, 0x9b, 0xa7, 0x24, 0xbf, 0xa0, 0xd0, 0x25, 0x78, 0x12, 0x03, 0xca, 0x0a,
+    0x27, 0x34, 0x92, 0x80, 0x94, 0x24, 0xbe, 0x4d, 0x56, 0x96, 0x70, 0xb0, 0x3c, 0x42, 0x0c, 0x5d,
+    0xbb, 0x63, 0x75, 0x78, 0x1c, 0x0f, 0x5a, 0x2d, 0x05, 0x23, 0x57, 0xf3, 0xed, 0xcf, 0xe5, 0x72,
+    0xe9, 0xdf, 0x41, 0xfa, 0x9c, 0x1b, 0x5d, 0x2b, 0x46, 0x89, 0x14, 0x8a, 0x83, 0x89, 0x72, 0x2f,
+    0x03, 0xeb, 0xbd, 0x76, 0x9a, 0x38, 0x5d, 0x11, 0xe3, 0xa5, 0x4e, 0xc9, 0xd5, 0xdd, 0xe3, 0x66,
+    0x7d, 0xff, 0x80, 0x0f, 0xcb, 0xf5, 0xe3, 0xc3, 0x7c, 0x4d, 0x66, 0xf1, 0x64, 0x4a, 0x4c, 0xbe,
+    0x83, 0xeb, 0xd9, 0x62, 0x31, 0x25, 0xa7, 0x5b, 0x7c, 0x43, 0x56, 0x97, 0xdf, 0xdd, 0x9c, 0x40,
+    0x51, 0x4b, 0x3c, 0x21, 0x8b, 0x60, 0x69, 0xaa, 0xa5, 0x37, 0x26, 0x37, 0x9c, 0x2b, 0x5c, 0xfe,
+    0x1d, 0x8f, 0x6e, 0x7b, 0x2d, 0xa0, 0x85, 0xfe, 0xc3, 0x8d, 0x6f, 0x44, 0xfb, 0xdd, 0x4b, 0x21,
+    0x1c, 0x1f, 0x08, 0x88, 0x2a, 0xdd, 0x39, 0x11, 0xbc, 0x23, 0x92, 0x67, 0xae, 0x85, 0x2a, 0x04,
+    0x63, 0x5c, 0x3d, 0x09, 0x55, 0xd5, 0xae, 0xd7, 0x4e, 0xb4, 0xab, 0xf1, 0xb7, 0xeb, 0x67, 0xb7,
+    0xd6, 0x15, 0xa4, 0xc2, 0x61, 0x53, 0x62, 0xbf, 0x40, 0xe6, 0x4c, 0xea, 0x17, 0x4a, 0x02, 0x0a,
+    0x6e, 0x9d, 0xa8, 0x60, 0x87, 0x96, 0xd6, 0x4d, 0x29, 0xaf, 0x68, 0x39, 0xe3, 0x7b, 0x4a, 0xa2,
+    0xa4, 0x65, 0x15, 0x65, 0xfe, 0x43, 0xef, 0xc7, 0xa3, 0xb7, 0x53, 0x13, 0x66, 0xd8, 0x04, 0x06,
+    0xb6, 0xe0, 0xec, 0x28, 0xf5, 0x2c, 0x3d, 0xab, 0x10, 0xa9, 0x41, 0x63, 0xb0, 0xb8, 0x03, 0x97,
+    0x58, 0xc3, 0x50, 0xb1, 0xe1, 0x15, 0x07, 0x2c, 0x5b, 0xe9, 0xf6, 0xf1, 0x52, 0xec, 0xda, 0x4c,
+    0xa1, 0xf3, 0x34, 0x09, 0x91, 0x0d, 0xfe, 0x5a, 0x2c, 0xcf, 0xdb, 0x11, 0xde, 0x37, 0xf1, 0xc6,
+    0xfa, 0xee, 0xc3, 0x27, 0x67, 0x1d, 0xf1, 0x19, 0x8c, 0xac, 0x78, 0xe5, 0x28, 0xe2, 0x94, 0xca,
+    0x28, 0x83, 0x52, 0x48, 0x74, 0xea, 0x37, 0x37, 0x0c, 0x14, 0x4c, 0xc9, 0x83, 0x11, 0x20, 0xa7,
+    0xc4, 0x62, 0x30, 0x23, 0xcb, 0x8d, 0xc8, 0xba, 0x16, 0x70, 0x40, 0x99, 0x4f, 0xbe, 0xfc, 0xc6,
+    0x91, 0xd0, 0x82, 0xe1, 0x40, 0x35, 0xfc, 0x43, 0xf5, 0x57, 0x8f, 0xcd, 0xd5, 0x82, 0xa4, 0x48,
+    0x89, 0xa2, 0x2e, 0xa0, 0x5c, 0x3c, 0x96, 0x69, 0xed, 0xbe, 0xcc, 0xdd, 0x0a, 0xc8, 0x20, 0xe5,
+    0x03, 0x90, 0xd9, 0xbc, 0x9f, 0xa1, 0x0e, 0xa6, 0xb5, 0x34, 0x26, 0x50, 0x3b, 0x7d, 0x06, 0xbb,
+    0xd9, 0x6c, 0xb7, 0x9b, 0xcd, 0x99, 0xa4, 0xcf, 0x71, 0x27, 0x9f, 0xc0, 0x6e, 0x9b, 0x6b, 0x28,
+    0xf9, 0xeb, 0xa8, 0x83, 0x62, 0xc3, 0x48, 0x82, 0xe9, 0x65, 0x3a, 0x32, 0x01, 0xe9, 0xff, 0x7f,
+    0x17, 0xb4, 0x72, 0xbb, 0x6d, 0xac, 0xc4, 0x69, 0x72, 0x22, 0x05, 0xd9, 0x86, 0x14, 0x33, 0xe9,
+    0x07, 0x0a, 0x18, 0x13, 0x2a, 0xa7, 0x49, 0x48, 0x56, 0x28, 0x76, 0xd6, 0x5a, 0xd9, 0xab, 0xf5,
+    0x2c, 0x05, 0x9a, 0x1d, 0x9a, 0x4a, 0x3e, 0xc4, 0xec, 0x4d, 0xc2, 0x71, 0x10, 0x86, 0xb2, 0x3b,
+    0xd6, 0xbb, 0xc0, 0xd3, 0x2e, 0x23, 0xff, 0xdf, 0xe8, 0x2a, 0xf1, 0x74, 0x4e, 0x38, 0x19, 0x4c,
+    0x0c, 0x23, 0xf1, 0x7e, 0x22, 0xee, 0x66, 0xef, 0x07, 0x02, 0xfc, 0x1c, 0x1c, 0x7b, 0x5c, 0xa2,
+    0x73, 0xee, 0x7d, 0xf6, 0x2e, 0x01, 0x26, 0xcb, 0x13, 0xa0, 0x75, 0x07, 0xc9, 0xa9, 0x70, 0x28,
+    0x25, 0xbd, 0x44, 0xf2, 0x91, 0x56, 0x4f, 0xac, 0x6a, 0xd6, 0x23, 0xbd, 0x3f, 0xce, 0xfe, 0x78,
+    0xf4, 0x0f, 0xf0, 0x03, 0x79, 0x01, 0xe1, 0x06, 0x00, 0x00,
+};
+
+/* sendJS_A: 4043 bytes, 1448 gzipped */
+const uint8_t Gz__jsA[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x57, 0x51, 0x6f, 0x9b, 0x48,
+    0x10, 0x7e, 0x8f, 0x94, 0xff, 0x80, 0xfc, 0x70, 0xd8, 0x0a, 0x22, 0x80, 0x01, 0xe3, 0xd6, 0xe4,
+    0x54, 0x5f, 0x7a, 0x4a, 0xa4, 0xde, 0xa9, 0xca, 0xb5, 0xb9, 0x3b, 0x59, 0x56, 0x85, 0x61, 0x6d,
+    0xa3, 0xe0, 0xc5, 0x5a, 0xc0, 0x69, 0x55, 0xf5, 0xbf, 0xdf, 0xec, 0xce, 0xae, 0xbd, 0x4b, 0xd2,
+    0xb4, 0x27, 0xcb, 0x66, 0x76, 0xe6, 0x9b, 0x99, 0x6f, 0x66, 0x16, 0x58, 0x1f, 0x32, 0x66, 0x35,
+    0x2c, 0x9f, 0xd7, 0x9f, 0x1d, 0xb8, 0xdc, 0xee, 0x36, 0x4e, 0xd1, 0xb4, 0x70, 0x79, 0x7d, 0x7e,
+    0x76, 0x00, 0x13, 0xd9, 0x17, 0x6f, 0x18, 0x73, 0xe0, 0x72, 0x4b, 0x0b, 0x67, 0x9f, 0x55, 0xb0,
+    0x92, 0xa6, 0xbc, 0x63, 0xef, 0xb3, 0x0a, 0x16, 0xeb, 0x8e, 0xe6, 0x6d, 0x59, 0x53, 0x6b, 0x43,
+    0xda, 0xb7, 0xd5, 0x6e, 0x48, 0x47, 0x5f, 0x19, 0x69, 0x3b, 0x46, 0xad, 0xa2, 0xce, 0xbb, 0x1d,
+    0xa1, 0xad, 0x2b, 0x2c, 0x84, 0x8b, 0xf3, 0x2f, 0xb7, 0x05, 0x20, 0x5e, 0x7f, 0xd3, 0xfc, 0x1a,
+    0xd2, 0xde, 0x52, 0x3a, 0xa4, 0x4e, 0x39, 0xfa, 0xfa, 0x82, 0x8f, 0x5b, 0x52, 0x4a, 0xd8, 0xcd,
+    0x87, 0x3f, 0xde, 0xa5, 0xa5, 0xe1, 0xbf, 0x67, 0x75, 0x4e, 0x9a, 0xe6, 0xf7, 0xb2, 0x22, 0xcd,
+    0x70, 0xcd, 0x7f, 0x47, 0x5f, 0x91, 0x23, 0x5f, 0xa4, 0x42, 0xb3, 0xf0, 0x96, 0x92, 0x37, 0x23,
+    0x59, 0x41, 0x58, 0x4a, 0xc9, 0xa3, 0xc5, 0x3d, 0xee, 0xc4, 0x72, 0x38, 0x02, 0x2b, 0x36, 0x40,
+    0x58, 0x6e, 0x77, 0xd9, 0x86, 0x08, 0x25, 0xc2, 0xdd, 0x9a, 0x56, 0x75, 0x56, 0xa4, 0x2a, 0xe7,
+    0x90, 0xf0, 0x14, 0x92, 0xb8, 0x8d, 0x0d, 0xb4, 0x1d, 0x7b, 0x56, 0xee, 0x36, 0x56, 0x59, 0xa4,
+    0x03, 0xb8, 0xde, 0x97, 0xe4, 0x71, 0x60, 0xe5, 0x55, 0xd6, 0x34, 0xe9, 0xa0, 0xa9, 0x3b, 0x96,
+    0x13, 0x11, 0x75, 0x70, 0x65, 0x8f, 0x24, 0x15, 0x40, 0xa5, 0xb2, 0x69, 0xb6, 0xf4, 0x10, 0x36,
+    0x90, 0x5d, 0x88, 0x99, 0x12, 0xb7, 0xcd, 0x18, 0x00, 0x5c, 0x46, 0x9a, 0xae, 0x6a, 0x8f, 0x14,
+    0xbf, 0x63, 0xfc, 0x76, 0xa2, 0xcb, 0x2f, 0x6f, 0x9a, 0xeb, 0xac, 0xcd, 0x3e, 0xde, 0xbd, 0x13,
+    0x3d, 0xe1, 0x71, 0xf5, 0xa6, 0x15, 0xac, 0xde, 0x63, 0x15, 0xc4, 0x6d, 0xda, 0x7a, 0xff, 0x1e,
+    0xd6, 0xd9, 0x26, 0x13, 0xc5, 0x71, 0x2c, 0x71, 0xf7, 0x8c, 0x1c, 0xa0, 0xfb, 0xd7, 0x64, 0x9d,
+    0x41, 0xfc, 0xa1, 0x22, 0x2d, 0xda, 0x09, 0xd9, 0x0b, 0x08, 0xfe, 0x81, 0x65, 0xb4, 0x59, 0x43,
+    0x3e, 0xa1, 0x04, 0xc0, 0x33, 0xa3, 0xe8, 0xe5, 0x2d, 0x37, 0xb4, 0x66, 0xe4, 0x9a, 0x65, 0x9b,
+    0xff, 0x9d, 0xfd, 0x9b, 0xb9, 0xd7, 0xfe, 0xec, 0x60, 0x57, 0xec, 0x9c, 0x43, 0xc5, 0xc3, 0xc8,
+    0x1d, 0x67, 0xcf, 0xda, 0x42, 0xf5, 0x3c, 0xaf, 0x77, 0x7c, 0xf7, 0x40, 0xbf, 0x2f, 0xe8, 0xee,
+    0xc2, 0x7e, 0x35, 0xbb, 0x6c, 0x0b, 0x90, 0xcf, 0xcf, 0x38, 0xe8, 0x6a, 0x56, 0xd2, 0x7d, 0xd7,
+    0x8a, 0x61, 0xd1, 0xae, 0xf8, 0x84, 0x98, 0xe3, 0xbc, 0x40, 0x35, 0x68, 0xbf, 0xec, 0x09, 0x97,
+    0x76, 0x2b, 0xc2, 0x06, 0xd6, 0x21, 0xab, 0x3a, 0x58, 0xda, 0x17, 0x87, 0x0a, 0x70, 0x97, 0x57,
+    0x18, 0xad, 0xc7, 0x6a, 0xde, 0x52, 0x4e, 0xa9, 0xfd, 0xec, 0xac, 0xa9, 0xc1, 0xaa, 0x28, 0x0f,
+    0x57, 0xb3, 0x2a, 0x5b, 0x91, 0x4a, 0x65, 0x00, 0x6a, 0xdd, 0xa7, 0x55, 0xd7, 0xb6, 0x35, 0x1d,
+    0x58, 0xeb, 0x9a, 0xa5, 0x03, 0xc5, 0x01, 0x38, 0xb6, 0x9f, 0x2f, 0xec, 0xd9, 0xa5, 0xc0, 0x4b,
+    0xc6, 0xc8, 0x56, 0xfa, 0x6e, 0xcb, 0xa2, 0x20, 0xf4, 0x93, 0xd0, 0x0d, 0x44, 0x09, 0x47, 0xfe,
+    0x48, 0x9a, 0xfb, 0x00, 0x91, 0x34, 0xf5, 0x7e, 0xb5, 0xf9, 0x14, 0x06, 0x56, 0x4d, 0xf3, 0x6d,
+    0x46, 0x37, 0xdc, 0xf6, 0xca, 0x56, 0x69, 0x41, 0x59, 0x95, 0xf9, 0x03, 0xe8, 0x46, 0x17, 0x6b,
+    0x2a, 0xcb, 0xe2, 0x54, 0xfb, 0x75, 0xdd, 0xcd, 0x87, 0x87, 0x0a, 0xca, 0x32, 0x6a, 0x42, 0x4a,
+    0x98, 0x90, 0x65, 0x45, 0x59, 0x0f, 0x2c, 0x9a, 0xed, 0x60, 0xf1, 0x50, 0xd2, 0xe2, 0xd8, 0xb0,
+    0x9d, 0xe8, 0x18, 0x94, 0xa0, 0xa5, 0x63, 0xab, 0xdf, 0xb8, 0x30, 0xc4, 0x66, 0x8e, 0x5e, 0x03,
+    0x5f, 0x88, 0x2f, 0xd8, 0xe6, 0x5b, 0x92, 0x3f, 0x10, 0xa8, 0xa8, 0x65, 0x1d, 0xe1, 0x5c, 0x81,
+    0x9a, 0x7d, 0x29, 0x5a, 0x82, 0x9c, 0x1e, 0x21, 0x78, 0xfd, 0x28, 0xef, 0x47, 0x2b, 0xb5, 0x8e,
+    0x77, 0xa4, 0xb8, 0x21, 0xc5, 0x8d, 0x08, 0x5a, 0x75, 0x57, 0xc9, 0x3b, 0x53, 0xde, 0xdd, 0x20,
+    0x82, 0x63, 0x01, 0x7b, 0x0f, 0xf6, 0x05, 0x3c, 0x03, 0x4e, 0x7b, 0xb1, 0x6f, 0xaf, 0x0f, 0x2f,
+    0x98, 0xeb, 0x7d, 0xca, 0x7f, 0x4e, 0x4f, 0x0c, 0x8f, 0xef, 0x58, 0xf1, 0x88, 0x14, 0x22, 0x3e,
+    0x26, 0xd3, 0xc5, 0x62, 0xe1, 0x39, 0xf0, 0x59, 0x3a, 0x8b, 0x20, 0x8a, 0x1c, 0xf9, 0x5d, 0x2e,
+    0x9d, 0xf3, 0xb3, 0xe7, 0x2d, 0xce, 0xc2, 0x0f, 0x26, 0x42, 0xff, 0x23, 0x8c, 0xfc, 0xfe, 0x34,
+    0xee, 0x67, 0x22, 0xbf, 0x14, 0x2b, 0x08, 0x3c, 0xc7, 0x4f, 0x7e, 0xc4, 0x4c, 0xad, 0x94, 0x05,
+    0x31, 0x1c, 0x8b, 0x76, 0x4f, 0x5a, 0x5f, 0x8a, 0xe1, 0x1d, 0x23, 0x9c, 0xfc, 0x4e, 0xb1, 0xfa,
+    0x19, 0xfc, 0x20, 0xe1, 0xf1, 0x96, 0xd8, 0x7f, 0x6c, 0x7a, 0xe0, 0x81, 0x9f, 0x27, 0xf1, 0x52,
+    0x1e, 0xf3, 0x0e, 0x44, 0x81, 0xc3, 0xbf, 0x91, 0x48, 0xef, 0x07, 0x01, 0x44, 0x42, 0x94, 0xef,
+    0x85, 0x4e, 0xe0, 0x83, 0x55, 0x93, 0x23, 0x4d, 0xf6, 0xd0, 0x63, 0x12, 0x3b, 0x41, 0x1c, 0xa2,
+    0x87, 0x94, 0x7d, 0x19, 0x2b, 0x71, 0x82, 0x69, 0x8c, 0x16, 0x29, 0xfb, 0x9a, 0x1c, 0x69, 0x32,
+    0xc6, 0x0a, 0x39, 0x27, 0xc9, 0x51, 0xc9, 0xbe, 0x26, 0x23, 0xc7, 0x18, 0xa4, 0x30, 0x4c, 0x04,
+    0x4a, 0xc9, 0xbe, 0x26, 0x4b, 0x54, 0x08, 0x3e, 0x09, 0xf2, 0x52, 0xb2, 0xaf, 0xc9, 0x88, 0x4a,
+    0xb8, 0x4f, 0x82, 0x19, 0x95, 0xcc, 0x51, 0x09, 0x5c, 0xa3, 0x20, 0x91, 0x95, 0xa8, 0xc8, 0x13,
+    0xcd, 0x22, 0xfa, 0x98, 0x1c, 0xbd, 0x79, 0xbd, 0xd0, 0x45, 0x55, 0x6f, 0x0c, 0x68, 0x15, 0x4b,
+    0xab, 0x1d, 0x50, 0xaa, 0xf7, 0xa7, 0xae, 0x86, 0x06, 0xca, 0xec, 0x84, 0x2f, 0x27, 0xa4, 0x7a,
+    0xa7, 0xe2, 0x7a, 0xc7, 0x1a, 0x39, 0x72, 0x62, 0xf6, 0x5e, 0x9f, 0xa2, 0x36, 0x53, 0x6e, 0x09,
+    0x78, 0xf5, 0xb1, 0x67, 0x4c, 0xcb, 0x7b, 0x32, 0x79, 0x7d, 0x0e, 0x53, 0x40, 0xc7, 0xc7, 0x8c,
+    0x7a, 0xbf, 0xf4, 0x99, 0x2a, 0x94, 0x6f, 0xa0, 0x62, 0x81, 0xe2, 0x65, 0xf0, 0x0e, 0xc6, 0x62,
+    0x43, 0xaa, 0xc3, 0xc1, 0xfc, 0x83, 0x0d, 0x50, 0xfe, 0x66, 0xf0, 0x1c, 0xfb, 0x2f, 0x52, 0x91,
+    0x1c, 0xde, 0x3a, 0xfc, 0x20, 0x20, 0xde, 0xa4, 0x70, 0x68, 0x30, 0xde, 0x99, 0xed, 0xb6, 0x6c,
+    0x5c, 0xf9, 0xe2, 0x84, 0x47, 0x1f, 0x3a, 0xfa, 0x8e, 0xfd, 0x0e, 0xde, 0x86, 0xd5, 0x2b, 0x6b,
+    0x57, 0xd3, 0x5a, 0xba, 0xc0, 0x83, 0x67, 0xc8, 0x1f, 0x92, 0xce, 0x3a, 0xab, 0x1a, 0xa2, 0xa1,
+    0x83, 0x23, 0x3a, 0xaf, 0xab, 0x9a, 0xf5, 0xe1, 0xfc, 0x47, 0x43, 0x8f, 0x1d, 0xfb, 0xba, 0x6c,
+    0xb7, 0x84, 0x95, 0x74, 0xf3, 0x24, 0xbe, 0x08, 0xfd, 0x24, 0x41, 0x68, 0xb8, 0xf4, 0x93, 0xa0,
+    0x4f, 0x2f, 0x4b, 0xe4, 0xd8, 0x1f, 0xf7, 0xe2, 0x89, 0x2d, 0x4a, 0x07, 0x78, 0x27, 0x96, 0xea,
+    0x9c, 0x65, 0x8f, 0x46, 0x5a, 0xcb, 0xfe, 0xf9, 0xd7, 0x76, 0xe4, 0x0b, 0xde, 0xe6, 0xc7, 0x2a,
+    0x0f, 0xe2, 0xa8, 0xf5, 0x17, 0x5c, 0xeb, 0xf0, 0xbf, 0x6f, 0x4e, 0xf0, 0x47, 0x30, 0xc3, 0x20,
+    0x34, 0x87, 0xad, 0xd2, 0xe8, 0x2e, 0x77, 0x73, 0xdb, 0x81, 0x97, 0x1a, 0x4c, 0xc4, 0x77, 0xa3,
+    0xf0, 0x17, 0x42, 0x9b, 0x3d, 0x27, 0x0b, 0x2a, 0x1f, 0x55, 0x2b, 0x5c, 0x05, 0xb8, 0xca, 0x11,
+    0x31, 0x5b, 0xb1, 0x2b, 0x51, 0x12, 0x58, 0xa0, 0x6f, 0x81, 0xeb, 0x8f, 0x75, 0xd7, 0x10, 0x55,
+    0xd2, 0x35, 0xc2, 0x55, 0xae, 0x3b, 0xc5, 0xa8, 0x2b, 0x10, 0x31, 0xe1, 0xab, 0x09, 0x46, 0xd0,
+    0xe3, 0x24, 0x42, 0xbf, 0x7a, 0x9a, 0x73, 0xca, 0x0d, 0xd3, 0xa7, 0x0e, 0xbe, 0x27, 0x0c, 0x2b,
+    0x43, 0xe7, 0x0b, 0xdd, 0x33, 0xcc, 0xe1, 0x89, 0xc6, 0x2d, 0x85, 0x81, 0x86, 0x72, 0x42, 0x37,
+    0x78, 0x26, 0x74, 0x28, 0x0c, 0xcf, 0x90, 0xf1, 0x23, 0x61, 0xc9, 0x0d, 0x34, 0x14, 0x18, 0xb9,
+    0x89, 0xd1, 0x15, 0x7f, 0x82, 0xba, 0x95, 0xe1, 0x9c, 0xa0, 0xd2, 0xf4, 0x86, 0xfa, 0x26, 0x6e,
+    0xf4, 0x94, 0x04, 0xbc, 0x7d, 0xb8, 0xe1, 0x19, 0x12, 0x81, 0x2f, 0x2c, 0xb9, 0xc4, 0x05, 0x62,
+    0x65, 0xdd, 0x07, 0x72, 0x3d, 0x46, 0x3f, 0x50, 0x18, 0x4e, 0xa1, 0x54, 0xdf, 0x5c, 0x1b, 0x59,
+    0x22, 0xce, 0x29, 0x8e, 0xd6, 0x06, 0x36, 0xc6, 0x90, 0x3d, 0x28, 0xd4, 0x34, 0x56, 0xa3, 0x93,
+    0x2a, 0x31, 0xb5, 0x38, 0x36, 0x9c, 0xa7, 0xb2, 0x74, 0x20, 0xa0, 0x63, 0xc7, 0x72, 0x5e, 0xd6,
+    0xfd, 0xd8, 0xd8, 0x52, 0x6a, 0xef, 0xf5, 0xe1, 0x81, 0xdc, 0x58, 0x7d, 0xbc, 0xd8, 0x83, 0xd3,
+    0x3e, 0x5a, 0x4e, 0xac, 0x57, 0xf4, 0x38, 0x42, 0x7e, 0xc6, 0x26, 0x19, 0xcb, 0x79, 0xf5, 0xb1,
+    0x13, 0x1e, 0xc2, 0xf3, 0xad, 0xb5, 0x01, 0x96, 0xfb, 0xb2, 0x0f, 0x9e, 0x22, 0x3b, 0x20, 0x67,
+    0xdc, 0x0c, 0x9e, 0x54, 0xcf, 0xad, 0xfb, 0x50, 0xc7, 0x87, 0x3e, 0xef, 0x5d, 0x64, 0x70, 0x0e,
+    0x45, 0x85, 0x93, 0x5e, 0xe4, 0x70, 0xac, 0x22, 0x1b, 0x77, 0x68, 0x88, 0x05, 0xf6, 0xc1, 0x50,
+    0x9f, 0x3f, 0x76, 0xc7, 0x0f, 0x06, 0x34, 0x16, 0x50, 0x63, 0x28, 0xe1, 0x04, 0x9b, 0xdf, 0x0b,
+    0x9a, 0xa0, 0xbb, 0xb1, 0x4b, 0x43, 0xb1, 0x21, 0xc7, 0x6f, 0x75, 0x60, 0xe4, 0x21, 0xf0, 0xa8,
+    0xec, 0xff, 0x33, 0x51, 0x87, 0x5b, 0x38, 0xa7, 0x12, 0x71, 0x60, 0x56, 0x67, 0x51, 0xfe, 0x37,
+    0x03, 0xfe, 0xdf, 0xb9, 0x78, 0x30, 0xbe, 0xc0, 0x03, 0xcb, 0x42, 0xc0, 0x96, 0xf8, 0xf7, 0x54,
+    0x47, 0x6e, 0xbf, 0x87, 0xf4, 0x97, 0xa7, 0xd3, 0xa6, 0x50, 0x61, 0xfe, 0xf3, 0xb3, 0xff, 0x00,
+    0x7a, 0x42, 0x4f, 0x9c, 0xcb, 0x0f, 0x00, 0x00,
+};
+
+/* sendJS_B: 1860 bytes, 447 gzipped */
+const uint8_t Gz__jsB[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x55, 0x4d, 0x6b, 0x83, 0x40,
+    0x10, 0xbd, 0x07, 0xfc, 0x0f, 0x7b, 0x0a, 0x1a, 0xb7, 0xa9, 0x59, 0x6b, 0x2c, 0x18, 0x4f, 0xa5,
+    0x21, 0xa7, 0xd2, 0x53, 0x3f, 0x10, 0x29, 0xba, 0x1a, 0xbb, 0x44, 0x34, 0xac, 0x1a, 0x0a, 0x21,
+    0xff, 0xbd, 0xb3, 0x6a, 0x34, 0x1f, 0x42, 0xb0, 0xc9, 0xa5, 0x87, 0xd5, 0x9d, 0x19, 0xe6, 0xbd,
+    0x79, 0xe3, 0xb8, 0xbb, 0xf1, 0x38, 0xca, 0xd2, 0x82, 0xd3, 0xd0, 0x92, 0x06, 0x1b, 0x30, 0x82,
+    0x0f, 0x8c, 0x82, 0x4f, 0x58, 0xef, 0xb0, 0x16, 0x18, 0x65, 0xf0, 0xce, 0x16, 0x10, 0x5c, 0x16,
+    0x09, 0xcd, 0x59, 0x9a, 0xa0, 0x28, 0xcc, 0xdf, 0xbc, 0x58, 0x5e, 0x63, 0xc4, 0x94, 0xad, 0x34,
+    0x60, 0x4b, 0x59, 0x5e, 0x8f, 0x03, 0x2f, 0xf7, 0x1c, 0xe6, 0xda, 0xb6, 0xf6, 0xa3, 0x69, 0x0a,
+    0x1a, 0x0e, 0x51, 0xe3, 0x54, 0x27, 0x7b, 0xb7, 0xc2, 0xc3, 0xbc, 0xe0, 0x09, 0xd2, 0xac, 0x8e,
+    0xb4, 0xf9, 0xbc, 0x33, 0x0d, 0xdc, 0xfb, 0xb4, 0x49, 0x57, 0x9a, 0xd9, 0x9d, 0x66, 0xb6, 0x69,
+    0x04, 0xd2, 0xea, 0xad, 0x0e, 0xdb, 0xdd, 0x99, 0x94, 0xaf, 0x29, 0x4d, 0xe3, 0x94, 0x57, 0x8a,
+    0x50, 0x3f, 0x49, 0xc7, 0x6e, 0x72, 0xa5, 0xd2, 0x2e, 0xb4, 0x4b, 0x0d, 0xe8, 0x87, 0x76, 0x50,
+    0x1b, 0xe9, 0x81, 0x76, 0x59, 0xa9, 0x6e, 0x5d, 0xdd, 0xb7, 0x03, 0xa5, 0x46, 0x0f, 0xb4, 0xcb,
+    0x4a, 0xa7, 0xed, 0x04, 0x98, 0xdd, 0x13, 0x60, 0xfe, 0xe7, 0x09, 0xf8, 0x73, 0x5f, 0xc8, 0x4d,
+    0xbf, 0x99, 0x7e, 0xd3, 0x79, 0x7a, 0xb8, 0xe9, 0xac, 0x1b, 0x3d, 0xd0, 0x1e, 0xb5, 0x1e, 0xf3,
+    0x34, 0x3d, 0x99, 0xa7, 0x6c, 0x7f, 0x38, 0x32, 0x4c, 0xc5, 0xe9, 0xd8, 0x12, 0xd2, 0x82, 0xbf,
+    0x7a, 0xb1, 0x43, 0x5d, 0x47, 0x73, 0xad, 0x36, 0x20, 0x48, 0xdb, 0xd0, 0xe4, 0x28, 0x44, 0x0e,
+    0x43, 0xe4, 0x28, 0xa4, 0xbb, 0x36, 0x31, 0x8c, 0x13, 0x72, 0x2f, 0x08, 0x04, 0x39, 0xc5, 0x1c,
+    0x47, 0xd8, 0xc7, 0x2b, 0x51, 0x40, 0x55, 0xa7, 0x43, 0x81, 0x55, 0x95, 0xf9, 0x68, 0xa5, 0xdc,
+    0xeb, 0x04, 0x53, 0x20, 0x52, 0xe5, 0xa8, 0xb1, 0x08, 0x58, 0x7e, 0x65, 0xb9, 0xe7, 0x3f, 0xc8,
+    0x33, 0xe7, 0x72, 0x85, 0x98, 0xe5, 0xc1, 0x53, 0x1a, 0x97, 0xb0, 0x77, 0x76, 0x65, 0x54, 0x6a,
+    0xa2, 0xc6, 0x2c, 0x15, 0xf8, 0x8d, 0x59, 0xe2, 0xd5, 0xbd, 0xe2, 0x23, 0x8e, 0x54, 0x14, 0x8d,
+    0x22, 0x78, 0xfa, 0x23, 0xff, 0x9c, 0xe8, 0x25, 0xf4, 0x6a, 0x26, 0x41, 0x21, 0x6e, 0x23, 0x96,
+    0x04, 0xb6, 0x56, 0xdf, 0x4c, 0x21, 0xe7, 0xf6, 0x51, 0x35, 0x75, 0x6f, 0x34, 0x57, 0x11, 0xd7,
+    0x53, 0xca, 0x91, 0x5c, 0xa6, 0xd8, 0x13, 0x8b, 0xcd, 0xaa, 0xd8, 0x38, 0x0e, 0x93, 0x28, 0xff,
+    0xb6, 0x98, 0xaa, 0x2a, 0xd2, 0xa0, 0xc6, 0x84, 0x50, 0x27, 0x0e, 0x2b, 0x71, 0xd8, 0x12, 0xc9,
+    0xe0, 0x98, 0x01, 0x9b, 0xb2, 0x15, 0x94, 0x60, 0x58, 0xa2, 0x0c, 0x66, 0xed, 0xca, 0x82, 0x6b,
+    0x31, 0xe0, 0xaa, 0x04, 0x48, 0x83, 0x5f, 0xa6, 0xc7, 0x36, 0xcb, 0x44, 0x07, 0x00, 0x00,
+};
+
+/* sendJS_C: 2957 bytes, 994 gzipped */
+const uint8_t Gz__jsC[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x56, 0x7f, 0x6f, 0xdb, 0x36,
+    0x10, 0xfd, 0x3f, 0x80, 0xbf, 0x03, 0x1b, 0x60, 0x31, 0x55, 0xc9, 0xae, 0xa4, 0x2e, 0x18, 0xb6,
+    0x98, 0x1e, 0xd6, 0x76, 0x83, 0x03, 0xb4, 0x45, 0xd1, 0x15, 0x53, 0x0b, 0x43, 0x18, 0x68, 0x91,
+    0xb6, 0xe9, 0xc9, 0x92, 0x41, 0x52, 0xb1, 0x8d, 0xa5, 0xdf, 0x7d, 0x47, 0x52, 0x72, 0x2d, 0xff,
+    0xe8, 0xb2, 0x0c, 0x03, 0x86, 0x18, 0x10, 0x79, 0x77, 0x8f, 0xf7, 0xee, 0xdd, 0x89, 0xca, 0xb4,
+    0x2a, 0x32, 0x2d, 0xca, 0x02, 0xad, 0x64, 0x99, 0xdd, 0x2e, 0x67, 0x58, 0xa8, 0xd7, 0x77, 0x79,
+    0x20, 0xd4, 0x7b, 0xce, 0xbc, 0x3f, 0x3b, 0x17, 0x62, 0x8a, 0x30, 0x2b, 0xb3, 0x6a, 0xc9, 0x0b,
+    0xdd, 0x9f, 0x71, 0xfd, 0x73, 0xce, 0xcd, 0x52, 0xbd, 0xd8, 0xbe, 0xcc, 0xa9, 0x52, 0x6f, 0xe9,
+    0x92, 0xe3, 0xae, 0x2a, 0x2b, 0x99, 0xf1, 0xdb, 0x25, 0x9d, 0xf1, 0xae, 0xd7, 0xcf, 0x79, 0x31,
+    0xd3, 0x73, 0x44, 0x08, 0x0a, 0xcd, 0x09, 0x34, 0xe7, 0x52, 0xe3, 0xee, 0x2f, 0x42, 0x2a, 0x8d,
+    0x14, 0xcf, 0x79, 0xa6, 0x91, 0x70, 0xa1, 0x37, 0x9d, 0x0b, 0xc9, 0x75, 0x25, 0x0b, 0x58, 0x7c,
+    0xee, 0x5c, 0xdc, 0x51, 0x89, 0x56, 0x34, 0xbf, 0x2d, 0x18, 0xe1, 0x2b, 0xf6, 0x93, 0x94, 0x63,
+    0x78, 0xc0, 0x2e, 0x1d, 0xc7, 0xe9, 0x8d, 0xa3, 0x62, 0x79, 0xa1, 0xab, 0x2b, 0x84, 0xf5, 0x76,
+    0xc5, 0xcb, 0xa9, 0x89, 0x37, 0x81, 0x0e, 0x96, 0x42, 0x52, 0x82, 0xba, 0x55, 0xc1, 0xf8, 0x54,
+    0x14, 0x9c, 0x75, 0xd1, 0xfd, 0xfd, 0x41, 0x44, 0xc3, 0x6e, 0x40, 0x50, 0xec, 0xed, 0xd1, 0xfb,
+    0x30, 0x17, 0x0a, 0xad, 0xe7, 0x42, 0xf3, 0xde, 0x24, 0xa7, 0xd9, 0x1f, 0x88, 0x09, 0xb5, 0xca,
+    0xe9, 0xf6, 0x88, 0xa4, 0x61, 0xf1, 0xa4, 0x25, 0xcf, 0x69, 0x26, 0x4f, 0x0e, 0x98, 0x00, 0xe7,
+    0xd3, 0x4c, 0x86, 0x40, 0xa4, 0x2e, 0x1b, 0x81, 0x64, 0x2e, 0x4b, 0x56, 0xc9, 0x77, 0x34, 0x27,
+    0x6d, 0x04, 0xb8, 0x6c, 0x07, 0x96, 0xb8, 0xcb, 0x94, 0x7e, 0x51, 0x6e, 0x40, 0x6c, 0x51, 0x14,
+    0x5c, 0x8e, 0x3e, 0xbc, 0x79, 0x4d, 0x3a, 0x17, 0xdd, 0x81, 0x5a, 0xd1, 0x02, 0x65, 0xa6, 0x31,
+    0xe4, 0x52, 0x0b, 0x9d, 0xf3, 0xcb, 0xe1, 0x3b, 0xe8, 0x2b, 0x57, 0x0a, 0x54, 0xb3, 0xa2, 0x0f,
+    0x9e, 0x99, 0x98, 0xe1, 0x60, 0x22, 0x87, 0x83, 0x8c, 0x16, 0x77, 0x54, 0x21, 0xc1, 0xc8, 0xa5,
+    0x5b, 0x5e, 0x0e, 0x07, 0xcf, 0xdc, 0x6a, 0xd8, 0xbd, 0x71, 0xfd, 0x70, 0x5b, 0xd2, 0xe4, 0x75,
+    0x5b, 0x2b, 0x8a, 0x4a, 0x88, 0x92, 0x66, 0x64, 0xfa, 0x6b, 0xc1, 0xf4, 0xdc, 0x58, 0x46, 0x8d,
+    0x65, 0xce, 0xc5, 0x6c, 0xae, 0x8d, 0xc9, 0x4e, 0xc6, 0x0e, 0xee, 0xb6, 0x0e, 0x6e, 0x97, 0x0e,
+    0x4b, 0x54, 0xf2, 0xc5, 0xe2, 0xb0, 0x44, 0x8d, 0xbe, 0x98, 0x00, 0xfe, 0xb2, 0x2c, 0x34, 0xdf,
+    0x40, 0xa3, 0x62, 0x06, 0x55, 0x33, 0x49, 0xd7, 0x76, 0xdc, 0xb0, 0x4b, 0x18, 0x84, 0xf0, 0xa7,
+    0x92, 0x40, 0x8d, 0xcc, 0xd1, 0xec, 0x23, 0x08, 0x27, 0x15, 0xbf, 0x2d, 0x34, 0x6e, 0x32, 0x17,
+    0x15, 0xfb, 0xdd, 0xe8, 0x75, 0x47, 0xf3, 0x8a, 0xdb, 0xa0, 0x4f, 0xa7, 0x83, 0xb6, 0xad, 0xa0,
+    0xe4, 0x74, 0xd0, 0xba, 0x15, 0x34, 0x3a, 0x1d, 0x34, 0xdf, 0x0f, 0x12, 0x53, 0x8c, 0x59, 0x32,
+    0x78, 0xee, 0xdd, 0xdf, 0x63, 0x36, 0x82, 0xe7, 0xde, 0xec, 0xd9, 0x4a, 0x10, 0xcc, 0x9f, 0x2e,
+    0x4b, 0xa4, 0x96, 0x34, 0xcf, 0x8f, 0xa6, 0xce, 0xe9, 0x5e, 0xab, 0xc5, 0x8c, 0x5a, 0xb5, 0xa5,
+    0x56, 0x8b, 0x8d, 0xea, 0x7e, 0x09, 0x98, 0xb8, 0x0d, 0x09, 0xeb, 0xdd, 0xea, 0x57, 0x99, 0x91,
+    0x73, 0x22, 0x82, 0xc1, 0x66, 0x7e, 0x45, 0x35, 0xc5, 0x2d, 0x01, 0x2d, 0xf4, 0x95, 0xd2, 0xa4,
+    0x4e, 0xf2, 0xf7, 0x50, 0x96, 0x04, 0x6c, 0x54, 0xd7, 0x69, 0x6f, 0x10, 0x53, 0xde, 0xb4, 0x94,
+    0x08, 0x9b, 0xb3, 0x16, 0x40, 0x68, 0x31, 0x00, 0x8e, 0x0b, 0xdf, 0x37, 0x0e, 0x63, 0xdb, 0x12,
+    0xf6, 0xc9, 0x5f, 0xd4, 0xaf, 0x35, 0xde, 0x0e, 0x42, 0xa3, 0xcc, 0x76, 0x08, 0x7d, 0xf7, 0x5a,
+    0x58, 0x01, 0x58, 0x31, 0x80, 0x92, 0x85, 0xef, 0x07, 0xb6, 0x3a, 0x9f, 0x7c, 0xeb, 0xc1, 0x45,
+    0xa2, 0x7f, 0xa3, 0x39, 0x36, 0x2c, 0x9d, 0x35, 0xc0, 0xc2, 0x5f, 0x78, 0xdf, 0xc4, 0x84, 0x84,
+    0x3f, 0x46, 0x3f, 0x84, 0x86, 0x4b, 0x06, 0x9c, 0x45, 0x51, 0x71, 0x27, 0xe1, 0xc9, 0x13, 0x1b,
+    0x36, 0x1b, 0xc2, 0x3e, 0xfa, 0xa2, 0x61, 0xb3, 0x71, 0x6c, 0x36, 0xc0, 0x26, 0xb1, 0x6c, 0x1e,
+    0x92, 0xad, 0xe1, 0x76, 0x94, 0xd8, 0xaa, 0x59, 0x2a, 0x82, 0xb7, 0x4f, 0x55, 0xe2, 0x6f, 0xbc,
+    0xa7, 0x26, 0xe4, 0xf8, 0x44, 0xd0, 0xf4, 0x2d, 0xa7, 0x12, 0x9b, 0x9e, 0xf5, 0x19, 0x08, 0x3b,
+    0x06, 0x50, 0x1a, 0xb4, 0xb6, 0x7e, 0x74, 0x68, 0x88, 0x53, 0xef, 0x20, 0xf9, 0x67, 0xf7, 0xe3,
+    0xb9, 0xe2, 0x75, 0x71, 0xd4, 0xdc, 0xa8, 0xcd, 0x48, 0x4c, 0xcc, 0x26, 0xaa, 0x37, 0x5c, 0x4a,
+    0xb8, 0x5f, 0x48, 0xc1, 0xd7, 0x08, 0x9e, 0x74, 0x8b, 0x63, 0x73, 0x98, 0xb3, 0x8e, 0xc3, 0x74,
+    0xcf, 0xc1, 0x92, 0x3d, 0x4f, 0x74, 0xec, 0x39, 0xad, 0xee, 0x0e, 0x31, 0xb1, 0xd7, 0xb8, 0x48,
+    0xc9, 0xd8, 0x4c, 0x4b, 0x98, 0xde, 0xfc, 0xa7, 0xd3, 0xf1, 0xcf, 0x87, 0xc3, 0x4a, 0x84, 0xb1,
+    0x15, 0xc7, 0xac, 0x3d, 0x3f, 0xf2, 0xae, 0xa2, 0xb3, 0x75, 0x3d, 0xa0, 0xaa, 0xff, 0xc5, 0x94,
+    0x19, 0x63, 0x99, 0xc3, 0xe7, 0xd4, 0xf1, 0xa5, 0x35, 0xdf, 0xda, 0x23, 0x49, 0x6b, 0x96, 0x10,
+    0x4a, 0x7d, 0x08, 0x1e, 0x87, 0x8d, 0x7f, 0x46, 0x0e, 0x87, 0xcf, 0xfa, 0xa3, 0xc6, 0x3f, 0x21,
+    0x87, 0xb3, 0x68, 0xfd, 0x71, 0xe3, 0xcf, 0xca, 0x1c, 0xea, 0x81, 0x8f, 0x9a, 0xfb, 0x9a, 0x8d,
+    0x9b, 0x09, 0x97, 0xc1, 0x2c, 0x98, 0x78, 0x26, 0xca, 0x94, 0xea, 0xf0, 0xae, 0x2e, 0x3f, 0x25,
+    0x0e, 0xe4, 0x48, 0x9c, 0x77, 0x47, 0x5f, 0x77, 0xc7, 0x67, 0xdc, 0xf1, 0xf5, 0xb5, 0xb9, 0x58,
+    0x09, 0x96, 0xbd, 0x5d, 0x1e, 0xa3, 0xea, 0x8c, 0xe0, 0x59, 0x6f, 0x77, 0xb4, 0xb1, 0x4c, 0x08,
+    0x9e, 0xf4, 0x76, 0xa7, 0x79, 0xcd, 0xbf, 0x1f, 0xd0, 0x09, 0xd3, 0xa9, 0x76, 0xff, 0x41, 0x38,
+    0x42, 0x19, 0x33, 0xbd, 0x3b, 0x72, 0x04, 0xb6, 0xd8, 0xe0, 0xbb, 0x7e, 0xb8, 0xf7, 0xfe, 0xd4,
+    0x6e, 0x10, 0xf4, 0x34, 0xce, 0xbc, 0xe6, 0x0e, 0x17, 0xb7, 0x70, 0xf4, 0x1c, 0x8e, 0x1e, 0xe2,
+    0xea, 0x7c, 0xf6, 0x16, 0x40, 0x35, 0x73, 0x96, 0xf4, 0xa2, 0x63, 0xf2, 0xbd, 0x73, 0x24, 0x7a,
+    0xd1, 0x57, 0xc9, 0x3f, 0xa0, 0xe8, 0xef, 0xf7, 0x48, 0x3c, 0x26, 0xef, 0xf3, 0x47, 0xe6, 0xbd,
+    0x7e, 0xa4, 0xd8, 0xd1, 0xbf, 0x14, 0x7b, 0xef, 0x77, 0xee, 0xc3, 0xb9, 0xaa, 0xf6, 0x3e, 0x9c,
+    0xf6, 0x45, 0x87, 0x7b, 0xa3, 0x06, 0x77, 0x2e, 0xfe, 0x02, 0xf6, 0x44, 0x29, 0x97, 0x8d, 0x0b,
+    0x00, 0x00,
+};
+
+/* sendJS_D: 5276 bytes, 1348 gzipped */
+const uint8_t Gz__jsD[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x58, 0x51, 0x4f, 0xe3, 0x46,
+    0x10, 0x7e, 0x3e, 0x24, 0xfe, 0xc3, 0xf2, 0xd0, 0xd8, 0x8b, 0x4d, 0xb0, 0x1d, 0x92, 0xc0, 0xc5,
+    0x9b, 0x8a, 0x02, 0x15, 0x27, 0x1d, 0x05, 0x1d, 0xa8, 0x87, 0x84, 0x10, 0x32, 0xf1, 0x26, 0xf6,
+    0xe1, 0xd8, 0xc6, 0x76, 0x12, 0x47, 0x84, 0xff, 0xde, 0xd9, 0xf5, 0x3a, 0xb1, 0x9d, 0xc0, 0xd1,
+    0x6b, 0x4e, 0x6a, 0x51, 0x01, 0xd9, 0x99, 0xd9, 0x99, 0xd9, 0x99, 0x6f, 0x66, 0x77, 0x26, 0x8c,
+    0xad, 0x08, 0x85, 0xe9, 0x27, 0xdf, 0x56, 0xe3, 0x04, 0x9e, 0x9d, 0xcd, 0x8d, 0x31, 0x70, 0x6c,
+    0x37, 0x0e, 0xbf, 0xaa, 0xec, 0x79, 0x2a, 0x38, 0xa9, 0xf3, 0x85, 0x3e, 0x72, 0xce, 0xb5, 0xe0,
+    0x44, 0x8f, 0x17, 0x51, 0x5f, 0x8d, 0x1e, 0xcf, 0xe2, 0x01, 0x3c, 0x7f, 0x1b, 0xf5, 0x81, 0xdf,
+    0x1f, 0xf9, 0xbd, 0xc4, 0x0d, 0x7c, 0x74, 0x3f, 0x4d, 0xe8, 0x55, 0x70, 0x99, 0x44, 0xf2, 0x18,
+    0x3f, 0x45, 0x34, 0x19, 0x45, 0x3e, 0x02, 0xca, 0xf5, 0x07, 0xf5, 0x7e, 0x14, 0x0c, 0x8f, 0x1c,
+    0x2b, 0x3a, 0x0a, 0x6c, 0x2a, 0xcb, 0x63, 0x54, 0x43, 0x5a, 0xfa, 0x3b, 0x46, 0x0a, 0x3a, 0x68,
+    0xab, 0x88, 0x31, 0xba, 0x5d, 0xb4, 0x87, 0x8b, 0x6c, 0xdc, 0x79, 0x2e, 0x98, 0x9e, 0x04, 0x91,
+    0x5d, 0x35, 0x5d, 0xd8, 0xae, 0x06, 0x6a, 0x5c, 0x6f, 0xc1, 0x93, 0xc7, 0xdd, 0xee, 0x3e, 0xce,
+    0x16, 0x4a, 0xa6, 0x46, 0x77, 0x31, 0xf5, 0x6d, 0xb9, 0x37, 0xb4, 0x55, 0x9f, 0xa6, 0x89, 0x7a,
+    0x1f, 0xd8, 0x53, 0xbc, 0xb9, 0xf1, 0xb4, 0xb9, 0xc1, 0xc3, 0xad, 0x07, 0x21, 0xf5, 0x65, 0xe9,
+    0xe2, 0xfc, 0xf2, 0x4a, 0x52, 0x79, 0xb8, 0x0a, 0x13, 0x45, 0x49, 0x34, 0xa2, 0xb8, 0x93, 0x0b,
+    0x71, 0x13, 0x4c, 0x73, 0x36, 0x93, 0x24, 0xc6, 0x76, 0xfb, 0x32, 0xb3, 0x86, 0x39, 0xa0, 0x8a,
+    0x02, 0x1c, 0xe1, 0xa5, 0x06, 0x1f, 0xcb, 0xdb, 0x33, 0x39, 0x39, 0xdb, 0xd1, 0xf3, 0x41, 0x9a,
+    0x30, 0x11, 0x9e, 0x0e, 0xfe, 0x49, 0xf8, 0x27, 0xfd, 0x71, 0x72, 0x7d, 0x75, 0x27, 0xa9, 0xf9,
+    0xbe, 0x65, 0x1b, 0x76, 0xe0, 0x53, 0x61, 0x23, 0xa6, 0xb0, 0x25, 0x78, 0xec, 0x05, 0x83, 0x2b,
+    0x6b, 0x20, 0xa9, 0xd2, 0x51, 0x30, 0x0c, 0x3d, 0x9a, 0xd0, 0x2d, 0xee, 0x98, 0x70, 0x23, 0xb7,
+    0x7a, 0x79, 0x7a, 0xfe, 0xf5, 0x45, 0xab, 0xb1, 0x13, 0x4c, 0x64, 0x4b, 0x7d, 0xd0, 0xd5, 0x07,
+    0x03, 0x3f, 0xf1, 0x0a, 0x20, 0x92, 0xa4, 0xc8, 0x0f, 0xba, 0xf2, 0x60, 0x6c, 0x73, 0x17, 0x77,
+    0xad, 0xba, 0x47, 0xfd, 0x41, 0xe2, 0xe0, 0x0e, 0x84, 0x9c, 0x0a, 0xa2, 0xdb, 0xc4, 0x29, 0x49,
+    0xeb, 0xf1, 0xe8, 0x3e, 0xe6, 0xf9, 0x96, 0x35, 0xb5, 0x89, 0x3b, 0x4b, 0x9e, 0x5d, 0x44, 0xc1,
+    0x20, 0xa2, 0x71, 0xfc, 0x11, 0x49, 0x4a, 0xaa, 0x48, 0xbf, 0x48, 0xdc, 0x08, 0xaf, 0x23, 0xc8,
+    0x2a, 0x7b, 0xd5, 0xc3, 0x51, 0xec, 0xc8, 0xbc, 0xbe, 0xf8, 0x1a, 0xdf, 0xd3, 0x9c, 0xef, 0x29,
+    0x82, 0x01, 0x3b, 0x43, 0x37, 0xa6, 0x75, 0xb0, 0x15, 0x78, 0x63, 0x00, 0xa2, 0x9e, 0x38, 0x90,
+    0x34, 0x91, 0x3f, 0xdf, 0x0b, 0x2c, 0x1b, 0x77, 0x52, 0x92, 0x59, 0xfc, 0x16, 0xb8, 0xe0, 0x03,
+    0x6c, 0xc5, 0x49, 0x72, 0x73, 0xdb, 0xa9, 0x42, 0x72, 0xf5, 0xe5, 0x4c, 0x40, 0xa2, 0xa6, 0x50,
+    0x2b, 0xe5, 0x65, 0xee, 0x8b, 0xb2, 0xa8, 0x3f, 0x4e, 0xe7, 0xfe, 0x28, 0xd2, 0xe7, 0xf3, 0xc3,
+    0x63, 0x50, 0xe6, 0x7e, 0x76, 0xc9, 0x02, 0x9c, 0x4a, 0xba, 0xac, 0xc4, 0x02, 0x60, 0x7b, 0x02,
+    0x5a, 0x9e, 0x37, 0x6e, 0x08, 0xe0, 0xcd, 0x8a, 0xa7, 0x47, 0xc8, 0x8e, 0x9e, 0x2d, 0x4c, 0x1c,
+    0xd7, 0x83, 0x43, 0x52, 0x09, 0xbd, 0x56, 0x2b, 0x6d, 0x6d, 0xea, 0x9a, 0xa6, 0xe1, 0x4c, 0x81,
+    0x25, 0x6a, 0xcc, 0x6b, 0xa7, 0x1f, 0x44, 0x48, 0x66, 0xa4, 0x0b, 0xa4, 0x6b, 0xea, 0xad, 0x8e,
+    0xab, 0x10, 0x03, 0x2f, 0x03, 0x39, 0x9e, 0x11, 0xd9, 0xba, 0xe1, 0x4c, 0x45, 0xb9, 0x35, 0x4d,
+    0x97, 0x97, 0x0a, 0xb3, 0x8f, 0x14, 0x52, 0x3a, 0x6d, 0x59, 0x91, 0xc0, 0x1f, 0xf5, 0x62, 0x8a,
+    0x84, 0xa7, 0xc6, 0xcf, 0xf1, 0x74, 0x6f, 0x7d, 0x9e, 0xae, 0xd9, 0xbf, 0x7d, 0x70, 0x4f, 0xc1,
+    0x2c, 0xfc, 0x15, 0xd6, 0x16, 0xee, 0x6d, 0x91, 0x1e, 0xe6, 0x1e, 0xeb, 0xc6, 0x7e, 0xb7, 0x5b,
+    0x76, 0xb5, 0x78, 0x3b, 0xce, 0x5d, 0x5d, 0xd4, 0x5a, 0xf1, 0xe8, 0x55, 0xaa, 0xc7, 0x73, 0xe1,
+    0xb0, 0x57, 0xaa, 0x87, 0x1f, 0xce, 0x4e, 0xa9, 0x8a, 0xb2, 0x68, 0x97, 0x43, 0xcb, 0xee, 0x36,
+    0x1e, 0x55, 0x26, 0x92, 0x9a, 0xba, 0x61, 0xbc, 0x1a, 0xb0, 0x0c, 0x11, 0xb3, 0xc8, 0x32, 0x49,
+    0x16, 0xbb, 0x9a, 0x8a, 0xf8, 0xcb, 0xc1, 0xae, 0x3b, 0xd6, 0x90, 0x9d, 0xdd, 0x4f, 0x43, 0x6b,
+    0x90, 0xdf, 0x6e, 0xcc, 0xa3, 0x1e, 0x19, 0xd0, 0xe4, 0xc4, 0x1b, 0xca, 0x52, 0xcf, 0xf2, 0xc7,
+    0x56, 0xcc, 0xef, 0x35, 0xb6, 0x30, 0x21, 0xbc, 0x67, 0x91, 0x5e, 0x7d, 0xe2, 0xda, 0x89, 0x23,
+    0xb8, 0x0e, 0xe7, 0x9e, 0x02, 0xd7, 0xa1, 0xee, 0xc0, 0x49, 0x04, 0x3b, 0x04, 0x06, 0xd8, 0x39,
+    0x0a, 0xfc, 0x84, 0x5d, 0xc0, 0x92, 0x61, 0x4b, 0x98, 0x31, 0xf8, 0x6e, 0xc7, 0xec, 0x80, 0x6a,
+    0xaa, 0xa6, 0x4e, 0x54, 0x27, 0xb7, 0x6e, 0x11, 0x9f, 0x4e, 0xd0, 0x61, 0x14, 0x59, 0x53, 0x79,
+    0xb2, 0x3d, 0x67, 0xbb, 0x39, 0x5c, 0x1c, 0xad, 0x29, 0x50, 0x53, 0xd3, 0xe9, 0x4c, 0x01, 0x9e,
+    0x9c, 0xc7, 0xb0, 0x4e, 0xcd, 0x49, 0x07, 0x20, 0x53, 0x79, 0xd9, 0x88, 0x38, 0xdc, 0xb8, 0x8d,
+    0x08, 0x92, 0x93, 0x69, 0x48, 0x83, 0x3e, 0xea, 0x8d, 0xa2, 0x0b, 0xcb, 0x43, 0x5b, 0x84, 0x20,
+    0x69, 0xe4, 0xdb, 0xb4, 0x0f, 0x59, 0xb6, 0x25, 0x54, 0xab, 0x89, 0x15, 0x91, 0x43, 0x42, 0xda,
+    0xf3, 0x9d, 0xe3, 0xd6, 0x8f, 0xe8, 0xb7, 0x44, 0x7f, 0x82, 0xed, 0x01, 0x53, 0xeb, 0xc6, 0xbd,
+    0x65, 0x78, 0xfe, 0x69, 0x79, 0x77, 0xed, 0x5e, 0xe0, 0x81, 0xcf, 0xa1, 0xea, 0x9a, 0xa6, 0xc1,
+    0xa4, 0xf2, 0x33, 0x0e, 0x3b, 0x55, 0x44, 0x5b, 0xab, 0x44, 0x4b, 0x22, 0x85, 0x35, 0x48, 0x29,
+    0x1f, 0x1a, 0x2a, 0x9d, 0x8d, 0xf7, 0x46, 0xfe, 0x69, 0x7e, 0x15, 0x8b, 0x7e, 0xca, 0x91, 0xbe,
+    0x3e, 0xfb, 0x7c, 0x9a, 0x24, 0x21, 0x90, 0x23, 0x1a, 0x43, 0x87, 0xe4, 0x72, 0xd0, 0x7f, 0x89,
+    0xe4, 0x00, 0xfb, 0xe3, 0xee, 0xae, 0xa4, 0xe4, 0x75, 0xe0, 0x86, 0x77, 0x96, 0x6d, 0x47, 0x90,
+    0xc0, 0xb1, 0xe5, 0x8d, 0xa8, 0x22, 0xed, 0x66, 0xd7, 0x28, 0x8c, 0x12, 0x34, 0xb4, 0xd9, 0x2e,
+    0xa4, 0x81, 0x11, 0x9a, 0xcd, 0xd0, 0x82, 0x3e, 0xc0, 0x25, 0x7a, 0xaf, 0x81, 0x4b, 0x5d, 0x9f,
+    0x77, 0x0d, 0x92, 0x13, 0x34, 0x8a, 0xe0, 0x3c, 0x10, 0x94, 0x57, 0xa6, 0xa8, 0x46, 0x80, 0x26,
+    0x0b, 0x82, 0x68, 0x78, 0x5e, 0xce, 0xe2, 0x78, 0xb2, 0xea, 0x81, 0xf3, 0x26, 0xc0, 0x16, 0x62,
+    0xfa, 0x42, 0x2c, 0x6b, 0xd9, 0x0c, 0x9d, 0x4c, 0x22, 0x73, 0xa4, 0x6b, 0x34, 0xf1, 0x52, 0x93,
+    0x3e, 0xb9, 0x38, 0x96, 0x94, 0x55, 0x93, 0x53, 0xa6, 0xa3, 0xec, 0x18, 0x2d, 0xa5, 0xd5, 0x84,
+    0xee, 0x03, 0x9d, 0xa7, 0x6f, 0x41, 0x22, 0x56, 0x34, 0xfa, 0xef, 0xd9, 0x80, 0x09, 0xab, 0xac,
+    0xff, 0x5c, 0x01, 0x70, 0x4f, 0xfb, 0x09, 0x00, 0x35, 0x5f, 0xc6, 0x27, 0x1b, 0x8b, 0x4a, 0xab,
+    0xc6, 0x92, 0x8d, 0x06, 0x58, 0x58, 0x32, 0xd2, 0xf8, 0xef, 0x82, 0xac, 0xe1, 0xd9, 0xac, 0x50,
+    0xb2, 0x05, 0xa2, 0x55, 0x24, 0xda, 0x45, 0xe2, 0xa0, 0x48, 0xe8, 0x06, 0x50, 0x1f, 0x3e, 0x2c,
+    0xe8, 0x92, 0x9e, 0x5e, 0x92, 0x35, 0x8c, 0x12, 0x55, 0x92, 0x34, 0x4a, 0x5b, 0x18, 0xfb, 0xdf,
+    0xcd, 0x3d, 0x79, 0x4b, 0xe6, 0xc5, 0xdc, 0xf3, 0x4e, 0x8e, 0x86, 0x70, 0x4b, 0x6f, 0xb2, 0x4b,
+    0x36, 0x23, 0x90, 0x89, 0xf2, 0x56, 0xba, 0x1e, 0xa8, 0x76, 0xf4, 0xbf, 0x83, 0xd5, 0x5a, 0x03,
+    0x43, 0xd0, 0x49, 0x8c, 0x26, 0xbb, 0x24, 0x17, 0x74, 0xa3, 0xbd, 0xd6, 0xe0, 0x8c, 0xf7, 0x54,
+    0x08, 0x0c, 0x9f, 0xbd, 0x83, 0xff, 0xf1, 0x79, 0x0d, 0x9f, 0xa6, 0xb6, 0x18, 0xe3, 0x3c, 0xda,
+    0x4f, 0x0e, 0xb3, 0xa6, 0xcf, 0xff, 0x95, 0xc0, 0x66, 0x33, 0x41, 0xe7, 0x93, 0x53, 0x14, 0x4c,
+    0x60, 0x3e, 0x60, 0x2f, 0x18, 0xa9, 0xd8, 0x0b, 0xa6, 0x27, 0xa1, 0x7d, 0x6f, 0xc1, 0x68, 0x42,
+    0x18, 0x0f, 0x6d, 0xa3, 0x49, 0x41, 0x27, 0x65, 0xe3, 0x16, 0x3c, 0xcd, 0x96, 0xc6, 0xdf, 0x6c,
+    0xe0, 0xe2, 0x5b, 0x65, 0xdf, 0x25, 0xad, 0x1b, 0xae, 0xa9, 0xc0, 0xca, 0x2d, 0x2e, 0xab, 0x09,
+    0x05, 0x98, 0xd4, 0x84, 0x5a, 0xe6, 0xd2, 0x6a, 0xbd, 0xe7, 0x1f, 0x4d, 0x32, 0x2a, 0x67, 0x99,
+    0xbb, 0xa6, 0x22, 0x48, 0x35, 0xd2, 0x54, 0xb4, 0x22, 0xd9, 0xe8, 0xf5, 0x8e, 0x58, 0x31, 0x97,
+    0xb9, 0xfc, 0xb2, 0xbd, 0x46, 0x51, 0xe1, 0xdf, 0x5f, 0x3d, 0xf3, 0xaf, 0x6e, 0x6f, 0xc7, 0xba,
+    0x17, 0xf8, 0x71, 0xe0, 0xd1, 0xba, 0x17, 0x0c, 0x64, 0x69, 0xbb, 0xf8, 0xc3, 0xbf, 0x27, 0x14,
+    0x97, 0x39, 0x26, 0x55, 0xe6, 0x0a, 0x9d, 0x42, 0xfa, 0x6a, 0xb5, 0x79, 0x4f, 0x6c, 0xbc, 0xad,
+    0xaf, 0x2d, 0x1f, 0xeb, 0x45, 0xbb, 0xd7, 0x2b, 0xad, 0x1b, 0xff, 0xba, 0xa3, 0x7f, 0xfc, 0x47,
+    0x73, 0x91, 0xd8, 0xe2, 0x1d, 0xcc, 0x45, 0xf0, 0xc7, 0x7e, 0xff, 0x02, 0x39, 0xd7, 0x41, 0x94,
+    0x9c, 0x14, 0x00, 0x00,
+};
@@ -49,6 +49,14 @@ int Buff__getWord(int index)
     return a + (b << 8);
 }
 
+/* Writes a word into the buffer at specified position -----------------------*/
+void Buff__putWord(int index, int value)
+{
+    // Every byte takes 2 characters, 4 low bits first (see Buff__getByte)
+    for (int i = 0; i < 4; i++, value >>= 4)
+        Buff__bufArr[index + i] = (char)('a' + (value & 0xF));
+}
+
 /* Checks if the buffer's data ends with specified string --------------------*/
 int Buff__signature(int index, char*str)
 {
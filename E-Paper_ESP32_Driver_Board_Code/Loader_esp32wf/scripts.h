@@ -340,15 +340,15 @@ client.println(
 "var pxInd,stInd;\r\n"
 "var dispW,dispH;\r\n"
 "var xhReq,dispX;\r\n"
-"var rqPrf,rqMsg;\r\n"
+"var rqPrf,rqMsg,rqBuf;\r\n"
 
 "function byteToStr(v){return String.fromCharCode((v & 0xF) + 97, ((v >> 4) & 0xF) + 97);}\r\n"
 "function wordToStr(v){return byteToStr(v&0xFF) + byteToStr((v>>8)&0xFF);}\r\n"
 
-"function u_send(cmd,next)\r\n"
+"function u_send(cmd,next,body)\r\n"
 "{\r\n"
     "xhReq.open('POST',rqPrf+cmd, true);\r\n"
-    "xhReq.send('');\r\n"
+    "xhReq.send(body||'');\r\n"
 
   "if(next)stInd++;\r\n"
   "return 0;\r\n" 
@@ -372,6 +372,12 @@ client.println(
     "var x=''+(k1+k2*pxInd/a.length);"
     "if(x.length>5)x=x.substring(0,5);"
     "setInn('logTag','Progress: '+x+'%');"
+    "if(rqBuf){"
+        "rqBuf.push(rqMsg);"
+        "if(pxInd<a.length)return Promise.resolve().then(xhReq.onload);"
+        "x=rqBuf.join('');rqBuf=[];"
+        "return u_send('STRM_',true,x);"
+    "}"
     "return u_send(rqMsg+wordToStr(rqMsg.length)+'LOAD_',pxInd>=a.length);"
 "}\r\n"
 
@@ -448,6 +454,7 @@ client.println(
     "dispX=0;\r\n"
     "pxInd=0;\r\n"
     "stInd=0;\r\n"
+    "rqBuf=[];\r\n"
     "xhReq=new XMLHttpRequest();\r\n"
     "rqPrf='http://'+getElm('ip_addr').value+'/';\r\n"
 
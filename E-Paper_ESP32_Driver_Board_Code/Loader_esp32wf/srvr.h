@@ -18,10 +18,17 @@
 
 #include "buff.h" // POST request data accumulator
 #include "epd.h"  // e-Paper driver
+#include "strm.h" // Streaming upload of image data
 
 #include "scripts.h" // JavaScript code
 #include "css.h"     // Cascading Style Sheets
 #include "html.h"    // HTML page of the tool
+#include "assets_gz.h" // Gzipped styles and scripts (generated by assets.py)
+
+/* Styles and scripts are sent gzip-precompressed from flash ------------------*/
+// Set to 0 to send the plain texts of 'css.h' and 'scripts.h' instead.
+// The 'index' page isn't precompressed: it contains the IP address.
+#define Srvr__GZIP 1
 
 /* SSID and password of your WiFi net ----------------------------------------*/
 const char *ssid = "JSBZY-2.4G"; //"your ssid";
@@ -80,6 +87,32 @@ bool Srvr__file(WiFiClient client, int fileIndex, char *fileName)
     // Print log message: sending of script file
     Serial.print(fileName);
 
+#if Srvr__GZIP
+    // Choose the precompressed file
+    const uint8_t *data;
+    size_t size;
+    switch (fileIndex) {
+    case 0: data = Gz__css; size = sizeof(Gz__css); break;
+    case 1: data = Gz__jsA; size = sizeof(Gz__jsA); break;
+    case 2: data = Gz__jsB; size = sizeof(Gz__jsB); break;
+    case 3: data = Gz__jsC; size = sizeof(Gz__jsC); break;
+    default: data = Gz__jsD; size = sizeof(Gz__jsD); break;
+    }
+
+    // Sent to the 'client' the header describing the type and encoding of data,
+    // then the file itself directly from flash
+    client.printf("HTTP/1.1 200 OK\r\nContent-Type: %s\r\n"
+                  "Content-Encoding: gzip\r\nContent-Length: %u\r\n"
+                  "Connection: close\r\n\r\n",
+                  fileIndex == 0 ? "text/css" : "text/javascript", (unsigned)size);
+    client.write(data, size);
+    delay(1);
+
+    // Print log message: the end of request processing
+    Serial.println(">>>");
+
+    return true;
+#else
     // Sent to the 'client' the header describing the type of data.
     client.print(fileIndex == 0
                  ? "HTTP/1.1 200 OK\r\nContent-Type: text/css\r\n\r\n"
@@ -113,6 +146,50 @@ bool Srvr__file(WiFiClient client, int fileIndex, char *fileName)
     Serial.println(">>>");
 
     return true;
+#endif
+}
+
+/* Receiving a whole channel of image data by one request ---------------------*/
+bool Srvr__stream(WiFiClient &client)
+{
+    char line[64];
+    int  lineInd = 0;
+    long length = -1;
+    unsigned long last = millis();
+
+    // Read the rest of the request line and headers up to the empty line,
+    // only 'Content-Length' is needed
+    for (;;)
+    {
+        if (!client.available())
+        {
+            if (!client.connected() || (millis() - last > Strm__TIMEOUT)) return false;
+            delay(1);
+            continue;
+        }
+        int q = client.read();
+        last = millis();
+
+        if (q == 13) continue;
+        if (q == 10)
+        {
+            // The empty line: the body begins
+            if (lineInd == 0) break;
+
+            line[lineInd] = 0;
+            if (strncasecmp(line, "Content-Length:", 15) == 0) length = atol(line + 15);
+            lineInd = 0;
+            continue;
+        }
+        if (lineInd < (int)sizeof(line) - 1) line[lineInd++] = (char)q;
+    }
+
+    if (length <= 0) return false;
+
+    // Print log message: the length of image data
+    Serial.printf(" %ld", length);
+
+    return Strm__receive(client, length);
 }
 
 /* The server state observation loop -------------------------------------------*/
@@ -214,6 +291,16 @@ bool Srvr__loop()
                 break;
             }
 
+            // Image loading by one request, the data is the request's body
+            if (Buff__signature(Buff__bufInd - 4, "STRM")) {
+                // Print log message: image streaming
+                Serial.print("STRM");
+
+                if (!Srvr__stream(client))
+                    Serial.print(" failed");
+                break;
+            }
+
             // Select the next data channel
             if (Buff__signature(Buff__bufInd - 4, "NEXT")) {
                 // Print log message: next data channel
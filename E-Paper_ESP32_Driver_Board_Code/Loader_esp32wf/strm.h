@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file    strm.h
+  * @author  Waveshare Team
+  * @version V1.0.0
+  * @date    14-October-2026
+  * @brief   Streaming upload of image data.
+  *          This file provides firmware functions:
+  *           + Receiving a whole channel of image data by one POST request
+  *           + Writing received parts into e-Paper's memory while the next
+  *             part is still being received
+  *
+  ******************************************************************************
+  */
+
+/* Parts of the stream ---------------------------------------------------------*/
+// The body carries the same characters as the 'LOAD' requests do, so every
+// loading function of 'epd.h' is used as is. A part is a multiple of 8
+// characters (loaders take up to 4 characters per step) and leaves 8 characters
+// of the buffer for the length word and the 'LOAD' signature.
+#define Strm__CHUNK   2040
+#define Strm__SLOTS   2    // One part is received while the other is written
+#define Strm__TIMEOUT 3000 // Milliseconds without data before giving up
+
+char Strm__slotArr[Strm__SLOTS][Strm__CHUNK];
+int  Strm__slotLen[Strm__SLOTS];
+
+QueueHandle_t     Strm__free; // Indices of empty parts
+QueueHandle_t     Strm__full; // Indices of received parts, -1 is the end of data
+SemaphoreHandle_t Strm__done; // Given when all of received parts are written
+
+/* Writing task: loads received parts into the e-Paper -----------------------*/
+void Strm__task(void *arg)
+{
+    int slot;
+
+    for (;;)
+    {
+        xQueueReceive(Strm__full, &slot, portMAX_DELAY);
+
+        // The end of data: all of previous parts are already written
+        if (slot < 0)
+        {
+            xSemaphoreGive(Strm__done);
+            continue;
+        }
+
+        // Copy the part in the buffer as if it came by a 'LOAD' request
+        // and release the slot at once, so the receiving doesn't wait for e-Paper
+        int len = Strm__slotLen[slot];
+        memcpy(Buff__bufArr, Strm__slotArr[slot], len);
+        xQueueSend(Strm__free, &slot, portMAX_DELAY);
+
+        Buff__putWord(len, len);
+        memcpy(Buff__bufArr + len + 4, "LOAD", 4);
+        Buff__bufInd = len + 8;
+
+        // Load data into the e-Paper
+        // if there is loading function for current channel (black or red)
+        if (EPD_dispLoad != 0)
+            EPD_dispLoad();
+    }
+}
+
+/* Streaming initialization --------------------------------------------------*/
+void Strm__setup()
+{
+    Strm__free = xQueueCreate(Strm__SLOTS, sizeof(int));
+    Strm__full = xQueueCreate(Strm__SLOTS + 1, sizeof(int));
+    Strm__done = xSemaphoreCreateBinary();
+
+    for (int slot = 0; slot < Strm__SLOTS; slot++)
+        xQueueSend(Strm__free, &slot, 0);
+
+    // Arduino's loop() receives on core 1, e-Paper is written on core 0
+    xTaskCreatePinnedToCore(Strm__task, "Strm", 4096, NULL, 1, NULL, 0);
+}
+
+/* Receiving of the request's body part by part -------------------------------*/
+bool Strm__receive(WiFiClient &client, long length)
+{
+    unsigned long last = millis();
+    bool isOk = true;
+
+    while ((length > 0) && isOk)
+    {
+        // Wait for an empty part, the writing task releases it
+        int slot;
+        xQueueReceive(Strm__free, &slot, portMAX_DELAY);
+
+        int need = length < Strm__CHUNK ? (int)length : Strm__CHUNK;
+        int len = 0;
+
+        // Read as many characters as the client has sent already
+        while (len < need)
+        {
+            int n = client.available();
+            if (n <= 0)
+            {
+                if (!client.connected() || (millis() - last > Strm__TIMEOUT))
+                {
+                    isOk = false;
+                    break;
+                }
+                delay(1);
+                continue;
+            }
+            if (n > need - len) n = need - len;
+            n = client.read((uint8_t*)Strm__slotArr[slot] + len, n);
+            if (n > 0)
+            {
+                len += n;
+                last = millis();
+            }
+        }
+        length -= len;
+
+        // A byte takes 2 characters, a broken part isn't written at all
+        Strm__slotLen[slot] = isOk ? (len & ~1) : 0;
+        if (Strm__slotLen[slot] > 0)
+            xQueueSend(Strm__full, &slot, portMAX_DELAY);
+        else
+            xQueueSend(Strm__free, &slot, portMAX_DELAY);
+    }
+
+    // Wait until the last part is in e-Paper's memory
+    int slot = -1;
+    xQueueSend(Strm__full, &slot, portMAX_DELAY);
+    xSemaphoreTake(Strm__done, portMAX_DELAY);
+
+    return isOk;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file boot_choice.h
+ * @brief 启动选择器交给被启动应用的启动信息
+ *
+ * 选择器切换分区后用 esp_restart() 软件复位进入应用。软件复位不清除
+ * RTC_CNTL_STORE0_REG（ESP32-C3 上 ESP-IDF 不使用的保留寄存器，高位带校验字防止误读），
+ * 选择器在复位前把结果写进去，应用启动后读一次寄存器就知道自己是怎么被选中的，
+ * 不需要读 NVS 或 flash。
+ * 上电复位后寄存器为 0，读到的结果无效（应用是由 otadata 直接启动的）。
+ *
+ * 应用工程直接包含本文件即可（只依赖 soc 头文件）
+ */
+
+#ifndef BOOT_CHOICE_H
+#define BOOT_CHOICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "soc/soc.h"
+#include "soc/rtc_cntl_reg.h"
+
+#define BOOT_CHOICE_REG     RTC_CNTL_STORE0_REG
+#define BOOT_CHOICE_MAGIC   0xB5E1u     // 高 16 位
+
+typedef enum {
+    BOOT_SOURCE_DEFAULT = 1,    // 快速路径：NVS 中保存的默认应用
+    BOOT_SOURCE_MENU,           // 串口菜单中选择
+    BOOT_SOURCE_TIMEOUT,        // 进入了菜单但倒计时结束，启动默认应用
+} boot_source_t;
+
+typedef struct {
+    uint8_t app_index;          // 选择器应用表中的索引（app0/app1/app2）
+    boot_source_t source;
+} boot_choice_t;
+
+// 选择器：esp_restart() 之前调用
+static inline void boot_choice_write(uint8_t app_index, boot_source_t source)
+{
+    REG_WRITE(BOOT_CHOICE_REG, (BOOT_CHOICE_MAGIC << 16) | ((uint32_t)source << 8) | app_index);
+}
+
+// 应用：读取并清除（之后的软件复位不会误读到旧结果）；没有有效结果时返回 false
+static inline bool boot_choice_take(boot_choice_t *out)
+{
+    const uint32_t v = REG_READ(BOOT_CHOICE_REG);
+    REG_WRITE(BOOT_CHOICE_REG, 0);
+    if ((v >> 16) != BOOT_CHOICE_MAGIC) {
+        return false;
+    }
+    out->app_index = (uint8_t)(v & 0xFF);
+    out->source = (boot_source_t)((v >> 8) & 0xFF);
+    return out->source >= BOOT_SOURCE_DEFAULT && out->source <= BOOT_SOURCE_TIMEOUT;
+}
+
+#endif // BOOT_CHOICE_H
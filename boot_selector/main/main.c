@@ -11,12 +11,15 @@
 #include "esp_log.h"
 #include "driver/uart.h"
 #include "driver/gpio.h"
+#include "esp_rom_sys.h"
+#include "boot_choice.h"
 
 static const char *TAG = "boot_selector";
 
 #define UART_PORT UART_NUM_0
-#define TIMEOUT_SECONDS 10
+#define TIMEOUT_SECONDS 10            // 菜单倒计时（只在显式进入菜单时）
 #define GPIO_BOOT_SELECT GPIO_NUM_9  // 可根据需要修改
+#define PIN_SETTLE_US 100            // 上拉生效后再读引脚
 
 typedef struct {
     const char *name;
@@ -72,6 +75,9 @@ int get_default_app_from_nvs()
         nvs_close(handle);
     }
     
+    if (default_app < 0 || default_app >= num_apps) {
+        default_app = 0;
+    }
     return (int)default_app;
 }
 
@@ -89,7 +95,7 @@ void save_default_app_to_nvs(int app_index)
     }
 }
 
-void boot_to_app(int app_index, bool save_as_default)
+void boot_to_app(int app_index, bool save_as_default, boot_source_t source)
 {
     if (app_index < 0 || app_index >= num_apps) {
         printf("✗ 无效的应用索引: %d\n", app_index);
@@ -106,6 +112,12 @@ void boot_to_app(int app_index, bool save_as_default)
         printf("✗ 未找到 %s 分区\n", apps[app_index].name);
         return;
     }
+
+    // 选择器本身所在的分区：切过去只会再次回到这里
+    if (partition == esp_ota_get_running_partition()) {
+        printf("✗ %s 是启动选择器自身\n", apps[app_index].name);
+        return;
+    }
     
     if (save_as_default) {
         save_default_app_to_nvs(app_index);
@@ -117,12 +129,20 @@ void boot_to_app(int app_index, bool save_as_default)
         return;
     }
     
-    printf("\n正在启动 %s...\n", apps[app_index].name);
-    vTaskDelay(pdMS_TO_TICKS(500));
+    boot_choice_write((uint8_t)app_index, source);
+    if (source == BOOT_SOURCE_DEFAULT) {
+        // 快速路径：不等待串口输出
+        ESP_LOGI(TAG, "启动默认应用 %s", apps[app_index].name);
+    } else {
+        printf("\n正在启动 %s...\n", apps[app_index].name);
+        vTaskDelay(pdMS_TO_TICKS(500));
+    }
     esp_restart();
 }
 
-int check_gpio_selection()
+// 开机时检查一次：GPIO_BOOT_SELECT 拉低（按住 BOOT 键）时进入菜单。
+// 不用电源键：开机本来就要按住它
+bool menu_requested()
 {
     // 配置 GPIO 为输入，带上拉
     gpio_config_t io_conf = {
@@ -133,14 +153,12 @@ int check_gpio_selection()
         .pull_up_en = GPIO_PULLUP_ENABLE
     };
     gpio_config(&io_conf);
-    
-    // 延迟以确保引脚稳定
-    vTaskDelay(pdMS_TO_TICKS(10));
-    
-    int level = gpio_get_level(GPIO_BOOT_SELECT);
-    
-    // 如果 GPIO 为低电平（按钮按下），进入选择模式
-    return (level == 0) ? -1 : get_default_app_from_nvs();
+
+    // 等上拉生效，不需要毫秒级延时
+    esp_rom_delay_us(PIN_SETTLE_US);
+
+    // 低电平（按钮按下）进入选择模式
+    return gpio_get_level(GPIO_BOOT_SELECT) == 0;
 }
 
 void app_main(void)
@@ -152,6 +170,14 @@ void app_main(void)
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK(ret);
+
+    // 快速路径：没有要求菜单时直接启动默认应用（分区无效时才返回）
+    bool force_menu = menu_requested();
+    int default_app = get_default_app_from_nvs();
+    if (!force_menu) {
+        boot_to_app(default_app, false, BOOT_SOURCE_DEFAULT);
+        ESP_LOGW(TAG, "默认应用无法启动，进入菜单");
+    }
     
     // 配置 UART
     uart_config_t uart_config = {
@@ -168,13 +194,8 @@ void app_main(void)
     // 延迟一下让串口稳定
     vTaskDelay(pdMS_TO_TICKS(100));
     
-    // 检查 GPIO 是否要求进入选择模式
-    int gpio_choice = check_gpio_selection();
-    bool force_menu = (gpio_choice < 0);
-    int default_app = force_menu ? 0 : gpio_choice;
-    
     ESP_LOGI(TAG, "启动选择器已启动");
-    ESP_LOGI(TAG, "GPIO 检查: %s", force_menu ? "强制菜单" : "自动启动");
+    ESP_LOGI(TAG, "GPIO 检查: %s", force_menu ? "强制菜单" : "默认应用不可用");
     ESP_LOGI(TAG, "默认应用: %s (索引 %d)", apps[default_app].name, default_app);
     
     print_boot_menu();
@@ -201,11 +222,11 @@ void app_main(void)
                 } else if (ch == 's' || ch == 'S') {
                     save_default = true;
                     printf("\n将保存 %s 为默认应用\n", apps[selected_app].name);
-                    boot_to_app(selected_app, true);
+                    boot_to_app(selected_app, true, BOOT_SOURCE_MENU);
                     return;
                 } else if (ch == '\r' || ch == '\n') {
                     if (user_interacted) {
-                        boot_to_app(selected_app, save_default);
+                        boot_to_app(selected_app, save_default, BOOT_SOURCE_MENU);
                         return;
                     }
                 } else if (ch == 'r' || ch == 'R') {
@@ -225,5 +246,5 @@ void app_main(void)
     
     // 超时，启动默认应用
     printf("\n\n超时，启动默认应用 %s\n", apps[selected_app].name);
-    boot_to_app(selected_app, false);
+    boot_to_app(selected_app, false, BOOT_SOURCE_TIMEOUT);
 }
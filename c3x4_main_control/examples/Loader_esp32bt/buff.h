@@ -13,7 +13,9 @@
   */ 
 
 /* Size, current position index and byte array of the buffer -----------------*/
-#define Buff__SIZE 2050
+// Large enough for a 6-byte 'L' request header followed by one window of
+// image data (see Srvr__WIN_SIZE in srvr.h)
+#define Buff__SIZE 4110
 int     Buff__bufInd;
 char    Buff__bufArr[Buff__SIZE];
 
@@ -39,6 +41,51 @@ int Buff__getN3(int index)
         (Buff__bufArr[index + 2] << 16);
 }
 
+/* Unpacks PackBits data into the buffer at specified position --------------*/
+// Control byte c < 128: c + 1 literal bytes follow;
+// c >= 128: one byte follows, repeated c - 125 times.
+// Returns the number of unpacked bytes or -1 if the data doesn't fit or is broken
+int Buff__unpack(int index, const uint8_t *src, int srcLen, int maxLen)
+{
+    int len = 0;
+    int pos = 0;
+
+    while (pos < srcLen)
+    {
+        int c = src[pos++];
+        if (c < 128)
+        {
+            // Literal run
+            if ((pos + c + 1 > srcLen) || (len + c + 1 > maxLen)) return -1;
+            memcpy(&Buff__bufArr[index + len], &src[pos], c + 1);
+            pos += c + 1;
+            len += c + 1;
+        }
+        else
+        {
+            // Repeated byte
+            if ((pos >= srcLen) || (len + c - 125 > maxLen)) return -1;
+            memset(&Buff__bufArr[index + len], src[pos++], c - 125);
+            len += c - 125;
+        }
+    }
+    return len;
+}
+
+/* Computes CRC-32 (as zlib's crc32) of the buffer's data --------------------*/
+uint32_t Buff__crc32(int index, int len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (len-- > 0)
+    {
+        crc ^= (uint8_t)Buff__bufArr[index++];
+        for (int i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+}
+
 /* Checks if the buffer's data ends with specified string --------------------*/
 int Buff__signature(int index, char*str)
 {
@@ -8,10 +8,51 @@
 * | Date        :   2024-12-26
 ******************************************************************************/
 #include "DEV_Config.h"
+#include "spi_arbiter.h"
+#include "esp_attr.h"
+#include <string.h>
 
-static spi_device_handle_t spi_handle;
+static spi_device_handle_t spi_handle;      // NULL：EPD 设备未挂载（重新挂载失败后总线不可用）
 static bool spi_bus_initialized = false;  // 跟踪SPI总线是否已初始化
 
+// 各设备的时钟配置（EPD 写时钟可由启动探测调高）
+static UDOUBLE s_clock_hz[DEV_CLK_COUNT] = {
+    [DEV_CLK_EPD_WRITE] = DEV_EPD_WRITE_HZ_DEFAULT,
+    [DEV_CLK_EPD_READ]  = DEV_EPD_READ_HZ_DEFAULT,
+    [DEV_CLK_SD]        = DEV_SD_HZ_DEFAULT,
+};
+
+/**
+ * Pre-transfer callback: drive DC from trans->user (DEV_SPI_DC_*)
+ * 中断上下文中调用，命令与参数可以在同一次总线占用内连续排队，不再逐字节切换 GPIO 后阻塞发送
+**/
+static void IRAM_ATTR DEV_SPI_Pre_Transfer(spi_transaction_t *trans) {
+    const uintptr_t dc = (uintptr_t)trans->user;
+    if (dc != DEV_SPI_DC_KEEP) {
+        gpio_set_level(EPD_DC_PIN, dc == DEV_SPI_DC_DATA);
+    }
+}
+
+/**
+ * Attach the EPD to the bus with the given clock
+ * read = true: 3 线半双工（SDA 双向），用于读取控制器寄存器/RAM
+**/
+static esp_err_t DEV_SPI_Add_EPD(UDOUBLE hz, bool read) {
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = (int)hz,
+        .mode = 0,  // SPI mode 0
+        .spics_io_num = EPD_CS_PIN,
+        .queue_size = DEV_SPI_QUEUE_SIZE,
+        .flags = read ? (SPI_DEVICE_3WIRE | SPI_DEVICE_HALFDUPLEX) : 0,
+        .pre_cb = DEV_SPI_Pre_Transfer,
+    };
+    const esp_err_t ret = spi_bus_add_device(SPI2_HOST, &devcfg, &spi_handle);
+    if (ret != ESP_OK) {
+        spi_handle = NULL;
+    }
+    return ret;
+}
+
 /**
  * GPIO read and write
 **/
@@ -27,6 +68,9 @@ UBYTE DEV_Digital_Read(UWORD Pin) {
  * SPI
 **/
 void DEV_SPI_WriteByte(UBYTE Value) {
+    if (spi_handle == NULL) {
+        return;
+    }
     spi_transaction_t trans = {
         .length = 8,
         .tx_buffer = &Value,
@@ -35,6 +79,9 @@ void DEV_SPI_WriteByte(UBYTE Value) {
 }
 
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len) {
+    if (spi_handle == NULL) {
+        return;
+    }
     spi_transaction_t trans = {
         .length = Len * 8,
         .tx_buffer = pData,
@@ -42,6 +89,304 @@ void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len) {
     spi_device_transmit(spi_handle, &trans);
 }
 
+/**
+ * One short polling transaction on an already acquired bus
+ * 不超过 4 字节时放进 tx_data，不走 DMA 描述符
+**/
+static void DEV_SPI_Poll(const uint8_t *pData, uint32_t Len, uintptr_t Dc, bool KeepCs) {
+    spi_transaction_t trans = {
+        .length = Len * 8,
+        .user = (void *)Dc,
+        .flags = KeepCs ? SPI_TRANS_CS_KEEP_ACTIVE : 0,
+    };
+    if (Len <= sizeof(trans.tx_data)) {
+        trans.flags |= SPI_TRANS_USE_TXDATA;
+        memcpy(trans.tx_data, pData, Len);
+    } else {
+        trans.tx_buffer = pData;
+    }
+    spi_device_polling_transmit(spi_handle, &trans);
+}
+
+/**
+ * SPI data write (DC = 1)
+**/
+void DEV_SPI_Write_Data(const uint8_t *pData, uint32_t Len) {
+    if (pData == NULL || Len == 0 || spi_handle == NULL) {
+        return;
+    }
+    spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+    DEV_SPI_Poll(pData, Len, DEV_SPI_DC_DATA, false);
+    spi_device_release_bus(spi_handle);
+}
+
+/**
+ * SPI command batch
+ *
+ * pSeq 为连续的 {cmd, n, params[n]} 记录。整批在一次总线占用内以轮询事务发送：
+ * 命令字节（DC=0）与参数（DC=1）各一个事务，DC 由 pre_cb 按事务切换，
+ * CS 在整批内保持有效。窗口/光标设置（2 条命令 + 8 个参数）从 10 次阻塞的
+ * 中断事务变为一次总线占用
+**/
+void DEV_SPI_Write_Batch(const uint8_t *pSeq, uint32_t Len) {
+    if (pSeq == NULL || Len < 2 || spi_handle == NULL) {
+        return;
+    }
+
+    spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+    uint32_t i = 0;
+    while (i + 2 <= Len) {
+        const uint32_t n = pSeq[i + 1];
+        if (i + 2 + n > Len) {
+            break;
+        }
+        const bool last = i + 2 + n == Len;
+        DEV_SPI_Poll(&pSeq[i], 1, DEV_SPI_DC_CMD, !(last && n == 0));
+        if (n > 0) {
+            DEV_SPI_Poll(&pSeq[i + 2], n, DEV_SPI_DC_DATA, !last);
+        }
+        i += 2 + n;
+    }
+    spi_device_release_bus(spi_handle);
+}
+
+/**
+ * SPI burst write (queued DMA)
+ *
+ * 将 Rows 行、每行 RowLen 字节的数据作为一次连续的数据段发送：
+ * - 每个描述符不超过 DEV_SPI_MAX_TRANSFER（硬件单事务上限），最多 DEV_SPI_QUEUE_SIZE 个同时排队，
+ *   DMA 在前一个描述符完成后立即开始下一个，不再每行等待一次往返
+ * - 持有总线并对除最后一个描述符外的全部描述符设置 SPI_TRANS_CS_KEEP_ACTIVE，
+ *   CS 在整个 0x24/0x26 数据段内保持有效（多个事务首尾相接，控制器看到的是一段连续数据）
+ * - Stride == RowLen 时各行在内存中连续，按整块切分（整行脏区的窗口上传走这条路径）
+ * - Stride == 0 时重复发送同一行（用于清屏填充）
+ * - DC 由 pre_cb 置为数据（DEV_SPI_DC_DATA）
+ * - 每 SPI_ARB_BURST_BYTES 为一段：段边界上有渲染需要的 SD 读取在等待时，
+ *   结束本段（CS 释放，控制器 RAM 地址计数继续）、释放总线让 SD 读完再继续，
+ *   见 spi_arbiter.h
+ * - 排队或等待结果失败时不再排队，收回已排队的描述符后返回错误；
+ *   控制器 RAM 内容此时不确定
+ * - 等待结果超过 DEV_SPI_TRANS_TIMEOUT_MS 时不再逐个等待，未完成的描述符留给驱动，
+ *   计数保存在 s_burst_inflight；下一次调用先收回它们，收不回则不复用任何描述符，
+ *   直接返回 ESP_ERR_TIMEOUT
+ *
+ * 注意：返回 ESP_OK 时所有描述符均已完成，调用者可以立即复用/修改 pData；
+ * 返回 ESP_ERR_TIMEOUT 时 DMA 可能仍在读取 pData（帧缓冲为静态分配，只影响屏上内容）
+**/
+static spi_transaction_t s_burst_trans[DEV_SPI_QUEUE_SIZE];
+static uint32_t s_burst_inflight = 0;   // 已排队未收回的描述符数（可跨调用遗留）
+static uint32_t s_burst_slot = 0;       // 下一个排队的描述符；结果按提交顺序返回
+
+// 收回已排队的描述符，直到只剩 keep 个；返回第一个错误
+static esp_err_t DEV_SPI_Drain(uint32_t keep) {
+    while (s_burst_inflight > keep) {
+        spi_transaction_t *done;
+        const esp_err_t ret = spi_device_get_trans_result(spi_handle, &done,
+                                                          pdMS_TO_TICKS(DEV_SPI_TRANS_TIMEOUT_MS));
+        if (ret != ESP_OK) {
+            return ret;   // 超时：描述符仍归驱动所有，计数保留到下次收回
+        }
+        s_burst_inflight--;
+    }
+    return ESP_OK;
+}
+
+esp_err_t DEV_SPI_Write_Rows(const uint8_t *pData, uint32_t Stride, uint32_t RowLen, uint32_t Rows) {
+    if (pData == NULL || RowLen == 0 || Rows == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (spi_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // 连续内存：合并为一整块
+    if (Stride == RowLen) {
+        RowLen *= Rows;
+        Rows = 1;
+    }
+
+    uint32_t burst = 0;   // 当前段已排队的字节数
+
+    spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+
+    // 上次超时遗留的描述符可能仍在发送：全部收回前不能复用
+    esp_err_t err = DEV_SPI_Drain(0);
+
+    for (uint32_t r = 0; r < Rows && err == ESP_OK; r++) {
+        const uint8_t *row = pData + r * Stride;
+        uint32_t off = 0;
+        while (off < RowLen) {
+            uint32_t chunk = RowLen - off;
+            if (chunk > DEV_SPI_MAX_TRANSFER) {
+                chunk = DEV_SPI_MAX_TRANSFER;
+            }
+            if (chunk > SPI_ARB_BURST_BYTES - burst) {
+                chunk = SPI_ARB_BURST_BYTES - burst;
+            }
+
+            // 队列已满：回收最早的描述符（结果按提交顺序返回，正好是即将复用的 slot）
+            err = DEV_SPI_Drain(DEV_SPI_QUEUE_SIZE - 1);
+            if (err != ESP_OK) {
+                break;
+            }
+
+            const bool last = (r == Rows - 1) && (off + chunk >= RowLen);
+            burst += chunk;
+            const bool boundary = burst == SPI_ARB_BURST_BYTES;
+            const bool yield = !last && boundary && spi_arbiter_epd_should_yield();
+            spi_transaction_t *t = &s_burst_trans[s_burst_slot];
+            memset(t, 0, sizeof(*t));
+            t->length = chunk * 8;
+            t->tx_buffer = row + off;
+            t->user = (void *)DEV_SPI_DC_DATA;
+            t->flags = (last || yield) ? 0 : SPI_TRANS_CS_KEEP_ACTIVE;
+            err = spi_device_queue_trans(spi_handle, t, pdMS_TO_TICKS(DEV_SPI_TRANS_TIMEOUT_MS));
+            if (err != ESP_OK) {
+                break;
+            }
+
+            s_burst_inflight++;
+            s_burst_slot = (s_burst_slot + 1) % DEV_SPI_QUEUE_SIZE;
+            off += chunk;
+            if (boundary) {
+                burst = 0;
+            }
+
+            if (yield) {
+                err = DEV_SPI_Drain(0);
+                if (err != ESP_OK) {
+                    break;
+                }
+                spi_device_release_bus(spi_handle);
+                spi_arbiter_epd_yield();
+                spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+            }
+        }
+    }
+
+    // 已超时的不再逐个等待：剩余描述符计入 s_burst_inflight，由下一次调用收回
+    if (err != ESP_ERR_TIMEOUT) {
+        const esp_err_t drained = DEV_SPI_Drain(0);
+        if (err == ESP_OK) {
+            err = drained;
+        }
+    }
+
+    spi_device_release_bus(spi_handle);
+    return err;
+}
+
+/**
+ * Detach the EPD from the bus
+ * 先收回 DEV_SPI_Write_Rows 超时遗留的描述符；收不回时设备保持挂载，返回错误
+**/
+static esp_err_t DEV_SPI_Remove_EPD(void) {
+    esp_err_t ret = DEV_SPI_Drain(0);
+    if (ret == ESP_OK) {
+        ret = spi_bus_remove_device(spi_handle);
+    }
+    if (ret == ESP_OK) {
+        spi_handle = NULL;
+    }
+    return ret;
+}
+
+/**
+ * EPD register read (3-wire half duplex)
+ *
+ * 临时以读时钟、3 线半双工模式重新挂载 EPD 设备：
+ * 发送命令字节（DC=0）后保持 CS，丢弃一个 dummy 字节，再读取 Len 字节数据（DC=1）。
+ * 完成后以当前写时钟恢复写设备。
+ * 恢复失败时返回 1，spi_handle 置 NULL：后续写入直接返回，
+ * 直到 DEV_Set_Clock(DEV_CLK_EPD_WRITE, ...) 重新挂载成功（运行时路径不再 abort）
+**/
+UBYTE DEV_SPI_Read_Register(UBYTE Reg, uint8_t *pData, uint32_t Len) {
+    if (pData == NULL || Len == 0 || spi_handle == NULL) {
+        return 1;
+    }
+
+    if (DEV_SPI_Remove_EPD() != ESP_OK) {
+        return 1;
+    }
+    if (DEV_SPI_Add_EPD(s_clock_hz[DEV_CLK_EPD_READ], true) != ESP_OK) {
+        DEV_SPI_Add_EPD(s_clock_hz[DEV_CLK_EPD_WRITE], false);   // 失败时 spi_handle 为 NULL
+        return 1;
+    }
+
+    uint8_t dummy = 0;
+    esp_err_t ret;
+
+    spi_device_acquire_bus(spi_handle, portMAX_DELAY);
+
+    gpio_set_level(EPD_DC_PIN, 0);
+    spi_transaction_t cmd = {
+        .length = 8,
+        .tx_buffer = &Reg,
+        .flags = SPI_TRANS_CS_KEEP_ACTIVE,
+    };
+    ret = spi_device_polling_transmit(spi_handle, &cmd);
+
+    gpio_set_level(EPD_DC_PIN, 1);
+    if (ret == ESP_OK) {
+        spi_transaction_t skip = {
+            .rxlength = 8,
+            .rx_buffer = &dummy,
+            .flags = SPI_TRANS_CS_KEEP_ACTIVE,
+        };
+        ret = spi_device_polling_transmit(spi_handle, &skip);
+    }
+    if (ret == ESP_OK) {
+        spi_transaction_t data = {
+            .rxlength = Len * 8,
+            .rx_buffer = pData,
+        };
+        ret = spi_device_polling_transmit(spi_handle, &data);
+    }
+
+    spi_device_release_bus(spi_handle);
+
+    if (spi_bus_remove_device(spi_handle) != ESP_OK) {
+        return 1;   // 读设备仍挂载：不能再添加同一 CS 的写设备
+    }
+    spi_handle = NULL;
+    if (DEV_SPI_Add_EPD(s_clock_hz[DEV_CLK_EPD_WRITE], false) != ESP_OK) {
+        return 1;
+    }
+
+    return (ret == ESP_OK) ? 0 : 1;
+}
+
+/**
+ * Clock profiles
+**/
+UDOUBLE DEV_Get_Clock(DEV_Clock_Profile Profile) {
+    if (Profile >= DEV_CLK_COUNT) {
+        return 0;
+    }
+    return s_clock_hz[Profile];
+}
+
+UBYTE DEV_Set_Clock(DEV_Clock_Profile Profile, UDOUBLE Hz) {
+    if (Profile >= DEV_CLK_COUNT || Hz == 0) {
+        return 1;
+    }
+
+    s_clock_hz[Profile] = Hz;
+
+    // 写时钟立即生效：重新挂载 EPD 设备；读时钟在下次读取时生效；
+    // SD 时钟由 sd_card_init() 挂载后协商写入，只作记录
+    // 上次挂载失败（spi_handle 为 NULL）时直接重新挂载
+    if (Profile == DEV_CLK_EPD_WRITE && spi_bus_initialized) {
+        if (spi_handle != NULL && DEV_SPI_Remove_EPD() != ESP_OK) {
+            return 1;
+        }
+        if (DEV_SPI_Add_EPD(Hz, false) != ESP_OK) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /**
  * GPIO Mode
 **/
@@ -75,18 +420,12 @@ UBYTE DEV_Module_Init(void) {
             .sclk_io_num = EPD_SCLK_PIN,
             .quadwp_io_num = -1,
             .quadhd_io_num = -1,
-            .max_transfer_sz = 4096,
+            .max_transfer_sz = DEV_SPI_MAX_TRANSFER,
         };
         ESP_ERROR_CHECK(spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO));
 
         // Add SPI device
-        spi_device_interface_config_t devcfg = {
-            .clock_speed_hz = 10 * 1000 * 1000,  // 10MHz
-            .mode = 0,  // SPI mode 0
-            .spics_io_num = EPD_CS_PIN,
-            .queue_size = 7,
-        };
-        ESP_ERROR_CHECK(spi_bus_add_device(SPI2_HOST, &devcfg, &spi_handle));
+        ESP_ERROR_CHECK(DEV_SPI_Add_EPD(s_clock_hz[DEV_CLK_EPD_WRITE], false));
         
         spi_bus_initialized = true;
     }
@@ -103,6 +442,9 @@ UBYTE DEV_Module_Init(void) {
  * Module Exit
 **/
 void DEV_Module_Exit(void) {
-    ESP_ERROR_CHECK(spi_bus_remove_device(spi_handle));
+    if (spi_handle != NULL) {
+        ESP_ERROR_CHECK(spi_bus_remove_device(spi_handle));
+        spi_handle = NULL;
+    }
     ESP_ERROR_CHECK(spi_bus_free(SPI2_HOST));
 }
\ No newline at end of file
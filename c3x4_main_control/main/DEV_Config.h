@@ -38,12 +38,48 @@
 #define EPD_SCLK_PIN    8
 #define EPD_MISO_PIN    7   // SD card data output
 
+/**
+ * SPI transfer config
+**/
+#define DEV_SPI_MAX_TRANSFER    (32 * 1024)      // 单个事务上限：ESP32-C3 GPSPI 为 SPI_LL_DMA_MAX_BIT_LEN（2^18 位）
+#define DEV_SPI_QUEUE_SIZE      7                // 与 spi_device_interface_config_t.queue_size 保持一致
+#define DEV_SPI_TRANS_TIMEOUT_MS 500             // 排队/等待单个事务的上限（1 MHz 下 32 KB 约 262 ms）
+
+/**
+ * DC level carried in spi_transaction_t.user, applied by the pre-transfer callback
+ * DEV_SPI_DC_KEEP（NULL）不改变 DC，供仍然手动设置 DC 的调用者使用
+**/
+#define DEV_SPI_DC_KEEP   0
+#define DEV_SPI_DC_CMD    1
+#define DEV_SPI_DC_DATA   2
+
+/**
+ * SPI clock profiles (shared SPI2 bus)
+**/
+typedef enum {
+    DEV_CLK_EPD_WRITE = 0,   // EPD 命令/数据写入
+    DEV_CLK_EPD_READ,        // EPD 寄存器/RAM 读取（3 线半双工，SSD1677 读时序较慢）
+    DEV_CLK_SD,              // SD 卡（SDSPI）
+    DEV_CLK_COUNT
+} DEV_Clock_Profile;
+
+#define DEV_EPD_WRITE_HZ_DEFAULT  (10 * 1000 * 1000)
+#define DEV_EPD_READ_HZ_DEFAULT   (2 * 1000 * 1000)
+#define DEV_SD_HZ_DEFAULT         (400 * 1000)
+
 /*------------------------------------------------------------------------------------------------------*/
 void DEV_Digital_Write(UWORD Pin, UBYTE Value);
 UBYTE DEV_Digital_Read(UWORD Pin);
 
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
+esp_err_t DEV_SPI_Write_Rows(const uint8_t *pData, uint32_t Stride, uint32_t RowLen, uint32_t Rows);
+void DEV_SPI_Write_Data(const uint8_t *pData, uint32_t Len);
+void DEV_SPI_Write_Batch(const uint8_t *pSeq, uint32_t Len);
+UBYTE DEV_SPI_Read_Register(UBYTE Reg, uint8_t *pData, uint32_t Len);
+
+UDOUBLE DEV_Get_Clock(DEV_Clock_Profile Profile);
+UBYTE DEV_Set_Clock(DEV_Clock_Profile Profile, UDOUBLE Hz);
 void DEV_Delay_ms(UDOUBLE xms);
 
 UBYTE DEV_Module_Init(void);
@@ -29,31 +29,100 @@
 #
 ******************************************************************************/
 #include "EPD_4in26.h"
+#include "EPD_Panel.h"
 #include "Debug.h"
 #include <stdbool.h>
+#include <limits.h>
+#include <string.h>
 #include "esp_log.h"
-
-const unsigned char LUT_DATA_4Gray[112] =    //112bytes
-{											
-0x80,	0x48,	0x4A,	0x22,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
-0x0A,	0x48,	0x68,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
-0x88,	0x48,	0x60,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
-0xA8,	0x48,	0x45,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
-0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
-0x07,	0x1E,	0x1C,	0x02,	0x00,						
-0x05,	0x01,	0x05,	0x01,	0x02,						
-0x08,	0x01,	0x01,	0x04,	0x04,						
-0x00,	0x02,	0x00,	0x02,	0x01,						
-0x00,	0x00,	0x00,	0x00,	0x00,						
-0x00,	0x00,	0x00,	0x00,	0x00,						
-0x00,	0x00,	0x00,	0x00,	0x00,						
-0x00,	0x00,	0x00,	0x00,	0x00,						
-0x00,	0x00,	0x00,	0x00,	0x00,						
-0x00,	0x00,	0x00,	0x00,	0x01,						
-0x22,	0x22,	0x22,	0x22,	0x22,						
-0x17,	0x41,	0xA8,	0x32,	0x30,						
-0x00,	0x00,	
-};	
+#include "esp_attr.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "trace.h"
+
+// BUSY 等待超时（看门狗）
+#define EPD_BUSY_TIMEOUT_MS      5000
+// BUSY 等待日志间隔
+#define EPD_BUSY_LOG_INTERVAL_MS 500
+// 发出 0x20 后等待 BUSY 拉高的最长时间（us），避免异步模式下误判完成
+#define EPD_BUSY_RISE_TIMEOUT_US 1000
+
+// BUSY 中断状态：等待中的任务、异步刷新标记和完成回调
+static TaskHandle_t s_busy_waiter = NULL;
+static volatile bool s_update_pending = false;
+static bool s_async_update = false;
+static bool s_busy_irq_ready = false;
+static EPD_4in26_UpdateDoneCb s_update_done_cb = NULL;
+static void *s_update_done_arg = NULL;
+// 最近一次 0x20 发出的时间（trace 统计 BUSY 耗时）
+static volatile int64_t s_update_start_us = 0;
+// 同上，但不在波形结束时清零（按键延时统计）
+static volatile int64_t s_last_update_us = 0;
+
+// 各波形的平均 BUSY 时长（us）：初值为室温下的典型值，每次测得后按 1/4 权重平滑。
+// 4 灰局刷没有自己的波形表项，单独记一格
+#define EPD_WAVE_4GRAY_PART   EPD_4in26_WAVE_COUNT
+#define EPD_WAVE_NONE         0xFF
+static UDOUBLE s_wave_busy_us[EPD_4in26_WAVE_COUNT + 1] = {
+	[EPD_4in26_WAVE_FULL] = 2000000,
+	[EPD_4in26_WAVE_FAST] = 1500000,
+	[EPD_4in26_WAVE_PARTIAL] = 400000,
+	[EPD_4in26_WAVE_4GRAY] = 3000000,
+	[EPD_WAVE_4GRAY_PART] = 1200000,
+};
+// 正在进行的波形（s_wave_busy_us 的下标），没有时为 EPD_WAVE_NONE
+static volatile UBYTE s_busy_wave = EPD_WAVE_NONE;
+static EPD_4in26_BusyWindowCb s_busy_window_cb = NULL;
+static void *s_busy_window_arg = NULL;
+
+// 分阶段累计计时（EPD_4in26_GetStats，基准测试用）
+static EPD_4in26_Stats s_stats;
+
+// 上传取代检查（EPD_4in26_SetSupersedeCheck）：行突发之间询问是否已有更新的一帧
+static EPD_4in26_SupersededCb s_superseded_cb = NULL;
+static void *s_superseded_arg = NULL;
+
+// 波形选择状态：最近一次读到的面板温度，以及当前写入寄存器 0x32 的 RAM LUT
+// （复位后 RAM LUT 失效，置 NULL）
+static int s_wave_temp_c = 25;
+static const unsigned char *s_wave_ram_lut = NULL;
+
+// 当前面板描述符（初始化序列、地址格式、波形表、能力）
+static const EPD_Panel *s_panel = &EPD_Panel_GDEQ0426T82;
+
+// 驱动状态机：记录控制器是否已初始化、处于深度睡眠，以及当前加载的波形模式；
+// 常用配置寄存器（0x18 温度源、0x3C 边框、0x1A 温度）保存写入值，
+// 值未变化时不再重复发送。硬件复位后全部失效
+static EPD_4in26_State s_epd_state = EPD_4in26_STATE_COLD;
+static EPD_4in26_Mode s_epd_mode = EPD_4in26_MODE_NONE;
+#define EPD_REG_UNKNOWN 0xFFFF
+static UWORD s_reg_temp_src = EPD_REG_UNKNOWN;   // 0x18
+// 命令批：EPD_4in26_BatchBegin/End 之间的 SendCommand/SendData 只追加到缓冲，
+// 按 {cmd, n, params[n]} 编码，结束或遇到同步点（BUSY 等待、RAM 数据上传、复位）时
+// 经 DEV_SPI_Write_Batch 一次发出。寄存器影子与哈希影子在追加时照常更新
+#define EPD_BATCH_MAX  96
+static UBYTE s_batch[EPD_BATCH_MAX];
+static UWORD s_batch_len = 0;
+static int s_batch_cmd = -1;        // 当前命令记录的位置，-1 表示后续数据直接发送
+static UBYTE s_batch_depth = 0;
+static void EPD_4in26_BatchFlush(void);
+
+static UWORD s_reg_border = EPD_REG_UNKNOWN;     // 0x3C
+// 夜间模式：0x21 让控制器输出时反相读取 RAM，RAM 与 framebuffer 保持正常极性
+static bool s_invert = false;
+static UWORD s_reg_temp = EPD_REG_UNKNOWN;       // 0x1A
+static UBYTE s_last_cmd = 0;
+
+// RAM 0x26（上一帧）行哈希影子：单色整帧上传后建立，按帧缓冲行索引。
+// 单色局刷时 0x24 照常写入整个窗口，0x26 只重写内容与影子不同的行。
+// 任何未跟踪的 RAM 写入（0x24/0x26/0x46/0x47）都会使影子失效
+static UDOUBLE s_prev_row_hash[EPD_4in26_HEIGHT];
+static bool s_prev_hash_valid = false;
+static bool s_prev_hash_hold = false;                    // 局刷上传期间不使影子失效
+static UBYTE s_prev_row_seen[EPD_4in26_HEIGHT / 8];      // 本次局刷已比较过的行
+static UBYTE s_prev_row_dirty[EPD_4in26_HEIGHT / 8];     // 其中内容有变化的行
+static UBYTE s_prev_row_stale[EPD_4in26_HEIGHT / 8];     // 只重写过部分宽度、哈希不代表 RAM 的行
+static bool s_upload_failed = false;                     // 上次提交影子之后有数据上传失败
 
 /******************************************************************************
 function :	Software reset
@@ -61,36 +130,90 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_Reset(void)
 {
+    EPD_4in26_BatchFlush();
+    // 复位会中断正在运行的波形，先等待上一次异步刷新结束
+    if (s_update_pending) {
+        EPD_4in26_ReadBusy();
+    }
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(100);
     DEV_Digital_Write(EPD_RST_PIN, 0);
     DEV_Delay_ms(2);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(100);
+    s_wave_ram_lut = NULL;
+    s_reg_temp_src = EPD_REG_UNKNOWN;
+    s_reg_border = EPD_REG_UNKNOWN;
+    s_reg_temp = EPD_REG_UNKNOWN;
+    s_epd_state = EPD_4in26_STATE_COLD;
+    s_epd_mode = EPD_4in26_MODE_NONE;
 }
 
 /* Forward declarations for functions used before their definition */
 static void EPD_4in26_SendCommand(UBYTE Reg);
 static void EPD_4in26_SendData(UBYTE Data);
-void EPD_4in26_ReadBusy(void);
+static UBYTE EPD_4in26_ApplyWave(EPD_4in26_Wave wave);
+static void EPD_4in26_SetReg(UBYTE Reg, UBYTE Value);
+static bool EPD_4in26_LoadPartialWindow(const UBYTE *Image24, const UBYTE *Image26,
+										UWORD x, UWORD y, UWORD w, UWORD h, bool lazy26);
 
 /******************************************************************************
-function :	Clear RAM using command 0x46 and 0x47 (as per initialization flowchart)
+function :	Fill both RAM planes inside the current window (0x46 / 0x47)
 parameter:
+    value : 0xFF 白，0x00 黑
+info     :  控制器内部填充，SPI 上只有几个命令字节，代替逐字节上传整块纯色
 ******************************************************************************/
-static void EPD_4in26_ClearRAM(void)
+static void EPD_4in26_FillRAM(UBYTE value)
 {
-	// Step 3 in flowchart: Clear and fill two RAM by Command 0x46, Data 0xF7
+	// 0x46/0x47 按规则图形自动填充当前窗口；A[7] 为第一步的值，
+	// 高度/宽度步长取最大（A[6:4]、A[2:0] = 111），整个窗口只有一种值
+	const UBYTE pattern = value ? 0xF7 : 0x77;
 	EPD_4in26_SendCommand(0x46);
-	EPD_4in26_SendData(0xF7);
+	EPD_4in26_SendData(pattern);
 	EPD_4in26_ReadBusy();
-	
-	// Fill RAM 0x26 by Command 0x47, Data 0xF7
+
 	EPD_4in26_SendCommand(0x47);
-	EPD_4in26_SendData(0xF7);
+	EPD_4in26_SendData(pattern);
 	EPD_4in26_ReadBusy();
 }
 
+/******************************************************************************
+function :	Clear RAM using command 0x46 and 0x47 (as per initialization flowchart)
+parameter:
+******************************************************************************/
+static void EPD_4in26_ClearRAM(void)
+{
+	// Step 3 in flowchart: Clear and fill two RAM by Command 0x46/0x47, Data 0xF7
+	EPD_4in26_FillRAM(0xFF);
+}
+
+/******************************************************************************
+function :	Send the queued command batch
+******************************************************************************/
+static void EPD_4in26_BatchFlush(void)
+{
+    if (s_batch_len > 0) {
+        DEV_SPI_Write_Batch(s_batch, s_batch_len);
+        s_batch_len = 0;
+    }
+    s_batch_cmd = -1;
+}
+
+/******************************************************************************
+function :	Start / end a command batch (nestable)
+******************************************************************************/
+static void EPD_4in26_BatchBegin(void)
+{
+    s_batch_depth++;
+}
+
+static void EPD_4in26_BatchEnd(void)
+{
+    if (s_batch_depth > 0 && --s_batch_depth == 0) {
+        EPD_4in26_BatchFlush();
+    }
+}
+
 /******************************************************************************
 function :	send command
 parameter:
@@ -98,10 +221,26 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_SendCommand(UBYTE Reg)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 0);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    // 异步刷新进行中时控制器不接受命令，先等待 BUSY 释放
+    if (s_update_pending) {
+        EPD_4in26_ReadBusy();
+    }
+    // CS 由 SPI 外设驱动（spics_io_num），DC 由传输前回调按事务设置
+    if (s_batch_depth > 0) {
+        if (s_batch_len + 2 > EPD_BATCH_MAX) {
+            EPD_4in26_BatchFlush();
+        }
+        s_batch_cmd = s_batch_len;
+        s_batch[s_batch_len++] = Reg;
+        s_batch[s_batch_len++] = 0;
+    } else {
+        const UBYTE rec[2] = {Reg, 0};
+        DEV_SPI_Write_Batch(rec, sizeof(rec));
+    }
+    s_last_cmd = Reg;
+    if (!s_prev_hash_hold && (Reg == 0x24 || Reg == 0x26 || Reg == 0x46 || Reg == 0x47)) {
+        s_prev_hash_valid = false;
+    }
 }
 
 /******************************************************************************
@@ -111,49 +250,401 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_SendData(UBYTE Data)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    if (s_batch_depth > 0 && s_batch_cmd >= 0 && s_batch_len < EPD_BATCH_MAX) {
+        s_batch[s_batch_len++] = Data;
+        s_batch[s_batch_cmd + 1]++;
+    } else {
+        // 参数放不下时先发出已排队的部分（含本条命令），这条命令余下的参数直接发送
+        EPD_4in26_BatchFlush();
+        DEV_SPI_Write_Data(&Data, 1);
+    }
+    // 0x22 控制字带 0x20（载入温度）时，温度寄存器会被传感器读数覆盖
+    if (s_last_cmd == 0x22 && (Data & 0x20)) {
+        s_reg_temp = EPD_REG_UNKNOWN;
+    }
+}
+
+/******************************************************************************
+function :	Write a single-byte configuration register, skipping unchanged values
+parameter:
+    Reg   : 0x18 / 0x3C / 0x1A（其他寄存器直接发送）
+******************************************************************************/
+static void EPD_4in26_SetReg(UBYTE Reg, UBYTE Value)
+{
+    UWORD *shadow = NULL;
+    switch (Reg) {
+    case 0x18: shadow = &s_reg_temp_src; break;
+    case 0x3C: shadow = &s_reg_border; break;
+    case 0x1A: shadow = &s_reg_temp; break;
+    default: break;
+    }
+    if (shadow != NULL && *shadow == Value) {
+        return;
+    }
+    EPD_4in26_SendCommand(Reg);
+    EPD_4in26_SendData(Value);
+    if (shadow != NULL) {
+        *shadow = Value;
+    }
 }
 
-static void EPD_4in26_SendData2(UBYTE *pData, UDOUBLE len)
+/******************************************************************************
+function :	Hash one framebuffer row (FNV-1a over 32-bit words)
+******************************************************************************/
+static UDOUBLE EPD_4in26_RowHash(const UBYTE *row)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_Write_nByte(pData, len);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    const uint32_t *w = (const uint32_t *)row;
+    uint32_t h = 2166136261u;
+    for (UWORD i = 0; i < EPD_4in26_WIDTH / 32; i++) {
+        h = (h ^ w[i]) * 16777619u;
+    }
+    return h;
+}
+
+/******************************************************************************
+function :	Consume an upload failure: the RAM planes cannot be trusted as a base
+******************************************************************************/
+static bool EPD_4in26_PrevHashFailed(void)
+{
+    if (!s_upload_failed) {
+        return false;
+    }
+    s_upload_failed = false;
+    s_prev_hash_valid = false;
+    return true;
+}
+
+/******************************************************************************
+function :	Record that both RAM planes now hold Image (full-frame mono upload)
+******************************************************************************/
+static void EPD_4in26_PrevHashCommit(const UBYTE *Image)
+{
+    if (EPD_4in26_PrevHashFailed()) {
+        return;
+    }
+    const UWORD stride = EPD_4in26_WIDTH / 8;
+    for (UWORD y = 0; y < EPD_4in26_HEIGHT; y++) {
+        s_prev_row_hash[y] = EPD_4in26_RowHash(Image + (UDOUBLE)y * stride);
+    }
+    memset(s_prev_row_stale, 0, sizeof(s_prev_row_stale));
+    s_prev_hash_valid = true;
+}
+
+/******************************************************************************
+function :	Record that both RAM planes are all white (auto-filled clear)
+******************************************************************************/
+static void EPD_4in26_PrevHashCommitWhite(void)
+{
+    if (EPD_4in26_PrevHashFailed()) {
+        return;
+    }
+    uint32_t row[EPD_4in26_WIDTH / 32];
+    memset(row, 0xFF, sizeof(row));
+    const UDOUBLE hash = EPD_4in26_RowHash((const UBYTE *)row);
+    for (UWORD y = 0; y < EPD_4in26_HEIGHT; y++) {
+        s_prev_row_hash[y] = hash;
+    }
+    memset(s_prev_row_stale, 0, sizeof(s_prev_row_stale));
+    s_prev_hash_valid = true;
+}
+
+/******************************************************************************
+function :	send a block of rows as one queued DMA burst
+parameter:
+    pData  : first byte of the first row
+    stride : distance between rows in bytes (0 = repeat the same row)
+    len    : bytes per row
+    rows   : number of rows
+******************************************************************************/
+static void EPD_4in26_SendDataRows(const UBYTE *pData, UDOUBLE stride, UDOUBLE len, UDOUBLE rows)
+{
+    EPD_4in26_BatchFlush();
+    const int64_t start_us = esp_timer_get_time();
+    const esp_err_t err = DEV_SPI_Write_Rows(pData, stride, len, rows);
+    if (err != ESP_OK) {
+        // 控制器 RAM 内容不确定：影子作废，之后的提交也不再建立影子，下一帧 0x26 整窗口重写
+        ESP_LOGE("EPD", "Data upload failed: %s", esp_err_to_name(err));
+        s_prev_hash_valid = false;
+        s_upload_failed = true;
+    }
+    s_stats.upload_us += (UDOUBLE)(esp_timer_get_time() - start_us);
+    s_stats.upload_bytes += len * rows;
+}
+
+/******************************************************************************
+function :	Ask whether the upload in progress has been superseded
+info     :  未设置检查函数时总是 false；返回 true 时调用方停止上传、不发出 0x20
+******************************************************************************/
+static bool EPD_4in26_Superseded(void)
+{
+	if (s_superseded_cb == NULL || !s_superseded_cb(s_superseded_arg)) {
+		return false;
+	}
+	s_stats.superseded++;
+	TRACE_LOGI(EPD, "EPD", "upload superseded by a newer frame");
+	return true;
+}
+
+void EPD_4in26_SetSupersedeCheck(EPD_4in26_SupersededCb cb, void *arg)
+{
+	s_superseded_cb = cb;
+	s_superseded_arg = arg;
+}
+
+/******************************************************************************
+function :	Waveform ended
+parameter:	busy_us  - 0x20 发出到 BUSY 变低的时间
+	        measured - 是否计入平均时长（超时或事后才发现已结束时不计）
+info     :  BUSY 中断与等待 BUSY 的任务共用
+******************************************************************************/
+static void IRAM_ATTR EPD_4in26_BusyWindowEnd(UDOUBLE busy_us, bool measured)
+{
+	const UBYTE wave = s_busy_wave;
+	if (wave == EPD_WAVE_NONE) {
+		return;
+	}
+	s_busy_wave = EPD_WAVE_NONE;
+	if (measured) {
+		s_wave_busy_us[wave] = s_wave_busy_us[wave] - (s_wave_busy_us[wave] >> 2) + (busy_us >> 2);
+	}
+	if (s_busy_window_cb != NULL) {
+		s_busy_window_cb(false, busy_us, s_busy_window_arg);
+	}
+}
+
+/******************************************************************************
+function :	BUSY interrupt handler
+parameter:
+info     :  低电平触发，进入后立即关闭中断（BUSY 保持低电平期间不会重复进入）。
+            使用电平而不是下降沿触发：如果使能中断时 BUSY 已经变低，
+            中断会立刻进入，不会丢失完成事件。
+******************************************************************************/
+static void IRAM_ATTR EPD_4in26_BusyIsr(void *arg)
+{
+	(void)arg;
+	BaseType_t woken = pdFALSE;
+
+	gpio_intr_disable(EPD_BUSY_PIN);
+
+	if (s_update_pending) {
+		s_update_pending = false;
+		const uint32_t busy_us = (uint32_t)(esp_timer_get_time() - s_update_start_us);
+		TRACE_EVENT(TRACE_EV_EPD_BUSY_DONE, busy_us, 1);
+		s_stats.busy_us += busy_us;
+		s_update_start_us = 0;
+		EPD_4in26_BusyWindowEnd(busy_us, true);
+		if (s_update_done_cb != NULL) {
+			s_update_done_cb(s_update_done_arg);
+		}
+	}
+
+	if (s_busy_waiter != NULL) {
+		xTaskNotifyFromISR(s_busy_waiter, 1, eSetBits, &woken);
+	}
+
+	if (woken == pdTRUE) {
+		portYIELD_FROM_ISR();
+	}
+}
+
+static void EPD_4in26_BusyIrqInit(void)
+{
+	if (s_busy_irq_ready) {
+		return;
+	}
+
+	gpio_set_intr_type(EPD_BUSY_PIN, GPIO_INTR_LOW_LEVEL);
+	gpio_intr_disable(EPD_BUSY_PIN);
+
+	// ISR 服务可能已由其他模块安装
+	esp_err_t err = gpio_install_isr_service(0);
+	if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+		ESP_LOGE("EPD", "gpio_install_isr_service failed: %s", esp_err_to_name(err));
+		return;
+	}
+	if (gpio_isr_handler_add(EPD_BUSY_PIN, EPD_4in26_BusyIsr, NULL) != ESP_OK) {
+		ESP_LOGE("EPD", "Failed to attach BUSY ISR");
+		return;
+	}
+	s_busy_irq_ready = true;
 }
 
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
+info     :  阻塞当前任务直到 BUSY 中断通知（xTaskNotifyWait），不再 20ms 轮询；
+            EPD_BUSY_TIMEOUT_MS 后超时返回
 ******************************************************************************/
 void EPD_4in26_ReadBusy(void)
 {
-	int timeout_ms = 5000;  // 5秒超时
-	int elapsed = 0;
+	// 等待之前先把排队的命令（如 0x20）发出去
+	EPD_4in26_BatchFlush();
+	EPD_4in26_BusyIrqInit();
+
+	//=1 BUSY
+	if (DEV_Digital_Read(EPD_BUSY_PIN) == 0) {
+		s_update_pending = false;
+		EPD_4in26_BusyWindowEnd(0, false);
+		return;
+	}
+
+	if (!s_busy_irq_ready) {
+		// 中断不可用时退回轮询
+		int elapsed = 0;
+		while (DEV_Digital_Read(EPD_BUSY_PIN) != 0 && elapsed < EPD_BUSY_TIMEOUT_MS) {
+			DEV_Delay_ms(10);
+			elapsed += 10;
+		}
+		if (elapsed >= EPD_BUSY_TIMEOUT_MS) {
+			ESP_LOGW("EPD", "BUSY timeout after %d ms, BUSY pin still high!", EPD_BUSY_TIMEOUT_MS);
+		}
+		s_update_pending = false;
+		EPD_4in26_BusyWindowEnd((UDOUBLE)elapsed * 1000, elapsed < EPD_BUSY_TIMEOUT_MS);
+		return;
+	}
 
-	while(1)
-	{	 //=1 BUSY
-		if(DEV_Digital_Read(EPD_BUSY_PIN)==0) {
+	uint32_t bits = 0;
+	xTaskNotifyWait(0, ULONG_MAX, &bits, 0);  // 清除残留通知
+	s_busy_waiter = xTaskGetCurrentTaskHandle();
+	gpio_intr_enable(EPD_BUSY_PIN);
+
+	int elapsed = 0;
+	while (1) {
+		if (xTaskNotifyWait(0, ULONG_MAX, &bits, pdMS_TO_TICKS(EPD_BUSY_LOG_INTERVAL_MS)) == pdTRUE) {
 			// BUSY 变低，刷新完成
 			break;
 		}
-		DEV_Delay_ms(20);
-		elapsed += 20;
+		elapsed += EPD_BUSY_LOG_INTERVAL_MS;
 
-		if (elapsed >= timeout_ms) {
-			ESP_LOGW("EPD", "BUSY timeout after %d ms, BUSY pin still high!", timeout_ms);
+		if (elapsed >= EPD_BUSY_TIMEOUT_MS) {
+			ESP_LOGW("EPD", "BUSY timeout after %d ms, BUSY pin still high!", EPD_BUSY_TIMEOUT_MS);
 			break;
 		}
 
 		// 每 500ms 输出一次日志（避免刷屏）
-		if (elapsed % 500 == 0 && elapsed < timeout_ms) {
-			ESP_LOGW("EPD", "Waiting for BUSY... elapsed=%d ms", elapsed);
-		}
+		ESP_LOGW("EPD", "Waiting for BUSY... elapsed=%d ms", elapsed);
+	}
+
+	gpio_intr_disable(EPD_BUSY_PIN);
+	s_busy_waiter = NULL;
+	if (s_update_start_us != 0) {
+		const uint32_t busy_us = (uint32_t)(esp_timer_get_time() - s_update_start_us);
+		TRACE_EVENT(TRACE_EV_EPD_BUSY_DONE, busy_us, 0);
+		s_stats.busy_us += busy_us;
+		s_update_start_us = 0;
+		EPD_4in26_BusyWindowEnd(busy_us, elapsed < EPD_BUSY_TIMEOUT_MS);
 	}
-	DEV_Delay_ms(20);
+	s_update_pending = false;
+}
+
+/******************************************************************************
+function :	Wait for the update sequence started by 0x20
+parameter:	wave - 波形（s_wave_busy_us 的下标），用于预计时长
+info     :  同步模式下等待 BUSY；异步模式下只挂起中断立即返回，
+            波形结束时在 ISR 中调用完成回调，下一条命令发送前自动等待
+******************************************************************************/
+static void EPD_4in26_WaitUpdate(UBYTE wave)
+{
+	EPD_4in26_BatchFlush();
+	s_update_start_us = esp_timer_get_time();
+	s_last_update_us = s_update_start_us;
+	s_stats.updates++;
+	s_busy_wave = wave;
+	if (s_busy_window_cb != NULL) {
+		s_busy_window_cb(true, s_wave_busy_us[wave], s_busy_window_arg);
+	}
+	if (!s_async_update || !s_busy_irq_ready) {
+		EPD_4in26_ReadBusy();
+		return;
+	}
+
+	// 等待 BUSY 拉高，否则低电平中断会立即误报完成
+	for (int us = 0; us < EPD_BUSY_RISE_TIMEOUT_US && DEV_Digital_Read(EPD_BUSY_PIN) == 0; us += 10) {
+		esp_rom_delay_us(10);
+	}
+
+	s_update_pending = true;
+	gpio_intr_enable(EPD_BUSY_PIN);
+}
+
+void EPD_4in26_SetAsyncUpdate(bool enable, EPD_4in26_UpdateDoneCb cb, void *arg)
+{
+	// 切换前确保没有未完成的刷新
+	if (s_update_pending) {
+		EPD_4in26_ReadBusy();
+	}
+
+	EPD_4in26_BusyIrqInit();
+	s_update_done_cb = cb;
+	s_update_done_arg = arg;
+	s_async_update = enable;
+}
+
+void EPD_4in26_GetStats(EPD_4in26_Stats *out)
+{
+	if (out != NULL) {
+		*out = s_stats;
+	}
+}
+
+int64_t EPD_4in26_GetLastUpdateUs(void)
+{
+	return s_last_update_us;
+}
+
+void EPD_4in26_ResetStats(void)
+{
+	memset(&s_stats, 0, sizeof(s_stats));
+}
+
+void EPD_4in26_SetBusyWindowHook(EPD_4in26_BusyWindowCb cb, void *arg)
+{
+	s_busy_window_cb = cb;
+	s_busy_window_arg = arg;
+}
+
+UDOUBLE EPD_4in26_GetWaveBusyUs(EPD_4in26_Wave wave)
+{
+	return wave < EPD_4in26_WAVE_COUNT ? s_wave_busy_us[wave] : 0;
+}
+
+bool EPD_4in26_IsBusy(void)
+{
+	return s_update_pending;
+}
+
+void EPD_4in26_WaitIdle(void)
+{
+	if (s_update_pending) {
+		EPD_4in26_ReadBusy();
+	}
+}
+
+/******************************************************************************
+function :	Display Update Control 1 (0x21)
+parameter:	use_red - 波形读取 RED RAM（局刷对比上一帧 / 4 灰第二位平面）；
+	          否则 RED 按 0 旁路（全刷、快刷）
+info     :  反相时 BW 与 RED 一起反相：局刷两帧对比关系不变，4 灰灰度按 3-x 映射
+******************************************************************************/
+static void EPD_4in26_SetUpdateCtrl1(bool use_red)
+{
+	UBYTE ram = use_red ? 0x00 : 0x40; // RED normal / bypass RED as 0
+	if (s_invert) {
+		ram |= use_red ? 0x88 : 0x08;  // Inverse RAM content
+	}
+	EPD_4in26_SendCommand(0x21); // Display Update Control
+	EPD_4in26_SendData(ram);
+	EPD_4in26_SendData(0x00);    // single chip application
+}
+
+void EPD_4in26_SetInvert(bool invert)
+{
+	s_invert = invert;
+}
+
+bool EPD_4in26_GetInvert(void)
+{
+	return s_invert;
 }
 
 /******************************************************************************
@@ -162,104 +653,242 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_TurnOnDisplay(void)
 {
-	EPD_4in26_SendCommand(0x22); //Display Update Control
-	EPD_4in26_SendData(0xF7);
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(false);
+	const UBYTE ctrl = EPD_4in26_ApplyWave(EPD_4in26_WAVE_FULL);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, ctrl, 1);
 	EPD_4in26_SendCommand(0x20); //Activate Display Update Sequence
-	EPD_4in26_ReadBusy();
+	EPD_4in26_BatchEnd();
+	EPD_4in26_WaitUpdate(EPD_4in26_WAVE_FULL);
 }
 
 static void EPD_4in26_TurnOnDisplay_Fast(void)
 {
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(false);
 	EPD_4in26_SendCommand(0x22); //Display Update Control
 	EPD_4in26_SendData(0xC7);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, 0xC7, 1);
 	EPD_4in26_SendCommand(0x20); //Activate Display Update Sequence
-	EPD_4in26_ReadBusy();
+	EPD_4in26_BatchEnd();
+	EPD_4in26_WaitUpdate(EPD_4in26_WAVE_FAST);
 }
 
 static void EPD_4in26_TurnOnDisplay_Part(void)
 {
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(true);
 	EPD_4in26_SendCommand(0x22); //Display Update Control
 	EPD_4in26_SendData(0xFF);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, 0xFF, 1);
 	EPD_4in26_SendCommand(0x20); //Activate Display Update Sequence
-	EPD_4in26_ReadBusy();
+	EPD_4in26_BatchEnd();
+	EPD_4in26_WaitUpdate(EPD_4in26_WAVE_PARTIAL);
 }
 
 static void EPD_4in26_TurnOnDisplay_4GRAY(void)
 {
-    EPD_4in26_SendCommand(0x22);
-    EPD_4in26_SendData(0xC7);
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(true);
+	const UBYTE ctrl = EPD_4in26_ApplyWave(EPD_4in26_WAVE_4GRAY);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, ctrl, 1);
 	EPD_4in26_SendCommand(0x20);
-    EPD_4in26_ReadBusy();
+	EPD_4in26_BatchEnd();
+    EPD_4in26_WaitUpdate(EPD_4in26_WAVE_4GRAY);
 }
 
 static void EPD_4in26_TurnOnDisplay_4GRAY_Part(void)
 {
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(true);
 	// Reuse the partial update sequence to avoid full-screen flashing.
 	// Note: 4-gray partial update behavior can vary across panels/waveforms.
 	EPD_4in26_SendCommand(0x22);
 	EPD_4in26_SendData(0xFF);
 	EPD_4in26_SendCommand(0x20);
-	EPD_4in26_ReadBusy();
+	EPD_4in26_BatchEnd();
+	EPD_4in26_WaitUpdate(EPD_WAVE_4GRAY_PART);
 }
 
-static inline UBYTE EPD_4in26_4gray_pixel_to_plane24(const UBYTE p2)
-{
-	// Mapping copied from EPD_4in26_4GrayDisplay()'s 0x24 pass
-	// p2 is in {0x00,0x40,0x80,0xC0}
-	if (p2 == 0xC0) return 0;
-	if (p2 == 0x00) return 1;
-	if (p2 == 0x80) return 1;
-	return 0; // 0x40
-}
+/******************************************************************************
+function :	4-gray 2bpp -> 1bpp plane packing
+info     :  输入每字节 4 个像素（2bpp，MSB 在前），取值 0=黑 1=灰2 2=灰1 3=白
+            0x24 平面位 = !(p & 1)，0x26 平面位 = !(p & 2)
+            查找表一次给出两个平面的 4 位结果：低半字节 0x24，高半字节 0x26，
+            两个输入字节合成一个输出字节，替代逐像素分支与函数调用
+******************************************************************************/
+// 上传暂存缓冲区（DMA 可访问的内部 RAM），按整行分块，不再逐字节发送
+#define EPD_4GRAY_STAGE_BYTES 2000
 
-static inline UBYTE EPD_4in26_4gray_pixel_to_plane26(const UBYTE p2)
+static UBYTE s_4gray_lut[256];
+static bool s_4gray_lut_ready = false;
+static WORD_ALIGNED_ATTR UBYTE s_4gray_stage[EPD_4GRAY_STAGE_BYTES];
+
+static void EPD_4in26_4GrayLutInit(void)
 {
-	// Mapping copied from EPD_4in26_4GrayDisplay()'s 0x26 pass
-	if (p2 == 0xC0) return 0; // white
-	if (p2 == 0x00) return 1; // black
-	if (p2 == 0x80) return 0; // gray1
-	return 1;                 // gray2 (0x40)
+	if (s_4gray_lut_ready) {
+		return;
+	}
+	for (UWORD b = 0; b < 256; b++) {
+		UBYTE lo = 0, hi = 0;
+		for (int i = 0; i < 4; i++) {
+			const UBYTE p = (UBYTE)((b >> (6 - 2 * i)) & 0x03);
+			lo = (UBYTE)((lo << 1) | ((p & 0x01) ? 0 : 1));
+			hi = (UBYTE)((hi << 1) | ((p & 0x02) ? 0 : 1));
+		}
+		s_4gray_lut[b] = (UBYTE)((hi << 4) | lo);
+	}
+	s_4gray_lut_ready = true;
 }
 
-static inline UBYTE EPD_4in26_pack8_2bpp_to_1bpp_plane(UBYTE in0, UBYTE in1, bool plane26)
+/******************************************************************************
+function :	Stream one 4-gray plane from a 2bpp image
+parameter:
+    Image     : 2bpp 图像，每行 in_stride 字节
+    in_x_byte : 窗口左边界在输入行中的字节偏移（8 像素对齐，即 2 字节的倍数）
+    y, rows   : 起始行与行数
+    out_bytes : 每行输出字节数
+    plane26   : false = 0x24 平面，true = 0x26 平面
+info     :  调用前需已发送 0x24/0x26 命令；按整行填满暂存区后一次性 DMA 发送
+******************************************************************************/
+static void EPD_4in26_4GrayStreamPlane(const UBYTE *Image, UDOUBLE in_stride, UDOUBLE in_x_byte,
+									   UWORD y, UWORD rows, UWORD out_bytes, bool plane26)
 {
-	// Each input byte encodes 4 pixels (2bpp). Two input bytes => 8 pixels.
-	// Produce one 1bpp output byte (MSB first), matching the original algorithm.
-	UBYTE out = 0;
-	for (int i = 0; i < 8; i++) {
-		const UBYTE src = (i < 4) ? in0 : in1;
-		const int shift = 6 - 2 * (i & 3);
-		const UBYTE p = (UBYTE)((src >> shift) & 0x03);
-		const UBYTE p2_norm = (UBYTE)(p << 6); // 0x00/0x40/0x80/0xC0
-		const UBYTE bit = plane26 ? EPD_4in26_4gray_pixel_to_plane26(p2_norm)
-								  : EPD_4in26_4gray_pixel_to_plane24(p2_norm);
-		out = (UBYTE)((out << 1) | (bit & 0x01));
+	const UBYTE shift = plane26 ? 4 : 0;
+	UWORD rows_per_chunk = (UWORD)(EPD_4GRAY_STAGE_BYTES / out_bytes);
+	if (rows_per_chunk == 0) {
+		rows_per_chunk = 1;  // out_bytes 最大 100，不会发生
+	}
+
+	for (UWORD row = 0; row < rows; ) {
+		UWORD n = (UWORD)(rows - row);
+		if (n > rows_per_chunk) {
+			n = rows_per_chunk;
+		}
+
+		UBYTE *dst = s_4gray_stage;
+		for (UWORD r = 0; r < n; r++) {
+			const UBYTE *src = Image + (UDOUBLE)(y + row + r) * in_stride + in_x_byte;
+			for (UWORD col = 0; col < out_bytes; col++) {
+				const UBYTE a = (UBYTE)(s_4gray_lut[src[0]] >> shift);
+				const UBYTE b = (UBYTE)(s_4gray_lut[src[1]] >> shift);
+				*dst++ = (UBYTE)(((a & 0x0F) << 4) | (b & 0x0F));
+				src += 2;
+			}
+		}
+		EPD_4in26_SendDataRows(s_4gray_stage, (UDOUBLE)n * out_bytes, (UDOUBLE)n * out_bytes, 1);
+		row = (UWORD)(row + n);
 	}
-	return out;
 }
 
 /******************************************************************************
 function :	set the look-up tables
 parameter:
+    lut : 112 字节波形表（0x32 VCOM/LUT 105 字节 + VGH/VSH1/VSH2/VSL/VCOM）
 ******************************************************************************/
-static void EPD_4in26_Lut(void)
+static void EPD_4in26_LoadLut(const unsigned char *lut)
 {
     unsigned int count;
     EPD_4in26_SendCommand(0x32); //vcom
     for(count = 0; count < 105 ; count++) {
-        EPD_4in26_SendData(LUT_DATA_4Gray[count]);
+        EPD_4in26_SendData(lut[count]);
     }
 
     EPD_4in26_SendCommand(0x03); //VGH      
-	EPD_4in26_SendData(LUT_DATA_4Gray[105]);
+	EPD_4in26_SendData(lut[105]);
 
 	EPD_4in26_SendCommand(0x04); //      
-	EPD_4in26_SendData(LUT_DATA_4Gray[106]); //VSH1   
-	EPD_4in26_SendData(LUT_DATA_4Gray[107]); //VSH2   
-	EPD_4in26_SendData(LUT_DATA_4Gray[108]); //VSL   
+	EPD_4in26_SendData(lut[106]); //VSH1   
+	EPD_4in26_SendData(lut[107]); //VSH2   
+	EPD_4in26_SendData(lut[108]); //VSL   
 
 	EPD_4in26_SendCommand(0x2C);     //VCOM Voltage
-	EPD_4in26_SendData(LUT_DATA_4Gray[109]);    //0x1C
+	EPD_4in26_SendData(lut[109]);    //0x1C
+
+	s_wave_ram_lut = lut;
+}
+
+/******************************************************************************
+function :	Temperature-indexed waveform selection
+info     :  每种刷新对应描述符中一组按温度上限升序排列的条目，刷新前按最近一次读到的
+            面板温度（EPD_4in26_ReadTemperature 自动更新）选取第一条满足的：
+              ctrl     : 0x22 控制字
+              temp_reg : 写入 0x1A 的温度值，让 OTP 选用较短的波形；
+                         0 表示不覆盖，由控制器按内部传感器实测温度选择
+              lut      : RAM 波形表（NULL = OTP）
+            面板未定义某种波形时退回 WAVE_FULL
+******************************************************************************/
+static const EPD_WaveEntry *EPD_4in26_FindWave(EPD_4in26_Wave wave)
+{
+	if (s_panel->waves[wave][0].ctrl == 0) {
+		wave = EPD_4in26_WAVE_FULL;
+	}
+	const EPD_WaveEntry *bands = s_panel->waves[wave];
+	for (int i = 0; i < EPD_WAVE_MAX_BANDS; i++) {
+		// 未使用的条目 ctrl 为 0；最后一个有效条目兜底
+		if (bands[i].ctrl == 0) {
+			return &bands[i > 0 ? i - 1 : 0];
+		}
+		if (s_wave_temp_c <= bands[i].max_temp) {
+			return &bands[i];
+		}
+	}
+	return &bands[EPD_WAVE_MAX_BANDS - 1];
+}
+
+/******************************************************************************
+function :	Prepare the waveform for one update and send 0x22
+info     :  只在需要时写 0x1A 和 RAM LUT；调用者随后发送 0x20
+******************************************************************************/
+static UBYTE EPD_4in26_ApplyWave(EPD_4in26_Wave wave)
+{
+	const EPD_WaveEntry *e = EPD_4in26_FindWave(wave);
+
+	if (e->lut != NULL && e->lut != s_wave_ram_lut) {
+		EPD_4in26_LoadLut(e->lut);
+	}
+	if (e->temp_reg != 0) {
+		EPD_4in26_SetReg(0x1A, e->temp_reg);
+	}
+
+	EPD_4in26_SendCommand(0x22); //Display Update Control
+	EPD_4in26_SendData(e->ctrl);
+	return e->ctrl;
+}
+
+void EPD_4in26_SetWaveTemperature(int celsius)
+{
+	if (celsius != EPD_4in26_TEMP_INVALID) {
+		s_wave_temp_c = celsius;
+	}
+}
+
+EPD_4in26_State EPD_4in26_GetState(void)
+{
+	return s_epd_state;
+}
+
+EPD_4in26_Mode EPD_4in26_GetMode(void)
+{
+	return s_epd_mode;
+}
+
+/******************************************************************************
+function :	Make sure the controller is awake and has the requested mode loaded
+info     :  已初始化且模式一致时什么都不做；只有冷启动、深度睡眠唤醒或
+            单色/灰阶切换时才执行复位和初始化
+******************************************************************************/
+void EPD_4in26_EnsureMode(EPD_4in26_Mode mode)
+{
+	if (s_epd_state == EPD_4in26_STATE_READY && s_epd_mode == mode) {
+		return;
+	}
+	ESP_LOGI("EPD", "EnsureMode: state=%d mode=%d -> init mode %d", (int)s_epd_state, (int)s_epd_mode, (int)mode);
+	if (mode == EPD_4in26_MODE_4GRAY) {
+		EPD_4in26_Init_4GRAY();
+	} else {
+		EPD_4in26_Init_Fast();
+	}
 }
 
 /******************************************************************************
@@ -268,17 +897,25 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
+    EPD_4in26_BatchBegin();
     EPD_4in26_SendCommand(0x44); // SET_RAM_X_ADDRESS_START_END_POSITION
-    EPD_4in26_SendData(Xstart & 0xFF);
-    EPD_4in26_SendData((Xstart>>8) & 0x03);
-    EPD_4in26_SendData(Xend & 0xFF);
-    EPD_4in26_SendData((Xend>>8) & 0x03);
+    if (s_panel->x_addr_shift != 0) {
+        // 按字节寻址的控制器：X 地址各 1 字节
+        EPD_4in26_SendData((Xstart >> s_panel->x_addr_shift) & 0xFF);
+        EPD_4in26_SendData((Xend >> s_panel->x_addr_shift) & 0xFF);
+    } else {
+        EPD_4in26_SendData(Xstart & 0xFF);
+        EPD_4in26_SendData((Xstart>>8) & 0x03);
+        EPD_4in26_SendData(Xend & 0xFF);
+        EPD_4in26_SendData((Xend>>8) & 0x03);
+    }
 	
     EPD_4in26_SendCommand(0x45); // SET_RAM_Y_ADDRESS_START_END_POSITION
     EPD_4in26_SendData(Ystart & 0xFF);
     EPD_4in26_SendData((Ystart>>8) & 0x03);
     EPD_4in26_SendData(Yend & 0xFF);
     EPD_4in26_SendData((Yend>>8) & 0x03);
+    EPD_4in26_BatchEnd();
 }
 
 /******************************************************************************
@@ -287,155 +924,318 @@ parameter:
 ******************************************************************************/
 static void EPD_4in26_SetCursor(UWORD Xstart, UWORD Ystart)
 {
+    EPD_4in26_BatchBegin();
     EPD_4in26_SendCommand(0x4E); // SET_RAM_X_ADDRESS_COUNTER
-    EPD_4in26_SendData(Xstart & 0xFF);
-    EPD_4in26_SendData((Xstart>>8) & 0x03);
+    if (s_panel->x_addr_shift != 0) {
+        EPD_4in26_SendData((Xstart >> s_panel->x_addr_shift) & 0xFF);
+    } else {
+        EPD_4in26_SendData(Xstart & 0xFF);
+        EPD_4in26_SendData((Xstart>>8) & 0x03);
+    }
 
     EPD_4in26_SendCommand(0x4F); // SET_RAM_Y_ADDRESS_COUNTER
     EPD_4in26_SendData(Ystart & 0xFF);
     EPD_4in26_SendData((Ystart>>8) & 0x03);
+    EPD_4in26_BatchEnd();
 }
 
 /******************************************************************************
-function :	Initialize the e-Paper register (follows flowchart strictly)
+function :	Run a panel init sequence (see EPD_SEQ_* in EPD_Panel.h)
+info     :  单字节寄存器经 EPD_4in26_SetReg 写入，同时更新寄存器缓存。
+            两个同步点（复位、BUSY、延时）之间的命令合并为一个命令批发送
+******************************************************************************/
+static void EPD_4in26_RunSeq(const UBYTE *seq)
+{
+	EPD_4in26_BatchBegin();
+	while (*seq != EPD_SEQ_END) {
+		const UBYTE op = *seq++;
+		switch (op) {
+		case EPD_SEQ_RESET:
+			EPD_4in26_Reset();
+			break;
+		case EPD_SEQ_BUSY:
+			EPD_4in26_ReadBusy();
+			break;
+		case EPD_SEQ_DELAY:
+			EPD_4in26_BatchFlush();
+			DEV_Delay_ms(*seq++);
+			break;
+		case EPD_SEQ_WINDOW:
+			EPD_4in26_SetWindows(0, s_panel->height-1, s_panel->width-1, 0);
+			EPD_4in26_SetCursor(0, 0);
+			break;
+		case EPD_SEQ_CLEAR_RAM:
+			EPD_4in26_ClearRAM();
+			break;
+		default: {
+			const UBYTE n = *seq++;
+			if (n == 1) {
+				EPD_4in26_SetReg(op, seq[0]);
+			} else {
+				EPD_4in26_SendCommand(op);
+				for (UBYTE i = 0; i < n; i++) {
+					EPD_4in26_SendData(seq[i]);
+				}
+			}
+			seq += n;
+			break;
+		}
+		}
+	}
+	EPD_4in26_BatchEnd();
+}
+
+/******************************************************************************
+function :	Select the panel descriptor used by the driver engine
 parameter:
+	panel : 分辨率必须与编译期帧缓冲（EPD_4in26_WIDTH x EPD_4in26_HEIGHT）一致
+return   :	false 表示分辨率不匹配，保持原面板
+info     :  切换后控制器回到冷状态，下一次 Display* 按新描述符初始化
 ******************************************************************************/
-void EPD_4in26_Init(void)
+bool EPD_4in26_SetPanel(const struct EPD_Panel *panel)
 {
-	// Step 1: Power On (handled by hardware/VCI supply)
-	// Step 2: Set Initial Configuration
-	EPD_4in26_Reset();  // HW Reset
-	DEV_Delay_ms(10);   // Wait 10ms as per flowchart
+	if (panel == NULL || panel->width != EPD_4in26_WIDTH || panel->height != EPD_4in26_HEIGHT) {
+		ESP_LOGE("EPD", "SetPanel: %s does not match the %ux%u framebuffer",
+		         panel != NULL ? panel->name : "(null)", EPD_4in26_WIDTH, EPD_4in26_HEIGHT);
+		return false;
+	}
+	s_panel = panel;
+	s_epd_state = EPD_4in26_STATE_COLD;
+	s_epd_mode = EPD_4in26_MODE_NONE;
+	s_prev_hash_valid = false;
+	ESP_LOGI("EPD", "Panel: %s (caps 0x%02X)", panel->name, panel->caps);
+	return true;
+}
 
-	EPD_4in26_ReadBusy();   
-	EPD_4in26_SendCommand(0x12);  // SW Reset by Command 0x12
-	EPD_4in26_ReadBusy();   
-	DEV_Delay_ms(10);   // Wait 10ms as per flowchart
-	
-	// Step 3: Send Initialization Code
-	// Clear and fill RAM using 0x46/0x47
-	EPD_4in26_ClearRAM();
-	
-	// Set gate driver output by Command 0x01
-	EPD_4in26_SendCommand(0x01);   // Drive output control    
-	EPD_4in26_SendData((EPD_4in26_HEIGHT-1)%256); //  Y  
-	EPD_4in26_SendData((EPD_4in26_HEIGHT-1)/256); //  Y 
-	EPD_4in26_SendData(0x02);
+const struct EPD_Panel *EPD_4in26_GetPanel(void)
+{
+	return s_panel;
+}
 
-	// Set display RAM size by Command 0x11, 0x44, 0x45
-	EPD_4in26_SendCommand(0x11);        // Data entry mode
-	EPD_4in26_SendData(0x01);           // X-mode x+ y-
+bool EPD_4in26_HasCap(UBYTE cap)
+{
+	return (s_panel->caps & cap) == cap;
+}
 
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
+/******************************************************************************
+function :	Initialize the e-Paper register (follows flowchart strictly)
+parameter:
+info     :  描述符的 init_full：复位、清 RAM、载入 OTP LUT
+******************************************************************************/
+void EPD_4in26_Init(void)
+{
+	EPD_4in26_RunSeq(s_panel->init_full);
 
-	// Set panel border by Command 0x3C
-	EPD_4in26_SendCommand(0x3C);        // Border setting 
-	EPD_4in26_SendData(0x01);
+	s_epd_state = EPD_4in26_STATE_READY;
+	s_epd_mode = EPD_4in26_MODE_MONO;
+}
 
-	// Soft start setting
-	EPD_4in26_SendCommand(0x0C);        // Soft start     
-	EPD_4in26_SendData(0xAE);
-	EPD_4in26_SendData(0xC7);
-	EPD_4in26_SendData(0xC3);
-	EPD_4in26_SendData(0xC0);
-	EPD_4in26_SendData(0x80);
-
-	// Step 4: Load Waveform LUT
-	// Sense temperature by mVext TS by Command 0x18
-	EPD_4in26_SendCommand(0x18); // Use internal temperature sensor
-	EPD_4in26_SendData(0x80);
-
-	// Load waveform LUT from OTP by Command 0x22, 0x20 to MCU
-	EPD_4in26_SendCommand(0x22);  // Display Update Control
-	EPD_4in26_SendData(0xB1);     // Load LUT from OTP
-	EPD_4in26_SendCommand(0x20);  // Activate Display Update Sequence
-	EPD_4in26_ReadBusy();
+void EPD_4in26_Init_Fast(void)
+{
+	EPD_4in26_RunSeq(s_panel->init_mono);
 
-	EPD_4in26_SetCursor(0, 0);
+	s_epd_state = EPD_4in26_STATE_READY;
+	s_epd_mode = EPD_4in26_MODE_MONO;
 }
 
-void EPD_4in26_Init_Fast(void)
+void EPD_4in26_Init_4GRAY(void)
 {
-	EPD_4in26_Reset();
-	DEV_Delay_ms(100);
+	if (s_panel->init_gray == NULL || !EPD_4in26_HasCap(EPD_PANEL_CAP_4GRAY)) {
+		ESP_LOGE("EPD", "Init_4GRAY: %s has no 4-gray support, using mono", s_panel->name);
+		EPD_4in26_Init_Fast();
+		return;
+	}
+	EPD_4in26_RunSeq(s_panel->init_gray);
 
-	EPD_4in26_ReadBusy();   
-	EPD_4in26_SendCommand(0x12);  //SWRESET
-	EPD_4in26_ReadBusy();   
-	
-	EPD_4in26_SendCommand(0x18); // use the internal temperature sensor
-	EPD_4in26_SendData(0x80);
+    const EPD_WaveEntry *gray = EPD_4in26_FindWave(EPD_4in26_WAVE_4GRAY);
+    if (gray->lut != NULL) {
+        EPD_4in26_LoadLut(gray->lut);
+    }
 
-	EPD_4in26_SendCommand(0x0C); //set soft start     
-	EPD_4in26_SendData(0xAE);
-	EPD_4in26_SendData(0xC7);
-	EPD_4in26_SendData(0xC3);
-	EPD_4in26_SendData(0xC0);
-	EPD_4in26_SendData(0x80);
+	s_epd_state = EPD_4in26_STATE_READY;
+	s_epd_mode = EPD_4in26_MODE_4GRAY;
+}
 
-	EPD_4in26_SendCommand(0x01);   //      drive output control    
-	EPD_4in26_SendData((EPD_4in26_HEIGHT-1)%256); //  Y  
-	EPD_4in26_SendData((EPD_4in26_HEIGHT-1)/256); //  Y 
-	EPD_4in26_SendData(0x02);
+/******************************************************************************
+function :	Probe the fastest reliable SPI write clock
+parameter:
+info     :  逐级提高写时钟，每级向 RAM 0x24 的第一行写入测试图案，
+            再用 0x27 以读时钟读回比较；第一次失败即停止，保留最后一个通过的时钟。
+            探测会改写 RAM，调用后需要重新写入整帧（如 Clear/Display）。
+            需在 Init/Init_Fast 之后调用。
+******************************************************************************/
+#define EPD_PROBE_BYTES 32
 
-	EPD_4in26_SendCommand(0x3C);        // Border       Border setting 
-	EPD_4in26_SendData(0x01);
+static bool EPD_4in26_ProbeOnce(UDOUBLE hz)
+{
+	UBYTE pattern[EPD_PROBE_BYTES];
+	UBYTE readback[EPD_PROBE_BYTES];
 
-	EPD_4in26_SendCommand(0x11);        //    data  entry  mode
-	EPD_4in26_SendData(0x01);           //       X-mode  x+ y- (original)
+	for (int i = 0; i < EPD_PROBE_BYTES; i++) {
+		// 交替/移位图案，覆盖 0x00/0xFF 之外的高频跳变
+		pattern[i] = (UBYTE)((i & 1) ? (0xA5 ^ (hz >> (i % 24))) : (0x5A + i));
+	}
 
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
+	if (DEV_Set_Clock(DEV_CLK_EPD_WRITE, hz) != 0) {
+		return false;
+	}
 
+	EPD_4in26_SetWindows(0, 0, EPD_PROBE_BYTES * 8 - 1, 0);
 	EPD_4in26_SetCursor(0, 0);
+	EPD_4in26_SendCommand(0x24);
+	EPD_4in26_SendDataRows(pattern, EPD_PROBE_BYTES, EPD_PROBE_BYTES, 1);
 
-	// 设置快刷模式的温度补偿（只需设置一次，后续刷新保持）
-	EPD_4in26_SendCommand(0x1A);
-	EPD_4in26_SendData(0x5A);
+	EPD_4in26_SetCursor(0, 0);
+	EPD_4in26_SendCommand(0x41);  // Read RAM Option
+	EPD_4in26_SendData(0x00);     // RAM 0x24
 
-	// 加载波形 LUT（从 OTP）
-	EPD_4in26_SendCommand(0x22);  // Display Update Control
-	EPD_4in26_SendData(0xB1);     // Load LUT from OTP
-	EPD_4in26_SendCommand(0x20);  // Activate Display Update Sequence
-	EPD_4in26_ReadBusy();
+	memset(readback, 0, sizeof(readback));
+	if (DEV_SPI_Read_Register(0x27, readback, EPD_PROBE_BYTES) != 0) {
+		return false;
+	}
+	return memcmp(pattern, readback, EPD_PROBE_BYTES) == 0;
 }
 
-void EPD_4in26_Init_4GRAY(void)
+UDOUBLE EPD_4in26_ProbeSpiClock(void)
 {
-    EPD_4in26_Reset();
-	DEV_Delay_ms(100);
+	static const UDOUBLE steps[] = {
+		10 * 1000 * 1000,
+		16 * 1000 * 1000,
+		20 * 1000 * 1000,
+		26 * 1000 * 1000 + 666 * 1000,  // 80MHz / 3
+		40 * 1000 * 1000,
+	};
+
+	UDOUBLE best = DEV_Get_Clock(DEV_CLK_EPD_WRITE);
+
+	for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+		if (!EPD_4in26_ProbeOnce(steps[i])) {
+			ESP_LOGW("EPD", "SPI clock probe: %lu Hz readback mismatch", (unsigned long)steps[i]);
+			break;
+		}
+		best = steps[i];
+	}
 
-	EPD_4in26_ReadBusy();   
-	EPD_4in26_SendCommand(0x12);  //SWRESET
-	EPD_4in26_ReadBusy();   
-	
-	EPD_4in26_SendCommand(0x18); // use the internal temperature sensor
-	EPD_4in26_SendData(0x80);
+	DEV_Set_Clock(DEV_CLK_EPD_WRITE, best);
 
-	EPD_4in26_SendCommand(0x0C); //set soft start     
-	EPD_4in26_SendData(0xAE);
-	EPD_4in26_SendData(0xC7);
-	EPD_4in26_SendData(0xC3);
-	EPD_4in26_SendData(0xC0);
-	EPD_4in26_SendData(0x80);
+	// 恢复全屏窗口
+	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
+	EPD_4in26_SetCursor(0, 0);
 
-	EPD_4in26_SendCommand(0x01);   //      drive output control    
-	EPD_4in26_SendData((EPD_4in26_WIDTH-1)%256); //  Y  
-	EPD_4in26_SendData((EPD_4in26_WIDTH-1)/256); //  Y 
-	EPD_4in26_SendData(0x02);
+	ESP_LOGI("EPD", "SPI clock probe: using %lu Hz for EPD writes", (unsigned long)best);
+	return best;
+}
 
-	EPD_4in26_SendCommand(0x3C);        // Border       Border setting 
-	EPD_4in26_SendData(0x01);
+/******************************************************************************
+function :	Check whether a framebuffer row is all white
+******************************************************************************/
+static bool EPD_4in26_RowIsWhite(const UBYTE *row)
+{
+	const uint32_t *w = (const uint32_t *)row;
+	for (UWORD i = 0; i < EPD_4in26_WIDTH / 32; i++) {
+		if (w[i] != 0xFFFFFFFFu) {
+			return false;
+		}
+	}
+	return true;
+}
 
-	EPD_4in26_SendCommand(0x11);        //    data  entry  mode
-	EPD_4in26_SendData(0x01);           //       X-mode  x+ y- (original)
+/******************************************************************************
+function :	Send one full-frame RAM plane after the write command
+info     :  设置了取代检查时按 EPD_4in26_SUPERSEDE_ROWS 行分段发送，每段之前检查一次；
+            数据连续写入，RAM 地址计数器跨段自动延续
+return   :	false 表示被取代，平面只写了一部分
+******************************************************************************/
+static bool EPD_4in26_SendPlane(const UBYTE *Image)
+{
+	const UWORD width = EPD_4in26_WIDTH / 8;
+	const UWORD band = s_superseded_cb != NULL ? EPD_4in26_SUPERSEDE_ROWS : EPD_4in26_HEIGHT;
+	for (UWORD y = 0; y < EPD_4in26_HEIGHT; y += band) {
+		if (EPD_4in26_Superseded()) {
+			return false;
+		}
+		const UWORD rows = (EPD_4in26_HEIGHT - y < band) ? (EPD_4in26_HEIGHT - y) : band;
+		EPD_4in26_SendDataRows(Image + (UDOUBLE)y * width, width, width, rows);
+	}
+	return true;
+}
 
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
+/******************************************************************************
+function :	Write a full mono frame into both RAM planes (no update)
+info     :  按行扫描全白行：数量不多时照常整帧上传两次；
+            否则先用 0x46/0x47 把两个平面填成白色，再把有内容的行段
+            按整行宽度的窗口上传（空白页、页面下半部分空白时省下大部分 SPI 传输）
+return   :	false 表示上传被取代：RAM 内容不完整，行哈希影子作废，
+            下一次必须重新整帧写入
+******************************************************************************/
+static bool EPD_4in26_WriteFrame(const UBYTE *Image)
+{
+	const UWORD width = EPD_4in26_WIDTH / 8;
+	UBYTE white[EPD_4in26_HEIGHT / 8] = {0};
+	UWORD white_rows = 0;
+	for (UWORD y = 0; y < EPD_4in26_HEIGHT; y++) {
+		if (EPD_4in26_RowIsWhite(Image + (UDOUBLE)y * width)) {
+			white[y >> 3] |= (UBYTE)(1u << (y & 7));
+			white_rows++;
+		}
+	}
 
+	// 重新设置全屏窗口（防止之前的局部刷新改变了窗口范围）
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
 	EPD_4in26_SetCursor(0, 0);
 
-	EPD_4in26_ReadBusy();
+	if (white_rows < EPD_4in26_FILL_MIN_ROWS) {
+		// 写入当前图像缓冲区 (0x24)
+		EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
+		EPD_4in26_BatchEnd();
+		if (!EPD_4in26_SendPlane(Image)) {
+			s_prev_hash_valid = false;
+			return false;
+		}
 
-    EPD_4in26_Lut();
+		// 同时写入上一帧缓冲区 (0x26)，确保局部刷新时对比正确
+		EPD_4in26_SendCommand(0x26);   //write RAM for previous frame
+		if (!EPD_4in26_SendPlane(Image)) {
+			s_prev_hash_valid = false;
+			return false;
+		}
+		EPD_4in26_PrevHashCommit(Image);
+		return true;
+	}
+
+	EPD_4in26_FillRAM(0xFF);
+	EPD_4in26_BatchEnd();
+
+	UWORD uploaded = 0;
+	UWORD y = 0;
+	while (y < EPD_4in26_HEIGHT) {
+		if (white[y >> 3] & (1u << (y & 7))) {
+			y++;
+			continue;
+		}
+		// 向后延伸到连续 EPD_4in26_FILL_GAP_ROWS 行全白为止
+		UWORD last = y;
+		for (UWORD r = y + 1; r < EPD_4in26_HEIGHT && r - last <= EPD_4in26_FILL_GAP_ROWS; r++) {
+			if (!(white[r >> 3] & (1u << (r & 7)))) {
+				last = r;
+			}
+		}
+		if (EPD_4in26_Superseded()) {
+			s_prev_hash_valid = false;
+			return false;
+		}
+		const UWORD h = last - y + 1;
+		EPD_4in26_LoadPartialWindow(Image, Image, 0, y, EPD_4in26_WIDTH, h, false);
+		uploaded += h;
+		y = last + 1;
+	}
+
+	s_stats.fill_bytes += (UDOUBLE)(EPD_4in26_HEIGHT - uploaded) * width * 2;
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_WriteFrame: auto-fill, %u white rows, %u rows uploaded",
+	           white_rows, uploaded);
+	EPD_4in26_PrevHashCommit(Image);
+	return true;
 }
 
 /******************************************************************************
@@ -444,29 +1244,13 @@ parameter:
 ******************************************************************************/
 void EPD_4in26_Clear(void)
 {
-	UWORD i;
-	UWORD height = EPD_4in26_HEIGHT;
-	UWORD width = EPD_4in26_WIDTH/8;
-	UBYTE image[EPD_4in26_WIDTH / 8] = {0x00};
-    for(i=0; i<width; i++) {
-        image[i] = 0xff;
-    }
-
 	// 重新设置全屏窗口
 	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
 	EPD_4in26_SetCursor(0, 0);
 
-	EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-	    EPD_4in26_SendData2(image, width);
-	}
-
-	EPD_4in26_SendCommand(0x26);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-		EPD_4in26_SendData2(image, width);
-	}
+	EPD_4in26_FillRAM(0xFF);
+	s_stats.fill_bytes += (UDOUBLE)EPD_4in26_HEIGHT * (EPD_4in26_WIDTH / 8) * 2;
+	EPD_4in26_PrevHashCommitWhite();
 	EPD_4in26_TurnOnDisplay();
 }
 
@@ -476,35 +1260,17 @@ parameter:
 ******************************************************************************/
 void EPD_4in26_Clear_Fast(void)
 {
-	UWORD i;
-	UWORD height = EPD_4in26_HEIGHT;
-	UWORD width = EPD_4in26_WIDTH/8;
-	UBYTE image[EPD_4in26_WIDTH / 8] = {0x00};
-    for(i=0; i<width; i++) {
-        image[i] = 0xff;
-    }
-
 	// 重新设置全屏窗口
 	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
 	EPD_4in26_SetCursor(0, 0);
 
 	// 设置快刷模式的温度补偿
-	EPD_4in26_SendCommand(0x1A);
-	EPD_4in26_SendData(0x5A);
+	EPD_4in26_SetReg(0x1A, 0x5A);
 
-	// 写入当前图像缓冲区 (0x24)
-	EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-	    EPD_4in26_SendData2(image, width);
-	}
-
-	// 同时写入上一帧缓冲区 (0x26)，确保局部刷新时对比基准正确
-	EPD_4in26_SendCommand(0x26);   //write RAM for previous frame
-	for(i=0; i<height; i++)
-	{
-	    EPD_4in26_SendData2(image, width);
-	}
+	// 两个平面同时填白，0x26 也是白色，后续局部刷新的对比基准正确
+	EPD_4in26_FillRAM(0xFF);
+	s_stats.fill_bytes += (UDOUBLE)EPD_4in26_HEIGHT * (EPD_4in26_WIDTH / 8) * 2;
+	EPD_4in26_PrevHashCommitWhite();
 
 	EPD_4in26_TurnOnDisplay_Fast();
 }
@@ -513,65 +1279,27 @@ void EPD_4in26_Clear_Fast(void)
 function :	Sends the image buffer in RAM to e-Paper and displays
 parameter:
 ******************************************************************************/
-void EPD_4in26_Display(UBYTE *Image)
+bool EPD_4in26_Display(UBYTE *Image)
 {
-	UWORD i;
-	UWORD height = EPD_4in26_HEIGHT;
-	UWORD width = EPD_4in26_WIDTH/8;
-
-	ESP_LOGI("EPD", "EPD_4in26_Display: starting, height=%u, width=%u bytes", height, width);
-
-	// 重新设置全屏窗口（防止之前的局部刷新改变了窗口范围）
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
-	EPD_4in26_SetCursor(0, 0);
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
 
 	// 打印前几行数据用于调试
-	ESP_LOGI("EPD", "EPD_4in26_Display: first 4 bytes of image: 0x%02X 0x%02X 0x%02X 0x%02X",
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display: first 4 bytes of image: 0x%02X 0x%02X 0x%02X 0x%02X",
 	         Image[0], Image[1], Image[2], Image[3]);
 
-	// 写入当前图像缓冲区 (0x24)
-	EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-        EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
+	// 0x24 与 0x26 写入同一帧：如果不写 0x26，局部刷新会和旧数据对比，导致显示错误
+	if (!EPD_4in26_WriteFrame(Image) || EPD_4in26_Superseded()) {
+		return false;
 	}
-
-	ESP_LOGI("EPD", "EPD_4in26_Display: 0x24 written, writing 0x26...");
-
-	// 同时写入上一帧缓冲区 (0x26)，确保局部刷新时对比正确
-	// 这是关键：如果不写 0x26，局部刷新会和旧数据对比，导致显示错误
-	EPD_4in26_SendCommand(0x26);   //write RAM for previous frame
-	for(i=0; i<height; i++)
-	{
-        EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
-	}
-
-	ESP_LOGI("EPD", "EPD_4in26_Display: both RAMs written, triggering display...");
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display: both RAMs written, triggering display...");
 	EPD_4in26_TurnOnDisplay();
-	ESP_LOGI("EPD", "EPD_4in26_Display: complete!");
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display: complete!");
+	return true;
 }
 
 void EPD_4in26_Display_Base(UBYTE *Image)
 {
-	UWORD i;
-	UWORD height = EPD_4in26_HEIGHT;
-	UWORD width = EPD_4in26_WIDTH/8;
-
-	// 重新设置全屏窗口
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
-	EPD_4in26_SetCursor(0, 0);
-
-	EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-		EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
-	}
-
-	EPD_4in26_SendCommand(0x26);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-		EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
-	}
+	EPD_4in26_WriteFrame(Image);
 	EPD_4in26_TurnOnDisplay();	
 }
 
@@ -583,80 +1311,100 @@ description:
 	该模式通过0xC7刷新序列实现快速更新，适用于需要快速响应的场景。
 	刷新过程中会自动写入两个RAM缓冲区(0x24和0x26)以确保显示正确。
 ******************************************************************************/
-void EPD_4in26_Display_Fast(UBYTE *Image)
+bool EPD_4in26_Display_Fast(UBYTE *Image)
 {
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: starting...");
-	UWORD i;
-	UWORD height = EPD_4in26_HEIGHT;
-	UWORD width = EPD_4in26_WIDTH/8;
-
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: height=%u, width=%u bytes", height, width);
-
-	// 重新设置全屏窗口（防止之前的局部刷新改变了窗口范围）
-	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
-	EPD_4in26_SetCursor(0, 0);
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_Fast: starting...");
 
 	// 打印前4字节用于调试验证数据格式
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: first 4 bytes of image: 0x%02X 0x%02X 0x%02X 0x%02X",
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_Fast: first 4 bytes of image: 0x%02X 0x%02X 0x%02X 0x%02X",
 	         Image[0], Image[1], Image[2], Image[3]);
 
-	// 步骤1：温度补偿
-	// 墨水屏刷新效果受温度影响，设置合适的温度补偿值可优化显示质量
-	// 0x5A 对应 25°C 标准温度
-	EPD_4in26_SendCommand(0x1A); // Write to temperature register
-	EPD_4in26_SendData(0x5A);    // 25°C 补偿值
-
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: writing to 0x24...");
-	// 步骤2：写入当前帧图像数据到 RAM 0x24
-	// 0x24 是墨水屏的主图像RAM地址，存储当前要显示的图像
-	EPD_4in26_SendCommand(0x24);   //write RAM for black(0)/white (1)
-	for(i=0; i<height; i++)
-	{
-		EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
-	}
+	// 步骤1：温度补偿在触发刷新前按波形表选择（EPD_4in26_ApplyWave）
 
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: 0x24 written, writing to 0x26...");
-	// 步骤3：同步写入上一帧 RAM 0x26
+	// 步骤2：写入当前帧图像数据到 RAM 0x24，并同步写入上一帧 RAM 0x26
 	// 0x26 存储的是上一帧图像数据，局部刷新时需要与 0x24 对比来确定像素变化
 	// 即使使用快刷，也需要同步 0x26 以确保后续局部刷新操作正确
-	EPD_4in26_SendCommand(0x26);   //write RAM for previous frame
-	for(i=0; i<height; i++)
-	{
-		EPD_4in26_SendData2((UBYTE *)(Image+i*width), width);
+	if (!EPD_4in26_WriteFrame(Image) || EPD_4in26_Superseded()) {
+		return false;
 	}
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: both RAMs written, triggering refresh...");
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_Fast: both RAMs written, triggering refresh...");
 
 	// 根据 GxEPD2：使用 0xD7 进行快刷（full update with mode change）
-	// 0x21: Display Update Control
-	EPD_4in26_SendCommand(0x21);
-	EPD_4in26_SendData(0x40);    // bypass RED as 0
-	EPD_4in26_SendData(0x00);    // single chip application
+	// 0x21: Display Update Control；0x21/0x22/0x20 作为一个命令批发送
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(false);
 
-	// 0x22+0xD7: 快刷模式
-	EPD_4in26_SendCommand(0x22);
-	EPD_4in26_SendData(0xD7);    // fast full update mode
+	// 0x22+0xD7: 快刷模式（低温时按波形表退回完整波形）
+	const UBYTE ctrl = EPD_4in26_ApplyWave(EPD_4in26_WAVE_FAST);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, ctrl, 1);
 
 	EPD_4in26_SendCommand(0x20); // Activate Display Update Sequence
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: waiting for BUSY...");
+	EPD_4in26_BatchEnd();
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_Fast: waiting for BUSY...");
+	EPD_4in26_WaitUpdate(EPD_4in26_WAVE_FAST);
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_Fast: complete!");
+	return true;
+}
+
+/******************************************************************************
+function :	Load an image into both controller RAMs without refreshing
+parameter:
+info     :  开机恢复：面板断电后仍显示上次的画面，控制器 RAM 却已清空。
+            把同一帧写入 0x24 和 0x26，不触发波形，下一次局刷以它为基准
+******************************************************************************/
+void EPD_4in26_LoadFrame(const UBYTE *Image)
+{
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
+	EPD_4in26_WriteFrame(Image);
+}
+
+/******************************************************************************
+function :	Read the panel temperature from the internal sensor
+parameter:
+return   :	degrees Celsius, EPD_4in26_TEMP_INVALID on failure
+******************************************************************************/
+int EPD_4in26_ReadTemperature(void)
+{
+	UBYTE raw[2] = {0};
+
+	EPD_4in26_SetReg(0x18, 0x80);  // use the internal temperature sensor
+
+	// 0xA1: 开时钟 -> 载入温度 -> 关时钟，不重新载入 LUT，不影响显示
+	EPD_4in26_SendCommand(0x22);
+	EPD_4in26_SendData(0xA1);
+	EPD_4in26_SendCommand(0x20);
 	EPD_4in26_ReadBusy();
-	ESP_LOGI("EPD", "EPD_4in26_Display_Fast: complete!");
+
+	if (DEV_SPI_Read_Register(0x1B, raw, sizeof(raw)) != 0) {
+		ESP_LOGW("EPD", "Temperature read failed");
+		return EPD_4in26_TEMP_INVALID;
+	}
+
+	// 12 位有符号数，单位 1/16 °C：raw[0]=D11..D4，raw[1] 高 4 位=D3..D0
+	const int16_t value = (int16_t)(((uint16_t)raw[0] << 8) | raw[1]) >> 4;
+	EPD_4in26_SetWaveTemperature(value / 16);
+	return value / 16;
 }
 
 /******************************************************************************
-function :	Partial refresh - fast partial update mode
+function :	Load one partial window into RAM 0x24/0x26 (no update)
 parameter:
+    Image24 : 写入 0x24 的整帧缓冲（1bpp，每行 EPD_4in26_WIDTH/8 字节）
+    Image26 : 写入 0x26 的整帧缓冲；单色局刷与 Image24 相同，4 灰阶为第二个位平面
+    lazy26  : 按行哈希影子跳过 0x26 中内容未变化的行（仅单色，需影子有效）
 ******************************************************************************/
-void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
+static bool EPD_4in26_LoadPartialWindow(const UBYTE *Image24, const UBYTE *Image26,
+										UWORD x, UWORD y, UWORD w, UWORD h, bool lazy26)
 {
-	ESP_LOGI("EPD", "EPD_4in26_Display_Partial: x=%u, y=%u, w=%u, h=%u", x, y, w, h);
-	UWORD i;
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_LoadPartialWindow: x=%u, y=%u, w=%u, h=%u", x, y, w, h);
 	const UWORD full_width_bytes = EPD_4in26_WIDTH / 8;
 
 	// 参数验证：确保坐标和尺寸在有效范围内
 	if (x >= EPD_4in26_WIDTH || y >= EPD_4in26_HEIGHT) {
 		ESP_LOGE("EPD", "Invalid partial refresh coordinates: x=%u, y=%u (max: %u, %u)",
 		         x, y, EPD_4in26_WIDTH-1, EPD_4in26_HEIGHT-1);
-		return;
+		return false;
 	}
 
 	// 确保宽度和高度不超出边界
@@ -681,7 +1429,8 @@ void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 		w = ((w + 7) / 8) * 8;
 	}
 
-	ESP_LOGI("EPD", "Adjusted partial refresh area: x=%u, y=%u, w=%u, h=%u", x, y, w, h);
+	TRACE_LOGI(EPD, "EPD", "Adjusted partial refresh area: x=%u, y=%u, w=%u, h=%u", x, y, w, h);
+	TRACE_EVENT(TRACE_EV_EPD_WINDOW, TRACE_PACK(x, y), TRACE_PACK(w, h));
 
 	// 计算局刷窗口每行字节数与起始偏移
 	const UWORD x_byte = x / 8;
@@ -691,72 +1440,157 @@ void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 	// y = HEIGHT - y - h (reversed partial window)
 	UWORD y_reversed = EPD_4in26_HEIGHT - y - h;
 
-	// 设置 RAM 区域（部分刷新窗口）
+	// 设置 RAM 区域（部分刷新窗口）；入口模式、窗口、光标与 0x24 作为一个命令批发送
+	EPD_4in26_BatchBegin();
 	EPD_4in26_SendCommand(0x11); // set ram entry mode
 	EPD_4in26_SendData(0x01);    // x increase, y decrease : y reversed
 
-	EPD_4in26_SendCommand(0x44);
-	EPD_4in26_SendData(x % 256);
-	EPD_4in26_SendData(x / 256);
-	EPD_4in26_SendData((x + w - 1) % 256);
-	EPD_4in26_SendData((x + w - 1) / 256);
-
-	EPD_4in26_SendCommand(0x45);
-	EPD_4in26_SendData((y_reversed + h - 1) % 256);
-	EPD_4in26_SendData((y_reversed + h - 1) / 256);
-	EPD_4in26_SendData(y_reversed % 256);
-	EPD_4in26_SendData(y_reversed / 256);
-
-	EPD_4in26_SendCommand(0x4e);
-	EPD_4in26_SendData(x % 256);
-	EPD_4in26_SendData(x / 256);
-
-	EPD_4in26_SendCommand(0x4f);
-	EPD_4in26_SendData((y_reversed + h - 1) % 256);
-	EPD_4in26_SendData((y_reversed + h - 1) / 256);
-
-	// 温度补偿
-	EPD_4in26_SendCommand(0x1A);
-	EPD_4in26_SendData(0x5A);
+	EPD_4in26_SetWindows(x, y_reversed + h - 1, x + w - 1, y_reversed);
+	EPD_4in26_SetCursor(x, y_reversed + h - 1);
 
 	// 写入数据到 0x24
 	// 由于使用 Y- 模式（Y 递减），需要按反向顺序写入
 	// 帧缓冲行 y 对应 RAM 行 y_reversed + h - 1（窗口顶部）
 	// 帧缓冲行 y + h - 1 对应 RAM 行 y_reversed（窗口底部）
+	// 整个窗口作为一次排队的 DMA 突发发送，CS 在整段数据内保持有效；
+	// 窗口为整行宽度时帧缓冲内存连续，直接按大块切分
+	const UDOUBLE window_offset = (UDOUBLE)y * full_width_bytes + x_byte;
 	EPD_4in26_SendCommand(0x24);
-	for(i = 0; i < h; i++)
-	{
-		// 帧缓冲从 y 递增到 y + h - 1
-		// RAM Y 从 y_reversed + h - 1 递减到 y_reversed
-		EPD_4in26_SendData2((UBYTE *)(Image + (y + i) * full_width_bytes + x_byte), window_width_bytes);
-	}
+	EPD_4in26_BatchEnd();
+	// 帧缓冲从 y 递增到 y + h - 1
+	// RAM Y 从 y_reversed + h - 1 递减到 y_reversed
+	EPD_4in26_SendDataRows(Image24 + window_offset, full_width_bytes, window_width_bytes, h);
 
 	// 同步更新上一帧缓冲区(0x26)，否则下一次局刷对比基准会错
-	EPD_4in26_SendCommand(0x4e);
-	EPD_4in26_SendData(x % 256);
-	EPD_4in26_SendData(x / 256);
+	if (!lazy26) {
+		EPD_4in26_BatchBegin();
+		EPD_4in26_SetCursor(x, y_reversed + h - 1);
+		EPD_4in26_SendCommand(0x26);
+		EPD_4in26_BatchEnd();
+		EPD_4in26_SendDataRows(Image26 + window_offset, full_width_bytes, window_width_bytes, h);
+		return true;
+	}
 
-	EPD_4in26_SendCommand(0x4f);
-	EPD_4in26_SendData((y_reversed + h - 1) % 256);
-	EPD_4in26_SendData((y_reversed + h - 1) / 256);
+	// 惰性更新：0x26 已与上一帧一致，只重写整行哈希变化的行。
+	// 同一行被多个窗口覆盖时只在第一次比较，结果对所有窗口有效。
+	// 窗口不是整行宽时只写入窗口的 x 范围，行外的 RAM 仍是旧内容：哈希不能代表这一行，
+	// 标记为 stale，之后每次都当作有变化，直到整行重写（整帧上传）
+	const bool full_row = window_width_bytes == full_width_bytes;
+	for (UWORD r = y; r < y + h; r++) {
+		const UBYTE bit = (UBYTE)(1u << (r & 7));
+		if (s_prev_row_seen[r >> 3] & bit) {
+			continue;
+		}
+		s_prev_row_seen[r >> 3] |= bit;
+		const UDOUBLE hash = EPD_4in26_RowHash(Image26 + (UDOUBLE)r * full_width_bytes);
+		if (hash == s_prev_row_hash[r] && !(s_prev_row_stale[r >> 3] & bit)) {
+			continue;
+		}
+		s_prev_row_dirty[r >> 3] |= bit;
+		if (full_row) {
+			s_prev_row_hash[r] = hash;
+			s_prev_row_stale[r >> 3] &= (UBYTE)~bit;
+		} else {
+			s_prev_row_stale[r >> 3] |= bit;
+		}
+	}
 
-	EPD_4in26_SendCommand(0x26);
-	for(i = 0; i < h; i++)
-	{
-		EPD_4in26_SendData2((UBYTE *)(Image + (y + i) * full_width_bytes + x_byte), window_width_bytes);
+	UWORD skipped = 0;
+	UWORD r = y;
+	while (r < y + h) {
+		if (!(s_prev_row_dirty[r >> 3] & (1u << (r & 7)))) {
+			skipped++;
+			r++;
+			continue;
+		}
+		UWORD run_end = r + 1;
+		while (run_end < y + h && (s_prev_row_dirty[run_end >> 3] & (1u << (run_end & 7)))) {
+			run_end++;
+		}
+		// 帧缓冲行 r 对应 RAM 行 y_reversed + h - 1 - (r - y)
+		EPD_4in26_BatchBegin();
+		EPD_4in26_SetCursor(x, y_reversed + h - 1 - (r - y));
+		EPD_4in26_SendCommand(0x26);
+		EPD_4in26_BatchEnd();
+		EPD_4in26_SendDataRows(Image26 + (UDOUBLE)r * full_width_bytes + x_byte,
+							   full_width_bytes, window_width_bytes, run_end - r);
+		r = run_end;
+	}
+	TRACE_LOGI(EPD, "EPD", "LoadPartialWindow: 0x26 skipped %u/%u unchanged row(s)", skipped, h);
+
+	return true;
+}
+
+/******************************************************************************
+function :	Partial refresh - fast partial update mode
+parameter:
+******************************************************************************/
+void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
+{
+	const EPD_4in26_Rect rect = { x, y, w, h };
+	EPD_4in26_Display_PartialMulti(Image, &rect, 1);
+}
+
+/******************************************************************************
+function :	Partial refresh of several windows with one update activation
+parameter:
+	Image : full 800x480 framebuffer
+	rects : windows in EPD physical coordinates
+	count : number of windows
+******************************************************************************/
+bool EPD_4in26_Display_PartialMulti(UBYTE *Image, const EPD_4in26_Rect *rects, UBYTE count)
+{
+	if (!EPD_4in26_HasCap(EPD_PANEL_CAP_PARTIAL)) {
+		// 面板不支持窗口局刷：整帧快刷（无快刷波形时波形表自动退回全刷）
+		return EPD_4in26_Display_Fast(Image);
+	}
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_PartialMulti: %u window(s)", count);
+
+	// 逐个窗口写入 0x24/0x26，全部写完后只触发一次 0x20 刷新；
+	// 影子有效时 0x26 只写有变化的行，上传期间影子保持有效。
+	// 取代检查放在窗口之间：已写完的窗口两个平面都与影子一致，中途放弃也不会失配
+	const bool lazy26 = s_prev_hash_valid;
+	if (lazy26) {
+		memset(s_prev_row_seen, 0, sizeof(s_prev_row_seen));
+		memset(s_prev_row_dirty, 0, sizeof(s_prev_row_dirty));
+	}
+	s_prev_hash_hold = lazy26;
+	UBYTE loaded = 0;
+	for (UBYTE i = 0; i < count; i++) {
+		if (rects[i].w == 0 || rects[i].h == 0) {
+			continue;
+		}
+		if (EPD_4in26_Superseded()) {
+			s_prev_hash_hold = false;
+			return false;
+		}
+		if (EPD_4in26_LoadPartialWindow(Image, Image, rects[i].x, rects[i].y, rects[i].w, rects[i].h, lazy26)) {
+			loaded++;
+		}
+	}
+	s_prev_hash_hold = false;
+	if (loaded == 0) {
+		ESP_LOGW("EPD", "EPD_4in26_Display_PartialMulti: no valid window, skipping update");
+		return true;
+	}
+	if (EPD_4in26_Superseded()) {
+		return false;
 	}
 
 	// 根据 GxEPD2：局部刷新使用 0xFC
-	EPD_4in26_SendCommand(0x21); // Display Update Control
-	EPD_4in26_SendData(0x00);    // RED normal
-	EPD_4in26_SendData(0x00);    // single chip application
+	EPD_4in26_BatchBegin();
+	EPD_4in26_SetUpdateCtrl1(true);
 
-	EPD_4in26_SendCommand(0x22);
-	EPD_4in26_SendData(0xFC);    // partial update mode
+	// partial update mode（温度补偿按波形表选择）
+	const UBYTE ctrl = EPD_4in26_ApplyWave(EPD_4in26_WAVE_PARTIAL);
+	TRACE_EVENT(TRACE_EV_EPD_UPDATE, ctrl, count);
 
 	EPD_4in26_SendCommand(0x20);
-	EPD_4in26_ReadBusy();
-	ESP_LOGI("EPD", "EPD_4in26_Display_Partial: complete!");
+	EPD_4in26_BatchEnd();
+	EPD_4in26_WaitUpdate(EPD_4in26_WAVE_PARTIAL);
+	TRACE_LOGI(EPD, "EPD", "EPD_4in26_Display_PartialMulti: complete!");
+	return true;
 }
 
 // 局部刷新显示（非流式版本，使用独立的数据缓冲区）
@@ -768,7 +1602,6 @@ void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 //   h: 局部刷新区域的高度（像素，对应 Arduino 的 PART_COLUMN）
 void EPD_4in26_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 {
-	UWORD i;
 
 	// ============================================
 	// 1. 参数验证和边界检查
@@ -818,25 +1651,22 @@ void EPD_4in26_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 	UWORD width_bytes = (w_aligned + 7) / 8;
 	UWORD height_rows = h_actual;  // 行数，对应 Arduino 的 PART_COLUMN
 
-	ESP_LOGI("EPD_PART", "[INFO] Display Part: x=%u->%u, y=%u->%u, w=%u->%u, h=%u",
+	TRACE_LOGI(EPD, "EPD_PART", "[INFO] Display Part: x=%u->%u, y=%u->%u, w=%u->%u, h=%u",
 	         x, x_aligned, y, y, w, w_aligned, h_actual);
-	ESP_LOGI("EPD_PART", "[INFO] Data size: %u bytes x %u rows = %u bytes",
+	TRACE_LOGI(EPD, "EPD_PART", "[INFO] Data size: %u bytes x %u rows = %u bytes",
 	         width_bytes, height_rows, width_bytes * height_rows);
 
 	// ============================================
-	// 5. 硬件复位（参考 Arduino 示例）
+	// 5. 仅在冷启动/深度睡眠后复位并初始化，连续局刷不再每次复位
 	// ============================================
-	EPD_4in26_Reset();
-	DEV_Delay_ms(10);
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
 
 	// ============================================
 	// 6. 发送 EPD 局部刷新命令序列（参考 Arduino 示例）
 	// ============================================
-	EPD_4in26_SendCommand(0x18); // use the internal temperature sensor
-	EPD_4in26_SendData(0x80);
+	EPD_4in26_SetReg(0x18, 0x80);  // use the internal temperature sensor
 
-	EPD_4in26_SendCommand(0x3C); // BorderWavefrom
-	EPD_4in26_SendData(0x80);
+	EPD_4in26_SetReg(0x3C, s_panel->border_partial);  // BorderWavefrom
 
 	// 设置刷新窗口（已对齐的坐标）
 	EPD_4in26_SetWindows(x_aligned, y, x_end, y_end);
@@ -850,12 +1680,8 @@ void EPD_4in26_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 	// 6. 发送图像数据（非流式，从独立缓冲区读取）
 	// 对应 Arduino: for(i=0;i<PART_COLUMN*PART_LINE/8;i++)
 	// ============================================
-	for(i = 0; i < height_rows; i++)
-	{
-		// 从 Image 缓冲区逐行发送数据
-		// 注意：Image 应该包含已经对齐好的数据
-		EPD_4in26_SendData2((UBYTE *)(Image + i * width_bytes), width_bytes);
-	}
+	// 注意：Image 应该包含已经对齐好的数据（行间连续，整块发送）
+	EPD_4in26_SendDataRows(Image, width_bytes, width_bytes, height_rows);
 
 	// ============================================
 	// 7. 触发局部刷新显示
@@ -874,7 +1700,6 @@ void EPD_4in26_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h)
 void EPD_4in26_Display_Part_Stream(UBYTE *full_framebuffer, uint32_t fb_stride,
                                      UWORD x, UWORD y, UWORD w, UWORD h)
 {
-	UWORD i;
 
 	// ============================================
 	// 1. 参数验证和边界检查
@@ -918,9 +1743,9 @@ void EPD_4in26_Display_Part_Stream(UBYTE *full_framebuffer, uint32_t fb_stride,
 	// ============================================
 	// 4. 调试信息
 	// ============================================
-	ESP_LOGI("EPD_PART", "[INFO] Partial refresh: x=%u->%u, y=%u->%u, w=%u->%u, h=%u",
+	TRACE_LOGI(EPD, "EPD_PART", "[INFO] Partial refresh: x=%u->%u, y=%u->%u, w=%u->%u, h=%u",
 	         x, x_aligned, y, y, w, w_aligned, h_actual);
-	ESP_LOGI("EPD_PART", "[INFO] x_offset=%u bytes, w_bytes=%u", x_offset_bytes, w_bytes);
+	TRACE_LOGI(EPD, "EPD_PART", "[INFO] x_offset=%u bytes, w_bytes=%u", x_offset_bytes, w_bytes);
 
 #ifdef EPD_PART_DEBUG
 	// 打印前 3 行的数据（仅在调试时启用）
@@ -931,25 +1756,22 @@ void EPD_4in26_Display_Part_Stream(UBYTE *full_framebuffer, uint32_t fb_stride,
 		for (int j = 0; j < len && j*2 < 62; j++) {
 			snprintf(hex_str + j*2, 3, "%02X", row_ptr[j]);
 		}
-		ESP_LOGI("EPD_PART", "[DEBUG] Row %d: %s%s", debug_row, hex_str, w_bytes > 8 ? "..." : "");
+		TRACE_LOGI(EPD, "EPD_PART", "[DEBUG] Row %d: %s%s", debug_row, hex_str, w_bytes > 8 ? "..." : "");
 	}
 #endif
 
 	// ============================================
-	// 5. 硬件复位（参考 Arduino 示例）
+	// 5. 仅在冷启动/深度睡眠后复位并初始化，连续局刷不再每次复位
 	// ============================================
-	EPD_4in26_Reset();
-	DEV_Delay_ms(10);
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_MONO);
 
 	// ============================================
 	// 6. 发送 EPD 局部刷新命令序列（参考 Arduino 示例）
 	// ============================================
 
-	EPD_4in26_SendCommand(0x18); // use the internal temperature sensor
-	EPD_4in26_SendData(0x80);
+	EPD_4in26_SetReg(0x18, 0x80);  // use the internal temperature sensor
 
-	EPD_4in26_SendCommand(0x3C); // BorderWavefrom
-	EPD_4in26_SendData(0x80);
+	EPD_4in26_SetReg(0x3C, s_panel->border_partial);  // BorderWavefrom
 
 	// 设置刷新窗口（已对齐的坐标）
 	EPD_4in26_SetWindows(x_aligned, y, x_end, y_end);
@@ -962,12 +1784,8 @@ void EPD_4in26_Display_Part_Stream(UBYTE *full_framebuffer, uint32_t fb_stride,
 	// ============================================
 	// 6. 流式发送：直接从 framebuffer 逐行发送
 	// ============================================
-	for(i=0; i<h_actual; i++)
-	{
-		// 计算当前行在 framebuffer 中的起始位置
-		UBYTE *row_ptr = full_framebuffer + (y + i) * fb_stride + x_offset_bytes;
-		EPD_4in26_SendData2(row_ptr, w_bytes);
-	}
+	EPD_4in26_SendDataRows(full_framebuffer + (UDOUBLE)y * fb_stride + x_offset_bytes,
+	                       fb_stride, w_bytes, h_actual);
 
 	// ============================================
 	// 7. 触发局部刷新显示
@@ -977,82 +1795,18 @@ void EPD_4in26_Display_Part_Stream(UBYTE *full_framebuffer, uint32_t fb_stride,
 
 void EPD_4in26_4GrayDisplay(UBYTE *Image)
 {
-    UDOUBLE i,j,k;
-    UBYTE temp1,temp2,temp3;
+    const UDOUBLE in_stride = EPD_4in26_WIDTH / 4;   // 2bpp => 4 pixels/byte
+    const UWORD out_bytes = EPD_4in26_WIDTH / 8;
+
+    EPD_4in26_4GrayLutInit();
+    EPD_4in26_EnsureMode(EPD_4in26_MODE_4GRAY);
 
     // old  data
     EPD_4in26_SendCommand(0x24);
-    for(i=0; i<48000; i++) {             //5808*4  46464
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01; 
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else //0x40
-                    temp3 |= 0x00; 
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0) 
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) 
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; 
-                else    //0x40
-                    temp3 |= 0x00;	
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
-
-        }
-        EPD_4in26_SendData(temp3);
-    }
+    EPD_4in26_4GrayStreamPlane(Image, in_stride, 0, 0, EPD_4in26_HEIGHT, out_bytes, false);
 
     EPD_4in26_SendCommand(0x26);   //write RAM for black(0)/white (1)
-    for(i=0; i<48000; i++) {             //5808*4  46464
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x00;//white
-                else if(temp2 == 0x00)
-                    temp3 |= 0x01;  //black
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00;  //gray1
-                else //0x40
-                    temp3 |= 0x01; //gray2
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)  //white
-                    temp3 |= 0x00;
-                else if(temp2 == 0x00) //black
-                    temp3 |= 0x01;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00; //gray1
-                else    //0x40
-                    temp3 |= 0x01;	//gray2
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
-        }
-        EPD_4in26_SendData(temp3);
-    }
+    EPD_4in26_4GrayStreamPlane(Image, in_stride, 0, 0, EPD_4in26_HEIGHT, out_bytes, true);
 
     EPD_4in26_TurnOnDisplay_4GRAY();
 }
@@ -1064,6 +1818,7 @@ void EPD_4in26_4GrayDisplay_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD
 	// For safe conversion, x should be 8-pixel aligned and w should be a multiple of 8.
 
 	if (w == 0 || l == 0) return;
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_4GRAY);
 	if (x >= EPD_4in26_WIDTH || y >= EPD_4in26_HEIGHT) return;
 
 	if (x + w > EPD_4in26_WIDTH)  w = EPD_4in26_WIDTH - x;
@@ -1082,41 +1837,69 @@ void EPD_4in26_4GrayDisplay_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD
 	const UWORD in_x_byte = (UWORD)(out_x_byte * 2);        // 8 pixels => 2 bytes in 2bpp
 
 	// Match the partial path's border behavior
-	EPD_4in26_SendCommand(0x3C);
-	EPD_4in26_SendData(0x80);
+	EPD_4in26_SetReg(0x3C, s_panel->border_partial);
 
 	EPD_4in26_SetWindows(x_aligned, y, (UWORD)(x_aligned + w_aligned - 1), (UWORD)(y + l - 1));
 	EPD_4in26_SetCursor(x_aligned, y);
 
+	EPD_4in26_4GrayLutInit();
+
 	// Plane 0x24
 	EPD_4in26_SendCommand(0x24);
-	for (UWORD row = 0; row < l; row++) {
-		const uint32_t base = (uint32_t)(y + row) * (uint32_t)in_stride + (uint32_t)in_x_byte;
-		for (UWORD col = 0; col < out_w_bytes; col++) {
-			const uint32_t idx = base + (uint32_t)col * 2;
-			const UBYTE in0 = Image[idx];
-			const UBYTE in1 = Image[idx + 1];
-			const UBYTE out = EPD_4in26_pack8_2bpp_to_1bpp_plane(in0, in1, false);
-			EPD_4in26_SendData(out);
-		}
-	}
+	EPD_4in26_4GrayStreamPlane(Image, in_stride, in_x_byte, y, l, out_w_bytes, false);
 
 	// Plane 0x26
 	EPD_4in26_SendCommand(0x26);
-	for (UWORD row = 0; row < l; row++) {
-		const uint32_t base = (uint32_t)(y + row) * (uint32_t)in_stride + (uint32_t)in_x_byte;
-		for (UWORD col = 0; col < out_w_bytes; col++) {
-			const uint32_t idx = base + (uint32_t)col * 2;
-			const UBYTE in0 = Image[idx];
-			const UBYTE in1 = Image[idx + 1];
-			const UBYTE out = EPD_4in26_pack8_2bpp_to_1bpp_plane(in0, in1, true);
-			EPD_4in26_SendData(out);
-		}
-	}
+	EPD_4in26_4GrayStreamPlane(Image, in_stride, in_x_byte, y, l, out_w_bytes, true);
 
 	EPD_4in26_TurnOnDisplay_4GRAY_Part();
 }
 
+/******************************************************************************
+function :	4-gray display from two pre-packed 1bpp planes
+parameter:
+    Plane24 : 0x24 平面（每行 EPD_4in26_WIDTH/8 字节），位 = !(灰度 & 1)
+    Plane26 : 0x26 平面，位 = !(灰度 & 2)；灰度 0=黑 1=深灰 2=浅灰 3=白
+info     :  供已按位平面组织的缓冲区（LVGL 灰阶渲染）直接上传，无需 2bpp 中间帧；
+            需先调用 EPD_4in26_Init_4GRAY 加载灰阶波形
+******************************************************************************/
+void EPD_4in26_4GrayDisplay_Planes(const UBYTE *Plane24, const UBYTE *Plane26)
+{
+	const UWORD width = EPD_4in26_WIDTH / 8;
+
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_4GRAY);
+	EPD_4in26_SetWindows(0, EPD_4in26_HEIGHT-1, EPD_4in26_WIDTH-1, 0);
+	EPD_4in26_SetCursor(0, 0);
+
+	EPD_4in26_SendCommand(0x24);
+	EPD_4in26_SendDataRows(Plane24, width, width, EPD_4in26_HEIGHT);
+	EPD_4in26_SendCommand(0x26);
+	EPD_4in26_SendDataRows(Plane26, width, width, EPD_4in26_HEIGHT);
+
+	EPD_4in26_TurnOnDisplay_4GRAY();
+}
+
+/******************************************************************************
+function :	4-gray partial window from two pre-packed 1bpp planes
+parameter:
+    x, y, w, h : EPD 物理坐标窗口（x/w 对齐到 8 像素）
+******************************************************************************/
+void EPD_4in26_4GrayDisplay_PartPlanes(const UBYTE *Plane24, const UBYTE *Plane26,
+									   UWORD x, UWORD y, UWORD w, UWORD h)
+{
+	if (Plane24 == NULL || Plane26 == NULL || w == 0 || h == 0) {
+		return;
+	}
+
+	EPD_4in26_EnsureMode(EPD_4in26_MODE_4GRAY);
+	// Match the partial path's border behavior
+	EPD_4in26_SetReg(0x3C, s_panel->border_partial);
+
+	if (EPD_4in26_LoadPartialWindow(Plane24, Plane26, x, y, w, h, false)) {
+		EPD_4in26_TurnOnDisplay_4GRAY_Part();
+	}
+}
+
 /******************************************************************************
 function :	Enter deep sleep mode (Step 6 in flowchart)
 parameter:
@@ -1128,9 +1911,29 @@ void EPD_4in26_Sleep(void)
 	EPD_4in26_SendCommand(0x10); // Enter deep sleep
 	EPD_4in26_SendData(0x03);    // Deep sleep mode
 	DEV_Delay_ms(100);
+	// 深度睡眠后寄存器与 RAM 内容丢失，下次刷新前需要复位并重新初始化
+	s_prev_hash_valid = false;
+	s_epd_state = EPD_4in26_STATE_SLEEP;
+	s_epd_mode = EPD_4in26_MODE_NONE;
 	// Note: Power OFF handled by hardware if needed
 }
 
+/******************************************************************************
+function :	Enter deep sleep mode 1 between page turns
+info     :  模式 1 保留 RAM：0x24/0x26 中的上一帧仍是局刷的对比基准，
+            下次 Display* 经 EPD_4in26_EnsureMode 复位并重新初始化后可直接局刷
+******************************************************************************/
+void EPD_4in26_Hibernate(void)
+{
+	if (s_epd_state == EPD_4in26_STATE_SLEEP) {
+		return;
+	}
+	EPD_4in26_SendCommand(0x10); // Enter deep sleep
+	EPD_4in26_SendData(0x01);    // Deep sleep mode 1, RAM retained
+	s_epd_state = EPD_4in26_STATE_SLEEP;
+	s_epd_mode = EPD_4in26_MODE_NONE;
+}
+
 /******************************************************************************
 function :	Wake up from deep sleep mode
 parameter:
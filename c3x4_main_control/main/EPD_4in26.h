@@ -32,31 +32,165 @@
 #define __EPD_4in26_H_
 
 #include "DEV_Config.h"
+#include <stdbool.h>
 
 // Display resolution
 #define EPD_4in26_WIDTH       800
 #define EPD_4in26_HEIGHT      480
 
+// 局刷窗口（EPD 物理坐标，x/w 会对齐到 8 像素）
+typedef struct {
+	UWORD x;
+	UWORD y;
+	UWORD w;
+	UWORD h;
+} EPD_4in26_Rect;
+
+// 控制器状态：仅在冷启动或深度睡眠唤醒后才需要复位 + 初始化
+typedef enum {
+	EPD_4in26_STATE_COLD = 0,   // 上电或硬件复位后，尚未初始化
+	EPD_4in26_STATE_READY,      // 已初始化，可直接上传
+	EPD_4in26_STATE_SLEEP       // 深度睡眠（寄存器与 RAM 内容丢失）
+} EPD_4in26_State;
+
+// 已载入的刷新模式
+typedef enum {
+	EPD_4in26_MODE_NONE = 0,
+	EPD_4in26_MODE_MONO,        // Init / Init_Fast（OTP 波形）
+	EPD_4in26_MODE_4GRAY        // Init_4GRAY（RAM LUT）
+} EPD_4in26_Mode;
+
 void EPD_4in26_Init(void);
 void EPD_4in26_Init_Fast(void);
 void EPD_4in26_Init_4GRAY(void);
 void EPD_4in26_Clear(void);
 void EPD_4in26_Clear_Fast(void);
-void EPD_4in26_Display(UBYTE *Image);
+// 返回 false 表示上传被更新的一帧取代、没有启动波形（见 EPD_4in26_SetSupersedeCheck）
+bool EPD_4in26_Display(UBYTE *Image);
 void EPD_4in26_Display_Base(UBYTE *Image);
-void EPD_4in26_Display_Fast(UBYTE *Image);
+bool EPD_4in26_Display_Fast(UBYTE *Image);
+// 只写入 0x24/0x26 RAM、不刷新（开机恢复断电前的画面作为局刷基准）
+void EPD_4in26_LoadFrame(const UBYTE *Image);
 void EPD_4in26_4GrayDisplay(UBYTE *Image);
+
+// 4 灰阶：直接上传两个 1bpp 位平面（整屏 / 窗口），需先 EPD_4in26_Init_4GRAY
+void EPD_4in26_4GrayDisplay_Planes(const UBYTE *Plane24, const UBYTE *Plane26);
+void EPD_4in26_4GrayDisplay_PartPlanes(const UBYTE *Plane24, const UBYTE *Plane26,
+									   UWORD x, UWORD y, UWORD w, UWORD h);
 void EPD_4in26_Sleep(void);
 void EPD_4in26_Wakeup(void);
 
+// 翻页间隙的空闲休眠（深度睡眠模式 1，保留 RAM，局刷基准不丢失）
+void EPD_4in26_Hibernate(void);
+
 // GxEPD2 风格的局部刷新（根据 GxEPD2_426_GDEQ0426T82）
 // 使用 0x22+0xFC 进行快刷局部更新
 void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h);
 
+// 多窗口局刷：依次写入各窗口的 0x24/0x26 数据，最后只触发一次 0x20
+bool EPD_4in26_Display_PartialMulti(UBYTE *Image, const EPD_4in26_Rect *rects, UBYTE count);
+
 // 局部刷新（非流式版本，重构版）
 // 使用独立的数据缓冲区（仅包含要刷新的区域数据）
 // 坐标对齐和参数验证已移入函数内部，简化调用
 void EPD_4in26_Display_Part(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h);
 
+// 启动时探测 EPD 可靠的最高 SPI 写时钟（0x27 RAM 读回校验），返回选定频率
+// 会改写 RAM，调用后需要重新写入整帧
+UDOUBLE EPD_4in26_ProbeSpiClock(void);
+
+// 读取面板内部温度传感器（°C），失败返回 EPD_4in26_TEMP_INVALID
+// 会等待当前刷新结束，只应在刷新任务中调用
+#define EPD_4in26_TEMP_INVALID (-128)
+int EPD_4in26_ReadTemperature(void);
+
+// 波形类型：每种刷新按面板温度从波形表中选择 0x22 控制字、0x1A 温度覆盖和 RAM LUT
+typedef enum {
+	EPD_4in26_WAVE_FULL = 0,
+	EPD_4in26_WAVE_FAST,
+	EPD_4in26_WAVE_PARTIAL,
+	EPD_4in26_WAVE_4GRAY,
+	EPD_4in26_WAVE_COUNT
+} EPD_4in26_Wave;
+
+// 设置波形选择使用的温度（°C）；EPD_4in26_ReadTemperature 成功时自动更新
+void EPD_4in26_SetWaveTemperature(int celsius);
+
+// 夜间模式：之后每次刷新由控制器反相输出 RAM 内容（0x21），RAM 写入保持正常极性。
+// 切换前后两块 RAM 的对比关系不变，局刷看不到变化，切换后必须全刷或快刷一次
+void EPD_4in26_SetInvert(bool invert);
+bool EPD_4in26_GetInvert(void);
+
+// 控制器当前状态 / 已载入模式；Display* 在状态或模式不符时自动重新初始化
+EPD_4in26_State EPD_4in26_GetState(void);
+EPD_4in26_Mode EPD_4in26_GetMode(void);
+
+// 面板描述符（EPD_Panel.h）：初始化序列、地址格式、波形表与能力标志。
+// 默认为 EPD_Panel_GDEQ0426T82；分辨率必须与 EPD_4in26_WIDTH/HEIGHT 一致
+struct EPD_Panel;
+bool EPD_4in26_SetPanel(const struct EPD_Panel *panel);
+const struct EPD_Panel *EPD_4in26_GetPanel(void);
+// cap 为 EPD_PANEL_CAP_* 的组合，全部支持时返回 true
+bool EPD_4in26_HasCap(UBYTE cap);
+
+// 状态或模式不符时立即复位并初始化（按键唤醒后可提前调用，与渲染并行完成）
+void EPD_4in26_EnsureMode(EPD_4in26_Mode mode);
+
+// BUSY 等待（中断 + 任务通知，5 秒超时）
+void EPD_4in26_ReadBusy(void);
+
+// 刷新完成回调：在 BUSY 中断（ISR）上下文中调用，只能使用 FromISR 系列 API
+typedef void (*EPD_4in26_UpdateDoneCb)(void *arg);
+
+// 异步刷新：开启后 Display* 在数据写入控制器 RAM 并启动波形后立即返回，
+// 波形结束时调用 cb；下一条命令发送前会自动等待上一次刷新完成
+void EPD_4in26_SetAsyncUpdate(bool enable, EPD_4in26_UpdateDoneCb cb, void *arg);
+
+// 是否有尚未结束的异步刷新
+bool EPD_4in26_IsBusy(void);
+
+// 波形窗口通知：busy=true 在发出 0x20 的任务中调用，expected_us 为该波形实测的平均
+// BUSY 时长；busy=false 在波形结束时调用（异步模式下在 BUSY 中断中，cb 须放在 IRAM
+// 且只做 ISR 安全的事），expected_us 为这次的实际时长。cb 为 NULL 时取消通知
+typedef void (*EPD_4in26_BusyWindowCb)(bool busy, UDOUBLE expected_us, void *arg);
+void EPD_4in26_SetBusyWindowHook(EPD_4in26_BusyWindowCb cb, void *arg);
+
+// 某种波形的预计 BUSY 时长（us）：典型值起步，之后按每次实测平滑
+UDOUBLE EPD_4in26_GetWaveBusyUs(EPD_4in26_Wave wave);
+
+// 上传取代检查：返回 true 表示已有更新的一帧在等待，正在上传的这一帧不必再显示。
+// 设置后 Display / Display_Fast / Display_PartialMulti 在行突发之间（整帧每
+// EPD_4in26_SUPERSEDE_ROWS 行、局刷每个窗口）和发出 0x20 之前调用它，返回 true 时
+// 停止上传、不启动波形并返回 false。已写完的局刷窗口 0x24/0x26 与行哈希影子一致，
+// 整帧上传中途放弃则影子作废，下一次需整帧写入（或至少重新覆盖这些窗口）。
+// cb 为 NULL 时取消检查；只在持有面板的任务中设置
+typedef bool (*EPD_4in26_SupersededCb)(void *arg);
+void EPD_4in26_SetSupersedeCheck(EPD_4in26_SupersededCb cb, void *arg);
+#define EPD_4in26_SUPERSEDE_ROWS 120
+
+// 等待异步刷新结束（无刷新进行时立即返回）
+void EPD_4in26_WaitIdle(void);
+
+// 整帧上传时全白行累计达到该行数，才改为先自动填充（0x46/0x47）再只上传有内容的行段
+#define EPD_4in26_FILL_MIN_ROWS  48
+// 两段内容之间的全白行少于该值时并为一段，少发一组窗口命令和一次 DMA 启动
+#define EPD_4in26_FILL_GAP_ROWS  8
+
+// 分阶段累计计时（自上次 EPD_4in26_ResetStats 起）
+typedef struct {
+	UDOUBLE upload_us;      // RAM 数据上传（SPI/DMA，含等待传输完成）
+	UDOUBLE upload_bytes;   // 上传字节数
+	UDOUBLE fill_bytes;     // 由 0x46/0x47 自动填充代替、未经 SPI 上传的字节数
+	UDOUBLE busy_us;        // 刷新波形：0x20 发出到 BUSY 变低
+	UDOUBLE updates;        // 0x20 次数
+	UDOUBLE superseded;     // 上传被取代、未发出 0x20 的次数
+} EPD_4in26_Stats;
+
+void EPD_4in26_GetStats(EPD_4in26_Stats *out);
+void EPD_4in26_ResetStats(void);
+
+// 最近一次发出 0x20（波形开始）的时间，esp_timer 微秒；从未刷新时为 0
+int64_t EPD_4in26_GetLastUpdateUs(void);
+
 
 #endif
@@ -0,0 +1,142 @@
+/*****************************************************************************
+* | File      	:   EPD_Panel.c
+* | Function    :   SSD16xx panel descriptor table
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Info        :   初始化序列与 EPD_4in26.c 原先的 Init/Init_Fast/Init_4GRAY 逐条对应
+******************************************************************************/
+#include "EPD_Panel.h"
+#include <string.h>
+
+/******************************************************************************
+ * GDEQ0426T82 / Waveshare 4.26" (SSD1677, 800x480)
+******************************************************************************/
+static const unsigned char LUT_DATA_4Gray[112] =    //112bytes
+{											
+0x80,	0x48,	0x4A,	0x22,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
+0x0A,	0x48,	0x68,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
+0x88,	0x48,	0x60,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
+0xA8,	0x48,	0x45,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
+0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	0x00,	
+0x07,	0x1E,	0x1C,	0x02,	0x00,						
+0x05,	0x01,	0x05,	0x01,	0x02,						
+0x08,	0x01,	0x01,	0x04,	0x04,						
+0x00,	0x02,	0x00,	0x02,	0x01,						
+0x00,	0x00,	0x00,	0x00,	0x00,						
+0x00,	0x00,	0x00,	0x00,	0x00,						
+0x00,	0x00,	0x00,	0x00,	0x00,						
+0x00,	0x00,	0x00,	0x00,	0x00,						
+0x00,	0x00,	0x00,	0x00,	0x00,						
+0x00,	0x00,	0x00,	0x00,	0x01,						
+0x22,	0x22,	0x22,	0x22,	0x22,						
+0x17,	0x41,	0xA8,	0x32,	0x30,						
+0x00,	0x00,	
+};	
+
+// 完整初始化（按官方流程图，含 0x46/0x47 清 RAM，载入 OTP LUT）
+static const UBYTE s_gdeq0426_init_full[] = {
+	EPD_SEQ_RESET,
+	EPD_SEQ_DELAY, 10,
+	EPD_SEQ_BUSY,
+	0x12, 0,                              // SWRESET
+	EPD_SEQ_BUSY,
+	EPD_SEQ_DELAY, 10,
+	EPD_SEQ_CLEAR_RAM,
+	0x01, 3, 0xDF, 0x01, 0x02,            // Driver output control: 480 gates
+	0x11, 1, 0x01,                        // Data entry mode: x+ y-
+	EPD_SEQ_WINDOW,
+	0x3C, 1, 0x01,                        // Border
+	0x0C, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0x80, // Soft start
+	0x18, 1, 0x80,                        // Internal temperature sensor
+	0x22, 1, 0xB1,                        // Load LUT from OTP
+	0x20, 0,
+	EPD_SEQ_BUSY,
+	EPD_SEQ_WINDOW,
+	EPD_SEQ_END
+};
+
+// 单色快速初始化（局刷/快刷共用）
+static const UBYTE s_gdeq0426_init_mono[] = {
+	EPD_SEQ_RESET,
+	EPD_SEQ_DELAY, 100,
+	EPD_SEQ_BUSY,
+	0x12, 0,                              // SWRESET
+	EPD_SEQ_BUSY,
+	0x18, 1, 0x80,                        // Internal temperature sensor
+	0x0C, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0x80, // Soft start
+	0x01, 3, 0xDF, 0x01, 0x02,            // Driver output control: 480 gates
+	0x3C, 1, 0x01,                        // Border
+	0x11, 1, 0x01,                        // Data entry mode: x+ y-
+	EPD_SEQ_WINDOW,
+	0x1A, 1, 0x5A,                        // 快刷温度补偿
+	0x22, 1, 0xB1,                        // Load LUT from OTP
+	0x20, 0,
+	EPD_SEQ_BUSY,
+	EPD_SEQ_END
+};
+
+// 4 灰阶初始化（RAM LUT 由波形表 WAVE_4GRAY 载入）
+static const UBYTE s_gdeq0426_init_gray[] = {
+	EPD_SEQ_RESET,
+	EPD_SEQ_DELAY, 100,
+	EPD_SEQ_BUSY,
+	0x12, 0,                              // SWRESET
+	EPD_SEQ_BUSY,
+	0x18, 1, 0x80,                        // Internal temperature sensor
+	0x0C, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0x80, // Soft start
+	0x01, 3, 0x1F, 0x03, 0x02,            // Driver output control（沿用原厂 4 灰阶示例的取值）
+	0x3C, 1, 0x01,                        // Border
+	0x11, 1, 0x01,                        // Data entry mode: x+ y-
+	EPD_SEQ_WINDOW,
+	EPD_SEQ_BUSY,
+	EPD_SEQ_END
+};
+
+const EPD_Panel EPD_Panel_GDEQ0426T82 = {
+	.name = "GDEQ0426T82",
+	.width = 800,
+	.height = 480,
+	.x_addr_shift = 0,
+	.border_partial = 0x80,
+	.caps = EPD_PANEL_CAP_PARTIAL | EPD_PANEL_CAP_FAST | EPD_PANEL_CAP_4GRAY,
+	.init_full = s_gdeq0426_init_full,
+	.init_mono = s_gdeq0426_init_mono,
+	.init_gray = s_gdeq0426_init_gray,
+	// 室温下局刷/快刷沿用 0x1A=0x5A 的短波形；低温时不再覆盖温度，
+	// 使用与实际温度匹配的 OTP 波形，避免残影和对比度不足
+	.waves = {
+		[EPD_4in26_WAVE_FULL] = {
+			{ EPD_WAVE_ANY_TEMP, 0xF7, 0x00, NULL },
+		},
+		[EPD_4in26_WAVE_FAST] = {
+			{ 9,                 0xF7, 0x00, NULL },   // 低温：退回完整波形
+			{ EPD_WAVE_ANY_TEMP, 0xD7, 0x5A, NULL },
+		},
+		[EPD_4in26_WAVE_PARTIAL] = {
+			{ 14,                0xFC, 0x00, NULL },   // 低温：按实测温度选择局刷波形
+			{ EPD_WAVE_ANY_TEMP, 0xFC, 0x5A, NULL },
+		},
+		[EPD_4in26_WAVE_4GRAY] = {
+			{ EPD_WAVE_ANY_TEMP, 0xC7, 0x00, LUT_DATA_4Gray },
+		},
+	},
+};
+
+/******************************************************************************
+ * Descriptor table
+******************************************************************************/
+const EPD_Panel *const EPD_Panel_Table[] = {
+	&EPD_Panel_GDEQ0426T82,
+};
+const UBYTE EPD_Panel_Count = sizeof(EPD_Panel_Table) / sizeof(EPD_Panel_Table[0]);
+
+const EPD_Panel *EPD_Panel_Find(const char *name)
+{
+	for (UBYTE i = 0; i < EPD_Panel_Count; i++) {
+		if (strcmp(EPD_Panel_Table[i]->name, name) == 0) {
+			return EPD_Panel_Table[i];
+		}
+	}
+	return NULL;
+}
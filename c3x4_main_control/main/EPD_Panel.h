@@ -0,0 +1,68 @@
+/*****************************************************************************
+* | File      	:   EPD_Panel.h
+* | Function    :   SSD16xx panel descriptors for the EPD_4in26 driver engine
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Info        :
+*   驱动引擎（EPD_4in26.c）只实现 SSD16xx 系列通用的命令流程：DMA 上传、BUSY 中断、
+*   窗口/多窗口局刷、波形表选择、状态机与寄存器缓存。各面板的差异集中在描述符中：
+*     - 分辨率与 RAM 地址格式（X 地址按像素还是按字节）
+*     - 初始化序列（字节码，见 EPD_SEQ_*）
+*     - 每种刷新的温度分段波形（0x22 控制字、0x1A 温度覆盖、RAM LUT）
+*     - 能力标志（局刷、快刷、4 灰阶）
+*   新增面板只需添加一个描述符并加入 EPD_Panel_Table；分辨率与编译期帧缓冲
+*   （EPD_4in26_WIDTH/HEIGHT）一致时可在运行时用 EPD_4in26_SetPanel 切换
+******************************************************************************/
+#ifndef __EPD_PANEL_H_
+#define __EPD_PANEL_H_
+
+#include "EPD_4in26.h"
+
+// 初始化序列字节码：普通条目为 cmd, n, data[n]；以下操作码不是 SSD16xx 命令
+#define EPD_SEQ_END        0xFF   // 序列结束
+#define EPD_SEQ_BUSY       0xFE   // 等待 BUSY
+#define EPD_SEQ_DELAY      0xFD   // 延时，后跟 1 字节毫秒数
+#define EPD_SEQ_RESET      0xFC   // 硬件复位
+#define EPD_SEQ_WINDOW     0xFB   // 整屏窗口 + 光标归零（按描述符的地址格式）
+#define EPD_SEQ_CLEAR_RAM  0xFA   // 0x46/0x47 自动填充两个 RAM
+
+// 能力标志
+#define EPD_PANEL_CAP_PARTIAL  0x01   // 窗口局刷（显示模式 2）
+#define EPD_PANEL_CAP_FAST     0x02   // 快刷波形
+#define EPD_PANEL_CAP_4GRAY    0x04   // 4 灰阶（init_gray + WAVE_4GRAY）
+
+// 波形条目：按温度上限升序排列，刷新前选第一条满足的
+typedef struct {
+	int8_t max_temp;              // 适用温度上限（°C，含）
+	UBYTE ctrl;                   // 0x22 控制字；0 表示未使用的条目
+	UBYTE temp_reg;               // 写入 0x1A 的温度覆盖，0 表示不覆盖
+	const unsigned char *lut;     // RAM 波形表（NULL = OTP），ctrl 不能带 0x10
+} EPD_WaveEntry;
+
+#define EPD_WAVE_MAX_BANDS 3
+#define EPD_WAVE_ANY_TEMP  127
+
+typedef struct EPD_Panel {
+	const char *name;
+	UWORD width;                  // RAM X 方向像素数
+	UWORD height;                 // RAM Y 方向行数
+	UBYTE x_addr_shift;           // 0x44/0x4E 的 X 地址单位：0 = 像素（SSD1677），3 = 字节（SSD1680/1681）
+	UBYTE border_partial;         // 局刷时写入 0x3C 的值
+	UBYTE caps;                   // EPD_PANEL_CAP_*
+	const UBYTE *init_full;       // EPD_4in26_Init：完整流程（含清 RAM）
+	const UBYTE *init_mono;       // EPD_4in26_Init_Fast：单色快速初始化
+	const UBYTE *init_gray;       // EPD_4in26_Init_4GRAY（不支持为 NULL）
+	EPD_WaveEntry waves[EPD_4in26_WAVE_COUNT][EPD_WAVE_MAX_BANDS];
+} EPD_Panel;
+
+// 主固件使用的面板（Xteink X4：GDEQ0426T82，SSD1677，800x480）
+extern const EPD_Panel EPD_Panel_GDEQ0426T82;
+
+// 所有已知描述符，供按名称查找
+extern const EPD_Panel *const EPD_Panel_Table[];
+extern const UBYTE EPD_Panel_Count;
+
+const EPD_Panel *EPD_Panel_Find(const char *name);
+
+#endif
@@ -78,6 +78,7 @@
 #include "GUI_Paint.h"
 #include "DEV_Config.h"
 #include "Debug.h"
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h> //memset()
@@ -85,6 +86,235 @@
 
 PAINT Paint;
 
+#ifdef PAINT_FIXED_ROTATE
+#define PAINT_ROTATE PAINT_FIXED_ROTATE
+#else
+#define PAINT_ROTATE Paint.Rotate
+#endif
+
+// Hashed lookup for cFONT tables (table index + 1, 0 = empty slot)
+#define PAINT_CN_HASH_SLOTS 512
+
+static const cFONT *CN_HashFont = NULL;
+static UWORD CN_HashSlots[PAINT_CN_HASH_SLOTS];
+
+/******************************************************************************
+function: Map a logical point to image memory (rotation, then mirroring)
+******************************************************************************/
+static inline void Paint_MapPoint(UWORD Xpoint, UWORD Ypoint, UWORD *X, UWORD *Y)
+{
+    switch(PAINT_ROTATE) {
+    case 0:
+        *X = Xpoint;
+        *Y = Ypoint;
+        break;
+    case 90:
+        *X = Paint.WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
+        break;
+    case 180:
+        *X = Paint.WidthMemory - Xpoint - 1;
+        *Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    default:    // 270
+        *X = Ypoint;
+        *Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    }
+    if(Paint.Mirror & MIRROR_HORIZONTAL)
+        *X = Paint.WidthMemory - *X - 1;
+    if(Paint.Mirror & MIRROR_VERTICAL)
+        *Y = Paint.HeightMemory - *Y - 1;
+}
+
+/******************************************************************************
+function: Memory steps of a logical step
+parameter:
+    xX, xY : memory (X, Y) change for logical X + 1
+    yX, yY : memory (X, Y) change for logical Y + 1
+info:
+    Each logical axis lands on exactly one memory axis, so the inverse is the
+    transpose: memory X + 1 moves the logical point by (xX, yX).
+******************************************************************************/
+static inline void Paint_MapSteps(int *xX, int *xY, int *yX, int *yY)
+{
+    switch(PAINT_ROTATE) {
+    case 0:   *xX = 1;  *xY = 0;  *yX = 0;  *yY = 1;  break;
+    case 90:  *xX = 0;  *xY = 1;  *yX = -1; *yY = 0;  break;
+    case 180: *xX = -1; *xY = 0;  *yX = 0;  *yY = -1; break;
+    default:  *xX = 0;  *xY = -1; *yX = 1;  *yY = 0;  break;    // 270
+    }
+    if(Paint.Mirror & MIRROR_HORIZONTAL) {
+        *xX = -*xX;
+        *yX = -*yX;
+    }
+    if(Paint.Mirror & MIRROR_VERTICAL) {
+        *xY = -*xY;
+        *yY = -*yY;
+    }
+}
+
+// Paint `white` into the `cover` pixels of one 1bpp byte (1 = white)
+static inline void Paint_PutByte(UBYTE *p, UBYTE cover, UBYTE white)
+{
+    *p = (*p & ~cover) | (white & cover);
+}
+
+/******************************************************************************
+function: Fill a rectangle of image memory (1bpp, inclusive corners)
+info:
+    Whole bytes of each row are set with memset, only the two edge bytes are
+    masked.
+******************************************************************************/
+static void Paint_FillMemRect(UWORD X1, UWORD Y1, UWORD X2, UWORD Y2, UWORD Color)
+{
+    const UBYTE fill = (Color == BLACK) ? 0x00 : 0xFF;
+    const UWORD b1 = X1 / 8, b2 = X2 / 8;
+    const UBYTE m1 = 0xFF >> (X1 % 8);
+    const UBYTE m2 = 0xFF << (7 - X2 % 8);
+    for (UWORD Y = Y1; Y <= Y2; Y++) {
+        UBYTE *row = Paint.Image + (UDOUBLE)Y * Paint.WidthByte;
+        if (b1 == b2) {
+            Paint_PutByte(row + b1, m1 & m2, fill);
+            continue;
+        }
+        Paint_PutByte(row + b1, m1, fill);
+        if (b2 > b1 + 1)
+            memset(row + b1 + 1, fill, b2 - b1 - 1);
+        Paint_PutByte(row + b2, m2, fill);
+    }
+}
+
+/******************************************************************************
+function: Fill a logical rectangle (inclusive corners, clipped to the image)
+******************************************************************************/
+static void Paint_FillRect(int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    if (Xstart < 0) Xstart = 0;
+    if (Ystart < 0) Ystart = 0;
+    if (Xend > Paint.Width - 1) Xend = Paint.Width - 1;
+    if (Yend > Paint.Height - 1) Yend = Paint.Height - 1;
+    if (Xstart > Xend || Ystart > Yend)
+        return;
+    UWORD X1, Y1, X2, Y2;
+    Paint_MapPoint(Xstart, Ystart, &X1, &Y1);
+    Paint_MapPoint(Xend, Yend, &X2, &Y2);
+    Paint_FillMemRect(X1 < X2 ? X1 : X2, Y1 < Y2 ? Y1 : Y2,
+                      X1 < X2 ? X2 : X1, Y1 < Y2 ? Y2 : Y1, Color);
+}
+
+/******************************************************************************
+function: Draw a 1bpp bitmap (MSB first, rows padded to whole bytes)
+parameter:
+    Xpoint, Ypoint   : top-left logical position
+    Bits, Width, Height : the bitmap
+    Color_Foreground : color of set bits
+    Color_Background : color of clear bits; FONT_BACKGROUND leaves them as is
+info:
+    Walks image memory row by row over the bitmap's rotated footprint and
+    collects 8 pixels per store, so a 270-degree glyph costs the same as an
+    upright one.
+******************************************************************************/
+static void Paint_BlitBits(UWORD Xpoint, UWORD Ypoint, const UBYTE *Bits, UWORD Width,
+                           UWORD Height, UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xpoint >= Paint.Width || Ypoint >= Paint.Height || Width == 0 || Height == 0)
+        return;
+    const UWORD stride = (Width + 7) / 8;
+    const UWORD w = (Width < Paint.Width - Xpoint) ? Width : Paint.Width - Xpoint;
+    const UWORD h = (Height < Paint.Height - Ypoint) ? Height : Paint.Height - Ypoint;
+    const bool opaque = (Color_Background != FONT_BACKGROUND);
+    const UBYTE fg = (Color_Foreground == BLACK) ? 0x00 : 0xFF;
+    const UBYTE bg = (Color_Background == BLACK) ? 0x00 : 0xFF;
+
+    int xX, xY, yX, yY;
+    Paint_MapSteps(&xX, &xY, &yX, &yY);
+    UWORD OX, OY, EX, EY;
+    Paint_MapPoint(Xpoint, Ypoint, &OX, &OY);
+    Paint_MapPoint(Xpoint + w - 1, Ypoint + h - 1, &EX, &EY);
+    const UWORD X1 = OX < EX ? OX : EX, X2 = OX < EX ? EX : OX;
+    const UWORD Y1 = OY < EY ? OY : EY, Y2 = OY < EY ? EY : OY;
+
+    // Bitmap (column, row) at memory (X1, Y1)
+    const int i0 = xX * (X1 - OX) + xY * (Y1 - OY);
+    const int j0 = yX * (X1 - OX) + yY * (Y1 - OY);
+    for (UWORD Y = Y1; Y <= Y2; Y++) {
+        const int dy = Y - Y1;
+        int i = i0 + xY * dy, j = j0 + yY * dy;
+        UBYTE *p = Paint.Image + (UDOUBLE)Y * Paint.WidthByte + X1 / 8;
+        UBYTE mask = 0x80 >> (X1 % 8), cover = 0, set = 0;
+        for (UWORD X = X1; X <= X2; X++) {
+            if (Bits[j * stride + i / 8] & (0x80 >> (i % 8)))
+                set |= mask;
+            cover |= mask;
+            i += xX;
+            j += yX;
+            mask >>= 1;
+            if (mask == 0 || X == X2) {
+                if (opaque)
+                    Paint_PutByte(p, cover, (fg & set) | (bg & ~set));
+                else
+                    Paint_PutByte(p, set, fg);
+                p++;
+                mask = 0x80;
+                cover = set = 0;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+function: Find a character in a cFONT table
+parameter:
+    c0, c1 : the character (c1 is ignored for ASCII)
+info:
+    The table is hashed on first use and re-hashed when another font is used;
+    tables too large for the slot array fall back to the linear scan.
+******************************************************************************/
+static inline UWORD CN_Key(UBYTE c0, UBYTE c1)
+{
+    return (c0 <= 0x7F) ? c0 : (UWORD)(c0 | (c1 << 8));
+}
+
+static inline UWORD CN_Slot(UWORD key)
+{
+    return (UWORD)((key * 40503u) >> 7) & (PAINT_CN_HASH_SLOTS - 1);
+}
+
+static const CH_CN *Paint_FindCN(const cFONT *font, UBYTE c0, UBYTE c1)
+{
+    const UWORD key = CN_Key(c0, c1);
+    if (font->size <= PAINT_CN_HASH_SLOTS * 3 / 4) {
+        if (CN_HashFont != font) {
+            memset(CN_HashSlots, 0, sizeof(CN_HashSlots));
+            for (UWORD Num = 0; Num < font->size; Num++) {
+                const UWORD k = CN_Key(font->table[Num].index[0], font->table[Num].index[1]);
+                UWORD slot = CN_Slot(k);
+                while (CN_HashSlots[slot] != 0 &&
+                       CN_Key(font->table[CN_HashSlots[slot] - 1].index[0],
+                              font->table[CN_HashSlots[slot] - 1].index[1]) != k) {
+                    slot = (slot + 1) & (PAINT_CN_HASH_SLOTS - 1);
+                }
+                if (CN_HashSlots[slot] == 0)    // first entry wins, as in the scan
+                    CN_HashSlots[slot] = Num + 1;
+            }
+            CN_HashFont = font;
+        }
+        for (UWORD slot = CN_Slot(key); CN_HashSlots[slot] != 0;
+             slot = (slot + 1) & (PAINT_CN_HASH_SLOTS - 1)) {
+            const CH_CN *ch = &font->table[CN_HashSlots[slot] - 1];
+            if (CN_Key(ch->index[0], ch->index[1]) == key)
+                return ch;
+        }
+        return NULL;
+    }
+    for (UWORD Num = 0; Num < font->size; Num++) {
+        if (CN_Key(font->table[Num].index[0], font->table[Num].index[1]) == key)
+            return &font->table[Num];
+    }
+    return NULL;
+}
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -107,6 +337,12 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
 //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
+#ifdef PAINT_FIXED_ROTATE
+    if(Rotate != PAINT_FIXED_ROTATE) {
+        Debug("rotate fixed to %d at build time\r\n", PAINT_FIXED_ROTATE);
+    }
+    Rotate = PAINT_FIXED_ROTATE;
+#endif
     Paint.Rotate = Rotate;
     Paint.Mirror = MIRROR_NONE;
     
@@ -136,6 +372,12 @@ parameter:
 ******************************************************************************/
 void Paint_SetRotate(UWORD Rotate)
 {
+#ifdef PAINT_FIXED_ROTATE
+    if(Rotate != PAINT_FIXED_ROTATE) {
+        Debug("rotate fixed to %d at build time\r\n", PAINT_FIXED_ROTATE);
+        return;
+    }
+#endif
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         Debug("Set image Rotate %d\r\n", Rotate);
         Paint.Rotate = Rotate;
@@ -193,43 +435,7 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
         return;
     }      
     UWORD X, Y;
-    switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return;
-    }
+    Paint_MapPoint(Xpoint, Ypoint, &X, &Y);
 
     if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
         Debug("Exceeding display boundaries\r\n");
@@ -265,12 +471,7 @@ parameter:
 void Paint_Clear(UWORD Color)
 {	
 	if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}		
+		memset(Paint.Image, Color, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
     }else if(Paint.Scale == 4) {
         for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
 			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
@@ -299,6 +500,10 @@ parameter:
 ******************************************************************************/
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
+    if(Paint.Scale == 2) {
+        Paint_FillRect(Xstart, Ystart, (int)Xend - 1, (int)Yend - 1, Color);
+        return;
+    }
     UWORD X, Y;
     for (Y = Ystart; Y < Yend; Y++) {
         for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
@@ -362,6 +567,16 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
         return;
     }
 
+    // Straight 1-pixel lines are spans: byte fills instead of points.
+    // Paint_DrawPoint puts a 1x1 point one pixel up and left, so does the span.
+    if (Paint.Scale == 2 && Line_width == DOT_PIXEL_1X1 && Line_Style == LINE_STYLE_SOLID &&
+        (Xstart == Xend || Ystart == Yend)) {
+        Paint_FillRect((Xstart < Xend ? Xstart : Xend) - 1, (Ystart < Yend ? Ystart : Yend) - 1,
+                       (Xstart < Xend ? Xend : Xstart) - 1, (Ystart < Yend ? Yend : Ystart) - 1,
+                       Color);
+        return;
+    }
+
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
     int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
@@ -420,7 +635,10 @@ void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
         return;
     }
 
-    if (Draw_Fill) {
+    if (Draw_Fill && Paint.Scale == 2 && Line_width == DOT_PIXEL_1X1) {
+        // Same pixels as the row-by-row lines below (points sit one up and left)
+        Paint_FillRect((int)Xstart - 1, (int)Ystart - 1, (int)Xend - 1, (int)Yend - 2, Color);
+    } else if (Draw_Fill) {
         UWORD Ypoint;
         for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
             Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
@@ -526,6 +744,11 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
+    if (Paint.Scale == 2) {
+        Paint_BlitBits(Xpoint, Ypoint, ptr, Font->Width, Font->Height, Color_Foreground, Color_Background);
+        return;
+    }
+
     for (Page = 0; Page < Font->Height; Page ++ ) {
         for (Column = 0; Column < Font->Width; Column ++ ) {
 
@@ -610,85 +833,41 @@ parameter:
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
                         UWORD Color_Foreground, UWORD Color_Background)
 {
-    const char* p_text = pString;
+    const UBYTE* p_text = (const UBYTE*)pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
+    int i, j;
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
+        const bool ascii = (*p_text <= 0x7F);
+        if (!ascii && p_text[1] == 0)   // truncated double-byte character
+            break;
+        const CH_CN *ch = Paint_FindCN(font, p_text[0], ascii ? 0 : p_text[1]);
+        if (ch != NULL && Paint.Scale == 2) {
+            Paint_BlitBits(x, y, (const UBYTE*)ch->matrix, font->Width, font->Height,
+                           Color_Foreground, Color_Background);
+        } else if (ch != NULL) {
+            const char* ptr = &ch->matrix[0];
+
+            for (j = 0; j < font->Height; j++) {
+                for (i = 0; i < font->Width; i++) {
+                    if (*ptr & (0x80 >> (i % 8))) {
+                        Paint_SetPixel(x + i, y + j, Color_Foreground);
+                    } else if (FONT_BACKGROUND != Color_Background) {
+                        Paint_SetPixel(x + i, y + j, Color_Background);
                     }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
+                    if (i % 8 == 7) {
+                        ptr++;
                     }
-                    break;
+                }
+                if (font->Width % 8 != 0) {
+                    ptr++;
                 }
             }
-            /* Point on the next character */
-            p_text += 2;
-            /* Decrement the column position by 16 */
-            x += font->Width;
         }
+        /* Point on the next character */
+        p_text += ascii ? 1 : 2;
+        x += ascii ? font->ASCII_Width : font->Width;
     }
 }
 
@@ -833,13 +1012,5 @@ info:
 ******************************************************************************/
 void Paint_DrawBitMap(const unsigned char* image_buffer)
 {
-    UWORD x, y;
-    UDOUBLE Addr = 0;
-
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
-        }
-    }
+    memcpy(Paint.Image, image_buffer, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
 }
@@ -99,6 +99,14 @@ extern PAINT Paint;
 #define ROTATE_180          180
 #define ROTATE_270          270
 
+/**
+ * Fixed rotation (compile time)
+ * Define PAINT_FIXED_ROTATE (0/90/180/270) to build the coordinate mapping for
+ * that rotation only: the per-pixel rotate switch folds into constants and
+ * Paint_NewImage()/Paint_SetRotate() keep the fixed value. Leave it undefined
+ * to select the rotation at runtime.
+**/
+
 /**
  * Display Flip
 **/
@@ -0,0 +1,149 @@
+/**
+ * @file battery.c
+ * @brief 电池服务实现：与按键共用的 ADC 转换序列中取电池通道，低频滤波后发布
+ */
+
+#include "battery.h"
+#include "buttons.h"
+#include "stack_stats.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "BAT";
+
+#define BATTERY_TASK_STACK      2560
+#define BATTERY_TASK_PRIO       2
+#define BATTERY_SAMPLE_WAIT_MS  50     // 等按键任务读完一帧新转换结果的上限
+#define FILTER_SHIFT            4      // 滤波值保留 4 位小数（mV * 16）
+
+// 典型单节锂离子电池的放电曲线（小电流、静置电压），两点之间线性插值
+typedef struct {
+    uint16_t mv;
+    uint8_t pct;
+} discharge_point_t;
+
+static const discharge_point_t s_curve[] = {
+    {3000, 0},  {3300, 2},  {3500, 5},  {3600, 10}, {3700, 20},
+    {3750, 30}, {3790, 40}, {3830, 50}, {3870, 60}, {3920, 70},
+    {3980, 80}, {4060, 90}, {4200, 100},
+};
+#define CURVE_POINTS (sizeof(s_curve) / sizeof(s_curve[0]))
+
+static battery_config_t s_cfg;
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static battery_status_t s_status;   // 发布的结果，经 s_mux 读写
+static uint32_t s_filtered_q = 0;   // 滤波值（mV << FILTER_SHIFT），只在采样任务中访问
+static bool s_filter_charging = false;
+
+static bool read_charging(void) {
+    return s_cfg.charge_gpio != GPIO_NUM_NC && gpio_get_level(s_cfg.charge_gpio) == 1;
+}
+
+uint32_t battery_read_mv(void) {
+    // 先要一帧新的转换结果，电池值是这一帧里所有电池通道结果的平均
+    buttons_sample(BATTERY_SAMPLE_WAIT_MS);
+    int adc_raw = buttons_battery_raw();
+    if (adc_raw < 0) {
+        adc_raw = 0;
+    }
+
+    int voltage = adc_raw;
+    if (s_cfg.cali != NULL) {
+        adc_cali_raw_to_voltage(s_cfg.cali, adc_raw, &voltage);
+    } else {
+        // 未校准时的近似值: ADC值 * 1.1mV * 2 (分压系数)
+        voltage = (adc_raw * 1100) / 2048 * 2;
+    }
+
+    // 分压系数: Xteink X4 使用电阻分压，实际电压需要乘以系数
+    // 通常分压比为 2:1，所以实际电压 = ADC电压 * 2
+    return (uint32_t)voltage * 2;
+}
+
+uint8_t battery_mv_to_pct(uint32_t mv) {
+    if (mv <= s_curve[0].mv) {
+        return s_curve[0].pct;
+    }
+    for (size_t i = 1; i < CURVE_POINTS; i++) {
+        const discharge_point_t *hi = &s_curve[i];
+        if (mv < hi->mv) {
+            const discharge_point_t *lo = &s_curve[i - 1];
+            return (uint8_t)(lo->pct + (mv - lo->mv) * (hi->pct - lo->pct) / (hi->mv - lo->mv));
+        }
+    }
+    return s_curve[CURVE_POINTS - 1].pct;
+}
+
+// 取一个样本并滤波；插拔 USB 时电压跳变，滤波从新样本重新开始
+static uint32_t filter_sample(bool charging) {
+    const uint32_t sample_q = battery_read_mv() << FILTER_SHIFT;
+    if (s_filtered_q == 0 || charging != s_filter_charging) {
+        s_filtered_q = sample_q;
+        s_filter_charging = charging;
+    } else {
+        s_filtered_q = (uint32_t)((int32_t)s_filtered_q +
+                                  ((int32_t)sample_q - (int32_t)s_filtered_q) / BATTERY_FILTER_DIV);
+    }
+    return s_filtered_q >> FILTER_SHIFT;
+}
+
+// 显示的值变化时才发布
+static void publish(uint32_t mv, bool charging) {
+    const uint8_t pct = battery_mv_to_pct(mv);
+    bool changed;
+    portENTER_CRITICAL(&s_mux);
+    const uint32_t diff = mv > s_status.mv ? mv - s_status.mv : s_status.mv - mv;
+    changed = s_status.seq == 0 || pct != s_status.pct || charging != s_status.charging ||
+              diff >= BATTERY_PUBLISH_MV;
+    if (changed) {
+        s_status.mv = mv;
+        s_status.pct = pct;
+        s_status.charging = charging;
+        s_status.seq++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (changed) {
+        ESP_LOGI(TAG, "Battery: %lu mV, %u%%%s", (unsigned long)mv, pct,
+                 charging ? " (charging)" : "");
+    }
+}
+
+static void battery_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("battery", BATTERY_TASK_STACK);
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(s_cfg.period_ms));
+        const bool charging = read_charging();
+        publish(filter_sample(charging), charging);
+    }
+}
+
+bool battery_init(const battery_config_t *cfg) {
+    s_cfg = *cfg;
+    if (s_cfg.period_ms == 0) {
+        s_cfg.period_ms = BATTERY_PERIOD_MS_DEFAULT;
+    }
+    if (s_cfg.charge_gpio != GPIO_NUM_NC) {
+        gpio_set_direction(s_cfg.charge_gpio, GPIO_MODE_INPUT);
+    }
+
+    const bool charging = read_charging();
+    publish(filter_sample(charging), charging);
+
+    if (xTaskCreate(battery_task, "battery", BATTERY_TASK_STACK, NULL, BATTERY_TASK_PRIO, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create battery task");
+        return false;
+    }
+    return true;
+}
+
+void battery_get(battery_status_t *out) {
+    portENTER_CRITICAL(&s_mux);
+    *out = s_status;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+bool battery_is_critical(const battery_status_t *st) {
+    return !st->charging && st->mv >= BATTERY_VALID_MIN_MV && st->mv < BATTERY_CRITICAL_MV;
+}
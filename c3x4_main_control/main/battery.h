@@ -0,0 +1,64 @@
+/**
+ * @file battery.h
+ * @brief 电池服务：低频采样、指数滤波、锂电放电曲线换算，缓存结果供界面免费读取
+ *
+ * 电池分压与按键在同一个 ADC 连续转换序列中（buttons.c）。服务任务每 period_ms
+ * 请求一帧新的转换结果，取其中电池通道的平均值换算成电压，经指数滤波后按
+ * 放电曲线查表得到百分比。只有显示的值变化时（百分比、充电状态变化，或电压
+ * 偏离上次发布超过 BATTERY_PUBLISH_MV）才更新发布的结果并把序号加一，界面
+ * 比较序号决定是否重绘，读取不访问 ADC
+ */
+
+#ifndef BATTERY_H
+#define BATTERY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "esp_adc/adc_cali.h"
+
+#define BATTERY_PERIOD_MS_DEFAULT 10000  // 采样周期
+#define BATTERY_FILTER_DIV        4      // 指数滤波：每次向新样本靠近 1/4
+#define BATTERY_PUBLISH_MV        20     // 电压变化超过此值才重新发布
+#define BATTERY_CRITICAL_MV       3300   // 低于此电压（未充电）显示低电量画面并关机
+#define BATTERY_VALID_MIN_MV      2500   // 低于此值视为分压未接/读数异常，不触发关机
+
+typedef struct {
+    adc_cali_handle_t cali;   // ADC 校准句柄，NULL 时按近似系数换算
+    gpio_num_t charge_gpio;   // USB 检测，高电平表示正在充电（GPIO_NUM_NC 表示没有）
+    uint32_t period_ms;       // 采样周期，0 使用 BATTERY_PERIOD_MS_DEFAULT
+} battery_config_t;
+
+typedef struct {
+    uint32_t mv;              // 滤波后的电池电压
+    uint8_t pct;              // 按放电曲线换算的电量
+    bool charging;
+    uint32_t seq;             // 发布序号：上面的值每变化一次加一
+} battery_status_t;
+
+/**
+ * @brief 同步采样一次作为滤波初值，然后启动采样任务（buttons_init 之后调用）
+ */
+bool battery_init(const battery_config_t *cfg);
+
+/**
+ * @brief 最近发布的结果（不访问 ADC）
+ */
+void battery_get(battery_status_t *out);
+
+/**
+ * @brief 电量是否已到必须关机的程度：未充电且电压在 [BATTERY_VALID_MIN_MV, BATTERY_CRITICAL_MV)
+ */
+bool battery_is_critical(const battery_status_t *st);
+
+/**
+ * @brief 同步读取一帧的电池电压，不经过滤波、不发布（电源轨稳定检测用）
+ */
+uint32_t battery_read_mv(void);
+
+/**
+ * @brief 锂电池放电曲线：电压换算为电量百分比（分段线性插值）
+ */
+uint8_t battery_mv_to_pct(uint32_t mv);
+
+#endif // BATTERY_H
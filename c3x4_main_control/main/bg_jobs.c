@@ -0,0 +1,355 @@
+/**
+ * @file bg_jobs.c
+ * @brief 后台作业调度实现，见 bg_jobs.h
+ *
+ * 作业放在固定大小的槽数组里（不分配内存）。挑选时按 (优先级, 序号) 取最小的可运行
+ * 作业，每跑完一步序号移到队尾，同级作业轮流前进。队列状态由一个自旋锁保护，
+ * 作业的步函数和 done 回调都在锁外运行。EPD 波形窗口只是两个标志（结束在 BUSY
+ * 中断里清除），挑选时把非 CPU 作业当作推迟到窗口预计结束
+ */
+
+#include "bg_jobs.h"
+#include "stack_stats.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+static const char *TAG = "BG_JOBS";
+
+#define BG_JOBS_DEFER_MAX 20   // 连续推迟这么多次（约 10 秒）仍没有内存就放弃
+
+struct bg_job {
+    bg_job_id_t id;            // BG_JOB_NONE：空槽
+    bg_job_desc_t desc;
+    uint32_t seq;              // 同级内的先后（提交时与每跑完一步时取新值）
+    uint32_t held;             // bg_job_alloc 当前持有的字节数
+    TickType_t retry_tick;     // 推迟中：此时之后再尝试开始
+    uint8_t defers;            // 连续推迟次数
+    volatile bool cancelled;
+    bool started;              // 已通过内存预算检查
+    bool running;              // 工作任务正在执行它的一步
+};
+
+static bg_job_t s_jobs[BG_JOBS_MAX];
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_task = NULL;
+static bool s_task_creating = false;
+static bg_job_id_t s_next_id = 1;
+static uint32_t s_seq = 0;
+static bg_jobs_stats_t s_stats;
+static volatile bool s_maint_allowed = false;
+// EPD 波形窗口：打开且未过预计结束时只挑选 CPU 作业
+static volatile bool s_epd_window = false;
+static volatile TickType_t s_epd_window_until = 0;
+
+static inline bool tick_reached(TickType_t now, TickType_t at) {
+    return (int32_t)(now - at) >= 0;
+}
+
+static inline bool job_paused(const bg_job_t *job) {
+    return job->desc.prio == BG_JOB_PRIO_MAINT && !s_maint_allowed;
+}
+
+static inline bool epd_window_open(TickType_t now) {
+    return s_epd_window && !tick_reached(now, s_epd_window_until);
+}
+
+// 要用 SD 卡 / SPI 总线的作业不进 EPD 波形窗口
+static inline bool job_held_out(const bg_job_t *job, TickType_t now) {
+    return (job->desc.flags & BG_JOB_FLAG_CPU) == 0 && epd_window_open(now);
+}
+
+// 可以运行：有作业、不在运行、不在推迟期、维护作业已放行、不被 EPD 波形窗口挡住
+// （被取消的也要挑出来调用 done）
+static inline bool job_ready(const bg_job_t *job, TickType_t now) {
+    return job->id != BG_JOB_NONE && !job->running &&
+           (job->cancelled ||
+            (!job_paused(job) && !job_held_out(job, now) &&
+             (job->defers == 0 || tick_reached(now, job->retry_tick))));
+}
+
+static inline bool job_before(const bg_job_t *a, const bg_job_t *b) {
+    return a->desc.prio < b->desc.prio ||
+           (a->desc.prio == b->desc.prio && (int32_t)(a->seq - b->seq) < 0);
+}
+
+// 取下一个可运行的作业并标记为运行中；没有时给出最近一次推迟到期前的等待时间
+static bg_job_t *pick_job(TickType_t *wait) {
+    const TickType_t now = xTaskGetTickCount();
+    bg_job_t *best = NULL;
+    *wait = portMAX_DELAY;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < BG_JOBS_MAX; i++) {
+        bg_job_t *job = &s_jobs[i];
+        if (job->id == BG_JOB_NONE || job->running) {
+            continue;
+        }
+        if (job_ready(job, now)) {
+            if (best == NULL || job_before(job, best)) {
+                best = job;
+            }
+        } else if (!job_paused(job) && (job->defers > 0 || job_held_out(job, now))) {
+            // 推迟期与窗口都可能挡着：先在较早的那个到期时醒来重新挑选
+            const TickType_t left = job_held_out(job, now) ? s_epd_window_until - now
+                                                           : job->retry_tick - now;
+            if (left < *wait) {
+                *wait = left;
+            }
+        }
+    }
+    if (best != NULL) {
+        best->running = true;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return best;
+}
+
+static void finish_job(bg_job_t *job, bool finished) {
+    if (job->held > 0) {
+        ESP_LOGW(TAG, "%s ended holding %lu bytes", job->desc.name, (unsigned long)job->held);
+    }
+    if (job->desc.done != NULL) {
+        job->desc.done(job->desc.arg, finished);
+    }
+    portENTER_CRITICAL(&s_mux);
+    if (finished) {
+        s_stats.completed++;
+    } else {
+        s_stats.cancelled++;
+    }
+    s_stats.queued--;
+    memset(job, 0, sizeof(*job));
+    portEXIT_CRITICAL(&s_mux);
+}
+
+// 开始前的内存预算检查：余量不够时推迟，连续推迟太多次就放弃
+static bool admit_job(bg_job_t *job) {
+    if (job->desc.mem_budget == 0 ||
+        heap_stats_cache_budget(0, 1) >= job->desc.mem_budget) {
+        job->started = true;
+        job->defers = 0;
+        return true;
+    }
+    portENTER_CRITICAL(&s_mux);
+    s_stats.deferred++;
+    portEXIT_CRITICAL(&s_mux);
+    if (++job->defers >= BG_JOBS_DEFER_MAX) {
+        ESP_LOGW(TAG, "%s: %lu byte budget unavailable, dropped", job->desc.name,
+                 (unsigned long)job->desc.mem_budget);
+        job->cancelled = true;
+        return false;
+    }
+    portENTER_CRITICAL(&s_mux);
+    job->retry_tick = xTaskGetTickCount() + pdMS_TO_TICKS(BG_JOBS_RETRY_MS);
+    job->running = false;
+    portEXIT_CRITICAL(&s_mux);
+    return false;
+}
+
+static void bg_jobs_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("bg_jobs", BG_JOBS_TASK_STACK);
+    for (;;) {
+        TickType_t wait;
+        bg_job_t *job = pick_job(&wait);
+        if (job == NULL) {
+            ulTaskNotifyTake(pdTRUE, wait);
+            continue;
+        }
+        if (!job->cancelled && !job->started && !admit_job(job)) {
+            if (job->cancelled) {
+                finish_job(job, false);
+            }
+            continue;
+        }
+
+        const bool in_window = epd_window_open(xTaskGetTickCount());
+        const bool more = !job->cancelled && job->desc.step(job, job->desc.arg);
+        portENTER_CRITICAL(&s_mux);
+        s_stats.steps++;
+        if (in_window) {
+            s_stats.window_steps++;
+        }
+        portEXIT_CRITICAL(&s_mux);
+        if (!more || job->cancelled) {
+            finish_job(job, !job->cancelled);
+            continue;
+        }
+        portENTER_CRITICAL(&s_mux);
+        job->seq = ++s_seq;
+        job->running = false;
+        portEXIT_CRITICAL(&s_mux);
+    }
+}
+
+// 第一次提交时创建工作任务
+static bool ensure_task(void) {
+    portENTER_CRITICAL(&s_mux);
+    const bool create = s_task == NULL && !s_task_creating;
+    if (create) {
+        s_task_creating = true;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (!create) {
+        return true;   // 已存在，或另一个任务正在创建（随后会处理这份提交）
+    }
+    TaskHandle_t task = NULL;
+    const bool ok = xTaskCreate(bg_jobs_task, "bg_jobs", BG_JOBS_TASK_STACK, NULL,
+                                BG_JOBS_TASK_PRIO, &task) == pdPASS;
+    portENTER_CRITICAL(&s_mux);
+    s_task = ok ? task : NULL;
+    s_task_creating = false;
+    portEXIT_CRITICAL(&s_mux);
+    if (!ok) {
+        ESP_LOGE(TAG, "Failed to create worker task");
+    }
+    return ok;
+}
+
+bg_job_id_t bg_jobs_submit(const bg_job_desc_t *desc) {
+    if (desc == NULL || desc->step == NULL || desc->prio >= BG_JOB_PRIO_COUNT || !ensure_task()) {
+        return BG_JOB_NONE;
+    }
+    bg_job_id_t id = BG_JOB_NONE;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < BG_JOBS_MAX; i++) {
+        bg_job_t *job = &s_jobs[i];
+        if (job->id != BG_JOB_NONE) {
+            continue;
+        }
+        memset(job, 0, sizeof(*job));
+        job->desc = *desc;
+        if (job->desc.name == NULL) {
+            job->desc.name = "job";
+        }
+        id = s_next_id++;
+        if (s_next_id == BG_JOB_NONE) {
+            s_next_id = 1;
+        }
+        job->id = id;
+        job->seq = ++s_seq;
+        s_stats.submitted++;
+        s_stats.queued++;
+        break;
+    }
+    TaskHandle_t task = s_task;
+    portEXIT_CRITICAL(&s_mux);
+    if (id == BG_JOB_NONE) {
+        ESP_LOGW(TAG, "Queue full, %s not submitted", desc->name != NULL ? desc->name : "job");
+    } else if (task != NULL) {
+        xTaskNotifyGive(task);
+    }
+    return id;
+}
+
+bool bg_jobs_cancel(bg_job_id_t id) {
+    if (id == BG_JOB_NONE) {
+        return false;
+    }
+    bool found = false;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < BG_JOBS_MAX; i++) {
+        if (s_jobs[i].id == id) {
+            s_jobs[i].cancelled = true;
+            found = true;
+            break;
+        }
+    }
+    TaskHandle_t task = s_task;
+    portEXIT_CRITICAL(&s_mux);
+    if (found && task != NULL) {
+        xTaskNotifyGive(task);   // 推迟中或排队中的作业立即结束
+    }
+    return found;
+}
+
+bool bg_jobs_is_pending(bg_job_id_t id) {
+    if (id == BG_JOB_NONE) {
+        return false;
+    }
+    bool found = false;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < BG_JOBS_MAX && !found; i++) {
+        found = s_jobs[i].id == id;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return found;
+}
+
+void bg_jobs_set_maintenance(bool allowed) {
+    if (s_maint_allowed == allowed) {
+        return;
+    }
+    s_maint_allowed = allowed;
+    portENTER_CRITICAL(&s_mux);
+    TaskHandle_t task = s_task;
+    portEXIT_CRITICAL(&s_mux);
+    if (allowed && task != NULL) {
+        xTaskNotifyGive(task);
+    }
+}
+
+void bg_jobs_epd_window_begin(uint32_t expected_us) {
+    s_epd_window_until = xTaskGetTickCount() + pdMS_TO_TICKS(expected_us / 1000);
+    s_epd_window = true;
+    portENTER_CRITICAL(&s_mux);
+    s_stats.windows++;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void IRAM_ATTR bg_jobs_epd_window_end(void) {
+    s_epd_window = false;
+}
+
+bool bg_job_cancelled(const bg_job_t *job) {
+    return job->cancelled;
+}
+
+bool bg_job_should_yield(const bg_job_t *job) {
+    const TickType_t now = xTaskGetTickCount();
+    if (job->cancelled || job_paused(job) || job_held_out(job, now)) {
+        return true;
+    }
+    bool waiting = false;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < BG_JOBS_MAX && !waiting; i++) {
+        const bg_job_t *other = &s_jobs[i];
+        waiting = other != job && job_ready(other, now) && other->desc.prio < job->desc.prio;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return waiting;
+}
+
+void *bg_job_alloc(bg_job_t *job, heap_tag_t tag, size_t size) {
+    if (job->held + size > job->desc.mem_budget) {
+        ESP_LOGW(TAG, "%s: %u bytes over budget (%lu held of %lu)", job->desc.name, (unsigned)size,
+                 (unsigned long)job->held, (unsigned long)job->desc.mem_budget);
+        return NULL;
+    }
+    void *p = heap_stats_malloc(tag, size);
+    if (p != NULL) {
+        job->held += (uint32_t)heap_caps_get_allocated_size(p);
+    }
+    return p;
+}
+
+void bg_job_free(bg_job_t *job, heap_tag_t tag, void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    const uint32_t size = (uint32_t)heap_caps_get_allocated_size(ptr);
+    job->held = job->held > size ? job->held - size : 0;
+    heap_stats_free(tag, ptr);
+}
+
+void bg_jobs_get_stats(bg_jobs_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+}
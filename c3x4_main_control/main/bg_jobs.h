@@ -0,0 +1,146 @@
+/**
+ * @file bg_jobs.h
+ * @brief 后台作业调度：章节预取、索引、字体扫描、缩略图等共用一个低优先级任务
+ *
+ * 各功能不再各自建任务（每个任务一份 4-6 KB 的栈，可用堆不到 100 KB），而是提交作业：
+ *   - 作业是一个分步函数，每次调用做一小段工作，返回 true 表示还有后续。调度器在
+ *     步与步之间重新挑选最高优先级的作业，同级按提交顺序轮转
+ *   - 工作任务的优先级为 0（与 idle 相同，低于 LVGL 任务），渲染与刷新随时抢占；
+ *     单步不应长时间占用 SD 卡，长循环里用 bg_job_should_yield 提前返回
+ *   - 取消令牌：bg_jobs_cancel 后排队中的作业不再运行，正在运行的一步可以用
+ *     bg_job_cancelled 查询并尽早返回；done 回调总会调用一次，用于释放参数
+ *   - 内存预算：作业声明最多持有的字节数，空闲堆（减 HEAP_STATS_RESERVE）不够时
+ *     推迟开始；用 bg_job_alloc 分配的内存计入预算，超出时分配失败
+ *   - 维护作业（BG_JOB_PRIO_MAINT）：只在 bg_jobs_set_maintenance 放行时挑选（充电且
+ *     空闲时由 charge_maint 放行）；收回许可后留在队列里，正在运行的一步由
+ *     bg_job_should_yield 得知并尽早返回
+ *   - EPD 波形窗口：刷新波形期间（全刷约 2 秒、局刷约 0.4 秒）刷新任务停在 BUSY 上，
+ *     CPU 基本空闲。bg_jobs_epd_window_begin/end 告知窗口及其按实测预计的时长，窗口内
+ *     只挑选 BG_JOB_FLAG_CPU 的作业；要用 SD 卡的作业留在窗口外，正在运行的一步由
+ *     bg_job_should_yield 得知，免得窗口结束时占着 SPI 总线与下一帧上传争用
+ * 工作任务在第一次提交时创建，之后一直保留
+ */
+
+#ifndef BG_JOBS_H
+#define BG_JOBS_H
+
+#include "heap_stats.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BG_JOBS_MAX          8      // 同时排队的作业数
+#define BG_JOBS_TASK_STACK   6144   // JPEG/PNG 解码需要的栈（原预解码任务的大小）
+#define BG_JOBS_TASK_PRIO    0      // 与 idle 相同：任何前台任务都优先
+#define BG_JOBS_RETRY_MS     500    // 内存不够推迟的作业多久后重试
+
+typedef enum {
+    BG_JOB_PRIO_HIGH = 0,    // 用户马上要看到的（下一张图、下一章）
+    BG_JOB_PRIO_NORMAL,      // 扫描、索引
+    BG_JOB_PRIO_LOW,         // 缩略图、缓存整理
+    BG_JOB_PRIO_MAINT,       // 充电维护：只在放行时运行的重活
+    BG_JOB_PRIO_COUNT
+} bg_job_prio_t;
+
+// 作业只用 CPU 与内存（不读写 SD 卡、不占 SPI 总线），可以在 EPD 波形窗口中运行
+#define BG_JOB_FLAG_CPU 0x01
+
+typedef uint32_t bg_job_id_t;
+#define BG_JOB_NONE 0
+
+typedef struct bg_job bg_job_t;
+
+/**
+ * @brief 执行一步（在后台任务中调用）
+ * @return true 还有后续，稍后再调用；false 已完成
+ */
+typedef bool (*bg_job_step_t)(bg_job_t *job, void *arg);
+
+/**
+ * @brief 作业结束（在后台任务中调用，每个作业恰好一次）
+ * @param finished false 表示被取消或因内存不足被放弃
+ */
+typedef void (*bg_job_done_t)(void *arg, bool finished);
+
+typedef struct {
+    const char *name;        // 日志用，字符串常量
+    bg_job_prio_t prio;
+    uint32_t mem_budget;     // 作业最多持有的字节数（0：不从堆分配）
+    bg_job_step_t step;
+    bg_job_done_t done;      // 可为 NULL
+    void *arg;
+    uint8_t flags;           // BG_JOB_FLAG_*
+} bg_job_desc_t;
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t completed;
+    uint32_t cancelled;
+    uint32_t deferred;       // 因内存不足推迟开始的次数
+    uint32_t steps;
+    uint32_t window_steps;   // 在 EPD 波形窗口中运行的步数
+    uint32_t windows;        // EPD 波形窗口数
+    uint8_t queued;          // 当前排队（含正在运行）的作业数
+} bg_jobs_stats_t;
+
+/**
+ * @brief 提交作业（任意任务）
+ * @return 作业号；队列已满、参数无效或无法创建工作任务时为 BG_JOB_NONE（不调用 done）
+ */
+bg_job_id_t bg_jobs_submit(const bg_job_desc_t *desc);
+
+/**
+ * @brief 取消作业（任意任务）。已结束或不存在的作业返回 false
+ */
+bool bg_jobs_cancel(bg_job_id_t id);
+
+/**
+ * @brief 作业是否还在队列中（含正在运行）
+ */
+bool bg_jobs_is_pending(bg_job_id_t id);
+
+/**
+ * @brief 放行或暂停维护作业（任意任务，按键路径中也可以调用）
+ *
+ * 暂停后维护作业不再被挑选，正在运行的一步 bg_job_should_yield 返回 true
+ */
+void bg_jobs_set_maintenance(bool allowed);
+
+/**
+ * @brief EPD 波形开始（发出 0x20 的任务中调用）
+ * @param expected_us 按该波形实测的平均时长；超过后即使没有收到结束也视为窗口关闭
+ */
+void bg_jobs_epd_window_begin(uint32_t expected_us);
+
+/**
+ * @brief EPD 波形结束（任意任务或 BUSY 中断中调用）
+ *
+ * 只清除窗口标志，不通知工作任务：等着 SD 作业的工作任务最迟在预计结束时醒来
+ */
+void bg_jobs_epd_window_end(void);
+
+/**
+ * @brief 在作业的一步中调用：是否已被取消
+ */
+bool bg_job_cancelled(const bg_job_t *job);
+
+/**
+ * @brief 在作业的一步中调用：是否应尽快返回（已取消、有更高优先级的作业在等，
+ *        是维护作业而许可已收回，或者不是 CPU 作业而 EPD 波形窗口已开始）
+ */
+bool bg_job_should_yield(const bg_job_t *job);
+
+/**
+ * @brief 在作业的预算内分配（超出预算或堆不足时返回 NULL）
+ */
+void *bg_job_alloc(bg_job_t *job, heap_tag_t tag, size_t size);
+
+/**
+ * @brief 释放 bg_job_alloc 分配的内存（ptr 可为 NULL）
+ */
+void bg_job_free(bg_job_t *job, heap_tag_t tag, void *ptr);
+
+void bg_jobs_get_stats(bg_jobs_stats_t *out);
+
+#endif // BG_JOBS_H
@@ -0,0 +1,463 @@
+/**
+ * @file ble_bench.c
+ * @brief BLE 吞吐与延迟基准实现
+ *
+ * 控制与数据特征的回调都在 NimBLE 主机任务中执行：接收统计只在那里更新，不需要加锁。
+ * 发送在 bg_jobs 的工作任务中分步进行，一步发出一批通知；缓冲用完时记一次重试，
+ * 让出一个节拍再发，不在主机任务里等待
+ */
+
+#include "ble_bench.h"
+#include "bg_jobs.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host/ble_hs.h"
+#include "host/ble_uuid.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "BLE_BENCH";
+
+#define BENCH_ATT_HDR        3        // ATT 通知头（操作码 + 句柄）
+#define BENCH_PKT_HDR        8        // 发送包的序号与时间戳
+#define BENCH_SINK_HDR       4        // 接收包的序号
+#define BENCH_BATCH          16       // 每步最多发出的通知
+#define BENCH_PAYLOAD_MAX    512
+#define BENCH_ECHO_MAX       16       // 回显令牌的最大字节数
+
+// 控制特征操作码（手机 -> 设备）
+#define BENCH_OP_SINK_RESET  0x01
+#define BENCH_OP_SINK_REPORT 0x02
+#define BENCH_OP_SOURCE      0x03
+#define BENCH_OP_STOP        0x04
+#define BENCH_OP_ECHO        0x05
+#define BENCH_OP_LINK        0x06
+#define BENCH_OP_PARAMS      0x07
+// 通知操作码（设备 -> 手机）
+#define BENCH_NT_SINK        0xC2
+#define BENCH_NT_BEGIN       0xC3
+#define BENCH_NT_END         0xC4
+#define BENCH_NT_ECHO        0xC5
+#define BENCH_NT_LINK        0xC6
+#define BENCH_NT_PARAMS      0xC7
+
+// 状态码
+#define BENCH_OK             0
+#define BENCH_ERR_BUSY       1        // 已有发送在进行
+#define BENCH_ERR_BAD_REQ    2
+#define BENCH_ERR_ABORTED    3        // 手机停止或断开
+#define BENCH_ERR_NO_NOTIFY  4        // 数据特征没有订阅通知
+
+typedef struct {
+    uint32_t packets;
+    uint32_t bytes;
+    uint32_t expected;                // 下一个期望的序号
+    uint32_t missing;                 // 序号缺口累计（未到达或丢失的包）
+    uint32_t reordered;               // 序号比期望小（乱序或重复）
+    int64_t first_us;
+    int64_t last_us;
+    uint32_t max_gap_us;
+    double gap_mean;                  // 包间隔的均值与平方差累计（Welford）
+    double gap_m2;
+} sink_stats_t;
+
+typedef struct {
+    uint32_t total;                   // 要发送的字节数（含包头）
+    uint32_t sent;
+    uint32_t packets;
+    uint32_t congested;               // 通知缓冲用完、让出后重发的次数
+    uint16_t payload;                 // 每包字节数（含包头）
+    int64_t start_us;
+    bool finished;
+} source_job_t;
+
+static uint16_t s_ctrl_handle = 0;
+static uint16_t s_data_handle = 0;
+static bool s_ctrl_notify = false;
+static bool s_data_notify = false;
+static uint16_t s_conn = 0;
+static bg_job_id_t s_job_id = BG_JOB_NONE;
+static source_job_t s_src;
+static sink_stats_t s_sink;
+
+static void put_le16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t get_le16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 返回 NimBLE 错误码；BLE_HS_ENOMEM 表示暂时没有缓冲，稍后重发
+static int notify(uint16_t handle, bool enabled, const uint8_t *data, size_t len) {
+    if (!enabled || handle == 0) {
+        return BLE_HS_ENOTCONN;
+    }
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(data, len);
+    if (om == NULL) {
+        return BLE_HS_ENOMEM;
+    }
+    return ble_gatts_notify_custom(s_conn, handle, om);
+}
+
+// 控制通知。主机任务里只发一次（在那里等待会挡住缓冲的释放）；工作任务发的结束通知
+// 必须送到，缓冲用完时等一会儿
+static void notify_ctrl(const uint8_t *msg, size_t len, bool wait) {
+    int rc = notify(s_ctrl_handle, s_ctrl_notify, msg, len);
+    for (int tries = 0; wait && rc == BLE_HS_ENOMEM && tries < 50; tries++) {
+        vTaskDelay(1);
+        rc = notify(s_ctrl_handle, s_ctrl_notify, msg, len);
+    }
+    if (rc != 0) {
+        ESP_LOGW(TAG, "Control notification 0x%02X failed: %d", msg[0], rc);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 接收（主机任务）
+// ---------------------------------------------------------------------------
+
+static void sink_packet(const uint8_t *hdr, uint16_t len) {
+    const int64_t now = esp_timer_get_time();
+    sink_stats_t *s = &s_sink;
+    if (s->packets == 0) {
+        s->first_us = now;
+    } else {
+        const uint32_t gap = (uint32_t)(now - s->last_us);
+        if (gap > s->max_gap_us) {
+            s->max_gap_us = gap;
+        }
+        // 第 n 个间隔（n = packets）
+        const double delta = gap - s->gap_mean;
+        s->gap_mean += delta / s->packets;
+        s->gap_m2 += delta * (gap - s->gap_mean);
+    }
+    s->last_us = now;
+    s->packets++;
+    s->bytes += len;
+
+    const uint32_t seq = get_le32(hdr);
+    if (seq >= s->expected) {
+        s->missing += seq - s->expected;
+        s->expected = seq + 1;
+    } else {
+        s->reordered++;
+    }
+}
+
+static void sink_report(void) {
+    const sink_stats_t *s = &s_sink;
+    const uint32_t jitter = s->packets > 2 ? (uint32_t)sqrt(s->gap_m2 / (s->packets - 2)) : 0;
+    uint8_t msg[29] = { BENCH_NT_SINK };
+    put_le32(msg + 1, s->packets);
+    put_le32(msg + 5, s->bytes);
+    put_le32(msg + 9, s->missing);
+    put_le32(msg + 13, s->reordered);
+    put_le32(msg + 17, s->packets > 1 ? (uint32_t)(s->last_us - s->first_us) : 0);
+    put_le32(msg + 21, s->max_gap_us);
+    put_le32(msg + 25, jitter);
+    notify_ctrl(msg, sizeof(msg), false);
+    ESP_LOGI(TAG, "Sink: %lu packets, %lu bytes, %lu missing, %lu reordered, jitter %lu us",
+             (unsigned long)s->packets, (unsigned long)s->bytes, (unsigned long)s->missing,
+             (unsigned long)s->reordered, (unsigned long)jitter);
+}
+
+// ---------------------------------------------------------------------------
+// 发送（bg_jobs 工作任务）
+// ---------------------------------------------------------------------------
+
+static bool source_step(bg_job_t *bg, void *arg) {
+    source_job_t *job = (source_job_t *)arg;
+    if (bg_job_cancelled(bg) || !s_data_notify) {
+        return false;
+    }
+    uint8_t pkt[BENCH_PAYLOAD_MAX];
+    for (int i = 0; i < BENCH_BATCH && job->sent < job->total; i++) {
+        size_t n = job->total - job->sent;
+        if (n > job->payload) {
+            n = job->payload;
+        }
+        if (n < BENCH_PKT_HDR) {
+            n = BENCH_PKT_HDR;
+        }
+        put_le32(pkt, job->packets);
+        put_le32(pkt + 4, (uint32_t)(esp_timer_get_time() - job->start_us));
+        memset(pkt + BENCH_PKT_HDR, (uint8_t)job->packets, n - BENCH_PKT_HDR);
+        const int rc = notify(s_data_handle, s_data_notify, pkt, n);
+        if (rc == BLE_HS_ENOMEM) {
+            job->congested++;
+            vTaskDelay(1);
+            return true;
+        }
+        if (rc != 0) {
+            ESP_LOGW(TAG, "Data notification failed: %d", rc);
+            return false;
+        }
+        job->packets++;
+        job->sent += (uint32_t)n;
+    }
+    if (job->sent >= job->total) {
+        job->finished = true;
+        return false;
+    }
+    return true;
+}
+
+static void source_done(void *arg, bool finished) {
+    source_job_t *job = (source_job_t *)arg;
+    const bool ok = finished && job->finished;
+    const uint32_t elapsed = (uint32_t)(esp_timer_get_time() - job->start_us);
+    uint8_t msg[18] = { BENCH_NT_END, ok ? BENCH_OK : BENCH_ERR_ABORTED };
+    put_le32(msg + 2, job->packets);
+    put_le32(msg + 6, job->sent);
+    put_le32(msg + 10, elapsed);
+    put_le32(msg + 14, job->congested);
+    notify_ctrl(msg, sizeof(msg), true);
+    ESP_LOGI(TAG, "Source %s: %lu bytes in %lu ms, %lu retries", ok ? "done" : "aborted",
+             (unsigned long)job->sent, (unsigned long)(elapsed / 1000),
+             (unsigned long)job->congested);
+    s_job_id = BG_JOB_NONE;
+}
+
+static void notify_begin(uint8_t status, uint16_t payload) {
+    uint8_t msg[4] = { BENCH_NT_BEGIN, status };
+    put_le16(msg + 2, payload);
+    notify_ctrl(msg, sizeof(msg), false);
+}
+
+static void handle_source(uint32_t total, uint16_t payload) {
+    if (s_job_id != BG_JOB_NONE && bg_jobs_is_pending(s_job_id)) {
+        notify_begin(BENCH_ERR_BUSY, 0);
+        return;
+    }
+    if (!s_data_notify) {
+        notify_begin(BENCH_ERR_NO_NOTIFY, 0);
+        return;
+    }
+    // 0 表示填满一个通知：MTU 减去 ATT 头
+    const uint16_t mtu = ble_att_mtu(s_conn);
+    const uint16_t fill = mtu > BENCH_ATT_HDR ? mtu - BENCH_ATT_HDR : 20;
+    if (payload == 0 || payload > fill) {
+        payload = fill;
+    }
+    if (payload > BENCH_PAYLOAD_MAX) {
+        payload = BENCH_PAYLOAD_MAX;
+    }
+    if (total == 0 || total > BENCH_SOURCE_MAX || payload < BENCH_PKT_HDR) {
+        notify_begin(BENCH_ERR_BAD_REQ, 0);
+        return;
+    }
+    memset(&s_src, 0, sizeof(s_src));
+    s_src.total = total;
+    s_src.payload = payload;
+    const bg_job_desc_t desc = {
+        .name = "ble_bench",
+        .prio = BG_JOB_PRIO_HIGH,
+        .step = source_step,
+        .done = source_done,
+        .arg = &s_src,
+        .flags = BG_JOB_FLAG_CPU,   // 只生成数据、发通知
+    };
+    // BEGIN 先于作业提交发出，数据通知不会跑到它前面
+    notify_begin(BENCH_OK, payload);
+    s_src.start_us = esp_timer_get_time();
+    s_job_id = bg_jobs_submit(&desc);
+    if (s_job_id == BG_JOB_NONE) {
+        uint8_t msg[18] = { BENCH_NT_END, BENCH_ERR_BUSY };
+        notify_ctrl(msg, sizeof(msg), false);
+        return;
+    }
+    ESP_LOGI(TAG, "Source: %lu bytes, %u per notification", (unsigned long)total, payload);
+}
+
+// ---------------------------------------------------------------------------
+// 连接参数
+// ---------------------------------------------------------------------------
+
+static void notify_link(void) {
+    struct ble_gap_conn_desc desc;
+    uint8_t tx_phy = 0;
+    uint8_t rx_phy = 0;
+    uint8_t msg[11] = { BENCH_NT_LINK };
+    if (ble_gap_conn_find(s_conn, &desc) == 0) {
+        put_le16(msg + 3, desc.conn_itvl);
+        put_le16(msg + 5, desc.conn_latency);
+        put_le16(msg + 7, desc.supervision_timeout);
+    }
+    (void)ble_gap_read_le_phy(s_conn, &tx_phy, &rx_phy);
+    put_le16(msg + 1, ble_att_mtu(s_conn));
+    msg[9] = tx_phy;
+    msg[10] = rx_phy;
+    notify_ctrl(msg, sizeof(msg), false);
+}
+
+// 按请求重新协商连接间隔与 PHY；结果由对端决定，之后用 LINK 查询
+static void handle_params(const uint8_t *req) {
+    const uint16_t itvl_min = get_le16(req);
+    const uint16_t itvl_max = get_le16(req + 2);
+    const uint16_t latency = get_le16(req + 4);
+    const uint8_t phy_mask = req[6];
+    int rc = 0;
+    if (itvl_min != 0 && itvl_max >= itvl_min) {
+        const struct ble_gap_upd_params params = {
+            .itvl_min = itvl_min,
+            .itvl_max = itvl_max,
+            .latency = latency,
+            .supervision_timeout = 400,   // x 10 ms = 4 s
+            .min_ce_len = 0,
+            .max_ce_len = 0,
+        };
+        rc = ble_gap_update_params(s_conn, &params);
+    }
+    if (rc == 0 && phy_mask != 0) {
+        rc = ble_gap_set_prefered_le_phy(s_conn, phy_mask, phy_mask, BLE_GAP_LE_PHY_CODED_ANY);
+    }
+    ESP_LOGI(TAG, "Params: itvl %u-%u latency %u phy 0x%02X -> rc=%d", itvl_min, itvl_max,
+             latency, phy_mask, rc);
+    const uint8_t msg[2] = { BENCH_NT_PARAMS, (uint8_t)rc };
+    notify_ctrl(msg, sizeof(msg), false);
+}
+
+// ---------------------------------------------------------------------------
+// GATT
+// ---------------------------------------------------------------------------
+
+static int ctrl_access(uint16_t conn_handle, uint16_t attr_handle,
+                       struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t req[1 + BENCH_ECHO_MAX];
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len == 0 || len > sizeof(req) || os_mbuf_copydata(ctxt->om, 0, len, req) != 0) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    s_conn = conn_handle;
+
+    switch (req[0]) {
+    case BENCH_OP_SINK_RESET:
+        memset(&s_sink, 0, sizeof(s_sink));
+        return 0;
+    case BENCH_OP_SINK_REPORT:
+        sink_report();
+        return 0;
+    case BENCH_OP_SOURCE:
+        if (len != 7) {
+            return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+        }
+        handle_source(get_le32(req + 1), get_le16(req + 5));
+        return 0;
+    case BENCH_OP_STOP:
+        if (s_job_id != BG_JOB_NONE) {
+            bg_jobs_cancel(s_job_id);
+        }
+        return 0;
+    case BENCH_OP_ECHO: {
+        // 令牌原样带回，再附上设备时间（微秒，低 32 位）
+        uint8_t msg[1 + BENCH_ECHO_MAX + 4] = { BENCH_NT_ECHO };
+        memcpy(msg + 1, req + 1, len - 1);
+        put_le32(msg + len, (uint32_t)esp_timer_get_time());
+        notify_ctrl(msg, len + 4, false);
+        return 0;
+    }
+    case BENCH_OP_LINK:
+        notify_link();
+        return 0;
+    case BENCH_OP_PARAMS:
+        if (len != 8) {
+            return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+        }
+        handle_params(req + 1);
+        return 0;
+    default:
+        return BLE_ATT_ERR_REQ_NOT_SUPPORTED;
+    }
+}
+
+static int data_access(uint16_t conn_handle, uint16_t attr_handle,
+                       struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)conn_handle;
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t hdr[BENCH_SINK_HDR];
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len < sizeof(hdr) || os_mbuf_copydata(ctxt->om, 0, sizeof(hdr), hdr) != 0) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    sink_packet(hdr, len);
+    return 0;
+}
+
+static const struct ble_gatt_svc_def s_bench_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = BLE_UUID16_DECLARE(BENCH_SERVICE_UUID),
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = BLE_UUID16_DECLARE(BENCH_CTRL_CHAR_UUID),
+                .access_cb = ctrl_access,
+                .val_handle = &s_ctrl_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+            },
+            {
+                .uuid = BLE_UUID16_DECLARE(BENCH_DATA_CHAR_UUID),
+                .access_cb = data_access,
+                .val_handle = &s_data_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_NO_RSP |
+                         BLE_GATT_CHR_F_NOTIFY,
+            },
+            {
+                0,
+            }
+        }
+    },
+    {
+        0,
+    }
+};
+
+int ble_bench_gatt_init(void) {
+    int rc = ble_gatts_count_cfg(s_bench_svcs);
+    if (rc != 0) {
+        return rc;
+    }
+    return ble_gatts_add_svcs(s_bench_svcs);
+}
+
+void ble_bench_on_subscribe(uint16_t attr_handle, bool notify_on) {
+    if (attr_handle == s_ctrl_handle) {
+        s_ctrl_notify = notify_on;
+    } else if (attr_handle == s_data_handle) {
+        s_data_notify = notify_on;
+    }
+}
+
+void ble_bench_on_disconnect(void) {
+    s_ctrl_notify = false;
+    s_data_notify = false;
+    if (s_job_id != BG_JOB_NONE) {
+        bg_jobs_cancel(s_job_id);
+    }
+    memset(&s_sink, 0, sizeof(s_sink));
+}
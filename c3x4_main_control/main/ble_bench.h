@@ -0,0 +1,45 @@
+/**
+ * @file ble_bench.h
+ * @brief BLE 吞吐与延迟基准：丢弃数据的接收端、连续通知的发送端与回显，配合
+ *        tools/x4blebench.py 在真实手机/电脑上测量不同 PHY、MTU 与连接间隔下的表现
+ *
+ * 接收（手机 -> 设备）：手机向数据特征连续写入（可无响应），每包以序号开头；设备只计数，
+ * 记下包数、字节数、序号缺口、首末包的到达时间与包间隔的最大值和标准差，不写 SD 卡，
+ * 结果代表链路本身的上限（X4IM/X4JS 还要加上 SD 写入）。
+ * 发送（设备 -> 手机）：后台作业（bg_jobs）按协商的 MTU 连续发通知，每包带序号与设备
+ * 时间戳（微秒），手机据此计算吞吐与到达抖动；通知缓冲用完的次数作为重试数报告。
+ * 回显：控制特征原样回送令牌，手机计算往返时间。
+ * 还可以让设备按给定的连接间隔与 PHY 重新协商连接，再查询实际生效的参数。
+ *
+ * 测量期间不锁 CPU 频率，与真实传输的条件一致。协议字节布局见 main.c 中的说明
+ */
+
+#ifndef BLE_BENCH_H
+#define BLE_BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BENCH_SERVICE_UUID     0x1239
+#define BENCH_CTRL_CHAR_UUID   0x56C0
+#define BENCH_DATA_CHAR_UUID   0x56C1
+
+#define BENCH_SOURCE_MAX       (16u * 1024 * 1024)   // 一次发送的最大字节数
+
+/**
+ * @brief 注册基准服务（在 ble_gatts_add_svcs 阶段调用，与其它服务一起）
+ * @return NimBLE 错误码，0 为成功
+ */
+int ble_bench_gatt_init(void);
+
+/**
+ * @brief 订阅事件（main.c 的 GAP 回调转发）
+ */
+void ble_bench_on_subscribe(uint16_t attr_handle, bool notify);
+
+/**
+ * @brief 连接断开：停止发送，清空接收统计
+ */
+void ble_bench_on_disconnect(void);
+
+#endif // BLE_BENCH_H
@@ -0,0 +1,308 @@
+/**
+ * @file ble_live.c
+ * @brief X4IM 实时模式实现
+ *
+ * 主机任务一侧：RGB565 -> 灰度 -> Floyd-Steinberg（只保留当前行和下一行的误差）
+ * -> 1bpp 分带，写满一带就放进就绪队列并唤醒 LVGL 任务。LVGL 任务一侧：定时器
+ * 回调取出就绪的分带写进 framebuffer，槽位还回空闲队列。会话进行中定时器
+ * 缩短周期，空闲时恢复慢速轮询，不影响浅睡眠
+ */
+
+#include "ble_live.h"
+#include "x4im_frame.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "BLE_LIVE";
+
+#define LIVE_IDLE_POLL_MS   200
+#define LIVE_ACTIVE_POLL_MS 10
+#define LIVE_SLOT_WAIT_MS   500      // 主机任务等待空闲槽位的上限
+#define LIVE_LOCK_MS        1000
+#define LIVE_MAX_WIDTH      800
+
+typedef struct {
+    uint8_t bits[BLE_LIVE_BAND_ROWS * (LIVE_MAX_WIDTH / 8)];
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t stride;
+    uint16_t rows;
+    bool final;         // 本帧/本区域的最后一带
+    bool refresh;       // 写完后刷新（整帧总是刷新；区域只在 commit 时）
+    bool partial;       // 区域更新：强制局刷，只刷累积的脏区
+} live_band_t;
+
+static live_band_t s_bands[BLE_LIVE_BANDS];
+static QueueHandle_t s_free_q = NULL;
+static QueueHandle_t s_ready_q = NULL;
+static lv_timer_t *s_timer = NULL;
+
+static uint16_t s_width = 0;      // 逻辑分辨率（ble_live_init 时从 LVGL 读取）
+static uint16_t s_height = 0;
+
+// 主机任务一侧的帧状态（整帧即覆盖全屏的区域）
+static volatile bool s_active = false;
+static bool s_failed = false;
+static uint8_t s_format = X4IM_FMT_RGB565;
+static bool s_region = false;
+static bool s_commit = false;
+static uint16_t s_rx = 0;         // 当前矩形
+static uint16_t s_ry = 0;
+static uint16_t s_rw = 0;
+static uint16_t s_rh = 0;
+static uint16_t s_rstride = 0;    // 矩形 1bpp 每行字节数
+static uint16_t s_x = 0;          // 矩形内的列（1bpp 格式为字节列）
+static uint16_t s_y = 0;          // 逻辑行
+static uint8_t s_low_byte = 0;
+static bool s_have_low = false;
+static int8_t s_band = -1;        // 正在填充的槽位
+static int16_t *s_err_cur = NULL; // 宽度 + 2，两端各留一格免去边界判断
+static int16_t *s_err_next = NULL;
+
+static volatile const uint8_t *s_pending_frame = NULL;
+
+static void live_timer_cb(lv_timer_t *timer) {
+    bool refresh = false;
+    uint8_t idx;
+
+    while (xQueueReceive(s_ready_q, &idx, 0) == pdTRUE) {
+        live_band_t *band = &s_bands[idx];
+        if (band->partial && lvgl_get_refresh_mode() != EPD_REFRESH_PARTIAL) {
+            // 脏区只在局刷模式下记录
+            lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+        }
+        uint8_t *fb = lvgl_fb_write_begin(LIVE_LOCK_MS);
+        if (fb != NULL) {
+            lvgl_fb_put_bitmap(fb, band->x, band->y, band->w, band->rows, band->bits, band->stride);
+            const lv_area_t area = { band->x, band->y, band->x + band->w - 1, band->y + band->rows - 1 };
+            lvgl_fb_write_end(&area);
+        } else {
+            ESP_LOGW(TAG, "Framebuffer unavailable, band y=%u dropped", band->y);
+        }
+        refresh |= band->final && band->refresh;
+        xQueueSend(s_free_q, &idx, 0);
+    }
+
+    const uint8_t *frame = (const uint8_t *)s_pending_frame;
+    if (frame != NULL) {
+        uint8_t *fb = lvgl_fb_write_begin(LIVE_LOCK_MS);
+        if (fb != NULL) {
+            memcpy(fb, frame, lvgl_fb_size());
+            const lv_area_t area = { 0, 0, s_width - 1, s_height - 1 };
+            lvgl_fb_write_end(&area);
+            refresh = true;
+        } else {
+            ESP_LOGW(TAG, "Framebuffer unavailable, packed frame dropped");
+        }
+        s_pending_frame = NULL;
+    }
+
+    if (refresh) {
+        lvgl_display_refresh();
+        power_manager_notify_activity();
+    }
+    lv_timer_set_period(timer, (s_active || s_pending_frame != NULL) ? LIVE_ACTIVE_POLL_MS
+                                                                     : LIVE_IDLE_POLL_MS);
+}
+
+void ble_live_init(void) {
+    if (s_timer != NULL) {
+        return;
+    }
+    s_width = (uint16_t)lv_display_get_horizontal_resolution(NULL);
+    s_height = (uint16_t)lv_display_get_vertical_resolution(NULL);
+    s_free_q = xQueueCreate(BLE_LIVE_BANDS, sizeof(uint8_t));
+    s_ready_q = xQueueCreate(BLE_LIVE_BANDS, sizeof(uint8_t));
+    s_err_cur = (int16_t *)calloc(s_width + 2, sizeof(int16_t));
+    s_err_next = (int16_t *)calloc(s_width + 2, sizeof(int16_t));
+    if (s_width > LIVE_MAX_WIDTH || s_free_q == NULL || s_ready_q == NULL ||
+        s_err_cur == NULL || s_err_next == NULL) {
+        ESP_LOGE(TAG, "Live mode unavailable (%ux%u)", s_width, s_height);
+        return;
+    }
+    for (uint8_t i = 0; i < BLE_LIVE_BANDS; i++) {
+        xQueueSend(s_free_q, &i, 0);
+    }
+    s_timer = lv_timer_create(live_timer_cb, LIVE_IDLE_POLL_MS, NULL);
+}
+
+static void start_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t format,
+                       bool region, bool commit) {
+    // 上一帧中途放弃时还占着的槽位作废
+    if (s_band >= 0) {
+        xQueueSend(s_free_q, &s_band, 0);
+        s_band = -1;
+    }
+    s_format = format;
+    s_region = region;
+    s_commit = commit;
+    s_rx = x;
+    s_ry = y;
+    s_rw = w;
+    s_rh = h;
+    s_rstride = (uint16_t)((w + 7) / 8);
+    s_x = 0;
+    s_y = y;
+    s_have_low = false;
+    s_failed = false;
+    memset(s_err_cur, 0, (s_width + 2) * sizeof(int16_t));
+    memset(s_err_next, 0, (s_width + 2) * sizeof(int16_t));
+    s_active = true;
+    lvgl_timer_task_wake();
+}
+
+bool ble_live_begin(uint32_t payload_len) {
+    if (s_timer == NULL || payload_len != (uint32_t)s_width * s_height * 2u) {
+        ESP_LOGW(TAG, "Live frame rejected: len=%u, expected %ux%u RGB565",
+                 (unsigned)payload_len, s_width, s_height);
+        return false;
+    }
+    start_rect(0, 0, s_width, s_height, X4IM_FMT_RGB565, false, true);
+    return true;
+}
+
+bool ble_live_begin_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           uint8_t format, bool commit, uint32_t payload_len) {
+    uint32_t expected = 0;
+    if (format == X4IM_FMT_RGB565) {
+        expected = (uint32_t)w * h * 2u;
+    } else if (format == X4IM_FMT_1BPP) {
+        expected = (uint32_t)((w + 7) / 8) * h;
+    }
+    if (s_timer == NULL || w == 0 || h == 0 || (uint32_t)x + w > s_width ||
+        (uint32_t)y + h > s_height || expected == 0 || payload_len != expected) {
+        ESP_LOGW(TAG, "Region rejected: %ux%u at (%u,%u) format=%u len=%u",
+                 w, h, x, y, format, (unsigned)payload_len);
+        return false;
+    }
+    start_rect(x, y, w, h, format, true, commit);
+    return true;
+}
+
+// 一行处理完：分带满了或整帧结束就交给 LVGL 任务
+static bool finish_row(void) {
+    int16_t *tmp = s_err_cur;
+    s_err_cur = s_err_next;
+    s_err_next = tmp;
+    memset(s_err_next, 0, (s_width + 2) * sizeof(int16_t));
+
+    live_band_t *band = &s_bands[s_band];
+    band->rows++;
+    s_x = 0;
+    s_y++;
+    const bool last = (s_y == s_ry + s_rh);
+    if (band->rows == BLE_LIVE_BAND_ROWS || last) {
+        band->final = last;
+        band->refresh = s_commit;
+        band->partial = s_region;
+        xQueueSend(s_ready_q, &s_band, 0);
+        s_band = -1;
+        lvgl_timer_task_wake();
+    }
+    if (last) {
+        s_active = false;
+    }
+    return true;
+}
+
+// 取一个空闲槽位开始新的一带
+static bool ensure_band(void) {
+    if (s_band >= 0) {
+        return true;
+    }
+    uint8_t idx;
+    if (xQueueReceive(s_free_q, &idx, pdMS_TO_TICKS(LIVE_SLOT_WAIT_MS)) != pdTRUE) {
+        return false;
+    }
+    live_band_t *band = &s_bands[idx];
+    s_band = (int8_t)idx;
+    band->x = s_rx;
+    band->y = s_y;
+    band->w = s_rw;
+    band->stride = s_rstride;
+    band->rows = 0;
+    band->final = false;
+    band->refresh = false;
+    band->partial = false;
+    memset(band->bits, 0, sizeof(band->bits));
+    return true;
+}
+
+static bool put_packed_byte(uint8_t b) {
+    if (!ensure_band()) {
+        return false;
+    }
+    live_band_t *band = &s_bands[s_band];
+    band->bits[band->rows * band->stride + s_x] = b;
+    if (++s_x == s_rstride) {
+        return finish_row();
+    }
+    return true;
+}
+
+static bool put_pixel(uint16_t rgb565) {
+    if (!ensure_band()) {
+        return false;
+    }
+
+    const int r = ((rgb565 >> 11) & 0x1F) * 255 / 31;
+    const int g = ((rgb565 >> 5) & 0x3F) * 255 / 63;
+    const int b = (rgb565 & 0x1F) * 255 / 31;
+    const int v = ((r * 77 + g * 150 + b * 29) >> 8) + s_err_cur[s_x + 1];
+    const bool white = v >= 128;
+    const int e = v - (white ? 255 : 0);
+    s_err_cur[s_x + 2] += (int16_t)(e * 7 / 16);
+    s_err_next[s_x] += (int16_t)(e * 3 / 16);
+    s_err_next[s_x + 1] += (int16_t)(e * 5 / 16);
+    s_err_next[s_x + 2] += (int16_t)(e / 16);
+
+    if (white) {
+        live_band_t *band = &s_bands[s_band];
+        band->bits[band->rows * band->stride + s_x / 8] |= (uint8_t)(0x80 >> (s_x & 7));
+    }
+    if (++s_x == s_rw) {
+        return finish_row();
+    }
+    return true;
+}
+
+bool ble_live_feed(const uint8_t *data, size_t len) {
+    if (!s_active || s_failed) {
+        return false;
+    }
+    for (size_t i = 0; i < len && s_active; i++) {
+        bool ok;
+        if (s_format == X4IM_FMT_1BPP) {
+            ok = put_packed_byte(data[i]);
+        } else if (!s_have_low) {
+            s_low_byte = data[i];
+            s_have_low = true;
+            continue;
+        } else {
+            s_have_low = false;
+            ok = put_pixel((uint16_t)(s_low_byte | (data[i] << 8)));
+        }
+        if (!ok) {
+            ESP_LOGE(TAG, "Display busy, live frame dropped at row %u", s_y);
+            s_failed = true;
+            s_active = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ble_live_show_frame(const uint8_t *frame) {
+    if (s_timer == NULL || frame == NULL) {
+        return false;
+    }
+    s_pending_frame = frame;
+    lvgl_timer_task_wake();
+    return true;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file ble_live.h
+ * @brief X4IM 实时模式：BLE 收到的帧不落 SD 卡，边收边写进 EPD framebuffer
+ *
+ * X4IM 帧头第 6 字节 bit0（X4IM_FLAG_LIVE）置位时启用。RGB565 帧按逻辑方向
+ * （与 LVGL 显示相同，竖屏 480x800）逐行到达，在 NimBLE 主机任务中转灰度并做
+ * Floyd-Steinberg 抖动，打包成 1bpp 的分带（BLE_LIVE_BAND_ROWS 行）交给 LVGL 任务，
+ * LVGL 任务用 lvgl_fb_put_bitmap 完成旋转并写入后台 framebuffer。最后一带写完后
+ * 触发一次刷新。紧凑格式（x4im_frame.h）解码完成后整帧拷进 framebuffer 再刷新
+ *
+ * 区域更新（X4IM 版本 2，见 main.c）只发送一个矩形：RGB565 同样逐行抖动，
+ * 1bpp 为逻辑方向逐行打包（高位在左，1 为白色，每行 (w+7)/8 字节）。矩形写入后
+ * 记为局刷脏区，带 X4IM_FLAG_COMMIT 的区域写完后按所有累积脏区局刷一次
+ *
+ * 写入的像素不属于任何控件，界面下次重绘时被覆盖
+ */
+
+#ifndef BLE_LIVE_H
+#define BLE_LIVE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define X4IM_FLAG_LIVE       0x01    // X4IM 帧头第 6 字节
+#define X4IM_FLAG_COMMIT     0x02    // 区域更新：本区域是这一批的最后一个，写完后刷新
+#define BLE_LIVE_BAND_ROWS   16
+#define BLE_LIVE_BANDS       4       // 分带槽位数：LVGL 任务忙于刷新时的缓冲深度
+
+/**
+ * @brief 创建分带队列和 LVGL 定时器（在 LVGL 初始化后、LVGL 定时器任务启动前调用）
+ */
+void ble_live_init(void);
+
+/**
+ * @brief 开始一帧 RGB565 实时帧（NimBLE 主机任务中调用）
+ * @param payload_len 负载长度，必须等于 逻辑宽 x 逻辑高 x 2
+ * @return false 未初始化或长度不符
+ */
+bool ble_live_begin(uint32_t payload_len);
+
+/**
+ * @brief 开始一个区域更新（NimBLE 主机任务中调用）
+ * @param x 左上角逻辑坐标
+ * @param y 左上角逻辑坐标
+ * @param w 宽度
+ * @param h 高度
+ * @param format X4IM_FMT_RGB565 或 X4IM_FMT_1BPP（逻辑方向逐行打包）
+ * @param commit 写完后触发局刷
+ * @param payload_len 负载长度，必须与矩形大小和格式一致
+ * @return false 未初始化、矩形超出屏幕或长度不符
+ */
+bool ble_live_begin_region(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                           uint8_t format, bool commit, uint32_t payload_len);
+
+/**
+ * @brief 送入一段负载（可以任意切分）
+ * @return false 分带槽位长时间没有空出来（LVGL 任务卡住），本帧作废
+ */
+bool ble_live_feed(const uint8_t *data, size_t len);
+
+/**
+ * @brief 显示一整帧 framebuffer 布局的 1bpp 数据（紧凑格式解码结果）
+ *
+ * frame 在 LVGL 任务拷贝完成前必须保持不变
+ */
+bool ble_live_show_frame(const uint8_t *frame);
+
+#endif // BLE_LIVE_H
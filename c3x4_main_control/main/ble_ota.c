@@ -0,0 +1,394 @@
+/**
+ * @file ble_ota.c
+ * @brief BLE 固件更新服务实现
+ *
+ * 控制特征的回调在 NimBLE 主机任务中执行，只做命令解析；解码与擦写 flash 需要
+ * 十几秒，放在单独的任务里，进度和结果经通知发回。状态只由写入任务修改，
+ * 主机任务读取时取的是某一刻的值，不需要加锁
+ */
+
+#include "ble_ota.h"
+#include "ble_writer.h"
+#include "ota_delta.h"
+#include "power_manager.h"
+#include "sd_path.h"
+#include "stack_stats.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp_system.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host/ble_hs.h"
+#include "host/ble_uuid.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "BLE_OTA";
+
+#define OTA_TASK_STACK       4096
+#define OTA_TASK_PRIO        2
+#define OTA_PATH_MAX         SD_PATH_REL_MAX
+#define OTA_PROGRESS_STEP    2        // 进度每前进 2% 通知一次
+#define OTA_REBOOT_DELAY_MS  500      // 重启前留时间把通知发出去
+
+// 控制特征操作码（手机 -> 设备）
+#define OTA_OP_APPLY         0x01
+#define OTA_OP_STATUS        0x02
+#define OTA_OP_REBOOT        0x03
+#define OTA_OP_ROLLBACK      0x04
+// 通知操作码（设备 -> 手机）
+#define OTA_NT_STATE         0x91
+
+typedef enum {
+    OTA_STATE_IDLE = 0,
+    OTA_STATE_CHECKING,      // 读补丁头、校验旧镜像
+    OTA_STATE_WRITING,       // 解码并写入目标分区
+    OTA_STATE_READY,         // 新镜像已校验并设为启动分区，等待重启
+    OTA_STATE_FAILED,
+} ota_state_t;
+
+// 结果码：0..4 与 ota_delta_result_t 相同，其余是本服务的错误
+#define OTA_ERR_REQUEST      16       // 命令格式、路径不合法，或正在写入
+#define OTA_ERR_NO_SLOT      17       // 没有可写的 OTA 分区，或镜像放不下
+#define OTA_ERR_FLASH        18       // esp_ota_begin/write/end 或设置启动分区失败
+#define OTA_ERR_ROLLBACK     19       // 没有可以切回的旧固件
+
+typedef struct {
+    FILE *fp;
+    const esp_partition_t *running;
+    esp_ota_handle_t handle;
+    uint8_t last_pct;
+} ota_job_t;
+
+static uint16_t s_ctrl_handle = 0;
+static bool s_notify = false;
+static uint16_t s_conn = 0;
+
+static TaskHandle_t s_task = NULL;
+static volatile ota_state_t s_state = OTA_STATE_IDLE;
+static volatile uint8_t s_result = 0;
+static volatile uint32_t s_done = 0;
+static volatile uint32_t s_total = 0;
+static char s_path[BLE_WRITER_PATH_MAX];
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// 可在任意任务中调用（NimBLE 的通知接口自带锁）
+static void notify_state(void) {
+    if (!s_notify || s_ctrl_handle == 0) {
+        return;
+    }
+    const uint32_t done = s_done;
+    const uint32_t total = s_total;
+    uint8_t msg[12] = { OTA_NT_STATE, (uint8_t)s_state, s_result,
+                        (uint8_t)(total > 0 ? (uint64_t)done * 100 / total : 0) };
+    put_le32(msg + 4, done);
+    put_le32(msg + 8, total);
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(msg, sizeof(msg));
+    if (om == NULL) {
+        ESP_LOGW(TAG, "No mbuf for state notification");
+        return;
+    }
+    const int rc = ble_gatts_notify_custom(s_conn, s_ctrl_handle, om);
+    if (rc != 0) {
+        ESP_LOGW(TAG, "State notification failed: %d", rc);
+    }
+}
+
+static void set_state(ota_state_t state, uint8_t result) {
+    s_state = state;
+    s_result = result;
+    notify_state();
+}
+
+// 三槽布局中 app0 是启动选择器，主程序只在 app1 / app2 之间轮换
+static const esp_partition_t *target_partition(const esp_partition_t *running) {
+    const char *other = strcmp(running->label, "app1") == 0 ? "app2"
+                      : strcmp(running->label, "app2") == 0 ? "app1" : NULL;
+    if (other != NULL) {
+        const esp_partition_t *p = esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+                                                            ESP_PARTITION_SUBTYPE_ANY, other);
+        if (p != NULL) {
+            return p;
+        }
+    }
+    return esp_ota_get_next_update_partition(NULL);
+}
+
+static int job_read_patch(void *ctx, uint8_t *buf, size_t len) {
+    ota_job_t *job = (ota_job_t *)ctx;
+    const size_t n = fread(buf, 1, len, job->fp);
+    return n > 0 ? (int)n : (ferror(job->fp) ? -1 : 0);
+}
+
+static bool job_read_old(void *ctx, uint32_t offset, uint8_t *buf, size_t len) {
+    ota_job_t *job = (ota_job_t *)ctx;
+    return esp_partition_read(job->running, offset, buf, len) == ESP_OK;
+}
+
+static bool job_write_new(void *ctx, const uint8_t *buf, size_t len) {
+    ota_job_t *job = (ota_job_t *)ctx;
+    return esp_ota_write(job->handle, buf, len) == ESP_OK;
+}
+
+static void job_progress(void *ctx, uint32_t done, uint32_t total) {
+    ota_job_t *job = (ota_job_t *)ctx;
+    s_done = done;
+    s_total = total;
+    const uint8_t pct = (uint8_t)((uint64_t)done * 100 / total);
+    if (pct >= job->last_pct + OTA_PROGRESS_STEP || done == total) {
+        job->last_pct = pct;
+        notify_state();
+    }
+}
+
+// 返回结果码（0 为成功）
+static uint8_t run_job(ota_job_t *job, ota_delta_t *d) {
+    const ota_delta_io_t io = {
+        .read_patch = job_read_patch,
+        .read_old = job_read_old,
+        .write_new = job_write_new,
+        .progress = job_progress,
+        .ctx = job,
+    };
+    ota_delta_result_t r = ota_delta_begin(d, &io);
+    if (r != OTA_DELTA_OK) {
+        return (uint8_t)r;
+    }
+    const esp_partition_t *target = target_partition(job->running);
+    if (target == NULL || target == job->running || d->hdr.new_size > target->size) {
+        ESP_LOGE(TAG, "No OTA slot for a %u-byte image", (unsigned)d->hdr.new_size);
+        return OTA_ERR_NO_SLOT;
+    }
+    s_total = d->hdr.new_size;
+    if (d->hdr.old_size > job->running->size) {
+        return OTA_DELTA_ERR_OLD;
+    }
+    r = ota_delta_check_old(d);
+    if (r != OTA_DELTA_OK) {
+        ESP_LOGE(TAG, "Patch base (%u bytes, CRC %08x) is not the running image",
+                 (unsigned)d->hdr.old_size, (unsigned)d->hdr.old_crc);
+        return (uint8_t)r;
+    }
+
+    ESP_LOGI(TAG, "Writing %u-byte image into %s", (unsigned)d->hdr.new_size, target->label);
+    if (esp_ota_begin(target, OTA_WITH_SEQUENTIAL_WRITES, &job->handle) != ESP_OK) {
+        return OTA_ERR_FLASH;
+    }
+    set_state(OTA_STATE_WRITING, 0);
+    r = ota_delta_run(d);
+    if (r != OTA_DELTA_OK) {
+        esp_ota_abort(job->handle);
+        return (uint8_t)r;
+    }
+    // esp_ota_end 校验镜像头与 SHA256，不完整的镜像不会被设为启动分区
+    esp_err_t err = esp_ota_end(job->handle);
+    if (err == ESP_OK) {
+        err = esp_ota_set_boot_partition(target);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Finalizing %s failed: %s", target->label, esp_err_to_name(err));
+        return OTA_ERR_FLASH;
+    }
+    ESP_LOGI(TAG, "Update ready in %s, active after reboot", target->label);
+    return 0;
+}
+
+static void ota_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("ble_ota", OTA_TASK_STACK);
+    power_manager_lock(POWER_LOCK_CPU);
+    power_manager_lock(POWER_LOCK_AWAKE);
+
+    ota_job_t job = { .running = esp_ota_get_running_partition() };
+    ota_delta_t *d = (ota_delta_t *)malloc(sizeof(ota_delta_t));
+    job.fp = fopen(s_path, "rb");
+    uint8_t result = OTA_ERR_REQUEST;
+    if (d != NULL && job.fp != NULL && job.running != NULL) {
+        result = run_job(&job, d);
+    } else {
+        ESP_LOGE(TAG, "Cannot open %s", s_path);
+    }
+    if (job.fp != NULL) {
+        fclose(job.fp);
+    }
+    free(d);
+    if (result != 0) {
+        ESP_LOGE(TAG, "Update failed: %u", result);
+    }
+
+    power_manager_unlock(POWER_LOCK_AWAKE);
+    power_manager_unlock(POWER_LOCK_CPU);
+    s_task = NULL;
+    set_state(result == 0 ? OTA_STATE_READY : OTA_STATE_FAILED, result);
+    stack_stats_task_exit();
+    vTaskDelete(NULL);
+}
+
+static void handle_apply(const uint8_t *cmd, size_t len) {
+    const size_t path_len = len - 1;
+    char rel[OTA_PATH_MAX + 1];
+    if (s_task != NULL || path_len == 0 || path_len > OTA_PATH_MAX) {
+        set_state(s_task != NULL ? s_state : OTA_STATE_FAILED, OTA_ERR_REQUEST);
+        return;
+    }
+    memcpy(rel, cmd + 1, path_len);
+    rel[path_len] = '\0';
+    if (!sd_path_is_safe(rel)) {
+        set_state(OTA_STATE_FAILED, OTA_ERR_REQUEST);
+        return;
+    }
+    snprintf(s_path, sizeof(s_path), SD_PATH_ROOT "%s", rel);
+    s_done = 0;
+    s_total = 0;
+    s_state = OTA_STATE_CHECKING;
+    s_result = 0;
+    if (xTaskCreate(ota_task, "ble_ota", OTA_TASK_STACK, NULL, OTA_TASK_PRIO, &s_task) != pdPASS) {
+        s_task = NULL;
+        set_state(OTA_STATE_FAILED, OTA_ERR_REQUEST);
+        return;
+    }
+    ESP_LOGI(TAG, "Applying %s", s_path);
+    notify_state();
+}
+
+// 切回另一个分区中的旧固件：待验证时交给引导程序回滚，否则直接改启动分区
+static void handle_rollback(void) {
+    if (s_task != NULL) {
+        set_state(s_state, OTA_ERR_REQUEST);
+        return;
+    }
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    esp_ota_img_states_t img_state;
+    if (esp_ota_get_state_partition(running, &img_state) == ESP_OK &&
+        img_state == ESP_OTA_IMG_PENDING_VERIFY) {
+        ESP_LOGW(TAG, "Rolling back unverified image");
+        esp_ota_mark_app_invalid_rollback_and_reboot();
+    }
+    const esp_partition_t *other = target_partition(running);
+    esp_app_desc_t desc;
+    if (other == NULL || other == running ||
+        esp_ota_get_partition_description(other, &desc) != ESP_OK ||
+        esp_ota_set_boot_partition(other) != ESP_OK) {
+        set_state(OTA_STATE_FAILED, OTA_ERR_ROLLBACK);
+        return;
+    }
+    ESP_LOGW(TAG, "Switching back to %s (%s), rebooting", other->label, desc.version);
+    set_state(OTA_STATE_IDLE, 0);
+    vTaskDelay(pdMS_TO_TICKS(OTA_REBOOT_DELAY_MS));
+    esp_restart();
+}
+
+static int ctrl_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                           struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t cmd[1 + OTA_PATH_MAX];
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len == 0 || len > sizeof(cmd)) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    os_mbuf_copydata(ctxt->om, 0, len, cmd);
+    s_conn = conn_handle;
+
+    switch (cmd[0]) {
+    case OTA_OP_APPLY:
+        handle_apply(cmd, len);
+        return 0;
+    case OTA_OP_STATUS:
+        notify_state();
+        return 0;
+    case OTA_OP_REBOOT:
+        if (s_state != OTA_STATE_READY) {
+            set_state(s_state, OTA_ERR_REQUEST);
+            return 0;
+        }
+        ESP_LOGI(TAG, "Rebooting into the new image");
+        vTaskDelay(pdMS_TO_TICKS(OTA_REBOOT_DELAY_MS));
+        esp_restart();
+        return 0;
+    case OTA_OP_ROLLBACK:
+        handle_rollback();
+        return 0;
+    default:
+        return BLE_ATT_ERR_REQ_NOT_SUPPORTED;
+    }
+}
+
+static const struct ble_gatt_svc_def s_ota_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = BLE_UUID16_DECLARE(OTA_SERVICE_UUID),
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = BLE_UUID16_DECLARE(OTA_CTRL_CHAR_UUID),
+                .access_cb = ctrl_chr_access,
+                .val_handle = &s_ctrl_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+            },
+            {
+                0,
+            }
+        }
+    },
+    {
+        0,
+    }
+};
+
+int ble_ota_gatt_init(void) {
+    int rc = ble_gatts_count_cfg(s_ota_svcs);
+    if (rc != 0) {
+        return rc;
+    }
+    return ble_gatts_add_svcs(s_ota_svcs);
+}
+
+void ble_ota_on_subscribe(uint16_t attr_handle, bool notify_on) {
+    if (attr_handle == s_ctrl_handle) {
+        s_notify = notify_on;
+    }
+}
+
+void ble_ota_on_disconnect(void) {
+    if (s_task != NULL) {
+        ESP_LOGI(TAG, "Disconnected during update, continuing from %s", s_path);
+    }
+    s_notify = false;
+}
+
+bool ble_ota_busy(void) {
+    return s_task != NULL;
+}
+
+void ble_ota_boot_check(void) {
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    esp_ota_img_states_t state;
+    if (running == NULL || esp_ota_get_state_partition(running, &state) != ESP_OK) {
+        ESP_LOGI(TAG, "Running from %s (no OTA state)", running ? running->label : "?");
+        return;
+    }
+    ESP_LOGI(TAG, "Running from %s%s", running->label,
+             state == ESP_OTA_IMG_PENDING_VERIFY ? ", pending verification" : "");
+}
+
+void ble_ota_mark_valid(void) {
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    esp_ota_img_states_t state;
+    if (running != NULL && esp_ota_get_state_partition(running, &state) == ESP_OK &&
+        state == ESP_OTA_IMG_PENDING_VERIFY) {
+        esp_ota_mark_app_valid_cancel_rollback();
+        ESP_LOGI(TAG, "New image in %s confirmed, rollback cancelled", running->label);
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ble_ota.h
+ * @brief BLE 固件更新服务：把 SD 卡上的 X4DL 差分补丁解到空闲 OTA 分区，支持回滚
+ *
+ * 补丁先用文件传输服务（ble_xfer.h）发到 SD 卡：该服务有窗口流控、CRC 和断点续传，
+ * 链路断开不会留下写了一半的分区。随后手机向本服务的控制特征发 APPLY，后台任务
+ * 检查补丁基于的旧镜像与正在运行的一致，边解码（ota_delta.h）边写入目标分区，
+ * 通过通知报告进度；写完由 esp_ota_end 校验镜像再设为启动分区，手机发 REBOOT 或
+ * 用户下次重启时进入新固件。
+ *
+ * 目标分区：三槽布局（partitions_with_app2.csv，app0 是启动选择器）在 app1/app2 之间轮换，
+ * 其它 OTA 布局用 esp_ota_get_next_update_partition；只有 factory 分区时 APPLY 返回错误。
+ *
+ * 回滚（CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE）：新固件首次启动处于待验证状态，
+ * 首屏渲染完成后 ble_ota_mark_valid 确认；确认前复位，引导程序回到旧固件。
+ * 确认之后手机仍可发 ROLLBACK 切回另一个分区中的旧固件
+ *
+ * 协议字节布局见 main.c 中的说明
+ */
+
+#ifndef BLE_OTA_H
+#define BLE_OTA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define OTA_SERVICE_UUID          0x1236
+#define OTA_CTRL_CHAR_UUID        0x5690
+
+/**
+ * @brief 注册 OTA 服务（在 ble_gatts_add_svcs 阶段调用，与其它服务一起）
+ * @return NimBLE 错误码，0 为成功
+ */
+int ble_ota_gatt_init(void);
+
+/**
+ * @brief 订阅事件（main.c 的 GAP 回调转发）
+ */
+void ble_ota_on_subscribe(uint16_t attr_handle, bool notify);
+
+/**
+ * @brief 连接断开：停止通知，进行中的写入继续（补丁在 SD 卡上）
+ */
+void ble_ota_on_disconnect(void);
+
+/**
+ * @brief 是否正在写入分区（期间不要浅睡眠、不要关闭 BLE）
+ */
+bool ble_ota_busy(void);
+
+/**
+ * @brief 启动时打印当前分区与验证状态（app_main 早期调用）
+ */
+void ble_ota_boot_check(void);
+
+/**
+ * @brief 新固件运行正常（首屏渲染完成后调用）：取消待验证状态，不再回滚
+ */
+void ble_ota_mark_valid(void);
+
+#endif // BLE_OTA_H
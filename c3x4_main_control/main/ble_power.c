@@ -0,0 +1,89 @@
+/**
+ * @file ble_power.c
+ * @brief 按需启动 BLE 的调度实现
+ */
+
+#include "ble_power.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "BLE_POWER";
+
+static ble_power_config_t s_cfg;
+static lv_timer_t *s_timer = NULL;
+static int64_t s_busy_us = 0;     // 最近一次看到连接/传输的时间
+static ble_power_profile_t s_profile = BLE_POWER_PROFILE_LEAN;
+
+static void ble_power_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (!ble_power_is_on()) {
+        return;
+    }
+    const int64_t now = esp_timer_get_time();
+    if (s_cfg.is_idle == NULL || !s_cfg.is_idle()) {
+        s_busy_us = now;
+        return;
+    }
+    if (s_profile == BLE_POWER_PROFILE_FULL && now - s_busy_us >= (int64_t)BLE_POWER_LEAN_MS * 1000) {
+        ESP_LOGI(TAG, "Transfers done, back to the lean profile");
+        ble_power_set_profile(BLE_POWER_PROFILE_LEAN);
+    }
+    if (s_cfg.idle_ms > 0 && now - s_busy_us >= (int64_t)s_cfg.idle_ms * 1000) {
+        ESP_LOGI(TAG, "No BLE activity for %u s, stopping", (unsigned)(s_cfg.idle_ms / 1000));
+        ble_power_set(false);
+    }
+}
+
+void ble_power_init(const ble_power_config_t *cfg) {
+    if (cfg != NULL) {
+        s_cfg = *cfg;
+    }
+    if (s_timer == NULL) {
+        s_timer = lv_timer_create(ble_power_timer_cb, BLE_POWER_POLL_MS, NULL);
+    }
+}
+
+bool ble_power_set(bool on) {
+    if (on == ble_power_is_on()) {
+        return true;
+    }
+    if (on) {
+        if (s_cfg.start == NULL || !s_cfg.start()) {
+            ESP_LOGE(TAG, "BLE start failed");
+            return false;
+        }
+        s_busy_us = esp_timer_get_time();
+        ESP_LOGI(TAG, "BLE started on demand");
+        return true;
+    }
+    if (s_cfg.stop == NULL || !s_cfg.stop()) {
+        ESP_LOGW(TAG, "BLE busy, not stopped");
+        return false;
+    }
+    ble_power_set_profile(BLE_POWER_PROFILE_LEAN);
+    ESP_LOGI(TAG, "BLE stopped");
+    return true;
+}
+
+void ble_power_set_profile(ble_power_profile_t profile) {
+    if (profile == s_profile) {
+        return;
+    }
+    s_profile = profile;
+    if (profile == BLE_POWER_PROFILE_FULL) {
+        // 从现在起重新计算退回精简档的空闲时间
+        s_busy_us = esp_timer_get_time();
+    }
+    if (s_cfg.set_profile != NULL) {
+        s_cfg.set_profile(profile);
+    }
+}
+
+ble_power_profile_t ble_power_get_profile(void) {
+    return s_profile;
+}
+
+bool ble_power_is_on(void) {
+    return s_cfg.is_running != NULL && s_cfg.is_running();
+}
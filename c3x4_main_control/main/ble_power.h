@@ -0,0 +1,65 @@
+/**
+ * @file ble_power.h
+ * @brief 按需启动 BLE：开机不初始化协议栈，由设置页开关或首页长按启动，空闲超时后关闭
+ *
+ * NimBLE 控制器 + 主机常驻占用的堆足够放下阅读器的字形和页面缓存，而大部分阅读时间
+ * 并不需要蓝牙。协议栈的启动/关闭由 main.c 通过回调提供（BLE 代码都在 main.c 中），
+ * 这里只负责调度：LVGL 定时器每 BLE_POWER_POLL_MS 检查一次，协议栈运行且连续
+ * idle_ms 没有连接、没有待写入的文件时调用 stop 关闭
+ *
+ * 协议栈运行时还分两档内存配置。精简档（默认，阅读时）只有按单连接配好池的协议栈，
+ * 批量传输的 SD 写入缓冲区在第一次收文件时才分配、断开后立即释放；完整档（进入
+ * "BLE Reader" 准备传书时）预先分配写入缓冲区并在断开之间保留。完整档在连续
+ * BLE_POWER_LEAN_MS 空闲后自动退回精简档，释放的堆由缓存预算交给字形和页面缓存
+ *
+ * 所有函数都在 LVGL 任务中调用（启动/关闭会阻塞几百毫秒）
+ */
+
+#ifndef BLE_POWER_H
+#define BLE_POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BLE_POWER_IDLE_MS_DEFAULT (5 * 60 * 1000)   // 无连接多久后关闭 BLE
+#define BLE_POWER_POLL_MS         5000
+#define BLE_POWER_LEAN_MS         (60 * 1000)        // 完整档空闲多久后退回精简档
+
+typedef enum {
+    BLE_POWER_PROFILE_LEAN = 0,     // 传输缓冲区按需分配、断开即释放
+    BLE_POWER_PROFILE_FULL,         // 传输缓冲区预先分配并保留
+} ble_power_profile_t;
+
+typedef struct {
+    bool (*start)(void);        // 初始化并开始广播，返回是否成功
+    bool (*stop)(void);         // 关闭协议栈并释放内存，返回 false 表示正忙（传输中）
+    bool (*is_running)(void);   // 协议栈当前是否运行（Wi-Fi 传输模式也会关闭它）
+    bool (*is_idle)(void);      // 没有连接、没有进行中的传输
+    void (*set_profile)(ble_power_profile_t profile);   // 切换内存配置（协议栈未运行时也会调用）
+    uint32_t idle_ms;           // 空闲多久后自动关闭（0 = 不自动关闭）
+} ble_power_config_t;
+
+/**
+ * @brief 注册空闲检查定时器（在 LVGL 初始化后、LVGL 定时器任务启动前调用）
+ */
+void ble_power_init(const ble_power_config_t *cfg);
+
+/**
+ * @brief 打开或关闭 BLE（同步执行）
+ * @return 操作后 BLE 是否处于请求的状态
+ */
+bool ble_power_set(bool on);
+
+/**
+ * @brief 切换内存配置（协议栈未运行时在下次启动时生效）
+ */
+void ble_power_set_profile(ble_power_profile_t profile);
+
+ble_power_profile_t ble_power_get_profile(void);
+
+/**
+ * @brief BLE 协议栈是否正在运行
+ */
+bool ble_power_is_on(void);
+
+#endif // BLE_POWER_H
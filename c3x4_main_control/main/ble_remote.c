@@ -0,0 +1,166 @@
+/**
+ * @file ble_remote.c
+ * @brief BLE 翻页器输入实现
+ *
+ * 写入回调在 NimBLE 主机任务中执行，只把事件放进按键队列；连接参数的更新可能来自
+ * 主机任务（第一次输入）或 LVGL 任务（阅读器开关），NimBLE 的 GAP 接口自己加锁
+ */
+
+#include "ble_remote.h"
+#include "buttons.h"
+#include "esp_log.h"
+#include "host/ble_hs.h"
+#include "host/ble_uuid.h"
+#include <string.h>
+
+static const char *TAG = "BLE_REMOTE";
+
+#define REMOTE_EVENT_LEN     3
+#define REMOTE_PAGE_KEYBOARD 0x07
+#define REMOTE_PAGE_CONSUMER 0x0C
+
+static uint16_t s_handle = 0;
+static volatile bool s_remote = false;      // 当前连接写过输入事件
+static volatile uint16_t s_conn = 0;
+static volatile bool s_reading = false;
+static volatile button_t s_held = BTN_NONE; // 按下后还没有释放的键
+
+typedef struct {
+    uint8_t page;
+    uint8_t usage;
+    button_t button;
+} remote_key_t;
+
+static const remote_key_t s_keys[] = {
+    { REMOTE_PAGE_KEYBOARD, 0x4E, BTN_RIGHT },        // PageDown
+    { REMOTE_PAGE_KEYBOARD, 0x4F, BTN_RIGHT },        // →
+    { REMOTE_PAGE_KEYBOARD, 0x51, BTN_RIGHT },        // ↓
+    { REMOTE_PAGE_KEYBOARD, 0x2C, BTN_RIGHT },        // 空格
+    { REMOTE_PAGE_KEYBOARD, 0x4B, BTN_LEFT },         // PageUp
+    { REMOTE_PAGE_KEYBOARD, 0x50, BTN_LEFT },         // ←
+    { REMOTE_PAGE_KEYBOARD, 0x52, BTN_LEFT },         // ↑
+    { REMOTE_PAGE_KEYBOARD, 0x28, BTN_CONFIRM },      // Enter
+    { REMOTE_PAGE_KEYBOARD, 0x29, BTN_BACK },         // Esc
+    { REMOTE_PAGE_CONSUMER, 0xE9, BTN_VOLUME_UP },    // 音量+
+    { REMOTE_PAGE_CONSUMER, 0xEA, BTN_VOLUME_DOWN },  // 音量-
+    { REMOTE_PAGE_CONSUMER, 0xB5, BTN_RIGHT },        // 下一曲
+    { REMOTE_PAGE_CONSUMER, 0xB6, BTN_LEFT },         // 上一曲
+    { REMOTE_PAGE_CONSUMER, 0xCD, BTN_CONFIRM },      // 播放/暂停
+};
+
+static button_t map_key(uint8_t page, uint8_t usage) {
+    for (size_t i = 0; i < sizeof(s_keys) / sizeof(s_keys[0]); i++) {
+        if (s_keys[i].page == page && s_keys[i].usage == usage) {
+            return s_keys[i].button;
+        }
+    }
+    return BTN_NONE;
+}
+
+// 阅读时最短间隔、不跳连接事件；其余时间放宽。对端可能拒绝，只记录
+static void apply_params(void) {
+    if (!s_remote) {
+        return;
+    }
+    const bool fast = s_reading;
+    const struct ble_gap_upd_params params = {
+        .itvl_min = fast ? BLE_REMOTE_READING_ITVL_MIN : BLE_REMOTE_IDLE_ITVL_MIN,
+        .itvl_max = fast ? BLE_REMOTE_READING_ITVL_MAX : BLE_REMOTE_IDLE_ITVL_MAX,
+        .latency = fast ? 0 : BLE_REMOTE_IDLE_LATENCY,
+        .supervision_timeout = BLE_REMOTE_SUPERVISION_TO,
+        .min_ce_len = 0,
+        .max_ce_len = 0,
+    };
+    const int rc = ble_gap_update_params(s_conn, &params);
+    if (rc != 0 && rc != BLE_HS_EALREADY) {
+        ESP_LOGW(TAG, "Connection parameter update failed: %d", rc);
+    } else {
+        ESP_LOGI(TAG, "Remote link %s", fast ? "low latency (reading)" : "relaxed");
+    }
+}
+
+static void post_key(button_t button, bool pressed) {
+    if (pressed) {
+        // 快速通道只跟踪一个按住的键：先释放上一个
+        if (s_held != BTN_NONE && s_held != button) {
+            buttons_inject(s_held, false);
+        }
+        s_held = button;
+    } else if (s_held == button) {
+        s_held = BTN_NONE;
+    }
+    buttons_inject(button, pressed);
+}
+
+static int remote_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                             struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t buf[REMOTE_EVENT_LEN * 8];
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len == 0 || len % REMOTE_EVENT_LEN != 0 || len > sizeof(buf) ||
+        ble_hs_mbuf_to_flat(ctxt->om, buf, sizeof(buf), NULL) != 0) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    if (!s_remote || s_conn != conn_handle) {
+        s_conn = conn_handle;
+        s_remote = true;
+        ESP_LOGI(TAG, "Remote on connection %u", conn_handle);
+        apply_params();
+    }
+    for (uint16_t i = 0; i < len; i += REMOTE_EVENT_LEN) {
+        const button_t button = map_key(buf[i], buf[i + 1]);
+        if (button != BTN_NONE) {
+            post_key(button, buf[i + 2] != 0);
+        }
+    }
+    return 0;
+}
+
+static const struct ble_gatt_svc_def s_remote_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = BLE_UUID16_DECLARE(REMOTE_SERVICE_UUID),
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = BLE_UUID16_DECLARE(REMOTE_INPUT_CHAR_UUID),
+                .access_cb = remote_chr_access,
+                .val_handle = &s_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_NO_RSP,
+            },
+            {
+                0,
+            }
+        }
+    },
+    {
+        0,
+    }
+};
+
+int ble_remote_gatt_init(void) {
+    int rc = ble_gatts_count_cfg(s_remote_svcs);
+    if (rc != 0) {
+        return rc;
+    }
+    return ble_gatts_add_svcs(s_remote_svcs);
+}
+
+void ble_remote_on_disconnect(void) {
+    s_remote = false;
+    if (s_held != BTN_NONE) {
+        buttons_inject(s_held, false);
+        s_held = BTN_NONE;
+    }
+}
+
+void ble_remote_set_reading(bool reading) {
+    if (s_reading == reading) {
+        return;
+    }
+    s_reading = reading;
+    apply_params();
+}
@@ -0,0 +1,52 @@
+/**
+ * @file ble_remote.h
+ * @brief BLE 翻页器输入：遥控器（或把 HID 翻页器转发过来的手机）写入按键事件，
+ *        放进按键队列，和侧键一样走 LVGL 任务的快速通道
+ *
+ * 输入特征（写入，可无响应）的内容是若干个 3 字节事件：
+ *   page u8 | usage u8 | pressed u8
+ * page/usage 为 HID 用法页与用法，按翻页器常发的键映射：
+ *   键盘页 0x07：PageDown、→、↓、空格 = 下一页（BTN_RIGHT）；PageUp、←、↑ = 上一页（BTN_LEFT）；
+ *                Enter = 确认；Esc = 返回
+ *   消费者页 0x0C：音量+ / 音量- = BTN_VOLUME_UP / BTN_VOLUME_DOWN；下一曲 / 上一曲 = 下一页 / 上一页；
+ *                  播放/暂停 = 确认
+ * 其它键忽略。按住不放由快速通道产生重复，和侧键相同；断开时补发未释放键的释放事件。
+ *
+ * 连接参数：写过输入事件的连接在阅读器打开期间用最短的连接间隔、从机延迟 0
+ * （中心设备的写入要等到下一个连接事件，从机延迟会让它等得更久），
+ * 其余时间放宽到 BLE_REMOTE_IDLE_ITVL_* 并允许跳过 BLE_REMOTE_IDLE_LATENCY 个连接事件
+ */
+
+#ifndef BLE_REMOTE_H
+#define BLE_REMOTE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REMOTE_SERVICE_UUID          0x1238
+#define REMOTE_INPUT_CHAR_UUID       0x56B0
+
+#define BLE_REMOTE_READING_ITVL_MIN  6       // x 1.25 ms = 7.5 ms
+#define BLE_REMOTE_READING_ITVL_MAX  12      // x 1.25 ms = 15 ms
+#define BLE_REMOTE_IDLE_ITVL_MIN     80      // x 1.25 ms = 100 ms
+#define BLE_REMOTE_IDLE_ITVL_MAX     120     // x 1.25 ms = 150 ms
+#define BLE_REMOTE_IDLE_LATENCY      4
+#define BLE_REMOTE_SUPERVISION_TO    400     // x 10 ms = 4 s
+
+/**
+ * @brief 注册翻页器服务（在 ble_gatts_add_svcs 阶段调用，与其它服务一起）
+ * @return NimBLE 错误码，0 为成功
+ */
+int ble_remote_gatt_init(void);
+
+/**
+ * @brief 连接断开：释放仍按住的键
+ */
+void ble_remote_on_disconnect(void);
+
+/**
+ * @brief 阅读器打开/关闭（LVGL 任务中调用），翻页器的连接随之切换连接参数
+ */
+void ble_remote_set_reading(bool reading);
+
+#endif // BLE_REMOTE_H
@@ -0,0 +1,299 @@
+/**
+ * @file ble_shot.c
+ * @brief BLE 截图服务实现
+ *
+ * 控制特征的回调在 NimBLE 主机任务中执行，只提交作业；压缩与发送在 bg_jobs 的
+ * 工作任务中分步进行：一步压缩一段或把一段发完。通知的 mbuf 用完时让出一会儿再发，
+ * 不在主机任务里等待
+ */
+
+#include "ble_shot.h"
+#include "EPD_4in26.h"
+#include "bg_jobs.h"
+#include "lvgl_driver.h"
+#include "packbits.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host/ble_hs.h"
+#include "host/ble_uuid.h"
+#include <string.h>
+
+static const char *TAG = "BLE_SHOT";
+
+#define SHOT_LOCK_MS         50       // 每段等读锁的上限，等不到下一步再试
+#define SHOT_CONGEST_MS      10       // 通知缓冲用完时让出的时间
+#define SHOT_NT_HDR          3        // 数据通知的操作码与序号
+#define SHOT_ATT_HDR         3        // ATT 通知头（操作码 + 句柄）
+
+// 控制特征操作码（手机 -> 设备）
+#define SHOT_OP_CAPTURE      0x01
+#define SHOT_OP_ABORT        0x02
+// 通知操作码（设备 -> 手机）
+#define SHOT_NT_BEGIN        0xA1
+#define SHOT_NT_DATA         0xA2
+#define SHOT_NT_END          0xA3
+
+// 状态码
+#define SHOT_OK              0
+#define SHOT_ERR_BUSY        1        // 已有截图在进行
+#define SHOT_ERR_NO_FB       2        // 灰阶模式或 framebuffer 不可用
+#define SHOT_ERR_ABORTED     3        // 手机取消、断开或内存不足
+#define SHOT_ERR_NO_MEM      4
+
+#define SHOT_FLAG_CHANGED    0x01     // 传输期间画面变过（END 通知的标志）
+
+typedef struct {
+    uint32_t offset;                  // 下一段的原始偏移
+    uint32_t sent;                    // 已发出的压缩字节
+    uint32_t crc;
+    uint32_t generation;
+    uint16_t seq;
+    uint16_t out_len;
+    uint16_t out_pos;
+    uint8_t *out;                     // 一段压缩数据，PACKBITS_BOUND(SHOT_WINDOW) 字节
+    bool finished;
+} shot_job_t;
+
+static uint16_t s_handle = 0;
+static bool s_notify = false;
+static uint16_t s_conn = 0;
+static bg_job_id_t s_job_id = BG_JOB_NONE;
+static shot_job_t s_job;
+
+static void put_le16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// 返回 NimBLE 错误码；BLE_HS_ENOMEM 表示暂时没有缓冲，稍后重发
+static int notify(const uint8_t *hdr, size_t hdr_len, const uint8_t *data, size_t len) {
+    if (!s_notify || s_handle == 0) {
+        return BLE_HS_ENOTCONN;
+    }
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(hdr, hdr_len);
+    if (om == NULL) {
+        return BLE_HS_ENOMEM;
+    }
+    if (len > 0 && os_mbuf_append(om, data, len) != 0) {
+        os_mbuf_free_chain(om);
+        return BLE_HS_ENOMEM;
+    }
+    return ble_gatts_notify_custom(s_conn, s_handle, om);
+}
+
+static void notify_begin(uint8_t status) {
+    uint8_t msg[12] = { SHOT_NT_BEGIN, status };
+    put_le16(msg + 2, EPD_4in26_WIDTH);
+    put_le16(msg + 4, EPD_4in26_HEIGHT);
+    put_le32(msg + 6, (uint32_t)lvgl_fb_size());
+    put_le16(msg + 10, SHOT_WINDOW);
+    if (notify(msg, sizeof(msg), NULL, 0) != 0) {
+        ESP_LOGW(TAG, "BEGIN notification failed");
+    }
+}
+
+static void notify_end(uint8_t status, uint8_t flags) {
+    uint8_t msg[11] = { SHOT_NT_END, status, flags };
+    put_le32(msg + 3, s_job.sent);
+    put_le32(msg + 7, s_job.crc);
+    // 结束通知必须送到：缓冲用完时等一会儿
+    for (int tries = 0; tries < 50 && notify(msg, sizeof(msg), NULL, 0) == BLE_HS_ENOMEM; tries++) {
+        vTaskDelay(pdMS_TO_TICKS(SHOT_CONGEST_MS));
+    }
+}
+
+// 压缩下一段：只在持有读锁期间访问 framebuffer
+static bool compress_window(shot_job_t *job) {
+    const uint8_t *fb = lvgl_fb_read_begin(SHOT_LOCK_MS);
+    if (fb == NULL) {
+        return false;
+    }
+    const size_t size = lvgl_fb_size();
+    size_t n = size - job->offset;
+    if (n > SHOT_WINDOW) {
+        n = SHOT_WINDOW;
+    }
+    job->out_len = (uint16_t)packbits_encode(fb + job->offset, n, job->out);
+    job->crc = esp_rom_crc32_le(job->crc, fb + job->offset, n);
+    lvgl_fb_read_end();
+    job->offset += (uint32_t)n;
+    job->out_pos = 0;
+    return true;
+}
+
+// 把当前段按 MTU 切片发出；缓冲用完返回 false（稍后继续）
+static bool send_window(shot_job_t *job) {
+    const uint16_t mtu = ble_att_mtu(s_conn);
+    const size_t chunk = mtu > SHOT_ATT_HDR + SHOT_NT_HDR ? mtu - SHOT_ATT_HDR - SHOT_NT_HDR : 1;
+    while (job->out_pos < job->out_len) {
+        size_t n = job->out_len - job->out_pos;
+        if (n > chunk) {
+            n = chunk;
+        }
+        uint8_t hdr[SHOT_NT_HDR] = { SHOT_NT_DATA };
+        put_le16(hdr + 1, job->seq);
+        const int rc = notify(hdr, sizeof(hdr), job->out + job->out_pos, n);
+        if (rc == BLE_HS_ENOMEM) {
+            return false;
+        }
+        if (rc != 0) {
+            ESP_LOGW(TAG, "Data notification failed: %d", rc);
+            return true;  // 连接已断开，作业随后被取消
+        }
+        job->seq++;
+        job->out_pos = (uint16_t)(job->out_pos + n);
+        job->sent += (uint32_t)n;
+    }
+    return true;
+}
+
+static bool shot_step(bg_job_t *bg, void *arg) {
+    shot_job_t *job = (shot_job_t *)arg;
+    if (bg_job_cancelled(bg) || !s_notify) {
+        return false;
+    }
+    if (job->out == NULL) {
+        // 在 done 中释放（取消时作业不再有下一步）；预算只用于低内存时推迟开始
+        job->out = (uint8_t *)heap_stats_malloc(HEAP_TAG_BLE, PACKBITS_BOUND(SHOT_WINDOW));
+        if (job->out == NULL) {
+            return false;
+        }
+    }
+    if (job->out_pos < job->out_len) {
+        if (!send_window(job)) {
+            vTaskDelay(pdMS_TO_TICKS(SHOT_CONGEST_MS));
+        }
+        return true;
+    }
+    if (job->offset >= lvgl_fb_size()) {
+        job->finished = true;
+        return false;
+    }
+    if (!compress_window(job)) {
+        vTaskDelay(pdMS_TO_TICKS(SHOT_LOCK_MS));
+    }
+    return true;
+}
+
+static void shot_done(void *arg, bool finished) {
+    shot_job_t *job = (shot_job_t *)arg;
+    heap_stats_free(HEAP_TAG_BLE, job->out);
+    job->out = NULL;
+    const bool ok = finished && job->finished;
+    const uint8_t flags = lvgl_fb_generation() != job->generation ? SHOT_FLAG_CHANGED : 0;
+    notify_end(ok ? SHOT_OK : SHOT_ERR_ABORTED, flags);
+    if (ok) {
+        ESP_LOGI(TAG, "Screenshot sent: %u -> %lu bytes%s", (unsigned)lvgl_fb_size(),
+                 (unsigned long)job->sent, flags ? " (screen changed meanwhile)" : "");
+    } else {
+        ESP_LOGW(TAG, "Screenshot aborted after %lu bytes", (unsigned long)job->sent);
+    }
+    s_job_id = BG_JOB_NONE;
+}
+
+static void handle_capture(void) {
+    if (s_job_id != BG_JOB_NONE && bg_jobs_is_pending(s_job_id)) {
+        notify_begin(SHOT_ERR_BUSY);
+        return;
+    }
+    if (lvgl_is_grayscale() || lvgl_fb_size() == 0) {
+        notify_begin(SHOT_ERR_NO_FB);
+        return;
+    }
+    memset(&s_job, 0, sizeof(s_job));
+    s_job.generation = lvgl_fb_generation();
+    const bg_job_desc_t desc = {
+        .name = "ble_shot",
+        .prio = BG_JOB_PRIO_HIGH,
+        .mem_budget = PACKBITS_BOUND(SHOT_WINDOW),
+        .step = shot_step,
+        .done = shot_done,
+        .arg = &s_job,
+        .flags = BG_JOB_FLAG_CPU,   // 只读 framebuffer、发通知，不碰 SD 卡
+    };
+    // BEGIN 先于作业提交发出，数据通知不会跑到它前面
+    notify_begin(SHOT_OK);
+    s_job_id = bg_jobs_submit(&desc);
+    if (s_job_id == BG_JOB_NONE) {
+        notify_end(SHOT_ERR_NO_MEM, 0);
+    }
+}
+
+static int shot_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                           struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t op = 0;
+    if (OS_MBUF_PKTLEN(ctxt->om) != 1 || os_mbuf_copydata(ctxt->om, 0, 1, &op) != 0) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    s_conn = conn_handle;
+
+    switch (op) {
+    case SHOT_OP_CAPTURE:
+        handle_capture();
+        return 0;
+    case SHOT_OP_ABORT:
+        if (s_job_id != BG_JOB_NONE) {
+            bg_jobs_cancel(s_job_id);
+        }
+        return 0;
+    default:
+        return BLE_ATT_ERR_REQ_NOT_SUPPORTED;
+    }
+}
+
+static const struct ble_gatt_svc_def s_shot_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = BLE_UUID16_DECLARE(SHOT_SERVICE_UUID),
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = BLE_UUID16_DECLARE(SHOT_CHAR_UUID),
+                .access_cb = shot_chr_access,
+                .val_handle = &s_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+            },
+            {
+                0,
+            }
+        }
+    },
+    {
+        0,
+    }
+};
+
+int ble_shot_gatt_init(void) {
+    int rc = ble_gatts_count_cfg(s_shot_svcs);
+    if (rc != 0) {
+        return rc;
+    }
+    return ble_gatts_add_svcs(s_shot_svcs);
+}
+
+void ble_shot_on_subscribe(uint16_t attr_handle, bool notify_on) {
+    if (attr_handle == s_handle) {
+        s_notify = notify_on;
+    }
+}
+
+void ble_shot_on_disconnect(void) {
+    s_notify = false;
+    if (s_job_id != BG_JOB_NONE) {
+        bg_jobs_cancel(s_job_id);
+    }
+}
@@ -0,0 +1,42 @@
+/**
+ * @file ble_shot.h
+ * @brief BLE 截图服务：把 EPD framebuffer 压缩后经通知发回手机（外场远程目视检查）
+ *
+ * 手机向控制特征写 CAPTURE 后，后台作业（bg_jobs）按 SHOT_WINDOW 字节一段读取
+ * framebuffer：每段只在持有读锁期间 PackBits 压缩到小缓冲区，随即释放，不复制整帧、
+ * 也不长时间占着锁挡住刷新任务。压缩数据按协商的 MTU 切成通知发出，各段的 PackBits
+ * 首尾相接就是整帧的 PackBits（与 packbits_read 相同），解压后是面板布局的 1bpp 画面
+ * （每行 100 字节，高位在左，1 为白色）。
+ * 各段在不同时刻读取，传输期间界面重绘时画面可能由前后两帧拼成；结束通知带整帧
+ * 原始数据的 CRC32 与重绘标志，手机可据此重新截取
+ *
+ * 协议字节布局见 main.c 中的说明
+ */
+
+#ifndef BLE_SHOT_H
+#define BLE_SHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SHOT_SERVICE_UUID    0x1237
+#define SHOT_CHAR_UUID       0x56A0
+#define SHOT_WINDOW          4096     // 每次持锁压缩的原始字节数
+
+/**
+ * @brief 注册截图服务（在 ble_gatts_add_svcs 阶段调用，与其它服务一起）
+ * @return NimBLE 错误码，0 为成功
+ */
+int ble_shot_gatt_init(void);
+
+/**
+ * @brief 订阅事件（main.c 的 GAP 回调转发）
+ */
+void ble_shot_on_subscribe(uint16_t attr_handle, bool notify);
+
+/**
+ * @brief 连接断开：取消进行中的截图
+ */
+void ble_shot_on_disconnect(void);
+
+#endif // BLE_SHOT_H
@@ -0,0 +1,437 @@
+/**
+ * @file ble_writer.c
+ * @brief BLE 接收文件的异步 SD 写入实现
+ *
+ * 环形缓冲区用 FreeRTOS 流缓冲区（单生产者、单消费者），里面是连续的记录：
+ * 4 字节记录头 {类型, 槽位, 长度} 后跟 长度 字节负载（OPEN 为 4 字节续写偏移、4 字节预分配长度加路径，
+ * DATA 为文件内容，COMMIT 为改名后的路径）。
+ * 生产者先确认整条记录放得下再写，所以消费者读到记录头后一定能读完负载
+ */
+
+#include "ble_writer.h"
+#include "stack_stats.h"
+#include "mem_pressure.h"
+#include "esp_log.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/stream_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static const char *TAG = "BLE_WRITER";
+
+#define WRITER_TASK_STACK    4096
+#define WRITER_TASK_PRIO     4
+#define WRITER_HIGH_WATER    (BLE_WRITER_RING_SIZE * 3 / 4)
+#define WRITER_LOW_WATER     (BLE_WRITER_RING_SIZE / 4)
+#define WRITER_CLOSE_WAIT_MS 2000
+#define WRITER_QUIT_WAIT_MS  500
+#define WRITER_MOUNT_POINT   "/sdcard"
+
+typedef enum {
+    REC_OPEN = 1,
+    REC_DATA,
+    REC_CLOSE,
+    REC_COMMIT,
+    REC_QUIT,       // ble_writer_release：写入任务退出
+} rec_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;
+    uint8_t slot;
+    uint16_t len;
+} rec_header_t;
+
+// 写入任务一侧的槽位状态
+typedef struct {
+    FILE *fp;
+    uint8_t *buf;       // BLE_WRITER_CHUNK 字节，攒满一块再写
+    size_t fill;
+    uint32_t written;   // 文件中已写入的长度
+    uint32_t reserved;  // 预分配的长度（0 为没有预分配）
+    char path[BLE_WRITER_PATH_MAX];   // 打开时的路径（COMMIT 改名用）
+} writer_file_t;
+
+static StreamBufferHandle_t s_ring = NULL;
+static void (*s_flow_cb)(bool pause) = NULL;
+static volatile bool s_paused = false;
+static volatile bool s_error = false;
+static volatile uint32_t s_open_files = 0;     // 写入任务中已打开的文件数
+static bool s_slot_open[BLE_WRITER_SLOTS];     // 生产者一侧：已请求打开且未请求关闭
+static writer_file_t s_files[BLE_WRITER_SLOTS];
+static volatile uint32_t s_queued = 0;         // 生产者放入的记录数
+static volatile uint32_t s_done = 0;           // 写入任务处理完的记录数
+static volatile bool s_task_alive = false;
+
+static void read_exact(void *dst, size_t len) {
+    uint8_t *p = (uint8_t *)dst;
+    while (len > 0) {
+        const size_t n = xStreamBufferReceive(s_ring, p, len, portMAX_DELAY);
+        p += n;
+        len -= n;
+    }
+}
+
+static void flush_file(writer_file_t *f) {
+    if (f->fp != NULL && f->fill > 0) {
+        if (fwrite(f->buf, 1, f->fill, f->fp) != f->fill) {
+            ESP_LOGE(TAG, "SD write failed (%u bytes)", (unsigned)f->fill);
+            s_error = true;
+        } else {
+            f->written += (uint32_t)f->fill;
+        }
+    }
+    f->fill = 0;
+}
+
+static void close_file(writer_file_t *f) {
+    if (f->fp == NULL) {
+        return;
+    }
+    flush_file(f);
+    // 没有写满预分配的长度（传输中止）：截掉尾部，文件长度始终等于写入的数据
+    if (f->reserved > f->written && ftruncate(fileno(f->fp), (off_t)f->written) != 0) {
+        ESP_LOGE(TAG, "Failed to trim %s to %u bytes", f->path, (unsigned)f->written);
+        s_error = true;
+    }
+    fclose(f->fp);
+    f->fp = NULL;
+    free(f->buf);
+    f->buf = NULL;
+    s_open_files--;
+}
+
+// 一次分配 size 字节的连续簇（FatFs f_expand）：写入时不再逐簇扩展 FAT 链、更新目录项，
+// 之后顺序读这个文件也不用跳簇。卡上没有足够大的连续空间时退回逐块扩展
+static bool reserve_contiguous(const char *path, uint32_t size) {
+    if (strncmp(path, WRITER_MOUNT_POINT "/", sizeof(WRITER_MOUNT_POINT)) != 0) {
+        return false;
+    }
+    remove(path);    // 目标不能已存在
+    const esp_err_t err = esp_vfs_fat_create_contiguous_file(WRITER_MOUNT_POINT, path, size, true);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "No contiguous %u bytes for %s: %s", (unsigned)size, path, esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+static void open_file(writer_file_t *f, const char *path, uint32_t offset, uint32_t reserve) {
+    close_file(f);
+    f->buf = (uint8_t *)malloc(BLE_WRITER_CHUNK);
+    const bool reserved = f->buf != NULL && offset == 0 && reserve > 0 &&
+                          reserve_contiguous(path, reserve);
+    f->fp = (f->buf != NULL) ? fopen(path, offset > 0 || reserved ? "r+b" : "wb") : NULL;
+    if (f->fp != NULL && offset > 0) {
+        // 续写：丢掉偏移之后可能不完整的尾部
+        if (fflush(f->fp) != 0 || ftruncate(fileno(f->fp), (off_t)offset) != 0 ||
+            fseek(f->fp, (long)offset, SEEK_SET) != 0) {
+            fclose(f->fp);
+            f->fp = NULL;
+        }
+    }
+    if (f->fp == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s at %u", path, (unsigned)offset);
+        free(f->buf);
+        f->buf = NULL;
+        s_error = true;
+        return;
+    }
+    strncpy(f->path, path, sizeof(f->path) - 1);
+    f->path[sizeof(f->path) - 1] = '\0';
+    // 整块写入已经对齐，不需要 stdio 再缓冲一次
+    setvbuf(f->fp, NULL, _IONBF, 0);
+    f->fill = 0;
+    f->written = offset;
+    f->reserved = reserved ? reserve : 0;
+    s_open_files++;
+}
+
+static void commit_file(writer_file_t *f, const char *final_path) {
+    if (f->fp == NULL) {
+        s_error = true;
+        return;
+    }
+    close_file(f);
+    if (s_error) {
+        return;
+    }
+    // FAT 上 rename 的目标不能已存在
+    remove(final_path);
+    if (rename(f->path, final_path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s to %s", f->path, final_path);
+        s_error = true;
+    }
+}
+
+static void consume_data(writer_file_t *f, size_t len) {
+    while (len > 0) {
+        if (f->fp == NULL) {
+            // 文件没打开（打开失败）：丢弃数据
+            uint8_t sink[64];
+            const size_t n = len < sizeof(sink) ? len : sizeof(sink);
+            read_exact(sink, n);
+            len -= n;
+            continue;
+        }
+        size_t n = BLE_WRITER_CHUNK - f->fill;
+        if (n > len) {
+            n = len;
+        }
+        read_exact(f->buf + f->fill, n);
+        f->fill += n;
+        len -= n;
+        if (f->fill == BLE_WRITER_CHUNK) {
+            flush_file(f);
+        }
+    }
+}
+
+static void writer_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("ble_writer", WRITER_TASK_STACK);
+    char path[256];
+
+    for (;;) {
+        rec_header_t rec;
+        read_exact(&rec, sizeof(rec));
+        writer_file_t *f = &s_files[rec.slot < BLE_WRITER_SLOTS ? rec.slot : 0];
+
+        switch (rec.type) {
+        case REC_OPEN:
+        case REC_COMMIT: {
+            uint32_t offset = 0;
+            uint32_t reserve = 0;
+            size_t len = rec.len;
+            if (rec.type == REC_OPEN) {
+                read_exact(&offset, sizeof(offset));
+                read_exact(&reserve, sizeof(reserve));
+                len -= sizeof(offset) + sizeof(reserve);
+            }
+            const size_t n = len < sizeof(path) ? len : sizeof(path) - 1;
+            read_exact(path, n);
+            path[n] = '\0';
+            if (rec.type == REC_OPEN) {
+                open_file(f, path, offset, reserve);
+            } else {
+                commit_file(f, path);
+            }
+            break;
+        }
+        case REC_DATA:
+            consume_data(f, rec.len);
+            break;
+        case REC_CLOSE:
+            close_file(f);
+            break;
+        case REC_QUIT:
+            // 前面的记录都已处理完，之后不再碰环形缓冲区
+            stack_stats_task_exit();
+            s_task_alive = false;
+            vTaskDelete(NULL);
+            break;
+        default:
+            ESP_LOGE(TAG, "Corrupt record type %u", rec.type);
+            break;
+        }
+        s_done++;
+
+        if (s_paused && xStreamBufferBytesAvailable(s_ring) < WRITER_LOW_WATER) {
+            s_paused = false;
+            if (s_flow_cb != NULL) {
+                s_flow_cb(false);
+            }
+        }
+    }
+}
+
+void ble_writer_set_flow_cb(void (*flow_cb)(bool pause)) {
+    if (flow_cb != NULL) {
+        s_flow_cb = flow_cb;
+    }
+}
+
+bool ble_writer_init(void (*flow_cb)(bool pause)) {
+    ble_writer_set_flow_cb(flow_cb);
+    if (s_ring != NULL) {
+        return true;
+    }
+    s_ring = xStreamBufferCreate(BLE_WRITER_RING_SIZE, 1);
+    if (s_ring == NULL) {
+        ESP_LOGE(TAG, "No memory for %u-byte ring", (unsigned)BLE_WRITER_RING_SIZE);
+        return false;
+    }
+    s_task_alive = true;
+    if (xTaskCreate(writer_task, "ble_writer", WRITER_TASK_STACK, NULL, WRITER_TASK_PRIO, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create writer task");
+        s_task_alive = false;
+        vStreamBufferDelete(s_ring);
+        s_ring = NULL;
+        return false;
+    }
+    s_paused = false;
+    return true;
+}
+
+static bool put_record(uint8_t type, uint8_t slot, const void *payload, size_t len, TickType_t wait) {
+    const size_t need = sizeof(rec_header_t) + len;
+    TickType_t waited = 0;
+    while (xStreamBufferSpacesAvailable(s_ring) < need) {
+        if (waited >= wait) {
+            return false;
+        }
+        vTaskDelay(1);
+        waited++;
+    }
+    const rec_header_t rec = { .type = type, .slot = slot, .len = (uint16_t)len };
+    xStreamBufferSend(s_ring, &rec, sizeof(rec), 0);
+    if (payload != NULL && len > 0) {
+        xStreamBufferSend(s_ring, payload, len, 0);
+    }
+    s_queued++;
+    return true;
+}
+
+static void check_high_water(void) {
+    if (!s_paused && xStreamBufferBytesAvailable(s_ring) > WRITER_HIGH_WATER) {
+        s_paused = true;
+        if (s_flow_cb != NULL) {
+            s_flow_cb(true);
+        }
+    }
+}
+
+static bool open_record(ble_writer_slot_t slot, const char *path, uint32_t offset, uint32_t reserve) {
+    const size_t path_len = strlen(path);
+    if (slot >= BLE_WRITER_SLOTS || path_len >= BLE_WRITER_PATH_MAX) {
+        return false;
+    }
+    // 精简档不常驻：第一个文件打开时才分配（调用方就是唯一的生产者）
+    if (s_ring == NULL && !ble_writer_init(NULL)) {
+        mem_pressure_request(BLE_WRITER_FOOTPRINT);
+        return false;
+    }
+    s_error = false;
+    // 记录头之后紧跟偏移、预分配长度和路径，必须一次放进去：先确认空间再拼
+    uint8_t payload[2 * sizeof(uint32_t) + BLE_WRITER_PATH_MAX];
+    memcpy(payload, &offset, sizeof(offset));
+    memcpy(payload + sizeof(offset), &reserve, sizeof(reserve));
+    memcpy(payload + 2 * sizeof(uint32_t), path, path_len);
+    if (!put_record(REC_OPEN, slot, payload, 2 * sizeof(uint32_t) + path_len,
+                    pdMS_TO_TICKS(WRITER_CLOSE_WAIT_MS))) {
+        return false;
+    }
+    s_slot_open[slot] = true;
+    return true;
+}
+
+bool ble_writer_open_at(ble_writer_slot_t slot, const char *path, uint32_t offset) {
+    return open_record(slot, path, offset, 0);
+}
+
+bool ble_writer_open(ble_writer_slot_t slot, const char *path) {
+    return open_record(slot, path, 0, 0);
+}
+
+bool ble_writer_open_reserved(ble_writer_slot_t slot, const char *path, uint32_t size) {
+    return open_record(slot, path, 0, size);
+}
+
+bool ble_writer_write_begin(ble_writer_slot_t slot, size_t len) {
+    if (s_ring == NULL || slot >= BLE_WRITER_SLOTS || !s_slot_open[slot] || s_error ||
+        len > UINT16_MAX) {
+        return false;
+    }
+    if (!put_record(REC_DATA, slot, NULL, len, 0)) {
+        ESP_LOGW(TAG, "Ring full, write of %u bytes rejected", (unsigned)len);
+        check_high_water();
+        return false;
+    }
+    return true;
+}
+
+void ble_writer_append(const uint8_t *data, size_t n) {
+    xStreamBufferSend(s_ring, data, n, 0);
+    check_high_water();
+}
+
+void ble_writer_close(ble_writer_slot_t slot) {
+    if (s_ring == NULL || slot >= BLE_WRITER_SLOTS || !s_slot_open[slot]) {
+        return;
+    }
+    s_slot_open[slot] = false;
+    if (!put_record(REC_CLOSE, slot, NULL, 0, pdMS_TO_TICKS(WRITER_CLOSE_WAIT_MS))) {
+        ESP_LOGE(TAG, "Ring stuck, close of slot %d dropped", slot);
+    }
+}
+
+bool ble_writer_commit(ble_writer_slot_t slot, const char *final_path) {
+    const size_t path_len = strlen(final_path);
+    if (s_ring == NULL || slot >= BLE_WRITER_SLOTS || !s_slot_open[slot] ||
+        path_len >= BLE_WRITER_PATH_MAX) {
+        return false;
+    }
+    s_slot_open[slot] = false;
+    if (!put_record(REC_COMMIT, slot, final_path, path_len, pdMS_TO_TICKS(WRITER_CLOSE_WAIT_MS))) {
+        ESP_LOGE(TAG, "Ring stuck, commit of slot %d dropped", slot);
+        return false;
+    }
+    return true;
+}
+
+bool ble_writer_flush(uint32_t timeout_ms) {
+    const uint32_t target = s_queued;
+    uint32_t waited = 0;
+    while ((int32_t)(s_done - target) < 0) {
+        if (waited >= timeout_ms) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+        waited += 10;
+    }
+    return true;
+}
+
+bool ble_writer_is_open(ble_writer_slot_t slot) {
+    return slot < BLE_WRITER_SLOTS && s_slot_open[slot];
+}
+
+bool ble_writer_busy(void) {
+    return s_ring != NULL && (xStreamBufferBytesAvailable(s_ring) > 0 || s_open_files > 0);
+}
+
+bool ble_writer_take_error(void) {
+    const bool error = s_error;
+    s_error = false;
+    return error;
+}
+
+bool ble_writer_release(uint32_t timeout_ms) {
+    if (s_ring == NULL) {
+        return true;
+    }
+    if (!ble_writer_flush(timeout_ms) || s_open_files > 0) {
+        return false;
+    }
+    if (!put_record(REC_QUIT, 0, NULL, 0, 0)) {
+        return false;
+    }
+    // 环形缓冲区是空的，写入任务马上取到 QUIT
+    for (uint32_t waited = 0; s_task_alive; waited += 10) {
+        if (waited >= WRITER_QUIT_WAIT_MS) {
+            ESP_LOGE(TAG, "Writer task did not exit");
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    s_done = s_queued;    // QUIT 没有计入处理完的记录
+    vStreamBufferDelete(s_ring);
+    s_ring = NULL;
+    memset(s_slot_open, 0, sizeof(s_slot_open));
+    s_paused = false;
+    ESP_LOGI(TAG, "Released ring and task (%u bytes)", (unsigned)BLE_WRITER_FOOTPRINT);
+    return true;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file ble_writer.h
+ * @brief BLE 接收文件的异步 SD 写入：GATT 回调只往环形缓冲区里拷数据，写卡在专用任务中进行
+ *
+ * GATT 回调（NimBLE 主机任务）按顺序放入记录：打开文件、数据、关闭文件。
+ * 写入任务依次取出，把数据攒成 BLE_WRITER_CHUNK 字节的整块再 fwrite，
+ * SD 卡偶尔的长延迟只会让环形缓冲区变满，不会卡住 BLE 主机任务。
+ * 缓冲区用量超过 3/4 时回调 flow_cb(true)（main.c 通过控制特征发 "pause" 通知），
+ * 降到 1/4 以下时回调 flow_cb(false)（"resume"）
+ *
+ * 同时最多三个文件（图像、JSON、文件传输服务各一个槽位）。生产者只能是 NimBLE 主机任务，
+ * 或 BLE 关闭期间的 USB 传输任务（usb_transfer.h）
+ *
+ * 环形缓冲区和写入任务（BLE_WRITER_FOOTPRINT 字节）不常驻：ble_writer_init 立即分配，
+ * 否则第一次打开文件时再分配；传输结束后由生产者一侧 ble_writer_release 还给堆
+ */
+
+#ifndef BLE_WRITER_H
+#define BLE_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BLE_WRITER_RING_SIZE  (16 * 1024)
+#define BLE_WRITER_CHUNK      4096        // FAT 簇 / SD 扇区对齐的写入块
+#define BLE_WRITER_SLOTS      3
+#define BLE_WRITER_PATH_MAX   256
+// 环形缓冲区 + 写入任务栈（不含打开文件时各槽位的 BLE_WRITER_CHUNK 块）
+#define BLE_WRITER_FOOTPRINT  (BLE_WRITER_RING_SIZE + 4096)
+
+typedef enum {
+    BLE_WRITER_SLOT_IMAGE = 0,
+    BLE_WRITER_SLOT_JSON = 1,
+    BLE_WRITER_SLOT_FILE = 2,     // ble_xfer.c 批量文件传输
+} ble_writer_slot_t;
+
+/**
+ * @brief 创建环形缓冲区和写入任务（已创建时只更新非 NULL 的流控回调）
+ * @param flow_cb 流控回调（pause = true 请求对端暂停），在主机任务或写入任务中调用
+ */
+bool ble_writer_init(void (*flow_cb)(bool pause));
+
+/**
+ * @brief 只登记流控回调（NULL 不改变），环形缓冲区留到第一次打开文件时再分配
+ */
+void ble_writer_set_flow_cb(void (*flow_cb)(bool pause));
+
+/**
+ * @brief 等待缓冲区写完后删除写入任务、释放环形缓冲区（未分配时直接返回 true）
+ *
+ * 只能在生产者一侧调用：NimBLE 主机任务中，或者没有生产者在运行时（BLE 和 USB 传输都已停止）
+ * @return false 超时或仍有打开的文件，缓冲区保留
+ */
+bool ble_writer_release(uint32_t timeout_ms);
+
+/**
+ * @brief 在槽位上打开（截断）文件；槽位上已有文件时先关闭它
+ * @return false 缓冲区已满、写入任务报告过错误，或分配缓冲区失败（已请求缓存收缩，稍后重试）
+ */
+bool ble_writer_open(ble_writer_slot_t slot, const char *path);
+
+/**
+ * @brief 同 ble_writer_open，并预先把 size 字节分配成连续的簇
+ *
+ * 发送方在帧头里给出了总长度时使用：写入不再逐簇扩展 FAT 链和目录项，文件也不会碎片化。
+ * 连续空间不够时照常逐块扩展；没写满 size 字节就关闭时截掉尾部。
+ * 中途断电时文件保持预分配的长度，所以靠 .part 长度续传的文件不能用
+ */
+bool ble_writer_open_reserved(ble_writer_slot_t slot, const char *path, uint32_t size);
+
+/**
+ * @brief 在槽位上打开已有文件，截断到 offset 字节后从那里续写（offset 为 0 时同 ble_writer_open）
+ */
+bool ble_writer_open_at(ble_writer_slot_t slot, const char *path, uint32_t offset);
+
+/**
+ * @brief 开始一条 len 字节的数据记录，随后用 ble_writer_append 分段写满 len 字节
+ * @return false 缓冲区放不下整条记录（调用方应拒绝这次 ATT 写入）或写入出错
+ */
+bool ble_writer_write_begin(ble_writer_slot_t slot, size_t len);
+
+/**
+ * @brief 追加数据记录的一段（合计必须等于 ble_writer_write_begin 的 len）
+ */
+void ble_writer_append(const uint8_t *data, size_t n);
+
+/**
+ * @brief 写完剩余数据后关闭槽位上的文件（放不下时短暂等待空间）
+ */
+void ble_writer_close(ble_writer_slot_t slot);
+
+/**
+ * @brief 关闭槽位上的文件并把它改名为 final_path（已存在的 final_path 先删除）
+ *
+ * 用于先写临时文件、收完再替换正式文件，中途断开不会留下半个正式文件
+ */
+bool ble_writer_commit(ble_writer_slot_t slot, const char *final_path);
+
+/**
+ * @brief 等待此前放入的所有记录都已在写入任务中处理完（文件已关闭/改名）
+ * @return false 超时
+ */
+bool ble_writer_flush(uint32_t timeout_ms);
+
+/**
+ * @brief 槽位上的文件是否打开（已请求打开且尚未请求关闭）
+ */
+bool ble_writer_is_open(ble_writer_slot_t slot);
+
+/**
+ * @brief 缓冲区中是否还有未写入 SD 卡的数据或打开的文件
+ */
+bool ble_writer_busy(void);
+
+/**
+ * @brief 取出并清除写入错误标志（打开或写入文件失败时置位）
+ */
+bool ble_writer_take_error(void);
+
+#endif // BLE_WRITER_H
@@ -0,0 +1,392 @@
+/**
+ * @file ble_xfer.c
+ * @brief BLE 批量文件传输服务实现
+ *
+ * 所有回调都在 NimBLE 主机任务中执行，会话状态不需要加锁。数据块先拷进一块
+ * 静态缓冲区做 CRC 校验，校验通过才放进写入队列，所以 .part 的长度始终是
+ * 已确认数据的前缀，续传时直接按文件长度计算块号
+ */
+
+#include "ble_xfer.h"
+#include "ble_writer.h"
+#include "sd_path.h"
+#include "ui/file_browser.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "host/ble_hs.h"
+#include "host/ble_uuid.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "BLE_XFER";
+
+#define XFER_STATE_DIR     "/sdcard/.x4cache"
+#define XFER_STATE_PATH    "/sdcard/.x4cache/xfer.bin"
+#define XFER_STATE_MAGIC   0x54463458u      // 'X4FT'
+#define XFER_PATH_MAX      SD_PATH_REL_MAX
+#define XFER_BLOCK_HDR     8                // 块号 + CRC32
+#define XFER_MAX_BLOCK     512
+#define XFER_WINDOW        16               // 未确认块数上限：16 x 512 字节只占写入环形缓冲的一半
+#define XFER_ACK_EVERY     4
+#define XFER_FLUSH_MS      3000
+
+// 控制特征操作码（手机 -> 设备）
+#define XFER_OP_START      0x01
+#define XFER_OP_ABORT      0x02
+#define XFER_OP_STATUS     0x03
+// 通知操作码（设备 -> 手机）
+#define XFER_NT_START      0x81
+#define XFER_NT_ACK        0x82
+#define XFER_NT_DONE       0x83
+
+typedef enum {
+    XFER_OK = 0,
+    XFER_NAK = 1,            // 仅 ACK：从给出的块号重发
+    XFER_ERR_REQUEST = 2,    // 命令格式、路径或块大小不合法
+    XFER_ERR_SD = 3,         // 打开、写入或改名失败
+} xfer_status_t;
+
+// 续传记录：正在传输哪个文件
+typedef struct {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t crc;
+    char path[XFER_PATH_MAX + 1];
+} xfer_state_t;
+
+static uint16_t s_ctrl_handle = 0;
+static bool s_notify = false;
+static uint16_t s_conn = 0;
+
+static bool s_active = false;
+static uint32_t s_size = 0;
+static uint32_t s_crc = 0;
+static uint16_t s_block_size = 0;
+static uint32_t s_block_count = 0;
+static uint32_t s_next = 0;          // 期待的下一个块号
+static uint32_t s_unacked = 0;       // 上次 ACK 之后确认的块数
+static bool s_nak_sent = false;      // 已为当前缺口发过 NAK，等重发的块到达
+static char s_rel[XFER_PATH_MAX + 1];
+static char s_final[BLE_WRITER_PATH_MAX];
+static char s_part[BLE_WRITER_PATH_MAX];
+static uint8_t s_block[XFER_MAX_BLOCK];
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void notify(const uint8_t *msg, size_t len) {
+    if (!s_notify || s_ctrl_handle == 0) {
+        return;
+    }
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(msg, len);
+    if (om == NULL) {
+        ESP_LOGW(TAG, "No mbuf for notification 0x%02x", msg[0]);
+        return;
+    }
+    const int rc = ble_gatts_notify_custom(s_conn, s_ctrl_handle, om);
+    if (rc != 0) {
+        ESP_LOGW(TAG, "Notification 0x%02x failed: %d", msg[0], rc);
+    }
+}
+
+static void notify_start(xfer_status_t status, uint32_t resume_block) {
+    uint8_t msg[9] = { XFER_NT_START, (uint8_t)status };
+    put_le32(msg + 2, resume_block);
+    msg[6] = (uint8_t)s_block_size;
+    msg[7] = (uint8_t)(s_block_size >> 8);
+    msg[8] = XFER_WINDOW;
+    notify(msg, sizeof(msg));
+}
+
+static void notify_ack(xfer_status_t status) {
+    uint8_t msg[6] = { XFER_NT_ACK, (uint8_t)status };
+    put_le32(msg + 2, s_next);
+    notify(msg, sizeof(msg));
+    s_unacked = 0;
+}
+
+static void notify_done(xfer_status_t status) {
+    uint8_t msg[6] = { XFER_NT_DONE, (uint8_t)status };
+    put_le32(msg + 2, s_size);
+    notify(msg, sizeof(msg));
+}
+
+static bool load_state(xfer_state_t *state) {
+    FILE *fp = fopen(XFER_STATE_PATH, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    const bool ok = fread(state, 1, sizeof(*state), fp) == sizeof(*state) &&
+                    state->magic == XFER_STATE_MAGIC;
+    fclose(fp);
+    state->path[XFER_PATH_MAX] = '\0';
+    return ok;
+}
+
+static bool save_state(void) {
+    xfer_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.magic = XFER_STATE_MAGIC;
+    state.size = s_size;
+    state.crc = s_crc;
+    strncpy(state.path, s_rel, XFER_PATH_MAX);
+    mkdir(XFER_STATE_DIR, 0775);
+    FILE *fp = fopen(XFER_STATE_PATH, "wb");
+    if (fp == NULL) {
+        return false;
+    }
+    const bool ok = fwrite(&state, 1, sizeof(state), fp) == sizeof(state);
+    fclose(fp);
+    return ok;
+}
+
+// 同一个文件（路径、大小、CRC32 都相同）的 .part 还在时返回可以续传的块号
+static uint32_t resume_block(void) {
+    xfer_state_t state;
+    if (!load_state(&state) || state.size != s_size || state.crc != s_crc ||
+        strcmp(state.path, s_rel) != 0) {
+        return 0;
+    }
+    // 上一次会话的 .part 可能还在写入队列里没有关掉
+    if (!ble_writer_flush(XFER_FLUSH_MS)) {
+        return 0;
+    }
+    struct stat st;
+    if (stat(s_part, &st) != 0 || st.st_size <= 0 || (uint32_t)st.st_size > s_size) {
+        return 0;
+    }
+    return (uint32_t)st.st_size / s_block_size;
+}
+
+static void end_session(bool keep_part) {
+    if (s_active) {
+        s_active = false;
+        ble_writer_close(BLE_WRITER_SLOT_FILE);
+    }
+    // 断开后再 ABORT 也要清掉上次留下的 .part
+    if (!keep_part && s_part[0] != '\0') {
+        ble_writer_flush(XFER_FLUSH_MS);
+        remove(s_part);
+        remove(XFER_STATE_PATH);
+        s_part[0] = '\0';
+    }
+}
+
+static void finish_transfer(void) {
+    s_active = false;
+    const bool queued = ble_writer_commit(BLE_WRITER_SLOT_FILE, s_final);
+    const bool ok = queued && ble_writer_flush(XFER_FLUSH_MS) && !ble_writer_take_error();
+    if (ok) {
+        remove(XFER_STATE_PATH);
+        file_browser_invalidate_cache();
+        ESP_LOGI(TAG, "Received %s (%u bytes)", s_final, (unsigned)s_size);
+    } else {
+        // .part 和续传记录保留，手机重新 START 时从已写入的位置续传
+        ESP_LOGE(TAG, "Failed to finalize %s", s_final);
+    }
+    notify_done(ok ? XFER_OK : XFER_ERR_SD);
+}
+
+static void handle_start(const uint8_t *cmd, size_t len) {
+    end_session(true);
+    s_block_size = 0;
+
+    const size_t path_len = len > 11 ? len - 11 : 0;
+    if (len < 12 || path_len > XFER_PATH_MAX) {
+        notify_start(XFER_ERR_REQUEST, 0);
+        return;
+    }
+    s_size = get_le32(cmd + 1);
+    s_crc = get_le32(cmd + 5);
+    const uint16_t block_size = (uint16_t)(cmd[9] | (cmd[10] << 8));
+    memcpy(s_rel, cmd + 11, path_len);
+    s_rel[path_len] = '\0';
+
+    // 一块连同块头必须装进一次 ATT 写（MTU 减 3 字节 ATT 头）
+    const uint16_t mtu = ble_att_mtu(s_conn);
+    if (!sd_path_is_safe(s_rel) || block_size == 0 || block_size > XFER_MAX_BLOCK ||
+        (uint32_t)block_size + XFER_BLOCK_HDR + 3 > mtu) {
+        ESP_LOGW(TAG, "START rejected: path=\"%s\" block=%u mtu=%u", s_rel, block_size, mtu);
+        notify_start(XFER_ERR_REQUEST, 0);
+        return;
+    }
+    s_block_size = block_size;
+    s_block_count = (s_size + block_size - 1) / block_size;
+    snprintf(s_final, sizeof(s_final), SD_PATH_ROOT "%s", s_rel);
+    snprintf(s_part, sizeof(s_part), SD_PATH_ROOT "%s" SD_PATH_PART_SUFFIX, s_rel);
+
+    s_next = resume_block();
+    if (s_next == 0 && !save_state()) {
+        ESP_LOGE(TAG, "Failed to write %s", XFER_STATE_PATH);
+        notify_start(XFER_ERR_SD, 0);
+        return;
+    }
+    sd_path_make_parents(s_final);
+    if (!ble_writer_open_at(BLE_WRITER_SLOT_FILE, s_part, s_next * block_size)) {
+        notify_start(XFER_ERR_SD, 0);
+        return;
+    }
+    s_active = true;
+    s_unacked = 0;
+    s_nak_sent = false;
+    ESP_LOGI(TAG, "Receiving %s: %u bytes, %u-byte blocks, resuming at block %u",
+             s_final, (unsigned)s_size, block_size, (unsigned)s_next);
+    notify_start(XFER_OK, s_next);
+
+    if (s_next == s_block_count) {
+        // 空文件，或上次断开前数据已经收齐只差改名
+        finish_transfer();
+    }
+}
+
+static int ctrl_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                           struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t cmd[12 + XFER_PATH_MAX];
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len == 0 || len > sizeof(cmd)) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    os_mbuf_copydata(ctxt->om, 0, len, cmd);
+    s_conn = conn_handle;
+
+    switch (cmd[0]) {
+    case XFER_OP_START:
+        handle_start(cmd, len);
+        return 0;
+    case XFER_OP_ABORT:
+        ESP_LOGI(TAG, "Transfer aborted by peer");
+        end_session(false);
+        return 0;
+    case XFER_OP_STATUS:
+        // 手机丢了通知时用来重新同步
+        notify_ack(s_active ? XFER_OK : XFER_ERR_REQUEST);
+        return 0;
+    default:
+        return BLE_ATT_ERR_REQ_NOT_SUPPORTED;
+    }
+}
+
+static int data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                           struct ble_gatt_access_ctxt *ctxt, void *arg) {
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (!s_active || len < XFER_BLOCK_HDR) {
+        // 无响应写的错误码手机收不到，只是不写入；手机靠 ACK 超时后发 STATUS 发现
+        return 0;
+    }
+    s_conn = conn_handle;
+
+    uint8_t hdr[XFER_BLOCK_HDR];
+    os_mbuf_copydata(ctxt->om, 0, XFER_BLOCK_HDR, hdr);
+    const uint32_t block = get_le32(hdr);
+    if (block < s_next) {
+        return 0;    // 重发窗口里已经收过的块
+    }
+    const uint32_t expected_len = (block + 1 == s_block_count)
+                                  ? s_size - block * s_block_size : s_block_size;
+    const uint16_t n = len - XFER_BLOCK_HDR;
+    bool ok = block == s_next && n == expected_len;
+    if (ok) {
+        os_mbuf_copydata(ctxt->om, XFER_BLOCK_HDR, n, s_block);
+        ok = esp_rom_crc32_le(0, s_block, n) == get_le32(hdr + 4);
+        if (!ok) {
+            ESP_LOGW(TAG, "CRC mismatch in block %u", (unsigned)block);
+        }
+    }
+    if (ok && !ble_writer_write_begin(BLE_WRITER_SLOT_FILE, n)) {
+        // 写入队列满（SD 卡暂时变慢）：当作缺口处理，手机稍后重发
+        ok = false;
+    }
+    if (!ok) {
+        // 同一个缺口只发一次 NAK，之后在途的块全部丢弃，直到重发的块到达
+        if (!s_nak_sent) {
+            s_nak_sent = true;
+            notify_ack(XFER_NAK);
+        }
+        return 0;
+    }
+    ble_writer_append(s_block, n);
+    s_next++;
+    s_nak_sent = false;
+
+    if (s_next == s_block_count) {
+        notify_ack(XFER_OK);
+        finish_transfer();
+    } else if (++s_unacked >= XFER_ACK_EVERY) {
+        notify_ack(XFER_OK);
+    }
+    return 0;
+}
+
+static const struct ble_gatt_svc_def s_xfer_svcs[] = {
+    {
+        .type = BLE_GATT_SVC_TYPE_PRIMARY,
+        .uuid = BLE_UUID16_DECLARE(FILE_XFER_SERVICE_UUID),
+        .characteristics = (struct ble_gatt_chr_def[]) {
+            {
+                .uuid = BLE_UUID16_DECLARE(FILE_XFER_CTRL_CHAR_UUID),
+                .access_cb = ctrl_chr_access,
+                .val_handle = &s_ctrl_handle,
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_NOTIFY,
+            },
+            {
+                .uuid = BLE_UUID16_DECLARE(FILE_XFER_DATA_CHAR_UUID),
+                .access_cb = data_chr_access,
+                .flags = BLE_GATT_CHR_F_WRITE_NO_RSP,
+            },
+            {
+                0,
+            }
+        }
+    },
+    {
+        0,
+    }
+};
+
+int ble_xfer_gatt_init(void) {
+    int rc = ble_gatts_count_cfg(s_xfer_svcs);
+    if (rc != 0) {
+        return rc;
+    }
+    return ble_gatts_add_svcs(s_xfer_svcs);
+}
+
+void ble_xfer_on_subscribe(uint16_t attr_handle, bool notify_on) {
+    if (attr_handle == s_ctrl_handle) {
+        s_notify = notify_on;
+    }
+}
+
+void ble_xfer_on_disconnect(void) {
+    if (s_active) {
+        ESP_LOGI(TAG, "Disconnected at block %u/%u, kept %s for resume",
+                 (unsigned)s_next, (unsigned)s_block_count, s_part);
+    }
+    end_session(true);
+    s_notify = false;
+}
+
+bool ble_xfer_active(void) {
+    return s_active;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file ble_xfer.h
+ * @brief BLE 批量文件传输服务：把书籍、字体等文件推送到 SD 卡
+ *
+ * 独立于图像服务（IMAGE_SERVICE_UUID）的 GATT 服务，两个特征：
+ * - 控制特征（写 + 通知）：手机发 START/ABORT/STATUS 命令，设备回 START 应答、ACK 和完成通知
+ * - 数据特征（无响应写）：手机连续发送数据块，不等每块的写应答，吞吐量接近链路上限
+ *
+ * 数据块带块号和 CRC32，按顺序校验后交给异步写入任务（ble_writer.h）写进
+ * "<路径>.part"。设备每收到 XFER_ACK_EVERY 块回一次累计 ACK，手机最多比最近一次
+ * ACK 超前 window 块；块号不连续或 CRC 不对时回 NAK，手机从 NAK 给出的块号重发
+ * （go-back-N）。全部收到后 .part 改名为正式文件。
+ *
+ * 断开时 .part 保留，/sdcard/.x4cache/xfer.bin 记下正在传输的文件（路径、大小、CRC32）。
+ * 重新连接后手机对同一个文件发 START，设备按 .part 已写入的长度回复续传块号
+ *
+ * 协议字节布局见 main.c 中的说明
+ */
+
+#ifndef BLE_XFER_H
+#define BLE_XFER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FILE_XFER_SERVICE_UUID    0x1235
+#define FILE_XFER_CTRL_CHAR_UUID  0x5680
+#define FILE_XFER_DATA_CHAR_UUID  0x5681
+
+/**
+ * @brief 注册文件传输服务（在 ble_gatts_add_svcs 阶段调用，与图像服务一起）
+ * @return NimBLE 错误码，0 为成功
+ */
+int ble_xfer_gatt_init(void);
+
+/**
+ * @brief 订阅事件（main.c 的 GAP 回调转发）
+ */
+void ble_xfer_on_subscribe(uint16_t attr_handle, bool notify);
+
+/**
+ * @brief 连接断开：关闭 .part 文件并保留续传信息
+ */
+void ble_xfer_on_disconnect(void);
+
+/**
+ * @brief 是否有文件正在传输
+ */
+bool ble_xfer_active(void);
+
+#endif // BLE_XFER_H
@@ -0,0 +1,84 @@
+/**
+ * @file boot_profile.c
+ * @brief 启动阶段计时实现
+ */
+
+#include "boot_profile.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+
+static const char *TAG = "BOOT";
+
+typedef struct {
+    const char *name;
+    int64_t start_us;
+    int64_t end_us;     // 0 = 未结束
+} boot_phase_t;
+
+static boot_phase_t s_phases[BOOT_PROFILE_MAX];
+static int s_count = 0;
+static int64_t s_done_us = 0;   // boot_profile_log 的时间，即启动总耗时
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+int boot_profile_begin(const char *name) {
+    const int64_t now = esp_timer_get_time();
+    int id = -1;
+    portENTER_CRITICAL(&s_mux);
+    if (s_count < BOOT_PROFILE_MAX) {
+        id = s_count++;
+        s_phases[id].name = name;
+        s_phases[id].start_us = now;
+        s_phases[id].end_us = 0;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (id < 0) {
+        ESP_LOGW(TAG, "Profile full, phase '%s' not recorded", name);
+    }
+    return id;
+}
+
+void boot_profile_end(int id) {
+    if (id < 0 || id >= BOOT_PROFILE_MAX) {
+        return;
+    }
+    const int64_t now = esp_timer_get_time();
+    s_phases[id].end_us = now;
+    ESP_LOGI(TAG, "%-12s %5lld ms (at %lld ms)", s_phases[id].name,
+             (long long)((now - s_phases[id].start_us) / 1000),
+             (long long)(now / 1000));
+}
+
+void boot_profile_log(void) {
+    s_done_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "Boot finished in %lld ms:", (long long)(s_done_us / 1000));
+    for (int i = 0; i < s_count; i++) {
+        const boot_phase_t *p = &s_phases[i];
+        ESP_LOGI(TAG, "  %-12s start %5lld ms  %5lld ms", p->name,
+                 (long long)(p->start_us / 1000),
+                 p->end_us ? (long long)((p->end_us - p->start_us) / 1000) : -1LL);
+    }
+}
+
+size_t boot_profile_format_json(char *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    size_t pos = (size_t)snprintf(buf, len, "{\"total_ms\":%lld,\"phases\":[",
+                                  (long long)(s_done_us / 1000));
+    for (int i = 0; i < s_count && pos < len; i++) {
+        const boot_phase_t *p = &s_phases[i];
+        pos += (size_t)snprintf(buf + pos, len - pos, "%s{\"name\":\"%s\",\"start_ms\":%lld,\"ms\":%lld}",
+                                i ? "," : "", p->name, (long long)(p->start_us / 1000),
+                                p->end_us ? (long long)((p->end_us - p->start_us) / 1000) : -1LL);
+    }
+    if (pos < len) {
+        pos += (size_t)snprintf(buf + pos, len - pos, "]}");
+    }
+    if (pos >= len) {
+        return (size_t)snprintf(buf, len, "{\"total_ms\":%lld,\"phases\":[]}",
+                                (long long)(s_done_us / 1000));
+    }
+    return pos;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file boot_profile.h
+ * @brief 启动阶段计时：记录每个阶段的开始时间和耗时，串口打印并可通过 HTTP 导出
+ *
+ * 启动流程中有的阶段在不同任务里并行执行（EPD 清屏与 SD 挂载、字体初始化），
+ * 所以按"开始/结束"成对记录，而不是只记顺序时间点；导出结果里重叠的区间即并行部分。
+ * 时间取自 esp_timer（应用启动起算），只在启动期间写入，之后只读
+ */
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <stddef.h>
+
+#define BOOT_PROFILE_MAX 16
+
+/**
+ * @brief 开始一个阶段（任意任务中调用）
+ * @param name 阶段名（字符串常量，不复制）
+ * @return 阶段编号，传给 boot_profile_end；记录已满时返回 -1
+ */
+int boot_profile_begin(const char *name);
+
+/**
+ * @brief 结束阶段并打印耗时（id 为 -1 时忽略）
+ */
+void boot_profile_end(int id);
+
+/**
+ * @brief 打印全部阶段与启动总耗时（启动完成时调用一次）
+ */
+void boot_profile_log(void);
+
+/**
+ * @brief 导出为 JSON：{"total_ms":..,"phases":[{"name":..,"start_ms":..,"ms":..},...]}
+ * 未结束的阶段 ms 为 -1
+ * @return 写入长度（不含结尾 0），缓冲区不够时截断为合法的空数组
+ */
+size_t boot_profile_format_json(char *buf, size_t len);
+
+#endif // BOOT_PROFILE_H
@@ -0,0 +1,411 @@
+/**
+ * @file buttons.c
+ * @brief 按键子系统实现：ADC 连续转换 + IIR 滤波 + 阈值监视器中断，按轮消抖后入队
+ */
+
+#include "buttons.h"
+#include "stack_stats.h"
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_filter.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "soc/soc_caps.h"
+#include <string.h>
+
+#if SOC_ADC_MONITOR_SUPPORTED
+#include "esp_adc/adc_monitor.h"
+#define BUTTONS_HAVE_MONITOR 1
+#else
+#define BUTTONS_HAVE_MONITOR 0
+#endif
+
+static const char *TAG = "BTN";
+
+// 按钮 ADC 阈值（12 位原始值）
+#define BTN_THRESHOLD           100    // 阈值容差
+#define BTN_RIGHT_VAL           3      // Right按钮ADC值
+#define BTN_LEFT_VAL            1470   // Left按钮ADC值
+#define BTN_CONFIRM_VAL         2655   // Confirm按钮ADC值
+#define BTN_BACK_VAL            3470   // Back按钮ADC值
+#define BTN_VOLUME_DOWN_VAL     3      // Volume Down按钮ADC值
+#define BTN_VOLUME_UP_VAL       2205   // Volume Up按钮ADC值
+
+// 分压低于这些值说明有键按下（阈值监视器的下限）
+#define LADDER_A_IDLE_MIN       (BTN_BACK_VAL + BTN_THRESHOLD)
+#define LADDER_B_IDLE_MIN       (BTN_VOLUME_UP_VAL + BTN_THRESHOLD)
+
+#define PATTERN_NUM             3      // 电池、分压 A、分压 B（B 结束一轮）
+#define FRAME_BYTES             (PATTERN_NUM * BUTTONS_FRAME_ROUNDS * SOC_ADC_DIGI_RESULT_BYTES)
+#define POOL_BYTES              (FRAME_BYTES * 4)
+#define FRAME_TIMEOUT_MS        100    // 一帧约 12 ms，超时说明转换停了
+
+#define BUTTONS_TASK_STACK      3072
+#define BUTTONS_TASK_PRIO       4      // 高于刷新任务：波形期间按键也能及时打时间戳
+
+#define NOTIFY_WAKE             (1u << 0)   // 阈值监视器或电源键中断
+#define NOTIFY_SAMPLE           (1u << 1)   // buttons_sample 请求
+
+static buttons_config_t s_cfg;
+static adc_continuous_handle_t s_adc = NULL;
+static TaskHandle_t s_task = NULL;
+static QueueHandle_t s_queue = NULL;
+static SemaphoreHandle_t s_sample_lock = NULL;
+static SemaphoreHandle_t s_sample_done = NULL;
+static void (*s_listener)(void) = NULL;
+
+static volatile bool s_active = false;          // 任务正在逐帧读取（有键或刚被中断唤醒）
+static volatile button_t s_state = BTN_NONE;    // 消抖后的状态
+static volatile button_t s_instant = BTN_NONE;  // 最近一轮的即时分类
+static volatile int s_battery_raw = -1;
+
+// 消抖与分类状态（只在按键任务中访问）
+static int s_ladder_a = 4095;
+static int s_ladder_b = 4095;
+static button_t s_candidate = BTN_NONE;
+static int s_candidate_rounds = 0;
+
+static IRAM_ATTR void notify_from_isr(BaseType_t *woken) {
+    if (s_task != NULL) {
+        xTaskNotifyFromISR(s_task, NOTIFY_WAKE, eSetBits, woken);
+    }
+}
+
+#if BUTTONS_HAVE_MONITOR
+// 监视器一直启用（运行中开关需要停掉转换），有键按住时每次转换都会触发：
+// 任务醒着时直接返回，代价只是一次中断进出
+static IRAM_ATTR bool monitor_isr(adc_monitor_handle_t monitor, const adc_monitor_evt_data_t *data,
+                                  void *arg) {
+    (void)monitor;
+    (void)data;
+    (void)arg;
+    if (s_active) {
+        return false;
+    }
+    BaseType_t woken = pdFALSE;
+    notify_from_isr(&woken);
+    return woken == pdTRUE;
+}
+#endif
+
+// 电源键低电平中断：与浅睡眠的 GPIO 唤醒类型相同，触发后关闭，回到空闲时重新打开
+static IRAM_ATTR void power_key_isr(void *arg) {
+    (void)arg;
+    BaseType_t woken = pdFALSE;
+    gpio_intr_disable(s_cfg.power_gpio);
+    notify_from_isr(&woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void arm_power_key(void) {
+    if (s_cfg.power_gpio != GPIO_NUM_NC) {
+        gpio_intr_enable(s_cfg.power_gpio);
+    }
+}
+
+static button_t classify(int a, int b) {
+    if (s_cfg.power_gpio != GPIO_NUM_NC && gpio_get_level(s_cfg.power_gpio) == 0) {
+        return BTN_POWER;
+    }
+    if (a < BTN_RIGHT_VAL + BTN_THRESHOLD) {
+        return BTN_RIGHT;
+    } else if (a < BTN_LEFT_VAL + BTN_THRESHOLD) {
+        return BTN_LEFT;
+    } else if (a < BTN_CONFIRM_VAL + BTN_THRESHOLD) {
+        return BTN_CONFIRM;
+    } else if (a < BTN_BACK_VAL + BTN_THRESHOLD) {
+        return BTN_BACK;
+    }
+    if (b < BTN_VOLUME_DOWN_VAL + BTN_THRESHOLD) {
+        return BTN_VOLUME_DOWN;
+    } else if (b < BTN_VOLUME_UP_VAL + BTN_THRESHOLD) {
+        return BTN_VOLUME_UP;
+    }
+    return BTN_NONE;
+}
+
+static void post_event(button_t btn, bool pressed) {
+    const button_event_t ev = {
+        .button = btn,
+        .pressed = pressed,
+        .time_ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+    if (xQueueSend(s_queue, &ev, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Event queue full, dropping %s of %d", pressed ? "press" : "release", btn);
+    }
+}
+
+// 一轮序列结束：即时分类连续 BUTTONS_DEBOUNCE_ROUNDS 轮一致才提交
+// （IIR 滤波后的电平从一个键值滑向另一个键值时会短暂落在中间的键上）
+static void end_round(void) {
+    const button_t raw = classify(s_ladder_a, s_ladder_b);
+    s_instant = raw;
+    if (raw == s_state) {
+        s_candidate = raw;
+        s_candidate_rounds = 0;
+        return;
+    }
+    if (raw != s_candidate) {
+        s_candidate = raw;
+        s_candidate_rounds = 1;
+    } else {
+        s_candidate_rounds++;
+    }
+    if (s_candidate_rounds < BUTTONS_DEBOUNCE_ROUNDS) {
+        return;
+    }
+
+    const button_t old = s_state;
+    s_state = raw;
+    s_candidate_rounds = 0;
+    ESP_LOGD(TAG, "A=%4d B=%4d: %d -> %d", s_ladder_a, s_ladder_b, old, raw);
+    if (old != BTN_NONE) {
+        post_event(old, false);
+    }
+    if (raw != BTN_NONE) {
+        post_event(raw, true);
+    }
+    if (s_listener != NULL) {
+        s_listener();
+    }
+}
+
+// 读取一帧（或驱动缓冲区中已有的数据）并逐个结果处理
+static bool read_frame(uint32_t timeout_ms) {
+    uint8_t buf[FRAME_BYTES];
+    uint32_t len = 0;
+    if (adc_continuous_read(s_adc, buf, sizeof(buf), &len, timeout_ms) != ESP_OK) {
+        return false;
+    }
+
+    uint32_t bat_sum = 0;
+    uint32_t bat_count = 0;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= len; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const adc_digi_output_data_t *p = (const adc_digi_output_data_t *)&buf[i];
+        const adc_channel_t channel = (adc_channel_t)p->type2.channel;
+        const int value = p->type2.data;
+        if (channel == s_cfg.battery) {
+            bat_sum += value;
+            bat_count++;
+        } else if (channel == s_cfg.ladder_a) {
+            s_ladder_a = value;
+        } else if (channel == s_cfg.ladder_b) {
+            s_ladder_b = value;
+            end_round();
+        }
+    }
+    if (bat_count > 0) {
+        s_battery_raw = (int)(bat_sum / bat_count);
+    }
+    return true;
+}
+
+static void buttons_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("buttons", BUTTONS_TASK_STACK);
+    for (;;) {
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, s_active ? 0 : portMAX_DELAY);
+
+        if (bits & NOTIFY_WAKE) {
+            s_active = true;
+        }
+        if (bits & NOTIFY_SAMPLE) {
+            // 丢掉空闲期间积压的旧帧，再等一帧新的
+            while (read_frame(0)) {
+            }
+            read_frame(FRAME_TIMEOUT_MS);
+            xSemaphoreGive(s_sample_done);
+        }
+        if (!s_active) {
+            continue;
+        }
+
+        if (!read_frame(FRAME_TIMEOUT_MS)) {
+            ESP_LOGW(TAG, "No ADC frame in %d ms", FRAME_TIMEOUT_MS);
+        }
+        // 全部释放且没有待确认的变化：回到中断等待
+        if (BUTTONS_HAVE_MONITOR && s_state == BTN_NONE && s_candidate_rounds == 0) {
+            s_active = false;
+            arm_power_key();
+        }
+    }
+}
+
+static bool setup_adc(void) {
+    const adc_continuous_handle_cfg_t handle_cfg = {
+        .max_store_buf_size = POOL_BYTES,
+        .conv_frame_size = FRAME_BYTES,
+        .flags.flush_pool = 1,   // 空闲时没人读，满了直接丢旧帧
+    };
+    esp_err_t err = adc_continuous_new_handle(&handle_cfg, &s_adc);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "adc_continuous_new_handle failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    const adc_channel_t order[PATTERN_NUM] = {s_cfg.battery, s_cfg.ladder_a, s_cfg.ladder_b};
+    adc_digi_pattern_config_t pattern[PATTERN_NUM] = {0};
+    for (int i = 0; i < PATTERN_NUM; i++) {
+        pattern[i].atten = ADC_ATTEN_DB_12;
+        pattern[i].channel = order[i];
+        pattern[i].unit = ADC_UNIT_1;
+        pattern[i].bit_width = ADC_BITWIDTH_12;
+    }
+    const adc_continuous_config_t dig_cfg = {
+        .pattern_num = PATTERN_NUM,
+        .adc_pattern = pattern,
+        .sample_freq_hz = BUTTONS_SAMPLE_FREQ_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+    };
+    err = adc_continuous_config(s_adc, &dig_cfg);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "adc_continuous_config failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    // 按键通道的 IIR 滤波：抑制分压上的毛刺，滤波器数量不够时只是少了滤波
+    const adc_channel_t ladders[2] = {s_cfg.ladder_a, s_cfg.ladder_b};
+    for (int i = 0; i < 2; i++) {
+        const adc_continuous_iir_filter_config_t filter_cfg = {
+            .unit = ADC_UNIT_1,
+            .channel = ladders[i],
+            .coeff = ADC_DIGI_IIR_FILTER_COEFF_2,
+        };
+        adc_iir_filter_handle_t filter = NULL;
+        if (adc_new_continuous_iir_filter(s_adc, &filter_cfg, &filter) != ESP_OK ||
+            adc_continuous_iir_filter_enable(filter) != ESP_OK) {
+            ESP_LOGW(TAG, "No IIR filter for channel %d", ladders[i]);
+        }
+    }
+
+#if BUTTONS_HAVE_MONITOR
+    const int idle_min[2] = {LADDER_A_IDLE_MIN, LADDER_B_IDLE_MIN};
+    const adc_monitor_evt_cbs_t cbs = {
+        .on_below_low_thresh = monitor_isr,
+    };
+    for (int i = 0; i < 2; i++) {
+        const adc_monitor_config_t mon_cfg = {
+            .adc_unit = ADC_UNIT_1,
+            .channel = ladders[i],
+            .h_threshold = -1,
+            .l_threshold = idle_min[i],
+        };
+        adc_monitor_handle_t monitor = NULL;
+        if (adc_new_continuous_monitor(s_adc, &mon_cfg, &monitor) != ESP_OK ||
+            adc_continuous_monitor_register_event_callbacks(monitor, &cbs, NULL) != ESP_OK ||
+            adc_continuous_monitor_enable(monitor) != ESP_OK) {
+            ESP_LOGE(TAG, "No threshold monitor for channel %d", ladders[i]);
+            return false;
+        }
+    }
+#endif
+
+    err = adc_continuous_start(s_adc);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "adc_continuous_start failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    return true;
+}
+
+bool buttons_init(const buttons_config_t *cfg) {
+    if (s_task != NULL) {
+        return true;
+    }
+    s_cfg = *cfg;
+    s_queue = xQueueCreate(BUTTONS_QUEUE_LEN, sizeof(button_event_t));
+    s_sample_lock = xSemaphoreCreateMutex();
+    s_sample_done = xSemaphoreCreateBinary();
+    if (s_queue == NULL || s_sample_lock == NULL || s_sample_done == NULL) {
+        ESP_LOGE(TAG, "No memory for button queue");
+        return false;
+    }
+
+    if (s_cfg.power_gpio != GPIO_NUM_NC) {
+        const gpio_config_t io_conf = {
+            .pin_bit_mask = (1ULL << s_cfg.power_gpio),
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = GPIO_PULLUP_ENABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_LOW_LEVEL,
+        };
+        gpio_config(&io_conf);
+        gpio_intr_disable(s_cfg.power_gpio);
+        // ISR 服务可能已由其他模块安装
+        const esp_err_t err = gpio_install_isr_service(0);
+        if ((err != ESP_OK && err != ESP_ERR_INVALID_STATE) ||
+            gpio_isr_handler_add(s_cfg.power_gpio, power_key_isr, NULL) != ESP_OK) {
+            ESP_LOGW(TAG, "Power key interrupt unavailable");
+            s_cfg.power_gpio = GPIO_NUM_NC;
+        }
+    }
+
+    // 先建任务：监视器一启用就可能通知它
+    if (xTaskCreate(buttons_task, "buttons", BUTTONS_TASK_STACK, NULL, BUTTONS_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create button task");
+        return false;
+    }
+    if (!setup_adc()) {
+        return false;
+    }
+    arm_power_key();
+    if (!BUTTONS_HAVE_MONITOR) {
+        xTaskNotify(s_task, NOTIFY_WAKE, eSetBits);
+    }
+    ESP_LOGI(TAG, "Buttons on ADC continuous mode: %d Hz, %d-byte frames, %s",
+             BUTTONS_SAMPLE_FREQ_HZ, FRAME_BYTES,
+             BUTTONS_HAVE_MONITOR ? "threshold monitor wake" : "always reading");
+    return true;
+}
+
+void buttons_set_listener(void (*listener)(void)) {
+    s_listener = listener;
+}
+
+void buttons_inject(button_t button, bool pressed) {
+    if (s_queue == NULL) {
+        return;
+    }
+    post_event(button, pressed);
+    if (s_listener != NULL) {
+        s_listener();
+    }
+}
+
+bool buttons_get_event(button_event_t *ev, uint32_t wait_ms) {
+    if (s_queue == NULL) {
+        return false;
+    }
+    return xQueueReceive(s_queue, ev, pdMS_TO_TICKS(wait_ms)) == pdTRUE;
+}
+
+button_t buttons_get_state(void) {
+    return s_state;
+}
+
+button_t buttons_sample(uint32_t timeout_ms) {
+    if (s_task == NULL) {
+        return BTN_NONE;
+    }
+    button_t btn = s_state;
+    xSemaphoreTake(s_sample_lock, portMAX_DELAY);
+    xSemaphoreTake(s_sample_done, 0);   // 清掉上一次超时后迟到的完成信号
+    xTaskNotify(s_task, NOTIFY_SAMPLE, eSetBits);
+    if (xSemaphoreTake(s_sample_done, pdMS_TO_TICKS(timeout_ms)) == pdTRUE) {
+        btn = s_instant;
+    }
+    xSemaphoreGive(s_sample_lock);
+    return btn;
+}
+
+int buttons_battery_raw(void) {
+    return s_battery_raw;
+}
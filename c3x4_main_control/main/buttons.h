@@ -0,0 +1,86 @@
+/**
+ * @file buttons.h
+ * @brief 按键子系统：ADC 连续转换（DMA）采样电阻分压按键，消抖后的按下/释放事件进入队列
+ *
+ * 两路按键分压和电池分压组成一个转换序列，由 ADC 数字控制器以 BUTTONS_SAMPLE_FREQ_HZ
+ * 连续转换、DMA 写入驱动的环形缓冲区，CPU 不再逐次 adc_oneshot_read。
+ * 按键通道各接一个 IIR 数字滤波器；阈值监视器在分压低于"无按键"电平时产生中断，
+ * 电源键（数字输入）用 GPIO 边沿中断。没有按键时按键任务一直阻塞，旧的转换结果
+ * 由驱动直接丢弃；中断到来后任务逐轮读取转换结果，连续 BUTTONS_DEBOUNCE_ROUNDS 轮
+ * 分类一致才确认状态变化，放入事件队列并回调监听者，全部释放后重新等待中断。
+ *
+ * LVGL 定时器任务只从队列取事件（buttons_get_event），不做任何 ADC 操作。
+ * 不支持阈值监视器的芯片上任务持续读取转换结果，接口不变
+ */
+
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/gpio.h"
+#include "hal/adc_types.h"
+#include "lvgl_driver.h"   // button_t
+
+#define BUTTONS_SAMPLE_FREQ_HZ   1000   // 整个序列的转换速率（3 个通道，每通道约 333 Hz）
+#define BUTTONS_FRAME_ROUNDS     4      // 每个 DMA 帧包含的序列轮数（约 12 ms 一帧）
+#define BUTTONS_DEBOUNCE_ROUNDS  5      // 状态变化需要连续一致的轮数（约 15 ms）
+#define BUTTONS_QUEUE_LEN        16
+
+typedef struct {
+    adc_channel_t ladder_a;   // 4 键分压：Right / Left / Confirm / Back
+    adc_channel_t ladder_b;   // 2 键分压：Volume Down / Volume Up
+    adc_channel_t battery;    // 电池分压（与按键同一转换序列）
+    gpio_num_t power_gpio;    // 电源键，低电平有效（GPIO_NUM_NC 表示没有）
+} buttons_config_t;
+
+typedef struct {
+    button_t button;
+    bool pressed;             // true = 按下，false = 释放
+    uint32_t time_ms;         // 确认状态变化的时间（esp_timer，毫秒）
+} button_event_t;
+
+/**
+ * @brief 配置 ADC 连续转换、滤波器、阈值监视器并启动按键任务
+ */
+bool buttons_init(const buttons_config_t *cfg);
+
+/**
+ * @brief 设置监听者：每放入一个事件后调用（在按键任务中）
+ */
+void buttons_set_listener(void (*listener)(void));
+
+/**
+ * @brief 放入一个外部来源（BLE 翻页器）的按键事件，与 ADC 按键共用队列和快速通道
+ *
+ * 可在任意任务中调用，不阻塞，队列满时丢弃。不影响 buttons_get_state 的消抖状态
+ */
+void buttons_inject(button_t button, bool pressed);
+
+/**
+ * @brief 从队列取一个事件
+ * @param wait_ms 最多等待的时间，0 表示不等待
+ * @return false 队列为空
+ */
+bool buttons_get_event(button_event_t *ev, uint32_t wait_ms);
+
+/**
+ * @brief 最近一次消抖后的按键状态（不访问 ADC）
+ */
+button_t buttons_get_state(void);
+
+/**
+ * @brief 请求按键任务读取一帧新的转换结果，返回其中最后一轮的即时分类（未消抖）
+ *
+ * 用于浅睡眠定时唤醒后的检查：ADC 的阈值监视器不是浅睡眠唤醒源。
+ * 可能阻塞约一帧时间；超时返回最近的消抖状态
+ */
+button_t buttons_sample(uint32_t timeout_ms);
+
+/**
+ * @brief 电池通道最近一帧的平均原始值（调用 buttons_sample 可先刷新）
+ * @return -1 尚无数据
+ */
+int buttons_battery_raw(void);
+
+#endif // BUTTONS_H
@@ -0,0 +1,309 @@
+/**
+ * @file charge_maint.c
+ * @brief 充电维护实现，见 charge_maint.h
+ */
+
+#include "charge_maint.h"
+#include "bg_jobs.h"
+#include "power_manager.h"
+#include "ui/library_db.h"
+#include "ui/page_index.h"
+#include "ui/reader_screen.h"
+#include "ui/screen_manager.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+static const char *TAG = "CHARGE_MAINT";
+
+typedef enum {
+    MAINT_SWEEP = 0,     // 整理缓存目录（后台维护作业）
+    MAINT_LIBRARY,       // 扫描书库（LVGL 定时器）
+    MAINT_DONE,          // 本次接通电源已做完
+} maint_phase_t;
+
+static struct {
+    charge_maint_config_t cfg;
+    lv_timer_t *timer;
+    bool active;
+    maint_phase_t phase;
+    bg_job_id_t sweep_job;
+    volatile bool sweep_finished;
+    bool library_started;
+} s_maint;
+
+// ---------------------------------------------------------------------------
+// 缓存整理：列出 PAGE_INDEX_DIR，记下可删除文件中最该删的 CHARGE_MAINT_SWEEP_BATCH 个，
+// 列完后删除临时文件，总量超出预算时再从最旧的删起。列目录与删除都可在文件之间暂停
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char name[24];
+    time_t mtime;
+    uint32_t size;
+    bool stale;          // 中断的临时文件，不论预算都删除
+} sweep_file_t;
+
+typedef struct {
+    DIR *dir;
+    bool listed;
+    uint64_t total;      // 可删除文件的总大小
+    int count;
+    int next;
+    int removed;
+    sweep_file_t files[CHARGE_MAINT_SWEEP_BATCH];   // 按删除顺序：临时文件在前，其余从旧到新
+} sweep_t;
+
+typedef enum {
+    SWEEP_KEEP = 0,      // 不是可重建的缓存（library.db 等）
+    SWEEP_CACHE,         // 分页索引、搜索索引、章节目录与解压检查点：用到时重建
+    SWEEP_STALE,         // 搜索索引构建中断留下的临时文件
+} sweep_kind_t;
+
+// 缓存文件名都是 8 位十六进制键加扩展名：.pgi / .fts / .toc / .ick，临时文件为 .ft<n>
+static sweep_kind_t sweep_classify(const char *name) {
+    const char *dot = strrchr(name, '.');
+    if (dot == NULL || dot - name != 8) {
+        return SWEEP_KEEP;
+    }
+    const char *ext = dot + 1;
+    if (strcasecmp(ext, "pgi") == 0 || strcasecmp(ext, "fts") == 0 ||
+        strcasecmp(ext, "toc") == 0 || strcasecmp(ext, "ick") == 0) {
+        return SWEEP_CACHE;
+    }
+    if (strncasecmp(ext, "ft", 2) == 0 && isdigit((unsigned char)ext[2])) {
+        return SWEEP_STALE;
+    }
+    return SWEEP_KEEP;
+}
+
+static bool sweep_before(const sweep_file_t *a, const sweep_file_t *b) {
+    return a->stale != b->stale ? a->stale : a->mtime < b->mtime;
+}
+
+// 插入有序的候选表；满了时比最后一个更晚删的直接丢弃
+static void sweep_note(sweep_t *s, const sweep_file_t *file) {
+    int i = s->count;
+    if (i == CHARGE_MAINT_SWEEP_BATCH) {
+        if (!sweep_before(file, &s->files[i - 1])) {
+            return;
+        }
+        i--;
+    } else {
+        s->count++;
+    }
+    while (i > 0 && sweep_before(file, &s->files[i - 1])) {
+        s->files[i] = s->files[i - 1];
+        i--;
+    }
+    s->files[i] = *file;
+}
+
+static void sweep_entry(sweep_t *s, const char *name) {
+    const sweep_kind_t kind = sweep_classify(name);
+    if (kind == SWEEP_KEEP || strlen(name) >= sizeof(((sweep_file_t *)0)->name)) {
+        return;
+    }
+    char path[64];
+    struct stat st;
+    snprintf(path, sizeof(path), "%s/%s", PAGE_INDEX_DIR, name);
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return;
+    }
+    sweep_file_t file = {
+        .mtime = st.st_mtime,
+        .size = (uint32_t)st.st_size,
+        .stale = kind == SWEEP_STALE,
+    };
+    strcpy(file.name, name);
+    s->total += file.size;
+    sweep_note(s, &file);
+}
+
+static bool sweep_step(bg_job_t *job, void *arg) {
+    sweep_t *s = (sweep_t *)arg;
+    if (!s->listed) {
+        if (s->dir == NULL && (s->dir = opendir(PAGE_INDEX_DIR)) == NULL) {
+            return false;
+        }
+        struct dirent *entry;
+        while ((entry = readdir(s->dir)) != NULL) {
+            sweep_entry(s, entry->d_name);
+            if (bg_job_should_yield(job)) {
+                return true;
+            }
+        }
+        closedir(s->dir);
+        s->dir = NULL;
+        s->listed = true;
+    }
+
+    while (s->next < s->count) {
+        const sweep_file_t *file = &s->files[s->next];
+        if (!file->stale && s->total <= CHARGE_MAINT_CACHE_BUDGET) {
+            break;
+        }
+        if (bg_job_should_yield(job)) {
+            return true;
+        }
+        char path[64];
+        snprintf(path, sizeof(path), "%s/%s", PAGE_INDEX_DIR, file->name);
+        if (unlink(path) == 0) {
+            s->removed++;
+        }
+        s->total -= s->total < file->size ? s->total : file->size;
+        s->next++;
+    }
+    return false;
+}
+
+static void sweep_done(void *arg, bool finished) {
+    sweep_t *s = (sweep_t *)arg;
+    if (s->dir != NULL) {
+        closedir(s->dir);
+    }
+    if (finished) {
+        ESP_LOGI(TAG, "Cache sweep: removed %d file(s), %u KB of rebuildable cache left",
+                 s->removed, (unsigned)(s->total / 1024));
+    }
+    free(s);
+    s_maint.sweep_finished = true;
+}
+
+static bool sweep_submit(void) {
+    sweep_t *s = calloc(1, sizeof(sweep_t));
+    if (s == NULL) {
+        return false;
+    }
+    s_maint.sweep_finished = false;
+    const bg_job_desc_t desc = {
+        .name = "cache_sweep",
+        .prio = BG_JOB_PRIO_MAINT,
+        .step = sweep_step,
+        .done = sweep_done,
+        .arg = s,
+    };
+    s_maint.sweep_job = bg_jobs_submit(&desc);
+    if (s_maint.sweep_job == BG_JOB_NONE) {
+        free(s);
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 维护策略（LVGL 任务）
+// ---------------------------------------------------------------------------
+
+// 书库扫描在文件浏览器中属于浏览器自己（离开时由它关闭数据库），其他屏幕上由这里关闭
+static void library_release(void) {
+    if (s_maint.library_started &&
+        screen_manager_get_current_screen() != SCREEN_TYPE_FILE_BROWSER) {
+        library_db_close();
+    }
+    s_maint.library_started = false;
+}
+
+static void maint_begin(void) {
+    static const char *const phase_names[] = {"cache sweep", "library scan"};
+    ESP_LOGI(TAG, "On USB power and idle, maintenance from %s", phase_names[s_maint.phase]);
+    power_manager_lock(POWER_LOCK_CPU);
+    power_manager_lock(POWER_LOCK_AWAKE);
+    s_maint.active = true;
+    bg_jobs_set_maintenance(true);
+}
+
+static void maint_end(void) {
+    bg_jobs_set_maintenance(false);
+    library_release();
+    power_manager_unlock(POWER_LOCK_AWAKE);
+    power_manager_unlock(POWER_LOCK_CPU);
+    s_maint.active = false;
+    ESP_LOGI(TAG, "Maintenance %s", s_maint.phase == MAINT_DONE ? "finished" : "paused");
+}
+
+static void maint_advance(void) {
+    switch (s_maint.phase) {
+        case MAINT_SWEEP:
+            if (s_maint.sweep_job == BG_JOB_NONE) {
+                if (!sweep_submit()) {
+                    s_maint.phase = MAINT_LIBRARY;
+                }
+            } else if (s_maint.sweep_finished) {
+                s_maint.sweep_job = BG_JOB_NONE;
+                s_maint.phase = MAINT_LIBRARY;
+            }
+            break;
+
+        case MAINT_LIBRARY:
+            // 扫描被打断后从头开始，已入库且未改动的书会被快速跳过
+            if (!s_maint.library_started) {
+                library_db_index_start();
+                s_maint.library_started = true;
+            } else if (!library_db_is_indexing()) {
+                s_maint.phase = MAINT_DONE;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void maint_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (!s_maint.cfg.is_charging()) {
+        if (s_maint.active) {
+            maint_end();
+        }
+        // 拔掉电源：下次接通再做一遍（暂停中的整理作业留在队列里，届时继续）
+        if (s_maint.phase == MAINT_DONE) {
+            s_maint.phase = MAINT_SWEEP;
+        }
+        return;
+    }
+
+    const bool idle = power_manager_get_idle_ms() >= CHARGE_MAINT_IDLE_MS &&
+                      reader_screen_get_open_path() == NULL &&
+                      (s_maint.cfg.can_run == NULL || s_maint.cfg.can_run());
+    if (!idle || s_maint.phase == MAINT_DONE) {
+        if (s_maint.active) {
+            maint_end();
+        }
+        return;
+    }
+    if (!s_maint.active) {
+        maint_begin();
+    }
+    maint_advance();
+    if (s_maint.phase == MAINT_DONE) {
+        maint_end();
+    }
+}
+
+void charge_maint_init(const charge_maint_config_t *cfg) {
+    if (cfg == NULL || cfg->is_charging == NULL || s_maint.timer != NULL) {
+        return;
+    }
+    s_maint.cfg = *cfg;
+    s_maint.timer = lv_timer_create(maint_timer_cb, CHARGE_MAINT_POLL_MS, NULL);
+    if (s_maint.timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create maintenance timer");
+    }
+}
+
+void charge_maint_pause(void) {
+    bg_jobs_set_maintenance(false);
+}
+
+bool charge_maint_is_active(void) {
+    return s_maint.active;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file charge_maint.h
+ * @brief 充电维护：接通 USB 电源且空闲时集中做重活，用电池阅读时很少再有后台负载
+ *
+ * LVGL 定时器每 CHARGE_MAINT_POLL_MS 检查一次：接通电源、距最后一次用户活动超过
+ * CHARGE_MAINT_IDLE_MS、没有打开的书且调用方允许（没有 USB/Wi-Fi 传输）时开始维护。
+ * 维护期间持有 CPU 最高频率与禁止浅睡眠的电源锁，放行 bg_jobs 的维护作业，依次：
+ *   1. 整理 /sdcard/.x4cache：删除中断的搜索索引临时文件；分页索引、搜索索引、章节目录与解压
+ *      检查点总量超过 CHARGE_MAINT_CACHE_BUDGET 时删除最旧的（用到时会重建）
+ *   2. 扫描书库：书名、作者与封面缩略图写入 library.db（library_db 的后台扫描）
+ * 任何用户活动（charge_maint_pause，挂在 power_manager 的活动回调上）立即收回维护
+ * 许可，正在运行的作业在下一个文件处停下；定时器随后停止书库扫描、释放电源锁，
+ * 再次空闲时从停下的地方继续。每次接通电源完整做一遍，拔掉电源后重新计
+ */
+
+#ifndef CHARGE_MAINT_H
+#define CHARGE_MAINT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CHARGE_MAINT_POLL_MS        200
+#define CHARGE_MAINT_IDLE_MS        5000   // 短于 POWER_IDLE_MS_DEFAULT：先维护，做完再浅睡眠
+#define CHARGE_MAINT_CACHE_BUDGET   (64u * 1024 * 1024)
+#define CHARGE_MAINT_SWEEP_BATCH    32     // 一轮整理最多删除的文件数（最旧的）
+
+typedef struct {
+    bool (*is_charging)(void);  // 是否接通 USB 电源
+    bool (*can_run)(void);      // 可选：返回 false 时不开始（SD 卡被传输占用等）
+} charge_maint_config_t;
+
+/**
+ * @brief 开始按 CHARGE_MAINT_POLL_MS 检查（在 LVGL 任务中、power_manager_init 之后调用）
+ */
+void charge_maint_init(const charge_maint_config_t *cfg);
+
+/**
+ * @brief 用户活动：立即收回维护许可（任意任务）
+ */
+void charge_maint_pause(void);
+
+/**
+ * @brief 是否正在维护（期间不进入浅睡眠）
+ */
+bool charge_maint_is_active(void);
+
+#endif // CHARGE_MAINT_H
@@ -0,0 +1,89 @@
+/**
+ * @file cpu_perf.h
+ * @brief 渲染路径的 CPU 停顿统计：用 RISC-V 性能计数器估计取指等待 flash cache 的周期
+ *
+ * ESP32-C3 没有 cache 命中/缺失计数器，只有一个可选事件的机器模式性能计数器
+ * （mpcer 选事件、mpccr 计数）。测量期间把它从"周期"切到"退休指令"，结束时用
+ * esp_timer 的耗时换算总周期，两者之差就是未执行指令的周期：绝大部分来自
+ * flash cache 缺失（每次从 flash 重新取一行要几十个周期），其余是访存/跳转冒险。
+ * 同一场景下停顿周期随缓存状态变化，IRAM 放置（linker.lf）的效果直接体现在这里。
+ *
+ * 计数器在测量期间不再计周期，依赖它的 esp_cpu_get_cycle_count/esp_rom_delay_us
+ * 会变慢，因此默认关闭，只在测量时用 -DCPU_PERF_ENABLE=1 编译。
+ * 计数器不区分任务，测量期间被抢占或阻塞（如 flush 等刷新任务上传完）的时间也计入，
+ * 比较时用不刷新面板的场景（display_bench 的 render_*）
+ */
+
+#ifndef CPU_PERF_H
+#define CPU_PERF_H
+
+#include <stdint.h>
+
+#ifndef CPU_PERF_ENABLE
+#define CPU_PERF_ENABLE 0
+#endif
+
+typedef struct {
+    int64_t start_us;
+    uint32_t saved_count;
+} cpu_perf_t;
+
+typedef struct {
+    uint32_t cycles;       // 总周期（耗时 x CPU 频率）
+    uint32_t stalls;       // 其中没有退休指令的周期
+} cpu_perf_result_t;
+
+#if CPU_PERF_ENABLE && !defined(SIM_BUILD)
+
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "riscv/csr.h"
+
+// mpcer 事件位（ESP32-C3 技术参考手册，性能计数器）
+#define CPU_PERF_EV_CYCLE  (1u << 0)
+#define CPU_PERF_EV_INST   (1u << 1)
+
+static inline void cpu_perf_begin(cpu_perf_t *p) {
+    p->saved_count = (uint32_t)RV_READ_CSR(CSR_PCCR_MACHINE);
+    RV_WRITE_CSR(CSR_PCER_MACHINE, CPU_PERF_EV_INST);
+    RV_WRITE_CSR(CSR_PCCR_MACHINE, 0);
+    p->start_us = esp_timer_get_time();
+}
+
+static inline cpu_perf_result_t cpu_perf_end(const cpu_perf_t *p) {
+    const uint32_t insns = (uint32_t)RV_READ_CSR(CSR_PCCR_MACHINE);
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - p->start_us);
+    const uint32_t cycles = us * esp_rom_get_cpu_ticks_per_us();
+    // 恢复周期计数，并补上测量期间经过的周期
+    RV_WRITE_CSR(CSR_PCER_MACHINE, CPU_PERF_EV_CYCLE);
+    RV_WRITE_CSR(CSR_PCCR_MACHINE, p->saved_count + cycles);
+    return (cpu_perf_result_t){ .cycles = cycles, .stalls = cycles > insns ? cycles - insns : 0 };
+}
+
+#else
+
+static inline void cpu_perf_begin(cpu_perf_t *p) {
+    (void)p;
+}
+
+static inline cpu_perf_result_t cpu_perf_end(const cpu_perf_t *p) {
+    (void)p;
+    return (cpu_perf_result_t){ 0 };
+}
+
+#endif
+
+#if !defined(SIM_BUILD)
+#include "esp32c3/rom/cache.h"
+#endif
+
+/**
+ * @brief 作废整个指令 cache（display_bench 的 render_cold 场景：测冷缓存下的最坏渲染耗时）
+ */
+static inline void cpu_perf_flush_icache(void) {
+#if !defined(SIM_BUILD)
+    Cache_Invalidate_ICache_All();
+#endif
+}
+
+#endif // CPU_PERF_H
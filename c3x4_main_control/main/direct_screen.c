@@ -0,0 +1,152 @@
+/**
+ * @file direct_screen.c
+ * @brief 极简画面实现：GUI_Paint 直接绘制到 EPD framebuffer
+ */
+
+#include "direct_screen.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "EPD_4in26.h"
+#include "GUI_Paint.h"
+#include "fonts.h"
+#include "battery.h"
+#include "lvgl_driver.h"
+#include "version.h"
+
+static const char *TAG = "DIRECT";
+
+#define SCREEN_W               480     // 逻辑宽度（竖屏）
+#define SCREEN_H               800
+#define FRAME_MARGIN           16      // 外框与屏幕边缘的距离
+#define DIRECT_WAIT_MS         2000    // LVGL 运行时等待 framebuffer / 刷新完成的上限
+#define RELEASE_WAIT_MS        10000   // 深度睡眠前等待电源键松开的上限
+
+// 电池图标（低电量画面）
+#define BAT_ICON_W             120
+#define BAT_ICON_H             56
+#define BAT_ICON_LINE          4
+#define BAT_NUB_W              10
+#define BAT_NUB_H              24
+
+// 实心矩形 [x, x + w) x [y, y + h)
+static void fill_rect(int x, int y, int w, int h, UWORD color) {
+    Paint_ClearWindows((UWORD)x, (UWORD)y, (UWORD)(x + w), (UWORD)(y + h), color);
+}
+
+// 空心矩形，边线向内 line 像素
+static void frame_rect(int x, int y, int w, int h, int line) {
+    fill_rect(x, y, w, line, BLACK);
+    fill_rect(x, y + h - line, w, line, BLACK);
+    fill_rect(x, y, line, h, BLACK);
+    fill_rect(x + w - line, y, line, h, BLACK);
+}
+
+// 水平居中的一行 ASCII 文本
+static void text_center(int y, const char *str, sFONT *font) {
+    const int w = (int)strlen(str) * font->Width;
+    const int x = w < SCREEN_W ? (SCREEN_W - w) / 2 : 0;
+    Paint_DrawString_EN((UWORD)x, (UWORD)y, str, font, BLACK, WHITE);
+}
+
+// 底部：版本与电量
+static void draw_footer(const battery_status_t *bat) {
+    char line[32];
+    if (bat->seq == 0) {
+        snprintf(line, sizeof(line), "Battery --");
+    } else {
+        snprintf(line, sizeof(line), "%s %u%%", bat->charging ? "Charging" : "Battery", bat->pct);
+    }
+    text_center(SCREEN_H - 64, VERSION_FULL, &Font12);
+    text_center(SCREEN_H - 46, line, &Font12);
+}
+
+static void draw_battery_icon(int cx, int cy, uint8_t pct) {
+    const int x = cx - (BAT_ICON_W + BAT_NUB_W) / 2;
+    const int y = cy - BAT_ICON_H / 2;
+    frame_rect(x, y, BAT_ICON_W, BAT_ICON_H, BAT_ICON_LINE);
+    fill_rect(x + BAT_ICON_W, cy - BAT_NUB_H / 2, BAT_NUB_W, BAT_NUB_H, BLACK);
+
+    // 电量条，与外框之间留 BAT_ICON_LINE 的白边；有电时至少画一格
+    const int inner_w = BAT_ICON_W - 4 * BAT_ICON_LINE;
+    int fill_w = inner_w * (pct > 100 ? 100 : pct) / 100;
+    if (pct > 0 && fill_w < BAT_ICON_LINE) {
+        fill_w = BAT_ICON_LINE;
+    }
+    if (fill_w > 0) {
+        fill_rect(x + 2 * BAT_ICON_LINE, y + 2 * BAT_ICON_LINE, fill_w,
+                  BAT_ICON_H - 4 * BAT_ICON_LINE, BLACK);
+    }
+}
+
+static void render(uint8_t *fb, direct_screen_t screen) {
+    battery_status_t bat;
+    battery_get(&bat);
+
+    Paint_NewImage(fb, EPD_4in26_WIDTH, EPD_4in26_HEIGHT, ROTATE_270, WHITE);
+    Paint_Clear(WHITE);
+    frame_rect(FRAME_MARGIN, FRAME_MARGIN, SCREEN_W - 2 * FRAME_MARGIN,
+               SCREEN_H - 2 * FRAME_MARGIN, 2);
+
+    switch (screen) {
+    case DIRECT_SCREEN_LOW_BATTERY:
+        draw_battery_icon(SCREEN_W / 2, 330, bat.pct);
+        text_center(410, "Battery low", &Font24);
+        text_center(450, "Charge to continue", &Font16);
+        break;
+    case DIRECT_SCREEN_SLEEP:
+        text_center(360, "Sleeping", &Font24);
+        text_center(400, "Press power to wake", &Font16);
+        break;
+    case DIRECT_SCREEN_BOOT:
+    default:
+        text_center(300, "Monster For Pan", &Font24);
+        text_center(340, "ESP32-C3-X4 System", &Font16);
+        fill_rect(140, 378, SCREEN_W - 280, 2, BLACK);
+        text_center(400, "Starting...", &Font16);
+        break;
+    }
+    draw_footer(&bat);
+}
+
+bool direct_screen_show(direct_screen_t screen) {
+    // LVGL 尚未初始化：独占 framebuffer，同步上传
+    uint8_t *fb = lvgl_fb_early();
+    if (fb != NULL) {
+        render(fb, screen);
+        EPD_4in26_Display_Fast(fb);
+        return true;
+    }
+
+    fb = lvgl_fb_write_begin(DIRECT_WAIT_MS);
+    if (fb == NULL) {
+        ESP_LOGW(TAG, "Framebuffer unavailable, screen %d not shown", (int)screen);
+        return false;
+    }
+    render(fb, screen);
+    lvgl_fb_write_end(NULL);
+    return lvgl_display_refresh_sync(EPD_REFRESH_FULL, DIRECT_WAIT_MS);
+}
+
+void direct_screen_power_off(direct_screen_t screen, gpio_num_t wake_gpio) {
+    ESP_LOGI(TAG, "Power off (screen %d)", (int)screen);
+    const bool early = lvgl_fb_early() != NULL;
+    direct_screen_show(screen);
+
+    // LVGL 运行时拿住 framebuffer 锁，刷新任务不会再碰面板
+    if (!early && lvgl_fb_read_begin(DIRECT_WAIT_MS) == NULL) {
+        ESP_LOGW(TAG, "Refresh task still busy, sleeping anyway");
+    }
+    EPD_4in26_WaitIdle();
+    EPD_4in26_Sleep();
+
+    // 低电平唤醒：按着电源键进入深度睡眠会立即醒来
+    for (int waited = 0; gpio_get_level(wake_gpio) == 0 && waited < RELEASE_WAIT_MS; waited += 20) {
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    esp_deep_sleep_enable_gpio_wakeup(BIT64(wake_gpio), ESP_GPIO_WAKEUP_GPIO_LOW);
+    esp_deep_sleep_start();
+}
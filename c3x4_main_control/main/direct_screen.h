@@ -0,0 +1,40 @@
+/**
+ * @file direct_screen.h
+ * @brief 不经过 LVGL 的极简画面：启动画面、低电量关机画面、关机画面
+ *
+ * 用 GUI_Paint 和内置点阵字体（Font12/16/24）直接画进 EPD framebuffer 后刷新，
+ * 不需要 LVGL 的内存池和定时器任务，也不分配堆。LVGL 初始化之前
+ * （lvgl_fb_early 可用时）同步上传面板，面板须已由调用方初始化；之后经
+ * lvgl_fb_write_begin / end 写入，再同步全刷一次。
+ *
+ * 方向与 LVGL 相同（逻辑 480x800 竖屏，ROTATE_270），启动画面可直接作为
+ * LVGL 首帧的局刷基准
+ */
+
+#ifndef DIRECT_SCREEN_H
+#define DIRECT_SCREEN_H
+
+#include <stdbool.h>
+#include "driver/gpio.h"
+
+typedef enum {
+    DIRECT_SCREEN_BOOT = 0,       // 启动画面：标题、版本、电量
+    DIRECT_SCREEN_LOW_BATTERY,    // 电池电量过低，提示充电
+    DIRECT_SCREEN_SLEEP,          // 关机（深度睡眠），提示按电源键唤醒
+} direct_screen_t;
+
+/**
+ * @brief 画出画面并刷新（电量取自 battery_get，版本取自 version.h）
+ * @return 实际刷新了面板返回 true；LVGL 处于灰阶/捕获模式或等待超时返回 false
+ */
+bool direct_screen_show(direct_screen_t screen);
+
+/**
+ * @brief 显示画面后让面板和芯片进入深度睡眠，不返回
+ *
+ * 等 wake_gpio（低电平有效的电源键）松开后才睡，按下电源键从头启动。
+ * 调用方先保存需要保留的状态（阅读进度等）
+ */
+void direct_screen_power_off(direct_screen_t screen, gpio_num_t wake_gpio);
+
+#endif // DIRECT_SCREEN_H
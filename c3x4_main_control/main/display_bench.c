@@ -0,0 +1,345 @@
+/**
+ * @file display_bench.c
+ * @brief 显示流水线基准测试实现
+ *
+ * 测试必须在 LVGL 任务中运行（创建控件、lvgl_trigger_render），因此外部请求
+ * 只设置标志，由 LVGL 定时器回调取走后同步执行。每次迭代翻转一个矩形的颜色，
+ * 失效区域即为场景设定的窗口，再用 lvgl_display_refresh_sync 等待面板空闲
+ */
+
+#include "display_bench.h"
+#include "text_bench.h"
+#include "lvgl_driver.h"
+#include "lvgl_draw_i1.h"
+#include "EPD_4in26.h"
+#include "cpu_perf.h"
+#include "power_manager.h"
+#include "version.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static const char *TAG = "BENCH";
+
+#define BENCH_POLL_MS            200
+#define BENCH_REFRESH_TIMEOUT_MS 10000
+
+// 场景：翻转颜色的矩形（逻辑坐标），w/h 为 0 表示整屏宽/高
+typedef struct {
+    const char *name;
+    epd_refresh_mode_t mode;
+    bool gray;
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} bench_scenario_t;
+
+static const bench_scenario_t s_scenarios[] = {
+    {"full",           EPD_REFRESH_FULL,    false, 0,   0,   0,   0},
+    {"fast",           EPD_REFRESH_FAST,    false, 0,   0,   0,   0},
+    {"partial_small",  EPD_REFRESH_PARTIAL, false, 32,  32,  64,  32},
+    {"partial_medium", EPD_REFRESH_PARTIAL, false, 120, 200, 240, 240},
+    {"partial_tall",   EPD_REFRESH_PARTIAL, false, 192, 0,   96,  0},
+    {"gray4",          EPD_REFRESH_FULL,    true,  0,   0,   0,   0},
+};
+
+// 绘制策略对比：整屏失效后只渲染、不刷新面板，比较 render/flush 耗时与 flush 次数
+typedef struct {
+    const char *name;
+    epd_render_strategy_t strategy;
+    uint16_t lines;
+} bench_render_case_t;
+
+static const bench_render_case_t s_render_cases[] = {
+    {"render_bands20",  EPD_RENDER_BANDS,        20},
+    {"render_bands40",  EPD_RENDER_BANDS,        40},
+    {"render_bands80",  EPD_RENDER_BANDS,        80},
+    {"render_double20", EPD_RENDER_BANDS_DOUBLE, 20},
+    {"render_direct",   EPD_RENDER_DIRECT,       0},
+};
+
+typedef struct {
+    uint32_t total_us;
+    lvgl_display_stats_t disp;
+    EPD_4in26_Stats epd;
+    bool ok;
+} bench_sample_t;
+
+static lv_timer_t *s_timer = NULL;
+static volatile bool s_requested = false;
+static bool s_running = false;
+
+// 填满屏幕的背景文字：让整屏渲染的耗时接近真实阅读页
+static const char *const s_bench_text =
+    "The quick brown fox jumps over the lazy dog. 0123456789 "
+    "Pack my box with five dozen liquor jugs. How vexingly quick daft zebras jump! "
+    "Sphinx of black quartz, judge my vow. The five boxing wizards jump quickly. ";
+
+static void bench_write_header(FILE *f) {
+    fprintf(f, "version,scenario,iter,ok,total_us,render_us,flush_us,flush_calls,"
+               "refresh_us,upload_us,upload_bytes,busy_us,updates,render_cycles,render_stalls\n");
+}
+
+static void bench_write_row(FILE *f, const char *name, int iter, const bench_sample_t *s) {
+    char line[224];
+    snprintf(line, sizeof(line), "%s,%s,%d,%d,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u",
+             VERSION_STRING, name, iter, s->ok ? 1 : 0,
+             (unsigned)s->total_us, (unsigned)s->disp.render_us,
+             (unsigned)s->disp.flush_us, (unsigned)s->disp.flush_calls,
+             (unsigned)s->disp.refresh_us, (unsigned)s->epd.upload_us,
+             (unsigned)s->epd.upload_bytes, (unsigned)s->epd.busy_us,
+             (unsigned)s->epd.updates, (unsigned)s->disp.render_cycles,
+             (unsigned)s->disp.render_stalls);
+    ESP_LOGI(TAG, "%s", line);
+    if (f != NULL) {
+        fprintf(f, "%s\n", line);
+    }
+}
+
+static FILE *bench_open_csv(char *path, size_t path_len) {
+    if (mkdir(DISPLAY_BENCH_DIR, 0775) != 0 && errno != EEXIST) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d), results go to log only",
+                 DISPLAY_BENCH_DIR, errno);
+        return NULL;
+    }
+
+    time_t now;
+    time(&now);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    char stamp[24];
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &timeinfo);
+    snprintf(path, path_len, "%s/bench_%s.csv", DISPLAY_BENCH_DIR, stamp);
+
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s, results go to log only", path);
+        return NULL;
+    }
+    bench_write_header(f);
+    return f;
+}
+
+// 翻转一次矩形颜色并等待面板完成刷新
+static void bench_run_once(const bench_scenario_t *sc, lv_obj_t *block, bool ink,
+                           bench_sample_t *out) {
+    lv_obj_set_style_bg_color(block, ink ? lv_color_black() : lv_color_white(), 0);
+
+    lvgl_display_reset_stats();
+    EPD_4in26_ResetStats();
+    const int64_t start_us = esp_timer_get_time();
+
+    lvgl_trigger_render(NULL);
+    out->ok = lvgl_display_refresh_sync(sc->mode, BENCH_REFRESH_TIMEOUT_MS);
+
+    out->total_us = (uint32_t)(esp_timer_get_time() - start_us);
+    lvgl_display_get_stats(&out->disp);
+    EPD_4in26_GetStats(&out->epd);
+}
+
+// 整屏渲染一次（不刷新面板）；cold 时先作废指令 cache，模拟刚执行完其它大段代码
+static void bench_render_once(lv_obj_t *screen, bool cold, bench_sample_t *out) {
+    lv_obj_invalidate(screen);
+    lvgl_display_reset_stats();
+    if (cold) {
+        cpu_perf_flush_icache();
+    }
+    EPD_4in26_ResetStats();
+    const int64_t start_us = esp_timer_get_time();
+    lvgl_trigger_render(NULL);
+    out->total_us = (uint32_t)(esp_timer_get_time() - start_us);
+    out->ok = true;
+    lvgl_display_get_stats(&out->disp);
+    EPD_4in26_GetStats(&out->epd);
+}
+
+static void bench_run_render_cases(FILE *f, lv_obj_t *screen) {
+    const epd_render_strategy_t saved = lvgl_get_render_strategy();
+    const uint16_t saved_lines = lvgl_get_render_band_lines();
+
+    // 整刷模式不记录脏区，渲染结果只留在 framebuffer 中，结束后整屏全刷覆盖
+    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
+    for (size_t i = 0; i < sizeof(s_render_cases) / sizeof(s_render_cases[0]); i++) {
+        const bench_render_case_t *rc = &s_render_cases[i];
+        if (!lvgl_set_render_strategy(rc->strategy, rc->lines)) {
+            ESP_LOGW(TAG, "Scenario %s skipped: not enough memory", rc->name);
+            continue;
+        }
+        ESP_LOGI(TAG, "Scenario %s: largest free block %u bytes", rc->name,
+                 (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+
+        bench_sample_t sample;
+        bench_render_once(screen, false, &sample);
+        lvgl_draw_i1_stats_t i1;
+        lvgl_draw_i1_take_stats(&i1);
+        for (int iter = 0; iter < DISPLAY_BENCH_ITERATIONS; iter++) {
+            bench_render_once(screen, false, &sample);
+            bench_write_row(f, rc->name, iter, &sample);
+        }
+        // 交给 I1 绘制单元的任务数（其余由软件渲染器完成）
+        lvgl_draw_i1_take_stats(&i1);
+        ESP_LOGI(TAG, "Scenario %s: I1 unit fills=%u borders=%u lines=%u labels=%u glyphs=%u",
+                 rc->name, (unsigned)i1.fills, (unsigned)i1.borders, (unsigned)i1.lines,
+                 (unsigned)i1.labels, (unsigned)i1.glyphs);
+    }
+    lvgl_set_render_strategy(saved, saved_lines);
+
+    // 默认策略下的冷缓存渲染：与同策略的 render_* 差得越少，渲染耗时越稳定
+    for (int iter = 0; iter < DISPLAY_BENCH_ITERATIONS; iter++) {
+        bench_sample_t sample;
+        bench_render_once(screen, true, &sample);
+        bench_write_row(f, "render_cold", iter, &sample);
+    }
+}
+
+static void bench_run(void) {
+    lv_display_t *disp = lv_display_get_default();
+    if (disp == NULL) {
+        ESP_LOGW(TAG, "Display not initialized");
+        return;
+    }
+
+    const int32_t hor = lv_display_get_horizontal_resolution(disp);
+    const int32_t ver = lv_display_get_vertical_resolution(disp);
+    const epd_refresh_mode_t saved_mode = lvgl_get_refresh_mode();
+    const epd_gray_policy_t saved_policy = lvgl_get_gray_policy();
+    const bool saved_gray = lvgl_is_grayscale();
+    lv_obj_t *prev_screen = lv_screen_active();
+
+    char path[64] = {0};
+    FILE *f = bench_open_csv(path, sizeof(path));
+    ESP_LOGI(TAG, "Display benchmark started (%u scenario(s) x %d), output=%s",
+             (unsigned)(sizeof(s_scenarios) / sizeof(s_scenarios[0]) +
+                        sizeof(s_render_cases) / sizeof(s_render_cases[0]) + 1),
+             DISPLAY_BENCH_ITERATIONS, f != NULL ? path : "log");
+    if (f == NULL) {
+        ESP_LOGI(TAG, "version,scenario,iter,ok,total_us,render_us,flush_us,flush_calls,"
+                      "refresh_us,upload_us,upload_bytes,busy_us,updates,render_cycles,render_stalls");
+    }
+
+    // 专用屏幕：白底 + 满屏文字 + 被翻转的矩形
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(screen, 0, 0);
+    lv_obj_set_style_pad_all(screen, 0, 0);
+    lv_obj_remove_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *text = lv_label_create(screen);
+    lv_obj_set_width(text, hor);
+    lv_label_set_long_mode(text, LV_LABEL_LONG_CLIP);
+    lv_obj_set_style_text_color(text, lv_color_black(), 0);
+    char *buf = lv_malloc(strlen(s_bench_text) * 16 + 1);
+    if (buf != NULL) {
+        buf[0] = '\0';
+        for (int i = 0; i < 16; i++) {
+            strcat(buf, s_bench_text);
+        }
+        lv_label_set_text(text, buf);
+        lv_free(buf);
+    }
+
+    lv_obj_t *block = lv_obj_create(screen);
+    lv_obj_set_style_radius(block, 0, 0);
+    lv_obj_set_style_border_width(block, 0, 0);
+    lv_obj_set_style_bg_opa(block, LV_OPA_COVER, 0);
+    lv_obj_remove_flag(block, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_screen_load(screen);
+    lvgl_reset_refresh_state();
+
+    bool ink = false;
+    for (size_t i = 0; i < sizeof(s_scenarios) / sizeof(s_scenarios[0]); i++) {
+        const bench_scenario_t *sc = &s_scenarios[i];
+
+        if (sc->gray) {
+            lvgl_set_gray_policy(EPD_GRAY_POLICY_ALWAYS);
+            if (!lvgl_set_content_hint(EPD_CONTENT_IMAGE)) {
+                ESP_LOGW(TAG, "Scenario %s skipped: grayscale unavailable", sc->name);
+                lvgl_set_gray_policy(saved_policy);
+                continue;
+            }
+        }
+
+        lv_obj_set_pos(block, sc->x, sc->y);
+        lv_obj_set_size(block, sc->w > 0 ? sc->w : hor, sc->h > 0 ? sc->h : ver);
+        lvgl_set_refresh_mode(sc->mode);
+
+        // 预热：局刷基准、波形载入与面板唤醒不计入结果
+        bench_sample_t sample;
+        ink = !ink;
+        bench_run_once(sc, block, ink, &sample);
+
+        for (int iter = 0; iter < DISPLAY_BENCH_ITERATIONS; iter++) {
+            ink = !ink;
+            bench_run_once(sc, block, ink, &sample);
+            bench_write_row(f, sc->name, iter, &sample);
+        }
+
+        if (sc->gray) {
+            lvgl_set_gray_policy(saved_policy);
+            lvgl_set_content_hint(EPD_CONTENT_TEXT);
+        }
+    }
+
+    bench_run_render_cases(f, screen);
+
+    if (f != NULL) {
+        fclose(f);
+        ESP_LOGI(TAG, "Display benchmark finished, results saved to %s", path);
+    } else {
+        ESP_LOGI(TAG, "Display benchmark finished");
+    }
+
+    // 恢复原屏幕与设置，整屏全刷清除测试图案
+    lvgl_set_refresh_mode(saved_mode);
+    lvgl_set_gray_policy(saved_policy);
+    if (prev_screen != NULL) {
+        lv_screen_load(prev_screen);
+    }
+    lv_obj_delete(screen);
+    lvgl_reset_refresh_state();
+    if (saved_gray) {
+        lvgl_set_content_hint(EPD_CONTENT_IMAGE);
+    }
+    lvgl_clear_framebuffer();
+    lv_obj_invalidate(lv_screen_active());
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh_full();
+    power_manager_notify_activity();
+}
+
+static void bench_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (!s_requested || s_running) {
+        return;
+    }
+    s_running = true;
+    bench_run();
+    s_running = false;
+    s_requested = false;
+}
+
+void display_bench_init(void) {
+    if (s_timer == NULL) {
+        s_timer = lv_timer_create(bench_timer_cb, BENCH_POLL_MS, NULL);
+    }
+}
+
+bool display_bench_request(void) {
+    if (s_timer == NULL || s_requested || text_bench_is_running()) {
+        return false;
+    }
+    s_requested = true;
+    lvgl_timer_task_wake();
+    ESP_LOGI(TAG, "Display benchmark requested");
+    return true;
+}
+
+bool display_bench_is_running(void) { return s_requested || s_running; }
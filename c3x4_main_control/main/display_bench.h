@@ -0,0 +1,50 @@
+/**
+ * @file display_bench.h
+ * @brief 显示流水线基准测试：脚本化刷新场景 + 分阶段计时，结果写入 SD 卡 CSV
+ *
+ * 场景：全刷、快刷、小/中/整列高度窗口局刷、4 灰阶整屏。每个场景先预热一次
+ * （建立局刷基准、载入波形），再连续执行 DISPLAY_BENCH_ITERATIONS 次，每次记录：
+ *   - render_us  : LVGL 渲染（lv_refr_now，含 flush 转换）
+ *   - flush_us   : disp_flush_cb 中 I1/L8 -> EPD framebuffer 的转换
+ *   - refresh_us : 刷新任务 CPU 路径（脏区、帧差分、上传）
+ *   - upload_us  : SPI/DMA 上传（EPD 驱动统计）
+ *   - busy_us    : 刷新波形，0x20 到 BUSY 变低
+ *   - total_us   : 从修改控件到面板空闲的总时间
+ * 之后依次切换各绘制策略（20/40/80 行分带、双分带、整帧 DIRECT），只做整屏渲染
+ * 不刷新面板（render_* 场景），比较 render_us、flush_us 与 flush_calls；
+ * 内存不足的策略跳过，日志中给出每种策略下的最大空闲块。
+ * 最后的 render_cold 场景每次渲染前作废指令 cache，衡量渲染耗时对缓存状态的敏感程度；
+ * CPU_PERF_ENABLE 编译时另记录 render_cycles/render_stalls（见 cpu_perf.h）
+ * 结果写入 /sdcard/bench/bench_<时间>.csv，首列为固件版本，便于跨版本比较
+ *
+ * 测试期间临时切换到专用屏幕，结束后恢复原屏幕和刷新/灰阶设置
+ */
+
+#ifndef DISPLAY_BENCH_H
+#define DISPLAY_BENCH_H
+
+#include <stdbool.h>
+
+#define DISPLAY_BENCH_DIR        "/sdcard/bench"
+#define DISPLAY_BENCH_ITERATIONS 5
+
+/**
+ * @brief 注册基准测试调度定时器（在 LVGL 初始化后、LVGL 定时器任务启动前调用）
+ */
+void display_bench_init(void);
+
+/**
+ * @brief 请求运行一次基准测试（任意任务中调用，不阻塞）
+ *
+ * 测试在 LVGL 任务中执行，期间不处理按键。已有测试在运行或排队时忽略
+ *
+ * @return false 表示未初始化或已有测试在进行
+ */
+bool display_bench_request(void);
+
+/**
+ * @brief 检查基准测试是否正在运行或排队
+ */
+bool display_bench_is_running(void);
+
+#endif // DISPLAY_BENCH_H
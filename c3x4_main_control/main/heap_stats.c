@@ -0,0 +1,199 @@
+/**
+ * @file heap_stats.c
+ * @brief 堆遥测实现
+ */
+
+#include "heap_stats.h"
+#include "mem_pressure.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "HEAP";
+
+static const char *const s_tag_names[HEAP_TAG_COUNT] = {
+    "font", "epub", "image", "page", "lvgl", "ble", "io", "search", "dict",
+};
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static heap_tag_stats_t s_tags[HEAP_TAG_COUNT];
+static const char *s_scope = NULL;
+static uint32_t s_scope_min_free = 0;
+
+static inline uint32_t free_now(void) {
+    return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+// 记录一次占用变化；成功分配后顺便采样区间最低空闲
+static void account(heap_tag_t tag, uint32_t added, uint32_t removed, bool sample) {
+    const uint32_t free_bytes = sample ? free_now() : 0;
+    portENTER_CRITICAL(&s_mux);
+    heap_tag_stats_t *t = &s_tags[tag];
+    t->cur = t->cur + added > removed ? t->cur + added - removed : 0;
+    if (t->cur > t->peak) {
+        t->peak = t->cur;
+    }
+    if (sample && s_scope != NULL && free_bytes < s_scope_min_free) {
+        s_scope_min_free = free_bytes;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+static void account_fail(heap_tag_t tag, size_t size) {
+    portENTER_CRITICAL(&s_mux);
+    s_tags[tag].fails++;
+    portEXIT_CRITICAL(&s_mux);
+    ESP_LOGW(TAG, "%s: %u byte allocation failed (free %u, largest %u)", s_tag_names[tag],
+             (unsigned)size, (unsigned)free_now(),
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
+
+void *heap_stats_malloc(heap_tag_t tag, size_t size) {
+    void *p = malloc(size);
+    if (p == NULL && size != 0 && mem_pressure_relieve(tag, size)) {
+        p = malloc(size);
+        mem_pressure_note_retry(p != NULL);
+    }
+    if (p == NULL) {
+        if (size != 0) {
+            account_fail(tag, size);
+        }
+        return NULL;
+    }
+    account(tag, (uint32_t)heap_caps_get_allocated_size(p), 0, true);
+    return p;
+}
+
+void *heap_stats_calloc(heap_tag_t tag, size_t n, size_t size) {
+    void *p = calloc(n, size);
+    if (p == NULL && n != 0 && size != 0 && mem_pressure_relieve(tag, n * size)) {
+        p = calloc(n, size);
+        mem_pressure_note_retry(p != NULL);
+    }
+    if (p == NULL) {
+        if (n != 0 && size != 0) {
+            account_fail(tag, n * size);
+        }
+        return NULL;
+    }
+    account(tag, (uint32_t)heap_caps_get_allocated_size(p), 0, true);
+    return p;
+}
+
+void *heap_stats_realloc(heap_tag_t tag, void *ptr, size_t size) {
+    const uint32_t old = ptr != NULL ? (uint32_t)heap_caps_get_allocated_size(ptr) : 0;
+    void *p = realloc(ptr, size);
+    // 失败时原块不变，收缩后可以再试
+    if (p == NULL && size != 0 && mem_pressure_relieve(tag, size)) {
+        p = realloc(ptr, size);
+        mem_pressure_note_retry(p != NULL);
+    }
+    if (p == NULL) {
+        if (size != 0) {
+            account_fail(tag, size);
+        } else {
+            account(tag, 0, old, false);   // realloc(ptr, 0) 释放了原块
+        }
+        return NULL;
+    }
+    account(tag, (uint32_t)heap_caps_get_allocated_size(p), old, true);
+    return p;
+}
+
+void heap_stats_free(heap_tag_t tag, void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    const uint32_t size = (uint32_t)heap_caps_get_allocated_size(ptr);
+    free(ptr);
+    account(tag, 0, size, false);
+}
+
+void heap_stats_set(heap_tag_t tag, uint32_t bytes, uint32_t peak) {
+    if (peak < bytes) {
+        peak = bytes;
+    }
+    portENTER_CRITICAL(&s_mux);
+    s_tags[tag].cur = bytes;
+    if (peak > s_tags[tag].peak) {
+        s_tags[tag].peak = peak;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void heap_stats_begin_scope(const char *name) {
+    const uint32_t free_bytes = free_now();
+    portENTER_CRITICAL(&s_mux);
+    const char *prev = s_scope;
+    const uint32_t prev_min = s_scope_min_free;
+    s_scope = name;
+    s_scope_min_free = free_bytes;
+    portEXIT_CRITICAL(&s_mux);
+    if (prev != NULL) {
+        ESP_LOGI(TAG, "Screen '%s': lowest free %u bytes", prev, (unsigned)prev_min);
+    }
+}
+
+void heap_stats_get(heap_stats_t *out) {
+    out->free = free_now();
+    out->min_free = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    out->largest = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    out->largest_dma = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+    portENTER_CRITICAL(&s_mux);
+    out->scope = s_scope;
+    out->scope_min_free = s_scope != NULL && s_scope_min_free < out->free ? s_scope_min_free : out->free;
+    memcpy(out->tags, s_tags, sizeof(s_tags));
+    portEXIT_CRITICAL(&s_mux);
+}
+
+size_t heap_stats_cache_budget(size_t held, uint32_t share) {
+    const size_t free_bytes = free_now();
+    const size_t headroom = free_bytes > HEAP_STATS_RESERVE ? free_bytes - HEAP_STATS_RESERVE : 0;
+    return held + headroom / (share ? share : 1);
+}
+
+const char *heap_stats_tag_name(heap_tag_t tag) {
+    return tag < HEAP_TAG_COUNT ? s_tag_names[tag] : "?";
+}
+
+void heap_stats_log(void) {
+    heap_stats_t st;
+    heap_stats_get(&st);
+    ESP_LOGI(TAG, "Free %u (min %u), largest %u, largest DMA %u; screen '%s' lowest %u",
+             (unsigned)st.free, (unsigned)st.min_free, (unsigned)st.largest,
+             (unsigned)st.largest_dma, st.scope ? st.scope : "-", (unsigned)st.scope_min_free);
+    for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+        ESP_LOGI(TAG, "  %-5s %6u bytes (peak %6u, %u failed)", s_tag_names[i],
+                 (unsigned)st.tags[i].cur, (unsigned)st.tags[i].peak, (unsigned)st.tags[i].fails);
+    }
+}
+
+size_t heap_stats_format_json(char *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    heap_stats_t st;
+    heap_stats_get(&st);
+    size_t pos = (size_t)snprintf(buf, len,
+                                  "{\"free\":%u,\"min_free\":%u,\"largest\":%u,\"largest_dma\":%u,"
+                                  "\"scope\":\"%s\",\"scope_min_free\":%u,\"tags\":{",
+                                  (unsigned)st.free, (unsigned)st.min_free, (unsigned)st.largest,
+                                  (unsigned)st.largest_dma, st.scope ? st.scope : "",
+                                  (unsigned)st.scope_min_free);
+    for (int i = 0; i < HEAP_TAG_COUNT && pos < len; i++) {
+        pos += (size_t)snprintf(buf + pos, len - pos, "%s\"%s\":{\"cur\":%u,\"peak\":%u,\"fails\":%u}",
+                                i ? "," : "", s_tag_names[i], (unsigned)st.tags[i].cur,
+                                (unsigned)st.tags[i].peak, (unsigned)st.tags[i].fails);
+    }
+    if (pos < len) {
+        pos += (size_t)snprintf(buf + pos, len - pos, "}}");
+    }
+    if (pos >= len) {
+        buf[0] = '\0';
+        return 0;
+    }
+    return pos;
+}
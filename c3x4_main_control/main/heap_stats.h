@@ -0,0 +1,103 @@
+/**
+ * @file heap_stats.h
+ * @brief 堆遥测：按子系统标记的分配计数、高水位、空闲/最大块，以及缓存的动态预算
+ *
+ * ESP32-C3 可用堆不到 100 KB，Wi-Fi、BLE、SD、LVGL 不能同时常驻，内存不足时
+ * 往往表现为 DMA 缓冲区分配失败而看不出是谁占用的。子系统的主要分配改用
+ * heap_stats_malloc 等包装函数并带上标记，按块的实际大小（heap_caps_get_allocated_size）
+ * 累计当前占用和峰值，不加块头，漏用包装函数释放只会让统计偏大，不会破坏堆。
+ * 不经过包装函数的占用（NimBLE 协议栈、LVGL 的静态内存池）由所属模块用
+ * heap_stats_set 报告。
+ *
+ * 界面切换时 heap_stats_begin_scope 开始一个新的统计区间（区间名取页面名），
+ * 记录区间内空闲堆的最低点，得到每个页面实际需要的内存。
+ * 缓存不再用固定的大小上限，而是用 heap_stats_cache_budget 按当前余量决定能占多少。
+ * 包装函数分配失败时先让 mem_pressure 收缩缓存，再重试一次
+ */
+
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 缓存预算计算时始终留给 DMA 缓冲区、Wi-Fi/BLE 突发分配的空闲堆
+#define HEAP_STATS_RESERVE  (24 * 1024)
+
+typedef enum {
+    HEAP_TAG_FONT = 0,     // 字体上下文、字形缓存、cmap 与前进宽度表
+    HEAP_TAG_EPUB,         // ZIP 目录与解压器、章节文本与分页
+    HEAP_TAG_IMAGE,        // 解码后的插图位图与解码工作区
+    HEAP_TAG_PAGE,         // 阅读器页面位图缓存与预渲染捕获缓冲区
+    HEAP_TAG_LVGL,         // LVGL 内存池（静态池，报告的是池内占用）
+    HEAP_TAG_BLE,          // NimBLE 控制器与协议栈（启动前后的空闲堆差）
+    HEAP_TAG_IO,           // 异步 SD 读取服务的块缓存
+    HEAP_TAG_SEARCH,       // 全文索引构建的词元段与合并缓冲区、章节目录识别
+    HEAP_TAG_DICT,         // 离线词典的块目录与解压块
+    HEAP_TAG_COUNT
+} heap_tag_t;
+
+typedef struct {
+    uint32_t cur;          // 当前占用（字节）
+    uint32_t peak;         // 开机以来的最高占用
+    uint32_t fails;        // 分配失败次数
+} heap_tag_stats_t;
+
+typedef struct {
+    uint32_t free;         // 当前空闲（8 位可访问堆）
+    uint32_t min_free;     // 开机以来的最低空闲
+    uint32_t largest;      // 最大空闲块
+    uint32_t largest_dma;  // 最大可 DMA 空闲块
+    const char *scope;     // 当前统计区间（页面名），NULL 表示未开始
+    uint32_t scope_min_free;   // 区间内的最低空闲（在带标记的分配时采样）
+    heap_tag_stats_t tags[HEAP_TAG_COUNT];
+} heap_stats_t;
+
+void *heap_stats_malloc(heap_tag_t tag, size_t size);
+void *heap_stats_calloc(heap_tag_t tag, size_t n, size_t size);
+void *heap_stats_realloc(heap_tag_t tag, void *ptr, size_t size);
+void heap_stats_free(heap_tag_t tag, void *ptr);
+
+/**
+ * @brief 直接设置某个标记的当前占用（不经过包装函数的子系统）
+ * @param peak 模块自己记录的峰值（如 LVGL 内存池的 max_used），0 表示按报告的占用累计
+ */
+void heap_stats_set(heap_tag_t tag, uint32_t bytes, uint32_t peak);
+
+/**
+ * @brief 开始新的统计区间并打印上一个区间的最低空闲（界面切换时在 LVGL 任务中调用）
+ * @param name 区间名（字符串常量，不复制）
+ */
+void heap_stats_begin_scope(const char *name);
+
+/**
+ * @brief 当前快照
+ */
+void heap_stats_get(heap_stats_t *out);
+
+/**
+ * @brief 缓存预算：已持有的 held 字节加上余量（空闲堆减 HEAP_STATS_RESERVE）的 1/share
+ *
+ * 随其它子系统的占用变化：BLE 关闭后缓存可以长大，Wi-Fi 传输模式下则收缩
+ */
+size_t heap_stats_cache_budget(size_t held, uint32_t share);
+
+/**
+ * @brief 标记名（"font"、"epub" ...）
+ */
+const char *heap_stats_tag_name(heap_tag_t tag);
+
+/**
+ * @brief 打印全部统计
+ */
+void heap_stats_log(void);
+
+/**
+ * @brief 导出为 JSON：{"free":..,"min_free":..,"largest":..,"largest_dma":..,
+ * "scope":"..","scope_min_free":..,"tags":{"font":{"cur":..,"peak":..,"fails":..},...}}
+ * @return 写入长度（不含结尾 0），缓冲区不够时返回 0 且 buf 为空串
+ */
+size_t heap_stats_format_json(char *buf, size_t len);
+
+#endif // HEAP_STATS_H
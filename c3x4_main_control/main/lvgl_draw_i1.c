@@ -0,0 +1,427 @@
+/**
+ * @file lvgl_draw_i1.c
+ * @brief I1（1bpp）目标层专用的 LVGL 绘制单元，见 lvgl_draw_i1.h
+ *
+ * I1 绘制缓冲区：8 字节调色板之后逐行存放，每行 stride 字节，
+ * 字节内最高位是最左边的像素，位 1 为白。
+ * 矩形按行写：首尾不满一字节的部分用掩码，中间整字节 memset；
+ * 字形按目标字节收集 8 个像素的覆盖位，再一次与/或写入
+ */
+
+#include "lvgl_draw_i1.h"
+#include "lvgl.h"
+#include "lvgl_private.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+// 需要 9.3 起的绘制任务接口（task->target_layer、LV_DRAW_TASK_STATE_FINISHED）
+#define DRAW_I1_SUPPORTED \
+    (LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 3))
+
+#if LVGL_DRAW_I1_ENABLE && DRAW_I1_SUPPORTED
+
+#define DRAW_I1_UNIT_ID  42   // 与 LVGL 内置单元（DRAW_UNIT_ID_SW = 1 等）不冲突
+#define DRAW_I1_SCORE    80   // 软件渲染器为 100，分数越低越优先
+
+#ifdef LV_DRAW_SW_I1_LUM_THRESHOLD
+#define DRAW_I1_LUM_THRESHOLD  LV_DRAW_SW_I1_LUM_THRESHOLD
+#else
+#define DRAW_I1_LUM_THRESHOLD  127
+#endif
+
+typedef struct {
+    lv_draw_unit_t base;
+    lv_draw_task_t *task_act;
+} draw_i1_unit_t;
+
+// 目标层的一次绘制上下文（绝对坐标）
+typedef struct {
+    uint8_t *row0;       // buf_area.y1 所在行
+    uint32_t stride;
+    int32_t x0;          // buf_area.x1
+    int32_t y0;          // buf_area.y1
+    lv_area_t clip;      // 任务裁剪区与缓冲区求交
+} draw_i1_target_t;
+
+static lvgl_draw_i1_stats_t s_stats;
+
+static inline bool color_is_white(lv_color_t c) {
+    return lv_color_luminance(c) > DRAW_I1_LUM_THRESHOLD;
+}
+
+static bool target_init(draw_i1_target_t *dst, lv_draw_task_t *t) {
+    lv_layer_t *layer = t->target_layer;
+    lv_draw_buf_t *buf = layer->draw_buf;
+    if (buf == NULL || !lv_area_intersect(&dst->clip, &t->clip_area, &layer->buf_area)) {
+        return false;
+    }
+    dst->row0 = lv_draw_buf_goto_xy(buf, 0, 0);
+    dst->stride = buf->header.stride;
+    dst->x0 = layer->buf_area.x1;
+    dst->y0 = layer->buf_area.y1;
+    return true;
+}
+
+// 把一字节中 cov 标出的像素写成白或黑
+static inline void put_bits(uint8_t *p, uint8_t cov, bool white) {
+    if (white) {
+        *p |= cov;
+    } else {
+        *p &= (uint8_t)~cov;
+    }
+}
+
+// 行内 [x1, x2]（相对缓冲区）写成同一颜色
+static void hline(uint8_t *row, int32_t x1, int32_t x2, bool white) {
+    const int32_t b1 = x1 >> 3;
+    const int32_t b2 = x2 >> 3;
+    const uint8_t m1 = (uint8_t)(0xFFu >> (x1 & 7));
+    const uint8_t m2 = (uint8_t)(0xFFu << (7 - (x2 & 7)));
+    if (b1 == b2) {
+        put_bits(row + b1, m1 & m2, white);
+        return;
+    }
+    put_bits(row + b1, m1, white);
+    if (b2 - b1 > 1) {
+        memset(row + b1 + 1, white ? 0xFF : 0x00, (size_t)(b2 - b1 - 1));
+    }
+    put_bits(row + b2, m2, white);
+}
+
+static void fill_rect(const draw_i1_target_t *dst, const lv_area_t *area, bool white) {
+    lv_area_t a;
+    if (!lv_area_intersect(&a, area, &dst->clip)) {
+        return;
+    }
+    const int32_t x1 = a.x1 - dst->x0;
+    const int32_t x2 = a.x2 - dst->x0;
+    uint8_t *row = dst->row0 + (uint32_t)(a.y1 - dst->y0) * dst->stride;
+    for (int32_t y = a.y1; y <= a.y2; y++, row += dst->stride) {
+        hline(row, x1, x2, white);
+    }
+}
+
+// 1 像素宽的矩形框（字形占位符）
+static void frame_rect(const draw_i1_target_t *dst, const lv_area_t *a, bool white) {
+    const lv_area_t edges[4] = {
+        {a->x1, a->y1, a->x2, a->y1},
+        {a->x1, a->y2, a->x2, a->y2},
+        {a->x1, a->y1, a->x1, a->y2},
+        {a->x2, a->y1, a->x2, a->y2},
+    };
+    for (int i = 0; i < 4; i++) {
+        fill_rect(dst, &edges[i], white);
+    }
+}
+
+// ============================================================================
+// 字形
+// ============================================================================
+
+// 从 1bpp 位流的第 i 个像素起取 8 个像素（最高位为第 i 个），nbytes 为该行字节数
+static inline uint8_t a1_get8(const uint8_t *src, uint32_t i, uint32_t nbytes) {
+    const uint32_t b = i >> 3;
+    const uint32_t hi = src[b];
+    const uint32_t lo = b + 1 < nbytes ? src[b + 1] : 0;
+    return (uint8_t)((((hi << 8) | lo) << (i & 7)) >> 8);
+}
+
+// 一行字形写入目标行：src 为该行起点，sx 为首个可见像素在行内的序号，
+// dx 为它在目标行的 x（相对缓冲区），共 w 个像素
+static void glyph_row(uint8_t *row, int32_t dx, const uint8_t *src, uint32_t src_stride,
+                      uint32_t bpp, uint32_t sx, int32_t w, bool white) {
+    int32_t done = 0;
+    while (done < w) {
+        const int32_t x = dx + done;
+        const int32_t bit0 = x & 7;
+        int32_t n = 8 - bit0;
+        if (n > w - done) {
+            n = w - done;
+        }
+        const uint32_t i = sx + (uint32_t)done;
+        uint8_t cov = 0;
+        if (bpp == 1) {
+            const uint8_t bits = a1_get8(src, i, src_stride) & (uint8_t)(0xFFu << (8 - n));
+            cov = (uint8_t)(bits >> bit0);
+        } else if (bpp == 8) {
+            for (int32_t k = 0; k < n; k++) {
+                if (src[i + k] > 127) {
+                    cov |= (uint8_t)(0x80u >> (bit0 + k));
+                }
+            }
+        } else {
+            // A2 / A4：取最高位即覆盖度 ≥ 50%
+            const uint32_t per_byte = 8 / bpp;
+            for (int32_t k = 0; k < n; k++) {
+                const uint32_t p = i + (uint32_t)k;
+                const uint32_t shift = 8 - bpp * (p % per_byte + 1);
+                if ((src[p / per_byte] >> shift) & (1u << (bpp - 1))) {
+                    cov |= (uint8_t)(0x80u >> (bit0 + k));
+                }
+            }
+        }
+        if (cov != 0) {
+            put_bits(row + (x >> 3), cov, white);
+        }
+        done += n;
+    }
+}
+
+static uint32_t glyph_format_bpp(lv_font_glyph_format_t format) {
+    switch (format) {
+        case LV_FONT_GLYPH_FORMAT_A1: return 1;
+        case LV_FONT_GLYPH_FORMAT_A2: return 2;
+        case LV_FONT_GLYPH_FORMAT_A4: return 4;
+        case LV_FONT_GLYPH_FORMAT_A8: return 8;
+        default: return 0;
+    }
+}
+
+static uint32_t color_format_bpp(lv_color_format_t cf) {
+    switch (cf) {
+        case LV_COLOR_FORMAT_A1: return 1;
+        case LV_COLOR_FORMAT_A2: return 2;
+        case LV_COLOR_FORMAT_A4: return 4;
+        case LV_COLOR_FORMAT_A8: return 8;
+        default: return 0;
+    }
+}
+
+static void draw_glyph(const draw_i1_target_t *dst, const lv_draw_glyph_dsc_t *g) {
+    const lv_area_t *letter = g->letter_coords;
+    lv_area_t a;
+    if (g->glyph_data == NULL || letter == NULL || !lv_area_intersect(&a, letter, &dst->clip)) {
+        return;
+    }
+
+    // 内置字体解码到 A8 绘制缓冲；流式字体直接返回原始位图（按 g->g 的格式与行宽）
+    const lv_draw_buf_t *buf = g->glyph_data;
+    const uint8_t *data;
+    uint32_t stride;
+    uint32_t bpp;
+    if (buf->header.magic == LV_IMAGE_HEADER_MAGIC) {
+        data = buf->data;
+        stride = buf->header.stride;
+        bpp = color_format_bpp((lv_color_format_t)buf->header.cf);
+    } else {
+        data = g->glyph_data;
+        bpp = glyph_format_bpp(g->format);
+        stride = g->g->stride != 0 ? g->g->stride
+                                   : ((uint32_t)lv_area_get_width(letter) * bpp + 7) / 8;
+    }
+    if (bpp == 0) {
+        return;
+    }
+
+    const bool white = color_is_white(g->color);
+    const uint32_t sx = (uint32_t)(a.x1 - letter->x1);
+    const int32_t w = lv_area_get_width(&a);
+    const int32_t dx = a.x1 - dst->x0;
+    const uint8_t *src = data + (uint32_t)(a.y1 - letter->y1) * stride;
+    uint8_t *row = dst->row0 + (uint32_t)(a.y1 - dst->y0) * dst->stride;
+    for (int32_t y = a.y1; y <= a.y2; y++, src += stride, row += dst->stride) {
+        glyph_row(row, dx, src, stride, bpp, sx, w, white);
+    }
+    s_stats.glyphs++;
+}
+
+static void letter_cb(lv_draw_task_t *t, lv_draw_glyph_dsc_t *glyph, lv_draw_fill_dsc_t *fill,
+                      const lv_area_t *fill_area) {
+    draw_i1_target_t dst;
+    if (!target_init(&dst, t)) {
+        return;
+    }
+    if (glyph != NULL) {
+        if (glyph->format == LV_FONT_GLYPH_FORMAT_NONE) {
+#if LV_USE_FONT_PLACEHOLDER
+            // 缺字占位框，与软件渲染器一致
+            if (glyph->bg_coords != NULL) {
+                frame_rect(&dst, glyph->bg_coords, color_is_white(glyph->color));
+            }
+#endif
+        } else if (glyph->format < LV_FONT_GLYPH_FORMAT_IMAGE) {
+            draw_glyph(&dst, glyph);
+        }
+    }
+    if (fill != NULL && fill_area != NULL && fill->opa >= LV_OPA_MAX) {
+        fill_rect(&dst, fill_area, color_is_white(fill->color));
+    }
+}
+
+// ============================================================================
+// 任务
+// ============================================================================
+
+static void draw_border(const draw_i1_target_t *dst, const lv_draw_border_dsc_t *dsc,
+                        const lv_area_t *c) {
+    const int32_t w = dsc->width;
+    const bool white = color_is_white(dsc->color);
+    if (dsc->side & LV_BORDER_SIDE_TOP) {
+        const lv_area_t a = {c->x1, c->y1, c->x2, c->y1 + w - 1};
+        fill_rect(dst, &a, white);
+    }
+    if (dsc->side & LV_BORDER_SIDE_BOTTOM) {
+        const lv_area_t a = {c->x1, c->y2 - w + 1, c->x2, c->y2};
+        fill_rect(dst, &a, white);
+    }
+    if (dsc->side & LV_BORDER_SIDE_LEFT) {
+        const lv_area_t a = {c->x1, c->y1, c->x1 + w - 1, c->y2};
+        fill_rect(dst, &a, white);
+    }
+    if (dsc->side & LV_BORDER_SIDE_RIGHT) {
+        const lv_area_t a = {c->x2 - w + 1, c->y1, c->x2, c->y2};
+        fill_rect(dst, &a, white);
+    }
+}
+
+// 线宽的上下分配与软件渲染器的水平/垂直直线相同
+static void draw_line(const draw_i1_target_t *dst, const lv_draw_line_dsc_t *dsc) {
+    const int32_t w = dsc->width - 1;
+    const int32_t half0 = w >> 1;
+    const int32_t half1 = half0 + (w & 1);
+    const int32_t x1 = (int32_t)dsc->p1.x, y1 = (int32_t)dsc->p1.y;
+    const int32_t x2 = (int32_t)dsc->p2.x, y2 = (int32_t)dsc->p2.y;
+    lv_area_t a;
+    if (y1 == y2) {
+        a.x1 = LV_MIN(x1, x2);
+        a.x2 = LV_MAX(x1, x2) - 1;
+        a.y1 = y1 - half1;
+        a.y2 = y1 + half0;
+    } else {
+        a.x1 = x1 - half1;
+        a.x2 = x1 + half0;
+        a.y1 = LV_MIN(y1, y2);
+        a.y2 = LV_MAX(y1, y2) - 1;
+    }
+    if (a.x1 <= a.x2 && a.y1 <= a.y2) {
+        fill_rect(dst, &a, color_is_white(dsc->color));
+    }
+}
+
+static void execute(lv_draw_task_t *t) {
+    draw_i1_target_t dst;
+    switch (t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            if (target_init(&dst, t)) {
+                const lv_draw_fill_dsc_t *dsc = t->draw_dsc;
+                fill_rect(&dst, &t->area, color_is_white(dsc->color));
+            }
+            s_stats.fills++;
+            break;
+        case LV_DRAW_TASK_TYPE_BORDER:
+            if (target_init(&dst, t)) {
+                draw_border(&dst, t->draw_dsc, &t->area);
+            }
+            s_stats.borders++;
+            break;
+        case LV_DRAW_TASK_TYPE_LINE:
+            if (target_init(&dst, t)) {
+                draw_line(&dst, t->draw_dsc);
+            }
+            s_stats.lines++;
+            break;
+        case LV_DRAW_TASK_TYPE_LABEL:
+            lv_draw_label_iterate_characters(t, t->draw_dsc, &t->area, letter_cb);
+            s_stats.labels++;
+            break;
+        default:
+            break;
+    }
+}
+
+// 只接管能在 1 位平面上与软件渲染器得到相同结果的任务
+static bool can_draw(const lv_draw_task_t *t) {
+    if (t->target_layer == NULL || t->target_layer->color_format != LV_COLOR_FORMAT_I1) {
+        return false;
+    }
+    switch (t->type) {
+        case LV_DRAW_TASK_TYPE_FILL: {
+            const lv_draw_fill_dsc_t *dsc = t->draw_dsc;
+            return dsc->radius == 0 && dsc->grad.dir == LV_GRAD_DIR_NONE && dsc->opa >= LV_OPA_MAX;
+        }
+        case LV_DRAW_TASK_TYPE_BORDER: {
+            const lv_draw_border_dsc_t *dsc = t->draw_dsc;
+            return dsc->radius == 0 && dsc->opa >= LV_OPA_MAX && dsc->width > 0;
+        }
+        case LV_DRAW_TASK_TYPE_LINE: {
+            const lv_draw_line_dsc_t *dsc = t->draw_dsc;
+            const bool straight = dsc->p1.x == dsc->p2.x || dsc->p1.y == dsc->p2.y;
+            const bool plain = (dsc->dash_width == 0 || dsc->dash_gap == 0) &&
+                               !dsc->round_start && !dsc->round_end;
+            return straight && plain && dsc->width > 0 && dsc->opa >= LV_OPA_MAX &&
+                   dsc->blend_mode == LV_BLEND_MODE_NORMAL;
+        }
+        case LV_DRAW_TASK_TYPE_LABEL: {
+            const lv_draw_label_dsc_t *dsc = t->draw_dsc;
+            return dsc->opa >= LV_OPA_MAX && dsc->rotation == 0 &&
+                   dsc->blend_mode == LV_BLEND_MODE_NORMAL;
+        }
+        default:
+            return false;
+    }
+}
+
+static int32_t draw_i1_evaluate(lv_draw_unit_t *draw_unit, lv_draw_task_t *task) {
+    (void)draw_unit;
+    if (task->preference_score > DRAW_I1_SCORE && can_draw(task)) {
+        task->preference_score = DRAW_I1_SCORE;
+        task->preferred_draw_unit_id = DRAW_I1_UNIT_ID;
+    }
+    return 0;
+}
+
+static int32_t draw_i1_dispatch(lv_draw_unit_t *draw_unit, lv_layer_t *layer) {
+    draw_i1_unit_t *u = (draw_i1_unit_t *)draw_unit;
+    if (u->task_act != NULL) {
+        return 0;
+    }
+
+    // 没有偏好的任务（LV_DRAW_UNIT_NONE）留给软件渲染器
+    lv_draw_task_t *t = lv_draw_get_available_task(layer, NULL, DRAW_I1_UNIT_ID);
+    if (t == NULL || t->preferred_draw_unit_id != DRAW_I1_UNIT_ID) {
+        return LV_DRAW_UNIT_IDLE;
+    }
+    if (lv_draw_layer_alloc_buf(layer) == NULL) {
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t->draw_unit = draw_unit;
+    u->task_act = t;
+
+    execute(t);
+
+    t->state = LV_DRAW_TASK_STATE_FINISHED;
+    u->task_act = NULL;
+    // 单元空闲，请求再次分发以取下一个任务
+    lv_draw_dispatch_request();
+    return 1;
+}
+
+void lvgl_draw_i1_init(void) {
+    draw_i1_unit_t *u = lv_draw_create_unit(sizeof(draw_i1_unit_t));
+    u->base.name = "I1";
+    u->base.evaluate_cb = draw_i1_evaluate;
+    u->base.dispatch_cb = draw_i1_dispatch;
+}
+
+void lvgl_draw_i1_take_stats(lvgl_draw_i1_stats_t *out) {
+    if (out != NULL) {
+        *out = s_stats;
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+#else
+
+void lvgl_draw_i1_init(void) {
+}
+
+void lvgl_draw_i1_take_stats(lvgl_draw_i1_stats_t *out) {
+    if (out != NULL) {
+        memset(out, 0, sizeof(*out));
+    }
+}
+
+#endif
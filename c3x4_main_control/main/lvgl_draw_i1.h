@@ -0,0 +1,47 @@
+/**
+ * @file lvgl_draw_i1.h
+ * @brief I1（1bpp）目标层专用的 LVGL 绘制单元
+ *
+ * 注册在 LVGL 9 的绘制流水线中，优先级高于软件渲染器。只接管在 1 位平面上
+ * 可以精确完成的任务，直接按位写绘制缓冲区，不经过通用混合路径和颜色转换：
+ *   - 纯色矩形填充（无圆角、无渐变、不透明）
+ *   - 无圆角边框
+ *   - 水平/垂直直线（无虚线、无圆头）
+ *   - 文本：A8 绘制缓冲或 A1/A2/A4 原始位图的字形按覆盖度阈值（≥ 50%）直接置位/清位，
+ *     下划线、删除线与选中背景按填充处理
+ * 其他任务（圆角、渐变、半透明、图片、旋转文本、斜线、灰阶模式下的 L8 层）
+ * 仍由软件渲染器完成。阈值与软件渲染器写 I1 时一致：颜色亮度大于
+ * LV_DRAW_SW_I1_LUM_THRESHOLD 为白（位 1）
+ *
+ * 单元在 LVGL 任务中同步执行，不需要额外线程
+ */
+
+#ifndef LVGL_DRAW_I1_H
+#define LVGL_DRAW_I1_H
+
+#include <stdint.h>
+
+// 置 0 时不注册，全部任务交给软件渲染器（用于对比渲染结果与耗时）
+#ifndef LVGL_DRAW_I1_ENABLE
+#define LVGL_DRAW_I1_ENABLE  1
+#endif
+
+typedef struct {
+    uint32_t fills;     // 接管的填充任务
+    uint32_t borders;   // 接管的边框任务
+    uint32_t lines;     // 接管的直线任务
+    uint32_t labels;    // 接管的文本任务
+    uint32_t glyphs;    // 其中写入的字形数
+} lvgl_draw_i1_stats_t;
+
+/**
+ * @brief 注册绘制单元（lv_init 之后、创建显示之前调用）
+ */
+void lvgl_draw_i1_init(void);
+
+/**
+ * @brief 读取并清零累计统计
+ */
+void lvgl_draw_i1_take_stats(lvgl_draw_i1_stats_t *out);
+
+#endif // LVGL_DRAW_I1_H
@@ -4,13 +4,33 @@
  */
 
 #include "lvgl_driver.h"
+#include "lvgl_draw_i1.h"
+#include "lvgl_theme_eink.h"
 #include "EPD_4in26.h"
+#include "EPD_Panel.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "trace.h"
+#include "cpu_perf.h"
+#include "power_manager.h"
+#include "buttons.h"
+#include "spi_arbiter.h"
+#include "heap_stats.h"
+#include "lvgl_mem_pool.h"
+#include "turn_stats.h"
+#include "stack_stats.h"
+#include "bg_jobs.h"
+#include "ui/file_pool.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/portmacro.h"
 #include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -26,42 +46,207 @@ static const char *TAG = "LVGL_DRV";
 // EPD显示尺寸
 // 物理屏幕为 800x480，但旧版 welcome 使用 ROTATE_270 形成竖屏逻辑坐标 480x800。
 // 为了沿用旧版竖向布局，这里让 LVGL 也工作在 480x800 的逻辑分辨率。
+//
+// 原生方向（横屏，lvgl_set_landscape）时 LVGL 直接工作在面板方向 (800x480)，
+// I1 行数据与控制器 RAM 格式一致，flush_cb 退化为逐行 memcpy，无需旋转。
+// EPD_NATIVE_ORIENTATION 只决定开机时的方向，运行中可以切换。
+// 注意：SSD1677 的数据输入模式 (0x11) 只能改变地址计数器的递增方向，
+// 不能转置字节内的 8 个像素，因此竖屏布局仍需 blit_rotate270 转换
+#ifndef EPD_NATIVE_ORIENTATION
+#define EPD_NATIVE_ORIENTATION 0
+#endif
+
 #define EPD_WIDTH 800
 #define EPD_HEIGHT 480
-#define DISP_HOR_RES 480
-#define DISP_VER_RES 800
-#define DISP_BUF_LINES 20  // 1bpp: 480×20÷8 = 12 KB
+static bool s_native = EPD_NATIVE_ORIENTATION;  // LVGL 坐标即面板坐标（横屏）
+#define DISP_HOR_RES (s_native ? EPD_WIDTH : EPD_HEIGHT)
+#define DISP_VER_RES (s_native ? EPD_HEIGHT : EPD_WIDTH)
+#ifndef DISP_BUF_LINES
+#define DISP_BUF_LINES 20  // 1bpp: 480×20÷8 = 1.2 KB (原生方向: 800×20÷8 = 2 KB)
+#endif
 #define MAX_PARTIAL_REFRESHES 10
 
 // 1bpp framebuffer for EPD (物理坐标系 800x480)
-static uint8_t s_epd_framebuffer[(EPD_WIDTH * EPD_HEIGHT) / 8];  // 48 KB
+// 字对齐：帧差分按 32 位字比较/哈希
+static WORD_ALIGNED_ATTR uint8_t s_epd_framebuffer[(EPD_WIDTH * EPD_HEIGHT) / 8];  // 48 KB
+
+// 乒乓 framebuffer（可选，lvgl_set_double_buffer 开启）
+// s_fb_back: disp_flush_cb 写入的后台缓冲区，单缓冲模式下即 s_epd_framebuffer
+// s_fb_alt:  第二块 48 KB 缓冲区，开启时从堆上分配（可复用释放 BLE 后的内存）
+// 刷新任务在互斥锁内交换前后台指针，随后从前台缓冲区上传，LVGL 同时渲染下一页
+static uint8_t *s_fb_back = s_epd_framebuffer;
+// lvgl_fb_early 交出过 framebuffer：其中是面板上的画面（启动画面），初始化时不清空
+static bool s_fb_early_used = false;
+static uint8_t *s_fb_alt = NULL;
+static bool s_double_buffer = false;
+
+// 捕获模式（lvgl_capture_begin）：flush 写入调用方提供的整帧缓冲区，
+// 不经过帧流水线、不记录脏区，用于离屏预渲染
+static uint8_t *s_capture_fb = NULL;
+
+// 静态图层（lvgl_layer_capture）：phys 为物理坐标矩形，x 扩展到 32 位字边界，
+// bits/mask 每行 words 个字，与 framebuffer 的字节布局相同，可直接按字合成
+typedef struct {
+  uint32_t *bits;
+  uint32_t *mask;
+  lv_area_t area;    // 逻辑坐标
+  lv_area_t phys;
+  uint16_t words;
+  bool opaque;
+  bool enabled;
+  bool restore;      // 图层区域被其它内容写过：下一帧结束时整块写回
+} fb_layer_t;
+static fb_layer_t s_layer;
+
+// 4 灰阶渲染（lvgl_set_content_hint 按策略开启）
+// LVGL 以 L8 渲染，flush_cb 把亮度量化为 2 bit（0 黑 .. 3 白），
+// 以 SSD1677 灰阶 LUT 需要的位平面形式保存：s_fb_back 为 0x24 平面（位 = !(g & 1)），
+// s_fb_gray_hi 为 0x26 平面（位 = !(g & 2)），全白为 0x00。
+// 面板加载灰阶波形后单色局刷不可用，退出时刷新任务重新加载单色波形并整屏刷新
+static uint8_t *s_fb_gray_hi = NULL;
+static bool s_gray_mode = false;
+static bool s_epd_gray_loaded = false;  // 面板当前为灰阶波形（仅刷新任务访问）
+static epd_gray_policy_t s_gray_policy = EPD_GRAY_POLICY_IMAGES;
+// 灰阶局刷窗口超过整屏的该比例时改为整屏灰阶刷新（百分比）
+#define GRAY_PARTIAL_MAX_PCT 50
 
 // LVGL 1bpp 工作缓冲区（逻辑坐标系 480x800）
 // 使用 PARTIAL 模式的小缓冲区，避免 DIRECT 模式的兼容性问题
 // 内存占用: (480×20÷8) + 8 = 12008 字节
 // +8 字节：LVGL I1 格式需要 8 字节调色板头部
-static uint8_t s_lvgl_draw_buffer[(DISP_HOR_RES * DISP_BUF_LINES) / 8 + 8];
-
-// Track the union of flushed areas since last EPD refresh.
-static lv_area_t s_dirty_area;
-static bool s_dirty_valid = false;
+// 按较宽的原生方向分配，两种方向都能放下 DISP_BUF_LINES 行
+static uint8_t s_lvgl_draw_buffer[(EPD_WIDTH * DISP_BUF_LINES) / 8 + 8];
+
+// 绘制缓冲区策略（lvgl_set_render_strategy）
+// - BANDS：一块 N 行缓冲区，N <= DISP_BUF_LINES 时复用上面的静态缓冲区，否则从堆上分配
+// - BANDS_DOUBLE：两块 N 行缓冲区交给 LVGL 轮换
+// - DIRECT：整帧 I1 缓冲区（48 KB），LVGL 只重绘失效区域，每个区域一次 flush；
+//   灰阶模式下同一块缓冲区改作 L8 分带（约 100 行）
+// 编译期默认值可用 EPD_RENDER_STRATEGY_DEFAULT / EPD_RENDER_BAND_LINES_DEFAULT 覆盖
+#ifndef EPD_RENDER_STRATEGY_DEFAULT
+#define EPD_RENDER_STRATEGY_DEFAULT EPD_RENDER_BANDS
+#endif
+#ifndef EPD_RENDER_BAND_LINES_DEFAULT
+#define EPD_RENDER_BAND_LINES_DEFAULT DISP_BUF_LINES
+#endif
+#define DISP_I1_STRIDE LV_DRAW_BUF_ALIGN_BYTES((DISP_HOR_RES + 7) / 8)
+#define DISP_DIRECT_BUF_SIZE (DISP_I1_STRIDE * DISP_VER_RES + 8)
+static epd_render_strategy_t s_render_strategy = EPD_RENDER_BANDS;
+static uint16_t s_band_lines = DISP_BUF_LINES;
+static uint8_t *s_draw_buf = s_lvgl_draw_buffer;
+static uint8_t *s_draw_buf2 = NULL;
+static uint32_t s_draw_buf_size = sizeof(s_lvgl_draw_buffer);
+static bool s_direct_render = false; // DIRECT 模式：flush_cb 的 px_map 是整帧缓冲区起点
+
+// Dirty rectangles since last EPD refresh, in EPD physical coordinates
+// (inclusive, x widened to byte boundaries). Each rect becomes one partial
+// window; all windows are uploaded before a single 0x20 activation.
+#define DIRTY_RECT_MAX 4
+// 合并阈值（像素）：合并后包围盒多出的面积小于此值时合并两个矩形。
+// 每个窗口需额外约 12 条命令（0x11/0x44/0x45/0x4E/0x4F×2），
+// 按 10 MHz SPI 折算约相当于 4K 像素的数据量
+#define DIRTY_MERGE_COST_PX 4096
+static lv_area_t s_dirty_rects[DIRTY_RECT_MAX];
+static uint8_t s_dirty_count = 0;
+// 焦点移动的旧、新焦点行（lvgl_invalidate_focus）：各自占一个窗口，不参与上面的
+// 合并，落在其中的 flush 并入对应的行；下一次取脏区时和其它矩形一起交出
+#define FOCUS_RECT_MAX 2
+static lv_area_t s_focus_rects[FOCUS_RECT_MAX];
+static uint8_t s_focus_count = 0;
+
+// 帧差分：记录上一次上传到面板的内容，局刷前剔除实际未变化的像素
+// SHADOW 模式保存 48 KB 完整影子帧（精确到字节列）；ROW_HASH 模式每个物理行
+// 保存一个 32 位哈希（1.9 KB，只能裁剪行范围）
+static epd_frame_diff_t s_frame_diff = EPD_FRAME_DIFF_OFF;
+static bool s_frame_diff_valid = false; // 影子内容与面板一致（首次整帧刷新后成立）
+static uint8_t *s_fb_shadow = NULL;
+static uint32_t s_row_hash[EPD_HEIGHT];
 
 // 当前刷新模式(可动态切换)
 // 重要: 首次刷新应用FULL模式,确保framebuffer与EPD完全同步!
 // 之后可切换为FAST或PARTIAL提升速度
 static epd_refresh_mode_t s_refresh_mode = EPD_REFRESH_FULL;
 
-// 局部刷新计数器: 多次局部刷新后强制全刷以消除鬼影
+// 自上次整屏刷新以来的局刷次数（仅用于日志）
 static uint32_t s_partial_refresh_count = 0;
-#define FORCE_FULL_REFRESH_AFTER_N_PARTIAL 10
-
-// EPD refresh state tracking (异步刷新)
-static bool s_epd_refreshing = false;
-static bool s_render_done = false; // disp_flush_cb 已完成写入
+// 切换屏幕后第一次局刷需要先整屏刷新，建立 0x26 对比基准
+static bool s_partial_needs_base = true;
+// 被取代的局刷（见 upload_superseded）已写进控制器 RAM 的窗口：其中是没有显示出来的
+// 中间帧，下一次局刷不经帧差分裁剪、一定重新覆盖这些窗口；整屏刷新后清空
+static lv_area_t s_stale_rects[DIRTY_RECT_MAX];
+static uint8_t s_stale_count = 0;
+// 面板内容由 lvgl_seed_panel_frame 声明（开机快照/断电恢复）：第一次刷新无论请求
+// 什么模式都按局刷处理，只刷与面板不同的行
+static bool s_panel_seeded = false;
+
+// 鬼影债务调度：按 80x80 物理像素网格累积每个区域的局刷"债务"
+// （覆盖面积 + 影子帧可用时的翻转像素数）。最大债务超过与温度相关的阈值后，
+// 等用户停止翻页 GHOST_IDLE_MS 再执行一次快刷清理；债务达到阈值的
+// GHOST_HARD_LIMIT_FACTOR 倍时不再等待，直接把本次局刷升级为全刷
+#define GHOST_CELL_PX 80
+#define GHOST_COLS (EPD_WIDTH / GHOST_CELL_PX)
+#define GHOST_ROWS (EPD_HEIGHT / GHOST_CELL_PX)
+#define GHOST_DEBT_PER_CELL 100   // 单元格被完整局刷一次记 100 点
+#define GHOST_FLIP_WEIGHT 2       // 每个翻转像素相对覆盖像素的权重
+#define GHOST_IDLE_MS 3000
+#define GHOST_HARD_LIMIT_FACTOR 2
+#define GHOST_TEMP_INTERVAL_MS (10 * 60 * 1000)
+static uint16_t s_ghost_debt[GHOST_ROWS][GHOST_COLS];
+static uint32_t s_ghost_max = 0;
+static bool s_ghost_cleanup_pending = false;
+// 夜间模式：s_night_mode 为请求值，s_night_applied 为刷新任务已交给控制器的值
+static volatile bool s_night_mode = false;
+static bool s_night_applied = false;
+static int s_ghost_temp_c = 25;
+static bool s_ghost_temp_valid = false;
+static TickType_t s_ghost_temp_tick = 0;
+
+// 面板空闲休眠：最后一次刷新结束 PANEL_SLEEP_IDLE_MS 后让 SSD1677 进入深度睡眠
+// （模式 1，保留 RAM）。按键唤醒时 lvgl_display_wake() 让刷新任务提前复位并
+// 初始化控制器，与 LVGL 渲染并行完成，下一次刷新无需再等待初始化
+#define PANEL_SLEEP_IDLE_MS 5000
+
+#define EPD_REFRESH_TASK_STACK 4096
+static uint32_t s_panel_sleep_ms = PANEL_SLEEP_IDLE_MS;
+static volatile bool s_panel_asleep = false;
+static volatile bool s_panel_wake_requested = false;
+
+// 帧流水线（异步刷新）：后台 framebuffer 中的一帧依次经历
+//   RENDERING  LVGL 正在 flush（该帧第一次 flush 进入，flush_is_last 时离开）
+//   RENDERED   渲染完成，尚未被刷新任务取走
+//   UPLOADING  刷新任务读取 framebuffer 并上传到控制器 RAM
+//   DISPLAYED  上传完成；波形可能仍在运行（s_epd_panel_busy，由 BUSY 中断回调清除）
+// 状态与事件位在 s_frame_lock（互斥量，带优先级继承）内一起修改，
+// 等待方看到的位与状态始终一致；事件组只用于唤醒：
+//   LVGL 在 UPLOADING 期间开始新的一帧时阻塞在 FRAME_EV_BACK_FREE 上，
+//   刷新任务在 RENDERING 期间收到请求时阻塞在 FRAME_EV_RENDER_IDLE 上，
+//   替换/释放刷新任务所用缓冲区的调用方等待 FRAME_EV_UPLOAD_IDLE。
+// 乒乓模式下刷新任务交换缓冲区后后台立即回到 DISPLAYED，上传仍在进行
+typedef enum {
+  FRAME_DISPLAYED = 0,
+  FRAME_RENDERING,
+  FRAME_RENDERED,
+  FRAME_UPLOADING,
+} frame_state_t;
+
+#define FRAME_EV_RENDER_IDLE (1u << 0) // 状态不是 RENDERING
+#define FRAME_EV_BACK_FREE   (1u << 1) // 状态不是 UPLOADING（后台 framebuffer 可写）
+#define FRAME_EV_UPLOAD_IDLE (1u << 2) // 刷新任务不在上传阶段
+#define FRAME_RENDER_WAIT_MS 2000      // 刷新任务等待渲染结束的上限（防止死锁）
+#define FRAME_UPLOAD_WAIT_MS 8000      // LVGL 等待上传结束的上限
+
+static EventGroupHandle_t s_frame_events = NULL;
+static SemaphoreHandle_t s_frame_lock = NULL;
+static frame_state_t s_frame_state = FRAME_DISPLAYED;
+static volatile bool s_epd_panel_busy = false;
+static volatile uint32_t s_fb_generation = 0;   // 后台 framebuffer 的写入次数（截图检测拼帧）
+static volatile uint32_t s_frames_rendered = 0; // 渲染完成的帧数（上传取代检查）
+static bool s_frame_dropped = false;            // 本帧开头等待上传超时，其余各块直接放行（LVGL 任务）
+static bool s_frame_redraw = false;             // 有帧被丢弃，渲染结束后整屏重绘（LVGL 任务）
+static uint32_t s_upload_frame = 0;             // 本次上传开始时的 s_frames_rendered
 static SemaphoreHandle_t s_epd_mutex = NULL;
-static SemaphoreHandle_t s_render_done_sem = NULL; // 渲染完成信号
 static TaskHandle_t s_epd_refresh_task_handle = NULL;
-static QueueHandle_t s_refresh_queue = NULL;
+static SemaphoreHandle_t s_mailbox_lock = NULL; // 保护刷新请求信箱
 
 // Protect dirty area state against concurrent access (flush_cb vs refresh
 // task).
@@ -70,11 +255,122 @@ static portMUX_TYPE s_dirty_mux = portMUX_INITIALIZER_UNLOCKED;
 // 全局显示设备指针（用于手动刷新模式）
 static lv_display_t *g_lv_display = NULL;
 
-// 刷新请求结构
+// 各阶段累计耗时（lvgl_display_get_stats）
+static lvgl_display_stats_t s_stats;
+
+// 按键延时统计（lvgl_get_key_latency）：按下时记下事件时间，
+// 之后第一次真正启动波形的刷新结束时结算
+#define KEY_LATENCY_MAX_MS 3000 // 超过则认为这次按键没有引起刷新，丢弃
+typedef struct {
+  uint32_t samples;
+  uint64_t sum_ms;
+  uint32_t last_ms;
+  uint32_t max_ms;
+} key_latency_acc_t;
+
+static key_latency_acc_t s_key_latency[2]; // [0] LVGL 输入设备路径，[1] 快速通道
+static portMUX_TYPE s_key_latency_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool s_key_latency_armed = false;
+static bool s_key_latency_fast = false;
+static uint32_t s_key_latency_press_ms = 0;
+
+// 刷新请求信箱：未处理的请求合并为一个
+// - 模式取优先级最高者：FULL > FAST > PARTIAL（枚举值即优先级）
+// - 脏矩形自然合并：flush_cb 持续累积到 s_dirty_rects，直到任务开始执行时才快照
+// - deadline 取最早者：到期前到达的请求都并入同一次刷新
+// - 完成信号量在刷新结束且面板空闲后逐个 give
+#define REFRESH_MAX_WAITERS 4
 typedef struct {
+  bool pending;
   epd_refresh_mode_t mode;   // 刷新模式
+  TickType_t deadline;       // 最迟开始时间
+  uint8_t waiter_count;
+  SemaphoreHandle_t waiters[REFRESH_MAX_WAITERS];
 } refresh_request_t;
 
+static refresh_request_t s_mailbox;  // 待处理
+static refresh_request_t s_inflight; // 正在执行（等待者超时注销时需要查找）
+static bool s_redraw_hold = false;   // 丢弃的帧重绘写完前扣住信箱中的请求（s_mailbox_lock 保护，只有 LVGL 任务修改）
+
+// 刷新任务是否处于上传阶段
+static inline bool frame_uploading(void) {
+  return (xEventGroupGetBits(s_frame_events) & FRAME_EV_UPLOAD_IDLE) == 0;
+}
+
+// 在 s_frame_lock 内从 from_mask 中的状态切换到 to，同时清除 clear_bits；
+// 状态不允许时等待 wake_bit 再检查。位只是提示，被唤醒后总是重新检查状态
+static bool frame_transition(uint32_t from_mask, frame_state_t to, EventBits_t clear_bits,
+                             EventBits_t wake_bit, TickType_t timeout) {
+  const TickType_t start = xTaskGetTickCount();
+  while (1) {
+    xSemaphoreTake(s_frame_lock, portMAX_DELAY);
+    const bool ok = (from_mask & (1u << s_frame_state)) != 0;
+    if (ok) {
+      s_frame_state = to;
+      xEventGroupClearBits(s_frame_events, clear_bits);
+    }
+    xSemaphoreGive(s_frame_lock);
+    if (ok) {
+      return true;
+    }
+    const TickType_t waited = xTaskGetTickCount() - start;
+    if (waited >= timeout) {
+      return false;
+    }
+    xEventGroupWaitBits(s_frame_events, wake_bit, pdFALSE, pdFALSE, timeout - waited);
+  }
+}
+
+// 设置状态并置位 set_bits；only_from 非 0 时仅在当前状态属于该集合时切换
+static void frame_set(uint32_t only_from, frame_state_t to, EventBits_t set_bits) {
+  xSemaphoreTake(s_frame_lock, portMAX_DELAY);
+  if (only_from == 0 || (only_from & (1u << s_frame_state)) != 0) {
+    s_frame_state = to;
+  }
+  xEventGroupSetBits(s_frame_events, set_bits);
+  xSemaphoreGive(s_frame_lock);
+}
+
+#define FRAME_IDLE_STATES ((1u << FRAME_DISPLAYED) | (1u << FRAME_RENDERED))
+
+// LVGL 开始写入新的一帧（disp_flush_cb 第一次调用，LVGL 任务）
+// 乒乓模式交换后后台状态不再是 UPLOADING，这里直接放行
+static bool frame_render_begin(void) {
+  if (!frame_transition(FRAME_IDLE_STATES, FRAME_RENDERING, FRAME_EV_RENDER_IDLE,
+                        FRAME_EV_BACK_FREE, pdMS_TO_TICKS(FRAME_UPLOAD_WAIT_MS))) {
+    return false;
+  }
+  s_fb_generation++;
+  return true;
+}
+
+// 最后一块 flush 完成，唤醒等待中的刷新任务
+static void frame_render_end(void) {
+  s_frames_rendered++;
+  frame_set(0, FRAME_RENDERED, FRAME_EV_RENDER_IDLE);
+}
+
+// 刷新任务取走后台 framebuffer 开始上传；等待进行中的渲染结束
+static bool frame_upload_begin(TickType_t timeout) {
+  if (!frame_transition(FRAME_IDLE_STATES, FRAME_UPLOADING,
+                        FRAME_EV_BACK_FREE | FRAME_EV_UPLOAD_IDLE, FRAME_EV_RENDER_IDLE,
+                        timeout)) {
+    return false;
+  }
+  s_epd_panel_busy = true;
+  return true;
+}
+
+// 乒乓模式：刷新任务已交换缓冲区，新的后台可以开始渲染（上传仍在进行）
+static void frame_back_released(void) {
+  frame_set(1u << FRAME_UPLOADING, FRAME_DISPLAYED, FRAME_EV_BACK_FREE);
+}
+
+// 上传结束（或放弃）：后台 framebuffer 交还 LVGL
+static void frame_upload_end(void) {
+  frame_set(1u << FRAME_UPLOADING, FRAME_DISPLAYED, FRAME_EV_BACK_FREE | FRAME_EV_UPLOAD_IDLE);
+}
+
 // 手动触发 LVGL 渲染刷新（用于 EPD 手动刷新模式）
 void lvgl_trigger_render(lv_display_t *disp) {
   // 如果传入 NULL，使用全局 display
@@ -83,22 +379,30 @@ void lvgl_trigger_render(lv_display_t *disp) {
   }
 
   if (disp != NULL) {
-    // Avoid rendering while EPD refresh task is reading/sending framebuffer.
-    // This prevents mixed old/new bytes being sent to the panel.
-    const TickType_t start = xTaskGetTickCount();
-    const TickType_t timeout = pdMS_TO_TICKS(8000);
-    while (s_epd_refreshing) {
-      if ((xTaskGetTickCount() - start) > timeout) {
-        ESP_LOGW(TAG, "lvgl_trigger_render: timed out waiting for EPD refresh");
-        return;
-      }
-      vTaskDelay(pdMS_TO_TICKS(10));
-    }
+    // 与刷新任务的互斥由帧流水线负责：本帧第一次 flush 时若刷新任务仍在上传
+    // 同一块 framebuffer，disp_flush_cb 阻塞到上传结束（事件组唤醒）
 
     // 调用一次 lv_timer_handler 处理动画和定时器
     lv_timer_handler();
     // 立即触发渲染
+    const int64_t render_start_us = esp_timer_get_time();
+    power_manager_lock(POWER_LOCK_CPU);
+    cpu_perf_t perf;
+    cpu_perf_begin(&perf);
     lv_refr_now(disp);
+    const cpu_perf_result_t perf_res = cpu_perf_end(&perf);
+    power_manager_unlock(POWER_LOCK_CPU);
+    s_stats.render_us += (uint32_t)(esp_timer_get_time() - render_start_us);
+    s_stats.renders++;
+    s_stats.render_cycles += perf_res.cycles;
+    s_stats.render_stalls += perf_res.stalls;
+
+    // LVGL 内存池是静态数组（附加池也不走带标记的包装函数），不在堆统计里：
+    // 每次渲染后报告池内占用，并按余量附加或摘下附加池
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    heap_stats_set(HEAP_TAG_LVGL, (uint32_t)(mon.total_size - mon.free_size), (uint32_t)mon.max_used);
+    lvgl_mem_pool_balance(0);
   } else {
     ESP_LOGW(TAG, "lvgl_trigger_render: display is NULL!");
   }
@@ -108,94 +412,752 @@ void lvgl_trigger_render(lv_display_t *disp) {
 // 改为流式发送，直接从 s_epd_framebuffer 按行发送数据
 // 节省内存：约 12 KB
 
+// 逻辑坐标 -> EPD 物理坐标（裁剪到屏幕内，精确到像素）
+static bool area_to_physical(const lv_area_t *area, lv_area_t *phys) {
+  if (s_native) {
+    *phys = *area;
+  } else {
+    // ROTATE_270: LVGL(x,y) -> EPD(memX=y, memY=EPD_HEIGHT-1-x)
+    phys->x1 = area->y1;
+    phys->x2 = area->y2;
+    phys->y1 = (int32_t)EPD_HEIGHT - 1 - area->x2;
+    phys->y2 = (int32_t)EPD_HEIGHT - 1 - area->x1;
+  }
+  if (phys->x1 < 0) phys->x1 = 0;
+  if (phys->y1 < 0) phys->y1 = 0;
+  if (phys->x2 > EPD_WIDTH - 1) phys->x2 = EPD_WIDTH - 1;
+  if (phys->y2 > EPD_HEIGHT - 1) phys->y2 = EPD_HEIGHT - 1;
+  return phys->x1 <= phys->x2 && phys->y1 <= phys->y2;
+}
+
+// 逻辑坐标 -> EPD 物理坐标（裁剪到屏幕内，X 扩展到字节边界）
+static bool dirty_to_physical(const lv_area_t *area, lv_area_t *phys) {
+  if (!area_to_physical(area, phys)) {
+    return false;
+  }
+  // EPD 硬件要求：X 坐标和宽度必须是 8 的倍数
+  phys->x1 &= ~7;
+  phys->x2 |= 7;
+  return true;
+}
+
+// 合并代价：包围盒比两个矩形多出的面积（重叠时为负）
+static int32_t dirty_merge_cost(const lv_area_t *a, const lv_area_t *b) {
+  lv_area_t u;
+  lv_area_join(&u, a, b);
+  return (int32_t)lv_area_get_size(&u) - (int32_t)lv_area_get_size(a) -
+         (int32_t)lv_area_get_size(b);
+}
+
 static void dirty_area_add(const lv_area_t *area) {
   // NOTE: Never call ESP_LOG inside a critical section; logging may acquire
   // locks.
-  bool do_expand_log = false;
-  int32_t y_gap = 0;
-  lv_area_t init_area = {0};
-  lv_area_t old_area = {0};
-  lv_area_t new_area = {0};
+  lv_area_t rect;
+  if (!dirty_to_physical(area, &rect)) {
+    return;
+  }
+
+  uint8_t count;
+  bool forced_merge = false;
 
   portENTER_CRITICAL(&s_dirty_mux);
 
-  if (!s_dirty_valid) {
-    s_dirty_area = *area;
-    s_dirty_valid = true;
-    init_area = *area;
-    portEXIT_CRITICAL(&s_dirty_mux);
+  // 焦点行覆盖（或几乎覆盖）的 flush 直接并入该行
+  for (uint8_t i = 0; i < s_focus_count; i++) {
+    if (dirty_merge_cost(&rect, &s_focus_rects[i]) < DIRTY_MERGE_COST_PX) {
+      lv_area_join(&s_focus_rects[i], &s_focus_rects[i], &rect);
+      portEXIT_CRITICAL(&s_dirty_mux);
+      TRACE_EVENT(TRACE_EV_DIRTY_ADD, TRACE_PACK(rect.x1, rect.y1), TRACE_PACK(rect.x2, rect.y2));
+      return;
+    }
+  }
+
+  // 与已有矩形反复合并，直到没有代价足够低的组合
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < s_dirty_count; i++) {
+      if (dirty_merge_cost(&rect, &s_dirty_rects[i]) < DIRTY_MERGE_COST_PX) {
+        lv_area_join(&rect, &rect, &s_dirty_rects[i]);
+        s_dirty_rects[i] = s_dirty_rects[--s_dirty_count];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (s_dirty_count < DIRTY_RECT_MAX) {
+    s_dirty_rects[s_dirty_count++] = rect;
+  } else {
+    // 列表已满：并入代价最小的矩形
+    uint8_t best = 0;
+    int32_t best_cost = INT32_MAX;
+    for (uint8_t i = 0; i < s_dirty_count; i++) {
+      const int32_t cost = dirty_merge_cost(&rect, &s_dirty_rects[i]);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best = i;
+      }
+    }
+    lv_area_join(&s_dirty_rects[best], &s_dirty_rects[best], &rect);
+    forced_merge = true;
+  }
+  count = s_dirty_count;
+
+  portEXIT_CRITICAL(&s_dirty_mux);
+
+  TRACE_EVENT(TRACE_EV_DIRTY_ADD, TRACE_PACK(rect.x1, rect.y1), TRACE_PACK(rect.x2, rect.y2));
+  TRACE_LOGI(LVGL, TAG, "[DIRTY] add LVGL(%d,%d)-(%d,%d) -> EPD(%d,%d)-(%d,%d), rects=%u%s",
+           (int)area->x1, (int)area->y1, (int)area->x2, (int)area->y2,
+           (int)rect.x1, (int)rect.y1, (int)rect.x2, (int)rect.y2,
+           (unsigned)count, forced_merge ? " (full, merged)" : "");
+}
+
+// 清空全部脏区（调用方持有 s_dirty_mux）
+static inline void dirty_clear(void) {
+  s_dirty_count = 0;
+  s_focus_count = 0;
+}
+
+// 把 rect 加入窗口列表 out[0..n)：未满时追加，否则并入代价最小的窗口；返回新的数量
+static uint8_t rects_append(lv_area_t out[DIRTY_RECT_MAX], uint8_t n, const lv_area_t *rect) {
+  if (n < DIRTY_RECT_MAX) {
+    out[n] = *rect;
+    return n + 1;
+  }
+  uint8_t best = 0;
+  int32_t best_cost = INT32_MAX;
+  for (uint8_t j = 0; j < n; j++) {
+    const int32_t cost = dirty_merge_cost(rect, &out[j]);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best = j;
+    }
+  }
+  lv_area_join(&out[best], &out[best], rect);
+  return n;
+}
+
+// 取出本次刷新的窗口并清空（调用方持有 s_dirty_mux）：焦点行在前，其余脏区
+// 在后；总数超过 DIRTY_RECT_MAX 时剩下的并入代价最小的窗口
+static uint8_t dirty_take(lv_area_t out[DIRTY_RECT_MAX]) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < s_focus_count; i++) {
+    out[n++] = s_focus_rects[i];
+  }
+  for (uint8_t i = 0; i < s_dirty_count; i++) {
+    n = rects_append(out, n, &s_dirty_rects[i]);
+  }
+  dirty_clear();
+  return n;
+}
+
+// 物理行哈希（FNV-1a，按 32 位字，行起始地址 4 字节对齐）
+static uint32_t fb_row_hash(const uint8_t *row) {
+  const uint32_t *w = (const uint32_t *)row;
+  uint32_t h = 2166136261u;
+  for (uint32_t i = 0; i < (EPD_WIDTH / 8) / 4; i++) {
+    h = (h ^ w[i]) * 16777619u;
+  }
+  return h;
+}
+
+// 查找 [0,n) 内首个和末个不同的字节，a/b 需具有相同的 4 字节对齐
+// 中间部分按字比较；完全相同时返回 false
+static bool fb_row_diff_span(const uint8_t *a, const uint8_t *b, uint32_t n,
+                             uint32_t *first, uint32_t *last) {
+  uint32_t i = 0;
+  while (i < n && ((uintptr_t)(a + i) & 3) != 0 && a[i] == b[i]) {
+    i++;
+  }
+  if (i < n && ((uintptr_t)(a + i) & 3) == 0) {
+    while (i + 4 <= n &&
+           *(const uint32_t *)(a + i) == *(const uint32_t *)(b + i)) {
+      i += 4;
+    }
+    while (i < n && a[i] == b[i]) {
+      i++;
+    }
+  }
+  if (i >= n) {
+    return false;
+  }
+
+  uint32_t j = n;
+  while (j > i && ((uintptr_t)(a + j) & 3) != 0 && a[j - 1] == b[j - 1]) {
+    j--;
+  }
+  if (j > i && ((uintptr_t)(a + j) & 3) == 0) {
+    while (j >= i + 4 &&
+           *(const uint32_t *)(a + j - 4) == *(const uint32_t *)(b + j - 4)) {
+      j -= 4;
+    }
+    while (j > i && a[j - 1] == b[j - 1]) {
+      j--;
+    }
+  }
+
+  *first = i;
+  *last = j - 1;
+  return true;
+}
+
+// 用影子帧把脏矩形收紧到真正变化的部分；返回 false 表示矩形内没有变化
+static bool frame_diff_refine(const uint8_t *fb, lv_area_t *rect) {
+  if (s_frame_diff == EPD_FRAME_DIFF_OFF || !s_frame_diff_valid) {
+    return true;
+  }
+  const uint32_t stride = EPD_WIDTH / 8;
+
+  if (s_fb_shadow != NULL) {
+    const uint32_t bx1 = (uint32_t)rect->x1 >> 3;
+    const uint32_t nbytes = ((uint32_t)rect->x2 >> 3) - bx1 + 1;
+    int32_t y1 = -1, y2 = -1;
+    uint32_t b_min = UINT32_MAX, b_max = 0;
+    for (int32_t y = rect->y1; y <= rect->y2; y++) {
+      const uint32_t off = (uint32_t)y * stride + bx1;
+      uint32_t f = 0, l = 0;
+      if (!fb_row_diff_span(fb + off, s_fb_shadow + off, nbytes, &f, &l)) {
+        continue;
+      }
+      if (y1 < 0) {
+        y1 = y;
+      }
+      y2 = y;
+      if (f < b_min) b_min = f;
+      if (l > b_max) b_max = l;
+    }
+    if (y1 < 0) {
+      return false;
+    }
+    rect->x1 = (int32_t)((bx1 + b_min) * 8);
+    rect->x2 = (int32_t)((bx1 + b_max) * 8 + 7);
+    rect->y1 = y1;
+    rect->y2 = y2;
+    return true;
+  }
+
+  // 行哈希：只能去掉首尾未变化的行
+  int32_t y1 = rect->y1, y2 = rect->y2;
+  while (y1 <= y2 && fb_row_hash(fb + (uint32_t)y1 * stride) == s_row_hash[y1]) {
+    y1++;
+  }
+  while (y2 >= y1 && fb_row_hash(fb + (uint32_t)y2 * stride) == s_row_hash[y2]) {
+    y2--;
+  }
+  if (y1 > y2) {
+    return false;
+  }
+  rect->y1 = y1;
+  rect->y2 = y2;
+  return true;
+}
 
-    ESP_LOGI(TAG, "[DIRTY] init: (%d,%d)-(%d,%d)", (int)init_area.x1,
-             (int)init_area.y1, (int)init_area.x2, (int)init_area.y2);
+// 上传后同步影子帧；rects 为 NULL 表示整帧已上传
+static void frame_diff_commit(const uint8_t *fb, const lv_area_t *rects,
+                              uint8_t count) {
+  if (s_frame_diff == EPD_FRAME_DIFF_OFF) {
     return;
   }
+  const uint32_t stride = EPD_WIDTH / 8;
 
-  old_area = s_dirty_area;
+  if (rects == NULL) {
+    if (s_fb_shadow != NULL) {
+      memcpy(s_fb_shadow, fb, sizeof(s_epd_framebuffer));
+    } else {
+      for (uint32_t y = 0; y < EPD_HEIGHT; y++) {
+        s_row_hash[y] = fb_row_hash(fb + y * stride);
+      }
+    }
+    s_frame_diff_valid = true;
+    return;
+  }
 
-  // 计算新旧区域之间的距离（基于 old_area）
-  y_gap = (area->y1 > old_area.y2)
-              ? (area->y1 - old_area.y2 - 1)
-              : ((old_area.y1 > area->y2) ? (old_area.y1 - area->y2 - 1) : 0);
+  if (!s_frame_diff_valid) {
+    return;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    const uint32_t bx1 = (uint32_t)rects[i].x1 >> 3;
+    const uint32_t nbytes = ((uint32_t)rects[i].x2 >> 3) - bx1 + 1;
+    for (int32_t y = rects[i].y1; y <= rects[i].y2; y++) {
+      if (s_fb_shadow != NULL) {
+        const uint32_t off = (uint32_t)y * stride + bx1;
+        memcpy(s_fb_shadow + off, fb + off, nbytes);
+      } else {
+        s_row_hash[y] = fb_row_hash(fb + (uint32_t)y * stride);
+      }
+    }
+  }
+}
 
-  // 总是扩展脏区到包含所有已刷新区域的包围盒
-  if (area->x1 < s_dirty_area.x1)
-    s_dirty_area.x1 = area->x1;
-  if (area->y1 < s_dirty_area.y1)
-    s_dirty_area.y1 = area->y1;
-  if (area->x2 > s_dirty_area.x2)
-    s_dirty_area.x2 = area->x2;
-  if (area->y2 > s_dirty_area.y2)
-    s_dirty_area.y2 = area->y2;
+// 整屏刷新后清零鬼影债务
+static void ghost_reset(void) {
+  memset(s_ghost_debt, 0, sizeof(s_ghost_debt));
+  s_ghost_max = 0;
+  s_ghost_cleanup_pending = false;
+  s_partial_refresh_count = 0;
+}
 
-  new_area = s_dirty_area;
-  if (old_area.x1 != new_area.x1 || old_area.y1 != new_area.y1 ||
-      old_area.x2 != new_area.x2 || old_area.y2 != new_area.y2) {
-    do_expand_log = true;
+// 温度越低粒子迁移越慢，残影累积越快；常温阈值与原先 10 次局刷后全刷一致
+static uint32_t ghost_threshold(void) {
+  const TickType_t now = xTaskGetTickCount();
+  if (!s_ghost_temp_valid ||
+      (now - s_ghost_temp_tick) > pdMS_TO_TICKS(GHOST_TEMP_INTERVAL_MS)) {
+    const int t = EPD_4in26_ReadTemperature();
+    if (t != EPD_4in26_TEMP_INVALID) {
+      s_ghost_temp_c = t;
+      s_ghost_temp_valid = true;
+      ESP_LOGI(TAG, "Ghost scheduler: panel temperature %d C", t);
+    }
+    s_ghost_temp_tick = now;
   }
 
-  portEXIT_CRITICAL(&s_dirty_mux);
+  if (s_ghost_temp_c < 5) {
+    return 3 * GHOST_DEBT_PER_CELL;
+  }
+  if (s_ghost_temp_c < 15) {
+    return 6 * GHOST_DEBT_PER_CELL;
+  }
+  return 10 * GHOST_DEBT_PER_CELL;
+}
 
-  if (do_expand_log) {
-    ESP_LOGI(TAG,
-             "[DIRTY] expanded: (%d,%d)-(%d,%d) -> (%d,%d)-(%d,%d), y_gap=%d",
-             (int)area->x1, (int)area->y1, (int)area->x2, (int)area->y2,
-             (int)new_area.x1, (int)new_area.y1, (int)new_area.x2,
-             (int)new_area.y2, (int)y_gap);
+// 记录一次局刷窗口的债务；需在 frame_diff_commit 之前调用（影子帧仍是旧内容）
+static void ghost_account(const uint8_t *fb, const lv_area_t *rect) {
+  const uint32_t cell_px = GHOST_CELL_PX * GHOST_CELL_PX;
+  const uint32_t stride = EPD_WIDTH / 8;
+  uint32_t flips[GHOST_ROWS][GHOST_COLS];
+  const bool count_flips = (s_fb_shadow != NULL) && s_frame_diff_valid;
+
+  if (count_flips) {
+    memset(flips, 0, sizeof(flips));
+    for (int32_t y = rect->y1; y <= rect->y2; y++) {
+      const uint32_t row_off = (uint32_t)y * stride;
+      for (int32_t bx = rect->x1 >> 3; bx <= (rect->x2 >> 3); bx++) {
+        const uint8_t diff = fb[row_off + bx] ^ s_fb_shadow[row_off + bx];
+        flips[y / GHOST_CELL_PX][(bx * 8) / GHOST_CELL_PX] += __builtin_popcount(diff);
+      }
+    }
+  }
+
+  for (int32_t r = rect->y1 / GHOST_CELL_PX; r <= rect->y2 / GHOST_CELL_PX; r++) {
+    for (int32_t c = rect->x1 / GHOST_CELL_PX; c <= rect->x2 / GHOST_CELL_PX; c++) {
+      const lv_area_t cell = {
+          .x1 = c * GHOST_CELL_PX, .y1 = r * GHOST_CELL_PX,
+          .x2 = (c + 1) * GHOST_CELL_PX - 1, .y2 = (r + 1) * GHOST_CELL_PX - 1,
+      };
+      lv_area_t overlap;
+      if (!lv_area_intersect(&overlap, &cell, rect)) {
+        continue;
+      }
+      uint32_t weight = lv_area_get_size(&overlap);
+      if (count_flips) {
+        weight += GHOST_FLIP_WEIGHT * flips[r][c];
+      }
+      uint32_t debt = s_ghost_debt[r][c] + (weight * GHOST_DEBT_PER_CELL) / cell_px;
+      if (debt > UINT16_MAX) {
+        debt = UINT16_MAX;
+      }
+      s_ghost_debt[r][c] = (uint16_t)debt;
+      if (debt > s_ghost_max) {
+        s_ghost_max = debt;
+      }
+    }
+  }
+}
+
+// 提交刷新请求：与信箱中未处理的请求合并，然后唤醒刷新任务
+static bool refresh_request_submit(epd_refresh_mode_t mode, uint32_t deadline_ms,
+                                   SemaphoreHandle_t done_sem) {
+  if (s_mailbox_lock == NULL || s_epd_refresh_task_handle == NULL) {
+    ESP_LOGW(TAG, "Refresh mailbox not initialized");
+    return false;
+  }
+
+  const TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(deadline_ms);
+  bool merged;
+  bool waiter_ok = true;
+
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  merged = s_mailbox.pending;
+  if (!s_mailbox.pending) {
+    s_mailbox.pending = true;
+    s_mailbox.mode = mode;
+    s_mailbox.deadline = deadline;
+  } else {
+    if (mode > s_mailbox.mode) {
+      s_mailbox.mode = mode;
+    }
+    if ((int32_t)(deadline - s_mailbox.deadline) < 0) {
+      s_mailbox.deadline = deadline;
+    }
+  }
+  if (done_sem != NULL) {
+    if (s_mailbox.waiter_count < REFRESH_MAX_WAITERS) {
+      s_mailbox.waiters[s_mailbox.waiter_count++] = done_sem;
+    } else {
+      waiter_ok = false;
+    }
+  }
+  const epd_refresh_mode_t queued_mode = s_mailbox.mode;
+  xSemaphoreGive(s_mailbox_lock);
+
+  xTaskNotifyGive(s_epd_refresh_task_handle);
+
+  if (!waiter_ok) {
+    ESP_LOGW(TAG, "refresh_request_submit: too many waiters, completion not tracked");
+  }
+  TRACE_EVENT(TRACE_EV_REFRESH_REQ, mode, queued_mode);
+  TRACE_LOGI(LVGL, TAG, "refresh_request_submit: mode=%d -> %d%s", mode, queued_mode,
+           merged ? " (merged)" : "");
+  return waiter_ok;
+}
+
+// 注销等待者（同步等待超时时调用），避免任务 give 已失效的信号量
+static void refresh_request_cancel_waiter(SemaphoreHandle_t sem) {
+  refresh_request_t *slots[] = {&s_mailbox, &s_inflight};
+
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  for (size_t k = 0; k < sizeof(slots) / sizeof(slots[0]); k++) {
+    refresh_request_t *r = slots[k];
+    for (uint8_t i = 0; i < r->waiter_count; i++) {
+      if (r->waiters[i] == sem) {
+        r->waiters[i] = r->waiters[--r->waiter_count];
+        break;
+      }
+    }
+  }
+  xSemaphoreGive(s_mailbox_lock);
+}
+
+// 刷新任务：等待并取出到期的请求；timeout 内没有请求返回 false
+// deadline 未到时继续等待，期间到达的请求会合并进来（也可能提前 deadline）
+// 扣住期间请求留在信箱里继续合并，视同没有请求
+static bool refresh_request_wait(refresh_request_t *req, TickType_t timeout) {
+  const TickType_t start = xTaskGetTickCount();
+
+  while (1) {
+    const TickType_t now = xTaskGetTickCount();
+    TickType_t wait;
+
+    xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+    if (s_mailbox.pending && !s_redraw_hold) {
+      const int32_t remain = (int32_t)(s_mailbox.deadline - now);
+      if (remain <= 0) {
+        s_inflight = s_mailbox;
+        *req = s_mailbox;
+        memset(&s_mailbox, 0, sizeof(s_mailbox));
+        xSemaphoreGive(s_mailbox_lock);
+        return true;
+      }
+      wait = (TickType_t)remain;
+    } else if (s_panel_wake_requested) {
+      xSemaphoreGive(s_mailbox_lock);
+      return false;
+    } else if (timeout == portMAX_DELAY) {
+      wait = portMAX_DELAY;
+    } else {
+      const TickType_t elapsed = now - start;
+      if (elapsed >= timeout) {
+        xSemaphoreGive(s_mailbox_lock);
+        return false;
+      }
+      wait = timeout - elapsed;
+    }
+    xSemaphoreGive(s_mailbox_lock);
+
+    ulTaskNotifyTake(pdTRUE, wait);
+  }
+}
+
+// 刷新任务：当前请求执行完毕，通知等待者
+// 有等待者时先等面板波形结束，保证"显示已是最新"
+static void refresh_request_complete(void) {
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  const bool has_waiters = s_inflight.waiter_count > 0;
+  xSemaphoreGive(s_mailbox_lock);
+
+  if (has_waiters) {
+    EPD_4in26_WaitIdle();
+  }
+
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < s_inflight.waiter_count; i++) {
+    xSemaphoreGive(s_inflight.waiters[i]);
+  }
+  memset(&s_inflight, 0, sizeof(s_inflight));
+  xSemaphoreGive(s_mailbox_lock);
+}
+
+// 刷新任务：请求未能执行（framebuffer 被占用），并回信箱稍后重试
+static void refresh_request_requeue(const refresh_request_t *req) {
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  const TickType_t retry = xTaskGetTickCount() + pdMS_TO_TICKS(50);
+  if (!s_mailbox.pending) {
+    s_mailbox.pending = true;
+    s_mailbox.mode = req->mode;
+    s_mailbox.deadline = retry;
+  } else if (req->mode > s_mailbox.mode) {
+    s_mailbox.mode = req->mode;
+  }
+  // 等待者以 s_inflight 为准（可能已有等待者超时注销）
+  for (uint8_t i = 0; i < s_inflight.waiter_count &&
+                      s_mailbox.waiter_count < REFRESH_MAX_WAITERS; i++) {
+    s_mailbox.waiters[s_mailbox.waiter_count++] = s_inflight.waiters[i];
+  }
+  memset(&s_inflight, 0, sizeof(s_inflight));
+  xSemaphoreGive(s_mailbox_lock);
+}
+
+// 上传取代检查（EPD 驱动在行突发之间调用，刷新任务）：本次上传开始后 LVGL 又渲染完
+// 一帧，且刷新请求已在信箱中等待，正在上传的中间帧就不必再显示。
+// 只有乒乓模式会成立：单缓冲时 LVGL 要等上传结束才能开始下一帧
+static bool upload_superseded(void *arg) {
+  (void)arg;
+  if (s_frames_rendered == s_upload_frame) {
+    return false;
   }
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  const bool pending = s_mailbox.pending;
+  xSemaphoreGive(s_mailbox_lock);
+  return pending;
 }
 
 static void queue_refresh_request(epd_refresh_mode_t mode) {
-  if (s_refresh_queue == NULL) {
-    ESP_LOGW(TAG, "Refresh queue not initialized");
+  (void)refresh_request_submit(mode, 0, NULL);
+}
+
+// 丢弃帧（LVGL 任务）：扣住信箱，刷新任务不会在重绘前取走请求、上传旧的后台内容
+static void refresh_redraw_hold(void) {
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  s_redraw_hold = true;
+  xSemaphoreGive(s_mailbox_lock);
+}
+
+// 重绘的最后一块已写入（LVGL 任务）：放行扣住的请求。丢帧前后刷新任务可能已经
+// 取走请求（上传的是旧内容），所以总是再提交一次，与仍在信箱中的请求合并
+static void refresh_redraw_release(void) {
+  xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+  s_redraw_hold = false;
+  xSemaphoreGive(s_mailbox_lock);
+  queue_refresh_request(s_refresh_mode);
+}
+
+// 8x8 位矩阵转置（Hacker's Delight transpose8，32 位移位实现，适合 RV32）
+// in[j] 的第 (7-i) 位 -> out[i] 的第 (7-j) 位（MSB 为第 0 列）
+static inline void transpose8x8(const uint8_t in[8], uint8_t out[8]) {
+  uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) |
+               ((uint32_t)in[2] << 8) | in[3];
+  uint32_t y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) |
+               ((uint32_t)in[6] << 8) | in[7];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  out[0] = (uint8_t)(x >> 24); out[1] = (uint8_t)(x >> 16);
+  out[2] = (uint8_t)(x >> 8);  out[3] = (uint8_t)x;
+  out[4] = (uint8_t)(y >> 24); out[5] = (uint8_t)(y >> 16);
+  out[6] = (uint8_t)(y >> 8);  out[7] = (uint8_t)y;
+}
+
+// 将 LVGL I1 区域按 ROTATE_270 写入 EPD framebuffer
+// 逻辑 (x,y) -> 物理 (memX=y, memY=EPD_HEIGHT-1-x)：源数据同一字节列上的
+// 8 行（按绝对 y 8 对齐）转置后正好是 8 个物理行上的同一个目标字节。
+// src/src_x1/src_y1 描述 LVGL 缓冲区，clip 为实际写入范围（已裁剪到屏幕内）；
+// 上下边缘不足 8 行时按行掩码合并，左右边缘按源字节内的起止位处理
+static void blit_rotate270(const uint8_t *src, uint32_t stride, int32_t src_x1,
+                           int32_t src_y1, const lv_area_t *clip, uint8_t *fb) {
+  const uint32_t dst_stride = EPD_WIDTH / 8;
+
+  for (int32_t yg = clip->y1 & ~7; yg <= clip->y2; yg += 8) {
+    const uint8_t *rows[8];
+    uint8_t rows_mask = 0;
+    for (int j = 0; j < 8; j++) {
+      const int32_t y = yg + j;
+      if (y < clip->y1 || y > clip->y2) {
+        rows[j] = NULL;
+        continue;
+      }
+      rows[j] = src + (uint32_t)(y - src_y1) * stride;
+      rows_mask |= (uint8_t)(0x80 >> j);
+    }
+
+    uint8_t *dst_col = fb + (yg >> 3);
+    int32_t x = clip->x1;
+    while (x <= clip->x2) {
+      const int32_t bx = (x - src_x1) >> 3;
+      const int32_t bit_start = (x - src_x1) & 7;
+      int32_t bit_end = 7;
+      if (x + (7 - bit_start) > clip->x2) {
+        bit_end = bit_start + (clip->x2 - x);
+      }
+
+      uint8_t in[8], out[8];
+      for (int j = 0; j < 8; j++) {
+        in[j] = rows[j] ? rows[j][bx] : 0;
+      }
+      transpose8x8(in, out);
+
+      const int32_t x_base = src_x1 + bx * 8;
+      for (int32_t i = bit_start; i <= bit_end; i++) {
+        uint8_t *d = dst_col + (uint32_t)(EPD_HEIGHT - 1 - (x_base + i)) * dst_stride;
+        if (rows_mask == 0xFF) {
+          *d = out[i];
+        } else {
+          *d = (uint8_t)((*d & ~rows_mask) | (out[i] & rows_mask));
+        }
+      }
+      x += bit_end - bit_start + 1;
+    }
+  }
+}
+
+// 原生方向：逻辑坐标即物理坐标，按行拷贝
+// rounder 回调保证 x1/x2+1 为 8 的倍数，整行字节对齐；
+// 直接调用时若未对齐，首尾字节按位掩码合并
+static void blit_native(const uint8_t *src, uint32_t stride, int32_t src_x1,
+                        int32_t src_y1, const lv_area_t *clip, uint8_t *fb) {
+  const uint32_t dst_stride = EPD_WIDTH / 8;
+  const bool aligned = ((clip->x1 & 7) == 0) && (((clip->x2 + 1) & 7) == 0) &&
+                       (((clip->x1 - src_x1) & 7) == 0);
+
+  for (int32_t y = clip->y1; y <= clip->y2; y++) {
+    const uint8_t *s_row = src + (uint32_t)(y - src_y1) * stride;
+    uint8_t *d_row = fb + (uint32_t)y * dst_stride;
+    if (aligned) {
+      memcpy(d_row + (clip->x1 >> 3), s_row + ((clip->x1 - src_x1) >> 3),
+             (size_t)((clip->x2 - clip->x1 + 1) >> 3));
+      continue;
+    }
+    for (int32_t x = clip->x1; x <= clip->x2; x++) {
+      const int32_t bx = x - src_x1;
+      const uint8_t bit = (uint8_t)(0x80 >> (x & 7));
+      if ((s_row[bx >> 3] >> (7 - (bx & 7))) & 1) {
+        d_row[x >> 3] |= bit;
+      } else {
+        d_row[x >> 3] &= (uint8_t)~bit;
+      }
+    }
+  }
+}
+
+// 原生方向：将无效区域 X 方向扩展到字节边界，使 flush_cb 走整字节 memcpy 路径
+static void disp_rounder_cb(lv_event_t *e) {
+  if (!s_native) {
     return;
   }
+  lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+  area->x1 &= ~7;
+  area->x2 |= 7;
+}
 
-  refresh_request_t req = {
-      .mode = mode,
-  };
+// 灰阶模式：L8 亮度量化为 2 bit 后写入两个位平面（逐像素，带旋转映射）
+static void blit_gray(const uint8_t *src, uint32_t stride, int32_t src_x1,
+                      int32_t src_y1, const lv_area_t *clip, uint8_t *lo,
+                      uint8_t *hi) {
+  const uint32_t dst_stride = EPD_WIDTH / 8;
+
+  for (int32_t y = clip->y1; y <= clip->y2; y++) {
+    const uint8_t *s_row = src + (uint32_t)(y - src_y1) * stride;
+    for (int32_t x = clip->x1; x <= clip->x2; x++) {
+      const uint8_t g = (uint8_t)(s_row[x - src_x1] >> 6);
+      // ROTATE_270: LVGL(x,y) -> EPD(memX=y, memY=EPD_HEIGHT-1-x)
+      const int32_t mx = s_native ? x : y;
+      const int32_t my = s_native ? y : EPD_HEIGHT - 1 - x;
+      const uint32_t idx = (uint32_t)my * dst_stride + (uint32_t)(mx >> 3);
+      const uint8_t bit = (uint8_t)(0x80 >> (mx & 7));
+      lo[idx] = (g & 1) ? (uint8_t)(lo[idx] & ~bit) : (uint8_t)(lo[idx] | bit);
+      hi[idx] = (g & 2) ? (uint8_t)(hi[idx] & ~bit) : (uint8_t)(hi[idx] | bit);
+    }
+  }
+}
 
-  // 检查队列中是否已有未处理的请求
-  // 如果有 FULL 请求在排队，新的 FULL 请求不需要重复入队
-  // 如果有 FAST/PARTIAL 请求在排队，新的 FULL 请求应该覆盖
-  refresh_request_t queued;
-  BaseType_t has_queued = xQueuePeek(s_refresh_queue, &queued, 0);
+// 静态图层是否参与合成（灰阶模式下 framebuffer 是位平面，不合成）
+static inline bool layer_active(void) {
+  return s_layer.bits != NULL && s_layer.enabled && !s_gray_mode;
+}
 
-  if (has_queued == pdTRUE) {
-    // 如果队列中已有 FULL 请求，且新请求不是 FULL，直接忽略
-    if (queued.mode == EPD_REFRESH_FULL && mode != EPD_REFRESH_FULL) {
-      ESP_LOGI(TAG, "queue_refresh_request: skip %d, FULL already queued", mode);
-      return;
+// 把图层按字合成到 fb 中 phys（物理坐标，已与图层求交）覆盖的字：
+// fb = (fb & ~mask) | (bits & mask)，掩码外的像素保持不变
+static void layer_composite(uint8_t *fb, const lv_area_t *phys) {
+  const uint32_t fb_words = EPD_WIDTH / 32;
+  const uint32_t w1 = (uint32_t)(phys->x1 - s_layer.phys.x1) >> 5;
+  const uint32_t w2 = (uint32_t)(phys->x2 - s_layer.phys.x1) >> 5;
+  for (int32_t y = phys->y1; y <= phys->y2; y++) {
+    const uint32_t li = (uint32_t)(y - s_layer.phys.y1) * s_layer.words;
+    uint32_t *d = (uint32_t *)fb + (uint32_t)y * fb_words + ((uint32_t)s_layer.phys.x1 >> 5);
+    for (uint32_t w = w1; w <= w2; w++) {
+      const uint32_t m = s_layer.mask[li + w];
+      d[w] = (d[w] & ~m) | (s_layer.bits[li + w] & m);
     }
-    // 如果新请求是 FULL，但已有 PARTIAL/FAST 在排队，直接发送 FULL
-    // 不要用覆盖，而是等待当前请求处理完后由调用方发送新的 FULL
-    // 这里我们选择入队让任务处理
   }
+}
+
+// flush 写完 clip（逻辑坐标）之后：图层生效时把相交部分合成回去，
+// 暂停或灰阶模式下只记下图层被覆盖，恢复后整块写回
+static void layer_apply(uint8_t *fb, const lv_area_t *clip) {
+  lv_area_t phys;
+  lv_area_t overlap;
+  if (s_layer.bits == NULL || !area_to_physical(clip, &phys) ||
+      !lv_area_intersect(&overlap, &phys, &s_layer.phys)) {
+    return;
+  }
+  if (!layer_active()) {
+    s_layer.restore = true;
+    return;
+  }
+  layer_composite(fb, &overlap);
+}
+
+// 从 area（逻辑坐标）中裁掉不透明图层盖住的部分：剩余部分是矩形时原地缩小，
+// 图层落在 area 中间或角上时保持原样。area 完全被盖住时返回 false
+static bool layer_clip_area(lv_area_t *area) {
+  const lv_area_t *l = &s_layer.area;
+  if (l->x1 > area->x2 || l->x2 < area->x1 || l->y1 > area->y2 || l->y2 < area->y1) {
+    return true;
+  }
+  const bool full_w = l->x1 <= area->x1 && l->x2 >= area->x2;
+  const bool full_h = l->y1 <= area->y1 && l->y2 >= area->y2;
+  if (full_w && full_h) {
+    return false;
+  }
+  if (full_w && l->y1 <= area->y1) {
+    area->y1 = l->y2 + 1;
+  } else if (full_w && l->y2 >= area->y2) {
+    area->y2 = l->y1 - 1;
+  } else if (full_h && l->x1 <= area->x1) {
+    area->x1 = l->x2 + 1;
+  } else if (full_h && l->x2 >= area->x2) {
+    area->x2 = l->x1 - 1;
+  }
+  return true;
+}
+
+// 失效区域避开不透明图层，图层像素不再渲染。完全落在图层内的区域无法从
+// 事件中撤销，照常渲染，flush 时由合成恢复为图层内容、也不计入脏区
+static void layer_invalidate_cb(lv_event_t *e) {
+  if (!layer_active() || !s_layer.opaque) {
+    return;
+  }
+  lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+  lv_area_t clipped = *area;
+  if (layer_clip_area(&clipped)) {
+    *area = clipped;
+  }
+}
 
-  // 如果队列已满（实际上单槽队列不会满，会覆盖）
-  // 使用 xQueueSend 替代 xQueueOverwrite，确保不丢失
-  // 但单槽队列只能存一个，所以使用 xQueueOverwrite
-  (void)xQueueOverwrite(s_refresh_queue, &req);
-  ESP_LOGI(TAG, "queue_refresh_request: mode=%d queued", mode);
+// 最后一块 flush 结束本帧；整屏重绘已发出（s_frame_redraw 已清除）时这一帧就是重绘，
+// 放行扣住的刷新请求。s_redraw_hold 只有 LVGL 任务修改，这里无锁读取是安全的
+static void flush_frame_end(void) {
+  frame_render_end();
+  if (s_redraw_hold && !s_frame_redraw) {
+    refresh_redraw_release();
+  }
 }
 
 // LVGL 9.x 显示flush回调 - DIRECT 模式
@@ -203,22 +1165,48 @@ static void queue_refresh_request(epd_refresh_mode_t mode) {
 // 这里只需要将 RGB565 格式转换为 1bpp EPD 格式并写入 s_epd_framebuffer
 static void disp_flush_cb(lv_display_t *disp, const lv_area_t *area,
                           uint8_t *px_map) {
+  // 捕获模式写入调用方缓冲区，刷新任务不会读取它，无需流水线与互斥锁
+  const bool capture = s_capture_fb != NULL;
+  uint8_t *const dst = capture ? s_capture_fb : s_fb_back;
+
+  // 本帧已丢弃：其余各块不再等待上传，也不写入
+  if (!capture && s_frame_dropped) {
+    if (lv_display_flush_is_last(disp)) {
+      s_frame_dropped = false;
+    }
+    lv_display_flush_ready(disp);
+    return;
+  }
+
+  // 新的一帧：等待刷新任务结束对后台 framebuffer 的上传（RENDERING）
+  // 只有 LVGL 任务会进入/离开 RENDERING，这里无锁读取是安全的。
+  // 超时时上传仍在进行、状态不归本帧，不调用 frame_render_end；整帧丢弃，
+  // 渲染结束后整屏重绘补上本帧的内容。重绘写完前扣住刷新请求，写完后再提交一次
+  if (!capture && s_frame_state != FRAME_RENDERING && !frame_render_begin()) {
+    ESP_LOGW(TAG, "disp_flush_cb: timed out waiting for EPD upload, dropping frame");
+    s_frame_dropped = !lv_display_flush_is_last(disp);
+    s_frame_redraw = true;
+    refresh_redraw_hold();
+    lv_display_flush_ready(disp);
+    return;
+  }
+
   // 获取互斥锁，保护 framebuffer 访问
-  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+  if (!capture && xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(50)) != pdTRUE) {
     ESP_LOGW(TAG, "disp_flush_cb: failed to acquire mutex, skipping write");
+    if (lv_display_flush_is_last(disp)) {
+      flush_frame_end();
+    }
     lv_display_flush_ready(disp);
     return;
   }
 
-  // 标记渲染未完成（用于刷新任务判断）
-  s_render_done = false;
+  const int64_t flush_start_us = esp_timer_get_time();
 
   // 记录每次 flush 调用
   static uint32_t flush_count = 0;
   flush_count++;
 
-  int32_t x, y;
-
   // 获取显示颜色格式
   lv_color_format_t cf = lv_display_get_color_format(disp);
 
@@ -236,94 +1224,132 @@ static void disp_flush_cb(lv_display_t *disp, const lv_area_t *area,
   if (flush_count <= 20) {
     int32_t w = area->x2 - area->x1 + 1;
     int32_t h = area->y2 - area->y1 + 1;
-    ESP_LOGI(TAG, "disp_flush_cb #%u: area(%d,%d)-(%d,%d) size=%dx%d, cf=%d",
+    TRACE_LOGI(LVGL, TAG, "disp_flush_cb #%u: area(%d,%d)-(%d,%d) size=%dx%d, cf=%d",
              flush_count, (int)area->x1, (int)area->y1, (int)area->x2, (int)area->y2,
              (int)w, (int)h, (int)cf);
   }
 
   // PARTIAL 模式 + 1bpp：LVGL 使用 I1 格式渲染到小缓冲区
   // flush_cb 需要应用 ROTATE_270 坐标映射并写入 s_epd_framebuffer
+  // 灰阶模式下为 L8（每像素 1 字节，无调色板）
   // 检查颜色格式
-  if (cf != LV_COLOR_FORMAT_I1) {
-    ESP_LOGE(TAG, "Unexpected color format: %d (expected I1)", (int)cf);
-    xSemaphoreGive(s_epd_mutex);
+  const lv_color_format_t expect_cf = s_gray_mode ? LV_COLOR_FORMAT_L8 : LV_COLOR_FORMAT_I1;
+  if (cf != expect_cf) {
+    ESP_LOGE(TAG, "Unexpected color format: %d (expected %d)", (int)cf, (int)expect_cf);
+    if (!capture) {
+      xSemaphoreGive(s_epd_mutex);
+      if (lv_display_flush_is_last(disp)) {
+        flush_frame_end();
+      }
+    }
     lv_display_flush_ready(disp);
     return;
   }
 
   uint32_t pixel_count = 0;
 
-  // LVGL 9.x I1 格式：前 8 字节为调色板，必须跳过
-  // stride 对齐到 4 字节边界
-  px_map += 8;  // 跳过调色板头部
-
   const int32_t buf_w = lv_area_get_width(area);
-  const int32_t buf_h = lv_area_get_height(area);
 
-  // LVGL I1 格式的 stride：每行字节数，对齐到 4 字节
-  const uint32_t stride = LV_DRAW_BUF_ALIGN_BYTES(((buf_w + 7) / 8));
+  // 源数据原点：分带模式为区域左上角，DIRECT 模式为整帧缓冲区左上角
+  int32_t src_x1 = area->x1;
+  int32_t src_y1 = area->y1;
+  uint32_t stride;
+  uint32_t buf_size = s_draw_buf_size;
+  if (s_gray_mode) {
+    stride = LV_DRAW_BUF_ALIGN_BYTES((uint32_t)buf_w);
+  } else if (s_direct_render) {
+    px_map += 8;  // 跳过调色板头部
+    buf_size -= 8;
+    stride = DISP_I1_STRIDE;
+    src_x1 = 0;
+    src_y1 = 0;
+  } else {
+    // LVGL 9.x I1 格式：前 8 字节为调色板，必须跳过
+    // stride 对齐到 4 字节边界
+    px_map += 8;  // 跳过调色板头部
+    buf_size -= 8;
+
+    // LVGL I1 格式的 stride：每行字节数，对齐到 4 字节
+    stride = LV_DRAW_BUF_ALIGN_BYTES(((buf_w + 7) / 8));
+  }
   
   if (flush_count <= 5) {
-    ESP_LOGI(TAG, "flush_cb: area_w=%d, stride=%u bytes (px_map already +8 for palette)", 
+    TRACE_LOGI(LVGL, TAG, "flush_cb: area_w=%d, stride=%u bytes (px_map already +8 for palette)", 
              (int)buf_w, (unsigned)stride);
   }
   
-  for (y = area->y1; y <= area->y2; y++) {
-    for (x = area->x1; x <= area->x2; x++) {
-      // PARTIAL 模式：使用相对坐标读取 LVGL 缓冲区
-      const int32_t buf_x = x - area->x1;
-      const int32_t buf_y = y - area->y1;
-      const uint32_t src_byte_idx = buf_y * stride + (buf_x / 8);
-      const uint8_t src_bit_idx = 7 - (buf_x % 8);
-      
-      if (src_byte_idx >= sizeof(s_lvgl_draw_buffer)) {
-        if (flush_count <= 2) {
-          ESP_LOGW(TAG, "Buffer overflow: idx=%u, size=%u", 
-                   src_byte_idx, sizeof(s_lvgl_draw_buffer));
-        }
-        continue;
-      }
-      
-      const bool pixel = (px_map[src_byte_idx] >> src_bit_idx) & 1;
-
-      // 写入 EPD buffer（物理坐标，应用 ROTATE_270）
-      const int32_t memX = y;
-      const int32_t memY = EPD_HEIGHT - 1 - x;
-      const uint32_t dst_byte_idx = memY * (EPD_WIDTH / 8) + (memX / 8);
-      const uint8_t dst_bit_idx = 7 - (memX % 8);
-
-      if (dst_byte_idx < sizeof(s_epd_framebuffer)) {
-        if (pixel == 0) {  // 黑色
-          s_epd_framebuffer[dst_byte_idx] &= ~(1 << dst_bit_idx);
-        } else {  // 白色
-          s_epd_framebuffer[dst_byte_idx] |= (1 << dst_bit_idx);
-        }
-        pixel_count++;
+  // 源缓冲区容量检查（一次性完成，替代逐像素检查）
+  const uint32_t row_bytes = s_gray_mode ? (uint32_t)(area->x2 - src_x1 + 1)
+                                         : (uint32_t)((area->x2 - src_x1) / 8 + 1);
+  const uint32_t src_needed = (uint32_t)(area->y2 - src_y1) * stride + row_bytes;
+  if (src_needed > buf_size) {
+    ESP_LOGW(TAG, "Buffer overflow: need=%u, size=%u", (unsigned)src_needed,
+             (unsigned)buf_size);
+  } else {
+    // 裁剪到逻辑屏幕范围，越界部分直接丢弃
+    lv_area_t clip = *area;
+    if (clip.x1 < 0) clip.x1 = 0;
+    if (clip.y1 < 0) clip.y1 = 0;
+    if (clip.x2 > DISP_HOR_RES - 1) clip.x2 = DISP_HOR_RES - 1;
+    if (clip.y2 > DISP_VER_RES - 1) clip.y2 = DISP_VER_RES - 1;
+
+    if (clip.x1 <= clip.x2 && clip.y1 <= clip.y2 && s_gray_mode) {
+      blit_gray(px_map, stride, src_x1, src_y1, &clip, s_fb_back, s_fb_gray_hi);
+      layer_apply(s_fb_back, &clip);
+      pixel_count = (uint32_t)lv_area_get_width(&clip) * (uint32_t)lv_area_get_height(&clip);
+    } else if (clip.x1 <= clip.x2 && clip.y1 <= clip.y2) {
+      if (s_native) {
+        blit_native(px_map, stride, src_x1, src_y1, &clip, dst);
       } else {
-        ESP_LOGE(TAG, "FB overflow at idx=%u", (unsigned)dst_byte_idx);
+        blit_rotate270(px_map, stride, src_x1, src_y1, &clip, dst);
+      }
+      if (!capture) {
+        layer_apply(dst, &clip);
       }
+      pixel_count = (uint32_t)lv_area_get_width(&clip) * (uint32_t)lv_area_get_height(&clip);
     }
   }
 
   // Flush处理完成
   if (flush_count <= 20) {
-    ESP_LOGI(TAG,
-             "disp_flush_cb #%u: area(%d,%d)-(%d,%d), pixels=%u (1bpp fast copy)",
+    TRACE_LOGI(LVGL, TAG,
+             "disp_flush_cb #%u: area(%d,%d)-(%d,%d), pixels=%u (8x8 transpose)",
              flush_count, (int)area->x1, (int)area->y1, (int)area->x2,
              (int)area->y2, pixel_count);
   }
 
+  TRACE_EVENT(TRACE_EV_FLUSH, TRACE_PACK(area->x1, area->y1), TRACE_PACK(area->x2, area->y2));
+
   // 脏区跟踪：在 PARTIAL 模式下记录所有刷新的区域，用于优化 EPD 刷新
-  if (s_refresh_mode == EPD_REFRESH_PARTIAL) {
-    dirty_area_add(area);
+  // 不透明图层的像素已由合成恢复，不进入脏区
+  if (s_refresh_mode == EPD_REFRESH_PARTIAL && !capture) {
+    lv_area_t dirty = *area;
+    if (!layer_active() || !s_layer.opaque || layer_clip_area(&dirty)) {
+      dirty_area_add(&dirty);
+    }
+  }
+
+  // 图层暂停期间被覆盖过：恢复后的第一帧结束时整块写回
+  if (!capture && s_layer.restore && layer_active() && lv_display_flush_is_last(disp)) {
+    layer_composite(s_fb_back, &s_layer.phys);
+    s_layer.restore = false;
+    if (s_refresh_mode == EPD_REFRESH_PARTIAL) {
+      dirty_area_add(&s_layer.area);
+    }
   }
 
-  // 标记渲染完成并通知刷新任务
-  s_render_done = true;
-  xSemaphoreGive(s_render_done_sem);
+  s_stats.flush_us += (uint32_t)(esp_timer_get_time() - flush_start_us);
+  s_stats.flush_calls++;
 
-  // 释放互斥锁
-  xSemaphoreGive(s_epd_mutex);
+  if (!capture) {
+    // 释放互斥锁
+    xSemaphoreGive(s_epd_mutex);
+
+    // 最后一块写完：RENDERED，唤醒等待中的刷新任务
+    if (lv_display_flush_is_last(disp)) {
+      flush_frame_end();
+    }
+  }
 
   // 通知LVGL刷新完成（不触发 EPD 硬件刷新）
   lv_display_flush_ready(disp);
@@ -332,7 +1358,42 @@ static void disp_flush_cb(lv_display_t *disp, const lv_area_t *area,
 // 异步 EPD 刷新任务（前置声明）
 static void epd_refresh_task(void *arg);
 
+// EPD 波形结束回调（BUSY 中断上下文）
+static void IRAM_ATTR epd_update_done_isr(void *arg) {
+  (void)arg;
+  s_epd_panel_busy = false;
+  turn_stats_panel_idle_isr();
+}
+
+// EPD 波形窗口：刷新任务停在 BUSY 上的这段时间交给只用 CPU 的后台作业
+// （结束时可能在 BUSY 中断上下文）
+static void IRAM_ATTR epd_busy_window_hook(bool busy, UDOUBLE expected_us, void *arg) {
+  (void)arg;
+  if (busy) {
+    bg_jobs_epd_window_begin(expected_us);
+  } else {
+    bg_jobs_epd_window_end();
+  }
+}
+
 // 初始化LVGL显示驱动
+// 按当前策略与颜色格式设置 LVGL 绘制缓冲区（LVGL 任务中调用，不能在渲染中途调用）
+static void render_buffers_apply(void) {
+  const bool direct = (s_render_strategy == EPD_RENDER_DIRECT) && !s_gray_mode;
+  const lv_display_render_mode_t mode =
+      direct ? LV_DISPLAY_RENDER_MODE_DIRECT : LV_DISPLAY_RENDER_MODE_PARTIAL;
+
+  lv_display_set_color_format(g_lv_display, s_gray_mode ? LV_COLOR_FORMAT_L8 : LV_COLOR_FORMAT_I1);
+  lv_display_set_render_mode(g_lv_display, mode);
+  lv_display_set_buffers(g_lv_display, s_draw_buf, s_draw_buf2, s_draw_buf_size, mode);
+  s_direct_render = direct;
+}
+
+// LVGL tick 源：esp_timer 的单调时钟（ms）
+static uint32_t lvgl_tick_get_cb(void) {
+  return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
 lv_display_t *lvgl_display_init(void) {
   ESP_LOGI(TAG, "Initializing LVGL display driver (LVGL 9.x)");
 
@@ -345,29 +1406,38 @@ lv_display_t *lvgl_display_init(void) {
     }
   }
 
-  // 创建信号量（用于 disp_flush_cb 通知渲染完成）
-  if (s_render_done_sem == NULL) {
-    s_render_done_sem = xSemaphoreCreateBinary();
-    if (s_render_done_sem == NULL) {
-      ESP_LOGE(TAG, "Failed to create render done semaphore!");
+  // 创建帧流水线事件组与状态锁（渲染与上传之间的交接）
+  if (s_frame_events == NULL) {
+    s_frame_events = xEventGroupCreate();
+    s_frame_lock = xSemaphoreCreateMutex();
+    if (s_frame_events == NULL || s_frame_lock == NULL) {
+      ESP_LOGE(TAG, "Failed to create frame pipeline event group!");
       return NULL;
     }
   }
-
-  // 创建刷新请求队列（异步刷新）
-  if (s_refresh_queue == NULL) {
-    // Single-slot queue + overwrite ensures the latest refresh request is not
-    // dropped.
-    s_refresh_queue = xQueueCreate(1, sizeof(refresh_request_t));
-    if (s_refresh_queue == NULL) {
-      ESP_LOGE(TAG, "Failed to create refresh queue!");
+  s_frame_state = FRAME_DISPLAYED;
+  xEventGroupSetBits(s_frame_events,
+                     FRAME_EV_RENDER_IDLE | FRAME_EV_BACK_FREE | FRAME_EV_UPLOAD_IDLE);
+
+  // 创建刷新请求信箱锁（异步刷新）
+  if (s_mailbox_lock == NULL) {
+    s_mailbox_lock = xSemaphoreCreateMutex();
+    if (s_mailbox_lock == NULL) {
+      ESP_LOGE(TAG, "Failed to create refresh mailbox lock!");
       return NULL;
     }
+    memset(&s_mailbox, 0, sizeof(s_mailbox));
+    memset(&s_inflight, 0, sizeof(s_inflight));
   }
 
+  // 开启 EPD 异步刷新：Display* 上传完数据、启动波形后立即返回，
+  // 刷新任务释放 framebuffer，LVGL 可以在波形运行期间渲染下一页
+  EPD_4in26_SetAsyncUpdate(true, epd_update_done_isr, NULL);
+  EPD_4in26_SetBusyWindowHook(epd_busy_window_hook, NULL);
+
   // 创建异步刷新任务
   if (s_epd_refresh_task_handle == NULL) {
-    BaseType_t ret = xTaskCreate(epd_refresh_task, "epd_refresh", 4096, NULL,
+    BaseType_t ret = xTaskCreate(epd_refresh_task, "epd_refresh", EPD_REFRESH_TASK_STACK, NULL,
                                  3, // 优先级高于 LVGL 任务 (2)
                                  &s_epd_refresh_task_handle);
     if (ret != pdPASS) {
@@ -377,8 +1447,10 @@ lv_display_t *lvgl_display_init(void) {
     ESP_LOGI(TAG, "EPD refresh task created (async mode)");
   }
 
-  // 清空 framebuffer 并初始化为白色 (1=白色)
-  memset(s_epd_framebuffer, 0xFF, sizeof(s_epd_framebuffer));
+  // 清空 framebuffer 并初始化为白色 (1=白色)；启动画面留在里面，由调用方声明为面板内容
+  if (!s_fb_early_used) {
+    memset(s_epd_framebuffer, 0xFF, sizeof(s_epd_framebuffer));
+  }
   memset(s_lvgl_draw_buffer, 0xFF, sizeof(s_lvgl_draw_buffer));
   
   const uint32_t total_kb = (sizeof(s_epd_framebuffer) + sizeof(s_lvgl_draw_buffer)) / 1024;
@@ -388,292 +1460,1230 @@ lv_display_t *lvgl_display_init(void) {
            total_kb);
 
   // 清空脏区域追踪
-  s_dirty_valid = false;
-  s_partial_refresh_count = 0;
-  s_epd_refreshing = false;
-  s_render_done = false;
+  dirty_clear();
+  s_partial_needs_base = true;
+  ghost_reset();
+  // 行哈希帧差分开销很小（1.9 KB 静态表），默认开启
+  s_frame_diff = EPD_FRAME_DIFF_ROW_HASH;
+  s_frame_diff_valid = false;
 
   // 初始化LVGL
   lv_init();
+  // I1 专用绘制单元优先于软件渲染器处理纯色、边框、直线与文本
+  lvgl_draw_i1_init();
+  // tick 直接取自 esp_timer，不再需要 10 ms 的 tick 任务
+  lv_tick_set_cb(lvgl_tick_get_cb);
 
   // 创建显示设备 - LVGL 9.x 新API
   lv_display_t *disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
   lv_display_set_flush_cb(disp, disp_flush_cb);
+  // 先裁掉静态图层，再按字节对齐（原生方向）
+  lv_display_add_event_cb(disp, layer_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+  lv_display_add_event_cb(disp, disp_rounder_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+  // 1bpp 面板上抗锯齿的半透明边缘只会被阈值化，关闭后省掉边缘混合
+  lv_display_set_antialiasing(disp, false);
+  // 墨水屏主题：无过渡/动画、无圆角阴影、1 像素边框
+  lvgl_theme_eink_init(disp);
 
   // 保存 display 指针到全局变量
   g_lv_display = disp;
+  s_draw_buf_size = DISP_I1_STRIDE * DISP_BUF_LINES + 8;
 
   // 配置：PARTIAL 模式 + 1bpp 颜色格式
   // - 使用 LV_COLOR_FORMAT_I1 (1bpp黑白)
   // - LVGL 分块渲染到小缓冲区 (12 KB)
   // - flush_cb 进行坐标旋转映射，无需颜色转换
   // - 内存占用: ~60 KB (相比 RGB565 DIRECT 的 ~798 KB)
-  lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1);
-  
-  // 使用 PARTIAL 渲染模式（更稳定）
-  lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
-
-  // 设置小缓冲区（PARTIAL 模式）
-  lv_display_set_buffers(disp, s_lvgl_draw_buffer, NULL,
-                         sizeof(s_lvgl_draw_buffer),
-                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  render_buffers_apply();
 
   ESP_LOGI(TAG,
            "LVGL display initialized: %dx%d, 1bpp, PARTIAL mode, %u KB total RAM",
            DISP_HOR_RES, DISP_VER_RES, total_kb);
 
+  // 编译期选择了其他绘制策略时在这里切换（分配失败则保持静态分带）
+  if (EPD_RENDER_STRATEGY_DEFAULT != EPD_RENDER_BANDS ||
+      EPD_RENDER_BAND_LINES_DEFAULT != DISP_BUF_LINES) {
+    lvgl_set_render_strategy(EPD_RENDER_STRATEGY_DEFAULT, EPD_RENDER_BAND_LINES_DEFAULT);
+  }
+
   return disp;
 }
 
+// 空闲鬼影清理：用户停止翻页后对当前画面执行一次快刷
+static void ghost_idle_cleanup(void) {
+  if (s_epd_gray_loaded) {
+    s_ghost_cleanup_pending = false;  // 灰阶模式不做单色快刷清理
+    return;
+  }
+  if (!frame_upload_begin(0)) {
+    return; // 正在渲染，下个空闲周期再试
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    frame_upload_end();
+    return;
+  }
+  TRACE_EVENT(TRACE_EV_GHOST_CLEANUP, s_ghost_max, s_partial_refresh_count);
+  TRACE_LOGI(LVGL, TAG, "Ghost scheduler: idle cleanup (debt=%u, partials=%u)",
+             (unsigned)s_ghost_max, s_partial_refresh_count);
+
+  EPD_4in26_Display_Fast(s_fb_back);
+  frame_diff_commit(s_fb_back, NULL, 0);
+  ghost_reset();
+
+  xSemaphoreGive(s_epd_mutex);
+  frame_upload_end();
+}
+
+// 面板空闲休眠（刷新任务中调用）
+static void panel_idle_sleep(void) {
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return; // 正在渲染，马上会有新的刷新请求
+  }
+  EPD_4in26_WaitIdle();
+  EPD_4in26_Hibernate();
+  s_panel_asleep = true;
+  s_epd_panel_busy = false;
+  xSemaphoreGive(s_epd_mutex);
+  TRACE_EVENT(TRACE_EV_PANEL_SLEEP, s_panel_sleep_ms, 0);
+  TRACE_LOGI(LVGL, TAG, "Panel idle %u ms, controller in deep sleep",
+             (unsigned)s_panel_sleep_ms);
+}
+
+// 预热唤醒：复位并加载当前波形（刷新任务中调用）
+static void panel_prewarm(void) {
+  s_panel_wake_requested = false;
+  if (!s_panel_asleep) {
+    return;
+  }
+  const int64_t start_us = esp_timer_get_time();
+  EPD_4in26_EnsureMode(s_epd_gray_loaded ? EPD_4in26_MODE_4GRAY : EPD_4in26_MODE_MONO);
+  s_panel_asleep = false;
+  TRACE_EVENT(TRACE_EV_PANEL_WAKE, (uint32_t)(esp_timer_get_time() - start_us), 0);
+  TRACE_LOGI(LVGL, TAG, "Panel pre-warmed in %d ms",
+             (int)((esp_timer_get_time() - start_us) / 1000));
+}
+
+// 灰阶刷新：变化区域较小时用包围盒窗口刷新，否则整屏（面板需已加载灰阶波形）
+static void refresh_gray(const uint8_t *fb, epd_refresh_mode_t mode,
+                         const lv_area_t *rects, uint8_t count) {
+  if (mode == EPD_REFRESH_PARTIAL && count > 0) {
+    lv_area_t box = rects[0];
+    for (uint8_t i = 1; i < count; i++) {
+      lv_area_join(&box, &box, &rects[i]);
+    }
+    if (lv_area_get_size(&box) * 100 <=
+        (uint32_t)EPD_WIDTH * EPD_HEIGHT * GRAY_PARTIAL_MAX_PCT) {
+      TRACE_LOGI(LVGL, TAG, "EPD refresh task: GRAY window EPD(%d,%d)-(%d,%d)",
+                 (int)box.x1, (int)box.y1, (int)box.x2, (int)box.y2);
+      EPD_4in26_4GrayDisplay_PartPlanes(fb, s_fb_gray_hi, (UWORD)box.x1, (UWORD)box.y1,
+                                        (UWORD)lv_area_get_width(&box),
+                                        (UWORD)lv_area_get_height(&box));
+      return;
+    }
+  }
+  TRACE_LOGI(LVGL, TAG, "EPD refresh task: GRAY full refresh");
+  EPD_4in26_4GrayDisplay_Planes(fb, s_fb_gray_hi);
+}
+
+// 实际执行的刷新模式（翻页遥测分模式统计）
+static turn_mode_t turn_mode_of(epd_refresh_mode_t mode, bool gray) {
+  if (gray) {
+    return TURN_MODE_GRAY;
+  }
+  switch (mode) {
+  case EPD_REFRESH_PARTIAL:
+    return TURN_MODE_PARTIAL;
+  case EPD_REFRESH_FULL:
+    return TURN_MODE_FULL;
+  default:
+    return TURN_MODE_FAST;
+  }
+}
+
 // 异步 EPD 刷新任务
+// 刷新结束时调用：本次刷新启动了波形且晚于最近一次按键时记一个样本
+static void key_latency_settle(int64_t refresh_start_us) {
+  const int64_t wave_us = EPD_4in26_GetLastUpdateUs();
+  if (wave_us < refresh_start_us) {
+    return;
+  }
+  const uint32_t wave_ms = (uint32_t)(wave_us / 1000);
+  uint32_t latency_ms = 0;
+  bool fast = false;
+  bool counted = false;
+  portENTER_CRITICAL(&s_key_latency_mux);
+  if (s_key_latency_armed && (int32_t)(wave_ms - s_key_latency_press_ms) >= 0) {
+    s_key_latency_armed = false;
+    latency_ms = wave_ms - s_key_latency_press_ms;
+    fast = s_key_latency_fast;
+    if (latency_ms <= KEY_LATENCY_MAX_MS) {
+      key_latency_acc_t *acc = &s_key_latency[fast ? 1 : 0];
+      acc->samples++;
+      acc->sum_ms += latency_ms;
+      acc->last_ms = latency_ms;
+      if (latency_ms > acc->max_ms) {
+        acc->max_ms = latency_ms;
+      }
+      counted = true;
+    }
+  }
+  portEXIT_CRITICAL(&s_key_latency_mux);
+  if (counted) {
+    TRACE_LOGI(LVGL, TAG, "Key -> waveform: %u ms (%s)", (unsigned)latency_ms,
+               fast ? "fast path" : "indev");
+  }
+}
+
 static void epd_refresh_task(void *arg) {
   (void)arg;
+  stack_stats_register_self("epd_refresh", EPD_REFRESH_TASK_STACK);
   ESP_LOGI(TAG, "EPD refresh task started");
 
   while (1) {
     refresh_request_t req;
-    // 等待刷新请求，阻塞等待
-    if (xQueueReceive(s_refresh_queue, &req, portMAX_DELAY) == pdTRUE) {
-      ESP_LOGI(TAG, "EPD refresh task: received request, mode=%d", req.mode);
-
-      // Mark refreshing to indicate EPD is busy
-      s_epd_refreshing = true;
-      __sync_synchronize();
-
-      // 关键：先清空信号量，防止 disp_flush_cb 在我们开始等待之前就已经给了信号
-      // 如果 disp_flush_cb 在我们清空信号量之前就已经给了，它会设置 s_render_done=true
-      // 我们通过检查 s_render_done 来判断是否有渲染发生
-      xSemaphoreTake(s_render_done_sem, 0);  // 非阻塞清除
-
-      // 使用信号量等待渲染完成（比轮询 s_render_done 更可靠）
-      // 如果 s_render_done 已经为 true，说明渲染已完成，直接获取信号量
-      // 否则等待信号量，最大等待 200ms
-      bool waited_for_render = false;
-      if (!s_render_done) {
-        waited_for_render = true;
-        BaseType_t got_sem = xSemaphoreTake(s_render_done_sem, pdMS_TO_TICKS(200));
-        if (got_sem != pdTRUE) {
-          ESP_LOGW(TAG,
-                   "EPD refresh task: render not ready, sending current data");
+    // 等待刷新请求；有待执行的鬼影清理时最多等待 GHOST_IDLE_MS，
+    // 面板醒着时最多等待 s_panel_sleep_ms 后进入休眠
+    TickType_t wait = portMAX_DELAY;
+    if (s_ghost_cleanup_pending) {
+      wait = pdMS_TO_TICKS(GHOST_IDLE_MS);
+    } else if (!s_panel_asleep && s_panel_sleep_ms > 0) {
+      wait = pdMS_TO_TICKS(s_panel_sleep_ms);
+    }
+    if (refresh_request_wait(&req, wait)) {
+      TRACE_LOGI(LVGL, TAG, "EPD refresh task: received request, mode=%d", req.mode);
+
+      // Display* 会在控制器休眠时自动复位并初始化
+      s_panel_asleep = false;
+      s_panel_wake_requested = false;
+
+      // 等待进行中的渲染写完最后一块（RENDERING -> RENDERED），然后进入 UPLOADING；
+      // 上传结束前 LVGL 的下一帧会在第一次 flush 时等待
+      if (!frame_upload_begin(pdMS_TO_TICKS(FRAME_RENDER_WAIT_MS))) {
+        ESP_LOGW(TAG, "EPD refresh task: render still in progress, retrying");
+        refresh_request_requeue(&req);
+        continue;
+      }
+      s_upload_frame = s_frames_rendered;
+
+      // 再获取锁执行刷新
+      if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        TRACE_LOGI(LVGL, TAG, "EPD refresh task: refreshing");
+        const int64_t refresh_start_us = esp_timer_get_time();
+        turn_stats_refresh_begin();
+        // 上传期间 APB 保持最高频率、不进入自动浅睡眠；波形（BUSY）期间不持锁
+        power_manager_lock(POWER_LOCK_BUS);
+        power_manager_lock(POWER_LOCK_AWAKE);
+
+        epd_refresh_mode_t mode = req.mode;
+        uint8_t *fb = s_fb_back;
+        bool mutex_held = true;
+        // 快速连按时中间帧可能在上传途中被下一帧取代：EPD 驱动在行突发之间检查，
+        // 放弃时不启动波形，请求按实际模式放回信箱，与新请求合并
+        bool superseded = false;
+
+        // 在锁内快照并清除脏区：乒乓模式下锁会提前释放，
+        // 之后 flush_cb 记录的脏区属于下一帧，不能被本次刷新清除
+        lv_area_t dirty_rects[DIRTY_RECT_MAX];
+        uint8_t dirty_count;
+        portENTER_CRITICAL(&s_dirty_mux);
+        dirty_count = dirty_take(dirty_rects);
+        portEXIT_CRITICAL(&s_dirty_mux);
+        TRACE_EVENT(TRACE_EV_REFRESH_START, mode, dirty_count);
+
+        if (s_double_buffer && s_fb_alt != NULL) {
+          // 交换前后台：当前后台成为上传用的前台，旧前台复制为新的后台，
+          // 保证 PARTIAL 渲染只覆盖变化区域时其余像素仍是最新内容
+          s_fb_back = (fb == s_epd_framebuffer) ? s_fb_alt : s_epd_framebuffer;
+          memcpy(s_fb_back, fb, sizeof(s_epd_framebuffer));
+          xSemaphoreGive(s_epd_mutex);
+          mutex_held = false;
+          frame_back_released();
+        }
+
+        // 夜间模式切换：反相是输出端的，两块 RAM 的对比关系不变，局刷不会驱动
+        // 任何像素，必须全刷；全刷同时清掉切换前累积的鬼影
+        const bool night_changed = s_night_mode != s_night_applied;
+        if (night_changed) {
+          s_night_applied = s_night_mode;
+          EPD_4in26_SetInvert(s_night_applied);
+          mode = EPD_REFRESH_FULL;
+          ESP_LOGI(TAG, "EPD refresh task: night mode %s", s_night_applied ? "on" : "off");
+        }
+
+        // 灰阶与单色使用不同的波形：切换时先等面板空闲再重新初始化，
+        // 波形切换后面板内容需要整屏重建
+        const bool gray = s_gray_mode;
+        if (gray != s_epd_gray_loaded) {
+          EPD_4in26_WaitIdle();
+          if (gray) {
+            EPD_4in26_Init_4GRAY();
+          } else {
+            EPD_4in26_Init_Fast();
+          }
+          s_epd_gray_loaded = gray;
+          mode = EPD_REFRESH_FULL;
+          ESP_LOGI(TAG, "EPD refresh task: loaded %s waveform", gray ? "4-gray" : "mono");
+        }
+        if (gray) {
+          if (mode == EPD_REFRESH_PARTIAL && dirty_count == 0) {
+            TRACE_EVENT(TRACE_EV_REFRESH_SKIP, mode, 0);
+            goto refresh_done;
+          }
+          refresh_gray(fb, mode, dirty_rects, dirty_count);
+          // 灰阶波形本身会完整驱动像素，不累积鬼影债务；帧差分基准只对单色有效
+          ghost_reset();
+          s_frame_diff_valid = false;
+          goto refresh_done;
         }
+
+        EPD_4in26_SetSupersedeCheck(upload_superseded, NULL);
+        if (s_panel_seeded) {
+          s_panel_seeded = false;
+          if (mode != EPD_REFRESH_PARTIAL && !night_changed) {
+            ESP_LOGI(TAG, "EPD refresh task: panel seeded, %d -> PARTIAL", (int)mode);
+            mode = EPD_REFRESH_PARTIAL;
+          }
+        }
+
+        // 刷新模式选择逻辑：
+        // 1. FULL: 执行全刷（用于屏幕切换，确保显示清晰）
+        // 2. FAST: 执行快刷（全屏数据，速度快）
+        // 3. PARTIAL: 切换屏幕后的第一次或鬼影债务超过硬上限时执行全刷；
+        //    否则执行局刷并累积债务，超过阈值后在空闲时清理
+        if (mode == EPD_REFRESH_FULL) {
+          TRACE_LOGI(LVGL, TAG, "EPD refresh task: FULL refresh (requested)");
+          if (!EPD_4in26_Display(fb)) {
+            superseded = true;
+            goto refresh_done;
+          }
+          frame_diff_commit(fb, NULL, 0);
+          ghost_reset();
+          s_partial_needs_base = false;
+
+        } else if (mode == EPD_REFRESH_FAST) {
+          TRACE_LOGI(LVGL, TAG, "EPD refresh task: FAST refresh");
+          if (!EPD_4in26_Display_Fast(fb)) {
+            superseded = true;
+            goto refresh_done;
+          }
+          frame_diff_commit(fb, NULL, 0);
+          ghost_reset();
+          s_partial_needs_base = false;
+
+        } else if (mode == EPD_REFRESH_PARTIAL) {
+          const uint32_t threshold = ghost_threshold();
+          if (s_partial_needs_base ||
+              s_ghost_max >= threshold * GHOST_HARD_LIMIT_FACTOR) {
+            ESP_LOGI(TAG,
+                     "EPD refresh task: PARTIAL -> FULL (base=%d, debt=%u/%u)",
+                     s_partial_needs_base, (unsigned)s_ghost_max,
+                     (unsigned)threshold);
+            mode = EPD_REFRESH_FULL;
+            if (!EPD_4in26_Display(fb)) {
+              superseded = true;
+              goto refresh_done;
+            }
+            frame_diff_commit(fb, NULL, 0);
+            ghost_reset();
+            s_partial_needs_base = false;
+            goto refresh_done;
+          }
+
+          if (dirty_count == 0 && s_stale_count == 0) {
+            ESP_LOGW(TAG, "EPD refresh task: PARTIAL requested but no dirty area, skipping");
+            TRACE_EVENT(TRACE_EV_REFRESH_SKIP, mode, 0);
+            goto refresh_done;
+          }
+
+          // 帧差分：剔除重新渲染但像素未变的矩形，全部未变则不刷新面板
+          uint8_t changed = 0;
+          for (uint8_t i = 0; i < dirty_count; i++) {
+            lv_area_t r = dirty_rects[i];
+            if (frame_diff_refine(fb, &r)) {
+              dirty_rects[changed++] = r;
+            }
+          }
+          if (changed < dirty_count) {
+            TRACE_LOGI(LVGL, TAG, "EPD refresh task: frame diff kept %u/%u rect(s)",
+                       (unsigned)changed, (unsigned)dirty_count);
+          }
+          // 被取代的局刷留在 RAM 里的窗口原样加入（中间帧与面板的差别帧差分看不到）
+          for (uint8_t i = 0; i < s_stale_count; i++) {
+            changed = rects_append(dirty_rects, changed, &s_stale_rects[i]);
+          }
+          dirty_count = changed;
+          if (dirty_count == 0) {
+            TRACE_LOGI(LVGL, TAG, "EPD refresh task: frame unchanged, skipping panel update");
+            TRACE_EVENT(TRACE_EV_REFRESH_SKIP, mode, 1);
+            goto refresh_done;
+          }
+
+          // 局部刷新：直接使用完整的前台 framebuffer，每个脏矩形一个窗口，
+          // 全部写入后只触发一次刷新
+          EPD_4in26_Rect rects[DIRTY_RECT_MAX];
+          for (uint8_t i = 0; i < dirty_count; i++) {
+            rects[i].x = (UWORD)dirty_rects[i].x1;
+            rects[i].y = (UWORD)dirty_rects[i].y1;
+            rects[i].w = (UWORD)lv_area_get_width(&dirty_rects[i]);
+            rects[i].h = (UWORD)lv_area_get_height(&dirty_rects[i]);
+            TRACE_LOGI(LVGL, TAG, "EPD refresh task: PARTIAL #%u window %u EPD(x=%d,y=%d,%dx%d)",
+                       s_partial_refresh_count + 1, (unsigned)i, (int)rects[i].x,
+                       (int)rects[i].y, (int)rects[i].w, (int)rects[i].h);
+          }
+          if (!EPD_4in26_Display_PartialMulti(fb, rects, dirty_count)) {
+            // 已写完的窗口两个平面一致，但 0x24 是没显示的中间帧：记下全部窗口
+            memcpy(s_stale_rects, dirty_rects, dirty_count * sizeof(dirty_rects[0]));
+            s_stale_count = dirty_count;
+            superseded = true;
+            goto refresh_done;
+          }
+          s_stale_count = 0;
+          for (uint8_t i = 0; i < dirty_count; i++) {
+            ghost_account(fb, &dirty_rects[i]);
+          }
+          frame_diff_commit(fb, dirty_rects, dirty_count);
+          s_partial_refresh_count++;
+
+          if (s_ghost_max >= threshold && !s_ghost_cleanup_pending) {
+            ESP_LOGI(TAG,
+                     "EPD refresh task: ghost debt %u >= %u, cleanup after %d ms idle",
+                     (unsigned)s_ghost_max, (unsigned)threshold, GHOST_IDLE_MS);
+            s_ghost_cleanup_pending = true;
+          }
+        } else {
+          ESP_LOGE(TAG, "EPD refresh task: Unknown mode %d, fallback to FAST",
+                   mode);
+          mode = EPD_REFRESH_FAST;
+          if (!EPD_4in26_Display_Fast(fb)) {
+            superseded = true;
+            goto refresh_done;
+          }
+          frame_diff_commit(fb, NULL, 0);
+          ghost_reset();
+          s_partial_needs_base = false;
+        }
+
+      refresh_done:
+        EPD_4in26_SetSupersedeCheck(NULL, NULL);
+        if (superseded) {
+          // 整帧上传中途放弃时 RAM 不完整：之后的局刷必须先整屏刷新
+          if (mode != EPD_REFRESH_PARTIAL) {
+            s_partial_needs_base = true;
+          }
+          s_stats.superseded++;
+          TRACE_EVENT(TRACE_EV_REFRESH_SKIP, mode, 2);
+          TRACE_LOGI(LVGL, TAG, "EPD refresh task: superseded by a newer frame, mode=%d", mode);
+        } else if (mode != EPD_REFRESH_PARTIAL) {
+          s_stale_count = 0;
+        }
+        power_manager_unlock(POWER_LOCK_AWAKE);
+        power_manager_unlock(POWER_LOCK_BUS);
+        key_latency_settle(refresh_start_us);
+        turn_stats_refresh_end(turn_mode_of(mode, gray), EPD_4in26_GetLastUpdateUs(),
+                               EPD_4in26_IsBusy());
+        s_stats.refresh_us += (uint32_t)(esp_timer_get_time() - refresh_start_us);
+        s_stats.refreshes++;
+        TRACE_EVENT(TRACE_EV_REFRESH_DONE, mode,
+                    (uint32_t)(esp_timer_get_time() - refresh_start_us));
+        TRACE_LOGI(LVGL, TAG, "EPD refresh task: complete");
+        if (mutex_held) {
+          xSemaphoreGive(s_epd_mutex);
+        }
+        frame_upload_end();
+        if (superseded) {
+          req.mode = mode;
+          refresh_request_requeue(&req);
+        } else {
+          refresh_request_complete();
+        }
+
+      } else {
+        ESP_LOGW(TAG, "Failed to acquire mutex for refresh, retrying");
+        s_epd_panel_busy = EPD_4in26_IsBusy();
+        frame_upload_end();
+        refresh_request_requeue(&req);
+      }
+    } else if (s_panel_wake_requested) {
+      panel_prewarm();
+    } else if (s_ghost_cleanup_pending) {
+      ghost_idle_cleanup();
+    } else if (!s_panel_asleep && s_panel_sleep_ms > 0) {
+      panel_idle_sleep();
+    }
+  }
+}
+
+// 刷新 EPD - 使用当前配置的模式
+void lvgl_display_refresh(void) { queue_refresh_request(s_refresh_mode); }
+
+// 局部刷新 EPD
+void lvgl_display_refresh_partial(void) {
+  queue_refresh_request(EPD_REFRESH_PARTIAL);
+}
+
+// 快速刷新 EPD
+void lvgl_display_refresh_fast(void) {
+  queue_refresh_request(EPD_REFRESH_FAST);
+}
+
+// 全刷 EPD
+void lvgl_display_refresh_full(void) {
+  queue_refresh_request(EPD_REFRESH_FULL);
+}
+
+// 提交带 deadline / 完成信号量的刷新请求
+bool lvgl_display_refresh_request(const lvgl_refresh_request_t *req) {
+  if (req == NULL) {
+    return false;
+  }
+  return refresh_request_submit(req->mode, req->deadline_ms, req->done_sem);
+}
+
+// 同步刷新：等待包含本次请求的刷新完成且面板空闲
+bool lvgl_display_refresh_sync(epd_refresh_mode_t mode, uint32_t timeout_ms) {
+  StaticSemaphore_t sem_buf;
+  SemaphoreHandle_t sem = xSemaphoreCreateBinaryStatic(&sem_buf);
+
+  if (!refresh_request_submit(mode, 0, sem)) {
+    refresh_request_cancel_waiter(sem);
+    vSemaphoreDelete(sem);
+    return false;
+  }
+  const bool done = xSemaphoreTake(sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+  if (!done) {
+    ESP_LOGW(TAG, "lvgl_display_refresh_sync: timed out after %u ms",
+             (unsigned)timeout_ms);
+    refresh_request_cancel_waiter(sem);
+  }
+  vSemaphoreDelete(sem);
+  return done;
+}
+
+// 设置刷新模式
+void lvgl_set_refresh_mode(epd_refresh_mode_t mode) {
+  s_refresh_mode = mode;
+
+  switch (mode) {
+  case EPD_REFRESH_PARTIAL:
+    ESP_LOGI(TAG, "Refresh mode set to PARTIAL (fastest, may have ghosting)");
+    break;
+  case EPD_REFRESH_FAST:
+    ESP_LOGI(TAG, "Refresh mode set to FAST (balanced)");
+    break;
+  case EPD_REFRESH_FULL:
+    ESP_LOGI(TAG, "Refresh mode set to FULL (clearest)");
+    break;
+  }
+}
+
+// 获取当前刷新模式
+epd_refresh_mode_t lvgl_get_refresh_mode(void) { return s_refresh_mode; }
+
+// 检查 EPD 是否正在刷新
+bool lvgl_is_refreshing(void) { return s_frame_events != NULL && frame_uploading(); }
+
+// 夜间模式：只记录请求并提交一次刷新，反相在刷新任务中交给控制器
+void lvgl_set_night_mode(bool enable) {
+  if (s_night_mode == enable) {
+    return;
+  }
+  s_night_mode = enable;
+  queue_refresh_request(EPD_REFRESH_FULL);
+}
+
+bool lvgl_get_night_mode(void) { return s_night_mode; }
+
+// 读取各阶段累计耗时
+void lvgl_display_get_stats(lvgl_display_stats_t *out) {
+  if (out != NULL) {
+    *out = s_stats;
+  }
+}
+
+// 清零各阶段累计耗时
+void lvgl_display_reset_stats(void) { memset(&s_stats, 0, sizeof(s_stats)); }
+
+// 检查 EPD 波形是否仍在运行
+bool lvgl_is_panel_busy(void) { return lvgl_is_refreshing() || s_epd_panel_busy; }
+
+// 设置面板空闲休眠时间
+void lvgl_set_panel_sleep_timeout(uint32_t ms) {
+  s_panel_sleep_ms = ms;
+}
+
+// 获取面板空闲休眠时间
+uint32_t lvgl_get_panel_sleep_timeout(void) { return s_panel_sleep_ms; }
+
+// 检查面板控制器是否处于空闲休眠
+bool lvgl_is_panel_asleep(void) { return s_panel_asleep; }
+
+// 按键唤醒后预热面板
+void lvgl_display_wake(void) {
+  if (!s_panel_asleep || s_epd_refresh_task_handle == NULL) {
+    return;
+  }
+  s_panel_wake_requested = true;
+  xTaskNotifyGive(s_epd_refresh_task_handle);
+}
+
+// 重置刷新状态
+void lvgl_reset_refresh_state(void) {
+  portENTER_CRITICAL(&s_dirty_mux);
+  dirty_clear();
+  portEXIT_CRITICAL(&s_dirty_mux);
+  // 开机声明的面板内容仍然有效时不需要先整屏刷新
+  s_partial_needs_base = !s_panel_seeded;
+
+  // 清空刷新信箱，丢弃待处理的刷新请求
+  // 这对于屏幕切换很重要：旧屏幕的 PARTIAL 刷新请求不应该污染新屏幕
+  // 丢弃的请求同样释放等待者，避免调用方一直阻塞
+  if (s_mailbox_lock != NULL) {
+    xSemaphoreTake(s_mailbox_lock, portMAX_DELAY);
+    for (uint8_t i = 0; i < s_mailbox.waiter_count; i++) {
+      xSemaphoreGive(s_mailbox.waiters[i]);
+    }
+    memset(&s_mailbox, 0, sizeof(s_mailbox));
+    xSemaphoreGive(s_mailbox_lock);
+    ESP_LOGI(TAG, "Cleared refresh mailbox during reset");
+  }
+
+  // 新屏幕默认按文本处理，需要灰阶的屏幕创建时再声明
+  lvgl_set_content_hint(EPD_CONTENT_TEXT);
+
+  ESP_LOGI(TAG, "Refresh state reset (dirty_rects=%u, ghost_debt=%u)",
+           (unsigned)s_dirty_count, (unsigned)s_ghost_max);
+}
+
+// 清空 framebuffer 为白色
+void lvgl_clear_framebuffer(void) {
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+    if (s_gray_mode) {
+      // 灰阶位平面：全白为 0x00
+      memset(s_fb_back, 0x00, sizeof(s_epd_framebuffer));
+      memset(s_fb_gray_hi, 0x00, sizeof(s_epd_framebuffer));
+    } else {
+      memset(s_fb_back, 0xFF, sizeof(s_epd_framebuffer));
+    }
+    xSemaphoreGive(s_epd_mutex);
+    ESP_LOGI(TAG, "Framebuffer cleared to white");
+  } else {
+    ESP_LOGW(TAG, "Failed to acquire mutex for clearing framebuffer");
+  }
+}
+
+void lvgl_seed_panel_frame(const uint8_t *frame) {
+  if (frame == NULL || s_gray_mode) {
+    return;
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    ESP_LOGW(TAG, "Failed to acquire mutex for seeding panel frame");
+    return;
+  }
+  if (frame != s_fb_back) {
+    memcpy(s_fb_back, frame, sizeof(s_epd_framebuffer));
+  }
+  frame_diff_commit(frame, NULL, 0);
+  s_partial_needs_base = false;
+  s_panel_seeded = true;
+  xSemaphoreGive(s_epd_mutex);
+  ESP_LOGI(TAG, "Panel frame seeded (next refresh diffs against it)");
+}
+
+// 获取 framebuffer 锁，并确保刷新任务不在上传阶段（最多等待 8 秒）
+// 持锁时 FRAME_EV_UPLOAD_IDLE 置位说明没有任务处于交换之后的上传阶段，
+// 调用方可以安全地替换或释放刷新任务使用的缓冲区
+static bool lock_idle_refresh(void) {
+  const TickType_t start = xTaskGetTickCount();
+  const TickType_t limit = pdMS_TO_TICKS(FRAME_UPLOAD_WAIT_MS);
+  while (1) {
+    if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+      if (!frame_uploading()) {
+        return true;
       }
-      // 无论是否等到信号量，都检查 s_render_done 确保数据已写入
-      if (!s_render_done) {
-        ESP_LOGW(TAG, "EPD refresh task: s_render_done is false, using current data");
+      xSemaphoreGive(s_epd_mutex);
+    }
+    const TickType_t waited = xTaskGetTickCount() - start;
+    if (waited > limit) {
+      return false;
+    }
+    xEventGroupWaitBits(s_frame_events, FRAME_EV_UPLOAD_IDLE, pdFALSE, pdFALSE,
+                        limit - waited);
+  }
+}
+
+// 开启/关闭乒乓 framebuffer
+bool lvgl_set_double_buffer(bool enable) {
+  if (enable == s_double_buffer) {
+    return true;
+  }
+  if (s_epd_mutex == NULL) {
+    ESP_LOGW(TAG, "Double buffer: display not initialized");
+    return false;
+  }
+
+  if (enable) {
+    if (s_gray_mode) {
+      ESP_LOGW(TAG, "Double buffer: not available in grayscale mode");
+      return false;
+    }
+    uint8_t *buf = (uint8_t *)heap_caps_malloc(sizeof(s_epd_framebuffer),
+                                               MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    if (buf == NULL) {
+      ESP_LOGW(TAG, "Double buffer: no memory for %u bytes (largest free=%u)",
+               (unsigned)sizeof(s_epd_framebuffer),
+               (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+      return false;
+    }
+    if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+      ESP_LOGW(TAG, "Double buffer: failed to acquire mutex");
+      heap_caps_free(buf);
+      return false;
+    }
+    memcpy(buf, s_fb_back, sizeof(s_epd_framebuffer));
+    s_fb_alt = buf;
+    s_double_buffer = true;
+    xSemaphoreGive(s_epd_mutex);
+    ESP_LOGI(TAG, "Double buffer enabled (+%u KB)",
+             (unsigned)(sizeof(s_epd_framebuffer) / 1024));
+    return true;
+  }
+
+  // 关闭：必须等刷新任务不再读取前台缓冲区后才能释放
+  if (!lock_idle_refresh()) {
+    ESP_LOGW(TAG, "Double buffer: timed out waiting for EPD refresh");
+    return false;
+  }
+
+  if (s_fb_back != s_epd_framebuffer) {
+    memcpy(s_epd_framebuffer, s_fb_back, sizeof(s_epd_framebuffer));
+  }
+  uint8_t *buf = s_fb_alt;
+  s_fb_back = s_epd_framebuffer;
+  s_fb_alt = NULL;
+  s_double_buffer = false;
+  xSemaphoreGive(s_epd_mutex);
+
+  heap_caps_free(buf);
+  ESP_LOGI(TAG, "Double buffer disabled");
+  return true;
+}
+
+// 检查乒乓 framebuffer 是否开启
+bool lvgl_is_double_buffer(void) { return s_double_buffer; }
+
+// framebuffer 区域访问与离屏捕获（页面缓存使用）
+size_t lvgl_fb_size(void) { return sizeof(s_epd_framebuffer); }
+
+uint8_t *lvgl_fb_early(void) {
+  if (s_epd_mutex != NULL) {
+    return NULL;
+  }
+  s_fb_early_used = true;
+  return s_epd_framebuffer;
+}
+
+bool lvgl_fb_get_region(const lv_area_t *area, lvgl_fb_region_t *out) {
+  lv_area_t phys;
+  if (area == NULL || out == NULL || !dirty_to_physical(area, &phys)) {
+    return false;
+  }
+  out->offset = (uint32_t)phys.y1 * (EPD_WIDTH / 8) + (uint32_t)phys.x1 / 8;
+  out->row_bytes = (uint16_t)((phys.x2 - phys.x1 + 1) / 8);
+  out->rows = (uint16_t)(phys.y2 - phys.y1 + 1);
+  out->stride = EPD_WIDTH / 8;
+  return true;
+}
+
+const uint8_t *lvgl_fb_read_begin(uint32_t timeout_ms) {
+  if (s_epd_mutex == NULL || s_gray_mode) {
+    return NULL;
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+    return NULL;
+  }
+  return s_fb_back;
+}
+
+void lvgl_fb_read_end(void) { xSemaphoreGive(s_epd_mutex); }
+
+uint32_t lvgl_fb_generation(void) { return s_fb_generation; }
+
+// 直接写入相当于一次 LVGL 渲染：同样经过帧流水线，刷新任务不会读到半帧
+uint8_t *lvgl_fb_write_begin(uint32_t timeout_ms) {
+  if (s_epd_mutex == NULL || s_gray_mode || s_capture_fb != NULL) {
+    return NULL;
+  }
+  if (!frame_render_begin()) {
+    return NULL;
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+    frame_render_end();
+    return NULL;
+  }
+  return s_fb_back;
+}
+
+void lvgl_fb_write_end(const lv_area_t *area) {
+  if (area != NULL && s_refresh_mode == EPD_REFRESH_PARTIAL) {
+    dirty_area_add(area);
+  }
+  xSemaphoreGive(s_epd_mutex);
+  frame_render_end();
+}
+
+// 逐像素写入：竖屏布局下位图的一行对应 framebuffer 的一列，只有原生方向能按字节复制
+void lvgl_fb_put_bitmap(uint8_t *fb, int32_t x, int32_t y, uint16_t width, uint16_t height,
+                        const uint8_t *bits, uint16_t stride) {
+  if (fb == NULL || bits == NULL) {
+    return;
+  }
+  for (int32_t row = 0; row < height; row++) {
+    const int32_t ly = y + row;
+    if (ly < 0 || ly >= DISP_VER_RES) {
+      continue;
+    }
+    const uint8_t *src = bits + (uint32_t)row * stride;
+    for (int32_t col = 0; col < width; col++) {
+      const int32_t lx = x + col;
+      if (lx < 0 || lx >= DISP_HOR_RES) {
+        continue;
       }
-      if (waited_for_render) {
-        ESP_LOGI(TAG,
-                 "EPD refresh task: render completed, sending updated data");
+      const int32_t mem_x = s_native ? lx : ly;
+      const int32_t mem_y = s_native ? ly : EPD_HEIGHT - 1 - lx;
+      uint8_t *dst = &fb[(uint32_t)mem_y * (EPD_WIDTH / 8) + mem_x / 8];
+      const uint8_t mask = (uint8_t)(0x80 >> (mem_x & 7));
+      if (src[col >> 3] & (0x80 >> (col & 7))) {
+        *dst |= mask;
+      } else {
+        *dst &= (uint8_t)~mask;
       }
+    }
+  }
+}
+
+// 灰阶模式下 s_fb_back / s_fb_gray_hi 两个位平面一起写（与 blit_gray 的编码相同）
+bool lvgl_fb_put_gray_bitmap(int32_t x, int32_t y, uint16_t width, uint16_t height,
+                             const uint8_t *bits, uint16_t stride, uint32_t timeout_ms) {
+  if (bits == NULL || s_epd_mutex == NULL || !s_gray_mode || s_fb_gray_hi == NULL) {
+    return false;
+  }
+  if (!frame_render_begin()) {
+    return false;
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+    frame_render_end();
+    return false;
+  }
+  const uint32_t dst_stride = EPD_WIDTH / 8;
+  for (int32_t row = 0; row < height; row++) {
+    const int32_t ly = y + row;
+    if (ly < 0 || ly >= DISP_VER_RES) {
+      continue;
+    }
+    const uint8_t *src = bits + (uint32_t)row * stride;
+    for (int32_t col = 0; col < width; col++) {
+      const int32_t lx = x + col;
+      if (lx < 0 || lx >= DISP_HOR_RES) {
+        continue;
+      }
+      const uint8_t g = (uint8_t)((src[col >> 2] >> (6 - 2 * (col & 3))) & 3);
+      const int32_t mx = s_native ? lx : ly;
+      const int32_t my = s_native ? ly : EPD_HEIGHT - 1 - lx;
+      const uint32_t idx = (uint32_t)my * dst_stride + (uint32_t)(mx >> 3);
+      const uint8_t bit = (uint8_t)(0x80 >> (mx & 7));
+      s_fb_back[idx] = (g & 1) ? (uint8_t)(s_fb_back[idx] & ~bit) : (uint8_t)(s_fb_back[idx] | bit);
+      s_fb_gray_hi[idx] = (g & 2) ? (uint8_t)(s_fb_gray_hi[idx] & ~bit)
+                                  : (uint8_t)(s_fb_gray_hi[idx] | bit);
+    }
+  }
+  if (s_refresh_mode == EPD_REFRESH_PARTIAL) {
+    const lv_area_t area = {x, y, x + width - 1, y + height - 1};
+    dirty_area_add(&area);
+  }
+  xSemaphoreGive(s_epd_mutex);
+  frame_render_end();
+  return true;
+}
 
-      // 再获取锁执行刷新
-      if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-        ESP_LOGI(TAG, "EPD refresh task: refreshing, s_epd_refreshing=%d",
-                 s_epd_refreshing);
+bool lvgl_capture_begin(uint8_t *fb) {
+  if (fb == NULL || g_lv_display == NULL || s_gray_mode || s_capture_fb != NULL) {
+    return false;
+  }
+  s_capture_fb = fb;
+  return true;
+}
 
-        epd_refresh_mode_t mode = req.mode;
+void lvgl_capture_end(void) { s_capture_fb = NULL; }
 
-        // 刷新模式选择逻辑：
-        // 1. FULL: 执行全刷（用于屏幕切换，确保显示清晰）
-        // 2. FAST: 执行快刷（全屏数据，速度快）
-        // 3. PARTIAL: 如果局刷计数 = 0，执行快刷；否则执行局刷，计数器+1
-        //    计数器 >= 10 时重置，下次将执行快刷
-        if (mode == EPD_REFRESH_FULL) {
-          ESP_LOGI(TAG, "EPD refresh task: FULL refresh (requested)");
-          EPD_4in26_Display(s_epd_framebuffer);
-          s_partial_refresh_count = 0;
-          portENTER_CRITICAL(&s_dirty_mux);
-          s_dirty_valid = false;
-          portEXIT_CRITICAL(&s_dirty_mux);
+bool lvgl_layer_capture(const lv_area_t *area, bool opaque) {
+  const lv_area_t screen = {0, 0, DISP_HOR_RES - 1, DISP_VER_RES - 1};
+  lv_area_t logical;
+  lv_area_t exact;
+  if (area == NULL || s_epd_mutex == NULL || s_gray_mode ||
+      !lv_area_intersect(&logical, area, &screen) || !area_to_physical(&logical, &exact)) {
+    ESP_LOGW(TAG, "Layer: invalid area or display not ready");
+    return false;
+  }
 
-        } else if (mode == EPD_REFRESH_FAST) {
-          ESP_LOGI(TAG, "EPD refresh task: FAST refresh");
-          EPD_4in26_Display_Fast(s_epd_framebuffer);
-          s_partial_refresh_count = 0;
-          portENTER_CRITICAL(&s_dirty_mux);
-          s_dirty_valid = false;
-          portEXIT_CRITICAL(&s_dirty_mux);
+  lv_area_t phys = exact;
+  phys.x1 &= ~31;
+  phys.x2 |= 31;
+  const uint16_t words = (uint16_t)((phys.x2 - phys.x1 + 1) / 32);
+  const uint32_t n = (uint32_t)words * (uint32_t)(phys.y2 - phys.y1 + 1);
+  uint32_t *bits = (uint32_t *)heap_caps_malloc(2 * n * sizeof(uint32_t), MALLOC_CAP_8BIT);
+  if (bits == NULL) {
+    ESP_LOGW(TAG, "Layer: no memory for %u bytes", (unsigned)(2 * n * sizeof(uint32_t)));
+    return false;
+  }
+  uint32_t *mask = bits + n;
 
-        } else if (mode == EPD_REFRESH_PARTIAL) {
-          // 局刷次数为 0 时，直接执行快刷
-          if (s_partial_refresh_count == 0) {
-            ESP_LOGI(TAG,
-                     "EPD refresh task: PARTIAL count=0, using FAST refresh");
-            EPD_4in26_Display(s_epd_framebuffer);
-            portENTER_CRITICAL(&s_dirty_mux);
-            s_dirty_valid = false;
-            portEXIT_CRITICAL(&s_dirty_mux);
-            s_partial_refresh_count++; // 从 1 开始计数
-            goto refresh_done;
-          }
+  // 一行的覆盖范围（精确到像素），按 framebuffer 的字节布局
+  uint32_t row_mask[EPD_WIDTH / 32] = {0};
+  uint8_t *rm = (uint8_t *)row_mask;
+  for (int32_t x = exact.x1; x <= exact.x2; x++) {
+    rm[(x - phys.x1) >> 3] |= (uint8_t)(0x80 >> (x & 7));
+  }
 
-          // 原子性地快照脏区，避免与 flush_cb 并发修改
-          bool dirty_valid;
-          lv_area_t dirty_area;
-          portENTER_CRITICAL(&s_dirty_mux);
-          dirty_valid = s_dirty_valid;
-          dirty_area = s_dirty_area;
-          portEXIT_CRITICAL(&s_dirty_mux);
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    ESP_LOGW(TAG, "Layer: failed to acquire mutex");
+    heap_caps_free(bits);
+    return false;
+  }
+  for (int32_t y = phys.y1; y <= phys.y2; y++) {
+    const uint32_t li = (uint32_t)(y - phys.y1) * words;
+    memcpy(&bits[li], s_fb_back + (uint32_t)y * (EPD_WIDTH / 8) + phys.x1 / 8,
+           words * sizeof(uint32_t));
+    for (uint16_t w = 0; w < words; w++) {
+      // 透明图层只取黑色像素（位为 0），合成即 fb &= bits
+      mask[li + w] = opaque ? row_mask[w] : (row_mask[w] & ~bits[li + w]);
+    }
+  }
+  xSemaphoreGive(s_epd_mutex);
 
-          if (!dirty_valid) {
-            ESP_LOGW(TAG, "EPD refresh task: PARTIAL requested but no dirty area, skipping");
-            goto partial_done;
-          }
+  lvgl_layer_release();
+  s_layer.bits = bits;
+  s_layer.mask = mask;
+  s_layer.area = logical;
+  s_layer.phys = phys;
+  s_layer.words = words;
+  s_layer.opaque = opaque;
+  s_layer.enabled = true;
+  s_layer.restore = false;
+  ESP_LOGI(TAG, "Layer captured: LVGL(%d,%d)-(%d,%d), %s, %u bytes", (int)logical.x1,
+           (int)logical.y1, (int)logical.x2, (int)logical.y2, opaque ? "opaque" : "overlay",
+           (unsigned)(2 * n * sizeof(uint32_t)));
+  return true;
+}
 
-          // 局部刷新：直接使用完整的 s_epd_framebuffer，只裁剪脏区发送给硬件
-          // 获取脏区尺寸
-          const int32_t dirty_w = dirty_area.x2 - dirty_area.x1 + 1;
-          const int32_t dirty_h = dirty_area.y2 - dirty_area.y1 + 1;
-
-          // LVGL 坐标系 (480x800) 到 EPD 物理坐标系 (800x480) 的映射
-          // ROTATE_270: LVGL(x,y) -> EPD(memX=y, memY=EPD_HEIGHT-1-x)
-          int32_t epd_x = dirty_area.y1;
-          int32_t epd_y = (int32_t)EPD_HEIGHT - 1 - dirty_area.x2;
-          int32_t epd_w = dirty_h; // 注意：宽高互换
-          int32_t epd_h = dirty_w;
-
-          // EPD 硬件要求：X 坐标必须是 8 的倍数（字节对齐）
-          if (epd_x % 8 != 0) {
-            const int32_t orig_x = epd_x;
-            epd_x = (epd_x / 8) * 8;   // 向下对齐
-            epd_w += (orig_x - epd_x); // 补偿宽度
-          }
-          if (epd_w % 8 != 0) {
-            epd_w = ((epd_w + 7) / 8) * 8; // 向上对齐
-          }
+void lvgl_layer_set_enabled(bool enable) {
+  if (s_layer.bits != NULL) {
+    s_layer.enabled = enable;
+  }
+}
 
-          // 边界检查
-          if (epd_x < 0)
-            epd_x = 0;
-          if (epd_y < 0)
-            epd_y = 0;
-          if (epd_x + epd_w > EPD_WIDTH)
-            epd_w = EPD_WIDTH - epd_x;
-          if (epd_y + epd_h > EPD_HEIGHT)
-            epd_h = EPD_HEIGHT - epd_y;
-
-          ESP_LOGI(TAG,
-                   "EPD refresh task: PARTIAL #%u/%u LVGL(%d,%d,%dx%d) -> "
-                   "EPD(x=%d,y=%d,%dx%d)",
-                   s_partial_refresh_count, FORCE_FULL_REFRESH_AFTER_N_PARTIAL,
-                   (int)dirty_area.x1, (int)dirty_area.y1, (int)dirty_w,
-                   (int)dirty_h, (int)epd_x, (int)epd_y, (int)epd_w,
-                   (int)epd_h);
-
-          // 从完整 framebuffer 裁剪脏区数据发送给硬件
-          if (epd_w > 0 && epd_h > 0) {
-            EPD_4in26_Display_Partial(s_epd_framebuffer, (UWORD)epd_x,
-                                      (UWORD)epd_y, (UWORD)epd_w, (UWORD)epd_h);
-          } else {
-            ESP_LOGW(TAG, "EPD refresh task: invalid area, fallback FAST");
-            EPD_4in26_Display_Fast(s_epd_framebuffer);
-          }
+void lvgl_layer_release(void) {
+  // 图层只在 LVGL 任务中读写（flush 与失效回调），无需加锁
+  heap_caps_free(s_layer.bits);
+  memset(&s_layer, 0, sizeof(s_layer));
+}
 
-          // 计数器递增，达到阈值后重置
-          s_partial_refresh_count++;
-          if (s_partial_refresh_count >= FORCE_FULL_REFRESH_AFTER_N_PARTIAL) {
-            ESP_LOGI(TAG,
-                     "EPD refresh task: Reached %u PARTIALs, resetting count",
-                     s_partial_refresh_count);
-            s_partial_refresh_count = 0;
-          }
+// 设置帧差分模式
+bool lvgl_set_frame_diff(epd_frame_diff_t mode) {
+  if (s_epd_mutex == NULL) {
+    ESP_LOGW(TAG, "Frame diff: display not initialized");
+    return false;
+  }
 
-        partial_done:
-          portENTER_CRITICAL(&s_dirty_mux);
-          s_dirty_valid = false;
-          portEXIT_CRITICAL(&s_dirty_mux);
-        } else {
-          ESP_LOGE(TAG, "EPD refresh task: Unknown mode %d, fallback to FAST",
-                   mode);
-          EPD_4in26_Display_Fast(s_epd_framebuffer);
-          s_partial_refresh_count = 0;
-          s_dirty_valid = false;
-        }
+  uint8_t *shadow = NULL;
+  if (mode == EPD_FRAME_DIFF_SHADOW && s_fb_shadow == NULL) {
+    shadow = (uint8_t *)heap_caps_malloc(sizeof(s_epd_framebuffer), MALLOC_CAP_8BIT);
+    if (shadow == NULL) {
+      ESP_LOGW(TAG, "Frame diff: no memory for shadow frame, using row hash");
+      mode = EPD_FRAME_DIFF_ROW_HASH;
+    }
+  }
 
-      refresh_done:
-        s_epd_refreshing = false;
-        s_render_done = false; // 重置，为下一次渲染做准备
-        ESP_LOGI(TAG, "EPD refresh task: complete, s_epd_refreshing=%d",
-                 s_epd_refreshing);
-        xSemaphoreGive(s_epd_mutex);
+  if (!lock_idle_refresh()) {
+    ESP_LOGW(TAG, "Frame diff: timed out waiting for EPD refresh");
+    heap_caps_free(shadow);
+    return false;
+  }
 
-      } else {
-        ESP_LOGW(TAG, "Failed to acquire mutex for refresh");
-        s_epd_refreshing = false;
-        s_render_done = false;
-      }
-    }
+  uint8_t *old_shadow = NULL;
+  if (mode != EPD_FRAME_DIFF_SHADOW) {
+    old_shadow = s_fb_shadow;
+    s_fb_shadow = NULL;
+  } else if (shadow != NULL) {
+    s_fb_shadow = shadow;
   }
+  if (mode != s_frame_diff) {
+    // 影子内容需等下一次整帧刷新后才与面板一致
+    s_frame_diff_valid = false;
+  }
+  s_frame_diff = mode;
+  xSemaphoreGive(s_epd_mutex);
+
+  heap_caps_free(old_shadow);
+  ESP_LOGI(TAG, "Frame diff mode set to %d", (int)mode);
+  return true;
 }
 
-// 刷新 EPD - 使用当前配置的模式
-void lvgl_display_refresh(void) { queue_refresh_request(s_refresh_mode); }
+// 与帧差分基准（面板上次显示的内容）逐行比较，统计变化的行
+void lvgl_invalidate_focus(lv_obj_t *from, lv_obj_t *to) {
+  lv_obj_t *const objs[FOCUS_RECT_MAX] = {from, to != from ? to : NULL};
+  lv_area_t rects[FOCUS_RECT_MAX];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < FOCUS_RECT_MAX; i++) {
+    if (objs[i] == NULL) {
+      continue;
+    }
+    // 与 lv_obj_invalidate 的范围一致：对象区域加上扩展绘制区（阴影、轮廓）
+    lv_area_t area;
+    lv_obj_get_coords(objs[i], &area);
+    const int32_t ext = lv_obj_get_ext_draw_size(objs[i]);
+    lv_area_increase(&area, ext, ext);
+    if (dirty_to_physical(&area, &rects[n])) {
+      n++;
+    }
+    lv_obj_invalidate(objs[i]);
+  }
 
-// 局部刷新 EPD
-void lvgl_display_refresh_partial(void) {
-  queue_refresh_request(EPD_REFRESH_PARTIAL);
+  portENTER_CRITICAL(&s_dirty_mux);
+  for (uint8_t i = 0; i < n; i++) {
+    // 相邻的两行合成一个窗口不多传像素；已经登记过的行（连续移动焦点）直接并入
+    bool merged = false;
+    for (uint8_t j = 0; j < s_focus_count && !merged; j++) {
+      if (dirty_merge_cost(&rects[i], &s_focus_rects[j]) < DIRTY_MERGE_COST_PX) {
+        lv_area_join(&s_focus_rects[j], &s_focus_rects[j], &rects[i]);
+        merged = true;
+      }
+    }
+    if (merged) {
+      continue;
+    }
+    if (s_focus_count < FOCUS_RECT_MAX) {
+      s_focus_rects[s_focus_count++] = rects[i];
+    } else if (s_dirty_count < DIRTY_RECT_MAX) {
+      // 上一次的焦点行还没刷出去（面板忙时连按）：多出的行按普通脏区处理
+      s_dirty_rects[s_dirty_count++] = rects[i];
+    } else {
+      lv_area_join(&s_dirty_rects[0], &s_dirty_rects[0], &rects[i]);
+    }
+  }
+  portEXIT_CRITICAL(&s_dirty_mux);
 }
 
-// 快速刷新 EPD
-void lvgl_display_refresh_fast(void) {
-  queue_refresh_request(EPD_REFRESH_FAST);
+int lvgl_fb_changed_percent(void) {
+  if (s_epd_mutex == NULL || s_gray_mode || s_frame_diff == EPD_FRAME_DIFF_OFF ||
+      !s_frame_diff_valid) {
+    return -1;
+  }
+  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return -1;
+  }
+  const uint32_t stride = EPD_WIDTH / 8;
+  const uint8_t *fb = s_fb_back;
+  uint32_t changed = 0;
+  for (uint32_t y = 0; y < EPD_HEIGHT; y++) {
+    const uint8_t *row = fb + y * stride;
+    if (s_fb_shadow != NULL ? memcmp(row, s_fb_shadow + y * stride, stride) != 0
+                            : fb_row_hash(row) != s_row_hash[y]) {
+      changed++;
+    }
+  }
+  xSemaphoreGive(s_epd_mutex);
+  return (int)(changed * 100 / EPD_HEIGHT);
 }
 
-// 全刷 EPD
-void lvgl_display_refresh_full(void) {
-  queue_refresh_request(EPD_REFRESH_FULL);
-}
+bool lvgl_set_render_strategy(epd_render_strategy_t strategy, uint16_t band_lines) {
+  if (g_lv_display == NULL) {
+    ESP_LOGW(TAG, "Render strategy: display not initialized");
+    return false;
+  }
+  if (band_lines == 0) {
+    band_lines = DISP_BUF_LINES;
+  }
+  if (band_lines > DISP_VER_RES) {
+    band_lines = DISP_VER_RES;
+  }
+  if (strategy == EPD_RENDER_DIRECT) {
+    band_lines = DISP_VER_RES;
+  }
+  if (strategy == s_render_strategy && band_lines == s_band_lines) {
+    return true;
+  }
 
-// 设置刷新模式
-void lvgl_set_refresh_mode(epd_refresh_mode_t mode) {
-  s_refresh_mode = mode;
+  const uint32_t size = (strategy == EPD_RENDER_DIRECT)
+                            ? DISP_DIRECT_BUF_SIZE
+                            : DISP_I1_STRIDE * band_lines + 8;
+  const bool use_static = (strategy != EPD_RENDER_DIRECT) && size <= sizeof(s_lvgl_draw_buffer);
+  uint8_t *buf = s_lvgl_draw_buffer;
+  uint8_t *buf2 = NULL;
+  if (!use_static) {
+    buf = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+  }
+  if (buf != NULL && strategy == EPD_RENDER_BANDS_DOUBLE) {
+    buf2 = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+  }
+  if (buf == NULL || (strategy == EPD_RENDER_BANDS_DOUBLE && buf2 == NULL)) {
+    ESP_LOGW(TAG, "Render strategy %d/%u lines: no memory for %u bytes (largest free=%u)",
+             (int)strategy, (unsigned)band_lines, (unsigned)size,
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    if (!use_static) {
+      heap_caps_free(buf);
+    }
+    return false;
+  }
 
-  switch (mode) {
-  case EPD_REFRESH_PARTIAL:
-    ESP_LOGI(TAG, "Refresh mode set to PARTIAL (fastest, may have ghosting)");
-    break;
-  case EPD_REFRESH_FAST:
-    ESP_LOGI(TAG, "Refresh mode set to FAST (balanced)");
-    break;
-  case EPD_REFRESH_FULL:
-    ESP_LOGI(TAG, "Refresh mode set to FULL (clearest)");
-    break;
+  uint8_t *old_buf = (s_draw_buf != s_lvgl_draw_buffer) ? s_draw_buf : NULL;
+  uint8_t *old_buf2 = s_draw_buf2;
+  s_draw_buf = buf;
+  s_draw_buf2 = buf2;
+  s_draw_buf_size = size;
+  s_render_strategy = strategy;
+  s_band_lines = band_lines;
+  render_buffers_apply();
+  lv_obj_t *scr = lv_display_get_screen_active(g_lv_display);
+  if (scr != NULL) {
+    lv_obj_invalidate(scr);
   }
+
+  // 新缓冲区已交给 LVGL，旧缓冲区不再被引用
+  heap_caps_free(old_buf);
+  heap_caps_free(old_buf2);
+
+  const uint32_t total = (use_static ? 0 : size) + (buf2 != NULL ? size : 0);
+  ESP_LOGI(TAG, "Render strategy %s, %u lines per band, %u bytes from heap",
+           strategy == EPD_RENDER_DIRECT         ? "direct"
+           : strategy == EPD_RENDER_BANDS_DOUBLE ? "double bands"
+                                                 : "bands",
+           (unsigned)band_lines, (unsigned)total);
+  return true;
 }
 
-// 获取当前刷新模式
-epd_refresh_mode_t lvgl_get_refresh_mode(void) { return s_refresh_mode; }
+epd_render_strategy_t lvgl_get_render_strategy(void) { return s_render_strategy; }
 
-// 检查 EPD 是否正在刷新
-bool lvgl_is_refreshing(void) { return s_epd_refreshing; }
+uint16_t lvgl_get_render_band_lines(void) { return s_band_lines; }
 
-// 重置刷新状态
-void lvgl_reset_refresh_state(void) {
+bool lvgl_set_landscape(bool landscape) {
+  if (g_lv_display == NULL || s_epd_mutex == NULL) {
+    ESP_LOGW(TAG, "Landscape: display not initialized");
+    return false;
+  }
+  if (landscape == s_native) {
+    return true;
+  }
+
+  // 已记录的脏区是旧方向的逻辑坐标，上传中的帧按旧方向合成，等它结束再切换
+  if (!lock_idle_refresh()) {
+    ESP_LOGW(TAG, "Landscape: timed out waiting for EPD refresh");
+    return false;
+  }
+  s_native = landscape;
   portENTER_CRITICAL(&s_dirty_mux);
-  s_dirty_valid = false;
+  dirty_clear();
   portEXIT_CRITICAL(&s_dirty_mux);
-  s_partial_refresh_count = 0;
+  xSemaphoreGive(s_epd_mutex);
 
-  // 清空刷新队列，丢弃所有待处理的刷新请求
-  // 这对于屏幕切换很重要：旧屏幕的 PARTIAL 刷新请求不应该污染新屏幕
-  if (s_refresh_queue != NULL) {
-    xQueueReset(s_refresh_queue);
-    ESP_LOGI(TAG, "Cleared refresh queue during reset");
+  // 图层的逻辑区域随方向失效；静态分带缓冲区按新的行宽保持同样的行数
+  lvgl_layer_release();
+  if (s_render_strategy != EPD_RENDER_DIRECT && s_draw_buf == s_lvgl_draw_buffer) {
+    s_draw_buf_size = DISP_I1_STRIDE * s_band_lines + 8;
+  }
+  lv_display_set_resolution(g_lv_display, DISP_HOR_RES, DISP_VER_RES);
+  render_buffers_apply();
+  lv_obj_t *scr = lv_display_get_screen_active(g_lv_display);
+  if (scr != NULL) {
+    lv_obj_invalidate(scr);
   }
 
-  ESP_LOGI(TAG, "Refresh state reset (dirty_valid=%d, partial_count=%u)",
-           s_dirty_valid, s_partial_refresh_count);
+  ESP_LOGI(TAG, "Display orientation: %s (%dx%d)", landscape ? "landscape" : "portrait",
+           (int)DISP_HOR_RES, (int)DISP_VER_RES);
+  return true;
 }
 
-// 清空 framebuffer 为白色
-void lvgl_clear_framebuffer(void) {
-  if (xSemaphoreTake(s_epd_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-    memset(s_epd_framebuffer, 0xFF, sizeof(s_epd_framebuffer));
-    xSemaphoreGive(s_epd_mutex);
-    ESP_LOGI(TAG, "Framebuffer cleared to white");
+bool lvgl_is_landscape(void) { return s_native; }
+
+// 设置灰阶策略
+void lvgl_set_gray_policy(epd_gray_policy_t policy) {
+  s_gray_policy = policy;
+  ESP_LOGI(TAG, "Gray policy set to %d", (int)policy);
+}
+
+// 获取灰阶策略
+epd_gray_policy_t lvgl_get_gray_policy(void) { return s_gray_policy; }
+
+// 检查是否处于灰阶渲染模式
+bool lvgl_is_grayscale(void) { return s_gray_mode; }
+
+// 按内容类型与策略切换渲染格式
+bool lvgl_set_content_hint(epd_content_t content) {
+  const bool want = (s_gray_policy == EPD_GRAY_POLICY_ALWAYS) ||
+                    (s_gray_policy == EPD_GRAY_POLICY_IMAGES && content == EPD_CONTENT_IMAGE);
+  if (want == s_gray_mode) {
+    return s_gray_mode;
+  }
+  if (g_lv_display == NULL || s_epd_mutex == NULL) {
+    ESP_LOGW(TAG, "Grayscale: display not initialized");
+    return false;
+  }
+  if (want && s_double_buffer) {
+    ESP_LOGW(TAG, "Grayscale: disabled while double buffer is active");
+    return false;
+  }
+  if (want && !EPD_4in26_HasCap(EPD_PANEL_CAP_4GRAY)) {
+    ESP_LOGW(TAG, "Grayscale: panel does not support 4-gray");
+    return false;
+  }
+
+  uint8_t *plane = NULL;
+  if (want) {
+    plane = (uint8_t *)heap_caps_malloc(sizeof(s_epd_framebuffer),
+                                        MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    if (plane == NULL) {
+      ESP_LOGW(TAG, "Grayscale: no memory for second plane (largest free=%u)",
+               (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+      return false;
+    }
+  }
+
+  // 刷新任务上传期间不能替换或释放位平面
+  if (!lock_idle_refresh()) {
+    ESP_LOGW(TAG, "Grayscale: timed out waiting for EPD refresh");
+    heap_caps_free(plane);
+    return s_gray_mode;
+  }
+
+  uint8_t *old_plane = s_fb_gray_hi;
+  if (want) {
+    s_fb_gray_hi = plane;
+    memset(s_fb_back, 0x00, sizeof(s_epd_framebuffer));
+    memset(s_fb_gray_hi, 0x00, sizeof(s_epd_framebuffer));
+    old_plane = NULL;
   } else {
-    ESP_LOGW(TAG, "Failed to acquire mutex for clearing framebuffer");
+    s_fb_gray_hi = NULL;
+    memset(s_fb_back, 0xFF, sizeof(s_epd_framebuffer));
+  }
+  s_gray_mode = want;
+  s_frame_diff_valid = false;
+  s_partial_needs_base = true;
+  portENTER_CRITICAL(&s_dirty_mux);
+  dirty_clear();
+  portEXIT_CRITICAL(&s_dirty_mux);
+  xSemaphoreGive(s_epd_mutex);
+
+  // 同一块绘制缓冲区按新格式重新划分行数（静态缓冲区 L8 约 25 行，
+  // DIRECT 的整帧缓冲区在灰阶下改作约 100 行的 L8 分带）
+  render_buffers_apply();
+  lv_obj_t *scr = lv_display_get_screen_active(g_lv_display);
+  if (scr != NULL) {
+    lv_obj_invalidate(scr);
   }
+
+  heap_caps_free(old_plane);
+  ESP_LOGI(TAG, "Grayscale render %s", want ? "enabled (L8 -> 4-gray planes, +48 KB)" : "disabled");
+  return s_gray_mode;
 }
 
 /* ========================================================================
@@ -682,7 +2692,9 @@ void lvgl_clear_framebuffer(void) {
 
 // 按键防抖配置
 #define KEY_REPEAT_DELAY_MS 300  // 按住后首次重复的延迟
-#define KEY_REPEAT_PERIOD_MS 150 // 之后每次重复的周期
+#define KEY_REPEAT_PERIOD_MS 150 // 首个重复周期
+#define KEY_REPEAT_ACCEL_PCT 85  // 每次重复后周期缩短为原来的百分比（长按加速）
+#define KEY_REPEAT_MIN_MS 40     // 加速后的最短周期
 
 // 双击检测配置
 #define DOUBLE_CLICK_TIMEOUT_MS 400  // 双击时间窗口（毫秒）
@@ -694,6 +2706,7 @@ typedef struct {
   lv_point_t point;             // 用于模拟触摸位置（可选）
   uint32_t press_time_ms;       // 按键首次按下的时间
   uint32_t last_repeat_time_ms; // 上次重复事件的时间
+  uint32_t repeat_period_ms;    // 当前重复周期（随重复次数缩短）
   // 双击检测状态
   button_t last_back_key;       // 上次返回键
   uint32_t last_back_release_ms;// 上次返回键释放时间
@@ -705,10 +2718,38 @@ static button_state_t btn_state = {.last_key = BTN_NONE,
                                    .point = {0, 0},
                                    .press_time_ms = 0,
                                    .last_repeat_time_ms = 0,
+                                   .repeat_period_ms = KEY_REPEAT_PERIOD_MS,
                                    .last_back_key = BTN_NONE,
                                    .last_back_release_ms = 0,
                                    .back_key_double_clicked = false};
 
+// 事件驱动输入：按键任务（buttons.c）把消抖后的按下/释放放入队列并唤醒定时器任务，
+// 定时器任务每取出一个事件调用一次 lv_indev_read()；只有按住期间才定时调用（长按重复）
+#define KEY_POLL_HELD_MS 20   // 按住时调用 lv_indev_read() 的周期（长按重复）
+#define KEY_IDLE_CHECK_MS 500 // 无按键也无 LVGL 定时器时的最长睡眠（空闲浅睡眠检查）
+
+static lv_indev_t *s_keypad_indev = NULL;
+static button_t s_polled_btn = BTN_NONE; // 最近一个按键事件对应的状态
+
+// 按键快速通道（lvgl_set_key_hook）：各屏幕登记自己的钩子，按下时交给活动屏幕的钩子；
+// 被接管的键按住期间由定时器任务直接产生重复，松开时再通知同一个钩子
+typedef struct {
+  lv_obj_t *screen;
+  lvgl_key_hook_t hook;
+} key_hook_slot_t;
+
+static key_hook_slot_t s_key_hooks[LVGL_KEY_HOOK_SLOTS];
+static lvgl_key_hook_t s_fast_hook = NULL; // 接管当前按住的键的钩子
+static button_t s_fast_btn = BTN_NONE;     // 快速通道正按住的键
+static uint32_t s_fast_next_repeat_ms = 0;
+static uint32_t s_fast_period_ms = KEY_REPEAT_PERIOD_MS;
+static TaskHandle_t s_lvgl_task_handle = NULL;
+
+// 长按电源键（lvgl_set_power_hold_handler）：按下时刻为 0 表示未按住或本次已触发
+static void (*s_power_hold_handler)(void) = NULL;
+static uint32_t s_power_hold_ms = 0;
+static uint32_t s_power_down_ms = 0;
+
 // LVGL keypad expects the last key to be reported even on RELEASED.
 // If key is cleared to 0 too early, some widgets/group navigation may not
 // receive KEY events reliably.
@@ -723,6 +2764,12 @@ void lvgl_clear_back_key_double_click(void) {
   btn_state.back_key_double_clicked = false;
 }
 
+// 长按加速：每次重复后缩短周期，直到 KEY_REPEAT_MIN_MS
+static uint32_t key_repeat_next_period(uint32_t period_ms) {
+  const uint32_t next = period_ms * KEY_REPEAT_ACCEL_PCT / 100;
+  return next < KEY_REPEAT_MIN_MS ? KEY_REPEAT_MIN_MS : next;
+}
+
 // 按键映射辅助函数：将物理按键映射为LVGL按键
 static uint32_t map_button_to_lvgl_key(button_t btn) {
   switch (btn) {
@@ -747,7 +2794,7 @@ static uint32_t map_button_to_lvgl_key(button_t btn) {
 
 // 输入设备读取回调 - LVGL 9.x
 static void keypad_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
-  button_t btn = get_pressed_button();
+  button_t btn = s_polled_btn;
 
   if (btn != BTN_NONE && btn != btn_state.last_key) {
     // 新按键按下
@@ -755,13 +2802,18 @@ static void keypad_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
     btn_state.last_key = btn;
     btn_state.press_time_ms = 0;
     btn_state.last_repeat_time_ms = 0;
+    btn_state.repeat_period_ms = KEY_REPEAT_PERIOD_MS;
 
     uint32_t key = map_button_to_lvgl_key(btn);
     data->key = key;
     data->state = LV_INDEV_STATE_PRESSED;
     s_last_lvgl_key = key;
 
-    ESP_LOGI(TAG, "Key pressed: btn=%d -> lvgl_key=%u", btn, key);
+    TRACE_EVENT(TRACE_EV_KEY, btn, key);
+    // 控制器休眠时立即开始复位/初始化，与本次按键触发的渲染并行
+    lvgl_display_wake();
+    power_manager_notify_activity();
+    TRACE_LOGI(LVGL, TAG, "Key pressed: btn=%d -> lvgl_key=%u", btn, key);
   } else if (btn == BTN_NONE && btn_state.pressed) {
     // 按键释放
     btn_state.pressed = false;
@@ -796,9 +2848,10 @@ static void keypad_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
       btn_state.press_time_ms = now;
       btn_state.last_repeat_time_ms = now;
       should_repeat = true;
-    } else if ((now - btn_state.last_repeat_time_ms) >= KEY_REPEAT_PERIOD_MS &&
+    } else if ((now - btn_state.last_repeat_time_ms) >= btn_state.repeat_period_ms &&
                (now - btn_state.press_time_ms) >= KEY_REPEAT_DELAY_MS) {
       btn_state.last_repeat_time_ms = now;
+      btn_state.repeat_period_ms = key_repeat_next_period(btn_state.repeat_period_ms);
       should_repeat = true;
     }
 
@@ -850,6 +2903,10 @@ lv_indev_t *lvgl_input_init(void) {
   lv_indev_t *indev = lv_indev_create();
   lv_indev_set_type(indev, LV_INDEV_TYPE_KEYPAD);
   lv_indev_set_read_cb(indev, keypad_read_cb);
+  // 事件模式：由 lvgl_timer_task 在按键状态变化时调用 lv_indev_read()
+  lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+  s_keypad_indev = indev;
+  buttons_set_listener(lvgl_timer_task_wake);
 
   ESP_LOGI(TAG, "LVGL input driver initialized (UP/DOWN mapped to PREV/NEXT "
                 "for lv_group)");
@@ -857,37 +2914,231 @@ lv_indev_t *lvgl_input_init(void) {
   return indev;
 }
 
-// LVGL tick任务
-void lvgl_tick_task(void *arg) {
-  while (1) {
-    vTaskDelay(pdMS_TO_TICKS(10));
-    lv_tick_inc(10);
+static key_hook_slot_t *key_hook_find(const lv_obj_t *screen) {
+  for (int i = 0; i < LVGL_KEY_HOOK_SLOTS; i++) {
+    if (s_key_hooks[i].screen == screen) {
+      return &s_key_hooks[i];
+    }
+  }
+  return NULL;
+}
+
+// 活动屏幕的钩子：直接建在活动屏幕上、没有隐藏的覆盖层（阅读器）优先于屏幕本身
+static key_hook_slot_t *key_hook_for_active(void) {
+  lv_obj_t *active = lv_screen_active();
+  key_hook_slot_t *found = NULL;
+  for (int i = 0; i < LVGL_KEY_HOOK_SLOTS; i++) {
+    lv_obj_t *obj = s_key_hooks[i].screen;
+    if (obj == NULL) {
+      continue;
+    }
+    if (obj == active) {
+      found = &s_key_hooks[i];
+    } else if (lv_obj_get_parent(obj) == active && !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+      return &s_key_hooks[i];
+    }
+  }
+  return found;
+}
+
+// 注销钩子；它正接管按住的键时，之后的重复与松开不再送给它
+static void key_hook_remove(key_hook_slot_t *slot) {
+  if (s_fast_hook == slot->hook) {
+    s_fast_hook = NULL;
+    s_fast_btn = BTN_NONE;
+  }
+  slot->screen = NULL;
+  slot->hook = NULL;
+}
+
+static void key_hook_screen_delete_cb(lv_event_t *e) {
+  key_hook_slot_t *slot = key_hook_find(lv_event_get_current_target(e));
+  if (slot != NULL) {
+    key_hook_remove(slot);
+  }
+}
+
+void lvgl_set_key_hook(lv_obj_t *screen, lvgl_key_hook_t hook) {
+  if (screen == NULL) {
+    return;
+  }
+  key_hook_slot_t *slot = key_hook_find(screen);
+  if (hook == NULL) {
+    if (slot != NULL) {
+      key_hook_remove(slot);
+    }
+    return;
+  }
+  if (slot == NULL) {
+    slot = key_hook_find(NULL);
+    if (slot == NULL) {
+      ESP_LOGW(TAG, "No free key hook slot");
+      return;
+    }
+    slot->screen = screen;
+    lv_obj_add_event_cb(screen, key_hook_screen_delete_cb, LV_EVENT_DELETE, NULL);
+  }
+  slot->hook = hook;
+}
+
+void lvgl_get_key_latency(bool fast_path, lvgl_key_latency_t *out) {
+  portENTER_CRITICAL(&s_key_latency_mux);
+  const key_latency_acc_t acc = s_key_latency[fast_path ? 1 : 0];
+  portEXIT_CRITICAL(&s_key_latency_mux);
+  out->samples = acc.samples;
+  out->last_ms = acc.last_ms;
+  out->avg_ms = acc.samples > 0 ? (uint32_t)(acc.sum_ms / acc.samples) : 0;
+  out->max_ms = acc.max_ms;
+}
+
+static void key_latency_arm(uint32_t press_ms, bool fast) {
+  portENTER_CRITICAL(&s_key_latency_mux);
+  s_key_latency_armed = true;
+  s_key_latency_fast = fast;
+  s_key_latency_press_ms = press_ms;
+  portEXIT_CRITICAL(&s_key_latency_mux);
+}
+
+// 快速通道：返回 true 表示事件已被钩子处理，不再送入 LVGL 输入设备
+static bool key_fast_path(const button_event_t *ev) {
+  if (!ev->pressed) {
+    if (s_fast_btn != BTN_NONE && ev->button == s_fast_btn) {
+      const lvgl_key_hook_t hook = s_fast_hook;
+      s_fast_btn = BTN_NONE;
+      s_fast_hook = NULL;
+      if (hook != NULL) {
+        hook(ev->button, LVGL_KEY_RELEASE);
+      }
+      return true;
+    }
+    return false;
+  }
+  // LVGL 输入设备还有按住的键时不插队，保持按下/释放成对
+  const key_hook_slot_t *slot = key_hook_for_active();
+  if (slot == NULL || btn_state.pressed) {
+    return false;
+  }
+  const lvgl_key_hook_t hook = slot->hook;
+  // 与 keypad_read_cb 的按下分支相同：先预热面板，与翻页渲染并行
+  lvgl_display_wake();
+  power_manager_notify_activity();
+  if (!hook(ev->button, LVGL_KEY_PRESS)) {
+    return false;
+  }
+  TRACE_EVENT(TRACE_EV_KEY, ev->button, 0);
+  TRACE_LOGI(LVGL, TAG, "Key pressed: btn=%d -> fast path", ev->button);
+  s_fast_hook = hook;
+  s_fast_btn = ev->button;
+  s_fast_next_repeat_ms = lv_tick_get() + KEY_REPEAT_DELAY_MS;
+  s_fast_period_ms = KEY_REPEAT_PERIOD_MS;
+  return true;
+}
+
+// 快速通道按住的键：与 keypad_read_cb 相同的重复延迟与加速
+static void key_fast_repeat(void) {
+  const uint32_t now = lv_tick_get();
+  if (s_fast_btn == BTN_NONE || s_fast_hook == NULL ||
+      (int32_t)(now - s_fast_next_repeat_ms) < 0) {
+    return;
+  }
+  s_fast_next_repeat_ms = now + s_fast_period_ms;
+  s_fast_period_ms = key_repeat_next_period(s_fast_period_ms);
+  power_manager_notify_activity();
+  s_fast_hook(s_fast_btn, LVGL_KEY_REPEAT);
+}
+
+void lvgl_set_power_hold_handler(uint32_t hold_ms, void (*handler)(void)) {
+  s_power_hold_ms = hold_ms;
+  s_power_hold_handler = handler;
+}
+
+// 电源键不映射为 LVGL 按键，按住超过设定时间调用一次处理函数
+static void key_power_track(const button_event_t *ev) {
+  if (ev->button == BTN_POWER) {
+    s_power_down_ms = ev->pressed ? (ev->time_ms != 0 ? ev->time_ms : 1) : 0;
+  }
+}
+
+static void key_power_hold(void) {
+  if (s_power_down_ms == 0 || s_power_hold_handler == NULL ||
+      lv_tick_get() - s_power_down_ms < s_power_hold_ms) {
+    return;
+  }
+  s_power_down_ms = 0;
+  ESP_LOGI(TAG, "Power key held %u ms", (unsigned)s_power_hold_ms);
+  s_power_hold_handler();
+}
+
+void lvgl_timer_task_wake(void) {
+  if (s_lvgl_task_handle != NULL) {
+    xTaskNotifyGive(s_lvgl_task_handle);
   }
 }
 
-// LVGL定时器任务 - 手动刷新模式
-// 对于 EPD，我们仍然需要定期调用 lv_timer_handler() 来处理输入事件
-// 但渲染是手动的，由 lv_refr_now() 触发
+// LVGL定时器任务 - 手动刷新模式、事件驱动
+// 渲染是手动的（lvgl_trigger_render），这里只负责按键事件、LVGL 定时器与空闲功耗。
+// 每轮之后一直睡到下一个 LVGL 定时器到期，按键任务和其他任务用
+// lvgl_timer_task_wake() 提前唤醒
 void lvgl_timer_task(void *arg) {
-  ESP_LOGI(TAG, "LVGL timer task started (manual refresh mode for EPD)");
+  ESP_LOGI(TAG, "LVGL timer task started (event-driven, manual refresh for EPD)");
+  stack_stats_register_self("lvgl_timer", LVGL_TIMER_TASK_STACK);
+  s_lvgl_task_handle = xTaskGetCurrentTaskHandle();
 
   while (1) {
-    // 使用 lv_timer_handler_run_in_period() 替代直接调用 lv_timer_handler()
-    // 这个函数会确保在指定时间内完成处理，避免长时间阻塞导致看门狗超时
-    //
-    // 参数 2 表示最多运行 2ms，然后返回，让其他任务有机会运行
-    // 这对于 EPD 这种慢速显示设备尤其重要，因为渲染操作可能耗时较长
-    //
-    // 该函数处理：
-    // 1. 输入设备读取和事件分发
-    // 2. 动画和定时器
-    // 3. 焦点管理
-    // 但不会自动触发渲染（需要调用 lv_refr_now()）
-    lv_timer_handler_run_in_period(2);
+    // 按键事件先交给快速通道，其余逐个交给 LVGL（快速点按的按下与释放各读一次，
+    // 不会合并丢失）；没有新事件但仍按住时也读一次，驱动长按重复
+    if (s_keypad_indev != NULL) {
+      bool delivered = false;
+      button_event_t ev;
+      while (buttons_get_event(&ev, 0)) {
+        key_power_track(&ev);
+        if (ev.pressed) {
+          turn_stats_key(ev.time_ms);
+        }
+        const bool fast = key_fast_path(&ev);
+        if (ev.pressed) {
+          key_latency_arm(ev.time_ms, fast);
+        }
+        if (fast) {
+          continue;
+        }
+        s_polled_btn = ev.pressed ? ev.button : BTN_NONE;
+        lv_indev_read(s_keypad_indev);
+        delivered = true;
+      }
+      if (!delivered && s_polled_btn != BTN_NONE) {
+        lv_indev_read(s_keypad_indev);
+      }
+      key_fast_repeat();
+      key_power_hold();
+    }
+
+    // 处理到期的定时器（动画、界面定时器、display_bench 等），返回下一个到期时间
+    uint32_t sleep_ms = lv_timer_handler();
 
-    // 关键：必须调用 vTaskDelay 让出 CPU，确保 idle 任务能运行并喂狗
-    // 这个延迟不能省略，否则 idle 任务会饥饿导致看门狗超时
-    vTaskDelay(1);
+    // 渲染中不能使区域失效：丢弃的帧在这里整屏重绘，写完后放行扣住的刷新请求
+    if (s_frame_redraw) {
+      s_frame_redraw = false;
+      lv_obj_invalidate(lv_screen_active());
+      sleep_ms = 0;
+    }
+
+    // 空闲足够久且面板已休眠时让芯片进入浅睡眠；睡过一轮后立即重新采样按键
+    if (power_manager_idle_hook()) {
+      continue;
+    }
+
+    const bool held = s_polled_btn != BTN_NONE || s_fast_btn != BTN_NONE;
+    const uint32_t poll_ms = held ? KEY_POLL_HELD_MS : KEY_IDLE_CHECK_MS;
+    if (sleep_ms > poll_ms) {
+      sleep_ms = poll_ms;  // 也覆盖 LV_NO_TIMER_READY
+    }
+    // 至少让出 1 tick，确保 idle 任务能运行并喂狗
+    TickType_t ticks = pdMS_TO_TICKS(sleep_ms);
+    if (ticks == 0) {
+      ticks = 1;
+    }
+    ulTaskNotifyTake(pdTRUE, ticks);
   }
 }
 
@@ -896,6 +3147,65 @@ void lvgl_timer_task(void *arg) {
  * 用于通过文件路径加载图片和字体
  * ========================================================================*/
 
+// 读预取：每个只读打开的文件最多 LVGL_FS_RA_BLOCKS 个按块大小对齐的缓存块（LRU），
+// 图片解码器的小读取和来回 seek 都在块内完成，SD 卡只看到整块读取。
+// seek 只改逻辑位置，块按文件偏移寻址，跳回已缓存的区域不会重新读卡；写入使所有块失效。
+// 不小于一块的读取直接读入调用者缓冲区。LVGL 自带的 lv_fs 缓存（cache_size）保持关闭
+typedef struct {
+  uint32_t start;   // 块在文件中的偏移（块大小对齐）
+  uint32_t len;     // 有效字节数，0 = 空（文件末尾的块可能不满）
+  uint32_t stamp;   // 最近使用序号
+  uint8_t *data;    // 首次使用时分配
+} fs_ra_block_t;
+
+typedef struct {
+  FILE *fp;
+  uint32_t pos;     // 逻辑位置（命中缓存时不移动底层文件指针）
+  uint32_t size;
+  uint32_t seq;
+  uint32_t sd_reads;
+  fs_ra_block_t blocks[LVGL_FS_RA_BLOCKS];
+} fs_file_t;
+
+static void fs_ra_invalidate(fs_file_t *f) {
+  for (int i = 0; i < LVGL_FS_RA_BLOCKS; i++) {
+    f->blocks[i].len = 0;
+  }
+}
+
+// 从 SD 卡读取 [pos, pos + len)
+static size_t fs_sd_read(fs_file_t *f, uint32_t pos, void *dst, size_t len) {
+  spi_arbiter_sd_begin();
+  size_t n = 0;
+  if (fseek(f->fp, (long)pos, SEEK_SET) == 0) {
+    n = fread(dst, 1, len, f->fp);
+  }
+  spi_arbiter_sd_end();
+  f->sd_reads++;
+  return n;
+}
+
+// 读入包含 pos 的块（替换空块或最久未用的块）
+static fs_ra_block_t *fs_ra_load(fs_file_t *f, uint32_t pos) {
+  fs_ra_block_t *victim = &f->blocks[0];
+  for (int i = 1; i < LVGL_FS_RA_BLOCKS && victim->len > 0; i++) {
+    if (f->blocks[i].len == 0 || f->blocks[i].stamp < victim->stamp) {
+      victim = &f->blocks[i];
+    }
+  }
+
+  if (victim->data == NULL) {
+    victim->data = malloc(LVGL_FS_RA_BLOCK_SIZE);
+    if (victim->data == NULL) {
+      return NULL;
+    }
+  }
+  victim->start = pos - pos % LVGL_FS_RA_BLOCK_SIZE;
+  victim->len = (uint32_t)fs_sd_read(f, victim->start, victim->data, LVGL_FS_RA_BLOCK_SIZE);
+  victim->stamp = ++f->seq;
+  return (victim->len > pos - victim->start) ? victim : NULL;
+}
+
 // 文件系统驱动：打开文件
 static void *fs_open_cb(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode) {
   (void)drv;
@@ -905,15 +3215,25 @@ static void *fs_open_cb(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode) {
   // 例如: "S:/壁纸/锤子灯.jpg" -> path="/壁纸/锤子灯.jpg"
   snprintf(real_path, sizeof(real_path), "/sdcard%s", path);
 
-  const char *fmode = (mode == LV_FS_MODE_WR) ? "wb" : "rb";
-  FILE *f = fopen(real_path, fmode);
-
+  fs_file_t *f = calloc(1, sizeof(fs_file_t));
   if (f == NULL) {
+    return NULL;
+  }
+  const char *fmode = (mode == LV_FS_MODE_WR) ? "wb" : "rb";
+  f->fp = (mode == LV_FS_MODE_WR) ? fopen(real_path, fmode) : file_pool_fopen(real_path);
+  if (f->fp == NULL) {
     ESP_LOGE(TAG, "Failed to open file: %s (mode=%s)", real_path, fmode);
-  } else {
-    ESP_LOGD(TAG, "Opened file: %s", real_path);
+    free(f);
+    return NULL;
   }
 
+  // 读取由上面的块缓存合并，stdio 缓冲只会多一次拷贝
+  setvbuf(f->fp, NULL, _IONBF, 0);
+  if (mode != LV_FS_MODE_WR && fseek(f->fp, 0, SEEK_END) == 0) {
+    const long size = ftell(f->fp);
+    f->size = size > 0 ? (uint32_t)size : 0;
+  }
+  ESP_LOGD(TAG, "Opened file: %s (%u bytes)", real_path, (unsigned)f->size);
   return f;
 }
 
@@ -923,7 +3243,13 @@ static lv_fs_res_t fs_close_cb(lv_fs_drv_t *drv, void *file) {
   if (file == NULL) {
     return LV_FS_RES_INV_PARAM;
   }
-  fclose((FILE *)file);
+  fs_file_t *f = (fs_file_t *)file;
+  ESP_LOGD(TAG, "Closed file: %u bytes, %u SD reads", (unsigned)f->size, (unsigned)f->sd_reads);
+  fclose(f->fp);
+  for (int i = 0; i < LVGL_FS_RA_BLOCKS; i++) {
+    free(f->blocks[i].data);
+  }
+  free(f);
   return LV_FS_RES_OK;
 }
 
@@ -934,11 +3260,44 @@ static lv_fs_res_t fs_read_cb(lv_fs_drv_t *drv, void *file, void *buf,
   if (file == NULL) {
     return LV_FS_RES_INV_PARAM;
   }
+  fs_file_t *f = (fs_file_t *)file;
+  uint8_t *out = (uint8_t *)buf;
+  uint32_t done = 0;
+
+  while (done < bytes_to_read && f->pos < f->size) {
+    const uint32_t want = bytes_to_read - done;
+    fs_ra_block_t *b = NULL;
+    for (int i = 0; i < LVGL_FS_RA_BLOCKS; i++) {
+      if (f->blocks[i].len > 0 && f->pos >= f->blocks[i].start &&
+          f->pos < f->blocks[i].start + f->blocks[i].len) {
+        b = &f->blocks[i];
+        break;
+      }
+    }
+    // 大块读取：不经过缓存
+    if (b == NULL && want >= LVGL_FS_RA_BLOCK_SIZE) {
+      const size_t n = fs_sd_read(f, f->pos, out + done, want);
+      done += (uint32_t)n;
+      f->pos += (uint32_t)n;
+      break;
+    }
+    if (b == NULL) {
+      b = fs_ra_load(f, f->pos);
+      if (b == NULL) {
+        break;
+      }
+    } else {
+      b->stamp = ++f->seq;
+    }
+    const uint32_t avail = b->start + b->len - f->pos;
+    const uint32_t n = want < avail ? want : avail;
+    memcpy(out + done, b->data + (f->pos - b->start), n);
+    done += n;
+    f->pos += n;
+  }
 
-  size_t read = fread(buf, 1, bytes_to_read, (FILE *)file);
-  *bytes_read = read;
-
-  return (read == bytes_to_read) ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
+  *bytes_read = done;
+  return (done == bytes_to_read) ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
 }
 
 // 文件系统驱动：写入文件
@@ -948,45 +3307,49 @@ static lv_fs_res_t fs_write_cb(lv_fs_drv_t *drv, void *file, const void *buf,
   if (file == NULL) {
     return LV_FS_RES_INV_PARAM;
   }
+  fs_file_t *f = (fs_file_t *)file;
+  fs_ra_invalidate(f);
 
-  size_t written = fwrite(buf, 1, bytes_to_write, (FILE *)file);
+  size_t written = 0;
+  if (fseek(f->fp, (long)f->pos, SEEK_SET) == 0) {
+    written = fwrite(buf, 1, bytes_to_write, f->fp);
+  }
   *bytes_written = written;
+  f->pos += (uint32_t)written;
+  if (f->pos > f->size) {
+    f->size = f->pos;
+  }
 
   return (written == bytes_to_write) ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
 }
 
-// 文件系统驱动：定位文件指针
+// 文件系统驱动：定位文件指针（只改逻辑位置，下次读写时才访问 SD 卡）
 static lv_fs_res_t fs_seek_cb(lv_fs_drv_t *drv, void *file, uint32_t pos,
                               lv_fs_whence_t whence) {
   (void)drv;
   if (file == NULL) {
     return LV_FS_RES_INV_PARAM;
   }
+  fs_file_t *f = (fs_file_t *)file;
 
-  int w = SEEK_SET;
   if (whence == LV_FS_SEEK_CUR) {
-    w = SEEK_CUR;
+    f->pos += pos;
   } else if (whence == LV_FS_SEEK_END) {
-    w = SEEK_END;
+    f->pos = f->size + pos;
+  } else {
+    f->pos = pos;
   }
-
-  int ret = fseek((FILE *)file, pos, w);
-  return (ret == 0) ? LV_FS_RES_OK : LV_FS_RES_HW_ERR;
+  return LV_FS_RES_OK;
 }
 
-// 文件系统驱动：获取文件大小
+// 文件系统驱动：获取当前位置
 static lv_fs_res_t fs_tell_cb(lv_fs_drv_t *drv, void *file, uint32_t *pos) {
   (void)drv;
   if (file == NULL) {
     return LV_FS_RES_INV_PARAM;
   }
-
-  long tell = ftell((FILE *)file);
-  if (tell >= 0) {
-    *pos = (uint32_t)tell;
-    return LV_FS_RES_OK;
-  }
-  return LV_FS_RES_HW_ERR;
+  *pos = ((fs_file_t *)file)->pos;
+  return LV_FS_RES_OK;
 }
 
 // 文件系统驱动：目录读取（LVGL 9.x 需要返回文件名）
@@ -1037,7 +3400,7 @@ void lvgl_fs_init(void) {
 
   // 设置回调函数
   fsdrv->letter = 'S';                    // 盘符 S:
-  fsdrv->cache_size = 0;                  // 不使用缓存
+  fsdrv->cache_size = 0;                  // 读预取由驱动自己的块缓存完成
   fsdrv->open_cb = fs_open_cb;
   fsdrv->close_cb = fs_close_cb;
   fsdrv->read_cb = fs_read_cb;
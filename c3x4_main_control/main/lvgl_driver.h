@@ -7,6 +7,8 @@
 #define LVGL_DRIVER_H
 
 #include "lvgl.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
 // 按钮枚举定义（从main.c复制）
 typedef enum {
@@ -30,6 +32,20 @@ typedef enum {
     EPD_REFRESH_FULL = 2      // 全刷 - 最清晰，速度最慢
 } epd_refresh_mode_t;
 
+// 帧差分模式：局刷前与上一次上传到面板的内容比较，剔除未变化的区域
+typedef enum {
+    EPD_FRAME_DIFF_OFF = 0,       // 关闭，按 LVGL 脏区刷新
+    EPD_FRAME_DIFF_ROW_HASH = 1,  // 每行 32 位哈希（1.9 KB），裁剪未变化的行（默认）
+    EPD_FRAME_DIFF_SHADOW = 2     // 48 KB 完整影子帧，按字节列精确裁剪
+} epd_frame_diff_t;
+
+// LVGL 绘制缓冲区策略（lvgl_set_render_strategy）
+typedef enum {
+    EPD_RENDER_BANDS = 0,        // 一块 N 行分带缓冲区（默认 20 行，12 KB 静态）
+    EPD_RENDER_BANDS_DOUBLE = 1, // 两块 N 行分带缓冲区，LVGL 轮换使用
+    EPD_RENDER_DIRECT = 2        // 整帧 1bpp 缓冲区（+48 KB），只重绘失效区域
+} epd_render_strategy_t;
+
 /**
  * @brief 初始化LVGL显示驱动
  * @return 显示设备指针
@@ -56,6 +72,31 @@ void lvgl_display_refresh_fast(void);
  */
 void lvgl_display_refresh_full(void);
 
+// 刷新请求选项（lvgl_display_refresh_request 使用）
+typedef struct {
+    epd_refresh_mode_t mode;     // 刷新模式；与未处理请求合并时取 FULL > FAST > PARTIAL
+    uint32_t deadline_ms;        // 最迟多少毫秒后开始刷新（0 = 立即），期间的请求合并为一次
+    SemaphoreHandle_t done_sem;  // 可选：刷新完成且面板空闲后 give（NULL 表示不等待）
+} lvgl_refresh_request_t;
+
+/**
+ * @brief 提交刷新请求（异步，可选 deadline 与完成信号量）
+ *
+ * 刷新进行期间提交的多个请求会合并为一次后续刷新，不会积压
+ *
+ * @param req 请求选项
+ * @return false 表示未初始化或等待者数量已满（请求仍会执行，但不会 give done_sem）
+ */
+bool lvgl_display_refresh_request(const lvgl_refresh_request_t *req);
+
+/**
+ * @brief 同步刷新：提交请求并等待显示更新完成（包括面板波形）
+ * @param mode 刷新模式
+ * @param timeout_ms 最长等待时间
+ * @return true 表示显示已是最新；false 表示超时或未初始化
+ */
+bool lvgl_display_refresh_sync(epd_refresh_mode_t mode, uint32_t timeout_ms);
+
 /**
  * @brief 设置刷新模式
  * @param mode 刷新模式
@@ -68,15 +109,94 @@ void lvgl_set_refresh_mode(epd_refresh_mode_t mode);
  */
 epd_refresh_mode_t lvgl_get_refresh_mode(void);
 
+/**
+ * @brief 夜间模式：面板反相显示（白字黑底），不重新渲染
+ *
+ * 由控制器在刷新时反相输出，framebuffer、字形与帧差分保持正常极性。
+ * 切换只提交一次刷新，刷新任务把它升级为全刷（同时清理鬼影）
+ * @param enable true 开启
+ */
+void lvgl_set_night_mode(bool enable);
+
+/**
+ * @brief 夜间模式是否开启
+ */
+bool lvgl_get_night_mode(void);
+
 /**
  * @brief 检查 EPD 是否正在刷新
  * @return true 表示正在刷新，false 表示空闲
  */
 bool lvgl_is_refreshing(void);
 
+// 显示流水线各阶段累计耗时（自上次 lvgl_display_reset_stats 起）
+// SPI 上传与 BUSY 等待由 EPD 驱动统计，见 EPD_4in26_GetStats
+typedef struct {
+    uint32_t render_us;    // lvgl_trigger_render 中 lv_refr_now 的耗时（包含 flush_us）
+    uint32_t renders;
+    uint32_t render_cycles; // 以下两项仅在 CPU_PERF_ENABLE 时统计（见 cpu_perf.h）
+    uint32_t render_stalls; // 渲染中没有退休指令的周期，主要是 flash cache 缺失
+    uint32_t flush_us;     // disp_flush_cb：I1/L8 转换写入 EPD framebuffer
+    uint32_t flush_calls;
+    uint32_t refresh_us;   // 刷新任务：取到请求到上传结束（脏区处理、上传、同步模式下的波形）
+    uint32_t refreshes;
+    uint32_t superseded;   // 上传途中被更新的一帧取代、没有启动波形的刷新次数
+} lvgl_display_stats_t;
+
+/**
+ * @brief 读取各阶段累计耗时
+ * @param out 输出
+ */
+void lvgl_display_get_stats(lvgl_display_stats_t *out);
+
+/**
+ * @brief 清零各阶段累计耗时
+ */
+void lvgl_display_reset_stats(void);
+
+/**
+ * @brief 检查 EPD 面板是否仍在执行刷新波形
+ *
+ * 异步刷新模式下，数据上传完成后 lvgl_is_refreshing() 即返回 false，
+ * 此时面板可能仍在刷新；进入休眠或断电前应检查此函数
+ *
+ * @return true 表示上传或波形仍在进行
+ */
+bool lvgl_is_panel_busy(void);
+
+/**
+ * @brief 设置面板空闲休眠时间
+ *
+ * 最后一次刷新结束后超过该时间没有新的刷新，控制器进入深度睡眠（保留 RAM），
+ * 下一次刷新或 lvgl_display_wake() 时自动复位并重新初始化。下一次刷新后生效
+ *
+ * @param ms 空闲时间（毫秒），0 表示不休眠
+ */
+void lvgl_set_panel_sleep_timeout(uint32_t ms);
+
+/**
+ * @brief 获取当前的面板空闲休眠时间（毫秒）
+ */
+uint32_t lvgl_get_panel_sleep_timeout(void);
+
+/**
+ * @brief 检查面板控制器是否处于空闲休眠
+ */
+bool lvgl_is_panel_asleep(void);
+
+/**
+ * @brief 预热面板：控制器休眠时让刷新任务立即复位并初始化
+ *
+ * 按键唤醒后、渲染开始前调用，初始化与渲染并行完成，
+ * 唤醒后的第一次翻页不会比平时慢。可在任意任务中调用，不阻塞
+ */
+void lvgl_display_wake(void);
+
 /**
- * @brief 重置刷新状态（清除脏区域标记和局部刷新计数器）
+ * @brief 重置刷新状态（清除脏区域标记，下一次局刷先整屏刷新建立对比基准）
  * 在切换屏幕时调用，确保新的刷新请求不会受到旧状态影响
+ * 鬼影债务不清零：面板上的残影不会因切换屏幕而消失
+ * 同时把内容提示恢复为 EPD_CONTENT_TEXT（需在 LVGL 任务中调用）
  */
 void lvgl_reset_refresh_state(void);
 
@@ -86,6 +206,274 @@ void lvgl_reset_refresh_state(void);
  */
 void lvgl_clear_framebuffer(void);
 
+/**
+ * @brief 声明面板当前显示的内容（启动时直接上传了缓存的快照）
+ * frame 复制进 framebuffer 并作为局刷对比基准；之后的第一次刷新（包括屏幕切换
+ * 请求的 FULL）按局刷处理，只刷与快照不同的行，画面完全相同时面板不动。
+ * 在 LVGL 渲染前、刷新空闲时调用；灰阶模式下忽略
+ */
+void lvgl_seed_panel_frame(const uint8_t *frame);
+
+/**
+ * @brief 开启/关闭乒乓 framebuffer
+ *
+ * 开启后额外分配一块 48 KB 缓冲区：LVGL 渲染写入后台缓冲区，
+ * 刷新任务交换指针后从前台缓冲区上传，翻页时渲染与上传可以重叠。
+ * 适合阅读会话期间开启；内存紧张时可先释放 BLE 协议栈再调用
+ *
+ * @param enable true 开启，false 关闭并释放第二块缓冲区
+ * @return true 成功；false 内存不足或等待刷新超时（保持原模式）
+ */
+bool lvgl_set_double_buffer(bool enable);
+
+/**
+ * @brief 检查乒乓 framebuffer 是否开启
+ * @return true 表示已开启
+ */
+bool lvgl_is_double_buffer(void);
+
+/**
+ * @brief 切换 LVGL 绘制缓冲区策略（在 LVGL 任务中调用）
+ *
+ * 分带越高，整屏渲染的 flush 次数越少（20 行：竖屏 40 次），但占用更多内存：
+ * 竖屏每行 60 字节，不超过 DISP_BUF_LINES 行时复用 12 KB 静态缓冲区，
+ * 更高的分带和第二块缓冲区从堆上分配。DIRECT 固定分配 48 KB 整帧缓冲区，
+ * 每个失效区域只 flush 一次。各策略的实测耗时用 display_bench 获得
+ *
+ * @param strategy   绘制策略
+ * @param band_lines 每条分带的行数（0 = DISP_BUF_LINES；DIRECT 忽略）
+ * @return true 成功；false 未初始化或内存不足（保持原策略）
+ */
+bool lvgl_set_render_strategy(epd_render_strategy_t strategy, uint16_t band_lines);
+
+/**
+ * @brief 获取当前绘制缓冲区策略
+ */
+epd_render_strategy_t lvgl_get_render_strategy(void);
+
+/**
+ * @brief 获取当前每条分带的行数（DIRECT 模式为屏幕高度）
+ */
+uint16_t lvgl_get_render_band_lines(void);
+
+/**
+ * @brief 切换显示方向（LVGL 任务中、两次渲染之间调用）
+ *
+ * 横屏时 LVGL 工作在面板的原生方向 800x480，flush 是逐行复制，省掉竖屏每次 flush 的
+ * 8x8 转置。切换后整屏失效，静态图层被释放，已有的控件按新分辨率重新布局；
+ * 调用方随后用 screen_manager_refresh 刷新
+ *
+ * @param landscape true 横屏（原生方向），false 竖屏 480x800
+ * @return false 未初始化或等待刷新任务超时（方向不变）
+ */
+bool lvgl_set_landscape(bool landscape);
+
+/**
+ * @brief 当前是否为横屏（原生方向）
+ */
+bool lvgl_is_landscape(void);
+
+// framebuffer 中一个逻辑区域对应的物理字节矩形（lvgl_fb_get_region）
+typedef struct {
+    uint32_t offset;     // 首字节在 framebuffer 中的偏移
+    uint16_t row_bytes;  // 每行字节数（X 已扩展到字节边界）
+    uint16_t rows;       // 行数
+    uint16_t stride;     // framebuffer 每行字节数
+} lvgl_fb_region_t;
+
+/**
+ * @brief framebuffer 字节数（EPD 物理布局，1bpp）
+ */
+size_t lvgl_fb_size(void);
+
+/**
+ * @brief LVGL 初始化之前直接取得 framebuffer（启动画面、低电量关机画面）
+ *
+ * 不加锁，只能在 lvgl_display_init 之前由单个任务使用；之后返回 NULL。
+ * 用过之后 lvgl_display_init 不再清空 framebuffer，调用方可以把画出的内容
+ * 交给 lvgl_seed_panel_frame 作为局刷基准
+ */
+uint8_t *lvgl_fb_early(void);
+
+/**
+ * @brief 把逻辑坐标区域映射为 framebuffer 中的字节矩形
+ *
+ * 页面缓存等模块按该矩形保存/恢复像素，绕过 LVGL 的重新排版与光栅化
+ *
+ * @return false 区域为空或完全在屏幕外
+ */
+bool lvgl_fb_get_region(const lv_area_t *area, lvgl_fb_region_t *out);
+
+/**
+ * @brief 只读访问最近一次渲染完成的 framebuffer（持有互斥锁，尽快调用 lvgl_fb_read_end）
+ * @return NULL 表示未初始化、灰阶模式或等锁超时
+ */
+const uint8_t *lvgl_fb_read_begin(uint32_t timeout_ms);
+void lvgl_fb_read_end(void);
+
+/**
+ * @brief 后台 framebuffer 的写入次数（每次 LVGL 渲染或直接写入开始时加一，任意任务读取）
+ *
+ * 分段读取 framebuffer 的一方前后各取一次，不相等说明期间画面变过
+ */
+uint32_t lvgl_fb_generation(void);
+
+/**
+ * @brief 直接写入后台 framebuffer（在 LVGL 任务中调用）
+ *
+ * 与一次 LVGL 渲染等价：等待刷新任务结束对同一缓冲区的上传，
+ * lvgl_fb_write_end 记录脏区（局刷模式）后即可像平常一样请求刷新。
+ * 调用方负责让 LVGL 控件与写入的像素保持一致（见 lv_display_enable_invalidation）
+ *
+ * @return NULL 表示未初始化、灰阶/捕获模式或等待超时
+ */
+uint8_t *lvgl_fb_write_begin(uint32_t timeout_ms);
+
+/**
+ * @param area 写入的逻辑区域（记录为脏区；NULL 不记录）
+ */
+void lvgl_fb_write_end(const lv_area_t *area);
+
+/**
+ * @brief 把逻辑方向的 1bpp 位图写入 framebuffer（在 lvgl_fb_write_begin / end 之间调用）
+ *
+ * 位图逐行存放，高位在左，1 为白色（与 framebuffer 相同）；超出屏幕的部分被裁掉
+ *
+ * @param fb lvgl_fb_write_begin 返回的 framebuffer
+ * @param x 左上角逻辑坐标
+ * @param y 左上角逻辑坐标
+ * @param width 位图宽度
+ * @param height 位图高度
+ * @param bits 位图数据
+ * @param stride 位图每行字节数
+ */
+void lvgl_fb_put_bitmap(uint8_t *fb, int32_t x, int32_t y, uint16_t width, uint16_t height,
+                        const uint8_t *bits, uint16_t stride);
+
+/**
+ * @brief 灰阶模式下把 2bpp 位图（每像素 0 黑 .. 3 白，高位在左）写入两个位平面
+ *
+ * 自行完成 lvgl_fb_write_begin / end 的等待与脏区记录（在 LVGL 任务中调用）
+ *
+ * @return false 表示不在灰阶模式或等待超时
+ */
+bool lvgl_fb_put_gray_bitmap(int32_t x, int32_t y, uint16_t width, uint16_t height,
+                             const uint8_t *bits, uint16_t stride, uint32_t timeout_ms);
+
+/**
+ * @brief 把后续渲染重定向到调用方的整帧缓冲区（lvgl_fb_size 字节，物理布局）
+ *
+ * 捕获期间 flush 不写 framebuffer、不记录脏区，刷新任务完全不受影响，
+ * 用于离屏预渲染。只能在 LVGL 任务中调用，灰阶模式下不可用
+ *
+ * @return false 参数无效、未初始化、灰阶模式或已在捕获中
+ */
+bool lvgl_capture_begin(uint8_t *fb);
+
+/**
+ * @brief 结束捕获，恢复渲染到 framebuffer
+ */
+void lvgl_capture_end(void);
+
+/**
+ * @brief 把 area 内已渲染的像素缓存为静态图层（阅读器标题栏、边框线等页面外框）
+ *
+ * 图层是物理布局、按 32 位字对齐的 1bpp 位图加覆盖掩码，每次 flush 后按字合成：
+ * fb = (fb & ~mask) | (bits & mask)。opaque 为 true 时掩码覆盖整个区域，之后
+ * 落在图层上的失效区域被裁掉（只能裁成矩形时），图层像素不再渲染、也不进入脏区；
+ * 为 false 时只有黑色像素进入掩码（叠在正文上的线条），合成退化为 AND，区域照常渲染，
+ * 调用方可隐藏对应控件省掉渲染。只能有一个图层，重复调用替换旧图层。
+ * 在 LVGL 任务中、区域渲染完成之后调用，灰阶模式下不可用
+ *
+ * @return false 参数无效、未初始化、灰阶模式、内存不足或等锁超时
+ */
+bool lvgl_layer_capture(const lv_area_t *area, bool opaque);
+
+/**
+ * @brief 暂停/恢复静态图层（覆盖图层的浮层打开前暂停，关闭后恢复）
+ *
+ * 恢复后的下一帧把整个图层写回 framebuffer 并记为脏区，浮层留下的像素随之被覆盖
+ */
+void lvgl_layer_set_enabled(bool enable);
+
+/**
+ * @brief 释放静态图层，之后区域按普通控件渲染
+ */
+void lvgl_layer_release(void);
+
+/**
+ * @brief 设置帧差分模式
+ *
+ * 重新渲染但像素未变的控件（焦点样式还原、设置相同文本等）不会再触发局刷；
+ * 整帧未变化时直接跳过面板刷新。切换模式后需等下一次整帧刷新才开始生效
+ *
+ * @param mode 帧差分模式；SHADOW 内存不足时自动退化为 ROW_HASH
+ * @return true 成功；false 未初始化或等待刷新超时
+ */
+bool lvgl_set_frame_diff(epd_frame_diff_t mode);
+
+/**
+ * @brief 当前 framebuffer 中与面板上次显示的内容不同的行占全屏的百分比
+ *
+ * 渲染之后、提交刷新之前调用，用于按画面变化量选择刷新方式（screen_manager_refresh）
+ * @return 0~100；帧差分关闭、基准尚未建立或灰阶模式下返回 -1
+ */
+int lvgl_fb_changed_percent(void);
+
+/**
+ * @brief 焦点移动的微刷新：只把旧、新焦点对象标为脏区，各自作为一个局刷窗口
+ *
+ * 两块区域不进入普通脏区的合并，不会和列表里其它变化连成一个大包围盒，
+ * 下一次局刷用多窗口一次送出（两行相邻时合成一个窗口）；之后渲染时落在
+ * 这两块里的 flush 并入对应窗口。只负责标记，渲染与刷新由调用方完成
+ * （screen_manager_refresh_focus）
+ *
+ * @param from 失去焦点的对象，可以为 NULL
+ * @param to   获得焦点的对象，可以为 NULL
+ */
+void lvgl_invalidate_focus(lv_obj_t *from, lv_obj_t *to);
+
+// 灰阶策略：决定何时值得使用更慢的 4 灰阶波形（约为快刷的 2~3 倍时间）
+typedef enum {
+    EPD_GRAY_POLICY_OFF = 0,     // 始终单色
+    EPD_GRAY_POLICY_IMAGES = 1,  // 仅图片/封面等内容使用灰阶，纯文本页保持单色（默认）
+    EPD_GRAY_POLICY_ALWAYS = 2   // 所有内容使用灰阶（文字抗锯齿）
+} epd_gray_policy_t;
+
+// 屏幕内容提示：屏幕创建时声明，由灰阶策略决定渲染格式
+typedef enum {
+    EPD_CONTENT_TEXT = 0,   // 文本/菜单
+    EPD_CONTENT_IMAGE = 1   // 图片、封面
+} epd_content_t;
+
+/**
+ * @brief 设置灰阶策略（下一次 lvgl_set_content_hint 时生效）
+ */
+void lvgl_set_gray_policy(epd_gray_policy_t policy);
+
+/**
+ * @brief 获取当前灰阶策略
+ */
+epd_gray_policy_t lvgl_get_gray_policy(void);
+
+/**
+ * @brief 声明当前屏幕的内容类型，按灰阶策略切换 LVGL 渲染格式
+ *
+ * 灰阶模式下 LVGL 以 L8 渲染，flush_cb 把亮度量化为 4 级写入两个 1bpp 位平面
+ * （额外 48 KB），刷新任务改用 4 灰阶波形上传。切换后整屏重新渲染。
+ * 必须在 LVGL 任务中调用；乒乓 framebuffer 开启时不能进入灰阶模式。
+ * lvgl_reset_refresh_state() 会恢复为 EPD_CONTENT_TEXT
+ *
+ * @param content 内容类型
+ * @return true 表示当前为灰阶模式
+ */
+bool lvgl_set_content_hint(epd_content_t content);
+
+/**
+ * @brief 检查是否处于灰阶渲染模式
+ */
+bool lvgl_is_grayscale(void);
+
 /**
  * @brief 手动触发 LVGL 渲染刷新（用于 EPD 手动刷新模式）
  *
@@ -102,23 +490,90 @@ void lvgl_trigger_render(lv_display_t *disp);
  */
 lv_indev_t* lvgl_input_init(void);
 
+// 快速通道钩子被调用的时机
+typedef enum {
+    LVGL_KEY_PRESS = 0,   // 首次按下
+    LVGL_KEY_REPEAT,      // 按住后的重复（周期逐次缩短，见 lvgl_driver.c）
+    LVGL_KEY_RELEASE,     // 被钩子接管的键松开（返回值忽略）
+} lvgl_key_phase_t;
+
 /**
- * @brief LVGL tick任务
- * @param arg 任务参数
+ * @brief 按键快速通道钩子（在 LVGL 定时器任务中调用）
+ * @param btn 按下的键
+ * @param phase 按下、重复或松开
+ * @return true 表示已处理：这次按下（及随后的重复与释放）不再送入 LVGL 输入设备
+ *
+ * 重复越来越快，墨水屏跟不上每次都重绘：钩子可在 REPEAT 时只移动逻辑位置并局部
+ * 刷新一个小的进度指示，在 RELEASE 时绘制最终页面
+ */
+typedef bool (*lvgl_key_hook_t)(button_t btn, lvgl_key_phase_t phase);
+
+/**
+ * @brief 为屏幕设置按键快速通道
+ *
+ * 按键事件从队列取出后先交给当前活动屏幕的钩子，不经过输入设备读取、组导航和
+ * lv_async_call。钩子拒绝首次按下时事件照常送入 LVGL。也可以登记在直接建在屏幕上的
+ * 覆盖层（阅读器）上，覆盖层未隐藏时优先于屏幕本身的钩子。对象删除时自动注销；
+ * hook 为 NULL 时注销。同时最多 LVGL_KEY_HOOK_SLOTS 个对象
+ */
+#define LVGL_KEY_HOOK_SLOTS 4
+void lvgl_set_key_hook(lv_obj_t *screen, lvgl_key_hook_t hook);
+
+// 按键到面板波形开始（0x20 发出）的延时统计，按是否走快速通道分开
+typedef struct {
+    uint32_t samples;
+    uint32_t last_ms;
+    uint32_t avg_ms;
+    uint32_t max_ms;
+} lvgl_key_latency_t;
+
+/**
+ * @brief 读取按键延时统计（自开机起）
+ * @param fast_path true 读取快速通道，false 读取 LVGL 输入设备路径
  */
-void lvgl_tick_task(void *arg);
+void lvgl_get_key_latency(bool fast_path, lvgl_key_latency_t *out);
+
+/**
+ * @brief 电源键长按处理（关机）
+ *
+ * 电源键不送入 LVGL；按住超过 hold_ms 时在 LVGL 定时器任务中调用一次 handler，
+ * 松开后重新计时。handler 为 NULL 时注销
+ */
+void lvgl_set_power_hold_handler(uint32_t hold_ms, void (*handler)(void));
 
 /**
  * @brief LVGL定时器任务
+ *
+ * 事件驱动：取出按键事件、处理到期的 LVGL 定时器，然后睡到下一个定时器到期
+ * 或按键任务唤醒（按住时最长 20 ms）。LVGL tick 由 esp_timer 提供，无需 tick 任务
  * @param arg 任务参数
  */
 void lvgl_timer_task(void *arg);
 
+// LVGL 定时器任务的栈大小（字节），实际占用见 stack_stats
+#define LVGL_TIMER_TASK_STACK 16384
+
+/**
+ * @brief 提前唤醒 LVGL 定时器任务
+ *
+ * 其他任务设置了需要 LVGL 定时器尽快处理的状态（例如请求基准测试）后调用
+ */
+void lvgl_timer_task_wake(void);
+
+// S:/ 文件的读预取块（可在编译选项中覆盖；块数 2~4）
+#ifndef LVGL_FS_RA_BLOCK_SIZE
+#define LVGL_FS_RA_BLOCK_SIZE 2048
+#endif
+#ifndef LVGL_FS_RA_BLOCKS
+#define LVGL_FS_RA_BLOCKS 3
+#endif
+
 /**
  * @brief 初始化 LVGL 文件系统驱动
  *
  * 注册 SD 卡文件系统到 LVGL，使图片和字体可以通过文件路径加载
- * 使用盘符 "S:/" 访问 /sdcard 目录
+ * 使用盘符 "S:/" 访问 /sdcard 目录。只读打开的文件带 LVGL_FS_RA_BLOCKS 个
+ * LVGL_FS_RA_BLOCK_SIZE 字节的读预取块（首次读取时分配，关闭时释放）
  */
 void lvgl_fs_init(void);
 
@@ -0,0 +1,106 @@
+/**
+ * @file lvgl_mem_pool.c
+ * @brief LVGL 弹性内存池实现
+ */
+
+#include "lvgl_mem_pool.h"
+#include "heap_stats.h"
+#include "lvgl.h"
+#include "stdlib/builtin/lv_tlsf.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "LV_POOL";
+
+static struct {
+    void *mem[LVGL_MEM_POOL_MAX_EXTRA];
+    lv_mem_pool_t pool[LVGL_MEM_POOL_MAX_EXTRA];
+    int count;
+    unsigned radios;          // 正在运行的无线电（lvgl_mem_radio_t 位掩码）
+} s_pools;
+
+static void used_walker(void *ptr, size_t size, int used, void *user) {
+    (void)ptr;
+    (void)size;
+    if (used) {
+        *(bool *)user = true;
+    }
+}
+
+// 池内没有任何已分配的块（TLSF 合并相邻空闲块，空池只剩一个空闲块）
+static bool pool_is_empty(lv_mem_pool_t pool) {
+    bool used = false;
+    lv_tlsf_walk_pool(pool, used_walker, &used);
+    return !used;
+}
+
+static size_t lv_pool_free(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.free_size;
+}
+
+static bool add_pool(void) {
+    if (s_pools.count >= LVGL_MEM_POOL_MAX_EXTRA ||
+        heap_stats_cache_budget(0, 1) < 2 * LVGL_MEM_POOL_CHUNK) {
+        return false;  // 至少给缓存和突发分配留下同样大的一块
+    }
+    void *mem = heap_caps_malloc(LVGL_MEM_POOL_CHUNK, MALLOC_CAP_8BIT);
+    if (mem == NULL) {
+        return false;
+    }
+    const lv_mem_pool_t pool = lv_mem_add_pool(mem, LVGL_MEM_POOL_CHUNK);
+    if (pool == NULL) {
+        heap_caps_free(mem);
+        return false;
+    }
+    s_pools.mem[s_pools.count] = mem;
+    s_pools.pool[s_pools.count] = pool;
+    s_pools.count++;
+    ESP_LOGI(TAG, "Added pool %d (%u bytes), LVGL free %u", s_pools.count,
+             (unsigned)LVGL_MEM_POOL_CHUNK, (unsigned)lv_pool_free());
+    return true;
+}
+
+// 摘下空闲的附加池（从最后挂上的开始）；keep_free 为摘下后其余池至少要留的余量
+static void remove_empty_pools(size_t keep_free) {
+    for (int i = s_pools.count - 1; i >= 0; i--) {
+        size_t free_size = lv_pool_free();
+        if (free_size < LVGL_MEM_POOL_CHUNK + keep_free || !pool_is_empty(s_pools.pool[i])) {
+            continue;
+        }
+        lv_mem_remove_pool(s_pools.pool[i]);
+        heap_caps_free(s_pools.mem[i]);
+        for (int k = i; k + 1 < s_pools.count; k++) {
+            s_pools.mem[k] = s_pools.mem[k + 1];
+            s_pools.pool[k] = s_pools.pool[k + 1];
+        }
+        s_pools.count--;
+        ESP_LOGI(TAG, "Released a pool, %d left, LVGL free %u", s_pools.count, (unsigned)lv_pool_free());
+    }
+}
+
+void lvgl_mem_pool_balance(size_t need) {
+    if (s_pools.radios != 0) {
+        remove_empty_pools(0);
+        return;
+    }
+    while (lv_pool_free() < LVGL_MEM_POOL_LOW_FREE + need && add_pool()) {
+    }
+    if (need == 0 && s_pools.count > 0) {
+        remove_empty_pools(LVGL_MEM_POOL_HIGH_FREE);
+    }
+}
+
+void lvgl_mem_pool_set_radio(lvgl_mem_radio_t radio, bool active) {
+    if (active) {
+        s_pools.radios |= radio;
+    } else {
+        s_pools.radios &= ~(unsigned)radio;
+    }
+    lvgl_mem_pool_balance(0);
+}
+
+int lvgl_mem_pool_extra_count(void) {
+    return s_pools.count;
+}
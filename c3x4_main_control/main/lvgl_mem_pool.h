@@ -0,0 +1,50 @@
+/**
+ * @file lvgl_mem_pool.h
+ * @brief LVGL 弹性内存池：在静态池之外按需挂接堆上的附加池（TLSF 多池）
+ *
+ * CONFIG_LV_MEM_SIZE 的静态池按 BLE 常驻时的余量定下来，文件浏览器等控件多的屏幕
+ * 可能把它用完，而关闭 BLE 或退出 Wi-Fi 传输模式后腾出的堆却闲着。没有无线电运行时，
+ * 池内余量低于 LVGL_MEM_POOL_LOW_FREE 就从堆上再分一块 LVGL_MEM_POOL_CHUNK 用
+ * lv_mem_add_pool 挂进去（堆预算不够时不挂）；附加池整块空闲且其余池的余量足够时
+ * 用 lv_mem_remove_pool 摘下还给堆，缓存可以接着用。无线电启动前先摘掉所有空闲的
+ * 附加池；仍有控件占用的池留到控件删除后再摘
+ *
+ * 所有函数都在 LVGL 任务中调用（与 lv_malloc 同一任务，不需要加锁）
+ */
+
+#ifndef LVGL_MEM_POOL_H
+#define LVGL_MEM_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define LVGL_MEM_POOL_CHUNK     (16 * 1024)  // 每个附加池的大小
+#define LVGL_MEM_POOL_MAX_EXTRA 4            // 最多附加的池数
+#define LVGL_MEM_POOL_LOW_FREE  (12 * 1024)  // 池内余量低于此值时附加一块
+#define LVGL_MEM_POOL_HIGH_FREE (28 * 1024)  // 摘下一块后余量仍不低于此值才摘（迟滞）
+
+// 占用内存的无线电（位掩码）
+typedef enum {
+    LVGL_MEM_RADIO_BLE = 1 << 0,
+    LVGL_MEM_RADIO_WIFI = 1 << 1,
+} lvgl_mem_radio_t;
+
+/**
+ * @brief 无线电启动前（active=true）或关闭后（active=false）调用
+ *
+ * 启动前摘下所有空闲的附加池，把堆让给协议栈；全部关闭后重新按余量调整
+ */
+void lvgl_mem_pool_set_radio(lvgl_mem_radio_t radio, bool active);
+
+/**
+ * @brief 按当前余量附加或摘下池（每次渲染后、创建屏幕前调用，开销是遍历附加池）
+ * @param need 即将需要的字节数（创建屏幕前传预估值，平时传 0）
+ */
+void lvgl_mem_pool_balance(size_t need);
+
+/**
+ * @brief 当前附加池的个数
+ */
+int lvgl_mem_pool_extra_count(void);
+
+#endif // LVGL_MEM_POOL_H
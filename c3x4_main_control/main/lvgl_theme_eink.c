@@ -0,0 +1,324 @@
+/**
+ * @file lvgl_theme_eink.c
+ * @brief 墨水屏专用的 LVGL 主题，见 lvgl_theme_eink.h
+ *
+ * 主题没有父主题：默认主题的过渡、grow 与 anim_duration 都不会出现。anim_duration
+ * 的缺省值为 0，所以文本框光标不闪烁，进度条与滚轮的数值变化直接跳到终值
+ */
+
+#include "lvgl_theme_eink.h"
+#include "lvgl_private.h"
+
+#define EINK_BLACK  LV_COLOR_MAKE(0x00, 0x00, 0x00)
+#define EINK_WHITE  LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)
+
+#define EINK_BORDER        1   // 常态边框
+#define EINK_BORDER_FOCUS  3   // 聚焦时的边框（与 index_screen 等屏幕的本地样式一致）
+
+// 屏幕：白底黑字
+static const lv_style_const_prop_t s_screen_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_screen, s_screen_props);
+
+// 容器、列表、文本框等：白底 1 像素黑框
+static const lv_style_const_prop_t s_card_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER),
+    LV_STYLE_CONST_TEXT_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_PAD_TOP(8),
+    LV_STYLE_CONST_PAD_BOTTOM(8),
+    LV_STYLE_CONST_PAD_LEFT(8),
+    LV_STYLE_CONST_PAD_RIGHT(8),
+    LV_STYLE_CONST_PAD_ROW(4),
+    LV_STYLE_CONST_PAD_COLUMN(4),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_card, s_card_props);
+
+static const lv_style_const_prop_t s_button_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER),
+    LV_STYLE_CONST_TEXT_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_PAD_TOP(6),
+    LV_STYLE_CONST_PAD_BOTTOM(6),
+    LV_STYLE_CONST_PAD_LEFT(10),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_button, s_button_props);
+
+// 列表项：只有底边分隔线
+static const lv_style_const_prop_t s_list_button_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_TEXT_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_PAD_TOP(6),
+    LV_STYLE_CONST_PAD_BOTTOM(6),
+    LV_STYLE_CONST_PAD_LEFT(8),
+    LV_STYLE_CONST_PAD_RIGHT(8),
+    LV_STYLE_CONST_PAD_COLUMN(6),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_list_button, s_list_button_props);
+
+static const lv_style_const_prop_t s_list_props[] = {
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PAD_ROW(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_list, s_list_props);
+
+// 聚焦：加粗边框，四边都画（列表项常态只有底边）
+static const lv_style_const_prop_t s_focus_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER_FOCUS),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_FULL),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_focus, s_focus_props);
+
+// 按下、选中项：反色
+static const lv_style_const_prop_t s_inverted_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_TEXT_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_inverted, s_inverted_props);
+
+// 实心黑块：进度条指示、滑块旋钮、勾选框与开关的选中态
+static const lv_style_const_prop_t s_fill_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_fill, s_fill_props);
+
+// 只有边框：进度条槽、勾选框与开关的外框
+static const lv_style_const_prop_t s_outline_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_WHITE),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER),
+    LV_STYLE_CONST_PAD_TOP(2),
+    LV_STYLE_CONST_PAD_BOTTOM(2),
+    LV_STYLE_CONST_PAD_LEFT(2),
+    LV_STYLE_CONST_PAD_RIGHT(2),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_outline, s_outline_props);
+
+// 滚动条：2 像素实线，不淡入淡出
+static const lv_style_const_prop_t s_scrollbar_props[] = {
+    LV_STYLE_CONST_BG_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_WIDTH(2),
+    LV_STYLE_CONST_PAD_RIGHT(1),
+    LV_STYLE_CONST_PAD_TOP(1),
+    LV_STYLE_CONST_PAD_BOTTOM(1),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_scrollbar, s_scrollbar_props);
+
+// 文本框光标：1 像素竖线（anim_duration 为 0，不闪烁）
+static const lv_style_const_prop_t s_cursor_props[] = {
+    LV_STYLE_CONST_BORDER_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_BORDER_WIDTH(EINK_BORDER),
+    LV_STYLE_CONST_BORDER_SIDE(LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_cursor, s_cursor_props);
+
+#if LV_USE_ARC
+// 圆弧与加载圈：直角端点的细线
+static const lv_style_const_prop_t s_arc_props[] = {
+    LV_STYLE_CONST_ARC_COLOR(EINK_BLACK),
+    LV_STYLE_CONST_ARC_WIDTH(2),
+    LV_STYLE_CONST_ARC_ROUNDED(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_arc, s_arc_props);
+#endif
+
+static inline void add(lv_obj_t *obj, const lv_style_t *style, lv_style_selector_t selector) {
+    lv_obj_add_style(obj, style, selector);
+}
+
+// 可聚焦的按钮类控件：常态样式 + 聚焦加粗 + 按下反色
+static void apply_pressable(lv_obj_t *obj, const lv_style_t *base) {
+    add(obj, base, 0);
+    add(obj, &s_focus, LV_STATE_FOCUSED);
+    add(obj, &s_inverted, LV_STATE_PRESSED);
+}
+
+static void theme_apply(lv_theme_t *th, lv_obj_t *obj) {
+    (void)th;
+
+    if (lv_obj_get_parent(obj) == NULL) {
+        add(obj, &s_screen, 0);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        return;
+    }
+
+    if (lv_obj_check_type(obj, &lv_obj_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        return;
+    }
+#if LV_USE_BUTTON
+    if (lv_obj_check_type(obj, &lv_button_class)) {
+        apply_pressable(obj, &s_button);
+        return;
+    }
+#endif
+#if LV_USE_LIST
+    if (lv_obj_check_type(obj, &lv_list_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_list, 0);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        return;
+    }
+    if (lv_obj_check_type(obj, &lv_list_button_class)) {
+        apply_pressable(obj, &s_list_button);
+        return;
+    }
+    if (lv_obj_check_type(obj, &lv_list_text_class)) {
+        add(obj, &s_list_button, 0);
+        return;
+    }
+#endif
+#if LV_USE_BAR
+    if (lv_obj_check_type(obj, &lv_bar_class)) {
+        add(obj, &s_outline, 0);
+        add(obj, &s_fill, LV_PART_INDICATOR);
+        return;
+    }
+#endif
+#if LV_USE_SLIDER
+    if (lv_obj_check_type(obj, &lv_slider_class)) {
+        add(obj, &s_outline, 0);
+        add(obj, &s_focus, LV_STATE_FOCUSED);
+        add(obj, &s_fill, LV_PART_INDICATOR);
+        add(obj, &s_fill, LV_PART_KNOB);
+        return;
+    }
+#endif
+#if LV_USE_SWITCH
+    if (lv_obj_check_type(obj, &lv_switch_class)) {
+        add(obj, &s_outline, 0);
+        add(obj, &s_focus, LV_STATE_FOCUSED);
+        add(obj, &s_fill, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        add(obj, &s_outline, LV_PART_KNOB);
+        return;
+    }
+#endif
+#if LV_USE_CHECKBOX
+    if (lv_obj_check_type(obj, &lv_checkbox_class)) {
+        add(obj, &s_focus, LV_STATE_FOCUSED);
+        add(obj, &s_outline, LV_PART_INDICATOR);
+        add(obj, &s_fill, LV_PART_INDICATOR | LV_STATE_CHECKED);
+        return;
+    }
+#endif
+#if LV_USE_TEXTAREA
+    if (lv_obj_check_type(obj, &lv_textarea_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_focus, LV_STATE_FOCUSED);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        add(obj, &s_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
+        add(obj, &s_inverted, LV_PART_SELECTED);
+        return;
+    }
+#endif
+#if LV_USE_DROPDOWN
+    if (lv_obj_check_type(obj, &lv_dropdown_class)) {
+        apply_pressable(obj, &s_button);
+        return;
+    }
+    if (lv_obj_check_type(obj, &lv_dropdownlist_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        add(obj, &s_inverted, LV_PART_SELECTED | LV_STATE_CHECKED);
+        add(obj, &s_inverted, LV_PART_SELECTED | LV_STATE_PRESSED);
+        return;
+    }
+#endif
+#if LV_USE_ROLLER
+    if (lv_obj_check_type(obj, &lv_roller_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_focus, LV_STATE_FOCUSED);
+        add(obj, &s_inverted, LV_PART_SELECTED);
+        return;
+    }
+#endif
+#if LV_USE_BUTTONMATRIX
+    if (lv_obj_check_type(obj, &lv_buttonmatrix_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_button, LV_PART_ITEMS);
+        add(obj, &s_inverted, LV_PART_ITEMS | LV_STATE_PRESSED);
+        add(obj, &s_inverted, LV_PART_ITEMS | LV_STATE_CHECKED);
+        add(obj, &s_focus, LV_PART_ITEMS | LV_STATE_FOCUSED);
+        return;
+    }
+#endif
+#if LV_USE_TABLE
+    if (lv_obj_check_type(obj, &lv_table_class)) {
+        add(obj, &s_card, 0);
+        add(obj, &s_scrollbar, LV_PART_SCROLLBAR);
+        add(obj, &s_button, LV_PART_ITEMS);
+        add(obj, &s_inverted, LV_PART_ITEMS | LV_STATE_PRESSED);
+        return;
+    }
+#endif
+#if LV_USE_MSGBOX
+    if (lv_obj_check_type(obj, &lv_msgbox_class)) {
+        add(obj, &s_card, 0);
+        return;
+    }
+#endif
+#if LV_USE_ARC
+    if (lv_obj_check_type(obj, &lv_arc_class)
+#if LV_USE_SPINNER
+        || lv_obj_check_type(obj, &lv_spinner_class)
+#endif
+    ) {
+        add(obj, &s_arc, 0);
+        add(obj, &s_arc, LV_PART_INDICATOR);
+        add(obj, &s_fill, LV_PART_KNOB);
+        return;
+    }
+#endif
+}
+
+lv_theme_t *lvgl_theme_eink_init(lv_display_t *disp) {
+    static lv_theme_t *s_theme;
+    if (s_theme == NULL) {
+        s_theme = lv_theme_create();
+        if (s_theme == NULL) {
+            return NULL;
+        }
+        s_theme->disp = disp;
+        s_theme->color_primary = lv_color_black();
+        s_theme->color_secondary = lv_color_black();
+        s_theme->font_small = LV_FONT_DEFAULT;
+        s_theme->font_normal = LV_FONT_DEFAULT;
+        s_theme->font_large = LV_FONT_DEFAULT;
+        lv_theme_set_apply_cb(s_theme, theme_apply);
+    }
+    lv_display_set_theme(disp, s_theme);
+    return s_theme;
+}
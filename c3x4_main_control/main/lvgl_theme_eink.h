@@ -0,0 +1,27 @@
+/**
+ * @file lvgl_theme_eink.h
+ * @brief 墨水屏专用的 LVGL 主题（取代默认主题）
+ *
+ * 面向 800x480 1bpp 面板：
+ *   - 没有过渡、放大（grow）与动画：默认主题在按下/聚焦时的每一帧过渡都是一次
+ *     渲染和一块脏区域，屏上根本看不到
+ *   - 没有圆角、阴影、渐变与半透明：只有黑白两色，1 像素边框，阴影的扩展绘制区
+ *     也不再扩大脏区域
+ *   - 样式全部是 static const，不占 LVGL 堆，不需要初始化
+ *   - 焦点可见：聚焦的控件边框加粗到 3 像素（与各屏幕现有的焦点样式一致），
+ *     按下时反色
+ * 各屏幕的本地样式优先级更高，照常覆盖主题
+ */
+
+#ifndef LVGL_THEME_EINK_H
+#define LVGL_THEME_EINK_H
+
+#include "lvgl.h"
+
+/**
+ * @brief 为显示设备设置墨水屏主题（创建显示之后、创建屏幕之前调用）
+ * @return 主题指针，内存不足时为 NULL（保持 LVGL 的默认行为）
+ */
+lv_theme_t *lvgl_theme_eink_init(lv_display_t *disp);
+
+#endif // LVGL_THEME_EINK_H
@@ -0,0 +1,151 @@
+/**
+ * @file lz_block.c
+ * @brief LZ77 块压缩与解压
+ */
+
+#include "lz_block.h"
+#include <string.h>
+
+#define LZ_MIN_MATCH     4
+#define LZ_LAST_LITERALS 5    // 块末尾至少留作原样字节的长度（与 LZ4 相同）
+#define LZ_MATCH_LIMIT   12   // 距块末尾不足此长度时不再找匹配
+
+static inline uint32_t read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t lz_hash(uint32_t v) {
+    return (v * 2654435761u) >> (32 - LZ_BLOCK_HASH_BITS);
+}
+
+// 长度的扩展字节数（令牌中的 4 位取 15 之后）
+static inline size_t ext_bytes(size_t len) {
+    return len >= 15 ? (len - 15) / 255 + 1 : 0;
+}
+
+static uint8_t *put_ext(uint8_t *op, size_t len) {
+    if (len < 15) {
+        return op;
+    }
+    len -= 15;
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+// 写一个序列（match_len 为 0 时是最后的原样字节）；放不下时返回 NULL
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *end, const uint8_t *literals, size_t lit_len,
+                             size_t offset, size_t match_len) {
+    const size_t m = match_len > 0 ? match_len - LZ_MIN_MATCH : 0;
+    const size_t need = 1 + ext_bytes(lit_len) + lit_len + (match_len > 0 ? 2 + ext_bytes(m) : 0);
+    if ((size_t)(end - op) < need) {
+        return NULL;
+    }
+    *op++ = (uint8_t)((lit_len < 15 ? lit_len : 15) << 4 | (m < 15 ? m : 15));
+    op = put_ext(op, lit_len);
+    memcpy(op, literals, lit_len);
+    op += lit_len;
+    if (match_len > 0) {
+        *op++ = (uint8_t)(offset & 0xFF);
+        *op++ = (uint8_t)(offset >> 8);
+        op = put_ext(op, m);
+    }
+    return op;
+}
+
+size_t lz_block_encode(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity,
+                       uint16_t *table) {
+    if (size == 0 || size > LZ_BLOCK_MAX) {
+        return 0;
+    }
+    // 表项存位置 + 1，0 为空
+    memset(table, 0, LZ_BLOCK_HASH_SIZE * sizeof(uint16_t));
+    uint8_t *op = dst;
+    const uint8_t *end = dst + capacity;
+    size_t anchor = 0;
+    size_t ip = 0;
+    const size_t limit = size > LZ_MATCH_LIMIT ? size - LZ_MATCH_LIMIT : 0;
+    const size_t match_end = size - (size > LZ_LAST_LITERALS ? LZ_LAST_LITERALS : size);
+    while (ip < limit) {
+        const uint32_t v = read32(src + ip);
+        const uint32_t h = lz_hash(v);
+        const size_t cand = table[h];
+        table[h] = (uint16_t)(ip + 1);
+        if (cand == 0 || read32(src + cand - 1) != v) {
+            ip++;
+            continue;
+        }
+        const size_t ref = cand - 1;
+        size_t len = LZ_MIN_MATCH;
+        while (ip + len < match_end && src[ref + len] == src[ip + len]) {
+            len++;
+        }
+        op = put_sequence(op, end, src + anchor, ip - anchor, ip - ref, len);
+        if (op == NULL) {
+            return 0;
+        }
+        ip += len;
+        anchor = ip;
+    }
+    op = put_sequence(op, end, src + anchor, size - anchor, 0, 0);
+    return op != NULL ? (size_t)(op - dst) : 0;
+}
+
+// 读扩展长度；越界时返回 false
+static bool get_ext(const uint8_t *src, size_t src_len, size_t *ip, size_t *len) {
+    uint8_t b;
+    do {
+        if (*ip >= src_len) {
+            return false;
+        }
+        b = src[(*ip)++];
+        *len += b;
+    } while (b == 255);
+    return true;
+}
+
+bool lz_block_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t size) {
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < src_len) {
+        const uint8_t token = src[ip++];
+        size_t lit = token >> 4;
+        if (lit == 15 && !get_ext(src, src_len, &ip, &lit)) {
+            return false;
+        }
+        if (lit > src_len - ip || lit > size - op) {
+            return false;
+        }
+        memcpy(dst + op, src + ip, lit);
+        ip += lit;
+        op += lit;
+        if (ip == src_len) {
+            break;  // 最后一个序列没有匹配
+        }
+        if (src_len - ip < 2) {
+            return false;
+        }
+        const size_t offset = src[ip] | (size_t)src[ip + 1] << 8;
+        ip += 2;
+        size_t len = (token & 0x0F);
+        if (len == 15 && !get_ext(src, src_len, &ip, &len)) {
+            return false;
+        }
+        len += LZ_MIN_MATCH;
+        if (offset == 0 || offset > op || len > size - op) {
+            return false;
+        }
+        // 距离可能小于长度（重复串），逐字节拷贝
+        const uint8_t *from = dst + op - offset;
+        for (size_t i = 0; i < len; i++) {
+            dst[op + i] = from[i];
+        }
+        op += len;
+    }
+    return op == size;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file lz_block.h
+ * @brief 内存中的 LZ77 块压缩（LZ4 块格式的子集，用于常驻内存的章节正文）
+ *
+ * 每个序列：令牌字节（高 4 位原样长度，低 4 位匹配长度 - 4，取 15 时后跟若干字节累加，
+ * 遇到小于 255 的字节结束）、原样字节、2 字节小端匹配距离。最后一个序列只有原样字节。
+ * 每块独立压缩、独立解压，不依赖前面的块；解压只有拷贝，比从 SD 卡重读快得多
+ */
+
+#ifndef LZ_BLOCK_H
+#define LZ_BLOCK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define LZ_BLOCK_MAX        65535   // 单块最大字节数（匹配距离与哈希表项都是 16 位）
+#define LZ_BLOCK_HASH_BITS  10
+#define LZ_BLOCK_HASH_SIZE  (1u << LZ_BLOCK_HASH_BITS)   // 压缩工作区的项数（uint16_t）
+
+/**
+ * @brief 压缩一块
+ * @param src 原始数据（不超过 LZ_BLOCK_MAX 字节）
+ * @param size 字节数
+ * @param dst 输出
+ * @param capacity 输出缓冲区大小
+ * @param table 工作区，LZ_BLOCK_HASH_SIZE 项（内容不需要初始化）
+ * @return 压缩后的字节数；放不进 capacity 时返回 0（调用者按原样保存）
+ */
+size_t lz_block_encode(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity,
+                       uint16_t *table);
+
+/**
+ * @brief 解压一块，正好得到 size 字节
+ * @return true 数据完整（格式错误、越界或长度不符时返回 false）
+ */
+bool lz_block_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t size);
+
+#endif // LZ_BLOCK_H
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <inttypes.h>
 #include <string.h>
 #include <time.h>
@@ -13,14 +14,17 @@
 #include "esp_system.h"
 #include "esp_mac.h"
 #include "esp_sleep.h"
-#include "esp_wifi.h"
+#include "esp_timer.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_bt.h"
 #include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_heap_caps.h"
 #include "lwip/err.h"
 #include "lwip/sys.h"
 #include "esp_vfs_fat.h"
+#include "esp_littlefs.h"
 #include "sdmmc_cmd.h"
 #include "driver/sdspi_host.h"
 #include "driver/spi_common.h"
@@ -36,12 +40,47 @@
 #include "DEV_Config.h"
 #include "EPD_4in26.h"
 #include "ImageData.h"
-#include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_adc/adc_cali.h"
 #include "lvgl_driver.h"  // LVGL驱动适配层
+#include "power_manager.h" // 空闲浅睡眠
+#include "charge_maint.h"  // 充电且空闲时集中做重活
+#include "buttons.h"       // ADC 连续转换按键与电池采样
+#include "battery.h"       // 电池服务（滤波、放电曲线、缓存）
+#include "direct_screen.h" // 不经过 LVGL 的启动/低电量/关机画面
+#include "display_bench.h" // 显示流水线基准测试
+#include "text_bench.h"    // 文本流水线基准测试
+#include "x4im_frame.h"      // X4IM 紧凑帧解码
+#include "ble_writer.h"      // BLE 接收文件的异步 SD 写入
+#include "ble_live.h"        // X4IM 实时模式
+#include "x4js_layout.h"     // X4JS 布局编译与直接光栅化
+#include "ble_xfer.h"        // BLE 批量文件传输服务
+#include "ble_ota.h"         // BLE 固件更新（SD 卡上的差分补丁）
+#include "ble_shot.h"        // BLE 截图（压缩后的 framebuffer）
+#include "ble_bench.h"       // BLE 吞吐与延迟基准
+#include "ble_remote.h"      // BLE 翻页器输入
+#include "wifi_transfer.h"   // Wi-Fi 传输模式
+#include "usb_transfer.h"    // USB 传输模式
+#include "ble_power.h"       // 按需启动 BLE
+#include "boot_profile.h"    // 启动阶段计时
+#include "heap_stats.h"      // 堆遥测（分子系统占用、高水位）
+#include "lvgl_mem_pool.h"   // LVGL 弹性内存池（无线电关闭时附加堆上的池）
+#include "turn_stats.h"      // 翻页延时遥测（分阶段直方图，NVS 累计）
+#include "stack_stats.h"     // 任务栈遥测（各任务最高占用）
+#include "mem_pressure.h"    // 内存压力通知（缓存按优先级收缩）
+#include "profiler.h"        // 采样剖析器与按任务 CPU 统计
+#include "resume_state.h"    // 断电恢复阅读页
+#include "sd_path.h"         // 快照目录创建
+#include "sd_health.h"       // SD 卡只读健康检查
+#include "esp_rom_crc.h"
 #include "ui/screen_manager.h"  // 屏幕管理器
 #include "ui/font_manager.h"  // 字体管理器
+#include "ui/file_browser.h"  // 上传后使目录缓存失效
+#include "ui/flash_cache.h"   // 内部 flash 热块缓存
+#include "ui/file_pool.h"     // SD 卡只读句柄池
+#include "ui/position_journal.h"  // 阅读进度日志
+#include "ui/settings_store.h"  // 设置存储（开机读入内存）
+#include "ui/reader_screen.h"  // 断电恢复需要当前书籍路径
 #include "version.h"       // 自动生成的版本信息
 
 // ============================================================================
@@ -57,27 +96,41 @@
 #define BAT_GPIO0      GPIO_NUM_0  // 电池电压检测
 #define UART0_RXD      GPIO_NUM_20 // USB连接检测 (HIGH = USB已连接)
 
-// 按钮ADC阈值
-#define BTN_THRESHOLD           100    // 阈值容差
-#define BTN_RIGHT_VAL           3      // Right按钮ADC值
-#define BTN_LEFT_VAL            1470   // Left按钮ADC值
-#define BTN_CONFIRM_VAL         2655   // Confirm按钮ADC值
-#define BTN_BACK_VAL            3470   // Back按钮ADC值
-#define BTN_VOLUME_DOWN_VAL     3      // Volume Down按钮ADC值
-#define BTN_VOLUME_UP_VAL       2205   // Volume Up按钮ADC值
+// 按钮ADC阈值与消抖见 buttons.c
 
 // 按钮枚举定义在 lvgl_driver.h 中
 
 // 电源按钮时间定义
 #define POWER_BUTTON_WAKEUP_MS    1000  // 从睡眠唤醒需要按下时间
 #define POWER_BUTTON_SLEEP_MS     1000  // 进入睡眠需要按下时间
-
-// 电池监测 - ESP-IDF 6.1 新 API
-static adc_oneshot_unit_handle_t adc1_handle = NULL;
+#define BTN_SAMPLE_WAIT_MS        50    // 等按键任务读完一帧新转换结果的上限
+
+// 上电后的电源轨就绪检测（替代固定 1 秒延时）
+#define RAIL_SAMPLE_MS            10    // 电池电压采样间隔
+#define RAIL_STABLE_SAMPLES       3     // 连续多少次采样变化不超过容差视为稳定
+#define RAIL_TOLERANCE_MV         30
+#define RAIL_MIN_MV               3300  // 低于此电压继续等待（USB 供电时不要求）
+#define RAIL_TIMEOUT_MS           1000  // 最长等待，与原来的固定延时相同
+
+// 启动首屏快照：上次启动渲染好的首页 framebuffer，开机直接上传面板代替清屏
+#define BOOT_SNAPSHOT_PATH        "/sdcard/.x4cache/boot.fb"
+#define BOOT_SNAPSHOT_MAGIC       0x53423458u   // "X4BS"
+#define BOOT_SD_WAIT_MS           1500  // EPD 任务等待 SD 挂载结果的上限（超时则普通清屏）
+#define BOOT_EPD_WAIT_MS          5000  // 主任务等待 EPD 清屏/快照完成的上限
+#define BOOT_EV_SD_DONE           BIT0
+#define BOOT_EV_EPD_DONE          BIT1
+#define BOOT_EPD_TASK_STACK       4096
+
+// 运行中电量检查：电池过低时显示低电量画面并深度睡眠
+#define BATTERY_GUARD_PERIOD_MS   30000
+
+// 电池监测 - ESP-IDF 6.1 新 API（采样由 buttons.c 的连续转换完成）
 static adc_cali_handle_t adc1_cali_handle = NULL;
 static bool do_calibration = true;
 
 // BLE connection state management
+static bool ble_initialized = false;
+static bool ble_stopping = false;   // ble_stop in progress: do not restart advertising
 static bool ble_connected = false;
 static bool ble_advertising = false;
 static uint16_t ble_conn_handle = 0;
@@ -99,7 +152,6 @@ static volatile button_t current_pressed_button = BTN_NONE;
 // Forward declarations
 static int start_advertising(void);
 esp_err_t sd_card_init(void);
-void sd_card_test_read_write(const char *mount_point);
 
 #define SDCARD_MOUNT_POINT "/sdcard"
 #define SPI_DMA_CHAN    1
@@ -110,6 +162,24 @@ void sd_card_test_read_write(const char *mount_point);
 #define PIN_NUM_CLK   GPIO_NUM_8
 #define PIN_NUM_CS    GPIO_NUM_12   // SD_CS 专用引脚
 
+// SD 总线速度协商：在 DEV_CLK_SD（400 kHz）下挂载，再从高到低逐级尝试。
+// 每级读回卡开头的扇区与 400 kHz 下读到的参考数据比较（SPI 模式下每个数据块
+// 还有 CRC16 校验），第一级通过即采用；结果按卡的 CID 缓存在 NVS，下次启动直接验证该级
+#define SD_SPEED_NVS_NS      "sd_bus"
+#define SD_SPEED_NVS_KEY     "card"
+#define SD_VERIFY_SECTORS    4
+
+static const uint32_t s_sd_speed_ladder_khz[] = { 20000, 10000, 4000, 1000, 400 };
+
+typedef struct {
+    uint32_t serial;    // CID 序列号 + 厂商 + 产品名识别同一张卡
+    uint8_t mfg_id;
+    char name[8];
+    uint32_t khz;
+} sd_speed_cache_t;
+
+static uint32_t sd_negotiate_speed(sdmmc_card_t *card);
+
 // BLE initialization function — use esp_nimble_hci_and_controller_init() to avoid
 // controller state conflicts on ESP32-C3
 #define DEVICE_NAME "ESP32-BLE"
@@ -120,16 +190,44 @@ static const char *BLE_TAG = "BLE_MIN";
 #define IMAGE_SERVICE_UUID     0x1234
 #define IMAGE_DATA_CHAR_UUID   0x5678
 // GATT characteristic (ESP32 -> phone) for page control commands (notify ASCII: "prev"/"next"/"capture")
+// and transfer flow control ("pause"/"resume")
 #define CONTROL_CMD_CHAR_UUID  0x5679
+// GATT characteristic (read): heap telemetry as JSON (heap_stats_format_json): free, minimum
+// ever free, largest block, per-subsystem current/peak bytes and the current screen's low-water mark
+#define HEAP_STATS_CHAR_UUID   0x567A
+// GATT characteristic (read + write): sampling profiler (profiler.h). Write 0x01, duration ms
+// u32 LE, rate Hz u16 LE (0 = defaults) to start, 0x02 to stop early; read returns the last
+// report as text (task CPU shares, then the most frequent PCs; symbolize with tools/x4prof.py)
+#define PROFILER_CHAR_UUID     0x567B
+#define PROFILER_OP_START      0x01
+#define PROFILER_OP_STOP       0x02
 
 // Frame protocol (written by phone to 0x5678):
 // 0..3  : ASCII 'X4IM'
 // 4     : version = 1
-// 5     : format  = 1 (RGB565 little-endian)
-// 6..7  : reserved
+// 5     : format  = 1 (RGB565 little-endian), 2 (packed 1bpp), 3 (packed 2bpp),
+//                   4 (1bpp XOR delta against the previous frame, PackBits RLE);
+//                   see x4im_frame.h. Packed formats are decoded on receipt into the
+//                   EPD framebuffer layout and saved as a 48 KB .x4fb file
+// 6     : flags: bit0 = live (X4IM_FLAG_LIVE): shown on the display as it arrives,
+//         not saved to SD (see ble_live.h); other bits reserved
+// 7     : reserved
 // 8..11 : payload length (uint32 LE)
 #define X4IM_HDR_LEN 12
 
+// Region update (version 2): only a rectangle of the screen, applied to the framebuffer
+// and never saved. The panel is partially refreshed over every rectangle written since
+// the last refresh once a region with the commit flag has been written.
+// 0..3   : ASCII 'X4IM'
+// 4      : version = 2
+// 5      : format = 1 (RGB565, dithered) or 2 (1bpp, logical orientation, (w+7)/8 bytes per row)
+// 6      : flags: bit1 = commit (X4IM_FLAG_COMMIT)
+// 7      : reserved
+// 8..11  : payload length (uint32 LE)
+// 12..19 : x, y, w, h in logical (LVGL) coordinates (uint16 LE each)
+// 20..23 : frame id (uint32 LE), reported back through the status read
+#define X4IM_REGION_HDR_LEN 24
+
 // JSON layout protocol:
 // 0..3  : ASCII 'X4JS'
 // 4     : version = 1
@@ -137,18 +235,114 @@ static const char *BLE_TAG = "BLE_MIN";
 // 8..11 : payload length (uint32 LE)
 #define X4JS_HDR_LEN 12
 
+// Benchmark command (no payload):
+// 0..3  : ASCII 'X4BM'
+// 4     : version = 1
+// Runs the display benchmark; results are written to /sdcard/bench/*.csv
+#define X4BM_HDR_LEN 5
+
+// Text benchmark command (no payload):
+// 0..3  : ASCII 'X4TB'
+// 4     : version = 1
+// Runs the text pipeline benchmark on the /sdcard/bench corpus (text_bench.h)
+#define X4TB_HDR_LEN 5
+
+// Link tuning for bulk transfers, requested right after a connection is established.
+// A full-screen RGB565 frame is 768,000 bytes: at the default 23-byte MTU, 27-byte
+// LL packets, 1M PHY and a 30-50 ms interval that takes minutes; with 2M PHY,
+// 251-byte LL packets, a 517-byte MTU and a 7.5-15 ms interval it takes seconds.
+#define BLE_PREFERRED_MTU       517
+#define BLE_DLE_TX_OCTETS       251
+#define BLE_DLE_TX_TIME_US      2120     // 251 octets on 1M PHY (the controller scales it for 2M)
+#define BLE_CONN_ITVL_MIN       6        // x 1.25 ms = 7.5 ms
+#define BLE_CONN_ITVL_MAX       12       // x 1.25 ms = 15 ms
+#define BLE_CONN_SUPERVISION_TO 400      // x 10 ms = 4 s
+
+// Bulk file transfer service (FILE_XFER_SERVICE_UUID, see ble_xfer.h) for books and fonts.
+// Control characteristic 0x5680 (write + notify), data characteristic 0x5681 (write without
+// response). All integers little-endian.
+// START  (phone -> ctrl): 0x01, size u32, file CRC32 u32 (identifies the file for resume),
+//                         block size u16, path relative to /sdcard (UTF-8, no leading '/',
+//                         no segment starting with '.'); parent directories are created
+// ABORT  (phone -> ctrl): 0x02; the partial file is deleted
+// STATUS (phone -> ctrl): 0x03; answered with an ACK (resync after a lost notification)
+// Block  (phone -> data): block index u32, CRC32 of the payload u32, payload
+//                         (block size bytes; the last block carries the remainder)
+// START reply (notify)  : 0x81, status u8, first block to send u32, block size u16, window u8
+// ACK (notify)          : 0x82, status u8 (0 = ack, 1 = nak: resend from here), next block u32
+// DONE (notify)         : 0x83, status u8, file size u32
+// Status codes: 0 ok, 1 nak, 2 bad request, 3 SD error. The phone keeps at most `window`
+// blocks in flight beyond the last ACK; a disconnect keeps the .part file, and the next
+// START for the same path/size/CRC32 resumes from the reported block.
+
+// Firmware update service (OTA_SERVICE_UUID, see ble_ota.h). The X4DL patch from
+// tools/x4delta.py is first uploaded with the file transfer service above; the control
+// characteristic 0x5690 (write + notify) then applies it to the spare app partition.
+// APPLY    (phone -> ctrl): 0x01, patch path relative to /sdcard
+// STATUS   (phone -> ctrl): 0x02; answered with a STATE notification
+// REBOOT   (phone -> ctrl): 0x03; only accepted in state READY
+// ROLLBACK (phone -> ctrl): 0x04; boot the image in the other app partition
+// STATE (notify)          : 0x91, state u8, result u8, percent u8, bytes written u32,
+//                           image size u32
+// States: 0 idle, 1 checking the base image, 2 writing, 3 ready (reboot to activate),
+// 4 failed. Results: 0 ok, 1 bad patch, 2 base image is not the running firmware,
+// 3 I/O error, 4 CRC mismatch, 16 bad request/busy, 17 no OTA slot, 18 flash error,
+// 19 nothing to roll back to. A new image boots pending verification and is confirmed
+// after its first screen; resetting before that returns to the previous firmware.
+
+// Screenshot service (SHOT_SERVICE_UUID, see ble_shot.h). Characteristic 0x56A0 (write + notify):
+// CAPTURE (phone -> dev): 0x01; ABORT: 0x02
+// BEGIN (notify)        : 0xA1, status u8, width u16, height u16 (panel layout, 800x480),
+//                         raw size u32 (48,000), window u16
+// DATA (notify)         : 0xA2, sequence u16 (wraps), PackBits bytes (same coding as
+//                         packbits.h); notifications fill the negotiated MTU
+// END (notify)          : 0xA3, status u8, flags u8 (bit0: the screen was redrawn during the
+//                         capture), compressed size u32, CRC32 of the raw framebuffer u32
+// Status codes: 0 ok, 1 busy, 2 no framebuffer (grayscale mode), 3 aborted, 4 out of memory.
+// The decoded frame is 100 bytes per row, MSB first, 1 = white.
+
+// Link benchmark service (BENCH_SERVICE_UUID, see ble_bench.h; host side: tools/x4blebench.py).
+// Control characteristic 0x56C0 (write + notify), data characteristic 0x56C1 (write, write
+// without response, notify). All integers little-endian; times in microseconds.
+// SINK_RESET  (phone -> ctrl): 0x01; clears the receive statistics
+// SINK_REPORT (phone -> ctrl): 0x02; answered with SINK
+// SOURCE      (phone -> ctrl): 0x03, total bytes u32 (max 16 MB), bytes per notification u16
+//                              (0 = fill the MTU); needs notifications on the data characteristic
+// STOP        (phone -> ctrl): 0x04; ends a running SOURCE (END with status 3)
+// ECHO        (phone -> ctrl): 0x05, token (up to 16 bytes); answered at once with ECHO
+// LINK        (phone -> ctrl): 0x06; answered with LINK
+// PARAMS      (phone -> ctrl): 0x07, interval min u16, interval max u16 (x 1.25 ms), latency u16,
+//                              PHY mask u8 (1 = 1M, 2 = 2M, 4 = coded, 0 = unchanged);
+//                              interval 0 leaves the interval unchanged
+// Sink packet (phone -> data): sequence u32, any payload; only counted
+// Source packet (data notify): sequence u32, device time since SOURCE u32, filler
+// SINK (notify)   : 0xC2, packets u32, bytes u32, missing u32 (sequence gaps), reordered u32,
+//                   first-to-last arrival u32, largest arrival gap u32, arrival gap stddev u32
+// BEGIN (notify)  : 0xC3, status u8, bytes per notification u16
+// END (notify)    : 0xC4, status u8, packets u32, bytes u32, elapsed u32, retries u32 (times the
+//                   notification buffers ran out and the sender had to back off)
+// ECHO (notify)   : 0xC5, token, device time u32
+// LINK (notify)   : 0xC6, MTU u16, interval u16 (x 1.25 ms), latency u16, supervision timeout
+//                   u16 (x 10 ms), TX PHY u8, RX PHY u8 (1 = 1M, 2 = 2M, 3 = coded)
+// PARAMS (notify) : 0xC7, NimBLE result u8 (0 = requested; the peer decides, query LINK later)
+// Status codes: 0 ok, 1 busy, 2 bad request, 3 aborted, 4 data notifications not enabled.
+
+// Flow control notifications on CONTROL_CMD_CHAR_UUID while a file is being received:
+// "pause" when the SD writer's ring buffer is nearly full, "resume" once it has drained
+
 // Image data storage - using external storage for large images
 // static uint8_t image_data[160 * 120 * 2]; // Removed to save DRAM
 static uint32_t image_data_len = 0;
 static uint32_t image_expected_len = (480u * 800u * 2u);
 static bool image_data_ready = false;
 static uint32_t image_frame_id = 0;
+static uint8_t image_format = X4IM_FMT_RGB565;
+static bool image_live = false;
+static bool image_region = false;
 static char current_image_filename[64] = {0};
-static FILE *image_file = NULL;
 
 // JSON layout storage
 static char current_json_filename[64] = {0};
-static FILE *json_file = NULL;
 static uint32_t json_data_len = 0;
 static uint32_t json_expected_len = 0;
 static bool json_data_ready = false;
@@ -177,76 +371,26 @@ static const char* get_button_name(button_t btn) {
     }
 }
 
-// 读取当前按下的按钮 (ADC电阻分压方案) - ESP-IDF 6.1
-// 注意：此函数被lvgl_driver.c调用，所以不能是static
+// 读取当前按下的按钮：等按键任务读完一帧新的转换结果（浅睡眠唤醒后检查用）
+// 注意：此函数被power_manager.c调用，所以不能是static
 button_t get_pressed_button(void) {
-    int btn1_adc, btn2_adc;
-    int btn1 = 0, btn2 = 0;
-
-    // 读取ADC值多次取平均
-    for (int i = 0; i < 3; i++) {
-        adc_oneshot_read(adc1_handle, ADC_CHANNEL_1, &btn1_adc); // GPIO1
-        adc_oneshot_read(adc1_handle, ADC_CHANNEL_2, &btn2_adc); // GPIO2
-        btn1 += btn1_adc;
-        btn2 += btn2_adc;
-    }
-    btn1 /= 3;
-    btn2 /= 3;
-
-    // 调试：记录上一次的按钮状态
-    static button_t last_btn = BTN_NONE;
-
-    button_t detected_btn = BTN_NONE;  // 预先检测按钮
-
-    // 检查电源按钮 (数字输入)
-    if (gpio_get_level(BTN_GPIO3) == 0) {
-        detected_btn = BTN_POWER;
-    }
-    // 检查 BTN_GPIO1 (4个按钮通过电阻分压)
-    else if (btn1 < BTN_RIGHT_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_RIGHT;
-    } else if (btn1 < BTN_LEFT_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_LEFT;
-    } else if (btn1 < BTN_CONFIRM_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_CONFIRM;
-    } else if (btn1 < BTN_BACK_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_BACK;
-    }
-    // 检查 BTN_GPIO2 (2个按钮通过电阻分压)
-    else if (btn2 < BTN_VOLUME_DOWN_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_VOLUME_DOWN;
-    } else if (btn2 < BTN_VOLUME_UP_VAL + BTN_THRESHOLD) {
-        detected_btn = BTN_VOLUME_UP;
-    }
-
-    // 只在按钮变化时打印（调试用）
-    if (detected_btn != last_btn) {
-        ESP_LOGD("BTN_ADC", "GPIO1=%4d, GPIO2=%4d | Detected: %d (%s)",
-                 btn1, btn2, detected_btn, get_button_name(detected_btn));
-        last_btn = detected_btn;
-    }
-
-    return detected_btn;
+    const button_t btn = buttons_sample(BTN_SAMPLE_WAIT_MS);
+    ESP_LOGD("BTN_ADC", "Sampled: %d (%s)", btn, get_button_name(btn));
+    return btn;
 }
 
 // 初始化按钮和ADC - ESP-IDF 6.1
 static void buttons_adc_init(void) {
     ESP_LOGI("BTN", "Initializing buttons and ADC...");
 
-    // 配置 ADC Oneshot 模式
-    adc_oneshot_unit_init_cfg_t init_config1 = {
-        .unit_id = ADC_UNIT_1,
-    };
-    ESP_ERROR_CHECK(adc_oneshot_new_unit(&init_config1, &adc1_handle));
-
-    // 配置 ADC 通道
-    adc_oneshot_chan_cfg_t config = {
-        .bitwidth = ADC_BITWIDTH_12,
-        .atten = ADC_ATTEN_DB_12,  // ESP-IDF 6.1 使用 DB_12 而不是 DB_11
+    // ADC 连续转换：电池 + 两路按键分压，同一个转换序列
+    const buttons_config_t btn_cfg = {
+        .ladder_a = ADC_CHANNEL_1,   // GPIO1 - 按钮1
+        .ladder_b = ADC_CHANNEL_2,   // GPIO2 - 按钮2
+        .battery = ADC_CHANNEL_0,    // GPIO0 - 电池
+        .power_gpio = BTN_GPIO3,     // 电源按钮 (数字输入)
     };
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, ADC_CHANNEL_0, &config)); // GPIO0 - 电池
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, ADC_CHANNEL_1, &config)); // GPIO1 - 按钮1
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, ADC_CHANNEL_2, &config)); // GPIO2 - 按钮2
+    ESP_ERROR_CHECK(buttons_init(&btn_cfg) ? ESP_OK : ESP_FAIL);
 
     // ADC 校准
     if (do_calibration) {
@@ -264,21 +408,16 @@ static void buttons_adc_init(void) {
         }
     }
 
-    // 配置按钮引脚
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << BTN_GPIO3),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&io_conf);
-
     // 配置电池检测引脚
     gpio_set_direction(BAT_GPIO0, GPIO_MODE_INPUT);
 
-    // 配置USB检测引脚
-    gpio_set_direction(UART0_RXD, GPIO_MODE_INPUT);
+    // 电池服务：低频采样并缓存，界面读取不再同步采样（同时配置 USB 检测引脚）
+    const battery_config_t bat_cfg = {
+        .cali = do_calibration ? adc1_cali_handle : NULL,
+        .charge_gpio = UART0_RXD,
+        .period_ms = BATTERY_PERIOD_MS_DEFAULT,
+    };
+    battery_init(&bat_cfg);
 
     ESP_LOGI("BTN", "Buttons and ADC initialized");
 }
@@ -288,42 +427,199 @@ static bool is_charging(void) {
     return gpio_get_level(UART0_RXD) == 1;
 }
 
-// 读取电池电压 (mV) - ESP-IDF 6.1
+// 电池电压 (mV)：电池服务最近发布的滤波值，不访问 ADC
 static uint32_t read_battery_voltage_mv(void) {
-    int adc_raw = 0;
-    int adc_result;
-    for (int i = 0; i < 10; i++) {
-        adc_oneshot_read(adc1_handle, ADC_CHANNEL_0, &adc_result);
-        adc_raw += adc_result;
-    }
-    adc_raw /= 10;
+    battery_status_t bat;
+    battery_get(&bat);
+    return bat.mv;
+}
 
-    int voltage = adc_raw;
-    if (do_calibration && adc1_cali_handle) {
-        adc_cali_raw_to_voltage(adc1_cali_handle, adc_raw, &voltage);
-    } else {
-        // 未校准时的近似值: ADC值 * 1.1mV * 2 (分压系数)
-        voltage = (adc_raw * 1100) / 2048 * 2;
-    }
+// 电池百分比（按放电曲线换算）
+static uint8_t read_battery_percentage(void) {
+    battery_status_t bat;
+    battery_get(&bat);
+    return bat.pct;
+}
 
-    // 分压系数: Xteink X4 使用电阻分压，实际电压需要乘以系数
-    // 通常分压比为 2:1，所以实际电压 = ADC电压 * 2
-    return (uint32_t)voltage * 2;
+// 电池发布序号：变化时界面才重读电压与百分比
+static uint32_t read_battery_seq(void) {
+    battery_status_t bat;
+    battery_get(&bat);
+    return bat.seq;
 }
 
-// 读取电池百分比
-static uint8_t read_battery_percentage(void) {
-    uint32_t voltage_mv = read_battery_voltage_mv();
-    // 简单线性映射: 3.0V = 0%, 4.2V = 100%
-    if (voltage_mv < 3000) return 0;
-    if (voltage_mv > 4200) return 100;
-    return (voltage_mv - 3000) * 100 / (4200 - 3000);
+// 电源轨就绪检测：EPD 清屏的大电流过后电池电压回升并稳定即可继续，
+// 一般几十毫秒；电池电压过低或一直波动时最多等待 RAIL_TIMEOUT_MS
+static void wait_power_rail_ready(void) {
+    const int64_t start_us = esp_timer_get_time();
+    uint32_t prev_mv = battery_read_mv();
+    uint32_t mv = prev_mv;
+    int stable = 0;
+    while (stable < RAIL_STABLE_SAMPLES &&
+           esp_timer_get_time() - start_us < (int64_t)RAIL_TIMEOUT_MS * 1000) {
+        vTaskDelay(pdMS_TO_TICKS(RAIL_SAMPLE_MS));
+        mv = battery_read_mv();
+        const uint32_t diff = mv > prev_mv ? mv - prev_mv : prev_mv - mv;
+        prev_mv = mv;
+        if (diff <= RAIL_TOLERANCE_MV && (mv >= RAIL_MIN_MV || is_charging())) {
+            stable++;
+        } else {
+            stable = 0;
+        }
+    }
+    ESP_LOGI("MAIN", "Power rail %s after %lld ms (%lu mV)",
+             stable >= RAIL_STABLE_SAMPLES ? "ready" : "not settled, continuing",
+             (long long)((esp_timer_get_time() - start_us) / 1000), (unsigned long)mv);
+}
+
+static uint16_t read_le_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
 }
 
 static uint32_t read_le_u32(const uint8_t *p) {
     return ((uint32_t)p[0]) | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
+// Hand bytes [offset, offset + len) of an mbuf chain to sink() segment by segment,
+// without flattening the chain into a temporary buffer first
+static bool for_each_mbuf_segment(const struct os_mbuf *om, uint32_t offset, uint32_t len,
+                                  bool (*sink)(const uint8_t *data, size_t n, void *ctx), void *ctx) {
+    for (const struct os_mbuf *m = om; m != NULL && len > 0; m = SLIST_NEXT(m, om_next)) {
+        if (offset >= m->om_len) {
+            offset -= m->om_len;
+            continue;
+        }
+        uint32_t n = m->om_len - offset;
+        if (n > len) n = len;
+        if (!sink(m->om_data + offset, n, ctx)) {
+            return false;
+        }
+        len -= n;
+        offset = 0;
+    }
+    return len == 0;
+}
+
+static bool writer_sink(const uint8_t *data, size_t n, void *ctx) {
+    (void)ctx;
+    ble_writer_append(data, n);
+    return true;
+}
+
+static bool frame_sink(const uint8_t *data, size_t n, void *ctx) {
+    (void)ctx;
+    return x4im_frame_feed(data, n);
+}
+
+static bool live_sink(const uint8_t *data, size_t n, void *ctx) {
+    (void)ctx;
+    return ble_live_feed(data, n);
+}
+
+// Queue payload bytes for the SD writer task; fails when its ring buffer cannot take
+// the whole write (the phone ignored "pause") or an earlier SD write failed
+static bool write_mbuf_to_file(ble_writer_slot_t slot, const struct os_mbuf *om, uint32_t offset, uint32_t len) {
+    if (!ble_writer_write_begin(slot, len)) {
+        return false;
+    }
+    return for_each_mbuf_segment(om, offset, len, writer_sink, NULL);
+}
+
+static bool json_sink(const uint8_t *data, size_t n, void *ctx) {
+    (void)ctx;
+    ble_writer_append(data, n);
+    x4js_layout_feed(data, n);
+    return true;
+}
+
+// Same as write_mbuf_to_file, and hashes the JSON layout for the display-list cache
+static bool write_json_payload(const struct os_mbuf *om, uint32_t offset, uint32_t len) {
+    if (!ble_writer_write_begin(BLE_WRITER_SLOT_JSON, len)) {
+        return false;
+    }
+    return for_each_mbuf_segment(om, offset, len, json_sink, NULL);
+}
+
+// Write a decoded packed frame (framebuffer layout) to SD in one go
+static bool save_packed_frame(const char *path) {
+    const uint8_t *frame = x4im_frame_data();
+    if (frame == NULL) {
+        ESP_LOGE(BLE_TAG, "Packed frame incomplete after %" PRIu32 " bytes", image_data_len);
+        return false;
+    }
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        ESP_LOGE(BLE_TAG, "Failed to open image file for writing");
+        return false;
+    }
+    const size_t size = (EPD_4in26_WIDTH * EPD_4in26_HEIGHT) / 8;
+    const bool ok = fwrite(frame, 1, size, fp) == size;
+    fclose(fp);
+    if (!ok) {
+        ESP_LOGE(BLE_TAG, "Failed to write decoded frame to %s", path);
+        remove(path);
+        return false;
+    }
+    file_browser_invalidate_cache();
+    return true;
+}
+
+// Notify the phone on the control characteristic (ASCII command); kept for READ as well
+static void send_control_cmd(const char *cmd) {
+    strncpy(last_control_cmd, cmd, sizeof(last_control_cmd) - 1);
+    last_control_cmd[sizeof(last_control_cmd) - 1] = '\0';
+    if (!ble_connected || !cmd_notify_enabled || control_cmd_chr_val_handle == 0) {
+        return;
+    }
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(last_control_cmd, strlen(last_control_cmd));
+    if (om == NULL) {
+        ESP_LOGW(BLE_TAG, "No mbuf for \"%s\" notification", cmd);
+        return;
+    }
+    const int rc = ble_gatts_notify_custom(ble_conn_handle, control_cmd_chr_val_handle, om);
+    if (rc != 0) {
+        ESP_LOGW(BLE_TAG, "\"%s\" notification failed: %d", cmd, rc);
+    }
+}
+
+// SD writer flow control (called from the NimBLE host task or the writer task)
+static void writer_flow_cb(bool pause) {
+    ESP_LOGI(BLE_TAG, "SD writer %s", pause ? "nearly full, pausing sender" : "drained, resuming sender");
+    send_control_cmd(pause ? "pause" : "resume");
+}
+
+// Memory profile (ble_power.h). The SD writer ring has a single producer, so it is only
+// allocated or freed from the host task, or while the host is not running
+#define BLE_WRITER_RELEASE_WAIT_MS 500
+static ble_power_profile_t ble_profile = BLE_POWER_PROFILE_LEAN;
+static struct ble_npl_event ble_profile_ev;
+
+static void ble_profile_apply(void)
+{
+    if (ble_profile == BLE_POWER_PROFILE_FULL) {
+        if (!ble_writer_init(writer_flow_cb)) {
+            mem_pressure_request(BLE_WRITER_FOOTPRINT);
+        }
+    } else if (!ble_connected && !ble_writer_busy()) {
+        (void)ble_writer_release(BLE_WRITER_RELEASE_WAIT_MS);
+    }
+}
+
+static void ble_profile_ev_cb(struct ble_npl_event *ev)
+{
+    (void)ev;
+    ble_profile_apply();
+}
+
+// ble_power callback (LVGL task): hand the switch over to the host task
+static void ble_set_profile(ble_power_profile_t profile)
+{
+    ble_profile = profile;
+    if (ble_initialized && !ble_stopping) {
+        ble_npl_eventq_put(nimble_port_get_dflt_eventq(), &ble_profile_ev);
+    }
+}
+
 static int control_cmd_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                                 struct ble_gatt_access_ctxt *ctxt, void *arg)
 {
@@ -341,6 +637,62 @@ static int control_cmd_chr_access(uint16_t conn_handle, uint16_t attr_handle,
     return BLE_ATT_ERR_READ_NOT_PERMITTED;
 }
 
+static int heap_stats_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                                 struct ble_gatt_access_ctxt *ctxt, void *arg)
+{
+    (void)conn_handle;
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    // Long reads come back here once per chunk; NimBLE slices the value by offset.
+    // Static: only the NimBLE host task calls this, and its stack is small
+    static char json[512];
+    const size_t len = heap_stats_format_json(json, sizeof(json));
+    int rc = os_mbuf_append(ctxt->om, json, len);
+    return rc == 0 ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+}
+
+static int profiler_chr_access(uint16_t conn_handle, uint16_t attr_handle,
+                               struct ble_gatt_access_ctxt *ctxt, void *arg)
+{
+    (void)conn_handle;
+    (void)attr_handle;
+    (void)arg;
+
+    if (ctxt->op == BLE_GATT_ACCESS_OP_READ_CHR) {
+        // Same long-read slicing as the heap stats characteristic
+        static char report[PROFILER_BLE_REPORT_MAX];
+        const size_t len = profiler_copy_report(report, sizeof(report));
+        int rc = os_mbuf_append(ctxt->om, report, len);
+        return rc == 0 ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
+    }
+    if (ctxt->op != BLE_GATT_ACCESS_OP_WRITE_CHR) {
+        return BLE_ATT_ERR_UNLIKELY;
+    }
+    uint8_t cmd[7] = {0};
+    const uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
+    if (len == 0 || len > sizeof(cmd)) {
+        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+    }
+    os_mbuf_copydata(ctxt->om, 0, len, cmd);
+    if (cmd[0] == PROFILER_OP_START) {
+        const uint32_t duration_ms = read_le_u32(&cmd[1]);
+        const uint32_t rate_hz = (uint32_t)cmd[5] | ((uint32_t)cmd[6] << 8);
+        if (!profiler_start(duration_ms, rate_hz)) {
+            ESP_LOGW(BLE_TAG, "Profiler busy or out of memory");
+        }
+        return 0;
+    }
+    if (cmd[0] == PROFILER_OP_STOP) {
+        profiler_stop();
+        return 0;
+    }
+    return BLE_ATT_ERR_REQ_NOT_SUPPORTED;
+}
+
 // GATT characteristic access functions
 static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                                 struct ble_gatt_access_ctxt *ctxt, void *arg)
@@ -379,23 +731,43 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
         // Streamed frame write (header + sequential chunks).
         // Supports both X4IM (image) and X4JS (JSON layout)
         {
-            uint16_t len = OS_MBUF_PKTLEN(ctxt->om);
-            if (len == 0) {
+            const uint16_t copy_len = OS_MBUF_PKTLEN(ctxt->om);
+            if (copy_len == 0) {
                 return 0;
             }
-            if (len > 600) {
-                ESP_LOGW(BLE_TAG, "Write too large for temp buffer: %u", len);
-                return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
-            }
-            uint8_t tmp[600];
-            uint16_t copy_len = 0;
-            rc = ble_hs_mbuf_to_flat(ctxt->om, tmp, len, &copy_len);
+            // Only the header is flattened; payload bytes go from the mbuf chain to the file
+            uint8_t tmp[X4IM_REGION_HDR_LEN] = {0};
+            rc = os_mbuf_copydata(ctxt->om, 0, copy_len < sizeof(tmp) ? copy_len : sizeof(tmp), tmp);
             if (rc != 0) {
                 return BLE_ATT_ERR_INSUFFICIENT_RES;
             }
 
             uint32_t offset = 0;
 
+            // Benchmark command: only between transfers so payload bytes are never misread
+            if ((json_data_len == 0 || json_data_ready) &&
+                (image_data_len == 0 || image_data_ready) &&
+                copy_len >= X4BM_HDR_LEN &&
+                tmp[0] == 'X' && tmp[1] == '4' && tmp[2] == 'B' && tmp[3] == 'M' &&
+                tmp[4] == 1) {
+                ESP_LOGI(BLE_TAG, "Benchmark command received");
+                if (!display_bench_request()) {
+                    ESP_LOGW(BLE_TAG, "Benchmark already running");
+                }
+                return 0;
+            }
+            if ((json_data_len == 0 || json_data_ready) &&
+                (image_data_len == 0 || image_data_ready) &&
+                copy_len >= X4TB_HDR_LEN &&
+                tmp[0] == 'X' && tmp[1] == '4' && tmp[2] == 'T' && tmp[3] == 'B' &&
+                tmp[4] == 1) {
+                ESP_LOGI(BLE_TAG, "Text benchmark command received");
+                if (!text_bench_request()) {
+                    ESP_LOGW(BLE_TAG, "Benchmark already running");
+                }
+                return 0;
+            }
+
             // Check for X4JS (JSON) header first
             if ((json_data_len == 0 || json_data_ready) &&
                 copy_len >= X4JS_HDR_LEN &&
@@ -406,10 +778,7 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                 json_data_len = 0;
                 json_data_ready = false;
 
-                if (json_file != NULL) {
-                    fclose(json_file);
-                    json_file = NULL;
-                }
+                ble_writer_close(BLE_WRITER_SLOT_JSON);
                 memset(current_json_filename, 0, sizeof(current_json_filename));
 
                 time_t now;
@@ -418,12 +787,13 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                 localtime_r(&now, &timeinfo);
                 strftime(current_json_filename, sizeof(current_json_filename), "/sdcard/layout_%Y%m%d_%H%M%S.json", &timeinfo);
 
-                json_file = fopen(current_json_filename, "wb");
-                if (json_file == NULL) {
+                if (!ble_writer_open_reserved(BLE_WRITER_SLOT_JSON, current_json_filename, payload_len)) {
                     ESP_LOGE(BLE_TAG, "Failed to open JSON file");
                     memset(current_json_filename, 0, sizeof(current_json_filename));
                     return BLE_ATT_ERR_INSUFFICIENT_RES;
                 }
+                file_browser_invalidate_cache();
+                x4js_layout_begin();
 
                 offset = X4JS_HDR_LEN;
                 ESP_LOGI(BLE_TAG, "JSON start len=%" PRIu32 ", file=%s", json_expected_len, current_json_filename);
@@ -433,11 +803,9 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                     uint32_t space = json_expected_len;
                     if (remaining > space) remaining = space;
                     if (remaining > 0) {
-                        size_t written = fwrite(&tmp[offset], 1, remaining, json_file);
-                        if (written != remaining) {
-                            ESP_LOGE(BLE_TAG, "Failed to write JSON initial data (written=%zu, expected=%" PRIu32 ")", written, remaining);
-                            fclose(json_file);
-                            json_file = NULL;
+                        if (!write_json_payload(ctxt->om, offset, remaining)) {
+                            ESP_LOGE(BLE_TAG, "Failed to queue JSON initial data (%" PRIu32 " bytes)", remaining);
+                            ble_writer_close(BLE_WRITER_SLOT_JSON);
                             memset(current_json_filename, 0, sizeof(current_json_filename));
                             return BLE_ATT_ERR_INSUFFICIENT_RES;
                         }
@@ -447,24 +815,22 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                 
                 if (json_data_len >= json_expected_len && json_expected_len > 0) {
                     json_data_ready = true;
-                    fclose(json_file);
-                    json_file = NULL;
+                    ble_writer_close(BLE_WRITER_SLOT_JSON);
                     ESP_LOGI(BLE_TAG, "JSON complete: %" PRIu32 " bytes", json_data_len);
+                    x4js_layout_submit(current_json_filename);
                 }
                 return 0;
             }
             
             // Continue JSON chunk
-            if (json_file != NULL && !json_data_ready) {
+            if (ble_writer_is_open(BLE_WRITER_SLOT_JSON) && !json_data_ready) {
                 uint32_t remaining = copy_len;
                 uint32_t space = (json_expected_len > json_data_len) ? (json_expected_len - json_data_len) : 0;
                 if (remaining > space) remaining = space;
                 if (remaining > 0) {
-                    size_t written = fwrite(tmp, 1, remaining, json_file);
-                    if (written != remaining) {
-                        ESP_LOGE(BLE_TAG, "Failed to write JSON data (written=%zu, expected=%" PRIu32 ")", written, remaining);
-                        fclose(json_file);
-                        json_file = NULL;
+                    if (!write_json_payload(ctxt->om, 0, remaining)) {
+                        ESP_LOGE(BLE_TAG, "Failed to queue JSON data (%" PRIu32 " bytes)", remaining);
+                        ble_writer_close(BLE_WRITER_SLOT_JSON);
                         memset(current_json_filename, 0, sizeof(current_json_filename));
                         return BLE_ATT_ERR_INSUFFICIENT_RES;
                     }
@@ -473,19 +839,59 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
 
                 if (json_data_len >= json_expected_len && json_expected_len > 0) {
                     json_data_ready = true;
-                    fclose(json_file);
-                    json_file = NULL;
+                    ble_writer_close(BLE_WRITER_SLOT_JSON);
                     ESP_LOGI(BLE_TAG, "JSON complete: %" PRIu32 " bytes", json_data_len);
+                    x4js_layout_submit(current_json_filename);
                 }
                 return 0;
             }
 
+            // Check for X4IM region update header
+            if ((image_data_len == 0 || image_data_ready) &&
+                copy_len >= X4IM_REGION_HDR_LEN &&
+                tmp[0] == 'X' && tmp[1] == '4' && tmp[2] == 'I' && tmp[3] == 'M' && tmp[4] == 2) {
+                const uint32_t payload_len = read_le_u32(&tmp[8]);
+                const uint16_t rx = read_le_u16(&tmp[12]);
+                const uint16_t ry = read_le_u16(&tmp[14]);
+                const uint16_t rw = read_le_u16(&tmp[16]);
+                const uint16_t rh = read_le_u16(&tmp[18]);
+                if (!ble_live_begin_region(rx, ry, rw, rh, tmp[5], (tmp[6] & X4IM_FLAG_COMMIT) != 0,
+                                           payload_len)) {
+                    return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+                }
+                image_format = tmp[5];
+                image_live = true;
+                image_region = true;
+                image_expected_len = payload_len;
+                image_data_len = 0;
+                image_data_ready = false;
+                image_frame_id = read_le_u32(&tmp[20]);
+                ble_writer_close(BLE_WRITER_SLOT_IMAGE);
+                memset(current_image_filename, 0, sizeof(current_image_filename));
+
+                offset = X4IM_REGION_HDR_LEN;
+                ESP_LOGI(BLE_TAG, "region id=%" PRIu32 " %ux%u at (%u,%u) format=%u%s",
+                         image_frame_id, rw, rh, rx, ry, image_format,
+                         (tmp[6] & X4IM_FLAG_COMMIT) ? " commit" : "");
+            }
+
             // Check for X4IM (image) header
             if ((image_data_len == 0 || image_data_ready) &&
                 copy_len >= X4IM_HDR_LEN &&
                 tmp[0] == 'X' && tmp[1] == '4' && tmp[2] == 'I' && tmp[3] == 'M' &&
-                tmp[4] == 1 && tmp[5] == 1) {
+                tmp[4] == 1 && (tmp[5] == X4IM_FMT_RGB565 || x4im_frame_is_packed(tmp[5]))) {
                 const uint32_t payload_len = read_le_u32(&tmp[8]);
+                // Packed formats are decoded as they arrive; the 48 KB result is saved at the end
+                if (x4im_frame_is_packed(tmp[5]) && !x4im_frame_begin(tmp[5], payload_len)) {
+                    return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+                }
+                const bool live = (tmp[6] & X4IM_FLAG_LIVE) != 0;
+                if (live && tmp[5] == X4IM_FMT_RGB565 && !ble_live_begin(payload_len)) {
+                    return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+                }
+                image_format = tmp[5];
+                image_live = live;
+                image_region = false;
                 // Accept any size since we use external storage
                 image_expected_len = payload_len;
                 image_data_len = 0;
@@ -493,29 +899,36 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                 image_frame_id++;
 
                 // Close any previous file (e.g., aborted transfer)
-                if (image_file != NULL) {
-                    fclose(image_file);
-                    image_file = NULL;
-                }
+                ble_writer_close(BLE_WRITER_SLOT_IMAGE);
                 memset(current_image_filename, 0, sizeof(current_image_filename));
 
-                // Create filename with timestamp
-                time_t now;
-                time(&now);
-                struct tm timeinfo;
-                localtime_r(&now, &timeinfo);
-                strftime(current_image_filename, sizeof(current_image_filename), "/sdcard/image_%Y%m%d_%H%M%S.raw", &timeinfo);
+                // Create filename with timestamp (live frames go to the display, not to SD)
+                if (!image_live) {
+                    time_t now;
+                    time(&now);
+                    struct tm timeinfo;
+                    localtime_r(&now, &timeinfo);
+                    strftime(current_image_filename, sizeof(current_image_filename),
+                             image_format == X4IM_FMT_RGB565 ? "/sdcard/image_%Y%m%d_%H%M%S.raw"
+                                                             : "/sdcard/image_%Y%m%d_%H%M%S.x4fb",
+                             &timeinfo);
+                }
 
                 // Open file for writing
-                image_file = fopen(current_image_filename, "wb");
-                if (image_file == NULL) {
-                    ESP_LOGE(BLE_TAG, "Failed to open image file for writing");
-                    memset(current_image_filename, 0, sizeof(current_image_filename));
-                    return BLE_ATT_ERR_INSUFFICIENT_RES;
+                if (image_format == X4IM_FMT_RGB565 && !image_live) {
+                    if (!ble_writer_open_reserved(BLE_WRITER_SLOT_IMAGE, current_image_filename,
+                                                  payload_len)) {
+                        ESP_LOGE(BLE_TAG, "Failed to open image file for writing");
+                        memset(current_image_filename, 0, sizeof(current_image_filename));
+                        return BLE_ATT_ERR_INSUFFICIENT_RES;
+                    }
+                    file_browser_invalidate_cache();
                 }
 
                 offset = X4IM_HDR_LEN;
-                ESP_LOGI(BLE_TAG, "frame start id=%" PRIu32 " len=%" PRIu32 ", file=%s", image_frame_id, image_expected_len, current_image_filename);
+                ESP_LOGI(BLE_TAG, "frame start id=%" PRIu32 " format=%u len=%" PRIu32 ", %s%s",
+                         image_frame_id, image_format, image_expected_len,
+                         image_live ? "live" : "file=", current_image_filename);
             }
 
             // Append remaining payload bytes.
@@ -525,27 +938,53 @@ static int image_data_chr_access(uint16_t conn_handle, uint16_t attr_handle,
                 if (remaining > space) {
                     remaining = space;
                 }
-                if (remaining > 0 && image_file != NULL) {
-                    size_t written = fwrite(&tmp[offset], 1, remaining, image_file);
-                    if (written != remaining) {
-                        ESP_LOGE(BLE_TAG, "Failed to write to image file (written=%zu, expected=%" PRIu32 ")", written, remaining);
-                        fclose(image_file);
-                        image_file = NULL;
+                if (remaining > 0 && x4im_frame_is_packed(image_format) && !image_region) {
+                    if (!for_each_mbuf_segment(ctxt->om, offset, remaining, frame_sink, NULL)) {
+                        // The delta base is now unknown: the phone has to resend a full frame
+                        image_data_len = 0;
+                        image_data_ready = false;
+                        memset(current_image_filename, 0, sizeof(current_image_filename));
+                        return BLE_ATT_ERR_INVALID_ATTR_VALUE_LEN;
+                    }
+                    image_data_len += remaining;
+                } else if (remaining > 0 && image_live) {
+                    if (!for_each_mbuf_segment(ctxt->om, offset, remaining, live_sink, NULL)) {
+                        image_data_len = 0;
+                        image_data_ready = false;
+                        return BLE_ATT_ERR_INSUFFICIENT_RES;
+                    }
+                    image_data_len += remaining;
+                } else if (remaining > 0 && ble_writer_is_open(BLE_WRITER_SLOT_IMAGE)) {
+                    if (!write_mbuf_to_file(BLE_WRITER_SLOT_IMAGE, ctxt->om, offset, remaining)) {
+                        ESP_LOGE(BLE_TAG, "Failed to queue image data (%" PRIu32 " bytes)", remaining);
+                        ble_writer_close(BLE_WRITER_SLOT_IMAGE);
                         memset(current_image_filename, 0, sizeof(current_image_filename));
                         return BLE_ATT_ERR_INSUFFICIENT_RES;
                     }
-                    // 修复：使用实际写入的字节数，而不是期望的字节数
-                    image_data_len += (uint32_t)written;
+                    image_data_len += remaining;
                 }
             }
 
             if (!image_data_ready && image_data_len >= image_expected_len && image_expected_len > 0) {
                 image_data_ready = true;
-                if (image_file != NULL) {
-                    fclose(image_file);
-                    image_file = NULL;
+                ble_writer_close(BLE_WRITER_SLOT_IMAGE);
+                if (image_region) {
+                    // Written band by band already; the refresh follows the commit region
+                } else if (image_live && x4im_frame_is_packed(image_format)) {
+                    // Decoded into the framebuffer layout already: copied over whole, one refresh
+                    if (!ble_live_show_frame(x4im_frame_data())) {
+                        image_data_ready = false;
+                        image_data_len = 0;
+                        return BLE_ATT_ERR_INSUFFICIENT_RES;
+                    }
+                } else if (x4im_frame_is_packed(image_format) && !save_packed_frame(current_image_filename)) {
+                    image_data_ready = false;
+                    image_data_len = 0;
+                    memset(current_image_filename, 0, sizeof(current_image_filename));
+                    return BLE_ATT_ERR_INSUFFICIENT_RES;
                 }
-                ESP_LOGI(BLE_TAG, "Received full frame id=%" PRIu32 " (%" PRIu32 " bytes), saved to %s", image_frame_id, image_data_len, current_image_filename);
+                ESP_LOGI(BLE_TAG, "Received full frame id=%" PRIu32 " (%" PRIu32 " bytes), %s%s", image_frame_id, image_data_len,
+                         image_live ? "shown live" : "saved to ", current_image_filename);
             }
             return 0;
         }
@@ -572,6 +1011,16 @@ static const struct ble_gatt_svc_def gatt_svr_defs[] = {
                 .val_handle = &control_cmd_chr_val_handle,
                 .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
             },
+            {
+                .uuid = BLE_UUID16_DECLARE(HEAP_STATS_CHAR_UUID),
+                .access_cb = heap_stats_chr_access,
+                .flags = BLE_GATT_CHR_F_READ,
+            },
+            {
+                .uuid = BLE_UUID16_DECLARE(PROFILER_CHAR_UUID),
+                .access_cb = profiler_chr_access,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_WRITE,
+            },
             {
                 0, // No more characteristics
             }
@@ -589,7 +1038,63 @@ static int gatt_svr_init(void)
     int rc = ble_gatts_count_cfg(gatt_svr_defs);
     if (rc != 0) return rc;
     rc = ble_gatts_add_svcs(gatt_svr_defs);
-    return rc;
+    if (rc != 0) return rc;
+    rc = ble_xfer_gatt_init();
+    if (rc != 0) return rc;
+    rc = ble_ota_gatt_init();
+    if (rc != 0) return rc;
+    rc = ble_remote_gatt_init();
+    if (rc != 0) return rc;
+    rc = ble_shot_gatt_init();
+    if (rc != 0) return rc;
+    return ble_bench_gatt_init();
+}
+
+static int mtu_exchange_cb(uint16_t conn_handle, const struct ble_gatt_error *error,
+                           uint16_t mtu, void *arg)
+{
+    (void)conn_handle;
+    (void)arg;
+    if (error->status == 0) {
+        ESP_LOGI(BLE_TAG, "MTU exchanged: %u", mtu);
+    } else {
+        ESP_LOGW(BLE_TAG, "MTU exchange failed: %d", error->status);
+    }
+    return 0;
+}
+
+// Ask for a fast link: 2M PHY, 251-byte LL packets, a large ATT MTU and a short
+// connection interval. Each request is best effort; the peer may refuse any of them
+static void tune_connection(uint16_t conn_handle)
+{
+    int rc = ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_2M_MASK,
+                                         BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_CODED_ANY);
+    if (rc != 0) {
+        ESP_LOGW(BLE_TAG, "2M PHY request failed: %d", rc);
+    }
+
+    rc = ble_gap_set_data_len(conn_handle, BLE_DLE_TX_OCTETS, BLE_DLE_TX_TIME_US);
+    if (rc != 0) {
+        ESP_LOGW(BLE_TAG, "Data length extension failed: %d", rc);
+    }
+
+    rc = ble_gattc_exchange_mtu(conn_handle, mtu_exchange_cb, NULL);
+    if (rc != 0 && rc != BLE_HS_EALREADY) {
+        ESP_LOGW(BLE_TAG, "MTU exchange request failed: %d", rc);
+    }
+
+    const struct ble_gap_upd_params params = {
+        .itvl_min = BLE_CONN_ITVL_MIN,
+        .itvl_max = BLE_CONN_ITVL_MAX,
+        .latency = 0,
+        .supervision_timeout = BLE_CONN_SUPERVISION_TO,
+        .min_ce_len = 0,
+        .max_ce_len = 0,
+    };
+    rc = ble_gap_update_params(conn_handle, &params);
+    if (rc != 0) {
+        ESP_LOGW(BLE_TAG, "Connection parameter update failed: %d", rc);
+    }
 }
 
 static int gap_event_cb(struct ble_gap_event *event, void *arg)
@@ -606,6 +1111,10 @@ static int gap_event_cb(struct ble_gap_event *event, void *arg)
                  event->connect.status);
         if (event->connect.status == 0) {
             ble_conn_handle = event->connect.conn_handle;
+            if (!ble_connected) {
+                // Automatic light sleep would drop the link
+                power_manager_lock(POWER_LOCK_AWAKE);
+            }
             ble_connected = true;
             ble_advertising = false;
             ble_pending_connection = false;
@@ -619,10 +1128,34 @@ static int gap_event_cb(struct ble_gap_event *event, void *arg)
                 }
             }
             ESP_LOGI(BLE_TAG, "BLE server connected, handle=%d", ble_conn_handle);
+            tune_connection(event->connect.conn_handle);
         }
         return 0;
+    case BLE_GAP_EVENT_MTU:
+        ESP_LOGI(BLE_TAG, "MTU update; conn=%d mtu=%d",
+                 event->mtu.conn_handle, event->mtu.value);
+        return 0;
+    case BLE_GAP_EVENT_CONN_UPDATE:
+        {
+            struct ble_gap_conn_desc desc;
+            if (event->conn_update.status == 0 &&
+                ble_gap_conn_find(event->conn_update.conn_handle, &desc) == 0) {
+                ESP_LOGI(BLE_TAG, "Connection updated; itvl=%u latency=%u timeout=%u",
+                         desc.conn_itvl, desc.conn_latency, desc.supervision_timeout);
+            } else {
+                ESP_LOGI(BLE_TAG, "Connection update; status=%d", event->conn_update.status);
+            }
+        }
+        return 0;
+    case BLE_GAP_EVENT_PHY_UPDATE_COMPLETE:
+        ESP_LOGI(BLE_TAG, "PHY update; status=%d tx=%d rx=%d",
+                 event->phy_updated.status, event->phy_updated.tx_phy, event->phy_updated.rx_phy);
+        return 0;
     case BLE_GAP_EVENT_DISCONNECT:
         ESP_LOGI(BLE_TAG, "Disconnect; reason=%d", event->disconnect.reason);
+        if (ble_connected) {
+            power_manager_unlock(POWER_LOCK_AWAKE);
+        }
         ble_connected = false;
         ble_conn_handle = 0;
         memset(ble_peer_addr, 0, sizeof(ble_peer_addr));
@@ -630,25 +1163,33 @@ static int gap_event_cb(struct ble_gap_event *event, void *arg)
         cmd_notify_enabled = false;
 
         // If an image transfer was in progress, close the file and reset state.
-        if (image_file != NULL) {
-            fclose(image_file);
-            image_file = NULL;
-        }
+        ble_writer_close(BLE_WRITER_SLOT_IMAGE);
         image_data_len = 0;
         image_data_ready = false;
         memset(current_image_filename, 0, sizeof(current_image_filename));
+        x4im_frame_reset();
         
         // Also reset JSON state
-        if (json_file != NULL) {
-            fclose(json_file);
-            json_file = NULL;
-        }
+        ble_writer_close(BLE_WRITER_SLOT_JSON);
         json_data_len = 0;
         json_data_ready = false;
         memset(current_json_filename, 0, sizeof(current_json_filename));
 
-        // Restart advertising
-        start_advertising();
+        // Bulk file transfers keep their .part file for resume
+        ble_xfer_on_disconnect();
+        ble_ota_on_disconnect();
+        ble_shot_on_disconnect();
+        ble_remote_on_disconnect();
+        ble_bench_on_disconnect();
+
+        // Restart advertising (unless the stack is being shut down)
+        if (!ble_stopping) {
+            start_advertising();
+        }
+        // Lean profile: the transfer buffers go back to the reader's caches
+        if (ble_profile == BLE_POWER_PROFILE_LEAN) {
+            ble_profile_apply();
+        }
         return 0;
     case BLE_GAP_EVENT_SUBSCRIBE:
         ESP_LOGI(BLE_TAG, "Subscribe event; attr_handle=%d cur_notify=%d cur_indicate=%d",
@@ -658,6 +1199,10 @@ static int gap_event_cb(struct ble_gap_event *event, void *arg)
             ESP_LOGI(BLE_TAG, "CMD notify %s",
                      cmd_notify_enabled ? "ENABLED" : "DISABLED");
         }
+        ble_xfer_on_subscribe(event->subscribe.attr_handle, event->subscribe.cur_notify);
+        ble_ota_on_subscribe(event->subscribe.attr_handle, event->subscribe.cur_notify);
+        ble_shot_on_subscribe(event->subscribe.attr_handle, event->subscribe.cur_notify);
+        ble_bench_on_subscribe(event->subscribe.attr_handle, event->subscribe.cur_notify);
         return 0;
     case BLE_GAP_EVENT_PASSKEY_ACTION:
         ESP_LOGI(BLE_TAG, "Passkey action event; action=%d",
@@ -734,6 +1279,12 @@ static void ble_on_sync(void)
         return;
     }
 
+    // Prefer 2M PHY for every connection (the per-connection request follows on connect)
+    rc = ble_gap_set_prefered_default_le_phy(BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK);
+    if (rc != 0) {
+        ESP_LOGW(BLE_TAG, "Default 2M PHY not set: %d", rc);
+    }
+
     ESP_LOGI(BLE_TAG, "BLE synced; name=%s", DEVICE_NAME);
     (void)start_advertising();
 }
@@ -748,8 +1299,17 @@ void bt_init(void)
 {
     ESP_LOGI(BLE_TAG, "Starting BLE initialization...");
 
-    // Recommended NimBLE sequence (ESP-IDF): nimble_port_init handles controller + transport
-    ESP_ERROR_CHECK(nimble_port_init());
+    // Recommended NimBLE sequence (ESP-IDF): nimble_port_init handles controller + transport.
+    // Not fatal: after Wi-Fi transfer mode the heap may be too fragmented to restart BLE
+    // Give idle LVGL overflow pools back to the heap before the stack allocates
+    lvgl_mem_pool_set_radio(LVGL_MEM_RADIO_BLE, true);
+    const size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    esp_err_t err = nimble_port_init();
+    if (err != ESP_OK) {
+        ESP_LOGE(BLE_TAG, "nimble_port_init failed: %s", esp_err_to_name(err));
+        lvgl_mem_pool_set_radio(LVGL_MEM_RADIO_BLE, false);
+        return;
+    }
 
     ble_svc_gap_init();
     ble_svc_gatt_init();
@@ -763,11 +1323,21 @@ void bt_init(void)
     ble_hs_cfg.sm_their_key_dist = BLE_SM_PAIR_KEY_DIST_ENC | BLE_SM_PAIR_KEY_DIST_ID;
 
     ble_hs_cfg.sync_cb = ble_on_sync;
+    (void)ble_att_set_preferred_mtu(BLE_PREFERRED_MTU);
     ble_hs_cfg.store_status_cb = ble_store_util_status_rr;
 
     (void)ble_svc_gap_device_name_set(DEVICE_NAME);
     (void)gatt_svr_init();
+    // The host is not running yet: set up (full) or drop (lean) the SD writer here
+    ble_npl_event_init(&ble_profile_ev, ble_profile_ev_cb, NULL);
+    ble_writer_set_flow_cb(writer_flow_cb);
+    ble_profile_apply();
     nimble_port_freertos_init(host_task);
+    ble_initialized = true;
+
+    // The stack allocates outside the tagged wrappers: report what starting it cost
+    const size_t heap_after = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    heap_stats_set(HEAP_TAG_BLE, heap_before > heap_after ? (uint32_t)(heap_before - heap_after) : 0, 0);
 
     ESP_LOGI(BLE_TAG, "BLE initialized in SERVER mode with image service");
 
@@ -785,107 +1355,86 @@ void bt_init(void)
     }
 }
 
-// WiFi event handler
-static void wifi_event_handler(void* arg, esp_event_base_t event_base,
-                               int32_t event_id, void* event_data)
+// Shut NimBLE down and return the controller and host memory to the heap (Wi-Fi transfer
+// mode). Runs in the LVGL task; bt_init() brings the stack back afterwards
+static bool ble_stop(void)
 {
-    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
-        ESP_LOGI("WIFI", "WiFi station started, connecting to AP...");
-        esp_wifi_connect();
-    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
-        ESP_LOGI("WIFI", "WiFi disconnected, retrying to connect to the AP");
-        esp_wifi_connect();
-    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
-        ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
-        ESP_LOGI("WIFI", "WiFi connected successfully!");
-        ESP_LOGI("WIFI", "IP Address: " IPSTR, IP2STR(&event->ip_info.ip));
+    if (!ble_initialized) {
+        return true;
     }
-}
-
-// WiFi initialization function
-// 注意：在 4 灰度模式下帧缓冲更大（96KB），WiFi 初始化可能因内存不足失败。
-// 不要 ESP_ERROR_CHECK 直接 abort，改为返回错误让系统继续运行（至少保证 EPD/LVGL 可用）。
-esp_err_t wifi_init_sta(void)
-{
-    ESP_LOGI("WIFI", "Initializing WiFi in station mode...");
-    esp_err_t err;
-
-    err = esp_netif_init();
-    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
-        ESP_LOGE("WIFI", "esp_netif_init failed: %s", esp_err_to_name(err));
-        return err;
-    }
-
-    err = esp_event_loop_create_default();
-    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
-        ESP_LOGE("WIFI", "esp_event_loop_create_default failed: %s", esp_err_to_name(err));
-        return err;
-    }
-    esp_netif_create_default_wifi_sta();
-
-    // 优化WiFi配置以减少内存使用(ESP32-C3只有100KB RAM)
-    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-    // 减少RX缓冲区(默认10→4,节省约6KB)
-    cfg.static_rx_buf_num = 4;     // 从默认10减到4
-    cfg.dynamic_rx_buf_num = 8;    // 从默认32减到8
-    cfg.dynamic_tx_buf_num = 8;    // 从默认32减到8
-    cfg.tx_buf_type = 1;           // 使用动态分配
-    cfg.cache_tx_buf_num = 1;      // 减少缓存
-    
-    err = esp_wifi_init(&cfg);
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "esp_wifi_init failed: %s", esp_err_to_name(err));
-        return err;
-    }
-
-    // Register event handlers
-    esp_event_handler_instance_t instance_any_id;
-    esp_event_handler_instance_t instance_got_ip;
-    err = esp_event_handler_instance_register(WIFI_EVENT,
-                                              ESP_EVENT_ANY_ID,
-                                              &wifi_event_handler,
-                                              NULL,
-                                              &instance_any_id);
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "register WIFI_EVENT handler failed: %s", esp_err_to_name(err));
-        return err;
+    ble_stopping = true;
+    if (ble_advertising) {
+        ble_gap_adv_stop();
     }
-
-    err = esp_event_handler_instance_register(IP_EVENT,
-                                              IP_EVENT_STA_GOT_IP,
-                                              &wifi_event_handler,
-                                              NULL,
-                                              &instance_got_ip);
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "register IP_EVENT handler failed: %s", esp_err_to_name(err));
-        return err;
+    if (ble_connected) {
+        ble_gap_terminate(ble_conn_handle, BLE_ERR_REM_USER_CONN_TERM);
+        for (int i = 0; i < 50 && ble_connected; i++) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
     }
-
-    // Simple WiFi config — updated with requested credentials
-    wifi_config_t wifi_config = {
-        .sta = {
-            .ssid = "foxwifi-plus",
-            .password = "epdc1984",
-        },
-    };
-    err = esp_wifi_set_mode(WIFI_MODE_STA);
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "esp_wifi_set_mode failed: %s", esp_err_to_name(err));
-        return err;
+    // Files received before the disconnect must reach the SD card first
+    if (!ble_writer_flush(3000)) {
+        ESP_LOGW(BLE_TAG, "SD writer still busy, BLE left running");
+        ble_stopping = false;
+        return false;
     }
-    err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "esp_wifi_set_config failed: %s", esp_err_to_name(err));
-        return err;
+
+    int rc = nimble_port_stop();
+    if (rc != 0) {
+        ESP_LOGE(BLE_TAG, "nimble_port_stop failed: %d", rc);
+        ble_stopping = false;
+        return false;
     }
-    err = esp_wifi_start();
-    if (err != ESP_OK) {
-        ESP_LOGE("WIFI", "esp_wifi_start failed: %s", esp_err_to_name(err));
-        return err;
+    nimble_port_deinit();
+    (void)ble_writer_release(BLE_WRITER_RELEASE_WAIT_MS);
+    heap_stats_set(HEAP_TAG_BLE, 0, 0);
+    lvgl_mem_pool_set_radio(LVGL_MEM_RADIO_BLE, false);
+    ble_initialized = false;
+    ble_stopping = false;
+    if (ble_connected) {
+        power_manager_unlock(POWER_LOCK_AWAKE);
     }
+    ble_connected = false;
+    ble_advertising = false;
+    ble_pending_connection = false;
+    ESP_LOGI(BLE_TAG, "BLE stopped, free heap %u", (unsigned)esp_get_free_heap_size());
+    return true;
+}
 
-    ESP_LOGI("WIFI", "WiFi initialization completed. Connecting...");
-    return ESP_OK;
+// Callbacks for ble_power (on-demand start and idle shutdown)
+static bool ble_start(void)
+{
+    bt_init();
+    return ble_initialized;
+}
+
+static bool ble_is_running(void)
+{
+    return ble_initialized;
+}
+
+static bool ble_is_idle(void)
+{
+    return !ble_connected && !ble_pending_connection && !ble_writer_busy() && !ble_ota_busy();
+}
+
+// The transfer modes (Wi-Fi, USB) only bring BLE back if it was running when the mode was entered
+static bool ble_was_running = false;
+
+static bool transfer_ble_stop(void)
+{
+    ble_was_running = ble_initialized;
+    return ble_stop();
+}
+
+static void transfer_ble_start(void)
+{
+    if (ble_was_running) {
+        bt_init();
+    } else {
+        // The USB transfer task has exited; nothing else produces into the writer
+        (void)ble_writer_release(BLE_WRITER_RELEASE_WAIT_MS);
+    }
 }
 
 // SD card initialization function
@@ -898,7 +1447,7 @@ esp_err_t sd_card_init(void)
     // Options for mounting the FAT filesystem on SD card.
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
         .format_if_mount_failed = false,
-        .max_files = 5,
+        .max_files = 8,   // FILE_POOL_MAX_OPEN 个给句柄池，其余给短时打开的文件
         .allocation_unit_size = 16 * 1024
     };
 
@@ -907,7 +1456,8 @@ esp_err_t sd_card_init(void)
 
     ESP_LOGI("SD", "Initializing SD card using SPI peripheral");
     sdmmc_host_t host = SDSPI_HOST_DEFAULT();
-    host.max_freq_khz = 400;  // 降低到 400kHz 提高兼容性（原 1000kHz）
+    // 在 400 kHz 下完成初始化和挂载（兼容性最好），挂载后再协商更高的时钟
+    host.max_freq_khz = DEV_SD_HZ_DEFAULT / 1000;
 
     sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
     slot_config.gpio_cs = PIN_NUM_CS;
@@ -952,107 +1502,344 @@ esp_err_t sd_card_init(void)
     }
 
     ESP_LOGI("SD", "FAT filesystem mounted at %s", sd_mount_point);
+    sd_negotiate_speed(card);
     sdmmc_card_print_info(stdout, card);
 
-    // Create a test file on SD card
-    char path_buf[128];
-    snprintf(path_buf, sizeof(path_buf), "%s/test.txt", sd_mount_point);
-    FILE *f = fopen(path_buf, "w");
-    if (f != NULL) {
-        fprintf(f, "SD card initialized successfully!\n");
-        fclose(f);
-        ESP_LOGI("SD", "Test file created on SD card");
-    } else {
-        ESP_LOGE("SD", "Failed to create test file on SD card");
-    }
+    // 只读检查 CID/CSD，新卡首次使用时测速；读写自检见 sd_health_selftest（诊断模式）
+    sd_health_probe(card);
+
+    // 长期打开的读者（阅读器、字体、LVGL 文件驱动）共用句柄池
+    file_pool_init();
 
-    // Test SD card read/write functionality
-    sd_card_test_read_write(sd_mount_point);
+    // 卡上内容可能已换过，之前缓存的目录列表作废
+    file_browser_invalidate_cache();
 
     ESP_LOGI("SD", "SD card initialization completed");
     return ESP_OK;
 }
 
-// SD card read/write test function
-void sd_card_test_read_write(const char *mount_point)
+static bool sd_speed_cache_match(const sd_speed_cache_t *c, const sdmmc_card_t *card)
 {
-    ESP_LOGI("SD", "Testing SD card read/write functionality");
-
-    // Test writing data
-    char path_buf[128];
-    snprintf(path_buf, sizeof(path_buf), "%s/test_data.bin", mount_point);
-    FILE *f = fopen(path_buf, "wb");
-    if (f != NULL) {
-        uint8_t test_data[256];
-        for (int i = 0; i < 256; i++) {
-            test_data[i] = i;
-        }
+    return c->serial == (uint32_t)card->cid.serial && c->mfg_id == (uint8_t)card->cid.mfg_id &&
+           strncmp(c->name, card->cid.name, sizeof(c->name)) == 0;
+}
 
-        size_t written = fwrite(test_data, 1, sizeof(test_data), f);
-        fclose(f);
+// 切换到 khz 并读回验证：ref 为 NULL 时读两遍互相比较（使用缓存结果时省去慢速参考读）
+static bool sd_speed_try(sdmmc_card_t *card, uint32_t khz, const uint8_t *ref, uint8_t *buf)
+{
+    const size_t len = SD_VERIFY_SECTORS * card->csd.sector_size;
+    if (sdspi_host_set_card_clk(card->host.slot, khz) != ESP_OK ||
+        sdmmc_read_sectors(card, buf, 0, SD_VERIFY_SECTORS) != ESP_OK) {
+        return false;
+    }
+    if (ref != NULL) {
+        return memcmp(buf, ref, len) == 0;
+    }
+    return sdmmc_read_sectors(card, buf + len, 0, SD_VERIFY_SECTORS) == ESP_OK &&
+           memcmp(buf, buf + len, len) == 0;
+}
 
-        if (written == sizeof(test_data)) {
-            ESP_LOGI("SD", "Write test successful: %d bytes written", written);
-        } else {
-            ESP_LOGE("SD", "Write test failed: only %d bytes written", written);
-            return;
-        }
-    } else {
-        ESP_LOGE("SD", "Failed to open file for writing");
-        return;
+// 挂载后协商总线时钟，返回采用的 kHz（失败时保持挂载时的时钟）
+static uint32_t sd_negotiate_speed(sdmmc_card_t *card)
+{
+    const uint32_t base_khz = DEV_SD_HZ_DEFAULT / 1000;
+    const size_t len = SD_VERIFY_SECTORS * card->csd.sector_size;
+    uint8_t *buf = (uint8_t *)heap_caps_malloc(len * 2, MALLOC_CAP_DMA);
+    if (buf == NULL) {
+        ESP_LOGW("SD", "No memory for speed check, staying at %lu kHz", (unsigned long)base_khz);
+        return base_khz;
     }
 
-    // Test reading data
-    f = fopen(path_buf, "rb");
-    if (f != NULL) {
-        uint8_t read_data[256];
-        size_t read = fread(read_data, 1, sizeof(read_data), f);
-        fclose(f);
+    sd_speed_cache_t cache = {0};
+    size_t cache_len = sizeof(cache);
+    nvs_handle_t nvs;
+    bool cached = false;
+    if (nvs_open(SD_SPEED_NVS_NS, NVS_READONLY, &nvs) == ESP_OK) {
+        cached = nvs_get_blob(nvs, SD_SPEED_NVS_KEY, &cache, &cache_len) == ESP_OK &&
+                 cache_len == sizeof(cache) && sd_speed_cache_match(&cache, card);
+        nvs_close(nvs);
+    }
 
-        if (read == sizeof(read_data)) {
-            bool data_ok = true;
-            for (int i = 0; i < 256; i++) {
-                if (read_data[i] != (uint8_t)i) {
-                    data_ok = false;
+    uint32_t khz = 0;
+    if (cached && cache.khz > base_khz && sd_speed_try(card, cache.khz, NULL, buf)) {
+        khz = cache.khz;
+        ESP_LOGI("SD", "Bus clock %lu kHz (cached for this card)", (unsigned long)khz);
+    } else {
+        // 参考数据在挂载时钟下读取
+        uint8_t *ref = buf + len;
+        if (sdspi_host_set_card_clk(card->host.slot, base_khz) == ESP_OK &&
+            sdmmc_read_sectors(card, ref, 0, SD_VERIFY_SECTORS) == ESP_OK) {
+            for (size_t i = 0; i < sizeof(s_sd_speed_ladder_khz) / sizeof(s_sd_speed_ladder_khz[0]); i++) {
+                const uint32_t step = s_sd_speed_ladder_khz[i];
+                if (step <= base_khz || step > (uint32_t)card->max_freq_khz) {
+                    continue;
+                }
+                if (sd_speed_try(card, step, ref, buf)) {
+                    khz = step;
                     break;
                 }
+                ESP_LOGW("SD", "Bus clock %lu kHz failed verification", (unsigned long)step);
             }
+        }
+        if (khz == 0) {
+            khz = base_khz;
+        }
+        ESP_LOGI("SD", "Bus clock %lu kHz (negotiated)", (unsigned long)khz);
+
+        if (nvs_open(SD_SPEED_NVS_NS, NVS_READWRITE, &nvs) == ESP_OK) {
+            cache.serial = (uint32_t)card->cid.serial;
+            cache.mfg_id = (uint8_t)card->cid.mfg_id;
+            strncpy(cache.name, card->cid.name, sizeof(cache.name));
+            cache.khz = khz;
+            nvs_set_blob(nvs, SD_SPEED_NVS_KEY, &cache, sizeof(cache));
+            nvs_commit(nvs);
+            nvs_close(nvs);
+        }
+    }
+    heap_caps_free(buf);
 
-            if (data_ok) {
-                ESP_LOGI("SD", "Read test successful: %d bytes read, data verified", read);
-            } else {
-                ESP_LOGE("SD", "Read test failed: data verification failed");
-            }
-        } else {
-            ESP_LOGE("SD", "Read test failed: only %d bytes read", read);
+    if (khz == base_khz) {
+        sdspi_host_set_card_clk(card->host.slot, base_khz);
+    }
+    card->real_freq_khz = (int)khz;
+    DEV_Set_Clock(DEV_CLK_SD, khz * 1000);
+    return khz;
+}
+
+// Save received image to SD card
+
+
+// ============================================================================
+// 启动并行化：EPD 初始化与清屏在单独任务中进行，主任务同时挂载 SD、初始化字体。
+// 两者共用 SPI 总线，由驱动按事务仲裁；EPD 任务大部分时间在等 BUSY（波形运行）
+// ============================================================================
+typedef struct {
+    uint32_t magic;
+    uint32_t size;      // framebuffer 字节数，与当前面板不符时作废
+    uint32_t crc;       // esp_rom_crc32_le(0, data, size)
+} boot_snapshot_hdr_t;
+
+static EventGroupHandle_t s_boot_events = NULL;
+static volatile bool s_boot_sd_ok = false;
+static uint8_t *s_boot_snapshot = NULL;   // 已上传到面板的快照，首屏保存后释放
+static bool s_boot_resume = false;        // s_boot_snapshot 是断电前的阅读页
+static const uint8_t *s_boot_splash = NULL;   // 已上传到面板的启动画面（即 framebuffer）
+static char s_resume_book[RESUME_STATE_BOOK_MAX];
+
+static uint8_t *boot_snapshot_load(size_t size) {
+    FILE *fp = fopen(BOOT_SNAPSHOT_PATH, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+    boot_snapshot_hdr_t hdr;
+    uint8_t *buf = NULL;
+    if (fread(&hdr, 1, sizeof(hdr), fp) == sizeof(hdr) &&
+        hdr.magic == BOOT_SNAPSHOT_MAGIC && hdr.size == size) {
+        buf = (uint8_t *)malloc(size);
+        if (buf != NULL && (fread(buf, 1, size, fp) != size ||
+                            esp_rom_crc32_le(0, buf, size) != hdr.crc)) {
+            ESP_LOGW("BOOT", "Boot snapshot corrupt, ignored");
+            free(buf);
+            buf = NULL;
         }
+    }
+    fclose(fp);
+    return buf;
+}
+
+static void boot_snapshot_save(const uint8_t *fb, size_t size) {
+    sd_path_make_parents(BOOT_SNAPSHOT_PATH);
+    FILE *fp = fopen(BOOT_SNAPSHOT_PATH, "wb");
+    if (fp == NULL) {
+        ESP_LOGW("BOOT", "Cannot write boot snapshot");
+        return;
+    }
+    const boot_snapshot_hdr_t hdr = {
+        .magic = BOOT_SNAPSHOT_MAGIC,
+        .size = (uint32_t)size,
+        .crc = esp_rom_crc32_le(0, fb, size),
+    };
+    const bool ok = fwrite(&hdr, 1, sizeof(hdr), fp) == sizeof(hdr) &&
+                    fwrite(fb, 1, size, fp) == size;
+    fclose(fp);
+    if (!ok) {
+        remove(BOOT_SNAPSHOT_PATH);
+    }
+}
+
+// EPD 启动任务：初始化面板，SD 就绪且有快照时直接显示快照，否则快刷清屏
+static void boot_epd_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("boot_epd", BOOT_EPD_TASK_STACK);
+    int phase = boot_profile_begin("epd_init");
+    EPD_4in26_Init_Fast();
+    // 探测 EPD 写时钟（改写 RAM，随后的清屏/快照会覆盖测试数据）
+    EPD_4in26_ProbeSpiClock();
+    boot_profile_end(phase);
+
+    xEventGroupWaitBits(s_boot_events, BOOT_EV_SD_DONE, pdFALSE, pdTRUE,
+                        pdMS_TO_TICKS(BOOT_SD_WAIT_MS));
+
+    // 断电前在阅读：面板上仍是那一页，只把它写回控制器 RAM，不清屏、不刷新
+    uint8_t *snapshot = NULL;
+    if (s_boot_sd_ok) {
+        snapshot = resume_state_load(lvgl_fb_size(), s_resume_book, sizeof(s_resume_book));
+        if (snapshot != NULL) {
+            phase = boot_profile_begin("epd_resume");
+            EPD_4in26_LoadFrame(snapshot);
+            boot_profile_end(phase);
+            s_boot_resume = true;
+            s_boot_snapshot = snapshot;
+            xEventGroupSetBits(s_boot_events, BOOT_EV_EPD_DONE);
+            stack_stats_task_exit();
+            vTaskDelete(NULL);
+            return;
+        }
+        snapshot = boot_snapshot_load(lvgl_fb_size());
+    }
+
+    // 没有快照时画启动画面代替清屏（直接写 framebuffer，随后作为 LVGL 首帧的局刷基准）
+    phase = boot_profile_begin(snapshot != NULL ? "epd_snapshot" : "epd_splash");
+    if (snapshot != NULL) {
+        EPD_4in26_Display_Fast(snapshot);
     } else {
-        ESP_LOGE("SD", "Failed to open file for reading");
+        s_boot_splash = direct_screen_show(DIRECT_SCREEN_BOOT) ? lvgl_fb_early() : NULL;
     }
+    boot_profile_end(phase);
+
+    s_boot_snapshot = snapshot;
+    xEventGroupSetBits(s_boot_events, BOOT_EV_EPD_DONE);
+    stack_stats_task_exit();
+    vTaskDelete(NULL);
+}
 
-    // Test directory operations
-    struct stat st;
-    if (stat(path_buf, &st) == 0) {
-        ESP_LOGI("SD", "File size: %ld bytes", st.st_size);
+// 首屏渲染后更新快照（内容没变就不写 SD 卡）
+static void boot_snapshot_update(void) {
+    const size_t size = lvgl_fb_size();
+    uint8_t *copy = s_boot_snapshot;
+    s_boot_snapshot = NULL;
+    if (copy == NULL) {
+        copy = (uint8_t *)malloc(size);
+        if (copy == NULL) {
+            return;
+        }
+        memset(copy, 0, size);   // 与任何渲染结果都不同，保证写入
+    }
+    bool changed = false;
+    const uint8_t *fb = lvgl_fb_read_begin(2000);
+    if (fb != NULL) {
+        changed = memcmp(copy, fb, size) != 0;
+        if (changed) {
+            memcpy(copy, fb, size);
+        }
+        lvgl_fb_read_end();
+    }
+    if (changed) {
+        const int phase = boot_profile_begin("snapshot_save");
+        boot_snapshot_save(copy, size);
+        boot_profile_end(phase);
     }
+    free(copy);
+}
 
-    ESP_LOGI("SD", "SD card test completed");
+// 浅睡眠会中断 BLE 连接和进行中的文件传输
+static bool power_can_sleep(void)
+{
+    return !ble_connected && !ble_pending_connection &&
+           !ble_writer_busy() && !ble_ota_busy() && !wifi_transfer_is_active() &&
+           !usb_transfer_is_active() && !charge_maint_is_active();
 }
 
-// Save received image to SD card
+// 充电维护只在 SD 卡空闲时进行：USB 传输期间卡交给主机，Wi-Fi/BLE 传输正在写卡
+static bool charge_maint_can_run(void)
+{
+    return !ble_writer_busy() && !ble_ota_busy() && !wifi_transfer_is_active() &&
+           !usb_transfer_is_active();
+}
+
+// 浅睡眠期间可能直接断电：阅读进度先写入 NVS，正在阅读时再保存面板画面，
+// 下次开机直接回到这一页（在 LVGL 任务中调用，面板已休眠）
+static void power_before_sleep(void)
+{
+    position_journal_flush();
+    settings_flush();
+    flash_cache_flush();
+    turn_stats_save();
+
+    const char *book = screen_manager_get_current_screen() == SCREEN_TYPE_READER
+                       ? reader_screen_get_open_path() : NULL;
+    if (book == NULL) {
+        resume_state_invalidate();
+        return;
+    }
+    const uint8_t *fb = lvgl_fb_read_begin(100);
+    if (fb != NULL) {
+        resume_state_save(fb, lvgl_fb_size(), book);
+        lvgl_fb_read_end();
+    }
+}
+
+// 用户开始操作后面板内容会变，睡眠前保存的画面作废
+static void power_after_wake(void)
+{
+    resume_state_invalidate();
+}
+
+// 关机前保存阅读进度；面板上将是关机画面，断电恢复的页面快照作废
+static void power_off_save_state(void)
+{
+    position_journal_flush();
+    settings_flush();
+    flash_cache_flush();
+    turn_stats_save();
+    resume_state_invalidate();
+}
 
+// 长按电源键关机（LVGL 任务中调用，不返回）
+static void power_off_requested(void)
+{
+    power_off_save_state();
+    direct_screen_power_off(DIRECT_SCREEN_SLEEP, BTN_GPIO3);
+}
+
+// 内存压力轮询：处理推迟的收缩并检查空闲堆低水位（在 LVGL 任务中运行）
+static void mem_pressure_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    mem_pressure_poll();
+}
+
+// 运行中电量检查：未充电且电压低于 BATTERY_CRITICAL_MV 时关机，避免掉电丢进度
+static void battery_guard_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    battery_status_t st;
+    battery_get(&st);
+    if (!battery_is_critical(&st)) {
+        return;
+    }
+    ESP_LOGW("BAT", "Battery critical (%lu mV), powering off", (unsigned long)st.mv);
+    power_off_save_state();
+    direct_screen_power_off(DIRECT_SCREEN_LOW_BATTERY, BTN_GPIO3);
+}
 
 void app_main(void)
 {
     printf("ESP32 BLE and WiFi System Starting...\n");
+    stack_stats_register_self("main", CONFIG_ESP_MAIN_TASK_STACK_SIZE);
+    mem_pressure_init();
 
     // Initialize NVS
+    int phase = boot_profile_begin("nvs");
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         ESP_LOGI("MAIN", "Erasing NVS flash...");
         ESP_ERROR_CHECK(nvs_flash_erase());
         ESP_ERROR_CHECK(nvs_flash_init());
     }
+    settings_store_init();
+    boot_profile_end(phase);
+    ble_ota_boot_check();
 
     // ============================================================================
     // Xteink X4: 先初始化按钮和ADC（因为欢迎页面需要读取电池信息）
@@ -1064,64 +1851,112 @@ void app_main(void)
              read_battery_percentage(),
              is_charging() ? "Yes" : "No");
 
+    // 电池已经过低：不挂载 SD、不启动 LVGL，直接显示低电量画面后深度睡眠
+    battery_status_t boot_bat;
+    battery_get(&boot_bat);
+    if (battery_is_critical(&boot_bat)) {
+        ESP_LOGW("BAT", "Battery critical at boot (%lu mV), powering off",
+                 (unsigned long)boot_bat.mv);
+        DEV_Module_Init();
+        EPD_4in26_Init_Fast();
+        direct_screen_power_off(DIRECT_SCREEN_LOW_BATTERY, BTN_GPIO3);
+    }
+
     // ============================================================================
-    // Xteink X4: 初始化 EPD 墨水屏
+    // Xteink X4: 初始化 EPD 墨水屏（后台任务）与 SD 卡、字体（当前任务）并行
     // ============================================================================
     ESP_LOGI("MAIN", "Initializing EPD...");
 
-    // 初始化 SPI 和 e-Paper (在 BLE/WiFi 之前初始化以避免电源问题)
+    // 初始化 SPI 和 e-Paper (SPI 总线由 EPD 与 SD 卡共用，必须先于两者)
+    phase = boot_profile_begin("spi_init");
     DEV_Module_Init();
+    boot_profile_end(phase);
+
+    s_boot_events = xEventGroupCreate();
+    const int boot_phase = boot_profile_begin("epd_parallel");
+    if (s_boot_events == NULL ||
+        xTaskCreate(boot_epd_task, "boot_epd", BOOT_EPD_TASK_STACK, NULL, 1, NULL) != pdPASS) {
+        // 无法创建任务时退回顺序执行
+        ESP_LOGW("MAIN", "Boot EPD task unavailable, showing splash synchronously");
+        EPD_4in26_Init_Fast();
+        EPD_4in26_ProbeSpiClock();
+        s_boot_splash = direct_screen_show(DIRECT_SCREEN_BOOT) ? lvgl_fb_early() : NULL;
+        if (s_boot_events != NULL) {
+            xEventGroupSetBits(s_boot_events, BOOT_EV_EPD_DONE);
+        }
+    }
 
-    // 初始化 EPD 硬件（使用快刷模式以避免后续刷新时变黑）
-    EPD_4in26_Init_Fast();
-    EPD_4in26_Clear_Fast();
-
-    // Add delay before initializing high-power components to prevent brownout
-    ESP_LOGI("MAIN", "Waiting 1 second before initializing BLE/WiFi to prevent brownout...");
-    vTaskDelay(1000 / portTICK_PERIOD_MS);
-
-    // Initialize BLE AFTER EPD (ESP32-C3 requires BLE controller init before Wi-Fi)
-    ESP_LOGI("MAIN", "Initializing BLE...");
-    bt_init();
+    // BLE 不在启动时初始化：设置页开关或首页长按「BLE Reader」按需启动，
+    // 空闲超时后自动关闭，未使用时协议栈的堆留给阅读器缓存（见 ble_power.h）
+    ESP_LOGI("MAIN", "BLE deferred until requested");
 
     // ========================================================================
     // CRITICAL: ESP32-C3只有100KB RAM,无法同时运行WiFi+BLE+SD+LVGL
-    // 优先级: BLE(必须) > SD卡(必须) > WiFi(可选)
-    // 方案: 完全跳过WiFi初始化,避免内存耗尽导致SD卡SPI DMA分配失败
+    // 优先级: SD卡(必须) > BLE(按需) > WiFi(可选)
+    // 方案: 启动时不初始化WiFi；设置页的 Wi-Fi 传输模式会先关闭 BLE 再独占启动 WiFi
+    // （见 wifi_transfer.h）
     // ========================================================================
-    ESP_LOGI("MAIN", "Skipping WiFi initialization to conserve memory for SD card and LVGL");
-    ESP_LOGI("MAIN", "Use BLE for data transfer instead of WiFi");
-    
-    // WiFi初始化已禁用 - 取消注释以下代码以重新启用(需要足够RAM)
-    /*
-    ESP_LOGI("MAIN", "Initializing WiFi...");
-    esp_err_t wifi_ret = wifi_init_sta();
-    if (wifi_ret != ESP_OK) {
-        ESP_LOGW("MAIN", "WiFi init failed (%s); continuing without WiFi", esp_err_to_name(wifi_ret));
-    }
-    */
+    ESP_LOGI("MAIN", "Skipping WiFi initialization (available on demand as Wi-Fi transfer mode)");
 
-    // Initialize SD card (CRITICAL: 必须在WiFi之后或WiFi禁用时初始化)
+    // Initialize SD card（与 EPD 初始化并行；结果通知 EPD 任务决定是否使用快照）
     ESP_LOGI("MAIN", "Initializing SD card...");
+    phase = boot_profile_begin("sd_mount");
     esp_err_t sd_ret = sd_card_init();
+    boot_profile_end(phase);
+    s_boot_sd_ok = (sd_ret == ESP_OK);
+    if (s_boot_events != NULL) {
+        xEventGroupSetBits(s_boot_events, BOOT_EV_SD_DONE);
+    }
     if (sd_ret != ESP_OK) {
         ESP_LOGW("MAIN", "SD card initialization failed, but system will continue");
         ESP_LOGW("MAIN", "File browser and SD-related features will be unavailable");
     }
 
     // Initialize font manager (after SD card is ready)
+    // 字体目录在首屏显示后于后台扫描，这里只启用内置字体
     ESP_LOGI("MAIN", "Initializing font manager...");
+    phase = boot_profile_begin("font_init");
     if (font_manager_init()) {
         font_manager_load_selection();
-        ESP_LOGI("MAIN", "Font manager initialized, loaded %d font(s)", font_manager_get_font_count());
+        ESP_LOGI("MAIN", "Font manager initialized (font directory scanned after first paint)");
     } else {
         ESP_LOGW("MAIN", "Font manager initialization failed, using default font");
     }
+    boot_profile_end(phase);
+
+    // 内部 flash 的 LittleFS 分区作为 SD 卡之上的热块缓存（见 ui/flash_cache.h）
+    phase = boot_profile_begin("flash_cache");
+    const esp_vfs_littlefs_conf_t littlefs_conf = {
+        .base_path = FLASH_CACHE_ROOT,
+        .partition_label = "littlefs",
+        .format_if_mount_failed = true,
+        .dont_mount = false,
+    };
+    if (esp_vfs_littlefs_register(&littlefs_conf) == ESP_OK) {
+        flash_cache_init(FLASH_CACHE_ROOT);
+    } else {
+        ESP_LOGW("MAIN", "LittleFS mount failed, hot block cache disabled");
+    }
+    boot_profile_end(phase);
+
+    // 汇合：LVGL 初始化会切换 EPD 到异步刷新，必须等启动任务用完面板
+    if (s_boot_events != NULL &&
+        !(xEventGroupWaitBits(s_boot_events, BOOT_EV_EPD_DONE, pdFALSE, pdTRUE,
+                              pdMS_TO_TICKS(BOOT_EPD_WAIT_MS)) & BOOT_EV_EPD_DONE)) {
+        ESP_LOGW("MAIN", "Boot EPD task did not finish in %d ms", BOOT_EPD_WAIT_MS);
+    }
+    boot_profile_end(boot_phase);
+
+    // 等待 EPD 刷新电流过后电源轨恢复（替代原来固定的 1 秒延时）
+    phase = boot_profile_begin("power_rail");
+    wait_power_rail_ready();
+    boot_profile_end(phase);
 
     // ============================================================================
     // LVGL GUI 初始化
     // ============================================================================
     ESP_LOGI("MAIN", "Initializing LVGL GUI system...");
+    phase = boot_profile_begin("lvgl_init");
 
     // 1. 初始化 LVGL 显示驱动（framebuffer 在 lvgl_driver.c 中静态分配）
     lv_display_t *disp = lvgl_display_init();
@@ -1133,9 +1968,7 @@ void app_main(void)
     // 3. 初始化 LVGL 文件系统驱动（支持通过 S:/ 盘符访问 SD 卡）
     lvgl_fs_init();
 
-    // 4. 创建 LVGL tick 任务（10ms tick）
-    // 降低优先级到 3，避免阻塞 IDLE 任务
-    xTaskCreate(lvgl_tick_task, "lvgl_tick", 2048, NULL, 3, NULL);
+    // 4. LVGL tick 由 esp_timer 提供（lvgl_display_init 中注册），无需 tick 任务
 
     // 5. 初始化屏幕管理器
     ESP_LOGI("LVGL", "Initializing screen manager...");
@@ -1148,41 +1981,143 @@ void app_main(void)
     screen_ctx.read_battery_voltage_mv = read_battery_voltage_mv;
     screen_ctx.read_battery_percentage = read_battery_percentage;
     screen_ctx.is_charging = is_charging;
+    screen_ctx.read_battery_seq = read_battery_seq;
     screen_manager_init(&screen_ctx);
 
-    // 5. 创建首页
-    ESP_LOGI("LVGL", "Creating index screen with system info...");
-    screen_manager_show_index();
+    // 面板上已经是快照（上次的首页或断电前的阅读页）：作为局刷基准，
+    // 首屏只刷变化的行（电量、版本等）
+    if (s_boot_snapshot != NULL) {
+        lvgl_seed_panel_frame(s_boot_snapshot);
+    } else if (s_boot_splash != NULL) {
+        // 启动画面就在 framebuffer 中（lvgl_fb_early），同样作为局刷基准
+        lvgl_seed_panel_frame(s_boot_splash);
+    }
+
+    // 5. 创建首页；断电前在阅读时直接重新打开那本书（进度取自进度日志），
+    // 首页留在导航栈底，返回键回到首页
+    struct stat book_st;
+    bool fonts_scanned = false;
+    if (s_boot_resume && stat(s_resume_book, &book_st) == 0) {
+        // 第一页要用保存的字体排版才能与面板上的画面一致，字体目录同步扫描
+        const int font_phase = boot_profile_begin("font_scan");
+        fonts_scanned = font_manager_scan_now();
+        boot_profile_end(font_phase);
+        ESP_LOGI("LVGL", "Resuming reader: %s", s_resume_book);
+        screen_manager_show_reader(s_resume_book);
+        reader_screen_wait_open();
+    } else {
+        s_boot_resume = false;
+        ESP_LOGI("LVGL", "Creating index screen with system info...");
+        screen_manager_show_index();
+    }
+    boot_profile_end(phase);
 
     // 6. 手动刷新模式：在启动 LVGL timer 任务之前，先在当前线程渲染一次。
     // 重要：使用 lvgl_trigger_render() 而不是直接调用 lv_timer_handler()
+    // lv_refr_now 同步渲染全部无效区域；第二次处理首轮布局产生的新无效区域
     ESP_LOGI("LVGL", "Rendering UI (manual refresh mode) before starting LVGL timer task...");
-    for (int i = 0; i < 6; i++) {
-        lvgl_trigger_render(disp);  // 使用手动刷新模式
-        vTaskDelay(30 / portTICK_PERIOD_MS);
-    }
+    phase = boot_profile_begin("first_render");
+    lvgl_trigger_render(disp);
+    lvgl_trigger_render(disp);
+    boot_profile_end(phase);
 
     // 7. 刷新EPD显示（异步，非阻塞）
     ESP_LOGI("LVGL", "Refreshing EPD with welcome screen (async)...");
     lvgl_display_refresh();
 
-    // 8. 等待EPD刷新完成（异步刷新在后台进行）
-    ESP_LOGI("LVGL", "EPD refresh started in background, continuing initialization...");
-    vTaskDelay(500 / portTICK_PERIOD_MS);  // 短暂等待确保刷新任务已启动
+    // 首屏已渲染：OTA 后第一次启动的新固件到这里确认有效，不再回滚
+    ble_ota_mark_valid();
+
+    // 8. 更新首屏快照（等待刷新任务上传完 framebuffer 后比较，变化时写 SD 卡）
+    // 恢复的阅读页不是首页，不作为首页快照
+    if (sd_ret == ESP_OK && !s_boot_resume) {
+        boot_snapshot_update();
+    } else {
+        free(s_boot_snapshot);
+        s_boot_snapshot = NULL;
+    }
+
+    // 9. 空闲功耗管理：面板休眠后芯片浅睡眠，电源键 GPIO 唤醒，ADC 按键定时采样
+    power_manager_config_t power_cfg = {
+        .idle_ms = POWER_IDLE_MS_DEFAULT,
+        .poll_ms = POWER_POLL_MS_DEFAULT,
+        .wake_gpio = BTN_GPIO3,
+        .can_sleep = power_can_sleep,
+        .before_sleep = power_before_sleep,
+        .after_wake = power_after_wake,
+        .on_activity = charge_maint_pause,
+    };
+    power_manager_init(&power_cfg);
+
+    // 接通 USB 电源且空闲时整理缓存、扫描书库，按键立即暂停
+    const charge_maint_config_t maint_cfg = {
+        .is_charging = is_charging,
+        .can_run = charge_maint_can_run,
+    };
+    charge_maint_init(&maint_cfg);
+
+    // 长按电源键关机；电池过低时自动关机
+    lvgl_set_power_hold_handler(POWER_BUTTON_SLEEP_MS, power_off_requested);
+    lv_timer_create(battery_guard_cb, BATTERY_GUARD_PERIOD_MS, NULL);
+    // 分配失败或空闲堆过低时让缓存收缩
+    lv_timer_create(mem_pressure_timer_cb, MEM_PRESSURE_POLL_MS, NULL);
+
+    // 10. 显示基准测试调度（设置页或 BLE 'X4BM' 命令触发）
+    display_bench_init();
+    // 文本流水线基准测试（设置页或 BLE 'X4TB' 命令触发，语料在 /sdcard/bench）
+    text_bench_init();
+    // 采样剖析（BLE 特征 PROFILER_CHAR_UUID 触发，报告写入 /sdcard/prof 并打印到串口）
+    profiler_init();
+    // 翻页延时遥测（设置页查看，Wi-Fi 传输模式 /cmd?cmd=turn_stats 导出）
+    turn_stats_init();
+    ble_live_init();
+    x4js_layout_init();
+
+    // Wi-Fi 传输模式调度（设置页触发，期间关闭 BLE）
+    wifi_transfer_config_t transfer_cfg = {
+        .ble_stop = transfer_ble_stop,
+        .ble_start = transfer_ble_start,
+    };
+    wifi_transfer_init(&transfer_cfg);
+
+    // USB 传输模式调度（设置页触发，期间关闭 BLE，主机端 tools/x4usb.py）
+    usb_transfer_config_t usb_cfg = {
+        .ble_stop = transfer_ble_stop,
+        .ble_start = transfer_ble_start,
+    };
+    usb_transfer_init(&usb_cfg);
+
+    // BLE 按需启动与空闲关闭
+    ble_power_config_t ble_power_cfg = {
+        .start = ble_start,
+        .stop = ble_stop,
+        .is_running = ble_is_running,
+        .is_idle = ble_is_idle,
+        .set_profile = ble_set_profile,
+        .idle_ms = BLE_POWER_IDLE_MS_DEFAULT,
+    };
+    ble_power_init(&ble_power_cfg);
+
+    // 11. 后台扫描字体目录，完成后由 LVGL 任务应用保存的字体选择
+    if (sd_ret == ESP_OK && !fonts_scanned) {
+        font_manager_start_background_scan();
+    }
 
-    // 9. 创建 LVGL 定时器任务（手动刷新模式：不自动调用 lv_timer_handler）
+    // 12. 创建 LVGL 定时器任务（手动刷新模式：不自动调用 lv_timer_handler）
     // 在手动刷新模式下，UI 更新后需要调用 lvgl_trigger_render() 触发渲染
     // 注意：
     // - 文件浏览器等界面会触发 LVGL 的 image/alpha 混合绘制路径，栈占用明显增大
     // - JPEG 解码器 (TJPGD) 需要额外的栈空间进行解码
-    // - ESP32-C3 上 8192 已经不够，需要增加到 16KB
+    // - ESP32-C3 上 8192 已经不够，需要增加到 16KB（实际峰值见 stack_stats）
     // - 优先级设为 1 (仅高于 idle=0)，避免饿死 idle 任务导致看门狗超时
-    xTaskCreate(lvgl_timer_task, "lvgl_timer", 16384, NULL, 1, NULL);
+    xTaskCreate(lvgl_timer_task, "lvgl_timer", LVGL_TIMER_TASK_STACK, NULL, 1, NULL);
 
     ESP_LOGI("MAIN", "LVGL GUI initialized successfully! (Manual refresh mode for EPD)");
     ESP_LOGI("MAIN", "Use UP/DOWN buttons to navigate, CONFIRM to select");
 
+    boot_profile_log();
     ESP_LOGI("MAIN", "System initialized. LVGL is handling UI events.");
     ESP_LOGI("MAIN", "Main task ending, FreeRTOS tasks continue running...");
+    stack_stats_task_exit();
 }
 
@@ -0,0 +1,214 @@
+/**
+ * @file mem_pressure.c
+ * @brief 内存压力通知实现
+ */
+
+#include "mem_pressure.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "MEM_PRESSURE";
+
+typedef struct {
+    const char *name;
+    mem_pressure_cb_t cb;      // NULL：空槽
+    void *arg;
+    uint8_t prio;
+    uint8_t tag;
+    uint8_t flags;
+    uint32_t runs;             // 被调用并释放了内存的次数
+} handler_t;
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static handler_t s_handlers[MEM_PRESSURE_MAX_HANDLERS];
+static TaskHandle_t s_owner;           // 第一次轮询的任务（LVGL 任务），回调只在其中运行
+static bool s_running;                 // 回调运行中（回调里的分配失败不再递归收缩）
+static size_t s_pending;               // 推迟到轮询的收缩量
+static mem_pressure_stats_t s_stats;
+
+static inline size_t free_now(void) {
+    return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+// 堆的失败回调：可能在任何任务里、包装函数之外，只记下需要的量
+static void failed_alloc_hook(size_t size, uint32_t caps, const char *function_name) {
+    (void)caps;
+    (void)function_name;
+    mem_pressure_request(size);
+}
+
+void mem_pressure_init(void) {
+    if (heap_caps_register_failed_alloc_callback(failed_alloc_hook) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to install allocation failure hook");
+    }
+}
+
+bool mem_pressure_register(const char *name, mem_pressure_prio_t prio, heap_tag_t tag,
+                           uint32_t flags, mem_pressure_cb_t cb, void *arg) {
+    handler_t *slot = NULL;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < MEM_PRESSURE_MAX_HANDLERS; i++) {
+        handler_t *h = &s_handlers[i];
+        if (h->cb == cb && h->arg == arg) {
+            slot = h;
+            break;
+        }
+        if (slot == NULL && h->cb == NULL) {
+            slot = h;
+        }
+    }
+    if (slot != NULL) {
+        if (slot->cb != cb || slot->arg != arg) {
+            slot->runs = 0;
+        }
+        slot->name = name;
+        slot->cb = cb;
+        slot->arg = arg;
+        slot->prio = (uint8_t)prio;
+        slot->tag = (uint8_t)tag;
+        slot->flags = (uint8_t)flags;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (slot == NULL) {
+        ESP_LOGW(TAG, "No slot for %s", name);
+    }
+    return slot != NULL;
+}
+
+void mem_pressure_unregister(mem_pressure_cb_t cb, void *arg) {
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < MEM_PRESSURE_MAX_HANDLERS; i++) {
+        if (s_handlers[i].cb == cb && s_handlers[i].arg == arg) {
+            s_handlers[i].cb = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+// 按优先级调用回调，释放够 want 字节即停；sync 时只调用可同步的、标记不同于 tag 的回调。
+// 回调可能注销自己（槽只清空不移动），所以每次都重新读槽
+static size_t run_handlers(heap_tag_t tag, size_t want, bool sync) {
+    const size_t before = free_now();
+    size_t released = 0;
+    for (int prio = 0; prio < MEM_PRESSURE_PRIO_COUNT && released < want; prio++) {
+        for (int i = 0; i < MEM_PRESSURE_MAX_HANDLERS && released < want; i++) {
+            handler_t *h = &s_handlers[i];
+            const mem_pressure_cb_t cb = h->cb;
+            if (cb == NULL || h->prio != prio ||
+                (sync && ((h->flags & MEM_PRESSURE_SYNC) == 0 || h->tag == tag))) {
+                continue;
+            }
+            if (cb(want - released, h->arg)) {
+                h->runs++;
+            }
+            const size_t now = free_now();
+            released = now > before ? now - before : 0;
+        }
+    }
+    return released;
+}
+
+bool mem_pressure_relieve(heap_tag_t tag, size_t want) {
+    if (s_owner == NULL || xTaskGetCurrentTaskHandle() != s_owner || s_running) {
+        mem_pressure_request(want);
+        return false;
+    }
+    s_running = true;
+    const size_t released = run_handlers(tag, want, true);
+    s_running = false;
+
+    portENTER_CRITICAL(&s_mux);
+    s_stats.events++;
+    s_stats.released += (uint32_t)released;
+    if (released > 0) {
+        s_stats.sync_events++;
+    }
+    // 失败回调已经记下了这次分配：同步释放得够就不必再推迟，不够的部分交给轮询
+    if (released >= want) {
+        s_pending = 0;
+    } else if (want - released > s_pending) {
+        s_pending = want - released;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (released > 0) {
+        ESP_LOGW(TAG, "%s: %u byte allocation failed, released %u", heap_stats_tag_name(tag),
+                 (unsigned)want, (unsigned)released);
+    }
+    return released > 0;
+}
+
+void mem_pressure_note_retry(bool ok) {
+    portENTER_CRITICAL(&s_mux);
+    if (ok) {
+        s_stats.retried_ok++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void mem_pressure_request(size_t want) {
+    portENTER_CRITICAL(&s_mux);
+    if (want > s_pending) {
+        s_pending = want;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void mem_pressure_poll(void) {
+    s_owner = xTaskGetCurrentTaskHandle();
+    if (s_running) {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    size_t want = s_pending;
+    s_pending = 0;
+    portEXIT_CRITICAL(&s_mux);
+
+    // 低水位：空闲堆收回到 HEAP_STATS_RESERVE，最大 DMA 块按 MEM_PRESSURE_DMA_MIN 估计
+    const size_t free_bytes = free_now();
+    const size_t largest_dma = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+    if (free_bytes < MEM_PRESSURE_LOW_WATER && HEAP_STATS_RESERVE - free_bytes > want) {
+        want = HEAP_STATS_RESERVE - free_bytes;
+    }
+    if (largest_dma < MEM_PRESSURE_DMA_MIN && MEM_PRESSURE_DMA_MIN > want) {
+        want = MEM_PRESSURE_DMA_MIN;
+    }
+    if (want == 0) {
+        return;
+    }
+
+    s_running = true;
+    const size_t released = run_handlers(MEM_PRESSURE_TAG_NONE, want, false);
+    s_running = false;
+    portENTER_CRITICAL(&s_mux);
+    s_stats.events++;
+    s_stats.released += (uint32_t)released;
+    portEXIT_CRITICAL(&s_mux);
+    if (released > 0) {
+        ESP_LOGW(TAG, "Pressure: wanted %u, released %u (free %u -> %u, largest DMA %u)",
+                 (unsigned)want, (unsigned)released, (unsigned)free_bytes, (unsigned)free_now(),
+                 (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+    }
+}
+
+void mem_pressure_get_stats(mem_pressure_stats_t *out) {
+    portENTER_CRITICAL(&s_mux);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void mem_pressure_log(void) {
+    mem_pressure_stats_t st;
+    mem_pressure_get_stats(&st);
+    ESP_LOGI(TAG, "%u events (%u on failed allocation, %u retries succeeded), %u bytes released",
+             (unsigned)st.events, (unsigned)st.sync_events, (unsigned)st.retried_ok,
+             (unsigned)st.released);
+    for (int i = 0; i < MEM_PRESSURE_MAX_HANDLERS; i++) {
+        const handler_t *h = &s_handlers[i];
+        if (h->cb != NULL) {
+            ESP_LOGI(TAG, "  %-12s prio %u%s, shrunk %u times", h->name, h->prio,
+                     (h->flags & MEM_PRESSURE_SYNC) ? " sync" : "", (unsigned)h->runs);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file mem_pressure.h
+ * @brief 内存压力通知 - 分配失败或空闲堆过低时让各缓存按优先级收缩
+ *
+ * 缓存按 heap_stats_cache_budget 在打开时定大小，之后堆被别的子系统用掉（Wi-Fi、BLE、
+ * SD 的 DMA 缓冲区）时没人让出内存，分配直接失败。缓存在这里登记收缩回调：
+ *   - heap_stats_malloc 等包装函数分配失败时同步收缩标记为 MEM_PRESSURE_SYNC 的缓存
+ *     （只在 LVGL 任务中，跳过与失败分配同一标记的缓存，它可能正处在操作中间），然后重试一次
+ *   - 其余回调（字形缓存、预取的章节）推迟到 mem_pressure_poll，在 LVGL 定时器里运行，
+ *     此时没有排版或渲染在进行
+ *   - mem_pressure_poll 也检查空闲堆与最大 DMA 块的低水位；包装函数之外的分配失败
+ *     （SD 驱动的 DMA 缓冲区等）由堆的失败回调记下，同样在下一次轮询时处理
+ * 低优先级（丢掉最便宜的）先收缩，够了就停。收缩之后东西还要重新读，只是变慢，不会失败。
+ * 回调都在 LVGL 任务中运行，登记与注销也在 LVGL 任务中（或持有 LVGL 锁时）进行
+ */
+
+#ifndef MEM_PRESSURE_H
+#define MEM_PRESSURE_H
+
+#include "heap_stats.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define MEM_PRESSURE_MAX_HANDLERS 16
+#define MEM_PRESSURE_POLL_MS      1000                  // 轮询周期（main.c 的 LVGL 定时器）
+#define MEM_PRESSURE_LOW_WATER    (HEAP_STATS_RESERVE / 2)  // 空闲堆低于此值时收缩
+#define MEM_PRESSURE_DMA_MIN      (4 * 1024)            // 最大 DMA 块低于此值时收缩
+#define MEM_PRESSURE_TAG_NONE     HEAP_TAG_COUNT        // 不经过包装函数分配的缓存
+
+// 回调可以被同步调用：释放的内存在分配失败的调用栈里没人正在用
+#define MEM_PRESSURE_SYNC 0x01
+
+typedef enum {
+    MEM_PRESSURE_PRIO_SPECULATIVE = 0,   // 预渲染的页面、预取的下一章：丢掉只是少一次加速
+    MEM_PRESSURE_PRIO_CACHE,             // 目录列表、图片目录：丢掉后重新扫描
+    MEM_PRESSURE_PRIO_WORKING,           // 字形与解压块缓存：丢掉后翻页变慢
+    MEM_PRESSURE_PRIO_COUNT
+} mem_pressure_prio_t;
+
+/**
+ * @brief 收缩回调
+ * @param want 还需要的字节数（参考值，释放多少由缓存自己决定）
+ * @return true 释放了内存
+ */
+typedef bool (*mem_pressure_cb_t)(size_t want, void *arg);
+
+typedef struct {
+    uint32_t events;       // 收缩次数（同步与推迟的合计）
+    uint32_t sync_events;  // 其中分配失败时同步收缩的次数
+    uint32_t retried_ok;   // 收缩后重试成功的分配数
+    uint32_t released;     // 累计释放的字节数（收缩前后空闲堆之差）
+} mem_pressure_stats_t;
+
+/**
+ * @brief 安装堆的分配失败回调（启动时调用一次）
+ */
+void mem_pressure_init(void);
+
+/**
+ * @brief 登记收缩回调（同一 cb + arg 重复登记只更新参数）
+ * @param name 日志用（字符串常量，不复制）
+ * @param prio 优先级，低的先收缩
+ * @param tag 缓存的堆标记（同一标记的分配失败时不同步调用），无标记时用 MEM_PRESSURE_TAG_NONE
+ * @param flags MEM_PRESSURE_SYNC 或 0
+ * @return false 表已满
+ */
+bool mem_pressure_register(const char *name, mem_pressure_prio_t prio, heap_tag_t tag,
+                           uint32_t flags, mem_pressure_cb_t cb, void *arg);
+
+/**
+ * @brief 注销（回调内部也可以调用）
+ */
+void mem_pressure_unregister(mem_pressure_cb_t cb, void *arg);
+
+/**
+ * @brief 分配失败后同步收缩（heap_stats 包装函数调用）
+ * @param tag 失败分配的标记
+ * @param want 失败分配的大小
+ * @return true 释放了内存，值得重试
+ */
+bool mem_pressure_relieve(heap_tag_t tag, size_t want);
+
+/**
+ * @brief 记录重试结果（heap_stats 包装函数调用）
+ */
+void mem_pressure_note_retry(bool ok);
+
+/**
+ * @brief 请求在下一次轮询时收缩（任意任务可调用）
+ */
+void mem_pressure_request(size_t want);
+
+/**
+ * @brief 检查低水位并处理推迟的收缩（在 LVGL 任务中周期调用）
+ */
+void mem_pressure_poll(void);
+
+/**
+ * @brief 当前统计
+ */
+void mem_pressure_get_stats(mem_pressure_stats_t *out);
+
+/**
+ * @brief 打印统计与已登记的回调
+ */
+void mem_pressure_log(void);
+
+#endif // MEM_PRESSURE_H
@@ -0,0 +1,215 @@
+/**
+ * @file ota_delta.c
+ * @brief X4DL 补丁解码
+ */
+
+#include "ota_delta.h"
+#include "esp_rom_crc.h"
+#include <string.h>
+
+#define DELTA_RECORD_HDR  12
+
+// 补丁缓冲区里取一个字节，-1 表示补丁结束或出错
+static int patch_byte(ota_delta_t *d) {
+    if (d->patch_idx == d->patch_len) {
+        const int n = d->io.read_patch(d->io.ctx, d->patch, sizeof(d->patch));
+        if (n <= 0) {
+            return -1;
+        }
+        d->patch_len = (uint16_t)n;
+        d->patch_idx = 0;
+    }
+    return d->patch[d->patch_idx++];
+}
+
+static bool patch_read(ota_delta_t *d, uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        const int c = patch_byte(d);
+        if (c < 0) {
+            return false;
+        }
+        buf[i] = (uint8_t)c;
+    }
+    return true;
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool out_flush(ota_delta_t *d) {
+    if (d->out_len == 0) {
+        return true;
+    }
+    if (!d->io.write_new(d->io.ctx, d->out, d->out_len)) {
+        return false;
+    }
+    d->crc = esp_rom_crc32_le(d->crc, d->out, d->out_len);
+    d->out_len = 0;
+    if (d->io.progress != NULL) {
+        d->io.progress(d->io.ctx, d->new_pos, d->hdr.new_size);
+    }
+    return true;
+}
+
+// 输出 n 个字节：diff 字段逐字节加上旧镜像，remain 是本字段剩余长度（决定旧镜像读多少）
+static ota_delta_result_t emit(ota_delta_t *d, const uint8_t *src, uint8_t fill, size_t n,
+                               bool diff, uint32_t *remain) {
+    for (size_t i = 0; i < n; i++) {
+        uint8_t b = src != NULL ? src[i] : fill;
+        if (diff) {
+            if (d->old_idx == d->old_len) {
+                const uint32_t len = *remain < sizeof(d->old) ? *remain : sizeof(d->old);
+                if (!d->io.read_old(d->io.ctx, d->old_pos, d->old, len)) {
+                    return OTA_DELTA_ERR_IO;
+                }
+                d->old_len = (uint16_t)len;
+                d->old_idx = 0;
+            }
+            b = (uint8_t)(b + d->old[d->old_idx++]);
+            d->old_pos++;
+        }
+        (*remain)--;
+        d->out[d->out_len++] = b;
+        d->new_pos++;
+        if (d->out_len == sizeof(d->out) && !out_flush(d)) {
+            return OTA_DELTA_ERR_IO;
+        }
+    }
+    return OTA_DELTA_OK;
+}
+
+// 解压一个 PackBits 字段，正好 len 字节
+static ota_delta_result_t unpack_field(ota_delta_t *d, uint32_t len, bool diff) {
+    uint32_t remain = len;
+    d->old_len = d->old_idx = 0;
+    while (remain > 0) {
+        const int c = patch_byte(d);
+        if (c < 0) {
+            return OTA_DELTA_ERR_FORMAT;
+        }
+        ota_delta_result_t r;
+        if (c < 128) {
+            // 原样字节直接从补丁缓冲区取，跨缓冲区边界时分段
+            uint32_t n = (uint32_t)c + 1;
+            if (n > remain) {
+                return OTA_DELTA_ERR_FORMAT;
+            }
+            while (n > 0) {
+                if (d->patch_idx == d->patch_len) {
+                    const int b = patch_byte(d);
+                    if (b < 0) {
+                        return OTA_DELTA_ERR_FORMAT;
+                    }
+                    d->patch_idx--;
+                }
+                uint32_t take = (uint32_t)(d->patch_len - d->patch_idx);
+                if (take > n) {
+                    take = n;
+                }
+                r = emit(d, d->patch + d->patch_idx, 0, take, diff, &remain);
+                if (r != OTA_DELTA_OK) {
+                    return r;
+                }
+                d->patch_idx += (uint16_t)take;
+                n -= take;
+            }
+        } else {
+            const uint32_t n = (uint32_t)c - 125;
+            const int v = patch_byte(d);
+            if (v < 0 || n > remain) {
+                return OTA_DELTA_ERR_FORMAT;
+            }
+            r = emit(d, NULL, (uint8_t)v, n, diff, &remain);
+            if (r != OTA_DELTA_OK) {
+                return r;
+            }
+        }
+    }
+    return OTA_DELTA_OK;
+}
+
+ota_delta_result_t ota_delta_begin(ota_delta_t *d, const ota_delta_io_t *io) {
+    memset(d, 0, offsetof(ota_delta_t, patch));
+    d->io = *io;
+    uint8_t raw[sizeof(ota_delta_header_t)];
+    if (!patch_read(d, raw, sizeof(raw))) {
+        return OTA_DELTA_ERR_FORMAT;
+    }
+    d->hdr.magic = get_le32(raw);
+    d->hdr.version = (uint16_t)(raw[4] | (raw[5] << 8));
+    d->hdr.flags = (uint16_t)(raw[6] | (raw[7] << 8));
+    d->hdr.old_size = get_le32(raw + 8);
+    d->hdr.old_crc = get_le32(raw + 12);
+    d->hdr.new_size = get_le32(raw + 16);
+    d->hdr.new_crc = get_le32(raw + 20);
+    if (d->hdr.magic != OTA_DELTA_MAGIC || d->hdr.version != OTA_DELTA_VERSION ||
+        d->hdr.flags != 0 || d->hdr.new_size == 0) {
+        return OTA_DELTA_ERR_FORMAT;
+    }
+    return OTA_DELTA_OK;
+}
+
+ota_delta_result_t ota_delta_check_old(ota_delta_t *d) {
+    uint32_t crc = 0;
+    for (uint32_t pos = 0; pos < d->hdr.old_size; ) {
+        uint32_t n = d->hdr.old_size - pos;
+        if (n > sizeof(d->out)) {
+            n = sizeof(d->out);
+        }
+        if (!d->io.read_old(d->io.ctx, pos, d->out, n)) {
+            return OTA_DELTA_ERR_IO;
+        }
+        crc = esp_rom_crc32_le(crc, d->out, n);
+        pos += n;
+    }
+    return crc == d->hdr.old_crc ? OTA_DELTA_OK : OTA_DELTA_ERR_OLD;
+}
+
+ota_delta_result_t ota_delta_run(ota_delta_t *d) {
+    d->old_pos = 0;
+    d->new_pos = 0;
+    d->crc = 0;
+    d->out_len = 0;
+    while (d->new_pos < d->hdr.new_size) {
+        uint8_t rec[DELTA_RECORD_HDR];
+        if (!patch_read(d, rec, sizeof(rec))) {
+            return OTA_DELTA_ERR_FORMAT;
+        }
+        const uint32_t diff_len = get_le32(rec);
+        const uint32_t extra_len = get_le32(rec + 4);
+        const int32_t seek = (int32_t)get_le32(rec + 8);
+        const uint32_t left = d->hdr.new_size - d->new_pos;
+        if (diff_len > left || extra_len > left - diff_len ||
+            diff_len > d->hdr.old_size || d->old_pos > d->hdr.old_size - diff_len) {
+            return OTA_DELTA_ERR_FORMAT;
+        }
+        ota_delta_result_t r = unpack_field(d, diff_len, true);
+        if (r == OTA_DELTA_OK) {
+            r = unpack_field(d, extra_len, false);
+        }
+        if (r != OTA_DELTA_OK) {
+            return r;
+        }
+        const int64_t next = (int64_t)d->old_pos + seek;
+        if (next < 0 || next > (int64_t)d->hdr.old_size) {
+            return OTA_DELTA_ERR_FORMAT;
+        }
+        d->old_pos = (uint32_t)next;
+    }
+    if (!out_flush(d)) {
+        return OTA_DELTA_ERR_IO;
+    }
+    return d->crc == d->hdr.new_crc ? OTA_DELTA_OK : OTA_DELTA_ERR_CRC;
+}
+
+const char *ota_delta_result_name(ota_delta_result_t r) {
+    switch (r) {
+    case OTA_DELTA_OK:         return "ok";
+    case OTA_DELTA_ERR_FORMAT: return "bad patch";
+    case OTA_DELTA_ERR_OLD:    return "base image mismatch";
+    case OTA_DELTA_ERR_IO:     return "I/O error";
+    case OTA_DELTA_ERR_CRC:    return "CRC mismatch";
+    default:                   return "?";
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file ota_delta.h
+ * @brief X4DL 固件差分补丁：bsdiff 式的控制三元组，按记录流式解码
+ *
+ * 补丁由 tools/x4delta.py 生成（装了 bsdiff4 时直接取它的匹配结果）。
+ * 两次构建之间大部分代码只是地址平移，bsdiff 把新镜像表示成"旧镜像的某段加上
+ * 一串逐字节差值"再插入少量新字节，差值绝大多数是 0，PackBits 压缩后补丁通常
+ * 只有完整镜像的几分之一，BLE 传输时间相应缩短。
+ *
+ * 布局（整数均为小端）：
+ *   头部 32 字节：magic 'X4DL'、version u16、flags u16、old_size、old_crc、
+ *                new_size、new_crc、保留 8 字节（CRC32 与 esp_rom_crc32_le(0, ...) 相同）
+ *   记录，直到输出 new_size 字节：
+ *     diff_len u32、extra_len u32、seek i32
+ *     diff  ：PackBits 流，解压出 diff_len 字节，逐字节加上旧镜像 old_pos 处的字节
+ *     extra ：PackBits 流，解压出 extra_len 字节，原样输出
+ *     之后 old_pos 前进 diff_len + seek
+ * 每个 PackBits 流单独编码，不跨字段（与 packbits.h 的编码相同）。
+ * old_size 为 0 时补丁就是压缩后的完整镜像
+ */
+
+#ifndef OTA_DELTA_H
+#define OTA_DELTA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OTA_DELTA_MAGIC     0x4C443458u   // "X4DL"
+#define OTA_DELTA_VERSION   1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;        // 目前为 0
+    uint32_t old_size;     // 补丁所基于的旧镜像长度（字节）
+    uint32_t old_crc;      // 旧镜像前 old_size 字节的 CRC32
+    uint32_t new_size;
+    uint32_t new_crc;
+    uint32_t reserved[2];
+} ota_delta_header_t;
+
+typedef enum {
+    OTA_DELTA_OK = 0,
+    OTA_DELTA_ERR_FORMAT,  // 头部或记录不合法、补丁截断
+    OTA_DELTA_ERR_OLD,     // 设备上的旧镜像与补丁基于的不一致
+    OTA_DELTA_ERR_IO,      // 读补丁、读旧镜像或写新镜像失败
+    OTA_DELTA_ERR_CRC,     // 解出的新镜像 CRC 不符
+} ota_delta_result_t;
+
+/**
+ * @brief 数据来源与去向（均在调用 ota_delta_run 的任务中调用）
+ */
+typedef struct {
+    // 顺序读补丁，返回读到的字节数，0 表示结束，负数表示出错
+    int (*read_patch)(void *ctx, uint8_t *buf, size_t len);
+    // 随机读旧镜像
+    bool (*read_old)(void *ctx, uint32_t offset, uint8_t *buf, size_t len);
+    // 顺序写新镜像
+    bool (*write_new)(void *ctx, const uint8_t *buf, size_t len);
+    // 进度（每输出一块调用一次，可为 NULL）
+    void (*progress)(void *ctx, uint32_t done, uint32_t total);
+    void *ctx;
+} ota_delta_io_t;
+
+#define OTA_DELTA_PATCH_BUF 512
+#define OTA_DELTA_OLD_BUF   512
+#define OTA_DELTA_OUT_BUF   4096   // 与 flash 扇区相同，esp_ota_write 按扇区擦写
+
+typedef struct {
+    ota_delta_io_t io;
+    ota_delta_header_t hdr;
+    uint32_t old_pos;
+    uint32_t new_pos;      // 已解出的字节数（含 out 中未写出的）
+    uint32_t crc;          // 已写出部分的 CRC32
+    uint16_t patch_len;
+    uint16_t patch_idx;
+    uint16_t old_len;
+    uint16_t old_idx;
+    uint16_t out_len;
+    uint8_t patch[OTA_DELTA_PATCH_BUF];
+    uint8_t old[OTA_DELTA_OLD_BUF];
+    uint8_t out[OTA_DELTA_OUT_BUF];
+} ota_delta_t;
+
+/**
+ * @brief 读取并检查头部（d 约 5 KB，由调用方分配）
+ */
+ota_delta_result_t ota_delta_begin(ota_delta_t *d, const ota_delta_io_t *io);
+
+/**
+ * @brief 用 read_old 计算旧镜像前 old_size 字节的 CRC，与头部比较（擦写目标分区前调用）
+ */
+ota_delta_result_t ota_delta_check_old(ota_delta_t *d);
+
+/**
+ * @brief 解码全部记录并写出新镜像，最后校验 new_crc
+ */
+ota_delta_result_t ota_delta_run(ota_delta_t *d);
+
+/**
+ * @brief 结果的简短名称（日志与通知用）
+ */
+const char *ota_delta_result_name(ota_delta_result_t r);
+
+#endif // OTA_DELTA_H
@@ -0,0 +1,158 @@
+/**
+ * @file packbits.c
+ * @brief PackBits 压缩与解压
+ */
+
+#include "packbits.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define PACKBITS_RUN_MIN  3
+#define PACKBITS_RUN_MAX  130
+#define PACKBITS_LIT_MAX  128
+#define PACKBITS_IO_BUF   512
+
+typedef struct {
+    FILE *fp;
+    uint8_t buf[PACKBITS_IO_BUF];
+    size_t len;
+    bool ok;
+} rle_writer_t;
+
+static void rle_put(rle_writer_t *w, const uint8_t *data, size_t len) {
+    while (len > 0 && w->ok) {
+        size_t n = sizeof(w->buf) - w->len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(w->buf + w->len, data, n);
+        w->len += n;
+        data += n;
+        len -= n;
+        if (w->len == sizeof(w->buf)) {
+            w->ok = fwrite(w->buf, 1, w->len, w->fp) == w->len;
+            w->len = 0;
+        }
+    }
+}
+
+static size_t run_length(const uint8_t *p, size_t remain) {
+    size_t n = 1;
+    while (n < remain && n < PACKBITS_RUN_MAX && p[n] == p[0]) {
+        n++;
+    }
+    return n;
+}
+
+typedef void (*rle_emit_t)(void *ctx, const uint8_t *data, size_t len);
+
+// 编码核心：控制字节与数据依次交给 emit
+static void rle_encode(const uint8_t *src, size_t size, rle_emit_t emit, void *ctx) {
+    size_t i = 0;
+    while (i < size) {
+        const size_t run = run_length(src + i, size - i);
+        if (run >= PACKBITS_RUN_MIN) {
+            const uint8_t code[2] = { (uint8_t)(run + 125), src[i] };
+            emit(ctx, code, sizeof(code));
+            i += run;
+            continue;
+        }
+        // 原样字节一直收集到下一段足够长的重复为止
+        size_t lit = run;
+        while (i + lit < size && lit < PACKBITS_LIT_MAX &&
+               run_length(src + i + lit, size - i - lit) < PACKBITS_RUN_MIN) {
+            lit++;
+        }
+        const uint8_t code = (uint8_t)(lit - 1);
+        emit(ctx, &code, 1);
+        emit(ctx, src + i, lit);
+        i += lit;
+    }
+}
+
+static void file_emit(void *ctx, const uint8_t *data, size_t len) {
+    rle_put((rle_writer_t *)ctx, data, len);
+}
+
+bool packbits_write(FILE *fp, const uint8_t *src, size_t size) {
+    rle_writer_t *w = (rle_writer_t *)malloc(sizeof(rle_writer_t));
+    if (w == NULL) {
+        return false;
+    }
+    w->fp = fp;
+    w->len = 0;
+    w->ok = true;
+
+    rle_encode(src, size, file_emit, w);
+    if (w->ok && w->len > 0) {
+        w->ok = fwrite(w->buf, 1, w->len, w->fp) == w->len;
+    }
+    const bool ok = w->ok;
+    free(w);
+    return ok;
+}
+
+typedef struct {
+    uint8_t *dst;
+    size_t len;
+} mem_writer_t;
+
+static void mem_emit(void *ctx, const uint8_t *data, size_t len) {
+    mem_writer_t *w = (mem_writer_t *)ctx;
+    memcpy(w->dst + w->len, data, len);
+    w->len += len;
+}
+
+size_t packbits_encode(const uint8_t *src, size_t size, uint8_t *dst) {
+    mem_writer_t w = { dst, 0 };
+    rle_encode(src, size, mem_emit, &w);
+    return w.len;
+}
+
+bool packbits_read(FILE *fp, uint8_t *dst, size_t size) {
+    size_t pos = 0;
+    int c;
+    while (pos < size && (c = fgetc(fp)) != EOF) {
+        if (c < 128) {
+            const size_t n = (size_t)c + 1;
+            if (pos + n > size || fread(dst + pos, 1, n, fp) != n) {
+                return false;
+            }
+            pos += n;
+        } else {
+            const size_t n = (size_t)c - 125;
+            const int v = fgetc(fp);
+            if (v == EOF || pos + n > size) {
+                return false;
+            }
+            memset(dst + pos, v, n);
+            pos += n;
+        }
+    }
+    return pos == size;
+}
+
+bool packbits_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t size) {
+    size_t in = 0;
+    size_t pos = 0;
+    while (pos < size && in < src_len) {
+        const uint8_t c = src[in++];
+        if (c < 128) {
+            const size_t n = (size_t)c + 1;
+            if (pos + n > size || in + n > src_len) {
+                return false;
+            }
+            memcpy(dst + pos, src + in, n);
+            in += n;
+            pos += n;
+        } else {
+            const size_t n = (size_t)c - 125;
+            if (pos + n > size || in >= src_len) {
+                return false;
+            }
+            memset(dst + pos, src[in++], n);
+            pos += n;
+        }
+    }
+    return pos == size;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file packbits.h
+ * @brief 位图文件用的 PackBits 压缩（断电恢复画面、图片缓存、BLE 截图）
+ *
+ * 控制字节 c < 128 时后跟 c+1 个原样字节；c >= 128 时后跟 1 个字节，重复 c-125 次（3..130）。
+ * 1bpp 画面大片白色，压缩后通常只有原来的几分之一
+ */
+
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief 压缩 src 并写入 fp 的当前位置
+ * @return true 全部写入
+ */
+bool packbits_write(FILE *fp, const uint8_t *src, size_t size);
+
+// size 字节压缩后的最大长度（全是原样字节时每 128 字节多一个控制字节）
+#define PACKBITS_BOUND(size)  ((size) + ((size) + 127) / 128)
+
+/**
+ * @brief 压缩到内存
+ * @param dst 至少 PACKBITS_BOUND(size) 字节
+ * @return 压缩后的字节数
+ */
+size_t packbits_encode(const uint8_t *src, size_t size, uint8_t *dst);
+
+/**
+ * @brief 从 fp 的当前位置读取并解压，正好得到 size 字节
+ * @return true 数据完整
+ */
+bool packbits_read(FILE *fp, uint8_t *dst, size_t size);
+
+/**
+ * @brief 从内存解压 src_len 字节的压缩数据，正好得到 size 字节
+ * @return true 数据完整
+ */
+bool packbits_decode(const uint8_t *src, size_t src_len, uint8_t *dst, size_t size);
+
+#endif // PACKBITS_H
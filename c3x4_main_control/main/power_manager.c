@@ -0,0 +1,199 @@
+/**
+ * @file power_manager.c
+ * @brief 空闲功耗管理实现
+ */
+
+#include "power_manager.h"
+#include "lvgl_driver.h"
+#include "trace.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char *TAG = "POWER";
+
+static power_manager_config_t s_cfg = {
+    .idle_ms = POWER_IDLE_MS_DEFAULT,
+    .poll_ms = POWER_POLL_MS_DEFAULT,
+    .wake_gpio = GPIO_NUM_NC,
+    .can_sleep = NULL,
+    .before_sleep = NULL,
+    .after_wake = NULL,
+    .on_activity = NULL,
+};
+static bool s_initialized = false;
+static uint32_t s_idle_hint_ms = 0;  // 非 0 时替代较长的 idle_ms
+static volatile int64_t s_last_activity_us = 0;
+static bool s_dozing = false;        // 已进入连续浅睡眠（只在进入/退出时打日志）
+static int64_t s_doze_start_us = 0;
+static uint32_t s_doze_cycles = 0;
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t s_locks[POWER_LOCK_COUNT];
+
+// 配置动态调频并创建电源锁；失败时加解锁保持为空操作
+static void power_manager_pm_init(void) {
+    esp_pm_config_t pm_cfg = {
+        .max_freq_mhz = POWER_CPU_MAX_MHZ,
+        .min_freq_mhz = POWER_CPU_MIN_MHZ,
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+        .light_sleep_enable = true,
+#endif
+    };
+    esp_err_t err = esp_pm_configure(&pm_cfg);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_pm_configure failed: %s", esp_err_to_name(err));
+        return;
+    }
+
+    static const struct {
+        esp_pm_lock_type_t type;
+        const char *name;
+    } specs[POWER_LOCK_COUNT] = {
+        [POWER_LOCK_CPU] = {ESP_PM_CPU_FREQ_MAX, "burst"},
+        [POWER_LOCK_BUS] = {ESP_PM_APB_FREQ_MAX, "epd_upload"},
+        [POWER_LOCK_AWAKE] = {ESP_PM_NO_LIGHT_SLEEP, "awake"},
+    };
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        err = esp_pm_lock_create(specs[i].type, 0, specs[i].name, &s_locks[i]);
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "esp_pm_lock_create(%s) failed: %s", specs[i].name, esp_err_to_name(err));
+            s_locks[i] = NULL;
+        }
+    }
+    ESP_LOGI(TAG, "DFS %d-%d MHz, auto light sleep %s", POWER_CPU_MIN_MHZ, POWER_CPU_MAX_MHZ,
+             pm_cfg.light_sleep_enable ? "on" : "off");
+}
+#endif
+
+void power_manager_lock(power_lock_t lock) {
+#if CONFIG_PM_ENABLE
+    if (lock < POWER_LOCK_COUNT && s_locks[lock] != NULL) {
+        esp_pm_lock_acquire(s_locks[lock]);
+    }
+#else
+    (void)lock;
+#endif
+}
+
+void power_manager_unlock(power_lock_t lock) {
+#if CONFIG_PM_ENABLE
+    if (lock < POWER_LOCK_COUNT && s_locks[lock] != NULL) {
+        esp_pm_lock_release(s_locks[lock]);
+    }
+#else
+    (void)lock;
+#endif
+}
+
+void power_manager_init(const power_manager_config_t *cfg) {
+    if (cfg != NULL) {
+        s_cfg = *cfg;
+        if (s_cfg.poll_ms == 0) {
+            s_cfg.poll_ms = POWER_POLL_MS_DEFAULT;
+        }
+    }
+    s_last_activity_us = esp_timer_get_time();
+#if CONFIG_PM_ENABLE
+    power_manager_pm_init();
+#endif
+    s_initialized = true;
+    ESP_LOGI(TAG, "Power manager: light sleep after %u ms idle, key poll %u ms, wake GPIO %d",
+             (unsigned)s_cfg.idle_ms, (unsigned)s_cfg.poll_ms, (int)s_cfg.wake_gpio);
+}
+
+void power_manager_notify_activity(void) {
+    s_last_activity_us = esp_timer_get_time();
+    if (s_cfg.on_activity != NULL) {
+        s_cfg.on_activity();
+    }
+}
+
+uint32_t power_manager_get_idle_ms(void) {
+    return (uint32_t)((esp_timer_get_time() - s_last_activity_us) / 1000);
+}
+
+// 退出连续浅睡眠：预热面板并重新开始空闲计时
+static void power_manager_wake(esp_sleep_wakeup_cause_t cause) {
+    lvgl_display_wake();
+    power_manager_notify_activity();
+    if (s_dozing) {
+        s_dozing = false;
+        ESP_LOGI(TAG, "Woke from light sleep (cause=%d) after %d ms, %u cycle(s)",
+                 (int)cause, (int)((esp_timer_get_time() - s_doze_start_us) / 1000),
+                 (unsigned)s_doze_cycles);
+        if (s_cfg.after_wake != NULL) {
+            s_cfg.after_wake();
+        }
+    }
+}
+
+bool power_manager_idle_hook(void) {
+    if (!s_initialized || s_cfg.idle_ms == 0) {
+        return false;
+    }
+    const uint32_t idle_ms = (s_idle_hint_ms > 0 && s_idle_hint_ms < s_cfg.idle_ms) ? s_idle_hint_ms : s_cfg.idle_ms;
+    const int64_t now = esp_timer_get_time();
+    if (now - s_last_activity_us < (int64_t)idle_ms * 1000) {
+        return false;
+    }
+    // 面板先休眠（刷新任务负责）；上传或波形进行中不能停掉 CPU
+    if (lvgl_is_panel_busy() || !lvgl_is_panel_asleep()) {
+        return false;
+    }
+    if (s_cfg.can_sleep != NULL && !s_cfg.can_sleep()) {
+        if (s_dozing) {
+            power_manager_wake(ESP_SLEEP_WAKEUP_UNDEFINED);
+        }
+        return false;
+    }
+
+    if (!s_dozing) {
+        // 睡眠期间可能直接断电：先把缓存的数据落盘
+        if (s_cfg.before_sleep != NULL) {
+            s_cfg.before_sleep();
+        }
+        s_dozing = true;
+        s_doze_start_us = now;
+        s_doze_cycles = 0;
+        ESP_LOGI(TAG, "Idle %u ms, entering light sleep", (unsigned)idle_ms);
+    }
+
+    // 电源键：低电平唤醒；ADC 按键：定时唤醒后采样
+    if (s_cfg.wake_gpio != GPIO_NUM_NC) {
+        gpio_wakeup_enable(s_cfg.wake_gpio, GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+    }
+    esp_sleep_enable_timer_wakeup((uint64_t)s_cfg.poll_ms * 1000);
+
+    const int64_t sleep_start = esp_timer_get_time();
+    const esp_err_t err = esp_light_sleep_start();
+    const esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    if (s_cfg.wake_gpio != GPIO_NUM_NC) {
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+        gpio_wakeup_disable(s_cfg.wake_gpio);
+    }
+    s_doze_cycles++;
+    TRACE_EVENT(TRACE_EV_LIGHT_SLEEP, (uint32_t)(esp_timer_get_time() - sleep_start), cause);
+
+    if (err != ESP_OK) {
+        // 例如射频仍在工作时被拒绝：重新计时，避免每轮都尝试
+        ESP_LOGW(TAG, "Light sleep rejected: %s", esp_err_to_name(err));
+        power_manager_wake(cause);
+        return false;
+    }
+    if (cause == ESP_SLEEP_WAKEUP_GPIO || get_pressed_button() != BTN_NONE) {
+        power_manager_wake(cause);
+    }
+    return true;
+}
+
+void power_manager_set_idle_hint(uint32_t ms) {
+    s_idle_hint_ms = ms;
+}
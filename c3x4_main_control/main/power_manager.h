@@ -0,0 +1,92 @@
+/**
+ * @file power_manager.h
+ * @brief 空闲功耗管理：面板休眠后让 ESP32-C3 进入浅睡眠，按键唤醒
+ *
+ * 面板控制器的休眠由 lvgl_driver 的刷新任务负责（lvgl_set_panel_sleep_timeout）。
+ * 这里在此基础上管理芯片：没有按键活动超过 idle_ms、面板已休眠且调用方允许时，
+ * LVGL 定时器任务调用 esp_light_sleep_start()。唤醒源：
+ *   - 电源键（数字输入，低电平唤醒）
+ *   - 定时器：每 poll_ms 唤醒一次采样 ADC 电阻分压按键（分压后的电平
+ *     不一定低于数字输入阈值，无法直接作为 GPIO 唤醒源）
+ * 检测到按键后立即调用 lvgl_display_wake() 预热面板，再回到正常事件循环
+ *
+ * 动态调频（CONFIG_PM_ENABLE）：平时由 esp_pm 降到 POWER_CPU_MIN_MHZ，渲染、图片解码、
+ * 解压期间持有 POWER_LOCK_CPU 升到 POWER_CPU_MAX_MHZ；BUSY 等待与阅读间隙不持锁。
+ * CONFIG_FREERTOS_USE_TICKLESS_IDLE 时同时开启自动浅睡眠，SPI 上传与 BLE 连接期间
+ * 持有对应的锁。未开启 CONFIG_PM_ENABLE 时加解锁为空操作
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/gpio.h"
+
+// 默认参数
+#define POWER_IDLE_MS_DEFAULT 8000  // 最后一次按键后多久允许浅睡眠
+#define POWER_POLL_MS_DEFAULT 50    // 浅睡眠期间采样 ADC 按键的周期
+
+#define POWER_CPU_MAX_MHZ 160       // 突发负载时的 CPU 频率
+#define POWER_CPU_MIN_MHZ 40        // 空闲时的 CPU 频率（XTAL）
+
+// 电源锁：可嵌套，加锁与解锁须成对
+typedef enum {
+    POWER_LOCK_CPU = 0,   // CPU 最高频率：渲染、图片解码、解压
+    POWER_LOCK_BUS,       // APB 最高频率：一整帧的 SPI DMA 上传（驱动只在单次传输内持锁）
+    POWER_LOCK_AWAKE,     // 禁止自动浅睡眠：BLE 连接期间、面板上传期间
+    POWER_LOCK_COUNT
+} power_lock_t;
+
+typedef struct {
+    uint32_t idle_ms;         // 无按键活动多久后允许浅睡眠（0 = 关闭浅睡眠）
+    uint32_t poll_ms;         // 浅睡眠期间定时唤醒采样 ADC 按键的周期
+    gpio_num_t wake_gpio;     // 低电平有效的数字按键（GPIO_NUM_NC 表示没有）
+    bool (*can_sleep)(void);  // 可选：返回 false 时本轮不睡（BLE 连接、传输中等）
+    void (*before_sleep)(void); // 可选：每次开始浅睡眠前调用一次（写入缓存的数据等）
+    void (*after_wake)(void);   // 可选：被按键唤醒、退出连续浅睡眠时调用一次
+    void (*on_activity)(void);  // 可选：每次用户活动时调用（任意任务，须立即返回）
+} power_manager_config_t;
+
+/**
+ * @brief 初始化功耗管理（在 lvgl_display_init 之后调用）
+ * @param cfg 配置；NULL 使用默认参数且没有数字唤醒按键
+ */
+void power_manager_init(const power_manager_config_t *cfg);
+
+/**
+ * @brief 记录一次用户活动（按键），重新开始空闲计时
+ */
+void power_manager_notify_activity(void);
+
+/**
+ * @brief 距最后一次用户活动的毫秒数
+ */
+uint32_t power_manager_get_idle_ms(void);
+
+/**
+ * @brief 空闲检查：条件满足时进入一次浅睡眠，唤醒后返回
+ *
+ * 在 LVGL 定时器任务的循环中调用。每次最多睡 poll_ms，
+ * 返回后其他任务照常运行，下一轮循环再继续睡
+ * @return true 表示本次调用确实睡了一轮（调用方应立即重新采样按键，不再额外等待）
+ */
+bool power_manager_idle_hook(void);
+
+/**
+ * @brief 临时缩短进入浅睡眠前的空闲时间（阅读节奏较慢时由阅读器设置）
+ * @param ms 空闲时间（毫秒），只在小于配置的 idle_ms 时生效；0 恢复配置值
+ */
+void power_manager_set_idle_hint(uint32_t ms);
+
+/**
+ * @brief 持有电源锁（可在任意任务中调用；power_manager_init 之前为空操作）
+ */
+void power_manager_lock(power_lock_t lock);
+
+/**
+ * @brief 释放电源锁
+ */
+void power_manager_unlock(power_lock_t lock);
+
+#endif // POWER_MANAGER_H
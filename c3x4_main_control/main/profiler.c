@@ -0,0 +1,411 @@
+/**
+ * @file profiler.c
+ * @brief 采样剖析器实现
+ *
+ * 采样：GPTimer（XTAL 时钟，不持有 APB 频率锁，不改变被测的调频行为）的报警中断
+ * 读取 mepc。中断优先级高于常用驱动，进入回调时 mepc 仍是被打断处的地址；
+ * 被打断的是低优先级中断时记到该中断的代码上。
+ * 结束：持续时间到（esp_timer 回调）或写满或 profiler_stop，停止定时器并取第二次
+ * 任务统计；合并样本、写 SD 卡和串口放在 LVGL 任务的定时器里做
+ */
+
+#include "profiler.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "version.h"
+#include "sdkconfig.h"
+#include "driver/gptimer.h"
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "riscv/csr.h"
+#include "lvgl.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static const char *TAG = "PROF";
+
+#define PROF_POLL_MS          500
+#define PROF_TIMER_HZ         1000000
+#define PROF_INTR_PRIORITY    3
+#define PROF_EXTRA_TASKS      4        // 剖析期间新建的任务
+#define PROF_SERIAL_PCS_MAX   128      // 串口只打印计数最多的 PC，完整列表在 SD 卡文件中
+#define PROF_TASK_UNKNOWN     0xFF
+
+typedef enum {
+    PROF_IDLE = 0,
+    PROF_SAMPLING,
+    PROF_DONE,             // 已停止，等待 LVGL 任务生成报告
+} prof_state_t;
+
+// 采样时 tag 是任务句柄；合并后为 任务序号 << 24 | 次数
+typedef struct {
+    uint32_t pc;
+    uint32_t tag;
+} prof_sample_t;
+
+typedef struct {
+    TaskStatus_t *tasks;
+    UBaseType_t count;
+    configRUN_TIME_COUNTER_TYPE total;
+} prof_snapshot_t;
+
+typedef void (*prof_sink_t)(void *ctx, const char *line);
+
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t len;
+    bool full;
+} prof_text_t;
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static lv_timer_t *s_poll_timer = NULL;
+static SemaphoreHandle_t s_report_mutex = NULL;
+static volatile prof_state_t s_state = PROF_IDLE;
+static gptimer_handle_t s_gptimer = NULL;
+static esp_timer_handle_t s_stop_timer = NULL;
+
+static prof_sample_t *s_samples = NULL;
+static volatile uint32_t s_count = 0;
+static volatile uint32_t s_dropped = 0;
+static uint32_t s_rate_hz = 0;
+static int64_t s_start_us = 0;
+static int64_t s_end_us = 0;
+static prof_snapshot_t s_snap_begin;
+static prof_snapshot_t s_snap_end;
+
+static char s_report[PROFILER_BLE_REPORT_MAX];
+static size_t s_report_len = 0;
+
+static bool IRAM_ATTR on_alarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata,
+                               void *arg) {
+    (void)timer;
+    (void)edata;
+    (void)arg;
+    const uint32_t pc = (uint32_t)RV_READ_CSR(mepc);
+    const uint32_t n = s_count;
+    if (n < PROFILER_MAX_SAMPLES) {
+        s_samples[n].pc = pc;
+        s_samples[n].tag = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+        s_count = n + 1;
+    } else {
+        s_dropped++;
+    }
+    return false;
+}
+
+static bool snapshot_alloc(prof_snapshot_t *snap) {
+    const UBaseType_t cap = uxTaskGetNumberOfTasks() + PROF_EXTRA_TASKS;
+    snap->tasks = (TaskStatus_t *)calloc(cap, sizeof(TaskStatus_t));
+    snap->count = cap;
+    snap->total = 0;
+    return snap->tasks != NULL;
+}
+
+static void snapshot_take(prof_snapshot_t *snap) {
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    snap->count = uxTaskGetSystemState(snap->tasks, snap->count, &snap->total);
+#else
+    snap->count = 0;
+#endif
+}
+
+static void snapshot_free(prof_snapshot_t *snap) {
+    free(snap->tasks);
+    snap->tasks = NULL;
+    snap->count = 0;
+}
+
+static void release_session(void) {
+    free(s_samples);
+    s_samples = NULL;
+    snapshot_free(&s_snap_begin);
+    snapshot_free(&s_snap_end);
+}
+
+static void stop_timer_cb(void *arg) {
+    (void)arg;
+    profiler_stop();
+}
+
+bool profiler_start(uint32_t duration_ms, uint32_t rate_hz) {
+    if (s_poll_timer == NULL || s_state != PROF_IDLE) {
+        return false;
+    }
+    if (duration_ms == 0) {
+        duration_ms = PROFILER_DURATION_DEFAULT;
+    }
+    if (rate_hz == 0) {
+        rate_hz = PROFILER_RATE_DEFAULT;
+    } else if (rate_hz > PROFILER_RATE_MAX) {
+        rate_hz = PROFILER_RATE_MAX;
+    }
+
+    s_samples = (prof_sample_t *)malloc(PROFILER_MAX_SAMPLES * sizeof(prof_sample_t));
+    if (s_samples == NULL || !snapshot_alloc(&s_snap_begin) || !snapshot_alloc(&s_snap_end)) {
+        ESP_LOGE(TAG, "No memory for profiling session");
+        release_session();
+        return false;
+    }
+
+    const gptimer_config_t timer_cfg = {
+        .clk_src = GPTIMER_CLK_SRC_XTAL,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = PROF_TIMER_HZ,
+        .intr_priority = PROF_INTR_PRIORITY,
+    };
+    const gptimer_event_callbacks_t cbs = { .on_alarm = on_alarm };
+    const gptimer_alarm_config_t alarm_cfg = {
+        .alarm_count = PROF_TIMER_HZ / rate_hz,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    if (s_stop_timer == NULL) {
+        const esp_timer_create_args_t args = { .callback = stop_timer_cb, .name = "prof_stop" };
+        if (esp_timer_create(&args, &s_stop_timer) != ESP_OK) {
+            s_stop_timer = NULL;
+        }
+    }
+    if (s_stop_timer == NULL || gptimer_new_timer(&timer_cfg, &s_gptimer) != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot create profiling timer");
+        s_gptimer = NULL;
+        release_session();
+        return false;
+    }
+    gptimer_register_event_callbacks(s_gptimer, &cbs, NULL);
+    gptimer_set_alarm_action(s_gptimer, &alarm_cfg);
+    gptimer_enable(s_gptimer);
+
+    s_count = 0;
+    s_dropped = 0;
+    s_rate_hz = rate_hz;
+    power_manager_lock(POWER_LOCK_AWAKE);
+    snapshot_take(&s_snap_begin);
+    s_state = PROF_SAMPLING;
+    s_start_us = esp_timer_get_time();
+    gptimer_start(s_gptimer);
+    esp_timer_start_once(s_stop_timer, (uint64_t)duration_ms * 1000);
+    ESP_LOGI(TAG, "Profiling for %u ms at %u Hz", (unsigned)duration_ms, (unsigned)rate_hz);
+    return true;
+}
+
+void profiler_stop(void) {
+    // esp_timer 回调与 BLE 命令可能同时到达，只有一方能完成切换
+    bool owner = false;
+    portENTER_CRITICAL(&s_mux);
+    if (s_state == PROF_SAMPLING) {
+        s_state = PROF_DONE;
+        owner = true;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (!owner) {
+        return;
+    }
+    gptimer_stop(s_gptimer);
+    s_end_us = esp_timer_get_time();
+    esp_timer_stop(s_stop_timer);
+    gptimer_disable(s_gptimer);
+    gptimer_del_timer(s_gptimer);
+    s_gptimer = NULL;
+    snapshot_take(&s_snap_end);
+    power_manager_unlock(POWER_LOCK_AWAKE);
+    lvgl_timer_task_wake();
+}
+
+bool profiler_is_running(void) { return s_state != PROF_IDLE; }
+
+size_t profiler_copy_report(char *buf, size_t len) {
+    if (s_report_mutex == NULL || len == 0) {
+        return 0;
+    }
+    xSemaphoreTake(s_report_mutex, portMAX_DELAY);
+    const size_t n = s_report_len < len - 1 ? s_report_len : len - 1;
+    memcpy(buf, s_report, n);
+    buf[n] = '\0';
+    xSemaphoreGive(s_report_mutex);
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// 报告
+// ---------------------------------------------------------------------------
+
+static uint8_t task_index(TaskHandle_t handle) {
+    for (UBaseType_t i = 0; i < s_snap_end.count && i < PROF_TASK_UNKNOWN; i++) {
+        if (s_snap_end.tasks[i].xHandle == handle) {
+            return (uint8_t)i;
+        }
+    }
+    return PROF_TASK_UNKNOWN;
+}
+
+static const char *task_name(uint8_t index) {
+    return index < s_snap_end.count ? s_snap_end.tasks[index].pcTaskName : "?";
+}
+
+static int cmp_task_pc(const void *a, const void *b) {
+    const prof_sample_t *x = (const prof_sample_t *)a;
+    const prof_sample_t *y = (const prof_sample_t *)b;
+    if (x->tag != y->tag) {
+        return x->tag < y->tag ? -1 : 1;
+    }
+    return x->pc < y->pc ? -1 : (x->pc > y->pc ? 1 : 0);
+}
+
+static int cmp_count_desc(const void *a, const void *b) {
+    const uint32_t x = ((const prof_sample_t *)a)->tag & 0xFFFFFF;
+    const uint32_t y = ((const prof_sample_t *)b)->tag & 0xFFFFFF;
+    return x > y ? -1 : (x < y ? 1 : 0);
+}
+
+// 合并相同 (任务, PC) 的样本，按次数从多到少排列，返回不同 PC 的条数
+static uint32_t fold_samples(void) {
+    const uint32_t n = s_count;
+    for (uint32_t i = 0; i < n; i++) {
+        s_samples[i].tag = task_index((TaskHandle_t)(uintptr_t)s_samples[i].tag);
+    }
+    qsort(s_samples, n, sizeof(prof_sample_t), cmp_task_pc);
+    uint32_t out = 0;
+    for (uint32_t i = 0; i < n; ) {
+        uint32_t j = i + 1;
+        while (j < n && s_samples[j].tag == s_samples[i].tag && s_samples[j].pc == s_samples[i].pc) {
+            j++;
+        }
+        s_samples[out].pc = s_samples[i].pc;
+        s_samples[out].tag = (s_samples[i].tag << 24) | (j - i);
+        out++;
+        i = j;
+    }
+    qsort(s_samples, out, sizeof(prof_sample_t), cmp_count_desc);
+    return out;
+}
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static configRUN_TIME_COUNTER_TYPE task_runtime_delta(const TaskStatus_t *t) {
+    for (UBaseType_t i = 0; i < s_snap_begin.count; i++) {
+        if (s_snap_begin.tasks[i].xHandle == t->xHandle) {
+            return t->ulRunTimeCounter - s_snap_begin.tasks[i].ulRunTimeCounter;
+        }
+    }
+    return t->ulRunTimeCounter;   // 剖析期间新建的任务
+}
+#endif
+
+static void emit_report(prof_sink_t sink, void *ctx, uint32_t entries, uint32_t max_pcs) {
+    char line[96];
+    sink(ctx, "x4prof 1");
+    snprintf(line, sizeof(line), "version %s", VERSION_STRING);
+    sink(ctx, line);
+    snprintf(line, sizeof(line), "session %u %u %u %u", (unsigned)s_rate_hz,
+             (unsigned)(s_end_us - s_start_us), (unsigned)s_count, (unsigned)s_dropped);
+    sink(ctx, line);
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    const configRUN_TIME_COUNTER_TYPE total = s_snap_end.total - s_snap_begin.total;
+    for (UBaseType_t i = 0; i < s_snap_end.count; i++) {
+        const TaskStatus_t *t = &s_snap_end.tasks[i];
+        const configRUN_TIME_COUNTER_TYPE rt = task_runtime_delta(t);
+        snprintf(line, sizeof(line), "task %s %u %u", t->pcTaskName, (unsigned)rt,
+                 (unsigned)(total > 0 ? (uint64_t)rt * 1000 / total : 0));
+        sink(ctx, line);
+    }
+#endif
+
+    for (uint32_t i = 0; i < entries && i < max_pcs; i++) {
+        snprintf(line, sizeof(line), "pc %08x %s %u", (unsigned)s_samples[i].pc,
+                 task_name((uint8_t)(s_samples[i].tag >> 24)),
+                 (unsigned)(s_samples[i].tag & 0xFFFFFF));
+        sink(ctx, line);
+    }
+    sink(ctx, "end");
+}
+
+static void sink_file(void *ctx, const char *line) {
+    fprintf((FILE *)ctx, "%s\n", line);
+}
+
+static void sink_serial(void *ctx, const char *line) {
+    (void)ctx;
+    printf(PROFILER_LOG_PREFIX "%s\n", line);
+}
+
+// 总留出结尾 "end\n" 的位置；装不下的行及其后各行丢弃（PC 按次数排列，丢的是最少的）
+#define PROF_TEXT_END_RESERVE 4
+
+static void sink_text(void *ctx, const char *line) {
+    prof_text_t *t = (prof_text_t *)ctx;
+    const size_t n = strlen(line) + 1;
+    const bool last = strcmp(line, "end") == 0;
+    if (!last && (t->full || t->len + n + PROF_TEXT_END_RESERVE > t->cap)) {
+        t->full = true;
+        return;
+    }
+    memcpy(t->buf + t->len, line, n - 1);
+    t->buf[t->len + n - 1] = '\n';
+    t->len += n;
+}
+
+static void save_report(uint32_t entries) {
+    if (mkdir(PROFILER_DIR, 0775) != 0 && errno != EEXIST) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d)", PROFILER_DIR, errno);
+        return;
+    }
+    time_t now;
+    time(&now);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    char stamp[24];
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &timeinfo);
+    char path[64];
+    snprintf(path, sizeof(path), "%s/prof_%s.txt", PROFILER_DIR, stamp);
+
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        return;
+    }
+    emit_report(sink_file, f, entries, entries);
+    fclose(f);
+    ESP_LOGI(TAG, "Report written to %s", path);
+}
+
+static void poll_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (s_state != PROF_DONE) {
+        return;
+    }
+    const uint32_t entries = fold_samples();
+    ESP_LOGI(TAG, "Session done: %u samples (%u dropped), %u distinct PCs",
+             (unsigned)s_count, (unsigned)s_dropped, (unsigned)entries);
+
+    save_report(entries);
+    emit_report(sink_serial, NULL, entries, PROF_SERIAL_PCS_MAX);
+
+    xSemaphoreTake(s_report_mutex, portMAX_DELAY);
+    prof_text_t text = { .buf = s_report, .cap = sizeof(s_report), .len = 0, .full = false };
+    emit_report(sink_text, &text, entries, entries);
+    s_report_len = text.len;
+    xSemaphoreGive(s_report_mutex);
+
+    release_session();
+    s_state = PROF_IDLE;
+}
+
+void profiler_init(void) {
+    if (s_poll_timer != NULL) {
+        return;
+    }
+    s_report_mutex = xSemaphoreCreateMutex();
+    if (s_report_mutex != NULL) {
+        s_poll_timer = lv_timer_create(poll_timer_cb, PROF_POLL_MS, NULL);
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file profiler.h
+ * @brief 采样剖析器与按任务的 CPU 统计
+ *
+ * 一次剖析持续 duration_ms：高优先级定时器中断按 rate_hz 读取被打断处的 PC（mepc）
+ * 和当前任务，写入环形缓冲区，写满即停；开始和结束时各取一次 FreeRTOS 运行时间统计
+ * （uxTaskGetSystemState），差值就是区间内各任务（epd_refresh、lvgl_timer、nimble_host、
+ * IDLE 等）占用的 CPU。期间禁止浅睡眠，否则定时器停走。
+ *
+ * 结束后样本按 (任务, PC) 合并计数，生成文本报告：
+ *   - 写入 /sdcard/prof/prof_<时间>.txt
+ *   - 逐行打印到串口（以 PROFILER_LOG_PREFIX 开头）
+ *   - 经 BLE 特征读取（截断到 PROFILER_BLE_REPORT_MAX，计数多的 PC 在前）
+ * tools/x4prof.py 读取任一来源，用固件 ELF 的符号表把 PC 换成函数名并汇总
+ *
+ * 报告格式（每行一条，空格分隔）：
+ *   x4prof 1
+ *   version <固件版本>
+ *   session <采样率 Hz> <持续 us> <样本数> <丢弃数>
+ *   task <名称> <运行 us> <千分比>
+ *   pc <十六进制地址> <任务名> <次数>
+ *   end
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROFILER_DIR               "/sdcard/prof"
+#define PROFILER_LOG_PREFIX        "X4PROF "
+#define PROFILER_MAX_SAMPLES       1024     // 8 KB，剖析期间才分配
+#define PROFILER_RATE_DEFAULT      200      // Hz
+#define PROFILER_RATE_MAX          2000
+#define PROFILER_DURATION_DEFAULT  5000     // ms
+#define PROFILER_BLE_REPORT_MAX    1024
+
+/**
+ * @brief 注册结果处理定时器（LVGL 初始化后调用；报告在 LVGL 任务中写 SD 卡）
+ */
+void profiler_init(void);
+
+/**
+ * @brief 开始一次剖析（任意任务中调用）
+ * @param duration_ms 持续时间，0 表示默认值
+ * @param rate_hz 采样率，0 表示默认值，超过 PROFILER_RATE_MAX 时截断
+ * @return false 表示已在进行、内存不足或定时器创建失败
+ */
+bool profiler_start(uint32_t duration_ms, uint32_t rate_hz);
+
+/**
+ * @brief 提前结束（报告照常生成）
+ */
+void profiler_stop(void);
+
+/**
+ * @brief 是否正在采样或等待生成报告
+ */
+bool profiler_is_running(void);
+
+/**
+ * @brief 复制最近一次报告（BLE 读取用，截断到 len - 1 字节）
+ * @return 写入的字节数（不含结尾 0），还没有报告时返回 0
+ */
+size_t profiler_copy_report(char *buf, size_t len);
+
+#endif // PROFILER_H
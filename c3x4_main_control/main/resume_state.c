@@ -0,0 +1,109 @@
+/**
+ * @file resume_state.c
+ * @brief 断电恢复文件的读写
+ */
+
+#include "resume_state.h"
+#include "packbits.h"
+#include "sd_path.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "RESUME";
+
+#define RESUME_MAGIC    0x53523458u   // "X4RS"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t size;                       // 解压后字节数
+    uint32_t crc;                        // esp_rom_crc32_le(0, 画面, size)
+    char book[RESUME_STATE_BOOK_MAX];
+} resume_hdr_t;
+
+static bool s_file_valid = false;    // 文件存在且与面板一致（本次运行中写入或未确认）
+static uint32_t s_saved_crc = 0;
+static char s_saved_book[RESUME_STATE_BOOK_MAX];
+
+bool resume_state_save(const uint8_t *frame, size_t size, const char *book_path) {
+    if (frame == NULL || book_path == NULL || strlen(book_path) >= RESUME_STATE_BOOK_MAX) {
+        return false;
+    }
+    const uint32_t crc = esp_rom_crc32_le(0, frame, size);
+    if (s_file_valid && crc == s_saved_crc && strcmp(book_path, s_saved_book) == 0) {
+        return true;
+    }
+
+    resume_hdr_t *hdr = (resume_hdr_t *)calloc(1, sizeof(resume_hdr_t));
+    if (hdr == NULL) {
+        return false;
+    }
+    hdr->magic = RESUME_MAGIC;
+    hdr->size = (uint32_t)size;
+    hdr->crc = crc;
+    strncpy(hdr->book, book_path, sizeof(hdr->book) - 1);
+
+    sd_path_make_parents(RESUME_STATE_PATH);
+    FILE *fp = fopen(RESUME_STATE_PATH, "wb");
+    bool ok = fp != NULL && fwrite(hdr, 1, sizeof(*hdr), fp) == sizeof(*hdr) &&
+              packbits_write(fp, frame, size);
+    long written = 0;
+    if (fp != NULL) {
+        written = ftell(fp);
+        ok = (fclose(fp) == 0) && ok;
+    }
+    free(hdr);
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to save resume state");
+        remove(RESUME_STATE_PATH);
+        s_file_valid = false;
+        return false;
+    }
+    s_file_valid = true;
+    s_saved_crc = crc;
+    strcpy(s_saved_book, book_path);
+    ESP_LOGI(TAG, "Resume state saved: %s (%u -> %ld bytes)", book_path, (unsigned)size, written);
+    return true;
+}
+
+uint8_t *resume_state_load(size_t size, char *book_path, size_t path_len) {
+    FILE *fp = fopen(RESUME_STATE_PATH, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+    resume_hdr_t *hdr = (resume_hdr_t *)malloc(sizeof(resume_hdr_t));
+    uint8_t *frame = NULL;
+    if (hdr != NULL && fread(hdr, 1, sizeof(*hdr), fp) == sizeof(*hdr) &&
+        hdr->magic == RESUME_MAGIC && hdr->size == size &&
+        memchr(hdr->book, '\0', sizeof(hdr->book)) != NULL &&
+        strlen(hdr->book) < path_len) {
+        frame = (uint8_t *)malloc(size);
+        if (frame != NULL && (!packbits_read(fp, frame, size) ||
+                              esp_rom_crc32_le(0, frame, size) != hdr->crc)) {
+            ESP_LOGW(TAG, "Resume state corrupt, ignored");
+            free(frame);
+            frame = NULL;
+        }
+        if (frame != NULL) {
+            strcpy(book_path, hdr->book);
+        }
+    }
+    fclose(fp);
+    free(hdr);
+
+    // 只用一次：读出后画面随时可能改变
+    remove(RESUME_STATE_PATH);
+    s_file_valid = false;
+    return frame;
+}
+
+void resume_state_invalidate(void) {
+    if (!s_file_valid) {
+        return;
+    }
+    remove(RESUME_STATE_PATH);
+    s_file_valid = false;
+}
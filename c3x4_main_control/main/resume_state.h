@@ -0,0 +1,46 @@
+/**
+ * @file resume_state.h
+ * @brief 断电恢复：浅睡眠前保存面板画面和正在读的书，开机不清屏直接回到阅读页
+ *
+ * 墨水屏断电后画面还在，但控制器 RAM（0x24/0x26）会丢失。进入浅睡眠前
+ * （睡眠期间可能直接断电）把前台 framebuffer 压缩后连同书籍路径写入
+ * RESUME_STATE_PATH；开机时 EPD 任务读出画面，只写回控制器 RAM 不刷新，
+ * 阅读器按进度日志重新打开这本书，首次局刷以该画面为基准，画面不变则面板不动。
+ *
+ * 文件只描述"睡眠时"面板上的内容：唤醒（用户开始操作）或开机读取后立即删除，
+ * 避免之后翻页再断电时用过期的画面做基准
+ *
+ * 画面以 PackBits 压缩保存（见 packbits.h）
+ */
+
+#ifndef RESUME_STATE_H
+#define RESUME_STATE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RESUME_STATE_PATH     "/sdcard/.x4cache/resume.bin"
+#define RESUME_STATE_BOOK_MAX 256
+
+/**
+ * @brief 保存面板画面与书籍路径（LVGL 任务中调用，面板空闲时）
+ * 与上次保存的内容相同时不重复写入
+ * @return true 已保存（或内容未变）
+ */
+bool resume_state_save(const uint8_t *frame, size_t size, const char *book_path);
+
+/**
+ * @brief 读取并删除恢复文件
+ * @param size 期望的 framebuffer 字节数
+ * @param book_path 输出：书籍路径
+ * @return malloc 分配的画面（调用方 free），没有有效文件时返回 NULL
+ */
+uint8_t *resume_state_load(size_t size, char *book_path, size_t path_len);
+
+/**
+ * @brief 删除恢复文件（面板内容即将改变时调用；没有文件时不访问 SD 卡）
+ */
+void resume_state_invalidate(void);
+
+#endif // RESUME_STATE_H
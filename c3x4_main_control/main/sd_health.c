@@ -0,0 +1,169 @@
+/**
+ * @file sd_health.c
+ * @brief SD 卡只读健康检查与诊断自检
+ */
+
+#include "sd_health.h"
+#include "sd_path.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "SD";
+
+#define SD_HEALTH_NVS_KEY      "bench"
+#define SD_HEALTH_BENCH_CHUNK  8        // 每次读取的扇区数
+#define SD_SELFTEST_SIZE       4096
+
+typedef struct {
+    uint32_t serial;
+    uint8_t mfg_id;
+    char name[8];
+    uint32_t read_kbps;
+    uint32_t bench_khz;
+} sd_bench_cache_t;
+
+static sd_health_t s_health;
+
+static bool cid_looks_valid(const sdmmc_card_t *card) {
+    if (card->cid.mfg_id == 0) {
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(card->cid.name) && card->cid.name[i] != '\0'; i++) {
+        if (!isprint((unsigned char)card->cid.name[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 顺序读取开头的扇区并计时，返回 KB/s（失败返回 0）
+static uint32_t bench_read(sdmmc_card_t *card) {
+    const size_t sector = card->csd.sector_size;
+    uint8_t *buf = (uint8_t *)heap_caps_malloc(SD_HEALTH_BENCH_CHUNK * sector, MALLOC_CAP_DMA);
+    if (buf == NULL) {
+        return 0;
+    }
+    const int64_t start_us = esp_timer_get_time();
+    bool ok = true;
+    for (size_t s = 0; s < SD_HEALTH_BENCH_SECTORS && ok; s += SD_HEALTH_BENCH_CHUNK) {
+        ok = sdmmc_read_sectors(card, buf, s, SD_HEALTH_BENCH_CHUNK) == ESP_OK;
+    }
+    const int64_t elapsed_us = esp_timer_get_time() - start_us;
+    heap_caps_free(buf);
+    if (!ok || elapsed_us <= 0) {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)SD_HEALTH_BENCH_SECTORS * sector * 1000000 / 1024 / (uint64_t)elapsed_us);
+}
+
+void sd_health_probe(sdmmc_card_t *card) {
+    memset(&s_health, 0, sizeof(s_health));
+    if (card == NULL) {
+        return;
+    }
+
+    s_health.cid_ok = cid_looks_valid(card);
+    s_health.csd_ok = card->csd.capacity > 0 && card->csd.sector_size == 512;
+    if (!s_health.cid_ok) {
+        ESP_LOGW(TAG, "Card CID looks invalid (mfg 0x%02x), card may be counterfeit or damaged",
+                 (unsigned)card->cid.mfg_id);
+    }
+    if (!s_health.csd_ok) {
+        ESP_LOGW(TAG, "Card CSD looks invalid: %d sectors of %d bytes",
+                 card->csd.capacity, card->csd.sector_size);
+        return;
+    }
+
+    sd_bench_cache_t cache = {0};
+    size_t cache_len = sizeof(cache);
+    nvs_handle_t nvs;
+    if (nvs_open(SD_HEALTH_NVS_NS, NVS_READONLY, &nvs) == ESP_OK) {
+        const bool found = nvs_get_blob(nvs, SD_HEALTH_NVS_KEY, &cache, &cache_len) == ESP_OK &&
+                           cache_len == sizeof(cache);
+        nvs_close(nvs);
+        if (found && cache.serial == (uint32_t)card->cid.serial &&
+            cache.mfg_id == (uint8_t)card->cid.mfg_id &&
+            strncmp(cache.name, card->cid.name, sizeof(cache.name)) == 0) {
+            s_health.read_kbps = cache.read_kbps;
+            s_health.bench_khz = cache.bench_khz;
+            s_health.bench_cached = true;
+        }
+    }
+
+    // 新卡，或上次测速后总线时钟变了
+    if (!s_health.bench_cached || s_health.bench_khz != (uint32_t)card->real_freq_khz) {
+        s_health.read_kbps = bench_read(card);
+        s_health.bench_khz = (uint32_t)card->real_freq_khz;
+        s_health.bench_cached = false;
+        if (s_health.read_kbps > 0 && nvs_open(SD_HEALTH_NVS_NS, NVS_READWRITE, &nvs) == ESP_OK) {
+            cache.serial = (uint32_t)card->cid.serial;
+            cache.mfg_id = (uint8_t)card->cid.mfg_id;
+            strncpy(cache.name, card->cid.name, sizeof(cache.name));
+            cache.read_kbps = s_health.read_kbps;
+            cache.bench_khz = s_health.bench_khz;
+            nvs_set_blob(nvs, SD_HEALTH_NVS_KEY, &cache, sizeof(cache));
+            nvs_commit(nvs);
+            nvs_close(nvs);
+        }
+    }
+    ESP_LOGI(TAG, "Card health: CID %s, read %lu KB/s at %lu kHz%s",
+             s_health.cid_ok ? "ok" : "suspect", (unsigned long)s_health.read_kbps,
+             (unsigned long)s_health.bench_khz, s_health.bench_cached ? " (cached)" : "");
+}
+
+const sd_health_t *sd_health_get(void) {
+    return &s_health;
+}
+
+bool sd_health_selftest(void) {
+    uint8_t *data = (uint8_t *)malloc(SD_SELFTEST_SIZE * 2);
+    if (data == NULL) {
+        return false;
+    }
+    uint8_t *readback = data + SD_SELFTEST_SIZE;
+    for (size_t i = 0; i < SD_SELFTEST_SIZE; i++) {
+        data[i] = (uint8_t)(i ^ (i >> 8));
+    }
+
+    sd_path_make_parents(SD_HEALTH_SELFTEST_PATH);
+    FILE *f = fopen(SD_HEALTH_SELFTEST_PATH, "wb");
+    bool ok = f != NULL && fwrite(data, 1, SD_SELFTEST_SIZE, f) == SD_SELFTEST_SIZE;
+    if (f != NULL) {
+        ok = (fclose(f) == 0) && ok;
+    }
+    if (ok) {
+        f = fopen(SD_HEALTH_SELFTEST_PATH, "rb");
+        ok = f != NULL && fread(readback, 1, SD_SELFTEST_SIZE, f) == SD_SELFTEST_SIZE &&
+             memcmp(data, readback, SD_SELFTEST_SIZE) == 0;
+        if (f != NULL) {
+            fclose(f);
+        }
+    }
+    remove(SD_HEALTH_SELFTEST_PATH);
+    free(data);
+
+    if (ok) {
+        ESP_LOGI(TAG, "Self-test passed: %d bytes written and verified", SD_SELFTEST_SIZE);
+    } else {
+        ESP_LOGE(TAG, "Self-test failed");
+    }
+    return ok;
+}
+
+size_t sd_health_format_json(char *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    const int n = snprintf(buf, len,
+                           "{\"cid_ok\":%s,\"csd_ok\":%s,\"read_kbps\":%lu,\"bench_khz\":%lu,\"cached\":%s}",
+                           s_health.cid_ok ? "true" : "false", s_health.csd_ok ? "true" : "false",
+                           (unsigned long)s_health.read_kbps, (unsigned long)s_health.bench_khz,
+                           s_health.bench_cached ? "true" : "false");
+    return (n < 0 || (size_t)n >= len) ? 0 : (size_t)n;
+}
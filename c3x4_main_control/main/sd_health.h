@@ -0,0 +1,55 @@
+/**
+ * @file sd_health.h
+ * @brief SD 卡健康检查：开机只做只读检查，读写自检改为按需运行的诊断
+ *
+ * 开机时 sd_health_probe 只读取挂载时已经拿到的 CID/CSD 做合理性检查（厂商号、
+ * 产品名、容量、扇区大小），不写卡。扇区读取速度测试只对新卡运行一次：
+ * 结果按 CID 缓存在 NVS，之后开机直接使用缓存值。
+ *
+ * 原先每次开机都写 test.txt 并写读校验一个 256 字节文件，在 400 kHz 下要几百毫秒，
+ * 还会反复写卡；现在改为诊断模式，由 Wi-Fi 传输模式的 /cmd?cmd=sd_selftest 触发
+ */
+
+#ifndef SD_HEALTH_H
+#define SD_HEALTH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sdmmc_cmd.h"
+
+#define SD_HEALTH_NVS_NS        "sd_health"
+#define SD_HEALTH_BENCH_SECTORS 64      // 速度测试读取的扇区数（32 KB）
+#define SD_HEALTH_SELFTEST_PATH "/sdcard/.x4cache/selftest.bin"
+
+typedef struct {
+    bool cid_ok;            // 厂商号非 0、产品名为可打印字符
+    bool csd_ok;            // 容量非 0、扇区 512 字节
+    uint32_t read_kbps;     // 扇区顺序读取速度（0 = 未测）
+    uint32_t bench_khz;     // 测速时的总线时钟
+    bool bench_cached;      // 测速结果来自 NVS 缓存
+} sd_health_t;
+
+/**
+ * @brief 挂载（并协商时钟）后调用：只读检查，新卡首次使用时测速
+ */
+void sd_health_probe(sdmmc_card_t *card);
+
+/**
+ * @brief 最近一次检查的结果（未挂载时各项为 0）
+ */
+const sd_health_t *sd_health_get(void);
+
+/**
+ * @brief 诊断：写入、读回校验并删除 SD_HEALTH_SELFTEST_PATH
+ * @return true 自检通过
+ */
+bool sd_health_selftest(void);
+
+/**
+ * @brief 导出为 JSON：{"cid_ok":..,"csd_ok":..,"read_kbps":..,"bench_khz":..,"cached":..}
+ * @return 写入长度（不含结尾 0）
+ */
+size_t sd_health_format_json(char *buf, size_t len);
+
+#endif // SD_HEALTH_H
@@ -0,0 +1,48 @@
+/**
+ * @file sd_path.c
+ * @brief SD 卡相对路径检查实现
+ */
+
+#include "sd_path.h"
+#include <string.h>
+#include <sys/stat.h>
+
+bool sd_path_is_safe(const char *rel) {
+    const size_t len = strlen(rel);
+    const size_t suffix_len = sizeof(SD_PATH_PART_SUFFIX) - 1;
+    if (len == 0 || len > SD_PATH_REL_MAX || rel[0] == '/' || rel[len - 1] == '/') {
+        return false;
+    }
+    if (len >= suffix_len && strcmp(rel + len - suffix_len, SD_PATH_PART_SUFFIX) == 0) {
+        return false;
+    }
+    bool seg_start = true;
+    for (size_t i = 0; i < len; i++) {
+        const unsigned char c = (unsigned char)rel[i];
+        if (c < 0x20 || c == '\\' || c == ':') {
+            return false;
+        }
+        if (seg_start && (c == '.' || c == '/')) {
+            return false;
+        }
+        seg_start = (c == '/');
+    }
+    return true;
+}
+
+void sd_path_make_parents(const char *full_path) {
+    char dir[256];
+    strncpy(dir, full_path, sizeof(dir) - 1);
+    dir[sizeof(dir) - 1] = '\0';
+    if (strncmp(dir, SD_PATH_ROOT, sizeof(SD_PATH_ROOT) - 1) != 0) {
+        return;
+    }
+    // mkdir 对已存在的目录失败，忽略即可
+    for (char *p = dir + sizeof(SD_PATH_ROOT) - 1; *p != '\0'; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            mkdir(dir, 0775);
+            *p = '/';
+        }
+    }
+}
@@ -0,0 +1,32 @@
+/**
+ * @file sd_path.h
+ * @brief 远程上传（BLE 文件传输、Wi-Fi 传输模式）使用的 SD 卡相对路径检查
+ *
+ * 手机或浏览器给出的路径都相对于 /sdcard，写入前必须确认不会跳出根目录，
+ * 也不会覆盖隐藏目录（.x4cache 等缓存）和传输中的临时文件
+ */
+
+#ifndef SD_PATH_H
+#define SD_PATH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SD_PATH_ROOT        "/sdcard/"
+#define SD_PATH_PART_SUFFIX ".part"      // 传输中的临时文件，收齐后改名
+#define SD_PATH_REL_MAX     200          // 相对路径上限（加上根目录和后缀不超过 256 字节）
+
+/**
+ * @brief 相对路径是否可以用来写文件
+ *
+ * 不以 '/' 开头或结尾，没有空段，任何一段都不以 '.' 开头（同时挡住 ".."
+ * 和隐藏目录），不含控制字符、'\\' 和 ':'，不以 .part 结尾
+ */
+bool sd_path_is_safe(const char *rel);
+
+/**
+ * @brief 逐级创建 full_path（以 SD_PATH_ROOT 开头）的父目录，已存在的忽略
+ */
+void sd_path_make_parents(const char *full_path);
+
+#endif // SD_PATH_H
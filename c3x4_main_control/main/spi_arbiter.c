@@ -0,0 +1,60 @@
+/**
+ * @file spi_arbiter.c
+ * @brief SPI2 总线调度实现
+ */
+
+#include "spi_arbiter.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static int s_render_waiters = 0;
+static bool s_yielding = false;            // EPD 正在让出总线，读取全部结束时释放 s_idle_sem
+static SemaphoreHandle_t s_idle_sem = NULL;
+static StaticSemaphore_t s_idle_sem_buf;   // 不用任务通知：刷新任务的通知已用于刷新请求和 BUSY
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void spi_arbiter_sd_begin(void) {
+    portENTER_CRITICAL(&s_mux);
+    s_render_waiters++;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void spi_arbiter_sd_end(void) {
+    bool wake = false;
+    portENTER_CRITICAL(&s_mux);
+    if (s_render_waiters > 0) {
+        s_render_waiters--;
+    }
+    if (s_render_waiters == 0 && s_yielding) {
+        s_yielding = false;
+        wake = true;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (wake) {
+        xSemaphoreGive(s_idle_sem);
+    }
+}
+
+bool spi_arbiter_epd_should_yield(void) {
+    return s_render_waiters > 0;
+}
+
+void spi_arbiter_epd_yield(void) {
+    // 只有 EPD 刷新任务调用，首次使用时创建
+    if (s_idle_sem == NULL) {
+        s_idle_sem = xSemaphoreCreateBinaryStatic(&s_idle_sem_buf);
+    }
+    xSemaphoreTake(s_idle_sem, 0);  // 清除上次超时后迟到的释放
+
+    portENTER_CRITICAL(&s_mux);
+    const bool waiting = s_render_waiters > 0;
+    s_yielding = waiting;
+    portEXIT_CRITICAL(&s_mux);
+
+    if (waiting) {
+        xSemaphoreTake(s_idle_sem, pdMS_TO_TICKS(SPI_ARB_YIELD_MAX_MS));
+        portENTER_CRITICAL(&s_mux);
+        s_yielding = false;
+        portEXIT_CRITICAL(&s_mux);
+    }
+}
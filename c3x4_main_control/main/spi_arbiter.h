@@ -0,0 +1,48 @@
+/**
+ * @file spi_arbiter.h
+ * @brief EPD 与 SD 卡共用 SPI2 时的总线调度
+ *
+ * EPD 上传一帧（最多 48 KB）时刷新任务持有总线（spi_device_acquire_bus），
+ * 期间 SD 卡的事务只能排队等整帧发完。异步刷新模式下 LVGL 正是在这段时间里
+ * 渲染下一页、从 SD 读字形和正文，所以上传被切成 SPI_ARB_BURST_BYTES 的段：
+ *
+ * - 渲染需要的读取（字形、正文块、EPUB 解压输入）用 spi_arbiter_sd_begin/end
+ *   包住。段边界上有这样的读取在等待时，EPD 释放总线并让出 CPU，等所有
+ *   渲染读取做完（一批读合并在一次让出里）再继续，最多等 SPI_ARB_YIELD_MAX_MS
+ * - 后台 SD 访问（BLE 接收写入、缓存文件）不登记，照旧等到整帧上传结束，
+ *   不打断上传
+ *
+ * 没有登记的读取时上传仍是一条连续的 DMA 链，吞吐与不调度时相同。
+ * begin/end 只应包住单次读取（毫秒级），不要包住整页排版
+ */
+
+#ifndef SPI_ARBITER_H
+#define SPI_ARBITER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPI_ARB_BURST_BYTES   8192   // EPD 上传的让出粒度（10 MHz 下约 6.5 ms）
+#define SPI_ARB_YIELD_MAX_MS  30     // 一次让出最多等待渲染读取的时间
+
+/**
+ * @brief 登记一次渲染需要的 SD 读取（任意任务，可嵌套）
+ */
+void spi_arbiter_sd_begin(void);
+
+/**
+ * @brief 结束 spi_arbiter_sd_begin 登记的读取
+ */
+void spi_arbiter_sd_end(void);
+
+/**
+ * @brief EPD 上传段边界调用：是否有渲染读取在等待总线
+ */
+bool spi_arbiter_epd_should_yield(void);
+
+/**
+ * @brief EPD 已释放总线后调用：阻塞到渲染读取全部结束或超时
+ */
+void spi_arbiter_epd_yield(void);
+
+#endif // SPI_ARBITER_H
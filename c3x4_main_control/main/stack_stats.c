@@ -0,0 +1,136 @@
+/**
+ * @file stack_stats.c
+ * @brief 任务栈遥测实现
+ */
+
+#include "stack_stats.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "STACK";
+
+typedef struct {
+    const char *name;
+    TaskHandle_t task;     // NULL：任务已退出（或空槽，name 也为 NULL）
+    uint32_t size;
+    uint32_t peak;
+} stack_entry_t;
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static stack_entry_t s_entries[STACK_STATS_MAX_TASKS];
+
+// 按高水位更新峰值（ESP-IDF 的栈以字节为单位）；在临界区内调用，任务不会中途被删
+static void sample(stack_entry_t *e) {
+    if (e->task == NULL) {
+        return;
+    }
+    const uint32_t unused = (uint32_t)uxTaskGetStackHighWaterMark(e->task);
+    const uint32_t used = e->size > unused ? e->size - unused : 0;
+    if (used > e->peak) {
+        e->peak = used;
+    }
+}
+
+void stack_stats_register_self(const char *name, uint32_t stack_size) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    portENTER_CRITICAL(&s_mux);
+    stack_entry_t *slot = NULL;
+    for (int i = 0; i < STACK_STATS_MAX_TASKS; i++) {
+        stack_entry_t *e = &s_entries[i];
+        // 同名的已退出任务（如再次开始的 OTA）沿用原来的槽位，峰值继续累计
+        if (e->task == self || (e->task == NULL && e->name != NULL && strcmp(e->name, name) == 0)) {
+            slot = e;
+            break;
+        }
+        if (slot == NULL && e->name == NULL) {
+            slot = e;
+        }
+    }
+    if (slot != NULL) {
+        slot->name = name;
+        slot->task = self;
+        slot->size = stack_size;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (slot == NULL) {
+        ESP_LOGW(TAG, "No slot for task %s", name);
+    }
+}
+
+void stack_stats_task_exit(void) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < STACK_STATS_MAX_TASKS; i++) {
+        if (s_entries[i].task == self) {
+            sample(&s_entries[i]);
+            s_entries[i].task = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void stack_stats_release(const char *name) {
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < STACK_STATS_MAX_TASKS; i++) {
+        stack_entry_t *e = &s_entries[i];
+        if (e->task != NULL && strcmp(e->name, name) == 0) {
+            sample(e);
+            e->task = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+int stack_stats_get(stack_task_stats_t *out, int max) {
+    int n = 0;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < STACK_STATS_MAX_TASKS && n < max; i++) {
+        stack_entry_t *e = &s_entries[i];
+        if (e->name == NULL) {
+            continue;
+        }
+        sample(e);
+        out[n].name = e->name;
+        out[n].size = e->size;
+        out[n].peak = e->peak;
+        out[n].alive = e->task != NULL;
+        n++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return n;
+}
+
+void stack_stats_log(void) {
+    stack_task_stats_t tasks[STACK_STATS_MAX_TASKS];
+    const int n = stack_stats_get(tasks, STACK_STATS_MAX_TASKS);
+    for (int i = 0; i < n; i++) {
+        ESP_LOGI(TAG, "  %-12s %5u / %5u bytes (%u%%)%s", tasks[i].name, (unsigned)tasks[i].peak,
+                 (unsigned)tasks[i].size, (unsigned)(tasks[i].peak * 100 / (tasks[i].size ? tasks[i].size : 1)),
+                 tasks[i].alive ? "" : " exited");
+    }
+}
+
+size_t stack_stats_format_json(char *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    stack_task_stats_t tasks[STACK_STATS_MAX_TASKS];
+    const int n = stack_stats_get(tasks, STACK_STATS_MAX_TASKS);
+    size_t pos = (size_t)snprintf(buf, len, "{\"tasks\":[");
+    for (int i = 0; i < n && pos < len; i++) {
+        pos += (size_t)snprintf(buf + pos, len - pos, "%s{\"name\":\"%s\",\"size\":%u,\"peak\":%u,\"alive\":%s}",
+                                i ? "," : "", tasks[i].name, (unsigned)tasks[i].size,
+                                (unsigned)tasks[i].peak, tasks[i].alive ? "true" : "false");
+    }
+    if (pos < len) {
+        pos += (size_t)snprintf(buf + pos, len - pos, "]}");
+    }
+    if (pos >= len) {
+        buf[0] = '\0';
+        return 0;
+    }
+    return pos;
+}
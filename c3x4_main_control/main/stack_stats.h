@@ -0,0 +1,63 @@
+/**
+ * @file stack_stats.h
+ * @brief 任务栈遥测 - 各任务的栈大小与开机以来的最高占用
+ *
+ * 任务栈原来是估出来的。任务在入口处用 stack_stats_register_self 登记自己的栈大小，
+ * 读取时按 FreeRTOS 的高水位（栈上从未被写过的字节数）得到实际最高占用，据此调整
+ * 栈大小，把多留的内存还给缓存。自己删除的任务在 vTaskDelete 之前调用
+ * stack_stats_task_exit，由别的任务删除的（httpd）在删除前调用 stack_stats_release：
+ * 记下最终峰值并丢弃句柄，之后不再访问已释放的任务
+ */
+
+#ifndef STACK_STATS_H
+#define STACK_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define STACK_STATS_MAX_TASKS  12
+#define STACK_STATS_JSON_MAX   1024   // stack_stats_format_json 需要的缓冲区
+
+typedef struct {
+    const char *name;      // 登记时的名字（字符串常量）
+    uint32_t size;         // 栈大小（字节）
+    uint32_t peak;         // 开机以来的最高占用（字节）
+    bool alive;            // 任务仍在运行
+} stack_task_stats_t;
+
+/**
+ * @brief 登记当前任务（同一任务重复登记只更新大小）
+ * @param name 名字（字符串常量，不复制）
+ * @param stack_size 创建任务时给的栈大小（字节）
+ */
+void stack_stats_register_self(const char *name, uint32_t stack_size);
+
+/**
+ * @brief 当前任务即将自己删除：记下最终峰值
+ */
+void stack_stats_task_exit(void);
+
+/**
+ * @brief 名为 name 的任务即将被删除：记下最终峰值
+ */
+void stack_stats_release(const char *name);
+
+/**
+ * @brief 当前快照
+ * @return 写入的任务数
+ */
+int stack_stats_get(stack_task_stats_t *out, int max);
+
+/**
+ * @brief 打印全部任务的栈占用
+ */
+void stack_stats_log(void);
+
+/**
+ * @brief 导出为 JSON：{"tasks":[{"name":"..","size":..,"peak":..,"alive":true},...]}
+ * @return 写入长度（不含结尾 0），缓冲区不够时返回 0 且 buf 为空串
+ */
+size_t stack_stats_format_json(char *buf, size_t len);
+
+#endif // STACK_STATS_H
@@ -0,0 +1,463 @@
+/**
+ * @file text_bench.c
+ * @brief 文本流水线基准测试实现
+ *
+ * 与 display_bench 相同：外部请求只设置标志，由 LVGL 定时器回调在 LVGL 任务中同步执行
+ * （创建控件、lvgl_trigger_render）。阅读器的读取、排版接口被直接调用，
+ * 渲染用与阅读器相同的 text_view 控件，刷新模式设为全刷，不记录脏区也不触发面板刷新
+ */
+
+#include "text_bench.h"
+#include "display_bench.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "version.h"
+#include "ui/txt_reader.h"
+#include "ui/text_layout.h"
+#include "ui/epub_parser.h"
+#include "ui/epub_pages.h"
+#include "ui/font_manager.h"
+#include "ui/font_stream.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static const char *TAG = "TBENCH";
+
+#define TBENCH_POLL_MS      200
+#define TBENCH_TEXT_SIZE    8192     // 与阅读器的正文缓冲区相同
+#define TBENCH_PAD          10
+#define TBENCH_LINE_SPACE   2
+#define TBENCH_EPUB_SEEKS   5        // EPUB 随机跳章次数（每次载入整章）
+
+typedef struct {
+    const char *file;
+    bool epub;
+} tbench_corpus_t;
+
+static const tbench_corpus_t s_corpus[] = {
+    {"utf8.txt",     false},
+    {"gbk.txt",      false},
+    {"stored.epub",  true},
+    {"deflate.epub", true},
+};
+
+typedef struct {
+    uint32_t n;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint64_t value;
+} tbench_metric_t;
+
+// 一次运行的公共上下文
+typedef struct {
+    FILE *csv;
+    lv_obj_t *view;
+    const lv_font_t *font;
+    text_layout_t *layout;
+    text_page_layout_t page;
+    char *text;
+    uint32_t rng;
+} tbench_ctx_t;
+
+static lv_timer_t *s_timer = NULL;
+static volatile bool s_requested = false;
+static bool s_running = false;
+
+static uint32_t tbench_rand(tbench_ctx_t *ctx) {
+    ctx->rng = ctx->rng * 1664525u + 1013904223u;
+    return ctx->rng >> 8;
+}
+
+static void metric_add(tbench_metric_t *m, int64_t start_us, uint64_t value) {
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - start_us);
+    m->n++;
+    m->total_us += us;
+    m->value += value;
+    if (us > m->max_us) {
+        m->max_us = us;
+    }
+}
+
+static void tbench_write_row(tbench_ctx_t *ctx, const char *file, const char *metric,
+                             const tbench_metric_t *m) {
+    char line[160];
+    snprintf(line, sizeof(line), "%s,%s,%s,%u,%llu,%u,%u,%llu", VERSION_STRING, file, metric,
+             (unsigned)m->n, (unsigned long long)m->total_us,
+             (unsigned)(m->n > 0 ? m->total_us / m->n : 0), (unsigned)m->max_us,
+             (unsigned long long)m->value);
+    ESP_LOGI(TAG, "%s", line);
+    if (ctx->csv != NULL) {
+        fprintf(ctx->csv, "%s\n", line);
+    }
+}
+
+static FILE *tbench_open_csv(char *path, size_t path_len) {
+    if (mkdir(TEXT_BENCH_DIR, 0775) != 0 && errno != EEXIST) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d), results go to log only", TEXT_BENCH_DIR, errno);
+        return NULL;
+    }
+
+    time_t now;
+    time(&now);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    char stamp[24];
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &timeinfo);
+    snprintf(path, path_len, "%s/text_%s.csv", TEXT_BENCH_DIR, stamp);
+
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s, results go to log only", path);
+        return NULL;
+    }
+    fprintf(f, "version,file,metric,n,total_us,avg_us,max_us,value\n");
+    return f;
+}
+
+// 当前字体是流式字体时读取字形缓存计数
+static bool tbench_glyph_stats(const tbench_ctx_t *ctx, font_stream_stats_t *out) {
+    return font_stream_get_stats(font_manager_get_primary_font(ctx->font), out);
+}
+
+// 命中率为两次读数之差（只算本文件渲染期间）
+static void tbench_write_glyph_row(tbench_ctx_t *ctx, const char *file,
+                                   const font_stream_stats_t *before) {
+    font_stream_stats_t after;
+    if (before->lookups == UINT32_MAX || !tbench_glyph_stats(ctx, &after)) {
+        return;
+    }
+    const tbench_metric_t m = {
+        .n = after.lookups - before->lookups,
+        .value = after.hits - before->hits,
+    };
+    tbench_write_row(ctx, file, "glyph", &m);
+    ESP_LOGI(TAG, "%s: glyph cache %u/%u slots, %u/%u bitmap bytes", file,
+             (unsigned)after.glyph_count, (unsigned)after.glyph_capacity,
+             (unsigned)after.bitmap_bytes, (unsigned)after.bitmap_budget);
+}
+
+static void tbench_glyph_begin(const tbench_ctx_t *ctx, font_stream_stats_t *out) {
+    if (!tbench_glyph_stats(ctx, out)) {
+        out->lookups = UINT32_MAX;   // 不是流式字体
+    }
+}
+
+// 把排好的一页交给正文控件并渲染到 framebuffer
+static void tbench_render(tbench_ctx_t *ctx, const char *text, tbench_metric_t *m) {
+    const int64_t t = esp_timer_get_time();
+    text_view_set_page(ctx->view, text, &ctx->page);
+    lvgl_trigger_render(NULL);
+    metric_add(m, t, 0);
+}
+
+static void tbench_run_txt(tbench_ctx_t *ctx, const char *file, const char *path) {
+    tbench_metric_t detect = {0}, opened = {0}, fetch = {0}, layout = {0}, render = {0};
+    tbench_metric_t page = {0}, seek = {0};
+
+    int64_t t = esp_timer_get_time();
+    const txt_encoding_t encoding = txt_reader_detect_encoding(path);
+    metric_add(&detect, t, (uint64_t)encoding);
+
+    txt_reader_t *reader = calloc(1, sizeof(txt_reader_t));
+    if (reader == NULL || !txt_reader_init(reader)) {
+        ESP_LOGW(TAG, "%s: out of memory", file);
+        free(reader);
+        return;
+    }
+    t = esp_timer_get_time();
+    if (!txt_reader_open(reader, path, encoding)) {
+        ESP_LOGW(TAG, "%s: open failed", file);
+        txt_reader_cleanup(reader);
+        free(reader);
+        return;
+    }
+    const txt_position_t start_pos = txt_reader_get_position(reader);
+    metric_add(&opened, t, (uint64_t)start_pos.file_size);
+
+    font_stream_stats_t glyphs;
+    tbench_glyph_begin(ctx, &glyphs);
+
+    // 顺序分页：与阅读器 layout_page_at 相同的读取 -> 排版 -> 前进
+    long pos = reader->content_start;
+    for (int i = 0; i < TEXT_BENCH_PAGES; i++) {
+        const int64_t page_start = esp_timer_get_time();
+        bool at_eof = false;
+        t = page_start;
+        txt_reader_set_position(reader, pos, i + 1);
+        const int n = txt_reader_peek(reader, ctx->text, TBENCH_TEXT_SIZE, &at_eof);
+        metric_add(&fetch, t, n > 0 ? (uint64_t)n : 0);
+        if (n <= 0) {
+            break;
+        }
+        t = esp_timer_get_time();
+        const bool ok = text_layout_paginate(ctx->layout, ctx->text, (uint32_t)n, at_eof, &ctx->page);
+        metric_add(&layout, t, ok ? ctx->page.consumed : 0);
+        if (!ok) {
+            break;
+        }
+        tbench_render(ctx, ctx->text, &render);
+        metric_add(&page, page_start, 0);
+
+        const long next = txt_reader_offset_after(reader, pos, ctx->page.consumed);
+        if (next <= pos || (at_eof && ctx->page.consumed >= (uint32_t)n)) {
+            break;
+        }
+        pos = next;
+    }
+    tbench_write_glyph_row(ctx, file, &glyphs);
+
+    // 随机定位：跳到正文中任意位置并排出一页（阅读器恢复进度、拖动进度的路径）
+    const long span = start_pos.file_size - reader->content_start;
+    for (int i = 0; span > 0 && i < TEXT_BENCH_SEEKS; i++) {
+        const long target = reader->content_start + (long)(tbench_rand(ctx) % (uint32_t)span);
+        bool at_eof = false;
+        t = esp_timer_get_time();
+        txt_reader_set_position(reader, target, 1);
+        const int n = txt_reader_peek(reader, ctx->text, TBENCH_TEXT_SIZE, &at_eof);
+        if (n > 0) {
+            text_layout_paginate(ctx->layout, ctx->text, (uint32_t)n, at_eof, &ctx->page);
+        }
+        metric_add(&seek, t, 0);
+    }
+
+    txt_reader_cleanup(reader);
+    free(reader);
+
+    tbench_write_row(ctx, file, "detect", &detect);
+    tbench_write_row(ctx, file, "open", &opened);
+    tbench_write_row(ctx, file, "fetch", &fetch);
+    tbench_write_row(ctx, file, "layout", &layout);
+    tbench_write_row(ctx, file, "render", &render);
+    tbench_write_row(ctx, file, "page", &page);
+    tbench_write_row(ctx, file, "seek", &seek);
+}
+
+// 载入一章：文本块（解压 + XHTML 解析，或命中章节缓存）、展平、整章分页
+static bool tbench_load_chapter(tbench_ctx_t *ctx, const epub_reader_t *reader, int chapter,
+                                epub_pages_t *pages, tbench_metric_t *load,
+                                tbench_metric_t *paginate) {
+    epub_chapter_blocks_t blocks;
+    int64_t t = esp_timer_get_time();
+    if (!epub_parser_load_blocks(reader, chapter, &blocks)) {
+        return false;
+    }
+    const bool ok = epub_pages_init(pages, chapter, &blocks);
+    epub_parser_free_blocks(&blocks);
+    if (load != NULL) {
+        metric_add(load, t, 0);
+    }
+    if (!ok) {
+        return false;
+    }
+    t = esp_timer_get_time();
+    epub_pages_paginate(pages, ctx->layout, 0);
+    if (paginate != NULL) {
+        metric_add(paginate, t, (uint64_t)pages->page_count);
+    }
+    return true;
+}
+
+static void tbench_run_epub(tbench_ctx_t *ctx, const char *file, const char *path) {
+    tbench_metric_t opened = {0}, load = {0}, paginate = {0}, layout = {0}, render = {0};
+    tbench_metric_t chapter_switch = {0}, seek = {0};
+
+    epub_reader_t *reader = calloc(1, sizeof(epub_reader_t));
+    if (reader == NULL || !epub_parser_init(reader)) {
+        ESP_LOGW(TAG, "%s: out of memory", file);
+        free(reader);
+        return;
+    }
+    int64_t t = esp_timer_get_time();
+    if (!epub_parser_open(reader, path)) {
+        ESP_LOGW(TAG, "%s: open failed", file);
+        epub_parser_cleanup(reader);
+        free(reader);
+        return;
+    }
+    const int chapters = reader->metadata.total_chapters;
+    metric_add(&opened, t, (uint64_t)chapters);
+
+    font_stream_stats_t glyphs;
+    tbench_glyph_begin(ctx, &glyphs);
+
+    // 顺序切章，在其中渲染前 TEXT_BENCH_PAGES 页
+    int rendered = 0;
+    for (int c = 0; c < chapters && c < TEXT_BENCH_CHAPTERS; c++) {
+        epub_pages_t pages;
+        t = esp_timer_get_time();
+        if (!tbench_load_chapter(ctx, reader, c, &pages, &load, &paginate)) {
+            ESP_LOGW(TAG, "%s: chapter %d failed", file, c);
+            continue;
+        }
+        metric_add(&chapter_switch, t, 0);
+        for (int p = 0; p < pages.page_count && rendered < TEXT_BENCH_PAGES; p++, rendered++) {
+            const uint32_t start = pages.page_starts[p];
+            const uint32_t end = epub_pages_text_end(&pages, start);
+            t = esp_timer_get_time();
+            uint32_t len = end - start;
+            const char *text = epub_pages_text(&pages, start, &len);
+            if (text == NULL) {
+                continue;
+            }
+            text_layout_paginate(ctx->layout, text, len, len == end - start, &ctx->page);
+            metric_add(&layout, t, len);
+            tbench_render(ctx, text, &render);
+        }
+        epub_pages_free(&pages);
+    }
+    tbench_write_glyph_row(ctx, file, &glyphs);
+
+    // 随机跳章（目录跳转、恢复进度）：载入整章后定位到其中任意一页
+    for (int i = 0; chapters > 0 && i < TBENCH_EPUB_SEEKS; i++) {
+        const int c = (int)(tbench_rand(ctx) % (uint32_t)chapters);
+        epub_pages_t pages;
+        t = esp_timer_get_time();
+        if (tbench_load_chapter(ctx, reader, c, &pages, NULL, NULL)) {
+            if (pages.page_count > 0 && pages.text_len > 0) {
+                epub_pages_find(&pages, tbench_rand(ctx) % pages.text_len);
+            }
+            metric_add(&seek, t, 0);
+            epub_pages_free(&pages);
+        }
+    }
+
+    epub_parser_close(reader);
+    epub_parser_cleanup(reader);
+    free(reader);
+
+    tbench_write_row(ctx, file, "open", &opened);
+    tbench_write_row(ctx, file, "chapter_load", &load);
+    tbench_write_row(ctx, file, "chapter_paginate", &paginate);
+    tbench_write_row(ctx, file, "chapter_switch", &chapter_switch);
+    tbench_write_row(ctx, file, "layout", &layout);
+    tbench_write_row(ctx, file, "render", &render);
+    tbench_write_row(ctx, file, "seek", &seek);
+}
+
+static void tbench_run(void) {
+    lv_display_t *disp = lv_display_get_default();
+    if (disp == NULL) {
+        ESP_LOGW(TAG, "Display not initialized");
+        return;
+    }
+
+    tbench_ctx_t ctx = {.rng = TEXT_BENCH_SEED};
+    ctx.font = font_manager_get_font();
+    if (ctx.font == NULL) {
+        ctx.font = LV_FONT_DEFAULT;
+    }
+    ctx.layout = malloc(sizeof(text_layout_t));
+    ctx.text = malloc(TBENCH_TEXT_SIZE);
+    if (ctx.layout == NULL || ctx.text == NULL) {
+        ESP_LOGW(TAG, "Text benchmark: out of memory");
+        free(ctx.layout);
+        free(ctx.text);
+        return;
+    }
+
+    const int32_t hor = lv_display_get_horizontal_resolution(disp);
+    const int32_t ver = lv_display_get_vertical_resolution(disp);
+    const epd_refresh_mode_t saved_mode = lvgl_get_refresh_mode();
+    lv_obj_t *prev_screen = lv_screen_active();
+
+    char path[64] = {0};
+    ctx.csv = tbench_open_csv(path, sizeof(path));
+    ESP_LOGI(TAG, "Text benchmark started, output=%s", ctx.csv != NULL ? path : "log");
+    if (ctx.csv == NULL) {
+        ESP_LOGI(TAG, "version,file,metric,n,total_us,avg_us,max_us,value");
+    }
+
+    // 专用屏幕：与阅读页相同的正文控件，排版区域为整屏减去边距
+    lv_obj_t *screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(screen, 0, 0);
+    lv_obj_set_style_pad_all(screen, TBENCH_PAD, 0);
+    lv_obj_remove_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    ctx.view = text_view_create(screen);
+    lv_obj_set_size(ctx.view, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_text_font(ctx.view, ctx.font, 0);
+    lv_obj_set_style_text_color(ctx.view, lv_color_black(), 0);
+    lv_obj_set_style_text_line_space(ctx.view, TBENCH_LINE_SPACE, 0);
+    text_layout_init(ctx.layout, ctx.font, hor - 2 * TBENCH_PAD, ver - 2 * TBENCH_PAD,
+                     TBENCH_LINE_SPACE);
+
+    // 全刷模式不记录脏区，渲染结果只留在 framebuffer 中，结束后整屏全刷覆盖
+    lv_screen_load(screen);
+    lvgl_reset_refresh_state();
+    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
+
+    for (size_t i = 0; i < sizeof(s_corpus) / sizeof(s_corpus[0]); i++) {
+        char file_path[96];
+        snprintf(file_path, sizeof(file_path), "%s/%s", TEXT_BENCH_DIR, s_corpus[i].file);
+        struct stat st;
+        if (stat(file_path, &st) != 0) {
+            ESP_LOGW(TAG, "%s not found, skipped", file_path);
+            continue;
+        }
+        ESP_LOGI(TAG, "Corpus %s (%ld bytes)", s_corpus[i].file, (long)st.st_size);
+        if (s_corpus[i].epub) {
+            tbench_run_epub(&ctx, s_corpus[i].file, file_path);
+        } else {
+            tbench_run_txt(&ctx, s_corpus[i].file, file_path);
+        }
+    }
+
+    if (ctx.csv != NULL) {
+        fclose(ctx.csv);
+        ESP_LOGI(TAG, "Text benchmark finished, results saved to %s", path);
+    } else {
+        ESP_LOGI(TAG, "Text benchmark finished");
+    }
+    free(ctx.layout);
+    free(ctx.text);
+
+    // 恢复原屏幕与刷新模式，整屏全刷清除测试页面
+    lvgl_set_refresh_mode(saved_mode);
+    if (prev_screen != NULL) {
+        lv_screen_load(prev_screen);
+    }
+    lv_obj_delete(screen);
+    lvgl_reset_refresh_state();
+    lvgl_clear_framebuffer();
+    lv_obj_invalidate(lv_screen_active());
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh_full();
+    power_manager_notify_activity();
+}
+
+static void tbench_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (!s_requested || s_running) {
+        return;
+    }
+    s_running = true;
+    tbench_run();
+    s_running = false;
+    s_requested = false;
+}
+
+void text_bench_init(void) {
+    if (s_timer == NULL) {
+        s_timer = lv_timer_create(tbench_timer_cb, TBENCH_POLL_MS, NULL);
+    }
+}
+
+bool text_bench_request(void) {
+    if (s_timer == NULL || s_requested || display_bench_is_running()) {
+        return false;
+    }
+    s_requested = true;
+    lvgl_timer_task_wake();
+    ESP_LOGI(TAG, "Text benchmark requested");
+    return true;
+}
+
+bool text_bench_is_running(void) { return s_requested || s_running; }
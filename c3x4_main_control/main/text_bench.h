@@ -0,0 +1,57 @@
+/**
+ * @file text_bench.h
+ * @brief 文本流水线基准测试：固定语料的打开、编码检测、分页、随机定位与章节切换计时
+ *
+ * 语料放在 /sdcard/bench/ 下，缺少的文件跳过：
+ *   utf8.txt      大 UTF-8 TXT
+ *   gbk.txt       GBK/GB18030 TXT
+ *   stored.epub   不压缩（stored）的 EPUB
+ *   deflate.epub  deflate 压缩的 EPUB
+ * TXT 依次测量编码检测、打开、前 TEXT_BENCH_PAGES 页的读取/排版/渲染、
+ * TEXT_BENCH_SEEKS 次随机定位（定位后排出一页）；EPUB 测量打开（解析 OPF 与目录）、
+ * 前 TEXT_BENCH_CHAPTERS 章的章节切换（载入文本块 + 展平 + 整章分页），
+ * 在其中渲染前 TEXT_BENCH_PAGES 页，再随机跳转若干章。
+ * 渲染只写 framebuffer 不刷新面板；每个文件渲染期间的字形缓存命中率取自
+ * font_stream_get_stats（当前字体不是流式字体时不输出）。随机位置使用固定种子，
+ * 同一语料每次测量的位置相同。EPUB 章节在第二次运行起会命中 SD 卡上的章节缓存，
+ * 冷启动数据以清空 /sdcard/.x4cache 后的第一次为准
+ *
+ * 结果写入 /sdcard/bench/text_<时间>.csv，每行一个指标：
+ *   version,file,metric,n,total_us,avg_us,max_us,value
+ * value 随指标而定：detect 为编码，open 为文件大小（TXT）或章节数（EPUB），
+ * fetch/layout 为字节数，chapter_paginate 为页数，glyph 行的 n 为查询次数、value 为命中次数
+ *
+ * 测试期间临时切换到专用屏幕，结束后恢复原屏幕并全刷
+ */
+
+#ifndef TEXT_BENCH_H
+#define TEXT_BENCH_H
+
+#include <stdbool.h>
+
+#define TEXT_BENCH_DIR       "/sdcard/bench"
+#define TEXT_BENCH_PAGES     100
+#define TEXT_BENCH_SEEKS     20
+#define TEXT_BENCH_CHAPTERS  8
+#define TEXT_BENCH_SEED      0x58344245u   // 随机定位的固定种子
+
+/**
+ * @brief 注册基准测试调度定时器（在 LVGL 初始化后调用）
+ */
+void text_bench_init(void);
+
+/**
+ * @brief 请求运行一次文本基准测试（任意任务中调用，不阻塞）
+ *
+ * 测试在 LVGL 任务中执行，期间不处理按键
+ *
+ * @return false 表示未初始化、已有测试在进行或显示基准测试正在运行
+ */
+bool text_bench_request(void);
+
+/**
+ * @brief 检查文本基准测试是否正在运行或排队
+ */
+bool text_bench_is_running(void);
+
+#endif // TEXT_BENCH_H
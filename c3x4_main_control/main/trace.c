@@ -0,0 +1,146 @@
+/**
+ * @file trace.c
+ * @brief 无锁二进制事件环形缓冲区
+ *
+ * 写入方通过原子递增的写序号独占一个槽位，先把 seq 标记为无效再写字段，
+ * 最后写入有效 seq；读取方在复制前后各检查一次 seq，被覆盖或尚未写完的
+ * 记录直接丢弃。写入不加锁、不关中断，可在任务和 ISR 中调用。
+ */
+
+#include "trace.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "TRACE";
+
+#define TRACE_SEQ_INVALID(idx) ((uint16_t)(((idx) & 0xFFFF) ^ 0x8000))
+
+static trace_record_t s_ring[TRACE_RING_SIZE];
+static uint32_t s_write_idx = 0;
+
+static const char *const s_event_names[TRACE_EV_COUNT] = {
+    [TRACE_EV_NONE] = "none",
+    [TRACE_EV_FLUSH] = "flush",
+    [TRACE_EV_DIRTY_ADD] = "dirty_add",
+    [TRACE_EV_REFRESH_REQ] = "refresh_req",
+    [TRACE_EV_REFRESH_START] = "refresh_start",
+    [TRACE_EV_REFRESH_DONE] = "refresh_done",
+    [TRACE_EV_REFRESH_SKIP] = "refresh_skip",
+    [TRACE_EV_EPD_WINDOW] = "epd_window",
+    [TRACE_EV_EPD_UPDATE] = "epd_update",
+    [TRACE_EV_EPD_BUSY_DONE] = "epd_busy_done",
+    [TRACE_EV_GHOST_CLEANUP] = "ghost_cleanup",
+    [TRACE_EV_KEY] = "key",
+    [TRACE_EV_PANEL_SLEEP] = "panel_sleep",
+    [TRACE_EV_PANEL_WAKE] = "panel_wake",
+    [TRACE_EV_LIGHT_SLEEP] = "light_sleep",
+};
+
+#if TRACE_ENABLE
+void IRAM_ATTR trace_event(trace_event_t event, uint32_t arg0, uint32_t arg1)
+{
+    const uint32_t idx = __atomic_fetch_add(&s_write_idx, 1, __ATOMIC_RELAXED);
+    trace_record_t *r = &s_ring[idx & (TRACE_RING_SIZE - 1)];
+
+    __atomic_store_n(&r->seq, TRACE_SEQ_INVALID(idx), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    r->ts_us = (uint32_t)esp_timer_get_time();
+    r->event = (uint16_t)event;
+    r->arg0 = arg0;
+    r->arg1 = arg1;
+    __atomic_store_n(&r->seq, (uint16_t)(idx & 0xFFFF), __ATOMIC_RELEASE);
+}
+#endif
+
+// 读取写序号为 idx 的记录；已被覆盖或正在写入时返回 false
+static bool trace_read(uint32_t idx, trace_record_t *out)
+{
+    const trace_record_t *r = &s_ring[idx & (TRACE_RING_SIZE - 1)];
+    const uint16_t expect = (uint16_t)(idx & 0xFFFF);
+
+    if (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) != expect) {
+        return false;
+    }
+    memcpy(out, r, sizeof(*out));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&r->seq, __ATOMIC_RELAXED) == expect && out->seq == expect;
+}
+
+size_t trace_snapshot(trace_record_t *out, size_t max)
+{
+    if (out == NULL || max == 0) {
+        return 0;
+    }
+
+    const uint32_t end = __atomic_load_n(&s_write_idx, __ATOMIC_ACQUIRE);
+    uint32_t avail = end < TRACE_RING_SIZE ? end : TRACE_RING_SIZE;
+    if (avail > max) {
+        avail = (uint32_t)max;
+    }
+
+    size_t n = 0;
+    for (uint32_t idx = end - avail; idx != end; idx++) {
+        if (trace_read(idx, &out[n])) {
+            n++;
+        }
+    }
+    return n;
+}
+
+const char *trace_event_name(uint16_t event)
+{
+    if (event < TRACE_EV_COUNT && s_event_names[event] != NULL) {
+        return s_event_names[event];
+    }
+    return "?";
+}
+
+void trace_dump_log(void)
+{
+    const uint32_t end = __atomic_load_n(&s_write_idx, __ATOMIC_ACQUIRE);
+    const uint32_t avail = end < TRACE_RING_SIZE ? end : TRACE_RING_SIZE;
+
+    ESP_LOGI(TAG, "Trace dump: %u record(s), %u total", (unsigned)avail, (unsigned)end);
+    for (uint32_t idx = end - avail; idx != end; idx++) {
+        trace_record_t r;
+        if (!trace_read(idx, &r)) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%10u us  %-14s 0x%08x 0x%08x", (unsigned)r.ts_us,
+                 trace_event_name(r.event), (unsigned)r.arg0, (unsigned)r.arg1);
+    }
+}
+
+size_t trace_format_json(char *buf, size_t len)
+{
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    trace_record_t *records = malloc(TRACE_RING_SIZE * sizeof(trace_record_t));
+    const size_t count = records != NULL ? trace_snapshot(records, TRACE_RING_SIZE) : 0;
+
+    const unsigned total = (unsigned)__atomic_load_n(&s_write_idx, __ATOMIC_ACQUIRE);
+    int n = snprintf(buf, len, "{\"total\":%u,\"records\":[", total);
+    size_t pos = n > 0 && (size_t)n < len ? (size_t)n : 0;
+    for (size_t i = 0; pos > 0 && i < count; i++) {
+        const trace_record_t *r = &records[i];
+        n = snprintf(buf + pos, len - pos, "%s[%u,\"%s\",%u,%u]", i ? "," : "",
+                     (unsigned)r->ts_us, trace_event_name(r->event), (unsigned)r->arg0,
+                     (unsigned)r->arg1);
+        // 结尾的 "]}" 也要放得下，否则停在上一条
+        if (n < 0 || pos + (size_t)n + 2 >= len) {
+            break;
+        }
+        pos += (size_t)n;
+    }
+    free(records);
+    if (pos == 0 || pos + 2 >= len) {
+        pos = (size_t)snprintf(buf, len, "{}");
+        return pos < len ? pos : len - 1;
+    }
+    memcpy(buf + pos, "]}", 3);
+    return pos + 2;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file trace.h
+ * @brief 热路径诊断：按模块的编译期日志级别 + 无锁二进制事件环形缓冲区
+ *
+ * flush/刷新路径原先每次调用都有多条 ESP_LOGI，115200 波特率下格式化和
+ * UART 输出会明显拖慢翻页。这里提供两种替代：
+ *   - TRACE_LOGI/TRACE_LOGD：级别低于模块的编译期级别时整条语句被编译掉
+ *   - TRACE_EVENT：写入一条 16 字节的二进制记录（时间戳、事件 ID、两个参数），
+ *     无锁、可在任务和 ISR 中调用，需要时再通过串口或 BLE 导出
+ *
+ * 模块级别可在编译选项中覆盖，例如 -DTRACE_LEVEL_EPD=ESP_LOG_INFO
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+// 关闭后 TRACE_EVENT 不产生任何代码
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE 1
+#endif
+
+// 环形缓冲区记录数（必须是 2 的幂）
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE 128
+#endif
+
+// 各模块编译期日志级别（esp_log_level_t）
+#ifndef TRACE_LEVEL_LVGL
+#define TRACE_LEVEL_LVGL ESP_LOG_WARN
+#endif
+#ifndef TRACE_LEVEL_EPD
+#define TRACE_LEVEL_EPD ESP_LOG_WARN
+#endif
+
+#define TRACE_LOGI(module, tag, fmt, ...)                                      \
+    do {                                                                       \
+        if (TRACE_LEVEL_##module >= ESP_LOG_INFO) {                            \
+            ESP_LOGI(tag, fmt, ##__VA_ARGS__);                                 \
+        }                                                                      \
+    } while (0)
+
+#define TRACE_LOGD(module, tag, fmt, ...)                                      \
+    do {                                                                       \
+        if (TRACE_LEVEL_##module >= ESP_LOG_DEBUG) {                           \
+            ESP_LOGD(tag, fmt, ##__VA_ARGS__);                                 \
+        }                                                                      \
+    } while (0)
+
+// 事件 ID（新增事件请同时更新 trace.c 中的名称表）
+typedef enum {
+    TRACE_EV_NONE = 0,
+    TRACE_EV_FLUSH,            // arg0 = x1 | y1 << 16, arg1 = x2 | y2 << 16
+    TRACE_EV_DIRTY_ADD,        // arg0 = 物理 x1 | y1 << 16, arg1 = x2 | y2 << 16
+    TRACE_EV_REFRESH_REQ,      // arg0 = 请求模式, arg1 = 合并后模式
+    TRACE_EV_REFRESH_START,    // arg0 = 模式, arg1 = 脏矩形数
+    TRACE_EV_REFRESH_DONE,     // arg0 = 模式, arg1 = 耗时 us
+    TRACE_EV_REFRESH_SKIP,     // arg0 = 模式, arg1 = 原因（0 无脏区，1 帧未变化，2 被新帧取代）
+    TRACE_EV_EPD_WINDOW,       // arg0 = x | y << 16, arg1 = w | h << 16
+    TRACE_EV_EPD_UPDATE,       // arg0 = 0x22 控制字, arg1 = 窗口数
+    TRACE_EV_EPD_BUSY_DONE,    // arg0 = 等待耗时 us
+    TRACE_EV_GHOST_CLEANUP,    // arg0 = 债务, arg1 = 局刷次数
+    TRACE_EV_KEY,              // arg0 = 按键, arg1 = LVGL 键值
+    TRACE_EV_PANEL_SLEEP,      // arg0 = 空闲超时 ms
+    TRACE_EV_PANEL_WAKE,       // arg0 = 预热耗时 us
+    TRACE_EV_LIGHT_SLEEP,      // arg0 = 睡眠时长 us, arg1 = 唤醒原因（esp_sleep_wakeup_cause_t）
+    TRACE_EV_COUNT
+} trace_event_t;
+
+// 二进制记录（16 字节）
+typedef struct {
+    uint32_t ts_us;    // esp_timer 时间戳低 32 位
+    uint16_t event;    // trace_event_t
+    uint16_t seq;      // 写入序号低 16 位，用于检测被覆盖或未写完的记录
+    uint32_t arg0;
+    uint32_t arg1;
+} trace_record_t;
+
+#define TRACE_PACK(lo, hi) (((uint32_t)(uint16_t)(lo)) | ((uint32_t)(uint16_t)(hi) << 16))
+
+#if TRACE_ENABLE
+void trace_event(trace_event_t event, uint32_t arg0, uint32_t arg1);
+#define TRACE_EVENT(event, arg0, arg1) trace_event((event), (uint32_t)(arg0), (uint32_t)(arg1))
+#else
+#define TRACE_EVENT(event, arg0, arg1) do { } while (0)
+#endif
+
+/**
+ * @brief 按时间顺序复制最近的记录（供 BLE 等二进制导出）
+ * @param out 输出数组
+ * @param max 最多复制条数
+ * @return 实际复制条数
+ */
+size_t trace_snapshot(trace_record_t *out, size_t max);
+
+/**
+ * @brief 通过日志输出（串口）导出最近的记录（Wi-Fi 传输模式 /cmd?cmd=trace_dump 触发）
+ */
+void trace_dump_log(void);
+
+#define TRACE_JSON_MAX (64 + TRACE_RING_SIZE * 56)   // trace_format_json 完整输出所需的缓冲区
+
+/**
+ * @brief 以 JSON 导出最近的记录（Wi-Fi 传输模式 /cmd?cmd=trace）
+ *
+ * {"total":写入总数,"records":[[ts_us,"事件名",arg0,arg1],...]}，按时间顺序
+ *
+ * @return 写入的字节数（不含结尾 NUL）；缓冲区不够时截断为完整的前若干条
+ */
+size_t trace_format_json(char *buf, size_t len);
+
+/**
+ * @brief 获取事件名称
+ */
+const char *trace_event_name(uint16_t event);
+
+#endif // TRACE_H
@@ -0,0 +1,370 @@
+/**
+ * @file turn_stats.c
+ * @brief 翻页延时遥测：分阶段时间戳、按刷新模式的直方图与 NVS 持久化
+ *
+ * 一次翻页的状态在 LVGL 任务（按键、读取、排版、渲染）、刷新任务（取到请求、上传）
+ * 和 BUSY 中断（波形结束）之间传递，全部在临界区内读写；结算在中断中也可能发生，
+ * 所以结算路径与用到的数据都在 IRAM/DRAM 中
+ */
+
+#include "turn_stats.h"
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "nvs.h"
+#include "lvgl.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "TURN";
+
+#define TURN_STATS_VERSION   1
+#define TURN_SAVE_CHECK_MS   2000
+
+DRAM_ATTR const uint16_t turn_stats_bucket_ms[TURN_STATS_BUCKETS] = {
+    10, 20, 50, 100, 200, 300, 400, 500, 700, 1000, 2000, UINT16_MAX,
+};
+
+typedef enum {
+    TURN_IDLE = 0,
+    TURN_ACTIVE,       // 阅读器正在读取、排版、渲染
+    TURN_SUBMITTED,    // 已渲染，等待刷新任务
+    TURN_UPLOADING,    // 刷新任务在上传
+    TURN_WAVE,         // 波形运行中，等待 BUSY 中断
+} turn_phase_t;
+
+// NVS 记录：分桶不同的旧记录不载入
+typedef struct {
+    uint32_t version;
+    uint16_t buckets[TURN_STATS_BUCKETS];
+    turn_stats_t stats;
+} turn_stats_blob_t;
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static turn_stats_t s_stats;
+static turn_phase_t s_phase = TURN_IDLE;
+static turn_mode_t s_mode = TURN_MODE_PARTIAL;
+// [0] 翻页开始（按键时间），[i + 1] 阶段 i 结束；未标记的为 0，该阶段记 0 ms
+static int64_t s_marks[TURN_STAGE_COUNT + 1];
+static int64_t s_last_idle_us;    // 最近一次 BUSY 中断的时间
+static uint32_t s_key_ms;
+static bool s_key_valid;
+static uint32_t s_unsaved;
+static int64_t s_last_commit_us;
+static lv_timer_t *s_save_timer;
+static turn_stats_blob_t s_blob;  // 载入/保存用（约 1.8 KB，不放在栈上）
+
+static const char *const s_series_names[TURN_SERIES_COUNT] = {
+    "key", "fetch", "layout", "render", "flush", "upload", "busy", "total",
+};
+
+static const char *const s_mode_names[TURN_MODE_COUNT] = {
+    "partial", "fast", "full", "gray",
+};
+
+static void IRAM_ATTR hist_add(turn_hist_t *hist, uint32_t ms) {
+    int b = 0;
+    while (b < TURN_STATS_BUCKETS - 1 && ms > turn_stats_bucket_ms[b]) {
+        b++;
+    }
+    hist->count[b]++;
+    hist->sum_ms += ms;
+    if (ms > hist->max_ms) {
+        hist->max_ms = ms;
+    }
+}
+
+// 在临界区内调用：把当前翻页记入 s_mode 的直方图（差值先截成 32 位再除，不调用 64 位除法）
+static void IRAM_ATTR commit_locked(int64_t idle_us) {
+    s_marks[TURN_STAGE_COUNT] = idle_us;
+    turn_mode_stats_t *m = &s_stats.modes[s_mode];
+    int64_t prev = s_marks[0];
+    for (int i = 0; i < TURN_STAGE_COUNT; i++) {
+        const int64_t t = s_marks[i + 1] > prev ? s_marks[i + 1] : prev;
+        hist_add(&m->series[i], (uint32_t)(t - prev) / 1000);
+        prev = t;
+    }
+    const uint32_t total_ms = (uint32_t)(prev - s_marks[0]) / 1000;
+    hist_add(&m->series[TURN_SERIES_TOTAL], total_ms);
+    m->samples++;
+    m->last_ms = total_ms;
+    s_unsaved++;
+    s_last_commit_us = idle_us;
+    s_phase = TURN_IDLE;
+}
+
+void turn_stats_key(uint32_t press_ms) {
+    portENTER_CRITICAL(&s_mux);
+    s_key_ms = press_ms;
+    s_key_valid = true;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void turn_stats_begin(void) {
+    const int64_t now = esp_timer_get_time();
+    const uint32_t now_ms = (uint32_t)(now / 1000);
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase != TURN_IDLE) {
+        s_stats.dropped++;
+    }
+    memset(s_marks, 0, sizeof(s_marks));
+    // 不是按键触发（BLE 遥控翻页等）时从这里算起，key 阶段为 0
+    s_marks[0] = now;
+    if (s_key_valid && now_ms - s_key_ms <= TURN_STATS_KEY_WINDOW_MS) {
+        s_marks[0] = (int64_t)s_key_ms * 1000;
+    }
+    s_key_valid = false;
+    s_phase = TURN_ACTIVE;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void turn_stats_cancel(void) {
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase == TURN_ACTIVE) {
+        s_phase = TURN_IDLE;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void turn_stats_mark(turn_stage_t stage) {
+    if (stage < TURN_STAGE_FETCH || stage > TURN_STAGE_RENDER) {
+        return;
+    }
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase == TURN_ACTIVE) {
+        s_marks[stage + 1] = now;
+        if (stage == TURN_STAGE_RENDER) {
+            s_phase = TURN_SUBMITTED;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void turn_stats_refresh_begin(void) {
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase == TURN_SUBMITTED) {
+        s_marks[TURN_STAGE_FLUSH + 1] = now;
+        s_phase = TURN_UPLOADING;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void turn_stats_refresh_end(turn_mode_t mode, int64_t wave_us, bool panel_busy) {
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (s_phase == TURN_UPLOADING) {
+        if (wave_us < s_marks[TURN_STAGE_FLUSH + 1]) {
+            // 帧未变化或被跳过，面板上没有新页面
+            s_stats.dropped++;
+            s_phase = TURN_IDLE;
+        } else {
+            s_mode = mode;
+            s_marks[TURN_STAGE_UPLOAD + 1] = wave_us;
+            // 同步刷新返回时波形已结束；异步刷新的 BUSY 中断可能已在判断 panel_busy 之后到达
+            if (s_last_idle_us >= wave_us) {
+                commit_locked(s_last_idle_us);
+            } else if (!panel_busy) {
+                commit_locked(now);
+            } else {
+                s_phase = TURN_WAVE;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void IRAM_ATTR turn_stats_panel_idle_isr(void) {
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&s_mux);
+    s_last_idle_us = now;
+    if (s_phase == TURN_WAVE) {
+        commit_locked(now);
+    }
+    portEXIT_CRITICAL_ISR(&s_mux);
+}
+
+void turn_stats_get(turn_stats_t *out) {
+    portENTER_CRITICAL(&s_mux);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+uint32_t turn_stats_percentile(const turn_hist_t *hist, uint32_t permille) {
+    uint32_t total = 0;
+    for (int b = 0; b < TURN_STATS_BUCKETS; b++) {
+        total += hist->count[b];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    const uint64_t target = ((uint64_t)total * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for (int b = 0; b < TURN_STATS_BUCKETS - 1; b++) {
+        seen += hist->count[b];
+        if (seen >= target) {
+            // 桶上限可能大于实际最大值
+            return turn_stats_bucket_ms[b] < hist->max_ms ? turn_stats_bucket_ms[b] : hist->max_ms;
+        }
+    }
+    return hist->max_ms;
+}
+
+void turn_stats_save(void) {
+    s_blob.version = TURN_STATS_VERSION;
+    memcpy(s_blob.buckets, turn_stats_bucket_ms, sizeof(s_blob.buckets));
+    portENTER_CRITICAL(&s_mux);
+    const uint32_t unsaved = s_unsaved;
+    s_blob.stats = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+    if (unsaved == 0) {
+        return;
+    }
+
+    nvs_handle_t nvs;
+    if (nvs_open(TURN_STATS_NVS_NS, NVS_READWRITE, &nvs) != ESP_OK) {
+        ESP_LOGW(TAG, "NVS open failed, stats not saved");
+        return;
+    }
+    const esp_err_t err = nvs_set_blob(nvs, TURN_STATS_NVS_KEY, &s_blob, sizeof(s_blob));
+    if (err == ESP_OK) {
+        nvs_commit(nvs);
+        portENTER_CRITICAL(&s_mux);
+        s_unsaved -= unsaved;
+        portEXIT_CRITICAL(&s_mux);
+        ESP_LOGI(TAG, "Saved page-turn stats (%u new samples)", (unsigned)unsaved);
+    } else {
+        ESP_LOGW(TAG, "Saving page-turn stats failed: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs);
+}
+
+void turn_stats_reset(void) {
+    portENTER_CRITICAL(&s_mux);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_unsaved = 0;
+    portEXIT_CRITICAL(&s_mux);
+
+    nvs_handle_t nvs;
+    if (nvs_open(TURN_STATS_NVS_NS, NVS_READWRITE, &nvs) == ESP_OK) {
+        nvs_erase_key(nvs, TURN_STATS_NVS_KEY);
+        nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+    ESP_LOGI(TAG, "Page-turn stats cleared");
+}
+
+// 攒够样本且最近没有翻页时写 NVS：写入期间 flash cache 关闭，不能落在翻页过程中
+static void save_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    portENTER_CRITICAL(&s_mux);
+    const bool due = s_unsaved >= TURN_STATS_SAVE_EVERY && s_phase == TURN_IDLE &&
+                     esp_timer_get_time() - s_last_commit_us >= (int64_t)TURN_STATS_SAVE_IDLE_MS * 1000;
+    portEXIT_CRITICAL(&s_mux);
+    if (due) {
+        turn_stats_save();
+    }
+}
+
+void turn_stats_init(void) {
+    if (s_save_timer != NULL) {
+        return;
+    }
+
+    size_t len = sizeof(s_blob);
+    nvs_handle_t nvs;
+    if (nvs_open(TURN_STATS_NVS_NS, NVS_READONLY, &nvs) == ESP_OK) {
+        const bool found = nvs_get_blob(nvs, TURN_STATS_NVS_KEY, &s_blob, &len) == ESP_OK &&
+                           len == sizeof(s_blob) && s_blob.version == TURN_STATS_VERSION &&
+                           memcmp(s_blob.buckets, turn_stats_bucket_ms, sizeof(s_blob.buckets)) == 0;
+        nvs_close(nvs);
+        if (found) {
+            portENTER_CRITICAL(&s_mux);
+            s_stats = s_blob.stats;
+            portEXIT_CRITICAL(&s_mux);
+        }
+    }
+
+    uint32_t samples = 0;
+    for (int i = 0; i < TURN_MODE_COUNT; i++) {
+        samples += s_stats.modes[i].samples;
+    }
+    ESP_LOGI(TAG, "Page-turn stats: %u samples from NVS", (unsigned)samples);
+    s_save_timer = lv_timer_create(save_timer_cb, TURN_SAVE_CHECK_MS, NULL);
+}
+
+const char *turn_stats_series_name(int series) {
+    return series >= 0 && series < TURN_SERIES_COUNT ? s_series_names[series] : "?";
+}
+
+const char *turn_stats_mode_name(turn_mode_t mode) {
+    return (unsigned)mode < TURN_MODE_COUNT ? s_mode_names[mode] : "?";
+}
+
+// 追加格式化文本，返回 false 表示缓冲区已满
+static bool append(char *buf, size_t len, size_t *pos, const char *fmt, ...) __attribute__((format(printf, 4, 5)));
+static bool append(char *buf, size_t len, size_t *pos, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vsnprintf(buf + *pos, len - *pos, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= len - *pos) {
+        return false;
+    }
+    *pos += (size_t)n;
+    return true;
+}
+
+static bool append_series(char *buf, size_t len, size_t *pos, const turn_mode_stats_t *m, int s) {
+    const turn_hist_t *h = &m->series[s];
+    bool ok = append(buf, len, pos, "%s\"%s\":{\"avg\":%u,\"p50\":%u,\"p90\":%u,\"max\":%u",
+                     s ? "," : "", s_series_names[s],
+                     (unsigned)(m->samples ? h->sum_ms / m->samples : 0),
+                     (unsigned)turn_stats_percentile(h, 500), (unsigned)turn_stats_percentile(h, 900),
+                     (unsigned)h->max_ms);
+    // 完整直方图只导出总延时
+    if (ok && s == TURN_SERIES_TOTAL) {
+        ok = append(buf, len, pos, ",\"hist\":[");
+        for (int b = 0; ok && b < TURN_STATS_BUCKETS; b++) {
+            ok = append(buf, len, pos, "%s%u", b ? "," : "", (unsigned)h->count[b]);
+        }
+        ok = ok && append(buf, len, pos, "]");
+    }
+    return ok && append(buf, len, pos, "}");
+}
+
+size_t turn_stats_format_json(char *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return 0;
+    }
+    turn_stats_t st;
+    turn_stats_get(&st);
+
+    size_t pos = 0;
+    bool ok = append(buf, len, &pos, "{\"buckets_ms\":[");
+    for (int b = 0; ok && b < TURN_STATS_BUCKETS - 1; b++) {
+        ok = append(buf, len, &pos, "%s%u", b ? "," : "", (unsigned)turn_stats_bucket_ms[b]);
+    }
+    ok = ok && append(buf, len, &pos, "],\"dropped\":%u,\"modes\":{", (unsigned)st.dropped);
+    for (int i = 0; ok && i < TURN_MODE_COUNT; i++) {
+        const turn_mode_stats_t *m = &st.modes[i];
+        ok = append(buf, len, &pos, "%s\"%s\":{\"n\":%u,\"last_ms\":%u,", i ? "," : "",
+                    s_mode_names[i], (unsigned)m->samples, (unsigned)m->last_ms);
+        for (int s = 0; ok && s < TURN_SERIES_COUNT; s++) {
+            ok = append_series(buf, len, &pos, m, s);
+        }
+        ok = ok && append(buf, len, &pos, "}");
+    }
+    ok = ok && append(buf, len, &pos, "}}");
+    if (!ok) {
+        pos = (size_t)snprintf(buf, len, "{}");
+        if (pos >= len) {
+            pos = len - 1;
+        }
+    }
+    return pos;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file turn_stats.h
+ * @brief 翻页延时遥测：按键到新页面完全显示（BUSY 释放）的分阶段计时与直方图
+ *
+ * 一次翻页依次经过：
+ *   key     按键确认 -> 阅读器开始翻页（按键队列、LVGL 任务调度）
+ *   fetch   读取正文（SD 卡 / 文件池，EPUB 为章节加载与插图解码）
+ *   layout  排版分页
+ *   render  LVGL 渲染到 framebuffer（页面缓存命中时只写回位图）
+ *   flush   提交刷新 -> 刷新任务取到请求（等待上一帧上传或面板空闲）
+ *   upload  帧差分与 SPI 上传，到发出 0x20 启动波形
+ *   busy    波形运行，到 BUSY 释放
+ * 每个阶段和总延时各有一个固定分桶的直方图，按实际执行的刷新模式分开统计
+ * （局刷被升级为全刷时记入全刷）。没有启动波形的翻页（帧未变化）不计入；
+ * 上一页还在流水线中又翻页时，上一页的样本丢弃。
+ *
+ * 统计保存在 NVS 中，跨重启累计：新样本满 TURN_STATS_SAVE_EVERY 且空闲
+ * TURN_STATS_SAVE_IDLE_MS 后写一次，关机前写一次。设置页的调试页面显示各模式的
+ * 分位数与分段耗时，Wi-Fi 传输模式下 /cmd?cmd=turn_stats 导出 JSON 便于比较设备，
+ * /cmd?cmd=turn_stats_reset 清空
+ */
+
+#ifndef TURN_STATS_H
+#define TURN_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TURN_STATS_NVS_NS        "turnstat"
+#define TURN_STATS_NVS_KEY       "hist"
+#define TURN_STATS_BUCKETS       12
+#define TURN_STATS_KEY_WINDOW_MS 1000      // 按键早于翻页开始超过此值时不算作按键触发
+#define TURN_STATS_SAVE_EVERY    32        // 累计这么多新样本才写 NVS（减少 flash 磨损）
+#define TURN_STATS_SAVE_IDLE_MS  10000     // 最后一次翻页后等待这么久再写，避免写入拖慢翻页
+#define TURN_STATS_JSON_MAX      3072      // turn_stats_format_json 完整输出所需的缓冲区
+
+typedef enum {
+    TURN_STAGE_KEY = 0,
+    TURN_STAGE_FETCH,
+    TURN_STAGE_LAYOUT,
+    TURN_STAGE_RENDER,
+    TURN_STAGE_FLUSH,
+    TURN_STAGE_UPLOAD,
+    TURN_STAGE_BUSY,
+    TURN_STAGE_COUNT
+} turn_stage_t;
+
+// 直方图序号：各阶段之后是总延时
+#define TURN_SERIES_TOTAL  TURN_STAGE_COUNT
+#define TURN_SERIES_COUNT  (TURN_STAGE_COUNT + 1)
+
+typedef enum {
+    TURN_MODE_PARTIAL = 0,
+    TURN_MODE_FAST,
+    TURN_MODE_FULL,
+    TURN_MODE_GRAY,        // 灰阶波形（不区分局刷/全刷）
+    TURN_MODE_COUNT
+} turn_mode_t;
+
+typedef struct {
+    uint32_t count[TURN_STATS_BUCKETS];
+    uint32_t sum_ms;
+    uint32_t max_ms;
+} turn_hist_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t last_ms;      // 最近一次的总延时
+    turn_hist_t series[TURN_SERIES_COUNT];
+} turn_mode_stats_t;
+
+typedef struct {
+    turn_mode_stats_t modes[TURN_MODE_COUNT];
+    uint32_t dropped;      // 被下一次翻页覆盖或没有启动波形的翻页
+} turn_stats_t;
+
+// 各桶上限（ms，含），最后一桶收纳更大的值
+extern const uint16_t turn_stats_bucket_ms[TURN_STATS_BUCKETS];
+
+/**
+ * @brief 从 NVS 载入累计统计并注册保存定时器（LVGL 初始化后调用）
+ */
+void turn_stats_init(void);
+
+/**
+ * @brief 记录按键按下时间（LVGL 任务取出按下事件时调用，早于快速通道钩子）
+ * @param press_ms 按键确认时间（esp_timer，毫秒）
+ */
+void turn_stats_key(uint32_t press_ms);
+
+/**
+ * @brief 开始一次翻页（阅读器，读取正文之前）
+ */
+void turn_stats_begin(void);
+
+/**
+ * @brief 放弃当前翻页（已在书首/书尾，没有翻动）
+ */
+void turn_stats_cancel(void);
+
+/**
+ * @brief 标记 FETCH、LAYOUT 或 RENDER 阶段结束（阅读器，LVGL 任务中）
+ *
+ * 同一阶段重复标记时以最后一次为准；RENDER 之后本次翻页移交刷新任务，
+ * 须在提交刷新请求之前调用
+ */
+void turn_stats_mark(turn_stage_t stage);
+
+/**
+ * @brief 刷新任务取到请求（flush 阶段结束）
+ */
+void turn_stats_refresh_begin(void);
+
+/**
+ * @brief 刷新任务上传结束
+ * @param mode 实际执行的刷新模式
+ * @param wave_us 最近一次发出 0x20 的时间（EPD_4in26_GetLastUpdateUs），
+ *                早于本次取到请求表示没有启动波形，样本丢弃
+ * @param panel_busy 波形仍在运行（异步刷新）：由 turn_stats_panel_idle_isr 结算
+ */
+void turn_stats_refresh_end(turn_mode_t mode, int64_t wave_us, bool panel_busy);
+
+/**
+ * @brief 波形结束（BUSY 中断上下文，IRAM）
+ */
+void turn_stats_panel_idle_isr(void);
+
+/**
+ * @brief 复制累计统计
+ */
+void turn_stats_get(turn_stats_t *out);
+
+/**
+ * @brief 估计某个直方图的分位数（返回所在桶的上限，ms；没有样本时返回 0）
+ * @param permille 分位（500 为中位数，900 为 p90）
+ */
+uint32_t turn_stats_percentile(const turn_hist_t *hist, uint32_t permille);
+
+/**
+ * @brief 清空统计（同时清除 NVS 中的记录）
+ */
+void turn_stats_reset(void);
+
+/**
+ * @brief 立即写入 NVS（有未保存的样本时；关机前调用）
+ */
+void turn_stats_save(void);
+
+/**
+ * @brief 阶段名（"key"、"fetch"...，总延时为 "total"）
+ */
+const char *turn_stats_series_name(int series);
+
+/**
+ * @brief 刷新模式名
+ */
+const char *turn_stats_mode_name(turn_mode_t mode);
+
+/**
+ * @brief 导出为 JSON：{"buckets_ms":[..],"dropped":n,"modes":{"partial":{"n":..,
+ * "last_ms":..,"total":{"avg":..,"p50":..,"p90":..,"max":..,"hist":[..]},"key":{..},..},..}}
+ * @return 写入长度（不含结尾 0），缓冲区不够时截断为 {}
+ */
+size_t turn_stats_format_json(char *buf, size_t len);
+
+#endif // TURN_STATS_H
@@ -0,0 +1,1065 @@
+/**
+ * @file book_search.c
+ * @brief TXT 全文搜索实现
+ */
+
+#include "book_search.h"
+#include "page_index.h"
+#include "gb18030.h"
+#include "bg_jobs.h"
+#include "heap_stats.h"
+#include "esp_log.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "BOOK_SEARCH";
+
+#define SEARCH_MAGIC          0x31535446u  // "FTS1"
+#define SEARCH_BLOCK_BITS     (32 - BOOK_SEARCH_BUCKET_BITS)
+#define SEARCH_BLOCK_MASK     ((1u << SEARCH_BLOCK_BITS) - 1)
+#define SEARCH_MAX_FILE       ((long)SEARCH_BLOCK_MASK << BOOK_SEARCH_BLOCK_SHIFT)
+#define SEARCH_READ_CHUNK     4096   // 构建时每步读取的正文
+#define SEARCH_RUN_KEYS       4096   // 一段在内存中攒的词元键（16 KB）
+#define SEARCH_RUN_BUF        512    // 合并时每段的读缓冲
+#define SEARCH_OUT_BUF        512
+#define SEARCH_MERGE_STEP     2048   // 合并时每步最多输出的键
+#define SEARCH_MAX_CANDIDATES 2048   // 最短列表最多取多少候选块
+#define SEARCH_MAX_VERIFY     256    // 每次查询最多比对的候选块
+#define SEARCH_MAX_TOKENS     32
+#define SEARCH_WORD_MIN       2      // 单词至少几个字符才建索引
+#define SEARCH_WORD_SEED      0x9E3779B9u
+#define SEARCH_SYNC_BACK      64     // GB18030 比对起点向前找字符边界的范围
+#define SEARCH_SNIPPET_BACK   6      // 摘要从命中处往前带几个字符
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t key;          // 书籍指纹（路径、大小、修改时间）
+    uint32_t file_size;
+    uint32_t list_bytes;   // 列表区大小，桶起点表紧随其后
+    uint8_t bucket_bits;
+    uint8_t block_shift;
+    uint8_t encoding;
+    uint8_t reserved;
+} search_header_t;
+
+// ---------------------------------------------------------------------------
+// 字符解码与切词（构建与查询共用，保证两边的词元一致）
+// ---------------------------------------------------------------------------
+
+static int utf8_decode(const uint8_t *s, size_t len, uint32_t *cp) {
+    if (len == 0) {
+        return 0;
+    }
+    const uint8_t c = s[0];
+    int n;
+    uint32_t v;
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+        n = 2;
+        v = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+        v = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+        v = c & 0x07;
+    } else {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    if (len < (size_t)n) {
+        return 0;
+    }
+    for (int i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        v = (v << 6) | (s[i] & 0x3F);
+    }
+    *cp = v;
+    return n;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// 返回消耗的字节数；0 表示 len 内字符不完整
+static int decode_char(txt_encoding_t encoding, const uint8_t *s, size_t len, uint32_t *cp) {
+    return encoding == TXT_ENCODING_GB18030 ? gb18030_decode(s, len, cp) : utf8_decode(s, len, cp);
+}
+
+static bool is_cjk(uint32_t cp) {
+    return (cp >= 0x3040 && cp <= 0x30FF) ||    // 假名
+           (cp >= 0x3400 && cp <= 0x4DBF) ||    // 扩展 A
+           (cp >= 0x4E00 && cp <= 0x9FFF) ||
+           (cp >= 0xAC00 && cp <= 0xD7AF) ||    // 谚文
+           (cp >= 0xF900 && cp <= 0xFAFF) ||
+           (cp >= 0x20000 && cp <= 0x2FFFF);
+}
+
+static bool is_word_char(uint32_t cp) {
+    return (cp >= '0' && cp <= '9') || (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z');
+}
+
+static uint32_t fold_case(uint32_t cp) {
+    return (cp >= 'A' && cp <= 'Z') ? cp + ('a' - 'A') : cp;
+}
+
+static uint32_t bucket_of(uint32_t hash) {
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3Bu;
+    hash ^= hash >> 16;
+    return hash >> (32 - BOOK_SEARCH_BUCKET_BITS);
+}
+
+typedef void (*token_emit_t)(void *ctx, uint32_t bucket, long offset);
+
+typedef struct {
+    uint32_t prev_cp;      // 上一个字符是汉字时为它的码点，否则为 0
+    long prev_off;
+    uint32_t word_hash;
+    long word_off;
+    int word_len;
+    token_emit_t emit;
+    void *ctx;
+} tokenizer_t;
+
+static void tok_end_word(tokenizer_t *t) {
+    if (t->word_len >= SEARCH_WORD_MIN) {
+        t->emit(t->ctx, bucket_of(t->word_hash), t->word_off);
+    }
+    t->word_len = 0;
+}
+
+static void tok_feed(tokenizer_t *t, uint32_t cp, long offset) {
+    if (is_word_char(cp)) {
+        const uint8_t c = (uint8_t)fold_case(cp);
+        if (t->word_len == 0) {
+            t->word_hash = SEARCH_WORD_SEED;
+            t->word_off = offset;
+        }
+        t->word_hash = page_index_hash(t->word_hash, &c, 1);
+        t->word_len++;
+        t->prev_cp = 0;
+        return;
+    }
+    tok_end_word(t);
+    if (!is_cjk(cp)) {
+        t->prev_cp = 0;
+        return;
+    }
+    if (t->prev_cp != 0) {
+        const uint32_t pair[2] = {t->prev_cp, cp};
+        t->emit(t->ctx, bucket_of(page_index_hash(0, pair, sizeof(pair))), t->prev_off);
+    }
+    t->prev_cp = cp;
+    t->prev_off = offset;
+}
+
+static void tok_finish(tokenizer_t *t) {
+    tok_end_word(t);
+    t->prev_cp = 0;
+}
+
+// ---------------------------------------------------------------------------
+// 段文件读写：每段是升序去重的键，存为相邻差值的 varint（第一个差值相对 0）。
+// 索引中的块号列表格式相同，查询时也用这里的读取器
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    FILE *f;
+    uint32_t written;      // 已输出的字节数（含缓冲中的）
+    size_t len;
+    bool ok;
+    uint8_t buf[SEARCH_OUT_BUF];
+} out_buf_t;
+
+typedef struct {
+    uint32_t pos;          // 下一次读取的文件偏移
+    uint32_t end;
+    uint32_t key;          // 当前值（valid 时）
+    bool valid;
+    uint16_t len;
+    uint16_t at;
+    uint8_t buf[SEARCH_RUN_BUF];
+} run_reader_t;
+
+static void out_init(out_buf_t *o, FILE *f) {
+    o->f = f;
+    o->written = 0;
+    o->len = 0;
+    o->ok = f != NULL;
+}
+
+static void out_flush(out_buf_t *o) {
+    if (o->len > 0 && o->ok) {
+        o->ok = fwrite(o->buf, 1, o->len, o->f) == o->len;
+    }
+    o->len = 0;
+}
+
+static void out_varint(out_buf_t *o, uint32_t v) {
+    if (o->len > sizeof(o->buf) - 5) {
+        out_flush(o);
+    }
+    const size_t start = o->len;
+    while (v >= 0x80) {
+        o->buf[o->len++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    o->buf[o->len++] = (uint8_t)v;
+    o->written += (uint32_t)(o->len - start);
+}
+
+static void out_u32(out_buf_t *o, uint32_t v) {
+    if (o->len > sizeof(o->buf) - 4) {
+        out_flush(o);
+    }
+    for (int i = 0; i < 4; i++) {
+        o->buf[o->len++] = (uint8_t)(v >> (8 * i));
+    }
+    o->written += 4;
+}
+
+static void run_open(run_reader_t *r, uint32_t pos, uint32_t end) {
+    r->pos = pos;
+    r->end = end;
+    r->key = 0;
+    r->valid = false;
+    r->len = 0;
+    r->at = 0;
+}
+
+// 读出下一个值；到段尾或读取失败时 valid 为 false
+static bool run_next(FILE *f, run_reader_t *r) {
+    if (r->len - r->at < 5 && r->pos < r->end) {
+        memmove(r->buf, r->buf + r->at, r->len - r->at);
+        r->len = (uint16_t)(r->len - r->at);
+        r->at = 0;
+        size_t want = sizeof(r->buf) - r->len;
+        if (want > r->end - r->pos) {
+            want = r->end - r->pos;
+        }
+        if (fseek(f, (long)r->pos, SEEK_SET) != 0 || fread(r->buf + r->len, 1, want, f) != want) {
+            r->valid = false;
+            return false;
+        }
+        r->len = (uint16_t)(r->len + want);
+        r->pos += (uint32_t)want;
+    }
+    uint32_t v = 0;
+    unsigned shift = 0;
+    while (r->at < r->len && shift < 35) {
+        const uint8_t b = r->buf[r->at++];
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            r->key += v;
+            r->valid = true;
+            return true;
+        }
+        shift += 7;
+    }
+    r->valid = false;
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// 后台构建
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    PHASE_SCAN,
+    PHASE_MERGE,
+} build_phase_t;
+
+typedef struct {
+    uint32_t gen;
+    uint32_t key;
+    long file_size;
+    long content_start;
+    txt_encoding_t encoding;
+    char book_path[256];
+    char index_path[64];
+    char tmp_path[3][64];  // 两个段文件轮流作为合并的输入与输出，外加最终索引的临时文件
+    build_phase_t phase;
+    bool failed;
+    bool complete;
+
+    // 读正文
+    FILE *book;
+    long pos;              // 下一次读取的文件偏移
+    uint8_t *in;           // SEARCH_READ_CHUNK 加上一个不完整字符的余量
+    size_t in_len;         // 缓冲开头尚未解码的字节
+    tokenizer_t tok;
+
+    // 当前段的键
+    uint32_t *keys;
+    int key_count;
+
+    // 段表：runs[i] 为第 i 段在 src 中的起点，runs[run_count] 为终点
+    uint32_t *runs;
+    int run_count;
+    int run_cap;
+    int src;               // 段所在的临时文件（0 或 1）
+    FILE *src_f;
+    FILE *dst_f;
+    out_buf_t *out;
+
+    // 合并
+    run_reader_t *readers; // BOOK_SEARCH_MERGE_WAYS 个
+    int ways;
+    int next_run;          // 本层下一组的第一段
+    int new_runs;          // 本层已输出的段
+    bool final_level;
+    bool have_last;
+    uint32_t last_key;
+
+    // 最终索引：桶起点表先写到空闲的段文件，完成后接在列表区之后
+    FILE *final_f;
+    out_buf_t *dir;
+    int cur_bucket;
+    uint32_t last_block;
+} build_t;
+
+static struct {
+    bool open;
+    volatile bool ready;
+    volatile int progress;
+    uint32_t gen;
+    bg_job_id_t job;
+    uint32_t key;
+    long file_size;
+    long content_start;
+    txt_encoding_t encoding;
+    char book_path[256];
+    char index_path[64];
+} s_search;
+
+static int cmp_u32(const void *a, const void *b) {
+    const uint32_t x = *(const uint32_t *)a;
+    const uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// 排序去重后把当前一批键写成一段
+static bool flush_run(build_t *b) {
+    if (b->key_count == 0) {
+        return true;
+    }
+    qsort(b->keys, (size_t)b->key_count, sizeof(uint32_t), cmp_u32);
+    if (b->run_count + 2 > b->run_cap) {
+        const int cap = b->run_cap * 2;
+        uint32_t *grown = heap_stats_realloc(HEAP_TAG_SEARCH, b->runs, (size_t)cap * sizeof(uint32_t));
+        if (grown == NULL) {
+            return false;
+        }
+        b->runs = grown;
+        b->run_cap = cap;
+    }
+    b->runs[b->run_count] = b->out->written;
+    uint32_t prev = 0;
+    for (int i = 0; i < b->key_count; i++) {
+        if (i > 0 && b->keys[i] == prev) {
+            continue;
+        }
+        out_varint(b->out, b->keys[i] - prev);
+        prev = b->keys[i];
+    }
+    b->run_count++;
+    b->runs[b->run_count] = b->out->written;
+    b->key_count = 0;
+    return b->out->ok;
+}
+
+static void build_emit(void *ctx, uint32_t bucket, long offset) {
+    build_t *b = (build_t *)ctx;
+    if (b->key_count == SEARCH_RUN_KEYS && !flush_run(b)) {
+        b->failed = true;
+    }
+    if (b->key_count < SEARCH_RUN_KEYS) {
+        b->keys[b->key_count++] = (bucket << SEARCH_BLOCK_BITS) |
+                                  (uint32_t)(offset >> BOOK_SEARCH_BLOCK_SHIFT);
+    }
+}
+
+static bool build_alloc(build_t *b) {
+    b->in = heap_stats_malloc(HEAP_TAG_SEARCH, SEARCH_READ_CHUNK + 4);
+    b->keys = heap_stats_malloc(HEAP_TAG_SEARCH, SEARCH_RUN_KEYS * sizeof(uint32_t));
+    b->run_cap = 64;
+    b->runs = heap_stats_malloc(HEAP_TAG_SEARCH, (size_t)b->run_cap * sizeof(uint32_t));
+    b->out = heap_stats_malloc(HEAP_TAG_SEARCH, sizeof(out_buf_t));
+    if (b->in == NULL || b->keys == NULL || b->runs == NULL || b->out == NULL) {
+        ESP_LOGW(TAG, "No memory to build the search index");
+        return false;
+    }
+    b->book = fopen(b->book_path, "rb");
+    mkdir(PAGE_INDEX_DIR, 0775);
+    b->src_f = fopen(b->tmp_path[0], "w+b");
+    if (b->book == NULL || b->src_f == NULL || fseek(b->book, b->content_start, SEEK_SET) != 0) {
+        ESP_LOGW(TAG, "Cannot open files for the search index (errno=%d)", errno);
+        return false;
+    }
+    out_init(b->out, b->src_f);
+    b->pos = b->content_start;
+    b->tok.emit = build_emit;
+    b->tok.ctx = b;
+    return true;
+}
+
+static bool merge_level_begin(build_t *b);
+
+// 读一块正文并切词；读完后转入合并
+static bool scan_step(build_t *b) {
+    size_t want = SEARCH_READ_CHUNK;
+    if ((long)want > b->file_size - b->pos) {
+        want = (size_t)(b->file_size - b->pos);
+    }
+    const size_t n = want > 0 ? fread(b->in + b->in_len, 1, want, b->book) : 0;
+    if (n != want) {
+        ESP_LOGW(TAG, "Read failed at %ld", b->pos);
+        return false;
+    }
+    const long base = b->pos - (long)b->in_len;  // in[0] 的文件偏移
+    b->pos += (long)n;
+    const size_t len = b->in_len + n;
+    const bool at_eof = b->pos >= b->file_size;
+
+    size_t i = 0;
+    while (i < len) {
+        uint32_t cp;
+        int used = decode_char(b->encoding, b->in + i, len - i, &cp);
+        if (used == 0) {
+            if (!at_eof) {
+                break;      // 字符跨块，留到下一步
+            }
+            used = 1;
+            cp = 0xFFFD;
+        }
+        tok_feed(&b->tok, cp, base + (long)i);
+        i += (size_t)used;
+    }
+    memmove(b->in, b->in + i, len - i);
+    b->in_len = len - i;
+    if (b->failed) {
+        return false;
+    }
+    if (b->gen == s_search.gen) {
+        s_search.progress = (int)((int64_t)(b->pos - b->content_start) * 90 /
+                                  (b->file_size - b->content_start + 1));
+    }
+
+    if (!at_eof) {
+        return true;
+    }
+    tok_finish(&b->tok);
+    fclose(b->book);
+    b->book = NULL;
+    heap_stats_free(HEAP_TAG_SEARCH, b->in);
+    b->in = NULL;
+    if (!flush_run(b) || b->failed) {
+        return false;
+    }
+    out_flush(b->out);
+    heap_stats_free(HEAP_TAG_SEARCH, b->keys);
+    b->keys = NULL;
+    if (!b->out->ok || fflush(b->src_f) != 0) {
+        return false;
+    }
+    ESP_LOGI(TAG, "Scanned %ld bytes into %d runs (%u bytes)", b->file_size, b->run_count,
+             (unsigned)b->out->written);
+
+    b->readers = heap_stats_malloc(HEAP_TAG_SEARCH, BOOK_SEARCH_MERGE_WAYS * sizeof(run_reader_t));
+    b->dir = heap_stats_malloc(HEAP_TAG_SEARCH, sizeof(out_buf_t));
+    if (b->readers == NULL || b->dir == NULL) {
+        return false;
+    }
+    b->phase = PHASE_MERGE;
+    return merge_level_begin(b);
+}
+
+static void group_begin(build_t *b) {
+    b->ways = b->run_count - b->next_run;
+    if (b->ways > BOOK_SEARCH_MERGE_WAYS) {
+        b->ways = BOOK_SEARCH_MERGE_WAYS;
+    }
+    for (int w = 0; w < b->ways; w++) {
+        run_open(&b->readers[w], b->runs[b->next_run + w], b->runs[b->next_run + w + 1]);
+        run_next(b->src_f, &b->readers[w]);
+    }
+    // 段表原地更新：本组的起止已读入读取器，新段号不会超过本组的第一段
+    b->runs[b->new_runs] = b->out->written;
+    b->next_run += b->ways;
+    b->have_last = false;
+}
+
+static bool merge_level_begin(build_t *b) {
+    const int dst = 1 - b->src;
+    b->dst_f = fopen(b->tmp_path[dst], "w+b");
+    if (b->dst_f == NULL) {
+        return false;
+    }
+    b->final_level = b->run_count <= BOOK_SEARCH_MERGE_WAYS;
+    if (b->final_level) {
+        // 列表写进最终索引的临时文件（文件头稍后补写），桶起点表写进空闲的段文件
+        b->final_f = fopen(b->tmp_path[2], "w+b");
+        const search_header_t blank = {0};
+        if (b->final_f == NULL || fwrite(&blank, sizeof(blank), 1, b->final_f) != 1) {
+            return false;
+        }
+        out_init(b->out, b->final_f);
+        out_init(b->dir, b->dst_f);
+        b->cur_bucket = -1;
+    } else {
+        out_init(b->out, b->dst_f);
+    }
+    b->next_run = 0;
+    b->new_runs = 0;
+    group_begin(b);
+    return true;
+}
+
+static void final_key(build_t *b, uint32_t key) {
+    const int bucket = (int)(key >> SEARCH_BLOCK_BITS);
+    const uint32_t block = key & SEARCH_BLOCK_MASK;
+    while (b->cur_bucket < bucket) {
+        b->cur_bucket++;
+        out_u32(b->dir, b->out->written);
+        b->last_block = 0;
+    }
+    out_varint(b->out, block - b->last_block);
+    b->last_block = block;
+}
+
+// 补齐桶起点表，把它接在列表区之后，写文件头后原子地替换旧索引
+static bool final_finish(build_t *b) {
+    while (b->cur_bucket < (int)BOOK_SEARCH_BUCKETS) {
+        b->cur_bucket++;
+        out_u32(b->dir, b->out->written);
+    }
+    out_flush(b->out);
+    out_flush(b->dir);
+    const uint32_t list_bytes = b->out->written;
+    bool ok = b->out->ok && b->dir->ok && fseek(b->dst_f, 0, SEEK_SET) == 0;
+    uint8_t *buf = b->out->buf;
+    size_t n;
+    while (ok && (n = fread(buf, 1, sizeof(b->out->buf), b->dst_f)) > 0) {
+        ok = fwrite(buf, 1, n, b->final_f) == n;
+    }
+    const search_header_t hdr = {
+        .magic = SEARCH_MAGIC,
+        .key = b->key,
+        .file_size = (uint32_t)b->file_size,
+        .list_bytes = list_bytes,
+        .bucket_bits = BOOK_SEARCH_BUCKET_BITS,
+        .block_shift = BOOK_SEARCH_BLOCK_SHIFT,
+        .encoding = (uint8_t)b->encoding,
+    };
+    ok = ok && fseek(b->final_f, 0, SEEK_SET) == 0 && fwrite(&hdr, sizeof(hdr), 1, b->final_f) == 1;
+    ok = fclose(b->final_f) == 0 && ok;
+    b->final_f = NULL;
+    if (!ok) {
+        return false;
+    }
+    remove(b->index_path);
+    if (rename(b->tmp_path[2], b->index_path) != 0) {
+        ESP_LOGW(TAG, "Cannot rename %s (errno=%d)", b->tmp_path[2], errno);
+        return false;
+    }
+    ESP_LOGI(TAG, "Index ready: %u bytes of lists -> %s", (unsigned)list_bytes, b->index_path);
+    b->complete = true;
+    return true;
+}
+
+// 本组读完：结束一段；本层读完：交换段文件进入下一层，或完成最终索引
+static bool group_end(build_t *b) {
+    if (b->final_level) {
+        return final_finish(b);
+    }
+    b->new_runs++;
+    b->runs[b->new_runs] = b->out->written;
+    if (b->next_run < b->run_count) {
+        group_begin(b);
+        return true;
+    }
+    out_flush(b->out);
+    if (!b->out->ok || fflush(b->dst_f) != 0) {
+        return false;
+    }
+    fclose(b->src_f);
+    b->src_f = b->dst_f;
+    b->dst_f = NULL;
+    b->src = 1 - b->src;
+    b->run_count = b->new_runs;
+    ESP_LOGI(TAG, "Merged into %d runs", b->run_count);
+    return merge_level_begin(b);
+}
+
+// 合并一组段：每步最多输出 SEARCH_MERGE_STEP 个键
+static bool merge_step(bg_job_t *job, build_t *b) {
+    for (int i = 0; i < SEARCH_MERGE_STEP; i++) {
+        int min = -1;
+        for (int w = 0; w < b->ways; w++) {
+            if (b->readers[w].valid && (min < 0 || b->readers[w].key < b->readers[min].key)) {
+                min = w;
+            }
+        }
+        if (min < 0) {
+            if (!group_end(b)) {
+                return false;
+            }
+            if (b->complete || bg_job_should_yield(job)) {
+                break;
+            }
+            continue;
+        }
+        const uint32_t key = b->readers[min].key;
+        run_next(b->src_f, &b->readers[min]);
+        if (b->have_last && key == b->last_key) {
+            continue;  // 同一桶同一块在相邻两段中都出现过
+        }
+        if (b->final_level) {
+            final_key(b, key);
+        } else {
+            out_varint(b->out, b->have_last ? key - b->last_key : key);
+        }
+        b->have_last = true;
+        b->last_key = key;
+    }
+    return b->out->ok;
+}
+
+static bool build_step(bg_job_t *job, void *arg) {
+    build_t *b = (build_t *)arg;
+    if (bg_job_cancelled(job) || b->failed) {
+        return false;
+    }
+    if (b->in == NULL && b->phase == PHASE_SCAN && !build_alloc(b)) {
+        b->failed = true;
+        return false;
+    }
+    bool ok = b->phase == PHASE_SCAN ? scan_step(b) : merge_step(job, b);
+    if (!ok) {
+        b->failed = true;
+        return false;
+    }
+    return !b->complete;
+}
+
+static void build_done(void *arg, bool finished) {
+    build_t *b = (build_t *)arg;
+    if (b->book != NULL) fclose(b->book);
+    if (b->src_f != NULL) fclose(b->src_f);
+    if (b->dst_f != NULL) fclose(b->dst_f);
+    if (b->final_f != NULL) fclose(b->final_f);
+    for (int i = 0; i < 3; i++) {
+        remove(b->tmp_path[i]);
+    }
+    heap_stats_free(HEAP_TAG_SEARCH, b->in);
+    heap_stats_free(HEAP_TAG_SEARCH, b->keys);
+    heap_stats_free(HEAP_TAG_SEARCH, b->runs);
+    heap_stats_free(HEAP_TAG_SEARCH, b->out);
+    heap_stats_free(HEAP_TAG_SEARCH, b->readers);
+    heap_stats_free(HEAP_TAG_SEARCH, b->dir);
+
+    if (b->gen == s_search.gen) {
+        if (finished && b->complete) {
+            s_search.progress = 100;
+            s_search.ready = true;
+        } else if (!finished) {
+            ESP_LOGI(TAG, "Index build cancelled");
+        } else {
+            ESP_LOGW(TAG, "Index build failed");
+        }
+        s_search.job = BG_JOB_NONE;
+    }
+    heap_stats_free(HEAP_TAG_SEARCH, b);
+}
+
+// ---------------------------------------------------------------------------
+// 打开与关闭
+// ---------------------------------------------------------------------------
+
+static bool read_header(FILE *f, search_header_t *hdr) {
+    return fseek(f, 0, SEEK_SET) == 0 && fread(hdr, sizeof(*hdr), 1, f) == 1 &&
+           hdr->magic == SEARCH_MAGIC && hdr->key == s_search.key &&
+           hdr->file_size == (uint32_t)s_search.file_size &&
+           hdr->bucket_bits == BOOK_SEARCH_BUCKET_BITS && hdr->block_shift == BOOK_SEARCH_BLOCK_SHIFT &&
+           hdr->encoding == (uint8_t)s_search.encoding;
+}
+
+void book_search_open(const book_search_config_t *cfg) {
+    book_search_close();
+    if (cfg == NULL || cfg->file_path == NULL || cfg->file_size <= 0) {
+        return;
+    }
+
+    struct stat st;
+    const uint32_t mtime = stat(cfg->file_path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    uint32_t key = page_index_hash(0, cfg->file_path, strlen(cfg->file_path));
+    key = page_index_hash(key, &cfg->file_size, sizeof(cfg->file_size));
+    key = page_index_hash(key, &mtime, sizeof(mtime));
+
+    s_search.open = true;
+    s_search.key = key;
+    s_search.file_size = cfg->file_size;
+    s_search.content_start = cfg->content_start;
+    s_search.encoding = cfg->encoding;
+    strncpy(s_search.book_path, cfg->file_path, sizeof(s_search.book_path) - 1);
+    snprintf(s_search.index_path, sizeof(s_search.index_path), "%s/%08x.fts", PAGE_INDEX_DIR,
+             (unsigned)key);
+
+    FILE *f = fopen(s_search.index_path, "rb");
+    if (f != NULL) {
+        search_header_t hdr;
+        const bool valid = read_header(f, &hdr);
+        fclose(f);
+        if (valid) {
+            s_search.ready = true;
+            s_search.progress = 100;
+            ESP_LOGI(TAG, "Using %s", s_search.index_path);
+            return;
+        }
+        ESP_LOGW(TAG, "Rebuilding stale index %s", s_search.index_path);
+    }
+    if (cfg->file_size > SEARCH_MAX_FILE) {
+        ESP_LOGW(TAG, "Book too large to index (%ld bytes)", cfg->file_size);
+        return;
+    }
+
+    build_t *b = heap_stats_calloc(HEAP_TAG_SEARCH, 1, sizeof(build_t));
+    if (b == NULL) {
+        return;
+    }
+    b->gen = s_search.gen;
+    b->key = key;
+    b->file_size = cfg->file_size;
+    b->content_start = cfg->content_start;
+    b->encoding = cfg->encoding;
+    strncpy(b->book_path, cfg->file_path, sizeof(b->book_path) - 1);
+    strncpy(b->index_path, s_search.index_path, sizeof(b->index_path) - 1);
+    // 临时文件带上代号：被取消的旧作业收尾时不会删掉新作业的文件
+    for (int i = 0; i < 3; i++) {
+        snprintf(b->tmp_path[i], sizeof(b->tmp_path[i]), "%s/%08x.ft%d%u", PAGE_INDEX_DIR,
+                 (unsigned)key, i, (unsigned)(b->gen % 100));
+    }
+
+    const bg_job_desc_t desc = {
+        .name = "book_search",
+        .prio = BG_JOB_PRIO_LOW,
+        .mem_budget = SEARCH_READ_CHUNK + SEARCH_RUN_KEYS * sizeof(uint32_t) +
+                      BOOK_SEARCH_MERGE_WAYS * sizeof(run_reader_t) + 2 * sizeof(out_buf_t) + 4096,
+        .step = build_step,
+        .done = build_done,
+        .arg = b,
+    };
+    s_search.job = bg_jobs_submit(&desc);
+    if (s_search.job == BG_JOB_NONE) {
+        heap_stats_free(HEAP_TAG_SEARCH, b);
+        ESP_LOGW(TAG, "Cannot submit index build");
+        return;
+    }
+    ESP_LOGI(TAG, "Building search index for %s", cfg->file_path);
+}
+
+void book_search_close(void) {
+    if (!s_search.open) {
+        return;
+    }
+    if (s_search.job != BG_JOB_NONE) {
+        bg_jobs_cancel(s_search.job);
+    }
+    const uint32_t gen = s_search.gen + 1;
+    memset(&s_search, 0, sizeof(s_search));
+    s_search.gen = gen;  // 被取消的作业结束时不再改动这里的状态
+}
+
+bool book_search_is_ready(void) {
+    return s_search.open && s_search.ready;
+}
+
+int book_search_progress(void) {
+    return s_search.open ? s_search.progress : 0;
+}
+
+// ---------------------------------------------------------------------------
+// 查询
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t buckets[SEARCH_MAX_TOKENS];
+    int count;
+} query_tokens_t;
+
+static void query_emit(void *ctx, uint32_t bucket, long offset) {
+    (void)offset;
+    query_tokens_t *q = (query_tokens_t *)ctx;
+    for (int i = 0; i < q->count; i++) {
+        if (q->buckets[i] == bucket) {
+            return;
+        }
+    }
+    if (q->count < SEARCH_MAX_TOKENS) {
+        q->buckets[q->count++] = bucket;
+    }
+}
+
+// 逐字比对：从 s 开始的字符是否依次等于 cps（ASCII 不分大小写）；返回匹配的字节数
+static size_t match_at(txt_encoding_t encoding, const uint8_t *s, size_t len,
+                       const uint32_t *cps, int cp_count) {
+    size_t pos = 0;
+    for (int k = 0; k < cp_count; k++) {
+        uint32_t cp;
+        const int used = decode_char(encoding, s + pos, len - pos, &cp);
+        if (used == 0 || fold_case(cp) != cps[k]) {
+            return 0;
+        }
+        pos += (size_t)used;
+    }
+    return pos;
+}
+
+static void make_snippet(txt_encoding_t encoding, const uint8_t *s, size_t len, char *out) {
+    size_t used_out = 0;
+    size_t pos = 0;
+    while (pos < len) {
+        uint32_t cp;
+        const int used = decode_char(encoding, s + pos, len - pos, &cp);
+        if (used == 0) {
+            break;
+        }
+        pos += (size_t)used;
+        if (cp < 0x20) {
+            cp = ' ';
+        }
+        if (cp == ' ' && used_out > 0 && out[used_out - 1] == ' ') {
+            continue;
+        }
+        char enc[4];
+        const size_t n = utf8_encode(cp, enc);
+        if (used_out + n > BOOK_SEARCH_SNIPPET) {
+            break;
+        }
+        memcpy(out + used_out, enc, n);
+        used_out += n;
+    }
+    out[used_out] = '\0';
+}
+
+book_search_status_t book_search_run(const char *query, book_search_hit_t *hits, int max_hits,
+                                     int *count, bool *truncated) {
+    *count = 0;
+    if (truncated != NULL) {
+        *truncated = false;
+    }
+    if (!s_search.open || query == NULL || hits == NULL || max_hits <= 0) {
+        return BOOK_SEARCH_ERROR;
+    }
+    if (!s_search.ready) {
+        return BOOK_SEARCH_BUILDING;
+    }
+
+    // 查询词解码为码点（去掉首尾空白）并切词
+    uint32_t cps[BOOK_SEARCH_MAX_QUERY];
+    int cp_count = 0;
+    query_tokens_t tokens = {0};
+    tokenizer_t tok = {.emit = query_emit, .ctx = &tokens};
+    const size_t qlen = strnlen(query, BOOK_SEARCH_MAX_QUERY);
+    for (size_t i = 0; i < qlen && cp_count < BOOK_SEARCH_MAX_QUERY;) {
+        uint32_t cp;
+        int used = utf8_decode((const uint8_t *)query + i, qlen - i, &cp);
+        if (used == 0) {
+            break;
+        }
+        if (cp_count > 0 || cp > ' ') {
+            cps[cp_count++] = fold_case(cp);
+            tok_feed(&tok, cp, (long)i);
+        }
+        i += (size_t)used;
+    }
+    tok_finish(&tok);
+    while (cp_count > 0 && cps[cp_count - 1] <= ' ') {
+        cp_count--;
+    }
+    if (tokens.count == 0 || cp_count == 0) {
+        return BOOK_SEARCH_TOO_SHORT;
+    }
+
+    FILE *f = fopen(s_search.index_path, "rb");
+    if (f == NULL) {
+        return BOOK_SEARCH_ERROR;
+    }
+    uint32_t *cands = malloc(SEARCH_MAX_CANDIDATES * sizeof(uint32_t));
+    run_reader_t *r = malloc(sizeof(run_reader_t));
+    uint8_t *text = NULL;
+    book_search_status_t status = BOOK_SEARCH_ERROR;
+    FILE *book = NULL;
+    search_header_t hdr;
+
+    // 每个词元的列表范围
+    uint32_t start[SEARCH_MAX_TOKENS];
+    uint32_t end[SEARCH_MAX_TOKENS];
+    if (cands == NULL || r == NULL || !read_header(f, &hdr)) {
+        goto out;
+    }
+    int driver = 0;
+    for (int t = 0; t < tokens.count; t++) {
+        uint32_t range[2];
+        const long at = (long)(sizeof(hdr) + hdr.list_bytes + tokens.buckets[t] * sizeof(uint32_t));
+        if (fseek(f, at, SEEK_SET) != 0 || fread(range, sizeof(range), 1, f) != 1 ||
+            range[0] > range[1] || range[1] > hdr.list_bytes) {
+            goto out;
+        }
+        start[t] = (uint32_t)sizeof(hdr) + range[0];
+        end[t] = (uint32_t)sizeof(hdr) + range[1];
+        if (end[t] - start[t] < end[driver] - start[driver]) {
+            driver = t;
+        }
+    }
+
+    // 最短的列表给出候选块，其余词元须出现在相邻一块之内（词元在查询中的位置不超过一块）
+    int n = 0;
+    run_open(r, start[driver], end[driver]);
+    while (run_next(f, r)) {
+        if (n == SEARCH_MAX_CANDIDATES) {
+            if (truncated != NULL) {
+                *truncated = true;
+            }
+            break;
+        }
+        cands[n++] = r->key;
+    }
+    for (int t = 0; t < tokens.count && n > 0; t++) {
+        if (t == driver) {
+            continue;
+        }
+        int kept = 0;
+        run_open(r, start[t], end[t]);
+        run_next(f, r);
+        for (int i = 0; i < n; i++) {
+            const uint32_t c = cands[i];
+            while (r->valid && r->key + 1 < c) {
+                run_next(f, r);
+            }
+            if (r->valid && r->key <= c + 1) {
+                cands[kept++] = c;
+            }
+        }
+        n = kept;
+    }
+
+    // 读出候选块前后各一块的正文逐字比对
+    const size_t block = 1u << BOOK_SEARCH_BLOCK_SHIFT;
+    const size_t span = 3 * block + (size_t)cp_count * 4 + SEARCH_SYNC_BACK;
+    text = malloc(span);
+    book = fopen(s_search.book_path, "rb");
+    if (text == NULL || book == NULL) {
+        goto out;
+    }
+    long last_hit = -1;
+    int verified = 0;
+    for (int i = 0; i < n && *count < max_hits; i++, verified++) {
+        if (verified == SEARCH_MAX_VERIFY) {
+            if (truncated != NULL) {
+                *truncated = true;
+            }
+            break;
+        }
+        long from = ((long)cands[i] - 1) * (long)block;
+        if (from < s_search.content_start) {
+            from = s_search.content_start;
+        }
+        long back = from - SEARCH_SYNC_BACK;
+        if (back < s_search.content_start) {
+            back = s_search.content_start;
+        }
+        if (fseek(book, back, SEEK_SET) != 0) {
+            goto out;
+        }
+        const size_t len = fread(text, 1, span, book);
+
+        // 找到字符边界：UTF-8 跳过续字节；GB18030 从 from 前最近的 0x30 以下字节之后开始
+        size_t p = (size_t)(from - back);
+        if (s_search.encoding == TXT_ENCODING_GB18030) {
+            size_t q = p;
+            while (q > 0 && text[q - 1] >= 0x30) {
+                q--;
+            }
+            if (q > 0 || back == s_search.content_start) {
+                p = q;
+            }
+        } else {
+            while (p < len && (text[p] & 0xC0) == 0x80) {
+                p++;
+            }
+        }
+
+        size_t ring[SEARCH_SNIPPET_BACK] = {0};
+        int ring_n = 0;
+        while (p < len && *count < max_hits) {
+            uint32_t cp;
+            int used = decode_char(s_search.encoding, text + p, len - p, &cp);
+            if (used == 0) {
+                break;
+            }
+            const long offset = back + (long)p;
+            size_t matched = 0;
+            if (offset > last_hit && fold_case(cp) == cps[0]) {
+                matched = match_at(s_search.encoding, text + p, len - p, cps, cp_count);
+            }
+            if (matched > 0) {
+                book_search_hit_t *hit = &hits[(*count)++];
+                hit->offset = offset;
+                const size_t snip = ring_n == 0 ? p
+                                    : ring_n < SEARCH_SNIPPET_BACK ? ring[0]
+                                    : ring[ring_n % SEARCH_SNIPPET_BACK];
+                make_snippet(s_search.encoding, text + snip, len - snip, hit->snippet);
+                last_hit = offset;
+                used = (int)matched;
+            }
+            ring[ring_n % SEARCH_SNIPPET_BACK] = p;
+            ring_n++;
+            p += (size_t)used;
+        }
+    }
+    if (*count == max_hits && truncated != NULL) {
+        *truncated = true;
+    }
+    status = BOOK_SEARCH_OK;
+    ESP_LOGI(TAG, "\"%s\": %d tokens, %d candidate blocks, %d hits", query, tokens.count, n, *count);
+
+out:
+    if (book != NULL) {
+        fclose(book);
+    }
+    fclose(f);
+    free(text);
+    free(r);
+    free(cands);
+    return status;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file book_search.h
+ * @brief TXT 全文搜索 - SD 卡上的二元组倒排索引
+ *
+ * 正文切成词元：相邻两个汉字（含假名、谚文）组成一个二元组，连续的 ASCII 字母数字
+ * 组成一个单词（不分大小写，至少 2 个字符）。词元哈希到 BOOK_SEARCH_BUCKETS 个桶，
+ * 每个桶记录它出现过的文件块（1 << BOOK_SEARCH_BLOCK_SHIFT 字节一块）的升序列表，
+ * 列表存为相邻块号差值的 varint。索引保存在 /sdcard/.x4cache/<hash>.fts：
+ * 文件头 + 全部列表 + 每个桶的列表起点（BOOK_SEARCH_BUCKETS + 1 个 u32）。
+ *
+ * 索引由后台作业（bg_jobs）构建：顺序读一遍书，词元键（桶 << 18 | 块号）在内存中
+ * 攒满一批就排序去重，作为一段写入临时文件；读完后每次合并 BOOK_SEARCH_MERGE_WAYS 段，
+ * 直到剩下的段能一次合并成最终索引。构建不占 LVGL 任务，中途关闭书籍下次从头开始。
+ *
+ * 查询在 LVGL 任务中同步执行：每个词元读一个列表，从最短的列表取候选块，其余列表
+ * 在相邻一块内都出现才保留，最后读出候选块附近的正文逐字比对，得到精确的命中位置。
+ * 读取量与书的大小无关，只和查询词的稀有程度有关
+ */
+
+#ifndef BOOK_SEARCH_H
+#define BOOK_SEARCH_H
+
+#include "txt_reader.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOK_SEARCH_BUCKET_BITS  14
+#define BOOK_SEARCH_BUCKETS      (1u << BOOK_SEARCH_BUCKET_BITS)
+#define BOOK_SEARCH_BLOCK_SHIFT  10      // 1 KB 一块
+#define BOOK_SEARCH_MERGE_WAYS   8       // 每次合并的段数
+#define BOOK_SEARCH_MAX_QUERY    64      // 查询词的最大字节数（UTF-8）
+#define BOOK_SEARCH_SNIPPET      60      // 结果摘要的最大字节数（UTF-8）
+
+typedef struct {
+    const char *file_path;       // 书籍路径
+    long file_size;
+    long content_start;          // 正文起点（跳过 BOM）
+    txt_encoding_t encoding;     // 文件编码（已检测，不是 AUTO）
+} book_search_config_t;
+
+typedef enum {
+    BOOK_SEARCH_OK = 0,
+    BOOK_SEARCH_BUILDING,        // 索引还在构建
+    BOOK_SEARCH_TOO_SHORT,       // 查询词里没有可检索的词元（单个汉字或单个字母）
+    BOOK_SEARCH_ERROR,
+} book_search_status_t;
+
+typedef struct {
+    long offset;                              // 命中位置的文件偏移
+    char snippet[BOOK_SEARCH_SNIPPET + 1];    // 命中处附近的正文（UTF-8，换行替换为空格）
+} book_search_hit_t;
+
+/**
+ * @brief 为书籍准备搜索索引：已有完整索引时立即可用，否则提交后台构建作业
+ *
+ * 之前打开的书先关闭。在 LVGL 任务中调用
+ */
+void book_search_open(const book_search_config_t *cfg);
+
+/**
+ * @brief 关闭当前书籍，取消未完成的构建
+ */
+void book_search_close(void);
+
+/**
+ * @brief 索引是否已可查询
+ */
+bool book_search_is_ready(void);
+
+/**
+ * @brief 构建进度（0~100）；没有打开书籍时为 0
+ */
+int book_search_progress(void);
+
+/**
+ * @brief 搜索（在 LVGL 任务中调用）
+ * @param query 查询词（UTF-8）
+ * @param hits 输出：按文件位置升序的命中
+ * @param max_hits hits 的容量
+ * @param count 输出：命中数
+ * @param truncated 输出：是否还有未列出的命中（可为 NULL）
+ * @return 状态；BOOK_SEARCH_OK 时 count 可以为 0（没有命中）
+ */
+book_search_status_t book_search_run(const char *query, book_search_hit_t *hits, int max_hits,
+                                     int *count, bool *truncated);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOK_SEARCH_H
@@ -4,7 +4,7 @@
  *
  * Font: GenJyuuGothic
  * Size: 16px
- * BPP: 4
+ * BPP: 1
  *
  * Generated by generate_builtin_font_v2.py
  */
@@ -22,4725 +22,2324 @@ extern "C" {
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+25A1 "□" */
-    0x88, 0xff, 0xe1, 0x4, 0x47, 0xff, 0x0, 0x3,
-    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xec, 0x88,
-    0xff, 0xe0, 0x60,
+    0xff, 0xfe, 0x0, 0x18, 0x0, 0x60, 0x1, 0x80,
+    0x6, 0x0, 0x18, 0x0, 0x60, 0x1, 0x80, 0x6,
+    0x0, 0x18, 0x0, 0x60, 0x1, 0x80, 0x5, 0xff,
+    0xe0,
 
     /* U+4E00 "一" */
-    0x1d, 0xdf, 0xfe, 0x11, 0x0,
+    0x7f, 0xfe,
 
     /* U+4E03 "七" */
-    0x0, 0xe9, 0x10, 0xf, 0xfe, 0x9, 0x98, 0x3,
-    0xff, 0xc6, 0x26, 0xd3, 0x92, 0x1, 0x8d, 0xae,
-    0xd9, 0x54, 0xa, 0xd9, 0x1b, 0xcc, 0x50, 0xe5,
-    0x65, 0xcb, 0x18, 0x80, 0xd6, 0x62, 0x5d, 0xc2,
-    0x1, 0xf8, 0x40, 0x3f, 0xfb, 0xa4, 0x1, 0xff,
-    0xc2, 0xa4, 0x0, 0xe3, 0x10, 0xf, 0x1b, 0x0,
-    0x75, 0x7d, 0xe6, 0x71, 0x10,
+    0x4, 0x0, 0x8, 0x0, 0x10, 0x0, 0x20, 0x0,
+    0x40, 0xe0, 0xfc, 0x1f, 0x0, 0x2, 0x0, 0x4,
+    0x0, 0x8, 0x0, 0x10, 0x0, 0x20, 0x20, 0x40,
+    0x40, 0x7f, 0x80,
 
     /* U+4E07 "万" */
-    0x9, 0xbb, 0xb7, 0x57, 0x7f, 0x48, 0x4d, 0xdd,
-    0x15, 0x77, 0xf4, 0x80, 0x78, 0x40, 0x3f, 0xf8,
-    0x26, 0x60, 0xf, 0xfe, 0xf, 0x45, 0xdf, 0x84,
-    0x3, 0xc5, 0x97, 0x7d, 0x88, 0x1, 0xe1, 0x10,
-    0x7, 0x78, 0x80, 0x71, 0x10, 0x3, 0xc2, 0xe0,
-    0x1d, 0x54, 0x0, 0xf1, 0x88, 0x6, 0x14, 0x30,
-    0xf, 0x31, 0x0, 0x6a, 0x80, 0xf, 0xfe, 0x5,
-    0x62, 0x0, 0x78, 0x98, 0x2, 0xcf, 0x70, 0xd,
-    0x37, 0x6e, 0x90, 0xb, 0x14, 0x3, 0xa6, 0xed,
-    0x86, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x80, 0x80, 0x1, 0x2, 0x2, 0x4, 0x8,
+    0x8, 0x10, 0x10, 0x40, 0x21, 0x0, 0x44, 0xf,
+    0x0, 0x0, 0x0,
 
     /* U+4E09 "三" */
-    0xa, 0xcc, 0xff, 0x58, 0x2, 0xb3, 0x3f, 0xd6,
-    0x1, 0xff, 0xe1, 0xab, 0xbf, 0xce, 0x1, 0xaa,
-    0xef, 0xf3, 0x80, 0x7f, 0xfb, 0xa7, 0x33, 0xff,
-    0x81, 0x20,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff,
 
     /* U+4E0A "上" */
-    0x0, 0xfa, 0xc0, 0x3f, 0xf8, 0x6e, 0x1, 0xff,
-    0xf3, 0x2c, 0xce, 0xa0, 0xf, 0xe2, 0xcc, 0xea,
-    0x0, 0xff, 0xff, 0x80, 0x7e, 0x12, 0x2e, 0x12,
-    0x2f, 0x8, 0x2, 0x23, 0xcf, 0x11, 0xf0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0xfc, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x7f, 0xfe,
 
     /* U+4E0B "下" */
-    0xb, 0xcc, 0xee, 0xcc, 0xf5, 0x80, 0x2f, 0x33,
-    0x97, 0x73, 0x3a, 0xc0, 0x3f, 0xf9, 0xa8, 0x1,
-    0xff, 0xc3, 0xcb, 0x30, 0xf, 0xfe, 0xc, 0x55,
-    0x2c, 0x80, 0x3f, 0xf8, 0x3, 0x31, 0xcc, 0x1,
-    0xff, 0xc1, 0x3c, 0x30, 0xf, 0xfe, 0x1a, 0x80,
-    0x7f, 0xfb, 0x44, 0x3, 0xf0,
+    0x7f, 0xfe, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0xc0, 0x1, 0x30, 0x1, 0x8, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0,
 
     /* U+4E0D "不" */
-    0x8c, 0xcf, 0x6f, 0x66, 0x68, 0x8, 0xcc, 0xf0,
-    0xee, 0x66, 0x80, 0xf, 0x9d, 0xc, 0x3, 0xfe,
-    0x58, 0xe0, 0xf, 0xf9, 0x26, 0x1, 0xe8, 0x40,
-    0x3e, 0x58, 0xd1, 0x7, 0x9d, 0x40, 0xe, 0x8e,
-    0xc1, 0x0, 0x8f, 0x3a, 0x0, 0x7, 0x9f, 0x60,
-    0x1f, 0x57, 0xd8, 0x5f, 0x38, 0x7, 0xf3, 0xc0,
-    0x41, 0x0, 0x7f, 0xc6, 0x1, 0xff, 0xda, 0x30,
-    0xf, 0x80,
+    0xff, 0xfc, 0x2, 0x0, 0x4, 0x0, 0x10, 0x0,
+    0x44, 0x1, 0x4, 0xc, 0x6, 0x20, 0x2, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
 
     /* U+4E14 "且" */
-    0x0, 0x93, 0x73, 0x3e, 0x60, 0xf, 0x1c, 0xe6,
-    0x7b, 0xbc, 0x3, 0xff, 0xb7, 0xf3, 0x3e, 0x80,
-    0xf, 0xdb, 0x77, 0xee, 0x0, 0xfc, 0x45, 0xf3,
-    0x0, 0x7f, 0xf3, 0x4, 0x7f, 0x0, 0x7e, 0x9b,
-    0xbf, 0x40, 0x7, 0xe8, 0xaa, 0xf4, 0x80, 0x7f,
-    0xf2, 0x87, 0xc4, 0x7f, 0x18, 0x80, 0x55, 0x43,
-    0xea, 0xaf, 0x40, 0xd5, 0x0,
+    0xf, 0xf0, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0xf, 0xf8, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0x0, 0x8, 0xf, 0xf8, 0x0, 0x8, 0x0, 0x8,
+    0x10, 0x8, 0x7f, 0xfe,
 
     /* U+4E16 "世" */
-    0x0, 0xa4, 0x40, 0xc, 0x80, 0x1, 0x90, 0xf,
-    0x18, 0x6, 0x10, 0x1, 0x98, 0x3, 0xff, 0x96,
-    0x60, 0x1, 0x0, 0xfe, 0xbb, 0x27, 0x5d, 0xaa,
-    0x2e, 0xdc, 0x97, 0x60, 0x5, 0xd9, 0x36, 0xee,
-    0x8b, 0xb7, 0x25, 0xd8, 0x3, 0xff, 0xbb, 0x17,
-    0x6e, 0x0, 0xff, 0xe0, 0x45, 0xdb, 0x48, 0x3,
-    0xfc, 0xca, 0x0, 0x18, 0x0, 0xff, 0xe5, 0xee,
-    0x67, 0xf3, 0x0, 0x63, 0xdc, 0xcf, 0xe6, 0x0,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x7f, 0xfe, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0xf8, 0x10, 0x8, 0x10, 0x0, 0x10, 0x0,
+    0x1f, 0xfc, 0x10, 0x0,
 
     /* U+4E24 "两" */
-    0xac, 0xcb, 0xb7, 0x31, 0xba, 0xcc, 0xaa, 0x99,
-    0x93, 0x4e, 0x62, 0xed, 0x99, 0x50, 0x7, 0xff,
-    0x8, 0x6e, 0xe6, 0x8b, 0xbf, 0x84, 0x8e, 0xec,
-    0xfd, 0x76, 0xa9, 0xbb, 0x62, 0xb8, 0x4, 0x46,
-    0x0, 0xe0, 0xf, 0xe6, 0xb0, 0x2, 0xf8, 0x7,
-    0xc9, 0x5a, 0xa4, 0xb1, 0x40, 0x1e, 0xf6, 0x70,
-    0x8a, 0x3d, 0x50, 0xc, 0xfa, 0x20, 0x3, 0x30,
-    0x3e, 0x0, 0x62, 0x60, 0x0, 0xc8, 0x5, 0x20,
-    0x19, 0x40, 0x24, 0x0, 0xf9, 0xfc, 0x3, 0xe2,
-    0xcc, 0x5a, 0x80,
+    0xff, 0xfc, 0x20, 0x0, 0x80, 0x1f, 0xfe, 0x48,
+    0x1, 0x22, 0x4, 0xcc, 0x10, 0x28, 0x51, 0x1,
+    0x4, 0x44, 0x0, 0x10, 0x0, 0x0, 0x38,
 
     /* U+4E2A "个" */
-    0x0, 0xf1, 0x6b, 0x80, 0x7f, 0xf0, 0x7, 0xbf,
-    0x98, 0x3, 0xfc, 0x3b, 0xe5, 0x3e, 0xe0, 0x1f,
-    0x8b, 0x7c, 0xc0, 0x13, 0xf2, 0x1, 0xe4, 0xee,
-    0x18, 0x10, 0x2, 0x33, 0x4, 0x0, 0x1a, 0xdc,
-    0x20, 0x4, 0x8, 0x1, 0x7a, 0x64, 0x9, 0xd2,
-    0x1, 0xc6, 0x1, 0x15, 0xe0, 0xaa, 0x0, 0x7f,
-    0xf0, 0x14, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfc,
-    0x3, 0x30, 0x7, 0xc0,
+    0x1, 0x0, 0x2, 0x80, 0x4, 0x40, 0x8, 0x30,
+    0x10, 0x8, 0x61, 0x6, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0,
 
     /* U+4E2D "中" */
-    0x0, 0xfa, 0xc0, 0x3f, 0xf8, 0x2e, 0x1, 0xf4,
-    0x55, 0x71, 0x55, 0x73, 0x11, 0x22, 0x38, 0xe2,
-    0x3a, 0x80, 0x4, 0x5c, 0x24, 0x5c, 0x1, 0xff,
-    0xe0, 0x4c, 0xce, 0x3c, 0xce, 0x23, 0x9c, 0xce,
-    0x3c, 0xce, 0x61, 0x70, 0xf, 0xfa, 0x0, 0x3f,
-    0xfa, 0xee, 0x1, 0xe0,
+    0x1, 0x0, 0x4, 0x7, 0xff, 0x90, 0x41, 0x41,
+    0x5, 0x4, 0x14, 0x10, 0x50, 0x41, 0x7f, 0xfc,
+    0x4, 0x10, 0x10, 0x0, 0x40, 0x1, 0x0, 0x4,
+    0x0,
 
     /* U+4E3B "主" */
-    0x0, 0xf2, 0xc8, 0x7, 0xff, 0x9, 0x72, 0xc0,
-    0x3f, 0xf8, 0x4b, 0xcc, 0x1, 0xf0, 0xde, 0x66,
-    0xd8, 0xac, 0xca, 0xc8, 0x0, 0x37, 0x99, 0xae,
-    0xd9, 0x9a, 0xc8, 0x3, 0xff, 0xb0, 0x23, 0xfe,
-    0x0, 0xe4, 0xbb, 0xff, 0x30, 0x6, 0x4a, 0xaf,
-    0xf3, 0x0, 0x7f, 0xf9, 0xef, 0x33, 0xae, 0xd9,
-    0x9d, 0x60,
+    0x1, 0x0, 0x0, 0x80, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+4E48 "么" */
-    0x0, 0xff, 0xe3, 0xac, 0x0, 0x7f, 0xc3, 0x30,
-    0x1, 0xff, 0x6f, 0x80, 0x7f, 0xd7, 0x6, 0x0,
-    0x30, 0xf, 0xaf, 0x90, 0x0, 0xb4, 0x1, 0xc3,
-    0x9c, 0xa0, 0x14, 0x40, 0x3, 0xa3, 0xd4, 0x2,
-    0x8b, 0x10, 0xe, 0x93, 0x0, 0x89, 0x18, 0x3,
-    0xfe, 0x9e, 0x0, 0x50, 0x80, 0x7c, 0xd8, 0x40,
-    0x9, 0xa0, 0xf, 0x16, 0xb8, 0x4, 0x7f, 0x40,
-    0x1d, 0xd2, 0x1, 0x9, 0x38, 0x30, 0x2, 0xb4,
-    0xbb, 0x31, 0x77, 0xb7, 0x44, 0x17, 0xbd, 0x99,
-    0x5d, 0x4c, 0x3c, 0x50,
+    0x0, 0x0, 0x8, 0x0, 0x40, 0x2, 0x0, 0x10,
+    0x0, 0x82, 0x4, 0x10, 0x20, 0x80, 0x2, 0x0,
+    0x11, 0x0, 0x2, 0x2, 0x4, 0x10, 0x11, 0xff,
+    0xa0, 0x0, 0x40,
 
     /* U+4E4B "之" */
-    0x0, 0xfa, 0x44, 0x3, 0xff, 0x82, 0x66, 0x0,
-    0xff, 0xe5, 0x2e, 0x67, 0x37, 0x66, 0x5b, 0x80,
-    0x5, 0xcc, 0xff, 0x37, 0x80, 0x7f, 0xf0, 0x27,
-    0xc, 0x3, 0xfe, 0x70, 0x70, 0xf, 0xf9, 0xb6,
-    0x40, 0x3c, 0x80, 0x19, 0xb2, 0x80, 0x3c, 0x30,
-    0x1, 0x47, 0x50, 0x7, 0xd0, 0x20, 0x37, 0xd0,
-    0x1, 0xf1, 0x12, 0x6f, 0x65, 0x80, 0x3f, 0x4c,
-    0x27, 0x3, 0x88, 0x7, 0xc8, 0x46, 0xb, 0xa5,
-    0x79, 0x9e, 0x94, 0x90, 0x8, 0x5e, 0xb3, 0x3d,
-    0x20,
+    0x1, 0x0, 0x2, 0x0, 0x4, 0x1, 0xff, 0xe0,
+    0x0, 0x80, 0x2, 0x0, 0x4, 0x0, 0x10, 0x0,
+    0x40, 0x23, 0x0, 0xc8, 0x1, 0x60, 0x4, 0x40,
+    0x8, 0x3f, 0xc0, 0x0, 0x0,
 
     /* U+4E5D "九" */
-    0x0, 0xf5, 0x80, 0x7f, 0xf0, 0xdc, 0x3, 0xff,
-    0xbc, 0xb9, 0x98, 0xf3, 0x34, 0x80, 0x72, 0xe6,
-    0x5c, 0xb9, 0x99, 0x40, 0x3f, 0x98, 0x80, 0x3f,
-    0xf8, 0x59, 0xa0, 0x1f, 0xfc, 0x24, 0x40, 0x7,
-    0xff, 0x4, 0x9c, 0x40, 0x3f, 0xf8, 0x31, 0xe0,
-    0x1f, 0xfc, 0x16, 0x4, 0x0, 0xfe, 0x80, 0x3,
-    0x6d, 0x0, 0x7f, 0x9, 0x5, 0x8d, 0x80, 0x7c,
-    0xf9, 0x8d, 0xf0, 0xb7, 0x0, 0xfd, 0x79, 0x92,
-    0x80,
+    0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x2, 0x0,
+    0x3f, 0xf0, 0x2, 0x10, 0x2, 0x10, 0x4, 0x10,
+    0x4, 0x10, 0x4, 0x10, 0x8, 0x10, 0x8, 0x11,
+    0x10, 0x11, 0x40, 0x1e, 0x0, 0x0,
 
     /* U+4E5F "也" */
-    0x0, 0xa0, 0x40, 0x2a, 0x0, 0xfe, 0x13, 0x0,
-    0x98, 0x3, 0x8, 0x7, 0xfc, 0x71, 0x9a, 0x1,
-    0xf9, 0xb, 0x6b, 0x30, 0xe0, 0x1c, 0x93, 0x9a,
-    0x5b, 0x28, 0x1, 0x92, 0x5f, 0xeb, 0x24, 0x3,
-    0x8, 0x81, 0x32, 0x9e, 0xcc, 0x3, 0xc6, 0x60,
-    0x48, 0x30, 0xf, 0xe6, 0xe0, 0xf, 0xfe, 0xe,
-    0x20, 0x7, 0xfd, 0x56, 0x6, 0x1, 0xfc, 0xe1,
-    0x57, 0x0, 0xa0, 0x1f, 0xac, 0x3, 0xa4, 0x2,
-    0xe6, 0x0, 0xfc, 0x6a, 0x1, 0x37, 0xdd, 0xfe,
-    0x8b,
+    0x10, 0x80, 0x21, 0x0, 0x42, 0x70, 0x87, 0x21,
+    0x78, 0x47, 0x10, 0x94, 0x21, 0x8, 0x40, 0x10,
+    0x88, 0x21, 0x70, 0x42, 0x0, 0x80, 0x10, 0x0,
+    0x21, 0xff, 0x80,
 
     /* U+4E86 "了" */
-    0x0, 0xff, 0xe0, 0x9e, 0x67, 0xfb, 0xac, 0xf3,
-    0x3f, 0xa0, 0xa8, 0x3, 0xf9, 0xfb, 0x4, 0x3,
-    0xe2, 0xb1, 0xa0, 0xf, 0xc9, 0x32, 0x60, 0xf,
-    0xe2, 0xd2, 0x0, 0xff, 0xff, 0x80, 0x7f, 0x9a,
-    0xed, 0x4a, 0x1, 0xc0,
+    0x0, 0x3, 0xff, 0xc0, 0x4, 0x0, 0x40, 0x8,
+    0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
 
     /* U+4E89 "争" */
-    0x0, 0xea, 0x10, 0xf, 0xfe, 0xc, 0xd, 0x5d,
-    0xb5, 0x80, 0x3f, 0x47, 0x5d, 0xd2, 0x2c, 0x1,
-    0xe1, 0xbe, 0x60, 0x0, 0xf7, 0x0, 0x3e, 0x4f,
-    0xcb, 0xbb, 0x2, 0x6e, 0xd8, 0xa0, 0x12, 0xa5,
-    0x5d, 0xd5, 0x17, 0x74, 0x68, 0x4, 0x23, 0xef,
-    0x11, 0xe0, 0x10, 0x1b, 0xbf, 0x2f, 0x5d, 0xdc,
-    0xb6, 0x22, 0xaa, 0xfb, 0xea, 0xaf, 0x5a, 0x10,
-    0x8, 0x47, 0x78, 0x8f, 0x0, 0x73, 0x5d, 0xe5,
-    0xeb, 0xbb, 0x80, 0x39, 0xaa, 0xbb, 0xea, 0xb8,
-    0x3, 0xff, 0x84, 0x24, 0x1, 0xe2, 0xbb, 0x94,
-    0x3, 0xe0,
+    0x4, 0x0, 0xf, 0xc0, 0x10, 0x40, 0x20, 0x80,
+    0x1f, 0xf8, 0x0, 0x4, 0x1, 0x4, 0x7f, 0xfe,
+    0x0, 0x4, 0x1, 0x4, 0x1f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0x0,
 
     /* U+4E8B "事" */
-    0x0, 0xf9, 0x90, 0x3, 0xf3, 0xd5, 0x75, 0xc5,
-    0x57, 0x40, 0x1, 0xea, 0xbd, 0x35, 0x5d, 0x0,
-    0x1b, 0x2a, 0xab, 0x9a, 0xab, 0x8, 0x3, 0x12,
-    0xd5, 0x57, 0x35, 0x55, 0xb0, 0x6, 0x21, 0x99,
-    0xaf, 0xa6, 0x6f, 0x40, 0xe, 0x89, 0x9a, 0xfa,
-    0x66, 0x80, 0xe, 0x5a, 0xad, 0x73, 0x55, 0x5a,
-    0x80, 0x65, 0xaa, 0xd7, 0x35, 0x57, 0xe8, 0x5,
-    0x55, 0xf4, 0xd5, 0x50, 0xb4, 0x0, 0xaa, 0xfa,
-    0x6a, 0xa8, 0x5a, 0x0, 0x9e, 0xab, 0x5c, 0xd5,
-    0x5e, 0x1, 0xcf, 0x55, 0xae, 0x6a, 0xb8, 0x3,
-    0xe9, 0xab, 0x70, 0x8, 0x48, 0x0,
+    0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x1f, 0xf8,
+    0x10, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x4, 0x7f, 0xfe, 0x0, 0x4, 0x1f, 0xfc,
+    0x0, 0x0, 0x7, 0x0,
 
     /* U+4E8C "二" */
-    0x0, 0x88, 0xbf, 0xc0, 0x1c, 0xd1, 0x1f, 0xe6,
-    0x0, 0xcd, 0x55, 0xfe, 0x60, 0xf, 0xff, 0xf8,
-    0x7, 0xff, 0x73, 0x37, 0x7f, 0xf8, 0x18, 0x0,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
 
     /* U+4E8E "于" */
-    0x0, 0x56, 0x66, 0xde, 0xcc, 0xd4, 0x1, 0xab,
-    0x33, 0x4b, 0x66, 0x6a, 0x0, 0xff, 0xf3, 0xde,
-    0x67, 0x4b, 0x66, 0x75, 0x80, 0x2f, 0x33, 0xa5,
-    0xb3, 0x3a, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xe4,
-    0xcc, 0x46, 0x0, 0x7c,
+    0x3f, 0xfc, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x7f, 0xfe, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x7, 0x0,
 
     /* U+4E94 "五" */
-    0x0, 0x56, 0x67, 0xfa, 0x40, 0x35, 0x66, 0x53,
-    0x79, 0x9d, 0x20, 0x1f, 0xb4, 0xc0, 0x3f, 0xf8,
-    0x46, 0xa0, 0x1f, 0xfc, 0x27, 0x10, 0xf, 0xf1,
-    0x66, 0x45, 0x99, 0xb4, 0xc0, 0x38, 0xb3, 0x10,
-    0xd9, 0x9a, 0x98, 0x3, 0xf1, 0xe0, 0x7, 0xff,
-    0xb, 0x14, 0x3, 0xff, 0x84, 0xe2, 0x1, 0xff,
-    0xc1, 0x26, 0x0, 0xff, 0xaf, 0x31, 0xe9, 0x99,
-    0xd5, 0x19, 0x60,
+    0x3f, 0xfc, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0,
+    0x2, 0x0, 0x1f, 0xf0, 0x2, 0x0, 0x0, 0x0,
+    0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x7f, 0xfe,
 
     /* U+4E9B "些" */
-    0x0, 0xd0, 0x40, 0x1, 0x90, 0xf, 0xc4, 0x2,
-    0x1, 0x8c, 0x0, 0x2a, 0x1, 0xc, 0x0, 0x22,
-    0x5c, 0x5, 0xaf, 0xc, 0x3, 0xee, 0xb6, 0x4,
-    0xcf, 0xd6, 0x0, 0xf9, 0x88, 0x41, 0x69, 0x0,
-    0x2, 0x1, 0xff, 0xc3, 0x82, 0x0, 0xe7, 0x46,
-    0x1, 0x0, 0xc4, 0x40, 0xb4, 0xb2, 0xc2, 0x20,
-    0x9d, 0xde, 0xd0, 0x5, 0xf5, 0xda, 0x59, 0x2,
-    0x2e, 0xf3, 0x0, 0x4, 0x57, 0x99, 0xfc, 0x80,
-    0x18, 0x6f, 0x33, 0xf9, 0x0, 0x3f, 0xfa, 0xf5,
-    0x99, 0xff, 0xc0, 0xa0,
+    0x8, 0x40, 0x8, 0x40, 0x2e, 0x58, 0x28, 0x60,
+    0x28, 0x40, 0x28, 0x42, 0x28, 0x42, 0x7c, 0x7c,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+4EAE "亮" */
-    0x0, 0xf9, 0x94, 0x3, 0xf4, 0xdd, 0xf5, 0x4d,
-    0xdf, 0x48, 0x2, 0x6e, 0xfb, 0x31, 0x77, 0xd2,
-    0x1, 0xa2, 0x67, 0xf8, 0x3, 0xc7, 0x33, 0xf9,
-    0x40, 0x3c, 0x75, 0x5f, 0x94, 0x3, 0xd1, 0x55,
-    0xfa, 0x40, 0x32, 0x55, 0x7f, 0xf0, 0x10, 0x1,
-    0xd7, 0x55, 0xff, 0x78, 0x7, 0xa8, 0x40, 0x12,
-    0x40, 0x1e, 0xa1, 0x0, 0x30, 0x80, 0x7d, 0x60,
-    0x1c, 0xc8, 0x1, 0xf9, 0x0, 0x33, 0xec, 0x0,
-    0x7e, 0xf0, 0x5, 0x50, 0xac, 0x3, 0x7c, 0xd5,
-    0x44, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x1f, 0xf8,
+    0x10, 0x8, 0x1f, 0xf8, 0x0, 0x0, 0x3f, 0xfc,
+    0x40, 0x2, 0x44, 0x42, 0x4, 0x40, 0x4, 0x40,
+    0x8, 0x42, 0x60, 0x3e,
 
     /* U+4EBA "人" */
-    0x0, 0xf9, 0xcc, 0x3, 0xff, 0x85, 0xac, 0x1,
-    0xff, 0xc2, 0x12, 0x0, 0xff, 0xe1, 0x36, 0x80,
-    0x7f, 0xf0, 0x85, 0x80, 0x3f, 0xf8, 0x28, 0xaa,
-    0x20, 0xf, 0xfe, 0x6, 0xed, 0x40, 0x1f, 0xfc,
-    0x4, 0x4c, 0x1, 0xff, 0x32, 0x80, 0x2d, 0xc0,
-    0x3f, 0x86, 0xe4, 0x0, 0xf4, 0x20, 0x1f, 0xae,
-    0x4, 0x2, 0x8a, 0x0, 0xfa, 0xd, 0x40, 0x32,
-    0x9c, 0x80, 0x61, 0xa1, 0x90, 0xf, 0x40, 0xe1,
-    0x0, 0x37, 0xe4, 0x3, 0xf4, 0x4f, 0x88,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x80,
+    0x1, 0x80, 0x1, 0x80, 0x2, 0x40, 0x2, 0x40,
+    0x2, 0x0, 0x4, 0x20, 0x8, 0x10, 0x18, 0x18,
+    0x30, 0xc, 0x40, 0x2,
 
     /* U+4EC0 "什" */
-    0x0, 0xe1, 0x0, 0xff, 0xe1, 0x33, 0x80, 0x43,
-    0x20, 0x1f, 0xd4, 0xc0, 0x11, 0x98, 0x3, 0xf3,
-    0x58, 0x7, 0xff, 0x4, 0x61, 0xc0, 0x3f, 0xf8,
-    0x36, 0x1, 0xff, 0xc2, 0x82, 0x20, 0x46, 0x65,
-    0xc9, 0x99, 0x58, 0x80, 0xc0, 0x2, 0x33, 0x2e,
-    0x4c, 0xca, 0xc4, 0x24, 0x3, 0xff, 0xfe, 0x1,
-    0xff, 0xca, 0x60, 0xe, 0x33, 0x0, 0x7e, 0xa0,
-    0xe, 0x19, 0x0, 0xe0,
+    0x0, 0x0, 0x0, 0x20, 0x8, 0x20, 0x0, 0x20,
+    0x10, 0x20, 0x30, 0x20, 0x77, 0xfe, 0x50, 0x20,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x0, 0x0,
 
     /* U+4ECA "今" */
-    0x0, 0xf4, 0xd8, 0x7, 0xff, 0x1, 0x83, 0xe8,
-    0x3, 0xfc, 0x9b, 0x29, 0x94, 0x1, 0xf9, 0x3e,
-    0xc0, 0xd, 0xf6, 0x1, 0xe6, 0xfb, 0x0, 0xcb,
-    0xf8, 0x40, 0x14, 0xfc, 0xdd, 0xf8, 0xfb, 0x8e,
-    0x15, 0xb2, 0x57, 0x7e, 0x72, 0xc0, 0x2a, 0x40,
-    0xf, 0xf9, 0xc8, 0xa, 0xef, 0xfb, 0xc4, 0x2,
-    0x2b, 0xbf, 0xd2, 0xa2, 0x1, 0xff, 0xc0, 0x88,
-    0x0, 0x7f, 0xf0, 0x8, 0x8, 0x3, 0xff, 0x81,
-    0x12, 0x1, 0xff, 0xc0, 0x21, 0x30, 0xf, 0xfe,
-    0x1, 0xd0, 0x7, 0x0,
+    0x3, 0x0, 0x5, 0x0, 0x11, 0x0, 0x41, 0x1,
+    0x1, 0xd, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x3f,
+    0xf0, 0x0, 0x20, 0x0, 0x80, 0x1, 0x0, 0x4,
+    0x0, 0x8, 0x0, 0x0, 0x0,
 
     /* U+4ECE "从" */
-    0x0, 0xd4, 0x1, 0xd6, 0x1, 0xfc, 0xc0, 0x1c,
-    0xe0, 0x1f, 0xfd, 0x22, 0x20, 0x7, 0xf3, 0x80,
-    0x66, 0x10, 0xf, 0xc6, 0x20, 0x18, 0x88, 0x60,
-    0x1f, 0x32, 0x10, 0x5, 0x96, 0x80, 0x1f, 0x6d,
-    0xf0, 0x4, 0xed, 0x80, 0x1f, 0x1a, 0xcc, 0x80,
-    0xd0, 0x4, 0x40, 0x1f, 0x94, 0xcd, 0x34, 0x1c,
-    0xc0, 0x1c, 0xda, 0x0, 0xa0, 0x13, 0x4, 0xb1,
-    0x0, 0xd4, 0xc0, 0x1, 0xf9, 0x0, 0xa6, 0x0,
-    0x26, 0x40, 0x0, 0xd4, 0x90, 0x4, 0xa6, 0xe0,
-    0xa, 0x80, 0x5, 0x7a, 0x80, 0x75, 0x68, 0x80,
+    0x8, 0x20, 0x8, 0x20, 0x8, 0x20, 0x8, 0x20,
+    0x8, 0x20, 0x8, 0x20, 0x8, 0x40, 0x14, 0x50,
+    0x12, 0x50, 0x12, 0x80, 0x0, 0x88, 0x21, 0x4,
+    0x22, 0x4, 0x44, 0x2,
 
     /* U+4ED6 "他" */
-    0x0, 0xff, 0xe4, 0x49, 0x0, 0x6a, 0x0, 0xfc,
-    0x26, 0x40, 0xa0, 0x1, 0x0, 0xfd, 0x12, 0x5,
-    0xe0, 0x1e, 0x30, 0x8, 0xd4, 0xc0, 0x3c, 0x73,
-    0x70, 0x1, 0x7b, 0x80, 0x61, 0x65, 0xaa, 0x58,
-    0x5, 0x50, 0x1, 0x3a, 0x51, 0x94, 0x98, 0x4,
-    0x58, 0x80, 0xb, 0xc4, 0xb5, 0x70, 0xe, 0x26,
-    0x0, 0xae, 0xc0, 0x1e, 0x11, 0x0, 0x7f, 0xf0,
-    0x88, 0xc0, 0x3f, 0xf8, 0x35, 0xf4, 0x1, 0xff,
-    0xc1, 0xac, 0x30, 0xf, 0xfa, 0xc0, 0x21, 0x80,
-    0xf, 0x18, 0x80, 0x79, 0x40, 0x30, 0x80, 0x4,
-    0xae, 0xfd, 0x14,
+    0x0, 0x0, 0x8, 0x20, 0x8, 0x20, 0x11, 0x20,
+    0x11, 0x2e, 0x31, 0x32, 0x51, 0xa2, 0x17, 0x22,
+    0x11, 0x22, 0x11, 0x22, 0x11, 0x2c, 0x11, 0x20,
+    0x11, 0x1, 0x11, 0x1, 0x11, 0xfe,
 
     /* U+4EE3 "代" */
-    0x0, 0xe1, 0x0, 0xff, 0xe1, 0x24, 0x80, 0x56,
-    0x9, 0x20, 0x1f, 0x7c, 0x80, 0x72, 0x6d, 0x80,
-    0x73, 0x68, 0x80, 0x79, 0x21, 0x40, 0x22, 0x96,
-    0x0, 0xfc, 0x68, 0x1, 0x70, 0x80, 0x9a, 0x33,
-    0x2a, 0xee, 0x90, 0x5, 0xc1, 0x4, 0x59, 0x11,
-    0xe6, 0xee, 0x80, 0x5e, 0x40, 0x4, 0xc3, 0x26,
-    0xb0, 0x7, 0x2a, 0x80, 0x3e, 0x3d, 0x0, 0xff,
-    0xe1, 0x29, 0x80, 0x7f, 0xf0, 0x85, 0xc0, 0x3f,
-    0xf8, 0x76, 0xa0, 0x2, 0x20, 0x7, 0xf9, 0xa4,
-    0x0, 0x82, 0x1, 0xfe, 0x14, 0x80, 0xc3, 0x0,
-    0x9c, 0x3, 0xe8, 0xe, 0x30, 0xd, 0x60, 0x1f,
-    0xa3, 0xa4, 0x0,
+    0x0, 0x0, 0x4, 0x48, 0x8, 0x44, 0x0, 0x40,
+    0x10, 0x40, 0x30, 0x7e, 0x56, 0x40, 0x10, 0x0,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x0,
+    0x10, 0x10, 0x10, 0x1a, 0x10, 0xe, 0x0, 0x0,
 
     /* U+4EE4 "令" */
-    0x0, 0xf5, 0x58, 0x80, 0x7f, 0xd3, 0x91, 0x42,
-    0x1, 0xfd, 0x3e, 0xc7, 0x1a, 0x40, 0x1e, 0x1b,
-    0xc6, 0x0, 0x1e, 0xcb, 0x0, 0x65, 0xaf, 0xeb,
-    0xbd, 0x5c, 0x36, 0x41, 0x45, 0x69, 0x77, 0xe5,
-    0x79, 0x91, 0x53, 0x80, 0x7f, 0x8a, 0xc8, 0x1e,
-    0xef, 0xfc, 0x40, 0x13, 0xdd, 0xd0, 0x57, 0x7b,
-    0xd4, 0x3, 0xff, 0xd8, 0xb5, 0x6, 0x1, 0xf0,
-    0x88, 0x0, 0xb5, 0x88, 0x0,
+    0x3, 0x0, 0x9, 0x0, 0x21, 0x0, 0x81, 0x2,
+    0xfc, 0x90, 0x0, 0x80, 0x0, 0x1f, 0xf8, 0x2,
+    0x0, 0x4, 0x0, 0x8, 0x0, 0x10, 0x0, 0x23,
+    0x0, 0x40, 0x0,
 
     /* U+4EE5 "以" */
-    0x0, 0xc, 0x80, 0x7e, 0x37, 0x0, 0xe2, 0x0,
-    0x30, 0x7, 0x28, 0x80, 0x61, 0x0, 0x8e, 0x40,
-    0x37, 0x10, 0x7, 0xe5, 0x4, 0x0, 0x8d, 0x40,
-    0x3f, 0xa2, 0x0, 0x13, 0x88, 0x7, 0x38, 0x4,
-    0x3c, 0x0, 0x36, 0x0, 0xff, 0x88, 0x1, 0x7e,
-    0x1, 0xff, 0xc2, 0x45, 0x0, 0xff, 0x8, 0x1,
-    0x54, 0x1, 0xf8, 0x63, 0x14, 0x6, 0x54, 0xc0,
-    0x38, 0x89, 0xba, 0xc4, 0xd, 0xfd, 0xf2, 0x0,
-    0xae, 0x77, 0x14, 0x7, 0x20, 0xc7, 0xbc, 0x40,
-    0x15, 0x66, 0x0, 0x7d, 0xf4, 0x0, 0x17, 0x68,
-    0x0, 0x40, 0x3, 0xa1, 0x86, 0x1, 0x8e, 0x50,
+    0x10, 0x0, 0x10, 0x0, 0x11, 0x8, 0x11, 0x8,
+    0x10, 0x88, 0x10, 0x8, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x16, 0x30, 0x18, 0x48, 0x60, 0x84,
+    0x1, 0x2, 0x4, 0x0,
 
     /* U+4EF6 "件" */
-    0x0, 0xff, 0xe4, 0x49, 0x2, 0x0, 0x24, 0x3,
-    0xf0, 0x91, 0x7, 0x80, 0x48, 0x3, 0xf4, 0xf8,
-    0x26, 0x0, 0x7f, 0x89, 0x10, 0x19, 0x59, 0xab,
-    0x99, 0x28, 0x5, 0x20, 0x11, 0x66, 0x35, 0x73,
-    0x25, 0x0, 0x3e, 0x0, 0x23, 0x80, 0x3f, 0xda,
-    0xe0, 0xa, 0x50, 0xf, 0xf5, 0x0, 0x44, 0x1,
-    0xff, 0xc3, 0x8c, 0xcb, 0x57, 0x32, 0xb1, 0x0,
-    0xe8, 0xcc, 0xb5, 0x73, 0x2b, 0x10, 0xf, 0xff,
-    0x3b, 0x0, 0x70, 0x88, 0x3, 0xf5, 0x0, 0x7a,
-    0x80, 0x38,
+    0x0, 0x0, 0x8, 0x20, 0x9, 0x20, 0x10, 0x20,
+    0x13, 0xfc, 0x32, 0x20, 0x14, 0x20, 0x50, 0x20,
+    0x10, 0x20, 0x17, 0xfe, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x0, 0x0,
 
     /* U+4EFB "任" */
-    0x0, 0xc2, 0x80, 0x1f, 0xfc, 0x29, 0x0, 0xe3,
-    0x6a, 0xc1, 0x0, 0xc2, 0x6e, 0xea, 0xbd, 0xf3,
-    0xbc, 0x10, 0xd, 0x10, 0x14, 0xbb, 0x4d, 0xa8,
-    0x80, 0x72, 0x39, 0x91, 0x88, 0x7, 0xf0, 0xc1,
-    0x80, 0x7f, 0xf0, 0x7, 0x3c, 0x40, 0x3f, 0xf8,
-    0x5, 0x26, 0x3, 0x35, 0x57, 0xd5, 0x69, 0x23,
-    0x40, 0x0, 0xc4, 0x6d, 0x58, 0x8c, 0x40, 0x1c,
-    0x24, 0x5b, 0xc8, 0xa1, 0x0, 0xff, 0xfc, 0x30,
-    0x35, 0xdd, 0x35, 0x77, 0x50, 0x0,
+    0x0, 0x0, 0x8, 0xc, 0x9, 0xe0, 0x10, 0x0,
+    0x10, 0x0, 0x30, 0x0, 0x50, 0x0, 0x17, 0xfe,
+    0x10, 0x20, 0x10, 0x0, 0x10, 0x0, 0x10, 0x0,
+    0x10, 0x0, 0x10, 0x0, 0x13, 0xfe,
 
     /* U+4F17 "众" */
-    0x0, 0xfb, 0x28, 0x3, 0xff, 0x83, 0x53, 0xb2,
-    0x1, 0xff, 0x4e, 0xab, 0x8c, 0x80, 0x7f, 0x57,
-    0x38, 0x2, 0x3a, 0xc4, 0x3, 0x8f, 0x39, 0xc0,
-    0x33, 0xfe, 0x28, 0x5, 0x31, 0xca, 0x1, 0xc2,
-    0x99, 0x90, 0x86, 0xd9, 0x41, 0x80, 0x6b, 0x31,
-    0x9e, 0x10, 0x40, 0x2, 0x98, 0x6, 0x71, 0x0,
-    0x10, 0x7, 0x19, 0x80, 0x21, 0x25, 0x0, 0xf9,
-    0x5b, 0xd4, 0x0, 0xd1, 0x60, 0x1f, 0x75, 0xe7,
-    0x28, 0x5b, 0x5b, 0x0, 0x72, 0x9, 0x5, 0x9b,
-    0xd8, 0xbd, 0x10, 0x4, 0x51, 0x60, 0x11, 0x63,
-    0x80, 0x3b, 0x84, 0x0, 0xef, 0x10, 0x1, 0x45,
-    0x0, 0x45, 0xdc, 0x0, 0x61, 0x80, 0x45, 0x82,
-    0x1, 0x8b, 0x0,
+    0x1, 0x80, 0x2, 0x40, 0x4, 0x60, 0x8, 0x10,
+    0x10, 0x8, 0x60, 0x6, 0x8, 0x20, 0x8, 0x20,
+    0x8, 0x20, 0xc, 0x10, 0x12, 0x40, 0x10, 0x8,
+    0x20, 0x84, 0x41, 0x2, 0x0, 0x0,
 
     /* U+4F1A "会" */
-    0x0, 0xfb, 0x24, 0x3, 0xff, 0x83, 0x53, 0xd0,
-    0x1, 0xff, 0x4e, 0xab, 0x84, 0x80, 0x7f, 0x57,
-    0xb8, 0x2, 0x3e, 0xc4, 0x3, 0x8f, 0x39, 0xc4,
-    0x73, 0xfe, 0xa8, 0x5, 0x32, 0xdc, 0xbb, 0xf1,
-    0xe6, 0xe0, 0x85, 0x50, 0x62, 0xab, 0xce, 0x11,
-    0xa2, 0x6, 0x1, 0xff, 0xc0, 0x10, 0x2, 0xdd,
-    0xef, 0xbb, 0xf9, 0x80, 0xb, 0x77, 0x6b, 0xdd,
-    0xfc, 0xc0, 0x1e, 0xa9, 0x0, 0xad, 0x0, 0x3f,
-    0x2a, 0x8, 0x5, 0x7e, 0xa0, 0x1e, 0x19, 0xb2,
-    0x33, 0x22, 0xed, 0x20, 0x4, 0x57, 0x4d, 0x57,
-    0x64, 0x33, 0xaa, 0x0, 0x0,
+    0x1, 0x80, 0x2, 0x40, 0x4, 0x60, 0x8, 0x10,
+    0x10, 0x8, 0x6f, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x2, 0x0, 0x4, 0x20, 0x4, 0x10,
+    0x8, 0x8, 0x3f, 0x4,
 
     /* U+4F3C "似" */
-    0x0, 0xc6, 0x40, 0x1f, 0xfc, 0x28, 0x3a, 0x0,
-    0xfb, 0x0, 0x32, 0x18, 0xb0, 0x21, 0x80, 0x7f,
-    0x44, 0x80, 0x4b, 0xe0, 0x10, 0xb0, 0x4, 0xee,
-    0x10, 0x8, 0x62, 0x0, 0x2, 0x20, 0x0, 0xf0,
-    0x3, 0xc8, 0x62, 0xb, 0xc0, 0x3f, 0x40, 0x13,
-    0x80, 0x54, 0x21, 0xc4, 0x3, 0xc2, 0x1, 0xf0,
-    0x80, 0xd, 0x0, 0x4, 0x1, 0xfe, 0x10, 0xf,
-    0xfe, 0x0, 0x88, 0x1b, 0x80, 0x3f, 0x9a, 0xac,
-    0xc6, 0x10, 0x3, 0xc3, 0x4c, 0x37, 0x45, 0x51,
-    0x40, 0x1e, 0x19, 0xd7, 0x11, 0x5f, 0xb9, 0xb8,
-    0x7, 0x8c, 0x0, 0xdb, 0x8, 0x11, 0x66, 0x1,
-    0x8, 0x0, 0xf4, 0x30, 0xc0, 0x2e, 0x40, 0xa,
-    0x80, 0x7, 0xac, 0x1, 0xc4, 0xe0,
+    0x0, 0x0, 0xa, 0x2, 0xa, 0x2, 0x12, 0x42,
+    0x12, 0x22, 0x32, 0x20, 0x52, 0x4, 0x12, 0x4,
+    0x12, 0x4, 0x12, 0x0, 0x12, 0xc8, 0x16, 0x14,
+    0x10, 0x24, 0x10, 0x42, 0x11, 0x0, 0x0, 0x0,
 
     /* U+4F46 "但" */
-    0x0, 0xff, 0xe4, 0x42, 0x0, 0x7f, 0xf0, 0x91,
-    0xd, 0x97, 0x7e, 0x0, 0xe8, 0x90, 0xfe, 0xbb,
-    0xe7, 0x0, 0xc4, 0xaa, 0x0, 0xff, 0xe0, 0xf0,
-    0x80, 0x7f, 0xf0, 0x6a, 0x80, 0x1b, 0xae, 0xf8,
-    0x80, 0x4, 0x46, 0x0, 0xdd, 0x77, 0xc4, 0x0,
-    0x28, 0x0, 0xff, 0xec, 0xb1, 0x17, 0x8, 0x7,
-    0xea, 0xdb, 0xbf, 0x0, 0x7e, 0x39, 0x9f, 0x30,
-    0x7, 0xe1, 0x1f, 0xe0, 0xc, 0xe1, 0x57, 0x7f,
-    0xc6,
+    0x0, 0x0, 0x8, 0x0, 0x9, 0xfc, 0x12, 0x4,
+    0x12, 0x4, 0x32, 0x4, 0x53, 0xfc, 0x52, 0x4,
+    0x12, 0x4, 0x12, 0x4, 0x12, 0x4, 0x11, 0xf8,
+    0x10, 0x0, 0x10, 0x0, 0x17, 0xfe,
 
     /* U+4F4D "位" */
-    0x0, 0xff, 0xe4, 0x41, 0x80, 0x4a, 0xa0, 0xf,
-    0xc2, 0x86, 0x1, 0x18, 0x7, 0xf5, 0xc0, 0x7,
-    0xff, 0x5, 0x1d, 0x22, 0xee, 0xde, 0xbb, 0xa8,
-    0x0, 0x50, 0x21, 0x17, 0x7e, 0xaa, 0x80, 0x7b,
-    0x80, 0x12, 0x28, 0x6, 0x64, 0x0, 0x1f, 0x90,
-    0x4, 0xbe, 0x1, 0xb1, 0x0, 0x4, 0x60, 0x18,
-    0x44, 0x1, 0x9c, 0x40, 0x3f, 0x88, 0x40, 0x8,
-    0x80, 0xf, 0xf7, 0x28, 0x3, 0x2c, 0x3, 0xfc,
-    0x66, 0x0, 0x19, 0x80, 0x3f, 0xca, 0x40, 0x66,
-    0x0, 0xfc, 0x33, 0x28, 0xc9, 0xf3, 0x99, 0x8c,
-    0x2, 0x61, 0xbb, 0xee, 0x9b, 0xb8, 0xc0,
+    0x0, 0x0, 0x8, 0x0, 0x8, 0x0, 0x10, 0x0,
+    0x17, 0xfe, 0x30, 0x0, 0x50, 0x0, 0x11, 0x8,
+    0x11, 0x8, 0x11, 0x8, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x17, 0xfe, 0x10, 0x0,
 
     /* U+4F4F "住" */
-    0x0, 0xce, 0x60, 0xb, 0x50, 0xf, 0xf6, 0x18,
-    0x2, 0xca, 0xc4, 0x3, 0xe8, 0xf0, 0xc, 0xf0,
-    0x80, 0x1e, 0x34, 0x42, 0xe6, 0x6d, 0x9c, 0xc5,
-    0x80, 0x5e, 0x0, 0x5c, 0xcb, 0x53, 0x32, 0xb0,
-    0x5, 0xf8, 0x7, 0xff, 0x4, 0xf4, 0xc0, 0x3f,
-    0xf8, 0x26, 0xc0, 0x1a, 0x2a, 0x96, 0x95, 0x52,
-    0x80, 0x7d, 0x37, 0x69, 0x5b, 0xb9, 0x40, 0x3e,
-    0x11, 0x88, 0x47, 0x0, 0x7f, 0xfa, 0x58, 0x2b,
-    0x32, 0xd4, 0xcc, 0xc6,
+    0x0, 0x80, 0x8, 0x20, 0x10, 0x0, 0x13, 0xfe,
+    0x30, 0x20, 0x50, 0x20, 0x10, 0x20, 0x13, 0xfc,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x17, 0xfe,
 
     /* U+4F53 "体" */
-    0x0, 0x84, 0x3, 0xff, 0x85, 0x40, 0x19, 0x54,
-    0x1, 0xf1, 0x10, 0x3, 0x8c, 0x3, 0xeb, 0xb0,
-    0x7, 0xff, 0x0, 0x94, 0xae, 0xfa, 0x2e, 0xf1,
-    0x84, 0xb8, 0x5d, 0xd0, 0x65, 0xf7, 0x71, 0xb9,
-    0x80, 0x74, 0xdd, 0xb8, 0x3, 0x7c, 0x0, 0x63,
-    0x38, 0x48, 0xc0, 0x28, 0x0, 0xe8, 0x80, 0x2,
-    0x60, 0x3, 0xf3, 0x60, 0x80, 0x7, 0x1c, 0x3,
-    0xc7, 0xae, 0x1, 0x9f, 0x10, 0x3, 0x17, 0xc5,
-    0xda, 0x2e, 0xe9, 0x83, 0x0, 0x8f, 0x4e, 0xed,
-    0x17, 0x71, 0x69, 0x80, 0x42, 0x20, 0xf, 0xc2,
-    0x1, 0x8, 0x7, 0x9, 0x80, 0x70,
+    0x0, 0x0, 0x20, 0x0, 0x40, 0x1, 0x0, 0x2,
+    0xff, 0xcc, 0x18, 0x18, 0x48, 0x50, 0x90, 0x22,
+    0x10, 0x40, 0x0, 0x90, 0x21, 0x5f, 0xa2, 0x0,
+    0x4, 0x0, 0x8, 0x0, 0x0,
 
     /* U+4F55 "何" */
-    0x0, 0xc4, 0x1, 0xff, 0xc3, 0xe0, 0xf, 0xfe,
-    0x12, 0xdb, 0xdd, 0xff, 0x8, 0x5, 0x2c, 0xf7,
-    0x7f, 0x3d, 0x88, 0x1, 0x40, 0x40, 0x3f, 0xf8,
-    0x3, 0x20, 0x13, 0xcc, 0xc6, 0x1, 0xea, 0xf0,
-    0x0, 0xe5, 0xdd, 0x0, 0x1e, 0xf3, 0x0, 0x84,
-    0x8a, 0x0, 0xf9, 0x0, 0x3f, 0xfb, 0x9, 0x77,
-    0x60, 0x7, 0xfc, 0xf7, 0x73, 0x80, 0x7f, 0x86,
-    0x40, 0x3f, 0xfa, 0xc, 0x1, 0xeb, 0xcb, 0x50,
-    0x0,
+    0x0, 0x0, 0x8, 0x0, 0x3, 0xfe, 0x10, 0x4,
+    0x10, 0x4, 0x31, 0xc4, 0x52, 0x24, 0x12, 0x24,
+    0x12, 0x24, 0x12, 0x24, 0x13, 0xc4, 0x12, 0x4,
+    0x10, 0x4, 0x10, 0x4, 0x10, 0x3c,
 
     /* U+4F5C "作" */
-    0x0, 0xe1, 0x0, 0xff, 0xe1, 0x3a, 0x80, 0x2c,
-    0x3, 0xfe, 0xc4, 0x3, 0x30, 0x7, 0xf9, 0xf8,
-    0x1, 0x29, 0x77, 0xe1, 0x0, 0xd, 0x28, 0x11,
-    0xe3, 0xdd, 0xf0, 0x80, 0x2c, 0xc0, 0x13, 0x0,
-    0x1f, 0xce, 0x64, 0xf, 0x82, 0x1, 0xfd, 0xb2,
-    0x1, 0x38, 0x5, 0x77, 0xa0, 0x1, 0x40, 0x13,
-    0x80, 0x6b, 0xbd, 0x0, 0x1f, 0xfc, 0xfb, 0xbe,
-    0x0, 0xff, 0xae, 0xf8, 0x3, 0xff, 0xb0, 0xe0,
-    0x1c, 0xe0, 0x1f, 0xd6, 0x1, 0xd6, 0x1, 0xe0,
+    0x0, 0x0, 0x0, 0x80, 0x8, 0x80, 0x1, 0xfe,
+    0x11, 0x40, 0x32, 0x40, 0x30, 0x40, 0x50, 0x7e,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x7e, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x0, 0x0,
 
     /* U+4F60 "你" */
-    0x0, 0xd0, 0x60, 0xac, 0x1, 0xff, 0x19, 0x83,
-    0x10, 0x3, 0xfd, 0x1e, 0x0, 0x52, 0x0, 0xfe,
-    0x24, 0x40, 0x28, 0xdd, 0xbe, 0xee, 0xd4, 0x0,
-    0x73, 0x80, 0x3b, 0x2e, 0xc7, 0x77, 0x23, 0x4,
-    0xd0, 0x1, 0x70, 0x40, 0x3c, 0x45, 0xb, 0x0,
-    0x19, 0xd4, 0x3, 0x19, 0xa8, 0xa, 0x0, 0x23,
-    0x9, 0x0, 0xc5, 0x2, 0x1, 0xf2, 0x20, 0x3,
-    0x9, 0x18, 0x7, 0xdd, 0x40, 0x1d, 0x72, 0x1,
-    0xe3, 0x31, 0x0, 0x71, 0x30, 0x7, 0xae, 0x0,
-    0x3e, 0xb2, 0x0, 0xe8, 0x10, 0xf, 0x9c, 0x80,
-    0x21, 0x0, 0xcd, 0x6e, 0x1, 0xfa, 0x80, 0x33,
-    0x5d, 0x80, 0x38,
+    0x8, 0x0, 0x9, 0x0, 0x11, 0x0, 0x11, 0xfe,
+    0x32, 0x22, 0x50, 0x22, 0x50, 0x20, 0x11, 0x24,
+    0x11, 0x24, 0x12, 0x22, 0x12, 0x22, 0x14, 0x20,
+    0x10, 0x20, 0x10, 0x60, 0x0, 0x0,
 
     /* U+4F7F "使" */
-    0x0, 0xc2, 0x1, 0xff, 0xc3, 0xb2, 0x0, 0x8a,
-    0x0, 0x3f, 0x10, 0xd5, 0x69, 0x5a, 0xac, 0x40,
-    0x14, 0x45, 0x77, 0x7a, 0x5d, 0xe2, 0x0, 0x23,
-    0x18, 0x8, 0xce, 0x23, 0xc0, 0x1, 0x87, 0x2,
-    0xbb, 0xbd, 0x6e, 0xe7, 0x0, 0x6f, 0x80, 0x1f,
-    0x6e, 0xde, 0xb7, 0x76, 0x1, 0x41, 0x80, 0x7f,
-    0xf0, 0x49, 0x0, 0x30, 0x8c, 0xe2, 0x38, 0x3,
-    0xe5, 0xf8, 0x87, 0xac, 0x45, 0xe0, 0x1f, 0x14,
-    0xcb, 0x22, 0x66, 0x40, 0xf, 0xba, 0x43, 0x10,
-    0x3, 0xfe, 0x4a, 0xd2, 0x0, 0xff, 0xe0, 0x24,
-    0xf5, 0x44, 0xc, 0x3, 0xc2, 0x2a, 0x2a, 0x33,
-    0x45, 0x2c, 0xd0, 0x80,
+    0x0, 0x0, 0x8, 0x20, 0xf, 0xfe, 0x10, 0x20,
+    0x10, 0x20, 0x33, 0xfc, 0x50, 0x22, 0x10, 0x22,
+    0x10, 0x22, 0x13, 0xfc, 0x12, 0x0, 0x11, 0x40,
+    0x10, 0xc0, 0x11, 0x30, 0x14, 0x6,
 
     /* U+4FBF "便" */
-    0x0, 0xa0, 0x3, 0xff, 0x84, 0x6d, 0x77, 0xba,
-    0xef, 0x8, 0x1, 0x79, 0xae, 0xf2, 0xdd, 0xe1,
-    0x0, 0x72, 0x80, 0x7f, 0xf0, 0x14, 0x2, 0xca,
-    0xa9, 0x6a, 0x96, 0xc0, 0x8, 0x0, 0xb, 0x55,
-    0x4b, 0x54, 0x8f, 0x8, 0xa0, 0x9, 0xea, 0xa5,
-    0xaa, 0x40, 0x3, 0xdc, 0x2, 0x7a, 0xa9, 0x6a,
-    0x90, 0x0, 0x70, 0xf, 0xfe, 0x30, 0x85, 0x52,
-    0xd6, 0xa9, 0x3a, 0x1, 0xc5, 0xd5, 0x4e, 0x8a,
-    0xa9, 0x0, 0x38, 0xb8, 0xc3, 0xdc, 0x3, 0xfd,
-    0x55, 0x10, 0x80, 0x7f, 0x8c, 0xda, 0x34, 0xc4,
-    0x1, 0xc2, 0x57, 0x73, 0xcd, 0x1d, 0x5d, 0x84,
-    0x1, 0x45, 0x70, 0x20, 0x12, 0xc5, 0xd8, 0x40,
+    0x10, 0x0, 0x2f, 0xf8, 0x1, 0x1, 0x2, 0x2,
+    0x7f, 0x8c, 0x88, 0xa9, 0xff, 0x12, 0x22, 0x24,
+    0x44, 0x4f, 0xf0, 0x80, 0x1, 0x24, 0x2, 0x38,
+    0x4, 0x58, 0xb, 0x7, 0x0, 0x0,
 
     /* U+4FE1 "信" */
-    0x0, 0xc8, 0x40, 0x1f, 0xfc, 0x2e, 0x25, 0xaa,
-    0xf3, 0x80, 0x71, 0xe8, 0x2d, 0x57, 0x9c, 0x3,
-    0xa5, 0xc4, 0x8b, 0xf8, 0x2, 0x31, 0x8, 0xbb,
-    0xfe, 0x20, 0x7, 0x38, 0x4c, 0xff, 0x88, 0x2a,
-    0x0, 0x27, 0xbb, 0xf5, 0x0, 0xc, 0x94, 0x2,
-    0x7b, 0xbf, 0x50, 0x0, 0xe0, 0x3, 0x3d, 0xdf,
-    0xa8, 0x3, 0xf3, 0xdd, 0xfa, 0x80, 0x3f, 0x45,
-    0x57, 0xc0, 0x1f, 0x92, 0xab, 0xc6, 0x40, 0x1f,
-    0xfc, 0xb1, 0x99, 0xf2, 0x0, 0x73, 0x0, 0x1a,
-    0xef, 0xc8, 0x1, 0xd4, 0x0, 0xb2, 0x2f, 0x49,
-    0x0,
+    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x10, 0x0,
+    0x17, 0xfe, 0x30, 0x0, 0x51, 0xfc, 0x50, 0x0,
+    0x11, 0xfc, 0x10, 0x0, 0x13, 0xfc, 0x12, 0x4,
+    0x12, 0x4, 0x13, 0xfc, 0x12, 0x4, 0x0, 0x0,
 
     /* U+5012 "倒" */
-    0x0, 0xff, 0xe3, 0xd, 0x52, 0xfa, 0xed, 0x0,
-    0x15, 0x0, 0x4d, 0xd5, 0xf3, 0x76, 0x80, 0x8,
-    0x40, 0x2c, 0x40, 0xd5, 0x0, 0xa8, 0x3, 0x98,
-    0x80, 0x4, 0x41, 0x90, 0xf, 0xac, 0x0, 0x64,
-    0x45, 0x24, 0x0, 0xea, 0x80, 0x39, 0xa, 0x2e,
-    0xe0, 0x6, 0x22, 0x38, 0x1d, 0x4f, 0xba, 0xd0,
-    0x6, 0x28, 0x0, 0xee, 0x30, 0xf, 0xfa, 0xec,
-    0xfd, 0x6a, 0x1, 0xfd, 0x76, 0x7e, 0xb5, 0x0,
-    0xff, 0xe1, 0xc8, 0x7, 0xfc, 0xc8, 0xc6, 0x1,
-    0xf2, 0x55, 0xf, 0x5, 0x0, 0x3c, 0x62, 0x95,
-    0x54, 0x29, 0x3, 0xd9, 0x0, 0x6, 0x0, 0x3f,
-    0x3d, 0xc8,
+    0x0, 0x0, 0x1f, 0xc4, 0x0, 0x8, 0x90, 0x91,
+    0x25, 0x26, 0x4a, 0x55, 0xcc, 0xa8, 0x9, 0x11,
+    0x12, 0x2f, 0xa4, 0x44, 0x48, 0x88, 0x11, 0x10,
+    0x22, 0xf0, 0x44, 0x1, 0x80, 0x0,
 
     /* U+5019 "候" */
-    0x0, 0x86, 0x80, 0x7, 0x77, 0xca, 0x1, 0xd3,
-    0xee, 0x7, 0x77, 0xa7, 0x0, 0x39, 0x55, 0x80,
-    0x1f, 0xfc, 0x7, 0x70, 0x1, 0x26, 0x7a, 0x12,
-    0x0, 0x5, 0x60, 0x12, 0x58, 0x5d, 0xd1, 0xf2,
-    0x0, 0xe8, 0x0, 0xc6, 0xa0, 0x1f, 0x1c, 0xa8,
-    0x6, 0x95, 0xac, 0xaa, 0xa4, 0xd, 0x40, 0x31,
-    0x94, 0xc1, 0x44, 0x60, 0xf, 0x8a, 0xc4, 0x40,
-    0x23, 0x80, 0x3e, 0x5b, 0xb8, 0xea, 0xee, 0x50,
-    0xf, 0x25, 0x52, 0xc, 0x6a, 0xa5, 0x0, 0xe9,
-    0x0, 0xa7, 0x8d, 0x80, 0x3f, 0x10, 0x15, 0xf9,
-    0x4e, 0x40, 0x80, 0x63, 0x0, 0x35, 0xd2, 0x0,
-    0x2b, 0x69, 0x0,
+    0x8, 0xf8, 0x10, 0x4, 0x14, 0x4, 0x15, 0xfe,
+    0x34, 0x80, 0x54, 0x80, 0x15, 0xfe, 0x15, 0x20,
+    0x14, 0x20, 0x15, 0xfe, 0x14, 0x30, 0x10, 0x50,
+    0x10, 0x8c, 0x11, 0x2,
 
     /* U+505A "做" */
-    0x0, 0xff, 0x84, 0x3, 0xe1, 0xa0, 0x5, 0x0,
-    0x56, 0x1, 0xf3, 0x78, 0x0, 0x40, 0x21, 0x0,
-    0xfb, 0x14, 0x3, 0x84, 0x40, 0x1e, 0x52, 0x4b,
-    0xb2, 0xdd, 0x3b, 0x55, 0x39, 0x0, 0x10, 0x9,
-    0x76, 0x5b, 0xad, 0x9a, 0xb4, 0x40, 0x4d, 0x80,
-    0x78, 0x9c, 0x80, 0xb4, 0x8, 0x10, 0x3, 0xc9,
-    0xfc, 0xa, 0x60, 0x52, 0x1, 0x55, 0x85, 0x89,
-    0x80, 0x31, 0x0, 0x3c, 0x37, 0x6a, 0xd0, 0xe2,
-    0x0, 0xff, 0xe1, 0x2f, 0x78, 0x7, 0xff, 0x4,
-    0xcc, 0x80, 0x1f, 0x84, 0x46, 0x0, 0xd5, 0xb0,
-    0xf, 0x9a, 0xee, 0xfb, 0xaa, 0x1b, 0x80, 0x46,
-    0x21, 0x35, 0x49, 0xe8, 0x60, 0x9d, 0x50, 0x0,
-    0xc0, 0x20, 0x5, 0x66, 0x1, 0x52, 0x80,
+    0x0, 0x0, 0x9, 0x10, 0x1, 0x10, 0x11, 0x10,
+    0x17, 0xde, 0x31, 0x22, 0x51, 0x20, 0x51, 0x10,
+    0x17, 0x94, 0x14, 0x44, 0x14, 0x48, 0x14, 0x48,
+    0x14, 0x5c, 0x17, 0xa4, 0x10, 0x42, 0x0, 0x0,
 
     /* U+505C "停" */
-    0x0, 0xcc, 0x60, 0x11, 0x48, 0x7, 0xf6, 0xdd,
-    0xee, 0x7b, 0xbc, 0x40, 0x14, 0x7c, 0x5d, 0xd9,
-    0xd7, 0x78, 0x80, 0x6, 0x88, 0x4, 0xba, 0xaf,
-    0x0, 0x6f, 0x70, 0x1, 0xfd, 0x57, 0x30, 0x5,
-    0x70, 0x1, 0x1f, 0xd5, 0x73, 0x80, 0xb, 0x90,
-    0x2, 0x4b, 0xaa, 0xeb, 0x0, 0x12, 0x80, 0x51,
-    0x55, 0xfc, 0x40, 0x1c, 0x75, 0x5f, 0xb9, 0x40,
-    0x3b, 0xe, 0xef, 0xd4, 0xc6, 0x1, 0xce, 0x77,
-    0x69, 0x1b, 0xb5, 0x12, 0x0, 0x7f, 0xf5, 0xc4,
-    0x2, 0x3a, 0x9d, 0x0, 0xfd, 0x40, 0x11, 0xd5,
-    0xb8, 0x7, 0x0,
+    0x0, 0x20, 0xf, 0xfe, 0x10, 0x0, 0x11, 0xfc,
+    0x30, 0x4, 0x51, 0xfc, 0x10, 0x0, 0x17, 0xfe,
+    0x14, 0x0, 0x11, 0xfc, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x10, 0xc0, 0x0, 0x0,
 
     /* U+50CF "像" */
-    0x0, 0xc2, 0x1, 0xff, 0xc2, 0x1b, 0x0, 0x1d,
-    0x55, 0xc6, 0x1, 0xe6, 0xe0, 0x15, 0xaa, 0x8c,
-    0xc0, 0x1e, 0xb4, 0x1a, 0x60, 0x3, 0x50, 0x7,
-    0x99, 0x4b, 0x1a, 0xaa, 0x8d, 0xa9, 0xa0, 0x0,
-    0xd8, 0x17, 0x25, 0x54, 0xb5, 0x49, 0x60, 0x5,
-    0xd8, 0x0, 0x65, 0x55, 0x2d, 0x54, 0xc0, 0x44,
-    0x40, 0xa, 0xec, 0x66, 0xdd, 0x55, 0x20, 0xa,
-    0x0, 0x24, 0x98, 0xa2, 0x26, 0x3, 0xd8, 0x7,
-    0x86, 0x25, 0x86, 0xe, 0x8a, 0x40, 0x3c, 0xa9,
-    0x41, 0x45, 0x66, 0xa0, 0x1f, 0x39, 0xd2, 0xbb,
-    0x98, 0x50, 0x3, 0xe7, 0x61, 0xb1, 0x83, 0x8f,
-    0x20, 0xf, 0x9f, 0x61, 0xb1, 0x42, 0xb8, 0x80,
-    0x6, 0x21, 0xa1, 0xb3, 0x42, 0x60, 0x38, 0x40,
+    0x0, 0x0, 0x8, 0xf0, 0x0, 0x10, 0x12, 0x0,
+    0x17, 0xfe, 0x32, 0x22, 0x53, 0xfe, 0x50, 0xc0,
+    0x13, 0x52, 0x10, 0x78, 0x11, 0x28, 0x10, 0x28,
+    0x10, 0x84, 0x11, 0x22, 0x14, 0xe0,
 
     /* U+513F "儿" */
-    0x0, 0xd4, 0x1, 0xd4, 0x1, 0xf9, 0x80, 0x39,
-    0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0xa1, 0x70,
-    0xf, 0xfe, 0xa, 0x18, 0x7, 0xff, 0x7, 0xa8,
-    0x3, 0xfa, 0x80, 0x8, 0x4, 0x1, 0xfc, 0x20,
-    0x71, 0x40, 0x1e, 0x70, 0xc, 0x3f, 0xa2, 0x1,
-    0xec, 0xce, 0x1c, 0x10, 0xf, 0x9f, 0x32, 0x70,
+    0x8, 0x20, 0x10, 0x40, 0x20, 0x80, 0x41, 0x0,
+    0x82, 0x1, 0x4, 0x2, 0x8, 0x4, 0x10, 0x8,
+    0x20, 0x10, 0x40, 0x40, 0x88, 0x81, 0x12, 0x2,
+    0x28, 0x3, 0x80, 0x0, 0x0,
 
     /* U+5148 "先" */
-    0x0, 0xa4, 0x0, 0xaa, 0x0, 0xfe, 0x41, 0x0,
-    0x19, 0x80, 0x3f, 0xb5, 0x73, 0x17, 0x6c, 0xcd,
-    0x20, 0x11, 0x13, 0x73, 0x17, 0x6c, 0xcd, 0x20,
-    0x14, 0x40, 0x3, 0xff, 0x83, 0xc6, 0x1, 0xff,
-    0xc1, 0x51, 0x1f, 0xf8, 0x1, 0x17, 0x76, 0x6e,
-    0xec, 0xbb, 0xa4, 0x22, 0xaa, 0x7d, 0xaa, 0x45,
-    0x56, 0x90, 0xe, 0x61, 0x0, 0xff, 0xe0, 0x22,
-    0x80, 0x7f, 0xf0, 0x62, 0x0, 0x1f, 0xa0, 0x80,
-    0xf2, 0x4, 0x3, 0xf1, 0x1c, 0xd7, 0x20, 0x6,
-    0x5a, 0xbb, 0x84, 0x40,
+    0x10, 0x0, 0x20, 0x0, 0xff, 0xe1, 0x0, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x8,
+    0x0, 0x10, 0x0, 0x20, 0x0, 0x80, 0x22, 0x0,
+    0x58, 0xf, 0x80,
 
     /* U+5149 "光" */
-    0x0, 0x23, 0x0, 0x4c, 0xa0, 0x11, 0x28, 0x6,
-    0x4d, 0x10, 0xf, 0xa1, 0x80, 0x3b, 0xe0, 0x3,
-    0xc4, 0x26, 0x1, 0xc8, 0x40, 0x1e, 0x89, 0x0,
-    0xfa, 0xc0, 0x3d, 0xe4, 0x1, 0xff, 0xc2, 0x50,
-    0xe, 0xbb, 0xdd, 0x9b, 0xdb, 0xab, 0xbc, 0x0,
-    0xbb, 0xc9, 0xd7, 0x74, 0x5d, 0xe0, 0xf, 0x31,
-    0x0, 0x7f, 0xf0, 0x45, 0xc0, 0x3f, 0xf8, 0x53,
-    0xa0, 0x1f, 0x84, 0x3, 0x1a, 0x30, 0x7, 0xe9,
-    0x30, 0x3, 0xfe, 0x80, 0x71, 0x80, 0x44, 0x40,
-    0xb0, 0xc1, 0x0, 0xcb, 0x57, 0x70, 0x8,
+    0x0, 0x0, 0x10, 0x8, 0x8, 0x8, 0x8, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x4, 0x0,
+    0x4, 0x0, 0x4, 0x0, 0x8, 0x0, 0x8, 0x2,
+    0x10, 0x2, 0x40, 0x3e,
 
     /* U+5165 "入" */
-    0x0, 0x8f, 0x33, 0x28, 0x7, 0xf8, 0xf3, 0x2f,
-    0xc0, 0xf, 0xfe, 0x11, 0x18, 0x7, 0xff, 0xa,
-    0x18, 0x3, 0xff, 0x84, 0x80, 0x1f, 0xfc, 0x23,
-    0x74, 0x40, 0x7, 0xff, 0x2, 0xbe, 0xf4, 0x3,
-    0xff, 0x80, 0x8a, 0x6a, 0x20, 0x1f, 0xe7, 0xa0,
-    0x4, 0xc8, 0x3, 0xf8, 0x69, 0xc0, 0xa, 0x84,
-    0x1, 0xfb, 0x64, 0x3, 0x77, 0x4, 0x3, 0xd5,
-    0x68, 0x1, 0x8a, 0x74, 0x3, 0xe, 0x13, 0x80,
-    0x79, 0x6b, 0x8, 0x1, 0x93, 0x0, 0x1f, 0x9b,
-    0xfc, 0x0, 0xd5, 0x0, 0xff, 0x1e, 0x80,
+    0xf, 0x0, 0x0, 0x80, 0x0, 0x80, 0x1, 0x80,
+    0x1, 0x80, 0x1, 0x80, 0x2, 0x40, 0x2, 0x40,
+    0x0, 0x20, 0x4, 0x20, 0x8, 0x10, 0x10, 0x8,
+    0x30, 0x4, 0x40, 0x2, 0x0, 0x0,
 
     /* U+5168 "全" */
-    0x0, 0xfa, 0xe8, 0x3, 0xff, 0x83, 0x3d, 0xf2,
-    0x1, 0xff, 0x47, 0x2a, 0xb2, 0x80, 0x3f, 0xa0,
-    0x1c, 0x0, 0xbd, 0x64, 0x1, 0xea, 0xe8, 0x0,
-    0xc9, 0x52, 0xe0, 0x11, 0xe0, 0xfc, 0xcf, 0xa3,
-    0x7, 0x0, 0x17, 0xb7, 0x11, 0xf, 0xc4, 0x4c,
-    0xcc, 0x0, 0x40, 0x80, 0x8d, 0xe6, 0x23, 0x80,
-    0x3f, 0xf9, 0x27, 0x77, 0xaa, 0x2e, 0xf1, 0x80,
-    0x63, 0xbb, 0xd5, 0x17, 0x78, 0xc0, 0x3f, 0xfa,
-    0xef, 0x77, 0xd5, 0x17, 0x7d, 0x0,
+    0x1, 0x80, 0x2, 0x40, 0x4, 0x20, 0xc, 0x10,
+    0x10, 0x8, 0x3f, 0xf2, 0x41, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfe,
 
     /* U+516B "八" */
-    0x0, 0xcd, 0x99, 0xce, 0x1, 0xfc, 0xd9, 0x9d,
-    0x60, 0x1f, 0xfd, 0x37, 0x0, 0xfe, 0x57, 0x0,
-    0xc4, 0x60, 0x1f, 0xb4, 0xc0, 0x37, 0xa8, 0x7,
-    0xe3, 0x50, 0xc, 0xbe, 0x1, 0xf9, 0xc4, 0x3,
-    0x1a, 0x0, 0x7c, 0x88, 0x0, 0xf3, 0x90, 0x7,
-    0xba, 0xc0, 0x3d, 0xf4, 0x1, 0xc2, 0xc6, 0x1,
-    0xe5, 0x50, 0x7, 0x44, 0x0, 0x3f, 0x2c, 0x0,
-    0x4a, 0x48, 0x1, 0xfa, 0x14, 0xc0, 0x13, 0x40,
-    0x1f, 0xef, 0xf0, 0x0,
+    0x7, 0xc0, 0x0, 0x20, 0x0, 0x20, 0x0, 0x20,
+    0x0, 0x20, 0x8, 0x0, 0x8, 0x10, 0x8, 0x10,
+    0x8, 0x10, 0x10, 0x8, 0x10, 0x8, 0x20, 0xc,
+    0x20, 0x4, 0x40, 0x2,
 
     /* U+516C "公" */
-    0x0, 0xd6, 0x1, 0xac, 0x3, 0xf3, 0xe0, 0x6,
-    0xd8, 0x0, 0xf0, 0xd3, 0x80, 0x66, 0x33, 0x0,
-    0x75, 0xc0, 0x7, 0xa7, 0xc0, 0x33, 0x2, 0x80,
-    0x78, 0xa6, 0x80, 0x9, 0x54, 0x0, 0x12, 0x0,
-    0x65, 0x29, 0xc, 0xd0, 0xa, 0xc0, 0x3d, 0x2,
-    0x10, 0x20, 0x12, 0x20, 0x3, 0xd0, 0x1, 0xcf,
-    0x60, 0x12, 0x80, 0x7f, 0x5b, 0x0, 0x45, 0x0,
-    0x1f, 0x2d, 0x80, 0x67, 0x35, 0x0, 0xf4, 0xb8,
-    0x7, 0x5c, 0x90, 0x0, 0xe6, 0xc6, 0xaf, 0x32,
-    0xbb, 0x3f, 0x0, 0xa, 0xa3, 0xee, 0xb3, 0x2b,
-    0xbc, 0xa0,
+    0x8, 0x40, 0x0, 0x40, 0x40, 0x81, 0x0, 0x82,
+    0x0, 0x88, 0x1, 0xa1, 0x1, 0x2, 0x0, 0x0,
+    0x0, 0x10, 0x40, 0x0, 0x80, 0x80, 0x87, 0xff,
+    0x80, 0x0, 0x0,
 
     /* U+516D "六" */
-    0x0, 0xf3, 0x28, 0x7, 0xff, 0x0, 0x40, 0x3f,
-    0xf9, 0x31, 0x33, 0xd7, 0x33, 0xe8, 0x9b, 0xbe,
-    0xee, 0x5d, 0xf4, 0x89, 0x17, 0xff, 0x0, 0x40,
-    0x3f, 0xf8, 0xa6, 0xe0, 0x1a, 0x14, 0x3, 0xd0,
-    0x80, 0x1a, 0x64, 0x1, 0xc6, 0x6, 0x1, 0x86,
-    0x64, 0x1, 0xbe, 0x40, 0x3c, 0xa4, 0x60, 0x6,
-    0x52, 0x0, 0xfa, 0x7c, 0xa, 0xe4, 0x3, 0xf1,
-    0x32, 0xcf, 0x80, 0x7f, 0xa3, 0xec, 0x80, 0x3f,
-    0xc5, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x10, 0x20,
+    0x40, 0x42, 0x1, 0x8, 0x2, 0x40, 0xa, 0x0,
+    0x10, 0x0, 0x0,
 
     /* U+5171 "共" */
-    0x0, 0xc8, 0xc0, 0x19, 0x90, 0x3, 0xf0, 0x88,
-    0x3, 0x8, 0x80, 0x3f, 0xf9, 0x29, 0x98, 0x89,
-    0xcc, 0xd5, 0x19, 0x86, 0x0, 0x26, 0x62, 0x27,
-    0x33, 0x54, 0x66, 0x18, 0x3, 0xff, 0xca, 0x37,
-    0x98, 0x8a, 0xcc, 0xd5, 0x19, 0x8b, 0x11, 0x5e,
-    0x63, 0x75, 0x99, 0xb7, 0x59, 0x8b, 0x10, 0xc,
-    0x34, 0x1, 0xd, 0x8, 0x7, 0xc3, 0x52, 0x1,
-    0xc, 0xea, 0x0, 0x72, 0xec, 0x98, 0x6, 0x3c,
-    0xf7, 0x0, 0x9f, 0x30, 0x40, 0x1f, 0x5f, 0xa8,
-    0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x4, 0x20, 0x8, 0x10,
+    0x10, 0x8, 0x20, 0x4,
 
     /* U+5173 "关" */
-    0x0, 0xff, 0xe1, 0x41, 0x0, 0x65, 0x70, 0xd,
-    0x32, 0x0, 0xd2, 0xe0, 0x18, 0x74, 0x80, 0x9,
-    0x20, 0x19, 0xf2, 0xbb, 0x31, 0x13, 0x86, 0x0,
-    0x7c, 0xc9, 0x7b, 0x32, 0x30, 0xf, 0xfe, 0x69,
-    0xdd, 0xe7, 0xeb, 0xbc, 0x27, 0x77, 0x89, 0x6e,
-    0xf0, 0x80, 0x61, 0x72, 0x0, 0xfe, 0x8f, 0xf4,
-    0x80, 0x7c, 0xc6, 0x88, 0x5, 0x0, 0xc3, 0x3f,
-    0x40, 0x9, 0xf8, 0x0, 0x2e, 0xea, 0x40, 0x35,
-    0x76, 0xa, 0xe2, 0x0, 0x79, 0xb0, 0x40,
+    0x0, 0x2, 0x0, 0x10, 0x80, 0x0, 0x3f, 0xc0,
+    0x40, 0x4, 0x0, 0x40, 0x7f, 0xe0, 0x60, 0x6,
+    0x0, 0x90, 0x9, 0x3, 0xc, 0x40, 0x20, 0x0,
 
     /* U+5174 "兴" */
-    0x0, 0xff, 0xe5, 0x60, 0x7, 0x89, 0x0, 0x10,
-    0x40, 0x15, 0xa8, 0x7, 0x4b, 0x80, 0x2a, 0x40,
-    0x26, 0x90, 0xc, 0x82, 0x60, 0x2, 0x35, 0x0,
-    0xb, 0x88, 0x5, 0x16, 0x1, 0xa6, 0x40, 0x17,
-    0x10, 0x1, 0xec, 0x40, 0x30, 0xd8, 0x80, 0x14,
-    0xc0, 0xb1, 0xc0, 0x3c, 0xe2, 0x1, 0xcd, 0x20,
-    0x1d, 0x77, 0xfd, 0xf3, 0x77, 0x0, 0x2e, 0xff,
-    0xf8, 0x40, 0x1c, 0x28, 0x1, 0x9c, 0x40, 0x3f,
-    0x50, 0x7, 0x2e, 0x90, 0x7, 0xab, 0x50, 0x3,
-    0x17, 0x70, 0x40, 0x21, 0xbc, 0x60, 0xf, 0x17,
-    0x68, 0x80, 0x2f, 0xd8, 0x3, 0xf1, 0x7c, 0x0,
+    0x0, 0x0, 0x2, 0x0, 0x40, 0x4, 0x21, 0x4,
+    0x21, 0x8, 0x10, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8, 0x10,
+    0x10, 0x8, 0x20, 0x4, 0x40, 0x2,
 
     /* U+5176 "其" */
-    0x0, 0xd4, 0x1, 0xea, 0x0, 0xf0, 0x89, 0x84,
-    0x7c, 0xc2, 0x20, 0x9, 0x6e, 0xc5, 0x77, 0xe2,
-    0xbb, 0x30, 0x1, 0x6a, 0x85, 0x55, 0xe2, 0xaa,
-    0x30, 0x7, 0x15, 0xdf, 0x88, 0x3, 0xf1, 0x5d,
-    0xf8, 0x80, 0x3f, 0xf9, 0x87, 0x77, 0xe3, 0x0,
-    0xfc, 0x77, 0x7e, 0x30, 0xf, 0xfe, 0x4d, 0x5d,
-    0x82, 0xef, 0xc1, 0x76, 0xa0, 0x5, 0x5d, 0xb4,
-    0xe2, 0xed, 0x19, 0xb7, 0x6a, 0x0, 0x8a, 0x37,
-    0xc, 0x0, 0x69, 0x74, 0x80, 0x15, 0x46, 0x61,
-    0x0, 0x31, 0xd5, 0xec, 0x80,
+    0x8, 0x10, 0x8, 0x10, 0x3f, 0xfc, 0x8, 0x10,
+    0xf, 0xf0, 0x8, 0x10, 0x8, 0x10, 0xf, 0xf0,
+    0x8, 0x10, 0x8, 0x10, 0x7f, 0xfe, 0x4, 0x0,
+    0x18, 0x18, 0x60, 0x6,
 
     /* U+5185 "内" */
-    0x0, 0xfa, 0xc0, 0x3f, 0xf8, 0x2e, 0x1, 0xf4,
-    0xe6, 0x71, 0xe6, 0x6b, 0x61, 0x2c, 0xce, 0x3c,
-    0xcd, 0x74, 0x1, 0xe2, 0x60, 0xf, 0xfe, 0x2,
-    0x8, 0x7, 0xff, 0x2, 0xba, 0xc4, 0x3, 0xf9,
-    0xad, 0x62, 0x84, 0x3, 0xe4, 0xd7, 0x3, 0x8d,
-    0x10, 0xe, 0x8e, 0xb0, 0x8, 0xff, 0x40, 0x30,
-    0xed, 0x0, 0x71, 0xf8, 0x6, 0x15, 0x0, 0xf8,
-    0xc0, 0x3f, 0xf8, 0x82, 0x20, 0xf, 0xd3, 0x98,
-    0x40, 0xa0, 0xf, 0xd3, 0x98, 0x80,
+    0x1, 0x0, 0x4, 0x7, 0xff, 0x90, 0x41, 0x41,
+    0x5, 0x4, 0x14, 0x28, 0x50, 0x11, 0x44, 0x25,
+    0x60, 0x54, 0x0, 0x50, 0x1, 0x40, 0x5, 0x0,
+    0xf0, 0x0, 0x0,
 
     /* U+518D "再" */
-    0x6, 0xbb, 0xed, 0xd5, 0xdf, 0x38, 0x1, 0xae,
-    0xfd, 0x17, 0x7c, 0xe0, 0x1f, 0xfc, 0x71, 0xab,
-    0xbd, 0x17, 0x75, 0x8, 0x6, 0x5d, 0xbb, 0xd1,
-    0x77, 0x6a, 0x80, 0x7f, 0xf0, 0xc4, 0x3, 0xaa,
-    0xef, 0x4d, 0xdd, 0x40, 0x1e, 0xab, 0xbd, 0x37,
-    0x75, 0x0, 0x7f, 0xf1, 0xc6, 0xe2, 0xae, 0xf4,
-    0x5d, 0xd5, 0x16, 0x43, 0x71, 0x57, 0x76, 0xea,
-    0xee, 0xa8, 0xb2, 0x0, 0xff, 0xe8, 0x88, 0x7,
-    0x8, 0x7, 0xae, 0xe6, 0x0, 0xc8, 0xc0, 0x1e,
-    0xbb, 0x61, 0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
 
     /* U+5199 "写" */
-    0x5, 0xcc, 0xff, 0xe0, 0x30, 0x3, 0x3b, 0x33,
-    0xfd, 0xde, 0x1, 0xc7, 0x0, 0x1f, 0x8c, 0x2,
-    0x30, 0x5e, 0x0, 0xf8, 0xcc, 0x0, 0x91, 0xc,
-    0xda, 0xaf, 0x28, 0xc8, 0x7, 0x35, 0xd5, 0x79,
-    0x40, 0x3c, 0x4e, 0x23, 0xe0, 0xf, 0xc8, 0xf7,
-    0x7e, 0xe0, 0xf, 0x9b, 0x2a, 0xbc, 0x40, 0x1c,
-    0x23, 0xfe, 0x1, 0x18, 0x1, 0x17, 0x7f, 0xc3,
-    0x76, 0x80, 0x4, 0xd5, 0x7e, 0xea, 0xaa, 0x40,
-    0x3f, 0xed, 0x40, 0xf, 0xf0, 0xdd, 0x59, 0x98,
-    0x3, 0xfc, 0x37, 0x57, 0x40, 0x1c,
+    0x3f, 0xfc, 0x40, 0x2, 0x44, 0x2, 0x40, 0x2,
+    0xf, 0xf0, 0x8, 0x0, 0x8, 0x0, 0xf, 0xf0,
+    0x0, 0x10, 0x0, 0x10, 0x7f, 0xfe, 0x0, 0x0,
+    0x0, 0x20, 0x1, 0xe0, 0x0, 0x0,
 
     /* U+51B2 "冲" */
-    0x2b, 0x0, 0xfa, 0xc0, 0x38, 0x8e, 0x80, 0x3c,
-    0xe0, 0x1e, 0x80, 0x70, 0xf, 0xfe, 0xd, 0x0,
-    0x26, 0xee, 0x3b, 0xbd, 0x20, 0x13, 0x82, 0xdd,
-    0xc7, 0x77, 0x94, 0x3, 0xff, 0xa8, 0x32, 0x1,
-    0xff, 0xc1, 0x9c, 0x0, 0x5d, 0xc7, 0x77, 0x80,
-    0x2, 0x6a, 0x9, 0x77, 0x1d, 0xde, 0x40, 0xb8,
-    0x0, 0x40, 0x7, 0xe8, 0x40, 0x30, 0xf, 0xfe,
-    0x3, 0x58, 0x7, 0xff, 0x4, 0x84, 0x3, 0xe7,
-    0x0, 0xe0,
+    0x40, 0x40, 0xc0, 0x80, 0x81, 0x0, 0x3f, 0xf0,
+    0x44, 0x20, 0x88, 0x41, 0x10, 0x8a, 0x21, 0x27,
+    0xfe, 0x48, 0x85, 0x1, 0x2, 0x2, 0x0, 0x4,
+    0x0, 0x8, 0x0,
 
     /* U+51B3 "决" */
-    0x9, 0x30, 0xf, 0x58, 0x7, 0xd1, 0xe2, 0x1,
-    0xce, 0x1, 0xf0, 0xf5, 0x0, 0xdd, 0xc7, 0x77,
-    0x18, 0x6, 0x2a, 0x1, 0xbb, 0x8e, 0xed, 0x16,
-    0x1, 0xc2, 0x1, 0xff, 0xe5, 0xbb, 0xb0, 0xf2,
-    0xfd, 0x6c, 0x80, 0x2b, 0xb, 0xba, 0x19, 0x97,
-    0x9b, 0x64, 0x0, 0x5c, 0x0, 0xdd, 0x62, 0x20,
-    0xf, 0x4b, 0x80, 0x46, 0x5, 0x10, 0x0, 0xe6,
-    0xb0, 0x8, 0xbe, 0xc0, 0xc1, 0x80, 0x35, 0x38,
-    0x1, 0x7b, 0x44, 0x1, 0x39, 0x0, 0x16, 0x80,
-    0x23, 0x70, 0x40, 0x35, 0x76, 0x0,
+    0x40, 0x40, 0x20, 0x40, 0x13, 0xf8, 0x0, 0x44,
+    0x0, 0x44, 0x0, 0x44, 0x0, 0x44, 0x7, 0xfe,
+    0x10, 0x60, 0x0, 0xa0, 0x20, 0x90, 0x1, 0x10,
+    0x42, 0xc, 0xc, 0x2,
 
     /* U+51C6 "准" */
-    0x0, 0xff, 0xe5, 0xd0, 0x80, 0x2c, 0x3, 0xa1,
-    0x80, 0x21, 0x1, 0x2, 0x20, 0x7, 0x40, 0xd0,
-    0x2, 0x78, 0x1, 0x54, 0x0, 0xf3, 0xf8, 0x93,
-    0xfd, 0xd9, 0xe2, 0xec, 0xc0, 0x19, 0x46, 0x46,
-    0xee, 0x3b, 0xb9, 0x80, 0x3a, 0x31, 0x40, 0x3f,
-    0xf8, 0x38, 0xe1, 0x77, 0x1d, 0xdc, 0x40, 0x18,
-    0x90, 0x1, 0x77, 0x1d, 0xdc, 0x40, 0x10, 0xf0,
-    0x7, 0xff, 0xa, 0xe0, 0x2, 0xbb, 0x8e, 0xee,
-    0x20, 0x2, 0x1a, 0x0, 0x57, 0x71, 0xdd, 0xc4,
-    0x3, 0x10, 0x0, 0xff, 0xe1, 0x78, 0x80, 0x6a,
-    0xa8, 0xaa, 0xa9, 0x1, 0x30, 0xc, 0x37, 0x77,
-    0xdd, 0xd0, 0x0,
+    0x0, 0x0, 0x1, 0x10, 0x41, 0x10, 0x12, 0x20,
+    0x3, 0xfc, 0x6, 0x20, 0xa, 0x20, 0x3, 0xfc,
+    0x2, 0x20, 0x12, 0x20, 0x23, 0xfc, 0x22, 0x20,
+    0x42, 0x20, 0x3, 0xfe, 0x2, 0x0,
 
     /* U+51E0 "几" */
-    0x0, 0xa7, 0x33, 0xcc, 0x1, 0xf2, 0xe6, 0x77,
-    0x78, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x92, 0x4c,
-    0x1, 0xff, 0xc1, 0x4c, 0x0, 0xff, 0xe0, 0xd3,
-    0x80, 0x7f, 0x50, 0x1, 0x58, 0x40, 0x3f, 0x84,
-    0xe, 0x2c, 0x3, 0xe2, 0x12, 0x0, 0x7f, 0x84,
-    0x3, 0xc4, 0x77, 0x1e, 0x0,
+    0x1f, 0xc0, 0x20, 0x40, 0x40, 0x80, 0x81, 0x1,
+    0x2, 0x2, 0x4, 0x4, 0x8, 0x8, 0x10, 0x10,
+    0x20, 0x0, 0x40, 0x80, 0x91, 0x1, 0x24, 0x2,
+    0x50, 0x7, 0x0,
 
     /* U+51FA "出" */
-    0x0, 0xe8, 0x10, 0xf, 0x2a, 0x0, 0x42, 0x60,
-    0x1a, 0x40, 0xc4, 0x3, 0xf9, 0x40, 0x3f, 0xfb,
-    0x8f, 0xd7, 0x73, 0xf5, 0xde, 0x90, 0x5b, 0xbc,
-    0xfd, 0x77, 0x9c, 0xa0, 0x3, 0xfc, 0xe8, 0x1,
-    0xff, 0xdb, 0x3b, 0xbc, 0xfd, 0x77, 0xa0, 0x12,
-    0xef, 0x76, 0x5d, 0xe8, 0xb, 0x0, 0xff, 0x2b,
+    0x4, 0x0, 0x20, 0x81, 0x4, 0x8, 0x20, 0x41,
+    0x2, 0x9, 0xff, 0x80, 0x80, 0x84, 0x4, 0x20,
+    0x21, 0x1, 0x8, 0xf, 0xff, 0x40, 0x0, 0x0,
     0x0,
 
     /* U+5206 "分" */
-    0x0, 0xe7, 0x0, 0xce, 0x1, 0xfc, 0x9c, 0x1,
-    0xbd, 0x40, 0x3f, 0x44, 0x0, 0x34, 0x48, 0x80,
-    0x7a, 0x28, 0x40, 0x3b, 0xe8, 0x3, 0x98, 0x98,
-    0x3, 0xc7, 0xb4, 0x1, 0x3e, 0xd0, 0x7, 0xe6,
-    0x2b, 0x1, 0xfb, 0xbd, 0xba, 0xbb, 0xd5, 0x1c,
-    0x22, 0x80, 0xbb, 0x93, 0xae, 0xf3, 0x2, 0x88,
-    0x7, 0x94, 0xc0, 0x3f, 0xf8, 0x24, 0xc0, 0x18,
-    0x5c, 0x3, 0xf4, 0x48, 0x6, 0x23, 0x0, 0xf9,
-    0x40, 0xc0, 0x33, 0x70, 0x7, 0xa3, 0xe8, 0x3,
-    0xb0, 0x80, 0x31, 0xe6, 0xd0, 0x5, 0x57, 0x62,
-    0x40, 0xc, 0x78, 0xa0, 0x1a, 0xae, 0xe0, 0xc,
+    0x0, 0x0, 0x4, 0x20, 0x8, 0x10, 0x10, 0x8,
+    0x10, 0x4, 0x20, 0x6, 0x5f, 0xf8, 0x2, 0x8,
+    0x2, 0x8, 0x2, 0x8, 0x4, 0x8, 0x4, 0x0,
+    0x18, 0x10, 0x20, 0xf0, 0x0, 0x0,
 
     /* U+5207 "切" */
-    0x0, 0x48, 0x80, 0x7f, 0xf0, 0x4c, 0x2, 0x8b,
-    0xb6, 0x5d, 0xe7, 0x0, 0xf4, 0x5d, 0x9e, 0xef,
-    0x80, 0x39, 0x1c, 0x0, 0xe0, 0x1c, 0x2a, 0xf5,
-    0x43, 0x40, 0xf, 0xca, 0xd, 0x54, 0x73, 0x0,
-    0xfc, 0x8a, 0x20, 0x1e, 0x70, 0x8, 0x5c, 0x3,
-    0xf1, 0x90, 0x4, 0x62, 0x1, 0xe8, 0x4, 0xc0,
-    0xc, 0x60, 0x1e, 0x30, 0xb4, 0x0, 0x84, 0x40,
-    0xc, 0xdb, 0xcd, 0x35, 0x10, 0x9, 0xbc, 0x0,
-    0xd9, 0x78, 0xdf, 0x60, 0x18, 0x88, 0x1, 0xeb,
-    0x92, 0x0, 0xd8, 0xe0, 0x1d, 0x9e, 0xa0, 0x7,
-    0xcc, 0x9, 0x0, 0x76, 0x20, 0x4, 0xf9, 0x8a,
-    0x0,
+    0x20, 0x0, 0x47, 0xf8, 0x81, 0x9, 0x2, 0x13,
+    0x84, 0x24, 0x8, 0x48, 0x10, 0x90, 0x21, 0x22,
+    0x2, 0x45, 0x4, 0x72, 0x0, 0x8, 0x0, 0x20,
+    0x40, 0x83, 0x80, 0x0, 0x0,
 
     /* U+5229 "利" */
-    0x0, 0x89, 0x62, 0x9c, 0x3, 0xd2, 0x11, 0x4,
-    0xeb, 0xa7, 0x0, 0x28, 0x0, 0x4c, 0x22, 0xc,
-    0x42, 0x1, 0xf, 0x80, 0x7f, 0xf2, 0x22, 0x64,
-    0x91, 0x32, 0x30, 0xf, 0xaa, 0xa2, 0xfa, 0xa1,
-    0x80, 0x7c, 0x46, 0xc2, 0x23, 0x30, 0x7, 0xfb,
-    0xdf, 0xd4, 0x3, 0xfc, 0xfc, 0x13, 0x8e, 0x1,
-    0xf8, 0xb1, 0x0, 0x12, 0x2, 0x1, 0xe1, 0xea,
-    0x0, 0xce, 0x22, 0xa0, 0xc, 0x7e, 0x20, 0x1f,
-    0xfc, 0x2, 0x30, 0xf, 0xfe, 0x28, 0x80, 0x7a,
-    0x2e, 0xb0, 0x3, 0x41, 0x0, 0x74, 0x5d, 0x98,
+    0x6, 0x2, 0xd0, 0x4, 0x20, 0x88, 0x41, 0x17,
+    0xf2, 0x21, 0x4, 0x42, 0x8, 0x8e, 0x11, 0xa,
+    0x22, 0x50, 0x45, 0x20, 0x8, 0x40, 0x10, 0x80,
+    0x21, 0x3, 0x80, 0x0, 0x0,
 
     /* U+522B "别" */
-    0x6, 0xbb, 0xe8, 0x0, 0xea, 0x0, 0x7c, 0xdd,
-    0xe3, 0x0, 0x30, 0x0, 0x40, 0x3f, 0xea, 0x0,
-    0xff, 0xe4, 0xd, 0x3b, 0xe1, 0x0, 0xfd, 0x16,
-    0x62, 0x69, 0x40, 0x1f, 0xc6, 0x9a, 0x86, 0x1,
-    0xf8, 0xae, 0xe5, 0xbb, 0x30, 0x7, 0xc5, 0x76,
-    0xf6, 0xbb, 0x50, 0x7, 0xf8, 0xf0, 0x3, 0x9c,
-    0x3, 0xeb, 0x40, 0x3, 0x80, 0x2c, 0x3, 0xc8,
-    0xa0, 0x1, 0x10, 0x7, 0xe2, 0x98, 0x0, 0x29,
-    0x0, 0x7c, 0x5d, 0xe2, 0xb7, 0x36, 0x0, 0x3b,
-    0xb0, 0x0, 0xb0, 0x81, 0x6f, 0x4c, 0x0, 0x77,
-    0x70, 0x0,
+    0x3f, 0x4, 0x82, 0x9, 0x4, 0x92, 0x9, 0x26,
+    0x12, 0x40, 0x4, 0x82, 0x9, 0x3f, 0x12, 0x9,
+    0x24, 0x2, 0x48, 0x44, 0x10, 0x88, 0x22, 0x10,
+    0x48, 0xc3, 0x80, 0x0, 0x0,
 
     /* U+5230 "到" */
-    0xb, 0xb6, 0x75, 0xde, 0x0, 0xea, 0xb, 0xb5,
-    0x45, 0xde, 0x5, 0x0, 0x84, 0x2, 0xd7, 0x2,
-    0x0, 0xf, 0x0, 0x7e, 0x10, 0x46, 0x0, 0xfe,
-    0x6d, 0x0, 0x3e, 0x98, 0x7, 0xd5, 0x4d, 0xaa,
-    0x41, 0xf8, 0x7, 0xd5, 0x97, 0x3d, 0x31, 0xc0,
-    0x1f, 0xe6, 0x20, 0x1, 0x0, 0x7c, 0xb7, 0x69,
-    0xbb, 0x98, 0x3, 0xe5, 0xbb, 0x4d, 0xdc, 0xc2,
-    0x1, 0xff, 0xc3, 0xb0, 0xf, 0xf0, 0xa3, 0x0,
-    0x7c, 0xd1, 0x73, 0x50, 0x64, 0x1, 0xf1, 0xdd,
-    0xb3, 0x12, 0xe8, 0x0, 0x9c, 0xc6, 0x80,
+    0x7f, 0x82, 0x0, 0x4, 0x40, 0x88, 0x81, 0x10,
+    0x12, 0x2f, 0xf4, 0x40, 0x8, 0x80, 0x11, 0x3f,
+    0x22, 0x0, 0x44, 0x0, 0x8, 0x0, 0x13, 0xe0,
+    0x20, 0x3, 0x80,
 
     /* U+523B "刻" */
-    0x0, 0xc6, 0xe0, 0x1f, 0xa8, 0x8, 0xcc, 0xbc,
-    0x67, 0x3, 0x0, 0x42, 0x15, 0x76, 0x91, 0xbb,
-    0x86, 0x80, 0x3a, 0x21, 0xf3, 0x11, 0x84, 0x3,
-    0xe4, 0xe6, 0x6, 0x50, 0xf, 0xd3, 0x52, 0x5,
-    0xaa, 0x1, 0xfa, 0x6e, 0xc5, 0xd4, 0x1, 0xfe,
-    0x5d, 0xce, 0x11, 0x40, 0x7, 0xe5, 0xdf, 0x20,
-    0xbc, 0x0, 0xfa, 0x76, 0xc4, 0x23, 0x50, 0x3,
-    0xe9, 0x80, 0x4, 0x13, 0x80, 0x34, 0x3, 0xf5,
-    0xb, 0x18, 0x0, 0x40, 0x3c, 0x79, 0xd3, 0xbe,
-    0x80, 0x1f, 0x4d, 0xea, 0x0, 0xec, 0x0, 0x12,
-    0x68, 0xc2, 0x60, 0x40, 0x21, 0xc0, 0x2, 0x45,
-    0xc0,
+    0x0, 0x2, 0x8, 0x5, 0xfe, 0x88, 0x1, 0x11,
+    0x2, 0x2c, 0x44, 0x45, 0x8, 0x84, 0x51, 0x11,
+    0x22, 0xc4, 0x44, 0x18, 0x8, 0x70, 0x11, 0x10,
+    0x2c, 0x11, 0xc0, 0x0, 0x0,
 
     /* U+524D "前" */
-    0x0, 0xff, 0xe3, 0x8d, 0x0, 0x7a, 0x50, 0x3,
-    0xc3, 0x8e, 0x1, 0x90, 0x10, 0x3, 0x55, 0xdb,
-    0x62, 0xef, 0x52, 0xdd, 0xa8, 0x1, 0x57, 0x77,
-    0xdd, 0xee, 0xcb, 0xb5, 0x0, 0x44, 0xab, 0x20,
-    0x7, 0x98, 0x3, 0x71, 0x9d, 0x90, 0x3, 0x20,
-    0xa, 0x0, 0xce, 0xcd, 0x50, 0x81, 0x80, 0x7e,
-    0x5a, 0xaa, 0x40, 0x3f, 0xe5, 0xaa, 0xa4, 0x3,
-    0xfe, 0x71, 0x19, 0x80, 0x3f, 0xe1, 0x88, 0xb8,
-    0x3, 0xfe, 0x69, 0x9a, 0x0, 0x5, 0x60, 0x1f,
-    0xfc, 0x32, 0x0, 0xf8, 0x40, 0x6e, 0x70, 0x0,
-    0x57, 0x65, 0x0, 0xd4, 0x3, 0x76, 0x50, 0x1,
-    0x5d, 0xa4, 0x0,
+    0x0, 0x0, 0x8, 0x10, 0x0, 0x10, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x23, 0x24, 0x21, 0x24,
+    0x3f, 0x24, 0x21, 0x24, 0x21, 0x24, 0x3f, 0x24,
+    0x21, 0x4, 0x21, 0x4, 0x26, 0x1c, 0x0, 0x0,
 
     /* U+529B "力" */
-    0x0, 0xf5, 0x80, 0x7f, 0xf0, 0x5c, 0x3, 0xff,
-    0x92, 0x79, 0x9c, 0x79, 0x9e, 0x73, 0xcc, 0xdc,
-    0xb9, 0x9d, 0xda, 0x1, 0xcc, 0x40, 0x1c, 0x20,
-    0x1e, 0x3c, 0x0, 0xe7, 0x30, 0xe, 0xb4, 0x0,
-    0xe1, 0xe0, 0xc, 0x6a, 0x1, 0xe3, 0x10, 0xd,
-    0xf6, 0x1, 0xee, 0x20, 0xa, 0x10, 0x80, 0x3c,
-    0x4c, 0x0, 0x72, 0x80, 0xf, 0x98, 0x82, 0x7a,
-    0x80, 0x3e, 0x27, 0x6, 0xf9, 0x0, 0xe6, 0xcb,
-    0xe8, 0x6, 0x60, 0x7, 0x9b, 0x2f, 0xc, 0x0,
+    0x2, 0x0, 0x8, 0x0, 0x20, 0x1f, 0xfe, 0x2,
+    0x4, 0x8, 0x10, 0x0, 0x41, 0x0, 0x4, 0x0,
+    0x20, 0x21, 0x80, 0x84, 0x2, 0x60, 0x8, 0x1,
+    0xc0, 0x0, 0x0,
 
     /* U+52A0 "加" */
-    0x0, 0xa4, 0x3, 0xff, 0x84, 0x62, 0x1, 0xc2,
-    0x38, 0x3, 0x8, 0x80, 0x35, 0x57, 0x40, 0x5e,
-    0x2e, 0x62, 0xe8, 0x6, 0xee, 0xa2, 0xb, 0xc5,
-    0xcc, 0x5b, 0x0, 0x7f, 0xfa, 0x8c, 0x80, 0x3f,
-    0xf8, 0x2b, 0xe0, 0x13, 0x80, 0x7f, 0x6b, 0x80,
-    0x4, 0x40, 0x1f, 0xe1, 0x0, 0x19, 0x80, 0x3f,
-    0x47, 0x0, 0x4f, 0xc0, 0xf9, 0x96, 0x81, 0x1a,
-    0x84, 0xdc, 0x28, 0x36, 0x65, 0xa4, 0x4b, 0x0,
-    0x4d, 0xe9, 0x5, 0x0, 0x43, 0x0,
+    0x10, 0x0, 0x20, 0x0, 0x41, 0xfb, 0xfa, 0x11,
+    0x14, 0x22, 0x28, 0x44, 0x50, 0x88, 0xa1, 0x11,
+    0x42, 0x2, 0x84, 0x85, 0x9, 0xa, 0x14, 0x7,
+    0xe9, 0xc8, 0x40, 0x0, 0x0,
 
     /* U+5305 "包" */
-    0x0, 0x88, 0x80, 0x1f, 0xfc, 0x19, 0x0, 0xff,
-    0xe0, 0x92, 0x4d, 0xdf, 0xce, 0x1, 0xa3, 0x6a,
-    0xbf, 0x58, 0x4, 0xa4, 0x41, 0x1f, 0xc0, 0x11,
-    0x49, 0x5d, 0xf2, 0x80, 0x7a, 0x7a, 0xae, 0xf5,
-    0x70, 0x7, 0xac, 0x80, 0x3f, 0xfa, 0x53, 0x77,
-    0xab, 0x0, 0x2, 0xc0, 0x19, 0x6e, 0xf9, 0xc4,
-    0x4d, 0xa0, 0x1f, 0xf4, 0xc7, 0xb8, 0x7, 0xfd,
-    0x13, 0x1, 0x20, 0x1f, 0xfc, 0x24, 0x0, 0x93,
-    0x2e, 0xff, 0x64, 0x0,
+    0x0, 0x0, 0x20, 0x0, 0x7f, 0xc1, 0x0, 0x42,
+    0x0, 0x8f, 0xe1, 0x20, 0x22, 0x0, 0x44, 0x0,
+    0x88, 0x7e, 0x10, 0x80, 0x1, 0x3, 0x82, 0x0,
+    0x44, 0x0, 0x8f, 0xfe, 0x0,
 
     /* U+5316 "化" */
-    0x0, 0xc5, 0x20, 0xa, 0x0, 0xff, 0xae, 0x80,
-    0x2, 0x1, 0xfe, 0x33, 0x80, 0x3f, 0xf8, 0x3d,
-    0x60, 0x1f, 0x16, 0x10, 0x5, 0x44, 0x20, 0x1e,
-    0x6e, 0xe1, 0x0, 0x20, 0x8c, 0x3, 0x8a, 0xc7,
-    0x8, 0x0, 0xa3, 0x0, 0x1c, 0x91, 0x4e, 0x1,
-    0x96, 0x40, 0x3c, 0x94, 0x20, 0x1f, 0xfe, 0x74,
-    0x0, 0xff, 0xe1, 0xe9, 0x0, 0x7e, 0x70, 0xe,
-    0x52, 0x0, 0x98, 0x3, 0x2d, 0xde, 0xc4, 0x0,
+    0x4, 0x80, 0x8, 0x80, 0x8, 0x80, 0x10, 0x84,
+    0x30, 0x88, 0x70, 0xa0, 0x50, 0xc0, 0x10, 0x80,
+    0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x10, 0x82,
+    0x10, 0x82, 0x10, 0xfe,
 
     /* U+5317 "北" */
-    0x0, 0xea, 0x0, 0xa8, 0x3, 0xfe, 0x60, 0x9,
-    0x80, 0x3f, 0xfa, 0xc3, 0x6c, 0x0, 0xbc, 0xc8,
-    0xc0, 0x39, 0x37, 0x98, 0x1, 0x79, 0x91, 0x80,
-    0x43, 0x5d, 0xaa, 0x1, 0xff, 0x1c, 0xd0, 0x80,
-    0x7f, 0xf0, 0x8, 0xc0, 0x3f, 0xf9, 0xc2, 0x1,
-    0xff, 0xc0, 0x29, 0xb3, 0x0, 0xfc, 0xe4, 0x4c,
-    0x8a, 0xb2, 0x0, 0xfd, 0xc0, 0x5b, 0x46, 0x1,
-    0xfe, 0x22, 0x0, 0x80, 0x4c, 0x1, 0x2e, 0x66,
-    0x20,
+    0x4, 0x40, 0x4, 0x40, 0x4, 0x40, 0x4, 0x44,
+    0x7c, 0x48, 0x4, 0x70, 0x4, 0x40, 0x4, 0x40,
+    0x4, 0x40, 0x4, 0x40, 0x1c, 0x40, 0x64, 0x42,
+    0x4, 0x42, 0x4, 0x7e,
 
     /* U+533A "区" */
-    0xc, 0xcf, 0xfe, 0x5, 0x1, 0x36, 0x67, 0xfd,
-    0x40, 0x1f, 0xf4, 0x90, 0x7, 0x85, 0x40, 0x31,
-    0x9, 0x0, 0x78, 0x4e, 0x44, 0x1, 0x70, 0x1,
-    0xf9, 0xa2, 0x8, 0xf6, 0x1, 0xfe, 0x19, 0xfa,
-    0x0, 0xff, 0xe0, 0x47, 0x67, 0x20, 0x7, 0xf4,
-    0xea, 0x8e, 0xc2, 0x80, 0x78, 0xf3, 0x54, 0x0,
-    0x39, 0xc0, 0x1e, 0x4d, 0x40, 0xe, 0xb0, 0xf,
-    0x38, 0x80, 0x7f, 0xc9, 0x77, 0xff, 0xc0, 0x23,
-    0x7b, 0xbf, 0xfe, 0x1, 0x0,
+    0x7f, 0xfc, 0x80, 0x1, 0x0, 0x82, 0x1, 0x4,
+    0x44, 0x8, 0x40, 0x10, 0x60, 0x21, 0x20, 0x44,
+    0x20, 0x90, 0x21, 0x0, 0x2, 0x0, 0x7, 0xff,
+    0xc8, 0x0, 0x0,
 
     /* U+5341 "十" */
-    0x0, 0xf9, 0x58, 0x3, 0xff, 0x84, 0x60, 0x1f,
-    0xfe, 0xdb, 0xcc, 0xeb, 0xb6, 0x67, 0x58, 0x2,
-    0xf3, 0x3a, 0xed, 0x99, 0xd6, 0x1, 0xff, 0xff,
-    0x0, 0xff, 0xe8, 0x99, 0x80, 0x3e,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+5343 "千" */
-    0x0, 0xfc, 0x28, 0xf7, 0x61, 0x0, 0xc8, 0xd1,
-    0x57, 0xba, 0x33, 0x55, 0x88, 0x6, 0x22, 0x55,
-    0x2e, 0xd4, 0xe8, 0x20, 0x1e, 0x64, 0x20, 0xf,
-    0xff, 0x5, 0xe6, 0x75, 0xdb, 0x33, 0xac, 0x1,
-    0x79, 0x9d, 0x76, 0xcc, 0xeb, 0x0, 0xff, 0xff,
-    0x80, 0x7f, 0xf0, 0x8c, 0x3, 0xe0,
+    0x0, 0x18, 0xf, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+534A "半" */
-    0x0, 0x13, 0x0, 0x4c, 0xa0, 0x12, 0x90, 0x6,
-    0x2d, 0x20, 0x0, 0x80, 0x43, 0x4, 0x1, 0xd1,
-    0x0, 0xf, 0x44, 0x80, 0x78, 0xc0, 0x3c, 0x46,
-    0x80, 0x1f, 0x50, 0x7, 0x15, 0x0, 0x7a, 0xb3,
-    0x35, 0x46, 0x66, 0xb0, 0xd, 0x59, 0x9a, 0xa3,
-    0x33, 0x58, 0x7, 0xff, 0x1c, 0x48, 0xbb, 0xc8,
-    0xbc, 0x20, 0xb, 0x88, 0xe4, 0xb8, 0x8e, 0xb0,
-    0x5, 0x57, 0xae, 0x6a, 0xbc, 0x1, 0xff, 0xdc,
-    0x10, 0xf, 0xc0,
+    0x0, 0x0, 0x10, 0x8, 0x8, 0x10, 0x8, 0x10,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+5357 "南" */
-    0x0, 0xf2, 0x30, 0x7, 0xd5, 0x77, 0xd3, 0x77,
-    0xea, 0xa, 0xbb, 0xe5, 0xeb, 0xbe, 0xa0, 0xf,
-    0x84, 0x80, 0x3f, 0x4d, 0xde, 0x4a, 0xbb, 0xd2,
-    0x1, 0x15, 0xd8, 0xeb, 0x6e, 0x8e, 0xec, 0xa0,
-    0x13, 0x80, 0x2e, 0x40, 0x13, 0x60, 0x1f, 0x9e,
-    0x4e, 0xa8, 0xd3, 0x20, 0xf, 0x9e, 0xaf, 0x3f,
-    0xaa, 0x40, 0x3f, 0xf9, 0x55, 0x55, 0xcd, 0x54,
-    0x20, 0x1e, 0xaa, 0xae, 0x6a, 0xa1, 0x0, 0xff,
-    0xe3, 0xb0, 0x7, 0x8, 0x15, 0xd3, 0x80, 0x0,
+    0x0, 0x1, 0xff, 0xf8, 0x8, 0x0, 0x10, 0x7,
+    0xff, 0x89, 0x9, 0x11, 0x22, 0x27, 0xf4, 0x40,
+    0x8, 0x80, 0x11, 0x7f, 0xa2, 0x0, 0x44, 0x0,
+    0x88, 0x7, 0x0,
 
     /* U+5374 "却" */
-    0x0, 0xd2, 0x20, 0x15, 0x66, 0x68, 0x0, 0xc6,
-    0x1, 0x9b, 0x33, 0x20, 0x2d, 0xd9, 0x36, 0xe4,
-    0x3, 0xf2, 0xdd, 0x93, 0x6e, 0x40, 0x3f, 0xfb,
-    0x23, 0x76, 0xc4, 0xdb, 0xb2, 0x0, 0x78, 0x6e,
-    0xe8, 0xcb, 0xb2, 0x0, 0x7f, 0x5b, 0x80, 0x7f,
-    0xf0, 0x9, 0x84, 0x2c, 0x3, 0xe7, 0x0, 0x57,
-    0x0, 0x39, 0xc0, 0x21, 0xcc, 0x81, 0x58, 0xe2,
-    0xba, 0x40, 0x21, 0xcc, 0x38, 0x15, 0x9d, 0xc5,
-    0xd9, 0x80, 0x3e, 0x75, 0x43, 0x20, 0x56, 0x70,
-    0xe,
+    0x8, 0x7e, 0x10, 0x84, 0xfd, 0x8, 0x42, 0x10,
+    0x84, 0x21, 0x8, 0x5f, 0xd0, 0x80, 0x21, 0x10,
+    0x42, 0x24, 0x84, 0x81, 0x31, 0x7a, 0x0, 0x4,
+    0x0, 0x8, 0x0,
 
     /* U+539F "原" */
-    0x0, 0x45, 0xdf, 0x67, 0x5d, 0xf0, 0x4, 0x97,
-    0x7d, 0x2d, 0x77, 0xc0, 0x1f, 0xdb, 0x80, 0x1f,
-    0xf5, 0x54, 0x9d, 0x55, 0x30, 0x7, 0x84, 0x2a,
-    0x99, 0x55, 0xc0, 0x1f, 0x3c, 0x47, 0xc0, 0x1c,
-    0xe0, 0x7, 0x99, 0xf8, 0x3, 0xf8, 0x47, 0xe0,
-    0xf, 0x84, 0x2a, 0xac, 0xaa, 0xc0, 0x11, 0x10,
-    0x1, 0x51, 0x56, 0xd5, 0x76, 0x60, 0x9, 0xfc,
-    0x1, 0x2e, 0x1, 0xd6, 0xa0, 0x17, 0x20, 0xd6,
-    0x28, 0x6, 0x1a, 0x28, 0x1, 0x2, 0x68, 0x50,
-    0xf, 0x9f, 0x44, 0x52, 0xe, 0x40, 0x75, 0x7a,
-    0x1, 0x94, 0x40,
+    0x3f, 0xfe, 0x20, 0x40, 0x20, 0x80, 0x27, 0xf8,
+    0x24, 0x4, 0x27, 0xfc, 0x24, 0x4, 0x24, 0x4,
+    0x27, 0xf8, 0x20, 0x40, 0x4, 0x48, 0x48, 0x42,
+    0x40, 0x40, 0x1, 0x80,
 
     /* U+53BB "去" */
-    0x0, 0xf9, 0x94, 0x3, 0xff, 0x86, 0x60, 0x1f,
-    0xd1, 0x99, 0xae, 0xd9, 0x9a, 0x40, 0x34, 0x66,
-    0x6b, 0xb6, 0x66, 0x90, 0xf, 0xfe, 0xbd, 0xe6,
-    0x75, 0xdb, 0x33, 0xac, 0x1, 0x79, 0x98, 0x73,
-    0x73, 0x3a, 0xc0, 0x3c, 0xca, 0x20, 0x1f, 0xfc,
-    0x1a, 0x90, 0x8, 0xac, 0x3, 0xf2, 0xa0, 0x80,
-    0x45, 0xd2, 0x1, 0xf4, 0xc8, 0x3, 0x94, 0x18,
-    0x2, 0x39, 0xb2, 0xbb, 0xf8, 0xa0, 0x80, 0x5,
-    0x51, 0x97, 0x7f, 0xb6, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x2, 0x0,
+    0x2, 0x0, 0x4, 0x10, 0x4, 0x8, 0x8, 0x8,
+    0x3f, 0xfc, 0x0, 0x2,
 
     /* U+53C8 "又" */
-    0x4, 0xcc, 0xff, 0x6a, 0x80, 0x49, 0x97, 0xb9,
-    0x9f, 0x32, 0x0, 0x71, 0x30, 0x7, 0x88, 0x4,
-    0x3, 0x96, 0xc0, 0x3d, 0x7e, 0x1, 0xf5, 0xb0,
-    0x6, 0x25, 0x40, 0xf, 0x9e, 0x84, 0x2, 0x9f,
-    0x0, 0xfe, 0x8b, 0x0, 0x3e, 0x18, 0x7, 0xf2,
-    0x1b, 0xb6, 0xb8, 0x7, 0xfd, 0x35, 0x74, 0x1,
-    0xff, 0xc0, 0x96, 0x18, 0x0, 0xff, 0x26, 0xf5,
-    0xe0, 0xe1, 0x0, 0x79, 0x2f, 0xfc, 0xe0, 0x9,
-    0xfe, 0xa3, 0x0, 0xb3, 0xa2, 0xc8, 0x3, 0x1e,
-    0x74, 0xe0, 0x3, 0x28, 0xc0, 0x3f, 0x25, 0x60,
-    0x0,
+    0x3f, 0xf8, 0x0, 0x8, 0x0, 0x8, 0x8, 0x10,
+    0x0, 0x10, 0x4, 0x20, 0x2, 0x0, 0x2, 0x40,
+    0x1, 0x80, 0x3, 0xc0, 0x4, 0x60, 0x18, 0x18,
+    0x60, 0x6, 0x0, 0x0,
 
     /* U+53CB "友" */
-    0x0, 0xe5, 0x50, 0x7, 0xff, 0xb, 0x58, 0x3,
-    0xfd, 0x17, 0x73, 0x7d, 0xdf, 0xd0, 0x0, 0x8b,
-    0xb8, 0xb2, 0xef, 0xe8, 0x0, 0xff, 0xe4, 0x93,
-    0x91, 0x78, 0x40, 0x3e, 0x44, 0x5d, 0xf4, 0x68,
-    0x7, 0xd8, 0xb9, 0x33, 0xb2, 0x80, 0x3e, 0x6a,
-    0xe0, 0xd, 0x4c, 0x1, 0xe6, 0xb0, 0xf9, 0x0,
-    0x4c, 0x0, 0x7d, 0x4c, 0x9, 0x90, 0xfe, 0x80,
-    0x1e, 0x74, 0x10, 0x3, 0x25, 0x90, 0x7, 0x8e,
-    0xe0, 0xe, 0xa9, 0x98, 0x3b, 0x50, 0xd, 0xfa,
-    0x59, 0x71, 0x20, 0x7, 0xa3, 0xba, 0x0,
+    0x0, 0x0, 0x4, 0x0, 0x7f, 0xfe, 0x4, 0x0,
+    0x4, 0x0, 0x4, 0x0, 0x7, 0xf8, 0xc, 0x0,
+    0xa, 0x10, 0x1, 0x20, 0x10, 0x80, 0x10, 0xc0,
+    0x23, 0x10, 0x4c, 0x6,
 
     /* U+53CD "反" */
-    0x0, 0x5e, 0x67, 0xf9, 0x40, 0xf, 0x99, 0xfe,
-    0x50, 0xf, 0xfe, 0x91, 0x5f, 0xdd, 0xfb, 0x58,
-    0x2, 0x2b, 0x7f, 0xbb, 0xe6, 0x70, 0x9, 0xc2,
-    0x7c, 0x3, 0x21, 0x8, 0x0, 0x84, 0x4, 0xd0,
-    0x2, 0xf8, 0x0, 0x9b, 0x40, 0x11, 0xe2, 0x13,
-    0xe2, 0x1, 0x61, 0x80, 0x55, 0x49, 0xc4, 0x0,
-    0xc8, 0x80, 0x9, 0x1d, 0x48, 0x3, 0x22, 0x80,
-    0x16, 0xf7, 0x30, 0x38, 0xc2, 0x7, 0x5, 0x85,
-    0x50, 0x0, 0x6c, 0x3a, 0xa0,
+    0x3f, 0xf8, 0x80, 0x2, 0x0, 0x8, 0x0, 0x3f,
+    0xf0, 0xa0, 0x42, 0x41, 0x9, 0x8, 0x2, 0x41,
+    0x6, 0x4, 0x18, 0x11, 0x88, 0x10, 0xc,
 
     /* U+53D4 "叔" */
-    0x0, 0xd4, 0x1, 0xff, 0xc3, 0x60, 0x9, 0xfa,
-    0xee, 0xc7, 0x0, 0xe2, 0xbb, 0x3b, 0x96, 0xee,
-    0x92, 0x0, 0xe2, 0xbb, 0x38, 0x7, 0x6b, 0x0,
-    0x7f, 0x8c, 0x80, 0x6, 0x60, 0x5, 0xdc, 0x77,
-    0x72, 0xe2, 0x0, 0x88, 0x2, 0xbb, 0x9a, 0x6e,
-    0xca, 0x98, 0xf, 0xe0, 0x18, 0x80, 0x23, 0x10,
-    0x0, 0x85, 0x28, 0x6, 0x90, 0xd, 0x20, 0xd,
-    0xa4, 0x0, 0xc6, 0x60, 0x8, 0xcc, 0x0, 0x75,
-    0x90, 0xd, 0x34, 0x1, 0xb1, 0x1, 0x8d, 0x0,
-    0x21, 0x22, 0x0, 0x67, 0x44, 0x76, 0x70, 0x80,
-    0x6, 0x0, 0x3c, 0xbf, 0x21, 0x3a, 0x20, 0x12,
-    0xd2, 0x90, 0x3e, 0x58, 0x0, 0xbb, 0x44, 0x0,
-    0xb5, 0x80, 0x7, 0x90, 0xc, 0x58, 0x20,
+    0x8, 0x0, 0x8, 0x7c, 0xe, 0x40, 0x8, 0x44,
+    0x8, 0x44, 0x7f, 0x4, 0x8, 0x20, 0x8, 0x28,
+    0x29, 0x18, 0x29, 0x10, 0x48, 0x10, 0x48, 0x28,
+    0x8, 0x44, 0x18, 0x82, 0x0, 0x0,
 
     /* U+53D6 "取" */
-    0xb, 0xfb, 0xbb, 0x74, 0x80, 0x1f, 0xad, 0x2e,
-    0xea, 0x94, 0x0, 0xff, 0xe1, 0xd6, 0x67, 0x50,
-    0x7, 0xf7, 0x5e, 0x65, 0xe4, 0x1, 0x35, 0xdd,
-    0x40, 0xba, 0x1, 0x26, 0x0, 0x4d, 0x77, 0x50,
-    0xb, 0x0, 0x58, 0x80, 0x1f, 0xe4, 0x40, 0x8,
-    0x7, 0x35, 0xdd, 0x40, 0xa, 0xe0, 0x6e, 0x0,
-    0xcd, 0x77, 0x50, 0x0, 0x84, 0xed, 0x40, 0x3f,
-    0xf8, 0x11, 0xb2, 0x1, 0xce, 0x8f, 0x34, 0x1,
-    0x30, 0x80, 0x63, 0xb5, 0x23, 0x8a, 0x0, 0x27,
-    0x72, 0x50, 0x0, 0x77, 0x2c, 0x82, 0x0, 0x8f,
-    0xb1, 0xd8, 0x70, 0xf, 0x84, 0xba, 0xc0, 0x3,
-    0x9e, 0x40,
+    0x7f, 0x0, 0x20, 0x0, 0x20, 0xfe, 0x20, 0x2,
+    0x3e, 0x40, 0x20, 0x44, 0x20, 0x44, 0x3e, 0x20,
+    0x20, 0x28, 0x20, 0x10, 0x26, 0x10, 0x60, 0x28,
+    0x0, 0xc4, 0x0, 0x2,
 
     /* U+53D7 "受" */
-    0x0, 0xff, 0xe1, 0x1d, 0x57, 0x4c, 0x3b, 0x2a,
-    0x0, 0xe, 0xae, 0xaa, 0xc8, 0x76, 0x50, 0x10,
-    0xa, 0x80, 0x2f, 0x20, 0x0, 0xc0, 0x80, 0x5a,
-    0xc0, 0xe, 0x40, 0x4, 0x40, 0x0, 0xb7, 0xba,
-    0xbb, 0x7e, 0xdd, 0x9b, 0xed, 0x7a, 0xef, 0xfb,
-    0xee, 0xdd, 0x80, 0x1f, 0xfc, 0x3, 0x70, 0xac,
-    0xbb, 0xf6, 0x38, 0x40, 0x2, 0x9e, 0xae, 0xf8,
-    0x14, 0x3, 0xaa, 0x82, 0x1, 0x54, 0x90, 0x7,
-    0xc, 0xd1, 0x8d, 0xf2, 0x80, 0x7c, 0x51, 0xbf,
-    0xe4, 0x0, 0xf1, 0x35, 0xd6, 0x7e, 0x5b, 0x10,
-    0x2, 0x32, 0xca, 0xe4, 0x86, 0x2c, 0xef, 0x20,
+    0x0, 0x1, 0xfc, 0x0, 0x0, 0x8, 0x84, 0x0,
+    0x21, 0xff, 0xe8, 0x0, 0x40, 0x1, 0x3f, 0xe0,
+    0x40, 0x80, 0x84, 0x1, 0x20, 0x3, 0x0, 0x33,
+    0xe, 0x1, 0xc0,
 
     /* U+53E3 "口" */
-    0x8c, 0xcf, 0xf4, 0x26, 0x67, 0xf9, 0x0, 0x3f,
-    0xff, 0xe0, 0x1f, 0xfc, 0xac, 0xcf, 0xf0, 0x3,
-    0x33, 0xfc, 0x1e, 0x1, 0xfe, 0xe0,
+    0xff, 0xf8, 0x1, 0x80, 0x18, 0x1, 0x80, 0x18,
+    0x1, 0x80, 0x18, 0x1, 0x80, 0x18, 0x1, 0xff,
+    0xf8, 0x1, 0x0, 0x0,
 
     /* U+53E4 "古" */
-    0x0, 0xf9, 0x54, 0x1, 0xff, 0xc2, 0x33, 0x0,
-    0x7e, 0x12, 0x2e, 0x11, 0x11, 0x70, 0x80, 0x22,
-    0x3d, 0x76, 0x88, 0xf0, 0x2, 0x6a, 0xbf, 0xf8,
-    0x12, 0x1, 0xff, 0xd7, 0x1b, 0xbf, 0xf0, 0x80,
-    0x62, 0x3b, 0xbb, 0x75, 0x77, 0x62, 0x80, 0x7f,
-    0xf0, 0xc4, 0x3, 0xff, 0xb2, 0xb5, 0x5f, 0xc0,
-    0x1e, 0x5b, 0xbf, 0xd4, 0x20, 0x18, 0xe0, 0x47,
-    0xf3, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
+    0x10, 0x0, 0x10, 0x0, 0x10, 0x0, 0x10, 0x0,
+    0x1f, 0xf8, 0x10, 0x0, 0x0, 0x0,
 
     /* U+53E5 "句" */
-    0x0, 0x8d, 0xc0, 0x3f, 0xf8, 0x12, 0xa0, 0x1f,
-    0xf1, 0x27, 0x66, 0x7e, 0x60, 0x4, 0x66, 0x7f,
-    0x76, 0x2, 0x19, 0x0, 0x7f, 0x8a, 0x26, 0x2e,
-    0xf4, 0x0, 0x42, 0x71, 0xc0, 0x97, 0x79, 0x0,
-    0x27, 0x1a, 0x20, 0xf, 0xf0, 0xf8, 0x7, 0xff,
-    0x0, 0xc4, 0x3, 0xff, 0x80, 0x24, 0x1, 0x15,
-    0xde, 0x70, 0xb, 0x9c, 0x2, 0x5b, 0xbe, 0x0,
-    0x88, 0x80, 0x15, 0x80, 0x7e, 0x61, 0x0, 0xfc,
-    0xf9, 0x7b, 0x0, 0x1f, 0xcf, 0x97, 0xaa, 0x0,
+    0x0, 0x0, 0x40, 0x1, 0xff, 0x88, 0x1, 0x20,
+    0x5, 0x7e, 0x19, 0x8, 0x44, 0x20, 0x10, 0x80,
+    0x42, 0x1, 0xf8, 0x84, 0x2, 0x0, 0x8, 0x1,
+    0xc0, 0x0, 0x0,
 
     /* U+53EA "只" */
-    0x2, 0xdc, 0xcf, 0xe4, 0x0, 0x35, 0x66, 0x7e,
-    0x83, 0x0, 0xff, 0xfe, 0xd5, 0xdf, 0xe8, 0x0,
-    0x93, 0x2e, 0xff, 0x63, 0x0, 0x42, 0x2c, 0x0,
-    0x86, 0x88, 0x4, 0x2, 0x2d, 0xf0, 0x8, 0x6e,
-    0x54, 0x2, 0x5e, 0xe1, 0x80, 0x61, 0xbc, 0x80,
-    0x8d, 0xc2, 0x0, 0xfa, 0x41, 0x80,
+    0x3f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
+    0x21, 0x1, 0x2, 0x8, 0x6, 0xc0, 0x8,
 
     /* U+53EB "叫" */
-    0x0, 0xff, 0xa8, 0x0, 0xf7, 0x74, 0x0, 0x24,
-    0x2, 0x10, 0x6, 0x5d, 0xc6, 0x0, 0x50, 0xf,
-    0xff, 0xf8, 0x7, 0xff, 0x12, 0xee, 0xd0, 0xc,
-    0x28, 0xd3, 0x20, 0xbb, 0x9d, 0xd4, 0x55, 0x4,
-    0x37, 0x32, 0x0, 0x85, 0x2f, 0xaa, 0x59, 0xc8,
-    0x8, 0x3, 0x18, 0x80, 0x7f, 0xf1, 0x84, 0x0,
+    0x0, 0x11, 0xe4, 0x48, 0x91, 0x22, 0x44, 0x89,
+    0x12, 0x24, 0x48, 0x91, 0x22, 0x44, 0x89, 0x13,
+    0xc4, 0x78, 0x3d, 0x0, 0x4, 0x0, 0x10, 0x0,
+    0x40,
 
     /* U+53EF "可" */
-    0xb, 0xcc, 0xff, 0x7e, 0x58, 0x2, 0xf3, 0x3f,
-    0xc9, 0xb6, 0x1, 0xff, 0xc7, 0x1b, 0xcc, 0xd2,
-    0x1, 0xfc, 0xb9, 0x9c, 0x62, 0x1, 0xff, 0xed,
-    0x9c, 0xcc, 0xc2, 0x1, 0xfd, 0x39, 0x9c, 0x1,
-    0xfc, 0xa8, 0x1, 0xff, 0xc2, 0x13, 0x0, 0xfe,
-    0x10, 0xf, 0xfa, 0xf3, 0x0, 0x18,
+    0x7f, 0xfe, 0x0, 0x8, 0x0, 0x8, 0x1f, 0x88,
+    0x0, 0x88, 0x0, 0x88, 0x0, 0x88, 0x0, 0x88,
+    0x1f, 0x88, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0x0, 0x78,
 
     /* U+53F2 "史" */
-    0x0, 0xf1, 0x48, 0x7, 0xff, 0x8, 0xc0, 0x3f,
-    0x3d, 0xe6, 0x5c, 0x99, 0x9a, 0x40, 0x2b, 0xb6,
-    0x65, 0xc9, 0x99, 0x94, 0x3, 0xff, 0xaa, 0xd7,
-    0x7b, 0x92, 0xef, 0x0, 0x6a, 0xa5, 0xdd, 0xd,
-    0x77, 0xb0, 0x3, 0x59, 0x0, 0xb, 0x80, 0x3f,
-    0xa2, 0x40, 0x14, 0xe0, 0x1f, 0xc5, 0xd4, 0xe8,
-    0x20, 0x1f, 0xe5, 0x68, 0xd0, 0xf, 0xe2, 0x8b,
-    0x8d, 0xcd, 0x95, 0x20, 0xd, 0x57, 0x96, 0x85,
-    0x3b, 0xa2, 0x8c, 0xc5, 0x80,
+    0x1, 0x0, 0x2, 0x0, 0xff, 0xe2, 0x8, 0x44,
+    0x10, 0x88, 0x21, 0x1f, 0xfe, 0x0, 0x80, 0x20,
+    0x0, 0x24, 0x0, 0x28, 0x0, 0x60, 0x3, 0x38,
+    0x18, 0x7, 0x80,
 
     /* U+53F6 "叶" */
-    0x0, 0xfe, 0xa0, 0xe, 0x5b, 0xb9, 0x40, 0x33,
-    0x0, 0x77, 0x5d, 0xdc, 0x1, 0xff, 0xe0, 0x5c,
-    0xcc, 0x79, 0x98, 0x40, 0x32, 0xe6, 0x63, 0xcc,
-    0xc2, 0x1, 0xff, 0xd3, 0xbb, 0x88, 0x3, 0xfe,
-    0xbb, 0xa4, 0x3, 0xfd, 0x20, 0x1f, 0xfc, 0x22,
-    0x0, 0xff, 0xe5, 0xb8, 0x7, 0x0,
+    0x0, 0x40, 0xe0, 0x82, 0x21, 0x4, 0x42, 0x8,
+    0x84, 0x11, 0xff, 0xa2, 0x10, 0x44, 0x20, 0x88,
+    0x41, 0xf0, 0x82, 0x1, 0x0, 0x2, 0x0, 0x4,
+    0x0, 0x8, 0x0,
 
     /* U+5403 "吃" */
-    0x0, 0xf8, 0x40, 0x3f, 0xf8, 0x5a, 0x1, 0xf3,
-    0x66, 0x24, 0x0, 0x4c, 0x1, 0xf6, 0xe6, 0x8,
-    0x1, 0x6f, 0x77, 0xd0, 0x1, 0xe2, 0x26, 0xdd,
-    0xf4, 0x0, 0x7b, 0xa4, 0x3, 0xff, 0x83, 0xcf,
-    0x77, 0xd0, 0x1, 0xf1, 0x2d, 0xdd, 0xad, 0x20,
-    0x1f, 0xf3, 0xd6, 0x8, 0x7, 0xfa, 0x33, 0x2,
-    0x1, 0xaa, 0x8e, 0x1, 0x39, 0x58, 0x7, 0xae,
-    0xd8, 0x0, 0x6d, 0xa0, 0xc, 0x41, 0x2, 0x20,
-    0x1, 0x55, 0x0, 0x3a, 0x40, 0xc0, 0x35, 0x48,
-    0x7, 0x9c, 0x3, 0xd7, 0x39, 0x9e, 0xb0,
+    0x0, 0x0, 0x2, 0x1, 0xc4, 0x4, 0x9f, 0xe9,
+    0x20, 0x12, 0x80, 0x24, 0x7e, 0x48, 0x8, 0x90,
+    0x21, 0x21, 0x83, 0xc2, 0x4, 0x8, 0x0, 0x20,
+    0x40, 0x80, 0x80, 0xfe, 0x0,
 
     /* U+5404 "各" */
-    0x0, 0xe1, 0x40, 0xf, 0xfe, 0x15, 0xb8, 0x7,
-    0xff, 0x6, 0x12, 0x2e, 0xfa, 0x0, 0x3d, 0x2b,
-    0xb7, 0x7a, 0x9e, 0xc0, 0x30, 0xde, 0x6c, 0x18,
-    0x0, 0x76, 0xc, 0x3, 0x34, 0x28, 0x5c, 0xba,
-    0xef, 0xa0, 0x7, 0x39, 0x80, 0x51, 0x35, 0x6,
-    0x1, 0xfc, 0x75, 0x79, 0xd9, 0x68, 0x1, 0xc7,
-    0x19, 0x51, 0x24, 0x31, 0x59, 0x89, 0x40, 0x2b,
-    0xb4, 0x5, 0xcc, 0xe8, 0x1f, 0xac, 0x12, 0x83,
-    0x8b, 0xbf, 0xaa, 0xe, 0x4, 0x3, 0x11, 0x7e,
-    0x0, 0xff, 0xe6, 0x8, 0xfc, 0x60, 0x1f, 0x3d,
-    0xdf, 0xd0, 0x40, 0x10,
+    0x0, 0x0, 0x4, 0x0, 0xf, 0xf8, 0x18, 0x10,
+    0x24, 0x20, 0x2, 0x40, 0x1, 0x80, 0x6, 0x60,
+    0x38, 0x1c, 0x4f, 0xf2, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x1f, 0xf8,
 
     /* U+5408 "合" */
-    0x0, 0xfa, 0xe8, 0x3, 0xff, 0x83, 0x5d, 0xf2,
-    0x1, 0xff, 0x4e, 0xaa, 0xbe, 0x80, 0x3f, 0xab,
-    0xdc, 0x0, 0xdf, 0x64, 0x1, 0xc7, 0x9c, 0xc0,
-    0x19, 0x67, 0x98, 0x2, 0x99, 0x6f, 0x5d, 0xfa,
-    0x30, 0x70, 0x42, 0xa8, 0x35, 0x77, 0xea, 0x7,
-    0xc1, 0x3, 0x0, 0xff, 0xe2, 0xcd, 0xdf, 0xe9,
-    0x0, 0xf2, 0xdd, 0xfe, 0x50, 0xf, 0xff, 0x53,
-    0xd5, 0x7e, 0x70, 0x8,
+    0x1, 0x80, 0x2, 0x40, 0x4, 0x20, 0x8, 0x10,
+    0x10, 0x8, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x1f, 0xf8,
 
     /* U+540C "同" */
-    0x7c, 0xbb, 0xff, 0x60, 0x66, 0xdd, 0xff, 0x9c,
-    0x40, 0x3f, 0xf8, 0x83, 0x77, 0xf4, 0x80, 0x70,
-    0xdd, 0xfd, 0x20, 0x1f, 0xfc, 0x83, 0xcb, 0xbe,
-    0x0, 0xf9, 0x66, 0xef, 0x0, 0x7f, 0xf6, 0x66,
-    0xef, 0x10, 0x7, 0xe8, 0xbb, 0xd2, 0x1, 0xf3,
-    0x20, 0x7, 0xe1, 0x18, 0x3, 0xe1, 0xbb, 0x0,
-    0x28, 0x3, 0xf0, 0xdd, 0xc0,
+    0x7f, 0xfa, 0x0, 0x28, 0x0, 0xa7, 0xfa, 0x80,
+    0xa, 0x0, 0x28, 0xfc, 0xa0, 0x12, 0x80, 0x4a,
+    0x1, 0x28, 0xfc, 0xa0, 0x2, 0x80, 0xa, 0x0,
+    0xe0, 0x0, 0x0,
 
     /* U+540D "名" */
-    0x0, 0xe4, 0x90, 0xf, 0xf8, 0xa9, 0x6e, 0xf3,
-    0x0, 0x71, 0x4f, 0xe5, 0xdc, 0x4a, 0x1, 0x93,
-    0xf4, 0x40, 0x23, 0x3, 0x0, 0xa7, 0x37, 0xa0,
-    0x0, 0x31, 0x20, 0x1a, 0x20, 0x11, 0xd2, 0x37,
-    0x40, 0x1c, 0x20, 0x13, 0xe, 0xc0, 0x80, 0x7f,
-    0x2b, 0xb5, 0xcc, 0xe6, 0x0, 0x86, 0xaf, 0x62,
-    0xef, 0xa8, 0xe, 0x6a, 0x8, 0xbf, 0x0, 0xd5,
-    0x2c, 0x80, 0x3f, 0x86, 0x4c, 0x3, 0xff, 0xa4,
-    0xf7, 0x7f, 0x10,
+    0x2, 0x0, 0x1f, 0x80, 0x82, 0x4, 0x8, 0x6c,
+    0x40, 0xa, 0x0, 0x30, 0x0, 0xfe, 0xc, 0x4,
+    0xd0, 0x14, 0x40, 0x41, 0x1, 0x4, 0x4, 0x1f,
+    0xf0,
 
     /* U+540E "后" */
-    0x0, 0xf8, 0x91, 0xa2, 0xec, 0x80, 0x19, 0xaa,
-    0xb8, 0x89, 0x57, 0x64, 0x0, 0xdb, 0x75, 0x54,
-    0x32, 0x10, 0x7, 0xff, 0x33, 0x6e, 0xff, 0xe0,
-    0xd, 0xb7, 0x7f, 0xf0, 0x6, 0x10, 0xf, 0xfe,
-    0x13, 0x80, 0x26, 0xef, 0xe5, 0x0, 0xf8, 0xae,
-    0xfe, 0x90, 0xc, 0xe0, 0x1f, 0xfc, 0x24, 0x30,
-    0xf, 0xfe, 0x16, 0x58, 0x7, 0xff, 0x9, 0xc,
-    0x0, 0xb5, 0x5f, 0x0, 0x4b, 0x40, 0x12, 0x5d,
-    0xfc, 0xc0, 0x0,
+    0x0, 0x38, 0x1f, 0x0, 0x20, 0x0, 0x20, 0x0,
+    0x3f, 0xfe, 0x20, 0x0, 0x20, 0x0, 0x27, 0xf8,
+    0x24, 0x4, 0x24, 0x4, 0x24, 0x4, 0x44, 0x4,
+    0x47, 0xfc, 0x4, 0x4,
 
     /* U+5411 "向" */
-    0x0, 0xf6, 0x0, 0x7f, 0xf0, 0x15, 0x0, 0x3f,
-    0x4e, 0x65, 0x69, 0x99, 0xd6, 0xc0, 0x59, 0x97,
-    0x66, 0x7a, 0xe8, 0x40, 0x3f, 0xf8, 0xc2, 0x38,
-    0x3, 0xfa, 0xe2, 0x36, 0x0, 0x7f, 0x4c, 0xe5,
-    0x20, 0xf, 0xfe, 0x79, 0x80, 0x7c, 0xd7, 0x78,
-    0x84, 0x3, 0xe5, 0xbb, 0xe0, 0xf, 0xd0, 0x1,
-    0xfc, 0x22, 0x0, 0xfd, 0x59, 0x8b,
+    0x2, 0x0, 0x8, 0x7, 0xff, 0x90, 0x1, 0x40,
+    0x5, 0x0, 0x14, 0xfc, 0x52, 0x11, 0x48, 0x45,
+    0x21, 0x14, 0xfc, 0x52, 0x1, 0x40, 0x5, 0x0,
+    0xe0,
 
     /* U+5427 "吧" */
-    0x0, 0xf5, 0xdd, 0xd7, 0x74, 0x2, 0xdd, 0xa0,
-    0x0, 0xf7, 0x65, 0xbb, 0x8c, 0x3a, 0xec, 0x60,
-    0x1f, 0xce, 0x1, 0xff, 0xf7, 0x3b, 0xb3, 0xdd,
-    0xc0, 0x1f, 0x8e, 0xed, 0x97, 0x72, 0x80, 0x2e,
-    0xc2, 0x1, 0xfd, 0x20, 0xb, 0xb5, 0x0, 0x7f,
-    0xdc, 0x1, 0xff, 0xc0, 0x64, 0x50, 0xf, 0xfe,
-    0x7, 0xb8, 0x7, 0x93, 0x2e, 0xf8, 0xcc,
+    0x3, 0xfc, 0xe4, 0x8a, 0x49, 0x14, 0x92, 0x29,
+    0x24, 0x52, 0x48, 0xa4, 0x91, 0x49, 0xfe, 0x92,
+    0x5, 0xe4, 0x2, 0x8, 0x0, 0x10, 0x0, 0x20,
+    0x40, 0x7f, 0x80,
 
     /* U+542C "听" */
-    0x0, 0xfe, 0x15, 0xac, 0x0, 0x2d, 0xdc, 0xa0,
-    0xb5, 0x94, 0x53, 0x80, 0xe, 0xbb, 0xa4, 0x26,
-    0x32, 0xdc, 0xc0, 0x3f, 0xc4, 0x1, 0xff, 0xd0,
-    0x1c, 0xcf, 0x59, 0x0, 0x78, 0x73, 0x27, 0xdc,
-    0xb2, 0x0, 0xf3, 0x80, 0x7f, 0xf0, 0x44, 0x40,
-    0x1f, 0xd7, 0x74, 0xa6, 0x0, 0x7f, 0x5d, 0xcb,
-    0xe8, 0x1, 0xfa, 0x40, 0x22, 0x2, 0x0, 0xfc,
-    0x40, 0x14, 0xc8, 0x3, 0xff, 0x80, 0xfa, 0x60,
-    0x18, 0x44, 0x1, 0x0,
+    0x0, 0x18, 0xe3, 0x82, 0x28, 0x4, 0x50, 0x8,
+    0xa0, 0x11, 0x7f, 0xa2, 0x88, 0x45, 0x10, 0x8a,
+    0x21, 0xe0, 0x42, 0x10, 0x80, 0x21, 0x0, 0x82,
+    0x0, 0x4, 0x0,
 
     /* U+5440 "呀" */
-    0x0, 0xe4, 0xcc, 0xef, 0xcb, 0x15, 0xbb, 0x95,
-    0x33, 0x38, 0xf2, 0xc7, 0xae, 0xee, 0x4, 0x20,
-    0xf, 0xfe, 0xf, 0x18, 0x7, 0xff, 0x5, 0x84,
-    0x3, 0xff, 0x80, 0x2e, 0x1, 0xff, 0xc1, 0x46,
-    0xcc, 0xb8, 0xf2, 0xc8, 0x3, 0x87, 0xf3, 0x1e,
-    0xa7, 0x96, 0x40, 0x1c, 0x84, 0x5, 0xf4, 0x1,
-    0xd7, 0x77, 0x0, 0xf, 0xb8, 0x20, 0x18, 0xae,
-    0xe5, 0x5, 0xfd, 0x20, 0xe, 0x90, 0x8, 0x6b,
-    0x30, 0x20, 0x1f, 0xc9, 0xbd, 0x20, 0x1f, 0xf2,
-    0x62, 0x0, 0x1b, 0x31, 0x60, 0x10,
+    0x3, 0xfc, 0xe0, 0x22, 0x20, 0x44, 0x50, 0x88,
+    0xa1, 0x11, 0x42, 0x22, 0xff, 0x44, 0x18, 0x88,
+    0x51, 0xe1, 0x22, 0x4, 0x40, 0x30, 0x80, 0x81,
+    0x0, 0xc, 0x0,
 
     /* U+544A "告" */
-    0x0, 0xff, 0xe2, 0x8d, 0x80, 0x54, 0x1, 0xfc,
-    0xda, 0x0, 0x11, 0x0, 0x7f, 0x55, 0x2e, 0xda,
-    0xb7, 0x79, 0xc0, 0x2a, 0x9c, 0xbb, 0x6a, 0xdd,
-    0xe7, 0x0, 0x20, 0x20, 0x7, 0xff, 0x1, 0x28,
-    0x3, 0xff, 0x83, 0x57, 0x7d, 0x41, 0x77, 0xd4,
-    0x15, 0x77, 0xff, 0xc0, 0xa0, 0x9, 0xee, 0xff,
-    0x40, 0x7, 0x5d, 0xff, 0x20, 0x7, 0xff, 0x60,
-    0x8b, 0xf0, 0x7, 0xd1, 0x1f, 0x84, 0x2,
+    0x0, 0x0, 0x22, 0x0, 0x4, 0x1, 0xff, 0x84,
+    0x10, 0x8, 0x20, 0x0, 0x40, 0x7f, 0xfe, 0x0,
+    0x0, 0x3f, 0xe0, 0x80, 0x41, 0x0, 0x82, 0x1,
+    0x4, 0x2, 0xf, 0xfc, 0x0,
 
     /* U+5462 "呢" */
-    0x0, 0xe6, 0xbb, 0xf9, 0xc1, 0xb3, 0x12, 0x19,
-    0x57, 0x7d, 0x5a, 0x1b, 0x98, 0x20, 0xf, 0xfe,
-    0xa6, 0xdd, 0xf5, 0x70, 0x7, 0xdb, 0x7b, 0x77,
-    0x90, 0x3, 0xfa, 0x80, 0x31, 0x0, 0x78, 0x44,
-    0x1, 0x9b, 0x18, 0x3, 0xfc, 0xf6, 0x78, 0x80,
-    0xa, 0xa3, 0x80, 0x61, 0x4b, 0x50, 0xd, 0x76,
-    0xc2, 0x10, 0x0, 0x98, 0x7, 0x40, 0x88, 0x13,
-    0xc0, 0x3e, 0x63, 0x30, 0x5, 0x4a, 0x1, 0xf7,
-    0x0, 0x63, 0xa0, 0x9, 0xae, 0xf1, 0x98,
+    0x3, 0xf8, 0xe8, 0xa, 0x50, 0x14, 0xa0, 0x29,
+    0x7f, 0x92, 0x80, 0x25, 0x20, 0x4a, 0x44, 0x94,
+    0xa1, 0xe9, 0x2, 0x12, 0x0, 0x4, 0x0, 0x88,
+    0x40, 0x1f, 0x80,
 
     /* U+547C "呼" */
-    0x0, 0xf8, 0x4d, 0xa2, 0xec, 0x20, 0xb7, 0x66,
-    0x9, 0xa9, 0x4b, 0xab, 0xb0, 0x87, 0x5d, 0xb4,
-    0x26, 0xa1, 0xc4, 0x81, 0x4, 0x3, 0xc7, 0x0,
-    0x1d, 0x0, 0x1f, 0x19, 0x80, 0x31, 0x30, 0x80,
-    0x7c, 0x66, 0x0, 0xaa, 0x40, 0x3f, 0x50, 0x6,
-    0xf3, 0x0, 0xf1, 0x3a, 0xa3, 0x93, 0x83, 0xb0,
-    0x80, 0x63, 0x22, 0xc6, 0x45, 0x18, 0x85, 0xdb,
-    0x45, 0x57, 0xa, 0xae, 0x0, 0x5d, 0x98, 0x3,
-    0xfe, 0xa0, 0xf, 0xfe, 0x10, 0x80, 0x7f, 0xf2,
-    0xe, 0xec, 0x80, 0x1c,
+    0x0, 0x38, 0xce, 0x82, 0x41, 0x4, 0x92, 0x49,
+    0x24, 0x92, 0x4a, 0x24, 0x10, 0x48, 0x20, 0x90,
+    0x41, 0xc0, 0x82, 0x1, 0x0, 0x2, 0x0, 0x4,
+    0x0, 0x38, 0x0,
 
     /* U+547D "命" */
-    0x0, 0xfa, 0xa8, 0x20, 0x1f, 0xfc, 0xa, 0xeb,
-    0xa2, 0x0, 0xfe, 0x1b, 0x94, 0x1a, 0x85, 0x0,
-    0xf9, 0x6a, 0x4c, 0x0, 0x35, 0xb4, 0x20, 0x11,
-    0x56, 0xdd, 0xfd, 0xb3, 0x50, 0x22, 0xb8, 0x80,
-    0x4d, 0xdf, 0x29, 0xde, 0xa0, 0xc8, 0xdd, 0xe1,
-    0xa, 0xbb, 0xa9, 0x54, 0x0, 0xb8, 0xbb, 0x62,
-    0x91, 0xdd, 0xc0, 0x20, 0x1f, 0xfd, 0x8b, 0x66,
-    0x6b, 0x80, 0x7f, 0xdc, 0x44, 0x93, 0x0, 0xa2,
-    0x58, 0x40, 0x2d, 0x74, 0x41, 0x80, 0x68, 0x9c,
-    0x0, 0xca, 0x20, 0x1c, 0x20, 0x1e,
+    0x1, 0x80, 0x2, 0x40, 0x4, 0x20, 0x8, 0x18,
+    0x37, 0xe6, 0x40, 0x0, 0x1e, 0x7c, 0x20, 0x44,
+    0x20, 0x44, 0x20, 0x44, 0x32, 0x44, 0x20, 0x5c,
+    0x0, 0x40, 0x0, 0x40,
 
     /* U+548C "和" */
-    0x0, 0x8d, 0xa6, 0xd0, 0x3, 0xf3, 0xca, 0x5c,
-    0x5a, 0x16, 0x66, 0xb0, 0x3, 0xcb, 0x88, 0x80,
-    0x9, 0x39, 0x90, 0x8, 0x7, 0xff, 0x12, 0xee,
-    0x3b, 0xb5, 0x0, 0x7e, 0xbb, 0x40, 0x55, 0xd0,
-    0x7, 0xfa, 0x4a, 0xc0, 0x3f, 0xe2, 0x31, 0x9a,
-    0x0, 0xff, 0x4c, 0x1, 0xe3, 0x0, 0x7e, 0x6c,
-    0x10, 0x3, 0x38, 0x7, 0xc5, 0xae, 0x1, 0x84,
-    0x3, 0xe3, 0xa0, 0xf, 0xa2, 0xee, 0x50, 0x11,
-    0x0, 0x7d, 0x17, 0x72, 0x80, 0x73, 0x0, 0x4e,
-    0x80, 0x15, 0x8,
+    0x6, 0x0, 0x50, 0xf8, 0x20, 0x10, 0x40, 0x27,
+    0xf0, 0x41, 0x0, 0x87, 0x1, 0xd, 0x2, 0x28,
+    0x4, 0x10, 0x9, 0x20, 0x10, 0x43, 0xe0, 0x80,
+    0x41, 0x0, 0x0,
 
     /* U+54B1 "咱" */
-    0x0, 0xfe, 0xb0, 0xc, 0xb5, 0x48, 0x0, 0xc6,
-    0x60, 0xd, 0xd5, 0x43, 0x0, 0x65, 0xf9, 0xdd,
-    0xb1, 0x80, 0x38, 0x5a, 0xf2, 0xee, 0xef, 0x0,
-    0xff, 0xe4, 0x25, 0xdf, 0x70, 0x7, 0xc9, 0x77,
-    0xdc, 0x1, 0xff, 0xc9, 0x66, 0xf2, 0x80, 0x2a,
-    0x8e, 0x1, 0x19, 0xf0, 0x80, 0x2e, 0xd8, 0x0,
-    0x65, 0x5e, 0x40, 0x81, 0x10, 0x7, 0xfc, 0x60,
-    0x1c, 0x99, 0x9d, 0xc0, 0x1e, 0x17, 0xcc, 0xed,
+    0x0, 0x41, 0xc1, 0x9, 0x3f, 0xa4, 0x81, 0x92,
+    0x6, 0x4f, 0xf9, 0x20, 0x64, 0x81, 0x92, 0x7,
+    0xc8, 0x18, 0x20, 0x40, 0x81, 0x3, 0xfc, 0x8,
     0x10,
 
     /* U+54CD "响" */
-    0x0, 0xfe, 0xa1, 0x0, 0x92, 0xa8, 0xe0, 0x18,
-    0x80, 0x40, 0x2f, 0xaa, 0x68, 0x2d, 0xdb, 0xda,
-    0xee, 0x50, 0x8, 0x43, 0xae, 0xdb, 0x97, 0x77,
-    0x0, 0x73, 0x80, 0x7f, 0xf1, 0x22, 0xa8, 0x80,
-    0x1f, 0xe1, 0xaa, 0x68, 0x7, 0xff, 0x4, 0xc0,
-    0x3f, 0xf8, 0xb5, 0x47, 0x0, 0xc6, 0x0, 0x30,
-    0xa, 0xed, 0x80, 0x19, 0xe6, 0x54, 0x0, 0x81,
-    0x10, 0x7, 0x64, 0xc8, 0xc0, 0x6, 0x1, 0xf0,
-    0x80, 0x7f, 0x98, 0x3, 0x9e, 0xcc,
+    0x0, 0x41, 0x81, 0x9, 0x3f, 0xa5, 0x1, 0x94,
+    0x6, 0x53, 0x99, 0x49, 0x65, 0x25, 0x94, 0x97,
+    0xd2, 0x58, 0x4e, 0x41, 0x1, 0x4, 0x4, 0x10,
+    0x30,
 
     /* U+54E5 "哥" */
-    0x6, 0xbb, 0xfe, 0xcd, 0xb7, 0x0, 0x35, 0xdf,
-    0xf7, 0xad, 0xb8, 0x6, 0x5a, 0xac, 0x80, 0x1f,
-    0xee, 0xaa, 0xde, 0x1, 0xff, 0xce, 0xe9, 0xaa,
-    0x4f, 0x80, 0x1f, 0xc0, 0x3c, 0xb3, 0x54, 0x94,
-    0x44, 0xe2, 0x80, 0x6a, 0xbb, 0xfb, 0xc9, 0x3e,
-    0xec, 0x0, 0xab, 0xbf, 0xef, 0x5b, 0xb0, 0x6,
-    0xba, 0xad, 0x0, 0x1f, 0xc2, 0x15, 0x58, 0xc0,
-    0x3f, 0xf9, 0xa2, 0xb5, 0x5b, 0x80, 0x3f, 0xd9,
-    0x55, 0x96, 0x2e, 0x30, 0x2,
+    0x3f, 0xfc, 0x0, 0x8, 0xf, 0x8, 0x10, 0x88,
+    0x10, 0x88, 0xf, 0x0, 0x0, 0x30, 0x7f, 0xfe,
+    0x0, 0x8, 0x1f, 0x88, 0x10, 0x88, 0x10, 0x88,
+    0x1f, 0x8, 0x0, 0x70,
 
     /* U+54EA "哪" */
-    0x0, 0xff, 0xe3, 0x35, 0xf5, 0x40, 0x55, 0x5b,
-    0x17, 0x67, 0x6b, 0x4a, 0x20, 0x1a, 0xb0, 0x2b,
-    0xb6, 0x80, 0x7e, 0x4a, 0x0, 0xff, 0xe0, 0x7a,
-    0x80, 0x64, 0xb4, 0xb4, 0x30, 0x0, 0x90, 0x6,
-    0x4b, 0x4b, 0x43, 0x0, 0x60, 0x7, 0x84, 0xc0,
-    0x3f, 0xf8, 0x6, 0x20, 0x1c, 0xae, 0x1, 0x97,
-    0x92, 0x90, 0xc0, 0x5, 0xa3, 0x76, 0xd5, 0x57,
-    0x52, 0x98, 0x6, 0x1b, 0xb3, 0x82, 0x90, 0x7,
-    0x86, 0x40, 0x24, 0x40, 0x7, 0x1d, 0xe9, 0x80,
-    0x53, 0x20, 0x12, 0x0, 0x1d, 0xb0, 0x4, 0xb0,
-    0x35, 0xb8, 0x2, 0x1, 0xe5, 0x50, 0x56, 0x28,
-    0x50, 0x4,
+    0x0, 0x0, 0x1e, 0xfe, 0x2a, 0x64, 0xa8, 0x92,
+    0xaa, 0x5e, 0xa9, 0x2a, 0x24, 0xa8, 0x92, 0xa2,
+    0x5e, 0x9e, 0x4a, 0x61, 0x29, 0x4, 0xa8, 0x22,
+    0x80, 0x32, 0x0, 0x0,
 
     /* U+5531 "唱" */
-    0x0, 0xe2, 0xca, 0xaf, 0x2, 0xdd, 0xa0, 0x1e,
-    0xab, 0xcc, 0x1d, 0x76, 0x30, 0xf, 0xfe, 0x25,
-    0x57, 0x84, 0x3, 0xea, 0xaf, 0x8, 0x7, 0x9e,
-    0xab, 0xcc, 0x1, 0xe2, 0xca, 0xaf, 0x0, 0x79,
-    0xaa, 0xef, 0xa8, 0x80, 0x3a, 0xa9, 0x77, 0xd3,
-    0x41, 0x98, 0x10, 0xf, 0xfb, 0x31, 0x40, 0x37,
-    0x7e, 0xf0, 0xd0, 0xc, 0x37, 0x7e, 0xf0, 0x60,
-    0xf, 0xfe, 0x30, 0xdd, 0xfb, 0xfc, 0x1, 0xdb,
-    0x77, 0xec, 0x70,
+    0x3, 0xf9, 0xc0, 0x29, 0x0, 0xa4, 0xfe, 0x90,
+    0xa, 0x4f, 0xe9, 0x0, 0x24, 0xfe, 0x94, 0x7,
+    0xd0, 0x18, 0x7f, 0xc1, 0x1, 0x4, 0x4, 0x1f,
+    0xe0, 0x0, 0x0,
 
     /* U+554A "啊" */
-    0x0, 0xff, 0xe3, 0x96, 0x5d, 0x9a, 0xee, 0xce,
-    0x47, 0xbb, 0x3b, 0xa2, 0x4d, 0xae, 0xed, 0x74,
-    0xdb, 0xb6, 0x80, 0x13, 0x0, 0x3f, 0xf8, 0x38,
-    0x83, 0x56, 0x80, 0x1f, 0xc6, 0x9, 0xf7, 0xc0,
-    0x1f, 0xfc, 0xcc, 0x60, 0xf, 0xfe, 0xa, 0xe0,
-    0x7, 0xff, 0x2e, 0xed, 0xc0, 0x1d, 0x37, 0xc0,
-    0x11, 0x5d, 0x90, 0x6, 0xbd, 0xfa, 0xd0, 0x2,
-    0x80, 0xc, 0x34, 0xa4, 0x40, 0xf, 0xfe, 0x60,
-    0x80, 0x71, 0x5d, 0x68, 0x0,
+    0x0, 0x0, 0xe, 0xf9, 0x84, 0x14, 0x80, 0x29,
+    0x26, 0x52, 0x42, 0xa4, 0x85, 0x48, 0xa, 0x91,
+    0x15, 0x22, 0x2b, 0x85, 0x94, 0x10, 0x20, 0x0,
+    0x40, 0x0, 0x80, 0x6, 0x0,
 
     /* U+5566 "啦" */
-    0x0, 0xf5, 0x0, 0x48, 0xc0, 0x11, 0x3b, 0x88,
-    0x0, 0x20, 0x10, 0x80, 0x68, 0x44, 0x40, 0x6,
-    0x13, 0x2f, 0x33, 0x0, 0x99, 0x86, 0x2d, 0x68,
-    0x90, 0x39, 0x14, 0x3, 0xa2, 0xd6, 0x8d, 0x9d,
-    0xc8, 0x80, 0xf, 0xf4, 0x0, 0x2c, 0x40, 0x3f,
-    0x8, 0x18, 0x0, 0x88, 0x1, 0xe4, 0x58, 0x0,
-    0xc2, 0x20, 0xc, 0x30, 0x6b, 0x20, 0x62, 0x2,
-    0x1, 0x5d, 0xb6, 0x1c, 0x2, 0xe2, 0x13, 0x0,
-    0xae, 0xce, 0x1, 0xc2, 0xeb, 0x80, 0x9, 0x0,
-    0xfc, 0x65, 0x8e, 0x0, 0x20, 0xf, 0xc8, 0xf0,
-    0x40, 0x1e, 0x6b, 0xc2, 0xba, 0xa5, 0xdc, 0x20,
+    0x2, 0x0, 0x4, 0x2, 0x48, 0x44, 0xf8, 0x9,
+    0x20, 0x12, 0x49, 0x24, 0x92, 0x49, 0xa4, 0x9a,
+    0x49, 0xc4, 0x12, 0x8, 0x0, 0x10, 0x80, 0x20,
+    0x0, 0x9f, 0x80,
 
     /* U+5634 "嘴" */
-    0x0, 0xff, 0xe2, 0x8, 0x80, 0x2, 0x29, 0x2,
-    0x70, 0x11, 0x4, 0x4c, 0xc1, 0x0, 0x94, 0xbb,
-    0x30, 0x60, 0x51, 0x3, 0x3, 0x4, 0xa4, 0x8,
-    0x92, 0x0, 0xfe, 0x17, 0xd1, 0x6, 0x20, 0xc,
-    0x88, 0xd6, 0xd3, 0xba, 0xa8, 0x80, 0x31, 0xcc,
-    0x85, 0xb6, 0xea, 0x98, 0x1, 0xce, 0xef, 0xf5,
-    0x60, 0x80, 0x7e, 0x4d, 0x6b, 0xa8, 0xca, 0xb0,
-    0x9, 0xdc, 0x3, 0x75, 0x52, 0xd5, 0x8, 0x80,
-    0x3, 0x35, 0xa8, 0x54, 0xc9, 0x66, 0x48, 0x0,
-    0xf4, 0x40, 0x80, 0xcc, 0xcb, 0x32, 0x40, 0x2,
-    0x80, 0x6c, 0xfa, 0xa0, 0x55, 0x10, 0x3, 0xc8,
-    0x35, 0x55, 0xd5, 0x10, 0x3, 0x8b, 0xa8, 0x3,
-    0x34, 0x91, 0x0,
+    0x0, 0x0, 0x2, 0x3, 0xd6, 0xe4, 0xa9, 0x9,
+    0x50, 0x12, 0xf7, 0xa4, 0x70, 0x49, 0x0, 0x97,
+    0xf9, 0x20, 0x92, 0xf, 0xe0, 0x2, 0x40, 0x7f,
+    0x80, 0x81, 0x2, 0x6, 0x0,
 
     /* U+56DB "四" */
-    0x5b, 0xbb, 0x31, 0x76, 0xcb, 0xbc, 0x3f, 0x37,
-    0x66, 0xeb, 0xb0, 0x5d, 0xc6, 0xa0, 0x18, 0x48,
-    0x3, 0xff, 0x80, 0xe0, 0x1f, 0xfc, 0x1, 0x60,
-    0xf, 0xfe, 0x3, 0x78, 0x7, 0xa0, 0x3, 0xd,
-    0xa8, 0x7, 0x88, 0x2, 0x6c, 0xe0, 0xd, 0x55,
-    0x78, 0x4, 0xf8, 0x40, 0x19, 0xaa, 0x8a, 0x1,
-    0x8, 0x80, 0x3f, 0xf9, 0xdd, 0x77, 0xfe, 0x50,
-    0x6, 0xdd, 0xff, 0xa9, 0xe8, 0x40, 0x3f, 0xce,
-    0x60,
+    0x7f, 0xfa, 0x22, 0x28, 0x88, 0xa2, 0x22, 0x88,
+    0x8a, 0x2, 0x69, 0x9, 0xa8, 0x1a, 0x80, 0xa,
+    0x0, 0x28, 0x0, 0xbf, 0xfe, 0x80, 0x0, 0x0,
+    0x0,
 
     /* U+56DE "回" */
-    0x9c, 0xcf, 0xfb, 0x41, 0x73, 0x3f, 0xe7, 0x20,
-    0xf, 0xfe, 0xa5, 0xdf, 0x40, 0x7, 0xf5, 0xde,
-    0x40, 0xf, 0xfe, 0xeb, 0x80, 0x7e, 0x3b, 0xbd,
-    0xc0, 0x1f, 0xa2, 0xef, 0x28, 0x7, 0xff, 0x1e,
-    0xab, 0xfe, 0x40, 0x6b, 0xbf, 0xf9, 0xcc,
+    0xff, 0xfa, 0x0, 0x28, 0x0, 0xa0, 0x2, 0x8f,
+    0xca, 0x21, 0x28, 0x84, 0xa2, 0x12, 0x88, 0x4a,
+    0x3e, 0x28, 0x0, 0xa0, 0x2, 0xff, 0xfa, 0x0,
+    0x20,
 
     /* U+56E0 "因" */
-    0x8b, 0xbf, 0xfb, 0x1d, 0x2e, 0xff, 0xee, 0xd0,
-    0xf, 0x28, 0x80, 0x7f, 0xf0, 0x30, 0x3, 0xff,
-    0x82, 0x42, 0x1, 0xfa, 0x6e, 0xe4, 0xdb, 0xb9,
-    0x40, 0x34, 0xdd, 0xc4, 0x97, 0x72, 0x80, 0x7c,
-    0x94, 0x40, 0x1f, 0xf7, 0xb7, 0x40, 0x7, 0xf4,
-    0x60, 0xa9, 0x28, 0x7, 0x86, 0x81, 0xc0, 0x15,
-    0xf0, 0x1, 0xcd, 0x30, 0x1, 0xab, 0x4c, 0x2,
-    0x25, 0x12, 0x2f, 0x38, 0x88, 0x1e, 0x23, 0xfe,
-    0x93,
+    0xff, 0xfa, 0x0, 0x18, 0x0, 0x60, 0x81, 0x82,
+    0x6, 0xff, 0x98, 0x30, 0x60, 0x41, 0x84, 0x86,
+    0x22, 0x19, 0x86, 0x60, 0x1, 0x80, 0x7, 0xff,
+    0xf0,
 
     /* U+56FD "国" */
-    0x8b, 0xbf, 0xfb, 0x1, 0x2e, 0xff, 0xe7, 0x10,
-    0xf, 0xfe, 0x22, 0x5d, 0xdd, 0x77, 0x40, 0x7,
-    0x25, 0xdc, 0xb7, 0x74, 0x0, 0x7f, 0xf2, 0x2a,
-    0xec, 0xb7, 0x72, 0x0, 0x7a, 0xae, 0xcb, 0x75,
-    0x28, 0x1, 0xff, 0xc, 0x18, 0x7, 0xff, 0x2,
-    0x98, 0x3, 0x9e, 0xaa, 0x7a, 0xab, 0xc4, 0x3,
-    0x3d, 0x55, 0x95, 0x58, 0x40, 0x22, 0x2f, 0xf8,
-    0x0, 0xf7, 0x7f, 0xf3, 0x0,
+    0xff, 0xfa, 0x0, 0x28, 0x0, 0xa7, 0xfa, 0x82,
+    0xa, 0x8, 0x29, 0xfc, 0xa0, 0x82, 0x82, 0x4a,
+    0x8, 0x29, 0xfe, 0xa0, 0x2, 0x80, 0xb, 0xff,
+    0xe0,
 
     /* U+571F "土" */
-    0x0, 0xf9, 0x94, 0x3, 0xff, 0x86, 0x60, 0x1f,
-    0xfd, 0xd9, 0xaa, 0xff, 0x80, 0x34, 0x5d, 0xff,
-    0xc0, 0x18, 0x47, 0xff, 0x80, 0x1, 0xff, 0xff,
-    0x0, 0xfd, 0x79, 0x9d, 0x76, 0xcc, 0xeb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe,
 
     /* U+5728 "在" */
-    0x0, 0xf1, 0x0, 0x7f, 0xf0, 0xb8, 0x3, 0xff,
-    0x82, 0x6c, 0x1, 0xfd, 0x39, 0x97, 0x3e, 0x67,
-    0xd2, 0x13, 0x98, 0xd6, 0xdc, 0xcf, 0xa4, 0x3,
-    0x44, 0x0, 0x23, 0x50, 0xf, 0x90, 0xc, 0x2,
-    0x62, 0x0, 0xf1, 0x54, 0x0, 0x7f, 0xc3, 0xc6,
-    0x0, 0xbc, 0xc4, 0x56, 0x62, 0xc8, 0x37, 0x9c,
-    0x1, 0x79, 0x88, 0xac, 0xc5, 0x90, 0x61, 0x0,
-    0x7f, 0xfc, 0xc, 0x5e, 0xee, 0x8a, 0xbb, 0xa4,
+    0x0, 0x0, 0x4, 0x0, 0x8, 0x3, 0xff, 0xf0,
+    0x40, 0x1, 0x0, 0x2, 0x0, 0x8, 0x0, 0x33,
+    0xfc, 0xa0, 0x0, 0x40, 0x0, 0x80, 0x1, 0x0,
+    0x2, 0x0, 0x4, 0xff, 0x80,
 
     /* U+5730 "地" */
-    0x0, 0xa4, 0x3, 0xd4, 0x1, 0xf0, 0x98, 0x4,
-    0xc0, 0x6, 0x0, 0xff, 0xe0, 0x50, 0x7, 0x88,
-    0x6, 0x6d, 0x29, 0x80, 0x39, 0xe9, 0xe4, 0x6,
-    0x20, 0xb6, 0xc0, 0x3, 0xa3, 0x35, 0x38, 0x4,
-    0x26, 0x22, 0x5, 0x3a, 0x83, 0x40, 0xf, 0xe7,
-    0x23, 0x92, 0x0, 0xff, 0x9d, 0xc0, 0x1e, 0x11,
-    0x0, 0x78, 0x80, 0x3e, 0x33, 0x0, 0x46, 0xf8,
-    0x80, 0x1e, 0x99, 0x68, 0x2, 0xba, 0x31, 0x80,
-    0x33, 0x4, 0xda, 0x0, 0x27, 0x14, 0x3, 0xd4,
-    0x1, 0x31, 0x81, 0x80, 0x7f, 0xf0, 0x3c, 0x40,
-    0x3e, 0x4b, 0xbf, 0x19, 0x0,
+    0x10, 0x20, 0x10, 0x20, 0x11, 0x20, 0x79, 0x2a,
+    0x11, 0x62, 0x11, 0xa2, 0x11, 0x22, 0x11, 0x22,
+    0x11, 0x22, 0x19, 0x2c, 0x61, 0x20, 0x1, 0x0,
+    0x1, 0x2, 0x1, 0xfe,
 
     /* U+5750 "坐" */
-    0x0, 0xcc, 0x0, 0x65, 0x0, 0x94, 0x3, 0xc3,
-    0x80, 0x11, 0x80, 0x14, 0xc0, 0x3c, 0xf8, 0x1,
-    0xef, 0x70, 0xf, 0x5f, 0x0, 0x71, 0x29, 0x80,
-    0x72, 0xa8, 0x1c, 0x3, 0x4d, 0xf0, 0x80, 0x43,
-    0x31, 0xd, 0x60, 0x3, 0x9a, 0x76, 0x88, 0x3,
-    0x7c, 0x1, 0x44, 0x1d, 0xc8, 0x2, 0xfb, 0x0,
-    0x69, 0x80, 0x48, 0x1d, 0x20, 0x11, 0xd0, 0x0,
-    0x66, 0xef, 0xfe, 0x0, 0xd3, 0x77, 0xaa, 0xef,
-    0xc0, 0x1f, 0xc2, 0x1, 0xff, 0xdd, 0xbc, 0xce,
-    0xbb, 0x66, 0x75, 0x80,
+    0x0, 0x0, 0x8, 0x0, 0x0, 0x10, 0x18, 0x10,
+    0x18, 0x28, 0x24, 0x24, 0x40, 0xc2, 0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+57CE "城" */
-    0x0, 0xff, 0xe3, 0x14, 0x0, 0x7d, 0x4b, 0x0,
-    0x18, 0x40, 0x3f, 0xa, 0xe3, 0x80, 0x7d, 0x17,
-    0x79, 0x6f, 0xf0, 0x0, 0xd6, 0x6c, 0x7, 0x77,
-    0x96, 0xee, 0x0, 0x17, 0x1, 0x0, 0x7f, 0xf0,
-    0x11, 0x4d, 0x1, 0x6a, 0x8c, 0x1, 0xa8, 0x3,
-    0xe5, 0xaa, 0x60, 0x4, 0x9a, 0x1, 0xff, 0xc0,
-    0x21, 0xe5, 0x0, 0xff, 0x8, 0x72, 0x1, 0x0,
-    0x70, 0x99, 0x0, 0x62, 0xb8, 0x0, 0xca, 0xd6,
-    0x9e, 0x2, 0x1, 0x29, 0x0, 0x59, 0xdf, 0x5c,
-    0x8f, 0x7e, 0x52, 0xe0, 0x30, 0x19, 0x2, 0x22,
-    0x23, 0xd3, 0xf7, 0x2d, 0x8b, 0xc0, 0x33, 0x40,
-    0x0, 0xff, 0x49, 0xf3, 0xd4, 0x3, 0x39, 0x80,
-    0xf, 0x4, 0x1, 0x58, 0x40,
+    0x0, 0x0, 0x10, 0x14, 0x10, 0x10, 0x13, 0xfe,
+    0x32, 0x10, 0x12, 0x10, 0x13, 0x92, 0x12, 0x50,
+    0x12, 0x54, 0x12, 0x44, 0x12, 0x48, 0x18, 0x48,
+    0x64, 0x99, 0x4, 0x20, 0x0, 0x46, 0x0, 0x0,
 
     /* U+58EB "士" */
-    0x0, 0xf9, 0x94, 0x3, 0xff, 0x86, 0x60, 0x1f,
-    0xfd, 0xc9, 0xaa, 0xff, 0xe0, 0x80, 0x22, 0xef,
-    0xff, 0x82, 0x0, 0x11, 0xff, 0xe1, 0x0, 0x7f,
-    0xff, 0xc0, 0x3e, 0x1b, 0xcc, 0xd5, 0x4c, 0xce,
-    0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfc,
 
     /* U+58F0 "声" */
-    0x0, 0xf9, 0x94, 0x3, 0xe7, 0xbb, 0xf4, 0x5d,
-    0xf3, 0x83, 0xdd, 0xfa, 0x2e, 0xf9, 0xc0, 0x21,
-    0x1e, 0x31, 0x1e, 0x0, 0x9e, 0xef, 0x6e, 0x5d,
-    0xe8, 0x0, 0x9e, 0xab, 0xfd, 0x20, 0x12, 0x65,
-    0xdd, 0xb9, 0x77, 0xa0, 0x2, 0x29, 0xbb, 0xd3,
-    0x77, 0x90, 0x2, 0x11, 0x0, 0x7f, 0xf0, 0x7e,
-    0x2e, 0xf4, 0x5d, 0xe0, 0xc, 0x59, 0x77, 0x6e,
-    0xae, 0xf3, 0x80, 0x4, 0x3, 0xfe, 0xa0, 0x4,
-    0xf0, 0x7, 0xf8, 0x40, 0x49, 0x0, 0x3f, 0xf8,
-    0x0,
+    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xc0, 0x0, 0x7, 0xff, 0x0, 0x2, 0x0,
+    0x4, 0x7f, 0xf8, 0x80, 0x11, 0x0, 0x4, 0x0,
+    0x8, 0x0, 0x0,
 
     /* U+5916 "外" */
-    0x0, 0xc2, 0x1, 0xff, 0xc3, 0xa1, 0x0, 0xeb,
-    0x0, 0xf8, 0x40, 0x40, 0x39, 0xc0, 0x3e, 0x66,
-    0x5d, 0xb1, 0x80, 0x3f, 0xd7, 0xb7, 0x6a, 0xf0,
-    0xf, 0xe8, 0x90, 0xb, 0x36, 0x80, 0x3e, 0x37,
-    0x60, 0x9, 0x93, 0x18, 0x3, 0x87, 0xb6, 0x64,
-    0x8, 0x80, 0x6f, 0x0, 0xe1, 0xc2, 0xac, 0xbf,
-    0xa0, 0x4, 0x9b, 0x0, 0x61, 0x0, 0x2f, 0x1,
-    0x0, 0x47, 0xd2, 0x1, 0xf7, 0x40, 0x7, 0x46,
-    0x60, 0xc0, 0x33, 0x99, 0x80, 0x3c, 0xba, 0x40,
-    0x12, 0xe4, 0x0, 0x7e, 0x11, 0x0, 0x1f, 0xac,
-    0x3, 0xff, 0x81, 0x3f, 0x60, 0x1f, 0x38, 0x6,
+    0x0, 0x0, 0x8, 0x10, 0x8, 0x10, 0xf, 0x10,
+    0x10, 0x90, 0x21, 0x50, 0x21, 0x10, 0x59, 0x30,
+    0x6, 0x10, 0x2, 0x1c, 0x4, 0x12, 0x4, 0x10,
+    0x8, 0x10, 0x10, 0x10, 0x60, 0x10,
 
     /* U+591A "多" */
-    0x0, 0xe3, 0xa0, 0xf, 0xf9, 0xfc, 0x6e, 0xed,
-    0x20, 0xc, 0xba, 0x19, 0x77, 0x72, 0x10, 0x0,
-    0xec, 0xf3, 0xa8, 0x41, 0xfe, 0x40, 0x23, 0xb6,
-    0x19, 0x96, 0xdf, 0xd0, 0x7, 0xe1, 0xb7, 0x80,
-    0x70, 0xf, 0x24, 0xd6, 0x54, 0xbe, 0x5d, 0xd0,
-    0xd8, 0x77, 0x61, 0xa9, 0xfb, 0xbb, 0x39, 0xb1,
-    0xd2, 0xf8, 0xcc, 0x1, 0x1e, 0x30, 0x2, 0xe,
-    0xed, 0x98, 0x30, 0x3f, 0xa0, 0xa, 0x14, 0x0,
-    0x9b, 0x15, 0x1a, 0x20, 0x1f, 0x90, 0x32, 0xc4,
-    0x3, 0xc9, 0x36, 0x76, 0xc0, 0x1c, 0x99, 0x47,
-    0x76, 0x60, 0xf, 0x0,
+    0x2, 0x0, 0x1f, 0x81, 0x2, 0x13, 0x10, 0x3,
+    0x80, 0x1a, 0x1, 0x9f, 0xd0, 0x80, 0xe, 0x8,
+    0x84, 0x40, 0xe, 0x0, 0x20, 0x6, 0x0, 0xc0,
+    0x0,
 
     /* U+591C "夜" */
-    0x0, 0xf9, 0x54, 0x1, 0xfa, 0x2a, 0xba, 0x65,
-    0x55, 0xd2, 0x0, 0x8b, 0xb7, 0x72, 0xf7, 0x6b,
-    0xbd, 0x20, 0x10, 0x8b, 0xd4, 0x44, 0x9e, 0x23,
-    0x80, 0x39, 0xc, 0x40, 0x10, 0x77, 0x75, 0x20,
-    0x6, 0xa9, 0x0, 0x44, 0x2a, 0xee, 0x6, 0x0,
-    0xa8, 0x4, 0x11, 0x55, 0x2c, 0x2, 0xc4, 0x0,
-    0x9d, 0x20, 0x4f, 0x54, 0x8f, 0x39, 0x80, 0x1,
-    0x73, 0x80, 0x32, 0xe3, 0xc2, 0x40, 0x90, 0x0,
-    0x4e, 0x1, 0x40, 0x3, 0xe4, 0x7e, 0xc0, 0x3f,
-    0xe4, 0x1f, 0xe1, 0x0, 0xff, 0x98, 0xe6, 0x42,
-    0x1, 0xfc, 0xb6, 0x36, 0xf1, 0xae, 0x1, 0xcc,
-    0x16, 0x54, 0xe0, 0x3, 0xc1, 0xc1,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x8, 0x40,
+    0x8, 0xfc, 0x11, 0x4, 0x31, 0x44, 0x53, 0x28,
+    0x14, 0x88, 0x10, 0x50, 0x10, 0x60, 0x10, 0x50,
+    0x11, 0x8, 0x14, 0x2,
 
     /* U+591F "够" */
-    0x0, 0xa8, 0x3, 0xc5, 0x20, 0x1e, 0x20, 0xf,
-    0xb8, 0xe6, 0xc, 0x2, 0xb6, 0xbb, 0xa4, 0x26,
-    0x2e, 0x8, 0x40, 0x4, 0x79, 0x77, 0x15, 0x7,
-    0x9, 0x19, 0x0, 0x3a, 0x0, 0x3a, 0xe6, 0x57,
-    0x12, 0x0, 0x18, 0x85, 0x51, 0xc4, 0x4, 0x2,
-    0xe0, 0x8, 0x50, 0x2a, 0x9a, 0x2, 0x53, 0x42,
-    0x20, 0xf, 0xe3, 0x32, 0x5f, 0xb7, 0x56, 0xa0,
-    0x7, 0x84, 0x4c, 0x9b, 0x95, 0x41, 0x40, 0x2,
-    0x55, 0x31, 0xfe, 0x44, 0xdc, 0x1a, 0x80, 0x26,
-    0xaa, 0x31, 0xc, 0x3c, 0x15, 0xe3, 0x0, 0x50,
-    0x1, 0x71, 0x8, 0x0, 0x86, 0x80, 0x3f, 0x1a,
-    0x82, 0x58, 0xd0, 0x7, 0x8a, 0xec, 0x43, 0x67,
-    0x4c, 0x1, 0xf1, 0x5d, 0xa4, 0x2d, 0xc4, 0x3,
-    0x80,
+    0x10, 0x10, 0x10, 0x3c, 0x3f, 0x44, 0x21, 0xe4,
+    0x41, 0x18, 0x39, 0x10, 0x25, 0x70, 0x25, 0x1e,
+    0x25, 0x22, 0x38, 0xa0, 0x20, 0xc, 0x2, 0x8,
+    0x2, 0x20, 0xe, 0x80, 0x0, 0x0,
 
     /* U+5927 "大" */
-    0x0, 0xf2, 0x30, 0x7, 0xff, 0x0, 0x40, 0x3f,
-    0xf8, 0x26, 0x60, 0xf, 0xfe, 0x7, 0x30, 0x7,
-    0xa7, 0x33, 0x9f, 0x73, 0x3a, 0xa7, 0x33, 0x8c,
-    0xb3, 0x3a, 0x80, 0x39, 0x16, 0xd4, 0x3, 0xfd,
-    0xba, 0x6e, 0x0, 0xfe, 0x14, 0x40, 0x89, 0x0,
-    0x3f, 0x44, 0x0, 0x17, 0x20, 0x1f, 0x29, 0x28,
-    0x0, 0x6a, 0x40, 0x39, 0x26, 0x80, 0x33, 0x9b,
-    0x80, 0x51, 0xd, 0x10, 0xe, 0xad, 0x90, 0xbf,
-    0xc1, 0x0, 0xfa, 0xbf, 0x2d, 0xc0, 0x3f, 0xcd,
-    0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0xff,
+    0xfc, 0xc, 0x0, 0x20, 0x1, 0x20, 0x4, 0x80,
+    0x21, 0x0, 0x82, 0x4, 0x8, 0x60, 0x1a, 0x0,
+    0x10, 0x0, 0x0,
 
     /* U+5929 "天" */
-    0xac, 0xce, 0xed, 0xcc, 0xea, 0xa, 0xcc, 0xe9,
-    0x96, 0x67, 0x50, 0x7, 0xff, 0x89, 0x33, 0x3a,
-    0x6b, 0x33, 0x94, 0x13, 0x33, 0x88, 0x99, 0x9c,
-    0xa0, 0x1e, 0x17, 0xb5, 0x0, 0xff, 0xa3, 0x9a,
-    0x40, 0x3f, 0xca, 0x6a, 0x33, 0x20, 0xf, 0xcf,
-    0xd4, 0x0, 0x51, 0x90, 0xe, 0x4c, 0xfb, 0x0,
-    0xd1, 0xf8, 0x80, 0xb, 0xde, 0x80, 0xf, 0x37,
-    0x6e, 0x0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0x0, 0xc0, 0x1, 0x0, 0x4,
+    0x80, 0x8, 0x80, 0x21, 0x81, 0x80, 0x8c, 0x0,
+    0xc0,
 
     /* U+592A "太" */
-    0x0, 0xf9, 0x90, 0x3, 0xff, 0x84, 0x22, 0x0,
-    0xff, 0xe1, 0x78, 0x80, 0x7f, 0xf0, 0x85, 0xc0,
-    0x3f, 0x56, 0x67, 0x36, 0xe6, 0x75, 0x0, 0x2b,
-    0x33, 0x8d, 0x77, 0x33, 0x50, 0x7, 0xc6, 0xba,
-    0xe0, 0x1f, 0xfc, 0xb, 0xc7, 0xa0, 0xf, 0xfe,
-    0x2, 0x28, 0xaa, 0x80, 0x3f, 0xd1, 0x40, 0x8,
-    0x90, 0xf, 0xe4, 0x33, 0x40, 0xd, 0x48, 0x7,
-    0xc7, 0x14, 0xbf, 0x40, 0xc7, 0x0, 0x1d, 0x10,
-    0xd1, 0x7, 0xda, 0xa, 0x2a, 0x10, 0x5, 0xf5,
-    0x88, 0x4, 0xfe, 0x0, 0xac, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x7f, 0xfe, 0x1, 0x80, 0x1, 0x0, 0x2, 0x40,
+    0x2, 0x40, 0x4, 0x20, 0x5, 0x10, 0x8, 0x98,
+    0x30, 0x4c, 0x40, 0x2,
 
     /* U+5973 "女" */
-    0x0, 0xf1, 0xc0, 0x7, 0xff, 0xa, 0x28, 0x3,
-    0xff, 0x82, 0x62, 0x40, 0x1f, 0xd7, 0x99, 0x6b,
-    0xe6, 0x7e, 0x10, 0xbc, 0xc6, 0xae, 0xe6, 0x6a,
-    0xbc, 0xc0, 0x80, 0x69, 0xe0, 0xe, 0xc4, 0x0,
-    0xf9, 0x14, 0x3, 0xb, 0x98, 0x7, 0x96, 0xc0,
-    0x39, 0xa8, 0x3, 0xe9, 0xa8, 0x20, 0x0, 0xd3,
-    0x0, 0x7d, 0x3b, 0xdf, 0x69, 0xb6, 0x20, 0x1f,
-    0x28, 0x36, 0xfd, 0x92, 0x0, 0x7f, 0xc9, 0x10,
-    0xde, 0xa2, 0x0, 0xf1, 0x3e, 0x6f, 0x39, 0xe7,
-    0xf9, 0xc0, 0x28, 0xc8, 0x2c, 0x92, 0x0, 0x97,
-    0x39, 0x80,
+    0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0x7f, 0xfe,
+    0x4, 0x0, 0x8, 0x10, 0x8, 0x10, 0x0, 0x0,
+    0x1c, 0x20, 0x3, 0x40, 0x0, 0xc0, 0x1, 0x30,
+    0x6, 0x8, 0x70, 0x4,
 
     /* U+5979 "她" */
-    0x0, 0x88, 0x3, 0xff, 0x84, 0x30, 0x1, 0xf4,
-    0x80, 0x79, 0x74, 0x3, 0x30, 0x0, 0xc0, 0x3c,
-    0x66, 0x0, 0x87, 0x0, 0x38, 0x80, 0x6e, 0x7e,
-    0xf8, 0x3, 0x9a, 0x6e, 0x40, 0x6d, 0x6e, 0xc4,
-    0x0, 0x16, 0xb1, 0xbb, 0x0, 0x42, 0x40, 0x11,
-    0xdb, 0x1d, 0x39, 0x0, 0x65, 0xf0, 0x26, 0x9,
-    0x75, 0x10, 0x8, 0x40, 0x18, 0x80, 0xfa, 0x64,
-    0x1, 0xfc, 0x8a, 0x1e, 0x80, 0x1f, 0x11, 0x80,
-    0x20, 0x6d, 0xcc, 0x3, 0xcd, 0x34, 0x0, 0x46,
-    0xc0, 0xf, 0xb1, 0xac, 0xc0, 0x21, 0xab, 0xb0,
-    0x7, 0x30, 0x1, 0x10, 0x3, 0xb0, 0xdc, 0x42,
-    0x1, 0xe3, 0x0, 0x54, 0xa8, 0x29, 0x0, 0x2e,
-    0xfb, 0x10,
+    0x0, 0x0, 0x10, 0x10, 0x0, 0x10, 0x0, 0x90,
+    0x7c, 0x9e, 0x24, 0xb2, 0x25, 0x92, 0x4, 0x92,
+    0x40, 0x92, 0x48, 0x92, 0x18, 0x94, 0x8, 0x80,
+    0x14, 0x80, 0x20, 0x80, 0x40, 0xfe,
 
     /* U+597D "好" */
-    0x0, 0xff, 0xe3, 0xd0, 0x5, 0x37, 0x7d, 0xd0,
-    0x1, 0x84, 0x2, 0x9b, 0xbd, 0x25, 0x20, 0x11,
-    0x98, 0x3, 0xe1, 0x9e, 0x10, 0x1b, 0xd4, 0xbc,
-    0x70, 0x8, 0x6e, 0x88, 0x0, 0x36, 0xb9, 0x70,
-    0x20, 0x15, 0xc0, 0x80, 0x7e, 0x32, 0x0, 0xc6,
-    0x1, 0xc4, 0x60, 0xd, 0x1b, 0xb9, 0x36, 0xee,
-    0x0, 0x2e, 0x0, 0x5, 0x6e, 0xe4, 0xdb, 0xb8,
-    0x1, 0x9a, 0x6, 0x40, 0x1f, 0xf7, 0xed, 0xc5,
-    0x0, 0x7f, 0xc8, 0x88, 0x5a, 0x0, 0xff, 0xe0,
-    0xfe, 0x74, 0x0, 0x7f, 0x86, 0xe4, 0x9e, 0x0,
-    0x3f, 0xd1, 0xea, 0x1, 0xd, 0xd8, 0x44, 0x1,
-    0x80,
+    0x0, 0x0, 0x11, 0xfe, 0x10, 0x4, 0x10, 0x8,
+    0x7c, 0x10, 0x20, 0x20, 0x20, 0x20, 0x25, 0xfe,
+    0x4, 0x20, 0x64, 0x20, 0x18, 0x20, 0xc, 0x20,
+    0x12, 0x20, 0x20, 0x20, 0x40, 0xe0,
 
     /* U+5982 "如" */
-    0x0, 0x84, 0x3, 0xff, 0x85, 0x26, 0x1, 0xff,
-    0xc1, 0x33, 0x0, 0x45, 0x11, 0xc6, 0x1, 0xfa,
-    0x32, 0xef, 0x40, 0xde, 0xb6, 0x63, 0x50, 0x14,
-    0xcf, 0x38, 0xda, 0xf6, 0x61, 0x5c, 0x3, 0xf8,
-    0xcc, 0x0, 0x33, 0x0, 0x7f, 0xf0, 0x5c, 0x3,
-    0xf9, 0x70, 0x0, 0x4a, 0x1, 0xfd, 0x9c, 0x0,
-    0x5c, 0x0, 0xfe, 0xfc, 0xc2, 0xda, 0x80, 0x7f,
-    0x32, 0xec, 0x80, 0x7f, 0xf0, 0x49, 0xeb, 0x4,
-    0x3, 0xf8, 0xfe, 0x9a, 0x1c, 0x36, 0xef, 0x0,
-    0x1a, 0x34, 0x41, 0x18, 0xf6, 0xef, 0x30, 0x3d,
-    0x88, 0x6, 0x91, 0x0, 0xd4,
+    0x0, 0x0, 0x20, 0x0, 0x41, 0xf0, 0x84, 0x17,
+    0xe8, 0x24, 0x50, 0x48, 0xa0, 0x91, 0x41, 0x2,
+    0x82, 0xc1, 0x4, 0x52, 0x8, 0x64, 0x10, 0xa8,
+    0x22, 0x1f, 0xc8, 0x20, 0x80, 0x0,
 
     /* U+5B50 "子" */
-    0x0, 0xff, 0xe3, 0x26, 0x67, 0xf7, 0xb8, 0x6,
-    0x4c, 0xcf, 0xcc, 0xee, 0x0, 0xff, 0x8f, 0x3e,
-    0x0, 0x3f, 0xc3, 0x32, 0xd5, 0x0, 0xff, 0x90,
-    0x68, 0x40, 0x3f, 0xf8, 0x3c, 0x1, 0xfa, 0xae,
-    0xfa, 0x6e, 0xfd, 0x42, 0x17, 0x55, 0xff, 0xc0,
-    0xb1, 0x1, 0x1f, 0x18, 0x8f, 0xc0, 0x1f, 0xff,
-    0x94, 0xcb, 0xe4, 0x0, 0xf8,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x18, 0x0, 0x20,
+    0x0, 0xc0, 0x0, 0x80, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
 
     /* U+5B57 "字" */
-    0x0, 0xf3, 0x28, 0x7, 0x8e, 0xef, 0xd1, 0x77,
-    0xc7, 0x51, 0x77, 0xb7, 0x57, 0x7a, 0x28, 0x4,
-    0x3, 0xff, 0x80, 0x20, 0x57, 0x7f, 0x84, 0x68,
-    0x22, 0x5d, 0xf8, 0x74, 0x4a, 0x0, 0x3e, 0x3a,
-    0x96, 0x0, 0xfe, 0x59, 0xa3, 0x0, 0xcf, 0x99,
-    0xd0, 0xf9, 0x9d, 0xf, 0x99, 0xd7, 0x6c, 0xce,
-    0x80, 0xf, 0xff, 0x14, 0x5d, 0x28, 0x7, 0x80,
+    0x0, 0x1, 0xff, 0xe8, 0x0, 0x60, 0x1, 0x9f,
+    0xe4, 0x1, 0x0, 0x8, 0x0, 0x40, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
+    0x0,
 
     /* U+5B66 "学" */
-    0x0, 0xff, 0xe0, 0x8, 0x4, 0x54, 0x1, 0x50,
-    0x6, 0x87, 0x0, 0x8b, 0x58, 0x1, 0x8a, 0x0,
-    0x41, 0x60, 0x1, 0xde, 0x5d, 0xdb, 0x37, 0x6a,
-    0x2b, 0x40, 0xb9, 0xbd, 0xbb, 0xb2, 0xed, 0xd7,
-    0x6f, 0x1, 0x0, 0xff, 0xe1, 0x61, 0x9a, 0xef,
-    0xd9, 0xe4, 0x18, 0xa, 0x27, 0x77, 0xd0, 0x18,
-    0x40, 0xe0, 0x1f, 0xd, 0x5e, 0x18, 0x6, 0x11,
-    0xf3, 0x6c, 0x88, 0xf0, 0x4d, 0xdf, 0xff, 0x2,
-    0x2, 0x2a, 0xbf, 0xf8, 0x12, 0x1, 0xff, 0xd6,
-    0x1b, 0xb5, 0x28, 0x7, 0xc0,
+    0x0, 0x0, 0x44, 0x20, 0x0, 0x43, 0xff, 0xc8,
+    0x0, 0x50, 0x0, 0x87, 0xf8, 0x0, 0x20, 0x1,
+    0x80, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x80, 0x0,
 
     /* U+5B69 "孩" */
-    0x0, 0xff, 0xe2, 0xd5, 0xdd, 0xd0, 0x1, 0x48,
-    0x80, 0x75, 0x5d, 0xc7, 0x20, 0x11, 0x80, 0x7f,
-    0x44, 0x1e, 0xee, 0x5a, 0xbb, 0x84, 0x2, 0x30,
-    0x56, 0xbb, 0x6b, 0x5d, 0xe1, 0x0, 0xa2, 0x0,
-    0x11, 0xec, 0x82, 0x10, 0x7, 0xe1, 0xb8, 0xa0,
-    0x28, 0x20, 0xe, 0x78, 0xb4, 0x87, 0x1, 0xee,
-    0x0, 0x45, 0x96, 0x57, 0x65, 0x3f, 0xdd, 0x71,
-    0x1b, 0x81, 0x65, 0xa9, 0x80, 0x4c, 0xfa, 0x43,
-    0xec, 0x1, 0xf1, 0x5e, 0xd8, 0x8a, 0xbc, 0x40,
-    0x3e, 0x49, 0x80, 0x2c, 0xe3, 0x0, 0xfc, 0xc4,
-    0xd, 0x31, 0x26, 0x1, 0xfc, 0x98, 0x36, 0xbb,
-    0xe8, 0x0, 0x6c, 0x0, 0xaf, 0x74, 0xe0, 0x1,
-    0xd8, 0x10, 0x6c, 0xb0, 0x5, 0xc8, 0x80, 0x61,
-    0xc1,
+    0x0, 0x0, 0x7e, 0x20, 0x4, 0x20, 0x9, 0xfe,
+    0x8, 0x20, 0x10, 0x40, 0x11, 0x88, 0x1c, 0x90,
+    0x70, 0x60, 0x10, 0x44, 0x11, 0x88, 0x10, 0x10,
+    0x10, 0x28, 0x10, 0x84, 0x33, 0x2, 0x0, 0x0,
 
     /* U+5B83 "它" */
-    0x0, 0xf5, 0x80, 0x7e, 0x11, 0xe6, 0x11, 0xe0,
-    0x4, 0xdd, 0xf3, 0xdd, 0xf6, 0x82, 0xd5, 0x7f,
-    0xcc, 0x2e, 0x6, 0x1, 0xfc, 0x21, 0x21, 0x24,
-    0x1, 0xfa, 0x4, 0x80, 0x3e, 0x5b, 0x60, 0x20,
-    0xf, 0x1c, 0x59, 0x53, 0x0, 0x7a, 0x2e, 0xd5,
-    0x6e, 0x20, 0x1f, 0x4d, 0xc1, 0x0, 0x7f, 0x84,
-    0x3, 0xff, 0x92, 0x70, 0x1, 0x18, 0x80, 0x7c,
-    0x9c, 0x1, 0x57, 0xde, 0x67, 0xcc, 0x0,
+    0x2, 0x0, 0x8, 0xf, 0xff, 0xa0, 0x2, 0x80,
+    0x8, 0x80, 0x2, 0x4, 0x8, 0xc0, 0x3c, 0x0,
+    0x80, 0x2, 0x0, 0x8, 0x2, 0x20, 0x0, 0x7f,
+    0xc0,
 
     /* U+5B8C "完" */
-    0x0, 0xf9, 0x94, 0x3, 0xf2, 0x5d, 0xfa, 0x2e,
-    0xf9, 0x0, 0x1b, 0x37, 0x7b, 0x75, 0x77, 0xa7,
-    0x40, 0x6, 0x1, 0xff, 0xc0, 0x30, 0x7, 0x11,
-    0xdd, 0xfe, 0x42, 0xe0, 0x2, 0x1, 0xdd, 0xfe,
-    0x40, 0x40, 0xf, 0xfe, 0x35, 0x5d, 0xff, 0xf0,
-    0x28, 0x1, 0x57, 0x73, 0xdd, 0xc3, 0x57, 0x75,
-    0x0, 0x7f, 0xf2, 0x5a, 0xc0, 0x3f, 0xf8, 0x23,
-    0x4e, 0x1, 0xf9, 0xc0, 0x23, 0xdf, 0x0, 0xfe,
-    0xc0, 0x5, 0xd6, 0x98, 0x6, 0xcd, 0xbb, 0x88,
-    0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x40, 0x2, 0x40, 0x2,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x4, 0x40, 0x4, 0x40, 0x0, 0x40, 0x8, 0x40,
+    0x10, 0x42, 0x60, 0x3e,
 
     /* U+5B9A "定" */
-    0x0, 0xfa, 0x48, 0x3, 0xe4, 0x99, 0xe4, 0x89,
-    0x9c, 0xe0, 0x8, 0xbb, 0xef, 0x8b, 0xbd, 0x84,
-    0x0, 0x22, 0xff, 0x84, 0x1, 0x21, 0x15, 0x5f,
-    0x97, 0xc8, 0x14, 0x26, 0x22, 0xe, 0x88, 0x95,
-    0x40, 0x18, 0x48, 0xa3, 0x62, 0x28, 0x3, 0xcc,
-    0x60, 0x1f, 0xfc, 0x1c, 0x20, 0xb, 0xae, 0xea,
-    0x0, 0xe4, 0x0, 0xdd, 0x77, 0x50, 0x6, 0x45,
-    0x80, 0xf, 0xfe, 0x7, 0x50, 0x30, 0x7, 0xf9,
-    0x74, 0x67, 0x28, 0x80, 0x3e, 0x2f, 0x70, 0x5,
-    0x49, 0xf6, 0x67, 0x30,
+    0x1, 0x0, 0x7f, 0xf1, 0x0, 0x12, 0x0, 0x21,
+    0xff, 0x0, 0x20, 0x0, 0x40, 0x0, 0x80, 0x11,
+    0xf8, 0x22, 0x0, 0x64, 0x1, 0x48, 0x0, 0x70,
+    0x8, 0x3f, 0x80,
 
     /* U+5BB6 "家" */
-    0x0, 0xfa, 0x48, 0x3, 0xe5, 0xbb, 0xe4, 0xeb,
-    0xbd, 0x40, 0xe, 0xbb, 0xed, 0xcb, 0xbc, 0x64,
-    0x1, 0xff, 0xc4, 0xa0, 0x8b, 0xbb, 0xfa, 0xee,
-    0x28, 0x20, 0x10, 0x8b, 0xe1, 0xc9, 0x95, 0xd8,
-    0x88, 0x1, 0x14, 0x48, 0x9, 0x2d, 0x1, 0x58,
-    0x4, 0xb5, 0x49, 0x71, 0xb2, 0x23, 0x55, 0x98,
-    0x1, 0x60, 0x21, 0x6b, 0x56, 0x7a, 0x0, 0x31,
-    0xd5, 0x25, 0xcf, 0x38, 0xc4, 0xc0, 0x31, 0x54,
-    0xc, 0x55, 0xb8, 0x4c, 0x18, 0x4, 0x20, 0xf7,
-    0x69, 0x7, 0x0, 0x5c, 0xc0, 0x85, 0x50, 0xec,
-    0xc0, 0x80, 0x35, 0x69, 0x5, 0x51, 0x2, 0xae,
-    0x64, 0x1, 0x94, 0xc0, 0x3a, 0xae, 0xc4, 0x1,
-    0xe0,
+    0x1, 0x0, 0x7f, 0xf9, 0x0, 0x12, 0x0, 0x21,
+    0xff, 0x0, 0x40, 0x6, 0x92, 0x11, 0xa8, 0x8,
+    0x20, 0x63, 0x40, 0x1a, 0x40, 0x44, 0x66, 0x8,
+    0x0, 0xe0, 0x0, 0x0, 0x0,
 
     /* U+5C06 "将" */
-    0x0, 0xd4, 0x1, 0x85, 0x1e, 0xa8, 0x1, 0xe6,
-    0x49, 0xaa, 0x41, 0x25, 0x50, 0x2, 0xb0, 0x9,
-    0x36, 0xa8, 0xe, 0x60, 0x92, 0x0, 0xf9, 0x0,
-    0xb8, 0x83, 0x90, 0x7, 0xe4, 0x0, 0x86, 0x40,
-    0xe, 0xa0, 0x52, 0xb, 0x90, 0xd, 0x44, 0x0,
-    0x4d, 0x2, 0x75, 0xf2, 0x0, 0xfe, 0x50, 0x9,
-    0x7c, 0x40, 0x3e, 0x4b, 0xbf, 0x26, 0xd9, 0x0,
-    0x4e, 0x9, 0x77, 0xe5, 0xdb, 0x20, 0x5c, 0x20,
-    0xa, 0x88, 0x3, 0xe1, 0xcd, 0x50, 0xa, 0xf8,
-    0x3, 0xe1, 0x91, 0x0, 0xc3, 0x10, 0x0, 0xff,
-    0xe1, 0x24, 0x0, 0x7f, 0x98, 0x3, 0xae, 0xce,
-    0x20, 0x0,
+    0x8, 0xc, 0xb, 0xc0, 0x48, 0x42, 0x2a, 0x4,
+    0x29, 0x8, 0x8, 0x0, 0x8, 0x8, 0xb, 0xfe,
+    0x8, 0x8, 0x29, 0x8, 0x48, 0x88, 0x8, 0x48,
+    0x8, 0x8, 0x8, 0x38,
 
     /* U+5C0F "小" */
-    0x0, 0xf0, 0xc8, 0x7, 0xff, 0x4, 0xc8, 0x3,
-    0xff, 0x9a, 0x20, 0x1f, 0x10, 0x7, 0x3b, 0x80,
-    0x3e, 0xe0, 0xe, 0xb7, 0x0, 0xfa, 0x60, 0x2,
-    0x10, 0x10, 0xf, 0x95, 0x4, 0x0, 0xd4, 0x1,
-    0xfd, 0x30, 0x0, 0xa6, 0x0, 0xfe, 0x54, 0x8,
-    0xb0, 0xf, 0xf9, 0x5b, 0xd8, 0x3, 0xfe, 0xa3,
-    0x70, 0xf, 0xfe, 0x1, 0x28, 0x7, 0xc2, 0x1,
-    0xff, 0x5e, 0x76, 0x0, 0x7c,
+    0x1, 0x0, 0x2, 0x0, 0x4, 0x0, 0x8, 0x0,
+    0x11, 0x4, 0x21, 0x8, 0x42, 0x0, 0x82, 0x41,
+    0x5, 0x2, 0x8, 0x4, 0x0, 0x8, 0x0, 0x10,
+    0x1, 0xc0, 0x0,
 
     /* U+5C11 "少" */
-    0x0, 0xfa, 0x48, 0x3, 0xff, 0x84, 0x60, 0x1f,
-    0xf2, 0xb8, 0x7, 0xa5, 0x0, 0x3d, 0x2c, 0x1,
-    0xe9, 0x81, 0x0, 0xcf, 0x62, 0x1, 0xf7, 0xd0,
-    0x4, 0x78, 0xe0, 0x1f, 0x8c, 0xce, 0x3, 0xf4,
-    0x1, 0xfc, 0x91, 0x42, 0x2d, 0x10, 0xf, 0xcc,
-    0x61, 0xe2, 0x2, 0x0, 0x1b, 0xb3, 0x10, 0xd,
-    0x30, 0x10, 0x7, 0xd, 0xdb, 0x0, 0x15, 0x22,
-    0x1, 0xff, 0xc0, 0xac, 0x50, 0xf, 0xf9, 0x73,
-    0xdc, 0x3, 0xf8, 0xe3, 0x37, 0x14, 0x3, 0xf5,
-    0xe5, 0xe6, 0x20, 0x3, 0xf0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x10, 0x11, 0x8,
+    0x1, 0x4, 0x21, 0x4, 0x41, 0x2, 0x1, 0x0,
+    0x7, 0x10, 0x0, 0x20, 0x0, 0x40, 0x0, 0x80,
+    0x7, 0x0, 0x38, 0x0,
 
     /* U+5C31 "就" */
-    0x0, 0xff, 0xe4, 0x40, 0x80, 0x75, 0xa4, 0x0,
-    0x78, 0x4c, 0x3, 0x9d, 0x5, 0x40, 0x15, 0x76,
-    0x29, 0xbb, 0x18, 0x6, 0x9d, 0x0, 0x55, 0xdf,
-    0x8c, 0x3, 0xa0, 0x2, 0xbb, 0xe6, 0x65, 0xe1,
-    0x5d, 0xc6, 0x2, 0x2b, 0xba, 0xb1, 0xaf, 0x8a,
-    0xee, 0x30, 0xf, 0xf3, 0x19, 0x80, 0x30, 0xb5,
-    0xdd, 0x5a, 0x0, 0x32, 0x0, 0xf6, 0x59, 0x4d,
-    0xb8, 0x2, 0xd0, 0x3, 0xd6, 0x1, 0x39, 0x80,
-    0xb8, 0x80, 0x72, 0x18, 0x4, 0xd2, 0x11, 0xe0,
-    0x1e, 0xf9, 0x0, 0x87, 0xc, 0x90, 0x2, 0x18,
-    0xe, 0x10, 0xc, 0xff, 0x20, 0x18, 0xc0, 0xa,
-    0x76, 0xa4, 0x11, 0xe4, 0x1b, 0xf7, 0xd8,
+    0x0, 0x0, 0x8, 0x14, 0x8, 0x14, 0x7f, 0x12,
+    0x0, 0x10, 0x3e, 0x7e, 0x21, 0x10, 0x21, 0x10,
+    0x3e, 0x10, 0x8, 0x30, 0x28, 0x30, 0x29, 0x50,
+    0x48, 0x51, 0x8, 0x91, 0x19, 0xe,
 
     /* U+5C4B "屋" */
-    0x0, 0x4d, 0x57, 0xfa, 0x40, 0x25, 0xaa, 0xff,
-    0x10, 0x7, 0xff, 0x1e, 0xef, 0xfa, 0x8c, 0x3,
-    0x5d, 0xff, 0x54, 0x0, 0x67, 0xaa, 0x5d, 0xaa,
-    0xbc, 0x40, 0x13, 0xd5, 0xa, 0x2a, 0x99, 0x35,
-    0x42, 0x0, 0xe3, 0x3, 0x1, 0x48, 0x80, 0x7,
-    0x1d, 0x49, 0xd7, 0x45, 0x60, 0x50, 0x0, 0x98,
-    0xea, 0xb2, 0xcc, 0x3c, 0x58, 0x1, 0xf4, 0x2a,
-    0xee, 0x5b, 0xbc, 0x80, 0xc, 0x40, 0xab, 0xb9,
-    0x6e, 0xf2, 0x80, 0x14, 0xc0, 0x3f, 0xf8, 0x9,
-    0x65, 0x55, 0xcb, 0x75, 0x5a, 0x0,
+    0x3f, 0xfc, 0x40, 0x8, 0x80, 0x11, 0xff, 0xe2,
+    0x0, 0x5, 0xff, 0x88, 0x80, 0x11, 0xc, 0x2f,
+    0xec, 0x41, 0x0, 0x3f, 0xe2, 0x4, 0x4, 0x8,
+    0x3, 0xff, 0xc0,
 
     /* U+5C55 "展" */
-    0x0, 0x45, 0xdf, 0xfc, 0x1, 0x25, 0xdf, 0xf9,
-    0xc0, 0x3f, 0xf8, 0xf7, 0x7f, 0xe7, 0x0, 0xd7,
-    0x70, 0x5d, 0xd4, 0x37, 0x60, 0xf, 0xfe, 0x39,
-    0xdd, 0x96, 0xee, 0xa4, 0xbb, 0x18, 0x4, 0x77,
-    0x65, 0xbb, 0xa9, 0x2e, 0xc6, 0x0, 0x78, 0xbb,
-    0x2d, 0xdd, 0x49, 0x76, 0x90, 0x11, 0x45, 0x87,
-    0x5e, 0xf5, 0xf4, 0x74, 0x82, 0x68, 0x7, 0x37,
-    0x93, 0xd2, 0x0, 0x31, 0x0, 0x3d, 0x7e, 0x32,
-    0x20, 0x5, 0x30, 0x17, 0x74, 0xdb, 0x66, 0x1c,
-    0x40, 0xe4, 0x16, 0xec, 0x71, 0x6e, 0x34, 0x77,
-    0x20,
+    0x3f, 0xfc, 0x40, 0x8, 0x80, 0x11, 0xff, 0xe2,
+    0x21, 0x4, 0x42, 0xb, 0xff, 0x11, 0x8, 0x3f,
+    0xfe, 0x48, 0x0, 0x11, 0x22, 0x21, 0x4, 0x59,
+    0x1, 0x0, 0xc0,
 
     /* U+5C71 "山" */
-    0x0, 0xf5, 0x0, 0x7f, 0xc2, 0x20, 0xf, 0xfe,
-    0x3a, 0x0, 0x7f, 0xc7, 0x0, 0x1f, 0xe2, 0x90,
-    0xf, 0xff, 0xf8, 0x4, 0x79, 0x9b, 0x53, 0x33,
-    0x70, 0x1e, 0x67, 0x7e, 0x66, 0xe0, 0x70, 0xf,
-    0xf1, 0x9a, 0xc0, 0x3f, 0xc3, 0x20,
+    0x2, 0x0, 0x10, 0x0, 0x80, 0x4, 0x8, 0x20,
+    0xc1, 0x6, 0x8, 0x30, 0x41, 0x82, 0xc, 0x10,
+    0x60, 0x83, 0xff, 0xf8, 0x0, 0xc0, 0x4, 0x0,
+    0x0,
 
     /* U+5CB8 "岸" */
-    0x0, 0x50, 0x6, 0x55, 0x0, 0x6a, 0x0, 0xcc,
-    0x1, 0x8c, 0xc0, 0x19, 0x80, 0x32, 0xdd, 0xff,
-    0x9c, 0x3, 0x4d, 0xde, 0xdd, 0x5d, 0xf0, 0x6,
-    0x59, 0x9f, 0xf9, 0xc0, 0x29, 0xbb, 0xff, 0x98,
-    0x3, 0x11, 0x7f, 0xc2, 0x1, 0xcb, 0x77, 0x66,
-    0xdd, 0xd4, 0x20, 0x13, 0x82, 0xdd, 0xde, 0xb7,
-    0x75, 0x8, 0x0, 0x44, 0x1, 0xce, 0x20, 0x1f,
-    0x11, 0x12, 0xef, 0x42, 0x5d, 0xea, 0x0, 0x5e,
-    0x25, 0xde, 0xf5, 0xbb, 0xd4, 0x0, 0x44, 0x0,
-    0x7f, 0xf0, 0xbc, 0x3, 0xff, 0x84,
+    0x20, 0x4, 0x20, 0x4, 0x3f, 0xfc, 0x0, 0x0,
+    0x1f, 0xfc, 0x20, 0x0, 0x20, 0x0, 0x27, 0xfc,
+    0x20, 0x40, 0x20, 0x40, 0x2f, 0xfe, 0x40, 0x40,
+    0x40, 0x40, 0x0, 0x40,
 
     /* U+5DE5 "工" */
-    0x2, 0xcc, 0xff, 0xe0, 0x18, 0x0, 0xb3, 0x3a,
-    0xeb, 0x33, 0x8c, 0x3, 0xff, 0xfe, 0x1, 0xff,
-    0xfb, 0xbb, 0xf6, 0x6d, 0xdf, 0x80,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
 
     /* U+5DF1 "己" */
-    0xac, 0xcf, 0xea, 0x0, 0x56, 0x67, 0xf3, 0x0,
-    0x7f, 0xf7, 0x52, 0xef, 0xf8, 0x40, 0x1d, 0x35,
-    0x5f, 0x84, 0x0, 0x26, 0x23, 0xfb, 0x40, 0x3f,
-    0xf8, 0x2, 0x1, 0xff, 0xcf, 0xa1, 0x0, 0xff,
-    0x98, 0xa4, 0x8b, 0xf1, 0xcd, 0xc7, 0xdc, 0x47,
-    0xd5, 0xee,
+    0xff, 0xe0, 0x1, 0x0, 0x8, 0x0, 0x40, 0x2,
+    0x3f, 0xf2, 0x0, 0x90, 0x0, 0x80, 0x4, 0x0,
+    0x20, 0x3, 0x0, 0x1c, 0x1, 0x1f, 0xf0,
 
     /* U+5DF2 "已" */
-    0x6c, 0xcf, 0xf5, 0x0, 0x1b, 0x33, 0xfc, 0xc0,
-    0x10, 0x80, 0x7f, 0xf0, 0x68, 0x3, 0xff, 0xbd,
-    0x99, 0xfc, 0x20, 0x1b, 0x33, 0xf9, 0x40, 0x3f,
-    0xf8, 0x30, 0x1, 0xff, 0xd1, 0x90, 0xf, 0xfe,
-    0x1, 0x10, 0x8, 0xc0, 0x3f, 0xab, 0x42, 0xff,
-    0x33, 0xf8, 0x58,
+    0x7f, 0xf0, 0x0, 0x40, 0x1, 0x10, 0x4, 0x40,
+    0x11, 0x0, 0x47, 0xff, 0x10, 0x4, 0x40, 0x1,
+    0x0, 0x4, 0x0, 0x50, 0x1, 0x40, 0x8, 0xff,
+    0xe0,
 
     /* U+5E2D "席" */
-    0x0, 0xfd, 0x60, 0x1f, 0xcf, 0x77, 0xc9, 0x77,
-    0xd4, 0x1, 0x5d, 0xe8, 0xbf, 0xbb, 0x45, 0xda,
-    0x80, 0x3e, 0xf0, 0xd, 0x0, 0x1f, 0x35, 0xd8,
-    0xee, 0xf2, 0xdd, 0xa0, 0x3, 0x35, 0xd8, 0xee,
-    0xf2, 0xdd, 0xa0, 0x2, 0x70, 0xf, 0xfe, 0x3d,
-    0xd5, 0xed, 0x18, 0x7, 0xf9, 0xea, 0x16, 0xa0,
-    0x3, 0x88, 0x81, 0x17, 0x77, 0xad, 0xde, 0x0,
-    0x9b, 0x81, 0x2e, 0xef, 0x5b, 0xb9, 0xc0, 0x2c,
-    0x40, 0xf, 0xfe, 0x12, 0x18, 0x7, 0xff, 0x4,
-    0x90, 0x0, 0xc0, 0x10, 0xf8, 0x4d, 0x58, 0x0,
+    0x0, 0x80, 0x1f, 0xfe, 0x20, 0x0, 0x22, 0x10,
+    0x2f, 0xfe, 0x22, 0x10, 0x22, 0x10, 0x21, 0xf0,
+    0x20, 0x40, 0x2f, 0xfc, 0x8, 0x44, 0x48, 0x44,
+    0x48, 0x44, 0x48, 0x18,
 
     /* U+5E2E "帮" */
-    0x0, 0xff, 0xe3, 0xa3, 0x0, 0x49, 0x97, 0x6d,
-    0x90, 0x7a, 0xa4, 0x5d, 0x51, 0x32, 0x2e, 0xc3,
-    0x60, 0xf5, 0x49, 0xaa, 0x90, 0x2, 0x69, 0x20,
-    0x3a, 0xa4, 0xd5, 0x42, 0x1, 0x70, 0x4, 0x75,
-    0x4b, 0x8a, 0xa0, 0x80, 0x51, 0x8a, 0x13, 0x3b,
-    0xe6, 0x4a, 0x1, 0xa3, 0xc2, 0x65, 0xd1, 0x53,
-    0x25, 0x0, 0x44, 0xd7, 0x0, 0x23, 0x98, 0x0,
-    0x65, 0xef, 0x13, 0x68, 0x7, 0xb2, 0x1, 0x2b,
-    0xb8, 0xc0, 0x38, 0xc7, 0x2e, 0xf4, 0x5d, 0xe9,
-    0x0, 0x8a, 0x6e, 0xf4, 0x5d, 0xe5, 0x0, 0xff,
-    0xe7, 0x25, 0x51, 0x40, 0x26, 0x50, 0xf, 0x25,
-    0x52, 0x40,
+    0x0, 0x0, 0x0, 0x7c, 0xfd, 0x10, 0x2, 0x3,
+    0xf4, 0x80, 0x8, 0x9f, 0xd0, 0x80, 0x2e, 0x30,
+    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x20, 0x0,
+    0x40, 0x3, 0x80, 0x0, 0x0,
 
     /* U+5E38 "常" */
-    0x0, 0xff, 0xe2, 0x50, 0x80, 0x24, 0x40, 0x9,
-    0x20, 0x1a, 0x6c, 0x0, 0x66, 0x0, 0x7c, 0x80,
-    0x12, 0xe0, 0x6e, 0xc9, 0x37, 0x60, 0xbb, 0x1f,
-    0x5d, 0xf7, 0x5d, 0xf4, 0xd0, 0x80, 0x1e, 0xab,
-    0xce, 0x1, 0x78, 0x3, 0x6a, 0xbd, 0x60, 0x5a,
-    0x80, 0x1f, 0xfc, 0x4, 0x0, 0xb6, 0xa9, 0xb7,
-    0x55, 0x0, 0x79, 0xea, 0x89, 0x35, 0x46, 0x0,
-    0xcb, 0x97, 0x73, 0xf5, 0xdd, 0x88, 0x0, 0xc8,
-    0xbb, 0x9f, 0xae, 0xe9, 0xc0, 0xf, 0xfe, 0x71,
-    0x80, 0x58, 0xc0, 0x10, 0x98, 0x3d, 0x7d, 0x0,
+    0x0, 0x0, 0x88, 0x41, 0x22, 0x1f, 0xfe, 0x80,
+    0x6, 0x3f, 0x11, 0x2, 0x4, 0x8, 0xf, 0xc0,
+    0x8, 0x3, 0xff, 0x10, 0x82, 0x42, 0x9, 0x8,
+    0x20, 0x23, 0x0,
 
     /* U+5E72 "干" */
-    0x1, 0xcc, 0xee, 0xdc, 0xce, 0x30, 0x0, 0xe6,
-    0x74, 0xde, 0x67, 0x18, 0x7, 0xff, 0xda, 0xf3,
-    0x3a, 0x6f, 0x33, 0xac, 0x1, 0x79, 0x9d, 0x37,
-    0x99, 0xd6, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe0,
-    0x89, 0x80, 0x7c,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+5E73 "平" */
-    0x1, 0xbc, 0xcd, 0xba, 0xcc, 0xd6, 0x20, 0x1,
-    0xbf, 0xcc, 0xae, 0x33, 0x2e, 0xb1, 0x0, 0xd2,
-    0x40, 0x1e, 0x1e, 0x0, 0xf4, 0x58, 0x7, 0xa6,
-    0x40, 0x1e, 0x25, 0x0, 0xe1, 0x35, 0x0, 0xfb,
-    0xc0, 0x39, 0x60, 0x3, 0xa6, 0xa9, 0x35, 0x54,
-    0xd7, 0x4d, 0x52, 0x40, 0x11, 0x1e, 0x4b, 0x88,
-    0xf0, 0x0, 0x48, 0xbb, 0x88, 0xbc, 0x20, 0x1f,
-    0xff, 0x50,
+    0x3f, 0xfc, 0x0, 0x0, 0x10, 0x8, 0x8, 0x10,
+    0x8, 0x10, 0x0, 0x0, 0x7f, 0xfe, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
 
     /* U+5E74 "年" */
-    0x0, 0xd0, 0x80, 0x1f, 0xfc, 0x11, 0x55, 0x8,
-    0xfe, 0x0, 0xe8, 0x6b, 0xbb, 0x2a, 0xef, 0x20,
-    0x4, 0x87, 0x75, 0x52, 0x4d, 0x56, 0x40, 0x1,
-    0x4d, 0x80, 0x7f, 0xf0, 0x6f, 0xca, 0xef, 0x3f,
-    0x5d, 0xe0, 0xa, 0x49, 0x3a, 0xee, 0x7e, 0xbb,
-    0xc0, 0x1f, 0xfd, 0x79, 0xab, 0x9a, 0xa9, 0x26,
-    0xab, 0x48, 0x2, 0x21, 0xdc, 0x88, 0x9f, 0xe2,
-    0x38, 0x0, 0x24, 0x5e, 0x36, 0x22, 0xc2, 0x1,
-    0xff, 0xcd, 0x10, 0xf, 0x80,
+    0x8, 0x0, 0x8, 0x0, 0x1f, 0xfc, 0x10, 0x80,
+    0x20, 0x80, 0x4f, 0xfc, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x7f, 0xfe, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80,
 
     /* U+5E76 "并" */
-    0x0, 0xff, 0xe3, 0x8d, 0x0, 0x7a, 0xc4, 0x3,
-    0xc3, 0xac, 0x1, 0x9b, 0x4, 0x3, 0xe7, 0xc0,
-    0xd, 0xce, 0x1, 0xc9, 0x76, 0xc7, 0xbb, 0xcb,
-    0xb7, 0x65, 0x0, 0x25, 0xda, 0x16, 0xef, 0x54,
-    0x5d, 0x94, 0x3, 0xff, 0xac, 0x24, 0x41, 0x11,
-    0x16, 0xf3, 0x22, 0x80, 0x11, 0x76, 0xe5, 0xbb,
-    0xc9, 0xb7, 0x70, 0x2, 0x66, 0xc9, 0x9e, 0xbe,
-    0x99, 0x80, 0x3a, 0xd0, 0x3, 0xff, 0x82, 0xa8,
-    0x20, 0x1f, 0xfc, 0x6, 0xe8, 0x0, 0xff, 0xe0,
-    0x48, 0xd8, 0x7, 0x84, 0x40, 0x18,
+    0x0, 0x0, 0x8, 0x10, 0x0, 0x0, 0x4, 0x20,
+    0x3f, 0xfc, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0,
+    0x4, 0x20, 0x7f, 0xfe, 0x0, 0x0, 0x8, 0x0,
+    0x8, 0x0, 0x10, 0x0, 0x40, 0x0,
 
     /* U+5E95 "底" */
-    0x0, 0xfd, 0x60, 0x1f, 0x9e, 0xef, 0x92, 0xef,
-    0xa8, 0x1, 0x77, 0xef, 0xbb, 0xea, 0x0, 0xf8,
-    0x4d, 0xa2, 0xa8, 0x20, 0x1e, 0xca, 0x85, 0x11,
-    0x55, 0x4, 0x3, 0xcf, 0x52, 0xca, 0x1, 0xf3,
-    0x80, 0x78, 0xcc, 0x1, 0xfc, 0xb7, 0x75, 0x25,
-    0xdd, 0x20, 0x1c, 0xb7, 0x79, 0x6e, 0xe9, 0x2,
-    0x20, 0x7, 0xc2, 0x1, 0xcd, 0xc0, 0x18, 0x4d,
-    0x75, 0x0, 0x36, 0x22, 0xdb, 0x54, 0x20, 0x37,
-    0x0, 0x24, 0x10, 0xd6, 0xf6, 0xa5, 0xd4, 0x4d,
-    0x40, 0x88, 0xa0, 0x97, 0x7e, 0x79, 0xcc, 0x69,
-    0x48, 0x25, 0xdf, 0x9c, 0x27, 0x18,
+    0x0, 0x80, 0x3f, 0xfc, 0x80, 0x1, 0x1, 0xc2,
+    0x72, 0x4, 0x84, 0x9, 0x8, 0x13, 0xff, 0x24,
+    0x20, 0x48, 0x40, 0x10, 0x2, 0x78, 0x94, 0x1,
+    0x29, 0xf9, 0x80, 0x0, 0x0,
 
     /* U+5EA6 "度" */
-    0x0, 0xfd, 0x60, 0x1f, 0xcf, 0x77, 0xc9, 0x77,
-    0xd4, 0x1, 0x5d, 0xea, 0xbf, 0xbb, 0x55, 0xda,
-    0x80, 0x3e, 0xa0, 0xd, 0x40, 0x1f, 0x2d, 0x51,
-    0x2a, 0xb2, 0xd5, 0x20, 0x3, 0x2d, 0x51, 0x2a,
-    0xb1, 0x55, 0x20, 0x2, 0x70, 0xf, 0xce, 0x1,
-    0xfe, 0xea, 0xad, 0x80, 0x1f, 0xe5, 0xaa, 0xce,
-    0x1, 0xc4, 0x55, 0x5e, 0x55, 0x77, 0x98, 0x4,
-    0xdc, 0x55, 0x6f, 0x15, 0x56, 0xc1, 0x80, 0x46,
-    0x80, 0x15, 0xd9, 0x46, 0x49, 0xc0, 0x35, 0x98,
-    0x4, 0x5d, 0xcb, 0x1, 0x0, 0xc4, 0xa0, 0xd5,
-    0x2a, 0xab, 0xa9, 0x19, 0xa9, 0x2, 0x90, 0x6a,
-    0x97, 0x20, 0x9, 0x66, 0xa4, 0x0,
+    0x0, 0x80, 0x1f, 0xfe, 0x20, 0x0, 0x22, 0x10,
+    0x2f, 0xfe, 0x22, 0x10, 0x22, 0x10, 0x21, 0xe0,
+    0x20, 0x0, 0x2f, 0xf8, 0x2, 0x0, 0x1, 0x20,
+    0x40, 0xe0, 0x4c, 0xe, 0x0, 0x0,
 
     /* U+5EA7 "座" */
-    0x0, 0xfd, 0x60, 0x1f, 0xd1, 0x77, 0xc9, 0x77,
-    0xe1, 0x0, 0x25, 0xdf, 0x7d, 0xdf, 0x84, 0x3,
-    0x88, 0xc0, 0xd0, 0x1, 0x20, 0x1f, 0xa8, 0x0,
-    0xc4, 0x6, 0x20, 0x1c, 0xe0, 0x6, 0x10, 0xd,
-    0x46, 0x1, 0xf3, 0xcc, 0x8c, 0x0, 0x66, 0x8b,
-    0x10, 0xc, 0xba, 0xf7, 0x40, 0x31, 0x47, 0x14,
-    0x0, 0x11, 0x3d, 0x0, 0x24, 0x6, 0xc0, 0x7,
-    0x60, 0x2, 0x2a, 0xae, 0xe8, 0xbb, 0xd4, 0x1,
-    0x37, 0x5, 0x5d, 0xd1, 0x77, 0xa8, 0x2, 0xd5,
-    0x0, 0xff, 0xe1, 0x21, 0x80, 0x7f, 0xf0, 0x45,
-    0x82, 0xef, 0xa2, 0xef, 0xc2, 0x2b, 0xb, 0xbe,
-    0xdd, 0x5d, 0xf0, 0x80,
+    0x0, 0x80, 0x3f, 0xfe, 0x20, 0x0, 0x20, 0x8,
+    0x24, 0x8, 0x24, 0x18, 0x22, 0x14, 0x29, 0x22,
+    0x20, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x40, 0x0,
+    0x40, 0x0, 0x5f, 0xfe, 0x0, 0x0,
 
     /* U+5EFA "建" */
-    0x0, 0xff, 0xe2, 0xd, 0xdb, 0x60, 0x3, 0x23,
-    0x0, 0x70, 0xdd, 0x9e, 0x81, 0xea, 0x91, 0x75,
-    0x50, 0x6, 0x11, 0x10, 0x3d, 0x52, 0x6e, 0xa8,
-    0x2, 0x1, 0x4f, 0x4, 0xd5, 0x53, 0x75, 0x44,
-    0xa2, 0x0, 0x22, 0x84, 0xd5, 0x53, 0x75, 0x44,
-    0xa2, 0x7, 0x2b, 0xb1, 0x45, 0x52, 0x6e, 0xa8,
-    0xc2, 0x0, 0x1e, 0xb2, 0x8, 0xaa, 0x4d, 0xd5,
-    0x30, 0x2, 0x60, 0x1, 0x12, 0x6a, 0x93, 0x55,
-    0x84, 0x0, 0x8c, 0x1, 0x4d, 0x52, 0x6a, 0xb0,
-    0x80, 0x13, 0x53, 0x0, 0x38, 0x40, 0x3e, 0xda,
-    0x66, 0x55, 0x53, 0x75, 0x54, 0x0, 0x4a, 0x2e,
-    0xd5, 0x54, 0xd5, 0x68, 0x0, 0x17, 0x6f, 0xda,
-    0x0, 0x1d, 0x40, 0x3d, 0xf2, 0x53, 0x2c, 0xbc,
-    0xef, 0xcc, 0xac, 0x0,
+    0x0, 0x0, 0x78, 0x0, 0x11, 0xfc, 0x10, 0x4,
+    0x27, 0xfe, 0x20, 0x4, 0x3b, 0xfc, 0x8, 0x0,
+    0xb, 0xfc, 0x8, 0x0, 0x20, 0x0, 0x13, 0xfe,
+    0x10, 0x0, 0x2c, 0x0, 0x43, 0xfe,
 
     /* U+5F00 "开" */
-    0x4, 0xbb, 0x67, 0x5d, 0xed, 0xd5, 0xd9, 0x40,
-    0x9, 0x76, 0xe4, 0xbb, 0xfc, 0xa0, 0x1f, 0xfe,
-    0x6b, 0xbb, 0x92, 0xef, 0xf8, 0x1, 0x77, 0x7b,
-    0x5d, 0xff, 0x0, 0x72, 0xf0, 0x7, 0xff, 0xb,
-    0x50, 0x3, 0xff, 0x82, 0x4e, 0x40, 0x1f, 0xfc,
-    0x19, 0xf0, 0xf, 0xfe, 0xd, 0xe9, 0x80, 0x7f,
-    0xf0, 0x23, 0x98, 0x3, 0xc6, 0x60, 0xc,
+    0x3f, 0xfc, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0,
+    0x4, 0x0, 0x7f, 0xfe, 0x4, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x8, 0x0, 0x10, 0x0, 0x20, 0x0,
+    0x40, 0x0,
 
     /* U+5F1F "弟" */
-    0x0, 0xff, 0xe2, 0xc9, 0x0, 0x74, 0x90, 0x7,
-    0x5c, 0x80, 0x63, 0x2, 0x0, 0xa6, 0xe5, 0xae,
-    0xd9, 0x7c, 0xb7, 0x20, 0x9, 0xbb, 0x6d, 0xca,
-    0xde, 0xe5, 0xa8, 0x7, 0xff, 0x16, 0x2e, 0xee,
-    0x7b, 0xbc, 0x1, 0x18, 0xdd, 0xdc, 0xf7, 0x7b,
-    0x0, 0x9, 0xa0, 0x1f, 0xfc, 0xb, 0x8b, 0xbb,
-    0x9e, 0xef, 0x94, 0x23, 0x2e, 0xd0, 0x2f, 0x77,
-    0xa7, 0xc1, 0x0, 0xb, 0xd2, 0x1, 0xcc, 0x40,
-    0x1, 0xa8, 0xf6, 0x0, 0xe3, 0xd2, 0xae, 0xd,
-    0x20, 0x8, 0xae, 0xe5, 0x46, 0xba, 0x0, 0x84,
-    0xa, 0xed, 0x80,
+    0x0, 0x0, 0x40, 0x80, 0x82, 0x1f, 0xfe, 0x1,
+    0x8, 0x4, 0x23, 0xff, 0x88, 0x40, 0x1, 0x1,
+    0xff, 0xe0, 0x30, 0x41, 0x41, 0x19, 0x1, 0xc4,
+    0xe4, 0x10, 0x0,
 
     /* U+5F3A "强" */
-    0xa, 0xbb, 0xa0, 0x22, 0xae, 0xf5, 0x0, 0x55,
-    0x77, 0x18, 0x1d, 0x5d, 0xe1, 0x0, 0xff, 0xe7,
-    0x19, 0xf3, 0x80, 0x49, 0x77, 0x60, 0x7d, 0xdb,
-    0x6e, 0xd2, 0x1, 0x75, 0xdc, 0xe0, 0xb5, 0x42,
-    0xaa, 0x20, 0x4, 0x20, 0x18, 0x76, 0xa8, 0x55,
-    0x51, 0x80, 0x16, 0xee, 0x62, 0x48, 0x82, 0xc4,
-    0x35, 0x80, 0x11, 0x77, 0x50, 0x7, 0xfc, 0xc0,
-    0x18, 0x92, 0xec, 0xb7, 0x6a, 0x60, 0xe, 0x16,
-    0x1c, 0xbb, 0x2d, 0xd7, 0x18, 0x7, 0x29, 0x0,
-    0x7d, 0x20, 0x1e, 0x3d, 0x23, 0x45, 0x67, 0x97,
-    0xa0, 0xa, 0x2e, 0xca, 0x96, 0x41, 0x29, 0x38,
-    0x62,
+    0x7d, 0xfc, 0x5, 0x4, 0x5, 0x4, 0x5, 0x4,
+    0x38, 0xf8, 0x40, 0x20, 0x41, 0xfc, 0x79, 0x20,
+    0x5, 0x20, 0x5, 0xfc, 0x4, 0x20, 0x4, 0x24,
+    0x0, 0x2e, 0x39, 0x2,
 
     /* U+5F53 "当" */
-    0x8, 0x30, 0xa, 0x48, 0x3, 0x28, 0x4f, 0x80,
-    0x46, 0x1, 0x9c, 0xc0, 0x69, 0xc0, 0x3c, 0x36,
-    0xc0, 0x6, 0xf0, 0xf, 0x47, 0x80, 0x68, 0x0,
-    0xf6, 0x98, 0x2, 0x33, 0x32, 0x7e, 0x62, 0x31,
-    0x42, 0x33, 0x37, 0x6e, 0x65, 0xbc, 0x1, 0xff,
-    0xcf, 0x1b, 0xbf, 0xed, 0x0, 0xd, 0xdf, 0xf6,
-    0x80, 0x7f, 0xf1, 0x4, 0x7f, 0x8c, 0x1, 0x55,
-    0xfe, 0x91,
+    0x42, 0x1, 0x10, 0x0, 0x84, 0x24, 0x40, 0x20,
+    0x3f, 0xf8, 0x0, 0x20, 0x1, 0x0, 0x9, 0xff,
+    0xc0, 0x2, 0x0, 0x10, 0x0, 0xbf, 0xfc,
 
     /* U+5F62 "形" */
-    0xa, 0xbf, 0xbb, 0x67, 0x58, 0x4, 0x36, 0x20,
-    0xa, 0xb4, 0xbb, 0x7b, 0x58, 0x0, 0xea, 0x4,
-    0x3, 0xfe, 0x9a, 0xa1, 0x80, 0x7f, 0xc7, 0x52,
-    0x20, 0x1f, 0xfc, 0x3, 0x30, 0x0, 0x9c, 0x3,
-    0xff, 0x82, 0x5c, 0xa0, 0x37, 0x8b, 0x98, 0xe6,
-    0xc3, 0x4, 0xee, 0x10, 0xd, 0xea, 0x66, 0x39,
-    0xb0, 0xe7, 0xb0, 0x80, 0x31, 0x98, 0x3, 0x8b,
-    0x68, 0x0, 0x40, 0x13, 0x70, 0x7, 0x12, 0x0,
-    0x7, 0x80, 0x2c, 0x40, 0xf, 0xc3, 0xbc, 0x1,
-    0x21, 0x80, 0x7c, 0x7b, 0xc4, 0x0, 0x7b, 0x0,
-    0xf0, 0xc4, 0xe9, 0x0, 0x5a, 0xe0, 0x1b, 0xc2,
-    0xb2, 0x84, 0x2,
+    0x7f, 0x84, 0x11, 0x8, 0x11, 0x30, 0x11, 0x0,
+    0x11, 0x0, 0x11, 0x4, 0x7f, 0x88, 0x11, 0x30,
+    0x11, 0x0, 0x1, 0x2, 0x21, 0x4, 0x21, 0x8,
+    0x1, 0x30, 0x40, 0x40,
 
     /* U+5F80 "往" */
-    0x0, 0x8a, 0x80, 0x29, 0x81, 0x0, 0xf8, 0x66,
-    0xc0, 0x29, 0xcd, 0x40, 0xe, 0x3d, 0x91, 0x0,
-    0xc9, 0xa6, 0x1, 0xd1, 0xa4, 0xe9, 0x57, 0x6c,
-    0xfc, 0xbb, 0x38, 0x2, 0xc4, 0xf5, 0x2a, 0xed,
-    0xab, 0x77, 0x38, 0x4, 0x5d, 0x60, 0x1f, 0xfc,
-    0x2, 0xe0, 0x10, 0xf, 0xf8, 0xfb, 0x44, 0x3,
-    0x8c, 0x3, 0xc7, 0x82, 0x1, 0x3d, 0xda, 0x56,
-    0xee, 0x30, 0xf, 0x9e, 0xed, 0x4b, 0x77, 0x18,
-    0x7, 0xff, 0xa1, 0x82, 0x6e, 0xed, 0x5b, 0xbc,
-    0x20,
+    0x8, 0xc0, 0x10, 0x20, 0x20, 0x0, 0x43, 0xfc,
+    0x8, 0x20, 0x10, 0x20, 0x30, 0x20, 0x50, 0x20,
+    0x11, 0xfc, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20,
+    0x10, 0x20, 0x17, 0xfe,
 
     /* U+5F88 "很" */
-    0x0, 0x8a, 0x80, 0x19, 0x77, 0xd8, 0x1, 0x86,
-    0x6c, 0x0, 0xf7, 0x7c, 0xe2, 0x0, 0x3d, 0x90,
-    0x20, 0xf, 0xfa, 0x74, 0xa8, 0x0, 0xb7, 0x7c,
-    0xa0, 0x15, 0xc, 0xf1, 0x2, 0xdd, 0xf2, 0x80,
-    0x68, 0x75, 0x0, 0xff, 0xe0, 0x48, 0x10, 0x4,
-    0xb5, 0x5c, 0xe2, 0x7, 0xf0, 0x1, 0x96, 0xec,
-    0x57, 0x6c, 0x0, 0x1b, 0x0, 0x78, 0x44, 0x2,
-    0x25, 0xb0, 0xf, 0xfa, 0xe2, 0xb2, 0xc0, 0x3f,
-    0xe3, 0x2d, 0x90, 0xf, 0xfe, 0xd, 0xd8, 0x80,
-    0x3f, 0x23, 0x4d, 0xd9, 0x7b, 0x88, 0x1, 0x98,
-    0x17, 0x22, 0xee, 0x42, 0xde, 0x20,
+    0x9, 0xfc, 0x11, 0x4, 0x21, 0x4, 0x49, 0xfc,
+    0x11, 0x4, 0x31, 0x4, 0x71, 0xfc, 0x11, 0x20,
+    0x11, 0x22, 0x11, 0x1c, 0x11, 0x10, 0x11, 0x8,
+    0x11, 0xe4, 0x12, 0x2,
 
     /* U+5F97 "得" */
-    0x0, 0x8e, 0x0, 0xee, 0xab, 0xb0, 0x3, 0x14,
-    0x40, 0x17, 0xaa, 0xb9, 0xc0, 0x24, 0x9a, 0x0,
-    0xa6, 0xab, 0x94, 0x2, 0xcb, 0x18, 0x0, 0x4d,
-    0x57, 0x28, 0x5, 0x1, 0x1c, 0x5, 0xd3, 0x3c,
-    0xe0, 0x19, 0x54, 0xc0, 0x97, 0x11, 0xd8, 0x1,
-    0x37, 0x88, 0x24, 0xca, 0x23, 0xa6, 0x0, 0xf2,
-    0x80, 0x9, 0x11, 0xd6, 0x51, 0x0, 0x3a, 0x0,
-    0xc2, 0x3c, 0x60, 0x20, 0x1f, 0x45, 0xdf, 0x52,
-    0xdd, 0x84, 0x3, 0xa2, 0xce, 0xee, 0xa5, 0xbb,
-    0x8, 0x7, 0xdb, 0x20, 0x1f, 0xfc, 0x25, 0xf1,
-    0x0, 0xfe, 0x60, 0xc, 0xc7, 0x54, 0x30, 0xf,
-    0x50, 0x7, 0x15, 0x5c, 0x0, 0x40,
+    0x9, 0xfc, 0x10, 0x4, 0x21, 0xfc, 0x48, 0x4,
+    0x11, 0xfc, 0x10, 0x0, 0x33, 0xfe, 0x50, 0x8,
+    0x10, 0x8, 0x17, 0xfe, 0x11, 0x8, 0x10, 0x88,
+    0x10, 0x8, 0x10, 0x38, 0x0, 0x0,
 
     /* U+5FC3 "心" */
-    0x0, 0xe6, 0xb5, 0x0, 0xff, 0xe0, 0xb5, 0x16,
-    0x30, 0x7, 0xff, 0x0, 0x5f, 0x7, 0x0, 0x3f,
-    0xf8, 0x4f, 0x80, 0x1f, 0xe8, 0x0, 0xff, 0xe0,
-    0x18, 0x1, 0x0, 0x3d, 0x0, 0x1d, 0x2, 0x1,
-    0xfb, 0xd4, 0x3, 0x38, 0x80, 0x7e, 0x79, 0x0,
-    0x85, 0x80, 0x3f, 0xd3, 0x0, 0x7, 0xc0, 0xf,
-    0xf2, 0xa0, 0x2, 0x98, 0x3, 0xf1, 0xb8, 0x5a,
-    0x94, 0x80, 0x7f, 0x38, 0x1, 0x90, 0x94, 0x3,
-    0xf8, 0xcc, 0x2, 0x20, 0xe, 0x5b, 0xbe, 0xd4,
-    0x0, 0x80,
+    0x2, 0x0, 0x0, 0x80, 0x0, 0x20, 0x0, 0x0,
+    0x4, 0x0, 0x4, 0x8, 0x24, 0x0, 0x24, 0x4,
+    0x24, 0x2, 0x4, 0x2, 0x44, 0x0, 0x4, 0x0,
+    0x4, 0x0, 0x7, 0xf0,
 
     /* U+5FC5 "必" */
-    0x0, 0xe8, 0x70, 0xf, 0xfe, 0x14, 0x5, 0x88,
-    0x4, 0xec, 0x1, 0xf9, 0xff, 0x4c, 0xa, 0xd8,
-    0x3, 0xe1, 0x4, 0xd1, 0x9, 0xf0, 0xf, 0xda,
-    0x0, 0x12, 0x7c, 0x30, 0xe, 0x91, 0x0, 0xe4,
-    0xd7, 0x81, 0x0, 0xc4, 0x20, 0x18, 0xe2, 0xc2,
-    0xe0, 0x2, 0x22, 0x0, 0x63, 0xfd, 0x10, 0x33,
-    0x80, 0x15, 0xa0, 0x12, 0x7e, 0x88, 0x5, 0x10,
-    0x1, 0x44, 0x0, 0xb, 0xb0, 0x40, 0x31, 0x1,
-    0xe, 0x80, 0xd8, 0x50, 0x6, 0x26, 0x9, 0x0,
-    0xb, 0xd4, 0x90, 0x7, 0x37, 0x1, 0x10, 0x2c,
-    0xac, 0x80, 0x3c, 0x7a, 0x1, 0xad, 0x40, 0x17,
-    0x99, 0xe5, 0x0, 0x80,
+    0x4, 0x0, 0x1, 0x0, 0x0, 0x88, 0x0, 0x10,
+    0x4, 0x0, 0x24, 0x28, 0x24, 0x44, 0x24, 0x84,
+    0x45, 0x2, 0x46, 0x2, 0xc, 0x0, 0x14, 0x8,
+    0x44, 0x0, 0x3, 0xf0,
 
     /* U+5FD7 "志" */
-    0x0, 0xf9, 0x94, 0x3, 0xff, 0x99, 0x57, 0x7e,
-    0x8b, 0xbf, 0x0, 0x2a, 0xef, 0xd1, 0x77, 0xe0,
-    0xf, 0xfe, 0xbd, 0x5d, 0xea, 0x9b, 0xbe, 0x0,
-    0xd5, 0x77, 0x67, 0x65, 0xdf, 0x0, 0x7e, 0x69,
-    0x70, 0xf, 0xf8, 0x60, 0x6f, 0xd0, 0x6, 0x80,
-    0x39, 0x54, 0x64, 0x0, 0x84, 0x1, 0xf9, 0x0,
-    0xde, 0x80, 0x1f, 0x32, 0x8b, 0x0, 0x10, 0xc4,
-    0x3, 0xed, 0x8, 0xa0, 0x7, 0xc0, 0x13, 0x5d,
-    0xec, 0xe0, 0x6, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x1, 0x0, 0x4, 0x88, 0x4, 0x4, 0x24, 0x4,
+    0x24, 0x12, 0x47, 0xe0,
 
     /* U+5FD9 "忙" */
-    0x0, 0xa8, 0x3, 0xd4, 0x1, 0xf9, 0x80, 0x3c,
-    0xc0, 0x1e, 0x10, 0x2, 0x8, 0x7, 0xfd, 0x60,
-    0x6, 0xbb, 0x76, 0x60, 0x33, 0x2b, 0x0, 0xe2,
-    0xb, 0x5d, 0xcc, 0xeb, 0x0, 0xf5, 0x80, 0x7f,
-    0x93, 0xc0, 0x21, 0x0, 0xff, 0x22, 0x80, 0x7f,
-    0xfe, 0x44, 0x3, 0xff, 0x86, 0x6a, 0x1, 0xfe,
-    0x60, 0xa, 0xfa, 0xef, 0x9c, 0x0,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x57, 0xfe,
+    0x55, 0x0, 0x51, 0x0, 0x11, 0x0, 0x11, 0x0,
+    0x11, 0x0, 0x11, 0x0, 0x11, 0x0, 0x11, 0x0,
+    0x11, 0x0, 0x10, 0xfc,
 
     /* U+5FEB "快" */
-    0x0, 0xa8, 0x3, 0x9c, 0xc0, 0x3f, 0x30, 0x7,
-    0x7b, 0x80, 0x78, 0x40, 0xc, 0x11, 0x76, 0x58,
-    0xbb, 0x30, 0x5, 0x2, 0x2, 0x91, 0x76, 0x58,
-    0xbb, 0x50, 0x4, 0x62, 0xd, 0xc0, 0x1f, 0xfc,
-    0x21, 0xb0, 0xf, 0xf1, 0x60, 0x4, 0x20, 0x19,
-    0xc0, 0x38, 0x98, 0x2, 0x7b, 0xb9, 0xba, 0xec,
-    0x36, 0x80, 0x1c, 0xf7, 0x71, 0xd, 0xdb, 0x6d,
-    0x0, 0x3f, 0x1a, 0xda, 0x80, 0x7f, 0xf0, 0x22,
-    0xde, 0x44, 0x3, 0xfd, 0x18, 0x41, 0x14, 0x1,
-    0xfd, 0x20, 0xe0, 0x4, 0xec, 0x20, 0xc, 0xc1,
-    0x59, 0x0, 0x19, 0x7f, 0x84,
+    0x10, 0x0, 0x10, 0x40, 0x13, 0xf8, 0x50, 0x44,
+    0x54, 0x44, 0x50, 0x44, 0x10, 0x44, 0x13, 0xfe,
+    0x10, 0x60, 0x10, 0x40, 0x10, 0x90, 0x11, 0x8,
+    0x13, 0x4, 0x14, 0x2,
 
     /* U+5FFD "忽" */
-    0x0, 0xc6, 0x1, 0xff, 0xc1, 0x75, 0x0, 0xff,
-    0xe0, 0x14, 0x6d, 0xdf, 0xcc, 0x1, 0xa7, 0xaf,
-    0x36, 0xe8, 0x2e, 0xd4, 0x1, 0x5c, 0x9, 0x63,
-    0x4, 0x78, 0x1, 0xc0, 0x15, 0xe6, 0x1d, 0x20,
-    0x66, 0x40, 0x21, 0x0, 0x52, 0x5, 0xc1, 0xf,
-    0xd8, 0x1, 0x88, 0x2, 0x2c, 0xf4, 0x1a, 0xf1,
-    0x0, 0x16, 0x80, 0x49, 0xc8, 0x7b, 0x6, 0x1,
-    0x6b, 0x80, 0x4c, 0x41, 0x3e, 0x20, 0xa, 0xa6,
-    0x90, 0x7, 0xa4, 0xae, 0x42, 0xac, 0x80, 0x39,
-    0x43, 0xc6, 0x69, 0x40, 0x75, 0x80, 0x27, 0x0,
-    0xe3, 0x50, 0x49, 0xc5, 0x2, 0xc5, 0x0, 0xfa,
-    0x2, 0xa4, 0x26, 0x40, 0x7, 0xbc, 0xcd, 0x60,
-    0xd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc1, 0x2, 0x44,
+    0x48, 0x91, 0x11, 0x4, 0x42, 0x11, 0x0, 0x4,
+    0x10, 0x10, 0xc0, 0xc, 0x0, 0x40, 0x80, 0x80,
+    0x89, 0x4, 0xa3, 0xf0, 0x0,
 
     /* U+600E "怎" */
-    0x0, 0xc2, 0x60, 0x1f, 0xfc, 0x28, 0x0, 0xff,
-    0xe1, 0xb, 0x4d, 0x57, 0xe6, 0x0, 0xd7, 0x79,
-    0xae, 0xfc, 0xc0, 0x12, 0x9a, 0x8, 0x80, 0x47,
-    0xc0, 0x11, 0xcc, 0x80, 0x22, 0xaa, 0xe9, 0x0,
-    0xaf, 0x40, 0x31, 0x55, 0x74, 0x80, 0x50, 0x20,
-    0x18, 0xae, 0xfc, 0x60, 0x1f, 0x8a, 0xef, 0xc6,
-    0x1, 0xf2, 0x20, 0x3, 0xfe, 0x10, 0x55, 0xd,
-    0x80, 0x5, 0xc0, 0x39, 0x5c, 0x24, 0x67, 0x90,
-    0x7, 0xdc, 0x3, 0x73, 0x80, 0x65, 0x40, 0x48,
-    0xd5, 0x0, 0x46, 0x88, 0x7, 0xde, 0x15, 0x20,
-    0xd, 0x60, 0x3, 0xdd, 0xec, 0xc0, 0x3, 0x40,
+    0x0, 0x0, 0x8, 0x0, 0xf, 0xfc, 0x11, 0x0,
+    0x11, 0x0, 0x21, 0xfc, 0x41, 0x0, 0x1, 0xfc,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x80, 0x4, 0x8,
+    0x24, 0x4, 0x44, 0x12, 0x7, 0xe0,
 
     /* U+6015 "怕" */
-    0x0, 0xa8, 0x3, 0xd6, 0x1, 0xf0, 0x80, 0x70,
-    0x80, 0x78, 0x84, 0x18, 0xc1, 0xaa, 0x8f, 0x54,
-    0x94, 0xa, 0x30, 0x79, 0xa, 0x89, 0xe8, 0x85,
-    0xc0, 0x11, 0x0, 0x40, 0x22, 0x2f, 0x0, 0x4,
-    0x2, 0xa0, 0xf, 0xf6, 0x80, 0x7f, 0xf0, 0x98,
-    0x3, 0x8e, 0xef, 0xc0, 0x1f, 0x8e, 0xef, 0xc0,
-    0x1f, 0xfe, 0x92, 0xbb, 0xf0, 0x6, 0x10, 0x9,
-    0x6a, 0xbc, 0xa0,
+    0x10, 0x20, 0x20, 0x40, 0x43, 0xf2, 0xa8, 0x15,
+    0x50, 0x2a, 0x20, 0x44, 0x40, 0x88, 0xff, 0x11,
+    0x2, 0x22, 0x4, 0x44, 0x8, 0x88, 0x11, 0x1f,
+    0xe2, 0x20, 0x40,
 
     /* U+601D "思" */
-    0x8, 0xbb, 0xdd, 0x77, 0xb0, 0x80, 0x9, 0x77,
-    0x8a, 0xef, 0x53, 0x80, 0x7f, 0xf1, 0x6e, 0xf1,
-    0x5d, 0xf0, 0x6, 0xbb, 0xc5, 0x77, 0xc0, 0x1f,
-    0xfc, 0x57, 0x22, 0xc0, 0x45, 0xb8, 0x2, 0x8b,
-    0xbc, 0xb7, 0x78, 0x14, 0x0, 0x73, 0x30, 0x5c,
-    0xce, 0x80, 0x9, 0x9, 0xc2, 0x22, 0x0, 0xa0,
-    0x2, 0xf2, 0xc0, 0x1a, 0xe5, 0x0, 0x73, 0x81,
-    0x8, 0x7, 0x32, 0x83, 0xb6, 0x14, 0xc0, 0x7,
-    0xc3, 0xa1, 0xf1, 0x24, 0x19, 0x8b, 0xbd, 0xbc,
-    0x9, 0x0,
+    0x7f, 0xf1, 0x8, 0x4, 0x20, 0x1f, 0xfc, 0x42,
+    0x1, 0x8, 0x4, 0x21, 0xf, 0xfc, 0x4, 0x0,
+    0xc, 0x45, 0x0, 0x14, 0x2, 0x90, 0x24, 0x3f,
+    0x0,
 
     /* U+6025 "急" */
-    0x0, 0x86, 0x80, 0x3f, 0xf8, 0x34, 0x15, 0x55,
-    0xe8, 0x7, 0xd1, 0xa, 0xac, 0x3c, 0x1, 0xe9,
-    0x58, 0xbb, 0xb1, 0x22, 0xe4, 0x2, 0x8b, 0xdb,
-    0xbd, 0x9d, 0x76, 0x13, 0x0, 0x41, 0x0, 0x7f,
-    0xf0, 0xe6, 0xab, 0xf2, 0x80, 0x74, 0xd5, 0x7e,
-    0x50, 0xc, 0x95, 0x5f, 0xc4, 0x60, 0x12, 0x55,
-    0x58, 0x11, 0x55, 0x80, 0x39, 0xc2, 0x1a, 0x24,
-    0xc0, 0x14, 0x40, 0x13, 0x88, 0x20, 0x15, 0x98,
-    0x25, 0xf1, 0x2, 0x5b, 0x0, 0x78, 0x78, 0x7b,
-    0x80, 0x5a, 0x0, 0x7a, 0xbb, 0xb7, 0x80, 0xbc,
-    0x0,
+    0x8, 0x0, 0x3f, 0x80, 0x82, 0x3, 0xff, 0x88,
+    0x1, 0x0, 0x2, 0xf, 0xfc, 0x0, 0x8, 0x3f,
+    0xf0, 0x4, 0x0, 0x24, 0x40, 0x40, 0x44, 0x82,
+    0x41, 0xf8, 0x0,
 
     /* U+606F "息" */
-    0x0, 0xf8, 0x84, 0x3, 0xff, 0x85, 0x20, 0x1f,
-    0xf4, 0x55, 0x41, 0x75, 0x54, 0x80, 0x79, 0x2a,
-    0xab, 0xaa, 0xca, 0x1, 0xf5, 0x57, 0xe0, 0xf,
-    0xd5, 0x5f, 0x80, 0x3f, 0x55, 0x7e, 0x0, 0xfd,
-    0x55, 0xf8, 0x3, 0xe7, 0x0, 0xff, 0xe1, 0xf5,
-    0x5d, 0xfa, 0xa4, 0x3, 0xcb, 0x57, 0x1, 0x57,
-    0x6a, 0x50, 0xe, 0x12, 0x24, 0x9c, 0xe9, 0x0,
-    0x30, 0x40, 0x34, 0x0, 0x62, 0xe0, 0x0, 0xf6,
-    0x88, 0x0, 0xcc, 0x40, 0x18, 0x8a, 0x82, 0x8a,
-    0x0, 0x45, 0x81, 0x2d, 0xde, 0xed, 0x4, 0xc1,
+    0x0, 0x0, 0x1, 0x0, 0x1f, 0xf8, 0x10, 0x8,
+    0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
+    0x10, 0x8, 0xf, 0xf0, 0x1, 0x0, 0x4, 0x88,
+    0x24, 0x4, 0x24, 0x12, 0x47, 0xe0,
 
     /* U+60A8 "您" */
-    0x0, 0xc4, 0x0, 0x11, 0x0, 0x7f, 0x87, 0x80,
-    0x16, 0x60, 0x1f, 0xeb, 0xf0, 0x35, 0x9b, 0xbe,
-    0xa0, 0x9, 0xd8, 0xc2, 0x3a, 0xec, 0x17, 0x69,
-    0x0, 0x9f, 0x9c, 0x27, 0xc0, 0x40, 0x23, 0xa8,
-    0x1, 0xf9, 0x0, 0x4a, 0x59, 0x80, 0x51, 0x44,
-    0x3, 0x0, 0x19, 0x0, 0x80, 0x29, 0x80, 0xf,
-    0xdf, 0x40, 0x18, 0x8c, 0x80, 0x3e, 0xb0, 0xf,
-    0x49, 0x0, 0x6d, 0x0, 0x86, 0x2b, 0xc0, 0x3f,
-    0x30, 0x18, 0xdf, 0xd2, 0x0, 0x80, 0x70, 0xa0,
-    0x78, 0xd0, 0xb0, 0x2, 0x90, 0x3, 0x30, 0x80,
-    0x66, 0x60, 0x25, 0xc2, 0x0, 0xa, 0xd4, 0x3,
-    0xe8, 0xd, 0x91, 0x9, 0xe0, 0x3, 0xdd, 0xec,
-    0xb0, 0x19, 0x0,
+    0x0, 0x0, 0x9, 0x0, 0x11, 0xfe, 0x12, 0x22,
+    0x34, 0x24, 0x51, 0x28, 0x11, 0x24, 0x12, 0x24,
+    0x10, 0x20, 0x0, 0xc0, 0x1, 0x0, 0x4, 0x8,
+    0x4, 0x4, 0x24, 0x12, 0x47, 0xe0,
 
     /* U+60C5 "情" */
-    0x0, 0x50, 0x7, 0xa4, 0x40, 0x3c, 0x20, 0x8,
-    0xaa, 0x9e, 0xab, 0x20, 0x4, 0x49, 0x15, 0x52,
-    0x4d, 0x54, 0x81, 0x20, 0x5c, 0x95, 0x53, 0xc5,
-    0x52, 0x40, 0x40, 0x2e, 0x4a, 0xa9, 0xe2, 0xa9,
-    0x20, 0xbe, 0x0, 0x7a, 0xac, 0x11, 0x55, 0x49,
-    0xa0, 0x0, 0xea, 0x97, 0x7e, 0xa9, 0x72, 0x0,
-    0x87, 0x22, 0x3e, 0x0, 0xf1, 0x24, 0xcf, 0x41,
-    0x0, 0x7c, 0xb5, 0x5d, 0x60, 0x1f, 0x96, 0xab,
-    0xac, 0x3, 0xf2, 0xd5, 0x75, 0x80, 0x7e, 0x5a,
-    0xae, 0xb0, 0xc, 0x20, 0x1, 0xf0, 0xd, 0x57,
-    0xa0,
+    0x20, 0x40, 0x4f, 0xf8, 0x81, 0x3, 0x5f, 0xe6,
+    0x4, 0x4, 0xff, 0xc8, 0x0, 0x11, 0xfe, 0x22,
+    0x4, 0x47, 0xf8, 0x88, 0x11, 0x1f, 0xe2, 0x20,
+    0x44, 0x3, 0x0,
 
     /* U+60F3 "想" */
-    0x0, 0xd4, 0x1, 0x45, 0xde, 0xc0, 0x0, 0x91,
-    0x18, 0x88, 0x7, 0x77, 0x98, 0x42, 0xbb, 0x87,
-    0xdc, 0x50, 0xf, 0xd7, 0x96, 0x79, 0x85, 0x7a,
-    0xac, 0x80, 0x10, 0xe8, 0xc8, 0x1, 0xea, 0xb2,
-    0x0, 0x57, 0xd, 0x76, 0x27, 0xaa, 0xc8, 0x0,
-    0x8c, 0x20, 0x2a, 0x37, 0xaa, 0xc8, 0x3, 0xcc,
-    0x1, 0x8, 0x80, 0x3e, 0x16, 0x0, 0xf7, 0x55,
-    0x63, 0x10, 0xd, 0x60, 0xa, 0x5a, 0xaa, 0xe4,
-    0x2, 0xb0, 0x36, 0x9, 0xb0, 0x9, 0x60, 0x0,
-    0x64, 0xe, 0x20, 0x70, 0x40, 0x68, 0x42, 0x11,
-    0x0, 0xe, 0x32, 0xf, 0x9, 0x90, 0x50, 0x82,
-    0xdd, 0xf6, 0x50, 0x1c, 0x0,
+    0x8, 0xfc, 0x11, 0x9, 0xfa, 0x10, 0x47, 0xe1,
+    0xc8, 0x45, 0x5f, 0x92, 0x21, 0x4, 0x42, 0x8,
+    0x7c, 0x2, 0x0, 0x82, 0x11, 0x0, 0x24, 0x1,
+    0x20, 0xfc, 0x0,
 
     /* U+610F "意" */
-    0x0, 0xf3, 0x28, 0x7, 0xea, 0xa6, 0x62, 0xb3,
-    0xea, 0xed, 0x54, 0x0, 0xaa, 0x9c, 0xd5, 0x58,
-    0xe2, 0xa8, 0x0, 0x46, 0x62, 0xb, 0x36, 0x45,
-    0x66, 0x28, 0x31, 0x15, 0xe4, 0x5a, 0x8, 0xa6,
-    0x2, 0x43, 0xee, 0xfd, 0xa8, 0x60, 0x16, 0x55,
-    0x7e, 0x20, 0xe, 0x6a, 0xaf, 0xca, 0x1, 0xcd,
-    0x55, 0xf9, 0x40, 0x3b, 0xaa, 0x97, 0x6a, 0xad,
-    0x80, 0x1c, 0xb5, 0x32, 0xc, 0xaa, 0x8c, 0x3,
-    0x14, 0xc, 0x95, 0x89, 0x80, 0xf3, 0x0, 0x53,
-    0x20, 0xc, 0xe6, 0xaf, 0x58, 0xa1, 0x50, 0x22,
-    0x6b, 0xbd, 0x28, 0x15, 0xc0,
+    0x0, 0x0, 0xff, 0xf0, 0x21, 0x0, 0x42, 0x0,
+    0x0, 0x3, 0xfe, 0x8, 0x4, 0x1f, 0xf8, 0x20,
+    0x10, 0x3f, 0xc0, 0x8, 0x1, 0x40, 0x84, 0x80,
+    0x91, 0xf8, 0x80,
 
     /* U+611F "感" */
-    0x0, 0xfc, 0x72, 0x11, 0x22, 0x1, 0x96, 0xab,
-    0xa1, 0xe8, 0x93, 0x24, 0x2, 0xea, 0xae, 0xb2,
-    0xaa, 0x6e, 0xa4, 0x3, 0x15, 0x56, 0x45, 0x30,
-    0x80, 0xf, 0x15, 0x56, 0x4c, 0x41, 0x20, 0xf,
-    0xa2, 0xa9, 0x20, 0xb7, 0x32, 0x0, 0xc2, 0x20,
-    0x2a, 0xa0, 0x4, 0xa6, 0x60, 0xc, 0xf8, 0x1,
-    0x8c, 0x8, 0x8c, 0x0, 0x80, 0x5, 0x38, 0x64,
-    0xcb, 0x4e, 0x6a, 0x2c, 0x4c, 0x6, 0xc4, 0x1a,
-    0x44, 0x41, 0x42, 0xbf, 0x7c, 0x2, 0xe0, 0x40,
-    0xf0, 0x70, 0x1, 0x65, 0x28, 0x4, 0xec, 0x3c,
-    0xb, 0x42, 0x7, 0x96, 0x1, 0x16, 0x20, 0x6,
-    0x10, 0x4, 0x27, 0xd8, 0x2, 0x68, 0x5, 0x6e,
-    0xf6, 0x70, 0x27, 0x0,
+    0x0, 0x58, 0x1f, 0xfe, 0x20, 0x40, 0x2f, 0x48,
+    0x20, 0x8, 0x2f, 0x30, 0x29, 0x30, 0x9, 0x32,
+    0x46, 0x4a, 0x2, 0x4, 0x0, 0x88, 0x4, 0x4,
+    0x24, 0x12, 0x47, 0xe0,
 
     /* U+6162 "慢" */
-    0x0, 0xc, 0x80, 0x6, 0xa6, 0x7a, 0x80, 0x38,
-    0xc0, 0x5, 0x93, 0x3c, 0x20, 0x10, 0x80, 0x18,
-    0x1, 0xb3, 0x3c, 0xc0, 0x15, 0x80, 0x38, 0x44,
-    0x5b, 0xbc, 0xc0, 0x1e, 0xb6, 0x2a, 0x0, 0xea,
-    0x0, 0x8c, 0x0, 0x6b, 0x35, 0x1d, 0xb1, 0xb0,
-    0xe0, 0x98, 0x1, 0x11, 0x25, 0x6a, 0x5a, 0x65,
-    0x80, 0x8a, 0x1, 0xd0, 0x91, 0x7, 0x88, 0x10,
-    0x7, 0xd7, 0x39, 0x32, 0xc9, 0x98, 0x3, 0xc3,
-    0x59, 0x55, 0xde, 0x1, 0xf0, 0xd4, 0x1d, 0xdc,
-    0x34, 0x1, 0xfc, 0xbb, 0x49, 0x52, 0x80, 0x1f,
-    0xc4, 0x46, 0xd1, 0x51, 0x0, 0xe3, 0x8, 0xbb,
-    0x1e, 0x4d, 0x9d, 0xd8, 0x40, 0x3, 0x21, 0x17,
-    0x28, 0x1, 0x2d, 0x58, 0x80,
+    0x11, 0xfc, 0x10, 0x4, 0x11, 0xfc, 0x59, 0x4,
+    0x50, 0x0, 0x53, 0xfc, 0x12, 0x92, 0x13, 0xfe,
+    0x10, 0x0, 0x13, 0xfc, 0x10, 0x88, 0x10, 0x50,
+    0x10, 0x70, 0x17, 0x6, 0x0, 0x0,
 
     /* U+6210 "成" */
-    0x0, 0xfe, 0xb0, 0xa6, 0x0, 0xff, 0x9c, 0x28,
-    0xa8, 0x2, 0x4a, 0xaf, 0x15, 0x53, 0x82, 0x0,
-    0x11, 0x1f, 0x14, 0x46, 0x90, 0x8, 0x8b, 0xce,
-    0x45, 0x84, 0x2, 0x22, 0x80, 0x21, 0x10, 0xd,
-    0x0, 0x6b, 0xbb, 0x0, 0x4, 0x40, 0x6f, 0x0,
-    0xd3, 0x33, 0x8, 0x6a, 0x85, 0xa8, 0x7, 0xf9,
-    0xfd, 0xe8, 0x3, 0xf0, 0x88, 0x9, 0x71, 0x80,
-    0x33, 0x80, 0x4e, 0x0, 0x12, 0xf0, 0x2, 0x2,
-    0x18, 0xdd, 0x90, 0xb, 0x6f, 0x40, 0x1e, 0x1b,
-    0x63, 0x76, 0x85, 0xee, 0x29, 0xa0, 0x0, 0x54,
-    0xc0, 0x23, 0xcc, 0x10, 0x57, 0x6e, 0x87, 0x40,
-    0x31, 0xc8, 0x6, 0xad, 0x60,
+    0x0, 0x50, 0x0, 0x88, 0x7f, 0xf9, 0x2, 0x2,
+    0x4, 0x4, 0x8, 0x8f, 0x90, 0x11, 0x4, 0x22,
+    0x20, 0x44, 0x60, 0x88, 0x81, 0x72, 0x94, 0x9,
+    0x28, 0x21, 0x80, 0x0, 0x0,
 
     /* U+6211 "我" */
-    0x0, 0x85, 0x22, 0x9c, 0x2c, 0x16, 0x0, 0x32,
-    0xcc, 0xb7, 0xa9, 0xc1, 0x81, 0x7e, 0x0, 0x25,
-    0x98, 0xf0, 0xc, 0x20, 0x7, 0x3, 0x0, 0xff,
-    0x38, 0x80, 0x20, 0xc0, 0x15, 0x77, 0xf2, 0xed,
-    0xdd, 0x40, 0xa, 0xbb, 0xfa, 0x65, 0x77, 0x50,
-    0x7, 0xf8, 0x88, 0x0, 0xb0, 0xf, 0xc6, 0xe8,
-    0xfc, 0x11, 0xc0, 0x10, 0xa4, 0x5d, 0x90, 0xd0,
-    0x95, 0x44, 0xa0, 0x15, 0x9e, 0x5d, 0x9d, 0x0,
-    0xf, 0xd4, 0x1, 0xa9, 0xd0, 0x3, 0x95, 0x5a,
-    0x0, 0x31, 0x0, 0xfd, 0x1f, 0xea, 0x0, 0x21,
-    0x0, 0x78, 0xb3, 0xa8, 0x6e, 0x43, 0x48, 0x1,
-    0x37, 0x48, 0x5a, 0xc0, 0x7, 0x1c, 0x31,
+    0x6, 0x48, 0x38, 0x44, 0x0, 0x44, 0x0, 0x40,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x28,
+    0x1c, 0x28, 0x40, 0x30, 0x0, 0x20, 0x0, 0xd0,
+    0x1, 0xa, 0x38, 0xe,
 
     /* U+6216 "或" */
-    0x0, 0xfd, 0x61, 0x10, 0x0, 0xff, 0x9c, 0x22,
-    0xf0, 0x41, 0xf3, 0x3e, 0x3c, 0xc7, 0x84, 0x3,
-    0xe6, 0x7c, 0x79, 0x9a, 0x40, 0x3f, 0x9c, 0x40,
-    0x2, 0x1, 0x4d, 0xdd, 0x8a, 0x4, 0x60, 0xd,
-    0x0, 0x8a, 0xee, 0xfd, 0xe, 0x60, 0x5a, 0x0,
-    0xff, 0x11, 0x84, 0xb0, 0x7, 0xf9, 0xf5, 0xa8,
-    0x3, 0x75, 0xdd, 0x36, 0x4, 0xda, 0xc0, 0x19,
-    0x6e, 0xea, 0x10, 0x12, 0xe0, 0x1, 0x0, 0x5,
-    0x62, 0xf2, 0xcf, 0x6f, 0x80, 0x14, 0x71, 0x65,
-    0x76, 0xce, 0x8d, 0x52, 0x70, 0x22, 0x45, 0x39,
-    0x83, 0xd, 0x88, 0x4f, 0x69, 0x88,
+    0x0, 0xb0, 0x1, 0x11, 0xff, 0xf0, 0x4, 0x0,
+    0x8, 0xf, 0x91, 0x10, 0x80, 0x21, 0x8, 0x42,
+    0x40, 0x78, 0xc0, 0x1, 0x0, 0xf5, 0x2c, 0x12,
+    0x40, 0x3, 0x80,
 
     /* U+6234 "戴" */
-    0x0, 0xea, 0x0, 0xd4, 0xd0, 0x1, 0xd5, 0x52,
-    0x55, 0x24, 0x5, 0xba, 0x0, 0x21, 0xbb, 0x8a,
-    0xed, 0x2, 0xe2, 0xf4, 0x0, 0x19, 0x88, 0x96,
-    0x23, 0x14, 0x42, 0xd8, 0x6, 0x38, 0x47, 0xb2,
-    0x56, 0x66, 0x60, 0x2, 0xc, 0x40, 0xa2, 0x1c,
-    0x1, 0xa8, 0x3, 0x54, 0x41, 0xe2, 0xc, 0x2,
-    0x22, 0x0, 0xce, 0xb9, 0x81, 0xcc, 0x30, 0x69,
-    0x3e, 0x0, 0x47, 0x5a, 0x71, 0xc3, 0x40, 0x4b,
-    0xe8, 0x1, 0x25, 0x2e, 0x6b, 0xfc, 0xa, 0x68,
-    0x90, 0x4, 0x93, 0x71, 0x2b, 0x12, 0x22, 0x6e,
-    0x0, 0x86, 0x65, 0xd5, 0x23, 0x72, 0xa8, 0x42,
-    0x4, 0x3, 0x36, 0x73, 0x22, 0x89, 0x68, 0xc8,
-    0xb, 0x10, 0x38, 0xb0, 0x4, 0xd9, 0x7e, 0x9c,
-    0x61, 0x88,
+    0x4, 0x28, 0x3f, 0xa4, 0x4, 0x20, 0x7f, 0xfc,
+    0x1f, 0x20, 0x4, 0xa4, 0x3f, 0xa4, 0x24, 0x80,
+    0x12, 0x8, 0x3f, 0x98, 0x2, 0x10, 0x7f, 0x90,
+    0x12, 0x2a, 0x21, 0x46,
 
     /* U+623F "房" */
-    0x7, 0xbb, 0xff, 0xe0, 0x28, 0x3d, 0xdf, 0xff,
-    0x1, 0x40, 0x5, 0x33, 0xfe, 0x30, 0xa, 0xb6,
-    0x23, 0xf5, 0xc8, 0x6, 0x71, 0x1f, 0xc6, 0x1,
-    0xd1, 0x55, 0xb2, 0xaa, 0xbc, 0x0, 0x86, 0x2a,
-    0xb0, 0x55, 0x66, 0x0, 0xdf, 0x77, 0x8a, 0xef,
-    0xa4, 0x0, 0x59, 0x76, 0x91, 0xeb, 0xbe, 0x90,
-    0x3, 0x80, 0x48, 0x62, 0x38, 0x3, 0x13, 0x0,
-    0x54, 0x71, 0x1b, 0x8, 0x1, 0x5e, 0x0, 0x57,
-    0xa9, 0x9c, 0xa0, 0x1, 0x45, 0x7, 0x9a, 0x0,
-    0xe5, 0x20, 0x7, 0x15, 0x8e, 0x8, 0x1, 0xea,
-    0x88, 0x0, 0x12, 0x25, 0xb0, 0x6, 0x7a, 0xa4,
-    0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x22,
+    0x0, 0x47, 0xff, 0x8, 0x20, 0x1f, 0xff, 0x21,
+    0x0, 0x42, 0x0, 0x8f, 0xe2, 0x10, 0x44, 0x40,
+    0x82, 0x7, 0x0, 0x0, 0x0,
 
     /* U+6240 "所" */
-    0x9, 0xbb, 0xe8, 0x0, 0x1b, 0x4e, 0x30, 0x2,
-    0x6e, 0xfa, 0x13, 0xa0, 0x6b, 0x18, 0x3, 0xf8,
-    0xa2, 0xdc, 0xc0, 0x3a, 0xae, 0xea, 0x20, 0xf,
-    0xe3, 0x2b, 0xba, 0x54, 0x3, 0xf9, 0xc0, 0x3e,
-    0xbb, 0xb3, 0x6c, 0xc0, 0x3f, 0xa2, 0xed, 0xc9,
-    0x66, 0x0, 0x5b, 0xba, 0xc, 0x44, 0x1, 0xfa,
-    0xae, 0xf2, 0x73, 0x80, 0x7c, 0x22, 0x0, 0xe5,
-    0x30, 0xf, 0x88, 0xc0, 0x30, 0x80, 0x7f, 0x6b,
-    0x80, 0x67, 0xa0, 0xf, 0xcc, 0x40, 0x1a, 0x9c,
-    0x3, 0xe4, 0xa0, 0xc, 0xb4, 0x20, 0x11, 0x88,
-    0x1, 0x18, 0x3, 0x2b, 0x0, 0x61, 0x80, 0x0,
+    0x7f, 0xc, 0x0, 0x60, 0x0, 0x0, 0x3e, 0x0,
+    0x20, 0x0, 0x20, 0x7e, 0x20, 0x4, 0x3e, 0x4,
+    0x0, 0x84, 0x0, 0x84, 0x0, 0x84, 0x40, 0x4,
+    0x41, 0x4, 0x0, 0x4, 0x0, 0x0,
 
     /* U+624B "手" */
-    0x0, 0xff, 0xe3, 0x45, 0x55, 0x37, 0x4c, 0xc5,
-    0x30, 0xe, 0x8a, 0xaa, 0x77, 0x19, 0x8a, 0x60,
-    0x1f, 0xfd, 0x9b, 0xbf, 0xfe, 0x0, 0x80, 0x57,
-    0x7f, 0xfc, 0x1, 0x0, 0xff, 0xe3, 0x4c, 0xfa,
-    0xa9, 0x33, 0xe0, 0x5, 0xdf, 0xc9, 0x77, 0xe0,
-    0x1, 0x17, 0x87, 0x88, 0xbc, 0x1, 0xff, 0xe9,
-    0x6c, 0xbd, 0x40, 0xf, 0x80,
+    0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x0,
 
     /* U+624D "才" */
-    0x0, 0xfd, 0x60, 0x1f, 0xfc, 0x27, 0x0, 0xff,
-    0xe5, 0x4e, 0x67, 0x8f, 0x33, 0xa4, 0x27, 0x33,
-    0xc7, 0x99, 0xd2, 0x1, 0xff, 0x1e, 0x8, 0x7,
-    0xfc, 0xdf, 0xa2, 0x1, 0xfc, 0x37, 0xd8, 0x20,
-    0x1f, 0x8a, 0x4e, 0x60, 0x3, 0xf2, 0x54, 0x51,
-    0x10, 0x3, 0xc9, 0x39, 0x8b, 0xa3, 0x0, 0xfc,
-    0x75, 0x90, 0x20, 0x1f, 0xe7, 0x30, 0xf, 0xfe,
-    0x2d, 0x66, 0x10, 0x3, 0xc0,
+    0x0, 0x80, 0x1, 0x0, 0x2, 0x3, 0xff, 0xf0,
+    0x8, 0x0, 0x11, 0x0, 0x24, 0x0, 0x70, 0x1,
+    0x80, 0xd, 0x0, 0xe2, 0x0, 0x4, 0x0, 0x8,
+    0x0, 0xf0, 0x0,
 
     /* U+6253 "打" */
-    0x0, 0xa0, 0x80, 0x3f, 0xf8, 0x42, 0x20, 0x3c,
-    0xcd, 0xb9, 0x8b, 0x0, 0xf8, 0xf3, 0x30, 0xe6,
-    0x2c, 0x1, 0x76, 0x7f, 0xb6, 0x0, 0xff, 0x5d,
-    0x9f, 0xed, 0x80, 0x3f, 0xfa, 0x42, 0x60, 0x1f,
-    0xf1, 0x13, 0xed, 0xc0, 0x3f, 0x87, 0x20, 0x3e,
-    0x90, 0x3, 0xf8, 0x72, 0x88, 0x3, 0xff, 0xc8,
-    0x20, 0x1f, 0xfc, 0x4, 0xb5, 0x30, 0x9, 0xea,
-    0xc0, 0x3c, 0x97, 0x82, 0x1, 0x3d, 0xd6, 0x0,
-    0x60,
+    0x10, 0x0, 0x11, 0xfe, 0x10, 0x10, 0x7c, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10,
+    0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x30, 0x70, 0x0, 0x0,
 
     /* U+627E "找" */
-    0x0, 0xa8, 0x3, 0xa8, 0x25, 0x0, 0x3c, 0x20,
-    0x1c, 0xc1, 0x3c, 0x80, 0x1f, 0xf3, 0x80, 0x29,
-    0xc0, 0x2b, 0xb2, 0xe5, 0x80, 0x61, 0x24, 0x57,
-    0x0, 0x5d, 0x97, 0x2c, 0xee, 0xcb, 0x54, 0x23,
-    0x40, 0xf, 0x8e, 0xec, 0xd1, 0x6, 0x53, 0x0,
-    0xf1, 0x0, 0x5a, 0xa0, 0xb, 0x0, 0xc6, 0xd9,
-    0x62, 0x0, 0x7f, 0x8, 0xf0, 0x0, 0xe5, 0x86,
-    0x48, 0x80, 0x8, 0x88, 0x48, 0x0, 0x1c, 0x86,
-    0x0, 0xf0, 0xc5, 0x0, 0x7f, 0xf0, 0x9, 0xec,
-    0x3, 0xff, 0x80, 0xd1, 0xf4, 0x0, 0x45, 0x0,
-    0xf2, 0x60, 0xd1, 0x2d, 0x6, 0x38, 0x2d, 0x0,
-    0x6d, 0x70, 0x4, 0x17, 0x19, 0x2, 0xd5, 0x80,
-    0x10, 0x40, 0x34, 0x75, 0x80,
+    0x10, 0x50, 0x10, 0x48, 0x10, 0x40, 0x7c, 0x40,
+    0x11, 0xf0, 0x10, 0x40, 0x10, 0x4, 0x1c, 0x28,
+    0x70, 0x28, 0x10, 0x30, 0x10, 0x20, 0x10, 0x50,
+    0x11, 0x1a, 0x30, 0xe, 0x0, 0x0,
 
     /* U+628A "把" */
-    0x0, 0xa8, 0x0, 0xf9, 0x97, 0xe6, 0x4c, 0x1,
-    0x98, 0x1, 0xba, 0xcc, 0x26, 0x63, 0xb0, 0x3,
-    0xff, 0x8d, 0x56, 0x76, 0x80, 0x1f, 0xf5, 0x59,
-    0xda, 0x0, 0x7f, 0xf6, 0x1c, 0x3, 0xe1, 0x2b,
-    0x70, 0xdb, 0xb3, 0xdd, 0xb8, 0x0, 0x39, 0x47,
-    0x4e, 0x1b, 0x77, 0xdb, 0xa0, 0x1c, 0xb1, 0x10,
-    0x7, 0xe1, 0x70, 0xf, 0xfe, 0x9c, 0x88, 0x7,
-    0x8c, 0xc0, 0x1e, 0x51, 0x5, 0xb4, 0x0, 0x54,
-    0xdd, 0xfc, 0x0,
+    0x11, 0xfc, 0x12, 0x22, 0x12, 0x22, 0x7a, 0x22,
+    0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x1b, 0xfe,
+    0x72, 0x0, 0x12, 0x0, 0x12, 0x0, 0x12, 0x2,
+    0x12, 0x2, 0x31, 0xfc,
 
     /* U+62C9 "拉" */
-    0x0, 0xa8, 0x3, 0xd4, 0x1, 0xf8, 0x40, 0x3c,
-    0xc0, 0x1f, 0xfc, 0xab, 0xb2, 0x65, 0xa5, 0xdc,
-    0xf7, 0x75, 0x0, 0x2e, 0xc9, 0x96, 0x97, 0x57,
-    0x7d, 0x40, 0x1f, 0x8d, 0x80, 0x24, 0x50, 0xf,
-    0xe3, 0xd0, 0xb, 0x4, 0x3, 0xcb, 0x22, 0x2,
-    0x1, 0x12, 0x80, 0x4f, 0x68, 0x10, 0x20, 0x44,
-    0x0, 0x8, 0x80, 0x2, 0x54, 0x8a, 0x20, 0xe,
-    0x70, 0xf, 0xa, 0x88, 0x7, 0x11, 0x0, 0xcc,
-    0x1, 0xff, 0x38, 0x82, 0xe8, 0x7, 0xfc, 0x4c,
-    0x18, 0x80, 0x19, 0x6c, 0x0, 0x77, 0x7c, 0x95,
-    0x76, 0x20,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x7d, 0xfe,
+    0x10, 0x0, 0x10, 0x0, 0x10, 0x88, 0x14, 0x88,
+    0x30, 0x88, 0x10, 0x8, 0x10, 0x8, 0x10, 0x0,
+    0x10, 0x10, 0x33, 0xfe,
 
     /* U+62FF "拿" */
-    0x0, 0xf2, 0x44, 0xc, 0x3, 0xfc, 0x70, 0x31,
-    0x6, 0x83, 0x0, 0xe1, 0x79, 0xae, 0x36, 0x61,
-    0xf5, 0x52, 0xc, 0x1, 0x29, 0x32, 0x44, 0xf4,
-    0x55, 0x14, 0x1, 0x7, 0x13, 0x77, 0xf4, 0x13,
-    0x0, 0x63, 0x99, 0xfa, 0x8c, 0x3, 0xdd, 0x33,
-    0xfb, 0x80, 0x38, 0x87, 0x31, 0xfe, 0xe1, 0x0,
-    0x68, 0x7, 0x8, 0xe5, 0xe1, 0x89, 0x94, 0x0,
-    0x75, 0x7f, 0x72, 0x52, 0xab, 0xa4, 0x3, 0x4d,
-    0x57, 0xfa, 0x40, 0x3, 0x35, 0x5f, 0xfc, 0x9,
-    0x11, 0x4d, 0x57, 0xff, 0x2, 0x44, 0x3, 0x9e,
-    0x75, 0x40, 0x3e,
+    0x1, 0x80, 0x4, 0x20, 0x18, 0x1c, 0x40, 0x0,
+    0x1f, 0xf8, 0x10, 0x8, 0xf, 0xf0, 0x0, 0x78,
+    0x1, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x3, 0x0,
 
     /* U+6307 "指" */
-    0x0, 0xa8, 0x2, 0x90, 0xf, 0xf9, 0x80, 0x25,
-    0x0, 0x24, 0x5c, 0x0, 0x7f, 0xd, 0x50, 0xaa,
-    0xe0, 0x0, 0x37, 0x63, 0xb9, 0x1, 0xaa, 0x31,
-    0x0, 0x20, 0x45, 0x76, 0x3b, 0x90, 0xf, 0xc8,
-    0x20, 0x1f, 0x55, 0xdf, 0xa8, 0x3, 0xc6, 0xd,
-    0x77, 0xe6, 0x0, 0x90, 0xb2, 0xc1, 0xaa, 0xef,
-    0x52, 0x81, 0x66, 0xf, 0x20, 0x36, 0xae, 0xf5,
-    0x70, 0x16, 0x40, 0x80, 0x7f, 0xf1, 0xda, 0xab,
-    0xc0, 0x1f, 0xcd, 0x55, 0xe0, 0xe, 0x70, 0xc,
-    0x23, 0xe0, 0x9, 0xa8, 0x40, 0x35, 0xdf, 0x41,
-    0x0,
+    0x11, 0x0, 0x11, 0x1c, 0x11, 0xc0, 0x7d, 0x2,
+    0x11, 0x2, 0x10, 0xfc, 0x10, 0x0, 0x1c, 0xfc,
+    0x71, 0x2, 0x11, 0x2, 0x11, 0xfe, 0x11, 0x2,
+    0x11, 0x2, 0x31, 0xfe,
 
     /* U+6389 "掉" */
-    0x0, 0xc, 0x80, 0x7a, 0x80, 0x3f, 0x18, 0x7,
-    0x92, 0xee, 0xa0, 0x1, 0x10, 0x48, 0x3, 0x96,
-    0xee, 0xa0, 0x5, 0x51, 0xa9, 0x11, 0x55, 0x2d,
-    0x51, 0x80, 0x28, 0x83, 0xc2, 0x7d, 0xd5, 0x3a,
-    0xaa, 0x0, 0xfc, 0xe2, 0x1, 0xff, 0xc1, 0x10,
-    0xaa, 0xf1, 0x0, 0x64, 0x45, 0xa8, 0x55, 0x78,
-    0x80, 0x3, 0x7a, 0x96, 0x88, 0xaa, 0xf3, 0x80,
-    0x6, 0xe4, 0x2, 0x8a, 0xa9, 0xaa, 0x96, 0x1,
-    0xf0, 0x91, 0x60, 0x22, 0x84, 0x3, 0xcd, 0x77,
-    0x8a, 0xee, 0x81, 0x0, 0xe7, 0x99, 0xc5, 0x33,
-    0x84, 0x2a, 0x9a, 0x1, 0xe7, 0x0, 0xf5, 0x5b,
-    0x80, 0x7a, 0xc0, 0x38,
+    0x10, 0x20, 0x10, 0x3e, 0x10, 0x20, 0x79, 0xf8,
+    0x12, 0x4, 0x12, 0x4, 0x13, 0xfc, 0x1a, 0x4,
+    0x73, 0xfc, 0x10, 0x20, 0x10, 0x20, 0x13, 0xfe,
+    0x10, 0x20, 0x60, 0x20, 0x0, 0x0,
 
     /* U+63A5 "接" */
-    0x0, 0xa8, 0x3, 0xd4, 0x1, 0xf8, 0x40, 0xa,
-    0xb9, 0xd5, 0x64, 0x0, 0xf9, 0x8f, 0x46, 0x47,
-    0x85, 0x80, 0x6e, 0xc9, 0x6a, 0x6e, 0x48, 0x93,
-    0xa1, 0x0, 0xdd, 0x92, 0xd4, 0x4, 0x40, 0x5,
-    0xa0, 0xf, 0xcd, 0x76, 0x6b, 0xb4, 0xed, 0xd8,
-    0x80, 0x39, 0xae, 0xd8, 0xf7, 0x97, 0x71, 0x0,
-    0x5, 0xad, 0x80, 0xf, 0x40, 0x1e, 0x2b, 0xa0,
-    0xb3, 0xbb, 0x4e, 0xdd, 0xbb, 0x2c, 0x4a, 0xad,
-    0x81, 0x6f, 0x66, 0xee, 0x2c, 0xb1, 0x1, 0x0,
-    0xe8, 0x20, 0x3, 0xd8, 0x7, 0xf0, 0xd0, 0xcc,
-    0xad, 0xc0, 0x3f, 0x85, 0x4c, 0xb9, 0x2d, 0x40,
-    0x26, 0xb2, 0x7, 0xb8, 0x3b, 0x78, 0xbd, 0x60,
+    0x10, 0x20, 0x10, 0x20, 0x10, 0x88, 0x78, 0x88,
+    0x10, 0x80, 0x13, 0xfe, 0x10, 0x40, 0x18, 0x0,
+    0x73, 0xfe, 0x10, 0x8, 0x11, 0x0, 0x10, 0x70,
+    0x10, 0x58, 0x33, 0x4,
 
     /* U+63D0 "提" */
-    0x0, 0xc, 0x80, 0x1e, 0xab, 0xe0, 0xf, 0xdb,
-    0x75, 0x5c, 0x20, 0x18, 0xc0, 0x35, 0xd5, 0x72,
-    0x80, 0x6, 0x61, 0x28, 0xc2, 0xea, 0xb9, 0x40,
-    0x3, 0x36, 0x94, 0x7b, 0x75, 0x5c, 0x1, 0xfc,
-    0xf5, 0x5e, 0xb0, 0xf, 0x11, 0x26, 0x7f, 0x40,
-    0x0, 0xa5, 0xe0, 0x22, 0xee, 0x2b, 0xba, 0x40,
-    0xa7, 0xde, 0x88, 0x50, 0x88, 0x4, 0x50, 0x81,
-    0x5b, 0x0, 0x45, 0xe0, 0x5, 0xaa, 0x84, 0x3,
-    0xe4, 0x0, 0x96, 0xaa, 0x10, 0xf, 0x84, 0x88,
-    0x1, 0xff, 0xc0, 0x54, 0x8f, 0x40, 0xf, 0xa2,
-    0xbc, 0x48, 0xcd, 0xfa, 0xf7, 0x75, 0x10,
+    0x11, 0xfc, 0x12, 0x4, 0x13, 0xfc, 0x7a, 0x4,
+    0x11, 0xfc, 0x10, 0x0, 0x13, 0xfe, 0x38, 0x20,
+    0x50, 0x20, 0x11, 0x3c, 0x11, 0x20, 0x11, 0x20,
+    0x10, 0xa0, 0x60, 0x7e,
 
     /* U+6536 "收" */
-    0x0, 0xea, 0x0, 0xac, 0x3, 0xf0, 0x80, 0x18,
-    0x0, 0x22, 0x0, 0xfd, 0x40, 0x1c, 0xd8, 0x23,
-    0xc0, 0x13, 0x80, 0x75, 0xe5, 0xdd, 0x9a, 0x40,
-    0x1f, 0x21, 0xdd, 0x54, 0xfc, 0x40, 0x1f, 0x44,
-    0x1c, 0x2, 0x62, 0x0, 0xf9, 0xed, 0xf0, 0x0,
-    0x96, 0x1, 0xf9, 0xdc, 0x0, 0x20, 0xf6, 0x0,
-    0xff, 0xa6, 0xcc, 0x84, 0x3, 0xb, 0xd9, 0x0,
-    0x46, 0x6f, 0x80, 0xd, 0x6a, 0x96, 0x40, 0x18,
-    0x40, 0x40, 0x35, 0xc1, 0x80, 0x75, 0xf4, 0x50,
-    0x7, 0xf9, 0x73, 0xd5, 0x3e, 0xc8, 0x3, 0xcc,
-    0xb9, 0xa8, 0x0, 0x59, 0x91, 0x0,
+    0x4, 0x40, 0x4, 0x40, 0x24, 0x0, 0x24, 0xfe,
+    0x24, 0x84, 0x25, 0x4, 0x24, 0x40, 0x24, 0x48,
+    0x24, 0x28, 0x2c, 0x30, 0x64, 0x30, 0x4, 0x48,
+    0x4, 0x84, 0x5, 0x2,
 
     /* U+6539 "改" */
-    0x0, 0xfd, 0x6, 0x1, 0xcf, 0x77, 0x90, 0x0,
-    0x86, 0x1, 0xcf, 0x77, 0x4e, 0x81, 0x38, 0x8f,
-    0x0, 0x7e, 0xa0, 0xbb, 0xbe, 0x90, 0x3, 0xc2,
-    0xdb, 0x55, 0x15, 0xa2, 0xdd, 0xdc, 0x17, 0x58,
-    0x1, 0x38, 0x3, 0xae, 0xed, 0xfd, 0x40, 0x9,
-    0x70, 0x3, 0xc2, 0xce, 0x1e, 0xc1, 0xcc, 0x1,
-    0xfe, 0x5a, 0x31, 0x10, 0x7, 0xca, 0x1, 0x5e,
-    0xc0, 0x7, 0xef, 0x10, 0x7, 0x80, 0x76, 0x62,
-    0xee, 0x1, 0x9, 0xc, 0xe1, 0x0, 0x3e, 0x5d,
-    0xd4, 0x79, 0xf0, 0x5f, 0xa6, 0x1, 0xe9, 0x96,
-    0xb0, 0x0, 0xf6, 0x10, 0x3, 0xa6, 0x84, 0x3,
-    0xd, 0xa0,
+    0x0, 0x80, 0xf1, 0x0, 0x12, 0x0, 0x2f, 0xe0,
+    0x50, 0x8f, 0xd1, 0x20, 0x20, 0x40, 0x8, 0x80,
+    0x51, 0x0, 0x42, 0x11, 0x83, 0xe6, 0x80, 0x10,
+    0x80, 0xc0, 0x80, 0x0, 0x0,
 
     /* U+653E "放" */
-    0x0, 0xd4, 0x1, 0x91, 0xc0, 0x3f, 0x8, 0x80,
-    0x36, 0x18, 0x7, 0xb, 0x3b, 0x31, 0xdc, 0xa0,
-    0x8c, 0x23, 0x80, 0x48, 0x72, 0x4c, 0xcc, 0x44,
-    0x8b, 0xb7, 0xd1, 0x2, 0x20, 0x91, 0x23, 0xa5,
-    0xaa, 0x8a, 0xc8, 0x2, 0x7b, 0xb4, 0xa, 0x8,
-    0x0, 0x5c, 0x3, 0x9e, 0xec, 0x8d, 0x18, 0x80,
-    0xfa, 0x1, 0xc2, 0x1, 0x3a, 0x3f, 0x5, 0x38,
-    0x6, 0x6f, 0x0, 0xe1, 0x5, 0x61, 0x0, 0xc4,
-    0x40, 0xf, 0x75, 0x40, 0x7, 0x62, 0x0, 0x7b,
-    0x4, 0x3, 0xc2, 0x20, 0xe, 0x70, 0xfe, 0x10,
-    0xa, 0xbc, 0x0, 0x2c, 0x57, 0xf0, 0x3f, 0xa4,
-    0x4, 0x44, 0x2b, 0xdc, 0xe8, 0x80, 0x0, 0xfa,
-    0x40,
+    0x8, 0x0, 0x8, 0x40, 0x8, 0x40, 0x10, 0x7e,
+    0x10, 0xc4, 0x1e, 0xc4, 0x12, 0x0, 0x12, 0x28,
+    0x2, 0x28, 0x2, 0x10, 0x22, 0x30, 0x22, 0x28,
+    0x42, 0xc4, 0x4d, 0x2,
 
     /* U+653F "政" */
-    0x0, 0xfe, 0x28, 0x0, 0xf5, 0xe6, 0x3b, 0x31,
-    0x62, 0xba, 0x1, 0xeb, 0xcc, 0x3f, 0x65, 0x8d,
-    0xb8, 0x8e, 0x0, 0xfe, 0x21, 0x8b, 0xb7, 0xd8,
-    0x81, 0x18, 0x7, 0x5b, 0x55, 0x45, 0x42, 0xc,
-    0xa0, 0x9, 0x92, 0x90, 0x80, 0x5, 0xc0, 0x3e,
-    0xf8, 0xc8, 0xc4, 0x4, 0xc0, 0xf, 0x98, 0x64,
-    0xdf, 0x83, 0x94, 0x3, 0xfe, 0x10, 0x40, 0x20,
-    0xf, 0xfe, 0x7, 0x5f, 0x80, 0x7e, 0x59, 0xb1,
-    0x2, 0x5, 0x0, 0xdb, 0x78, 0x63, 0x76, 0x14,
-    0xdd, 0x50, 0x4, 0x39, 0xf9, 0x4c, 0x40, 0xff,
-    0x65, 0xf6, 0x20, 0x2a, 0x40, 0x1a, 0x2, 0xc0,
-    0x9, 0x1a, 0x0,
+    0x0, 0x20, 0x7f, 0x0, 0x8, 0x40, 0x8, 0x7e,
+    0x8, 0xc4, 0xe, 0xc4, 0x9, 0x0, 0x8, 0x28,
+    0x8, 0x28, 0x8, 0x10, 0xb, 0x10, 0x78, 0x28,
+    0x0, 0x44, 0x1, 0x2,
 
     /* U+6559 "教" */
-    0x0, 0x8a, 0x0, 0x6, 0xe1, 0x40, 0x1e, 0x3b,
-    0xe6, 0xb7, 0x95, 0x0, 0xfc, 0x77, 0xcf, 0x68,
-    0x64, 0x82, 0xef, 0x84, 0x3, 0xdf, 0x1, 0xd8,
-    0x44, 0xb0, 0x10, 0xab, 0x92, 0xf0, 0xa6, 0x52,
-    0x55, 0x3, 0x80, 0x2a, 0xec, 0x71, 0x97, 0xd1,
-    0xa0, 0x7, 0x0, 0xd1, 0xab, 0xb8, 0xe6, 0xe6,
-    0x6, 0x60, 0x8, 0x8e, 0xf7, 0x99, 0xec, 0x4,
-    0x57, 0x60, 0x0, 0xf4, 0x33, 0x32, 0x80, 0x2e,
-    0x64, 0x30, 0x0, 0xe1, 0x96, 0xfb, 0xcb, 0x2,
-    0x55, 0x0, 0x35, 0xd5, 0x1c, 0x52, 0x18, 0xc,
-    0xc2, 0x1, 0xae, 0xa1, 0x50, 0xc4, 0xb, 0xf3,
-    0x4, 0x1, 0xfe, 0x5e, 0xe1, 0x4f, 0x10, 0x4,
-    0x96, 0xa6, 0xb, 0x98, 0x20, 0x2e, 0xe0, 0x0,
+    0x8, 0x20, 0x3d, 0x20, 0x9, 0x20, 0xa, 0x44,
+    0x7f, 0x44, 0x8, 0xa4, 0x3e, 0xa4, 0x22, 0x28,
+    0x44, 0x8, 0x9, 0x10, 0x78, 0x10, 0x8, 0x28,
+    0x8, 0x44, 0x18, 0x82,
 
     /* U+6562 "敢" */
-    0x8, 0xbb, 0x75, 0xd9, 0xc0, 0xdc, 0x3, 0xd1,
-    0x76, 0x5b, 0xb3, 0x82, 0x18, 0x7, 0xff, 0xa,
-    0xcd, 0x9b, 0x0, 0xde, 0xdb, 0x5e, 0xd8, 0x80,
-    0x80, 0x2c, 0x40, 0x69, 0xef, 0x6d, 0xad, 0x85,
-    0x9a, 0x17, 0x0, 0x84, 0x3, 0xac, 0x44, 0x2,
-    0xe0, 0x19, 0x6a, 0xa6, 0x65, 0xd9, 0x1, 0x30,
-    0x3, 0x25, 0x54, 0xce, 0xe5, 0xf0, 0xf5, 0x0,
-    0xc9, 0x77, 0x30, 0x81, 0x9, 0x9, 0x0, 0x64,
-    0xbb, 0x98, 0x2, 0xfc, 0xf0, 0xf, 0x84, 0xdc,
-    0x3, 0xb, 0x0, 0x43, 0x49, 0x70, 0x80, 0x11,
-    0xc6, 0x70, 0x80, 0x6, 0xfa, 0xe5, 0xdc, 0xd,
-    0xfa, 0x71, 0xa2, 0x1, 0xf0, 0xb7, 0x60, 0x82,
-    0x7e, 0x80,
+    0x7e, 0x0, 0x8, 0x0, 0x8, 0x40, 0x7f, 0x44,
+    0x22, 0x44, 0x22, 0xc4, 0x3e, 0x0, 0x22, 0x28,
+    0x3e, 0x28, 0x22, 0x10, 0x22, 0x10, 0x7a, 0x28,
+    0x2, 0x44, 0x2, 0x82,
 
     /* U+6570 "数" */
-    0x0, 0xff, 0xe2, 0x9b, 0x85, 0x0, 0x18, 0x1,
-    0x60, 0x1e, 0x3c, 0x1, 0x8, 0x20, 0x11, 0x0,
-    0x7d, 0x40, 0x17, 0x20, 0x21, 0x17, 0x0, 0xd5,
-    0xd9, 0x2b, 0x28, 0xfc, 0xae, 0xdf, 0x2, 0x2a,
-    0xa0, 0x88, 0x22, 0x89, 0x7a, 0x64, 0xd6, 0x20,
-    0x9, 0xf5, 0xa8, 0x66, 0x29, 0x80, 0x1c, 0x40,
-    0x17, 0x4a, 0x0, 0xa2, 0xbb, 0x60, 0x12, 0x80,
-    0x56, 0x6b, 0xa0, 0x5, 0xf1, 0x1, 0xad, 0x0,
-    0xd, 0x5d, 0x6d, 0xda, 0x9c, 0x35, 0x91, 0x0,
-    0x1, 0xa3, 0xbb, 0x9e, 0xd0, 0x1a, 0x6c, 0x3,
-    0xb, 0x30, 0x1a, 0xc0, 0x21, 0x1, 0x0, 0xc7,
-    0x76, 0xaa, 0x38, 0x0, 0x77, 0x54, 0x40, 0x11,
-    0x2f, 0x33, 0xc0, 0x1e, 0xf9, 0xf7, 0x4, 0x1,
-    0x56, 0x39, 0x7b, 0x3f, 0xc6, 0x5, 0xda, 0x21,
-    0x56, 0xc0, 0x5, 0x9c, 0x20, 0x8, 0xb0, 0x40,
+    0x0, 0x0, 0x8, 0x20, 0x2a, 0x20, 0x8, 0x20,
+    0x7f, 0x7e, 0x1c, 0x44, 0x2a, 0x44, 0x48, 0xa4,
+    0x0, 0x28, 0x7f, 0x8, 0x22, 0x10, 0x20, 0x10,
+    0x1c, 0x28, 0xe, 0x44, 0x61, 0x82, 0x0, 0x0,
 
     /* U+6574 "整" */
-    0x0, 0xd4, 0x1, 0xd4, 0x1, 0xe8, 0x99, 0x24,
-    0xcc, 0x48, 0xcd, 0xc0, 0xa, 0x0, 0xec, 0x39,
-    0xa5, 0x55, 0x28, 0x1, 0x6e, 0x56, 0x65, 0xf7,
-    0x38, 0x62, 0xc6, 0x0, 0x28, 0x95, 0x99, 0x1d,
-    0x26, 0xac, 0xc8, 0x2, 0x5a, 0x0, 0xae, 0x40,
-    0xf, 0x66, 0x60, 0xd, 0x38, 0xb7, 0x67, 0x3,
-    0xcb, 0x13, 0x0, 0xae, 0x94, 0xa, 0x5e, 0xa9,
-    0xab, 0x29, 0x20, 0xb, 0xaa, 0x35, 0x54, 0x7,
-    0x75, 0x4d, 0xa0, 0xa, 0x6b, 0x6a, 0x99, 0x8a,
-    0xae, 0x30, 0xc, 0x64, 0x1, 0xff, 0xc2, 0x57,
-    0x0, 0xaa, 0xb8, 0x40, 0x3f, 0xd5, 0x5c, 0x20,
-    0x1, 0xaa, 0xa6, 0xab, 0xfc, 0x20,
+    0x8, 0x20, 0x7f, 0x20, 0x3e, 0x44, 0x9, 0xa4,
+    0x3f, 0x8, 0x1c, 0x18, 0x2a, 0x28, 0x48, 0xc2,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+6587 "文" */
-    0x0, 0xf8, 0xcc, 0x1, 0xff, 0xc2, 0x55, 0x0,
-    0x7f, 0xf3, 0x2f, 0x37, 0x32, 0xaa, 0x66, 0x5b,
-    0x96, 0x21, 0x79, 0x54, 0xcc, 0xf5, 0xdb, 0x2c,
-    0x40, 0x26, 0xa0, 0xf, 0x53, 0x0, 0x78, 0x55,
-    0x0, 0x33, 0x28, 0x7, 0xe8, 0x90, 0x8, 0x6e,
-    0x40, 0x3f, 0xd, 0x48, 0x2, 0xec, 0x20, 0x1f,
-    0xce, 0xad, 0x0, 0xc0, 0x1f, 0xf6, 0xc2, 0xd0,
-    0x7, 0xff, 0x2, 0x48, 0x18, 0x3, 0xfc, 0x78,
-    0x39, 0x8d, 0xb1, 0x0, 0xf2, 0x5c, 0x7c, 0x80,
-    0xdf, 0x64, 0x98, 0x5, 0x9d, 0x16, 0x60, 0x19,
-    0x77, 0x23, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x8, 0x10, 0x8, 0x10, 0x4, 0x20,
+    0x2, 0x40, 0x2, 0xc0, 0x1, 0x80, 0x3, 0x80,
+    0x6, 0x60, 0x18, 0x18, 0x60, 0x6,
 
     /* U+6597 "斗" */
-    0x0, 0xa6, 0x42, 0x1, 0x58, 0x7, 0xd3, 0xba,
-    0x70, 0x3, 0x80, 0x7e, 0x4c, 0x20, 0xf, 0xfe,
-    0xa, 0x80, 0x7e, 0x5c, 0x70, 0xf, 0xf9, 0x70,
-    0x71, 0x40, 0x3f, 0xe6, 0xc7, 0x0, 0xff, 0xe0,
-    0x90, 0x7, 0x88, 0xc0, 0x38, 0x51, 0xa4, 0xf2,
-    0xec, 0xa9, 0x15, 0x98, 0xbc, 0x3a, 0x2c, 0xb9,
-    0x60, 0xcb, 0xcc, 0x54, 0x29, 0x88, 0x6, 0x44,
-    0x8, 0x7, 0xff, 0x59, 0x80, 0x30,
+    0x18, 0x40, 0x11, 0x0, 0x4, 0x0, 0x10, 0x20,
+    0x40, 0x21, 0x0, 0x4, 0x0, 0x10, 0x0, 0xf9,
+    0xf9, 0x0, 0x4, 0x0, 0x10, 0x0, 0x40, 0x1,
+    0x0,
 
     /* U+65B0 "新" */
-    0x0, 0xd4, 0x1, 0xe4, 0x8b, 0x50, 0x4, 0xdd,
-    0x92, 0xed, 0x23, 0x94, 0x57, 0x65, 0x0, 0x4e,
-    0xdf, 0x5e, 0xc9, 0xad, 0x31, 0x80, 0x77, 0x88,
-    0x17, 0x80, 0x7f, 0xda, 0xa0, 0xf4, 0x1, 0xfe,
-    0xaf, 0xf6, 0xf4, 0x50, 0xbd, 0xdb, 0x6e, 0xc2,
-    0x15, 0x76, 0x6b, 0xb5, 0xb, 0x5d, 0x9a, 0xec,
-    0x20, 0x1, 0x13, 0x88, 0x80, 0x3f, 0xd5, 0x74,
-    0x57, 0x6a, 0x6f, 0x0, 0xfa, 0xa8, 0x21, 0xd5,
-    0x42, 0x30, 0xf, 0xcd, 0x8b, 0x8e, 0x18, 0xa0,
-    0x1f, 0x26, 0x30, 0x40, 0x20, 0x8, 0x7, 0x87,
-    0xa8, 0x2, 0x7f, 0x80, 0xf, 0x86, 0x80, 0x2,
-    0xb, 0xa4, 0x1, 0x10, 0x4,
+    0x8, 0xc, 0x7f, 0x60, 0x0, 0x40, 0x22, 0x40,
+    0x0, 0x40, 0x7f, 0x7e, 0x8, 0x48, 0x8, 0x48,
+    0x7f, 0x8, 0x18, 0x8, 0xc, 0x88, 0x28, 0x88,
+    0x49, 0x8, 0x8, 0x8,
 
     /* U+65B9 "方" */
-    0x0, 0xf9, 0xc, 0x3, 0xff, 0x84, 0x4c, 0x1,
-    0xff, 0xcc, 0xbb, 0xec, 0xb9, 0xbb, 0xf0, 0x2,
-    0xef, 0x87, 0x72, 0xef, 0xc0, 0x1e, 0x11, 0x0,
-    0x7f, 0xf0, 0x89, 0x80, 0x3f, 0xf8, 0x4c, 0x99,
-    0x9e, 0x0, 0xfd, 0xb5, 0x99, 0xc0, 0x1f, 0xca,
-    0x80, 0x1c, 0x20, 0x1f, 0x1b, 0x80, 0x78, 0x40,
-    0x3e, 0xf8, 0x0, 0xe1, 0x70, 0xf, 0x42, 0x10,
-    0x7, 0x11, 0x0, 0x3a, 0x4a, 0x0, 0x3d, 0x78,
-    0x1, 0xab, 0x28, 0x3, 0x5d, 0xc6, 0xa0, 0x1a,
-    0x94, 0x3, 0xae, 0xf0, 0x6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x3, 0xf8,
+    0x4, 0x8, 0x4, 0x8, 0x4, 0x8, 0x8, 0x8,
+    0x18, 0x8, 0x30, 0x10, 0x40, 0xf0, 0x0, 0x0,
 
     /* U+65C1 "旁" */
-    0x0, 0xf9, 0x94, 0x3, 0xf2, 0xdd, 0xf5, 0x4d,
-    0xdf, 0x28, 0x1, 0x6e, 0xc7, 0x57, 0x98, 0xb9,
-    0x2b, 0xb2, 0x80, 0x76, 0x48, 0x6, 0xaa, 0x0,
-    0x72, 0x5d, 0xbc, 0xee, 0xf2, 0x45, 0xd9, 0x0,
-    0x1b, 0x37, 0x7a, 0x65, 0x79, 0x76, 0x9d, 0x0,
-    0x61, 0x80, 0x64, 0x40, 0x6, 0x3c, 0x0, 0x7d,
-    0x5d, 0xd9, 0x54, 0xbb, 0xd5, 0xe0, 0xa, 0xbb,
-    0xa5, 0xb3, 0x17, 0x7d, 0x40, 0x1e, 0x42, 0x11,
-    0xe0, 0xf, 0xeb, 0x18, 0x8d, 0x72, 0x1, 0xf4,
-    0x24, 0xcf, 0x80, 0x3c, 0x54, 0x32, 0x1, 0xc9,
-    0x80, 0x1a, 0x62, 0x64, 0x1, 0x35, 0x52, 0xd4,
-    0x3, 0x4d, 0x18, 0x6, 0x6a, 0xa6, 0x0, 0x60,
+    0x0, 0x0, 0x3f, 0xfc, 0x8, 0x10, 0x4, 0x20,
+    0x3f, 0xfc, 0x40, 0x2, 0x0, 0x0, 0x7f, 0xfe,
+    0x2, 0x0, 0x2, 0x0, 0x7, 0xf8, 0xc, 0x8,
+    0x18, 0x0, 0x60, 0x70, 0x0, 0x0,
 
     /* U+65E0 "无" */
-    0x0, 0x5d, 0xf7, 0x65, 0xdf, 0x0, 0x6b, 0xbe,
-    0x7e, 0xbb, 0xe0, 0xf, 0xfe, 0x69, 0x98, 0x3,
-    0xff, 0x84, 0x22, 0x0, 0xfd, 0x79, 0x9c, 0x99,
-    0x9e, 0xb0, 0x5, 0xe6, 0x71, 0xf6, 0x67, 0x58,
-    0x7, 0xc4, 0xb2, 0x1, 0xff, 0xc1, 0x5d, 0x70,
-    0xf, 0xfe, 0xd, 0xa0, 0x7, 0xff, 0x6, 0x64,
-    0x1, 0xf1, 0x0, 0x74, 0x2, 0x80, 0x7c, 0xa8,
-    0x0, 0x3b, 0xf9, 0x0, 0x38, 0x80, 0x6d, 0x60,
-    0xba, 0x97, 0x0, 0xb7, 0x59, 0x98, 0x8,
+    0x3f, 0xfc, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x7f, 0xfe, 0x1, 0x0, 0x1, 0x80,
+    0x0, 0x80, 0x2, 0x80, 0x4, 0x80, 0xc, 0x80,
+    0x10, 0x82, 0x60, 0x7e,
 
     /* U+65E5 "日" */
-    0xbc, 0xcf, 0xd6, 0xf9, 0x9f, 0x9c, 0x3, 0xff,
-    0xb8, 0x59, 0x9f, 0x8c, 0xb3, 0x3f, 0x18, 0x7,
-    0xff, 0x70, 0xb3, 0x3f, 0x1a, 0xe6, 0x7e, 0x5b,
-    0x0, 0xfd, 0x40,
+    0xff, 0xe0, 0x18, 0x6, 0x1, 0x80, 0x60, 0x1f,
+    0xfe, 0x1, 0x80, 0x60, 0x18, 0x6, 0x1, 0xff,
+    0xe0, 0x10, 0x0,
 
     /* U+65E7 "旧" */
-    0xb0, 0xf, 0xf9, 0xc0, 0x2c, 0xbb, 0xf8, 0x3,
-    0x3d, 0xdf, 0x9c, 0x3, 0xff, 0xb8, 0xb7, 0x7e,
-    0x20, 0xc, 0xb7, 0x7e, 0x20, 0xf, 0xff, 0x42,
-    0x5d, 0xf8, 0x9c, 0x2, 0x5b, 0xbf, 0x28,
+    0x80, 0x8, 0xff, 0x88, 0x18, 0x81, 0x88, 0x18,
+    0x81, 0x8f, 0xf8, 0x81, 0x88, 0x18, 0x81, 0x88,
+    0x18, 0x81, 0x8f, 0xf8, 0x81,
 
     /* U+65E9 "早" */
-    0x0, 0x26, 0x5d, 0xfe, 0xc2, 0x0, 0xc7, 0x17,
-    0x7f, 0xa9, 0xc0, 0x3f, 0xf9, 0x31, 0x77, 0xfc,
-    0x1, 0xe8, 0xbb, 0xfe, 0x0, 0xff, 0xe4, 0xaf,
-    0x5d, 0xdb, 0x97, 0x76, 0x20, 0x6, 0x2a, 0xbb,
-    0xaa, 0x6e, 0xea, 0x10, 0xf, 0xfe, 0x30, 0xdd,
-    0xfa, 0xa2, 0xef, 0xc2, 0x2b, 0xbf, 0x54, 0x5d,
-    0xf8, 0x40, 0x3f, 0xfb, 0x62, 0x20, 0xf, 0x80,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+660E "明" */
-    0x8b, 0xbb, 0x0, 0x17, 0x7e, 0x83, 0xbb, 0x98,
-    0x41, 0xee, 0xf9, 0x0, 0x3f, 0xfa, 0xe5, 0x99,
-    0xc0, 0xb, 0xb9, 0x0, 0x5, 0xbb, 0xc0, 0xb,
-    0xb9, 0x0, 0xe, 0x23, 0xc0, 0x1f, 0xfc, 0x92,
-    0x5b, 0xbe, 0x0, 0x5d, 0xcc, 0x29, 0x17, 0x7c,
-    0x0, 0xbb, 0xb0, 0x35, 0xc0, 0x3d, 0xe0, 0x19,
-    0x44, 0x40, 0x1e, 0x40, 0x8, 0xa2, 0xc0, 0x3c,
-    0xe0, 0x1a, 0x7c, 0x40, 0x26, 0xbb, 0x60,
+    0xf9, 0xfe, 0x24, 0x18, 0x90, 0x62, 0x41, 0x89,
+    0xff, 0xe4, 0x18, 0x90, 0x62, 0x41, 0x89, 0xff,
+    0xe0, 0x18, 0x20, 0x40, 0x81, 0x4, 0x4, 0x20,
+    0x60,
 
     /* U+661F "星" */
-    0x1, 0xca, 0xaf, 0xd8, 0x40, 0x3, 0x5a, 0xaf,
-    0xc8, 0xc0, 0x1f, 0xfc, 0x54, 0xaa, 0xfc, 0xa0,
-    0x19, 0x2a, 0xbf, 0x28, 0x4, 0x47, 0x55, 0xf8,
-    0xd4, 0x2, 0x9c, 0xaa, 0x44, 0x2a, 0xab, 0x10,
-    0xb, 0x94, 0x0, 0x88, 0x0, 0xfa, 0x5a, 0x6a,
-    0xbf, 0x40, 0x48, 0xdd, 0x57, 0xf4, 0x4, 0x42,
-    0xab, 0xfc, 0x20, 0x21, 0x55, 0xfe, 0x10, 0xf,
-    0xfe, 0x1c, 0x5d, 0xff, 0xf0, 0x20,
+    0x3f, 0xf0, 0x80, 0x42, 0x1, 0xf, 0xfc, 0x20,
+    0x10, 0xff, 0xc0, 0x0, 0x8, 0x0, 0x7f, 0xfb,
+    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0,
 
     /* U+662F "是" */
-    0x0, 0xe, 0x55, 0x7e, 0xc0, 0xe, 0x54, 0xaa,
-    0xfc, 0xa4, 0x1, 0xc9, 0x33, 0xf9, 0x0, 0x3c,
-    0x93, 0x3f, 0x9c, 0x3, 0x9c, 0x3, 0xf8, 0xc0,
-    0x38, 0xc6, 0xab, 0xf0, 0x90, 0x7, 0x4d, 0x57,
-    0xe8, 0x0, 0xd5, 0x77, 0xd9, 0xb7, 0x7d, 0x40,
-    0xa, 0xba, 0xeb, 0xb4, 0x55, 0xdf, 0x50, 0x6,
-    0x73, 0x0, 0xbc, 0x47, 0x80, 0x3b, 0x78, 0x2,
-    0x48, 0x8d, 0x20, 0x19, 0x5, 0x10, 0x0, 0xb9,
-    0x9d, 0x0, 0x11, 0x4d, 0xec, 0x51, 0x80, 0x7f,
-    0x77, 0x88, 0xb3, 0xf6, 0xef, 0xe0,
+    0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
+    0x10, 0x8, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x80, 0x18, 0xfc, 0x18, 0x0,
+    0x26, 0x0, 0x41, 0xfe,
 
     /* U+665A "晚" */
-    0x1, 0x18, 0x2, 0x92, 0x0, 0xf4, 0xc4, 0x4e,
-    0x6, 0x93, 0x79, 0x20, 0x11, 0x4c, 0xa3, 0x46,
-    0x76, 0xec, 0xf6, 0x1, 0xfb, 0x4d, 0xdd, 0x40,
-    0xac, 0x20, 0x1c, 0xa1, 0x88, 0x87, 0x84, 0x2b,
-    0x0, 0x5d, 0xb5, 0x54, 0x86, 0x66, 0x33, 0x28,
-    0x5, 0x76, 0xd0, 0xc, 0x22, 0x0, 0xff, 0x88,
-    0x54, 0xc4, 0x46, 0x1, 0xf5, 0xd4, 0x49, 0x7c,
-    0x5c, 0x80, 0x78, 0xa6, 0x43, 0x4b, 0x32, 0x30,
-    0x5, 0xda, 0xb0, 0x0, 0xaa, 0x0, 0xfa, 0xee,
-    0x60, 0x29, 0x90, 0x6, 0x34, 0x90, 0xc, 0xf3,
-    0xa0, 0x20, 0x13, 0x9, 0x0, 0x1a, 0xca, 0xc4,
-    0x0, 0xf7, 0x69, 0x40,
+    0x1, 0x1, 0xe3, 0xe2, 0x28, 0x84, 0x73, 0x8,
+    0xc4, 0x5f, 0x88, 0xa3, 0x11, 0x46, 0x22, 0x8b,
+    0xf9, 0x11, 0x43, 0xc2, 0x84, 0x9, 0x0, 0x22,
+    0x1, 0x7, 0x80,
 
     /* U+66F4 "更" */
-    0x9b, 0xbe, 0xdd, 0x5d, 0xf4, 0x4, 0xdd, 0xf4,
-    0x55, 0xdf, 0x40, 0x7, 0xff, 0x14, 0xf2, 0xee,
-    0x9a, 0xbb, 0xaa, 0x80, 0x12, 0xcd, 0xdd, 0x35,
-    0x77, 0x53, 0x0, 0x69, 0xaa, 0xa6, 0xab, 0x84,
-    0x3, 0x4d, 0x55, 0x35, 0x5c, 0x20, 0x1f, 0xfc,
-    0x64, 0xea, 0xaa, 0x2e, 0xab, 0x20, 0x4, 0x5d,
-    0x35, 0x46, 0xda, 0xad, 0x0, 0x19, 0x60, 0x8c,
-    0x44, 0x1, 0xfe, 0xae, 0xe5, 0x80, 0x7f, 0x92,
-    0x96, 0xea, 0x10, 0x40, 0x3a, 0xac, 0xea, 0x5a,
-    0xe8, 0xee, 0xd9, 0x8b, 0xa, 0xb7, 0x10, 0x8,
-    0x9e, 0xaf, 0x31, 0x60,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
+    0x0, 0x87, 0xff, 0x0, 0x2, 0x0, 0x4, 0x3f,
+    0xf8, 0x4, 0x0, 0x48, 0x0, 0x60, 0x1, 0xb0,
+    0x18, 0xf, 0x80, 0x0, 0x0,
 
     /* U+6700 "最" */
-    0x0, 0xae, 0xab, 0xf5, 0x88, 0x6, 0x10, 0xaa,
-    0xfc, 0x46, 0x1, 0xcb, 0x33, 0xf9, 0x0, 0x3c,
-    0xb3, 0x3f, 0x90, 0x3, 0x84, 0xa6, 0x7f, 0x19,
-    0x0, 0x74, 0xcf, 0xf5, 0x0, 0x69, 0xdb, 0xaa,
-    0x6e, 0x55, 0x7a, 0x40, 0x12, 0xb1, 0x55, 0x4d,
-    0xdf, 0xa4, 0x3, 0x45, 0x52, 0xc2, 0x76, 0x22,
-    0xc3, 0x0, 0xd1, 0x54, 0xb0, 0x87, 0x99, 0x43,
-    0x98, 0x6, 0x8a, 0xa5, 0x80, 0x22, 0x42, 0xec,
-    0x1, 0xd1, 0x54, 0x40, 0x1, 0x8e, 0xc0, 0x80,
-    0x50, 0xb1, 0x54, 0x30, 0x3, 0x1d, 0x72, 0x0,
-    0x55, 0xb7, 0x54, 0xd2, 0xc0, 0xb7, 0xed, 0xb0,
+    0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
+    0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xfe, 0x20, 0x0,
+    0x3e, 0xfc, 0x20, 0x44, 0x3e, 0x28, 0x22, 0x30,
+    0x7e, 0x28, 0x0, 0x86,
 
     /* U+6708 "月" */
-    0x0, 0xa3, 0x33, 0xf4, 0x80, 0x47, 0xb9, 0x9f,
-    0x28, 0x7, 0xff, 0x4b, 0x73, 0x3e, 0x0, 0xec,
-    0xcf, 0xc0, 0x1f, 0xfc, 0x57, 0x0, 0xff, 0xe0,
-    0x15, 0xdf, 0xe0, 0x9, 0x1a, 0xef, 0xf0, 0x5,
-    0xb6, 0x1, 0xfe, 0x15, 0x30, 0xf, 0xf5, 0x40,
-    0x7, 0xf9, 0x31, 0x0, 0x38, 0xf3, 0x2b,
+    0x1f, 0xf8, 0x80, 0x44, 0x2, 0x20, 0x11, 0xff,
+    0x88, 0x4, 0x40, 0x22, 0x1, 0x1f, 0xf8, 0x80,
+    0x48, 0x2, 0x40, 0x14, 0x0, 0x80, 0x38,
 
     /* U+6709 "有" */
-    0x0, 0xf5, 0x8, 0x7, 0xff, 0x0, 0x46, 0x0,
-    0xfd, 0x37, 0x77, 0xbd, 0xdf, 0xd2, 0x13, 0x77,
-    0x16, 0x5d, 0xfd, 0x20, 0x1a, 0x24, 0x3, 0xff,
-    0x80, 0x6f, 0xd7, 0x7f, 0x0, 0x62, 0x83, 0xbb,
-    0xf9, 0xc0, 0x22, 0xea, 0x7b, 0xbf, 0x88, 0x2,
-    0x8d, 0x10, 0xbb, 0xf8, 0x80, 0x2a, 0x10, 0xf,
-    0xfe, 0x2d, 0xdf, 0xc6, 0x1, 0xf5, 0xdf, 0xc6,
-    0x1, 0xff, 0xce, 0x3b, 0xb3, 0x80, 0x7a, 0xc0,
-    0x31, 0xdd, 0xc0, 0x0,
+    0x2, 0x0, 0x4, 0x1, 0xff, 0xf8, 0x20, 0x0,
+    0x80, 0x1, 0xff, 0x6, 0x2, 0x17, 0xfc, 0x48,
+    0x8, 0x10, 0x10, 0x3f, 0xe0, 0x40, 0x40, 0x80,
+    0x81, 0x7, 0x0, 0x0, 0x0,
 
     /* U+670D "服" */
-    0x0, 0x5d, 0xe6, 0x9, 0xbb, 0xe7, 0x0, 0xd7,
-    0x69, 0xf0, 0x5b, 0xbe, 0xc0, 0xf, 0xfe, 0x80,
-    0xaa, 0x80, 0x32, 0x5d, 0xb8, 0x3, 0x84, 0x1,
-    0x40, 0x12, 0x5d, 0xb8, 0x2, 0x11, 0x91, 0x0,
-    0x1f, 0xe1, 0xca, 0xbb, 0xb0, 0x2, 0x10, 0xe,
-    0x1e, 0xca, 0xa5, 0xb8, 0x0, 0x53, 0x31, 0xc0,
-    0x11, 0xe0, 0x1, 0xbc, 0x0, 0x6d, 0x98, 0xe0,
-    0xd, 0xec, 0x16, 0xa0, 0x6, 0xe0, 0xf, 0x93,
-    0xe6, 0x0, 0x23, 0x20, 0xf, 0xe7, 0x60, 0xb,
-    0x10, 0x3, 0xc3, 0x5f, 0x9e, 0x60, 0x1, 0x0,
-    0x54, 0xf8, 0x33, 0x25, 0x8b, 0x20, 0x42, 0x80,
-    0x15, 0x6c, 0x14, 0xe6, 0x0, 0x1b, 0x10,
+    0x3c, 0xfc, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82,
+    0x3e, 0x80, 0x22, 0x80, 0x22, 0xfe, 0x22, 0x82,
+    0x3e, 0xa0, 0x22, 0x84, 0x2, 0x98, 0x2, 0x98,
+    0x42, 0xa4, 0x4c, 0x82, 0x0, 0x0,
 
     /* U+671B "望" */
-    0x0, 0xd4, 0x1, 0x92, 0xea, 0xa9, 0x1, 0xab,
-    0xb2, 0x5d, 0xc9, 0x91, 0x55, 0x10, 0xc, 0x3c,
-    0xe4, 0xcc, 0x85, 0x15, 0x53, 0x80, 0x9, 0xc8,
-    0xb8, 0x6, 0xea, 0xa7, 0x0, 0xff, 0x2d, 0x56,
-    0x20, 0x9, 0xc0, 0x39, 0x62, 0xaa, 0x91, 0x0,
-    0xae, 0xf9, 0xf9, 0x80, 0x4e, 0xb0, 0x2, 0x7b,
-    0xbc, 0x72, 0x0, 0x36, 0xd4, 0x0, 0xa2, 0xef,
-    0x7c, 0xdd, 0xa7, 0xb8, 0x1, 0xa2, 0xef, 0x76,
-    0x5d, 0xea, 0x0, 0xe9, 0x9d, 0xd7, 0x33, 0x88,
-    0x3, 0xa2, 0x36, 0xa4, 0x46, 0x20, 0xe, 0x11,
-    0xc7, 0xe2, 0x38, 0x3, 0x4d, 0xdf, 0x4d, 0x5d,
-    0xf5, 0x0,
+    0x8, 0x3e, 0x7f, 0x42, 0x20, 0x7e, 0x20, 0x42,
+    0x20, 0x7e, 0x20, 0x2, 0x1e, 0x84, 0x0, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x80,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+6728 "木" */
-    0x0, 0xf9, 0x54, 0x1, 0xff, 0xc2, 0x33, 0x0,
-    0x7f, 0xf3, 0x23, 0x33, 0xae, 0xd9, 0x9d, 0x20,
-    0x8, 0xcc, 0xda, 0x44, 0xdc, 0xcd, 0x20, 0x1f,
-    0x5b, 0x32, 0xc0, 0x3f, 0xe5, 0x2f, 0xf1, 0x28,
-    0x7, 0xf1, 0x74, 0x0, 0x23, 0x88, 0x3, 0xe1,
-    0xea, 0x0, 0xd5, 0xc2, 0x1, 0xc5, 0xbc, 0x20,
-    0x18, 0x7f, 0x44, 0x2, 0x5e, 0xe1, 0x0, 0x78,
-    0xe3, 0xc, 0x7, 0x34, 0x80, 0x3f, 0x27, 0xc0,
-    0xc, 0x88, 0x7, 0xf8, 0xac, 0x3, 0xf1, 0x98,
-    0x3, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x1, 0x80, 0x3, 0xc0, 0x2, 0x40, 0x4, 0x20,
+    0x8, 0x10, 0x10, 0x8, 0x20, 0x4, 0x40, 0x2,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+672A "未" */
-    0x0, 0xf9, 0x94, 0x3, 0xff, 0x86, 0x60, 0x1f,
-    0xd1, 0x99, 0xae, 0xd9, 0x9a, 0x80, 0x34, 0x66,
-    0x6b, 0xb6, 0x66, 0xa0, 0xf, 0xfe, 0xbc, 0xe6,
-    0x75, 0xdb, 0x33, 0xa8, 0x1, 0x39, 0x9a, 0x8c,
-    0x27, 0x33, 0x50, 0x7, 0x8f, 0x62, 0xf8, 0xc0,
-    0x3f, 0x8e, 0x28, 0x1, 0x70, 0x60, 0x1f, 0x2c,
-    0x50, 0x80, 0x57, 0xc, 0x1, 0x86, 0x72, 0xc4,
-    0x3, 0xaf, 0xe8, 0x40, 0x15, 0xb2, 0x1, 0xfa,
-    0x7a, 0x80, 0x16, 0x80, 0x1c, 0x60, 0x19, 0x2c,
-    0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x1, 0x80,
+    0x2, 0x40, 0x4, 0x20, 0x8, 0x10, 0x30, 0xc,
+    0x40, 0x2, 0x0, 0x0,
 
     /* U+672C "本" */
-    0x0, 0xf9, 0x54, 0x1, 0xff, 0xc2, 0x33, 0x0,
-    0x7f, 0xf3, 0x27, 0x33, 0xa2, 0x19, 0x9d, 0x20,
-    0x9, 0xcc, 0xde, 0x3, 0xf9, 0x9a, 0x40, 0x3e,
-    0x89, 0x88, 0x0, 0x7f, 0xcf, 0xa2, 0x2c, 0x60,
-    0xf, 0xe4, 0xd6, 0x0, 0x3e, 0x98, 0x7, 0xc9,
-    0xf4, 0x1, 0xab, 0xcc, 0x3, 0x97, 0xec, 0x3,
-    0x87, 0x7d, 0x0, 0x2a, 0xfb, 0x8c, 0xc5, 0xdb,
-    0x30, 0xdb, 0xd4, 0x0, 0xea, 0x8, 0xcc, 0x5d,
-    0xb3, 0xe, 0x35, 0xc0, 0x4, 0x0, 0xff, 0xe0,
-    0x20, 0x7, 0xe3, 0x30, 0x7, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x1, 0x80, 0x2, 0x40, 0x0, 0x0, 0x4, 0x20,
+    0x8, 0x10, 0x10, 0x8, 0x6f, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+673A "机" */
-    0x0, 0x8d, 0xc0, 0x2b, 0xbe, 0x0, 0xf3, 0x80,
-    0x67, 0xbb, 0x9c, 0x3, 0xff, 0x91, 0x79, 0x32,
-    0xca, 0x0, 0xff, 0x5e, 0x2c, 0xe5, 0x0, 0x7f,
-    0xf0, 0x17, 0x80, 0x27, 0x0, 0xfe, 0x47, 0x72,
-    0x80, 0x7f, 0xf0, 0x3b, 0xe7, 0xd0, 0x3, 0xfc,
-    0x66, 0x10, 0xac, 0x22, 0x0, 0x7e, 0x88, 0x0,
-    0x50, 0xfe, 0x1, 0xf1, 0xe8, 0x80, 0x6c, 0x40,
-    0xf, 0x29, 0xb0, 0x7, 0x29, 0x0, 0x7b, 0xc0,
-    0x3d, 0x30, 0x1, 0x9c, 0x3, 0xce, 0x2, 0x68,
-    0x1, 0xb3, 0x2f,
+    0x0, 0xf8, 0x0, 0x88, 0x0, 0x88, 0x7e, 0x88,
+    0x10, 0x88, 0x18, 0x88, 0x18, 0x88, 0x24, 0x88,
+    0x22, 0x88, 0x40, 0x8, 0x1, 0x8, 0x1, 0x9,
+    0x2, 0x9, 0x2, 0x6,
 
     /* U+6751 "村" */
-    0x0, 0xd4, 0x1, 0xfa, 0x80, 0x3c, 0x20, 0x1f,
-    0x98, 0x3, 0xff, 0x8f, 0x79, 0x84, 0xcb, 0x3b,
-    0xbe, 0x3b, 0x50, 0xbc, 0x94, 0xcb, 0x3b, 0xbe,
-    0x3b, 0x50, 0xb, 0xdc, 0x3, 0xff, 0x82, 0x26,
-    0x50, 0x0, 0x57, 0x0, 0xfd, 0x34, 0xbf, 0x0,
-    0xb8, 0x40, 0x1e, 0x22, 0x18, 0x38, 0x5, 0x10,
-    0x0, 0xf4, 0xc0, 0x5, 0x0, 0x3, 0x0, 0xf1,
-    0x61, 0x0, 0x7d, 0x40, 0x1c, 0x4e, 0x1, 0xff,
-    0xd6, 0x10, 0xe, 0x7c, 0xc2, 0x0, 0x0,
+    0x8, 0x4, 0x8, 0x4, 0x8, 0x4, 0x7e, 0xfe,
+    0x8, 0x4, 0x18, 0x4, 0x1c, 0x4, 0x2a, 0x44,
+    0x2a, 0x24, 0x48, 0x24, 0x8, 0x4, 0x8, 0x4,
+    0x8, 0x4, 0x8, 0x1c,
 
     /* U+6761 "条" */
-    0x0, 0xe3, 0x90, 0xf, 0xfe, 0x9, 0x71, 0x5d,
-    0xea, 0x0, 0xf9, 0x21, 0xee, 0xf1, 0xf8, 0x7,
-    0xc, 0x9d, 0x7c, 0x80, 0x1f, 0xd4, 0x3, 0x8e,
-    0xdc, 0x16, 0xae, 0xc4, 0xe0, 0x1e, 0x22, 0x0,
-    0x12, 0x48, 0xf9, 0x80, 0x3c, 0x2b, 0x37, 0x97,
-    0x55, 0x5, 0xda, 0x10, 0x0, 0xe7, 0x76, 0x81,
-    0x57, 0x16, 0xbb, 0x80, 0x2c, 0xc4, 0x55, 0x57,
-    0x35, 0x5a, 0x78, 0x1, 0x55, 0xc2, 0xec, 0x15,
-    0x5c, 0x1, 0xea, 0xec, 0xfd, 0x90, 0xf, 0xc3,
-    0x9e, 0xa0, 0x7, 0xfb, 0x10, 0xe, 0x6d, 0xf5,
-    0x0, 0xcd, 0x1a, 0xc0, 0x16, 0x76, 0x18, 0x7,
-    0x8f, 0x3b, 0x0, 0x19, 0x0, 0x19, 0x94, 0x3,
-    0x46, 0x0,
+    0x2, 0x0, 0x7, 0xf0, 0xc, 0x20, 0x22, 0x0,
+    0x1, 0x80, 0x3, 0xc0, 0x1c, 0x1c, 0x0, 0x0,
+    0x7f, 0xfe, 0x3, 0xc0, 0x4, 0x20, 0x8, 0x10,
+    0x10, 0x8, 0x60, 0x6, 0x0, 0x0,
 
     /* U+6765 "来" */
-    0x0, 0xf9, 0x54, 0x1, 0xfe, 0x11, 0xc4, 0x62,
-    0x38, 0x3, 0xd, 0x57, 0xae, 0xab, 0x8c, 0x0,
-    0x35, 0xd5, 0x77, 0xf1, 0xd1, 0x80, 0x66, 0x80,
-    0xf, 0x28, 0x7, 0xc6, 0x42, 0x1, 0xd3, 0x0,
-    0x1f, 0x49, 0x80, 0x62, 0x80, 0xe, 0xbc, 0xc7,
-    0x73, 0x26, 0x59, 0xd1, 0x98, 0xb0, 0x5, 0xe6,
-    0x66, 0x56, 0x5c, 0xcd, 0x60, 0x1e, 0x8c, 0xc7,
-    0xe4, 0x80, 0x7f, 0x4f, 0x30, 0x1, 0x72, 0xc4,
-    0x3, 0x86, 0xf1, 0x80, 0x32, 0xc6, 0xa0, 0x4,
-    0xfb, 0xa, 0x1, 0xe3, 0xcd, 0xb0, 0x1, 0x61,
-    0x80, 0x46, 0x60, 0xd, 0x34, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x8,
+    0x8, 0x8, 0x8, 0x10, 0x0, 0x0, 0x7f, 0xfe,
+    0x3, 0xc0, 0x4, 0x20, 0x8, 0x10, 0x10, 0x8,
+    0x20, 0x6, 0x0, 0x0,
 
     /* U+6781 "极" */
-    0x0, 0xff, 0xe3, 0xb2, 0x3, 0x6e, 0xb3, 0x2e,
-    0x40, 0xf, 0x8, 0x34, 0x5e, 0x64, 0xce, 0x1,
-    0xff, 0xc2, 0x32, 0x0, 0xaf, 0x22, 0x18, 0xc6,
-    0x60, 0xc, 0x20, 0x15, 0xe2, 0xc6, 0x30, 0x88,
-    0x3, 0xfc, 0x86, 0x0, 0xf9, 0xbb, 0x62, 0xdc,
-    0x80, 0x4c, 0xb6, 0x40, 0x43, 0x57, 0x9d, 0x0,
-    0x1b, 0x31, 0x72, 0x22, 0xf9, 0x0, 0xaa, 0x80,
-    0x4, 0xd0, 0x3f, 0x57, 0x32, 0x0, 0x9, 0x18,
-    0x2, 0x1c, 0x0, 0x8a, 0xe1, 0x12, 0x15, 0x0,
-    0x2, 0x90, 0xc, 0x98, 0x5, 0xd5, 0x86, 0x0,
-    0x25, 0x0, 0xdc, 0xc0, 0xf, 0x71, 0x0, 0xfc,
-    0x62, 0x23, 0xbd, 0xd7, 0x48, 0x80, 0x70, 0xdc,
-    0x2c, 0xd2, 0x84, 0x6d, 0x8,
+    0x0, 0x0, 0x1, 0xf8, 0x0, 0x8, 0x0, 0x8,
+    0x7c, 0x8, 0x10, 0x8, 0x11, 0xfe, 0x19, 0x82,
+    0x25, 0x44, 0x1, 0x44, 0x41, 0x28, 0x0, 0x10,
+    0x2, 0x30, 0x2, 0x4c, 0x4, 0x82,
 
     /* U+6797 "林" */
-    0x0, 0xd4, 0x1, 0xeb, 0x0, 0xfc, 0xc0, 0x1e,
-    0x70, 0xf, 0xfe, 0x4d, 0x5e, 0x1d, 0xd8, 0x2a,
-    0xf0, 0xee, 0xd2, 0x0, 0xab, 0x91, 0xab, 0xa,
-    0xbb, 0x4, 0x5c, 0x80, 0x6f, 0x3a, 0x0, 0xd8,
-    0x36, 0x1, 0xc2, 0x63, 0x14, 0x0, 0x33, 0x11,
-    0x80, 0x74, 0x58, 0x1e, 0x18, 0x4c, 0x83, 0x14,
-    0x2, 0x23, 0x20, 0x3, 0x19, 0xc2, 0xf, 0x20,
-    0x14, 0xc0, 0x7, 0x7c, 0x0, 0x56, 0xc0, 0x58,
-    0x40, 0x1a, 0x68, 0x40, 0x27, 0xa1, 0x27, 0x0,
-    0xec, 0x60, 0xe, 0xd1, 0x0, 0xf9, 0x40, 0x3c,
-    0x20, 0x1c, 0xc0, 0x1e, 0x70, 0xc,
+    0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x7e, 0xfe,
+    0x8, 0x10, 0x1c, 0x38, 0x1a, 0x38, 0x28, 0x50,
+    0x28, 0x54, 0x48, 0x90, 0x9, 0x12, 0x8, 0x10,
+    0x8, 0x10, 0x8, 0x10,
 
     /* U+679C "果" */
-    0x0, 0x1e, 0x5d, 0xdb, 0xab, 0xbb, 0x10, 0x3,
-    0x2d, 0x5d, 0xfe, 0x93, 0x0, 0xff, 0xe4, 0xdd,
-    0x55, 0x76, 0xaa, 0xa4, 0x3, 0xd7, 0x55, 0x5d,
-    0xaa, 0xa9, 0x0, 0xe3, 0x0, 0xff, 0xe1, 0xa6,
-    0x5d, 0xfe, 0xf5, 0x0, 0xc3, 0x57, 0x7f, 0xa8,
-    0x80, 0x29, 0xbb, 0xe8, 0x85, 0xdf, 0x48, 0x2,
-    0x6e, 0xf0, 0x23, 0x8d, 0xde, 0x90, 0xe, 0x1b,
-    0xfc, 0xf9, 0xb2, 0x0, 0xf9, 0xaa, 0x50, 0x0,
-    0x75, 0x2e, 0x1, 0x97, 0x6, 0xc8, 0x3, 0xd,
-    0x96, 0x38, 0x5, 0xae, 0x1, 0x19, 0x80, 0x25,
-    0xc3, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
+    0x7f, 0xfe, 0x3, 0xc0, 0x4, 0x20, 0x8, 0x10,
+    0x20, 0x4, 0x0, 0x0,
 
     /* U+6839 "根" */
-    0x0, 0x9c, 0xc0, 0xd, 0x77, 0xe0, 0xe, 0xf0,
-    0xb, 0xea, 0xef, 0x0, 0x70, 0x83, 0x88, 0x7,
-    0xfd, 0x74, 0xd1, 0x48, 0x15, 0x77, 0x94, 0x2,
-    0xbb, 0x1f, 0xda, 0x5, 0x5d, 0xe5, 0x0, 0xc4,
-    0x46, 0x0, 0xff, 0xe0, 0xd2, 0xc1, 0x0, 0x2a,
-    0xef, 0x0, 0x71, 0x12, 0x24, 0x1, 0x54, 0x3b,
-    0xb8, 0x2, 0x6c, 0x6, 0xf2, 0x0, 0x9, 0x0,
-    0x1e, 0x40, 0x14, 0xc0, 0x4, 0x20, 0xb, 0x1a,
-    0x86, 0x40, 0xa0, 0x3, 0xf3, 0x5c, 0xb0, 0x0,
-    0x90, 0x3, 0xfa, 0x60, 0x3, 0xf8, 0x4a, 0x6a,
-    0xc7, 0xac, 0x40, 0x37, 0x88, 0x36, 0x62, 0xad,
-    0x55, 0x1a, 0x0,
+    0x0, 0xfc, 0x11, 0x4, 0x11, 0x4, 0x7d, 0xfc,
+    0x11, 0x4, 0x11, 0x4, 0x39, 0xfc, 0x35, 0x20,
+    0x11, 0x22, 0x51, 0x8, 0x11, 0x10, 0x11, 0x8,
+    0x11, 0xe4, 0x0, 0x2,
 
     /* U+6885 "梅" */
-    0x0, 0xa4, 0x3, 0x50, 0x7, 0xf8, 0xc4, 0x0,
-    0x40, 0x1f, 0xfc, 0x3b, 0x1a, 0xaf, 0x0, 0x26,
-    0x92, 0xe4, 0xca, 0xea, 0xbc, 0x0, 0x9a, 0xb,
-    0x99, 0x7d, 0x5d, 0xb2, 0xec, 0x40, 0x11, 0x9,
-    0x5, 0x17, 0x5f, 0x45, 0xe3, 0x80, 0x54, 0x72,
-    0x0, 0xe6, 0x2, 0x70, 0x0, 0x80, 0x44, 0xd3,
-    0x10, 0x5b, 0x9b, 0x99, 0x5f, 0x90, 0x26, 0x1,
-    0x64, 0x8d, 0xd9, 0xe2, 0xdb, 0xc8, 0x3d, 0x80,
-    0x8, 0x2e, 0x44, 0x12, 0x20, 0x20, 0x17, 0x0,
-    0x61, 0x10, 0x7, 0x8, 0x0, 0x94, 0x3, 0x13,
-    0xdd, 0x92, 0xec, 0xb4, 0x20, 0x1e, 0x79, 0xbb,
-    0x75, 0xd9, 0x28, 0x40, 0x23, 0x10, 0x44, 0x0,
-    0x6, 0x6f, 0x80, 0x3a, 0x40, 0x3c, 0x33, 0x68,
-    0x0,
+    0x10, 0x80, 0x10, 0x80, 0x11, 0xfe, 0x7d, 0x0,
+    0x12, 0xfc, 0x10, 0x0, 0x39, 0x0, 0x37, 0xfe,
+    0x11, 0x24, 0x51, 0x24, 0x11, 0x24, 0x11, 0xfe,
+    0x10, 0x4, 0x10, 0x18, 0x0, 0x0,
 
     /* U+6B21 "次" */
-    0x2, 0x0, 0xeb, 0x0, 0xfe, 0x7c, 0x20, 0x2,
-    0x60, 0x7, 0xf2, 0xf7, 0x98, 0x76, 0x4c, 0xf9,
-    0xc0, 0x22, 0xc1, 0x1a, 0x6d, 0x2e, 0xec, 0xd0,
-    0xc, 0x25, 0x1e, 0x44, 0x12, 0x2b, 0x78, 0x3,
-    0x8c, 0x90, 0x3, 0xc8, 0x80, 0xe, 0x1a, 0x0,
-    0x88, 0x40, 0xa0, 0x3, 0xe1, 0x0, 0x8, 0x28,
-    0x12, 0x0, 0x75, 0x38, 0x4, 0xd1, 0xc0, 0x1f,
-    0x56, 0x28, 0x5, 0x6c, 0x2, 0x1, 0xd5, 0x8c,
-    0x1, 0x4c, 0x4, 0x58, 0x6, 0x1f, 0x60, 0x9,
-    0xc5, 0x0, 0x88, 0xe0, 0x10, 0xa8, 0x0, 0x68,
-    0x20, 0x2, 0x8e, 0x90, 0xe, 0x4d, 0x97, 0x0,
-    0xe9, 0xcc, 0x0, 0x64, 0xc3, 0x0, 0xf9, 0x70,
-    0x0,
+    0x1, 0x0, 0x20, 0x0, 0x13, 0xfc, 0x2, 0x42,
+    0x4, 0x44, 0x4, 0x44, 0x0, 0x40, 0x0, 0x40,
+    0x10, 0x20, 0x20, 0xa0, 0x41, 0x10, 0x1, 0x10,
+    0x4, 0xc, 0x8, 0x2, 0x0, 0x0,
 
     /* U+6B4C "歌" */
-    0xa, 0xae, 0xbe, 0x83, 0x60, 0xf, 0x55, 0x79,
-    0xe1, 0x8, 0x3, 0xc5, 0x77, 0x18, 0x5, 0x9f,
-    0x77, 0x50, 0x83, 0xfd, 0xc2, 0x80, 0x6b, 0x7b,
-    0xb0, 0x88, 0x0, 0x20, 0x1c, 0xda, 0x1, 0xf2,
-    0x6c, 0xd7, 0x40, 0x6b, 0x0, 0x44, 0x60, 0x1,
-    0x89, 0x96, 0xfc, 0x58, 0x6, 0x28, 0x1, 0xaa,
-    0xdf, 0x95, 0x40, 0x1, 0x10, 0x2, 0x1a, 0xae,
-    0xb2, 0xa0, 0x22, 0x20, 0x6, 0x3a, 0xa9, 0x0,
-    0x32, 0xc6, 0x0, 0x65, 0x9a, 0x8c, 0x0, 0xd8,
-    0x80, 0x40, 0x10, 0xb8, 0x8b, 0xc0, 0x25, 0xc0,
-    0x98, 0x0, 0x87, 0x66, 0xd8, 0x0, 0x5c, 0xe0,
-    0x64, 0xe0, 0x6, 0x98, 0x8a, 0xfa, 0x68, 0x2,
-    0x8e, 0x20,
+    0x7f, 0x80, 0x1, 0x0, 0x39, 0x7e, 0x1, 0x52,
+    0x1, 0x12, 0x3f, 0x92, 0x0, 0x10, 0x7f, 0x90,
+    0x1, 0x10, 0x39, 0x8, 0x5, 0x28, 0x1, 0x4,
+    0x39, 0x44, 0x6, 0x82,
 
     /* U+6B64 "此" */
-    0x0, 0xea, 0x0, 0xac, 0x3, 0xfe, 0x60, 0x9,
-    0x80, 0x3f, 0xf9, 0x8e, 0x1, 0xff, 0xc3, 0xb0,
-    0xf, 0xe5, 0xd3, 0x0, 0xf0, 0xdd, 0x8c, 0xf,
-    0x3f, 0xc, 0x3, 0xc3, 0x76, 0x30, 0x8f, 0xa1,
-    0x0, 0xff, 0xe0, 0x59, 0x80, 0x7f, 0xf9, 0x84,
-    0xc0, 0x3f, 0xf8, 0x4b, 0x60, 0x18, 0x86, 0x2d,
-    0x44, 0x3, 0x16, 0x84, 0x9e, 0xc5, 0x65, 0x2d,
-    0xe5, 0xdd, 0x48, 0x15, 0xdb, 0x4e, 0x82, 0xf,
-    0x97, 0x76, 0x8,
+    0x4, 0x40, 0x4, 0x40, 0x4, 0x40, 0x4, 0x40,
+    0x24, 0x44, 0x27, 0x58, 0x24, 0x60, 0x24, 0x40,
+    0x24, 0x40, 0x24, 0x40, 0x24, 0x40, 0x24, 0x41,
+    0x27, 0x40, 0x78, 0x3e, 0x0, 0x0,
 
     /* U+6B65 "步" */
-    0x0, 0xf9, 0x54, 0x1, 0xfe, 0x51, 0x0, 0x19,
-    0x80, 0x3f, 0xd8, 0x40, 0x15, 0xdf, 0x20, 0x7,
-    0xfa, 0xef, 0x90, 0x2, 0x11, 0x3, 0x88, 0xff,
-    0x80, 0x17, 0x63, 0xeb, 0xbf, 0xf0, 0x2, 0xaa,
-    0xfa, 0xaf, 0xa6, 0xa8, 0x1, 0x9f, 0x40, 0x3e,
-    0xf0, 0xe, 0x8e, 0x80, 0xf, 0x3d, 0x80, 0x68,
-    0xf9, 0x0, 0xf1, 0xdb, 0x80, 0x68, 0x70, 0x1,
-    0xd7, 0xba, 0x7e, 0x80, 0x7f, 0x1d, 0x44, 0x3f,
-    0x44, 0x3, 0xf0, 0xad, 0x53, 0x6c, 0x40, 0x3e,
-    0x7c, 0xa2, 0x8b, 0x40, 0xf, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x10, 0xf8, 0x10, 0x0,
+    0x10, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x8, 0x8,
+    0x30, 0x0, 0x40, 0x10, 0x3, 0x20, 0x0, 0xc0,
+    0x3, 0x0, 0x18, 0x0,
 
     /* U+6BCF "每" */
-    0x0, 0xca, 0x1, 0xff, 0xc2, 0x29, 0x0, 0xff,
-    0xe1, 0x40, 0x4c, 0xff, 0x28, 0x4, 0x81, 0xd7,
-    0x7f, 0xca, 0x0, 0x18, 0xb2, 0x2f, 0xf0, 0x5,
-    0xbe, 0x59, 0x79, 0x77, 0xd8, 0x1, 0xb0, 0xef,
-    0xee, 0x1e, 0x2e, 0xe6, 0x10, 0xe, 0x22, 0x2,
-    0x6c, 0xa8, 0x0, 0x44, 0x0, 0x19, 0x92, 0x44,
-    0xca, 0xf, 0xa6, 0x4b, 0x32, 0x11, 0x44, 0xa,
-    0x2f, 0xa2, 0x15, 0x10, 0x28, 0x80, 0x80, 0x83,
-    0x9, 0x12, 0x88, 0x46, 0x71, 0x10, 0x4, 0xba,
-    0x0, 0x5b, 0xa2, 0x0, 0x38, 0x7, 0x1d, 0x5d,
-    0xe2, 0x9b, 0xb1, 0xdb, 0x80, 0x47, 0x97, 0x7f,
-    0x43, 0x5b, 0x80, 0x48, 0x20, 0x1d, 0x15, 0xf4,
-    0x1, 0xff, 0xc0, 0x8a, 0xc3, 0x0, 0x80,
+    0x0, 0x0, 0x8, 0x0, 0x1f, 0xfc, 0x10, 0x0,
+    0x20, 0x0, 0x4f, 0xf8, 0x11, 0x8, 0x10, 0x88,
+    0x7f, 0xfe, 0x10, 0x8, 0x11, 0x8, 0x0, 0x88,
+    0x1f, 0xfc, 0x0, 0x8, 0x0, 0x70, 0x0, 0x0,
 
     /* U+6BD4 "比" */
-    0x0, 0xac, 0x3, 0xac, 0x3, 0xf9, 0xc0, 0x39,
-    0xc0, 0x3f, 0xfa, 0xc7, 0x88, 0x1, 0x8f, 0x32,
-    0x60, 0x0, 0xcc, 0xb9, 0x0, 0x31, 0xe6, 0x4c,
-    0x7, 0x55, 0x10, 0x7, 0xfc, 0x76, 0x60, 0x1f,
-    0xff, 0x61, 0x90, 0xe, 0x48, 0xb2, 0x0, 0xe3,
-    0x0, 0x2c, 0x1e, 0x65, 0x64, 0x24, 0x23, 0x56,
-    0x1, 0x67, 0xe4, 0x20, 0x2, 0x6e, 0x22, 0xf5,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x44,
+    0x1e, 0x58, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40,
+    0x10, 0x40, 0x10, 0x40, 0x10, 0x41, 0x13, 0x41,
+    0x3c, 0x42, 0x0, 0x3c,
 
     /* U+6C11 "民" */
-    0x0, 0x65, 0xdf, 0xf8, 0x2, 0x25, 0xbb, 0xfe,
-    0x70, 0xf, 0xfe, 0xb3, 0xdd, 0xee, 0xcb, 0xb9,
-    0x0, 0x33, 0xdd, 0xe7, 0xeb, 0xba, 0x0, 0x3f,
-    0xb9, 0xc0, 0x3f, 0x3d, 0xde, 0xa8, 0xbb, 0xe1,
-    0x0, 0x3d, 0xde, 0xd1, 0xbb, 0xe1, 0x0, 0xfc,
-    0xa4, 0x1, 0xff, 0xc1, 0xa8, 0x0, 0xff, 0xe0,
-    0x99, 0x90, 0x0, 0x4c, 0xc, 0x4f, 0x39, 0x8b,
-    0x9, 0x84, 0x7, 0x7, 0xe3, 0x2a, 0xcc, 0x58,
-    0x3, 0x75, 0x92, 0xe0,
+    0x3f, 0xf8, 0x40, 0x10, 0x80, 0x21, 0x0, 0x43,
+    0xff, 0x84, 0x20, 0x8, 0x0, 0x1f, 0xfe, 0x20,
+    0x80, 0x41, 0x0, 0x81, 0x1, 0x2, 0x2, 0xf2,
+    0xc, 0x3, 0x80,
 
     /* U+6C14 "气" */
-    0x0, 0xd4, 0x1, 0xff, 0xc2, 0x76, 0xbb, 0xfe,
-    0x70, 0x8, 0x7b, 0x2e, 0xff, 0x9c, 0x2, 0xa8,
-    0x9b, 0xbf, 0xcc, 0x1, 0x57, 0xc, 0xdd, 0xfe,
-    0x60, 0xb, 0xc6, 0xef, 0xf4, 0x80, 0x72, 0xa5,
-    0xdf, 0xe1, 0x30, 0xf, 0xfe, 0x17, 0xb0, 0x7,
-    0xff, 0x8, 0x8c, 0x3, 0xff, 0x84, 0xdc, 0x1,
-    0xff, 0xc2, 0x33, 0x0, 0x7f, 0xf0, 0xdc, 0x10,
-    0x80, 0x3f, 0xf8, 0x8, 0xa4, 0x20, 0x1f, 0xfc,
-    0x8, 0xea, 0x30,
+    0x8, 0x0, 0xf, 0xfc, 0x10, 0x0, 0x2f, 0xf8,
+    0x40, 0x0, 0x1f, 0xf0, 0x0, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x0, 0x8,
+    0x0, 0x8, 0x0, 0x6,
 
     /* U+6C34 "水" */
-    0x0, 0xf1, 0x40, 0x7, 0xff, 0x4, 0x44, 0x1,
-    0xff, 0xc2, 0x30, 0xc, 0x6e, 0x11, 0x77, 0x98,
-    0x14, 0x2, 0x2f, 0x60, 0x8a, 0xab, 0x0, 0x4,
-    0xa0, 0x5d, 0xc1, 0x0, 0x8, 0xd8, 0xe0, 0x98,
-    0x5d, 0xc2, 0x0, 0xe2, 0x1, 0x0, 0x7c, 0xe9,
-    0x0, 0x7a, 0x20, 0x1, 0x30, 0x88, 0x3, 0xc8,
-    0x26, 0x1, 0xbd, 0xc0, 0x38, 0xa6, 0x80, 0x39,
-    0x75, 0x0, 0x23, 0xfe, 0x10, 0xf, 0x57, 0xa8,
-    0x2, 0xbc, 0xc0, 0x3f, 0x57, 0xc8, 0xc9, 0x0,
-    0x7f, 0xd, 0x61, 0x80, 0x6b, 0xcf, 0xc0, 0xe,
-    0x52,
+    0x1, 0x0, 0x2, 0x0, 0x4, 0x7, 0xc8, 0x40,
+    0x11, 0x1, 0x34, 0x2, 0x50, 0x8, 0xa0, 0x11,
+    0x0, 0x42, 0x41, 0x4, 0x44, 0x8, 0x60, 0x10,
+    0x1, 0xc0, 0x0,
 
     /* U+6C99 "沙" */
-    0xb, 0x60, 0xf, 0x50, 0x7, 0xac, 0x28, 0x3,
-    0x8, 0x80, 0x3e, 0x6a, 0x0, 0x28, 0x6, 0x53,
-    0x0, 0xf9, 0x88, 0x3, 0x24, 0x0, 0x25, 0x80,
-    0x2a, 0x60, 0xc, 0x3a, 0xc1, 0x21, 0x80, 0xaa,
-    0x10, 0xe, 0x6a, 0x0, 0x36, 0x84, 0xc0, 0x7,
-    0xd4, 0x40, 0x1, 0xd, 0x10, 0xf, 0x5b, 0x10,
-    0x4, 0xe2, 0x3, 0x75, 0x80, 0x82, 0x1, 0x98,
-    0x40, 0x3, 0x76, 0x70, 0x88, 0x0, 0x6a, 0x60,
-    0xf, 0x64, 0x90, 0x4, 0xd6, 0x1, 0xc5, 0x94,
-    0xa0, 0x1a, 0xdc, 0x2, 0x3a, 0x9e, 0x60, 0xc,
-    0xb4, 0x0, 0x3c, 0xa9, 0xb2, 0x0, 0xe0,
+    0x40, 0x40, 0x20, 0x80, 0x1, 0x0, 0x2, 0x48,
+    0x44, 0x4, 0x88, 0x82, 0x10, 0x0, 0x24, 0x1,
+    0x88, 0x0, 0x20, 0x80, 0x80, 0x2, 0x4, 0x18,
+    0x0, 0xc0, 0x0,
 
     /* U+6CA1 "没" */
-    0x1, 0xb4, 0x0, 0xae, 0xf9, 0xc0, 0x30, 0xde,
-    0xc0, 0x1, 0xee, 0xf6, 0x0, 0x7a, 0x60, 0x5,
-    0xc0, 0x3f, 0xf8, 0x49, 0x80, 0x1e, 0x16, 0xa,
-    0x40, 0xa, 0x58, 0x3, 0xc5, 0xc1, 0x79, 0x41,
-    0x90, 0x20, 0x18, 0xea, 0x68, 0x6, 0x2c, 0x31,
-    0x0, 0x3a, 0x2a, 0x84, 0x1, 0x8, 0x2d, 0xed,
-    0xdf, 0x78, 0x7, 0x8d, 0x6d, 0xae, 0xf6, 0xb8,
-    0x7, 0x3b, 0x0, 0x3e, 0x0, 0x5, 0x50, 0x1,
-    0x86, 0xd4, 0x0, 0x9e, 0xe7, 0xda, 0x1, 0xd1,
-    0x0, 0xc, 0xb5, 0xb0, 0x20, 0x18, 0xc9, 0x0,
-    0x9, 0x31, 0xfe, 0xda, 0x30, 0x9, 0xe4, 0x17,
-    0xe, 0xe8, 0x86, 0x62, 0xf0, 0xc0,
+    0x21, 0xf0, 0x19, 0x8, 0x1, 0x8, 0x0, 0x8,
+    0x42, 0x9, 0x34, 0xe, 0x0, 0x0, 0x3, 0xfc,
+    0x1, 0x4, 0x0, 0x88, 0x10, 0x10, 0x20, 0x60,
+    0x21, 0x98, 0x4, 0x6,
 
     /* U+6CB3 "河" */
-    0x1, 0x97, 0x1b, 0xcc, 0xfb, 0xf0, 0x80, 0x64,
-    0xda, 0xf3, 0x3e, 0x4c, 0x20, 0x9, 0x1c, 0x3,
-    0xff, 0xa1, 0x2, 0x1, 0x55, 0xdd, 0x40, 0x1e,
-    0xcd, 0x60, 0x0, 0xdd, 0xc2, 0x1, 0xe4, 0xc5,
-    0x0, 0xff, 0xe1, 0x98, 0x7, 0xff, 0x11, 0x0,
-    0x3f, 0xf8, 0x50, 0x20, 0xd7, 0x76, 0x0, 0x7c,
-    0x26, 0xa1, 0x97, 0x73, 0x80, 0x7d, 0x70, 0x0,
-    0x10, 0xf, 0xf2, 0x99, 0x80, 0x3f, 0xf8, 0x50,
-    0x1, 0xe1, 0xcc, 0x84, 0x0,
+    0x27, 0xfe, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4,
+    0x43, 0xe4, 0x22, 0x24, 0x2, 0x24, 0x2, 0x24,
+    0x2, 0x24, 0x13, 0xc4, 0x10, 0x4, 0x20, 0x4,
+    0x20, 0x4, 0x0, 0x3c,
 
     /* U+6CBB "治" */
-    0x1, 0xb6, 0x0, 0xcc, 0xa0, 0x1f, 0xd, 0x8d,
-    0x0, 0x54, 0xa0, 0x1f, 0xcf, 0x40, 0x4, 0x50,
-    0x2, 0x98, 0x7, 0xfb, 0xec, 0x0, 0x90, 0x20,
-    0x15, 0x28, 0x4, 0x64, 0x40, 0x0, 0xcd, 0x0,
-    0x54, 0x58, 0x33, 0xcb, 0x77, 0xa5, 0xe0, 0x2,
-    0x7c, 0x1b, 0xfd, 0xbb, 0xec, 0x31, 0x0, 0xe2,
-    0x20, 0x80, 0x7a, 0xc4, 0x3, 0x20, 0x4d, 0xdf,
-    0xa8, 0x3, 0x94, 0xc0, 0xae, 0xfc, 0xc0, 0x1d,
-    0x2e, 0x1, 0xff, 0xc1, 0x6b, 0x0, 0xff, 0xe0,
-    0x8d, 0x38, 0x7, 0xff, 0x5, 0xa0, 0x3, 0x55,
-    0x79, 0xc0, 0x0,
+    0x20, 0x0, 0x8, 0x80, 0x0, 0x80, 0x1, 0x8,
+    0x41, 0x4, 0x17, 0xfe, 0x0, 0x2, 0x0, 0x0,
+    0x3, 0xfc, 0x2, 0x4, 0x12, 0x4, 0x2, 0x4,
+    0x22, 0x4, 0x3, 0xfc,
 
     /* U+6CD5 "法" */
-    0x1, 0xc6, 0x0, 0xe6, 0x50, 0xf, 0xe, 0x6,
-    0x0, 0x7f, 0xf0, 0x9b, 0xa, 0xef, 0x45, 0xdc,
-    0x60, 0x1e, 0x2b, 0xbd, 0x17, 0x71, 0x80, 0x29,
-    0xc4, 0x3, 0xff, 0x83, 0x45, 0xa2, 0x1, 0xff,
-    0xc1, 0x5c, 0x1a, 0xad, 0x73, 0x55, 0x80, 0x3d,
-    0x57, 0x60, 0x9d, 0xbb, 0xa8, 0x3, 0x9c, 0x4,
-    0x4c, 0x82, 0x38, 0x3, 0x9c, 0x80, 0xd, 0x40,
-    0x2, 0x90, 0xe, 0x1c, 0x50, 0x6, 0xb0, 0x0,
-    0x85, 0x80, 0x34, 0x78, 0x1, 0xc, 0x3, 0x4d,
-    0x90, 0x0, 0xc9, 0x2, 0x64, 0xb9, 0x95, 0xd9,
-    0x24, 0x2, 0x90, 0x4, 0x66, 0xe6, 0x57, 0x52,
-    0x62,
+    0x20, 0x0, 0x8, 0x0, 0x3, 0xfc, 0x0, 0x0,
+    0x40, 0x0, 0x10, 0x0, 0x7, 0xfe, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x8, 0x11, 0x8, 0x21, 0x4,
+    0x27, 0xfe, 0x0, 0x2,
 
     /* U+6D3B "活" */
-    0x0, 0xff, 0xe2, 0x95, 0xa0, 0x6, 0x24, 0x7a,
-    0xb9, 0x0, 0x8a, 0xf2, 0x42, 0x6a, 0x99, 0xb5,
-    0x72, 0x1, 0xd1, 0x21, 0x35, 0x14, 0x60, 0x1f,
-    0xfc, 0xa9, 0x20, 0x5, 0x5d, 0xdc, 0xf7, 0x78,
-    0x1, 0x71, 0x21, 0x57, 0x77, 0x3d, 0xde, 0x0,
-    0x15, 0x58, 0x7, 0xff, 0xc, 0x80, 0x3f, 0xf8,
-    0x8a, 0xf, 0x76, 0x95, 0xbb, 0x50, 0x7, 0x31,
-    0x86, 0x5d, 0xd9, 0x76, 0x10, 0xe, 0xa6, 0x0,
-    0xff, 0xe0, 0xbd, 0x0, 0x7f, 0xf0, 0x4a, 0xd8,
-    0x3, 0xf9, 0xc0, 0x2a, 0x80, 0xd, 0x77, 0xe1,
-    0x0, 0xa1, 0x0, 0x2b, 0xbf, 0xb4, 0x0,
+    0x0, 0x0, 0x20, 0x1c, 0x1b, 0xe0, 0x0, 0x20,
+    0x0, 0x20, 0x47, 0xfe, 0x30, 0x20, 0x0, 0x20,
+    0x0, 0x20, 0x1, 0xfc, 0x2, 0x4, 0x12, 0x4,
+    0x2, 0x4, 0x22, 0x4, 0x43, 0xfc, 0x0, 0x0,
 
     /* U+6D41 "流" */
-    0x2, 0xb4, 0x0, 0xe9, 0x10, 0xf, 0x15, 0x73,
-    0x80, 0x63, 0x30, 0x7, 0xc3, 0x4d, 0x57, 0x6d,
-    0x79, 0xbb, 0xc0, 0x1c, 0x35, 0x76, 0x6c, 0xb8,
-    0x9b, 0xb0, 0x2, 0x4c, 0x3, 0x2e, 0x8, 0x1c,
-    0x98, 0x5, 0x13, 0x20, 0x47, 0xbf, 0x89, 0x90,
-    0x69, 0x0, 0x6, 0xac, 0x1c, 0xea, 0xea, 0x21,
-    0x7f, 0x0, 0x18, 0x80, 0xc9, 0x8d, 0x44, 0x50,
-    0x34, 0x1, 0x85, 0x3, 0x84, 0x34, 0x40, 0xc0,
-    0x3d, 0xe, 0x0, 0x10, 0xf, 0xf1, 0x10, 0xc0,
-    0x88, 0x1, 0xfe, 0x88, 0x0, 0x4, 0x3, 0xe3,
-    0x20, 0x30, 0x30, 0x9e, 0x0, 0xf9, 0x84, 0x16,
-    0x1, 0x45, 0x40, 0x1c, 0x21, 0x95, 0xe6,
+    0x20, 0x40, 0x10, 0x40, 0x7, 0xfe, 0x0, 0x80,
+    0x40, 0x8, 0x31, 0xfc, 0x0, 0x2, 0x0, 0x8,
+    0x2, 0x48, 0x12, 0x48, 0x12, 0x48, 0x22, 0x48,
+    0x24, 0x48, 0x4, 0x6,
 
     /* U+6D77 "海" */
-    0x4, 0xa2, 0x0, 0x1c, 0x0, 0x7f, 0x24, 0x71,
-    0x4, 0xd8, 0x7, 0xf8, 0xb0, 0x85, 0xe2, 0xef,
-    0xd2, 0x1, 0xea, 0xeb, 0xbf, 0xa4, 0xa, 0x44,
-    0x14, 0x9a, 0xed, 0x97, 0x73, 0x80, 0xa, 0xb5,
-    0x11, 0x3d, 0x76, 0xaf, 0xbb, 0x60, 0x4, 0x78,
-    0xa2, 0x1, 0xb9, 0x80, 0x3f, 0xb, 0x52, 0xd5,
-    0x16, 0x6a, 0x8b, 0x42, 0x1, 0x1b, 0xf3, 0xdd,
-    0x9a, 0xae, 0x16, 0x84, 0x2, 0xf1, 0x17, 0x88,
-    0xf0, 0x10, 0x6, 0x44, 0x6, 0xa8, 0x7, 0x8,
-    0x80, 0x37, 0xc8, 0x14, 0x5d, 0x9e, 0xed, 0xeb,
-    0x60, 0x4, 0x21, 0xf, 0xbb, 0xb6, 0xec, 0x9d,
-    0x60, 0x3, 0x80, 0x2, 0x80, 0x45, 0x54, 0x33,
-    0x0, 0x4e, 0x20, 0x1e, 0x2a, 0xa5, 0x80, 0x40,
+    0x21, 0x0, 0x12, 0x0, 0x3, 0xfe, 0x4, 0x0,
+    0x45, 0xf8, 0x22, 0x4, 0x2, 0x44, 0x7, 0xfe,
+    0x2, 0x44, 0x10, 0x44, 0x14, 0x44, 0x27, 0xfe,
+    0x20, 0x8, 0x0, 0x38, 0x0, 0x0,
 
     /* U+6DF1 "深" */
-    0x2, 0xb4, 0x7, 0xbb, 0x6d, 0xdb, 0xae, 0xd4,
-    0x0, 0x2a, 0xe6, 0xdb, 0xb3, 0xd5, 0xad, 0xd8,
-    0x40, 0x21, 0xa6, 0x0, 0x98, 0x40, 0x31, 0x80,
-    0x7a, 0x80, 0x98, 0x3, 0xa0, 0x1, 0x26, 0x1,
-    0x17, 0x40, 0x1, 0xc0, 0x10, 0x21, 0x75, 0x40,
-    0x68, 0xe2, 0x10, 0xaa, 0x80, 0x40, 0xa6, 0x81,
-    0xa8, 0x81, 0x91, 0xaa, 0x90, 0x1, 0xfe, 0xf1,
-    0x0, 0xff, 0x55, 0x56, 0xf5, 0x75, 0x50, 0x6,
-    0x93, 0xaa, 0x85, 0x5f, 0x2a, 0xa0, 0x8, 0x48,
-    0xc0, 0x13, 0xfb, 0x9e, 0xa0, 0x1d, 0x1e, 0x3,
-    0x58, 0xa0, 0x8, 0xf6, 0x0, 0x88, 0x88, 0x8a,
-    0x95, 0x0, 0xd5, 0xd4, 0x0, 0xa8, 0x4, 0xb3,
-    0x0, 0xb, 0x80, 0x22, 0x0,
+    0x23, 0xfe, 0x14, 0x92, 0x4, 0x92, 0x0, 0x90,
+    0x41, 0x12, 0x32, 0xe, 0x0, 0x0, 0x0, 0x40,
+    0x7, 0xfe, 0x10, 0xe0, 0x11, 0x10, 0x22, 0x8,
+    0x24, 0x6, 0x40, 0x0,
 
     /* U+6E05 "清" */
-    0x2, 0xb3, 0x0, 0xe5, 0x50, 0x7, 0x8a, 0xa1,
-    0x92, 0xaa, 0x99, 0x55, 0x4e, 0x1, 0xd, 0xba,
-    0x11, 0x4e, 0xe2, 0x29, 0x40, 0x38, 0x42, 0x66,
-    0xcc, 0x4c, 0xc4, 0x0, 0xb6, 0x0, 0x3b, 0x35,
-    0xba, 0x66, 0x9c, 0x42, 0xc6, 0xc1, 0x13, 0x4c,
-    0x91, 0x30, 0x80, 0x1e, 0xc0, 0xc6, 0x67, 0xc8,
-    0x60, 0x1f, 0x54, 0xd5, 0x76, 0x0, 0x71, 0x28,
-    0x2, 0x26, 0x79, 0x40, 0x3a, 0x1c, 0x1, 0x13,
-    0x3c, 0xa0, 0x18, 0xc0, 0x80, 0x13, 0x3e, 0x50,
-    0xd, 0x10, 0x0, 0xa6, 0x7c, 0x40, 0x12, 0x91,
-    0x0, 0x3f, 0x9c, 0x3, 0x40, 0x6, 0x10, 0x9,
-    0xe8, 0x3, 0x28, 0x80, 0x50, 0x40, 0x13, 0xd5,
-    0x80, 0x0,
+    0x20, 0x0, 0x13, 0xfc, 0x3, 0xfc, 0x0, 0x0,
+    0x40, 0x60, 0x10, 0x0, 0x1, 0xf8, 0x2, 0x4,
+    0x3, 0xfc, 0x12, 0x4, 0x13, 0xfc, 0x22, 0x4,
+    0x22, 0x4, 0x2, 0xc, 0x0, 0x0,
 
     /* U+706B "火" */
-    0x0, 0xfa, 0x44, 0x3, 0xff, 0x82, 0x46, 0x1,
-    0xff, 0xc7, 0x10, 0xd, 0x60, 0x1f, 0xda, 0x20,
-    0x1, 0x70, 0xf, 0xc8, 0x81, 0x0, 0x32, 0x0,
-    0x7e, 0x89, 0x0, 0xd, 0x48, 0x4, 0xcc, 0x0,
-    0x3d, 0x8, 0x1, 0xb8, 0x40, 0x4, 0xda, 0x0,
-    0x56, 0x0, 0x9c, 0xc0, 0x2b, 0x82, 0x10, 0x20,
-    0xf, 0xc4, 0x43, 0xf8, 0x0, 0xff, 0x4d, 0x2,
-    0x3, 0x0, 0x7c, 0x39, 0xe2, 0x0, 0x9d, 0x60,
-    0xe, 0x5d, 0xe4, 0x0, 0xd7, 0xf6, 0x60, 0xb,
-    0x3c, 0x20, 0xf, 0x4c, 0xa1, 0xc0,
+    0x1, 0x0, 0x2, 0x0, 0x4, 0x0, 0x88, 0x21,
+    0x10, 0x42, 0x21, 0x8, 0x40, 0x0, 0xc0, 0x2,
+    0x80, 0x4, 0x80, 0x11, 0x0, 0x41, 0x1, 0x1,
+    0x88, 0x0, 0x80,
 
     /* U+70B9 "点" */
-    0x0, 0xf0, 0xd0, 0x7, 0xff, 0x9, 0x2a, 0xba,
-    0x0, 0x3f, 0x2d, 0xdf, 0x40, 0x7, 0xe1, 0x1f,
-    0x0, 0x66, 0x99, 0xad, 0xe6, 0x71, 0x80, 0x6a,
-    0xbb, 0xa3, 0xee, 0xed, 0x90, 0xc, 0xe4, 0x5f,
-    0x94, 0x3, 0xff, 0x90, 0xe2, 0x3f, 0x8c, 0x3,
-    0xae, 0xff, 0xa2, 0x40, 0x32, 0x55, 0x7f, 0x10,
-    0x4, 0x74, 0x0, 0xa0, 0x2, 0xa8, 0x1, 0x42,
-    0x0, 0x88, 0x0, 0x18, 0x0, 0xbc, 0x0, 0x9a,
-    0x8, 0xf1, 0x0, 0x28, 0x80, 0x4, 0x40, 0x58,
-    0x70, 0x80, 0x14, 0x88, 0x2, 0x84, 0x0, 0xe6,
+    0x1, 0x0, 0x3, 0xf8, 0x4, 0x0, 0x8, 0x1,
+    0xff, 0x4, 0x1, 0x8, 0x2, 0x10, 0x4, 0x20,
+    0x8, 0x3f, 0xe0, 0x0, 0x1, 0x20, 0x44, 0x44,
+    0x50, 0x88, 0x0, 0x0, 0x0,
 
     /* U+7136 "然" */
-    0x0, 0xc2, 0x1, 0xff, 0xc2, 0x28, 0x0, 0xe3,
-    0x75, 0x70, 0xe, 0xb2, 0xaa, 0x60, 0x5, 0xeb,
-    0xea, 0x1, 0x19, 0x5d, 0x5b, 0x80, 0x74, 0x30,
-    0x5, 0x19, 0x44, 0xf9, 0x76, 0xf6, 0xbb, 0x48,
-    0x2, 0xf1, 0xea, 0xec, 0xd7, 0x6a, 0x3b, 0xb5,
-    0x1, 0xf7, 0xc8, 0x6a, 0x8, 0x3, 0xc0, 0x40,
-    0x23, 0x58, 0xab, 0x88, 0x0, 0x4b, 0x32, 0x0,
-    0xf1, 0x87, 0x88, 0x2, 0x64, 0x86, 0x40, 0x18,
-    0x6f, 0xcc, 0x1, 0x22, 0xa1, 0x3c, 0x20, 0x4,
-    0xd8, 0x40, 0x5, 0xfc, 0x0, 0xa, 0x30, 0x40,
-    0x18, 0x60, 0x15, 0xb0, 0x6, 0x4d, 0x10, 0x46,
-    0x50, 0x25, 0x0, 0x50, 0x1, 0x24, 0x3, 0x6a,
-    0x80, 0x30, 0x0, 0x48, 0x8, 0x2a, 0x0, 0x98,
-    0x0, 0x10, 0x5, 0x58, 0x0, 0x8e, 0x0,
+    0x0, 0x0, 0x8, 0x0, 0x1f, 0x14, 0x11, 0x10,
+    0x28, 0xfe, 0x46, 0x10, 0x32, 0x30, 0xc, 0x28,
+    0x8, 0x48, 0x10, 0xc4, 0x21, 0x2, 0x0, 0x0,
+    0x0, 0x44, 0x22, 0x44, 0x42, 0x22,
 
     /* U+7167 "照" */
-    0x0, 0xff, 0xe2, 0x65, 0xdc, 0x15, 0x79, 0xb7,
-    0x6c, 0x50, 0x25, 0xbb, 0x0, 0x2a, 0xed, 0x37,
-    0x68, 0x20, 0xf, 0xeb, 0x40, 0x1, 0x10, 0x3,
-    0xe2, 0xb8, 0x2, 0x3d, 0x70, 0x3, 0xdd, 0x94,
-    0xe2, 0x50, 0x19, 0x38, 0x80, 0xf, 0x76, 0x53,
-    0x9b, 0x99, 0x6f, 0x10, 0x7, 0xe9, 0xb8, 0x8d,
-    0xa2, 0x1, 0xf8, 0xc4, 0x70, 0x6, 0x56, 0x63,
-    0x80, 0x7f, 0xf0, 0xbc, 0x3e, 0xea, 0xb0, 0x8,
-    0x16, 0xab, 0x18, 0x2d, 0x56, 0x9b, 0x0, 0x91,
-    0x0, 0x8c, 0x0, 0xb1, 0x0, 0x50, 0x0, 0x65,
-    0xc1, 0xb8, 0x1, 0xae, 0x7, 0x8c, 0x11, 0xe0,
-    0x2, 0x10, 0x3, 0xf8, 0x1, 0xf4, 0x0,
+    0x0, 0x0, 0xf7, 0xf1, 0x20, 0x2, 0x44, 0x4,
+    0x90, 0x8f, 0x40, 0x12, 0x7c, 0x25, 0x4, 0x4a,
+    0x8, 0x94, 0x11, 0x7, 0xe0, 0x0, 0x0, 0x8,
+    0x88, 0x80, 0x21, 0x11, 0x0,
 
     /* U+722C "爬" */
-    0x0, 0xc4, 0xb3, 0x84, 0x1, 0xfd, 0x79, 0x63,
-    0x6a, 0x57, 0x6e, 0xbb, 0x40, 0x6, 0xcf, 0x43,
-    0x0, 0xad, 0x2e, 0xc6, 0x1, 0xd8, 0x1, 0xff,
-    0xc5, 0x13, 0x0, 0xff, 0xe2, 0xad, 0xa5, 0xd8,
-    0xc0, 0x3f, 0x8, 0x2d, 0xf5, 0xda, 0x0, 0x21,
-    0x0, 0xff, 0xe4, 0x19, 0x80, 0x39, 0x44, 0x8,
-    0xc0, 0x35, 0xd0, 0x7, 0x78, 0x0, 0x78, 0x3,
-    0x19, 0xd, 0xde, 0x21, 0x5, 0x30, 0xe, 0xa6,
-    0x8b, 0xba, 0x0, 0x18, 0xa0, 0x1c, 0x3b, 0x14,
-    0x60, 0x18, 0x44, 0x6, 0x1, 0x86, 0xe6, 0xee,
-    0x10, 0x90, 0x4, 0x80, 0x78, 0xe2, 0xec, 0x20,
+    0x3, 0x0, 0x39, 0x7e, 0x21, 0x52, 0x29, 0x52,
+    0x29, 0x52, 0x29, 0x7e, 0x29, 0x40, 0x29, 0x40,
+    0x29, 0x40, 0x28, 0xc2, 0x8, 0xfe, 0x8, 0x40,
+    0x48, 0x30, 0x48, 0xe, 0x0, 0x0,
 
     /* U+7247 "片" */
-    0x0, 0x58, 0x7, 0x58, 0x7, 0xce, 0x1, 0xce,
-    0x1, 0xff, 0xc9, 0x2a, 0xad, 0x65, 0x55, 0x8c,
-    0x0, 0x57, 0x7a, 0xbe, 0xef, 0x18, 0x4, 0x23,
-    0xfe, 0x0, 0xff, 0xe2, 0x9e, 0x67, 0xce, 0x1,
-    0x89, 0x73, 0x3e, 0xb0, 0xc, 0xda, 0x1, 0xff,
-    0xc0, 0xc3, 0x0, 0xff, 0xe0, 0x22, 0x0, 0x3f,
-    0xe5, 0x40, 0xf, 0xfe, 0x7, 0xc0, 0x7, 0xe7,
-    0x0, 0x80,
+    0x20, 0x80, 0x82, 0x2, 0x8, 0xf, 0xfe, 0x20,
+    0x0, 0x80, 0x2, 0x0, 0xf, 0xf0, 0x20, 0x20,
+    0x0, 0x84, 0x2, 0x10, 0x8, 0x40, 0x22, 0x0,
+    0x80,
 
     /* U+725B "牛" */
-    0x0, 0xc2, 0x0, 0x13, 0x0, 0xff, 0x1c, 0x0,
-    0xa, 0x80, 0x3f, 0xd5, 0x40, 0xf, 0xfe, 0x8,
-    0xb7, 0xe6, 0x3d, 0xf3, 0x35, 0x88, 0x5, 0x17,
-    0x99, 0x7b, 0xe6, 0x6b, 0x10, 0x2, 0x1a, 0x0,
-    0x7f, 0xf0, 0x46, 0xc0, 0x3f, 0xf8, 0x4a, 0x20,
-    0x1f, 0xfc, 0x2b, 0xcc, 0xee, 0x7c, 0xce, 0xb0,
-    0x5, 0xe6, 0x77, 0x3e, 0x67, 0x58, 0x7, 0xff,
-    0xf0, 0x44, 0x1, 0xf0,
+    0x0, 0x0, 0x8, 0x80, 0x10, 0x80, 0x1f, 0xfc,
+    0x20, 0x80, 0x20, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x7f, 0xfe, 0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
+    0x0, 0x80, 0x0, 0x80, 0x0, 0x80,
 
     /* U+7269 "物" */
-    0x0, 0x10, 0x48, 0x4, 0x6e, 0x1, 0xf0, 0xc0,
-    0x98, 0x5, 0x68, 0x1, 0xf1, 0x68, 0x7, 0x2a,
-    0x3b, 0xe6, 0x0, 0x2d, 0xea, 0x5a, 0x2d, 0x25,
-    0xa7, 0xe, 0x10, 0x66, 0x35, 0x2d, 0x39, 0xc1,
-    0xc, 0x98, 0xc0, 0x2, 0x1, 0xa7, 0xc2, 0xa8,
-    0x1, 0x19, 0x82, 0x80, 0x34, 0x20, 0x99, 0x26,
-    0x0, 0x88, 0x4, 0x9, 0xed, 0x82, 0x24, 0x39,
-    0x81, 0xc0, 0x11, 0x92, 0xd6, 0xe6, 0x6, 0x23,
-    0x0, 0x6b, 0xcb, 0x10, 0x2f, 0x80, 0x6e, 0x0,
-    0xe3, 0x0, 0xc3, 0xa2, 0x2b, 0x50, 0x16, 0x0,
-    0xf8, 0xc4, 0x2e, 0x0, 0xa, 0x40, 0x1f, 0xce,
-    0x48, 0x0, 0xdc, 0x0, 0xc2, 0x60, 0x4, 0xd8,
-    0xb, 0xc2, 0x40, 0xe, 0x90, 0x2, 0x50, 0x2,
-    0xf2, 0xc0, 0x0,
+    0x8, 0x0, 0x28, 0x80, 0x8, 0x80, 0x3c, 0x2a,
+    0x49, 0x2a, 0x4a, 0x4a, 0x8, 0x42, 0xc, 0x92,
+    0x78, 0x92, 0x9, 0x2, 0x8, 0x22, 0x8, 0x42,
+    0x8, 0x44, 0x8, 0x9c, 0x0, 0x0,
 
     /* U+7279 "特" */
-    0x0, 0xff, 0xe3, 0x18, 0x50, 0x7, 0x39, 0x80,
-    0x70, 0xc8, 0x88, 0x0, 0x68, 0x8d, 0x44, 0x88,
-    0x0, 0x5a, 0x1, 0x9c, 0x46, 0xf1, 0x18, 0x0,
-    0xb7, 0xab, 0x68, 0x85, 0x51, 0xe2, 0xa8, 0xc0,
-    0x19, 0xba, 0x5b, 0x40, 0xf, 0xf0, 0x88, 0x2,
-    0x7a, 0xa8, 0xbb, 0x72, 0x8c, 0x28, 0x3, 0x3d,
-    0x57, 0xa2, 0x8c, 0x4, 0xd, 0xaa, 0x4, 0x7b,
-    0xc4, 0x40, 0x7, 0xc8, 0x6a, 0xc8, 0x8e, 0x4e,
-    0x82, 0x4, 0xcb, 0x0, 0x26, 0xdc, 0xcd, 0x7f,
-    0x24, 0x6, 0x1, 0xcb, 0x22, 0x1, 0xff, 0xc1,
-    0x19, 0xb0, 0xf, 0xfe, 0x11, 0x58, 0x7, 0xf0,
-    0x88, 0x3, 0xc, 0xe5, 0xb0, 0x0,
+    0x0, 0x0, 0x8, 0x0, 0x28, 0x20, 0x8, 0x30,
+    0x3c, 0x20, 0x48, 0x20, 0x49, 0xfe, 0x8, 0x0,
+    0xe, 0x8, 0x39, 0xfe, 0x8, 0x0, 0x8, 0x80,
+    0x8, 0x40, 0x8, 0x0, 0x8, 0x38,
 
     /* U+73CD "珍" */
-    0x0, 0xfe, 0x6b, 0x0, 0xe1, 0xbb, 0x75, 0xd0,
-    0x0, 0xb2, 0x68, 0x3, 0xd, 0xd2, 0xdd, 0x0,
-    0xcd, 0x97, 0x48, 0x7, 0xf1, 0x54, 0x88, 0x26,
-    0x50, 0x7, 0xc9, 0x34, 0x41, 0x0, 0xb3, 0x84,
-    0x13, 0x4b, 0x79, 0x62, 0x55, 0x60, 0x3, 0xd2,
-    0x9, 0xa5, 0xb8, 0x8, 0xbb, 0x18, 0xa8, 0x8,
-    0x7, 0xea, 0x91, 0x16, 0xb8, 0x7, 0xf8, 0x81,
-    0x37, 0x88, 0x3, 0xe1, 0x61, 0x14, 0xee, 0x10,
-    0x52, 0x0, 0x12, 0x16, 0xcc, 0x52, 0xa4, 0x1,
-    0x4, 0x80, 0x39, 0x5d, 0x4a, 0xa, 0x60, 0x57,
-    0xd0, 0x0, 0x18, 0x30, 0xe, 0x39, 0x89, 0x60,
-    0xf, 0xe2, 0xcb, 0xaa, 0x10, 0x6,
+    0x0, 0x20, 0x7c, 0x50, 0x10, 0x88, 0x11, 0x4,
+    0x12, 0x22, 0x7c, 0x40, 0x11, 0x80, 0x10, 0x10,
+    0x10, 0x20, 0x10, 0xc4, 0x38, 0xc, 0x40, 0x10,
+    0x0, 0x60, 0x1, 0x80,
 
     /* U+7406 "理" */
-    0x0, 0xf2, 0x65, 0xdb, 0xae, 0xe8, 0x0, 0x5e,
-    0x75, 0xb1, 0xc5, 0xd9, 0x6e, 0xe3, 0x0, 0x5e,
-    0x2d, 0xb0, 0x7, 0xff, 0x16, 0x2a, 0x8b, 0x55,
-    0x0, 0x7f, 0x45, 0x51, 0x6a, 0xa0, 0x9, 0xe1,
-    0xa0, 0x80, 0x3f, 0xe3, 0xe1, 0xd3, 0x1, 0x18,
-    0x4, 0x60, 0x9, 0x19, 0xd4, 0x5b, 0x2e, 0xcb,
-    0x77, 0x78, 0x7, 0xc3, 0x35, 0x42, 0xaa, 0x90,
-    0x3, 0xe6, 0x99, 0x8a, 0x66, 0x80, 0x8, 0x5b,
-    0x1d, 0xa2, 0x22, 0x88, 0xa4, 0x6, 0xea, 0xf5,
-    0xc0, 0x46, 0x1, 0x1c, 0x3, 0x56, 0xc2, 0x1,
-    0xff, 0xc0, 0x10, 0xa, 0xae, 0xf1, 0xdd, 0xe4,
+    0x1, 0xfe, 0x78, 0x22, 0x10, 0x22, 0x11, 0xfe,
+    0x10, 0x22, 0x38, 0x22, 0x10, 0x22, 0x11, 0xfc,
+    0x10, 0x20, 0x11, 0xfe, 0x18, 0x20, 0x60, 0x20,
+    0x0, 0x20, 0x7, 0xfe,
 
     /* U+751F "生" */
-    0x0, 0xca, 0x0, 0x45, 0x0, 0xff, 0x1e, 0x0,
-    0x8, 0xc0, 0x3f, 0xd5, 0x40, 0xf, 0xfe, 0x8,
-    0xb4, 0xd5, 0x57, 0x55, 0xc6, 0x1, 0x4c, 0xae,
-    0xea, 0xa5, 0xdf, 0x18, 0x0, 0xd1, 0x84, 0x60,
-    0x11, 0xf0, 0x4, 0xbc, 0x1, 0xff, 0xc2, 0x62,
-    0x0, 0xff, 0xe1, 0x9e, 0x66, 0xbb, 0x66, 0x68,
-    0x0, 0xc7, 0x99, 0xae, 0xd9, 0x9a, 0x0, 0x3f,
-    0xfc, 0xf5, 0x77, 0xff, 0xc0, 0xa0, 0x5, 0x5d,
-    0xf6, 0xea, 0xef, 0xa8, 0x0,
+    0x0, 0x0, 0x8, 0x0, 0x10, 0x0, 0x1f, 0xfc,
+    0x20, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
 
     /* U+7528 "用" */
-    0x0, 0x36, 0x5d, 0xdf, 0x77, 0xd2, 0x0, 0xce,
-    0xbb, 0x8e, 0xef, 0x94, 0x3, 0xff, 0xa7, 0xd7,
-    0x71, 0xdd, 0xf0, 0x6, 0xeb, 0xb8, 0xee, 0xf8,
-    0x3, 0x18, 0x7, 0xff, 0x0, 0x40, 0x3f, 0xf8,
-    0x2f, 0x57, 0x71, 0xdd, 0xf0, 0x6, 0xbb, 0xc7,
-    0x77, 0xc0, 0x2, 0x60, 0xf, 0xfe, 0x2, 0xf8,
-    0x7, 0xfc, 0x36, 0xa0, 0x1f, 0xf3, 0x48, 0x7,
-    0x30, 0x2, 0xae, 0xe0,
+    0x1f, 0xfc, 0x84, 0x12, 0x10, 0x48, 0x41, 0x3f,
+    0xfc, 0x84, 0x12, 0x10, 0x48, 0x41, 0x3f, 0xfc,
+    0x84, 0x12, 0x10, 0x40, 0x41, 0x41, 0x4, 0x4,
+    0xe0,
 
     /* U+7531 "由" */
-    0x0, 0xe2, 0x80, 0xf, 0xfe, 0x0, 0x80, 0x7f,
-    0xf1, 0xef, 0x33, 0x73, 0xe6, 0x6d, 0x47, 0xcc,
-    0xdc, 0xf9, 0x9a, 0xc, 0x3, 0xff, 0x9c, 0x57,
-    0x7a, 0x5e, 0xef, 0x48, 0x15, 0x56, 0x84, 0xaa,
-    0xe0, 0x0, 0x8f, 0x18, 0x8e, 0x30, 0xf, 0xfe,
-    0x79, 0xe6, 0x6e, 0x7c, 0xcd, 0x0, 0x99, 0x9d,
-    0xd9, 0x9a, 0x46, 0xc0, 0x3f, 0xc8, 0xc0,
+    0x2, 0x0, 0x10, 0x0, 0x81, 0xff, 0xe8, 0x20,
+    0x41, 0x2, 0x8, 0x1f, 0xfe, 0x82, 0x4, 0x10,
+    0x20, 0x81, 0x4, 0xf, 0xff, 0x40, 0x0, 0x0,
+    0x0,
 
     /* U+753B "画" */
-    0xac, 0xce, 0xdd, 0x66, 0x75, 0x53, 0x33, 0xaa,
-    0x33, 0x3a, 0x80, 0x3f, 0xf8, 0x48, 0x40, 0xd5,
-    0x4b, 0xea, 0x95, 0x1, 0x5c, 0x60, 0xda, 0xa5,
-    0xf5, 0x4f, 0x1, 0x68, 0x7, 0x84, 0x40, 0x1f,
-    0xfc, 0xb6, 0xaa, 0xa2, 0xa8, 0xe0, 0x1e, 0x6a,
-    0xaa, 0x2a, 0x8e, 0x1, 0xe1, 0x0, 0xff, 0xe0,
-    0xed, 0xdb, 0x7e, 0xeb, 0x40, 0x3c, 0xf7, 0x7d,
-    0x4c, 0x1, 0xa2, 0xef, 0xfd, 0xe1, 0xfe, 0xbb,
-    0xff, 0x77, 0xb9, 0x80, 0x7f, 0x89, 0xc0,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x90,
+    0x26, 0x40, 0x99, 0x2, 0x67, 0xf9, 0x90, 0x26,
+    0x40, 0x98, 0xfc, 0x60, 0x1, 0xff, 0xfc, 0x0,
+    0x0, 0x0, 0x0,
 
     /* U+754C "界" */
-    0x0, 0x65, 0xde, 0xfb, 0xbd, 0x20, 0x11, 0x35,
-    0xde, 0x3b, 0xbc, 0xa0, 0x1f, 0xfc, 0x74, 0xaa,
-    0xc5, 0x55, 0x80, 0x39, 0x2a, 0xb1, 0x55, 0x60,
-    0xc, 0x60, 0x23, 0x80, 0x47, 0x0, 0x61, 0xd8,
-    0x87, 0xd2, 0xd5, 0xc4, 0xf8, 0x6, 0x78, 0x39,
-    0xb9, 0xb2, 0xd8, 0x30, 0x8, 0x5e, 0xb5, 0xc0,
-    0x2c, 0x1a, 0x50, 0x3, 0x59, 0xde, 0x90, 0x5,
-    0xcf, 0x41, 0x46, 0xd4, 0x80, 0xc4, 0x1, 0xe5,
-    0xa3, 0x0, 0x89, 0xc0, 0x3f, 0xf8, 0x7, 0xf2,
-    0x1, 0xff, 0x2c, 0x79, 0x0, 0x63, 0x30, 0x6,
+    0x3f, 0xf8, 0x42, 0x10, 0x84, 0x21, 0xff, 0xc2,
+    0x10, 0x84, 0x21, 0x7, 0xfc, 0x4, 0x20, 0x10,
+    0x10, 0x90, 0x88, 0x21, 0x0, 0x42, 0x1, 0x4,
+    0x4, 0x8, 0x0,
 
     /* U+767D "白" */
-    0x0, 0xc5, 0x40, 0x1f, 0xe8, 0x90, 0xf, 0x3e,
-    0x64, 0xdf, 0x99, 0xc1, 0x9b, 0x99, 0xf9, 0xc4,
-    0x3, 0xff, 0xb3, 0xb9, 0x9f, 0x90, 0x1, 0xb9,
-    0x9f, 0x90, 0x3, 0xff, 0xb5, 0xb9, 0x9f, 0x90,
-    0x7, 0x33, 0xf9, 0x46, 0x80, 0x3f, 0xa8, 0x0,
+    0x4, 0x0, 0x80, 0x7f, 0xe8, 0x2, 0x80, 0x28,
+    0x2, 0x80, 0x2f, 0xfe, 0x80, 0x28, 0x2, 0x80,
+    0x28, 0x2, 0xff, 0xe8, 0x2, 0x0, 0x0,
 
     /* U+767E "百" */
-    0x9c, 0xce, 0xed, 0xcc, 0xe9, 0x96, 0x67, 0x27,
-    0xe6, 0x74, 0x80, 0x79, 0x88, 0x3, 0xff, 0x80,
-    0xe0, 0x1f, 0xd5, 0x77, 0x3d, 0xde, 0xc1, 0x0,
-    0x9a, 0xee, 0xcb, 0xbc, 0x84, 0x1, 0xff, 0xd3,
-    0x2b, 0xbf, 0xcc, 0x1, 0x8a, 0xef, 0xf3, 0x0,
-    0x7f, 0xf5, 0xa, 0xef, 0xf3, 0x0, 0x64, 0xbb,
-    0xfc, 0xc0, 0x0,
+    0xff, 0xfc, 0x8, 0x0, 0x20, 0x0, 0x80, 0x3f,
+    0xf0, 0x80, 0x42, 0x1, 0x8, 0x4, 0x3f, 0xf0,
+    0x80, 0x42, 0x1, 0x8, 0x4, 0x3f, 0xf0, 0x80,
+    0x40,
 
     /* U+7684 "的" */
-    0x0, 0x88, 0x3, 0xff, 0x80, 0xaa, 0x0, 0xd0,
-    0x40, 0x1e, 0xf5, 0x0, 0xc8, 0x40, 0x19, 0x6d,
-    0x26, 0xd4, 0xc, 0xae, 0xf2, 0x7d, 0xf5, 0xdb,
-    0x82, 0x72, 0xee, 0x9d, 0x10, 0xe, 0x30, 0x20,
-    0x8, 0x44, 0x1, 0xe4, 0x80, 0xf, 0xfe, 0x3,
-    0x95, 0x8, 0x1, 0xfc, 0x2e, 0xf0, 0x5, 0x34,
-    0x0, 0x11, 0x5, 0xde, 0x0, 0x8f, 0x18, 0xc,
-    0xc0, 0x1f, 0xcf, 0xe0, 0x22, 0x0, 0xff, 0x48,
-    0x73, 0x0, 0x80, 0x7f, 0x88, 0xc2, 0xae, 0xd5,
-    0xe0, 0x1e, 0x71, 0x2b, 0xba, 0x90, 0x2, 0xab,
-    0xca, 0x9, 0x0, 0xfd, 0x57, 0x8c, 0x0,
+    0x0, 0x0, 0x2, 0x2, 0x8, 0x1e, 0x3e, 0x85,
+    0x6, 0x14, 0x18, 0x40, 0x61, 0x20, 0xfc, 0x42,
+    0x10, 0x8, 0x42, 0x21, 0x2, 0x84, 0xb, 0xe0,
+    0x28, 0x7, 0x0, 0x0,
 
     /* U+76F4 "直" */
-    0x0, 0xf1, 0x48, 0x7, 0xd3, 0x77, 0xdc, 0xf7,
-    0x7d, 0x41, 0x37, 0x7d, 0x51, 0x77, 0xd4, 0x0,
-    0x10, 0x4, 0x55, 0xed, 0x55, 0x0, 0x1a, 0x80,
-    0xc2, 0xb6, 0xea, 0xa2, 0x10, 0xf, 0xfe, 0x4a,
-    0xcc, 0xf9, 0xc0, 0x3e, 0x59, 0x9f, 0x38, 0x7,
-    0xcb, 0x33, 0xe7, 0x0, 0xf9, 0x66, 0x7c, 0xe0,
-    0x1e, 0x23, 0xaa, 0xf0, 0x88, 0x3, 0x86, 0xea,
-    0xbd, 0x60, 0x19, 0x6e, 0xff, 0xea, 0x0, 0x25,
-    0xdf, 0xfd, 0x40,
+    0x1, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0x84,
+    0x81, 0x9, 0x2, 0x13, 0xfc, 0x24, 0x8, 0x4f,
+    0xf0, 0x90, 0x21, 0x3f, 0xc2, 0x0, 0x7, 0xff,
+    0xc8, 0x0, 0x0,
 
     /* U+76F8 "相" */
-    0x0, 0x91, 0x80, 0x5, 0xb9, 0x9d, 0x0, 0x10,
-    0x88, 0x0, 0xf7, 0x99, 0xc8, 0x6, 0x85, 0xc8,
-    0x40, 0x1f, 0xd5, 0xd6, 0xbc, 0xa0, 0x1f, 0xd3,
-    0x4d, 0x74, 0xe1, 0x77, 0xe0, 0xc, 0x9c, 0x1,
-    0x5d, 0xf8, 0x2, 0x54, 0x42, 0x80, 0x7f, 0xdf,
-    0xea, 0xf3, 0x0, 0xfe, 0x42, 0x0, 0x5a, 0x5,
-    0xdf, 0x80, 0x11, 0x20, 0x1, 0x70, 0xbb, 0xf0,
-    0x15, 0x8, 0x7, 0xff, 0x0, 0x98, 0x3, 0xff,
-    0x93, 0x77, 0xe0, 0xc, 0x22, 0x0, 0xc, 0x5d,
-    0xf2, 0x80,
+    0x0, 0xfe, 0x0, 0x4, 0x20, 0xb, 0xe0, 0x11,
+    0xf, 0xe3, 0x0, 0x46, 0x0, 0x92, 0x1, 0x20,
+    0xfe, 0x80, 0x4, 0x0, 0x8, 0x0, 0x10, 0xf,
+    0xe0, 0x0, 0x40,
 
     /* U+770B "看" */
-    0x0, 0xff, 0xe2, 0xc4, 0xcd, 0x58, 0xec, 0xa8,
-    0x62, 0x1, 0x44, 0xcd, 0xb4, 0xec, 0xa8, 0x62,
-    0x1, 0x3d, 0x56, 0xda, 0xae, 0x90, 0x9, 0xea,
-    0x96, 0x37, 0x55, 0xd2, 0x1, 0xe6, 0xb0, 0xf,
-    0xe9, 0xaa, 0xa7, 0x6a, 0xbe, 0x90, 0x9a, 0xa1,
-    0x45, 0x57, 0xe9, 0x0, 0x95, 0xf2, 0xab, 0xd6,
-    0x60, 0x12, 0x71, 0xd5, 0x7d, 0xaa, 0x0, 0x7e,
-    0xb0, 0x99, 0xfa, 0x80, 0x22, 0xa0, 0x4, 0xcf,
-    0xd4, 0x1, 0x28, 0x5, 0x55, 0xf8, 0x3, 0xea,
-    0xaf, 0xc0, 0x1e, 0x7a, 0xaf, 0xc6, 0x0,
+    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x20, 0x0, 0x0, 0x1f, 0xff, 0x84, 0x0, 0xf,
+    0xf8, 0x30, 0x0, 0xbf, 0xe0, 0x40, 0x0, 0xff,
+    0x81, 0x0, 0x3, 0xfe, 0x0,
 
     /* U+771F "真" */
-    0x0, 0xf9, 0x94, 0x3, 0xf2, 0xdd, 0xfa, 0x2e,
-    0xf9, 0x40, 0xb, 0x77, 0xff, 0xc0, 0x50, 0xc,
-    0xb5, 0x32, 0xcc, 0x4c, 0xe0, 0xf, 0x64, 0x4c,
-    0xaa, 0x93, 0x32, 0x80, 0x7d, 0x13, 0x3f, 0x8,
-    0x7, 0xd1, 0x33, 0xf0, 0x80, 0x7d, 0x13, 0x3f,
-    0x8, 0x7, 0x87, 0xea, 0xbe, 0x10, 0xf, 0x40,
-    0xb3, 0x7d, 0xc0, 0x1a, 0xae, 0xdf, 0xdd, 0xf4,
-    0xdd, 0x0, 0x2a, 0xee, 0xfb, 0xbd, 0xf7, 0x75,
-    0x0, 0x65, 0xb3, 0x0, 0xc3, 0x52, 0x40, 0x13,
-    0xd9, 0xdb, 0x80, 0x65, 0xab, 0xb4, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0xf, 0xf8,
+    0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8,
+    0x10, 0x8, 0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0,
+    0x8, 0x18, 0x20, 0x6,
 
     /* U+773C "眼" */
-    0x8b, 0xba, 0x2, 0x2e, 0xfb, 0x0, 0x7, 0x77,
-    0x20, 0x25, 0xdf, 0x30, 0x80, 0x7f, 0xf2, 0xea,
-    0xb9, 0x0, 0x2b, 0xb8, 0x2, 0x88, 0xe5, 0x0,
-    0xae, 0xe0, 0x8, 0x8b, 0x84, 0x3, 0xfa, 0x67,
-    0x98, 0x40, 0x17, 0x70, 0x5, 0x10, 0x28, 0x86,
-    0x0, 0x57, 0x70, 0x4, 0x22, 0x33, 0xb, 0x48,
-    0x7, 0xfa, 0xee, 0x19, 0x0, 0xe7, 0x0, 0xc6,
-    0x5e, 0xe0, 0x15, 0xdd, 0xc0, 0x1d, 0x1e, 0x1,
-    0x15, 0xdc, 0xa0, 0x4, 0x8a, 0x7d, 0xa0, 0x4,
-    0x80, 0x43, 0x8c, 0x57, 0x48, 0xdd, 0x80,
+    0xfb, 0xf9, 0x14, 0x12, 0x28, 0x24, 0x5f, 0xcf,
+    0xa0, 0x91, 0x41, 0x22, 0xfe, 0x7d, 0x20, 0x8a,
+    0x45, 0x14, 0x62, 0x28, 0x87, 0x90, 0x88, 0x2c,
+    0x80, 0xc0, 0x80,
 
     /* U+7740 "着" */
-    0x0, 0xff, 0xe3, 0xc9, 0x80, 0x64, 0x80, 0xe,
-    0xaa, 0x16, 0xd5, 0x71, 0x55, 0x0, 0x2a, 0xa5,
-    0xf5, 0x66, 0x2b, 0xaa, 0xa0, 0x8, 0xea, 0xbf,
-    0xc6, 0x1, 0x1d, 0x57, 0xf8, 0xc0, 0xf, 0x55,
-    0xff, 0xc0, 0x70, 0x7a, 0xa1, 0x7d, 0x66, 0x2a,
-    0xb9, 0xc0, 0x21, 0x7e, 0xaa, 0xf4, 0x80, 0x74,
-    0xc, 0xd5, 0x78, 0x50, 0x2, 0x63, 0x48, 0x99,
-    0xf2, 0x0, 0x4b, 0xb4, 0x11, 0x33, 0xe4, 0x0,
-    0xb6, 0xc0, 0x11, 0x33, 0xe4, 0x0, 0xa0, 0x2,
-    0x89, 0x9f, 0x20, 0x7, 0x8e, 0x6a, 0xbc, 0x8e,
-    0x1, 0xd3, 0x75, 0x5e, 0xc3, 0x0,
+    0x0, 0x0, 0x10, 0x20, 0xff, 0xf0, 0x0, 0x1,
+    0xff, 0x80, 0x0, 0xf, 0xff, 0x4, 0x0, 0xf,
+    0xf8, 0x30, 0x10, 0x7f, 0xe1, 0x40, 0x44, 0xff,
+    0x81, 0x1, 0x3, 0xfe, 0x0, 0x0,
 
     /* U+775B "睛" */
-    0x8b, 0xb9, 0xc0, 0x36, 0x0, 0x71, 0xdd, 0xd8,
-    0x95, 0x51, 0x55, 0x48, 0x1, 0xe4, 0xaa, 0x8a,
-    0xaa, 0x40, 0xf, 0xaa, 0xa2, 0xaa, 0x88, 0x1,
-    0x75, 0x60, 0xa, 0xa8, 0xaa, 0xa2, 0x0, 0x5d,
-    0x58, 0x4d, 0x54, 0xd5, 0x58, 0x40, 0x3a, 0x6a,
-    0x23, 0xae, 0x84, 0x2e, 0xe0, 0x5, 0xaa, 0xbd,
-    0x55, 0xa0, 0x15, 0xdc, 0x1, 0x3b, 0x99, 0xdc,
-    0xc2, 0x1, 0xff, 0xca, 0x5c, 0xc3, 0xe6, 0x10,
-    0x2, 0xbb, 0x57, 0x82, 0xe6, 0x72, 0x0, 0xe,
-    0xed, 0x48, 0x1, 0xfe, 0x80, 0xe, 0x10, 0x8,
-    0xe9, 0x84, 0x3, 0xea, 0x0, 0x8e, 0xb0, 0x0,
+    0xf0, 0x41, 0x17, 0xf2, 0x21, 0x4, 0x5f, 0xcf,
+    0x84, 0x11, 0xff, 0xa2, 0x0, 0x7d, 0x24, 0x8a,
+    0x49, 0x14, 0x92, 0x2f, 0xe7, 0x90, 0x48, 0x20,
+    0x80, 0x43, 0x0, 0x0, 0x0,
 
     /* U+7761 "睡" */
-    0x0, 0xfe, 0x11, 0x0, 0x67, 0xbb, 0x60, 0x3c,
-    0xc3, 0xe3, 0xaa, 0x0, 0x32, 0xec, 0xe0, 0xf3,
-    0xe, 0xcc, 0x54, 0x0, 0xf8, 0x47, 0x38, 0x8c,
-    0x1, 0xe4, 0xde, 0xdd, 0x1e, 0xe7, 0xb8, 0x2,
-    0xec, 0xa9, 0x89, 0x98, 0x4c, 0xc2, 0x38, 0x2,
-    0xec, 0xa0, 0x1f, 0xfc, 0x38, 0xb5, 0xbb, 0x2d,
-    0xd2, 0x50, 0x2, 0xec, 0xb1, 0x6b, 0x76, 0x5b,
-    0xa4, 0xa0, 0x5, 0xd9, 0x40, 0x3f, 0xf8, 0x62,
-    0x4e, 0x44, 0x72, 0x20, 0x88, 0x0, 0x22, 0x2,
-    0xb5, 0xbb, 0x15, 0xd1, 0x28, 0x2, 0xed, 0x87,
-    0x33, 0x96, 0x66, 0x40, 0x5, 0x51, 0xc0, 0x3f,
-    0xeb, 0x0, 0xa2, 0xef, 0x2d, 0xdd, 0x40,
+    0x0, 0x0, 0xe6, 0x82, 0x41, 0x4, 0x82, 0x9,
+    0x7f, 0x9e, 0x49, 0x24, 0x92, 0x4f, 0xfe, 0xf2,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0xbf, 0xce, 0x4,
+    0x10, 0x8, 0x3, 0xff, 0x0,
 
     /* U+77E5 "知" */
-    0x0, 0x2b, 0x0, 0x7f, 0xf0, 0x71, 0x0, 0x3a,
-    0x6a, 0xb2, 0x0, 0x12, 0x7b, 0x2e, 0x4, 0xea,
-    0xa8, 0xd0, 0x6b, 0xb2, 0xed, 0xc1, 0x80, 0x71,
-    0x85, 0x30, 0x7, 0xff, 0x7, 0x80, 0x3f, 0xf8,
-    0x23, 0x37, 0x65, 0xdb, 0xb3, 0x0, 0x78, 0x6e,
-    0xe2, 0xcb, 0xb3, 0x0, 0x7f, 0x8c, 0xc0, 0x1f,
-    0xfc, 0x4, 0x78, 0x20, 0xf, 0xfb, 0xaa, 0x9c,
-    0x40, 0x1f, 0xc8, 0x64, 0x3d, 0x20, 0xf3, 0x34,
-    0x0, 0xe, 0x24, 0x0, 0x56, 0xd, 0x77, 0x70,
-    0x3, 0xf4, 0x3, 0x8c, 0x8b, 0x29, 0x0,
+    0x0, 0x0, 0x40, 0xf8, 0xfd, 0x8, 0x42, 0x14,
+    0x84, 0x21, 0x8, 0x5f, 0xd0, 0x84, 0x21, 0x8,
+    0x42, 0x18, 0x84, 0x49, 0x8, 0x8b, 0xf2, 0x4,
+    0x28, 0x8, 0x40,
 
     /* U+77F3 "石" */
-    0x8, 0xcc, 0xdf, 0x99, 0xf4, 0x84, 0x66, 0x50,
-    0xf9, 0x9f, 0x48, 0x7, 0x75, 0x80, 0x7f, 0xf0,
-    0x5, 0xcc, 0x3, 0xff, 0x81, 0x36, 0x1, 0xff,
-    0xc0, 0x15, 0x60, 0xf, 0xfe, 0x5, 0x96, 0x67,
-    0xea, 0x0, 0x94, 0x4f, 0x33, 0xf3, 0x0, 0x12,
-    0x6c, 0x3, 0xfe, 0x28, 0xd0, 0xf, 0xfe, 0x1,
-    0x60, 0x80, 0x7f, 0xf4, 0xcb, 0x33, 0xf0, 0x80,
-    0x72, 0xe6, 0x7e, 0x60, 0xe, 0xb0, 0xf, 0xd6,
-    0x0,
+    0x7f, 0xfe, 0x4, 0x0, 0x10, 0x0, 0x20, 0x0,
+    0x80, 0x1, 0x0, 0x7, 0xff, 0xc, 0x2, 0x28,
+    0x4, 0x90, 0x8, 0x20, 0x10, 0x40, 0x20, 0xff,
+    0xc1, 0x0, 0x80, 0x0, 0x0,
 
     /* U+7814 "研" */
-    0x0, 0xff, 0xe2, 0xdd, 0xbe, 0xec, 0x6b, 0x7f,
-    0x76, 0xec, 0x70, 0x5, 0xd2, 0xdd, 0x8d, 0x6d,
-    0x2e, 0xcf, 0xce, 0x1, 0x2e, 0x80, 0x7f, 0xf0,
-    0xb1, 0x0, 0x3f, 0xf8, 0x48, 0x60, 0x1f, 0xfc,
-    0x12, 0x25, 0x52, 0x0, 0x3f, 0xeb, 0x28, 0x81,
-    0x8d, 0xd9, 0x2e, 0xcf, 0xd4, 0x2, 0xae, 0x44,
-    0x10, 0xbb, 0x25, 0xd9, 0xfa, 0x80, 0x78, 0x3,
-    0xc2, 0x20, 0xf, 0x88, 0x3, 0xca, 0x40, 0x1f,
-    0xfc, 0x23, 0xc0, 0xf, 0xcb, 0x76, 0x61, 0xb,
-    0x40, 0xf, 0xcb, 0x76, 0xc0, 0x7b, 0x0, 0xfe,
-    0x90, 0xd, 0xae, 0x1, 0x9, 0x80, 0x0,
+    0x0, 0x0, 0x7c, 0xfc, 0x10, 0x48, 0x0, 0x48,
+    0x20, 0x48, 0x20, 0x48, 0x3c, 0x48, 0x65, 0xfe,
+    0x64, 0x48, 0x24, 0x48, 0x24, 0x48, 0x24, 0x8,
+    0x3c, 0x88, 0x20, 0x8, 0x1, 0x8,
 
     /* U+7834 "破" */
-    0xb, 0xb7, 0xdd, 0x80, 0x35, 0x0, 0x75, 0xca,
-    0xdd, 0x80, 0x30, 0x80, 0x79, 0xf0, 0x2, 0x8b,
-    0xb2, 0x5d, 0xd0, 0x0, 0xf5, 0x0, 0x8a, 0xec,
-    0x97, 0x68, 0x0, 0x9c, 0xc0, 0x21, 0x0, 0xeb,
-    0xa0, 0x50, 0x76, 0x20, 0xf, 0xa8, 0x82, 0x0,
-    0xca, 0x1, 0x7a, 0xc2, 0xed, 0x80, 0x6a, 0xc8,
-    0x81, 0x4, 0x7b, 0xbc, 0x80, 0x70, 0x1, 0x84,
-    0xf5, 0x80, 0xf, 0xc0, 0x1f, 0x17, 0x26, 0x8,
-    0xb5, 0x0, 0x3e, 0x62, 0xb, 0xbc, 0x1, 0x96,
-    0xed, 0x9e, 0x80, 0x6, 0x11, 0x0, 0x66, 0xbb,
-    0x38, 0x89, 0x37, 0xa2, 0xd0, 0x2, 0x80, 0x2,
-    0xfb, 0xe6, 0x8, 0xeb, 0x24,
+    0x7c, 0x20, 0x20, 0x40, 0x7, 0xf9, 0x9, 0x12,
+    0x12, 0x44, 0x24, 0x19, 0x7f, 0x32, 0xc2, 0x25,
+    0x0, 0x48, 0x90, 0x90, 0xc1, 0xd1, 0x82, 0x24,
+    0x80, 0x10, 0xc0,
 
     /* U+786E "确" */
-    0x0, 0xfe, 0x71, 0x0, 0xeb, 0xb7, 0x5d, 0x9c,
-    0x1, 0x22, 0x1, 0xd7, 0x2f, 0x76, 0x70, 0x73,
-    0xbb, 0x70, 0x6, 0x7e, 0x0, 0x86, 0xb2, 0xe5,
-    0x0, 0x36, 0x18, 0x5, 0x6a, 0x3, 0x12, 0x1,
-    0x91, 0x0, 0x5, 0x52, 0x5d, 0x9e, 0x6a, 0x40,
-    0x89, 0x32, 0x85, 0x99, 0x55, 0xbd, 0x51, 0x42,
-    0x8a, 0x64, 0x22, 0x9, 0xaa, 0x25, 0x50, 0x5,
-    0x44, 0x3, 0xa6, 0xa8, 0x95, 0x40, 0x7, 0x38,
-    0x7, 0xff, 0x0, 0x4c, 0x3, 0x86, 0xfb, 0xd3,
-    0xb8, 0x1, 0xfb, 0x7f, 0xbb, 0x80, 0x26, 0xbb,
-    0x18, 0x8c, 0x1, 0xfa, 0xee, 0xa7, 0xd0, 0xf,
-    0xe6, 0x0, 0xb1, 0x80, 0x35, 0x5a, 0x0,
+    0x0, 0x0, 0xf8, 0x80, 0x41, 0xe0, 0x4, 0x42,
+    0x19, 0x4, 0x3f, 0xcf, 0x4, 0xb2, 0x7f, 0x64,
+    0x12, 0x48, 0x24, 0x93, 0xf9, 0x28, 0x13, 0xd0,
+    0x20, 0x0, 0x40, 0x83, 0x80,
 
     /* U+793E "社" */
-    0x0, 0x8a, 0x0, 0x3d, 0x20, 0x1f, 0x84, 0x3,
-    0xca, 0x1, 0xe1, 0x11, 0x88, 0x7, 0xfd, 0x37,
-    0x21, 0x7a, 0x1, 0xfe, 0x9a, 0xa8, 0xa0, 0x3,
-    0xff, 0x82, 0x64, 0xad, 0x99, 0x1e, 0x64, 0x60,
-    0x11, 0x6d, 0x83, 0x66, 0x47, 0x99, 0x18, 0x0,
-    0xfc, 0xac, 0x40, 0x3f, 0xcb, 0x1c, 0xb1, 0x42,
-    0x1, 0xf8, 0x76, 0xc4, 0xa, 0x80, 0x3f, 0x86,
-    0x0, 0x30, 0x88, 0x3, 0xff, 0xc0, 0x20, 0x37,
-    0x99, 0x1e, 0x64, 0xe0,
+    0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x7e, 0x10,
+    0x4, 0x10, 0x4, 0xfe, 0x8, 0x10, 0x1c, 0x10,
+    0x2a, 0x10, 0x48, 0x10, 0x8, 0x10, 0x8, 0x10,
+    0x8, 0x10, 0x9, 0xfe,
 
     /* U+795E "神" */
-    0x0, 0xff, 0xe3, 0x50, 0x7, 0xa8, 0x3, 0xe6,
-    0x0, 0xf0, 0x80, 0x70, 0x88, 0x4, 0x40, 0x4a,
-    0xa6, 0x55, 0x20, 0x85, 0xd9, 0xaf, 0xc7, 0x8c,
-    0xc0, 0x66, 0x2a, 0xa, 0xaa, 0x5c, 0x5d, 0x9b,
-    0xce, 0x1, 0xf, 0xc0, 0x2c, 0xc9, 0x66, 0x60,
-    0xd, 0x56, 0x20, 0x57, 0x62, 0xbb, 0x80, 0x2a,
-    0x50, 0x50, 0x72, 0x23, 0x91, 0x40, 0x37, 0xc4,
-    0xfa, 0x40, 0x1f, 0x96, 0x10, 0x1, 0x4, 0xb7,
-    0x65, 0xbb, 0x81, 0xc, 0x3, 0xb6, 0xec, 0xb7,
-    0x77, 0x0, 0x7c, 0x60, 0x1e, 0x20, 0xf, 0xfe,
-    0x33, 0x0, 0x7f, 0xf0, 0xa8, 0x3, 0xd6, 0x1,
-    0x80,
+    0x0, 0x0, 0x20, 0x40, 0x40, 0x80, 0x81, 0x7,
+    0xd2, 0x20, 0xa4, 0x42, 0x7f, 0x88, 0x91, 0x31,
+    0x22, 0xaa, 0x44, 0x47, 0xf8, 0x81, 0x1, 0x2,
+    0x2, 0x4, 0x4, 0x8, 0x0, 0x0,
 
     /* U+79BB "离" */
-    0x0, 0xf9, 0xd0, 0x3, 0xea, 0xbb, 0xf4, 0x5d,
-    0xf4, 0x85, 0x5c, 0x5c, 0xde, 0x63, 0x6a, 0xe2,
-    0xe4, 0x2, 0x80, 0x19, 0x95, 0x10, 0x84, 0x0,
-    0x7c, 0x23, 0x1f, 0x8, 0x7, 0xe1, 0xa9, 0x89,
-    0x82, 0x0, 0xf8, 0xe8, 0xeb, 0xae, 0x62, 0xb0,
-    0x3, 0xa2, 0xed, 0x9, 0x77, 0x53, 0x80, 0x69,
-    0xbb, 0xb9, 0xae, 0xfa, 0x0, 0x25, 0xbb, 0x9b,
-    0x2e, 0x3e, 0xec, 0x80, 0x1e, 0x22, 0x0, 0xb,
-    0xcc, 0x3, 0xc7, 0x72, 0x55, 0x32, 0xc8, 0x0,
-    0xf1, 0xdd, 0xd5, 0x30, 0xf2, 0x1, 0xcc, 0x1,
-    0xfa, 0xa8, 0xc0,
+    0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x9c, 0x41,
+    0x3c, 0x82, 0x81, 0x7, 0xfc, 0x0, 0x80, 0x3f,
+    0xfc, 0x44, 0x8, 0x88, 0x91, 0x7e, 0xa2, 0x0,
+    0x44, 0x3, 0x80,
 
     /* U+79CD "种" */
-    0x0, 0xa, 0xcd, 0x88, 0x4, 0x32, 0x1, 0xa6,
-    0x3f, 0x2c, 0x40, 0x31, 0x80, 0x69, 0x96, 0x88,
-    0x7, 0xff, 0x16, 0x33, 0x1a, 0x99, 0x88, 0xb,
-    0xb5, 0x4d, 0xa2, 0x33, 0x1a, 0x99, 0x83, 0xb,
-    0xb0, 0xd5, 0xa0, 0x7, 0xce, 0x0, 0x32, 0xc3,
-    0x0, 0xff, 0xa5, 0xbe, 0x44, 0x3, 0xf9, 0xb,
-    0xc2, 0x8, 0x2e, 0xda, 0x97, 0x61, 0xf, 0x80,
-    0x1, 0x1a, 0xdd, 0xb5, 0x2e, 0xca, 0x9e, 0x1,
-    0xd2, 0x1, 0xe8, 0x44, 0x0, 0x7f, 0xf4, 0xc4,
-    0x3, 0xe3, 0x0, 0xf3, 0x20, 0x7, 0xc, 0x80,
-    0x40,
+    0xc, 0x10, 0xe0, 0x20, 0x0, 0x40, 0xf, 0xf7,
+    0xd1, 0x22, 0x22, 0x46, 0x44, 0x9a, 0x89, 0x21,
+    0xfe, 0x82, 0x24, 0x0, 0x40, 0x0, 0x80, 0x1,
+    0x0, 0x2, 0x0, 0x0, 0x0,
 
     /* U+79D1 "科" */
-    0x0, 0xa, 0x46, 0x10, 0x7, 0x50, 0x6, 0x88,
-    0x68, 0x61, 0x2, 0xd0, 0x1, 0x80, 0x34, 0x4e,
-    0x78, 0x4, 0xbd, 0x82, 0x1, 0xff, 0xc1, 0x4e,
-    0x10, 0xe, 0xbb, 0x45, 0x5c, 0x80, 0x44, 0x1,
-    0xeb, 0xb3, 0xba, 0xe4, 0x68, 0x40, 0x3f, 0xb,
-    0xb3, 0x0, 0x62, 0x90, 0x3, 0xe9, 0xab, 0xf2,
-    0x2, 0xb2, 0x0, 0xf0, 0x91, 0x2, 0x1c, 0x2,
-    0x60, 0x8, 0x40, 0x15, 0x0, 0x1, 0x50, 0x25,
-    0x7a, 0x2b, 0x80, 0x2d, 0x20, 0x8, 0xaa, 0x86,
-    0x96, 0x57, 0x20, 0x4c, 0x1, 0x8a, 0xa1, 0x8c,
-    0x40, 0x3f, 0xf9, 0x62, 0x20, 0xf, 0x98, 0x3,
-    0xc8, 0xc0, 0x1f, 0x50, 0x4,
+    0xc, 0x8, 0x78, 0x48, 0x0, 0x28, 0x0, 0x8,
+    0x7e, 0x8, 0x18, 0x88, 0x18, 0x48, 0x24, 0x8,
+    0x20, 0x8, 0x40, 0x1e, 0x1, 0x88, 0x0, 0x8,
+    0x0, 0x8, 0x0, 0x8, 0x0, 0x0,
 
     /* U+7A76 "究" */
-    0x0, 0xfa, 0x88, 0x3, 0xf3, 0x5d, 0xd9, 0x6f,
-    0xd9, 0x77, 0xa0, 0x1, 0x57, 0x72, 0x56, 0xe0,
-    0x5d, 0xe4, 0x0, 0x58, 0x4, 0x42, 0x1, 0xf5,
-    0x0, 0x1c, 0x0, 0xfc, 0x1, 0xff, 0xc0, 0x39,
-    0x4, 0x10, 0x2, 0xdd, 0x52, 0xc4, 0x0, 0xc9,
-    0xe, 0x16, 0x21, 0x37, 0x54, 0xb7, 0x0, 0x33,
-    0x88, 0x7, 0xff, 0x4, 0x6e, 0xf2, 0x55, 0xdb,
-    0x18, 0x3, 0x86, 0xef, 0x15, 0xdd, 0xfe, 0x0,
-    0xfe, 0x64, 0x0, 0xff, 0xe0, 0xad, 0x40, 0x7,
-    0xca, 0x80, 0x2, 0xaf, 0xc0, 0xf, 0xc4, 0x0,
-    0xa8, 0x9a, 0x0, 0xe2, 0x4c, 0xc5, 0xa0, 0x55,
-    0xc, 0x3, 0xc3, 0xb9, 0x90, 0x0,
+    0x1, 0x0, 0x3f, 0xfe, 0x44, 0x42, 0x4, 0x40,
+    0x0, 0x40, 0x10, 0x7c, 0x2, 0x0, 0x2, 0x0,
+    0x3f, 0xe0, 0x2, 0x10, 0x2, 0x10, 0x4, 0x10,
+    0x18, 0x10, 0x60, 0x1e, 0x0, 0x0,
 
     /* U+7A7A "空" */
-    0x0, 0xf9, 0x94, 0x3, 0xf2, 0x5d, 0xfa, 0x2e,
-    0xf9, 0x40, 0x1d, 0x57, 0x6e, 0xcd, 0xd0, 0xd5,
-    0xda, 0xb8, 0x3, 0xda, 0x60, 0x1e, 0x12, 0x0,
-    0x40, 0x80, 0xa2, 0x0, 0x3e, 0x90, 0x1, 0x0,
-    0xd4, 0x0, 0x7c, 0x30, 0x0, 0x28, 0xdf, 0x40,
-    0xb, 0xea, 0xed, 0xb8, 0x0, 0x1b, 0xc4, 0x0,
-    0xcb, 0x77, 0x62, 0x0, 0xc, 0x2e, 0xff, 0xca,
-    0x1, 0x8e, 0xef, 0x6f, 0x5d, 0xe5, 0x0, 0xff,
-    0xf3, 0xd5, 0xdf, 0xa2, 0xef, 0xa8, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x40, 0x42, 0x44, 0x42,
+    0x4, 0x40, 0x8, 0x42, 0x30, 0x3c, 0x0, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+7A7F "穿" */
-    0x0, 0xf4, 0x18, 0x7, 0xcd, 0x77, 0xb1, 0x3f,
-    0x2e, 0xf2, 0x86, 0xdd, 0xdd, 0x79, 0xaf, 0x77,
-    0x4e, 0x7, 0x0, 0x6, 0x58, 0x3, 0xcf, 0xa0,
-    0xa2, 0xd5, 0xc2, 0x2, 0xd3, 0x2a, 0xd4, 0x5,
-    0x82, 0xb2, 0x0, 0xb6, 0x21, 0x70, 0x0, 0x53,
-    0xfb, 0xbf, 0x7d, 0x54, 0x1, 0x51, 0x5d, 0xf8,
-    0xae, 0xd4, 0x1, 0x9, 0x80, 0x7f, 0xf0, 0x5d,
-    0xd7, 0x7d, 0xa7, 0x77, 0x50, 0x1, 0x36, 0xee,
-    0xf7, 0x93, 0xbb, 0xa8, 0x0, 0x40, 0x2d, 0xbd,
-    0xa8, 0x1, 0xe3, 0x8c, 0xec, 0xfa, 0x10, 0xf,
-    0xbc, 0xeb, 0xa8, 0x86, 0xe9, 0x80, 0x38,
+    0x2, 0x0, 0xff, 0xf2, 0x2, 0x10, 0x44, 0x1,
+    0xf, 0x88, 0x0, 0x1f, 0xfe, 0x10, 0x20, 0x20,
+    0x40, 0x7f, 0xf8, 0x5, 0x0, 0x32, 0x7, 0x84,
+    0x18, 0x38, 0x0,
 
     /* U+7ACB "立" */
-    0x0, 0xf8, 0x84, 0x3, 0xff, 0x84, 0xa8, 0x1,
-    0xff, 0xcd, 0x11, 0xef, 0x31, 0x1e, 0x0, 0x92,
-    0xef, 0x8b, 0x2e, 0xf9, 0x40, 0x9, 0x57, 0x35,
-    0x5e, 0xcb, 0xa5, 0x0, 0xc3, 0x0, 0x1e, 0xa1,
-    0x0, 0xfc, 0x20, 0x18, 0x40, 0x3f, 0xb5, 0x0,
-    0x32, 0x58, 0x7, 0xe4, 0xc0, 0xd, 0xea, 0x1,
-    0xf8, 0x94, 0x3, 0x31, 0x0, 0x7f, 0xf0, 0x51,
-    0x0, 0x1f, 0xee, 0x0, 0xb6, 0x80, 0x3d, 0x79,
-    0x97, 0x66, 0x4d, 0xd9, 0x95, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x8, 0x10, 0x8, 0x10,
+    0x0, 0x0, 0x4, 0x20, 0x4, 0x20, 0x4, 0x20,
+    0x0, 0x40, 0x7f, 0xfe,
 
     /* U+7AD9 "站" */
-    0x0, 0x91, 0x80, 0x3a, 0xc0, 0x3f, 0x8, 0x7,
-    0x9c, 0x3, 0xf8, 0x40, 0x3f, 0xf8, 0x15, 0x7d,
-    0x97, 0x40, 0x1a, 0xef, 0x0, 0x2e, 0x6e, 0xdf,
-    0x60, 0x1a, 0xef, 0x0, 0xe, 0x80, 0x1c, 0x1,
-    0xff, 0x11, 0x0, 0x2, 0x20, 0xf, 0xf8, 0x40,
-    0x31, 0x5d, 0x8e, 0xee, 0x50, 0xe, 0x12, 0x5,
-    0xfb, 0xfb, 0xbb, 0x80, 0x21, 0x5, 0xf0, 0xf,
-    0xfe, 0x4, 0x27, 0xd5, 0xe8, 0x7, 0xe1, 0xc9,
-    0xcf, 0xcb, 0xd0, 0xf, 0xc3, 0x97, 0x8, 0x1,
-    0x11, 0x78, 0x3, 0xf8, 0x76, 0xef, 0x84, 0x3,
-    0xf3, 0x5c, 0xcf, 0x50, 0x0,
+    0x0, 0x20, 0x0, 0x20, 0x0, 0x20, 0x7e, 0x3e,
+    0x0, 0x20, 0x24, 0x20, 0x24, 0x20, 0x24, 0xfc,
+    0x24, 0x2, 0x20, 0x2, 0xf, 0x2, 0x70, 0x2,
+    0x0, 0x2, 0x0, 0xfe, 0x0, 0x0,
 
     /* U+7AE0 "章" */
-    0x0, 0xf9, 0x94, 0x3, 0xfa, 0xa9, 0x97, 0x5b,
-    0xd5, 0x79, 0x54, 0x0, 0xd5, 0x48, 0x2a, 0xbb,
-    0x56, 0x4d, 0x50, 0x2, 0x33, 0x9d, 0xc, 0xe4,
-    0xb6, 0x33, 0x80, 0xa, 0x89, 0x52, 0x24, 0x76,
-    0x89, 0x28, 0x1, 0x9f, 0xb7, 0x7f, 0x73, 0xb0,
-    0x4, 0x63, 0x55, 0xf8, 0x4c, 0x3, 0x96, 0xab,
-    0xf2, 0xb8, 0x7, 0x2d, 0x57, 0xe5, 0x0, 0xe2,
-    0x4a, 0xaf, 0xc8, 0xa0, 0x18, 0x72, 0xaa, 0xcc,
-    0x55, 0x58, 0x20, 0x1, 0xab, 0xbf, 0xfe, 0x5,
-    0x0, 0xd5, 0xdf, 0xff, 0x2, 0x80, 0x3f, 0x19,
-    0x80, 0x3e,
+    0x0, 0x0, 0x3f, 0xfc, 0x4, 0x0, 0x4, 0x20,
+    0x0, 0x0, 0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8,
+    0x10, 0x8, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+7B11 "笑" */
-    0x0, 0xfe, 0x30, 0xf, 0xc3, 0x40, 0x18, 0x60,
-    0x3, 0xf3, 0x3d, 0xdd, 0x2c, 0xcb, 0xbd, 0x40,
-    0x2, 0xcd, 0xb, 0xb4, 0x5e, 0xc0, 0xdd, 0xa8,
-    0x1, 0xd0, 0x1c, 0xc1, 0x70, 0x6, 0x62, 0x0,
-    0xdc, 0x60, 0xae, 0x16, 0xa6, 0x9d, 0x6a, 0x1,
-    0x13, 0xd5, 0x2e, 0xa9, 0xf3, 0x85, 0x6a, 0x1,
-    0x9e, 0xab, 0x73, 0x54, 0x29, 0x0, 0x7f, 0xb7,
-    0x40, 0x1f, 0xaa, 0xef, 0x9a, 0x6e, 0xfc, 0x0,
-    0xab, 0xbd, 0xe, 0xb1, 0x77, 0xc0, 0x1f, 0x7c,
-    0x44, 0x20, 0x1f, 0xc3, 0x7e, 0x22, 0x9d, 0x20,
-    0xf, 0xb, 0xec, 0x18, 0x0, 0xb6, 0x24, 0x40,
-    0x28, 0xb2, 0xc3, 0x0, 0xc3, 0x5b, 0x50, 0x0,
+    0x0, 0x0, 0x10, 0x40, 0x1f, 0x7e, 0x28, 0x90,
+    0x41, 0x10, 0x0, 0x8, 0x1f, 0xe0, 0x0, 0x80,
+    0x1, 0x0, 0x7f, 0xfe, 0x1, 0x80, 0x2, 0x40,
+    0x4, 0x20, 0x8, 0x18, 0x60, 0x6,
 
     /* U+7B2C "第" */
-    0x0, 0x10, 0x7, 0x10, 0x7, 0xc5, 0x0, 0x18,
-    0x78, 0x3, 0xe8, 0x6d, 0xaa, 0x4c, 0x6, 0x62,
-    0xaa, 0x35, 0x3c, 0x6a, 0xa7, 0x8e, 0x6b, 0xd5,
-    0x47, 0xb2, 0x1e, 0x21, 0xd0, 0x3, 0xc4, 0x1,
-    0x43, 0x5f, 0xd5, 0x9e, 0xdd, 0xba, 0x24, 0x2,
-    0x6b, 0xbd, 0x29, 0x77, 0x51, 0x0, 0x78, 0x46,
-    0x31, 0x1c, 0xe0, 0x1a, 0xea, 0xed, 0xf, 0x77,
-    0x44, 0x80, 0x46, 0x6a, 0xaa, 0x52, 0xaa, 0x95,
-    0x0, 0xad, 0x2e, 0xef, 0x7b, 0xbe, 0x60, 0x6,
-    0x62, 0xec, 0x4a, 0xf7, 0x7a, 0xb0, 0x0, 0x80,
-    0x77, 0xb4, 0x1, 0xca, 0x40, 0x2, 0xa9, 0xa4,
-    0x0, 0xf6, 0x60, 0x26, 0x26, 0x84, 0x0, 0x20,
-    0x9, 0xa0, 0x40,
+    0x0, 0x0, 0x41, 0x1, 0xff, 0xf2, 0x89, 0x8,
+    0x20, 0x7, 0xff, 0x0, 0x42, 0x0, 0x84, 0x3f,
+    0xf0, 0x42, 0x1, 0xff, 0xe0, 0x38, 0x20, 0x90,
+    0x46, 0x21, 0x30, 0x4e, 0x0,
 
     /* U+7B49 "等" */
-    0x0, 0x88, 0x3, 0x88, 0x3, 0xf2, 0xd0, 0x6,
-    0x38, 0x0, 0xfd, 0x29, 0xb7, 0x68, 0xf1, 0xcb,
-    0xba, 0x80, 0x11, 0x58, 0x37, 0x61, 0xab, 0xf1,
-    0xbb, 0x50, 0x4, 0xc1, 0x20, 0x1, 0x20, 0x3d,
-    0x0, 0xe8, 0x5b, 0xeb, 0xb2, 0xcd, 0xdb, 0x2d,
-    0x80, 0x32, 0xdd, 0xff, 0x98, 0x3, 0xff, 0x8f,
-    0x57, 0x7d, 0xba, 0xbb, 0x75, 0xdc, 0x21, 0x57,
-    0x7f, 0xa9, 0x6e, 0xe1, 0x6, 0xbb, 0xfd, 0x4b,
-    0x76, 0x80, 0x3, 0x5d, 0xb2, 0xef, 0xa9, 0x6e,
-    0xd0, 0x1, 0xc7, 0x82, 0x1, 0xff, 0xc1, 0x4e,
-    0xd0, 0xc, 0x20, 0x1f, 0xc5, 0x80, 0xf7, 0x5a,
-    0x1, 0x80,
+    0x0, 0x0, 0x10, 0x40, 0x3f, 0xfe, 0x49, 0x10,
+    0x41, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x10, 0x3f, 0xfe, 0x0, 0x10,
+    0x4, 0x10, 0x2, 0x10, 0x0, 0x60,
 
     /* U+7B54 "答" */
-    0x0, 0x2a, 0x80, 0x31, 0xb8, 0x7, 0xe9, 0x96,
-    0x5d, 0x92, 0x33, 0x6e, 0xea, 0x0, 0x47, 0xf3,
-    0x5d, 0xba, 0x6f, 0x8a, 0xed, 0x40, 0x80, 0x64,
-    0x0, 0x21, 0x10, 0x18, 0x8, 0x4, 0x90, 0x0,
-    0xa0, 0x8c, 0x84, 0x9, 0x10, 0xf, 0xd7, 0x8f,
-    0x7d, 0x0, 0x1f, 0x93, 0x21, 0x80, 0x15, 0xd6,
-    0x60, 0x18, 0xab, 0x66, 0x2e, 0xf6, 0xfd, 0x5a,
-    0x1, 0xc4, 0x25, 0x6e, 0xfc, 0x93, 0x23, 0x3,
-    0xa2, 0x5b, 0xbf, 0xc8, 0x4e, 0x1, 0xba, 0xef,
-    0xe9, 0xd0, 0xf, 0xfe, 0x19, 0x80, 0x7f, 0xf2,
-    0x86, 0xef, 0xee, 0x20, 0x8,
+    0x0, 0x0, 0x3e, 0xfe, 0x49, 0x10, 0x49, 0x10,
+    0x2, 0x80, 0x4, 0x60, 0x8, 0x10, 0x37, 0xec,
+    0x40, 0x0, 0xf, 0xf0, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x1f, 0xf8,
 
     /* U+7B97 "算" */
-    0x0, 0x23, 0x0, 0x62, 0x90, 0xf, 0xd1, 0xbf,
-    0x76, 0x89, 0x2c, 0xdb, 0xb4, 0x0, 0x2f, 0xad,
-    0xa2, 0xc7, 0xef, 0x1a, 0xae, 0x0, 0x12, 0x52,
-    0x73, 0x23, 0xd9, 0x90, 0xd8, 0x80, 0x44, 0xb,
-    0x76, 0x8b, 0x88, 0xac, 0x94, 0x3, 0x85, 0x9b,
-    0xf1, 0x88, 0x7, 0x1f, 0xff, 0xe0, 0xf, 0x8a,
-    0x67, 0xf1, 0x80, 0x79, 0xe2, 0x3f, 0x1b, 0x80,
-    0x75, 0xca, 0xcc, 0xe1, 0xdb, 0x20, 0xc, 0x23,
-    0x0, 0x8e, 0x1, 0x18, 0x2, 0x9b, 0xb5, 0xd,
-    0xde, 0x5e, 0xbb, 0x48, 0x2, 0x6b, 0x83, 0xea,
-    0xb2, 0xfd, 0x52, 0x40, 0x7, 0x45, 0x64, 0x1,
-    0xbd, 0xc0, 0x30,
+    0x0, 0x40, 0x3f, 0xfe, 0x49, 0x10, 0x1f, 0xf8,
+    0x10, 0x8, 0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
+    0x1f, 0xf8, 0x4, 0x20, 0x4, 0x20, 0x7f, 0xfe,
+    0x8, 0x20, 0x20, 0x0,
 
     /* U+7C7B "类" */
-    0x0, 0x3a, 0x80, 0x19, 0x40, 0x4, 0xc0, 0x1c,
-    0xfc, 0x60, 0x1d, 0xc8, 0x1, 0xea, 0x20, 0xc,
-    0xd0, 0x40, 0x13, 0xdd, 0xaa, 0x9b, 0x35, 0x9b,
-    0xf7, 0x68, 0x7, 0xbb, 0xa9, 0x9e, 0x1e, 0x6e,
-    0xe8, 0x0, 0xcb, 0x54, 0xe2, 0xa8, 0x70, 0xc,
-    0x2d, 0x85, 0x62, 0x0, 0x1a, 0x3b, 0x93, 0x7,
-    0xc, 0x70, 0x1, 0x8, 0x4b, 0xdd, 0x80, 0xc,
-    0xc0, 0xd, 0x80, 0x9, 0x49, 0x23, 0x7, 0xbb,
-    0xe6, 0x8b, 0xb6, 0x15, 0xc8, 0x3d, 0xde, 0xe7,
-    0x5f, 0xbb, 0xd2, 0x1, 0xc9, 0x31, 0x3e, 0x60,
-    0x1f, 0x1c, 0xfe, 0x88, 0x54, 0xc8, 0xc0, 0x29,
-    0xba, 0xa5, 0x88, 0x0, 0x6a, 0xea, 0xe8, 0x26,
-    0xe4, 0xc0, 0x3c, 0x53, 0x74, 0x0,
+    0x0, 0x0, 0x20, 0x40, 0x0, 0x3, 0xff, 0xe0,
+    0x68, 0x1, 0x8, 0x8, 0x6, 0x0, 0x20, 0x2,
+    0x10, 0xff, 0xf8, 0xc, 0x0, 0x24, 0x1, 0x86,
+    0x1c, 0x3, 0x80, 0x0, 0x0,
 
     /* U+7CFB "系" */
-    0x0, 0xe1, 0x23, 0x57, 0x9c, 0xd4, 0x0, 0x2d,
-    0xda, 0xaf, 0x6c, 0xca, 0xb7, 0x48, 0x0, 0x5b,
-    0xb5, 0x13, 0xc3, 0x2b, 0x8, 0x7, 0x18, 0x38,
-    0xc0, 0x1, 0xf0, 0x3, 0xcd, 0x9b, 0x20, 0x6,
-    0xf9, 0x0, 0xf2, 0xe8, 0x30, 0x47, 0x40, 0x80,
-    0x7c, 0x35, 0xd9, 0xd0, 0x5, 0x82, 0x1, 0xe1,
-    0x3f, 0x60, 0x1, 0xfe, 0x90, 0x2, 0xf3, 0x1a,
-    0xf1, 0xd9, 0x76, 0x96, 0xe2, 0xb, 0xcc, 0xd6,
-    0x9d, 0x76, 0xaa, 0x75, 0x0, 0x47, 0x40, 0x1c,
-    0xb2, 0x5, 0x0, 0x1, 0xfb, 0x0, 0xe5, 0xfa,
-    0x0, 0x8b, 0x7c, 0x40, 0x3c, 0xdd, 0x60, 0x3d,
-    0xc3, 0x0, 0x8c, 0x3, 0x27, 0xc8,
+    0x0, 0x38, 0x7e, 0x0, 0x18, 0x0, 0x21, 0x1,
+    0x84, 0x1, 0x30, 0x1, 0x84, 0x2, 0x4, 0x7f,
+    0xfc, 0x2, 0x4, 0x24, 0x40, 0x88, 0x42, 0x10,
+    0x48, 0x20, 0x40,
 
     /* U+7FA4 "群" */
-    0x0, 0xff, 0xe2, 0x95, 0xdb, 0xaf, 0x8, 0x28,
-    0x2, 0x83, 0x0, 0x15, 0xcb, 0xdd, 0x38, 0x6a,
-    0x0, 0x91, 0x80, 0x66, 0xe0, 0x8, 0x4b, 0x51,
-    0xf0, 0xc0, 0x15, 0x73, 0x57, 0x68, 0x7d, 0x1a,
-    0xee, 0x28, 0x2, 0xad, 0x3e, 0xed, 0xd, 0x10,
-    0x28, 0x83, 0x0, 0x4, 0xd4, 0x4f, 0x80, 0x3f,
-    0xc7, 0x62, 0x88, 0xe5, 0x1b, 0xb1, 0xdd, 0x94,
-    0x0, 0x5d, 0x6e, 0xe6, 0x1, 0xbb, 0x1d, 0xd9,
-    0x40, 0x2b, 0xda, 0xa8, 0xc0, 0x3f, 0x9c, 0x7e,
-    0xa9, 0x36, 0xf5, 0x42, 0xaa, 0x84, 0x59, 0x40,
-    0x1c, 0xf7, 0x62, 0xbb, 0x50, 0x8a, 0xc0, 0x3e,
-    0x11, 0x0, 0x88, 0x3, 0xa2, 0xed, 0x1a, 0x1,
-    0xff, 0x45, 0xdc, 0xa0, 0x13, 0x0, 0x79, 0x90,
-    0x3, 0xea, 0x0, 0xc0,
+    0x0, 0x0, 0x3e, 0x44, 0x8, 0x4, 0x0, 0x20,
+    0x7f, 0x7c, 0x10, 0x10, 0x12, 0x10, 0x30, 0x7c,
+    0x0, 0x10, 0x3e, 0x10, 0x21, 0x7e, 0x41, 0x10,
+    0x1, 0x10, 0x1e, 0x10, 0x0, 0x10, 0x0, 0x0,
 
     /* U+8001 "老" */
-    0x0, 0xf1, 0x10, 0x3, 0xff, 0x84, 0x88, 0x0,
-    0xe8, 0x0, 0xc2, 0x45, 0x8, 0x88, 0xa0, 0x8f,
-    0x0, 0xc9, 0x77, 0x66, 0x2e, 0xf0, 0xb8, 0x6,
-    0x59, 0x9b, 0x75, 0x32, 0x12, 0x90, 0xf, 0xfe,
-    0x5, 0x7c, 0x80, 0x75, 0xdf, 0x6d, 0xf8, 0xe5,
-    0xde, 0x0, 0x5d, 0xf1, 0xb7, 0x5d, 0xf8, 0x3,
-    0x93, 0x7e, 0xc4, 0x3, 0xf9, 0x72, 0x1, 0x80,
-    0x25, 0xa6, 0x0, 0xd9, 0x8e, 0xc7, 0x47, 0xaa,
-    0x5, 0x30, 0x6, 0xc9, 0x20, 0x6, 0xa5, 0x51,
-    0x40, 0x3f, 0xe9, 0x30, 0xe, 0x47, 0x0, 0xf8,
-    0xc0, 0x3c, 0x42, 0x1, 0xef, 0xeb, 0xbf, 0x6b,
-    0x0,
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x8, 0x1f, 0xf8,
+    0x0, 0x30, 0x0, 0x40, 0x7f, 0xfe, 0x3, 0x0,
+    0x4, 0x0, 0x1c, 0x10, 0x64, 0xc0, 0x6, 0x0,
+    0x4, 0x0, 0x4, 0x0, 0x3, 0xfc,
 
     /* U+8005 "者" */
-    0x0, 0xf2, 0xa8, 0x3, 0x90, 0x3, 0xf8, 0xc0,
-    0x32, 0xe8, 0x6, 0x5b, 0xba, 0x2e, 0xf5, 0x7c,
-    0x80, 0x65, 0xbb, 0xa2, 0xee, 0xd3, 0xa0, 0xf,
-    0xfe, 0x5, 0xc, 0x80, 0x75, 0x5d, 0xee, 0x8e,
-    0x1c, 0xbb, 0xa8, 0x1, 0x57, 0x75, 0x1c, 0xf5,
-    0xdf, 0x50, 0x7, 0x3f, 0x1f, 0x4c, 0xe7, 0x0,
-    0xc5, 0x35, 0x97, 0x51, 0x1d, 0x60, 0x1a, 0x2a,
-    0x84, 0xe2, 0x3e, 0x0, 0xea, 0x30, 0x4, 0x55,
-    0x78, 0x80, 0x3f, 0x45, 0x57, 0x88, 0x3, 0xff,
-    0x96, 0x3f, 0x77, 0xe2, 0x0, 0xfa, 0x32, 0xef,
-    0xdc, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x1f, 0xf8, 0x0, 0x10,
+    0x0, 0x40, 0x7f, 0xfe, 0x2, 0x0, 0x7, 0xf0,
+    0x38, 0x8, 0x48, 0x8, 0xf, 0xf8, 0x8, 0x8,
+    0x8, 0x8, 0xf, 0xf8, 0x0, 0x0,
 
     /* U+800C "而" */
-    0xb, 0xcc, 0xee, 0xdc, 0xce, 0xb0, 0x5, 0xe6,
-    0x72, 0xfe, 0x67, 0x58, 0x7, 0xe6, 0x20, 0xf,
-    0xfe, 0x9, 0x30, 0x7, 0xf0, 0xed, 0xdb, 0x7c,
-    0x2f, 0x72, 0xed, 0x82, 0x0, 0x24, 0xbb, 0xa2,
-    0xec, 0xb1, 0x76, 0x42, 0x0, 0xff, 0xff, 0x80,
-    0x7f, 0xf6, 0xc4, 0x2, 0x47, 0x0, 0x5a, 0xcd,
-    0xa1, 0x0, 0xa, 0x40, 0x4, 0x40, 0x1, 0x8c,
-    0xde, 0x8, 0x0,
+    0x7f, 0xfe, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x3f, 0xfc, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44,
+    0x20, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44,
+    0x20, 0x44, 0x20, 0x1c, 0x0, 0x0,
 
     /* U+80CC "背" */
-    0x0, 0xea, 0x0, 0xac, 0x0, 0xda, 0x1, 0x45,
-    0x54, 0x80, 0x13, 0x33, 0x3b, 0x0, 0x28, 0xaa,
-    0x88, 0x2, 0x33, 0x64, 0x8, 0x7, 0x88, 0x40,
-    0x22, 0x50, 0x9, 0x0, 0x66, 0xed, 0x40, 0x18,
-    0x4c, 0x88, 0x70, 0x3, 0x77, 0x45, 0x0, 0x51,
-    0x57, 0x6a, 0x80, 0x1, 0x4, 0x56, 0xd5, 0x5e,
-    0x66, 0x19, 0x40, 0xc, 0x95, 0x5f, 0x90, 0x3,
-    0xea, 0xaf, 0xc0, 0x1f, 0xaa, 0xbf, 0x0, 0x7f,
-    0xf3, 0x26, 0x7f, 0x0, 0x7e, 0x99, 0xfc, 0x1,
-    0xf3, 0x0, 0x71, 0x55, 0x10, 0x2,
+    0x4, 0x44, 0x7c, 0x58, 0x4, 0x40, 0x4, 0x40,
+    0x7c, 0x42, 0x0, 0x3c, 0x1f, 0xf8, 0x10, 0x8,
+    0x1f, 0xf8, 0x10, 0x8, 0x10, 0x8, 0x1f, 0xf8,
+    0x10, 0x8, 0x10, 0x38,
 
     /* U+811A "脚" */
-    0x5, 0xcb, 0x90, 0x5, 0x0, 0x57, 0x98, 0x80,
-    0xde, 0xb2, 0x0, 0x8, 0x6, 0xcc, 0x18, 0x7,
-    0x25, 0xad, 0xd0, 0x80, 0x7f, 0x25, 0xad, 0xd0,
-    0x80, 0x7b, 0xad, 0xc0, 0x3f, 0xf8, 0x1d, 0x6e,
-    0x1, 0xff, 0xc3, 0x9b, 0x5b, 0xb3, 0x0, 0x7f,
-    0x4d, 0x35, 0xd9, 0x80, 0x38, 0x66, 0xdc, 0x13,
-    0x8, 0x3, 0xe3, 0xbb, 0x38, 0x6a, 0x3b, 0x0,
-    0x78, 0x40, 0x30, 0x82, 0xe8, 0x0, 0xe8, 0xc0,
-    0x39, 0xd2, 0xec, 0xe6, 0x7, 0x50, 0x44, 0x0,
-    0x9f, 0x6e, 0xda, 0x20, 0x19, 0xb4, 0xec, 0x80,
-    0x30, 0x90, 0x80, 0x48, 0x83, 0xb9, 0x0, 0xf5,
-    0x0, 0x40,
+    0x39, 0x1e, 0x92, 0x25, 0x2f, 0x4a, 0x48, 0x97,
+    0x91, 0x29, 0x22, 0x53, 0xf4, 0xa4, 0x89, 0x78,
+    0x12, 0x94, 0x25, 0x29, 0x5a, 0x5e, 0x84, 0x81,
+    0x3, 0x2, 0x0, 0x0, 0x0,
 
     /* U+81EA "自" */
-    0x0, 0xce, 0x80, 0x1c, 0xf5, 0x54, 0xf5, 0x56,
-    0x5b, 0xbd, 0xf7, 0x7d, 0x20, 0x23, 0xfc, 0x1,
-    0xff, 0xc0, 0x3b, 0xbf, 0xe0, 0x3b, 0xbf, 0xe0,
-    0xf, 0xfe, 0x1, 0x4c, 0xff, 0x1, 0x5d, 0xff,
-    0x0, 0x8, 0xbf, 0x80, 0x3f, 0xf8, 0x7, 0x77,
-    0xfc, 0x9, 0x77, 0xfc, 0xd6, 0x1, 0xfd, 0x40,
+    0x0, 0xf, 0xfa, 0x0, 0xc0, 0x18, 0x3, 0xff,
+    0xe0, 0xc, 0x1, 0xff, 0xf0, 0x6, 0x0, 0xc0,
+    0x1f, 0xff, 0x0, 0x40, 0x0,
 
     /* U+81F3 "至" */
-    0x6, 0xbb, 0xdf, 0x77, 0xf4, 0x0, 0x1a, 0xee,
-    0xf6, 0xbb, 0xfa, 0x0, 0x3d, 0xf6, 0x0, 0x19,
-    0x0, 0xfe, 0x31, 0x20, 0x0, 0xe6, 0x8, 0x3,
-    0xc3, 0x1c, 0x46, 0x64, 0x4, 0xd4, 0x0, 0x8f,
-    0x28, 0x7a, 0xea, 0xcc, 0xdb, 0x50, 0x80, 0x3,
-    0xcb, 0xaa, 0x4f, 0xeb, 0xb2, 0xab, 0x5c, 0x3,
-    0xf0, 0x80, 0x70, 0x98, 0x4, 0xd7, 0x7a, 0xa2,
-    0xef, 0x40, 0x6, 0x6b, 0xbd, 0x51, 0x77, 0xa0,
-    0x3, 0xff, 0xaf, 0x57, 0x7d, 0x51, 0x77, 0xe0,
+    0x3f, 0xfe, 0x2, 0x0, 0x4, 0x20, 0x4, 0x10,
+    0x8, 0x18, 0x3f, 0x84, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe,
 
     /* U+822C "般" */
-    0x0, 0x86, 0x80, 0x35, 0xde, 0x0, 0xf3, 0xe0,
-    0x7, 0x5d, 0x80, 0x3d, 0x79, 0x8a, 0x70, 0xf,
-    0xf8, 0x66, 0xeb, 0x0, 0x88, 0x1, 0xc8, 0x1,
-    0xb, 0x0, 0x55, 0xa0, 0x10, 0x96, 0x80, 0x44,
-    0x20, 0x2, 0x34, 0x0, 0x44, 0x2a, 0x0, 0x2,
-    0x44, 0x56, 0x9, 0x22, 0x86, 0xe0, 0x42, 0x99,
-    0x48, 0x58, 0xae, 0x6a, 0xa9, 0x70, 0x5, 0x23,
-    0xfa, 0x0, 0x24, 0x22, 0x22, 0x70, 0x0, 0x88,
-    0x3, 0xda, 0xa0, 0x7e, 0x1, 0x1f, 0x80, 0x79,
-    0xbd, 0x2d, 0x80, 0x27, 0x20, 0xf0, 0xe, 0xfb,
-    0xb0, 0x6, 0xc4, 0x6, 0x0, 0x8a, 0x77, 0xa9,
-    0xc4, 0x0, 0x62, 0xb, 0x46, 0xf7, 0x68, 0x19,
-    0x4b, 0x40, 0xa0, 0x2, 0xd4, 0x3c, 0x90, 0x4,
-    0x74, 0x80,
+    0x8, 0x78, 0x0, 0x48, 0x3c, 0x48, 0x22, 0x48,
+    0x22, 0x89, 0x22, 0x86, 0x22, 0x0, 0x62, 0xfc,
+    0x2a, 0x44, 0x2a, 0x0, 0xa, 0x28, 0x2, 0x10,
+    0x42, 0x68, 0x46, 0x82, 0x0, 0x0,
 
     /* U+8239 "船" */
-    0x0, 0xff, 0xe4, 0x50, 0x6, 0x65, 0x8, 0x10,
-    0xe, 0x6c, 0x0, 0xde, 0xe1, 0xce, 0x1, 0xaf,
-    0x75, 0x74, 0x0, 0x22, 0x2, 0x60, 0x7, 0x4c,
-    0xac, 0x40, 0x44, 0x0, 0x21, 0x0, 0xe2, 0xb0,
-    0x9, 0xbc, 0x2, 0xe7, 0x0, 0xef, 0x0, 0xad,
-    0x40, 0x25, 0xb1, 0x0, 0x8c, 0xcc, 0xc5, 0xf0,
-    0xe, 0xe0, 0x5, 0x32, 0x1, 0xa, 0xbd, 0xdf,
-    0x38, 0x85, 0x3b, 0xb5, 0x1c, 0x36, 0xae, 0xf7,
-    0x0, 0x4, 0xc0, 0x40, 0x3f, 0x9c, 0x0, 0x62,
-    0x1, 0xff, 0xc2, 0x7d, 0xd, 0x0, 0xff, 0xe0,
-    0x7b, 0x82, 0x0, 0x6b, 0x99, 0xc0, 0x18, 0x80,
-    0xec, 0x40, 0x66, 0xef, 0x28, 0x2, 0x80, 0x7,
-    0x74, 0x10, 0x64, 0x5a, 0x40,
+    0x0, 0x0, 0x8, 0x8, 0x0, 0x40, 0x3e, 0x44,
+    0x22, 0x44, 0x2a, 0x0, 0x22, 0x82, 0x22, 0x0,
+    0x62, 0x7c, 0x2a, 0x82, 0x2a, 0x82, 0x2a, 0x82,
+    0x2, 0x82, 0x42, 0xfe, 0x46, 0x82, 0x0, 0x0,
 
     /* U+8272 "色" */
-    0x0, 0xff, 0xe3, 0xc5, 0xdd, 0x98, 0x0, 0xfc,
-    0xb1, 0x77, 0x25, 0x0, 0x7d, 0xe, 0x1, 0xa,
-    0x30, 0x7, 0xe, 0x34, 0xdd, 0xd8, 0x37, 0x74,
-    0x80, 0x1a, 0x5e, 0xef, 0xe, 0xdd, 0xca, 0x0,
-    0x77, 0x0, 0x7f, 0xf4, 0x9e, 0xef, 0x1d, 0xde,
-    0x30, 0xc, 0xf7, 0x7b, 0xee, 0xf3, 0x80, 0x7f,
-    0xf0, 0xa0, 0x3, 0xff, 0xa4, 0xe8, 0x6, 0x40,
-    0x1f, 0xeb, 0x50, 0x1c, 0xc5, 0xdf, 0xec, 0xb1,
+    0x0, 0x0, 0x1f, 0x80, 0x2, 0x1, 0x4, 0x7,
+    0xff, 0x84, 0x21, 0x8, 0x42, 0x10, 0x84, 0x3f,
+    0xf8, 0x40, 0x10, 0x80, 0x1, 0x0, 0x2, 0x0,
+    0x4, 0x0, 0x87, 0xfe, 0x0,
 
     /* U+82B1 "花" */
-    0x0, 0xea, 0x0, 0xd4, 0x1, 0xea, 0xcc, 0x97,
-    0x33, 0x2e, 0x65, 0x40, 0xa, 0xcc, 0x8f, 0x33,
-    0x1e, 0x65, 0x40, 0x1e, 0x70, 0xc, 0xe0, 0x1f,
-    0xcb, 0x80, 0x8, 0xa, 0x0, 0xfe, 0x97, 0x0,
-    0x20, 0x8, 0x0, 0x80, 0x3a, 0xa8, 0x1, 0xf4,
-    0x48, 0x80, 0x50, 0x86, 0x1, 0xcf, 0x79, 0x62,
-    0x0, 0x81, 0x80, 0xe, 0xa3, 0xb4, 0x0, 0x87,
-    0xe4, 0x3, 0xd4, 0x80, 0x1c, 0x2e, 0x1, 0xff,
-    0xd0, 0x91, 0x0, 0xfc, 0xe0, 0x1c, 0x42, 0x1,
-    0x18, 0x6, 0xcc, 0x5d, 0xe2, 0x0,
+    0x4, 0x20, 0x7f, 0xfe, 0x4, 0x20, 0x4, 0x20,
+    0x0, 0x80, 0x8, 0x80, 0x10, 0x8c, 0x30, 0x90,
+    0x60, 0xc0, 0x0, 0x80, 0x0, 0x80, 0x0, 0x82,
+    0x0, 0x82, 0x0, 0x7e,
 
     /* U+82E6 "苦" */
-    0x0, 0x8d, 0xc0, 0x34, 0x10, 0x5, 0x37, 0x6f,
-    0xab, 0xbc, 0xdd, 0x76, 0x99, 0x5d, 0xbd, 0x6e,
-    0xf3, 0xf5, 0xda, 0x40, 0x3c, 0x86, 0x1, 0xfc,
-    0x70, 0x4, 0xc1, 0x24, 0x1, 0x56, 0x67, 0x5c,
-    0x66, 0x74, 0xd6, 0x67, 0x5c, 0x66, 0x74, 0x80,
-    0x7f, 0xf1, 0x22, 0xef, 0x45, 0xdd, 0x40, 0x19,
-    0x2e, 0xed, 0xd5, 0xdc, 0x46, 0x1, 0xff, 0xc1,
-    0x70, 0xf, 0xfe, 0x29, 0x55, 0x7e, 0x50, 0xc,
-    0xb7, 0x7f, 0x95, 0xc0, 0x2b, 0x11, 0xfd, 0x6,
-    0x0,
+    0x0, 0x43, 0xff, 0xf0, 0x84, 0x2, 0x10, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
+    0x80, 0x42, 0x1, 0x8, 0x4, 0x3f, 0xf0, 0x80,
+    0x40, 0x0, 0x0,
 
     /* U+8349 "草" */
-    0x0, 0xc3, 0x20, 0x1a, 0x80, 0x3d, 0x37, 0x6d,
-    0x7b, 0xbc, 0x99, 0x76, 0xa0, 0x4, 0xdd, 0xb5,
-    0x2e, 0xf2, 0x6d, 0xda, 0x80, 0x34, 0x5a, 0x55,
-    0x64, 0xb8, 0x0, 0xf1, 0xd7, 0x55, 0x6e, 0xa3,
-    0x10, 0xc, 0x20, 0x1f, 0xfc, 0x45, 0xaa, 0xfc,
-    0xa0, 0x1c, 0x2b, 0x55, 0xf9, 0x40, 0x3c, 0x55,
-    0x56, 0x62, 0xaa, 0x21, 0x0, 0xe9, 0xaa, 0xae,
-    0x6a, 0xa9, 0x0, 0xd3, 0x3e, 0xbe, 0x99, 0xf0,
-    0x2, 0x2e, 0xf9, 0x32, 0xef, 0xa0, 0x0, 0x24,
-    0x5d, 0xe4, 0x5e, 0x10, 0xf, 0xc2, 0x20, 0xf,
-    0x80,
+    0x4, 0x20, 0x7f, 0xfe, 0x4, 0x20, 0x1f, 0xf8,
+    0x10, 0x8, 0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
+    0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xfe, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+83DC "菜" */
-    0x0, 0xc3, 0x20, 0x1a, 0x80, 0x3d, 0x37, 0x6d,
-    0x7b, 0xbc, 0x97, 0x75, 0x0, 0x26, 0xed, 0xa9,
-    0x77, 0x96, 0xee, 0xa0, 0xe, 0x19, 0x23, 0x46,
-    0x2a, 0xa1, 0x0, 0x45, 0x55, 0xc8, 0x44, 0xba,
-    0xa1, 0x0, 0x45, 0xd3, 0x53, 0x1a, 0xc8, 0x40,
-    0x92, 0x1, 0x97, 0xc0, 0x23, 0x20, 0xa, 0x20,
-    0x1, 0x86, 0x4c, 0x1, 0xac, 0x0, 0x78, 0x10,
-    0xe, 0x53, 0x0, 0x10, 0x80, 0x1d, 0x0, 0x35,
-    0x5d, 0xed, 0x9a, 0xdb, 0xbd, 0x40, 0xa, 0xbb,
-    0xa1, 0x9e, 0x6, 0x6e, 0xea, 0x0, 0xe7, 0x8a,
-    0xe2, 0xd9, 0x50, 0xf, 0x2e, 0xd, 0x88, 0x0,
-    0x6f, 0x71, 0x0, 0x2c, 0xdd, 0x30, 0x7, 0xa3,
-    0xb7, 0x0,
+    0x4, 0x20, 0x7f, 0xfe, 0x4, 0x20, 0x0, 0x38,
+    0x3e, 0x0, 0x1, 0x4, 0x11, 0x8, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x3, 0x40, 0x4, 0x20,
+    0x10, 0x18, 0x60, 0x6,
 
     /* U+843D "落" */
-    0x0, 0xc5, 0x0, 0x1a, 0x84, 0x3, 0xa6, 0xed,
-    0xcd, 0x77, 0x92, 0xae, 0xd2, 0x0, 0x9b, 0xb7,
-    0x3d, 0xde, 0x5a, 0xbb, 0x48, 0x4, 0xc2, 0x54,
-    0x3, 0x81, 0xe2, 0x1, 0xe4, 0xa6, 0x30, 0xa6,
-    0xae, 0xab, 0xc0, 0xc, 0x56, 0x43, 0x47, 0xb5,
-    0x50, 0x70, 0x5, 0x28, 0x9, 0x31, 0x3, 0x82,
-    0x99, 0x10, 0x5, 0x1b, 0x21, 0x4, 0xc, 0x50,
-    0x6, 0x1, 0x86, 0x64, 0x2, 0xd4, 0xb5, 0x4b,
-    0x89, 0x40, 0xc, 0x2c, 0x86, 0x6d, 0xaa, 0x41,
-    0xf9, 0x8, 0x5, 0x6a, 0xa6, 0xea, 0xae, 0xd6,
-    0x10, 0x2, 0x99, 0x81, 0xc0, 0x3c, 0xe0, 0x10,
-    0xcc, 0x80, 0x3f, 0xf8, 0x33, 0xe0, 0x13, 0xd5,
-    0x79, 0xc0, 0x0,
+    0x4, 0x20, 0x7f, 0xfe, 0x4, 0x20, 0x0, 0x80,
+    0x11, 0xfc, 0x3, 0x8, 0x44, 0x50, 0x30, 0x70,
+    0x1, 0xc, 0x1, 0xf8, 0x10, 0x4, 0x10, 0x4,
+    0x20, 0x4, 0x41, 0xfc,
 
     /* U+884C "行" */
-    0x0, 0x8a, 0x80, 0x17, 0x7f, 0x38, 0x4, 0x5d,
-    0x60, 0xb, 0xbf, 0x9c, 0x0, 0x7d, 0xc1, 0x20,
-    0xf, 0xfa, 0x74, 0x9d, 0xc0, 0x1f, 0xf5, 0x9,
-    0xf2, 0x80, 0x8f, 0xe0, 0x8, 0xb6, 0x42, 0x2e,
-    0xf5, 0x7d, 0xd8, 0x40, 0xb8, 0xc0, 0x11, 0x55,
-    0xc9, 0x54, 0x11, 0x77, 0x4, 0x3, 0xff, 0x80,
-    0x3a, 0x40, 0x1f, 0xfc, 0x21, 0x0, 0xff, 0xfa,
-    0xb0, 0x7, 0x55, 0xd7, 0x80, 0x40,
+    0x9, 0xfc, 0x10, 0x0, 0x20, 0x0, 0x40, 0x0,
+    0x8, 0x0, 0x13, 0xfe, 0x30, 0x8, 0x50, 0x8,
+    0x10, 0x8, 0x10, 0x8, 0x10, 0x8, 0x10, 0x8,
+    0x10, 0x8, 0x10, 0x70,
 
     /* U+8863 "衣" */
-    0x0, 0xf8, 0xc8, 0x3, 0xff, 0x84, 0x8e, 0x1,
-    0xff, 0xcc, 0xac, 0xce, 0x8a, 0xcc, 0xea, 0x0,
-    0x56, 0x66, 0x94, 0x3c, 0xce, 0xa0, 0xf, 0x24,
-    0xdb, 0x8, 0x4, 0x84, 0x1, 0xcd, 0xf8, 0x18,
-    0x80, 0x7, 0xe2, 0x0, 0x86, 0xa6, 0x40, 0x7,
-    0xe1, 0xa0, 0xa0, 0x9, 0xf7, 0x94, 0x2, 0x11,
-    0x54, 0x38, 0x4, 0x22, 0xc4, 0x0, 0xe9, 0x22,
-    0x0, 0x61, 0x60, 0xf, 0x8c, 0xc8, 0x1, 0xff,
-    0xc2, 0xb9, 0x20, 0xf, 0xf1, 0xb4, 0xf, 0xf8,
-    0xc0, 0x31, 0xb3, 0xf5, 0xd8, 0xa4, 0xb, 0xfc,
-    0xc0, 0x15, 0x9f, 0xe5, 0xc2, 0x8, 0x0, 0xb0,
-    0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x1, 0x80, 0x2, 0x80, 0x4, 0x4, 0x18, 0x50,
+    0x28, 0x60, 0x8, 0x20, 0x8, 0x20, 0x8, 0x10,
+    0x8, 0x48, 0xf, 0x4, 0x20, 0x0,
 
     /* U+8868 "表" */
-    0x0, 0xf9, 0x54, 0x1, 0xf8, 0xae, 0xfa, 0x21,
-    0x77, 0xc4, 0x0, 0x2b, 0xbf, 0x45, 0xdf, 0x10,
-    0x4, 0xb5, 0x5d, 0x35, 0x59, 0x80, 0x32, 0xd5,
-    0x74, 0xd5, 0x66, 0x0, 0xff, 0xe3, 0xc5, 0xdf,
-    0x4d, 0xdf, 0xa0, 0x1, 0x17, 0x74, 0x86, 0xa5,
-    0x5d, 0xdd, 0x0, 0x18, 0x62, 0x68, 0xa6, 0x40,
-    0x9, 0x20, 0x8, 0xa2, 0x83, 0x4, 0xc, 0xcb,
-    0x54, 0x70, 0x0, 0xdd, 0xda, 0x1, 0xaa, 0x2c,
-    0xc0, 0x21, 0x93, 0x0, 0xe2, 0x24, 0xd0, 0x80,
-    0x7e, 0xd9, 0xbb, 0x2, 0x46, 0xa8, 0x6, 0x4b,
-    0xfc, 0xbb, 0x49, 0x81, 0xe1, 0x60, 0x4, 0x97,
-    0x4c, 0x40, 0x1e, 0x7c, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x2, 0x80,
+    0xc, 0x48, 0x38, 0x50, 0x40, 0x20, 0x0, 0x10,
+    0x7, 0x88, 0x18, 0x2, 0x0, 0x0,
 
     /* U+88AB "被" */
-    0x0, 0xff, 0xe3, 0xd0, 0x7, 0x86, 0x40, 0x3e,
-    0x60, 0xf, 0x8c, 0x3, 0xfe, 0x37, 0x74, 0xbb,
-    0xe2, 0x1a, 0xa3, 0x57, 0x7, 0xa2, 0x31, 0x91,
-    0x18, 0x3, 0x55, 0x73, 0x3, 0x99, 0x94, 0x4c,
-    0xc0, 0x40, 0x10, 0xfc, 0x88, 0x7, 0xde, 0x1,
-    0xab, 0xa0, 0xdb, 0xb2, 0x86, 0xf3, 0x0, 0x15,
-    0x2f, 0xf8, 0x9a, 0x2a, 0xee, 0x5b, 0x1, 0xb9,
-    0x5a, 0xd1, 0x6, 0xa0, 0x9, 0x4c, 0x1, 0x26,
-    0x0, 0xa2, 0x20, 0x5b, 0x4, 0xc0, 0x0, 0x48,
-    0x2, 0x16, 0xf0, 0x7d, 0x70, 0x40, 0xf, 0xde,
-    0x80, 0x3, 0x8c, 0x0, 0xfc, 0x22, 0x22, 0x5f,
-    0xf7, 0x24, 0x40, 0x30, 0x82, 0x7a, 0x44, 0xb8,
-    0xde, 0x69, 0x0,
+    0x0, 0x0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30,
+    0x7d, 0x12, 0x5, 0x12, 0x9, 0x10, 0x15, 0xfe,
+    0x39, 0x4, 0x55, 0x44, 0x11, 0x8, 0x10, 0x28,
+    0x12, 0x30, 0x12, 0x4c, 0x10, 0x82,
 
     /* U+88C5 "装" */
-    0x6, 0x70, 0x73, 0x0, 0xd6, 0x1, 0xe6, 0xc4,
-    0x7, 0x0, 0xce, 0x1, 0xf5, 0x8, 0x2, 0x2e,
-    0xe3, 0xbb, 0xa8, 0x2, 0x15, 0x0, 0x45, 0xdc,
-    0x77, 0x75, 0x0, 0x49, 0x5e, 0x1, 0xff, 0xd,
-    0x9d, 0xf8, 0x0, 0x46, 0x1, 0x18, 0x0, 0x36,
-    0xe2, 0x0, 0x28, 0xbb, 0x35, 0xdc, 0xa0, 0x1c,
-    0xa8, 0x59, 0xd5, 0x5c, 0xa0, 0xa, 0xaa, 0x2a,
-    0x91, 0x35, 0x5e, 0x0, 0x55, 0x6e, 0x1e, 0x7b,
-    0xaa, 0x5f, 0xd0, 0x6, 0x5c, 0xc5, 0x9d, 0xd0,
-    0xb5, 0xb0, 0x5, 0x54, 0x4, 0xc0, 0x0, 0xce,
-    0x5, 0x18, 0x5, 0x54, 0x5f, 0x13, 0x58, 0x3c,
-    0xf8, 0x10, 0xc, 0x77, 0x98, 0x40, 0xa1, 0x14,
-    0xdc, 0x50, 0x0,
+    0x0, 0x20, 0x20, 0x20, 0x3, 0xfe, 0x0, 0x20,
+    0x18, 0x20, 0x40, 0x20, 0x1, 0xfc, 0x0, 0x0,
+    0x7f, 0xfe, 0x2, 0x80, 0xc, 0x48, 0x68, 0x20,
+    0x0, 0x98, 0x1c, 0x6,
 
     /* U+8981 "要" */
-    0x7, 0xbb, 0xb7, 0x57, 0x6e, 0xcb, 0xb9, 0xc0,
-    0xf, 0x77, 0x45, 0xdc, 0xfd, 0x77, 0x38, 0x7,
-    0xff, 0x1e, 0xaa, 0x9a, 0xa9, 0x26, 0xa9, 0x60,
-    0x18, 0x6a, 0x93, 0x55, 0x24, 0xd5, 0x0, 0x3f,
-    0xf9, 0x39, 0x54, 0xfa, 0xa8, 0xa2, 0xa8, 0x60,
-    0x19, 0xea, 0x90, 0xd5, 0x4b, 0xaa, 0xa0, 0x0,
-    0x35, 0x77, 0x63, 0x5d, 0xfd, 0x42, 0x2a, 0xbb,
-    0x15, 0xe5, 0xdd, 0x3, 0x76, 0xa1, 0x0, 0x90,
-    0x94, 0x2, 0x2f, 0xb0, 0xf, 0xb7, 0x2a, 0x92,
-    0xff, 0xc2, 0x1, 0xf4, 0xbc, 0x92, 0xfa, 0x74,
-    0xa8, 0x6, 0x8b, 0xb5, 0x25, 0xe4, 0x4e, 0x59,
-    0x62, 0x80, 0x22, 0xed, 0x4e, 0x60, 0x18, 0x9f,
-    0x14, 0x0,
+    0x3f, 0xfc, 0x0, 0x40, 0x0, 0x40, 0x3f, 0xfc,
+    0x20, 0x44, 0x20, 0x44, 0x1f, 0xfc, 0x2, 0x0,
+    0x7f, 0xfe, 0x8, 0x10, 0x8, 0x20, 0x17, 0x40,
+    0x3, 0xf0, 0x78, 0x4, 0x0, 0x0,
 
     /* U+89E3 "解" */
-    0x0, 0xac, 0x3, 0x3d, 0xed, 0xdd, 0x40, 0x12,
-    0x3d, 0x6a, 0x3, 0xdd, 0x5d, 0xc2, 0x1, 0x76,
-    0xd0, 0xa0, 0x5, 0xe0, 0x1e, 0x67, 0x69, 0x77,
-    0x10, 0x45, 0x80, 0x42, 0x0, 0xd6, 0x52, 0x95,
-    0x88, 0x79, 0x95, 0x5f, 0x80, 0x2c, 0x48, 0x48,
-    0x83, 0x8a, 0x9, 0x56, 0xa0, 0x13, 0xcb, 0xcc,
-    0x81, 0x24, 0x28, 0x3, 0xcd, 0xf, 0x10, 0x3,
-    0x5b, 0x2b, 0xb5, 0x8, 0x0, 0x44, 0x2, 0x20,
-    0x8f, 0xb2, 0xbb, 0x50, 0x80, 0xa5, 0x3d, 0x50,
-    0x38, 0x40, 0x3e, 0x36, 0xad, 0xaa, 0x7, 0xdd,
-    0x8e, 0xee, 0x50, 0x7d, 0x0, 0xea, 0xbb, 0x1d,
-    0xdc, 0xa1, 0x88, 0x1, 0xff, 0xc2, 0x31, 0x0,
-    0x55, 0x30, 0x2, 0x60, 0xe, 0xa0, 0xa, 0xa8,
-    0xe0, 0x15, 0x0, 0x60,
+    0x10, 0x7e, 0x1c, 0x2, 0x24, 0x22, 0x2c, 0x42,
+    0x69, 0x8c, 0x29, 0x0, 0x3f, 0x50, 0x29, 0x7e,
+    0x29, 0x90, 0x3f, 0x10, 0x21, 0xfe, 0x1, 0x10,
+    0x41, 0x10, 0x46, 0x10, 0x0, 0x0,
 
     /* U+8D70 "走" */
-    0x0, 0xf9, 0x94, 0x3, 0xf9, 0x2e, 0xfa, 0x2e,
-    0xf3, 0x80, 0x64, 0xbb, 0xe8, 0xbb, 0xce, 0x1,
-    0xff, 0xc7, 0x12, 0x2e, 0xe2, 0x2f, 0x8, 0x1,
-    0xae, 0xf9, 0x2e, 0xfc, 0xc0, 0x7, 0x99, 0xea,
-    0xa4, 0xcf, 0x38, 0x6, 0x57, 0x0, 0xff, 0xe1,
-    0x69, 0x80, 0x57, 0x7d, 0x0, 0x1c, 0x80, 0x1a,
-    0xef, 0xa0, 0x3, 0xb, 0xf0, 0x7, 0xff, 0x6,
-    0x7f, 0xa8, 0x3, 0xfe, 0x33, 0x22, 0x3f, 0x30,
-    0x1, 0xfd, 0xf4, 0x0, 0x5d, 0xcd, 0xcc, 0xeb,
-    0x0, 0x60, 0x80, 0x42, 0xd7, 0x99, 0xd6, 0x0,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0xfc, 0x10, 0x0, 0x18, 0x0, 0x24, 0x0,
+    0x23, 0x0, 0x40, 0xfe, 0x0, 0x0,
 
     /* U+8D76 "赶" */
-    0x0, 0xd4, 0x1, 0xff, 0xc3, 0x60, 0x9, 0x2e,
-    0xdb, 0x76, 0x60, 0x3, 0x55, 0xa, 0xa8, 0xa9,
-    0x76, 0x1b, 0xb3, 0x0, 0x1a, 0xa8, 0xb5, 0x45,
-    0x0, 0xfe, 0x55, 0x99, 0x54, 0x80, 0x1f, 0xcc,
-    0x23, 0xcf, 0x15, 0x42, 0xaa, 0x48, 0x0, 0xd5,
-    0x1d, 0x10, 0x73, 0x76, 0x2b, 0xb4, 0x0, 0xe,
-    0x40, 0x38, 0x46, 0x1, 0x18, 0x0, 0xfe, 0xf,
-    0x76, 0x70, 0xf, 0xe1, 0xe0, 0x7b, 0xb3, 0x80,
-    0x7f, 0x1b, 0x88, 0x7, 0xff, 0x7, 0xee, 0x80,
-    0x3e, 0x70, 0xe, 0x25, 0xc4, 0x40, 0x7, 0x58,
-    0x6, 0x23, 0x7, 0xcd, 0xcc, 0xfd, 0x62, 0x50,
-    0x0, 0x39, 0xcc, 0xfd, 0x62,
+    0x8, 0x0, 0x8, 0x7c, 0x3e, 0x10, 0x8, 0x10,
+    0x8, 0x10, 0x8, 0xfe, 0x8, 0x10, 0x28, 0x10,
+    0xe, 0x10, 0x28, 0x10, 0x28, 0x10, 0x58, 0x10,
+    0x48, 0x0, 0x47, 0xfe, 0x0, 0x0,
 
     /* U+8D77 "起" */
-    0x0, 0xd6, 0x1, 0x15, 0xdf, 0x30, 0x1, 0xa6,
-    0x4b, 0x32, 0x42, 0xbb, 0xd3, 0xe0, 0x6, 0x88,
-    0x14, 0x41, 0x0, 0x3f, 0xc2, 0x27, 0x11, 0x0,
-    0x7f, 0x99, 0xbc, 0xa0, 0x1f, 0xfc, 0x5b, 0xbd,
-    0xc0, 0x13, 0x37, 0x94, 0x86, 0xee, 0xc8, 0x0,
-    0x1c, 0x0, 0x7f, 0xc2, 0x0, 0x7f, 0x0, 0x5d,
-    0xa0, 0x3, 0xf8, 0x78, 0x1, 0x76, 0x80, 0xf,
-    0x1b, 0x1, 0xb8, 0x7, 0xfc, 0xa6, 0x1f, 0x74,
-    0x1, 0x88, 0xee, 0xf6, 0x28, 0x12, 0xea, 0x20,
-    0x2, 0x9b, 0xbd, 0x40, 0x66, 0x7, 0xcd, 0xcc,
-    0x5e, 0x67, 0x8c, 0xd0, 0x0, 0x39, 0xcc, 0x5e,
-    0x67, 0x8c,
+    0x8, 0x7c, 0x3e, 0x2, 0x8, 0x2, 0x8, 0x2,
+    0x8, 0x2, 0x8, 0x7e, 0x8, 0x40, 0x28, 0x40,
+    0xf, 0x40, 0x28, 0x40, 0x28, 0x40, 0x58, 0x7e,
+    0x48, 0x0, 0x47, 0xfe, 0x0, 0x0,
 
     /* U+8D8A "越" */
-    0x0, 0xd4, 0x1, 0xea, 0x1a, 0x0, 0x89, 0x54,
-    0xea, 0xa1, 0x0, 0x84, 0x53, 0x0, 0x10, 0x8f,
-    0x9a, 0xa8, 0xb5, 0x24, 0x80, 0x48, 0x87, 0x44,
-    0x6, 0xd5, 0xa, 0xaa, 0x40, 0xf, 0xf9, 0xc0,
-    0x6, 0x3, 0x77, 0x2d, 0xd9, 0x40, 0x3d, 0x20,
-    0x37, 0x72, 0xdd, 0x94, 0x2, 0x22, 0x2f, 0x80,
-    0xa, 0x0, 0x3f, 0x7b, 0xf2, 0x80, 0x7, 0xc1,
-    0xee, 0xc6, 0x3, 0x25, 0x7e, 0x1, 0x3e, 0x83,
-    0xdd, 0x8d, 0x6e, 0xc2, 0x8, 0x12, 0x4, 0xe2,
-    0x0, 0x2b, 0xaa, 0x37, 0x32, 0x90, 0x87, 0xf6,
-    0xb8, 0x15, 0xa3, 0x75, 0xc7, 0xf5, 0x1, 0x9a,
-    0x4d, 0x0, 0x26, 0xa0, 0x5, 0x61, 0x26, 0x2,
-    0xee, 0x66, 0xbc, 0xce, 0x34, 0x60, 0x1, 0x46,
-    0x65, 0x79, 0x9c, 0x60,
+    0x8, 0x14, 0x8, 0x12, 0x8, 0x7e, 0x8, 0x90,
+    0x8, 0x90, 0x7e, 0x92, 0x8, 0x90, 0x28, 0x84,
+    0xe, 0xa8, 0x28, 0xc9, 0x29, 0x19, 0x58, 0x26,
+    0x48, 0x0, 0x7, 0xfe, 0x0, 0x0,
 
     /* U+8DD1 "跑" */
-    0x0, 0xfc, 0xa0, 0x1f, 0x9e, 0xee, 0xa0, 0x4,
-    0x80, 0x7e, 0xcb, 0xb8, 0x41, 0xa, 0xab, 0x38,
-    0x7, 0xf7, 0x65, 0xde, 0xc0, 0xf, 0xc8, 0x64,
-    0x23, 0x80, 0x36, 0x5d, 0xc2, 0x5f, 0x55, 0x28,
-    0x7, 0x3d, 0x85, 0xd3, 0x6d, 0x55, 0xe0, 0x1c,
-    0x40, 0x1f, 0xc2, 0x1, 0xd0, 0x0, 0xa8, 0x0,
-    0xe1, 0x7, 0x0, 0xf5, 0xc0, 0x2, 0xee, 0xf0,
-    0xf, 0xc2, 0x1, 0x5d, 0xdb, 0x4c, 0x1, 0xff,
-    0xc1, 0x8a, 0xa0, 0x6, 0x17, 0x9b, 0x0, 0xfc,
-    0xc0, 0x4f, 0xb7, 0x56, 0x2, 0x1, 0xed, 0x2,
-    0xcc, 0x39, 0x80, 0x32, 0xea, 0xb5, 0x98, 0x0,
+    0x0, 0x0, 0x3c, 0x80, 0x44, 0xf8, 0x45, 0x4,
+    0x45, 0x4, 0x3c, 0xe4, 0x11, 0x14, 0x11, 0x14,
+    0x5d, 0x14, 0x51, 0xe4, 0x51, 0x1c, 0x51, 0x0,
+    0x5d, 0x0, 0x61, 0x2, 0x0, 0xfe,
 
     /* U+8DDF "跟" */
-    0x7, 0xbb, 0xc0, 0xd7, 0x7e, 0x0, 0x65, 0xdc,
-    0x0, 0xca, 0xbb, 0xc0, 0x1f, 0xfc, 0xda, 0xbb,
-    0xca, 0x0, 0xcb, 0xb8, 0x2, 0x9a, 0xac, 0x40,
-    0x7, 0xb0, 0xbb, 0x0, 0xc, 0x47, 0x38, 0x0,
-    0xc0, 0x3d, 0x73, 0x39, 0xc0, 0x12, 0x0, 0xaa,
-    0x20, 0x4c, 0x2c, 0x43, 0x0, 0x3a, 0xec, 0x80,
-    0x42, 0xc6, 0x16, 0x80, 0x18, 0x44, 0x1, 0xbe,
-    0x2a, 0x10, 0x3, 0xfc, 0xaf, 0x46, 0x1, 0x13,
-    0xd5, 0xa8, 0x6, 0xb8, 0x0, 0x1b, 0xc5, 0x5d,
-    0x94, 0x62, 0xe9, 0x2, 0x0, 0xf6, 0x98, 0x42,
-    0x72, 0xae, 0x8a, 0x7e, 0x40,
+    0x3c, 0xfc, 0x8a, 0x9, 0x14, 0x12, 0x2f, 0xe3,
+    0xd0, 0x42, 0x20, 0x84, 0x7f, 0x2e, 0x90, 0x51,
+    0x24, 0xa2, 0x31, 0x44, 0x42, 0xe8, 0x46, 0x1e,
+    0xc0, 0x40, 0x40,
 
     /* U+8DEF "路" */
-    0x7, 0xbb, 0xb0, 0x2, 0xb0, 0xf, 0x6d, 0xdc,
-    0xc2, 0x8, 0xb7, 0x73, 0x0, 0x7f, 0x4d, 0xdd,
-    0xa4, 0x1, 0xfa, 0xaf, 0xc0, 0x1a, 0x80, 0xd,
-    0xbb, 0x92, 0xf5, 0xb9, 0xe6, 0x0, 0x27, 0xb2,
-    0xae, 0xa7, 0x4, 0xd0, 0x30, 0x8, 0x80, 0x3e,
-    0x73, 0x32, 0x0, 0x56, 0x21, 0x10, 0x13, 0xb0,
-    0x9a, 0xd8, 0x0, 0xea, 0xa4, 0x41, 0xb2, 0xec,
-    0x4d, 0x0, 0x18, 0x89, 0x36, 0xd7, 0x78, 0xa0,
-    0x3, 0xff, 0x8e, 0xae, 0x40, 0x1f, 0xc5, 0x69,
-    0xc4, 0x40, 0xf, 0xc6, 0x69, 0xda, 0x50, 0x2,
-    0xdd, 0xe1, 0x3, 0x83, 0x0, 0xee, 0xbb, 0xda,
-    0x0,
+    0x3c, 0x40, 0x88, 0xf1, 0x12, 0x2, 0x2a, 0x43,
+    0xe1, 0x2, 0x6, 0x4, 0xc, 0x2e, 0x46, 0x53,
+    0xfe, 0xa1, 0x9, 0x42, 0x12, 0x84, 0x27, 0x88,
+    0x48, 0x1f, 0x80, 0x0, 0x0,
 
     /* U+8DF3 "跳" */
-    0x7, 0xbb, 0xa0, 0x2, 0xa0, 0xa0, 0xe, 0xcb,
-    0xb8, 0xc0, 0x21, 0x1, 0x0, 0x8, 0x7, 0xc8,
-    0xe0, 0x1c, 0x34, 0x1, 0xf2, 0x60, 0x7, 0x4f,
-    0x80, 0x32, 0xed, 0x46, 0x1a, 0xa0, 0x11, 0x11,
-    0x0, 0xf, 0x63, 0x50, 0xc, 0x80, 0x10, 0xd8,
-    0x4, 0x80, 0x1e, 0x10, 0x8, 0xc4, 0x2, 0xd0,
-    0x5, 0xc0, 0x1, 0x0, 0x2b, 0x20, 0xf, 0x5c,
-    0xc, 0xe8, 0x80, 0x2a, 0x4c, 0x3, 0xeb, 0xad,
-    0x20, 0x0, 0xdc, 0x80, 0x7d, 0x47, 0xb8, 0x1,
-    0xa8, 0x2, 0x16, 0x9b, 0x11, 0x2a, 0x0, 0x64,
-    0x3, 0x4b, 0xab, 0xb0, 0x57, 0x80, 0x77, 0x81,
-    0xed, 0x31, 0x13, 0x7c, 0xc0, 0x5, 0x76, 0x10,
-    0xf, 0x16, 0xa0, 0x5, 0x37, 0x6a, 0x0,
+    0x3c, 0x50, 0x44, 0x50, 0x44, 0x52, 0x45, 0x54,
+    0x3c, 0x54, 0x10, 0x50, 0x10, 0x50, 0x5c, 0x58,
+    0x51, 0xd4, 0x52, 0x52, 0x50, 0x90, 0x5c, 0x90,
+    0x61, 0x12, 0x2, 0x1e, 0x0, 0x0,
 
     /* U+8EAB "身" */
-    0x0, 0xf1, 0x50, 0x7, 0xfa, 0x2e, 0xd2, 0x37,
-    0x78, 0x3, 0xc7, 0x77, 0xf3, 0x80, 0x7d, 0x55,
-    0xf1, 0x0, 0x7d, 0x55, 0xf1, 0x0, 0x7f, 0xf1,
-    0x2c, 0xc0, 0x35, 0x57, 0xc5, 0x18, 0x60, 0x1a,
-    0xab, 0xe2, 0x7, 0x1, 0x67, 0x6a, 0xa5, 0xda,
-    0xa9, 0x65, 0x0, 0x1, 0x33, 0x74, 0x55, 0xdb,
-    0x1a, 0x48, 0x3, 0x2a, 0x19, 0x1, 0x5f, 0xe1,
-    0x0, 0x7e, 0x29, 0xe8, 0x90, 0xf, 0xcb, 0x7d,
-    0xb8, 0x60, 0x1f, 0xe, 0xe4, 0x62, 0x0, 0x33,
-    0x26, 0x0, 0x80,
+    0x1, 0x0, 0x3f, 0xe0, 0x40, 0x40, 0xff, 0x81,
+    0x1, 0x2, 0x2, 0x87, 0xfe, 0x8, 0xc, 0x1f,
+    0xf0, 0x0, 0xa0, 0x6, 0x40, 0x30, 0x81, 0x81,
+    0xc, 0x1e, 0x0,
 
     /* U+8FD0 "运" */
-    0x1, 0xa5, 0x0, 0x4d, 0xdf, 0xa8, 0x2, 0x1a,
-    0x25, 0x9, 0xbb, 0xf5, 0x0, 0x73, 0xa8, 0x7,
-    0xff, 0x2, 0x10, 0x3, 0xff, 0x85, 0x7, 0x41,
-    0x37, 0x7f, 0xc2, 0x0, 0x7b, 0x9, 0xbb, 0xf,
-    0xdd, 0xf0, 0x80, 0x42, 0x1, 0x9d, 0x0, 0x40,
-    0x30, 0xdd, 0x9c, 0x2, 0x45, 0x0, 0x14, 0x80,
-    0x43, 0x76, 0xc0, 0xb, 0xa8, 0x0, 0x7c, 0xc0,
-    0x1c, 0xe0, 0x1, 0x11, 0x0, 0x91, 0xd9, 0x0,
-    0x79, 0xf1, 0xb3, 0x15, 0x79, 0x50, 0x1, 0x11,
-    0x5, 0xf7, 0x59, 0x8b, 0x98, 0x7c, 0x0, 0x27,
-    0x55, 0x10, 0x3, 0xf3, 0x0, 0xc6, 0xa5, 0x9d,
-    0xdd, 0x55, 0xae, 0xc0, 0x38, 0x20, 0x7, 0xbb,
-    0xaa, 0xb5, 0xd8, 0x0,
+    0x23, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0,
+    0x17, 0xfe, 0x0, 0x80, 0x0, 0x80, 0x60, 0x88,
+    0x11, 0x0, 0x11, 0x4, 0x13, 0xfa, 0x10, 0x0,
+    0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+8FD1 "近" */
-    0x7, 0x70, 0x7, 0x8d, 0x62, 0x60, 0x2, 0x70,
-    0xa0, 0xa, 0xd9, 0xdd, 0x13, 0x0, 0x19, 0xf0,
-    0xc0, 0x41, 0x90, 0x80, 0x3f, 0x31, 0x80, 0x7f,
-    0xf1, 0x9a, 0x23, 0xe2, 0x0, 0xf9, 0xae, 0xe5,
-    0xbb, 0x88, 0x6e, 0xe0, 0x1, 0x9f, 0x9, 0x9c,
-    0x3, 0x76, 0x70, 0x3, 0xf0, 0x7, 0xff, 0xb,
-    0x10, 0x3, 0xff, 0x82, 0x24, 0x40, 0xf, 0xfe,
-    0xc, 0x78, 0x7, 0xfc, 0x24, 0x98, 0x80, 0x19,
-    0xc0, 0x38, 0xf2, 0xbc, 0xc0, 0x3a, 0x80, 0x30,
-    0xff, 0x92, 0xc2, 0xee, 0xaa, 0x5d, 0x5d, 0x88,
-    0x70, 0x80, 0xd, 0x77, 0x55, 0x6b, 0xb1, 0x0,
+    0x0, 0x1c, 0x11, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0xfe, 0x1, 0x10, 0x71, 0x10, 0x10, 0x10,
+    0x12, 0x10, 0x12, 0x10, 0x14, 0x10, 0x10, 0x10,
+    0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+9001 "送" */
-    0x0, 0xff, 0xe2, 0xbb, 0x80, 0x25, 0x60, 0xd,
-    0x26, 0x1, 0x38, 0x50, 0x1, 0x74, 0x40, 0x6,
-    0x70, 0x6, 0x7c, 0x30, 0x4, 0x28, 0x1, 0x6c,
-    0x3, 0xcc, 0x66, 0xb8, 0xfd, 0xda, 0xad, 0x40,
-    0x3c, 0x77, 0x75, 0x45, 0xdc, 0xa0, 0x1f, 0xfc,
-    0x51, 0xbb, 0x82, 0x6e, 0xea, 0x8b, 0xba, 0x80,
-    0x6e, 0xce, 0x13, 0x77, 0x30, 0xdd, 0xd4, 0x1,
-    0xfc, 0x43, 0x2c, 0x1, 0xff, 0xf, 0x5a, 0xe9,
-    0x0, 0x7f, 0x26, 0xf0, 0x85, 0x72, 0x0, 0x61,
-    0x24, 0x46, 0xe8, 0x80, 0x3, 0x98, 0x90, 0x1,
-    0xe5, 0x79, 0x48, 0x80, 0x74, 0x48, 0xf, 0xf9,
-    0x2c, 0x2e, 0xea, 0xad, 0x76, 0x1, 0xc2, 0x0,
-    0x35, 0xdd, 0x55, 0xae, 0xc0,
+    0x0, 0x0, 0x0, 0x8, 0x11, 0x8, 0x0, 0x0,
+    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x77, 0xfe,
+    0x10, 0x60, 0x10, 0x40, 0x10, 0x90, 0x11, 0x8,
+    0x12, 0x6, 0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+901A "通" */
-    0x0, 0xff, 0xe2, 0xc3, 0x0, 0x6, 0xab, 0xd7,
-    0xe8, 0x0, 0x8f, 0x60, 0x1a, 0xaf, 0x4, 0xa0,
-    0x5, 0x3e, 0x20, 0x2, 0xa8, 0x5a, 0x86, 0x0,
-    0xe9, 0x10, 0x1, 0xde, 0xc8, 0x8, 0x80, 0x3e,
-    0x1c, 0x99, 0x78, 0x15, 0x5b, 0x0, 0x78, 0xd6,
-    0x21, 0x29, 0x10, 0x9e, 0x1, 0xbb, 0x80, 0x9,
-    0x54, 0x85, 0xaa, 0x40, 0x0, 0x6e, 0xc0, 0x12,
-    0x55, 0x21, 0x6a, 0x90, 0x1, 0xf9, 0x2a, 0x90,
-    0xb5, 0x48, 0x0, 0xfc, 0x95, 0x48, 0x5a, 0xa4,
-    0x0, 0x7f, 0xf2, 0x5, 0x50, 0xf8, 0x0, 0x3c,
-    0x35, 0x3a, 0x0, 0x4c, 0xaf, 0x67, 0x0, 0x13,
-    0xd, 0x51, 0x40, 0xa3, 0x12, 0xc6, 0xee, 0xaa,
-    0xeb, 0x22, 0x60, 0x80, 0x1a, 0xee, 0xab, 0xba,
-    0xac, 0x80,
+    0x0, 0x0, 0x43, 0xfc, 0x20, 0x8, 0x10, 0xd0,
+    0x0, 0x30, 0x3, 0xfc, 0x2, 0x22, 0x73, 0xfe,
+    0x12, 0x22, 0x13, 0xfe, 0x12, 0x22, 0x12, 0x22,
+    0x10, 0xc, 0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+9020 "造" */
-    0xa, 0x50, 0xc, 0xe1, 0x40, 0x1f, 0x56, 0x38,
-    0x1, 0xc8, 0x4, 0x3, 0xf4, 0xf8, 0x8a, 0xba,
-    0xd6, 0xef, 0x10, 0x6, 0x81, 0xbe, 0xbb, 0x2d,
-    0xde, 0x20, 0xf, 0x71, 0x80, 0x7f, 0xf0, 0x47,
-    0xae, 0xe0, 0xbb, 0xd4, 0x7, 0x77, 0xd, 0x5d,
-    0xfe, 0xa0, 0x3b, 0xb3, 0x80, 0x1e, 0xef, 0xce,
-    0x1, 0xfb, 0x2e, 0xfe, 0x0, 0xfc, 0xe0, 0x1f,
-    0xfc, 0x37, 0x0, 0xff, 0x84, 0x8c, 0x3e, 0xab,
-    0xd2, 0x1, 0x1e, 0xd4, 0x32, 0x55, 0x79, 0x40,
-    0x3, 0xfc, 0x96, 0x17, 0x75, 0x56, 0xbb, 0x0,
-    0xe1, 0x0, 0x1a, 0xee, 0xaa, 0xd7, 0x60,
+    0x40, 0x40, 0x20, 0x40, 0x13, 0xfc, 0x4, 0x40,
+    0x0, 0x40, 0x7, 0xfe, 0x70, 0x0, 0x11, 0xf8,
+    0x12, 0x4, 0x12, 0x4, 0x12, 0x4, 0x11, 0xf8,
+    0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+9053 "道" */
-    0x0, 0xff, 0xe2, 0xb4, 0x0, 0x6a, 0x0, 0xd6,
-    0x1, 0x9b, 0xa8, 0x2, 0xc4, 0x0, 0x4f, 0x80,
-    0x73, 0x7a, 0x55, 0x33, 0xb9, 0x87, 0xd5, 0x40,
-    0xc, 0xa9, 0x55, 0x97, 0x2a, 0xb0, 0x7, 0xcf,
-    0x54, 0xa, 0xa9, 0xc0, 0x3f, 0x65, 0x52, 0xea,
-    0xab, 0x0, 0xae, 0xe0, 0xa, 0xab, 0xc0, 0x1a,
-    0xec, 0xe0, 0x15, 0x57, 0x80, 0x3f, 0xd5, 0x5e,
-    0x0, 0xff, 0x55, 0x78, 0x3, 0xff, 0x92, 0x24,
-    0x61, 0xf5, 0x5e, 0x80, 0x8, 0xf2, 0xa1, 0x92,
-    0xab, 0xc8, 0x0, 0x1f, 0xf2, 0x58, 0x5d, 0xd5,
-    0x5a, 0xec, 0x22, 0xc2, 0x0, 0x35, 0xdd, 0x55,
-    0xae, 0xc2,
+    0x0, 0x0, 0x21, 0x8, 0x10, 0x10, 0x7, 0xfe,
+    0x0, 0x40, 0x1, 0xf8, 0x2, 0x4, 0x73, 0xfc,
+    0x12, 0x4, 0x13, 0xfc, 0x12, 0x4, 0x12, 0x4,
+    0x11, 0xf8, 0x28, 0x0, 0x43, 0xfe, 0x0, 0x0,
 
     /* U+90A3 "那" */
-    0xa, 0xbc, 0xeb, 0xb8, 0xf, 0x2e, 0xd9, 0x41,
-    0x57, 0xed, 0x76, 0x70, 0x48, 0xbb, 0x56, 0x0,
-    0x4f, 0xe0, 0x1f, 0xb5, 0x80, 0x3f, 0xf8, 0x9,
-    0xa0, 0x8, 0xb9, 0xab, 0xb1, 0x0, 0x6e, 0x60,
-    0x4, 0x5d, 0xa2, 0xec, 0x40, 0x1f, 0xe1, 0x60,
-    0xf, 0x89, 0xc0, 0x37, 0x8, 0x7, 0xd1, 0xa6,
-    0x13, 0x6f, 0x37, 0x61, 0x0, 0xe8, 0xa0, 0x9b,
-    0x5b, 0xb8, 0x40, 0x38, 0x88, 0x0, 0x43, 0x0,
-    0xfe, 0x31, 0x0, 0x75, 0x0, 0x7d, 0x17, 0x36,
-    0x8, 0x4, 0x0, 0x27, 0x0, 0xa2, 0xe8, 0x43,
-    0xec, 0x13, 0x3f, 0x80, 0xe, 0x1, 0xd6, 0x20,
-    0x99, 0xaa, 0xe, 0x60, 0x18,
+    0x7f, 0x3e, 0x12, 0x0, 0x4, 0x10, 0x8, 0x7,
+    0xf0, 0x80, 0x21, 0x0, 0x42, 0x8, 0x82, 0x7f,
+    0x2, 0x22, 0x4, 0x44, 0x9, 0x8, 0xe2, 0x10,
+    0x8, 0xc0, 0x0, 0x0, 0x0,
 
     /* U+90E8 "部" */
-    0x0, 0xcc, 0x80, 0x10, 0xee, 0x65, 0xc0, 0x7,
-    0xaa, 0xa2, 0xa8, 0xcb, 0x59, 0x8f, 0x40, 0x3,
-    0xc5, 0xee, 0xae, 0x58, 0x3, 0x54, 0x0, 0x54,
-    0x62, 0x25, 0xb0, 0xe, 0x32, 0x0, 0xb1, 0x40,
-    0x1d, 0x40, 0x19, 0xa4, 0x3, 0x21, 0x80, 0x30,
-    0x80, 0x36, 0x10, 0x0, 0x6f, 0x23, 0x31, 0x59,
-    0x40, 0x16, 0x68, 0x0, 0x6f, 0x33, 0xd4, 0x1,
-    0x32, 0xb8, 0x5, 0x37, 0x7a, 0x0, 0x3a, 0x6c,
-    0x0, 0x27, 0x77, 0x8c, 0x3, 0xff, 0xae, 0x37,
-    0x69, 0x0, 0x92, 0xef, 0x28, 0x4, 0x37, 0x65,
-    0x0, 0xb, 0xdd, 0xe7, 0x7, 0x0, 0xf0,
+    0x0, 0x3e, 0x3f, 0x2, 0x0, 0x4, 0x21, 0x4,
+    0x2, 0x0, 0x0, 0x8, 0x7f, 0x84, 0x0, 0x4,
+    0x3f, 0x2, 0x21, 0x2, 0x21, 0x2, 0x21, 0xc,
+    0x3f, 0x0, 0x21, 0x0,
 
     /* U+90FD "都" */
-    0x0, 0xff, 0xe4, 0x50, 0x5, 0x61, 0x99, 0xbc,
-    0x40, 0xe6, 0x49, 0x32, 0x7d, 0x26, 0xcc, 0x72,
-    0x8, 0x1d, 0xd8, 0xae, 0xb1, 0x80, 0x35, 0xc0,
-    0x4, 0x44, 0x72, 0x89, 0x0, 0xc2, 0x66, 0x1,
-    0x99, 0x96, 0xda, 0xe4, 0x2, 0x69, 0x0, 0xc,
-    0x5d, 0x93, 0x3e, 0xe0, 0x2, 0xd3, 0x0, 0x84,
-    0xa0, 0x9c, 0x88, 0x20, 0x17, 0x58, 0x4, 0x7a,
-    0xe5, 0x54, 0xb1, 0x0, 0x93, 0x60, 0xa, 0x12,
-    0x6a, 0xa3, 0x20, 0xc, 0xc8, 0x5, 0x7f, 0xd1,
-    0x12, 0x0, 0x79, 0x84, 0x2, 0xc9, 0x99, 0x40,
-    0x3c, 0xc2, 0x1, 0x10, 0x8e, 0x0, 0x8b, 0x36,
-    0x40, 0x34, 0x5d, 0xca, 0x1, 0x16, 0x6a, 0x80,
-    0x68, 0xbb, 0xa8, 0xc, 0xc0, 0x1f, 0x32, 0x0,
-    0x4e, 0x63, 0x20, 0x1c,
+    0x0, 0x0, 0x8, 0xbe, 0x3e, 0x22, 0x9, 0x24,
+    0xa, 0x24, 0x7f, 0xa0, 0x8, 0x28, 0x18, 0x24,
+    0x3f, 0x22, 0x61, 0x22, 0x1f, 0x22, 0x1, 0x22,
+    0x1, 0x2c, 0x1f, 0x20, 0x0, 0x20, 0x0, 0x0,
 
     /* U+91CC "里" */
-    0x0, 0x26, 0x5d, 0xdb, 0xab, 0xbc, 0xe0, 0x18,
-    0xe6, 0xee, 0x8b, 0xbd, 0x3a, 0x1, 0xff, 0xc9,
-    0x9b, 0xba, 0x2e, 0xf4, 0x80, 0x7a, 0x6e, 0xe8,
-    0xbb, 0xd2, 0x1, 0xff, 0xc9, 0x39, 0xbb, 0xa2,
-    0xef, 0x76, 0x0, 0x64, 0xcb, 0xbf, 0xd8, 0xc0,
-    0x1f, 0xfc, 0x8a, 0xbb, 0xff, 0x84, 0x2, 0xab,
-    0xbf, 0xf8, 0x40, 0x3f, 0xf8, 0xd3, 0x3e, 0xaa,
-    0x4c, 0xf8, 0x1, 0x17, 0x7d, 0xdc, 0xbb, 0xe8,
-    0x0,
+    0x1f, 0xf8, 0x0, 0x4, 0x0, 0x4, 0x1f, 0xfc,
+    0x0, 0x4, 0x0, 0x4, 0x1f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0x0, 0x0,
 
     /* U+91CD "重" */
-    0x0, 0xff, 0xe3, 0x2c, 0xce, 0xba, 0x76, 0x62,
-    0x0, 0x72, 0xcc, 0xec, 0xf7, 0x66, 0x20, 0x6,
-    0x9a, 0xaf, 0x4d, 0x57, 0x48, 0x2, 0x6a, 0xbd,
-    0x35, 0x5d, 0x20, 0x10, 0xcd, 0x55, 0x73, 0x55,
-    0x49, 0x0, 0x64, 0xca, 0xaa, 0xe6, 0xaa, 0xd5,
-    0x0, 0xc7, 0xd3, 0x35, 0xf4, 0xcd, 0xe0, 0x1e,
-    0xe9, 0x9a, 0xfa, 0x66, 0xf0, 0xe, 0x5e, 0x99,
-    0xaf, 0xa6, 0x6f, 0x20, 0xc, 0x77, 0x33, 0x5f,
-    0x4c, 0xd6, 0xa0, 0x1a, 0x2a, 0xb5, 0xcd, 0x56,
-    0x90, 0xd, 0x15, 0x5a, 0xe6, 0xab, 0x48, 0x7,
-    0xff, 0x1e, 0xae, 0xfa, 0xa6, 0xef, 0xa8, 0x0,
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
 
     /* U+91CE "野" */
-    0x8, 0xaa, 0x75, 0xd5, 0x9d, 0xde, 0xcd, 0x0,
-    0x1d, 0x51, 0x6e, 0x84, 0xae, 0xf2, 0xc0, 0x7,
-    0xf8, 0x94, 0x18, 0x54, 0x2, 0xaa, 0x2d, 0x51,
-    0x0, 0xb7, 0x3e, 0x0, 0x35, 0x51, 0x6a, 0x88,
-    0x0, 0x88, 0x28, 0x80, 0x42, 0x1, 0xe2, 0x66,
-    0x12, 0xda, 0x88, 0x75, 0x51, 0x6e, 0x88, 0x4c,
-    0xd7, 0x9f, 0x6, 0x9, 0x54, 0x5b, 0xa8, 0x25,
-    0x50, 0xaa, 0x98, 0x80, 0x3f, 0xf8, 0x2f, 0xc0,
-    0x7, 0xbb, 0x2d, 0xda, 0x80, 0x39, 0x54, 0x0,
-    0x7b, 0xb2, 0xdd, 0xa8, 0x3, 0x88, 0x3, 0xe1,
-    0x25, 0x30, 0xf, 0xcf, 0x36, 0xf7, 0x40, 0x40,
-    0x1f, 0x92, 0x2f, 0x2a, 0x14, 0x6e, 0xce, 0x1,
-    0x80,
+    0x7f, 0x7e, 0x49, 0x4, 0x49, 0x4, 0x7f, 0x38,
+    0x49, 0x8, 0x49, 0xc, 0x3f, 0x12, 0x8, 0x12,
+    0x8, 0x10, 0x3f, 0x10, 0x8, 0x10, 0x8, 0x10,
+    0x3e, 0x10, 0x0, 0x70,
 
     /* U+91CF "量" */
-    0x0, 0xae, 0x67, 0xf5, 0x80, 0x70, 0x8a, 0x67,
-    0xf0, 0x88, 0x3, 0x9e, 0x23, 0xf3, 0x80, 0x70,
-    0xb0, 0x8f, 0xe6, 0x10, 0x8, 0xcd, 0x15, 0x5f,
-    0xa0, 0xcc, 0x0, 0x44, 0xff, 0xe1, 0x0, 0x1d,
-    0xbb, 0xb6, 0xeb, 0xbb, 0x23, 0x80, 0x4f, 0xf1,
-    0x16, 0xe4, 0x45, 0x54, 0x0, 0xec, 0x66, 0xb7,
-    0x19, 0xab, 0x0, 0xe2, 0xf, 0xf8, 0x45, 0xff,
-    0xf, 0x0, 0x64, 0xa9, 0x9b, 0x36, 0x67, 0x38,
-    0x6, 0x79, 0x88, 0xae, 0xa2, 0x29, 0x80, 0xc,
-    0xf3, 0x3a, 0xa6, 0x7a, 0x0, 0x3, 0x55, 0xf4,
-    0xd5, 0x78, 0x40,
+    0x1f, 0xf8, 0x10, 0x8, 0x1f, 0xf8, 0x1f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x4,
+    0x11, 0x8c, 0x1f, 0xf8, 0x0, 0x0, 0x1f, 0xfc,
+    0x0, 0x0, 0x7f, 0xfe,
 
     /* U+95E8 "门" */
-    0x0, 0xfa, 0xc0, 0x3f, 0xf8, 0x2e, 0x1, 0xf6,
-    0x67, 0x8f, 0x33, 0xa4, 0x1f, 0x33, 0x8f, 0x33,
-    0x94, 0x3, 0xff, 0xaf, 0xc0, 0x1f, 0xfc, 0x12,
-    0x0, 0xff, 0xff, 0x80, 0x4, 0x3, 0xf1, 0x66,
-    0x10,
+    0x1, 0x0, 0x4, 0x7, 0xff, 0xd0, 0x41, 0x41,
+    0x5, 0x4, 0x14, 0x0, 0x50, 0x1, 0x40, 0x5,
+    0x0, 0x14, 0x0, 0x50, 0x1, 0x40, 0x5, 0x0,
+    0x70,
 
     /* U+9633 "阳" */
-    0x0, 0xff, 0xe0, 0xbd, 0xdd, 0xc1, 0x17, 0x7e,
-    0xdb, 0xb7, 0xc8, 0x25, 0xdf, 0x38, 0x5, 0xee,
-    0x1, 0xfe, 0x5d, 0x0, 0xff, 0xb5, 0xc0, 0x3f,
-    0xe9, 0xa1, 0x0, 0xff, 0xc, 0x40, 0x1, 0x77,
-    0xc6, 0x1, 0x19, 0x0, 0x2e, 0xf8, 0xc0, 0x3f,
-    0xf8, 0x45, 0x34, 0x60, 0x1f, 0xc5, 0x75, 0x0,
-    0x1f, 0xe2, 0x0, 0xff, 0xe2, 0xdd, 0xf1, 0x80,
-    0x79, 0x6e, 0xf9, 0x0,
+    0x0, 0x3, 0xdf, 0xe0, 0x83, 0x24, 0x18, 0x20,
+    0xd1, 0x6, 0x48, 0x31, 0x7f, 0x8a, 0xc, 0x50,
+    0x6e, 0x83, 0x4, 0x18, 0x20, 0xc1, 0xfe, 0x8,
+    0x20,
 
     /* U+96E8 "雨" */
-    0xb, 0xcc, 0xed, 0xd6, 0x67, 0x58, 0x2, 0xf3,
-    0x3a, 0xa3, 0x33, 0xac, 0x3, 0xff, 0x8f, 0x15,
-    0x5a, 0xe6, 0xab, 0x40, 0x4, 0x81, 0x11, 0x92,
-    0xa2, 0x30, 0x20, 0x5, 0xe0, 0x24, 0x4f, 0x36,
-    0x2, 0x27, 0x80, 0x71, 0x24, 0x88, 0x1, 0x6a,
-    0x0, 0x3f, 0x3d, 0xa0, 0x0, 0x62, 0xd0, 0x3,
-    0xf1, 0x28, 0x0, 0x40, 0xd0, 0x3, 0xc9, 0x44,
-    0x1, 0x34, 0x88, 0x7, 0xc9, 0x70, 0xa0, 0x7,
-    0xba, 0x30, 0xf, 0x86, 0x94, 0x2, 0x2b, 0x30,
-    0xf, 0xfe, 0x71, 0x8, 0x2, 0xee, 0x50, 0x2,
-    0x38, 0x6, 0x54, 0x0, 0x5d, 0xb0, 0x40,
+    0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
+    0x21, 0x4, 0x0, 0x0, 0x4, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0x20, 0x4, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1c, 0x0, 0x0,
 
     /* U+96EA "雪" */
-    0x8, 0xaa, 0xdd, 0x75, 0x59, 0x80, 0x11, 0x55,
-    0x8a, 0xea, 0xb3, 0x2, 0x55, 0xde, 0x2b, 0xbe,
-    0xa2, 0xfa, 0xbb, 0xc5, 0x77, 0xd3, 0x40, 0x9,
-    0xaa, 0x18, 0x1, 0xea, 0x8e, 0x0, 0xc0, 0x9a,
-    0xa1, 0x80, 0x1e, 0xa8, 0xe3, 0xae, 0x55, 0x52,
-    0x30, 0x3d, 0x52, 0x4d, 0x40, 0xaa, 0xa4, 0xa0,
-    0x7a, 0xa4, 0x88, 0x0, 0x6a, 0xbf, 0xa4, 0x2,
-    0x1a, 0xaf, 0xe5, 0x0, 0xd3, 0x55, 0xf8, 0x80,
-    0x34, 0xd5, 0x7e, 0x20, 0xf, 0xfe, 0x2a, 0x5d,
-    0xff, 0x8, 0x0,
+    0x7f, 0xf0, 0x8, 0x7, 0xff, 0xa0, 0x81, 0xba,
+    0x64, 0x8, 0x3, 0xa7, 0x0, 0x0, 0x3f, 0xf0,
+    0x0, 0x43, 0xff, 0x0, 0x4, 0x0, 0x10, 0xff,
+    0xc0,
 
     /* U+9752 "青" */
-    0x8, 0xaa, 0xd9, 0x8a, 0xae, 0x0, 0x45, 0x57,
-    0xfc, 0x0, 0x3a, 0xaf, 0xf1, 0x80, 0xe, 0xab,
-    0xfc, 0x61, 0x35, 0x5f, 0xfc, 0x9, 0x95, 0x57,
-    0x66, 0x2a, 0xba, 0x40, 0x7, 0x55, 0xf9, 0x40,
-    0x34, 0xdd, 0x57, 0xd2, 0x1, 0xd7, 0x55, 0xf0,
-    0x7, 0xae, 0xab, 0xe0, 0xf, 0x5d, 0x57, 0xc0,
-    0x1e, 0xba, 0xaf, 0x80, 0x3f, 0xf8, 0xe6, 0x1,
-    0xc7, 0x54, 0x50, 0xd, 0x22, 0x1, 0x8e, 0xa9,
-    0x20, 0x0,
+    0x7f, 0xf8, 0x0, 0x3, 0xff, 0x0, 0x0, 0xff,
+    0xfc, 0x0, 0x1, 0xfe, 0x8, 0x4, 0x3f, 0xf0,
+    0x80, 0x43, 0xff, 0x8, 0x4, 0x20, 0x10, 0x81,
+    0xc0, 0x0, 0x0,
 
     /* U+975E "非" */
-    0x0, 0xc5, 0x0, 0x1, 0x90, 0xf, 0xf0, 0x80,
-    0xc, 0x3, 0xc9, 0x77, 0x70, 0x6, 0x7b, 0xbc,
-    0x69, 0x77, 0x70, 0x6, 0x7b, 0xbc, 0x60, 0x1f,
-    0xfc, 0x31, 0xbb, 0xb8, 0x3, 0x3d, 0xdd, 0x40,
-    0x37, 0x77, 0x0, 0x67, 0xbb, 0xa8, 0x3, 0x84,
-    0x40, 0x1f, 0xfc, 0x2, 0xb4, 0xa0, 0xf, 0xd1,
-    0x79, 0x6b, 0x34, 0x0, 0x7b, 0xbc, 0xd3, 0x79,
-    0x2, 0xa0, 0x13, 0xdd, 0xe6, 0x10, 0x5, 0xc0,
-    0x7, 0xff, 0x2, 0xb5, 0x0, 0x3f, 0xec, 0xf7,
-    0x0, 0xc6, 0x20, 0x1c,
+    0x4, 0x40, 0x8, 0x81, 0xf1, 0xf0, 0x22, 0x0,
+    0x44, 0xf, 0x8f, 0x81, 0x10, 0x2, 0x20, 0xe,
+    0x41, 0xf0, 0xf8, 0x21, 0x0, 0x82, 0x2, 0x4,
+    0x8, 0x8, 0x0,
 
     /* U+9762 "面" */
-    0xac, 0xce, 0xed, 0xcc, 0xea, 0xa, 0xcc, 0xe2,
-    0xcc, 0xf5, 0x0, 0x7e, 0x10, 0xf, 0xd3, 0x55,
-    0x59, 0x55, 0x74, 0x80, 0xc, 0x2e, 0xc3, 0x5f,
-    0x70, 0x17, 0x60, 0x30, 0x8, 0x44, 0x2, 0x31,
-    0x80, 0x88, 0x3, 0xf5, 0x56, 0x0, 0xff, 0xaa,
-    0xb0, 0x7, 0xff, 0x3a, 0xab, 0x0, 0x7f, 0xd5,
-    0x58, 0x3, 0xff, 0x94, 0xf7, 0x65, 0xbb, 0xa9,
-    0xee, 0xce, 0x0, 0x16, 0xbb, 0x75, 0xde, 0xdb,
-    0xb3, 0x8, 0x0,
+    0xff, 0xfc, 0x4, 0x0, 0x8, 0x3, 0xff, 0xc4,
+    0x84, 0x89, 0x9, 0x13, 0xf2, 0x24, 0x24, 0x48,
+    0x48, 0x9f, 0x91, 0x21, 0x22, 0x42, 0x47, 0xff,
+    0x88, 0x1, 0x0,
 
     /* U+9769 "革" */
-    0x0, 0xc6, 0x60, 0xc, 0x66, 0x0, 0xfc, 0xca,
-    0x1, 0x95, 0x40, 0x1c, 0xf7, 0x69, 0xbb, 0xfe,
-    0x70, 0x3, 0xdd, 0xa6, 0xef, 0xf9, 0xc0, 0x39,
-    0xf2, 0xae, 0xd5, 0x88, 0x1, 0xf8, 0xaa, 0x9b,
-    0xaa, 0xa1, 0x0, 0x78, 0x6e, 0xaa, 0xbb, 0x55,
-    0x56, 0x40, 0x19, 0x72, 0xaa, 0xbb, 0x55, 0x5a,
-    0x80, 0x1f, 0xfc, 0x85, 0xda, 0xaf, 0xda, 0x80,
-    0x18, 0x6a, 0xbf, 0xac, 0x80, 0x2b, 0xbf, 0xfe,
-    0x10, 0x2, 0xef, 0xff, 0x84, 0x1, 0xff, 0xcc,
-    0x33, 0x0, 0x7c,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x7, 0xe0, 0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+97F3 "音" */
-    0x0, 0xf8, 0x88, 0x1, 0xff, 0xc2, 0x44, 0x0,
-    0x7f, 0x5d, 0xf6, 0xea, 0xef, 0x84, 0x2, 0xbb,
-    0x1c, 0x5d, 0xea, 0x1b, 0xb0, 0x80, 0x75, 0x48,
-    0x6, 0x9e, 0x0, 0xe1, 0x22, 0x1, 0x91, 0x60,
-    0x62, 0x20, 0x80, 0x22, 0xee, 0xb, 0xbc, 0x37,
-    0x74, 0x0, 0x26, 0x7f, 0xf8, 0x40, 0x19, 0xee,
-    0xff, 0x48, 0x7, 0xb6, 0xae, 0xfe, 0x50, 0xf,
-    0x8c, 0x3, 0xff, 0x87, 0x15, 0x5f, 0x8, 0x7,
-    0xd7, 0x55, 0xf0, 0x80, 0x7d, 0x57, 0x7f, 0x8,
-    0x7, 0x8e, 0xef, 0xf3, 0x80, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x8, 0x10,
+    0x4, 0x20, 0x4, 0x20, 0x7f, 0xfe, 0x0, 0x0,
+    0xf, 0xf8, 0x10, 0x8, 0x10, 0x8, 0x1f, 0xf8,
+    0x10, 0x8, 0x1f, 0xf8, 0x10, 0x8,
 
     /* U+9AD8 "高" */
-    0x0, 0xf1, 0x90, 0x7, 0xff, 0x1, 0x1c, 0x3,
-    0xd1, 0x77, 0xd9, 0xd7, 0x7d, 0x10, 0xbb, 0xaa,
-    0xbd, 0x77, 0x40, 0x0, 0x72, 0x23, 0xd8, 0x40,
-    0x18, 0x92, 0x67, 0xc8, 0xc0, 0x18, 0x89, 0x55,
-    0xe2, 0x50, 0xc, 0x35, 0x5f, 0x84, 0x2, 0xbb,
-    0xff, 0xe0, 0x9, 0x12, 0xef, 0xfc, 0x64, 0x1,
-    0xae, 0xab, 0x58, 0x7, 0xf5, 0x56, 0x10, 0xf,
-    0xcb, 0x55, 0x84, 0x3, 0xf2, 0x55, 0x6b, 0x0,
-    0xc6, 0x1, 0x50, 0x6, 0x1b, 0xb2, 0x10, 0xc8,
-    0x7, 0xc3, 0x76, 0xc1,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1f,
+    0xe0, 0x40, 0x81, 0xfe, 0x0, 0x0, 0x7f, 0xf9,
+    0x0, 0x24, 0xfc, 0x92, 0x12, 0x4f, 0xc9, 0x20,
+    0x24, 0x3, 0x80, 0x0,
 
     /* U+9EC4 "黄" */
-    0x0, 0xe8, 0x0, 0xd0, 0x1, 0xfe, 0x40, 0xc,
-    0x80, 0x1f, 0x4d, 0xd8, 0xee, 0xf1, 0xdd, 0xa8,
-    0x3, 0x4d, 0xd8, 0xee, 0xf1, 0xdd, 0xa8, 0x2,
-    0xab, 0xb8, 0xee, 0xf1, 0xdd, 0xe0, 0x5, 0x5d,
-    0xdf, 0x7b, 0xab, 0xfb, 0xbc, 0x1, 0xa6, 0xab,
-    0xf4, 0x80, 0x71, 0x8d, 0x57, 0xee, 0x40, 0xf,
-    0xfe, 0x18, 0x80, 0x72, 0xd5, 0x7e, 0xb0, 0xf,
-    0x2d, 0x57, 0xeb, 0x10, 0xc, 0x44, 0xaa, 0xb7,
-    0x55, 0x56, 0xa8, 0x6, 0x1a, 0xa7, 0xdd, 0xd5,
-    0xf5, 0x41, 0x0, 0xc2, 0xd8, 0x42, 0x1, 0xae,
-    0x8c, 0x2, 0x6a, 0xc, 0x70, 0xc, 0xb7, 0x15,
-    0x0,
+    0x4, 0x20, 0x4, 0x20, 0x3f, 0xfc, 0x4, 0x20,
+    0x7f, 0xfe, 0x0, 0x0, 0x1f, 0xf8, 0x10, 0x0,
+    0x10, 0x0, 0x1f, 0xf8, 0x10, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x8, 0x18, 0x20, 0x6,
 
     /* U+9ED1 "黑" */
-    0x0, 0x1e, 0x55, 0x59, 0x8a, 0xab, 0x8, 0x3,
-    0x2c, 0xc7, 0xd5, 0x26, 0xbe, 0xec, 0xe0, 0x1e,
-    0x2f, 0x0, 0xde, 0x20, 0x1f, 0xdc, 0x20, 0x6,
-    0x90, 0xf, 0x96, 0x6f, 0xea, 0xe7, 0x62, 0xec,
-    0xe0, 0x18, 0xf2, 0xef, 0x4d, 0xdd, 0x84, 0x1,
-    0xc2, 0x3c, 0x62, 0x38, 0x3, 0x9a, 0x23, 0x5d,
-    0x44, 0x65, 0x0, 0xcd, 0x33, 0xaa, 0x67, 0x94,
-    0x2, 0xab, 0xbe, 0xa9, 0xbb, 0xea, 0x0, 0x55,
-    0xdf, 0x66, 0x2e, 0xfa, 0x80, 0x26, 0x50, 0x34,
-    0x0, 0x48, 0x1, 0x98, 0x1, 0xd, 0x28, 0x3,
-    0x0, 0x23, 0x6, 0xc4, 0x0, 0x4f, 0x80, 0xb,
-    0xc0, 0x16, 0xe0, 0xb, 0xe0
+    0x1f, 0xf8, 0x0, 0x0, 0x4, 0x20, 0x0, 0x0,
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8,
+    0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x40,
+    0x22, 0x44, 0x40, 0x2,
 };
 
 
@@ -4751,395 +2350,395 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 19, .adv_w = 256, .box_w = 16, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 24, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 77, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 151, .adv_w = 256, .box_w = 14, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 177, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 209, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 254, .adv_w = 256, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 312, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 365, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 429, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 504, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 564, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 608, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 658, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 734, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 807, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 872, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 945, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 981, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1063, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1149, .adv_w = 256, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 1173, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1209, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1268, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1344, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1418, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1489, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1549, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1625, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1705, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 1788, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1879, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1940, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2028, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2102, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2172, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2271, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2356, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2458, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2523, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2610, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2678, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2764, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2829, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2901, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2992, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3084, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 3180, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3261, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3351, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3442, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3545, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3628, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3732, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3780, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 3856, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3935, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4014, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4084, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4152, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 4234, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4300, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4373, .adv_w = 256, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 4444, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4532, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4609, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 4679, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4755, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4833, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4899, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4977, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5068, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5113, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 5162, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5250, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5339, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5419, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5501, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5580, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5669, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5760, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 5832, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5902, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 5970, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6034, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6099, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6168, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6198, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6244, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6311, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6383, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6456, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6539, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6608, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6689, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6768, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6837, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6940, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7030, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7118, .adv_w = 256, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 7140, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7199, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7271, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7317, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7365, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7411, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7480, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7526, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7605, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7689, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7749, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 7802, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7869, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7936, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7990, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8045, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8113, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8191, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8254, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8325, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8401, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8479, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8554, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8619, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8689, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 8758, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8848, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 8915, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8984, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 9072, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 9171, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 9236, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 9275, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 9340, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 9401, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9433, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9497, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9582, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9658, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9759, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9792, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9865, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9953, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 10037, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10131, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10236, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 10309, .adv_w = 256, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 10367, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10446, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10528, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10626, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10715, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10800, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 10853, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 10909, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 10986, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11091, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 11154, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11227, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11303, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11400, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11490, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 11551, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11628, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11723, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11801, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11882, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 11920, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 11998, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12020, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 12062, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 12105, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12185, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12275, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 12355, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12390, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12448, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12517, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12595, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12681, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12775, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12867, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12975, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13030, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 13113, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13202, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 13260, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13351, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13424, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13510, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 13604, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13678, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13770, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13838, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13892, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 13977, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14075, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14163, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14222, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14296, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14377, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14457, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14556, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14637, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14730, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14815, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 14915, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15016, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15109, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15204, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 15290, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15396, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15486, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15574, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15627, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15688, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15753, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 15854, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15921, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16003, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16086, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16167, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 16259, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16355, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16442, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16528, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 16618, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16715, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16806, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16910, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17008, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17128, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17222, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17305, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 17367, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17460, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17537, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 17633, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17704, .adv_w = 256, .box_w = 10, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 17731, .adv_w = 256, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 17762, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 17818, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 17881, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 17943, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18021, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 18113, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 18197, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18285, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18332, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 18400, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 18495, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18585, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18659, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18732, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18810, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18885, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 18956, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19054, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19140, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19241, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19327, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19409, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19500, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19605, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19702, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19800, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19867, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 19945, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 20048, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20104, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 20172, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20239, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 20320, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 20407, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20501, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20570, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20653, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20742, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 20829, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 20924, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21028, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 21129, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21227, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 21305, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21385, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 21496, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 21591, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21679, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 21737, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 21797, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21904, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 21998, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22092, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22180, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22249, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22309, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 22364, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 22435, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 22515, .adv_w = 256, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 22555, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 22606, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 22693, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 22760, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22834, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22913, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 22992, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 23071, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23157, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 23245, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 23340, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23419, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23484, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23571, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23664, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23759, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23827, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 23916, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23999, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24080, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24173, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24267, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24338, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 24425, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24495, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24580, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24662, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24758, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 24857, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 24947, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25032, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25123, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 25225, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25319, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 25427, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25516, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 25599, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 25658, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25736, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 25826, .adv_w = 256, .box_w = 11, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
-    {.bitmap_index = 25874, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25946, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 26052, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 26153, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 26217, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26295, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 26368, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26449, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26547, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26646, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26708, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26797, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 26890, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 26989, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 27088, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27186, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27294, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27374, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27467, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27557, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27665, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 27753, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 27838, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 27927, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28030, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 28105, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28205, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28293, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28394, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28500, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28587, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28677, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28770, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 28857, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28965, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29030, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29118, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29215, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29298, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 29331, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 29391, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 29478, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 29553, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 29619, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 29695, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 29762, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29837, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 29915, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 29991, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 30080, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1}
+    {.bitmap_index = 25, .adv_w = 256, .box_w = 16, .box_h = 1, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 27, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 54, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 81, .adv_w = 256, .box_w = 14, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 102, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 130, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 156, .adv_w = 256, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 181, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 209, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 237, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 260, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 288, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 313, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 341, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 368, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 397, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 427, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 454, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 477, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 505, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 533, .adv_w = 256, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 555, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 581, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 605, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 633, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 661, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 689, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 721, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 750, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 778, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 808, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 840, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 867, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 895, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 927, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 957, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 987, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1015, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1047, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1077, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1107, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1135, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1164, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1194, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1226, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1256, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1286, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1316, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1348, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1378, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1406, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1438, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1468, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1498, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1527, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1554, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1582, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1612, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1640, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1668, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1695, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1722, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1750, .adv_w = 256, .box_w = 12, .box_h = 16, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1774, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1804, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1832, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1859, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1889, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1919, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1946, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1974, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2004, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2031, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 2056, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2086, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2115, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2144, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2173, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2200, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2229, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2261, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2288, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2317, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2346, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2374, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2402, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2429, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2457, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2485, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2513, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2540, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2567, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2595, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2623, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2651, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2679, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2702, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2732, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2760, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2787, .adv_w = 256, .box_w = 12, .box_h = 13, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2807, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2837, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2864, .adv_w = 256, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2887, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2912, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2938, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2965, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2992, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3021, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3051, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3079, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3106, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3131, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3159, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3184, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3211, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3238, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3265, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3294, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3321, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3348, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3376, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3403, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3428, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3453, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3481, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3509, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3536, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3565, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3592, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3621, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3646, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3671, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3696, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3721, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3747, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3776, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3804, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3832, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3864, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3890, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3917, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3947, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3972, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4000, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4030, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 4057, .adv_w = 256, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4082, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4110, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4138, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4168, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4198, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4228, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4258, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4283, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4312, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4344, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4369, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4397, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4424, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4453, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4481, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4508, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4536, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4566, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4593, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4620, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 4645, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4673, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4697, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 4720, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4745, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4773, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4802, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4829, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4857, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4883, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4911, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4941, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4970, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5000, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5030, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5060, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5086, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5113, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5141, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5164, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5192, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5220, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5248, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5278, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5306, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5334, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5362, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5390, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5418, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5447, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5477, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5504, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5529, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5556, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5586, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5616, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5643, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5670, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5697, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5725, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5755, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5784, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5812, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5839, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5867, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5896, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5926, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5956, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5983, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6013, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6043, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6071, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6099, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6127, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6155, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6185, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6213, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6241, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6269, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6298, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6326, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6354, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6382, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6410, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6442, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6470, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6500, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6525, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6553, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6585, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6615, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6643, .adv_w = 256, .box_w = 10, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 6662, .adv_w = 256, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6683, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6711, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6736, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6761, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6789, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6816, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 6845, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6873, .adv_w = 256, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6896, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6925, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6955, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6983, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7011, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7039, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7067, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7095, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7123, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7153, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7181, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7211, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7239, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7267, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7295, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7325, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7355, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7383, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7413, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7441, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7473, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7501, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7528, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7556, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7583, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7610, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7638, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7666, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7694, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7722, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7754, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7782, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7812, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7840, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7870, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7897, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 7926, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7956, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7985, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8015, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8040, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8070, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8100, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8130, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8158, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8186, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8216, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8241, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 8266, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8293, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8320, .adv_w = 256, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 8343, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8368, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8396, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8423, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8450, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8479, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8507, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8534, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8564, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 8593, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8622, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8649, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8678, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8708, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8735, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8764, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8792, .adv_w = 256, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8822, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8849, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8878, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8908, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8938, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8966, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8993, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9021, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9051, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9079, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9109, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9138, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9168, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9196, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9224, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9253, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9280, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9312, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9342, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9372, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9402, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9430, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9459, .adv_w = 256, .box_w = 11, .box_h = 15, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 9480, .adv_w = 256, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9506, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9536, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9568, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9597, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9625, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9652, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9680, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9708, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9736, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9764, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9794, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9824, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9854, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9882, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9912, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9942, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9972, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10002, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10032, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10062, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10092, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10119, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10148, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10178, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10205, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10235, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10265, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10297, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10329, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10359, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10391, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10420, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10448, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10480, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10508, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10538, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10566, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10594, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10619, .adv_w = 256, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10644, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10674, .adv_w = 256, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10699, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10726, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10753, .adv_w = 256, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10780, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10810, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10840, .adv_w = 256, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10868, .adv_w = 256, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10898, .adv_w = 256, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -1}
 };
 
 /*---------------------
@@ -5229,9 +2828,9 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_dsc = NULL,
     .kern_scale = 0,
     .cmap_num = 1,
-    .bpp = 4,
+    .bpp = 1,
     .kern_classes = 0,
-    .bitmap_format = 1,
+    .bitmap_format = 0,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -5262,7 +2861,7 @@ lv_font_t lv_font_builtin_chinese_16 = {
 #endif
     .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
 #if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = NULL,
+    .fallback = &lv_font_montserrat_16,
 #endif
     .user_data = NULL,
 };
@@ -0,0 +1,647 @@
+/**
+ * @file cbz_book.c
+ * @brief CBZ 漫画读取实现
+ */
+
+#include "cbz_book.h"
+#include "epub_image.h"
+#include "epub_zip.h"
+#include "page_index.h"
+#include "../bg_jobs.h"
+#include "../heap_stats.h"
+#include "../mem_pressure.h"
+#include "../packbits.h"
+#include "../spi_arbiter.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+static const char *TAG = "CBZ";
+
+#define CBZ_CACHE_MAGIC   0x31505843u  // "CXP1"
+#define CBZ_IO_BUF        1024
+#define CBZ_ROW_MAX       128          // 面板一行的最大字节数
+#define CBZ_FRAME_CHUNK   (8 * 1024)   // 压缩帧缓冲区每次增长的字节数
+
+// 卡上缓存的一页：文件头后是压缩帧。源文件大小与修改时间变了就重新解码
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t path_hash;
+    uint32_t src_size;
+    uint32_t src_mtime;
+    uint32_t page;
+    uint16_t width;          // 逻辑尺寸（区分横竖屏）
+    uint16_t height;
+    uint32_t size;           // 压缩帧字节数
+} cbz_cache_header_t;
+
+// 内存中的一页压缩帧
+typedef struct {
+    int page;                // -1 = 空
+    uint32_t last_use;
+    uint8_t *data;
+    uint32_t size;
+} cbz_slot_t;
+
+struct cbz_book {
+    epub_zip_t *zip;
+    uint16_t *pages;         // 按自然顺序排好的图片条目在中心目录中的下标
+    int page_count;
+    uint16_t width;          // 逻辑尺寸
+    uint16_t height;
+    uint16_t panel_width;    // framebuffer 布局的尺寸
+    uint16_t panel_height;
+    bool portrait;
+    uint32_t path_hash;
+    uint32_t src_size;
+    uint32_t src_mtime;
+    uint32_t clock;          // 压缩帧的使用时钟
+    int current;             // 最近准备的页，不会被预解码挤出内存
+    int failed_page;         // 最近解码失败的页，渲染时不再重试
+    cbz_slot_t slots[CBZ_RAM_PAGES];
+};
+
+// io 串行化 ZIP 文件句柄与解码（一次可能持有整个解码过程），lock 只保护压缩帧与预解码
+// 请求（很短，渲染回调可以放心等待）。两个都要时先取 io
+static struct {
+    SemaphoreHandle_t io;
+    SemaphoreHandle_t lock;
+    cbz_book_t *book;        // 当前打开的书（NULL = 无）
+    bg_job_id_t job;         // 正在运行或排队的预解码作业
+    uint32_t job_gen;        // 每次提交加一，区分迟到的 done 回调
+    int want;                // 请求预解码的页（-1 = 无）
+} s_cbz = {.want = -1};
+
+static const char *s_sort_names;   // compare_pages 用的名字池（只在打开时排序）
+
+// ---------------------------------------------------------------------------
+// 页表
+// ---------------------------------------------------------------------------
+
+// 自然顺序：数字段按数值比较（page2 < page10），其余按字母不分大小写
+static int natural_compare(const char *a, const char *b) {
+    while (*a != '\0' && *b != '\0') {
+        if (isdigit((unsigned char)*a) && isdigit((unsigned char)*b)) {
+            while (*a == '0') a++;
+            while (*b == '0') b++;
+            size_t la = 0;
+            size_t lb = 0;
+            while (isdigit((unsigned char)a[la])) la++;
+            while (isdigit((unsigned char)b[lb])) lb++;
+            if (la != lb) {
+                return la < lb ? -1 : 1;
+            }
+            const int c = strncmp(a, b, la);
+            if (c != 0) {
+                return c;
+            }
+            a += la;
+            b += lb;
+            continue;
+        }
+        const int ca = tolower((unsigned char)*a);
+        const int cb = tolower((unsigned char)*b);
+        if (ca != cb) {
+            return ca - cb;
+        }
+        a++;
+        b++;
+    }
+    return (unsigned char)*a - (unsigned char)*b;
+}
+
+typedef struct {
+    uint32_t name;           // 在临时名字池中的偏移
+    uint16_t index;          // 中心目录下标
+} cbz_sort_t;
+
+static int compare_pages(const void *a, const void *b) {
+    const cbz_sort_t *x = a;
+    const cbz_sort_t *y = b;
+    const int c = natural_compare(s_sort_names + x->name, s_sort_names + y->name);
+    return c != 0 ? c : (int)x->index - (int)y->index;
+}
+
+// 能解码的图片；跳过目录、隐藏文件和 macOS 压缩时附带的 __MACOSX/
+static bool is_page_name(const char *name) {
+    const char *base = strrchr(name, '/');
+    base = base != NULL ? base + 1 : name;
+    const char *ext = strrchr(base, '.');
+    return base[0] != '.' && strncmp(name, "__MACOSX/", 9) != 0 && ext != NULL &&
+           (strcasecmp(ext, ".jpg") == 0 || strcasecmp(ext, ".jpeg") == 0 ||
+            strcasecmp(ext, ".png") == 0);
+}
+
+// 排序只在打开时需要完整文件名，排完只留下标
+static bool build_pages(cbz_book_t *book) {
+    const int count = epub_zip_get_file_count(book->zip);
+    cbz_sort_t *order = malloc((size_t)count * sizeof(cbz_sort_t) + 1);
+    char *names = NULL;
+    size_t names_len = 0;
+    size_t names_cap = 0;
+    int n = 0;
+    bool ok = order != NULL;
+    epub_zip_file_info_t info;
+    for (int i = 0; ok && i < count; i++) {
+        if (!epub_zip_get_file_info(book->zip, i, &info) || !is_page_name(info.filename)) {
+            continue;
+        }
+        const size_t len = strlen(info.filename) + 1;
+        if (names_len + len > names_cap) {
+            const size_t cap = names_cap ? names_cap * 2 : 1024;
+            char *grown = realloc(names, cap);
+            if (grown == NULL) {
+                ok = false;
+                break;
+            }
+            names = grown;
+            names_cap = cap;
+        }
+        memcpy(names + names_len, info.filename, len);
+        order[n].name = (uint32_t)names_len;
+        order[n].index = (uint16_t)i;
+        names_len += len;
+        n++;
+    }
+
+    if (ok && n > 0) {
+        s_sort_names = names;
+        qsort(order, (size_t)n, sizeof(cbz_sort_t), compare_pages);
+        s_sort_names = NULL;
+        book->pages = heap_stats_malloc(HEAP_TAG_IMAGE, (size_t)n * sizeof(uint16_t));
+        if (book->pages != NULL) {
+            for (int i = 0; i < n; i++) {
+                book->pages[i] = order[i].index;
+            }
+            book->page_count = n;
+        }
+    }
+    if (!ok) {
+        ESP_LOGE(TAG, "Failed to allocate page list");
+    }
+    free(order);
+    free(names);
+    return book->pages != NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 面板布局的压缩帧
+// ---------------------------------------------------------------------------
+
+static size_t frame_size(const cbz_book_t *book) {
+    return (size_t)book->panel_width * book->panel_height / 8;
+}
+
+// 面板第 my 行：图片居中，其余为白。竖屏时面板的一行是逻辑画面的一列
+// （与 lvgl_fb_put_bitmap 的映射相同：mem_x = ly，mem_y = 面板高 - 1 - lx）
+static void frame_row(const cbz_book_t *book, const epub_image_t *image, int my, uint8_t *row) {
+    memset(row, 0xFF, book->panel_width / 8);
+    const int ox = (book->width - image->width) / 2;
+    const int oy = (book->height - image->height) / 2;
+    if (!book->portrait) {
+        const int y = my - oy;
+        if (y < 0 || y >= image->height) {
+            return;
+        }
+        const uint8_t *src = image->bits + (size_t)y * image->stride;
+        for (int x = 0; x < image->width; x++) {
+            if (!(src[x >> 3] & (0x80 >> (x & 7)))) {
+                const int mx = ox + x;
+                row[mx >> 3] &= (uint8_t)~(0x80 >> (mx & 7));
+            }
+        }
+        return;
+    }
+    const int x = book->panel_height - 1 - my - ox;
+    if (x < 0 || x >= image->width) {
+        return;
+    }
+    const uint8_t mask = (uint8_t)(0x80 >> (x & 7));
+    const uint8_t *src = image->bits + (x >> 3);
+    for (int y = 0; y < image->height; y++, src += image->stride) {
+        if (!(*src & mask)) {
+            const int mx = oy + y;
+            row[mx >> 3] &= (uint8_t)~(0x80 >> (mx & 7));
+        }
+    }
+}
+
+// 逐行旋转、压缩，不需要整帧的中间缓冲区；各行的 PackBits 首尾相接即是整帧的压缩数据
+static uint8_t *frame_compress(const cbz_book_t *book, const epub_image_t *image, uint32_t *size) {
+    uint8_t row[CBZ_ROW_MAX];
+    uint8_t packed[PACKBITS_BOUND(CBZ_ROW_MAX)];
+    uint8_t *data = NULL;
+    size_t len = 0;
+    size_t cap = 0;
+    for (int my = 0; my < book->panel_height; my++) {
+        frame_row(book, image, my, row);
+        const size_t n = packbits_encode(row, book->panel_width / 8, packed);
+        if (len + n > cap) {
+            uint8_t *grown = heap_stats_realloc(HEAP_TAG_IMAGE, data, cap + CBZ_FRAME_CHUNK);
+            if (grown == NULL) {
+                heap_stats_free(HEAP_TAG_IMAGE, data);
+                return NULL;
+            }
+            data = grown;
+            cap += CBZ_FRAME_CHUNK;
+        }
+        memcpy(data + len, packed, n);
+        len += n;
+    }
+    uint8_t *shrunk = heap_stats_realloc(HEAP_TAG_IMAGE, data, len);
+    *size = (uint32_t)len;
+    return shrunk != NULL ? shrunk : data;
+}
+
+// ---------------------------------------------------------------------------
+// 内存中的压缩帧（持有 lock 时调用）
+// ---------------------------------------------------------------------------
+
+static cbz_slot_t *slot_find(cbz_book_t *book, int page) {
+    for (int i = 0; i < CBZ_RAM_PAGES; i++) {
+        if (book->slots[i].data != NULL && book->slots[i].page == page) {
+            return &book->slots[i];
+        }
+    }
+    return NULL;
+}
+
+static void slot_clear(cbz_slot_t *slot) {
+    heap_stats_free(HEAP_TAG_IMAGE, slot->data);
+    slot->data = NULL;
+    slot->size = 0;
+    slot->page = -1;
+}
+
+// 放入一页（取得 data 的所有权）：超出预算时先丢掉最久未用的页。当前页总是放入，
+// 预解码的页放不下时只留在卡上
+static void slot_put(cbz_book_t *book, int page, uint8_t *data, uint32_t size) {
+    if (slot_find(book, page) != NULL) {
+        heap_stats_free(HEAP_TAG_IMAGE, data);
+        return;
+    }
+    for (;;) {
+        cbz_slot_t *empty = NULL;
+        cbz_slot_t *victim = NULL;
+        size_t held = 0;
+        for (int i = 0; i < CBZ_RAM_PAGES; i++) {
+            cbz_slot_t *slot = &book->slots[i];
+            if (slot->data == NULL) {
+                empty = slot;
+                continue;
+            }
+            held += slot->size;
+            if (slot->page != book->current && (victim == NULL || slot->last_use < victim->last_use)) {
+                victim = slot;
+            }
+        }
+        if (empty != NULL && (held + size <= heap_stats_cache_budget(held, CBZ_CACHE_HEAP_SHARE) ||
+                              (victim == NULL && page == book->current))) {
+            empty->page = page;
+            empty->data = data;
+            empty->size = size;
+            empty->last_use = ++book->clock;
+            return;
+        }
+        if (victim == NULL) {
+            break;
+        }
+        slot_clear(victim);
+    }
+    heap_stats_free(HEAP_TAG_IMAGE, data);
+}
+
+// 内存中有这一页时解压进 fb
+static bool slot_decode(cbz_book_t *book, int page, uint8_t *fb, size_t fb_size, bool *found) {
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    const cbz_slot_t *slot = slot_find(book, page);
+    *found = slot != NULL;
+    const bool ok = slot != NULL && packbits_decode(slot->data, slot->size, fb, fb_size);
+    xSemaphoreGive(s_cbz.lock);
+    return ok;
+}
+
+// 内存紧张时只留当前页，其余的之后从卡上读回
+static bool trim_slots(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    bool released = false;
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    cbz_book_t *book = s_cbz.book;
+    for (int i = 0; book != NULL && i < CBZ_RAM_PAGES; i++) {
+        if (book->slots[i].data != NULL && book->slots[i].page != book->current) {
+            slot_clear(&book->slots[i]);
+            released = true;
+        }
+    }
+    xSemaphoreGive(s_cbz.lock);
+    return released;
+}
+
+// ---------------------------------------------------------------------------
+// 卡上缓存（持有 io 时调用）
+// ---------------------------------------------------------------------------
+
+static void make_header(const cbz_book_t *book, int page, cbz_cache_header_t *hdr) {
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->magic = CBZ_CACHE_MAGIC;
+    hdr->path_hash = book->path_hash;
+    hdr->src_size = book->src_size;
+    hdr->src_mtime = book->src_mtime;
+    hdr->page = (uint32_t)page;
+    hdr->width = book->width;
+    hdr->height = book->height;
+}
+
+static void cache_path(const cbz_book_t *book, int page, char *out, size_t out_size) {
+    const uint32_t key[3] = {(uint32_t)page, book->width, book->height};
+    const uint32_t hash = page_index_hash(book->path_hash, key, sizeof(key));
+    snprintf(out, out_size, CBZ_CACHE_DIR "/%08lx.xcp", (unsigned long)hash);
+}
+
+static uint8_t *load_cached(const cbz_book_t *book, int page, uint32_t *size) {
+    char file[64];
+    cache_path(book, page, file, sizeof(file));
+    FILE *f = fopen(file, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    setvbuf(f, NULL, _IOFBF, CBZ_IO_BUF);
+    cbz_cache_header_t key;
+    cbz_cache_header_t hdr;
+    make_header(book, page, &key);
+    uint8_t *data = NULL;
+    spi_arbiter_sd_begin();
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1) {
+        key.size = hdr.size;
+        if (memcmp(&hdr, &key, sizeof(hdr)) == 0 && hdr.size > 0 &&
+            hdr.size <= (uint32_t)book->panel_height * PACKBITS_BOUND(book->panel_width / 8)) {
+            data = heap_stats_malloc(HEAP_TAG_IMAGE, hdr.size);
+            if (data != NULL && fread(data, 1, hdr.size, f) != hdr.size) {
+                heap_stats_free(HEAP_TAG_IMAGE, data);
+                data = NULL;
+            }
+        }
+    }
+    spi_arbiter_sd_end();
+    fclose(f);
+    if (data != NULL) {
+        *size = hdr.size;
+    }
+    return data;
+}
+
+static void store(const cbz_book_t *book, int page, const uint8_t *data, uint32_t size) {
+    mkdir("/sdcard/.x4cache", 0775);
+    mkdir(CBZ_CACHE_DIR, 0775);
+    char file[64];
+    cache_path(book, page, file, sizeof(file));
+    FILE *f = fopen(file, "wb");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot create %s", file);
+        return;
+    }
+    cbz_cache_header_t hdr;
+    make_header(book, page, &hdr);
+    hdr.size = size;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(data, 1, size, f) == size;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        remove(file);
+    }
+}
+
+// 卡上缓存命中时读入，否则解码、压缩并写回卡上，结果放进内存（持有 io 时调用）
+static bool page_load(cbz_book_t *book, int page) {
+    uint32_t size = 0;
+    uint8_t *data = load_cached(book, page, &size);
+    if (data == NULL) {
+        epub_zip_file_info_t info;
+        epub_image_t image;
+        if (!epub_zip_get_file_info(book->zip, book->pages[page], &info) ||
+            !epub_image_decode_zip(book->zip, &info, book->width, book->height, 1, &image)) {
+            ESP_LOGW(TAG, "Page %d cannot be decoded", page + 1);
+            return false;
+        }
+        data = frame_compress(book, &image, &size);
+        epub_image_free(&image);
+        if (data == NULL) {
+            ESP_LOGW(TAG, "No memory for page %d", page + 1);
+            return false;
+        }
+        store(book, page, data, size);
+        ESP_LOGD(TAG, "Page %d: %lu bytes compressed", page + 1, (unsigned long)size);
+    }
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    slot_put(book, page, data, size);
+    xSemaphoreGive(s_cbz.lock);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 预解码
+// ---------------------------------------------------------------------------
+
+// 一步准备一页；期间又来了新请求时继续下一步，否则作业结束
+static bool ahead_step(bg_job_t *job, void *arg) {
+    (void)arg;
+    xSemaphoreTake(s_cbz.io, portMAX_DELAY);
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    cbz_book_t *book = s_cbz.book;
+    const int page = s_cbz.want;
+    const bool missing = book != NULL && page >= 0 && slot_find(book, page) == NULL;
+    xSemaphoreGive(s_cbz.lock);
+
+    if (missing && !bg_job_cancelled(job)) {
+        page_load(book, page);
+    }
+
+    // 在锁内决定是否结束：ahead_request 看到 BG_JOB_NONE 才会提交新作业
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    if (s_cbz.want == page) {
+        s_cbz.want = -1;
+    }
+    const bool more = s_cbz.want >= 0 && !bg_job_cancelled(job);
+    if (!more) {
+        s_cbz.job = BG_JOB_NONE;
+    }
+    xSemaphoreGive(s_cbz.lock);
+    xSemaphoreGive(s_cbz.io);
+    return more;
+}
+
+// 作业因内存不足被放弃时步函数没有机会清理，这里补上（只认本次提交的作业）
+static void ahead_done(void *arg, bool finished) {
+    (void)finished;
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    if (s_cbz.job_gen == (uint32_t)(uintptr_t)arg) {
+        s_cbz.job = BG_JOB_NONE;
+        s_cbz.want = -1;
+    }
+    xSemaphoreGive(s_cbz.lock);
+}
+
+static void ahead_request(cbz_book_t *book, int page) {
+    if (page >= book->page_count) {
+        return;
+    }
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    if (slot_find(book, page) == NULL && s_cbz.want != page) {
+        s_cbz.want = page;
+        if (s_cbz.job == BG_JOB_NONE) {
+            // 预算：解码结果位图加上压缩帧（解码工作区只有一行，另计在余量里）
+            const bg_job_desc_t desc = {
+                .name = "cbz_ahead",
+                .prio = BG_JOB_PRIO_HIGH,
+                .mem_budget = (uint32_t)(2 * frame_size(book)),
+                .step = ahead_step,
+                .done = ahead_done,
+                .arg = (void *)(uintptr_t)++s_cbz.job_gen,
+            };
+            s_cbz.job = bg_jobs_submit(&desc);
+            if (s_cbz.job == BG_JOB_NONE) {
+                s_cbz.want = -1;
+            }
+        }
+    }
+    xSemaphoreGive(s_cbz.lock);
+}
+
+// ---------------------------------------------------------------------------
+
+static void book_free(cbz_book_t *book) {
+    for (int i = 0; i < CBZ_RAM_PAGES; i++) {
+        slot_clear(&book->slots[i]);
+    }
+    heap_stats_free(HEAP_TAG_IMAGE, book->pages);
+    epub_zip_close(book->zip);
+    free(book);
+}
+
+cbz_book_t *cbz_book_open(const char *path, int width, int height) {
+    if (path == NULL || width <= 0 || height <= 0) {
+        return NULL;
+    }
+    if (s_cbz.io == NULL) {
+        s_cbz.io = xSemaphoreCreateMutex();
+    }
+    if (s_cbz.lock == NULL) {
+        s_cbz.lock = xSemaphoreCreateMutex();
+    }
+    struct stat st;
+    if (s_cbz.io == NULL || s_cbz.lock == NULL || s_cbz.book != NULL || stat(path, &st) != 0) {
+        return NULL;
+    }
+
+    cbz_book_t *book = calloc(1, sizeof(cbz_book_t));
+    if (book == NULL) {
+        return NULL;
+    }
+    book->width = (uint16_t)width;
+    book->height = (uint16_t)height;
+    book->portrait = width < height;
+    book->panel_width = (uint16_t)(book->portrait ? height : width);
+    book->panel_height = (uint16_t)(book->portrait ? width : height);
+    book->path_hash = page_index_hash(0, path, strlen(path));
+    book->src_size = (uint32_t)st.st_size;
+    book->src_mtime = (uint32_t)st.st_mtime;
+    book->current = -1;
+    book->failed_page = -1;
+    for (int i = 0; i < CBZ_RAM_PAGES; i++) {
+        book->slots[i].page = -1;
+    }
+    if (book->panel_width % 8 != 0 || book->panel_width / 8 > CBZ_ROW_MAX) {
+        free(book);
+        return NULL;
+    }
+
+    book->zip = epub_zip_open(path);
+    if (book->zip == NULL || !build_pages(book)) {
+        ESP_LOGW(TAG, "%s: no readable pages", path);
+        book_free(book);
+        return NULL;
+    }
+
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    s_cbz.book = book;
+    s_cbz.want = -1;
+    xSemaphoreGive(s_cbz.lock);
+    mem_pressure_register("cbz", MEM_PRESSURE_PRIO_SPECULATIVE, HEAP_TAG_IMAGE, 0, trim_slots, NULL);
+    ESP_LOGI(TAG, "Opened %s: %d pages for %dx%d", path, book->page_count, width, height);
+    return book;
+}
+
+void cbz_book_close(cbz_book_t *book) {
+    if (book == NULL) {
+        return;
+    }
+    // 等正在进行的预解码结束；之后作业看到 book 为 NULL，不再碰这本书
+    xSemaphoreTake(s_cbz.io, portMAX_DELAY);
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    s_cbz.book = NULL;
+    s_cbz.want = -1;
+    const bg_job_id_t job = s_cbz.job;
+    xSemaphoreGive(s_cbz.lock);
+    xSemaphoreGive(s_cbz.io);
+    if (job != BG_JOB_NONE) {
+        bg_jobs_cancel(job);
+    }
+    mem_pressure_unregister(trim_slots, NULL);
+    book_free(book);
+}
+
+int cbz_book_page_count(const cbz_book_t *book) {
+    return book != NULL ? book->page_count : 0;
+}
+
+bool cbz_book_prepare(cbz_book_t *book, int page) {
+    if (book == NULL || page < 0 || page >= book->page_count) {
+        return false;
+    }
+    xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+    book->current = page;
+    cbz_slot_t *slot = slot_find(book, page);
+    if (slot != NULL) {
+        slot->last_use = ++book->clock;
+    }
+    bool ok = slot != NULL;
+    xSemaphoreGive(s_cbz.lock);
+
+    if (!ok) {
+        // 预解码可能正在准备这一页：等它做完再看一次
+        xSemaphoreTake(s_cbz.io, portMAX_DELAY);
+        xSemaphoreTake(s_cbz.lock, portMAX_DELAY);
+        ok = slot_find(book, page) != NULL;
+        xSemaphoreGive(s_cbz.lock);
+        if (!ok) {
+            ok = page_load(book, page);
+        }
+        xSemaphoreGive(s_cbz.io);
+        book->failed_page = ok ? -1 : page;
+    }
+    ahead_request(book, page + 1);
+    return ok;
+}
+
+bool cbz_book_decode(cbz_book_t *book, int page, uint8_t *fb, size_t fb_size) {
+    if (book == NULL || fb == NULL || page < 0 || page >= book->page_count ||
+        fb_size != frame_size(book)) {
+        return false;
+    }
+    bool found;
+    bool ok = slot_decode(book, page, fb, fb_size, &found);
+    // 准备好的页在渲染前被内存压力清掉时才会走到这里
+    if (!found && page != book->failed_page && cbz_book_prepare(book, page)) {
+        ok = slot_decode(book, page, fb, fb_size, &found);
+    }
+    if (found && !ok) {
+        ESP_LOGW(TAG, "Page %d is damaged", page + 1);
+    }
+    return ok;
+}
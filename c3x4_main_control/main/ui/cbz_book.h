@@ -0,0 +1,65 @@
+/**
+ * @file cbz_book.h
+ * @brief CBZ 漫画：ZIP 里的 PNG/JPEG 按文件名自然顺序作为页，解码成整帧面板位图后翻页
+ *
+ * 页表直接取自 epub_zip 的中心目录索引，每页只记一个条目下标（2 字节）。一页第一次显示时
+ * 用 epub_image 边解码边缩小到屏幕尺寸并抖动为 1bpp，居中后按面板布局逐行 PackBits 压缩：
+ * 压缩帧留在内存（最近 CBZ_RAM_PAGES 页，受缓存预算约束），同时写入 CBZ_CACHE_DIR，
+ * 以后再翻到这页只需解压进 framebuffer，和 X4PG 一样快。显示第 N 页后后台作业
+ * 预先准备第 N+1 页。压缩帧与 x4pg 的 1bpp 页格式相同
+ *
+ * cbz_book_open / prepare / decode / close 在 LVGL 任务中调用；同一时间只能打开一本
+ */
+
+#ifndef CBZ_BOOK_H
+#define CBZ_BOOK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CBZ_CACHE_DIR         "/sdcard/.x4cache/cbz"
+#define CBZ_RAM_PAGES         3     // 内存中保留的压缩帧数（当前页、预解码的下一页、上一页）
+#define CBZ_CACHE_HEAP_SHARE  4     // 压缩帧最多占缓存预算的 1/N（当前页不受限）
+
+typedef struct cbz_book cbz_book_t;
+
+/**
+ * @brief 打开 CBZ 并建立页表
+ * @param path 文件路径
+ * @param width 屏幕逻辑宽度
+ * @param height 屏幕逻辑高度（宽小于高为竖屏，页面按面板布局旋转保存）
+ * @return 句柄；不是 ZIP、没有图片、已有一本打开或内存不足时为 NULL
+ */
+cbz_book_t *cbz_book_open(const char *path, int width, int height);
+
+void cbz_book_close(cbz_book_t *book);
+
+int cbz_book_page_count(const cbz_book_t *book);
+
+/**
+ * @brief 准备第 page 页（从 0 开始）：内存 -> 卡上缓存 -> 解码，并让后台预解码下一页
+ *
+ * 在请求渲染之前调用，较慢的解码不会发生在持有 framebuffer 的渲染回调里
+ *
+ * @return false 页码越界、图片格式不支持或读取失败
+ */
+bool cbz_book_prepare(cbz_book_t *book, int page);
+
+/**
+ * @brief 把第 page 页解压进整帧 framebuffer（未准备过时先准备）
+ * @param fb 面板布局的 1bpp framebuffer
+ * @param fb_size framebuffer 字节数
+ * @return false 页面无法显示（fb 内容未定义）
+ */
+bool cbz_book_decode(cbz_book_t *book, int page, uint8_t *fb, size_t fb_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CBZ_BOOK_H
@@ -0,0 +1,271 @@
+/**
+ * @file chapter_list.c
+ * @brief 章节列表实现
+ */
+
+#include "chapter_list.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "CHAPTER_LIST";
+
+#define LIST_MAX_ROWS     20   // 每页最多行数
+#define LIST_HEADER_H     40   // 标题栏高度（与阅读界面状态栏一致）
+#define LIST_ROW_PAD      6    // 行内上下留白
+#define LIST_INDENT       16   // 每一级嵌套的缩进
+#define LIST_MAX_INDENT   4    // 超过该层级不再缩进
+
+static struct {
+    lv_obj_t *panel;
+    lv_obj_t *header;
+    lv_obj_t *rows[LIST_MAX_ROWS];
+    epub_toc_entry_t *window;  // 当前页的目录项（EPUB）
+    txt_toc_entry_t *txt_window; // 当前页的目录项（TXT）
+    int window_count;
+    int rows_per_page;
+    int total;
+    int page_first;            // 当前页第一项的序号
+    int selected;              // 选中项的序号
+    epub_reader_t *reader;     // NULL 表示 TXT 目录
+} s_list;
+
+static void set_row_selected(int row, bool selected) {
+    lv_obj_t *label = s_list.rows[row];
+    lv_obj_set_style_bg_color(label, selected ? lv_color_black() : lv_color_white(), 0);
+    lv_obj_set_style_text_color(label, selected ? lv_color_white() : lv_color_black(), 0);
+}
+
+static void update_header(void) {
+    const int pages = (s_list.total + s_list.rows_per_page - 1) / s_list.rows_per_page;
+    lv_label_set_text_fmt(s_list.header, "目录  %d / %d", s_list.page_first / s_list.rows_per_page + 1,
+                          pages);
+}
+
+// 读出 page_first 开始的一页并刷新所有行
+static void load_page(void) {
+    if (s_list.reader != NULL) {
+        s_list.window_count = epub_parser_toc_read(s_list.reader, s_list.page_first, s_list.window,
+                                                   s_list.rows_per_page);
+    } else {
+        s_list.window_count = txt_toc_read(s_list.page_first, s_list.txt_window, s_list.rows_per_page);
+    }
+    // TXT 目录有卷时章节缩进一级，没有卷时都顶格
+    const bool txt_indent = s_list.reader == NULL && txt_toc_has_volumes();
+    for (int i = 0; i < s_list.rows_per_page; i++) {
+        lv_obj_t *label = s_list.rows[i];
+        if (i < s_list.window_count) {
+            int depth;
+            const char *title;
+            if (s_list.reader != NULL) {
+                depth = s_list.window[i].depth;
+                title = s_list.window[i].title;
+            } else {
+                depth = txt_indent ? s_list.txt_window[i].level : 0;
+                title = s_list.txt_window[i].title;
+            }
+            if (depth > LIST_MAX_INDENT) depth = LIST_MAX_INDENT;
+            lv_obj_set_style_pad_left(label, 8 + depth * LIST_INDENT, 0);
+            lv_label_set_text(label, title);
+            lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        }
+        set_row_selected(i, s_list.page_first + i == s_list.selected);
+    }
+    update_header();
+}
+
+// 移动选中项；跨页时读入新的一页，同页内只改两行的样式
+static void select_entry(int index) {
+    if (index < 0) index = 0;
+    if (index >= s_list.total) index = s_list.total - 1;
+    if (index == s_list.selected) {
+        return;
+    }
+    const int page_first = index / s_list.rows_per_page * s_list.rows_per_page;
+    if (page_first != s_list.page_first) {
+        s_list.selected = index;
+        s_list.page_first = page_first;
+        load_page();
+        return;
+    }
+    set_row_selected(s_list.selected - s_list.page_first, false);
+    set_row_selected(index - s_list.page_first, true);
+    s_list.selected = index;
+}
+
+// 列表随阅读界面一起销毁时也在这里释放
+static void panel_delete_cb(lv_event_t *e) {
+    (void)e;
+    free(s_list.window);
+    free(s_list.txt_window);
+    memset(&s_list, 0, sizeof(s_list));
+}
+
+// 建立铺满 parent 的列表，每页行数按字体行高计算；窗口由调用方按行数分配
+static int list_create(lv_obj_t *parent, const lv_font_t *font) {
+    lv_obj_update_layout(parent);
+    const int32_t height = lv_obj_get_height(parent);
+    const int32_t row_h = lv_font_get_line_height(font) + 2 * LIST_ROW_PAD;
+    int rows = (int)((height - LIST_HEADER_H) / row_h);
+    if (rows > LIST_MAX_ROWS) rows = LIST_MAX_ROWS;
+    if (rows < 1) rows = 1;
+    s_list.rows_per_page = rows;
+
+    s_list.panel = lv_obj_create(parent);
+    lv_obj_set_size(s_list.panel, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_pos(s_list.panel, 0, 0);
+    lv_obj_set_style_pad_all(s_list.panel, 0, 0);
+    lv_obj_set_style_bg_color(s_list.panel, lv_color_white(), 0);
+    lv_obj_set_style_border_width(s_list.panel, 0, 0);
+    lv_obj_set_scrollbar_mode(s_list.panel, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_add_event_cb(s_list.panel, panel_delete_cb, LV_EVENT_DELETE, NULL);
+
+    lv_obj_t *header_bar = lv_obj_create(s_list.panel);
+    lv_obj_set_size(header_bar, LV_PCT(100), LIST_HEADER_H);
+    lv_obj_set_pos(header_bar, 0, 0);
+    lv_obj_set_style_pad_all(header_bar, 8, 0);
+    lv_obj_set_style_bg_color(header_bar, lv_color_black(), 0);
+    lv_obj_set_style_border_width(header_bar, 0, 0);
+
+    s_list.header = lv_label_create(header_bar);
+    lv_obj_set_style_text_font(s_list.header, font, 0);
+    lv_obj_set_style_text_color(s_list.header, lv_color_white(), 0);
+    lv_obj_align(s_list.header, LV_ALIGN_LEFT_MID, 5, 0);
+
+    for (int i = 0; i < rows; i++) {
+        lv_obj_t *label = lv_label_create(s_list.panel);
+        lv_obj_set_size(label, LV_PCT(100), row_h);
+        lv_obj_set_pos(label, 0, LIST_HEADER_H + i * row_h);
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_obj_set_style_pad_top(label, LIST_ROW_PAD, 0);
+        lv_obj_set_style_pad_right(label, 8, 0);
+        lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        s_list.rows[i] = label;
+    }
+    return rows;
+}
+
+// 选中 selected 所在的一页并显示
+static void list_show(int total, int selected) {
+    s_list.total = total;
+    s_list.selected = selected;
+    s_list.page_first = selected / s_list.rows_per_page * s_list.rows_per_page;
+    load_page();
+    ESP_LOGI(TAG, "Opened: %d entries, %d per page", total, s_list.rows_per_page);
+}
+
+bool chapter_list_open(lv_obj_t *parent, epub_reader_t *reader, const lv_font_t *font) {
+    if (parent == NULL || reader == NULL || font == NULL) {
+        return false;
+    }
+    chapter_list_close();
+
+    const int total = epub_parser_toc_count(reader);
+    if (total <= 0) {
+        ESP_LOGW(TAG, "Book has no table of contents");
+        return false;
+    }
+
+    const int rows = list_create(parent, font);
+    s_list.window = malloc(rows * sizeof(epub_toc_entry_t));
+    if (s_list.window == NULL) {
+        ESP_LOGE(TAG, "No memory for chapter list");
+        chapter_list_close();
+        return false;
+    }
+    s_list.reader = reader;
+
+    // 选中当前章节
+    list_show(total, epub_parser_toc_find(reader, reader->position.current_chapter));
+    return true;
+}
+
+bool chapter_list_open_txt(lv_obj_t *parent, long offset, const lv_font_t *font) {
+    if (parent == NULL || font == NULL) {
+        return false;
+    }
+    chapter_list_close();
+
+    const int total = txt_toc_count();
+    if (total <= 0) {
+        ESP_LOGW(TAG, txt_toc_is_ready() ? "No chapter headings found" : "Chapter scan not finished");
+        return false;
+    }
+
+    const int rows = list_create(parent, font);
+    s_list.txt_window = malloc(rows * sizeof(txt_toc_entry_t));
+    if (s_list.txt_window == NULL) {
+        ESP_LOGE(TAG, "No memory for chapter list");
+        chapter_list_close();
+        return false;
+    }
+
+    // 选中当前页所在的章节
+    list_show(total, txt_toc_find(offset));
+    return true;
+}
+
+bool chapter_list_is_open(void) {
+    return s_list.panel != NULL;
+}
+
+chapter_list_result_t chapter_list_handle_key(uint32_t key, long *target) {
+    if (s_list.panel == NULL) {
+        return CHAPTER_LIST_CLOSED;
+    }
+
+    switch (key) {
+        case LV_KEY_UP:
+        case LV_KEY_PREV:
+            select_entry(s_list.selected - 1);
+            break;
+
+        case LV_KEY_DOWN:
+        case LV_KEY_NEXT:
+            select_entry(s_list.selected + 1);
+            break;
+
+        case LV_KEY_LEFT:
+            select_entry(s_list.selected - s_list.rows_per_page);
+            break;
+
+        case LV_KEY_RIGHT:
+            select_entry(s_list.selected + s_list.rows_per_page);
+            break;
+
+        case LV_KEY_ENTER: {
+            const int row = s_list.selected - s_list.page_first;
+            if (row >= 0 && row < s_list.window_count) {
+                if (target != NULL) {
+                    *target = s_list.reader != NULL ? s_list.window[row].chapter_index
+                                                    : s_list.txt_window[row].offset;
+                }
+                chapter_list_close();
+                return CHAPTER_LIST_SELECTED;
+            }
+            break;
+        }
+
+        case LV_KEY_ESC:
+            chapter_list_close();
+            return CHAPTER_LIST_CLOSED;
+
+        default:
+            break;
+    }
+    return CHAPTER_LIST_NONE;
+}
+
+void chapter_list_close(void) {
+    if (s_list.panel != NULL) {
+        lv_obj_delete(s_list.panel);  // 由 panel_delete_cb 释放
+    } else {
+        free(s_list.window);
+        free(s_list.txt_window);
+        memset(&s_list, 0, sizeof(s_list));
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file chapter_list.h
+ * @brief 章节列表 - 阅读界面上的目录浮层（EPUB 目录与 TXT 识别出的章节）
+ *
+ * 目录保存在缓存中（epub_parser_toc_read / txt_toc_read），这里只读出当前一页的目录项，
+ * 翻页时再读下一页，目录再长也只占一页的内存
+ */
+
+#ifndef CHAPTER_LIST_H
+#define CHAPTER_LIST_H
+
+#include "lvgl.h"
+#include "epub_parser.h"
+#include "txt_toc.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 按键处理结果
+typedef enum {
+    CHAPTER_LIST_NONE,       // 列表内移动，需要刷新屏幕
+    CHAPTER_LIST_CLOSED,     // 列表已关闭
+    CHAPTER_LIST_SELECTED,   // 选中了目录项，列表已关闭
+} chapter_list_result_t;
+
+/**
+ * @brief 打开章节列表，选中当前章节所在的目录项
+ * @param parent 父对象（列表铺满父对象）
+ * @param reader 阅读器（列表打开期间需保持打开）
+ * @param font 标题字体
+ * @return true 成功，false 目录为空或内存不足
+ */
+bool chapter_list_open(lv_obj_t *parent, epub_reader_t *reader, const lv_font_t *font);
+
+/**
+ * @brief 打开 TXT 的章节列表（txt_toc），选中 offset 所在的章节
+ * @param parent 父对象（列表铺满父对象）
+ * @param offset 当前页首的文件偏移
+ * @param font 标题字体
+ * @return true 成功，false 目录尚未识别完成、没有章节或内存不足
+ */
+bool chapter_list_open_txt(lv_obj_t *parent, long offset, const lv_font_t *font);
+
+/**
+ * @brief 列表是否打开
+ */
+bool chapter_list_is_open(void);
+
+/**
+ * @brief 处理按键：上/下移动选中项，左/右翻页，确认跳转，返回关闭
+ * @param key LVGL 键值
+ * @param target 输出：选中项的跳转目标，EPUB 为章节索引，TXT 为文件偏移
+ *               （CHAPTER_LIST_SELECTED 时有效）
+ * @return 处理结果
+ */
+chapter_list_result_t chapter_list_handle_key(uint32_t key, long *target);
+
+/**
+ * @brief 关闭章节列表
+ */
+void chapter_list_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CHAPTER_LIST_H
@@ -0,0 +1,346 @@
+/**
+ * @file dict.c
+ * @brief 离线词典实现
+ */
+
+#include "dict.h"
+#include "file_pool.h"
+#include "flash_cache.h"
+#include "heap_stats.h"
+#include "mem_pressure.h"
+#include "lz_block.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "DICT";
+
+#define DICT_STDIO_BUF   512   // 块由 flash_cache 整块读取，FILE 缓冲只服务目录的零碎读取
+#define DIR_ENTRY_FIXED  10    // 目录项定长部分：共享 u8、后缀 u8、原始 u16、存储 u16、偏移 u32
+#define BLOCK_ENTRY_FIXED 4    // 块内词条定长部分：共享 u8、后缀 u8、释义长度 u16
+
+typedef struct {
+    uint16_t raw;
+    uint16_t stored;
+    uint32_t offset;
+} dir_block_t;
+
+static struct {
+    FILE *fp;
+    uint32_t cache_id;
+    uint32_t file_size;
+    dict_header_t hdr;
+    uint8_t *dir;          // 整个目录（NULL 时经 flash_cache 读取）
+    uint8_t *block;        // 最近一块的解压内容
+    uint8_t *packed;       // 压缩块的读取缓冲
+    uint32_t block_id;     // block 中是哪一块（UINT32_MAX 为无）
+    uint16_t block_len;
+    uint32_t lookups;
+    uint32_t block_loads;
+} s_dict = {.block_id = UINT32_MAX};
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static int key_cmp(const uint8_t *a, size_t a_len, const uint8_t *b, size_t b_len) {
+    const int c = memcmp(a, b, a_len < b_len ? a_len : b_len);
+    if (c != 0) {
+        return c;
+    }
+    return a_len < b_len ? -1 : a_len > b_len ? 1 : 0;
+}
+
+// 目录中 [offset, offset + len) 的内容
+static bool dir_read(uint32_t offset, void *buf, size_t len) {
+    if (offset > s_dict.hdr.dir_size || len > s_dict.hdr.dir_size - offset) {
+        return false;
+    }
+    if (s_dict.dir != NULL) {
+        memcpy(buf, s_dict.dir + offset, len);
+        return true;
+    }
+    return flash_cache_read(s_dict.cache_id, s_dict.fp, (long)s_dict.hdr.dir_offset,
+                            s_dict.hdr.dir_size, offset, buf, len);
+}
+
+// 解开 *pos 处的目录项：key 原有前 shared 字节，补上后缀；返回 false 表示格式错误
+static bool dir_entry(uint32_t *pos, uint8_t *key, size_t *key_len, dir_block_t *out) {
+    uint8_t buf[DIR_ENTRY_FIXED + DICT_KEY_MAX];
+    const uint32_t left = s_dict.hdr.dir_size - *pos;
+    const size_t want = left < sizeof(buf) ? left : sizeof(buf);
+    if (*pos >= s_dict.hdr.dir_size || want < DIR_ENTRY_FIXED || !dir_read(*pos, buf, want)) {
+        return false;
+    }
+    const uint8_t shared = buf[0];
+    const uint8_t suffix = buf[1];
+    if (shared > *key_len || shared + suffix > DICT_KEY_MAX || (size_t)DIR_ENTRY_FIXED + suffix > want) {
+        return false;
+    }
+    out->raw = get_u16(buf + 2);
+    out->stored = get_u16(buf + 4);
+    out->offset = get_u32(buf + 6);
+    memcpy(key + shared, buf + DIR_ENTRY_FIXED, suffix);
+    *key_len = shared + suffix;
+    *pos += DIR_ENTRY_FIXED + suffix;
+    return true;
+}
+
+// 重启点 r 的目录项位置
+static bool restart_pos(uint32_t r, uint32_t *pos) {
+    uint8_t b[4];
+    const uint32_t table = s_dict.hdr.dir_size - s_dict.hdr.restart_count * 4;
+    if (!dir_read(table + r * 4, b, sizeof(b))) {
+        return false;
+    }
+    *pos = get_u32(b);
+    return *pos < table;
+}
+
+// 找到首键不大于 key 的最后一块；key 比第一块的首键还小时返回 false
+static bool find_block(const uint8_t *key, size_t len, uint32_t *index, dir_block_t *out) {
+    uint8_t cur[DICT_KEY_MAX];
+    size_t cur_len = 0;
+    dir_block_t blk;
+    uint32_t pos;
+
+    // 重启点上二分：最后一个首键 <= key 的重启点
+    uint32_t lo = 0;
+    uint32_t hi = s_dict.hdr.restart_count;
+    while (lo < hi) {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        cur_len = 0;
+        if (!restart_pos(mid, &pos) || !dir_entry(&pos, cur, &cur_len, &blk)) {
+            return false;
+        }
+        if (key_cmp(cur, cur_len, key, len) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return false;
+    }
+
+    // 从重启点顺序解开，直到首键超过 key
+    const uint32_t r = lo - 1;
+    uint32_t block = r * s_dict.hdr.restart_interval;
+    cur_len = 0;
+    if (!restart_pos(r, &pos) || !dir_entry(&pos, cur, &cur_len, out)) {
+        return false;
+    }
+    *index = block;
+    for (uint32_t i = 1; i < s_dict.hdr.restart_interval; i++) {
+        if (++block >= s_dict.hdr.block_count || !dir_entry(&pos, cur, &cur_len, &blk) ||
+            key_cmp(cur, cur_len, key, len) > 0) {
+            break;
+        }
+        *index = block;
+        *out = blk;
+    }
+    return true;
+}
+
+static bool load_block(uint32_t index, const dir_block_t *blk) {
+    if (s_dict.block_id == index) {
+        return true;
+    }
+    if (blk->raw == 0 || blk->raw > s_dict.hdr.block_max || blk->stored > blk->raw ||
+        blk->offset > s_dict.file_size || blk->stored > s_dict.file_size - blk->offset) {
+        ESP_LOGW(TAG, "Bad directory entry for block %lu", (unsigned long)index);
+        return false;
+    }
+    // 原样保存的块直接读进解压缓冲区
+    uint8_t *dst = blk->stored == blk->raw ? s_dict.block : s_dict.packed;
+    s_dict.block_id = UINT32_MAX;
+    if (!flash_cache_read(s_dict.cache_id, s_dict.fp, 0, s_dict.file_size, blk->offset, dst, blk->stored) ||
+        (blk->stored != blk->raw && !lz_block_decode(s_dict.packed, blk->stored, s_dict.block, blk->raw))) {
+        ESP_LOGW(TAG, "Failed to load block %lu", (unsigned long)index);
+        return false;
+    }
+    s_dict.block_id = index;
+    s_dict.block_len = blk->raw;
+    s_dict.block_loads++;
+    return true;
+}
+
+// 在已载入的块中顺序查找（块内按键排序，超过 key 即停）
+static bool scan_block(const uint8_t *key, size_t len, const char **def, size_t *def_len) {
+    uint8_t cur[DICT_KEY_MAX];
+    size_t cur_len = 0;
+    uint32_t pos = 0;
+    while (pos + BLOCK_ENTRY_FIXED <= s_dict.block_len) {
+        const uint8_t *e = s_dict.block + pos;
+        const uint8_t shared = e[0];
+        const uint8_t suffix = e[1];
+        const uint16_t dlen = get_u16(e + 2);
+        const uint32_t next = pos + BLOCK_ENTRY_FIXED + suffix + dlen;
+        if (shared > cur_len || shared + suffix > DICT_KEY_MAX || next > s_dict.block_len) {
+            ESP_LOGW(TAG, "Corrupt block %lu", (unsigned long)s_dict.block_id);
+            return false;
+        }
+        memcpy(cur + shared, e + BLOCK_ENTRY_FIXED, suffix);
+        cur_len = shared + suffix;
+        const int c = key_cmp(cur, cur_len, key, len);
+        if (c == 0) {
+            *def = (const char *)e + BLOCK_ENTRY_FIXED + suffix;
+            *def_len = dlen;
+            return true;
+        }
+        if (c > 0) {
+            break;
+        }
+        pos = next;
+    }
+    return false;
+}
+
+// 目录在内存紧张时丢掉，之后经 flash_cache 读取
+static bool trim_dir(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    if (s_dict.dir == NULL) {
+        return false;
+    }
+    ESP_LOGW(TAG, "Dropping the %lu-byte directory", (unsigned long)s_dict.hdr.dir_size);
+    heap_stats_free(HEAP_TAG_DICT, s_dict.dir);
+    s_dict.dir = NULL;
+    mem_pressure_unregister(trim_dir, NULL);
+    return true;
+}
+
+static bool header_valid(const dict_header_t *h, uint32_t file_size) {
+    if (h->magic != DICT_MAGIC || h->version != DICT_VERSION) {
+        return false;
+    }
+    if (h->block_count == 0 || h->restart_interval == 0 || h->block_max == 0 ||
+        h->block_max > LZ_BLOCK_MAX) {
+        return false;
+    }
+    const uint32_t restarts = (h->block_count + h->restart_interval - 1) / h->restart_interval;
+    return h->restart_count == restarts && h->dir_offset >= sizeof(dict_header_t) &&
+           h->dir_offset <= file_size && h->dir_size <= file_size - h->dir_offset &&
+           h->dir_size > restarts * 4;
+}
+
+bool dict_open(void) {
+    if (s_dict.fp != NULL) {
+        return true;
+    }
+    FILE *fp = file_pool_fopen(DICT_FILE);
+    if (fp == NULL) {
+        return false;
+    }
+    setvbuf(fp, NULL, _IOFBF, DICT_STDIO_BUF);
+    fseek(fp, 0, SEEK_END);
+    const long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    dict_header_t hdr;
+    if (size <= 0 || fread(&hdr, sizeof(hdr), 1, fp) != 1 || !header_valid(&hdr, (uint32_t)size)) {
+        ESP_LOGW(TAG, "Not a dictionary: %s", DICT_FILE);
+        fclose(fp);
+        return false;
+    }
+    s_dict.block = heap_stats_malloc(HEAP_TAG_DICT, hdr.block_max);
+    s_dict.packed = heap_stats_malloc(HEAP_TAG_DICT, hdr.block_max);
+    if (s_dict.block == NULL || s_dict.packed == NULL) {
+        ESP_LOGE(TAG, "No memory for a %lu-byte block", (unsigned long)hdr.block_max);
+        heap_stats_free(HEAP_TAG_DICT, s_dict.block);
+        heap_stats_free(HEAP_TAG_DICT, s_dict.packed);
+        s_dict.block = NULL;
+        s_dict.packed = NULL;
+        fclose(fp);
+        return false;
+    }
+    s_dict.fp = fp;
+    s_dict.hdr = hdr;
+    s_dict.file_size = (uint32_t)size;
+    s_dict.cache_id = flash_cache_file_id(DICT_FILE);
+    s_dict.block_id = UINT32_MAX;
+
+    // 目录放得下预算时整体读入，否则每次查找经 flash_cache 读几个目录项
+    if (hdr.dir_size <= heap_stats_cache_budget(0, DICT_DIR_HEAP_SHARE)) {
+        s_dict.dir = heap_stats_malloc(HEAP_TAG_DICT, hdr.dir_size);
+        if (s_dict.dir != NULL &&
+            (fseek(fp, (long)hdr.dir_offset, SEEK_SET) != 0 || fread(s_dict.dir, 1, hdr.dir_size, fp) != hdr.dir_size)) {
+            heap_stats_free(HEAP_TAG_DICT, s_dict.dir);
+            s_dict.dir = NULL;
+        }
+        if (s_dict.dir != NULL) {
+            mem_pressure_register("dict", MEM_PRESSURE_PRIO_CACHE, HEAP_TAG_DICT, MEM_PRESSURE_SYNC, trim_dir, NULL);
+        }
+    }
+    ESP_LOGI(TAG, "Opened: %lu entries in %lu blocks, %lu-byte directory %s",
+             (unsigned long)hdr.entry_count, (unsigned long)hdr.block_count,
+             (unsigned long)hdr.dir_size, s_dict.dir != NULL ? "in RAM" : "on demand");
+    return true;
+}
+
+void dict_close(void) {
+    if (s_dict.fp == NULL) {
+        return;
+    }
+    ESP_LOGI(TAG, "Closed: %lu lookups, %lu block loads", (unsigned long)s_dict.lookups,
+             (unsigned long)s_dict.block_loads);
+    mem_pressure_unregister(trim_dir, NULL);
+    heap_stats_free(HEAP_TAG_DICT, s_dict.dir);
+    heap_stats_free(HEAP_TAG_DICT, s_dict.block);
+    heap_stats_free(HEAP_TAG_DICT, s_dict.packed);
+    fclose(s_dict.fp);
+    memset(&s_dict, 0, sizeof(s_dict));
+    s_dict.block_id = UINT32_MAX;
+}
+
+bool dict_is_open(void) {
+    return s_dict.fp != NULL;
+}
+
+bool dict_lookup(const char *key, size_t len, const char **def, size_t *def_len) {
+    if (s_dict.fp == NULL || len == 0 || len > DICT_KEY_MAX) {
+        return false;
+    }
+    uint8_t k[DICT_KEY_MAX];
+    for (size_t i = 0; i < len; i++) {
+        const uint8_t c = (uint8_t)key[i];
+        k[i] = c >= 'A' && c <= 'Z' ? (uint8_t)(c + 32) : c;
+    }
+    s_dict.lookups++;
+    uint32_t index;
+    dir_block_t blk;
+    return find_block(k, len, &index, &blk) && load_block(index, &blk) &&
+           scan_block(k, len, def, def_len);
+}
+
+size_t dict_lookup_prefix(const char *text, size_t len, int max_chars,
+                          const char **def, size_t *def_len) {
+    // 各字符的结束位置，从最长的前缀开始试
+    size_t ends[16];
+    int count = 0;
+    size_t pos = 0;
+    if (max_chars > (int)(sizeof(ends) / sizeof(ends[0]))) {
+        max_chars = (int)(sizeof(ends) / sizeof(ends[0]));
+    }
+    while (count < max_chars && pos < len) {
+        const uint8_t c = (uint8_t)text[pos];
+        const size_t n = c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 :
+                         (c & 0xF8) == 0xF0 ? 4 : 1;
+        if (pos + n > len || pos + n > DICT_KEY_MAX) {
+            break;
+        }
+        pos += n;
+        ends[count++] = pos;
+    }
+    for (int i = count - 1; i >= 0; i--) {
+        if (dict_lookup(text, ends[i], def, def_len)) {
+            return ends[i];
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file dict.h
+ * @brief 离线词典 - 电脑上生成的有序分块词典（tools/x4dict.py），查一个词只读一块
+ *
+ * 文件（DICT_FILE，小端）：
+ *   dict_header_t
+ *   数据块：按键的字节序排好的词条依次装进约 4 KB 的块，每块按 lz_block 格式独立压缩
+ *     （压缩后不更小的原样保存）。块内词条：共享前缀长度 u8、后缀长度 u8、释义长度 u16、
+ *     键后缀、释义（UTF-8）；每块第一个词条的键完整保存
+ *   块目录：每块一项（共享前缀长度 u8、后缀长度 u8、原始长度 u16、存储长度 u16、
+ *     文件偏移 u32、首键后缀），键相对上一项做前缀压缩，每 restart_interval 项完整保存
+ *     一次；其后是各重启点在目录中的偏移（u32）
+ * 键是小写化的 UTF-8。目录放得下缓存预算时整体读入内存，否则经 flash_cache 按需读取
+ * （常用的部分会被提升到内部 flash）。查找：在重启点上二分，再顺序解开至多
+ * restart_interval 项找到所在块，读出并解压这一块（最近一块保留在内存中）后扫描。
+ * 只在 LVGL 任务中调用
+ */
+
+#ifndef DICT_H
+#define DICT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DICT_FILE           "/sdcard/词典.x4d"
+#define DICT_MAGIC          0x43443458u  // "X4DC"
+#define DICT_VERSION        1
+#define DICT_KEY_MAX        64     // 键的最大字节数（生成时超长的词条被丢弃）
+#define DICT_DEF_MAX        4000   // 释义的最大字节数（生成时截断）
+#define DICT_DIR_HEAP_SHARE 4      // 目录最多占缓存预算的 1/N，否则按需读取
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t restart_interval;   // 目录每多少项完整保存一次键
+    uint32_t entry_count;
+    uint32_t block_count;
+    uint32_t block_max;          // 最大的块原始长度（解压缓冲区大小）
+    uint32_t dir_offset;
+    uint32_t dir_size;           // 目录项与重启点表的总字节数
+    uint32_t restart_count;
+} dict_header_t;
+
+/**
+ * @brief 打开 DICT_FILE（已打开时直接返回）
+ * @return true 词典可用（文件不存在、格式不符或内存不足时为 false）
+ */
+bool dict_open(void);
+
+/**
+ * @brief 关闭词典并释放目录与块缓存
+ */
+void dict_close(void);
+
+/**
+ * @brief 词典是否已打开
+ */
+bool dict_is_open(void);
+
+/**
+ * @brief 精确查找一个键
+ * @param key 键（UTF-8，ASCII 字母按小写比较）
+ * @param len 键的字节数
+ * @param def 输出：释义（不以 NUL 结尾，指向块缓存，下一次查找前有效）
+ * @param def_len 输出：释义字节数
+ * @return true 找到
+ */
+bool dict_lookup(const char *key, size_t len, const char **def, size_t *def_len);
+
+/**
+ * @brief 最长前缀查找：text 开头最长的、词典中有的词（中文没有空格分词时使用）
+ * @param text 文本（UTF-8）
+ * @param len 文本字节数
+ * @param max_chars 最多尝试的字符数
+ * @param def 输出：释义（同 dict_lookup）
+ * @param def_len 输出：释义字节数
+ * @return 匹配的字节数，0 表示连第一个字都查不到
+ */
+size_t dict_lookup_prefix(const char *text, size_t len, int max_chars,
+                          const char **def, size_t *def_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DICT_H
@@ -0,0 +1,393 @@
+/**
+ * @file dict_popup.c
+ * @brief 阅读器查词浮层实现
+ */
+
+#include "dict_popup.h"
+#include "dict.h"
+#include "text_layout.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "DICT_POPUP";
+
+#define POPUP_BORDER   2
+#define POPUP_PAD      10
+#define SOFT_HYPHEN_0  0xC2    // U+00AD 的 UTF-8 编码
+#define SOFT_HYPHEN_1  0xAD
+
+// 页面上可选的一个词：页面文本中的字节区间
+typedef struct {
+    uint16_t start;
+    uint16_t len;
+    bool cjk;
+} word_unit_t;
+
+static struct {
+    lv_obj_t *panel;
+    lv_obj_t *word;
+    lv_obj_t *def;
+    lv_obj_t *view;
+    const char *text;
+    const text_page_layout_t *layout;
+    uint32_t text_end;           // 页面最后一行的结束位置
+    word_unit_t *units;
+    int unit_count;
+    int selected;
+    bool placed;
+    bool at_bottom;              // 浮层在正文区域下半部
+    char *buf;                   // 查词用的键与显示用的释义
+} s_pop;
+
+// 解码一个 UTF-8 字符，返回字节数（非法或不完整时按单字节）
+static uint32_t utf8_next(const uint8_t *s, uint32_t len, uint32_t *cp) {
+    const uint8_t c = s[0];
+    uint32_t n = c < 0x80 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+    if (n == 1 || n > len) {
+        *cp = c;
+        return 1;
+    }
+    *cp = c & (0x7F >> n);
+    for (uint32_t i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *cp = c;
+            return 1;
+        }
+        *cp = (*cp << 6) | (s[i] & 0x3F);
+    }
+    return n;
+}
+
+static bool is_cjk(uint32_t c) {
+    return (c >= 0x3040 && c <= 0x30FF) || (c >= 0x3400 && c <= 0x4DBF) ||
+           (c >= 0x4E00 && c <= 0x9FFF) || (c >= 0xF900 && c <= 0xFAFF) ||
+           (c >= 0x20000 && c <= 0x2FFFF);
+}
+
+static bool is_latin(uint32_t c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+           (c >= 0xC0 && c <= 0x24F && c != 0xD7 && c != 0xF7);
+}
+
+// 把页面切成可选的词：西文按连续字母（含词中撇号与软连字符），汉字和假名每字一个。
+// out 为 NULL 时只计数
+static int build_units(word_unit_t *out) {
+    const uint8_t *s = (const uint8_t *)s_pop.text;
+    uint32_t pos = s_pop.layout->lines[0].start;
+    int count = 0;
+    while (pos < s_pop.text_end) {
+        uint32_t cp;
+        const uint32_t n = utf8_next(s + pos, s_pop.text_end - pos, &cp);
+        if (is_cjk(cp)) {
+            if (out != NULL) {
+                out[count] = (word_unit_t){(uint16_t)pos, (uint16_t)n, true};
+            }
+            count++;
+            pos += n;
+            continue;
+        }
+        if (!is_latin(cp)) {
+            pos += n;
+            continue;
+        }
+        const uint32_t start = pos;
+        uint32_t end = pos + n;
+        pos = end;
+        while (pos < s_pop.text_end) {
+            const uint32_t m = utf8_next(s + pos, s_pop.text_end - pos, &cp);
+            if (is_latin(cp)) {
+                end = pos + m;
+            } else if (cp != '\'' && cp != 0x2019 && cp != 0x00AD) {
+                break;
+            }
+            pos += m;
+        }
+        pos = end;
+        if (out != NULL) {
+            out[count] = (word_unit_t){(uint16_t)start, (uint16_t)(end - start), false};
+        }
+        count++;
+    }
+    return count;
+}
+
+// 包含 offset 的行
+static int line_of(uint32_t offset) {
+    const text_page_layout_t *layout = s_pop.layout;
+    int line = 0;
+    for (int i = 0; i < layout->line_count; i++) {
+        if (layout->lines[i].start <= offset) {
+            line = i;
+        }
+    }
+    return line;
+}
+
+// 西文单词去掉软连字符，弯撇号换成直撇号；返回键长度（超长时为 0）
+static size_t latin_key(const word_unit_t *u, char *key) {
+    const uint8_t *s = (const uint8_t *)s_pop.text + u->start;
+    size_t n = 0;
+    for (uint16_t i = 0; i < u->len; i++) {
+        if (s[i] == SOFT_HYPHEN_0 && i + 1 < u->len && s[i + 1] == SOFT_HYPHEN_1) {
+            i++;
+            continue;
+        }
+        if (s[i] == 0xE2 && i + 2 < u->len && s[i + 1] == 0x80 && s[i + 2] == 0x99) {
+            key[n++] = '\'';
+            i += 2;
+            continue;
+        }
+        if (n >= DICT_KEY_MAX) {
+            return 0;
+        }
+        key[n++] = (char)s[i];
+    }
+    return n;
+}
+
+// 查不到原词时依次去掉这些词尾再试（只求查到词根，不做完整的词形还原）
+static const char *const s_suffixes[] = {"'s", "s", "es", "ed", "d", "ing", "ly"};
+
+static bool lookup_latin(const word_unit_t *u, const char **def, size_t *def_len) {
+    char key[DICT_KEY_MAX];
+    const size_t len = latin_key(u, key);
+    if (len == 0) {
+        return false;
+    }
+    if (dict_lookup(key, len, def, def_len)) {
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(s_suffixes) / sizeof(s_suffixes[0]); i++) {
+        const size_t sl = strlen(s_suffixes[i]);
+        if (len > sl + 1 && strncasecmp(key + len - sl, s_suffixes[i], sl) == 0 &&
+            dict_lookup(key, len - sl, def, def_len)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 浮层放在正文区域中与选中的词相对的一半
+static void place_panel(void) {
+    lv_area_t view_area;
+    lv_obj_get_coords(s_pop.view, &view_area);
+    lv_area_t mark;
+    const int32_t mid = (view_area.y1 + view_area.y2) / 2;
+    const bool at_bottom = !text_view_get_mark_area(s_pop.view, &mark) || (mark.y1 + mark.y2) / 2 < mid;
+    if (s_pop.placed && at_bottom == s_pop.at_bottom) {
+        return;
+    }
+    s_pop.placed = true;
+    s_pop.at_bottom = at_bottom;
+    const int32_t h = lv_area_get_height(&view_area) * DICT_POPUP_HEIGHT_PCT / 100;
+    lv_obj_set_size(s_pop.panel, lv_area_get_width(&view_area), h);
+    lv_obj_set_pos(s_pop.panel, view_area.x1, at_bottom ? view_area.y2 - h + 1 : view_area.y1);
+}
+
+// 标出选中的词并显示释义
+static void show_selected(void) {
+    const word_unit_t *u = &s_pop.units[s_pop.selected];
+    const char *def = NULL;
+    size_t def_len = 0;
+    size_t mark_len = u->len;
+    bool found;
+    if (u->cjk) {
+        const size_t matched = dict_lookup_prefix(s_pop.text + u->start, s_pop.text_end - u->start,
+                                                  DICT_POPUP_CJK_MAX, &def, &def_len);
+        found = matched > 0;
+        if (found) {
+            mark_len = matched;
+        }
+    } else {
+        found = lookup_latin(u, &def, &def_len);
+    }
+    text_view_set_mark(s_pop.view, u->start, (uint32_t)mark_len);
+    place_panel();
+
+    const size_t word_len = mark_len < DICT_DEF_MAX ? mark_len : DICT_DEF_MAX;
+    memcpy(s_pop.buf, s_pop.text + u->start, word_len);
+    s_pop.buf[word_len] = '\0';
+    lv_label_set_text(s_pop.word, s_pop.buf);
+    if (!dict_is_open()) {
+        lv_label_set_text(s_pop.def, "没有词典：把 tools/x4dict.py 生成的词典放到 " DICT_FILE);
+    } else if (!found) {
+        lv_label_set_text(s_pop.def, "词典中没有这个词");
+    } else {
+        if (def_len > DICT_DEF_MAX) {
+            def_len = DICT_DEF_MAX;
+        }
+        memcpy(s_pop.buf, def, def_len);
+        s_pop.buf[def_len] = '\0';
+        lv_label_set_text(s_pop.def, s_pop.buf);
+    }
+    lv_obj_scroll_to_y(s_pop.panel, 0, LV_ANIM_OFF);
+}
+
+static void select_unit(int index) {
+    if (index < 0) index = 0;
+    if (index >= s_pop.unit_count) index = s_pop.unit_count - 1;
+    if (index == s_pop.selected) {
+        return;
+    }
+    s_pop.selected = index;
+    show_selected();
+}
+
+// 移到上一行/下一行的第一个词（那一行没有词时继续找）
+static void select_line(int delta) {
+    const int line = line_of(s_pop.units[s_pop.selected].start);
+    int i = s_pop.selected;
+    if (delta > 0) {
+        while (i < s_pop.unit_count && line_of(s_pop.units[i].start) <= line) i++;
+        select_unit(i);
+        return;
+    }
+    // 先退到本行第一个词之前，再退到上一行的第一个词
+    while (i > 0 && line_of(s_pop.units[i - 1].start) >= line) i--;
+    if (i == 0) {
+        return;
+    }
+    const int prev_line = line_of(s_pop.units[i - 1].start);
+    while (i > 0 && line_of(s_pop.units[i - 1].start) == prev_line) i--;
+    select_unit(i);
+}
+
+// 释义较长时翻到下一屏，到底后回到开头
+static void page_definition(void) {
+    const int32_t step = lv_obj_get_content_height(s_pop.panel) - lv_font_get_line_height(lv_obj_get_style_text_font(s_pop.def, 0));
+    if (lv_obj_get_scroll_bottom(s_pop.panel) > 0 && step > 0) {
+        lv_obj_scroll_by(s_pop.panel, 0, -step, LV_ANIM_OFF);
+    } else {
+        lv_obj_scroll_to_y(s_pop.panel, 0, LV_ANIM_OFF);
+    }
+}
+
+// 浮层随阅读界面一起销毁时也在这里释放
+static void panel_delete_cb(lv_event_t *e) {
+    (void)e;
+    free(s_pop.units);
+    free(s_pop.buf);
+    memset(&s_pop, 0, sizeof(s_pop));
+}
+
+bool dict_popup_open(lv_obj_t *parent, lv_obj_t *text_view, const lv_font_t *font) {
+    if (parent == NULL || text_view == NULL || font == NULL) {
+        return false;
+    }
+    dict_popup_close();
+
+    const char *text;
+    const text_page_layout_t *layout;
+    text_view_get_page(text_view, &text, &layout);
+    if (text == NULL || layout == NULL || layout->line_count == 0) {
+        return false;
+    }
+    const text_line_t *last = &layout->lines[layout->line_count - 1];
+    s_pop.view = text_view;
+    s_pop.text = text;
+    s_pop.layout = layout;
+    s_pop.text_end = (uint32_t)last->start + last->len;
+    s_pop.unit_count = build_units(NULL);
+    if (s_pop.unit_count == 0) {
+        memset(&s_pop, 0, sizeof(s_pop));
+        return false;
+    }
+    s_pop.units = malloc(s_pop.unit_count * sizeof(word_unit_t));
+    s_pop.buf = malloc(DICT_DEF_MAX + DICT_KEY_MAX + 1);
+    if (s_pop.units == NULL || s_pop.buf == NULL) {
+        ESP_LOGE(TAG, "No memory for the dictionary popup");
+        free(s_pop.units);
+        free(s_pop.buf);
+        memset(&s_pop, 0, sizeof(s_pop));
+        return false;
+    }
+    build_units(s_pop.units);
+    dict_open();
+
+    s_pop.panel = lv_obj_create(parent);
+    lv_obj_set_size(s_pop.panel, 0, 0);
+    lv_obj_set_style_pad_all(s_pop.panel, POPUP_PAD, 0);
+    lv_obj_set_style_pad_row(s_pop.panel, POPUP_PAD / 2, 0);
+    lv_obj_set_style_bg_color(s_pop.panel, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(s_pop.panel, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_color(s_pop.panel, lv_color_black(), 0);
+    lv_obj_set_style_border_width(s_pop.panel, POPUP_BORDER, 0);
+    lv_obj_set_style_radius(s_pop.panel, 0, 0);
+    lv_obj_set_scrollbar_mode(s_pop.panel, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_set_flex_flow(s_pop.panel, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(s_pop.panel, panel_delete_cb, LV_EVENT_DELETE, NULL);
+
+    s_pop.word = lv_label_create(s_pop.panel);
+    lv_obj_set_width(s_pop.word, LV_PCT(100));
+    lv_obj_set_style_text_font(s_pop.word, font, 0);
+    lv_obj_set_style_pad_bottom(s_pop.word, 2, 0);
+    lv_obj_set_style_border_side(s_pop.word, LV_BORDER_SIDE_BOTTOM, 0);
+    lv_obj_set_style_border_width(s_pop.word, 1, 0);
+    lv_obj_set_style_border_color(s_pop.word, lv_color_black(), 0);
+
+    s_pop.def = lv_label_create(s_pop.panel);
+    lv_obj_set_width(s_pop.def, LV_PCT(100));
+    lv_obj_set_style_text_font(s_pop.def, font, 0);
+    lv_label_set_long_mode(s_pop.def, LV_LABEL_LONG_WRAP);
+
+    s_pop.selected = 0;
+    show_selected();
+    ESP_LOGI(TAG, "Opened: %d words on the page", s_pop.unit_count);
+    return true;
+}
+
+bool dict_popup_is_open(void) {
+    return s_pop.panel != NULL;
+}
+
+dict_popup_result_t dict_popup_handle_key(uint32_t key) {
+    if (s_pop.panel == NULL) {
+        return DICT_POPUP_CLOSED;
+    }
+
+    switch (key) {
+        case LV_KEY_LEFT:
+        case LV_KEY_PREV:
+            select_unit(s_pop.selected - 1);
+            break;
+
+        case LV_KEY_RIGHT:
+        case LV_KEY_NEXT:
+            select_unit(s_pop.selected + 1);
+            break;
+
+        case LV_KEY_UP:
+            select_line(-1);
+            break;
+
+        case LV_KEY_DOWN:
+            select_line(1);
+            break;
+
+        case LV_KEY_ENTER:
+            page_definition();
+            break;
+
+        case LV_KEY_ESC:
+            dict_popup_close();
+            return DICT_POPUP_CLOSED;
+
+        default:
+            break;
+    }
+    return DICT_POPUP_NONE;
+}
+
+void dict_popup_close(void) {
+    if (s_pop.panel != NULL) {
+        text_view_set_mark(s_pop.view, 0, 0);
+        lv_obj_delete(s_pop.panel);  // 由 panel_delete_cb 释放
+    } else {
+        free(s_pop.units);
+        free(s_pop.buf);
+        memset(&s_pop, 0, sizeof(s_pop));
+    }
+}
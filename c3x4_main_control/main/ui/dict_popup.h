@@ -0,0 +1,61 @@
+/**
+ * @file dict_popup.h
+ * @brief 阅读器查词浮层 - 在当前页上选词，释义在正文区域的另一半弹出
+ *
+ * 阅读器只有按键：打开后页面上第一个词被加下划线，←/→ 逐词移动，↑/↓ 移到上一行/下一行，
+ * 每次移动都立即查词（dict.h：二分加一次块读取）。英文按整个单词查（查不到时去掉常见
+ * 词尾再试），中文从选中的字开始取词典中最长的词。浮层放在正文区域内、避开选中的词，
+ * 只局部刷新下划线和浮层。确认键翻看较长的释义，返回键关闭
+ */
+
+#ifndef DICT_POPUP_H
+#define DICT_POPUP_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DICT_POPUP_CJK_MAX     8     // 中文最长匹配的字数
+#define DICT_POPUP_HEIGHT_PCT  40    // 浮层占正文区域高度的百分比
+
+// 按键处理结果
+typedef enum {
+    DICT_POPUP_NONE,     // 选词移动或翻看释义，需要局部刷新
+    DICT_POPUP_CLOSED,   // 浮层已关闭
+} dict_popup_result_t;
+
+/**
+ * @brief 打开查词浮层
+ * @param parent 父对象（阅读器屏幕）
+ * @param text_view 显示当前页的 text_view 控件（浮层放在它的区域内）
+ * @param font 文字字体
+ * @return true 成功；页面上没有可选的词或内存不足时为 false
+ */
+bool dict_popup_open(lv_obj_t *parent, lv_obj_t *text_view, const lv_font_t *font);
+
+/**
+ * @brief 浮层是否打开
+ */
+bool dict_popup_is_open(void);
+
+/**
+ * @brief 处理按键：←/→ 换词，↑/↓ 换行，确认翻看释义，返回关闭
+ * @param key LVGL 键值
+ * @return 处理结果
+ */
+dict_popup_result_t dict_popup_handle_key(uint32_t key);
+
+/**
+ * @brief 关闭浮层、去掉下划线（词典保持打开，由阅读器关闭时 dict_close）
+ */
+void dict_popup_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DICT_POPUP_H
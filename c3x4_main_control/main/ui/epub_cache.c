@@ -0,0 +1,610 @@
+/**
+ * @file epub_cache.c
+ * @brief EPUB 缓存实现：按内容寻址的条目文件 + 可重建的 LRU 索引
+ *
+ * 每个缓存项是 EPUB_CACHE_DIR 下的一个文件，文件名是缓存键的哈希，
+ * 文件头带校验，写入先落到 .tmp 再改名，断电最多丢失正在写的一项。
+ * 索引只记录大小与最近使用序号（LRU），同样先写临时文件；
+ * 两份都损坏时扫描目录从各条目的文件头重建
+ */
+
+#include "epub_cache.h"
+#include "page_index.h"
+#include "flash_cache.h"
+#include "esp_log.h"
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "EPUB_CACHE";
+
+#define EPUB_CACHE_DIR        PAGE_INDEX_DIR "/epub"
+#define EPUB_CACHE_INDEX_FILE EPUB_CACHE_DIR "/index.bin"
+#define EPUB_CACHE_INDEX_TMP  EPUB_CACHE_DIR "/index.tmp"
+#define EPUB_CACHE_MAX_ITEMS  512
+
+#define ITEM_MAGIC   0x31434345u  // "ECC1"
+#define INDEX_MAGIC  0x31494345u  // "ECI1"
+#define CHECK_SEED   0x9E3779B9u  // 第二个哈希的种子，与文件名哈希一起排除碰撞
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t name;        // 缓存键哈希（即文件名）
+    uint32_t check;       // 缓存键的第二个哈希
+    uint32_t size;        // 数据字节数
+    uint32_t data_hash;   // 数据校验
+    uint8_t type;
+    uint8_t reserved[3];
+} cache_item_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t name;
+    uint32_t check;
+    uint32_t size;
+    uint32_t stamp;       // 最近使用序号，越小越久未用
+} cache_entry_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t seq;
+    uint32_t entries_hash;
+} cache_index_header_t;
+
+static struct {
+    bool ready;
+    cache_entry_t entries[EPUB_CACHE_MAX_ITEMS];
+    int count;
+    uint32_t seq;
+    size_t used;          // 按块取整后的占用
+    bool dirty;           // 仅使用序号变化时延迟到下次写入再保存
+    // 最近一次计算的书籍身份（避免每次都 stat）
+    char book_path[256];
+    uint32_t book_id;
+} s_cache;
+
+static size_t chunk_bytes(uint32_t size) {
+    const size_t total = size + sizeof(cache_item_header_t);
+    return (total + EPUB_CACHE_CHUNK_SIZE - 1) / EPUB_CACHE_CHUNK_SIZE * EPUB_CACHE_CHUNK_SIZE;
+}
+
+static void item_path(uint32_t name, const char *ext, char *out, size_t len) {
+    snprintf(out, len, "%s/%08x.%s", EPUB_CACHE_DIR, (unsigned)name, ext);
+}
+
+// 书籍身份：路径 + 大小 + 修改时间，替换同名文件后旧缓存自然失效
+static uint32_t book_identity(const char *epub_path) {
+    if (strcmp(s_cache.book_path, epub_path) == 0) {
+        return s_cache.book_id;
+    }
+    struct stat st;
+    uint32_t stamp[2] = {0, 0};
+    if (stat(epub_path, &st) == 0) {
+        stamp[0] = (uint32_t)st.st_size;
+        stamp[1] = (uint32_t)st.st_mtime;
+    }
+    uint32_t id = page_index_hash(0, epub_path, strlen(epub_path));
+    id = page_index_hash(id, stamp, sizeof(stamp));
+
+    strncpy(s_cache.book_path, epub_path, sizeof(s_cache.book_path) - 1);
+    s_cache.book_path[sizeof(s_cache.book_path) - 1] = '\0';
+    s_cache.book_id = id;
+    return id;
+}
+
+static void key_hashes(const epub_cache_key_t *key, uint32_t *name, uint32_t *check) {
+    const uint32_t book = book_identity(key->epub_path);
+    const uint8_t type = (uint8_t)key->type;
+    const size_t content_len = strnlen(key->content_path, sizeof(key->content_path));
+
+    uint32_t h = page_index_hash(0, &book, sizeof(book));
+    h = page_index_hash(h, &type, sizeof(type));
+    *name = page_index_hash(h, key->content_path, content_len);
+
+    h = page_index_hash(CHECK_SEED, key->content_path, content_len);
+    h = page_index_hash(h, &type, sizeof(type));
+    *check = page_index_hash(h, &book, sizeof(book));
+}
+
+// flash 热块缓存中的身份：条目名 + 数据校验（同名条目重写后内容不同，旧块不会被命中）
+static uint32_t hot_id(const cache_item_header_t *hdr) {
+    return page_index_hash(hdr->name, &hdr->data_hash, sizeof(hdr->data_hash));
+}
+
+static int find_entry(uint32_t name, uint32_t check) {
+    for (int i = 0; i < s_cache.count; i++) {
+        if (s_cache.entries[i].name == name && s_cache.entries[i].check == check) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void recount_usage(void) {
+    s_cache.used = 0;
+    for (int i = 0; i < s_cache.count; i++) {
+        s_cache.used += chunk_bytes(s_cache.entries[i].size);
+    }
+}
+
+static bool index_save(void) {
+    FILE *f = fopen(EPUB_CACHE_INDEX_TMP, "wb");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot write index (errno=%d)", errno);
+        return false;
+    }
+    const size_t bytes = (size_t)s_cache.count * sizeof(cache_entry_t);
+    const cache_index_header_t hdr = {
+        .magic = INDEX_MAGIC,
+        .count = (uint32_t)s_cache.count,
+        .seq = s_cache.seq,
+        .entries_hash = page_index_hash(0, s_cache.entries, bytes),
+    };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+              (bytes == 0 || fwrite(s_cache.entries, bytes, 1, f) == 1);
+    ok = fclose(f) == 0 && ok;
+    if (!ok) {
+        remove(EPUB_CACHE_INDEX_TMP);
+        return false;
+    }
+
+    // FAT 的 rename 不能覆盖已有文件：先删旧索引，中途断电时 init 会改用 index.tmp
+    remove(EPUB_CACHE_INDEX_FILE);
+    if (rename(EPUB_CACHE_INDEX_TMP, EPUB_CACHE_INDEX_FILE) != 0) {
+        return false;
+    }
+    s_cache.dirty = false;
+    return true;
+}
+
+static bool index_load(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    cache_index_header_t hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == INDEX_MAGIC &&
+              hdr.count <= EPUB_CACHE_MAX_ITEMS;
+    const size_t bytes = ok ? hdr.count * sizeof(cache_entry_t) : 0;
+    ok = ok && (bytes == 0 || fread(s_cache.entries, bytes, 1, f) == 1) &&
+         page_index_hash(0, s_cache.entries, bytes) == hdr.entries_hash;
+    fclose(f);
+
+    if (!ok) {
+        s_cache.count = 0;
+        return false;
+    }
+    s_cache.count = (int)hdr.count;
+    s_cache.seq = hdr.seq;
+    return true;
+}
+
+// 索引不可用时从条目文件头重建，顺带删除写到一半的 .tmp
+static void index_rebuild(void) {
+    s_cache.count = 0;
+    s_cache.seq = 0;
+
+    DIR *dir = opendir(EPUB_CACHE_DIR);
+    if (!dir) {
+        return;
+    }
+    struct dirent *entry;
+    char path[300];
+    while ((entry = readdir(dir)) != NULL) {
+        const char *dot = strrchr(entry->d_name, '.');
+        if (!dot) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", EPUB_CACHE_DIR, entry->d_name);
+        if (strcmp(dot, ".tmp") == 0) {
+            remove(path);
+            continue;
+        }
+        if (strcmp(dot, ".ec") != 0) {
+            continue;
+        }
+
+        cache_item_header_t hdr;
+        FILE *f = fopen(path, "rb");
+        const bool ok = f && fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == ITEM_MAGIC;
+        if (f) {
+            fclose(f);
+        }
+        if (!ok || s_cache.count >= EPUB_CACHE_MAX_ITEMS) {
+            remove(path);
+            continue;
+        }
+        cache_entry_t *e = &s_cache.entries[s_cache.count++];
+        e->name = hdr.name;
+        e->check = hdr.check;
+        e->size = hdr.size;
+        e->stamp = 0;
+    }
+    closedir(dir);
+    ESP_LOGW(TAG, "Rebuilt index from %d items", s_cache.count);
+}
+
+bool epub_cache_init(void) {
+    if (s_cache.ready) {
+        return true;
+    }
+
+    mkdir(PAGE_INDEX_DIR, 0775);
+    mkdir(EPUB_CACHE_DIR, 0775);
+
+    if (!index_load(EPUB_CACHE_INDEX_FILE)) {
+        if (index_load(EPUB_CACHE_INDEX_TMP)) {
+            ESP_LOGW(TAG, "Recovered index from %s", EPUB_CACHE_INDEX_TMP);
+        } else {
+            index_rebuild();
+        }
+        s_cache.dirty = true;
+    }
+    recount_usage();
+    s_cache.ready = true;
+    if (s_cache.dirty) {
+        index_save();
+    }
+
+    ESP_LOGI(TAG, "%d items, %u / %u bytes", s_cache.count, (unsigned)s_cache.used,
+             (unsigned)EPUB_CACHE_MAX_SIZE);
+    return true;
+}
+
+static void remove_entry(int index) {
+    char path[64];
+    item_path(s_cache.entries[index].name, "ec", path, sizeof(path));
+    remove(path);
+    s_cache.used -= chunk_bytes(s_cache.entries[index].size);
+    s_cache.entries[index] = s_cache.entries[--s_cache.count];
+    s_cache.dirty = true;
+}
+
+bool epub_cache_exists(const epub_cache_key_t *key) {
+    if (!key || !epub_cache_init()) {
+        return false;
+    }
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    return find_entry(name, check) >= 0;
+}
+
+long epub_cache_item_size(const epub_cache_key_t *key) {
+    if (!key || !epub_cache_init()) {
+        return -1;
+    }
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    const int i = find_entry(name, check);
+    return i >= 0 ? (long)s_cache.entries[i].size : -1;
+}
+
+int epub_cache_read(const epub_cache_key_t *key, void *buffer, size_t buffer_size) {
+    if (!key || !buffer || !epub_cache_init()) {
+        return -1;
+    }
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    const int i = find_entry(name, check);
+    if (i < 0 || s_cache.entries[i].size > buffer_size) {
+        return -1;
+    }
+
+    char path[64];
+    item_path(name, "ec", path, sizeof(path));
+    FILE *f = fopen(path, "rb");
+    cache_item_header_t hdr;
+    bool ok = f && fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == ITEM_MAGIC &&
+              hdr.name == name && hdr.check == check && hdr.size == s_cache.entries[i].size &&
+              flash_cache_read(hot_id(&hdr), f, sizeof(hdr), hdr.size, 0, buffer, hdr.size) &&
+              page_index_hash(0, buffer, hdr.size) == hdr.data_hash;
+    if (f) {
+        fclose(f);
+    }
+    if (!ok) {
+        ESP_LOGW(TAG, "Dropping damaged item %08x", (unsigned)name);
+        remove_entry(i);
+        return -1;
+    }
+
+    s_cache.entries[i].stamp = ++s_cache.seq;
+    s_cache.dirty = true;
+    return (int)hdr.size;
+}
+
+bool epub_cache_read_at(const epub_cache_key_t *key, size_t offset, void *buffer, size_t len) {
+    if (!key || (!buffer && len > 0) || !epub_cache_init()) {
+        return false;
+    }
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    const int i = find_entry(name, check);
+    if (i < 0 || offset > s_cache.entries[i].size || len > s_cache.entries[i].size - offset) {
+        return false;
+    }
+
+    char path[64];
+    item_path(name, "ec", path, sizeof(path));
+    FILE *f = fopen(path, "rb");
+    cache_item_header_t hdr;
+    const bool header_ok = f && fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == ITEM_MAGIC &&
+                           hdr.name == name && hdr.check == check &&
+                           hdr.size == s_cache.entries[i].size;
+    const bool ok = header_ok &&
+                    flash_cache_read(hot_id(&hdr), f, sizeof(hdr), hdr.size, (uint32_t)offset,
+                                     buffer, len);
+    if (f) {
+        fclose(f);
+    }
+    if (!header_ok) {
+        ESP_LOGW(TAG, "Dropping damaged item %08x", (unsigned)name);
+        remove_entry(i);
+    }
+    if (!ok) {
+        return false;
+    }
+
+    s_cache.entries[i].stamp = ++s_cache.seq;
+    s_cache.dirty = true;
+    return true;
+}
+
+// LRU 淘汰直到再放得下 need 字节
+static void evict_for(size_t need) {
+    while (s_cache.count > 0 &&
+           (s_cache.used + need > EPUB_CACHE_MAX_SIZE || s_cache.count >= EPUB_CACHE_MAX_ITEMS)) {
+        int oldest = 0;
+        for (int i = 1; i < s_cache.count; i++) {
+            if (s_cache.entries[i].stamp < s_cache.entries[oldest].stamp) {
+                oldest = i;
+            }
+        }
+        ESP_LOGI(TAG, "Evicting %08x (%u bytes)", (unsigned)s_cache.entries[oldest].name,
+                 (unsigned)s_cache.entries[oldest].size);
+        remove_entry(oldest);
+    }
+}
+
+// 写好的 .tmp 改名为条目并登记：同名旧条目先删除，空间不够时按 LRU 淘汰
+static bool install_item(uint32_t name, uint32_t check, uint32_t size) {
+    char tmp[64];
+    char path[64];
+    item_path(name, "tmp", tmp, sizeof(tmp));
+    item_path(name, "ec", path, sizeof(path));
+
+    const int old = find_entry(name, check);
+    if (old >= 0) {
+        remove_entry(old);
+    }
+    const size_t need = chunk_bytes(size);
+    evict_for(need);
+    remove(path);
+    if (rename(tmp, path) != 0) {
+        ESP_LOGW(TAG, "Failed to write item %08x", (unsigned)name);
+        remove(tmp);
+        index_save();
+        return false;
+    }
+
+    cache_entry_t *e = &s_cache.entries[s_cache.count++];
+    e->name = name;
+    e->check = check;
+    e->size = size;
+    e->stamp = ++s_cache.seq;
+    s_cache.used += need;
+    index_save();
+    return true;
+}
+
+bool epub_cache_write(const epub_cache_key_t *key, const void *data, size_t data_size) {
+    if (!key || (!data && data_size > 0) || !epub_cache_init()) {
+        return false;
+    }
+    if (chunk_bytes(data_size) > EPUB_CACHE_MAX_SIZE) {
+        return false;
+    }
+
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    char tmp[64];
+    item_path(name, "tmp", tmp, sizeof(tmp));
+
+    const cache_item_header_t hdr = {
+        .magic = ITEM_MAGIC,
+        .name = name,
+        .check = check,
+        .size = (uint32_t)data_size,
+        .data_hash = page_index_hash(0, data, data_size),
+        .type = (uint8_t)key->type,
+    };
+    FILE *f = fopen(tmp, "wb");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d)", tmp, errno);
+        return false;
+    }
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t done = 0; ok && done < data_size; done += EPUB_CACHE_CHUNK_SIZE) {
+        const size_t n = data_size - done < EPUB_CACHE_CHUNK_SIZE ? data_size - done
+                                                                  : EPUB_CACHE_CHUNK_SIZE;
+        ok = fwrite(p + done, 1, n, f) == n;
+    }
+    ok = fclose(f) == 0 && ok;
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write item %08x", (unsigned)name);
+        remove(tmp);
+        return false;
+    }
+    return install_item(name, check, (uint32_t)data_size);
+}
+
+// 把缓冲区中攒满的数据追加到 .tmp（每次打开再关闭，写入期间不占文件句柄）
+static bool writer_flush(epub_cache_writer_t *w) {
+    if (w->failed || w->fill == 0) {
+        return !w->failed;
+    }
+    char tmp[64];
+    item_path(w->name, "tmp", tmp, sizeof(tmp));
+    FILE *f = fopen(tmp, "ab");
+    bool ok = f != NULL && fwrite(w->buf, 1, w->fill, f) == w->fill;
+    if (f != NULL) {
+        ok = fclose(f) == 0 && ok;
+    }
+    w->hash = page_index_hash(w->hash, w->buf, w->fill);
+    w->fill = 0;
+    w->failed = !ok;
+    return ok;
+}
+
+bool epub_cache_writer_begin(epub_cache_writer_t *w, const epub_cache_key_t *key) {
+    if (!w || !key) {
+        return false;
+    }
+    memset(w, 0, sizeof(*w));
+    w->failed = true;
+    if (!epub_cache_init()) {
+        return false;
+    }
+    key_hashes(key, &w->name, &w->check);
+    w->type = (uint8_t)key->type;
+
+    // 文件头先占位，提交时写入大小与校验
+    char tmp[64];
+    item_path(w->name, "tmp", tmp, sizeof(tmp));
+    const cache_item_header_t hdr = {0};
+    FILE *f = fopen(tmp, "wb");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d)", tmp, errno);
+        return false;
+    }
+    const bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    if (fclose(f) != 0 || !ok) {
+        remove(tmp);
+        return false;
+    }
+    w->failed = false;
+    return true;
+}
+
+bool epub_cache_writer_append(epub_cache_writer_t *w, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len > 0 && !w->failed) {
+        size_t n = sizeof(w->buf) - w->fill;
+        if (n > len) {
+            n = len;
+        }
+        if (chunk_bytes(w->size + n) > EPUB_CACHE_MAX_SIZE) {
+            w->failed = true;  // 超出整个缓存预算，提交时放弃
+            break;
+        }
+        memcpy(w->buf + w->fill, p, n);
+        w->fill += (uint16_t)n;
+        w->size += (uint32_t)n;
+        p += n;
+        len -= n;
+        if (w->fill == sizeof(w->buf)) {
+            writer_flush(w);
+        }
+    }
+    return !w->failed;
+}
+
+bool epub_cache_writer_commit(epub_cache_writer_t *w) {
+    char tmp[64];
+    item_path(w->name, "tmp", tmp, sizeof(tmp));
+    if (!writer_flush(w)) {
+        remove(tmp);
+        return false;
+    }
+    const cache_item_header_t hdr = {
+        .magic = ITEM_MAGIC,
+        .name = w->name,
+        .check = w->check,
+        .size = w->size,
+        .data_hash = w->size > 0 ? w->hash : page_index_hash(0, NULL, 0),
+        .type = w->type,
+    };
+    FILE *f = fopen(tmp, "r+b");
+    bool ok = f != NULL && fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    if (f != NULL) {
+        ok = fclose(f) == 0 && ok;
+    }
+    w->failed = true;
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write item %08x", (unsigned)w->name);
+        remove(tmp);
+        return false;
+    }
+    return install_item(w->name, w->check, w->size);
+}
+
+void epub_cache_writer_abort(epub_cache_writer_t *w) {
+    if (w == NULL || w->name == 0) {
+        return;
+    }
+    char tmp[64];
+    item_path(w->name, "tmp", tmp, sizeof(tmp));
+    remove(tmp);
+    w->failed = true;
+    w->name = 0;
+}
+
+bool epub_cache_delete(const epub_cache_key_t *key) {
+    if (!key || !epub_cache_init()) {
+        return false;
+    }
+    uint32_t name, check;
+    key_hashes(key, &name, &check);
+    const int i = find_entry(name, check);
+    if (i < 0) {
+        return false;
+    }
+    remove_entry(i);
+    return index_save();
+}
+
+bool epub_cache_clear(void) {
+    if (!epub_cache_init()) {
+        return false;
+    }
+    while (s_cache.count > 0) {
+        remove_entry(s_cache.count - 1);
+    }
+    s_cache.seq = 0;
+    return index_save();
+}
+
+bool epub_cache_flush(void) {
+    return !s_cache.ready || !s_cache.dirty || index_save();
+}
+
+bool epub_cache_get_usage(size_t *used, size_t *total) {
+    if (!epub_cache_init()) {
+        return false;
+    }
+    if (used) {
+        *used = s_cache.used;
+    }
+    if (total) {
+        *total = EPUB_CACHE_MAX_SIZE;
+    }
+    return true;
+}
+
+bool epub_cache_precache_chapter(const char *epub_path,
+                                  const char *chapter_path,
+                                  const void *data,
+                                  size_t data_size) {
+    if (!epub_path || !chapter_path) {
+        return false;
+    }
+    epub_cache_key_t key;
+    memset(&key, 0, sizeof(key));
+    strncpy(key.epub_path, epub_path, sizeof(key.epub_path) - 1);
+    strncpy(key.content_path, chapter_path, sizeof(key.content_path) - 1);
+    key.type = EPUB_CACHE_CHAPTER;
+    return epub_cache_write(&key, data, data_size);
+}
@@ -1,9 +1,12 @@
 /**
  * @file epub_cache.h
- * @brief EPUB Flash 缓存管理器
+ * @brief EPUB 缓存管理器
  *
- * 使用 Flash 作为二级缓存，减少 SD 卡访问
- * 架构: RAM → Flash → SD 卡
+ * 保存解压后的章节、书籍元数据与章节表、索引等，重新打开书籍或切换章节时
+ * 不必再读 ZIP、解压和解析。缓存放在 SD 卡的 /sdcard/.x4cache/epub/
+ * （LittleFS 分区只有 192KB，容纳不下 2MB 预算），超出预算时按 LRU 淘汰。
+ * 常读的块再由 flash_cache 提升到 LittleFS 分区（见 flash_cache.h）。
+ * 只能在同一任务中调用（与阅读器一样在 LVGL 任务中）
  */
 
 #ifndef EPUB_CACHE_H
@@ -18,8 +21,8 @@ extern "C" {
 #endif
 
 // 缓存配置
-#define EPUB_CACHE_MAX_SIZE   (2 * 1024 * 1024)  // 2MB Flash 缓存
-#define EPUB_CACHE_CHUNK_SIZE 4096                 // 每块 4KB
+#define EPUB_CACHE_MAX_SIZE   (2 * 1024 * 1024)  // 2MB 缓存预算
+#define EPUB_CACHE_CHUNK_SIZE 4096                 // 每块 4KB（占用按块取整）
 
 // 缓存项类型
 typedef enum {
@@ -27,6 +30,8 @@ typedef enum {
     EPUB_CACHE_METADATA,     // 元数据
     EPUB_CACHE_IMAGE,        // 图片
     EPUB_CACHE_INDEX,        // 章节索引
+    EPUB_CACHE_BLOCKS,       // 章节文本块（解析后的段落记录）
+    EPUB_CACHE_TOC,          // 目录偏移表（按需分段读取）
 } epub_cache_type_t;
 
 // 缓存键
@@ -37,7 +42,7 @@ typedef struct {
 } epub_cache_key_t;
 
 /**
- * @brief 初始化 Flash 缓存
+ * @brief 初始化缓存（加载索引；其他接口会自动调用）
  * @return true 成功，false 失败
  */
 bool epub_cache_init(void);
@@ -50,14 +55,31 @@ bool epub_cache_init(void);
 bool epub_cache_exists(const epub_cache_key_t *key);
 
 /**
- * @brief 从缓存读取数据
+ * @brief 获取缓存项的数据大小
+ * @param key 缓存键
+ * @return 字节数，不存在返回 -1
+ */
+long epub_cache_item_size(const epub_cache_key_t *key);
+
+/**
+ * @brief 从缓存读取数据（校验失败的项会被删除）
  * @param key 缓存键
  * @param buffer 输出缓冲区
- * @param buffer_size 缓冲区大小
+ * @param buffer_size 缓冲区大小（小于数据大小时失败）
  * @return 实际读取的字节数，失败返回 -1
  */
 int epub_cache_read(const epub_cache_key_t *key, void *buffer, size_t buffer_size);
 
+/**
+ * @brief 读取缓存项中的一段（只校验文件头，数据由调用者校验；用于不整体载入内存的表）
+ * @param key 缓存键
+ * @param offset 数据内偏移
+ * @param buffer 输出缓冲区
+ * @param len 读取字节数（超出数据末尾时失败）
+ * @return true 成功，false 失败
+ */
+bool epub_cache_read_at(const epub_cache_key_t *key, size_t offset, void *buffer, size_t len);
+
 /**
  * @brief 写入数据到缓存
  * @param key 缓存键
@@ -67,6 +89,48 @@ int epub_cache_read(const epub_cache_key_t *key, void *buffer, size_t buffer_siz
  */
 bool epub_cache_write(const epub_cache_key_t *key, const void *data, size_t data_size);
 
+// 流式写入状态（数据边产生边写入，不必整块放在内存中；字段仅供 epub_cache.c 使用）
+typedef struct {
+    uint32_t name;
+    uint32_t check;
+    uint32_t size;           // 已追加的数据字节
+    uint32_t hash;           // 已写入部分的校验
+    uint8_t type;
+    bool failed;
+    uint16_t fill;           // buf 中尚未写入的字节
+    uint8_t buf[EPUB_CACHE_CHUNK_SIZE];
+} epub_cache_writer_t;
+
+/**
+ * @brief 开始流式写入一个缓存项（数据先写到 .tmp，提交前读不到）
+ * @param w 写入状态
+ * @param key 缓存键
+ * @return true 成功，false 失败（之后的调用都会失败，仍可调用 abort）
+ */
+bool epub_cache_writer_begin(epub_cache_writer_t *w, const epub_cache_key_t *key);
+
+/**
+ * @brief 追加数据（攒满 EPUB_CACHE_CHUNK_SIZE 写一次）
+ * @param w 写入状态
+ * @param data 数据
+ * @param len 字节数
+ * @return true 成功，false 写入失败或超出缓存预算
+ */
+bool epub_cache_writer_append(epub_cache_writer_t *w, const void *data, size_t len);
+
+/**
+ * @brief 提交：补写文件头并登记为缓存项（同名旧项被替换，空间不够时按 LRU 淘汰）
+ * @param w 写入状态
+ * @return true 成功，false 失败（.tmp 已删除）
+ */
+bool epub_cache_writer_commit(epub_cache_writer_t *w);
+
+/**
+ * @brief 放弃写入，删除 .tmp（未开始或已提交时不做任何事）
+ * @param w 写入状态
+ */
+void epub_cache_writer_abort(epub_cache_writer_t *w);
+
 /**
  * @brief 删除缓存项
  * @param key 缓存键
@@ -80,6 +144,12 @@ bool epub_cache_delete(const epub_cache_key_t *key);
  */
 bool epub_cache_clear(void);
 
+/**
+ * @brief 保存读取时更新的 LRU 顺序（写入与删除会立即保存）
+ * @return true 成功，false 失败
+ */
+bool epub_cache_flush(void);
+
 /**
  * @brief 获取缓存使用情况
  * @param used 输出已使用字节数
@@ -89,7 +159,7 @@ bool epub_cache_clear(void);
 bool epub_cache_get_usage(size_t *used, size_t *total);
 
 /**
- * @brief 预缓存整个章节到 Flash
+ * @brief 预缓存整个章节
  * @param epub_path EPUB 文件路径
  * @param chapter_path 章节在 EPUB 中的路径
  * @param data 章节数据
@@ -0,0 +1,657 @@
+/**
+ * @file epub_css.c
+ * @brief EPUB 样式表子集实现 - 流式切分规则、编译选择器、按特异性层叠
+ */
+
+#include "epub_css.h"
+#include "epub_html.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "EPUB_CSS";
+
+#define CSS_MAX_SPECIFICITY 255
+
+typedef enum {
+    CSS_PRELUDE,    // 选择器或 @ 规则的前导部分
+    CSS_BLOCK,      // 声明块
+    CSS_AT_BLOCK,   // 跳过的 @ 规则块（可嵌套）
+} css_state_t;
+
+// 解析状态，只在送入样式表期间存在
+typedef struct {
+    uint8_t state;
+    bool in_comment;
+    bool overflow;          // 当前规则超长，整条丢弃
+    char prev;              // 上一个字符（识别注释的起止）
+    char quote;             // 字符串内时为引号字符
+    uint16_t at_depth;
+    uint16_t order;         // 已见规则数（层叠顺序）
+    uint16_t dropped;       // 超出规则表上限而丢弃的规则数
+    size_t sel_len;         // 声明块内：text[0, sel_len) 为选择器
+    size_t len;
+    char text[EPUB_CSS_RULE_TEXT_MAX];
+} css_builder_t;
+
+struct epub_css {
+    epub_css_rule_t *rules;
+    uint16_t count;
+    uint16_t capacity;
+    css_builder_t *builder;
+};
+
+// ---------------------------------------------------------------------------
+// 工具
+// ---------------------------------------------------------------------------
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+// 标签名不分大小写，类名区分；0 留给“不限”
+static uint32_t hash_name(const char *s, size_t len, bool fold) {
+    uint32_t h = FNV_OFFSET;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (fold && c >= 'A' && c <= 'Z') {
+            c = (unsigned char)(c - 'A' + 'a');
+        }
+        h = (h ^ c) * FNV_PRIME;
+    }
+    return h ? h : 1;
+}
+
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+static bool is_ident(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '-' || c == '_' || (unsigned char)c >= 0x80;
+}
+
+static void trim(const char **start, const char **end) {
+    while (*start < *end && is_space(**start)) {
+        (*start)++;
+    }
+    while (*end > *start && is_space((*end)[-1])) {
+        (*end)--;
+    }
+}
+
+static bool value_is(const char *value, size_t len, const char *word) {
+    return strlen(word) == len && strncasecmp(value, word, len) == 0;
+}
+
+// ---------------------------------------------------------------------------
+// 声明
+// ---------------------------------------------------------------------------
+
+bool epub_css_parse_align(const char *value, size_t len, uint8_t *align) {
+    static const struct { const char *name; epub_align_t align; } aligns[] = {
+        {"left", EPUB_ALIGN_LEFT}, {"start", EPUB_ALIGN_LEFT}, {"center", EPUB_ALIGN_CENTER},
+        {"right", EPUB_ALIGN_RIGHT}, {"end", EPUB_ALIGN_RIGHT}, {"justify", EPUB_ALIGN_JUSTIFY},
+    };
+    for (size_t i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+        if (value_is(value, len, aligns[i].name)) {
+            *align = (uint8_t)aligns[i].align;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 长度换算成 1/2 em（按 16px = 12pt = 1em），百分比、auto 等无法换算的值忽略
+static bool parse_length(const char *value, size_t len, int8_t *half_em_out) {
+    char number_text[16];
+    if (len == 0 || len >= sizeof(number_text)) {
+        return false;
+    }
+    memcpy(number_text, value, len);   // 值不一定以 NUL 结尾，strtof 不能越过 len
+    number_text[len] = '\0';
+
+    char *end;
+    const float number = strtof(number_text, &end);
+    if (end == number_text) {
+        return false;
+    }
+    const size_t unit_len = (size_t)(number_text + len - end);
+    float half_em;
+    if (number == 0.0f) {
+        half_em = 0.0f;
+    } else if (unit_len == 2 && (strncasecmp(end, "em", 2) == 0 || strncasecmp(end, "ch", 2) == 0)) {
+        half_em = number * 2.0f;
+    } else if (unit_len == 3 && strncasecmp(end, "rem", 3) == 0) {
+        half_em = number * 2.0f;
+    } else if (unit_len == 2 && strncasecmp(end, "px", 2) == 0) {
+        half_em = number / 8.0f;
+    } else if (unit_len == 2 && strncasecmp(end, "pt", 2) == 0) {
+        half_em = number / 6.0f;
+    } else {
+        return false;
+    }
+    if (half_em > 127.0f) half_em = 127.0f;
+    if (half_em < -127.0f) half_em = -127.0f;
+    *half_em_out = (int8_t)(half_em < 0 ? half_em - 0.5f : half_em + 0.5f);
+    return true;
+}
+
+static void set_margin(epub_css_style_t *out, const char *value, size_t len) {
+    int8_t half_em;
+    if (parse_length(value, len, &half_em)) {
+        out->margin = half_em > 0 ? (uint8_t)(half_em / 4) : 0;
+        out->set |= EPUB_CSS_HAS_MARGIN;
+    }
+}
+
+// margin 简写：1-4 个值，左边距依次是第 1、2、2、4 个
+static void set_margin_shorthand(epub_css_style_t *out, const char *value, const char *end) {
+    const char *parts[4];
+    size_t lens[4];
+    int n = 0;
+    while (value < end) {
+        while (value < end && is_space(*value)) value++;
+        const char *start = value;
+        while (value < end && !is_space(*value)) value++;
+        if (value > start) {
+            if (n == 4) {
+                return;
+            }
+            parts[n] = start;
+            lens[n] = (size_t)(value - start);
+            n++;
+        }
+    }
+    if (n > 0) {
+        const int left = n == 1 ? 0 : n == 4 ? 3 : 1;
+        set_margin(out, parts[left], lens[left]);
+    }
+}
+
+static void set_style_bit(epub_css_style_t *out, uint8_t has, uint8_t bit, bool on) {
+    out->set |= has;
+    out->style = on ? (uint8_t)(out->style | bit) : (uint8_t)(out->style & ~bit);
+}
+
+static void apply_declaration(epub_css_style_t *out, const char *name, size_t name_len,
+                              const char *value, const char *value_end) {
+    const char *bang = memchr(value, '!', (size_t)(value_end - value));
+    if (bang) {
+        value_end = bang;   // !important 按普通声明处理
+        trim(&value, &value_end);
+    }
+    const size_t len = (size_t)(value_end - value);
+
+    if (value_is(name, name_len, "font-weight")) {
+        if (value_is(value, len, "bold") || value_is(value, len, "bolder")) {
+            set_style_bit(out, EPUB_CSS_HAS_WEIGHT, EPUB_STYLE_BOLD, true);
+        } else if (value_is(value, len, "normal") || value_is(value, len, "lighter")) {
+            set_style_bit(out, EPUB_CSS_HAS_WEIGHT, EPUB_STYLE_BOLD, false);
+        } else if (len == 3 && value[0] >= '1' && value[0] <= '9' && value[1] == '0' && value[2] == '0') {
+            set_style_bit(out, EPUB_CSS_HAS_WEIGHT, EPUB_STYLE_BOLD, value[0] >= '6');
+        }
+    } else if (value_is(name, name_len, "font-style")) {
+        if (value_is(value, len, "italic") || value_is(value, len, "oblique")) {
+            set_style_bit(out, EPUB_CSS_HAS_SLANT, EPUB_STYLE_ITALIC, true);
+        } else if (value_is(value, len, "normal")) {
+            set_style_bit(out, EPUB_CSS_HAS_SLANT, EPUB_STYLE_ITALIC, false);
+        }
+    } else if (value_is(name, name_len, "text-align")) {
+        if (epub_css_parse_align(value, len, &out->align)) {
+            out->set |= EPUB_CSS_HAS_ALIGN;
+        }
+    } else if (value_is(name, name_len, "text-indent")) {
+        if (parse_length(value, len, &out->indent)) {
+            out->set |= EPUB_CSS_HAS_INDENT;
+        }
+    } else if (value_is(name, name_len, "margin-left")) {
+        set_margin(out, value, len);
+    } else if (value_is(name, name_len, "margin")) {
+        set_margin_shorthand(out, value, value_end);
+    } else if (value_is(name, name_len, "display")) {
+        out->hidden = value_is(value, len, "none");
+        out->set |= EPUB_CSS_HAS_DISPLAY;
+    }
+}
+
+void epub_css_parse_declarations(const char *text, size_t len, epub_css_style_t *out) {
+    const char *end = text + len;
+    while (text < end) {
+        const char *decl_end = memchr(text, ';', (size_t)(end - text));
+        if (!decl_end) {
+            decl_end = end;
+        }
+        const char *colon = memchr(text, ':', (size_t)(decl_end - text));
+        if (colon) {
+            const char *name = text, *name_end = colon;
+            const char *value = colon + 1, *value_end = decl_end;
+            trim(&name, &name_end);
+            trim(&value, &value_end);
+            apply_declaration(out, name, (size_t)(name_end - name), value, value_end);
+        }
+        text = decl_end < end ? decl_end + 1 : end;
+    }
+}
+
+void epub_css_merge(epub_css_style_t *dst, const epub_css_style_t *src) {
+    if (src->set & EPUB_CSS_HAS_WEIGHT) {
+        dst->style = (uint8_t)((dst->style & ~EPUB_STYLE_BOLD) | (src->style & EPUB_STYLE_BOLD));
+    }
+    if (src->set & EPUB_CSS_HAS_SLANT) {
+        dst->style = (uint8_t)((dst->style & ~EPUB_STYLE_ITALIC) | (src->style & EPUB_STYLE_ITALIC));
+    }
+    if (src->set & EPUB_CSS_HAS_ALIGN) dst->align = src->align;
+    if (src->set & EPUB_CSS_HAS_INDENT) dst->indent = src->indent;
+    if (src->set & EPUB_CSS_HAS_MARGIN) dst->margin = src->margin;
+    if (src->set & EPUB_CSS_HAS_DISPLAY) dst->hidden = src->hidden;
+    dst->set |= src->set;
+}
+
+// ---------------------------------------------------------------------------
+// 选择器
+// ---------------------------------------------------------------------------
+
+// 编译一个选择器（逗号之间的一段），不支持的写法返回 false
+static bool parse_selector(const char *s, const char *end, epub_css_rule_t *rule) {
+    epub_css_compound_t compounds[EPUB_CSS_MAX_COMPOUNDS];
+    int n = 0;
+    int specificity = 0;
+
+    while (s < end) {
+        while (s < end && (is_space(*s) || *s == '>')) {
+            s++;   // 子选择器按后代处理
+        }
+        if (s == end) {
+            break;
+        }
+
+        epub_css_compound_t c = {0, 0};
+        bool universal = false;
+        if (*s == '*') {
+            universal = true;
+            s++;
+        } else if (is_ident(*s)) {
+            const char *start = s;
+            while (s < end && is_ident(*s)) s++;
+            c.tag = hash_name(start, (size_t)(s - start), true);
+            specificity += 1;
+        }
+        while (s < end && *s == '.') {
+            const char *start = ++s;
+            while (s < end && is_ident(*s)) s++;
+            if (s == start || c.cls != 0) {
+                return false;   // 空类名或一级里有多个类名
+            }
+            c.cls = hash_name(start, (size_t)(s - start), false);
+            specificity += 16;
+        }
+        if ((s < end && !is_space(*s) && *s != '>') || (!universal && c.tag == 0 && c.cls == 0)) {
+            return false;       // #id、[attr]、:pseudo、+、~ 等
+        }
+        if (n == EPUB_CSS_MAX_COMPOUNDS) {
+            return false;
+        }
+        compounds[n++] = c;
+    }
+    if (n == 0) {
+        return false;
+    }
+
+    memset(rule, 0, sizeof(*rule));
+    for (int i = 0; i < n; i++) {
+        rule->sel[i] = compounds[n - 1 - i];
+    }
+    rule->compounds = (uint8_t)n;
+    rule->specificity = (uint8_t)(specificity < CSS_MAX_SPECIFICITY ? specificity : CSS_MAX_SPECIFICITY);
+    return true;
+}
+
+static bool add_rule(epub_css_t *css, const epub_css_rule_t *rule) {
+    if (css->count >= EPUB_CSS_MAX_RULES) {
+        css->builder->dropped++;
+        return true;
+    }
+    if (css->count == css->capacity) {
+        const uint16_t capacity = css->capacity ? (uint16_t)(css->capacity * 2) : 16;
+        epub_css_rule_t *grown = realloc(css->rules, (size_t)capacity * sizeof(epub_css_rule_t));
+        if (!grown) {
+            return false;
+        }
+        css->rules = grown;
+        css->capacity = capacity;
+    }
+    css->rules[css->count++] = *rule;
+    return true;
+}
+
+static bool compile_rule(epub_css_t *css) {
+    css_builder_t *b = css->builder;
+    if (b->overflow) {
+        return true;
+    }
+
+    epub_css_style_t style = {0};
+    epub_css_parse_declarations(b->text + b->sel_len, b->len - b->sel_len, &style);
+    if (style.set == 0) {
+        return true;
+    }
+
+    const uint16_t order = b->order < UINT16_MAX ? b->order++ : b->order;
+    const char *s = b->text;
+    const char *end = b->text + b->sel_len;
+    while (s < end) {
+        const char *comma = memchr(s, ',', (size_t)(end - s));
+        const char *part_end = comma ? comma : end;
+        const char *start = s, *stop = part_end;
+        trim(&start, &stop);
+        epub_css_rule_t rule;
+        if (parse_selector(start, stop, &rule)) {
+            rule.order = order;
+            rule.style = style;
+            if (!add_rule(css, &rule)) {
+                return false;
+            }
+        }
+        s = comma ? comma + 1 : end;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 流式切分
+// ---------------------------------------------------------------------------
+
+static void reset_rule(css_builder_t *b) {
+    b->len = 0;
+    b->sel_len = 0;
+    b->overflow = false;
+}
+
+static void put(css_builder_t *b, char c) {
+    if (b->len + 1 >= sizeof(b->text)) {
+        b->overflow = true;
+        return;
+    }
+    b->text[b->len++] = c;
+}
+
+static bool prelude_is_at_rule(const css_builder_t *b) {
+    for (size_t i = 0; i < b->len; i++) {
+        if (!is_space(b->text[i])) {
+            return b->text[i] == '@';
+        }
+    }
+    return false;
+}
+
+epub_css_t *epub_css_create(void) {
+    epub_css_t *css = calloc(1, sizeof(epub_css_t));
+    if (!css) {
+        return NULL;
+    }
+    css->builder = calloc(1, sizeof(css_builder_t));
+    if (!css->builder) {
+        free(css);
+        return NULL;
+    }
+    return css;
+}
+
+bool epub_css_feed(epub_css_t *css, const char *data, size_t len) {
+    if (!css || !css->builder) {
+        return false;
+    }
+    css_builder_t *b = css->builder;
+
+    for (size_t i = 0; i < len; i++) {
+        const char c = data[i];
+        const char prev = b->prev;
+        b->prev = c;
+
+        if (b->in_comment) {
+            if (prev == '*' && c == '/') {
+                b->in_comment = false;
+                b->prev = '\0';   // "/*/" 里的 / 不能再当作注释结束
+            }
+            continue;
+        }
+        if (prev == '/' && c == '*' && !b->quote) {
+            b->in_comment = true;
+            b->prev = '\0';
+            if (b->state != CSS_AT_BLOCK && b->len > 0 && !b->overflow) {
+                b->len--;         // 撤回已写入的 /
+            }
+            continue;
+        }
+
+        if (b->state == CSS_AT_BLOCK) {
+            if (c == '{') {
+                b->at_depth++;
+            } else if (c == '}' && --b->at_depth == 0) {
+                b->state = CSS_PRELUDE;
+                reset_rule(b);
+            }
+            continue;
+        }
+
+        if (b->quote) {
+            put(b, c);
+            if (c == b->quote && prev != '\\') {
+                b->quote = '\0';
+            }
+            continue;
+        }
+        if (c == '"' || c == '\'') {
+            b->quote = c;
+            put(b, c);
+            continue;
+        }
+
+        if (b->state == CSS_PRELUDE) {
+            if (c == '{') {
+                if (prelude_is_at_rule(b)) {
+                    b->state = CSS_AT_BLOCK;   // @media、@font-face 等整块跳过
+                    b->at_depth = 1;
+                } else {
+                    b->state = CSS_BLOCK;
+                    b->sel_len = b->len;
+                }
+            } else if (c == ';' || c == '}') {
+                reset_rule(b);                  // @import、@charset 或多余的 }
+            } else {
+                put(b, c);
+            }
+        } else {
+            if (c == '{') {
+                b->state = CSS_AT_BLOCK;        // 声明块里嵌套块：连同本规则一起跳过
+                b->at_depth = 2;
+            } else if (c == '}') {
+                const bool ok = compile_rule(css);
+                b->state = CSS_PRELUDE;
+                reset_rule(b);
+                if (!ok) {
+                    ESP_LOGW(TAG, "Out of memory at %u rules", css->count);
+                    return false;
+                }
+            } else {
+                put(b, c);
+            }
+        }
+    }
+    return true;
+}
+
+void epub_css_end_sheet(epub_css_t *css) {
+    if (!css || !css->builder) {
+        return;
+    }
+    css_builder_t *b = css->builder;
+    b->state = CSS_PRELUDE;
+    b->in_comment = false;
+    b->quote = '\0';
+    b->prev = '\0';
+    b->at_depth = 0;
+    reset_rule(b);
+}
+
+static int compare_rules(const void *a, const void *b) {
+    const epub_css_rule_t *ra = a, *rb = b;
+    if (ra->specificity != rb->specificity) {
+        return ra->specificity < rb->specificity ? -1 : 1;
+    }
+    return ra->order < rb->order ? -1 : ra->order > rb->order ? 1 : 0;
+}
+
+void epub_css_finish(epub_css_t *css) {
+    if (!css || !css->builder) {
+        return;
+    }
+    if (css->builder->dropped > 0) {
+        ESP_LOGW(TAG, "Rule table full, %u rules dropped", css->builder->dropped);
+    }
+    free(css->builder);
+    css->builder = NULL;
+
+    // 特异性低的在前，同特异性按出现顺序：计算时依次覆盖即为层叠结果
+    if (css->count > 1) {
+        qsort(css->rules, css->count, sizeof(epub_css_rule_t), compare_rules);
+    }
+    if (css->count < css->capacity && css->count > 0) {
+        epub_css_rule_t *shrunk = realloc(css->rules, (size_t)css->count * sizeof(epub_css_rule_t));
+        if (shrunk) {
+            css->rules = shrunk;
+            css->capacity = css->count;
+        }
+    }
+    ESP_LOGI(TAG, "%u rules (%u bytes)", css->count, (unsigned)(css->count * sizeof(epub_css_rule_t)));
+}
+
+epub_css_t *epub_css_import(const epub_css_rule_t *rules, size_t count) {
+    if (count > EPUB_CSS_MAX_RULES) {
+        return NULL;
+    }
+    epub_css_t *css = calloc(1, sizeof(epub_css_t));
+    if (!css) {
+        return NULL;
+    }
+    if (count > 0) {
+        css->rules = malloc(count * sizeof(epub_css_rule_t));
+        if (!css->rules) {
+            free(css);
+            return NULL;
+        }
+        memcpy(css->rules, rules, count * sizeof(epub_css_rule_t));
+    }
+    css->count = (uint16_t)count;
+    css->capacity = (uint16_t)count;
+    return css;
+}
+
+size_t epub_css_rules(const epub_css_t *css, const epub_css_rule_t **rules) {
+    *rules = css ? css->rules : NULL;
+    return css ? css->count : 0;
+}
+
+void epub_css_destroy(epub_css_t *css) {
+    if (!css) {
+        return;
+    }
+    free(css->builder);
+    free(css->rules);
+    free(css);
+}
+
+// ---------------------------------------------------------------------------
+// 匹配
+// ---------------------------------------------------------------------------
+
+void epub_css_element_init(epub_css_element_t *el, const char *tag, const char *class_attr) {
+    memset(el, 0, sizeof(*el));
+    el->tag = hash_name(tag, strlen(tag), true);
+    el->key = el->tag;
+    if (!class_attr) {
+        return;
+    }
+
+    const char *s = class_attr;
+    while (*s) {
+        while (*s && is_space(*s)) s++;
+        const char *start = s;
+        while (*s && !is_space(*s)) s++;
+        if (s > start && el->class_count < EPUB_CSS_MAX_CLASSES) {
+            el->classes[el->class_count++] = hash_name(start, (size_t)(s - start), false);
+        }
+    }
+    uint32_t key = el->tag;
+    for (const char *c = class_attr; *c; c++) {
+        key = (key ^ (unsigned char)*c) * FNV_PRIME;
+    }
+    el->key = key ? key : 1;
+}
+
+static bool compound_match(const epub_css_compound_t *c, const epub_css_element_t *el) {
+    if (c->tag && c->tag != el->tag) {
+        return false;
+    }
+    if (c->cls) {
+        for (int i = 0; i < el->class_count; i++) {
+            if (el->classes[i] == c->cls) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+
+// 祖先级从内往外逐级找，每级落在比上一级更外层的祖先上
+static bool ancestors_match(const epub_css_rule_t *rule, const epub_css_element_t *ancestors, int count) {
+    int i = count - 1;
+    for (int k = 1; k < rule->compounds; k++) {
+        while (i >= 0 && !compound_match(&rule->sel[k], &ancestors[i])) {
+            i--;
+        }
+        if (i < 0) {
+            return false;
+        }
+        i--;
+    }
+    return true;
+}
+
+void epub_css_compute(const epub_css_t *css, const epub_css_element_t *el,
+                      const epub_css_element_t *ancestors, int ancestor_count,
+                      epub_css_memo_t *memo, epub_css_style_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (!css || css->count == 0) {
+        return;
+    }
+
+    epub_css_memo_slot_t *slot = memo ? &memo->slots[el->key % EPUB_CSS_MEMO_SLOTS] : NULL;
+    if (slot && slot->key == el->key && slot->tag == el->tag) {
+        *out = slot->style;
+        return;
+    }
+
+    bool contextual = false;
+    for (int i = 0; i < css->count; i++) {
+        const epub_css_rule_t *rule = &css->rules[i];
+        if (!compound_match(&rule->sel[0], el)) {
+            continue;
+        }
+        if (rule->compounds > 1) {
+            contextual = true;
+            if (!ancestors || !ancestors_match(rule, ancestors, ancestor_count)) {
+                continue;
+            }
+        }
+        epub_css_merge(out, &rule->style);
+    }
+
+    if (slot && !contextual) {
+        slot->key = el->key;
+        slot->tag = el->tag;
+        slot->style = *out;
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * @file epub_css.h
+ * @brief EPUB 样式表子集 - 每本书解析一次的紧凑规则表 + 按 (标签, class) 记忆的计算样式
+ *
+ * 只支持排版用得到的一小部分：
+ *   选择器：元素（p）、类（.note）、元素加类（p.note）、后代（div.poem p，最多
+ *           EPUB_CSS_MAX_COMPOUNDS 级，子选择器 > 按后代处理），逗号分组；
+ *           含 id、属性、伪类等其它成分的选择器整条丢弃（同组的其它选择器照常生效）
+ *   属性：  font-weight、font-style、text-align、text-indent、margin / margin-left（左缩进）、
+ *           display:none
+ * @ 规则（@media、@font-face 等）连同其块整体跳过。没有声明任何支持属性的规则不进入规则表。
+ *
+ * 样式表按 zip 解压回调分块送入（epub_css_feed），epub_css_finish 后规则按
+ * (特异性, 出现顺序) 排好，规则表只读，多个解析任务可以共用。
+ * 计算结果的记忆表（epub_css_memo_t）由每个 HTML 解析器自己持有：主体匹配某条后代选择器的
+ * 元素结果取决于祖先，不记忆，其余元素同一 (标签, class) 只计算一次
+ */
+
+#ifndef EPUB_CSS_H
+#define EPUB_CSS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EPUB_CSS_MAX_RULES     256  // 规则表上限，超出的规则丢弃
+#define EPUB_CSS_MAX_COMPOUNDS 3    // 后代选择器的最大级数
+#define EPUB_CSS_MAX_CLASSES   4    // 元素 class 属性中参与匹配的类名数
+#define EPUB_CSS_MEMO_SLOTS    32   // 计算样式记忆表的槽数（直接映射）
+#define EPUB_CSS_RULE_TEXT_MAX 1024 // 单条规则（选择器或声明块）的最大长度，超出的规则丢弃
+
+// 计算样式中已指定的属性
+#define EPUB_CSS_HAS_WEIGHT  0x01
+#define EPUB_CSS_HAS_SLANT   0x02
+#define EPUB_CSS_HAS_ALIGN   0x04
+#define EPUB_CSS_HAS_INDENT  0x08
+#define EPUB_CSS_HAS_MARGIN  0x10
+#define EPUB_CSS_HAS_DISPLAY 0x20
+
+// 计算样式（只有 set 中标出的字段有效）
+typedef struct {
+    uint8_t set;      // EPUB_CSS_HAS_*
+    uint8_t style;    // EPUB_STYLE_BOLD / EPUB_STYLE_ITALIC 的取值
+    uint8_t align;    // epub_align_t
+    int8_t indent;    // 首行缩进，单位 1/2 em
+    uint8_t margin;   // 左缩进层级（每 2 em 一级）
+    bool hidden;      // display:none
+} epub_css_style_t;
+
+// 选择器的一级：标签与类名的哈希，0 表示不限
+typedef struct {
+    uint32_t tag;
+    uint32_t cls;
+} epub_css_compound_t;
+
+// 规则：sel[0] 为主体（最右侧），sel[1..] 依次是更外层的祖先
+typedef struct {
+    epub_css_compound_t sel[EPUB_CSS_MAX_COMPOUNDS];
+    uint8_t compounds;
+    uint8_t specificity;   // 类名数 × 16 + 元素数
+    uint16_t order;        // 出现顺序
+    epub_css_style_t style;
+} epub_css_rule_t;
+
+// 参与匹配的元素
+typedef struct {
+    uint32_t tag;
+    uint32_t key;          // 标签与整个 class 属性的组合哈希（记忆表的键）
+    uint32_t classes[EPUB_CSS_MAX_CLASSES];
+    uint8_t class_count;
+} epub_css_element_t;
+
+typedef struct {
+    uint32_t key;          // 0 表示空槽
+    uint32_t tag;
+    epub_css_style_t style;
+} epub_css_memo_slot_t;
+
+typedef struct {
+    epub_css_memo_slot_t slots[EPUB_CSS_MEMO_SLOTS];
+} epub_css_memo_t;
+
+typedef struct epub_css epub_css_t;
+
+/**
+ * @brief 创建空规则表（之后送入样式表文本）
+ */
+epub_css_t *epub_css_create(void);
+
+/**
+ * @brief 送入一段样式表文本（可在任意位置切分，多个样式表依次送入）
+ * @return false 内存不足，已解析的规则仍然有效
+ */
+bool epub_css_feed(epub_css_t *css, const char *data, size_t len);
+
+/**
+ * @brief 一个样式表结束（丢弃未闭合的规则），下一个样式表从头开始解析
+ */
+void epub_css_end_sheet(epub_css_t *css);
+
+/**
+ * @brief 全部送完：释放解析状态，规则排序后只读
+ */
+void epub_css_finish(epub_css_t *css);
+
+/**
+ * @brief 由缓存中的规则数组重建规则表（已排序，复制一份）
+ * @return NULL 内存不足或 count 超出上限
+ */
+epub_css_t *epub_css_import(const epub_css_rule_t *rules, size_t count);
+
+/**
+ * @brief 取出规则数组（用于写缓存）
+ * @return 规则数
+ */
+size_t epub_css_rules(const epub_css_t *css, const epub_css_rule_t **rules);
+
+void epub_css_destroy(epub_css_t *css);
+
+/**
+ * @brief 按标签名与 class 属性准备匹配用的元素
+ */
+void epub_css_element_init(epub_css_element_t *el, const char *tag, const char *class_attr);
+
+/**
+ * @brief 计算元素的样式（只含样式表中的规则，不含继承与行内 style）
+ * @param ancestors 从外到内的祖先元素，可为 NULL
+ * @param memo 调用方的记忆表，可为 NULL
+ */
+void epub_css_compute(const epub_css_t *css, const epub_css_element_t *el,
+                      const epub_css_element_t *ancestors, int ancestor_count,
+                      epub_css_memo_t *memo, epub_css_style_t *out);
+
+/**
+ * @brief 解析声明列表（行内 style 属性或规则的声明块），结果叠加到 out
+ */
+void epub_css_parse_declarations(const char *text, size_t len, epub_css_style_t *out);
+
+/**
+ * @brief 解析 text-align 的取值（也用于 HTML 的 align 属性）
+ * @return false 不认识的取值，align 不变
+ */
+bool epub_css_parse_align(const char *value, size_t len, uint8_t *align);
+
+/**
+ * @brief 把 src 中指定的属性覆盖到 dst
+ */
+void epub_css_merge(epub_css_style_t *dst, const epub_css_style_t *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_CSS_H
@@ -1,274 +1,711 @@
 /**
  * @file epub_html.c
- * @brief EPUB HTML 解析器实现 - 简化版，提取文本块
+ * @brief EPUB HTML 解析器实现 - 基于 epub_xml 的 SAX 分词，流式输出文本块
  */
 
 #include "epub_html.h"
+#include "epub_css.h"
+#include "epub_xml.h"
 #include "esp_log.h"
 #include <string.h>
 #include <stdlib.h>
-#include <ctype.h>
+#include <strings.h>
 
 static const char *TAG = "EPUB_HTML";
 
+#define HTML_SPAN_SLOTS  (EPUB_HTML_ARENA_SIZE / sizeof(epub_style_span_t))
+
 struct epub_html_parser {
-    char *content;
-    size_t length;
-    size_t pos;
-    epub_text_block_t *blocks;
-    int block_count;
-    int current_block;
+    epub_xml_parser_t *xml;
+    epub_html_block_cb_t callback;
+    void *user;
+    bool stopped;
+    bool pending_space;              // 折叠后的空白，遇到下一个可见字符时才写入
+    uint8_t space_style;             // 空白出现时的样式（空格不带上后面文字的下划线等）
+    bool continued;                  // 下一块是被拆开段落的后半
+    bool list_item;                  // 刚进入 <li>，下一个非空块带 EPUB_PARA_LIST_ITEM
+    uint8_t skip_depth;              // <head>/<style>/<script> 嵌套深度，> 0 时丢弃文本
+    uint8_t block_depth;             // 块级标签嵌套深度（可能超过 EPUB_HTML_BLOCK_DEPTH）
+    uint8_t style_depth[5];          // 每个样式位的嵌套深度，容忍不配对的结束标签
+    uint8_t element_depth;           // 元素嵌套深度（可能超过 EPUB_HTML_ELEMENT_DEPTH）
+    uint8_t hidden_depth;            // > 0 时为 display:none 元素所在的元素深度，其内容丢弃
+    uint8_t utf8_len;                // 当前字符已收到的字节数
+    uint8_t utf8_need;               // 当前字符的总字节数
+    char utf8[4];
+    size_t text_len;
+    int span_count;
+    epub_para_attr_t blocks[EPUB_HTML_BLOCK_DEPTH];  // 各层块级标签的段落属性
+    const epub_css_t *css;           // 书的样式表（只读，可为 NULL）
+    epub_css_memo_t memo;            // 本解析器的计算样式记忆表
+    // 元素栈：供后代选择器匹配祖先；on/off 为样式表与行内 style 确定的粗体、斜体（含继承）
+    epub_css_element_t elements[EPUB_HTML_ELEMENT_DEPTH];
+    uint8_t element_on[EPUB_HTML_ELEMENT_DEPTH];
+    uint8_t element_off[EPUB_HTML_ELEMENT_DEPTH];
+    // 文本从前往后写，样式区间从后往前写，两者相遇时拆块
+    union {
+        char text[EPUB_HTML_ARENA_SIZE];
+        epub_style_span_t spans[HTML_SPAN_SLOTS];
+    } arena;
 };
 
-// HTML 标签到块类型的映射
+// 行内标签到样式位的映射
 typedef struct {
     const char *tag;
-    epub_text_block_type_t type;
-} tag_mapping_t;
-
-static const tag_mapping_t tag_map[] = {
-    {"<h1", EPUB_TEXT_BLOCK_HEADING1},
-    {"<h2", EPUB_TEXT_BLOCK_HEADING2},
-    {"<h3", EPUB_TEXT_BLOCK_HEADING3},
-    {"<b>", EPUB_TEXT_BLOCK_BOLD},
-    {"<strong>", EPUB_TEXT_BLOCK_BOLD},
-    {"<i>", EPUB_TEXT_BLOCK_ITALIC},
-    {"<em>", EPUB_TEXT_BLOCK_ITALIC},
-    {"<img", EPUB_TEXT_BLOCK_IMAGE},
-    {NULL, EPUB_TEXT_BLOCK_NORMAL}
+    uint8_t style;
+} style_mapping_t;
+
+static const style_mapping_t style_map[] = {
+    {"b", EPUB_STYLE_BOLD},
+    {"strong", EPUB_STYLE_BOLD},
+    {"i", EPUB_STYLE_ITALIC},
+    {"em", EPUB_STYLE_ITALIC},
+    {"cite", EPUB_STYLE_ITALIC},
+    {"dfn", EPUB_STYLE_ITALIC},
+    {"var", EPUB_STYLE_ITALIC},
+    {"u", EPUB_STYLE_UNDERLINE},
+    {"ins", EPUB_STYLE_UNDERLINE},
+    {"sup", EPUB_STYLE_SUPER},
+    {"sub", EPUB_STYLE_SUB},
+    {NULL, 0}
+};
+
+// 开始或结束时都要断段的块级标签（h1-h6 另行识别）
+static const char *const block_tags[] = {
+    "p", "div", "li", "ul", "ol", "dl", "dt", "dd", "blockquote", "pre",
+    "table", "tr", "section", "article", "header", "footer", "aside", "nav",
+    "figure", "figcaption", "body", "address", "center",
+    NULL
+};
+
+// 子内容左缩进一级的块级标签
+static const char *const margin_tags[] = {
+    "blockquote", "ul", "ol", "dd",
+    NULL
+};
+
+static const epub_para_attr_t default_attr = {
+    .heading_level = 0,
+    .align = EPUB_ALIGN_DEFAULT,
+    .indent = EPUB_INDENT_AUTO,
+    .margin = 0,
+    .flags = 0,
+};
+
+// 内容整个丢弃的标签
+static const char *const skip_tags[] = {
+    "head", "style", "script",
+    NULL
+};
+
+// 没有内容的标签：不进元素栈（HTML 写法不一定有结束标签）
+static const char *const void_tags[] = {
+    "br", "img", "image", "hr", "meta", "link", "input", "wbr", "col", "area", "base", "source",
+    NULL
 };
 
-// 跳过 HTML 标签
-static const char* skip_tag(const char *html) {
-    if (*html == '<') {
-        const char *end = strchr(html, '>');
-        return end ? end + 1 : html + 1;
+static bool tag_in(const char *name, const char *const *list) {
+    for (int i = 0; list[i]; i++) {
+        if (strcasecmp(name, list[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int heading_level(const char *name) {
+    if ((name[0] == 'h' || name[0] == 'H') && name[1] >= '1' && name[1] <= '6' && name[2] == '\0') {
+        return name[1] - '0';
+    }
+    return 0;
+}
+
+static int element_top(const epub_html_parser_t *p) {
+    return (p->element_depth < EPUB_HTML_ELEMENT_DEPTH ? p->element_depth : EPUB_HTML_ELEMENT_DEPTH) - 1;
+}
+
+static uint8_t current_style(const epub_html_parser_t *p) {
+    uint8_t style = 0;
+    for (int i = 0; i < (int)sizeof(p->style_depth); i++) {
+        if (p->style_depth[i]) {
+            style |= (uint8_t)(1u << i);
+        }
+    }
+    if (p->element_depth > 0) {
+        const int top = element_top(p);
+        style = (uint8_t)((style | p->element_on[top]) & ~p->element_off[top]);
+    }
+    return style;
+}
+
+static int style_bit(uint8_t style) {
+    int bit = 0;
+    while (style > 1) {
+        style >>= 1;
+        bit++;
     }
-    return html;
+    return bit;
 }
 
-// 检查是否是标签开始
-static bool is_tag_start(const char *html, const char *tag) {
-    size_t tag_len = strlen(tag);
-    return strncmp(html, tag, tag_len) == 0;
+static const epub_para_attr_t *top_attr(const epub_html_parser_t *p) {
+    if (p->block_depth == 0) {
+        return &default_attr;
+    }
+    const int top = p->block_depth < EPUB_HTML_BLOCK_DEPTH ? p->block_depth : EPUB_HTML_BLOCK_DEPTH;
+    return &p->blocks[top - 1];
 }
 
-// 查找下一个标签
-static const char* find_next_tag(const char *html) {
-    return strchr(html, '<');
+static epub_style_span_t *span_slot(epub_html_parser_t *p, int index) {
+    return &p->arena.spans[HTML_SPAN_SLOTS - 1 - index];
+}
+
+// ---------------------------------------------------------------------------
+// 块输出
+// ---------------------------------------------------------------------------
+
+static void emit(epub_html_parser_t *p, epub_text_block_t *block) {
+    if (!p->stopped && !p->callback(block, p->user)) {
+        p->stopped = true;
+    }
 }
 
-// 去除 HTML 实体
-static void decode_html_entities(char *text) {
-    // 简化版，只处理常见实体
-    struct {
-        const char *entity;
-        char replacement;
-    } entities[] = {
-        {"&amp;", '&'},
-        {"&lt;", '<'},
-        {"&gt;", '>'},
-        {"&quot;", '"'},
-        {"&apos;", '\''},
-        {"&nbsp;", ' '},
-        {NULL, '\0'}
+static void flush_block(epub_html_parser_t *p, bool split) {
+    p->pending_space = false;
+    if (p->text_len == 0) {
+        return;
+    }
+
+    // 样式区间倒序存放，交出前原地翻转成升序
+    epub_style_span_t *spans = span_slot(p, p->span_count - 1);
+    for (int i = 0, j = p->span_count - 1; i < j; i++, j--) {
+        const epub_style_span_t tmp = spans[i];
+        spans[i] = spans[j];
+        spans[j] = tmp;
+    }
+    p->arena.text[p->text_len] = '\0';
+
+    epub_text_block_t block = {
+        .type = top_attr(p)->heading_level > 0 ? EPUB_TEXT_BLOCK_HEADING : EPUB_TEXT_BLOCK_NORMAL,
+        .text = p->arena.text,
+        .text_length = (int)p->text_len,
+        .spans = p->span_count > 0 ? spans : NULL,
+        .span_count = p->span_count,
+        .image_src = NULL,
+        .attr = *top_attr(p),
     };
+    if (p->continued) {
+        block.attr.flags |= EPUB_PARA_CONTINUED;
+    }
+    if (p->list_item) {
+        block.attr.flags |= EPUB_PARA_LIST_ITEM;
+    }
+    emit(p, &block);
+
+    p->text_len = 0;
+    p->span_count = 0;
+    p->continued = split;
+    p->list_item = false;
+}
 
-    for (int i = 0; entities[i].entity; i++) {
-        char *pos;
-        while ((pos = strstr(text, entities[i].entity)) != NULL) {
-            *pos = entities[i].replacement;
-            memmove(pos + 1, pos + strlen(entities[i].entity), strlen(pos + strlen(entities[i].entity)) + 1);
+// 写入一个完整字符（含样式区间记录），arena 放不下时先拆块
+static void append_styled(epub_html_parser_t *p, const char *bytes, size_t n, uint8_t style) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        epub_style_span_t *last = p->span_count > 0 ? span_slot(p, p->span_count - 1) : NULL;
+        const bool extend = style == 0 ||
+                            (last && last->style == style && last->offset + last->length == p->text_len);
+        const size_t spans_start = (HTML_SPAN_SLOTS - p->span_count - (extend ? 0 : 1)) *
+                                   sizeof(epub_style_span_t);
+        if (p->text_len + n + 1 <= spans_start) {
+            memcpy(p->arena.text + p->text_len, bytes, n);
+            if (style != 0) {
+                if (extend) {
+                    last->length += (uint16_t)n;
+                } else {
+                    epub_style_span_t *span = span_slot(p, p->span_count++);
+                    span->offset = (uint16_t)p->text_len;
+                    span->length = (uint16_t)n;
+                    span->style = style;
+                }
+            }
+            p->text_len += n;
+            return;
+        }
+        flush_block(p, true);
+        if (n == 1 && bytes[0] == ' ' && !(top_attr(p)->flags & EPUB_PARA_PRE)) {
+            return;  // 拆块处的折叠空白不带到下一块开头
         }
     }
 }
 
-// 提取图片 src 属性
-static bool extract_image_src(const char *img_tag, char *src, size_t src_size) {
-    const char *src_start = strstr(img_tag, "src=");
-    if (!src_start) return false;
+static void append(epub_html_parser_t *p, const char *bytes, size_t n) {
+    append_styled(p, bytes, n, current_style(p));
+}
 
-    src_start += 4;
-    while (*src_start == ' ' || *src_start == '=') src_start++;
-    if (*src_start == '"') src_start++;
+static void put_char(epub_html_parser_t *p, const char *bytes, size_t n) {
+    const unsigned char c = (unsigned char)bytes[0];
 
-    const char *src_end = strchr(src_start, '"');
-    if (!src_end) return false;
+    if (n == 1 && (c == ' ' || c == '\t' || c == '\r' || c == '\n')) {
+        if (top_attr(p)->flags & EPUB_PARA_PRE) {
+            if (c != '\r') {
+                append(p, c == '\n' ? "\n" : " ", 1);
+            }
+        } else if (p->text_len > 0 && p->arena.text[p->text_len - 1] != '\n' && !p->pending_space) {
+            p->pending_space = true;
+            p->space_style = current_style(p);
+        }
+        return;
+    }
 
-    size_t len = src_end - src_start;
-    if (len >= src_size) len = src_size - 1;
-    memcpy(src, src_start, len);
-    src[len] = '\0';
+    if (n == 2 && c == 0xC2 && (unsigned char)bytes[1] == 0xA0) {
+        // &nbsp; 按普通空格输出，但不参与折叠
+        p->pending_space = false;
+        append(p, " ", 1);
+        return;
+    }
+    if ((n == 2 && c == 0xC2 && (unsigned char)bytes[1] == 0xAD) ||
+        (n == 3 && memcmp(bytes, "\xEF\xBB\xBF", 3) == 0) ||
+        (n == 3 && memcmp(bytes, "\xE2\x80\x8B", 3) == 0)) {
+        return;  // 软连字符、BOM、零宽空格
+    }
 
-    return true;
+    if (p->pending_space) {
+        p->pending_space = false;
+        append_styled(p, " ", 1, p->space_style & current_style(p));
+    }
+    append(p, bytes, n);
 }
 
-epub_html_parser_t* epub_html_create(const char *html_content, size_t content_length) {
-    epub_html_parser_t *parser = calloc(1, sizeof(epub_html_parser_t));
-    if (!parser) {
-        ESP_LOGE(TAG, "Failed to allocate parser");
-        return NULL;
+// ---------------------------------------------------------------------------
+// SAX 回调
+// ---------------------------------------------------------------------------
+
+static void html_text(void *user, const char *text, size_t len) {
+    epub_html_parser_t *p = user;
+    if (p->skip_depth > 0 || p->hidden_depth > 0 || p->stopped) {
+        return;
     }
 
-    parser->content = strndup(html_content, content_length);
-    parser->length = content_length;
-    parser->pos = 0;
-    parser->blocks = NULL;
-    parser->block_count = 0;
-    parser->current_block = 0;
+    // 文本分段可能切开 UTF-8 字符，按字符重新拼好再写入
+    for (size_t i = 0; i < len; i++) {
+        const unsigned char c = (unsigned char)text[i];
+        if (p->utf8_len > 0 && (c & 0xC0) == 0x80) {
+            p->utf8[p->utf8_len++] = (char)c;
+            if (p->utf8_len == p->utf8_need) {
+                put_char(p, p->utf8, p->utf8_len);
+                p->utf8_len = 0;
+            }
+            continue;
+        }
+        p->utf8_len = 0;  // 残缺序列直接丢弃
+        if (c == 0) {
+            continue;     // NUL 会截断以 NUL 结尾的文本块，样式区间随之越界
+        } else if (c < 0x80) {
+            put_char(p, (const char *)&c, 1);
+        } else if (c >= 0xC2 && c <= 0xF4) {
+            p->utf8[0] = (char)c;
+            p->utf8_len = 1;
+            p->utf8_need = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+        }
+    }
+}
 
-    ESP_LOGI(TAG, "Created HTML parser, content length: %u", content_length);
-    return parser;
+static const char *find_attr(const char *const *attrs, const char *name) {
+    for (int i = 0; attrs && attrs[i]; i += 2) {
+        if (strcasecmp(attrs[i], name) == 0) {
+            return attrs[i + 1];
+        }
+    }
+    return NULL;
 }
 
-void epub_html_destroy(epub_html_parser_t *parser) {
-    if (!parser) return;
-    if (parser->content) {
-        free(parser->content);
+// ---------------------------------------------------------------------------
+// 段落属性
+// ---------------------------------------------------------------------------
+
+static void push_block(epub_html_parser_t *p, const char *name, const char *const *attrs,
+                       const epub_css_style_t *css) {
+    epub_para_attr_t attr = *top_attr(p);
+    attr.flags &= EPUB_PARA_PRE;  // 只有 <pre> 的空白规则由子块继承
+
+    const int level = heading_level(name);
+    if (level > 0) {
+        attr.heading_level = (uint8_t)level;
     }
-    if (parser->blocks) {
-        free(parser->blocks);
+    const unsigned margin = (css->set & EPUB_CSS_HAS_MARGIN) ? css->margin : tag_in(name, margin_tags) ? 1 : 0;
+    attr.margin = (uint8_t)(attr.margin + margin < UINT8_MAX ? attr.margin + margin : UINT8_MAX);
+    if (strcasecmp(name, "pre") == 0) {
+        attr.flags |= EPUB_PARA_PRE;
+    } else if (strcasecmp(name, "center") == 0) {
+        attr.align = EPUB_ALIGN_CENTER;
+    } else if (strcasecmp(name, "li") == 0) {
+        p->list_item = true;
+    }
+
+    const char *align = find_attr(attrs, "align");
+    if (align) {
+        epub_css_parse_align(align, strlen(align), &attr.align);
+    }
+    // 样式表与行内 style 优先于 align 属性
+    if (css->set & EPUB_CSS_HAS_ALIGN) {
+        attr.align = css->align;
+    }
+    if (css->set & EPUB_CSS_HAS_INDENT) {
+        attr.indent = css->indent;
+    }
+
+    if (p->block_depth < EPUB_HTML_BLOCK_DEPTH) {
+        p->blocks[p->block_depth] = attr;
+    }
+    if (p->block_depth < UINT8_MAX) {
+        p->block_depth++;
     }
-    free(parser);
 }
 
-bool epub_html_next_block(epub_html_parser_t *parser, epub_text_block_t *block) {
-    if (!parser || !block || parser->pos >= parser->length) {
-        return false;
+// ---------------------------------------------------------------------------
+// 元素栈与样式表
+// ---------------------------------------------------------------------------
+
+static void push_element(epub_html_parser_t *p, const epub_css_element_t *el, uint8_t on, uint8_t off) {
+    if (p->element_depth < EPUB_HTML_ELEMENT_DEPTH) {
+        p->elements[p->element_depth] = *el;
+        p->element_on[p->element_depth] = on;
+        p->element_off[p->element_depth] = off;
+    }
+    if (p->element_depth < UINT8_MAX) {
+        p->element_depth++;
+    }
+}
+
+// 弹出与结束标签配对的元素（连同其中未闭合的元素），找不到配对时忽略
+static void pop_element(epub_html_parser_t *p, const char *name) {
+    if (p->element_depth == 0) {
+        return;
+    }
+    if (p->element_depth > EPUB_HTML_ELEMENT_DEPTH) {
+        p->element_depth--;   // 超出记录深度的部分无从核对，按配对处理
+        return;
     }
+    epub_css_element_t el;
+    epub_css_element_init(&el, name, NULL);
+    for (int i = p->element_depth - 1; i >= 0; i--) {
+        if (p->elements[i].tag == el.tag) {
+            p->element_depth = (uint8_t)i;
+            return;
+        }
+    }
+}
+
+// 元素的样式：样式表规则，再由行内 style 覆盖
+static void element_style(epub_html_parser_t *p, const epub_css_element_t *el, const char *const *attrs,
+                          epub_css_style_t *out) {
+    epub_css_compute(p->css, el, p->elements, element_top(p) + 1, &p->memo, out);
+    const char *style = find_attr(attrs, "style");
+    if (style) {
+        epub_css_style_t inline_style = {0};
+        epub_css_parse_declarations(style, strlen(style), &inline_style);
+        epub_css_merge(out, &inline_style);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// SAX 回调
+// ---------------------------------------------------------------------------
 
-    const char *content = parser->content + parser->pos;
-    const char *end = parser->content + parser->length;
+static void html_start(void *user, const char *name, const char *const *attrs) {
+    epub_html_parser_t *p = user;
 
-    // 跳过空白
-    while (content < end && isspace(*content)) {
-        content++;
+    if (tag_in(name, skip_tags)) {
+        if (p->skip_depth < UINT8_MAX) {
+            p->skip_depth++;
+        }
+        return;
+    }
+    if (p->skip_depth > 0) {
+        return;
     }
 
-    if (content >= end) {
-        return false;
+    const bool is_void = tag_in(name, void_tags);
+    epub_css_element_t el;
+    epub_css_element_init(&el, name, find_attr(attrs, "class"));
+    if (p->hidden_depth > 0) {
+        if (!is_void) {
+            push_element(p, &el, 0, 0);
+        }
+        return;
     }
 
-    // 检查是否是标签
-    if (*content == '<') {
-        // 处理标签
-        epub_text_block_type_t type = EPUB_TEXT_BLOCK_NORMAL;
+    epub_css_style_t css;
+    element_style(p, &el, attrs, &css);
+    if (css.hidden) {
+        if (!is_void) {
+            push_element(p, &el, 0, 0);
+            p->hidden_depth = p->element_depth;
+        }
+        return;
+    }
 
-        // 检查特殊标签
-        for (int i = 0; tag_map[i].tag != NULL; i++) {
-            if (is_tag_start(content, tag_map[i].tag)) {
-                type = tag_map[i].type;
-                break;
-            }
+    uint8_t tag_style = 0;
+    for (int i = 0; style_map[i].tag; i++) {
+        if (strcasecmp(name, style_map[i].tag) == 0) {
+            tag_style = style_map[i].style;
+            break;
+        }
+    }
+    if (!is_void) {
+        // 粗体、斜体按元素继承；<b> 等标签本身重新打开被外层样式关掉的位
+        uint8_t on = 0, off = 0;
+        if (p->element_depth > 0) {
+            on = p->element_on[element_top(p)];
+            off = p->element_off[element_top(p)];
         }
+        off &= (uint8_t)~tag_style;
+        const uint8_t bits = ((css.set & EPUB_CSS_HAS_WEIGHT) ? EPUB_STYLE_BOLD : 0) |
+                             ((css.set & EPUB_CSS_HAS_SLANT) ? EPUB_STYLE_ITALIC : 0);
+        on = (uint8_t)((on & ~bits) | (css.style & bits));
+        off = (uint8_t)((off & ~bits) | (~css.style & bits));
+        push_element(p, &el, on, off);
+    }
 
-        if (type == EPUB_TEXT_BLOCK_IMAGE) {
-            // 提取图片
-            const char *tag_end = strchr(content, '>');
-            if (!tag_end) {
-                parser->pos = parser->length;
-                return false;
-            }
+    if (tag_style) {
+        uint8_t *depth = &p->style_depth[style_bit(tag_style)];
+        if (*depth < UINT8_MAX) {
+            (*depth)++;
+        }
+        return;
+    }
 
-            char tag_buffer[512];
-            size_t tag_len = tag_end - content + 1;
-            if (tag_len >= sizeof(tag_buffer)) tag_len = sizeof(tag_buffer) - 1;
-            memcpy(tag_buffer, content, tag_len);
-            tag_buffer[tag_len] = '\0';
-
-            if (extract_image_src(tag_buffer, block->image_src, sizeof(block->image_src))) {
-                block->type = EPUB_TEXT_BLOCK_IMAGE;
-                block->text[0] = '\0';
-                block->text_length = 0;
-                parser->pos = tag_end - parser->content + 1;
-                ESP_LOGD(TAG, "Found image: %s", block->image_src);
-                return true;
-            }
+    if (strcasecmp(name, "br") == 0) {
+        p->pending_space = false;
+        append(p, "\n", 1);
+        return;
+    }
+
+    if (strcasecmp(name, "img") == 0 || strcasecmp(name, "image") == 0) {
+        // <img src> 或 SVG 里的 <image xlink:href>（属性名已去掉前缀）
+        const char *src = find_attr(attrs, "src");
+        if (!src) {
+            src = find_attr(attrs, "href");
         }
+        if (src && *src) {
+            flush_block(p, false);
+            epub_text_block_t block = {
+                .type = EPUB_TEXT_BLOCK_IMAGE,
+                .text = "",
+                .image_src = src,
+                .attr = *top_attr(p),
+            };
+            block.attr.flags &= EPUB_PARA_PRE;
+            ESP_LOGD(TAG, "Found image: %s", src);
+            emit(p, &block);
+        }
+        return;
+    }
 
-        // 跳过标签
-        content = skip_tag(content);
-        parser->pos = content - parser->content;
+    if (strcasecmp(name, "hr") == 0) {
+        flush_block(p, false);
+        return;
     }
 
-    // 提取文本内容（直到下一个标签或结尾）
-    const char *text_start = content;
-    const char *text_end = find_next_tag(content);
-    if (!text_end) {
-        text_end = end;
+    if (tag_in(name, block_tags) || heading_level(name) > 0) {
+        flush_block(p, false);
+        push_block(p, name, attrs, &css);
+    }
+}
+
+static void html_end(void *user, const char *name) {
+    epub_html_parser_t *p = user;
+
+    if (tag_in(name, skip_tags)) {
+        if (p->skip_depth > 0) {
+            p->skip_depth--;
+        }
+        return;
+    }
+    if (p->skip_depth > 0) {
+        return;
     }
 
-    // 复制文本
-    size_t text_len = text_end - text_start;
-    if (text_len > 0) {
-        // 去除尾部空白
-        while (text_len > 0 && isspace((unsigned char)text_start[text_len - 1])) {
-            text_len--;
+    if (!tag_in(name, void_tags)) {
+        pop_element(p, name);
+    }
+    if (p->hidden_depth > 0) {
+        if (p->element_depth < p->hidden_depth) {
+            p->hidden_depth = 0;   // display:none 的元素结束
         }
+        return;
+    }
 
-        if (text_len > 0) {
-            if (text_len >= sizeof(block->text)) {
-                text_len = sizeof(block->text) - 1;
+    for (int i = 0; style_map[i].tag; i++) {
+        if (strcasecmp(name, style_map[i].tag) == 0) {
+            uint8_t *depth = &p->style_depth[style_bit(style_map[i].style)];
+            if (*depth > 0) {
+                (*depth)--;
             }
-            memcpy(block->text, text_start, text_len);
-            block->text[text_len] = '\0';
-            block->text_length = text_len;
-            block->type = EPUB_TEXT_BLOCK_NORMAL;
+            return;
+        }
+    }
 
-            // 解码 HTML 实体
-            decode_html_entities(block->text);
+    if (strcasecmp(name, "td") == 0 || strcasecmp(name, "th") == 0) {
+        if (p->text_len > 0 && !p->pending_space) {
+            p->pending_space = true;
+            p->space_style = 0;
+        }
+        return;
+    }
 
-            parser->pos = text_end - parser->content;
-            ESP_LOGD(TAG, "Text block: '%s' (len=%u)", block->text, block->text_length);
-            return true;
+    if (tag_in(name, block_tags) || heading_level(name) > 0) {
+        flush_block(p, false);
+        if (p->block_depth > 0) {
+            p->block_depth--;
         }
     }
+}
+
+// ---------------------------------------------------------------------------
+// 接口
+// ---------------------------------------------------------------------------
 
-    // 递归查找下一个块
-    parser->pos = text_end ? text_end - parser->content : parser->length;
-    return epub_html_next_block(parser, block);
+epub_html_parser_t* epub_html_create(epub_html_block_cb_t callback, void *user) {
+    if (!callback) {
+        return NULL;
+    }
+
+    epub_html_parser_t *parser = calloc(1, sizeof(epub_html_parser_t));
+    if (!parser) {
+        ESP_LOGE(TAG, "Failed to allocate parser");
+        return NULL;
+    }
+
+    const epub_xml_handler_t handler = {
+        .start_element = html_start,
+        .end_element = html_end,
+        .text = html_text,
+        .user = parser,
+    };
+    parser->xml = epub_xml_create(&handler);
+    if (!parser->xml) {
+        ESP_LOGE(TAG, "Failed to allocate tokenizer");
+        free(parser);
+        return NULL;
+    }
+    epub_xml_set_limit(parser->xml, EPUB_HTML_MAX_INPUT);
+    parser->callback = callback;
+    parser->user = user;
+    return parser;
 }
 
-void epub_html_reset(epub_html_parser_t *parser) {
-    if (!parser) return;
-    parser->current_block = 0;
+bool epub_html_feed(epub_html_parser_t *parser, const char *data, size_t len) {
+    if (!parser || parser->stopped) {
+        return false;
+    }
+    if (!epub_xml_feed(parser->xml, data, len) && !parser->stopped) {
+        // 超过单章上限：交出当前段落后停止，已解析的内容照常显示
+        flush_block(parser, false);
+        parser->stopped = true;
+    }
+    return !parser->stopped;
 }
 
-int epub_html_get_block_count(epub_html_parser_t *parser) {
-    if (!parser) return 0;
+void epub_html_set_css(epub_html_parser_t *parser, const epub_css_t *css) {
+    if (parser) {
+        parser->css = css;
+    }
+}
 
-    // 如果还没统计，先统计一次
-    if (parser->blocks == NULL) {
-        // 临时统计
-        int count = 0;
-        epub_text_block_t block;
-        size_t old_pos = parser->pos;
+void epub_html_finish(epub_html_parser_t *parser) {
+    if (!parser) {
+        return;
+    }
+    epub_xml_finish(parser->xml);
+    flush_block(parser, false);
+}
 
-        parser->pos = 0;
-        while (epub_html_next_block(parser, &block)) {
-            count++;
-        }
+void epub_html_destroy(epub_html_parser_t *parser) {
+    if (!parser) return;
+    epub_xml_destroy(parser->xml);
+    free(parser);
+}
 
-        parser->pos = old_pos;
-        return count;
-    }
+// ---------------------------------------------------------------------------
+// 序列化
+// ---------------------------------------------------------------------------
 
-    return parser->block_count;
+// 记录布局：头 | spans[span_count] | text + NUL | 补齐到偶数
+typedef struct {
+    uint16_t size;
+    uint16_t text_length;            // 图片块为 src 长度
+    uint16_t span_count;
+    uint8_t type;
+    uint8_t reserved;
+    epub_para_attr_t attr;
+    uint8_t pad;
+} block_record_t;
+
+size_t epub_html_record_size(const epub_text_block_t *block) {
+    const size_t text_length = block->image_src ? strlen(block->image_src) : (size_t)block->text_length;
+    const size_t size = sizeof(block_record_t) + (size_t)block->span_count * sizeof(epub_style_span_t) +
+                        text_length + 1;
+    return (size + 1) & ~(size_t)1;
 }
 
-bool epub_html_goto_block(epub_html_parser_t *parser, int block_index) {
-    if (!parser || block_index < 0) {
-        return false;
+size_t epub_html_write_record(const epub_text_block_t *block, void *out) {
+    const size_t size = epub_html_record_size(block);
+    const char *text = block->image_src ? block->image_src : block->text;
+    const size_t text_length = block->image_src ? strlen(block->image_src) : (size_t)block->text_length;
+
+    block_record_t header = {
+        .size = (uint16_t)size,
+        .text_length = (uint16_t)text_length,
+        .span_count = (uint16_t)block->span_count,
+        .type = (uint8_t)block->type,
+        .attr = block->attr,
+    };
+    uint8_t *dst = out;
+    memcpy(dst, &header, sizeof(header));
+    dst += sizeof(header);
+    if (block->span_count > 0) {
+        memcpy(dst, block->spans, (size_t)block->span_count * sizeof(epub_style_span_t));
+        dst += (size_t)block->span_count * sizeof(epub_style_span_t);
+    }
+    memcpy(dst, text, text_length);
+    dst += text_length;
+    *dst++ = '\0';
+    if ((size_t)(dst - (uint8_t *)out) < size) {
+        *dst = '\0';
     }
+    return size;
+}
 
-    parser->pos = 0;
-    for (int i = 0; i < block_index; i++) {
-        epub_text_block_t block;
-        if (!epub_html_next_block(parser, &block)) {
-            return false;
-        }
+size_t epub_html_read_record(const void *data, size_t len, epub_text_block_t *block) {
+    block_record_t header;
+    if (len < sizeof(header)) {
+        return 0;
     }
+    memcpy(&header, data, sizeof(header));
 
-    parser->current_block = block_index;
-    return true;
+    const size_t spans_size = (size_t)header.span_count * sizeof(epub_style_span_t);
+    if (header.size > len || (header.size & 1) ||
+        sizeof(header) + spans_size + header.text_length + 1 > header.size ||
+        header.type > EPUB_TEXT_BLOCK_IMAGE) {
+        return 0;
+    }
+
+    const uint8_t *base = data;
+    const char *text = (const char *)base + sizeof(header) + spans_size;
+    if (text[header.text_length] != '\0') {
+        return 0;
+    }
+
+    memset(block, 0, sizeof(*block));
+    block->type = (epub_text_block_type_t)header.type;
+    block->attr = header.attr;
+    if (block->type == EPUB_TEXT_BLOCK_IMAGE) {
+        block->text = "";
+        block->image_src = text;
+    } else {
+        block->text = text;
+        block->text_length = header.text_length;
+        block->spans = header.span_count > 0 ? (const epub_style_span_t *)(base + sizeof(header)) : NULL;
+        block->span_count = header.span_count;
+    }
+    return header.size;
 }
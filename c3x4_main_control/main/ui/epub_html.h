@@ -1,85 +1,159 @@
 /**
  * @file epub_html.h
- * @brief 轻量级 EPUB HTML/XHTML 解析器 - 提取文本内容
+ * @brief 轻量级 EPUB HTML/XHTML 解析器 - 流式提取文本块
  *
- * 简化版 HTML 解析器，只提取文本和基本格式
- * 参考 atomic14 的 RubbishHtmlParser，但针对内存优化
+ * 数据分块送入（直接接在 ZIP 解压回调后面），不复制整个章节：
+ * 当前段落的文本和样式区间放在固定大小的 arena 里，段落结束即通过回调交出。
+ * <head>、<style>、<script> 的内容边读边丢，不做缓存。
+ * 书的样式表（epub_css）与行内 style 决定粗体 / 斜体、对齐、缩进和 display:none，
+ * 后代选择器按元素栈匹配祖先。
+ * 输入超过 EPUB_HTML_MAX_INPUT 时交出当前段落后停止，损坏或畸形的章节不会无限解析下去
  */
 
 #ifndef EPUB_HTML_H
 #define EPUB_HTML_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define EPUB_HTML_ARENA_SIZE  4096  // 单个文本块（文本 + 样式区间）的上限，超出时拆成续块
+#define EPUB_HTML_BLOCK_DEPTH 16    // 记录段落属性的块级标签嵌套深度
+#define EPUB_HTML_ELEMENT_DEPTH 24  // 参与样式匹配的元素嵌套深度
+#define EPUB_HTML_MAX_INPUT   (16 * 1024 * 1024)  // 单章输入上限，超出部分丢弃（整本书放在一个文件里的也够用）
+#define EPUB_HTML_FORMAT_VERSION 2  // 序列化记录格式版本，解析规则变化时也要递增（缓存随之失效）
+
 // 文本块类型
 typedef enum {
-    EPUB_TEXT_BLOCK_NORMAL,   // 普通段落
-    EPUB_TEXT_BLOCK_HEADING1,  // 标题 H1
-    EPUB_TEXT_BLOCK_HEADING2,  // 标题 H2
-    EPUB_TEXT_BLOCK_HEADING3,  // 标题 H3
-    EPUB_TEXT_BLOCK_BOLD,      // 粗体
-    EPUB_TEXT_BLOCK_ITALIC,    // 斜体
+    EPUB_TEXT_BLOCK_NORMAL,    // 普通段落
+    EPUB_TEXT_BLOCK_HEADING,   // 标题，级别见 attr.heading_level
     EPUB_TEXT_BLOCK_IMAGE,     // 图片
 } epub_text_block_type_t;
 
-// 文本块（流式输出）
+// 行内样式位
+#define EPUB_STYLE_BOLD       0x01
+#define EPUB_STYLE_ITALIC     0x02
+#define EPUB_STYLE_UNDERLINE  0x04
+#define EPUB_STYLE_SUPER      0x08
+#define EPUB_STYLE_SUB        0x10
+
+// 样式区间：text[offset, offset + length) 使用 style，未覆盖的部分为常规样式
+typedef struct {
+    uint16_t offset;
+    uint16_t length;
+    uint8_t style;
+} epub_style_span_t;
+
+// 段落对齐
+typedef enum {
+    EPUB_ALIGN_DEFAULT,        // 未指定，按阅读设置
+    EPUB_ALIGN_LEFT,
+    EPUB_ALIGN_CENTER,
+    EPUB_ALIGN_RIGHT,
+    EPUB_ALIGN_JUSTIFY,
+} epub_align_t;
+
+#define EPUB_INDENT_AUTO      INT8_MIN  // 未指定首行缩进，按阅读设置
+
+// 段落标志
+#define EPUB_PARA_CONTINUED   0x01  // 段落超出 arena 被拆开，本块接着上一块（不缩进、不加段距）
+#define EPUB_PARA_LIST_ITEM   0x02  // 列表项的第一块
+#define EPUB_PARA_PRE         0x04  // <pre>：保留空格和换行
+
+// 段落属性（来自块级标签、align 属性、样式表和行内 style，由外层块继承）
+typedef struct {
+    uint8_t heading_level;   // 0 为正文，1-6 对应 h1-h6
+    uint8_t align;           // epub_align_t
+    int8_t indent;           // 首行缩进，单位 1/2 em，可为负（悬挂缩进）
+    uint8_t margin;          // 左缩进层级（blockquote、列表等嵌套）
+    uint8_t flags;           // EPUB_PARA_*
+} epub_para_attr_t;
+
+// 文本块（指针指向解析器内部或缓存数据，只在回调期间 / 数据释放前有效）
 typedef struct {
     epub_text_block_type_t type;
-    char text[2048];          // 文本内容
+    const char *text;                 // UTF-8 文本，NUL 结尾，实体已解码，空白已折叠
     int text_length;
-    char image_src[256];      // 图片路径（如果是图片块）
+    const epub_style_span_t *spans;   // 按 offset 升序
+    int span_count;
+    const char *image_src;            // 图片路径（图片块），其余为 NULL
+    epub_para_attr_t attr;
 } epub_text_block_t;
 
+/**
+ * @brief 文本块回调
+ * @return true 继续，false 停止解析
+ */
+typedef bool (*epub_html_block_cb_t)(const epub_text_block_t *block, void *user);
+
 // HTML 解析器状态
 typedef struct epub_html_parser epub_html_parser_t;
 
+struct epub_css;
+
 /**
  * @brief 创建 HTML 解析器
- * @param html_content HTML 内容
- * @param content_length 内容长度
+ * @param callback 文本块回调
+ * @param user 回调参数
  * @return 解析器句柄
  */
-epub_html_parser_t* epub_html_create(const char *html_content, size_t content_length);
+epub_html_parser_t* epub_html_create(epub_html_block_cb_t callback, void *user);
 
 /**
- * @brief 销毁 HTML 解析器
+ * @brief 送入一段 HTML 数据
  * @param parser 解析器句柄
+ * @param data 数据
+ * @param len 数据长度
+ * @return true 继续，false 回调要求停止
  */
-void epub_html_destroy(epub_html_parser_t *parser);
+bool epub_html_feed(epub_html_parser_t *parser, const char *data, size_t len);
 
 /**
- * @brief 流式解析 - 提取下一个文本块
+ * @brief 使用书的样式表（在送入数据前调用，样式表须比解析器活得久）
  * @param parser 解析器句柄
- * @param block 输出文本块
- * @return true 成功提取，false 已到末尾
+ * @param css 样式表，NULL 时只用行内 style
  */
-bool epub_html_next_block(epub_html_parser_t *parser, epub_text_block_t *block);
+void epub_html_set_css(epub_html_parser_t *parser, const struct epub_css *css);
 
 /**
- * @brief 重置解析器到开头
+ * @brief 数据结束，交出最后一个文本块
  * @param parser 解析器句柄
  */
-void epub_html_reset(epub_html_parser_t *parser);
+void epub_html_finish(epub_html_parser_t *parser);
 
 /**
- * @brief 获取总块数（需要先完整解析一遍）
+ * @brief 销毁 HTML 解析器
  * @param parser 解析器句柄
- * @return 块数量
  */
-int epub_html_get_block_count(epub_html_parser_t *parser);
+void epub_html_destroy(epub_html_parser_t *parser);
 
 /**
- * @brief 跳转到指定块
- * @param parser 解析器句柄
- * @param block_index 块索引
- * @return true 成功，false 索引无效
+ * @brief 计算文本块序列化后的记录大小（偶数字节，便于直接按记录读取区间数组）
+ * @param block 文本块
+ * @return 记录字节数
+ */
+size_t epub_html_record_size(const epub_text_block_t *block);
+
+/**
+ * @brief 序列化文本块
+ * @param block 文本块
+ * @param out 输出，至少 epub_html_record_size() 字节，2 字节对齐
+ * @return 写入字节数
+ */
+size_t epub_html_write_record(const epub_text_block_t *block, void *out);
+
+/**
+ * @brief 读取一条记录（不复制：text / spans / image_src 直接指向 data）
+ * @param data 记录起始，2 字节对齐
+ * @param len data 剩余字节数
+ * @param block 输出文本块
+ * @return 记录字节数，数据不完整或损坏返回 0
  */
-bool epub_html_goto_block(epub_html_parser_t *parser, int block_index);
+size_t epub_html_read_record(const void *data, size_t len, epub_text_block_t *block);
 
 #ifdef __cplusplus
 }
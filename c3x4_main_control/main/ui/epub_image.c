@@ -0,0 +1,923 @@
+/**
+ * @file epub_image.c
+ * @brief EPUB 内嵌图片解码实现
+ */
+
+#include "epub_image.h"
+#include "epub_cache.h"
+#include "epub_zip.h"
+#include "../spi_arbiter.h"
+#include "../power_manager.h"
+#include "../heap_stats.h"
+#include "lvgl.h"
+#include "miniz.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if LV_USE_TJPGD
+#include "src/libs/tjpgd/tjpgd.h"
+#endif
+
+static const char *TAG = "EPUB_IMAGE";
+
+#define IMAGE_CACHE_VERSION     1
+#define IMAGE_MAX_SOURCE_WIDTH  4096   // 源图像宽度上限（决定逐行缓冲区大小）
+#define JPEG_WORK_SIZE          4096   // TJpgDec 工作区（与 LVGL 的 lv_tjpgd 相同）
+#define PNG_INPUT_CHUNK         1024   // 每次交给 tinfl 的 IDAT 数据量
+#define IMAGE_FILE_BUF          4096   // 直接解码文件时的 stdio 缓冲
+
+// 照片模式（2bpp）的色调：先按小图直方图拉伸对比度，再提亮中间调
+// （四级灰波形的两个中间级偏暗，线性量化后照片整体发闷）
+#define PHOTO_SAMPLE_SIZE       64     // 统计直方图时解码的尺寸（JPEG 直接 1/8 缩放）
+#define PHOTO_CLIP_PERMILLE     10     // 两端各裁掉的像素比例
+#define PHOTO_MIN_RANGE         64     // 拉伸后的区间至少这么宽，避免放大噪声
+#define PHOTO_MIDTONE_LIFT      64     // 中间调提亮量（/256）：y = x + k*x*(255-x)/255
+
+static const uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+// 缓存记录：头 + 位图
+typedef struct {
+    uint32_t version;        // IMAGE_CACHE_VERSION
+    uint16_t width;
+    uint16_t height;
+} image_cache_head_t;
+
+// 图像数据来源：EPUB 内的 ZIP 流，或 SD 卡上的普通文件（二选一），以及本次解码的色调处理
+typedef struct {
+    epub_zip_stream_t *zip;
+    FILE *file;
+    const uint8_t *tone;     // 抖动前的灰度映射（NULL = 不变）
+    uint32_t *hist;          // 非 NULL 时只统计缩小后的灰度直方图，不输出位图
+} image_src_t;
+
+static int src_read(image_src_t *src, void *buffer, size_t len) {
+    if (src->zip != NULL) {
+        return epub_zip_stream_read(src->zip, buffer, len);
+    }
+    spi_arbiter_sd_begin();
+    const size_t n = fread(buffer, 1, len, src->file);
+    spi_arbiter_sd_end();
+    return (int)n;
+}
+
+static bool src_seek(image_src_t *src, uint32_t pos) {
+    if (src->zip != NULL) {
+        return epub_zip_stream_seek(src->zip, pos);
+    }
+    return fseek(src->file, (long)pos, SEEK_SET) == 0;
+}
+
+static uint32_t src_tell(image_src_t *src) {
+    if (src->zip != NULL) {
+        return epub_zip_stream_tell(src->zip);
+    }
+    const long pos = ftell(src->file);
+    return pos < 0 ? 0 : (uint32_t)pos;
+}
+
+static bool read_exact(image_src_t *src, void *buffer, size_t len) {
+    uint8_t *p = buffer;
+    while (len > 0) {
+        const int n = src_read(src, p, len);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static bool skip_bytes(image_src_t *src, uint32_t len) {
+    return src_seek(src, src_tell(src) + len);
+}
+
+static uint32_t read_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint8_t luma(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint8_t)((r * 77 + g * 150 + b * 29) >> 8);
+}
+
+// 透明部分按白色背景合成
+static uint8_t over_white(uint8_t v, uint8_t alpha) {
+    return (uint8_t)((v * alpha + 255 * (255 - alpha) + 127) / 255);
+}
+
+// 按比例缩小到能放进 max_width x max_height（不放大）
+static void fit_size(uint32_t width, uint32_t height, int max_width, int max_height,
+                     uint16_t *out_width, uint16_t *out_height) {
+    if (width <= (uint32_t)max_width && height <= (uint32_t)max_height) {
+        *out_width = (uint16_t)width;
+        *out_height = (uint16_t)height;
+    } else if (width * (uint32_t)max_height > height * (uint32_t)max_width) {
+        *out_width = (uint16_t)max_width;
+        *out_height = (uint16_t)(height * (uint32_t)max_width / width);
+    } else {
+        *out_width = (uint16_t)(width * (uint32_t)max_height / height);
+        *out_height = (uint16_t)max_height;
+    }
+    if (*out_width == 0) *out_width = 1;
+    if (*out_height == 0) *out_height = 1;
+}
+
+// ---------------------------------------------------------------------------
+// 灰度行 -> 盒式缩小 -> Floyd-Steinberg 抖动到 1bpp（或 2bpp 四级灰）
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint16_t src_width;
+    uint16_t src_height;
+    uint16_t dst_width;
+    uint16_t dst_height;
+    uint8_t bpp;             // 1 或 2
+    uint16_t src_y;          // 已收到的源行数
+    uint16_t dst_y;          // 已输出的目标行数
+    uint16_t rows;           // 当前目标行已累加的源行数
+    uint32_t v_acc;          // 纵向映射的累加器
+    uint32_t *sum;           // 当前目标行每列的灰度和
+    uint16_t *count;         // 每个目标列覆盖的源列数
+    int16_t *err_cur;        // 本行误差（两端各多一格）
+    int16_t *err_next;       // 下一行误差
+    const uint8_t *tone;
+    uint32_t *hist;
+    epub_image_t *image;
+} image_sink_t;
+
+static bool sink_init(image_sink_t *sink, const image_src_t *src, uint32_t src_width,
+                      uint32_t src_height, uint16_t dst_width, uint16_t dst_height,
+                      epub_image_t *image) {
+    const uint8_t bpp = image->bpp == 2 ? 2 : 1;
+    memset(sink, 0, sizeof(*sink));
+    sink->src_width = (uint16_t)src_width;
+    sink->src_height = (uint16_t)src_height;
+    sink->dst_width = dst_width;
+    sink->dst_height = dst_height;
+    sink->bpp = bpp;
+    sink->tone = src->tone;
+    sink->hist = src->hist;
+    sink->image = image;
+
+    const size_t err_size = (dst_width + 2) * sizeof(int16_t);
+    sink->sum = malloc(dst_width * (sizeof(uint32_t) + sizeof(uint16_t)) + 2 * err_size);
+    image->stride = (uint16_t)(((uint32_t)dst_width * bpp + 7) / 8);
+    const size_t bits_size = (size_t)image->stride * dst_height;
+    image->data = heap_stats_malloc(HEAP_TAG_IMAGE, sizeof(image_cache_head_t) + bits_size);
+    if (sink->sum == NULL || image->data == NULL) {
+        ESP_LOGE(TAG, "No memory for %ux%u image", dst_width, dst_height);
+        free(sink->sum);
+        heap_stats_free(HEAP_TAG_IMAGE, image->data);
+        image->data = NULL;
+        sink->sum = NULL;
+        return false;
+    }
+    sink->count = (uint16_t *)(sink->sum + dst_width);
+    sink->err_cur = (int16_t *)(sink->count + dst_width);
+    sink->err_next = sink->err_cur + dst_width + 2;
+    memset(sink->sum, 0, dst_width * sizeof(uint32_t));
+    memset(sink->count, 0, dst_width * sizeof(uint16_t));
+    memset(sink->err_cur, 0, 2 * err_size);
+
+    // 源列 x 落在目标列 x * dst / src
+    uint32_t acc = 0;
+    uint16_t col = 0;
+    for (uint32_t x = 0; x < src_width; x++) {
+        sink->count[col]++;
+        acc += dst_width;
+        if (acc >= src_width) {
+            acc -= src_width;
+            col++;
+        }
+    }
+
+    image_cache_head_t *head = image->data;
+    head->version = IMAGE_CACHE_VERSION;
+    head->width = dst_width;
+    head->height = dst_height;
+    image->width = dst_width;
+    image->height = dst_height;
+    image->bpp = bpp;
+    image->bits = (uint8_t *)image->data + sizeof(image_cache_head_t);
+    memset(image->bits, 0xFF, bits_size);
+    return true;
+}
+
+static void sink_emit_row(image_sink_t *sink) {
+    uint8_t *out = sink->image->bits + (size_t)sink->dst_y * sink->image->stride;
+    int16_t *cur = sink->err_cur;
+    int16_t *next = sink->err_next;
+    for (uint16_t j = 0; j < sink->dst_width; j++) {
+        const uint32_t n = (uint32_t)sink->count[j] * sink->rows;
+        const uint8_t avg = (uint8_t)((sink->sum[j] + n / 2) / n);
+        if (sink->hist != NULL) {
+            sink->hist[avg]++;
+            continue;
+        }
+        const int v = (sink->tone != NULL ? sink->tone[avg] : avg) + cur[j + 1];
+        int q;
+        if (sink->bpp == 2) {
+            // 四级灰：0 黑 .. 3 白（与灰阶 framebuffer 的量化一致）
+            const int level = v <= 0 ? 0 : v >= 255 ? 3 : (v * 3 + 127) / 255;
+            q = level * 85;
+            const int shift = 6 - 2 * (j & 3);
+            out[j >> 2] = (uint8_t)((out[j >> 2] & ~(3 << shift)) | (level << shift));
+        } else {
+            q = v >= 128 ? 255 : 0;
+            if (q == 0) {
+                out[j >> 3] &= (uint8_t)~(0x80 >> (j & 7));
+            }
+        }
+        const int d = v - q;
+        cur[j + 2] += (int16_t)(d * 7 / 16);
+        next[j] += (int16_t)(d * 3 / 16);
+        next[j + 1] += (int16_t)(d * 5 / 16);
+        next[j + 2] += (int16_t)(d / 16);
+    }
+    sink->err_cur = next;
+    sink->err_next = cur;
+    memset(cur, 0, (sink->dst_width + 2) * sizeof(int16_t));
+    memset(sink->sum, 0, sink->dst_width * sizeof(uint32_t));
+    sink->rows = 0;
+    sink->dst_y++;
+}
+
+// 收下一行源图像（src_width 个灰度值），凑满一个目标行时输出
+static void sink_push_row(image_sink_t *sink, const uint8_t *gray) {
+    if (sink->src_y >= sink->src_height) {
+        return;
+    }
+    uint32_t acc = 0;
+    uint16_t col = 0;
+    for (uint16_t x = 0; x < sink->src_width; x++) {
+        sink->sum[col] += gray[x];
+        acc += sink->dst_width;
+        if (acc >= sink->src_width) {
+            acc -= sink->src_width;
+            col++;
+        }
+    }
+    sink->src_y++;
+    sink->rows++;
+    sink->v_acc += sink->dst_height;
+    if (sink->v_acc >= sink->src_height) {
+        sink->v_acc -= sink->src_height;
+        sink_emit_row(sink);
+    }
+}
+
+// 释放缩放缓冲区；图像不完整时连同结果一起丢弃
+static bool sink_finish(image_sink_t *sink, bool ok) {
+    free(sink->sum);
+    sink->sum = NULL;
+    if (!ok || sink->dst_y < sink->dst_height) {
+        epub_image_free(sink->image);
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// JPEG：TJpgDec 按 MCU 输出，攒满一个 MCU 行后逐行交给缩放
+// ---------------------------------------------------------------------------
+
+#if LV_USE_TJPGD
+typedef struct {
+    image_src_t *src;
+    image_sink_t sink;
+    uint8_t *band;           // 一个 MCU 行的灰度像素
+    uint16_t band_width;     // 缩放后的图像宽度
+} jpeg_ctx_t;
+
+static size_t jpeg_input(JDEC *jd, uint8_t *buffer, size_t len) {
+    jpeg_ctx_t *ctx = jd->device;
+    if (buffer == NULL) {
+        return skip_bytes(ctx->src, (uint32_t)len) ? len : 0;
+    }
+    size_t got = 0;
+    while (got < len) {
+        const int n = src_read(ctx->src, buffer + got, len - got);
+        if (n <= 0) {
+            break;
+        }
+        got += (size_t)n;
+    }
+    return got;
+}
+
+static int jpeg_output(JDEC *jd, void *bitmap, JRECT *rect) {
+    jpeg_ctx_t *ctx = jd->device;
+    const uint16_t w = rect->right - rect->left + 1;
+    const uint16_t h = rect->bottom - rect->top + 1;
+    for (uint16_t y = 0; y < h; y++) {
+        uint8_t *dst = ctx->band + (size_t)y * ctx->band_width + rect->left;
+        for (uint16_t x = 0; x < w; x++) {
+            const size_t i = (size_t)y * w + x;
+#if JD_FORMAT == 2
+            dst[x] = ((const uint8_t *)bitmap)[i];
+#elif JD_FORMAT == 1
+            const uint16_t c = ((const uint16_t *)bitmap)[i];
+            dst[x] = luma((uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3));
+#else
+            const uint8_t *c = (const uint8_t *)bitmap + i * 3;
+            dst[x] = luma(c[0], c[1], c[2]);
+#endif
+        }
+    }
+    // 一个 MCU 行的最后一块
+    if (rect->right + 1 >= ctx->band_width) {
+        for (uint16_t y = 0; y < h; y++) {
+            sink_push_row(&ctx->sink, ctx->band + (size_t)y * ctx->band_width);
+        }
+    }
+    return 1;
+}
+
+// 缩放后的尺寸：每个完整 MCU 缩小 2^scale 倍，末尾不完整的 MCU 单独取整（与 TJpgDec 一致）
+static uint32_t jpeg_scaled(uint32_t size, uint32_t mcu, int scale) {
+    return size / mcu * (mcu >> scale) + ((size % mcu) >> scale);
+}
+
+static bool decode_jpeg(image_src_t *src, int max_width, int max_height,
+                        epub_image_t *image) {
+    if (!src_seek(src, 0)) {
+        return false;
+    }
+    void *work = heap_stats_malloc(HEAP_TAG_IMAGE, JPEG_WORK_SIZE);
+    if (work == NULL) {
+        ESP_LOGE(TAG, "No memory for JPEG decoder");
+        return false;
+    }
+    jpeg_ctx_t ctx = {.src = src};
+    JDEC jd;
+    JRESULT rc = jd_prepare(&jd, jpeg_input, work, JPEG_WORK_SIZE, &ctx);
+    if (rc != JDR_OK) {
+        ESP_LOGW(TAG, "Unsupported JPEG (%d)", (int)rc);  // 渐进式 JPEG 为 JDR_FMT3
+        heap_stats_free(HEAP_TAG_IMAGE, work);
+        return false;
+    }
+
+    uint16_t dst_width, dst_height;
+    fit_size(jd.width, jd.height, max_width, max_height, &dst_width, &dst_height);
+    const uint32_t mcu_w = jd.msx * 8u;
+    const uint32_t mcu_h = jd.msy * 8u;
+    // 选能直接解出不小于目标尺寸的最大缩放，剩下的交给盒式缩小
+    int scale = 0;
+#if JD_USE_SCALE
+    for (scale = 3; scale > 0; scale--) {
+        if (jpeg_scaled(jd.width, mcu_w, scale) >= dst_width &&
+            jpeg_scaled(jd.height, mcu_h, scale) >= dst_height) {
+            break;
+        }
+    }
+#endif
+    const uint32_t src_width = jpeg_scaled(jd.width, mcu_w, scale);
+    const uint32_t src_height = jpeg_scaled(jd.height, mcu_h, scale);
+
+    bool ok = false;
+    ctx.band_width = (uint16_t)src_width;
+    ctx.band = heap_stats_malloc(HEAP_TAG_IMAGE, src_width * (mcu_h >> scale));
+    if (ctx.band == NULL) {
+        ESP_LOGE(TAG, "No memory for JPEG band (%u px wide)", (unsigned)src_width);
+    } else if (sink_init(&ctx.sink, src, src_width, src_height, dst_width, dst_height, image)) {
+        rc = jd_decomp(&jd, jpeg_output, (uint8_t)scale);
+        if (rc != JDR_OK) {
+            ESP_LOGW(TAG, "JPEG decode failed (%d)", (int)rc);
+        }
+        ok = sink_finish(&ctx.sink, rc == JDR_OK);
+        ESP_LOGD(TAG, "JPEG %ux%u, scale 1/%d -> %ux%u", jd.width, jd.height, 1 << scale,
+                 dst_width, dst_height);
+    }
+    heap_stats_free(HEAP_TAG_IMAGE, ctx.band);
+    heap_stats_free(HEAP_TAG_IMAGE, work);
+    return ok;
+}
+#else
+static bool decode_jpeg(image_src_t *src, int max_width, int max_height,
+                        epub_image_t *image) {
+    (void)src; (void)max_width; (void)max_height; (void)image;
+    ESP_LOGW(TAG, "JPEG support disabled (LV_USE_TJPGD)");
+    return false;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// PNG：IDAT 逐块解压，按扫描行反滤波后转成灰度交给缩放（不支持隔行）
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    tinfl_decompressor decomp;
+    uint8_t dict[TINFL_LZ_DICT_SIZE];  // 解压输出的环形窗口
+    uint8_t input[PNG_INPUT_CHUNK];
+    size_t dict_ofs;
+    bool inflate_done;
+
+    uint32_t width;
+    uint32_t height;
+    uint8_t depth;
+    uint8_t color_type;
+    uint8_t channels;
+    uint8_t pixel_bytes;     // 反滤波时与左侧像素的距离
+    uint8_t palette[256];    // 调色板的灰度（已按 tRNS 与白色合成）
+    uint8_t palette_rgb[256 * 3];
+    uint16_t palette_size;
+
+    uint32_t row_bytes;
+    uint8_t *rows;           // 两条扫描行与灰度行，一次分配
+    uint8_t *cur;            // 正在填充的扫描行
+    uint8_t *prev;           // 上一扫描行（首行为全 0）
+    uint8_t *gray;
+    uint32_t fill;
+    uint8_t filter;
+    bool have_filter;
+    uint32_t rows_done;
+    bool failed;
+    image_sink_t sink;
+} png_t;
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+    const int p = a + b - c;
+    const int pa = abs(p - a);
+    const int pb = abs(p - b);
+    const int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+static bool png_unfilter(png_t *png) {
+    uint8_t *cur = png->cur;
+    const uint8_t *prev = png->prev;
+    const uint32_t n = png->row_bytes;
+    const uint32_t bpp = png->pixel_bytes;
+    switch (png->filter) {
+        case 0:
+            break;
+        case 1:
+            for (uint32_t i = bpp; i < n; i++) cur[i] += cur[i - bpp];
+            break;
+        case 2:
+            for (uint32_t i = 0; i < n; i++) cur[i] += prev[i];
+            break;
+        case 3:
+            for (uint32_t i = 0; i < n; i++) {
+                cur[i] += (uint8_t)(((i >= bpp ? cur[i - bpp] : 0) + prev[i]) >> 1);
+            }
+            break;
+        case 4:
+            for (uint32_t i = 0; i < n; i++) {
+                cur[i] += i >= bpp ? paeth(cur[i - bpp], prev[i], prev[i - bpp]) : prev[i];
+            }
+            break;
+        default:
+            ESP_LOGW(TAG, "Bad PNG filter %u", png->filter);
+            return false;
+    }
+    return true;
+}
+
+// 第 x 个像素的第 c 个通道，统一为 8 位（16 位取高字节，低位深按比例放大）
+static uint8_t png_sample(const png_t *png, uint32_t x, uint32_t c) {
+    const uint8_t *row = png->cur;
+    switch (png->depth) {
+        case 16:
+            return row[(x * png->channels + c) * 2];
+        case 8:
+            return row[x * png->channels + c];
+        default: {
+            const uint32_t bit = x * png->depth;
+            const uint8_t mask = (uint8_t)((1u << png->depth) - 1);
+            const uint8_t v = (row[bit >> 3] >> (8 - png->depth - (bit & 7))) & mask;
+            return png->color_type == 3 ? v : (uint8_t)(v * 255 / mask);
+        }
+    }
+}
+
+static void png_row_to_gray(png_t *png) {
+    for (uint32_t x = 0; x < png->width; x++) {
+        uint8_t v;
+        switch (png->color_type) {
+            case 0:
+                v = png_sample(png, x, 0);
+                break;
+            case 2:
+                v = luma(png_sample(png, x, 0), png_sample(png, x, 1), png_sample(png, x, 2));
+                break;
+            case 3:
+                v = png->palette[png_sample(png, x, 0)];
+                break;
+            case 4:
+                v = over_white(png_sample(png, x, 0), png_sample(png, x, 1));
+                break;
+            default:
+                v = over_white(luma(png_sample(png, x, 0), png_sample(png, x, 1),
+                                    png_sample(png, x, 2)),
+                               png_sample(png, x, 3));
+                break;
+        }
+        png->gray[x] = v;
+    }
+}
+
+// 解压出的数据按扫描行（1 字节滤波类型 + row_bytes 字节像素）拼接
+static void png_consume(png_t *png, const uint8_t *data, size_t len) {
+    while (len > 0 && !png->failed && png->rows_done < png->height) {
+        if (!png->have_filter) {
+            png->filter = *data++;
+            len--;
+            png->have_filter = true;
+            continue;
+        }
+        size_t n = png->row_bytes - png->fill;
+        if (n > len) n = len;
+        memcpy(png->cur + png->fill, data, n);
+        png->fill += (uint32_t)n;
+        data += n;
+        len -= n;
+        if (png->fill == png->row_bytes) {
+            if (!png_unfilter(png)) {
+                png->failed = true;
+                return;
+            }
+            png_row_to_gray(png);
+            sink_push_row(&png->sink, png->gray);
+            uint8_t *t = png->prev;
+            png->prev = png->cur;
+            png->cur = t;
+            png->fill = 0;
+            png->have_filter = false;
+            png->rows_done++;
+        }
+    }
+}
+
+static bool png_inflate(png_t *png, size_t in_len) {
+    size_t in_pos = 0;
+    while (!png->inflate_done) {
+        size_t in_bytes = in_len - in_pos;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - png->dict_ofs;
+        const tinfl_status status = tinfl_decompress(
+            &png->decomp, &png->input[in_pos], &in_bytes, png->dict, &png->dict[png->dict_ofs],
+            &out_bytes, TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        in_pos += in_bytes;
+        if (out_bytes > 0) {
+            png_consume(png, &png->dict[png->dict_ofs], out_bytes);
+            png->dict_ofs = (png->dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+        if (status == TINFL_STATUS_DONE) {
+            png->inflate_done = true;
+        } else if (status < 0) {
+            ESP_LOGW(TAG, "PNG inflate failed (%d)", (int)status);
+            return false;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+            break;
+        }
+    }
+    return !png->failed;
+}
+
+static bool png_header(png_t *png, const image_src_t *src, const uint8_t *ihdr, int max_width,
+                       int max_height, epub_image_t *image) {
+    static const uint8_t CHANNELS[7] = {1, 0, 3, 1, 2, 0, 4};
+    png->width = read_be32(ihdr);
+    png->height = read_be32(ihdr + 4);
+    png->depth = ihdr[8];
+    png->color_type = ihdr[9];
+    if (png->color_type > 6 || CHANNELS[png->color_type] == 0 || ihdr[12] != 0 ||
+        png->width == 0 || png->height == 0 || png->width > IMAGE_MAX_SOURCE_WIDTH ||
+        png->height > UINT16_MAX ||
+        !(png->depth == 8 || png->depth == 16 ||
+          (png->depth < 8 && (png->color_type == 0 || png->color_type == 3) &&
+           (png->depth == 1 || png->depth == 2 || png->depth == 4)))) {
+        ESP_LOGW(TAG, "Unsupported PNG: %ux%u depth %u type %u interlace %u",
+                 (unsigned)png->width, (unsigned)png->height, png->depth, png->color_type, ihdr[12]);
+        return false;
+    }
+    png->channels = CHANNELS[png->color_type];
+    const uint32_t bits = png->width * png->channels * png->depth;
+    png->row_bytes = (bits + 7) / 8;
+    png->pixel_bytes = (uint8_t)((png->channels * png->depth + 7) / 8);
+
+    png->rows = calloc(2 * png->row_bytes + png->width, 1);
+    if (png->rows == NULL) {
+        ESP_LOGE(TAG, "No memory for PNG rows (%u bytes)", (unsigned)png->row_bytes);
+        return false;
+    }
+    png->prev = png->rows;
+    png->cur = png->prev + png->row_bytes;
+    png->gray = png->cur + png->row_bytes;
+
+    uint16_t dst_width, dst_height;
+    fit_size(png->width, png->height, max_width, max_height, &dst_width, &dst_height);
+    return sink_init(&png->sink, src, png->width, png->height, dst_width, dst_height, image);
+}
+
+static void png_palette(png_t *png, const uint8_t *alpha, uint32_t alpha_count) {
+    for (uint32_t i = 0; i < png->palette_size; i++) {
+        const uint8_t *c = &png->palette_rgb[i * 3];
+        const uint8_t v = luma(c[0], c[1], c[2]);
+        png->palette[i] = i < alpha_count ? over_white(v, alpha[i]) : v;
+    }
+}
+
+// 调用时 PNG 签名已读过
+static bool decode_png(image_src_t *src, int max_width, int max_height,
+                       epub_image_t *image) {
+    png_t *png = calloc(1, sizeof(png_t));
+    if (png == NULL) {
+        ESP_LOGE(TAG, "No memory for PNG decoder (%u bytes)", (unsigned)sizeof(png_t));
+        return false;
+    }
+    tinfl_init(&png->decomp);
+
+    bool have_header = false;
+    bool ok = false;
+    for (;;) {
+        uint8_t chunk[8];
+        if (!read_exact(src, chunk, sizeof(chunk))) {
+            ESP_LOGW(TAG, "Truncated PNG");
+            break;
+        }
+        const uint32_t len = read_be32(chunk);
+        const uint8_t *type = chunk + 4;
+        if (len > 0x7FFFFFFFu) {
+            break;
+        }
+
+        if (memcmp(type, "IHDR", 4) == 0) {
+            uint8_t ihdr[13];
+            if (have_header || len != sizeof(ihdr) || !read_exact(src, ihdr, sizeof(ihdr)) ||
+                !png_header(png, src, ihdr, max_width, max_height, image)) {
+                break;
+            }
+            have_header = true;
+        } else if (!have_header) {
+            ESP_LOGW(TAG, "PNG without IHDR");
+            break;
+        } else if (memcmp(type, "PLTE", 4) == 0 && len <= sizeof(png->palette_rgb) && len % 3 == 0) {
+            if (!read_exact(src, png->palette_rgb, len)) {
+                break;
+            }
+            png->palette_size = (uint16_t)(len / 3);
+            png_palette(png, NULL, 0);
+        } else if (memcmp(type, "tRNS", 4) == 0 && png->color_type == 3 && len <= 256) {
+            if (!read_exact(src, png->input, len)) {
+                break;
+            }
+            png_palette(png, png->input, len);
+        } else if (memcmp(type, "IDAT", 4) == 0) {
+            uint32_t left = len;
+            bool failed = false;
+            while (left > 0 && !png->inflate_done) {
+                const size_t n = left < PNG_INPUT_CHUNK ? left : PNG_INPUT_CHUNK;
+                if (!read_exact(src, png->input, n) || !png_inflate(png, n)) {
+                    failed = true;
+                    break;
+                }
+                left -= (uint32_t)n;
+            }
+            if (failed || (left > 0 && !skip_bytes(src, left))) {
+                break;
+            }
+        } else if (memcmp(type, "IEND", 4) == 0) {
+            break;
+        } else if (!skip_bytes(src, len)) {
+            break;
+        }
+
+        // 所有扫描行都已收到就不必再读后面的块
+        if (png->rows_done == png->height && png->height > 0) {
+            break;
+        }
+        if (!skip_bytes(src, 4)) {  // CRC 不校验
+            break;
+        }
+    }
+
+    if (have_header) {
+        ok = sink_finish(&png->sink, png->rows_done == png->height && !png->failed);
+        if (!ok) {
+            ESP_LOGW(TAG, "PNG incomplete: %u/%u rows", (unsigned)png->rows_done,
+                     (unsigned)png->height);
+        }
+    }
+    free(png->rows);
+    free(png);
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+
+static void make_key(epub_cache_key_t *key, const char *epub_path, const char *image_path,
+                     int max_width, int max_height) {
+    memset(key, 0, sizeof(*key));
+    strncpy(key->epub_path, epub_path, sizeof(key->epub_path) - 1);
+    snprintf(key->content_path, sizeof(key->content_path), "%s@%dx%d", image_path, max_width,
+             max_height);
+    key->type = EPUB_CACHE_IMAGE;
+}
+
+static bool load_cached(const epub_cache_key_t *key, int max_width, int max_height,
+                        epub_image_t *image) {
+    const long size = epub_cache_item_size(key);
+    if (size <= (long)sizeof(image_cache_head_t)) {
+        return false;
+    }
+    uint8_t *data = heap_stats_malloc(HEAP_TAG_IMAGE, size);
+    if (data == NULL) {
+        return false;
+    }
+    const image_cache_head_t *head = (const image_cache_head_t *)data;
+    if (epub_cache_read(key, data, size) != size || head->version != IMAGE_CACHE_VERSION ||
+        head->width == 0 || head->height == 0 || head->width > max_width ||
+        head->height > max_height ||
+        (size_t)size != sizeof(*head) + (size_t)(head->width + 7) / 8 * head->height) {
+        heap_stats_free(HEAP_TAG_IMAGE, data);
+        return false;
+    }
+    image->data = data;
+    image->width = head->width;
+    image->height = head->height;
+    image->stride = (uint16_t)((head->width + 7) / 8);
+    image->bpp = 1;
+    image->bits = data + sizeof(*head);
+    return true;
+}
+
+// 按文件头识别格式并解码（读取位置在开头）
+static bool decode_src(image_src_t *src, const char *name, int max_width, int max_height,
+                       epub_image_t *image) {
+    uint8_t magic[8];
+    if (!read_exact(src, magic, sizeof(magic))) {
+        return false;
+    }
+    bool ok = false;
+    const uint32_t t0 = lv_tick_get();
+    power_manager_lock(POWER_LOCK_CPU);
+    if (memcmp(magic, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0) {
+        ok = decode_png(src, max_width, max_height, image);
+    } else if (magic[0] == 0xFF && magic[1] == 0xD8) {
+        ok = decode_jpeg(src, max_width, max_height, image);
+    } else {
+        ESP_LOGW(TAG, "Unsupported image format: %s", name);
+    }
+    power_manager_unlock(POWER_LOCK_CPU);
+    if (ok) {
+        ESP_LOGI(TAG, "Decoded %s -> %ux%u %ubpp in %lu ms", name, image->width, image->height,
+                 image->bpp, (unsigned long)lv_tick_elaps(t0));
+    }
+    return ok;
+}
+
+bool epub_image_load(const epub_reader_t *reader, const char *image_path, int max_width,
+                     int max_height, epub_image_t *image) {
+    if (image == NULL) {
+        return false;
+    }
+    memset(image, 0, sizeof(*image));
+    if (reader == NULL || !reader->is_open || image_path == NULL || max_width <= 0 ||
+        max_height <= 0 || max_width > UINT16_MAX || max_height > UINT16_MAX) {
+        return false;
+    }
+
+    epub_cache_key_t key;
+    make_key(&key, reader->epub_path, image_path, max_width, max_height);
+    if (load_cached(&key, max_width, max_height, image)) {
+        ESP_LOGD(TAG, "Cached image %s: %ux%u", image_path, image->width, image->height);
+        return true;
+    }
+
+    epub_zip_t *zip = epub_zip_open(reader->epub_path);
+    if (zip == NULL) {
+        return false;
+    }
+    bool ok = false;
+    epub_zip_file_info_t file;
+    epub_zip_stream_t *stream = NULL;
+    if (!epub_zip_find_file(zip, image_path, &file)) {
+        ESP_LOGW(TAG, "Image not found: %s", image_path);
+    } else if ((stream = epub_zip_stream_open(zip, &file)) != NULL) {
+        image_src_t src = {.zip = stream};
+        ok = decode_src(&src, image_path, max_width, max_height, image);
+    }
+    if (stream != NULL) {
+        epub_zip_stream_close(stream);
+    }
+    epub_zip_close(zip);
+
+    if (ok) {
+        epub_cache_write(&key, image->data,
+                         sizeof(image_cache_head_t) + (size_t)image->stride * image->height);
+    }
+    return ok;
+}
+
+// 照片色调表：小图直方图两端各裁掉 PHOTO_CLIP_PERMILLE 后线性拉伸到 0..255，再提亮中间调。
+// 只用整数运算；RV32IMC 没有打包 SIMD，每个输出像素查一次 256 字节表已是最省的做法
+static void photo_tone(image_src_t *src, const char *name, uint8_t tone[256]) {
+    int lo = 0;
+    int hi = 255;
+    uint32_t *hist = calloc(256, sizeof(uint32_t));
+    epub_image_t sample = {.bpp = 1};
+    if (hist != NULL) {
+        src->hist = hist;
+        if (decode_src(src, name, PHOTO_SAMPLE_SIZE, PHOTO_SAMPLE_SIZE, &sample)) {
+            uint32_t total = 0;
+            for (int i = 0; i < 256; i++) {
+                total += hist[i];
+            }
+            const uint32_t clip = total * PHOTO_CLIP_PERMILLE / 1000;
+            uint32_t acc = 0;
+            for (lo = 0; lo < 255 && acc + hist[lo] <= clip; lo++) {
+                acc += hist[lo];
+            }
+            acc = 0;
+            for (hi = 255; hi > lo && acc + hist[hi] <= clip; hi--) {
+                acc += hist[hi];
+            }
+            // 区间太窄时以中点向两边放宽
+            if (hi - lo < PHOTO_MIN_RANGE) {
+                const int mid = (lo + hi) / 2;
+                lo = mid - PHOTO_MIN_RANGE / 2;
+                hi = mid + PHOTO_MIN_RANGE / 2;
+                if (lo < 0) { hi -= lo; lo = 0; }
+                if (hi > 255) { lo -= hi - 255; hi = 255; }
+            }
+        }
+        epub_image_free(&sample);
+        src->hist = NULL;
+        free(hist);
+    }
+    for (int x = 0; x < 256; x++) {
+        int v = x <= lo ? 0 : x >= hi ? 255 : (x - lo) * 255 / (hi - lo);
+        v += PHOTO_MIDTONE_LIFT * v * (255 - v) / (255 * 256);
+        tone[x] = (uint8_t)(v > 255 ? 255 : v);
+    }
+    ESP_LOGD(TAG, "Photo tone for %s: stretch %d..%d", name, lo, hi);
+}
+
+// 按位深解码：2bpp 先解一遍小图得到色调表，再从头解出结果
+static bool decode_toned(image_src_t *src, const char *name, int max_width, int max_height,
+                         uint8_t bpp, epub_image_t *image) {
+    image->bpp = bpp;
+    uint8_t tone[256];
+    if (bpp == 2) {
+        photo_tone(src, name, tone);
+        src->tone = tone;
+    }
+    const bool ok = src_seek(src, 0) && decode_src(src, name, max_width, max_height, image);
+    src->tone = NULL;
+    if (!ok) {
+        epub_image_free(image);
+    }
+    return ok;
+}
+
+bool epub_image_decode_file(const char *path, int max_width, int max_height, uint8_t bpp,
+                            epub_image_t *image) {
+    if (image == NULL) {
+        return false;
+    }
+    memset(image, 0, sizeof(*image));
+    if (path == NULL || max_width <= 0 || max_height <= 0 || max_width > UINT16_MAX ||
+        max_height > UINT16_MAX || (bpp != 1 && bpp != 2)) {
+        return false;
+    }
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        return false;
+    }
+    setvbuf(f, NULL, _IOFBF, IMAGE_FILE_BUF);
+    image_src_t src = {.file = f};
+    const bool ok = decode_toned(&src, path, max_width, max_height, bpp, image);
+    fclose(f);
+    return ok;
+}
+
+bool epub_image_decode_zip(epub_zip_t *zip, const epub_zip_file_info_t *file, int max_width,
+                           int max_height, uint8_t bpp, epub_image_t *image) {
+    if (image == NULL) {
+        return false;
+    }
+    memset(image, 0, sizeof(*image));
+    if (zip == NULL || file == NULL || max_width <= 0 || max_height <= 0 ||
+        max_width > UINT16_MAX || max_height > UINT16_MAX || (bpp != 1 && bpp != 2)) {
+        return false;
+    }
+    epub_zip_stream_t *stream = epub_zip_stream_open(zip, file);
+    if (stream == NULL) {
+        return false;
+    }
+    image_src_t src = {.zip = stream};
+    const bool ok = decode_toned(&src, file->filename, max_width, max_height, bpp, image);
+    epub_zip_stream_close(stream);
+    return ok;
+}
+
+void epub_image_free(epub_image_t *image) {
+    if (image != NULL) {
+        heap_stats_free(HEAP_TAG_IMAGE, image->data);
+        memset(image, 0, sizeof(*image));
+    }
+}
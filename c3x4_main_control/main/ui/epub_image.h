@@ -0,0 +1,90 @@
+/**
+ * @file epub_image.h
+ * @brief EPUB 内嵌图片解码 - 边解码边缩小到页面尺寸，抖动为 1bpp 位图并按书缓存
+ *
+ * 图片通过 ZIP 流分块读取，不整体载入内存：JPEG 用 LVGL 自带的 TJpgDec，按缩放比
+ * 1/2、1/4、1/8 直接解出接近目标的尺寸，再逐个 MCU 行交给缩放；PNG 逐行解压、反滤波。
+ * 两者都以灰度行喂给同一个盒式缩放 + Floyd-Steinberg 抖动，内存只与目标宽度和一行
+ * 源图像有关。结果写入 EPUB 缓存（EPUB_CACHE_IMAGE，键包含目标尺寸），再次显示时
+ * 直接读出位图，不再解码。
+ *
+ * 同一套解码也用于 SD 卡上的普通图片文件（图片浏览器，可输出 2bpp 四级灰）和 CBZ 漫画页
+ */
+
+#ifndef EPUB_IMAGE_H
+#define EPUB_IMAGE_H
+
+#include "epub_parser.h"
+#include "epub_zip.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 解码后的图片：逻辑方向，逐行存放，高位在左。
+// 1bpp 时 1 为白色；2bpp 时每像素 0 黑 .. 3 白
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;         // 每行字节数
+    uint8_t bpp;             // 1 或 2
+    uint8_t *bits;           // 指向 data 中的位图
+    void *data;              // 缓存记录（头 + 位图），整体写入 EPUB 缓存
+} epub_image_t;
+
+/**
+ * @brief 加载图片（优先读缓存，未命中时解码并写入缓存）
+ *
+ * 图片按比例缩小到能放进 max_width x max_height，不放大
+ *
+ * @param reader 阅读器实例指针
+ * @param image_path 图片在 EPUB 内的路径
+ * @param max_width 最大宽度
+ * @param max_height 最大高度
+ * @param image 输出，用完调用 epub_image_free()
+ * @return true 成功，false 格式不支持（渐进式 JPEG、隔行 PNG 等）或读取失败
+ */
+bool epub_image_load(const epub_reader_t *reader, const char *image_path, int max_width,
+                     int max_height, epub_image_t *image);
+
+/**
+ * @brief 解码 SD 卡上的 PNG/JPEG 文件（不经过 LVGL 解码器与图片缓存，不写 EPUB 缓存）
+ *
+ * @param path 文件路径（/sdcard/...）
+ * @param max_width 最大宽度
+ * @param max_height 最大高度
+ * @param bpp 输出位深：1（单色抖动）或 2（照片模式：先按小图直方图拉伸对比度、提亮中间调，
+ *            再抖动到四级灰；多解码一遍小图，结果通常写入 image_cache）
+ * @param image 输出，用完调用 epub_image_free()
+ * @return true 成功，false 格式不支持或读取失败
+ */
+bool epub_image_decode_file(const char *path, int max_width, int max_height, uint8_t bpp,
+                            epub_image_t *image);
+
+/**
+ * @brief 解码 ZIP 内的 PNG/JPEG 条目（CBZ 漫画页；不写 EPUB 缓存，缓存由调用方负责）
+ *
+ * @param zip 已打开的 ZIP（解码期间独占其文件句柄）
+ * @param file 条目信息
+ * @param max_width 最大宽度
+ * @param max_height 最大高度
+ * @param bpp 1 或 2，见 epub_image_decode_file
+ * @param image 输出，用完调用 epub_image_free()
+ * @return true 成功，false 格式不支持或读取失败
+ */
+bool epub_image_decode_zip(epub_zip_t *zip, const epub_zip_file_info_t *file, int max_width,
+                           int max_height, uint8_t bpp, epub_image_t *image);
+
+/**
+ * @brief 释放图片
+ * @param image 图片
+ */
+void epub_image_free(epub_image_t *image);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_IMAGE_H
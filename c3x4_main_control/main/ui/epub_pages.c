@@ -0,0 +1,660 @@
+/**
+ * @file epub_pages.c
+ * @brief EPUB 章节分页实现
+ */
+
+#include "epub_pages.h"
+#include "../heap_stats.h"
+#include "../lz_block.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "EPUB_PAGES";
+
+#define PAGES_INITIAL_CAPACITY 32
+#define INDENT_MAX_EMS         4
+
+static const char IDEOGRAPHIC_SPACE[] = "\xE3\x80\x80";  // U+3000，宽度恰为 1em
+static const char IMAGE_PLACEHOLDER[] = "[图片]";
+static const char LIST_BULLET[] = "\xE2\x80\xA2 ";         // "• "
+
+static int indent_ems(const epub_text_block_t *block) {
+    if (block->type != EPUB_TEXT_BLOCK_NORMAL ||
+        (block->attr.flags & (EPUB_PARA_CONTINUED | EPUB_PARA_PRE | EPUB_PARA_LIST_ITEM))) {
+        return 0;
+    }
+    if (block->attr.indent == EPUB_INDENT_AUTO) {
+        return 2;
+    }
+    const int ems = block->attr.indent > 0 ? (block->attr.indent + 1) / 2 : 0;
+    return ems > INDENT_MAX_EMS ? INDENT_MAX_EMS : ems;
+}
+
+// 展平正文的写入端：整段写入 text，或按块压缩（块先在 stage 中攒满）。
+// 一次展平（epub_pages_init）时各容量事先算好；边解析边追加时按需扩容
+typedef struct {
+    epub_pages_t *pages;
+    char *stage;             // 压缩时攒块的缓冲区（一次展平时借用解压窗口）
+    uint32_t len;            // 已写入的正文字节
+    uint32_t text_cap;       // 整段保存时 text 的容量（含结尾 NUL）
+    uint32_t packed_used;
+    uint32_t packed_cap;
+    int block_cap;           // block_offsets 的项数
+    int image_cap;
+    uint32_t srcs_used;
+    uint32_t srcs_cap;
+    uint16_t *table;         // 压缩工作区
+    bool first;              // 下一个文本块是章节的第一块
+    bool after_heading;
+    bool ok;
+} text_sink_t;
+
+// 边解析边追加时的写入状态（epub_pages_begin 到 epub_pages_end）
+struct epub_pages_builder {
+    text_sink_t sink;
+    int images_resolved;     // images 中页尾（end）已确定的项数
+    char stage[EPUB_PAGES_BLOCK];
+};
+
+static uint32_t block_raw_size(const epub_pages_t *pages, int block) {
+    return block < pages->block_count - 1 ? EPUB_PAGES_BLOCK
+                                          : pages->text_len - (uint32_t)block * EPUB_PAGES_BLOCK;
+}
+
+// 压缩攒好的一块；压缩后不变小的块原样保存（长度等于原始长度即为原样）
+static void sink_flush_block(text_sink_t *sink, uint32_t size) {
+    epub_pages_t *pages = sink->pages;
+    if (sink->packed_used + size > sink->packed_cap) {
+        const uint32_t cap = sink->packed_cap + sink->packed_cap / 2 + size;
+        uint8_t *packed = heap_stats_realloc(HEAP_TAG_EPUB, pages->packed, cap);
+        if (packed == NULL) {
+            sink->ok = false;
+            return;
+        }
+        pages->packed = packed;
+        sink->packed_cap = cap;
+    }
+    if (pages->block_count + 2 > sink->block_cap) {
+        const int cap = sink->block_cap * 2;
+        uint32_t *offsets = heap_stats_realloc(HEAP_TAG_EPUB, pages->block_offsets, cap * sizeof(uint32_t));
+        if (offsets == NULL) {
+            sink->ok = false;
+            return;
+        }
+        pages->block_offsets = offsets;
+        sink->block_cap = cap;
+    }
+    uint8_t *dst = pages->packed + sink->packed_used;
+    size_t n = lz_block_encode((const uint8_t *)sink->stage, size, dst, size - 1, sink->table);
+    if (n == 0) {
+        memcpy(dst, sink->stage, size);
+        n = size;
+    }
+    sink->packed_used += (uint32_t)n;
+    pages->block_offsets[++pages->block_count] = sink->packed_used;
+}
+
+// 整段保存的正文换到 cap 字节的新缓冲区。正文控件可能还指着旧缓冲区里的当前页，
+// 旧缓冲区留到下一次 epub_pages_text 再释放（其间换下的缓冲区没人指着，直接释放）
+static bool sink_move_text(text_sink_t *sink, uint32_t cap) {
+    epub_pages_t *pages = sink->pages;
+    char *text = heap_stats_malloc(HEAP_TAG_EPUB, cap);
+    if (text == NULL) {
+        return false;
+    }
+    memcpy(text, pages->text, sink->len);
+    if (pages->retired == NULL) {
+        pages->retired = pages->text;
+    } else {
+        heap_stats_free(HEAP_TAG_EPUB, pages->text);
+    }
+    pages->text = text;
+    sink->text_cap = cap;
+    return true;
+}
+
+static void sink_write(text_sink_t *sink, const char *s, size_t len) {
+    epub_pages_t *pages = sink->pages;
+    if (!sink->ok) {
+        return;
+    }
+    if (pages->text != NULL) {
+        if (sink->len + len + 1 > sink->text_cap &&
+            !sink_move_text(sink, sink->len + (uint32_t)len + 1 + sink->text_cap / 2)) {
+            sink->ok = false;
+            return;
+        }
+        memcpy(pages->text + sink->len, s, len);
+        sink->len += (uint32_t)len;
+        return;
+    }
+    while (len > 0 && sink->ok) {
+        const uint32_t used = sink->len % EPUB_PAGES_BLOCK;
+        uint32_t n = EPUB_PAGES_BLOCK - used;
+        if (n > len) {
+            n = (uint32_t)len;
+        }
+        memcpy(sink->stage + used, s, n);
+        sink->len += n;
+        s += n;
+        len -= n;
+        if (used + n == EPUB_PAGES_BLOCK) {
+            sink_flush_block(sink, EPUB_PAGES_BLOCK);
+        }
+    }
+}
+
+// 记下图片页：链接依次存放在链接池中（池扩容时各图片的指针随之平移）
+static void sink_add_image(text_sink_t *sink, uint32_t offset, const char *src) {
+    epub_pages_t *pages = sink->pages;
+    const uint32_t src_len = (uint32_t)strlen(src) + 1;
+    if (pages->image_count == sink->image_cap) {
+        const int cap = sink->image_cap > 0 ? sink->image_cap * 2 : 8;
+        epub_page_image_t *images = heap_stats_realloc(HEAP_TAG_EPUB, pages->images,
+                                                       cap * sizeof(epub_page_image_t));
+        if (images == NULL) {
+            sink->ok = false;
+            return;
+        }
+        pages->images = images;
+        sink->image_cap = cap;
+    }
+    if (sink->srcs_used + src_len > sink->srcs_cap) {
+        const uint32_t cap = sink->srcs_cap * 2 + src_len + 256;
+        const uintptr_t old = (uintptr_t)pages->image_srcs;
+        char *srcs = heap_stats_realloc(HEAP_TAG_EPUB, pages->image_srcs, cap);
+        if (srcs == NULL) {
+            sink->ok = false;
+            return;
+        }
+        for (int i = 0; i < pages->image_count; i++) {
+            pages->images[i].src = srcs + ((uintptr_t)pages->images[i].src - old);
+        }
+        pages->image_srcs = srcs;
+        sink->srcs_cap = cap;
+    }
+    epub_page_image_t *image = &pages->images[pages->image_count++];
+    image->offset = offset;
+    image->end = offset + (uint32_t)(sizeof(IMAGE_PLACEHOLDER) - 1);  // 确定前的下限
+    image->src = pages->image_srcs + sink->srcs_used;
+    memcpy(pages->image_srcs + sink->srcs_used, src, src_len);
+    sink->srcs_used += src_len;
+}
+
+static void emit(text_sink_t *sink, uint32_t *n, const char *s, size_t len) {
+    if (sink != NULL) {
+        sink_write(sink, s, len);
+    }
+    *n += (uint32_t)len;
+}
+
+// 展平一个文本块；sink 为 NULL 时只计算长度
+static uint32_t flatten_block(const epub_text_block_t *block, bool first, bool after_heading,
+                              text_sink_t *sink) {
+    uint32_t n = 0;
+
+    if (!first && !(block->attr.flags & EPUB_PARA_CONTINUED)) {
+        // 标题前后各空一行
+        if (after_heading || block->type == EPUB_TEXT_BLOCK_HEADING) {
+            emit(sink, &n, "\n", 1);
+        }
+        emit(sink, &n, "\n", 1);
+    }
+    if (block->type == EPUB_TEXT_BLOCK_IMAGE) {
+        emit(sink, &n, IMAGE_PLACEHOLDER, sizeof(IMAGE_PLACEHOLDER) - 1);
+        return n;
+    }
+    if (block->attr.flags & EPUB_PARA_LIST_ITEM) {
+        emit(sink, &n, LIST_BULLET, sizeof(LIST_BULLET) - 1);
+    }
+    for (int i = indent_ems(block); i > 0; i--) {
+        emit(sink, &n, IDEOGRAPHIC_SPACE, sizeof(IDEOGRAPHIC_SPACE) - 1);
+    }
+    emit(sink, &n, block->text, block->text_length);
+    return n;
+}
+
+// 展平一个文本块写入正文；图片的占位行是最后写入的内容
+static void sink_block(text_sink_t *sink, const epub_text_block_t *block) {
+    flatten_block(block, sink->first, sink->after_heading, sink);
+    if (sink->ok && block->type == EPUB_TEXT_BLOCK_IMAGE && block->image_src != NULL) {
+        sink_add_image(sink, sink->len - (uint32_t)(sizeof(IMAGE_PLACEHOLDER) - 1), block->image_src);
+    }
+    sink->after_heading = block->type == EPUB_TEXT_BLOCK_HEADING;
+    sink->first = false;
+}
+
+// 正文放得进堆余量的 1/EPUB_PAGES_RAW_SHARE 时整段常驻；否则分块压缩常驻，
+// 大章节也只占压缩后的大小加一个窗口。stage 为 NULL 时在解压窗口中攒块
+static bool alloc_text(text_sink_t *sink, uint32_t total, char *stage) {
+    epub_pages_t *pages = sink->pages;
+    const uint32_t blocks = (total + EPUB_PAGES_BLOCK - 1) / EPUB_PAGES_BLOCK;
+    if (blocks <= EPUB_PAGES_WINDOW_BLOCKS || total + 1 <= heap_stats_cache_budget(0, EPUB_PAGES_RAW_SHARE)) {
+        pages->text = heap_stats_malloc(HEAP_TAG_EPUB, total + 1);
+        sink->text_cap = total + 1;
+        return pages->text != NULL;
+    }
+    pages->window = heap_stats_malloc(HEAP_TAG_EPUB, EPUB_PAGES_WINDOW_BLOCKS * EPUB_PAGES_BLOCK);
+    pages->block_offsets = heap_stats_malloc(HEAP_TAG_EPUB, (blocks + 1) * sizeof(uint32_t));
+    sink->table = heap_stats_malloc(HEAP_TAG_EPUB, LZ_BLOCK_HASH_SIZE * sizeof(uint16_t));
+    sink->packed_cap = total / 2 + EPUB_PAGES_BLOCK;
+    pages->packed = heap_stats_malloc(HEAP_TAG_EPUB, sink->packed_cap);
+    if (pages->window == NULL || pages->block_offsets == NULL || sink->table == NULL ||
+        pages->packed == NULL) {
+        heap_stats_free(HEAP_TAG_EPUB, sink->table);
+        sink->table = NULL;
+        return false;
+    }
+    sink->block_cap = (int)blocks + 1;
+    sink->stage = stage != NULL ? stage : pages->window;
+    pages->block_offsets[0] = 0;
+    return true;
+}
+
+// 写完最后不满的一块并收紧占用；中途内存不足时返回 false（已写入的部分仍然可读）
+static bool sink_finish(text_sink_t *sink) {
+    epub_pages_t *pages = sink->pages;
+    if (pages->text != NULL) {
+        pages->text_len = sink->len;
+        pages->text[sink->len] = '\0';
+        return sink->ok;
+    }
+    if (sink->ok && sink->len % EPUB_PAGES_BLOCK != 0) {
+        sink_flush_block(sink, sink->len % EPUB_PAGES_BLOCK);
+    }
+    heap_stats_free(HEAP_TAG_EPUB, sink->table);
+    sink->table = NULL;
+    if (!sink->ok) {
+        return false;
+    }
+    pages->text_len = sink->len;
+    uint8_t *packed = heap_stats_realloc(HEAP_TAG_EPUB, pages->packed, sink->packed_used);
+    if (packed != NULL) {
+        pages->packed = packed;
+    }
+    ESP_LOGI(TAG, "Chapter %d resident compressed: %u -> %u bytes in %d blocks", sink->pages->chapter_index,
+             (unsigned)sink->len, (unsigned)sink->packed_used, pages->block_count);
+    return true;
+}
+
+static const char *text_at(epub_pages_t *pages, uint32_t start, uint32_t *len);
+
+// 从 pos 起跳过换行（不超过 limit）
+static uint32_t skip_newlines(epub_pages_t *pages, uint32_t pos, uint32_t limit) {
+    while (pos < limit) {
+        uint32_t len = limit - pos;
+        const char *p = text_at(pages, pos, &len);
+        if (p == NULL || len == 0) {
+            break;
+        }
+        uint32_t i = 0;
+        while (i < len && p[i] == '\n') {
+            i++;
+        }
+        pos += i;
+        if (i < len) {
+            break;
+        }
+    }
+    return pos;
+}
+
+// 正文还在追加时，pos 之后要有一整页可能消耗的正文（EPUB_PAGES_LOOKAHEAD）才能确定从 pos 开始的页
+static bool text_ready(const epub_pages_t *pages, uint32_t pos) {
+    return pages->builder == NULL || pages->text_len >= pos + EPUB_PAGES_LOOKAHEAD;
+}
+
+// 确定图片页的页尾（包括占位行之后的段落分隔），返回已确定的项数
+static int resolve_images(epub_pages_t *pages, int from) {
+    int i = from;
+    for (; i < pages->image_count && text_ready(pages, pages->images[i].offset); i++) {
+        pages->images[i].end = skip_newlines(
+            pages, pages->images[i].offset + (uint32_t)(sizeof(IMAGE_PLACEHOLDER) - 1), pages->text_len);
+    }
+    return i;
+}
+
+static void pages_ready(epub_pages_t *pages, int chapter_index) {
+    pages->chapter_index = chapter_index;
+    pages->page_capacity = PAGES_INITIAL_CAPACITY;
+    pages->page_starts[0] = 0;
+    pages->page_count = 1;
+}
+
+// 两遍：先算总长度一次分配，再写入
+bool epub_pages_init(epub_pages_t *pages, int chapter_index, const epub_chapter_blocks_t *blocks) {
+    memset(pages, 0, sizeof(*pages));
+    pages->chapter_index = -1;
+
+    uint32_t total = 0;
+    uint32_t src_total = 0;
+    int image_count = 0;
+    size_t offset = 0;
+    epub_text_block_t block;
+    bool first = true;
+    bool after_heading = false;
+    while (epub_parser_next_block(blocks, &offset, &block)) {
+        total += flatten_block(&block, first, after_heading, NULL);
+        if (block.type == EPUB_TEXT_BLOCK_IMAGE && block.image_src != NULL) {
+            src_total += (uint32_t)strlen(block.image_src) + 1;
+            image_count++;
+        }
+        after_heading = block.type == EPUB_TEXT_BLOCK_HEADING;
+        first = false;
+    }
+
+    text_sink_t sink = {.pages = pages, .first = true, .ok = true};
+    const bool text_ok = alloc_text(&sink, total, NULL);
+    pages->page_starts = heap_stats_malloc(HEAP_TAG_EPUB, PAGES_INITIAL_CAPACITY * sizeof(uint32_t));
+    if (image_count > 0) {
+        pages->images = heap_stats_malloc(HEAP_TAG_EPUB, image_count * sizeof(epub_page_image_t));
+        pages->image_srcs = heap_stats_malloc(HEAP_TAG_EPUB, src_total);
+        sink.image_cap = image_count;
+        sink.srcs_cap = src_total;
+    }
+    if (!text_ok || pages->page_starts == NULL ||
+        (image_count > 0 && (pages->images == NULL || pages->image_srcs == NULL))) {
+        ESP_LOGE(TAG, "No memory for chapter %d (%u bytes)", chapter_index, (unsigned)total);
+        heap_stats_free(HEAP_TAG_EPUB, sink.table);
+        epub_pages_free(pages);
+        return false;
+    }
+
+    offset = 0;
+    while (epub_parser_next_block(blocks, &offset, &block)) {
+        sink_block(&sink, &block);
+    }
+    sink.pages->chapter_index = chapter_index;  // 日志用
+    if (!sink_finish(&sink)) {
+        ESP_LOGE(TAG, "No memory for compressed chapter %d", chapter_index);
+        epub_pages_free(pages);
+        return false;
+    }
+    resolve_images(pages, 0);
+    pages_ready(pages, chapter_index);
+    return true;
+}
+
+bool epub_pages_begin(epub_pages_t *pages, int chapter_index, uint32_t size_hint) {
+    memset(pages, 0, sizeof(*pages));
+    pages->chapter_index = -1;
+
+    struct epub_pages_builder *builder = heap_stats_calloc(HEAP_TAG_EPUB, 1, sizeof(*builder));
+    if (builder == NULL) {
+        return false;
+    }
+    text_sink_t *sink = &builder->sink;
+    sink->pages = pages;
+    sink->first = true;
+    sink->ok = true;
+    const bool text_ok = alloc_text(sink, size_hint, builder->stage);
+    pages->page_starts = heap_stats_malloc(HEAP_TAG_EPUB, PAGES_INITIAL_CAPACITY * sizeof(uint32_t));
+    pages->builder = builder;
+    if (!text_ok || pages->page_starts == NULL) {
+        ESP_LOGE(TAG, "No memory for chapter %d (about %u bytes)", chapter_index, (unsigned)size_hint);
+        epub_pages_free(pages);
+        return false;
+    }
+    pages_ready(pages, chapter_index);
+    return true;
+}
+
+bool epub_pages_append(epub_pages_t *pages, const epub_text_block_t *block) {
+    struct epub_pages_builder *builder = pages->builder;
+    if (builder == NULL || !builder->sink.ok) {
+        return false;
+    }
+    sink_block(&builder->sink, block);
+    // 压缩常驻时只有攒满压缩过的块可读
+    pages->text_len = pages->text != NULL ? builder->sink.len
+                                          : (uint32_t)pages->block_count * EPUB_PAGES_BLOCK;
+    if (!builder->sink.ok) {
+        ESP_LOGE(TAG, "No memory for chapter %d, truncated at %u bytes", pages->chapter_index,
+                 (unsigned)pages->text_len);
+    }
+    return builder->sink.ok;
+}
+
+bool epub_pages_end(epub_pages_t *pages) {
+    struct epub_pages_builder *builder = pages->builder;
+    if (builder == NULL) {
+        return epub_pages_loaded(pages);
+    }
+    text_sink_t *sink = &builder->sink;
+    const bool ok = sink_finish(sink);
+    // 整段保存时按 size_hint 分配的余量退还（正文控件可能指着旧缓冲区，同样留到下次取正文再释放）
+    if (ok && pages->text != NULL && sink->text_cap - sink->len - 1 >= EPUB_PAGES_BLOCK) {
+        sink_move_text(sink, sink->len + 1);
+    }
+    pages->builder = NULL;
+    heap_stats_free(HEAP_TAG_EPUB, builder);
+    if (!ok) {
+        // 内存不足前写入的部分照常阅读；占位行不完整的图片丢掉
+        while (pages->image_count > 0 &&
+               pages->images[pages->image_count - 1].offset + (uint32_t)(sizeof(IMAGE_PLACEHOLDER) - 1) >
+                   pages->text_len) {
+            pages->image_count--;
+        }
+    }
+    resolve_images(pages, 0);
+    return ok;
+}
+
+// offset 不小于 start 的第一张图片
+static const epub_page_image_t* next_image(const epub_pages_t *pages, uint32_t start) {
+    int lo = 0;
+    int hi = pages->image_count;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (pages->images[mid].offset < start) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < pages->image_count ? &pages->images[lo] : NULL;
+}
+
+uint32_t epub_pages_text_end(const epub_pages_t *pages, uint32_t start) {
+    const epub_page_image_t *image = next_image(pages, start);
+    if (image == NULL) {
+        return pages->text_len;
+    }
+    return image->offset == start ? image->end : image->offset;
+}
+
+const epub_page_image_t* epub_pages_image(const epub_pages_t *pages, int page) {
+    if (page < 0 || page >= pages->page_count) {
+        return NULL;
+    }
+    const epub_page_image_t *image = next_image(pages, pages->page_starts[page]);
+    return image != NULL && image->offset == pages->page_starts[page] ? image : NULL;
+}
+
+static bool starts_append(epub_pages_t *pages, uint32_t start) {
+    if (pages->page_count == pages->page_capacity) {
+        const int capacity = pages->page_capacity * 2;
+        uint32_t *starts = heap_stats_realloc(HEAP_TAG_EPUB, pages->page_starts,
+                                              capacity * sizeof(uint32_t));
+        if (starts == NULL) {
+            return false;
+        }
+        pages->page_starts = starts;
+        pages->page_capacity = capacity;
+    }
+    pages->page_starts[pages->page_count++] = start;
+    return true;
+}
+
+// 到下一张图片或章末之前只剩空行时直接跳过，不留空白页
+static uint32_t skip_blank_tail(epub_pages_t *pages, uint32_t pos) {
+    const uint32_t limit = epub_pages_text_end(pages, pos);
+    if (pages->builder != NULL && limit >= pages->text_len) {
+        return pos;  // 正文还在追加，后面未必只有空行
+    }
+    return skip_newlines(pages, pos, limit) == limit ? limit : pos;
+}
+
+// 解压从 first 开始的若干块到窗口；窗口中已有的块前移复用，只解压缺的块
+static bool window_load(epub_pages_t *pages, int first) {
+    int last = first + EPUB_PAGES_WINDOW_BLOCKS;
+    if (last > pages->block_count) {
+        last = pages->block_count;
+    }
+    const int old_first = (int)(pages->window_start / EPUB_PAGES_BLOCK);
+    const int old_count = (int)((pages->window_len + EPUB_PAGES_BLOCK - 1) / EPUB_PAGES_BLOCK);
+    uint32_t kept = 0;
+    if (pages->window_len > 0 && first >= old_first && first < old_first + old_count) {
+        const uint32_t shift = (uint32_t)(first - old_first) * EPUB_PAGES_BLOCK;
+        kept = pages->window_len - shift;
+        memmove(pages->window, pages->window + shift, kept);
+    }
+    pages->window_start = (uint32_t)first * EPUB_PAGES_BLOCK;
+    pages->window_len = kept;
+    for (int b = first + (int)(kept / EPUB_PAGES_BLOCK); b < last; b++) {
+        const uint32_t size = block_raw_size(pages, b);
+        const uint8_t *src = pages->packed + pages->block_offsets[b];
+        const uint32_t src_len = pages->block_offsets[b + 1] - pages->block_offsets[b];
+        char *dst = pages->window + pages->window_len;
+        if (src_len == size) {
+            memcpy(dst, src, size);
+        } else if (!lz_block_decode(src, src_len, (uint8_t *)dst, size)) {
+            ESP_LOGE(TAG, "Chapter %d block %d corrupt", pages->chapter_index, b);
+            pages->window_len = 0;
+            return false;
+        }
+        pages->window_len += size;
+    }
+    return true;
+}
+
+static const char *text_at(epub_pages_t *pages, uint32_t start, uint32_t *len) {
+    if (start > pages->text_len) {
+        start = pages->text_len;
+    }
+    uint32_t want = *len < pages->text_len - start ? *len : pages->text_len - start;
+    if (pages->text != NULL) {
+        *len = want;
+        return pages->text + start;
+    }
+    if (pages->packed == NULL) {
+        *len = 0;
+        return NULL;
+    }
+    // 窗口从 start 所在的块开始，保证至少能取到 EPUB_PAGES_WINDOW_BLOCKS - 1 块
+    const uint32_t span = (EPUB_PAGES_WINDOW_BLOCKS - 1) * EPUB_PAGES_BLOCK;
+    if (want > span) {
+        want = span;
+    }
+    if (pages->window_len == 0 || start < pages->window_start ||
+        start + want > pages->window_start + pages->window_len) {
+        if (!window_load(pages, (int)(start / EPUB_PAGES_BLOCK))) {
+            *len = 0;
+            return NULL;
+        }
+    }
+    *len = want;
+    return pages->window + (start - pages->window_start);
+}
+
+const char *epub_pages_text(epub_pages_t *pages, uint32_t start, uint32_t *len) {
+    // 调用者随后把正文控件指向这次的结果，扩容换下的旧正文不再有人指着
+    heap_stats_free(HEAP_TAG_EPUB, pages->retired);
+    pages->retired = NULL;
+    return text_at(pages, start, len);
+}
+
+bool epub_pages_paginate(epub_pages_t *pages, text_layout_t *layout, uint32_t budget_ms) {
+    if (!epub_pages_loaded(pages) || pages->complete) {
+        return true;
+    }
+
+    const uint32_t t0 = lv_tick_get();
+    // 分页会移动解压窗口，正文控件可能还指着窗口里的当前页：结束时放回原处
+    const bool restore = pages->window_len > 0;
+    const uint32_t window_start = pages->window_start;
+    text_page_layout_t out;
+    while (!pages->complete) {
+        const uint32_t start = pages->page_starts[pages->page_count - 1];
+        if (pages->builder != NULL) {
+            pages->builder->images_resolved = resolve_images(pages, pages->builder->images_resolved);
+            if (!text_ready(pages, start)) {
+                break;  // 等正文追加到一整页之后
+            }
+        }
+        const uint32_t limit = epub_pages_text_end(pages, start);
+        const epub_page_image_t *image = next_image(pages, start);
+        uint32_t end = start;
+        if (image != NULL && image->offset == start) {
+            end = image->end;  // 图片独占一页
+        } else {
+            // 排到下一张图片为止（常驻压缩时最多排到窗口末尾）
+            const uint32_t remaining = limit - start;
+            uint32_t len = remaining;
+            const char *text = text_at(pages, start, &len);
+            const bool at_eof = len == remaining && remaining <= UINT16_MAX &&
+                                (pages->builder == NULL || limit < pages->text_len);
+            if (text != NULL && len > 0 && text_layout_paginate(layout, text, len, at_eof, &out)) {
+                end = start + out.consumed;
+            }
+        }
+        if (end > start && end < pages->text_len) {
+            end = skip_blank_tail(pages, end);
+        }
+        if (end <= start || end >= pages->text_len) {
+            if (pages->builder != NULL) {
+                break;
+            }
+            pages->complete = true;
+        } else if (!starts_append(pages, end)) {
+            ESP_LOGW(TAG, "No memory for page table, chapter %d truncated", pages->chapter_index);
+            pages->complete = true;
+        }
+        if (budget_ms > 0 && lv_tick_elaps(t0) >= budget_ms) {
+            break;
+        }
+    }
+    if (restore && (pages->window_len == 0 || pages->window_start != window_start)) {
+        window_load(pages, (int)(window_start / EPUB_PAGES_BLOCK));
+    }
+    return pages->complete;
+}
+
+void epub_pages_reset(epub_pages_t *pages) {
+    if (pages->page_starts != NULL) {
+        pages->page_count = 1;
+        pages->complete = false;
+    }
+}
+
+int epub_pages_find(const epub_pages_t *pages, uint32_t offset) {
+    int lo = 0;
+    int hi = pages->page_count;
+    while (hi - lo > 1) {
+        const int mid = (lo + hi) / 2;
+        if (pages->page_starts[mid] <= offset) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void epub_pages_free(epub_pages_t *pages) {
+    if (pages->builder != NULL) {
+        heap_stats_free(HEAP_TAG_EPUB, pages->builder->sink.table);
+        heap_stats_free(HEAP_TAG_EPUB, pages->builder);
+    }
+    heap_stats_free(HEAP_TAG_EPUB, pages->retired);
+    heap_stats_free(HEAP_TAG_EPUB, pages->text);
+    heap_stats_free(HEAP_TAG_EPUB, pages->packed);
+    heap_stats_free(HEAP_TAG_EPUB, pages->block_offsets);
+    heap_stats_free(HEAP_TAG_EPUB, pages->window);
+    heap_stats_free(HEAP_TAG_EPUB, pages->image_srcs);
+    heap_stats_free(HEAP_TAG_EPUB, pages->page_starts);
+    heap_stats_free(HEAP_TAG_EPUB, pages->images);
+    memset(pages, 0, sizeof(*pages));
+    pages->chapter_index = -1;
+}
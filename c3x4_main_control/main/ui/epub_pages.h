@@ -0,0 +1,172 @@
+/**
+ * @file epub_pages.h
+ * @brief EPUB 章节分页 - 文本块展平为正文并计算每页起点
+ *
+ * 章节的文本块（epub_parser_load_blocks）展平为一段 UTF-8 正文：段落之间以 '\n' 分隔，
+ * 正文段落按首行缩进补全角空格，图片以占位行表示并单独成页（图片页由 epub_image 解码显示，
+ * 解码失败时仍显示占位行）。页边界由 text_layout 按阅读器的排版参数计算，
+ * 可以分片推进（后台预取），也可以一次算完
+ *
+ * 正文常驻内存，章内翻页与往回翻都不再读 SD 卡：放得下时整段保存；大章节按
+ * EPUB_PAGES_BLOCK 字节分块、每块独立 LZ 压缩（lz_block），取正文时把所在的几块解压到窗口
+ *
+ * 正文也可以边解析边追加（epub_pages_begin / append / end，见 epub_pipeline）：追加期间
+ * 只排已有 EPUB_PAGES_LOOKAHEAD 字节后文的页，排出的页不会再变，前面的页可以先显示
+ */
+
+#ifndef EPUB_PAGES_H
+#define EPUB_PAGES_H
+
+#include "epub_parser.h"
+#include "text_layout.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EPUB_PAGES_BLOCK          4096   // 常驻压缩的块大小（每块独立解压）
+#define EPUB_PAGES_WINDOW_BLOCKS  6      // 解压窗口的块数（一页正文不超过窗口减一块）
+#define EPUB_PAGES_RAW_SHARE      4      // 正文不超过堆余量的 1/N 时整段保存，不压缩
+#define EPUB_PAGES_LOOKAHEAD      (TEXT_LAYOUT_MAX_LINES * (TEXT_LAYOUT_LINE_MAX + 1))  // 一页最多消耗的正文字节
+
+// 图片页
+typedef struct {
+    uint32_t offset;         // 占位行在 text 中的偏移（即图片页的页首）
+    uint32_t end;            // 图片页之后下一页的页首
+    const char *src;         // 图片链接（相对章节文档，保存在 image_srcs 中）
+} epub_page_image_t;
+
+typedef struct {
+    int chapter_index;       // 章节索引，-1 表示未加载
+    char *text;              // 展平后的正文（常驻压缩时为 NULL，用 epub_pages_text 读取）
+    uint32_t text_len;
+    uint8_t *packed;         // 常驻压缩：各块的压缩数据依次存放（不变小的块原样保存）
+    uint32_t *block_offsets; // 第 i 块在 packed 中的起点，共 block_count + 1 项
+    int block_count;
+    char *window;            // 解压窗口（EPUB_PAGES_WINDOW_BLOCKS 块）
+    uint32_t window_start;   // 窗口第一块在正文中的偏移
+    uint32_t window_len;     // 窗口中已解压的字节
+    char *image_srcs;        // 图片链接池
+    uint32_t *page_starts;   // 每页起点（text 中的偏移），第 1 页为 0
+    int page_count;          // 已知页数（complete 之后即章节总页数）
+    int page_capacity;
+    epub_page_image_t *images;// 图片页，按 offset 升序
+    int image_count;
+    bool complete;           // 分页是否已覆盖整章
+    struct epub_pages_builder *builder;  // 正文还在追加时的写入状态，否则为 NULL
+    char *retired;           // 追加时扩容换下的旧正文（正文控件可能还指着），下次取正文时释放
+} epub_pages_t;
+
+/**
+ * @brief 展平章节文本块，准备分页（尚未计算页边界）
+ * @param pages 输出
+ * @param chapter_index 章节索引
+ * @param blocks 章节文本块（调用后可释放）
+ * @return true 成功，false 内存不足
+ */
+bool epub_pages_init(epub_pages_t *pages, int chapter_index, const epub_chapter_blocks_t *blocks);
+
+/**
+ * @brief 章节正文是否已载入
+ */
+static inline bool epub_pages_loaded(const epub_pages_t *pages) {
+    return pages->text != NULL || pages->packed != NULL;
+}
+
+/**
+ * @brief 开始边解析边追加章节正文（尚无正文，页边界随追加推进）
+ * @param pages 输出
+ * @param chapter_index 章节索引
+ * @param size_hint 预计的正文字节数（章节文件的解压大小），决定整段保存还是分块压缩
+ * @return true 成功，false 内存不足
+ */
+bool epub_pages_begin(epub_pages_t *pages, int chapter_index, uint32_t size_hint);
+
+/**
+ * @brief 追加一个文本块
+ * @param pages 章节分页（epub_pages_begin 之后）
+ * @param block 文本块（调用后可释放）
+ * @return true 成功，false 内存不足（已追加的部分 epub_pages_end 后仍可阅读）
+ */
+bool epub_pages_append(epub_pages_t *pages, const epub_text_block_t *block);
+
+/**
+ * @brief 正文追加完毕，之后分页可以排到章末
+ * @param pages 章节分页
+ * @return true 成功，false 追加中途内存不足（章节被截断）
+ */
+bool epub_pages_end(epub_pages_t *pages);
+
+/**
+ * @brief 第 page 页（从 0 开始）的页首和页尾都已确定，或分页已完成
+ */
+static inline bool epub_pages_page_ready(const epub_pages_t *pages, int page) {
+    return pages->complete || page < pages->page_count - 1;
+}
+
+/**
+ * @brief 取从 start 开始的一段连续正文
+ *
+ * 整段保存时直接指向 text；常驻压缩时指向解压窗口，至多
+ * (EPUB_PAGES_WINDOW_BLOCKS - 1) * EPUB_PAGES_BLOCK 字节，下一次对同一章节调用
+ * epub_pages_text 之前有效（分页与追加正文不会使它失效）
+ *
+ * @param pages 章节分页
+ * @param start 正文偏移
+ * @param len 输入想要的字节数，输出实际可用的字节数（不超过章末）
+ * @return 正文指针，解压失败返回 NULL
+ */
+const char *epub_pages_text(epub_pages_t *pages, uint32_t start, uint32_t *len);
+
+/**
+ * @brief 继续计算页边界
+ * @param pages 章节分页
+ * @param layout 排版上下文
+ * @param budget_ms 本次最多占用的时间，0 表示一直算到章节末尾（正文还在追加时算到已有正文为止）
+ * @return true 分页已完成
+ */
+bool epub_pages_paginate(epub_pages_t *pages, text_layout_t *layout, uint32_t budget_ms);
+
+/**
+ * @brief 丢弃已算出的页边界（排版参数改变后重新分页）
+ * @param pages 章节分页
+ */
+void epub_pages_reset(epub_pages_t *pages);
+
+/**
+ * @brief 查找包含 offset 的页
+ * @param pages 章节分页
+ * @param offset 正文偏移
+ * @return 页序号（从 0 开始），offset 超出已分页部分时返回最后一个已知页
+ */
+int epub_pages_find(const epub_pages_t *pages, uint32_t offset);
+
+/**
+ * @brief 查询图片页
+ * @param pages 章节分页
+ * @param page 页序号（从 0 开始）
+ * @return 该页的图片，不是图片页时返回 NULL
+ */
+const epub_page_image_t* epub_pages_image(const epub_pages_t *pages, int page);
+
+/**
+ * @brief 从 start 开始的一页可以排版的正文末尾（下一张图片的占位行或章末；图片页为占位行末尾）
+ * @param pages 章节分页
+ * @param start 页首偏移
+ * @return 正文偏移
+ */
+uint32_t epub_pages_text_end(const epub_pages_t *pages, uint32_t start);
+
+/**
+ * @brief 释放章节分页
+ * @param pages 章节分页
+ */
+void epub_pages_free(epub_pages_t *pages);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_PAGES_H
@@ -10,21 +10,64 @@
 #include "epub_zip.h"
 #include "epub_xml.h"
 #include "epub_html.h"
+#include "epub_css.h"
+#include "epub_cache.h"
+#include "position_journal.h"
+#include "reader_arena.h"
 #include "esp_log.h"
-#include "nvs_flash.h"
-#include "nvs.h"
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
 static const char *TAG = "EPUB_PARSER";
 
-// NVS 命名空间
-#define NVS_NAMESPACE "reader_pos"
-#define NVS_KEY_PREFIX "epub_"
-
 // 最大章节数
 #define MAX_CHAPTERS 200
 
+// 缓存中的书籍信息：元数据 + 章节表，重新打开时不必解压、解析 content.opf
+#define META_CACHE_VERSION 6
+#define META_CACHE_PATH    "<spine>"
+
+// 全书样式表编译后的规则表：头 + rule_count 个 epub_css_rule_t，与书籍信息同时写入
+#define CSS_CACHE_VERSION  1
+#define CSS_CACHE_PATH     "<css>"
+
+typedef struct {
+    uint32_t version;
+    uint32_t rule_count;
+} css_cache_header_t;
+
+// 头之后是 chapter_count 个路径偏移与 chapter_count 个解压大小（均为 uint32_t），
+// 再之后是 pool_size 字节的路径池
+typedef struct {
+    uint32_t version;
+    uint32_t chapter_count;
+    uint32_t pool_size;
+    epub_metadata_t metadata;
+    char toc_path[128];
+    uint8_t toc_is_nav;
+    uint8_t reserved[3];
+    char cover_path[128];
+} epub_meta_cache_t;
+
+// 目录偏移表：头 + count 个定长项 + 标题池（项内的偏移相对标题池起点）
+#define TOC_CACHE_VERSION  1
+#define TOC_CACHE_PATH     "<toc>"
+#define TOC_SCAN_BATCH     32   // epub_parser_toc_find 每次读出的项数
+
+typedef struct {
+    uint32_t version;
+    uint32_t count;
+    uint32_t titles_size;
+} toc_cache_header_t;
+
+typedef struct {
+    uint16_t chapter_index;
+    uint8_t depth;
+    uint8_t title_length;
+    uint32_t title_offset;
+} toc_cache_entry_t;
+
 // EPUB MIME 类型
 static const char *EPUB_MIME_TYPES[] = {
     "application/epub+zip",
@@ -41,63 +84,355 @@ bool epub_parser_init(epub_reader_t *reader) {
 
     memset(reader, 0, sizeof(epub_reader_t));
     reader->current_file = NULL;
+    reader->toc_count = -1;
 
     ESP_LOGI(TAG, "EPUB parser initialized");
     return true;
 }
 
-bool epub_parser_is_valid_epub(const char *file_path) {
+static bool has_epub_extension(const char *file_path) {
     if (file_path == NULL) {
         return false;
     }
-
-    // 检查文件扩展名
     const char *ext = strrchr(file_path, '.');
-    if (ext == NULL) {
+    return ext != NULL && strcasecmp(ext, ".epub") == 0;
+}
+
+bool epub_parser_is_valid_epub(const char *file_path) {
+    // 检查文件扩展名，再检查容器（结果按大小与修改时间缓存，文件未变时不再打开）
+    return has_epub_extension(file_path) && epub_zip_probe(file_path) != EPUB_ZIP_PROBE_INVALID;
+}
+
+static bool feed_xml(const void *data, size_t len, void *user) {
+    return epub_xml_feed((epub_xml_parser_t *)user, (const char *)data, len);
+}
+
+// 解压 ZIP 内的 XML 文件并直接送入 SAX 解析器，不保留整个文档
+static bool parse_xml_entry(epub_zip_t *zip, const epub_zip_file_info_t *file,
+                            const epub_xml_handler_t *handler) {
+    epub_xml_parser_t *xml = epub_xml_create(handler);
+    if (!xml) {
         return false;
     }
+    const bool ok = epub_zip_extract_to_callback(zip, file, feed_xml, xml) >= 0;
+    const bool complete = epub_xml_finish(xml);
+    epub_xml_destroy(xml);
+    if (ok && !complete) {
+        ESP_LOGW(TAG, "%s is truncated or ends inside a tag", file->filename);
+    }
+    return ok;
+}
 
-    if (strcasecmp(ext, ".epub") != 0) {
+// OPF 位置以 container.xml 为准；文件缺失或损坏时退回常见路径，再退回任意 .opf
+static bool locate_opf(epub_zip_t *zip, epub_zip_file_info_t *opf_file) {
+    epub_zip_file_info_t container_file;
+    if (epub_zip_find_file(zip, "META-INF/container.xml", &container_file)) {
+        epub_xml_container_t container;
+        epub_xml_handler_t handler;
+        epub_xml_container_handler(&handler, &container);
+        if (parse_xml_entry(zip, &container_file, &handler) && container.found &&
+            epub_zip_find_file(zip, container.rootfile, opf_file)) {
+            return true;
+        }
+        ESP_LOGW(TAG, "container.xml has no usable rootfile");
+    }
+
+    static const char *opf_paths[] = {
+        "OEBPS/content.opf",
+        "OPS/content.opf",
+        "content.opf",
+        NULL
+    };
+    for (int i = 0; opf_paths[i]; i++) {
+        if (epub_zip_find_file(zip, opf_paths[i], opf_file)) {
+            return true;
+        }
+    }
+    return epub_zip_list_files(zip, ".opf", opf_file, 1) == 1;
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') return (c | 0x20) - 'a' + 10;
+    return -1;
+}
+
+// 把 OPF 中的 href 解析为 ZIP 内路径：去掉 #片段、解码 %XX、处理 ./ 与 ../
+static bool resolve_href(const char *opf_path, size_t dir_len, const char *href,
+                         char *out, size_t out_size) {
+    char path[256];
+    size_t len = 0;
+    if (href[0] == '/') {
+        href++;  // 以 / 开头时相对 ZIP 根目录
+    } else {
+        if (dir_len >= sizeof(path)) {
+            return false;
+        }
+        memcpy(path, opf_path, dir_len);
+        len = dir_len;
+    }
+    for (const char *h = href; *h && *h != '#' && len + 1 < sizeof(path); h++) {
+        int hi, lo;
+        if (*h == '%' && (hi = hex_value(h[1])) >= 0 && (lo = hex_value(h[2])) >= 0) {
+            path[len++] = (char)(hi * 16 + lo);
+            h += 2;
+        } else {
+            path[len++] = *h;
+        }
+    }
+    path[len] = '\0';
+
+    // 逐段复制，遇到 ".." 回退到上一段
+    size_t o = 0;
+    const char *seg = path;
+    while (*seg) {
+        const char *end = strchr(seg, '/');
+        const size_t seg_len = end ? (size_t)(end - seg) : strlen(seg);
+        if (seg_len == 2 && seg[0] == '.' && seg[1] == '.') {
+            if (o > 0) {
+                o--;  // 去掉结尾的 '/'
+                while (o > 0 && out[o - 1] != '/') {
+                    o--;
+                }
+            }
+        } else if (seg_len > 0 && !(seg_len == 1 && seg[0] == '.')) {
+            if (o + seg_len + 1 >= out_size) {
+                ESP_LOGW(TAG, "Chapter path too long: %s", path);
+                return false;
+            }
+            memcpy(out + o, seg, seg_len);
+            o += seg_len;
+            if (end) {
+                out[o++] = '/';
+            }
+        }
+        seg = end ? end + 1 : seg + seg_len;
+    }
+    out[o] = '\0';
+    return o > 0;
+}
+
+static void make_cache_key(epub_cache_key_t *key, const char *epub_path, const char *content_path,
+                           epub_cache_type_t type) {
+    memset(key, 0, sizeof(*key));
+    strncpy(key->epub_path, epub_path, sizeof(key->epub_path) - 1);
+    strncpy(key->content_path, content_path, sizeof(key->content_path) - 1);
+    key->type = type;
+}
+
+static const char* chapter_path(const epub_reader_t *reader, int chapter_index) {
+    return reader->chapter_paths + reader->chapter_offsets[chapter_index];
+}
+
+// 章节表在阅读会话中来自 arena（路径池由 realloc 增长的除外），一律经 reader_arena_free 释放；
+// 目录表与样式规则表在堆上
+static void free_chapters(epub_reader_t *reader) {
+    reader_arena_free(reader->chapter_paths);
+    reader_arena_free(reader->chapter_offsets);
+    reader_arena_free(reader->chapter_sizes);
+    free(reader->toc_data);
+    epub_css_destroy(reader->css);
+    reader->css = NULL;
+    reader->chapter_paths = NULL;
+    reader->chapter_offsets = NULL;
+    reader->chapter_sizes = NULL;
+    reader->toc_data = NULL;
+    reader->toc_count = -1;
+}
+
+static bool load_cached_metadata(epub_reader_t *reader) {
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, META_CACHE_PATH, EPUB_CACHE_METADATA);
+    const long size = epub_cache_item_size(&key);
+    if (size < (long)sizeof(epub_meta_cache_t)) {
         return false;
     }
 
-    // 检查文件是否可以打开
-    FILE *file = fopen(file_path, "rb");
-    if (file == NULL) {
+    uint8_t *blob = malloc(size);
+    if (!blob) {
         return false;
     }
+    const epub_meta_cache_t *head = (const epub_meta_cache_t *)blob;
+    const size_t offsets_size = head->chapter_count * sizeof(uint32_t);
+    bool ok = epub_cache_read(&key, blob, size) == size && head->version == META_CACHE_VERSION &&
+              head->chapter_count > 0 && head->chapter_count <= MAX_CHAPTERS && head->pool_size > 0 &&
+              (long)(sizeof(*head) + 2 * offsets_size + head->pool_size) == size;
+    if (ok) {
+        reader->chapter_offsets = reader_arena_alloc(offsets_size);
+        reader->chapter_sizes = reader_arena_alloc(offsets_size);
+        reader->chapter_paths = reader_arena_alloc(head->pool_size);
+        ok = reader->chapter_offsets != NULL && reader->chapter_sizes != NULL && reader->chapter_paths != NULL;
+    }
+    if (ok) {
+        memcpy(reader->chapter_offsets, blob + sizeof(*head), offsets_size);
+        memcpy(reader->chapter_sizes, blob + sizeof(*head) + offsets_size, offsets_size);
+        memcpy(reader->chapter_paths, blob + sizeof(*head) + 2 * offsets_size, head->pool_size);
+        reader->chapter_paths[head->pool_size - 1] = '\0';
+        for (uint32_t i = 0; ok && i < head->chapter_count; i++) {
+            ok = reader->chapter_offsets[i] < head->pool_size;
+        }
+    }
+    if (ok) {
+        reader->metadata = head->metadata;
+        reader->metadata.total_chapters = (int)head->chapter_count;
+        memcpy(reader->toc_path, head->toc_path, sizeof(reader->toc_path));
+        reader->toc_path[sizeof(reader->toc_path) - 1] = '\0';
+        reader->toc_is_nav = head->toc_is_nav != 0;
+        memcpy(reader->cover_path, head->cover_path, sizeof(reader->cover_path));
+        reader->cover_path[sizeof(reader->cover_path) - 1] = '\0';
+    } else {
+        free_chapters(reader);
+    }
+    free(blob);
+    return ok;
+}
 
-    // 检查 ZIP 文件头（EPUB 是 ZIP 格式）
-    unsigned char zip_header[4];
-    bool is_zip = (fread(zip_header, 1, 4, file) == 4 &&
-                   zip_header[0] == 0x50 && zip_header[1] == 0x4B &&
-                   (zip_header[2] == 0x03 || zip_header[2] == 0x05 ||
-                    zip_header[2] == 0x07 || zip_header[2] == 0x08));
+static void store_cached_metadata(const epub_reader_t *reader, size_t pool_size) {
+    const int count = reader->metadata.total_chapters;
+    if (count <= 0) {
+        return;
+    }
+    const size_t offsets_size = count * sizeof(uint32_t);
+    const size_t size = sizeof(epub_meta_cache_t) + 2 * offsets_size + pool_size;
+    uint8_t *blob = calloc(1, size);
+    if (!blob) {
+        return;
+    }
+    epub_meta_cache_t *head = (epub_meta_cache_t *)blob;
+    head->version = META_CACHE_VERSION;
+    head->chapter_count = (uint32_t)count;
+    head->pool_size = (uint32_t)pool_size;
+    head->metadata = reader->metadata;
+    memcpy(head->toc_path, reader->toc_path, sizeof(head->toc_path));
+    head->toc_is_nav = reader->toc_is_nav;
+    memcpy(head->cover_path, reader->cover_path, sizeof(head->cover_path));
+    memcpy(blob + sizeof(*head), reader->chapter_offsets, offsets_size);
+    memcpy(blob + sizeof(*head) + offsets_size, reader->chapter_sizes, offsets_size);
+    memcpy(blob + sizeof(*head) + 2 * offsets_size, reader->chapter_paths, pool_size);
+
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, META_CACHE_PATH, EPUB_CACHE_METADATA);
+    epub_cache_write(&key, blob, size);
+    free(blob);
+}
 
-    fclose(file);
+// 规则表不存在或损坏时返回 false，书籍信息按未缓存处理（重新解析 OPF 与样式表）
+static bool load_cached_css(epub_reader_t *reader) {
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, CSS_CACHE_PATH, EPUB_CACHE_METADATA);
+    const long size = epub_cache_item_size(&key);
+    if (size < (long)sizeof(css_cache_header_t)) {
+        return false;
+    }
 
-    if (!is_zip) {
-        ESP_LOGW(TAG, "File is not a valid ZIP/EPUB: %s", file_path);
+    uint8_t *blob = malloc(size);
+    if (!blob) {
+        return false;
     }
+    const css_cache_header_t *head = (const css_cache_header_t *)blob;
+    bool ok = epub_cache_read(&key, blob, size) == size && head->version == CSS_CACHE_VERSION &&
+              (long)(sizeof(*head) + head->rule_count * sizeof(epub_css_rule_t)) == size;
+    if (ok && head->rule_count > 0) {
+        reader->css = epub_css_import((const epub_css_rule_t *)(blob + sizeof(*head)), head->rule_count);
+        ok = reader->css != NULL;
+    }
+    free(blob);
+    return ok;
+}
 
-    return is_zip;
+static void store_cached_css(const epub_reader_t *reader) {
+    const epub_css_rule_t *rules;
+    const size_t count = epub_css_rules(reader->css, &rules);
+    const size_t size = sizeof(css_cache_header_t) + count * sizeof(epub_css_rule_t);
+    uint8_t *blob = malloc(size);
+    if (!blob) {
+        return;
+    }
+    const css_cache_header_t head = {.version = CSS_CACHE_VERSION, .rule_count = (uint32_t)count};
+    memcpy(blob, &head, sizeof(head));
+    if (count > 0) {
+        memcpy(blob + sizeof(head), rules, count * sizeof(epub_css_rule_t));
+    }
+
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, CSS_CACHE_PATH, EPUB_CACHE_METADATA);
+    epub_cache_write(&key, blob, size);
+    free(blob);
 }
 
-bool epub_parser_open(epub_reader_t *reader, const char *epub_path) {
+static bool feed_css(const void *data, size_t len, void *user) {
+    return epub_css_feed((epub_css_t *)user, (const char *)data, len);
+}
+
+// manifest 中的样式表依次送入同一张规则表（后面的样式表层叠在前面的之上），每本书只解析一次
+static epub_css_t* parse_stylesheets(epub_zip_t *zip, const epub_xml_opf_t *opf,
+                                     const char *opf_path, size_t opf_dir_len) {
+    if (!epub_xml_opf_stylesheet_href(opf, 0)) {
+        return NULL;
+    }
+    epub_css_t *css = epub_css_create();
+    if (!css) {
+        return NULL;
+    }
+    for (int i = 0; ; i++) {
+        const char *href = epub_xml_opf_stylesheet_href(opf, i);
+        if (!href) {
+            break;
+        }
+        char path[256];
+        epub_zip_file_info_t file;
+        if (!resolve_href(opf_path, opf_dir_len, href, path, sizeof(path)) ||
+            !epub_zip_find_file(zip, path, &file)) {
+            ESP_LOGW(TAG, "Stylesheet not found: %s", href);
+            continue;
+        }
+        if (epub_zip_extract_to_callback(zip, &file, feed_css, css) < 0) {
+            ESP_LOGW(TAG, "Failed to read stylesheet: %s", path);
+        }
+        epub_css_end_sheet(css);
+    }
+    epub_css_finish(css);
+    return css;
+}
+
+// 记下路径并清空章节表；只查扩展名：容器由 epub_zip_open 在解析时检查，缓存命中时根本不打开书
+static bool begin_open(epub_reader_t *reader, const char *epub_path) {
     if (reader == NULL || epub_path == NULL) {
         ESP_LOGE(TAG, "Invalid parameters");
         return false;
     }
-
-    if (!epub_parser_is_valid_epub(epub_path)) {
+    if (!has_epub_extension(epub_path)) {
         ESP_LOGE(TAG, "Invalid EPUB file: %s", epub_path);
         return false;
     }
-
     strncpy(reader->epub_path, epub_path, sizeof(reader->epub_path) - 1);
     reader->epub_path[sizeof(reader->epub_path) - 1] = '\0';
+    free_chapters(reader);
+    return true;
+}
 
-    ESP_LOGI(TAG, "Opening EPUB: %s", epub_path);
+bool epub_parser_open_cached(epub_reader_t *reader, const char *epub_path) {
+    if (!begin_open(reader, epub_path) || !epub_cache_init() || !load_cached_metadata(reader)) {
+        return false;
+    }
+    if (!load_cached_css(reader)) {
+        free_chapters(reader);  // 规则表缺失：连同书籍信息一起重建
+        return false;
+    }
+    reader->is_open = true;
+    reader->is_unzipped = false;
+    reader->position.current_chapter = 0;
+    reader->position.page_number = 0;
+    ESP_LOGI(TAG, "Opened EPUB from cache: %s (%d chapters)",
+             reader->metadata.title, reader->metadata.total_chapters);
+    return true;
+}
+
+bool epub_parser_parse(epub_reader_t *reader, const char *epub_path) {
+    if (!begin_open(reader, epub_path)) {
+        return false;
+    }
+    ESP_LOGI(TAG, "Parsing EPUB: %s", epub_path);
 
     // 步骤 1: 打开 ZIP 文件
     epub_zip_t *zip = epub_zip_open(epub_path);
@@ -106,116 +441,112 @@ bool epub_parser_open(epub_reader_t *reader, const char *epub_path) {
         return false;
     }
 
-    // 步骤 2: 查找并解析 content.opf
-    // 常见路径
-    const char *opf_paths[] = {
-        "OEBPS/content.opf",
-        "OPS/content.opf",
-        "content.opf",
-        NULL
-    };
-
+    // 步骤 2: 由 META-INF/container.xml 找到 content.opf
     epub_zip_file_info_t opf_file;
-    bool found_opf = false;
-
-    for (int i = 0; opf_paths[i]; i++) {
-        if (epub_zip_find_file(zip, opf_paths[i], &opf_file)) {
-            ESP_LOGI(TAG, "Found content.opf at: %s", opf_paths[i]);
-            found_opf = true;
-            break;
-        }
-    }
-
-    if (!found_opf) {
+    if (!locate_opf(zip, &opf_file)) {
         ESP_LOGE(TAG, "content.opf not found in EPUB");
         epub_zip_close(zip);
         return false;
     }
+    ESP_LOGI(TAG, "Found content.opf at: %s", opf_file.filename);
 
-    // 步骤 3: 读取并解析 content.opf
-    char *opf_buffer = malloc(opf_file.uncompressed_size + 1);
-    if (!opf_buffer) {
-        ESP_LOGE(TAG, "Failed to allocate buffer for content.opf");
-        epub_zip_close(zip);
-        return false;
+    // 步骤 3: 流式解析 content.opf，一遍得到元数据、manifest 与 spine
+    epub_xml_opf_t *opf = epub_xml_opf_create();
+    epub_xml_handler_t handler;
+    if (opf) {
+        epub_xml_opf_handler(opf, &handler);
     }
-
-    int opf_size = epub_zip_extract_file(zip, &opf_file, opf_buffer, opf_file.uncompressed_size);
-    if (opf_size < 0) {
-        ESP_LOGE(TAG, "Failed to extract content.opf");
-        free(opf_buffer);
+    if (!opf || !parse_xml_entry(zip, &opf_file, &handler)) {
+        ESP_LOGE(TAG, "Failed to parse content.opf");
+        epub_xml_opf_destroy(opf);
         epub_zip_close(zip);
         return false;
     }
-    opf_buffer[opf_size] = '\0';
 
-    // 创建 XML 解析器
-    epub_xml_parser_t *xml = epub_xml_create(opf_buffer, opf_size);
-    if (!xml) {
-        ESP_LOGE(TAG, "Failed to create XML parser");
-        free(opf_buffer);
-        epub_zip_close(zip);
-        return false;
+    int spine_count = epub_xml_opf_resolve(opf);
+    if (spine_count > MAX_CHAPTERS) {
+        ESP_LOGW(TAG, "Spine has %d items, keeping the first %d", spine_count, MAX_CHAPTERS);
+        spine_count = MAX_CHAPTERS;
     }
 
-    // 解析元数据
-    epub_xml_metadata_t xml_metadata;
-    if (epub_xml_parse_metadata(xml, &xml_metadata)) {
-        strncpy(reader->metadata.title, xml_metadata.title, sizeof(reader->metadata.title) - 1);
-        strncpy(reader->metadata.author, xml_metadata.author, sizeof(reader->metadata.author) - 1);
-        strncpy(reader->metadata.language, xml_metadata.language, sizeof(reader->metadata.language) - 1);
-        ESP_LOGI(TAG, "Metadata: title='%s', author='%s'", reader->metadata.title, reader->metadata.author);
-    } else {
+    const epub_xml_metadata_t *xml_metadata = epub_xml_opf_metadata(opf);
+    strncpy(reader->metadata.title, xml_metadata->title, sizeof(reader->metadata.title) - 1);
+    strncpy(reader->metadata.author, xml_metadata->author, sizeof(reader->metadata.author) - 1);
+    strncpy(reader->metadata.language, xml_metadata->language, sizeof(reader->metadata.language) - 1);
+    strncpy(reader->metadata.identifier, xml_metadata->identifier,
+            sizeof(reader->metadata.identifier) - 1);
+    if (reader->metadata.title[0] == '\0') {
         // 使用文件名作为标题
         const char *filename = strrchr(epub_path, '/');
         strncpy(reader->metadata.title, filename ? filename + 1 : epub_path, sizeof(reader->metadata.title) - 1);
         char *dot = strrchr(reader->metadata.title, '.');
         if (dot) *dot = '\0';
-        strncpy(reader->metadata.author, "Unknown", sizeof(reader->metadata.author) - 1);
     }
-
-    // 解析 spine (章节顺序)
-    epub_xml_spine_item_t spine_items[MAX_CHAPTERS];
-    int spine_count = epub_xml_parse_spine(xml, spine_items, MAX_CHAPTERS);
-    ESP_LOGI(TAG, "Found %d spine items", spine_count);
-
-    // 分配章节数组
-    reader->chapters = calloc(spine_count, sizeof(epub_chapter_t));
-    if (!reader->chapters) {
-        ESP_LOGE(TAG, "Failed to allocate chapters array");
-        epub_xml_destroy(xml);
-        free(opf_buffer);
-        epub_zip_close(zip);
-        return false;
+    if (reader->metadata.author[0] == '\0') {
+        strncpy(reader->metadata.author, "Unknown", sizeof(reader->metadata.author) - 1);
     }
-
-    // 解析 manifest 并构建完整章节列表
+    ESP_LOGI(TAG, "Metadata: title='%s', author='%s'", reader->metadata.title, reader->metadata.author);
+
+    // spine 中的 href 相对 OPF 所在目录，转换为 ZIP 内的完整路径，依次放入路径池
+    const char *slash = strrchr(opf_file.filename, '/');
+    const size_t opf_dir_len = slash ? (size_t)(slash + 1 - opf_file.filename) : 0;
+    reader->chapter_offsets = reader_arena_alloc((spine_count > 0 ? spine_count : 1) * sizeof(uint32_t));
+    reader->chapter_sizes = reader_arena_alloc((spine_count > 0 ? spine_count : 1) * sizeof(uint32_t));
+    size_t pool_size = 0;
+    size_t pool_capacity = 0;
     int valid_chapters = 0;
-    for (int i = 0; i < spine_count; i++) {
-        char href[256];
-        if (epub_xml_find_manifest_item(xml, spine_items[i].idref, href, sizeof(href))) {
-            // 构建完整路径 - 确保 href 不会超出目标缓冲区
-            size_t href_len = strlen(href);
-            size_t max_copy = sizeof(reader->chapters[valid_chapters].content_file) - 1;
-            if (href_len > max_copy) {
-                href_len = max_copy;
+    for (int i = 0; reader->chapter_offsets && reader->chapter_sizes && i < spine_count; i++) {
+        char path[256];
+        const char *href = epub_xml_opf_spine_href(opf, i);
+        if (!href || !resolve_href(opf_file.filename, opf_dir_len, href, path, sizeof(path))) {
+            continue;
+        }
+        const size_t len = strlen(path) + 1;
+        if (pool_size + len > pool_capacity) {
+            // 路径长度不超过 256，翻倍一次一定放得下
+            const size_t capacity = pool_capacity ? pool_capacity * 2 : 2048;
+            char *grown = realloc(reader->chapter_paths, capacity);
+            if (!grown) {
+                ESP_LOGW(TAG, "Out of memory, keeping the first %d chapters", valid_chapters);
+                break;
             }
-            strncpy(reader->chapters[valid_chapters].content_file, href, href_len);
-            reader->chapters[valid_chapters].content_file[href_len] = '\0';
-            reader->chapters[valid_chapters].chapter_index = valid_chapters;
-            snprintf(reader->chapters[valid_chapters].title,
-                    sizeof(reader->chapters[valid_chapters].title),
-                    "Chapter %d", valid_chapters + 1);
-            valid_chapters++;
+            reader->chapter_paths = grown;
+            pool_capacity = capacity;
         }
+        memcpy(reader->chapter_paths + pool_size, path, len);
+        // 解压大小按当前排版换算成页数，估计全书页码（找不到的章节记 0，按平均值估计）
+        epub_zip_file_info_t chapter_file;
+        reader->chapter_sizes[valid_chapters] =
+            epub_zip_find_file(zip, path, &chapter_file) ? chapter_file.uncompressed_size : 0;
+        reader->chapter_offsets[valid_chapters++] = (uint32_t)pool_size;
+        pool_size += len;
+    }
+    reader->css = parse_stylesheets(zip, opf, opf_file.filename, opf_dir_len);
+    epub_zip_close(zip);
+    if (valid_chapters == 0) {
+        ESP_LOGE(TAG, "No readable chapters in spine");
+        free_chapters(reader);
+        epub_xml_opf_destroy(opf);
+        return false;
     }
-
     reader->metadata.total_chapters = valid_chapters;
 
-    // 清理
-    epub_xml_destroy(xml);
-    free(opf_buffer);
-    epub_zip_close(zip);
+    // 目录文档只记下路径，第一次打开章节列表时再解析
+    bool toc_is_nav = false;
+    const char *toc_href = epub_xml_opf_toc_href(opf, &toc_is_nav);
+    reader->toc_path[0] = '\0';
+    if (toc_href && resolve_href(opf_file.filename, opf_dir_len, toc_href, reader->toc_path,
+                                 sizeof(reader->toc_path))) {
+        reader->toc_is_nav = toc_is_nav;
+    } else {
+        reader->toc_path[0] = '\0';
+    }
+    const char *cover_href = epub_xml_opf_cover_href(opf);
+    if (!cover_href || !resolve_href(opf_file.filename, opf_dir_len, cover_href, reader->cover_path,
+                                     sizeof(reader->cover_path))) {
+        reader->cover_path[0] = '\0';
+    }
+    epub_xml_opf_destroy(opf);
 
     reader->is_open = true;
     reader->is_unzipped = false;  // 流式解析，不需要预解压
@@ -228,6 +559,38 @@ bool epub_parser_open(epub_reader_t *reader, const char *epub_path) {
     return true;
 }
 
+void epub_parser_store_cache(const epub_reader_t *reader) {
+    if (reader == NULL || !reader->is_open || reader->metadata.total_chapters <= 0 ||
+        !epub_cache_init()) {
+        return;
+    }
+    // 路径池的大小由最后一章的路径推出：池中各路径按章节顺序紧密排列
+    const int last = reader->metadata.total_chapters - 1;
+    const char *last_path = reader->chapter_paths + reader->chapter_offsets[last];
+    store_cached_metadata(reader, reader->chapter_offsets[last] + strlen(last_path) + 1);
+    store_cached_css(reader);
+}
+
+bool epub_parser_open(epub_reader_t *reader, const char *epub_path) {
+    // 缓存命中时跳过 ZIP 与 OPF 解析
+    if (epub_parser_open_cached(reader, epub_path)) {
+        return true;
+    }
+    if (!epub_parser_parse(reader, epub_path)) {
+        return false;
+    }
+    epub_parser_store_cache(reader);
+    return true;
+}
+
+void epub_parser_discard(epub_reader_t *reader) {
+    if (reader == NULL) {
+        return;
+    }
+    free_chapters(reader);
+    reader->is_open = false;
+}
+
 void epub_parser_close(epub_reader_t *reader) {
     if (reader == NULL) {
         return;
@@ -238,12 +601,10 @@ void epub_parser_close(epub_reader_t *reader) {
         reader->current_file = NULL;
     }
 
-    if (reader->chapters != NULL) {
-        free(reader->chapters);
-        reader->chapters = NULL;
-    }
+    free_chapters(reader);
 
     reader->is_open = false;
+    epub_cache_flush();
     ESP_LOGI(TAG, "EPUB parser closed");
 }
 
@@ -261,21 +622,291 @@ int epub_parser_get_chapter_count(const epub_reader_t *reader) {
     return reader->metadata.total_chapters;
 }
 
-const epub_chapter_t* epub_parser_get_chapter(const epub_reader_t *reader, int chapter_index) {
-    if (reader == NULL || !reader->is_open) {
-        return NULL;
+uint32_t epub_parser_chapter_size(const epub_reader_t *reader, int chapter_index) {
+    if (reader == NULL || !reader->is_open || reader->chapter_sizes == NULL || chapter_index < 0 ||
+        chapter_index >= reader->metadata.total_chapters) {
+        return 0;
+    }
+    return reader->chapter_sizes[chapter_index];
+}
+
+bool epub_parser_get_chapter(const epub_reader_t *reader, int chapter_index, epub_chapter_t *chapter) {
+    if (reader == NULL || !reader->is_open || chapter == NULL) {
+        return false;
     }
 
     if (chapter_index < 0 || chapter_index >= reader->metadata.total_chapters) {
-        return NULL;
+        return false;
+    }
+
+    chapter->content_file = chapter_path(reader, chapter_index);
+    chapter->chapter_index = chapter_index;
+    return true;
+}
+
+bool epub_parser_resolve_href(const char *base_path, const char *href, char *out, size_t out_size) {
+    if (base_path == NULL || href == NULL || *href == '\0' || out == NULL ||
+        strncmp(href, "data:", 5) == 0 || strstr(href, "://") != NULL) {
+        return false;  // 内联数据和外部链接不在 EPUB 中
+    }
+    const char *slash = strrchr(base_path, '/');
+    const size_t dir_len = slash ? (size_t)(slash - base_path + 1) : 0;
+    return resolve_href(base_path, dir_len, href, out, out_size);
+}
+
+// 目录构建：解析目录文档时收集的项与标题（只在构建期间占用内存）
+typedef struct {
+    const epub_reader_t *reader;
+    size_t dir_len;           // 目录文档所在目录的长度，href 相对它解析
+    toc_cache_entry_t *entries;
+    int count;
+    int capacity;
+    char *titles;
+    size_t titles_size;
+    size_t titles_capacity;
+    int last_chapter;         // 上一项指向的章节，目录通常按章节顺序，从这里开始找
+    bool failed;
+} toc_builder_t;
+
+static int find_chapter(const epub_reader_t *reader, const char *path, int hint) {
+    const int count = reader->metadata.total_chapters;
+    for (int n = 0; n < count; n++) {
+        const int i = (hint + n) % count;
+        if (strcmp(chapter_path(reader, i), path) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool toc_add(toc_builder_t *b, int chapter_index, int depth, const char *title) {
+    const size_t len = strnlen(title, UINT8_MAX);
+    if (b->count == b->capacity) {
+        const int capacity = b->capacity ? b->capacity * 2 : 64;
+        toc_cache_entry_t *grown = realloc(b->entries, capacity * sizeof(toc_cache_entry_t));
+        if (!grown) {
+            return false;
+        }
+        b->entries = grown;
+        b->capacity = capacity;
+    }
+    if (b->titles_size + len > b->titles_capacity) {
+        const size_t capacity = b->titles_capacity ? b->titles_capacity * 2 : 2048;
+        char *grown = realloc(b->titles, capacity);
+        if (!grown) {
+            return false;
+        }
+        b->titles = grown;
+        b->titles_capacity = capacity;
+    }
+    toc_cache_entry_t *entry = &b->entries[b->count++];
+    entry->chapter_index = (uint16_t)chapter_index;
+    entry->depth = (uint8_t)(depth < UINT8_MAX ? depth : UINT8_MAX);
+    entry->title_length = (uint8_t)len;
+    entry->title_offset = (uint32_t)b->titles_size;
+    memcpy(b->titles + b->titles_size, title, len);
+    b->titles_size += len;
+    return true;
+}
+
+static void collect_toc_entry(void *user, const char *href, const char *title, int depth) {
+    toc_builder_t *b = (toc_builder_t *)user;
+    char path[256];
+    if (b->failed || !resolve_href(b->reader->toc_path, b->dir_len, href, path, sizeof(path))) {
+        return;
+    }
+    const int chapter = find_chapter(b->reader, path, b->last_chapter);
+    if (chapter < 0) {
+        ESP_LOGD(TAG, "TOC entry outside spine: %s", path);
+        return;
+    }
+    b->last_chapter = chapter;
+
+    char fallback[32];
+    if (title[0] == '\0') {
+        snprintf(fallback, sizeof(fallback), "第 %d 章", chapter + 1);
+        title = fallback;
+    }
+    b->failed = !toc_add(b, chapter, depth, title);
+}
+
+// 解析目录文档生成偏移表并写入缓存；缓存写不进去时留在内存中
+static bool build_toc(epub_reader_t *reader, const epub_cache_key_t *key) {
+    toc_builder_t b = {.reader = reader};
+    const char *slash = strrchr(reader->toc_path, '/');
+    b.dir_len = slash ? (size_t)(slash + 1 - reader->toc_path) : 0;
+
+    if (reader->toc_path[0] != '\0') {
+        epub_zip_t *zip = epub_zip_open(reader->epub_path);
+        epub_zip_file_info_t file;
+        epub_xml_toc_t *toc = NULL;
+        if (zip && epub_zip_find_file(zip, reader->toc_path, &file) &&
+            (toc = epub_xml_toc_create(reader->toc_is_nav, collect_toc_entry, &b)) != NULL) {
+            epub_xml_handler_t handler;
+            epub_xml_toc_handler(toc, &handler);
+            if (!parse_xml_entry(zip, &file, &handler)) {
+                ESP_LOGW(TAG, "Failed to parse TOC: %s", reader->toc_path);
+            }
+            epub_xml_toc_finish(toc);
+        } else {
+            ESP_LOGW(TAG, "TOC document not found: %s", reader->toc_path);
+        }
+        epub_xml_toc_destroy(toc);
+        epub_zip_close(zip);
+    }
+
+    // 没有目录文档或目录为空：每章一项
+    if (b.count == 0) {
+        for (int i = 0; !b.failed && i < reader->metadata.total_chapters; i++) {
+            char title[32];
+            snprintf(title, sizeof(title), "第 %d 章", i + 1);
+            b.failed = !toc_add(&b, i, 0, title);
+        }
     }
 
-    return &reader->chapters[chapter_index];
+    const size_t entries_size = b.count * sizeof(toc_cache_entry_t);
+    const size_t size = sizeof(toc_cache_header_t) + entries_size + b.titles_size;
+    uint8_t *blob = b.failed ? NULL : malloc(size);
+    if (blob != NULL) {
+        toc_cache_header_t *head = (toc_cache_header_t *)blob;
+        head->version = TOC_CACHE_VERSION;
+        head->count = (uint32_t)b.count;
+        head->titles_size = (uint32_t)b.titles_size;
+        memcpy(blob + sizeof(*head), b.entries, entries_size);
+        memcpy(blob + sizeof(*head) + entries_size, b.titles, b.titles_size);
+    }
+    free(b.entries);
+    free(b.titles);
+    if (blob == NULL) {
+        ESP_LOGE(TAG, "Out of memory while building TOC");
+        return false;
+    }
+
+    ESP_LOGI(TAG, "TOC: %d entries, %u bytes", b.count, (unsigned)size);
+    if (epub_cache_write(key, blob, size)) {
+        free(blob);
+    } else {
+        reader->toc_data = blob;
+    }
+    reader->toc_count = b.count;
+    return true;
+}
+
+// 从缓存（或内存中的目录表）读取一段；缓存项被淘汰时标记为未加载，下次重新构建
+static bool toc_read_raw(epub_reader_t *reader, size_t offset, void *buffer, size_t len) {
+    if (reader->toc_data != NULL) {
+        const toc_cache_header_t *head = (const toc_cache_header_t *)reader->toc_data;
+        const size_t size = sizeof(*head) + head->count * sizeof(toc_cache_entry_t) + head->titles_size;
+        if (offset > size || len > size - offset) {
+            return false;
+        }
+        memcpy(buffer, reader->toc_data + offset, len);
+        return true;
+    }
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, TOC_CACHE_PATH, EPUB_CACHE_TOC);
+    if (!epub_cache_read_at(&key, offset, buffer, len)) {
+        ESP_LOGW(TAG, "TOC cache unavailable, will rebuild");
+        reader->toc_count = -1;
+        return false;
+    }
+    return true;
+}
+
+int epub_parser_toc_count(epub_reader_t *reader) {
+    if (reader == NULL || !reader->is_open) {
+        return 0;
+    }
+    if (reader->toc_count >= 0) {
+        return reader->toc_count;
+    }
+
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, TOC_CACHE_PATH, EPUB_CACHE_TOC);
+    toc_cache_header_t head;
+    const long size = epub_cache_item_size(&key);
+    if (size >= (long)sizeof(head) && epub_cache_read_at(&key, 0, &head, sizeof(head)) &&
+        head.version == TOC_CACHE_VERSION &&
+        (long)(sizeof(head) + head.count * sizeof(toc_cache_entry_t) + head.titles_size) == size) {
+        reader->toc_count = (int)head.count;
+    } else if (!build_toc(reader, &key)) {
+        reader->toc_count = 0;
+    }
+    return reader->toc_count;
+}
+
+int epub_parser_toc_read(epub_reader_t *reader, int first, epub_toc_entry_t *entries, int count) {
+    const int total = epub_parser_toc_count(reader);
+    if (entries == NULL || first < 0 || first >= total || count <= 0) {
+        return 0;
+    }
+    if (count > total - first) {
+        count = total - first;
+    }
+
+    // 标题按项的顺序存放，一批项的标题是连续的一段，一次读出
+    const size_t entries_offset = sizeof(toc_cache_header_t);
+    const size_t titles_offset = entries_offset + total * sizeof(toc_cache_entry_t);
+    toc_cache_entry_t raw[TOC_SCAN_BATCH];
+    int done = 0;
+    while (done < count) {
+        const int n = count - done < TOC_SCAN_BATCH ? count - done : TOC_SCAN_BATCH;
+        if (!toc_read_raw(reader, entries_offset + (first + done) * sizeof(toc_cache_entry_t), raw,
+                          n * sizeof(toc_cache_entry_t))) {
+            return done;
+        }
+        const uint32_t lo = raw[0].title_offset;
+        const uint32_t hi = raw[n - 1].title_offset + raw[n - 1].title_length;
+        char *titles = hi >= lo ? malloc(hi - lo + 1) : NULL;
+        if (titles == NULL || !toc_read_raw(reader, titles_offset + lo, titles, hi - lo)) {
+            free(titles);
+            return done;
+        }
+        for (int i = 0; i < n; i++) {
+            epub_toc_entry_t *entry = &entries[done + i];
+            const uint32_t ofs = raw[i].title_offset;
+            const size_t len = raw[i].title_length;
+            if (ofs >= lo && ofs + len <= hi && len < sizeof(entry->title)) {
+                memcpy(entry->title, titles + (ofs - lo), len);
+                entry->title[len] = '\0';
+            } else {
+                entry->title[0] = '\0';  // 损坏的项
+            }
+            entry->chapter_index = raw[i].chapter_index < reader->metadata.total_chapters
+                                   ? raw[i].chapter_index : 0;
+            entry->depth = raw[i].depth;
+        }
+        free(titles);
+        done += n;
+    }
+    return done;
+}
+
+int epub_parser_toc_find(epub_reader_t *reader, int chapter_index) {
+    const int total = epub_parser_toc_count(reader);
+    int best = 0;
+    toc_cache_entry_t raw[TOC_SCAN_BATCH];
+    for (int first = 0; first < total; first += TOC_SCAN_BATCH) {
+        const int n = total - first < TOC_SCAN_BATCH ? total - first : TOC_SCAN_BATCH;
+        if (!toc_read_raw(reader, sizeof(toc_cache_header_t) + first * sizeof(toc_cache_entry_t), raw,
+                          n * sizeof(toc_cache_entry_t))) {
+            break;
+        }
+        for (int i = 0; i < n; i++) {
+            if (raw[i].chapter_index == chapter_index) {
+                return first + i;
+            }
+            if (raw[i].chapter_index < chapter_index) {
+                best = first + i;
+            }
+        }
+    }
+    return best;
 }
 
 int epub_parser_read_chapter(const epub_reader_t *reader, int chapter_index,
                              char *text_buffer, size_t buffer_size) {
-    if (reader == NULL || !reader->is_open || text_buffer == NULL) {
+    if (reader == NULL || !reader->is_open || text_buffer == NULL || buffer_size == 0) {
         ESP_LOGE(TAG, "Invalid reader or buffer");
         return -1;
     }
@@ -285,7 +916,18 @@ int epub_parser_read_chapter(const epub_reader_t *reader, int chapter_index,
         return -1;
     }
 
-    const epub_chapter_t *chapter = &reader->chapters[chapter_index];
+    const char *content_file = chapter_path(reader, chapter_index);
+
+    // 缓存命中时不打开 ZIP、不解压
+    epub_cache_key_t key;
+    make_cache_key(&key, reader->epub_path, content_file, EPUB_CACHE_CHAPTER);
+    const long cached = epub_cache_item_size(&key);
+    if (cached >= 0 && cached < (long)buffer_size &&
+        epub_cache_read(&key, text_buffer, buffer_size - 1) == cached) {
+        text_buffer[cached] = '\0';
+        ESP_LOGD(TAG, "Read chapter %d from cache: %ld bytes", chapter_index, cached);
+        return (int)cached;
+    }
 
     // 从 EPUB 中流式读取章节内容
     // 重新打开 ZIP（因为之前已关闭）
@@ -297,27 +939,26 @@ int epub_parser_read_chapter(const epub_reader_t *reader, int chapter_index,
 
     // 查找章节文件
     epub_zip_file_info_t chapter_file;
-    if (!epub_zip_find_file(zip, chapter->content_file, &chapter_file)) {
-        // 尝试添加 OEBPS/ 前缀
-        char full_path[256];
-        snprintf(full_path, sizeof(full_path), "OEBPS/%s", chapter->content_file);
-        if (!epub_zip_find_file(zip, full_path, &chapter_file)) {
-            ESP_LOGE(TAG, "Chapter file not found: %s", chapter->content_file);
-            epub_zip_close(zip);
-            return -1;
-        }
+    if (!epub_zip_find_file(zip, content_file, &chapter_file)) {
+        ESP_LOGE(TAG, "Chapter file not found: %s", content_file);
+        epub_zip_close(zip);
+        return -1;
     }
 
-    // 解压章节内容
-    int bytes_read = epub_zip_extract_file(zip, &chapter_file, text_buffer, buffer_size);
+    // 解压章节内容（预留结尾 NUL）
+    int bytes_read = epub_zip_extract_file(zip, &chapter_file, text_buffer, buffer_size - 1);
     if (bytes_read < 0) {
-        ESP_LOGE(TAG, "Failed to extract chapter: %s", chapter->content_file);
+        ESP_LOGE(TAG, "Failed to extract chapter: %s", content_file);
         epub_zip_close(zip);
         return -1;
     }
 
     text_buffer[bytes_read] = '\0';
     epub_zip_close(zip);
+    // 缓冲区放不下整章时只得到前一段，不写缓存：否则以后用大缓冲区读到的也是截断的章节
+    if ((uint32_t)bytes_read >= chapter_file.uncompressed_size) {
+        epub_cache_precache_chapter(reader->epub_path, content_file, text_buffer, bytes_read);
+    }
 
     // 如果是 HTML，需要提取纯文本
     // 简化版：直接返回 HTML 内容，由上层解析
@@ -326,6 +967,408 @@ int epub_parser_read_chapter(const epub_reader_t *reader, int chapter_index,
     return bytes_read;
 }
 
+static bool feed_html(const void *data, size_t len, void *user) {
+    return epub_html_feed((epub_html_parser_t *)user, (const char *)data, len);
+}
+
+bool epub_parser_parse_chapter(const epub_reader_t *reader, int chapter_index,
+                               epub_html_block_cb_t callback, void *user) {
+    if (reader == NULL || !reader->is_open || callback == NULL) {
+        ESP_LOGE(TAG, "Invalid reader or callback");
+        return false;
+    }
+
+    if (chapter_index < 0 || chapter_index >= reader->metadata.total_chapters) {
+        ESP_LOGE(TAG, "Invalid chapter index: %d", chapter_index);
+        return false;
+    }
+
+    const char *content_file = chapter_path(reader, chapter_index);
+    epub_zip_t *zip = epub_zip_open(reader->epub_path);
+    if (!zip) {
+        ESP_LOGE(TAG, "Failed to reopen EPUB");
+        return false;
+    }
+
+    epub_zip_file_info_t chapter_file;
+    if (!epub_zip_find_file(zip, content_file, &chapter_file)) {
+        ESP_LOGE(TAG, "Chapter file not found: %s", content_file);
+        epub_zip_close(zip);
+        return false;
+    }
+
+    epub_html_parser_t *html = epub_html_create(callback, user);
+    if (!html) {
+        epub_zip_close(zip);
+        return false;
+    }
+    epub_html_set_css(html, reader->css);
+
+    // 回调要求停止时解压也随之中断，返回 -1，这种情况不算失败
+    const int bytes = epub_zip_extract_to_callback(zip, &chapter_file, feed_html, html);
+    const bool stopped = !epub_html_feed(html, NULL, 0);
+    if (!stopped) {
+        epub_html_finish(html);
+    }
+    epub_html_destroy(html);
+    epub_zip_close(zip);
+
+    if (bytes < 0 && !stopped) {
+        ESP_LOGE(TAG, "Failed to extract chapter: %s", content_file);
+        return false;
+    }
+    return true;
+}
+
+// 文本块缓存的头部，后面紧跟记录
+typedef struct {
+    uint32_t version;        // EPUB_HTML_FORMAT_VERSION
+    uint32_t block_count;
+} epub_blocks_cache_t;
+
+#define BLOCKS_INITIAL_CAPACITY  (16 * 1024)
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    int count;
+    bool failed;
+} blocks_builder_t;
+
+static bool collect_block(const epub_text_block_t *block, void *user) {
+    blocks_builder_t *builder = user;
+    const size_t record_size = epub_html_record_size(block);
+    if (builder->size + record_size > builder->capacity) {
+        size_t capacity = builder->capacity ? builder->capacity : BLOCKS_INITIAL_CAPACITY;
+        while (builder->size + record_size > capacity) {
+            capacity *= 2;
+        }
+        uint8_t *data = realloc(builder->data, capacity);
+        if (!data) {
+            ESP_LOGE(TAG, "Out of memory collecting text blocks (%u bytes)", (unsigned)capacity);
+            builder->failed = true;
+            return false;
+        }
+        builder->data = data;
+        builder->capacity = capacity;
+    }
+    builder->size += epub_html_write_record(block, builder->data + builder->size);
+    builder->count++;
+    return true;
+}
+
+static bool load_cached_blocks(const epub_cache_key_t *key, epub_chapter_blocks_t *blocks) {
+    const long size = epub_cache_item_size(key);
+    if (size < (long)sizeof(epub_blocks_cache_t)) {
+        return false;
+    }
+    uint8_t *data = malloc(size);
+    if (!data) {
+        return false;
+    }
+    const epub_blocks_cache_t *head = (const epub_blocks_cache_t *)data;
+    if (epub_cache_read(key, data, size) != size || head->version != EPUB_HTML_FORMAT_VERSION) {
+        free(data);
+        return false;
+    }
+    blocks->data = data;
+    blocks->size = (size_t)size;
+    blocks->block_count = (int)head->block_count;
+    if (blocks->block_count == 0) {
+        // 流式写入的缓存事先不知道块数（记为 0），这里数一遍
+        size_t offset = 0;
+        epub_text_block_t block;
+        while (epub_parser_next_block(blocks, &offset, &block)) {
+            blocks->block_count++;
+        }
+    }
+    return true;
+}
+
+#define BLOCKS_READ_CHUNK  2048
+
+#define BLOCKS_RECORD_INITIAL (EPUB_HTML_ARENA_SIZE + 512)
+
+struct epub_blocks_job {
+    epub_zip_t *zip;
+    epub_zip_stream_t *stream;
+    epub_html_parser_t *html;
+    epub_cache_key_t key;
+    blocks_builder_t builder;
+    epub_chapter_blocks_t cached;    // 缓存命中时直接持有结果
+    // 流式任务：文本块逐个交给回调，记录边解析边写入缓存，不在内存中攒整章
+    epub_html_block_cb_t callback;
+    void *user;
+    epub_cache_writer_t *writer;     // 缓存命中或写缓存失败后为 NULL
+    uint8_t *record;                 // 序列化一条记录
+    size_t record_cap;
+    size_t cached_offset;            // 遍历缓存文本块的位置
+    bool stopped;                    // 回调要求停止：内容不完整，不写缓存
+    bool done;
+    char chunk[BLOCKS_READ_CHUNK];
+};
+
+static void drop_writer(epub_blocks_job_t *job) {
+    if (job->writer != NULL) {
+        epub_cache_writer_abort(job->writer);
+        free(job->writer);
+        job->writer = NULL;
+    }
+}
+
+void epub_parser_blocks_cancel(epub_blocks_job_t *job) {
+    if (job == NULL) {
+        return;
+    }
+    epub_html_destroy(job->html);
+    epub_zip_stream_close(job->stream);
+    epub_zip_close(job->zip);
+    drop_writer(job);
+    free(job->record);
+    free(job->builder.data);
+    epub_parser_free_blocks(&job->cached);
+    free(job);
+}
+
+// 流式任务的 HTML 回调：记录写入缓存（写不进去只是不缓存），文本块交给调用者
+static bool stream_block(const epub_text_block_t *block, void *user) {
+    epub_blocks_job_t *job = user;
+    if (job->writer != NULL) {
+        const size_t size = epub_html_record_size(block);
+        if (size > job->record_cap) {
+            uint8_t *record = realloc(job->record, size);
+            if (record != NULL) {
+                job->record = record;
+                job->record_cap = size;
+            }
+        }
+        if (size > job->record_cap ||
+            !epub_cache_writer_append(job->writer, job->record,
+                                      epub_html_write_record(block, job->record))) {
+            ESP_LOGW(TAG, "Not caching %s", job->key.content_path);
+            drop_writer(job);
+        }
+    }
+    job->builder.count++;
+    if (!job->callback(block, job->user)) {
+        job->stopped = true;
+        return false;
+    }
+    return true;
+}
+
+static epub_blocks_job_t* blocks_open(const epub_reader_t *reader, int chapter_index,
+                                      epub_html_block_cb_t callback, void *user) {
+    if (reader == NULL || !reader->is_open) {
+        ESP_LOGE(TAG, "Invalid reader");
+        return NULL;
+    }
+    if (chapter_index < 0 || chapter_index >= reader->metadata.total_chapters) {
+        ESP_LOGE(TAG, "Invalid chapter index: %d", chapter_index);
+        return NULL;
+    }
+
+    epub_blocks_job_t *job = calloc(1, sizeof(epub_blocks_job_t));
+    if (job == NULL) {
+        return NULL;
+    }
+    job->callback = callback;
+    job->user = user;
+    const char *content_file = chapter_path(reader, chapter_index);
+    make_cache_key(&job->key, reader->epub_path, content_file, EPUB_CACHE_BLOCKS);
+    if (load_cached_blocks(&job->key, &job->cached)) {
+        ESP_LOGD(TAG, "Chapter %d blocks from cache: %d", chapter_index, job->cached.block_count);
+        job->done = callback == NULL;  // 流式任务由 step 逐块交出
+        return job;
+    }
+
+    epub_zip_file_info_t chapter_file;
+    job->zip = epub_zip_open(reader->epub_path);
+    if (job->zip == NULL || !epub_zip_find_file(job->zip, content_file, &chapter_file)) {
+        ESP_LOGE(TAG, "Chapter file not found: %s", content_file);
+        epub_parser_blocks_cancel(job);
+        return NULL;
+    }
+
+    job->stream = epub_zip_stream_open(job->zip, &chapter_file);
+    if (callback != NULL) {
+        job->html = epub_html_create(stream_block, job);
+        epub_html_set_css(job->html, reader->css);
+        job->record = malloc(BLOCKS_RECORD_INITIAL);
+        if (job->stream == NULL || job->html == NULL || job->record == NULL) {
+            epub_parser_blocks_cancel(job);
+            return NULL;
+        }
+        job->record_cap = BLOCKS_RECORD_INITIAL;
+        // 块数要到解析完才知道，缓存头里记为 0，读取时重新数
+        const epub_blocks_cache_t head = {.version = EPUB_HTML_FORMAT_VERSION, .block_count = 0};
+        job->writer = malloc(sizeof(epub_cache_writer_t));
+        if (job->writer != NULL && (!epub_cache_writer_begin(job->writer, &job->key) ||
+                                    !epub_cache_writer_append(job->writer, &head, sizeof(head)))) {
+            drop_writer(job);
+        }
+        return job;
+    }
+
+    // 记录前面留出缓存头，写缓存时不用再拷贝
+    job->html = epub_html_create(collect_block, &job->builder);
+    epub_html_set_css(job->html, reader->css);
+    job->builder.data = malloc(BLOCKS_INITIAL_CAPACITY);
+    if (job->stream == NULL || job->html == NULL || job->builder.data == NULL) {
+        epub_parser_blocks_cancel(job);
+        return NULL;
+    }
+    job->builder.capacity = BLOCKS_INITIAL_CAPACITY;
+    job->builder.size = sizeof(epub_blocks_cache_t);
+    return job;
+}
+
+epub_blocks_job_t* epub_parser_blocks_begin(const epub_reader_t *reader, int chapter_index) {
+    return blocks_open(reader, chapter_index, NULL, NULL);
+}
+
+epub_blocks_job_t* epub_parser_blocks_stream(const epub_reader_t *reader, int chapter_index,
+                                             epub_html_block_cb_t callback, void *user) {
+    return callback != NULL ? blocks_open(reader, chapter_index, callback, user) : NULL;
+}
+
+// 流式任务缓存命中：逐块交出缓存的记录
+static void step_cached(epub_blocks_job_t *job, size_t max_bytes) {
+    const size_t start = job->cached_offset;
+    epub_text_block_t block;
+    while (job->cached_offset - start < max_bytes) {
+        if (!epub_parser_next_block(&job->cached, &job->cached_offset, &block)) {
+            job->done = true;
+            return;
+        }
+        if (!job->callback(&block, job->user)) {
+            job->stopped = true;
+            job->done = true;
+            return;
+        }
+    }
+}
+
+int epub_parser_blocks_step(epub_blocks_job_t *job, size_t max_bytes) {
+    if (job == NULL) {
+        return -1;
+    }
+    if (job->callback != NULL && job->cached.data != NULL) {
+        if (!job->done) {
+            step_cached(job, max_bytes);
+        }
+        return job->done ? 0 : 1;
+    }
+    size_t total = 0;
+    while (!job->done && total < max_bytes) {
+        const int n = epub_zip_stream_read(job->stream, job->chunk, sizeof(job->chunk));
+        if (n < 0) {
+            ESP_LOGE(TAG, "Failed to inflate chapter");
+            return -1;
+        }
+        if (n == 0) {
+            epub_html_finish(job->html);
+            job->done = true;
+            break;
+        }
+        if (!epub_html_feed(job->html, job->chunk, (size_t)n)) {
+            if (job->builder.failed) {
+                return -1;
+            }
+            job->done = true;
+        }
+        total += (size_t)n;
+    }
+    return job->done ? 0 : 1;
+}
+
+bool epub_parser_blocks_finish(epub_blocks_job_t *job, epub_chapter_blocks_t *blocks) {
+    if (job == NULL || blocks == NULL) {
+        epub_parser_blocks_cancel(job);
+        return false;
+    }
+    memset(blocks, 0, sizeof(*blocks));
+    if (epub_parser_blocks_step(job, SIZE_MAX) != 0) {
+        epub_parser_blocks_cancel(job);
+        return false;
+    }
+
+    if (job->cached.data != NULL) {
+        *blocks = job->cached;
+        job->cached.data = NULL;
+    } else {
+        epub_blocks_cache_t *head = (epub_blocks_cache_t *)job->builder.data;
+        head->version = EPUB_HTML_FORMAT_VERSION;
+        head->block_count = (uint32_t)job->builder.count;
+        epub_cache_write(&job->key, job->builder.data, job->builder.size);
+
+        blocks->data = job->builder.data;
+        blocks->size = job->builder.size;
+        blocks->block_count = job->builder.count;
+        job->builder.data = NULL;
+        ESP_LOGI(TAG, "Parsed %s: %d blocks, %u bytes",
+                 job->key.content_path, blocks->block_count, (unsigned)blocks->size);
+    }
+    epub_parser_blocks_cancel(job);
+    return true;
+}
+
+bool epub_parser_blocks_close(epub_blocks_job_t *job) {
+    if (job == NULL) {
+        return false;
+    }
+    const bool ok = job->done && !job->stopped;
+    if (ok && job->writer != NULL) {
+        if (epub_cache_writer_commit(job->writer)) {
+            ESP_LOGI(TAG, "Parsed %s: %d blocks, %u bytes", job->key.content_path,
+                     job->builder.count, (unsigned)job->writer->size);
+        }
+        free(job->writer);
+        job->writer = NULL;
+    }
+    epub_parser_blocks_cancel(job);
+    return ok;
+}
+
+bool epub_parser_load_blocks(const epub_reader_t *reader, int chapter_index,
+                             epub_chapter_blocks_t *blocks) {
+    if (blocks == NULL) {
+        return false;
+    }
+    memset(blocks, 0, sizeof(*blocks));
+    epub_blocks_job_t *job = epub_parser_blocks_begin(reader, chapter_index);
+    return job != NULL && epub_parser_blocks_finish(job, blocks);
+}
+
+bool epub_parser_next_block(const epub_chapter_blocks_t *blocks, size_t *offset,
+                            epub_text_block_t *block) {
+    if (blocks == NULL || blocks->data == NULL || offset == NULL || block == NULL) {
+        return false;
+    }
+    if (*offset < sizeof(epub_blocks_cache_t)) {
+        *offset = sizeof(epub_blocks_cache_t);
+    }
+    if (*offset >= blocks->size) {
+        return false;
+    }
+    const size_t record_size = epub_html_read_record(blocks->data + *offset, blocks->size - *offset, block);
+    if (record_size == 0) {
+        ESP_LOGW(TAG, "Corrupt text block at offset %u", (unsigned)*offset);
+        return false;
+    }
+    *offset += record_size;
+    return true;
+}
+
+void epub_parser_free_blocks(epub_chapter_blocks_t *blocks) {
+    if (blocks == NULL) {
+        return;
+    }
+    free(blocks->data);
+    memset(blocks, 0, sizeof(*blocks));
+}
+
 bool epub_parser_goto_chapter(epub_reader_t *reader, int chapter_index) {
     if (reader == NULL || !reader->is_open) {
         return false;
@@ -345,8 +1388,7 @@ bool epub_parser_goto_chapter(epub_reader_t *reader, int chapter_index) {
     reader->position.current_chapter = chapter_index;
     reader->position.chapter_position = 0;
 
-    ESP_LOGI(TAG, "Jumped to chapter %d: %s",
-             chapter_index, reader->chapters[chapter_index].title);
+    ESP_LOGI(TAG, "Jumped to chapter %d: %s", chapter_index, chapter_path(reader, chapter_index));
 
     return true;
 }
@@ -392,57 +1434,13 @@ bool epub_parser_save_position(const epub_reader_t *reader) {
         return false;
     }
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS: %d", err);
-        return false;
-    }
-
-    // 使用文件名（不含路径）作为 key，避免键过长
-    const char *filename = strrchr(reader->epub_path, '/');
-    if (filename == NULL) {
-        filename = reader->epub_path;
-    } else {
-        filename++;  // 跳过 '/'
-    }
-
-    char key[64];
-    char base_key[32];  // 存储基础键名
-
-    // 创建基础键名（截断文件名到 20 字符）
-    snprintf(base_key, sizeof(base_key), "%.20s", filename);
-    // 替换文件名中的特殊字符为下划线
-    for (char *p = base_key; *p; p++) {
-        if (*p == ' ' || *p == '.' || *p == '-' || *p == '/') {
-            *p = '_';
-        }
-    }
-
-    // 保存章节
-    snprintf(key, sizeof(key), "%s%s_ch", NVS_KEY_PREFIX, base_key);
-    err = nvs_set_i32(nvs_handle, key, reader->position.current_chapter);
-
-    if (err == ESP_OK) {
-        snprintf(key, sizeof(key), "%s%s_pg", NVS_KEY_PREFIX, base_key);
-        err = nvs_set_i32(nvs_handle, key, reader->position.page_number);
-    }
-
-    if (err == ESP_OK) {
-        err = nvs_commit(nvs_handle);
-    }
-
-    nvs_close(nvs_handle);
-
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Saved position for %s: chapter=%d, page=%d",
-                 filename, reader->position.current_chapter,
-                 reader->position.page_number);
-        return true;
-    }
-
-    ESP_LOGE(TAG, "Failed to save position: %d", err);
-    return false;
+    // 只记入进度日志（内存），由日志合并后写入 NVS
+    // 章节内位置记为正文偏移而不是页码，换字体或字号后仍回到同一处
+    position_journal_put(position_journal_key(reader->epub_path),
+                         reader->position.current_chapter, (int32_t)reader->position.chapter_position);
+    ESP_LOGD(TAG, "Saved position: chapter=%d, offset=%ld",
+             reader->position.current_chapter, reader->position.chapter_position);
+    return true;
 }
 
 bool epub_parser_load_position(epub_reader_t *reader) {
@@ -450,55 +1448,38 @@ bool epub_parser_load_position(epub_reader_t *reader) {
         return false;
     }
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "No saved position found (NVS open failed: %d)", err);
-        return false;
-    }
-
-    // 使用文件名（不含路径）作为 key，与 save_position 保持一致
-    const char *filename = strrchr(reader->epub_path, '/');
-    if (filename == NULL) {
-        filename = reader->epub_path;
-    } else {
-        filename++;  // 跳过 '/'
-    }
-
-    char key[64];
-    char base_key[32];  // 存储基础键名
-
-    // 创建基础键名（截断文件名到 20 字符）
-    snprintf(base_key, sizeof(base_key), "%.20s", filename);
-    // 替换文件名中的特殊字符为下划线
-    for (char *p = base_key; *p; p++) {
-        if (*p == ' ' || *p == '.' || *p == '-' || *p == '/') {
-            *p = '_';
-        }
-    }
-
-    snprintf(key, sizeof(key), "%s%s_ch", NVS_KEY_PREFIX, base_key);
-
     int32_t saved_chapter = 0;
-    err = nvs_get_i32(nvs_handle, key, &saved_chapter);
-
-    if (err == ESP_OK) {
-        snprintf(key, sizeof(key), "%s%s_pg", NVS_KEY_PREFIX, base_key);
-        int32_t saved_page = 0;
-        err = nvs_get_i32(nvs_handle, key, &saved_page);
-
-        if (err == ESP_OK && saved_chapter >= 0 && saved_chapter < reader->metadata.total_chapters) {
-            epub_parser_goto_chapter((epub_reader_t *)reader, saved_chapter);
-            reader->position.page_number = saved_page;
-            ESP_LOGI(TAG, "Loaded position for %s: chapter=%ld, page=%ld",
-                     filename, saved_chapter, saved_page);
-            nvs_close(nvs_handle);
-            return true;
+    int32_t saved_offset = 0;
+    const uint32_t key = position_journal_key(reader->epub_path);
+    bool found = position_journal_get(key, &saved_chapter, &saved_offset);
+    if (!found) {
+        // 旧版本的 "epub_<文件名前 20 字符>_ch/_pg" 键：页码与排版有关，只迁移章节
+        const char *filename = strrchr(reader->epub_path, '/');
+        char base[21];
+        snprintf(base, sizeof(base), "%.20s", filename != NULL ? filename + 1 : reader->epub_path);
+        for (char *p = base; *p; p++) {
+            if (*p == ' ' || *p == '.' || *p == '-') {
+                *p = '_';
+            }
+        }
+        char legacy_ch[32];
+        char legacy_pg[32];
+        snprintf(legacy_ch, sizeof(legacy_ch), "epub_%s_ch", base);
+        snprintf(legacy_pg, sizeof(legacy_pg), "epub_%s_pg", base);
+        found = position_journal_migrate(key, legacy_ch, legacy_pg, &saved_chapter, &saved_offset);
+        if (found) {
+            saved_offset = 0;
+            position_journal_put(key, saved_chapter, 0);
         }
     }
+    if (found && saved_chapter >= 0 && saved_chapter < reader->metadata.total_chapters) {
+        epub_parser_goto_chapter(reader, saved_chapter);
+        reader->position.chapter_position = saved_offset > 0 ? saved_offset : 0;
+        ESP_LOGI(TAG, "Loaded position: chapter=%d, offset=%d", (int)saved_chapter, (int)saved_offset);
+        return true;
+    }
 
-    nvs_close(nvs_handle);
-    ESP_LOGW(TAG, "No saved position found for %s", filename);
+    ESP_LOGW(TAG, "No saved position found for %s", reader->epub_path);
     return false;
 }
 
@@ -508,11 +1489,7 @@ void epub_parser_cleanup(epub_reader_t *reader) {
     }
 
     epub_parser_close(reader);
-
-    if (reader->chapters != NULL) {
-        free(reader->chapters);
-        reader->chapters = NULL;
-    }
+    free_chapters(reader);
 
     ESP_LOGI(TAG, "EPUB parser cleaned up");
 }
@@ -9,19 +9,26 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include "epub_css.h"
+#include "epub_html.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// EPUB 章节信息
+// EPUB 章节信息（spine 项；标题来自目录，见 epub_parser_toc_read）
 typedef struct {
-    char title[128];         // 章节标题
-    char content_file[128];  // 内容文件路径（在 EPUB 内）
-    long file_offset;        // 文件偏移（用于快速定位）
+    const char *content_file;// 内容文件路径（在 EPUB 内，指向阅读器的路径池）
     int chapter_index;       // 章节索引
 } epub_chapter_t;
 
+// 目录项
+typedef struct {
+    char title[128];         // 标题
+    int chapter_index;       // 链接指向的章节
+    int depth;               // 嵌套层级，0 为顶层
+} epub_toc_entry_t;
+
 // EPUB 元数据
 typedef struct {
     char title[128];         // 书名
@@ -34,7 +41,7 @@ typedef struct {
 // EPUB 阅读器位置
 typedef struct {
     int current_chapter;     // 当前章节索引
-    long chapter_position;   // 章节内位置
+    long chapter_position;   // 章节内位置（展平后正文的字节偏移，与排版无关）
     int page_number;         // 当前页码
     int total_pages;         // 总页数
 } epub_position_t;
@@ -44,13 +51,28 @@ typedef struct {
     char epub_path[256];     // EPUB 文件路径
     FILE *current_file;      // 当前打开的内容文件
     epub_metadata_t metadata;// 元数据
-    epub_chapter_t *chapters;// 章节列表
+    char *chapter_paths;     // 章节路径池：各 spine 项在 EPUB 内的路径，NUL 分隔
+    uint32_t *chapter_offsets;// 第 i 章路径在池中的偏移
+    uint32_t *chapter_sizes; // 第 i 章内容文件的解压大小（ZIP uncompressed_size，0 表示未知）
+    char toc_path[128];      // 目录文档（nav.xhtml 或 NCX）在 EPUB 内的路径，没有时为空串
+    bool toc_is_nav;         // 目录文档是 EPUB3 nav
+    char cover_path[128];    // 封面图片在 EPUB 内的路径，没有时为空串
+    int toc_count;           // 目录项数，-1 表示尚未加载
+    uint8_t *toc_data;       // 缓存不可用时保存在内存中的目录表，通常为 NULL
+    epub_css_t *css;         // 全书样式表编译成的规则表（解析章节时只读），没有样式表时为 NULL
     epub_position_t position;// 当前位置
     bool is_open;            // 是否已打开
     bool is_unzipped;        // 是否已解压
     char extract_path[256];  // 解压路径
 } epub_reader_t;
 
+// 解析后的章节：EPUB_HTML_FORMAT_VERSION 格式的文本块记录，排版时直接遍历，不再解析 HTML
+typedef struct {
+    uint8_t *data;           // 缓存数据（头 + 记录）
+    size_t size;
+    int block_count;         // 文本块数
+} epub_chapter_blocks_t;
+
 /**
  * @brief 初始化 EPUB 阅读器
  * @param reader 阅读器实例指针
@@ -59,13 +81,43 @@ typedef struct {
 bool epub_parser_init(epub_reader_t *reader);
 
 /**
- * @brief 打开 EPUB 文件
+ * @brief 打开 EPUB 文件：先查 EPUB 缓存，未命中时解析 ZIP 与 OPF 并写入缓存
+ *
+ * EPUB 缓存（及其下的 flash_cache）没有锁，只能在 LVGL 任务中调用。要在后台打开时
+ * 拆成 epub_parser_open_cached / epub_parser_parse / epub_parser_store_cache
+ *
  * @param reader 阅读器实例指针
  * @param epub_path EPUB 文件路径
  * @return true 成功，false 失败
  */
 bool epub_parser_open(epub_reader_t *reader, const char *epub_path);
 
+/**
+ * @brief 只从 EPUB 缓存打开（书籍信息与规则表都已缓存时），不打开 ZIP；只能在 LVGL 任务中调用
+ * @return true 缓存命中并已打开
+ */
+bool epub_parser_open_cached(epub_reader_t *reader, const char *epub_path);
+
+/**
+ * @brief 解析 ZIP 与 OPF 打开，不读写 EPUB 缓存，可以在后台任务中调用
+ *
+ * 交回 LVGL 任务后调用 epub_parser_store_cache 写入缓存；放弃这次打开时用
+ * epub_parser_discard 释放
+ *
+ * @return true 成功，false 失败
+ */
+bool epub_parser_parse(epub_reader_t *reader, const char *epub_path);
+
+/**
+ * @brief 把 epub_parser_parse 得到的书籍信息与规则表写入 EPUB 缓存；只能在 LVGL 任务中调用
+ */
+void epub_parser_store_cache(const epub_reader_t *reader);
+
+/**
+ * @brief 释放还没有读过章节的阅读器（刚打开、尚未使用），不触碰 EPUB 缓存，可以在后台任务中调用
+ */
+void epub_parser_discard(epub_reader_t *reader);
+
 /**
  * @brief 关闭 EPUB 文件
  * @param reader 阅读器实例指针
@@ -90,9 +142,55 @@ int epub_parser_get_chapter_count(const epub_reader_t *reader);
  * @brief 获取章节信息
  * @param reader 阅读器实例指针
  * @param chapter_index 章节索引
- * @return 章节信息指针，失败返回 NULL
+ * @param chapter 输出（content_file 在阅读器关闭前有效）
+ * @return true 成功，false 索引无效
  */
-const epub_chapter_t* epub_parser_get_chapter(const epub_reader_t *reader, int chapter_index);
+bool epub_parser_get_chapter(const epub_reader_t *reader, int chapter_index, epub_chapter_t *chapter);
+
+/**
+ * @brief 章节内容文件的解压大小（估计全书页数用）
+ * @param reader 阅读器实例指针
+ * @param chapter_index 章节索引
+ * @return 字节数；未知或索引无效时为 0
+ */
+uint32_t epub_parser_chapter_size(const epub_reader_t *reader, int chapter_index);
+
+/**
+ * @brief 把文档中的相对链接（图片 src 等）解析为 EPUB 内路径
+ * @param base_path 链接所在文档在 EPUB 内的路径
+ * @param href 链接（去掉 #片段，解码 %XX，处理 ./ 与 ../）
+ * @param out 输出路径
+ * @param out_size 输出缓冲区大小
+ * @return true 成功，false 路径无效或过长
+ */
+bool epub_parser_resolve_href(const char *base_path, const char *href, char *out, size_t out_size);
+
+/**
+ * @brief 获取目录项数；首次调用时解析 NCX / nav.xhtml 并写入缓存（书中没有目录时按章节生成）
+ *
+ * 目录以偏移表的形式保存在缓存中，epub_parser_toc_read 每次只读出需要的几项，不常驻内存
+ * @param reader 阅读器实例指针
+ * @return 目录项数，失败返回 0
+ */
+int epub_parser_toc_count(epub_reader_t *reader);
+
+/**
+ * @brief 读取一段连续的目录项
+ * @param reader 阅读器实例指针
+ * @param first 第一项的序号
+ * @param entries 输出
+ * @param count 最多读取的项数
+ * @return 实际读取的项数，失败返回 0
+ */
+int epub_parser_toc_read(epub_reader_t *reader, int first, epub_toc_entry_t *entries, int count);
+
+/**
+ * @brief 查找章节对应的目录项（指向该章节的第一项，没有时为它之前最近的一项）
+ * @param reader 阅读器实例指针
+ * @param chapter_index 章节索引
+ * @return 目录项序号，目录为空时返回 0
+ */
+int epub_parser_toc_find(epub_reader_t *reader, int chapter_index);
 
 /**
  * @brief 读取章节文本内容
@@ -105,6 +203,97 @@ const epub_chapter_t* epub_parser_get_chapter(const epub_reader_t *reader, int c
 int epub_parser_read_chapter(const epub_reader_t *reader, int chapter_index,
                              char *text_buffer, size_t buffer_size);
 
+/**
+ * @brief 流式解析章节 HTML，逐块交给回调（边解压边解析，不缓存整章）
+ * @param reader 阅读器实例指针
+ * @param chapter_index 章节索引
+ * @param callback 文本块回调，返回 false 提前结束
+ * @param user 回调参数
+ * @return true 成功（包括被回调提前结束），false 失败
+ */
+bool epub_parser_parse_chapter(const epub_reader_t *reader, int chapter_index,
+                               epub_html_block_cb_t callback, void *user);
+
+/**
+ * @brief 加载章节的文本块（优先读缓存，未命中时流式解析并写入缓存）
+ * @param reader 阅读器实例指针
+ * @param chapter_index 章节索引
+ * @param blocks 输出，用完调用 epub_parser_free_blocks()
+ * @return true 成功，false 失败
+ */
+bool epub_parser_load_blocks(const epub_reader_t *reader, int chapter_index,
+                             epub_chapter_blocks_t *blocks);
+
+// 章节文本块的增量构建（后台预取时在 LVGL 定时器中分片推进）
+typedef struct epub_blocks_job epub_blocks_job_t;
+
+/**
+ * @brief 开始构建章节文本块（缓存命中时立即完成）
+ * @param reader 阅读器实例指针（构建期间需保持打开）
+ * @param chapter_index 章节索引
+ * @return 任务句柄，失败返回 NULL
+ */
+epub_blocks_job_t* epub_parser_blocks_begin(const epub_reader_t *reader, int chapter_index);
+
+/**
+ * @brief 开始流式处理章节文本块：逐块交给回调，不在内存中攒整章（epub_pipeline 使用）
+ *
+ * 缓存命中时由 epub_parser_blocks_step 逐块交出缓存的记录；未命中时边解压边解析，
+ * 记录同时追加写入缓存，完整解析后由 epub_parser_blocks_close 提交
+ * @param reader 阅读器实例指针（处理期间需保持打开）
+ * @param chapter_index 章节索引
+ * @param callback 文本块回调，返回 false 停止（不完整的结果不写缓存）
+ * @param user 回调参数
+ * @return 任务句柄，失败返回 NULL；用 epub_parser_blocks_close 或 epub_parser_blocks_cancel 结束
+ */
+epub_blocks_job_t* epub_parser_blocks_stream(const epub_reader_t *reader, int chapter_index,
+                                             epub_html_block_cb_t callback, void *user);
+
+/**
+ * @brief 推进构建：解压并解析最多约 max_bytes 字节的章节内容
+ * @param job 任务句柄
+ * @param max_bytes 本次处理的解压字节上限（流式任务缓存命中时为记录字节）
+ * @return 1 尚未完成，0 已完成，-1 出错
+ */
+int epub_parser_blocks_step(epub_blocks_job_t *job, size_t max_bytes);
+
+/**
+ * @brief 完成构建（剩余部分同步处理）、写入缓存并取出结果；任务句柄随之释放
+ * @param job 任务句柄
+ * @param blocks 输出，用完调用 epub_parser_free_blocks()
+ * @return true 成功，false 失败
+ */
+bool epub_parser_blocks_finish(epub_blocks_job_t *job, epub_chapter_blocks_t *blocks);
+
+/**
+ * @brief 结束流式任务：已完整处理的章节提交到缓存；任务句柄随之释放
+ * @param job 任务句柄（epub_parser_blocks_stream 创建）
+ * @return true 章节已完整处理，false 未完成或被回调停止
+ */
+bool epub_parser_blocks_close(epub_blocks_job_t *job);
+
+/**
+ * @brief 取消构建并释放任务句柄
+ * @param job 任务句柄（可为 NULL）
+ */
+void epub_parser_blocks_cancel(epub_blocks_job_t *job);
+
+/**
+ * @brief 取下一个文本块（指针指向 blocks->data，释放前有效）
+ * @param blocks 章节文本块
+ * @param offset 遍历位置，从 0 开始；可保存下来作为块的定位
+ * @param block 输出文本块
+ * @return true 成功，false 已到末尾
+ */
+bool epub_parser_next_block(const epub_chapter_blocks_t *blocks, size_t *offset,
+                            epub_text_block_t *block);
+
+/**
+ * @brief 释放章节文本块
+ * @param blocks 章节文本块
+ */
+void epub_parser_free_blocks(epub_chapter_blocks_t *blocks);
+
 /**
  * @brief 跳转到指定章节
  * @param reader 阅读器实例指针
@@ -156,6 +345,9 @@ void epub_parser_cleanup(epub_reader_t *reader);
 
 /**
  * @brief 验证文件是否为有效的 EPUB
+ *
+ * 扩展名为 .epub 且 ZIP 结构完整（见 epub_zip_probe）；mimetype 不规范的书仍视为有效
+ *
  * @param file_path 文件路径
  * @return true 是 EPUB，false 不是
  */
@@ -0,0 +1,140 @@
+/**
+ * @file epub_pipeline.c
+ * @brief EPUB 章节流水线实现
+ */
+
+#include "epub_pipeline.h"
+#include "epub_progress.h"
+#include "lvgl_driver.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "EPUB_PIPELINE";
+
+#define PIPELINE_PERIOD_MS  40     // 后台定时器周期
+#define PIPELINE_SLICE_MS   15     // 每次最多占用 LVGL 任务的时长
+#define PIPELINE_STEP_BYTES 2048   // 源阶段每步处理的字节数
+
+static struct {
+    epub_blocks_job_t *job;      // 源阶段（解压 + HTML 解析，或缓存的记录），读完后为 NULL
+    epub_pages_t *pages;         // 阅读器的章节分页，NULL 表示空闲
+    text_layout_t *layout;
+    lv_timer_t *timer;
+} s_pipe;
+
+// 源阶段的文本块回调：展平追加到正文（内存不足时停止，已追加的部分照常可读）
+static bool append_block(const epub_text_block_t *block, void *user) {
+    (void)user;
+    return epub_pages_append(s_pipe.pages, block);
+}
+
+// 源阶段：解压并解析一步；读完后提交文本块缓存，正文定稿
+static void stage_source(void) {
+    const int r = epub_parser_blocks_step(s_pipe.job, PIPELINE_STEP_BYTES);
+    if (r > 0) {
+        return;
+    }
+    bool ok = false;
+    if (r == 0) {
+        ok = epub_parser_blocks_close(s_pipe.job);
+    } else {
+        epub_parser_blocks_cancel(s_pipe.job);
+    }
+    s_pipe.job = NULL;
+    if (!epub_pages_end(s_pipe.pages) || !ok) {
+        ESP_LOGW(TAG, "Chapter %d truncated at %u bytes", s_pipe.pages->chapter_index,
+                 (unsigned)s_pipe.pages->text_len);
+    }
+}
+
+// 一轮：先把已有正文能确定的页排完，再让源推进一步（分页在前，第一页尽早确定）
+static void run_round(uint32_t budget_ms) {
+    epub_pages_paginate(s_pipe.pages, s_pipe.layout, budget_ms);
+    if (s_pipe.job != NULL) {
+        stage_source();
+    }
+}
+
+// 源读完且分页到章末：记下页数，流水线结束
+static bool finish_if_done(void) {
+    if (s_pipe.job != NULL || !s_pipe.pages->complete) {
+        return false;
+    }
+    ESP_LOGI(TAG, "Chapter %d ready: %d pages", s_pipe.pages->chapter_index, s_pipe.pages->page_count);
+    epub_progress_record(s_pipe.pages->chapter_index, s_pipe.pages->page_count);
+    if (s_pipe.timer != NULL) {
+        lv_timer_delete(s_pipe.timer);
+    }
+    memset(&s_pipe, 0, sizeof(s_pipe));
+    return true;
+}
+
+static void pipeline_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    // 刷新任务正在上传时让出，避免与之争抢 CPU 和 SPI
+    if (lvgl_is_refreshing()) {
+        return;
+    }
+    const uint32_t t0 = lv_tick_get();
+    uint32_t used = 0;
+    while (used < PIPELINE_SLICE_MS) {
+        run_round(PIPELINE_SLICE_MS - used);
+        if (finish_if_done()) {
+            return;
+        }
+        used = lv_tick_elaps(t0);
+    }
+}
+
+bool epub_pipeline_open(const epub_reader_t *reader, int chapter_index, text_layout_t *layout,
+                        epub_pages_t *pages) {
+    epub_pipeline_cancel();
+    if (reader == NULL || layout == NULL || pages == NULL) {
+        return false;
+    }
+    epub_blocks_job_t *job = epub_parser_blocks_stream(reader, chapter_index, append_block, NULL);
+    if (job == NULL) {
+        return false;
+    }
+    epub_pages_free(pages);
+    if (!epub_pages_begin(pages, chapter_index, epub_parser_chapter_size(reader, chapter_index))) {
+        epub_parser_blocks_cancel(job);
+        return false;
+    }
+    s_pipe.job = job;
+    s_pipe.pages = pages;
+    s_pipe.layout = layout;
+    s_pipe.timer = lv_timer_create(pipeline_timer_cb, PIPELINE_PERIOD_MS, NULL);
+    if (s_pipe.timer == NULL) {
+        epub_pipeline_wait(-1, UINT32_MAX);  // 没有定时器就在这里做完
+    }
+    return true;
+}
+
+// 第 page 页就绪，且已知的最后一个页首超过 offset（包含 offset 的页已确定）
+static bool target_ready(const epub_pages_t *pages, int page, uint32_t offset) {
+    return pages->complete ||
+           (epub_pages_page_ready(pages, page) && pages->page_starts[pages->page_count - 1] > offset);
+}
+
+void epub_pipeline_wait(int page, uint32_t offset) {
+    while (s_pipe.pages != NULL && !target_ready(s_pipe.pages, page, offset)) {
+        run_round(0);
+        finish_if_done();
+    }
+}
+
+bool epub_pipeline_is_idle(void) {
+    return s_pipe.pages == NULL;
+}
+
+void epub_pipeline_cancel(void) {
+    if (s_pipe.timer != NULL) {
+        lv_timer_delete(s_pipe.timer);
+    }
+    epub_parser_blocks_cancel(s_pipe.job);
+    if (s_pipe.pages != NULL) {
+        epub_pages_end(s_pipe.pages);
+    }
+    memset(&s_pipe, 0, sizeof(s_pipe));
+}
@@ -0,0 +1,63 @@
+/**
+ * @file epub_pipeline.h
+ * @brief EPUB 章节流水线 - 解压、解析、展平与分页交错推进，需要的页一就绪就显示
+ *
+ * 打开章节时不再依次做完整章解压、整章解析、展平、分页：各阶段是状态保存在流水线里的
+ * 无栈协程，在 LVGL 任务中交错推进（字体回调与 EPUB 缓存都不是线程安全的，与预取相同）：
+ *   ZIP 读取 + inflate（32KB 字典窗口）→ 2KB 读取块 → HTML 解析（4KB 段落 arena）
+ *   → 展平追加到章节正文，记录同时流式写入文本块缓存 → 分页（落后 EPUB_PAGES_LOOKAHEAD）
+ * 阶段之间只有这些固定大小的缓冲区，中间结果不随章节变大，正文本身按 epub_pages 常驻。
+ * 缓存命中时源阶段改为逐块交出缓存的记录。阅读器用 epub_pipeline_wait 等到要显示的页
+ * 确定即可绘制，其余部分由定时器在后台完成
+ */
+
+#ifndef EPUB_PIPELINE_H
+#define EPUB_PIPELINE_H
+
+#include "epub_pages.h"
+#include "epub_parser.h"
+#include "text_layout.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 开始流式加载章节（同时只有一条流水线，进行中的先取消）
+ *
+ * 源打开成功后 pages 中原来的章节被释放，pages 改为边追加边分页的新章节；
+ * 运行期间 pages 的地址不能变，释放或覆盖之前须先调用 epub_pipeline_cancel
+ *
+ * @param reader 阅读器（运行期间需保持打开）
+ * @param chapter_index 章节索引
+ * @param layout 排版上下文
+ * @param pages 输出
+ * @return true 已开始（至少能等到第一页），false 失败（pages 不变）
+ */
+bool epub_pipeline_open(const epub_reader_t *reader, int chapter_index, text_layout_t *layout,
+                        epub_pages_t *pages);
+
+/**
+ * @brief 同步推进，直到第 page 页（从 0 开始）就绪且包含 offset 的页已确定，或章节分页完成
+ * @param page 需要的页，-1 表示不限
+ * @param offset 需要的正文偏移，0 表示不限
+ */
+void epub_pipeline_wait(int page, uint32_t offset);
+
+/**
+ * @brief 没有进行中的流水线
+ */
+bool epub_pipeline_is_idle(void);
+
+/**
+ * @brief 取消流水线：已追加的正文定稿为截断的章节，仍可阅读（不写文本块缓存）
+ */
+void epub_pipeline_cancel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_PIPELINE_H
@@ -0,0 +1,183 @@
+/**
+ * @file epub_prefetch.c
+ * @brief EPUB 后台章节预取实现
+ */
+
+#include "epub_prefetch.h"
+#include "epub_progress.h"
+#include "lvgl_driver.h"
+#include "mem_pressure.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "EPUB_PREFETCH";
+
+#define PREFETCH_PERIOD_MS  40     // 定时器周期
+#define PREFETCH_SLICE_MS   15     // 每次最多占用 LVGL 任务的时长
+#define PREFETCH_STEP_BYTES 4096   // 每步解压的字节数（按时间片重复）
+
+typedef enum {
+    PREFETCH_IDLE,
+    PREFETCH_PARSE,      // 解压 + 解析 HTML
+    PREFETCH_PAGINATE,   // 计算页边界
+    PREFETCH_DONE,
+} prefetch_stage_t;
+
+static struct {
+    prefetch_stage_t stage;
+    int chapter_index;
+    text_layout_t *layout;
+    epub_blocks_job_t *job;
+    epub_pages_t pages;
+    lv_timer_t *timer;
+    bool count_only;     // 只为估计全书页数而分页：完成后记下页数即释放
+} s_prefetch = {
+    .stage = PREFETCH_IDLE,
+    .chapter_index = -1,
+};
+
+static void stop_timer(void) {
+    if (s_prefetch.timer != NULL) {
+        lv_timer_delete(s_prefetch.timer);
+        s_prefetch.timer = NULL;
+    }
+}
+
+// 解析完成：展平文本块，进入分页阶段
+static bool enter_paginate(void) {
+    epub_chapter_blocks_t blocks;
+    epub_blocks_job_t *job = s_prefetch.job;
+    s_prefetch.job = NULL;
+    if (!epub_parser_blocks_finish(job, &blocks)) {
+        return false;
+    }
+    const bool ok = epub_pages_init(&s_prefetch.pages, s_prefetch.chapter_index, &blocks);
+    epub_parser_free_blocks(&blocks);
+    s_prefetch.stage = PREFETCH_PAGINATE;
+    return ok;
+}
+
+static void prefetch_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    // 刷新任务正在上传时让出，避免与之争抢 CPU 和 SPI
+    if (lvgl_is_refreshing()) {
+        return;
+    }
+
+    const uint32_t t0 = lv_tick_get();
+    bool failed = false;
+    while (s_prefetch.stage == PREFETCH_PARSE && lv_tick_elaps(t0) < PREFETCH_SLICE_MS) {
+        const int r = epub_parser_blocks_step(s_prefetch.job, PREFETCH_STEP_BYTES);
+        if (r < 0 || (r == 0 && !enter_paginate())) {
+            failed = true;
+            break;
+        }
+    }
+
+    if (!failed && s_prefetch.stage == PREFETCH_PAGINATE) {
+        const uint32_t used = lv_tick_elaps(t0);
+        if (used < PREFETCH_SLICE_MS &&
+            epub_pages_paginate(&s_prefetch.pages, s_prefetch.layout, PREFETCH_SLICE_MS - used)) {
+            ESP_LOGI(TAG, "Chapter %d ready: %d pages", s_prefetch.chapter_index,
+                     s_prefetch.pages.page_count);
+            epub_progress_record(s_prefetch.chapter_index, s_prefetch.pages.page_count);
+            s_prefetch.stage = PREFETCH_DONE;
+            stop_timer();
+            if (s_prefetch.count_only) {
+                epub_prefetch_cancel();
+            }
+        }
+    }
+
+    if (failed) {
+        ESP_LOGW(TAG, "Prefetch of chapter %d failed", s_prefetch.chapter_index);
+        epub_prefetch_cancel();
+    }
+}
+
+// 内存压力回调：预取的章节随时可以重新解析，整个放弃（推迟到轮询时运行，
+// 不会打断正在进行的一步）
+static bool prefetch_shrink(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    if (s_prefetch.stage == PREFETCH_IDLE) {
+        return false;
+    }
+    ESP_LOGW(TAG, "Dropping prefetch of chapter %d under memory pressure", s_prefetch.chapter_index);
+    epub_prefetch_cancel();
+    return true;
+}
+
+static void prefetch_begin(const epub_reader_t *reader, int chapter_index, text_layout_t *layout,
+                           bool count_only) {
+    if (reader == NULL || layout == NULL) {
+        return;
+    }
+    if (s_prefetch.stage != PREFETCH_IDLE && s_prefetch.chapter_index == chapter_index) {
+        s_prefetch.count_only = s_prefetch.count_only && count_only;  // 真正的预取接管计数
+        return;
+    }
+    epub_prefetch_cancel();
+
+    s_prefetch.job = epub_parser_blocks_begin(reader, chapter_index);
+    if (s_prefetch.job == NULL) {
+        return;
+    }
+    s_prefetch.timer = lv_timer_create(prefetch_timer_cb, PREFETCH_PERIOD_MS, NULL);
+    if (s_prefetch.timer == NULL) {
+        epub_parser_blocks_cancel(s_prefetch.job);
+        s_prefetch.job = NULL;
+        return;
+    }
+    s_prefetch.stage = PREFETCH_PARSE;
+    s_prefetch.chapter_index = chapter_index;
+    s_prefetch.layout = layout;
+    s_prefetch.count_only = count_only;
+    mem_pressure_register("epub_prefetch", MEM_PRESSURE_PRIO_SPECULATIVE, HEAP_TAG_EPUB, 0,
+                          prefetch_shrink, NULL);
+    ESP_LOGD(TAG, "%s chapter %d", count_only ? "Counting pages of" : "Prefetching", chapter_index);
+}
+
+void epub_prefetch_start(const epub_reader_t *reader, int chapter_index, text_layout_t *layout) {
+    prefetch_begin(reader, chapter_index, layout, false);
+}
+
+void epub_prefetch_count(const epub_reader_t *reader, int chapter_index, text_layout_t *layout) {
+    prefetch_begin(reader, chapter_index, layout, true);
+}
+
+bool epub_prefetch_is_idle(void) {
+    return s_prefetch.stage == PREFETCH_IDLE;
+}
+
+bool epub_prefetch_take(int chapter_index, epub_pages_t *pages) {
+    if (s_prefetch.stage == PREFETCH_IDLE || s_prefetch.chapter_index != chapter_index) {
+        epub_prefetch_cancel();
+        return false;
+    }
+
+    stop_timer();
+    bool ok = true;
+    if (s_prefetch.stage == PREFETCH_PARSE) {
+        ok = enter_paginate();
+    }
+    if (ok) {
+        epub_pages_paginate(&s_prefetch.pages, s_prefetch.layout, 0);
+        *pages = s_prefetch.pages;
+        memset(&s_prefetch.pages, 0, sizeof(s_prefetch.pages));
+    }
+    epub_prefetch_cancel();
+    return ok;
+}
+
+void epub_prefetch_cancel(void) {
+    mem_pressure_unregister(prefetch_shrink, NULL);
+    stop_timer();
+    epub_parser_blocks_cancel(s_prefetch.job);
+    s_prefetch.job = NULL;
+    epub_pages_free(&s_prefetch.pages);
+    s_prefetch.stage = PREFETCH_IDLE;
+    s_prefetch.chapter_index = -1;
+    s_prefetch.layout = NULL;
+    s_prefetch.count_only = false;
+}
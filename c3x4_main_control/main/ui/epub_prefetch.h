@@ -0,0 +1,58 @@
+/**
+ * @file epub_prefetch.h
+ * @brief EPUB 后台章节预取 - 阅读接近章末时提前解析并分页下一章
+ *
+ * 预取在 LVGL 任务中用定时器分片推进（与 page_index 相同：字体回调和 EPUB 缓存都不是
+ * 线程安全的，不能放到独立任务）：解压 + HTML 解析写入 EPUB 缓存，再展平并按当前排版
+ * 计算页边界。EPD 正在刷新时让出本次时间片；跳到别处时取消，已写入缓存的部分仍然有效
+ */
+
+#ifndef EPUB_PREFETCH_H
+#define EPUB_PREFETCH_H
+
+#include "epub_pages.h"
+#include "epub_parser.h"
+#include "text_layout.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 开始预取章节（同一章节已在预取或已完成时不做任何事，其它章节的预取被取消）
+ * @param reader 阅读器（预取期间需保持打开）
+ * @param chapter_index 章节索引
+ * @param layout 排版上下文（排版参数改变时必须先调用 epub_prefetch_cancel）
+ */
+void epub_prefetch_start(const epub_reader_t *reader, int chapter_index, text_layout_t *layout);
+
+/**
+ * @brief 只为统计页数而分页一章（估计全书页数用）：完成后页数交给 epub_progress_record，
+ * 结果随即释放。epub_prefetch_start 会取消它（或对同一章节接管它）
+ */
+void epub_prefetch_count(const epub_reader_t *reader, int chapter_index, text_layout_t *layout);
+
+/**
+ * @brief 没有进行中或已完成待取的预取
+ */
+bool epub_prefetch_is_idle(void);
+
+/**
+ * @brief 取出预取结果；尚未完成的部分在这里同步完成，其它章节的预取被取消
+ * @param chapter_index 需要的章节
+ * @param pages 输出（成功时所有权转交调用者）
+ * @return true 成功，false 该章节没有在预取
+ */
+bool epub_prefetch_take(int chapter_index, epub_pages_t *pages);
+
+/**
+ * @brief 取消预取并释放所有中间结果
+ */
+void epub_prefetch_cancel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_PREFETCH_H
@@ -0,0 +1,154 @@
+/**
+ * @file epub_progress.c
+ * @brief EPUB 全书页码估计实现
+ */
+
+#include "epub_progress.h"
+#include "epub_pipeline.h"
+#include "epub_prefetch.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "EPUB_PROGRESS";
+
+static struct {
+    const epub_reader_t *reader;
+    text_layout_t *layout;
+    int chapter_count;
+    uint16_t *pages;           // 已分页章节的精确页数，0 表示还没有分页
+    int known;                 // 已分页的章节数
+    uint64_t known_bytes;      // 已分页章节的解压大小之和
+    uint32_t known_pages;      // 已分页章节的页数之和
+    uint32_t fallback;         // 还没有实测时的每页字节数
+    uint32_t average_size;     // 已知大小的章节的平均大小（代替未知的大小）
+    int next_survey;           // 后台统计从这一章开始找没有分页的章节
+    lv_timer_t *timer;
+} s_progress;
+
+// 章节大小；未知时取已知章节的平均大小
+static uint32_t chapter_size(int chapter_index) {
+    const uint32_t size = epub_parser_chapter_size(s_progress.reader, chapter_index);
+    return size > 0 ? size : s_progress.average_size;
+}
+
+// 未分页章节的估计页数（至少 1 页）
+static int estimate_pages(int chapter_index) {
+    const uint64_t size = chapter_size(chapter_index);
+    uint64_t pages;
+    if (s_progress.known_pages > 0 && s_progress.known_bytes > 0) {
+        pages = (size * s_progress.known_pages + s_progress.known_bytes / 2) / s_progress.known_bytes;
+    } else {
+        pages = (size + s_progress.fallback / 2) / s_progress.fallback;
+    }
+    return pages > 0 ? (int)pages : 1;
+}
+
+static int chapter_pages(int chapter_index) {
+    const int exact = s_progress.pages[chapter_index];
+    return exact > 0 ? exact : estimate_pages(chapter_index);
+}
+
+static void stop_survey(void) {
+    if (s_progress.timer != NULL) {
+        lv_timer_delete(s_progress.timer);
+        s_progress.timer = NULL;
+    }
+}
+
+// 预取与章节流水线都空闲时统计下一章没有分页的章节；真正的预取（下一章）优先，会取消这里发起的统计
+static void survey_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (s_progress.known >= s_progress.chapter_count) {
+        ESP_LOGI(TAG, "All %d chapters paginated: %u pages", s_progress.chapter_count,
+                 (unsigned)s_progress.known_pages);
+        stop_survey();
+        return;
+    }
+    if (!epub_prefetch_is_idle() || !epub_pipeline_is_idle()) {
+        return;
+    }
+    for (int n = 0; n < s_progress.chapter_count; n++) {
+        const int chapter = (s_progress.next_survey + n) % s_progress.chapter_count;
+        if (s_progress.pages[chapter] == 0) {
+            s_progress.next_survey = (chapter + 1) % s_progress.chapter_count;
+            epub_prefetch_count(s_progress.reader, chapter, s_progress.layout);
+            return;
+        }
+    }
+}
+
+void epub_progress_open(const epub_reader_t *reader, text_layout_t *layout, uint32_t fallback_bytes_per_page) {
+    epub_progress_close();
+    const int count = epub_parser_get_chapter_count(reader);
+    if (count <= 0 || layout == NULL) {
+        return;
+    }
+    s_progress.pages = calloc(count, sizeof(uint16_t));
+    if (s_progress.pages == NULL) {
+        return;
+    }
+    s_progress.reader = reader;
+    s_progress.layout = layout;
+    s_progress.chapter_count = count;
+    uint64_t total = 0;
+    int sized = 0;
+    for (int i = 0; i < count; i++) {
+        const uint32_t size = epub_parser_chapter_size(reader, i);
+        total += size;
+        sized += size > 0;
+    }
+    s_progress.average_size = sized > 0 ? (uint32_t)(total / sized) : 0;
+    s_progress.fallback = fallback_bytes_per_page > 0 ? fallback_bytes_per_page : 1;
+    // 从当前章节往后统计，先变准的是接下来要读的部分
+    const int current = reader->position.current_chapter;
+    s_progress.next_survey = current >= 0 && current < count ? current : 0;
+    s_progress.timer = lv_timer_create(survey_timer_cb, EPUB_PROGRESS_SURVEY_MS, NULL);
+}
+
+void epub_progress_record(int chapter_index, int page_count) {
+    if (s_progress.pages == NULL || chapter_index < 0 || chapter_index >= s_progress.chapter_count ||
+        page_count <= 0) {
+        return;
+    }
+    if (page_count > UINT16_MAX) {
+        page_count = UINT16_MAX;
+    }
+    uint16_t *slot = &s_progress.pages[chapter_index];
+    if (*slot == 0) {
+        s_progress.known++;
+        s_progress.known_bytes += chapter_size(chapter_index);
+    } else {
+        s_progress.known_pages -= *slot;
+    }
+    *slot = (uint16_t)page_count;
+    s_progress.known_pages += *slot;
+}
+
+int epub_progress_pages_before(int chapter_index) {
+    if (s_progress.pages == NULL) {
+        return 0;
+    }
+    if (chapter_index > s_progress.chapter_count) {
+        chapter_index = s_progress.chapter_count;
+    }
+    int pages = 0;
+    for (int i = 0; i < chapter_index; i++) {
+        pages += chapter_pages(i);
+    }
+    return pages;
+}
+
+int epub_progress_total(void) {
+    return epub_progress_pages_before(s_progress.chapter_count);
+}
+
+bool epub_progress_is_exact(void) {
+    return s_progress.pages != NULL && s_progress.known >= s_progress.chapter_count;
+}
+
+void epub_progress_close(void) {
+    stop_survey();
+    free(s_progress.pages);
+    memset(&s_progress, 0, sizeof(s_progress));
+}
@@ -0,0 +1,65 @@
+/**
+ * @file epub_progress.h
+ * @brief EPUB 全书页码估计 - 按章节解压大小与实测的每页字节数换算，分页后换成精确值
+ *
+ * 打开书时只分页了当前章节。其余章节的页数按 ZIP 中内容文件的 uncompressed_size
+ * 除以实测的每页字节数估计（已分页章节的总字节数 / 总页数，还没有实测时用 fallback），
+ * 每有一章分页完成（打开、翻到、预取或后台统计）就换成精确页数并更新平均值。
+ * 阅读期间后台用 epub_prefetch_count 逐章统计其余章节，全部完成后全书页码是精确的。
+ * 排版参数改变时重新调用 epub_progress_open
+ *
+ * 与 page_index 一样只有一个实例，所有函数在 LVGL 任务中调用
+ */
+
+#ifndef EPUB_PROGRESS_H
+#define EPUB_PROGRESS_H
+
+#include "epub_parser.h"
+#include "text_layout.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EPUB_PROGRESS_SURVEY_MS 1000   // 后台统计：预取空闲时每隔这么久开始统计下一章
+
+/**
+ * @brief 打开书籍或排版参数改变后调用：读取各章大小，清除实测页数，开始后台统计
+ * @param reader 阅读器（统计期间需保持打开）
+ * @param layout 排版上下文
+ * @param fallback_bytes_per_page 还没有实测时的每页字节数
+ */
+void epub_progress_open(const epub_reader_t *reader, text_layout_t *layout, uint32_t fallback_bytes_per_page);
+
+/**
+ * @brief 记录章节分页完成后的精确页数
+ */
+void epub_progress_record(int chapter_index, int page_count);
+
+/**
+ * @brief 第 chapter_index 章之前的页数（估计值，前面各章都已分页时为精确值）
+ */
+int epub_progress_pages_before(int chapter_index);
+
+/**
+ * @brief 全书页数（估计值）；没有打开书籍时为 0
+ */
+int epub_progress_total(void);
+
+/**
+ * @brief 所有章节都已分页，全书页码是精确值
+ */
+bool epub_progress_is_exact(void);
+
+/**
+ * @brief 停止后台统计并释放
+ */
+void epub_progress_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EPUB_PROGRESS_H
@@ -1,9 +1,10 @@
 /**
  * @file epub_xml.c
- * @brief EPUB XML 解析器实现 - 简化版，手动解析不依赖 TinyXML2
+ * @brief EPUB XML 解析器实现 - 单遍流式 SAX，手动解析不依赖 TinyXML2
  */
 
 #include "epub_xml.h"
+#include "page_index.h"
 #include "esp_log.h"
 #include <stdio.h>
 #include <string.h>
@@ -12,241 +13,978 @@
 
 static const char *TAG = "EPUB_XML";
 
+#define XML_TEXT_CHUNK  256   // 文本攒到这么多字节交给回调一次
+
+typedef enum {
+    XML_STATE_TEXT,
+    XML_STATE_ENTITY,
+    XML_STATE_TAG,
+    XML_STATE_COMMENT,
+    XML_STATE_CDATA,
+} xml_state_t;
+
 struct epub_xml_parser {
-    char *content;
-    size_t length;
-    size_t pos;
+    epub_xml_handler_t handler;
+    xml_state_t state;
+    char quote;                      // 标签内当前所在的引号，0 表示不在引号内
+    uint8_t tail;                    // 注释 "-->" / CDATA "]]>" 的匹配进度
+    size_t tag_len;
+    size_t text_len;
+    size_t entity_len;
+    size_t fed;                      // 已送入的字节数
+    size_t limit;                    // 输入上限
+    bool over_limit;
+    char tag[EPUB_XML_TAG_MAX + 1];
+    char text[XML_TEXT_CHUNK];
+    char entity[EPUB_XML_ENTITY_MAX + 1];
 };
 
-// XML 标签辅助函数
-static const char* find_tag(const char *xml, size_t len, const char *tag, size_t *tag_len) {
-    char open_tag[64];
-    snprintf(open_tag, sizeof(open_tag), "<%s", tag);
+// ---------------------------------------------------------------------------
+// 实体解码
+// ---------------------------------------------------------------------------
+
+static size_t utf8_encode(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+size_t epub_xml_decode_entity(const char *name, size_t len, char *out) {
+    // XML 预定义实体 + XHTML 章节里常见的排版实体
+    static const struct { const char *name; uint32_t cp; } named[] = {
+        {"amp", '&'}, {"lt", '<'}, {"gt", '>'}, {"quot", '"'}, {"apos", '\''}, {"nbsp", 0xA0},
+        {"shy", 0xAD}, {"copy", 0xA9}, {"reg", 0xAE}, {"middot", 0xB7}, {"laquo", 0xAB},
+        {"raquo", 0xBB}, {"ndash", 0x2013}, {"mdash", 0x2014}, {"lsquo", 0x2018},
+        {"rsquo", 0x2019}, {"ldquo", 0x201C}, {"rdquo", 0x201D}, {"bull", 0x2022},
+        {"hellip", 0x2026}, {"trade", 0x2122},
+    };
 
-    const char *start = strstr(xml, open_tag);
-    if (!start) return NULL;
+    if (len >= 2 && name[0] == '#') {
+        uint32_t cp = 0;
+        const bool hex = name[1] == 'x' || name[1] == 'X';
+        for (size_t i = hex ? 2 : 1; i < len; i++) {
+            const char c = name[i];
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (hex && (c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+                digit = (c | 0x20) - 'a' + 10;
+            } else {
+                return 0;
+            }
+            cp = cp * (hex ? 16 : 10) + (uint32_t)digit;
+            if (cp > 0x10FFFF) {
+                return 0;
+            }
+        }
+        if (cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            return 0;
+        }
+        return utf8_encode(cp, out);
+    }
 
-    // 查找闭合的 '>'
-    const char *end = strchr(start, '>');
-    if (!end) return NULL;
+    for (size_t i = 0; i < sizeof(named) / sizeof(named[0]); i++) {
+        if (strlen(named[i].name) == len && memcmp(named[i].name, name, len) == 0) {
+            return utf8_encode(named[i].cp, out);
+        }
+    }
+    return 0;
+}
 
-    *tag_len = end - start + 1;
-    return start;
+void epub_xml_decode_entities(char *s) {
+    char *out = s;
+    while (*s) {
+        if (*s == '&') {
+            const char *semi = strchr(s + 1, ';');
+            char utf8[4];
+            size_t n;
+            if (semi && semi - s - 1 <= EPUB_XML_ENTITY_MAX &&
+                (n = epub_xml_decode_entity(s + 1, semi - s - 1, utf8)) > 0) {
+                memcpy(out, utf8, n);
+                out += n;
+                s = (char *)semi + 1;
+                continue;
+            }
+        }
+        *out++ = *s++;
+    }
+    *out = '\0';
 }
 
-static const char* find_closing_tag(const char *xml, size_t len, const char *tag) {
-    char close_tag[64];
-    snprintf(close_tag, sizeof(close_tag), "</%s>", tag);
-    return strstr(xml, close_tag);
+// ---------------------------------------------------------------------------
+// 分词
+// ---------------------------------------------------------------------------
+
+static void text_flush(epub_xml_parser_t *p) {
+    if (p->text_len > 0 && p->handler.text) {
+        p->handler.text(p->handler.user, p->text, p->text_len);
+    }
+    p->text_len = 0;
 }
 
-// 提取标签属性值
-static bool extract_attribute(const char *tag_start, const char *attr_name, char *value, size_t value_size) {
-    const char *attr = strstr(tag_start, attr_name);
-    if (!attr) return false;
+static void text_put(epub_xml_parser_t *p, const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p->text_len == sizeof(p->text)) {
+            text_flush(p);
+        }
+        p->text[p->text_len++] = data[i];
+    }
+}
 
-    attr += strlen(attr_name);
-    while (*attr == ' ' || *attr == '=') attr++;
-    if (*attr == '"') attr++;
+static const char *local_name(const char *name) {
+    const char *colon = strchr(name, ':');
+    return colon ? colon + 1 : name;
+}
 
-    const char *end = strchr(attr, '"');
-    if (!end) return false;
+static bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
 
-    size_t len = end - attr;
-    if (len >= value_size) len = value_size - 1;
-    memcpy(value, attr, len);
-    value[len] = '\0';
+static void process_tag(epub_xml_parser_t *p) {
+    char *t = p->tag;
+    t[p->tag_len] = '\0';
 
-    return true;
+    // 处理指令、DOCTYPE 等
+    if (t[0] == '?' || t[0] == '!' || t[0] == '\0') {
+        return;
+    }
+
+    if (t[0] == '/') {
+        char *name = t + 1;
+        char *end = name;
+        while (*end && !is_space(*end)) {
+            end++;
+        }
+        *end = '\0';
+        if (p->handler.end_element) {
+            p->handler.end_element(p->handler.user, local_name(name));
+        }
+        return;
+    }
+
+    // 自闭合 <x ... />
+    size_t len = p->tag_len;
+    while (len > 0 && is_space(t[len - 1])) {
+        len--;
+    }
+    const bool self_closing = len > 0 && t[len - 1] == '/';
+    if (self_closing) {
+        len--;
+    }
+    t[len] = '\0';
+
+    char *s = t;
+    while (*s && !is_space(*s)) {
+        s++;
+    }
+    char *name = t;
+    const char *attrs[EPUB_XML_ATTR_MAX * 2 + 1];
+    int attr_count = 0;
+
+    if (*s) {
+        *s++ = '\0';
+    }
+    while (*s && attr_count < EPUB_XML_ATTR_MAX) {
+        while (is_space(*s)) {
+            s++;
+        }
+        if (!*s) {
+            break;
+        }
+        char *attr_name = s;
+        while (*s && *s != '=' && !is_space(*s)) {
+            s++;
+        }
+        char *name_end = s;
+        while (is_space(*s)) {
+            s++;
+        }
+        if (*s != '=') {
+            *name_end = '\0';
+            continue;  // 没有值的属性（HTML 风格），忽略
+        }
+        s++;
+        while (is_space(*s)) {
+            s++;
+        }
+        const char q = *s;
+        if (q != '"' && q != '\'') {
+            break;
+        }
+        char *value = ++s;
+        while (*s && *s != q) {
+            s++;
+        }
+        const bool closed = *s == q;
+        *name_end = '\0';
+        *s = '\0';
+        epub_xml_decode_entities(value);
+        attrs[attr_count * 2] = local_name(attr_name);
+        attrs[attr_count * 2 + 1] = value;
+        attr_count++;
+        if (!closed) {
+            break;  // 标签被截断
+        }
+        s++;
+    }
+    attrs[attr_count * 2] = NULL;
+
+    name = (char *)local_name(name);
+    if (p->handler.start_element) {
+        p->handler.start_element(p->handler.user, name, attrs);
+    }
+    if (self_closing && p->handler.end_element) {
+        p->handler.end_element(p->handler.user, name);
+    }
 }
 
-epub_xml_parser_t* epub_xml_create(const char *xml_content, size_t content_length) {
+epub_xml_parser_t* epub_xml_create(const epub_xml_handler_t *handler) {
     epub_xml_parser_t *parser = calloc(1, sizeof(epub_xml_parser_t));
     if (!parser) {
         ESP_LOGE(TAG, "Failed to allocate parser");
         return NULL;
     }
+    if (handler) {
+        parser->handler = *handler;
+    }
+    parser->state = XML_STATE_TEXT;
+    parser->limit = EPUB_XML_MAX_INPUT;
+    return parser;
+}
 
-    parser->content = strndup(xml_content, content_length);
-    parser->length = content_length;
-    parser->pos = 0;
+void epub_xml_set_limit(epub_xml_parser_t *parser, size_t max_bytes) {
+    if (parser) {
+        parser->limit = max_bytes;
+    }
+}
 
-    return parser;
+bool epub_xml_feed(epub_xml_parser_t *p, const char *data, size_t len) {
+    if (!p || (!data && len > 0) || p->over_limit) {
+        return false;
+    }
+    // 超出上限的部分不再解析：之前的内容照常交出，调用方据返回值停止
+    if (len > p->limit - p->fed) {
+        ESP_LOGW(TAG, "Input exceeds %u bytes, stopping", (unsigned)p->limit);
+        len = p->limit - p->fed;
+        p->over_limit = true;
+    }
+    p->fed += len;
+
+    size_t i = 0;
+    while (i < len) {
+        const char c = data[i];
+        switch (p->state) {
+        case XML_STATE_TEXT:
+            if (c == '<') {
+                text_flush(p);
+                p->state = XML_STATE_TAG;
+                p->tag_len = 0;
+                p->quote = 0;
+            } else if (c == '&') {
+                p->state = XML_STATE_ENTITY;
+                p->entity_len = 0;
+            } else {
+                text_put(p, &c, 1);
+            }
+            break;
+
+        case XML_STATE_ENTITY:
+            if (c == ';') {
+                char utf8[4];
+                const size_t n = epub_xml_decode_entity(p->entity, p->entity_len, utf8);
+                if (n > 0) {
+                    text_put(p, utf8, n);
+                } else {
+                    text_put(p, "&", 1);
+                    text_put(p, p->entity, p->entity_len);
+                    text_put(p, ";", 1);
+                }
+                p->state = XML_STATE_TEXT;
+            } else if (p->entity_len < EPUB_XML_ENTITY_MAX && (isalnum((unsigned char)c) || c == '#')) {
+                p->entity[p->entity_len++] = c;
+            } else {
+                // 不是实体：原样输出，当前字符按普通文本重新处理
+                text_put(p, "&", 1);
+                text_put(p, p->entity, p->entity_len);
+                p->state = XML_STATE_TEXT;
+                continue;
+            }
+            break;
+
+        case XML_STATE_TAG:
+            if (p->quote) {
+                if (c == p->quote) {
+                    p->quote = 0;
+                }
+            } else if (c == '>') {
+                process_tag(p);
+                p->state = XML_STATE_TEXT;
+                break;
+            } else if (c == '<' && (p->tag_len == 0 || p->tag[0] != '!')) {
+                // 前一个 '<' 只是文本（如样式表里的 "a<b"），原样交出后从这里重新开始标签
+                text_put(p, "<", 1);
+                text_put(p, p->tag, p->tag_len);
+                text_flush(p);
+                p->tag_len = 0;
+                break;
+            } else if ((c == '"' || c == '\'') && p->tag_len > 0 && p->tag[0] != '!') {
+                p->quote = c;
+            }
+            if (p->tag_len < EPUB_XML_TAG_MAX) {
+                p->tag[p->tag_len++] = c;
+            }
+            if (p->tag_len == 3 && memcmp(p->tag, "!--", 3) == 0) {
+                p->state = XML_STATE_COMMENT;
+                p->tail = 0;
+            } else if (p->tag_len == 8 && memcmp(p->tag, "![CDATA[", 8) == 0) {
+                p->state = XML_STATE_CDATA;
+                p->tail = 0;
+            }
+            break;
+
+        case XML_STATE_COMMENT:
+            if (c == '>' && p->tail >= 2) {
+                p->state = XML_STATE_TEXT;
+            } else if (c == '-') {
+                p->tail = p->tail < 2 ? p->tail + 1 : 2;
+            } else {
+                p->tail = 0;
+            }
+            break;
+
+        case XML_STATE_CDATA:
+            if (c == ']') {
+                if (p->tail == 2) {
+                    text_put(p, "]", 1);
+                } else {
+                    p->tail++;
+                }
+            } else if (c == '>' && p->tail == 2) {
+                p->state = XML_STATE_TEXT;
+            } else {
+                text_put(p, "]]", p->tail);
+                p->tail = 0;
+                text_put(p, &c, 1);
+            }
+            break;
+        }
+        i++;
+    }
+    return !p->over_limit;
 }
 
-void epub_xml_destroy(epub_xml_parser_t *parser) {
-    if (!parser) return;
-    if (parser->content) {
-        free(parser->content);
+bool epub_xml_finish(epub_xml_parser_t *p) {
+    if (!p) {
+        return false;
     }
+    if (p->state == XML_STATE_ENTITY) {
+        text_put(p, "&", 1);
+        text_put(p, p->entity, p->entity_len);
+        p->state = XML_STATE_TEXT;
+    }
+    text_flush(p);
+    return p->state == XML_STATE_TEXT && !p->over_limit;
+}
+
+void epub_xml_destroy(epub_xml_parser_t *parser) {
     free(parser);
 }
 
-bool epub_xml_parse_metadata(epub_xml_parser_t *parser, epub_xml_metadata_t *metadata) {
-    if (!parser || !metadata) return false;
+static const char *find_attr(const char *const *attrs, const char *name) {
+    for (int i = 0; attrs[i]; i += 2) {
+        if (strcmp(attrs[i], name) == 0) {
+            return attrs[i + 1];
+        }
+    }
+    return NULL;
+}
 
-    memset(metadata, 0, sizeof(epub_xml_metadata_t));
+// ---------------------------------------------------------------------------
+// container.xml
+// ---------------------------------------------------------------------------
 
-    // 查找 <metadata> 标签
-    const char *metadata_start = strstr(parser->content, "<metadata");
-    if (!metadata_start) {
-        ESP_LOGE(TAG, "metadata tag not found");
-        return false;
+static void container_start(void *user, const char *name, const char *const *attrs) {
+    epub_xml_container_t *c = (epub_xml_container_t *)user;
+    if (c->found || strcmp(name, "rootfile") != 0) {
+        return;
+    }
+    const char *path = find_attr(attrs, "full-path");
+    const char *type = find_attr(attrs, "media-type");
+    if (path && path[0] && (!type || strcmp(type, "application/oebps-package+xml") == 0)) {
+        strncpy(c->rootfile, path, sizeof(c->rootfile) - 1);
+        c->rootfile[sizeof(c->rootfile) - 1] = '\0';
+        c->found = true;
     }
+}
+
+void epub_xml_container_handler(epub_xml_handler_t *handler, epub_xml_container_t *container) {
+    memset(container, 0, sizeof(*container));
+    memset(handler, 0, sizeof(*handler));
+    handler->start_element = container_start;
+    handler->user = container;
+}
+
+// ---------------------------------------------------------------------------
+// content.opf
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t id_hash;
+    uint32_t id_ofs;      // 名字池中的偏移（以 NUL 结尾）
+    uint32_t href_ofs;
+} opf_item_t;
+
+typedef struct {
+    uint32_t id_hash;
+    uint32_t id_ofs;
+    int32_t item;         // 解析后指向 items，-1 表示不存在
+} opf_itemref_t;
+
+struct epub_xml_opf {
+    epub_xml_metadata_t metadata;
+    char *pool;
+    size_t pool_len;
+    size_t pool_cap;
+    opf_item_t *items;
+    int item_count;
+    int item_cap;
+    opf_itemref_t *spine;
+    int spine_count;
+    int spine_cap;
+    opf_itemref_t toc_ref;   // <spine toc="..."> 指向的 NCX，item 为 -1 表示未指定
+    int32_t nav_href;     // EPUB3 properties="nav" 的目录文档，-1 表示没有
+    int32_t ncx_href;     // 第一个 NCX 媒体类型的条目（spine 没有 toc 属性时使用）
+    opf_itemref_t cover_ref; // EPUB2 <meta name="cover" content="..."> 指向的条目，item 为 -1 表示未指定
+    int32_t cover_href;   // EPUB3 properties="cover-image" 的图片，-1 表示没有
+    int32_t cover_guess;  // id 或 href 含 "cover" 的第一张图片（前两者都没有时使用）
+    uint32_t css_hrefs[EPUB_XML_MAX_STYLESHEETS];  // text/css 条目，按 manifest 顺序
+    int css_count;
+    bool in_metadata;
+    bool failed;          // 内存不足，结果不完整
+    char *capture;        // 正在收集文本的元数据字段
+    size_t capture_size;
+    size_t capture_len;
+};
 
-    const char *metadata_end = strstr(metadata_start, "</metadata>");
-    if (!metadata_end) {
-        ESP_LOGE(TAG, "metadata end tag not found");
+static bool grow(void **array, int *cap, int count, size_t item_size) {
+    if (count < *cap) {
+        return true;
+    }
+    const int next = *cap ? *cap * 2 : 32;
+    void *grown = realloc(*array, (size_t)next * item_size);
+    if (!grown) {
         return false;
     }
+    *array = grown;
+    *cap = next;
+    return true;
+}
 
-    // 提取 title
-    const char *title_start = strstr(metadata_start, "<dc:title");
-    if (title_start && title_start < metadata_end) {
-        const char *value_start = strchr(title_start, '>');
-        if (value_start) {
-            value_start++;
-            const char *value_end = strstr(value_start, "</dc:title>");
-            if (value_end && value_end < metadata_end) {
-                size_t len = value_end - value_start;
-                if (len >= sizeof(metadata->title)) len = sizeof(metadata->title) - 1;
-                memcpy(metadata->title, value_start, len);
-                metadata->title[len] = '\0';
-            }
+static bool pool_add(epub_xml_opf_t *opf, const char *s, uint32_t *ofs) {
+    const size_t len = strlen(s) + 1;
+    if (opf->pool_len + len > opf->pool_cap) {
+        size_t cap = opf->pool_cap ? opf->pool_cap : 2048;
+        while (cap < opf->pool_len + len) {
+            cap *= 2;
+        }
+        char *grown = realloc(opf->pool, cap);
+        if (!grown) {
+            return false;
+        }
+        opf->pool = grown;
+        opf->pool_cap = cap;
+    }
+    memcpy(opf->pool + opf->pool_len, s, len);
+    *ofs = (uint32_t)opf->pool_len;
+    opf->pool_len += len;
+    return true;
+}
+
+// 空白分隔的属性值（如 properties="nav scripted"）中是否含有 token
+static bool has_token(const char *list, const char *token) {
+    const size_t len = strlen(token);
+    for (const char *s = list; *s; ) {
+        while (is_space(*s)) {
+            s++;
+        }
+        const char *end = s;
+        while (*end && !is_space(*end)) {
+            end++;
+        }
+        if ((size_t)(end - s) == len && memcmp(s, token, len) == 0) {
+            return true;
         }
+        s = end;
     }
+    return false;
+}
+
+static void opf_start(void *user, const char *name, const char *const *attrs) {
+    epub_xml_opf_t *opf = (epub_xml_opf_t *)user;
+
+    if (strcmp(name, "metadata") == 0) {
+        opf->in_metadata = true;
+    } else if (opf->in_metadata && strcmp(name, "meta") == 0) {
+        const char *meta_name = find_attr(attrs, "name");
+        const char *content = find_attr(attrs, "content");
+        if (meta_name && content && strcmp(meta_name, "cover") == 0 && opf->cover_ref.item < 0 &&
+            pool_add(opf, content, &opf->cover_ref.id_ofs)) {
+            opf->cover_ref.id_hash = page_index_hash(0, content, strlen(content));
+            opf->cover_ref.item = 0;  // 待解析
+        }
+    } else if (opf->in_metadata) {
+        struct { const char *name; char *field; size_t size; } fields[] = {
+            {"title", opf->metadata.title, sizeof(opf->metadata.title)},
+            {"creator", opf->metadata.author, sizeof(opf->metadata.author)},
+            {"language", opf->metadata.language, sizeof(opf->metadata.language)},
+            {"identifier", opf->metadata.identifier, sizeof(opf->metadata.identifier)},
+        };
+        for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+            // 每个字段只取第一次出现的值
+            if (strcmp(name, fields[i].name) == 0 && fields[i].field[0] == '\0') {
+                opf->capture = fields[i].field;
+                opf->capture_size = fields[i].size;
+                opf->capture_len = 0;
+                break;
+            }
+        }
+    } else if (strcmp(name, "item") == 0) {
+        const char *id = find_attr(attrs, "id");
+        const char *href = find_attr(attrs, "href");
+        if (!id || !href) {
+            return;
+        }
+        opf_item_t item = {.id_hash = page_index_hash(0, id, strlen(id))};
+        if (!grow((void **)&opf->items, &opf->item_cap, opf->item_count, sizeof(opf_item_t)) ||
+            !pool_add(opf, id, &item.id_ofs) || !pool_add(opf, href, &item.href_ofs)) {
+            opf->failed = true;
+            return;
+        }
+        opf->items[opf->item_count++] = item;
 
-    // 提取 author
-    const char *author_start = strstr(metadata_start, "<dc:creator");
-    if (author_start && author_start < metadata_end) {
-        const char *value_start = strchr(author_start, '>');
-        if (value_start) {
-            value_start++;
-            const char *value_end = strstr(value_start, "</dc:creator>");
-            if (value_end && value_end < metadata_end) {
-                size_t len = value_end - value_start;
-                if (len >= sizeof(metadata->author)) len = sizeof(metadata->author) - 1;
-                memcpy(metadata->author, value_start, len);
-                metadata->author[len] = '\0';
+        const char *properties = find_attr(attrs, "properties");
+        const char *type = find_attr(attrs, "media-type");
+        if (opf->nav_href < 0 && properties && has_token(properties, "nav")) {
+            opf->nav_href = (int32_t)item.href_ofs;
+        }
+        if (opf->ncx_href < 0 && type && strcmp(type, "application/x-dtbncx+xml") == 0) {
+            opf->ncx_href = (int32_t)item.href_ofs;
+        }
+        if (type && strcmp(type, "text/css") == 0 && opf->css_count < EPUB_XML_MAX_STYLESHEETS) {
+            opf->css_hrefs[opf->css_count++] = item.href_ofs;
+        }
+        if (type && strncmp(type, "image/", 6) == 0) {
+            if (opf->cover_href < 0 && properties && has_token(properties, "cover-image")) {
+                opf->cover_href = (int32_t)item.href_ofs;
             }
+            if (opf->cover_guess < 0 && (strstr(id, "cover") || strstr(href, "cover"))) {
+                opf->cover_guess = (int32_t)item.href_ofs;
+            }
+        }
+    } else if (strcmp(name, "spine") == 0) {
+        const char *toc = find_attr(attrs, "toc");
+        if (toc && pool_add(opf, toc, &opf->toc_ref.id_ofs)) {
+            opf->toc_ref.id_hash = page_index_hash(0, toc, strlen(toc));
+            opf->toc_ref.item = 0;  // 待解析
+        }
+    } else if (strcmp(name, "itemref") == 0) {
+        const char *idref = find_attr(attrs, "idref");
+        if (!idref) {
+            return;
         }
+        opf_itemref_t ref = {.id_hash = page_index_hash(0, idref, strlen(idref)), .item = -1};
+        if (!grow((void **)&opf->spine, &opf->spine_cap, opf->spine_count, sizeof(opf_itemref_t)) ||
+            !pool_add(opf, idref, &ref.id_ofs)) {
+            opf->failed = true;
+            return;
+        }
+        opf->spine[opf->spine_count++] = ref;
     }
+}
 
-    ESP_LOGI(TAG, "Metadata: title='%s', author='%s'", metadata->title, metadata->author);
-    return true;
+// 去掉结尾空白与被截断的半个 UTF-8 字符
+static void capture_end(epub_xml_opf_t *opf) {
+    size_t len = opf->capture_len;
+    while (len > 0 && opf->capture[len - 1] == ' ') {
+        len--;
+    }
+    size_t lead = len;
+    while (lead > 0 && ((uint8_t)opf->capture[lead - 1] & 0xC0) == 0x80) {
+        lead--;
+    }
+    if (lead > 0 && ((uint8_t)opf->capture[lead - 1] & 0x80)) {
+        const uint8_t b = (uint8_t)opf->capture[lead - 1];
+        const size_t need = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : 2;
+        if (len - (lead - 1) < need) {
+            len = lead - 1;
+        }
+    }
+    opf->capture[len] = '\0';
+    opf->capture = NULL;
 }
 
-int epub_xml_parse_spine(epub_xml_parser_t *parser,
-                         epub_xml_spine_item_t *spine_items,
-                         int max_items) {
-    if (!parser || !spine_items || max_items <= 0) {
-        return 0;
+static void opf_end(void *user, const char *name) {
+    epub_xml_opf_t *opf = (epub_xml_opf_t *)user;
+    if (opf->capture) {
+        capture_end(opf);
+    }
+    if (strcmp(name, "metadata") == 0) {
+        opf->in_metadata = false;
     }
+}
 
-    // 查找 <spine> 标签
-    const char *spine_start = strstr(parser->content, "<spine");
-    if (!spine_start) {
-        ESP_LOGE(TAG, "spine tag not found");
-        return 0;
+// 元数据文本：空白折叠为单个空格，超出字段长度的部分丢弃
+static void opf_text(void *user, const char *text, size_t len) {
+    epub_xml_opf_t *opf = (epub_xml_opf_t *)user;
+    if (!opf->capture) {
+        return;
+    }
+    for (size_t i = 0; i < len && opf->capture_len + 1 < opf->capture_size; i++) {
+        if (is_space(text[i])) {
+            if (opf->capture_len > 0 && opf->capture[opf->capture_len - 1] != ' ') {
+                opf->capture[opf->capture_len++] = ' ';
+            }
+        } else {
+            opf->capture[opf->capture_len++] = text[i];
+        }
     }
+}
 
-    const char *spine_end = strstr(spine_start, "</spine>");
-    if (!spine_end) {
-        ESP_LOGE(TAG, "spine end tag not found");
-        return 0;
+epub_xml_opf_t* epub_xml_opf_create(void) {
+    epub_xml_opf_t *opf = calloc(1, sizeof(epub_xml_opf_t));
+    if (!opf) {
+        ESP_LOGE(TAG, "Failed to allocate OPF");
+        return NULL;
     }
+    opf->toc_ref.item = -1;
+    opf->nav_href = -1;
+    opf->ncx_href = -1;
+    opf->cover_ref.item = -1;
+    opf->cover_href = -1;
+    opf->cover_guess = -1;
+    return opf;
+}
 
-    int count = 0;
-    const char *itemref_start = spine_start;
+void epub_xml_opf_handler(epub_xml_opf_t *opf, epub_xml_handler_t *handler) {
+    memset(handler, 0, sizeof(*handler));
+    handler->start_element = opf_start;
+    handler->end_element = opf_end;
+    handler->text = opf_text;
+    handler->user = opf;
+}
 
-    while (count < max_items) {
-        itemref_start = strstr(itemref_start, "<itemref");
-        if (!itemref_start || itemref_start >= spine_end) {
-            break;
+static int compare_items(const void *a, const void *b) {
+    const uint32_t x = ((const opf_item_t *)a)->id_hash;
+    const uint32_t y = ((const opf_item_t *)b)->id_hash;
+    return x < y ? -1 : x > y;
+}
+
+// 在按 id 哈希排序后的 manifest 中查找 idref，-1 表示不存在
+static int32_t find_item(const epub_xml_opf_t *opf, const opf_itemref_t *ref) {
+    int lo = 0;
+    int hi = opf->item_count;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (opf->items[mid].id_hash < ref->id_hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (; lo < opf->item_count && opf->items[lo].id_hash == ref->id_hash; lo++) {
+        if (strcmp(opf->pool + opf->items[lo].id_ofs, opf->pool + ref->id_ofs) == 0) {
+            return lo;
         }
+    }
+    return -1;
+}
+
+int epub_xml_opf_resolve(epub_xml_opf_t *opf) {
+    if (!opf) {
+        return 0;
+    }
+    if (opf->capture) {
+        capture_end(opf);
+    }
+    if (opf->failed) {
+        ESP_LOGW(TAG, "Out of memory while parsing OPF, result is partial");
+    }
 
-        const char *itemref_end = strchr(itemref_start, '>');
-        if (!itemref_end) break;
+    if (opf->item_count > 1) {
+        qsort(opf->items, opf->item_count, sizeof(opf_item_t), compare_items);
+    }
 
-        // 提取 idref 属性
-        epub_xml_spine_item_t *item = &spine_items[count];
-        if (extract_attribute(itemref_start, "idref", item->idref, sizeof(item->idref))) {
-            item->index = count;
-            // href 需要从 manifest 查找，这里先留空
-            item->href[0] = '\0';
-            count++;
+    int resolved = 0;
+    for (int i = 0; i < opf->spine_count; i++) {
+        opf_itemref_t *ref = &opf->spine[i];
+        ref->item = find_item(opf, ref);
+        if (ref->item >= 0) {
+            resolved++;
+        } else {
+            ESP_LOGW(TAG, "manifest item with id='%s' not found", opf->pool + ref->id_ofs);
         }
+    }
+    if (opf->toc_ref.item >= 0) {
+        opf->toc_ref.item = find_item(opf, &opf->toc_ref);
+    }
+    if (opf->cover_ref.item >= 0) {
+        opf->cover_ref.item = find_item(opf, &opf->cover_ref);
+    }
 
-        itemref_start = itemref_end + 1;
+    ESP_LOGI(TAG, "OPF: %d manifest items, %d/%d spine items resolved, title='%s'",
+             opf->item_count, resolved, opf->spine_count, opf->metadata.title);
+    return opf->spine_count;
+}
+
+const epub_xml_metadata_t* epub_xml_opf_metadata(const epub_xml_opf_t *opf) {
+    return opf ? &opf->metadata : NULL;
+}
+
+const char* epub_xml_opf_spine_href(const epub_xml_opf_t *opf, int index) {
+    if (!opf || index < 0 || index >= opf->spine_count || opf->spine[index].item < 0) {
+        return NULL;
     }
+    return opf->pool + opf->items[opf->spine[index].item].href_ofs;
+}
 
-    ESP_LOGI(TAG, "Parsed %d spine items", count);
-    return count;
+const char* epub_xml_opf_toc_href(const epub_xml_opf_t *opf, bool *is_nav) {
+    if (!opf) {
+        return NULL;
+    }
+    // EPUB3 的 nav 文档优先，其次是 spine 指定的 NCX，最后是任意 NCX
+    int32_t href = opf->nav_href;
+    *is_nav = href >= 0;
+    if (href < 0 && opf->toc_ref.item >= 0) {
+        href = (int32_t)opf->items[opf->toc_ref.item].href_ofs;
+    }
+    if (href < 0) {
+        href = opf->ncx_href;
+    }
+    return href >= 0 ? opf->pool + href : NULL;
 }
 
-bool epub_xml_find_manifest_item(epub_xml_parser_t *parser,
-                                  const char *idref,
-                                  char *href,
-                                  size_t href_size) {
-    if (!parser || !idref || !href) {
-        return false;
+const char* epub_xml_opf_cover_href(const epub_xml_opf_t *opf) {
+    if (!opf) {
+        return NULL;
+    }
+    // EPUB3 的 cover-image 优先，其次是 EPUB2 的 <meta name="cover">，最后按名字猜
+    int32_t href = opf->cover_href;
+    if (href < 0 && opf->cover_ref.item >= 0) {
+        href = (int32_t)opf->items[opf->cover_ref.item].href_ofs;
+    }
+    if (href < 0) {
+        href = opf->cover_guess;
     }
+    return href >= 0 ? opf->pool + href : NULL;
+}
 
-    // 查找 <manifest> 标签
-    const char *manifest_start = strstr(parser->content, "<manifest");
-    if (!manifest_start) {
-        ESP_LOGE(TAG, "manifest tag not found");
-        return false;
+const char* epub_xml_opf_stylesheet_href(const epub_xml_opf_t *opf, int index) {
+    if (!opf || index < 0 || index >= opf->css_count) {
+        return NULL;
     }
+    return opf->pool + opf->css_hrefs[index];
+}
 
-    const char *manifest_end = strstr(manifest_start, "</manifest>");
-    if (!manifest_end) {
-        return false;
+void epub_xml_opf_destroy(epub_xml_opf_t *opf) {
+    if (!opf) {
+        return;
     }
+    free(opf->pool);
+    free(opf->items);
+    free(opf->spine);
+    free(opf);
+}
+
+// ---------------------------------------------------------------------------
+// 目录：NCX（navMap / navPoint）与 EPUB3 nav.xhtml（<nav epub:type="toc"> 中的 ol / li / a）
+// ---------------------------------------------------------------------------
+
+struct epub_xml_toc {
+    epub_xml_toc_cb_t callback;
+    void *user;
+    bool nav;             // nav.xhtml，否则为 NCX
+    int depth;            // NCX: navPoint 嵌套层数；nav: ol 嵌套层数
+    int entry_depth;      // 正在收集的目录项的层级
+    bool pending;         // 有尚未交出的目录项
+    bool capturing;       // 正在收集标题文本
+    int nav_state;        // nav: 0 未进入目录，1 在目录中，2 目录已结束
+    char href[256];
+    char title[EPUB_XML_TOC_TITLE_MAX];
+    size_t title_len;
+};
 
-    // 查找匹配的 <item> 标签
-    char search_tag[128];
-    snprintf(search_tag, sizeof(search_tag), "id=\"%s\"", idref);
+static void toc_begin_entry(epub_xml_toc_t *toc, int depth) {
+    toc->pending = true;
+    toc->capturing = false;
+    toc->entry_depth = depth > 0 ? depth : 0;
+    toc->href[0] = '\0';
+    toc->title_len = 0;
+}
 
-    const char *item_start = strstr(manifest_start, search_tag);
-    if (!item_start || item_start >= manifest_end) {
-        ESP_LOGW(TAG, "manifest item with id='%s' not found", idref);
-        return false;
+static void toc_emit(epub_xml_toc_t *toc) {
+    if (!toc->pending) {
+        return;
+    }
+    toc->pending = false;
+    toc->capturing = false;
+    if (toc->href[0] == '\0') {
+        return;  // 只有标题没有链接（nav 中的分组标题）
+    }
+    size_t len = toc->title_len;
+    while (len > 0 && toc->title[len - 1] == ' ') {
+        len--;
+    }
+    // 截断时不留半个 UTF-8 字符
+    size_t lead = len;
+    while (lead > 0 && ((uint8_t)toc->title[lead - 1] & 0xC0) == 0x80) {
+        lead--;
+    }
+    if (lead > 0 && ((uint8_t)toc->title[lead - 1] & 0x80)) {
+        const uint8_t b = (uint8_t)toc->title[lead - 1];
+        const size_t need = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : 2;
+        if (len - (lead - 1) < need) {
+            len = lead - 1;
+        }
     }
+    toc->title[len] = '\0';
+    toc->callback(toc->user, toc->href, toc->title, toc->entry_depth);
+}
 
-    // 提取 href 属性
-    return extract_attribute(item_start, "href", href, href_size);
+static void toc_set_href(epub_xml_toc_t *toc, const char *href) {
+    strncpy(toc->href, href, sizeof(toc->href) - 1);
+    toc->href[sizeof(toc->href) - 1] = '\0';
 }
 
-bool epub_xml_find_content_opf(epub_xml_parser_t *parser,
-                                char *content_opf_path,
-                                size_t path_size) {
-    if (!parser || !content_opf_path) {
-        return false;
+static void toc_start(void *user, const char *name, const char *const *attrs) {
+    epub_xml_toc_t *toc = (epub_xml_toc_t *)user;
+
+    if (!toc->nav) {
+        if (strcmp(name, "navPoint") == 0) {
+            // 子项开始前先交出父项（父项的 content 一定在子 navPoint 之前）
+            toc_emit(toc);
+            toc_begin_entry(toc, toc->depth++);
+        } else if (toc->pending && strcmp(name, "text") == 0 && toc->title_len == 0) {
+            toc->capturing = true;
+        } else if (toc->pending && strcmp(name, "content") == 0 && toc->href[0] == '\0') {
+            const char *src = find_attr(attrs, "src");
+            if (src) {
+                toc_set_href(toc, src);
+            }
+        }
+        return;
     }
 
-    // EPUB 标准路径: META-INF/container.xml 定义了 .opf 文件位置
-    // 这里我们假设标准路径，实际应用中需要先解析 container.xml
+    if (strcmp(name, "nav") == 0) {
+        // landmarks、page-list 等其它 nav 不是目录；没有 type 的 nav 也当作目录
+        const char *type = find_attr(attrs, "type");
+        if (toc->nav_state == 0 && (!type || has_token(type, "toc"))) {
+            toc->nav_state = 1;
+        }
+    } else if (toc->nav_state != 1) {
+        return;
+    } else if (strcmp(name, "ol") == 0) {
+        toc->depth++;
+    } else if (strcmp(name, "a") == 0) {
+        const char *href = find_attr(attrs, "href");
+        if (href) {
+            toc_begin_entry(toc, toc->depth - 1);
+            toc_set_href(toc, href);
+            toc->capturing = true;
+        }
+    }
+}
 
-    // 尝试常见路径
-    const char *common_paths[] = {
-        "OEBPS/content.opf",
-        "OPS/content.opf",
-        "content.opf",
-        NULL
-    };
+static void toc_end(void *user, const char *name) {
+    epub_xml_toc_t *toc = (epub_xml_toc_t *)user;
 
-    for (int i = 0; common_paths[i]; i++) {
-        if (strstr(parser->content, common_paths[i])) {
-            strncpy(content_opf_path, common_paths[i], path_size - 1);
-            content_opf_path[path_size - 1] = '\0';
-            ESP_LOGI(TAG, "Found content.opf at: %s", content_opf_path);
-            return true;
+    if (!toc->nav) {
+        if (strcmp(name, "text") == 0) {
+            toc->capturing = false;
+        } else if (strcmp(name, "navPoint") == 0) {
+            toc_emit(toc);
+            if (toc->depth > 0) {
+                toc->depth--;
+            }
         }
+        return;
     }
 
-    // 默认返回 OEBPS/content.opf
-    strncpy(content_opf_path, "OEBPS/content.opf", path_size - 1);
-    content_opf_path[path_size - 1] = '\0';
-    return false;
+    if (toc->nav_state != 1) {
+        return;
+    }
+    if (strcmp(name, "a") == 0) {
+        toc_emit(toc);
+    } else if (strcmp(name, "ol") == 0 && toc->depth > 0) {
+        toc->depth--;
+    } else if (strcmp(name, "nav") == 0) {
+        toc_emit(toc);
+        toc->nav_state = 2;
+    }
+}
+
+// 标题文本：空白折叠为单个空格，超出长度的部分丢弃
+static void toc_text(void *user, const char *text, size_t len) {
+    epub_xml_toc_t *toc = (epub_xml_toc_t *)user;
+    if (!toc->capturing) {
+        return;
+    }
+    for (size_t i = 0; i < len && toc->title_len + 1 < sizeof(toc->title); i++) {
+        if (is_space(text[i])) {
+            if (toc->title_len > 0 && toc->title[toc->title_len - 1] != ' ') {
+                toc->title[toc->title_len++] = ' ';
+            }
+        } else {
+            toc->title[toc->title_len++] = text[i];
+        }
+    }
+}
+
+epub_xml_toc_t* epub_xml_toc_create(bool nav, epub_xml_toc_cb_t callback, void *user) {
+    if (!callback) {
+        return NULL;
+    }
+    epub_xml_toc_t *toc = calloc(1, sizeof(epub_xml_toc_t));
+    if (!toc) {
+        ESP_LOGE(TAG, "Failed to allocate TOC parser");
+        return NULL;
+    }
+    toc->nav = nav;
+    toc->callback = callback;
+    toc->user = user;
+    return toc;
+}
+
+void epub_xml_toc_handler(epub_xml_toc_t *toc, epub_xml_handler_t *handler) {
+    memset(handler, 0, sizeof(*handler));
+    handler->start_element = toc_start;
+    handler->end_element = toc_end;
+    handler->text = toc_text;
+    handler->user = toc;
+}
+
+void epub_xml_toc_finish(epub_xml_toc_t *toc) {
+    if (toc) {
+        toc_emit(toc);
+    }
+}
+
+void epub_xml_toc_destroy(epub_xml_toc_t *toc) {
+    free(toc);
 }
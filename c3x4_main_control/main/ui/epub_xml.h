@@ -1,94 +1,226 @@
 /**
  * @file epub_xml.h
- * @brief 轻量级 EPUB XML 解析器 - 流式解析 content.opf 和 toc.ncx
+ * @brief 轻量级 EPUB XML 解析器 - 流式 SAX 解析 container.xml、content.opf 和目录（NCX / nav）
  *
- * 使用 TinyXML2，但只提取需要的部分，不构建完整 DOM
+ * 数据可以分块送入（例如直接接在 ZIP 解压回调后面），不复制整个文档：
+ * 只缓存当前标签（最长 EPUB_XML_TAG_MAX 字节），文本分段交给回调。
+ * 每个解析器有输入字节上限（默认 EPUB_XML_MAX_INPUT），畸形文件的解析时间因此有界
  */
 
 #ifndef EPUB_XML_H
 #define EPUB_XML_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define EPUB_XML_TAG_MAX   1024  // 单个标签（含属性）的最大长度，超出部分被截断
+#define EPUB_XML_ATTR_MAX  16    // 单个标签最多解析的属性数
+#define EPUB_XML_ENTITY_MAX 10   // "#x10FFFF" 之类的最长实体名
+#define EPUB_XML_MAX_INPUT (2 * 1024 * 1024)  // 默认输入上限：OPF / 目录超过它视为损坏
+
 // EPUB 元数据（从 content.opf 提取）
 typedef struct {
     char title[128];
     char author[128];
     char language[16];
+    char identifier[64];
 } epub_xml_metadata_t;
 
-// EPUB 章节项（从 spine 提取）
+/**
+ * @brief SAX 回调（元素名、属性名均已去掉命名空间前缀，实体已解码）
+ *
+ * attrs 为 名, 值, 名, 值, ..., NULL 序列，只在回调期间有效；
+ * 文本可能被分成多段回调
+ */
 typedef struct {
-    char idref[64];       // spine 中的 idref
-    char href[256];       // 对应 manifest 中的 href（实际文件路径）
-    int index;            // 在 spine 中的索引
-} epub_xml_spine_item_t;
+    void (*start_element)(void *user, const char *name, const char *const *attrs);
+    void (*end_element)(void *user, const char *name);
+    void (*text)(void *user, const char *text, size_t len);
+    void *user;
+} epub_xml_handler_t;
 
 // XML 解析器状态
 typedef struct epub_xml_parser epub_xml_parser_t;
 
 /**
  * @brief 创建 XML 解析器
- * @param xml_content XML 内容
- * @param content_length 内容长度
+ * @param handler 回调（内容复制到解析器中）
  * @return 解析器句柄
  */
-epub_xml_parser_t* epub_xml_create(const char *xml_content, size_t content_length);
+epub_xml_parser_t* epub_xml_create(const epub_xml_handler_t *handler);
 
 /**
- * @brief 销毁 XML 解析器
+ * @brief 设置输入字节上限（创建后、送入数据前调用）
  * @param parser 解析器句柄
+ * @param max_bytes 上限，超出后 epub_xml_feed 只处理上限以内的部分并返回 false
  */
-void epub_xml_destroy(epub_xml_parser_t *parser);
+void epub_xml_set_limit(epub_xml_parser_t *parser, size_t max_bytes);
 
 /**
- * @brief 解析 content.opf - 提取元数据
+ * @brief 送入一段 XML 数据
  * @param parser 解析器句柄
- * @param metadata 输出元数据
- * @return true 成功，false 失败
+ * @param data 数据
+ * @param len 数据长度
+ * @return true 继续，false 解析器已出错或输入超过上限
  */
-bool epub_xml_parse_metadata(epub_xml_parser_t *parser, epub_xml_metadata_t *metadata);
+bool epub_xml_feed(epub_xml_parser_t *parser, const char *data, size_t len);
 
 /**
- * @brief 解析 content.opf - 提取 spine（章节顺序）
+ * @brief 数据结束，交出剩余文本
  * @param parser 解析器句柄
- * @param spine_items 输出 spine 项数组
- * @param max_items 最大项数
- * @return 实际提取的项数
+ * @return true 文档完整，false 结束在标签中间或输入超过上限
  */
-int epub_xml_parse_spine(epub_xml_parser_t *parser,
-                         epub_xml_spine_item_t *spine_items,
-                         int max_items);
+bool epub_xml_finish(epub_xml_parser_t *parser);
 
 /**
- * @brief 解析 content.opf - 提取 manifest（文件清单）
- * 用于将 spine 的 idref 映射到实际文件路径
+ * @brief 销毁 XML 解析器
  * @param parser 解析器句柄
- * @param idref 要查找的 idref
- * @param href 输出文件路径
- * @param href_size href 缓冲区大小
- * @return true 找到，false 未找到
  */
-bool epub_xml_find_manifest_item(epub_xml_parser_t *parser,
-                                  const char *idref,
-                                  char *href,
-                                  size_t href_size);
+void epub_xml_destroy(epub_xml_parser_t *parser);
+
+/**
+ * @brief 解码 "&name;" 中的 name（数字实体或常见命名实体）
+ * @param name 实体名（不含 & 和 ;）
+ * @param len 实体名长度
+ * @param out 输出，至少 4 字节
+ * @return UTF-8 字节数，不认识返回 0
+ */
+size_t epub_xml_decode_entity(const char *name, size_t len, char *out);
 
 /**
- * @brief 查找 content.opf 文件在 ZIP 中的路径
- * @param parser 解析器句柄
- * @param content_opf_path 输出 content.opf 路径
- * @param path_size 缓冲区大小
- * @return true 找到，false 未找到
+ * @brief 原地解码字符串中的实体（解码结果不会比原文长）
+ * @param s NUL 结尾字符串
+ */
+void epub_xml_decode_entities(char *s);
+
+// META-INF/container.xml 的解析结果
+typedef struct {
+    char rootfile[256];   // 第一个 OPF rootfile 的 full-path
+    bool found;
+} epub_xml_container_t;
+
+/**
+ * @brief 填充解析 container.xml 的回调
+ * @param handler 输出回调
+ * @param container 结果（调用前不需要初始化）
+ */
+void epub_xml_container_handler(epub_xml_handler_t *handler, epub_xml_container_t *container);
+
+// content.opf 的解析结果
+typedef struct epub_xml_opf epub_xml_opf_t;
+
+#define EPUB_XML_MAX_STYLESHEETS 8  // 记录的样式表条目数，更多的忽略
+
+/**
+ * @brief 创建 OPF 解析结果
+ * @return 句柄，失败返回 NULL
+ */
+epub_xml_opf_t* epub_xml_opf_create(void);
+
+/**
+ * @brief 填充解析 content.opf 的回调（manifest 在同一遍中建成 id → href 表）
+ * @param opf OPF 句柄
+ * @param handler 输出回调
+ */
+void epub_xml_opf_handler(epub_xml_opf_t *opf, epub_xml_handler_t *handler);
+
+/**
+ * @brief 文档结束后把 spine 的 idref 解析为 manifest 中的 href
+ * @param opf OPF 句柄
+ * @return spine 项数
+ */
+int epub_xml_opf_resolve(epub_xml_opf_t *opf);
+
+/**
+ * @brief 获取元数据
+ * @param opf OPF 句柄
+ * @return 元数据（未出现的字段为空串）
+ */
+const epub_xml_metadata_t* epub_xml_opf_metadata(const epub_xml_opf_t *opf);
+
+/**
+ * @brief 获取第 index 个 spine 项的 href（相对 OPF 所在目录，未解码）
+ * @param opf OPF 句柄
+ * @param index spine 序号
+ * @return href，idref 在 manifest 中不存在时返回 NULL
+ */
+const char* epub_xml_opf_spine_href(const epub_xml_opf_t *opf, int index);
+
+/**
+ * @brief 获取目录文档的 href（EPUB3 nav 优先，其次 NCX；相对 OPF 所在目录，未解码）
+ * @param opf OPF 句柄（已调用 epub_xml_opf_resolve）
+ * @param is_nav 输出：true 为 nav.xhtml，false 为 NCX
+ * @return href，书中没有目录文档时返回 NULL
+ */
+const char* epub_xml_opf_toc_href(const epub_xml_opf_t *opf, bool *is_nav);
+
+/**
+ * @brief 获取封面图片的 href（EPUB3 cover-image 优先，其次 EPUB2 meta cover；相对 OPF 所在目录，未解码）
+ * @param opf OPF 句柄（已调用 epub_xml_opf_resolve）
+ * @return href，书中没有封面时返回 NULL
+ */
+const char* epub_xml_opf_cover_href(const epub_xml_opf_t *opf);
+
+/**
+ * @brief 获取第 index 个样式表（media-type 为 text/css）的 href（相对 OPF 所在目录，未解码）
+ * @param opf OPF 句柄
+ * @param index 序号，按 manifest 中的顺序
+ * @return href，超出样式表个数时返回 NULL
+ */
+const char* epub_xml_opf_stylesheet_href(const epub_xml_opf_t *opf, int index);
+
+/**
+ * @brief 销毁 OPF 解析结果
+ * @param opf OPF 句柄
+ */
+void epub_xml_opf_destroy(epub_xml_opf_t *opf);
+
+#define EPUB_XML_TOC_TITLE_MAX 128  // 目录项标题的最大字节数（含 NUL），超出部分截断
+
+/**
+ * @brief 目录项回调（按文档顺序）
+ * @param user 回调参数
+ * @param href 链接（相对目录文档所在目录，未解码，可能带 #片段）
+ * @param title 标题，空白已折叠，可能为空串
+ * @param depth 嵌套层级，0 为顶层
+ */
+typedef void (*epub_xml_toc_cb_t)(void *user, const char *href, const char *title, int depth);
+
+// NCX / nav.xhtml 目录解析器
+typedef struct epub_xml_toc epub_xml_toc_t;
+
+/**
+ * @brief 创建目录解析器
+ * @param nav true 解析 EPUB3 nav.xhtml，false 解析 NCX
+ * @param callback 目录项回调
+ * @param user 回调参数
+ * @return 句柄，失败返回 NULL
+ */
+epub_xml_toc_t* epub_xml_toc_create(bool nav, epub_xml_toc_cb_t callback, void *user);
+
+/**
+ * @brief 填充解析目录文档的回调
+ * @param toc 目录解析器
+ * @param handler 输出回调
+ */
+void epub_xml_toc_handler(epub_xml_toc_t *toc, epub_xml_handler_t *handler);
+
+/**
+ * @brief 文档结束，交出最后一个目录项（文档被截断时）
+ * @param toc 目录解析器
+ */
+void epub_xml_toc_finish(epub_xml_toc_t *toc);
+
+/**
+ * @brief 销毁目录解析器
+ * @param toc 目录解析器（可为 NULL）
  */
-bool epub_xml_find_content_opf(epub_xml_parser_t *parser,
-                                char *content_opf_path,
-                                size_t path_size);
+void epub_xml_toc_destroy(epub_xml_toc_t *toc);
 
 #ifdef __cplusplus
 }
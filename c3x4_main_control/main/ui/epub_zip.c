@@ -1,16 +1,23 @@
 /**
  * @file epub_zip.c
- * @brief EPUB ZIP 解析器实现 - 简化版，使用 ESP-IDF 的 miniz
+ * @brief EPUB ZIP 解析器实现 - 简化版，deflate 使用 ESP32-C3 ROM 中的 tinfl 流式解压
  */
 
 #include "epub_zip.h"
 #include "esp_log.h"
+#include "miniz.h"
+#include "page_index.h"
+#include "../spi_arbiter.h"
+#include "../power_manager.h"
+#include "../heap_stats.h"
+#include "file_pool.h"
 #include <string.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 
 // ESP-IDF ROM 中包含 miniz，但多文件支持被禁用
-// 这里使用简化版本：只读取 ZIP 中心目录，按需解压
+// 这里使用简化版本：只读取 ZIP 中心目录，按需解压；deflate 使用 ROM 中的 tinfl
 
 static const char *TAG = "EPUB_ZIP";
 
@@ -18,6 +25,28 @@ static const char *TAG = "EPUB_ZIP";
 #define ZIP_LOCAL_FILE_HEADER_SIGNATURE 0x04034b50
 #define ZIP_CENTRAL_DIR_SIGNATURE 0x02014b50
 #define ZIP_END_CENTRAL_DIR_SIGNATURE 0x06054b50
+#define ZIP64_END_CENTRAL_DIR_SIGNATURE 0x06064b50
+#define ZIP64_END_LOCATOR_SIGNATURE 0x07064b50
+#define ZIP64_EXTRA_ID 0x0001
+
+#define ZIP_EOCD_SEARCH_CHUNK 1024   // 向前搜索结束记录时每次读取的字节数
+#define ZIP_MAX_COMMENT       65535
+#define ZIP_MAX_ENTRIES       65535  // by_hash 使用 16 位下标
+#define ZIP_DIR_DEDUP         16     // 构建索引时记住的最近目录数
+#define ZIP_MAX_DEFLATE_RATIO 1032   // deflate 的理论最大压缩比，声明的解压大小超过它即为损坏
+
+#define ZIP_METHOD_STORED   0
+#define ZIP_METHOD_DEFLATE  8
+#define ZIP_INPUT_CHUNK     2048   // 每次从 SD 读取的压缩数据量
+#define ZIP_STDIO_BUF       4096   // FILE 缓冲：中心目录/本地头的小读取合并成整扇区读
+
+#define ZIP_PROBE_CACHE_SIZE 32     // 记住检查结果的文件数
+
+#define ZIP_CHECKPOINT_MAGIC    0x314B4349u  // "ICK1"
+// 每解压这么多字节保存一次检查点（最短间隔）。一个检查点约 43 KB（字典 32 KB + 解码器），
+// 写卡量不超过解压量的 1/3
+#define ZIP_CHECKPOINT_INTERVAL (128 * 1024)
+#define ZIP_CHECKPOINT_MAX      64
 
 #pragma pack(push, 1)
 typedef struct {
@@ -48,7 +77,7 @@ typedef struct {
     uint16_t filename_len;
     uint16_t extra_len;
     uint16_t comment_len;
-    uint32_t disk_start;
+    uint16_t disk_start;
     uint16_t internal_attr;
     uint32_t external_attr;
     uint32_t local_header_offset;
@@ -64,58 +93,387 @@ typedef struct {
     uint32_t central_dir_offset;
     uint16_t comment_len;
 } zip_end_central_dir_t;
+
+typedef struct {
+    uint32_t signature;
+    uint32_t eocd_disk;
+    uint64_t eocd_offset;      // ZIP64 结束记录的偏移
+    uint32_t total_disks;
+} zip64_end_locator_t;
+
+typedef struct {
+    uint32_t signature;
+    uint64_t record_size;
+    uint16_t version_made;
+    uint16_t version_needed;
+    uint32_t disk_num;
+    uint32_t central_dir_disk;
+    uint64_t disk_entries;
+    uint64_t total_entries;
+    uint64_t central_dir_size;
+    uint64_t central_dir_offset;
+} zip64_end_central_dir_t;
 #pragma pack(pop)
 
+// 从（ZIP64）结束记录得到的中心目录位置
+typedef struct {
+    uint32_t total_entries;
+    uint32_t offset;
+    uint32_t size;
+} zip_directory_t;
+
+// 解压状态：tinfl 解码器 + 32KB 环形字典（同时作为输出窗口）+ 输入缓冲，一次分配
+typedef struct {
+    FILE *file;
+    uint32_t data_start;       // 压缩数据在 ZIP 中的偏移
+    uint32_t compressed_size;
+    uint32_t in_read;          // 已读入 input 的压缩字节数
+    size_t in_pos;
+    size_t in_avail;           // input 中尚未交给 tinfl 的字节数
+    size_t dict_ofs;           // 下一次输出在字典中的写入位置
+    uint32_t out_total;        // 已解压的字节数
+    uint32_t out_limit;        // 中心目录声明的解压大小，超出即视为损坏
+    bool done;
+    tinfl_decompressor decomp;
+    uint8_t dict[TINFL_LZ_DICT_SIZE];
+    uint8_t input[ZIP_INPUT_CHUNK];
+} zip_inflater_t;
+
+// 解压检查点：恢复时从 in_offset 重新读取压缩数据，解码器与字典从检查点文件读回
+typedef struct __attribute__((packed)) {
+    uint32_t out_total;
+    uint32_t in_offset;        // 下一个未交给 tinfl 的压缩字节（相对 data_start）
+    uint32_t dict_ofs;
+} zip_checkpoint_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t key;
+    uint32_t count;
+} zip_checkpoint_header_t;
+
+#define ZIP_CHECKPOINT_RECORD_SIZE \
+    (sizeof(zip_checkpoint_t) + sizeof(tinfl_decompressor) + TINFL_LZ_DICT_SIZE)
+
+struct epub_zip_stream {
+    FILE *file;                // ZIP 或 gzip 文件本身，由打开者负责关闭
+    epub_zip_file_info_t info;
+    uint32_t data_start;
+    uint32_t position;         // 已交给调用方的字节数
+    zip_inflater_t *inflater;  // 存储方式的文件为 NULL
+    const uint8_t *pending;    // 字典中已解压、尚未读走的数据
+    size_t pending_len;
+    FILE *ck_file;
+    char ck_path[64];
+    uint32_t ck_key;
+    bool ck_disabled;
+    bool ck_armed;             // 有过向后跳转（或已有检查点文件）才保存：顺序读一遍不写卡
+    uint32_t ck_interval;      // ZIP_CHECKPOINT_INTERVAL，超过 ZIP_CHECKPOINT_MAX 个时按 2 倍拉长
+    int ck_count;
+    zip_checkpoint_t checkpoints[ZIP_CHECKPOINT_MAX];
+};
+
+// 中心目录索引中的一项：名字拆成目录与文件名两段放在共享的名字池中，目录段去重
+typedef struct {
+    uint32_t hash;             // 完整路径的哈希
+    uint32_t offset;
+    uint32_t compressed_size;
+    uint32_t uncompressed_size;
+    uint32_t dir_ofs;          // 目录段（含结尾 '/'）在名字池中的偏移
+    uint32_t base_ofs;         // 文件名段在名字池中的偏移
+    uint8_t dir_len;
+    uint8_t base_len;
+    uint16_t compression_method;
+} zip_entry_t;
+
 struct epub_zip {
     FILE *file;
     char path[256];
-    zip_end_central_dir_t end_record;
-    epub_zip_file_info_t *file_list;
+    zip_directory_t directory;
+    zip_entry_t *entries;      // 中心目录顺序
+    uint16_t *by_hash;         // 按 hash 排序的 entries 下标
     int file_count;
+    char *names;               // 名字池（不以 NUL 分隔）
+    uint32_t names_len;
+    uint32_t names_cap;
 };
 
-// 查找并读取 ZIP 中心目录结束记录
-static bool read_end_central_dir(FILE *file, zip_end_central_dir_t *end_record) {
-    fseek(file, 0, SEEK_END);
-    long file_size = ftell(file);
-
-    // 注释最长 65535，从文件末尾最多向前搜索 64KB
-    long max_search = file_size > 65536 ? 65536 : file_size;
-    long search_start = file_size - max_search;
-
-    uint8_t buffer[65536];
-    long read_size = max_search;
-    fseek(file, search_start, SEEK_SET);
-    size_t n = fread(buffer, 1, read_size, file);
-
-    // 从后向前搜索签名
-    for (int i = n - sizeof(zip_end_central_dir_t); i >= 0; i--) {
-        if (buffer[i] == 0x50 && buffer[i+1] == 0x4b &&
-            buffer[i+2] == 0x05 && buffer[i+3] == 0x06) {
-            memcpy(end_record, &buffer[i], sizeof(zip_end_central_dir_t));
-            return true;
+static bool read_at(FILE *file, long offset, void *buffer, size_t size) {
+    return fseek(file, offset, SEEK_SET) == 0 && fread(buffer, 1, size, file) == size;
+}
+
+// 签名位置是否是一个自洽的结束记录：注释恰好延伸到文件末尾
+static bool eocd_at(const uint8_t *p, long pos, long file_size, zip_end_central_dir_t *end_record) {
+    if (p[0] != 0x50 || p[1] != 0x4b || p[2] != 0x05 || p[3] != 0x06) {
+        return false;
+    }
+    memcpy(end_record, p, sizeof(*end_record));
+    return pos + (long)sizeof(*end_record) + end_record->comment_len == file_size;
+}
+
+// 查找 ZIP 中心目录结束记录：先读末尾 22 字节（无注释时即是），
+// 否则按 1KB 块向前搜索，最多覆盖 64KB 注释
+static bool find_end_central_dir(FILE *file, long file_size, zip_end_central_dir_t *end_record,
+                                 long *record_pos) {
+    const long rec = (long)sizeof(zip_end_central_dir_t);
+    if (file_size < rec) {
+        return false;
+    }
+
+    uint8_t tail[sizeof(zip_end_central_dir_t)];
+    if (!read_at(file, file_size - rec, tail, sizeof(tail))) {
+        return false;
+    }
+    if (eocd_at(tail, file_size - rec, file_size, end_record)) {
+        *record_pos = file_size - rec;
+        return true;
+    }
+
+    // 每块多读 rec-1 字节，签名跨块时也能完整比较
+    uint8_t *chunk = malloc(ZIP_EOCD_SEARCH_CHUNK + rec);
+    if (!chunk) {
+        ESP_LOGE(TAG, "Failed to allocate search buffer");
+        return false;
+    }
+
+    const long lowest = file_size - rec - ZIP_MAX_COMMENT > 0 ? file_size - rec - ZIP_MAX_COMMENT : 0;
+    long end = file_size - rec;    // 本块候选位置的上界（不含）
+    bool found = false;
+    while (!found && end > lowest) {
+        const long start = end - ZIP_EOCD_SEARCH_CHUNK > lowest ? end - ZIP_EOCD_SEARCH_CHUNK : lowest;
+        const long span = end - start + rec - 1;
+        if (!read_at(file, start, chunk, (size_t)span)) {
+            break;
         }
+        for (long i = end - start - 1; i >= 0; i--) {
+            if (eocd_at(&chunk[i], start + i, file_size, end_record)) {
+                *record_pos = start + i;
+                found = true;
+                break;
+            }
+        }
+        end = start;
+    }
+
+    free(chunk);
+    return found;
+}
+
+// 中心目录必须完整位于结束记录之前，且每项至少占一个固定头：
+// 条目数与偏移来自文件本身，校验后 build_file_list 的分配与读取才有界
+static bool directory_valid(const zip_directory_t *dir, uint64_t end_pos) {
+    if ((uint64_t)dir->offset + dir->size > end_pos ||
+        (uint64_t)dir->total_entries * sizeof(zip_central_dir_entry_t) > dir->size) {
+        ESP_LOGE(TAG, "Central directory out of bounds (%u entries, %u bytes at %u)",
+                 (unsigned)dir->total_entries, (unsigned)dir->size, (unsigned)dir->offset);
+        return false;
+    }
+    return true;
+}
+
+// 中心目录中有字段溢出时，从紧邻结束记录之前的 ZIP64 定位器找到 ZIP64 结束记录
+static bool read_zip64_directory(FILE *file, long record_pos, zip_directory_t *dir) {
+    zip64_end_locator_t locator;
+    if (record_pos < (long)sizeof(locator) ||
+        !read_at(file, record_pos - (long)sizeof(locator), &locator, sizeof(locator)) ||
+        locator.signature != ZIP64_END_LOCATOR_SIGNATURE) {
+        ESP_LOGE(TAG, "ZIP64 locator not found");
+        return false;
+    }
+
+    zip64_end_central_dir_t eocd64;
+    if (locator.eocd_offset > (uint64_t)record_pos ||
+        !read_at(file, (long)locator.eocd_offset, &eocd64, sizeof(eocd64)) ||
+        eocd64.signature != ZIP64_END_CENTRAL_DIR_SIGNATURE) {
+        ESP_LOGE(TAG, "Invalid ZIP64 end of central directory");
+        return false;
+    }
+
+    // FAT 上的文件不超过 4GB，偏移与大小都能放进 32 位
+    if (eocd64.total_entries > UINT32_MAX || eocd64.central_dir_offset > UINT32_MAX ||
+        eocd64.central_dir_size > UINT32_MAX) {
+        ESP_LOGE(TAG, "ZIP64 directory out of range");
+        return false;
+    }
+    dir->total_entries = (uint32_t)eocd64.total_entries;
+    dir->offset = (uint32_t)eocd64.central_dir_offset;
+    dir->size = (uint32_t)eocd64.central_dir_size;
+    return directory_valid(dir, locator.eocd_offset);
+}
+
+static bool read_end_central_dir(FILE *file, long file_size, zip_directory_t *dir) {
+    zip_end_central_dir_t end_record;
+    long record_pos;
+    if (!find_end_central_dir(file, file_size, &end_record, &record_pos)) {
+        return false;
     }
 
+    if (end_record.total_entries == 0xFFFF || end_record.central_dir_offset == 0xFFFFFFFF ||
+        end_record.central_dir_size == 0xFFFFFFFF) {
+        return read_zip64_directory(file, record_pos, dir);
+    }
+    dir->total_entries = end_record.total_entries;
+    dir->offset = end_record.central_dir_offset;
+    dir->size = end_record.central_dir_size;
+    return directory_valid(dir, (uint64_t)record_pos);
+}
+
+// 读取 ZIP64 extra 字段中被 0xFFFFFFFF 占位的大小与偏移（按规范顺序出现）
+static bool apply_zip64_extra(const uint8_t *extra, size_t len, epub_zip_file_info_t *info) {
+    size_t pos = 0;
+    while (pos + 4 <= len) {
+        const uint16_t id = extra[pos] | (extra[pos + 1] << 8);
+        const uint16_t size = extra[pos + 2] | (extra[pos + 3] << 8);
+        pos += 4;
+        if (pos + size > len) {
+            break;
+        }
+        if (id == ZIP64_EXTRA_ID) {
+            uint32_t *fields[] = {&info->uncompressed_size, &info->compressed_size, &info->offset};
+            size_t at = pos;
+            for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+                if (*fields[i] != 0xFFFFFFFF) {
+                    continue;
+                }
+                uint64_t value;
+                if (at + sizeof(value) > pos + size) {
+                    return false;
+                }
+                memcpy(&value, &extra[at], sizeof(value));
+                at += sizeof(value);
+                if (value >= 0xFFFFFFFF) {
+                    return false;
+                }
+                *fields[i] = (uint32_t)value;
+            }
+            return true;
+        }
+        pos += size;
+    }
     return false;
 }
 
-// 读取中心目录并构建文件列表
+// 向名字池追加一段，返回其偏移；失败返回 UINT32_MAX
+static uint32_t names_append(epub_zip_t *zip, const char *text, size_t len) {
+    if (len == 0) {
+        return zip->names_len;
+    }
+    if (zip->names_len + len > zip->names_cap) {
+        uint32_t cap = zip->names_cap ? zip->names_cap : 1024;
+        while (cap < zip->names_len + len) {
+            cap *= 2;
+        }
+        char *grown = heap_stats_realloc(HEAP_TAG_EPUB, zip->names, cap);
+        if (!grown) {
+            return UINT32_MAX;
+        }
+        zip->names = grown;
+        zip->names_cap = cap;
+    }
+    const uint32_t ofs = zip->names_len;
+    memcpy(zip->names + ofs, text, len);
+    zip->names_len += len;
+    return ofs;
+}
+
+static void entry_name(const epub_zip_t *zip, const zip_entry_t *e, char *out) {
+    memcpy(out, zip->names + e->dir_ofs, e->dir_len);
+    memcpy(out + e->dir_len, zip->names + e->base_ofs, e->base_len);
+    out[e->dir_len + e->base_len] = '\0';
+}
+
+static bool entry_name_equals(const epub_zip_t *zip, const zip_entry_t *e, const char *name,
+                              size_t len) {
+    return len == (size_t)e->dir_len + e->base_len &&
+           memcmp(zip->names + e->dir_ofs, name, e->dir_len) == 0 &&
+           memcmp(zip->names + e->base_ofs, name + e->dir_len, e->base_len) == 0;
+}
+
+// 需要时才拼出完整文件名
+static void entry_to_info(const epub_zip_t *zip, const zip_entry_t *e, epub_zip_file_info_t *info) {
+    entry_name(zip, e, info->filename);
+    info->offset = e->offset;
+    info->compressed_size = e->compressed_size;
+    info->uncompressed_size = e->uncompressed_size;
+    info->compression_method = e->compression_method;
+}
+
+static int compare_u64(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static bool build_hash_order(epub_zip_t *zip) {
+    const size_t n = (size_t)zip->file_count;
+    uint64_t *keys = malloc(n * sizeof(uint64_t) + 1);
+    zip->by_hash = heap_stats_malloc(HEAP_TAG_EPUB, n * sizeof(uint16_t) + 1);
+    if (!keys || !zip->by_hash) {
+        free(keys);
+        ESP_LOGE(TAG, "Failed to allocate hash index");
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = ((uint64_t)zip->entries[i].hash << 32) | i;
+    }
+    qsort(keys, n, sizeof(uint64_t), compare_u64);
+    for (size_t i = 0; i < n; i++) {
+        zip->by_hash[i] = (uint16_t)keys[i];
+    }
+    free(keys);
+    return true;
+}
+
+// 条目数据必须在中心目录之前，声明的大小要与压缩方式相符；
+// 解压因此受文件大小约束（deflate 最多 ZIP_MAX_DEFLATE_RATIO 倍），不会被伪造的大小拖住
+static bool entry_data_valid(const epub_zip_t *zip, const epub_zip_file_info_t *info,
+                             uint16_t method) {
+    const uint64_t data_end = (uint64_t)info->offset + sizeof(zip_local_file_header_t) +
+                              info->compressed_size;
+    if (data_end > zip->directory.offset) {
+        return false;
+    }
+    if (method == ZIP_METHOD_STORED) {
+        return info->compressed_size == info->uncompressed_size;
+    }
+    if (method == ZIP_METHOD_DEFLATE) {
+        return (uint64_t)info->uncompressed_size <=
+               (uint64_t)info->compressed_size * ZIP_MAX_DEFLATE_RATIO + 64;
+    }
+    return true;   // 不支持的方式在解压时报错
+}
+
+// 读取中心目录并构建紧凑索引
 static bool build_file_list(epub_zip_t *zip) {
     FILE *file = zip->file;
-    fseek(file, zip->end_record.central_dir_offset, SEEK_SET);
+    if (fseek(file, zip->directory.offset, SEEK_SET) != 0) {
+        ESP_LOGE(TAG, "Failed to seek to central directory");
+        return false;
+    }
 
-    zip->file_list = calloc(zip->end_record.total_entries, sizeof(epub_zip_file_info_t));
-    if (!zip->file_list) {
+    if (zip->directory.total_entries > ZIP_MAX_ENTRIES) {
+        ESP_LOGE(TAG, "Too many entries: %u", (unsigned)zip->directory.total_entries);
+        return false;
+    }
+    zip->entries = heap_stats_malloc(HEAP_TAG_EPUB,
+                                     zip->directory.total_entries * sizeof(zip_entry_t) + 1);
+    if (!zip->entries) {
         ESP_LOGE(TAG, "Failed to allocate file list");
         return false;
     }
 
+    // 最近出现的目录段，EPUB 中的条目通常按目录聚在一起
+    struct { uint32_t ofs; uint8_t len; } dirs[ZIP_DIR_DEDUP];
+    int dir_count = 0;
+    int dir_next = 0;
+
     int count = 0;
-    for (int i = 0; i < zip->end_record.total_entries; i++) {
+    int skipped = 0;
+    uint32_t consumed = 0;     // 已读过的中心目录字节数，不超出 directory.size
+    for (uint32_t i = 0; i < zip->directory.total_entries; i++) {
         zip_central_dir_entry_t entry;
-        size_t n = fread(&entry, 1, sizeof(entry), file);
-        if (n != sizeof(entry)) {
+        if (zip->directory.size - consumed < sizeof(entry) ||
+            fread(&entry, 1, sizeof(entry), file) != sizeof(entry)) {
             break;
         }
 
@@ -123,30 +481,237 @@ static bool build_file_list(epub_zip_t *zip) {
             ESP_LOGE(TAG, "Invalid central dir signature");
             break;
         }
+        const uint32_t record_len = sizeof(entry) + (uint32_t)entry.filename_len + entry.extra_len +
+                                    entry.comment_len;
+        if (zip->directory.size - consumed < record_len) {
+            ESP_LOGE(TAG, "Central dir entry %u runs past the directory", (unsigned)i);
+            break;
+        }
+        consumed += record_len;
 
         // 读取文件名
         if (entry.filename_len > 0 && entry.filename_len < 255) {
-            epub_zip_file_info_t *info = &zip->file_list[count];
-            fread(info->filename, 1, entry.filename_len, file);
-            info->filename[entry.filename_len] = '\0';
+            epub_zip_file_info_t info;
+            if (fread(info.filename, 1, entry.filename_len, file) != entry.filename_len) {
+                break;
+            }
+            info.filename[entry.filename_len] = '\0';
 
-            info->offset = entry.local_header_offset;
-            info->compressed_size = entry.compressed_size;
-            info->uncompressed_size = entry.uncompressed_size;
-            info->compression_method = entry.compression;
+            info.offset = entry.local_header_offset;
+            info.compressed_size = entry.compressed_size;
+            info.uncompressed_size = entry.uncompressed_size;
 
-            count++;
+            // 名字中间有 NUL 时按名字查找会与哈希对不上，视为损坏
+            bool valid = memchr(info.filename, '\0', entry.filename_len) == NULL;
+            if (!valid) {
+                skipped++;
+            }
+            if (valid && (info.offset == 0xFFFFFFFF || info.compressed_size == 0xFFFFFFFF ||
+                          info.uncompressed_size == 0xFFFFFFFF)) {
+                uint8_t extra[128];
+                const size_t extra_len = entry.extra_len < sizeof(extra) ? entry.extra_len : sizeof(extra);
+                valid = fread(extra, 1, extra_len, file) == extra_len &&
+                        apply_zip64_extra(extra, extra_len, &info);
+                if (!valid) {
+                    ESP_LOGW(TAG, "Skipping entry with bad ZIP64 extra: %s", info.filename);
+                }
+                entry.extra_len -= extra_len;
+            }
+            if (valid && !entry_data_valid(zip, &info, entry.compression)) {
+                valid = false;
+                skipped++;
+            }
+
+            if (valid) {
+                const char *slash = strrchr(info.filename, '/');
+                const uint8_t dir_len = slash ? (uint8_t)(slash + 1 - info.filename) : 0;
+                zip_entry_t *e = &zip->entries[count];
+
+                int d = 0;
+                while (d < dir_count && (dirs[d].len != dir_len ||
+                                         memcmp(zip->names + dirs[d].ofs, info.filename, dir_len) != 0)) {
+                    d++;
+                }
+                if (d < dir_count) {
+                    e->dir_ofs = dirs[d].ofs;
+                } else {
+                    e->dir_ofs = names_append(zip, info.filename, dir_len);
+                    dirs[dir_next].ofs = e->dir_ofs;
+                    dirs[dir_next].len = dir_len;
+                    dir_next = (dir_next + 1) % ZIP_DIR_DEDUP;
+                    if (dir_count < ZIP_DIR_DEDUP) {
+                        dir_count++;
+                    }
+                }
+                e->dir_len = dir_len;
+                e->base_len = (uint8_t)(entry.filename_len - dir_len);
+                e->base_ofs = names_append(zip, info.filename + dir_len, e->base_len);
+                if (e->dir_ofs == UINT32_MAX || e->base_ofs == UINT32_MAX) {
+                    ESP_LOGE(TAG, "Failed to allocate name pool");
+                    return false;
+                }
+
+                e->hash = page_index_hash(0, info.filename, entry.filename_len);
+                e->offset = info.offset;
+                e->compressed_size = info.compressed_size;
+                e->uncompressed_size = info.uncompressed_size;
+                e->compression_method = entry.compression;
+                count++;
+            }
+        } else {
+            fseek(file, entry.filename_len, SEEK_CUR);
         }
 
-        // 跳过 extra 和 comment
+        // 跳过（剩余的）extra 和 comment
         fseek(file, entry.extra_len + entry.comment_len, SEEK_CUR);
     }
 
     zip->file_count = count;
-    ESP_LOGI(TAG, "Built file list: %d files", count);
+    if (skipped > 0) {
+        ESP_LOGW(TAG, "Skipped %d entries with impossible offsets or sizes", skipped);
+    }
+
+    // 收回多分配的部分
+    if (zip->names_len > 0 && zip->names_len < zip->names_cap) {
+        char *shrunk = heap_stats_realloc(HEAP_TAG_EPUB, zip->names, zip->names_len);
+        if (shrunk) {
+            zip->names = shrunk;
+            zip->names_cap = zip->names_len;
+        }
+    }
+    if (!build_hash_order(zip)) {
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Built file list: %d files, %u bytes of names", count, (unsigned)zip->names_len);
     return true;
 }
 
+// 精确匹配：按 hash 二分查找，再比较名字排除碰撞
+static const zip_entry_t *find_exact(const epub_zip_t *zip, const char *name) {
+    const size_t len = strlen(name);
+    const uint32_t hash = page_index_hash(0, name, len);
+
+    int lo = 0;
+    int hi = zip->file_count;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (zip->entries[zip->by_hash[mid]].hash < hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (; lo < zip->file_count && zip->entries[zip->by_hash[lo]].hash == hash; lo++) {
+        const zip_entry_t *e = &zip->entries[zip->by_hash[lo]];
+        if (entry_name_equals(zip, e, name, len)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 容器检查：OCF 要求 mimetype 是第一个条目、不压缩、没有 extra 字段，
+// 内容 "application/epub+zip" 因此固定在偏移 38（文件名在偏移 30）
+// ---------------------------------------------------------------------------
+
+static const char EPUB_MIMETYPE[] = "application/epub+zip";
+
+typedef struct {
+    uint32_t path_hash;      // 0 表示空槽
+    uint32_t size;
+    uint32_t mtime;
+    epub_zip_probe_t result;
+} zip_probe_entry_t;
+
+static zip_probe_entry_t s_probe_cache[ZIP_PROBE_CACHE_SIZE];
+static int s_probe_next;     // 轮流替换
+
+static uint32_t probe_hash(const char *path) {
+    const uint32_t h = page_index_hash(0, path, strlen(path));
+    return h != 0 ? h : 1;
+}
+
+static zip_probe_entry_t *probe_lookup(uint32_t path_hash) {
+    for (int i = 0; i < ZIP_PROBE_CACHE_SIZE; i++) {
+        if (s_probe_cache[i].path_hash == path_hash) {
+            return &s_probe_cache[i];
+        }
+    }
+    return NULL;
+}
+
+static void probe_remember(uint32_t path_hash, const struct stat *st, epub_zip_probe_t result) {
+    zip_probe_entry_t *e = probe_lookup(path_hash);
+    if (e == NULL) {
+        e = &s_probe_cache[s_probe_next];
+        s_probe_next = (s_probe_next + 1) % ZIP_PROBE_CACHE_SIZE;
+    }
+    e->path_hash = path_hash;
+    e->size = (uint32_t)st->st_size;
+    e->mtime = (uint32_t)st->st_mtime;
+    e->result = result;
+}
+
+static bool mimetype_first(FILE *file) {
+    uint8_t head[sizeof(zip_local_file_header_t) + 8 + sizeof(EPUB_MIMETYPE) - 1];
+    if (!read_at(file, 0, head, sizeof(head))) {
+        return false;
+    }
+    zip_local_file_header_t local;
+    memcpy(&local, head, sizeof(local));
+    const uint8_t *name = head + sizeof(local);
+    return local.signature == ZIP_LOCAL_FILE_HEADER_SIGNATURE &&
+           local.compression == ZIP_METHOD_STORED && local.filename_len == 8 &&
+           local.extra_len == 0 && local.compressed_size == sizeof(EPUB_MIMETYPE) - 1 &&
+           memcmp(name, "mimetype", 8) == 0 &&
+           memcmp(name + 8, EPUB_MIMETYPE, sizeof(EPUB_MIMETYPE) - 1) == 0;
+}
+
+// 一次打开的两项检查：开头的 mimetype 条目与末尾的结束记录
+static epub_zip_probe_t probe_file(FILE *file, long file_size, zip_directory_t *dir) {
+    if (!read_end_central_dir(file, file_size, dir)) {
+        return EPUB_ZIP_PROBE_INVALID;
+    }
+    return mimetype_first(file) ? EPUB_ZIP_PROBE_EPUB : EPUB_ZIP_PROBE_ZIP;
+}
+
+static void probe_log(const char *epub_path, epub_zip_probe_t result) {
+    if (result == EPUB_ZIP_PROBE_INVALID) {
+        ESP_LOGW(TAG, "Not a valid ZIP/EPUB: %s", epub_path);
+    } else if (result == EPUB_ZIP_PROBE_ZIP) {
+        ESP_LOGW(TAG, "mimetype is not the first stored entry: %s", epub_path);
+    }
+}
+
+epub_zip_probe_t epub_zip_probe(const char *epub_path) {
+    if (epub_path == NULL) {
+        return EPUB_ZIP_PROBE_INVALID;
+    }
+    struct stat st;
+    if (stat(epub_path, &st) != 0) {
+        return EPUB_ZIP_PROBE_INVALID;
+    }
+    const uint32_t path_hash = probe_hash(epub_path);
+    const zip_probe_entry_t *cached = probe_lookup(path_hash);
+    if (cached != NULL && cached->size == (uint32_t)st.st_size &&
+        cached->mtime == (uint32_t)st.st_mtime) {
+        return cached->result;
+    }
+
+    epub_zip_probe_t result = EPUB_ZIP_PROBE_INVALID;
+    FILE *file = fopen(epub_path, "rb");
+    if (file != NULL) {
+        zip_directory_t dir;
+        result = probe_file(file, (long)st.st_size, &dir);
+        fclose(file);
+    }
+    probe_log(epub_path, result);
+    probe_remember(path_hash, &st, result);
+    return result;
+}
+
 epub_zip_t* epub_zip_open(const char *epub_path) {
     epub_zip_t *zip = calloc(1, sizeof(epub_zip_t));
     if (!zip) {
@@ -156,28 +721,40 @@ epub_zip_t* epub_zip_open(const char *epub_path) {
 
     strncpy(zip->path, epub_path, sizeof(zip->path) - 1);
 
-    zip->file = fopen(epub_path, "rb");
+    zip->file = file_pool_fopen(epub_path);
     if (!zip->file) {
         ESP_LOGE(TAG, "Failed to open EPUB: %s", epub_path);
         free(zip);
         return NULL;
     }
+    // newlib 默认缓冲只有 128 字节，目录项逐条读取时每条都要单独访问 SD 卡
+    setvbuf(zip->file, NULL, _IOFBF, ZIP_STDIO_BUF);
 
-    // 读取中心目录
-    if (!read_end_central_dir(zip->file, &zip->end_record)) {
+    // 定位中心目录，顺带完成容器检查并记住结果
+    struct stat st;
+    epub_zip_probe_t result = EPUB_ZIP_PROBE_INVALID;
+    if (stat(epub_path, &st) == 0) {
+        result = probe_file(zip->file, (long)st.st_size, &zip->directory);
+        const uint32_t path_hash = probe_hash(epub_path);
+        const zip_probe_entry_t *cached = probe_lookup(path_hash);
+        if (cached == NULL || cached->result != result) {
+            probe_log(epub_path, result);
+        }
+        probe_remember(path_hash, &st, result);
+    }
+    if (result == EPUB_ZIP_PROBE_INVALID) {
         ESP_LOGE(TAG, "Failed to read end central dir");
         fclose(zip->file);
         free(zip);
         return NULL;
     }
 
-    ESP_LOGI(TAG, "ZIP: %d entries, central dir at offset %u",
-             zip->end_record.total_entries, zip->end_record.central_dir_offset);
+    ESP_LOGI(TAG, "ZIP: %u entries, central dir at offset %u",
+             (unsigned)zip->directory.total_entries, (unsigned)zip->directory.offset);
 
     // 构建文件列表
     if (!build_file_list(zip)) {
-        fclose(zip->file);
-        free(zip);
+        epub_zip_close(zip);
         return NULL;
     }
 
@@ -190,9 +767,9 @@ void epub_zip_close(epub_zip_t *zip) {
     if (zip->file) {
         fclose(zip->file);
     }
-    if (zip->file_list) {
-        free(zip->file_list);
-    }
+    heap_stats_free(HEAP_TAG_EPUB, zip->entries);
+    heap_stats_free(HEAP_TAG_EPUB, zip->by_hash);
+    heap_stats_free(HEAP_TAG_EPUB, zip->names);
     free(zip);
 }
 
@@ -203,9 +780,11 @@ int epub_zip_list_files(epub_zip_t *zip, const char *pattern,
     }
 
     int count = 0;
+    char name[256];
     for (int i = 0; i < zip->file_count && count < max_files; i++) {
-        if (!pattern || strstr(zip->file_list[i].filename, pattern)) {
-            memcpy(&files[count], &zip->file_list[i], sizeof(epub_zip_file_info_t));
+        entry_name(zip, &zip->entries[i], name);
+        if (!pattern || strstr(name, pattern)) {
+            entry_to_info(zip, &zip->entries[i], &files[count]);
             count++;
         }
     }
@@ -219,10 +798,18 @@ bool epub_zip_find_file(epub_zip_t *zip, const char *filename,
         return false;
     }
 
+    const zip_entry_t *e = find_exact(zip, filename);
+    if (e) {
+        entry_to_info(zip, e, file_info);
+        return true;
+    }
+
+    // 兼容旧行为：精确匹配失败时退回子串匹配（如只给出文件名）
+    char name[256];
     for (int i = 0; i < zip->file_count; i++) {
-        if (strcmp(zip->file_list[i].filename, filename) == 0 ||
-            strstr(zip->file_list[i].filename, filename)) {
-            memcpy(file_info, &zip->file_list[i], sizeof(epub_zip_file_info_t));
+        entry_name(zip, &zip->entries[i], name);
+        if (strstr(name, filename)) {
+            entry_to_info(zip, &zip->entries[i], file_info);
             return true;
         }
     }
@@ -230,6 +817,208 @@ bool epub_zip_find_file(epub_zip_t *zip, const char *filename,
     return false;
 }
 
+// 定位到文件数据起点（跳过本地文件头及其文件名、extra）
+static bool seek_file_data(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
+                           uint32_t *data_start) {
+    if (fseek(zip->file, file_info->offset, SEEK_SET) != 0) {
+        ESP_LOGE(TAG, "Failed to seek to local header");
+        return false;
+    }
+
+    zip_local_file_header_t local_header;
+    if (fread(&local_header, 1, sizeof(local_header), zip->file) != sizeof(local_header)) {
+        ESP_LOGE(TAG, "Failed to read local header");
+        return false;
+    }
+
+    if (local_header.signature != ZIP_LOCAL_FILE_HEADER_SIGNATURE) {
+        ESP_LOGE(TAG, "Invalid local header signature");
+        return false;
+    }
+
+    // 大小以中心目录为准：带数据描述符（flags bit 3）时本地头中的大小为 0
+    *data_start = file_info->offset + sizeof(local_header) + local_header.filename_len +
+                  local_header.extra_len;
+    return fseek(zip->file, *data_start, SEEK_SET) == 0;
+}
+
+static int copy_stored(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
+                       epub_zip_output_cb_t output, void *user) {
+    uint8_t *chunk = malloc(ZIP_INPUT_CHUNK);
+    if (!chunk) {
+        ESP_LOGE(TAG, "Failed to allocate read buffer");
+        return -1;
+    }
+
+    uint32_t remaining = file_info->uncompressed_size;
+    int total = 0;
+    while (remaining > 0) {
+        const size_t want = remaining < ZIP_INPUT_CHUNK ? remaining : ZIP_INPUT_CHUNK;
+        const size_t n = fread(chunk, 1, want, zip->file);
+        if (n == 0) {
+            ESP_LOGE(TAG, "Unexpected end of stored data: %s", file_info->filename);
+            free(chunk);
+            return -1;
+        }
+        remaining -= n;
+        total += n;
+        if (!output(chunk, n, user)) {
+            break;
+        }
+    }
+
+    free(chunk);
+    return total;
+}
+
+static void inflater_reset(zip_inflater_t *z, FILE *file, uint32_t data_start,
+                           uint32_t compressed_size, uint32_t uncompressed_size) {
+    tinfl_init(&z->decomp);
+    z->file = file;
+    z->data_start = data_start;
+    z->compressed_size = compressed_size;
+    z->out_limit = uncompressed_size;
+    z->in_read = 0;
+    z->in_pos = 0;
+    z->in_avail = 0;
+    z->dict_ofs = 0;
+    z->out_total = 0;
+    z->done = false;
+}
+
+// 解压出下一段数据，指向字典内部，下次调用前有效
+// 返回 1 有输出，0 已结束，-1 出错
+static int inflater_step(zip_inflater_t *z, const uint8_t **out, size_t *out_len) {
+    *out_len = 0;
+    while (!z->done) {
+        if (z->in_avail == 0 && z->in_read < z->compressed_size) {
+            const uint32_t left = z->compressed_size - z->in_read;
+            const size_t want = left < ZIP_INPUT_CHUNK ? left : ZIP_INPUT_CHUNK;
+            // 文件句柄可能被其他流共用，每次按绝对位置读取
+            spi_arbiter_sd_begin();
+            const bool ok = fseek(z->file, z->data_start + z->in_read, SEEK_SET) == 0 &&
+                            (z->in_avail = fread(z->input, 1, want, z->file)) > 0;
+            spi_arbiter_sd_end();
+            if (!ok) {
+                ESP_LOGE(TAG, "Unexpected end of deflate data");
+                return -1;
+            }
+            z->in_read += z->in_avail;
+            z->in_pos = 0;
+        }
+
+        const bool more_input = z->in_read < z->compressed_size;
+        size_t in_bytes = z->in_avail;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - z->dict_ofs;
+        // 解压期间升到最高频率，读 SD 时不持锁
+        power_manager_lock(POWER_LOCK_CPU);
+        const tinfl_status status = tinfl_decompress(
+            &z->decomp, &z->input[z->in_pos], &in_bytes, z->dict, &z->dict[z->dict_ofs], &out_bytes,
+            more_input ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+        power_manager_unlock(POWER_LOCK_CPU);
+        z->in_pos += in_bytes;
+        z->in_avail -= in_bytes;
+
+        if (status == TINFL_STATUS_DONE) {
+            z->done = true;
+        } else if (status < 0 ||
+                   (status == TINFL_STATUS_NEEDS_MORE_INPUT && !more_input && z->in_avail == 0)) {
+            ESP_LOGE(TAG, "Inflate failed (%d)", (int)status);
+            return -1;
+        }
+
+        // out_total 可能来自 SD 卡上的检查点，先确认它本身没有越界
+        if (z->out_total > z->out_limit || out_bytes > z->out_limit - z->out_total) {
+            ESP_LOGE(TAG, "Inflated data exceeds the declared %u bytes", (unsigned)z->out_limit);
+            return -1;
+        }
+        if (out_bytes > 0) {
+            *out = &z->dict[z->dict_ofs];
+            *out_len = out_bytes;
+            z->dict_ofs = (z->dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+            z->out_total += out_bytes;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int inflate_deflated(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
+                            uint32_t data_start, epub_zip_output_cb_t output, void *user) {
+    zip_inflater_t *z = heap_stats_malloc(HEAP_TAG_EPUB, sizeof(zip_inflater_t));
+    if (!z) {
+        ESP_LOGE(TAG, "Failed to allocate inflate state (%u bytes)", (unsigned)sizeof(*z));
+        return -1;
+    }
+    inflater_reset(z, zip->file, data_start, file_info->compressed_size,
+                   file_info->uncompressed_size);
+
+    int total = 0;
+    for (;;) {
+        const uint8_t *data;
+        size_t len;
+        const int r = inflater_step(z, &data, &len);
+        if (r < 0) {
+            ESP_LOGE(TAG, "Failed to inflate %s", file_info->filename);
+            total = -1;
+            break;
+        }
+        if (r == 0) {
+            if ((uint32_t)total != file_info->uncompressed_size) {
+                ESP_LOGW(TAG, "%s: inflated %d bytes, directory says %u", file_info->filename,
+                         total, (unsigned)file_info->uncompressed_size);
+            }
+            break;
+        }
+        total += len;
+        if (!output(data, len, user)) {
+            break;
+        }
+    }
+
+    heap_stats_free(HEAP_TAG_EPUB, z);
+    return total;
+}
+
+int epub_zip_extract_to_callback(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
+                                 epub_zip_output_cb_t output, void *user) {
+    if (!zip || !file_info || !output) {
+        return -1;
+    }
+
+    uint32_t data_start;
+    if (!seek_file_data(zip, file_info, &data_start)) {
+        return -1;
+    }
+
+    if (file_info->compression_method == ZIP_METHOD_STORED) {
+        return copy_stored(zip, file_info, output, user);
+    } else if (file_info->compression_method == ZIP_METHOD_DEFLATE) {
+        return inflate_deflated(zip, file_info, data_start, output, user);
+    }
+
+    ESP_LOGE(TAG, "Unsupported compression method: %u", file_info->compression_method);
+    return -1;
+}
+
+typedef struct {
+    uint8_t *buffer;
+    size_t size;
+    size_t used;
+    bool overflow;
+} extract_buffer_t;
+
+static bool extract_buffer_write(const void *data, size_t len, void *user) {
+    extract_buffer_t *out = (extract_buffer_t *)user;
+    if (len > out->size - out->used) {
+        out->overflow = true;
+        return false;
+    }
+    memcpy(out->buffer + out->used, data, len);
+    out->used += len;
+    return true;
+}
+
 int epub_zip_extract_file(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
                           void *buffer, size_t buffer_size) {
     if (!zip || !file_info || !buffer) {
@@ -238,43 +1027,339 @@ int epub_zip_extract_file(epub_zip_t *zip, const epub_zip_file_info_t *file_info
 
     if (file_info->uncompressed_size > buffer_size) {
         ESP_LOGE(TAG, "Buffer too small: need %u, have %u",
-                 file_info->uncompressed_size, buffer_size);
+                 (unsigned)file_info->uncompressed_size, (unsigned)buffer_size);
         return -1;
     }
 
-    // 跳到本地文件头
-    fseek(zip->file, file_info->offset, SEEK_SET);
-
-    // 读取本地文件头
-    zip_local_file_header_t local_header;
-    if (fread(&local_header, 1, sizeof(local_header), zip->file) != sizeof(local_header)) {
-        ESP_LOGE(TAG, "Failed to read local header");
+    extract_buffer_t out = {
+        .buffer = (uint8_t *)buffer,
+        .size = buffer_size,
+    };
+    if (epub_zip_extract_to_callback(zip, file_info, extract_buffer_write, &out) < 0) {
         return -1;
     }
-
-    if (local_header.signature != ZIP_LOCAL_FILE_HEADER_SIGNATURE) {
-        ESP_LOGE(TAG, "Invalid local header signature");
+    if (out.overflow) {
+        ESP_LOGE(TAG, "%s inflates beyond %u bytes", file_info->filename, (unsigned)buffer_size);
         return -1;
     }
+    return (int)out.used;
+}
 
-    // 跳过文件名和 extra
-    fseek(zip->file, local_header.filename_len + local_header.extra_len, SEEK_CUR);
+int epub_zip_get_file_count(epub_zip_t *zip) {
+    return zip ? zip->file_count : 0;
+}
+
+bool epub_zip_get_file_info(epub_zip_t *zip, int index, epub_zip_file_info_t *file_info) {
+    if (!zip || !file_info || index < 0 || index >= zip->file_count) {
+        return false;
+    }
+    entry_to_info(zip, &zip->entries[index], file_info);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 流式读取：按需解压，检查点保存在 SD 卡上，已读过的位置可直接恢复
+// ---------------------------------------------------------------------------
+
+static uint32_t checkpoint_key(const epub_zip_stream_t *stream, const char *path) {
+    struct stat st;
+    const uint32_t mtime = stat(path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    const uint32_t layout = (uint32_t)sizeof(tinfl_decompressor);
+    uint32_t key = page_index_hash(0, path, strlen(path));
+    key = page_index_hash(key, &mtime, sizeof(mtime));
+    key = page_index_hash(key, &stream->info.offset, sizeof(stream->info.offset));
+    key = page_index_hash(key, &stream->info.compressed_size, sizeof(stream->info.compressed_size));
+    key = page_index_hash(key, &stream->info.uncompressed_size,
+                          sizeof(stream->info.uncompressed_size));
+    return page_index_hash(key, &layout, sizeof(layout));
+}
 
-    // 读取数据
-    if (local_header.compression == 0) {
-        // 存储 - 直接读取
-        size_t n = fread(buffer, 1, local_header.uncompressed_size, zip->file);
-        return n;
-    } else if (local_header.compression == 8) {
-        // Deflate - 需要 miniz 解压
-        ESP_LOGW(TAG, "Deflate compression not implemented yet");
+// 读入上次打开时保存的检查点（只读各条记录的位置信息）
+static void checkpoints_load(epub_zip_stream_t *stream) {
+    stream->ck_file = fopen(stream->ck_path, "r+b");
+    if (!stream->ck_file) {
+        return;
+    }
+
+    zip_checkpoint_header_t hdr;
+    if (fread(&hdr, sizeof(hdr), 1, stream->ck_file) != 1 || hdr.magic != ZIP_CHECKPOINT_MAGIC ||
+        hdr.key != stream->ck_key) {
+        fclose(stream->ck_file);
+        stream->ck_file = NULL;
+        return;
+    }
+
+    const int count = hdr.count < ZIP_CHECKPOINT_MAX ? (int)hdr.count : ZIP_CHECKPOINT_MAX;
+    for (int i = 0; i < count; i++) {
+        zip_checkpoint_t *ck = &stream->checkpoints[i];
+        const long at = (long)sizeof(hdr) + (long)i * ZIP_CHECKPOINT_RECORD_SIZE;
+        if (fseek(stream->ck_file, at, SEEK_SET) != 0 ||
+            fread(ck, sizeof(*ck), 1, stream->ck_file) != 1 ||
+            ck->out_total > stream->info.uncompressed_size ||
+            ck->in_offset > stream->info.compressed_size || ck->dict_ofs >= TINFL_LZ_DICT_SIZE ||
+            (i > 0 && ck->out_total <= stream->checkpoints[i - 1].out_total)) {
+            break;
+        }
+        stream->ck_count = i + 1;
+    }
+    stream->ck_armed = stream->ck_count > 0;
+    ESP_LOGI(TAG, "%s: %d inflate checkpoints", stream->info.filename, stream->ck_count);
+}
+
+// 解压到新的检查点间隔时把解码器与字典写入检查点文件（只在出现过向后跳转之后）
+static void checkpoint_save(epub_zip_stream_t *stream) {
+    const zip_inflater_t *z = stream->inflater;
+    if (stream->ck_disabled || !stream->ck_armed || z->done || stream->ck_count >= ZIP_CHECKPOINT_MAX ||
+        z->out_total < (uint32_t)(stream->ck_count + 1) * stream->ck_interval) {
+        return;
+    }
+
+    if (!stream->ck_file) {
+        mkdir(PAGE_INDEX_DIR, 0775);
+        stream->ck_file = fopen(stream->ck_path, "w+b");
+        if (!stream->ck_file) {
+            ESP_LOGW(TAG, "Cannot create %s, checkpoints disabled", stream->ck_path);
+            stream->ck_disabled = true;
+            return;
+        }
+    }
+
+    const zip_checkpoint_t ck = {
+        .out_total = z->out_total,
+        .in_offset = z->in_read - (uint32_t)z->in_avail,
+        .dict_ofs = (uint32_t)z->dict_ofs,
+    };
+    const zip_checkpoint_header_t hdr = {
+        .magic = ZIP_CHECKPOINT_MAGIC,
+        .key = stream->ck_key,
+        .count = (uint32_t)stream->ck_count + 1,
+    };
+    const long at = (long)sizeof(hdr) + (long)stream->ck_count * ZIP_CHECKPOINT_RECORD_SIZE;
+    FILE *f = stream->ck_file;
+    const bool ok = fseek(f, at, SEEK_SET) == 0 && fwrite(&ck, sizeof(ck), 1, f) == 1 &&
+                    fwrite(&z->decomp, sizeof(z->decomp), 1, f) == 1 &&
+                    fwrite(z->dict, TINFL_LZ_DICT_SIZE, 1, f) == 1 &&
+                    fseek(f, 0, SEEK_SET) == 0 && fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+                    fflush(f) == 0;
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write checkpoint, checkpoints disabled");
+        stream->ck_disabled = true;
+        return;
+    }
+    stream->checkpoints[stream->ck_count++] = ck;
+}
+
+static void stream_rewind(epub_zip_stream_t *stream) {
+    inflater_reset(stream->inflater, stream->file, stream->data_start,
+                   stream->info.compressed_size, stream->info.uncompressed_size);
+    stream->position = 0;
+    stream->pending_len = 0;
+}
+
+static bool checkpoint_restore(epub_zip_stream_t *stream, int index) {
+    const zip_checkpoint_t *ck = &stream->checkpoints[index];
+    zip_inflater_t *z = stream->inflater;
+    const long at = (long)sizeof(zip_checkpoint_header_t) + (long)index * ZIP_CHECKPOINT_RECORD_SIZE +
+                    (long)sizeof(zip_checkpoint_t);
+    if (fseek(stream->ck_file, at, SEEK_SET) != 0 ||
+        fread(&z->decomp, sizeof(z->decomp), 1, stream->ck_file) != 1 ||
+        fread(z->dict, TINFL_LZ_DICT_SIZE, 1, stream->ck_file) != 1) {
+        ESP_LOGW(TAG, "Failed to read checkpoint %d, inflating from start", index);
+        stream->ck_count = index;
+        stream_rewind(stream);
+        return false;
+    }
+
+    z->in_read = ck->in_offset;
+    z->in_pos = 0;
+    z->in_avail = 0;
+    z->dict_ofs = ck->dict_ofs;
+    z->out_total = ck->out_total;
+    z->done = false;
+    stream->position = ck->out_total;
+    stream->pending_len = 0;
+    return true;
+}
+
+// 解压下一段到 pending，返回 false 表示已结束或出错
+static bool stream_fill(epub_zip_stream_t *stream, bool *failed) {
+    const int r = inflater_step(stream->inflater, &stream->pending, &stream->pending_len);
+    if (r < 0) {
+        ESP_LOGE(TAG, "Failed to inflate %s", stream->info.filename);
+        *failed = true;
+        return false;
+    }
+    if (r > 0) {
+        checkpoint_save(stream);
+    }
+    return r > 0;
+}
+
+// 打开已定位到数据起点的条目；path 只用于检查点文件的键
+static epub_zip_stream_t *stream_create(FILE *file, const char *path,
+                                        const epub_zip_file_info_t *file_info, uint32_t data_start) {
+    epub_zip_stream_t *stream = calloc(1, sizeof(epub_zip_stream_t));
+    if (!stream) {
+        ESP_LOGE(TAG, "Failed to allocate stream");
+        return NULL;
+    }
+    stream->file = file;
+    stream->info = *file_info;
+    stream->data_start = data_start;
+
+    if (file_info->compression_method == ZIP_METHOD_DEFLATE) {
+        stream->inflater = heap_stats_malloc(HEAP_TAG_EPUB, sizeof(zip_inflater_t));
+        if (!stream->inflater) {
+            ESP_LOGE(TAG, "Failed to allocate inflate state (%u bytes)",
+                     (unsigned)sizeof(zip_inflater_t));
+            free(stream);
+            return NULL;
+        }
+        stream_rewind(stream);
+
+        // 小文件解压一遍很快，不需要检查点；大文件拉长间隔，让检查点覆盖全文
+        stream->ck_disabled = file_info->uncompressed_size <= 2 * ZIP_CHECKPOINT_INTERVAL;
+        stream->ck_interval = ZIP_CHECKPOINT_INTERVAL;
+        while ((uint64_t)stream->ck_interval * ZIP_CHECKPOINT_MAX < file_info->uncompressed_size) {
+            stream->ck_interval *= 2;
+        }
+        if (!stream->ck_disabled) {
+            stream->ck_key = checkpoint_key(stream, path);
+            snprintf(stream->ck_path, sizeof(stream->ck_path), "%s/%08x.ick", PAGE_INDEX_DIR,
+                     (unsigned)stream->ck_key);
+            checkpoints_load(stream);
+        }
+    }
+
+    return stream;
+}
+
+epub_zip_stream_t* epub_zip_stream_open(epub_zip_t *zip, const epub_zip_file_info_t *file_info) {
+    if (!zip || !file_info) {
+        return NULL;
+    }
+    if (file_info->compression_method != ZIP_METHOD_STORED &&
+        file_info->compression_method != ZIP_METHOD_DEFLATE) {
+        ESP_LOGE(TAG, "Unsupported compression method: %u", file_info->compression_method);
+        return NULL;
+    }
+
+    uint32_t data_start;
+    if (!seek_file_data(zip, file_info, &data_start)) {
+        return NULL;
+    }
+    return stream_create(zip->file, zip->path, file_info, data_start);
+}
+
+epub_zip_stream_t* epub_zip_stream_open_deflate(FILE *file, const char *path, uint32_t data_start,
+                                                uint32_t compressed_size,
+                                                uint32_t uncompressed_size) {
+    if (!file || !path) {
+        return NULL;
+    }
+    epub_zip_file_info_t info = {
+        .offset = data_start,
+        .compressed_size = compressed_size,
+        .uncompressed_size = uncompressed_size,
+        .compression_method = ZIP_METHOD_DEFLATE,
+    };
+    const char *name = strrchr(path, '/');
+    strncpy(info.filename, name ? name + 1 : path, sizeof(info.filename) - 1);
+    return stream_create(file, path, &info, data_start);
+}
+
+int epub_zip_stream_read(epub_zip_stream_t *stream, void *buffer, size_t size) {
+    if (!stream || !buffer) {
         return -1;
     }
 
-    ESP_LOGE(TAG, "Unsupported compression method: %u", local_header.compression);
-    return -1;
+    if (!stream->inflater) {
+        const uint32_t left = stream->info.uncompressed_size - stream->position;
+        const size_t want = size < left ? size : left;
+        if (want == 0) {
+            return 0;
+        }
+        if (fseek(stream->file, stream->data_start + stream->position, SEEK_SET) != 0) {
+            return -1;
+        }
+        spi_arbiter_sd_begin();
+        const size_t n = fread(buffer, 1, want, stream->file);
+        spi_arbiter_sd_end();
+        stream->position += n;
+        return n > 0 ? (int)n : -1;
+    }
+
+    uint8_t *out = (uint8_t *)buffer;
+    size_t copied = 0;
+    bool failed = false;
+    while (copied < size) {
+        if (stream->pending_len == 0 && !stream_fill(stream, &failed)) {
+            break;
+        }
+        const size_t n = size - copied < stream->pending_len ? size - copied : stream->pending_len;
+        memcpy(out + copied, stream->pending, n);
+        stream->pending += n;
+        stream->pending_len -= n;
+        stream->position += n;
+        copied += n;
+    }
+    return failed && copied == 0 ? -1 : (int)copied;
 }
 
-int epub_zip_get_file_count(epub_zip_t *zip) {
-    return zip ? zip->file_count : 0;
+bool epub_zip_stream_seek(epub_zip_stream_t *stream, uint32_t offset) {
+    if (!stream || offset > stream->info.uncompressed_size) {
+        return false;
+    }
+    if (!stream->inflater) {
+        stream->position = offset;
+        return true;
+    }
+
+    // 不超过目标的最近检查点
+    int best = -1;
+    for (int i = 0; i < stream->ck_count; i++) {
+        if (stream->checkpoints[i].out_total <= offset) {
+            best = i;
+        }
+    }
+    const uint32_t from = best >= 0 ? stream->checkpoints[best].out_total : 0;
+
+    // 向后跳，或前方有更近的检查点时才重置解码器；否则从当前位置继续向前解压。
+    // 第一次向后跳转之后才开始保存检查点，这次重新解压经过的位置就会留下检查点
+    if (offset < stream->position) {
+        stream->ck_armed = true;
+    }
+    if (offset < stream->position || from > stream->position) {
+        if (best < 0 || !checkpoint_restore(stream, best)) {
+            stream_rewind(stream);
+        }
+    }
+
+    bool failed = false;
+    while (stream->position < offset) {
+        if (stream->pending_len == 0 && !stream_fill(stream, &failed)) {
+            return false;
+        }
+        const uint32_t gap = offset - stream->position;
+        const size_t n = gap < stream->pending_len ? gap : stream->pending_len;
+        stream->pending += n;
+        stream->pending_len -= n;
+        stream->position += n;
+    }
+    return true;
+}
+
+uint32_t epub_zip_stream_tell(const epub_zip_stream_t *stream) {
+    return stream ? stream->position : 0;
+}
+
+void epub_zip_stream_close(epub_zip_stream_t *stream) {
+    if (!stream) {
+        return;
+    }
+    if (stream->ck_file) {
+        fclose(stream->ck_file);
+    }
+    heap_stats_free(HEAP_TAG_EPUB, stream->inflater);
+    free(stream);
 }
@@ -20,6 +20,9 @@ extern "C" {
 // EPUB ZIP 文件句柄
 typedef struct epub_zip epub_zip_t;
 
+// ZIP 内单个文件的流式读取句柄
+typedef struct epub_zip_stream epub_zip_stream_t;
+
 // ZIP 内文件信息
 typedef struct {
     char filename[256];    // 文件名（在 ZIP 内的路径）
@@ -30,7 +33,38 @@ typedef struct {
 } epub_zip_file_info_t;
 
 /**
- * @brief 打开 EPUB 文件（ZIP 格式）
+ * @brief 解压输出回调
+ *
+ * 数据指向内部 32KB 字典窗口，回调返回后即被覆盖，需要时自行复制
+ *
+ * @param data 本次输出的数据
+ * @param len 数据长度
+ * @param user 调用方传入的参数
+ * @return true 继续解压，false 提前结束
+ */
+typedef bool (*epub_zip_output_cb_t)(const void *data, size_t len, void *user);
+
+// EPUB 容器快速检查的结果
+typedef enum {
+    EPUB_ZIP_PROBE_INVALID = 0,  // 打不开、不是 ZIP 或找不到结束记录
+    EPUB_ZIP_PROBE_ZIP,          // ZIP 完整，但第一个条目不是存储的 mimetype（不规范，仍可打开）
+    EPUB_ZIP_PROBE_EPUB,         // 规范的 EPUB 容器
+} epub_zip_probe_t;
+
+/**
+ * @brief 快速检查 EPUB 容器，不读中心目录
+ *
+ * 一次打开文件，校验偏移 30 处存储的 mimetype 条目与末尾的结束记录。结果按路径、
+ * 大小与修改时间缓存在内存中（epub_zip_open 也会记录），文件未变时不再打开。
+ * 只能在同一任务中调用（与阅读器一样在 LVGL 任务中）
+ *
+ * @param epub_path EPUB 文件路径
+ * @return 检查结果
+ */
+epub_zip_probe_t epub_zip_probe(const char *epub_path);
+
+/**
+ * @brief 打开 EPUB 文件（ZIP 格式），同时完成 epub_zip_probe 的检查
  * @param epub_path EPUB 文件路径
  * @return ZIP 句柄，失败返回 NULL
  */
@@ -64,6 +98,21 @@ int epub_zip_list_files(epub_zip_t *zip, const char *pattern,
 int epub_zip_extract_file(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
                           void *buffer, size_t buffer_size);
 
+/**
+ * @brief 流式解压单个文件，分段交给回调处理
+ *
+ * 支持存储 (0) 与 deflate (8)；deflate 使用 ROM 中的 tinfl 与固定 32KB 字典窗口，
+ * 内存占用与文件解压大小无关
+ *
+ * @param zip ZIP 句柄
+ * @param file_info 文件信息
+ * @param output 输出回调
+ * @param user 传给回调的参数
+ * @return 已交给回调的字节数（回调提前结束时为截至当时的字节数），失败返回 -1
+ */
+int epub_zip_extract_to_callback(epub_zip_t *zip, const epub_zip_file_info_t *file_info,
+                                 epub_zip_output_cb_t output, void *user);
+
 /**
  * @brief 查找特定文件
  * @param zip ZIP 句柄
@@ -74,6 +123,66 @@ int epub_zip_extract_file(epub_zip_t *zip, const epub_zip_file_info_t *file_info
 bool epub_zip_find_file(epub_zip_t *zip, const char *filename,
                         epub_zip_file_info_t *file_info);
 
+/**
+ * @brief 打开 ZIP 内的文件用于按需读取
+ *
+ * deflate 文件出现过向后跳转后，每解压约 128KB 在 /sdcard/.x4cache/<hash>.ick 保存一次
+ * 检查点（解码器状态 + 字典），之后再向后跳转或重新打开同一章节时从最近的检查点继续，
+ * 不必从头解压；只顺序读一遍的条目不写检查点。句柄使用 zip 的文件句柄，须在 epub_zip_close 之前关闭
+ *
+ * @param zip ZIP 句柄
+ * @param file_info 文件信息
+ * @return 流句柄，失败返回 NULL（解压期间约占用 45KB 堆内存）
+ */
+epub_zip_stream_t* epub_zip_stream_open(epub_zip_t *zip, const epub_zip_file_info_t *file_info);
+
+/**
+ * @brief 把普通文件中的一段原始 deflate 数据（如 gzip 的压缩体）当作流打开
+ *
+ * 与 epub_zip_stream_open 共用解压器与检查点；检查点的键由路径、修改时间与三个参数决定。
+ * 解压很大的数据时检查点间隔按需加倍，保证检查点覆盖全文
+ *
+ * @param file 已打开的文件，由调用方在关闭流之后关闭
+ * @param path 文件路径（只用于检查点的键）
+ * @param data_start 压缩数据在文件中的偏移
+ * @param compressed_size 压缩数据长度
+ * @param uncompressed_size 解压后的长度
+ * @return 流句柄，失败返回 NULL
+ */
+epub_zip_stream_t* epub_zip_stream_open_deflate(FILE *file, const char *path, uint32_t data_start,
+                                                uint32_t compressed_size,
+                                                uint32_t uncompressed_size);
+
+/**
+ * @brief 从当前位置读取解压后的数据
+ * @param stream 流句柄
+ * @param buffer 输出缓冲区
+ * @param size 最多读取的字节数
+ * @return 实际读取的字节数，0 表示已到文件末尾，失败返回 -1
+ */
+int epub_zip_stream_read(epub_zip_stream_t *stream, void *buffer, size_t size);
+
+/**
+ * @brief 跳转到解压后数据中的偏移
+ * @param stream 流句柄
+ * @param offset 目标偏移（不超过解压大小）
+ * @return true 成功，false 失败
+ */
+bool epub_zip_stream_seek(epub_zip_stream_t *stream, uint32_t offset);
+
+/**
+ * @brief 获取当前读取位置（解压后数据中的偏移）
+ * @param stream 流句柄
+ * @return 当前偏移
+ */
+uint32_t epub_zip_stream_tell(const epub_zip_stream_t *stream);
+
+/**
+ * @brief 关闭流
+ * @param stream 流句柄
+ */
+void epub_zip_stream_close(epub_zip_stream_t *stream);
+
 /**
  * @brief 获取中心目录中的文件数量
  * @param zip ZIP 句柄
@@ -81,6 +190,16 @@ bool epub_zip_find_file(epub_zip_t *zip, const char *filename,
  */
 int epub_zip_get_file_count(epub_zip_t *zip);
 
+/**
+ * @brief 按中心目录顺序取第 index 个文件的信息（与 epub_zip_get_file_count 配合遍历，
+ *        调用方只需记住下标，不必为每个文件保存一份 epub_zip_file_info_t）
+ * @param zip ZIP 句柄
+ * @param index 0 .. epub_zip_get_file_count() - 1
+ * @param file_info 输出文件信息
+ * @return 下标越界时为 false
+ */
+bool epub_zip_get_file_info(epub_zip_t *zip, int index, epub_zip_file_info_t *file_info);
+
 #ifdef __cplusplus
 }
 #endif
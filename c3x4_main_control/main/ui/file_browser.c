@@ -5,15 +5,18 @@
 
 #include "file_browser.h"
 #include "../lvgl_driver.h"
+#include "../mem_pressure.h"
 #include "esp_log.h"
 #include "font_manager.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "screen_manager.h"
 #include "reader_screen.h"
 #include "image_browser.h"
+#include "library_db.h"
+#include <ctype.h>
 #include <dirent.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 #include <sys/stat.h>
@@ -21,24 +24,47 @@
 static const char *TAG = "FILE_BROWSER";
 
 #define SDCARD_MOUNT_POINT "/sdcard"
-#define MAX_FILES 100
 #define MAX_PATH_LEN 256
+#define FB_MAX_ENTRIES 2000      // 一个目录最多列出的条目数
+#define FB_SCAN_FIRST_BATCH 64   // 打开目录时同步读取的条目数，其余在后台读取
+#define FB_SCAN_BATCH 16         // 后台每批读取的条目数（按时间片重复）
+#define FB_SCAN_PERIOD_MS 50
+#define FB_SCAN_SLICE_MS 15
+#define FB_VISIBLE_ROWS 15   // 列表一页的行数：只创建这么多个行对象，翻页时复用
+#define FB_ROW_HEIGHT 40
+#define FB_DIR_CACHE_SLOTS 4           // 缓存最近离开的几个目录的列表
+#define FB_DIR_CACHE_BYTES (32 * 1024)  // 缓存的名字池与条目总大小上限
+
+// 目录项：名字在 names 池中的偏移（池扩容后偏移不变）
+typedef struct {
+  uint32_t name;
+  bool is_dir;
+} fb_entry_t;
 
 // 文件浏览器状态
 typedef struct {
   char current_path[MAX_PATH_LEN];
-  char file_names[MAX_FILES][64];
-  bool is_directory[MAX_FILES];
+  char *names;          // 名字池，NUL 分隔
+  size_t names_len;
+  size_t names_cap;
+  fb_entry_t *entries;  // 排序后：目录在前，文件在后
+  int entry_cap;
   int file_count;
-  int selected_index;
+  bool listed;          // 列表已完整读完（只有完整的列表才放进目录缓存）
+  time_t dir_mtime;     // 读取时目录的修改时间
+  uint32_t generation;  // 读取时的缓存代数
+  DIR *scan_dir;        // 大目录在后台继续读取时保持打开
+  lv_timer_t *scan_timer;
+  int selected_index;  // 选中的列表项（非根目录时 0 为 ".."）
+  int window_first;    // 当前页第一行对应的列表项
   lv_obj_t *file_list;
   lv_obj_t *path_label;
 
   lv_indev_t *indev;
   lv_group_t *group;
-  lv_obj_t *row_btns[MAX_FILES + 1];
-  int row_btn_to_index[MAX_FILES + 1];
-  int row_btn_count;
+  lv_obj_t *rows[FB_VISIBLE_ROWS];
+  bool focus_sync;  // 正在把焦点放回选中行，忽略由此产生的 FOCUSED 事件
+  bool key_skipping;  // 按住选择键：只移动选中项，路径栏显示位置，松开后重填各行
 
   // 避免在事件回调中直接 lv_obj_clean()/重建
   // UI（会删除正在处理事件的对象，导致崩溃）
@@ -54,13 +80,51 @@ typedef struct {
 
 static file_browser_state_t fb_state = {0};
 
+// 最近离开的目录：列表（名字池与条目）连同选中项整体从 fb_state 移入，回到该目录时
+// 再移回，不重新 readdir。键为路径与目录修改时间；FAT 在目录中增删文件时不一定更新
+// 目录时间，所以卡上内容被改动时（挂载、蓝牙上传）调用 file_browser_invalidate_cache()
+// 使全部缓存失效。不随屏幕销毁，返回浏览器时同样可用
+typedef struct {
+  char path[MAX_PATH_LEN];  // 空串表示空槽
+  time_t mtime;
+  uint32_t generation;
+  uint32_t last_use;
+  char *names;
+  size_t names_len;
+  fb_entry_t *entries;
+  int file_count;
+  int selected_index;
+  int window_first;
+} fb_dir_cache_t;
+
+static fb_dir_cache_t s_dir_cache[FB_DIR_CACHE_SLOTS];
+static uint32_t s_dir_cache_clock;
+// 由上传任务等其他任务递增，浏览器在 LVGL 任务中比较后丢弃旧缓存（32 位读写在 C3 上是原子的）
+static volatile uint32_t s_dir_cache_generation;
+
 // 前置声明
 static bool read_directory(const char *path);
 static void update_file_list_display(void);
+static void update_path_label(bool show_position);
 static void file_browser_row_key_event_cb(lv_event_t *e);
 static void file_browser_row_focused_cb(lv_event_t *e);
 static void file_browser_screen_destroy_cb(lv_event_t *e);
 static void file_browser_process_pending_action_cb(void *user_data);
+static void stop_scan(void);
+
+static const char *entry_name(int index) {
+  return fb_state.names + fb_state.entries[index].name;
+}
+
+static bool entry_is_dir(int index) {
+  return fb_state.entries[index].is_dir;
+}
+
+// 离开浏览器（阅读器等建在本屏幕之上，本屏幕不一定销毁）：停止后台读目录与书库扫描
+static void stop_background_work(void) {
+  stop_scan();
+  library_db_close();
+}
 
 static void set_row_selected(lv_obj_t *btn, bool selected) {
   if (btn == NULL) {
@@ -108,8 +172,7 @@ static void file_browser_process_pending_action_cb(void *user_data) {
 
   if (action == FB_ACTION_EXIT) {
     ESP_LOGI(TAG, "Exiting file browser, returning to previous screen");
-    // 退出使用快速刷新
-    lvgl_set_refresh_mode(EPD_REFRESH_FAST);
+    stop_background_work();
     // 使用导航历史栈返回上一页
     screen_manager_go_back();
     return;
@@ -117,18 +180,19 @@ static void file_browser_process_pending_action_cb(void *user_data) {
 
   if (action == FB_ACTION_GO_UP) {
     if (strcmp(fb_state.current_path, SDCARD_MOUNT_POINT) != 0) {
-      char *last_slash = strrchr(fb_state.current_path, '/');
-      if (last_slash != NULL && last_slash != fb_state.current_path) {
+      // 在副本上截断：read_directory 按 current_path 把当前列表放进缓存
+      char parent_path[MAX_PATH_LEN];
+      strcpy(parent_path, fb_state.current_path);
+      char *last_slash = strrchr(parent_path, '/');
+      if (last_slash != NULL && last_slash != parent_path) {
         *last_slash = '\0';
-        if (strlen(fb_state.current_path) == 0) {
-          strcpy(fb_state.current_path, SDCARD_MOUNT_POINT);
+        if (strlen(parent_path) == 0) {
+          strcpy(parent_path, SDCARD_MOUNT_POINT);
         }
-        if (read_directory(fb_state.current_path)) {
-          // 组件内操作：目录导航使用快速刷新
-          lvgl_set_refresh_mode(EPD_REFRESH_FAST);
+        if (read_directory(parent_path)) {
+          // 组件内操作：换目录按内容更换刷新
           update_file_list_display();
-          lvgl_trigger_render(NULL);
-          lvgl_display_refresh();
+          screen_manager_refresh(SCREEN_REFRESH_CONTENT);
         }
       }
     }
@@ -141,13 +205,15 @@ static void file_browser_process_pending_action_cb(void *user_data) {
     }
 
     // 如果是文件，检查是否是电子书或图片格式
-    if (!fb_state.is_directory[idx]) {
-      const char *filename = fb_state.file_names[idx];
+    if (!entry_is_dir(idx)) {
+      const char *filename = entry_name(idx);
       const char *ext = strrchr(filename, '.');
 
       if (ext != NULL) {
         // 电子书格式
-        if (strcasecmp(ext, ".txt") == 0 || strcasecmp(ext, ".epub") == 0) {
+        if (strcasecmp(ext, ".txt") == 0 || strcasecmp(ext, ".gz") == 0 ||
+            strcasecmp(ext, ".epub") == 0 || strcasecmp(ext, ".x4pg") == 0 ||
+            strcasecmp(ext, ".cbz") == 0) {
           char full_path[MAX_PATH_LEN];
           int full_path_len =
               snprintf(full_path, MAX_PATH_LEN - 1, "%s/%s", fb_state.current_path, filename);
@@ -155,8 +221,7 @@ static void file_browser_process_pending_action_cb(void *user_data) {
             full_path[MAX_PATH_LEN - 1] = '\0';
           }
           ESP_LOGI(TAG, "Opening book: %s", full_path);
-          // 进入新页面使用快速刷新
-          lvgl_set_refresh_mode(EPD_REFRESH_FAST);
+          stop_background_work();
           screen_manager_show_reader(full_path);
           return;
         }
@@ -173,9 +238,6 @@ static void file_browser_process_pending_action_cb(void *user_data) {
           }
           ESP_LOGI(TAG, "Opening image: %s", full_path);
 
-          // 进入新页面使用快速刷新
-          lvgl_set_refresh_mode(EPD_REFRESH_FAST);
-
           // 获取目录路径（去掉文件名）
           char dir_path[MAX_PATH_LEN];
           strncpy(dir_path, full_path, sizeof(dir_path) - 1);
@@ -186,6 +248,7 @@ static void file_browser_process_pending_action_cb(void *user_data) {
           }
 
           // 调用 screen_manager 显示图片浏览器
+          stop_background_work();
           screen_manager_show_image_browser(dir_path);
           return;
         }
@@ -198,320 +261,624 @@ static void file_browser_process_pending_action_cb(void *user_data) {
     char new_path[MAX_PATH_LEN];
     int new_path_len =
         snprintf(new_path, MAX_PATH_LEN - 1, "%s/%s", fb_state.current_path,
-                 fb_state.file_names[idx]);
+                 entry_name(idx));
     if (new_path_len >= MAX_PATH_LEN - 1) {
       new_path[MAX_PATH_LEN - 1] = '\0';
     }
 
     if (read_directory(new_path)) {
-      // 组件内操作：目录导航使用快速刷新
-      lvgl_set_refresh_mode(EPD_REFRESH_FAST);
+      // 组件内操作：换目录按内容更换刷新
       update_file_list_display();
-      lvgl_trigger_render(NULL);
-      lvgl_display_refresh();
+      screen_manager_refresh(SCREEN_REFRESH_CONTENT);
     }
     return;
   }
 }
 
-// 读取目录内容
-static bool read_directory(const char *path) {
-  ESP_LOGI(TAG, "Reading directory: %s", path);
-
-  // 重置状态
-  fb_state.file_count = 0;
-  fb_state.selected_index = 0;
-
-  // 保存当前路径
-  strncpy(fb_state.current_path, path, MAX_PATH_LEN - 1);
-  fb_state.current_path[MAX_PATH_LEN - 1] = '\0';
+// 已入库的书显示书名与作者（只读数据库中的一条记录，不打开书），其余显示文件名
+static const char *entry_display_name(int index, char *buf, size_t size) {
+  const char *name = entry_name(index);
+  const char *ext = strrchr(name, '.');
+  if (entry_is_dir(index) || ext == NULL ||
+      (strcasecmp(ext, ".epub") != 0 && strcasecmp(ext, ".txt") != 0 &&
+       strcasecmp(ext, ".gz") != 0)) {
+    return name;
+  }
 
-  // 打开目录
-  DIR *dir = opendir(path);
-  if (dir == NULL) {
-    ESP_LOGE(TAG, "Failed to open directory: %s", path);
-    return false;
+  char full_path[MAX_PATH_LEN];
+  snprintf(full_path, sizeof(full_path), "%s/%s", fb_state.current_path, name);
+  library_book_t book;
+  const int slot = library_db_find(full_path);
+  if (slot < 0 || !library_db_get(slot, &book) || strcmp(book.path, full_path) != 0) {
+    return name;
+  }
+  if (book.author[0] != '\0') {
+    snprintf(buf, size, "%s - %s", book.title, book.author);
+  } else {
+    snprintf(buf, size, "%s", book.title);
   }
+  return buf;
+}
 
-  struct dirent *entry;
-  int dir_count = 0;
-  int file_count = 0;
+// 列表项：非根目录时第 0 项为 ".."，其后是 entries 中的目录与文件
+static bool has_parent_entry(void) {
+  return strcmp(fb_state.current_path, SDCARD_MOUNT_POINT) != 0;
+}
 
-  // 先读取所有条目
-  while ((entry = readdir(dir)) != NULL && fb_state.file_count < MAX_FILES) {
-    const char *name = entry->d_name;
+static int entry_count(void) {
+  return fb_state.file_count + (has_parent_entry() ? 1 : 0);
+}
 
-    // 跳过 "." 和 ".."
-    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-      continue;
-    }
+// 列表项对应的 entries 序号，-1 表示 ".."
+static int entry_file_index(int entry) {
+  return entry - (has_parent_entry() ? 1 : 0);
+}
 
-    // 构建完整路径
-    char full_path[MAX_PATH_LEN];
-    int len = snprintf(full_path, MAX_PATH_LEN - 1, "%s/%s", path, name);
-    if (len >= MAX_PATH_LEN - 1) {
-      ESP_LOGW(TAG, "Path truncated: %s/%s", path, name);
-      full_path[MAX_PATH_LEN - 1] = '\0';
+// 按当前页把第 row 行填成对应的列表项；超出列表的行留空但保留在 group 中，
+// 保证 NEXT/PREV 总能把焦点移到另一行，由 FOCUSED 事件驱动选中项移动
+static void render_row(int row) {
+  lv_obj_t *btn = fb_state.rows[row];
+  lv_obj_t *icon_img = lv_obj_get_child(btn, 0);  // lv_list 的图标是符号图片
+  lv_obj_t *text_lbl = lv_obj_get_child(btn, 1);
+  const int entry = fb_state.window_first + row;
+
+  const char *icon = NULL;
+  const char *text = "";
+  char display_name[192];
+  if (entry < entry_count()) {
+    const int file = entry_file_index(entry);
+    if (file < 0) {
+      icon = LV_SYMBOL_LEFT;
+      text = "..";
+    } else {
+      icon = entry_is_dir(file) ? LV_SYMBOL_DIRECTORY : LV_SYMBOL_FILE;
+      text = entry_display_name(file, display_name, sizeof(display_name));
     }
-
-    // 检查是否是目录
-    struct stat st;
-    if (stat(full_path, &st) == 0) {
-      bool is_dir = S_ISDIR(st.st_mode);
-
-      // 目录排在前面，文件排在后面
-      if (is_dir) {
-        // 将目录插入到目录组的末尾
-        for (int i = fb_state.file_count; i > dir_count; i--) {
-          strncpy(fb_state.file_names[i], fb_state.file_names[i - 1], 63);
-          fb_state.file_names[i][63] = '\0';
-          fb_state.is_directory[i] = fb_state.is_directory[i - 1];
-        }
-        strncpy(fb_state.file_names[dir_count], name, 63);
-        fb_state.file_names[dir_count][63] = '\0';
-        fb_state.is_directory[dir_count] = true;
-        dir_count++;
-        fb_state.file_count++;
-      } else {
-        // 文件添加到末尾
-        strncpy(fb_state.file_names[fb_state.file_count], name, 63);
-        fb_state.file_names[fb_state.file_count][63] = '\0';
-        fb_state.is_directory[fb_state.file_count] = false;
-        file_count++;
-        fb_state.file_count++;
-      }
+  }
+  if (icon_img) {
+    if (icon != NULL) {
+      lv_image_set_src(icon_img, icon);
+      lv_obj_clear_flag(icon_img, LV_OBJ_FLAG_HIDDEN);
+    } else {
+      lv_obj_add_flag(icon_img, LV_OBJ_FLAG_HIDDEN);
     }
   }
+  if (text_lbl)
+    lv_label_set_text(text_lbl, text);
+  set_row_selected(btn, entry == fb_state.selected_index);
+}
 
-  closedir(dir);
-
-  ESP_LOGI(TAG, "Found %d files (%d directories, %d files) in %s",
-           fb_state.file_count, dir_count, file_count, path);
+static void render_rows(void) {
+  for (int i = 0; i < FB_VISIBLE_ROWS; i++) {
+    render_row(i);
+  }
+}
 
-  return true;
+// 焦点跟随选中行（异步执行：不在 FOCUSED 事件中再次移动焦点）
+static void file_browser_sync_focus_cb(void *user_data) {
+  (void)user_data;
+  const int row = fb_state.selected_index - fb_state.window_first;
+  if (fb_state.group == NULL || row < 0 || row >= FB_VISIBLE_ROWS) {
+    return;
+  }
+  fb_state.focus_sync = true;
+  lv_group_focus_obj(fb_state.rows[row]);
+  fb_state.focus_sync = false;
 }
 
-// 更新文件列表显示
-static void update_file_list_display(void) {
-  if (fb_state.file_list == NULL) {
+// 移动选中项：跨页时重填所有行，同页内只改两行的样式
+static void select_entry(int entry, bool wrap) {
+  const int count = entry_count();
+  if (count == 0) {
     return;
   }
+  if (entry < 0) {
+    entry = wrap ? count - 1 : 0;
+  } else if (entry >= count) {
+    entry = wrap ? 0 : count - 1;
+  }
 
-  // 重建 group，确保 group 内对象指针不悬挂（list 子项会被清空重建）
-  if (fb_state.indev != NULL) {
-    if (fb_state.group != NULL) {
-      lv_group_del(fb_state.group);
-      fb_state.group = NULL;
+  if (entry != fb_state.selected_index) {
+    const int window_first = entry / FB_VISIBLE_ROWS * FB_VISIBLE_ROWS;
+    const bool paged = window_first != fb_state.window_first;
+    if (paged) {
+      // 翻页换了整屏的行内容
+      fb_state.selected_index = entry;
+      fb_state.window_first = window_first;
+      render_rows();
+      screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+    } else {
+      // 同页内只是焦点移动：只局刷这两行
+      lv_obj_t *from = fb_state.rows[fb_state.selected_index - window_first];
+      lv_obj_t *to = fb_state.rows[entry - window_first];
+      set_row_selected(from, false);
+      set_row_selected(to, true);
+      fb_state.selected_index = entry;
+      screen_manager_refresh_focus(from, to);
     }
-    fb_state.group = lv_group_create();
-    lv_group_set_wrap(fb_state.group, true);
-    lv_indev_set_group(fb_state.indev, fb_state.group);
   }
+  (void)lv_async_call(file_browser_sync_focus_cb, NULL);
+}
 
-  // 不要删除/重建 list：
-  // - 会让 lv_group 里绑定的对象失效，导致按键事件不再投递
-  // - 也容易引入样式/布局的不可预期问题
-  // 这里仅清空子对象并重新填充
-  lv_obj_clean(fb_state.file_list);
+// 长按重复：只改选中项与页窗口，不重填各行；路径栏附上位置，局部刷新这一行。
+// 刷新请求会合并，面板跟不上时只显示最新位置
+static void skip_entry(int entry) {
+  const int count = entry_count();
+  if (count == 0) {
+    return;
+  }
+  if (entry < 0) {
+    entry = 0;
+  } else if (entry >= count) {
+    entry = count - 1;
+  }
+  if (entry == fb_state.selected_index && fb_state.key_skipping) {
+    return;
+  }
+  fb_state.key_skipping = true;
+  fb_state.selected_index = entry;
+  fb_state.window_first = entry / FB_VISIBLE_ROWS * FB_VISIBLE_ROWS;
+  update_path_label(true);
+  screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+}
 
-  // 设置列表样式
-  lv_obj_set_style_bg_color(fb_state.file_list, lv_color_white(), 0);
-  lv_obj_set_style_bg_opa(fb_state.file_list, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(fb_state.file_list, 1, 0);
-  lv_obj_set_style_border_color(fb_state.file_list, lv_color_black(), 0);
-  // 关键：显式设置列表项文字颜色，避免主题/默认样式导致“白底白字看不见”
-  lv_obj_set_style_text_color(fb_state.file_list, lv_color_black(),
-                              LV_PART_ITEMS);
+// 松开选择键：按停下的位置重填各行，恢复路径栏，刷新一次
+static void finish_skip(void) {
+  if (!fb_state.key_skipping) {
+    return;
+  }
+  fb_state.key_skipping = false;
+  render_rows();
+  update_path_label(false);
+  screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+  (void)lv_async_call(file_browser_sync_focus_cb, NULL);
+}
 
-  fb_state.row_btn_count = 0;
-
-  // 添加 ".." 返回上一项（如果不是根目录）
-  if (strcmp(fb_state.current_path, SDCARD_MOUNT_POINT) != 0) {
-    lv_obj_t *btn =
-        lv_list_add_button(fb_state.file_list, LV_SYMBOL_LEFT, "..");
-    // list button 内部包含两个 label（图标/文字），这里显式设置字体和颜色
-    lv_obj_t *icon = lv_obj_get_child(btn, 0);
-    lv_obj_t *txt = lv_obj_get_child(btn, 1);
-    if (icon) {
-      lv_obj_set_style_text_font(icon, &lv_font_montserrat_14, 0);
-      lv_obj_set_style_text_color(icon, lv_color_black(), 0);
-    }
-    if (txt) {
-      lv_obj_set_style_text_font(txt, font_manager_get_font(), 0);
-      lv_obj_set_style_text_color(txt, lv_color_black(), 0);
-    }
-
-    lv_obj_add_event_cb(btn, file_browser_row_key_event_cb, LV_EVENT_KEY,
-                        &fb_state.row_btn_to_index[fb_state.row_btn_count]);
-    lv_obj_add_event_cb(btn, file_browser_row_focused_cb, LV_EVENT_FOCUSED,
-                        &fb_state.row_btn_to_index[fb_state.row_btn_count]);
-    fb_state.row_btns[fb_state.row_btn_count] = btn;
-    fb_state.row_btn_to_index[fb_state.row_btn_count] = -1;
-    fb_state.row_btn_count++;
-    if (fb_state.group) {
-      lv_group_add_obj(fb_state.group, btn);
+// ---------------------------------------------------------------------------
+// 目录扫描：名字放进连续的字符串池，用 readdir 的 d_type 区分目录（FATFS 提供，
+// 不必逐项 stat），读完后一次排序。大目录先读一批立即显示，其余在 LVGL 定时器中
+// 分批读完再整体排序
+// ---------------------------------------------------------------------------
+
+static bool add_entry(const char *name, bool is_dir) {
+  if (fb_state.file_count >= FB_MAX_ENTRIES) {
+    return false;
+  }
+  if (fb_state.file_count >= fb_state.entry_cap) {
+    const int cap = fb_state.entry_cap ? fb_state.entry_cap * 2 : 64;
+    fb_entry_t *grown = realloc(fb_state.entries, cap * sizeof(fb_entry_t));
+    if (grown == NULL) {
+      return false;
+    }
+    fb_state.entries = grown;
+    fb_state.entry_cap = cap;
+  }
+  const size_t len = strlen(name) + 1;
+  if (fb_state.names_len + len > fb_state.names_cap) {
+    size_t cap = fb_state.names_cap ? fb_state.names_cap : 2048;
+    while (cap < fb_state.names_len + len) {
+      cap *= 2;
     }
+    char *grown = realloc(fb_state.names, cap);
+    if (grown == NULL) {
+      return false;
+    }
+    fb_state.names = grown;
+    fb_state.names_cap = cap;
   }
+  memcpy(fb_state.names + fb_state.names_len, name, len);
+  fb_state.entries[fb_state.file_count].name = (uint32_t)fb_state.names_len;
+  fb_state.entries[fb_state.file_count].is_dir = is_dir;
+  fb_state.names_len += len;
+  fb_state.file_count++;
+  return true;
+}
 
-  // 添加文件和目录
-  for (int i = 0; i < fb_state.file_count; i++) {
-    const char *icon =
-        fb_state.is_directory[i] ? LV_SYMBOL_DIRECTORY : LV_SYMBOL_FILE;
-    lv_obj_t *btn =
-        lv_list_add_button(fb_state.file_list, icon, fb_state.file_names[i]);
-    // 默认项：白底黑字（显式设置到子 label，避免继承不生效）
-    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
-    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+// 自然顺序：忽略 ASCII 大小写，连续数字按数值比较（第2章 < 第10章），
+// 其余 UTF-8 字节按码位顺序
+static int compare_names(const char *a, const char *b) {
+  while (*a && *b) {
+    if (isdigit((unsigned char)*a) && isdigit((unsigned char)*b)) {
+      while (*a == '0') a++;
+      while (*b == '0') b++;
+      const char *a_end = a;
+      const char *b_end = b;
+      while (isdigit((unsigned char)*a_end)) a_end++;
+      while (isdigit((unsigned char)*b_end)) b_end++;
+      if (a_end - a != b_end - b) {
+        return (int)((a_end - a) - (b_end - b));
+      }
+      const int c = strncmp(a, b, (size_t)(a_end - a));
+      if (c != 0) {
+        return c;
+      }
+      a = a_end;
+      b = b_end;
+      continue;
+    }
+    const int ca = tolower((unsigned char)*a);
+    const int cb = tolower((unsigned char)*b);
+    if (ca != cb) {
+      return ca - cb;
+    }
+    a++;
+    b++;
+  }
+  return (unsigned char)*a - (unsigned char)*b;
+}
 
-    lv_obj_t *icon_lbl = lv_obj_get_child(btn, 0);
-    lv_obj_t *text_lbl = lv_obj_get_child(btn, 1);
-    if (icon_lbl) {
-      lv_obj_set_style_text_font(icon_lbl, &lv_font_montserrat_14, 0);
-      lv_obj_set_style_text_color(icon_lbl, lv_color_black(), 0);
+// 目录排在前面，同类按名字
+static int compare_entries(const void *x, const void *y) {
+  const fb_entry_t *a = (const fb_entry_t *)x;
+  const fb_entry_t *b = (const fb_entry_t *)y;
+  if (a->is_dir != b->is_dir) {
+    return a->is_dir ? -1 : 1;
+  }
+  const int c = compare_names(fb_state.names + a->name, fb_state.names + b->name);
+  return c != 0 ? c : strcmp(fb_state.names + a->name, fb_state.names + b->name);
+}
+
+static void sort_entries(void) {
+  qsort(fb_state.entries, fb_state.file_count, sizeof(fb_entry_t), compare_entries);
+}
+
+static void stop_scan(void) {
+  if (fb_state.scan_timer != NULL) {
+    lv_timer_delete(fb_state.scan_timer);
+    fb_state.scan_timer = NULL;
+  }
+  if (fb_state.scan_dir != NULL) {
+    closedir(fb_state.scan_dir);
+    fb_state.scan_dir = NULL;
+  }
+}
+
+// 读取最多 limit 项；返回 false 表示目录已读完（或条目已达上限）
+static bool scan_batch(int limit) {
+  struct dirent *entry;
+  for (int n = 0; n < limit; n++) {
+    entry = readdir(fb_state.scan_dir);
+    if (entry == NULL) {
+      return false;
     }
-    if (text_lbl) {
-      // 临时使用内置中文字体来测试中文显示
-      // 注意：这个字体不支持日文字符
-      extern const lv_font_t lv_font_builtin_chinese_16;
-      const lv_font_t *current_font = &lv_font_builtin_chinese_16;
+    const char *name = entry->d_name;
 
-      lv_obj_set_style_text_font(text_lbl, current_font, 0);
-      lv_obj_set_style_text_color(text_lbl, lv_color_black(), 0);
+    // 跳过 "." 和 ".."
+    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+      continue;
+    }
 
-      // 调试：打印文件名和字体信息
-      if (i < 3) {  // 只打印前3个文件
-        ESP_LOGI(TAG, "File [%d]: '%s', font=%p (builtin chinese)", i, fb_state.file_names[i], current_font);
-      }
+    bool is_dir = entry->d_type == DT_DIR;
+    if (entry->d_type == DT_UNKNOWN) {
+      // 文件系统不提供类型时才 stat
+      char full_path[MAX_PATH_LEN];
+      snprintf(full_path, sizeof(full_path), "%s/%s", fb_state.current_path, name);
+      struct stat st;
+      is_dir = stat(full_path, &st) == 0 && S_ISDIR(st.st_mode);
     }
+    if (!add_entry(name, is_dir)) {
+      ESP_LOGW(TAG, "Directory listing truncated at %d entries", fb_state.file_count);
+      return false;
+    }
+  }
+  return true;
+}
 
-    lv_obj_add_event_cb(btn, file_browser_row_key_event_cb, LV_EVENT_KEY,
-                        &fb_state.row_btn_to_index[fb_state.row_btn_count]);
-    lv_obj_add_event_cb(btn, file_browser_row_focused_cb, LV_EVENT_FOCUSED,
-                        &fb_state.row_btn_to_index[fb_state.row_btn_count]);
-    fb_state.row_btns[fb_state.row_btn_count] = btn;
-    fb_state.row_btn_to_index[fb_state.row_btn_count] = i;
-    fb_state.row_btn_count++;
-    if (fb_state.group) {
-      lv_group_add_obj(fb_state.group, btn);
+// 后台读完剩余的目录项后整体重排，选中项按名字保持不变
+static void file_browser_scan_timer_cb(lv_timer_t *timer) {
+  (void)timer;
+  if (lvgl_is_refreshing()) {
+    return;
+  }
+  const uint32_t t0 = lv_tick_get();
+  bool more = true;
+  while (more && lv_tick_elaps(t0) < FB_SCAN_SLICE_MS) {
+    more = scan_batch(FB_SCAN_BATCH);
+  }
+  if (more) {
+    return;
+  }
+
+  const int selected = entry_file_index(fb_state.selected_index);
+  const uint32_t selected_name =
+      (selected >= 0 && selected < fb_state.file_count) ? fb_state.entries[selected].name : UINT32_MAX;
+  stop_scan();
+  sort_entries();
+  fb_state.listed = true;
+  ESP_LOGI(TAG, "Finished reading %s: %d entries", fb_state.current_path, fb_state.file_count);
+
+  for (int i = 0; i < fb_state.file_count; i++) {
+    if (fb_state.entries[i].name == selected_name) {
+      fb_state.selected_index = i + (has_parent_entry() ? 1 : 0);
+      break;
     }
+  }
+  fb_state.window_first = fb_state.selected_index / FB_VISIBLE_ROWS * FB_VISIBLE_ROWS;
+  render_rows();
+  (void)lv_async_call(file_browser_sync_focus_cb, NULL);
+  screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+}
 
-    // 设置选中状态（用于 EPD 上更显著的高亮）
-    if (i == fb_state.selected_index) {
-      set_row_selected(btn, true);
+// ---------------------------------------------------------------------------
+// 目录缓存
+// ---------------------------------------------------------------------------
+
+static void dir_cache_free_slot(fb_dir_cache_t *slot) {
+  free(slot->names);
+  free(slot->entries);
+  memset(slot, 0, sizeof(*slot));
+}
+
+static size_t dir_cache_slot_bytes(const fb_dir_cache_t *slot) {
+  return slot->names_len + (size_t)slot->file_count * sizeof(fb_entry_t);
+}
+
+// 丢弃失效（代数已变）的槽
+static void dir_cache_drop_stale(void) {
+  const uint32_t generation = s_dir_cache_generation;
+  for (int i = 0; i < FB_DIR_CACHE_SLOTS; i++) {
+    if (s_dir_cache[i].path[0] != '\0' && s_dir_cache[i].generation != generation) {
+      dir_cache_free_slot(&s_dir_cache[i]);
     }
   }
+}
 
-  // 更新路径标签
-  if (fb_state.path_label != NULL) {
-    // 显示相对路径（去掉 /sdcard 前缀）
-    const char *display_path = fb_state.current_path;
-    if (strncmp(fb_state.current_path, SDCARD_MOUNT_POINT,
-                strlen(SDCARD_MOUNT_POINT)) == 0) {
-      display_path = fb_state.current_path + strlen(SDCARD_MOUNT_POINT);
-      if (*display_path == '/') {
-        display_path++;
+// 把当前列表移入缓存（缓冲区缩到实际大小）；列表不完整或已失效时只释放
+static void dir_cache_park(void) {
+  dir_cache_drop_stale();
+  const size_t bytes = fb_state.names_len + (size_t)fb_state.file_count * sizeof(fb_entry_t);
+  if (!fb_state.listed || fb_state.generation != s_dir_cache_generation ||
+      fb_state.current_path[0] == '\0' || bytes > FB_DIR_CACHE_BYTES) {
+    free(fb_state.names);
+    free(fb_state.entries);
+  } else {
+    // 同一路径的旧列表直接替换；总量超限时从最久未用的开始淘汰
+    for (int i = 0; i < FB_DIR_CACHE_SLOTS; i++) {
+      if (strcmp(s_dir_cache[i].path, fb_state.current_path) == 0) {
+        dir_cache_free_slot(&s_dir_cache[i]);
+      }
+    }
+    for (;;) {
+      size_t total = bytes;
+      fb_dir_cache_t *oldest = NULL;
+      fb_dir_cache_t *empty = NULL;
+      for (int i = 0; i < FB_DIR_CACHE_SLOTS; i++) {
+        fb_dir_cache_t *slot = &s_dir_cache[i];
+        if (slot->path[0] == '\0') {
+          empty = slot;
+          continue;
+        }
+        total += dir_cache_slot_bytes(slot);
+        if (oldest == NULL || slot->last_use < oldest->last_use) {
+          oldest = slot;
+        }
       }
-      if (*display_path == '\0') {
-        display_path = "/";
+      if (empty != NULL && total <= FB_DIR_CACHE_BYTES) {
+        char *names = realloc(fb_state.names, fb_state.names_len ? fb_state.names_len : 1);
+        fb_entry_t *entries =
+            realloc(fb_state.entries, fb_state.file_count ? fb_state.file_count * sizeof(fb_entry_t) : 1);
+        strcpy(empty->path, fb_state.current_path);
+        empty->mtime = fb_state.dir_mtime;
+        empty->generation = fb_state.generation;
+        empty->last_use = ++s_dir_cache_clock;
+        empty->names = names != NULL ? names : fb_state.names;
+        empty->names_len = fb_state.names_len;
+        empty->entries = entries != NULL ? entries : fb_state.entries;
+        empty->file_count = fb_state.file_count;
+        empty->selected_index = fb_state.selected_index;
+        empty->window_first = fb_state.window_first;
+        break;
       }
+      dir_cache_free_slot(oldest);
     }
+  }
 
-    char path_text[MAX_PATH_LEN + 20];
-    int path_len = snprintf(path_text, sizeof(path_text) - 1, "Path: %.250s",
-                            display_path);
-    if (path_len >= (int)(sizeof(path_text) - 1)) {
-      path_text[sizeof(path_text) - 1] = '\0';
+  fb_state.names = NULL;
+  fb_state.names_len = 0;
+  fb_state.names_cap = 0;
+  fb_state.entries = NULL;
+  fb_state.entry_cap = 0;
+  fb_state.file_count = 0;
+  fb_state.listed = false;
+}
+
+// 命中时把缓存的列表与选中项移回 fb_state（fb_state 此时没有列表）
+static bool dir_cache_take(const char *path, time_t mtime) {
+  for (int i = 0; i < FB_DIR_CACHE_SLOTS; i++) {
+    fb_dir_cache_t *slot = &s_dir_cache[i];
+    if (slot->path[0] == '\0' || strcmp(slot->path, path) != 0) {
+      continue;
     }
-    lv_label_set_text(fb_state.path_label, path_text);
+    if (slot->mtime != mtime) {
+      dir_cache_free_slot(slot);
+      return false;
+    }
+    fb_state.names = slot->names;
+    fb_state.names_len = slot->names_len;
+    fb_state.names_cap = slot->names_len;
+    fb_state.entries = slot->entries;
+    fb_state.entry_cap = slot->file_count;
+    fb_state.file_count = slot->file_count;
+    fb_state.selected_index = slot->selected_index;
+    fb_state.window_first = slot->window_first;
+    fb_state.generation = slot->generation;
+    fb_state.listed = true;
+    slot->names = NULL;
+    slot->entries = NULL;
+    dir_cache_free_slot(slot);
+    return true;
   }
+  return false;
+}
 
-  // 把焦点显式放在当前选中的行（避免 NEXT/PREV 被 group 吞掉但焦点未建立）
-  if (fb_state.group && fb_state.row_btn_count > 0) {
-    lv_obj_t *focus_btn = NULL;
-    for (int j = 0; j < fb_state.row_btn_count; j++) {
-      if (fb_state.row_btn_to_index[j] == fb_state.selected_index) {
-        focus_btn = fb_state.row_btns[j];
-        break;
-      }
+// 内存压力回调：释放全部缓存的目录列表（当前列表在 fb_state 中，不受影响）
+static bool dir_cache_shrink(size_t want, void *arg) {
+  (void)want;
+  (void)arg;
+  bool released = false;
+  for (int i = 0; i < FB_DIR_CACHE_SLOTS; i++) {
+    if (s_dir_cache[i].path[0] != '\0') {
+      dir_cache_free_slot(&s_dir_cache[i]);
+      released = true;
     }
-    if (focus_btn == NULL) {
-      // 如果 selected_index 无效（比如目录变更后），默认聚焦第一项（跳过 ".."）
-      focus_btn = fb_state.row_btns[0];
-      if (fb_state.row_btn_to_index[0] == -1 && fb_state.row_btn_count > 1) {
-        focus_btn = fb_state.row_btns[1];
-      }
+  }
+  return released;
+}
+
+void file_browser_invalidate_cache(void) {
+  s_dir_cache_generation++;
+}
+
+uint32_t file_browser_cache_generation(void) {
+  return s_dir_cache_generation;
+}
+
+// 读取目录内容：最近离开过且未改动的目录直接用缓存（保留选中项）；否则第一批同步
+// 读取并排序，目录更大时其余部分转入后台
+static bool read_directory(const char *path) {
+  ESP_LOGI(TAG, "Reading directory: %s", path);
+  stop_scan();
+
+  // 当前列表连同选中项移入缓存
+  dir_cache_park();
+
+  // 保存当前路径
+  strncpy(fb_state.current_path, path, MAX_PATH_LEN - 1);
+  fb_state.current_path[MAX_PATH_LEN - 1] = '\0';
+
+  // 挂载点本身可能取不到时间，此时只靠显式失效
+  struct stat st;
+  fb_state.dir_mtime = stat(path, &st) == 0 ? st.st_mtime : 0;
+  if (dir_cache_take(fb_state.current_path, fb_state.dir_mtime)) {
+    const int count = entry_count();
+    if (fb_state.selected_index >= count) {
+      fb_state.selected_index = count > 0 ? count - 1 : 0;
     }
-    lv_group_focus_obj(focus_btn);
+    fb_state.window_first = fb_state.selected_index / FB_VISIBLE_ROWS * FB_VISIBLE_ROWS;
+    ESP_LOGI(TAG, "Using cached listing of %s: %d entries", path, fb_state.file_count);
+    return true;
   }
+  fb_state.generation = s_dir_cache_generation;
 
-  // 手动刷新模式：触发渲染
-  for (int i = 0; i < 3; i++) {
-    lvgl_trigger_render(NULL);
+  // 打开目录
+  fb_state.scan_dir = opendir(path);
+  if (fb_state.scan_dir == NULL) {
+    ESP_LOGE(TAG, "Failed to open directory: %s", path);
+    return false;
   }
+
+  const bool more = scan_batch(FB_SCAN_FIRST_BATCH);
+  sort_entries();
+  // 默认选中第一项（跳过 ".."）
+  fb_state.selected_index = (has_parent_entry() && entry_count() > 1) ? 1 : 0;
+  fb_state.window_first = 0;
+  if (more) {
+    fb_state.scan_timer = lv_timer_create(file_browser_scan_timer_cb, FB_SCAN_PERIOD_MS, NULL);
+    ESP_LOGI(TAG, "Showing first %d entries of %s, reading the rest in background",
+             fb_state.file_count, path);
+  }
+  if (!more || fb_state.scan_timer == NULL) {
+    closedir(fb_state.scan_dir);
+    fb_state.scan_dir = NULL;
+    fb_state.listed = !more;
+    ESP_LOGI(TAG, "Found %d entries in %s", fb_state.file_count, path);
+  }
+  return true;
 }
 
-static void file_browser_row_focused_cb(lv_event_t *e) {
-  if (lv_event_get_code(e) != LV_EVENT_FOCUSED) {
+// 路径栏：显示相对路径（去掉 /sdcard 前缀）；show_position 时附上选中项的位置
+static void update_path_label(bool show_position) {
+  if (fb_state.path_label == NULL) {
     return;
   }
+  const char *display_path = fb_state.current_path;
+  if (strncmp(fb_state.current_path, SDCARD_MOUNT_POINT,
+              strlen(SDCARD_MOUNT_POINT)) == 0) {
+    display_path = fb_state.current_path + strlen(SDCARD_MOUNT_POINT);
+    if (*display_path == '/') {
+      display_path++;
+    }
+    if (*display_path == '\0') {
+      display_path = "/";
+    }
+  }
 
-  int *p_idx = (int *)lv_event_get_user_data(e);
-  if (p_idx == NULL) {
-    return;
+  char path_text[MAX_PATH_LEN + 40];
+  if (show_position) {
+    snprintf(path_text, sizeof(path_text), "Path: %.200s  [%d/%d]", display_path,
+             fb_state.selected_index + 1, entry_count());
+  } else {
+    snprintf(path_text, sizeof(path_text), "Path: %.250s", display_path);
   }
+  lv_label_set_text(fb_state.path_label, path_text);
+}
 
-  const int new_idx = *p_idx;
-  if (new_idx == fb_state.selected_index) {
+// 更新文件列表显示（目录变更后调用；行对象与 group 在创建屏幕时建好，这里只重填内容，
+// 渲染与刷新由调用方经 screen_manager_refresh 完成）
+static void update_file_list_display(void) {
+  if (fb_state.file_list == NULL) {
     return;
   }
 
-  // 取消旧高亮
-  for (int i = 0; i < fb_state.row_btn_count; i++) {
-    if (fb_state.row_btn_to_index[i] == fb_state.selected_index) {
-      set_row_selected(fb_state.row_btns[i], false);
-      break;
-    }
-  }
+  // 选中项由 read_directory 设定（新读取时为第一项，缓存命中时为上次离开时的位置）
+  render_rows();
 
-  fb_state.selected_index = new_idx;
+  update_path_label(false);
 
-  // 设置新高亮
-  for (int i = 0; i < fb_state.row_btn_count; i++) {
-    if (fb_state.row_btn_to_index[i] == fb_state.selected_index) {
-      set_row_selected(fb_state.row_btns[i], true);
-      break;
-    }
+  // 把焦点显式放在当前选中的行（避免 NEXT/PREV 被 group 吞掉但焦点未建立）
+  file_browser_sync_focus_cb(NULL);
+}
+
+// NEXT/PREV 由 lv_group 处理（只移动焦点，不下发按键），这里按引起焦点变化的按键
+// 移动选中项；焦点随后被放回选中行
+static void file_browser_row_focused_cb(lv_event_t *e) {
+  if (lv_event_get_code(e) != LV_EVENT_FOCUSED || fb_state.focus_sync) {
+    return;
   }
 
-  // 手动刷新模式：先设置刷新模式，再触发渲染
-  // 重要：必须先设置刷新模式，再触发渲染，否则脏区不会被记录
-  lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-  lvgl_trigger_render(NULL);
-  lvgl_display_refresh();
+  const uint32_t key = lv_indev_get_key(fb_state.indev);
+  if (key == LV_KEY_NEXT) {
+    select_entry(fb_state.selected_index + 1, true);
+  } else if (key == LV_KEY_PREV) {
+    select_entry(fb_state.selected_index - 1, true);
+  } else {
+    (void)lv_async_call(file_browser_sync_focus_cb, NULL);
+  }
 }
 
-// 行按钮按键处理：ENTER / ESC（导航键交给 lv_group）
+// 行按钮按键处理：ENTER / ESC，长按重复的 UP / DOWN 逐项移动，LEFT / RIGHT 翻页
 static void file_browser_row_key_event_cb(lv_event_t *e) {
   if (lv_event_get_code(e) != LV_EVENT_KEY) {
     return;
   }
 
   const uint32_t key = lv_event_get_key(e);
-  int *p_idx = (int *)lv_event_get_user_data(e);
-  const int idx = (p_idx != NULL) ? *p_idx : fb_state.selected_index;
 
   if (key == LV_KEY_ENTER) {
+    if (fb_state.selected_index >= entry_count()) {
+      return;
+    }
+    const int idx = entry_file_index(fb_state.selected_index);
     if (idx == -1) {
       file_browser_schedule_action(FB_ACTION_GO_UP, 0);
     } else {
       file_browser_schedule_action(FB_ACTION_OPEN_DIR, idx);
     }
+  } else if (key == LV_KEY_UP) {
+    select_entry(fb_state.selected_index - 1, false);
+  } else if (key == LV_KEY_DOWN) {
+    select_entry(fb_state.selected_index + 1, false);
+  } else if (key == LV_KEY_LEFT) {
+    select_entry(fb_state.selected_index - FB_VISIBLE_ROWS, false);
+  } else if (key == LV_KEY_RIGHT) {
+    select_entry(fb_state.selected_index + FB_VISIBLE_ROWS, false);
   } else if (key == LV_KEY_ESC) {
     // 检查是否双击返回键
     if (lvgl_is_back_key_double_clicked()) {
       ESP_LOGI(TAG, "Back key double-clicked, returning to index screen");
       lvgl_clear_back_key_double_click();
       // 双击直接返回主页
+      stop_background_work();
       screen_manager_show_index();
     } else {
       // 单击：在子目录返回上级，在根目录返回上一页
@@ -524,6 +891,44 @@ static void file_browser_row_key_event_cb(lv_event_t *e) {
   }
 }
 
+// 快速通道：音量键逐项、左右键整页移动选中项，不经过 group 导航。单击与原来的
+// 按键处理一致（音量键首尾循环）；按住后的重复只跳不绘制，松开时绘制一次
+static bool file_browser_key_hook(button_t btn, lvgl_key_phase_t phase) {
+  if (phase == LVGL_KEY_RELEASE) {
+    finish_skip();
+    return true;
+  }
+  if (fb_state.pending_action != FB_ACTION_NONE || entry_count() == 0) {
+    return false;
+  }
+  int step;
+  bool wrap = phase == LVGL_KEY_PRESS;
+  switch (btn) {
+  case BTN_VOLUME_DOWN:
+    step = 1;
+    break;
+  case BTN_VOLUME_UP:
+    step = -1;
+    break;
+  case BTN_LEFT:
+    step = -FB_VISIBLE_ROWS;
+    wrap = false;
+    break;
+  case BTN_RIGHT:
+    step = FB_VISIBLE_ROWS;
+    wrap = false;
+    break;
+  default:
+    return false;
+  }
+  if (phase == LVGL_KEY_REPEAT) {
+    skip_entry(fb_state.selected_index + step);
+  } else {
+    select_entry(fb_state.selected_index + step, wrap);
+  }
+  return true;
+}
+
 // 屏幕销毁回调
 static void file_browser_screen_destroy_cb(lv_event_t *e) {
   (void)e;
@@ -534,15 +939,56 @@ static void file_browser_screen_destroy_cb(lv_event_t *e) {
     fb_state.group = NULL;
   }
 
+  stop_background_work();
+  // 列表留在目录缓存中，再次进入浏览器时复用
+  dir_cache_park();
+
   // 重置状态
   memset(&fb_state, 0, sizeof(file_browser_state_t));
 }
 
+// 保活：离开浏览器时屏幕留在 screen_manager 的缓存中（连同当前目录与选中项）
+static void file_browser_suspend(void) {
+  stop_background_work();
+}
+
+// 从缓存重新载入：恢复输入组；目录在离开期间变化或列表没读完时重新读取，
+// 保留选中项（刷新由 screen_manager 统一做）
+static void file_browser_resume(void) {
+  if (fb_state.indev != NULL && fb_state.group != NULL) {
+    lv_indev_set_group(fb_state.indev, fb_state.group);
+  }
+  struct stat st;
+  const time_t mtime = stat(fb_state.current_path, &st) == 0 ? st.st_mtime : 0;
+  if (!fb_state.listed || fb_state.generation != s_dir_cache_generation ||
+      mtime != fb_state.dir_mtime) {
+    char path[MAX_PATH_LEN];
+    strcpy(path, fb_state.current_path);
+    const int selected = fb_state.selected_index;
+    if (!read_directory(path)) {
+      return;
+    }
+    const int count = entry_count();
+    fb_state.selected_index = selected < count ? selected : (count > 0 ? count - 1 : 0);
+    fb_state.window_first = fb_state.selected_index / FB_VISIBLE_ROWS * FB_VISIBLE_ROWS;
+  }
+  update_file_list_display();
+  library_db_index_start();
+}
+
+static const screen_keepalive_ops_t s_file_browser_keepalive = {
+    .suspend = file_browser_suspend,
+    .resume = file_browser_resume,
+};
+
 // 创建 SD 卡文件浏览器页面
 void file_browser_screen_create(lv_indev_t *indev) {
   ESP_LOGI(TAG, "Creating SD card file browser screen");
 
-  // 初始化状态
+  // 初始化状态：上次离开浏览器（打开书、返回）时的列表还在 fb_state 中，先移入缓存
+  dir_cache_park();
+  mem_pressure_register("dir_cache", MEM_PRESSURE_PRIO_CACHE, MEM_PRESSURE_TAG_NONE,
+                        MEM_PRESSURE_SYNC, dir_cache_shrink, NULL);
   memset(&fb_state, 0, sizeof(file_browser_state_t));
   strcpy(fb_state.current_path, SDCARD_MOUNT_POINT);
   fb_state.indev = indev;
@@ -556,6 +1002,7 @@ void file_browser_screen_create(lv_indev_t *indev) {
   // 注册屏幕销毁回调
   lv_obj_add_event_cb(screen, file_browser_screen_destroy_cb, LV_EVENT_DELETE,
                       NULL);
+  lvgl_set_key_hook(screen, file_browser_key_hook);
 
   // 设置背景为白色
   lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
@@ -603,10 +1050,51 @@ void file_browser_screen_create(lv_indev_t *indev) {
   lv_obj_set_style_bg_opa(fb_state.file_list, LV_OPA_COVER, 0);
   lv_obj_set_style_border_width(fb_state.file_list, 1, 0);
   lv_obj_set_style_border_color(fb_state.file_list, lv_color_black(), 0);
+  // 关键：显式设置列表项文字颜色，避免主题/默认样式导致“白底白字看不见”
+  lv_obj_set_style_text_color(fb_state.file_list, lv_color_black(),
+                              LV_PART_ITEMS);
+  lv_obj_set_style_pad_all(fb_state.file_list, 0, 0);
+  lv_obj_set_style_pad_row(fb_state.file_list, 0, 0);
+  lv_obj_clear_flag(fb_state.file_list, LV_OBJ_FLAG_SCROLLABLE);
 
   // 只添加键盘事件回调（无触摸屏）
-  // 说明：不在 list 容器上处理按键；改为每一行按钮加入 group，由 group 响应
-  // NEXT/PREV 导航
+  // 说明：不在 list 容器上处理按键；一页的行按钮加入 group，由 group 响应
+  // NEXT/PREV 导航。行数固定，目录再大也只有这些 LVGL 对象，换目录不重建 group
+  if (indev != NULL) {
+    fb_state.group = lv_group_create();
+    lv_group_set_wrap(fb_state.group, true);
+    lv_indev_set_group(indev, fb_state.group);
+  }
+  // 临时使用内置中文字体来测试中文显示
+  // 注意：这个字体不支持日文字符
+  extern const lv_font_t lv_font_builtin_chinese_16;
+  for (int i = 0; i < FB_VISIBLE_ROWS; i++) {
+    lv_obj_t *btn = lv_list_add_button(fb_state.file_list, LV_SYMBOL_FILE, "");
+    lv_obj_set_height(btn, FB_ROW_HEIGHT);
+    // 默认项：白底黑字（显式设置到子 label，避免继承不生效）
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+
+    lv_obj_t *icon_lbl = lv_obj_get_child(btn, 0);
+    lv_obj_t *text_lbl = lv_obj_get_child(btn, 1);
+    if (icon_lbl) {
+      lv_obj_set_style_text_font(icon_lbl, &lv_font_montserrat_14, 0);
+      lv_obj_set_style_text_color(icon_lbl, lv_color_black(), 0);
+    }
+    if (text_lbl) {
+      lv_obj_set_style_text_font(text_lbl, &lv_font_builtin_chinese_16, 0);
+      lv_obj_set_style_text_color(text_lbl, lv_color_black(), 0);
+      // 长文件名截断显示，滚动动画在墨水屏上会不停刷新
+      lv_label_set_long_mode(text_lbl, LV_LABEL_LONG_DOT);
+    }
+
+    lv_obj_add_event_cb(btn, file_browser_row_key_event_cb, LV_EVENT_KEY, NULL);
+    lv_obj_add_event_cb(btn, file_browser_row_focused_cb, LV_EVENT_FOCUSED, NULL);
+    fb_state.rows[i] = btn;
+    if (fb_state.group) {
+      lv_group_add_obj(fb_state.group, btn);
+    }
+  }
 
   // ========================================
   // 底部操作提示
@@ -636,16 +1124,17 @@ void file_browser_screen_create(lv_indev_t *indev) {
   lv_obj_set_style_text_color(hint3, lv_color_black(), 0);
   lv_obj_align(hint3, LV_ALIGN_TOP_LEFT, 20, 770);
 
-  // 设置焦点
-  if (indev != NULL) {
-    // group 在 update_file_list_display() 内按当前列表重建
-  }
-
   // 读取根目录并显示
   if (read_directory(SDCARD_MOUNT_POINT)) {
     update_file_list_display();
+    // 在后台为卡上的书建立书名、作者与封面索引，之后列表直接读数据库；
+    // 离开浏览器时停止，避免与阅读器争抢 SD 卡
+    library_db_index_start();
+    screen_manager_set_keepalive(SCREEN_TYPE_FILE_BROWSER, &s_file_browser_keepalive);
   } else {
     ESP_LOGE(TAG, "Failed to read SD card root directory");
+    // 错误页不保活：插卡后再次进入时重建
+    screen_manager_set_keepalive(SCREEN_TYPE_FILE_BROWSER, NULL);
 
     // 显示错误消息
     lv_obj_t *error_label = lv_label_create(screen);
@@ -655,31 +1144,8 @@ void file_browser_screen_create(lv_indev_t *indev) {
     lv_obj_align(error_label, LV_ALIGN_CENTER, 0, 0);
   }
 
-  // 首次加载：使用全刷确保显示质量
-  // 关键：必须先触发渲染完成，再调用 lvgl_display_refresh()
-  // 因为刷新请求队列是单槽的，后面的会覆盖前面的
-  lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-  // 强制清空 framebuffer 为白色（确保旧数据被覆盖）
-  // 这是关键步骤：单纯 invalidate 屏幕不会触发全屏渲染
-  lvgl_clear_framebuffer();
-
-  // 使整个屏幕无效，强制 LVGL 重新渲染所有内容
-  lv_obj_invalidate(screen);
-
-  // 多次触发渲染，确保 framebuffer 被新内容完全覆盖
-  for (int i = 0; i < 5; i++) {
-    lvgl_trigger_render(NULL);
-    vTaskDelay(pdMS_TO_TICKS(10));  // 等待 disp_flush_cb 完成
-  }
-
-  // 确保之前的刷新请求已处理完成
-  while (lvgl_is_refreshing()) {
-    vTaskDelay(pdMS_TO_TICKS(5));
-  }
-
-  // 最后只调用一次刷新，避免队列覆盖
-  lvgl_display_refresh();
+  // 首次加载：清屏、整屏渲染，刷新方式由 screen_manager 按画面变化量决定
+  screen_manager_refresh(SCREEN_REFRESH_TRANSITION);
 
   ESP_LOGI(TAG, "SD card file browser screen created successfully");
 }
@@ -7,6 +7,7 @@
 #define FILE_BROWSER_H
 
 #include "lvgl.h"
+#include <stdint.h>
 
 /**
  * @brief 创建 SD 卡文件浏览器页面
@@ -14,4 +15,18 @@
  */
 void file_browser_screen_create(lv_indev_t *indev);
 
+/**
+ * @brief 卡上内容被改动（挂载、上传文件）后调用，使缓存的目录列表全部失效
+ *
+ * 可在任意任务中调用，浏览器下次读目录时丢弃旧列表
+ */
+void file_browser_invalidate_cache(void);
+
+/**
+ * @brief 缓存代数：每次 file_browser_invalidate_cache() 加一
+ *
+ * 其他按目录缓存列表的模块（图片浏览器）记下读取时的代数，不同即失效
+ */
+uint32_t file_browser_cache_generation(void);
+
 #endif // FILE_BROWSER_H
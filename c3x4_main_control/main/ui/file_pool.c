@@ -0,0 +1,188 @@
+/**
+ * @file file_pool.c
+ * @brief 句柄池实现：fopencookie 包装的虚拟句柄 + LRU 关闭的真实文件
+ *
+ * 每个虚拟句柄记住路径、逻辑位置和文件大小；真实文件不做 stdio 缓冲
+ * （调用方在虚拟句柄上用 setvbuf 设置的缓冲仍然有效），读取前位置不一致时才 fseek
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE    // fopencookie
+#endif
+#include "file_pool.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+static const char *TAG = "FILE_POOL";
+
+#ifdef __NEWLIB__
+typedef _off64_t pool_off_t;
+#else
+typedef off64_t pool_off_t;
+#endif
+
+typedef struct {
+    bool in_use;
+    char *path;
+    FILE *real;           // NULL = 已被 LRU 关闭（或尚未打开）
+    long real_pos;        // 真实文件当前位置（-1 = 未知）
+    long pos;             // 虚拟句柄的逻辑位置
+    long size;
+    uint32_t stamp;
+} pool_entry_t;
+
+static pool_entry_t s_entries[FILE_POOL_MAX_HANDLES];
+static SemaphoreHandle_t s_lock = NULL;
+static uint32_t s_seq = 0;
+static int s_open = 0;
+
+static void close_real(pool_entry_t *e) {
+    if (e->real != NULL) {
+        fclose(e->real);
+        e->real = NULL;
+        e->real_pos = -1;
+        s_open--;
+    }
+}
+
+// 确保真实文件已打开（必要时关闭最久未用的其他文件）
+static bool ensure_open(pool_entry_t *e) {
+    e->stamp = ++s_seq;
+    if (e->real != NULL) {
+        return true;
+    }
+    if (s_open >= FILE_POOL_MAX_OPEN) {
+        pool_entry_t *lru = NULL;
+        for (int i = 0; i < FILE_POOL_MAX_HANDLES; i++) {
+            pool_entry_t *c = &s_entries[i];
+            if (c->in_use && c->real != NULL && (lru == NULL || c->stamp < lru->stamp)) {
+                lru = c;
+            }
+        }
+        if (lru != NULL) {
+            ESP_LOGD(TAG, "Parking %s", lru->path);
+            close_real(lru);
+        }
+    }
+    e->real = fopen(e->path, "rb");
+    if (e->real == NULL) {
+        ESP_LOGW(TAG, "Reopen failed: %s", e->path);
+        return false;
+    }
+    setvbuf(e->real, NULL, _IONBF, 0);
+    e->real_pos = 0;
+    s_open++;
+    return true;
+}
+
+static ssize_t pool_read(void *cookie, char *buf, size_t size) {
+    pool_entry_t *e = (pool_entry_t *)cookie;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    ssize_t ret = -1;
+    if (ensure_open(e) &&
+        (e->real_pos == e->pos || fseek(e->real, e->pos, SEEK_SET) == 0)) {
+        const size_t n = fread(buf, 1, size, e->real);
+        e->pos += (long)n;
+        e->real_pos = e->pos;
+        ret = (n > 0 || feof(e->real)) ? (ssize_t)n : -1;
+    } else if (e->real != NULL) {
+        e->real_pos = -1;
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+// 只改逻辑位置，下次读取时才定位真实文件
+static int pool_seek(void *cookie, pool_off_t *offset, int whence) {
+    pool_entry_t *e = (pool_entry_t *)cookie;
+    long base = 0;
+    if (whence == SEEK_CUR) {
+        base = e->pos;
+    } else if (whence == SEEK_END) {
+        base = e->size;
+    }
+    const long pos = base + (long)*offset;
+    if (pos < 0) {
+        return -1;
+    }
+    e->pos = pos;
+    *offset = pos;
+    return 0;
+}
+
+static int pool_close(void *cookie) {
+    pool_entry_t *e = (pool_entry_t *)cookie;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    close_real(e);
+    free(e->path);
+    memset(e, 0, sizeof(*e));
+    xSemaphoreGive(s_lock);
+    return 0;
+}
+
+bool file_pool_init(void) {
+    if (s_lock == NULL) {
+        s_lock = xSemaphoreCreateMutex();
+    }
+    return s_lock != NULL;
+}
+
+FILE *file_pool_fopen(const char *path) {
+    if (s_lock == NULL) {
+        return fopen(path, "rb");
+    }
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return NULL;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    pool_entry_t *e = NULL;
+    for (int i = 0; i < FILE_POOL_MAX_HANDLES; i++) {
+        if (!s_entries[i].in_use) {
+            e = &s_entries[i];
+            break;
+        }
+    }
+    if (e != NULL) {
+        e->path = strdup(path);
+        if (e->path != NULL) {
+            e->in_use = true;
+            e->size = (long)st.st_size;
+            e->real_pos = -1;
+            // 立即打开一次：路径不可读时马上失败，与 fopen 的行为一致
+            if (!ensure_open(e)) {
+                free(e->path);
+                memset(e, 0, sizeof(*e));
+                xSemaphoreGive(s_lock);
+                return NULL;
+            }
+        } else {
+            e = NULL;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    if (e == NULL) {
+        ESP_LOGW(TAG, "Pool full, opening %s directly", path);
+        return fopen(path, "rb");
+    }
+
+    const cookie_io_functions_t io = {
+        .read = pool_read,
+        .write = NULL,
+        .seek = pool_seek,
+        .close = pool_close,
+    };
+    FILE *f = fopencookie(e, "rb", io);
+    if (f == NULL) {
+        pool_close(e);
+    }
+    return f;
+}
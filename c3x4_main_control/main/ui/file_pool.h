@@ -0,0 +1,46 @@
+/**
+ * @file file_pool.h
+ * @brief SD 卡只读文件句柄池：长期打开的读者共享有限的 FATFS 文件槽
+ *
+ * FATFS 同时打开的文件数由挂载参数 max_files 固定。阅读器（TXT/EPUB）、最多
+ * MAX_OPEN_FONTS 个流式字体、LVGL 文件驱动和预取都长期持有文件，再加上缓存写入
+ * 和 BLE 接收，很容易用完。
+ *
+ * file_pool_fopen 返回的是普通 FILE*（fopencookie），调用方照常 fread/fseek/ftell/
+ * setvbuf/fclose。池内最多 FILE_POOL_MAX_OPEN 个真实文件，超出时按最久未用关闭其中
+ * 一个；被关闭的句柄只记住路径和位置，下次读取时透明地重新打开并定位。
+ * 其余 max_files - FILE_POOL_MAX_OPEN 个槽留给短时打开的文件（缓存、日志、上传）。
+ *
+ * 句柄没有文件描述符：fileno() 返回 -1，需要文件信息时用 stat(路径)。
+ * 未初始化（模拟器、SD 挂载失败）时直接退回 fopen
+ */
+
+#ifndef FILE_POOL_H
+#define FILE_POOL_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FILE_POOL_MAX_OPEN    5    // 同时打开的真实文件（挂载 max_files 为 8）
+#define FILE_POOL_MAX_HANDLES 16   // 池句柄上限（超出时退回 fopen）
+
+/**
+ * @brief 初始化句柄池（SD 卡挂载后调用一次）
+ */
+bool file_pool_init(void);
+
+/**
+ * @brief 只读打开文件（"rb"）
+ * @return FILE*，用 fclose 关闭；文件不存在时返回 NULL
+ */
+FILE *file_pool_fopen(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FILE_POOL_H
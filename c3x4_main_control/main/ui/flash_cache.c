@@ -0,0 +1,333 @@
+/**
+ * @file flash_cache.c
+ * @brief 内部 flash 热块缓存实现：固定槽位数据文件 + 延迟保存的槽位表
+ *
+ * hot.bin 第 i 个 FLASH_CACHE_BLOCK 即槽位 i 的数据；hot.idx 记录每个槽位
+ * 对应的（对象、块号）、长度、访问频率和数据校验。槽位第一次命中时整块读出校验，
+ * 之后同一次开机内只读需要的字节
+ */
+
+#include "flash_cache.h"
+#include "page_index.h"
+#include "../spi_arbiter.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "FLASH_CACHE";
+
+#define HOT_MAGIC       0x43483458u  // "X4HC"
+#define HOT_TRACK_SIZE  128          // 候选块计数表
+#define HOT_FREQ_MAX    255          // 任一计数到达时全部减半
+#define HOT_SAVE_EVERY  4            // 每提升几块保存一次槽位表
+
+typedef struct __attribute__((packed)) {
+    uint32_t id;
+    uint32_t block;
+    uint16_t len;         // 0 = 空槽
+    uint16_t freq;
+    uint32_t hash;        // 数据校验
+} hot_slot_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t slots;
+    uint32_t table_hash;
+} hot_index_header_t;
+
+typedef struct {
+    uint32_t id;
+    uint32_t block;
+    uint8_t count;
+} hot_candidate_t;
+
+static struct {
+    bool ready;
+    FILE *data;
+    char index_path[48];
+    char tmp_path[48];
+    hot_slot_t slots[FLASH_CACHE_SLOTS];
+    bool verified[FLASH_CACHE_SLOTS];   // 本次开机已整块校验过
+    hot_candidate_t track[HOT_TRACK_SIZE];
+    int promotions;
+    int unsaved;
+} s_hot;
+
+static bool sd_read(FILE *f, long pos, void *dst, size_t len) {
+    spi_arbiter_sd_begin();
+    const bool ok = fseek(f, pos, SEEK_SET) == 0 && fread(dst, 1, len, f) == len;
+    spi_arbiter_sd_end();
+    return ok;
+}
+
+static void index_save(void) {
+    FILE *f = fopen(s_hot.tmp_path, "wb");
+    if (!f) {
+        return;
+    }
+    const hot_index_header_t hdr = {
+        .magic = HOT_MAGIC,
+        .slots = FLASH_CACHE_SLOTS,
+        .table_hash = page_index_hash(0, s_hot.slots, sizeof(s_hot.slots)),
+    };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+              fwrite(s_hot.slots, sizeof(s_hot.slots), 1, f) == 1;
+    ok = (fclose(f) == 0) && ok;
+    if (ok && rename(s_hot.tmp_path, s_hot.index_path) != 0) {
+        remove(s_hot.index_path);
+        ok = rename(s_hot.tmp_path, s_hot.index_path) == 0;
+    }
+    if (ok) {
+        s_hot.unsaved = 0;
+    } else {
+        remove(s_hot.tmp_path);
+    }
+}
+
+static void index_load(void) {
+    memset(s_hot.slots, 0, sizeof(s_hot.slots));
+    FILE *f = fopen(s_hot.index_path, "rb");
+    if (!f) {
+        return;
+    }
+    hot_index_header_t hdr;
+    const bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == HOT_MAGIC &&
+                    hdr.slots == FLASH_CACHE_SLOTS &&
+                    fread(s_hot.slots, sizeof(s_hot.slots), 1, f) == 1 &&
+                    page_index_hash(0, s_hot.slots, sizeof(s_hot.slots)) == hdr.table_hash;
+    fclose(f);
+    if (!ok) {
+        ESP_LOGW(TAG, "Slot table damaged, starting empty");
+        memset(s_hot.slots, 0, sizeof(s_hot.slots));
+    }
+}
+
+bool flash_cache_init(const char *root) {
+    if (s_hot.ready) {
+        return true;
+    }
+    char path[48];
+    snprintf(path, sizeof(path), "%s/hot.bin", root);
+    snprintf(s_hot.index_path, sizeof(s_hot.index_path), "%s/hot.idx", root);
+    snprintf(s_hot.tmp_path, sizeof(s_hot.tmp_path), "%s/hot.tmp", root);
+
+    s_hot.data = fopen(path, "r+b");
+    if (!s_hot.data) {
+        s_hot.data = fopen(path, "w+b");
+    }
+    if (!s_hot.data) {
+        ESP_LOGW(TAG, "Cannot open %s, flash tier disabled", path);
+        return false;
+    }
+    // 槽位按块整读，不需要 stdio 缓冲
+    setvbuf(s_hot.data, NULL, _IONBF, 0);
+    index_load();
+
+    int used = 0;
+    for (int i = 0; i < FLASH_CACHE_SLOTS; i++) {
+        used += s_hot.slots[i].len != 0;
+    }
+    s_hot.ready = true;
+    ESP_LOGI(TAG, "Flash tier ready: %d/%d slots in use", used, FLASH_CACHE_SLOTS);
+    return true;
+}
+
+uint32_t flash_cache_file_id(const char *path) {
+    struct stat st;
+    uint32_t stamp[2] = {0, 0};
+    if (stat(path, &st) == 0) {
+        stamp[0] = (uint32_t)st.st_size;
+        stamp[1] = (uint32_t)st.st_mtime;
+    }
+    const uint32_t h = page_index_hash(0, path, strlen(path));
+    return page_index_hash(h, stamp, sizeof(stamp));
+}
+
+static int slot_find(uint32_t id, uint32_t block) {
+    for (int i = 0; i < FLASH_CACHE_SLOTS; i++) {
+        if (s_hot.slots[i].len != 0 && s_hot.slots[i].id == id && s_hot.slots[i].block == block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void age_counts(void) {
+    for (int i = 0; i < FLASH_CACHE_SLOTS; i++) {
+        s_hot.slots[i].freq /= 2;
+    }
+    for (int i = 0; i < HOT_TRACK_SIZE; i++) {
+        s_hot.track[i].count /= 2;
+    }
+}
+
+static void slot_drop(int slot) {
+    memset(&s_hot.slots[slot], 0, sizeof(s_hot.slots[slot]));
+    s_hot.verified[slot] = false;
+    s_hot.unsaved++;
+}
+
+// 从槽位读取 [off, off + len)；校验失败时丢弃该槽并返回 false
+static bool slot_read(int slot, uint32_t off, uint8_t *dst, size_t len) {
+    hot_slot_t *s = &s_hot.slots[slot];
+    if (off + len > s->len) {
+        return false;
+    }
+    const long pos = (long)slot * FLASH_CACHE_BLOCK;
+    if (!s_hot.verified[slot]) {
+        uint8_t *tmp = (uint8_t *)malloc(s->len);
+        const bool ok = tmp && fseek(s_hot.data, pos, SEEK_SET) == 0 &&
+                        fread(tmp, 1, s->len, s_hot.data) == s->len &&
+                        page_index_hash(0, tmp, s->len) == s->hash;
+        if (ok) {
+            memcpy(dst, tmp + off, len);
+        }
+        free(tmp);
+        if (!ok) {
+            if (tmp) {
+                ESP_LOGW(TAG, "Dropping damaged slot %d", slot);
+                slot_drop(slot);
+            }
+            return false;
+        }
+        s_hot.verified[slot] = true;
+    } else if (fseek(s_hot.data, pos + (long)off, SEEK_SET) != 0 ||
+               fread(dst, 1, len, s_hot.data) != len) {
+        return false;
+    }
+
+    if (++s->freq >= HOT_FREQ_MAX) {
+        age_counts();
+    }
+    return true;
+}
+
+// 记录一次缺失访问，返回该块的累计次数（被挤出候选表时为 0）
+static uint8_t track_hit(uint32_t id, uint32_t block) {
+    hot_candidate_t *c = &s_hot.track[(id ^ (block * 0x9E3779B1u)) % HOT_TRACK_SIZE];
+    if (c->count > 0 && c->id == id && c->block == block) {
+        if (c->count < HOT_FREQ_MAX) {
+            c->count++;
+        }
+        return c->count;
+    }
+    if (c->count <= 1) {
+        c->id = id;
+        c->block = block;
+        c->count = 1;
+        return 1;
+    }
+    c->count--;
+    return 0;
+}
+
+static void promote(uint32_t id, uint32_t block, const uint8_t *data, uint16_t len, uint8_t count) {
+    int victim = -1;
+    for (int i = 0; i < FLASH_CACHE_SLOTS; i++) {
+        if (s_hot.slots[i].len == 0) {
+            victim = i;
+            break;
+        }
+        if (victim < 0 || s_hot.slots[i].freq < s_hot.slots[victim].freq) {
+            victim = i;
+        }
+    }
+    if (s_hot.slots[victim].len != 0 && count <= s_hot.slots[victim].freq) {
+        return;
+    }
+
+    const long pos = (long)victim * FLASH_CACHE_BLOCK;
+    const bool ok = fseek(s_hot.data, pos, SEEK_SET) == 0 &&
+                    fwrite(data, 1, len, s_hot.data) == len && fflush(s_hot.data) == 0;
+    if (!ok) {
+        slot_drop(victim);
+        return;
+    }
+    s_hot.slots[victim] = (hot_slot_t){
+        .id = id,
+        .block = block,
+        .len = len,
+        .freq = count,
+        .hash = page_index_hash(0, data, len),
+    };
+    s_hot.verified[victim] = true;
+    s_hot.promotions++;
+    if (++s_hot.unsaved >= HOT_SAVE_EVERY) {
+        index_save();
+    }
+}
+
+bool flash_cache_read(uint32_t id, FILE *f, long base, uint32_t size,
+                      uint32_t offset, void *buf, size_t len) {
+    if (len == 0) {
+        return true;
+    }
+    if (!f || !buf || offset > size || len > size - offset) {
+        return false;
+    }
+    if (!s_hot.ready) {
+        return sd_read(f, base + (long)offset, buf, len);
+    }
+
+    uint8_t *out = (uint8_t *)buf;
+    const uint32_t end = offset + (uint32_t)len;
+    const uint32_t first = offset / FLASH_CACHE_BLOCK;
+    const uint32_t last = (end - 1) / FLASH_CACHE_BLOCK;
+
+    // 命中的块从 flash 读，连续缺失的块合并成一次 SD 读取
+    bool in_miss = false;
+    uint32_t miss_start = 0;
+    for (uint32_t b = first; b <= last; b++) {
+        const uint32_t bs = b * FLASH_CACHE_BLOCK;
+        const uint32_t lo = bs > offset ? bs : offset;
+        const uint32_t hi = bs + FLASH_CACHE_BLOCK < end ? bs + FLASH_CACHE_BLOCK : end;
+        const int slot = slot_find(id, b);
+        if (slot >= 0 && slot_read(slot, lo - bs, out + (lo - offset), hi - lo)) {
+            if (in_miss) {
+                if (!sd_read(f, base + (long)miss_start, out + (miss_start - offset), lo - miss_start)) {
+                    return false;
+                }
+                in_miss = false;
+            }
+            continue;
+        }
+        if (!in_miss) {
+            in_miss = true;
+            miss_start = lo;
+        }
+    }
+    if (in_miss && !sd_read(f, base + (long)miss_start, out + (miss_start - offset), end - miss_start)) {
+        return false;
+    }
+
+    // 缺失的块计数，够热的提升到 flash
+    for (uint32_t b = first; b <= last && s_hot.promotions < FLASH_CACHE_MAX_PROMOTIONS; b++) {
+        if (slot_find(id, b) >= 0) {
+            continue;
+        }
+        const uint8_t count = track_hit(id, b);
+        if (count < FLASH_CACHE_PROMOTE_HITS) {
+            continue;
+        }
+        const uint32_t bs = b * FLASH_CACHE_BLOCK;
+        const uint16_t blen = (uint16_t)(size - bs < FLASH_CACHE_BLOCK ? size - bs : FLASH_CACHE_BLOCK);
+        if (bs >= offset && bs + blen <= end) {
+            promote(id, b, out + (bs - offset), blen, count);
+        } else {
+            uint8_t *tmp = (uint8_t *)malloc(blen);
+            if (tmp && sd_read(f, base + (long)bs, tmp, blen)) {
+                promote(id, b, tmp, blen, count);
+            }
+            free(tmp);
+        }
+        s_hot.track[(id ^ (b * 0x9E3779B1u)) % HOT_TRACK_SIZE].count = 0;
+    }
+    return true;
+}
+
+void flash_cache_flush(void) {
+    if (s_hot.ready && s_hot.unsaved > 0) {
+        index_save();
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * @file flash_cache.h
+ * @brief 内部 flash 热块缓存：SD 卡之上的第二级，常读的 4KB 块提升到 LittleFS 分区
+ *
+ * 读取按 FLASH_CACHE_BLOCK 划分的块统计访问次数（RAM 中的候选表，容量有限，
+ * 冷块会被挤掉）。某块访问达到 FLASH_CACHE_PROMOTE_HITS 次后复制到 flash 上的
+ * 固定槽位文件；槽位满时淘汰访问频率最低的槽，候选块的次数必须超过它才替换，
+ * 避免来回写 flash。计数定期减半，旧的热点会逐渐让位。
+ *
+ * 使用者：EPUB 缓存条目（解压后的章节、段落块、目录表），流式字体的字形描述符与位图。
+ * TXT 分页索引打开书籍时整体读入 RAM，不走这里。
+ *
+ * 分区只有 192KB，槽位文件占 FLASH_CACHE_SLOTS 个块，其余留给 LittleFS 的元数据和
+ * 写时复制。槽位表延迟保存（每几次提升或 flash_cache_flush 时），断电后表与数据
+ * 不一致的槽由数据校验发现并丢弃。未初始化（没有分区或挂载失败、模拟器）时
+ * 所有读取直接走 SD 卡。只在 LVGL 任务中调用
+ */
+
+#ifndef FLASH_CACHE_H
+#define FLASH_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLASH_CACHE_ROOT          "/littlefs"
+#define FLASH_CACHE_BLOCK         4096
+#define FLASH_CACHE_SLOTS         32       // 128KB
+#define FLASH_CACHE_PROMOTE_HITS  3
+#define FLASH_CACHE_MAX_PROMOTIONS 64      // 每次开机最多提升的块数（限制 flash 擦写）
+
+/**
+ * @brief 打开 root（LittleFS 挂载点）下的槽位文件并载入槽位表
+ * @return true 缓存可用
+ */
+bool flash_cache_init(const char *root);
+
+/**
+ * @brief 文件身份：路径 + 大小 + 修改时间（替换同名文件后旧块自然失效）
+ */
+uint32_t flash_cache_file_id(const char *path);
+
+/**
+ * @brief 读取对象（文件或文件中的一段）的 [offset, offset + len)
+ *
+ * 已在 flash 中的块从 flash 读，其余块从 f 读（连续的缺失块合并为一次 fread）并计数，
+ * 达到阈值的块随后提升到 flash
+ * @param id 对象身份（内容改变时必须改变）
+ * @param f SD 卡上的文件
+ * @param base 对象在 f 中的起始偏移
+ * @param size 对象总长度（决定最后一块的长度）
+ * @return true 读满 len 字节
+ */
+bool flash_cache_read(uint32_t id, FILE *f, long base, uint32_t size,
+                      uint32_t offset, void *buf, size_t len);
+
+/**
+ * @brief 保存有变化的槽位表（进入睡眠前调用）
+ */
+void flash_cache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLASH_CACHE_H
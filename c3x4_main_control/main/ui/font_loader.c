@@ -10,6 +10,8 @@
  */
 
 #include "font_loader.h"
+#include "font_ttf.h"
+#include "font_stream.h"
 #include "builtin_chinese_font.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
@@ -17,6 +19,7 @@
 #include "freertos/timers.h"
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 #include <dirent.h>
 #include <sys/stat.h>
 
@@ -182,7 +185,8 @@ static lv_font_t* load_font_file(const char *file_path, char *font_name, size_t
     // 设置 lv_font_t 结构（在 buffer 开头）
     lv_font_t *font = (lv_font_t *)font_buffer;
 
-    // 设置字体基本信息
+    // 设置字体基本信息（先清零，fallback 等字段不能留着文件内容）
+    memset(font, 0, sizeof(lv_font_t));
     font->subpx = LV_FONT_SUBPX_NONE;
     font->line_height = 0;  // 将从字体数据中获取
     font->base_line = 0;
@@ -257,9 +261,8 @@ bool font_loader_init(const char *font_dir)
     g_font_loader.default_font = (lv_font_t *)&lv_font_montserrat_14;
     g_font_loader.current_font = g_font_loader.default_font;
 
-    // 扫描字体文件
-    int font_count = font_loader_scan_fonts();
-    ESP_LOGI(TAG, "Font loader initialized, found %d font files", font_count);
+    // 不在这里扫描：扫描由 font_manager 在首屏显示后放到后台进行
+    ESP_LOGI(TAG, "Font loader initialized");
 
     return true;
 }
@@ -275,27 +278,241 @@ int font_loader_scan_fonts(void)
         return g_font_loader.font_count;
     }
 
-    return font_loader_rescan_fonts();
+    g_font_loader.font_count = font_loader_collect_fonts(g_font_loader.fonts, MAX_FONTS, true);
+    return g_font_loader.font_count;
 }
 
-int font_loader_rescan_fonts(void)
+// 登记字体时只读文件开头的字体头（流式格式：version, magic, line_height, base_line, bpp, cmap_num）
+typedef struct __attribute__((packed)) {
+    uint32_t version;
+    uint32_t magic;
+    uint16_t line_height;
+    uint16_t base_line;
+    uint8_t bpp;
+    uint8_t cmap_num;
+} font_probe_header_t;
+
+// 扫描结果缓存文件
+#define SCAN_CACHE_MAGIC 0x4C463458u      // "X4FL"
+#define SCAN_CACHE_VERSION 2
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t dir_mtime;
+    uint32_t names_hash;        // 目录中字体文件名（readdir 顺序）的 FNV-1a 哈希
+    uint32_t count;
+} scan_cache_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[MAX_FONT_NAME_LEN];
+    char file_path[256];
+    uint16_t line_height;
+    uint8_t bpp;
+    uint8_t cmap_num;
+    uint8_t has_preview;
+    uint8_t reserved[3];
+    uint8_t preview[FONT_PREVIEW_BYTES];    // 没有预览条时全 0
+} scan_cache_record_t;
+
+// 预览条示例文字：永字八法 Aa（"永"字含全部八种基本笔画）
+static const uint32_t s_preview_text[] = { 0x6C38, 0x5B57, 0x516B, 0x6CD5, ' ', 'A', 'a' };
+
+static uint32_t hash_name(uint32_t hash, const char *name)
 {
-    ESP_LOGI(TAG, "Rescanning fonts in: %s", g_font_loader.font_dir);
+    for (const unsigned char *p = (const unsigned char *)name; ; p++) {
+        hash = (hash ^ *p) * 16777619u;
+        if (*p == '\0') {
+            return hash;
+        }
+    }
+}
+
+// 读字体头，填写行高 / bpp / cmap 数；读不到或数值不合理时保持 0（未知）
+static void probe_font_header(font_info_t *info)
+{
+    if (font_ttf_is_ttf_path(info->file_path)) {
+        info->bpp = 1;      // 按字号光栅化并二值化，行高随字号变化
+        return;
+    }
+    FILE *fp = fopen(info->file_path, "rb");
+    if (fp == NULL) {
+        return;
+    }
+    font_probe_header_t header;
+    const bool ok = fread(&header, 1, sizeof(header), fp) == sizeof(header);
+    fclose(fp);
+    if (!ok || header.line_height == 0 || header.line_height > 255 ||
+        (header.bpp != 1 && header.bpp != 2 && header.bpp != 4 && header.bpp != 8)) {
+        return;
+    }
+    info->line_height = header.line_height;
+    info->bpp = header.bpp;
+    info->cmap_num = header.cmap_num;
+}
+
+// 取 bpp 位深位图中 (x, y) 处的像素值（行按字节对齐，高位在左）
+static uint8_t glyph_pixel(const uint8_t *bitmap, uint32_t stride, int x, int y, int bpp)
+{
+    const uint32_t bit = (uint32_t)x * bpp;
+    const uint8_t byte = bitmap[y * stride + bit / 8];
+    return (byte >> (8 - bpp - bit % 8)) & ((1u << bpp) - 1);
+}
+
+/**
+ * @brief 用字体本身把示例文字渲染成 1bpp 预览条
+ *
+ * 直接调用字体的取字形回调，不经过 LVGL 绘制层，所以可以在后台扫描任务中运行。
+ * 行高超过预览条高度时按整数倍缩小（缩小时任一像素着墨即着墨）
+ */
+static bool render_preview(const font_info_t *info, uint8_t *buf)
+{
+    if (info->line_height == 0 || font_ttf_is_ttf_path(info->file_path)) {
+        return false;
+    }
+    lv_font_t *font = font_stream_create(info->file_path);
+    if (font == NULL) {
+        return false;
+    }
 
-    // 清除之前的扫描结果
-    g_font_loader.font_count = 0;
-    memset(g_font_loader.fonts, 0, sizeof(g_font_loader.fonts));
+    memset(buf, 0, FONT_PREVIEW_BYTES);
+    const int bpp = info->bpp;
+    const uint8_t threshold = (uint8_t)(1u << (bpp - 1));     // 半灰度以上算着墨
+    const int scale = (font->line_height + FONT_PREVIEW_H - 1) / FONT_PREVIEW_H;
+    const int margin = (FONT_PREVIEW_H - font->line_height / scale) / 2;
+    int pen = 0;
+    bool inked = false;
+
+    for (size_t i = 0; i < sizeof(s_preview_text) / sizeof(s_preview_text[0]); i++) {
+        lv_font_glyph_dsc_t g;
+        memset(&g, 0, sizeof(g));
+        if (!font->get_glyph_dsc(font, &g, s_preview_text[i], 0)) {
+            continue;
+        }
+        const uint8_t *bitmap = (g.box_w > 0 && g.box_h > 0)
+                                ? (const uint8_t *)font->get_glyph_bitmap(&g, NULL) : NULL;
+        if (bitmap != NULL) {
+            const int top = font->line_height - font->base_line - g.box_h - g.ofs_y;
+            for (int y = 0; y < g.box_h; y++) {
+                const int py = margin + (top + y) / scale;
+                if (py < 0 || py >= FONT_PREVIEW_H) {
+                    continue;
+                }
+                for (int x = 0; x < g.box_w; x++) {
+                    const int px = (pen + g.ofs_x + x) / scale;
+                    if (px < 0 || px >= FONT_PREVIEW_W ||
+                        glyph_pixel(bitmap, g.stride, x, y, bpp) < threshold) {
+                        continue;
+                    }
+                    buf[py * FONT_PREVIEW_STRIDE + px / 8] |= 0x80 >> (px % 8);
+                    inked = true;
+                }
+            }
+        }
+        pen += g.adv_w;
+        if (pen / scale >= FONT_PREVIEW_W) {
+            break;
+        }
+    }
 
-    DIR *dir = opendir(g_font_loader.font_dir);
-    if (dir == NULL) {
-        ESP_LOGE(TAG, "Failed to open font directory: %s", g_font_loader.font_dir);
+    font_stream_destroy(font);
+    return inked;
+}
+
+static bool load_scan_cache(uint32_t dir_mtime, uint32_t names_hash, font_info_t *fonts, int count)
+{
+    FILE *fp = fopen(FONT_LOADER_SCAN_CACHE, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    scan_cache_header_t header;
+    bool ok = fread(&header, 1, sizeof(header), fp) == sizeof(header) &&
+              header.magic == SCAN_CACHE_MAGIC && header.version == SCAN_CACHE_VERSION &&
+              header.dir_mtime == dir_mtime && header.names_hash == names_hash &&
+              header.count == (uint32_t)count;
+    for (int i = 0; ok && i < count; i++) {
+        scan_cache_record_t rec;
+        ok = fread(&rec, 1, sizeof(rec), fp) == sizeof(rec) &&
+             strncmp(rec.file_path, fonts[i].file_path, sizeof(rec.file_path)) == 0;
+        if (ok) {
+            fonts[i].line_height = rec.line_height;
+            fonts[i].bpp = rec.bpp;
+            fonts[i].cmap_num = rec.cmap_num;
+            fonts[i].has_preview = rec.has_preview != 0;
+        }
+    }
+    fclose(fp);
+    return ok;
+}
+
+// 写扫描缓存：逐个字体读字体头、渲染预览条并写入记录（预览条不在内存里攒着）
+static void probe_and_save(uint32_t dir_mtime, uint32_t names_hash, font_info_t *fonts, int count)
+{
+    mkdir("/sdcard/.x4cache", 0775);
+    FILE *fp = fopen(FONT_LOADER_SCAN_CACHE, "wb");
+    if (fp == NULL) {
+        ESP_LOGW(TAG, "Cannot write font scan cache %s", FONT_LOADER_SCAN_CACHE);
+    }
+    scan_cache_header_t header = {
+        .magic = SCAN_CACHE_MAGIC,
+        .version = SCAN_CACHE_VERSION,
+        .dir_mtime = dir_mtime,
+        .names_hash = names_hash,
+        .count = (uint32_t)count,
+    };
+    bool ok = fp != NULL && fwrite(&header, 1, sizeof(header), fp) == sizeof(header);
+    scan_cache_record_t *rec = (scan_cache_record_t *)malloc(sizeof(scan_cache_record_t));
+
+    for (int i = 0; i < count; i++) {
+        probe_font_header(&fonts[i]);
+        if (rec != NULL) {
+            memset(rec, 0, sizeof(*rec));
+            fonts[i].has_preview = render_preview(&fonts[i], rec->preview);
+        }
+        ESP_LOGI(TAG, "Found font [%d]: name='%s', path='%s', h=%u, bpp=%u, cmap=%u, preview=%d",
+                 i, fonts[i].name, fonts[i].file_path, fonts[i].line_height,
+                 fonts[i].bpp, fonts[i].cmap_num, fonts[i].has_preview);
+        if (!ok || rec == NULL) {
+            continue;
+        }
+        strncpy(rec->name, fonts[i].name, sizeof(rec->name) - 1);
+        strncpy(rec->file_path, fonts[i].file_path, sizeof(rec->file_path) - 1);
+        rec->line_height = fonts[i].line_height;
+        rec->bpp = fonts[i].bpp;
+        rec->cmap_num = fonts[i].cmap_num;
+        rec->has_preview = fonts[i].has_preview;
+        ok = fwrite(rec, 1, sizeof(*rec), fp) == sizeof(*rec);
+    }
+
+    free(rec);
+    if (fp != NULL) {
+        fclose(fp);
+        if (!ok || rec == NULL) {
+            remove(FONT_LOADER_SCAN_CACHE);
+        }
+    }
+}
+
+int font_loader_collect_fonts(font_info_t *fonts, int max_fonts, bool use_cache)
+{
+    const char *font_dir = g_font_loader.font_dir;
+    memset(fonts, 0, sizeof(font_info_t) * max_fonts);
+
+    struct stat st;
+    DIR *dir = opendir(font_dir);
+    if (dir == NULL || stat(font_dir, &st) != 0) {
+        ESP_LOGE(TAG, "Failed to open font directory: %s", font_dir);
+        if (dir != NULL) {
+            closedir(dir);
+        }
         return 0;
     }
 
     struct dirent *entry;
-    int scan_count = 0;
+    int count = 0;
+    uint32_t names_hash = 2166136261u;
 
-    while ((entry = readdir(dir)) != NULL && g_font_loader.font_count < MAX_FONTS) {
+    while ((entry = readdir(dir)) != NULL && count < max_fonts) {
         const char *name = entry->d_name;
 
         // 跳过 "." 和 ".."
@@ -303,27 +520,26 @@ int font_loader_rescan_fonts(void)
             continue;
         }
 
-        // 检查文件扩展名
+        // 检查文件扩展名（.bin 为 lv_font_conv 字体，.ttf/.otf 由 font_manager 按需光栅化）
         const char *dot = strrchr(name, '.');
-        if (dot == NULL || strcasecmp(dot, ".bin") != 0) {
+        if (dot == NULL || (strcasecmp(dot, ".bin") != 0 && !font_ttf_is_ttf_path(name))) {
             continue;
         }
 
         // 构建完整路径
         char full_path[256];
-        int len = snprintf(full_path, sizeof(full_path) - 1, "%s/%s", g_font_loader.font_dir, name);
+        int len = snprintf(full_path, sizeof(full_path) - 1, "%s/%s", font_dir, name);
         if (len >= (int)(sizeof(full_path) - 1)) {
-            ESP_LOGW(TAG, "Font path truncated: %s/%s", g_font_loader.font_dir, name);
+            ESP_LOGW(TAG, "Font path truncated: %s/%s", font_dir, name);
             continue;
         }
 
         // 保存字体文件路径（稍后按需加载）
         // 注意：字体文件可能很大（几 MB），在 ESP32-C3 上可能无法一次性加载
         // 这种情况下降级到默认字体
-        font_info_t *info = &g_font_loader.fonts[g_font_loader.font_count];
-        memset(info, 0, sizeof(font_info_t));
+        font_info_t *info = &fonts[count];
 
-        // 提取字体名称（去掉 .bin 扩展名）
+        // 提取字体名称（去掉扩展名）
         size_t name_len = dot - name;
         if (name_len >= MAX_FONT_NAME_LEN) {
             name_len = MAX_FONT_NAME_LEN - 1;
@@ -336,18 +552,60 @@ int font_loader_rescan_fonts(void)
         info->is_loaded = false;
         info->lv_font = NULL;
 
-        g_font_loader.font_count++;
-        scan_count++;
-
-        // 记录找到的字体
-        ESP_LOGI(TAG, "Found font [%d]: name='%s' (len=%zu), path='%s'",
-                 g_font_loader.font_count - 1, info->name, strlen(info->name), info->file_path);
+        names_hash = hash_name(names_hash, name);
+        count++;
     }
 
     closedir(dir);
 
-    ESP_LOGI(TAG, "Scan complete: %d fonts found", scan_count);
-    return scan_count;
+    // FAT 上往目录里拷文件不一定更新目录的修改时间，所以同时比较文件名哈希
+    const uint32_t dir_mtime = (uint32_t)st.st_mtime;
+    if (use_cache && load_scan_cache(dir_mtime, names_hash, fonts, count)) {
+        ESP_LOGI(TAG, "Font scan cache hit: %d fonts", count);
+        return count;
+    }
+
+    probe_and_save(dir_mtime, names_hash, fonts, count);
+
+    ESP_LOGI(TAG, "Scan complete: %d fonts found", count);
+    return count;
+}
+
+void font_loader_install_fonts(const font_info_t *fonts, int count)
+{
+    if (count > MAX_FONTS) {
+        count = MAX_FONTS;
+    }
+    memcpy(g_font_loader.fonts, fonts, sizeof(font_info_t) * count);
+    memset(&g_font_loader.fonts[count], 0, sizeof(font_info_t) * (MAX_FONTS - count));
+    g_font_loader.font_count = count;
+}
+
+bool font_loader_read_preview(int index, uint8_t *buf)
+{
+    if (index < 0 || index >= g_font_loader.font_count || !g_font_loader.fonts[index].has_preview) {
+        return false;
+    }
+    FILE *fp = fopen(FONT_LOADER_SCAN_CACHE, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    const long offset = (long)sizeof(scan_cache_header_t) +
+                        (long)index * (long)sizeof(scan_cache_record_t) +
+                        (long)offsetof(scan_cache_record_t, preview);
+    const bool ok = fseek(fp, offset, SEEK_SET) == 0 &&
+                    fread(buf, 1, FONT_PREVIEW_BYTES, fp) == FONT_PREVIEW_BYTES;
+    fclose(fp);
+    return ok;
+}
+
+int font_loader_rescan_fonts(void)
+{
+    ESP_LOGI(TAG, "Rescanning fonts in: %s", g_font_loader.font_dir);
+
+    // 清除之前的扫描结果，并且不用扫描缓存
+    g_font_loader.font_count = font_loader_collect_fonts(g_font_loader.fonts, MAX_FONTS, false);
+    return g_font_loader.font_count;
 }
 
 lv_font_t* font_load_from_file(const char *file_path, char *font_name, size_t name_len)
@@ -371,6 +629,11 @@ lv_font_t* font_load_by_index(int index)
         return info->lv_font;
     }
 
+    // TrueType 字体不能整体载入，由 font_manager 按字号打开
+    if (font_ttf_is_ttf_path(info->file_path)) {
+        return NULL;
+    }
+
     // 加载字体
     char loaded_name[MAX_FONT_NAME_LEN];
     lv_font_t *font = load_font_file(info->file_path, loaded_name, sizeof(loaded_name));
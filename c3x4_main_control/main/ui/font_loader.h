@@ -15,6 +15,15 @@
 #define MAX_FONT_NAME_LEN 64
 #define MAX_FONTS 30
 
+// 扫描结果缓存（目录修改时间与字体文件名都没变时不再读字体头）
+#define FONT_LOADER_SCAN_CACHE "/sdcard/.x4cache/fonts.idx"
+
+// 字体预览条：扫描时用字体本身渲染一段示例文字（1bpp，MSB 在左），随扫描缓存保存
+#define FONT_PREVIEW_W 160
+#define FONT_PREVIEW_H 24
+#define FONT_PREVIEW_STRIDE ((FONT_PREVIEW_W + 7) / 8)
+#define FONT_PREVIEW_BYTES (FONT_PREVIEW_STRIDE * FONT_PREVIEW_H)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -28,6 +37,10 @@ typedef struct {
     lv_font_t *lv_font;               // LVGL 字体指针
     bool is_loaded;                   // 是否已加载
     int ref_count;                    // 引用计数
+    uint16_t line_height;             // 字体头中的行高（0 = 未知，TrueType 随字号变化）
+    uint8_t bpp;                      // 每像素位数（0 = 未知）
+    uint8_t cmap_num;                 // cmap 子表数
+    bool has_preview;                 // 扫描缓存中有预览条（TrueType 字体没有）
 } font_info_t;
 
 /**
@@ -53,17 +66,43 @@ typedef struct {
 bool font_loader_init(const char *font_dir);
 
 /**
- * @brief 扫描字体目录中的所有 .bin 文件
+ * @brief 扫描字体目录中的所有 .bin / .ttf / .otf 文件（已有结果时直接返回）
  * @return 找到的字体文件数量
  */
 int font_loader_scan_fonts(void);
 
 /**
- * @brief 强制重新扫描字体目录（清除之前的扫描结果）
+ * @brief 强制重新扫描字体目录（清除之前的扫描结果，不用扫描缓存）
  * @return 找到的字体文件数量
  */
 int font_loader_rescan_fonts(void);
 
+/**
+ * @brief 扫描字体目录，结果写入调用方的数组（不改动加载器状态，可在后台任务中调用）
+ *
+ * 每个字体读文件头（行高、bpp、cmap 数）并渲染预览条。目录修改时间和字体文件名都与
+ * FONT_LOADER_SCAN_CACHE 中记录的一致时直接使用缓存，不打开字体文件
+ *
+ * @param fonts 输出数组
+ * @param max_fonts 数组容量
+ * @param use_cache 是否使用扫描缓存
+ * @return 找到的字体文件数量
+ */
+int font_loader_collect_fonts(font_info_t *fonts, int max_fonts, bool use_cache);
+
+/**
+ * @brief 用 font_loader_collect_fonts() 的结果替换字体列表（在 LVGL 任务中调用）
+ */
+void font_loader_install_fonts(const font_info_t *fonts, int count);
+
+/**
+ * @brief 从扫描缓存读出字体的预览条
+ * @param index 字体索引（0 ~ font_count-1）
+ * @param buf 输出缓冲区，FONT_PREVIEW_BYTES 字节
+ * @return true 成功，false 该字体没有预览条或读取失败
+ */
+bool font_loader_read_preview(int index, uint8_t *buf);
+
 /**
  * @brief 从 SD 卡加载字体文件
  * @param file_path 字体文件的完整路径
@@ -76,7 +115,7 @@ lv_font_t* font_load_from_file(const char *file_path, char *font_name, size_t na
 /**
  * @brief 加载指定索引的字体
  * @param index 字体索引（0 ~ font_count-1）
- * @return LVGL 字体指针，失败返回 NULL
+ * @return LVGL 字体指针，失败或 TrueType 字体（由 font_manager 打开）返回 NULL
  */
 lv_font_t* font_load_by_index(int index);
 
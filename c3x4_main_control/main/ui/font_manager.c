@@ -6,27 +6,445 @@
 #include "font_manager.h"
 #include "font_loader.h"
 #include "font_stream.h"
+#include "font_ttf.h"
 #include "builtin_chinese_font.h"
+#include "lvgl_driver.h"
+#include "bg_jobs.h"
+#include "settings_store.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
-#include "nvs_flash.h"
-#include "nvs.h"
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 
 static const char *TAG = "FONT_MGR";
 
-// NVS 命名空间
-static const char *NVS_NAMESPACE = "font_cfg";
-
 // 当前选中的字体索引
 static int s_current_font_index = -1;
 static bool s_manager_initialized = false;
 
-// 流式字体指针（用于大字体文件）
-static lv_font_t *s_stream_font = NULL;
+// TrueType 字体的字号可任选，随设置保存（settings_store）
+static int s_ttf_size = FONT_MANAGER_TTF_SIZE_DEFAULT;
+
+// 位图字体（.bin）的合成字号：0 用原始字号；否则按此字号从字形母版缩放（只缩小）
+static int s_scaled_size = 0;
+
+// ---------------------------------------------------------------------------
+// 字体注册表：同一文件（TrueType 还要同一字号）在各界面间共用一个字体对象及其
+// 字形缓存，按引用计数管理。引用归零的字体保持打开（缓存保温），要腾槽位或
+// 内存时才按最久未用关闭。最多同时打开 MAX_OPEN_FONTS 个
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    FONT_KIND_MEMORY,       // font_loader 整体载入内存
+    FONT_KIND_STREAM,       // SD 卡流式读取
+    FONT_KIND_MAPPED,       // 字体分区映射
+    FONT_KIND_TTF,          // TrueType 按字号光栅化
+} font_kind_t;
+
+typedef struct {
+    lv_font_t *font;                            // NULL 为空槽
+    char path[256];
+    int size;                                   // TrueType 字号或位图字体的合成字号，原始字号为 0
+    font_kind_t kind;
+    int refs;
+    uint32_t last_use;
+    esp_partition_mmap_handle_t mmap_handle;    // FONT_KIND_MAPPED 时有效
+} font_entry_t;
+
+static font_entry_t s_open_fonts[MAX_OPEN_FONTS];
+static uint32_t s_font_use_clock = 0;
+
+// font_manager 为当前字体持有的引用（内置字体 / Montserrat 不在注册表中）
+static lv_font_t *s_held_font = NULL;
+
+// ---------------------------------------------------------------------------
+// 字体回退链：[书籍子集字体 ->] 当前字体 -> 内置中文字体 -> Montserrat（LVGL 的 fallback 指针）。
+// 对外给出的是链首的路由字体：它自己不提供字形，只按码点查路由缓存，把 fallback
+// 指向负责该码点的字体后返回 false，LVGL 接着从那个字体取字形。这样当前字体缺的字
+// 只探测一次，不会每次渲染都在流式字体里查一遍（还占掉缓存槽位）
+// ---------------------------------------------------------------------------
+
+#define ROUTE_CACHE_SIZE 512            // 直接映射，按码点取模
+#define ROUTE_EMPTY      0xFFFFFFFFu
+#define ROUTE_BITS       3
+#define ROUTE_MASK       ((1u << ROUTE_BITS) - 1)
+#define ROUTE_NONE       ROUTE_MASK     // 整条链都没有这个字形
+#define CHAIN_MAX        4
+
+static lv_font_t s_router_font;
+static const lv_font_t *s_router_primary = NULL;
+static const lv_font_t *s_chain[CHAIN_MAX];
+static int s_chain_count = 0;
+static uint32_t s_route_cache[ROUTE_CACHE_SIZE];   // (码点 << ROUTE_BITS) | 路由
+
+// 书籍子集字体（font_subset.h）及建立它的字体：只在当前字体仍是 s_subset_base 时排在链首
+static const lv_font_t *s_subset_font = NULL;
+static const lv_font_t *s_subset_base = NULL;
+
+static void router_bind(const lv_font_t *primary);
+
+static bool router_get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                    uint32_t unicode, uint32_t unicode_next)
+{
+    // 控件保存的是路由字体的指针；当前字体换过之后第一次用到时重建回退链
+    const lv_font_t *current = font_loader_get_current_font();
+    if (current != NULL && current != s_router_primary) {
+        router_bind(current);
+    }
+
+    uint32_t *entry = &s_route_cache[unicode % ROUTE_CACHE_SIZE];
+    uint32_t route;
+    if (*entry != ROUTE_EMPTY && (*entry >> ROUTE_BITS) == unicode) {
+        route = *entry & ROUTE_MASK;
+    } else {
+        route = ROUTE_NONE;
+        for (int i = 0; i < s_chain_count; i++) {
+            if (s_chain[i]->get_glyph_dsc(s_chain[i], dsc, unicode, unicode_next) &&
+                !dsc->is_placeholder) {
+                route = (uint32_t)i;
+                break;
+            }
+        }
+        *entry = (unicode << ROUTE_BITS) | route;
+        memset(dsc, 0, sizeof(*dsc));
+    }
+
+    // 整条链都没有时仍从链首查，让 LVGL 按原来的方式画占位符
+    ((lv_font_t *)font)->fallback = s_chain[route == ROUTE_NONE ? 0 : route];
+    return false;
+}
+
+static const void *router_get_glyph_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf)
+{
+    (void)dsc;
+    (void)draw_buf;
+    return NULL;    // 路由字体不会成为 resolved_font
+}
+
+// 当前字体变化后重建回退链并清空路由缓存
+static void router_bind(const lv_font_t *primary)
+{
+    s_chain_count = 0;
+    if (s_subset_font != NULL && s_subset_base == primary) {
+        s_chain[s_chain_count++] = s_subset_font;
+    }
+    s_chain[s_chain_count++] = primary;
+    if (primary != &lv_font_builtin_chinese_16) {
+        s_chain[s_chain_count++] = &lv_font_builtin_chinese_16;
+        // 不改 const 字体；SD 卡 / 流式 / TrueType 字体都是运行时创建的
+        if (primary != &lv_font_montserrat_16 && primary->fallback == NULL) {
+            ((lv_font_t *)primary)->fallback = &lv_font_builtin_chinese_16;
+        }
+    }
+    if (primary != &lv_font_montserrat_16) {
+        s_chain[s_chain_count++] = &lv_font_montserrat_16;
+    }
+    memset(s_route_cache, 0xFF, sizeof(s_route_cache));
+
+    memset(&s_router_font, 0, sizeof(s_router_font));
+    s_router_font.get_glyph_dsc = router_get_glyph_dsc_cb;
+    s_router_font.get_glyph_bitmap = router_get_glyph_bitmap_cb;
+    s_router_font.line_height = primary->line_height;
+    s_router_font.base_line = primary->base_line;
+    s_router_font.subpx = primary->subpx;
+    s_router_font.kerning = primary->kerning;
+    s_router_font.underline_position = primary->underline_position;
+    s_router_font.underline_thickness = primary->underline_thickness;
+    s_router_font.fallback = primary;
+    s_router_primary = primary;
+}
+
+// 当前字体即将更换（旧字体可能被释放，新字体可能分配在同一地址）
+static void router_invalidate(void)
+{
+    s_router_primary = NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 字体分区：大字体第一次选用时复制到 flash 分区，之后经 MMU 映射按指针访问，
+// 不再从 SD 卡流式读取。分区第一个扇区是头部（记录来源文件），字体从第二个扇区开始；
+// 头部最后写入，复制中断时分区保持无效
+// ---------------------------------------------------------------------------
+
+#define FONT_PARTITION_MAGIC 0x50463458u     // "X4FP"
+#define FONT_PARTITION_VERSION 1
+#define FONT_PARTITION_DATA_OFFSET 0x1000
+#define FONT_PARTITION_COPY_CHUNK 4096
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t file_size;
+    uint32_t file_mtime;
+    char path[240];
+} font_partition_header_t;
+
+static const esp_partition_t *find_font_partition(void)
+{
+    return esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                    FONT_MANAGER_PARTITION_LABEL);
+}
+
+static bool font_partition_holds(const esp_partition_t *part, const char *path,
+                                 const struct stat *st)
+{
+    font_partition_header_t header;
+    if (esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK) {
+        return false;
+    }
+    return header.magic == FONT_PARTITION_MAGIC && header.version == FONT_PARTITION_VERSION &&
+           header.file_size == (uint32_t)st->st_size &&
+           header.file_mtime == (uint32_t)st->st_mtime &&
+           strncmp(header.path, path, sizeof(header.path)) == 0;
+}
+
+// 把字体文件复制进分区（一次性，约每 MB 十几秒，期间界面不刷新）
+static bool font_partition_install(const esp_partition_t *part, const char *path,
+                                   const struct stat *st)
+{
+    const uint32_t size = (uint32_t)st->st_size;
+    const uint32_t erase_size = (FONT_PARTITION_DATA_OFFSET + size + part->erase_size - 1) /
+                                part->erase_size * part->erase_size;
+    FILE *fp = fopen(path, "rb");
+    uint8_t *buf = (uint8_t *)malloc(FONT_PARTITION_COPY_CHUNK);
+    bool ok = fp != NULL && buf != NULL;
+
+    ESP_LOGW(TAG, "Copying %s (%lu bytes) to flash partition '%s' (one-time)", path,
+             (unsigned long)size, FONT_MANAGER_PARTITION_LABEL);
+    if (ok && esp_partition_erase_range(part, 0, erase_size) != ESP_OK) {
+        ok = false;
+    }
+    for (uint32_t done = 0; ok && done < size;) {
+        uint32_t n = size - done;
+        if (n > FONT_PARTITION_COPY_CHUNK) {
+            n = FONT_PARTITION_COPY_CHUNK;
+        }
+        if (fread(buf, 1, n, fp) != n ||
+            esp_partition_write(part, FONT_PARTITION_DATA_OFFSET + done, buf, n) != ESP_OK) {
+            ok = false;
+        }
+        done += n;
+    }
+    if (ok) {
+        font_partition_header_t header = {
+            .magic = FONT_PARTITION_MAGIC,
+            .version = FONT_PARTITION_VERSION,
+            .file_size = size,
+            .file_mtime = (uint32_t)st->st_mtime,
+        };
+        strncpy(header.path, path, sizeof(header.path) - 1);
+        ok = esp_partition_write(part, 0, &header, sizeof(header)) == ESP_OK;
+    }
+
+    if (fp != NULL) {
+        fclose(fp);
+    }
+    free(buf);
+    if (!ok) {
+        ESP_LOGE(TAG, "Failed to copy font to flash partition");
+    }
+    return ok;
+}
 
-// 流式字体文件路径（用于判断是否需要重新加载）
-static char s_stream_font_path[256] = {0};
+static void close_entry(font_entry_t *e);
+
+// 从字体分区打开（分区不存在、放不下、正被其他字体使用或复制失败时返回 NULL，
+// 由调用方改用 SD 卡流式加载）
+static lv_font_t *font_partition_open(const char *path, esp_partition_mmap_handle_t *out_handle)
+{
+    const esp_partition_t *part = find_font_partition();
+    struct stat st;
+    if (part == NULL || stat(path, &st) != 0 || !font_stream_can_map(path)) {
+        return NULL;
+    }
+    // 分区里只能放一个字体：映射着的其他字体还有引用时不能覆盖，保温中的先关闭
+    for (int i = 0; i < MAX_OPEN_FONTS; i++) {
+        font_entry_t *e = &s_open_fonts[i];
+        if (e->font != NULL && e->kind == FONT_KIND_MAPPED) {
+            if (e->refs > 0) {
+                return NULL;
+            }
+            close_entry(e);
+        }
+    }
+    // 分区末尾的 FONT_MANAGER_SUBSET_REGION 留给书籍子集字体
+    const uint32_t room = part->size - FONT_PARTITION_DATA_OFFSET - FONT_MANAGER_SUBSET_REGION;
+    if ((uint32_t)st.st_size > room) {
+        ESP_LOGW(TAG, "Font %s does not fit in flash partition (%lu > %lu)", path,
+                 (unsigned long)st.st_size, (unsigned long)room);
+        return NULL;
+    }
+    if (!font_partition_holds(part, path, &st) && !font_partition_install(part, path, &st)) {
+        return NULL;
+    }
+
+    const void *data = NULL;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(part, FONT_PARTITION_DATA_OFFSET, (size_t)st.st_size,
+                           ESP_PARTITION_MMAP_DATA, &data, &handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map font partition");
+        return NULL;
+    }
+    lv_font_t *font = font_stream_create_mapped(data, (uint32_t)st.st_size, path);
+    if (font == NULL) {
+        esp_partition_munmap(handle);
+        return NULL;
+    }
+    *out_handle = handle;
+    return font;
+}
+
+static const char *font_kind_name(font_kind_t kind)
+{
+    switch (kind) {
+    case FONT_KIND_MEMORY: return "memory";
+    case FONT_KIND_STREAM: return "stream";
+    case FONT_KIND_MAPPED: return "flash";
+    case FONT_KIND_TTF: return "TrueType";
+    }
+    return "?";
+}
+
+static void close_entry(font_entry_t *e)
+{
+    ESP_LOGI(TAG, "Closing font (%s): %s", font_kind_name(e->kind), e->path);
+    switch (e->kind) {
+    case FONT_KIND_MEMORY:
+        font_loader_unload_font(e->font);
+        break;
+    case FONT_KIND_TTF:
+        font_ttf_destroy(e->font);
+        break;
+    case FONT_KIND_MAPPED:
+        font_stream_destroy(e->font);
+        esp_partition_munmap(e->mmap_handle);
+        break;
+    case FONT_KIND_STREAM:
+        font_stream_destroy(e->font);
+        break;
+    }
+    memset(e, 0, sizeof(*e));
+}
+
+static font_entry_t *find_entry_by_font(const lv_font_t *font)
+{
+    for (int i = 0; font != NULL && i < MAX_OPEN_FONTS; i++) {
+        if (s_open_fonts[i].font == font) {
+            return &s_open_fonts[i];
+        }
+    }
+    return NULL;
+}
+
+// 关闭最久未用的、没有引用的字体；没有可关闭的返回 false
+static bool close_idle_font(void)
+{
+    font_entry_t *oldest = NULL;
+    for (int i = 0; i < MAX_OPEN_FONTS; i++) {
+        font_entry_t *e = &s_open_fonts[i];
+        if (e->font != NULL && e->refs == 0 && (oldest == NULL || e->last_use < oldest->last_use)) {
+            oldest = e;
+        }
+    }
+    if (oldest == NULL) {
+        return false;
+    }
+    close_entry(oldest);
+    return true;
+}
+
+// 按字体类型打开到空槽 e：TrueType 按字号光栅化；要合成字号的位图字体流式读取并
+// 缩放；其他先整体载入内存，放不下再试字体分区，最后 SD 卡流式读取
+static bool open_entry(font_entry_t *e, int index, const char *path, int size)
+{
+    if (font_ttf_is_ttf_path(path)) {
+        e->font = font_ttf_create(path, size);
+        e->kind = FONT_KIND_TTF;
+    } else if (size > 0) {
+        // 缩放只在流式字体的字形缓存中进行，整体载入和分区映射的字体不经过缓存
+        e->font = font_stream_create_scaled(path, size);
+        e->kind = FONT_KIND_STREAM;
+    } else if ((e->font = font_load_by_index(index)) != NULL) {
+        e->kind = FONT_KIND_MEMORY;
+    } else if ((e->font = font_partition_open(path, &e->mmap_handle)) != NULL) {
+        e->kind = FONT_KIND_MAPPED;
+    } else {
+        ESP_LOGW(TAG, "Memory load failed for %s, trying stream loading...", path);
+        e->font = font_stream_create(path);
+        e->kind = FONT_KIND_STREAM;
+    }
+    if (e->font == NULL) {
+        return false;
+    }
+    strncpy(e->path, path, sizeof(e->path) - 1);
+    e->size = size;
+    return true;
+}
+
+lv_font_t *font_manager_acquire_font(int index)
+{
+    if (index < 0 || index >= font_loader_get_font_count()) {
+        ESP_LOGE(TAG, "Invalid font index: %d (count=%d)", index, font_loader_get_font_count());
+        return NULL;
+    }
+    const char *path = font_loader_get_font_list()[index].file_path;
+    const int size = font_ttf_is_ttf_path(path) ? s_ttf_size : s_scaled_size;
+
+    // 已打开（包括保温中的）：共用同一个字体对象与字形缓存
+    font_entry_t *slot = NULL;
+    for (int i = 0; i < MAX_OPEN_FONTS; i++) {
+        font_entry_t *e = &s_open_fonts[i];
+        if (e->font != NULL && e->size == size && strcmp(e->path, path) == 0) {
+            e->refs++;
+            e->last_use = ++s_font_use_clock;
+            return e->font;
+        }
+        if (e->font == NULL && slot == NULL) {
+            slot = e;
+        }
+    }
+    if (slot == NULL) {
+        if (!close_idle_font()) {
+            ESP_LOGE(TAG, "Too many fonts in use (%d)", MAX_OPEN_FONTS);
+            return NULL;
+        }
+        return font_manager_acquire_font(index);
+    }
+
+    // 打开失败多半是内存不够：逐个关闭保温中的字体再试
+    while (!open_entry(slot, index, path, size)) {
+        memset(slot, 0, sizeof(*slot));
+        if (!close_idle_font()) {
+            ESP_LOGE(TAG, "Failed to open font: %s", path);
+            return NULL;
+        }
+    }
+    slot->refs = 1;
+    slot->last_use = ++s_font_use_clock;
+    ESP_LOGI(TAG, "Font opened (%s): %s", font_kind_name(slot->kind), path);
+    return slot->font;
+}
+
+void font_manager_release_font(lv_font_t *font)
+{
+    font_entry_t *e = find_entry_by_font(font);
+    if (e != NULL && e->refs > 0) {
+        e->refs--;
+    }
+}
+
+// 把已取得引用的 font 设为当前字体，放掉之前持有的引用（旧字体留在注册表里保温）
+static void hold_current_font(lv_font_t *font)
+{
+    lv_font_t *previous = s_held_font;
+    s_held_font = font;
+    font_loader_set_current_font(font);
+    font_manager_release_font(previous);
+}
 
 bool font_manager_init(void)
 {
@@ -43,14 +461,104 @@ bool font_manager_init(void)
         // 即使失败也继续，使用默认字体
     }
 
-    // 扫描字体文件
-    int font_count = font_loader_scan_fonts();
-    ESP_LOGI(TAG, "Found %d font(s)", font_count);
-
+    // 字体目录的扫描见 font_manager_start_background_scan()
     s_manager_initialized = true;
     return true;
 }
 
+// ---------------------------------------------------------------------------
+// 后台扫描：首屏显示后作为后台作业扫描字体目录，结果交给 LVGL 任务中的定时器
+// 装入字体列表并应用 NVS 中保存的字体选择
+// ---------------------------------------------------------------------------
+
+#define FONT_SCAN_POLL_MS 100
+
+static font_info_t *s_scan_fonts = NULL;
+static volatile int s_scan_count = -1;      // >= 0：后台扫描已完成
+static lv_timer_t *s_scan_timer = NULL;
+
+// 一步完成：扫描本身主要在等 SD 卡，工作任务优先级最低，不会拖慢前台
+static bool font_scan_step(bg_job_t *job, void *arg)
+{
+    (void)job;
+    (void)arg;
+    s_scan_count = font_loader_collect_fonts(s_scan_fonts, MAX_FONTS, true);
+    lvgl_timer_task_wake();
+    return false;
+}
+
+static void font_scan_timer_cb(lv_timer_t *timer)
+{
+    if (s_scan_count < 0) {
+        return;
+    }
+    lv_timer_delete(timer);
+    s_scan_timer = NULL;
+
+    font_loader_install_fonts(s_scan_fonts, s_scan_count);
+    ESP_LOGI(TAG, "Background scan: %d font(s)", s_scan_count);
+    free(s_scan_fonts);
+    s_scan_fonts = NULL;
+    s_scan_count = -1;
+
+    if (font_loader_get_font_count() > 0) {
+        font_manager_load_selection();
+        // 已创建的控件按新字体的行高重新排版（下一次渲染时生效）
+        lv_obj_report_style_change(NULL);
+    }
+}
+
+bool font_manager_start_background_scan(void)
+{
+    if (!s_manager_initialized || s_scan_timer != NULL) {
+        return false;
+    }
+    s_scan_fonts = (font_info_t *)malloc(sizeof(font_info_t) * MAX_FONTS);
+    if (s_scan_fonts == NULL) {
+        ESP_LOGE(TAG, "No memory for font scan");
+        return false;
+    }
+    s_scan_count = -1;
+    const bg_job_desc_t job = {
+        .name = "font_scan",
+        .prio = BG_JOB_PRIO_NORMAL,
+        .step = font_scan_step,
+    };
+    s_scan_timer = lv_timer_create(font_scan_timer_cb, FONT_SCAN_POLL_MS, NULL);
+    if (s_scan_timer == NULL || bg_jobs_submit(&job) == BG_JOB_NONE) {
+        ESP_LOGE(TAG, "Failed to start font scan");
+        if (s_scan_timer != NULL) {
+            lv_timer_delete(s_scan_timer);
+            s_scan_timer = NULL;
+        }
+        free(s_scan_fonts);
+        s_scan_fonts = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool font_manager_scan_now(void)
+{
+    if (!s_manager_initialized || s_scan_timer != NULL) {
+        return false;
+    }
+    font_info_t *fonts = (font_info_t *)malloc(sizeof(font_info_t) * MAX_FONTS);
+    if (fonts == NULL) {
+        ESP_LOGE(TAG, "No memory for font scan");
+        return false;
+    }
+    const int count = font_loader_collect_fonts(fonts, MAX_FONTS, true);
+    font_loader_install_fonts(fonts, count);
+    ESP_LOGI(TAG, "Synchronous scan: %d font(s)", count);
+    free(fonts);
+
+    if (font_loader_get_font_count() > 0) {
+        font_manager_load_selection();
+    }
+    return true;
+}
+
 void font_manager_load_selection(void)
 {
     if (!s_manager_initialized) {
@@ -59,6 +567,7 @@ void font_manager_load_selection(void)
     }
 
     ESP_LOGI(TAG, "Loading font selection from NVS...");
+    router_invalidate();
 
     // 重要：不要重新扫描字体！直接使用已扫描的字体列表
     // font_loader_scan_fonts() 会重置已扫描的结果，导致字体丢失
@@ -75,63 +584,22 @@ void font_manager_load_selection(void)
         ESP_LOGW(TAG, "No SD card fonts, trying built-in Chinese font...");
         const lv_font_t *chinese = font_loader_get_builtin_chinese_font();
         if (chinese != NULL) {
-            font_loader_set_current_font((lv_font_t *)chinese);
+            hold_current_font((lv_font_t *)chinese);
             s_current_font_index = -2;  // -2 表示内置中文字体
             ESP_LOGI(TAG, "Using built-in Chinese font");
             return;
         }
         // 内置字体也失败，使用默认字体
         ESP_LOGW(TAG, "No fonts available, using default (English only)");
-        font_loader_set_current_font(NULL);
+        hold_current_font(NULL);
         s_current_font_index = -1;
         return;
     }
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "No saved font selection found (NVS open failed: 0x%x), using first available font", err);
-        // 尝试使用第一个SD卡字体，而不是默认的montserrat
-        if (font_count > 0) {
-            font_manager_set_font_by_index(0);
-            ESP_LOGI(TAG, "Using first SD card font: %s",
-                     ((const font_info_t*)font_loader_get_font_list())[0].name);
-        } else {
-            // 没有SD卡字体，尝试内置中文字体
-            const lv_font_t *chinese = font_loader_get_builtin_chinese_font();
-            if (chinese != NULL) {
-                font_loader_set_current_font((lv_font_t *)chinese);
-                s_current_font_index = -2;
-                ESP_LOGI(TAG, "Using built-in Chinese font");
-            } else {
-                // 最后才使用默认字体（不支持中文）
-                font_loader_set_current_font(NULL);
-                s_current_font_index = -1;
-                ESP_LOGW(TAG, "Using default font (montserrat - Chinese not supported)");
-            }
-        }
-        return;
-    }
-
-    // 读取保存的字体索引
-    int32_t saved_index = -1;
-    err = nvs_get_i32(nvs_handle, NVS_KEY_CURRENT_FONT, &saved_index);
-    nvs_close(nvs_handle);
-
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "No saved font index found (0x%x), using default Chinese font", err);
-        // 默认使用第一个字体（方正屏显雅宋简体）
-        if (font_count > 0) {
-            font_manager_set_font_by_index(0);
-            ESP_LOGI(TAG, "Using default font: %s",
-                     ((const font_info_t*)font_loader_get_font_list())[0].name);
-        } else {
-            font_loader_set_current_font(NULL);
-            s_current_font_index = -1;
-        }
-        return;
-    }
+    // 字体索引与 TrueType 字号在开机时已随设置读入内存（settings_store）
+    const int32_t saved_index = settings_get_int(SETTING_FONT_INDEX);
+    s_ttf_size = (int)settings_get_int(SETTING_TTF_SIZE);
+    s_scaled_size = (int)settings_get_int(SETTING_SCALED_FONT_SIZE);
 
     ESP_LOGI(TAG, "Saved font index: %ld", saved_index);
 
@@ -143,7 +611,7 @@ void font_manager_load_selection(void)
         if (font_count > 0) {
             font_manager_set_font_by_index(0);
         } else {
-            font_loader_set_current_font(NULL);
+            hold_current_font(NULL);
             s_current_font_index = -1;
         }
         return;
@@ -179,7 +647,7 @@ void font_manager_load_selection(void)
 
         if (!found) {
             ESP_LOGE(TAG, "No usable font found!");
-            font_loader_set_current_font(NULL);
+            hold_current_font(NULL);
             s_current_font_index = -1;
         }
     }
@@ -192,30 +660,12 @@ void font_manager_save_selection(void)
         return;
     }
 
-    ESP_LOGI(TAG, "Saving font selection to NVS (index=%d)...", s_current_font_index);
-
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS: 0x%x", err);
-        return;
-    }
-
-    err = nvs_set_i32(nvs_handle, NVS_KEY_CURRENT_FONT, s_current_font_index);
-
-    if (err == ESP_OK) {
-        err = nvs_commit(nvs_handle);
-        if (err == ESP_OK) {
-            ESP_LOGI(TAG, "Font selection saved successfully");
-        } else {
-            ESP_LOGE(TAG, "Failed to commit NVS: 0x%x", err);
-        }
-    } else {
-        ESP_LOGE(TAG, "Failed to set NVS value: 0x%x", err);
-    }
+    ESP_LOGI(TAG, "Saving font selection (index=%d)...", s_current_font_index);
 
-    nvs_close(nvs_handle);
+    // 只写内存，settings_store 合并后写入 NVS
+    settings_set_int(SETTING_FONT_INDEX, s_current_font_index);
+    settings_set_int(SETTING_TTF_SIZE, s_ttf_size);
+    settings_set_int(SETTING_SCALED_FONT_SIZE, s_scaled_size);
 }
 
 lv_font_t* font_manager_get_font(void)
@@ -226,6 +676,12 @@ lv_font_t* font_manager_get_font(void)
     }
 
     lv_font_t *font = font_loader_get_current_font();
+    if (font != NULL) {
+        if (font != s_router_primary) {
+            router_bind(font);
+        }
+        font = &s_router_font;
+    }
     // 只在第一次调用时打印日志（使用静态变量）
     static bool logged = false;
     if (!logged) {
@@ -248,55 +704,26 @@ bool font_manager_set_font_by_index(int index)
         ESP_LOGE(TAG, "Invalid font index: %d (count=%d)", index, font_count);
         return false;
     }
+    router_invalidate();
 
-    const font_info_t *font_list = font_loader_get_font_list();
-    const char *font_path = font_list[index].file_path;
-    const char *font_name = font_list[index].name;
-
-    // 1. 首先尝试普通加载（小字体）
+    const char *font_name = font_loader_get_font_list()[index].name;
     ESP_LOGI(TAG, "Attempting to load font: %s", font_name);
-    lv_font_t *font = font_load_by_index(index);
-    if (font != NULL) {
-        // 成功普通加载
-        font_loader_set_current_font(font);
-        s_current_font_index = index;
-        s_stream_font_path[0] = '\0';
-        ESP_LOGI(TAG, "Font loaded (memory): %s", font_name);
-        return true;
-    }
 
-    // 2. 普通加载失败，尝试流式加载（大字体）
-    ESP_LOGW(TAG, "Memory load failed for %s, trying stream loading...", font_name);
-
-    // 检查是否已经是同一个流式字体
-    if (s_stream_font != NULL && strcmp(s_stream_font_path, font_path) == 0) {
-        ESP_LOGI(TAG, "Using cached stream font: %s", font_name);
-        font_loader_set_current_font(s_stream_font);
-        s_current_font_index = index;
-        return true;
-    }
-
-    // 销毁旧的流式字体
-    if (s_stream_font != NULL) {
-        font_stream_destroy(s_stream_font);
-        s_stream_font = NULL;
+    lv_font_t *font = font_manager_acquire_font(index);
+    if (font == NULL && s_held_font != NULL) {
+        // 放掉当前字体腾出内存再试一次
+        hold_current_font(NULL);
+        s_current_font_index = -1;
+        font = font_manager_acquire_font(index);
     }
-
-    // 创建新的流式字体
-    s_stream_font = font_stream_create(font_path);
-    if (s_stream_font == NULL) {
+    if (font == NULL) {
         ESP_LOGE(TAG, "Failed to load font at index %d: %s", index, font_name);
         return false;
     }
 
-    // 保存路径
-    strncpy(s_stream_font_path, font_path, sizeof(s_stream_font_path) - 1);
-
-    // 设置为当前字体
-    font_loader_set_current_font(s_stream_font);
+    hold_current_font(font);
     s_current_font_index = index;
-
-    ESP_LOGI(TAG, "Font loaded (stream): %s", font_name);
+    ESP_LOGI(TAG, "Font set: %s", font_name);
     return true;
 }
 
@@ -306,7 +733,12 @@ void font_manager_set_font(lv_font_t *font)
         return;
     }
 
-    font_loader_set_current_font(font);
+    // 注册表中的字体需要自己的引用
+    font_entry_t *e = find_entry_by_font(font);
+    if (e != NULL) {
+        e->refs++;
+    }
+    hold_current_font(font);
 
     // 更新索引
     if (font == font_loader_get_default_font()) {
@@ -357,11 +789,12 @@ void font_manager_cleanup(void)
     // 保存当前选择
     font_manager_save_selection();
 
-    // 清理流式字体
-    if (s_stream_font != NULL) {
-        font_stream_destroy(s_stream_font);
-        s_stream_font = NULL;
-        s_stream_font_path[0] = '\0';
+    // 关闭注册表中的所有字体
+    hold_current_font(NULL);
+    for (int i = 0; i < MAX_OPEN_FONTS; i++) {
+        if (s_open_fonts[i].font != NULL) {
+            close_entry(&s_open_fonts[i]);
+        }
     }
 
     // 清理字体加载器
@@ -396,5 +829,84 @@ bool font_manager_load_font_by_path(const char *file_path)
 
 const char *font_manager_get_stream_font_path(void)
 {
-    return s_stream_font_path;
+    const font_entry_t *e = find_entry_by_font(s_held_font);
+    return e != NULL && e->kind != FONT_KIND_MEMORY ? e->path : "";
+}
+
+int font_manager_get_ttf_size(void)
+{
+    return s_ttf_size;
+}
+
+bool font_manager_set_ttf_size(int size)
+{
+    if (size < FONT_TTF_SIZE_MIN) {
+        size = FONT_TTF_SIZE_MIN;
+    } else if (size > FONT_TTF_SIZE_MAX) {
+        size = FONT_TTF_SIZE_MAX;
+    }
+    if (size == s_ttf_size) {
+        return true;
+    }
+    s_ttf_size = size;
+
+    // 当前是 TrueType 字体时按新字号重新打开
+    const font_entry_t *e = find_entry_by_font(s_held_font);
+    if (s_manager_initialized && e != NULL && e->kind == FONT_KIND_TTF && s_current_font_index >= 0) {
+        return font_manager_set_font_by_index(s_current_font_index);
+    }
+    return true;
+}
+
+int font_manager_get_scaled_size(void)
+{
+    return s_scaled_size;
+}
+
+bool font_manager_set_scaled_size(int size)
+{
+    if (size <= 0) {
+        size = 0;
+    } else if (size < FONT_TTF_SIZE_MIN) {
+        size = FONT_TTF_SIZE_MIN;
+    } else if (size > FONT_TTF_SIZE_MAX) {
+        size = FONT_TTF_SIZE_MAX;
+    }
+    if (size == s_scaled_size) {
+        return true;
+    }
+    s_scaled_size = size;
+    settings_set_int(SETTING_SCALED_FONT_SIZE, s_scaled_size);
+
+    // 当前是 SD 卡上的位图字体时按新字号重新打开（原字号的字体保温在注册表中）
+    const font_entry_t *e = find_entry_by_font(s_held_font);
+    if (s_manager_initialized && e != NULL && e->kind != FONT_KIND_TTF && s_current_font_index >= 0) {
+        return font_manager_set_font_by_index(s_current_font_index);
+    }
+    return true;
+}
+
+const lv_font_t *font_manager_get_primary_font(const lv_font_t *font)
+{
+    if (font == &s_router_font) {
+        // 子集字体在链首时由它量宽（内存中查表），子集里没有的字返回 -1 后再走回退链
+        return s_router_primary != NULL ? s_chain[0] : NULL;
+    }
+    return font;
+}
+
+void font_manager_set_subset_font(const lv_font_t *subset, const lv_font_t *base)
+{
+    s_subset_font = subset;
+    s_subset_base = subset != NULL ? base : NULL;
+    // 立即重建链并清空路由缓存：已路由到当前字体的码点改查子集，撤下时不再指向子集
+    if (s_router_primary != NULL) {
+        router_bind(s_router_primary);
+    }
+}
+
+bool font_manager_current_is_streamed(void)
+{
+    const font_entry_t *e = find_entry_by_font(s_held_font);
+    return e != NULL && (e->kind == FONT_KIND_STREAM || e->kind == FONT_KIND_TTF);
 }
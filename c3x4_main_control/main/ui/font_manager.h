@@ -13,34 +13,102 @@
  *      DEFINES
  *********************/
 #define FONT_MANAGER_DEFAULT_DIR "/sdcard/字体"
-#define NVS_KEY_CURRENT_FONT "current_font"
+#define NVS_KEY_CURRENT_FONT "current_font"  // 旧版本的 NVS 键，settings_store 迁移时读取
+#define NVS_KEY_TTF_SIZE "ttf_size"
+#define FONT_MANAGER_TTF_SIZE_DEFAULT 24    // TrueType 字体的默认字号（像素）
+
+// 字体分区：前部放选用的整个大字体，末尾 FONT_MANAGER_SUBSET_REGION 字节放书籍子集字体
+// （font_subset.h），整字体复制只能用前面的部分
+#define FONT_MANAGER_PARTITION_LABEL "fonts"
+#define FONT_MANAGER_SUBSET_REGION (512 * 1024)
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 /**
- * @brief 初始化字体管理器
+ * @brief 初始化字体管理器（不扫描字体目录，此时只有内置字体可用）
  * @return true 成功，false 失败
  */
 bool font_manager_init(void);
 
 /**
- * @brief 从 NVS 加载保存的字体选择
+ * @brief 在后台任务中扫描字体目录（首屏显示后调用）
+ *
+ * 扫描完成后在 LVGL 任务中装入字体列表，并重新应用 NVS 中保存的字体选择
+ *
+ * @return true 已开始扫描
+ */
+bool font_manager_start_background_scan(void);
+
+/**
+ * @brief 立即扫描字体目录并应用保存的字体选择（阻塞，首页以外的首屏使用）
+ *
+ * 开机直接恢复阅读页时，第一页必须用保存的字体排版，否则与面板上的画面不一致
+ *
+ * @return true 已扫描（之后不需要再调用 font_manager_start_background_scan）
+ */
+bool font_manager_scan_now(void);
+
+/**
+ * @brief 按保存的设置（settings_store）选择字体
  */
 void font_manager_load_selection(void);
 
 /**
- * @brief 保存当前字体选择到 NVS
+ * @brief 保存当前字体选择（写入设置，延迟写入 NVS）
  */
 void font_manager_save_selection(void);
 
 /**
  * @brief 获取当前应用的字体
- * @return 当前字体指针
+ *
+ * 返回回退链的链首：当前字体缺的字形依次从内置中文字体、Montserrat 取，
+ * 每个码点由哪个字体提供记在路由缓存里
+ *
+ * @return 当前字体指针（没有可用字体时返回 NULL）
  */
 lv_font_t* font_manager_get_font(void);
 
+/**
+ * @brief 取得字体列表中第 index 个字体的引用（在 LVGL 任务中调用）
+ *
+ * 同一文件（TrueType 为同一文件同一字号）在各界面间共用一个字体对象和字形缓存；
+ * 引用全部放掉后字体仍保持打开，直到需要腾出槽位或内存
+ *
+ * @param index 字体索引（0 ~ font_count-1）
+ * @return 字体指针，失败返回 NULL；用完调用 font_manager_release_font()
+ */
+lv_font_t *font_manager_acquire_font(int index);
+
+/**
+ * @brief 放掉 font_manager_acquire_font() 取得的引用（其他字体忽略）
+ */
+void font_manager_release_font(lv_font_t *font);
+
+/**
+ * @brief 取回退链中的当前字体本身（流式字体预取等需要识别具体字体类型的场合）
+ * @param font font_manager_get_font() 返回的字体或其他任意字体
+ * @return 链首时返回当前字体（有书籍子集字体时返回子集字体），否则原样返回
+ */
+const lv_font_t *font_manager_get_primary_font(const lv_font_t *font);
+
+/**
+ * @brief 把书籍子集字体插到回退链最前面（NULL 取消）
+ *
+ * 子集字体中没有的字照常由当前字体和后面的回退字体提供。只在当前字体仍是 base 时生效，
+ * 换字体或字号后自动退出回退链；font_manager 不持有子集字体，销毁前先取消
+ *
+ * @param subset font_stream_create_mapped() 打开的子集字体
+ * @param base 建立子集时的当前字体（font_manager_get_primary_font 之前的原字体）
+ */
+void font_manager_set_subset_font(const lv_font_t *subset, const lv_font_t *base);
+
+/**
+ * @brief 当前字体的字形是否要从 SD 卡读（流式位图字体或 TrueType）
+ */
+bool font_manager_current_is_streamed(void);
+
 /**
  * @brief 设置当前字体（通过索引）
  * @param index 字体索引
@@ -90,4 +158,39 @@ bool font_manager_load_font_by_path(const char *file_path);
  */
 const char *font_manager_get_stream_font_path(void);
 
+/**
+ * @brief 获取 TrueType 字体（.ttf/.otf）使用的字号
+ * @return 字号（像素）
+ */
+int font_manager_get_ttf_size(void);
+
+/**
+ * @brief 设置 TrueType 字体的字号（限制在 FONT_TTF_SIZE_MIN ~ FONT_TTF_SIZE_MAX）
+ *
+ * 当前字体是 TrueType 时立即按新字号重新打开；每个字号各有一个字形缓存文件，
+ * 随 font_manager_save_selection() 保存到 NVS
+ *
+ * @param size 字号（像素）
+ * @return true 成功，false 重新打开字体失败
+ */
+bool font_manager_set_ttf_size(int size);
+
+/**
+ * @brief 获取位图字体（.bin）的合成字号
+ * @return 字号（像素），0 表示用字体文件的原始字号
+ */
+int font_manager_get_scaled_size(void);
+
+/**
+ * @brief 设置位图字体的合成字号（0 或 FONT_TTF_SIZE_MIN ~ FONT_TTF_SIZE_MAX）
+ *
+ * 非 0 时位图字体改为流式读取，字形进缓存时从字体文件（母版）按面积平均缩小到该字号；
+ * 字号不小于母版行高时仍用原始字形。当前字体是位图字体时立即按新字号重新打开，
+ * 随设置保存
+ *
+ * @param size 字号（像素）
+ * @return true 成功，false 重新打开字体失败
+ */
+bool font_manager_set_scaled_size(int size);
+
 #endif // FONT_MANAGER_H
@@ -5,12 +5,19 @@
  * 通过自定义回调从文件流按需读取字形数据：
  * 1. 只加载字体头信息（几 KB）
  * 2. 按需从文件读取字形位图
- * 3. 使用 LRU 缓存管理字形位图
+ * 3. 字形描述符与位图放进哈希表 + LRU 链表缓存，大小按打开时的堆余量决定；
+ *    位图放在打开字体时一次分配的分级块区中，渲染时不再 malloc/free
+ * 4. 位图进缓存时从文件的 bpp 转为 A1，缓存与渲染只处理 1 位字形
+ * 5. 分块压缩的字体（FONT_STREAM_FLAG_BLOCKS）缓存解压后的整块，字形位图从块中取
  */
 
 #include "font_stream.h"
+#include "flash_cache.h"
+#include "file_pool.h"
+#include "heap_stats.h"
+#include "lz_block.h"
+#include "mem_pressure.h"
 #include "esp_log.h"
-#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include <string.h>
 #include <stdio.h>
@@ -18,20 +25,73 @@
 
 static const char *TAG = "FONT_STREAM";
 
-// 字形缓存项
+// 字形缓存项：描述符与位图一起缓存，命中时不访问文件
 typedef struct {
     uint32_t unicode;          // Unicode 码点
-    uint8_t *bitmap;           // 位图数据
-    uint16_t bitmap_size;      // 位图大小
-    uint16_t stride;           // 行 stride
-    bool used;                 // 是否使用
-    uint32_t last_access;      // 最后访问时间
+    uint8_t *bitmap;           // A1 位图（NULL：空白字形或读取失败）
+    uint16_t bitmap_size;      // 缓存中 A1 位图的大小
+    uint16_t src_size;         // 文件中位图的大小（按字体的 bpp）
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t src_w;             // 缩放字体：文件中母版字形的尺寸（未缩放时不用）
+    uint8_t src_h;
+    uint32_t bitmap_offset;    // 位图在位图表中的偏移
+    uint16_t prev;             // LRU 链表：prev 指向更近使用的项
+    uint16_t next;             // LRU 链表 / 空闲链表
+    bool missing;              // 字体中没有该字符（同样缓存，避免反复查 cmap）
+    bool bitmap_pending;       // 描述符已缓存、位图尚未读入（批量预取时位图区不够）
+    bool pinned;               // 批量预取进行中，不可淘汰
 } stream_glyph_t;
 
+#define GLYPH_NONE 0xFFFF
+
+// 位图块尺寸级别（约 1.5 倍递增，同一字体的字形大小相近，浪费不超过三分之一）
+static const uint16_t s_glyph_class_size[] = {
+    16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048,
+};
+#define GLYPH_CLASS_COUNT (sizeof(s_glyph_class_size) / sizeof(s_glyph_class_size[0]))
+#define GLYPH_CLASS_FREE 0xFF
+#define GLYPH_ARENA_PAGE 2048        // 页大小 = 最大块（更大的字形不缓存位图）
+#define GLYPH_ARENA_MAX_PAGES 128
+#define GLYPH_ARENA_MIN_PAGES 4
+
+// 内存中的 cmap：码点与字形序号同步递增的连续段（CJK 区块）存为区间，
+// 其余零散字符存为有序的单点表
+typedef struct {
+    uint32_t first;            // 区间第一个码点
+    uint32_t glyph;            // 对应的字形序号
+    uint32_t count;            // 区间长度
+} cmap_range_t;
+
+typedef struct {
+    uint32_t codepoint;
+    uint32_t glyph;
+} cmap_point_t;
+
+#define CMAP_RANGE_MIN 4       // 不短于此的连续段存为区间
+#define CMAP_READ_CHUNK 64     // 打开时每次读取的 cmap 条目数
+
+#define ADV_TABLE_HEAP_SHARE 8    // 前进宽度表最多占打开字体时堆余量的 1/N
+#define BLOCK_CACHE_HEAP_SHARE 8  // 解压块缓存最多占打开字体时堆余量的 1/N
+
+// 批量预取：一批未命中的字形按文件偏移排序后合并读取
+#define PREFETCH_BATCH 128     // 每批最多字形数（另受缓存槽数一半的限制）
+#define PREFETCH_IO_SIZE 2048  // 一次合并读取的最大跨度（字节）
+#define FONT_STDIO_BUF 512     // FILE 缓冲 = 一个扇区：单个字形读取只访问一次 SD 卡
+
+typedef struct {
+    uint32_t key;              // 排序键：先按字形序号读描述符，再按位图偏移读位图
+    uint16_t slot;
+} prefetch_item_t;
+
 // 流式字体上下文（存储在 lv_font_t.user_data 中）
 typedef struct {
     FILE *fp;                          // 文件指针
     uint32_t file_size;                // 文件大小
+    uint32_t cache_id;                 // flash 热块缓存中的文件身份
     char file_path[256];               // 文件路径
 
     // 字体头信息
@@ -40,177 +100,1177 @@ typedef struct {
     uint8_t bpp;
     uint8_t cmap_num;
 
+    // 缩放：目标字号 / 母版行高（scale_den 为 0 时按原始字号）。上面的字体头与前进宽度表
+    // 都是母版的值，字形描述符与 A1 位图进缓存时才换算
+    uint16_t scale_num;
+    uint16_t scale_den;
+
     // 文件偏移
     uint32_t cmap_offset;
     uint32_t glyph_dsc_offset;
     uint32_t glyph_bitmap_offset;
 
-    // 字形缓存
-    stream_glyph_t glyph_cache[GLYPH_CACHE_SIZE];
-    uint32_t cache_access_counter;
+    // 内存中的 cmap（打开时载入；内存不足时为 NULL，退回逐次在文件中二分查找）
+    cmap_range_t *cmap_ranges;
+    cmap_point_t *cmap_points;
+    uint32_t *cmap_range_start;        // 第 i 个 cmap 的区间为 [start[i], start[i + 1])
+    uint32_t *cmap_point_start;
+
+    // 前进宽度表：字形序号 -> 宽度 + 1（0 为尚未读取），排版量宽时不用进字形缓存；
+    // 读到描述符时顺手填入。内存不足时为 NULL
+    uint8_t *adv_table;
+    uint32_t adv_count;
+
+    // 字形缓存：槽数组 + 开放寻址哈希表（线性探测，存槽序号 + 1，0 为空）
+    // + 侵入式 LRU 双向链表，查找与淘汰都是 O(1)
+    stream_glyph_t *glyphs;
+    uint16_t *glyph_table;
+    uint16_t glyph_capacity;           // 槽数（打开时按堆余量决定）
+    uint16_t glyph_count;              // 已用槽数
+    uint16_t table_mask;               // 哈希表大小 - 1（大小为 2 的幂，至少 2 倍槽数）
+    uint16_t lru_head;                 // 最近使用
+    uint16_t lru_tail;                 // 最久未用
+    uint16_t free_head;                // 空闲槽链表
+    uint32_t bitmap_bytes;             // 缓存位图总字节数
+    uint32_t bitmap_budget;            // 位图字节上限（= 位图区大小）
+    uint32_t lookups;                  // 渲染时的字形查询次数
+    uint32_t hits;                     // 其中描述符与位图都已在缓存中的次数
+
+    // 位图区：打开字体时一次分配，按页切给各尺寸级别，页内是等大的块。缓存只在区内
+    // 分配与淘汰，渲染时不再 malloc/free，不会把堆切碎（SD 卡 SPI DMA 缓冲区需要
+    // 整块内存）
+    uint8_t *arena;
+    uint16_t arena_pages;
+    uint8_t page_class[GLYPH_ARENA_MAX_PAGES];   // 页分给的尺寸级别，GLYPH_CLASS_FREE 为空闲页
+    uint16_t page_used[GLYPH_ARENA_MAX_PAGES];   // 页内已用块数
+    uint8_t *class_free[GLYPH_CLASS_COUNT];      // 各级别的空闲块链表（块首存下一块指针）
+
+    // 分块压缩的位图表：块索引常驻内存，解压后的块按 LRU 缓存（block_count 为 0：未分块）
+    uint32_t *block_offsets;           // block_count + 1 项，相对位图表起点
+    uint32_t block_count;
+    uint32_t block_raw_size;           // 解压后位图流的总长度
+    uint16_t block_size;
+    uint8_t block_slots;
+    uint8_t *block_data;               // block_slots 个块
+    uint8_t *block_packed;             // 读入压缩块的缓冲区
+    uint32_t block_id[FONT_BLOCK_CACHE_MAX];   // 各槽中的块号（UINT32_MAX 为空）
+    uint32_t block_use[FONT_BLOCK_CACHE_MAX];  // 最近使用时间
+    uint32_t block_clock;
+    uint32_t block_loads;
+
+    // 批量预取的工作区（打开时随上下文分配，预取时不再申请内存）
+    prefetch_item_t prefetch_items[PREFETCH_BATCH];
+    uint8_t prefetch_io[PREFETCH_IO_SIZE];
 
     // 当前字形的位图（用于 get_glyph_bitmap）
     const uint8_t *current_bitmap;
 } stream_font_ctx_t;
 
-// 字形描述符大小
-#define GLYPH_DSC_SIZE 24
+// 母版像素换算到目标字号（四舍五入，负数对称）
+static int scale_px(const stream_font_ctx_t *ctx, int v)
+{
+    if (ctx->scale_den == 0) {
+        return v;
+    }
+    const int half = ctx->scale_den / 2;
+    return v >= 0 ? (v * ctx->scale_num + half) / ctx->scale_den
+                  : -((-v * ctx->scale_num + half) / ctx->scale_den);
+}
 
-/**
- * @brief 字体文件头结构
- */
-typedef struct __attribute__((packed)) {
-    uint32_t version;
-    uint32_t magic;
-    uint16_t line_height;
-    uint16_t base_line;
-    uint8_t bpp;
-    uint8_t cmap_num;
-    uint16_t kern_classes;
-    uint8_t bitmap_format;
-    uint8_t flags;
-    uint32_t cmap_list_offset;
-    uint32_t glyph_dsc_offset;
-    uint32_t glyph_bitmap_offset;
-} lv_font_bin_header_t;
+static uint32_t glyph_hash(const stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    return (unicode * 2654435761u >> 16) & ctx->table_mask;
+}
 
-/**
- * @brief cmap 头部结构
- */
-typedef struct __attribute__((packed)) {
-    uint32_t type;
-    uint32_t entries;
-} lv_font_cmap_header_t;
+// 哈希表中的位置，未找到返回 -1
+static int table_find(const stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    for (uint32_t pos = glyph_hash(ctx, unicode);; pos = (pos + 1) & ctx->table_mask) {
+        const uint16_t slot = ctx->glyph_table[pos];
+        if (slot == 0) {
+            return -1;
+        }
+        if (ctx->glyphs[slot - 1].unicode == unicode) {
+            return (int)pos;
+        }
+    }
+}
 
-/**
- * @brief cmap 条目
- */
-typedef struct __attribute__((packed)) {
-    uint32_t codepoint;
-    uint32_t glyph_index;
-} lv_font_cmap_entry_t;
+static void table_insert(stream_font_ctx_t *ctx, uint16_t index)
+{
+    uint32_t pos = glyph_hash(ctx, ctx->glyphs[index].unicode);
+    while (ctx->glyph_table[pos] != 0) {
+        pos = (pos + 1) & ctx->table_mask;
+    }
+    ctx->glyph_table[pos] = index + 1;
+}
 
-/**
- * @brief 字形描述符
- */
-typedef struct __attribute__((packed)) {
-    uint32_t codepoint;
-    uint16_t advance_x;
-    uint16_t box_w;
-    uint16_t box_h;
-    int16_t ofs_x;
-    int16_t ofs_y;
-    uint32_t bitmap_offset;
-} lv_font_glyph_dsc_bin_t;
+// 删除后把探测链上后面的项前移（不用墓碑，表不会随时间退化）
+static void table_remove(stream_font_ctx_t *ctx, uint32_t pos)
+{
+    uint32_t next = pos;
+    for (;;) {
+        next = (next + 1) & ctx->table_mask;
+        const uint16_t slot = ctx->glyph_table[next];
+        if (slot == 0) {
+            break;
+        }
+        const uint32_t home = glyph_hash(ctx, ctx->glyphs[slot - 1].unicode);
+        // home 不在 (pos, next] 区间内时，该项可以移到 pos
+        const bool movable = (next > pos) ? (home <= pos || home > next)
+                                          : (home <= pos && home > next);
+        if (movable) {
+            ctx->glyph_table[pos] = slot;
+            pos = next;
+        }
+    }
+    ctx->glyph_table[pos] = 0;
+}
+
+static void lru_unlink(stream_font_ctx_t *ctx, uint16_t index)
+{
+    stream_glyph_t *glyph = &ctx->glyphs[index];
+    if (glyph->prev != GLYPH_NONE) {
+        ctx->glyphs[glyph->prev].next = glyph->next;
+    } else {
+        ctx->lru_head = glyph->next;
+    }
+    if (glyph->next != GLYPH_NONE) {
+        ctx->glyphs[glyph->next].prev = glyph->prev;
+    } else {
+        ctx->lru_tail = glyph->prev;
+    }
+}
+
+static void lru_push_front(stream_font_ctx_t *ctx, uint16_t index)
+{
+    stream_glyph_t *glyph = &ctx->glyphs[index];
+    glyph->prev = GLYPH_NONE;
+    glyph->next = ctx->lru_head;
+    if (ctx->lru_head != GLYPH_NONE) {
+        ctx->glyphs[ctx->lru_head].prev = index;
+    } else {
+        ctx->lru_tail = index;
+    }
+    ctx->lru_head = index;
+}
+
+// 能放下 size 字节的最小级别，放不下返回 -1
+static int arena_class(uint16_t size)
+{
+    for (int i = 0; i < (int)GLYPH_CLASS_COUNT; i++) {
+        if (s_glyph_class_size[i] >= size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t *arena_alloc(stream_font_ctx_t *ctx, int cls)
+{
+    if (ctx->class_free[cls] == NULL) {
+        // 取一个空闲页切成本级别的块
+        int page = -1;
+        for (int i = 0; i < ctx->arena_pages; i++) {
+            if (ctx->page_class[i] == GLYPH_CLASS_FREE) {
+                page = i;
+                break;
+            }
+        }
+        if (page < 0) {
+            return NULL;
+        }
+        const uint16_t block = s_glyph_class_size[cls];
+        uint8_t *base = ctx->arena + (size_t)page * GLYPH_ARENA_PAGE;
+        for (int offset = GLYPH_ARENA_PAGE / block * block - block; offset >= 0; offset -= block) {
+            *(uint8_t **)(base + offset) = ctx->class_free[cls];
+            ctx->class_free[cls] = base + offset;
+        }
+        ctx->page_class[page] = (uint8_t)cls;
+        ctx->page_used[page] = 0;
+    }
+
+    uint8_t *block = ctx->class_free[cls];
+    ctx->class_free[cls] = *(uint8_t **)block;
+    ctx->page_used[(block - ctx->arena) / GLYPH_ARENA_PAGE]++;
+    return block;
+}
+
+// 归还块；页内的块全部空闲时把页还给空闲页，供其他级别使用
+static void arena_free(stream_font_ctx_t *ctx, uint8_t *block, int cls)
+{
+    const int page = (block - ctx->arena) / GLYPH_ARENA_PAGE;
+    *(uint8_t **)block = ctx->class_free[cls];
+    ctx->class_free[cls] = block;
+    if (--ctx->page_used[page] > 0) {
+        return;
+    }
+
+    uint8_t *base = ctx->arena + (size_t)page * GLYPH_ARENA_PAGE;
+    uint8_t **link = &ctx->class_free[cls];
+    while (*link != NULL) {
+        if (*link >= base && *link < base + GLYPH_ARENA_PAGE) {
+            *link = *(uint8_t **)*link;
+        } else {
+            link = (uint8_t **)*link;
+        }
+    }
+    ctx->page_class[page] = GLYPH_CLASS_FREE;
+}
+
+// 按预算分配位图区（整块分配失败时减半重试）
+static bool init_glyph_arena(stream_font_ctx_t *ctx, size_t budget)
+{
+    uint32_t pages = budget / GLYPH_ARENA_PAGE;
+    if (pages > GLYPH_ARENA_MAX_PAGES) {
+        pages = GLYPH_ARENA_MAX_PAGES;
+    } else if (pages < GLYPH_ARENA_MIN_PAGES) {
+        pages = GLYPH_ARENA_MIN_PAGES;
+    }
+    while ((ctx->arena = (uint8_t *)heap_stats_malloc(HEAP_TAG_FONT, pages * GLYPH_ARENA_PAGE)) == NULL) {
+        if (pages <= GLYPH_ARENA_MIN_PAGES) {
+            return false;
+        }
+        pages /= 2;
+    }
+
+    ctx->arena_pages = (uint16_t)pages;
+    memset(ctx->page_class, GLYPH_CLASS_FREE, sizeof(ctx->page_class));
+    memset(ctx->page_used, 0, sizeof(ctx->page_used));
+    memset(ctx->class_free, 0, sizeof(ctx->class_free));
+    ctx->bitmap_budget = pages * GLYPH_ARENA_PAGE;
+    return true;
+}
+
+// 从缓存中删除字形，槽放回空闲链表
+static void drop_glyph(stream_font_ctx_t *ctx, uint16_t index)
+{
+    stream_glyph_t *glyph = &ctx->glyphs[index];
+    lru_unlink(ctx, index);
+    table_remove(ctx, (uint32_t)table_find(ctx, glyph->unicode));
+    if (glyph->bitmap != NULL) {
+        arena_free(ctx, glyph->bitmap, arena_class(glyph->bitmap_size));
+        ctx->bitmap_bytes -= glyph->bitmap_size;
+        glyph->bitmap = NULL;
+    }
+    glyph->next = ctx->free_head;
+    ctx->free_head = index;
+    ctx->glyph_count--;
+}
+
+// 淘汰最久未用的字形（预取中固定的字形不淘汰）
+static bool evict_lru_glyph(stream_font_ctx_t *ctx)
+{
+    const uint16_t index = ctx->lru_tail;
+    if (index == GLYPH_NONE || ctx->glyphs[index].pinned) {
+        return false;
+    }
+    drop_glyph(ctx, index);
+    return true;
+}
+
+// 查找缓存项（命中时移到 LRU 链表头部）
+static stream_glyph_t *find_glyph_cache(stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    const int pos = table_find(ctx, unicode);
+    if (pos < 0) {
+        return NULL;
+    }
+    const uint16_t index = ctx->glyph_table[pos] - 1;
+    if (ctx->lru_head != index) {
+        lru_unlink(ctx, index);
+        lru_push_front(ctx, index);
+    }
+    return &ctx->glyphs[index];
+}
+
+// 分配缓存槽（满时淘汰最久未用的），填好 unicode 并放进哈希表与 LRU 链表头部
+static stream_glyph_t *alloc_glyph(stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    if (ctx->free_head == GLYPH_NONE && !evict_lru_glyph(ctx)) {
+        return NULL;
+    }
+    const uint16_t index = ctx->free_head;
+    stream_glyph_t *glyph = &ctx->glyphs[index];
+    ctx->free_head = glyph->next;
+    memset(glyph, 0, sizeof(*glyph));
+    glyph->unicode = unicode;
+    table_insert(ctx, index);
+    lru_push_front(ctx, index);
+    ctx->glyph_count++;
+    return glyph;
+}
+
+// 按堆余量决定缓存大小：位图区最多占余量的 1/GLYPH_CACHE_HEAP_SHARE，
+// 槽数按一个满格字形的位图大小估算，让一整页的常用字能留在缓存里
+static bool init_glyph_cache(stream_font_ctx_t *ctx)
+{
+    const size_t budget = heap_stats_cache_budget(0, GLYPH_CACHE_HEAP_SHARE);
+    const uint32_t line = (uint32_t)scale_px(ctx, ctx->line_height);
+    const uint32_t glyph_estimate = (line + 7) / 8 * line + sizeof(stream_glyph_t);
+    if (!init_glyph_arena(ctx, budget)) {
+        ESP_LOGE(TAG, "Failed to allocate glyph arena");
+        return false;
+    }
+
+    uint32_t capacity = ctx->bitmap_budget / (glyph_estimate ? glyph_estimate : 1);
+    if (capacity < GLYPH_CACHE_MIN_SIZE) {
+        capacity = GLYPH_CACHE_MIN_SIZE;
+    } else if (capacity > GLYPH_CACHE_MAX_SIZE) {
+        capacity = GLYPH_CACHE_MAX_SIZE;
+    }
+    uint32_t table_size = 1;
+    while (table_size < capacity * 2) {
+        table_size <<= 1;
+    }
+
+    ctx->glyphs = (stream_glyph_t *)heap_stats_malloc(HEAP_TAG_FONT, capacity * sizeof(stream_glyph_t));
+    ctx->glyph_table = (uint16_t *)heap_stats_calloc(HEAP_TAG_FONT, table_size, sizeof(uint16_t));
+    if (ctx->glyphs == NULL || ctx->glyph_table == NULL) {
+        heap_stats_free(HEAP_TAG_FONT, ctx->glyphs);
+        heap_stats_free(HEAP_TAG_FONT, ctx->glyph_table);
+        heap_stats_free(HEAP_TAG_FONT, ctx->arena);
+        ctx->glyphs = NULL;
+        ctx->glyph_table = NULL;
+        ctx->arena = NULL;
+        ESP_LOGE(TAG, "Failed to allocate glyph cache (%lu slots)", (unsigned long)capacity);
+        return false;
+    }
+
+    ctx->glyph_capacity = (uint16_t)capacity;
+    ctx->table_mask = (uint16_t)(table_size - 1);
+    ctx->glyph_count = 0;
+    ctx->lru_head = GLYPH_NONE;
+    ctx->lru_tail = GLYPH_NONE;
+    for (uint32_t i = 0; i < capacity; i++) {
+        ctx->glyphs[i].next = (i + 1 < capacity) ? (uint16_t)(i + 1) : GLYPH_NONE;
+    }
+    ctx->free_head = 0;
+    ctx->bitmap_bytes = 0;
+
+    ESP_LOGI(TAG, "Glyph cache: %lu slots, %u x %u byte arena (budget %lu)",
+             (unsigned long)capacity, ctx->arena_pages, GLYPH_ARENA_PAGE,
+             (unsigned long)budget);
+    return true;
+}
+
+// 清理缓存
+static void clear_glyph_cache(stream_font_ctx_t *ctx)
+{
+    if (ctx->glyphs != NULL) {
+        while (ctx->lru_tail != GLYPH_NONE) {
+            drop_glyph(ctx, ctx->lru_tail);
+        }
+    }
+    heap_stats_free(HEAP_TAG_FONT, ctx->glyphs);
+    heap_stats_free(HEAP_TAG_FONT, ctx->glyph_table);
+    heap_stats_free(HEAP_TAG_FONT, ctx->arena);
+    ctx->glyphs = NULL;
+    ctx->glyph_table = NULL;
+    ctx->arena = NULL;
+}
 
-// 获取 LRU 缓存项
-static stream_glyph_t *get_lru_glyph(stream_font_ctx_t *ctx)
+// 内存压力回调（推迟到轮询时运行，此时没有字形在使用）：解压块缓存缩到最少，
+// 位图区清空后减半，不低于 GLYPH_ARENA_MIN_PAGES。缩小后保持到字体重新打开
+static bool trim_caches(size_t want, void *arg)
 {
-    stream_glyph_t *lru = &ctx->glyph_cache[0];
-    uint32_t min_access = ctx->glyph_cache[0].last_access;
+    (void)want;
+    stream_font_ctx_t *ctx = (stream_font_ctx_t *)arg;
+    bool released = false;
+    if (ctx->block_slots > FONT_BLOCK_CACHE_MIN) {
+        uint8_t *data = (uint8_t *)heap_stats_realloc(HEAP_TAG_FONT, ctx->block_data,
+                                                      FONT_BLOCK_CACHE_MIN * ctx->block_size);
+        if (data != NULL) {
+            ctx->block_data = data;
+            ctx->block_slots = FONT_BLOCK_CACHE_MIN;
+            for (uint32_t i = 0; i < FONT_BLOCK_CACHE_MIN; i++) {
+                ctx->block_id[i] = UINT32_MAX;
+                ctx->block_use[i] = 0;
+            }
+            released = true;
+        }
+    }
+    if (ctx->arena != NULL && ctx->arena_pages > GLYPH_ARENA_MIN_PAGES) {
+        while (ctx->lru_tail != GLYPH_NONE && evict_lru_glyph(ctx)) {
+        }
+        if (ctx->lru_tail == GLYPH_NONE) {
+            const uint32_t pages = ctx->arena_pages / 2;
+            heap_stats_free(HEAP_TAG_FONT, ctx->arena);
+            ctx->current_bitmap = NULL;
+            if (!init_glyph_arena(ctx, pages * GLYPH_ARENA_PAGE)) {
+                // 连最小的位图区都分不到：字形照常查找，只是不缓存位图
+                ctx->arena = NULL;
+                ctx->arena_pages = 0;
+                ctx->bitmap_budget = 0;
+            }
+            released = true;
+        }
+    }
+    if (released) {
+        ESP_LOGW(TAG, "Trimmed %s: %u arena pages, %u cached blocks", ctx->file_path,
+                 ctx->arena_pages, ctx->block_slots);
+    }
+    return released;
+}
 
-    for (int i = 1; i < GLYPH_CACHE_SIZE; i++) {
-        if (!ctx->glyph_cache[i].used ||
-            ctx->glyph_cache[i].last_access < min_access) {
-            min_access = ctx->glyph_cache[i].last_access;
-            lru = &ctx->glyph_cache[i];
+// 在文件中二分查找 cmap（每次探测一次 fseek + fread，只在 cmap 未载入内存时使用）
+static uint32_t find_glyph_index_file(stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    if (ctx->fp == NULL) {
+        return 0xFFFFFFFF;
+    }
+
+    for (uint8_t cmap_idx = 0; cmap_idx < ctx->cmap_num; cmap_idx++) {
+        uint32_t cmap_offset = ctx->cmap_offset + cmap_idx * sizeof(lv_font_cmap_header_t);
+        lv_font_cmap_header_t cmap_header;
+
+        fseek(ctx->fp, cmap_offset, SEEK_SET);
+        if (fread(&cmap_header, 1, sizeof(cmap_header), ctx->fp) != sizeof(cmap_header)) {
+            continue;
         }
+
+        // 二分查找
+        uint32_t left = 0, right = cmap_header.entries;
+        uint32_t found_glyph = 0xFFFFFFFF;
+
+        while (left < right) {
+            uint32_t mid = (left + right) / 2;
+            uint32_t entry_offset = cmap_offset + sizeof(cmap_header) +
+                                    mid * sizeof(lv_font_cmap_entry_t);
+            lv_font_cmap_entry_t entry;
+
+            fseek(ctx->fp, entry_offset, SEEK_SET);
+            if (fread(&entry, 1, sizeof(entry), ctx->fp) != sizeof(entry)) {
+                break;
+            }
+
+            if (entry.codepoint == unicode) {
+                found_glyph = entry.glyph_index;
+                break;
+            } else if (entry.codepoint < unicode) {
+                left = mid + 1;
+            } else {
+                if (mid == 0) break;
+                right = mid;
+            }
+        }
+
+        if (found_glyph != 0xFFFFFFFF) {
+            return found_glyph;
+        }
+    }
+
+    return 0xFFFFFFFF;
+}
+
+// 从 cmap 查找字形索引（cmap 在内存中时不访问文件）
+static uint32_t find_glyph_index(stream_font_ctx_t *ctx, uint32_t unicode)
+{
+    if (ctx->cmap_num == 0) {
+        return 0xFFFFFFFF;
+    }
+    if (ctx->cmap_ranges == NULL) {
+        return find_glyph_index_file(ctx, unicode);
+    }
+
+    for (uint8_t cmap_idx = 0; cmap_idx < ctx->cmap_num; cmap_idx++) {
+        // 最后一个 first <= unicode 的区间
+        uint32_t left = ctx->cmap_range_start[cmap_idx];
+        uint32_t right = ctx->cmap_range_start[cmap_idx + 1];
+        while (left < right) {
+            const uint32_t mid = (left + right) / 2;
+            if (ctx->cmap_ranges[mid].first <= unicode) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        if (left > ctx->cmap_range_start[cmap_idx]) {
+            const cmap_range_t *range = &ctx->cmap_ranges[left - 1];
+            if (unicode - range->first < range->count) {
+                return range->glyph + (unicode - range->first);
+            }
+        }
+
+        left = ctx->cmap_point_start[cmap_idx];
+        right = ctx->cmap_point_start[cmap_idx + 1];
+        while (left < right) {
+            const uint32_t mid = (left + right) / 2;
+            if (ctx->cmap_points[mid].codepoint == unicode) {
+                return ctx->cmap_points[mid].glyph;
+            } else if (ctx->cmap_points[mid].codepoint < unicode) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+    }
+
+    return 0xFFFFFFFF;
+}
+
+static void free_cmap(stream_font_ctx_t *ctx)
+{
+    heap_stats_free(HEAP_TAG_FONT, ctx->cmap_ranges);
+    heap_stats_free(HEAP_TAG_FONT, ctx->cmap_points);
+    heap_stats_free(HEAP_TAG_FONT, ctx->cmap_range_start);
+    heap_stats_free(HEAP_TAG_FONT, ctx->cmap_point_start);
+    ctx->cmap_ranges = NULL;
+    ctx->cmap_points = NULL;
+    ctx->cmap_range_start = NULL;
+    ctx->cmap_point_start = NULL;
+}
+
+// 可增长的数组追加一项（打开字体时使用，结束后缩到实际大小）
+static bool cmap_push(void **items, uint32_t *count, uint32_t *cap, size_t item_size,
+                      const void *item)
+{
+    if (*count == *cap) {
+        const uint32_t new_cap = *cap ? *cap * 2 : 64;
+        void *grown = heap_stats_realloc(HEAP_TAG_FONT, *items, new_cap * item_size);
+        if (grown == NULL) {
+            return false;
+        }
+        *items = grown;
+        *cap = new_cap;
+    }
+    memcpy((uint8_t *)*items + (size_t)*count * item_size, item, item_size);
+    (*count)++;
+    return true;
+}
+
+// 一段连续条目：够长的存为区间，否则逐个存为单点
+static bool cmap_flush_run(stream_font_ctx_t *ctx, const cmap_range_t *run,
+                           uint32_t *range_count, uint32_t *range_cap,
+                           uint32_t *point_count, uint32_t *point_cap)
+{
+    if (run->count >= CMAP_RANGE_MIN) {
+        return cmap_push((void **)&ctx->cmap_ranges, range_count, range_cap,
+                         sizeof(cmap_range_t), run);
+    }
+    for (uint32_t i = 0; i < run->count; i++) {
+        const cmap_point_t point = {run->first + i, run->glyph + i};
+        if (!cmap_push((void **)&ctx->cmap_points, point_count, point_cap,
+                       sizeof(cmap_point_t), &point)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 打开时顺序读一遍 cmap，压缩成区间 + 单点表载入内存；失败时保留文件查找
+static void load_cmap(stream_font_ctx_t *ctx)
+{
+    if (ctx->cmap_num == 0) {
+        return;
+    }
+    ctx->cmap_range_start = (uint32_t *)heap_stats_calloc(HEAP_TAG_FONT, ctx->cmap_num + 1, sizeof(uint32_t));
+    ctx->cmap_point_start = (uint32_t *)heap_stats_calloc(HEAP_TAG_FONT, ctx->cmap_num + 1, sizeof(uint32_t));
+    if (ctx->cmap_range_start == NULL || ctx->cmap_point_start == NULL) {
+        free_cmap(ctx);
+        return;
+    }
+
+    uint32_t range_count = 0, range_cap = 0;
+    uint32_t point_count = 0, point_cap = 0;
+    uint32_t total = 0;
+    bool ok = true;
+    lv_font_cmap_entry_t chunk[CMAP_READ_CHUNK];
+
+    for (uint8_t cmap_idx = 0; cmap_idx < ctx->cmap_num && ok; cmap_idx++) {
+        const uint32_t cmap_offset = ctx->cmap_offset + cmap_idx * sizeof(lv_font_cmap_header_t);
+        lv_font_cmap_header_t cmap_header;
+        ctx->cmap_range_start[cmap_idx] = range_count;
+        ctx->cmap_point_start[cmap_idx] = point_count;
+
+        fseek(ctx->fp, cmap_offset, SEEK_SET);
+        if (fread(&cmap_header, 1, sizeof(cmap_header), ctx->fp) != sizeof(cmap_header)) {
+            continue;
+        }
+
+        cmap_range_t run = {0, 0, 0};
+        uint32_t prev_codepoint = 0;
+        for (uint32_t done = 0; done < cmap_header.entries && ok;) {
+            uint32_t n = cmap_header.entries - done;
+            if (n > CMAP_READ_CHUNK) {
+                n = CMAP_READ_CHUNK;
+            }
+            if (fread(chunk, sizeof(lv_font_cmap_entry_t), n, ctx->fp) != n) {
+                ok = false;
+                break;
+            }
+            for (uint32_t i = 0; i < n && ok; i++) {
+                const lv_font_cmap_entry_t *entry = &chunk[i];
+                if (done + i > 0 && entry->codepoint <= prev_codepoint) {
+                    // 查找依赖有序的码点
+                    ESP_LOGW(TAG, "cmap %d not sorted at entry %lu", cmap_idx,
+                             (unsigned long)(done + i));
+                    ok = false;
+                    break;
+                }
+                prev_codepoint = entry->codepoint;
+                if (run.count > 0 && entry->codepoint == run.first + run.count &&
+                    entry->glyph_index == run.glyph + run.count) {
+                    run.count++;
+                    continue;
+                }
+                ok = cmap_flush_run(ctx, &run, &range_count, &range_cap,
+                                    &point_count, &point_cap);
+                run.first = entry->codepoint;
+                run.glyph = entry->glyph_index;
+                run.count = 1;
+            }
+            done += n;
+        }
+        if (ok) {
+            ok = cmap_flush_run(ctx, &run, &range_count, &range_cap, &point_count, &point_cap);
+        }
+        total += cmap_header.entries;
+    }
+
+    if (!ok) {
+        ESP_LOGW(TAG, "cmap not loaded into RAM, falling back to file lookups");
+        free_cmap(ctx);
+        return;
+    }
+    ctx->cmap_range_start[ctx->cmap_num] = range_count;
+    ctx->cmap_point_start[ctx->cmap_num] = point_count;
+
+    // 缩到实际大小；没有区间时也保留一个非空指针表示 cmap 已在内存中
+    void *shrunk = heap_stats_realloc(HEAP_TAG_FONT, ctx->cmap_ranges,
+                                      (range_count ? range_count : 1) * sizeof(cmap_range_t));
+    if (shrunk != NULL) {
+        ctx->cmap_ranges = (cmap_range_t *)shrunk;
+    }
+    if (point_count > 0) {
+        shrunk = heap_stats_realloc(HEAP_TAG_FONT, ctx->cmap_points, point_count * sizeof(cmap_point_t));
+        if (shrunk != NULL) {
+            ctx->cmap_points = (cmap_point_t *)shrunk;
+        }
+    }
+    if (ctx->cmap_ranges == NULL) {
+        free_cmap(ctx);
+        return;
+    }
+
+    ESP_LOGI(TAG, "cmap in RAM: %lu entries -> %lu ranges + %lu points (%lu bytes)",
+             (unsigned long)total, (unsigned long)range_count, (unsigned long)point_count,
+             (unsigned long)(range_count * sizeof(cmap_range_t) + point_count * sizeof(cmap_point_t)));
+}
+
+// 从文件读取字形描述符
+static bool read_glyph_dsc(stream_font_ctx_t *ctx, uint32_t glyph_index,
+                           lv_font_glyph_dsc_bin_t *bin_dsc)
+{
+    if (ctx->fp == NULL || glyph_index == 0xFFFFFFFF) {
+        return false;
+    }
+
+    uint32_t offset = ctx->glyph_dsc_offset + glyph_index * FONT_STREAM_DSC_SIZE;
+    if (!flash_cache_read(ctx->cache_id, ctx->fp, 0, ctx->file_size, offset,
+                          bin_dsc, sizeof(lv_font_glyph_dsc_bin_t))) {
+        return false;
+    }
+
+    return true;
+}
+
+static void remember_adv(stream_font_ctx_t *ctx, uint32_t glyph_index, uint16_t adv)
+{
+    if (ctx->adv_table != NULL && glyph_index < ctx->adv_count && adv < 0xFF) {
+        ctx->adv_table[glyph_index] = (uint8_t)(adv + 1);
+    }
+}
+
+// 缩放字形的包围盒：按两条边分别换算，相邻字形与基线的相对位置不因取整漂移
+static void scale_glyph_box(const stream_font_ctx_t *ctx, stream_glyph_t *glyph)
+{
+    const int x0 = scale_px(ctx, glyph->ofs_x);
+    const int x1 = scale_px(ctx, glyph->ofs_x + glyph->src_w);
+    const int y0 = scale_px(ctx, glyph->ofs_y);
+    const int y1 = scale_px(ctx, glyph->ofs_y + glyph->src_h);
+    glyph->ofs_x = (int16_t)x0;
+    glyph->ofs_y = (int16_t)y0;
+    glyph->box_w = (uint16_t)(x1 > x0 ? x1 - x0 : 1);
+    glyph->box_h = (uint16_t)(y1 > y0 ? y1 - y0 : 1);
+}
+
+// 填入描述符；有位图时标记为待读取
+static void set_glyph_dsc(stream_font_ctx_t *ctx, stream_glyph_t *glyph,
+                          const lv_font_glyph_dsc_bin_t *bin_dsc)
+{
+    glyph->adv_w = (uint16_t)scale_px(ctx, bin_dsc->advance_x);
+    glyph->box_w = bin_dsc->box_w;
+    glyph->box_h = bin_dsc->box_h;
+    glyph->ofs_x = bin_dsc->ofs_x;
+    glyph->ofs_y = bin_dsc->ofs_y;
+    glyph->bitmap_offset = bin_dsc->bitmap_offset;
+    if (bin_dsc->box_w == 0 || bin_dsc->box_h == 0) {
+        return;
+    }
+    const uint32_t src_size = ((bin_dsc->box_w * ctx->bpp + 7) / 8) * (uint32_t)bin_dsc->box_h;
+    // 原始位图要能整块读进预取缓冲区再转换；缩放时母版尺寸记在 8 位字段中
+    if (src_size > PREFETCH_IO_SIZE ||
+        (ctx->scale_den != 0 && (bin_dsc->box_w > UINT8_MAX || bin_dsc->box_h > UINT8_MAX))) {
+        ESP_LOGW(TAG, "Glyph U+%04lX too large to cache (%lu bytes)",
+                 (unsigned long)glyph->unicode, (unsigned long)src_size);
+        if (ctx->scale_den != 0) {
+            glyph->box_w = 0;  // 不能画母版尺寸的位图，按空白字形排版
+            glyph->box_h = 0;
+        }
+        return;
+    }
+    if (ctx->scale_den != 0) {
+        glyph->src_w = (uint8_t)bin_dsc->box_w;
+        glyph->src_h = (uint8_t)bin_dsc->box_h;
+        scale_glyph_box(ctx, glyph);
+    }
+    glyph->src_size = (uint16_t)src_size;
+    glyph->bitmap_size = ((glyph->box_w + 7) / 8) * glyph->box_h;
+    glyph->bitmap_pending = true;
+}
+
+#if FONT_STREAM_A1_DITHER
+// 4x4 Bayer 矩阵
+static const uint8_t s_bayer4[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5},
+};
+#endif
+
+// 像素 (x, y) 的置位门限（0-255）
+static inline uint8_t a1_level(uint16_t x, uint16_t y)
+{
+#if FONT_STREAM_A1_DITHER
+    return (uint8_t)((s_bayer4[y & 3][x & 3] * 2 + 1) * 255 / 32);
+#else
+    (void)x;
+    (void)y;
+    return FONT_STREAM_A1_THRESHOLD;
+#endif
+}
+
+// 按行打包的 bpp 位像素值（0 ~ 2^bpp - 1）
+static inline uint8_t src_pixel(const uint8_t *row, uint16_t x, uint8_t bpp, uint16_t stride)
+{
+    const uint32_t bit = (uint32_t)x * bpp;
+    const uint32_t byte = bit >> 3;
+    // 两字节窗口，bpp = 3 时像素可能跨字节
+    const uint16_t pair = (uint16_t)(row[byte] << 8 | (byte + 1 < stride ? row[byte + 1] : 0));
+    return (uint8_t)(pair >> (16 - bpp - (bit & 7))) & (uint8_t)((1u << bpp) - 1);
+}
+
+// 母版字形按面积平均缩小到 box_w x box_h 再取阈值：每个目标像素对它覆盖的源像素
+// 按重叠面积加权求平均灰度。坐标统一放大到公共单位（源像素宽 box_w、目标像素宽
+// src_w 个单位），重叠面积都是整数，不用浮点
+static void glyph_scale_to_a1(const stream_font_ctx_t *ctx, const stream_glyph_t *glyph,
+                              const uint8_t *src, uint8_t *dst)
+{
+    const uint8_t bpp = ctx->bpp;
+    const uint32_t sw = glyph->src_w;
+    const uint32_t sh = glyph->src_h;
+    const uint32_t dw = glyph->box_w;
+    const uint32_t dh = glyph->box_h;
+    const uint16_t src_stride = (uint16_t)((sw * bpp + 7) / 8);
+    const uint16_t dst_stride = (uint16_t)((dw + 7) / 8);
+    // 整个目标像素都被最大灰度覆盖时的加权和（源尺寸不超过 255，乘 255 仍在 32 位内）
+    const uint32_t full = ((1u << bpp) - 1) * sw * sh;
+
+    memset(dst, 0, glyph->bitmap_size);
+    for (uint32_t dy = 0; dy < dh; dy++) {
+        const uint32_t y0 = dy * sh;
+        const uint32_t y1 = y0 + sh;
+        uint8_t *out = dst + dy * dst_stride;
+        for (uint32_t dx = 0; dx < dw; dx++) {
+            const uint32_t x0 = dx * sw;
+            const uint32_t x1 = x0 + sw;
+            uint32_t sum = 0;
+            for (uint32_t sy = y0 / dh; sy * dh < y1; sy++) {
+                const uint32_t top = sy * dh > y0 ? sy * dh : y0;
+                const uint32_t bottom = (sy + 1) * dh < y1 ? (sy + 1) * dh : y1;
+                const uint8_t *row = src + sy * src_stride;
+                uint32_t line = 0;
+                for (uint32_t sx = x0 / dw; sx * dw < x1; sx++) {
+                    const uint8_t value = src_pixel(row, (uint16_t)sx, bpp, src_stride);
+                    if (value != 0) {
+                        const uint32_t left = sx * dw > x0 ? sx * dw : x0;
+                        const uint32_t right = (sx + 1) * dw < x1 ? (sx + 1) * dw : x1;
+                        line += value * (right - left);
+                    }
+                }
+                sum += line * (bottom - top);
+            }
+            if (sum * 255u >= a1_level((uint16_t)dx, (uint16_t)dy) * full) {
+                out[dx >> 3] |= (uint8_t)(0x80 >> (dx & 7));
+            }
+        }
+    }
+}
+
+// 文件中按行打包的 bpp 位字形转为 A1（高位在左，与 LVGL 的 A1 一致）
+static void glyph_to_a1(const stream_font_ctx_t *ctx, const stream_glyph_t *glyph,
+                        const uint8_t *src, uint8_t *dst)
+{
+    if (ctx->scale_den != 0) {
+        glyph_scale_to_a1(ctx, glyph, src, dst);
+        return;
+    }
+    const uint8_t bpp = ctx->bpp;
+    const uint16_t w = glyph->box_w;
+    const uint16_t src_stride = (w * bpp + 7) / 8;
+    const uint16_t dst_stride = (w + 7) / 8;
+    if (bpp == 1) {
+        memcpy(dst, src, glyph->bitmap_size);
+        return;
+    }
+    const uint8_t max = (uint8_t)((1u << bpp) - 1);
+    for (uint16_t y = 0; y < glyph->box_h; y++) {
+        const uint8_t *row = src + y * src_stride;
+        uint8_t *out = dst + y * dst_stride;
+        memset(out, 0, dst_stride);
+        for (uint16_t x = 0; x < w; x++) {
+            const uint8_t value = src_pixel(row, x, bpp, src_stride);
+            if (value * 255u / max >= a1_level(x, y)) {
+                out[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+            }
+        }
+    }
+}
+
+// 在位图区中分配一块；没有合适的块时淘汰旧字形（不淘汰 keep 与固定的字形），
+// 直到同级别空出一块或整页空出
+static uint8_t *alloc_bitmap(stream_font_ctx_t *ctx, uint16_t size, uint16_t keep)
+{
+    const int cls = arena_class(size);
+    uint8_t *bitmap = arena_alloc(ctx, cls);
+    while (bitmap == NULL && ctx->lru_tail != keep && evict_lru_glyph(ctx)) {
+        bitmap = arena_alloc(ctx, cls);
+    }
+    return bitmap;
+}
+
+static void store_bitmap(stream_font_ctx_t *ctx, stream_glyph_t *glyph, uint8_t *bitmap)
+{
+    glyph->bitmap = bitmap;
+    glyph->bitmap_pending = false;
+    ctx->bitmap_bytes += glyph->bitmap_size;
+}
+
+static void free_blocks(stream_font_ctx_t *ctx)
+{
+    heap_stats_free(HEAP_TAG_FONT, ctx->block_offsets);
+    heap_stats_free(HEAP_TAG_FONT, ctx->block_data);
+    heap_stats_free(HEAP_TAG_FONT, ctx->block_packed);
+    ctx->block_offsets = NULL;
+    ctx->block_data = NULL;
+    ctx->block_packed = NULL;
+    ctx->block_count = 0;
+}
+
+// 分块字体：读入块索引，按堆余量分配解压块缓存
+static bool load_block_index(stream_font_ctx_t *ctx)
+{
+    font_block_header_t header;
+    fseek(ctx->fp, ctx->glyph_bitmap_offset, SEEK_SET);
+    if (fread(&header, 1, sizeof(header), ctx->fp) != sizeof(header) ||
+        header.block_size == 0 || header.block_size > FONT_BLOCK_MAX_SIZE ||
+        header.block_count == 0 ||
+        header.block_count != (header.raw_size + header.block_size - 1) / header.block_size) {
+        ESP_LOGE(TAG, "Bad block index");
+        return false;
+    }
+    const size_t index_size = (header.block_count + 1) * sizeof(uint32_t);
+    ctx->block_offsets = (uint32_t *)heap_stats_malloc(HEAP_TAG_FONT, index_size);
+    if (ctx->block_offsets == NULL ||
+        fread(ctx->block_offsets, 1, index_size, ctx->fp) != index_size) {
+        ESP_LOGE(TAG, "Failed to load block index (%lu blocks)", (unsigned long)header.block_count);
+        free_blocks(ctx);
+        return false;
+    }
+    const uint32_t table_size = ctx->file_size - ctx->glyph_bitmap_offset;
+    for (uint32_t i = 0; i < header.block_count; i++) {
+        if (ctx->block_offsets[i] > ctx->block_offsets[i + 1] ||
+            ctx->block_offsets[i + 1] - ctx->block_offsets[i] > header.block_size) {
+            ESP_LOGE(TAG, "Bad block %lu", (unsigned long)i);
+            free_blocks(ctx);
+            return false;
+        }
+    }
+    if (ctx->block_offsets[header.block_count] > table_size) {
+        ESP_LOGE(TAG, "Block index past end of file");
+        free_blocks(ctx);
+        return false;
+    }
+
+    uint32_t slots = heap_stats_cache_budget(index_size, BLOCK_CACHE_HEAP_SHARE) / header.block_size;
+    if (slots < FONT_BLOCK_CACHE_MIN) {
+        slots = FONT_BLOCK_CACHE_MIN;
+    } else if (slots > FONT_BLOCK_CACHE_MAX) {
+        slots = FONT_BLOCK_CACHE_MAX;
+    }
+    ctx->block_data = (uint8_t *)heap_stats_malloc(HEAP_TAG_FONT, slots * header.block_size);
+    ctx->block_packed = (uint8_t *)heap_stats_malloc(HEAP_TAG_FONT, header.block_size);
+    if (ctx->block_data == NULL || ctx->block_packed == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate block cache (%lu x %u)", (unsigned long)slots,
+                 header.block_size);
+        free_blocks(ctx);
+        return false;
+    }
+    ctx->block_count = header.block_count;
+    ctx->block_raw_size = header.raw_size;
+    ctx->block_size = header.block_size;
+    ctx->block_slots = (uint8_t)slots;
+    for (uint32_t i = 0; i < slots; i++) {
+        ctx->block_id[i] = UINT32_MAX;
+    }
+    ESP_LOGI(TAG, "Block font: %lu blocks of %u (%lu -> %lu bytes), cache %lu blocks",
+             (unsigned long)header.block_count, header.block_size, (unsigned long)header.raw_size,
+             (unsigned long)ctx->block_offsets[header.block_count], (unsigned long)slots);
+    return true;
+}
+
+// 取解压后的第 block 块（缓存未命中时读入并解压，替换最久未用的槽）
+static const uint8_t *load_block(stream_font_ctx_t *ctx, uint32_t block)
+{
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < ctx->block_slots; i++) {
+        if (ctx->block_id[i] == block) {
+            ctx->block_use[i] = ++ctx->block_clock;
+            return ctx->block_data + i * ctx->block_size;
+        }
+        if (ctx->block_use[i] < ctx->block_use[slot]) {
+            slot = i;
+        }
+    }
+
+    uint8_t *data = ctx->block_data + slot * ctx->block_size;
+    const uint32_t start = block * ctx->block_size;
+    const uint32_t raw = ctx->block_raw_size - start < ctx->block_size ?
+                         ctx->block_raw_size - start : ctx->block_size;
+    const uint32_t stored = ctx->block_offsets[block + 1] - ctx->block_offsets[block];
+    const uint32_t offset = ctx->glyph_bitmap_offset + ctx->block_offsets[block];
+    // 原样保存的块直接读进槽里
+    uint8_t *dst = stored == raw ? data : ctx->block_packed;
+    ctx->block_id[slot] = UINT32_MAX;
+    if (!flash_cache_read(ctx->cache_id, ctx->fp, 0, ctx->file_size, offset, dst, stored) ||
+        (stored != raw && !lz_block_decode(ctx->block_packed, stored, data, raw))) {
+        ESP_LOGW(TAG, "Failed to load block %lu", (unsigned long)block);
+        return NULL;
+    }
+    ctx->block_id[slot] = block;
+    ctx->block_use[slot] = ++ctx->block_clock;
+    ctx->block_loads++;
+    return data;
+}
+
+// 把文件中的一段读进预取缓冲区（长度不超过 PREFETCH_IO_SIZE）
+static bool prefetch_read_span(stream_font_ctx_t *ctx, uint32_t offset, uint32_t length)
+{
+    return flash_cache_read(ctx->cache_id, ctx->fp, 0, ctx->file_size, offset,
+                            ctx->prefetch_io, length);
+}
+
+// 字形在文件中的原始位图：分块字体取自解压块缓存，否则读进预取缓冲区（预取不会与
+// 按需加载同时进行）。返回的指针在下一次读取前有效，失败时返回 NULL
+static const uint8_t *glyph_src(stream_font_ctx_t *ctx, const stream_glyph_t *glyph)
+{
+    if (ctx->block_count == 0) {
+        return prefetch_read_span(ctx, ctx->glyph_bitmap_offset + glyph->bitmap_offset,
+                                  glyph->src_size) ? ctx->prefetch_io : NULL;
     }
-    return lru;
+    const uint32_t block = glyph->bitmap_offset / ctx->block_size;
+    const uint32_t offset = glyph->bitmap_offset % ctx->block_size;
+    // 生成工具保证字形不跨块
+    if (block >= ctx->block_count || offset + glyph->src_size > ctx->block_size ||
+        glyph->bitmap_offset + glyph->src_size > ctx->block_raw_size) {
+        return NULL;
+    }
+    const uint8_t *data = load_block(ctx, block);
+    return data != NULL ? data + offset : NULL;
 }
 
-// 查找缓存项
-static stream_glyph_t *find_glyph_cache(stream_font_ctx_t *ctx, uint32_t unicode)
+// 单独读取一个字形的位图（失败时保持待读取，下次再试）
+static void load_glyph_bitmap(stream_font_ctx_t *ctx, stream_glyph_t *glyph)
 {
-    for (int i = 0; i < GLYPH_CACHE_SIZE; i++) {
-        if (ctx->glyph_cache[i].used &&
-            ctx->glyph_cache[i].unicode == unicode) {
-            ctx->glyph_cache[i].last_access = ++ctx->cache_access_counter;
-            return &ctx->glyph_cache[i];
-        }
+    // 原始位图转换进位图区
+    const uint8_t *src = glyph_src(ctx, glyph);
+    if (src == NULL) {
+        return;
     }
-    return NULL;
+    uint8_t *bitmap = alloc_bitmap(ctx, glyph->bitmap_size, (uint16_t)(glyph - ctx->glyphs));
+    if (bitmap == NULL) {
+        return;
+    }
+    glyph_to_a1(ctx, glyph, src, bitmap);
+    store_bitmap(ctx, glyph, bitmap);
 }
 
-// 清理缓存
-static void clear_glyph_cache(stream_font_ctx_t *ctx)
+// 未命中：查 cmap、读描述符与位图，存入缓存（字体中没有的字符也记下）
+static stream_glyph_t *load_glyph(stream_font_ctx_t *ctx, uint32_t unicode)
 {
-    for (int i = 0; i < GLYPH_CACHE_SIZE; i++) {
-        if (ctx->glyph_cache[i].used && ctx->glyph_cache[i].bitmap != NULL) {
-            free(ctx->glyph_cache[i].bitmap);
-            ctx->glyph_cache[i].bitmap = NULL;
-        }
-        ctx->glyph_cache[i].used = false;
+    lv_font_glyph_dsc_bin_t bin_dsc;
+    const uint32_t glyph_index = find_glyph_index(ctx, unicode);
+    const bool found = glyph_index != 0xFFFFFFFF;
+    if (found && !read_glyph_dsc(ctx, glyph_index, &bin_dsc)) {
+        return NULL;
+    }
+
+    stream_glyph_t *glyph = alloc_glyph(ctx, unicode);
+    if (glyph == NULL) {
+        return NULL;
+    }
+    if (!found) {
+        glyph->missing = true;
+        return glyph;
+    }
+
+    set_glyph_dsc(ctx, glyph, &bin_dsc);
+    remember_adv(ctx, glyph_index, bin_dsc.advance_x);
+    if (glyph->bitmap_pending) {
+        load_glyph_bitmap(ctx, glyph);
     }
+    return glyph;
 }
 
-// 从 cmap 查找字形索引
-static uint32_t find_glyph_index(stream_font_ctx_t *ctx, uint32_t unicode)
+static bool font_get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                  uint32_t unicode, uint32_t unicode_next);
+
+static int compare_prefetch_items(const void *a, const void *b)
 {
-    if (ctx->fp == NULL || ctx->cmap_num == 0) {
-        return 0xFFFFFFFF;
-    }
+    const uint32_t x = ((const prefetch_item_t *)a)->key;
+    const uint32_t y = ((const prefetch_item_t *)b)->key;
+    return (x > y) - (x < y);
+}
 
-    for (uint8_t cmap_idx = 0; cmap_idx < ctx->cmap_num; cmap_idx++) {
-        uint32_t cmap_offset = ctx->cmap_offset + cmap_idx * sizeof(lv_font_cmap_header_t);
-        lv_font_cmap_header_t cmap_header;
+// 预取一批（n 不超过 PREFETCH_BATCH 与缓存槽数的一半，批内字形都不会被淘汰）
+static int prefetch_batch(stream_font_ctx_t *ctx, const uint32_t *codepoints, uint32_t n)
+{
+    prefetch_item_t *items = ctx->prefetch_items;
+    uint32_t count = 0;
 
-        fseek(ctx->fp, cmap_offset, SEEK_SET);
-        if (fread(&cmap_header, 1, sizeof(cmap_header), ctx->fp) != sizeof(cmap_header)) {
+    // 1. 未命中的码点分配缓存槽（重复的码点第二次即命中），查内存中的 cmap
+    for (uint32_t i = 0; i < n; i++) {
+        if (find_glyph_cache(ctx, codepoints[i]) != NULL) {
             continue;
         }
+        const uint32_t glyph_index = find_glyph_index(ctx, codepoints[i]);
+        stream_glyph_t *glyph = alloc_glyph(ctx, codepoints[i]);
+        if (glyph == NULL) {
+            break;
+        }
+        if (glyph_index == 0xFFFFFFFF) {
+            glyph->missing = true;
+            continue;
+        }
+        glyph->pinned = true;
+        items[count].key = glyph_index;
+        items[count].slot = (uint16_t)(glyph - ctx->glyphs);
+        count++;
+    }
+    if (count == 0) {
+        return 0;
+    }
 
-        // 二分查找
-        uint32_t left = 0, right = cmap_header.entries;
-        uint32_t found_glyph = 0xFFFFFFFF;
-
-        while (left < right) {
-            uint32_t mid = (left + right) / 2;
-            uint32_t entry_offset = cmap_offset + sizeof(cmap_header) +
-                                    mid * sizeof(lv_font_cmap_entry_t);
-            lv_font_cmap_entry_t entry;
-
-            fseek(ctx->fp, entry_offset, SEEK_SET);
-            if (fread(&entry, 1, sizeof(entry), ctx->fp) != sizeof(entry)) {
-                break;
+    // 2. 按字形序号排序，相邻的描述符合并为一次读取
+    qsort(items, count, sizeof(prefetch_item_t), compare_prefetch_items);
+    uint32_t kept = 0;
+    for (uint32_t first = 0; first < count;) {
+        uint32_t last = first + 1;
+        while (last < count &&
+               (items[last].key - items[first].key + 1) * FONT_STREAM_DSC_SIZE <= PREFETCH_IO_SIZE) {
+            last++;
+        }
+        const uint32_t span = (items[last - 1].key - items[first].key) * FONT_STREAM_DSC_SIZE +
+                              sizeof(lv_font_glyph_dsc_bin_t);
+        // 描述符处理完的项原地压缩为位图读取表（kept <= i），先记下本组的起点
+        const uint32_t base = items[first].key;
+        const bool ok = prefetch_read_span(ctx, ctx->glyph_dsc_offset + base * FONT_STREAM_DSC_SIZE, span);
+        for (uint32_t i = first; i < last; i++) {
+            stream_glyph_t *glyph = &ctx->glyphs[items[i].slot];
+            if (!ok) {
+                // 读取失败的字形不留在缓存中，之后按需单独加载
+                glyph->pinned = false;
+                drop_glyph(ctx, items[i].slot);
+                continue;
             }
-
-            if (entry.codepoint == unicode) {
-                found_glyph = entry.glyph_index;
-                break;
-            } else if (entry.codepoint < unicode) {
-                left = mid + 1;
+            lv_font_glyph_dsc_bin_t bin_dsc;
+            memcpy(&bin_dsc, ctx->prefetch_io + (items[i].key - base) * FONT_STREAM_DSC_SIZE,
+                   sizeof(bin_dsc));
+            set_glyph_dsc(ctx, glyph, &bin_dsc);
+            remember_adv(ctx, items[i].key, bin_dsc.advance_x);
+            if (glyph->bitmap_pending) {
+                items[kept].key = bin_dsc.bitmap_offset;
+                items[kept].slot = items[i].slot;
+                kept++;
             } else {
-                if (mid == 0) break;
-                right = mid;
+                glyph->pinned = false;
             }
         }
+        first = last;
+    }
 
-        if (found_glyph != 0xFFFFFFFF) {
-            return found_glyph;
+    // 3. 按位图偏移排序，相邻的位图合并为一次读取；分块字体按偏移顺序逐个从块缓存取，
+    //    同一块只读入、解压一次
+    qsort(items, kept, sizeof(prefetch_item_t), compare_prefetch_items);
+    int loaded = 0;
+    for (uint32_t i = 0; ctx->block_count > 0 && i < kept; i++) {
+        stream_glyph_t *glyph = &ctx->glyphs[items[i].slot];
+        const uint8_t *src = glyph_src(ctx, glyph);
+        uint8_t *bitmap = src != NULL ? alloc_bitmap(ctx, glyph->bitmap_size, GLYPH_NONE) : NULL;
+        if (bitmap != NULL) {
+            glyph_to_a1(ctx, glyph, src, bitmap);
+            store_bitmap(ctx, glyph, bitmap);
+            loaded++;
         }
     }
-
-    return 0xFFFFFFFF;
+    for (uint32_t first = 0; ctx->block_count == 0 && first < kept;) {
+        uint32_t last = first + 1;
+        uint32_t end = items[first].key + ctx->glyphs[items[first].slot].src_size;
+        while (last < kept) {
+            const uint32_t next_end = items[last].key + ctx->glyphs[items[last].slot].src_size;
+            if ((next_end > end ? next_end : end) - items[first].key > PREFETCH_IO_SIZE) {
+                break;
+            }
+            end = next_end > end ? next_end : end;
+            last++;
+        }
+        const bool ok = prefetch_read_span(ctx, ctx->glyph_bitmap_offset + items[first].key,
+                                           end - items[first].key);
+        for (uint32_t i = first; i < last; i++) {
+            stream_glyph_t *glyph = &ctx->glyphs[items[i].slot];
+            uint8_t *bitmap = ok ? alloc_bitmap(ctx, glyph->bitmap_size, GLYPH_NONE) : NULL;
+            if (bitmap != NULL) {
+                glyph_to_a1(ctx, glyph, ctx->prefetch_io + (items[i].key - items[first].key), bitmap);
+                store_bitmap(ctx, glyph, bitmap);
+                loaded++;
+            }
+        }
+        first = last;
+    }
+    for (uint32_t i = 0; i < kept; i++) {
+        ctx->glyphs[items[i].slot].pinned = false;
+    }
+    return loaded;
 }
 
-// 从文件读取字形描述符
-static bool read_glyph_dsc(stream_font_ctx_t *ctx, uint32_t glyph_index,
-                           lv_font_glyph_dsc_bin_t *bin_dsc)
+int font_stream_prefetch(const lv_font_t *font, const uint32_t *codepoints, uint32_t count)
 {
-    if (ctx->fp == NULL || glyph_index == 0xFFFFFFFF) {
-        return false;
+    if (font == NULL || font->get_glyph_dsc != font_get_glyph_dsc_cb || codepoints == NULL) {
+        return 0;
     }
-
-    uint32_t offset = ctx->glyph_dsc_offset + glyph_index * GLYPH_DSC_SIZE;
-    fseek(ctx->fp, offset, SEEK_SET);
-
-    if (fread(bin_dsc, 1, sizeof(lv_font_glyph_dsc_bin_t), ctx->fp) !=
-        sizeof(lv_font_glyph_dsc_bin_t)) {
-        return false;
+    stream_font_ctx_t *ctx = (stream_font_ctx_t *)font->user_data;
+    if (ctx == NULL || ctx->fp == NULL) {
+        return 0;
     }
 
-    return true;
+    uint32_t batch = ctx->glyph_capacity / 2;
+    if (batch > PREFETCH_BATCH) {
+        batch = PREFETCH_BATCH;
+    }
+    int loaded = 0;
+    for (uint32_t done = 0; done < count; done += batch) {
+        loaded += prefetch_batch(ctx, codepoints + done, count - done < batch ? count - done : batch);
+    }
+    return loaded;
 }
 
 /**
@@ -228,75 +1288,38 @@ static bool font_get_glyph_dsc_cb(const lv_font_t *font,
         return false;
     }
 
-    // 查找字形索引
-    uint32_t glyph_index = find_glyph_index(ctx, unicode);
-    if (glyph_index == 0xFFFFFFFF) {
-        return false;
+    ctx->lookups++;
+    stream_glyph_t *glyph = find_glyph_cache(ctx, unicode);
+    if (glyph == NULL) {
+        glyph = load_glyph(ctx, unicode);
+        if (glyph == NULL) {
+            return false;
+        }
+    } else if (glyph->bitmap_pending) {
+        load_glyph_bitmap(ctx, glyph);
+    } else {
+        ctx->hits++;
     }
-
-    // 读取字形描述符
-    lv_font_glyph_dsc_bin_t bin_dsc;
-    if (!read_glyph_dsc(ctx, glyph_index, &bin_dsc)) {
+    if (glyph->missing) {
         return false;
     }
 
     // 填充 dsc
-    dsc->adv_w = bin_dsc.advance_x;
-    dsc->box_w = bin_dsc.box_w;
-    dsc->box_h = bin_dsc.box_h;
-    dsc->ofs_x = bin_dsc.ofs_x;
-    dsc->ofs_y = bin_dsc.ofs_y;
-
-    // 计算 stride
-    dsc->stride = (bin_dsc.box_w * ctx->bpp + 7) / 8;
-
-    // 设置格式
-    dsc->format = LV_FONT_GLYPH_FORMAT_A1;  // 简化处理
+    dsc->adv_w = glyph->adv_w;
+    dsc->box_w = glyph->box_w;
+    dsc->box_h = glyph->box_h;
+    dsc->ofs_x = glyph->ofs_x;
+    dsc->ofs_y = glyph->ofs_y;
+
+    // 缓存中的位图已转为 A1
+    dsc->stride = (glyph->box_w + 7) / 8;
+    dsc->format = LV_FONT_GLYPH_FORMAT_A1;
     dsc->is_placeholder = 0;
     dsc->req_raw_bitmap = 0;
     dsc->outline_stroke_width = 0;
 
-    // 查找或加载位图
-    stream_glyph_t *glyph = find_glyph_cache(ctx, unicode);
-    if (glyph != NULL && glyph->bitmap != NULL) {
-        // 使用缓存的位图
-        dsc->gid.src = glyph->bitmap;
-        ctx->current_bitmap = glyph->bitmap;
-        return true;
-    }
-
-    // 加载位图
-    if (bin_dsc.box_w > 0 && bin_dsc.box_h > 0) {
-        uint16_t bitmap_size = dsc->stride * bin_dsc.box_h;
-        uint8_t *bitmap = (uint8_t *)malloc(bitmap_size);
-        if (bitmap != NULL) {
-            uint32_t bitmap_offset = ctx->glyph_bitmap_offset + bin_dsc.bitmap_offset;
-            fseek(ctx->fp, bitmap_offset, SEEK_SET);
-            if (fread(bitmap, 1, bitmap_size, ctx->fp) == bitmap_size) {
-                // 存入缓存
-                if (glyph == NULL) {
-                    glyph = get_lru_glyph(ctx);
-                    if (glyph->bitmap != NULL) {
-                        free(glyph->bitmap);
-                    }
-                    glyph->unicode = unicode;
-                    glyph->used = true;
-                    glyph->last_access = ++ctx->cache_access_counter;
-                }
-                glyph->bitmap = bitmap;
-                glyph->bitmap_size = bitmap_size;
-                glyph->stride = dsc->stride;
-
-                dsc->gid.src = bitmap;
-                ctx->current_bitmap = bitmap;
-                return true;
-            }
-            free(bitmap);
-        }
-    }
-
-    dsc->gid.src = NULL;
-    ctx->current_bitmap = NULL;
+    dsc->gid.src = glyph->bitmap;
+    ctx->current_bitmap = glyph->bitmap;
     return true;
 }
 
@@ -348,17 +1371,37 @@ static bool load_font_header(stream_font_ctx_t *ctx)
     ctx->glyph_dsc_offset = header.glyph_dsc_offset;
     ctx->glyph_bitmap_offset = header.glyph_bitmap_offset;
 
-    ESP_LOGI(TAG, "Font header: h=%d, bpp=%d, cmap=%d, dsc=%lu, bmp=%lu",
+    ESP_LOGI(TAG, "Font header: h=%d, bpp=%d, cmap=%d, dsc=%lu, bmp=%lu%s",
              ctx->line_height, ctx->bpp, ctx->cmap_num,
              (unsigned long)ctx->glyph_dsc_offset,
-             (unsigned long)ctx->glyph_bitmap_offset);
+             (unsigned long)ctx->glyph_bitmap_offset,
+             (header.flags & FONT_STREAM_FLAG_BLOCKS) ? ", blocks" : "");
 
-    return true;
+    return (header.flags & FONT_STREAM_FLAG_BLOCKS) == 0 || load_block_index(ctx);
 }
 
-stream_font_t *font_stream_open(const char *path)
+// 字形数由描述符表长度推算（位图表紧随其后）
+static void init_adv_table(stream_font_ctx_t *ctx)
+{
+    if (ctx->glyph_bitmap_offset <= ctx->glyph_dsc_offset ||
+        ctx->glyph_bitmap_offset > ctx->file_size) {
+        return;
+    }
+    const uint32_t count = (ctx->glyph_bitmap_offset - ctx->glyph_dsc_offset) / FONT_STREAM_DSC_SIZE;
+    if (count == 0 || count > heap_stats_cache_budget(0, ADV_TABLE_HEAP_SHARE)) {
+        ESP_LOGW(TAG, "No advance width table (%lu glyphs)", (unsigned long)count);
+        return;
+    }
+    ctx->adv_table = (uint8_t *)heap_stats_calloc(HEAP_TAG_FONT, count, 1);
+    if (ctx->adv_table != NULL) {
+        ctx->adv_count = count;
+    }
+}
+
+// 打开字体文件；size 小于母版行高时按 size 缩放（缓存槽数按缩放后的字形估算）
+static stream_font_ctx_t *open_font(const char *path, int size)
 {
-    stream_font_ctx_t *ctx = (stream_font_ctx_t *)malloc(sizeof(stream_font_ctx_t));
+    stream_font_ctx_t *ctx = (stream_font_ctx_t *)heap_stats_malloc(HEAP_TAG_FONT, sizeof(stream_font_ctx_t));
     if (ctx == NULL) {
         ESP_LOGE(TAG, "Failed to allocate context");
         return NULL;
@@ -367,26 +1410,50 @@ stream_font_t *font_stream_open(const char *path)
     memset(ctx, 0, sizeof(stream_font_ctx_t));
     strncpy(ctx->file_path, path, sizeof(ctx->file_path) - 1);
 
-    ctx->fp = fopen(path, "rb");
+    ctx->fp = file_pool_fopen(path);
     if (ctx->fp == NULL) {
         ESP_LOGE(TAG, "Failed to open: %s", path);
-        free(ctx);
+        heap_stats_free(HEAP_TAG_FONT, ctx);
         return NULL;
     }
+    setvbuf(ctx->fp, NULL, _IOFBF, FONT_STDIO_BUF);
 
     fseek(ctx->fp, 0, SEEK_END);
     ctx->file_size = ftell(ctx->fp);
+    ctx->cache_id = flash_cache_file_id(path);
     fseek(ctx->fp, 0, SEEK_SET);
 
     ESP_LOGI(TAG, "Opened: %s (%lu bytes)", path, (unsigned long)ctx->file_size);
 
     if (!load_font_header(ctx)) {
         fclose(ctx->fp);
-        free(ctx);
+        heap_stats_free(HEAP_TAG_FONT, ctx);
+        return NULL;
+    }
+    // 只缩小：不小于母版行高时用原始字形
+    if (size > 0 && size < ctx->line_height) {
+        ctx->scale_num = (uint16_t)size;
+        ctx->scale_den = ctx->line_height;
+    }
+
+    // 先载入 cmap 与前进宽度表（按堆余量决定字形缓存大小时已扣除）
+    load_cmap(ctx);
+    init_adv_table(ctx);
+    if (!init_glyph_cache(ctx)) {
+        heap_stats_free(HEAP_TAG_FONT, ctx->adv_table);
+        free_cmap(ctx);
+        free_blocks(ctx);
+        fclose(ctx->fp);
+        heap_stats_free(HEAP_TAG_FONT, ctx);
         return NULL;
     }
 
-    return (stream_font_t *)ctx;
+    return ctx;
+}
+
+stream_font_t *font_stream_open(const char *path)
+{
+    return (stream_font_t *)open_font(path, 0);
 }
 
 void font_stream_close(stream_font_t *font)
@@ -394,18 +1461,27 @@ void font_stream_close(stream_font_t *font)
     if (font == NULL) return;
 
     stream_font_ctx_t *ctx = (stream_font_ctx_t *)font;
+    mem_pressure_unregister(trim_caches, ctx);
     if (ctx->fp != NULL) {
         fclose(ctx->fp);
         ctx->fp = NULL;
     }
 
     clear_glyph_cache(ctx);
-    free(ctx);
+    free_cmap(ctx);
+    free_blocks(ctx);
+    heap_stats_free(HEAP_TAG_FONT, ctx->adv_table);
+    heap_stats_free(HEAP_TAG_FONT, ctx);
 }
 
 lv_font_t *font_stream_create(const char *path)
 {
-    stream_font_ctx_t *ctx = (stream_font_ctx_t *)font_stream_open(path);
+    return font_stream_create_scaled(path, 0);
+}
+
+lv_font_t *font_stream_create_scaled(const char *path, int size)
+{
+    stream_font_ctx_t *ctx = open_font(path, size);
     if (ctx == NULL) {
         return NULL;
     }
@@ -416,25 +1492,196 @@ lv_font_t *font_stream_create(const char *path)
         return NULL;
     }
 
-    font->line_height = ctx->line_height;
-    font->base_line = ctx->base_line;
+    // 清零：fallback 等未用到的字段不能是随机值（回退链会沿 fallback 查找）
+    memset(font, 0, sizeof(lv_font_t));
+    font->line_height = scale_px(ctx, ctx->line_height);
+    font->base_line = scale_px(ctx, ctx->base_line);
     font->subpx = LV_FONT_SUBPX_NONE;
     font->dsc = NULL;
     font->user_data = ctx;
     font->get_glyph_dsc = font_get_glyph_dsc_cb;
     font->get_glyph_bitmap = font_get_bitmap_cb;
     font->release_glyph = font_release_glyph_cb;
+    // 文件格式不带字距表，LVGL 不必再传下一个字符
+    font->kerning = LV_FONT_KERNING_NONE;
+    mem_pressure_register("font", MEM_PRESSURE_PRIO_WORKING, HEAP_TAG_FONT, 0, trim_caches, ctx);
+
+    if (ctx->scale_den != 0) {
+        ESP_LOGI(TAG, "Created stream font: %s (scaled %d -> %d px)", path, ctx->line_height, size);
+    } else {
+        ESP_LOGI(TAG, "Created stream font: %s", path);
+    }
+
+    return font;
+}
+
+// ---------------------------------------------------------------------------
+// 映射字体：字体文件整体映射在地址空间中（flash 分区经 MMU 映射），描述符与位图
+// 直接按指针读取，不缓存、不申请内存
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    uint8_t cmap_num;
+    uint8_t bpp;
+    uint32_t cmap_offset;
+    uint32_t glyph_dsc_offset;
+    uint32_t glyph_bitmap_offset;
+} mapped_font_ctx_t;
+
+static bool mapped_in_bounds(const mapped_font_ctx_t *ctx, uint32_t offset, uint32_t length)
+{
+    return offset <= ctx->size && length <= ctx->size - offset;
+}
+
+static uint32_t mapped_find_glyph_index(const mapped_font_ctx_t *ctx, uint32_t unicode)
+{
+    for (uint8_t cmap_idx = 0; cmap_idx < ctx->cmap_num; cmap_idx++) {
+        const uint32_t cmap_offset = ctx->cmap_offset + cmap_idx * sizeof(lv_font_cmap_header_t);
+        lv_font_cmap_header_t cmap_header;
+        if (!mapped_in_bounds(ctx, cmap_offset, sizeof(cmap_header))) {
+            break;
+        }
+        memcpy(&cmap_header, ctx->data + cmap_offset, sizeof(cmap_header));
+        const uint32_t entries_offset = cmap_offset + sizeof(cmap_header);
+        if (cmap_header.entries > (ctx->size - entries_offset) / sizeof(lv_font_cmap_entry_t)) {
+            continue;
+        }
+
+        uint32_t left = 0, right = cmap_header.entries;
+        while (left < right) {
+            const uint32_t mid = (left + right) / 2;
+            lv_font_cmap_entry_t entry;
+            memcpy(&entry, ctx->data + entries_offset + mid * sizeof(entry), sizeof(entry));
+            if (entry.codepoint == unicode) {
+                return entry.glyph_index;
+            } else if (entry.codepoint < unicode) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+    }
+    return 0xFFFFFFFF;
+}
+
+static lv_font_glyph_format_t mapped_glyph_format(uint8_t bpp)
+{
+    switch (bpp) {
+        case 2: return LV_FONT_GLYPH_FORMAT_A2;
+        case 4: return LV_FONT_GLYPH_FORMAT_A4;
+        case 8: return LV_FONT_GLYPH_FORMAT_A8;
+        default: return LV_FONT_GLYPH_FORMAT_A1;
+    }
+}
+
+static bool mapped_get_glyph_dsc_cb(const lv_font_t *font,
+                                    lv_font_glyph_dsc_t *dsc,
+                                    uint32_t unicode,
+                                    uint32_t unicode_next)
+{
+    (void)unicode_next;
+
+    const mapped_font_ctx_t *ctx = (const mapped_font_ctx_t *)font->user_data;
+    if (ctx == NULL) {
+        return false;
+    }
+    const uint32_t glyph_index = mapped_find_glyph_index(ctx, unicode);
+    if (glyph_index == 0xFFFFFFFF) {
+        return false;
+    }
+    const uint32_t dsc_offset = ctx->glyph_dsc_offset + glyph_index * FONT_STREAM_DSC_SIZE;
+    lv_font_glyph_dsc_bin_t bin_dsc;
+    if (!mapped_in_bounds(ctx, dsc_offset, sizeof(bin_dsc))) {
+        return false;
+    }
+    memcpy(&bin_dsc, ctx->data + dsc_offset, sizeof(bin_dsc));
+
+    dsc->adv_w = bin_dsc.advance_x;
+    dsc->box_w = bin_dsc.box_w;
+    dsc->box_h = bin_dsc.box_h;
+    dsc->ofs_x = bin_dsc.ofs_x;
+    dsc->ofs_y = bin_dsc.ofs_y;
+    dsc->stride = (bin_dsc.box_w * ctx->bpp + 7) / 8;
+    // 映射字体不缓存，直接交出原始位图，格式按文件的 bpp 如实标明
+    dsc->format = mapped_glyph_format(ctx->bpp);
+    dsc->is_placeholder = 0;
+    dsc->req_raw_bitmap = 0;
+    dsc->outline_stroke_width = 0;
+
+    const uint32_t bitmap_offset = ctx->glyph_bitmap_offset + bin_dsc.bitmap_offset;
+    const uint32_t bitmap_size = dsc->stride * bin_dsc.box_h;
+    dsc->gid.src = (bitmap_size > 0 && mapped_in_bounds(ctx, bitmap_offset, bitmap_size))
+                       ? ctx->data + bitmap_offset : NULL;
+    return true;
+}
+
+lv_font_t *font_stream_create_mapped(const void *data, uint32_t size, const char *name)
+{
+    lv_font_bin_header_t header;
+    if (data == NULL || size < sizeof(header)) {
+        return NULL;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.flags & FONT_STREAM_FLAG_BLOCKS) {
+        // 压缩块不能按指针直接读，由调用方改用流式加载
+        ESP_LOGI(TAG, "Block font cannot be mapped: %s", name != NULL ? name : "?");
+        return NULL;
+    }
+
+    mapped_font_ctx_t *ctx = (mapped_font_ctx_t *)calloc(1, sizeof(mapped_font_ctx_t));
+    lv_font_t *font = (lv_font_t *)malloc(sizeof(lv_font_t));
+    if (ctx == NULL || font == NULL) {
+        free(ctx);
+        free(font);
+        return NULL;
+    }
+    ctx->data = (const uint8_t *)data;
+    ctx->size = size;
+    ctx->cmap_num = header.cmap_num;
+    ctx->bpp = header.bpp;
+    ctx->cmap_offset = (header.cmap_list_offset > 0) ?
+                       header.cmap_list_offset : sizeof(lv_font_bin_header_t);
+    ctx->glyph_dsc_offset = header.glyph_dsc_offset;
+    ctx->glyph_bitmap_offset = header.glyph_bitmap_offset;
 
-    ESP_LOGI(TAG, "Created stream font: %s", path);
+    memset(font, 0, sizeof(lv_font_t));
+    font->line_height = header.line_height;
+    font->base_line = header.base_line;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->dsc = NULL;
+    font->user_data = ctx;
+    font->get_glyph_dsc = mapped_get_glyph_dsc_cb;
+    font->get_glyph_bitmap = font_get_bitmap_cb;
+    font->release_glyph = font_release_glyph_cb;
+    font->kerning = LV_FONT_KERNING_NONE;
 
+    ESP_LOGI(TAG, "Created mapped font: %s (%lu bytes, h=%d, bpp=%d)",
+             name != NULL ? name : "?", (unsigned long)size, header.line_height, header.bpp);
     return font;
 }
 
+bool font_stream_can_map(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    lv_font_bin_header_t header;
+    const bool ok = fread(&header, 1, sizeof(header), fp) == sizeof(header);
+    fclose(fp);
+    return ok && (header.flags & FONT_STREAM_FLAG_BLOCKS) == 0;
+}
+
 void font_stream_destroy(lv_font_t *font)
 {
     if (font == NULL) return;
 
-    if (font->user_data != NULL) {
+    if (font->get_glyph_dsc == mapped_get_glyph_dsc_cb) {
+        free(font->user_data);
+        font->user_data = NULL;
+    } else if (font->user_data != NULL) {
         font_stream_close((stream_font_t *)font->user_data);
         font->user_data = NULL;
     }
@@ -447,22 +1694,85 @@ void font_stream_get_info(stream_font_t *font, char *buffer, size_t buffer_size)
     if (font == NULL || buffer == NULL) return;
 
     stream_font_ctx_t *ctx = (stream_font_ctx_t *)font;
-    int cached = 0;
-
-    for (int i = 0; i < GLYPH_CACHE_SIZE; i++) {
-        if (ctx->glyph_cache[i].used && ctx->glyph_cache[i].bitmap != NULL) {
-            cached++;
-        }
-    }
 
     snprintf(buffer, buffer_size,
              "Stream: %s\n"
              "  Size: %lu bytes\n"
              "  Height: %d, BPP: %d\n"
-             "  Cache: %d/%d",
+             "  Cache: %d/%d glyphs, %lu/%lu bytes\n"
+             "  Hits: %lu/%lu lookups",
              ctx->file_path,
              (unsigned long)ctx->file_size,
              ctx->line_height,
              ctx->bpp,
-             cached, GLYPH_CACHE_SIZE);
+             ctx->glyph_count, ctx->glyph_capacity,
+             (unsigned long)ctx->bitmap_bytes, (unsigned long)ctx->bitmap_budget,
+             (unsigned long)ctx->hits, (unsigned long)ctx->lookups);
+}
+
+bool font_stream_get_stats(const lv_font_t *font, font_stream_stats_t *out)
+{
+    if (font == NULL || out == NULL || font->get_glyph_dsc != font_get_glyph_dsc_cb) {
+        return false;
+    }
+    const stream_font_ctx_t *ctx = (const stream_font_ctx_t *)font->user_data;
+    out->lookups = ctx->lookups;
+    out->hits = ctx->hits;
+    out->glyph_count = ctx->glyph_count;
+    out->glyph_capacity = ctx->glyph_capacity;
+    out->bitmap_bytes = ctx->bitmap_bytes;
+    out->bitmap_budget = ctx->bitmap_budget;
+    out->block_loads = ctx->block_loads;
+    out->block_cache_bytes = (uint32_t)ctx->block_slots * ctx->block_size;
+    return true;
+}
+
+int font_stream_get_advance(const lv_font_t *font, uint32_t unicode)
+{
+    if (font == NULL) {
+        return -1;
+    }
+
+    if (font->get_glyph_dsc == mapped_get_glyph_dsc_cb) {
+        const mapped_font_ctx_t *mctx = (const mapped_font_ctx_t *)font->user_data;
+        const uint32_t glyph_index = mapped_find_glyph_index(mctx, unicode);
+        const uint32_t dsc_offset = mctx->glyph_dsc_offset + glyph_index * FONT_STREAM_DSC_SIZE;
+        lv_font_glyph_dsc_bin_t bin_dsc;
+        if (glyph_index == 0xFFFFFFFF || !mapped_in_bounds(mctx, dsc_offset, sizeof(bin_dsc))) {
+            return -1;
+        }
+        memcpy(&bin_dsc, mctx->data + dsc_offset, sizeof(bin_dsc));
+        return bin_dsc.advance_x;
+    }
+
+    if (font->get_glyph_dsc != font_get_glyph_dsc_cb) {
+        return -1;
+    }
+    stream_font_ctx_t *ctx = (stream_font_ctx_t *)font->user_data;
+    if (ctx == NULL || ctx->fp == NULL) {
+        return -1;
+    }
+
+    // 已在字形缓存中（不调整 LRU，量宽不影响渲染缓存）
+    const int pos = table_find(ctx, unicode);
+    if (pos >= 0) {
+        const stream_glyph_t *glyph = &ctx->glyphs[ctx->glyph_table[pos] - 1];
+        return glyph->missing ? -1 : glyph->adv_w;
+    }
+
+    const uint32_t glyph_index = find_glyph_index(ctx, unicode);
+    if (glyph_index == 0xFFFFFFFF) {
+        return -1;
+    }
+    if (ctx->adv_table != NULL && glyph_index < ctx->adv_count && ctx->adv_table[glyph_index] != 0) {
+        return scale_px(ctx, ctx->adv_table[glyph_index] - 1);
+    }
+
+    // 只读 24 字节描述符，不读位图、不占缓存槽
+    lv_font_glyph_dsc_bin_t bin_dsc;
+    if (!read_glyph_dsc(ctx, glyph_index, &bin_dsc)) {
+        return -1;
+    }
+    remember_adv(ctx, glyph_index, bin_dsc.advance_x);
+    return scale_px(ctx, bin_dsc.advance_x);
 }
@@ -6,6 +6,13 @@
  * 1. 加载字体头信息（较小，约几 KB）
  * 2. 按需从文件读取字形位图
  * 3. 实现字形缓存管理
+ *
+ * 分块压缩容器（字体头 flags 含 FONT_STREAM_FLAG_BLOCKS，由 tools/font_blocks.py 生成）：
+ * 字形位图按字频顺序排进约 4 KB 的块，每块按 lz_block 格式独立压缩（压缩后不更小的块
+ * 原样保存），字形不跨块。位图表开头是块索引：font_block_header_t，随后 block_count + 1
+ * 个 uint32 偏移（相对位图表起点，第 i 块占 [ofs[i], ofs[i + 1])，长度等于块的原始长度
+ * 即未压缩）。描述符中的 bitmap_offset 是解压后位图流中的偏移。读取时缓存解压后的整块，
+ * 一次 SD 读取取到一批常用字，文件也小得多
  */
 
 #ifndef FONT_STREAM_H
@@ -20,16 +27,101 @@
  *      DEFINES
  *********************/
 
-// 缓存的字形数量（根据可用内存调整）
-#define GLYPH_CACHE_SIZE 32
+// 缓存的字形数量：打开字体时按堆余量在此范围内决定
+#define GLYPH_CACHE_MIN_SIZE 64
+#define GLYPH_CACHE_MAX_SIZE 1024
+
+// 字形位图区最多占打开字体时堆余量（空闲堆减 HEAP_STATS_RESERVE）的 1/N（打开时一次分配）
+#define GLYPH_CACHE_HEAP_SHARE 4
+
+// 字形进缓存时一次转为 A1（每行 (box_w + 7) / 8 字节），渲染时只画 1 位字形：
+// 灰度（换算到 0-255）不低于阈值的像素置位。128 即覆盖度 50%，与 I1 绘制单元一致
+#ifndef FONT_STREAM_A1_THRESHOLD
+#define FONT_STREAM_A1_THRESHOLD 128
+#endif
+
+// 置 1 时改用 4x4 有序抖动（按字形内坐标），笔画边缘保留部分灰度；小字号下边缘会毛糙
+#ifndef FONT_STREAM_A1_DITHER
+#define FONT_STREAM_A1_DITHER 0
+#endif
 
-// 最大同时打开的字体文件数
+// 字体头 flags：位图表为分块压缩格式
+#define FONT_STREAM_FLAG_BLOCKS 0x01
+
+// 解压后的块缓存块数：打开字体时按堆余量在此范围内决定
+#define FONT_BLOCK_CACHE_MIN 2
+#define FONT_BLOCK_CACHE_MAX 12
+#define FONT_BLOCK_MAX_SIZE  16384   // 接受的最大块大小
+
+// 最大同时打开的字体文件数（font_manager 的字体注册表按此限制）
 #define MAX_OPEN_FONTS 4
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+// 字体文件布局：文件头，cmap_num 个 cmap（头 + 按码点升序的条目），每字形
+// FONT_STREAM_DSC_SIZE 字节的描述符表（按字形序号），位图表。各表的位置由文件头给出，
+// 书籍子集字体（font_subset.h）按同样的布局写出
+#define FONT_STREAM_DSC_SIZE 24
+
+/**
+ * @brief 字体文件头结构
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t version;
+    uint32_t magic;
+    uint16_t line_height;
+    uint16_t base_line;
+    uint8_t bpp;
+    uint8_t cmap_num;
+    uint16_t kern_classes;
+    uint8_t bitmap_format;
+    uint8_t flags;
+    uint32_t cmap_list_offset;
+    uint32_t glyph_dsc_offset;
+    uint32_t glyph_bitmap_offset;
+} lv_font_bin_header_t;
+
+/**
+ * @brief cmap 头部结构
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t type;
+    uint32_t entries;
+} lv_font_cmap_header_t;
+
+/**
+ * @brief cmap 条目
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t codepoint;
+    uint32_t glyph_index;
+} lv_font_cmap_entry_t;
+
+/**
+ * @brief 字形描述符（描述符表中每项占 FONT_STREAM_DSC_SIZE 字节）
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t codepoint;
+    uint16_t advance_x;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint32_t bitmap_offset;
+} lv_font_glyph_dsc_bin_t;
+
+/**
+ * @brief 分块压缩位图表的头（位于位图表起点，后跟 block_count + 1 个 uint32 偏移）
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t raw_size;         // 解压后位图流的总长度
+    uint16_t block_size;       // 块的原始大小（最后一块可以更短）
+    uint16_t reserved;
+    uint32_t block_count;
+} font_block_header_t;
+
 /**
  * @brief 字形缓存项
  */
@@ -64,7 +156,8 @@ typedef struct {
     uint32_t glyph_bitmap_offset;      // 字形位图表偏移
 
     // 字形缓存
-    glyph_cache_item_t glyph_cache[GLYPH_CACHE_SIZE];
+    glyph_cache_item_t *glyph_cache;
+    uint16_t glyph_cache_size;
     uint32_t cache_access_counter;     // 用于 LRU 排序
 } stream_font_context_t;
 
@@ -112,6 +205,30 @@ const lv_font_glyph_dsc_t *font_stream_get_glyph_dsc(stream_font_t *font,
  */
 const uint8_t *font_stream_get_bitmap(stream_font_t *font, uint32_t unicode);
 
+/**
+ * @brief 批量预取一页文字的字形
+ *
+ * 排版前调用：未缓存的字形按文件偏移排序，描述符与位图各自合并成少数几次较大的
+ * 顺序读取，代替逐字的随机小块读取。重复的码点只处理一次；不是流式字体时什么也不做
+ *
+ * @param font LVGL 字体指针（font_stream_create 创建的才有效）
+ * @param codepoints 码点数组
+ * @param count 码点个数
+ * @return 新读入的字形位图数
+ */
+int font_stream_prefetch(const lv_font_t *font, const uint32_t *codepoints, uint32_t count);
+
+/**
+ * @brief 取字符的前进宽度（排版量宽用），不读位图也不占字形缓存
+ *
+ * 流式字体先查字形缓存和内存中的前进宽度表，都没有时只读该字形的描述符
+ *
+ * @param font LVGL 字体指针（font_stream_create / font_stream_create_mapped 创建的才有效）
+ * @param unicode 码点
+ * @return 前进宽度（像素）；不是流式字体或字体中没有该字符时返回 -1
+ */
+int font_stream_get_advance(const lv_font_t *font, uint32_t unicode);
+
 /**
  * @brief 创建 LVGL 字体对象（使用流式加载）
  * @param path 字体文件路径
@@ -119,9 +236,41 @@ const uint8_t *font_stream_get_bitmap(stream_font_t *font, uint32_t unicode);
  */
 lv_font_t *font_stream_create(const char *path);
 
+/**
+ * @brief 创建按字号缩放的流式字体（一个高分辨率母版字体供所有字号使用）
+ *
+ * 字形进缓存时按面积平均把母版字形缩小到 size / 母版行高，再按
+ * FONT_STREAM_A1_THRESHOLD 转为 A1，缓存与预取照常工作；行高、基线、前进宽度与包围盒
+ * 同比换算。只缩小不放大：size 不小于母版行高（或为 0）时与 font_stream_create() 相同
+ *
+ * @param path 字体文件路径
+ * @param size 目标字号（像素，即缩放后的行高）
+ * @return LVGL 字体指针，失败返回 NULL
+ */
+lv_font_t *font_stream_create_scaled(const char *path, int size);
+
+/**
+ * @brief 创建直接按指针访问的字体（字体文件已整体映射在地址空间中，如 flash 分区）
+ *
+ * 描述符与位图直接指向 data，不缓存、不申请内存；data 需保持有效直到 font_stream_destroy()
+ *
+ * @param data 字体文件内容（LVGL .bin 格式）
+ * @param size 字节数
+ * @param name 日志中显示的名字
+ * @return LVGL 字体指针，失败返回 NULL
+ */
+lv_font_t *font_stream_create_mapped(const void *data, uint32_t size, const char *name);
+
+/**
+ * @brief 字体文件能否整体映射后用 font_stream_create_mapped() 打开（分块压缩的不能）
+ * @param path 字体文件路径
+ * @return false 表示分块字体或读不到字体头
+ */
+bool font_stream_can_map(const char *path);
+
 /**
  * @brief 销毁流式字体
- * @param font LVGL 字体指针（font_stream_create 创建的）
+ * @param font LVGL 字体指针（font_stream_create 或 font_stream_create_mapped 创建的）
  */
 void font_stream_destroy(lv_font_t *font);
 
@@ -133,4 +282,26 @@ void font_stream_destroy(lv_font_t *font);
  */
 void font_stream_get_info(stream_font_t *font, char *buffer, size_t buffer_size);
 
+/**
+ * @brief 字形缓存计数（打开字体后累计，不清零；比较前后两次读数得到一段时间的命中率）
+ */
+typedef struct {
+    uint32_t lookups;          // 渲染时的字形查询次数
+    uint32_t hits;             // 描述符与位图都已缓存的次数
+    uint16_t glyph_count;      // 已缓存字形
+    uint16_t glyph_capacity;   // 缓存槽数
+    uint32_t bitmap_bytes;     // 缓存位图字节数
+    uint32_t bitmap_budget;    // 位图区大小
+    uint32_t block_loads;      // 分块字体：从文件读入并解压的块数（未分块为 0）
+    uint32_t block_cache_bytes; // 分块字体：解压块缓存的大小
+} font_stream_stats_t;
+
+/**
+ * @brief 读取字形缓存计数
+ * @param font LVGL 字体指针（font_stream_create 创建的才有效）
+ * @param out 输出
+ * @return false 表示不是流式字体
+ */
+bool font_stream_get_stats(const lv_font_t *font, font_stream_stats_t *out);
+
 #endif // FONT_STREAM_H
@@ -0,0 +1,887 @@
+/**
+ * @file font_subset.c
+ * @brief 书籍子集字体实现
+ *
+ * 子集文件按 font_stream.h 的布局：文件头 | 描述符表 | 位图表（A1）| cmap（单个，升序）。
+ * 字形序号就是码点在字符集中的名次，取字形时字体里没有的码点从字符集中去掉，剩下的
+ * 正好是 cmap。文件头的 magic 为 SUBSET_MAGIC、version 为指纹，最后写入，中断的文件
+ * 不会被当成完整子集。
+ * 分区区域：第一个扇区是区域头（指纹与长度），子集从第二个扇区开始；复制前先擦掉区域头，
+ * 复制完才写入，中途断电时区域保持无效
+ */
+
+#include "font_subset.h"
+#include "font_manager.h"
+#include "font_loader.h"
+#include "font_stream.h"
+#include "page_index.h"
+#include "gb18030.h"
+#include "bg_jobs.h"
+#include "heap_stats.h"
+#include "mem_pressure.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "FONT_SUBSET";
+
+#define SUBSET_MAGIC        0x42535846u  // "FXSB"
+#define REGION_MAGIC        0x52535846u  // "FXSR"
+#define REGION_DATA_OFFSET  0x1000
+#define SCAN_READ_CHUNK     4096         // 收集字符集时每步读取的正文
+#define CHARSET_BYTES       (0x10000 / 8)
+#define SLICE_GLYPHS        32           // 每批预取的字形数
+#define COPY_CHUNK          4096
+#define CMAP_STEP_ENTRIES   512          // 每步写出的 cmap 条目数
+#define GLYPH_BITMAP_MAX    2048         // 更大的字形不放进子集（字形缓存也不缓存它们的位图）
+
+typedef enum {
+    PHASE_NONE = 0,    // 没有子集：当前字体不读 SD 卡、放不下或失败
+    PHASE_SCAN,        // 后台收集字符集
+    PHASE_EXTRACT,     // 定时器取字形
+    PHASE_INSTALL,     // 后台拼装文件并装入分区 / 内存
+    PHASE_ACTIVE,      // 已在回退链中
+} phase_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;        // 复制完成后才写入
+    uint32_t key;
+    uint32_t size;
+} region_header_t;
+
+static struct {
+    bool open;
+    uint32_t gen;                    // 每次放弃进行中的工作加一，过期作业的结果不再采用
+    phase_t phase;
+    char book_path[256];
+    font_subset_config_t cfg;        // file_path 指向 book_path
+    uint32_t book_key;
+    uint32_t key;
+    const lv_font_t *base;           // 建立子集的当前字体
+    char fsb_path[64];
+    char tmp_path[64];               // 取字形时位图先写到这里
+    lv_timer_t *timer;
+    bg_job_id_t job;
+
+    // 作业结果（作业在后台任务中写入，定时器读取）
+    volatile bool job_done;
+    volatile bool job_ok;
+    uint8_t *charset;                // 收集到的字符集；取字形时去掉字体里没有的码点
+    uint8_t *loaded;                 // 整体读入内存的子集（没有字体分区时）
+
+    // 取字形
+    FILE *dsc_out;                   // 子集文件（描述符表）
+    FILE *bmp_out;                   // 位图临时文件
+    uint32_t next_cp;
+    uint32_t glyphs;
+    uint32_t bitmap_bytes;
+
+    // 生效的子集
+    lv_font_t *font;
+    uint8_t *ram;
+    uint32_t size;
+    esp_partition_mmap_handle_t mmap;
+    bool mapped;
+} s_sub;
+
+static void prepare(void);
+static void teardown(void);
+
+static bool charset_has(const uint8_t *set, uint32_t cp) {
+    return (set[cp >> 3] >> (cp & 7)) & 1;
+}
+
+static uint32_t charset_count(const uint8_t *set) {
+    uint32_t n = 0;
+    for (size_t i = 0; i < CHARSET_BYTES; i++) {
+        n += (uint32_t)__builtin_popcount(set[i]);
+    }
+    return n;
+}
+
+static uint32_t subset_file_size(uint32_t glyphs, uint32_t bitmap_bytes) {
+    return sizeof(lv_font_bin_header_t) + glyphs * (FONT_STREAM_DSC_SIZE + sizeof(lv_font_cmap_entry_t)) +
+           bitmap_bytes + sizeof(lv_font_cmap_header_t);
+}
+
+// 字体分区末尾的子集区域（没有分区或分区太小时为 NULL）
+static const esp_partition_t *region_partition(void) {
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           FONT_MANAGER_PARTITION_LABEL);
+    return part != NULL && part->size > 2 * FONT_MANAGER_SUBSET_REGION ? part : NULL;
+}
+
+static uint32_t region_base(const esp_partition_t *part) {
+    return part->size - FONT_MANAGER_SUBSET_REGION;
+}
+
+static bool header_valid(const lv_font_bin_header_t *hdr, uint32_t size) {
+    return hdr->magic == SUBSET_MAGIC && hdr->version == s_sub.key && hdr->bpp == 1 &&
+           hdr->cmap_num == 1 && hdr->cmap_list_offset < size;
+}
+
+// ---------------------------------------------------------------------------
+// 收集字符集（后台作业）
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t gen;
+    long file_size;
+    long pos;
+    txt_encoding_t encoding;
+    char book_path[256];
+    FILE *book;
+    uint8_t *charset;
+    uint8_t in[SCAN_READ_CHUNK + 8];
+    size_t in_len;
+    bool complete;
+} scan_t;
+
+static int utf8_decode(const uint8_t *s, size_t len, uint32_t *cp) {
+    const uint8_t c = s[0];
+    int n;
+    uint32_t v;
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+        n = 2;
+        v = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+        v = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+        v = c & 0x07;
+    } else {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    if (len < (size_t)n) {
+        return 0;
+    }
+    for (int i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        v = (v << 6) | (s[i] & 0x3F);
+    }
+    *cp = v;
+    return n;
+}
+
+static bool scan_step(bg_job_t *job, void *arg) {
+    scan_t *b = (scan_t *)arg;
+    if (bg_job_cancelled(job)) {
+        return false;
+    }
+    if (b->book == NULL) {
+        b->book = fopen(b->book_path, "rb");
+        if (b->book == NULL || fseek(b->book, b->pos, SEEK_SET) != 0) {
+            ESP_LOGW(TAG, "Cannot read %s (errno=%d)", b->book_path, errno);
+            return false;
+        }
+    }
+
+    size_t want = SCAN_READ_CHUNK;
+    if ((long)want > b->file_size - b->pos) {
+        want = (size_t)(b->file_size - b->pos);
+    }
+    const size_t n = want > 0 ? fread(b->in + b->in_len, 1, want, b->book) : 0;
+    if (n != want) {
+        ESP_LOGW(TAG, "Read failed at %ld", b->pos);
+        return false;
+    }
+    b->pos += (long)n;
+    const size_t len = b->in_len + n;
+    const bool at_eof = b->pos >= b->file_size;
+
+    size_t i = 0;
+    while (i < len) {
+        uint32_t cp;
+        int used = b->encoding == TXT_ENCODING_GB18030 ? gb18030_decode(b->in + i, len - i, &cp)
+                                                       : utf8_decode(b->in + i, len - i, &cp);
+        if (used == 0) {
+            break;          // 字符跨块，留到下一步（文件末尾的残字丢弃）
+        }
+        // 控制字符不渲染，BMP 之外的字很少，留给当前字体
+        if (cp > 0x20 && cp < 0x10000 && cp != 0x7F) {
+            b->charset[cp >> 3] |= (uint8_t)(1u << (cp & 7));
+        }
+        i += (size_t)used;
+    }
+    memmove(b->in, b->in + i, len - i);
+    b->in_len = len - i;
+    if (!at_eof) {
+        return true;
+    }
+    b->complete = true;
+    return false;
+}
+
+static void scan_done(void *arg, bool finished) {
+    scan_t *b = (scan_t *)arg;
+    if (b->book != NULL) {
+        fclose(b->book);
+    }
+    if (b->gen == s_sub.gen) {
+        if (finished && b->complete) {
+            s_sub.charset = b->charset;
+            b->charset = NULL;
+            s_sub.job_ok = true;
+        } else {
+            s_sub.job_ok = false;
+        }
+        s_sub.job_done = true;
+    }
+    heap_stats_free(HEAP_TAG_FONT, b->charset);
+    heap_stats_free(HEAP_TAG_FONT, b);
+}
+
+static void start_scan(void) {
+    scan_t *b = heap_stats_calloc(HEAP_TAG_FONT, 1, sizeof(scan_t));
+    uint8_t *charset = heap_stats_calloc(HEAP_TAG_FONT, 1, CHARSET_BYTES);
+    if (b == NULL || charset == NULL) {
+        heap_stats_free(HEAP_TAG_FONT, b);
+        heap_stats_free(HEAP_TAG_FONT, charset);
+        return;
+    }
+    b->gen = s_sub.gen;
+    b->file_size = s_sub.cfg.file_size;
+    b->pos = s_sub.cfg.content_start;
+    b->encoding = s_sub.cfg.encoding;
+    b->charset = charset;
+    strncpy(b->book_path, s_sub.book_path, sizeof(b->book_path) - 1);
+
+    const bg_job_desc_t desc = {
+        .name = "font_subset_scan",
+        .prio = BG_JOB_PRIO_LOW,
+        .mem_budget = sizeof(scan_t) + CHARSET_BYTES,
+        .step = scan_step,
+        .done = scan_done,
+        .arg = b,
+    };
+    s_sub.job_done = false;
+    s_sub.job = bg_jobs_submit(&desc);
+    if (s_sub.job == BG_JOB_NONE) {
+        heap_stats_free(HEAP_TAG_FONT, charset);
+        heap_stats_free(HEAP_TAG_FONT, b);
+        ESP_LOGW(TAG, "Cannot submit character scan");
+        return;
+    }
+    s_sub.phase = PHASE_SCAN;
+    ESP_LOGI(TAG, "Collecting the character set of %s", s_sub.book_path);
+}
+
+// ---------------------------------------------------------------------------
+// 拼装与装入（后台作业）：把位图表接到描述符表后面、写 cmap 和文件头，
+// 再复制到字体分区的子集区域或读入内存
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    STEP_APPEND = 0,
+    STEP_CMAP,
+    STEP_HEADER,
+    STEP_ERASE,
+    STEP_COPY,
+    STEP_COMMIT,
+    STEP_LOAD,
+} install_step_t;
+
+typedef struct {
+    uint32_t gen;
+    uint32_t key;
+    char fsb_path[64];
+    char tmp_path[64];
+    install_step_t step;
+    bool assemble;                   // 刚取完字形，文件还要拼装
+    FILE *out;
+    FILE *in;
+    uint8_t *charset;                // 拼装 cmap 用
+    lv_font_bin_header_t hdr;
+    uint32_t next_cp;
+    uint32_t glyph_index;
+    uint32_t size;                   // 子集文件长度
+    uint32_t done;                   // 已擦除 / 复制 / 读入的字节
+    const esp_partition_t *part;     // NULL：读入 ram
+    uint8_t *ram;
+    uint8_t buf[COPY_CHUNK];
+    bool complete;
+} install_t;
+
+static bool install_step_once(install_t *b) {
+    switch (b->step) {
+    case STEP_APPEND: {
+        const size_t n = fread(b->buf, 1, sizeof(b->buf), b->in);
+        if (n > 0 && fwrite(b->buf, 1, n, b->out) != n) {
+            return false;
+        }
+        if (n < sizeof(b->buf)) {
+            fclose(b->in);
+            b->in = NULL;
+            remove(b->tmp_path);
+            const lv_font_cmap_header_t cmap = {.type = 0, .entries = b->size};
+            b->hdr.cmap_list_offset = (uint32_t)ftell(b->out);
+            if (fwrite(&cmap, sizeof(cmap), 1, b->out) != 1) {
+                return false;
+            }
+            b->size = 0;
+            b->step = STEP_CMAP;
+        }
+        return true;
+    }
+    case STEP_CMAP: {
+        lv_font_cmap_entry_t entries[64];
+        for (int written = 0; written < CMAP_STEP_ENTRIES && b->next_cp < 0x10000;) {
+            size_t n = 0;
+            for (; b->next_cp < 0x10000 && n < sizeof(entries) / sizeof(entries[0]); b->next_cp++) {
+                if (charset_has(b->charset, b->next_cp)) {
+                    entries[n].codepoint = b->next_cp;
+                    entries[n].glyph_index = b->glyph_index++;
+                    n++;
+                }
+            }
+            if (n > 0 && fwrite(entries, sizeof(entries[0]), n, b->out) != n) {
+                return false;
+            }
+            written += (int)n + 1;
+        }
+        if (b->next_cp >= 0x10000) {
+            b->step = STEP_HEADER;
+        }
+        return true;
+    }
+    case STEP_HEADER:
+        b->size = (uint32_t)ftell(b->out);
+        if (fseek(b->out, 0, SEEK_SET) != 0 || fwrite(&b->hdr, sizeof(b->hdr), 1, b->out) != 1 ||
+            fclose(b->out) != 0) {
+            b->out = NULL;
+            return false;
+        }
+        b->out = NULL;
+        b->assemble = false;
+        b->in = fopen(b->fsb_path, "rb");
+        if (b->in == NULL) {
+            return false;
+        }
+        b->step = b->part != NULL ? STEP_ERASE : STEP_LOAD;
+        return true;
+    case STEP_ERASE: {
+        // 区域头所在的扇区最先擦除，复制中断时区域保持无效
+        const uint32_t total = REGION_DATA_OFFSET + b->size;
+        const uint32_t sector = b->part->erase_size;
+        if (esp_partition_erase_range(b->part, region_base(b->part) + b->done, sector) != ESP_OK) {
+            return false;
+        }
+        b->done += sector;
+        if (b->done >= total) {
+            b->done = 0;
+            b->step = STEP_COPY;
+        }
+        return true;
+    }
+    case STEP_COPY: {
+        uint32_t n = b->size - b->done;
+        if (n > sizeof(b->buf)) {
+            n = sizeof(b->buf);
+        }
+        if (fread(b->buf, 1, n, b->in) != n ||
+            esp_partition_write(b->part, region_base(b->part) + REGION_DATA_OFFSET + b->done, b->buf, n) != ESP_OK) {
+            return false;
+        }
+        b->done += n;
+        if (b->done >= b->size) {
+            b->step = STEP_COMMIT;
+        }
+        return true;
+    }
+    case STEP_COMMIT: {
+        const region_header_t rh = {.magic = REGION_MAGIC, .key = b->key, .size = b->size};
+        if (esp_partition_write(b->part, region_base(b->part), &rh, sizeof(rh)) != ESP_OK) {
+            return false;
+        }
+        b->complete = true;
+        return true;
+    }
+    case STEP_LOAD: {
+        uint32_t n = b->size - b->done;
+        if (n > COPY_CHUNK) {
+            n = COPY_CHUNK;
+        }
+        if (fread(b->ram + b->done, 1, n, b->in) != n) {
+            return false;
+        }
+        b->done += n;
+        b->complete = b->done >= b->size;
+        return true;
+    }
+    }
+    return false;
+}
+
+static bool install_step(bg_job_t *job, void *arg) {
+    install_t *b = (install_t *)arg;
+    if (bg_job_cancelled(job)) {
+        return false;
+    }
+    if (!install_step_once(b)) {
+        ESP_LOGW(TAG, "Subset install failed at step %d (errno=%d)", (int)b->step, errno);
+        return false;
+    }
+    return !b->complete;
+}
+
+static void install_done(void *arg, bool finished) {
+    install_t *b = (install_t *)arg;
+    if (b->out != NULL) {
+        fclose(b->out);
+    }
+    if (b->in != NULL) {
+        fclose(b->in);
+    }
+    if (b->assemble) {
+        // 拼装没完成：半个子集文件没用
+        remove(b->fsb_path);
+    }
+    remove(b->tmp_path);
+    if (b->gen == s_sub.gen) {
+        s_sub.job_ok = finished && b->complete;
+        if (s_sub.job_ok && b->part == NULL) {
+            s_sub.loaded = b->ram;
+            b->ram = NULL;
+        }
+        s_sub.size = b->size;
+        s_sub.job_done = true;
+    }
+    heap_stats_free(HEAP_TAG_FONT, b->ram);
+    heap_stats_free(HEAP_TAG_FONT, b->charset);
+    heap_stats_free(HEAP_TAG_FONT, b);
+}
+
+// 选定子集的去处（分区或内存）并提交装入作业；out 为拼装中的文件（已有完整文件时为 NULL）
+static bool start_install(FILE *out, uint32_t size) {
+    const esp_partition_t *part = region_partition();
+    if (part != NULL && size > FONT_MANAGER_SUBSET_REGION - REGION_DATA_OFFSET) {
+        part = NULL;
+    }
+    uint8_t *ram = NULL;
+    if (part == NULL) {
+        if (size > heap_stats_cache_budget(0, FONT_SUBSET_HEAP_SHARE) ||
+            (ram = heap_stats_malloc(HEAP_TAG_FONT, size)) == NULL) {
+            ESP_LOGW(TAG, "No room for a %u-byte subset, glyphs stay on the SD card", (unsigned)size);
+            return false;
+        }
+    }
+    install_t *b = heap_stats_calloc(HEAP_TAG_FONT, 1, sizeof(install_t));
+    if (b == NULL) {
+        heap_stats_free(HEAP_TAG_FONT, ram);
+        return false;
+    }
+    b->gen = s_sub.gen;
+    b->key = s_sub.key;
+    b->part = part;
+    b->ram = ram;
+    b->size = size;
+    strncpy(b->fsb_path, s_sub.fsb_path, sizeof(b->fsb_path) - 1);
+    strncpy(b->tmp_path, s_sub.tmp_path, sizeof(b->tmp_path) - 1);
+    if (out != NULL) {
+        b->assemble = true;
+        b->out = out;
+        b->in = fopen(s_sub.tmp_path, "rb");
+        b->charset = s_sub.charset;
+        s_sub.charset = NULL;
+        b->size = s_sub.glyphs;      // STEP_APPEND 写 cmap 头时的条目数，随后改为文件长度
+        b->hdr = (lv_font_bin_header_t){
+            .version = s_sub.key,
+            .magic = SUBSET_MAGIC,
+            .line_height = (uint16_t)lv_font_get_line_height(s_sub.base),
+            .base_line = (uint16_t)s_sub.base->base_line,
+            .bpp = 1,
+            .cmap_num = 1,
+            .glyph_dsc_offset = sizeof(lv_font_bin_header_t),
+            .glyph_bitmap_offset = sizeof(lv_font_bin_header_t) + s_sub.glyphs * FONT_STREAM_DSC_SIZE,
+        };
+        b->step = STEP_APPEND;
+    } else {
+        b->in = fopen(s_sub.fsb_path, "rb");
+        b->step = part != NULL ? STEP_ERASE : STEP_LOAD;
+    }
+
+    const bg_job_desc_t desc = {
+        .name = "font_subset_install",
+        .prio = BG_JOB_PRIO_LOW,
+        .mem_budget = sizeof(install_t),
+        .step = install_step,
+        .done = install_done,
+        .arg = b,
+    };
+    s_sub.job_done = false;
+    if (b->in == NULL || (s_sub.job = bg_jobs_submit(&desc)) == BG_JOB_NONE) {
+        // 没有提交：在这里收尾（与 install_done 相同）
+        s_sub.job = BG_JOB_NONE;
+        install_done(b, false);
+        s_sub.job_done = false;
+        return false;
+    }
+    s_sub.phase = PHASE_INSTALL;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 取字形（LVGL 任务中的定时器，字体只能在这里访问）
+// ---------------------------------------------------------------------------
+
+// 写出一个字形；字体里没有、不是 A1 或位图太大时返回 false，由当前字体照常提供
+static bool add_glyph(uint32_t cp, bool *io_error) {
+    const lv_font_t *font = s_sub.base;
+    lv_font_glyph_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    if (!font->get_glyph_dsc(font, &dsc, cp, 0) || dsc.is_placeholder) {
+        return false;
+    }
+    const uint32_t stride = (dsc.box_w + 7) / 8;
+    const uint32_t size = stride * dsc.box_h;
+    const void *bitmap = NULL;
+    bool usable = dsc.format == LV_FONT_GLYPH_FORMAT_A1 && dsc.stride == stride && size <= GLYPH_BITMAP_MAX;
+    if (usable && size > 0) {
+        dsc.resolved_font = font;
+        bitmap = font->get_glyph_bitmap(&dsc, NULL);
+        usable = bitmap != NULL;
+    }
+    if (usable) {
+        const lv_font_glyph_dsc_bin_t rec = {
+            .codepoint = cp,
+            .advance_x = dsc.adv_w,
+            .box_w = dsc.box_w,
+            .box_h = dsc.box_h,
+            .ofs_x = dsc.ofs_x,
+            .ofs_y = dsc.ofs_y,
+            .bitmap_offset = s_sub.bitmap_bytes,
+        };
+        uint8_t raw[FONT_STREAM_DSC_SIZE] = {0};
+        memcpy(raw, &rec, sizeof(rec));
+        if (fwrite(raw, sizeof(raw), 1, s_sub.dsc_out) != 1 ||
+            (size > 0 && fwrite(bitmap, 1, size, s_sub.bmp_out) != size)) {
+            *io_error = true;
+        }
+        s_sub.bitmap_bytes += size;
+        s_sub.glyphs++;
+    }
+    if (font->release_glyph != NULL) {
+        font->release_glyph(font, &dsc);
+    }
+    return usable;
+}
+
+static void start_extract(void) {
+    const uint32_t count = charset_count(s_sub.charset);
+    mkdir(PAGE_INDEX_DIR, 0775);
+    s_sub.dsc_out = fopen(s_sub.fsb_path, "wb");
+    s_sub.bmp_out = fopen(s_sub.tmp_path, "wb");
+    // 先占住文件头的位置，拼装完成后再写入真正的文件头
+    const lv_font_bin_header_t blank = {0};
+    if (count == 0 || s_sub.dsc_out == NULL || s_sub.bmp_out == NULL ||
+        fwrite(&blank, sizeof(blank), 1, s_sub.dsc_out) != 1) {
+        ESP_LOGW(TAG, "Cannot start the subset (%u chars, errno=%d)", (unsigned)count, errno);
+        teardown();
+        return;
+    }
+    s_sub.next_cp = 0;
+    s_sub.glyphs = 0;
+    s_sub.bitmap_bytes = 0;
+    s_sub.phase = PHASE_EXTRACT;
+    ESP_LOGI(TAG, "Extracting %u glyphs at %d px", (unsigned)count, (int)lv_font_get_line_height(s_sub.base));
+}
+
+static void extract_slice(void) {
+    const int64_t start = esp_timer_get_time();
+    bool io_error = false;
+    while (s_sub.next_cp < 0x10000 && !io_error &&
+           esp_timer_get_time() - start < FONT_SUBSET_SLICE_MS * 1000) {
+        uint32_t cps[SLICE_GLYPHS];
+        uint32_t n = 0;
+        uint32_t cp = s_sub.next_cp;
+        for (; cp < 0x10000 && n < SLICE_GLYPHS; cp++) {
+            if (charset_has(s_sub.charset, cp)) {
+                cps[n++] = cp;
+            }
+        }
+        s_sub.next_cp = cp;
+        // 流式字体：一批未缓存的字形合并成少数几次顺序读取
+        font_stream_prefetch(s_sub.base, cps, n);
+        for (uint32_t i = 0; i < n && !io_error; i++) {
+            if (!add_glyph(cps[i], &io_error)) {
+                s_sub.charset[cps[i] >> 3] &= (uint8_t)~(1u << (cps[i] & 7));
+            }
+        }
+    }
+    if (io_error) {
+        ESP_LOGW(TAG, "Subset write failed");
+        teardown();
+        return;
+    }
+    if (s_sub.next_cp < 0x10000) {
+        return;
+    }
+
+    fclose(s_sub.bmp_out);
+    s_sub.bmp_out = NULL;
+    FILE *out = s_sub.dsc_out;
+    s_sub.dsc_out = NULL;
+    const uint32_t size = subset_file_size(s_sub.glyphs, s_sub.bitmap_bytes);
+    ESP_LOGI(TAG, "Extracted %u glyphs (%u bitmap bytes)", (unsigned)s_sub.glyphs, (unsigned)s_sub.bitmap_bytes);
+    if (s_sub.glyphs == 0 || !start_install(out, size)) {
+        if (s_sub.phase == PHASE_EXTRACT) {
+            fclose(out);
+            remove(s_sub.fsb_path);
+            remove(s_sub.tmp_path);
+        }
+        teardown();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 生效与撤下
+// ---------------------------------------------------------------------------
+
+static bool trim_subset(size_t want, void *arg);
+
+static void deactivate(void) {
+    if (s_sub.font == NULL) {
+        return;
+    }
+    mem_pressure_unregister(trim_subset, NULL);
+    font_manager_set_subset_font(NULL, NULL);
+    font_stream_destroy(s_sub.font);
+    s_sub.font = NULL;
+    if (s_sub.mapped) {
+        esp_partition_munmap(s_sub.mmap);
+        s_sub.mapped = false;
+    }
+    heap_stats_free(HEAP_TAG_FONT, s_sub.ram);
+    s_sub.ram = NULL;
+}
+
+// 内存中的子集在内存紧张时丢掉，字形退回从 SD 卡读
+static bool trim_subset(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    if (s_sub.ram == NULL) {
+        return false;
+    }
+    ESP_LOGW(TAG, "Dropping the %u-byte subset font", (unsigned)s_sub.size);
+    deactivate();
+    s_sub.phase = PHASE_NONE;
+    return true;
+}
+
+static bool activate(const uint8_t *data, uint32_t size) {
+    lv_font_bin_header_t hdr;
+    if (size < sizeof(hdr)) {
+        return false;
+    }
+    memcpy(&hdr, data, sizeof(hdr));
+    if (!header_valid(&hdr, size)) {
+        return false;
+    }
+    s_sub.font = font_stream_create_mapped(data, size, s_sub.fsb_path);
+    if (s_sub.font == NULL) {
+        return false;
+    }
+    s_sub.size = size;
+    font_manager_set_subset_font(s_sub.font, s_sub.base);
+    s_sub.phase = PHASE_ACTIVE;
+    ESP_LOGI(TAG, "Subset font active: %u bytes in %s", (unsigned)size, s_sub.mapped ? "flash" : "RAM");
+    return true;
+}
+
+// 分区区域中已是这本书这个字号的子集时直接映射
+static bool activate_region(void) {
+    const esp_partition_t *part = region_partition();
+    region_header_t rh;
+    if (part == NULL || esp_partition_read(part, region_base(part), &rh, sizeof(rh)) != ESP_OK ||
+        rh.magic != REGION_MAGIC || rh.key != s_sub.key ||
+        rh.size > FONT_MANAGER_SUBSET_REGION - REGION_DATA_OFFSET) {
+        return false;
+    }
+    const void *data = NULL;
+    if (esp_partition_mmap(part, region_base(part) + REGION_DATA_OFFSET, rh.size, ESP_PARTITION_MMAP_DATA,
+                           &data, &s_sub.mmap) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map the subset region");
+        return false;
+    }
+    s_sub.mapped = true;
+    if (!activate((const uint8_t *)data, rh.size)) {
+        esp_partition_munmap(s_sub.mmap);
+        s_sub.mapped = false;
+        return false;
+    }
+    return true;
+}
+
+static void install_finished(void) {
+    if (!s_sub.job_ok) {
+        teardown();
+        return;
+    }
+    if (s_sub.loaded != NULL) {
+        s_sub.ram = s_sub.loaded;
+        s_sub.loaded = NULL;
+        if (activate(s_sub.ram, s_sub.size)) {
+            mem_pressure_register("font_subset", MEM_PRESSURE_PRIO_WORKING, HEAP_TAG_FONT, 0, trim_subset, NULL);
+            return;
+        }
+    } else if (activate_region()) {
+        return;
+    }
+    ESP_LOGW(TAG, "Installed subset is not usable");
+    teardown();
+}
+
+// ---------------------------------------------------------------------------
+// 调度
+// ---------------------------------------------------------------------------
+
+// 已有完整的子集文件时返回其长度，否则返回 0
+static uint32_t cached_file_size(void) {
+    FILE *f = fopen(s_sub.fsb_path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+    lv_font_bin_header_t hdr;
+    const bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && fseek(f, 0, SEEK_END) == 0;
+    const long size = ok ? ftell(f) : 0;
+    fclose(f);
+    return ok && size > 0 && header_valid(&hdr, (uint32_t)size) ? (uint32_t)size : 0;
+}
+
+// 按当前字体决定指纹，依次尝试：分区中已有、SD 卡上已有、重新建立
+static void prepare(void) {
+    s_sub.base = font_loader_get_current_font();
+    s_sub.phase = PHASE_NONE;
+    if (s_sub.base == NULL || !font_manager_current_is_streamed()) {
+        return;
+    }
+    const char *font_path = font_manager_get_stream_font_path();
+    const int32_t params[] = {lv_font_get_line_height(s_sub.base), font_manager_get_scaled_size(),
+                              font_manager_get_ttf_size()};
+    uint32_t key = page_index_hash(s_sub.book_key, font_path, strlen(font_path));
+    s_sub.key = page_index_hash(key, params, sizeof(params));
+    snprintf(s_sub.fsb_path, sizeof(s_sub.fsb_path), "%s/%08x.fsb", PAGE_INDEX_DIR, (unsigned)s_sub.key);
+    snprintf(s_sub.tmp_path, sizeof(s_sub.tmp_path), "%s/%08x.fst", PAGE_INDEX_DIR, (unsigned)s_sub.key);
+
+    if (activate_region()) {
+        return;
+    }
+    const uint32_t size = cached_file_size();
+    if (size > 0) {
+        ESP_LOGI(TAG, "Installing %s", s_sub.fsb_path);
+        start_install(NULL, size);
+        return;
+    }
+    start_scan();
+}
+
+// 放弃进行中的工作并撤下子集（书保持打开）
+static void teardown(void) {
+    if (s_sub.job != BG_JOB_NONE) {
+        bg_jobs_cancel(s_sub.job);
+        s_sub.job = BG_JOB_NONE;
+    }
+    s_sub.gen++;     // 被取消的作业结束时不再交回结果
+    s_sub.job_done = false;
+    if (s_sub.dsc_out != NULL) {
+        fclose(s_sub.dsc_out);
+        s_sub.dsc_out = NULL;
+        remove(s_sub.fsb_path);
+    }
+    if (s_sub.bmp_out != NULL) {
+        fclose(s_sub.bmp_out);
+        s_sub.bmp_out = NULL;
+        remove(s_sub.tmp_path);
+    }
+    deactivate();
+    heap_stats_free(HEAP_TAG_FONT, s_sub.charset);
+    s_sub.charset = NULL;
+    heap_stats_free(HEAP_TAG_FONT, s_sub.loaded);
+    s_sub.loaded = NULL;
+    s_sub.phase = PHASE_NONE;
+}
+
+static void subset_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    // 换了字体或字号：按新的指纹重新准备
+    if (font_loader_get_current_font() != s_sub.base) {
+        teardown();
+        prepare();
+        return;
+    }
+    switch (s_sub.phase) {
+    case PHASE_SCAN:
+        if (s_sub.job_done) {
+            s_sub.job_done = false;
+            s_sub.job = BG_JOB_NONE;
+            if (s_sub.job_ok && s_sub.charset != NULL) {
+                start_extract();
+            } else {
+                teardown();
+            }
+        }
+        break;
+    case PHASE_EXTRACT:
+        extract_slice();
+        break;
+    case PHASE_INSTALL:
+        if (s_sub.job_done) {
+            s_sub.job_done = false;
+            s_sub.job = BG_JOB_NONE;
+            install_finished();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void font_subset_open(const font_subset_config_t *cfg) {
+    font_subset_close();
+    if (cfg == NULL || cfg->file_path == NULL || cfg->file_size <= 0) {
+        return;
+    }
+    struct stat st;
+    const uint32_t mtime = stat(cfg->file_path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    uint32_t key = page_index_hash(0, cfg->file_path, strlen(cfg->file_path));
+    key = page_index_hash(key, &cfg->file_size, sizeof(cfg->file_size));
+    s_sub.book_key = page_index_hash(key, &mtime, sizeof(mtime));
+
+    strncpy(s_sub.book_path, cfg->file_path, sizeof(s_sub.book_path) - 1);
+    s_sub.cfg = *cfg;
+    s_sub.cfg.file_path = s_sub.book_path;
+    s_sub.timer = lv_timer_create(subset_timer_cb, FONT_SUBSET_POLL_MS, NULL);
+    if (s_sub.timer == NULL) {
+        return;
+    }
+    s_sub.open = true;
+    prepare();
+}
+
+void font_subset_close(void) {
+    if (!s_sub.open) {
+        return;
+    }
+    teardown();
+    lv_timer_delete(s_sub.timer);
+    const uint32_t gen = s_sub.gen;
+    memset(&s_sub, 0, sizeof(s_sub));
+    s_sub.gen = gen;
+}
+
+bool font_subset_is_active(void) {
+    return s_sub.open && s_sub.phase == PHASE_ACTIVE;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file font_subset.h
+ * @brief 书籍子集字体 - 把一本书用到的字按当前字号取出，存成常驻 flash 或内存的小字体
+ *
+ * 一本书通常只用到两三千个不同的汉字，流式字体却每个字形都要从几 MB 的字体文件里读。
+ * 当前字体要从 SD 卡读（流式位图字体或 TrueType，见 font_manager_current_is_streamed）时，
+ * 打开 TXT 书后：
+ *   1. 后台作业（bg_jobs）顺序读一遍正文，收集用到的 BMP 码点（8 KB 位图）
+ *   2. LVGL 任务中的定时器分批从当前字体取出这些字形（字形缓存中已转为 A1、按字号缩放
+ *      好的位图，与渲染时完全一致），写成 font_stream.h 布局的子集字体
+ *      /sdcard/.x4cache/<hash>.fsb；hash 由书籍指纹（路径、大小、修改时间）和字体（路径、
+ *      行高、字号）决定，换字体或字号就是另一个文件
+ *   3. 子集复制到字体分区末尾的 FONT_MANAGER_SUBSET_REGION 后经 MMU 映射；没有字体分区时
+ *      放得下缓存预算就整体读入内存（内存紧张时丢掉，退回流式字体）
+ *   4. font_manager_set_subset_font 把它插到回退链最前面：书中的字只在 flash / 内存中查，
+ *      不再访问 SD 卡；子集里没有的字（界面文字等）照常由当前字体提供
+ * 分区里的子集保留到下一本书替换它，再打开同一本书时直接映射。字体或字号改变后按新的
+ * 指纹重新准备。只在 LVGL 任务中调用
+ */
+
+#ifndef FONT_SUBSET_H
+#define FONT_SUBSET_H
+
+#include "txt_reader.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FONT_SUBSET_POLL_MS    100     // 取字形的定时器周期
+#define FONT_SUBSET_SLICE_MS   15      // 每次定时器最多占用 LVGL 任务的时间
+#define FONT_SUBSET_HEAP_SHARE 4       // 没有字体分区时，子集最多占缓存预算的 1/N
+
+typedef struct {
+    const char *file_path;       // 书籍路径
+    long file_size;
+    long content_start;          // 正文起点（跳过 BOM）
+    txt_encoding_t encoding;     // 文件编码（已检测，不是 AUTO）
+} font_subset_config_t;
+
+/**
+ * @brief 为书籍准备子集字体：分区中已有时立即生效，否则在后台建立
+ *
+ * 之前打开的书先关闭。当前字体不需要读 SD 卡时什么也不做
+ */
+void font_subset_open(const font_subset_config_t *cfg);
+
+/**
+ * @brief 退出回退链并释放子集字体，取消未完成的建立
+ */
+void font_subset_close(void);
+
+/**
+ * @brief 子集字体是否已在回退链中
+ */
+bool font_subset_is_active(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_SUBSET_H
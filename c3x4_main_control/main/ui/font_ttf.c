@@ -0,0 +1,495 @@
+/**
+ * @file font_ttf.c
+ * @brief TrueType 字体实现：tiny_ttf 光栅化 + SD 卡持久字形缓存
+ *
+ * 缓存文件：文件头 + 追加写入的字形记录（记录头 + 1bpp 位图，每行按字节对齐）。
+ * 字体中没有的字符也写一条记录，避免每次都去查 TTF。掉电留下的半条记录在打开时
+ * 丢弃，之后从最后一条完整记录处继续写
+ */
+
+#include "font_ttf.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+static const char *TAG = "FONT_TTF";
+
+#define TTF_CACHE_MAGIC 0x43473458u     // "X4GC"
+#define TTF_CACHE_VERSION 1
+#define TTF_RECORD_MISSING 0x01
+#define TTF_INDEX_MIN 256               // 索引初始大小（2 的幂，负载不超过一半）
+#define TTF_SLOT_BUDGET (16 * 1024)     // 槽位缓存的位图总字节数
+#define TTF_SLOTS_MIN 8
+#define TTF_SLOTS_MAX 64
+#define TTF_RENDER_CACHE 4              // tiny_ttf 内部缓存的字形数（结果已持久化，够用即可）
+#define TTF_EMPTY 0xFFFFFFFFu
+
+#define TTF_RASTERIZER (LV_USE_TINY_TTF && LV_TINY_TTF_FILE_SUPPORT)
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;              // 字号
+    uint32_t ttf_size;          // 来源 TTF 的大小与修改时间
+    uint32_t ttf_mtime;
+    int16_t line_height;
+    int16_t base_line;
+    int16_t underline_position;
+    int16_t underline_thickness;
+    uint32_t reserved[2];
+} ttf_cache_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t unicode;
+    uint16_t adv_w;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+    uint8_t flags;              // TTF_RECORD_MISSING
+    uint8_t reserved;
+} ttf_record_t;
+
+// 索引项：码点 -> 记录在文件中的偏移
+typedef struct {
+    uint32_t unicode;           // TTF_EMPTY 表示空
+    uint32_t offset;
+} ttf_index_t;
+
+// 槽位：按码点哈希直接映射，存放最近读出的字形
+typedef struct {
+    uint32_t unicode;           // TTF_EMPTY 表示空
+    ttf_record_t record;
+    uint8_t *bitmap;
+} ttf_slot_t;
+
+typedef struct {
+    FILE *fp;                   // 缓存文件
+    uint32_t data_end;          // 最后一条完整记录之后（追加写入位置）
+    lv_font_t *ttf;             // tiny_ttf 字体（未启用或打开失败时为 NULL，只用缓存）
+    int size;
+    uint16_t max_box;           // 字形边框上限（超出部分裁掉，保证放得进槽位）
+
+    ttf_index_t *index;
+    uint32_t index_mask;
+    uint32_t index_count;
+
+    ttf_slot_t *slots;
+    uint32_t slot_count;
+    uint32_t slot_bytes;
+    uint8_t *slot_bits;
+
+    uint32_t rendered;          // 本次打开后新光栅化的字形数
+} ttf_font_ctx_t;
+
+static uint32_t ttf_hash(uint32_t unicode)
+{
+    return unicode * 2654435761u;
+}
+
+static uint32_t record_bitmap_size(const ttf_record_t *rec)
+{
+    return (uint32_t)((rec->box_w + 7) / 8) * rec->box_h;
+}
+
+bool font_ttf_is_ttf_path(const char *path)
+{
+    const char *dot = path != NULL ? strrchr(path, '.') : NULL;
+    return dot != NULL && (strcasecmp(dot, ".ttf") == 0 || strcasecmp(dot, ".otf") == 0);
+}
+
+// ---------------------------------------------------------------------------
+// 索引
+// ---------------------------------------------------------------------------
+
+static bool index_alloc(ttf_font_ctx_t *ctx, uint32_t size)
+{
+    ttf_index_t *index = (ttf_index_t *)malloc(size * sizeof(ttf_index_t));
+    if (index == NULL) {
+        return false;
+    }
+    memset(index, 0xFF, size * sizeof(ttf_index_t));
+    ttf_index_t *old = ctx->index;
+    const uint32_t old_size = old != NULL ? ctx->index_mask + 1 : 0;
+    ctx->index = index;
+    ctx->index_mask = size - 1;
+    for (uint32_t i = 0; i < old_size; i++) {
+        if (old[i].unicode == TTF_EMPTY) {
+            continue;
+        }
+        uint32_t pos = ttf_hash(old[i].unicode) & ctx->index_mask;
+        while (index[pos].unicode != TTF_EMPTY) {
+            pos = (pos + 1) & ctx->index_mask;
+        }
+        index[pos] = old[i];
+    }
+    free(old);
+    return true;
+}
+
+static const ttf_index_t *index_find(const ttf_font_ctx_t *ctx, uint32_t unicode)
+{
+    for (uint32_t pos = ttf_hash(unicode) & ctx->index_mask;; pos = (pos + 1) & ctx->index_mask) {
+        const ttf_index_t *entry = &ctx->index[pos];
+        if (entry->unicode == unicode) {
+            return entry;
+        }
+        if (entry->unicode == TTF_EMPTY) {
+            return NULL;
+        }
+    }
+}
+
+// 登记一条记录（同一码点以后写的为准；内存不够扩容时返回 false，字形仍可使用）
+static bool index_insert(ttf_font_ctx_t *ctx, uint32_t unicode, uint32_t offset)
+{
+    if ((ctx->index_count + 1) * 2 > ctx->index_mask + 1 &&
+        !index_alloc(ctx, (ctx->index_mask + 1) * 2)) {
+        return false;
+    }
+    uint32_t pos = ttf_hash(unicode) & ctx->index_mask;
+    while (ctx->index[pos].unicode != TTF_EMPTY && ctx->index[pos].unicode != unicode) {
+        pos = (pos + 1) & ctx->index_mask;
+    }
+    if (ctx->index[pos].unicode == TTF_EMPTY) {
+        ctx->index_count++;
+    }
+    ctx->index[pos].unicode = unicode;
+    ctx->index[pos].offset = offset;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 缓存文件
+// ---------------------------------------------------------------------------
+
+static void cache_file_path(const char *ttf_path, int size, char *out, size_t out_size)
+{
+    uint32_t hash = 2166136261u;    // FNV-1a
+    for (const char *p = ttf_path; *p != '\0'; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+    snprintf(out, out_size, FONT_TTF_CACHE_DIR "/%08lx_%d.glc", (unsigned long)hash, size);
+}
+
+// 扫描记录建立索引，返回 false 表示文件头不匹配（需要重建）
+static bool cache_load(ttf_font_ctx_t *ctx, const struct stat *ttf_st, ttf_cache_header_t *header)
+{
+    fseek(ctx->fp, 0, SEEK_SET);
+    if (fread(header, 1, sizeof(*header), ctx->fp) != sizeof(*header) ||
+        header->magic != TTF_CACHE_MAGIC || header->version != TTF_CACHE_VERSION ||
+        header->size != ctx->size || header->ttf_size != (uint32_t)ttf_st->st_size ||
+        header->ttf_mtime != (uint32_t)ttf_st->st_mtime) {
+        return false;
+    }
+
+    fseek(ctx->fp, 0, SEEK_END);
+    const long file_size = ftell(ctx->fp);
+    uint32_t offset = sizeof(*header);
+    ttf_record_t rec;
+    while (fseek(ctx->fp, (long)offset, SEEK_SET) == 0 &&
+           fread(&rec, 1, sizeof(rec), ctx->fp) == sizeof(rec)) {
+        const uint32_t next = offset + sizeof(rec) + record_bitmap_size(&rec);
+        if ((long)next > file_size) {
+            break;      // 掉电留下的半条记录
+        }
+        index_insert(ctx, rec.unicode, offset);
+        offset = next;
+    }
+    ctx->data_end = offset;
+    return true;
+}
+
+static bool cache_write_header(ttf_font_ctx_t *ctx, const struct stat *ttf_st,
+                               const ttf_cache_header_t *metrics)
+{
+    ttf_cache_header_t header = *metrics;
+    header.magic = TTF_CACHE_MAGIC;
+    header.version = TTF_CACHE_VERSION;
+    header.size = (uint16_t)ctx->size;
+    header.ttf_size = (uint32_t)ttf_st->st_size;
+    header.ttf_mtime = (uint32_t)ttf_st->st_mtime;
+    memset(header.reserved, 0, sizeof(header.reserved));
+    fseek(ctx->fp, 0, SEEK_SET);
+    if (fwrite(&header, 1, sizeof(header), ctx->fp) != sizeof(header) || fflush(ctx->fp) != 0) {
+        return false;
+    }
+    ctx->data_end = sizeof(header);
+    return true;
+}
+
+// 追加一条记录（写失败时字形仍可使用，只是下次还要重新光栅化）
+static void cache_append(ttf_font_ctx_t *ctx, const ttf_record_t *rec, const uint8_t *bitmap)
+{
+    const uint32_t bitmap_size = record_bitmap_size(rec);
+    fseek(ctx->fp, (long)ctx->data_end, SEEK_SET);
+    if (fwrite(rec, 1, sizeof(*rec), ctx->fp) != sizeof(*rec) ||
+        (bitmap_size > 0 && fwrite(bitmap, 1, bitmap_size, ctx->fp) != bitmap_size) ||
+        fflush(ctx->fp) != 0) {
+        ESP_LOGW(TAG, "Failed to append glyph U+%04lX to cache", (unsigned long)rec->unicode);
+        return;
+    }
+    index_insert(ctx, rec->unicode, ctx->data_end);
+    ctx->data_end += sizeof(*rec) + bitmap_size;
+}
+
+// ---------------------------------------------------------------------------
+// 光栅化
+// ---------------------------------------------------------------------------
+
+#if TTF_RASTERIZER
+// 用 tiny_ttf 渲染一个字形，8 位灰度按 50% 二值化；返回 false 表示渲染失败（不写缓存）
+static bool rasterize_glyph(ttf_font_ctx_t *ctx, uint32_t unicode, ttf_record_t *rec,
+                            uint8_t *bitmap)
+{
+    memset(rec, 0, sizeof(*rec));
+    rec->unicode = unicode;
+
+    lv_font_glyph_dsc_t g;
+    memset(&g, 0, sizeof(g));
+    if (!lv_font_get_glyph_dsc(ctx->ttf, &g, unicode, 0)) {
+        rec->flags = TTF_RECORD_MISSING;
+        return true;
+    }
+    rec->adv_w = g.adv_w;
+    rec->ofs_x = (int8_t)g.ofs_x;
+    rec->ofs_y = (int8_t)g.ofs_y;
+    rec->box_w = (uint8_t)(g.box_w < ctx->max_box ? g.box_w : ctx->max_box);
+    rec->box_h = (uint8_t)(g.box_h < ctx->max_box ? g.box_h : ctx->max_box);
+    if (rec->box_w == 0 || rec->box_h == 0) {
+        rec->box_w = rec->box_h = 0;
+        return true;
+    }
+
+    const lv_draw_buf_t *buf = (const lv_draw_buf_t *)lv_font_get_glyph_bitmap(&g, NULL);
+    if (buf == NULL) {
+        lv_font_glyph_release_draw_data(&g);
+        return false;
+    }
+    const uint32_t stride = (rec->box_w + 7) / 8;
+    memset(bitmap, 0, stride * rec->box_h);
+    for (uint32_t y = 0; y < rec->box_h; y++) {
+        const uint8_t *src = buf->data + y * buf->header.stride;
+        uint8_t *dst = bitmap + y * stride;
+        for (uint32_t x = 0; x < rec->box_w; x++) {
+            if (src[x] >= 0x80) {
+                dst[x >> 3] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+    lv_font_glyph_release_draw_data(&g);
+    ctx->rendered++;
+    return true;
+}
+#endif
+
+// 取字形到槽位：先查槽位，再查缓存文件，都没有时光栅化并写入缓存
+static ttf_slot_t *get_glyph(ttf_font_ctx_t *ctx, uint32_t unicode)
+{
+    ttf_slot_t *slot = &ctx->slots[(ttf_hash(unicode) >> 16) % ctx->slot_count];
+    if (slot->unicode == unicode) {
+        return slot;
+    }
+
+    slot->unicode = TTF_EMPTY;
+    const ttf_index_t *entry = index_find(ctx, unicode);
+    if (entry != NULL) {
+        fseek(ctx->fp, (long)entry->offset, SEEK_SET);
+        if (fread(&slot->record, 1, sizeof(slot->record), ctx->fp) != sizeof(slot->record)) {
+            return NULL;
+        }
+        const uint32_t bitmap_size = record_bitmap_size(&slot->record);
+        if (bitmap_size > ctx->slot_bytes ||
+            (bitmap_size > 0 && fread(slot->bitmap, 1, bitmap_size, ctx->fp) != bitmap_size)) {
+            return NULL;
+        }
+        slot->unicode = unicode;
+        return slot;
+    }
+
+#if TTF_RASTERIZER
+    if (ctx->ttf != NULL && rasterize_glyph(ctx, unicode, &slot->record, slot->bitmap)) {
+        cache_append(ctx, &slot->record, slot->bitmap);
+        slot->unicode = unicode;
+        return slot;
+    }
+#endif
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------
+// LVGL 回调
+// ---------------------------------------------------------------------------
+
+static bool ttf_get_glyph_dsc_cb(const lv_font_t *font, lv_font_glyph_dsc_t *dsc,
+                                 uint32_t unicode, uint32_t unicode_next)
+{
+    (void)unicode_next;
+
+    ttf_font_ctx_t *ctx = (ttf_font_ctx_t *)font->user_data;
+    ttf_slot_t *slot = ctx != NULL ? get_glyph(ctx, unicode) : NULL;
+    if (slot == NULL || (slot->record.flags & TTF_RECORD_MISSING)) {
+        return false;
+    }
+
+    dsc->adv_w = slot->record.adv_w;
+    dsc->box_w = slot->record.box_w;
+    dsc->box_h = slot->record.box_h;
+    dsc->ofs_x = slot->record.ofs_x;
+    dsc->ofs_y = slot->record.ofs_y;
+    dsc->stride = (slot->record.box_w + 7) / 8;
+    dsc->format = LV_FONT_GLYPH_FORMAT_A1;
+    dsc->is_placeholder = 0;
+    dsc->req_raw_bitmap = 0;
+    dsc->outline_stroke_width = 0;
+    dsc->gid.src = slot->bitmap;
+    return true;
+}
+
+static const void *ttf_get_bitmap_cb(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf)
+{
+    (void)draw_buf;
+    return dsc != NULL ? dsc->gid.src : NULL;
+}
+
+// ---------------------------------------------------------------------------
+// 创建与销毁
+// ---------------------------------------------------------------------------
+
+static void ctx_free(ttf_font_ctx_t *ctx)
+{
+#if TTF_RASTERIZER
+    if (ctx->ttf != NULL) {
+        lv_tiny_ttf_destroy(ctx->ttf);
+    }
+#endif
+    if (ctx->fp != NULL) {
+        fclose(ctx->fp);
+    }
+    free(ctx->index);
+    free(ctx->slots);
+    free(ctx->slot_bits);
+    free(ctx);
+}
+
+static bool init_slots(ttf_font_ctx_t *ctx)
+{
+    ctx->slot_bytes = (uint32_t)((ctx->max_box + 7) / 8) * ctx->max_box;
+    uint32_t count = TTF_SLOT_BUDGET / ctx->slot_bytes;
+    if (count < TTF_SLOTS_MIN) {
+        count = TTF_SLOTS_MIN;
+    } else if (count > TTF_SLOTS_MAX) {
+        count = TTF_SLOTS_MAX;
+    }
+    ctx->slots = (ttf_slot_t *)calloc(count, sizeof(ttf_slot_t));
+    ctx->slot_bits = (uint8_t *)malloc(count * ctx->slot_bytes);
+    if (ctx->slots == NULL || ctx->slot_bits == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        ctx->slots[i].unicode = TTF_EMPTY;
+        ctx->slots[i].bitmap = ctx->slot_bits + i * ctx->slot_bytes;
+    }
+    ctx->slot_count = count;
+    return true;
+}
+
+lv_font_t *font_ttf_create(const char *path, int size)
+{
+    struct stat st;
+    if (path == NULL || size < FONT_TTF_SIZE_MIN || size > FONT_TTF_SIZE_MAX ||
+        stat(path, &st) != 0) {
+        ESP_LOGE(TAG, "Cannot open TTF %s at %d px", path != NULL ? path : "(null)", size);
+        return NULL;
+    }
+
+    ttf_font_ctx_t *ctx = (ttf_font_ctx_t *)calloc(1, sizeof(ttf_font_ctx_t));
+    if (ctx == NULL) {
+        return NULL;
+    }
+    ctx->size = size;
+    ctx->max_box = (uint16_t)(size * 2);
+    if (!init_slots(ctx) || !index_alloc(ctx, TTF_INDEX_MIN)) {
+        ESP_LOGE(TAG, "Failed to allocate glyph cache");
+        ctx_free(ctx);
+        return NULL;
+    }
+
+    ttf_cache_header_t metrics;
+    memset(&metrics, 0, sizeof(metrics));
+#if TTF_RASTERIZER
+    // LVGL 文件系统路径：S: 驱动映射到 /sdcard
+    char lv_path[280];
+    if (strncmp(path, "/sdcard/", 8) == 0) {
+        snprintf(lv_path, sizeof(lv_path), "S:/%s", path + 8);
+        ctx->ttf = lv_tiny_ttf_create_file_ex(lv_path, size, LV_FONT_KERNING_NONE, TTF_RENDER_CACHE);
+    }
+    if (ctx->ttf != NULL) {
+        metrics.line_height = (int16_t)ctx->ttf->line_height;
+        metrics.base_line = (int16_t)ctx->ttf->base_line;
+        metrics.underline_position = ctx->ttf->underline_position;
+        metrics.underline_thickness = (int16_t)ctx->ttf->underline_thickness;
+    } else {
+        ESP_LOGW(TAG, "TTF rasterizer unavailable for %s, using cached glyphs only", path);
+    }
+#endif
+
+    char cache_path[64];
+    cache_file_path(path, size, cache_path, sizeof(cache_path));
+    mkdir("/sdcard/.x4cache", 0775);
+    mkdir(FONT_TTF_CACHE_DIR, 0775);
+    ctx->fp = fopen(cache_path, "r+b");
+    ttf_cache_header_t header;
+    if (ctx->fp == NULL || !cache_load(ctx, &st, &header)) {
+        if (ctx->ttf == NULL) {
+            ESP_LOGE(TAG, "No glyph cache for %s at %d px", path, size);
+            ctx_free(ctx);
+            return NULL;
+        }
+        if (ctx->fp != NULL) {
+            fclose(ctx->fp);
+        }
+        ctx->fp = fopen(cache_path, "w+b");
+        if (ctx->fp == NULL || !cache_write_header(ctx, &st, &metrics)) {
+            ESP_LOGE(TAG, "Failed to create glyph cache %s", cache_path);
+            ctx_free(ctx);
+            return NULL;
+        }
+        header = metrics;
+    }
+
+    lv_font_t *font = (lv_font_t *)calloc(1, sizeof(lv_font_t));
+    if (font == NULL) {
+        ctx_free(ctx);
+        return NULL;
+    }
+    font->line_height = header.line_height;
+    font->base_line = header.base_line;
+    font->underline_position = (int8_t)header.underline_position;
+    font->underline_thickness = (uint8_t)header.underline_thickness;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->user_data = ctx;
+    font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
+    font->get_glyph_bitmap = ttf_get_bitmap_cb;
+
+    ESP_LOGI(TAG, "Opened TTF %s at %d px (%lu cached glyphs, %lu slots)", path, size,
+             (unsigned long)ctx->index_count, (unsigned long)ctx->slot_count);
+    return font;
+}
+
+void font_ttf_destroy(lv_font_t *font)
+{
+    if (font == NULL) {
+        return;
+    }
+    ttf_font_ctx_t *ctx = (ttf_font_ctx_t *)font->user_data;
+    if (ctx != NULL) {
+        ESP_LOGI(TAG, "Closing TTF font (%lu glyphs rendered this session)",
+                 (unsigned long)ctx->rendered);
+        ctx_free(ctx);
+    }
+    free(font);
+}
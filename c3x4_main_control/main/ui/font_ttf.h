@@ -0,0 +1,49 @@
+/**
+ * @file font_ttf.h
+ * @brief TrueType 字体 - 按需光栅化任意字号，字形持久缓存到 SD 卡
+ *
+ * 字形第一次用到时由 LVGL 的 tiny_ttf（stb_truetype）从 SD 卡上的 TTF/OTF 光栅化，
+ * 二值化为 1bpp 后立即追加到该字体该字号的缓存文件
+ * （/sdcard/.x4cache/ttf/<路径哈希>_<字号>.glc）。打开字体时扫描缓存文件，在内存中
+ * 建立码点到文件偏移的索引，之后同一个字形直接从缓存文件读出，不再光栅化；
+ * 最近用到的字形放在一块直接映射的槽位缓存里。TTF 的大小或修改时间变化时缓存作废。
+ * 固件未启用 LV_USE_TINY_TTF 时只能使用已缓存的字形。所有函数都在 LVGL 任务中调用
+ */
+
+#ifndef FONT_TTF_H
+#define FONT_TTF_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FONT_TTF_CACHE_DIR "/sdcard/.x4cache/ttf"
+#define FONT_TTF_SIZE_MIN 12
+#define FONT_TTF_SIZE_MAX 64
+
+/**
+ * @brief 是否是 TrueType 字体文件（按扩展名 .ttf / .otf 判断）
+ */
+bool font_ttf_is_ttf_path(const char *path);
+
+/**
+ * @brief 打开 TrueType 字体
+ * @param path TTF/OTF 完整路径（/sdcard/...）
+ * @param size 字号（像素，FONT_TTF_SIZE_MIN ~ FONT_TTF_SIZE_MAX）
+ * @return LVGL 字体指针，失败返回 NULL
+ */
+lv_font_t *font_ttf_create(const char *path, int size);
+
+/**
+ * @brief 关闭字体（缓存文件已随时写入，无需额外保存）
+ */
+void font_ttf_destroy(lv_font_t *font);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FONT_TTF_H
@@ -0,0 +1,161 @@
+/**
+ * @file gb18030.c
+ * @brief GB18030/GBK → UTF-8 转码实现
+ */
+
+#include "gb18030.h"
+
+#define GB_REPLACEMENT 0xFFFD
+
+// 双字节区的一段：run 为 1 时 value 是首个码点（随次字节递增），否则是 gb2_literals 的下标
+typedef struct {
+    uint8_t trail;
+    uint8_t count;
+    uint8_t run;
+    uint16_t value;
+} gb2_seg_t;
+
+// 四字节区（BMP）：线性序号从 linear 起与码点 unicode 同步递增
+typedef struct {
+    uint32_t linear;
+    uint16_t unicode;
+} gb4_range_t;
+
+#include "gb18030_table.h"
+
+static uint32_t decode_two_byte(uint8_t lead, uint8_t trail) {
+    uint32_t lo = gb2_row_index[lead - GB2_LEAD_FIRST];
+    uint32_t hi = gb2_row_index[lead - GB2_LEAD_FIRST + 1];
+    // 行内各段按次字节升序排列
+    while (lo < hi) {
+        const uint32_t mid = (lo + hi) / 2;
+        const gb2_seg_t *seg = &gb2_segs[mid];
+        if (trail < seg->trail) {
+            hi = mid;
+        } else if (trail >= seg->trail + seg->count) {
+            lo = mid + 1;
+        } else {
+            const uint32_t k = trail - seg->trail;
+            return seg->run ? seg->value + k : gb2_literals[seg->value + k];
+        }
+    }
+    return GB_REPLACEMENT;
+}
+
+static uint32_t decode_four_byte(const uint8_t *s) {
+    const uint32_t linear = (((uint32_t)(s[0] - 0x81) * 10 + (s[1] - 0x30)) * 126 +
+                             (s[2] - 0x81)) * 10 + (s[3] - 0x30);
+    // 0x90308130 起为增补平面，按线性序号直接换算
+    const uint32_t supplementary = ((uint32_t)(0x90 - 0x81) * 10 * 126 * 10);
+    if (linear >= supplementary) {
+        const uint32_t cp = 0x10000 + (linear - supplementary);
+        return cp <= 0x10FFFF ? cp : GB_REPLACEMENT;
+    }
+
+    int lo = 0;
+    int hi = GB4_RANGE_COUNT - 1;
+    if (linear < gb4_ranges[0].linear) {
+        return GB_REPLACEMENT;
+    }
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (gb4_ranges[mid].linear <= linear) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    const uint32_t cp = gb4_ranges[lo].unicode + (linear - gb4_ranges[lo].linear);
+    // 区间之间的空洞没有映射；下一区间起点之前都属于本区间
+    return cp <= 0xFFFF ? cp : GB_REPLACEMENT;
+}
+
+int gb18030_decode(const uint8_t *s, size_t len, uint32_t *cp) {
+    if (len == 0) {
+        return 0;
+    }
+    const uint8_t c = s[0];
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    }
+    if (c == 0x80 || c == 0xFF) {
+        *cp = GB_REPLACEMENT;
+        return 1;
+    }
+    if (len < 2) {
+        return 0;
+    }
+    if (s[1] >= 0x30 && s[1] <= 0x39) {
+        if (len < 4) {
+            return 0;
+        }
+        if (s[2] < 0x81 || s[2] > 0xFE || s[3] < 0x30 || s[3] > 0x39) {
+            *cp = GB_REPLACEMENT;
+            return 1;
+        }
+        *cp = decode_four_byte(s);
+        return 4;
+    }
+    if (s[1] < 0x40 || s[1] == 0x7F || s[1] == 0xFF) {
+        // 非法次字节：只跳过首字节，次字节重新按 ASCII 处理
+        *cp = GB_REPLACEMENT;
+        return 1;
+    }
+    *cp = decode_two_byte(c, s[1]);
+    return 2;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    } else if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+size_t gb18030_to_utf8(const uint8_t *src, size_t src_len, bool at_eof, char *dst, size_t dst_size,
+                       size_t *src_used) {
+    size_t in = 0;
+    size_t out = 0;
+    char tmp[4];
+
+    while (in < src_len) {
+        uint32_t cp;
+        int n = gb18030_decode(&src[in], src_len - in, &cp);
+        if (n == 0) {
+            if (!at_eof) {
+                break;  // 不完整的末尾字符留给下一段
+            }
+            cp = GB_REPLACEMENT;
+            n = (int)(src_len - in);
+        }
+        const size_t m = utf8_encode(cp, tmp);
+        if (out + m > dst_size) {
+            break;
+        }
+        for (size_t i = 0; i < m; i++) {
+            dst[out + i] = tmp[i];
+        }
+        out += m;
+        in += (size_t)n;
+    }
+
+    if (src_used != NULL) {
+        *src_used = in;
+    }
+    return out;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file gb18030.h
+ * @brief GB18030/GBK → UTF-8 流式转码
+ *
+ * 查找表为 flash 中的常量（约 36 KB），转码不分配内存
+ */
+
+#ifndef GB18030_H
+#define GB18030_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 解码一个 GB18030 字符
+ * @param s 输入字节
+ * @param len 可用字节数
+ * @param cp 输出：Unicode 码点（非法序列为 U+FFFD）
+ * @return 消耗的字节数；0 表示 len 内字符不完整
+ */
+int gb18030_decode(const uint8_t *s, size_t len, uint32_t *cp);
+
+/**
+ * @brief 把一段 GB18030 文本转为 UTF-8
+ *
+ * 只转换完整的字符：dst 放不下或 src 末尾字符不完整时停止（at_eof 时不完整的末尾按 U+FFFD 输出）
+ *
+ * @param src 输入
+ * @param src_len 输入字节数
+ * @param at_eof src 之后是否已无数据
+ * @param dst 输出缓冲区（不写 NUL）
+ * @param dst_size 输出缓冲区大小
+ * @param src_used 输出：消耗的输入字节数
+ * @return 写入 dst 的字节数
+ */
+size_t gb18030_to_utf8(const uint8_t *src, size_t src_len, bool at_eof, char *dst, size_t dst_size,
+                       size_t *src_used);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GB18030_H
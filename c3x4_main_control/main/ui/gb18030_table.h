@@ -0,0 +1,1720 @@
+/**
+ * @file gb18030_table.h
+ * @brief Auto-generated GB18030 → Unicode table (only included by gb18030.c)
+ *
+ * Generated by generate_gb18030_table.py
+ */
+
+#ifndef GB18030_TABLE_H
+#define GB18030_TABLE_H
+
+#define GB2_LEAD_FIRST 0x81
+#define GB2_LEAD_LAST  0xFE
+#define GB4_RANGE_COUNT 206
+
+static const uint16_t gb2_row_index[127] = {
+    0, 21, 52, 74, 104, 127, 159, 185, 215, 243, 278, 303,
+    336, 366, 393, 417, 445, 477, 508, 545, 568, 600, 627, 661,
+    693, 707, 740, 764, 789, 820, 842, 878, 905, 910, 922, 927,
+    931, 935, 947, 957, 971, 984, 1002, 1022, 1038, 1050, 1070, 1083,
+    1098, 1111, 1126, 1142, 1158, 1178, 1192, 1205, 1218, 1233, 1252, 1263,
+    1278, 1282, 1287, 1293, 1301, 1324, 1340, 1353, 1375, 1393, 1406, 1424,
+    1444, 1460, 1478, 1495, 1510, 1528, 1546, 1566, 1584, 1605, 1614, 1625,
+    1631, 1636, 1641, 1647, 1663, 1666, 1680, 1693, 1707, 1710, 1719, 1735,
+    1748, 1765, 1770, 1777, 1782, 1786, 1790, 1798, 1803, 1808, 1821, 1835,
+    1849, 1858, 1865, 1879, 1892, 1898, 1901, 1919, 1932, 1935, 1949, 1957,
+    1960, 1963, 1966, 1981, 1997, 2009, 2015,
+};
+
+static const gb2_seg_t gb2_segs[2015] = {
+    {0x40, 31, 0, 0x0000}, {0x5F, 4, 1, 0x4E62}, {0x63, 2, 0, 0x001F}, {0x65, 6, 1, 0x4E6A},
+    {0x6B, 1, 0, 0x0021}, {0x6C, 10, 1, 0x4E74}, {0x76, 7, 1, 0x4E7F}, {0x7D, 2, 0, 0x0022},
+    {0x80, 13, 0, 0x0024}, {0x8D, 4, 1, 0x4EB6}, {0x91, 27, 0, 0x0031}, {0xAC, 7, 1, 0x4F02},
+    {0xB3, 2, 0, 0x004C}, {0xB5, 5, 1, 0x4F12}, {0xBA, 15, 0, 0x004E}, {0xC9, 5, 1, 0x4F3E},
+    {0xCE, 2, 0, 0x005D}, {0xD0, 6, 1, 0x4F47}, {0xD6, 14, 0, 0x005F}, {0xE4, 4, 1, 0x4F77},
+    {0xE8, 23, 0, 0x006D}, {0x40, 3, 0, 0x0084}, {0x43, 5, 1, 0x4FB0}, {0x48, 9, 1, 0x4FB6},
+    {0x51, 3, 0, 0x0087}, {0x54, 4, 1, 0x4FC6}, {0x58, 3, 0, 0x008A}, {0x5B, 5, 1, 0x4FD2},
+    {0x60, 11, 0, 0x008D}, {0x6B, 4, 1, 0x4FF4}, {0x6F, 4, 0, 0x0098}, {0x73, 12, 1, 0x4FFF},
+    {0x80, 17, 0, 0x009C}, {0x91, 11, 1, 0x502F}, {0x9C, 2, 0, 0x00AD}, {0x9E, 4, 1, 0x503F},
+    {0xA2, 7, 0, 0x00AF}, {0xA9, 5, 1, 0x5050}, {0xAE, 4, 1, 0x5056}, {0xB2, 1, 0, 0x00B6},
+    {0xB3, 8, 1, 0x505D}, {0xBB, 6, 1, 0x5066}, {0xC1, 9, 1, 0x506D}, {0xCA, 5, 0, 0x00B7},
+    {0xCF, 4, 1, 0x5081}, {0xD3, 2, 0, 0x00BC}, {0xD5, 4, 1, 0x5089}, {0xD9, 21, 1, 0x508E},
+    {0xEE, 4, 0, 0x00BE}, {0xF2, 5, 1, 0x50AD}, {0xF7, 7, 1, 0x50B3}, {0xFE, 1, 0, 0x00C2},
+    {0x40, 18, 1, 0x50BD}, {0x52, 6, 1, 0x50D0}, {0x58, 3, 0, 0x00C3}, {0x5B, 11, 1, 0x50DB},
+    {0x66, 4, 1, 0x50E8}, {0x6A, 4, 1, 0x50EF}, {0x6E, 1, 0, 0x00C6}, {0x6F, 5, 1, 0x50F6},
+    {0x74, 10, 1, 0x50FC}, {0x7E, 1, 0, 0x00C7}, {0x80, 2, 0, 0x00C8}, {0x82, 6, 1, 0x510C},
+    {0x88, 14, 1, 0x5113}, {0x96, 29, 1, 0x5122}, {0xB3, 13, 0, 0x00CA}, {0xC0, 5, 1, 0x515D},
+    {0xC5, 17, 0, 0x00D7}, {0xD6, 4, 1, 0x518E}, {0xDA, 9, 0, 0x00E8}, {0xE3, 5, 1, 0x51A6},
+    {0xE8, 17, 0, 0x00F1}, {0xF9, 6, 1, 0x51D2}, {0x40, 8, 0, 0x0102}, {0x48, 6, 1, 0x51E5},
+    {0x4E, 35, 0, 0x010A}, {0x71, 6, 1, 0x5244}, {0x77, 8, 0, 0x012D}, {0x80, 11, 0, 0x0135},
+    {0x8B, 4, 1, 0x526B}, {0x8F, 2, 0, 0x0140}, {0x91, 10, 1, 0x5273}, {0x9B, 2, 0, 0x0142},
+    {0x9D, 5, 1, 0x5283}, {0xA2, 7, 1, 0x5289}, {0xA9, 2, 0, 0x0144}, {0xAB, 7, 1, 0x5294},
+    {0xB2, 1, 0, 0x0146}, {0xB3, 4, 1, 0x52A4}, {0xB7, 3, 0, 0x0147}, {0xBA, 10, 1, 0x52B4},
+    {0xC4, 8, 0, 0x014A}, {0xCC, 4, 1, 0x52CC}, {0xD0, 5, 0, 0x0152}, {0xD5, 6, 1, 0x52D9},
+    {0xDB, 4, 1, 0x52E0}, {0xDF, 11, 1, 0x52E5}, {0xEA, 8, 1, 0x52F1}, {0xF2, 3, 0, 0x0157},
+    {0xF5, 4, 1, 0x5301}, {0xF9, 1, 0, 0x015A}, {0xFA, 4, 1, 0x5309}, {0xFE, 1, 0, 0x015B},
+    {0x40, 4, 1, 0x5311}, {0x44, 14, 0, 0x015C}, {0x52, 10, 1, 0x532F}, {0x5C, 23, 0, 0x016A},
+    {0x73, 4, 1, 0x537B}, {0x77, 8, 0, 0x0181}, {0x80, 5, 1, 0x5390}, {0x85, 10, 0, 0x0189},
+    {0x8F, 4, 1, 0x53AA}, {0x93, 7, 1, 0x53AF}, {0x9A, 4, 1, 0x53B7}, {0x9E, 4, 0, 0x0193},
+    {0xA2, 5, 1, 0x53C3}, {0xA7, 44, 0, 0x0197}, {0xD3, 4, 1, 0x544C}, {0xD7, 2, 0, 0x01C3},
+    {0xD9, 5, 1, 0x545D}, {0xDE, 3, 0, 0x01C5}, {0xE1, 8, 1, 0x5469}, {0xE9, 8, 0, 0x01C8},
+    {0xF1, 4, 1, 0x5487}, {0xF5, 6, 0, 0x01D0}, {0xFB, 4, 1, 0x549E}, {0x40, 19, 0, 0x01D6},
+    {0x53, 5, 1, 0x54E0}, {0x58, 5, 0, 0x01E9}, {0x5D, 6, 1, 0x54F4}, {0x63, 3, 0, 0x01EE},
+    {0x66, 4, 1, 0x5502}, {0x6A, 1, 0, 0x01F1}, {0x6B, 5, 1, 0x550A}, {0x70, 2, 0, 0x01F2},
+    {0x72, 6, 1, 0x5515}, {0x78, 4, 1, 0x551C}, {0x7C, 3, 0, 0x01F4}, {0x80, 8, 0, 0x01F7},
+    {0x88, 4, 1, 0x5538}, {0x8C, 6, 0, 0x01FF}, {0x92, 5, 1, 0x554B}, {0x97, 4, 1, 0x5551},
+    {0x9B, 5, 1, 0x5557}, {0xA0, 4, 1, 0x555D}, {0xA4, 5, 0, 0x0205}, {0xA9, 6, 1, 0x556F},
+    {0xAF, 18, 0, 0x020A}, {0xC1, 7, 1, 0x55A0}, {0xC8, 9, 1, 0x55A8}, {0xD1, 6, 0, 0x021C},
+    {0xD7, 5, 1, 0x55BF}, {0xDC, 9, 0, 0x0222}, {0xE5, 5, 1, 0x55D7}, {0xEA, 11, 0, 0x022B},
+    {0xF5, 5, 1, 0x55F8}, {0xFA, 1, 0, 0x0236}, {0xFB, 4, 1, 0x5602}, {0x40, 5, 0, 0x0237},
+    {0x45, 8, 1, 0x5610}, {0x4D, 9, 0, 0x023C}, {0x56, 4, 1, 0x5628}, {0x5A, 11, 0, 0x0245},
+    {0x65, 12, 1, 0x5640}, {0x71, 5, 1, 0x564F}, {0x76, 4, 0, 0x0250}, {0x7A, 5, 1, 0x565D},
+    {0x80, 4, 0, 0x0254}, {0x84, 4, 1, 0x566D}, {0x88, 4, 1, 0x5672}, {0x8C, 4, 1, 0x5677},
+    {0x90, 8, 1, 0x567D}, {0x98, 7, 1, 0x5687}, {0x9F, 3, 0, 0x0258}, {0xA2, 15, 1, 0x5694},
+    {0xB1, 11, 1, 0x56A4}, {0xBC, 7, 1, 0x56B0}, {0xC3, 4, 1, 0x56B8}, {0xC7, 13, 1, 0x56BD},
+    {0xD4, 9, 1, 0x56CB}, {0xDD, 6, 0, 0x025B}, {0xE3, 6, 1, 0x56E5}, {0xE9, 15, 0, 0x0261},
+    {0xF8, 7, 1, 0x570B}, {0x40, 10, 1, 0x5712}, {0x4A, 5, 0, 0x0270}, {0x4F, 4, 1, 0x5724},
+    {0x53, 3, 0, 0x0275}, {0x56, 5, 1, 0x5734}, {0x5B, 4, 0, 0x0278}, {0x5F, 4, 1, 0x5743},
+    {0x63, 3, 0, 0x027C}, {0x66, 5, 1, 0x5752}, {0x6B, 16, 0, 0x027F}, {0x7B, 4, 1, 0x577D},
+    {0x80, 1, 0, 0x028F}, {0x81, 4, 1, 0x5787}, {0x85, 5, 1, 0x578D}, {0x8A, 7, 1, 0x5794},
+    {0x91, 4, 1, 0x579C}, {0x95, 11, 0, 0x0290}, {0xA0, 9, 1, 0x57B9}, {0xA9, 7, 1, 0x57C4},
+    {0xB0, 13, 0, 0x029B}, {0xBD, 8, 1, 0x57E5}, {0xC5, 1, 0, 0x02A8}, {0xC6, 4, 1, 0x57F0},
+    {0xCA, 24, 0, 0x02A9}, {0xE2, 4, 1, 0x581A}, {0xE6, 3, 0, 0x02C1}, {0xE9, 5, 1, 0x5825},
+    {0xEE, 5, 1, 0x582B}, {0xF3, 4, 1, 0x5831}, {0xF7, 8, 1, 0x5836}, {0x40, 6, 1, 0x583E},
+    {0x46, 7, 1, 0x5845}, {0x4D, 8, 0, 0x02C4}, {0x55, 5, 1, 0x5859}, {0x5A, 6, 1, 0x585F},
+    {0x60, 5, 1, 0x5866}, {0x65, 17, 1, 0x586D}, {0x76, 9, 0, 0x02CC}, {0x80, 5, 1, 0x588D},
+    {0x85, 5, 1, 0x5894}, {0x8A, 3, 0, 0x02D5}, {0x8D, 8, 1, 0x58A0}, {0x95, 18, 1, 0x58AA},
+    {0xA7, 4, 1, 0x58BD}, {0xAB, 3, 0, 0x02D8}, {0xAE, 11, 1, 0x58C6}, {0xB9, 3, 0, 0x02DB},
+    {0xBC, 14, 1, 0x58D6}, {0xCA, 6, 1, 0x58E5}, {0xD0, 8, 0, 0x02DE}, {0xD8, 8, 1, 0x58FA},
+    {0xE0, 3, 0, 0x02E6}, {0xE3, 5, 1, 0x5908}, {0xE8, 1, 0, 0x02E9}, {0xE9, 4, 1, 0x5910},
+    {0xED, 5, 0, 0x02EA}, {0xF2, 4, 1, 0x5920}, {0xF6, 9, 0, 0x02EF}, {0x40, 4, 1, 0x593D},
+    {0x44, 10, 0, 0x02F8}, {0x4E, 5, 1, 0x595B}, {0x53, 3, 0, 0x0302}, {0x56, 13, 1, 0x5966},
+    {0x63, 12, 0, 0x0305}, {0x6F, 4, 1, 0x598E}, {0x73, 3, 0, 0x0311}, {0x76, 4, 1, 0x599A},
+    {0x7A, 4, 1, 0x599F}, {0x7E, 1, 0, 0x0314}, {0x80, 5, 0, 0x0315}, {0x85, 6, 1, 0x59B3},
+    {0x8B, 3, 0, 0x031A}, {0x8E, 7, 1, 0x59BF}, {0x95, 3, 0, 0x031D}, {0x98, 4, 1, 0x59CC},
+    {0x9C, 4, 0, 0x0320}, {0xA0, 5, 1, 0x59DE}, {0xA5, 6, 0, 0x0324}, {0xAB, 12, 1, 0x59ED},
+    {0xB7, 8, 0, 0x032A}, {0xBF, 4, 1, 0x5A0D}, {0xC3, 1, 0, 0x0332}, {0xC4, 4, 1, 0x5A14},
+    {0xC8, 11, 0, 0x0333}, {0xD3, 7, 1, 0x5A2A}, {0xDA, 2, 0, 0x033E}, {0xDC, 5, 1, 0x5A37},
+    {0xE1, 3, 0, 0x0340}, {0xE4, 5, 1, 0x5A41}, {0xE9, 2, 0, 0x0343}, {0xEB, 10, 1, 0x5A4B},
+    {0xF5, 4, 1, 0x5A56}, {0xF9, 6, 1, 0x5A5B}, {0x40, 1, 0, 0x0345}, {0x41, 4, 1, 0x5A63},
+    {0x45, 2, 0, 0x0346}, {0x47, 9, 1, 0x5A6B}, {0x50, 2, 0, 0x0348}, {0x52, 4, 1, 0x5A7B},
+    {0x56, 18, 1, 0x5A80}, {0x68, 7, 1, 0x5A93}, {0x6F, 14, 1, 0x5A9C}, {0x7D, 2, 0, 0x034A},
+    {0x80, 5, 1, 0x5AAD}, {0x85, 3, 0, 0x034C}, {0x88, 5, 1, 0x5AB9}, {0x8D, 2, 0, 0x034F},
+    {0x8F, 6, 1, 0x5AC3}, {0x95, 2, 0, 0x0351}, {0x97, 5, 1, 0x5ACD}, {0x9C, 15, 0, 0x0353},
+    {0xAB, 5, 1, 0x5AEC}, {0xB0, 23, 1, 0x5AF2}, {0xC7, 12, 1, 0x5B0A}, {0xD3, 26, 1, 0x5B18},
+    {0xED, 3, 0, 0x0362}, {0xF0, 8, 1, 0x5B38}, {0xF8, 7, 1, 0x5B41}, {0x40, 8, 1, 0x5B48},
+    {0x48, 13, 0, 0x0365}, {0x55, 4, 1, 0x5B76}, {0x59, 18, 0, 0x0372}, {0x6B, 4, 1, 0x5BAC},
+    {0x6F, 9, 0, 0x0384}, {0x78, 4, 1, 0x5BC8}, {0x7C, 3, 0, 0x038D}, {0x80, 1, 0, 0x0390},
+    {0x81, 9, 1, 0x5BD4}, {0x8A, 5, 0, 0x0391}, {0x8F, 5, 1, 0x5BE9}, {0x94, 1, 0, 0x0396},
+    {0x95, 7, 1, 0x5BF1}, {0x9C, 8, 0, 0x0397}, {0xA4, 4, 1, 0x5C0B}, {0xA8, 6, 0, 0x039F},
+    {0xAE, 4, 1, 0x5C1E}, {0xB2, 2, 0, 0x03A5}, {0xB4, 4, 1, 0x5C28}, {0xB8, 4, 1, 0x5C2D},
+    {0xBC, 17, 0, 0x03A7}, {0xCD, 4, 1, 0x5C5A}, {0xD1, 3, 0, 0x03B8}, {0xD4, 7, 1, 0x5C67},
+    {0xDB, 1, 0, 0x03BB}, {0xDC, 7, 1, 0x5C72}, {0xE3, 4, 1, 0x5C7B}, {0xE7, 1, 0, 0x03BC},
+    {0xE8, 5, 1, 0x5C83}, {0xED, 8, 0, 0x03BD}, {0xF5, 5, 1, 0x5C9D}, {0xFA, 5, 1, 0x5CA4},
+    {0x40, 7, 0, 0x03C5}, {0x47, 4, 1, 0x5CB9}, {0x4B, 4, 0, 0x03CC}, {0x4F, 6, 1, 0x5CC5},
+    {0x55, 6, 1, 0x5CCC}, {0x5B, 6, 1, 0x5CD3}, {0x61, 7, 1, 0x5CDA}, {0x68, 8, 0, 0x03D0},
+    {0x70, 10, 1, 0x5CF1}, {0x7A, 5, 1, 0x5CFC}, {0x80, 3, 0, 0x03D8}, {0x83, 6, 1, 0x5D08},
+    {0x89, 5, 1, 0x5D0F}, {0x8E, 1, 0, 0x03DB}, {0x8F, 4, 1, 0x5D17}, {0x93, 2, 0, 0x03DC},
+    {0x95, 5, 1, 0x5D1F}, {0x9A, 5, 0, 0x03DE}, {0x9F, 5, 1, 0x5D2F}, {0xA4, 8, 1, 0x5D35},
+    {0xAC, 8, 1, 0x5D3F}, {0xB4, 2, 0, 0x03E3}, {0xB6, 11, 1, 0x5D4D}, {0xC1, 3, 0, 0x03E5},
+    {0xC4, 11, 1, 0x5D5E}, {0xCF, 3, 0, 0x03E8}, {0xD2, 4, 1, 0x5D70}, {0xD6, 13, 1, 0x5D75},
+    {0xE3, 22, 1, 0x5D83}, {0xF9, 6, 0, 0x03EB}, {0x40, 22, 1, 0x5DA1}, {0x56, 13, 1, 0x5DB8},
+    {0x63, 7, 1, 0x5DC6}, {0x6A, 13, 1, 0x5DCE}, {0x77, 8, 0, 0x03F1}, {0x80, 3, 0, 0x03F9},
+    {0x83, 5, 1, 0x5DF8}, {0x88, 12, 0, 0x03FC}, {0x94, 8, 1, 0x5E1E}, {0x9C, 5, 1, 0x5E28},
+    {0xA1, 2, 0, 0x0408}, {0xA3, 5, 1, 0x5E32}, {0xA8, 2, 0, 0x040A}, {0xAA, 4, 1, 0x5E3E},
+    {0xAE, 1, 0, 0x040C}, {0xAF, 6, 1, 0x5E46}, {0xB5, 7, 1, 0x5E4D}, {0xBC, 5, 1, 0x5E56},
+    {0xC1, 4, 0, 0x040D}, {0xC5, 15, 1, 0x5E63}, {0xD4, 17, 0, 0x0411}, {0xE5, 4, 1, 0x5EA1},
+    {0xE9, 5, 1, 0x5EA8}, {0xEE, 5, 1, 0x5EAE}, {0xF3, 1, 0, 0x0422}, {0xF4, 4, 1, 0x5EBA},
+    {0xF8, 7, 1, 0x5EBF}, {0x40, 3, 0, 0x0423}, {0x43, 6, 1, 0x5ECB}, {0x49, 2, 0, 0x0426},
+    {0x4B, 4, 1, 0x5ED7}, {0x4F, 12, 1, 0x5EDC}, {0x5B, 1, 0, 0x0428}, {0x5C, 9, 1, 0x5EEB},
+    {0x65, 22, 0, 0x0429}, {0x7B, 4, 1, 0x5F21}, {0x80, 5, 0, 0x043F}, {0x85, 7, 1, 0x5F32},
+    {0x8C, 4, 0, 0x0444}, {0x90, 15, 1, 0x5F41}, {0x9F, 2, 0, 0x0448}, {0xA1, 4, 1, 0x5F59},
+    {0xA5, 30, 0, 0x044A}, {0xC3, 4, 1, 0x5F9D}, {0xC7, 6, 1, 0x5FA2}, {0xCD, 3, 0, 0x0468},
+    {0xD0, 6, 1, 0x5FAF}, {0xD6, 1, 0, 0x046B}, {0xD7, 4, 1, 0x5FB8}, {0xDB, 5, 1, 0x5FBE},
+    {0xE0, 31, 0, 0x046C}, {0x40, 18, 0, 0x048B}, {0x52, 5, 1, 0x6030}, {0x57, 5, 1, 0x6036},
+    {0x5C, 3, 0, 0x049D}, {0x5F, 7, 1, 0x6044}, {0x66, 11, 0, 0x04A0}, {0x71, 4, 1, 0x605E},
+    {0x75, 10, 0, 0x04AB}, {0x80, 2, 0, 0x04B5}, {0x82, 4, 1, 0x6085}, {0x86, 2, 0, 0x04B7},
+    {0x88, 4, 1, 0x608E}, {0x8C, 22, 0, 0x04B9}, {0xA2, 8, 1, 0x60BD}, {0xAA, 3, 0, 0x04CF},
+    {0xAD, 5, 1, 0x60CC}, {0xB2, 8, 0, 0x04D2}, {0xBA, 5, 1, 0x60E1}, {0xBF, 6, 0, 0x04DA},
+    {0xC5, 5, 1, 0x60FB}, {0xCA, 4, 1, 0x6102}, {0xCE, 4, 0, 0x04E0}, {0xD2, 5, 1, 0x6110},
+    {0xD7, 4, 1, 0x6116}, {0xDB, 4, 1, 0x611B}, {0xDF, 6, 0, 0x04E4}, {0xE5, 19, 1, 0x612C},
+    {0xF8, 7, 1, 0x6140}, {0x40, 9, 0, 0x04EA}, {0x49, 7, 1, 0x6156}, {0x50, 4, 1, 0x615E},
+    {0x54, 4, 1, 0x6163}, {0x58, 7, 1, 0x6169}, {0x5F, 4, 1, 0x6171}, {0x63, 1, 0, 0x04F3},
+    {0x64, 19, 1, 0x6178}, {0x77, 2, 0, 0x04F4}, {0x79, 5, 1, 0x618F}, {0x7E, 1, 0, 0x04F6},
+    {0x80, 7, 1, 0x6196}, {0x87, 9, 1, 0x619E}, {0x90, 2, 0, 0x04F7}, {0x92, 10, 1, 0x61AD},
+    {0x9C, 6, 1, 0x61B8}, {0xA2, 3, 0, 0x04F9}, {0xA5, 5, 1, 0x61C3}, {0xAA, 1, 0, 0x04FC},
+    {0xAB, 5, 1, 0x61CC}, {0xB0, 1, 0, 0x04FD}, {0xB1, 17, 1, 0x61D5}, {0xC2, 14, 1, 0x61E7},
+    {0xD0, 9, 1, 0x61F6}, {0xD9, 6, 1, 0x6200}, {0xDF, 10, 0, 0x04FE}, {0xE9, 4, 1, 0x6226},
+    {0xED, 2, 0, 0x0508}, {0xEF, 4, 1, 0x622F}, {0xF3, 2, 0, 0x050A}, {0xF5, 5, 1, 0x6238},
+    {0xFA, 5, 0, 0x050C}, {0x40, 7, 0, 0x0511}, {0x47, 7, 1, 0x625C}, {0x4E, 15, 0, 0x0518},
+    {0x5D, 4, 1, 0x6285}, {0x61, 6, 1, 0x628B}, {0x67, 10, 0, 0x0527}, {0x71, 4, 1, 0x62AD},
+    {0x75, 10, 0, 0x0531}, {0x80, 15, 0, 0x053B}, {0x8F, 4, 1, 0x62F8}, {0x93, 1, 0, 0x054A},
+    {0x94, 4, 1, 0x6303}, {0x98, 4, 1, 0x630A}, {0x9C, 2, 0, 0x054B}, {0x9E, 4, 1, 0x6312},
+    {0xA2, 12, 0, 0x054D}, {0xAE, 6, 1, 0x6333}, {0xB4, 2, 0, 0x0559}, {0xB6, 4, 1, 0x633E},
+    {0xBA, 4, 0, 0x055B}, {0xBE, 4, 1, 0x6351}, {0xC2, 8, 1, 0x6356}, {0xCA, 10, 0, 0x055F},
+    {0xD4, 4, 1, 0x6372}, {0xD8, 2, 0, 0x0569}, {0xDA, 4, 1, 0x637C}, {0xDE, 1, 0, 0x056B},
+    {0xDF, 4, 1, 0x6383}, {0xE3, 7, 0, 0x056C}, {0xEA, 7, 1, 0x6399}, {0xF1, 14, 0, 0x0573},
+    {0x40, 13, 0, 0x0581}, {0x4D, 7, 1, 0x63D7}, {0x54, 2, 0, 0x058E}, {0x56, 5, 1, 0x63E4},
+    {0x5B, 2, 0, 0x0590}, {0x5D, 4, 1, 0x63EE}, {0x61, 3, 0, 0x0592}, {0x64, 4, 1, 0x63F9},
+    {0x68, 3, 0, 0x0595}, {0x6B, 5, 1, 0x6406}, {0x70, 4, 0, 0x0598}, {0x74, 6, 1, 0x6415},
+    {0x7A, 5, 0, 0x059C}, {0x80, 5, 0, 0x05A1}, {0x85, 6, 1, 0x642E}, {0x8B, 5, 1, 0x6435},
+    {0x90, 7, 0, 0x05A6}, {0x97, 7, 1, 0x644B}, {0x9E, 4, 0, 0x05AD}, {0xA2, 5, 1, 0x6459},
+    {0xA7, 8, 1, 0x645F}, {0xAF, 4, 0, 0x05B1}, {0xB3, 10, 1, 0x646E}, {0xBD, 7, 1, 0x647B},
+    {0xC4, 2, 0, 0x05B5}, {0xC6, 9, 1, 0x6488}, {0xCF, 4, 0, 0x05B7}, {0xD3, 4, 1, 0x649A},
+    {0xD7, 5, 1, 0x649F}, {0xDC, 4, 1, 0x64A5}, {0xE0, 3, 0, 0x05BB}, {0xE3, 4, 1, 0x64B1},
+    {0xE7, 9, 0, 0x05BE}, {0xF0, 7, 1, 0x64C6}, {0xF7, 2, 0, 0x05C7}, {0xF9, 4, 1, 0x64D3},
+    {0xFD, 2, 0, 0x05C9}, {0x40, 8, 0, 0x05CB}, {0x48, 25, 1, 0x64E7}, {0x61, 8, 1, 0x6501},
+    {0x69, 8, 1, 0x650A}, {0x71, 5, 1, 0x6513}, {0x76, 9, 1, 0x6519}, {0x80, 3, 0, 0x05D3},
+    {0x83, 5, 1, 0x6526}, {0x88, 2, 0, 0x05D6}, {0x8A, 4, 1, 0x6530}, {0x8E, 4, 0, 0x05D8},
+    {0x92, 5, 1, 0x6540}, {0x97, 19, 0, 0x05DC}, {0xAA, 4, 1, 0x6567}, {0xAE, 7, 0, 0x05EF},
+    {0xB5, 15, 1, 0x6578}, {0xC4, 22, 0, 0x05F6}, {0xDA, 8, 1, 0x65B1}, {0xE2, 6, 0, 0x060C},
+    {0xE8, 4, 1, 0x65C7}, {0xEC, 6, 0, 0x0612}, {0xF2, 8, 1, 0x65D8}, {0xFA, 5, 0, 0x0618},
+    {0x40, 4, 1, 0x65F2}, {0x44, 2, 0, 0x061D}, {0x46, 5, 1, 0x65FB}, {0x4B, 18, 0, 0x061F},
+    {0x5D, 4, 1, 0x6621}, {0x61, 1, 0, 0x0631}, {0x62, 4, 1, 0x6629}, {0x66, 4, 0, 0x0632},
+    {0x6A, 5, 1, 0x6637}, {0x6F, 4, 0, 0x0636}, {0x73, 7, 1, 0x6644}, {0x7A, 5, 0, 0x063A},
+    {0x80, 1, 0, 0x063F}, {0x81, 4, 1, 0x665B}, {0x85, 5, 0, 0x0640}, {0x8A, 5, 1, 0x6669},
+    {0x8F, 15, 0, 0x0645}, {0x9E, 4, 1, 0x6688}, {0xA2, 4, 1, 0x668D}, {0xA6, 4, 1, 0x6692},
+    {0xAA, 5, 1, 0x6698}, {0xAF, 9, 1, 0x669E}, {0xB8, 5, 1, 0x66A9}, {0xBD, 5, 1, 0x66AF},
+    {0xC2, 4, 1, 0x66B5}, {0xC6, 4, 1, 0x66BA}, {0xCA, 26, 1, 0x66BF}, {0xE4, 1, 0, 0x0654},
+    {0xE5, 8, 1, 0x66DE}, {0xED, 2, 0, 0x0655}, {0xEF, 6, 1, 0x66EA}, {0xF5, 10, 0, 0x0657},
+    {0x40, 4, 1, 0x6704}, {0x44, 12, 0, 0x0661}, {0x50, 6, 1, 0x6720}, {0x56, 6, 0, 0x066D},
+    {0x5C, 4, 1, 0x6736}, {0x60, 14, 0, 0x0673}, {0x6E, 5, 1, 0x6757}, {0x73, 12, 0, 0x0681},
+    {0x80, 4, 1, 0x6778}, {0x84, 8, 0, 0x068D}, {0x8C, 4, 1, 0x678C}, {0x90, 4, 1, 0x6791},
+    {0x94, 14, 0, 0x0695}, {0xA2, 8, 1, 0x67B9}, {0xAA, 1, 0, 0x06A3}, {0xAB, 10, 1, 0x67C5},
+    {0xB5, 16, 0, 0x06A4}, {0xC5, 8, 1, 0x67F5}, {0xCD, 1, 0, 0x06B4}, {0xCE, 4, 1, 0x6801},
+    {0xD2, 6, 0, 0x06B5}, {0xD8, 5, 1, 0x6818}, {0xDD, 3, 0, 0x06BB}, {0xE0, 7, 1, 0x6822},
+    {0xE7, 7, 1, 0x682B}, {0xEE, 11, 0, 0x06BE}, {0xF9, 6, 1, 0x6856}, {0x40, 4, 1, 0x685C},
+    {0x44, 1, 0, 0x06C9}, {0x45, 8, 1, 0x686C}, {0x4D, 1, 0, 0x06CA}, {0x4E, 9, 1, 0x6878},
+    {0x57, 2, 0, 0x06CB}, {0x59, 8, 1, 0x6887}, {0x61, 6, 0, 0x06CD}, {0x67, 10, 1, 0x6898},
+    {0x71, 3, 0, 0x06D3}, {0x74, 4, 1, 0x68A9}, {0x78, 7, 0, 0x06D6}, {0x80, 7, 1, 0x68B9},
+    {0x87, 1, 0, 0x06DD}, {0x88, 6, 1, 0x68C3}, {0x8E, 2, 0, 0x06DE}, {0x90, 4, 1, 0x68CE},
+    {0x94, 5, 0, 0x06E0}, {0x99, 5, 1, 0x68DB}, {0x9E, 2, 0, 0x06E5}, {0xA0, 10, 1, 0x68E4},
+    {0xAA, 8, 0, 0x06E7}, {0xB2, 4, 1, 0x68FD}, {0xB6, 3, 0, 0x06EF}, {0xB9, 5, 1, 0x6906},
+    {0xBE, 3, 0, 0x06F2}, {0xC1, 12, 1, 0x6913}, {0xCD, 3, 0, 0x06F5}, {0xD0, 8, 1, 0x6925},
+    {0xD8, 5, 0, 0x06F8}, {0xDD, 4, 1, 0x6935}, {0xE1, 6, 0, 0x06FD}, {0xE7, 17, 1, 0x6943},
+    {0xF8, 7, 0, 0x0703}, {0x40, 4, 0, 0x070A}, {0x44, 4, 1, 0x6967}, {0x48, 4, 0, 0x070E},
+    {0x4C, 5, 1, 0x6972}, {0x51, 11, 0, 0x0712}, {0x5C, 6, 1, 0x698E}, {0x62, 4, 0, 0x071D},
+    {0x66, 10, 1, 0x699D}, {0x70, 15, 0, 0x0721}, {0x80, 3, 0, 0x0730}, {0x83, 8, 1, 0x69C2},
+    {0x8B, 6, 0, 0x0733}, {0x91, 6, 1, 0x69D5}, {0x97, 3, 0, 0x0739}, {0x9A, 12, 1, 0x69E1},
+    {0xA6, 4, 1, 0x69EE}, {0xAA, 10, 1, 0x69F3}, {0xB4, 1, 0, 0x073C}, {0xB5, 10, 1, 0x6A00},
+    {0xBF, 12, 1, 0x6A0B}, {0xCB, 6, 1, 0x6A19}, {0xD1, 1, 0, 0x073D}, {0xD2, 6, 1, 0x6A22},
+    {0xD8, 1, 0, 0x073E}, {0xD9, 4, 1, 0x6A2B}, {0xDD, 4, 0, 0x073F}, {0xE1, 7, 1, 0x6A36},
+    {0xE8, 5, 1, 0x6A3F}, {0xED, 2, 0, 0x0743}, {0xEF, 8, 1, 0x6A48}, {0xF7, 7, 1, 0x6A51},
+    {0xFE, 1, 0, 0x0745}, {0x40, 5, 1, 0x6A5C}, {0x45, 3, 0, 0x0746}, {0x48, 11, 1, 0x6A66},
+    {0x53, 7, 1, 0x6A72}, {0x5A, 8, 0, 0x0749}, {0x62, 9, 1, 0x6A85}, {0x6B, 1, 0, 0x0751},
+    {0x6C, 5, 1, 0x6A92}, {0x71, 8, 1, 0x6A98}, {0x79, 6, 1, 0x6AA1}, {0x80, 3, 0, 0x0752},
+    {0x83, 115, 1, 0x6AAD}, {0xF6, 2, 0, 0x0755}, {0xF8, 7, 1, 0x6B28}, {0x40, 3, 0, 0x0757},
+    {0x43, 4, 1, 0x6B33}, {0x47, 4, 0, 0x075A}, {0x4B, 4, 1, 0x6B3F}, {0x4F, 5, 0, 0x075E},
+    {0x54, 12, 1, 0x6B4D}, {0x60, 8, 1, 0x6B5A}, {0x68, 2, 0, 0x0763}, {0x6A, 14, 1, 0x6B6B},
+    {0x78, 1, 0, 0x0765}, {0x79, 4, 1, 0x6B7D}, {0x7D, 2, 0, 0x0766}, {0x80, 1, 0, 0x0768},
+    {0x81, 4, 1, 0x6B8E}, {0x85, 5, 0, 0x0769}, {0x8A, 5, 1, 0x6B9C}, {0x8F, 8, 1, 0x6BA2},
+    {0x97, 8, 1, 0x6BAB}, {0x9F, 1, 0, 0x076E}, {0xA0, 7, 1, 0x6BB8}, {0xA7, 3, 0, 0x076F},
+    {0xAA, 5, 1, 0x6BC6}, {0xAF, 6, 0, 0x0772}, {0xB5, 5, 1, 0x6BDC}, {0xBA, 8, 1, 0x6BE2},
+    {0xC2, 13, 0, 0x0778}, {0xCF, 7, 1, 0x6BFE}, {0xD6, 5, 1, 0x6C08}, {0xDB, 16, 0, 0x0785},
+    {0xEB, 4, 1, 0x6C39}, {0xEF, 6, 0, 0x0795}, {0xF5, 5, 1, 0x6C4B}, {0xFA, 5, 0, 0x079B},
+    {0x40, 7, 0, 0x07A0}, {0x47, 5, 1, 0x6C6B}, {0x4C, 18, 0, 0x07A7}, {0x5E, 4, 1, 0x6C95},
+    {0x62, 10, 0, 0x07B9}, {0x6C, 4, 1, 0x6CB4}, {0x70, 1, 0, 0x07C3}, {0x71, 4, 1, 0x6CC0},
+    {0x75, 10, 0, 0x07C4}, {0x80, 27, 0, 0x07CE}, {0x9B, 4, 1, 0x6D13}, {0x9F, 3, 0, 0x07E9},
+    {0xA2, 6, 1, 0x6D1F}, {0xA8, 19, 0, 0x07EC}, {0xBB, 4, 1, 0x6D55}, {0xBF, 12, 0, 0x07FF},
+    {0xCB, 4, 1, 0x6D70}, {0xCF, 5, 0, 0x080B}, {0xD4, 5, 1, 0x6D7D}, {0xD9, 10, 0, 0x0810},
+    {0xE3, 5, 1, 0x6D96}, {0xE8, 11, 0, 0x081A}, {0xF3, 6, 1, 0x6DB9}, {0xF9, 6, 0, 0x0825},
+    {0x40, 4, 1, 0x6DCD}, {0x44, 4, 1, 0x6DD2}, {0x48, 8, 0, 0x082B}, {0x50, 4, 1, 0x6DE7},
+    {0x54, 9, 0, 0x0833}, {0x5D, 8, 1, 0x6DFD}, {0x65, 4, 1, 0x6E06}, {0x69, 22, 0, 0x083C},
+    {0x80, 3, 0, 0x0852}, {0x83, 8, 1, 0x6E3B}, {0x8B, 8, 1, 0x6E45}, {0x93, 4, 1, 0x6E4F},
+    {0x97, 7, 0, 0x0855}, {0x9E, 11, 1, 0x6E60}, {0xA9, 2, 0, 0x085C}, {0xAB, 15, 1, 0x6E6F},
+    {0xBA, 6, 0, 0x085E}, {0xC0, 5, 1, 0x6E8A}, {0xC5, 7, 1, 0x6E91}, {0xCC, 12, 0, 0x0864},
+    {0xD8, 4, 1, 0x6EAB}, {0xDC, 9, 0, 0x0870}, {0xE5, 4, 1, 0x6EC3}, {0xE9, 16, 0, 0x0879},
+    {0xF9, 6, 1, 0x6EEA}, {0x40, 4, 1, 0x6EF0}, {0x44, 4, 1, 0x6EF5}, {0x48, 8, 1, 0x6EFA},
+    {0x50, 5, 0, 0x0889}, {0x55, 5, 1, 0x6F0A}, {0x5A, 3, 0, 0x088E}, {0x5D, 10, 1, 0x6F16},
+    {0x67, 3, 0, 0x0891}, {0x6A, 4, 1, 0x6F25}, {0x6E, 6, 0, 0x0894}, {0x74, 7, 1, 0x6F37},
+    {0x7B, 4, 1, 0x6F3F}, {0x80, 7, 0, 0x089A}, {0x87, 10, 1, 0x6F4E}, {0x91, 10, 0, 0x08A1},
+    {0x9B, 6, 1, 0x6F67}, {0xA1, 9, 0, 0x08AB}, {0xAA, 7, 1, 0x6F7D}, {0xB1, 5, 0, 0x08B4},
+    {0xB6, 13, 1, 0x6F8F}, {0xC3, 4, 1, 0x6F9D}, {0xC7, 5, 1, 0x6FA2}, {0xCC, 11, 1, 0x6FA8},
+    {0xD7, 4, 0, 0x08B9}, {0xDB, 6, 1, 0x6FBA}, {0xE1, 1, 0, 0x08BD}, {0xE2, 6, 1, 0x6FC3},
+    {0xE8, 7, 1, 0x6FCA}, {0xEF, 11, 1, 0x6FD3}, {0xFA, 1, 0, 0x08BE}, {0xFB, 4, 1, 0x6FE2},
+    {0x40, 8, 1, 0x6FE6}, {0x48, 33, 1, 0x6FF0}, {0x69, 8, 1, 0x7012}, {0x71, 7, 1, 0x701C},
+    {0x78, 7, 1, 0x7024}, {0x80, 10, 1, 0x702B}, {0x8A, 3, 0, 0x08BF}, {0x8D, 18, 1, 0x703A},
+    {0x9F, 2, 0, 0x08C2}, {0xA1, 14, 1, 0x7050}, {0xAF, 12, 1, 0x705F}, {0xBB, 1, 0, 0x08C4},
+    {0xBC, 4, 1, 0x7071}, {0xC0, 5, 0, 0x08C5}, {0xC5, 4, 1, 0x7081}, {0xC9, 14, 0, 0x08CA},
+    {0xD7, 13, 1, 0x709E}, {0xE4, 8, 0, 0x08D8}, {0xEC, 4, 1, 0x70C4}, {0xF0, 1, 0, 0x08E0},
+    {0xF1, 13, 1, 0x70CB}, {0xFE, 1, 0, 0x08E1}, {0x40, 3, 0, 0x08E2}, {0x43, 4, 1, 0x70E0},
+    {0x47, 3, 0, 0x08E5}, {0x4A, 7, 1, 0x70F0}, {0x51, 4, 0, 0x08E8}, {0x55, 11, 1, 0x70FE},
+    {0x60, 5, 1, 0x710B}, {0x65, 4, 0, 0x08EC}, {0x69, 11, 1, 0x711B}, {0x74, 8, 1, 0x7127},
+    {0x7C, 3, 0, 0x08F0}, {0x80, 1, 0, 0x08F3}, {0x81, 14, 1, 0x7137}, {0x8F, 4, 1, 0x7146},
+    {0x93, 2, 0, 0x08F4}, {0x95, 13, 1, 0x714F}, {0xA2, 1, 0, 0x08F6}, {0xA3, 5, 1, 0x715F},
+    {0xA8, 1, 0, 0x08F7}, {0xA9, 5, 1, 0x7169}, {0xAE, 3, 0, 0x08F8}, {0xB1, 4, 1, 0x7174},
+    {0xB5, 3, 0, 0x08FB}, {0xB8, 6, 1, 0x717E}, {0xBE, 5, 1, 0x7185}, {0xC3, 4, 1, 0x718B},
+    {0xC7, 4, 1, 0x7190}, {0xCB, 3, 0, 0x08FE}, {0xCE, 5, 1, 0x719A}, {0xD3, 7, 1, 0x71A1},
+    {0xDA, 3, 0, 0x0901}, {0xDD, 6, 1, 0x71AD}, {0xE3, 4, 0, 0x0904}, {0xE7, 9, 1, 0x71BA},
+    {0xF0, 10, 1, 0x71C4}, {0xFA, 5, 1, 0x71CF}, {0x40, 10, 1, 0x71D6}, {0x4A, 4, 1, 0x71E1},
+    {0x4E, 1, 0, 0x0908}, {0x4F, 6, 1, 0x71E8}, {0x55, 10, 1, 0x71EF}, {0x5F, 12, 1, 0x71FA},
+    {0x6B, 20, 1, 0x7207}, {0x80, 2, 0, 0x0909}, {0x82, 10, 1, 0x721E}, {0x8C, 11, 0, 0x090B},
+    {0x97, 7, 1, 0x7240}, {0x9E, 3, 0, 0x0916}, {0xA1, 4, 1, 0x724E}, {0xA5, 13, 0, 0x0919},
+    {0xB2, 4, 1, 0x726A}, {0xB6, 12, 0, 0x0926}, {0xC2, 5, 1, 0x7285}, {0xC7, 4, 0, 0x0932},
+    {0xCB, 12, 1, 0x7293}, {0xD7, 12, 1, 0x72A0}, {0xE3, 5, 0, 0x0936}, {0xE8, 7, 1, 0x72BA},
+    {0xEF, 3, 0, 0x093B}, {0xF2, 4, 1, 0x72C9}, {0xF6, 2, 0, 0x093E}, {0xF8, 4, 1, 0x72D3},
+    {0xFC, 3, 0, 0x0940}, {0x40, 63, 1, 0xE4C6}, {0x80, 33, 1, 0xE505}, {0xA1, 19, 0, 0x0943},
+    {0xB4, 8, 1, 0x3008}, {0xBC, 67, 0, 0x0956}, {0x40, 63, 1, 0xE526}, {0x80, 33, 1, 0xE565},
+    {0xA1, 10, 1, 0x2170}, {0xAB, 6, 1, 0xE766}, {0xB1, 20, 1, 0x2488}, {0xC5, 20, 1, 0x2474},
+    {0xD9, 10, 1, 0x2460}, {0xE3, 2, 0, 0x0999}, {0xE5, 10, 1, 0x3220}, {0xEF, 2, 0, 0x099B},
+    {0xF1, 12, 1, 0x2160}, {0xFD, 2, 0, 0x099D}, {0x40, 63, 1, 0xE586}, {0x80, 33, 1, 0xE5C5},
+    {0xA1, 4, 0, 0x099F}, {0xA5, 89, 1, 0xFF05}, {0xFE, 1, 0, 0x09A3}, {0x40, 63, 1, 0xE5E6},
+    {0x80, 33, 1, 0xE625}, {0xA1, 83, 1, 0x3041}, {0xF4, 11, 1, 0xE772}, {0x40, 63, 1, 0xE646},
+    {0x80, 33, 1, 0xE685}, {0xA1, 86, 1, 0x30A1}, {0xF7, 8, 1, 0xE77D}, {0x40, 63, 1, 0xE6A6},
+    {0x80, 33, 1, 0xE6E5}, {0xA1, 17, 1, 0x0391}, {0xB2, 7, 1, 0x03A3}, {0xB9, 8, 1, 0xE785},
+    {0xC1, 17, 1, 0x03B1}, {0xD2, 7, 1, 0x03C3}, {0xD9, 7, 1, 0xE78D}, {0xE0, 8, 0, 0x09A4},
+    {0xE8, 4, 1, 0xFE41}, {0xEC, 10, 0, 0x09AC}, {0xF6, 9, 1, 0xE797}, {0x40, 63, 1, 0xE706},
+    {0x80, 33, 1, 0xE745}, {0xA1, 6, 1, 0x0410}, {0xA7, 1, 0, 0x09B6}, {0xA8, 26, 1, 0x0416},
+    {0xC2, 15, 1, 0xE7A0}, {0xD1, 6, 1, 0x0430}, {0xD7, 1, 0, 0x09B7}, {0xD8, 26, 1, 0x0436},
+    {0xF2, 13, 1, 0xE7AF}, {0x40, 9, 0, 0x09B8}, {0x49, 4, 1, 0x2196}, {0x4D, 7, 0, 0x09C1},
+    {0x54, 36, 1, 0x2550}, {0x78, 7, 1, 0x2581}, {0x80, 8, 1, 0x2588}, {0x88, 5, 0, 0x09C8},
+    {0x8D, 4, 1, 0x25E2}, {0x91, 5, 0, 0x09CD}, {0x96, 11, 1, 0xE7BC}, {0xA1, 32, 0, 0x09D2},
+    {0xC1, 4, 1, 0xE7C9}, {0xC5, 37, 1, 0x3105}, {0xEA, 21, 1, 0xE7CD}, {0x40, 9, 1, 0x3021},
+    {0x49, 31, 0, 0x09F2}, {0x68, 10, 1, 0xFE49}, {0x72, 4, 1, 0xFE54}, {0x76, 9, 1, 0xFE59},
+    {0x80, 5, 1, 0xFE62}, {0x85, 4, 1, 0xFE68}, {0x89, 1, 0, 0x0A11}, {0x8A, 12, 1, 0x2FF0},
+    {0x96, 1, 0, 0x0A12}, {0x97, 13, 1, 0xE7F4}, {0xA4, 76, 1, 0x2500}, {0xF0, 15, 1, 0xE801},
+    {0x40, 3, 0, 0x0A13}, {0x43, 6, 1, 0x72E2}, {0x49, 5, 0, 0x0A16}, {0x4E, 4, 1, 0x72FD},
+    {0x52, 1, 0, 0x0A1B}, {0x53, 6, 1, 0x7304}, {0x59, 3, 0, 0x0A1C}, {0x5C, 4, 1, 0x730F},
+    {0x60, 18, 0, 0x0A1F}, {0x72, 4, 1, 0x733A}, {0x76, 9, 1, 0x7340}, {0x80, 4, 1, 0x7349},
+    {0x84, 3, 0, 0x0A31}, {0x87, 4, 1, 0x7353}, {0x8B, 8, 1, 0x7358}, {0x93, 11, 1, 0x7361},
+    {0x9E, 3, 0, 0x0A34}, {0xA1, 94, 1, 0xE000}, {0x40, 12, 1, 0x7372}, {0x4C, 5, 1, 0x737F},
+    {0x51, 8, 0, 0x0A37}, {0x59, 4, 1, 0x7392}, {0x5D, 4, 1, 0x7397}, {0x61, 5, 0, 0x0A3F},
+    {0x66, 6, 1, 0x73A3}, {0x6C, 9, 0, 0x0A44}, {0x75, 4, 1, 0x73BC}, {0x79, 1, 0, 0x0A4D},
+    {0x7A, 5, 1, 0x73C3}, {0x80, 3, 0, 0x0A4E}, {0x83, 7, 1, 0x73D2}, {0x8A, 4, 1, 0x73DA},
+    {0x8E, 1, 0, 0x0A51}, {0x8F, 4, 1, 0x73E1}, {0x93, 5, 0, 0x0A52}, {0x98, 4, 1, 0x73EE},
+    {0x9C, 5, 1, 0x73F3}, {0xA1, 94, 1, 0xE05E}, {0x40, 11, 1, 0x73F8}, {0x4B, 3, 0, 0x0A57},
+    {0x4E, 4, 1, 0x740B}, {0x52, 9, 1, 0x7411}, {0x5B, 6, 1, 0x741C}, {0x61, 9, 0, 0x0A5A},
+    {0x6A, 5, 1, 0x7437}, {0x6F, 4, 1, 0x743D}, {0x73, 12, 1, 0x7442}, {0x80, 7, 1, 0x744E},
+    {0x87, 3, 0, 0x0A63}, {0x8A, 13, 1, 0x7460}, {0x97, 2, 0, 0x0A66}, {0x99, 5, 1, 0x7471},
+    {0x9E, 3, 0, 0x0A68}, {0xA1, 94, 1, 0xE0BC}, {0x40, 14, 0, 0x0A6B}, {0x4E, 11, 1, 0x7491},
+    {0x59, 1, 0, 0x0A79}, {0x5A, 8, 1, 0x749F}, {0x62, 16, 1, 0x74AA}, {0x72, 13, 1, 0x74BB},
+    {0x80, 10, 1, 0x74C8}, {0x8A, 9, 1, 0x74D3}, {0x93, 4, 0, 0x0A7A}, {0x97, 7, 1, 0x74E7},
+    {0x9E, 3, 0, 0x0A7E}, {0xA1, 94, 1, 0xE11A}, {0x40, 2, 0, 0x0A81}, {0x42, 7, 1, 0x74F8},
+    {0x49, 4, 1, 0x7500}, {0x4D, 8, 1, 0x7505}, {0x55, 3, 0, 0x0A83}, {0x58, 4, 1, 0x7514},
+    {0x5C, 3, 0, 0x0A86}, {0x5F, 5, 1, 0x7520}, {0x64, 10, 0, 0x0A89}, {0x6E, 4, 1, 0x7541},
+    {0x72, 5, 0, 0x0A93}, {0x77, 4, 1, 0x7550}, {0x7B, 4, 1, 0x7555}, {0x80, 8, 1, 0x755D},
+    {0x88, 3, 0, 0x0A98}, {0x8B, 7, 1, 0x756B}, {0x92, 4, 0, 0x0A9B}, {0x96, 5, 1, 0x757A},
+    {0x9B, 6, 0, 0x0A9F}, {0xA1, 94, 1, 0xE178}, {0x40, 14, 0, 0x0AA5}, {0x4E, 5, 1, 0x75A6},
+    {0x53, 11, 0, 0x0AB3}, {0x5E, 4, 1, 0x75CE}, {0x62, 11, 0, 0x0ABE}, {0x6D, 4, 1, 0x75EC},
+    {0x71, 2, 0, 0x0AC9}, {0x73, 4, 1, 0x75F5}, {0x77, 8, 0, 0x0ACB}, {0x80, 6, 0, 0x0AD3},
+    {0x86, 4, 1, 0x7611}, {0x8A, 23, 0, 0x0AD9}, {0xA1, 94, 1, 0xE1D6}, {0x40, 7, 1, 0x7645},
+    {0x47, 6, 1, 0x764E}, {0x4D, 1, 0, 0x0AF0}, {0x4E, 5, 1, 0x7657}, {0x53, 1, 0, 0x0AF1},
+    {0x54, 4, 1, 0x765F}, {0x58, 7, 1, 0x7664}, {0x5F, 3, 0, 0x0AF2}, {0x62, 8, 1, 0x7670},
+    {0x6A, 21, 0, 0x0AF5}, {0x80, 8, 1, 0x769C}, {0x88, 9, 1, 0x76A5}, {0x91, 3, 0, 0x0B0A},
+    {0x94, 10, 1, 0x76B5}, {0x9E, 97, 0, 0x0B0D}, {0x40, 12, 0, 0x0B6E}, {0x4C, 5, 1, 0x76E0},
+    {0x51, 8, 1, 0x76E6}, {0x59, 16, 0, 0x0B7A}, {0x69, 11, 1, 0x770E}, {0x74, 4, 1, 0x771B},
+    {0x78, 7, 0, 0x0B8A}, {0x80, 2, 0, 0x0B91}, {0x82, 5, 1, 0x7730}, {0x87, 9, 0, 0x0B93},
+    {0x90, 8, 1, 0x7748}, {0x98, 8, 1, 0x7752}, {0xA0, 95, 0, 0x0B9C}, {0x40, 4, 1, 0x775D},
+    {0x44, 4, 0, 0x0BFB}, {0x48, 12, 1, 0x776D}, {0x54, 6, 0, 0x0BFF}, {0x5A, 6, 1, 0x7786},
+    {0x60, 2, 0, 0x0C05}, {0x62, 12, 1, 0x7793}, {0x6E, 12, 0, 0x0C07}, {0x7A, 5, 1, 0x77B6},
+    {0x80, 2, 0, 0x0C13}, {0x82, 13, 1, 0x77C0}, {0x8F, 9, 1, 0x77CE}, {0x98, 3, 0, 0x0C15},
+    {0x9B, 5, 1, 0x77DD}, {0xA0, 95, 0, 0x0C18}, {0x40, 3, 0, 0x0C77}, {0x43, 4, 1, 0x77EF},
+    {0x47, 3, 0, 0x0C7A}, {0x4A, 4, 1, 0x77F9}, {0x4E, 6, 1, 0x7803}, {0x54, 26, 0, 0x0C7D},
+    {0x6E, 4, 1, 0x7841}, {0x72, 1, 0, 0x0C97}, {0x73, 4, 1, 0x7848}, {0x77, 8, 0, 0x0C98},
+    {0x80, 2, 0, 0x0CA0}, {0x82, 12, 1, 0x785E}, {0x8E, 8, 1, 0x786F}, {0x96, 4, 1, 0x7878},
+    {0x9A, 7, 1, 0x787D}, {0xA1, 94, 0, 0x0CA2}, {0x40, 19, 0, 0x0D00}, {0x53, 8, 1, 0x78A8},
+    {0x5B, 4, 1, 0x78B5}, {0x5F, 4, 1, 0x78BA}, {0x63, 8, 0, 0x0D13}, {0x6B, 4, 1, 0x78CC},
+    {0x6F, 6, 0, 0x0D1B}, {0x75, 10, 1, 0x78DA}, {0x80, 4, 1, 0x78E4}, {0x84, 3, 0, 0x0D21},
+    {0x87, 5, 1, 0x78ED}, {0x8C, 5, 0, 0x0D24}, {0x91, 6, 1, 0x78FB}, {0x97, 3, 0, 0x0D29},
+    {0x9A, 7, 1, 0x7906}, {0xA1, 94, 0, 0x0D2C}, {0x40, 6, 1, 0x790D}, {0x46, 10, 1, 0x7914},
+    {0x50, 5, 1, 0x791F}, {0x55, 15, 1, 0x7925}, {0x64, 5, 1, 0x7935}, {0x69, 2, 0, 0x0D8A},
+    {0x6B, 4, 1, 0x7942}, {0x6F, 1, 0, 0x0D8C}, {0x70, 9, 1, 0x794A}, {0x79, 6, 0, 0x0D8D},
+    {0x80, 2, 0, 0x0D93}, {0x82, 4, 1, 0x7969}, {0x86, 1, 0, 0x0D95}, {0x87, 7, 1, 0x7970},
+    {0x8E, 1, 0, 0x0D96}, {0x8F, 5, 1, 0x797B}, {0x94, 2, 0, 0x0D97}, {0x96, 4, 1, 0x7986},
+    {0x9A, 4, 1, 0x798B}, {0x9E, 97, 0, 0x0D99}, {0x40, 7, 1, 0x7993}, {0x47, 12, 1, 0x799B},
+    {0x53, 11, 1, 0x79A8}, {0x5E, 5, 1, 0x79B4}, {0x63, 16, 0, 0x0DFA}, {0x73, 6, 1, 0x79D9},
+    {0x79, 6, 0, 0x0E0A}, {0x80, 2, 0, 0x0E10}, {0x82, 7, 1, 0x79F1}, {0x89, 8, 0, 0x0E12},
+    {0x91, 4, 1, 0x7A07}, {0x95, 1, 0, 0x0E1A}, {0x96, 5, 1, 0x7A0F}, {0x9B, 100, 0, 0x0E1B},
+    {0x40, 4, 0, 0x0E7F}, {0x44, 15, 1, 0x7A24}, {0x53, 6, 0, 0x0E83}, {0x59, 6, 1, 0x7A40},
+    {0x5F, 10, 1, 0x7A47}, {0x69, 5, 1, 0x7A52}, {0x6E, 17, 1, 0x7A58}, {0x80, 7, 1, 0x7A69},
+    {0x87, 4, 0, 0x0E89}, {0x8B, 4, 1, 0x7A7B}, {0x8F, 3, 0, 0x0E8D}, {0x92, 4, 1, 0x7A89},
+    {0x96, 105, 0, 0x0E90}, {0x40, 6, 0, 0x0EF9}, {0x46, 5, 1, 0x7AAE}, {0x4B, 11, 1, 0x7AB4},
+    {0x56, 11, 1, 0x7AC0}, {0x61, 10, 1, 0x7ACC}, {0x6B, 2, 0, 0x0EFF}, {0x6D, 4, 1, 0x7ADA},
+    {0x71, 3, 0, 0x0F01}, {0x74, 6, 1, 0x7AE7}, {0x7A, 1, 0, 0x0F04}, {0x7B, 4, 1, 0x7AF0},
+    {0x80, 5, 1, 0x7AF4}, {0x85, 122, 0, 0x0F05}, {0x40, 3, 0, 0x0F7F}, {0x43, 4, 1, 0x7B34},
+    {0x47, 3, 0, 0x0F82}, {0x4A, 6, 1, 0x7B3F}, {0x50, 13, 0, 0x0F85}, {0x5D, 11, 1, 0x7B63},
+    {0x68, 10, 0, 0x0F92}, {0x72, 4, 1, 0x7B81}, {0x76, 7, 1, 0x7B86}, {0x7D, 2, 0, 0x0F9C},
+    {0x80, 4, 0, 0x0F9E}, {0x84, 4, 1, 0x7B98}, {0x88, 14, 0, 0x0FA2}, {0x96, 8, 1, 0x7BB9},
+    {0x9E, 97, 0, 0x0FB0}, {0x40, 1, 0, 0x1011}, {0x41, 4, 1, 0x7BC8}, {0x45, 4, 1, 0x7BCD},
+    {0x49, 1, 0, 0x1012}, {0x4A, 5, 1, 0x7BD4}, {0x4F, 16, 0, 0x1013}, {0x5F, 5, 1, 0x7BF2},
+    {0x64, 4, 1, 0x7BF8}, {0x68, 1, 0, 0x1023}, {0x69, 8, 1, 0x7BFF}, {0x71, 5, 0, 0x1024},
+    {0x76, 6, 1, 0x7C10}, {0x7C, 3, 0, 0x1029}, {0x80, 5, 1, 0x7C1A}, {0x85, 6, 1, 0x7C20},
+    {0x8B, 2, 0, 0x102C}, {0x8D, 13, 1, 0x7C2B}, {0x9A, 6, 1, 0x7C39}, {0xA0, 95, 0, 0x102E},
+    {0x40, 10, 1, 0x7C43}, {0x4A, 37, 1, 0x7C4E}, {0x6F, 6, 1, 0x7C75}, {0x75, 10, 1, 0x7C7E},
+    {0x80, 1, 0, 0x108D}, {0x81, 7, 1, 0x7C8A}, {0x88, 9, 0, 0x108E}, {0x91, 4, 1, 0x7CA6},
+    {0x95, 5, 0, 0x1097}, {0x9A, 5, 1, 0x7CB4}, {0x9F, 96, 0, 0x109C}, {0x40, 8, 0, 0x10FC},
+    {0x48, 7, 1, 0x7CCE}, {0x4F, 5, 0, 0x1104}, {0x54, 7, 1, 0x7CE1}, {0x5B, 6, 1, 0x7CE9},
+    {0x61, 8, 1, 0x7CF0}, {0x69, 2, 0, 0x1109}, {0x6B, 14, 1, 0x7CFC}, {0x79, 6, 1, 0x7D0B},
+    {0x80, 15, 1, 0x7D11}, {0x8F, 1, 0, 0x110B}, {0x90, 4, 1, 0x7D23}, {0x94, 6, 0, 0x110C},
+    {0x9A, 7, 1, 0x7D30}, {0xA1, 94, 0, 0x1112}, {0x40, 55, 1, 0x7D37}, {0x77, 8, 1, 0x7D6F},
+    {0x80, 33, 1, 0x7D78}, {0xA1, 94, 0, 0x1170}, {0x40, 13, 1, 0x7D99}, {0x4D, 7, 1, 0x7DA7},
+    {0x54, 43, 1, 0x7DAF}, {0x80, 33, 1, 0x7DDA}, {0xA1, 94, 0, 0x11CE}, {0x40, 63, 1, 0x7DFB},
+    {0x80, 1, 0, 0x122C}, {0x81, 5, 1, 0x7E3C}, {0x86, 5, 1, 0x7E42}, {0x8B, 22, 1, 0x7E48},
+    {0xA1, 94, 0, 0x122D}, {0x40, 36, 1, 0x7E5E}, {0x64, 24, 1, 0x7E83}, {0x7C, 3, 0, 0x128B},
+    {0x80, 13, 0, 0x128E}, {0x8D, 7, 1, 0x7F3B}, {0x94, 1, 0, 0x129B}, {0x95, 10, 1, 0x7F46},
+    {0x9F, 96, 0, 0x129C}, {0x40, 2, 0, 0x12FC}, {0x42, 4, 1, 0x7F5B}, {0x46, 1, 0, 0x12FE},
+    {0x47, 5, 1, 0x7F63}, {0x4C, 6, 0, 0x12FF}, {0x52, 4, 1, 0x7F75}, {0x56, 4, 1, 0x7F7A},
+    {0x5A, 2, 0, 0x1305}, {0x5C, 8, 1, 0x7F82}, {0x64, 2, 0, 0x1307}, {0x66, 5, 1, 0x7F8F},
+    {0x6B, 5, 1, 0x7F95}, {0x70, 7, 0, 0x1309}, {0x77, 7, 1, 0x7FA8}, {0x7E, 1, 0, 0x1310},
+    {0x80, 5, 1, 0x7FB3}, {0x85, 7, 0, 0x1311}, {0x8C, 4, 1, 0x7FC6}, {0x90, 2, 0, 0x1318},
+    {0x92, 5, 1, 0x7FCF}, {0x97, 2, 0, 0x131A}, {0x99, 6, 1, 0x7FD9}, {0x9F, 96, 0, 0x131C},
+    {0x40, 3, 0, 0x137C}, {0x43, 4, 1, 0x7FEA}, {0x47, 2, 0, 0x137F}, {0x49, 7, 1, 0x7FF4},
+    {0x50, 4, 0, 0x1381}, {0x54, 4, 1, 0x8007}, {0x58, 12, 0, 0x1385}, {0x64, 6, 1, 0x802B},
+    {0x6A, 13, 0, 0x1391}, {0x77, 4, 1, 0x804E}, {0x7B, 4, 0, 0x139E}, {0x80, 1, 0, 0x13A2},
+    {0x81, 14, 1, 0x805B}, {0x8F, 6, 1, 0x806B}, {0x95, 12, 1, 0x8072}, {0xA1, 94, 0, 0x13A3},
+    {0x40, 6, 0, 0x1401}, {0x46, 6, 1, 0x808D}, {0x4C, 18, 0, 0x1407}, {0x5E, 5, 1, 0x80C7},
+    {0x63, 7, 1, 0x80CF}, {0x6A, 11, 0, 0x1419}, {0x75, 4, 1, 0x80FE}, {0x79, 6, 0, 0x1424},
+    {0x80, 7, 0, 0x142A}, {0x87, 13, 1, 0x811F}, {0x94, 7, 0, 0x1431}, {0x9B, 5, 1, 0x8139},
+    {0xA0, 95, 0, 0x1438}, {0x40, 6, 1, 0x8140}, {0x46, 9, 0, 0x1497}, {0x4F, 5, 1, 0x815B},
+    {0x54, 4, 1, 0x8161}, {0x58, 8, 0, 0x14A0}, {0x60, 4, 1, 0x8175}, {0x64, 1, 0, 0x14A8},
+    {0x65, 5, 1, 0x8183}, {0x6A, 1, 0, 0x14A9}, {0x6B, 4, 1, 0x818B}, {0x6F, 1, 0, 0x14AA},
+    {0x70, 6, 1, 0x8192}, {0x76, 2, 0, 0x14AB}, {0x78, 5, 1, 0x819E}, {0x7D, 2, 0, 0x14AD},
+    {0x80, 2, 0, 0x14AF}, {0x82, 8, 1, 0x81AB}, {0x8A, 6, 1, 0x81B4}, {0x90, 4, 1, 0x81BC},
+    {0x94, 6, 0, 0x14B1}, {0x9A, 7, 1, 0x81CD}, {0xA1, 94, 0, 0x14B7}, {0x40, 15, 1, 0x81D4},
+    {0x4F, 6, 0, 0x1515}, {0x55, 5, 1, 0x81EE}, {0x5A, 6, 1, 0x81F5}, {0x60, 3, 0, 0x151B},
+    {0x63, 5, 1, 0x8207}, {0x68, 4, 0, 0x151E}, {0x6C, 6, 1, 0x8215}, {0x72, 2, 0, 0x1522},
+    {0x74, 4, 1, 0x8224}, {0x78, 7, 0, 0x1524}, {0x80, 4, 1, 0x8240}, {0x84, 7, 0, 0x152B},
+    {0x8B, 8, 1, 0x8250}, {0x93, 1, 0, 0x1532}, {0x94, 4, 1, 0x825B}, {0x98, 8, 1, 0x8260},
+    {0xA0, 95, 0, 0x1533}, {0x40, 4, 1, 0x826A}, {0x44, 1, 0, 0x1592}, {0x45, 4, 1, 0x8275},
+    {0x49, 11, 0, 0x1593}, {0x54, 4, 1, 0x8293}, {0x58, 26, 0, 0x159E}, {0x72, 4, 1, 0x82E7},
+    {0x76, 9, 0, 0x15B8}, {0x80, 1, 0, 0x15C1}, {0x81, 5, 1, 0x82FC}, {0x86, 9, 0, 0x15C2},
+    {0x8F, 10, 1, 0x831D}, {0x99, 102, 0, 0x15CB}, {0x40, 7, 0, 0x1631}, {0x47, 5, 1, 0x834A},
+    {0x4C, 1, 0, 0x1638}, {0x4D, 5, 1, 0x8355}, {0x52, 2, 0, 0x1639}, {0x54, 7, 1, 0x8370},
+    {0x5B, 2, 0, 0x163B}, {0x5D, 7, 1, 0x837E}, {0x64, 2, 0, 0x163D}, {0x66, 4, 1, 0x838A},
+    {0x6A, 3, 0, 0x163F}, {0x6D, 4, 1, 0x8394}, {0x71, 4, 0, 0x1642}, {0x75, 7, 1, 0x83A1},
+    {0x7C, 3, 0, 0x1646}, {0x80, 14, 0, 0x1649}, {0x8E, 4, 1, 0x83D0}, {0x92, 109, 0, 0x1657},
+    {0x40, 2, 0, 0x16C4}, {0x42, 5, 1, 0x83F3}, {0x47, 8, 0, 0x16C6}, {0x4F, 4, 1, 0x8407},
+    {0x53, 1, 0, 0x16CE}, {0x54, 6, 1, 0x8412}, {0x5A, 3, 0, 0x16CF}, {0x5D, 6, 1, 0x841E},
+    {0x63, 8, 1, 0x8429}, {0x6B, 6, 1, 0x8432}, {0x71, 3, 0, 0x16D2}, {0x74, 8, 1, 0x843E},
+    {0x7C, 3, 0, 0x16D5}, {0x80, 7, 1, 0x844A}, {0x87, 5, 1, 0x8452}, {0x8C, 1, 0, 0x16D8},
+    {0x8D, 4, 1, 0x845D}, {0x91, 1, 0, 0x16D9}, {0x92, 5, 1, 0x8464}, {0x97, 104, 0, 0x16DA},
+    {0x40, 5, 1, 0x847D}, {0x45, 4, 1, 0x8483}, {0x49, 2, 0, 0x1742}, {0x4B, 8, 1, 0x848F},
+    {0x53, 3, 0, 0x1744}, {0x56, 4, 1, 0x849D}, {0x5A, 13, 1, 0x84A2}, {0x67, 12, 0, 0x1747},
+    {0x73, 4, 1, 0x84C5}, {0x77, 8, 0, 0x1753}, {0x80, 5, 1, 0x84D8}, {0x85, 4, 0, 0x175B},
+    {0x89, 5, 1, 0x84E7}, {0x8E, 3, 0, 0x175F}, {0x91, 11, 1, 0x84F1}, {0x9C, 99, 0, 0x1762},
+    {0x40, 9, 1, 0x8503}, {0x49, 4, 1, 0x850D}, {0x4D, 6, 0, 0x17C5}, {0x53, 4, 1, 0x851B},
+    {0x57, 1, 0, 0x17CB}, {0x58, 9, 1, 0x8522}, {0x61, 10, 1, 0x852D}, {0x6B, 5, 1, 0x853E},
+    {0x70, 4, 1, 0x8544}, {0x74, 11, 1, 0x854B}, {0x80, 2, 0, 0x17CC}, {0x82, 4, 1, 0x855A},
+    {0x86, 5, 1, 0x855F}, {0x8B, 3, 0, 0x17CE}, {0x8E, 9, 1, 0x8569}, {0x97, 1, 0, 0x17D1},
+    {0x98, 4, 1, 0x8575}, {0x9C, 99, 0, 0x17D2}, {0x40, 3, 0, 0x1835}, {0x43, 7, 1, 0x8588},
+    {0x4A, 11, 1, 0x8590}, {0x55, 7, 1, 0x859D}, {0x5C, 7, 0, 0x1838}, {0x63, 6, 1, 0x85B1},
+    {0x69, 1, 0, 0x183F}, {0x6A, 7, 1, 0x85BA}, {0x71, 7, 1, 0x85C2}, {0x78, 5, 1, 0x85CA},
+    {0x7D, 2, 0, 0x1840}, {0x80, 1, 0, 0x1842}, {0x81, 6, 1, 0x85D6}, {0x87, 7, 1, 0x85DD},
+    {0x8E, 4, 1, 0x85E5}, {0x92, 15, 1, 0x85EA}, {0xA1, 94, 0, 0x1843}, {0x40, 5, 0, 0x18A1},
+    {0x45, 5, 1, 0x8600}, {0x4A, 11, 1, 0x8606}, {0x55, 4, 1, 0x8612}, {0x59, 16, 1, 0x8617},
+    {0x69, 1, 0, 0x18A6}, {0x6A, 14, 1, 0x862A}, {0x78, 3, 0, 0x18A7}, {0x7B, 4, 1, 0x863D},
+    {0x80, 12, 1, 0x8641}, {0x8C, 2, 0, 0x18AA}, {0x8E, 5, 1, 0x8655}, {0x93, 6, 0, 0x18AC},
+    {0x99, 8, 1, 0x8663}, {0xA1, 94, 0, 0x18B2}, {0x40, 3, 0, 0x1910}, {0x43, 7, 1, 0x8672},
+    {0x4A, 7, 1, 0x8683}, {0x51, 5, 1, 0x868E}, {0x56, 1, 0, 0x1913}, {0x57, 6, 1, 0x8696},
+    {0x5D, 5, 1, 0x869E}, {0x62, 10, 0, 0x1914}, {0x6C, 5, 1, 0x86BB}, {0x71, 14, 0, 0x191E},
+    {0x80, 1, 0, 0x192C}, {0x81, 4, 1, 0x86E0}, {0x85, 4, 1, 0x86E5}, {0x89, 7, 0, 0x192D},
+    {0x90, 4, 1, 0x86FA}, {0x94, 7, 0, 0x1934}, {0x9B, 4, 1, 0x870E}, {0x9F, 96, 0, 0x193B},
+    {0x40, 9, 0, 0x199B}, {0x49, 4, 1, 0x872A}, {0x4D, 11, 0, 0x19A4}, {0x58, 7, 1, 0x8740},
+    {0x5F, 3, 0, 0x19AF}, {0x62, 4, 1, 0x874F}, {0x66, 4, 0, 0x19B2}, {0x6A, 6, 1, 0x875A},
+    {0x70, 2, 0, 0x19B6}, {0x72, 8, 1, 0x8766}, {0x7A, 5, 0, 0x19B8}, {0x80, 4, 1, 0x8777},
+    {0x84, 9, 0, 0x19BD}, {0x8D, 5, 1, 0x878E}, {0x92, 3, 0, 0x19C6}, {0x95, 7, 1, 0x8798},
+    {0x9C, 5, 1, 0x87A0}, {0xA1, 94, 0, 0x19C9}, {0x40, 10, 0, 0x1A27}, {0x4A, 4, 1, 0x87B6},
+    {0x4E, 4, 0, 0x1A31}, {0x52, 5, 1, 0x87C1}, {0x57, 3, 0, 0x1A35}, {0x5A, 5, 1, 0x87CC},
+    {0x5F, 7, 1, 0x87D4}, {0x66, 4, 1, 0x87DC}, {0x6A, 4, 1, 0x87E1}, {0x6E, 4, 1, 0x87E6},
+    {0x72, 3, 0, 0x1A38}, {0x75, 10, 1, 0x87EF}, {0x80, 4, 1, 0x87FA}, {0x84, 4, 1, 0x87FF},
+    {0x88, 6, 1, 0x8804}, {0x8E, 8, 1, 0x880B}, {0x96, 1, 0, 0x1A3B}, {0x97, 4, 1, 0x8817},
+    {0x9B, 5, 1, 0x881C}, {0xA0, 95, 0, 0x1A3C}, {0x40, 14, 1, 0x8824}, {0x4E, 6, 1, 0x8833},
+    {0x54, 8, 0, 0x1A9B}, {0x5C, 6, 1, 0x8846}, {0x62, 6, 1, 0x884E}, {0x68, 3, 0, 0x1AA3},
+    {0x6B, 7, 1, 0x885A}, {0x72, 6, 0, 0x1AA6}, {0x78, 4, 1, 0x8873}, {0x7C, 3, 0, 0x1AAC},
+    {0x80, 9, 0, 0x1AAF}, {0x89, 4, 1, 0x888E}, {0x8D, 3, 0, 0x1AB8}, {0x90, 5, 1, 0x8897},
+    {0x95, 5, 1, 0x889D}, {0x9A, 1, 0, 0x1ABB}, {0x9B, 6, 1, 0x88A5}, {0xA1, 94, 0, 0x1ABC},
+    {0x40, 4, 0, 0x1B1A}, {0x44, 5, 1, 0x88B2}, {0x49, 4, 1, 0x88B8}, {0x4D, 4, 1, 0x88BD},
+    {0x51, 4, 0, 0x1B1E}, {0x55, 4, 1, 0x88CA}, {0x59, 6, 0, 0x1B22}, {0x5F, 5, 1, 0x88DA},
+    {0x64, 4, 0, 0x1B28}, {0x68, 7, 1, 0x88E9}, {0x6F, 10, 0, 0x1B2C}, {0x79, 6, 1, 0x8903},
+    {0x80, 1, 0, 0x1B36}, {0x81, 5, 1, 0x890B}, {0x86, 1, 0, 0x1B37}, {0x87, 5, 1, 0x8914},
+    {0x8C, 5, 1, 0x891C}, {0x91, 3, 0, 0x1B38}, {0x94, 4, 1, 0x8926}, {0x98, 4, 1, 0x892C},
+    {0x9C, 99, 0, 0x1B3B}, {0x40, 9, 1, 0x8938}, {0x49, 2, 0, 0x1B9E}, {0x4B, 25, 1, 0x8945},
+    {0x64, 6, 1, 0x8960}, {0x6A, 20, 1, 0x8967}, {0x7E, 1, 0, 0x1BA0}, {0x80, 6, 0, 0x1BA1},
+    {0x86, 27, 1, 0x8987}, {0xA1, 94, 0, 0x1BA7}, {0x40, 31, 1, 0x89A2}, {0x5F, 10, 0, 0x1C05},
+    {0x69, 4, 1, 0x89DF}, {0x6D, 1, 0, 0x1C0F}, {0x6E, 4, 1, 0x89E7}, {0x72, 6, 0, 0x1C10},
+    {0x78, 7, 1, 0x89F4}, {0x80, 5, 1, 0x89FB}, {0x85, 6, 1, 0x8A01}, {0x8B, 22, 1, 0x8A08},
+    {0xA1, 94, 0, 0x1C16}, {0x40, 32, 1, 0x8A1E}, {0x60, 9, 1, 0x8A3F}, {0x69, 22, 1, 0x8A49},
+    {0x80, 26, 1, 0x8A5F}, {0x9A, 7, 1, 0x8A7A}, {0xA1, 94, 0, 0x1C74}, {0x40, 8, 1, 0x8A81},
+    {0x48, 8, 1, 0x8A8B}, {0x50, 47, 1, 0x8A94}, {0x80, 33, 1, 0x8AC3}, {0xA1, 94, 0, 0x1CD2},
+    {0x40, 35, 1, 0x8AE4}, {0x63, 28, 1, 0x8B08}, {0x80, 2, 0, 0x1D30}, {0x82, 31, 1, 0x8B27},
+    {0xA1, 94, 0, 0x1D32}, {0x40, 32, 1, 0x8B46}, {0x60, 5, 1, 0x8B67}, {0x65, 26, 1, 0x8B6D},
+    {0x80, 25, 1, 0x8B87}, {0x99, 97, 0, 0x1D90}, {0xFA, 5, 1, 0xE810}, {0x40, 9, 1, 0x8C38},
+    {0x49, 4, 1, 0x8C42}, {0x4D, 3, 0, 0x1DF1}, {0x50, 8, 1, 0x8C4D}, {0x58, 4, 1, 0x8C56},
+    {0x5C, 6, 1, 0x8C5B}, {0x62, 7, 1, 0x8C63}, {0x69, 7, 1, 0x8C6C}, {0x70, 4, 1, 0x8C74},
+    {0x74, 7, 1, 0x8C7B}, {0x7B, 4, 0, 0x1DF4}, {0x80, 2, 0, 0x1DF8}, {0x82, 7, 1, 0x8C8D},
+    {0x89, 3, 0, 0x1DFA}, {0x8C, 21, 1, 0x8C99}, {0xA1, 94, 0, 0x1DFD}, {0x40, 63, 1, 0x8CAE},
+    {0x80, 33, 1, 0x8CED}, {0xA1, 94, 0, 0x1E5B}, {0x40, 15, 1, 0x8D0E}, {0x4F, 14, 0, 0x1EB9},
+    {0x5D, 9, 1, 0x8D78}, {0x66, 2, 0, 0x1EC7}, {0x68, 4, 1, 0x8D86}, {0x6C, 5, 1, 0x8D8C},
+    {0x71, 2, 0, 0x1EC9}, {0x73, 10, 1, 0x8D95}, {0x7D, 2, 0, 0x1ECB}, {0x80, 1, 0, 0x1ECD},
+    {0x81, 13, 1, 0x8DA4}, {0x8E, 10, 0, 0x1ECE}, {0x98, 4, 1, 0x8DC7}, {0x9C, 99, 0, 0x1ED8},
+    {0x40, 19, 0, 0x1F3B}, {0x53, 7, 1, 0x8DFE}, {0x5A, 6, 0, 0x1F4E}, {0x60, 4, 1, 0x8E10},
+    {0x64, 8, 1, 0x8E15}, {0x6C, 2, 0, 0x1F54}, {0x6E, 5, 1, 0x8E24}, {0x73, 12, 0, 0x1F56},
+    {0x80, 4, 0, 0x1F62}, {0x84, 5, 1, 0x8E4C}, {0x89, 6, 1, 0x8E53}, {0x8F, 12, 1, 0x8E5A},
+    {0x9B, 100, 0, 0x1F66}, {0x40, 2, 0, 0x1FCA}, {0x42, 5, 1, 0x8E77}, {0x47, 7, 0, 0x1FCC},
+    {0x4E, 7, 1, 0x8E88}, {0x55, 3, 0, 0x1FD3}, {0x58, 7, 1, 0x8E95}, {0x5F, 1, 0, 0x1FD6},
+    {0x60, 12, 1, 0x8E9F}, {0x6C, 4, 0, 0x1FD7}, {0x70, 7, 1, 0x8EB3}, {0x77, 8, 1, 0x8EBB},
+    {0x80, 11, 1, 0x8EC3}, {0x8B, 22, 1, 0x8ECF}, {0xA1, 94, 0, 0x1FDB}, {0x40, 63, 1, 0x8EE5},
+    {0x80, 33, 1, 0x8F24}, {0xA1, 94, 0, 0x2039}, {0x40, 33, 1, 0x8F45}, {0x61, 8, 0, 0x2097},
+    {0x69, 4, 1, 0x8FA4}, {0x6D, 1, 0, 0x209F}, {0x6E, 4, 1, 0x8FAC}, {0x72, 4, 1, 0x8FB2},
+    {0x76, 9, 0, 0x20A0}, {0x80, 5, 1, 0x8FC9}, {0x85, 122, 0, 0x20A9}, {0x40, 5, 0, 0x2123},
+    {0x45, 6, 1, 0x9027}, {0x4B, 5, 1, 0x9030}, {0x50, 9, 0, 0x2128}, {0x59, 5, 1, 0x9048},
+    {0x5E, 6, 0, 0x2131}, {0x64, 6, 1, 0x905C}, {0x6A, 3, 0, 0x2137}, {0x6D, 4, 1, 0x9069},
+    {0x71, 5, 1, 0x906F}, {0x76, 7, 1, 0x9076}, {0x7D, 2, 0, 0x213A}, {0x80, 4, 1, 0x9084},
+    {0x84, 2, 0, 0x213C}, {0x86, 5, 1, 0x908C}, {0x8B, 116, 0, 0x213E}, {0x40, 25, 0, 0x21B2},
+    {0x59, 4, 1, 0x90F0}, {0x5D, 3, 0, 0x21CB}, {0x60, 4, 1, 0x90F9}, {0x64, 4, 0, 0x21CE},
+    {0x68, 20, 1, 0x9105}, {0x7C, 3, 0, 0x21D2}, {0x80, 4, 0, 0x21D5}, {0x84, 11, 1, 0x9124},
+    {0x8F, 1, 0, 0x21D9}, {0x90, 7, 1, 0x9132}, {0x97, 9, 1, 0x913A}, {0xA0, 95, 0, 0x21DA},
+    {0x40, 4, 0, 0x2239}, {0x44, 4, 1, 0x9153}, {0x48, 15, 0, 0x223D}, {0x57, 5, 1, 0x9180},
+    {0x5C, 5, 0, 0x224C}, {0x61, 7, 1, 0x9193}, {0x68, 6, 1, 0x919C}, {0x6E, 6, 1, 0x91A4},
+    {0x74, 2, 0, 0x2251}, {0x76, 4, 1, 0x91B0}, {0x7A, 4, 1, 0x91B6}, {0x7E, 1, 0, 0x2253},
+    {0x80, 11, 1, 0x91BC}, {0x8B, 3, 0, 0x2254}, {0x8E, 10, 1, 0x91D2}, {0x98, 9, 1, 0x91DD},
+    {0xA1, 94, 0, 0x2257}, {0x40, 63, 1, 0x91E6}, {0x80, 33, 1, 0x9225}, {0xA1, 27, 0, 0x22B5},
+    {0xBC, 6, 1, 0x9967}, {0xC2, 61, 0, 0x22D0}, {0x40, 46, 1, 0x9246}, {0x6E, 17, 1, 0x9275},
+    {0x80, 8, 1, 0x9286}, {0x88, 25, 1, 0x928F}, {0xA1, 48, 0, 0x230D}, {0xD1, 4, 1, 0x960A},
+    {0xD5, 42, 0, 0x233D}, {0x40, 6, 1, 0x92A8}, {0x46, 25, 1, 0x92AF}, {0x5F, 32, 1, 0x92C9},
+    {0x80, 33, 1, 0x92E9}, {0xA1, 94, 0, 0x2367}, {0x40, 52, 1, 0x930A}, {0x74, 11, 1, 0x933F},
+    {0x80, 32, 1, 0x934A}, {0xA0, 95, 0, 0x23C5}, {0x40, 35, 1, 0x936C}, {0x63, 28, 1, 0x9390},
+    {0x80, 30, 1, 0x93AC}, {0x9E, 97, 0, 0x2424}, {0x40, 8, 1, 0x93CE}, {0x48, 55, 1, 0x93D7},
+    {0x80, 33, 1, 0x940E}, {0xA1, 41, 0, 0x2485}, {0xCA, 7, 1, 0x7F21}, {0xD1, 4, 1, 0x7F2A},
+    {0xD5, 5, 1, 0x7F2F}, {0xDA, 37, 0, 0x24AE}, {0x40, 15, 1, 0x942F}, {0x4F, 44, 1, 0x943F},
+    {0x7B, 4, 1, 0x946C}, {0x80, 21, 1, 0x9470}, {0x95, 106, 0, 0x24D3}, {0x40, 12, 0, 0x253D},
+    {0x4C, 8, 1, 0x9577}, {0x54, 43, 1, 0x9580}, {0x80, 33, 1, 0x95AB}, {0xA1, 94, 0, 0x2549},
+    {0x40, 28, 1, 0x95CC}, {0x5C, 8, 0, 0x25A7}, {0x64, 7, 1, 0x9623}, {0x6B, 5, 0, 0x25AF},
+    {0x70, 4, 1, 0x9637}, {0x74, 11, 0, 0x25B4}, {0x80, 11, 0, 0x25BF}, {0x8B, 5, 1, 0x966D},
+    {0x90, 1, 0, 0x25CA}, {0x91, 13, 1, 0x9678}, {0x9E, 78, 0, 0x25CB}, {0xEC, 4, 1, 0x89CE},
+    {0xF0, 15, 0, 0x2619}, {0x40, 9, 0, 0x2628}, {0x49, 10, 1, 0x969D}, {0x53, 8, 1, 0x96A8},
+    {0x5B, 18, 0, 0x2631}, {0x6D, 10, 1, 0x96D6}, {0x77, 7, 1, 0x96E1}, {0x7E, 1, 0, 0x2643},
+    {0x80, 9, 0, 0x2644}, {0x89, 4, 1, 0x96FA}, {0x8D, 12, 0, 0x264D}, {0x99, 5, 1, 0x9717},
+    {0x9E, 44, 0, 0x2659}, {0xCA, 4, 1, 0x80E7}, {0xCE, 49, 0, 0x2685}, {0x40, 9, 1, 0x9721},
+    {0x49, 5, 0, 0x26B6}, {0x4E, 5, 1, 0x9733}, {0x53, 4, 1, 0x973A}, {0x57, 19, 1, 0x973F},
+    {0x6A, 13, 0, 0x26BB}, {0x77, 8, 1, 0x976A}, {0x80, 2, 0, 0x26C8}, {0x82, 5, 1, 0x9777},
+    {0x87, 8, 1, 0x977D}, {0x8F, 5, 1, 0x9786}, {0x94, 8, 0, 0x26CA}, {0x9C, 5, 1, 0x9799},
+    {0xA1, 94, 0, 0x26D2}, {0x40, 4, 0, 0x2730}, {0x44, 7, 1, 0x97A4}, {0x4B, 5, 0, 0x2734},
+    {0x50, 47, 1, 0x97B5}, {0x80, 3, 0, 0x2739}, {0x83, 5, 1, 0x97EE}, {0x88, 1, 0, 0x273C},
+    {0x89, 24, 1, 0x97F7}, {0xA1, 94, 0, 0x273D}, {0x40, 63, 1, 0x980F}, {0x80, 33, 1, 0x984E},
+    {0xA1, 60, 0, 0x279B}, {0xDD, 5, 1, 0x94B6}, {0xE2, 4, 0, 0x27D7}, {0xE6, 7, 1, 0x94C8},
+    {0xED, 18, 0, 0x27DB}, {0x40, 6, 1, 0x986F}, {0x46, 6, 0, 0x27ED}, {0x4C, 38, 1, 0x98A8},
+    {0x72, 8, 0, 0x27F3}, {0x7A, 5, 1, 0x98E0}, {0x80, 2, 0, 0x27FB}, {0x82, 31, 1, 0x98E9},
+    {0xA1, 21, 0, 0x27FD}, {0xB6, 5, 1, 0x9512}, {0xBB, 31, 0, 0x2812}, {0xDA, 4, 1, 0x9556},
+    {0xDE, 6, 0, 0x2831}, {0xE4, 9, 1, 0x9564}, {0xED, 18, 0, 0x2837}, {0x40, 5, 1, 0x9908},
+    {0x45, 2, 0, 0x2849}, {0x47, 29, 1, 0x9911}, {0x64, 27, 1, 0x992F}, {0x80, 10, 1, 0x994A},
+    {0x8A, 13, 1, 0x9956}, {0x97, 26, 0, 0x284B}, {0xB1, 5, 1, 0x9E28}, {0xB6, 11, 0, 0x2865},
+    {0xC1, 4, 1, 0x9E46}, {0xC5, 11, 0, 0x2870}, {0xD0, 7, 1, 0x9E66}, {0xD7, 40, 0, 0x287B},
+    {0x40, 2, 0, 0x28A3}, {0x42, 11, 1, 0x999A}, {0x4D, 2, 0, 0x28A5}, {0x4F, 48, 1, 0x99A9},
+    {0x80, 33, 1, 0x99D9}, {0xA1, 94, 0, 0x28A7}, {0x40, 63, 1, 0x99FA}, {0x80, 33, 1, 0x9A39},
+    {0xA1, 94, 0, 0x2905}, {0x40, 18, 1, 0x9A5A}, {0x52, 9, 0, 0x2963}, {0x5B, 7, 1, 0x9AA9},
+    {0x62, 4, 1, 0x9AB2}, {0x66, 7, 0, 0x296C}, {0x6D, 5, 1, 0x9AC6}, {0x72, 4, 1, 0x9ACD},
+    {0x76, 1, 0, 0x2973}, {0x77, 4, 1, 0x9AD4}, {0x7B, 4, 1, 0x9AD9}, {0x80, 3, 0, 0x2974},
+    {0x83, 4, 1, 0x9AE2}, {0x87, 4, 1, 0x9AE7}, {0x8B, 2, 0, 0x2977}, {0x8D, 9, 1, 0x9AF0},
+    {0x96, 1, 0, 0x2979}, {0x97, 7, 1, 0x9AFC}, {0x9E, 97, 0, 0x297A}, {0x40, 1, 0, 0x29DB},
+    {0x41, 6, 1, 0x9B09}, {0x47, 3, 0, 0x29DC}, {0x4A, 11, 1, 0x9B14}, {0x55, 3, 0, 0x29DF},
+    {0x58, 11, 1, 0x9B24}, {0x63, 2, 0, 0x29E2}, {0x65, 8, 1, 0x9B33}, {0x6D, 4, 1, 0x9B3D},
+    {0x71, 8, 0, 0x29E4}, {0x79, 6, 1, 0x9B55}, {0x80, 33, 1, 0x9B5B}, {0xA1, 94, 0, 0x29EC},
+    {0x40, 63, 1, 0x9B7C}, {0x80, 33, 1, 0x9BBB}, {0xA1, 94, 0, 0x2A4A}, {0x40, 63, 1, 0x9BDC},
+    {0x80, 33, 1, 0x9C1B}, {0xA1, 20, 0, 0x2AA8}, {0xB5, 6, 1, 0x9F85}, {0xBB, 22, 0, 0x2ABC},
+    {0xD1, 4, 1, 0x9C85}, {0xD5, 10, 0, 0x2AD2}, {0xDF, 6, 1, 0x9C9E}, {0xE5, 5, 1, 0x9CA5},
+    {0xEA, 3, 0, 0x2ADC}, {0xED, 8, 1, 0x9CB0}, {0xF5, 4, 1, 0x9CBA}, {0xF9, 4, 1, 0x9CC4},
+    {0xFD, 2, 0, 0x2ADF}, {0x40, 63, 1, 0x9C3C}, {0x80, 11, 0, 0x2AE1}, {0x8B, 4, 1, 0x9C96},
+    {0x8F, 5, 0, 0x2AEC}, {0x94, 5, 1, 0x9CBE}, {0x99, 8, 0, 0x2AF1}, {0xA1, 5, 1, 0x9CCC},
+    {0xA6, 89, 0, 0x2AF9}, {0x40, 63, 1, 0x9CE3}, {0x80, 33, 1, 0x9D22}, {0xA1, 94, 1, 0xE234},
+    {0x40, 63, 1, 0x9D43}, {0x80, 33, 1, 0x9D82}, {0xA1, 94, 1, 0xE292}, {0x40, 63, 1, 0x9DA3},
+    {0x80, 33, 1, 0x9DE2}, {0xA1, 94, 1, 0xE2F0}, {0x40, 28, 1, 0x9E03}, {0x5C, 16, 0, 0x2B52},
+    {0x6C, 4, 1, 0x9E5F}, {0x70, 4, 0, 0x2B62}, {0x74, 10, 1, 0x9E74}, {0x7E, 1, 0, 0x2B66},
+    {0x80, 1, 0, 0x2B67}, {0x81, 4, 1, 0x9E83}, {0x85, 2, 0, 0x2B68}, {0x87, 6, 1, 0x9E8C},
+    {0x8D, 9, 1, 0x9E94}, {0x96, 1, 0, 0x2B6A}, {0x97, 6, 1, 0x9EA0}, {0x9D, 4, 1, 0x9EA7},
+    {0xA1, 94, 1, 0xE34E}, {0x40, 9, 1, 0x9EAB}, {0x49, 6, 0, 0x2B6B}, {0x4F, 5, 1, 0x9EBF},
+    {0x54, 4, 1, 0x9EC5}, {0x58, 17, 0, 0x2B71}, {0x69, 4, 1, 0x9EEB}, {0x6D, 9, 1, 0x9EF0},
+    {0x76, 2, 0, 0x2B82}, {0x78, 7, 1, 0x9EFF}, {0x80, 5, 1, 0x9F06}, {0x85, 8, 0, 0x2B84},
+    {0x8D, 6, 1, 0x9F1A}, {0x93, 1, 0, 0x2B8C}, {0x94, 9, 1, 0x9F23}, {0x9D, 4, 0, 0x2B8D},
+    {0xA1, 94, 1, 0xE3AC}, {0x40, 5, 1, 0x9F32}, {0x45, 3, 0, 0x2B91}, {0x48, 5, 1, 0x9F3F},
+    {0x4D, 11, 1, 0x9F45}, {0x58, 39, 1, 0x9F52}, {0x80, 6, 1, 0x9F79}, {0x86, 2, 0, 0x2B94},
+    {0x88, 12, 1, 0x9F8D}, {0x94, 3, 0, 0x2B96}, {0x97, 5, 1, 0x9FA1}, {0x9C, 5, 0, 0x2B99},
+    {0xA1, 94, 1, 0xE40A}, {0x40, 4, 1, 0xFA0C}, {0x44, 59, 0, 0x2B9E}, {0x80, 24, 0, 0x2BD9},
+    {0x98, 7, 1, 0x4D13}, {0x9F, 2, 0, 0x2BF1}, {0xA1, 94, 1, 0xE468},
+};
+
+static const uint16_t gb2_literals[11251] = {
+    0x4E02, 0x4E04, 0x4E05, 0x4E06, 0x4E0F, 0x4E12, 0x4E17, 0x4E1F, 0x4E20, 0x4E21,
+    0x4E23, 0x4E26, 0x4E29, 0x4E2E, 0x4E2F, 0x4E31, 0x4E33, 0x4E35, 0x4E37, 0x4E3C,
+    0x4E40, 0x4E41, 0x4E42, 0x4E44, 0x4E46, 0x4E4A, 0x4E51, 0x4E55, 0x4E57, 0x4E5A,
+    0x4E5B, 0x4E67, 0x4E68, 0x4E72, 0x4E87, 0x4E8A, 0x4E90, 0x4E96, 0x4E97, 0x4E99,
+    0x4E9C, 0x4E9D, 0x4E9E, 0x4EA3, 0x4EAA, 0x4EAF, 0x4EB0, 0x4EB1, 0x4EB4, 0x4EBC,
+    0x4EBD, 0x4EBE, 0x4EC8, 0x4ECC, 0x4ECF, 0x4ED0, 0x4ED2, 0x4EDA, 0x4EDB, 0x4EDC,
+    0x4EE0, 0x4EE2, 0x4EE6, 0x4EE7, 0x4EE9, 0x4EED, 0x4EEE, 0x4EEF, 0x4EF1, 0x4EF4,
+    0x4EF8, 0x4EF9, 0x4EFA, 0x4EFC, 0x4EFE, 0x4F00, 0x4F0B, 0x4F0C, 0x4F1C, 0x4F1D,
+    0x4F21, 0x4F23, 0x4F28, 0x4F29, 0x4F2C, 0x4F2D, 0x4F2E, 0x4F31, 0x4F33, 0x4F35,
+    0x4F37, 0x4F39, 0x4F3B, 0x4F44, 0x4F45, 0x4F52, 0x4F54, 0x4F56, 0x4F61, 0x4F62,
+    0x4F66, 0x4F68, 0x4F6A, 0x4F6B, 0x4F6D, 0x4F6E, 0x4F71, 0x4F72, 0x4F75, 0x4F7D,
+    0x4F80, 0x4F81, 0x4F82, 0x4F85, 0x4F86, 0x4F87, 0x4F8A, 0x4F8C, 0x4F8E, 0x4F90,
+    0x4F92, 0x4F93, 0x4F95, 0x4F96, 0x4F98, 0x4F99, 0x4F9A, 0x4F9C, 0x4F9E, 0x4F9F,
+    0x4FA1, 0x4FA2, 0x4FA4, 0x4FAB, 0x4FAD, 0x4FC0, 0x4FC1, 0x4FC2, 0x4FCB, 0x4FCC,
+    0x4FCD, 0x4FD9, 0x4FDB, 0x4FE0, 0x4FE2, 0x4FE4, 0x4FE5, 0x4FE7, 0x4FEB, 0x4FEC,
+    0x4FF0, 0x4FF2, 0x4FF9, 0x4FFB, 0x4FFC, 0x4FFD, 0x500B, 0x500E, 0x5010, 0x5011,
+    0x5013, 0x5015, 0x5016, 0x5017, 0x501B, 0x501D, 0x501E, 0x5020, 0x5022, 0x5023,
+    0x5024, 0x5027, 0x502B, 0x503B, 0x503D, 0x5044, 0x5045, 0x5046, 0x5049, 0x504A,
+    0x504B, 0x504D, 0x505B, 0x5078, 0x5079, 0x507A, 0x507C, 0x507D, 0x5086, 0x5087,
+    0x50A4, 0x50A6, 0x50AA, 0x50AB, 0x50BC, 0x50D7, 0x50D8, 0x50D9, 0x50F4, 0x5108,
+    0x5109, 0x510A, 0x5142, 0x5147, 0x514A, 0x514C, 0x514E, 0x514F, 0x5150, 0x5152,
+    0x5153, 0x5157, 0x5158, 0x5159, 0x515B, 0x5163, 0x5164, 0x5166, 0x5167, 0x5169,
+    0x516A, 0x516F, 0x5172, 0x517A, 0x517E, 0x517F, 0x5183, 0x5184, 0x5186, 0x5187,
+    0x518A, 0x518B, 0x5193, 0x5194, 0x5198, 0x519A, 0x519D, 0x519E, 0x519F, 0x51A1,
+    0x51A3, 0x51AD, 0x51AE, 0x51B4, 0x51B8, 0x51B9, 0x51BA, 0x51BE, 0x51BF, 0x51C1,
+    0x51C2, 0x51C3, 0x51C5, 0x51C8, 0x51CA, 0x51CD, 0x51CE, 0x51D0, 0x51D8, 0x51D9,
+    0x51DA, 0x51DC, 0x51DE, 0x51DF, 0x51E2, 0x51E3, 0x51EC, 0x51EE, 0x51F1, 0x51F2,
+    0x51F4, 0x51F7, 0x51FE, 0x5204, 0x5205, 0x5209, 0x520B, 0x520C, 0x520F, 0x5210,
+    0x5213, 0x5214, 0x5215, 0x521C, 0x521E, 0x521F, 0x5221, 0x5222, 0x5223, 0x5225,
+    0x5226, 0x5227, 0x522A, 0x522C, 0x522F, 0x5231, 0x5232, 0x5234, 0x5235, 0x523C,
+    0x523E, 0x524B, 0x524E, 0x524F, 0x5252, 0x5253, 0x5255, 0x5257, 0x5258, 0x5259,
+    0x525A, 0x525B, 0x525D, 0x525F, 0x5260, 0x5262, 0x5263, 0x5264, 0x5266, 0x5268,
+    0x5270, 0x5271, 0x527E, 0x5280, 0x5291, 0x5292, 0x529C, 0x52AE, 0x52AF, 0x52B0,
+    0x52C0, 0x52C1, 0x52C2, 0x52C4, 0x52C5, 0x52C6, 0x52C8, 0x52CA, 0x52D1, 0x52D3,
+    0x52D4, 0x52D5, 0x52D7, 0x52FB, 0x52FC, 0x52FD, 0x5307, 0x530E, 0x5318, 0x531B,
+    0x531C, 0x531E, 0x531F, 0x5322, 0x5324, 0x5325, 0x5327, 0x5328, 0x5329, 0x532B,
+    0x532C, 0x532D, 0x533C, 0x533D, 0x5340, 0x5342, 0x5344, 0x5346, 0x534B, 0x534C,
+    0x534D, 0x5350, 0x5354, 0x5358, 0x5359, 0x535B, 0x535D, 0x5365, 0x5368, 0x536A,
+    0x536C, 0x536D, 0x5372, 0x5376, 0x5379, 0x5380, 0x5381, 0x5383, 0x5387, 0x5388,
+    0x538A, 0x538E, 0x538F, 0x5396, 0x5397, 0x5399, 0x539B, 0x539C, 0x539E, 0x53A0,
+    0x53A1, 0x53A4, 0x53A7, 0x53BC, 0x53BD, 0x53BE, 0x53C0, 0x53CE, 0x53CF, 0x53D0,
+    0x53D2, 0x53D3, 0x53D5, 0x53DA, 0x53DC, 0x53DD, 0x53DE, 0x53E1, 0x53E2, 0x53E7,
+    0x53F4, 0x53FA, 0x53FE, 0x53FF, 0x5400, 0x5402, 0x5405, 0x5407, 0x540B, 0x5414,
+    0x5418, 0x5419, 0x541A, 0x541C, 0x5422, 0x5424, 0x5425, 0x542A, 0x5430, 0x5433,
+    0x5436, 0x5437, 0x543A, 0x543D, 0x543F, 0x5441, 0x5442, 0x5444, 0x5445, 0x5447,
+    0x5449, 0x5451, 0x545A, 0x5463, 0x5465, 0x5467, 0x5474, 0x5479, 0x547A, 0x547E,
+    0x547F, 0x5481, 0x5483, 0x5485, 0x548D, 0x5491, 0x5493, 0x5497, 0x5498, 0x549C,
+    0x54A2, 0x54A5, 0x54AE, 0x54B0, 0x54B2, 0x54B5, 0x54B6, 0x54B7, 0x54B9, 0x54BA,
+    0x54BC, 0x54BE, 0x54C3, 0x54C5, 0x54CA, 0x54CB, 0x54D6, 0x54D8, 0x54DB, 0x54EB,
+    0x54EC, 0x54EF, 0x54F0, 0x54F1, 0x54FB, 0x54FE, 0x5500, 0x5508, 0x5512, 0x5513,
+    0x5521, 0x5525, 0x5526, 0x5528, 0x5529, 0x552B, 0x552D, 0x5532, 0x5534, 0x5535,
+    0x5536, 0x553D, 0x5540, 0x5542, 0x5545, 0x5547, 0x5548, 0x5562, 0x5563, 0x5568,
+    0x5569, 0x556B, 0x5579, 0x557A, 0x557D, 0x557F, 0x5585, 0x5586, 0x558C, 0x558D,
+    0x558E, 0x5590, 0x5592, 0x5593, 0x5595, 0x5596, 0x5597, 0x559A, 0x559B, 0x559E,
+    0x55B2, 0x55B4, 0x55B6, 0x55B8, 0x55BA, 0x55BC, 0x55C6, 0x55C7, 0x55C8, 0x55CA,
+    0x55CB, 0x55CE, 0x55CF, 0x55D0, 0x55D5, 0x55DE, 0x55E0, 0x55E2, 0x55E7, 0x55E9,
+    0x55ED, 0x55EE, 0x55F0, 0x55F1, 0x55F4, 0x55F6, 0x55FF, 0x5606, 0x5607, 0x560A,
+    0x560B, 0x560D, 0x5619, 0x561A, 0x561C, 0x561D, 0x5620, 0x5621, 0x5622, 0x5625,
+    0x5626, 0x562E, 0x562F, 0x5630, 0x5633, 0x5635, 0x5637, 0x5638, 0x563A, 0x563C,
+    0x563D, 0x563E, 0x5655, 0x5656, 0x565A, 0x565B, 0x5663, 0x5665, 0x5666, 0x5667,
+    0x5690, 0x5691, 0x5692, 0x56D5, 0x56D6, 0x56D8, 0x56D9, 0x56DC, 0x56E3, 0x56EC,
+    0x56EE, 0x56EF, 0x56F2, 0x56F3, 0x56F6, 0x56F7, 0x56F8, 0x56FB, 0x56FC, 0x5700,
+    0x5701, 0x5702, 0x5705, 0x5707, 0x571D, 0x571E, 0x5720, 0x5721, 0x5722, 0x572B,
+    0x5731, 0x5732, 0x573C, 0x573D, 0x573F, 0x5741, 0x5748, 0x5749, 0x574B, 0x5758,
+    0x5759, 0x5762, 0x5763, 0x5765, 0x5767, 0x576C, 0x576E, 0x5770, 0x5771, 0x5772,
+    0x5774, 0x5775, 0x5778, 0x5779, 0x577A, 0x5781, 0x57A5, 0x57A8, 0x57AA, 0x57AC,
+    0x57AF, 0x57B0, 0x57B1, 0x57B3, 0x57B5, 0x57B6, 0x57B7, 0x57CC, 0x57CD, 0x57D0,
+    0x57D1, 0x57D3, 0x57D6, 0x57D7, 0x57DB, 0x57DC, 0x57DE, 0x57E1, 0x57E2, 0x57E3,
+    0x57EE, 0x57F5, 0x57F6, 0x57F7, 0x57FB, 0x57FC, 0x57FE, 0x57FF, 0x5801, 0x5803,
+    0x5804, 0x5805, 0x5808, 0x5809, 0x580A, 0x580C, 0x580E, 0x580F, 0x5810, 0x5812,
+    0x5813, 0x5814, 0x5816, 0x5817, 0x5818, 0x581F, 0x5822, 0x5823, 0x584E, 0x584F,
+    0x5850, 0x5852, 0x5853, 0x5855, 0x5856, 0x5857, 0x587F, 0x5882, 0x5884, 0x5886,
+    0x5887, 0x5888, 0x588A, 0x588B, 0x588C, 0x589B, 0x589C, 0x589D, 0x58C2, 0x58C3,
+    0x58C4, 0x58D2, 0x58D3, 0x58D4, 0x58ED, 0x58EF, 0x58F1, 0x58F2, 0x58F4, 0x58F5,
+    0x58F7, 0x58F8, 0x5903, 0x5905, 0x5906, 0x590E, 0x5917, 0x5918, 0x591B, 0x591D,
+    0x591E, 0x5926, 0x5928, 0x592C, 0x5930, 0x5932, 0x5933, 0x5935, 0x5936, 0x593B,
+    0x5943, 0x5945, 0x5946, 0x594A, 0x594C, 0x594D, 0x5950, 0x5952, 0x5953, 0x5959,
+    0x5961, 0x5963, 0x5964, 0x5975, 0x5977, 0x597A, 0x597B, 0x597C, 0x597E, 0x597F,
+    0x5980, 0x5985, 0x5989, 0x598B, 0x598C, 0x5994, 0x5995, 0x5998, 0x59A6, 0x59A7,
+    0x59AC, 0x59AD, 0x59B0, 0x59B1, 0x59BA, 0x59BC, 0x59BD, 0x59C7, 0x59C8, 0x59C9,
+    0x59D5, 0x59D6, 0x59D9, 0x59DB, 0x59E4, 0x59E6, 0x59E7, 0x59E9, 0x59EA, 0x59EB,
+    0x59FA, 0x59FC, 0x59FD, 0x59FE, 0x5A00, 0x5A02, 0x5A0A, 0x5A0B, 0x5A12, 0x5A19,
+    0x5A1A, 0x5A1B, 0x5A1D, 0x5A1E, 0x5A21, 0x5A22, 0x5A24, 0x5A26, 0x5A27, 0x5A28,
+    0x5A33, 0x5A35, 0x5A3D, 0x5A3E, 0x5A3F, 0x5A47, 0x5A48, 0x5A61, 0x5A68, 0x5A69,
+    0x5A78, 0x5A79, 0x5AAB, 0x5AAC, 0x5AB4, 0x5AB6, 0x5AB7, 0x5ABF, 0x5AC0, 0x5ACA,
+    0x5ACB, 0x5AD3, 0x5AD5, 0x5AD7, 0x5AD9, 0x5ADA, 0x5ADB, 0x5ADD, 0x5ADE, 0x5ADF,
+    0x5AE2, 0x5AE4, 0x5AE5, 0x5AE7, 0x5AE8, 0x5AEA, 0x5B33, 0x5B35, 0x5B36, 0x5B52,
+    0x5B56, 0x5B5E, 0x5B60, 0x5B61, 0x5B67, 0x5B68, 0x5B6B, 0x5B6D, 0x5B6E, 0x5B6F,
+    0x5B72, 0x5B74, 0x5B7B, 0x5B7C, 0x5B7E, 0x5B7F, 0x5B82, 0x5B86, 0x5B8A, 0x5B8D,
+    0x5B8E, 0x5B90, 0x5B91, 0x5B92, 0x5B94, 0x5B96, 0x5B9F, 0x5BA7, 0x5BA8, 0x5BA9,
+    0x5BB1, 0x5BB2, 0x5BB7, 0x5BBA, 0x5BBB, 0x5BBC, 0x5BC0, 0x5BC1, 0x5BC3, 0x5BCD,
+    0x5BCE, 0x5BCF, 0x5BD1, 0x5BE0, 0x5BE2, 0x5BE3, 0x5BE6, 0x5BE7, 0x5BEF, 0x5BFD,
+    0x5BFE, 0x5C00, 0x5C02, 0x5C03, 0x5C05, 0x5C07, 0x5C08, 0x5C10, 0x5C12, 0x5C13,
+    0x5C17, 0x5C19, 0x5C1B, 0x5C23, 0x5C26, 0x5C32, 0x5C33, 0x5C35, 0x5C36, 0x5C37,
+    0x5C43, 0x5C44, 0x5C46, 0x5C47, 0x5C4C, 0x5C4D, 0x5C52, 0x5C53, 0x5C54, 0x5C56,
+    0x5C57, 0x5C58, 0x5C5F, 0x5C62, 0x5C64, 0x5C70, 0x5C80, 0x5C89, 0x5C8A, 0x5C8B,
+    0x5C8E, 0x5C8F, 0x5C92, 0x5C93, 0x5C95, 0x5CAA, 0x5CAE, 0x5CAF, 0x5CB0, 0x5CB2,
+    0x5CB4, 0x5CB6, 0x5CBE, 0x5CC0, 0x5CC2, 0x5CC3, 0x5CE2, 0x5CE3, 0x5CE7, 0x5CE9,
+    0x5CEB, 0x5CEC, 0x5CEE, 0x5CEF, 0x5D01, 0x5D04, 0x5D05, 0x5D15, 0x5D1C, 0x5D1D,
+    0x5D25, 0x5D28, 0x5D2A, 0x5D2B, 0x5D2C, 0x5D48, 0x5D49, 0x5D59, 0x5D5A, 0x5D5C,
+    0x5D6A, 0x5D6D, 0x5D6E, 0x5D9A, 0x5D9B, 0x5D9C, 0x5D9E, 0x5D9F, 0x5DA0, 0x5DDC,
+    0x5DDF, 0x5DE0, 0x5DE3, 0x5DE4, 0x5DEA, 0x5DEC, 0x5DED, 0x5DF0, 0x5DF5, 0x5DF6,
+    0x5DFF, 0x5E00, 0x5E04, 0x5E07, 0x5E09, 0x5E0A, 0x5E0B, 0x5E0D, 0x5E0E, 0x5E12,
+    0x5E13, 0x5E17, 0x5E2F, 0x5E30, 0x5E39, 0x5E3A, 0x5E43, 0x5E5C, 0x5E5D, 0x5E5F,
+    0x5E60, 0x5E75, 0x5E77, 0x5E79, 0x5E7E, 0x5E81, 0x5E82, 0x5E83, 0x5E85, 0x5E88,
+    0x5E89, 0x5E8C, 0x5E8D, 0x5E8E, 0x5E92, 0x5E98, 0x5E9B, 0x5E9D, 0x5EB4, 0x5EC6,
+    0x5EC7, 0x5EC8, 0x5ED4, 0x5ED5, 0x5EE9, 0x5EF5, 0x5EF8, 0x5EF9, 0x5EFB, 0x5EFC,
+    0x5EFD, 0x5F05, 0x5F06, 0x5F07, 0x5F09, 0x5F0C, 0x5F0D, 0x5F0E, 0x5F10, 0x5F12,
+    0x5F14, 0x5F16, 0x5F19, 0x5F1A, 0x5F1C, 0x5F1D, 0x5F1E, 0x5F28, 0x5F2B, 0x5F2C,
+    0x5F2E, 0x5F30, 0x5F3B, 0x5F3D, 0x5F3E, 0x5F3F, 0x5F51, 0x5F54, 0x5F5E, 0x5F5F,
+    0x5F60, 0x5F63, 0x5F65, 0x5F67, 0x5F68, 0x5F6B, 0x5F6E, 0x5F6F, 0x5F72, 0x5F74,
+    0x5F75, 0x5F76, 0x5F78, 0x5F7A, 0x5F7D, 0x5F7E, 0x5F7F, 0x5F83, 0x5F86, 0x5F8D,
+    0x5F8E, 0x5F8F, 0x5F91, 0x5F93, 0x5F94, 0x5F96, 0x5F9A, 0x5F9B, 0x5FA9, 0x5FAB,
+    0x5FAC, 0x5FB6, 0x5FC7, 0x5FC8, 0x5FCA, 0x5FCB, 0x5FCE, 0x5FD3, 0x5FD4, 0x5FD5,
+    0x5FDA, 0x5FDB, 0x5FDC, 0x5FDE, 0x5FDF, 0x5FE2, 0x5FE3, 0x5FE5, 0x5FE6, 0x5FE8,
+    0x5FE9, 0x5FEC, 0x5FEF, 0x5FF0, 0x5FF2, 0x5FF3, 0x5FF4, 0x5FF6, 0x5FF7, 0x5FF9,
+    0x5FFA, 0x5FFC, 0x6007, 0x6008, 0x6009, 0x600B, 0x600C, 0x6010, 0x6011, 0x6013,
+    0x6017, 0x6018, 0x601A, 0x601E, 0x601F, 0x6022, 0x6023, 0x6024, 0x602C, 0x602D,
+    0x602E, 0x603D, 0x603E, 0x6040, 0x604C, 0x604E, 0x604F, 0x6051, 0x6053, 0x6054,
+    0x6056, 0x6057, 0x6058, 0x605B, 0x605C, 0x6065, 0x6066, 0x606E, 0x6071, 0x6072,
+    0x6074, 0x6075, 0x6077, 0x607E, 0x6080, 0x6081, 0x6082, 0x608A, 0x608B, 0x6093,
+    0x6095, 0x6097, 0x6098, 0x6099, 0x609C, 0x609E, 0x60A1, 0x60A2, 0x60A4, 0x60A5,
+    0x60A7, 0x60A9, 0x60AA, 0x60AE, 0x60B0, 0x60B3, 0x60B5, 0x60B6, 0x60B7, 0x60B9,
+    0x60BA, 0x60C7, 0x60C8, 0x60C9, 0x60D2, 0x60D3, 0x60D4, 0x60D6, 0x60D7, 0x60D9,
+    0x60DB, 0x60DE, 0x60EA, 0x60F1, 0x60F2, 0x60F5, 0x60F7, 0x60F8, 0x6107, 0x610A,
+    0x610B, 0x610C, 0x6121, 0x6122, 0x6125, 0x6128, 0x6129, 0x612A, 0x6147, 0x6149,
+    0x614B, 0x614D, 0x614F, 0x6150, 0x6152, 0x6153, 0x6154, 0x6176, 0x618C, 0x618D,
+    0x6195, 0x61AA, 0x61AB, 0x61BF, 0x61C0, 0x61C1, 0x61C9, 0x61D3, 0x6207, 0x6209,
+    0x6213, 0x6214, 0x6219, 0x621C, 0x621D, 0x621E, 0x6220, 0x6223, 0x622B, 0x622D,
+    0x6235, 0x6236, 0x6242, 0x6244, 0x6245, 0x6246, 0x624A, 0x624F, 0x6250, 0x6255,
+    0x6256, 0x6257, 0x6259, 0x625A, 0x6264, 0x6265, 0x6268, 0x6271, 0x6272, 0x6274,
+    0x6275, 0x6277, 0x6278, 0x627A, 0x627B, 0x627D, 0x6281, 0x6282, 0x6283, 0x6294,
+    0x6299, 0x629C, 0x629D, 0x629E, 0x62A3, 0x62A6, 0x62A7, 0x62A9, 0x62AA, 0x62B2,
+    0x62B3, 0x62B4, 0x62B6, 0x62B7, 0x62B8, 0x62BA, 0x62BE, 0x62C0, 0x62C1, 0x62C3,
+    0x62CB, 0x62CF, 0x62D1, 0x62D5, 0x62DD, 0x62DE, 0x62E0, 0x62E1, 0x62E4, 0x62EA,
+    0x62EB, 0x62F0, 0x62F2, 0x62F5, 0x6300, 0x630F, 0x6310, 0x6317, 0x6318, 0x6319,
+    0x631C, 0x6326, 0x6327, 0x6329, 0x632C, 0x632D, 0x632E, 0x6330, 0x6331, 0x633B,
+    0x633C, 0x6344, 0x6347, 0x6348, 0x634A, 0x6360, 0x6364, 0x6365, 0x6366, 0x6368,
+    0x636A, 0x636B, 0x636C, 0x636F, 0x6370, 0x6378, 0x6379, 0x6381, 0x638B, 0x638D,
+    0x6391, 0x6393, 0x6394, 0x6395, 0x6397, 0x63A1, 0x63A4, 0x63A6, 0x63AB, 0x63AF,
+    0x63B1, 0x63B2, 0x63B5, 0x63B6, 0x63B9, 0x63BB, 0x63BD, 0x63BF, 0x63C0, 0x63C1,
+    0x63C2, 0x63C3, 0x63C5, 0x63C7, 0x63C8, 0x63CA, 0x63CB, 0x63CC, 0x63D1, 0x63D3,
+    0x63D4, 0x63D5, 0x63DF, 0x63E2, 0x63EB, 0x63EC, 0x63F3, 0x63F5, 0x63F7, 0x63FE,
+    0x6403, 0x6404, 0x640D, 0x640E, 0x6411, 0x6412, 0x641D, 0x641F, 0x6422, 0x6423,
+    0x6424, 0x6425, 0x6427, 0x6428, 0x6429, 0x642B, 0x643B, 0x643C, 0x643E, 0x6440,
+    0x6442, 0x6443, 0x6449, 0x6453, 0x6455, 0x6456, 0x6457, 0x6468, 0x646A, 0x646B,
+    0x646C, 0x6483, 0x6486, 0x6493, 0x6494, 0x6497, 0x6498, 0x64AA, 0x64AB, 0x64AF,
+    0x64B6, 0x64B9, 0x64BB, 0x64BD, 0x64BE, 0x64BF, 0x64C1, 0x64C3, 0x64C4, 0x64CF,
+    0x64D1, 0x64D9, 0x64DA, 0x64DB, 0x64DC, 0x64DD, 0x64DF, 0x64E0, 0x64E1, 0x64E3,
+    0x64E5, 0x6522, 0x6523, 0x6524, 0x652C, 0x652D, 0x6537, 0x653A, 0x653C, 0x653D,
+    0x6546, 0x6547, 0x654A, 0x654B, 0x654D, 0x654E, 0x6550, 0x6552, 0x6553, 0x6554,
+    0x6557, 0x6558, 0x655A, 0x655C, 0x655F, 0x6560, 0x6561, 0x6564, 0x6565, 0x656D,
+    0x656E, 0x656F, 0x6571, 0x6573, 0x6575, 0x6576, 0x6588, 0x6589, 0x658A, 0x658D,
+    0x658E, 0x658F, 0x6592, 0x6594, 0x6595, 0x6596, 0x6598, 0x659A, 0x659D, 0x659E,
+    0x65A0, 0x65A2, 0x65A3, 0x65A6, 0x65A8, 0x65AA, 0x65AC, 0x65AE, 0x65BA, 0x65BB,
+    0x65BE, 0x65BF, 0x65C0, 0x65C2, 0x65CD, 0x65D0, 0x65D1, 0x65D3, 0x65D4, 0x65D5,
+    0x65E1, 0x65E3, 0x65E4, 0x65EA, 0x65EB, 0x65F8, 0x65F9, 0x6601, 0x6604, 0x6605,
+    0x6607, 0x6608, 0x6609, 0x660B, 0x660D, 0x6610, 0x6611, 0x6612, 0x6616, 0x6617,
+    0x6618, 0x661A, 0x661B, 0x661C, 0x661E, 0x6626, 0x662E, 0x6630, 0x6632, 0x6633,
+    0x663D, 0x663F, 0x6640, 0x6642, 0x664D, 0x664E, 0x6650, 0x6651, 0x6658, 0x6659,
+    0x6660, 0x6662, 0x6663, 0x6665, 0x6667, 0x6671, 0x6672, 0x6673, 0x6675, 0x6678,
+    0x6679, 0x667B, 0x667C, 0x667D, 0x667F, 0x6680, 0x6681, 0x6683, 0x6685, 0x6686,
+    0x66DA, 0x66E7, 0x66E8, 0x66F1, 0x66F5, 0x66F6, 0x66F8, 0x66FA, 0x66FB, 0x66FD,
+    0x6701, 0x6702, 0x6703, 0x670C, 0x670E, 0x670F, 0x6711, 0x6712, 0x6713, 0x6716,
+    0x6718, 0x6719, 0x671A, 0x671C, 0x671E, 0x6727, 0x6729, 0x672E, 0x6730, 0x6732,
+    0x6733, 0x673B, 0x673C, 0x673E, 0x673F, 0x6741, 0x6744, 0x6745, 0x6747, 0x674A,
+    0x674B, 0x674D, 0x6752, 0x6754, 0x6755, 0x675D, 0x6762, 0x6763, 0x6764, 0x6766,
+    0x6767, 0x676B, 0x676C, 0x676E, 0x6771, 0x6774, 0x6776, 0x677D, 0x6780, 0x6782,
+    0x6783, 0x6785, 0x6786, 0x6788, 0x678A, 0x6796, 0x6799, 0x679B, 0x679F, 0x67A0,
+    0x67A1, 0x67A4, 0x67A6, 0x67A9, 0x67AC, 0x67AE, 0x67B1, 0x67B2, 0x67B4, 0x67C2,
+    0x67D5, 0x67D6, 0x67D7, 0x67DB, 0x67DF, 0x67E1, 0x67E3, 0x67E4, 0x67E6, 0x67E7,
+    0x67E8, 0x67EA, 0x67EB, 0x67ED, 0x67EE, 0x67F2, 0x67FE, 0x6806, 0x680D, 0x6810,
+    0x6812, 0x6814, 0x6815, 0x681E, 0x681F, 0x6820, 0x6834, 0x6835, 0x6836, 0x683A,
+    0x683B, 0x683F, 0x6847, 0x684B, 0x684D, 0x684F, 0x6852, 0x686A, 0x6875, 0x6882,
+    0x6884, 0x6890, 0x6891, 0x6892, 0x6894, 0x6895, 0x6896, 0x68A3, 0x68A4, 0x68A5,
+    0x68AE, 0x68B1, 0x68B2, 0x68B4, 0x68B6, 0x68B7, 0x68B8, 0x68C1, 0x68CA, 0x68CC,
+    0x68D3, 0x68D4, 0x68D6, 0x68D7, 0x68D9, 0x68E1, 0x68E2, 0x68EF, 0x68F2, 0x68F3,
+    0x68F4, 0x68F6, 0x68F7, 0x68F8, 0x68FB, 0x6902, 0x6903, 0x6904, 0x690C, 0x690F,
+    0x6911, 0x6921, 0x6922, 0x6923, 0x692E, 0x692F, 0x6931, 0x6932, 0x6933, 0x693A,
+    0x693B, 0x693C, 0x693E, 0x6940, 0x6941, 0x6955, 0x6956, 0x6958, 0x6959, 0x695B,
+    0x695C, 0x695F, 0x6961, 0x6962, 0x6964, 0x6965, 0x696C, 0x696D, 0x696F, 0x6970,
+    0x697A, 0x697B, 0x697D, 0x697E, 0x697F, 0x6981, 0x6983, 0x6985, 0x698A, 0x698B,
+    0x698C, 0x6996, 0x6997, 0x6999, 0x699A, 0x69A9, 0x69AA, 0x69AC, 0x69AE, 0x69AF,
+    0x69B0, 0x69B2, 0x69B3, 0x69B5, 0x69B6, 0x69B8, 0x69B9, 0x69BA, 0x69BC, 0x69BD,
+    0x69BE, 0x69BF, 0x69C0, 0x69CB, 0x69CD, 0x69CF, 0x69D1, 0x69D2, 0x69D3, 0x69DC,
+    0x69DD, 0x69DE, 0x69FE, 0x6A20, 0x6A29, 0x6A30, 0x6A32, 0x6A33, 0x6A34, 0x6A45,
+    0x6A46, 0x6A5A, 0x6A62, 0x6A63, 0x6A64, 0x6A7A, 0x6A7B, 0x6A7D, 0x6A7E, 0x6A7F,
+    0x6A81, 0x6A82, 0x6A83, 0x6A8F, 0x6AA7, 0x6AA8, 0x6AAA, 0x6B25, 0x6B26, 0x6B2F,
+    0x6B30, 0x6B31, 0x6B38, 0x6B3B, 0x6B3C, 0x6B3D, 0x6B44, 0x6B45, 0x6B48, 0x6B4A,
+    0x6B4B, 0x6B68, 0x6B69, 0x6B7A, 0x6B85, 0x6B88, 0x6B8C, 0x6B94, 0x6B95, 0x6B97,
+    0x6B98, 0x6B99, 0x6BB6, 0x6BC0, 0x6BC3, 0x6BC4, 0x6BCC, 0x6BCE, 0x6BD0, 0x6BD1,
+    0x6BD8, 0x6BDA, 0x6BEC, 0x6BED, 0x6BEE, 0x6BF0, 0x6BF1, 0x6BF2, 0x6BF4, 0x6BF6,
+    0x6BF7, 0x6BF8, 0x6BFA, 0x6BFB, 0x6BFC, 0x6C0E, 0x6C12, 0x6C17, 0x6C1C, 0x6C1D,
+    0x6C1E, 0x6C20, 0x6C23, 0x6C25, 0x6C2B, 0x6C2C, 0x6C2D, 0x6C31, 0x6C33, 0x6C36,
+    0x6C37, 0x6C3E, 0x6C3F, 0x6C43, 0x6C44, 0x6C45, 0x6C48, 0x6C51, 0x6C52, 0x6C53,
+    0x6C56, 0x6C58, 0x6C59, 0x6C5A, 0x6C62, 0x6C63, 0x6C65, 0x6C66, 0x6C67, 0x6C71,
+    0x6C73, 0x6C75, 0x6C77, 0x6C78, 0x6C7A, 0x6C7B, 0x6C7C, 0x6C7F, 0x6C80, 0x6C84,
+    0x6C87, 0x6C8A, 0x6C8B, 0x6C8D, 0x6C8E, 0x6C91, 0x6C92, 0x6C9A, 0x6C9C, 0x6C9D,
+    0x6C9E, 0x6CA0, 0x6CA2, 0x6CA8, 0x6CAC, 0x6CAF, 0x6CB0, 0x6CBA, 0x6CC6, 0x6CC7,
+    0x6CC8, 0x6CCB, 0x6CCD, 0x6CCE, 0x6CCF, 0x6CD1, 0x6CD2, 0x6CD8, 0x6CD9, 0x6CDA,
+    0x6CDC, 0x6CDD, 0x6CDF, 0x6CE4, 0x6CE6, 0x6CE7, 0x6CE9, 0x6CEC, 0x6CED, 0x6CF2,
+    0x6CF4, 0x6CF9, 0x6CFF, 0x6D00, 0x6D02, 0x6D03, 0x6D05, 0x6D06, 0x6D08, 0x6D09,
+    0x6D0A, 0x6D0D, 0x6D0F, 0x6D10, 0x6D11, 0x6D18, 0x6D1C, 0x6D1D, 0x6D26, 0x6D28,
+    0x6D29, 0x6D2C, 0x6D2D, 0x6D2F, 0x6D30, 0x6D34, 0x6D36, 0x6D37, 0x6D38, 0x6D3A,
+    0x6D3F, 0x6D40, 0x6D42, 0x6D44, 0x6D49, 0x6D4C, 0x6D50, 0x6D5B, 0x6D5D, 0x6D5F,
+    0x6D61, 0x6D62, 0x6D64, 0x6D65, 0x6D67, 0x6D68, 0x6D6B, 0x6D6C, 0x6D6D, 0x6D75,
+    0x6D76, 0x6D79, 0x6D7A, 0x6D7B, 0x6D83, 0x6D84, 0x6D86, 0x6D87, 0x6D8A, 0x6D8B,
+    0x6D8D, 0x6D8F, 0x6D90, 0x6D92, 0x6D9C, 0x6DA2, 0x6DA5, 0x6DAC, 0x6DAD, 0x6DB0,
+    0x6DB1, 0x6DB3, 0x6DB4, 0x6DB6, 0x6DB7, 0x6DC1, 0x6DC2, 0x6DC3, 0x6DC8, 0x6DC9,
+    0x6DCA, 0x6DD7, 0x6DDA, 0x6DDB, 0x6DDC, 0x6DDF, 0x6DE2, 0x6DE3, 0x6DE5, 0x6DED,
+    0x6DEF, 0x6DF0, 0x6DF2, 0x6DF4, 0x6DF5, 0x6DF6, 0x6DF8, 0x6DFA, 0x6E0B, 0x6E0F,
+    0x6E12, 0x6E13, 0x6E15, 0x6E18, 0x6E19, 0x6E1B, 0x6E1C, 0x6E1E, 0x6E1F, 0x6E22,
+    0x6E26, 0x6E27, 0x6E28, 0x6E2A, 0x6E2C, 0x6E2E, 0x6E30, 0x6E31, 0x6E33, 0x6E35,
+    0x6E36, 0x6E37, 0x6E39, 0x6E55, 0x6E57, 0x6E59, 0x6E5A, 0x6E5C, 0x6E5D, 0x6E5E,
+    0x6E6C, 0x6E6D, 0x6E80, 0x6E81, 0x6E82, 0x6E84, 0x6E87, 0x6E88, 0x6E99, 0x6E9A,
+    0x6E9B, 0x6E9D, 0x6E9E, 0x6EA0, 0x6EA1, 0x6EA3, 0x6EA4, 0x6EA6, 0x6EA8, 0x6EA9,
+    0x6EB0, 0x6EB3, 0x6EB5, 0x6EB8, 0x6EB9, 0x6EBC, 0x6EBE, 0x6EBF, 0x6EC0, 0x6EC8,
+    0x6EC9, 0x6ECA, 0x6ECC, 0x6ECD, 0x6ECE, 0x6ED0, 0x6ED2, 0x6ED6, 0x6ED8, 0x6ED9,
+    0x6EDB, 0x6EDC, 0x6EDD, 0x6EE3, 0x6EE7, 0x6F03, 0x6F04, 0x6F05, 0x6F07, 0x6F08,
+    0x6F10, 0x6F11, 0x6F12, 0x6F21, 0x6F22, 0x6F23, 0x6F2C, 0x6F2E, 0x6F30, 0x6F32,
+    0x6F34, 0x6F35, 0x6F43, 0x6F44, 0x6F45, 0x6F48, 0x6F49, 0x6F4A, 0x6F4C, 0x6F59,
+    0x6F5A, 0x6F5B, 0x6F5D, 0x6F5F, 0x6F60, 0x6F61, 0x6F63, 0x6F64, 0x6F65, 0x6F6F,
+    0x6F70, 0x6F71, 0x6F73, 0x6F75, 0x6F76, 0x6F77, 0x6F79, 0x6F7B, 0x6F85, 0x6F86,
+    0x6F87, 0x6F8A, 0x6F8B, 0x6FB4, 0x6FB5, 0x6FB7, 0x6FB8, 0x6FC1, 0x6FDF, 0x7036,
+    0x7037, 0x7038, 0x704D, 0x704E, 0x706E, 0x7077, 0x7079, 0x707A, 0x707B, 0x707D,
+    0x7086, 0x7087, 0x7088, 0x708B, 0x708C, 0x708D, 0x708F, 0x7090, 0x7091, 0x7093,
+    0x7097, 0x7098, 0x709A, 0x709B, 0x70B0, 0x70B2, 0x70B4, 0x70B5, 0x70B6, 0x70BA,
+    0x70BE, 0x70BF, 0x70C9, 0x70DA, 0x70DC, 0x70DD, 0x70DE, 0x70E5, 0x70EA, 0x70EE,
+    0x70F8, 0x70FA, 0x70FB, 0x70FC, 0x7111, 0x7112, 0x7114, 0x7117, 0x7132, 0x7133,
+    0x7134, 0x7135, 0x714B, 0x714D, 0x715D, 0x7165, 0x716F, 0x7170, 0x7171, 0x7179,
+    0x717B, 0x717C, 0x7195, 0x7196, 0x7197, 0x71A9, 0x71AA, 0x71AB, 0x71B4, 0x71B6,
+    0x71B7, 0x71B8, 0x71E6, 0x721B, 0x721C, 0x7229, 0x722B, 0x722D, 0x722E, 0x722F,
+    0x7232, 0x7233, 0x7234, 0x723A, 0x723C, 0x723E, 0x7249, 0x724A, 0x724B, 0x7253,
+    0x7254, 0x7255, 0x7257, 0x7258, 0x725A, 0x725C, 0x725E, 0x7260, 0x7263, 0x7264,
+    0x7265, 0x7268, 0x7270, 0x7271, 0x7273, 0x7274, 0x7276, 0x7277, 0x7278, 0x727B,
+    0x727C, 0x727D, 0x7282, 0x7283, 0x728C, 0x728E, 0x7290, 0x7291, 0x72AE, 0x72B1,
+    0x72B2, 0x72B3, 0x72B5, 0x72C5, 0x72C6, 0x72C7, 0x72CF, 0x72D1, 0x72D8, 0x72DA,
+    0x72DB, 0x3000, 0x3001, 0x3002, 0x00B7, 0x02C9, 0x02C7, 0x00A8, 0x3003, 0x3005,
+    0x2014, 0xFF5E, 0x2016, 0x2026, 0x2018, 0x2019, 0x201C, 0x201D, 0x3014, 0x3015,
+    0x3016, 0x3017, 0x3010, 0x3011, 0x00B1, 0x00D7, 0x00F7, 0x2236, 0x2227, 0x2228,
+    0x2211, 0x220F, 0x222A, 0x2229, 0x2208, 0x2237, 0x221A, 0x22A5, 0x2225, 0x2220,
+    0x2312, 0x2299, 0x222B, 0x222E, 0x2261, 0x224C, 0x2248, 0x223D, 0x221D, 0x2260,
+    0x226E, 0x226F, 0x2264, 0x2265, 0x221E, 0x2235, 0x2234, 0x2642, 0x2640, 0x00B0,
+    0x2032, 0x2033, 0x2103, 0xFF04, 0x00A4, 0xFFE0, 0xFFE1, 0x2030, 0x00A7, 0x2116,
+    0x2606, 0x2605, 0x25CB, 0x25CF, 0x25CE, 0x25C7, 0x25C6, 0x25A1, 0x25A0, 0x25B3,
+    0x25B2, 0x203B, 0x2192, 0x2190, 0x2191, 0x2193, 0x3013, 0x20AC, 0xE76D, 0xE76E,
+    0xE76F, 0xE770, 0xE771, 0xFF01, 0xFF02, 0xFF03, 0xFFE5, 0xFFE3, 0xFE35, 0xFE36,
+    0xFE39, 0xFE3A, 0xFE3F, 0xFE40, 0xFE3D, 0xFE3E, 0xE794, 0xE795, 0xFE3B, 0xFE3C,
+    0xFE37, 0xFE38, 0xFE31, 0xE796, 0xFE33, 0xFE34, 0x0401, 0x0451, 0x02CA, 0x02CB,
+    0x02D9, 0x2013, 0x2015, 0x2025, 0x2035, 0x2105, 0x2109, 0x2215, 0x221F, 0x2223,
+    0x2252, 0x2266, 0x2267, 0x22BF, 0x2593, 0x2594, 0x2595, 0x25BC, 0x25BD, 0x2609,
+    0x2295, 0x3012, 0x301D, 0x301E, 0x0101, 0x00E1, 0x01CE, 0x00E0, 0x0113, 0x00E9,
+    0x011B, 0x00E8, 0x012B, 0x00ED, 0x01D0, 0x00EC, 0x014D, 0x00F3, 0x01D2, 0x00F2,
+    0x016B, 0x00FA, 0x01D4, 0x00F9, 0x01D6, 0x01D8, 0x01DA, 0x01DC, 0x00FC, 0x00EA,
+    0x0251, 0xE7C7, 0x0144, 0x0148, 0x01F9, 0x0261, 0x32A3, 0x338E, 0x338F, 0x339C,
+    0x339D, 0x339E, 0x33A1, 0x33C4, 0x33CE, 0x33D1, 0x33D2, 0x33D5, 0xFE30, 0xFFE2,
+    0xFFE4, 0xE7E2, 0x2121, 0x3231, 0xE7E3, 0x2010, 0xE7E4, 0xE7E5, 0xE7E6, 0x30FC,
+    0x309B, 0x309C, 0x30FD, 0x30FE, 0x3006, 0x309D, 0x309E, 0x303E, 0x3007, 0x72DC,
+    0x72DD, 0x72DF, 0x72EA, 0x72EB, 0x72F5, 0x72F6, 0x72F9, 0x7302, 0x730B, 0x730C,
+    0x730D, 0x7314, 0x7318, 0x7319, 0x731A, 0x731F, 0x7320, 0x7323, 0x7324, 0x7326,
+    0x7327, 0x7328, 0x732D, 0x732F, 0x7330, 0x7332, 0x7333, 0x7335, 0x7336, 0x734E,
+    0x734F, 0x7351, 0x736E, 0x7370, 0x7371, 0x7385, 0x7386, 0x7388, 0x738A, 0x738C,
+    0x738D, 0x738F, 0x7390, 0x739C, 0x739D, 0x739E, 0x73A0, 0x73A1, 0x73AA, 0x73AC,
+    0x73AD, 0x73B1, 0x73B4, 0x73B5, 0x73B6, 0x73B8, 0x73B9, 0x73C1, 0x73CB, 0x73CC,
+    0x73CE, 0x73DF, 0x73E6, 0x73E8, 0x73EA, 0x73EB, 0x73EC, 0x7404, 0x7407, 0x7408,
+    0x7423, 0x7424, 0x7427, 0x7429, 0x742B, 0x742D, 0x742F, 0x7431, 0x7432, 0x7456,
+    0x7458, 0x745D, 0x746E, 0x746F, 0x7478, 0x7479, 0x747A, 0x747B, 0x747C, 0x747D,
+    0x747F, 0x7482, 0x7484, 0x7485, 0x7486, 0x7488, 0x7489, 0x748A, 0x748C, 0x748D,
+    0x748F, 0x749D, 0x74DD, 0x74DF, 0x74E1, 0x74E5, 0x74F0, 0x74F1, 0x74F2, 0x74F3,
+    0x74F5, 0x750E, 0x7510, 0x7512, 0x751B, 0x751D, 0x751E, 0x7526, 0x7527, 0x752A,
+    0x752E, 0x7534, 0x7536, 0x7539, 0x753C, 0x753D, 0x753F, 0x7546, 0x7547, 0x7549,
+    0x754A, 0x754D, 0x7567, 0x7568, 0x7569, 0x7573, 0x7575, 0x7576, 0x7577, 0x7580,
+    0x7581, 0x7582, 0x7584, 0x7585, 0x7587, 0x7588, 0x7589, 0x758A, 0x758C, 0x758D,
+    0x758E, 0x7590, 0x7593, 0x7595, 0x7598, 0x759B, 0x759C, 0x759E, 0x75A2, 0x75AD,
+    0x75B6, 0x75B7, 0x75BA, 0x75BB, 0x75BF, 0x75C0, 0x75C1, 0x75C6, 0x75CB, 0x75CC,
+    0x75D3, 0x75D7, 0x75D9, 0x75DA, 0x75DC, 0x75DD, 0x75DF, 0x75E0, 0x75E1, 0x75E5,
+    0x75E9, 0x75F2, 0x75F3, 0x75FA, 0x75FB, 0x75FD, 0x75FE, 0x7602, 0x7604, 0x7606,
+    0x7607, 0x7608, 0x7609, 0x760B, 0x760D, 0x760E, 0x760F, 0x7616, 0x761A, 0x761C,
+    0x761D, 0x761E, 0x7621, 0x7623, 0x7627, 0x7628, 0x762C, 0x762E, 0x762F, 0x7631,
+    0x7632, 0x7636, 0x7637, 0x7639, 0x763A, 0x763B, 0x763D, 0x7641, 0x7642, 0x7644,
+    0x7655, 0x765D, 0x766C, 0x766D, 0x766E, 0x7679, 0x767A, 0x767C, 0x767F, 0x7680,
+    0x7681, 0x7683, 0x7685, 0x7689, 0x768A, 0x768C, 0x768D, 0x768F, 0x7690, 0x7692,
+    0x7694, 0x7695, 0x7697, 0x7698, 0x769A, 0x769B, 0x76AF, 0x76B0, 0x76B3, 0x76C0,
+    0x76C1, 0x76C3, 0x554A, 0x963F, 0x57C3, 0x6328, 0x54CE, 0x5509, 0x54C0, 0x7691,
+    0x764C, 0x853C, 0x77EE, 0x827E, 0x788D, 0x7231, 0x9698, 0x978D, 0x6C28, 0x5B89,
+    0x4FFA, 0x6309, 0x6697, 0x5CB8, 0x80FA, 0x6848, 0x80AE, 0x6602, 0x76CE, 0x51F9,
+    0x6556, 0x71AC, 0x7FF1, 0x8884, 0x50B2, 0x5965, 0x61CA, 0x6FB3, 0x82AD, 0x634C,
+    0x6252, 0x53ED, 0x5427, 0x7B06, 0x516B, 0x75A4, 0x5DF4, 0x62D4, 0x8DCB, 0x9776,
+    0x628A, 0x8019, 0x575D, 0x9738, 0x7F62, 0x7238, 0x767D, 0x67CF, 0x767E, 0x6446,
+    0x4F70, 0x8D25, 0x62DC, 0x7A17, 0x6591, 0x73ED, 0x642C, 0x6273, 0x822C, 0x9881,
+    0x677F, 0x7248, 0x626E, 0x62CC, 0x4F34, 0x74E3, 0x534A, 0x529E, 0x7ECA, 0x90A6,
+    0x5E2E, 0x6886, 0x699C, 0x8180, 0x7ED1, 0x68D2, 0x78C5, 0x868C, 0x9551, 0x508D,
+    0x8C24, 0x82DE, 0x80DE, 0x5305, 0x8912, 0x5265, 0x76C4, 0x76C7, 0x76C9, 0x76CB,
+    0x76CC, 0x76D3, 0x76D5, 0x76D9, 0x76DA, 0x76DC, 0x76DD, 0x76DE, 0x76F0, 0x76F3,
+    0x76F5, 0x76F6, 0x76F7, 0x76FA, 0x76FB, 0x76FD, 0x76FF, 0x7700, 0x7702, 0x7703,
+    0x7705, 0x7706, 0x770A, 0x770C, 0x7721, 0x7723, 0x7724, 0x7725, 0x7727, 0x772A,
+    0x772B, 0x772C, 0x772E, 0x7739, 0x773B, 0x773D, 0x773E, 0x773F, 0x7742, 0x7744,
+    0x7745, 0x7746, 0x775C, 0x8584, 0x96F9, 0x4FDD, 0x5821, 0x9971, 0x5B9D, 0x62B1,
+    0x62A5, 0x66B4, 0x8C79, 0x9C8D, 0x7206, 0x676F, 0x7891, 0x60B2, 0x5351, 0x5317,
+    0x8F88, 0x80CC, 0x8D1D, 0x94A1, 0x500D, 0x72C8, 0x5907, 0x60EB, 0x7119, 0x88AB,
+    0x5954, 0x82EF, 0x672C, 0x7B28, 0x5D29, 0x7EF7, 0x752D, 0x6CF5, 0x8E66, 0x8FF8,
+    0x903C, 0x9F3B, 0x6BD4, 0x9119, 0x7B14, 0x5F7C, 0x78A7, 0x84D6, 0x853D, 0x6BD5,
+    0x6BD9, 0x6BD6, 0x5E01, 0x5E87, 0x75F9, 0x95ED, 0x655D, 0x5F0A, 0x5FC5, 0x8F9F,
+    0x58C1, 0x81C2, 0x907F, 0x965B, 0x97AD, 0x8FB9, 0x7F16, 0x8D2C, 0x6241, 0x4FBF,
+    0x53D8, 0x535E, 0x8FA8, 0x8FA9, 0x8FAB, 0x904D, 0x6807, 0x5F6A, 0x8198, 0x8868,
+    0x9CD6, 0x618B, 0x522B, 0x762A, 0x5F6C, 0x658C, 0x6FD2, 0x6EE8, 0x5BBE, 0x6448,
+    0x5175, 0x51B0, 0x67C4, 0x4E19, 0x79C9, 0x997C, 0x70B3, 0x7764, 0x7767, 0x7769,
+    0x776A, 0x777A, 0x777B, 0x777C, 0x7781, 0x7782, 0x7783, 0x778F, 0x7790, 0x77A1,
+    0x77A3, 0x77A4, 0x77A6, 0x77A8, 0x77AB, 0x77AD, 0x77AE, 0x77AF, 0x77B1, 0x77B2,
+    0x77B4, 0x77BC, 0x77BE, 0x77D8, 0x77D9, 0x77DA, 0x77E4, 0x75C5, 0x5E76, 0x73BB,
+    0x83E0, 0x64AD, 0x62E8, 0x94B5, 0x6CE2, 0x535A, 0x52C3, 0x640F, 0x94C2, 0x7B94,
+    0x4F2F, 0x5E1B, 0x8236, 0x8116, 0x818A, 0x6E24, 0x6CCA, 0x9A73, 0x6355, 0x535C,
+    0x54FA, 0x8865, 0x57E0, 0x4E0D, 0x5E03, 0x6B65, 0x7C3F, 0x90E8, 0x6016, 0x64E6,
+    0x731C, 0x88C1, 0x6750, 0x624D, 0x8D22, 0x776C, 0x8E29, 0x91C7, 0x5F69, 0x83DC,
+    0x8521, 0x9910, 0x53C2, 0x8695, 0x6B8B, 0x60ED, 0x60E8, 0x707F, 0x82CD, 0x8231,
+    0x4ED3, 0x6CA7, 0x85CF, 0x64CD, 0x7CD9, 0x69FD, 0x66F9, 0x8349, 0x5395, 0x7B56,
+    0x4FA7, 0x518C, 0x6D4B, 0x5C42, 0x8E6D, 0x63D2, 0x53C9, 0x832C, 0x8336, 0x67E5,
+    0x78B4, 0x643D, 0x5BDF, 0x5C94, 0x5DEE, 0x8BE7, 0x62C6, 0x67F4, 0x8C7A, 0x6400,
+    0x63BA, 0x8749, 0x998B, 0x8C17, 0x7F20, 0x94F2, 0x4EA7, 0x9610, 0x98A4, 0x660C,
+    0x7316, 0x77E6, 0x77E8, 0x77EA, 0x77F4, 0x77F5, 0x77F7, 0x780A, 0x780B, 0x780E,
+    0x780F, 0x7810, 0x7813, 0x7815, 0x7819, 0x781B, 0x781E, 0x7820, 0x7821, 0x7822,
+    0x7824, 0x7828, 0x782A, 0x782B, 0x782E, 0x782F, 0x7831, 0x7832, 0x7833, 0x7835,
+    0x7836, 0x783D, 0x783F, 0x7846, 0x784D, 0x784F, 0x7851, 0x7853, 0x7854, 0x7858,
+    0x7859, 0x785A, 0x785B, 0x785C, 0x573A, 0x5C1D, 0x5E38, 0x957F, 0x507F, 0x80A0,
+    0x5382, 0x655E, 0x7545, 0x5531, 0x5021, 0x8D85, 0x6284, 0x949E, 0x671D, 0x5632,
+    0x6F6E, 0x5DE2, 0x5435, 0x7092, 0x8F66, 0x626F, 0x64A4, 0x63A3, 0x5F7B, 0x6F88,
+    0x90F4, 0x81E3, 0x8FB0, 0x5C18, 0x6668, 0x5FF1, 0x6C89, 0x9648, 0x8D81, 0x886C,
+    0x6491, 0x79F0, 0x57CE, 0x6A59, 0x6210, 0x5448, 0x4E58, 0x7A0B, 0x60E9, 0x6F84,
+    0x8BDA, 0x627F, 0x901E, 0x9A8B, 0x79E4, 0x5403, 0x75F4, 0x6301, 0x5319, 0x6C60,
+    0x8FDF, 0x5F1B, 0x9A70, 0x803B, 0x9F7F, 0x4F88, 0x5C3A, 0x8D64, 0x7FC5, 0x65A5,
+    0x70BD, 0x5145, 0x51B2, 0x866B, 0x5D07, 0x5BA0, 0x62BD, 0x916C, 0x7574, 0x8E0C,
+    0x7A20, 0x6101, 0x7B79, 0x4EC7, 0x7EF8, 0x7785, 0x4E11, 0x81ED, 0x521D, 0x51FA,
+    0x6A71, 0x53A8, 0x8E87, 0x9504, 0x96CF, 0x6EC1, 0x9664, 0x695A, 0x7884, 0x7885,
+    0x7886, 0x7888, 0x788A, 0x788B, 0x788F, 0x7890, 0x7892, 0x7894, 0x7895, 0x7896,
+    0x7899, 0x789D, 0x789E, 0x78A0, 0x78A2, 0x78A4, 0x78A6, 0x78BF, 0x78C0, 0x78C2,
+    0x78C3, 0x78C4, 0x78C6, 0x78C7, 0x78C8, 0x78D1, 0x78D2, 0x78D3, 0x78D6, 0x78D7,
+    0x78D8, 0x78E9, 0x78EA, 0x78EB, 0x78F3, 0x78F5, 0x78F6, 0x78F8, 0x78F9, 0x7902,
+    0x7903, 0x7904, 0x7840, 0x50A8, 0x77D7, 0x6410, 0x89E6, 0x5904, 0x63E3, 0x5DDD,
+    0x7A7F, 0x693D, 0x4F20, 0x8239, 0x5598, 0x4E32, 0x75AE, 0x7A97, 0x5E62, 0x5E8A,
+    0x95EF, 0x521B, 0x5439, 0x708A, 0x6376, 0x9524, 0x5782, 0x6625, 0x693F, 0x9187,
+    0x5507, 0x6DF3, 0x7EAF, 0x8822, 0x6233, 0x7EF0, 0x75B5, 0x8328, 0x78C1, 0x96CC,
+    0x8F9E, 0x6148, 0x74F7, 0x8BCD, 0x6B64, 0x523A, 0x8D50, 0x6B21, 0x806A, 0x8471,
+    0x56F1, 0x5306, 0x4ECE, 0x4E1B, 0x51D1, 0x7C97, 0x918B, 0x7C07, 0x4FC3, 0x8E7F,
+    0x7BE1, 0x7A9C, 0x6467, 0x5D14, 0x50AC, 0x8106, 0x7601, 0x7CB9, 0x6DEC, 0x7FE0,
+    0x6751, 0x5B58, 0x5BF8, 0x78CB, 0x64AE, 0x6413, 0x63AA, 0x632B, 0x9519, 0x642D,
+    0x8FBE, 0x7B54, 0x7629, 0x6253, 0x5927, 0x5446, 0x6B79, 0x50A3, 0x6234, 0x5E26,
+    0x6B86, 0x4EE3, 0x8D37, 0x888B, 0x5F85, 0x902E, 0x793D, 0x793F, 0x7947, 0x7954,
+    0x7955, 0x7958, 0x7959, 0x7961, 0x7963, 0x7964, 0x7966, 0x796E, 0x7979, 0x7982,
+    0x7983, 0x7990, 0x7991, 0x7992, 0x6020, 0x803D, 0x62C5, 0x4E39, 0x5355, 0x90F8,
+    0x63B8, 0x80C6, 0x65E6, 0x6C2E, 0x4F46, 0x60EE, 0x6DE1, 0x8BDE, 0x5F39, 0x86CB,
+    0x5F53, 0x6321, 0x515A, 0x8361, 0x6863, 0x5200, 0x6363, 0x8E48, 0x5012, 0x5C9B,
+    0x7977, 0x5BFC, 0x5230, 0x7A3B, 0x60BC, 0x9053, 0x76D7, 0x5FB7, 0x5F97, 0x7684,
+    0x8E6C, 0x706F, 0x767B, 0x7B49, 0x77AA, 0x51F3, 0x9093, 0x5824, 0x4F4E, 0x6EF4,
+    0x8FEA, 0x654C, 0x7B1B, 0x72C4, 0x6DA4, 0x7FDF, 0x5AE1, 0x62B5, 0x5E95, 0x5730,
+    0x8482, 0x7B2C, 0x5E1D, 0x5F1F, 0x9012, 0x7F14, 0x98A0, 0x6382, 0x6EC7, 0x7898,
+    0x70B9, 0x5178, 0x975B, 0x57AB, 0x7535, 0x4F43, 0x7538, 0x5E97, 0x60E6, 0x5960,
+    0x6DC0, 0x6BBF, 0x7889, 0x53FC, 0x96D5, 0x51CB, 0x5201, 0x6389, 0x540A, 0x9493,
+    0x8C03, 0x8DCC, 0x7239, 0x789F, 0x8776, 0x8FED, 0x8C0D, 0x53E0, 0x79BC, 0x79BF,
+    0x79C2, 0x79C4, 0x79C5, 0x79C7, 0x79C8, 0x79CA, 0x79CC, 0x79CE, 0x79CF, 0x79D0,
+    0x79D3, 0x79D4, 0x79D6, 0x79D7, 0x79E0, 0x79E1, 0x79E2, 0x79E5, 0x79E8, 0x79EA,
+    0x79EC, 0x79EE, 0x79F9, 0x79FA, 0x79FC, 0x79FE, 0x79FF, 0x7A01, 0x7A04, 0x7A05,
+    0x7A0C, 0x7A15, 0x7A16, 0x7A18, 0x7A19, 0x7A1B, 0x7A1C, 0x4E01, 0x76EF, 0x53EE,
+    0x9489, 0x9876, 0x9F0E, 0x952D, 0x5B9A, 0x8BA2, 0x4E22, 0x4E1C, 0x51AC, 0x8463,
+    0x61C2, 0x52A8, 0x680B, 0x4F97, 0x606B, 0x51BB, 0x6D1E, 0x515C, 0x6296, 0x6597,
+    0x9661, 0x8C46, 0x9017, 0x75D8, 0x90FD, 0x7763, 0x6BD2, 0x728A, 0x72EC, 0x8BFB,
+    0x5835, 0x7779, 0x8D4C, 0x675C, 0x9540, 0x809A, 0x5EA6, 0x6E21, 0x5992, 0x7AEF,
+    0x77ED, 0x953B, 0x6BB5, 0x65AD, 0x7F0E, 0x5806, 0x5151, 0x961F, 0x5BF9, 0x58A9,
+    0x5428, 0x8E72, 0x6566, 0x987F, 0x56E4, 0x949D, 0x76FE, 0x9041, 0x6387, 0x54C6,
+    0x591A, 0x593A, 0x579B, 0x8EB2, 0x6735, 0x8DFA, 0x8235, 0x5241, 0x60F0, 0x5815,
+    0x86FE, 0x5CE8, 0x9E45, 0x4FC4, 0x989D, 0x8BB9, 0x5A25, 0x6076, 0x5384, 0x627C,
+    0x904F, 0x9102, 0x997F, 0x6069, 0x800C, 0x513F, 0x8033, 0x5C14, 0x9975, 0x6D31,
+    0x4E8C, 0x7A1D, 0x7A1F, 0x7A21, 0x7A22, 0x7A34, 0x7A35, 0x7A36, 0x7A38, 0x7A3A,
+    0x7A3E, 0x7A71, 0x7A72, 0x7A73, 0x7A75, 0x7A82, 0x7A85, 0x7A87, 0x7A8E, 0x7A8F,
+    0x7A90, 0x7A93, 0x7A94, 0x7A99, 0x7A9A, 0x7A9B, 0x7A9E, 0x7AA1, 0x7AA2, 0x8D30,
+    0x53D1, 0x7F5A, 0x7B4F, 0x4F10, 0x4E4F, 0x9600, 0x6CD5, 0x73D0, 0x85E9, 0x5E06,
+    0x756A, 0x7FFB, 0x6A0A, 0x77FE, 0x9492, 0x7E41, 0x51E1, 0x70E6, 0x53CD, 0x8FD4,
+    0x8303, 0x8D29, 0x72AF, 0x996D, 0x6CDB, 0x574A, 0x82B3, 0x65B9, 0x80AA, 0x623F,
+    0x9632, 0x59A8, 0x4EFF, 0x8BBF, 0x7EBA, 0x653E, 0x83F2, 0x975E, 0x5561, 0x98DE,
+    0x80A5, 0x532A, 0x8BFD, 0x5420, 0x80BA, 0x5E9F, 0x6CB8, 0x8D39, 0x82AC, 0x915A,
+    0x5429, 0x6C1B, 0x5206, 0x7EB7, 0x575F, 0x711A, 0x6C7E, 0x7C89, 0x594B, 0x4EFD,
+    0x5FFF, 0x6124, 0x7CAA, 0x4E30, 0x5C01, 0x67AB, 0x8702, 0x5CF0, 0x950B, 0x98CE,
+    0x75AF, 0x70FD, 0x9022, 0x51AF, 0x7F1D, 0x8BBD, 0x5949, 0x51E4, 0x4F5B, 0x5426,
+    0x592B, 0x6577, 0x80A4, 0x5B75, 0x6276, 0x62C2, 0x8F90, 0x5E45, 0x6C1F, 0x7B26,
+    0x4F0F, 0x4FD8, 0x670D, 0x7AA3, 0x7AA4, 0x7AA7, 0x7AA9, 0x7AAA, 0x7AAB, 0x7AD7,
+    0x7AD8, 0x7AE1, 0x7AE2, 0x7AE4, 0x7AEE, 0x7AFB, 0x7AFC, 0x7AFE, 0x7B00, 0x7B01,
+    0x7B02, 0x7B05, 0x7B07, 0x7B09, 0x7B0C, 0x7B0D, 0x7B0E, 0x7B10, 0x7B12, 0x7B13,
+    0x7B16, 0x7B17, 0x7B18, 0x7B1A, 0x7B1C, 0x7B1D, 0x7B1F, 0x7B21, 0x7B22, 0x7B23,
+    0x7B27, 0x7B29, 0x7B2D, 0x6D6E, 0x6DAA, 0x798F, 0x88B1, 0x5F17, 0x752B, 0x629A,
+    0x8F85, 0x4FEF, 0x91DC, 0x65A7, 0x812F, 0x8151, 0x5E9C, 0x8150, 0x8D74, 0x526F,
+    0x8986, 0x8D4B, 0x590D, 0x5085, 0x4ED8, 0x961C, 0x7236, 0x8179, 0x8D1F, 0x5BCC,
+    0x8BA3, 0x9644, 0x5987, 0x7F1A, 0x5490, 0x5676, 0x560E, 0x8BE5, 0x6539, 0x6982,
+    0x9499, 0x76D6, 0x6E89, 0x5E72, 0x7518, 0x6746, 0x67D1, 0x7AFF, 0x809D, 0x8D76,
+    0x611F, 0x79C6, 0x6562, 0x8D63, 0x5188, 0x521A, 0x94A2, 0x7F38, 0x809B, 0x7EB2,
+    0x5C97, 0x6E2F, 0x6760, 0x7BD9, 0x768B, 0x9AD8, 0x818F, 0x7F94, 0x7CD5, 0x641E,
+    0x9550, 0x7A3F, 0x544A, 0x54E5, 0x6B4C, 0x6401, 0x6208, 0x9E3D, 0x80F3, 0x7599,
+    0x5272, 0x9769, 0x845B, 0x683C, 0x86E4, 0x9601, 0x9694, 0x94EC, 0x4E2A, 0x5404,
+    0x7ED9, 0x6839, 0x8DDF, 0x8015, 0x66F4, 0x5E9A, 0x7FB9, 0x7B2F, 0x7B30, 0x7B32,
+    0x7B39, 0x7B3B, 0x7B3D, 0x7B46, 0x7B48, 0x7B4A, 0x7B4D, 0x7B4E, 0x7B53, 0x7B55,
+    0x7B57, 0x7B59, 0x7B5C, 0x7B5E, 0x7B5F, 0x7B61, 0x7B6F, 0x7B70, 0x7B73, 0x7B74,
+    0x7B76, 0x7B78, 0x7B7A, 0x7B7C, 0x7B7D, 0x7B7F, 0x7B8E, 0x7B8F, 0x7B91, 0x7B92,
+    0x7B93, 0x7B96, 0x7B9E, 0x7B9F, 0x7BA0, 0x7BA3, 0x7BA4, 0x7BA5, 0x7BAE, 0x7BAF,
+    0x7BB0, 0x7BB2, 0x7BB3, 0x7BB5, 0x7BB6, 0x7BB7, 0x7BC2, 0x7BC3, 0x7BC4, 0x57C2,
+    0x803F, 0x6897, 0x5DE5, 0x653B, 0x529F, 0x606D, 0x9F9A, 0x4F9B, 0x8EAC, 0x516C,
+    0x5BAB, 0x5F13, 0x5DE9, 0x6C5E, 0x62F1, 0x8D21, 0x5171, 0x94A9, 0x52FE, 0x6C9F,
+    0x82DF, 0x72D7, 0x57A2, 0x6784, 0x8D2D, 0x591F, 0x8F9C, 0x83C7, 0x5495, 0x7B8D,
+    0x4F30, 0x6CBD, 0x5B64, 0x59D1, 0x9F13, 0x53E4, 0x86CA, 0x9AA8, 0x8C37, 0x80A1,
+    0x6545, 0x987E, 0x56FA, 0x96C7, 0x522E, 0x74DC, 0x5250, 0x5BE1, 0x6302, 0x8902,
+    0x4E56, 0x62D0, 0x602A, 0x68FA, 0x5173, 0x5B98, 0x51A0, 0x89C2, 0x7BA1, 0x9986,
+    0x7F50, 0x60EF, 0x704C, 0x8D2F, 0x5149, 0x5E7F, 0x901B, 0x7470, 0x89C4, 0x572D,
+    0x7845, 0x5F52, 0x9F9F, 0x95FA, 0x8F68, 0x9B3C, 0x8BE1, 0x7678, 0x6842, 0x67DC,
+    0x8DEA, 0x8D35, 0x523D, 0x8F8A, 0x6EDA, 0x68CD, 0x9505, 0x90ED, 0x56FD, 0x679C,
+    0x88F9, 0x8FC7, 0x54C8, 0x7BC5, 0x7BD2, 0x7BDB, 0x7BDC, 0x7BDE, 0x7BDF, 0x7BE0,
+    0x7BE2, 0x7BE3, 0x7BE4, 0x7BE7, 0x7BE8, 0x7BE9, 0x7BEB, 0x7BEC, 0x7BED, 0x7BEF,
+    0x7BF0, 0x7BFD, 0x7C08, 0x7C09, 0x7C0A, 0x7C0D, 0x7C0E, 0x7C17, 0x7C18, 0x7C19,
+    0x7C28, 0x7C29, 0x7C42, 0x9AB8, 0x5B69, 0x6D77, 0x6C26, 0x4EA5, 0x5BB3, 0x9A87,
+    0x9163, 0x61A8, 0x90AF, 0x97E9, 0x542B, 0x6DB5, 0x5BD2, 0x51FD, 0x558A, 0x7F55,
+    0x7FF0, 0x64BC, 0x634D, 0x65F1, 0x61BE, 0x608D, 0x710A, 0x6C57, 0x6C49, 0x592F,
+    0x676D, 0x822A, 0x58D5, 0x568E, 0x8C6A, 0x6BEB, 0x90DD, 0x597D, 0x8017, 0x53F7,
+    0x6D69, 0x5475, 0x559D, 0x8377, 0x83CF, 0x6838, 0x79BE, 0x548C, 0x4F55, 0x5408,
+    0x76D2, 0x8C89, 0x9602, 0x6CB3, 0x6DB8, 0x8D6B, 0x8910, 0x9E64, 0x8D3A, 0x563F,
+    0x9ED1, 0x75D5, 0x5F88, 0x72E0, 0x6068, 0x54FC, 0x4EA8, 0x6A2A, 0x8861, 0x6052,
+    0x8F70, 0x54C4, 0x70D8, 0x8679, 0x9E3F, 0x6D2A, 0x5B8F, 0x5F18, 0x7EA2, 0x5589,
+    0x4FAF, 0x7334, 0x543C, 0x539A, 0x5019, 0x540E, 0x547C, 0x4E4E, 0x5FFD, 0x745A,
+    0x58F6, 0x846B, 0x80E1, 0x8774, 0x72D0, 0x7CCA, 0x6E56, 0x7C88, 0x7C93, 0x7C94,
+    0x7C96, 0x7C99, 0x7C9A, 0x7C9B, 0x7CA0, 0x7CA1, 0x7CA3, 0x7CAB, 0x7CAC, 0x7CAD,
+    0x7CAF, 0x7CB0, 0x7CBA, 0x7CBB, 0x5F27, 0x864E, 0x552C, 0x62A4, 0x4E92, 0x6CAA,
+    0x6237, 0x82B1, 0x54D7, 0x534E, 0x733E, 0x6ED1, 0x753B, 0x5212, 0x5316, 0x8BDD,
+    0x69D0, 0x5F8A, 0x6000, 0x6DEE, 0x574F, 0x6B22, 0x73AF, 0x6853, 0x8FD8, 0x7F13,
+    0x6362, 0x60A3, 0x5524, 0x75EA, 0x8C62, 0x7115, 0x6DA3, 0x5BA6, 0x5E7B, 0x8352,
+    0x614C, 0x9EC4, 0x78FA, 0x8757, 0x7C27, 0x7687, 0x51F0, 0x60F6, 0x714C, 0x6643,
+    0x5E4C, 0x604D, 0x8C0E, 0x7070, 0x6325, 0x8F89, 0x5FBD, 0x6062, 0x86D4, 0x56DE,
+    0x6BC1, 0x6094, 0x6167, 0x5349, 0x60E0, 0x6666, 0x8D3F, 0x79FD, 0x4F1A, 0x70E9,
+    0x6C47, 0x8BB3, 0x8BF2, 0x7ED8, 0x8364, 0x660F, 0x5A5A, 0x9B42, 0x6D51, 0x6DF7,
+    0x8C41, 0x6D3B, 0x4F19, 0x706B, 0x83B7, 0x6216, 0x60D1, 0x970D, 0x8D27, 0x7978,
+    0x51FB, 0x573E, 0x57FA, 0x673A, 0x7578, 0x7A3D, 0x79EF, 0x7B95, 0x7CBF, 0x7CC0,
+    0x7CC2, 0x7CC3, 0x7CC4, 0x7CC6, 0x7CC9, 0x7CCB, 0x7CD8, 0x7CDA, 0x7CDB, 0x7CDD,
+    0x7CDE, 0x7CF9, 0x7CFA, 0x7D21, 0x7D28, 0x7D29, 0x7D2A, 0x7D2C, 0x7D2D, 0x7D2E,
+    0x808C, 0x9965, 0x8FF9, 0x6FC0, 0x8BA5, 0x9E21, 0x59EC, 0x7EE9, 0x7F09, 0x5409,
+    0x6781, 0x68D8, 0x8F91, 0x7C4D, 0x96C6, 0x53CA, 0x6025, 0x75BE, 0x6C72, 0x5373,
+    0x5AC9, 0x7EA7, 0x6324, 0x51E0, 0x810A, 0x5DF1, 0x84DF, 0x6280, 0x5180, 0x5B63,
+    0x4F0E, 0x796D, 0x5242, 0x60B8, 0x6D4E, 0x5BC4, 0x5BC2, 0x8BA1, 0x8BB0, 0x65E2,
+    0x5FCC, 0x9645, 0x5993, 0x7EE7, 0x7EAA, 0x5609, 0x67B7, 0x5939, 0x4F73, 0x5BB6,
+    0x52A0, 0x835A, 0x988A, 0x8D3E, 0x7532, 0x94BE, 0x5047, 0x7A3C, 0x4EF7, 0x67B6,
+    0x9A7E, 0x5AC1, 0x6B7C, 0x76D1, 0x575A, 0x5C16, 0x7B3A, 0x95F4, 0x714E, 0x517C,
+    0x80A9, 0x8270, 0x5978, 0x7F04, 0x8327, 0x68C0, 0x67EC, 0x78B1, 0x7877, 0x62E3,
+    0x6361, 0x7B80, 0x4FED, 0x526A, 0x51CF, 0x8350, 0x69DB, 0x9274, 0x8DF5, 0x8D31,
+    0x89C1, 0x952E, 0x7BAD, 0x4EF6, 0x5065, 0x8230, 0x5251, 0x996F, 0x6E10, 0x6E85,
+    0x6DA7, 0x5EFA, 0x50F5, 0x59DC, 0x5C06, 0x6D46, 0x6C5F, 0x7586, 0x848B, 0x6868,
+    0x5956, 0x8BB2, 0x5320, 0x9171, 0x964D, 0x8549, 0x6912, 0x7901, 0x7126, 0x80F6,
+    0x4EA4, 0x90CA, 0x6D47, 0x9A84, 0x5A07, 0x56BC, 0x6405, 0x94F0, 0x77EB, 0x4FA5,
+    0x811A, 0x72E1, 0x89D2, 0x997A, 0x7F34, 0x7EDE, 0x527F, 0x6559, 0x9175, 0x8F7F,
+    0x8F83, 0x53EB, 0x7A96, 0x63ED, 0x63A5, 0x7686, 0x79F8, 0x8857, 0x9636, 0x622A,
+    0x52AB, 0x8282, 0x6854, 0x6770, 0x6377, 0x776B, 0x7AED, 0x6D01, 0x7ED3, 0x89E3,
+    0x59D0, 0x6212, 0x85C9, 0x82A5, 0x754C, 0x501F, 0x4ECB, 0x75A5, 0x8BEB, 0x5C4A,
+    0x5DFE, 0x7B4B, 0x65A4, 0x91D1, 0x4ECA, 0x6D25, 0x895F, 0x7D27, 0x9526, 0x4EC5,
+    0x8C28, 0x8FDB, 0x9773, 0x664B, 0x7981, 0x8FD1, 0x70EC, 0x6D78, 0x5C3D, 0x52B2,
+    0x8346, 0x5162, 0x830E, 0x775B, 0x6676, 0x9CB8, 0x4EAC, 0x60CA, 0x7CBE, 0x7CB3,
+    0x7ECF, 0x4E95, 0x8B66, 0x666F, 0x9888, 0x9759, 0x5883, 0x656C, 0x955C, 0x5F84,
+    0x75C9, 0x9756, 0x7ADF, 0x7ADE, 0x51C0, 0x70AF, 0x7A98, 0x63EA, 0x7A76, 0x7EA0,
+    0x7396, 0x97ED, 0x4E45, 0x7078, 0x4E5D, 0x9152, 0x53A9, 0x6551, 0x65E7, 0x81FC,
+    0x8205, 0x548E, 0x5C31, 0x759A, 0x97A0, 0x62D8, 0x72D9, 0x75BD, 0x5C45, 0x9A79,
+    0x83CA, 0x5C40, 0x5480, 0x77E9, 0x4E3E, 0x6CAE, 0x805A, 0x62D2, 0x636E, 0x5DE8,
+    0x5177, 0x8DDD, 0x8E1E, 0x952F, 0x4FF1, 0x53E5, 0x60E7, 0x70AC, 0x5267, 0x6350,
+    0x9E43, 0x5A1F, 0x5026, 0x7737, 0x5377, 0x7EE2, 0x6485, 0x652B, 0x6289, 0x6398,
+    0x5014, 0x7235, 0x89C9, 0x51B3, 0x8BC0, 0x7EDD, 0x5747, 0x83CC, 0x94A7, 0x519B,
+    0x541B, 0x5CFB, 0x7E3A, 0x4FCA, 0x7AE3, 0x6D5A, 0x90E1, 0x9A8F, 0x5580, 0x5496,
+    0x5361, 0x54AF, 0x5F00, 0x63E9, 0x6977, 0x51EF, 0x6168, 0x520A, 0x582A, 0x52D8,
+    0x574E, 0x780D, 0x770B, 0x5EB7, 0x6177, 0x7CE0, 0x625B, 0x6297, 0x4EA2, 0x7095,
+    0x8003, 0x62F7, 0x70E4, 0x9760, 0x5777, 0x82DB, 0x67EF, 0x68F5, 0x78D5, 0x9897,
+    0x79D1, 0x58F3, 0x54B3, 0x53EF, 0x6E34, 0x514B, 0x523B, 0x5BA2, 0x8BFE, 0x80AF,
+    0x5543, 0x57A6, 0x6073, 0x5751, 0x542D, 0x7A7A, 0x6050, 0x5B54, 0x63A7, 0x62A0,
+    0x53E3, 0x6263, 0x5BC7, 0x67AF, 0x54ED, 0x7A9F, 0x82E6, 0x9177, 0x5E93, 0x88E4,
+    0x5938, 0x57AE, 0x630E, 0x8DE8, 0x80EF, 0x5757, 0x7B77, 0x4FA9, 0x5FEB, 0x5BBD,
+    0x6B3E, 0x5321, 0x7B50, 0x72C2, 0x6846, 0x77FF, 0x7736, 0x65F7, 0x51B5, 0x4E8F,
+    0x76D4, 0x5CBF, 0x7AA5, 0x8475, 0x594E, 0x9B41, 0x5080, 0x7E9C, 0x7E9D, 0x7E9E,
+    0x7EAE, 0x7EB4, 0x7EBB, 0x7EBC, 0x7ED6, 0x7EE4, 0x7EEC, 0x7EF9, 0x7F0A, 0x7F10,
+    0x7F1E, 0x7F37, 0x7F39, 0x7F43, 0x7F52, 0x7F53, 0x9988, 0x6127, 0x6E83, 0x5764,
+    0x6606, 0x6346, 0x56F0, 0x62EC, 0x6269, 0x5ED3, 0x9614, 0x5783, 0x62C9, 0x5587,
+    0x8721, 0x814A, 0x8FA3, 0x5566, 0x83B1, 0x6765, 0x8D56, 0x84DD, 0x5A6A, 0x680F,
+    0x62E6, 0x7BEE, 0x9611, 0x5170, 0x6F9C, 0x8C30, 0x63FD, 0x89C8, 0x61D2, 0x7F06,
+    0x70C2, 0x6EE5, 0x7405, 0x6994, 0x72FC, 0x5ECA, 0x90CE, 0x6717, 0x6D6A, 0x635E,
+    0x52B3, 0x7262, 0x8001, 0x4F6C, 0x59E5, 0x916A, 0x70D9, 0x6D9D, 0x52D2, 0x4E50,
+    0x96F7, 0x956D, 0x857E, 0x78CA, 0x7D2F, 0x5121, 0x5792, 0x64C2, 0x808B, 0x7C7B,
+    0x6CEA, 0x68F1, 0x695E, 0x51B7, 0x5398, 0x68A8, 0x7281, 0x9ECE, 0x7BF1, 0x72F8,
+    0x79BB, 0x6F13, 0x7406, 0x674E, 0x91CC, 0x9CA4, 0x793C, 0x8389, 0x8354, 0x540F,
+    0x6817, 0x4E3D, 0x5389, 0x52B1, 0x783E, 0x5386, 0x5229, 0x5088, 0x4F8B, 0x4FD0,
+    0x7F56, 0x7F59, 0x7F60, 0x7F6B, 0x7F6C, 0x7F6D, 0x7F6F, 0x7F70, 0x7F73, 0x7F7F,
+    0x7F80, 0x7F8B, 0x7F8D, 0x7F9B, 0x7F9C, 0x7FA0, 0x7FA2, 0x7FA3, 0x7FA5, 0x7FA6,
+    0x7FB1, 0x7FBA, 0x7FBB, 0x7FBE, 0x7FC0, 0x7FC2, 0x7FC3, 0x7FC4, 0x7FCB, 0x7FCD,
+    0x7FD6, 0x7FD7, 0x7FE2, 0x7FE3, 0x75E2, 0x7ACB, 0x7C92, 0x6CA5, 0x96B6, 0x529B,
+    0x7483, 0x54E9, 0x4FE9, 0x8054, 0x83B2, 0x8FDE, 0x9570, 0x5EC9, 0x601C, 0x6D9F,
+    0x5E18, 0x655B, 0x8138, 0x94FE, 0x604B, 0x70BC, 0x7EC3, 0x7CAE, 0x51C9, 0x6881,
+    0x7CB1, 0x826F, 0x4E24, 0x8F86, 0x91CF, 0x667E, 0x4EAE, 0x8C05, 0x64A9, 0x804A,
+    0x50DA, 0x7597, 0x71CE, 0x5BE5, 0x8FBD, 0x6F66, 0x4E86, 0x6482, 0x9563, 0x5ED6,
+    0x6599, 0x5217, 0x88C2, 0x70C8, 0x52A3, 0x730E, 0x7433, 0x6797, 0x78F7, 0x9716,
+    0x4E34, 0x90BB, 0x9CDE, 0x6DCB, 0x51DB, 0x8D41, 0x541D, 0x62CE, 0x73B2, 0x83F1,
+    0x96F6, 0x9F84, 0x94C3, 0x4F36, 0x7F9A, 0x51CC, 0x7075, 0x9675, 0x5CAD, 0x9886,
+    0x53E6, 0x4EE4, 0x6E9C, 0x7409, 0x69B4, 0x786B, 0x998F, 0x7559, 0x5218, 0x7624,
+    0x6D41, 0x67F3, 0x516D, 0x9F99, 0x804B, 0x5499, 0x7B3C, 0x7ABF, 0x7FE4, 0x7FE7,
+    0x7FE8, 0x7FEF, 0x7FF2, 0x7FFD, 0x7FFE, 0x7FFF, 0x8002, 0x800E, 0x800F, 0x8011,
+    0x8013, 0x801A, 0x801B, 0x801D, 0x801E, 0x801F, 0x8021, 0x8023, 0x8024, 0x8032,
+    0x8034, 0x8039, 0x803A, 0x803C, 0x803E, 0x8040, 0x8041, 0x8044, 0x8045, 0x8047,
+    0x8048, 0x8049, 0x8053, 0x8055, 0x8056, 0x8057, 0x8059, 0x9686, 0x5784, 0x62E2,
+    0x9647, 0x697C, 0x5A04, 0x6402, 0x7BD3, 0x6F0F, 0x964B, 0x82A6, 0x5362, 0x9885,
+    0x5E90, 0x7089, 0x63B3, 0x5364, 0x864F, 0x9C81, 0x9E93, 0x788C, 0x9732, 0x8DEF,
+    0x8D42, 0x9E7F, 0x6F5E, 0x7984, 0x5F55, 0x9646, 0x622E, 0x9A74, 0x5415, 0x94DD,
+    0x4FA3, 0x65C5, 0x5C65, 0x5C61, 0x7F15, 0x8651, 0x6C2F, 0x5F8B, 0x7387, 0x6EE4,
+    0x7EFF, 0x5CE6, 0x631B, 0x5B6A, 0x6EE6, 0x5375, 0x4E71, 0x63A0, 0x7565, 0x62A1,
+    0x8F6E, 0x4F26, 0x4ED1, 0x6CA6, 0x7EB6, 0x8BBA, 0x841D, 0x87BA, 0x7F57, 0x903B,
+    0x9523, 0x7BA9, 0x9AA1, 0x88F8, 0x843D, 0x6D1B, 0x9A86, 0x7EDC, 0x5988, 0x9EBB,
+    0x739B, 0x7801, 0x8682, 0x9A6C, 0x9A82, 0x561B, 0x5417, 0x57CB, 0x4E70, 0x9EA6,
+    0x5356, 0x8FC8, 0x8109, 0x7792, 0x9992, 0x86EE, 0x6EE1, 0x8513, 0x66FC, 0x6162,
+    0x6F2B, 0x807E, 0x8081, 0x8082, 0x8085, 0x8088, 0x808A, 0x8094, 0x8095, 0x8097,
+    0x8099, 0x809E, 0x80A3, 0x80A6, 0x80A7, 0x80A8, 0x80AC, 0x80B0, 0x80B3, 0x80B5,
+    0x80B6, 0x80B8, 0x80B9, 0x80BB, 0x80C5, 0x80D8, 0x80DF, 0x80E0, 0x80E2, 0x80E3,
+    0x80E6, 0x80EE, 0x80F5, 0x80F7, 0x80F9, 0x80FB, 0x8103, 0x8104, 0x8105, 0x8107,
+    0x8108, 0x810B, 0x810C, 0x8115, 0x8117, 0x8119, 0x811B, 0x811C, 0x811D, 0x812D,
+    0x812E, 0x8130, 0x8133, 0x8134, 0x8135, 0x8137, 0x813F, 0x8C29, 0x8292, 0x832B,
+    0x76F2, 0x6C13, 0x5FD9, 0x83BD, 0x732B, 0x8305, 0x951A, 0x6BDB, 0x77DB, 0x94C6,
+    0x536F, 0x8302, 0x5192, 0x5E3D, 0x8C8C, 0x8D38, 0x4E48, 0x73AB, 0x679A, 0x6885,
+    0x9176, 0x9709, 0x7164, 0x6CA1, 0x7709, 0x5A92, 0x9541, 0x6BCF, 0x7F8E, 0x6627,
+    0x5BD0, 0x59B9, 0x5A9A, 0x95E8, 0x95F7, 0x4EEC, 0x840C, 0x8499, 0x6AAC, 0x76DF,
+    0x9530, 0x731B, 0x68A6, 0x5B5F, 0x772F, 0x919A, 0x9761, 0x7CDC, 0x8FF7, 0x8C1C,
+    0x5F25, 0x7C73, 0x79D8, 0x89C5, 0x6CCC, 0x871C, 0x5BC6, 0x5E42, 0x68C9, 0x7720,
+    0x7EF5, 0x5195, 0x514D, 0x52C9, 0x5A29, 0x7F05, 0x9762, 0x82D7, 0x63CF, 0x7784,
+    0x85D0, 0x79D2, 0x6E3A, 0x5E99, 0x5999, 0x8511, 0x706D, 0x6C11, 0x62BF, 0x76BF,
+    0x654F, 0x60AF, 0x95FD, 0x660E, 0x879F, 0x9E23, 0x94ED, 0x540D, 0x547D, 0x8C2C,
+    0x6478, 0x8147, 0x8149, 0x814D, 0x814E, 0x814F, 0x8152, 0x8156, 0x8157, 0x8158,
+    0x8166, 0x8168, 0x816A, 0x816B, 0x816C, 0x816F, 0x8172, 0x8173, 0x8181, 0x8189,
+    0x8190, 0x8199, 0x819A, 0x81A4, 0x81A5, 0x81A7, 0x81A9, 0x81C4, 0x81C5, 0x81C7,
+    0x81C8, 0x81C9, 0x81CB, 0x6479, 0x8611, 0x6A21, 0x819C, 0x78E8, 0x6469, 0x9B54,
+    0x62B9, 0x672B, 0x83AB, 0x58A8, 0x9ED8, 0x6CAB, 0x6F20, 0x5BDE, 0x964C, 0x8C0B,
+    0x725F, 0x67D0, 0x62C7, 0x7261, 0x4EA9, 0x59C6, 0x6BCD, 0x5893, 0x66AE, 0x5E55,
+    0x52DF, 0x6155, 0x6728, 0x76EE, 0x7766, 0x7267, 0x7A46, 0x62FF, 0x54EA, 0x5450,
+    0x94A0, 0x90A3, 0x5A1C, 0x7EB3, 0x6C16, 0x4E43, 0x5976, 0x8010, 0x5948, 0x5357,
+    0x7537, 0x96BE, 0x56CA, 0x6320, 0x8111, 0x607C, 0x95F9, 0x6DD6, 0x5462, 0x9981,
+    0x5185, 0x5AE9, 0x80FD, 0x59AE, 0x9713, 0x502A, 0x6CE5, 0x5C3C, 0x62DF, 0x4F60,
+    0x533F, 0x817B, 0x9006, 0x6EBA, 0x852B, 0x62C8, 0x5E74, 0x78BE, 0x64B5, 0x637B,
+    0x5FF5, 0x5A18, 0x917F, 0x9E1F, 0x5C3F, 0x634F, 0x8042, 0x5B7D, 0x556E, 0x954A,
+    0x954D, 0x6D85, 0x60A8, 0x67E0, 0x72DE, 0x51DD, 0x5B81, 0x81E4, 0x81E5, 0x81E6,
+    0x81E8, 0x81E9, 0x81EB, 0x81FD, 0x81FF, 0x8203, 0x820E, 0x820F, 0x8211, 0x8213,
+    0x821D, 0x8220, 0x8229, 0x822E, 0x8232, 0x823A, 0x823C, 0x823D, 0x823F, 0x8245,
+    0x8246, 0x8248, 0x824A, 0x824C, 0x824D, 0x824E, 0x8259, 0x8269, 0x62E7, 0x6CDE,
+    0x725B, 0x626D, 0x94AE, 0x7EBD, 0x8113, 0x6D53, 0x519C, 0x5F04, 0x5974, 0x52AA,
+    0x6012, 0x5973, 0x6696, 0x8650, 0x759F, 0x632A, 0x61E6, 0x7CEF, 0x8BFA, 0x54E6,
+    0x6B27, 0x9E25, 0x6BB4, 0x85D5, 0x5455, 0x5076, 0x6CA4, 0x556A, 0x8DB4, 0x722C,
+    0x5E15, 0x6015, 0x7436, 0x62CD, 0x6392, 0x724C, 0x5F98, 0x6E43, 0x6D3E, 0x6500,
+    0x6F58, 0x76D8, 0x78D0, 0x76FC, 0x7554, 0x5224, 0x53DB, 0x4E53, 0x5E9E, 0x65C1,
+    0x802A, 0x80D6, 0x629B, 0x5486, 0x5228, 0x70AE, 0x888D, 0x8DD1, 0x6CE1, 0x5478,
+    0x80DA, 0x57F9, 0x88F4, 0x8D54, 0x966A, 0x914D, 0x4F69, 0x6C9B, 0x55B7, 0x76C6,
+    0x7830, 0x62A8, 0x70F9, 0x6F8E, 0x5F6D, 0x84EC, 0x68DA, 0x787C, 0x7BF7, 0x81A8,
+    0x670B, 0x9E4F, 0x6367, 0x78B0, 0x576F, 0x7812, 0x9739, 0x6279, 0x62AB, 0x5288,
+    0x7435, 0x6BD7, 0x8271, 0x827B, 0x827C, 0x8280, 0x8281, 0x8283, 0x8285, 0x8286,
+    0x8287, 0x8289, 0x828C, 0x8290, 0x829A, 0x829B, 0x829E, 0x82A0, 0x82A2, 0x82A3,
+    0x82A7, 0x82B2, 0x82B5, 0x82B6, 0x82BA, 0x82BB, 0x82BC, 0x82BF, 0x82C0, 0x82C2,
+    0x82C3, 0x82C5, 0x82C6, 0x82C9, 0x82D0, 0x82D6, 0x82D9, 0x82DA, 0x82DD, 0x82E2,
+    0x82EC, 0x82ED, 0x82EE, 0x82F0, 0x82F2, 0x82F3, 0x82F5, 0x82F6, 0x82F8, 0x82FA,
+    0x830A, 0x830B, 0x830D, 0x8310, 0x8312, 0x8313, 0x8316, 0x8318, 0x8319, 0x8329,
+    0x832A, 0x832E, 0x8330, 0x8332, 0x8337, 0x833B, 0x833D, 0x5564, 0x813E, 0x75B2,
+    0x76AE, 0x5339, 0x75DE, 0x50FB, 0x5C41, 0x8B6C, 0x7BC7, 0x504F, 0x7247, 0x9A97,
+    0x98D8, 0x6F02, 0x74E2, 0x7968, 0x6487, 0x77A5, 0x62FC, 0x9891, 0x8D2B, 0x54C1,
+    0x8058, 0x4E52, 0x576A, 0x82F9, 0x840D, 0x5E73, 0x51ED, 0x74F6, 0x8BC4, 0x5C4F,
+    0x5761, 0x6CFC, 0x9887, 0x5A46, 0x7834, 0x9B44, 0x8FEB, 0x7C95, 0x5256, 0x6251,
+    0x94FA, 0x4EC6, 0x8386, 0x8461, 0x83E9, 0x84B2, 0x57D4, 0x6734, 0x5703, 0x666E,
+    0x6D66, 0x8C31, 0x66DD, 0x7011, 0x671F, 0x6B3A, 0x6816, 0x621A, 0x59BB, 0x4E03,
+    0x51C4, 0x6F06, 0x67D2, 0x6C8F, 0x5176, 0x68CB, 0x5947, 0x6B67, 0x7566, 0x5D0E,
+    0x8110, 0x9F50, 0x65D7, 0x7948, 0x7941, 0x9A91, 0x8D77, 0x5C82, 0x4E5E, 0x4F01,
+    0x542F, 0x5951, 0x780C, 0x5668, 0x6C14, 0x8FC4, 0x5F03, 0x6C7D, 0x6CE3, 0x8BAB,
+    0x6390, 0x833E, 0x833F, 0x8341, 0x8342, 0x8344, 0x8345, 0x8348, 0x8353, 0x835D,
+    0x8362, 0x8379, 0x837A, 0x8387, 0x8388, 0x838F, 0x8390, 0x8391, 0x8399, 0x839A,
+    0x839D, 0x839F, 0x83AC, 0x83AD, 0x83AE, 0x83AF, 0x83B5, 0x83BB, 0x83BE, 0x83BF,
+    0x83C2, 0x83C3, 0x83C4, 0x83C6, 0x83C8, 0x83C9, 0x83CB, 0x83CD, 0x83CE, 0x83D5,
+    0x83D7, 0x83D9, 0x83DA, 0x83DB, 0x83DE, 0x83E2, 0x83E3, 0x83E4, 0x83E6, 0x83E7,
+    0x83E8, 0x83EB, 0x83EC, 0x83ED, 0x6070, 0x6D3D, 0x7275, 0x6266, 0x948E, 0x94C5,
+    0x5343, 0x8FC1, 0x7B7E, 0x4EDF, 0x8C26, 0x4E7E, 0x9ED4, 0x94B1, 0x94B3, 0x524D,
+    0x6F5C, 0x9063, 0x6D45, 0x8C34, 0x5811, 0x5D4C, 0x6B20, 0x6B49, 0x67AA, 0x545B,
+    0x8154, 0x7F8C, 0x5899, 0x8537, 0x5F3A, 0x62A2, 0x6A47, 0x9539, 0x6572, 0x6084,
+    0x6865, 0x77A7, 0x4E54, 0x4FA8, 0x5DE7, 0x9798, 0x64AC, 0x7FD8, 0x5CED, 0x4FCF,
+    0x7A8D, 0x5207, 0x8304, 0x4E14, 0x602F, 0x7A83, 0x94A6, 0x4FB5, 0x4EB2, 0x79E6,
+    0x7434, 0x52E4, 0x82B9, 0x64D2, 0x79BD, 0x5BDD, 0x6C81, 0x9752, 0x8F7B, 0x6C22,
+    0x503E, 0x537F, 0x6E05, 0x64CE, 0x6674, 0x6C30, 0x60C5, 0x9877, 0x8BF7, 0x5E86,
+    0x743C, 0x7A77, 0x79CB, 0x4E18, 0x90B1, 0x7403, 0x6C42, 0x56DA, 0x914B, 0x6CC5,
+    0x8D8B, 0x533A, 0x86C6, 0x66F2, 0x8EAF, 0x5C48, 0x9A71, 0x6E20, 0x83EE, 0x83EF,
+    0x83FA, 0x83FB, 0x83FC, 0x83FE, 0x83FF, 0x8400, 0x8402, 0x8405, 0x8410, 0x8419,
+    0x841A, 0x841B, 0x8439, 0x843A, 0x843B, 0x8447, 0x8448, 0x8449, 0x8458, 0x8462,
+    0x846A, 0x846E, 0x846F, 0x8470, 0x8472, 0x8474, 0x8477, 0x8479, 0x847B, 0x847C,
+    0x53D6, 0x5A36, 0x9F8B, 0x8DA3, 0x53BB, 0x5708, 0x98A7, 0x6743, 0x919B, 0x6CC9,
+    0x5168, 0x75CA, 0x62F3, 0x72AC, 0x5238, 0x529D, 0x7F3A, 0x7094, 0x7638, 0x5374,
+    0x9E4A, 0x69B7, 0x786E, 0x96C0, 0x88D9, 0x7FA4, 0x7136, 0x71C3, 0x5189, 0x67D3,
+    0x74E4, 0x58E4, 0x6518, 0x56B7, 0x8BA9, 0x9976, 0x6270, 0x7ED5, 0x60F9, 0x70ED,
+    0x58EC, 0x4EC1, 0x4EBA, 0x5FCD, 0x97E7, 0x4EFB, 0x8BA4, 0x5203, 0x598A, 0x7EAB,
+    0x6254, 0x4ECD, 0x65E5, 0x620E, 0x8338, 0x84C9, 0x8363, 0x878D, 0x7194, 0x6EB6,
+    0x5BB9, 0x7ED2, 0x5197, 0x63C9, 0x67D4, 0x8089, 0x8339, 0x8815, 0x5112, 0x5B7A,
+    0x5982, 0x8FB1, 0x4E73, 0x6C5D, 0x5165, 0x8925, 0x8F6F, 0x962E, 0x854A, 0x745E,
+    0x9510, 0x95F0, 0x6DA6, 0x82E5, 0x5F31, 0x6492, 0x6D12, 0x8428, 0x816E, 0x9CC3,
+    0x585E, 0x8D5B, 0x4E09, 0x53C1, 0x848A, 0x848D, 0x8498, 0x849A, 0x849B, 0x84B0,
+    0x84B1, 0x84B3, 0x84B5, 0x84B6, 0x84B7, 0x84BB, 0x84BC, 0x84BE, 0x84C0, 0x84C2,
+    0x84C3, 0x84CB, 0x84CC, 0x84CE, 0x84CF, 0x84D2, 0x84D4, 0x84D5, 0x84D7, 0x84DE,
+    0x84E1, 0x84E2, 0x84E4, 0x84ED, 0x84EE, 0x84EF, 0x84FD, 0x84FE, 0x8500, 0x8501,
+    0x8502, 0x4F1E, 0x6563, 0x6851, 0x55D3, 0x4E27, 0x6414, 0x9A9A, 0x626B, 0x5AC2,
+    0x745F, 0x8272, 0x6DA9, 0x68EE, 0x50E7, 0x838E, 0x7802, 0x6740, 0x5239, 0x6C99,
+    0x7EB1, 0x50BB, 0x5565, 0x715E, 0x7B5B, 0x6652, 0x73CA, 0x82EB, 0x6749, 0x5C71,
+    0x5220, 0x717D, 0x886B, 0x95EA, 0x9655, 0x64C5, 0x8D61, 0x81B3, 0x5584, 0x6C55,
+    0x6247, 0x7F2E, 0x5892, 0x4F24, 0x5546, 0x8D4F, 0x664C, 0x4E0A, 0x5C1A, 0x88F3,
+    0x68A2, 0x634E, 0x7A0D, 0x70E7, 0x828D, 0x52FA, 0x97F6, 0x5C11, 0x54E8, 0x90B5,
+    0x7ECD, 0x5962, 0x8D4A, 0x86C7, 0x820C, 0x820D, 0x8D66, 0x6444, 0x5C04, 0x6151,
+    0x6D89, 0x793E, 0x8BBE, 0x7837, 0x7533, 0x547B, 0x4F38, 0x8EAB, 0x6DF1, 0x5A20,
+    0x7EC5, 0x795E, 0x6C88, 0x5BA1, 0x5A76, 0x751A, 0x80BE, 0x614E, 0x6E17, 0x58F0,
+    0x751F, 0x7525, 0x7272, 0x5347, 0x7EF3, 0x8512, 0x8514, 0x8515, 0x8516, 0x8518,
+    0x8519, 0x8520, 0x8557, 0x8558, 0x8565, 0x8566, 0x8567, 0x8573, 0x857C, 0x857D,
+    0x857F, 0x8580, 0x8581, 0x7701, 0x76DB, 0x5269, 0x80DC, 0x5723, 0x5E08, 0x5931,
+    0x72EE, 0x65BD, 0x6E7F, 0x8BD7, 0x5C38, 0x8671, 0x5341, 0x77F3, 0x62FE, 0x65F6,
+    0x4EC0, 0x98DF, 0x8680, 0x5B9E, 0x8BC6, 0x53F2, 0x77E2, 0x4F7F, 0x5C4E, 0x9A76,
+    0x59CB, 0x5F0F, 0x793A, 0x58EB, 0x4E16, 0x67FF, 0x4E8B, 0x62ED, 0x8A93, 0x901D,
+    0x52BF, 0x662F, 0x55DC, 0x566C, 0x9002, 0x4ED5, 0x4F8D, 0x91CA, 0x9970, 0x6C0F,
+    0x5E02, 0x6043, 0x5BA4, 0x89C6, 0x8BD5, 0x6536, 0x624B, 0x9996, 0x5B88, 0x5BFF,
+    0x6388, 0x552E, 0x53D7, 0x7626, 0x517D, 0x852C, 0x67A2, 0x68B3, 0x6B8A, 0x6292,
+    0x8F93, 0x53D4, 0x8212, 0x6DD1, 0x758F, 0x4E66, 0x8D4E, 0x5B70, 0x719F, 0x85AF,
+    0x6691, 0x66D9, 0x7F72, 0x8700, 0x9ECD, 0x9F20, 0x5C5E, 0x672F, 0x8FF0, 0x6811,
+    0x675F, 0x620D, 0x7AD6, 0x5885, 0x5EB6, 0x6570, 0x6F31, 0x8582, 0x8583, 0x8586,
+    0x85A5, 0x85A6, 0x85A7, 0x85A9, 0x85AB, 0x85AC, 0x85AD, 0x85B8, 0x85D1, 0x85D2,
+    0x85D4, 0x6055, 0x5237, 0x800D, 0x6454, 0x8870, 0x7529, 0x5E05, 0x6813, 0x62F4,
+    0x971C, 0x53CC, 0x723D, 0x8C01, 0x6C34, 0x7761, 0x7A0E, 0x542E, 0x77AC, 0x987A,
+    0x821C, 0x8BF4, 0x7855, 0x6714, 0x70C1, 0x65AF, 0x6495, 0x5636, 0x601D, 0x79C1,
+    0x53F8, 0x4E1D, 0x6B7B, 0x8086, 0x5BFA, 0x55E3, 0x56DB, 0x4F3A, 0x4F3C, 0x9972,
+    0x5DF3, 0x677E, 0x8038, 0x6002, 0x9882, 0x9001, 0x5B8B, 0x8BBC, 0x8BF5, 0x641C,
+    0x8258, 0x64DE, 0x55FD, 0x82CF, 0x9165, 0x4FD7, 0x7D20, 0x901F, 0x7C9F, 0x50F3,
+    0x5851, 0x6EAF, 0x5BBF, 0x8BC9, 0x8083, 0x9178, 0x849C, 0x7B97, 0x867D, 0x968B,
+    0x968F, 0x7EE5, 0x9AD3, 0x788E, 0x5C81, 0x7A57, 0x9042, 0x96A7, 0x795F, 0x5B59,
+    0x635F, 0x7B0B, 0x84D1, 0x68AD, 0x5506, 0x7F29, 0x7410, 0x7D22, 0x9501, 0x6240,
+    0x584C, 0x4ED6, 0x5B83, 0x5979, 0x5854, 0x85F9, 0x85FA, 0x85FC, 0x85FD, 0x85FE,
+    0x8628, 0x8639, 0x863A, 0x863B, 0x8652, 0x8653, 0x865B, 0x865C, 0x865D, 0x865F,
+    0x8660, 0x8661, 0x736D, 0x631E, 0x8E4B, 0x8E0F, 0x80CE, 0x82D4, 0x62AC, 0x53F0,
+    0x6CF0, 0x915E, 0x592A, 0x6001, 0x6C70, 0x574D, 0x644A, 0x8D2A, 0x762B, 0x6EE9,
+    0x575B, 0x6A80, 0x75F0, 0x6F6D, 0x8C2D, 0x8C08, 0x5766, 0x6BEF, 0x8892, 0x78B3,
+    0x63A2, 0x53F9, 0x70AD, 0x6C64, 0x5858, 0x642A, 0x5802, 0x68E0, 0x819B, 0x5510,
+    0x7CD6, 0x5018, 0x8EBA, 0x6DCC, 0x8D9F, 0x70EB, 0x638F, 0x6D9B, 0x6ED4, 0x7EE6,
+    0x8404, 0x6843, 0x9003, 0x6DD8, 0x9676, 0x8BA8, 0x5957, 0x7279, 0x85E4, 0x817E,
+    0x75BC, 0x8A8A, 0x68AF, 0x5254, 0x8E22, 0x9511, 0x63D0, 0x9898, 0x8E44, 0x557C,
+    0x4F53, 0x66FF, 0x568F, 0x60D5, 0x6D95, 0x5243, 0x5C49, 0x5929, 0x6DFB, 0x586B,
+    0x7530, 0x751C, 0x606C, 0x8214, 0x8146, 0x6311, 0x6761, 0x8FE2, 0x773A, 0x8DF3,
+    0x8D34, 0x94C1, 0x5E16, 0x5385, 0x542C, 0x70C3, 0x866D, 0x866F, 0x8670, 0x8694,
+    0x86A5, 0x86A6, 0x86AB, 0x86AD, 0x86AE, 0x86B2, 0x86B3, 0x86B7, 0x86B8, 0x86B9,
+    0x86C1, 0x86C2, 0x86C3, 0x86C5, 0x86C8, 0x86CC, 0x86CD, 0x86D2, 0x86D3, 0x86D5,
+    0x86D6, 0x86D7, 0x86DA, 0x86DC, 0x86DD, 0x86EA, 0x86EB, 0x86EC, 0x86EF, 0x86F5,
+    0x86F6, 0x86F7, 0x86FF, 0x8701, 0x8704, 0x8705, 0x8706, 0x870B, 0x870C, 0x8714,
+    0x8716, 0x6C40, 0x5EF7, 0x505C, 0x4EAD, 0x5EAD, 0x633A, 0x8247, 0x901A, 0x6850,
+    0x916E, 0x77B3, 0x540C, 0x94DC, 0x5F64, 0x7AE5, 0x6876, 0x6345, 0x7B52, 0x7EDF,
+    0x75DB, 0x5077, 0x6295, 0x5934, 0x900F, 0x51F8, 0x79C3, 0x7A81, 0x56FE, 0x5F92,
+    0x9014, 0x6D82, 0x5C60, 0x571F, 0x5410, 0x5154, 0x6E4D, 0x56E2, 0x63A8, 0x9893,
+    0x817F, 0x8715, 0x892A, 0x9000, 0x541E, 0x5C6F, 0x81C0, 0x62D6, 0x6258, 0x8131,
+    0x9E35, 0x9640, 0x9A6E, 0x9A7C, 0x692D, 0x59A5, 0x62D3, 0x553E, 0x6316, 0x54C7,
+    0x86D9, 0x6D3C, 0x5A03, 0x74E6, 0x889C, 0x6B6A, 0x5916, 0x8C4C, 0x5F2F, 0x6E7E,
+    0x73A9, 0x987D, 0x4E38, 0x70F7, 0x5B8C, 0x7897, 0x633D, 0x665A, 0x7696, 0x60CB,
+    0x5B9B, 0x5A49, 0x4E07, 0x8155, 0x6C6A, 0x738B, 0x4EA1, 0x6789, 0x7F51, 0x5F80,
+    0x65FA, 0x671B, 0x5FD8, 0x5984, 0x5A01, 0x8719, 0x871B, 0x871D, 0x871F, 0x8720,
+    0x8724, 0x8726, 0x8727, 0x8728, 0x872F, 0x8730, 0x8732, 0x8733, 0x8735, 0x8736,
+    0x8738, 0x8739, 0x873A, 0x873C, 0x873D, 0x874A, 0x874B, 0x874D, 0x8754, 0x8755,
+    0x8756, 0x8758, 0x8761, 0x8762, 0x876F, 0x8771, 0x8772, 0x8773, 0x8775, 0x877F,
+    0x8780, 0x8781, 0x8784, 0x8786, 0x8787, 0x8789, 0x878A, 0x878C, 0x8794, 0x8795,
+    0x8796, 0x5DCD, 0x5FAE, 0x5371, 0x97E6, 0x8FDD, 0x6845, 0x56F4, 0x552F, 0x60DF,
+    0x4E3A, 0x6F4D, 0x7EF4, 0x82C7, 0x840E, 0x59D4, 0x4F1F, 0x4F2A, 0x5C3E, 0x7EAC,
+    0x672A, 0x851A, 0x5473, 0x754F, 0x80C3, 0x5582, 0x9B4F, 0x4F4D, 0x6E2D, 0x8C13,
+    0x5C09, 0x6170, 0x536B, 0x761F, 0x6E29, 0x868A, 0x6587, 0x95FB, 0x7EB9, 0x543B,
+    0x7A33, 0x7D0A, 0x95EE, 0x55E1, 0x7FC1, 0x74EE, 0x631D, 0x8717, 0x6DA1, 0x7A9D,
+    0x6211, 0x65A1, 0x5367, 0x63E1, 0x6C83, 0x5DEB, 0x545C, 0x94A8, 0x4E4C, 0x6C61,
+    0x8BEC, 0x5C4B, 0x65E0, 0x829C, 0x68A7, 0x543E, 0x5434, 0x6BCB, 0x6B66, 0x4E94,
+    0x6342, 0x5348, 0x821E, 0x4F0D, 0x4FAE, 0x575E, 0x620A, 0x96FE, 0x6664, 0x7269,
+    0x52FF, 0x52A1, 0x609F, 0x8BEF, 0x6614, 0x7199, 0x6790, 0x897F, 0x7852, 0x77FD,
+    0x6670, 0x563B, 0x5438, 0x9521, 0x727A, 0x87A5, 0x87A6, 0x87A7, 0x87A9, 0x87AA,
+    0x87AE, 0x87B0, 0x87B1, 0x87B2, 0x87B4, 0x87BB, 0x87BC, 0x87BE, 0x87BF, 0x87C7,
+    0x87C8, 0x87C9, 0x87EB, 0x87EC, 0x87ED, 0x8814, 0x8823, 0x7A00, 0x606F, 0x5E0C,
+    0x6089, 0x819D, 0x5915, 0x60DC, 0x7184, 0x70EF, 0x6EAA, 0x6C50, 0x7280, 0x6A84,
+    0x88AD, 0x5E2D, 0x4E60, 0x5AB3, 0x559C, 0x94E3, 0x6D17, 0x7CFB, 0x9699, 0x620F,
+    0x7EC6, 0x778E, 0x867E, 0x5323, 0x971E, 0x8F96, 0x6687, 0x5CE1, 0x4FA0, 0x72ED,
+    0x4E0B, 0x53A6, 0x590F, 0x5413, 0x6380, 0x9528, 0x5148, 0x4ED9, 0x9C9C, 0x7EA4,
+    0x54B8, 0x8D24, 0x8854, 0x8237, 0x95F2, 0x6D8E, 0x5F26, 0x5ACC, 0x663E, 0x9669,
+    0x73B0, 0x732E, 0x53BF, 0x817A, 0x9985, 0x7FA1, 0x5BAA, 0x9677, 0x9650, 0x7EBF,
+    0x76F8, 0x53A2, 0x9576, 0x9999, 0x7BB1, 0x8944, 0x6E58, 0x4E61, 0x7FD4, 0x7965,
+    0x8BE6, 0x60F3, 0x54CD, 0x4EAB, 0x9879, 0x5DF7, 0x6A61, 0x50CF, 0x5411, 0x8C61,
+    0x8427, 0x785D, 0x9704, 0x524A, 0x54EE, 0x56A3, 0x9500, 0x6D88, 0x5BB5, 0x6DC6,
+    0x6653, 0x883A, 0x883B, 0x883D, 0x883E, 0x883F, 0x8841, 0x8842, 0x8843, 0x8855,
+    0x8856, 0x8858, 0x8866, 0x8867, 0x886A, 0x886D, 0x886F, 0x8871, 0x8878, 0x8879,
+    0x887A, 0x887B, 0x887C, 0x8880, 0x8883, 0x8886, 0x8887, 0x8889, 0x888A, 0x888C,
+    0x8893, 0x8894, 0x8895, 0x88A3, 0x5C0F, 0x5B5D, 0x6821, 0x8096, 0x5578, 0x7B11,
+    0x6548, 0x6954, 0x4E9B, 0x6B47, 0x874E, 0x978B, 0x534F, 0x631F, 0x643A, 0x90AA,
+    0x659C, 0x80C1, 0x8C10, 0x5199, 0x68B0, 0x5378, 0x87F9, 0x61C8, 0x6CC4, 0x6CFB,
+    0x8C22, 0x5C51, 0x85AA, 0x82AF, 0x950C, 0x6B23, 0x8F9B, 0x65B0, 0x5FFB, 0x5FC3,
+    0x4FE1, 0x8845, 0x661F, 0x8165, 0x7329, 0x60FA, 0x5174, 0x5211, 0x578B, 0x5F62,
+    0x90A2, 0x884C, 0x9192, 0x5E78, 0x674F, 0x6027, 0x59D3, 0x5144, 0x51F6, 0x80F8,
+    0x5308, 0x6C79, 0x96C4, 0x718A, 0x4F11, 0x4FEE, 0x7F9E, 0x673D, 0x55C5, 0x9508,
+    0x79C0, 0x8896, 0x7EE3, 0x589F, 0x620C, 0x9700, 0x865A, 0x5618, 0x987B, 0x5F90,
+    0x8BB8, 0x84C4, 0x9157, 0x53D9, 0x65ED, 0x5E8F, 0x755C, 0x6064, 0x7D6E, 0x5A7F,
+    0x7EEA, 0x7EED, 0x8F69, 0x55A7, 0x5BA3, 0x60AC, 0x65CB, 0x7384, 0x88AC, 0x88AE,
+    0x88AF, 0x88B0, 0x88C3, 0x88C4, 0x88C7, 0x88C8, 0x88CF, 0x88D0, 0x88D1, 0x88D3,
+    0x88D6, 0x88D7, 0x88E0, 0x88E1, 0x88E6, 0x88E7, 0x88F2, 0x88F5, 0x88F6, 0x88F7,
+    0x88FA, 0x88FB, 0x88FD, 0x88FF, 0x8900, 0x8901, 0x8909, 0x8911, 0x8922, 0x8923,
+    0x8924, 0x8931, 0x8932, 0x8933, 0x8935, 0x8937, 0x9009, 0x7663, 0x7729, 0x7EDA,
+    0x9774, 0x859B, 0x5B66, 0x7A74, 0x96EA, 0x8840, 0x52CB, 0x718F, 0x5FAA, 0x65EC,
+    0x8BE2, 0x5BFB, 0x9A6F, 0x5DE1, 0x6B89, 0x6C5B, 0x8BAD, 0x8BAF, 0x900A, 0x8FC5,
+    0x538B, 0x62BC, 0x9E26, 0x9E2D, 0x5440, 0x4E2B, 0x82BD, 0x7259, 0x869C, 0x5D16,
+    0x8859, 0x6DAF, 0x96C5, 0x54D1, 0x4E9A, 0x8BB6, 0x7109, 0x54BD, 0x9609, 0x70DF,
+    0x6DF9, 0x76D0, 0x4E25, 0x7814, 0x8712, 0x5CA9, 0x5EF6, 0x8A00, 0x989C, 0x960E,
+    0x708E, 0x6CBF, 0x5944, 0x63A9, 0x773C, 0x884D, 0x6F14, 0x8273, 0x5830, 0x71D5,
+    0x538C, 0x781A, 0x96C1, 0x5501, 0x5F66, 0x7130, 0x5BB4, 0x8C1A, 0x9A8C, 0x6B83,
+    0x592E, 0x9E2F, 0x79E7, 0x6768, 0x626C, 0x4F6F, 0x75A1, 0x7F8A, 0x6D0B, 0x9633,
+    0x6C27, 0x4EF0, 0x75D2, 0x517B, 0x6837, 0x6F3E, 0x9080, 0x8170, 0x5996, 0x7476,
+    0x8942, 0x8943, 0x897C, 0x897D, 0x897E, 0x8980, 0x8982, 0x8984, 0x8985, 0x6447,
+    0x5C27, 0x9065, 0x7A91, 0x8C23, 0x59DA, 0x54AC, 0x8200, 0x836F, 0x8981, 0x8000,
+    0x6930, 0x564E, 0x8036, 0x7237, 0x91CE, 0x51B6, 0x4E5F, 0x9875, 0x6396, 0x4E1A,
+    0x53F6, 0x66F3, 0x814B, 0x591C, 0x6DB2, 0x4E00, 0x58F9, 0x533B, 0x63D6, 0x94F1,
+    0x4F9D, 0x4F0A, 0x8863, 0x9890, 0x5937, 0x9057, 0x79FB, 0x4EEA, 0x80F0, 0x7591,
+    0x6C82, 0x5B9C, 0x59E8, 0x5F5D, 0x6905, 0x8681, 0x501A, 0x5DF2, 0x4E59, 0x77E3,
+    0x4EE5, 0x827A, 0x6291, 0x6613, 0x9091, 0x5C79, 0x4EBF, 0x5F79, 0x81C6, 0x9038,
+    0x8084, 0x75AB, 0x4EA6, 0x88D4, 0x610F, 0x6BC5, 0x5FC6, 0x4E49, 0x76CA, 0x6EA2,
+    0x8BE3, 0x8BAE, 0x8C0A, 0x8BD1, 0x5F02, 0x7FFC, 0x7FCC, 0x7ECE, 0x8335, 0x836B,
+    0x56E0, 0x6BB7, 0x97F3, 0x9634, 0x59FB, 0x541F, 0x94F6, 0x6DEB, 0x5BC5, 0x996E,
+    0x5C39, 0x5F15, 0x9690, 0x89C3, 0x89CD, 0x89D3, 0x89D4, 0x89D5, 0x89D7, 0x89D8,
+    0x89D9, 0x89DB, 0x89DD, 0x89E4, 0x89EC, 0x89ED, 0x89EE, 0x89F0, 0x89F1, 0x89F2,
+    0x5370, 0x82F1, 0x6A31, 0x5A74, 0x9E70, 0x5E94, 0x7F28, 0x83B9, 0x8424, 0x8425,
+    0x8367, 0x8747, 0x8FCE, 0x8D62, 0x76C8, 0x5F71, 0x9896, 0x786C, 0x6620, 0x54DF,
+    0x62E5, 0x4F63, 0x81C3, 0x75C8, 0x5EB8, 0x96CD, 0x8E0A, 0x86F9, 0x548F, 0x6CF3,
+    0x6D8C, 0x6C38, 0x607F, 0x52C7, 0x7528, 0x5E7D, 0x4F18, 0x60A0, 0x5FE7, 0x5C24,
+    0x7531, 0x90AE, 0x94C0, 0x72B9, 0x6CB9, 0x6E38, 0x9149, 0x6709, 0x53CB, 0x53F3,
+    0x4F51, 0x91C9, 0x8BF1, 0x53C8, 0x5E7C, 0x8FC2, 0x6DE4, 0x4E8E, 0x76C2, 0x6986,
+    0x865E, 0x611A, 0x8206, 0x4F59, 0x4FDE, 0x903E, 0x9C7C, 0x6109, 0x6E1D, 0x6E14,
+    0x9685, 0x4E88, 0x5A31, 0x96E8, 0x4E0E, 0x5C7F, 0x79B9, 0x5B87, 0x8BED, 0x7FBD,
+    0x7389, 0x57DF, 0x828B, 0x90C1, 0x5401, 0x9047, 0x55BB, 0x5CEA, 0x5FA1, 0x6108,
+    0x6B32, 0x72F1, 0x80B2, 0x8A89, 0x6D74, 0x5BD3, 0x88D5, 0x9884, 0x8C6B, 0x9A6D,
+    0x9E33, 0x6E0A, 0x51A4, 0x5143, 0x57A3, 0x8881, 0x539F, 0x63F4, 0x8F95, 0x56ED,
+    0x5458, 0x5706, 0x733F, 0x6E90, 0x7F18, 0x8FDC, 0x82D1, 0x613F, 0x6028, 0x9662,
+    0x66F0, 0x7EA6, 0x8D8A, 0x8DC3, 0x94A5, 0x5CB3, 0x7CA4, 0x6708, 0x60A6, 0x9605,
+    0x8018, 0x4E91, 0x90E7, 0x5300, 0x9668, 0x5141, 0x8FD0, 0x8574, 0x915D, 0x6655,
+    0x97F5, 0x5B55, 0x531D, 0x7838, 0x6742, 0x683D, 0x54C9, 0x707E, 0x5BB0, 0x8F7D,
+    0x518D, 0x5728, 0x54B1, 0x6512, 0x6682, 0x8D5E, 0x8D43, 0x810F, 0x846C, 0x906D,
+    0x7CDF, 0x51FF, 0x85FB, 0x67A3, 0x65E9, 0x6FA1, 0x86A4, 0x8E81, 0x566A, 0x9020,
+    0x7682, 0x7076, 0x71E5, 0x8D23, 0x62E9, 0x5219, 0x6CFD, 0x8D3C, 0x600E, 0x589E,
+    0x618E, 0x66FE, 0x8D60, 0x624E, 0x55B3, 0x6E23, 0x672D, 0x8F67, 0x94E1, 0x95F8,
+    0x7728, 0x6805, 0x69A8, 0x548B, 0x4E4D, 0x70B8, 0x8BC8, 0x6458, 0x658B, 0x5B85,
+    0x7A84, 0x503A, 0x5BE8, 0x77BB, 0x6BE1, 0x8A79, 0x7C98, 0x6CBE, 0x76CF, 0x65A9,
+    0x8F97, 0x5D2D, 0x5C55, 0x8638, 0x6808, 0x5360, 0x6218, 0x7AD9, 0x6E5B, 0x7EFD,
+    0x6A1F, 0x7AE0, 0x5F70, 0x6F33, 0x5F20, 0x638C, 0x6DA8, 0x6756, 0x4E08, 0x5E10,
+    0x8D26, 0x4ED7, 0x80C0, 0x7634, 0x969C, 0x62DB, 0x662D, 0x627E, 0x6CBC, 0x8D75,
+    0x7167, 0x7F69, 0x5146, 0x8087, 0x53EC, 0x906E, 0x6298, 0x54F2, 0x86F0, 0x8F99,
+    0x8005, 0x9517, 0x8517, 0x8FD9, 0x6D59, 0x73CD, 0x659F, 0x771F, 0x7504, 0x7827,
+    0x81FB, 0x8D1E, 0x9488, 0x4FA6, 0x6795, 0x75B9, 0x8BCA, 0x9707, 0x632F, 0x9547,
+    0x9635, 0x84B8, 0x6323, 0x7741, 0x5F81, 0x72F0, 0x4E89, 0x6014, 0x6574, 0x62EF,
+    0x6B63, 0x653F, 0x8B24, 0x8B25, 0x5E27, 0x75C7, 0x90D1, 0x8BC1, 0x829D, 0x679D,
+    0x652F, 0x5431, 0x8718, 0x77E5, 0x80A2, 0x8102, 0x6C41, 0x4E4B, 0x7EC7, 0x804C,
+    0x76F4, 0x690D, 0x6B96, 0x6267, 0x503C, 0x4F84, 0x5740, 0x6307, 0x6B62, 0x8DBE,
+    0x53EA, 0x65E8, 0x7EB8, 0x5FD7, 0x631A, 0x63B7, 0x81F3, 0x81F4, 0x7F6E, 0x5E1C,
+    0x5CD9, 0x5236, 0x667A, 0x79E9, 0x7A1A, 0x8D28, 0x7099, 0x75D4, 0x6EDE, 0x6CBB,
+    0x7A92, 0x4E2D, 0x76C5, 0x5FE0, 0x949F, 0x8877, 0x7EC8, 0x79CD, 0x80BF, 0x91CD,
+    0x4EF2, 0x4F17, 0x821F, 0x5468, 0x5DDE, 0x6D32, 0x8BCC, 0x7CA5, 0x8F74, 0x8098,
+    0x5E1A, 0x5492, 0x76B1, 0x5B99, 0x663C, 0x9AA4, 0x73E0, 0x682A, 0x86DB, 0x6731,
+    0x732A, 0x8BF8, 0x8BDB, 0x9010, 0x7AF9, 0x70DB, 0x716E, 0x62C4, 0x77A9, 0x5631,
+    0x4E3B, 0x8457, 0x67F1, 0x52A9, 0x86C0, 0x8D2E, 0x94F8, 0x7B51, 0x8BAC, 0x8BB1,
+    0x8BBB, 0x8BC7, 0x8BD0, 0x8BEA, 0x8C09, 0x8C1E, 0x4F4F, 0x6CE8, 0x795D, 0x9A7B,
+    0x6293, 0x722A, 0x62FD, 0x4E13, 0x7816, 0x8F6C, 0x64B0, 0x8D5A, 0x7BC6, 0x6869,
+    0x5E84, 0x88C5, 0x5986, 0x649E, 0x58EE, 0x72B6, 0x690E, 0x9525, 0x8FFD, 0x8D58,
+    0x5760, 0x7F00, 0x8C06, 0x51C6, 0x6349, 0x62D9, 0x5353, 0x684C, 0x7422, 0x8301,
+    0x914C, 0x5544, 0x7740, 0x707C, 0x6D4A, 0x5179, 0x54A8, 0x8D44, 0x59FF, 0x6ECB,
+    0x6DC4, 0x5B5C, 0x7D2B, 0x4ED4, 0x7C7D, 0x6ED3, 0x5B50, 0x81EA, 0x6E0D, 0x5B57,
+    0x9B03, 0x68D5, 0x8E2A, 0x5B97, 0x7EFC, 0x603B, 0x7EB5, 0x90B9, 0x8D70, 0x594F,
+    0x63CD, 0x79DF, 0x8DB3, 0x5352, 0x65CF, 0x7956, 0x8BC5, 0x963B, 0x7EC4, 0x94BB,
+    0x7E82, 0x5634, 0x9189, 0x6700, 0x7F6A, 0x5C0A, 0x9075, 0x6628, 0x5DE6, 0x4F50,
+    0x67DE, 0x505A, 0x4F5C, 0x5750, 0x5EA7, 0x8C48, 0x8C4A, 0x8C4B, 0x8C83, 0x8C84,
+    0x8C86, 0x8C87, 0x8C88, 0x8C8B, 0x8C95, 0x8C96, 0x8C97, 0x4E8D, 0x4E0C, 0x5140,
+    0x4E10, 0x5EFF, 0x5345, 0x4E15, 0x4E98, 0x4E1E, 0x9B32, 0x5B6C, 0x5669, 0x4E28,
+    0x79BA, 0x4E3F, 0x5315, 0x4E47, 0x592D, 0x723B, 0x536E, 0x6C10, 0x56DF, 0x80E4,
+    0x9997, 0x6BD3, 0x777E, 0x9F17, 0x4E36, 0x4E9F, 0x9F10, 0x4E5C, 0x4E69, 0x4E93,
+    0x8288, 0x5B5B, 0x556C, 0x560F, 0x4EC4, 0x538D, 0x539D, 0x53A3, 0x53A5, 0x53AE,
+    0x9765, 0x8D5D, 0x531A, 0x53F5, 0x5326, 0x532E, 0x533E, 0x8D5C, 0x5366, 0x5363,
+    0x5202, 0x5208, 0x520E, 0x522D, 0x5233, 0x523F, 0x5240, 0x524C, 0x525E, 0x5261,
+    0x525C, 0x84AF, 0x527D, 0x5282, 0x5281, 0x5290, 0x5293, 0x5182, 0x7F54, 0x4EBB,
+    0x4EC3, 0x4EC9, 0x4EC2, 0x4EE8, 0x4EE1, 0x4EEB, 0x4EDE, 0x4F1B, 0x4EF3, 0x4F22,
+    0x4F64, 0x4EF5, 0x4F25, 0x4F27, 0x4F09, 0x4F2B, 0x4F5E, 0x4F67, 0x6538, 0x4F5A,
+    0x4F5D, 0x4F5F, 0x4F57, 0x4F32, 0x4F3D, 0x4F76, 0x4F74, 0x4F91, 0x4F89, 0x4F83,
+    0x4F8F, 0x4F7E, 0x4F7B, 0x4FAA, 0x4F7C, 0x4FAC, 0x4F94, 0x4FE6, 0x4FE8, 0x4FEA,
+    0x4FC5, 0x4FDA, 0x4FE3, 0x4FDC, 0x4FD1, 0x4FDF, 0x4FF8, 0x5029, 0x504C, 0x4FF3,
+    0x502C, 0x500F, 0x502E, 0x502D, 0x4FFE, 0x501C, 0x500C, 0x5025, 0x5028, 0x507E,
+    0x5043, 0x5055, 0x5048, 0x504E, 0x506C, 0x507B, 0x50A5, 0x50A7, 0x50A9, 0x50BA,
+    0x50D6, 0x5106, 0x50ED, 0x50EC, 0x50E6, 0x50EE, 0x5107, 0x510B, 0x4EDD, 0x6C3D,
+    0x4F58, 0x4F65, 0x4FCE, 0x9FA0, 0x6C46, 0x7C74, 0x516E, 0x5DFD, 0x9EC9, 0x9998,
+    0x5181, 0x5914, 0x52F9, 0x530D, 0x8A07, 0x5310, 0x51EB, 0x5919, 0x5155, 0x4EA0,
+    0x5156, 0x4EB3, 0x886E, 0x88A4, 0x4EB5, 0x8114, 0x88D2, 0x7980, 0x5B34, 0x8803,
+    0x7FB8, 0x51AB, 0x51B1, 0x51BD, 0x51BC, 0x8D20, 0x8D51, 0x8D52, 0x8D57, 0x8D5F,
+    0x8D65, 0x8D68, 0x8D69, 0x8D6A, 0x8D6C, 0x8D6E, 0x8D6F, 0x8D71, 0x8D72, 0x8D82,
+    0x8D83, 0x8D92, 0x8D93, 0x8DA0, 0x8DA1, 0x8DA2, 0x8DB2, 0x8DB6, 0x8DB7, 0x8DB9,
+    0x8DBB, 0x8DBD, 0x8DC0, 0x8DC1, 0x8DC2, 0x8DC5, 0x8DCD, 0x8DD0, 0x8DD2, 0x8DD3,
+    0x8DD4, 0x51C7, 0x5196, 0x51A2, 0x51A5, 0x8BA0, 0x8BA6, 0x8BA7, 0x8BAA, 0x8BB4,
+    0x8BB5, 0x8BB7, 0x8BC2, 0x8BC3, 0x8BCB, 0x8BCF, 0x8BCE, 0x8BD2, 0x8BD3, 0x8BD4,
+    0x8BD6, 0x8BD8, 0x8BD9, 0x8BDC, 0x8BDF, 0x8BE0, 0x8BE4, 0x8BE8, 0x8BE9, 0x8BEE,
+    0x8BF0, 0x8BF3, 0x8BF6, 0x8BF9, 0x8BFC, 0x8BFF, 0x8C00, 0x8C02, 0x8C04, 0x8C07,
+    0x8C0C, 0x8C0F, 0x8C11, 0x8C12, 0x8C14, 0x8C15, 0x8C16, 0x8C19, 0x8C1B, 0x8C18,
+    0x8C1D, 0x8C1F, 0x8C20, 0x8C21, 0x8C25, 0x8C27, 0x8C2A, 0x8C2B, 0x8C2E, 0x8C2F,
+    0x8C32, 0x8C33, 0x8C35, 0x8C36, 0x5369, 0x537A, 0x961D, 0x9622, 0x9621, 0x9631,
+    0x962A, 0x963D, 0x963C, 0x9642, 0x9649, 0x9654, 0x965F, 0x9667, 0x966C, 0x9672,
+    0x9674, 0x9688, 0x968D, 0x9697, 0x96B0, 0x9097, 0x909B, 0x909D, 0x9099, 0x90AC,
+    0x90A1, 0x90B4, 0x90B3, 0x90B6, 0x90BA, 0x8DD5, 0x8DD8, 0x8DD9, 0x8DDC, 0x8DE0,
+    0x8DE1, 0x8DE2, 0x8DE5, 0x8DE6, 0x8DE7, 0x8DE9, 0x8DED, 0x8DEE, 0x8DF0, 0x8DF1,
+    0x8DF2, 0x8DF4, 0x8DF6, 0x8DFC, 0x8E06, 0x8E07, 0x8E08, 0x8E0B, 0x8E0D, 0x8E0E,
+    0x8E20, 0x8E21, 0x8E2B, 0x8E2D, 0x8E30, 0x8E32, 0x8E33, 0x8E34, 0x8E36, 0x8E37,
+    0x8E38, 0x8E3B, 0x8E3C, 0x8E3E, 0x8E3F, 0x8E43, 0x8E45, 0x8E46, 0x8E67, 0x8E68,
+    0x8E6A, 0x8E6B, 0x8E6E, 0x8E71, 0x90B8, 0x90B0, 0x90CF, 0x90C5, 0x90BE, 0x90D0,
+    0x90C4, 0x90C7, 0x90D3, 0x90E6, 0x90E2, 0x90DC, 0x90D7, 0x90DB, 0x90EB, 0x90EF,
+    0x90FE, 0x9104, 0x9122, 0x911E, 0x9123, 0x9131, 0x912F, 0x9139, 0x9143, 0x9146,
+    0x520D, 0x5942, 0x52A2, 0x52AC, 0x52AD, 0x52BE, 0x54FF, 0x52D0, 0x52D6, 0x52F0,
+    0x53DF, 0x71EE, 0x77CD, 0x5EF4, 0x51F5, 0x51FC, 0x9B2F, 0x53B6, 0x5F01, 0x755A,
+    0x5DEF, 0x574C, 0x57A9, 0x57A1, 0x587E, 0x58BC, 0x58C5, 0x58D1, 0x5729, 0x572C,
+    0x572A, 0x5733, 0x5739, 0x572E, 0x572F, 0x575C, 0x573B, 0x5742, 0x5769, 0x5785,
+    0x576B, 0x5786, 0x577C, 0x577B, 0x5768, 0x576D, 0x5776, 0x5773, 0x57AD, 0x57A4,
+    0x578C, 0x57B2, 0x57CF, 0x57A7, 0x57B4, 0x5793, 0x57A0, 0x57D5, 0x57D8, 0x57DA,
+    0x57D9, 0x57D2, 0x57B8, 0x57F4, 0x57EF, 0x57F8, 0x57E4, 0x57DD, 0x8E73, 0x8E75,
+    0x8E7D, 0x8E7E, 0x8E80, 0x8E82, 0x8E83, 0x8E84, 0x8E86, 0x8E91, 0x8E92, 0x8E93,
+    0x8E9D, 0x8EAD, 0x8EAE, 0x8EB0, 0x8EB1, 0x580B, 0x580D, 0x57FD, 0x57ED, 0x5800,
+    0x581E, 0x5819, 0x5844, 0x5820, 0x5865, 0x586C, 0x5881, 0x5889, 0x589A, 0x5880,
+    0x99A8, 0x9F19, 0x61FF, 0x8279, 0x827D, 0x827F, 0x828F, 0x828A, 0x82A8, 0x8284,
+    0x828E, 0x8291, 0x8297, 0x8299, 0x82AB, 0x82B8, 0x82BE, 0x82B0, 0x82C8, 0x82CA,
+    0x82E3, 0x8298, 0x82B7, 0x82AE, 0x82CB, 0x82CC, 0x82C1, 0x82A9, 0x82B4, 0x82A1,
+    0x82AA, 0x829F, 0x82C4, 0x82CE, 0x82A4, 0x82E1, 0x8309, 0x82F7, 0x82E4, 0x830F,
+    0x8307, 0x82DC, 0x82F4, 0x82D2, 0x82D8, 0x830C, 0x82FB, 0x82D3, 0x8311, 0x831A,
+    0x8306, 0x8314, 0x8315, 0x82E0, 0x82D5, 0x831C, 0x8351, 0x835B, 0x835C, 0x8308,
+    0x8392, 0x833C, 0x8334, 0x8331, 0x839B, 0x835E, 0x832F, 0x834F, 0x8347, 0x8343,
+    0x835F, 0x8340, 0x8317, 0x8360, 0x832D, 0x833A, 0x8333, 0x8366, 0x8365, 0x8368,
+    0x831B, 0x8369, 0x836C, 0x836A, 0x836D, 0x836E, 0x83B0, 0x8378, 0x83B3, 0x83B4,
+    0x83A0, 0x83AA, 0x8393, 0x839C, 0x8385, 0x837C, 0x83B6, 0x83A9, 0x837D, 0x83B8,
+    0x837B, 0x8398, 0x839E, 0x83A8, 0x83BA, 0x83BC, 0x83C1, 0x8401, 0x83E5, 0x83D8,
+    0x5807, 0x8418, 0x840B, 0x83DD, 0x83FD, 0x83D6, 0x841C, 0x8438, 0x8411, 0x8406,
+    0x83D4, 0x83DF, 0x840F, 0x8403, 0x83F8, 0x83F9, 0x83EA, 0x83C5, 0x83C0, 0x8426,
+    0x83F0, 0x83E1, 0x845C, 0x8451, 0x845A, 0x8459, 0x8473, 0x8487, 0x8488, 0x847A,
+    0x8489, 0x8478, 0x843C, 0x8446, 0x8469, 0x8476, 0x848C, 0x848E, 0x8431, 0x846D,
+    0x84C1, 0x84CD, 0x84D0, 0x84E6, 0x84BD, 0x84D3, 0x84CA, 0x84BF, 0x84BA, 0x84E0,
+    0x84A1, 0x84B9, 0x84B4, 0x8497, 0x84E5, 0x84E3, 0x850C, 0x750D, 0x8538, 0x84F0,
+    0x8539, 0x851F, 0x853A, 0x8F6A, 0x8F80, 0x8F8C, 0x8F92, 0x8F9D, 0x8FA0, 0x8FA1,
+    0x8FA2, 0x8FAA, 0x8FB7, 0x8FB8, 0x8FBA, 0x8FBB, 0x8FBC, 0x8FBF, 0x8FC0, 0x8FC3,
+    0x8FC6, 0x8FCF, 0x8FD2, 0x8FD6, 0x8FD7, 0x8FDA, 0x8FE0, 0x8FE1, 0x8FE3, 0x8FE7,
+    0x8FEC, 0x8FEF, 0x8FF1, 0x8FF2, 0x8FF4, 0x8FF5, 0x8FF6, 0x8FFA, 0x8FFB, 0x8FFC,
+    0x8FFE, 0x8FFF, 0x9007, 0x9008, 0x900C, 0x900E, 0x9013, 0x9015, 0x9018, 0x8556,
+    0x853B, 0x84FF, 0x84FC, 0x8559, 0x8548, 0x8568, 0x8564, 0x855E, 0x857A, 0x77A2,
+    0x8543, 0x8572, 0x857B, 0x85A4, 0x85A8, 0x8587, 0x858F, 0x8579, 0x85AE, 0x859C,
+    0x8585, 0x85B9, 0x85B7, 0x85B0, 0x85D3, 0x85C1, 0x85DC, 0x85FF, 0x8627, 0x8605,
+    0x8629, 0x8616, 0x863C, 0x5EFE, 0x5F08, 0x593C, 0x5941, 0x8037, 0x5955, 0x595A,
+    0x5958, 0x530F, 0x5C22, 0x5C25, 0x5C2C, 0x5C34, 0x624C, 0x626A, 0x629F, 0x62BB,
+    0x62CA, 0x62DA, 0x62D7, 0x62EE, 0x6322, 0x62F6, 0x6339, 0x634B, 0x6343, 0x63AD,
+    0x63F6, 0x6371, 0x637A, 0x638E, 0x63B4, 0x636D, 0x63AC, 0x638A, 0x6369, 0x63AE,
+    0x63BC, 0x63F2, 0x63F8, 0x63E0, 0x63FF, 0x63C4, 0x63DE, 0x63CE, 0x6452, 0x63C6,
+    0x63BE, 0x6445, 0x6441, 0x640B, 0x641B, 0x6420, 0x640C, 0x6426, 0x6421, 0x645E,
+    0x6484, 0x646D, 0x6496, 0x9019, 0x901C, 0x9023, 0x9024, 0x9025, 0x9037, 0x9039,
+    0x903A, 0x903D, 0x903F, 0x9040, 0x9043, 0x9045, 0x9046, 0x904E, 0x9054, 0x9055,
+    0x9056, 0x9059, 0x905A, 0x9064, 0x9066, 0x9067, 0x907E, 0x9081, 0x9089, 0x908A,
+    0x9092, 0x9094, 0x9096, 0x9098, 0x909A, 0x909C, 0x909E, 0x909F, 0x90A0, 0x90A4,
+    0x90A5, 0x90A7, 0x90A8, 0x90A9, 0x90AB, 0x90AD, 0x90B2, 0x90B7, 0x90BC, 0x90BD,
+    0x90BF, 0x90C0, 0x647A, 0x64B7, 0x64B8, 0x6499, 0x64BA, 0x64C0, 0x64D0, 0x64D7,
+    0x64E4, 0x64E2, 0x6509, 0x6525, 0x652E, 0x5F0B, 0x5FD2, 0x7519, 0x5F11, 0x535F,
+    0x53F1, 0x53FD, 0x53E9, 0x53E8, 0x53FB, 0x5412, 0x5416, 0x5406, 0x544B, 0x5452,
+    0x5453, 0x5454, 0x5456, 0x5443, 0x5421, 0x5457, 0x5459, 0x5423, 0x5432, 0x5482,
+    0x5494, 0x5477, 0x5471, 0x5464, 0x549A, 0x549B, 0x5484, 0x5476, 0x5466, 0x549D,
+    0x54D0, 0x54AD, 0x54C2, 0x54B4, 0x54D2, 0x54A7, 0x54A6, 0x54D3, 0x54D4, 0x5472,
+    0x54A3, 0x54D5, 0x54BB, 0x54BF, 0x54CC, 0x54D9, 0x54DA, 0x54DC, 0x54A9, 0x54AA,
+    0x54A4, 0x54DD, 0x54CF, 0x54DE, 0x551B, 0x54E7, 0x5520, 0x54FD, 0x5514, 0x54F3,
+    0x5522, 0x5523, 0x550F, 0x5511, 0x5527, 0x552A, 0x5567, 0x558F, 0x55B5, 0x5549,
+    0x556D, 0x5541, 0x5555, 0x553F, 0x5550, 0x553C, 0x90C2, 0x90C3, 0x90C6, 0x90C8,
+    0x90C9, 0x90CB, 0x90CC, 0x90CD, 0x90D2, 0x90D4, 0x90D5, 0x90D6, 0x90D8, 0x90D9,
+    0x90DA, 0x90DE, 0x90DF, 0x90E0, 0x90E3, 0x90E4, 0x90E5, 0x90E9, 0x90EA, 0x90EC,
+    0x90EE, 0x90F5, 0x90F6, 0x90F7, 0x90FF, 0x9100, 0x9101, 0x9103, 0x911A, 0x911B,
+    0x911C, 0x911D, 0x911F, 0x9120, 0x9121, 0x9130, 0x9144, 0x5537, 0x5556, 0x5575,
+    0x5576, 0x5577, 0x5533, 0x5530, 0x555C, 0x558B, 0x55D2, 0x5583, 0x55B1, 0x55B9,
+    0x5588, 0x5581, 0x559F, 0x557E, 0x55D6, 0x5591, 0x557B, 0x55DF, 0x55BD, 0x55BE,
+    0x5594, 0x5599, 0x55EA, 0x55F7, 0x55C9, 0x561F, 0x55D1, 0x55EB, 0x55EC, 0x55D4,
+    0x55E6, 0x55DD, 0x55C4, 0x55EF, 0x55E5, 0x55F2, 0x55F3, 0x55CC, 0x55CD, 0x55E8,
+    0x55F5, 0x55E4, 0x8F94, 0x561E, 0x5608, 0x560C, 0x5601, 0x5624, 0x5623, 0x55FE,
+    0x5600, 0x5627, 0x562D, 0x5658, 0x5639, 0x5657, 0x562C, 0x564D, 0x5662, 0x5659,
+    0x565C, 0x564C, 0x5654, 0x5686, 0x5664, 0x5671, 0x566B, 0x567B, 0x567C, 0x5685,
+    0x5693, 0x56AF, 0x56D4, 0x56D7, 0x56DD, 0x56E1, 0x56F5, 0x56EB, 0x56F9, 0x56FF,
+    0x5704, 0x570A, 0x5709, 0x571C, 0x5E0F, 0x5E19, 0x5E14, 0x5E11, 0x5E31, 0x5E3B,
+    0x5E3C, 0x9145, 0x9147, 0x9148, 0x9151, 0x9158, 0x9159, 0x915B, 0x915C, 0x915F,
+    0x9160, 0x9166, 0x9167, 0x9168, 0x916B, 0x916D, 0x9173, 0x917A, 0x917B, 0x917C,
+    0x9186, 0x9188, 0x918A, 0x918E, 0x918F, 0x91AB, 0x91AC, 0x91BB, 0x91C8, 0x91CB,
+    0x91D0, 0x5E37, 0x5E44, 0x5E54, 0x5E5B, 0x5E5E, 0x5E61, 0x5C8C, 0x5C7A, 0x5C8D,
+    0x5C90, 0x5C96, 0x5C88, 0x5C98, 0x5C99, 0x5C91, 0x5C9A, 0x5C9C, 0x5CB5, 0x5CA2,
+    0x5CBD, 0x5CAC, 0x5CAB, 0x5CB1, 0x5CA3, 0x5CC1, 0x5CB7, 0x5CC4, 0x5CD2, 0x5CE4,
+    0x5CCB, 0x5CE5, 0x5D02, 0x5D03, 0x5D27, 0x5D26, 0x5D2E, 0x5D24, 0x5D1E, 0x5D06,
+    0x5D1B, 0x5D58, 0x5D3E, 0x5D34, 0x5D3D, 0x5D6C, 0x5D5B, 0x5D6F, 0x5D5D, 0x5D6B,
+    0x5D4B, 0x5D4A, 0x5D69, 0x5D74, 0x5D82, 0x5D99, 0x5D9D, 0x8C73, 0x5DB7, 0x5DC5,
+    0x5F73, 0x5F77, 0x5F82, 0x5F87, 0x5F89, 0x5F8C, 0x5F95, 0x5F99, 0x5F9C, 0x5FA8,
+    0x5FAD, 0x5FB5, 0x5FBC, 0x8862, 0x5F61, 0x72AD, 0x72B0, 0x72B4, 0x72B7, 0x72B8,
+    0x72C3, 0x72C1, 0x72CE, 0x72CD, 0x72D2, 0x72E8, 0x72EF, 0x72E9, 0x72F2, 0x72F4,
+    0x72F7, 0x7301, 0x72F3, 0x7303, 0x72FA, 0x72FB, 0x7317, 0x7313, 0x7321, 0x730A,
+    0x731E, 0x731D, 0x7315, 0x7322, 0x7339, 0x7325, 0x732C, 0x7338, 0x7331, 0x7350,
+    0x734D, 0x7357, 0x7360, 0x736C, 0x736F, 0x737E, 0x821B, 0x5925, 0x98E7, 0x5924,
+    0x5902, 0x9963, 0x9974, 0x9977, 0x997D, 0x9980, 0x9984, 0x9987, 0x998A, 0x998D,
+    0x9990, 0x9991, 0x9993, 0x9994, 0x9995, 0x5E80, 0x5E91, 0x5E8B, 0x5E96, 0x5EA5,
+    0x5EA0, 0x5EB9, 0x5EB5, 0x5EBE, 0x5EB3, 0x8D53, 0x5ED2, 0x5ED1, 0x5EDB, 0x5EE8,
+    0x5EEA, 0x81BA, 0x5FC4, 0x5FC9, 0x5FD6, 0x5FCF, 0x6003, 0x5FEE, 0x6004, 0x5FE1,
+    0x5FE4, 0x5FFE, 0x6005, 0x6006, 0x5FEA, 0x5FED, 0x5FF8, 0x6019, 0x6035, 0x6026,
+    0x601B, 0x600F, 0x600D, 0x6029, 0x602B, 0x600A, 0x603F, 0x6021, 0x6078, 0x6079,
+    0x607B, 0x607A, 0x6042, 0x606A, 0x607D, 0x6096, 0x609A, 0x60AD, 0x609D, 0x6083,
+    0x6092, 0x608C, 0x609B, 0x60EC, 0x60BB, 0x60B1, 0x60DD, 0x60D8, 0x60C6, 0x60DA,
+    0x60B4, 0x6120, 0x6126, 0x6115, 0x6123, 0x60F4, 0x6100, 0x610E, 0x612B, 0x614A,
+    0x6175, 0x61AC, 0x6194, 0x61A7, 0x61B7, 0x61D4, 0x61F5, 0x5FDD, 0x96B3, 0x95E9,
+    0x95EB, 0x95F1, 0x95F3, 0x95F5, 0x95F6, 0x95FC, 0x95FE, 0x9603, 0x9604, 0x9606,
+    0x9608, 0x960F, 0x9612, 0x9615, 0x9616, 0x9617, 0x9619, 0x961A, 0x4E2C, 0x723F,
+    0x6215, 0x6C35, 0x6C54, 0x6C5C, 0x6C4A, 0x6CA3, 0x6C85, 0x6C90, 0x6C94, 0x6C8C,
+    0x6C68, 0x6C69, 0x6C74, 0x6C76, 0x6C86, 0x6CA9, 0x6CD0, 0x6CD4, 0x6CAD, 0x6CF7,
+    0x6CF8, 0x6CF1, 0x6CD7, 0x6CB2, 0x6CE0, 0x6CD6, 0x6CFA, 0x6CEB, 0x6CEE, 0x6CB1,
+    0x6CD3, 0x6CEF, 0x6CFE, 0x6D39, 0x6D27, 0x6D0C, 0x6D43, 0x6D48, 0x6D07, 0x6D04,
+    0x6D19, 0x6D0E, 0x6D2B, 0x6D4D, 0x6D2E, 0x6D35, 0x6D1A, 0x6D4F, 0x6D52, 0x6D54,
+    0x6D33, 0x6D91, 0x6D6F, 0x6D9E, 0x6DA0, 0x6D5E, 0x6D93, 0x6D94, 0x6D5C, 0x6D60,
+    0x6D7C, 0x6D63, 0x6E1A, 0x6DC7, 0x6DC5, 0x6DDE, 0x6E0E, 0x6DBF, 0x6DE0, 0x6E11,
+    0x6DE6, 0x6DDD, 0x6DD9, 0x6E16, 0x6DAB, 0x6E0C, 0x6DAE, 0x6E2B, 0x6E6E, 0x6E4E,
+    0x6E6B, 0x6EB2, 0x6E5F, 0x6E86, 0x6E53, 0x6E54, 0x6E32, 0x6E25, 0x6E44, 0x6EDF,
+    0x6EB1, 0x6E98, 0x6EE0, 0x6F2D, 0x6EE2, 0x6EA5, 0x6EA7, 0x6EBD, 0x6EBB, 0x6EB7,
+    0x6ED7, 0x6EB4, 0x6ECF, 0x6E8F, 0x6EC2, 0x6E9F, 0x6F62, 0x6F46, 0x6F47, 0x6F24,
+    0x6F15, 0x6EF9, 0x6F2F, 0x6F36, 0x6F4B, 0x6F74, 0x6F2A, 0x6F09, 0x6F29, 0x6F89,
+    0x6F8D, 0x6F8C, 0x6F78, 0x6F72, 0x6F7C, 0x6F7A, 0x6FD1, 0x936B, 0x6FC9, 0x6FA7,
+    0x6FB9, 0x6FB6, 0x6FC2, 0x6FE1, 0x6FEE, 0x6FDE, 0x6FE0, 0x6FEF, 0x701A, 0x7023,
+    0x701B, 0x7039, 0x7035, 0x704F, 0x705E, 0x5B80, 0x5B84, 0x5B95, 0x5B93, 0x5BA5,
+    0x5BB8, 0x752F, 0x9A9E, 0x6434, 0x5BE4, 0x5BEE, 0x8930, 0x5BF0, 0x8E47, 0x8B07,
+    0x8FB6, 0x8FD3, 0x8FD5, 0x8FE5, 0x8FEE, 0x8FE4, 0x8FE9, 0x8FE6, 0x8FF3, 0x8FE8,
+    0x9005, 0x9004, 0x900B, 0x9026, 0x9011, 0x900D, 0x9016, 0x9021, 0x9035, 0x9036,
+    0x902D, 0x902F, 0x9044, 0x9051, 0x9052, 0x9050, 0x9068, 0x9058, 0x9062, 0x905B,
+    0x66B9, 0x9074, 0x907D, 0x9082, 0x9088, 0x9083, 0x908B, 0x5F50, 0x5F57, 0x5F56,
+    0x5F58, 0x5C3B, 0x54AB, 0x5C50, 0x5C59, 0x5B71, 0x5C63, 0x5C66, 0x7FBC, 0x5F2A,
+    0x5F29, 0x5F2D, 0x8274, 0x5F3C, 0x9B3B, 0x5C6E, 0x5981, 0x5983, 0x598D, 0x59A9,
+    0x59AA, 0x59A3, 0x93CB, 0x93CC, 0x93CD, 0x5997, 0x59CA, 0x59AB, 0x599E, 0x59A4,
+    0x59D2, 0x59B2, 0x59AF, 0x59D7, 0x59BE, 0x5A05, 0x5A06, 0x59DD, 0x5A08, 0x59E3,
+    0x59D8, 0x59F9, 0x5A0C, 0x5A09, 0x5A32, 0x5A34, 0x5A11, 0x5A23, 0x5A13, 0x5A40,
+    0x5A67, 0x5A4A, 0x5A55, 0x5A3C, 0x5A62, 0x5A75, 0x80EC, 0x5AAA, 0x5A9B, 0x5A77,
+    0x5A7A, 0x5ABE, 0x5AEB, 0x5AB2, 0x5AD2, 0x5AD4, 0x5AB8, 0x5AE0, 0x5AE3, 0x5AF1,
+    0x5AD6, 0x5AE6, 0x5AD8, 0x5ADC, 0x5B09, 0x5B17, 0x5B16, 0x5B32, 0x5B37, 0x5B40,
+    0x5C15, 0x5C1C, 0x5B5A, 0x5B65, 0x5B73, 0x5B51, 0x5B53, 0x5B62, 0x9A75, 0x9A77,
+    0x9A78, 0x9A7A, 0x9A7F, 0x9A7D, 0x9A80, 0x9A81, 0x9A85, 0x9A88, 0x9A8A, 0x9A90,
+    0x9A92, 0x9A93, 0x9A96, 0x9A98, 0x9A9B, 0x9A9C, 0x9A9D, 0x9A9F, 0x9AA0, 0x9AA2,
+    0x9AA3, 0x9AA5, 0x9AA7, 0x7E9F, 0x7EA1, 0x7EA3, 0x7EA5, 0x7EA8, 0x7EA9, 0x7EAD,
+    0x7EB0, 0x7EBE, 0x7EC0, 0x7EC1, 0x7EC2, 0x7EC9, 0x7ECB, 0x7ECC, 0x7ED0, 0x7ED4,
+    0x7ED7, 0x7EDB, 0x7EE0, 0x7EE1, 0x7EE8, 0x7EEB, 0x7EEE, 0x7EEF, 0x7EF1, 0x7EF2,
+    0x7F0D, 0x7EF6, 0x7EFA, 0x7EFB, 0x7EFE, 0x7F01, 0x7F02, 0x7F03, 0x7F07, 0x7F08,
+    0x7F0B, 0x7F0C, 0x7F0F, 0x7F11, 0x7F12, 0x7F17, 0x7F19, 0x7F1C, 0x7F1B, 0x7F1F,
+    0x7F35, 0x5E7A, 0x757F, 0x5DDB, 0x753E, 0x9095, 0x738E, 0x7391, 0x73AE, 0x73A2,
+    0x739F, 0x73CF, 0x73C2, 0x73D1, 0x73B7, 0x73B3, 0x73C0, 0x73C9, 0x73C8, 0x73E5,
+    0x73D9, 0x987C, 0x740A, 0x73E9, 0x73E7, 0x73DE, 0x73BA, 0x73F2, 0x740F, 0x742A,
+    0x745B, 0x7426, 0x7425, 0x7428, 0x7430, 0x742E, 0x742C, 0x9491, 0x9496, 0x9498,
+    0x94C7, 0x94CF, 0x94D3, 0x94D4, 0x94DA, 0x94E6, 0x94FB, 0x951C, 0x9520, 0x741B,
+    0x741A, 0x7441, 0x745C, 0x7457, 0x7455, 0x7459, 0x7477, 0x746D, 0x747E, 0x749C,
+    0x748E, 0x7480, 0x7481, 0x7487, 0x748B, 0x749E, 0x74A8, 0x74A9, 0x7490, 0x74A7,
+    0x74D2, 0x74BA, 0x97EA, 0x97EB, 0x97EC, 0x674C, 0x6753, 0x675E, 0x6748, 0x6769,
+    0x67A5, 0x6787, 0x676A, 0x6773, 0x6798, 0x67A7, 0x6775, 0x67A8, 0x679E, 0x67AD,
+    0x678B, 0x6777, 0x677C, 0x67F0, 0x6809, 0x67D8, 0x680A, 0x67E9, 0x67B0, 0x680C,
+    0x67D9, 0x67B5, 0x67DA, 0x67B3, 0x67DD, 0x6800, 0x67C3, 0x67B8, 0x67E2, 0x680E,
+    0x67C1, 0x67FD, 0x6832, 0x6833, 0x6860, 0x6861, 0x684E, 0x6862, 0x6844, 0x6864,
+    0x6883, 0x681D, 0x6855, 0x6866, 0x6841, 0x6867, 0x6840, 0x683E, 0x684A, 0x6849,
+    0x6829, 0x68B5, 0x688F, 0x6874, 0x6877, 0x6893, 0x686B, 0x68C2, 0x696E, 0x68FC,
+    0x691F, 0x6920, 0x68F9, 0x9527, 0x9533, 0x953D, 0x9543, 0x9548, 0x954B, 0x9555,
+    0x955A, 0x9560, 0x956E, 0x9574, 0x9575, 0x6924, 0x68F0, 0x690B, 0x6901, 0x6957,
+    0x68E3, 0x6910, 0x6971, 0x6939, 0x6960, 0x6942, 0x695D, 0x6984, 0x696B, 0x6980,
+    0x6998, 0x6978, 0x6934, 0x69CC, 0x6987, 0x6988, 0x69CE, 0x6989, 0x6966, 0x6963,
+    0x6979, 0x699B, 0x69A7, 0x69BB, 0x69AB, 0x69AD, 0x69D4, 0x69B1, 0x69C1, 0x69CA,
+    0x69DF, 0x6995, 0x69E0, 0x698D, 0x69FF, 0x6A2F, 0x69ED, 0x6A17, 0x6A18, 0x6A65,
+    0x69F2, 0x6A44, 0x6A3E, 0x6AA0, 0x6A50, 0x6A5B, 0x6A35, 0x6A8E, 0x6A79, 0x6A3D,
+    0x6A28, 0x6A58, 0x6A7C, 0x6A91, 0x6A90, 0x6AA9, 0x6A97, 0x6AAB, 0x7337, 0x7352,
+    0x6B81, 0x6B82, 0x6B87, 0x6B84, 0x6B92, 0x6B93, 0x6B8D, 0x6B9A, 0x6B9B, 0x6BA1,
+    0x6BAA, 0x8F6B, 0x8F6D, 0x8F71, 0x8F72, 0x8F73, 0x8F75, 0x8F76, 0x8F78, 0x8F77,
+    0x8F79, 0x8F7A, 0x8F7C, 0x8F7E, 0x8F81, 0x8F82, 0x8F84, 0x8F87, 0x8F8B, 0x95EC,
+    0x95FF, 0x9607, 0x9613, 0x9618, 0x961B, 0x961E, 0x9620, 0x962B, 0x962C, 0x962D,
+    0x962F, 0x9630, 0x963E, 0x9641, 0x9643, 0x964A, 0x964E, 0x964F, 0x9651, 0x9652,
+    0x9653, 0x9656, 0x9657, 0x9658, 0x9659, 0x965A, 0x965C, 0x965D, 0x965E, 0x9660,
+    0x9663, 0x9665, 0x9666, 0x966B, 0x9673, 0x9687, 0x9689, 0x968A, 0x8F8D, 0x8F8E,
+    0x8F8F, 0x8F98, 0x8F9A, 0x8ECE, 0x620B, 0x6217, 0x621B, 0x621F, 0x6222, 0x6221,
+    0x6225, 0x6224, 0x622C, 0x81E7, 0x74EF, 0x74F4, 0x74FF, 0x750F, 0x7511, 0x7513,
+    0x6534, 0x65EE, 0x65EF, 0x65F0, 0x660A, 0x6619, 0x6772, 0x6603, 0x6615, 0x6600,
+    0x7085, 0x66F7, 0x661D, 0x6634, 0x6631, 0x6636, 0x6635, 0x8006, 0x665F, 0x6654,
+    0x6641, 0x664F, 0x6656, 0x6661, 0x6657, 0x6677, 0x6684, 0x668C, 0x66A7, 0x669D,
+    0x66BE, 0x66DB, 0x66DC, 0x66E6, 0x66E9, 0x8D32, 0x8D33, 0x8D36, 0x8D3B, 0x8D3D,
+    0x8D40, 0x8D45, 0x8D46, 0x8D48, 0x8D49, 0x8D47, 0x8D4D, 0x8D55, 0x8D59, 0x89C7,
+    0x89CA, 0x89CB, 0x89CC, 0x726E, 0x729F, 0x725D, 0x7266, 0x726F, 0x727E, 0x727F,
+    0x7284, 0x728B, 0x728D, 0x728F, 0x7292, 0x6308, 0x6332, 0x63B0, 0x968C, 0x968E,
+    0x9691, 0x9692, 0x9693, 0x9695, 0x9696, 0x969A, 0x969B, 0x96B1, 0x96B2, 0x96B4,
+    0x96B5, 0x96B7, 0x96B8, 0x96BA, 0x96BB, 0x96BF, 0x96C2, 0x96C3, 0x96C8, 0x96CA,
+    0x96CB, 0x96D0, 0x96D1, 0x96D3, 0x96D4, 0x96EB, 0x96EC, 0x96ED, 0x96EE, 0x96F0,
+    0x96F1, 0x96F2, 0x96F4, 0x96F5, 0x96F8, 0x96FF, 0x9702, 0x9703, 0x9705, 0x970A,
+    0x970B, 0x970C, 0x9710, 0x9711, 0x9712, 0x9714, 0x9715, 0x971D, 0x971F, 0x9720,
+    0x643F, 0x64D8, 0x8004, 0x6BEA, 0x6BF3, 0x6BFD, 0x6BF5, 0x6BF9, 0x6C05, 0x6C07,
+    0x6C06, 0x6C0D, 0x6C15, 0x6C18, 0x6C19, 0x6C1A, 0x6C21, 0x6C29, 0x6C24, 0x6C2A,
+    0x6C32, 0x6535, 0x6555, 0x656B, 0x724D, 0x7252, 0x7256, 0x7230, 0x8662, 0x5216,
+    0x809F, 0x809C, 0x8093, 0x80BC, 0x670A, 0x80BD, 0x80B1, 0x80AB, 0x80AD, 0x80B4,
+    0x80B7, 0x80DB, 0x80C2, 0x80C4, 0x80D9, 0x80CD, 0x80D7, 0x6710, 0x80DD, 0x80EB,
+    0x80F1, 0x80F4, 0x80ED, 0x810D, 0x810E, 0x80F2, 0x80FC, 0x6715, 0x8112, 0x8C5A,
+    0x8136, 0x811E, 0x812C, 0x8118, 0x8132, 0x8148, 0x814C, 0x8153, 0x8174, 0x8159,
+    0x815A, 0x8171, 0x8160, 0x8169, 0x817C, 0x817D, 0x816D, 0x8167, 0x584D, 0x5AB5,
+    0x8188, 0x8182, 0x8191, 0x6ED5, 0x81A3, 0x81AA, 0x81CC, 0x6726, 0x81CA, 0x81BB,
+    0x972B, 0x972C, 0x972E, 0x972F, 0x9731, 0x9754, 0x9755, 0x9757, 0x9758, 0x975A,
+    0x975C, 0x975D, 0x975F, 0x9763, 0x9764, 0x9766, 0x9767, 0x9768, 0x9772, 0x9775,
+    0x978C, 0x978E, 0x978F, 0x9790, 0x9793, 0x9795, 0x9796, 0x9797, 0x81C1, 0x81A6,
+    0x6B24, 0x6B37, 0x6B39, 0x6B43, 0x6B46, 0x6B59, 0x98D1, 0x98D2, 0x98D3, 0x98D5,
+    0x98D9, 0x98DA, 0x6BB3, 0x5F40, 0x6BC2, 0x89F3, 0x6590, 0x9F51, 0x6593, 0x65BC,
+    0x65C6, 0x65C4, 0x65C3, 0x65CC, 0x65CE, 0x65D2, 0x65D6, 0x7080, 0x709C, 0x7096,
+    0x709D, 0x70BB, 0x70C0, 0x70B7, 0x70AB, 0x70B1, 0x70E8, 0x70CA, 0x7110, 0x7113,
+    0x7116, 0x712F, 0x7131, 0x7173, 0x715C, 0x7168, 0x7145, 0x7172, 0x714A, 0x7178,
+    0x717A, 0x7198, 0x71B3, 0x71B5, 0x71A8, 0x71A0, 0x71E0, 0x71D4, 0x71E7, 0x71F9,
+    0x721D, 0x7228, 0x706C, 0x7118, 0x7166, 0x71B9, 0x623E, 0x623D, 0x6243, 0x6248,
+    0x6249, 0x793B, 0x7940, 0x7946, 0x7949, 0x795B, 0x795C, 0x7953, 0x795A, 0x7962,
+    0x7957, 0x7960, 0x796F, 0x7967, 0x797A, 0x7985, 0x798A, 0x799A, 0x79A7, 0x79B3,
+    0x5FD1, 0x5FD0, 0x979E, 0x979F, 0x97A1, 0x97A2, 0x97AC, 0x97AE, 0x97B0, 0x97B1,
+    0x97B3, 0x97E4, 0x97E5, 0x97E8, 0x97F4, 0x603C, 0x605D, 0x605A, 0x6067, 0x6041,
+    0x6059, 0x6063, 0x60AB, 0x6106, 0x610D, 0x615D, 0x61A9, 0x619D, 0x61CB, 0x61D1,
+    0x6206, 0x8080, 0x807F, 0x6C93, 0x6CF6, 0x6DFC, 0x77F6, 0x77F8, 0x7800, 0x7809,
+    0x7817, 0x7818, 0x7811, 0x65AB, 0x782D, 0x781C, 0x781D, 0x7839, 0x783A, 0x783B,
+    0x781F, 0x783C, 0x7825, 0x782C, 0x7823, 0x7829, 0x784E, 0x786D, 0x7856, 0x7857,
+    0x7826, 0x7850, 0x7847, 0x784C, 0x786A, 0x789B, 0x7893, 0x789A, 0x7887, 0x789C,
+    0x78A1, 0x78A3, 0x78B2, 0x78B9, 0x78A5, 0x78D4, 0x78D9, 0x78C9, 0x78EC, 0x78F2,
+    0x7905, 0x78F4, 0x7913, 0x7924, 0x791E, 0x7934, 0x9F9B, 0x9EF9, 0x9EFB, 0x9EFC,
+    0x76F1, 0x7704, 0x770D, 0x76F9, 0x7707, 0x7708, 0x771A, 0x7722, 0x7719, 0x772D,
+    0x7726, 0x7735, 0x7738, 0x7750, 0x7751, 0x7747, 0x7743, 0x775A, 0x7768, 0x7762,
+    0x7765, 0x777F, 0x778D, 0x777D, 0x7780, 0x778C, 0x7791, 0x779F, 0x77A0, 0x77B0,
+    0x77B5, 0x77BD, 0x753A, 0x7540, 0x754E, 0x754B, 0x7548, 0x755B, 0x7572, 0x7579,
+    0x7583, 0x7F58, 0x7F61, 0x7F5F, 0x8A48, 0x7F68, 0x7F74, 0x7F71, 0x7F79, 0x7F81,
+    0x7F7E, 0x76CD, 0x76E5, 0x8832, 0x9485, 0x9486, 0x9487, 0x948B, 0x948A, 0x948C,
+    0x948D, 0x948F, 0x9490, 0x9494, 0x9497, 0x9495, 0x949A, 0x949B, 0x949C, 0x94A3,
+    0x94A4, 0x94AB, 0x94AA, 0x94AD, 0x94AC, 0x94AF, 0x94B0, 0x94B2, 0x94B4, 0x94BC,
+    0x94BD, 0x94BF, 0x94C4, 0x94D0, 0x94D1, 0x94D2, 0x94D5, 0x94D6, 0x94D7, 0x94D9,
+    0x94D8, 0x94DB, 0x94DE, 0x94DF, 0x94E0, 0x94E2, 0x94E4, 0x94E5, 0x94E7, 0x94E8,
+    0x94EA, 0x988B, 0x988E, 0x9892, 0x9895, 0x9899, 0x98A3, 0x98CF, 0x98D0, 0x98D4,
+    0x98D6, 0x98D7, 0x98DB, 0x98DC, 0x98DD, 0x98E5, 0x98E6, 0x94E9, 0x94EB, 0x94EE,
+    0x94EF, 0x94F3, 0x94F4, 0x94F5, 0x94F7, 0x94F9, 0x94FC, 0x94FD, 0x94FF, 0x9503,
+    0x9502, 0x9506, 0x9507, 0x9509, 0x950A, 0x950D, 0x950E, 0x950F, 0x9518, 0x951B,
+    0x951D, 0x951E, 0x951F, 0x9522, 0x952A, 0x952B, 0x9529, 0x952C, 0x9531, 0x9532,
+    0x9534, 0x9536, 0x9537, 0x9538, 0x953C, 0x953E, 0x953F, 0x9542, 0x9535, 0x9544,
+    0x9545, 0x9546, 0x9549, 0x954C, 0x954E, 0x954F, 0x9552, 0x9553, 0x9554, 0x955B,
+    0x955E, 0x955F, 0x955D, 0x9561, 0x9562, 0x956F, 0x9571, 0x9572, 0x9573, 0x953A,
+    0x77E7, 0x77EC, 0x96C9, 0x79D5, 0x79ED, 0x79E3, 0x79EB, 0x7A06, 0x5D47, 0x7A03,
+    0x7A02, 0x7A1E, 0x7A14, 0x990E, 0x990F, 0x9964, 0x9966, 0x9973, 0x9978, 0x9979,
+    0x997B, 0x997E, 0x9982, 0x9983, 0x9989, 0x7A39, 0x7A37, 0x7A51, 0x9ECF, 0x99A5,
+    0x7A70, 0x7688, 0x768E, 0x7693, 0x7699, 0x76A4, 0x74DE, 0x74E0, 0x752C, 0x9E20,
+    0x9E22, 0x9E32, 0x9E31, 0x9E36, 0x9E38, 0x9E37, 0x9E39, 0x9E3A, 0x9E3E, 0x9E41,
+    0x9E42, 0x9E44, 0x9E4B, 0x9E4C, 0x9E4E, 0x9E51, 0x9E55, 0x9E57, 0x9E5A, 0x9E5B,
+    0x9E5C, 0x9E5E, 0x9E63, 0x9E71, 0x9E6D, 0x9E73, 0x7592, 0x7594, 0x7596, 0x75A0,
+    0x759D, 0x75AC, 0x75A3, 0x75B3, 0x75B4, 0x75B8, 0x75C4, 0x75B1, 0x75B0, 0x75C3,
+    0x75C2, 0x75D6, 0x75CD, 0x75E3, 0x75E8, 0x75E6, 0x75E4, 0x75EB, 0x75E7, 0x7603,
+    0x75F1, 0x75FC, 0x75FF, 0x7610, 0x7600, 0x7605, 0x760C, 0x7617, 0x760A, 0x7625,
+    0x7618, 0x7615, 0x7619, 0x998C, 0x998E, 0x99A6, 0x99A7, 0x761B, 0x763C, 0x7622,
+    0x7620, 0x7640, 0x762D, 0x7630, 0x763F, 0x7635, 0x7643, 0x763E, 0x7633, 0x764D,
+    0x765E, 0x7654, 0x765C, 0x7656, 0x766B, 0x766F, 0x7FCA, 0x7AE6, 0x7A78, 0x7A79,
+    0x7A80, 0x7A86, 0x7A88, 0x7A95, 0x7AA6, 0x7AA0, 0x7AAC, 0x7AA8, 0x7AAD, 0x7AB3,
+    0x8864, 0x8869, 0x8872, 0x887D, 0x887F, 0x8882, 0x88A2, 0x88C6, 0x88B7, 0x88BC,
+    0x88C9, 0x88E2, 0x88CE, 0x88E3, 0x88E5, 0x88F1, 0x891A, 0x88FC, 0x88E8, 0x88FE,
+    0x88F0, 0x8921, 0x8919, 0x8913, 0x891B, 0x890A, 0x8934, 0x892B, 0x8936, 0x8941,
+    0x8966, 0x897B, 0x758B, 0x80E5, 0x76B2, 0x76B4, 0x77DC, 0x8012, 0x8014, 0x8016,
+    0x801C, 0x8020, 0x8022, 0x8025, 0x8026, 0x8027, 0x8029, 0x8028, 0x8031, 0x800B,
+    0x8035, 0x8043, 0x8046, 0x804D, 0x8052, 0x8069, 0x8071, 0x8983, 0x9878, 0x9880,
+    0x9883, 0x9889, 0x988C, 0x988D, 0x988F, 0x9894, 0x989A, 0x989B, 0x989E, 0x989F,
+    0x98A1, 0x98A2, 0x98A5, 0x98A6, 0x864D, 0x8654, 0x866C, 0x866E, 0x867F, 0x867A,
+    0x867C, 0x867B, 0x86A8, 0x868D, 0x868B, 0x86AC, 0x869D, 0x86A7, 0x86A3, 0x86AA,
+    0x8693, 0x86A9, 0x86B6, 0x86C4, 0x86B5, 0x86CE, 0x86B0, 0x86BA, 0x86B1, 0x86AF,
+    0x86C9, 0x86CF, 0x86B4, 0x86E9, 0x86F1, 0x86F2, 0x86ED, 0x86F3, 0x86D0, 0x8713,
+    0x86DE, 0x86F4, 0x86DF, 0x86D8, 0x86D1, 0x8703, 0x8707, 0x86F8, 0x8708, 0x870A,
+    0x870D, 0x8709, 0x8723, 0x873B, 0x871E, 0x8725, 0x872E, 0x871A, 0x873E, 0x8748,
+    0x8734, 0x8731, 0x8729, 0x8737, 0x873F, 0x8782, 0x8722, 0x877D, 0x877E, 0x877B,
+    0x8760, 0x8770, 0x874C, 0x876E, 0x878B, 0x8753, 0x8763, 0x877C, 0x8764, 0x8759,
+    0x8765, 0x8793, 0x87AF, 0x87A8, 0x87D2, 0x9A72, 0x9A83, 0x9A89, 0x9A8D, 0x9A8E,
+    0x9A94, 0x9A95, 0x9A99, 0x9AA6, 0x9AB9, 0x9ABB, 0x9ABD, 0x9ABE, 0x9ABF, 0x9AC3,
+    0x9AC4, 0x9AD2, 0x9ADD, 0x9ADE, 0x9AE0, 0x9AEC, 0x9AEE, 0x9AFA, 0x9B04, 0x9B05,
+    0x9B06, 0x87C6, 0x8788, 0x8785, 0x87AD, 0x8797, 0x8783, 0x87AB, 0x87E5, 0x87AC,
+    0x87B5, 0x87B3, 0x87CB, 0x87D3, 0x87BD, 0x87D1, 0x87C0, 0x87CA, 0x87DB, 0x87EA,
+    0x87E0, 0x87EE, 0x8816, 0x8813, 0x87FE, 0x880A, 0x881B, 0x8821, 0x8839, 0x883C,
+    0x7F36, 0x7F42, 0x7F44, 0x7F45, 0x8210, 0x7AFA, 0x7AFD, 0x7B08, 0x7B03, 0x7B04,
+    0x7B15, 0x7B0A, 0x7B2B, 0x7B0F, 0x7B47, 0x7B38, 0x7B2A, 0x7B19, 0x7B2E, 0x7B31,
+    0x7B20, 0x7B25, 0x7B24, 0x7B33, 0x7B3E, 0x7B1E, 0x7B58, 0x7B5A, 0x7B45, 0x7B75,
+    0x7B4C, 0x7B5D, 0x7B60, 0x7B6E, 0x7B7B, 0x7B62, 0x7B72, 0x7B71, 0x7B90, 0x7BA6,
+    0x7BA7, 0x7BB8, 0x7BAC, 0x7B9D, 0x7BA8, 0x7B85, 0x7BAA, 0x7B9C, 0x7BA2, 0x7BAB,
+    0x7BB4, 0x7BD1, 0x7BC1, 0x7BCC, 0x7BDD, 0x7BDA, 0x7BE5, 0x7BE6, 0x7BEA, 0x7C0C,
+    0x7BFE, 0x7BFC, 0x7C0F, 0x7C16, 0x7C0B, 0x9B07, 0x9B10, 0x9B11, 0x9B12, 0x9B20,
+    0x9B21, 0x9B22, 0x9B30, 0x9B31, 0x9B46, 0x9B4A, 0x9B4B, 0x9B4C, 0x9B4E, 0x9B50,
+    0x9B52, 0x9B53, 0x7C1F, 0x7C2A, 0x7C26, 0x7C38, 0x7C41, 0x7C40, 0x81FE, 0x8201,
+    0x8202, 0x8204, 0x81EC, 0x8844, 0x8221, 0x8222, 0x8223, 0x822D, 0x822F, 0x8228,
+    0x822B, 0x8238, 0x823B, 0x8233, 0x8234, 0x823E, 0x8244, 0x8249, 0x824B, 0x824F,
+    0x825A, 0x825F, 0x8268, 0x887E, 0x8885, 0x8888, 0x88D8, 0x88DF, 0x895E, 0x7F9D,
+    0x7F9F, 0x7FA7, 0x7FAF, 0x7FB0, 0x7FB2, 0x7C7C, 0x6549, 0x7C91, 0x7C9D, 0x7C9C,
+    0x7C9E, 0x7CA2, 0x7CB2, 0x7CBC, 0x7CBD, 0x7CC1, 0x7CC7, 0x7CCC, 0x7CCD, 0x7CC8,
+    0x7CC5, 0x7CD7, 0x7CE8, 0x826E, 0x66A8, 0x7FBF, 0x7FCE, 0x7FD5, 0x7FE5, 0x7FE1,
+    0x7FE6, 0x7FE9, 0x7FEE, 0x7FF3, 0x7CF8, 0x7D77, 0x7DA6, 0x7DAE, 0x7E47, 0x7E9B,
+    0x9EB8, 0x9EB4, 0x8D73, 0x8D84, 0x8D94, 0x8D91, 0x8DB1, 0x8D67, 0x8D6D, 0x8C47,
+    0x8C49, 0x914A, 0x9150, 0x914E, 0x914F, 0x9164, 0x9162, 0x9161, 0x9170, 0x9169,
+    0x916F, 0x917D, 0x917E, 0x9172, 0x9174, 0x9179, 0x918C, 0x9185, 0x9190, 0x918D,
+    0x9191, 0x91A2, 0x91A3, 0x91AA, 0x91AD, 0x91AE, 0x91AF, 0x91B5, 0x91B4, 0x91BA,
+    0x8C55, 0x9E7E, 0x8DB8, 0x8DEB, 0x8E05, 0x8E59, 0x8E69, 0x8DB5, 0x8DBF, 0x8DBC,
+    0x8DBA, 0x8DC4, 0x8DD6, 0x8DD7, 0x8DDA, 0x8DDE, 0x8DCE, 0x8DCF, 0x8DDB, 0x8DC6,
+    0x8DEC, 0x8DF7, 0x8DF8, 0x8DE3, 0x8DF9, 0x8DFB, 0x8DE4, 0x8E09, 0x8DFD, 0x8E14,
+    0x8E1D, 0x8E1F, 0x8E2C, 0x8E2E, 0x8E23, 0x8E2F, 0x8E3A, 0x8E40, 0x8E39, 0x8E35,
+    0x8E3D, 0x8E31, 0x8E49, 0x8E41, 0x8E42, 0x8E51, 0x8E52, 0x8E4A, 0x8E70, 0x8E76,
+    0x8E7C, 0x8E6F, 0x8E74, 0x8E85, 0x8E8F, 0x8E94, 0x8E90, 0x8E9C, 0x8E9E, 0x8C78,
+    0x8C82, 0x8C8A, 0x8C85, 0x8C98, 0x8C94, 0x659B, 0x89D6, 0x89DE, 0x89DA, 0x89DC,
+    0x89E5, 0x89EB, 0x89EF, 0x8A3E, 0x8B26, 0x9753, 0x96E9, 0x96F3, 0x96EF, 0x9706,
+    0x9701, 0x9708, 0x970F, 0x970E, 0x972A, 0x972D, 0x9730, 0x973E, 0x9F80, 0x9F83,
+    0x9F8C, 0x9EFE, 0x9F0B, 0x9F0D, 0x96B9, 0x96BC, 0x96BD, 0x96CE, 0x96D2, 0x77BF,
+    0x96E0, 0x928E, 0x92AE, 0x92C8, 0x933E, 0x936A, 0x93CA, 0x938F, 0x943E, 0x946B,
+    0x9C7F, 0x9C82, 0x7A23, 0x9C8B, 0x9C8E, 0x9C90, 0x9C91, 0x9C92, 0x9C94, 0x9C95,
+    0x9C9A, 0x9C9B, 0x9CAB, 0x9CAD, 0x9CAE, 0x9CCA, 0x9CCB, 0x9C7B, 0x9C7D, 0x9C7E,
+    0x9C80, 0x9C83, 0x9C84, 0x9C89, 0x9C8A, 0x9C8C, 0x9C8F, 0x9C93, 0x9C9D, 0x9CAA,
+    0x9CAC, 0x9CAF, 0x9CB9, 0x9CC8, 0x9CC9, 0x9CD1, 0x9CD2, 0x9CDA, 0x9CDB, 0x9CE0,
+    0x9CE1, 0x9CD3, 0x9CD4, 0x9CD5, 0x9CD7, 0x9CD8, 0x9CD9, 0x9CDC, 0x9CDD, 0x9CDF,
+    0x9CE2, 0x977C, 0x9785, 0x9791, 0x9792, 0x9794, 0x97AF, 0x97AB, 0x97A3, 0x97B2,
+    0x97B4, 0x9AB1, 0x9AB0, 0x9AB7, 0x9E58, 0x9AB6, 0x9ABA, 0x9ABC, 0x9AC1, 0x9AC0,
+    0x9AC5, 0x9AC2, 0x9ACB, 0x9ACC, 0x9AD1, 0x9B45, 0x9B43, 0x9B47, 0x9B49, 0x9B48,
+    0x9B4D, 0x9B51, 0x98E8, 0x990D, 0x992E, 0x9955, 0x9954, 0x9ADF, 0x9AE1, 0x9AE6,
+    0x9AEF, 0x9AEB, 0x9AFB, 0x9AED, 0x9AF9, 0x9B08, 0x9B0F, 0x9B13, 0x9B1F, 0x9B23,
+    0x9EBD, 0x9EBE, 0x7E3B, 0x9E82, 0x9E87, 0x9E88, 0x9E8B, 0x9E92, 0x93D6, 0x9E9D,
+    0x9E9F, 0x9EDB, 0x9EDC, 0x9EDD, 0x9EE0, 0x9EDF, 0x9EE2, 0x9EE9, 0x9EE7, 0x9EE5,
+    0x9EEA, 0x9EEF, 0x9F22, 0x9F2C, 0x9F2F, 0x9F39, 0x9F37, 0x9F3D, 0x9F3E, 0x9F44,
+    0x9E24, 0x9E27, 0x9E2E, 0x9E30, 0x9E34, 0x9E3B, 0x9E3C, 0x9E40, 0x9E4D, 0x9E50,
+    0x9E52, 0x9E53, 0x9E54, 0x9E56, 0x9E59, 0x9E5D, 0x9E65, 0x9E6E, 0x9E6F, 0x9E72,
+    0x9E80, 0x9E81, 0x9E89, 0x9E8A, 0x9E9E, 0x9EB5, 0x9EB6, 0x9EB7, 0x9EB9, 0x9EBA,
+    0x9EBC, 0x9ECA, 0x9ECB, 0x9ECC, 0x9ED0, 0x9ED2, 0x9ED3, 0x9ED5, 0x9ED6, 0x9ED7,
+    0x9ED9, 0x9EDA, 0x9EDE, 0x9EE1, 0x9EE3, 0x9EE4, 0x9EE6, 0x9EE8, 0x9EFA, 0x9EFD,
+    0x9F0C, 0x9F0F, 0x9F11, 0x9F12, 0x9F14, 0x9F15, 0x9F16, 0x9F18, 0x9F21, 0x9F2D,
+    0x9F2E, 0x9F30, 0x9F31, 0x9F38, 0x9F3A, 0x9F3C, 0x9F81, 0x9F82, 0x9F9C, 0x9F9D,
+    0x9F9E, 0xF92C, 0xF979, 0xF995, 0xF9E7, 0xF9F1, 0xFA11, 0xFA13, 0xFA14, 0xFA18,
+    0xFA1F, 0xFA20, 0xFA21, 0xFA23, 0xFA24, 0xFA27, 0xFA28, 0xFA29, 0x2E81, 0xE816,
+    0xE817, 0xE818, 0x2E84, 0x3473, 0x3447, 0x2E88, 0x2E8B, 0xE81E, 0x359E, 0x361A,
+    0x360E, 0x2E8C, 0x2E97, 0x396E, 0x3918, 0xE826, 0x39CF, 0x39DF, 0x3A73, 0x39D0,
+    0xE82B, 0xE82C, 0x3B4E, 0x3C6E, 0x3CE0, 0x2EA7, 0xE831, 0xE832, 0x2EAA, 0x4056,
+    0x415F, 0x2EAE, 0x4337, 0x2EB3, 0x2EB6, 0x2EB7, 0xE83B, 0x43B1, 0x43AC, 0x2EBB,
+    0x43DD, 0x44D6, 0x4661, 0x464C, 0xE843, 0x4723, 0x4729, 0x477C, 0x478D, 0x2ECA,
+    0x4947, 0x497A, 0x497D, 0x4982, 0x4983, 0x4985, 0x4986, 0x499F, 0x499B, 0x49B7,
+    0x49B6, 0xE854, 0xE855, 0x4CA3, 0x4C9F, 0x4CA0, 0x4CA1, 0x4C77, 0x4CA2, 0x4DAE,
+    0xE864,
+};
+
+static const gb4_range_t gb4_ranges[206] = {
+    {0, 0x0080}, {36, 0x00A5}, {38, 0x00A9}, {45, 0x00B2},
+    {50, 0x00B8}, {81, 0x00D8}, {89, 0x00E2}, {95, 0x00EB},
+    {96, 0x00EE}, {100, 0x00F4}, {103, 0x00F8}, {104, 0x00FB},
+    {105, 0x00FD}, {109, 0x0102}, {126, 0x0114}, {133, 0x011C},
+    {148, 0x012C}, {172, 0x0145}, {175, 0x0149}, {179, 0x014E},
+    {208, 0x016C}, {306, 0x01CF}, {307, 0x01D1}, {308, 0x01D3},
+    {309, 0x01D5}, {310, 0x01D7}, {311, 0x01D9}, {312, 0x01DB},
+    {313, 0x01DD}, {341, 0x01FA}, {428, 0x0252}, {443, 0x0262},
+    {544, 0x02C8}, {545, 0x02CC}, {558, 0x02DA}, {741, 0x03A2},
+    {742, 0x03AA}, {749, 0x03C2}, {750, 0x03CA}, {805, 0x0402},
+    {819, 0x0450}, {820, 0x0452}, {7922, 0x2011}, {7924, 0x2017},
+    {7925, 0x201A}, {7927, 0x201E}, {7934, 0x2027}, {7943, 0x2031},
+    {7944, 0x2034}, {7945, 0x2036}, {7950, 0x203C}, {8062, 0x20AD},
+    {8148, 0x2104}, {8149, 0x2106}, {8152, 0x210A}, {8164, 0x2117},
+    {8174, 0x2122}, {8236, 0x216C}, {8240, 0x217A}, {8262, 0x2194},
+    {8264, 0x219A}, {8374, 0x2209}, {8380, 0x2210}, {8381, 0x2212},
+    {8384, 0x2216}, {8388, 0x221B}, {8390, 0x2221}, {8392, 0x2224},
+    {8393, 0x2226}, {8394, 0x222C}, {8396, 0x222F}, {8401, 0x2238},
+    {8406, 0x223E}, {8416, 0x2249}, {8419, 0x224D}, {8424, 0x2253},
+    {8437, 0x2262}, {8439, 0x2268}, {8445, 0x2270}, {8482, 0x2296},
+    {8485, 0x229A}, {8496, 0x22A6}, {8521, 0x22C0}, {8603, 0x2313},
+    {8936, 0x246A}, {8946, 0x249C}, {9046, 0x254C}, {9050, 0x2574},
+    {9063, 0x2590}, {9066, 0x2596}, {9076, 0x25A2}, {9092, 0x25B4},
+    {9100, 0x25BE}, {9108, 0x25C8}, {9111, 0x25CC}, {9113, 0x25D0},
+    {9131, 0x25E6}, {9162, 0x2607}, {9164, 0x260A}, {9218, 0x2641},
+    {9219, 0x2643}, {11329, 0x2E82}, {11331, 0x2E85}, {11334, 0x2E89},
+    {11336, 0x2E8D}, {11346, 0x2E98}, {11361, 0x2EA8}, {11363, 0x2EAB},
+    {11366, 0x2EAF}, {11370, 0x2EB4}, {11372, 0x2EB8}, {11375, 0x2EBC},
+    {11389, 0x2ECB}, {11682, 0x2FFC}, {11686, 0x3004}, {11687, 0x3018},
+    {11692, 0x301F}, {11694, 0x302A}, {11714, 0x303F}, {11716, 0x3094},
+    {11723, 0x309F}, {11725, 0x30F7}, {11730, 0x30FF}, {11736, 0x312A},
+    {11982, 0x322A}, {11989, 0x3232}, {12102, 0x32A4}, {12336, 0x3390},
+    {12348, 0x339F}, {12350, 0x33A2}, {12384, 0x33C5}, {12393, 0x33CF},
+    {12395, 0x33D3}, {12397, 0x33D6}, {12510, 0x3448}, {12553, 0x3474},
+    {12851, 0x359F}, {12962, 0x360F}, {12973, 0x361B}, {13738, 0x3919},
+    {13823, 0x396F}, {13919, 0x39D1}, {13933, 0x39E0}, {14080, 0x3A74},
+    {14298, 0x3B4F}, {14585, 0x3C6F}, {14698, 0x3CE1}, {15583, 0x4057},
+    {15847, 0x4160}, {16318, 0x4338}, {16434, 0x43AD}, {16438, 0x43B2},
+    {16481, 0x43DE}, {16729, 0x44D7}, {17102, 0x464D}, {17122, 0x4662},
+    {17315, 0x4724}, {17320, 0x472A}, {17402, 0x477D}, {17418, 0x478E},
+    {17859, 0x4948}, {17909, 0x497B}, {17911, 0x497E}, {17915, 0x4984},
+    {17916, 0x4987}, {17936, 0x499C}, {17939, 0x49A0}, {17961, 0x49B8},
+    {18664, 0x4C78}, {18703, 0x4CA4}, {18814, 0x4D1A}, {18962, 0x4DAF},
+    {19043, 0x9FA6}, {33469, 0xE76C}, {33470, 0xE7C8}, {33471, 0xE7E7},
+    {33484, 0xE815}, {33485, 0xE819}, {33490, 0xE81F}, {33497, 0xE827},
+    {33501, 0xE82D}, {33505, 0xE833}, {33513, 0xE83C}, {33520, 0xE844},
+    {33536, 0xE856}, {33550, 0xE865}, {37845, 0xF92D}, {37921, 0xF97A},
+    {37948, 0xF996}, {38029, 0xF9E8}, {38038, 0xF9F2}, {38064, 0xFA10},
+    {38065, 0xFA12}, {38066, 0xFA15}, {38069, 0xFA19}, {38075, 0xFA22},
+    {38076, 0xFA25}, {38078, 0xFA2A}, {39108, 0xFE32}, {39109, 0xFE45},
+    {39113, 0xFE53}, {39114, 0xFE58}, {39115, 0xFE67}, {39116, 0xFE6C},
+    {39265, 0xFF5F}, {39394, 0xFFE6},
+};
+
+#endif // GB18030_TABLE_H
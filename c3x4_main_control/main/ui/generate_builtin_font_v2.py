@@ -3,9 +3,17 @@
 生成内置中文字体 C 文件
 使用 lv_font_conv 工具从 TTF 字体生成 LVGL 可用的字体
 支持生成可直接编译的 C 文件
+
+墨水屏只有黑白两色，默认生成 1bpp 位图，比 4bpp 小得多；--bpp 2/4 保留灰度。
+--compress 控制是否使用 LVGL 压缩格式（bitmap_format 1：逐行异或预过滤 + RLE），
+auto 时 2/4bpp 压缩，1bpp 汉字笔画短、RLE 反而更大，存原始位图。--from-c 把已有的
+生成文件按新的 bpp 重新量化、重新编码，不需要 TTF 和 lv_font_conv，auto 时逐字体
+比较两种格式取小的
 """
 
+import argparse
 import os
+import re
 import sys
 import subprocess
 
@@ -19,7 +27,7 @@ FONT_VAR_NAME = "lv_font_builtin_chinese_16"
 
 # 字体参数
 FONT_SIZE = 16  # 字体大小
-BPP = 4        # 每像素位数 (4 = 16 级灰度)
+BPP = 1        # 默认每像素位数 (1 = 黑白，墨水屏足够)
 
 def read_chinese_chars(filepath):
     """读取常用汉字列表"""
@@ -31,8 +39,8 @@ def read_chinese_chars(filepath):
         unique_chars = sorted(set(chars))
         return unique_chars
 
-def generate_font_c_file(ttf_path, chars, size, bpp, output_c):
-    """使用 lv_font_conv 直接生成 C 文件"""
+def generate_font_c_file(ttf_path, chars, size, bpp, output_c, compress=True):
+    """使用 lv_font_conv 直接生成 C 文件（默认压缩，bitmap_format = 1）"""
 
     # 构建 symbols 参数 - 将所有字符作为符号传入
     symbols_str = ''.join(chars)
@@ -47,8 +55,11 @@ def generate_font_c_file(ttf_path, chars, size, bpp, output_c):
         '-o', output_c,
         '--force-fast-kern-format'
     ]
+    if not compress:
+        cmd.append('--no-compress')
 
-    print(f"Running: lv_font_conv --size {size} --bpp {bpp} --font {ttf_path} --symbols <{len(chars)} chars> --format lvgl -o {output_c}")
+    print(f"Running: lv_font_conv --size {size} --bpp {bpp} --font {ttf_path} --symbols <{len(chars)} chars> --format lvgl -o {output_c}"
+          + ("" if compress else " --no-compress"))
 
     try:
         result = subprocess.run(cmd, capture_output=True, text=True, check=True)
@@ -69,7 +80,232 @@ def generate_font_c_file(ttf_path, chars, size, bpp, output_c):
         print("  Download from: https://github.com/lvgl/lv_font_conv/releases")
         return False
 
-def modify_generated_c_file(input_c, output_c, var_name, font_name):
+# ---------------------------------------------------------------------------
+# LVGL 压缩位图（与 lv_font_fmt_txt.c 的 decompress()/rle_next() 对应）
+#
+# 每个字形从字节边界开始，MSB 在前。第一行原样编码，之后每行先与上一行异或。
+# RLE：读到与上一个相同的字面值后进入重复模式，每个 1 位表示再重复一次，0 位后跟
+# 新的字面值；连续 10 个 1 位之后是 6 位计数 N，表示再重复 N-1 次，然后读字面值
+# ---------------------------------------------------------------------------
+
+RLE_BIT_REPEATS = 11   # 重复模式下第 11 个 1 位后读计数
+RLE_COUNTER_BITS = 6
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read(self, n):
+        v = 0
+        for _ in range(n):
+            byte = self.pos >> 3
+            bit = (self.data[byte] >> (7 - (self.pos & 7))) & 1 if byte < len(self.data) else 0
+            v = (v << 1) | bit
+            self.pos += 1
+        return v
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.pos = 0
+
+    def write(self, v, n):
+        for i in range(n - 1, -1, -1):
+            if (self.pos & 7) == 0:
+                self.out.append(0)
+            if (v >> i) & 1:
+                self.out[-1] |= 0x80 >> (self.pos & 7)
+            self.pos += 1
+
+
+def rle_decode(data, count, bpp):
+    """按 LVGL rle_next() 的状态机解出 count 个像素值"""
+    r = BitReader(data)
+    pixels = []
+    state, prev, cnt = 'single', 0, 0
+    for _ in range(count):
+        if state == 'single':
+            first = r.pos == 0
+            v = r.read(bpp)
+            if not first and v == prev:
+                state, cnt = 'repeat', 0
+            prev = v
+        elif state == 'repeat':
+            cnt += 1
+            if r.read(1):
+                v = prev
+                if cnt == RLE_BIT_REPEATS:
+                    cnt = r.read(RLE_COUNTER_BITS)
+                    if cnt:
+                        state = 'counter'
+                    else:
+                        v = prev = r.read(bpp)
+                        state = 'single'
+            else:
+                v = prev = r.read(bpp)
+                state = 'single'
+        else:
+            v = prev
+            cnt -= 1
+            if cnt == 0:
+                v = prev = r.read(bpp)
+                state = 'single'
+        pixels.append(v)
+    return pixels
+
+
+def rle_encode(pixels, bpp):
+    """逐像素模拟解码器状态，输出解码器能还原 pixels 的位流"""
+    w = BitWriter()
+    state, prev, cnt = 'single', 0, 0
+    counter_max = (1 << RLE_COUNTER_BITS) - 1
+    for i, v in enumerate(pixels):
+        if state == 'single':
+            w.write(v, bpp)
+            if i > 0 and v == prev:
+                state, cnt = 'repeat', 0
+            prev = v
+        elif state == 'repeat':
+            cnt += 1
+            if v != prev:
+                w.write(0, 1)
+                w.write(v, bpp)
+                prev, state = v, 'single'
+                continue
+            w.write(1, 1)
+            if cnt == RLE_BIT_REPEATS:
+                # 计数 N：之后 N-1 个像素重复，第 N 个读字面值
+                run = 0
+                while i + 1 + run < len(pixels) and pixels[i + 1 + run] == prev:
+                    run += 1
+                cnt = min(run + 1, counter_max)
+                w.write(cnt, RLE_COUNTER_BITS)
+                state = 'counter'
+        else:
+            cnt -= 1
+            if cnt == 0:
+                w.write(v, bpp)
+                prev, state = v, 'single'
+    return bytes(w.out)
+
+
+def decode_glyph(data, width, height, bpp, bitmap_format):
+    """解出一个字形，返回逐行像素值"""
+    if bitmap_format == 0:
+        r = BitReader(data)
+        return [[r.read(bpp) for _ in range(width)] for _ in range(height)]
+    flat = rle_decode(data, width * height, bpp)
+    rows = [flat[y * width:(y + 1) * width] for y in range(height)]
+    if bitmap_format == 1:
+        for y in range(1, height):
+            rows[y] = [a ^ b for a, b in zip(rows[y], rows[y - 1])]
+    return rows
+
+
+def encode_glyph(rows, bpp, compress):
+    """编码一个字形；compress 时使用带预过滤的 RLE（bitmap_format 1）"""
+    if not compress:
+        w = BitWriter()
+        for row in rows:
+            for v in row:
+                w.write(v, bpp)
+        return bytes(w.out)
+    flat = list(rows[0]) if rows else []
+    for y in range(1, len(rows)):
+        flat += [a ^ b for a, b in zip(rows[y], rows[y - 1])]
+    return rle_encode(flat, bpp)
+
+
+def requantize(value, src_bpp, dst_bpp):
+    """灰度值换算到目标位数（截断低位；1bpp 即以 50% 为阈值）"""
+    if dst_bpp >= src_bpp:
+        return value * ((1 << dst_bpp) - 1) // ((1 << src_bpp) - 1)
+    return value >> (src_bpp - dst_bpp)
+
+
+def convert_c_file(input_c, output_c, bpp, compress):
+    """把已生成的 LVGL 字体 C 文件换成新的 bpp / 压缩方式，其余内容保持不变
+
+    compress 为 None 时两种格式都编码，取总字节数小的
+    """
+
+    with open(input_c, 'r', encoding='utf-8') as f:
+        content = f.read()
+
+    src_bpp = int(re.search(r'\.bpp = (\d+)', content).group(1))
+    src_format = int(re.search(r'\.bitmap_format = (\d+)', content).group(1))
+
+    start = content.index('glyph_bitmap[] = {')
+    body_start = content.index('{', start) + 1
+    body_end = content.index('};', body_start)
+    body = content[body_start:body_end]
+
+    # 每个字形前的 /* U+XXXX "字" */ 注释保留下来
+    labels = re.findall(r'/\*\s*(U\+[0-9A-Fa-f]+.*?)\s*\*/', body)
+    data = bytes(int(x, 16) for x in re.findall(r'0x[0-9a-fA-F]+', re.sub(r'/\*.*?\*/', '', body, flags=re.S)))
+
+    dsc_re = re.compile(r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+)')
+    dscs = [(m, int(m.group(1)), int(m.group(3)), int(m.group(4))) for m in dsc_re.finditer(content)]
+    glyphs = [d for d in dscs if d[2] and d[3]]
+    if len(glyphs) != len(labels):
+        print(f"Error: {len(glyphs)} glyph descriptors but {len(labels)} bitmaps")
+        return None
+
+    images = []
+    for m, index, w, h in glyphs:
+        rows = decode_glyph(data[index:], w, h, src_bpp, src_format)
+        images.append([[requantize(v, src_bpp, bpp) for v in row] for row in rows])
+
+    if compress is None:
+        packed = sum(len(encode_glyph(rows, bpp, True)) for rows in images)
+        raw = sum(len(encode_glyph(rows, bpp, False)) for rows in images)
+        print(f"Compressed {packed} bytes, raw {raw} bytes")
+        compress = packed < raw
+
+    new_data = bytearray()
+    new_index = {}
+    lines = []
+    for (m, index, w, h), label, rows in zip(glyphs, labels, images):
+        enc = encode_glyph(rows, bpp, compress)
+        assert decode_glyph(enc, w, h, bpp, 1 if compress else 0) == rows
+        new_index[m.start()] = len(new_data)
+        new_data += enc
+        lines.append(f"    /* {label} */")
+        for i in range(0, len(enc), 8):
+            lines.append("    " + ", ".join(f"0x{b:x}" for b in enc[i:i + 8]) + ",")
+        lines.append("")
+    new_body = "\n" + "\n".join(lines[:-1]) + "\n"
+
+    # 从后往前替换，前面的偏移不受影响
+    for m, index, w, h in reversed(dscs):
+        if m.start() in new_index:
+            content = (content[:m.start(1)] + str(new_index[m.start()]) + content[m.end(1):])
+    content = content[:body_start] + new_body + content[body_end:]
+    content = re.sub(r'\.bpp = \d+', f'.bpp = {bpp}', content)
+    content = re.sub(r'\.bitmap_format = \d+', f'.bitmap_format = {1 if compress else 0}', content)
+    content = re.sub(r'( \* BPP: )\d+.*', lambda m: m.group(1) + bpp_label(bpp, compress), content, count=1)
+
+    with open(output_c, 'w', encoding='utf-8') as f:
+        f.write(content)
+
+    print(f"Glyph bitmaps: {len(data)} bytes ({src_bpp} bpp) -> {len(new_data)} bytes ({bpp} bpp"
+          + (", compressed)" if compress else ")"))
+    return os.path.getsize(output_c), compress
+
+
+def bpp_label(bpp, compress):
+    return f"{bpp}" + (" (compressed)" if compress else "")
+
+
+def set_fallback(content):
+    """内置字体缺的字形（图标、拉丁扩展）回退到 Montserrat"""
+    return content.replace('    .fallback = NULL,', '    .fallback = &lv_font_montserrat_16,', 1)
+
+
+def modify_generated_c_file(input_c, output_c, var_name, font_name, bpp=BPP, compress=True):
     """修改生成的 C 文件，添加必要的声明和包装"""
 
     with open(input_c, 'r', encoding='utf-8') as f:
@@ -82,7 +318,7 @@ def modify_generated_c_file(input_c, output_c, var_name, font_name):
  *
  * Font: {font_name}
  * Size: {FONT_SIZE}px
- * BPP: {BPP}
+ * BPP: {bpp_label(bpp, compress)}
  *
  * Generated by generate_builtin_font_v2.py
  */
@@ -105,7 +341,7 @@ extern "C" {{
 """
 
     # 在文件开头添加头文件
-    content = header + content + footer
+    content = header + set_fallback(content) + footer
 
     # 写入输出文件
     with open(output_c, 'w', encoding='utf-8') as f:
@@ -167,7 +403,20 @@ static inline bool builtin_font_is_available(void)
 
     print(f"Generated header file: {header_file}")
 
+def parse_args():
+    parser = argparse.ArgumentParser(description="Built-in Chinese font generator for LVGL")
+    parser.add_argument('--bpp', type=int, choices=[1, 2, 4], default=BPP,
+                        help=f"bits per pixel (default {BPP})")
+    parser.add_argument('--compress', choices=['auto', 'yes', 'no'], default='auto',
+                        help="LVGL compressed bitmap format (auto: smaller of the two "
+                             "with --from-c, otherwise only above 1 bpp)")
+    parser.add_argument('--from-c', metavar='FILE',
+                        help="re-encode an existing generated C file instead of running lv_font_conv")
+    return parser.parse_args()
+
 def main():
+    args = parse_args()
+    compress = {'yes': True, 'no': False}.get(args.compress)
     script_dir = os.path.dirname(os.path.abspath(__file__))
     os.chdir(script_dir)
 
@@ -175,6 +424,19 @@ def main():
     print("Built-in Chinese Font Generator for LVGL")
     print("=" * 70)
 
+    if args.from_c:
+        print(f"\nRe-encoding {args.from_c} -> {OUTPUT_C_FILE} ({args.bpp} bpp)")
+        result = convert_c_file(args.from_c, OUTPUT_C_FILE, args.bpp, compress)
+        if result is None:
+            return 1
+        file_size, compress = result
+        print(f"Generated C file: {OUTPUT_C_FILE} ({file_size} bytes, {file_size/1024:.1f} KB, "
+              f"BPP: {bpp_label(args.bpp, compress)})")
+        return 0
+
+    if compress is None:
+        compress = args.bpp > 1
+
     # 检查文件是否存在
     if not os.path.exists(TTF_FILE):
         print(f"\nError: TTF file not found: {TTF_FILE}")
@@ -201,11 +463,11 @@ def main():
     # 生成 C 文件
     print(f"\n[2/4] Generating font C file with lv_font_conv...")
     print(f"      Font: {TTF_FILE}")
-    print(f"      Size: {FONT_SIZE}px, BPP: {BPP}")
+    print(f"      Size: {FONT_SIZE}px, BPP: {bpp_label(args.bpp, compress)}")
     print(f"      Output: {OUTPUT_C_FILE}")
 
     temp_c_file = "temp_font.c"
-    if not generate_font_c_file(TTF_FILE, chars, FONT_SIZE, BPP, temp_c_file):
+    if not generate_font_c_file(TTF_FILE, chars, FONT_SIZE, args.bpp, temp_c_file, compress):
         print("\nError: Failed to generate font C file")
         print("\nTroubleshooting:")
         print("  1. Make sure lv_font_conv is installed:")
@@ -216,7 +478,8 @@ def main():
 
     # 修改生成的 C 文件
     print(f"\n[3/4] Processing generated C file...")
-    file_size = modify_generated_c_file(temp_c_file, OUTPUT_C_FILE, FONT_VAR_NAME, FONT_NAME)
+    file_size = modify_generated_c_file(temp_c_file, OUTPUT_C_FILE, FONT_VAR_NAME, FONT_NAME,
+                                        args.bpp, compress)
 
     # 生成头文件
     print(f"\n[4/4] Generating header file...")
@@ -234,7 +497,7 @@ def main():
     print(f"  - {OUTPUT_C_FILE} ({file_size/1024:.1f} KB)")
     print(f"  - {OUTPUT_HEADER_FILE}")
     print(f"\nCharacter set: {len(chars)} common Chinese characters")
-    print(f"Font: {FONT_NAME}, {FONT_SIZE}px, {BPP} bpp")
+    print(f"Font: {FONT_NAME}, {FONT_SIZE}px, {bpp_label(args.bpp, compress)} bpp")
     print("\nNext steps:")
     print(f"  1. These files are already in the correct directory:")
     print(f"     {os.path.abspath(OUTPUT_C_FILE)}")
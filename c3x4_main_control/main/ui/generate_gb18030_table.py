@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+生成 GB18030 → Unicode 查找表（gb18030_table.h）
+使用 Python 自带的 gb18030 编解码器，不依赖外部文件
+
+双字节区按首字节分行，行内切成若干段：
+  - 连续段：码点随次字节递增，只存起点
+  - 原样段：码点存入 literal 池（主要是按拼音排序的 GB2312 汉字区）
+四字节区（BMP 部分）存线性序号与码点同步递增的区间
+"""
+
+import os
+
+OUTPUT_FILE = "gb18030_table.h"
+
+LEAD_FIRST = 0x81
+LEAD_LAST = 0xFE
+TRAIL_FIRST = 0x40
+TRAIL_LAST = 0xFE
+MIN_RUN = 4          # 短于此长度的递增序列按原样存储
+REPLACEMENT = 0xFFFD
+
+
+def decode(seq):
+    try:
+        s = seq.decode("gb18030")
+    except UnicodeDecodeError:
+        return None
+    if len(s) != 1 or ord(s) > 0xFFFF:
+        return None
+    return ord(s)
+
+
+def build_two_byte():
+    row_index = []
+    segs = []
+    literals = []
+    for lead in range(LEAD_FIRST, LEAD_LAST + 1):
+        row_index.append(len(segs))
+        cps = {}
+        for trail in range(TRAIL_FIRST, TRAIL_LAST + 1):
+            if trail == 0x7F:
+                continue
+            cp = decode(bytes([lead, trail]))
+            if cp is not None:
+                cps[trail] = cp
+
+        trail = TRAIL_FIRST
+        literal_seg = None
+        while trail <= TRAIL_LAST:
+            if trail not in cps:
+                literal_seg = None
+                trail += 1
+                continue
+            end = trail + 1
+            while end in cps and cps[end] == cps[end - 1] + 1:
+                end += 1
+            if end - trail >= MIN_RUN:
+                segs.append([trail, end - trail, 1, cps[trail]])
+                literal_seg = None
+                trail = end
+                continue
+            if literal_seg is None:
+                literal_seg = [trail, 0, 0, len(literals)]
+                segs.append(literal_seg)
+            literals.append(cps[trail])
+            literal_seg[1] += 1
+            trail += 1
+    row_index.append(len(segs))
+    return row_index, segs, literals
+
+
+def linear_to_bytes(linear):
+    b4 = linear % 10
+    linear //= 10
+    b3 = linear % 126
+    linear //= 126
+    b2 = linear % 10
+    b1 = linear // 10
+    return bytes([0x81 + b1, 0x30 + b2, 0x81 + b3, 0x30 + b4])
+
+
+def build_four_byte():
+    # BMP 范围：0x81308130 .. 0x8431A439
+    ranges = []
+    prev = None
+    for linear in range(0, 39420):
+        cp = decode(linear_to_bytes(linear))
+        if cp is None:
+            prev = None
+            continue
+        if prev is None or cp != prev[1] + (linear - prev[0]):
+            prev = (linear, cp)
+            ranges.append(prev)
+    return ranges
+
+
+def emit_array(out, decl, values, per_line, fmt):
+    out.append(decl + " = {")
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    out.append("")
+
+
+def main():
+    row_index, segs, literals = build_two_byte()
+    ranges = build_four_byte()
+
+    out = [
+        "/**",
+        " * @file gb18030_table.h",
+        " * @brief Auto-generated GB18030 → Unicode table (only included by gb18030.c)",
+        " *",
+        " * Generated by generate_gb18030_table.py",
+        " */",
+        "",
+        "#ifndef GB18030_TABLE_H",
+        "#define GB18030_TABLE_H",
+        "",
+        "#define GB2_LEAD_FIRST 0x%02X" % LEAD_FIRST,
+        "#define GB2_LEAD_LAST  0x%02X" % LEAD_LAST,
+        "#define GB4_RANGE_COUNT %d" % len(ranges),
+        "",
+    ]
+    emit_array(out, "static const uint16_t gb2_row_index[%d]" % len(row_index), row_index, 12,
+               lambda v: "%d" % v)
+    emit_array(out, "static const gb2_seg_t gb2_segs[%d]" % len(segs), segs, 4,
+               lambda s: "{0x%02X, %d, %d, 0x%04X}" % tuple(s))
+    emit_array(out, "static const uint16_t gb2_literals[%d]" % len(literals), literals, 10,
+               lambda v: "0x%04X" % v)
+    emit_array(out, "static const gb4_range_t gb4_ranges[%d]" % len(ranges), ranges, 4,
+               lambda r: "{%d, 0x%04X}" % r)
+    out.append("#endif // GB18030_TABLE_H")
+
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), OUTPUT_FILE)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+
+    size = len(row_index) * 2 + len(segs) * 6 + len(literals) * 2 + len(ranges) * 8
+    print("rows=%d segs=%d literals=%d ranges=%d, ~%d bytes" %
+          (len(row_index) - 1, len(segs), len(literals), len(ranges), size))
+
+
+if __name__ == "__main__":
+    main()
@@ -3,35 +3,95 @@
  * @brief 图片浏览器实现
  *
  * 内存优化说明：
- * - 对于 ESP32-C3 有限内存，使用 LVGL 内置解码器直接加载图片
- * - 图片按屏幕尺寸显示，不需要额外缩放
- * - 使用 1-bit 灰度格式以减少内存占用
+ * - PNG/JPEG 不交给 LVGL 解码（LVGL 会解出全彩整图并放进图片缓存）：
+ *   用 epub_image 的逐行解码边读边缩小到屏幕尺寸，直接抖动为 1bpp
+ *   （灰阶模式下为 2bpp 四级灰），内存只有结果位图和一行源图像
+ * - 位图在每次 LVGL 渲染完成后写入 framebuffer，与 EPUB 图片页相同
+ * - 结果按 PackBits 压缩缓存在 SD 卡（image_cache.h），再次显示或幻灯片循环时只解压；
+ *   缩略图网格也用同一缓存
+ * - BMP/GIF 以及自带解码不支持的文件（渐进式 JPEG、隔行 PNG）仍走 LVGL 解码器
+ * - 目录列表只存相对目录的文件名（名字池）和按需从文件头读出的原始尺寸，每张 8 字节
+ *   加文件名，几千张的目录也能浏览；最近浏览的几个目录的列表常驻，不随屏幕释放
  */
 
 #include "image_browser.h"
 #include "../lvgl_driver.h"
+#include "../bg_jobs.h"
+#include "../mem_pressure.h"
 #include "esp_log.h"
+#include "file_browser.h"
 #include "font_manager.h"
 #include "screen_manager.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/timers.h"
+#include "freertos/semphr.h"
 #include <dirent.h>
 #include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 #include <sys/stat.h>
+#include <time.h>
 
 static const char *TAG = "IMAGE_BROWSER";
 
-#define MAX_IMAGES 100
 #define MAX_PATH_LEN 256
 
-// 图片解码缓冲区大小（分块解码以减少内存占用）
-#define DECODE_BUFFER_SIZE 8192
+#define IMAGE_CATALOG_MAX         4000           // 一个目录最多收录的图片数
+#define IMAGE_CATALOG_SLOTS       3              // 缓存最近浏览的几个目录
+#define IMAGE_CATALOG_CACHE_BYTES (32 * 1024)    // 非当前目录的名字池与条目总大小上限
+#define IMAGE_SIZE_UNKNOWN        0xFFFF         // 读过文件头但得不到尺寸
+#define IMAGE_JPEG_MAX_SEGMENTS   64             // 找 SOF 时最多跳过的段数
+
+// 渲染完成后写入位图时等待 framebuffer 的上限
+#define IMAGE_BLIT_LOCK_MS 100
+
 
 static image_browser_state_t g_browser = {0};
-static TimerHandle_t s_slideshow_timer = NULL;
+static lv_timer_t *s_slideshow_timer = NULL;
+
+// 目录中的一张图片：名字在名字池中的偏移（相对目录，不存完整路径，池扩容后偏移不变）。
+// 原始尺寸在需要显示时才从文件头读出（0 = 尚未读取）
+typedef struct {
+    uint32_t name;
+    uint16_t width;
+    uint16_t height;
+} image_entry_t;
+
+// 一个目录的图片列表。键为路径、目录修改时间与文件浏览器的缓存代数（FAT 增删文件时
+// 不一定更新目录时间，上传等改动由 file_browser_invalidate_cache() 使缓存失效）。
+// 最近浏览的几个目录常驻，回到同一目录时不再 readdir
+struct image_catalog {
+    char dir[MAX_PATH_LEN];  // 空串表示空槽
+    time_t mtime;
+    uint32_t generation;
+    uint32_t last_use;
+    char *names;             // 名字池，NUL 分隔
+    size_t names_len;
+    size_t names_cap;
+    image_entry_t *entries;
+    int count;
+    int cap;
+};
+
+static image_catalog_t s_catalogs[IMAGE_CATALOG_SLOTS];
+static uint32_t s_catalog_clock;
+
+// 预解码：显示第 N 张时在后台准备第 N+1 张（写入位图缓存并留在内存里），
+// 幻灯片定时器到点时只交换位图并请求刷新。解码不碰 LVGL 和字体，作为高优先级的
+// 后台作业运行；请求与结果经 lock 交接，结果不再需要时由作业自己释放
+static struct {
+    bg_job_id_t job;         // 正在运行或排队的预解码作业（BG_JOB_NONE = 无）
+    uint32_t job_gen;        // 每次提交加一，区分迟到的 done 回调
+    SemaphoreHandle_t lock;
+    int want;                // 请求的图片索引（-1 = 无）
+    char path[MAX_PATH_LEN];
+    int max_width;
+    int max_height;
+    uint8_t bpp;
+    int ready_index;         // ready 对应的索引（-1 = 无）
+    epub_image_t ready;
+} s_ahead = {.want = -1, .ready_index = -1};
 
 // 支持的图片扩展名
 static const char *supported_extensions[] = {
@@ -65,6 +125,293 @@ image_format_t image_browser_get_image_format(const char *filename) {
     return IMAGE_FORMAT_UNKNOWN;
 }
 
+// ---------------------------------------------------------------------------
+// 图片目录
+// ---------------------------------------------------------------------------
+
+static const char *entry_name(int index) {
+    return g_browser.catalog->names + g_browser.catalog->entries[index].name;
+}
+
+static image_format_t entry_format(int index) {
+    return image_browser_get_image_format(entry_name(index));
+}
+
+static void entry_path(int index, char *buf, size_t len) {
+    snprintf(buf, len, "%s/%s", g_browser.catalog->dir, entry_name(index));
+}
+
+static size_t catalog_bytes(const image_catalog_t *c) {
+    return c->names_cap + (size_t)c->cap * sizeof(image_entry_t);
+}
+
+static void catalog_free(image_catalog_t *c) {
+    free(c->names);
+    free(c->entries);
+    memset(c, 0, sizeof(*c));
+}
+
+static bool catalog_add(image_catalog_t *c, const char *name) {
+    if (c->count >= c->cap) {
+        const int cap = c->cap ? c->cap * 2 : 64;
+        image_entry_t *grown = realloc(c->entries, cap * sizeof(image_entry_t));
+        if (grown == NULL) {
+            return false;
+        }
+        c->entries = grown;
+        c->cap = cap;
+    }
+    const size_t len = strlen(name) + 1;
+    if (c->names_len + len > c->names_cap) {
+        size_t cap = c->names_cap ? c->names_cap : 1024;
+        while (cap < c->names_len + len) {
+            cap *= 2;
+        }
+        char *grown = realloc(c->names, cap);
+        if (grown == NULL) {
+            return false;
+        }
+        c->names = grown;
+        c->names_cap = cap;
+    }
+    memcpy(c->names + c->names_len, name, len);
+    c->entries[c->count].name = (uint32_t)c->names_len;
+    c->entries[c->count].width = 0;
+    c->entries[c->count].height = 0;
+    c->names_len += len;
+    c->count++;
+    return true;
+}
+
+// 扫描完缩到实际大小（缓存的目录多半不再增长）
+static void catalog_trim(image_catalog_t *c) {
+    if (c->names_len > 0 && c->names_len < c->names_cap) {
+        char *names = realloc(c->names, c->names_len);
+        if (names != NULL) {
+            c->names = names;
+            c->names_cap = c->names_len;
+        }
+    }
+    if (c->count > 0 && c->count < c->cap) {
+        image_entry_t *entries = realloc(c->entries, c->count * sizeof(image_entry_t));
+        if (entries != NULL) {
+            c->entries = entries;
+            c->cap = c->count;
+        }
+    }
+}
+
+// 读目录：按扩展名收录，类型由 d_type 判断，不逐个 stat
+static void catalog_scan(image_catalog_t *c, DIR *dir) {
+    struct dirent *entry;
+    int total_scanned = 0;
+    while ((entry = readdir(dir)) != NULL) {
+        const char *name = entry->d_name;
+        total_scanned++;
+        if (name[0] == '.' || entry->d_type == DT_DIR ||
+            image_browser_get_image_format(name) == IMAGE_FORMAT_UNKNOWN) {
+            continue;    // 隐藏文件（缓存）、子目录与其他文件
+        }
+        if (c->count >= IMAGE_CATALOG_MAX || !catalog_add(c, name)) {
+            ESP_LOGW(TAG, "Catalog full at %d images: %s", c->count, c->dir);
+            break;
+        }
+    }
+    catalog_trim(c);
+    ESP_LOGI(TAG, "Scan complete: %d entries scanned, found %d images (%u bytes)", total_scanned,
+             c->count, (unsigned)catalog_bytes(c));
+}
+
+// 除 keep 以外的目录总量超限时，从最久未用的开始释放
+static void catalog_evict(const image_catalog_t *keep) {
+    for (;;) {
+        size_t total = 0;
+        image_catalog_t *oldest = NULL;
+        for (int i = 0; i < IMAGE_CATALOG_SLOTS; i++) {
+            image_catalog_t *c = &s_catalogs[i];
+            if (c == keep || c->dir[0] == '\0') {
+                continue;
+            }
+            total += catalog_bytes(c);
+            if (oldest == NULL || c->last_use < oldest->last_use) {
+                oldest = c;
+            }
+        }
+        if (oldest == NULL || total <= IMAGE_CATALOG_CACHE_BYTES) {
+            return;
+        }
+        catalog_free(oldest);
+    }
+}
+
+// 取目录的图片列表：缓存有效时直接用，否则占一个空槽（或最久未用的槽）重新扫描
+static image_catalog_t *catalog_open(const char *directory) {
+    struct stat st;
+    const time_t mtime = stat(directory, &st) == 0 ? st.st_mtime : 0;
+    const uint32_t generation = file_browser_cache_generation();
+    image_catalog_t *slot = NULL;
+    for (int i = 0; i < IMAGE_CATALOG_SLOTS; i++) {
+        image_catalog_t *c = &s_catalogs[i];
+        if (c->dir[0] == '\0') {
+            continue;
+        }
+        if (c->generation != generation) {
+            catalog_free(c);
+        } else if (strcmp(c->dir, directory) == 0) {
+            if (c->mtime == mtime) {
+                c->last_use = ++s_catalog_clock;
+                ESP_LOGI(TAG, "Catalog cached: %s (%d images)", directory, c->count);
+                return c;
+            }
+            catalog_free(c);
+        }
+    }
+
+    DIR *dir = opendir(directory);
+    if (dir == NULL) {
+        ESP_LOGE(TAG, "Failed to open directory: %s (errno=%d)", directory, errno);
+        return NULL;
+    }
+    for (int i = 0; i < IMAGE_CATALOG_SLOTS; i++) {
+        image_catalog_t *c = &s_catalogs[i];
+        if (c->dir[0] == '\0') {
+            slot = c;
+            break;
+        }
+        if (slot == NULL || c->last_use < slot->last_use) {
+            slot = c;
+        }
+    }
+    catalog_free(slot);
+    strncpy(slot->dir, directory, sizeof(slot->dir) - 1);
+    slot->mtime = mtime;
+    slot->generation = generation;
+    slot->last_use = ++s_catalog_clock;
+    catalog_scan(slot, dir);
+    closedir(dir);
+    catalog_evict(slot);
+    return slot;
+}
+
+static uint32_t read_be16(const uint8_t *p) {
+    return (uint32_t)p[0] << 8 | p[1];
+}
+
+static uint32_t read_le16(const uint8_t *p) {
+    return p[0] | (uint32_t)p[1] << 8;
+}
+
+static uint32_t read_be32(const uint8_t *p) {
+    return read_be16(p) << 16 | read_be16(p + 2);
+}
+
+static uint32_t read_le32(const uint8_t *p) {
+    return read_le16(p) | read_le16(p + 2) << 16;
+}
+
+// JPEG：逐段跳过，直到帧头（SOF0..SOF15，不含 DHT/JPG/DAC）
+static bool jpeg_size(FILE *fp, uint32_t *width, uint32_t *height) {
+    uint8_t b[8];
+    if (fread(b, 1, 2, fp) != 2 || b[0] != 0xFF || b[1] != 0xD8) {
+        return false;
+    }
+    for (int i = 0; i < IMAGE_JPEG_MAX_SEGMENTS; i++) {
+        int c;
+        while ((c = fgetc(fp)) == 0xFF) {
+        }
+        if (c == EOF) {
+            return false;
+        }
+        if (c == 0xD8 || (c >= 0xD0 && c <= 0xD7) || c == 0x01) {
+            continue;    // 没有长度的标记
+        }
+        if (c == 0xD9 || c == 0xDA || fread(b, 1, 2, fp) != 2) {
+            return false;    // 图像数据开始前没有帧头
+        }
+        const uint32_t len = read_be16(b);
+        if (len < 2) {
+            return false;
+        }
+        if (c >= 0xC0 && c <= 0xCF && c != 0xC4 && c != 0xC8 && c != 0xCC) {
+            if (fread(b, 1, 5, fp) != 5) {
+                return false;
+            }
+            *height = read_be16(b + 1);
+            *width = read_be16(b + 3);
+            return true;
+        }
+        if (fseek(fp, (long)len - 2, SEEK_CUR) != 0) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// 只读文件头得到原始尺寸，不解码
+static bool read_image_size(const char *path, image_format_t format, uint32_t *width,
+                            uint32_t *height) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    uint8_t h[26];
+    bool ok = false;
+    switch (format) {
+    case IMAGE_FORMAT_PNG:
+        // 签名 8 字节，随后是 IHDR：长度、类型、宽、高（大端）
+        ok = fread(h, 1, 24, fp) == 24 && memcmp(h + 12, "IHDR", 4) == 0;
+        if (ok) {
+            *width = read_be32(h + 16);
+            *height = read_be32(h + 20);
+        }
+        break;
+    case IMAGE_FORMAT_JPEG:
+        ok = jpeg_size(fp, width, height);
+        break;
+    case IMAGE_FORMAT_BMP:
+        // BITMAPINFOHEADER 的宽高（小端，高度为负表示自上而下）
+        ok = fread(h, 1, 26, fp) == 26 && h[0] == 'B' && h[1] == 'M';
+        if (ok) {
+            const int32_t bmp_h = (int32_t)read_le32(h + 22);
+            *width = read_le32(h + 18);
+            *height = (uint32_t)(bmp_h < 0 ? -bmp_h : bmp_h);
+        }
+        break;
+    case IMAGE_FORMAT_GIF:
+        ok = fread(h, 1, 10, fp) == 10 && memcmp(h, "GIF", 3) == 0;
+        if (ok) {
+            *width = read_le16(h + 6);
+            *height = read_le16(h + 8);
+        }
+        break;
+    default:
+        break;
+    }
+    fclose(fp);
+    return ok && *width > 0 && *height > 0;
+}
+
+// 第 index 张的原始尺寸，第一次用到时读文件头
+static bool entry_size(int index, uint32_t *width, uint32_t *height) {
+    image_entry_t *e = &g_browser.catalog->entries[index];
+    if (e->width == 0) {
+        char path[MAX_PATH_LEN];
+        entry_path(index, path, sizeof(path));
+        uint32_t w = 0;
+        uint32_t h = 0;
+        const bool ok = read_image_size(path, entry_format(index), &w, &h);
+        // 超过 16 位的尺寸只记为未知（这样的图也不会自带解码）
+        e->width = ok && w < IMAGE_SIZE_UNKNOWN ? (uint16_t)w : IMAGE_SIZE_UNKNOWN;
+        e->height = ok && h < IMAGE_SIZE_UNKNOWN ? (uint16_t)h : IMAGE_SIZE_UNKNOWN;
+    }
+    if (e->width == IMAGE_SIZE_UNKNOWN || e->height == IMAGE_SIZE_UNKNOWN) {
+        return false;
+    }
+    *width = e->width;
+    *height = e->height;
+    return true;
+}
+
 /**
  * @brief 加载图片到 LVGL（使用内置解码器，内存优化版本）
  *
@@ -106,132 +453,384 @@ static bool load_image_to_lvgl(lv_obj_t *image_obj, const char *file_path) {
     return true;
 }
 
-/**
- * @brief 幻灯片播放定时器回调
- */
-static void slideshow_timer_callback(TimerHandle_t xTimer) {
-    (void)xTimer;
-    // 切换到下一张图片
-    if (!image_browser_next_image()) {
-        // 如果已经是最后一张，回到第一张
-        image_browser_show_image(0);
+static bool image_has_bitmap(int index) {
+    const image_format_t format = entry_format(index);
+    return format == IMAGE_FORMAT_PNG || format == IMAGE_FORMAT_JPEG;
+}
+
+static uint8_t bitmap_bpp(void) {
+    return lvgl_is_grayscale() ? 2 : 1;
+}
+
+static void image_bounds(lv_area_t *bounds) {
+    lv_obj_update_layout(g_browser.container);
+    lv_obj_get_coords(g_browser.container, bounds);
+}
+
+// 一步解码一张；解码期间又来了新请求时继续下一步，否则作业结束
+static bool ahead_step(bg_job_t *job, void *arg) {
+    (void)arg;
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    const int index = s_ahead.want;
+    char path[MAX_PATH_LEN];
+    strncpy(path, s_ahead.path, sizeof(path));
+    const int max_width = s_ahead.max_width;
+    const int max_height = s_ahead.max_height;
+    const uint8_t bpp = s_ahead.bpp;
+    xSemaphoreGive(s_ahead.lock);
+
+    if (index >= 0 && !bg_job_cancelled(job)) {
+        epub_image_t image;
+        const bool ok = image_cache_load(path, max_width, max_height, bpp, &image);
+
+        // 等待期间请求可能已经变了（用户翻页、停止播放），这时结果作废
+        epub_image_t stale = {0};
+        xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+        if (ok && s_ahead.want == index) {
+            stale = s_ahead.ready;
+            s_ahead.ready = image;
+            s_ahead.ready_index = index;
+            s_ahead.want = -1;
+        } else {
+            stale = image;
+        }
+        xSemaphoreGive(s_ahead.lock);
+        epub_image_free(&stale);
+    }
+
+    // 在锁内决定是否结束：ahead_request 看到 BG_JOB_NONE 才会提交新作业
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    const bool more = s_ahead.want >= 0 && !bg_job_cancelled(job);
+    if (!more) {
+        s_ahead.job = BG_JOB_NONE;
     }
+    xSemaphoreGive(s_ahead.lock);
+    return more;
 }
 
-bool image_browser_init(void) {
-    ESP_LOGI(TAG, "Initializing image browser...");
+// 作业因内存不足被放弃时步函数没有机会清理，这里补上（只认本次提交的作业）
+static void ahead_done(void *arg, bool finished) {
+    (void)finished;
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    if (s_ahead.job_gen == (uint32_t)(uintptr_t)arg) {
+        s_ahead.job = BG_JOB_NONE;
+        s_ahead.want = -1;
+    }
+    xSemaphoreGive(s_ahead.lock);
+}
 
-    memset(&g_browser, 0, sizeof(image_browser_state_t));
+// 请求在后台准备第 index 张（只对 PNG/JPEG）
+static void ahead_request(int index) {
+    if (index < 0 || index >= g_browser.image_count ||
+        !image_has_bitmap(index)) {
+        return;
+    }
+    if (s_ahead.lock == NULL) {
+        s_ahead.lock = xSemaphoreCreateMutex();
+        if (s_ahead.lock == NULL) {
+            ESP_LOGW(TAG, "Decode-ahead unavailable");
+            return;
+        }
+    }
+    lv_area_t bounds;
+    image_bounds(&bounds);
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    const bool pending = s_ahead.ready_index == index || s_ahead.want == index;
+    if (!pending) {
+        s_ahead.want = index;
+        entry_path(index, s_ahead.path, sizeof(s_ahead.path));
+        s_ahead.max_width = lv_area_get_width(&bounds);
+        s_ahead.max_height = lv_area_get_height(&bounds);
+        s_ahead.bpp = bitmap_bpp();
+        if (s_ahead.job == BG_JOB_NONE) {
+            // 预算：结果位图的大小（解码工作区只有一行，另计在余量里）
+            const bg_job_desc_t desc = {
+                .name = "img_ahead",
+                .prio = BG_JOB_PRIO_HIGH,
+                .mem_budget = (uint32_t)(s_ahead.max_width * s_ahead.bpp + 7) / 8 * s_ahead.max_height,
+                .step = ahead_step,
+                .done = ahead_done,
+                .arg = (void *)(uintptr_t)++s_ahead.job_gen,
+            };
+            s_ahead.job = bg_jobs_submit(&desc);
+            if (s_ahead.job == BG_JOB_NONE) {
+                s_ahead.want = -1;
+            }
+        }
+    }
+    xSemaphoreGive(s_ahead.lock);
+}
 
-    // 分配图片数组
-    g_browser.images = calloc(MAX_IMAGES, sizeof(image_info_t));
-    if (g_browser.images == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate image array");
+// 取出预先准备好的第 index 张；其它图片的结果一并丢弃
+static bool ahead_take(int index, epub_image_t *image) {
+    if (s_ahead.lock == NULL) {
         return false;
     }
+    epub_image_t stale = {0};
+    bool ok = false;
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    if (s_ahead.ready_index == index && s_ahead.ready.bpp == bitmap_bpp()) {
+        *image = s_ahead.ready;
+        ok = true;
+    } else {
+        stale = s_ahead.ready;
+    }
+    memset(&s_ahead.ready, 0, sizeof(s_ahead.ready));
+    s_ahead.ready_index = -1;
+    xSemaphoreGive(s_ahead.lock);
+    epub_image_free(&stale);
+    return ok;
+}
 
-    // 创建幻灯片播放定时器
-    s_slideshow_timer = xTimerCreate("slideshow",
-                                      pdMS_TO_TICKS(3000),  // 默认 3 秒
-                                      pdFALSE,  // 不自动重载
-                                      NULL,
-                                      slideshow_timer_callback);
-    if (s_slideshow_timer == NULL) {
-        ESP_LOGE(TAG, "Failed to create slideshow timer");
+// 取消请求并丢弃已准备好的结果（正在解码的那张完成后由任务自己释放）
+static void ahead_cancel(void) {
+    if (s_ahead.lock == NULL) {
+        return;
     }
+    xSemaphoreTake(s_ahead.lock, portMAX_DELAY);
+    epub_image_t stale = s_ahead.ready;
+    memset(&s_ahead.ready, 0, sizeof(s_ahead.ready));
+    s_ahead.ready_index = -1;
+    s_ahead.want = -1;
+    xSemaphoreGive(s_ahead.lock);
+    epub_image_free(&stale);
+}
 
-    // 注意：不在这里扫描目录，由 screen_create 时传入实际目录
-    ESP_LOGI(TAG, "Image browser initialized");
+/**
+ * @brief PNG/JPEG 直接解码为抖动位图（优先用预解码的结果），按比例缩小并居中
+ */
+static bool load_image_bitmap(int index) {
+    if (!image_has_bitmap(index)) {
+        return false;
+    }
+    char path[MAX_PATH_LEN];
+    entry_path(index, path, sizeof(path));
+    lv_area_t bounds;
+    image_bounds(&bounds);
+    const int32_t width = lv_area_get_width(&bounds);
+    const int32_t height = lv_area_get_height(&bounds);
+    epub_image_t *image = &g_browser.image;
+    if (!ahead_take(index, image) &&
+        !image_cache_load(path, width, height, bitmap_bpp(), image)) {
+        return false;
+    }
+    // 之前由 LVGL 解码的图片不再需要
+    lv_image_set_src(g_browser.image_obj, NULL);
+
+    lv_area_t *area = &g_browser.image_area;
+    area->x1 = bounds.x1 + (width - image->width) / 2;
+    area->y1 = bounds.y1 + (height - image->height) / 2;
+    area->x2 = area->x1 + image->width - 1;
+    area->y2 = area->y1 + image->height - 1;
     return true;
 }
 
-int image_browser_scan_directory(const char *directory) {
-    if (directory == NULL || g_browser.images == NULL) {
-        ESP_LOGE(TAG, "Invalid parameters: directory=%p, images=%p", directory, g_browser.images);
-        return 0;
+static void blit_bitmap(const epub_image_t *image, const lv_area_t *area) {
+    if (image->bits == NULL) {
+        return;
+    }
+    if (image->bpp == 2) {
+        lvgl_fb_put_gray_bitmap(area->x1, area->y1, image->width, image->height, image->bits,
+                                image->stride, IMAGE_BLIT_LOCK_MS);
+        return;
+    }
+    uint8_t *fb = lvgl_fb_write_begin(IMAGE_BLIT_LOCK_MS);
+    if (fb == NULL) {
+        return;  // 渲染格式与位图不符（灰阶模式），等下次加载
     }
+    lvgl_fb_put_bitmap(fb, area->x1, area->y1, image->width, image->height, image->bits,
+                       image->stride);
+    lvgl_fb_write_end(area);
+}
 
-    ESP_LOGI(TAG, "Scanning directory for images: %s", directory);
+// 渲染完成后把位图写入 framebuffer；控件重绘覆盖了图片区域时这里随之再写一次
+static void image_render_cb(lv_event_t *e) {
+    (void)e;
+    if (!g_browser.grid_mode) {
+        blit_bitmap(&g_browser.image, &g_browser.image_area);
+        return;
+    }
+    for (int i = 0; i < IMAGE_GRID_CELLS; i++) {
+        blit_bitmap(&g_browser.thumbs[i], &g_browser.thumb_areas[i]);
+    }
+}
 
-    // 测试目录是否可以打开
-    DIR *test_dir = opendir(directory);
-    if (test_dir == NULL) {
-        ESP_LOGE(TAG, "Failed to open directory: %s (errno=%d)", directory, errno);
-        return 0;
+static void free_thumbs(void) {
+    for (int i = 0; i < IMAGE_GRID_CELLS; i++) {
+        epub_image_free(&g_browser.thumbs[i]);
     }
-    closedir(test_dir);
-    ESP_LOGI(TAG, "Directory opened successfully");
+}
 
-    // 清理之前的扫描结果
-    for (int i = 0; i < g_browser.image_count; i++) {
-        if (g_browser.images[i].decoded_data != NULL) {
-            free(g_browser.images[i].decoded_data);
+// 网格翻到 index 所在的一页：载入该页的缩略图（缓存未命中时解码并写入缓存）
+static void grid_load_page(int index) {
+    free_thumbs();
+    g_browser.grid_first = index / IMAGE_GRID_CELLS * IMAGE_GRID_CELLS;
+    for (int i = 0; i < IMAGE_GRID_CELLS; i++) {
+        lv_obj_t *cell = g_browser.cells[i];
+        lv_obj_t *label = lv_obj_get_child(cell, 0);
+        const int n = g_browser.grid_first + i;
+        if (n >= g_browser.image_count) {
+            lv_obj_add_flag(cell, LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+        lv_obj_remove_flag(cell, LV_OBJ_FLAG_HIDDEN);
+
+        epub_image_t *thumb = &g_browser.thumbs[i];
+        char path[MAX_PATH_LEN];
+        entry_path(n, path, sizeof(path));
+        lv_label_set_text(label, entry_name(n));
+        if (!image_has_bitmap(n) ||
+            !image_cache_load(path, IMAGE_THUMB_WIDTH, IMAGE_THUMB_HEIGHT, bitmap_bpp(), thumb)) {
+            lv_obj_remove_flag(label, LV_OBJ_FLAG_HIDDEN);  // 没有缩略图时显示文件名
+            continue;
         }
+        lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        lv_area_t coords;
+        lv_obj_get_coords(cell, &coords);
+        lv_area_t *area = &g_browser.thumb_areas[i];
+        area->x1 = coords.x1 + (lv_area_get_width(&coords) - thumb->width) / 2;
+        area->y1 = coords.y1 + (lv_area_get_height(&coords) - thumb->height) / 2;
+        area->x2 = area->x1 + thumb->width - 1;
+        area->y2 = area->y1 + thumb->height - 1;
     }
-    memset(g_browser.images, 0, MAX_IMAGES * sizeof(image_info_t));
-    g_browser.image_count = 0;
+}
 
-    // 停止幻灯片播放
+// 选中格加粗边框；换页时重新载入缩略图
+static void grid_select(int index) {
+    if (g_browser.image_count == 0) {
+        return;
+    }
+    if (index < 0) {
+        index = g_browser.image_count - 1;
+    } else if (index >= g_browser.image_count) {
+        index = 0;
+    }
+    const bool paged = index / IMAGE_GRID_CELLS * IMAGE_GRID_CELLS != g_browser.grid_first;
+    if (paged) {
+        grid_load_page(index);
+    }
+    for (int i = 0; i < IMAGE_GRID_CELLS; i++) {
+        const bool selected = g_browser.grid_first + i == index;
+        lv_obj_set_style_border_width(g_browser.cells[i], selected ? 3 : 1, 0);
+    }
+    g_browser.current_index = index;
+    screen_manager_refresh(paged ? SCREEN_REFRESH_CONTENT : SCREEN_REFRESH_FOCUS);
+}
+
+static void grid_enter(void) {
     image_browser_slideshow_stop();
+    epub_image_free(&g_browser.image);
+    lv_image_set_src(g_browser.image_obj, NULL);
+    g_browser.grid_mode = true;
+    lv_obj_add_flag(g_browser.container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(g_browser.grid, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(g_browser.grid);
+    grid_load_page(g_browser.current_index);
+    grid_select(g_browser.current_index);
+}
 
-    DIR *dir = opendir(directory);
-    if (dir == NULL) {
-        ESP_LOGE(TAG, "Failed to open directory: %s", directory);
-        return 0;
-    }
+static void grid_leave(int index) {
+    free_thumbs();
+    g_browser.grid_mode = false;
+    lv_obj_add_flag(g_browser.grid, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(g_browser.container, LV_OBJ_FLAG_HIDDEN);
+    image_browser_show_image(index);
+}
 
-    struct dirent *entry;
-    int count = 0;
-    int total_scanned = 0;
+static void image_browser_screen_destroy_cb(lv_event_t *e) {
+    (void)e;
+    image_browser_slideshow_stop();
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), image_render_cb, NULL);
+    epub_image_free(&g_browser.image);
+    free_thumbs();
+    if (g_browser.group != NULL) {
+        lv_group_delete(g_browser.group);
+        g_browser.group = NULL;
+    }
+    g_browser.grid_mode = false;
+    g_browser.grid = NULL;
+    g_browser.image_obj = NULL;
+    g_browser.info_label = NULL;
+    g_browser.container = NULL;
+}
 
-    while ((entry = readdir(dir)) != NULL && g_browser.image_count < MAX_IMAGES) {
-        const char *name = entry->d_name;
-        total_scanned++;
+/**
+ * @brief 幻灯片播放定时器回调（LVGL 定时器，在 LVGL 任务中运行）
+ *
+ * 下一张通常已由预解码任务准备好，这里只交换位图并请求刷新；
+ * 显示后立即请求再下一张
+ */
+static void slideshow_timer_callback(lv_timer_t *timer) {
+    (void)timer;
+    // 切换到下一张图片
+    if (!image_browser_next_image()) {
+        // 如果已经是最后一张，回到第一张
+        image_browser_show_image(0);
+    }
+}
 
-        // 跳过 "." 和 ".."
-        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
-            continue;
+// 内存压力回调：释放当前目录以外的图片目录（推迟到轮询时运行，扫描中的槽不会被释放）
+static bool catalog_shrink(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    bool released = false;
+    for (int i = 0; i < IMAGE_CATALOG_SLOTS; i++) {
+        image_catalog_t *c = &s_catalogs[i];
+        if (c != g_browser.catalog && c->dir[0] != '\0') {
+            catalog_free(c);
+            released = true;
         }
+    }
+    return released;
+}
 
-        // 调试：打印所有扫描到的文件
-        ESP_LOGD(TAG, "Scanned file: %s (d_type=%d)", name, entry->d_type);
+bool image_browser_init(void) {
+    ESP_LOGI(TAG, "Initializing image browser...");
 
-        // 检查是否是图片格式
-        image_format_t format = image_browser_get_image_format(name);
-        if (format == IMAGE_FORMAT_UNKNOWN) {
-            continue;
-        }
+    memset(&g_browser, 0, sizeof(image_browser_state_t));
 
-        // 构建完整路径
-        char full_path[MAX_PATH_LEN];
-        int len = snprintf(full_path, MAX_PATH_LEN - 1, "%s/%s", directory, name);
-        if (len >= MAX_PATH_LEN - 1) {
-            full_path[MAX_PATH_LEN - 1] = '\0';
-        }
+    // 创建幻灯片播放定时器（默认 3 秒，开始播放前暂停）
+    s_slideshow_timer = lv_timer_create(slideshow_timer_callback, 3000, NULL);
+    if (s_slideshow_timer == NULL) {
+        ESP_LOGE(TAG, "Failed to create slideshow timer");
+    } else {
+        lv_timer_pause(s_slideshow_timer);
+    }
 
-        // 检查是否是文件（非目录）
-        struct stat st;
-        if (stat(full_path, &st) == 0 && S_ISREG(st.st_mode)) {
-            image_info_t *img = &g_browser.images[g_browser.image_count];
-            strncpy(img->file_path, full_path, sizeof(img->file_path) - 1);
-            img->file_path[sizeof(img->file_path) - 1] = '\0';
-            img->format = format;
+    mem_pressure_register("image_catalog", MEM_PRESSURE_PRIO_CACHE, MEM_PRESSURE_TAG_NONE, 0,
+                          catalog_shrink, NULL);
 
-            const char *format_str[] = {"UNKNOWN", "PNG", "JPEG", "BMP", "GIF"};
-            ESP_LOGI(TAG, "Found image: %s (%s)", name, format_str[format]);
+    // 注意：不在这里扫描目录，由 screen_create 时传入实际目录
+    ESP_LOGI(TAG, "Image browser initialized");
+    return true;
+}
 
-            g_browser.image_count++;
-            count++;
-        }
+int image_browser_scan_directory(const char *directory) {
+    if (directory == NULL) {
+        ESP_LOGE(TAG, "Invalid directory");
+        return 0;
     }
 
-    closedir(dir);
+    ESP_LOGI(TAG, "Scanning directory for images: %s", directory);
 
-    g_browser.current_index = 0;
-    g_browser.total_count = count;
+    // 清理之前的显示状态（目录本身留在缓存里）
+    ahead_cancel();
+    epub_image_free(&g_browser.image);
+    g_browser.catalog = NULL;
+    g_browser.image_count = 0;
+    g_browser.total_count = 0;
+
+    // 停止幻灯片播放
+    image_browser_slideshow_stop();
 
-    ESP_LOGI(TAG, "Scan complete: %d files scanned, found %d images", total_scanned, count);
-    return count;
+    g_browser.catalog = catalog_open(directory);
+    if (g_browser.catalog == NULL) {
+        return 0;
+    }
+    g_browser.image_count = g_browser.catalog->count;
+    g_browser.current_index = 0;
+    g_browser.total_count = g_browser.image_count;
+    return g_browser.image_count;
 }
 
 bool image_browser_show_image(int index) {
@@ -240,26 +839,30 @@ bool image_browser_show_image(int index) {
         return false;
     }
 
-    image_info_t *img = &g_browser.images[index];
+    char path[MAX_PATH_LEN];
+    entry_path(index, path, sizeof(path));
 
-    // 释放之前的图片数据
-    if (img->decoded_data != NULL) {
-        free(img->decoded_data);
-        img->decoded_data = NULL;
-    }
+    // 释放上一张图片的位图
+    epub_image_free(&g_browser.image);
+    lv_obj_invalidate(g_browser.container);
 
-    // 使用 LVGL 内置解码器加载图片（内存优化）
-    if (!load_image_to_lvgl(g_browser.image_obj, img->file_path)) {
-        ESP_LOGE(TAG, "Failed to load image: %s", img->file_path);
+    if (!load_image_bitmap(index) && !load_image_to_lvgl(g_browser.image_obj, path)) {
+        ESP_LOGE(TAG, "Failed to load image: %s", path);
         return false;
     }
 
-    // 更新信息标签
+    // 更新信息标签（原始尺寸只在这里用到，第一次显示时读文件头）
     if (g_browser.info_label != NULL) {
         char info_text[64];
         const char *format_str[] = {"UNK", "PNG", "JPG", "BMP", "GIF"};
-        snprintf(info_text, sizeof(info_text) - 1, "%d/%d - %s",
-                 index + 1, g_browser.image_count, format_str[img->format]);
+        uint32_t width;
+        uint32_t height;
+        int n = snprintf(info_text, sizeof(info_text) - 1, "%d/%d - %s",
+                         index + 1, g_browser.image_count, format_str[entry_format(index)]);
+        if (entry_size(index, &width, &height) && n > 0 && (size_t)n < sizeof(info_text) - 1) {
+            snprintf(info_text + n, sizeof(info_text) - 1 - n, " %ux%u", (unsigned)width,
+                     (unsigned)height);
+        }
         info_text[sizeof(info_text) - 1] = '\0';
         lv_label_set_text(g_browser.info_label, info_text);
     }
@@ -267,14 +870,15 @@ bool image_browser_show_image(int index) {
     // 保存当前索引
     g_browser.current_index = index;
 
-    // 触发刷新
-    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-    lvgl_trigger_render(NULL);
-    lvgl_display_refresh();
+    // 换了一张图：按内容更换刷新
+    screen_manager_refresh(SCREEN_REFRESH_CONTENT);
 
-    const char *filename = strrchr(img->file_path, '/');
-    ESP_LOGI(TAG, "Showing image %d/%d: %s", index + 1, g_browser.image_count,
-             filename ? filename + 1 : img->file_path);
+    ESP_LOGI(TAG, "Showing image %d/%d: %s", index + 1, g_browser.image_count, entry_name(index));
+
+    // 播放中提前准备下一张
+    if (g_browser.is_playing) {
+        ahead_request(index + 1 < g_browser.image_count ? index + 1 : 0);
+    }
 
     return true;
 }
@@ -320,21 +924,22 @@ void image_browser_slideshow_start(int interval_ms) {
 
     ESP_LOGI(TAG, "Starting slideshow with interval: %d ms", interval_ms);
 
-    // 停止之前的定时器
-    xTimerStop(s_slideshow_timer, 0);
-
-    // 设置新的间隔并启动
-    xTimerChangePeriod(s_slideshow_timer, pdMS_TO_TICKS(interval_ms), 0);
-    xTimerStart(s_slideshow_timer, 0);
+    // 设置新的间隔并从现在开始计时
+    lv_timer_set_period(s_slideshow_timer, (uint32_t)interval_ms);
+    lv_timer_reset(s_slideshow_timer);
+    lv_timer_resume(s_slideshow_timer);
 
     g_browser.is_playing = true;
+    const int next = g_browser.current_index + 1;
+    ahead_request(next < g_browser.image_count ? next : 0);
 }
 
 void image_browser_slideshow_stop(void) {
     if (s_slideshow_timer != NULL) {
-        xTimerStop(s_slideshow_timer, 0);
+        lv_timer_pause(s_slideshow_timer);
     }
     g_browser.is_playing = false;
+    ahead_cancel();
 }
 
 void image_browser_cleanup(void) {
@@ -345,20 +950,17 @@ void image_browser_cleanup(void) {
 
     // 释放定时器
     if (s_slideshow_timer != NULL) {
-        xTimerDelete(s_slideshow_timer, 0);
+        lv_timer_delete(s_slideshow_timer);
         s_slideshow_timer = NULL;
     }
 
     // 释放图片数据
-    if (g_browser.images != NULL) {
-        for (int i = 0; i < g_browser.image_count; i++) {
-            if (g_browser.images[i].decoded_data != NULL) {
-                free(g_browser.images[i].decoded_data);
-            }
-        }
-        free(g_browser.images);
-        g_browser.images = NULL;
+    mem_pressure_unregister(catalog_shrink, NULL);
+    epub_image_free(&g_browser.image);
+    for (int i = 0; i < IMAGE_CATALOG_SLOTS; i++) {
+        catalog_free(&s_catalogs[i]);
     }
+    g_browser.catalog = NULL;
 
     g_browser.image_count = 0;
     g_browser.current_index = 0;
@@ -382,10 +984,34 @@ static void image_browser_key_event_cb(lv_event_t *e) {
             ESP_LOGI(TAG, "Back key double-clicked, returning to index screen");
             lvgl_clear_back_key_double_click();
             screen_manager_show_index();
+        } else if (!g_browser.grid_mode) {
+            ESP_LOGI(TAG, "Back key single-clicked, showing thumbnails");
+            grid_enter();
         } else {
             ESP_LOGI(TAG, "Back key single-clicked, returning to file browser");
             screen_manager_go_back();
         }
+        return;
+    }
+
+    const bool back = key == LV_KEY_LEFT || key == LV_KEY_UP;
+    const bool forward = key == LV_KEY_RIGHT || key == LV_KEY_DOWN;
+    if (g_browser.grid_mode) {
+        if (back || forward) {
+            grid_select(g_browser.current_index + (forward ? 1 : -1));
+        } else if (key == LV_KEY_ENTER) {
+            grid_leave(g_browser.current_index);
+        }
+    } else if (back) {
+        image_browser_prev_image();
+    } else if (forward) {
+        image_browser_next_image();
+    } else if (key == LV_KEY_ENTER) {
+        if (g_browser.is_playing) {
+            image_browser_slideshow_stop();
+        } else {
+            image_browser_slideshow_start(3000);
+        }
     }
 }
 
@@ -419,12 +1045,26 @@ void image_browser_screen_create(const char *directory, int start_index, lv_inde
         g_browser.current_index = start_index;
     }
 
+    // 图片值得使用 4 灰阶波形（由灰阶策略决定，策略为 OFF 时保持单色）
+    lvgl_set_content_hint(EPD_CONTENT_IMAGE);
+
     // 创建屏幕
     lv_obj_t *screen = lv_obj_create(NULL);
     lv_scr_load(screen);
 
-    // 注册按键事件处理
+    // 注册按键事件处理（屏幕单独成组，方向键与确认键都发给它）
     lv_obj_add_event_cb(screen, image_browser_key_event_cb, LV_EVENT_KEY, NULL);
+    if (indev != NULL) {
+        lv_indev_set_group(indev, NULL);
+        g_browser.group = lv_group_create();
+        lv_group_add_obj(g_browser.group, screen);
+        lv_indev_set_group(indev, g_browser.group);
+    }
+    lv_obj_add_event_cb(screen, image_browser_screen_destroy_cb, LV_EVENT_DELETE, NULL);
+
+    // PNG/JPEG 位图在每次渲染完成后写入
+    lv_display_add_event_cb(lv_display_get_default(), image_render_cb, LV_EVENT_RENDER_READY,
+                            NULL);
 
     // 设置背景为白色
     lv_obj_set_style_bg_color(screen, lv_color_white(), 0);
@@ -449,6 +1089,40 @@ void image_browser_screen_create(const char *directory, int start_index, lv_inde
     lv_obj_align(g_browser.image_obj, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_border_width(g_browser.image_obj, 0, 0);
 
+    // ========================================
+    // 缩略图网格（返回键进入，确认键打开选中的图片）
+    // ========================================
+    g_browser.grid_mode = false;
+    g_browser.grid = lv_obj_create(screen);
+    lv_obj_set_size(g_browser.grid, 480, 800);
+    lv_obj_align(g_browser.grid, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_set_style_bg_opa(g_browser.grid, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(g_browser.grid, 0, 0);
+    lv_obj_set_style_pad_all(g_browser.grid, 0, 0);
+    lv_obj_remove_flag(g_browser.grid, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(g_browser.grid, LV_OBJ_FLAG_HIDDEN);
+    for (int i = 0; i < IMAGE_GRID_CELLS; i++) {
+        lv_obj_t *cell = lv_obj_create(g_browser.grid);
+        lv_obj_set_size(cell, 480 / IMAGE_GRID_COLS, 800 / IMAGE_GRID_ROWS);
+        lv_obj_set_pos(cell, (i % IMAGE_GRID_COLS) * (480 / IMAGE_GRID_COLS),
+                       (i / IMAGE_GRID_COLS) * (800 / IMAGE_GRID_ROWS));
+        lv_obj_set_style_bg_color(cell, lv_color_white(), 0);
+        lv_obj_set_style_bg_opa(cell, LV_OPA_COVER, 0);
+        lv_obj_set_style_border_color(cell, lv_color_black(), 0);
+        lv_obj_set_style_border_width(cell, 1, 0);
+        lv_obj_set_style_radius(cell, 0, 0);
+        lv_obj_set_style_pad_all(cell, 4, 0);
+        lv_obj_remove_flag(cell, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t *label = lv_label_create(cell);
+        lv_obj_set_width(label, LV_PCT(100));
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+        lv_obj_align(label, LV_ALIGN_CENTER, 0, 0);
+        g_browser.cells[i] = cell;
+    }
+
     // ========================================
     // 信息标签（底部）
     // ========================================
@@ -462,7 +1136,7 @@ void image_browser_screen_create(const char *directory, int start_index, lv_inde
     // 操作提示
     // ========================================
     lv_obj_t *hint1 = lv_label_create(screen);
-    lv_label_set_text(hint1, "Vol+/-: Prev/Next");
+    lv_label_set_text(hint1, "Left/Right: Prev/Next");
     lv_obj_set_style_text_font(hint1, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(hint1, lv_color_black(), 0);
     lv_obj_align(hint1, LV_ALIGN_BOTTOM_LEFT, 20, 780);
@@ -474,7 +1148,7 @@ void image_browser_screen_create(const char *directory, int start_index, lv_inde
     lv_obj_align(hint2, LV_ALIGN_BOTTOM_LEFT, 20, 800);
 
     lv_obj_t *hint3 = lv_label_create(screen);
-    lv_label_set_text(hint3, "Back(4): Return");
+    lv_label_set_text(hint3, "Back(4): Thumbnails");
     lv_obj_set_style_text_font(hint3, &lv_font_montserrat_14, 0);
     lv_obj_set_style_text_color(hint3, lv_color_black(), 0);
     lv_obj_align(hint3, LV_ALIGN_BOTTOM_LEFT, 20, 820);
@@ -482,21 +1156,8 @@ void image_browser_screen_create(const char *directory, int start_index, lv_inde
     // 显示第一张图片
     image_browser_show_image(g_browser.current_index);
 
-    // 全刷确保显示质量
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-    lvgl_clear_framebuffer();
-    lv_obj_invalidate(screen);
-
-    for (int i = 0; i < 3; i++) {
-        lvgl_trigger_render(NULL);
-        vTaskDelay(pdMS_TO_TICKS(10));
-    }
-
-    while (lvgl_is_refreshing()) {
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-
-    lvgl_display_refresh();
+    // 首次显示：刷新方式由 screen_manager 按画面变化量决定
+    screen_manager_refresh(SCREEN_REFRESH_TRANSITION);
 
     ESP_LOGI(TAG, "Image viewer screen created");
 }
@@ -6,6 +6,8 @@
 #ifndef IMAGE_BROWSER_H
 #define IMAGE_BROWSER_H
 
+#include "epub_image.h"
+#include "image_cache.h"
 #include "lvgl.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -23,24 +25,31 @@ typedef enum {
     IMAGE_FORMAT_GIF,
 } image_format_t;
 
-// 图片信息
-typedef struct {
-    char file_path[256];
-    image_format_t format;
-    int width;
-    int height;
-    void *decoded_data;
-    size_t data_size;
-} image_info_t;
+// 缩略图网格（每个格子 160x200，缩略图见 IMAGE_THUMB_*）
+#define IMAGE_GRID_COLS  3
+#define IMAGE_GRID_ROWS  4
+#define IMAGE_GRID_CELLS (IMAGE_GRID_COLS * IMAGE_GRID_ROWS)
+
+// 图片目录（名字池与条目，见 image_browser.c），按目录缓存，屏幕关闭后仍保留
+typedef struct image_catalog image_catalog_t;
 
 // 图片浏览器状态
 typedef struct {
-    image_info_t *images;
+    image_catalog_t *catalog; // 当前目录
     int image_count;
     int current_index;
     int total_count;
     bool is_playing;
-    lv_obj_t *image_obj;
+    lv_obj_t *image_obj;     // BMP/GIF 及自带解码失败时由 LVGL 解码显示
+    epub_image_t image;      // 当前 PNG/JPEG 的抖动位图，渲染完成后写入 framebuffer
+    lv_area_t image_area;
+    bool grid_mode;          // 缩略图网格（返回键从单张进入）
+    int grid_first;          // 网格当前页第一张的索引
+    lv_obj_t *grid;
+    lv_obj_t *cells[IMAGE_GRID_CELLS];
+    epub_image_t thumbs[IMAGE_GRID_CELLS];
+    lv_area_t thumb_areas[IMAGE_GRID_CELLS];
+    lv_group_t *group;
     lv_obj_t *info_label;
     lv_obj_t *container;
 } image_browser_state_t;
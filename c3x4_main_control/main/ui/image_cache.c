@@ -0,0 +1,141 @@
+/**
+ * @file image_cache.c
+ * @brief 图片位图缓存实现
+ */
+
+#include "image_cache.h"
+#include "page_index.h"
+#include "../packbits.h"
+#include "../spi_arbiter.h"
+#include "../heap_stats.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "IMAGE_CACHE";
+
+#define IMAGE_CACHE_MAGIC  0x32434958u  // "XIC2"（2bpp 带照片色调）
+#define IMAGE_CACHE_IO_BUF 1024
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t path_hash;
+    uint32_t src_size;
+    uint32_t src_mtime;
+    uint16_t max_width;
+    uint16_t max_height;
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;
+    uint8_t reserved[3];
+} image_cache_header_t;
+
+static void make_header(image_cache_header_t *hdr, const char *path, const struct stat *st,
+                        int max_width, int max_height, uint8_t bpp) {
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->magic = IMAGE_CACHE_MAGIC;
+    hdr->path_hash = page_index_hash(0, path, strlen(path));
+    hdr->src_size = (uint32_t)st->st_size;
+    hdr->src_mtime = (uint32_t)st->st_mtime;
+    hdr->max_width = (uint16_t)max_width;
+    hdr->max_height = (uint16_t)max_height;
+    hdr->bpp = bpp;
+}
+
+static void cache_path(const image_cache_header_t *key, char *out, size_t out_size) {
+    // 文件名只区分路径、尺寸和位深；源文件大小与时间在文件头里校验
+    const uint16_t dims[3] = {key->max_width, key->max_height, key->bpp};
+    const uint32_t hash = page_index_hash(key->path_hash, dims, sizeof(dims));
+    snprintf(out, out_size, IMAGE_CACHE_DIR "/%08lx.xic", (unsigned long)hash);
+}
+
+static uint16_t image_stride(uint16_t width, uint8_t bpp) {
+    return (uint16_t)(((uint32_t)width * bpp + 7) / 8);
+}
+
+static bool load_cached(const char *file, const image_cache_header_t *key, epub_image_t *image) {
+    FILE *f = fopen(file, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    setvbuf(f, NULL, _IOFBF, IMAGE_CACHE_IO_BUF);
+    image_cache_header_t hdr;
+    bool ok = false;
+    spi_arbiter_sd_begin();
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == key->magic &&
+        hdr.path_hash == key->path_hash && hdr.src_size == key->src_size &&
+        hdr.src_mtime == key->src_mtime && hdr.max_width == key->max_width &&
+        hdr.max_height == key->max_height && hdr.bpp == key->bpp && hdr.width > 0 &&
+        hdr.height > 0 && hdr.width <= hdr.max_width && hdr.height <= hdr.max_height) {
+        const uint16_t stride = image_stride(hdr.width, hdr.bpp);
+        const size_t size = (size_t)stride * hdr.height;
+        uint8_t *bits = (uint8_t *)heap_stats_malloc(HEAP_TAG_IMAGE, size);
+        if (bits != NULL && packbits_read(f, bits, size)) {
+            image->data = bits;
+            image->bits = bits;
+            image->width = hdr.width;
+            image->height = hdr.height;
+            image->stride = stride;
+            image->bpp = hdr.bpp;
+            ok = true;
+        } else {
+            heap_stats_free(HEAP_TAG_IMAGE, bits);
+        }
+    }
+    spi_arbiter_sd_end();
+    fclose(f);
+    return ok;
+}
+
+static void store(const char *file, const image_cache_header_t *key, const epub_image_t *image) {
+    mkdir("/sdcard/.x4cache", 0775);
+    mkdir(IMAGE_CACHE_DIR, 0775);
+    FILE *f = fopen(file, "wb");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot create %s", file);
+        return;
+    }
+    image_cache_header_t hdr = *key;
+    hdr.width = image->width;
+    hdr.height = image->height;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 &&
+              packbits_write(f, image->bits, (size_t)image->stride * image->height);
+    const long size = ftell(f);
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        remove(file);
+        return;
+    }
+    ESP_LOGD(TAG, "Stored %s: %ux%u %ubpp, %ld bytes", file, image->width, image->height,
+             image->bpp, size);
+}
+
+bool image_cache_load(const char *path, int max_width, int max_height, uint8_t bpp,
+                      epub_image_t *image) {
+    if (image == NULL) {
+        return false;
+    }
+    memset(image, 0, sizeof(*image));
+    struct stat st;
+    if (path == NULL || stat(path, &st) != 0 || max_width <= 0 || max_height <= 0 ||
+        max_width > UINT16_MAX || max_height > UINT16_MAX) {
+        return false;
+    }
+
+    image_cache_header_t key;
+    make_header(&key, path, &st, max_width, max_height, bpp);
+    char file[64];
+    cache_path(&key, file, sizeof(file));
+    if (load_cached(file, &key, image)) {
+        ESP_LOGD(TAG, "Cached %s: %ux%u", path, image->width, image->height);
+        return true;
+    }
+
+    if (!epub_image_decode_file(path, max_width, max_height, bpp, image)) {
+        return false;
+    }
+    store(file, &key, image);
+    return true;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file image_cache.h
+ * @brief 图片浏览器的位图缓存 - 缩放、抖动后的面板位图按 PackBits 压缩保存在 SD 卡
+ *
+ * 每个（图片路径、目标尺寸、位深）一个文件 IMAGE_CACHE_DIR/<哈希>.xic，文件头记录源文件的
+ * 大小和修改时间，原图被替换后自动重新解码。整屏 1bpp 位图原始 48 KB，照片压缩后通常
+ * 一半以下，线稿和漫画只有几 KB；命中时只需读出解压，不再运行 JPEG/PNG 解码。
+ *
+ * 缩略图（IMAGE_THUMB_WIDTH x IMAGE_THUMB_HEIGHT）是同一种缓存，只是目标尺寸不同，
+ * JPEG 用 1/8 缩放解出，生成很快
+ */
+
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include "epub_image.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IMAGE_CACHE_DIR     "/sdcard/.x4cache/img"
+#define IMAGE_THUMB_WIDTH   144
+#define IMAGE_THUMB_HEIGHT  176
+
+/**
+ * @brief 读取缓存的位图，未命中（或原图已改变）时解码并写入缓存
+ *
+ * @param path 图片路径（/sdcard/...）
+ * @param max_width 最大宽度
+ * @param max_height 最大高度
+ * @param bpp 1 或 2，见 epub_image_decode_file
+ * @param image 输出，用完调用 epub_image_free()
+ * @return true 成功
+ */
+bool image_cache_load(const char *path, int max_width, int max_height, uint8_t bpp,
+                      epub_image_t *image);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMAGE_CACHE_H
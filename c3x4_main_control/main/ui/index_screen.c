@@ -7,6 +7,8 @@
 #include "../lvgl_driver.h"
 #include "core/lv_obj_style_gen.h"
 #include "screen_manager.h"
+#include "status_refresh.h"
+#include "../ble_power.h"
 #include "esp_log.h"
 #include <stdio.h>
 #include <string.h>
@@ -29,6 +31,44 @@ static void index_screen_destroy_cb(lv_event_t *e);
 // 保存 group 指针用于调试
 static lv_group_t *s_index_group = NULL;
 
+// 电量、充电状态与时钟：电池服务发布新值或分钟变化时由 status_refresh 只局刷这两行
+static lv_obj_t *s_bat_label = NULL;
+static lv_obj_t *s_charge_label = NULL;
+
+static void index_set_battery_labels(uint32_t battery_mv, uint8_t battery_pct, bool charging)
+{
+    char bat_str[64];
+    char clock[8];
+    snprintf(bat_str, sizeof(bat_str), "Battery: %" PRIu32 " mV (%u%%)", battery_mv, battery_pct);
+    lv_label_set_text(s_bat_label, bat_str);
+    const char *status = charging ? "Status: Charging" : "Status: On Battery";
+    if (status_refresh_format_clock(clock, sizeof(clock))) {
+        lv_label_set_text_fmt(s_charge_label, "%s    %s", status, clock);
+    } else {
+        lv_label_set_text(s_charge_label, status);
+    }
+}
+
+static void index_status_update_cb(bool battery_changed)
+{
+    (void)battery_changed;
+    const screen_context_t *ctx = screen_manager_get_context();
+    index_set_battery_labels(ctx->battery_mv, ctx->battery_pct, ctx->charging);
+}
+
+// 「BLE Reader」按钮文字随蓝牙状态变化
+static void index_update_ble_label(void)
+{
+    lv_obj_t *btn = index_menu_buttons[1];
+    lv_obj_t *label = btn ? lv_obj_get_child(btn, 0) : NULL;
+    if (label == NULL) {
+        return;
+    }
+    lv_label_set_text(label, ble_power_is_on() ? "2. BLE Reader (Bluetooth on)" : "2. BLE Reader");
+    lv_obj_invalidate(btn);
+    screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+}
+
 static void index_activate_menu(uint16_t menu_index)
 {
     ESP_LOGI(TAG, "Menu activated: %u", menu_index);
@@ -36,15 +76,19 @@ static void index_activate_menu(uint16_t menu_index)
     switch (menu_index) {
         case 0:  // SDCard File Browser
             ESP_LOGI(TAG, "Launching SD Card File Browser...");
-            lvgl_reset_refresh_state();
             screen_manager_show_file_browser();
             break;
-        case 1:  // BLE Reader
-            ESP_LOGI(TAG, "BLE Reader selected (not implemented yet)");
+        case 1:  // BLE Reader：蓝牙开机不启动，进入时按需打开
+            ESP_LOGI(TAG, "BLE Reader selected, starting Bluetooth");
+            // 准备传书：预先分配传输缓冲区（完整档，空闲后自动退回精简档）
+            ble_power_set_profile(BLE_POWER_PROFILE_FULL);
+            if (!ble_power_set(true)) {
+                ESP_LOGW(TAG, "Bluetooth start failed");
+            }
+            index_update_ble_label();
             break;
         case 2:  // Settings
             ESP_LOGI(TAG, "Launching Settings...");
-            lvgl_reset_refresh_state();
             screen_manager_show_settings();
             break;
         default:
@@ -70,23 +114,13 @@ static void index_button_focus_event_cb(lv_event_t *e)
             }
         }
 
-        // 组件内操作：使用局刷模式（PARTIAL）提升响应速度
-        // 焦点切换是小范围更新，局刷足够且更快
-        // 重要：必须先设置刷新模式，再触发渲染，否则脏区不会被记录
-        lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-
-        // 手动刷新模式(RENDER_MODE_DIRECT): 必须手动触发渲染和刷新
-        // lv_obj_invalidate() 只标记需要重绘,但不会自动触发flush_cb
-        lv_obj_invalidate(btn);
-
-        // 触发LVGL渲染
-        lvgl_trigger_render(NULL);
+        // 手动刷新模式: 只重绘并局刷失去焦点和获得焦点的两个按钮
+        lv_obj_t *from = s_last_focused_button;
 
         // 记录当前焦点按钮
         s_last_focused_button = btn;
 
-        // 触发EPD刷新
-        lvgl_display_refresh();
+        screen_manager_refresh_focus(from, btn);
     }
     else if (code == LV_EVENT_DEFOCUSED) {
         ESP_LOGI(TAG, "Button defocused: %p", btn);
@@ -99,10 +133,7 @@ static void index_button_focus_event_cb(lv_event_t *e)
             }
         }
 
-        // 手动刷新模式: 使失去焦点的按钮无效并触发渲染
-        // DEFOCUS和FOCUS会连续触发,只需在FOCUS时刷新EPD即可
-        lv_obj_invalidate(btn);
-        lvgl_trigger_render(NULL);
+        // DEFOCUS和FOCUS会连续触发,失去焦点的按钮在FOCUS时一并局刷
     }
 }
 
@@ -141,6 +172,14 @@ static void index_menu_button_event_cb(lv_event_t *e)
         ESP_LOGI(TAG, "Button %u clicked", btn_index);
         index_activate_menu(btn_index);
     }
+    // 长按任意菜单按钮打开蓝牙（长按松开后还会收到 CLICKED，ble_power_set 可重复调用）
+    else if (code == LV_EVENT_LONG_PRESSED) {
+        ESP_LOGI(TAG, "Button %u long-pressed, starting Bluetooth", btn_index);
+        if (!ble_power_set(true)) {
+            ESP_LOGW(TAG, "Bluetooth start failed");
+        }
+        index_update_ble_label();
+    }
 }
 
 static void index_screen_destroy_cb(lv_event_t *e)
@@ -150,10 +189,45 @@ static void index_screen_destroy_cb(lv_event_t *e)
     for (int i = 0; i < 3; i++) {
         index_menu_buttons[i] = NULL;
     }
-    s_index_group = NULL;
+    if (s_index_group != NULL) {
+        lv_group_delete(s_index_group);
+        s_index_group = NULL;
+    }
     s_last_focused_button = NULL;
+    status_refresh_stop();
+    s_bat_label = NULL;
+    s_charge_label = NULL;
+}
+
+// 保活：离开首页时屏幕留在 screen_manager 的缓存中，只停止状态轮询
+static void index_screen_suspend(void)
+{
+    status_refresh_stop();
+}
+
+// 从缓存重新载入：恢复输入组，补上离开期间的电量与蓝牙状态变化（刷新由 screen_manager 统一做）
+static void index_screen_resume(void)
+{
+    const screen_context_t *ctx = screen_manager_get_context();
+    if (ctx->indev != NULL && s_index_group != NULL) {
+        lv_indev_set_group(ctx->indev, s_index_group);
+    }
+    (void)screen_manager_update_battery();
+    index_set_battery_labels(ctx->battery_mv, ctx->battery_pct, ctx->charging);
+    lv_obj_t *ble_label = index_menu_buttons[1] ? lv_obj_get_child(index_menu_buttons[1], 0) : NULL;
+    if (ble_label != NULL) {
+        lv_label_set_text(ble_label, ble_power_is_on() ? "2. BLE Reader (Bluetooth on)" : "2. BLE Reader");
+    }
+    if (s_bat_label != NULL) {
+        status_refresh_start(s_bat_label, index_status_update_cb);
+    }
 }
 
+static const screen_keepalive_ops_t s_index_keepalive = {
+    .suspend = index_screen_suspend,
+    .resume = index_screen_resume,
+};
+
 void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging, const char *version_str, lv_indev_t *indev)
 {
     ESP_LOGI(TAG, "Creating Monster For Pan menu screen");
@@ -203,20 +277,19 @@ void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging
     lv_obj_align(info_label, LV_ALIGN_TOP_LEFT, 20, 85);
 
     // 电池信息
-    char bat_str[64];
-    snprintf(bat_str, sizeof(bat_str), "Battery: %" PRIu32 " mV (%u%%)", battery_mv, battery_pct);
-    lv_obj_t *bat_label = lv_label_create(screen);
-    lv_label_set_text(bat_label, bat_str);
-    lv_obj_set_style_text_font(bat_label, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_text_color(bat_label, lv_color_black(), 0);
-    lv_obj_align(bat_label, LV_ALIGN_TOP_LEFT, 20, 108);
+    s_bat_label = lv_label_create(screen);
+    lv_obj_set_style_text_font(s_bat_label, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(s_bat_label, lv_color_black(), 0);
+    lv_obj_align(s_bat_label, LV_ALIGN_TOP_LEFT, 20, 108);
 
     // 充电状态
-    lv_obj_t *status_label = lv_label_create(screen);
-    lv_label_set_text(status_label, charging ? "Status: Charging" : "Status: On Battery");
-    lv_obj_set_style_text_font(status_label, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_text_color(status_label, lv_color_black(), 0);
-    lv_obj_align(status_label, LV_ALIGN_TOP_LEFT, 20, 128);
+    s_charge_label = lv_label_create(screen);
+    lv_obj_set_style_text_font(s_charge_label, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(s_charge_label, lv_color_black(), 0);
+    lv_obj_align(s_charge_label, LV_ALIGN_TOP_LEFT, 20, 128);
+
+    index_set_battery_labels(battery_mv, battery_pct, charging);
+    status_refresh_start(s_bat_label, index_status_update_cb);
 
     // ========================================
     // 第3部分: 菜单选择区域
@@ -279,7 +352,8 @@ void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging
 
         // 按钮标签
         lv_obj_t *label = lv_label_create(btn);
-        lv_label_set_text(label, button_texts[i]);
+        lv_label_set_text(label, (i == 1 && ble_power_is_on()) ? "2. BLE Reader (Bluetooth on)"
+                                                               : button_texts[i]);
         lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
         lv_obj_set_style_text_color(label, lv_color_black(), 0);  // 默认黑字
         lv_obj_center(label);
@@ -293,6 +367,8 @@ void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging
         lv_obj_add_event_cb(btn, index_button_focus_event_cb, LV_EVENT_DEFOCUSED, NULL);
         // 监听 CLICKED 事件（由 ENTER 键触发）
         lv_obj_add_event_cb(btn, index_menu_button_event_cb, LV_EVENT_CLICKED, NULL);
+        // 监听 LONG_PRESSED 事件（长按 ENTER 打开蓝牙）
+        lv_obj_add_event_cb(btn, index_menu_button_event_cb, LV_EVENT_LONG_PRESSED, NULL);
 
         // 保存按钮指针
         index_menu_buttons[i] = btn;
@@ -371,20 +447,11 @@ void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging
                  lv_group_get_obj_count(s_index_group), lv_group_get_wrap(s_index_group));
     }
 
-    // 强制 LVGL 完成初始渲染（手动刷新模式）
-    // 先清空 framebuffer 为白色，确保旧数据被覆盖
-    lvgl_clear_framebuffer();
-
-    // 先使屏幕无效，确保 LVGL 重新渲染所有内容
-    lv_obj_invalidate(screen);
-
-    // 使用手动刷新模式：触发渲染
-    for (int i = 0; i < 5; i++) {
-        lvgl_trigger_render(NULL);  // 触发 LVGL 渲染
-    }
+    // 首次显示（手动刷新模式）：清屏、整屏渲染，刷新方式由 screen_manager 按画面变化量决定
+    screen_manager_refresh(SCREEN_REFRESH_TRANSITION);
 
-    // 初始刷新 EPD - 由 screen_manager 设置刷新模式（组件间切换用 FULL）
-    lvgl_display_refresh();
+    // 首页对象很少，离开时保留，返回时不再重建
+    screen_manager_set_keepalive(SCREEN_TYPE_INDEX, &s_index_keepalive);
 
     ESP_LOGI(TAG, "Monster For Pan menu screen created successfully");
 }
@@ -0,0 +1,563 @@
+/**
+ * @file library_db.c
+ * @brief 书库数据库与后台索引器实现
+ */
+
+#include "library_db.h"
+#include "epub_image.h"
+#include "epub_parser.h"
+#include "page_index.h"
+#include "lvgl.h"
+#include "lvgl_driver.h"
+#include "esp_log.h"
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+static const char *TAG = "LIBRARY_DB";
+
+#define DB_MAGIC         0x4244424C  // "LBDB"
+#define DB_VERSION       1
+#define DB_KEYS_GROW     32          // 内存键表每次扩充的项数
+
+#define INDEX_ROOT       "/sdcard"
+#define INDEX_PERIOD_MS  200         // 定时器周期
+#define INDEX_SLICE_MS   15          // 每次最多占用 LVGL 任务的时长（解析一本书除外）
+#define INDEX_MAX_DEPTH  6           // 最多进入的目录层数
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t count;          // 已使用的槽位数（高水位）
+    uint32_t reserved;
+} db_header_t;
+
+// 键表项：path_hash 为 0 表示空槽；check 是整条记录的哈希，写到一半的记录读出时被丢弃
+typedef struct __attribute__((packed)) {
+    uint32_t path_hash;
+    uint32_t file_size;
+    uint32_t mtime;
+    uint32_t check;
+} db_key_t;
+
+typedef struct {
+    library_book_t book;
+    uint8_t thumb[LIBRARY_THUMB_BYTES];
+} db_record_t;
+
+#define DB_KEYS_OFFSET    ((long)sizeof(db_header_t))
+#define DB_RECORDS_OFFSET (DB_KEYS_OFFSET + (long)(LIBRARY_DB_MAX_BOOKS * sizeof(db_key_t)))
+
+static struct {
+    FILE *file;
+    db_key_t *keys;          // 前 count 项
+    int count;
+    int capacity;
+} s_db;
+
+static db_record_t s_record;  // 读写记录的缓冲区（单任务使用，不放在栈上）
+
+static struct {
+    lv_timer_t *timer;
+    DIR *dirs[INDEX_MAX_DEPTH];
+    size_t path_len[INDEX_MAX_DEPTH];  // 每层目录路径的长度
+    int depth;
+    char path[256];
+    uint8_t seen[LIBRARY_DB_MAX_BOOKS / 8];  // 本轮扫描中仍在卡上的槽位
+    int indexed;
+} s_index;
+
+static uint32_t path_key(const char *path) {
+    const uint32_t h = page_index_hash(0, path, strlen(path));
+    return h != 0 ? h : 1;
+}
+
+static library_book_type_t book_type(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if (ext == NULL) {
+        return 0;
+    }
+    if (strcasecmp(ext, ".epub") == 0) {
+        return LIBRARY_BOOK_EPUB;
+    }
+    if (strcasecmp(ext, ".txt") == 0 || strcasecmp(ext, ".gz") == 0) {
+        return LIBRARY_BOOK_TXT;
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// 数据库文件
+// ---------------------------------------------------------------------------
+
+static bool write_at(long offset, const void *data, size_t size) {
+    return fseek(s_db.file, offset, SEEK_SET) == 0 && fwrite(data, 1, size, s_db.file) == size;
+}
+
+static bool read_at(long offset, void *data, size_t size) {
+    return fseek(s_db.file, offset, SEEK_SET) == 0 && fread(data, 1, size, s_db.file) == size;
+}
+
+static bool write_header(void) {
+    const db_header_t header = {
+        .magic = DB_MAGIC,
+        .version = DB_VERSION,
+        .record_size = sizeof(db_record_t),
+        .count = (uint32_t)s_db.count,
+    };
+    return write_at(0, &header, sizeof(header));
+}
+
+static bool reserve_keys(int count) {
+    if (count <= s_db.capacity) {
+        return true;
+    }
+    int capacity = (count + DB_KEYS_GROW - 1) / DB_KEYS_GROW * DB_KEYS_GROW;
+    if (capacity > LIBRARY_DB_MAX_BOOKS) {
+        capacity = LIBRARY_DB_MAX_BOOKS;
+    }
+    db_key_t *grown = realloc(s_db.keys, capacity * sizeof(db_key_t));
+    if (grown == NULL) {
+        return false;
+    }
+    s_db.keys = grown;
+    s_db.capacity = capacity;
+    return true;
+}
+
+static bool load_existing(void) {
+    db_header_t header;
+    if (!read_at(0, &header, sizeof(header)) || header.magic != DB_MAGIC ||
+        header.version != DB_VERSION || header.record_size != sizeof(db_record_t) ||
+        header.count > LIBRARY_DB_MAX_BOOKS) {
+        return false;
+    }
+    if (!reserve_keys((int)header.count)) {
+        return false;
+    }
+    if (header.count > 0 && !read_at(DB_KEYS_OFFSET, s_db.keys, header.count * sizeof(db_key_t))) {
+        return false;
+    }
+    s_db.count = (int)header.count;
+    return true;
+}
+
+// 新建数据库：文件头 + 全零的键表
+static bool create_new(void) {
+    s_db.count = 0;
+    if (!write_header()) {
+        return false;
+    }
+    static const uint8_t zeros[256];
+    for (size_t done = 0; done < LIBRARY_DB_MAX_BOOKS * sizeof(db_key_t); done += sizeof(zeros)) {
+        if (fwrite(zeros, 1, sizeof(zeros), s_db.file) != sizeof(zeros)) {
+            return false;
+        }
+    }
+    return fflush(s_db.file) == 0;
+}
+
+static bool db_open(void) {
+    if (s_db.file != NULL) {
+        return true;
+    }
+    s_db.file = fopen(LIBRARY_DB_PATH, "r+b");
+    if (s_db.file != NULL) {
+        if (load_existing()) {
+            ESP_LOGI(TAG, "Opened library: %d slots", s_db.count);
+            return true;
+        }
+        ESP_LOGW(TAG, "Discarding invalid library database");
+        fclose(s_db.file);
+    }
+
+    mkdir(PAGE_INDEX_DIR, 0775);
+    s_db.file = fopen(LIBRARY_DB_PATH, "w+b");
+    if (s_db.file == NULL) {
+        ESP_LOGW(TAG, "Cannot create %s (errno=%d)", LIBRARY_DB_PATH, errno);
+        return false;
+    }
+    if (!create_new()) {
+        ESP_LOGW(TAG, "Failed to initialize %s", LIBRARY_DB_PATH);
+        fclose(s_db.file);
+        s_db.file = NULL;
+        remove(LIBRARY_DB_PATH);
+        return false;
+    }
+    ESP_LOGI(TAG, "Created %s", LIBRARY_DB_PATH);
+    return true;
+}
+
+static bool write_key(int index) {
+    return write_at(DB_KEYS_OFFSET + index * (long)sizeof(db_key_t), &s_db.keys[index],
+                    sizeof(db_key_t));
+}
+
+// 读出槽位的记录到 s_record 并校验
+static bool load_record(int index) {
+    if (index < 0 || index >= s_db.count || s_db.keys[index].path_hash == 0) {
+        return false;
+    }
+    if (!read_at(DB_RECORDS_OFFSET + index * (long)sizeof(db_record_t), &s_record,
+                 sizeof(s_record))) {
+        return false;
+    }
+    if (page_index_hash(0, &s_record, sizeof(s_record)) != s_db.keys[index].check) {
+        ESP_LOGW(TAG, "Corrupt record in slot %d", index);
+        return false;
+    }
+    s_record.book.path[LIBRARY_PATH_MAX - 1] = '\0';
+    s_record.book.title[sizeof(s_record.book.title) - 1] = '\0';
+    s_record.book.author[sizeof(s_record.book.author) - 1] = '\0';
+    s_record.book.language[sizeof(s_record.book.language) - 1] = '\0';
+    return true;
+}
+
+// 写入 s_record：先写记录、再写键，中途断电时键的校验对不上，记录被当作不存在
+static int store_record(uint32_t hash, const struct stat *st) {
+    int slot = -1;
+    int free_slot = -1;
+    for (int i = 0; i < s_db.count; i++) {
+        if (s_db.keys[i].path_hash == hash) {
+            slot = i;
+            break;
+        }
+        if (free_slot < 0 && s_db.keys[i].path_hash == 0) {
+            free_slot = i;
+        }
+    }
+    if (slot < 0) {
+        slot = free_slot;
+    }
+    const bool append = slot < 0;
+    if (append) {
+        if (s_db.count >= LIBRARY_DB_MAX_BOOKS || !reserve_keys(s_db.count + 1)) {
+            ESP_LOGW(TAG, "Library is full, not adding %s", s_record.book.path);
+            return -1;
+        }
+        slot = s_db.count;
+    }
+
+    const db_key_t key = {
+        .path_hash = hash,
+        .file_size = (uint32_t)st->st_size,
+        .mtime = (uint32_t)st->st_mtime,
+        .check = page_index_hash(0, &s_record, sizeof(s_record)),
+    };
+    if (!write_at(DB_RECORDS_OFFSET + slot * (long)sizeof(db_record_t), &s_record,
+                  sizeof(s_record))) {
+        ESP_LOGW(TAG, "Failed to write record for %s", s_record.book.path);
+        return -1;
+    }
+    s_db.keys[slot] = key;
+    if (append) {
+        s_db.count++;
+    }
+    bool ok = write_key(slot) && (!append || write_header());
+    ok = fflush(s_db.file) == 0 && ok;
+    return ok ? slot : -1;
+}
+
+static bool key_current(int slot, const struct stat *st) {
+    return slot >= 0 && s_db.keys[slot].file_size == (uint32_t)st->st_size &&
+           s_db.keys[slot].mtime == (uint32_t)st->st_mtime;
+}
+
+// ---------------------------------------------------------------------------
+// 提取书籍信息
+// ---------------------------------------------------------------------------
+
+static void title_from_filename(const char *path, char *title, size_t size) {
+    const char *name = strrchr(path, '/');
+    strncpy(title, name ? name + 1 : path, size - 1);
+    title[size - 1] = '\0';
+    char *dot = strrchr(title, '.');
+    if (dot != NULL && dot != title) {
+        // book.txt.gz 去掉两层扩展名
+        const bool gz = strcasecmp(dot, ".gz") == 0;
+        *dot = '\0';
+        dot = gz ? strrchr(title, '.') : NULL;
+        if (dot != NULL && dot != title) {
+            *dot = '\0';
+        }
+    }
+}
+
+static void read_cover(const epub_reader_t *reader, library_book_t *book, uint8_t *thumb) {
+    if (reader->cover_path[0] == '\0') {
+        return;
+    }
+    epub_image_t image;
+    if (!epub_image_load(reader, reader->cover_path, LIBRARY_THUMB_WIDTH, LIBRARY_THUMB_HEIGHT,
+                         &image)) {
+        ESP_LOGW(TAG, "Cannot decode cover %s", reader->cover_path);
+        return;
+    }
+    for (int y = 0; y < image.height; y++) {
+        memcpy(thumb + y * LIBRARY_THUMB_STRIDE, image.bits + y * image.stride, image.stride);
+    }
+    book->thumb_width = (uint8_t)image.width;
+    book->thumb_height = (uint8_t)image.height;
+    epub_image_free(&image);
+}
+
+static void read_epub(const char *path, library_book_t *book, uint8_t *thumb) {
+    epub_reader_t *reader = malloc(sizeof(epub_reader_t));
+    if (reader == NULL) {
+        return;
+    }
+    // 元数据与封面都走 EPUB 缓存，之后打开这本书时也能直接命中
+    if (epub_parser_init(reader) && epub_parser_open(reader, path)) {
+        const epub_metadata_t *metadata = epub_parser_get_metadata(reader);
+        strncpy(book->title, metadata->title, sizeof(book->title) - 1);
+        strncpy(book->author, metadata->author, sizeof(book->author) - 1);
+        strncpy(book->language, metadata->language, sizeof(book->language) - 1);
+        read_cover(reader, book, thumb);
+        epub_parser_close(reader);
+    } else {
+        ESP_LOGW(TAG, "Cannot open %s, listing it by file name", path);
+    }
+    free(reader);
+}
+
+// 解析一本书填入 s_record 并写入数据库；打不开的书也按文件名入库，文件不变就不再重试
+static int index_book(const char *path, library_book_type_t type, const struct stat *st) {
+    memset(&s_record, 0, sizeof(s_record));
+    memset(s_record.thumb, 0xFF, sizeof(s_record.thumb));
+    library_book_t *book = &s_record.book;
+    strncpy(book->path, path, sizeof(book->path) - 1);
+    book->file_size = (uint32_t)st->st_size;
+    book->type = (uint8_t)type;
+    if (type == LIBRARY_BOOK_EPUB) {
+        read_epub(path, book, s_record.thumb);
+    }
+    if (book->title[0] == '\0') {
+        title_from_filename(path, book->title, sizeof(book->title));
+    }
+    const int slot = store_record(path_key(path), st);
+    if (slot >= 0) {
+        ESP_LOGI(TAG, "Indexed %s: '%s' by '%s'%s", path, book->title, book->author,
+                 book->thumb_width > 0 ? " (cover)" : "");
+    }
+    return slot;
+}
+
+// ---------------------------------------------------------------------------
+// 查询
+// ---------------------------------------------------------------------------
+
+int library_db_count(void) {
+    return db_open() ? s_db.count : 0;
+}
+
+int library_db_find(const char *path) {
+    if (path == NULL || !db_open()) {
+        return -1;
+    }
+    const uint32_t hash = path_key(path);
+    for (int i = 0; i < s_db.count; i++) {
+        if (s_db.keys[i].path_hash == hash) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool library_db_get(int index, library_book_t *book) {
+    if (book == NULL || !db_open() || !load_record(index)) {
+        return false;
+    }
+    *book = s_record.book;
+    return true;
+}
+
+bool library_db_thumbnail(int index, uint8_t *bits) {
+    if (bits == NULL || !db_open() || !load_record(index) || s_record.book.thumb_width == 0) {
+        return false;
+    }
+    memcpy(bits, s_record.thumb, LIBRARY_THUMB_BYTES);
+    return true;
+}
+
+bool library_db_update(const char *path) {
+    if (path == NULL || strlen(path) >= LIBRARY_PATH_MAX) {
+        return false;
+    }
+    const library_book_type_t type = book_type(path);
+    struct stat st;
+    if (type == 0 || stat(path, &st) != 0 || !db_open()) {
+        return false;
+    }
+    if (key_current(library_db_find(path), &st)) {
+        return true;
+    }
+    return index_book(path, type, &st) >= 0;
+}
+
+// ---------------------------------------------------------------------------
+// 后台扫描
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    STEP_MORE,   // 处理了一个目录项，可以继续
+    STEP_BOOK,   // 解析了一本书，本次时间片结束
+    STEP_DONE,   // 扫描完成
+} index_step_t;
+
+static void close_dirs(void) {
+    while (s_index.depth > 0) {
+        closedir(s_index.dirs[--s_index.depth]);
+    }
+}
+
+static bool push_dir(void) {
+    if (s_index.depth >= INDEX_MAX_DEPTH) {
+        return false;
+    }
+    DIR *dir = opendir(s_index.path);
+    if (dir == NULL) {
+        return false;
+    }
+    s_index.dirs[s_index.depth] = dir;
+    s_index.path_len[s_index.depth] = strlen(s_index.path);
+    s_index.depth++;
+    return true;
+}
+
+static void mark_seen(int slot) {
+    if (slot >= 0) {
+        s_index.seen[slot / 8] |= (uint8_t)(1u << (slot % 8));
+    }
+}
+
+// 扫描完整结束后删除已不在卡上的书
+static void purge_unseen(void) {
+    int removed = 0;
+    for (int i = 0; i < s_db.count; i++) {
+        if (s_db.keys[i].path_hash != 0 && !(s_index.seen[i / 8] & (1u << (i % 8)))) {
+            memset(&s_db.keys[i], 0, sizeof(db_key_t));
+            write_key(i);
+            removed++;
+        }
+    }
+    if (removed > 0) {
+        fflush(s_db.file);
+    }
+    ESP_LOGI(TAG, "Scan finished: %d indexed, %d removed", s_index.indexed, removed);
+}
+
+static index_step_t index_step(void) {
+    if (s_index.depth == 0) {
+        return STEP_DONE;
+    }
+    const size_t base = s_index.path_len[s_index.depth - 1];
+    s_index.path[base] = '\0';
+
+    struct dirent *entry = readdir(s_index.dirs[s_index.depth - 1]);
+    if (entry == NULL) {
+        closedir(s_index.dirs[--s_index.depth]);
+        return STEP_MORE;
+    }
+    // 跳过 "."、".." 与隐藏目录（包括 .x4cache）
+    if (entry->d_name[0] == '.') {
+        return STEP_MORE;
+    }
+    const int len = snprintf(s_index.path + base, sizeof(s_index.path) - base, "/%s", entry->d_name);
+    if (len < 0 || (size_t)len >= sizeof(s_index.path) - base) {
+        return STEP_MORE;
+    }
+
+    const library_book_type_t type = book_type(entry->d_name);
+    struct stat st;
+    if (type == 0) {
+        // FATFS 提供 d_type，只有未知时才 stat
+        const bool is_dir = entry->d_type == DT_DIR ||
+                            (entry->d_type == DT_UNKNOWN && stat(s_index.path, &st) == 0 &&
+                             S_ISDIR(st.st_mode));
+        if (is_dir) {
+            push_dir();
+        }
+        return STEP_MORE;
+    }
+    if (strlen(s_index.path) >= LIBRARY_PATH_MAX || stat(s_index.path, &st) != 0 ||
+        !S_ISREG(st.st_mode)) {
+        return STEP_MORE;
+    }
+
+    const int slot = library_db_find(s_index.path);
+    if (key_current(slot, &st)) {
+        mark_seen(slot);
+        return STEP_MORE;
+    }
+    const int stored = index_book(s_index.path, type, &st);
+    mark_seen(stored);
+    if (stored >= 0) {
+        s_index.indexed++;
+    }
+    return STEP_BOOK;
+}
+
+static void index_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    // 刷新任务正在上传时让出，避免与之争抢 CPU 和 SPI
+    if (lvgl_is_refreshing()) {
+        return;
+    }
+
+    const uint32_t t0 = lv_tick_get();
+    while (lv_tick_elaps(t0) < INDEX_SLICE_MS) {
+        const index_step_t step = index_step();
+        if (step == STEP_BOOK) {
+            return;
+        }
+        if (step == STEP_DONE) {
+            purge_unseen();
+            library_db_index_stop();
+            return;
+        }
+    }
+}
+
+void library_db_index_start(void) {
+    if (s_index.timer != NULL || !db_open()) {
+        return;
+    }
+    memset(&s_index, 0, sizeof(s_index));
+    strcpy(s_index.path, INDEX_ROOT);
+    if (!push_dir()) {
+        ESP_LOGW(TAG, "Cannot open %s", INDEX_ROOT);
+        return;
+    }
+    s_index.timer = lv_timer_create(index_timer_cb, INDEX_PERIOD_MS, NULL);
+    if (s_index.timer == NULL) {
+        close_dirs();
+        return;
+    }
+    ESP_LOGI(TAG, "Library scan started");
+}
+
+void library_db_index_stop(void) {
+    if (s_index.timer != NULL) {
+        lv_timer_delete(s_index.timer);
+        s_index.timer = NULL;
+    }
+    close_dirs();
+}
+
+bool library_db_is_indexing(void) {
+    return s_index.timer != NULL;
+}
+
+void library_db_close(void) {
+    library_db_index_stop();
+    if (s_db.file != NULL) {
+        fclose(s_db.file);
+    }
+    free(s_db.keys);
+    memset(&s_db, 0, sizeof(s_db));
+}
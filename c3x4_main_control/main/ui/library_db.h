@@ -0,0 +1,108 @@
+/**
+ * @file library_db.h
+ * @brief 书库数据库 - 卡上每本 EPUB/TXT 的书名、作者、语言、大小与 1bpp 封面缩略图
+ *
+ * 所有书存在同一个文件 /sdcard/.x4cache/library.db：文件头 + 定长键表（路径哈希、
+ * 大小、修改时间、记录校验）+ 定长记录。打开时只把用到的键表读进内存，按路径查找
+ * 不访问卡；列表显示时每行读一条记录，缩略图单独读取。
+ * 后台索引器在 LVGL 任务中用定时器分片遍历 /sdcard（字体回调与 EPUB 缓存都不是
+ * 线程安全的），每次最多解析一本书，新书与改过的书写入数据库，扫描完整结束后删除
+ * 已不在卡上的书。所有函数都在 LVGL 任务中调用
+ */
+
+#ifndef LIBRARY_DB_H
+#define LIBRARY_DB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LIBRARY_DB_PATH       "/sdcard/.x4cache/library.db"
+#define LIBRARY_DB_MAX_BOOKS  512    // 数据库容量（键表定长）
+#define LIBRARY_PATH_MAX      128    // 记录中的完整路径（更长的路径不入库）
+#define LIBRARY_THUMB_WIDTH   48     // 缩略图最大尺寸（按比例缩小，居中）
+#define LIBRARY_THUMB_HEIGHT  64
+#define LIBRARY_THUMB_STRIDE  ((LIBRARY_THUMB_WIDTH + 7) / 8)
+#define LIBRARY_THUMB_BYTES   (LIBRARY_THUMB_STRIDE * LIBRARY_THUMB_HEIGHT)
+
+typedef enum {
+    LIBRARY_BOOK_TXT = 1,
+    LIBRARY_BOOK_EPUB = 2,
+} library_book_type_t;
+
+// 一本书的信息（记录的前半部分，缩略图另外读取）
+typedef struct {
+    char path[LIBRARY_PATH_MAX];   // 完整路径
+    char title[96];                // 书名（TXT 为去掉扩展名的文件名）
+    char author[64];               // 作者（EPUB 没写时为 Unknown，TXT 为空串）
+    char language[16];             // 语言，未知时为空串
+    uint32_t file_size;            // 文件大小（字节）
+    uint8_t type;                  // library_book_type_t
+    uint8_t thumb_width;           // 封面缩略图尺寸，0 表示没有封面
+    uint8_t thumb_height;
+    uint8_t reserved;
+} library_book_t;
+
+/**
+ * @brief 数据库中的槽位数（含已删除的空槽，用于遍历）
+ */
+int library_db_count(void);
+
+/**
+ * @brief 按路径查找书籍（只查内存中的键表，不访问卡；不检查文件是否已改动）
+ * @param path 完整路径
+ * @return 槽位序号，未入库返回 -1
+ */
+int library_db_find(const char *path);
+
+/**
+ * @brief 读取书籍信息
+ * @param index 槽位序号
+ * @param book 输出
+ * @return true 成功，false 空槽或记录损坏
+ */
+bool library_db_get(int index, library_book_t *book);
+
+/**
+ * @brief 读取封面缩略图：1bpp，每行 LIBRARY_THUMB_STRIDE 字节，高位在左，1 为白色
+ * @param index 槽位序号
+ * @param bits 输出，LIBRARY_THUMB_BYTES 字节（只有前 thumb_height 行有效）
+ * @return true 成功，false 没有封面或读取失败
+ */
+bool library_db_thumbnail(int index, uint8_t *bits);
+
+/**
+ * @brief 立即索引一本书（文件未变时直接返回），供上传、下载完成后登记新书
+ * @param path 完整路径
+ * @return true 已在库中或已写入
+ */
+bool library_db_update(const char *path);
+
+/**
+ * @brief 开始在后台扫描 /sdcard（已在扫描时什么也不做）
+ */
+void library_db_index_start(void);
+
+/**
+ * @brief 停止后台扫描（下次从头开始，未变的书会被快速跳过）
+ */
+void library_db_index_stop(void);
+
+/**
+ * @brief 后台扫描是否正在进行
+ */
+bool library_db_is_indexing(void);
+
+/**
+ * @brief 停止扫描并关闭数据库文件，释放内存中的键表
+ */
+void library_db_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIBRARY_DB_H
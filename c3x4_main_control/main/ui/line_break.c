@@ -0,0 +1,198 @@
+/**
+ * @file line_break.c
+ * @brief 断行与断字实现
+ */
+
+#include "line_break.h"
+#include "line_break_tables.h"
+#include <string.h>
+
+// 成对表取值
+enum {
+    LB_DIRECT = 0,           // 直接相邻也可断
+    LB_INDIRECT = 1,         // 中间有空格时可断
+    LB_PROHIBITED = 2,       // 不可断
+};
+
+#define HYPH_BOUNDARY    27      // 字典树中的词界字符 .
+#define HYPH_NODE_CHAR(e)    ((e) & 0x1F)
+#define HYPH_NODE_LAST(e)    (((e) >> 5) & 1)
+#define HYPH_NODE_PATTERN(e) (((e) >> 6) & 0xFF)
+#define HYPH_NODE_CHILD(e)   (((e) >> 14) & 0x1FFF)
+
+lb_class_t line_break_class(uint32_t cp) {
+    if (cp < 128) {
+        return (lb_class_t)s_lb_ascii[cp];
+    }
+    if (cp >= 0x4E00 && cp <= 0x9FFF) {
+        return LB_ID;  // 常用汉字区，省去查表
+    }
+    // 起点不大于 cp 的最后一个区间（第一个区间从 0 开始）
+    const uint32_t key = (cp << 8) | 0xFF;
+    uint32_t lo = 0;
+    uint32_t hi = LB_RANGE_COUNT;
+    while (hi - lo > 1) {
+        const uint32_t mid = (lo + hi) / 2;
+        if (s_lb_ranges[mid] <= key) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return (lb_class_t)(s_lb_ranges[lo] & 0xFF);
+}
+
+bool line_break_step(line_break_state_t *st, uint32_t cp) {
+    uint8_t cls = line_break_class(cp);
+    if (cls == LB_SP) {
+        st->space = st->prev != LB_NONE;
+        return false;  // LB7：空格前不断，行首的空格不算间隔
+    }
+    if (cls == LB_BK) {
+        line_break_reset(st);
+        return false;
+    }
+    if (cls == LB_CM) {
+        if (st->prev != LB_NONE && !st->space) {
+            return false;  // LB9：组合符附着在前一个字符上
+        }
+        cls = LB_AL;       // LB10
+    }
+    if (st->prev == LB_NONE) {
+        st->prev = cls;
+        return false;
+    }
+    const uint8_t rule = s_lb_pairs[st->prev][cls];
+    const bool brk = rule == LB_DIRECT || (rule == LB_INDIRECT && st->space);
+    st->prev = cls;
+    st->space = false;
+    return brk;
+}
+
+// ============================================================================
+// 断字
+// ============================================================================
+
+// 比较小写单词与例外词（跳过例外词中的连字符）
+static int exception_compare(const char *word, size_t len, const char *exception) {
+    size_t i = 0;
+    for (; *exception != '\0'; exception++) {
+        if (*exception == '-') {
+            continue;
+        }
+        if (i == len) {
+            return -1;
+        }
+        if (word[i] != *exception) {
+            return (unsigned char)word[i] - (unsigned char)*exception;
+        }
+        i++;
+    }
+    return i < len ? 1 : 0;
+}
+
+static const char *exception_find(const char *word, size_t len) {
+    int lo = 0;
+    int hi = HYPH_EXCEPTION_COUNT - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const char *exception = s_hyph_exceptions + s_hyph_exception_offsets[mid];
+        const int cmp = exception_compare(word, len, exception);
+        if (cmp == 0) {
+            return exception;
+        }
+        if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return NULL;
+}
+
+// 在 run 开始的同层节点中找字符 c（同层按字符码升序）
+static int trie_find(uint32_t run, uint8_t c) {
+    for (uint32_t k = run; k < HYPH_TRIE_SIZE; k++) {
+        const uint32_t e = s_hyph_trie[k];
+        if (HYPH_NODE_CHAR(e) == c) {
+            return (int)k;
+        }
+        if (HYPH_NODE_CHAR(e) > c || HYPH_NODE_LAST(e)) {
+            break;
+        }
+    }
+    return -1;
+}
+
+int hyphenate_word(const char *word, size_t len, uint8_t *points) {
+    if (len < HYPH_MIN_LEFT + HYPH_MIN_RIGHT || len > HYPH_MAX_WORD) {
+        return 0;
+    }
+    char lower[HYPH_MAX_WORD];
+    uint8_t codes[HYPH_MAX_WORD + 2];
+    for (size_t i = 0; i < len; i++) {
+        const char c = word[i] >= 'A' && word[i] <= 'Z' ? (char)(word[i] - 'A' + 'a') : word[i];
+        if (c < 'a' || c > 'z') {
+            return 0;
+        }
+        lower[i] = c;
+        codes[i + 1] = (uint8_t)(c - 'a' + 1);
+    }
+    memset(points, 0, len);
+
+    int count = 0;
+    const char *exception = exception_find(lower, len);
+    if (exception != NULL) {
+        size_t letters = 0;
+        for (; *exception != '\0'; exception++) {
+            if (*exception != '-') {
+                letters++;
+            } else if (letters >= HYPH_MIN_LEFT && len - letters >= HYPH_MIN_RIGHT) {
+                points[letters - 1] = 1;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // Liang：单词两端加词界，从每个位置出发沿字典树匹配所有模式，各间隙取最大分值
+    codes[0] = HYPH_BOUNDARY;
+    codes[len + 1] = HYPH_BOUNDARY;
+    uint8_t values[HYPH_MAX_WORD + 3] = {0};  // values[x]：第 x 个字符（含词界）之前的间隙
+    const size_t n = len + 2;
+    for (size_t i = 0; i < n; i++) {
+        uint32_t run = 0;
+        for (size_t j = i; j < n; j++) {
+            const int node = trie_find(run, codes[j]);
+            if (node < 0) {
+                break;
+            }
+            const uint32_t e = s_hyph_trie[node];
+            const uint32_t pattern = HYPH_NODE_PATTERN(e);
+            if (pattern != 0) {
+                // 分值与模式末尾对齐：最后一个分值属于 j 之后的间隙
+                const uint8_t *vec = &s_hyph_vectors[s_hyph_vector_offsets[pattern - 1]];
+                const size_t m = vec[0];
+                for (size_t t = 0; t < m; t++) {
+                    const size_t x = j + 2 + t - m;
+                    if (vec[1 + t] > values[x]) {
+                        values[x] = vec[1 + t];
+                    }
+                }
+            }
+            run = HYPH_NODE_CHILD(e);
+            if (run == 0) {
+                break;
+            }
+        }
+    }
+
+    // 第 k 个字母之后的间隙是 values[k + 2]，奇数分值可断
+    for (size_t k = HYPH_MIN_LEFT - 1; k + HYPH_MIN_RIGHT < len; k++) {
+        if (values[k + 2] & 1) {
+            points[k] = 1;
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file line_break.h
+ * @brief 断行与断字 - UAX #14 断行类别、CJK 禁则与英语 Liang 断字
+ *
+ * 类别表、成对表和断字字典树由 tools/gen_line_break.py 生成（line_break_tables.h），
+ * 全部是 const 数据，留在 Flash 中不占 RAM。断行按成对表逐字判断：
+ * line_break_step() 依次喂入一行的码点，返回能否在该码点前断开，一遍线性扫描即可。
+ * CJK 禁则通过类别体现：句读和闭括号（CL/EX/NS）不在行首，开括号（OP）不在行尾，
+ * 中文弯引号按括号处理
+ */
+
+#ifndef LINE_BREAK_H
+#define LINE_BREAK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HYPH_MIN_LEFT   2     // 断字后行尾至少保留的字母数
+#define HYPH_MIN_RIGHT  3     // 断字后移到下一行至少的字母数
+#define HYPH_MAX_WORD   48    // 参与断字的最长单词
+
+// 断行类别（顺序与 tools/gen_line_break.py 的 CLASSES 一致）
+typedef enum {
+    LB_OP = 0, LB_CL, LB_CP, LB_QU, LB_GL, LB_NS, LB_EX, LB_SY, LB_IS, LB_PR, LB_PO, LB_NU,
+    LB_AL, LB_HL, LB_ID, LB_IN, LB_HY, LB_BA, LB_BB, LB_B2, LB_ZW, LB_CM, LB_WJ, LB_H2,
+    LB_H3, LB_JL, LB_JV, LB_JT, LB_RI,
+    LB_SP,                   // 空格（不进成对表）
+    LB_BK,                   // 强制换行（不进成对表）
+    LB_NONE,                 // 行首，前面没有字符
+} lb_class_t;
+
+#define LB_PAIR_CLASSES LB_SP
+
+// 逐字断行状态
+typedef struct {
+    uint8_t prev;            // 前一个非空格字符的类别
+    bool space;              // 前一个字符之后是否有空格
+} line_break_state_t;
+
+/**
+ * @brief 码点的断行类别
+ */
+lb_class_t line_break_class(uint32_t cp);
+
+/**
+ * @brief 从行首开始：第一个字符前不断行
+ */
+static inline void line_break_reset(line_break_state_t *st) {
+    st->prev = LB_NONE;
+    st->space = false;
+}
+
+/**
+ * @brief 喂入下一个码点
+ * @return true 可以在该码点之前断行（空格之前从不断行，断在空格之后的字符前）
+ */
+bool line_break_step(line_break_state_t *st, uint32_t cp);
+
+/**
+ * @brief 计算英语单词的断字点
+ * @param word ASCII 字母（大小写不限）
+ * @param len 字母数
+ * @param points 输出：points[i] 非 0 表示第 i 个字母之后可以断开并补连字符（len 项）
+ * @return 断字点个数；单词太短、太长或含非字母时为 0
+ */
+int hyphenate_word(const char *word, size_t len, uint8_t *points);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LINE_BREAK_H
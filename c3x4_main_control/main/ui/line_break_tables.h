@@ -0,0 +1,2068 @@
+/**
+ * @file line_break_tables.h
+ * @brief 断行类别、UAX #14 成对表与英语断字字典树
+ *
+ * 由 tools/gen_line_break.py 生成（类别来源：unicodedata 14.0.0），请勿手工修改。
+ * 只由 line_break.c 引用
+ */
+
+#ifndef LINE_BREAK_TABLES_H
+#define LINE_BREAK_TABLES_H
+
+#include <stdint.h>
+
+#define LB_RANGE_COUNT      2230
+#define HYPH_TRIE_SIZE      7111
+#define HYPH_VECTOR_COUNT   180
+#define HYPH_EXCEPTION_COUNT 1454
+
+// ASCII 的断行类别
+static const uint8_t s_lb_ascii[128] = {
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 17, 30, 30, 30, 30, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    29,  6,  3, 12,  9, 10, 12,  3,  0,  2, 12,  9,  8, 16,  8,  7,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11,  8,  8, 12, 12, 12,  6,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0,  9,  2, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  0, 17,  1, 12, 21,
+};
+
+// 码点区间：(起点 << 8) | 类别，按起点升序，区间延续到下一项起点之前
+static const uint32_t s_lb_ranges[LB_RANGE_COUNT] = {
+    0x00000015, 0x00000911, 0x00000A1E, 0x00000E15, 0x0000201D, 0x00002106,
+    0x00002203, 0x0000230C, 0x00002409, 0x0000250A, 0x0000260C, 0x00002703,
+    0x00002800, 0x00002902, 0x00002A0C, 0x00002B09, 0x00002C08, 0x00002D10,
+    0x00002E08, 0x00002F07, 0x0000300B, 0x00003A08, 0x00003C0C, 0x00003F06,
+    0x0000400C, 0x00005B00, 0x00005C09, 0x00005D02, 0x00005E0C, 0x00007B00,
+    0x00007C11, 0x00007D01, 0x00007E0C, 0x00007F15, 0x0000851E, 0x00008615,
+    0x0000A004, 0x0000A100, 0x0000A20A, 0x0000A309, 0x0000A60C, 0x0000AB03,
+    0x0000AC0C, 0x0000AD11, 0x0000AE0C, 0x0000B00A, 0x0000B109, 0x0000B20C,
+    0x0000B412, 0x0000B50C, 0x0000B705, 0x0000B80C, 0x0000BB03, 0x0000BC0C,
+    0x0000BF00, 0x0000C00C, 0x0002C812, 0x0002C90C, 0x0002CC12, 0x0002CD0C,
+    0x00030015, 0x00034F04, 0x00035015, 0x0003700C, 0x00037E08, 0x00037F0C,
+    0x00048315, 0x00048A0C, 0x00058908, 0x00058A11, 0x00058B0C, 0x00058F09,
+    0x0005900C, 0x00059115, 0x0005BE11, 0x0005BF15, 0x0005C00C, 0x0005C115,
+    0x0005C30C, 0x0005C415, 0x0005C606, 0x0005C715, 0x0005C80C, 0x0005D00D,
+    0x0005EB0C, 0x0005EF0D, 0x0005F30C, 0x00060015, 0x0006060C, 0x00060B09,
+    0x00060C0C, 0x00061015, 0x00061B0C, 0x00061C15, 0x00061D0C, 0x00061F06,
+    0x0006200C, 0x00064B15, 0x0006600B, 0x00066A0C, 0x00067015, 0x0006710C,
+    0x0006D615, 0x0006DE0C, 0x0006DF15, 0x0006E50C, 0x0006E715, 0x0006E90C,
+    0x0006EA15, 0x0006EE0C, 0x0006F00B, 0x0006FA0C, 0x00070F15, 0x0007100C,
+    0x00071115, 0x0007120C, 0x00073015, 0x00074B0C, 0x0007A615, 0x0007B10C,
+    0x0007C00B, 0x0007CA0C, 0x0007EB15, 0x0007F40C, 0x0007FD15, 0x0007FE09,
+    0x0008000C, 0x00081615, 0x00081A0C, 0x00081B15, 0x0008240C, 0x00082515,
+    0x0008280C, 0x00082915, 0x00082E0C, 0x00085915, 0x00085C0C, 0x00089015,
+    0x0008920C, 0x00089815, 0x0008A00C, 0x0008CA15, 0x0009040C, 0x00093A15,
+    0x00093D0C, 0x00093E15, 0x0009500C, 0x00095115, 0x0009580C, 0x00096215,
+    0x0009640C, 0x0009660B, 0x0009700C, 0x00098115, 0x0009840C, 0x0009BC15,
+    0x0009BD0C, 0x0009BE15, 0x0009C50C, 0x0009C715, 0x0009C90C, 0x0009CB15,
+    0x0009CE0C, 0x0009D715, 0x0009D80C, 0x0009E215, 0x0009E40C, 0x0009E60B,
+    0x0009F00C, 0x0009F209, 0x0009F40C, 0x0009FB09, 0x0009FC0C, 0x0009FE15,
+    0x0009FF0C, 0x000A0115, 0x000A040C, 0x000A3C15, 0x000A3D0C, 0x000A3E15,
+    0x000A430C, 0x000A4715, 0x000A490C, 0x000A4B15, 0x000A4E0C, 0x000A5115,
+    0x000A520C, 0x000A660B, 0x000A7015, 0x000A720C, 0x000A7515, 0x000A760C,
+    0x000A8115, 0x000A840C, 0x000ABC15, 0x000ABD0C, 0x000ABE15, 0x000AC60C,
+    0x000AC715, 0x000ACA0C, 0x000ACB15, 0x000ACE0C, 0x000AE215, 0x000AE40C,
+    0x000AE60B, 0x000AF00C, 0x000AF109, 0x000AF20C, 0x000AFA15, 0x000B000C,
+    0x000B0115, 0x000B040C, 0x000B3C15, 0x000B3D0C, 0x000B3E15, 0x000B450C,
+    0x000B4715, 0x000B490C, 0x000B4B15, 0x000B4E0C, 0x000B5515, 0x000B580C,
+    0x000B6215, 0x000B640C, 0x000B660B, 0x000B700C, 0x000B8215, 0x000B830C,
+    0x000BBE15, 0x000BC30C, 0x000BC615, 0x000BC90C, 0x000BCA15, 0x000BCE0C,
+    0x000BD715, 0x000BD80C, 0x000BE60B, 0x000BF00C, 0x000BF909, 0x000BFA0C,
+    0x000C0015, 0x000C050C, 0x000C3C15, 0x000C3D0C, 0x000C3E15, 0x000C450C,
+    0x000C4615, 0x000C490C, 0x000C4A15, 0x000C4E0C, 0x000C5515, 0x000C570C,
+    0x000C6215, 0x000C640C, 0x000C660B, 0x000C700C, 0x000C8115, 0x000C840C,
+    0x000CBC15, 0x000CBD0C, 0x000CBE15, 0x000CC50C, 0x000CC615, 0x000CC90C,
+    0x000CCA15, 0x000CCE0C, 0x000CD515, 0x000CD70C, 0x000CE215, 0x000CE40C,
+    0x000CE60B, 0x000CF00C, 0x000D0015, 0x000D040C, 0x000D3B15, 0x000D3D0C,
+    0x000D3E15, 0x000D450C, 0x000D4615, 0x000D490C, 0x000D4A15, 0x000D4E0C,
+    0x000D5715, 0x000D580C, 0x000D6215, 0x000D640C, 0x000D660B, 0x000D700C,
+    0x000D8115, 0x000D840C, 0x000DCA15, 0x000DCB0C, 0x000DCF15, 0x000DD50C,
+    0x000DD615, 0x000DD70C, 0x000DD815, 0x000DE00C, 0x000DE60B, 0x000DF00C,
+    0x000DF215, 0x000DF40C, 0x000E3115, 0x000E320C, 0x000E3415, 0x000E3B0C,
+    0x000E3F09, 0x000E400C, 0x000E4715, 0x000E4F0C, 0x000E500B, 0x000E5A0C,
+    0x000EB115, 0x000EB20C, 0x000EB415, 0x000EBD0C, 0x000EC815, 0x000ECE0C,
+    0x000ED00B, 0x000EDA0C, 0x000F0804, 0x000F090C, 0x000F0C04, 0x000F0D0C,
+    0x000F1204, 0x000F130C, 0x000F1815, 0x000F1A0C, 0x000F200B, 0x000F2A0C,
+    0x000F3515, 0x000F360C, 0x000F3715, 0x000F380C, 0x000F3915, 0x000F3A00,
+    0x000F3B01, 0x000F3C00, 0x000F3D01, 0x000F3E15, 0x000F400C, 0x000F7115,
+    0x000F850C, 0x000F8615, 0x000F880C, 0x000F8D15, 0x000F980C, 0x000F9915,
+    0x000FBD0C, 0x000FC615, 0x000FC70C, 0x00102B15, 0x00103F0C, 0x0010400B,
+    0x00104A0C, 0x00105615, 0x00105A0C, 0x00105E15, 0x0010610C, 0x00106215,
+    0x0010650C, 0x00106715, 0x00106E0C, 0x00107115, 0x0010750C, 0x00108215,
+    0x00108E0C, 0x00108F15, 0x0010900B, 0x00109A15, 0x00109E0C, 0x00110019,
+    0x0011601A, 0x0011A81B, 0x0012000C, 0x00135D15, 0x0013600C, 0x00140011,
+    0x0014010C, 0x00168011, 0x0016810C, 0x00169B00, 0x00169C01, 0x00169D0C,
+    0x00171215, 0x0017160C, 0x00173215, 0x0017350C, 0x00175215, 0x0017540C,
+    0x00177215, 0x0017740C, 0x0017B415, 0x0017D40C, 0x0017DB09, 0x0017DC0C,
+    0x0017DD15, 0x0017DE0C, 0x0017E00B, 0x0017EA0C, 0x00180611, 0x0018070C,
+    0x00180B15, 0x00180E04, 0x00180F15, 0x0018100B, 0x00181A0C, 0x00188515,
+    0x0018870C, 0x0018A915, 0x0018AA0C, 0x00192015, 0x00192C0C, 0x00193015,
+    0x00193C0C, 0x0019460B, 0x0019500C, 0x0019D00B, 0x0019DA0C, 0x001A1715,
+    0x001A1C0C, 0x001A5515, 0x001A5F0C, 0x001A6015, 0x001A7D0C, 0x001A7F15,
+    0x001A800B, 0x001A8A0C, 0x001A900B, 0x001A9A0C, 0x001AB015, 0x001ACF0C,
+    0x001B0015, 0x001B050C, 0x001B3415, 0x001B450C, 0x001B500B, 0x001B5A0C,
+    0x001B6B15, 0x001B740C, 0x001B8015, 0x001B830C, 0x001BA115, 0x001BAE0C,
+    0x001BB00B, 0x001BBA0C, 0x001BE615, 0x001BF40C, 0x001C2415, 0x001C380C,
+    0x001C400B, 0x001C4A0C, 0x001C500B, 0x001C5A0C, 0x001CD015, 0x001CD30C,
+    0x001CD415, 0x001CE90C, 0x001CED15, 0x001CEE0C, 0x001CF415, 0x001CF50C,
+    0x001CF715, 0x001CFA0C, 0x001DC015, 0x001E000C, 0x001FFD12, 0x001FFE0C,
+    0x00200011, 0x00200704, 0x00200811, 0x00200B14, 0x00200C15, 0x00201011,
+    0x00201104, 0x00201211, 0x00201405, 0x0020160C, 0x00201800, 0x00201901,
+    0x00201A00, 0x00201B03, 0x00201C00, 0x00201D01, 0x00201E00, 0x00201F03,
+    0x0020200C, 0x0020240F, 0x0020270C, 0x0020281E, 0x00202A15, 0x00202F04,
+    0x0020300A, 0x0020380C, 0x00203903, 0x00203B0C, 0x00203C05, 0x00203E0C,
+    0x00204408, 0x00204500, 0x00204601, 0x00204705, 0x00204A0C, 0x00205F11,
+    0x00206016, 0x00206115, 0x0020650C, 0x00206615, 0x0020700C, 0x00207D00,
+    0x00207E01, 0x00207F0C, 0x00208D00, 0x00208E01, 0x00208F0C, 0x0020A009,
+    0x0020A70A, 0x0020A809, 0x0020B60A, 0x0020B709, 0x0020C10C, 0x0020D015,
+    0x0020F10C, 0x0021030A, 0x0021040C, 0x0021090A, 0x00210A0C, 0x00211609,
+    0x0021170C, 0x00221209, 0x0022140C, 0x0022EF0F, 0x0022F00C, 0x00230800,
+    0x00230901, 0x00230A00, 0x00230B01, 0x00230C0C, 0x00231A0E, 0x00231C0C,
+    0x00232900, 0x00232A01, 0x00232B0C, 0x0023E90E, 0x0023ED0C, 0x0023F00E,
+    0x0023F10C, 0x0023F30E, 0x0023F40C, 0x0025FD0E, 0x0025FF0C, 0x0026140E,
+    0x0026160C, 0x0026480E, 0x0026540C, 0x00267F0E, 0x0026800C, 0x0026930E,
+    0x0026940C, 0x0026A10E, 0x0026A20C, 0x0026AA0E, 0x0026AC0C, 0x0026BD0E,
+    0x0026BF0C, 0x0026C40E, 0x0026C60C, 0x0026CE0E, 0x0026CF0C, 0x0026D40E,
+    0x0026D50C, 0x0026EA0E, 0x0026EB0C, 0x0026F20E, 0x0026F40C, 0x0026F50E,
+    0x0026F60C, 0x0026FA0E, 0x0026FB0C, 0x0026FD0E, 0x0026FE0C, 0x0027050E,
+    0x0027060C, 0x00270A0E, 0x00270C0C, 0x0027280E, 0x0027290C, 0x00274C0E,
+    0x00274D0C, 0x00274E0E, 0x00274F0C, 0x0027530E, 0x0027560C, 0x0027570E,
+    0x0027580C, 0x00276800, 0x00276901, 0x00276A00, 0x00276B01, 0x00276C00,
+    0x00276D01, 0x00276E00, 0x00276F01, 0x00277000, 0x00277101, 0x00277200,
+    0x00277301, 0x00277400, 0x00277501, 0x0027760C, 0x0027950E, 0x0027980C,
+    0x0027B00E, 0x0027B10C, 0x0027BF0E, 0x0027C00C, 0x0027C500, 0x0027C601,
+    0x0027C70C, 0x0027E600, 0x0027E701, 0x0027E800, 0x0027E901, 0x0027EA00,
+    0x0027EB01, 0x0027EC00, 0x0027ED01, 0x0027EE00, 0x0027EF01, 0x0027F00C,
+    0x00298300, 0x00298401, 0x00298500, 0x00298601, 0x00298700, 0x00298801,
+    0x00298900, 0x00298A01, 0x00298B00, 0x00298C01, 0x00298D00, 0x00298E01,
+    0x00298F00, 0x00299001, 0x00299100, 0x00299201, 0x00299300, 0x00299401,
+    0x00299500, 0x00299601, 0x00299700, 0x00299801, 0x0029990C, 0x0029D800,
+    0x0029D901, 0x0029DA00, 0x0029DB01, 0x0029DC0C, 0x0029FC00, 0x0029FD01,
+    0x0029FE0C, 0x002B1B0E, 0x002B1D0C, 0x002B500E, 0x002B510C, 0x002B550E,
+    0x002B560C, 0x002CEF15, 0x002CF20C, 0x002D7F15, 0x002D800C, 0x002DE015,
+    0x002E000C, 0x002E0203, 0x002E060C, 0x002E0903, 0x002E0B0C, 0x002E0C03,
+    0x002E0E0C, 0x002E1711, 0x002E180C, 0x002E1A11, 0x002E1B0C, 0x002E1C03,
+    0x002E1E0C, 0x002E2003, 0x002E2200, 0x002E2301, 0x002E2400, 0x002E2501,
+    0x002E2600, 0x002E2701, 0x002E2800, 0x002E2901, 0x002E2A0C, 0x002E3A05,
+    0x002E3C0C, 0x002E4011, 0x002E410C, 0x002E4200, 0x002E430C, 0x002E5500,
+    0x002E5601, 0x002E5700, 0x002E5801, 0x002E5900, 0x002E5A01, 0x002E5B00,
+    0x002E5C01, 0x002E5D11, 0x002E5E0C, 0x002E800E, 0x002E9A0C, 0x002E9B0E,
+    0x002EF40C, 0x002F000E, 0x002FD60C, 0x002FF00E, 0x002FFC0C, 0x00300011,
+    0x00300101, 0x0030030E, 0x00300505, 0x0030060E, 0x00300800, 0x00300901,
+    0x00300A00, 0x00300B01, 0x00300C00, 0x00300D01, 0x00300E00, 0x00300F01,
+    0x00301000, 0x00301101, 0x0030120E, 0x00301400, 0x00301501, 0x00301600,
+    0x00301701, 0x00301800, 0x00301901, 0x00301A00, 0x00301B01, 0x00301C05,
+    0x00301D00, 0x00301E01, 0x0030200E, 0x00302A15, 0x00303005, 0x0030310E,
+    0x00303B05, 0x00303D0E, 0x00303F0C, 0x00304105, 0x0030420E, 0x00304305,
+    0x0030440E, 0x00304505, 0x0030460E, 0x00304705, 0x0030480E, 0x00304905,
+    0x00304A0E, 0x00306305, 0x0030640E, 0x00308305, 0x0030840E, 0x00308505,
+    0x0030860E, 0x00308705, 0x0030880E, 0x00308E05, 0x00308F0E, 0x00309505,
+    0x0030970C, 0x00309915, 0x00309B05, 0x00309F0E, 0x0030A005, 0x0030A20E,
+    0x0030A305, 0x0030A40E, 0x0030A505, 0x0030A60E, 0x0030A705, 0x0030A80E,
+    0x0030A905, 0x0030AA0E, 0x0030C305, 0x0030C40E, 0x0030E305, 0x0030E40E,
+    0x0030E505, 0x0030E60E, 0x0030E705, 0x0030E80E, 0x0030EE05, 0x0030EF0E,
+    0x0030F505, 0x0030F70E, 0x0030FB05, 0x0030FF0E, 0x0031000C, 0x0031050E,
+    0x0031300C, 0x0031310E, 0x00318F0C, 0x0031900E, 0x0031E40C, 0x0031F005,
+    0x0032000E, 0x00321F0C, 0x0032200E, 0x0032480C, 0x0032500E, 0x004DC00C,
+    0x004E000E, 0x00A01505, 0x00A0160E, 0x00A48D0C, 0x00A4900E, 0x00A4C70C,
+    0x00A6200B, 0x00A62A0C, 0x00A66F15, 0x00A6730C, 0x00A67415, 0x00A67E0C,
+    0x00A69E15, 0x00A6A00C, 0x00A6F015, 0x00A6F20C, 0x00A80215, 0x00A8030C,
+    0x00A80615, 0x00A8070C, 0x00A80B15, 0x00A80C0C, 0x00A82315, 0x00A8280C,
+    0x00A82C15, 0x00A82D0C, 0x00A83809, 0x00A8390C, 0x00A88015, 0x00A8820C,
+    0x00A8B415, 0x00A8C60C, 0x00A8D00B, 0x00A8DA0C, 0x00A8E015, 0x00A8F20C,
+    0x00A8FF15, 0x00A9000B, 0x00A90A0C, 0x00A92615, 0x00A92E0C, 0x00A94715,
+    0x00A9540C, 0x00A96019, 0x00A97D0C, 0x00A98015, 0x00A9840C, 0x00A9B315,
+    0x00A9C10C, 0x00A9D00B, 0x00A9DA0C, 0x00A9E515, 0x00A9E60C, 0x00A9F00B,
+    0x00A9FA0C, 0x00AA2915, 0x00AA370C, 0x00AA4315, 0x00AA440C, 0x00AA4C15,
+    0x00AA4E0C, 0x00AA500B, 0x00AA5A0C, 0x00AA7B15, 0x00AA7E0C, 0x00AAB015,
+    0x00AAB10C, 0x00AAB215, 0x00AAB50C, 0x00AAB715, 0x00AAB90C, 0x00AABE15,
+    0x00AAC00C, 0x00AAC115, 0x00AAC20C, 0x00AAEB15, 0x00AAF00C, 0x00AAF515,
+    0x00AAF70C, 0x00ABE315, 0x00ABEB0C, 0x00ABEC15, 0x00ABEE0C, 0x00ABF00B,
+    0x00ABFA0C, 0x00AC0017, 0x00AC0118, 0x00AC1C17, 0x00AC1D18, 0x00AC3817,
+    0x00AC3918, 0x00AC5417, 0x00AC5518, 0x00AC7017, 0x00AC7118, 0x00AC8C17,
+    0x00AC8D18, 0x00ACA817, 0x00ACA918, 0x00ACC417, 0x00ACC518, 0x00ACE017,
+    0x00ACE118, 0x00ACFC17, 0x00ACFD18, 0x00AD1817, 0x00AD1918, 0x00AD3417,
+    0x00AD3518, 0x00AD5017, 0x00AD5118, 0x00AD6C17, 0x00AD6D18, 0x00AD8817,
+    0x00AD8918, 0x00ADA417, 0x00ADA518, 0x00ADC017, 0x00ADC118, 0x00ADDC17,
+    0x00ADDD18, 0x00ADF817, 0x00ADF918, 0x00AE1417, 0x00AE1518, 0x00AE3017,
+    0x00AE3118, 0x00AE4C17, 0x00AE4D18, 0x00AE6817, 0x00AE6918, 0x00AE8417,
+    0x00AE8518, 0x00AEA017, 0x00AEA118, 0x00AEBC17, 0x00AEBD18, 0x00AED817,
+    0x00AED918, 0x00AEF417, 0x00AEF518, 0x00AF1017, 0x00AF1118, 0x00AF2C17,
+    0x00AF2D18, 0x00AF4817, 0x00AF4918, 0x00AF6417, 0x00AF6518, 0x00AF8017,
+    0x00AF8118, 0x00AF9C17, 0x00AF9D18, 0x00AFB817, 0x00AFB918, 0x00AFD417,
+    0x00AFD518, 0x00AFF017, 0x00AFF118, 0x00B00C17, 0x00B00D18, 0x00B02817,
+    0x00B02918, 0x00B04417, 0x00B04518, 0x00B06017, 0x00B06118, 0x00B07C17,
+    0x00B07D18, 0x00B09817, 0x00B09918, 0x00B0B417, 0x00B0B518, 0x00B0D017,
+    0x00B0D118, 0x00B0EC17, 0x00B0ED18, 0x00B10817, 0x00B10918, 0x00B12417,
+    0x00B12518, 0x00B14017, 0x00B14118, 0x00B15C17, 0x00B15D18, 0x00B17817,
+    0x00B17918, 0x00B19417, 0x00B19518, 0x00B1B017, 0x00B1B118, 0x00B1CC17,
+    0x00B1CD18, 0x00B1E817, 0x00B1E918, 0x00B20417, 0x00B20518, 0x00B22017,
+    0x00B22118, 0x00B23C17, 0x00B23D18, 0x00B25817, 0x00B25918, 0x00B27417,
+    0x00B27518, 0x00B29017, 0x00B29118, 0x00B2AC17, 0x00B2AD18, 0x00B2C817,
+    0x00B2C918, 0x00B2E417, 0x00B2E518, 0x00B30017, 0x00B30118, 0x00B31C17,
+    0x00B31D18, 0x00B33817, 0x00B33918, 0x00B35417, 0x00B35518, 0x00B37017,
+    0x00B37118, 0x00B38C17, 0x00B38D18, 0x00B3A817, 0x00B3A918, 0x00B3C417,
+    0x00B3C518, 0x00B3E017, 0x00B3E118, 0x00B3FC17, 0x00B3FD18, 0x00B41817,
+    0x00B41918, 0x00B43417, 0x00B43518, 0x00B45017, 0x00B45118, 0x00B46C17,
+    0x00B46D18, 0x00B48817, 0x00B48918, 0x00B4A417, 0x00B4A518, 0x00B4C017,
+    0x00B4C118, 0x00B4DC17, 0x00B4DD18, 0x00B4F817, 0x00B4F918, 0x00B51417,
+    0x00B51518, 0x00B53017, 0x00B53118, 0x00B54C17, 0x00B54D18, 0x00B56817,
+    0x00B56918, 0x00B58417, 0x00B58518, 0x00B5A017, 0x00B5A118, 0x00B5BC17,
+    0x00B5BD18, 0x00B5D817, 0x00B5D918, 0x00B5F417, 0x00B5F518, 0x00B61017,
+    0x00B61118, 0x00B62C17, 0x00B62D18, 0x00B64817, 0x00B64918, 0x00B66417,
+    0x00B66518, 0x00B68017, 0x00B68118, 0x00B69C17, 0x00B69D18, 0x00B6B817,
+    0x00B6B918, 0x00B6D417, 0x00B6D518, 0x00B6F017, 0x00B6F118, 0x00B70C17,
+    0x00B70D18, 0x00B72817, 0x00B72918, 0x00B74417, 0x00B74518, 0x00B76017,
+    0x00B76118, 0x00B77C17, 0x00B77D18, 0x00B79817, 0x00B79918, 0x00B7B417,
+    0x00B7B518, 0x00B7D017, 0x00B7D118, 0x00B7EC17, 0x00B7ED18, 0x00B80817,
+    0x00B80918, 0x00B82417, 0x00B82518, 0x00B84017, 0x00B84118, 0x00B85C17,
+    0x00B85D18, 0x00B87817, 0x00B87918, 0x00B89417, 0x00B89518, 0x00B8B017,
+    0x00B8B118, 0x00B8CC17, 0x00B8CD18, 0x00B8E817, 0x00B8E918, 0x00B90417,
+    0x00B90518, 0x00B92017, 0x00B92118, 0x00B93C17, 0x00B93D18, 0x00B95817,
+    0x00B95918, 0x00B97417, 0x00B97518, 0x00B99017, 0x00B99118, 0x00B9AC17,
+    0x00B9AD18, 0x00B9C817, 0x00B9C918, 0x00B9E417, 0x00B9E518, 0x00BA0017,
+    0x00BA0118, 0x00BA1C17, 0x00BA1D18, 0x00BA3817, 0x00BA3918, 0x00BA5417,
+    0x00BA5518, 0x00BA7017, 0x00BA7118, 0x00BA8C17, 0x00BA8D18, 0x00BAA817,
+    0x00BAA918, 0x00BAC417, 0x00BAC518, 0x00BAE017, 0x00BAE118, 0x00BAFC17,
+    0x00BAFD18, 0x00BB1817, 0x00BB1918, 0x00BB3417, 0x00BB3518, 0x00BB5017,
+    0x00BB5118, 0x00BB6C17, 0x00BB6D18, 0x00BB8817, 0x00BB8918, 0x00BBA417,
+    0x00BBA518, 0x00BBC017, 0x00BBC118, 0x00BBDC17, 0x00BBDD18, 0x00BBF817,
+    0x00BBF918, 0x00BC1417, 0x00BC1518, 0x00BC3017, 0x00BC3118, 0x00BC4C17,
+    0x00BC4D18, 0x00BC6817, 0x00BC6918, 0x00BC8417, 0x00BC8518, 0x00BCA017,
+    0x00BCA118, 0x00BCBC17, 0x00BCBD18, 0x00BCD817, 0x00BCD918, 0x00BCF417,
+    0x00BCF518, 0x00BD1017, 0x00BD1118, 0x00BD2C17, 0x00BD2D18, 0x00BD4817,
+    0x00BD4918, 0x00BD6417, 0x00BD6518, 0x00BD8017, 0x00BD8118, 0x00BD9C17,
+    0x00BD9D18, 0x00BDB817, 0x00BDB918, 0x00BDD417, 0x00BDD518, 0x00BDF017,
+    0x00BDF118, 0x00BE0C17, 0x00BE0D18, 0x00BE2817, 0x00BE2918, 0x00BE4417,
+    0x00BE4518, 0x00BE6017, 0x00BE6118, 0x00BE7C17, 0x00BE7D18, 0x00BE9817,
+    0x00BE9918, 0x00BEB417, 0x00BEB518, 0x00BED017, 0x00BED118, 0x00BEEC17,
+    0x00BEED18, 0x00BF0817, 0x00BF0918, 0x00BF2417, 0x00BF2518, 0x00BF4017,
+    0x00BF4118, 0x00BF5C17, 0x00BF5D18, 0x00BF7817, 0x00BF7918, 0x00BF9417,
+    0x00BF9518, 0x00BFB017, 0x00BFB118, 0x00BFCC17, 0x00BFCD18, 0x00BFE817,
+    0x00BFE918, 0x00C00417, 0x00C00518, 0x00C02017, 0x00C02118, 0x00C03C17,
+    0x00C03D18, 0x00C05817, 0x00C05918, 0x00C07417, 0x00C07518, 0x00C09017,
+    0x00C09118, 0x00C0AC17, 0x00C0AD18, 0x00C0C817, 0x00C0C918, 0x00C0E417,
+    0x00C0E518, 0x00C10017, 0x00C10118, 0x00C11C17, 0x00C11D18, 0x00C13817,
+    0x00C13918, 0x00C15417, 0x00C15518, 0x00C17017, 0x00C17118, 0x00C18C17,
+    0x00C18D18, 0x00C1A817, 0x00C1A918, 0x00C1C417, 0x00C1C518, 0x00C1E017,
+    0x00C1E118, 0x00C1FC17, 0x00C1FD18, 0x00C21817, 0x00C21918, 0x00C23417,
+    0x00C23518, 0x00C25017, 0x00C25118, 0x00C26C17, 0x00C26D18, 0x00C28817,
+    0x00C28918, 0x00C2A417, 0x00C2A518, 0x00C2C017, 0x00C2C118, 0x00C2DC17,
+    0x00C2DD18, 0x00C2F817, 0x00C2F918, 0x00C31417, 0x00C31518, 0x00C33017,
+    0x00C33118, 0x00C34C17, 0x00C34D18, 0x00C36817, 0x00C36918, 0x00C38417,
+    0x00C38518, 0x00C3A017, 0x00C3A118, 0x00C3BC17, 0x00C3BD18, 0x00C3D817,
+    0x00C3D918, 0x00C3F417, 0x00C3F518, 0x00C41017, 0x00C41118, 0x00C42C17,
+    0x00C42D18, 0x00C44817, 0x00C44918, 0x00C46417, 0x00C46518, 0x00C48017,
+    0x00C48118, 0x00C49C17, 0x00C49D18, 0x00C4B817, 0x00C4B918, 0x00C4D417,
+    0x00C4D518, 0x00C4F017, 0x00C4F118, 0x00C50C17, 0x00C50D18, 0x00C52817,
+    0x00C52918, 0x00C54417, 0x00C54518, 0x00C56017, 0x00C56118, 0x00C57C17,
+    0x00C57D18, 0x00C59817, 0x00C59918, 0x00C5B417, 0x00C5B518, 0x00C5D017,
+    0x00C5D118, 0x00C5EC17, 0x00C5ED18, 0x00C60817, 0x00C60918, 0x00C62417,
+    0x00C62518, 0x00C64017, 0x00C64118, 0x00C65C17, 0x00C65D18, 0x00C67817,
+    0x00C67918, 0x00C69417, 0x00C69518, 0x00C6B017, 0x00C6B118, 0x00C6CC17,
+    0x00C6CD18, 0x00C6E817, 0x00C6E918, 0x00C70417, 0x00C70518, 0x00C72017,
+    0x00C72118, 0x00C73C17, 0x00C73D18, 0x00C75817, 0x00C75918, 0x00C77417,
+    0x00C77518, 0x00C79017, 0x00C79118, 0x00C7AC17, 0x00C7AD18, 0x00C7C817,
+    0x00C7C918, 0x00C7E417, 0x00C7E518, 0x00C80017, 0x00C80118, 0x00C81C17,
+    0x00C81D18, 0x00C83817, 0x00C83918, 0x00C85417, 0x00C85518, 0x00C87017,
+    0x00C87118, 0x00C88C17, 0x00C88D18, 0x00C8A817, 0x00C8A918, 0x00C8C417,
+    0x00C8C518, 0x00C8E017, 0x00C8E118, 0x00C8FC17, 0x00C8FD18, 0x00C91817,
+    0x00C91918, 0x00C93417, 0x00C93518, 0x00C95017, 0x00C95118, 0x00C96C17,
+    0x00C96D18, 0x00C98817, 0x00C98918, 0x00C9A417, 0x00C9A518, 0x00C9C017,
+    0x00C9C118, 0x00C9DC17, 0x00C9DD18, 0x00C9F817, 0x00C9F918, 0x00CA1417,
+    0x00CA1518, 0x00CA3017, 0x00CA3118, 0x00CA4C17, 0x00CA4D18, 0x00CA6817,
+    0x00CA6918, 0x00CA8417, 0x00CA8518, 0x00CAA017, 0x00CAA118, 0x00CABC17,
+    0x00CABD18, 0x00CAD817, 0x00CAD918, 0x00CAF417, 0x00CAF518, 0x00CB1017,
+    0x00CB1118, 0x00CB2C17, 0x00CB2D18, 0x00CB4817, 0x00CB4918, 0x00CB6417,
+    0x00CB6518, 0x00CB8017, 0x00CB8118, 0x00CB9C17, 0x00CB9D18, 0x00CBB817,
+    0x00CBB918, 0x00CBD417, 0x00CBD518, 0x00CBF017, 0x00CBF118, 0x00CC0C17,
+    0x00CC0D18, 0x00CC2817, 0x00CC2918, 0x00CC4417, 0x00CC4518, 0x00CC6017,
+    0x00CC6118, 0x00CC7C17, 0x00CC7D18, 0x00CC9817, 0x00CC9918, 0x00CCB417,
+    0x00CCB518, 0x00CCD017, 0x00CCD118, 0x00CCEC17, 0x00CCED18, 0x00CD0817,
+    0x00CD0918, 0x00CD2417, 0x00CD2518, 0x00CD4017, 0x00CD4118, 0x00CD5C17,
+    0x00CD5D18, 0x00CD7817, 0x00CD7918, 0x00CD9417, 0x00CD9518, 0x00CDB017,
+    0x00CDB118, 0x00CDCC17, 0x00CDCD18, 0x00CDE817, 0x00CDE918, 0x00CE0417,
+    0x00CE0518, 0x00CE2017, 0x00CE2118, 0x00CE3C17, 0x00CE3D18, 0x00CE5817,
+    0x00CE5918, 0x00CE7417, 0x00CE7518, 0x00CE9017, 0x00CE9118, 0x00CEAC17,
+    0x00CEAD18, 0x00CEC817, 0x00CEC918, 0x00CEE417, 0x00CEE518, 0x00CF0017,
+    0x00CF0118, 0x00CF1C17, 0x00CF1D18, 0x00CF3817, 0x00CF3918, 0x00CF5417,
+    0x00CF5518, 0x00CF7017, 0x00CF7118, 0x00CF8C17, 0x00CF8D18, 0x00CFA817,
+    0x00CFA918, 0x00CFC417, 0x00CFC518, 0x00CFE017, 0x00CFE118, 0x00CFFC17,
+    0x00CFFD18, 0x00D01817, 0x00D01918, 0x00D03417, 0x00D03518, 0x00D05017,
+    0x00D05118, 0x00D06C17, 0x00D06D18, 0x00D08817, 0x00D08918, 0x00D0A417,
+    0x00D0A518, 0x00D0C017, 0x00D0C118, 0x00D0DC17, 0x00D0DD18, 0x00D0F817,
+    0x00D0F918, 0x00D11417, 0x00D11518, 0x00D13017, 0x00D13118, 0x00D14C17,
+    0x00D14D18, 0x00D16817, 0x00D16918, 0x00D18417, 0x00D18518, 0x00D1A017,
+    0x00D1A118, 0x00D1BC17, 0x00D1BD18, 0x00D1D817, 0x00D1D918, 0x00D1F417,
+    0x00D1F518, 0x00D21017, 0x00D21118, 0x00D22C17, 0x00D22D18, 0x00D24817,
+    0x00D24918, 0x00D26417, 0x00D26518, 0x00D28017, 0x00D28118, 0x00D29C17,
+    0x00D29D18, 0x00D2B817, 0x00D2B918, 0x00D2D417, 0x00D2D518, 0x00D2F017,
+    0x00D2F118, 0x00D30C17, 0x00D30D18, 0x00D32817, 0x00D32918, 0x00D34417,
+    0x00D34518, 0x00D36017, 0x00D36118, 0x00D37C17, 0x00D37D18, 0x00D39817,
+    0x00D39918, 0x00D3B417, 0x00D3B518, 0x00D3D017, 0x00D3D118, 0x00D3EC17,
+    0x00D3ED18, 0x00D40817, 0x00D40918, 0x00D42417, 0x00D42518, 0x00D44017,
+    0x00D44118, 0x00D45C17, 0x00D45D18, 0x00D47817, 0x00D47918, 0x00D49417,
+    0x00D49518, 0x00D4B017, 0x00D4B118, 0x00D4CC17, 0x00D4CD18, 0x00D4E817,
+    0x00D4E918, 0x00D50417, 0x00D50518, 0x00D52017, 0x00D52118, 0x00D53C17,
+    0x00D53D18, 0x00D55817, 0x00D55918, 0x00D57417, 0x00D57518, 0x00D59017,
+    0x00D59118, 0x00D5AC17, 0x00D5AD18, 0x00D5C817, 0x00D5C918, 0x00D5E417,
+    0x00D5E518, 0x00D60017, 0x00D60118, 0x00D61C17, 0x00D61D18, 0x00D63817,
+    0x00D63918, 0x00D65417, 0x00D65518, 0x00D67017, 0x00D67118, 0x00D68C17,
+    0x00D68D18, 0x00D6A817, 0x00D6A918, 0x00D6C417, 0x00D6C518, 0x00D6E017,
+    0x00D6E118, 0x00D6FC17, 0x00D6FD18, 0x00D71817, 0x00D71918, 0x00D73417,
+    0x00D73518, 0x00D75017, 0x00D75118, 0x00D76C17, 0x00D76D18, 0x00D78817,
+    0x00D78918, 0x00D7A40C, 0x00D7B01A, 0x00D7C70C, 0x00D7CB1B, 0x00D7FC0C,
+    0x00F9000E, 0x00FB000C, 0x00FB1D0D, 0x00FB1E15, 0x00FB1F0D, 0x00FB290C,
+    0x00FB2A0D, 0x00FB370C, 0x00FB380D, 0x00FB3D0C, 0x00FB3E0D, 0x00FB3F0C,
+    0x00FB400D, 0x00FB420C, 0x00FB430D, 0x00FB450C, 0x00FB460D, 0x00FB500C,
+    0x00FD3E01, 0x00FD3F00, 0x00FD400C, 0x00FDFC09, 0x00FDFD0C, 0x00FE0015,
+    0x00FE1008, 0x00FE1101, 0x00FE1308, 0x00FE150E, 0x00FE1700, 0x00FE1801,
+    0x00FE190F, 0x00FE1A0C, 0x00FE2015, 0x00FE300E, 0x00FE3105, 0x00FE330E,
+    0x00FE3500, 0x00FE3601, 0x00FE3700, 0x00FE3801, 0x00FE3900, 0x00FE3A01,
+    0x00FE3B00, 0x00FE3C01, 0x00FE3D00, 0x00FE3E01, 0x00FE3F00, 0x00FE4001,
+    0x00FE4100, 0x00FE4201, 0x00FE4300, 0x00FE4401, 0x00FE450E, 0x00FE4700,
+    0x00FE4801, 0x00FE490E, 0x00FE5001, 0x00FE510E, 0x00FE5201, 0x00FE530C,
+    0x00FE5405, 0x00FE5606, 0x00FE5805, 0x00FE5900, 0x00FE5A01, 0x00FE5B00,
+    0x00FE5C01, 0x00FE5D00, 0x00FE5E01, 0x00FE5F0E, 0x00FE6305, 0x00FE640E,
+    0x00FE670C, 0x00FE680E, 0x00FE6909, 0x00FE6A0A, 0x00FE6B0E, 0x00FE6C0C,
+    0x00FEFF16, 0x00FF000C, 0x00FF0106, 0x00FF020E, 0x00FF0409, 0x00FF050A,
+    0x00FF060E, 0x00FF0800, 0x00FF0902, 0x00FF0A0E, 0x00FF0C01, 0x00FF0D05,
+    0x00FF0E01, 0x00FF0F0E, 0x00FF1A05, 0x00FF1C0E, 0x00FF1F06, 0x00FF200E,
+    0x00FF3B00, 0x00FF3C0E, 0x00FF3D02, 0x00FF3E0E, 0x00FF5B00, 0x00FF5C0E,
+    0x00FF5D01, 0x00FF5E05, 0x00FF5F00, 0x00FF6001, 0x00FF6200, 0x00FF6301,
+    0x00FF6505, 0x00FF660C, 0x00FF6705, 0x00FF710C, 0x00FF9E05, 0x00FFA00C,
+    0x00FFE00A, 0x00FFE109, 0x00FFE20E, 0x00FFE509, 0x00FFE70C, 0x00FFF915,
+    0x00FFFC0C, 0x0101FD15, 0x0101FE0C, 0x0102E015, 0x0102E10C, 0x01037615,
+    0x01037B0C, 0x0104A00B, 0x0104AA0C, 0x010A0115, 0x010A040C, 0x010A0515,
+    0x010A070C, 0x010A0C15, 0x010A100C, 0x010A3815, 0x010A3B0C, 0x010A3F15,
+    0x010A400C, 0x010AE515, 0x010AE70C, 0x010D2415, 0x010D280C, 0x010D300B,
+    0x010D3A0C, 0x010EAB15, 0x010EAD11, 0x010EAE0C, 0x010F4615, 0x010F510C,
+    0x010F8215, 0x010F860C, 0x01100015, 0x0110030C, 0x01103815, 0x0110470C,
+    0x0110660B, 0x01107015, 0x0110710C, 0x01107315, 0x0110750C, 0x01107F15,
+    0x0110830C, 0x0110B015, 0x0110BB0C, 0x0110BD15, 0x0110BE0C, 0x0110C215,
+    0x0110C30C, 0x0110CD15, 0x0110CE0C, 0x0110F00B, 0x0110FA0C, 0x01110015,
+    0x0111030C, 0x01112715, 0x0111350C, 0x0111360B, 0x0111400C, 0x01114515,
+    0x0111470C, 0x01117315, 0x0111740C, 0x01118015, 0x0111830C, 0x0111B315,
+    0x0111C10C, 0x0111C915, 0x0111CD0C, 0x0111CE15, 0x0111D00B, 0x0111DA0C,
+    0x01122C15, 0x0112380C, 0x01123E15, 0x01123F0C, 0x0112DF15, 0x0112EB0C,
+    0x0112F00B, 0x0112FA0C, 0x01130015, 0x0113040C, 0x01133B15, 0x01133D0C,
+    0x01133E15, 0x0113450C, 0x01134715, 0x0113490C, 0x01134B15, 0x01134E0C,
+    0x01135715, 0x0113580C, 0x01136215, 0x0113640C, 0x01136615, 0x01136D0C,
+    0x01137015, 0x0113750C, 0x01143515, 0x0114470C, 0x0114500B, 0x01145A0C,
+    0x01145E15, 0x01145F0C, 0x0114B015, 0x0114C40C, 0x0114D00B, 0x0114DA0C,
+    0x0115AF15, 0x0115B60C, 0x0115B815, 0x0115C10C, 0x0115DC15, 0x0115DE0C,
+    0x01163015, 0x0116410C, 0x0116500B, 0x01165A0C, 0x0116AB15, 0x0116B80C,
+    0x0116C00B, 0x0116CA0C, 0x01171D15, 0x01172C0C, 0x0117300B, 0x01173A0C,
+    0x01182C15, 0x01183B0C, 0x0118E00B, 0x0118EA0C, 0x01193015, 0x0119360C,
+    0x01193715, 0x0119390C, 0x01193B15, 0x01193F0C, 0x01194015, 0x0119410C,
+    0x01194215, 0x0119440C, 0x0119500B, 0x01195A0C, 0x0119D115, 0x0119D80C,
+    0x0119DA15, 0x0119E10C, 0x0119E415, 0x0119E50C, 0x011A0115, 0x011A0B0C,
+    0x011A3315, 0x011A3A0C, 0x011A3B15, 0x011A3F0C, 0x011A4715, 0x011A480C,
+    0x011A5115, 0x011A5C0C, 0x011A8A15, 0x011A9A0C, 0x011C2F15, 0x011C370C,
+    0x011C3815, 0x011C400C, 0x011C500B, 0x011C5A0C, 0x011C9215, 0x011CA80C,
+    0x011CA915, 0x011CB70C, 0x011D3115, 0x011D370C, 0x011D3A15, 0x011D3B0C,
+    0x011D3C15, 0x011D3E0C, 0x011D3F15, 0x011D460C, 0x011D4715, 0x011D480C,
+    0x011D500B, 0x011D5A0C, 0x011D8A15, 0x011D8F0C, 0x011D9015, 0x011D920C,
+    0x011D9315, 0x011D980C, 0x011DA00B, 0x011DAA0C, 0x011EF315, 0x011EF70C,
+    0x011FDD09, 0x011FE10C, 0x01343015, 0x0134390C, 0x016A600B, 0x016A6A0C,
+    0x016AC00B, 0x016ACA0C, 0x016AF015, 0x016AF50C, 0x016B3015, 0x016B370C,
+    0x016B500B, 0x016B5A0C, 0x016F4F15, 0x016F500C, 0x016F5115, 0x016F880C,
+    0x016F8F15, 0x016F930C, 0x016FE00E, 0x016FE415, 0x016FE50C, 0x016FF015,
+    0x016FF20C, 0x0170000E, 0x0187F80C, 0x0188000E, 0x018CD60C, 0x018D000E,
+    0x018D090C, 0x01AFF00E, 0x01AFF40C, 0x01AFF50E, 0x01AFFC0C, 0x01AFFD0E,
+    0x01AFFF0C, 0x01B0000E, 0x01B1230C, 0x01B1500E, 0x01B1530C, 0x01B1640E,
+    0x01B1680C, 0x01B1700E, 0x01B2FC0C, 0x01BC9D15, 0x01BC9F0C, 0x01BCA015,
+    0x01BCA40C, 0x01CF0015, 0x01CF2E0C, 0x01CF3015, 0x01CF470C, 0x01D16515,
+    0x01D16A0C, 0x01D16D15, 0x01D1830C, 0x01D18515, 0x01D18C0C, 0x01D1AA15,
+    0x01D1AE0C, 0x01D24215, 0x01D2450C, 0x01D7CE0B, 0x01D8000C, 0x01DA0015,
+    0x01DA370C, 0x01DA3B15, 0x01DA6D0C, 0x01DA7515, 0x01DA760C, 0x01DA8415,
+    0x01DA850C, 0x01DA9B15, 0x01DAA00C, 0x01DAA115, 0x01DAB00C, 0x01E00015,
+    0x01E0070C, 0x01E00815, 0x01E0190C, 0x01E01B15, 0x01E0220C, 0x01E02315,
+    0x01E0250C, 0x01E02615, 0x01E02B0C, 0x01E13015, 0x01E1370C, 0x01E1400B,
+    0x01E14A0C, 0x01E2AE15, 0x01E2AF0C, 0x01E2EC15, 0x01E2F00B, 0x01E2FA0C,
+    0x01E2FF09, 0x01E3000C, 0x01E8D015, 0x01E8D70C, 0x01E94415, 0x01E94B0C,
+    0x01E9500B, 0x01E95A0C, 0x01ECB009, 0x01ECB10C, 0x01F0040E, 0x01F0050C,
+    0x01F02C0E, 0x01F0300C, 0x01F0940E, 0x01F0A00C, 0x01F0AF0E, 0x01F0B10C,
+    0x01F0C00E, 0x01F0C10C, 0x01F0CF0E, 0x01F0D10C, 0x01F0F60E, 0x01F1000C,
+    0x01F18E0E, 0x01F18F0C, 0x01F1910E, 0x01F19B0C, 0x01F1AE0E, 0x01F1E61C,
+    0x01F2000E, 0x01F3210C, 0x01F32D0E, 0x01F3360C, 0x01F3370E, 0x01F37D0C,
+    0x01F37E0E, 0x01F3940C, 0x01F3A00E, 0x01F3CB0C, 0x01F3CF0E, 0x01F3D40C,
+    0x01F3E00E, 0x01F3F10C, 0x01F3F40E, 0x01F3F50C, 0x01F3F80E, 0x01F43F0C,
+    0x01F4400E, 0x01F4410C, 0x01F4420E, 0x01F4FD0C, 0x01F4FF0E, 0x01F53E0C,
+    0x01F54B0E, 0x01F54F0C, 0x01F5500E, 0x01F5680C, 0x01F57A0E, 0x01F57B0C,
+    0x01F5950E, 0x01F5970C, 0x01F5A40E, 0x01F5A50C, 0x01F5FB0E, 0x01F6500C,
+    0x01F6800E, 0x01F6C60C, 0x01F6CC0E, 0x01F6CD0C, 0x01F6D00E, 0x01F6D30C,
+    0x01F6D50E, 0x01F6E00C, 0x01F6EB0E, 0x01F6F00C, 0x01F6F40E, 0x01F7000C,
+    0x01F7740E, 0x01F7800C, 0x01F7D90E, 0x01F8000C, 0x01F80C0E, 0x01F8100C,
+    0x01F8480E, 0x01F8500C, 0x01F85A0E, 0x01F8600C, 0x01F8880E, 0x01F8900C,
+    0x01F8AE0E, 0x01F8B00C, 0x01F8B20E, 0x01F9000C, 0x01F90C0E, 0x01F93B0C,
+    0x01F93C0E, 0x01F9460C, 0x01F9470E, 0x01FA000C, 0x01FA540E, 0x01FA600C,
+    0x01FA6E0E, 0x01FB000C, 0x01FBF00B, 0x01FBFA0C, 0x01FC000E, 0x01FFFE0C,
+    0x0200000E, 0x02FFFE0C, 0x0300000E, 0x03FFFE0C, 0x0E000115, 0x0E00020C,
+    0x0E002015, 0x0E00800C, 0x0E010015, 0x0E01F00C,
+};
+
+// 成对表：行为前一个字符的类别，列为后一个字符的类别；
+// 0 直接可断，1 中间有空格时可断，2 不可断
+static const uint8_t s_lb_pairs[LB_PAIR_CLASSES][LB_PAIR_CLASSES] = {
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},  // OP
+    {0,2,2,1,1,2,2,2,2,1,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // CL
+    {0,2,2,1,1,2,2,2,2,1,1,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // CP
+    {2,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1},  // QU
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1},  // GL
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // NS
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // EX
+    {0,2,2,1,1,1,2,2,2,0,0,1,0,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // SY
+    {0,2,2,1,1,1,2,2,2,0,0,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // IS
+    {1,2,2,1,1,1,2,2,2,0,0,1,1,1,1,1,1,1,0,0,0,0,2,1,1,1,1,1,0},  // PR
+    {1,2,2,1,1,1,2,2,2,0,0,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // PO
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // NU
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // AL
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // HL
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // ID
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // IN
+    {0,2,2,1,0,1,2,2,2,0,0,1,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // HY
+    {0,2,2,1,0,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // BA
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1},  // BB
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,2,0,0,2,0,0,0,0,0,0},  // B2
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},  // ZW
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,0},  // CM
+    {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,1,1,1},  // WJ
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,1,1,0},  // H2
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,1,0},  // H3
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,1,1,1,1,0,0},  // JL
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,1,1,0},  // JV
+    {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,1,0},  // JT
+    {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,0,0,2,0,0,0,0,0,1},  // RI
+};
+
+// 断字字典树节点（格式见 tools/gen_line_break.py）
+static const uint32_t s_hyph_trie[HYPH_TRIE_SIZE] = {
+    0x0006C001, 0x000D0002, 0x00124003, 0x00164004, 0x001C0005, 0x00224006,
+    0x00268007, 0x002B0008, 0x002F8009, 0x0036000A, 0x0037000B, 0x003AC00C,
+    0x0040800D, 0x0045000E, 0x004B400F, 0x00514010, 0x00560011, 0x00564012,
+    0x005C0013, 0x0061C014, 0x00674015, 0x006CC016, 0x006E4017, 0x0071C018,
+    0x00744019, 0x0078801A, 0x007AC03B, 0x00804002, 0x00824003, 0x00840684,
+    0x00860005, 0x00864686, 0x00868007, 0x00888008, 0x00898649, 0x0000008A,
+    0x008AC00B, 0x008B000C, 0x008D000D, 0x008E468E, 0x0000174F, 0x00910010,
+    0x00930011, 0x00934B52, 0x00968013, 0x00994014, 0x009BC015, 0x009D8016,
+    0x009E8017, 0x009F8018, 0x009FC019, 0x00A0803A, 0x00A10001, 0x00A349C2,
+    0x00001C44, 0x00A3C005, 0x000006C6, 0x00001F08, 0x00A68009, 0x0000008A,
+    0x000016CB, 0x00A88B0C, 0x00001C4D, 0x00A9DF0E, 0x00AA000F, 0x00001750,
+    0x00AC8012, 0x00AD0E93, 0x00AD46D4, 0x00AE0015, 0x00000096, 0x00002257,
+    0x00B00039, 0x00B080C1, 0x00B38F83, 0x00B44005, 0x00B6C6C8, 0x00B840C9,
+    0x00BB804B, 0x00BBC60C, 0x000023CE, 0x00BCC0CF, 0x00000091, 0x00C00012,
+    0x00002053, 0x00C149D4, 0x00C28015, 0x000000D9, 0x00C5003A, 0x00C543C1,
+    0x00000082, 0x000023C3, 0x000004C4, 0x00C80005, 0x00001C46, 0x00CC4007,
+    0x00000388, 0x00CD4009, 0x0000008A, 0x000029CB, 0x00D1000C, 0x0000008D,
+    0x00001D8E, 0x00D240CF, 0x00000090, 0x00D600D2, 0x00D78A53, 0x00D84014,
+    0x00D880D5, 0x00000096, 0x00000097, 0x00DA86B9, 0x00DB0001, 0x00DDC9C2,
+    0x00DE8003, 0x00E0C004, 0x00E28005, 0x00E50086, 0x00E64007, 0x00E804C8,
+    0x00E84649, 0x00EA008A, 0x00EA400B, 0x00EAC00C, 0x00ED000D, 0x00EF400E,
+    0x00F2400F, 0x00F4C010, 0x00F70091, 0x00F74012, 0x00FA8013, 0x00FDC014,
+    0x01005755, 0x01018016, 0x0102C017, 0x0103C018, 0x01040039, 0x0104C0C1,
+    0x00002242, 0x00001744, 0x01070005, 0x01099C46, 0x00001748, 0x010A80C9,
+    0x010C5DCC, 0x0000174D, 0x0000174E, 0x010D40CF, 0x00002250, 0x010E0012,
+    0x00000C13, 0x010F06D4, 0x010F8FD5, 0x000000F9, 0x011140C1, 0x00000F82,
+    0x000016C4, 0x01134005, 0x0115DD07, 0x01168008, 0x01174009, 0x011A864C,
+    0x011B808D, 0x011BC00E, 0x011CC0CF, 0x00000F90, 0x011F40D2, 0x01208653,
+    0x0120C014, 0x01210015, 0x00000F97, 0x012280F9, 0x01230001, 0x00000082,
+    0x01260005, 0x00000086, 0x00000088, 0x01290009, 0x0000174B, 0x012C1D8C,
+    0x012C9C4D, 0x000009CE, 0x012CC00F, 0x00002250, 0x012F5B12, 0x012FDD13,
+    0x01300014, 0x0130C015, 0x01320097, 0x01324039, 0x0132C9C1, 0x01344002,
+    0x0135C003, 0x013846C4, 0x013A48C5, 0x013C0006, 0x013D86C7, 0x00000F88,
+    0x00002349, 0x00000F8A, 0x0000174B, 0x013F800C, 0x0142000D, 0x0143800E,
+    0x014746CF, 0x0149C6D0, 0x014B0011, 0x014B5752, 0x014D4013, 0x01510014,
+    0x00000095, 0x015346D6, 0x00002257, 0x01540018, 0x00001759, 0x0154403A,
+    0x01552401, 0x015580C5, 0x0156400F, 0x01568035, 0x0156C001, 0x00000082,
+    0x01580005, 0x00000F86, 0x000016C8, 0x015A0089, 0x000016CB, 0x015BC08C,
+    0x0000008D, 0x015C400E, 0x015CC00F, 0x015D8012, 0x015DDD13, 0x000023D4,
+    0x000000B7, 0x015E8001, 0x016109C2, 0x01615D03, 0x0161C6C4, 0x01628005,
+    0x016546C6, 0x01659D87, 0x00000C08, 0x01664009, 0x0000174A, 0x016A400B,
+    0x016A808C, 0x016B86CD, 0x00000A4E, 0x016C400F, 0x016FC6D0, 0x00001C52,
+    0x01710A53, 0x0171D754, 0x01734015, 0x01760016, 0x000009D7, 0x017640F9,
+    0x017780C1, 0x017A5C42, 0x00002243, 0x017AC005, 0x00001C46, 0x000006C8,
+    0x017D8009, 0x0000174B, 0x00001C4C, 0x0180008D, 0x01805C4E, 0x018100CF,
+    0x01845C50, 0x00001F12, 0x01861D13, 0x00001754, 0x018680D5, 0x00001777,
+    0x0187C0C1, 0x00001D82, 0x018AC003, 0x018C8004, 0x018DC005, 0x00000F86,
+    0x01920007, 0x01945D88, 0x0194C009, 0x0000008A, 0x0197D9CB, 0x00001C4C,
+    0x0198A3CD, 0x0198DD0E, 0x0199400F, 0x019D44D0, 0x00000091, 0x019DC092,
+    0x019E0A53, 0x01A04094, 0x01A1C015, 0x00000396, 0x000004D7, 0x01A40019,
+    0x01A4977A, 0x01A4D741, 0x01A60002, 0x01A74003, 0x01A94004, 0x01AA4005,
+    0x01AB8006, 0x01ABC007, 0x01ADC388, 0x01AE0649, 0x000023CA, 0x01B006CB,
+    0x01B0800C, 0x01B3800D, 0x01B5468E, 0x01B8464F, 0x01B98010, 0x00000091,
+    0x01BB8012, 0x01BEC013, 0x01C08014, 0x01C1C655, 0x01C34016, 0x01C40017,
+    0x01C54039, 0x01C580C1, 0x00001C42, 0x000016C4, 0x01C84005, 0x00001746,
+    0x00001747, 0x01CB0008, 0x01CD8009, 0x00000CCB, 0x01CFC44C, 0x00001C4D,
+    0x00000C0E, 0x01D0C00F, 0x01D3DC50, 0x01D48652, 0x01D58A53, 0x01D649D4,
+    0x01D7C015, 0x00000FB7, 0x01DA0675, 0x01DA8001, 0x01DE0082, 0x01DEC083,
+    0x01DFC004, 0x01E04005, 0x01E4C086, 0x01E54647, 0x01E696C8, 0x01E70009,
+    0x00000F8A, 0x01EAC00B, 0x01EB408C, 0x01EC008D, 0x01ED000E, 0x01EE400F,
+    0x01F20090, 0x01F304D2, 0x01F419D3, 0x01F60014, 0x01F74015, 0x01F94016,
+    0x00000097, 0x01FA0039, 0x01FAC641, 0x00002242, 0x01FD4003, 0x00002244,
+    0x01FF0005, 0x00001F06, 0x00000C07, 0x02030688, 0x02044009, 0x0207864B,
+    0x0208038C, 0x0208C9CD, 0x000004CE, 0x0209C0CF, 0x020BC010, 0x020D4011,
+    0x00000092, 0x020D86D3, 0x02100014, 0x021280D5, 0x00001756, 0x02148657,
+    0x0214D739, 0x0215C0C1, 0x000009C2, 0x021A1743, 0x00001C44, 0x021A4005,
+    0x000009C6, 0x00001C47, 0x021E8008, 0x02204009, 0x022486CC, 0x02255C4D,
+    0x00000A4E, 0x022580CF, 0x00001C50, 0x02288012, 0x0229DD13, 0x022AA054,
+    0x022B40D5, 0x00001756, 0x022E16D7, 0x022EC0D9, 0x022F977A, 0x022FC001,
+    0x02314002, 0x02320003, 0x02338004, 0x02350005, 0x02358006, 0x02360007,
+    0x02368849, 0x000023CA, 0x0000174B, 0x0237C00C, 0x023B000D, 0x023C400E,
+    0x023E400F, 0x023F0010, 0x02404012, 0x0243C6D3, 0x02460014, 0x02478F95,
+    0x00000396, 0x0247C018, 0x0248003A, 0x024840C1, 0x024AC005, 0x024CC009,
+    0x0250000F, 0x00001B16, 0x00001739, 0x0251C001, 0x00000082, 0x02544005,
+    0x02560008, 0x02564649, 0x0000170B, 0x0257C00C, 0x0258400E, 0x0258820F,
+    0x000023D0, 0x02590012, 0x02598013, 0x00001754, 0x000016F9, 0x025A8081,
+    0x00001403, 0x025BC085, 0x025C8088, 0x025D0F89, 0x025E0F8F, 0x025E4F90,
+    0x025EC394, 0x025F0095, 0x000016F8, 0x025F4001, 0x00000082, 0x02600083,
+    0x00000084, 0x0260C005, 0x0261C007, 0x00001F08, 0x00000089, 0x0262000C,
+    0x0263000D, 0x0263C00E, 0x026504CF, 0x02664010, 0x02678012, 0x02688013,
+    0x026A4014, 0x000000B7, 0x026AC041, 0x00001742, 0x026B46C5, 0x026C49C9,
+    0x0000240C, 0x0000174D, 0x026CC0CF, 0x026D4014, 0x026D9D3A, 0x026DC001,
+    0x0270C002, 0x0271C003, 0x02730004, 0x02740005, 0x0276C006, 0x02774007,
+    0x02784008, 0x02794009, 0x027A800A, 0x027AC00C, 0x027B800D, 0x027CC00E,
+    0x027D000F, 0x027E8010, 0x027F4012, 0x02808013, 0x02820014, 0x02838015,
+    0x02848016, 0x0284C017, 0x02850039, 0x02854001, 0x0285C645, 0x02860009,
+    0x0286800C, 0x0286C00F, 0x02871792, 0x02874015, 0x000017BB, 0x02878001,
+    0x0287C005, 0x02884008, 0x02889E49, 0x02894012, 0x02898014, 0x0289C035,
+    0x028A4004, 0x028A8005, 0x028AC709, 0x028C400C, 0x028C800F, 0x028CC012,
+    0x028D0013, 0x028D57B5, 0x028DD732, 0x000016E6, 0x028E0001, 0x028E8005,
+    0x00000089, 0x00001B4C, 0x0000008E, 0x028F46CF, 0x028FC015, 0x00001779,
+    0x00000FC1, 0x00000FC5, 0x0000170C, 0x00000FEF, 0x00002401, 0x02904003,
+    0x0290800C, 0x0290E14E, 0x02914034, 0x02918025, 0x0291C001, 0x02928004,
+    0x0292C705, 0x02934089, 0x0293C00C, 0x0000178D, 0x0294400F, 0x02948039,
+    0x02959781, 0x0296C005, 0x02970009, 0x029806CF, 0x02988030, 0x0298C001,
+    0x0299D784, 0x029AC005, 0x029BC707, 0x029C4009, 0x029EC00B, 0x029F000E,
+    0x029F56CF, 0x029F8013, 0x02A10014, 0x02A24035, 0x02A30001, 0x02A38005,
+    0x02A3C008, 0x02A44009, 0x000006CC, 0x02A5000F, 0x02A60013, 0x00000FF5,
+    0x02A64035, 0x02A68001, 0x02A90002, 0x02A94003, 0x02A98004, 0x02AA0005,
+    0x02AB0006, 0x02AB8089, 0x02AD000D, 0x02AD400F, 0x00000690, 0x00000F91,
+    0x02AE0012, 0x02AE4033, 0x02AEC001, 0x02AF4008, 0x02AF8009, 0x02B0800B,
+    0x0000170C, 0x02B0C00F, 0x02B10010, 0x02B14013, 0x02B18014, 0x02B20015,
+    0x000017BB, 0x02B246C1, 0x02B34005, 0x02B4D788, 0x02B54009, 0x02B7000F,
+    0x02B800D2, 0x02B84013, 0x02B88014, 0x02B946D5, 0x000006F9, 0x00001702,
+    0x02BA4007, 0x00001DCC, 0x02BAC00E, 0x00000F92, 0x02BB0013, 0x02BB4034,
+    0x02BBC6C1, 0x02BC4005, 0x02BCC089, 0x02BD402F, 0x02BDC001, 0x00000F89,
+    0x02BE000C, 0x000016F3, 0x02BE4029, 0x02BEC001, 0x000016C5, 0x000016F3,
+    0x02BF0009, 0x02BF403A, 0x02BF8004, 0x02BFC007, 0x02C0000C, 0x02C0400E,
+    0x02C10012, 0x02C18013, 0x00000114, 0x0000171A, 0x0000247B, 0x02C1C6C5,
+    0x02C20029, 0x02C24001, 0x02C2DA04, 0x02C38007, 0x02C4010C, 0x00001BCD,
+    0x02C4800E, 0x02C51893, 0x02C59014, 0x00000F97, 0x02C64019, 0x000017BB,
+    0x00000682, 0x00001704, 0x02C69005, 0x00000C46, 0x02C7010C, 0x02C7400E,
+    0x02C8000F, 0x02C886B4, 0x02C98001, 0x02C9C005, 0x02CA8009, 0x0000174F,
+    0x02CAC035, 0x02CB0025, 0x02CB5004, 0x00001705, 0x02CB800C, 0x02CBC00D,
+    0x02CC000E, 0x0000100F, 0x02CC4012, 0x00002653, 0x02CD8014, 0x02CE4035,
+    0x02CE8009, 0x02CEC02F, 0x02CF002F, 0x0000170C, 0x0000174F, 0x00000FF2,
+    0x02CF4006, 0x02CF8007, 0x02CFC00C, 0x02D0000D, 0x02D0570E, 0x02D08012,
+    0x02D0C013, 0x02D18034, 0x000016D3, 0x0000247B, 0x02D24002, 0x02D2C003,
+    0x02D30004, 0x00001887, 0x00000E08, 0x02D3400C, 0x02D4000E, 0x02D54010,
+    0x02D58012, 0x02D5C013, 0x02D64014, 0x02D6C036, 0x02D70008, 0x02D74009,
+    0x02D7802F, 0x02D84004, 0x00001009, 0x02D8C00C, 0x02D9410E, 0x00001010,
+    0x02DA4012, 0x02DA8013, 0x02DB56D4, 0x000016D7, 0x0000073B, 0x02DB8001,
+    0x02DC0645, 0x02DD8009, 0x000010CF, 0x02DE8014, 0x000017BB, 0x02DED001,
+    0x000023C3, 0x02DF4005, 0x02DF8006, 0x00001789, 0x02DFC00C, 0x0000070D,
+    0x02E0470E, 0x02E1400F, 0x02E18010, 0x02E24013, 0x02E28A14, 0x0000247A,
+    0x00000FA9, 0x02E2C001, 0x02E30005, 0x02E34009, 0x000016F9, 0x02E3C001,
+    0x00000645, 0x02E40707, 0x02E456C9, 0x02E4800C, 0x02E5000D, 0x02E5400E,
+    0x02E64010, 0x02E70012, 0x02E78013, 0x02E7C056, 0x02E80017, 0x02E8403A,
+    0x02E8C001, 0x02E94005, 0x02EA4649, 0x02EB400F, 0x02EBC035, 0x02EC0001,
+    0x02EC86C5, 0x02ECC009, 0x02ED4015, 0x00001777, 0x00002384, 0x00001746,
+    0x02ED9749, 0x02EDC00C, 0x02EE400D, 0x0000100E, 0x02EF0010, 0x02EF8012,
+    0x02F00113, 0x02F05634, 0x000016E5, 0x00000D02, 0x02F0C003, 0x00001786,
+    0x00000707, 0x00000B0D, 0x02F1000E, 0x02F14012, 0x02F21014, 0x02F2A656,
+    0x00002459, 0x0000247B, 0x02F2C001, 0x02F30002, 0x02F38003, 0x00000A04,
+    0x02F44005, 0x02F48009, 0x02F4C00C, 0x02F5574D, 0x02F6010E, 0x02F70090,
+    0x00000FD1, 0x02F7C012, 0x02F8C653, 0x02FA0094, 0x02FA4096, 0x00001799,
+    0x0000073B, 0x00001741, 0x02FA8005, 0x00000089, 0x000006F9, 0x02FAC5C1,
+    0x02FB0003, 0x00001004, 0x02FBC005, 0x000000C6, 0x02FC0007, 0x02FC400C,
+    0x02FC80CE, 0x02FD410F, 0x02FD8010, 0x02FDC652, 0x02FE4053, 0x02FEC014,
+    0x000001D6, 0x0000247B, 0x00002281, 0x02FF0005, 0x00000C4F, 0x00002295,
+    0x00000739, 0x02FFC004, 0x00002445, 0x00000E06, 0x00001747, 0x0300000C,
+    0x0300C00D, 0x0301000E, 0x0301800F, 0x0301C010, 0x00001752, 0x00001013,
+    0x03020015, 0x00001716, 0x00001018, 0x0000103B, 0x03024001, 0x0302D6C5,
+    0x03034009, 0x0303C00F, 0x03044015, 0x000017B9, 0x00001710, 0x00001757,
+    0x00001779, 0x000006E8, 0x00000301, 0x03048683, 0x03054005, 0x00001707,
+    0x0305800C, 0x0305C00D, 0x0000170E, 0x030617B0, 0x0000244E, 0x03064033,
+    0x00000502, 0x0306C003, 0x03070044, 0x03074007, 0x0307970C, 0x0308000D,
+    0x0308400E, 0x03088012, 0x030A0013, 0x030AC694, 0x030BC6B6, 0x030C8005,
+    0x030D0009, 0x00000FF2, 0x030D4001, 0x030DC003, 0x030E00C5, 0x030E4689,
+    0x030F400C, 0x030FC00F, 0x0310C0D2, 0x03110014, 0x031180F5, 0x00000B81,
+    0x00001A84, 0x0311C005, 0x03125789, 0x0313D78F, 0x03144012, 0x03148035,
+    0x00000683, 0x0314C004, 0x00000686, 0x0315000C, 0x0000068D, 0x0315800E,
+    0x00001C10, 0x0315CD53, 0x03160014, 0x00002438, 0x03164005, 0x00000106,
+    0x03168009, 0x0317800F, 0x0317C035, 0x03180001, 0x03184005, 0x03188009,
+    0x000023CE, 0x0319800F, 0x031A0015, 0x00002479, 0x031A8025, 0x00002403,
+    0x000023C4, 0x031AC647, 0x031B000D, 0x031B400E, 0x031C0012, 0x031C4034,
+    0x031D0035, 0x031D4009, 0x031D802C, 0x031DC0C1, 0x031F4005, 0x00000686,
+    0x03214689, 0x0323800C, 0x0324000F, 0x0324C013, 0x03250014, 0x03254035,
+    0x0325C001, 0x000023C2, 0x032680C5, 0x03270009, 0x0328800E, 0x0328C00F,
+    0x03294010, 0x03298015, 0x00000FF9, 0x032A0001, 0x032A8003, 0x032AC004,
+    0x032B0005, 0x032CC009, 0x0000178E, 0x032ED78F, 0x032F8013, 0x032FC014,
+    0x03304015, 0x0330C019, 0x00001ABA, 0x00002406, 0x00000687, 0x00001B09,
+    0x00000FCC, 0x03310010, 0x033140D2, 0x000016D3, 0x0331D754, 0x03320015,
+    0x00002437, 0x033246C1, 0x0332C005, 0x03338008, 0x0333C00C, 0x000000CF,
+    0x03340012, 0x03348013, 0x0334C014, 0x03350035, 0x03354035, 0x03358081,
+    0x03368702, 0x0336C003, 0x03370005, 0x00000088, 0x03398089, 0x0000158D,
+    0x033B800E, 0x033C070F, 0x033D0093, 0x033D4014, 0x033E1795, 0x033E4037,
+    0x033E8501, 0x033EC683, 0x033F83C5, 0x03405788, 0x0340C0C9, 0x0342800B,
+    0x0342C00D, 0x0343000F, 0x034380D0, 0x03444713, 0x03448014, 0x03458015,
+    0x00001737, 0x0345C001, 0x03460005, 0x03468008, 0x0346C009, 0x0000178E,
+    0x0348000F, 0x03484012, 0x03494015, 0x03498019, 0x000023FA, 0x0000240E,
+    0x00000FD0, 0x0349C012, 0x000016D3, 0x034A0034, 0x034AC001, 0x034B4005,
+    0x034C40C9, 0x034D400F, 0x00002435, 0x034D80C1, 0x034DC005, 0x00000FC8,
+    0x034E0029, 0x00000130, 0x00002443, 0x034EC005, 0x000016F3, 0x034F0002,
+    0x034F8003, 0x00001787, 0x034FC009, 0x0350000C, 0x0350400D, 0x0350E452,
+    0x03510014, 0x0351C035, 0x03520001, 0x00001702, 0x03528003, 0x00000704,
+    0x0353000C, 0x0353400D, 0x0353800E, 0x0353C052, 0x000016D6, 0x000017BB,
+    0x03540005, 0x03544009, 0x0355000C, 0x000006F9, 0x00000F81, 0x03554003,
+    0x0356C004, 0x03570007, 0x0357400C, 0x0358070E, 0x03594033, 0x03598005,
+    0x0359C009, 0x035A000F, 0x00000979, 0x035A644E, 0x035AC692, 0x000023B3,
+    0x035BC001, 0x035C0005, 0x035C8649, 0x035CC02F, 0x0000174F, 0x000006F9,
+    0x035D0005, 0x00001787, 0x035D400D, 0x035D800E, 0x035DC012, 0x035E0013,
+    0x035E8034, 0x000016C6, 0x035EC00C, 0x035F870D, 0x0360000E, 0x03608012,
+    0x0360C013, 0x03610014, 0x000017BA, 0x00000704, 0x03618005, 0x0361C00C,
+    0x0362410E, 0x0363410F, 0x03638012, 0x0363C013, 0x03640014, 0x00001716,
+    0x0000073B, 0x0364C6C5, 0x0365000C, 0x000016EF, 0x03654009, 0x0365800F,
+    0x0365C034, 0x036602C1, 0x036640C3, 0x0366C005, 0x000016CC, 0x0367400D,
+    0x0367800E, 0x0000244F, 0x03685012, 0x03688013, 0x00001715, 0x00002456,
+    0x0000101A, 0x0000247B, 0x0368D6C1, 0x00000105, 0x03694009, 0x0369D02F,
+    0x00001779, 0x036A1701, 0x036A4005, 0x036A80C9, 0x036B00EF, 0x00002382,
+    0x00002445, 0x00001687, 0x036B4009, 0x036B864E, 0x0000244F, 0x036C4012,
+    0x036CC013, 0x00000056, 0x0000103B, 0x036D0001, 0x036E4005, 0x036EC009,
+    0x0000174F, 0x036F0035, 0x036F4034, 0x00000F68, 0x036F9701, 0x00000705,
+    0x036FC009, 0x0000100E, 0x00001013, 0x00001B74, 0x00000ECE, 0x03700032,
+    0x03704002, 0x03708003, 0x0370C005, 0x03714007, 0x0371800C, 0x0000170D,
+    0x0371C00E, 0x03734010, 0x0373C012, 0x03750013, 0x03754015, 0x0375A47A,
+    0x0375C001, 0x03764003, 0x03769744, 0x0376C00C, 0x0377800D, 0x0377C68E,
+    0x0378000F, 0x00002390, 0x03784012, 0x0379C0D3, 0x037A1714, 0x000016F5,
+    0x037A4001, 0x037A8003, 0x037AC007, 0x000019CC, 0x037B000D, 0x037B400E,
+    0x037B800F, 0x00001710, 0x037BC012, 0x037CC013, 0x037D4014, 0x000006B6,
+    0x037D8001, 0x037DC6EF, 0x037E0025, 0x037E4004, 0x037ED707, 0x037F000C,
+    0x037F800D, 0x0380000E, 0x0380800F, 0x03810012, 0x03820013, 0x03828015,
+    0x0382C036, 0x03830005, 0x0383402F, 0x00001768, 0x0383C001, 0x03840005,
+    0x00001779, 0x00001707, 0x0384800D, 0x0384C00E, 0x03854013, 0x00001734,
+    0x03858021, 0x0385C010, 0x000006B3, 0x000006CC, 0x038656CD, 0x038686CE,
+    0x03874010, 0x03878013, 0x0387C034, 0x038896C5, 0x0388C009, 0x038980CC,
+    0x0000240F, 0x0389C0D2, 0x038A0035, 0x038A4001, 0x038B8003, 0x038BC005,
+    0x00001788, 0x038C0709, 0x038CC00C, 0x038D000F, 0x038D5C92, 0x038DC014,
+    0x038E4035, 0x038F4001, 0x000023C4, 0x038FC005, 0x039046C9, 0x0391800C,
+    0x0391C00F, 0x00001752, 0x039246F5, 0x03928004, 0x0392C007, 0x0393000C,
+    0x0393400E, 0x03944012, 0x03948013, 0x00000FF4, 0x03950005, 0x03954006,
+    0x0395C009, 0x00000FCC, 0x00001794, 0x000017BB, 0x03964001, 0x03968005,
+    0x0396C008, 0x03971789, 0x0000214C, 0x039806CF, 0x03988012, 0x0398C035,
+    0x039940C1, 0x039A4005, 0x000023C6, 0x039B0089, 0x039C800C, 0x0000178E,
+    0x039CC00F, 0x039D0014, 0x039D4015, 0x00000FB6, 0x039D8001, 0x039E0005,
+    0x039E8089, 0x039F800E, 0x039FC00F, 0x03A006F5, 0x03A04001, 0x03A0C003,
+    0x03A11784, 0x03A14705, 0x03A20007, 0x03A38709, 0x0000178B, 0x0000178C,
+    0x0000070E, 0x03A4CA0F, 0x03A58713, 0x03A60014, 0x03A68095, 0x00001799,
+    0x0000073B, 0x03A6C007, 0x000000CC, 0x0000170D, 0x03A7400E, 0x03A80010,
+    0x03A84012, 0x00001753, 0x03A88014, 0x03A94015, 0x000017BB, 0x000016C5,
+    0x03A98008, 0x03A9CF89, 0x03AA0012, 0x03AA4035, 0x03AA8035, 0x03AB40C1,
+    0x03ABC004, 0x03AC0005, 0x03AD0007, 0x03AD4089, 0x03AE400D, 0x03AE800F,
+    0x03AF0035, 0x03AF4001, 0x03B00803, 0x03B05785, 0x00001006, 0x03B08008,
+    0x03B10009, 0x00001B4B, 0x03B2000C, 0x03B2400D, 0x03B286CF, 0x03B2C090,
+    0x03B35953, 0x03B3C014, 0x03B506D5, 0x0000073B, 0x03B54001, 0x03B6C705,
+    0x00000708, 0x03B740C9, 0x03B9000F, 0x03B98012, 0x00001794, 0x03BA0015,
+    0x03BAC03A, 0x03BB0005, 0x03BBC009, 0x03BC802F, 0x0000172F, 0x03BD0001,
+    0x000016C9, 0x03BD402F, 0x03BD8003, 0x00001730, 0x03BDC012, 0x03BE0013,
+    0x00000F77, 0x00001730, 0x03BE4024, 0x00000FC2, 0x00002407, 0x03BE8009,
+    0x000016CC, 0x0000103B, 0x000006C4, 0x00000105, 0x00001707, 0x03BEC00C,
+    0x03BF000E, 0x000000D2, 0x03BF56D3, 0x03BF8034, 0x00002A43, 0x03BFC00C,
+    0x0000174D, 0x03C0400E, 0x00001710, 0x03C156D3, 0x0000247B, 0x03C18005,
+    0x000017B9, 0x03C1C005, 0x0000042F, 0x000023D2, 0x03C20013, 0x00000FF5,
+    0x03C2402F, 0x00001743, 0x0000170C, 0x00001779, 0x03C28002, 0x03C30003,
+    0x03C34004, 0x03C3C007, 0x03C4000D, 0x03C4400E, 0x03C50012, 0x03C58013,
+    0x03C5C014, 0x03C697B6, 0x03C6C029, 0x000016C5, 0x00000FE9, 0x03C706C5,
+    0x03C756C9, 0x03C78FF2, 0x00000681, 0x03C7C002, 0x03C80006, 0x03C84007,
+    0x03C8C00D, 0x03C9000E, 0x03CA0010, 0x03CA8012, 0x03CBC653, 0x03CC8016,
+    0x03CD1039, 0x00002432, 0x03CD6401, 0x03CD8005, 0x00000F6F, 0x03CDC001,
+    0x03CF0002, 0x03CF4003, 0x03D0C004, 0x03D18006, 0x03D24007, 0x0000100B,
+    0x000021CC, 0x03D3000D, 0x03D4000E, 0x03D5000F, 0x00002191, 0x03D54013,
+    0x03D580D4, 0x03D60016, 0x000000FA, 0x03D64F61, 0x03D6C001, 0x03D706C5,
+    0x03D88689, 0x03D8D72F, 0x03D98005, 0x03D9C009, 0x03DA002F, 0x03DA8002,
+    0x03DAC003, 0x00001786, 0x03DB0007, 0x03DBC00D, 0x03DC000E, 0x03DC800F,
+    0x03DCC010, 0x03DD8012, 0x03DE4013, 0x03DF4014, 0x03DF8015, 0x00001796,
+    0x0000103B, 0x03E00001, 0x03E04008, 0x03E0C009, 0x0000174C, 0x00002432,
+    0x00001743, 0x000006C5, 0x03E14029, 0x03E18001, 0x03E200C5, 0x03E28008,
+    0x03E2C009, 0x000000D2, 0x03E34675, 0x000023C1, 0x03E38002, 0x03E3C003,
+    0x03E44005, 0x000016C6, 0x03E48009, 0x03E4C00D, 0x03E58F8F, 0x00001790,
+    0x03E5C013, 0x00000134, 0x03E64025, 0x00001781, 0x00001782, 0x03E6C00D,
+    0x03E7000E, 0x03E747B3, 0x00000702, 0x03E78003, 0x03E84007, 0x00000708,
+    0x03E8C009, 0x03E9000C, 0x03EA000E, 0x00001790, 0x03EA4012, 0x03EB0013,
+    0x03EBC034, 0x03EC8001, 0x03ECC029, 0x03ED8704, 0x00000687, 0x03EE400C,
+    0x03EEC68D, 0x03EF010E, 0x03F0800F, 0x03F0C012, 0x03F10713, 0x03F14014,
+    0x00001716, 0x000017BB, 0x00000F81, 0x03F24004, 0x000016C7, 0x03F2C00C,
+    0x03F3400E, 0x03F4C00F, 0x03F506D3, 0x03F5C014, 0x000006DA, 0x0000247B,
+    0x03F60021, 0x00001701, 0x03F64009, 0x0000172F, 0x03F68003, 0x00000984,
+    0x03F6C007, 0x03F70009, 0x0000178B, 0x03F7400C, 0x03F7800D, 0x03F7C00E,
+    0x03F90692, 0x03F94653, 0x03F9C014, 0x03FA0015, 0x000006B6, 0x03FA8001,
+    0x03FAC005, 0x03FB0008, 0x03FB46C9, 0x03FC800F, 0x03FD8014, 0x000006F9,
+    0x00001748, 0x00002429, 0x03FDC00C, 0x0000100D, 0x0000064E, 0x00001790,
+    0x00001735, 0x03FE4A82, 0x03FE8003, 0x03FF4007, 0x000016CB, 0x03FF800C,
+    0x0400000D, 0x040046CE, 0x04010012, 0x04025753, 0x0402C6D4, 0x040346D5,
+    0x0403C036, 0x04040001, 0x04044005, 0x04048008, 0x04054009, 0x0405C00F,
+    0x000000D2, 0x000000F5, 0x04060001, 0x040680C5, 0x0406C009, 0x0407C015,
+    0x04084037, 0x04088001, 0x0408C682, 0x04090683, 0x00000704, 0x04094007,
+    0x0409C00C, 0x040A400D, 0x040AC10E, 0x0000100F, 0x040B0010, 0x00000691,
+    0x040B40D2, 0x040C4113, 0x040D4014, 0x040D9716, 0x00001717, 0x0000073B,
+    0x040DC001, 0x040E0005, 0x040EC008, 0x040F0009, 0x040FC00C, 0x0410000F,
+    0x04104013, 0x041080D5, 0x000006F9, 0x0410D6C1, 0x000016E5, 0x04111601,
+    0x04118002, 0x04121704, 0x04124005, 0x04128006, 0x0412C007, 0x000016CB,
+    0x041300CD, 0x041340CE, 0x0000170F, 0x0413C013, 0x041446F4, 0x04154005,
+    0x0415C009, 0x000000EC, 0x041616E5, 0x000016C5, 0x04164029, 0x0416C002,
+    0x04170003, 0x00002084, 0x00001005, 0x04175787, 0x04178009, 0x0417C00C,
+    0x0418400D, 0x0419170E, 0x04199790, 0x0419C012, 0x041A0013, 0x041AC014,
+    0x041B0115, 0x041B4016, 0x041B8037, 0x000016C9, 0x041BC032, 0x000016F5,
+    0x041C0001, 0x00001703, 0x041C86C5, 0x041CC009, 0x000006CC, 0x00000F8D,
+    0x041D400F, 0x041D8010, 0x041E0034, 0x041E4001, 0x041E8005, 0x041EC689,
+    0x04200012, 0x00001713, 0x04204035, 0x00000081, 0x00001704, 0x04208005,
+    0x0420C006, 0x04210009, 0x0421974D, 0x0000138E, 0x00000FCF, 0x04220034,
+    0x000016CD, 0x000016F0, 0x00000FE1, 0x00000F44, 0x0422400C, 0x04228012,
+    0x0422C013, 0x04234034, 0x04238001, 0x04240005, 0x042440C9, 0x00000FD2,
+    0x04248035, 0x000000C5, 0x0424D6C8, 0x04250009, 0x0425800C, 0x0425C00F,
+    0x04260012, 0x0426C014, 0x04270035, 0x04278004, 0x0427C009, 0x042848CF,
+    0x04288035, 0x0000174C, 0x0428C00E, 0x00000FD2, 0x04290014, 0x00000FF6,
+    0x042946E9, 0x04298001, 0x042A00C5, 0x042AC009, 0x042B974C, 0x042BC00E,
+    0x042C0012, 0x042C4015, 0x042C8139, 0x042CC021, 0x042D0003, 0x042D4004,
+    0x042D8006, 0x000016C7, 0x042DC00C, 0x042E000E, 0x042E8013, 0x042F4034,
+    0x042F8005, 0x042FC029, 0x043000C1, 0x04308684, 0x0430C005, 0x04318006,
+    0x0431C689, 0x0434400C, 0x0434800F, 0x04350010, 0x00000694, 0x04354015,
+    0x00000696, 0x000006F9, 0x04364001, 0x04370002, 0x043786C5, 0x04384009,
+    0x0439400D, 0x0439800F, 0x043A0030, 0x043A8081, 0x043B0083, 0x043B4704,
+    0x043B8005, 0x043C0007, 0x043C4009, 0x043D400B, 0x043D800F, 0x043E0F93,
+    0x043E8014, 0x043F0015, 0x043F4036, 0x043F8004, 0x0000170B, 0x04400010,
+    0x04404012, 0x04408033, 0x000006C1, 0x0440C005, 0x04414708, 0x0441C009,
+    0x0442400F, 0x000000D2, 0x00000095, 0x000023B9, 0x0442C0C1, 0x0443C005,
+    0x0444C007, 0x04450009, 0x0446C00D, 0x0447000E, 0x0447400F, 0x0447C010,
+    0x04480012, 0x04484013, 0x0448C014, 0x04494015, 0x000000F9, 0x04498001,
+    0x0449C683, 0x044A8009, 0x0000170C, 0x000006CF, 0x044B4010, 0x044BC034,
+    0x044C4001, 0x044C8005, 0x044D5788, 0x044DC009, 0x044E802F, 0x044EC002,
+    0x044F0003, 0x044F4005, 0x0000170C, 0x044F800E, 0x000023F6, 0x04500005,
+    0x04508009, 0x0451002F, 0x04514004, 0x04518005, 0x00000089, 0x0452000E,
+    0x0000176F, 0x000000A1, 0x04524003, 0x00001744, 0x04530007, 0x04535749,
+    0x0000174C, 0x0453800E, 0x04548090, 0x0454C012, 0x0455C014, 0x000016D6,
+    0x00001039, 0x04569381, 0x00000683, 0x0456CB84, 0x04575745, 0x000016CB,
+    0x0457800C, 0x0458000E, 0x0458C00F, 0x04590012, 0x045B0694, 0x000017BB,
+    0x045B8001, 0x045BC005, 0x045C8009, 0x0000068C, 0x045DC00F, 0x00001793,
+    0x00000F94, 0x00002455, 0x00000119, 0x000017BB, 0x045E8F81, 0x045EC003,
+    0x045F5744, 0x04600005, 0x04608007, 0x0460C00C, 0x0461068E, 0x0461D20F,
+    0x04620034, 0x04628001, 0x04630009, 0x0464000F, 0x04644035, 0x00001703,
+    0x04648004, 0x0464C005, 0x00002887, 0x04654009, 0x0465800C, 0x0465C00E,
+    0x00001710, 0x04660552, 0x04664113, 0x04669754, 0x0466C035, 0x04670001,
+    0x046746C5, 0x0468802F, 0x0468C001, 0x04690005, 0x046B0009, 0x046BC02F,
+    0x000006C5, 0x00001708, 0x046D0029, 0x046D4001, 0x000006C5, 0x000006C8,
+    0x046D8009, 0x046DC015, 0x00001777, 0x00000F42, 0x000016C5, 0x000016C6,
+    0x046E000C, 0x0000170D, 0x0000068E, 0x046E4012, 0x00002453, 0x046E86B4,
+    0x046F4001, 0x046F8025, 0x04704702, 0x04708003, 0x04710006, 0x000006C9,
+    0x0471800C, 0x0471C00D, 0x0472400E, 0x04734010, 0x0473C012, 0x000006D3,
+    0x04748014, 0x0474C015, 0x04750016, 0x0475803A, 0x0475C001, 0x04764649,
+    0x0000172F, 0x0476C6C5, 0x04770008, 0x04778009, 0x04780035, 0x04784001,
+    0x047886A9, 0x04794001, 0x047A8002, 0x047AC003, 0x047B4B84, 0x047BC006,
+    0x047CC007, 0x047D0009, 0x047D400C, 0x047DC00E, 0x0000008F, 0x047E0010,
+    0x047EC292, 0x047F8013, 0x04808014, 0x04814655, 0x04818656, 0x04828017,
+    0x0000073B, 0x000016D5, 0x00001779, 0x0482C005, 0x04834009, 0x000000CC,
+    0x0484400F, 0x00000FF5, 0x04848001, 0x000017BB, 0x0484CF81, 0x04855742,
+    0x04858003, 0x04868004, 0x0486C005, 0x04878007, 0x0488000C, 0x0488400D,
+    0x0489400E, 0x0000008F, 0x048A4010, 0x00001751, 0x048AC6D3, 0x048BC014,
+    0x048CC036, 0x048D4005, 0x048D802C, 0x048E16C5, 0x048E4009, 0x0000136F,
+    0x048EC001, 0x048F06C5, 0x048F8009, 0x00001779, 0x04904001, 0x04908005,
+    0x04918009, 0x049296CF, 0x00000FF5, 0x0492C002, 0x049306C3, 0x00001705,
+    0x04934006, 0x0493C64B, 0x0494000C, 0x0494400D, 0x0495000E, 0x0496000F,
+    0x04968010, 0x04970012, 0x04978013, 0x04980014, 0x04988016, 0x000023B8,
+    0x04990005, 0x00002108, 0x049A0009, 0x00000FEF, 0x049A4005, 0x049B4009,
+    0x049BC00F, 0x049C4039, 0x049C80C1, 0x00001703, 0x049CC6C5, 0x049DC0C8,
+    0x049E00C9, 0x049E400F, 0x000000D0, 0x00002437, 0x049E8001, 0x049F0005,
+    0x049FC0C9, 0x04A18012, 0x04A20033, 0x00000F81, 0x04A24005, 0x04A2C007,
+    0x04A30009, 0x04A3400D, 0x04A3868E, 0x04A40013, 0x04A44034, 0x04A49705,
+    0x04A5C009, 0x00000FEF, 0x00001703, 0x04A6400E, 0x00000FB4, 0x00000A02,
+    0x04A68003, 0x00002449, 0x04A7400C, 0x04A8400E, 0x000000D0, 0x04A8C014,
+    0x000016D5, 0x04A98016, 0x00002477, 0x04A9C001, 0x04AA8005, 0x04AB4648,
+    0x04AB8009, 0x04AC000C, 0x04AC800F, 0x000000F5, 0x04AD5701, 0x04ADC003,
+    0x04AE6184, 0x04AEC687, 0x00002449, 0x04AF000C, 0x04AFC00D, 0x04B0400E,
+    0x04B20010, 0x04B24012, 0x04B34513, 0x04B3C015, 0x04B42456, 0x04B44017,
+    0x00002458, 0x000017BB, 0x04B48005, 0x04B50009, 0x04B616CF, 0x00001797,
+    0x0000073B, 0x00000082, 0x04B6C003, 0x04B70004, 0x04B78007, 0x04B7C00C,
+    0x04B84A0E, 0x04B9010F, 0x04B94692, 0x00000113, 0x04B98014, 0x00002455,
+    0x00000116, 0x0000247A, 0x04B9D785, 0x04BA0029, 0x04BA4001, 0x000006C5,
+    0x04BA8029, 0x04BACFC1, 0x04BB4005, 0x04BBC009, 0x04BC002F, 0x04BC4003,
+    0x04BC8006, 0x04BCC00C, 0x0000100D, 0x04BDC00E, 0x04BE9750, 0x04BEC012,
+    0x04BF57B6, 0x04BF8701, 0x04C00005, 0x04C0C008, 0x04C14009, 0x04C2000C,
+    0x04C2402F, 0x04C30035, 0x04C340C1, 0x00000DC3, 0x04C38005, 0x04C480C9,
+    0x04C5174C, 0x0000174E, 0x04C54010, 0x00000694, 0x04C58015, 0x000023F7,
+    0x04C5C001, 0x04C74005, 0x04C80008, 0x04C84689, 0x04CA000C, 0x04CA400F,
+    0x04CB9712, 0x00001A97, 0x000006D9, 0x0000073B, 0x04CC4001, 0x00001EC2,
+    0x00000BC7, 0x04CC8009, 0x0000174C, 0x04CD068D, 0x0000068E, 0x000006B2,
+    0x000017AF, 0x00001783, 0x0000100C, 0x04CD400E, 0x04CD8032, 0x04CDC702,
+    0x04CE4003, 0x04CE8004, 0x00001886, 0x04CEC009, 0x04CF068C, 0x04D0800D,
+    0x04D0C00E, 0x04D14010, 0x04D1C012, 0x04D2C013, 0x04D34014, 0x04D3C015,
+    0x000016D6, 0x00000717, 0x04D40018, 0x0000103B, 0x04D45768, 0x04D48001,
+    0x04D50003, 0x04D58A04, 0x00000105, 0x04D5D6C7, 0x04D6400C, 0x04D7000D,
+    0x04D7400E, 0x0000010F, 0x04D89710, 0x04D8C012, 0x04DA0013, 0x04DA8014,
+    0x00001015, 0x00001018, 0x00001799, 0x000017BB, 0x04DAC001, 0x04DB0685,
+    0x04DBC009, 0x0000178C, 0x04DC800F, 0x00000713, 0x0000073B, 0x04DD4101,
+    0x00000882, 0x04DDC003, 0x04DE8004, 0x04DEC005, 0x04DF0646, 0x04DF4707,
+    0x04DF800C, 0x04DFC10D, 0x04E04A0E, 0x04E1010F, 0x00002451, 0x04E18013,
+    0x04E30014, 0x00001715, 0x04E34116, 0x04E3813A, 0x04E42401, 0x04E44005,
+    0x0000242F, 0x000016E5, 0x00000F82, 0x04E54003, 0x04E58004, 0x00000706,
+    0x04E5C007, 0x04E60009, 0x04E6400D, 0x04E7000E, 0x04E7C012, 0x00000653,
+    0x04E84015, 0x04E8C037, 0x04E90101, 0x04EA0005, 0x04EA8009, 0x04EB800F,
+    0x04ECC035, 0x00001743, 0x000016C8, 0x00001777, 0x04ED4005, 0x0000240F,
+    0x000016F5, 0x04ED8081, 0x04EDC002, 0x00000644, 0x00001785, 0x00001886,
+    0x00002789, 0x0000100D, 0x04EE000E, 0x04EE4010, 0x04EE8012, 0x00001033,
+    0x00001C81, 0x04EF8009, 0x000017AF, 0x00001781, 0x0000070C, 0x04EFC030,
+    0x00001725, 0x00001782, 0x000016C3, 0x04F0400E, 0x04F0C012, 0x000000D4,
+    0x000016F6, 0x04F1D705, 0x04F24509, 0x04F2802C, 0x00000FC1, 0x04F2C009,
+    0x04F3400C, 0x00000FD2, 0x00000FD5, 0x00001779, 0x000023C4, 0x04F38005,
+    0x04F44009, 0x04F5400F, 0x04F58013, 0x00001775, 0x04F5C00E, 0x04F68032,
+    0x00001001, 0x00000FEC, 0x04F6C008, 0x04F70029, 0x04F7400C, 0x04F7970E,
+    0x04F7C012, 0x04F80014, 0x04F84F76, 0x04F880C1, 0x04F90003, 0x04F94004,
+    0x04F99705, 0x04F9C007, 0x04FA0689, 0x04FAC00C, 0x00001A8D, 0x0000050F,
+    0x04FB5793, 0x04FB8014, 0x04FC4FD5, 0x000023F6, 0x04FC8001, 0x04FCC002,
+    0x04FD40C9, 0x04FD800F, 0x000006B0, 0x04FDC001, 0x04FE06C5, 0x04FE40C9,
+    0x04FF5593, 0x04FF8014, 0x000016D5, 0x000023D9, 0x000023FA, 0x05000012,
+    0x00002413, 0x000000F5, 0x050040C5, 0x05008009, 0x00000FCC, 0x05010F90,
+    0x05014034, 0x0501C0C1, 0x05028002, 0x000016C3, 0x00000084, 0x0502C005,
+    0x05030006, 0x05038009, 0x0504C68C, 0x0505000E, 0x0505400F, 0x05058010,
+    0x05060013, 0x05064014, 0x00000FF5, 0x05070001, 0x0507C643, 0x05080005,
+    0x05084009, 0x0508C00C, 0x00000090, 0x05090013, 0x05094014, 0x0509C6F5,
+    0x050A0001, 0x050A8005, 0x050B5D49, 0x00001C4C, 0x050C800F, 0x000016F3,
+    0x0000172D, 0x00000F75, 0x00001725, 0x00000AC2, 0x050DC003, 0x050E56C7,
+    0x050E800C, 0x050F400D, 0x050F800E, 0x050FC010, 0x05100012, 0x00001014,
+    0x0000247B, 0x00001784, 0x00000F47, 0x0510400C, 0x0511400E, 0x0511C012,
+    0x05135E13, 0x0513C014, 0x000017BB, 0x05144001, 0x0514C004, 0x00000FC6,
+    0x05154007, 0x000016CB, 0x0515870C, 0x0515C0CE, 0x0516C00F, 0x00001710,
+    0x05178012, 0x0517C013, 0x05188014, 0x00001036, 0x000016C9, 0x0000100B,
+    0x0519400C, 0x051A400D, 0x051A8012, 0x051B4014, 0x0000247B, 0x051BC002,
+    0x00000703, 0x051C0007, 0x051C8009, 0x051CC00C, 0x000016CD, 0x051D0012,
+    0x051D4013, 0x051D8014, 0x051DC036, 0x051E0001, 0x051E8004, 0x051EC005,
+    0x051F400C, 0x000000D2, 0x051F8013, 0x00000FF6, 0x000016E9, 0x051FC64C,
+    0x0520000E, 0x000016D2, 0x05208013, 0x0520C014, 0x000023BA, 0x05210005,
+    0x05214029, 0x0000176F, 0x0000004D, 0x05218036, 0x000016C1, 0x0521D6E9,
+    0x00000FC8, 0x0000170C, 0x05220010, 0x00002AF4, 0x05224003, 0x05228007,
+    0x00000F4D, 0x00001750, 0x000023B3, 0x0522C003, 0x000006C4, 0x05230032,
+    0x05238649, 0x000016F5, 0x000023C1, 0x000023C3, 0x0523C004, 0x0524002D,
+    0x00001762, 0x05248001, 0x0524C025, 0x00000FE9, 0x00000FA1, 0x00002403,
+    0x00001152, 0x00002434, 0x052546C5, 0x05258FC8, 0x0525C02F, 0x00002405,
+    0x052640D2, 0x000016D3, 0x00001734, 0x00002429, 0x00000FC1, 0x0526800C,
+    0x00000FCF, 0x00002435, 0x0526C002, 0x000016C5, 0x05270030, 0x05274003,
+    0x000023C4, 0x000023C7, 0x05278009, 0x00002478, 0x000023C4, 0x00002247,
+    0x000016CD, 0x0527C00E, 0x00001773, 0x05284005, 0x00000F89, 0x0528CFCF,
+    0x05290014, 0x00002435, 0x05294001, 0x05298009, 0x00000FCF, 0x00001732,
+    0x00001703, 0x00001445, 0x0529C009, 0x0000174F, 0x000016D3, 0x052A8094,
+    0x052AC035, 0x052B0008, 0x052B4029, 0x00002A02, 0x00000672, 0x0000170E,
+    0x00001710, 0x052B80D2, 0x000016F4, 0x0000174C, 0x00001773, 0x0000170D,
+    0x052BC02F, 0x000016E5, 0x00001779, 0x052C0003, 0x052C4004, 0x052C8006,
+    0x052CC00C, 0x052D000D, 0x052D400E, 0x052E4012, 0x052EC013, 0x052FC014,
+    0x05300015, 0x05304016, 0x05308037, 0x0530C001, 0x05318005, 0x05320012,
+    0x05324035, 0x05328001, 0x0533C005, 0x053416C8, 0x05344649, 0x0534802F,
+    0x05350005, 0x05360009, 0x0536400F, 0x05368035, 0x05370001, 0x000016C2,
+    0x05378005, 0x00000647, 0x0537C00C, 0x0538400E, 0x05390011, 0x05394012,
+    0x00000F53, 0x00000F55, 0x05398039, 0x0539C005, 0x053A002F, 0x00000641,
+    0x053A4645, 0x053AC009, 0x053B402F, 0x053B8001, 0x053BC645, 0x053C8009,
+    0x053D002F, 0x053D8004, 0x053E000D, 0x053E804E, 0x053F8012, 0x053FC033,
+    0x05400035, 0x05404001, 0x05410645, 0x05420029, 0x05430001, 0x05440645,
+    0x05448009, 0x0544C00F, 0x05454035, 0x05458029, 0x0545C644, 0x05460006,
+    0x05464012, 0x05474F53, 0x05478014, 0x0547C035, 0x05480005, 0x05488009,
+    0x05494032, 0x05498001, 0x054A4005, 0x054B0009, 0x054B800F, 0x054C4035,
+    0x054C8003, 0x054CC005, 0x00000648, 0x054D8649, 0x054DD6D4, 0x00000679,
+    0x000016C1, 0x054E16C5, 0x00000648, 0x054E4649, 0x054F000F, 0x054FC032,
+    0x0550000E, 0x00000F50, 0x0551C012, 0x05520033, 0x05524025, 0x0552C029,
+    0x000016E5, 0x0000244C, 0x0000246E, 0x05530032, 0x000023C1, 0x05534034,
+    0x05538021, 0x0553C02C, 0x0554002F, 0x00000FEC, 0x055457B2, 0x0554C00F,
+    0x000000F2, 0x05550025, 0x00001005, 0x000000CE, 0x0000102F, 0x0555402F,
+    0x05558029, 0x00000FCC, 0x0000176D, 0x0555C029, 0x05560032, 0x00001001,
+    0x05564003, 0x05568005, 0x0000100F, 0x00001014, 0x00002475, 0x00001765,
+    0x00000FF7, 0x0556C021, 0x00001775, 0x00001003, 0x0000242D, 0x05570029,
+    0x00001782, 0x0000172E, 0x0557400C, 0x0000170F, 0x000017F5, 0x00001047,
+    0x0557802E, 0x0557C005, 0x0000242C, 0x0000103B, 0x00002439, 0x05580009,
+    0x000023EF, 0x05584025, 0x000000EE, 0x00002402, 0x00000FC4, 0x000017B2,
+    0x000017E9, 0x0558800E, 0x0000292F, 0x05590001, 0x00001725, 0x05594005,
+    0x05598029, 0x0559C027, 0x055A17D3, 0x00002494, 0x0000105A, 0x000017BB,
+    0x00002402, 0x00000FC7, 0x055A4012, 0x055A8013, 0x055AC034, 0x055B4032,
+    0x00000FC3, 0x00002406, 0x055B800C, 0x055BC0EE, 0x0000244E, 0x055C0032,
+    0x055C4025, 0x055C8007, 0x055CC00C, 0x055D1012, 0x055D8034, 0x055DC005,
+    0x055E0009, 0x000000CC, 0x055E402F, 0x00002445, 0x0000100E, 0x055E8013,
+    0x00001035, 0x055EC009, 0x000000EC, 0x00001C83, 0x055F0005, 0x000014C6,
+    0x055F400D, 0x055FC00E, 0x00000FCF, 0x00001010, 0x05600013, 0x00000FD4,
+    0x00001035, 0x0560402C, 0x05608029, 0x0560E434, 0x000006C1, 0x05610003,
+    0x0000174E, 0x056146D0, 0x00001754, 0x05618035, 0x0561C001, 0x05620009,
+    0x000017CF, 0x000006D2, 0x00001777, 0x00000FC1, 0x00000FCC, 0x00002472,
+    0x000016D2, 0x00002434, 0x05624032, 0x05628005, 0x000017E9, 0x0562C00C,
+    0x00000FCE, 0x05630034, 0x00002383, 0x0563800C, 0x0563C012, 0x05640033,
+    0x05644025, 0x000023A5, 0x05648003, 0x0564C004, 0x00000FCC, 0x0565400D,
+    0x0565800E, 0x00000F90, 0x0565D754, 0x00002455, 0x00002856, 0x000016F7,
+    0x05660021, 0x05664028, 0x05668009, 0x00001772, 0x0566C001, 0x00001005,
+    0x0567000E, 0x05674033, 0x00001749, 0x0000176C, 0x05678001, 0x05680005,
+    0x0000174D, 0x0568400E, 0x00000FCF, 0x000006FA, 0x000006E9, 0x00002BC4,
+    0x0568800E, 0x0000102F, 0x000016E5, 0x00001741, 0x000006E8, 0x00001742,
+    0x0568C02E, 0x000016E9, 0x05690001, 0x00001002, 0x00001003, 0x00002CF4,
+    0x00000FA9, 0x000017A3, 0x00002428, 0x00001768, 0x05694005, 0x000000F2,
+    0x05698032, 0x0569C002, 0x00002403, 0x056A000C, 0x00002430, 0x056A63C3,
+    0x056A8007, 0x056AC00E, 0x056B0012, 0x056B8013, 0x00002436, 0x056BC005,
+    0x056C576F, 0x00002441, 0x00002BC2, 0x000000C3, 0x00000FC6, 0x056C800F,
+    0x056CC014, 0x000017FB, 0x00001787, 0x056D070D, 0x00001790, 0x000017B3,
+    0x056D402F, 0x0000176B, 0x056D8001, 0x00002405, 0x00001768, 0x00002401,
+    0x00002405, 0x00000FCC, 0x056DC032, 0x00000F48, 0x00000FF5, 0x000023E4,
+    0x056E0029, 0x056E4005, 0x000000E8, 0x00000FC7, 0x0000246E, 0x056E800E,
+    0x056EC032, 0x056F8005, 0x00000FE7, 0x00002403, 0x00000132, 0x00001079,
+    0x00001779, 0x00001743, 0x00001764, 0x0000242C, 0x056FC025, 0x000023E9,
+    0x05700027, 0x00001765, 0x000000A1, 0x05704004, 0x00001705, 0x00000FA9,
+    0x05708002, 0x0570C029, 0x05710033, 0x00001032, 0x0571402E, 0x000016CB,
+    0x00000F74, 0x00000FC1, 0x00000FC5, 0x00000FE9, 0x00000FC9, 0x00002435,
+    0x000000C9, 0x00000FEF, 0x05718009, 0x00002435, 0x00000FD0, 0x0571C034,
+    0x05720009, 0x00002412, 0x00000FF7, 0x0000242F, 0x0000240E, 0x00001772,
+    0x05724029, 0x05728001, 0x00001704, 0x0572C025, 0x05730007, 0x00002435,
+    0x05734009, 0x00000FD2, 0x05738015, 0x0000247A, 0x0573C034, 0x000016CE,
+    0x05740013, 0x000017BB, 0x00001033, 0x0574402E, 0x000023E7, 0x00000FA9,
+    0x05748029, 0x0574C022, 0x05751721, 0x00001CC1, 0x000023C4, 0x00002485,
+    0x00002489, 0x000024BB, 0x00002441, 0x00002388, 0x0000176F, 0x0575402E,
+    0x000017F4, 0x05758034, 0x000016F2, 0x0575C026, 0x00001761, 0x00000FE9,
+    0x000016E9, 0x05760034, 0x00000FE5, 0x05764009, 0x05768013, 0x000024B4,
+    0x000017C1, 0x0576C009, 0x0000246F, 0x05770009, 0x000000EC, 0x000016E8,
+    0x05774025, 0x05778001, 0x0577C00C, 0x000017EF, 0x000023C4, 0x00001705,
+    0x05784009, 0x05790014, 0x000016F9, 0x05794025, 0x0579802F, 0x0579C014,
+    0x000017F9, 0x00001748, 0x057A4029, 0x057A8021, 0x000023A1, 0x00001721,
+    0x057AC00D, 0x000016CE, 0x057B0035, 0x057B4005, 0x000017FB, 0x0000104C,
+    0x000024BB, 0x00001043, 0x000007C5, 0x000017C9, 0x00001074, 0x057B8021,
+    0x000017C1, 0x057BC013, 0x000023F4, 0x00002B21, 0x00001AC2, 0x057C002E,
+    0x057C4001, 0x000017C4, 0x057C800C, 0x057CC00D, 0x057D000E, 0x057D4032,
+    0x057DD98E, 0x0000248F, 0x00001054, 0x000006BA, 0x00001769, 0x00000DC2,
+    0x000023F2, 0x000017F2, 0x057E4029, 0x00001741, 0x00001069, 0x057E9781,
+    0x057EC005, 0x057F0107, 0x000024AF, 0x000016EE, 0x000017C5, 0x00000FC8,
+    0x057F4029, 0x057F8034, 0x05800029, 0x058057F2, 0x0000172D, 0x000017C3,
+    0x000016ED, 0x00002427, 0x00001772, 0x0580C02E, 0x000023C9, 0x058124AF,
+    0x05814025, 0x00001701, 0x00001785, 0x00000F87, 0x000023F4, 0x00000FC1,
+    0x05818009, 0x0000176C, 0x000017C2, 0x0581C02F, 0x00001725, 0x000016E5,
+    0x000023E1, 0x000023C5, 0x00002429, 0x05820013, 0x05824034, 0x0582C001,
+    0x00002484, 0x05830014, 0x00001736, 0x000023C6, 0x0000178E, 0x000016D3,
+    0x05834034, 0x05838010, 0x05840033, 0x00001724, 0x00001702, 0x0584402E,
+    0x00001032, 0x0584C003, 0x0585002D, 0x00001732, 0x05854034, 0x00002489,
+    0x05858034, 0x000006C1, 0x00001005, 0x00001769, 0x00000FC9, 0x00002439,
+    0x05860001, 0x05864029, 0x05868033, 0x0586C009, 0x000017F2, 0x000016E8,
+    0x00000FA7, 0x00002384, 0x0000238B, 0x000017F9, 0x05874009, 0x000017EF,
+    0x000023E5, 0x000023A6, 0x05878009, 0x0587C02F, 0x05880001, 0x05884009,
+    0x0588802F, 0x000017FB, 0x00002426, 0x0588C009, 0x0000242F, 0x05894009,
+    0x0589C00F, 0x000024BB, 0x058A4001, 0x00000FCF, 0x058A8014, 0x00000FF5,
+    0x00000FC1, 0x000016C9, 0x000006F5, 0x00001788, 0x0000248D, 0x058AC00E,
+    0x000023F3, 0x000000C3, 0x00000DCF, 0x058B0014, 0x00001755, 0x0000073B,
+    0x000006EF, 0x058B8029, 0x000013B4, 0x000023E2, 0x058BC001, 0x00001785,
+    0x00001074, 0x000027EE, 0x00000FE5, 0x058C0021, 0x00000141, 0x058C4005,
+    0x058CA4A9, 0x000023E7, 0x0000176C, 0x000000C5, 0x058CC034, 0x00002489,
+    0x00001AB4, 0x00000729, 0x00001044, 0x058D0013, 0x0000107B, 0x00002425,
+    0x00001741, 0x000016C9, 0x058D802F, 0x058DC029, 0x058E0001, 0x000016E9,
+    0x00000FA4, 0x00001730, 0x000022F4, 0x058E4007, 0x000017E9, 0x058E8001,
+    0x000024AE, 0x00001702, 0x000016EC, 0x00001710, 0x000017F7, 0x058EC030,
+    0x00000101, 0x058F0005, 0x058F4034, 0x0000242C, 0x00001025, 0x058FC022,
+    0x00001765, 0x00001745, 0x000023F0, 0x00001034, 0x05900029, 0x05905765,
+    0x05908005, 0x0590C02F, 0x05910025, 0x00002464, 0x00000F81, 0x00001703,
+    0x05914005, 0x05918009, 0x000023CB, 0x059206B4, 0x00002410, 0x00001013,
+    0x00000F74, 0x05924005, 0x05928008, 0x0592C009, 0x00001F75, 0x05930005,
+    0x000023C9, 0x000023EF, 0x0593400C, 0x000017AE, 0x000017B4, 0x00001784,
+    0x0593C02E, 0x000023A1, 0x05940033, 0x00001782, 0x05944006, 0x00000FCD,
+    0x0594D734, 0x05950001, 0x05954035, 0x0000070C, 0x0595800D, 0x0596000E,
+    0x05964732, 0x0596C025, 0x05970001, 0x00001765, 0x059757AC, 0x00001C92,
+    0x00001733, 0x00001001, 0x00000FC2, 0x05978003, 0x00000FCD, 0x000000D4,
+    0x000023FA, 0x0000178C, 0x0000066E, 0x000017A9, 0x0597D7AC, 0x00000FA9,
+    0x00000F89, 0x00001779, 0x00001761, 0x000016F4, 0x00001779, 0x05980032,
+    0x05985783, 0x000016CC, 0x0598800E, 0x00001074, 0x05990032, 0x05994033,
+    0x000017EC, 0x000016F2, 0x00002402, 0x00001743, 0x0599800E, 0x000026F4,
+    0x00001793, 0x000017BB, 0x000000CC, 0x00002472, 0x000016F2, 0x0000242C,
+    0x00001022, 0x00001006, 0x00000107, 0x0599C033, 0x00001724, 0x00000F85,
+    0x00000FC8, 0x00002479, 0x059A17A4, 0x0000172E, 0x00001761, 0x00001783,
+    0x059A400E, 0x059A8014, 0x00001797, 0x059AC018, 0x000017BB, 0x00001001,
+    0x059B0002, 0x00002483, 0x00001784, 0x059B4007, 0x0000244E, 0x00001C92,
+    0x00000133, 0x059B8002, 0x059BC003, 0x059C4005, 0x059C8007, 0x0000244D,
+    0x059CC00E, 0x0000100F, 0x059D0713, 0x00001136, 0x059D57C1, 0x000016EF,
+    0x00002443, 0x00002407, 0x059D8030, 0x000006E8, 0x00001761, 0x00002444,
+    0x00002427, 0x00001783, 0x00001787, 0x059DE46E, 0x0000070C, 0x000017B4,
+    0x059E0003, 0x00001705, 0x059E4007, 0x059E820E, 0x059F1793, 0x00000FFA,
+    0x059F8029, 0x00001707, 0x059FC02E, 0x00000FE9, 0x05A0178C, 0x00000FAE,
+    0x05A0400D, 0x05A0802E, 0x05A0C028, 0x05A10029, 0x00002441, 0x00002445,
+    0x00000FCD, 0x05A14012, 0x05A18013, 0x05A20014, 0x00001037, 0x05A24003,
+    0x00002445, 0x0000244C, 0x0000100F, 0x05A28013, 0x00000FD4, 0x00002455,
+    0x000024BA, 0x00001707, 0x00001793, 0x00000FF6, 0x00001777, 0x05A2C001,
+    0x05A30028, 0x00000FC1, 0x00002426, 0x0000103B, 0x05A34021, 0x00000FC5,
+    0x05A3802F, 0x0000176F, 0x00002474, 0x00001009, 0x05A3C02E, 0x0000244C,
+    0x05A4000E, 0x05A44034, 0x000016E5, 0x000017A9, 0x05A48005, 0x05A5502F,
+    0x00001768, 0x05A58029, 0x05A5D7B4, 0x05A60029, 0x00001702, 0x05A6800E,
+    0x00000FD2, 0x05A6C034, 0x0000176C, 0x05A70FE8, 0x05A74001, 0x05A78003,
+    0x05A7C009, 0x05A8000C, 0x05A8400D, 0x05A8800E, 0x00001711, 0x05A98013,
+    0x000016D4, 0x0000077B, 0x00000181, 0x05AA0003, 0x05AA4005, 0x05AAC00E,
+    0x0000010F, 0x000017D4, 0x00001755, 0x05AB1736, 0x05AB4009, 0x00000FEF,
+    0x00002402, 0x00002443, 0x00001712, 0x000000F5, 0x05AC0025, 0x05AC4005,
+    0x000017CC, 0x00000FF7, 0x00001734, 0x05AC8021, 0x05ACC027, 0x05AD0701,
+    0x00001012, 0x00002435, 0x05AD4703, 0x05AD800E, 0x05ADC032, 0x00001001,
+    0x05AE4025, 0x00000703, 0x05AE8704, 0x05AEC007, 0x00000E0D, 0x0000214E,
+    0x05AF0013, 0x00001735, 0x05AF4029, 0x00001769, 0x05AF870C, 0x05AFC72E,
+    0x05B00005, 0x05B04009, 0x05B08032, 0x05B0C029, 0x05B10001, 0x05B14009,
+    0x05B1DA4F, 0x05B20772, 0x05B28732, 0x00001722, 0x05B2C00E, 0x0000102F,
+    0x05B3002F, 0x000000C3, 0x05B34004, 0x05B396CE, 0x00002452, 0x05B3C034,
+    0x05B4002E, 0x00001001, 0x00001005, 0x05B44009, 0x05B4C02F, 0x00000FE1,
+    0x0000242D, 0x00000FEF, 0x000016C5, 0x05B54009, 0x00002432, 0x00000D90,
+    0x05B58733, 0x00002441, 0x05B5C00C, 0x05B6400E, 0x05B6C0F2, 0x00000FC4,
+    0x0000170C, 0x0000178E, 0x00001736, 0x00002463, 0x000017A7, 0x00002465,
+    0x0000238C, 0x05B7000E, 0x00001034, 0x000024BB, 0x00000FCC, 0x00000FB2,
+    0x00001765, 0x000016EE, 0x05B7402C, 0x00001B81, 0x05B78029, 0x05B7C034,
+    0x00000FC1, 0x05B80008, 0x000017EF, 0x05B8402C, 0x000016D3, 0x05B88034,
+    0x000017C1, 0x000024B4, 0x00000FE9, 0x0000176F, 0x05B8C6A4, 0x000024B2,
+    0x000017B3, 0x00001785, 0x05B9000E, 0x00000E33, 0x000017B9, 0x05B94001,
+    0x05BA0005, 0x05BA9709, 0x000017D3, 0x00000FD5, 0x00000CBB, 0x05BB0025,
+    0x05BB4028, 0x000023C9, 0x05BB800C, 0x000017F9, 0x00002481, 0x00000D84,
+    0x000006C5, 0x00000247, 0x0000172E, 0x05BBC034, 0x05BC0033, 0x000016EE,
+    0x05BC4032, 0x05BC8004, 0x00001734, 0x05BCC001, 0x05BD4005, 0x00001709,
+    0x05BD8034, 0x00001734, 0x00002441, 0x05BDC033, 0x000016EC, 0x000023AC,
+    0x0000242C, 0x05BE0029, 0x00002425, 0x00000FE9, 0x000016C9, 0x00001733,
+    0x000017E1, 0x00001049, 0x00000FCF, 0x000024BB, 0x05BE4005, 0x0000246F,
+    0x05BE8009, 0x000017EF, 0x00002AAE, 0x000016F3, 0x00000F48, 0x05BF0029,
+    0x000016FA, 0x05BF4009, 0x000017F9, 0x05C00001, 0x05C04009, 0x000017CF,
+    0x000017F9, 0x00000FED, 0x000017B9, 0x000024A9, 0x00002388, 0x000017CF,
+    0x00001779, 0x00001032, 0x000023B5, 0x00000FEE, 0x05C08035, 0x0000176F,
+    0x000023F2, 0x05C0C009, 0x000017AF, 0x0000238E, 0x05C10033, 0x05C14025,
+    0x05C18007, 0x00002B53, 0x0000167B, 0x0000172C, 0x0000102C, 0x05C1C004,
+    0x000024B3, 0x00001702, 0x00001027, 0x00000FB2, 0x000017BB, 0x05C20034,
+    0x0000070E, 0x000017AF, 0x000017AE, 0x00000FF3, 0x000020C1, 0x05C24004,
+    0x00000FE9, 0x05C28009, 0x05C2C02F, 0x000024BB, 0x05C30004, 0x00001789,
+    0x0000064E, 0x05C34010, 0x000017F9, 0x0000170E, 0x05C38033, 0x000017F4,
+    0x000016E6, 0x00002465, 0x05C3C032, 0x00002734, 0x00002421, 0x000013AC,
+    0x000016E8, 0x0000170D, 0x00001734, 0x00002475, 0x05C40FE1, 0x05C44003,
+    0x05C4C004, 0x05C51707, 0x05C58009, 0x0000170B, 0x05C5C034, 0x00000F8C,
+    0x000023F4, 0x05C60001, 0x05C68684, 0x05C6C00C, 0x05C70010, 0x05C74034,
+    0x000023F3, 0x000016EE, 0x00000FA1, 0x00000144, 0x00001072, 0x05C78021,
+    0x000028EF, 0x000015C9, 0x05C8000C, 0x0000246F, 0x00001730, 0x05C896E1,
+    0x000023F2, 0x05C8D781, 0x05C90002, 0x05C94005, 0x0000100E, 0x05C9800F,
+    0x00001039, 0x00000DF0, 0x05C9C025, 0x0000242E, 0x0000176F, 0x000023A8,
+    0x05CA0025, 0x000017A1, 0x05CA402E, 0x0000170C, 0x00000FCF, 0x00001710,
+    0x00001732, 0x05CA8005, 0x00001733, 0x05CAC028, 0x000016EE, 0x05CB0032,
+    0x000016F4, 0x05CB4009, 0x00002473, 0x000016E5, 0x05CB8001, 0x000011A5,
+    0x00001741, 0x00000F65, 0x00001701, 0x00002439, 0x00001044, 0x000016EE,
+    0x05CBC001, 0x05CC0009, 0x05CC4014, 0x00002435, 0x05CC9705, 0x000000B0,
+    0x05CCC173, 0x05CD0025, 0x000023A5, 0x05CD400E, 0x05CD8030, 0x000017B2,
+    0x000000CE, 0x00002433, 0x05CDC029, 0x05CE000B, 0x00001734, 0x000015B4,
+    0x05CE4032, 0x00000FC5, 0x00000FE8, 0x05CE8025, 0x000017C3, 0x00000F89,
+    0x000018F4, 0x00002425, 0x000016F3, 0x05CEC009, 0x05CF0012, 0x000017B5,
+    0x05CF4032, 0x00002401, 0x00000FCE, 0x05CFC034, 0x00000FE9, 0x00000E29,
+    0x0000246E, 0x000017CD, 0x00002490, 0x05D057D2, 0x00002393, 0x000017B9,
+    0x000016F5, 0x000017EF, 0x00002444, 0x05D0C00E, 0x05D10730, 0x000017B9,
+    0x00000E23, 0x00002481, 0x000017B9, 0x00001745, 0x05D14675, 0x05D1800C,
+    0x0000174D, 0x0000240F, 0x00001032, 0x00001789, 0x05D1C02E, 0x05D20001,
+    0x00001733, 0x05D24001, 0x00002445, 0x05D2CFCF, 0x000000D4, 0x00002435,
+    0x00001025, 0x0000178D, 0x00000FF7, 0x0000242F, 0x00001725, 0x00002961,
+    0x00000F64, 0x00002A81, 0x00001705, 0x0000244E, 0x05D30034, 0x0000013B,
+    0x00001003, 0x00000134, 0x05D34032, 0x05D38005, 0x00001772, 0x05D3C003,
+    0x00001025, 0x000023E2, 0x05D40032, 0x05D44034, 0x00001002, 0x00000FCC,
+    0x00000FCE, 0x00000FF4, 0x00000FD2, 0x00002434, 0x00002465, 0x000023C9,
+    0x000000F2, 0x000015C2, 0x05D48004, 0x00000E0D, 0x05D4C032, 0x00001007,
+    0x000000D2, 0x000016F6, 0x00000FC1, 0x000006C2, 0x00000FCF, 0x05D50013,
+    0x00000754, 0x000006FA, 0x05D54021, 0x00000FF1, 0x00001779, 0x00002432,
+    0x05D59787, 0x05D5C032, 0x05D6000E, 0x000017F4, 0x05D64004, 0x05D6800C,
+    0x05D6C00E, 0x000017F4, 0x00001769, 0x0000102E, 0x05D7002C, 0x00001F55,
+    0x000017F6, 0x05D74025, 0x05D7C02C, 0x00001005, 0x05D80012, 0x05D84033,
+    0x000017C1, 0x05D897C5, 0x000017C9, 0x05D8C00C, 0x000017CF, 0x000017F5,
+    0x00001781, 0x00000FCF, 0x000000D3, 0x05D90014, 0x0000247B, 0x00001B43,
+    0x00001713, 0x000017B4, 0x00000FC5, 0x05D9C035, 0x00000908, 0x0000077B,
+    0x00002473, 0x000016C5, 0x000006F2, 0x05DA0001, 0x05DA4005, 0x00000FA9,
+    0x00002428, 0x00000FA9, 0x00002408, 0x00002449, 0x0000176F, 0x000017B2,
+    0x05DA8032, 0x00001763, 0x00001B25, 0x00000FEC, 0x00001001, 0x05DAC005,
+    0x05DB0029, 0x00001702, 0x000017A3, 0x000023E5, 0x05DB8004, 0x00001786,
+    0x0000188C, 0x000017B3, 0x00002429, 0x05DBC004, 0x00001753, 0x05DC0014,
+    0x00002D3A, 0x05DC4029, 0x00001707, 0x05DC802E, 0x0000242C, 0x00002407,
+    0x00000FD2, 0x000023B3, 0x00000FE8, 0x00000FF2, 0x05DCC001, 0x05DD002F,
+    0x00000FC2, 0x00001704, 0x00002453, 0x05DD8034, 0x05DDC021, 0x000017F3,
+    0x05DE002D, 0x000006C9, 0x00001779, 0x05DE4001, 0x05DE8025, 0x05DF0001,
+    0x000000C5, 0x000000C9, 0x05DF400C, 0x05DF8032, 0x00002433, 0x05DFC002,
+    0x00001787, 0x0000190D, 0x0000100E, 0x00001014, 0x000017FB, 0x05E00012,
+    0x00001773, 0x000017C1, 0x05E09E83, 0x00000FC7, 0x05E1000C, 0x0000070D,
+    0x0000074F, 0x05E157F3, 0x00000F0D, 0x000017EE, 0x05E18001, 0x00002439,
+    0x05E1C001, 0x00002444, 0x00000FEC, 0x000017FB, 0x05E2000C, 0x05E2400E,
+    0x05E28032, 0x05E3000C, 0x0000240F, 0x000000F4, 0x05E34012, 0x00001F74,
+    0x000017F2, 0x05E3C02E, 0x00001731, 0x000023F3, 0x05E40034, 0x000024A7,
+    0x000016F3, 0x00002429, 0x000013A4, 0x05E48034, 0x00001779, 0x0000178C,
+    0x000023AF, 0x05E4C004, 0x05E50005, 0x00001707, 0x000017BB, 0x00002468,
+    0x000017F9, 0x00002473, 0x000016E8, 0x000023EE, 0x05E54009, 0x000017AF,
+    0x000016E9, 0x00001785, 0x00000FF9, 0x0000172E, 0x00000FAF, 0x05E59044,
+    0x05E5C005, 0x05E60034, 0x00001707, 0x00000FA9, 0x00001725, 0x05E64001,
+    0x05E68005, 0x05E6C029, 0x00002161, 0x000016EE, 0x05E70032, 0x00002433,
+    0x000017A9, 0x00001769, 0x000023B4, 0x00002487, 0x000024BB, 0x05E78021,
+    0x00001043, 0x05E7C005, 0x00000154, 0x000017FB, 0x00000FC8, 0x00001772,
+    0x05E80001, 0x00001705, 0x00001047, 0x00001649, 0x000017AF, 0x05E84003,
+    0x00002491, 0x05E89073, 0x00001001, 0x05E8C025, 0x000017E5, 0x00000F72,
+    0x000017B3, 0x00001747, 0x000006CD, 0x05E90012, 0x00001753, 0x05E94034,
+    0x00002429, 0x05E98009, 0x05E9C00F, 0x000017D3, 0x05EA0014, 0x00001795,
+    0x00001039, 0x00001001, 0x05EA4005, 0x00001069, 0x05EA8005, 0x00001786,
+    0x0000176C, 0x05EAC001, 0x00001048, 0x05EB0032, 0x05EB4002, 0x00000F89,
+    0x0000174F, 0x00001B70, 0x00001781, 0x05EB8585, 0x00000F89, 0x05EBC02B,
+    0x00002427, 0x00001730, 0x05EC0009, 0x0000073B, 0x05EC4025, 0x0000100C,
+    0x00001734, 0x000017B7, 0x00002441, 0x00001003, 0x00001007, 0x0000100C,
+    0x0000138E, 0x000013B4, 0x05EC87AE, 0x05ECC011, 0x05ED0015, 0x00002477,
+    0x00002474, 0x05ED402E, 0x00001784, 0x000016EE, 0x05ED8021, 0x00001769,
+    0x05EDC009, 0x0000244F, 0x00001075, 0x05EE0025, 0x00002487, 0x05EE5729,
+    0x000023A4, 0x05EE8005, 0x00000F89, 0x0000102D, 0x05EED6C1, 0x05EF0009,
+    0x05EF402F, 0x05EF8005, 0x05EFC00F, 0x00001714, 0x000024BB, 0x00001761,
+    0x05F0000E, 0x00000774, 0x000023E2, 0x00001001, 0x00002469, 0x05F0400E,
+    0x00001034, 0x000017A5, 0x00002407, 0x05F0802E, 0x000016CE, 0x05F0C032,
+    0x00000FA9, 0x05F10005, 0x000016F3, 0x05F14032, 0x00000FF2, 0x000016C8,
+    0x00000FE9, 0x00000FEE, 0x00002424, 0x00001741, 0x00002489, 0x05F1802E,
+    0x00000FB2, 0x000016D3, 0x05F20034, 0x0000244E, 0x00002674, 0x00002425,
+    0x00000FEF, 0x00002465, 0x000006C1, 0x05F24008, 0x0000176C, 0x05F28009,
+    0x000024AE, 0x000023A4, 0x000017C4, 0x05F2C009, 0x05F3400C, 0x05F38034,
+    0x05F3C029, 0x05F48009, 0x05F5000C, 0x00000FB6, 0x05F54003, 0x00001705,
+    0x000000B4, 0x00002485, 0x00000F48, 0x05F58029, 0x00002234, 0x0000244C,
+    0x05F6000E, 0x00001736, 0x05F64009, 0x00002C19, 0x000017FB, 0x05F6C00F,
+    0x00001734, 0x000004AF, 0x05F71701, 0x05F74004, 0x000017C5, 0x00001709,
+    0x05F796D3, 0x05F7D074, 0x0000242E, 0x05F80033, 0x05F84034, 0x05F89741,
+    0x000000C5, 0x05F8C008, 0x05F917B2, 0x00001701, 0x00001727, 0x05F98009,
+    0x000017AC, 0x00001701, 0x00001044, 0x05FA0005, 0x05FA4007, 0x00001714,
+    0x000017B5, 0x000016F4, 0x05FA8005, 0x000023CC, 0x05FAC034, 0x000017E8,
+    0x05FB4032, 0x000017AE, 0x05FB97F2, 0x0000176F, 0x05FBC673, 0x05FC0025,
+    0x00000FE5, 0x05FC4005, 0x05FC8007, 0x05FCC009, 0x05FD800F, 0x05FDC039,
+    0x05FE0021, 0x05FE4005, 0x00000FF0, 0x00000F68, 0x00002446, 0x00001073,
+    0x05FE8032, 0x00001034, 0x05FF0021, 0x00001701, 0x05FF4005, 0x00001C8E,
+    0x00002452, 0x00002433, 0x05FF8012, 0x05FFC013, 0x06000015, 0x000023B6,
+    0x00001772, 0x06004001, 0x0600A4B4, 0x000017B5, 0x00001741, 0x00002454,
+    0x000017FB, 0x0600C025, 0x06011749, 0x000017F4, 0x06014029, 0x06018003,
+    0x0601C009, 0x000016EB, 0x00000F83, 0x000017C5, 0x00000F89, 0x0000170C,
+    0x0000246D, 0x00001703, 0x06020034, 0x06024001, 0x0602802F, 0x0602C013,
+    0x00001074, 0x00001725, 0x000023B2, 0x06030033, 0x00001001, 0x06034005,
+    0x06038029, 0x000000CE, 0x00001774, 0x06040035, 0x00001789, 0x0000246E,
+    0x06044033, 0x00001702, 0x00002A46, 0x00000114, 0x0000103A, 0x00002443,
+    0x00001732, 0x000006E5, 0x00001032, 0x00000FB5, 0x000024AB, 0x06048001,
+    0x000024A5, 0x00001741, 0x0604C029, 0x00002409, 0x0000176F, 0x000017E5,
+    0x0000176F, 0x06050001, 0x00000705, 0x00001BC9, 0x00001732, 0x000017D0,
+    0x00000754, 0x000017D7, 0x0000077B, 0x06058029, 0x00002465, 0x000017A2,
+    0x0000100C, 0x0605C00E, 0x06060032, 0x00002421, 0x00001002, 0x000000CE,
+    0x00002474, 0x000017A1, 0x000016F6, 0x00002428, 0x000017AD, 0x00000F62,
+    0x00000FCE, 0x00001770, 0x00000FC1, 0x0000176C, 0x00002429, 0x00001772,
+    0x060686E9, 0x00002472, 0x0606C029, 0x06070005, 0x00001727, 0x06074014,
+    0x000024BB, 0x00001788, 0x06078009, 0x0607C00F, 0x00000FF2, 0x06080012,
+    0x00001034, 0x00000FEE, 0x000016F4, 0x06084001, 0x00001736, 0x0608972C,
+    0x0000246C, 0x000016E5, 0x0608C033, 0x00002AC9, 0x0609002F, 0x06094009,
+    0x0000174F, 0x00000FF9, 0x0609C001, 0x060A23E9, 0x060A402F, 0x060A8021,
+    0x000017C3, 0x00001705, 0x000023F4, 0x00002421, 0x0000106E, 0x060B0025,
+    0x00000F6C, 0x060B4025, 0x00002402, 0x060B8034, 0x00001F73, 0x00000044,
+    0x000016E7, 0x000017A3, 0x00001745, 0x00002469, 0x060BC021, 0x00001722,
+    0x060C0032, 0x00002442, 0x060C4005, 0x00000686, 0x060C800E, 0x00001730,
+    0x060D002F, 0x060D402D, 0x0000242E, 0x060D8026, 0x0000100E, 0x000012F4,
+    0x000000C5, 0x00002469, 0x00000FF2, 0x060DC025, 0x00000F64, 0x00001705,
+    0x060E0034, 0x000023E9, 0x000014C2, 0x00002472, 0x0000172C, 0x060E472E,
+    0x00000FEC, 0x060E8025, 0x00000F46, 0x000017AC, 0x060EC021, 0x000017A4,
+    0x060F0001, 0x00000F45, 0x060F8029, 0x060FC02F, 0x0610000C, 0x06104032,
+    0x06108025, 0x00000FC3, 0x00000FAF, 0x00000F72, 0x0610C023, 0x00002467,
+    0x00001761, 0x06110034, 0x00000F12, 0x06118034, 0x0612000E, 0x0000244F,
+    0x000017B2, 0x00001005, 0x00000353, 0x00000FF4, 0x00002A79, 0x06124029,
+    0x000017AF, 0x000023E9, 0x0000076E, 0x000023A2, 0x06128025, 0x0612C025,
+    0x000016E6, 0x06130025, 0x00001007, 0x06134034, 0x0000244D, 0x0613800F,
+    0x0613C034, 0x06140025, 0x0000102E, 0x00002425, 0x0000178E, 0x06144033,
+    0x000000A5, 0x00000FD2, 0x06148013, 0x00001034, 0x00001769, 0x00001001,
+    0x0614C003, 0x06150004, 0x00001386, 0x0000244C, 0x0615400E, 0x0000244F,
+    0x06158013, 0x06160014, 0x00002476, 0x06168029, 0x0616C007, 0x00001732,
+    0x0000242C, 0x00000FC2, 0x0617000D, 0x00000FCE, 0x00002473, 0x00002408,
+    0x000023CC, 0x06174034, 0x000006C5, 0x0000176C, 0x0617800E, 0x0617C012,
+    0x061817B4, 0x00001001, 0x06184003, 0x00002444, 0x0618C0EE, 0x06190025,
+    0x06194007, 0x000017AE, 0x00000FC9, 0x06198032, 0x00001743, 0x0000102E,
+    0x0619C029, 0x0000242F, 0x0000100E, 0x061A0033, 0x00001775, 0x000000C3,
+    0x0000100F, 0x000000D3, 0x00002475, 0x061A4025, 0x061A8004, 0x061AC02D,
+    0x061B0010, 0x000016F5, 0x061B4005, 0x061B95E9, 0x0000242D, 0x000023A1,
+    0x000023C5, 0x000023E9, 0x00000FA9, 0x00001024, 0x000023B4, 0x000023C4,
+    0x061BC0F2, 0x061C0001, 0x061C4025, 0x061C800E, 0x00001034, 0x0000244E,
+    0x061CC033, 0x00001F47, 0x061D000C, 0x061D400E, 0x0000247B, 0x061DA3C1,
+    0x00000FC9, 0x061DC013, 0x000016F7, 0x00001775, 0x000022C1, 0x061E4003,
+    0x0000244C, 0x000000CE, 0x0000010F, 0x061E8014, 0x00001035, 0x000006E9,
+    0x000006A5, 0x00002446, 0x061EC035, 0x00002425, 0x00001068, 0x061F1745,
+    0x000016F4, 0x061F4008, 0x00001779, 0x0000246D, 0x00000FEC, 0x00001745,
+    0x061FC00F, 0x00002472, 0x00002145, 0x06200014, 0x00001735, 0x00001741,
+    0x0000176F, 0x0620C6C1, 0x06210029, 0x000017AE, 0x0621800C, 0x0621C012,
+    0x000017B3, 0x06224005, 0x000015A9, 0x06228003, 0x00001006, 0x00001033,
+    0x000023F3, 0x00000FEC, 0x06234028, 0x00002434, 0x06238003, 0x000006A4,
+    0x0000174E, 0x0623C032, 0x00001013, 0x06248034, 0x00002B2C, 0x0624C025,
+    0x00000FCC, 0x06250033, 0x000023E9, 0x00001741, 0x00001745, 0x00001734,
+    0x06254021, 0x000016EE, 0x00001701, 0x0625C005, 0x06260014, 0x00000FF9,
+    0x00001775, 0x06264001, 0x0626C004, 0x06271045, 0x062761A9, 0x062786C5,
+    0x0627C008, 0x06284032, 0x06288032, 0x00001045, 0x0628D069, 0x00001724,
+    0x00001741, 0x06294029, 0x06298001, 0x00001783, 0x0629C034, 0x0000242E,
+    0x062A0001, 0x062AD789, 0x062B000D, 0x0000178E, 0x00000F8F, 0x062B8014,
+    0x00002415, 0x000000B6, 0x062BC005, 0x062C0029, 0x062C4032, 0x062C800E,
+    0x00001752, 0x062CC033, 0x000000C3, 0x00002485, 0x062D000E, 0x062D4013,
+    0x0000107A, 0x00001042, 0x062D800E, 0x00001732, 0x000016EE, 0x062E0009,
+    0x00001779, 0x00002441, 0x00000FC5, 0x000024A9, 0x00001043, 0x00000FEE,
+    0x062E4032, 0x00000FEF, 0x000016C4, 0x0000178F, 0x000017BB, 0x000016EE,
+    0x062E9008, 0x000006F5, 0x0000104E, 0x062EC033, 0x00000F81, 0x062F0005,
+    0x000017C7, 0x0000172E, 0x000016E9, 0x062F572D, 0x000024BB, 0x0000240D,
+    0x000013F4, 0x062F866E, 0x062FC039, 0x00001769, 0x00001779, 0x000000B3,
+    0x00001761, 0x000024AE, 0x06300032, 0x00001784, 0x0000244C, 0x0000100E,
+    0x00001012, 0x00001034, 0x06304033, 0x06308039, 0x0630C003, 0x06314005,
+    0x06318006, 0x0631C00C, 0x00000F92, 0x06320013, 0x06328014, 0x00000FB6,
+    0x00002685, 0x0632C00E, 0x06331733, 0x06334003, 0x06338006, 0x00000F8C,
+    0x0633C013, 0x000000B4, 0x000017A2, 0x00002AE2, 0x00000FAD, 0x00001732,
+    0x00000FA3, 0x00001732, 0x06342485, 0x00000FD2, 0x06344034, 0x000023F6,
+    0x00001052, 0x00001054, 0x0000077B, 0x00000FE9, 0x0634C008, 0x0000246C,
+    0x06350006, 0x00001734, 0x0000176F, 0x06354005, 0x00000729, 0x06358005,
+    0x0635C007, 0x00001789, 0x0000242F, 0x06360005, 0x06364028, 0x000023C3,
+    0x063696C5, 0x0636C029, 0x06370029, 0x00001734, 0x06374001, 0x06378025,
+    0x0637C029, 0x00001782, 0x000017A7, 0x00001706, 0x0638072E, 0x000016EE,
+    0x00001001, 0x06388025, 0x00001B42, 0x00001774, 0x00000F6D, 0x000017AC,
+    0x00001701, 0x0638C005, 0x063916EE, 0x000000CC, 0x00000FCE, 0x06394012,
+    0x00002496, 0x00001777, 0x06398032, 0x0639C00F, 0x063A4032, 0x000000C5,
+    0x063A8029, 0x063B0001, 0x063B46C5, 0x00000FC9, 0x00001779, 0x063B8029,
+    0x00002434, 0x000000C9, 0x00002435, 0x063BC034, 0x063C4009, 0x063C800F,
+    0x000000F5, 0x00001789, 0x000016CF, 0x00002435, 0x063CC010, 0x063D0013,
+    0x063D4694, 0x000017BB, 0x063DC005, 0x063E0009, 0x063E4032, 0x063E8034,
+    0x063EC001, 0x063F0005, 0x063F8009, 0x063FC02F, 0x00001768, 0x00000FD2,
+    0x00001034, 0x00001003, 0x0640170E, 0x00002453, 0x00002474, 0x0000172E,
+    0x000017EC, 0x00001702, 0x00001767, 0x00000FA1, 0x06404001, 0x00001785,
+    0x064097C9, 0x000017AF, 0x06410025, 0x0641400E, 0x000000D2, 0x00002434,
+    0x0641C001, 0x000024A9, 0x06420029, 0x06424001, 0x000023C9, 0x0000104F,
+    0x06428030, 0x0642C701, 0x00001704, 0x00001705, 0x00001727, 0x06432488,
+    0x064346EC, 0x00001703, 0x00001008, 0x00001710, 0x000017BB, 0x06438001,
+    0x0643C005, 0x06444009, 0x064486F5, 0x0644C005, 0x00000FA9, 0x00001034,
+    0x00001745, 0x06454029, 0x00000724, 0x00001787, 0x064597B3, 0x000023E3,
+    0x0000100E, 0x0645C032, 0x0646000E, 0x0000178F, 0x00001034, 0x000017B2,
+    0x0000100C, 0x00001792, 0x00002454, 0x00001039, 0x00002443, 0x00000193,
+    0x00001014, 0x00001036, 0x000017B5, 0x00000FAC, 0x00000FF2, 0x000000C5,
+    0x06464029, 0x06468025, 0x0646C025, 0x06470005, 0x00001709, 0x00001730,
+    0x06474001, 0x00001705, 0x06478009, 0x0647C034, 0x0000014D, 0x000024B4,
+    0x06480005, 0x06484029, 0x00000F89, 0x0000242F, 0x06488010, 0x00001733,
+    0x0648C008, 0x00001779, 0x00001741, 0x06490025, 0x00001781, 0x0649400E,
+    0x06498012, 0x00001034, 0x0649C02E, 0x00001703, 0x00001706, 0x0000178F,
+    0x064A0033, 0x0000170F, 0x00001736, 0x000016CE, 0x000016F3, 0x000016F3,
+    0x064A4034, 0x064A9003, 0x064AC012, 0x00000FD3, 0x000029F6, 0x00002461,
+    0x00001B62, 0x00000F6E, 0x064B0003, 0x000017A7, 0x00001002, 0x064B400E,
+    0x000023EF, 0x00002402, 0x00001704, 0x064B8005, 0x00001007, 0x064BC00C,
+    0x064C8013, 0x000017B6, 0x00001009, 0x064CC02F, 0x00001768, 0x000015CC,
+    0x00000FEE, 0x0000176C, 0x00000FEE, 0x064D0030, 0x0000238B, 0x064D4034,
+    0x00002463, 0x064D8029, 0x064DC00C, 0x0000100E, 0x064E0012, 0x064E4013,
+    0x00001039, 0x00001003, 0x00001736, 0x064E8027, 0x0000248B, 0x064EC012,
+    0x00001034, 0x064F0001, 0x0000170D, 0x0000240F, 0x00001734, 0x00001043,
+    0x064F4024, 0x00002401, 0x064F8009, 0x00000FB5, 0x064FC02F, 0x0650000E,
+    0x00001710, 0x000023B6, 0x00001784, 0x000017C9, 0x000017B3, 0x000017AF,
+    0x00001645, 0x0650402E, 0x00002385, 0x000017A9, 0x000016C6, 0x06508010,
+    0x0650C035, 0x000016D3, 0x000023F7, 0x00000C0F, 0x00001074, 0x00002145,
+    0x0000246C, 0x00000FB2, 0x000000C5, 0x00002486, 0x000024B6, 0x000017C5,
+    0x0651002F, 0x06514001, 0x000017C3, 0x00001704, 0x06518005, 0x000023C7,
+    0x0651C009, 0x06520034, 0x000014A1, 0x0000178C, 0x0000170F, 0x06528016,
+    0x00001CFB, 0x00002408, 0x000023F4, 0x0000296D, 0x0652C025, 0x00001729,
+    0x000000D2, 0x000024B6, 0x000000CE, 0x00000FCF, 0x00001050, 0x000023B6,
+    0x0653000C, 0x00000F4E, 0x065356F2, 0x00002463, 0x06538005, 0x065424A9,
+    0x0654402E, 0x00001705, 0x000017F9, 0x00000701, 0x06548005, 0x00001027,
+    0x0654E4AE, 0x000023E1, 0x06550029, 0x00001034, 0x0655402E, 0x00001034,
+    0x0655C034, 0x0656000C, 0x00000F6E, 0x000016CC, 0x0000246E, 0x06564034,
+    0x0656802C, 0x00001765, 0x00000F74, 0x0656C001, 0x00001404, 0x06570009,
+    0x000024B6, 0x000016C1, 0x00001707, 0x0000167B, 0x06574028, 0x000023C3,
+    0x000023E4, 0x00002429, 0x00002489, 0x0000172E, 0x0657C00E, 0x00000E4F,
+    0x00000772, 0x06580705, 0x000023AF, 0x000016CC, 0x0658400E, 0x000017EF,
+    0x000017B9, 0x0000178E, 0x000016D2, 0x000017F4, 0x06588021, 0x00000F73,
+    0x0000100C, 0x0658C00E, 0x06590013, 0x00002474, 0x06595785, 0x0659802C,
+    0x00001769, 0x0659C025, 0x065A0032, 0x00000707, 0x0000070C, 0x065A400D,
+    0x065A800E, 0x00001B50, 0x065AC034, 0x00001784, 0x065B0012, 0x065B86B7,
+    0x00001025, 0x00002441, 0x065BC103, 0x00001785, 0x00001006, 0x065C000E,
+    0x00002492, 0x000017BB, 0x00000125, 0x065C4003, 0x065C800D, 0x065CC00E,
+    0x00001790, 0x065D0032, 0x065D4001, 0x065E0009, 0x000017F9, 0x000000EC,
+    0x00002413, 0x00000F74, 0x00000FA9, 0x000023EF, 0x065E4029, 0x065E800C,
+    0x065EC02F, 0x000017E9, 0x0000242F, 0x065F002C, 0x00002401, 0x065F4005,
+    0x00000F89, 0x000017CB, 0x065F800C, 0x065FC02F, 0x0000242F, 0x06600004,
+    0x06604034, 0x06608005, 0x0000242C, 0x00001701, 0x000017C3, 0x000017C5,
+    0x0660C029, 0x00001705, 0x00002439, 0x06610009, 0x06614035, 0x000016EE,
+    0x06618029, 0x0661C025, 0x06620004, 0x000017F4, 0x000016C5, 0x000024B4,
+    0x00002429, 0x06624005, 0x00002429, 0x000016C9, 0x00002493, 0x0000107B,
+    0x06628861, 0x0662C001, 0x00001043, 0x00001044, 0x06630005, 0x06634174,
+    0x00002425, 0x00000F83, 0x00002604, 0x06638149, 0x0664400E, 0x000023F6,
+    0x066497D3, 0x000017FB, 0x0664C028, 0x000016EE, 0x066517C1, 0x06658009,
+    0x00001074, 0x0665C003, 0x000017CC, 0x0666402E, 0x06668004, 0x000017CF,
+    0x06670032, 0x00001742, 0x06674034, 0x000017CB, 0x0000178F, 0x00001975,
+    0x000024A9, 0x0000106E, 0x00002439, 0x000024B5, 0x0667802C, 0x000017D0,
+    0x0667C035, 0x00000701, 0x06680005, 0x00001069, 0x00002403, 0x0668402E,
+    0x00000FC1, 0x00001045, 0x0000170D, 0x0000240F, 0x00001710, 0x06688034,
+    0x00000FEC, 0x00001721, 0x00000FC1, 0x0668C025, 0x000016EE, 0x00001044,
+    0x06690013, 0x06694014, 0x0000107B, 0x06698032, 0x000017EF, 0x000006F2,
+    0x00002423, 0x000006C1, 0x00001702, 0x00000FF9, 0x0669C001, 0x000017CF,
+    0x000017F9, 0x000006C1, 0x066A4029, 0x00002492, 0x000017F4, 0x066AC021,
+    0x00000F82, 0x066B0003, 0x000016D3, 0x066BC036, 0x000023C6, 0x066C172D,
+    0x00002481, 0x066C4003, 0x0000074D, 0x00001736, 0x066D000D, 0x066D400E,
+    0x066DC010, 0x066E0013, 0x00000FB6, 0x000023C9, 0x000016F3, 0x000017B3,
+    0x00000FF2, 0x00001769, 0x066E4029, 0x00000CBB, 0x00001045, 0x066EA489,
+    0x000023CF, 0x00002439, 0x000016F3, 0x00000F45, 0x00002428, 0x00002401,
+    0x00001729, 0x066EC001, 0x00000684, 0x00000F89, 0x00000FB4, 0x0000178C,
+    0x066F1032, 0x066F402E, 0x066F8025, 0x00001702, 0x00001774, 0x00000F65,
+    0x00000FD2, 0x066FC013, 0x000016F6, 0x00000103, 0x06700005, 0x00002413,
+    0x00002474, 0x000017AE, 0x00001769, 0x00001785, 0x000016D3, 0x06708034,
+    0x0670C029, 0x06710025, 0x0000242E, 0x06714029, 0x00000127, 0x0000172D,
+    0x000016E1, 0x06718025, 0x000023C2, 0x0671C034, 0x067216E8, 0x06724025,
+    0x0000012E, 0x00001769, 0x00002441, 0x0672800E, 0x0672C033, 0x06730001,
+    0x06734029, 0x0673C025, 0x000000C9, 0x06740012, 0x000017F5, 0x0000242C,
+    0x00002422, 0x00001749, 0x0674402C, 0x0674802E, 0x0674C032, 0x000016F4,
+    0x00001772, 0x0000174D, 0x0000070E, 0x06750013, 0x00000FB6, 0x00001777,
+    0x06754001, 0x06758025, 0x000017B3, 0x06760032, 0x00002441, 0x0676402E,
+    0x0676802F, 0x0676C009, 0x000016F5, 0x00001787, 0x00001793, 0x000017FB,
+    0x00001765, 0x06770021, 0x06774005, 0x00001772, 0x06779006, 0x000000CE,
+    0x0000100F, 0x00000114, 0x00000FFA, 0x0677C029, 0x0000176F, 0x000016F3,
+    0x00001745, 0x00001769, 0x06780025, 0x06784005, 0x06788008, 0x0678D6E9,
+    0x00002444, 0x0000244E, 0x00001770, 0x00000FE9, 0x000023E1, 0x00002441,
+    0x00001023, 0x06790029, 0x0000242C, 0x06794005, 0x000000F2, 0x000016F2,
+    0x00001702, 0x00001034, 0x000017CC, 0x067997CE, 0x000017FB, 0x0679C00C,
+    0x067A000E, 0x067A800F, 0x00001793, 0x00002C7A, 0x00002406, 0x000023C7,
+    0x067AC00D, 0x0000244E, 0x000017B5, 0x067B0009, 0x00000FB5, 0x00001765,
+    0x067B4009, 0x000023CF, 0x000000B5, 0x0000242F, 0x067B8029, 0x00002429,
+    0x067BC029, 0x067C000C, 0x0000174F, 0x00001799, 0x0000103B, 0x067C400F,
+    0x067C8035, 0x00001784, 0x067CC005, 0x067DC009, 0x067E000D, 0x067E4013,
+    0x067E8034, 0x067EC014, 0x000017FB, 0x067F1745, 0x00001779, 0x067F400C,
+    0x000024AE, 0x067F8005, 0x000024A9, 0x0000242E, 0x06808029, 0x00001B81,
+    0x00000703, 0x000023C4, 0x000017E7, 0x00000F8C, 0x00001392, 0x000000F5,
+    0x0000242F, 0x06810009, 0x00000FCF, 0x00000FF5, 0x000017C9, 0x00000F92,
+    0x000017F9, 0x00001741, 0x00002445, 0x00002494, 0x00001076, 0x000023E9,
+    0x06814001, 0x000016C9, 0x00001779, 0x00001741, 0x06818025, 0x0000246C,
+    0x0681C005, 0x000023EF, 0x000023B4, 0x0000247B, 0x00001734, 0x00001734,
+    0x000000E5, 0x06820025, 0x06824012, 0x06828034, 0x0000172E, 0x00000F54,
+    0x000023F6, 0x0000172C, 0x00000F74, 0x0682C02C, 0x06830004, 0x00001727,
+    0x00001065, 0x00000F68, 0x00001773, 0x00000FEE, 0x06834025, 0x06838034,
+    0x00001765, 0x000023E5, 0x000017AF, 0x0683C035, 0x00001709, 0x0000242F,
+    0x000023AC, 0x00002429, 0x00001785, 0x06840029, 0x0684402E, 0x06848003,
+    0x00000FA4, 0x00002432, 0x00001725, 0x000016CD, 0x000016F4, 0x000017A6,
+    0x0684C021, 0x0685002F, 0x00000F61, 0x06854028, 0x00002423, 0x06858005,
+    0x000017B3, 0x00001784, 0x000023B2, 0x000017A3, 0x000006E1, 0x000023ED,
+    0x00002421, 0x0685C003, 0x00000FCF, 0x00001073, 0x00000FE1, 0x000016F2,
+    0x06860029, 0x00000FE3, 0x00000FEF, 0x0000242C, 0x000016E8, 0x06864024,
+    0x000000B4, 0x00000FB4, 0x06868021, 0x000023C3, 0x000016C7, 0x0686C009,
+    0x068716F4, 0x000023D3, 0x06878034, 0x00000F83, 0x00000090, 0x00000093,
+    0x06880034, 0x0688402F, 0x000000A4, 0x00001729, 0x000016EE, 0x00001707,
+    0x0688800E, 0x0688C033, 0x068916D2, 0x06894033, 0x00000669, 0x0689C034,
+    0x068A000D, 0x068A400E, 0x068A8010, 0x068AC012, 0x00001734, 0x068B002C,
+    0x068B4029, 0x068B8034, 0x00000F85, 0x068BD732, 0x068C000D, 0x00000F8F,
+    0x068C4012, 0x068CC033, 0x068D0023, 0x00001734, 0x00001703, 0x068D402D,
+    0x068D8012, 0x068DC033, 0x000016F2, 0x000023C4, 0x068E0025, 0x068E4001,
+    0x00000F87, 0x00000FB3, 0x068E8035, 0x068EC032, 0x000023A5, 0x00000F73,
+    0x068F0032, 0x068F400E, 0x068F802F, 0x000023C1, 0x00001722, 0x00001732,
+    0x068FC02E, 0x06904012, 0x00000F53, 0x00000F74, 0x00000F82, 0x06908025,
+    0x0690C00E, 0x000023B6, 0x0000170C, 0x0691402F, 0x00000F8D, 0x06918030,
+    0x0691C003, 0x00000645, 0x0000068B, 0x00000FB3, 0x000023F2, 0x00001729,
+    0x00000FB2, 0x06920003, 0x0000170D, 0x06924034, 0x0692C007, 0x000016CE,
+    0x00002390, 0x00000076, 0x06931707, 0x0000068E, 0x00000F8F, 0x00001734,
+    0x06934007, 0x0693800C, 0x0693C00E, 0x06940032, 0x06944012, 0x06948034,
+    0x0694C073, 0x0695000E, 0x06954032, 0x06958034, 0x00001723, 0x000023A4,
+    0x0695C034, 0x06960001, 0x00000F83, 0x00000084, 0x00000FB4, 0x06964034,
+    0x00000F68, 0x00000F74, 0x06968004, 0x0696C034, 0x00001705, 0x0697400F,
+    0x000006B4, 0x06978025, 0x00001703, 0x0697C00E, 0x06980034, 0x00000645,
+    0x0698400D, 0x06988673, 0x00001707, 0x0698C034, 0x00001711, 0x06990013,
+    0x06994037, 0x00001724, 0x06998029, 0x0699C00C, 0x0000068E, 0x069A4032,
+    0x069A802E, 0x069AC021, 0x069B002E, 0x000016CC, 0x069B400D, 0x069B802E,
+    0x069C000E, 0x069C5710, 0x069C8035, 0x069CC029, 0x00000081, 0x069D0003,
+    0x069D4004, 0x00000085, 0x000023CB, 0x000023CF, 0x00000FB5, 0x00000F65,
+    0x000023E1, 0x069D800E, 0x069DC032, 0x069E002C, 0x00002464, 0x069E4021,
+    0x00002474, 0x069E8029, 0x00002467, 0x00002444, 0x0000246F, 0x000024B5,
+    0x000024B4, 0x00002462, 0x00002426, 0x000017AE, 0x0000247B, 0x00001021,
+    0x00001772, 0x0000246E, 0x00001725, 0x0000246C, 0x00001029, 0x000024B2,
+    0x0000242E, 0x0000242E, 0x00001004, 0x069EC034, 0x000017BB, 0x00002476,
+    0x00001823, 0x000024BB, 0x00002CB4, 0x00002421, 0x00002463, 0x069F0009,
+    0x000022EF, 0x00002461, 0x00002479, 0x0000176F, 0x000023E9, 0x0000242E,
+    0x00001025, 0x000010B9, 0x00001003, 0x00001729, 0x00001069, 0x00001733,
+    0x00001033, 0x000017B7, 0x069F4034, 0x00002425, 0x00001073, 0x00001785,
+    0x000024A9, 0x000024A5, 0x00001028, 0x000017A9, 0x000024FA, 0x000023A8,
+    0x000017AF, 0x00000FEF, 0x000017B2, 0x000016EC, 0x000017A5, 0x0000246F,
+    0x00001072, 0x069F802C, 0x00001001, 0x00001075, 0x00002461, 0x000023E9,
+    0x00000FB4, 0x00002433, 0x00001034, 0x00002485, 0x069FC029, 0x06A00025,
+    0x00001727, 0x06A04029, 0x000016EC, 0x06A0C021, 0x06A1002E, 0x00002473,
+    0x00001034, 0x000024B3, 0x0000244C, 0x0000102E, 0x00001074, 0x06A14021,
+    0x000024A9, 0x00001034, 0x000024BB, 0x0000102E, 0x000023E1, 0x0000102C,
+    0x0000102F, 0x00002468, 0x0000102F, 0x0000103B, 0x00001001, 0x06A1A3EE,
+    0x00001034, 0x0000240D, 0x000024AE, 0x0000242D, 0x06A1C02E, 0x00001035,
+    0x06A20029, 0x00002470, 0x000017A7, 0x00001021, 0x00002462, 0x0000242E,
+    0x0000176F, 0x00001001, 0x0000244E, 0x00002479, 0x00001772, 0x00001772,
+    0x06A24025, 0x06A28021, 0x000023A9, 0x00001721, 0x00001769, 0x00001761,
+    0x00002467, 0x00002472, 0x0000243A, 0x0000103A, 0x00002AB2, 0x00002474,
+    0x00001032, 0x0000132F, 0x000011E1, 0x000023A8, 0x000024F0, 0x00001734,
+    0x00000FE3, 0x00001769, 0x00002434, 0x00000F64, 0x00000F68, 0x06A2C025,
+    0x00001729, 0x00002425, 0x00001725, 0x000010AF, 0x00000FEE, 0x0000246E,
+    0x00001034, 0x00001741, 0x06A30029, 0x00001743, 0x00002413, 0x00000FFA,
+    0x00001779, 0x00002472, 0x0000242D, 0x06A34005, 0x06A38029, 0x00001836,
+    0x0000242C, 0x06A3C030, 0x00000FB4, 0x0000182E, 0x0000246D, 0x06A410A9,
+    0x06A44029, 0x00000F70, 0x0000242F, 0x000010A9, 0x00002465, 0x00001013,
+    0x0000103B, 0x06A4C005, 0x000024E9, 0x06A54023, 0x000010B4, 0x00000FED,
+    0x000024BB, 0x00001823, 0x00001801, 0x00001829, 0x00000FFA, 0x06A58001,
+    0x000024E5, 0x00001023, 0x00000FF2, 0x00002432, 0x00000FE3, 0x00000FAE,
+    0x000023F4, 0x06A5C009, 0x000024FB, 0x00000FF4, 0x00001FE1, 0x000024E9,
+    0x0000174C, 0x000023EF, 0x00001725, 0x00002447, 0x000024B4, 0x000017F5,
+    0x00000FA9, 0x00002479, 0x06A60009, 0x000010B5, 0x00002AE2, 0x00002461,
+    0x00001729, 0x00001785, 0x00002336, 0x00001836, 0x00002434, 0x000017AE,
+    0x000016EE, 0x000017AC, 0x0000246D, 0x00001705, 0x00002BF1, 0x06A65083,
+    0x0000246C, 0x06A6800E, 0x000023B2, 0x000017B2, 0x06A6C029, 0x06A70029,
+    0x00000FC9, 0x00001032, 0x00000FEC, 0x000017AD, 0x06A74034, 0x000010BB,
+    0x0000247A, 0x000023E9, 0x00001813, 0x000010BB, 0x00002472, 0x0000243A,
+    0x00001034, 0x06A7802F, 0x000023F2, 0x06A7C02C, 0x00002432, 0x00001813,
+    0x0000183B, 0x00001765, 0x00002425, 0x00002472, 0x00002432, 0x00000FF5,
+    0x00000FF2, 0x00002433, 0x00001743, 0x0000176C, 0x00000FA5, 0x0000242E,
+    0x00000FA9, 0x000024A6, 0x00000FEE, 0x000017D3, 0x000017FB, 0x000023E3,
+    0x06A80033, 0x06A84009, 0x00002479, 0x000024A5, 0x000017ED, 0x000017F3,
+    0x000017CD, 0x06A8C030, 0x000017E3, 0x00001001, 0x0000242F, 0x000017ED,
+    0x000017AE, 0x00001021, 0x00001021, 0x0000246F, 0x00001FA5, 0x000024E9,
+    0x00001045, 0x06A90029, 0x06A94025, 0x06A98025, 0x00002467, 0x000024B4,
+    0x00002469, 0x00001724, 0x06A9C029, 0x000016E1, 0x06AA0032, 0x00001021,
+    0x00001065, 0x00001001, 0x000022FB, 0x00001072, 0x06AA4029, 0x00001FA7,
+    0x00002468, 0x000017A2, 0x0000103B, 0x00002461, 0x00001021, 0x06AA8032,
+    0x00002445, 0x00001529, 0x00002448, 0x000024B3, 0x000024FA, 0x06AAC029,
+    0x00002461, 0x0000246F, 0x000017F4, 0x06AB0025, 0x00001023, 0x0000246F,
+    0x00002449, 0x00002474, 0x00001032, 0x00002473, 0x00001028, 0x06AB4027,
+    0x06AB8025, 0x00000FF2, 0x0000246C, 0x00002463, 0x00001074, 0x06ABC029,
+    0x06AC17C3, 0x000017C4, 0x00001028, 0x000017E2, 0x00002922, 0x00002461,
+    0x00000F8C, 0x00002033, 0x00001824, 0x06AC4029, 0x000017A5, 0x0000106C,
+    0x0000242F, 0x00000FEE, 0x0000247B, 0x0000102F, 0x00002441, 0x06AC8003,
+    0x00001805, 0x00001034, 0x00002453, 0x00001034, 0x000024EB, 0x0000104E,
+    0x00001772, 0x00001025, 0x000017E1, 0x00001793, 0x00001814, 0x000024FA,
+    0x00001034, 0x00000FF2, 0x000024F5, 0x06ACC025, 0x0000246E, 0x00002472,
+    0x00002463, 0x06AD4014, 0x06ADC036, 0x0000242E, 0x06AE0025, 0x06AE402E,
+    0x06AE8034, 0x000024AE, 0x00001035, 0x00002461, 0x00001032, 0x06AEC032,
+    0x000017A5, 0x00001B62, 0x000016EE, 0x00001007, 0x0000246D, 0x0000106E,
+    0x0000248F, 0x06AF0035, 0x00002472, 0x00001724, 0x00000F64, 0x000024A5,
+    0x0000176F, 0x06AF4029, 0x00002461, 0x00001003, 0x00002466, 0x00001007,
+    0x00002473, 0x000023EC, 0x00002474, 0x0000100C, 0x00000FAF, 0x00002487,
+    0x00001729, 0x000024A2, 0x00001027, 0x000023E5, 0x00002433, 0x00002428,
+    0x00001025, 0x000023B4, 0x00000F68, 0x000023E5, 0x000024BB, 0x00001FCC,
+    0x0000104E, 0x06AFC034, 0x0000104E, 0x00001032, 0x000024C1, 0x000024E5,
+    0x0000246C, 0x000023B4, 0x06B00029, 0x00001769, 0x000024B3, 0x00000FE5,
+    0x00001765, 0x00002454, 0x00002439, 0x000023F4, 0x000023E1, 0x000023E3,
+    0x000017AE, 0x00002474, 0x00002413, 0x06B0503A, 0x00001836, 0x0000174E,
+    0x00002453, 0x0000247A, 0x000017B4, 0x0000247A, 0x00002474, 0x000024E1,
+    0x000024FB, 0x0000106E, 0x00002425, 0x000023E9, 0x00001734, 0x000023AF,
+    0x0000247A, 0x00002435, 0x00001821, 0x06B08028, 0x06B18033, 0x000010A4,
+    0x00000FAD, 0x00001749, 0x00001779, 0x000024FB, 0x06B1C005, 0x000023EF,
+    0x00002C7A, 0x00001765, 0x0000100E, 0x00002473, 0x00000FA5, 0x00001765,
+    0x06B20025, 0x06B24025, 0x0000178E, 0x000024B4, 0x06B28009, 0x00001779,
+    0x00002434, 0x00000FB0, 0x00001761, 0x000023E1, 0x000024B5, 0x00001764,
+    0x000016F2, 0x00001725, 0x00000FEC, 0x06B2C025, 0x00000FE9, 0x000024BA,
+    0x00002432, 0x00002434, 0x00002473, 0x00000FA5, 0x0000246E, 0x00000F65,
+    0x0000242C, 0x06B30029, 0x00000FEF, 0x000017AE, 0x00002425, 0x000017F4,
+    0x06B34034, 0x000017F6, 0x06B38029, 0x00001001, 0x00002474, 0x00002445,
+    0x0000247B, 0x000017C1, 0x000017FB, 0x00002461, 0x00001021, 0x00001F61,
+    0x00001021, 0x00002463, 0x00000FEC, 0x0000244E, 0x00001772, 0x00002435,
+    0x00001069, 0x0000246F, 0x0000242E, 0x0000183B, 0x00001021, 0x00000FA9,
+    0x000017E5, 0x00002421, 0x000017B4, 0x00002422, 0x00001025, 0x00002439,
+    0x06B3C034, 0x00002461, 0x00002425, 0x000024A9, 0x00001021, 0x000016CC,
+    0x00001032, 0x06B40029, 0x06B44021, 0x000024B3, 0x0000246E, 0x06B48029,
+    0x06B4C005, 0x06B50009, 0x00001039, 0x06B54032, 0x00000FF4, 0x06B58032,
+    0x06B5C021, 0x00002466, 0x00001004, 0x000012B4, 0x00001765, 0x00002425,
+    0x00000FF5, 0x000017AE, 0x000024FB, 0x0000246E, 0x0000100E, 0x00002430,
+    0x06B60029, 0x000016EE, 0x06B64025, 0x000017AC, 0x000016CE, 0x000017B3,
+    0x000017BB, 0x00001779, 0x06B68021, 0x00001769, 0x00001001, 0x000024A9,
+    0x00001001, 0x00002CAB, 0x0000246C, 0x000017ED, 0x000017ED, 0x00001034,
+    0x0000102C, 0x0000103B, 0x06B6C013, 0x00001FBB, 0x0000247B, 0x00002485,
+    0x0000152F, 0x000024F4, 0x06B70009, 0x00001839, 0x0000107B, 0x00001765,
+    0x06B74033, 0x00000FE3, 0x0000176C, 0x00002434, 0x00001765, 0x0000246E,
+    0x06B7802C, 0x00001836, 0x00001785, 0x000017A9, 0x06B7D7B4, 0x000024FB,
+    0x000023E2, 0x0000246F, 0x000024FB, 0x06B80032, 0x06B8C029, 0x000017AF,
+    0x000024EF, 0x000017B2, 0x0000183B, 0x00002432, 0x00000FF2, 0x06B90034,
+    0x000017A1, 0x0000176C, 0x00000FE1, 0x06B94025, 0x06B98023, 0x00000FF2,
+    0x000024A1, 0x06BA0035, 0x00002474, 0x00001027, 0x0000242C, 0x000010A3,
+    0x00000FF2, 0x0000157A, 0x000024FB, 0x06BA4034, 0x00002465, 0x00002435,
+    0x00002434, 0x06BA8030, 0x000023E4, 0x00002467, 0x000023A5, 0x000016E1,
+    0x06BAC033, 0x00000FA1, 0x06BB0009, 0x000024BB, 0x00000FE5, 0x06BB4029,
+    0x0000242E, 0x00001007, 0x0000246E, 0x00001769, 0x00001779, 0x000024C1,
+    0x00002413, 0x00000FFA, 0x06BB800E, 0x0000247A, 0x00001779, 0x00002465,
+    0x00001013, 0x06BBC03A, 0x00001FA7, 0x000024C1, 0x00001025, 0x0000242E,
+    0x00002423, 0x00001765, 0x000023B5, 0x00001765, 0x000024A1, 0x000010A9,
+    0x00000FEC, 0x00002469, 0x06BC0009, 0x00001039, 0x00001081, 0x00002C65,
+    0x000024A5, 0x06BC97EC, 0x06BD0032, 0x00001749, 0x06BD4032, 0x00002439,
+    0x06BD8021, 0x00002425, 0x06BDC033, 0x00002434, 0x00002425, 0x00000F81,
+    0x06BE0013, 0x0000103A, 0x000016EC, 0x0000103B, 0x0000183B, 0x00002479,
+    0x06BEA381, 0x000023E9, 0x000016F3, 0x00002473, 0x00000FE9, 0x06BEC029,
+    0x000017F3, 0x00002AB2, 0x00000F69, 0x06BF0032, 0x00002461, 0x00002474,
+    0x000016E9, 0x00001774, 0x00002429, 0x0000102C, 0x06BF402D, 0x00000FE5,
+    0x000017FB, 0x000024AF, 0x0000248C, 0x00001073, 0x06BF8032, 0x06BFC034,
+    0x06C017B4, 0x0000243A, 0x000023C2, 0x000017F2, 0x000010A3, 0x00002165,
+    0x00002485, 0x00001069, 0x06C04023, 0x0000103A, 0x000024FB, 0x00001761,
+    0x000010AF, 0x00001072, 0x000024AF, 0x00000FEC, 0x00001025, 0x000023E9,
+    0x06C08027, 0x00001083, 0x00002C7A, 0x00001767, 0x000024BA, 0x06C0C02C,
+    0x00002402, 0x06C10032, 0x0000126C, 0x00001723, 0x000016E9, 0x06C14022,
+    0x00000FB3, 0x00001772, 0x00001045, 0x00001FA7, 0x06C1802C, 0x00000FE5,
+    0x00001765, 0x00002C73, 0x000023E5, 0x00002467, 0x00001074, 0x000017ED,
+    0x00001003, 0x06C1C034, 0x000024F4, 0x06C20032, 0x00001021, 0x000024A5,
+    0x00002464, 0x06C24034, 0x00002445, 0x00001734, 0x06C2C009, 0x000017EF,
+    0x000024A5, 0x000010BA, 0x00000FF3, 0x00001032, 0x00002474, 0x06C30025,
+    0x0000246E, 0x06C34025, 0x00001032, 0x000016F3, 0x00001063, 0x00001065,
+    0x0000247B, 0x00001027, 0x00001008, 0x000024BB, 0x00002485, 0x06C38029,
+    0x00001725, 0x06C3C029, 0x00001025, 0x06C40029, 0x00001021, 0x06C44033,
+    0x06C48032, 0x00001001, 0x0000103B, 0x000024A9, 0x06C4C02E, 0x00001765,
+    0x000023AF, 0x000010AC, 0x00002474, 0x00001039, 0x000017A9, 0x00001039,
+    0x06C516E9, 0x000016EE, 0x000023A6, 0x06C550A1, 0x000024AE, 0x000024B2,
+    0x00001027, 0x000017E9, 0x06C58029, 0x06C5C027, 0x000024AC, 0x00002408,
+    0x06C60034, 0x00001021, 0x00001039, 0x00001027, 0x0000242E, 0x00001009,
+    0x00001039, 0x06C65070, 0x06C68009, 0x0000100F, 0x00001039, 0x06C6C034,
+    0x0000244C, 0x00002474, 0x06C70025, 0x00002453, 0x0000103B, 0x06C74033,
+    0x00002441, 0x00001045, 0x0000103B, 0x000023E9, 0x06C78025, 0x06C7C00E,
+    0x00000F93, 0x000017B4, 0x000016E9, 0x00001032, 0x00002474, 0x000024CE,
+    0x00001074, 0x00000FEC, 0x00001779, 0x06C80002, 0x06C84027, 0x00002429,
+    0x0000242C, 0x00001773, 0x00002472, 0x06C88009, 0x00002479, 0x06C8C029,
+    0x0000172C, 0x000016C1, 0x00001763, 0x00001725, 0x000017AE, 0x00001768,
+    0x06C90002, 0x000017C7, 0x000017FB, 0x06C94033, 0x06C98001, 0x000023A5,
+    0x00000FE9, 0x0000246E, 0x0000247A, 0x000023E9, 0x00000FEF, 0x000017BB,
+    0x00002467, 0x06C9C034, 0x00001085, 0x000024E9, 0x000017A5, 0x06CA0021,
+    0x00002461, 0x000023F4, 0x00002432, 0x00001722, 0x000024F4, 0x000023F4,
+    0x00002421, 0x06CA4029, 0x00001725, 0x000024C9, 0x0000242F, 0x00000FED,
+    0x06CA8021, 0x00001761, 0x00001045, 0x000010B3, 0x06CAC025, 0x00001EF4,
+    0x00000FAF, 0x00001061, 0x06CB0029, 0x00000FA5, 0x00000FF2, 0x06CB4005,
+    0x06CB8029, 0x00001725, 0x00002429, 0x00000FF4, 0x000023EF, 0x00001765,
+    0x00000FF2, 0x000010B9, 0x00002426, 0x0000182C, 0x06CBC02F, 0x00002469,
+    0x00000FEC, 0x00002465, 0x00002485, 0x06CC0027, 0x00001772, 0x00001772,
+    0x00001027, 0x00002472, 0x06CC4021, 0x06CC800C, 0x06CCC02D, 0x000017A5,
+    0x00001013, 0x00002434, 0x000017A3, 0x06CD0032, 0x00000FF3, 0x00001B81,
+    0x00001765, 0x0000246E, 0x06CD4033, 0x000017A9, 0x06CD8029, 0x06CDC001,
+    0x00001032, 0x000017B2, 0x00001B7A, 0x00001029, 0x00002469, 0x000017AC,
+    0x00000FCC, 0x06CE0032, 0x0000246C, 0x06CEC02C, 0x00001027, 0x00002433,
+    0x000024C4, 0x000017A5, 0x00002432, 0x00001003, 0x00001034, 0x0000242E,
+    0x00000FFA, 0x000024EE, 0x00001765, 0x000024FB, 0x000023E5, 0x06CF0029,
+    0x000012A2, 0x06CF4004, 0x06CF8032, 0x00000FE3, 0x00002432, 0x0000240C,
+    0x00000FF4, 0x000017AE, 0x00002468, 0x00002473, 0x06D01027, 0x0000246C,
+    0x00002472, 0x000024FB, 0x06D04034, 0x0000176C, 0x00002B33, 0x00001761,
+    0x0000102C, 0x00000FE3, 0x06D08025, 0x000017A5, 0x0000242C, 0x000024B4,
+    0x0000247B, 0x00001027, 0x00001774, 0x00002429, 0x00001772, 0x0000247B,
+    0x000016E8, 0x00001724, 0x000017F2, 0x00000F89, 0x0000170C, 0x000017F9,
+    0x000017F4, 0x06D0C030, 0x00000FEC, 0x00001779, 0x000023EE, 0x00001729,
+    0x0000247B, 0x000024B4, 0x000024E5, 0x00000FE9, 0x000016F2, 0x00001765,
+    0x0000282F, 0x00002472, 0x00002234, 0x000025E4, 0x00001839, 0x06D10032,
+    0x000017AC, 0x00002434, 0x000024A4, 0x000024AE, 0x00001804, 0x0000182C,
+    0x0000182F, 0x00000FEE, 0x00002464, 0x000023B4, 0x000024D3, 0x000010BB,
+    0x0000247A, 0x00001821, 0x000024FB, 0x000023E1, 0x000010AF, 0x00002445,
+    0x00002467, 0x000023A8, 0x00000F6C, 0x000024E8, 0x00002AA4, 0x000017A2,
+    0x00001023, 0x06D14009, 0x000024B9, 0x00001724, 0x000010B2, 0x00002467,
+    0x06D1C02C, 0x000024A7, 0x000017FB, 0x00001772, 0x00002479, 0x06D2002E,
+    0x000023E1, 0x00001729, 0x000024E4, 0x000024FB, 0x06D2400E, 0x000024AF,
+    0x000023E1, 0x000024EB, 0x00001027, 0x000024EB, 0x00000FA1, 0x000024E5,
+    0x000010A5, 0x000017C4, 0x06D28014, 0x000017F9, 0x000017E4, 0x0000246E,
+    0x06D2C025, 0x06D3002C, 0x0000242F, 0x0000242E, 0x06D34029, 0x00002467,
+    0x00001765, 0x00000F61, 0x00002472, 0x0000103A, 0x00001823, 0x000017B2,
+    0x00001773, 0x00002434, 0x00001729, 0x00002472, 0x00000FF4, 0x000010AE,
+    0x00001833, 0x06D38021, 0x06D3C005, 0x00000FD3, 0x06D4003A, 0x06D44029,
+    0x0000107B, 0x000023E5, 0x00001013, 0x00002434, 0x00000FF3, 0x00002441,
+    0x0000247B, 0x000024EB, 0x00002445, 0x06D48029, 0x06D4C029, 0x000017AF,
+    0x06D54029, 0x0000242C, 0x000010BB, 0x06D58025, 0x06D5C029, 0x0000102E,
+    0x000010BB, 0x000024BB, 0x06D60021, 0x06D6400C, 0x00001034, 0x00001005,
+    0x0000243A, 0x00001032, 0x00002408, 0x06D696C9, 0x06D6C034, 0x06D70025,
+    0x000023E9, 0x06D78005, 0x06D7C009, 0x00001833, 0x00002429, 0x000023C9,
+    0x00001839, 0x06D80028, 0x00000FF0, 0x000017B3, 0x00000FF3, 0x06D8402E,
+    0x000017EF, 0x000022E7, 0x0000107B, 0x00002474, 0x00001004, 0x00001033,
+    0x00001765, 0x0000176C, 0x00000FEE, 0x0000243A, 0x06D88032, 0x000024A9,
+    0x000024E5, 0x00001032, 0x00001027, 0x00002468, 0x000017B2, 0x00001B42,
+    0x000017B3, 0x00002433, 0x00000F61, 0x000017B9, 0x00001FA7, 0x000023EF,
+    0x00002468, 0x00000FE2, 0x06D8C012, 0x000017B3, 0x000023F3, 0x00001027,
+    0x06D90032, 0x00002422, 0x00002434, 0x000017B2, 0x06D94029, 0x06D9802E,
+    0x00002432, 0x00002473, 0x00001025, 0x000017A5, 0x000017AE, 0x06D9C032,
+    0x00001729, 0x06DA0029, 0x00001045, 0x00001027, 0x06DA402E, 0x06DA8021,
+    0x0000242C, 0x00002465, 0x0000247A, 0x06DAC025, 0x00000FE9, 0x00000FED,
+    0x000024A5, 0x000017CC, 0x06DB104E, 0x000017D3, 0x000024FB, 0x00000FE5,
+    0x06DB4029, 0x000010A5, 0x00000FE8, 0x00001765, 0x00000FF2, 0x00002469,
+    0x000024C4, 0x00001FCE, 0x000024D3, 0x000024FB, 0x000024D4, 0x0000157A,
+    0x00000FF4, 0x00002422, 0x00001825, 0x00002472, 0x00002472, 0x06DB8029,
+    0x00000F68, 0x06DBC029, 0x00001765, 0x0000246E, 0x000016E1, 0x06DC0034,
+    0x0000247A, 0x00001724, 0x06DC4034, 0x06DC8022, 0x000023AC, 0x00001032,
+    0x00002474, 0x00001021, 0x0000106E, 0x06DCC025, 0x00002434, 0x000023ED,
+    0x00000FC5, 0x06DD0029, 0x06DD4009, 0x00001779, 0x06DD8025, 0x000023AD,
+    0x00002421, 0x00001725, 0x00002421, 0x00000FCD, 0x06DDC034, 0x06DE0034,
+    0x06DE4030, 0x000023E3, 0x06DE8021, 0x06DEC02F, 0x00001761, 0x06DF002C,
+    0x000023F2, 0x06DF402E, 0x06DF802F, 0x00000FC1, 0x00000FE9, 0x00001723,
+    0x06DFC034, 0x000023A2, 0x06E00034, 0x00000FA9, 0x00000FED, 0x00000F6D,
+    0x06E04029, 0x00001769, 0x06E0802D, 0x000015B4, 0x00002427, 0x06E0C004,
+    0x000023EB, 0x06E1002F, 0x00000FF2, 0x06E14005, 0x00000FAF, 0x00000F6C,
+    0x06E18029, 0x00000FE9, 0x00001779, 0x06E1C005, 0x000023A8, 0x000023E5,
+    0x000023E1, 0x00002BA1, 0x000023EF, 0x000023E1, 0x06E20034, 0x00000FA3,
+    0x06E24025, 0x06E28034, 0x00000FA5, 0x00000FEF, 0x06E2E421, 0x00002425,
+    0x06E30034, 0x0000176C, 0x06E34021, 0x00002405, 0x06E38029, 0x000023EE,
+    0x00000FAD, 0x00001734, 0x06E3C029, 0x06E40029, 0x06E44034, 0x000023F5,
+    0x000023F4, 0x000023E4, 0x00000FA5, 0x00002386, 0x000023AC, 0x06E48029,
+    0x000016E7, 0x06E4C022, 0x06E50021, 0x00002BAF, 0x000016C7, 0x000023EB,
+    0x00001721, 0x000023E9, 0x000023F3, 0x06E54022, 0x00000FE5, 0x06E58025,
+    0x06E5C024, 0x00002421, 0x000023E9, 0x00002962, 0x00002C7A, 0x00001829,
+    0x00001833, 0x000024BB, 0x06E61821, 0x000024B3, 0x06E64034, 0x000024CF,
+    0x000024B6, 0x000017EE, 0x000024A5, 0x000024B4, 0x000024E1, 0x06E68021,
+    0x000024BA, 0x00002472, 0x00002467, 0x000017B2, 0x0000242E, 0x00002432,
+    0x00002467, 0x000023A1, 0x00002922, 0x00002503, 0x00002C73, 0x06E6C013,
+    0x0000253B, 0x0000253B, 0x06E70034, 0x00002523, 0x000017B3, 0x0000247B,
+    0x000017F3, 0x000023E6, 0x0000243A, 0x000017EF, 0x0000242E, 0x00002529,
+    0x000024A1, 0x06E74003, 0x000024A5, 0x00001825, 0x06E78034, 0x00002433,
+    0x0000183B, 0x000024B6, 0x000024A1, 0x000024A2, 0x000024A1, 0x000023EF,
+    0x00001772, 0x00002465, 0x00001873, 0x06E7C034, 0x000024A1, 0x0000187B,
+    0x000024A5, 0x00001813, 0x0000183B, 0x00001813, 0x0000183B, 0x00001821,
+    0x000024AE, 0x000024A1, 0x00001765, 0x000024A1, 0x000023A3, 0x000024CF,
+    0x000024B6, 0x00001865, 0x0000242E, 0x00002421, 0x06E80005, 0x06E84009,
+    0x00001859, 0x0000253B, 0x0000187B, 0x00002432, 0x0000242E, 0x00002472,
+    0x000017B3, 0x00002432, 0x0000247A, 0x00002465, 0x000017E3, 0x06E88021,
+    0x06E8C02E, 0x00001772, 0x06E9002E, 0x000024FB, 0x0000252F, 0x000023E1,
+    0x000017B9, 0x000016F3, 0x000024B6, 0x00002472, 0x0000186C, 0x0000183B,
+    0x00001865, 0x000024F3, 0x00001869, 0x06E94029, 0x00001781, 0x00001793,
+    0x000017BB, 0x0000243A, 0x00002525, 0x00002432, 0x00002501, 0x00002CB3,
+    0x000023A9, 0x000017EF, 0x06E98028, 0x000024FB, 0x00002521, 0x06EA002E,
+    0x06EA4025, 0x00001861, 0x00002503, 0x000024A5, 0x00002449, 0x000024F9,
+    0x000017BB, 0x000024F9, 0x06EA8034, 0x000024B4, 0x0000178D, 0x000017B4,
+    0x00002462, 0x06EAC034, 0x0000247B, 0x06EB0029, 0x000023E1, 0x000024BB,
+    0x06EB4029, 0x06EB8021, 0x06EBC029, 0x00002769, 0x000017F9, 0x0000242C,
+    0x06EC002C, 0x06EC4029, 0x000023E1, 0x00002493, 0x000024BB, 0x000024B6,
+    0x00002432, 0x0000242E, 0x000024EF, 0x000024BA, 0x000024BA, 0x000024A5,
+    0x000024B9, 0x00002524, 0x06EC8032, 0x00001867, 0x000024BA, 0x000024A5,
+    0x000024BB, 0x00001869, 0x000024B6, 0x000024E9, 0x00001727, 0x00002469,
+    0x00002432, 0x00001765, 0x0000242C, 0x00002465, 0x00002523, 0x000017E3,
+    0x0000242C, 0x00002434, 0x000017AC, 0x00002529, 0x000017F0, 0x06ECC034,
+    0x00002423, 0x0000246E, 0x00002434, 0x000017A4, 0x000017AE, 0x000016EE,
+    0x000024BB, 0x000024F4, 0x0000246C, 0x06ED0030, 0x000024BB, 0x000017E9,
+    0x00002422, 0x000024AC, 0x00002493, 0x00002494, 0x000029BB, 0x00002475,
+    0x00002463, 0x000024FB, 0x00002453, 0x0000247B, 0x0000183B, 0x00002465,
+    0x00002472, 0x000016E8, 0x000023E1, 0x00002503, 0x000024FA, 0x0000172C,
+    0x000016E4, 0x000023E9, 0x00002535, 0x000024B3, 0x06ED4029, 0x000017B3,
+    0x000017A7, 0x00002473, 0x00002421, 0x00002534, 0x00002523, 0x00002414,
+    0x0000247A, 0x0000242E, 0x00002425, 0x06ED8023, 0x000024B4, 0x000017A9,
+    0x00001774, 0x00001765, 0x0000244E, 0x000028F3, 0x00002473, 0x00002521,
+    0x00002465, 0x00002474, 0x000017BB, 0x000017FB, 0x000023B4, 0x000017A3,
+    0x06EDC027, 0x000024A5, 0x0000247A, 0x000023E1, 0x06EE0034, 0x00002464,
+    0x00002463, 0x0000172E, 0x00002465, 0x0000242E, 0x000017EF, 0x000023AF,
+    0x0000242C, 0x000017B2, 0x000023F3, 0x000017A5, 0x000023B2, 0x0000246F,
+    0x00001769, 0x00001765, 0x000023E2, 0x0000242C, 0x06EE402C, 0x06EE8025,
+    0x000017A9, 0x06EEC029, 0x000023A8, 0x00002934, 0x06EF0025, 0x000023E9,
+    0x000023E9, 0x00002439, 0x0000246E, 0x00002432, 0x00002429, 0x00002472,
+    0x000023E9, 0x000023E2, 0x0000246F, 0x0000242C, 0x00002474, 0x06EF402F,
+    0x00002474, 0x06EF8021, 0x00002465, 0x0000242C, 0x0000242E, 0x06EFC035,
+    0x000023B2, 0x00001765, 0x000024F2, 0x00002525, 0x00002432, 0x000024F3,
+    0x06F00029, 0x06F04021, 0x00002CA5, 0x06F08029, 0x00002532, 0x00002563,
+    0x000023F2, 0x000024E7, 0x000024E7, 0x000024A3, 0x06F0C009, 0x00002579,
+    0x000024E5, 0x000024FB, 0x06F10029, 0x00002465, 0x0000247A, 0x000024B6,
+    0x000024F4, 0x00002573, 0x00002429, 0x000024FA, 0x000023E1, 0x000024A5,
+    0x000024A5, 0x0000257A, 0x00002561, 0x000024BB, 0x06F14029, 0x000023E9,
+    0x00002472, 0x000023AF, 0x00002472, 0x06F1802E, 0x000024B4, 0x00002434,
+    0x0000256F, 0x00002534, 0x0000252F, 0x000025BA, 0x000025BA, 0x000024E3,
+    0x00002421,
+};
+
+// 分值向量：长度 + 分值，最后一个分值对应模式末尾之后的位置
+static const uint8_t s_hyph_vectors[869] = {
+    1, 1, 2, 1, 0, 3, 1, 0, 0, 4, 1, 0, 0, 0, 5, 1, 0, 0, 0, 0,
+    4, 1, 0, 0, 4, 4, 1, 0, 1, 0, 3, 1, 0, 2, 4, 1, 0, 3, 0, 3,
+    1, 0, 4, 4, 1, 0, 4, 0, 3, 1, 1, 0, 5, 1, 1, 0, 0, 0, 2, 1,
+    2, 3, 1, 2, 0, 4, 1, 2, 0, 0, 3, 1, 2, 2, 2, 1, 3, 2, 1, 4,
+    3, 1, 4, 0, 4, 1, 4, 0, 0, 5, 1, 4, 0, 0, 0, 4, 1, 4, 3, 0,
+    3, 1, 4, 4, 1, 2, 2, 2, 0, 3, 2, 0, 0, 4, 2, 0, 0, 0, 5, 2,
+    0, 0, 0, 0, 4, 2, 0, 0, 4, 5, 2, 0, 0, 4, 0, 4, 2, 0, 1, 0,
+    3, 2, 0, 2, 4, 2, 0, 2, 0, 3, 2, 0, 4, 5, 2, 0, 4, 0, 0, 3,
+    2, 0, 5, 2, 2, 1, 3, 2, 1, 0, 4, 2, 1, 0, 0, 3, 2, 1, 2, 4,
+    2, 1, 2, 0, 4, 2, 1, 4, 0, 2, 2, 2, 3, 2, 2, 0, 4, 2, 2, 0,
+    0, 2, 2, 3, 3, 2, 3, 0, 4, 2, 3, 0, 0, 5, 2, 3, 0, 0, 0, 3,
+    2, 3, 2, 4, 2, 3, 4, 0, 2, 2, 4, 2, 2, 5, 3, 2, 5, 0, 4, 2,
+    5, 0, 0, 5, 2, 5, 0, 0, 0, 3, 2, 5, 2, 4, 2, 5, 3, 0, 4, 2,
+    5, 5, 0, 1, 3, 2, 3, 0, 3, 3, 0, 0, 4, 3, 0, 0, 0, 5, 3, 0,
+    0, 0, 0, 6, 3, 0, 0, 0, 0, 0, 4, 3, 0, 0, 2, 4, 3, 0, 0, 3,
+    4, 3, 0, 0, 4, 5, 3, 0, 0, 4, 0, 6, 3, 0, 0, 5, 0, 0, 4, 3,
+    0, 1, 0, 3, 3, 0, 3, 4, 3, 0, 3, 0, 5, 3, 0, 3, 0, 0, 6, 3,
+    0, 3, 0, 0, 0, 3, 3, 0, 4, 4, 3, 0, 4, 0, 3, 3, 0, 5, 2, 3,
+    2, 3, 3, 2, 0, 2, 3, 3, 3, 3, 3, 0, 4, 3, 3, 0, 0, 5, 3, 3,
+    0, 0, 0, 2, 3, 4, 3, 3, 4, 0, 4, 3, 4, 0, 0, 5, 3, 4, 0, 0,
+    0, 4, 3, 4, 4, 0, 1, 4, 2, 4, 0, 3, 4, 0, 0, 4, 4, 0, 0, 0,
+    5, 4, 0, 0, 0, 0, 6, 4, 0, 0, 0, 0, 0, 7, 4, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 0, 4, 5, 4, 0, 0, 4, 0, 5, 4, 0, 0, 5, 0, 4, 4,
+    0, 1, 0, 5, 4, 0, 1, 0, 0, 3, 4, 0, 2, 4, 4, 0, 2, 0, 5, 4,
+    0, 2, 0, 0, 4, 4, 0, 3, 0, 5, 4, 0, 3, 0, 0, 3, 4, 0, 4, 4,
+    4, 0, 4, 0, 5, 4, 0, 4, 0, 0, 4, 4, 0, 5, 0, 2, 4, 1, 3, 4,
+    1, 0, 4, 4, 1, 0, 0, 5, 4, 1, 0, 0, 0, 3, 4, 1, 2, 4, 4, 1,
+    2, 0, 3, 4, 1, 4, 2, 4, 2, 3, 4, 2, 0, 4, 4, 2, 0, 0, 5, 4,
+    2, 0, 0, 0, 2, 4, 3, 3, 4, 3, 0, 4, 4, 3, 0, 0, 5, 4, 3, 0,
+    0, 0, 6, 4, 3, 0, 0, 0, 0, 5, 4, 3, 0, 3, 0, 3, 4, 3, 2, 4,
+    4, 3, 2, 0, 5, 4, 3, 3, 0, 0, 2, 4, 4, 3, 4, 4, 0, 4, 4, 4,
+    0, 0, 4, 4, 4, 4, 0, 2, 4, 5, 3, 4, 5, 0, 4, 4, 5, 0, 0, 5,
+    4, 5, 0, 0, 0, 6, 4, 5, 0, 0, 0, 0, 3, 4, 5, 4, 1, 5, 2, 5,
+    0, 3, 5, 0, 0, 4, 5, 0, 0, 0, 5, 5, 0, 0, 0, 0, 6, 5, 0, 0,
+    0, 0, 0, 7, 5, 0, 0, 0, 0, 0, 0, 8, 5, 0, 0, 0, 0, 0, 0, 0,
+    9, 5, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 4, 0, 5, 5, 0,
+    0, 3, 0, 4, 5, 0, 0, 4, 5, 5, 0, 0, 4, 0, 4, 5, 0, 0, 5, 5,
+    5, 0, 0, 5, 0, 7, 5, 0, 0, 5, 5, 0, 0, 4, 5, 0, 3, 0, 5, 5,
+    0, 3, 0, 0, 6, 5, 0, 3, 0, 0, 0, 3, 5, 0, 4, 4, 5, 0, 4, 0,
+    3, 5, 0, 5, 4, 5, 0, 5, 0, 5, 5, 0, 5, 0, 0, 6, 5, 0, 5, 0,
+    0, 0, 2, 5, 2, 3, 5, 2, 0, 4, 5, 2, 0, 0, 2, 5, 4, 3, 5, 4,
+    0, 4, 5, 4, 0, 0, 5, 5, 4, 0, 0, 0, 2, 5, 5, 3, 5, 5, 0, 4,
+    5, 5, 0, 0, 5, 5, 5, 0, 0, 0, 6, 5, 5, 0, 0, 0, 0, 5, 5, 5,
+    0, 4, 0, 5, 5, 5, 2, 0, 0,
+};
+
+static const uint16_t s_hyph_vector_offsets[HYPH_VECTOR_COUNT] = {
+    0, 2, 5, 9, 14, 20, 25, 30, 34, 39, 43, 48,
+    52, 58, 61, 65, 70, 74, 77, 80, 84, 89, 95, 100,
+    104, 106, 109, 113, 118, 124, 129, 135, 140, 144, 149, 153,
+    159, 163, 166, 170, 175, 179, 184, 189, 192, 196, 201, 204,
+    208, 213, 219, 223, 228, 231, 234, 238, 243, 249, 253, 258,
+    263, 265, 268, 272, 277, 283, 290, 295, 300, 305, 311, 318,
+    323, 327, 332, 338, 345, 349, 354, 358, 361, 365, 368, 372,
+    377, 383, 386, 390, 395, 401, 406, 408, 411, 415, 420, 426,
+    433, 441, 446, 452, 458, 463, 469, 473, 478, 484, 489, 495,
+    499, 504, 510, 515, 518, 522, 527, 533, 537, 542, 546, 549,
+    553, 558, 564, 567, 571, 576, 582, 589, 595, 599, 604, 610,
+    613, 617, 622, 627, 630, 634, 639, 645, 652, 656, 658, 661,
+    665, 670, 676, 683, 691, 700, 710, 717, 723, 728, 734, 739,
+    745, 753, 758, 764, 771, 775, 780, 784, 789, 795, 802, 805,
+    809, 814, 817, 821, 826, 832, 835, 839, 844, 850, 857, 863,
+};
+
+// 例外词（- 为断字点），按去掉连字符后的拼写排序
+static const char s_hyph_exceptions[] =
+    "acad-e-mies\0acad-e-my\0ac-cu-sa-tive\0acro-nym\0acro-nyms\0acryl-alde-hyde\0"
+    "acryl-amide\0acryl-amides\0acu-punc-ture\0acu-punc-tur-ist\0add-a-ble\0add-i-ble\0"
+    "adren-a-line\0aero-space\0af-ter-thought\0af-ter-thoughts\0agron-o-mist\0agron-o-mists\0"
+    "alex-an-der\0alex-an-drine\0al-ge-bra-i-cal-ly\0al-ge-brai-sche\0al-gon-quian\0al-gon-quin\0"
+    "al-le-ghe-ny\0am-phet-a-mine\0am-phet-a-mines\0anach-ro-nism\0anach-ro-nis-tic\0an-a-lyse\0"
+    "an-a-lysed\0analy-ses\0analy-sis\0an-eu-rysm\0an-eu-rys-mal\0an-eu-rysms\0"
+    "an-iso-trop-ic\0an-iso-trop-i-cal-ly\0an-isot-ro-pism\0an-isot-ropy\0an-ni-ver-saries\0an-ni-ver-sary\0"
+    "anom-a-lies\0anom-a-ly\0anti-deriv-a-tive\0anti-deriv-a-tives\0anti-holo-mor-phic\0an-tin-o-mies\0"
+    "an-tin-o-my\0anti-nu-clear\0anti-nu-cle-on\0anti-rev-o-lu-tion-ary\0a-peri-odic\0apol-lo-dorus\0"
+    "apoth-e-o-ses\0apoth-e-o-sis\0ap-pen-di-ces\0ap-pen-dix\0ap-pen-dixes\0ar-che-typ-al\0"
+    "ar-che-type\0ar-che-types\0ar-che-typ-i-cal\0ar-chi-me-dean\0ar-chi-pel-ago\0ar-chi-pel-a-gos\0"
+    "ar-chive\0ar-chives\0ar-chiv-ing\0ar-chiv-ist\0ar-chiv-ists\0arc-tan-gent\0"
+    "arc-tan-gents\0ar-kan-sas\0a-spher-ic\0a-spher-i-cal\0as-sign-a-ble\0as-sign-or\0"
+    "as-sign-ors\0as-sist-ance\0as-sist-ant\0as-sist-ant-ship\0as-sist-ant-ships\0as-so-ciate\0"
+    "as-so-ciates\0as-trol-o-ger\0as-trol-o-gers\0as-tron-o-mer\0as-tron-o-mers\0asymp-to-matic\0"
+    "as-ymp-tot-ic\0asyn-chro-nous\0ath-er-o-scle-ro-sis\0at-mos-phere\0at-mos-pheres\0atp-ase\0"
+    "atp-ases\0at-trib-ut-able\0at-tri-bute\0at-trib-uted\0auf-lage\0aus-tral-asian\0"
+    "au-tom-a-ta\0au-to-ma-tion\0auto-ma-ti-sier-ter\0au-tom-a-ton\0au-ton-o-mous\0auto-num-ber-ing\0"
+    "auto-re-gres-sion\0auto-re-gres-sive\0auto-round-ing\0av-oir-du-pois\0back-scratcher\0back-scratch-ing\0"
+    "band-lead-er\0band-lead-ers\0bank-rupt\0bank-rupt-cies\0bank-rupt-cy\0bank-rupts\0"
+    "bar-onies\0base-line-skip\0ba-thym-e-try\0bathy-scaphe\0bean-ies\0beb-chuk\0"
+    "be-die-nung\0be-drag-gle\0be-drag-gled\0bed-rid-den\0bed-rock\0be-dwarf\0"
+    "be-dwarfs\0be-hav-iour\0be-hav-iours\0bembo\0bevies\0bib-lio-graph-i-cal\0"
+    "bi-blio-gra-phi-sche\0bib-li-og-ra-phy-style\0bib-units\0bi-dif-fer-en-tial\0big-gest\0big-shot\0"
+    "big-shots\0bill-able\0bio-math-e-mat-ics\0bio-med-i-cal\0bio-med-i-cine\0bio-rhythms\0"
+    "bio-weap-on-ry\0bio-weap-ons\0bit-map\0bit-maps\0bland-er\0bland-est\0"
+    "blind-er\0blind-est\0blondes\0blue-print\0blue-prints\0bo-lom-e-ter\0"
+    "bo-lom-e-ters\0book-sell-er\0book-sell-ers\0bool-ean\0bool-eans\0bor-no-log-i-cal\0"
+    "bos-ton\0bot-u-lism\0brown-ian\0bruns-wick\0brusquer\0bu-da-pest\0"
+    "buf-fer\0buf-fers\0bun-gee\0bun-gees\0burck-hardt\0busier\0"
+    "busi-est\0bussing\0butted\0buzz-word\0buzz-words\0cache-abil-ity\0"
+    "cache-able\0ca-coph-o-nies\0ca-coph-o-ny\0call-er\0call-ers\0cam-era-men\0"
+    "cara-theo-dory\0car-ib-bean\0cart-wheel\0cart-wheels\0ca-tarrh\0ca-tarrhs\0"
+    "ca-tas-tro-phe\0ca-tas-tro-phes\0cat-a-stroph-ic\0cat-a-stroph-i-cally\0ca-tas-tro-phism\0cat-e-noid\0"
+    "cat-e-noids\0cau-li-flow-er\0chan-cery\0chap-ar-ral\0charles-ton\0char-lottes-ville\0"
+    "char-treuse\0chemo-kine\0chemo-kines\0chemo-ther-a-pies\0chemo-ther-apy\0ches-ter\0"
+    "chiang\0chich-es-ter\0chloro-meth-ane\0chloro-meth-anes\0cho-les-teric\0cig-a-rette\0"
+    "cig-a-rettes\0cinque-foil\0co-asso-cia-tive\0coch-lear\0coch-leas\0co-designer\0"
+    "co-designers\0co-gnac\0co-gnacs\0cohen\0co-ker-nel\0co-ker-nels\0"
+    "col-lin-ea-tion\0co-lum-bia\0col-umns\0com-par-and\0com-par-ands\0com-pen-dium\0"
+    "com-po-nent-wise\0comp-trol-ler\0comp-trol-lers\0com-put-abil-ity\0com-put-able\0con-form-able\0"
+    "con-form-ist\0con-form-ists\0con-form-ity\0con-ge-ries\0con-gress\0con-gresses\0"
+    "con-struc-ted\0con-struc-ti-bil-ity\0con-struc-ti-ble\0con-trib-ute\0con-trib-uted\0con-trib-utes\0"
+    "copy-right-able\0co-re-la-tion\0co-re-la-tions\0co-re-li-gion-ist\0co-re-li-gion-ists\0co-re-op-sis\0"
+    "co-re-spon-dent\0co-re-spon-dents\0co-se-cant\0co-semi-sim-ple\0co-tan-gent\0cour-ses\0"
+    "co-work-er\0co-work-ers\0crank-case\0crank-shaft\0croc-o-dile\0croc-o-diles\0"
+    "cross-hatch\0cross-hatched\0cross-hatch-ing\0cross-over\0cryp-to-gram\0cryp-to-grams\0"
+    "cuff-link\0cuff-links\0cu-nei-form\0cus-tom-iz-a-ble\0cus-tom-ize\0cus-tom-ized\0"
+    "cus-tom-izes\0cy-ber-virus\0cy-ber-viruses\0cy-ber-wea-pon\0cy-ber-wea-pons\0cy-to-kine\0"
+    "cy-to-kines\0czecho-slo-va-kia\0dachs-hund\0dactyl-o-gram\0dactyl-o-graph\0dam-sel-flies\0"
+    "dam-sel-fly\0data-base\0data-bases\0data-path\0data-paths\0date-stamp\0"
+    "date-stamps\0de-allo-cate\0de-allo-cated\0de-allo-cates\0de-allo-ca-tion\0de-allo-ca-tions\0"
+    "de-clar-able\0dec-li-na-tion\0de-fin-i-tive\0del-a-ware\0de-lec-ta-ble\0demi-semi-qua-ver\0"
+    "demi-semi-qua-vers\0de-moc-ra-tism\0demos\0der-i-va-tion\0der-i-va-tion-al\0der-i-va-tions\0"
+    "de-riv-a-tive\0de-riv-a-tives\0dia-lec-tic\0dia-lec-ti-cian\0dia-lec-ti-cians\0dia-lec-tics\0"
+    "di-chloro-meth-ane\0dif-fract\0dif-frac-tion\0dif-frac-tions\0dif-fracts\0dijk-stra\0"
+    "dire-ness\0direr\0dis-par-and\0dis-par-ands\0dis-traught-ly\0dis-trib-ut-able\0"
+    "dis-trib-ute\0dis-trib-uted\0dis-trib-utes\0dis-trib-u-tive\0doll-ish\0dor-ches-ter\0"
+    "dorf-leit-ner\0dou-ble-space\0dou-ble-spaced\0dou-ble-spac-ing\0dou-ble-talk\0drechs-ler\0"
+    "drift-age\0driv-ers\0drom-e-daries\0drom-e-dary\0drop-let\0drop-lets\0"
+    "duane\0du-op-o-lies\0du-op-o-list\0du-op-o-lists\0du-op-o-ly\0dy-na-mi-sche\0"
+    "dys-lec-tic\0dys-lexia\0dys-topia\0east-end-ers\0eco-nom-ics\0econ-o-mies\0"
+    "econ-o-mist\0econ-o-mists\0eco-sys-tem\0eco-sys-tems\0ei-gen-class\0ei-gen-classes\0"
+    "ei-gen-val-ue\0ei-gen-val-ues\0eijk-hout\0electro-mechan-i-cal\0electro-mechano-acoustic\0elec-tro-pho-re-sis\0"
+    "elec-tro-pho-ret-ic\0elit-ist\0elit-ists\0en-dos-copies\0en-dos-copy\0engel\0"
+    "engle\0eng-lish\0en-tre-pre-neur\0en-tre-pre-neur-ial\0en-tre-pre-neurs\0ep-i-neph-rine\0"
+    "eps-to-pdf\0equi-vari-ance\0equi-vari-ant\0er-go-nom-ic\0er-go-nom-i-cally\0er-go-nom-ics\0"
+    "es-sence\0es-sences\0eth-ane\0eth-yl-am-ine\0eth-yl-ate\0eth-yl-ated\0"
+    "eth-yl-ene\0ethy-nyl\0ethy-nyl-a-tion\0euler-ian\0eu-sta-chian\0evan-ston\0"
+    "ever-si-ble\0evert\0evert-ed\0evert-ing\0everts\0ex-plan-a-tory\0"
+    "ex-quis-ite\0ex-tra-or-di-nary\0face-lift-ing\0face-lifts\0fall-ing\0feb-ru-ary\0"
+    "fermi-ons\0fest-schrift\0figu-rine\0figu-rines\0fi-nite-ly\0fla-gel-la\0"
+    "fla-gel-lum\0flam-ma-bles\0fledg-ling\0flor-i-da\0flor-i-d-ian\0flow-chart\0"
+    "flow-charts\0fluoro-car-bon\0fluor-os-copies\0fluor-os-copy\0for-mi-da-ble\0for-mi-da-bly\0"
+    "for-schungs-in-sti-tut\0for-syth-ia\0forth-right\0free-bsd\0free-loader\0free-loaders\0"
+    "friend-lier\0friend-li-est\0fri-vol-i-ties\0fri-vol-ity\0friv-o-lous\0front-end\0"
+    "front-ends\0funk-tsional\0ga-lac-tic\0gal-ax-ies\0gal-axy\0gas-om-e-ter\0"
+    "gauss-ian\0gaz-et-teer\0gaz-et-teers\0ge-o-des-ic\0ge-o-det-ic\0ge-om-eter\0"
+    "ge-om-eters\0geo-met-ric\0geo-met-rics\0ge-o-strophic\0geo-ther-mal\0ge-ot-ro-pism\0"
+    "ge-sell-schaft\0ghost-script\0ghost-view\0giga-nodes\0gno-mon\0gno-mons\0"
+    "gott-fried\0gott-lieb\0gran-di-ose\0grand-uncle\0grand-uncles\0grass-mann-ian\0"
+    "greifs-wald\0griev-ance\0griev-ances\0griev-ous\0griev-ous-ly\0grothen-dieck\0"
+    "group-like\0grund-leh-ren\0ha-da-mard\0hai-fa\0hair-style\0hair-styles\0"
+    "hair-styl-ist\0hair-styl-ists\0half-life\0half-lives\0half-space\0half-spaces\0"
+    "half-tone\0half-tones\0half-way\0hamil-ton-ian\0har-bin-ger\0har-bin-gers\0"
+    "har-le-quin\0har-le-quins\0hatch-eries\0hei-nous\0he-lio-pause\0he-lio-trope\0"
+    "hel-sinki\0hemi-demi-semi-qua-ver\0hemi-demi-semi-qua-vers\0he-mo-glo-bin\0he-mo-phil-ia\0he-mo-phil-iac\0"
+    "he-mo-phil-iacs\0hemo-rhe-ol-ogy\0he-pat-ic\0he-pat-ica\0her-maph-ro-dite\0her-maph-ro-dit-ic\0"
+    "her-mit-ian\0he-roes\0hexa-dec-i-mal\0hibbs\0hip-po-po-ta-mus\0hoef-ler\0"
+    "hoek-water\0hok-kai-do\0holo-deck\0holo-decks\0ho-lo-no-my\0ho-meo-mor-phic\0"
+    "ho-meo-mor-phism\0ho-meo-sta-sis\0ho-meo-stat-ic\0ho-meo-stat-ics\0ho-mo-thetic\0horse-rad-ish\0"
+    "hot-bed\0hot-beds\0hounds-teeth\0hounds-tooth\0huber\0hy-dro-ther-mal\0"
+    "hy-per-elas-tic-ity\0hy-phen-a-tion\0hy-phen-a-tions\0hy-po-elas-tic-ity\0hy-po-thal-a-mus\0ico-nog-ra-pher\0"
+    "ico-nog-ra-phers\0icon-o-graph-ic\0ico-nog-ra-phy\0ideals\0ideo-graphs\0idio-syn-cra-sies\0"
+    "idio-syn-crasy\0idio-syn-cratic\0idio-syn-crat-i-cal-ly\0ig-nit-er\0ig-nit-ers\0ig-ni-tor\0"
+    "ignore-spaces\0il-li-quid\0il-li-quid-ity\0image-magick\0im-mu-ni-za-tion\0im-mu-no-mod-u-la-to-ry\0"
+    "im-ped-ance\0im-ped-ances\0in-du-bi-ta-ble\0in-fin-ite-ly\0in-fin-i-tes-i-mal\0in-fra-struc-ture\0"
+    "in-fra-struc-tures\0input-enc\0in-stall-er\0in-stall-ers\0in-teg-rity\0in-ter-dis-ci-pli-nary\0"
+    "in-ter-ga-lac-tic\0in-ter-view-ee\0in-ter-view-ees\0in-utile\0in-util-i-ty\0ir-ra-tio-nal\0"
+    "ir-re-duc-ible\0ir-re-duc-ibly\0ir-rev-o-ca-ble\0iso-geo-met-ric\0iso-geo-met-rics\0iso-ther-mal\0"
+    "iso-trop-ic\0isot-ropy\0itin-er-ar-ies\0itin-er-ary\0jac-kow-ski\0jan-u-ary\0"
+    "ja-pa-nese\0java-script\0je-re-mi-ads\0ji-suan\0jung-ian\0kad-om-tsev\0"
+    "kan-sas\0karls-ruhe\0keynes-ian\0key-note\0key-notes\0key-stroke\0"
+    "key-strokes\0kiln-ing\0kilo-nodes\0kor-te-weg\0krishna\0krish-na-ism\0"
+    "krish-nan\0kron-ecker\0lac-i-est\0lam-en-ta-ble\0lan-cas-ter\0land-scap-er\0"
+    "land-scap-ers\0lar-ce-n\0lar-ce-nies\0lar-ce-nist\0lar-ce-ny\0leaf-hop-per\0"
+    "leaf-hop-pers\0leaf-let\0leaf-lets\0le-gendre\0leices-ter\0let-ter-spaced\0"
+    "let-ter-spaces\0let-ter-spac-ing\0leu-ko-cyte\0leu-ko-cytes\0leu-ko-triene\0leu-ko-trienes\0"
+    "life-span\0life-spans\0life-style\0life-styles\0lift-off\0light-weight\0"
+    "lim-ou-sines\0line-backer\0line-spacing\0li-on-ess\0lip-schitz\0lip-schitz-ian\0"
+    "li-quid-ity\0lith-o-graphed\0lith-o-graphs\0lo-bot-om-ize\0lo-bot-omy\0loges\0"
+    "loj-ban\0long-est\0look-ahead\0lo-quac-ity\0lou-i-si-ana\0love-struck\0"
+    "lucas\0macbeth\0mac-os\0macro-eco-nomic\0macro-eco-nomics\0macro-econ-omy\0"
+    "ma-gel-lan\0make-in-dex\0mal-a-prop-ism\0mal-a-prop-isms\0ma-la-ya-lam\0man-ches-ter\0"
+    "man-slaugh-ter\0man-u-script\0man-u-scripts\0mar-gin-al\0mar-kov-ian\0markt-ober-dorf\0"
+    "mass-a-chu-setts\0math-e-ma-ti-cian\0math-e-ma-ti-cians\0mattes\0max-well\0med-ic-aid\0"
+    "medi-ocre\0medi-oc-ri-ties\0mega-fau-na\0mega-fau-nal\0mega-lith\0mega-liths\0"
+    "mega-nodes\0meta-bol-ic\0me-tab-o-lism\0me-tab-o-lisms\0me-tab-o-lite\0me-tab-o-lites\0"
+    "meta-form\0meta-forms\0meta-lan-guage\0meta-lan-guages\0meta-phor\0meta-phor-i-cal\0"
+    "meta-phor-i-cal-ly\0meta-phors\0meta-sta-bil-ity\0meta-stable\0meta-table\0meta-tables\0"
+    "metem-psy-cho-sis\0meth-am-phet-a-mine\0meth-ane\0meth-od\0meth-od-ism\0meth-od-ist\0"
+    "meth-yl-am-mo-nium\0meth-yl-ate\0meth-yl-ated\0meth-yl-a-tion\0meth-yl-ene\0me-trop-o-lis\0"
+    "me-trop-o-lises\0met-ro-pol-i-tan\0met-ro-pol-i-tans\0micro-eco-nomic\0micro-eco-nomics\0micro-econ-omy\0"
+    "micro-en-ter-prise\0micro-en-ter-prises\0mi-cro-fiche\0mi-cro-fiches\0micro-organ-ism\0micro-organ-isms\0"
+    "mi-cro-soft\0mi-cro-struc-ture\0mid-after-noon\0mill-age\0mil-li-liter\0mimeo-graphed\0"
+    "mimeo-graphs\0mim-ic-ries\0mine-sweeper\0mine-sweepers\0min-is\0mini-sym-po-sia\0"
+    "mini-sym-po-sium\0min-kow-ski\0min-ne-ap-o-lis\0min-ne-sota\0mi-nut-er\0mi-nut-est\0"
+    "mis-chie-vous-ly\0mi-sers\0mi-sog-a-my\0mne-mon-ic\0mne-mon-ics\0mod-el-ling\0"
+    "mo-lec-u-lar\0mol-e-cule\0mol-e-cules\0mon-archs\0money-len-der\0money-len-ders\0"
+    "mono-chrome\0mono-en-er-getic\0mon-oid\0mon-oph-thong\0mon-oph-thongs\0mono-pole\0"
+    "mono-poles\0mo-nop-oly\0mono-space\0mono-spaced\0mono-spacing\0mono-spline\0"
+    "mono-splines\0mono-strofic\0mo-not-o-nies\0mo-not-o-nous\0mont-real\0mo-ron-ism\0"
+    "mos-cow\0mos-qui-to\0mos-qui-toes\0mos-qui-tos\0mud-room\0mud-rooms\0"
+    "mul-ti-fac-eted\0mul-ti-plic-able\0mul-ti-plic-ably\0multi-user\0nach-rich-ten\0name-space\0"
+    "name-spaces\0nash-ville\0neo-fields\0neo-nazi\0neo-nazis\0neph-ews\0"
+    "neph-rite\0neph-ritic\0net-bsd\0net-scape\0new-est\0news-let-ter\0"
+    "news-let-ters\0nietz-sche\0nij-me-gen\0nil-po-tent\0nitro-meth-ane\0node-list\0"
+    "node-lists\0noe-ther-ian\0no-name\0non-ar-ith-met-ic\0non-emer-gency\0non-equi-vari-ance\0"
+    "none-the-less\0non-euclid-ean\0non-iso-mor-phic\0non-pseudo-com-pact\0non-smooth\0non-uni-form\0"
+    "non-uni-form-ly\0non-zero\0noord-wijker-hout\0nor-ep-i-neph-rine\0noto-wi-digdo\0not-with-stand-ing\0"
+    "no-vem-ber\0nu-cleo-tide\0nu-cleo-tides\0nut-crack-er\0nut-crack-ers\0oblig-a-tory\0"
+    "obst-feld\0oer-steds\0off-line\0off-load\0off-loaded\0off-loads\0"
+    "oli-gop-ol-ies\0oli-gop-o-list\0oli-gop-o-lists\0oli-gop-oly\0om-ni-pres-ence\0om-ni-pres-ent\0"
+    "ono-mat-o-poe-ia\0ono-mat-o-po-et-ic\0open-bsd\0open-office\0op-er-and\0op-er-ands\0"
+    "orang-utan\0orang-utans\0oreo-pou-los\0or-tho-don-tist\0or-tho-don-tists\0or-tho-ker-a-tol-ogy\0"
+    "ortho-nitro-toluene\0over-view\0over-views\0ox-id-ic\0pad-ding\0page-rank\0"
+    "pain-less-ly\0pala-tino\0pa-ler-mo\0pal-ette\0pal-ettes\0pa-rab-ola\0"
+    "par-a-bol-ic\0pa-rab-o-loid\0para-chute\0para-chutes\0par-a-digm\0par-a-digms\0"
+    "para-di-methyl-benzene\0para-fluoro-toluene\0para-graph-er\0para-le-gal\0par-al-lel-ism\0para-mag-net-ism\0"
+    "para-medic\0para-methyl-anisole\0pa-ram-e-tri-za-tion\0pa-ram-e-trize\0para-mil-i-tary\0para-mount\0"
+    "path-o-gen-ic\0peev-ish\0peev-ish-ness\0pen-al-ties\0pen-al-ty\0pen-ta-gon\0"
+    "pen-ta-gons\0pe-tro-le-um\0pe-trov-ski\0pfaff-ian\0phe-nol-phthalein\0phe-nom-e-non\0"
+    "phenyl-ala-nine\0phil-a-del-phia\0phil-an-thropic\0phi-lat-e-list\0phi-lat-e-lists\0phi-lo-so-phi-sche\0"
+    "pho-neme\0pho-nemes\0pho-ne-mic\0phos-phor-ic\0pho-to-graphs\0pho-to-off-set\0"
+    "phtha-lam-ic\0phthal-ate\0phthi-sis\0pic-a-dor\0pic-a-dors\0pipe-line\0"
+    "pipe-lines\0pipe-lin-ing\0pi-ra-nhas\0placa-ble\0plant-hop-per\0plant-hop-pers\0"
+    "pla-teau\0pla-teaus\0pleas-ance\0plug-in\0plug-ins\0poin-care\0"
+    "pol-ter-geist\0poly-an-dr\0poly-an-drous\0poly-an-dry\0poly-dac-tyl\0poly-dac-tyl-lic\0"
+    "poly-ene\0poly-eth-yl-ene\0po-lyg-a-mist\0po-lyg-a-mists\0polyg-on-i-za-tion\0po-lyg-y-n\0"
+    "po-lyg-y-nous\0po-lyg-y-ny\0pol-yp\0po-lyph-o-n\0poly-phon-ic\0po-lyph-o-nous\0"
+    "po-lyph-o-ny\0pol-yps\0poly-styrene\0pome-gran-ate\0poro-elas-tic\0por-ous\0"
+    "por-ta-ble\0post-am-ble\0post-am-bles\0post-hu-mous\0post-script\0post-scripts\0"
+    "pos-tur-al\0po-ten-tial-glei-chung\0po-to-mac\0pre-am-ble\0pre-am-bles\0pre-dict-able\0"
+    "pre-fers\0pre-loaded\0pre-par-ing\0pre-print\0pre-prints\0pre-proces-sor\0"
+    "pre-proces-sors\0pres-by-terian\0pres-by-terians\0present\0pres-ent-ly\0presents\0"
+    "pre-split-ting\0pret-ty-prin-ter\0pret-ty-prin-ting\0pre-wrap\0pre-wrapped\0priest-esses\0"
+    "pro-ce-dur-al\0process\0pro-cur-ance\0prog-e-nies\0prog-e-ny\0pro-gram-mable\0"
+    "pro-hib-i-tive\0pro-hib-i-tive-ly\0project\0projects\0pro-kary-ote\0pro-kary-otes\0"
+    "pro-kary-ot-ic\0prom-i-nent\0pro-mis-cu-ous\0prom-ise\0prom-ises\0prom-is-sory\0"
+    "pro-pel-ler\0pro-pel-lers\0pro-pel-ling\0pro-sciut-to\0pros-ta-glan-din\0pros-ta-glan-dins\0"
+    "pro-style\0pro-styles\0pro-test-er\0pro-test-ers\0pro-tes-tor\0pro-tes-tors\0"
+    "pro-to-lan-guage\0pro-to-typ-al\0prov-ince\0prov-inces\0pro-vin-cial\0pro-virus\0"
+    "pro-viruses\0prow-ess\0pseu-do-dif-fer-en-tial\0pseu-do-fi-nite\0pseu-do-fi-nite-ly\0pseu-do-forces\0"
+    "pseu-dog-ra-pher\0pseu-do-group\0pseu-do-groups\0pseu-do-nym\0pseu-do-nyms\0pseu-do-word\0"
+    "pseu-do-words\0psy-che-del-ic\0psychs\0pu-bes-cence\0pur-ges\0pyong-yang\0"
+    "py-thag-o-ras\0py-thag-o-re-an\0quad-ding\0qua-drat-ic\0qua-drat-ics\0quad-ra-ture\0"
+    "quad-ri-lat-er-al\0quad-ri-lat-er-als\0quad-ri-pleg-ic\0quad-ru-ped\0quad-ru-peds\0quad-ru-pole\0"
+    "quad-ru-poles\0quaint-er\0quaint-est\0qua-si-equiv-a-lence\0qua-si-equiv-a-lences\0qua-si-equiv-a-lent\0"
+    "qua-si-hy-po-nor-mal\0qua-si-rad-i-cal\0qua-si-resid-ual\0qua-si-smooth\0qua-si-sta-tion-ary\0qua-si-topos\0"
+    "qua-si-tri-an-gu-lar\0qua-si-triv-ial\0quin-tes-sence\0quin-tes-sences\0quin-tes-sen-tial\0rab-bit-ry\0"
+    "ra-dha-krish-nan\0ra-di-og-ra-phy\0raff-ish\0raff-ish-ly\0ram-shackle\0raths-kel-ler\0"
+    "rav-en-ous\0ravi-kumar\0re-allo-cate\0re-allo-cated\0re-allo-cates\0re-arrange\0"
+    "re-arranged\0re-arrange-ment\0re-arrange-ments\0re-arranges\0rec-i-proc-i-ties\0rec-i-proc-i-ty\0"
+    "re-cog-ni-zance\0rec-tan-gle\0rec-tan-gles\0rec-tan-gu-lar\0re-di-rect\0re-di-rect-ion\0"
+    "re-duc-ible\0re-echo\0re-edu-cate\0ref-or-ma-tion\0ref-u-gee\0ref-u-gees\0"
+    "reich-lin\0re-imple-ment\0re-imple-men-ta-tion\0re-imple-mented\0re-imple-ments\0ren-ais-sance\0"
+    "re-phrase\0re-phrased\0re-phrases\0re-po-si-tion\0re-po-si-tions\0re-print\0"
+    "re-print-ed\0re-prints\0re-stor-able\0ret-ri-bu-tion\0retro-fit\0retro-fit-ted\0"
+    "re-us-able\0re-use\0re-wire\0re-wrap\0re-wrapped\0re-write\0"
+    "rhi-noc-er-os\0rie-mann-ian\0right-eous\0right-eous-ness\0ring-leader\0ring-leaders\0"
+    "ro-bot\0ro-botic\0ro-bot-ics\0ro-bots\0roof-top\0roof-tops\0"
+    "round-table\0round-tables\0ryd-berg\0sales-clerk\0sales-clerks\0sales-woman\0"
+    "sales-women\0sa-lient\0sal-mo-nel-la\0sal-ta-tion\0sar-sa-par-il-la\0sat-el-lite\0"
+    "sat-el-lites\0sauer-kraut\0scat-o-log-i-cal\0scene-shift-er\0scene-shift-ing\0sched-ul-ing\0"
+    "schim-mel-pfen-nig\0schiz-o-phrenic\0schnau-zer\0school-child\0school-child-ren\0school-teacher\0"
+    "school-teach-ers\0schot-ti-sche\0schro-din-ger\0schwa-ba-cher\0schwarz-schild\0schweid-nitz\0"
+    "schwert\0scru-ti-ny\0scyth-ing\0sec-re-tar-iat\0sec-re-tar-iats\0sell-er\0"
+    "sell-ers\0sem-a-phore\0sem-a-phores\0se-mes-ter\0semi-def-i-nite\0semi-di-rect\0"
+    "semi-ho-mo-thet-ic\0semi-ring\0semi-rings\0semi-sim-ple\0semi-skilled\0sem-itic\0"
+    "sep-tem-ber\0ser-geant\0ser-geants\0sero-epi-de-mi-o-log-i-cal\0ser-vo-me-chan-i-cal\0ser-vo-mech-a-nism\0"
+    "ser-vo-mech-a-nisms\0ses-qui-pe-da-lian\0set-up\0set-ups\0se-vere-ly\0shap-able\0"
+    "shape-able\0shoe-string\0shoe-strings\0shop-lift-er\0shop-lift-ing\0shore-ditch\0"
+    "show-hy-phens\0shu-xue\0side-step\0side-steps\0side-swipe\0sign-age\0"
+    "single-space\0single-spaced\0single-spacing\0skoup\0sky-scraper\0sky-scrapers\0"
+    "sln-uni-code\0smoke-stack\0smoke-stacks\0snor-kel-ing\0so-le-noid\0so-le-noids\0"
+    "solute\0solutes\0sov-er-eign\0sov-er-eigns\0spa-ces\0spe-cious\0"
+    "spell-er\0spell-ers\0spell-ing\0spe-lunk-er\0spend-thrift\0spher-oid\0"
+    "spher-oid-al\0spher-oids\0sphin-ges\0spic-i-ly\0spin-or\0spin-ors\0"
+    "spokes-man\0spokes-per-son\0spokes-per-sons\0spokes-woman\0spokes-women\0spor-tive-ly\0"
+    "sports-cast\0sports-cast-er\0sports-wear\0sports-writer\0sports-writers\0spright-lier\0"
+    "squea-mish\0stand-alone\0star-tling\0star-tling-ly\0sta-tis-tics\0stealth-ily\0"
+    "steeple-chase\0stereo-graph-ic\0sto-chas-tic\0stokes-sche\0strange-ness\0strap-hanger\0"
+    "strat-a-gem\0strat-a-gems\0stretch-i-er\0strip-tease\0strong-est\0strong-hold\0"
+    "stu-pid-er\0stu-pid-est\0stutt-gart\0sub-dif-fer-en-tial\0sub-ex-pres-sion\0sub-ex-pres-sions\0"
+    "sub-node\0sub-nodes\0sub-scrib-er\0sub-scrib-ers\0sub-tables\0sum-ma-ble\0"
+    "super-deri-va-tion\0super-deri-va-tions\0super-ego\0super-egos\0su-prem-a-cist\0su-prem-a-cists\0"
+    "sur-ge-ries\0sur-gery\0sur-ges\0sur-veil-lance\0sus-que-han-na\0swim-ming-ly\0"
+    "symp-to-matic\0syn-chro-mesh\0syn-chro-nous\0syn-chro-tron\0ta-ble\0taff-rail\0"
+    "take-over\0take-overs\0talk-a-tive\0ta-pes-tries\0ta-pes-try\0tar-pau-lin\0"
+    "tar-pau-lins\0tau-ber-ian\0tech-ni-sche\0te-leg-ra-pher\0te-leg-ra-phers\0tele-ki-net-ic\0"
+    "tele-ki-net-ics\0tele-ro-bot-ics\0tell-er\0tell-ers\0tem-po-rar-ily\0ten-nes-see\0"
+    "ten-ure\0tera-nodes\0test-bed\0tetra-butyl-ammo-nium\0text-height\0text-length\0"
+    "text-width\0thal-a-mus\0ther-mo-elas-tic\0thiruv-ananda-puram\0time-stamp\0time-stamps\0"
+    "tol-ches-ter\0to-ma-szew-ski\0tool-kit\0tool-kits\0topo-graph-i-cal\0topo-iso-mer-ase\0"
+    "topo-iso-mer-ases\0toques\0toyo-ta\0trai-tor-ous\0trans-ceiver\0trans-ceivers\0"
+    "trans-gress\0trans-par-en-cies\0trans-par-en-cy\0trans-ver-sal\0trans-ver-sals\0trans-ves-tite\0"
+    "trans-ves-tites\0tra-vers-a-ble\0tra-ver-sal\0tra-ver-sals\0treach-eries\0tribes-man\0"
+    "tri-ethyl-amine\0trip-let\0trip-lets\0tri-plex\0tri-plex-es\0trou-ba-dour\0"
+    "tur-key\0tur-keys\0turn-around\0turn-arounds\0typ-al\0ty-po-graphique\0"
+    "ukrain-ian\0un-at-tached\0un-err-ing-ly\0un-friend-li-er\0un-friend-ly\0un-in-stan-ti-at-ed\0"
+    "vaguer\0vaude-ville\0ver-all-ge-mei-nerte\0ver-ei-ni-gung\0ver-tei-lun-gen\0vic-ars\0"
+    "vid-ias-sov\0vieth\0viiith\0viith\0vil-lain-ess\0vis-ual\0"
+    "vis-ual-ly\0vi-vip-a-rous\0voice-print\0vspace\0wad-ding\0wahr-schein-lich-keits-theo-rie\0"
+    "wall-flower\0wall-flow-ers\0warm-er\0warm-est\0waste-water\0wave-guide\0"
+    "wave-guides\0wave-let\0wave-lets\0weap-on-ry\0weap-ons\0web-like\0"
+    "web-log\0web-logs\0week-night\0week-nights\0weight-lift-er\0weight-lift-ing\0"
+    "wein-stein\0werk-zeuge\0wer-ner\0wer-ther-ian\0wheel-chair\0wheel-chairs\0"
+    "which-ever\0white-sided\0white-space\0white-spaces\0wide-spread\0will-iam\0"
+    "will-iams\0win-ches-ter\0wing-span\0wing-spans\0wing-spread\0wirt-schaft\0"
+    "wis-sen-schaft-lich\0witch-craft\0wolff-ian\0word-spac-ing\0work-around\0work-arounds\0"
+    "work-horse\0work-horses\0wrap-around\0wrap-arounds\0wretch-ed\0wretch-ed-ly\0"
+    "xviiith\0xviith\0xxiiird\0xxiind\0yes-ter-year\0ying-yong\0"
+    "zea-land\0zeit-schrift\0";
+
+static const uint16_t s_hyph_exception_offsets[HYPH_EXCEPTION_COUNT] = {
+    0, 12, 22, 36, 45, 55, 71, 83, 96, 110, 127, 137,
+    147, 160, 171, 186, 202, 215, 229, 241, 255, 274, 290, 303,
+    315, 328, 343, 359, 373, 390, 400, 411, 421, 431, 442, 456,
+    468, 483, 504, 520, 533, 550, 565, 577, 587, 605, 624, 643,
+    657, 669, 683, 698, 721, 733, 747, 761, 775, 789, 800, 813,
+    827, 839, 852, 869, 884, 899, 916, 925, 935, 947, 959, 972,
+    985, 999, 1010, 1021, 1035, 1049, 1060, 1072, 1085, 1097, 1114, 1132,
+    1144, 1157, 1171, 1186, 1200, 1215, 1230, 1244, 1259, 1280, 1293, 1307,
+    1315, 1324, 1340, 1352, 1365, 1374, 1389, 1401, 1415, 1435, 1448, 1462,
+    1479, 1497, 1515, 1530, 1545, 1560, 1577, 1590, 1604, 1614, 1629, 1642,
+    1653, 1663, 1678, 1692, 1705, 1714, 1723, 1735, 1747, 1760, 1772, 1781,
+    1790, 1800, 1812, 1825, 1831, 1838, 1858, 1879, 1902, 1912, 1931, 1940,
+    1949, 1959, 1969, 1988, 2002, 2017, 2029, 2044, 2057, 2065, 2074, 2083,
+    2093, 2102, 2112, 2120, 2131, 2143, 2156, 2170, 2183, 2197, 2206, 2216,
+    2233, 2241, 2252, 2262, 2273, 2282, 2293, 2301, 2310, 2318, 2327, 2339,
+    2346, 2355, 2363, 2370, 2380, 2391, 2406, 2417, 2432, 2445, 2453, 2462,
+    2474, 2489, 2501, 2512, 2524, 2533, 2543, 2558, 2574, 2590, 2611, 2628,
+    2639, 2651, 2666, 2676, 2688, 2700, 2718, 2730, 2741, 2753, 2771, 2786,
+    2795, 2802, 2815, 2831, 2848, 2862, 2874, 2887, 2899, 2916, 2926, 2936,
+    2948, 2961, 2969, 2978, 2984, 2995, 3007, 3023, 3034, 3043, 3055, 3068,
+    3081, 3098, 3112, 3127, 3144, 3157, 3171, 3184, 3198, 3211, 3223, 3233,
+    3245, 3259, 3280, 3297, 3310, 3324, 3338, 3354, 3368, 3383, 3401, 3420,
+    3433, 3449, 3466, 3477, 3493, 3505, 3514, 3525, 3537, 3548, 3560, 3572,
+    3585, 3597, 3611, 3627, 3638, 3651, 3665, 3675, 3686, 3698, 3715, 3727,
+    3740, 3753, 3766, 3781, 3796, 3812, 3823, 3835, 3853, 3864, 3878, 3893,
+    3907, 3919, 3929, 3940, 3950, 3961, 3972, 3984, 3997, 4011, 4025, 4041,
+    4058, 4071, 4086, 4100, 4111, 4125, 4143, 4162, 4177, 4183, 4197, 4214,
+    4229, 4243, 4258, 4270, 4286, 4303, 4316, 4335, 4345, 4359, 4374, 4385,
+    4395, 4405, 4411, 4423, 4436, 4451, 4468, 4481, 4495, 4509, 4525, 4534,
+    4547, 4561, 4575, 4590, 4607, 4620, 4631, 4641, 4650, 4664, 4676, 4685,
+    4695, 4701, 4714, 4727, 4741, 4752, 4766, 4778, 4788, 4798, 4811, 4823,
+    4835, 4847, 4860, 4872, 4885, 4898, 4913, 4927, 4942, 4952, 4973, 4998,
+    5018, 5038, 5047, 5057, 5071, 5083, 5089, 5095, 5104, 5120, 5140, 5157,
+    5172, 5183, 5198, 5212, 5225, 5243, 5257, 5266, 5276, 5284, 5298, 5309,
+    5321, 5332, 5341, 5357, 5367, 5380, 5390, 5402, 5408, 5417, 5427, 5434,
+    5449, 5461, 5479, 5493, 5504, 5513, 5524, 5534, 5547, 5557, 5568, 5579,
+    5590, 5602, 5615, 5626, 5636, 5649, 5660, 5672, 5687, 5703, 5717, 5731,
+    5745, 5768, 5780, 5792, 5801, 5813, 5826, 5838, 5852, 5867, 5879, 5891,
+    5901, 5912, 5925, 5936, 5947, 5955, 5968, 5978, 5990, 6003, 6015, 6027,
+    6038, 6050, 6062, 6075, 6089, 6102, 6116, 6131, 6144, 6155, 6166, 6174,
+    6183, 6194, 6204, 6216, 6228, 6241, 6256, 6268, 6279, 6291, 6301, 6314,
+    6328, 6339, 6353, 6364, 6371, 6382, 6394, 6408, 6423, 6433, 6444, 6455,
+    6467, 6477, 6488, 6497, 6511, 6523, 6536, 6548, 6561, 6573, 6582, 6595,
+    6608, 6618, 6641, 6665, 6679, 6693, 6708, 6724, 6740, 6750, 6761, 6778,
+    6797, 6809, 6817, 6832, 6838, 6855, 6864, 6875, 6886, 6896, 6907, 6919,
+    6935, 6952, 6967, 6982, 6998, 7011, 7025, 7033, 7042, 7055, 7068, 7074,
+    7090, 7110, 7125, 7141, 7160, 7177, 7193, 7210, 7226, 7241, 7248, 7260,
+    7278, 7293, 7309, 7332, 7342, 7353, 7363, 7377, 7388, 7403, 7416, 7433,
+    7457, 7469, 7482, 7498, 7512, 7531, 7549, 7568, 7578, 7590, 7603, 7615,
+    7638, 7656, 7671, 7687, 7696, 7709, 7723, 7738, 7753, 7769, 7785, 7802,
+    7815, 7827, 7837, 7852, 7864, 7876, 7886, 7897, 7909, 7922, 7930, 7939,
+    7951, 7959, 7970, 7981, 7990, 8000, 8011, 8023, 8032, 8043, 8054, 8062,
+    8075, 8085, 8096, 8106, 8120, 8132, 8145, 8159, 8168, 8180, 8192, 8202,
+    8215, 8229, 8238, 8248, 8258, 8269, 8284, 8299, 8316, 8328, 8341, 8355,
+    8370, 8380, 8391, 8402, 8414, 8423, 8436, 8449, 8461, 8474, 8484, 8495,
+    8510, 8522, 8537, 8551, 8565, 8576, 8582, 8590, 8599, 8610, 8622, 8635,
+    8647, 8653, 8661, 8668, 8684, 8701, 8716, 8727, 8739, 8754, 8770, 8783,
+    8796, 8811, 8824, 8838, 8849, 8861, 8877, 8894, 8912, 8931, 8938, 8947,
+    8958, 8968, 8984, 8996, 9009, 9019, 9030, 9041, 9053, 9067, 9082, 9096,
+    9111, 9121, 9132, 9147, 9163, 9173, 9189, 9208, 9219, 9236, 9248, 9259,
+    9271, 9289, 9309, 9318, 9326, 9338, 9350, 9369, 9381, 9394, 9409, 9421,
+    9435, 9451, 9468, 9486, 9502, 9519, 9534, 9553, 9573, 9586, 9600, 9616,
+    9633, 9645, 9663, 9678, 9687, 9700, 9714, 9727, 9739, 9752, 9766, 9773,
+    9789, 9806, 9818, 9834, 9846, 9856, 9867, 9884, 9892, 9904, 9915, 9927,
+    9939, 9952, 9963, 9975, 9985, 9999, 10014, 10026, 10043, 10051, 10065, 10080,
+    10090, 10101, 10112, 10123, 10135, 10148, 10160, 10173, 10186, 10200, 10214, 10224,
+    10235, 10243, 10254, 10267, 10279, 10288, 10298, 10314, 10331, 10348, 10359, 10373,
+    10384, 10396, 10407, 10418, 10427, 10437, 10446, 10456, 10467, 10475, 10485, 10493,
+    10506, 10520, 10531, 10542, 10554, 10569, 10579, 10590, 10603, 10611, 10629, 10644,
+    10663, 10677, 10692, 10709, 10729, 10740, 10753, 10769, 10778, 10796, 10815, 10829,
+    10848, 10859, 10872, 10886, 10899, 10913, 10926, 10936, 10946, 10955, 10964, 10975,
+    10985, 11000, 11015, 11031, 11043, 11059, 11074, 11091, 11110, 11119, 11131, 11141,
+    11152, 11163, 11175, 11188, 11204, 11221, 11242, 11262, 11272, 11283, 11292, 11301,
+    11311, 11324, 11334, 11344, 11353, 11363, 11374, 11387, 11401, 11412, 11424, 11435,
+    11447, 11470, 11490, 11504, 11516, 11531, 11548, 11559, 11579, 11600, 11615, 11631,
+    11642, 11656, 11665, 11679, 11691, 11701, 11712, 11724, 11737, 11749, 11759, 11777,
+    11791, 11807, 11823, 11839, 11854, 11870, 11889, 11898, 11908, 11919, 11932, 11946,
+    11961, 11974, 11985, 11995, 12005, 12016, 12026, 12037, 12050, 12061, 12071, 12085,
+    12100, 12109, 12119, 12130, 12138, 12147, 12157, 12171, 12182, 12196, 12208, 12221,
+    12238, 12247, 12263, 12277, 12292, 12311, 12322, 12336, 12348, 12355, 12367, 12380,
+    12395, 12408, 12416, 12429, 12443, 12457, 12465, 12476, 12488, 12501, 12514, 12526,
+    12539, 12550, 12573, 12583, 12594, 12606, 12620, 12629, 12640, 12652, 12662, 12673,
+    12688, 12704, 12719, 12735, 12743, 12755, 12764, 12779, 12796, 12814, 12823, 12835,
+    12848, 12862, 12870, 12883, 12895, 12905, 12920, 12935, 12953, 12961, 12970, 12983,
+    12997, 13012, 13024, 13039, 13048, 13058, 13071, 13083, 13096, 13109, 13122, 13139,
+    13157, 13167, 13178, 13190, 13203, 13215, 13228, 13245, 13259, 13269, 13280, 13293,
+    13303, 13315, 13324, 13348, 13364, 13383, 13398, 13415, 13429, 13444, 13456, 13469,
+    13482, 13496, 13511, 13518, 13531, 13539, 13550, 13564, 13580, 13590, 13602, 13615,
+    13628, 13646, 13665, 13681, 13693, 13706, 13719, 13733, 13743, 13754, 13775, 13797,
+    13817, 13838, 13855, 13872, 13886, 13906, 13919, 13940, 13956, 13971, 13987, 14005,
+    14016, 14033, 14049, 14058, 14070, 14082, 14096, 14107, 14118, 14131, 14145, 14159,
+    14170, 14182, 14198, 14215, 14227, 14245, 14261, 14277, 14289, 14302, 14317, 14328,
+    14343, 14355, 14363, 14375, 14390, 14400, 14411, 14421, 14435, 14456, 14472, 14487,
+    14501, 14511, 14522, 14533, 14547, 14562, 14571, 14583, 14593, 14606, 14621, 14631,
+    14645, 14656, 14663, 14671, 14679, 14690, 14699, 14713, 14726, 14737, 14753, 14765,
+    14778, 14785, 14794, 14805, 14813, 14822, 14832, 14844, 14857, 14866, 14878, 14891,
+    14903, 14915, 14924, 14938, 14950, 14967, 14979, 14992, 15004, 15021, 15036, 15052,
+    15065, 15084, 15100, 15111, 15124, 15141, 15156, 15173, 15187, 15201, 15215, 15230,
+    15243, 15251, 15262, 15272, 15287, 15303, 15311, 15320, 15332, 15345, 15356, 15372,
+    15385, 15404, 15414, 15425, 15438, 15451, 15460, 15472, 15482, 15493, 15520, 15541,
+    15560, 15580, 15599, 15606, 15614, 15625, 15635, 15646, 15658, 15671, 15684, 15698,
+    15710, 15724, 15732, 15742, 15753, 15764, 15773, 15786, 15800, 15815, 15821, 15833,
+    15846, 15859, 15871, 15884, 15897, 15908, 15920, 15927, 15935, 15947, 15960, 15968,
+    15978, 15987, 15997, 16007, 16019, 16032, 16042, 16055, 16066, 16076, 16086, 16094,
+    16103, 16114, 16129, 16145, 16158, 16171, 16184, 16196, 16211, 16223, 16237, 16252,
+    16265, 16276, 16288, 16299, 16313, 16326, 16338, 16352, 16368, 16381, 16393, 16406,
+    16419, 16431, 16444, 16457, 16469, 16480, 16492, 16503, 16515, 16526, 16546, 16563,
+    16581, 16590, 16600, 16613, 16627, 16638, 16649, 16668, 16688, 16698, 16709, 16724,
+    16740, 16752, 16761, 16769, 16784, 16799, 16812, 16826, 16840, 16854, 16868, 16875,
+    16885, 16895, 16906, 16918, 16931, 16942, 16954, 16967, 16979, 16992, 17007, 17023,
+    17038, 17054, 17070, 17078, 17087, 17102, 17114, 17122, 17133, 17142, 17164, 17176,
+    17188, 17199, 17210, 17227, 17247, 17258, 17270, 17283, 17298, 17307, 17317, 17334,
+    17351, 17369, 17376, 17384, 17397, 17410, 17424, 17436, 17454, 17470, 17484, 17499,
+    17514, 17530, 17545, 17557, 17570, 17583, 17594, 17610, 17619, 17629, 17638, 17650,
+    17663, 17671, 17680, 17692, 17705, 17712, 17728, 17739, 17752, 17766, 17782, 17795,
+    17815, 17822, 17834, 17855, 17870, 17886, 17894, 17906, 17912, 17919, 17925, 17938,
+    17946, 17957, 17971, 17983, 17990, 17999, 18031, 18043, 18057, 18065, 18074, 18086,
+    18097, 18109, 18118, 18128, 18139, 18148, 18157, 18165, 18174, 18185, 18197, 18212,
+    18228, 18239, 18250, 18258, 18271, 18283, 18296, 18307, 18319, 18331, 18344, 18356,
+    18365, 18375, 18388, 18398, 18409, 18421, 18433, 18453, 18465, 18475, 18489, 18501,
+    18514, 18525, 18537, 18549, 18562, 18572, 18585, 18593, 18600, 18608, 18615, 18628,
+    18638, 18647,
+};
+
+#endif // LINE_BREAK_TABLES_H
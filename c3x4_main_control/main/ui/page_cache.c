@@ -0,0 +1,357 @@
+/**
+ * @file page_cache.c
+ * @brief 阅读器页面位图缓存实现
+ *
+ * 压缩格式（逐行编码，行与行之间不跨越）：
+ *   0x00..0x7F  后跟 n+1 个原样字节
+ *   0x80..0xFF  下一个字节重复 (n & 0x7F) + 3 次
+ * 竖屏文本页每行 95 字节，空白行压缩为 2 字节，整页通常在 6~15 KB
+ */
+
+#include "page_cache.h"
+#include "lvgl_driver.h"
+#include "heap_stats.h"
+#include "mem_pressure.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "PAGE_CACHE";
+
+#define RLE_MIN_RUN     3
+#define RLE_MAX_RUN     (0x7F + RLE_MIN_RUN)
+#define RLE_MAX_LITERAL 0x80
+
+// 缓存位图总预算：已缓存的加上堆余量的 1/PAGE_CACHE_HEAP_SHARE，不超过 PAGE_CACHE_BUDGET_MAX。
+// 预渲染分配 48 KB 捕获缓冲区后也至少保留 HEAP_STATS_RESERVE 的空闲堆
+#define PAGE_CACHE_BUDGET_MAX   (48 * 1024)
+#define PAGE_CACHE_HEAP_SHARE   2
+
+// 访问 framebuffer 的等锁上限
+#define PAGE_CACHE_LOCK_MS 100
+
+typedef struct {
+    page_cache_page_t page;
+    uint8_t *data;        // 压缩位图，NULL 表示空槽
+    uint32_t size;
+} page_cache_slot_t;
+
+static page_cache_slot_t s_slots[PAGE_CACHE_SLOTS];
+static lv_area_t s_region;
+static lvgl_fb_region_t s_fb_region;
+static bool s_ready = false;
+static uint32_t s_used = 0;
+static int s_current_page = 0;
+static uint8_t *s_capture_buf = NULL;
+
+// 编码一行；out 为 NULL 时只计算长度
+static uint32_t rle_encode_row(const uint8_t *src, uint32_t n, uint8_t *out) {
+    uint32_t len = 0;
+    uint32_t i = 0;
+
+    while (i < n) {
+        // 当前位置开始的重复长度
+        uint32_t run = 1;
+        while (i + run < n && run < RLE_MAX_RUN && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= RLE_MIN_RUN) {
+            if (out != NULL) {
+                out[len] = (uint8_t)(0x80 | (run - RLE_MIN_RUN));
+                out[len + 1] = src[i];
+            }
+            len += 2;
+            i += run;
+            continue;
+        }
+
+        // 原样字节：直到出现足够长的重复
+        uint32_t lit = 0;
+        while (i + lit < n && lit < RLE_MAX_LITERAL) {
+            const uint32_t j = i + lit;
+            if (j + 2 < n && src[j] == src[j + 1] && src[j] == src[j + 2]) {
+                break;
+            }
+            lit++;
+        }
+        if (out != NULL) {
+            out[len] = (uint8_t)(lit - 1);
+            memcpy(&out[len + 1], &src[i], lit);
+        }
+        len += 1 + lit;
+        i += lit;
+    }
+    return len;
+}
+
+// 解码一行；数据损坏时返回 0
+static uint32_t rle_decode_row(const uint8_t *src, uint32_t avail, uint8_t *dst, uint32_t n) {
+    uint32_t pos = 0;
+    uint32_t used = 0;
+
+    while (pos < n) {
+        if (used >= avail) {
+            return 0;
+        }
+        const uint8_t h = src[used++];
+        if (h & 0x80) {
+            const uint32_t run = (uint32_t)(h & 0x7F) + RLE_MIN_RUN;
+            if (used >= avail || pos + run > n) {
+                return 0;
+            }
+            memset(&dst[pos], src[used++], run);
+            pos += run;
+        } else {
+            const uint32_t lit = (uint32_t)h + 1;
+            if (used + lit > avail || pos + lit > n) {
+                return 0;
+            }
+            memcpy(&dst[pos], &src[used], lit);
+            used += lit;
+            pos += lit;
+        }
+    }
+    return used;
+}
+
+static void slot_free(page_cache_slot_t *slot) {
+    if (slot->data != NULL) {
+        s_used -= slot->size;
+        heap_stats_free(HEAP_TAG_PAGE, slot->data);
+    }
+    memset(slot, 0, sizeof(*slot));
+}
+
+static int page_distance(int page) {
+    return abs(page - s_current_page);
+}
+
+// 取一个空槽；没有空槽时淘汰离当前页最远、且比新页更远的页面
+static page_cache_slot_t *slot_acquire(int page) {
+    page_cache_slot_t *victim = NULL;
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        if (s_slots[i].data == NULL) {
+            return &s_slots[i];
+        }
+        if (victim == NULL || page_distance(s_slots[i].page.page) > page_distance(victim->page.page)) {
+            victim = &s_slots[i];
+        }
+    }
+    if (page_distance(victim->page.page) < page_distance(page)) {
+        return NULL;
+    }
+    slot_free(victim);
+    return victim;
+}
+
+// 从整帧缓冲区压缩页面区域
+static bool store_from(const uint8_t *fb, const page_cache_page_t *page) {
+    const uint8_t *base = fb + s_fb_region.offset;
+
+    uint32_t size = 0;
+    for (uint16_t r = 0; r < s_fb_region.rows; r++) {
+        size += rle_encode_row(base + (uint32_t)r * s_fb_region.stride, s_fb_region.row_bytes, NULL);
+    }
+
+    page_cache_slot_t *slot = slot_acquire(page->page);
+    if (slot == NULL) {
+        return false;
+    }
+    // 超出预算时淘汰其余最远页面（预算随其它子系统的占用变化）
+    size_t budget = heap_stats_cache_budget(s_used, PAGE_CACHE_HEAP_SHARE);
+    if (budget > PAGE_CACHE_BUDGET_MAX) {
+        budget = PAGE_CACHE_BUDGET_MAX;
+    }
+    while (s_used + size > budget) {
+        page_cache_slot_t *far = NULL;
+        for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+            if (s_slots[i].data != NULL &&
+                (far == NULL || page_distance(s_slots[i].page.page) > page_distance(far->page.page))) {
+                far = &s_slots[i];
+            }
+        }
+        if (far == NULL) {
+            ESP_LOGW(TAG, "Page %d too large to cache (%u bytes)", page->page, (unsigned)size);
+            return false;
+        }
+        slot_free(far);
+    }
+
+    uint8_t *data = heap_stats_malloc(HEAP_TAG_PAGE, size);
+    if (data == NULL) {
+        ESP_LOGW(TAG, "No memory for page %d (%u bytes)", page->page, (unsigned)size);
+        return false;
+    }
+
+    uint32_t len = 0;
+    for (uint16_t r = 0; r < s_fb_region.rows; r++) {
+        len += rle_encode_row(base + (uint32_t)r * s_fb_region.stride, s_fb_region.row_bytes,
+                              data + len);
+    }
+
+    slot->page = *page;
+    slot->data = data;
+    slot->size = size;
+    s_used += size;
+    ESP_LOGD(TAG, "Cached page %d: %u bytes (total %u)", page->page, (unsigned)size,
+             (unsigned)s_used);
+    return true;
+}
+
+static page_cache_slot_t *slot_of(const page_cache_page_t *page) {
+    if (page == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        if (s_slots[i].data != NULL && &s_slots[i].page == page) {
+            return &s_slots[i];
+        }
+    }
+    return NULL;
+}
+
+// 内存压力回调：只留当前页（page_cache_show 经 slot_of 确认槽仍有数据，可以同步调用）
+static bool page_cache_shrink(size_t want, void *arg) {
+    (void)want;
+    (void)arg;
+    bool released = false;
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        if (s_slots[i].data != NULL && s_slots[i].page.page != s_current_page) {
+            slot_free(&s_slots[i]);
+            released = true;
+        }
+    }
+    return released;
+}
+
+bool page_cache_init(const lv_area_t *region) {
+    page_cache_deinit();
+    if (region == NULL || !lvgl_fb_get_region(region, &s_fb_region)) {
+        return false;
+    }
+    s_region = *region;
+    s_ready = true;
+    mem_pressure_register("page_cache", MEM_PRESSURE_PRIO_SPECULATIVE, HEAP_TAG_PAGE,
+                          MEM_PRESSURE_SYNC, page_cache_shrink, NULL);
+    return true;
+}
+
+void page_cache_deinit(void) {
+    mem_pressure_unregister(page_cache_shrink, NULL);
+    page_cache_clear();
+    if (s_capture_buf != NULL) {
+        lvgl_capture_end();
+        heap_stats_free(HEAP_TAG_PAGE, s_capture_buf);
+        s_capture_buf = NULL;
+    }
+    s_ready = false;
+    s_current_page = 0;
+}
+
+void page_cache_clear(void) {
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        slot_free(&s_slots[i]);
+    }
+    s_used = 0;
+}
+
+void page_cache_set_current(int page) {
+    s_current_page = page;
+}
+
+const page_cache_page_t *page_cache_find(long start) {
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        if (s_slots[i].data != NULL && s_slots[i].page.start == start) {
+            return &s_slots[i].page;
+        }
+    }
+    return NULL;
+}
+
+const page_cache_page_t *page_cache_find_before(long start) {
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+        if (s_slots[i].data != NULL && s_slots[i].page.end == start) {
+            return &s_slots[i].page;
+        }
+    }
+    return NULL;
+}
+
+bool page_cache_store_displayed(const page_cache_page_t *page) {
+    if (!s_ready || page == NULL) {
+        return false;
+    }
+    if (page_cache_find(page->start) != NULL) {
+        return true;
+    }
+
+    const uint8_t *fb = lvgl_fb_read_begin(PAGE_CACHE_LOCK_MS);
+    if (fb == NULL) {
+        return false;
+    }
+    const bool ok = store_from(fb, page);
+    lvgl_fb_read_end();
+    return ok;
+}
+
+bool page_cache_capture_begin(void) {
+    if (!s_ready || s_capture_buf != NULL) {
+        return false;
+    }
+    const size_t size = lvgl_fb_size();
+    if (heap_stats_cache_budget(0, 1) < size) {
+        return false;
+    }
+    s_capture_buf = heap_stats_malloc(HEAP_TAG_PAGE, size);
+    if (s_capture_buf == NULL) {
+        return false;
+    }
+    if (!lvgl_capture_begin(s_capture_buf)) {
+        heap_stats_free(HEAP_TAG_PAGE, s_capture_buf);
+        s_capture_buf = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool page_cache_capture_end(const page_cache_page_t *page) {
+    if (s_capture_buf == NULL) {
+        return false;
+    }
+    lvgl_capture_end();
+    const bool ok = page != NULL && store_from(s_capture_buf, page);
+    heap_stats_free(HEAP_TAG_PAGE, s_capture_buf);
+    s_capture_buf = NULL;
+    return ok;
+}
+
+bool page_cache_show(const page_cache_page_t *page) {
+    page_cache_slot_t *slot = slot_of(page);
+    if (!s_ready || slot == NULL) {
+        return false;
+    }
+
+    uint8_t *fb = lvgl_fb_write_begin(PAGE_CACHE_LOCK_MS);
+    if (fb == NULL) {
+        return false;
+    }
+
+    uint8_t *base = fb + s_fb_region.offset;
+    uint32_t used = 0;
+    bool ok = true;
+    for (uint16_t r = 0; r < s_fb_region.rows && ok; r++) {
+        const uint32_t n = rle_decode_row(slot->data + used, slot->size - used,
+                                          base + (uint32_t)r * s_fb_region.stride,
+                                          s_fb_region.row_bytes);
+        ok = n > 0;
+        used += n;
+    }
+    // 写回失败时区域内容不完整，仍记录脏区，由调用方重绘覆盖
+    lvgl_fb_write_end(&s_region);
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Corrupt cached page %d, dropping", slot->page.page);
+        slot_free(slot);
+    }
+    return ok;
+}
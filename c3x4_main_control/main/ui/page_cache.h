@@ -0,0 +1,99 @@
+/**
+ * @file page_cache.h
+ * @brief 阅读器页面位图缓存 - 相邻页面以压缩 1bpp 位图保存，翻页时直接写回 framebuffer
+ *
+ * 缓存的是页面区域在 framebuffer 中的物理字节（按行 RLE 压缩，文本页大部分是白色长串）。
+ * 当前页在显示后从 framebuffer 保存，下一页在空闲时离屏预渲染（lvgl_capture_begin）。
+ * 命中时翻页只需解压写回 + 局刷，LVGL 不再重新排版和光栅化整页文本
+ */
+
+#ifndef PAGE_CACHE_H
+#define PAGE_CACHE_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 缓存页数（当前页与前后各一页）
+#define PAGE_CACHE_SLOTS 3
+
+// 缓存页的身份：文件位置区间与页码
+typedef struct {
+    long start;       // 页首文件位置
+    long end;         // 下一页的页首文件位置
+    int page;         // 页码
+} page_cache_page_t;
+
+/**
+ * @brief 初始化页面缓存
+ * @param region 页面区域（逻辑坐标，缓存与写回都只覆盖该区域）
+ * @return true 成功，false 区域无效
+ */
+bool page_cache_init(const lv_area_t *region);
+
+/**
+ * @brief 释放全部缓存位图与捕获缓冲区
+ */
+void page_cache_deinit(void);
+
+/**
+ * @brief 丢弃全部缓存位图（字体、排版改变后调用）
+ */
+void page_cache_clear(void);
+
+/**
+ * @brief 查找以 start 开头的缓存页
+ * @return 缓存页信息；NULL 表示未命中
+ */
+const page_cache_page_t *page_cache_find(long start);
+
+/**
+ * @brief 查找紧接在 start 之前的缓存页（其 end 等于 start）
+ * @return 缓存页信息；NULL 表示未命中
+ */
+const page_cache_page_t *page_cache_find_before(long start);
+
+/**
+ * @brief 从 framebuffer 保存当前显示的页面
+ * @param page 页面身份
+ * @return true 已缓存（包括原本就在缓存中）
+ */
+bool page_cache_store_displayed(const page_cache_page_t *page);
+
+/**
+ * @brief 开始离屏预渲染：分配整帧捕获缓冲区并重定向 LVGL 渲染
+ *
+ * 之后调用方修改控件、使页面区域失效并 lv_refr_now，再调用 page_cache_capture_end
+ *
+ * @return true 已进入捕获；false 内存不足或当前不能捕获
+ */
+bool page_cache_capture_begin(void);
+
+/**
+ * @brief 结束离屏预渲染，把捕获到的页面压缩入缓存
+ * @param page 预渲染的页面身份；NULL 表示放弃本次捕获
+ * @return true 已缓存
+ */
+bool page_cache_capture_end(const page_cache_page_t *page);
+
+/**
+ * @brief 把缓存页写回 framebuffer 并记录页面区域为脏区（在 LVGL 任务中调用）
+ * @param page page_cache_find* 返回的缓存页
+ * @return true 写回成功；false 调用方应按普通方式重绘
+ */
+bool page_cache_show(const page_cache_page_t *page);
+
+/**
+ * @brief 设置当前显示的页码（淘汰时保留离当前页最近的页面）
+ */
+void page_cache_set_current(int page);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PAGE_CACHE_H
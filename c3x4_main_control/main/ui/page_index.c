@@ -0,0 +1,315 @@
+/**
+ * @file page_index.c
+ * @brief TXT 分页索引实现
+ */
+
+#include "page_index.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "PAGE_INDEX";
+
+#define PAGE_INDEX_MAGIC      0x31494750u  // "PGI1"
+#define PAGE_INDEX_PERIOD_MS  40           // 构建定时器周期
+#define PAGE_INDEX_SLICE_MS   15           // 每次最多占用 LVGL 任务的时长
+#define PAGE_INDEX_SAVE_EVERY 256          // 构建期间每新增多少页保存一次
+#define PAGE_INDEX_MAX_PAGES  65535
+#define PAGE_INDEX_ESTIMATE_MIN 16         // 至少索引这么多页才外推页码
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t key;          // 书籍与排版指纹
+    uint32_t file_size;
+    uint32_t page_count;
+    uint8_t complete;
+    uint8_t reserved[3];
+} page_index_header_t;
+
+static struct {
+    bool open;
+    page_index_config_t cfg;
+    uint32_t key;
+    char path[64];
+    uint32_t *starts;      // starts[i] = 第 i+1 页起点
+    uint32_t count;
+    uint32_t capacity;
+    bool complete;
+    uint32_t saved_count;  // 已写入文件的页数
+    lv_timer_t *timer;
+} s_index;
+
+uint32_t page_index_hash(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    if (hash == 0) {
+        hash = 2166136261u;
+    }
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool starts_append(uint32_t start) {
+    if (s_index.count >= PAGE_INDEX_MAX_PAGES) {
+        return false;
+    }
+    if (s_index.count == s_index.capacity) {
+        const uint32_t cap = s_index.capacity ? s_index.capacity * 2 : 256;
+        uint32_t *grown = realloc(s_index.starts, cap * sizeof(uint32_t));
+        if (grown == NULL) {
+            ESP_LOGW(TAG, "No memory for %u pages", (unsigned)cap);
+            return false;
+        }
+        s_index.starts = grown;
+        s_index.capacity = cap;
+    }
+    s_index.starts[s_index.count++] = start;
+    return true;
+}
+
+static size_t varint_put(uint8_t *out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+static bool index_save(void) {
+    if (s_index.count == 0 || s_index.count == s_index.saved_count) {
+        return true;
+    }
+    // 写入失败也不在每个构建周期重试，等新增页面或完成时再写
+    s_index.saved_count = s_index.count;
+    mkdir(PAGE_INDEX_DIR, 0775);
+
+    FILE *f = fopen(s_index.path, "wb");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot write %s (errno=%d)", s_index.path, errno);
+        return false;
+    }
+
+    const page_index_header_t hdr = {
+        .magic = PAGE_INDEX_MAGIC,
+        .key = s_index.key,
+        .file_size = (uint32_t)s_index.cfg.file_size,
+        .page_count = s_index.count,
+        .complete = s_index.complete ? 1 : 0,
+    };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+
+    uint8_t buf[256];
+    size_t used = 0;
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < s_index.count && ok; i++) {
+        used += varint_put(&buf[used], s_index.starts[i] - prev);
+        prev = s_index.starts[i];
+        if (used > sizeof(buf) - 5) {
+            ok = fwrite(buf, 1, used, f) == used;
+            used = 0;
+        }
+    }
+    if (ok && used > 0) {
+        ok = fwrite(buf, 1, used, f) == used;
+    }
+    fclose(f);
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Failed to write %s", s_index.path);
+        remove(s_index.path);
+        return false;
+    }
+    ESP_LOGI(TAG, "Saved %u pages%s to %s", (unsigned)s_index.count,
+             s_index.complete ? " (complete)" : "", s_index.path);
+    return true;
+}
+
+static bool index_load(void) {
+    FILE *f = fopen(s_index.path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+
+    page_index_header_t hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == PAGE_INDEX_MAGIC &&
+              hdr.key == s_index.key && hdr.file_size == (uint32_t)s_index.cfg.file_size &&
+              hdr.page_count <= PAGE_INDEX_MAX_PAGES;
+
+    uint8_t buf[256];
+    uint32_t prev = 0;
+    uint32_t value = 0;
+    unsigned shift = 0;
+    while (ok && s_index.count < hdr.page_count) {
+        const size_t n = fread(buf, 1, sizeof(buf), f);
+        if (n == 0) {
+            ok = false;
+            break;
+        }
+        for (size_t i = 0; i < n && ok && s_index.count < hdr.page_count; i++) {
+            value |= (uint32_t)(buf[i] & 0x7F) << shift;
+            if (buf[i] & 0x80) {
+                shift += 7;
+                ok = shift < 32;
+                continue;
+            }
+            prev += value;
+            ok = prev < (uint32_t)s_index.cfg.file_size && starts_append(prev);
+            value = 0;
+            shift = 0;
+        }
+    }
+    fclose(f);
+
+    if (!ok) {
+        ESP_LOGW(TAG, "Discarding stale or corrupt index %s", s_index.path);
+        s_index.count = 0;
+        return false;
+    }
+    s_index.complete = hdr.complete != 0;
+    s_index.saved_count = s_index.count;
+    ESP_LOGI(TAG, "Loaded %u pages%s from %s", (unsigned)s_index.count,
+             s_index.complete ? " (complete)" : "", s_index.path);
+    return true;
+}
+
+// 分片构建：每次最多占用 PAGE_INDEX_SLICE_MS，其余时间留给按键与渲染
+static void build_timer_cb(lv_timer_t *timer) {
+    const uint32_t t0 = lv_tick_get();
+
+    while (!s_index.complete && lv_tick_elaps(t0) < PAGE_INDEX_SLICE_MS) {
+        const long start = (long)s_index.starts[s_index.count - 1];
+        const long next = s_index.cfg.layout(start, s_index.cfg.user);
+        if (next <= start || next >= s_index.cfg.file_size) {
+            s_index.complete = true;
+        } else if (!starts_append((uint32_t)next)) {
+            // 内存不足或页数超限：保留已有部分，不再继续
+            s_index.complete = true;
+        }
+    }
+
+    if (s_index.complete) {
+        ESP_LOGI(TAG, "Index complete: %u pages", (unsigned)s_index.count);
+        index_save();
+        lv_timer_delete(timer);
+        s_index.timer = NULL;
+    } else if (s_index.count - s_index.saved_count >= PAGE_INDEX_SAVE_EVERY) {
+        index_save();
+    }
+}
+
+bool page_index_open(const page_index_config_t *cfg) {
+    page_index_close();
+    if (cfg == NULL || cfg->file_path == NULL || cfg->layout == NULL || cfg->file_size <= 0) {
+        return false;
+    }
+
+    memset(&s_index, 0, sizeof(s_index));
+    s_index.cfg = *cfg;
+    s_index.cfg.file_path = NULL;  // 路径只参与指纹，不保留指针
+
+    struct stat st;
+    const uint32_t mtime = stat(cfg->file_path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    uint32_t key = page_index_hash(0, cfg->file_path, strlen(cfg->file_path));
+    key = page_index_hash(key, &cfg->file_size, sizeof(cfg->file_size));
+    key = page_index_hash(key, &mtime, sizeof(mtime));
+    key = page_index_hash(key, &cfg->layout_hash, sizeof(cfg->layout_hash));
+    s_index.key = key;
+    snprintf(s_index.path, sizeof(s_index.path), "%s/%08x.pgi", PAGE_INDEX_DIR, (unsigned)key);
+
+    if (!index_load() || s_index.count == 0) {
+        s_index.count = 0;
+        s_index.complete = false;
+        if (!starts_append((uint32_t)cfg->content_start)) {
+            return false;
+        }
+    }
+
+    if (!s_index.complete) {
+        s_index.timer = lv_timer_create(build_timer_cb, PAGE_INDEX_PERIOD_MS, NULL);
+    }
+    s_index.open = true;
+    return true;
+}
+
+void page_index_close(void) {
+    if (!s_index.open) {
+        return;
+    }
+    if (s_index.timer != NULL) {
+        lv_timer_delete(s_index.timer);
+        s_index.timer = NULL;
+    }
+    index_save();
+    free(s_index.starts);
+    memset(&s_index, 0, sizeof(s_index));
+}
+
+bool page_index_is_complete(void) {
+    return s_index.open && s_index.complete;
+}
+
+int page_index_page_count(void) {
+    return s_index.open ? (int)s_index.count : 0;
+}
+
+long page_index_page_start(int page) {
+    if (!s_index.open || page < 1 || (uint32_t)page > s_index.count) {
+        return -1;
+    }
+    return (long)s_index.starts[page - 1];
+}
+
+int page_index_find_page(long offset) {
+    if (!s_index.open || s_index.count == 0 || offset < (long)s_index.starts[0]) {
+        return 0;
+    }
+    // 未完成时最后一页的终点未知
+    if (!s_index.complete && offset > (long)s_index.starts[s_index.count - 1]) {
+        return 0;
+    }
+
+    uint32_t lo = 0;
+    uint32_t hi = s_index.count;
+    while (hi - lo > 1) {
+        const uint32_t mid = (lo + hi) / 2;
+        if ((long)s_index.starts[mid] <= offset) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return (int)lo + 1;
+}
+
+// 按已索引部分的平均页长，从最后一个已索引页首外推到 offset
+static int extrapolate_page(long offset) {
+    if (!s_index.open || s_index.count < PAGE_INDEX_ESTIMATE_MIN) {
+        return 0;
+    }
+    const int64_t first = s_index.starts[0];
+    const int64_t last = s_index.starts[s_index.count - 1];
+    if (last <= first || offset <= last) {
+        return 0;
+    }
+    return (int)(s_index.count + (offset - last) * (int64_t)(s_index.count - 1) / (last - first));
+}
+
+int page_index_estimate_page(long offset) {
+    const int page = page_index_find_page(offset);
+    return page > 0 ? page : extrapolate_page(offset);
+}
+
+int page_index_estimate_total(void) {
+    if (page_index_is_complete()) {
+        return (int)s_index.count;
+    }
+    return extrapolate_page(s_index.cfg.file_size);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file page_index.h
+ * @brief TXT 分页索引 - 每页起始偏移的持久化表，翻到任意页只需一次 fseek
+ *
+ * 索引按（文件路径、大小、修改时间、排版指纹）区分，保存在
+ * /sdcard/.x4cache/<hash>.pgi：文件头 + 相邻页起点差值的 varint 序列。
+ * 未完成的索引在 LVGL 任务中分片继续构建（字体回调不是线程安全的，不能放到独立任务），
+ * 关闭书籍时保存进度，下次打开从断点继续
+ */
+
+#ifndef PAGE_INDEX_H
+#define PAGE_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PAGE_INDEX_DIR "/sdcard/.x4cache"
+
+/**
+ * @brief 排版一页的回调（在 LVGL 任务中调用）
+ * @param start 页首文件偏移
+ * @param user 用户数据
+ * @return 下一页的起点；不大于 start 表示已无更多页面或出错
+ */
+typedef long (*page_index_layout_fn)(long start, void *user);
+
+typedef struct {
+    const char *file_path;       // 书籍路径
+    long file_size;              // 文件大小
+    long content_start;          // 第 1 页起点（跳过 BOM）
+    uint32_t layout_hash;        // 排版参数指纹（字体、字号、页边距、行距等）
+    page_index_layout_fn layout; // 排版回调
+    void *user;
+} page_index_config_t;
+
+/**
+ * @brief 打开（或开始构建）书籍的分页索引；之前打开的索引会先关闭
+ * @param cfg 配置
+ * @return true 成功（索引可能尚未完成）
+ */
+bool page_index_open(const page_index_config_t *cfg);
+
+/**
+ * @brief 保存索引并停止构建
+ */
+void page_index_close(void);
+
+/**
+ * @brief 索引是否已覆盖整本书
+ */
+bool page_index_is_complete(void);
+
+/**
+ * @brief 已索引的页数（完成后即总页数）
+ */
+int page_index_page_count(void);
+
+/**
+ * @brief 获取第 page 页（从 1 开始）的起点
+ * @return 文件偏移；-1 表示该页尚未索引
+ */
+long page_index_page_start(int page);
+
+/**
+ * @brief 查找包含 offset 的页
+ * @return 页码（从 1 开始）；0 表示 offset 不在已索引范围内
+ */
+int page_index_find_page(long offset);
+
+/**
+ * @brief 估计 offset 所在的页码：已索引时取精确页码，否则按已索引部分的平均页长外推
+ * @return 页码（从 1 开始）；已索引的页太少、无法估计时为 0
+ */
+int page_index_estimate_page(long offset);
+
+/**
+ * @brief 估计总页数：索引完成时为精确值，否则按平均页长外推
+ * @return 页数；无法估计时为 0
+ */
+int page_index_estimate_total(void);
+
+/**
+ * @brief FNV-1a 增量哈希（用于计算排版指纹）
+ * @param hash 上一次的结果，首次传 0
+ */
+uint32_t page_index_hash(uint32_t hash, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PAGE_INDEX_H
@@ -0,0 +1,198 @@
+/**
+ * @file position_journal.c
+ * @brief 阅读进度日志实现
+ */
+
+#include "position_journal.h"
+#include "page_index.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include <stddef.h>
+#include <string.h>
+
+static const char *TAG = "POS_JOURNAL";
+
+#define NVS_NAMESPACE   "reader_pos"
+#define NVS_JOURNAL_KEY "journal"
+#define JOURNAL_MAGIC   0x4A50  // "PJ"
+#define JOURNAL_VERSION 1
+
+typedef struct __attribute__((packed)) {
+    uint32_t key;
+    int32_t a;
+    int32_t b;
+} journal_record_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t count;
+    journal_record_t records[POSITION_JOURNAL_SLOTS];  // 从旧到新
+} journal_blob_t;
+
+static journal_blob_t s_journal;
+static bool s_loaded = false;
+static bool s_dirty = false;
+static lv_timer_t *s_flush_timer = NULL;
+
+static void journal_load(void) {
+    if (s_loaded) {
+        return;
+    }
+    s_loaded = true;
+    memset(&s_journal, 0, sizeof(s_journal));
+
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    journal_blob_t blob;
+    size_t len = sizeof(blob);
+    const esp_err_t err = nvs_get_blob(nvs_handle, NVS_JOURNAL_KEY, &blob, &len);
+    nvs_close(nvs_handle);
+
+    // 只读取实际写入的部分
+    const size_t header = offsetof(journal_blob_t, records);
+    if (err == ESP_OK && len >= header && blob.magic == JOURNAL_MAGIC &&
+        blob.version == JOURNAL_VERSION && blob.count <= POSITION_JOURNAL_SLOTS &&
+        len == header + blob.count * sizeof(journal_record_t)) {
+        s_journal = blob;
+        ESP_LOGI(TAG, "Loaded %u reading positions", (unsigned)blob.count);
+    } else if (err == ESP_OK) {
+        ESP_LOGW(TAG, "Discarding invalid journal (%u bytes)", (unsigned)len);
+    }
+}
+
+static int journal_find(uint32_t key) {
+    for (int i = 0; i < s_journal.count; i++) {
+        if (s_journal.records[i].key == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void flush_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    s_flush_timer = NULL;  // 单次定时器，执行后自动删除
+    position_journal_flush();
+}
+
+uint32_t position_journal_key(const char *path) {
+    return page_index_hash(0, path, strlen(path));
+}
+
+bool position_journal_get(uint32_t key, int32_t *a, int32_t *b) {
+    journal_load();
+    const int i = journal_find(key);
+    if (i < 0) {
+        return false;
+    }
+    *a = s_journal.records[i].a;
+    *b = s_journal.records[i].b;
+    return true;
+}
+
+void position_journal_put(uint32_t key, int32_t a, int32_t b) {
+    journal_load();
+    const int i = journal_find(key);
+    if (i >= 0 && i == s_journal.count - 1 && s_journal.records[i].a == a &&
+        s_journal.records[i].b == b) {
+        return;  // 没有变化
+    }
+
+    // 移到末尾（最近使用）；已满时丢弃最旧的一条
+    if (i >= 0) {
+        memmove(&s_journal.records[i], &s_journal.records[i + 1],
+                (s_journal.count - i - 1) * sizeof(journal_record_t));
+        s_journal.count--;
+    } else if (s_journal.count == POSITION_JOURNAL_SLOTS) {
+        memmove(&s_journal.records[0], &s_journal.records[1],
+                (POSITION_JOURNAL_SLOTS - 1) * sizeof(journal_record_t));
+        s_journal.count--;
+    }
+    s_journal.records[s_journal.count++] = (journal_record_t){key, a, b};
+    s_dirty = true;
+
+    // 连续翻页只推迟同一次写入
+    if (s_flush_timer == NULL) {
+        s_flush_timer = lv_timer_create(flush_timer_cb, POSITION_JOURNAL_FLUSH_MS, NULL);
+        if (s_flush_timer != NULL) {
+            lv_timer_set_repeat_count(s_flush_timer, 1);
+        }
+    } else {
+        lv_timer_reset(s_flush_timer);
+    }
+}
+
+bool position_journal_migrate(uint32_t key, const char *legacy_a, const char *legacy_b,
+                              int32_t *a, int32_t *b) {
+    // 超过 NVS 键长上限的旧键当初就没能写入
+    if (strlen(legacy_a) >= NVS_KEY_NAME_MAX_SIZE ||
+        (legacy_b != NULL && strlen(legacy_b) >= NVS_KEY_NAME_MAX_SIZE)) {
+        return false;
+    }
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    int32_t va = 0;
+    int32_t vb = 0;
+    bool found = nvs_get_i32(nvs_handle, legacy_a, &va) == ESP_OK;
+    if (found && legacy_b != NULL && nvs_get_i32(nvs_handle, legacy_b, &vb) != ESP_OK) {
+        vb = 0;
+    }
+    nvs_close(nvs_handle);
+    if (!found) {
+        return false;
+    }
+
+    // 日志写入 NVS 之后才删除旧键，中途断电时下次还能再迁移
+    position_journal_put(key, va, vb);
+    if (position_journal_flush() && nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) == ESP_OK) {
+        nvs_erase_key(nvs_handle, legacy_a);
+        if (legacy_b != NULL) {
+            nvs_erase_key(nvs_handle, legacy_b);
+        }
+        nvs_commit(nvs_handle);
+        nvs_close(nvs_handle);
+    }
+    ESP_LOGI(TAG, "Migrated legacy position %s", legacy_a);
+    *a = va;
+    *b = vb;
+    return true;
+}
+
+bool position_journal_flush(void) {
+    if (s_flush_timer != NULL) {
+        lv_timer_delete(s_flush_timer);
+        s_flush_timer = NULL;
+    }
+    if (!s_dirty) {
+        return true;
+    }
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %d", err);
+        return false;
+    }
+    s_journal.magic = JOURNAL_MAGIC;
+    s_journal.version = JOURNAL_VERSION;
+    const size_t len = offsetof(journal_blob_t, records) + s_journal.count * sizeof(journal_record_t);
+    err = nvs_set_blob(nvs_handle, NVS_JOURNAL_KEY, &s_journal, len);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write journal: %d", err);
+        return false;
+    }
+    s_dirty = false;
+    ESP_LOGI(TAG, "Flushed %u reading positions", (unsigned)s_journal.count);
+    return true;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file position_journal.h
+ * @brief 阅读进度日志 - 进度先记在内存，合并后定时写入 NVS
+ *
+ * 每本书一条 12 字节记录（路径哈希 + 两个 32 位值），全部记录存在 NVS 命名空间
+ * reader_pos 的同一个 blob 中，按最近使用顺序追加（更新时移到末尾，满了丢弃最旧的）。
+ * 翻页只修改内存；在最后一次修改 POSITION_JOURNAL_FLUSH_MS 后、退出阅读器时、
+ * 或进入浅睡眠前一次性写入。所有函数都在 LVGL 任务中调用
+ *
+ * 记录集很小（最多 POSITION_JOURNAL_SLOTS × 12 字节），每次写入都是整块重写，不是
+ * 追加日志：NVS 自身按页追加写入并做磨损均衡，合并写入后的写次数已经很少。
+ *
+ * 旧版本每本书各用一个 NVS 键（TXT 为 "txt_<文件名>"，EPUB 为 "epub_<文件名>_ch/_pg"），
+ * 日志中没有这本书时由读取方调用 position_journal_migrate 取出旧键并记入日志
+ */
+
+#ifndef POSITION_JOURNAL_H
+#define POSITION_JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POSITION_JOURNAL_SLOTS    32      // 最多记住多少本书
+#define POSITION_JOURNAL_FLUSH_MS 30000   // 最后一次修改后多久写入 NVS
+
+/**
+ * @brief 由书籍路径计算记录键
+ */
+uint32_t position_journal_key(const char *path);
+
+/**
+ * @brief 读取记录
+ * @param key 记录键
+ * @param a 输出：第一个值（TXT 为页首偏移，EPUB 为章节）
+ * @param b 输出：第二个值（页码）
+ * @return true 找到记录
+ */
+bool position_journal_get(uint32_t key, int32_t *a, int32_t *b);
+
+/**
+ * @brief 更新记录（只写内存，延迟写入 NVS）
+ */
+void position_journal_put(uint32_t key, int32_t a, int32_t b);
+
+/**
+ * @brief 迁移旧版本的单值 NVS 键：值原样记入日志并立即写入 NVS，成功后删除旧键
+ *
+ * 旧值的含义与现在不同时，调用方随后用 position_journal_put 更正
+ * @param key 记录键
+ * @param legacy_a 第一个值的旧键名
+ * @param legacy_b 第二个值的旧键名，NULL 表示旧版本没有保存（记为 0）
+ * @param a 输出：第一个值
+ * @param b 输出：第二个值
+ * @return true 找到旧键并已迁移
+ */
+bool position_journal_migrate(uint32_t key, const char *legacy_a, const char *legacy_b,
+                              int32_t *a, int32_t *b);
+
+/**
+ * @brief 立即写入未保存的修改
+ * @return true 成功或没有需要写入的内容
+ */
+bool position_journal_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POSITION_JOURNAL_H
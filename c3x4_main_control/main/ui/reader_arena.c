@@ -0,0 +1,86 @@
+/**
+ * @file reader_arena.c
+ * @brief 阅读会话 arena 实现：单块 + 指针递增，没有逐块释放
+ */
+
+#include "reader_arena.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "READER_ARENA";
+
+static uint8_t *s_base = NULL;
+static size_t s_size = 0;
+static size_t s_used = 0;
+static TaskHandle_t s_owner = NULL;   // 开始会话的任务，只有它从 arena 分配
+static uint32_t s_fallbacks = 0;      // 放不下而退回 malloc 的次数（会话结束时记录）
+
+bool reader_arena_begin(size_t size) {
+    if (s_base != NULL) {
+        ESP_LOGW(TAG, "Session already active");
+        return false;
+    }
+    s_base = malloc(size);
+    if (s_base == NULL) {
+        ESP_LOGW(TAG, "No memory for %u byte arena, using the heap", (unsigned)size);
+        return false;
+    }
+    s_size = size;
+    s_used = 0;
+    s_fallbacks = 0;
+    s_owner = xTaskGetCurrentTaskHandle();
+    return true;
+}
+
+void reader_arena_end(void) {
+    if (s_base == NULL) {
+        return;
+    }
+    ESP_LOGI(TAG, "Session released: %u / %u bytes used, %u heap fallbacks", (unsigned)s_used,
+             (unsigned)s_size, (unsigned)s_fallbacks);
+    free(s_base);
+    s_base = NULL;
+    s_size = 0;
+    s_used = 0;
+    s_owner = NULL;
+}
+
+void *reader_arena_alloc(size_t size) {
+    const size_t need = (size + READER_ARENA_ALIGN - 1) & ~(size_t)(READER_ARENA_ALIGN - 1);
+    if (s_base == NULL || xTaskGetCurrentTaskHandle() != s_owner) {
+        return malloc(size);
+    }
+    if (need == 0 || need > s_size - s_used) {
+        s_fallbacks++;
+        return malloc(size);
+    }
+    void *p = s_base + s_used;
+    s_used += need;
+    return p;
+}
+
+void *reader_arena_calloc(size_t n, size_t size) {
+    if (size != 0 && n > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *p = reader_arena_alloc(n * size);
+    if (p != NULL) {
+        memset(p, 0, n * size);
+    }
+    return p;
+}
+
+bool reader_arena_owns(const void *ptr) {
+    const uint8_t *p = (const uint8_t *)ptr;
+    return s_base != NULL && p >= s_base && p < s_base + s_size;
+}
+
+void reader_arena_free(void *ptr) {
+    if (!reader_arena_owns(ptr)) {
+        free(ptr);
+    }
+}
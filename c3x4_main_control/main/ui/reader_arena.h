@@ -0,0 +1,62 @@
+/**
+ * @file reader_arena.h
+ * @brief 阅读会话 arena：打开书时一次性保留一整块，会话内的长期分配按顺序切出，退出时整块释放
+ *
+ * 阅读器每次打开书都要分配文本缓冲区、排版上下文、TXT 阅读器及其读取窗口、EPUB 的章节表，
+ * 关闭时再逐个释放。反复开关书会把这些大小不一的块散布在堆里，留下碎片。
+ * 会话开始时 reader_arena_begin 保留一块，之后 reader_arena_alloc 只移动指针；
+ * reader_arena_end 一次释放整块，中间的各次释放（reader_arena_free）对 arena 内的指针是空操作。
+ *
+ * 只有开始会话的任务从 arena 分配；其他任务（后台建库打开 EPUB 等）、会话之外或 arena
+ * 用完时退回 malloc，因此释放一律走 reader_arena_free，它能分辨两种指针。
+ * 只放整个会话都活着的分配：章节正文、分页等随翻页反复分配释放的内容仍走堆
+ */
+
+#ifndef READER_ARENA_H
+#define READER_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define READER_ARENA_ALIGN 8
+
+/**
+ * @brief 开始阅读会话，保留 size 字节
+ * @return false 已有会话或内存不足（之后的分配全部退回 malloc）
+ */
+bool reader_arena_begin(size_t size);
+
+/**
+ * @brief 结束会话，整块释放。之后 arena 内的指针全部失效
+ */
+void reader_arena_end(void);
+
+/**
+ * @brief 分配 size 字节（READER_ARENA_ALIGN 对齐），arena 不可用时退回 malloc
+ */
+void *reader_arena_alloc(size_t size);
+
+/**
+ * @brief 分配并清零，arena 不可用时退回 calloc
+ */
+void *reader_arena_calloc(size_t n, size_t size);
+
+/**
+ * @brief 释放：arena 内的指针在会话结束时一起释放，这里什么也不做；其余交给 free
+ */
+void reader_arena_free(void *ptr);
+
+/**
+ * @brief ptr 是否位于当前会话的 arena 内（不能 realloc 这样的指针）
+ */
+bool reader_arena_owns(const void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // READER_ARENA_H
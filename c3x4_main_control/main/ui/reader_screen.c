@@ -1,15 +1,45 @@
 /**
  * @file reader_screen.c
- * @brief 阅读器屏幕实现 - 支持 TXT 和 EPUB 格式的电子书阅读
+ * @brief 阅读器屏幕实现 - 支持 TXT、EPUB、预排版 X4PG 与 CBZ 漫画的阅读
  */
 
 #include "reader_screen.h"
 #include "txt_reader.h"
+#include "page_cache.h"
+#include "page_index.h"
+#include "position_journal.h"
+#include "reading_pace.h"
+#include "text_layout.h"
 #include "epub_parser.h"
+#include "epub_pages.h"
+#include "epub_pipeline.h"
+#include "epub_prefetch.h"
+#include "epub_progress.h"
+#include "epub_image.h"
+#include "x4pg_book.h"
+#include "cbz_book.h"
+#include "reader_arena.h"
+#include "chapter_list.h"
+#include "book_search.h"
+#include "search_list.h"
+#include "dict.h"
+#include "dict_popup.h"
+#include "txt_toc.h"
+#include "font_subset.h"
 #include "font_manager.h"
 #include "lvgl_driver.h"
+#include "power_manager.h"
+#include "ble_remote.h"
 #include "screen_manager.h"
+#include "settings_store.h"
+#include "status_refresh.h"
+#include "turn_stats.h"
+#include "bg_jobs.h"
 #include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <limits.h>
 #include <string.h>
 #include <stdlib.h>
 #include <strings.h>
@@ -29,6 +59,36 @@ extern const lv_font_t lv_font_montserrat_24;
 
 // 默认缓冲区大小
 #define TEXT_BUFFER_SIZE 8192
+// 阅读会话 arena 为 EPUB 章节表预留的空间（200 章的偏移与大小表，加上缓存的路径池）
+#define READER_ARENA_EPUB_TABLES (6 * 1024)
+
+// 状态栏高度；其下方为页面区域（页面缓存覆盖的范围）
+#define STATUS_BAR_HEIGHT 40
+
+// 横屏双栏的栏间距
+#define COLUMN_GAP 32
+
+// 页面显示后等待多久开始缓存当前页并预渲染下一页（快读时由 reading_pace 缩短）
+#define PRERENDER_DELAY_MS 400
+
+// 本次阅读记录的页首数（后退翻页直接弹出，不重新排版）
+#define PAGE_HISTORY_SIZE 64
+
+// EPUB 距章末不超过这么多页时在后台预取下一章（按 reading_pace 调整）
+#define EPUB_PREFETCH_PAGES 3
+
+// 图片页写入 framebuffer 时等待刷新任务释放缓冲区的最长时间
+#define IMAGE_BLIT_LOCK_MS 100
+
+// 图片页先不带位图显示，这么久之后（翻页的渲染与刷新已提交）再解码，结果单独局刷
+#define IMAGE_DECODE_DELAY_MS 10
+
+// 后台打开书时查询结果的周期；打开超过 BOOK_OPEN_PLACEHOLDER_MS 才先把外框和提示刷上屏
+#define BOOK_OPEN_POLL_MS        20
+#define BOOK_OPEN_PLACEHOLDER_MS 300
+
+// 按住确认键这么久打开查词浮层，更早松开按单击（菜单）处理
+#define READER_DICT_HOLD_MS 600
 
 // 阅读器屏幕状态定义（与头文件的前置声明匹配）
 struct reader_state_t {
@@ -39,28 +99,77 @@ struct reader_state_t {
     // 阅读进度
     int current_page;
     int total_pages;
+    long page_start;          // 当前页首文件位置（TXT）
+    long page_end;            // 下一页首文件位置（TXT）
 
     // TXT/EPUB 数据
     txt_reader_t *txt_reader;
     epub_reader_t *epub_reader;
+    x4pg_book_t *x4pg_book;
+    cbz_book_t *cbz_book;
 
     // 缓冲区
     char *text_buffer;
     size_t buffer_size;
 
+    // 排版：当前页的行表（指向 text_buffer）
+    text_layout_t *layout;
+    text_page_layout_t page_layout;
+
+    // 分页索引构建用的排版缓冲区（与当前页互不干扰，索引完成后释放）
+    char *index_text;
+    text_page_layout_t *index_layout;
+
+    // EPUB 当前章节的展平正文与页边界（current_page / total_pages 为章内页码）
+    epub_pages_t epub_pages;
+
+    // EPUB 图片页：当前页的位图与位置，每次渲染完成后写入 framebuffer
+    epub_image_t page_image;
+    lv_area_t page_image_area;
+    // 等待解码（或已解码失败）的图片页：章节与占位行偏移（与排版无关）
+    lv_timer_t *image_timer;
+    int image_chapter;
+    uint32_t image_offset;
+    bool image_failed;
+
     // 设置
     reader_settings_t settings;
+    bool was_landscape;       // 打开前的显示方向，关闭时恢复
 
     // UI 组件
     lv_obj_t *screen;
-    lv_obj_t *text_label;
+    lv_obj_t *text_view;
     lv_obj_t *progress_label;
     lv_obj_t *status_bar;
+    lv_obj_t *title_label;
     lv_obj_t *menu;
 
+    // 后台打开（TXT/EPUB）：打开完成前 is_open 为 false，只响应返回键
+    lv_timer_t *open_timer;
+    lv_obj_t *open_label;     // 打开较慢或失败时的提示
+    uint32_t open_start;
+    bool chrome_shown;        // 外框已刷上屏，标题栏图层已截取
+
     lv_indev_t *indev;
     lv_group_t *group;
 
+    // 页面位图缓存（TXT）
+    bool page_cache_ready;
+    lv_timer_t *prerender_timer;
+
+    // 按住翻页键：重复时只移动位置、刷新页码，松开后绘制一次正文
+    bool key_skipping;
+
+    // 确认键由快速通道接管：松开时按单击处理（菜单），按住 READER_DICT_HOLD_MS 打开查词
+    bool confirm_down;
+    bool confirm_long;
+    uint32_t confirm_tick;
+
+    // 向前翻过的页首（环形栈，满了丢弃最旧的）
+    long history[PAGE_HISTORY_SIZE];
+    int history_top;
+    int history_count;
+
     // 待处理动作
     enum {
         READER_ACTION_NONE = 0,
@@ -70,16 +179,31 @@ struct reader_state_t {
         READER_ACTION_HIDE_MENU,
         READER_ACTION_EXIT,
         READER_ACTION_EXIT_TO_INDEX,  // 双击返回键直接返回主页
+        READER_ACTION_SHOW_TOC,       // 打开章节列表
+        READER_ACTION_TOC_KEY,        // 章节列表打开时的按键，见 pending_key
+        READER_ACTION_TOGGLE_NIGHT,   // 切换夜间模式（菜单中）
+        READER_ACTION_SHOW_SEARCH,    // 打开搜索浮层（TXT）
+        READER_ACTION_SEARCH_KEY,     // 搜索浮层打开时的按键，见 pending_key
+        READER_ACTION_CYCLE_ORIENTATION, // 切换竖屏 / 横屏 / 横屏双栏（菜单中）
+        READER_ACTION_SHOW_DICT,      // 打开查词浮层（长按确认键）
+        READER_ACTION_DICT_KEY,       // 查词浮层打开时的按键，见 pending_key
     } pending_action;
+    uint32_t pending_key;
 };
 
 static struct reader_state_t g_reader_state = {0};
 
 // 前置声明
 static void update_page_display(void);
+static void invalidate_page_region(void);
 static int get_chars_per_page(int font_size);
 static void reader_process_pending_action_cb(void *user_data);
 static void reader_screen_destroy_cb(lv_event_t *e);
+static void schedule_prerender(void);
+static void index_open(void);
+static void epub_relayout(void);
+static void skip_page(int delta);
+static void finish_skip(void);
 
 // 根据字体大小获取每页字符数
 static int get_chars_per_page(int font_size) {
@@ -92,6 +216,9 @@ static int get_chars_per_page(int font_size) {
     }
 }
 
+// 还没有章节分页完成时估计全书页数用的每页 XHTML 字节数（UTF-8 汉字 3 字节，另算标记）
+#define EPUB_FALLBACK_BYTES_PER_CHAR 4
+
 // 根据文件扩展名获取书籍类型
 static book_type_t get_book_type(const char *file_path) {
     if (file_path == NULL) {
@@ -103,10 +230,14 @@ static book_type_t get_book_type(const char *file_path) {
         return BOOK_TYPE_NONE;
     }
 
-    if (strcasecmp(ext, ".txt") == 0) {
+    if (strcasecmp(ext, ".txt") == 0 || strcasecmp(ext, ".gz") == 0) {
         return BOOK_TYPE_TXT;
     } else if (strcasecmp(ext, ".epub") == 0) {
         return BOOK_TYPE_EPUB;
+    } else if (strcasecmp(ext, ".x4pg") == 0) {
+        return BOOK_TYPE_X4PG;
+    } else if (strcasecmp(ext, ".cbz") == 0) {
+        return BOOK_TYPE_CBZ;
     }
 
     return BOOK_TYPE_NONE;
@@ -114,7 +245,8 @@ static book_type_t get_book_type(const char *file_path) {
 
 // 根据字体大小获取字体指针
 static const lv_font_t* get_lvgl_font(int font_size) {
-    // 优先使用 font_manager 的中文字体
+    // 优先使用 font_manager 的中文字体（缺字自动回退到内置中文字体和 Montserrat）；
+    // 位图字体已按 font_manager_set_scaled_size() 的字号缩放
     const lv_font_t *chinese_font = font_manager_get_font();
     if (chinese_font != NULL) {
         return chinese_font;
@@ -130,6 +262,500 @@ static const lv_font_t* get_lvgl_font(int font_size) {
     }
 }
 
+// 更新进度：时钟（对过时才有）、电量与页码。EPUB 显示全书页码；总页数还是估计值时加 ~
+static void update_progress_label(void) {
+    if (g_reader_state.progress_label != NULL) {
+        const screen_context_t *ctx = screen_manager_get_context();
+        int page = g_reader_state.current_page;
+        int total = g_reader_state.total_pages;
+        bool estimated = false;
+        if (g_reader_state.book_type == BOOK_TYPE_EPUB && g_reader_state.epub_reader != NULL) {
+            page = g_reader_state.epub_reader->position.page_number;
+            total = g_reader_state.epub_reader->position.total_pages;
+            estimated = !epub_progress_is_exact();
+        } else if (g_reader_state.book_type == BOOK_TYPE_TXT) {
+            estimated = !page_index_is_complete();
+        }
+        char clock[8];
+        char progress_str[48];
+        const bool has_clock = status_refresh_format_clock(clock, sizeof(clock));
+        snprintf(progress_str, sizeof(progress_str), "%s%s%u%%%s  %d / %s%d", clock, has_clock ? "  " : "",
+                 ctx != NULL ? ctx->battery_pct : 0, ctx != NULL && ctx->charging ? "+" : "",
+                 page, estimated ? "~" : "", total);
+        lv_label_set_text(g_reader_state.progress_label, progress_str);
+    }
+}
+
+// 状态栏微刷新：分钟或电量变化时只改写进度标签
+static void status_update_cb(bool battery_changed) {
+    (void)battery_changed;
+    update_progress_label();
+}
+
+// 按当前字体与阅读区域尺寸重新初始化排版
+static void layout_reset(void) {
+    if (g_reader_state.layout == NULL || g_reader_state.text_view == NULL) {
+        return;
+    }
+    const lv_font_t *font = lv_obj_get_style_text_font(g_reader_state.text_view, LV_PART_MAIN);
+    const int32_t pad = g_reader_state.settings.margin;
+    const uint8_t columns = g_reader_state.settings.orientation == READER_ORIENTATION_TWO_COLUMN ? 2 : 1;
+    const int32_t width = (lv_display_get_horizontal_resolution(NULL) - 2 * pad -
+                           (columns - 1) * COLUMN_GAP) / columns;
+    const int32_t height = lv_display_get_vertical_resolution(NULL) - STATUS_BAR_HEIGHT - 2 * pad;
+    text_layout_init(g_reader_state.layout, font, width, height, g_reader_state.settings.line_spacing);
+    text_layout_set_columns(g_reader_state.layout, columns);
+    text_view_set_columns(g_reader_state.text_view, columns, COLUMN_GAP);
+    index_open();
+    epub_relayout();
+}
+
+// 从 start 排出一页到 text/out，返回下一页起点（失败返回 -1）；阅读器位置不变
+static long layout_page_at(long start, char *text, size_t text_size, text_page_layout_t *out) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    const txt_position_t saved = txt_reader_get_position(reader);
+    long end = -1;
+    bool at_eof = false;
+
+    if (txt_reader_set_position(reader, start, saved.page_number)) {
+        const int n = txt_reader_peek(reader, text, text_size, &at_eof);
+        turn_stats_mark(TURN_STAGE_FETCH);
+        if (n > 0 && text_layout_paginate(g_reader_state.layout, text, (uint32_t)n, at_eof, out)) {
+            end = txt_reader_offset_after(reader, start, out->consumed);
+        }
+        turn_stats_mark(TURN_STAGE_LAYOUT);
+    }
+    txt_reader_set_position(reader, saved.file_position, saved.page_number);
+    return end;
+}
+
+// 分页索引的排版回调：使用独立缓冲区，分块方式与显示页面相同，页边界因此一致
+static long index_layout_cb(long start, void *user) {
+    (void)user;
+    return layout_page_at(start, g_reader_state.index_text, g_reader_state.buffer_size,
+                          g_reader_state.index_layout);
+}
+
+// 排版参数指纹：字体（行高与若干字形宽度）、可用区域与行距决定了所有页边界
+static uint32_t layout_fingerprint(void) {
+    static const uint32_t probes[] = {' ', 'a', 'i', 'm', 'W', 0x4E00, 0x4E2D, 0xFF0C, 0x3002};
+    const text_layout_t *layout = g_reader_state.layout;
+    const int32_t params[] = {layout->width, layout->line_pitch, layout->max_lines,
+                              lv_font_get_line_height(layout->font), TEXT_LAYOUT_VERSION};
+    uint32_t hash = page_index_hash(0, params, sizeof(params));
+    for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); i++) {
+        const uint16_t adv = lv_font_get_glyph_width(layout->font, probes[i], 0);
+        hash = page_index_hash(hash, &adv, sizeof(adv));
+    }
+    const char *font_path = font_manager_get_stream_font_path();
+    if (font_path != NULL) {
+        hash = page_index_hash(hash, font_path, strlen(font_path));
+    }
+    return hash;
+}
+
+static void index_scratch_free(void) {
+    free(g_reader_state.index_text);
+    free(g_reader_state.index_layout);
+    g_reader_state.index_text = NULL;
+    g_reader_state.index_layout = NULL;
+}
+
+// 按当前排版打开分页索引；缺失或未完成的部分在 LVGL 任务中分片构建
+static void index_open(void) {
+    if (g_reader_state.txt_reader == NULL || g_reader_state.layout == NULL) {
+        return;
+    }
+    if (g_reader_state.index_text == NULL) {
+        g_reader_state.index_text = malloc(g_reader_state.buffer_size);
+        g_reader_state.index_layout = malloc(sizeof(text_page_layout_t));
+        if (g_reader_state.index_text == NULL || g_reader_state.index_layout == NULL) {
+            ESP_LOGW(TAG, "No memory for page index, using estimated page count");
+            index_scratch_free();
+            page_index_close();
+            return;
+        }
+    }
+
+    const txt_position_t pos = txt_reader_get_position(g_reader_state.txt_reader);
+    const page_index_config_t cfg = {
+        .file_path = g_reader_state.file_path,
+        .file_size = pos.file_size,
+        .content_start = g_reader_state.txt_reader->content_start,
+        .layout_hash = layout_fingerprint(),
+        .layout = index_layout_cb,
+    };
+    if (!page_index_open(&cfg) || page_index_is_complete()) {
+        index_scratch_free();
+    }
+}
+
+// 加载 EPUB 章节：优先取后台预取的结果，否则开始流水线，需要的页在显示前才等到就绪
+static bool epub_load_chapter(int chapter_index) {
+    epub_pipeline_cancel();
+    epub_pages_t pages;
+    if (epub_prefetch_take(chapter_index, &pages)) {
+        epub_pages_free(&g_reader_state.epub_pages);
+        g_reader_state.epub_pages = pages;
+    } else if (!epub_pipeline_open(g_reader_state.epub_reader, chapter_index, g_reader_state.layout,
+                                   &g_reader_state.epub_pages)) {
+        return false;
+    }
+    return epub_parser_goto_chapter(g_reader_state.epub_reader, chapter_index);
+}
+
+// 排版改变（或刚打开书籍）：按新参数重新分页，回到原来的正文位置
+static void epub_relayout(void) {
+    epub_reader_t *reader = g_reader_state.epub_reader;
+    if (reader == NULL || g_reader_state.layout == NULL) {
+        return;
+    }
+    // 预取的页边界按旧排版计算，作废；全书页数按新排版重新统计
+    epub_prefetch_cancel();
+    epub_progress_open(reader, g_reader_state.layout,
+                       (uint32_t)get_chars_per_page(g_reader_state.settings.font_size) *
+                           EPUB_FALLBACK_BYTES_PER_CHAR);
+
+    const long offset = reader->position.chapter_position;
+    epub_pages_t *pages = &g_reader_state.epub_pages;
+    if (epub_pages_loaded(pages) && pages->chapter_index == reader->position.current_chapter) {
+        epub_pages_reset(pages);
+        epub_pages_paginate(pages, g_reader_state.layout, 0);
+    } else if (!epub_load_chapter(reader->position.current_chapter)) {
+        ESP_LOGE(TAG, "Failed to load chapter %d", reader->position.current_chapter);
+        return;
+    }
+    epub_pipeline_wait(-1, (uint32_t)offset);
+    reader->position.chapter_position = offset;
+    g_reader_state.current_page = epub_pages_find(pages, (uint32_t)offset) + 1;
+    g_reader_state.total_pages = pages->page_count;
+}
+
+// EPUB 翻页：章内移动，越过章首/章末时切换章节
+static bool epub_turn_page(int delta) {
+    const epub_pages_t *pages = &g_reader_state.epub_pages;
+    if (!epub_pages_loaded(pages)) {
+        return false;
+    }
+    const int page = g_reader_state.current_page - 1 + delta;
+    epub_pipeline_wait(page, 0);
+    if (page >= 0 && page < pages->page_count) {
+        g_reader_state.current_page = page + 1;
+        return true;
+    }
+
+    const int chapter = pages->chapter_index + (delta > 0 ? 1 : -1);
+    if (chapter < 0 || chapter >= g_reader_state.epub_reader->metadata.total_chapters) {
+        return false;
+    }
+    if (!epub_load_chapter(chapter)) {
+        ESP_LOGE(TAG, "Failed to load chapter %d", chapter);
+        return false;
+    }
+    if (delta < 0) {
+        epub_pipeline_wait(INT_MAX, 0);  // 退回上一章的最后一页：要等分页完成
+    }
+    g_reader_state.current_page = delta > 0 ? 1 : g_reader_state.epub_pages.page_count;
+    return true;
+}
+
+// 从章节列表跳到某章的开头
+static void epub_jump_to_chapter(int chapter_index) {
+    if (!epub_load_chapter(chapter_index)) {
+        ESP_LOGE(TAG, "Failed to load chapter %d", chapter_index);
+        return;
+    }
+    g_reader_state.current_page = 1;
+    update_page_display();
+}
+
+// 加载图片页的位图，居中放在正文区域内
+static bool epub_load_page_image(const epub_page_image_t *page_image) {
+    epub_chapter_t chapter;
+    char path[256];
+    if (!epub_parser_get_chapter(g_reader_state.epub_reader, g_reader_state.epub_pages.chapter_index,
+                                 &chapter) ||
+        !epub_parser_resolve_href(chapter.content_file, page_image->src, path, sizeof(path))) {
+        return false;
+    }
+
+    const int32_t pad = g_reader_state.settings.margin;
+    const lv_area_t bounds = {
+        pad,
+        STATUS_BAR_HEIGHT + pad,
+        lv_display_get_horizontal_resolution(NULL) - 1 - pad,
+        lv_display_get_vertical_resolution(NULL) - 1 - pad,
+    };
+    const int32_t width = lv_area_get_width(&bounds);
+    const int32_t height = lv_area_get_height(&bounds);
+    epub_image_t *image = &g_reader_state.page_image;
+    if (!epub_image_load(g_reader_state.epub_reader, path, width, height, image)) {
+        return false;
+    }
+    lv_area_t *area = &g_reader_state.page_image_area;
+    area->x1 = bounds.x1 + (width - image->width) / 2;
+    area->y1 = bounds.y1 + (height - image->height) / 2;
+    area->x2 = area->x1 + image->width - 1;
+    area->y2 = area->y1 + image->height - 1;
+    return true;
+}
+
+// 把图片页的位图写入 framebuffer；菜单或章节列表盖住页面时不写，
+// 它们关闭时页面区域重新渲染，渲染完成后随之再写一次
+static bool epub_blit_page_image(void) {
+    const epub_image_t *image = &g_reader_state.page_image;
+    if (image->bits == NULL || g_reader_state.menu == NULL ||
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN) || chapter_list_is_open()) {
+        return false;
+    }
+    uint8_t *fb = lvgl_fb_write_begin(IMAGE_BLIT_LOCK_MS);
+    if (fb == NULL) {
+        return false;  // 灰阶模式下不可用，页面保持空白
+    }
+    const lv_area_t *area = &g_reader_state.page_image_area;
+    lvgl_fb_put_bitmap(fb, area->x1, area->y1, image->width, image->height, image->bits,
+                       image->stride);
+    lvgl_fb_write_end(area);
+    return true;
+}
+
+static void epub_image_render_cb(lv_event_t *e) {
+    (void)e;
+    epub_blit_page_image();
+}
+
+// 图片页的文字部分（状态栏、页码）已经显示：解码位图，只局刷图片所在的一块。
+// 期间翻走了就作废；解码失败时整页改排占位行
+static void epub_image_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    g_reader_state.image_timer = NULL;
+    epub_pages_t *pages = &g_reader_state.epub_pages;
+    const int page = g_reader_state.current_page - 1;
+    if (!g_reader_state.is_open || g_reader_state.key_skipping || g_reader_state.page_image.bits != NULL ||
+        pages->chapter_index != g_reader_state.image_chapter) {
+        return;
+    }
+    const epub_page_image_t *page_image = epub_pages_image(pages, page);
+    if (page_image == NULL || page_image->offset != g_reader_state.image_offset) {
+        return;
+    }
+
+    if (!epub_load_page_image(page_image)) {
+        g_reader_state.image_failed = true;
+        update_page_display();
+        invalidate_page_region();
+        lvgl_trigger_render(NULL);
+    } else if (!epub_blit_page_image()) {
+        return;
+    }
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    lvgl_display_refresh_partial();
+}
+
+// 图片页先以留空的正文区域显示，位图在翻页刷新提交之后再解码
+static void epub_schedule_page_image(int chapter_index, const epub_page_image_t *page_image) {
+    g_reader_state.image_chapter = chapter_index;
+    g_reader_state.image_offset = page_image->offset;
+    g_reader_state.image_failed = false;
+    if (g_reader_state.image_timer != NULL) {
+        lv_timer_reset(g_reader_state.image_timer);
+        return;
+    }
+    g_reader_state.image_timer = lv_timer_create(epub_image_timer_cb, IMAGE_DECODE_DELAY_MS, NULL);
+    if (g_reader_state.image_timer != NULL) {
+        lv_timer_set_repeat_count(g_reader_state.image_timer, 1);
+    }
+}
+
+// X4PG 与 CBZ 页是整帧位图：渲染完成后直接解压覆盖整个 framebuffer（包括状态栏）。
+// 按住翻页时不写，只让状态栏显示页码；菜单打开时同样跳过，关闭后随重新渲染再写
+static void x4pg_render_cb(lv_event_t *e) {
+    (void)e;
+    if ((g_reader_state.x4pg_book == NULL && g_reader_state.cbz_book == NULL) ||
+        g_reader_state.key_skipping || g_reader_state.menu == NULL ||
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        return;
+    }
+    uint8_t *fb = lvgl_fb_write_begin(IMAGE_BLIT_LOCK_MS);
+    if (fb == NULL) {
+        return;
+    }
+    const int page = g_reader_state.current_page - 1;
+    const bool ok = g_reader_state.x4pg_book != NULL
+                        ? x4pg_book_decode(g_reader_state.x4pg_book, page, fb, lvgl_fb_size())
+                        : cbz_book_decode(g_reader_state.cbz_book, page, fb, lvgl_fb_size());
+    if (!ok) {
+        memset(fb, 0xFF, lvgl_fb_size());  // 损坏的页显示为空白，不留半帧残影
+    }
+    const lv_area_t screen = {0, 0, lv_display_get_horizontal_resolution(NULL) - 1,
+                              lv_display_get_vertical_resolution(NULL) - 1};
+    lvgl_fb_write_end(&screen);
+}
+
+// 显示 EPUB 当前页；接近章末时让后台开始准备下一章
+static void epub_show_current_page(void) {
+    epub_reader_t *reader = g_reader_state.epub_reader;
+    epub_pages_t *pages = &g_reader_state.epub_pages;
+    epub_pipeline_wait(g_reader_state.current_page - 1, 0);
+
+    int page = g_reader_state.current_page - 1;
+    if (page >= pages->page_count) page = pages->page_count - 1;
+    if (page < 0) page = 0;
+    const uint32_t start = pages->page_starts[page];
+    const uint32_t end = epub_pages_text_end(pages, start);
+    // 大章节常驻压缩，这里只解压本页所在的几块
+    uint32_t len = end - start;
+    const char *text = epub_pages_text(pages, start, &len);
+    if (text == NULL) {
+        text = "";
+    }
+
+    // 图片页的正文区域留空，位图稍后解码、单独局刷；解码失败的页显示占位行
+    epub_image_free(&g_reader_state.page_image);
+    const epub_page_image_t *page_image = epub_pages_image(pages, page);
+    const bool image_failed = page_image != NULL && g_reader_state.image_failed &&
+                              g_reader_state.image_chapter == pages->chapter_index &&
+                              g_reader_state.image_offset == page_image->offset;
+    if (page_image != NULL && !image_failed) {
+        // 按住翻页键跳过的图片页不解码，松开时停在图片页再安排
+        if (!g_reader_state.key_skipping) {
+            epub_schedule_page_image(pages->chapter_index, page_image);
+        }
+        turn_stats_mark(TURN_STAGE_FETCH);
+        g_reader_state.page_layout.line_count = 0;
+        g_reader_state.page_layout.consumed = end - start;
+    } else {
+        // 章节正文已在内存中（跨章时 epub_load_chapter 读取），读取阶段到这里结束
+        turn_stats_mark(TURN_STAGE_FETCH);
+        text_layout_paginate(g_reader_state.layout, text, len, len == end - start,
+                             &g_reader_state.page_layout);
+    }
+    text_view_set_page(g_reader_state.text_view, text, &g_reader_state.page_layout);
+    turn_stats_mark(TURN_STAGE_LAYOUT);
+
+    g_reader_state.current_page = page + 1;
+    g_reader_state.total_pages = pages->page_count;
+    reader->position.chapter_position = (long)start;
+    if (pages->complete) {
+        epub_progress_record(pages->chapter_index, pages->page_count);
+    }
+    // 全书页码：前面各章的页数（估计或精确）加章内页码
+    reader->position.page_number = epub_progress_pages_before(pages->chapter_index) + page + 1;
+    reader->position.total_pages = epub_progress_total();
+    if (reader->position.total_pages < reader->position.page_number) {
+        reader->position.total_pages = reader->position.page_number;
+    }
+
+    if (pages->complete &&
+        pages->page_count - g_reader_state.current_page < reading_pace_prefetch_pages(EPUB_PREFETCH_PAGES) &&
+        pages->chapter_index + 1 < reader->metadata.total_chapters) {
+        epub_prefetch_start(reader, pages->chapter_index + 1, g_reader_state.layout);
+    }
+}
+
+// 定位到第 page_number 页页首：已索引时一次定位，否则从最近的已索引页逐页排版
+static bool seek_layout_page(int page_number) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    long pos = reader->content_start;
+    int page = 1;
+    const int known = page_index_page_count() < page_number ? page_index_page_count() : page_number;
+    if (known > 0) {
+        page = known;
+        pos = page_index_page_start(known);
+    }
+    for (; page < page_number; page++) {
+        const long next = layout_page_at(pos, g_reader_state.text_buffer, g_reader_state.buffer_size,
+                                         &g_reader_state.page_layout);
+        if (next < 0) {
+            return false;
+        }
+        pos = next;
+    }
+    return txt_reader_set_position(reader, pos, page_number - 1);
+}
+
+static void history_push(long page_start) {
+    g_reader_state.history_top = (g_reader_state.history_top + 1) % PAGE_HISTORY_SIZE;
+    g_reader_state.history[g_reader_state.history_top] = page_start;
+    if (g_reader_state.history_count < PAGE_HISTORY_SIZE) {
+        g_reader_state.history_count++;
+    }
+}
+
+static long history_pop(void) {
+    if (g_reader_state.history_count == 0) {
+        return -1;
+    }
+    const long start = g_reader_state.history[g_reader_state.history_top];
+    g_reader_state.history_top = (g_reader_state.history_top + PAGE_HISTORY_SIZE - 1) % PAGE_HISTORY_SIZE;
+    g_reader_state.history_count--;
+    return start;
+}
+
+static void history_clear(void) {
+    g_reader_state.history_count = 0;
+}
+
+// 从搜索结果或章节目录跳到指定位置：已索引时跳到所在页的页首，否则从该处开始排版（页码为估算）
+static void txt_jump_to_offset(long offset) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    const int page = page_index_find_page(offset);
+    history_clear();
+    if (page <= 0 || !seek_layout_page(page)) {
+        const int chars_per_page = get_chars_per_page(g_reader_state.settings.font_size);
+        txt_reader_set_position(reader, offset, chars_per_page > 0 ? (int)(offset / chars_per_page) : 0);
+    }
+    update_page_display();
+}
+
+// 从 page_start 之前的文本倒推上一页起点：回退到缓冲区内最早的段首，
+// 从那里向后排版，取最后一个早于 page_start 的页首。开销与向前翻一页相当，
+// 页边界在段首重新对齐（没有历史和索引时与从头排版的结果可能略有不同）
+static long scan_prev_page_start(long page_start) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    long from = page_start;
+    const int n = txt_reader_peek_before(reader, page_start, g_reader_state.text_buffer,
+                                         g_reader_state.buffer_size, &from);
+    if (n <= 0) {
+        return -1;
+    }
+
+    long pos = from;
+    if (from > reader->content_start) {
+        const char *nl = memchr(g_reader_state.text_buffer, '\n', (size_t)n);
+        if (nl != NULL && nl + 1 < g_reader_state.text_buffer + n) {
+            pos = txt_reader_offset_after(reader, from, (size_t)(nl + 1 - g_reader_state.text_buffer));
+        }
+    }
+
+    while (pos < page_start) {
+        const long next = layout_page_at(pos, g_reader_state.text_buffer, g_reader_state.buffer_size,
+                                         &g_reader_state.page_layout);
+        if (next <= pos || next >= page_start) {
+            break;
+        }
+        pos = next;
+    }
+    return pos < page_start ? pos : -1;
+}
+
+// 记录当前页首（而不是下一页起点），重新打开时回到同一页。只写进度日志的内存副本
+static void remember_position(void) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    if (reader != NULL && g_reader_state.current_page > 0) {
+        const txt_position_t pos = txt_reader_get_position(reader);
+        txt_reader_set_position(reader, g_reader_state.page_start, g_reader_state.current_page - 1);
+        txt_reader_save_position(reader);
+        txt_reader_set_position(reader, pos.file_position, pos.page_number);
+    } else if (g_reader_state.epub_reader != NULL) {
+        epub_parser_save_position(g_reader_state.epub_reader);
+    } else if ((g_reader_state.x4pg_book != NULL || g_reader_state.cbz_book != NULL) &&
+               g_reader_state.current_page > 0) {
+        position_journal_put(position_journal_key(g_reader_state.file_path),
+                             g_reader_state.current_page, 0);
+    }
+}
+
 // 更新页面显示
 static void update_page_display(void) {
     if (!g_reader_state.is_open || g_reader_state.text_buffer == NULL) {
@@ -142,68 +768,659 @@ static void update_page_display(void) {
     int chars_read = 0;
 
     if (g_reader_state.book_type == BOOK_TYPE_TXT && g_reader_state.txt_reader != NULL) {
-        int chars_per_page = get_chars_per_page(g_reader_state.settings.font_size);
-        chars_read = txt_reader_read_page(g_reader_state.txt_reader, g_reader_state.text_buffer,
-                                          g_reader_state.buffer_size, chars_per_page);
-
-        // 更新位置
-        txt_position_t pos = txt_reader_get_position(g_reader_state.txt_reader);
-        g_reader_state.current_page = pos.page_number;
-        g_reader_state.total_pages = txt_reader_get_total_pages(g_reader_state.txt_reader, chars_per_page);
+        txt_reader_t *reader = g_reader_state.txt_reader;
+        const txt_position_t pos = txt_reader_get_position(reader);
+
+        // 排版引擎给出精确的页边界：阅读器前进到下一页起点
+        const long end = layout_page_at(pos.file_position, g_reader_state.text_buffer,
+                                        g_reader_state.buffer_size, &g_reader_state.page_layout);
+        if (end > pos.file_position) {
+            // 页首在索引中时以索引页码为准（恢复的进度或估算页码可能不准）
+            int page = pos.page_number + 1;
+            const int indexed = page_index_find_page(pos.file_position);
+            if (indexed > 0 && page_index_page_start(indexed) == pos.file_position) {
+                page = indexed;
+            }
+            txt_reader_set_position(reader, end, page);
+            g_reader_state.page_start = pos.file_position;
+            g_reader_state.page_end = end;
+            g_reader_state.current_page = page;
+            chars_read = (int)(end - pos.file_position);
+        }
+        if (page_index_is_complete()) {
+            g_reader_state.total_pages = page_index_page_count();
+            index_scratch_free();
+        } else {
+            g_reader_state.total_pages = txt_reader_get_total_pages(
+                reader, get_chars_per_page(g_reader_state.settings.font_size));
+            // 索引重建期间按已索引部分的平均页长估计，比按字数估计更接近新版式
+            const int estimate = page_index_estimate_total();
+            if (estimate > 0) {
+                g_reader_state.total_pages = estimate;
+            }
+        }
+        if (g_reader_state.total_pages < g_reader_state.current_page) {
+            g_reader_state.total_pages = g_reader_state.current_page;
+        }
 
     } else if (g_reader_state.book_type == BOOK_TYPE_EPUB && g_reader_state.epub_reader != NULL) {
-        // EPUB 支持（简化版本）
-        snprintf(g_reader_state.text_buffer, g_reader_state.buffer_size,
-                "EPUB support\n\nFile: %s\n\nEPUB format requires pre-extraction.\nPlease extract EPUB to /sdcard/XTCache/ directory.",
-                g_reader_state.file_path);
-        chars_read = strlen(g_reader_state.text_buffer);
+        if (epub_pages_loaded(&g_reader_state.epub_pages) && g_reader_state.text_view != NULL) {
+            epub_show_current_page();
+        } else {
+            snprintf(g_reader_state.text_buffer, g_reader_state.buffer_size,
+                     "Failed to load chapter %d\n\nFile: %s",
+                     g_reader_state.epub_reader->position.current_chapter + 1, g_reader_state.file_path);
+            chars_read = strlen(g_reader_state.text_buffer);
+            text_layout_paginate(g_reader_state.layout, g_reader_state.text_buffer, (uint32_t)chars_read,
+                                 true, &g_reader_state.page_layout);
+        }
+
+    } else if (g_reader_state.x4pg_book != NULL || g_reader_state.cbz_book != NULL) {
+        // 正文控件保持空白，页面在渲染完成后由 x4pg_render_cb 写入
+        g_reader_state.total_pages = g_reader_state.x4pg_book != NULL
+                                         ? x4pg_book_page_count(g_reader_state.x4pg_book)
+                                         : cbz_book_page_count(g_reader_state.cbz_book);
+        if (g_reader_state.current_page < 1) g_reader_state.current_page = 1;
+        if (g_reader_state.current_page > g_reader_state.total_pages) {
+            g_reader_state.current_page = g_reader_state.total_pages;
+        }
+        // CBZ 页在这里解码（通常已由后台预先准备好），渲染回调只解压
+        if (g_reader_state.cbz_book != NULL && !g_reader_state.key_skipping) {
+            cbz_book_prepare(g_reader_state.cbz_book, g_reader_state.current_page - 1);
+        }
+        turn_stats_mark(TURN_STAGE_FETCH);
+        lv_obj_invalidate(g_reader_state.screen);
     }
 
     // 更新显示
-    if (chars_read > 0 && g_reader_state.text_label != NULL) {
-        lv_label_set_text(g_reader_state.text_label, g_reader_state.text_buffer);
+    if (chars_read > 0 && g_reader_state.text_view != NULL) {
+        text_view_set_page(g_reader_state.text_view, g_reader_state.text_buffer,
+                           &g_reader_state.page_layout);
     }
 
-    // 更新进度
-    if (g_reader_state.progress_label != NULL) {
-        char progress_str[32];
-        snprintf(progress_str, sizeof(progress_str), "%d / %d",
-                 g_reader_state.current_page, g_reader_state.total_pages);
-        lv_label_set_text(g_reader_state.progress_label, progress_str);
+    update_progress_label();
+    remember_position();
+}
+
+// 页面缓存只覆盖 TXT 正文；菜单、搜索浮层或章节列表打开、灰阶渲染时按普通方式绘制，按住翻页时不写回
+static bool page_cache_usable(void) {
+    return g_reader_state.page_cache_ready && g_reader_state.txt_reader != NULL &&
+           !g_reader_state.key_skipping && !search_list_is_open() && !chapter_list_is_open() &&
+           !dict_popup_is_open() &&
+           lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN) && !lvgl_is_grayscale();
+}
+
+// 修改正文控件但不触发重绘：framebuffer 中已是该页像素（缓存写回或仍显示旧页）
+static void set_page_silently(const char *text, const text_page_layout_t *layout) {
+    lv_display_enable_invalidation(NULL, false);
+    text_view_set_page(g_reader_state.text_view, text, layout);
+    lv_display_enable_invalidation(NULL, true);
+}
+
+// 使整个页面区域失效（页面变短时旧内容也要被背景覆盖）
+static void invalidate_page_region(void) {
+    lv_area_t region = {0, STATUS_BAR_HEIGHT, lv_display_get_horizontal_resolution(NULL) - 1,
+                        lv_display_get_vertical_resolution(NULL) - 1};
+    lv_obj_invalidate_area(g_reader_state.screen, &region);
+}
+
+// 用缓存位图显示页面：只重读文本（供控件保持一致），不重新光栅化
+static bool show_cached_page(const page_cache_page_t *cached) {
+    if (cached == NULL || !page_cache_usable()) {
+        return false;
+    }
+    const page_cache_page_t page = *cached;
+    txt_reader_t *reader = g_reader_state.txt_reader;
+
+    if (layout_page_at(page.start, g_reader_state.text_buffer, g_reader_state.buffer_size,
+                       &g_reader_state.page_layout) != page.end ||
+        !txt_reader_set_position(reader, page.end, page.page)) {
+        return false;
+    }
+
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    if (!page_cache_show(cached)) {
+        // 写回失败：控件照常更新，整页重新渲染
+        text_view_set_page(g_reader_state.text_view, g_reader_state.text_buffer,
+                           &g_reader_state.page_layout);
+        invalidate_page_region();
+    } else {
+        set_page_silently(g_reader_state.text_buffer, &g_reader_state.page_layout);
+    }
+
+    g_reader_state.page_start = page.start;
+    g_reader_state.page_end = page.end;
+    g_reader_state.current_page = page.page;
+    page_cache_set_current(page.page);
+    update_progress_label();
+    remember_position();
+    return true;
+}
+
+// 离屏预渲染下一页：读出文本、渲染到捕获缓冲区压缩入缓存，再把控件恢复为当前页
+static void prerender_next_page(void) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    const txt_position_t saved = txt_reader_get_position(reader);
+    if (g_reader_state.page_end >= saved.file_size || page_cache_find(g_reader_state.page_end) != NULL) {
+        return;
+    }
+
+    char *text = malloc(TEXT_BUFFER_SIZE);
+    text_page_layout_t *layout = malloc(sizeof(text_page_layout_t));
+    if (text == NULL || layout == NULL) {
+        free(text);
+        free(layout);
+        return;
+    }
+
+    page_cache_page_t next = {
+        .start = g_reader_state.page_end,
+        .page = g_reader_state.current_page + 1,
+    };
+    next.end = layout_page_at(next.start, text, TEXT_BUFFER_SIZE, layout);
+
+    // 先渲染其它待绘制内容，捕获期间只能有页面区域失效
+    power_manager_lock(POWER_LOCK_CPU);
+    lv_refr_now(NULL);
+    if (next.end > next.start && page_cache_capture_begin()) {
+        text_view_set_page(g_reader_state.text_view, text, layout);
+        invalidate_page_region();
+        lv_refr_now(NULL);
+        page_cache_capture_end(&next);
+        set_page_silently(g_reader_state.text_buffer, &g_reader_state.page_layout);
+    }
+    power_manager_unlock(POWER_LOCK_CPU);
+    free(text);
+    free(layout);
+}
+
+static void prerender_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    g_reader_state.prerender_timer = NULL;
+    if (!g_reader_state.is_open || !page_cache_usable()) {
+        return;
+    }
+
+    // 当前页直接取自 framebuffer，后退翻页即可命中
+    const page_cache_page_t current = {
+        .start = g_reader_state.page_start,
+        .end = g_reader_state.page_end,
+        .page = g_reader_state.current_page,
+    };
+    page_cache_set_current(current.page);
+    page_cache_store_displayed(&current);
+    // 最近多是往回翻时不预渲染下一页，后退翻页仍由页缓存命中
+    if (reading_pace_prerender_next()) {
+        prerender_next_page();
+    }
+}
+
+// 页面显示后（重新）开始计时，连续翻页期间不做预渲染
+static void schedule_prerender(void) {
+    if (!g_reader_state.page_cache_ready) {
+        return;
+    }
+    const uint32_t delay = reading_pace_prerender_delay(PRERENDER_DELAY_MS);
+    if (g_reader_state.prerender_timer != NULL) {
+        lv_timer_set_period(g_reader_state.prerender_timer, delay);
+        lv_timer_reset(g_reader_state.prerender_timer);
+        return;
+    }
+    g_reader_state.prerender_timer = lv_timer_create(prerender_timer_cb, delay, NULL);
+    if (g_reader_state.prerender_timer != NULL) {
+        lv_timer_set_repeat_count(g_reader_state.prerender_timer, 1);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 后台打开：TXT/EPUB 的打开（编码检测、gzip 头、ZIP 目录与 OPF 解析）是后台作业，
+// LVGL 任务先建好外框并照常响应返回键。完成回调在后台任务中把结果交给阅读器；
+// 代号对不上说明阅读器已放弃这次打开（返回或按新方向重新打开），回调自己关闭释放。
+// EPUB 缓存没有锁，查缓存与写缓存都留在 LVGL 任务：提交前先查，命中时不提交作业；
+// 作业只解析 ZIP 与 OPF，解析结果由接收定时器写入缓存
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t gen;
+    book_type_t type;
+    char path[256];
+    txt_reader_t *txt;
+    epub_reader_t *epub;
+    bool parsed;              // EPUB 由作业解析得到，接收时写入缓存
+} book_open_t;
+
+static struct {
+    SemaphoreHandle_t lock;
+    uint32_t gen;
+    bg_job_id_t job;
+    book_open_t *ready;       // 打开成功、等待阅读器接收
+    bool done;                // 本次打开已结束（ready 为 NULL 表示失败）
+} s_open;
+
+// 阅读器在后台任务中分配，不从会话 arena 切出（reader_arena_free 照样能释放）；
+// 可能在后台任务中释放，EPUB 用 epub_parser_discard，不触碰缓存
+static void book_open_release(book_open_t *op) {
+    if (op->txt != NULL) {
+        txt_reader_close(op->txt);
+        txt_reader_cleanup(op->txt);
+        reader_arena_free(op->txt);
+    }
+    if (op->epub != NULL) {
+        epub_parser_discard(op->epub);
+        reader_arena_free(op->epub);
+    }
+    free(op);
+}
+
+// 一步完成：打开本身不能拆分，放弃打开时结果由收尾回调丢弃
+static bool book_open_step(bg_job_t *job, void *arg) {
+    (void)job;
+    book_open_t *op = (book_open_t *)arg;
+    if (op->type == BOOK_TYPE_TXT) {
+        op->txt = reader_arena_calloc(1, sizeof(txt_reader_t));
+        if (op->txt != NULL && !(txt_reader_init(op->txt) &&
+                                 txt_reader_open(op->txt, op->path, TXT_ENCODING_AUTO))) {
+            txt_reader_cleanup(op->txt);
+            reader_arena_free(op->txt);
+            op->txt = NULL;
+        }
+    } else {
+        op->epub = reader_arena_calloc(1, sizeof(epub_reader_t));
+        if (op->epub != NULL && !(epub_parser_init(op->epub) &&
+                                  epub_parser_parse(op->epub, op->path))) {
+            epub_parser_discard(op->epub);
+            reader_arena_free(op->epub);
+            op->epub = NULL;
+        }
+        op->parsed = op->epub != NULL;
+    }
+    return false;
+}
+
+static void book_open_done(void *arg, bool finished) {
+    book_open_t *op = (book_open_t *)arg;
+    const bool opened = finished && (op->txt != NULL || op->epub != NULL);
+    xSemaphoreTake(s_open.lock, portMAX_DELAY);
+    const bool wanted = op->gen == s_open.gen;
+    if (wanted) {
+        s_open.ready = opened ? op : NULL;
+        s_open.done = true;
+        s_open.job = BG_JOB_NONE;
+    }
+    xSemaphoreGive(s_open.lock);
+    if (!wanted || !opened) {
+        book_open_release(op);
+    }
+    lvgl_timer_task_wake();
+}
+
+// EPUB 缓存命中时在 LVGL 任务中直接打开，结果照样交给接收定时器
+static bool book_open_cached(book_open_t *op) {
+    if (op->type != BOOK_TYPE_EPUB) {
+        return false;
+    }
+    op->epub = reader_arena_calloc(1, sizeof(epub_reader_t));
+    if (op->epub == NULL) {
+        return false;
+    }
+    if (!(epub_parser_init(op->epub) && epub_parser_open_cached(op->epub, op->path))) {
+        epub_parser_discard(op->epub);
+        reader_arena_free(op->epub);
+        op->epub = NULL;
+        return false;
+    }
+    xSemaphoreTake(s_open.lock, portMAX_DELAY);
+    op->gen = ++s_open.gen;
+    s_open.ready = op;
+    s_open.done = true;
+    s_open.job = BG_JOB_NONE;
+    xSemaphoreGive(s_open.lock);
+    return true;
+}
+
+// 提交打开作业；预算为阅读器与读取窗口（EPUB 为章节表）的大小
+static bool book_open_start(void) {
+    if (s_open.lock == NULL) {
+        s_open.lock = xSemaphoreCreateMutex();
+        if (s_open.lock == NULL) {
+            return false;
+        }
+    }
+    book_open_t *op = calloc(1, sizeof(book_open_t));
+    if (op == NULL) {
+        return false;
+    }
+    op->type = g_reader_state.book_type;
+    strncpy(op->path, g_reader_state.file_path, sizeof(op->path) - 1);
+    if (book_open_cached(op)) {
+        return true;
+    }
+
+    xSemaphoreTake(s_open.lock, portMAX_DELAY);
+    op->gen = ++s_open.gen;
+    s_open.ready = NULL;
+    s_open.done = false;
+    const bg_job_desc_t desc = {
+        .name = "book_open",
+        .prio = BG_JOB_PRIO_HIGH,
+        .mem_budget = op->type == BOOK_TYPE_TXT
+                          ? sizeof(txt_reader_t) + TXT_READER_BUFFER_SIZE
+                          : sizeof(epub_reader_t) + READER_ARENA_EPUB_TABLES,
+        .step = book_open_step,
+        .done = book_open_done,
+        .arg = op,
+    };
+    s_open.job = bg_jobs_submit(&desc);
+    xSemaphoreGive(s_open.lock);
+
+    if (s_open.job == BG_JOB_NONE) {
+        free(op);
+        return false;
+    }
+    return true;
+}
+
+// 取出打开结果（成功时 *op 非 NULL，归调用方所有）；返回 false 表示还没结束
+static bool book_open_take(book_open_t **op) {
+    xSemaphoreTake(s_open.lock, portMAX_DELAY);
+    const bool done = s_open.done;
+    *op = s_open.ready;
+    s_open.ready = NULL;
+    s_open.done = false;
+    xSemaphoreGive(s_open.lock);
+    return done;
+}
+
+// 放弃进行中的打开：排队中的作业不再运行，正在打开的由收尾回调释放
+static void book_open_cancel(void) {
+    if (s_open.lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_open.lock, portMAX_DELAY);
+    s_open.gen++;
+    const bg_job_id_t job = s_open.job;
+    book_open_t *ready = s_open.ready;
+    s_open.job = BG_JOB_NONE;
+    s_open.ready = NULL;
+    s_open.done = false;
+    xSemaphoreGive(s_open.lock);
+
+    if (job != BG_JOB_NONE) {
+        bg_jobs_cancel(job);
+    }
+    if (ready != NULL) {
+        book_open_release(ready);
+    }
+}
+
+// 刷新上屏；第一次刷新后把标题栏左侧（书名）缓存为不透明图层，之后翻页、整屏重绘
+// 都不再渲染它，也不进入脏区。X4PG 与 CBZ 页是整帧位图，覆盖标题栏，不使用图层
+static void reader_refresh(screen_refresh_intent_t intent) {
+    screen_manager_refresh(intent);
+    if (!g_reader_state.chrome_shown && g_reader_state.book_type != BOOK_TYPE_X4PG &&
+        g_reader_state.book_type != BOOK_TYPE_CBZ) {
+        lv_area_t chrome;
+        lv_obj_get_coords(g_reader_state.title_label, &chrome);
+        chrome.x1 = 0;
+        chrome.y1 = 0;
+        chrome.y2 = STATUS_BAR_HEIGHT - 1;
+        lvgl_layer_capture(&chrome, true);
+    }
+    g_reader_state.chrome_shown = true;
+}
+
+// 书已打开：读入上次位置，排版并先显示这一页；分页索引、全书页数与搜索索引随后在
+// 定时器和后台作业中补齐
+static void reader_show_first_page(void) {
+    g_reader_state.is_open = true;
+    if (g_reader_state.txt_reader != NULL) {
+        txt_reader_load_position(g_reader_state.txt_reader);
+    } else if (g_reader_state.epub_reader != NULL) {
+        epub_parser_load_position(g_reader_state.epub_reader);
+    }
+    if (g_reader_state.open_label != NULL) {
+        lv_obj_delete(g_reader_state.open_label);
+        g_reader_state.open_label = NULL;
+    }
+    layout_reset();
+    update_page_display();
+
+    // 外框已因打开较慢先上屏时只是正文更换，否则由 screen_manager 按画面变化量决定
+    reader_refresh(g_reader_state.chrome_shown ? SCREEN_REFRESH_CONTENT
+                                               : SCREEN_REFRESH_TRANSITION);
+    schedule_prerender();
+
+    // 章节目录、搜索索引与子集字体在后台构建，已有时立即可用（都直接读文件，gzip 压缩的
+    // 书不建）。目录只读一遍书，先提交，很快就能用
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    if (reader != NULL && reader->gz == NULL) {
+        const long file_size = txt_reader_get_position(reader).file_size;
+        const txt_toc_config_t toc_cfg = {
+            .file_path = g_reader_state.file_path,
+            .file_size = file_size,
+            .content_start = reader->content_start,
+            .encoding = reader->encoding,
+        };
+        txt_toc_open(&toc_cfg);
+        const book_search_config_t search_cfg = {
+            .file_path = g_reader_state.file_path,
+            .file_size = file_size,
+            .content_start = reader->content_start,
+            .encoding = reader->encoding,
+        };
+        book_search_open(&search_cfg);
+        const font_subset_config_t subset_cfg = {
+            .file_path = g_reader_state.file_path,
+            .file_size = file_size,
+            .content_start = reader->content_start,
+            .encoding = reader->encoding,
+        };
+        font_subset_open(&subset_cfg);
+    }
+    ESP_LOGI(TAG, "Book opened: %s", g_reader_state.file_path);
+}
+
+// 打开失败：提示留在屏幕上，返回键退出
+static void reader_show_open_error(void) {
+    ESP_LOGE(TAG, "Failed to open book: %s", g_reader_state.file_path);
+    lv_label_set_text(g_reader_state.open_label, "无法打开这本书");
+    lv_obj_clear_flag(g_reader_state.open_label, LV_OBJ_FLAG_HIDDEN);
+    reader_refresh(g_reader_state.chrome_shown ? SCREEN_REFRESH_CONTENT
+                                               : SCREEN_REFRESH_TRANSITION);
+}
+
+// 接收打开结果：作业解析出的 EPUB 先写入缓存，再显示第一页；失败时显示提示
+static void open_finish(book_open_t *op) {
+    lv_timer_delete(g_reader_state.open_timer);
+    g_reader_state.open_timer = NULL;
+    if (op == NULL) {
+        reader_show_open_error();
+        return;
+    }
+    if (op->parsed) {
+        epub_parser_store_cache(op->epub);
+    }
+    g_reader_state.txt_reader = op->txt;
+    g_reader_state.epub_reader = op->epub;
+    free(op);
+    reader_show_first_page();
+}
+
+static void open_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    book_open_t *op = NULL;
+    if (book_open_take(&op)) {
+        open_finish(op);
+    } else if (!g_reader_state.chrome_shown &&
+               lv_tick_elaps(g_reader_state.open_start) >= BOOK_OPEN_PLACEHOLDER_MS) {
+        lv_obj_clear_flag(g_reader_state.open_label, LV_OBJ_FLAG_HIDDEN);
+        reader_refresh(SCREEN_REFRESH_TRANSITION);
     }
 }
 
 // 清理阅读器资源
 static void cleanup_reader(void) {
-    // 保存进度
+    // 还在后台打开时放弃这次打开
+    if (g_reader_state.open_timer != NULL) {
+        lv_timer_delete(g_reader_state.open_timer);
+        g_reader_state.open_timer = NULL;
+    }
+    book_open_cancel();
+    status_refresh_stop();
+    reading_pace_end();
+    ble_remote_set_reading(false);
+    // 先停止索引构建（它会读取 TXT 文件），保存已完成的部分
+    page_index_close();
+    book_search_close();
+    txt_toc_close();
+    font_subset_close();
+    dict_close();
+    index_scratch_free();
+
+    // 保存进度：日志里已是最新位置，退出时立即写入 NVS
+    remember_position();
+    position_journal_flush();
+
     if (g_reader_state.txt_reader != NULL) {
-        txt_reader_save_position(g_reader_state.txt_reader);
         txt_reader_close(g_reader_state.txt_reader);
         txt_reader_cleanup(g_reader_state.txt_reader);
-        free(g_reader_state.txt_reader);
+        reader_arena_free(g_reader_state.txt_reader);
         g_reader_state.txt_reader = NULL;
     }
 
+    // 预取与页数统计的定时器引用着阅读器与排版上下文，先停止
+    epub_progress_close();
+    epub_prefetch_cancel();
+    epub_pipeline_cancel();
+    epub_pages_free(&g_reader_state.epub_pages);
+    epub_image_free(&g_reader_state.page_image);
+    if (g_reader_state.image_timer != NULL) {
+        lv_timer_delete(g_reader_state.image_timer);
+        g_reader_state.image_timer = NULL;
+    }
+    g_reader_state.image_failed = false;
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), epub_image_render_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), x4pg_render_cb, NULL);
+    x4pg_book_close(g_reader_state.x4pg_book);
+    g_reader_state.x4pg_book = NULL;
+    cbz_book_close(g_reader_state.cbz_book);
+    g_reader_state.cbz_book = NULL;
+    lvgl_layer_release();
+    // 横屏只属于阅读器，离开时恢复打开前的方向
+    lvgl_set_landscape(g_reader_state.was_landscape);
+
     if (g_reader_state.epub_reader != NULL) {
-        epub_parser_save_position(g_reader_state.epub_reader);
         epub_parser_close(g_reader_state.epub_reader);
         epub_parser_cleanup(g_reader_state.epub_reader);
-        free(g_reader_state.epub_reader);
+        reader_arena_free(g_reader_state.epub_reader);
         g_reader_state.epub_reader = NULL;
     }
 
     if (g_reader_state.text_buffer != NULL) {
-        free(g_reader_state.text_buffer);
+        reader_arena_free(g_reader_state.text_buffer);
         g_reader_state.text_buffer = NULL;
     }
 
+    if (g_reader_state.layout != NULL) {
+        reader_arena_free(g_reader_state.layout);
+        g_reader_state.layout = NULL;
+    }
+
+    if (g_reader_state.prerender_timer != NULL) {
+        lv_timer_delete(g_reader_state.prerender_timer);
+        g_reader_state.prerender_timer = NULL;
+    }
+    if (g_reader_state.page_cache_ready) {
+        page_cache_deinit();
+        g_reader_state.page_cache_ready = false;
+    }
+
+    // 夜间模式只属于阅读器，离开时恢复正常显示
+    if (g_reader_state.settings.night_mode) {
+        g_reader_state.settings.night_mode = false;
+        lvgl_set_night_mode(false);
+    }
+
     g_reader_state.is_open = false;
+    // 上面各项释放对 arena 内的块是空操作，这里整块归还
+    reader_arena_end();
 }
 
 // 事件回调
 static void reader_key_event_cb(lv_event_t *e) {
     lv_key_t key = lv_indev_get_key(lv_indev_get_act());
 
+    // 书还在后台打开（或打开失败）：只响应返回键
+    if (!g_reader_state.is_open) {
+        if (key == LV_KEY_ESC) {
+            g_reader_state.pending_action = READER_ACTION_EXIT;
+            lv_async_call(reader_process_pending_action_cb, NULL);
+        }
+        return;
+    }
+
+    // 章节列表打开时按键全部交给它
+    if (chapter_list_is_open()) {
+        g_reader_state.pending_action = READER_ACTION_TOC_KEY;
+        g_reader_state.pending_key = key;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // 搜索浮层同样独占按键
+    if (search_list_is_open()) {
+        g_reader_state.pending_action = READER_ACTION_SEARCH_KEY;
+        g_reader_state.pending_key = key;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // 查词浮层也是
+    if (dict_popup_is_open()) {
+        g_reader_state.pending_action = READER_ACTION_DICT_KEY;
+        g_reader_state.pending_key = key;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // EPUB 菜单中 → 打开章节列表
+    if (key == LV_KEY_RIGHT && g_reader_state.epub_reader != NULL &&
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        g_reader_state.pending_action = READER_ACTION_SHOW_TOC;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // TXT 菜单中 ↓ 打开章节列表
+    if (key == LV_KEY_DOWN && g_reader_state.txt_reader != NULL &&
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        g_reader_state.pending_action = READER_ACTION_SHOW_TOC;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // TXT 菜单中 → 打开搜索
+    if (key == LV_KEY_RIGHT && g_reader_state.txt_reader != NULL &&
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        g_reader_state.pending_action = READER_ACTION_SHOW_SEARCH;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // 菜单中 ← → 切换夜间模式
+    if (key == LV_KEY_LEFT && !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        g_reader_state.pending_action = READER_ACTION_TOGGLE_NIGHT;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
+    // 菜单中 ↑ → 切换阅读方向
+    if (key == LV_KEY_UP && !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN)) {
+        g_reader_state.pending_action = READER_ACTION_CYCLE_ORIENTATION;
+        lv_async_call(reader_process_pending_action_cb, NULL);
+        return;
+    }
+
     switch (key) {
         case LV_KEY_UP:
         case LV_KEY_RIGHT:
@@ -248,44 +1465,86 @@ static void reader_key_event_cb(lv_event_t *e) {
     }
 }
 
+// 按键快速通道：菜单和章节列表都关着时，翻页键从按键队列直接进入翻页流程，
+// 不经过输入设备读取、组导航和 lv_async_call（预渲染的下一页照常命中页面缓存）。
+// 音量键与长按重复的映射一致：上 = 下一页，下 = 上一页
+// 确认键也在这里接管：短按松开时弹出菜单，按住 READER_DICT_HOLD_MS 打开查词浮层
+static bool reader_fast_key_hook(button_t btn, lvgl_key_phase_t phase) {
+    if (phase == LVGL_KEY_RELEASE) {
+        if (btn == BTN_CONFIRM && g_reader_state.confirm_down) {
+            g_reader_state.confirm_down = false;
+            if (!g_reader_state.confirm_long && g_reader_state.pending_action == READER_ACTION_NONE) {
+                g_reader_state.pending_action = READER_ACTION_SHOW_MENU;
+                lv_async_call(reader_process_pending_action_cb, NULL);
+            }
+            return true;
+        }
+        finish_skip();
+        return true;
+    }
+    if (!g_reader_state.is_open || lv_obj_has_flag(g_reader_state.screen, LV_OBJ_FLAG_HIDDEN) ||
+        chapter_list_is_open() || search_list_is_open() || dict_popup_is_open() ||
+        !lv_obj_has_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN) ||
+        g_reader_state.pending_action != READER_ACTION_NONE) {
+        return false;
+    }
+    int delta;
+    switch (btn) {
+        case BTN_CONFIRM:
+            if (phase == LVGL_KEY_PRESS) {
+                g_reader_state.confirm_down = true;
+                g_reader_state.confirm_long = false;
+                g_reader_state.confirm_tick = lv_tick_get();
+            } else if (g_reader_state.confirm_down && !g_reader_state.confirm_long &&
+                       lv_tick_elaps(g_reader_state.confirm_tick) >= READER_DICT_HOLD_MS) {
+                g_reader_state.confirm_long = true;
+                g_reader_state.pending_action = READER_ACTION_SHOW_DICT;
+                lv_async_call(reader_process_pending_action_cb, NULL);
+            }
+            return true;
+        case BTN_RIGHT:
+        case BTN_VOLUME_UP:
+            delta = 1;
+            break;
+        case BTN_LEFT:
+        case BTN_VOLUME_DOWN:
+            delta = -1;
+            break;
+        default:
+            return false;
+    }
+    // 单击立即绘制；按住后的重复只跳页，松开时绘制最终页
+    if (phase == LVGL_KEY_REPEAT) {
+        skip_page(delta);
+    } else if (delta > 0) {
+        reader_screen_next_page();
+    } else {
+        reader_screen_prev_page();
+    }
+    return true;
+}
+
 // 处理待处理动作
 static void reader_process_pending_action_cb(void *user_data) {
     (void)user_data;
 
     switch (g_reader_state.pending_action) {
         case READER_ACTION_NEXT_PAGE:
-            update_page_display();
-            lvgl_trigger_render(NULL);
-            lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-            lvgl_display_refresh_partial();
+            reader_screen_next_page();
             break;
 
         case READER_ACTION_PREV_PAGE:
-            // TXT 阅读器可以后退
-            if (g_reader_state.book_type == BOOK_TYPE_TXT && g_reader_state.txt_reader != NULL) {
-                txt_position_t pos = txt_reader_get_position(g_reader_state.txt_reader);
-                if (pos.page_number > 1) {
-                    txt_reader_goto_page(g_reader_state.txt_reader, pos.page_number - 1);
-                    update_page_display();
-                    lvgl_trigger_render(NULL);
-                    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-                    lvgl_display_refresh_partial();
-                }
-            }
+            reader_screen_prev_page();
             break;
 
         case READER_ACTION_SHOW_MENU:
             lv_obj_clear_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN);
-            lvgl_trigger_render(NULL);
-            lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-            lvgl_display_refresh_partial();
+            screen_manager_refresh(SCREEN_REFRESH_FOCUS);
             break;
 
         case READER_ACTION_HIDE_MENU:
             lv_obj_add_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN);
-            lvgl_trigger_render(NULL);
-            lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-            lvgl_display_refresh_partial();
+            screen_manager_refresh(SCREEN_REFRESH_FOCUS);
             break;
 
         case READER_ACTION_EXIT:
@@ -298,6 +1557,94 @@ static void reader_process_pending_action_cb(void *user_data) {
             screen_manager_show_index();
             break;
 
+        case READER_ACTION_SHOW_TOC: {
+            const lv_font_t *font = font_manager_get_font();
+            lv_obj_add_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN);
+            const lv_font_t *list_font = font != NULL ? font : get_lvgl_font(14);
+            // 列表盖住整个屏幕（包括标题栏图层），关闭后图层整块写回
+            const bool opened = g_reader_state.epub_reader != NULL
+                ? chapter_list_open(g_reader_state.screen, g_reader_state.epub_reader, list_font)
+                : chapter_list_open_txt(g_reader_state.screen, g_reader_state.page_start, list_font);
+            if (opened) {
+                lvgl_layer_set_enabled(false);
+            }
+            screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+            break;
+        }
+
+        case READER_ACTION_TOC_KEY: {
+            long target = 0;
+            const chapter_list_result_t result =
+                chapter_list_handle_key(g_reader_state.pending_key, &target);
+            if (result == CHAPTER_LIST_SELECTED) {
+                // TXT 的目录项就是标题行的文件偏移，跳转只是一次定位
+                if (g_reader_state.epub_reader != NULL) {
+                    epub_jump_to_chapter((int)target);
+                } else {
+                    txt_jump_to_offset(target);
+                }
+            }
+            lvgl_layer_set_enabled(!chapter_list_is_open());
+            // 关闭列表或跳转换了整片内容，列表内移动只是焦点变化
+            screen_manager_refresh(result == CHAPTER_LIST_NONE ? SCREEN_REFRESH_FOCUS
+                                                               : SCREEN_REFRESH_CONTENT);
+            break;
+        }
+
+        case READER_ACTION_TOGGLE_NIGHT:
+            reader_screen_set_night_mode(!g_reader_state.settings.night_mode);
+            break;
+
+        case READER_ACTION_CYCLE_ORIENTATION: {
+            // 控件尺寸、排版与页面缓存都取决于方向：保存进度后按新方向重新打开
+            char path[sizeof(g_reader_state.file_path)];
+            lv_indev_t *indev = g_reader_state.indev;
+            strncpy(path, g_reader_state.file_path, sizeof(path));
+            settings_set_int(SETTING_READER_ORIENTATION,
+                             (g_reader_state.settings.orientation + 1) % READER_ORIENTATION_COUNT);
+            reader_screen_close();
+            reader_screen_create_wrapper(path, indev);
+            break;
+        }
+
+        case READER_ACTION_SHOW_SEARCH: {
+            const lv_font_t *font = font_manager_get_font();
+            lv_obj_add_flag(g_reader_state.menu, LV_OBJ_FLAG_HIDDEN);
+            if (search_list_open(g_reader_state.screen, font != NULL ? font : get_lvgl_font(14))) {
+                lvgl_layer_set_enabled(false);
+            }
+            screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+            break;
+        }
+
+        case READER_ACTION_SHOW_DICT: {
+            const lv_font_t *font = font_manager_get_font();
+            if (dict_popup_open(g_reader_state.screen, g_reader_state.text_view,
+                                font != NULL ? font : get_lvgl_font(14))) {
+                screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+            }
+            break;
+        }
+
+        case READER_ACTION_DICT_KEY:
+            // 换词只重绘新旧下划线与浮层，关闭时只重绘浮层区域
+            dict_popup_handle_key(g_reader_state.pending_key);
+            screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+            break;
+
+        case READER_ACTION_SEARCH_KEY: {
+            long offset = 0;
+            const search_list_result_t result =
+                search_list_handle_key(g_reader_state.pending_key, &offset);
+            if (result == SEARCH_LIST_SELECTED) {
+                txt_jump_to_offset(offset);
+            }
+            lvgl_layer_set_enabled(!search_list_is_open());
+            screen_manager_refresh(result == SEARCH_LIST_NONE ? SCREEN_REFRESH_FOCUS
+                                                              : SCREEN_REFRESH_CONTENT);
+            break;
+        }
+
         default:
             break;
     }
@@ -310,6 +1657,16 @@ static void reader_screen_destroy_cb(lv_event_t *e) {
     ESP_LOGI(TAG, "Reader screen destroy callback");
     cleanup_reader();
     memset(&g_reader_state, 0, sizeof(g_reader_state));
+    // 离开阅读界面，归还乒乓 framebuffer 占用的内存
+    lvgl_set_double_buffer(false);
+}
+
+// 关闭阅读器：删除覆盖层，销毁回调保存进度并释放资源
+void reader_screen_close(void) {
+    if (g_reader_state.screen != NULL) {
+        ESP_LOGI(TAG, "Closing reader screen");
+        lv_obj_delete(g_reader_state.screen);
+    }
 }
 
 // 创建阅读器屏幕的 wrapper 函数
@@ -337,55 +1694,53 @@ void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev) {
     memset(&g_reader_state, 0, sizeof(g_reader_state));
     strncpy(g_reader_state.file_path, file_path, sizeof(g_reader_state.file_path) - 1);
     g_reader_state.book_type = book_type;
-    g_reader_state.settings.font_size = 14;
-    g_reader_state.settings.line_spacing = 2;
-    g_reader_state.settings.margin = 10;
-    g_reader_state.settings.auto_refresh = true;
+    g_reader_state.settings.font_size = (int)settings_get_int(SETTING_READER_FONT_SIZE);
+    g_reader_state.settings.line_spacing = (int)settings_get_int(SETTING_READER_LINE_SPACING);
+    g_reader_state.settings.margin = (int)settings_get_int(SETTING_READER_MARGIN);
+    g_reader_state.settings.auto_refresh = settings_get_bool(SETTING_READER_AUTO_REFRESH);
+    g_reader_state.settings.orientation =
+        (reader_orientation_t)settings_get_int(SETTING_READER_ORIENTATION);
     g_reader_state.indev = indev;
 
+    // 先切换方向：x4pg 按方向选择页面，控件与排版按切换后的分辨率创建
+    g_reader_state.was_landscape = lvgl_is_landscape();
+    lvgl_set_landscape(g_reader_state.settings.orientation != READER_ORIENTATION_PORTRAIT);
+
+    // 会话内长期存在的分配（文本缓冲区与排版上下文）从一整块 arena 切出，退出时整块释放，
+    // 反复开关书不在堆里留下碎片。预留不下时各自退回 malloc。TXT/EPUB 的阅读器与章节表
+    // 在后台打开作业中分配，走堆
+    reader_arena_begin(TEXT_BUFFER_SIZE + sizeof(text_layout_t));
+
     // 分配文本缓冲区
     g_reader_state.buffer_size = TEXT_BUFFER_SIZE;
-    g_reader_state.text_buffer = malloc(TEXT_BUFFER_SIZE);
-    if (g_reader_state.text_buffer == NULL) {
+    g_reader_state.text_buffer = reader_arena_alloc(TEXT_BUFFER_SIZE);
+    g_reader_state.layout = reader_arena_alloc(sizeof(text_layout_t));
+    if (g_reader_state.text_buffer == NULL || g_reader_state.layout == NULL) {
         ESP_LOGE(TAG, "Failed to allocate text buffer");
+        cleanup_reader();
         return;
     }
 
-    // 打开文件
-    if (book_type == BOOK_TYPE_TXT) {
-        g_reader_state.txt_reader = calloc(1, sizeof(txt_reader_t));
-        if (g_reader_state.txt_reader != NULL) {
-            if (txt_reader_init(g_reader_state.txt_reader) &&
-                txt_reader_open(g_reader_state.txt_reader, file_path, TXT_ENCODING_AUTO)) {
-                g_reader_state.is_open = true;
-                // 尝试加载上次阅读位置
-                txt_reader_load_position(g_reader_state.txt_reader);
-            } else {
-                txt_reader_cleanup(g_reader_state.txt_reader);
-                free(g_reader_state.txt_reader);
-                g_reader_state.txt_reader = NULL;
-            }
+    // X4PG 只读文件头与页表、CBZ 只读中心目录，直接打开；TXT/EPUB 在外框建好后交给后台作业
+    if (book_type == BOOK_TYPE_X4PG || book_type == BOOK_TYPE_CBZ) {
+        // 页面直接解压进 framebuffer，灰阶模式下没有可写的 1bpp 缓冲区
+        const int32_t width = lv_display_get_horizontal_resolution(NULL);
+        const int32_t height = lv_display_get_vertical_resolution(NULL);
+        if (!lvgl_is_grayscale() && book_type == BOOK_TYPE_X4PG) {
+            g_reader_state.x4pg_book = x4pg_book_open(file_path, width < height);
+        } else if (!lvgl_is_grayscale()) {
+            g_reader_state.cbz_book = cbz_book_open(file_path, (int)width, (int)height);
         }
-    } else if (book_type == BOOK_TYPE_EPUB) {
-        g_reader_state.epub_reader = calloc(1, sizeof(epub_reader_t));
-        if (g_reader_state.epub_reader != NULL) {
-            if (epub_parser_init(g_reader_state.epub_reader) &&
-                epub_parser_open(g_reader_state.epub_reader, file_path)) {
-                g_reader_state.is_open = true;
-                // 尝试加载上次阅读位置
-                epub_parser_load_position(g_reader_state.epub_reader);
-            } else {
-                epub_parser_cleanup(g_reader_state.epub_reader);
-                free(g_reader_state.epub_reader);
-                g_reader_state.epub_reader = NULL;
-            }
+        if (g_reader_state.x4pg_book == NULL && g_reader_state.cbz_book == NULL) {
+            ESP_LOGE(TAG, "Failed to open book: %s", file_path);
+            cleanup_reader();
+            return;
+        }
+        int32_t page = 1;
+        int32_t unused = 0;
+        if (position_journal_get(position_journal_key(file_path), &page, &unused)) {
+            g_reader_state.current_page = (int)page;
         }
-    }
-
-    if (!g_reader_state.is_open) {
-        ESP_LOGE(TAG, "Failed to open book: %s", file_path);
-        cleanup_reader();
-        return;
     }
 
     // 创建屏幕容器
@@ -416,36 +1771,59 @@ void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev) {
 
     // 标题标签
     lv_obj_t *title_label = lv_label_create(g_reader_state.status_bar);
+    g_reader_state.title_label = title_label;
     lv_obj_set_style_text_font(title_label, get_lvgl_font(14), 0);
     lv_obj_set_style_text_color(title_label, lv_color_white(), 0);
-    lv_obj_set_width(title_label, LV_PCT(80));
+    lv_obj_set_width(title_label, LV_PCT(55));  // 右侧留给时钟、电量与页码
     lv_label_set_long_mode(title_label, LV_LABEL_LONG_DOT);
     lv_obj_align(title_label, LV_ALIGN_LEFT_MID, 5, 0);
 
     const char *filename = strrchr(file_path, '/');
     const char *display_name = filename ? filename + 1 : file_path;
-    lv_label_set_text(title_label, display_name);
+    const char *x4pg_title = x4pg_book_title(g_reader_state.x4pg_book);
+    lv_label_set_text(title_label, x4pg_title[0] != '\0' ? x4pg_title : display_name);
+
+    // 时钟与电量变化时只局刷状态栏
+    (void)screen_manager_update_battery();
+    status_refresh_start(g_reader_state.status_bar, status_update_cb);
+    reading_pace_begin();
+    ble_remote_set_reading(true);
 
     // 创建阅读区域
+    // 固定尺寸：排版引擎按它计算每页行数
     lv_obj_t *reading_area = lv_obj_create(g_reader_state.screen);
-    lv_obj_set_size(reading_area, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_pos(reading_area, 0, 40);
-    lv_obj_set_style_pad_all(reading_area, 10, 0);
+    lv_obj_set_size(reading_area, LV_PCT(100),
+                    lv_display_get_vertical_resolution(NULL) - STATUS_BAR_HEIGHT);
+    lv_obj_set_pos(reading_area, 0, STATUS_BAR_HEIGHT);
+    lv_obj_set_style_pad_all(reading_area, g_reader_state.settings.margin, 0);
     lv_obj_set_style_bg_color(reading_area, lv_color_white(), 0);
     lv_obj_set_style_border_width(reading_area, 0, 0);
+    lv_obj_set_scrollbar_mode(reading_area, LV_SCROLLBAR_MODE_OFF);
 
-    // 文本标签 - 使用当前设置的字体或默认字体
+    // 正文控件 - 使用当前设置的字体或默认字体
     const lv_font_t *current_font = font_manager_get_font();
     if (current_font == NULL) {
         current_font = get_lvgl_font(14);
     }
 
-    g_reader_state.text_label = lv_label_create(reading_area);
-    lv_obj_set_width(g_reader_state.text_label, LV_PCT(100));
-    lv_obj_set_style_text_font(g_reader_state.text_label, current_font, 0);
-    lv_obj_set_style_text_color(g_reader_state.text_label, lv_color_black(), 0);
-    lv_label_set_long_mode(g_reader_state.text_label, LV_LABEL_LONG_WRAP);
-    lv_obj_set_style_text_align(g_reader_state.text_label, LV_TEXT_ALIGN_LEFT, 0);
+    g_reader_state.text_view = text_view_create(reading_area);
+    if (g_reader_state.text_view == NULL) {
+        ESP_LOGE(TAG, "Failed to create text view");
+        lv_obj_delete(g_reader_state.screen);
+        return;
+    }
+    lv_obj_set_size(g_reader_state.text_view, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_text_font(g_reader_state.text_view, current_font, 0);
+    lv_obj_set_style_text_color(g_reader_state.text_view, lv_color_black(), 0);
+    lv_obj_set_style_text_line_space(g_reader_state.text_view, g_reader_state.settings.line_spacing, 0);
+
+    // 打开较慢或失败时的提示（排版在打开后进行）
+    g_reader_state.open_label = lv_label_create(reading_area);
+    lv_obj_set_style_text_font(g_reader_state.open_label, current_font, 0);
+    lv_obj_set_style_text_color(g_reader_state.open_label, lv_color_black(), 0);
+    lv_label_set_text(g_reader_state.open_label, "正在打开…");
+    lv_obj_center(g_reader_state.open_label);
+    lv_obj_add_flag(g_reader_state.open_label, LV_OBJ_FLAG_HIDDEN);
 
     // 创建菜单
     g_reader_state.menu = lv_obj_create(g_reader_state.screen);
@@ -461,7 +1839,26 @@ void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev) {
     lv_obj_t *menu_label = lv_label_create(g_reader_state.menu);
     lv_obj_set_style_text_font(menu_label, get_lvgl_font(14), 0);
     lv_obj_set_style_text_color(menu_label, lv_color_white(), 0);
-    lv_label_set_text(menu_label, "菜单:\n↑/→: 下一页\n↓/←: 上一页\nEnter: 返回\nESC: 退出");
+    lv_label_set_text(menu_label, book_type == BOOK_TYPE_EPUB
+                      ? "菜单:\n↑/→: 下一页\n↓/←: 上一页\n→ (菜单中): 目录\n← (菜单中): 夜间模式\n↑ (菜单中): 竖屏/横屏/双栏\n长按 Enter: 查词\nEnter: 返回\nESC: 退出"
+                      : "菜单:\n↑/→: 下一页\n↓/←: 上一页\n→ (菜单中): 搜索\n↓ (菜单中): 目录\n← (菜单中): 夜间模式\n↑ (菜单中): 竖屏/横屏/双栏\n长按 Enter: 查词\nEnter: 返回\nESC: 退出");
+
+    // EPUB 图片页在每次渲染完成后写入位图
+    if (book_type == BOOK_TYPE_EPUB) {
+        lv_display_add_event_cb(lv_display_get_default(), epub_image_render_cb,
+                                LV_EVENT_RENDER_READY, NULL);
+    } else if (book_type == BOOK_TYPE_X4PG || book_type == BOOK_TYPE_CBZ) {
+        lv_display_add_event_cb(lv_display_get_default(), x4pg_render_cb, LV_EVENT_RENDER_READY,
+                                NULL);
+    }
+
+    // TXT 正文启用页面位图缓存（页面区域为状态栏以下）
+    if (book_type == BOOK_TYPE_TXT) {
+        const lv_area_t page_region = {0, STATUS_BAR_HEIGHT,
+                                       lv_display_get_horizontal_resolution(NULL) - 1,
+                                       lv_display_get_vertical_resolution(NULL) - 1};
+        g_reader_state.page_cache_ready = page_cache_init(&page_region);
+    }
 
     // 设置输入设备
     lv_indev_set_group(indev, NULL);
@@ -472,43 +1869,186 @@ void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev) {
 
     // 添加按键事件回调
     lv_obj_add_event_cb(g_reader_state.screen, reader_key_event_cb, LV_EVENT_KEY, NULL);
+    lvgl_set_key_hook(g_reader_state.screen, reader_fast_key_hook);
 
-    // 读取第一页
-    update_page_display();
+    // 阅读期间开启乒乓 framebuffer，翻页时渲染与 EPD 上传重叠；
+    // 内存不足时保持单缓冲
+    lvgl_set_double_buffer(true);
 
-    // 触发渲染
-    lvgl_trigger_render(NULL);
-    lvgl_display_refresh_full();
+    if (book_type == BOOK_TYPE_X4PG || book_type == BOOK_TYPE_CBZ) {
+        reader_show_first_page();
+    } else {
+        // 结果由定时器接收：很快打开时直接显示第一页，只刷新一次；较慢时先显示外框与提示
+        g_reader_state.open_start = lv_tick_get();
+        g_reader_state.open_timer = lv_timer_create(open_timer_cb, BOOK_OPEN_POLL_MS, NULL);
+        if (g_reader_state.open_timer == NULL || !book_open_start()) {
+            if (g_reader_state.open_timer != NULL) {
+                lv_timer_delete(g_reader_state.open_timer);
+                g_reader_state.open_timer = NULL;
+            }
+            reader_show_open_error();
+        }
+    }
 
     ESP_LOGI(TAG, "Reader screen created successfully");
 }
 
+void reader_screen_wait_open(void) {
+    if (g_reader_state.open_timer == NULL) {
+        return;
+    }
+    book_open_t *op = NULL;
+    while (!book_open_take(&op)) {
+        vTaskDelay(pdMS_TO_TICKS(BOOK_OPEN_POLL_MS));
+    }
+    open_finish(op);
+}
+
 // 以下函数提供给外部调用（如果需要直接操作）
 
 reader_state_t* reader_screen_get_state(void) {
     return (reader_state_t*)&g_reader_state;
 }
 
-void reader_screen_next_page(void) {
-    if (g_reader_state.is_open) {
+const char *reader_screen_get_open_path(void) {
+    return g_reader_state.is_open ? g_reader_state.file_path : NULL;
+}
+
+// 前进一页：更新位置与控件，不渲染；EPUB 已在最后一页时返回 false
+static bool turn_page_forward(void) {
+    if (g_reader_state.epub_reader != NULL && !epub_turn_page(1)) {
+        return false;
+    }
+    if (g_reader_state.x4pg_book != NULL || g_reader_state.cbz_book != NULL) {
+        if (g_reader_state.current_page >= g_reader_state.total_pages) {
+            return false;
+        }
+        g_reader_state.current_page++;
         update_page_display();
+        return true;
+    }
+    const long before = g_reader_state.page_start;
+    if (!(page_cache_usable() && show_cached_page(page_cache_find(g_reader_state.page_end)))) {
+        update_page_display();
+    }
+    if (g_reader_state.txt_reader != NULL && g_reader_state.page_start > before) {
+        history_push(before);
+    }
+    return true;
+}
+
+// 后退一页：更新位置与控件，不渲染；已在开头时返回 false
+static bool turn_page_back(void) {
+    if (g_reader_state.epub_reader != NULL) {
+        if (!epub_turn_page(-1)) {
+            return false;
+        }
+        update_page_display();
+        return true;
+    }
+    if (g_reader_state.x4pg_book != NULL || g_reader_state.cbz_book != NULL) {
+        if (g_reader_state.current_page <= 1) {
+            return false;
+        }
+        g_reader_state.current_page--;
+        update_page_display();
+        return true;
+    }
+
+    // TXT 阅读器可以后退
+    if (g_reader_state.book_type != BOOK_TYPE_TXT || g_reader_state.txt_reader == NULL) {
+        return false;
+    }
+    txt_position_t pos = txt_reader_get_position(g_reader_state.txt_reader);
+    // 恢复的进度可能停在书中间而页码未知，以页首位置判断是否还能后退
+    if (g_reader_state.page_start <= g_reader_state.txt_reader->content_start) {
+        return false;
+    }
+    const int prev_read = pos.page_number > 2 ? pos.page_number - 2 : 0;
+    // 依次尝试：位图缓存、本次的翻页历史、分页索引、倒推扫描
+    const long history_start = history_pop();
+    if (!(page_cache_usable() &&
+          show_cached_page(page_cache_find_before(g_reader_state.page_start)))) {
+        bool found;
+        if (history_start >= 0 && history_start < g_reader_state.page_start) {
+            found = txt_reader_set_position(g_reader_state.txt_reader, history_start,
+                                            prev_read);
+        } else if (page_index_page_start(pos.page_number) == g_reader_state.page_start &&
+                   page_index_page_start(pos.page_number - 1) >= 0) {
+            found = seek_layout_page(pos.page_number - 1);
+        } else {
+            const long start = scan_prev_page_start(g_reader_state.page_start);
+            found = start >= 0 &&
+                    txt_reader_set_position(g_reader_state.txt_reader, start, prev_read);
+        }
+        if (found) {
+            update_page_display();
+        }
+    }
+    return true;
+}
+
+// 长按重复：正文控件不失效，只让状态栏重绘，局部刷新很小的一块显示页码。
+// 刷新请求会合并，面板跟不上重复速度时只显示最新的页码
+static void skip_page(int delta) {
+    g_reader_state.key_skipping = true;
+    lv_display_enable_invalidation(NULL, false);
+    const bool moved = delta > 0 ? turn_page_forward() : turn_page_back();
+    lv_display_enable_invalidation(NULL, true);
+    if (moved) {
+        lv_obj_invalidate(g_reader_state.status_bar);
         lvgl_trigger_render(NULL);
         lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
         lvgl_display_refresh_partial();
     }
 }
 
-void reader_screen_prev_page(void) {
-    if (g_reader_state.is_open && g_reader_state.book_type == BOOK_TYPE_TXT && g_reader_state.txt_reader != NULL) {
-        txt_position_t pos = txt_reader_get_position(g_reader_state.txt_reader);
-        if (pos.page_number > 1) {
-            txt_reader_goto_page(g_reader_state.txt_reader, pos.page_number - 1);
-            update_page_display();
-            lvgl_trigger_render(NULL);
-            lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-            lvgl_display_refresh_partial();
-        }
+// 松开翻页键：绘制停下的那一页
+static void finish_skip(void) {
+    if (!g_reader_state.key_skipping) {
+        return;
+    }
+    g_reader_state.key_skipping = false;
+    if (!g_reader_state.is_open) {
+        return;
+    }
+    if (g_reader_state.epub_reader != NULL && epub_pages_loaded(&g_reader_state.epub_pages)) {
+        epub_show_current_page();  // 停在图片页时在这里安排解码
+    } else if (g_reader_state.cbz_book != NULL) {
+        cbz_book_prepare(g_reader_state.cbz_book, g_reader_state.current_page - 1);
     }
+    invalidate_page_region();
+    lvgl_trigger_render(NULL);
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    lvgl_display_refresh_partial();
+    schedule_prerender();
+}
+
+// 单页翻动：渲染并局刷新页面，翻页遥测在提交刷新前结束渲染阶段
+static void turn_page(bool forward) {
+    if (!g_reader_state.is_open) {
+        return;
+    }
+    turn_stats_begin();
+    if (!(forward ? turn_page_forward() : turn_page_back())) {
+        turn_stats_cancel();
+        return;
+    }
+    // 先更新节奏，下面的预渲染延时按新的节奏计算
+    reading_pace_turn(forward);
+    lvgl_trigger_render(NULL);
+    turn_stats_mark(TURN_STAGE_RENDER);
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    lvgl_display_refresh_partial();
+    schedule_prerender();
+}
+
+void reader_screen_next_page(void) {
+    turn_page(true);
+}
+
+void reader_screen_prev_page(void) {
+    turn_page(false);
 }
 
 bool reader_screen_save_progress(void) {
@@ -518,10 +2058,10 @@ bool reader_screen_save_progress(void) {
 
     bool saved = false;
 
-    if (g_reader_state.book_type == BOOK_TYPE_TXT && g_reader_state.txt_reader != NULL) {
-        saved = txt_reader_save_position(g_reader_state.txt_reader);
-    } else if (g_reader_state.book_type == BOOK_TYPE_EPUB && g_reader_state.epub_reader != NULL) {
-        saved = epub_parser_save_position(g_reader_state.epub_reader);
+    if (g_reader_state.txt_reader != NULL || g_reader_state.epub_reader != NULL ||
+        g_reader_state.x4pg_book != NULL || g_reader_state.cbz_book != NULL) {
+        remember_position();
+        saved = position_journal_flush();
     }
 
     if (saved) {
@@ -531,15 +2071,97 @@ bool reader_screen_save_progress(void) {
     return saved;
 }
 
+void reader_screen_set_night_mode(bool enable) {
+    g_reader_state.settings.night_mode = enable;
+    // 反相由面板控制器完成：页面缓存、已排版的页和 framebuffer 都不变
+    lvgl_set_night_mode(enable);
+}
+
+// 新版式下包含 offset 的那一行的行首：从所在段首按新版式向后排版，
+// 取最后一个不晚于 offset 的行首。段落超出缓冲区时退回 offset 本身
+static long reflow_anchor(long offset) {
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    char *buf = g_reader_state.text_buffer;
+    long from = offset;
+    const int n = txt_reader_peek_before(reader, offset, buf, g_reader_state.buffer_size, &from);
+
+    long pos = offset;
+    if (n > 0) {
+        int i = n;
+        while (i > 0 && buf[i - 1] != '\n') {
+            i--;
+        }
+        if (i == 0 && from > reader->content_start) {
+            return offset;  // 段落比缓冲区长，找不到段首
+        }
+        pos = txt_reader_offset_after(reader, from, (size_t)i);
+    }
+
+    while (pos < offset) {
+        const long next = layout_page_at(pos, buf, g_reader_state.buffer_size, &g_reader_state.page_layout);
+        if (next <= pos) {
+            return offset;
+        }
+        if (next > offset) {
+            // offset 在这一页内：取最后一个不晚于它的行首
+            const text_page_layout_t *page = &g_reader_state.page_layout;
+            long anchor = pos;
+            for (uint16_t k = 1; k < page->line_count; k++) {
+                const long line = txt_reader_offset_after(reader, pos, page->lines[k].start);
+                if (line > offset) {
+                    break;
+                }
+                anchor = line;
+            }
+            return anchor;
+        }
+        pos = next;
+    }
+    return pos;
+}
+
+// 排版参数改变后重新排版：宽度缓存与每页行数重新计算，已缓存的页面位图和翻页历史
+// 失效。当前页从原页首所在的新行首开始，先显示出来；前后页由预渲染和倒推上一页
+// 按需排出，分页索引按新版式的指纹在 LVGL 定时器中分片重建（切换回原版式时直接
+// 复用已保存的索引）
+static void relayout_at_position(void) {
+    const long anchor = g_reader_state.page_start;
+    layout_reset();
+    page_cache_clear();
+    history_clear();
+    txt_reader_t *reader = g_reader_state.txt_reader;
+    if (reader != NULL) {
+        const txt_position_t pos = txt_reader_get_position(reader);
+        const long start = reflow_anchor(anchor);
+        const int page = page_index_estimate_page(start);
+        txt_reader_set_position(reader, start,
+                                page > 0 ? page - 1 : (pos.page_number > 0 ? pos.page_number - 1 : 0));
+    }
+    update_page_display();
+    screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+}
+
 void reader_screen_set_font_size(int font_size) {
     g_reader_state.settings.font_size = font_size;
+    settings_set_int(SETTING_READER_FONT_SIZE, font_size);
+    // 位图字体按新字号从母版缩放（TrueType 字体有自己的字号设置）
+    font_manager_set_scaled_size(font_size);
 
-    if (g_reader_state.text_label != NULL) {
+    if (g_reader_state.text_view != NULL) {
         const lv_font_t *font = get_lvgl_font(font_size);
-        lv_obj_set_style_text_font(g_reader_state.text_label, font, 0);
-        update_page_display();
-        lvgl_trigger_render(NULL);
-        lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-        lvgl_display_refresh_partial();
+        lv_obj_set_style_text_font(g_reader_state.text_view, font, 0);
+        relayout_at_position();
+    }
+}
+
+void reader_screen_set_margin(int margin) {
+    if (margin < 0) margin = 0;
+    if (margin > 100) margin = 100;
+    g_reader_state.settings.margin = margin;
+    settings_set_int(SETTING_READER_MARGIN, margin);
+
+    if (g_reader_state.text_view != NULL) {
+        lv_obj_set_style_pad_all(lv_obj_get_parent(g_reader_state.text_view), margin, 0);
+        relayout_at_position();
     }
 }
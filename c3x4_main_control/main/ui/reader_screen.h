@@ -17,16 +17,27 @@ extern "C" {
 typedef enum {
     BOOK_TYPE_NONE = 0,
     BOOK_TYPE_TXT,
-    BOOK_TYPE_EPUB
+    BOOK_TYPE_EPUB,
+    BOOK_TYPE_X4PG,           // 电脑上预排版的整页位图（x4pg_book.h）
+    BOOK_TYPE_CBZ             // ZIP 打包的漫画图片（cbz_book.h）
 } book_type_t;
 
+// 阅读方向（横屏时 LVGL 工作在面板原生方向，见 lvgl_set_landscape）
+typedef enum {
+    READER_ORIENTATION_PORTRAIT = 0,   // 竖屏 480x800
+    READER_ORIENTATION_LANDSCAPE,      // 横屏 800x480
+    READER_ORIENTATION_TWO_COLUMN,     // 横屏，一页分左右两栏
+    READER_ORIENTATION_COUNT
+} reader_orientation_t;
+
 // 阅读器设置
 typedef struct {
     int font_size;            // 字体大小
     int line_spacing;         // 行间距
     int margin;               // 页边距
     bool auto_refresh;        // 自动刷新
-    bool night_mode;          // 夜间模式（预留）
+    bool night_mode;          // 夜间模式（面板反相显示，见 lvgl_set_night_mode）
+    reader_orientation_t orientation; // 阅读方向
 } reader_settings_t;
 
 // 阅读器状态（简化版，仅供外部访问）
@@ -39,6 +50,22 @@ typedef struct reader_state_t reader_state_t;
  */
 void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev);
 
+/**
+ * @brief 等待后台打开完成并显示第一页（没有进行中的打开时立即返回）
+ *
+ * TXT/EPUB 在后台作业中打开，reader_screen_create_wrapper 返回时书可能还没打开；
+ * 启动时恢复阅读需要在首次渲染前排好第一页，调用这里同步等待
+ */
+void reader_screen_wait_open(void);
+
+/**
+ * @brief 关闭阅读器（保存进度、释放资源），没有打开时什么也不做
+ *
+ * 阅读器是建在当前根屏幕上的覆盖层，离开时由 screen_manager 调用；覆盖层被同步删除，
+ * 不要在阅读器控件自己的事件回调中调用（阅读器的动作都经 lv_async_call 处理）
+ */
+void reader_screen_close(void);
+
 /**
  * @brief 下一页
  */
@@ -61,12 +88,30 @@ bool reader_screen_save_progress(void);
  */
 void reader_screen_set_font_size(int font_size);
 
+/**
+ * @brief 设置页边距并从当前位置重新排版
+ * @param margin 四周留白（像素，0~100）
+ */
+void reader_screen_set_margin(int margin);
+
+/**
+ * @brief 设置夜间模式（只触发一次全刷，不重新排版或渲染）；关闭阅读器时自动恢复
+ * @param enable true 开启
+ */
+void reader_screen_set_night_mode(bool enable);
+
 /**
  * @brief 获取阅读器状态
  * @return 阅读器状态指针
  */
 reader_state_t* reader_screen_get_state(void);
 
+/**
+ * @brief 当前打开的书籍路径
+ * @return 路径，没有打开的书时返回 NULL
+ */
+const char *reader_screen_get_open_path(void);
+
 /**
  * @brief 获取书籍类型
  * @param file_path 文件路径
@@ -0,0 +1,197 @@
+/**
+ * @file reading_pace.c
+ * @brief 阅读节奏模型实现
+ */
+
+#include "reading_pace.h"
+#include "lvgl.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "READING_PACE";
+
+static const char *const pace_names[] = {"unknown", "fast", "normal", "slow"};
+
+static struct {
+    bool active;
+    uint32_t intervals[READING_PACE_WINDOW];  // 环形缓冲区
+    uint8_t count;
+    uint8_t next;
+    uint16_t directions;       // 最近各次翻页的方向，最低位为最近一次，1 为下一页
+    uint8_t turns;             // directions 中的有效位数
+    bool has_last;
+    uint32_t last_tick;
+    uint32_t quartile_ms;      // 间隔的下四分位数
+    reading_pace_t pace;
+    uint32_t panel_sleep_default;
+    bool cpu_held;             // 快读时两次翻页之间持有 POWER_LOCK_CPU
+    lv_timer_t *cpu_timer;     // 超过预计的下一次翻页仍没有翻页时释放
+} s_pace;
+
+static void release_cpu(void) {
+    if (s_pace.cpu_timer != NULL) {
+        lv_timer_delete(s_pace.cpu_timer);
+        s_pace.cpu_timer = NULL;
+    }
+    if (s_pace.cpu_held) {
+        power_manager_unlock(POWER_LOCK_CPU);
+        s_pace.cpu_held = false;
+    }
+}
+
+static void cpu_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    s_pace.cpu_timer = NULL;   // 只运行一次，LVGL 随后删除
+    if (s_pace.cpu_held) {
+        power_manager_unlock(POWER_LOCK_CPU);
+        s_pace.cpu_held = false;
+    }
+}
+
+// 快读：保持最高主频到两倍典型间隔之后；慢读：面板与芯片在典型间隔的 1/4 后就休眠
+static void apply_power(reading_pace_t previous) {
+    if (s_pace.pace == READING_PACE_FAST) {
+        const uint32_t hold_ms = 2 * s_pace.quartile_ms;
+        if (!s_pace.cpu_held) {
+            power_manager_lock(POWER_LOCK_CPU);
+            s_pace.cpu_held = true;
+        }
+        if (s_pace.cpu_timer != NULL) {
+            lv_timer_set_period(s_pace.cpu_timer, hold_ms);
+            lv_timer_reset(s_pace.cpu_timer);
+        } else {
+            s_pace.cpu_timer = lv_timer_create(cpu_timer_cb, hold_ms, NULL);
+            if (s_pace.cpu_timer != NULL) {
+                lv_timer_set_repeat_count(s_pace.cpu_timer, 1);
+            }
+        }
+    } else {
+        release_cpu();
+    }
+
+    if (s_pace.pace == READING_PACE_SLOW) {
+        uint32_t sleep_ms = s_pace.quartile_ms / 4;
+        if (sleep_ms < READING_PACE_SLEEP_MIN_MS) {
+            sleep_ms = READING_PACE_SLEEP_MIN_MS;
+        }
+        power_manager_set_idle_hint(sleep_ms);
+        if (s_pace.panel_sleep_default > 0 && sleep_ms < s_pace.panel_sleep_default) {
+            lvgl_set_panel_sleep_timeout(sleep_ms);
+        }
+    } else if (previous == READING_PACE_SLOW) {
+        power_manager_set_idle_hint(0);
+        lvgl_set_panel_sleep_timeout(s_pace.panel_sleep_default);
+    }
+}
+
+static void update_model(void) {
+    uint32_t sorted[READING_PACE_WINDOW];
+    memcpy(sorted, s_pace.intervals, s_pace.count * sizeof(uint32_t));
+    for (int i = 1; i < s_pace.count; i++) {
+        const uint32_t v = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+
+    const reading_pace_t previous = s_pace.pace;
+    if (s_pace.count < READING_PACE_MIN_SAMPLES) {
+        s_pace.pace = READING_PACE_UNKNOWN;
+        return;
+    }
+    s_pace.quartile_ms = sorted[s_pace.count / 4];
+    s_pace.pace = s_pace.quartile_ms < READING_PACE_FAST_MS ? READING_PACE_FAST :
+                  s_pace.quartile_ms > READING_PACE_SLOW_MS ? READING_PACE_SLOW : READING_PACE_NORMAL;
+    if (s_pace.pace != previous) {
+        ESP_LOGI(TAG, "Pace %s (lower quartile %u ms over %u turns)", pace_names[s_pace.pace],
+                 (unsigned)s_pace.quartile_ms, (unsigned)s_pace.count);
+    }
+    apply_power(previous);
+}
+
+void reading_pace_begin(void) {
+    reading_pace_end();
+    memset(&s_pace, 0, sizeof(s_pace));
+    s_pace.panel_sleep_default = lvgl_get_panel_sleep_timeout();
+    s_pace.active = true;
+}
+
+void reading_pace_end(void) {
+    if (!s_pace.active) {
+        return;
+    }
+    release_cpu();
+    if (s_pace.pace == READING_PACE_SLOW) {
+        power_manager_set_idle_hint(0);
+        lvgl_set_panel_sleep_timeout(s_pace.panel_sleep_default);
+    }
+    s_pace.active = false;
+    s_pace.pace = READING_PACE_UNKNOWN;
+}
+
+void reading_pace_turn(bool forward) {
+    if (!s_pace.active) {
+        return;
+    }
+    if (s_pace.has_last) {
+        const uint32_t interval = lv_tick_elaps(s_pace.last_tick);
+        if (interval <= READING_PACE_BREAK_MS) {
+            s_pace.intervals[s_pace.next] = interval;
+            s_pace.next = (uint8_t)((s_pace.next + 1) % READING_PACE_WINDOW);
+            if (s_pace.count < READING_PACE_WINDOW) {
+                s_pace.count++;
+            }
+        }
+    }
+    s_pace.has_last = true;
+    s_pace.last_tick = lv_tick_get();
+
+    s_pace.directions = (uint16_t)((s_pace.directions << 1) | (forward ? 1 : 0));
+    if (s_pace.turns < 16) {
+        s_pace.turns++;
+    }
+    update_model();
+}
+
+reading_pace_t reading_pace_get(void) {
+    return s_pace.pace;
+}
+
+uint32_t reading_pace_prerender_delay(uint32_t default_ms) {
+    if (s_pace.pace != READING_PACE_FAST) {
+        return default_ms;
+    }
+    // 赶在典型间隔的前 1/3 内完成，下一次按键时已在缓存中
+    uint32_t delay = s_pace.quartile_ms / 3;
+    if (delay < 100) {
+        delay = 100;
+    }
+    return delay < default_ms ? delay : default_ms;
+}
+
+bool reading_pace_prerender_next(void) {
+    if (s_pace.turns < READING_PACE_MIN_SAMPLES) {
+        return true;
+    }
+    int forward = 0;
+    for (int i = 0; i < s_pace.turns; i++) {
+        forward += (s_pace.directions >> i) & 1;
+    }
+    return forward * 2 >= s_pace.turns;
+}
+
+int reading_pace_prefetch_pages(int default_pages) {
+    switch (s_pace.pace) {
+        case READING_PACE_FAST:
+            return default_pages * 2;
+        case READING_PACE_SLOW:
+            return default_pages > 1 ? default_pages - 1 : default_pages;
+        default:
+            return default_pages;
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file reading_pace.h
+ * @brief 阅读节奏模型：按最近的翻页间隔与方向调整预渲染、预取与功耗
+ *
+ * 每 20 秒翻一页的读者和每秒翻一页的略读者需要的策略正好相反：
+ *   - 慢读者：下一次翻页还早，尽快让面板休眠、芯片浅睡眠，预取不必提前
+ *   - 快读者：间隔比默认的预渲染延时还短，要更早预渲染、更早预取下一章，
+ *     两次翻页之间保持最高主频，让后台准备在下一次按键前完成
+ * 模型只记最近 READING_PACE_WINDOW 次单页翻页（按住连翻不计）的间隔，
+ * 以下四分位数（较短的那些间隔）判断节奏；超过 READING_PACE_BREAK_MS 的间隔
+ * 视为中途休息，不进入统计。最近翻回上一页多于翻到下一页时不预渲染下一页。
+ * 只在 LVGL 任务中调用；每次打开书重新开始
+ */
+
+#ifndef READING_PACE_H
+#define READING_PACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define READING_PACE_WINDOW       16      // 记录的翻页间隔数
+#define READING_PACE_MIN_SAMPLES  4       // 样本不足时按默认策略
+#define READING_PACE_BREAK_MS     120000  // 更长的间隔算休息，不计入
+#define READING_PACE_FAST_MS      3000    // 下四分位数低于此值为快读
+#define READING_PACE_SLOW_MS      12000   // 下四分位数高于此值为慢读
+#define READING_PACE_SLEEP_MIN_MS 2000    // 慢读时面板与芯片休眠的最短空闲时间
+
+typedef enum {
+    READING_PACE_UNKNOWN = 0,   // 样本不足
+    READING_PACE_FAST,
+    READING_PACE_NORMAL,
+    READING_PACE_SLOW,
+} reading_pace_t;
+
+/**
+ * @brief 开始一次阅读会话（清空样本）
+ */
+void reading_pace_begin(void);
+
+/**
+ * @brief 结束会话：释放主频锁，面板与芯片的休眠时间恢复默认
+ */
+void reading_pace_end(void);
+
+/**
+ * @brief 记录一次单页翻页，并按新的节奏调整功耗策略
+ * @param forward true 为下一页
+ */
+void reading_pace_turn(bool forward);
+
+/**
+ * @brief 当前节奏
+ */
+reading_pace_t reading_pace_get(void);
+
+/**
+ * @brief 页面显示后等待多久再预渲染下一页（快读时缩短）
+ * @param default_ms 默认延时
+ */
+uint32_t reading_pace_prerender_delay(uint32_t default_ms);
+
+/**
+ * @brief 是否值得预渲染下一页（最近以翻回上一页为主时为 false）
+ */
+bool reading_pace_prerender_next(void);
+
+/**
+ * @brief 距章末不超过多少页时开始预取下一章（快读时提前）
+ * @param default_pages 默认页数
+ */
+int reading_pace_prefetch_pages(int default_pages);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // READING_PACE_H
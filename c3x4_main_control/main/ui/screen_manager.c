@@ -5,6 +5,9 @@
 
 #include "screen_manager.h"
 #include "../lvgl_driver.h"
+#include "../heap_stats.h"
+#include "../lvgl_mem_pool.h"
+#include "reader_screen.h"
 #include "esp_log.h"
 #include <string.h>
 
@@ -13,10 +16,28 @@ static const char *TAG = "SCREEN_MGR";
 // 导航历史栈 - 最大深度 10
 #define NAVIGATION_STACK_MAX_DEPTH 10
 
+// LVGL 内存池（50 KB）至少还剩这么多，才把离开的屏幕留在缓存中
+#define SCREEN_CACHE_MIN_LV_FREE (16 * 1024)
+
+// 新建屏幕前 LVGL 内存池至少备下这么多（不够且没有无线电时附加池）
+#define SCREEN_CREATE_LV_NEED (16 * 1024)
+
 static screen_context_t *g_context = NULL;
 static screen_type_t g_navigation_stack[NAVIGATION_STACK_MAX_DEPTH] = {SCREEN_TYPE_INDEX};
 static int g_navigation_stack_top = 0;  // 栈顶指针（指向当前屏幕）
 static screen_type_t g_current_screen = SCREEN_TYPE_INDEX;
+static uint32_t g_battery_seq = 0;  // 上下文中电量对应的发布序号
+
+// 屏幕对象：当前显示的根屏幕，以及挂起后留在缓存中的根屏幕（每类最多一个）
+static lv_obj_t *g_active_root = NULL;
+static screen_type_t g_active_type = SCREEN_TYPE_INDEX;
+static lv_obj_t *g_cached_roots[SCREEN_TYPE_COUNT];
+static const screen_keepalive_ops_t *g_keepalive[SCREEN_TYPE_COUNT];
+
+// 堆统计区间名：每个页面创建前开始新区间，记录该页面期间的最低空闲堆
+static const char *const g_screen_names[SCREEN_TYPE_COUNT] = {
+    "index", "file_browser", "reader", "settings", "image_browser",
+};
 
 void screen_manager_init(screen_context_t *ctx)
 {
@@ -27,6 +48,227 @@ void screen_manager_init(screen_context_t *ctx)
     ESP_LOGI(TAG, "Screen manager initialized");
 }
 
+bool screen_manager_update_battery(void)
+{
+    if (g_context == NULL || g_context->read_battery_seq == NULL) {
+        return false;
+    }
+    const uint32_t seq = g_context->read_battery_seq();
+    if (seq == g_battery_seq) {
+        return false;
+    }
+    g_battery_seq = seq;
+    g_context->battery_mv = g_context->read_battery_voltage_mv();
+    g_context->battery_pct = g_context->read_battery_percentage();
+    g_context->charging = g_context->is_charging();
+    return true;
+}
+
+// 内部函数：开始页面的堆统计区间
+static void begin_screen_scope(screen_type_t screen_type)
+{
+    heap_stats_begin_scope(g_screen_names[screen_type]);
+}
+
+void screen_manager_set_keepalive(screen_type_t type, const screen_keepalive_ops_t *ops)
+{
+    if (type < SCREEN_TYPE_COUNT) {
+        g_keepalive[type] = ops;
+    }
+}
+
+// 内部函数：根屏幕被删除（包括被其它模块删除）时清除引用
+static void root_delete_cb(lv_event_t *e)
+{
+    lv_obj_t *root = lv_event_get_current_target(e);
+    if (g_active_root == root) {
+        g_active_root = NULL;
+    }
+    for (int i = 0; i < SCREEN_TYPE_COUNT; i++) {
+        if (g_cached_roots[i] == root) {
+            g_cached_roots[i] = NULL;
+        }
+    }
+}
+
+// 内部函数：LVGL 内存池与堆是否还有余量保留离开的屏幕
+static bool cache_has_room(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.free_size >= SCREEN_CACHE_MIN_LV_FREE && heap_stats_cache_budget(0, 1) > 0;
+}
+
+// 内部函数：删除缓存中的屏幕（不是活动屏幕，没有正在处理的事件，可以同步删除）
+static void evict_cached_roots(void)
+{
+    for (int i = 0; i < SCREEN_TYPE_COUNT; i++) {
+        if (g_cached_roots[i] != NULL) {
+            ESP_LOGI(TAG, "Evicting cached screen %s", g_screen_names[i]);
+            lv_obj_delete(g_cached_roots[i]);
+        }
+    }
+}
+
+// 内部函数：异步删除离开的根屏幕（切换可能在它自己的事件回调中发起）
+static void delete_root_async_cb(void *root)
+{
+    lv_obj_delete((lv_obj_t *)root);
+}
+
+void screen_manager_refresh(screen_refresh_intent_t intent)
+{
+    static const char *const intent_names[] = {"transition", "content", "focus"};
+    static const char *const mode_names[] = {"PARTIAL", "FAST", "FULL"};
+
+    // 渲染始终在 PARTIAL 下进行，脏区才会被记录；全刷/快刷会一并清除脏区
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    if (intent == SCREEN_REFRESH_TRANSITION) {
+        // 整屏重绘：先清白 framebuffer，旧屏幕的像素不会留在新屏幕没有覆盖的地方
+        lvgl_clear_framebuffer();
+        lv_obj_invalidate(lv_screen_active());
+    }
+    lvgl_trigger_render(NULL);
+
+    epd_refresh_mode_t mode = EPD_REFRESH_PARTIAL;
+    if (intent != SCREEN_REFRESH_FOCUS) {
+        const int changed = lvgl_fb_changed_percent();
+        if (intent == SCREEN_REFRESH_TRANSITION) {
+            if (changed < 0 || changed >= SCREEN_REFRESH_FULL_PCT) {
+                mode = EPD_REFRESH_FULL;
+            } else if (changed >= SCREEN_REFRESH_PARTIAL_PCT) {
+                mode = EPD_REFRESH_FAST;
+            }
+        } else if (changed >= SCREEN_REFRESH_PARTIAL_PCT) {
+            mode = EPD_REFRESH_FAST;
+        }
+        ESP_LOGI(TAG, "Refresh for %s: %d%% of rows changed -> %s",
+                 intent_names[intent], changed, mode_names[mode]);
+    }
+
+    switch (mode) {
+        case EPD_REFRESH_FULL:
+            lvgl_display_refresh_full();
+            break;
+        case EPD_REFRESH_FAST:
+            lvgl_display_refresh_fast();
+            break;
+        default:
+            lvgl_display_refresh_partial();
+            break;
+    }
+}
+
+void screen_manager_refresh_focus(lv_obj_t *from, lv_obj_t *to)
+{
+    lvgl_invalidate_focus(from, to);
+    screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+}
+
+// 内部函数：重新显示已建好的屏幕：控件树不变，不重建、不重读，只刷新一次
+static void resume_root(screen_type_t screen_type)
+{
+    if (g_keepalive[screen_type] != NULL) {
+        g_keepalive[screen_type]->resume();
+    }
+    screen_manager_refresh(SCREEN_REFRESH_TRANSITION);
+}
+
+// 内部函数：调用各屏幕的创建函数（创建函数自己载入新屏幕并完成首次刷新）
+static void create_screen(screen_type_t screen_type, const char *arg)
+{
+    extern void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging, const char *version_str, lv_indev_t *indev);
+    extern void file_browser_screen_create(lv_indev_t *indev);
+    extern void settings_screen_create(lv_indev_t *indev);
+    extern void image_browser_screen_create(const char *directory, int start_index, lv_indev_t *indev);
+
+    switch (screen_type) {
+        case SCREEN_TYPE_INDEX:
+            (void)screen_manager_update_battery();
+            index_screen_create(
+                g_context->battery_mv,
+                g_context->battery_pct,
+                g_context->charging,
+                g_context->version_str,
+                g_context->indev
+            );
+            break;
+        case SCREEN_TYPE_FILE_BROWSER:
+            file_browser_screen_create(g_context->indev);
+            break;
+        case SCREEN_TYPE_SETTINGS:
+            settings_screen_create(g_context->indev);
+            break;
+        case SCREEN_TYPE_IMAGE_BROWSER:
+            image_browser_screen_create(arg, 0, g_context->indev);
+            break;
+        default:
+            break;
+    }
+}
+
+// 内部函数：切换到某类根屏幕
+//
+// 阅读器是建在文件浏览器屏幕上的覆盖层，先关闭；目标就是它下面的屏幕时原地恢复。
+// 否则离开当前根屏幕：可保活且有余量时挂起留在缓存中，不然在新屏幕载入时删除
+// （删除排在新屏幕的首次渲染之前执行）。目标在缓存中时直接载入，否则新建
+static void enter_root(screen_type_t screen_type, const char *arg)
+{
+    begin_screen_scope(screen_type);
+    reader_screen_close();
+
+    lv_obj_t *old = g_active_root;
+    const screen_type_t old_type = g_active_type;
+    if (old != NULL && old_type == screen_type) {
+        ESP_LOGI(TAG, "Resuming %s in place", g_screen_names[screen_type]);
+        resume_root(screen_type);
+        return;
+    }
+
+    lv_obj_t *cached = g_cached_roots[screen_type];
+    if (cached == NULL && !cache_has_room()) {
+        evict_cached_roots();
+    }
+    bool keep = false;
+    if (old != NULL) {
+        keep = g_keepalive[old_type] != NULL && cache_has_room();
+        if (keep) {
+            g_keepalive[old_type]->suspend();
+            g_cached_roots[old_type] = old;
+        } else {
+            lv_async_call(delete_root_async_cb, old);
+        }
+    }
+
+    if (cached != NULL) {
+        ESP_LOGI(TAG, "Loading cached %s screen", g_screen_names[screen_type]);
+        g_cached_roots[screen_type] = NULL;
+        g_active_root = cached;
+        g_active_type = screen_type;
+        lv_scr_load(cached);
+        resume_root(screen_type);
+        return;
+    }
+
+    lvgl_mem_pool_balance(SCREEN_CREATE_LV_NEED);
+    create_screen(screen_type, arg);
+    lv_obj_t *root = lv_screen_active();
+    if (root == old) {
+        // 创建失败，仍停在原屏幕
+        ESP_LOGW(TAG, "Screen %s not created, staying", g_screen_names[screen_type]);
+        if (keep) {
+            g_cached_roots[old_type] = NULL;
+            g_keepalive[old_type]->resume();
+        } else {
+            lv_async_call_cancel(delete_root_async_cb, old);
+        }
+        return;
+    }
+    g_active_root = root;
+    g_active_type = screen_type;
+    lv_obj_add_event_cb(root, root_delete_cb, LV_EVENT_DELETE, NULL);
+}
+
 // 内部函数：将屏幕压入导航栈
 static void push_screen(screen_type_t screen_type)
 {
@@ -51,26 +293,16 @@ void screen_manager_show_index(void)
 
     ESP_LOGI(TAG, "Navigating to index screen");
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    extern void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging, const char *version_str, lv_indev_t *indev);
-
     // 首页总是作为栈底，清空栈
     g_navigation_stack[0] = SCREEN_TYPE_INDEX;
     g_navigation_stack_top = 0;
     g_current_screen = SCREEN_TYPE_INDEX;
 
-    index_screen_create(
-        g_context->battery_mv,
-        g_context->battery_pct,
-        g_context->charging,
-        g_context->version_str,
-        g_context->indev
-    );
+    enter_root(SCREEN_TYPE_INDEX, NULL);
 }
 
 void screen_manager_show_file_browser(void)
@@ -82,18 +314,14 @@ void screen_manager_show_file_browser(void)
 
     ESP_LOGI(TAG, "Navigating to file browser screen");
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    extern void file_browser_screen_create(lv_indev_t *indev);
-
     // 压入导航栈
     push_screen(SCREEN_TYPE_FILE_BROWSER);
 
-    file_browser_screen_create(g_context->indev);
+    enter_root(SCREEN_TYPE_FILE_BROWSER, NULL);
 }
 
 void screen_manager_show_settings(void)
@@ -105,18 +333,14 @@ void screen_manager_show_settings(void)
 
     ESP_LOGI(TAG, "Navigating to settings screen");
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    extern void settings_screen_create(lv_indev_t *indev);
-
     // 压入导航栈
     push_screen(SCREEN_TYPE_SETTINGS);
 
-    settings_screen_create(g_context->indev);
+    enter_root(SCREEN_TYPE_SETTINGS, NULL);
 }
 
 void screen_manager_show_reader(const char *file_path)
@@ -133,17 +357,19 @@ void screen_manager_show_reader(const char *file_path)
 
     ESP_LOGI(TAG, "Navigating to reader screen: %s", file_path);
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    extern void reader_screen_create_wrapper(const char *file_path, lv_indev_t *indev);
-
     // 压入导航栈
     push_screen(SCREEN_TYPE_READER);
+    begin_screen_scope(SCREEN_TYPE_READER);
 
+    // 阅读器建在当前根屏幕之上，下面的屏幕挂起但不离开，返回时原地恢复
+    reader_screen_close();
+    if (g_active_root != NULL && g_keepalive[g_active_type] != NULL) {
+        g_keepalive[g_active_type]->suspend();
+    }
     reader_screen_create_wrapper(file_path, g_context->indev);
 }
 
@@ -161,18 +387,14 @@ void screen_manager_show_image_browser(const char *directory)
 
     ESP_LOGI(TAG, "Navigating to image browser screen: %s", directory);
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    extern void image_browser_screen_create(const char *directory, int start_index, lv_indev_t *indev);
-
     // 压入导航栈
     push_screen(SCREEN_TYPE_IMAGE_BROWSER);
 
-    image_browser_screen_create(directory, 0, g_context->indev);
+    enter_root(SCREEN_TYPE_IMAGE_BROWSER, directory);
 }
 
 bool screen_manager_go_back(void)
@@ -195,53 +417,26 @@ bool screen_manager_go_back(void)
 
     ESP_LOGI(TAG, "Going back to screen %d (stack top: %d)", prev_screen, g_navigation_stack_top);
 
-    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响
+    // 重置刷新状态，确保新的屏幕刷新不受旧状态影响；刷新方式由新屏幕的
+    // screen_manager_refresh(SCREEN_REFRESH_TRANSITION) 按画面变化量决定
     lvgl_reset_refresh_state();
 
-    // 组件间切换：强制使用全刷模式，确保屏幕完全清晰
-    lvgl_set_refresh_mode(EPD_REFRESH_FULL);
-
-    // 根据屏幕类型切换
+    // 根据屏幕类型切换（缓存中有该屏幕时直接载入）
     switch (prev_screen) {
         case SCREEN_TYPE_INDEX:
-            {
-                extern void index_screen_create(uint32_t battery_mv, uint8_t battery_pct, bool charging, const char *version_str, lv_indev_t *indev);
-                index_screen_create(
-                    g_context->battery_mv,
-                    g_context->battery_pct,
-                    g_context->charging,
-                    g_context->version_str,
-                    g_context->indev
-                );
-            }
-            break;
         case SCREEN_TYPE_FILE_BROWSER:
-            {
-                extern void file_browser_screen_create(lv_indev_t *indev);
-                file_browser_screen_create(g_context->indev);
-            }
+        case SCREEN_TYPE_SETTINGS:
+            enter_root(prev_screen, NULL);
             break;
         case SCREEN_TYPE_READER:
-            {
-                // 阅读器屏幕需要文件路径，但返回时不应该再次打开
-                // 这里我们返回到文件浏览器
-                ESP_LOGW(TAG, "Cannot return to reader screen without file path, redirecting to file browser");
-                extern void file_browser_screen_create(lv_indev_t *indev);
-                file_browser_screen_create(g_context->indev);
-            }
-            break;
-        case SCREEN_TYPE_SETTINGS:
-            {
-                extern void settings_screen_create(lv_indev_t *indev);
-                settings_screen_create(g_context->indev);
-            }
+            // 阅读器屏幕需要文件路径，但返回时不应该再次打开
+            // 这里我们返回到文件浏览器
+            ESP_LOGW(TAG, "Cannot return to reader screen without file path, redirecting to file browser");
+            enter_root(SCREEN_TYPE_FILE_BROWSER, NULL);
             break;
         case SCREEN_TYPE_IMAGE_BROWSER:
-            {
-                // 图片浏览器返回时回到文件浏览器
-                extern void file_browser_screen_create(lv_indev_t *indev);
-                file_browser_screen_create(g_context->indev);
-            }
+            // 图片浏览器返回时回到文件浏览器
+            enter_root(SCREEN_TYPE_FILE_BROWSER, NULL);
             break;
         default:
             ESP_LOGE(TAG, "Unknown screen type: %d", prev_screen);
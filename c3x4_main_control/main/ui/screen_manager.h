@@ -11,6 +11,10 @@
 // 前置声明
 struct screen_context;
 
+// 刷新策略阈值：变化的行占全屏的百分比
+#define SCREEN_REFRESH_FULL_PCT     50  // 切换时达到此变化量用全刷
+#define SCREEN_REFRESH_PARTIAL_PCT  15  // 低于此变化量用局刷
+
 // 屏幕类型枚举
 typedef enum {
     SCREEN_TYPE_INDEX = 0,      // 首页
@@ -33,14 +37,67 @@ typedef struct screen_context {
     uint32_t (*read_battery_voltage_mv)(void);
     uint8_t (*read_battery_percentage)(void);
     bool (*is_charging)(void);
+    uint32_t (*read_battery_seq)(void);  // 电池服务的发布序号：变化时才需要重读电量
 } screen_context_t;
 
+// 刷新意图：屏幕只说明发生了什么，刷新方式由 screen_manager_refresh 统一决定
+typedef enum {
+    SCREEN_REFRESH_TRANSITION = 0,  // 进入另一个屏幕（新建或从缓存载入）
+    SCREEN_REFRESH_CONTENT,         // 屏幕内成片内容更换（换目录、换图片、换字号）
+    SCREEN_REFRESH_FOCUS,           // 焦点移动与小范围更新（选中行、电量、菜单弹出）
+} screen_refresh_intent_t;
+
+// 可保活屏幕的回调：离开时对象不销毁而是留在缓存中，再次进入时直接载入
+typedef struct {
+    void (*suspend)(void);  // 离开前调用：停止定时器与后台任务
+    void (*resume)(void);   // 重新载入后调用：恢复输入组，更新离开期间变化的内容
+} screen_keepalive_ops_t;
+
 /**
  * @brief 初始化屏幕管理器
  * @param ctx 屏幕上下文指针
  */
 void screen_manager_init(screen_context_t *ctx);
 
+/**
+ * @brief 电池服务发布了新值时，把电量与充电状态读入上下文
+ * @return true 表示有变化，调用方重绘电量显示
+ */
+bool screen_manager_update_battery(void);
+
+/**
+ * @brief 渲染失效区域并按意图提交一次刷新（在 LVGL 任务中调用）
+ *
+ * 焦点类更新只送脏区（局刷窗口）。切换与内容更换按渲染后与面板画面相比变化的行数
+ * 选择：切换时变化达到 SCREEN_REFRESH_FULL_PCT 用全刷，否则快刷（几乎不变时局刷）；
+ * 内容更换变化不足 SCREEN_REFRESH_PARTIAL_PCT 用局刷，否则快刷。无法比较时
+ * 切换用全刷、内容更换用局刷（残影由驱动的鬼影债务兜底）。
+ * 调用后刷新模式保持 PARTIAL，之后渲染的区域都会记入脏区
+ */
+void screen_manager_refresh(screen_refresh_intent_t intent);
+
+/**
+ * @brief 列表焦点移动：只重绘并局刷旧、新两个焦点行（在 LVGL 任务中调用）
+ *
+ * 两行各自作为一个局刷窗口在同一次刷新中送出（lvgl_invalidate_focus），
+ * 列表再长也只传这两行。调用前先改好两行的样式；列表因焦点移动而滚动时
+ * 整片内容都变了，应改用 screen_manager_refresh(SCREEN_REFRESH_CONTENT)
+ * @param from 失去焦点的行，可以为 NULL
+ * @param to   获得焦点的行
+ */
+void screen_manager_refresh_focus(lv_obj_t *from, lv_obj_t *to);
+
+/**
+ * @brief 声明某类屏幕可保活（在屏幕的创建函数中调用）
+ *
+ * 离开可保活的屏幕时，若 LVGL 内存池与堆都有余量，屏幕挂起后留在缓存中，
+ * 返回时载入原对象并局部刷新一次，不再重建控件树、重读目录；内存紧张时
+ * 缓存的屏幕在创建新屏幕前被删除。每类屏幕最多只有一个根对象存在
+ * @param type 屏幕类型
+ * @param ops 保活回调（静态存储，不复制）
+ */
+void screen_manager_set_keepalive(screen_type_t type, const screen_keepalive_ops_t *ops);
+
 /**
  * @brief 显示首页
  */
@@ -0,0 +1,468 @@
+/**
+ * @file sd_io.c
+ * @brief SD 卡异步读取服务实现，见 sd_io.h
+ *
+ * 两把锁：请求队列用自旋锁（提交方可以是任意任务，临界区只有几条赋值）；
+ * FILE 位置与块缓存用互斥锁。后台作业先拿互斥锁再取出一批请求，sd_io_close 也要先拿
+ * 互斥锁，所以取出的请求在读完之前它们的文件不会被关闭
+ */
+
+#include "sd_io.h"
+#include "file_pool.h"
+#include "../bg_jobs.h"
+#include "../heap_stats.h"
+#include "../spi_arbiter.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "SD_IO";
+
+#define SD_IO_NO_POS 0xFFFFFFFFu
+#define SD_IO_CACHE_BYTES (SD_IO_CACHE_BLOCKS * SD_IO_BLOCK)
+
+struct sd_io_file {
+    FILE *fp;
+    uint32_t size;
+    uint32_t pos;              // fp 的当前位置（顺序读取时省掉 fseek），未知为 SD_IO_NO_POS
+    uint16_t seq;              // 打开序号：电梯扫描中文件的先后
+};
+
+typedef struct {
+    sd_io_file_t *file;        // NULL：空槽
+    uint32_t offset;
+    uint32_t len;
+    uint8_t *buf;              // NULL：只预读进缓存
+    sd_io_done_t done;
+    void *user;
+    uint8_t prio;
+} io_req_t;
+
+typedef struct {
+    const sd_io_file_t *file;  // NULL：空块
+    uint32_t block;            // 块号（偏移 / SD_IO_BLOCK）
+    uint32_t used;             // 有效字节（文件最后一块可能不满）
+    uint32_t tick;             // 最近使用
+} cache_tag_t;
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static io_req_t s_reqs[SD_IO_MAX_REQUESTS];
+static uint8_t s_pending;
+static bool s_job_active;
+static uint16_t s_head_seq;    // 电梯的当前位置
+static uint32_t s_head_off;
+
+static SemaphoreHandle_t s_io_lock;
+static uint8_t *s_cache;
+static cache_tag_t s_tags[SD_IO_CACHE_BLOCKS];
+static uint32_t s_tick;
+static int s_open_files;
+static uint16_t s_next_seq;
+
+static sd_io_stats_t s_stats;
+
+// ---------------------------------------------------------------------------
+// 文件读取与块缓存（持有 s_io_lock）
+// ---------------------------------------------------------------------------
+
+static size_t file_read_at(sd_io_file_t *file, uint32_t pos, uint8_t *dst, size_t len) {
+    if (file->pos != pos && fseek(file->fp, (long)pos, SEEK_SET) != 0) {
+        file->pos = SD_IO_NO_POS;
+        return 0;
+    }
+    const size_t n = fread(dst, 1, len, file->fp);
+    file->pos = n == len ? pos + (uint32_t)n : SD_IO_NO_POS;
+    return n;
+}
+
+static int cache_peek(const sd_io_file_t *file, uint32_t block) {
+    if (s_cache == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < SD_IO_CACHE_BLOCKS; i++) {
+        if (s_tags[i].file == file && s_tags[i].block == block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 块不在缓存中时淘汰最久未用的一块并读入（失败返回 -1）
+static int cache_fill(sd_io_file_t *file, uint32_t block) {
+    int slot = cache_peek(file, block);
+    if (slot >= 0 || s_cache == NULL) {
+        return slot;
+    }
+    slot = 0;
+    for (int i = 1; i < SD_IO_CACHE_BLOCKS; i++) {
+        if (s_tags[i].file == NULL || (s_tags[slot].file != NULL && s_tags[i].tick < s_tags[slot].tick)) {
+            slot = i;
+        }
+    }
+    const uint32_t pos = block * SD_IO_BLOCK;
+    const size_t want = file->size - pos < SD_IO_BLOCK ? file->size - pos : SD_IO_BLOCK;
+    s_tags[slot].file = NULL;
+    const size_t n = file_read_at(file, pos, s_cache + slot * SD_IO_BLOCK, want);
+    if (n != want) {
+        return -1;
+    }
+    s_tags[slot] = (cache_tag_t){ .file = file, .block = block, .used = (uint32_t)n, .tick = ++s_tick };
+    s_stats.block_reads++;
+    return slot;
+}
+
+static void cache_forget(const sd_io_file_t *file) {
+    for (int i = 0; i < SD_IO_CACHE_BLOCKS; i++) {
+        if (s_tags[i].file == file) {
+            s_tags[i].file = NULL;
+        }
+    }
+}
+
+// 缓存中的块直接复制，连续缺失的块合并为一次读取直接读进 dst
+static size_t read_locked(sd_io_file_t *file, uint32_t offset, uint8_t *dst, size_t len) {
+    if (offset >= file->size) {
+        return 0;
+    }
+    const uint32_t end = file->size - offset < len ? file->size : offset + (uint32_t)len;
+    uint32_t pos = offset;
+    while (pos < end) {
+        const uint32_t block = pos / SD_IO_BLOCK;
+        const int slot = cache_peek(file, block);
+        if (slot >= 0) {
+            const uint32_t in = pos - block * SD_IO_BLOCK;
+            const uint32_t n = s_tags[slot].used - in < end - pos ? s_tags[slot].used - in : end - pos;
+            memcpy(dst + (pos - offset), s_cache + slot * SD_IO_BLOCK + in, n);
+            s_tags[slot].tick = ++s_tick;
+            s_stats.block_hits++;
+            pos += n;
+            continue;
+        }
+        uint32_t run_end = (block + 1) * SD_IO_BLOCK;
+        while (run_end < end && cache_peek(file, run_end / SD_IO_BLOCK) < 0) {
+            run_end += SD_IO_BLOCK;
+        }
+        run_end = run_end < end ? run_end : end;
+        const size_t want = run_end - pos;
+        const size_t n = file_read_at(file, pos, dst + (pos - offset), want);
+        s_stats.direct_bytes += (uint32_t)n;
+        pos += (uint32_t)n;
+        if (n < want) {
+            break;
+        }
+    }
+    return pos - offset;
+}
+
+// 把 [offset, offset + len) 所在的块读进缓存（最多整个缓存），返回覆盖到的字节数
+static size_t cache_warm(sd_io_file_t *file, uint32_t offset, size_t len) {
+    if (offset >= file->size || s_cache == NULL) {
+        return 0;
+    }
+    const uint32_t end = file->size - offset < len ? file->size : offset + (uint32_t)len;
+    const uint32_t first = offset / SD_IO_BLOCK;
+    uint32_t last = (end - 1) / SD_IO_BLOCK;
+    if (last - first >= SD_IO_CACHE_BLOCKS) {
+        last = first + SD_IO_CACHE_BLOCKS - 1;
+    }
+    for (uint32_t b = first; b <= last; b++) {
+        const int slot = cache_fill(file, b);
+        if (slot < 0) {
+            return b * SD_IO_BLOCK > offset ? b * SD_IO_BLOCK - offset : 0;
+        }
+        s_tags[slot].tick = ++s_tick;
+    }
+    const uint32_t covered = (last + 1) * SD_IO_BLOCK;
+    return (covered < end ? covered : end) - offset;
+}
+
+// ---------------------------------------------------------------------------
+// 请求队列（持有 s_mux）
+// ---------------------------------------------------------------------------
+
+static inline bool key_before(uint16_t seq_a, uint32_t off_a, uint16_t seq_b, uint32_t off_b) {
+    return seq_a < seq_b || (seq_a == seq_b && off_a < off_b);
+}
+
+// 电梯扫描选出下一处读取：最高优先级中位于当前位置之后的第一个，没有就回到开头
+static int pick_request(void) {
+    uint8_t prio = SD_IO_PRIO_COUNT;
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+        if (s_reqs[i].file != NULL && s_reqs[i].prio < prio) {
+            prio = s_reqs[i].prio;
+        }
+    }
+    int ahead = -1;
+    int first = -1;
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+        const io_req_t *r = &s_reqs[i];
+        if (r->file == NULL || r->prio != prio) {
+            continue;
+        }
+        if (first < 0 || key_before(r->file->seq, r->offset, s_reqs[first].file->seq, s_reqs[first].offset)) {
+            first = i;
+        }
+        if (!key_before(r->file->seq, r->offset, s_head_seq, s_head_off) &&
+            (ahead < 0 || key_before(r->file->seq, r->offset, s_reqs[ahead].file->seq, s_reqs[ahead].offset))) {
+            ahead = i;
+        }
+    }
+    return ahead >= 0 ? ahead : first;
+}
+
+// 取出一批：选中的请求加上同一文件中可以合并进同一段连续读取的请求，按偏移排序
+static int take_batch(io_req_t *batch) {
+    const int pick = pick_request();
+    if (pick < 0) {
+        return 0;
+    }
+    sd_io_file_t *file = s_reqs[pick].file;
+    uint32_t lo = s_reqs[pick].offset;
+    uint32_t hi = lo + s_reqs[pick].len;
+    const uint32_t span_max = hi - lo > SD_IO_CACHE_BYTES ? hi - lo : SD_IO_CACHE_BYTES;
+    batch[0] = s_reqs[pick];
+    s_reqs[pick].file = NULL;
+    int n = 1;
+
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+            io_req_t *r = &s_reqs[i];
+            if (r->file != file) {
+                continue;
+            }
+            const uint32_t r_hi = r->offset + r->len;
+            const uint32_t new_lo = r->offset < lo ? r->offset : lo;
+            const uint32_t new_hi = r_hi > hi ? r_hi : hi;
+            if (r->offset > hi + SD_IO_COALESCE_GAP || r_hi + SD_IO_COALESCE_GAP < lo ||
+                new_hi - new_lo > span_max) {
+                continue;
+            }
+            lo = new_lo;
+            hi = new_hi;
+            batch[n++] = *r;
+            r->file = NULL;
+            grew = true;
+        }
+    }
+    for (int i = 1; i < n; i++) {
+        const io_req_t r = batch[i];
+        int j = i;
+        for (; j > 0 && batch[j - 1].offset > r.offset; j--) {
+            batch[j] = batch[j - 1];
+        }
+        batch[j] = r;
+    }
+    s_pending -= (uint8_t)n;
+    s_stats.coalesced += (uint32_t)(n - 1);
+    s_head_seq = file->seq;
+    s_head_off = hi;
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// 后台作业：每一步服务一批
+// ---------------------------------------------------------------------------
+
+static bool io_step(bg_job_t *job, void *arg) {
+    (void)arg;
+    io_req_t batch[SD_IO_MAX_REQUESTS];
+    size_t got[SD_IO_MAX_REQUESTS];
+
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_mux);
+    const int n = take_batch(batch);
+    portEXIT_CRITICAL(&s_mux);
+    if (n > 0) {
+        sd_io_file_t *file = batch[0].file;
+        const uint32_t lo = batch[0].offset;
+        uint32_t hi = lo;
+        for (int i = 0; i < n; i++) {
+            const uint32_t r_hi = batch[i].offset + batch[i].len;
+            hi = r_hi > hi ? r_hi : hi;
+        }
+        // 整批能放进缓存时先一次顺序读入，各请求再从缓存复制
+        if (hi - lo <= SD_IO_CACHE_BYTES) {
+            cache_warm(file, lo, hi - lo);
+        }
+        for (int i = 0; i < n; i++) {
+            got[i] = batch[i].buf != NULL
+                         ? read_locked(file, batch[i].offset, batch[i].buf, batch[i].len)
+                         : cache_warm(file, batch[i].offset, batch[i].len);
+        }
+    }
+    xSemaphoreGive(s_io_lock);
+
+    for (int i = 0; i < n; i++) {
+        if (batch[i].done != NULL) {
+            // 到文件末尾为止算作读满
+            const uint32_t size = batch[i].file->size;
+            const uint32_t avail = batch[i].offset < size ? size - batch[i].offset : 0;
+            const size_t want = batch[i].len < avail ? batch[i].len : avail;
+            batch[i].done(batch[i].user, got[i] >= want, got[i]);
+        }
+    }
+
+    portENTER_CRITICAL(&s_mux);
+    const bool more = s_pending > 0 && !bg_job_cancelled(job);
+    if (!more) {
+        s_job_active = false;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    return more;
+}
+
+// ---------------------------------------------------------------------------
+// 对外接口
+// ---------------------------------------------------------------------------
+
+sd_io_file_t *sd_io_open(const char *path) {
+    if (path == NULL) {
+        return NULL;
+    }
+    if (s_io_lock == NULL) {
+        s_io_lock = xSemaphoreCreateMutex();
+        if (s_io_lock == NULL) {
+            return NULL;
+        }
+    }
+    sd_io_file_t *file = (sd_io_file_t *)calloc(1, sizeof(sd_io_file_t));
+    if (file == NULL) {
+        return NULL;
+    }
+    file->fp = file_pool_fopen(path);
+    if (file->fp == NULL) {
+        free(file);
+        return NULL;
+    }
+    // 块缓存之外再经过 stdio 缓冲只是多一次复制
+    setvbuf(file->fp, NULL, _IONBF, 0);
+    fseek(file->fp, 0, SEEK_END);
+    const long size = ftell(file->fp);
+    file->size = size > 0 ? (uint32_t)size : 0;
+    file->pos = SD_IO_NO_POS;
+
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    file->seq = s_next_seq++;
+    if (s_open_files++ == 0 && s_cache == NULL) {
+        s_cache = (uint8_t *)heap_stats_malloc(HEAP_TAG_IO, SD_IO_CACHE_BYTES);
+        memset(s_tags, 0, sizeof(s_tags));
+        if (s_cache == NULL) {
+            ESP_LOGW(TAG, "No memory for block cache, reads go straight to SD");
+        }
+    }
+    xSemaphoreGive(s_io_lock);
+    return file;
+}
+
+void sd_io_close(sd_io_file_t *file) {
+    if (file == NULL) {
+        return;
+    }
+    io_req_t cancelled[SD_IO_MAX_REQUESTS];
+    int n = 0;
+
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+        if (s_reqs[i].file == file) {
+            cancelled[n++] = s_reqs[i];
+            s_reqs[i].file = NULL;
+            s_pending--;
+        }
+    }
+    portEXIT_CRITICAL(&s_mux);
+    cache_forget(file);
+    fclose(file->fp);
+    if (--s_open_files == 0) {
+        heap_stats_free(HEAP_TAG_IO, s_cache);
+        s_cache = NULL;
+    }
+    xSemaphoreGive(s_io_lock);
+    free(file);
+
+    for (int i = 0; i < n; i++) {
+        if (cancelled[i].done != NULL) {
+            cancelled[i].done(cancelled[i].user, false, 0);
+        }
+    }
+}
+
+uint32_t sd_io_size(const sd_io_file_t *file) {
+    return file != NULL ? file->size : 0;
+}
+
+bool sd_io_read_async(sd_io_file_t *file, uint32_t offset, size_t len, void *buf,
+                      sd_io_prio_t prio, sd_io_done_t done, void *user) {
+    if (file == NULL || len == 0 || prio >= SD_IO_PRIO_COUNT) {
+        return false;
+    }
+    int slot = -1;
+    bool need_job = false;
+    portENTER_CRITICAL(&s_mux);
+    for (int i = 0; i < SD_IO_MAX_REQUESTS && slot < 0; i++) {
+        if (s_reqs[i].file == NULL) {
+            slot = i;
+        }
+    }
+    if (slot >= 0) {
+        s_reqs[slot] = (io_req_t){
+            .file = file, .offset = offset, .len = (uint32_t)len, .buf = (uint8_t *)buf,
+            .done = done, .user = user, .prio = (uint8_t)prio,
+        };
+        s_pending++;
+        s_stats.requests++;
+        need_job = !s_job_active;
+        s_job_active = true;
+    } else {
+        s_stats.dropped++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (slot < 0) {
+        return false;
+    }
+    if (need_job) {
+        // 作业优先级取自触发它的请求（两者的级别一一对应）
+        const bg_job_desc_t desc = {
+            .name = "sd_io",
+            .prio = (bg_job_prio_t)prio,
+            .step = io_step,
+        };
+        if (bg_jobs_submit(&desc) == BG_JOB_NONE) {
+            portENTER_CRITICAL(&s_mux);
+            if (s_reqs[slot].file == file) {
+                s_reqs[slot].file = NULL;
+                s_pending--;
+            }
+            s_job_active = false;
+            portEXIT_CRITICAL(&s_mux);
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t sd_io_read(sd_io_file_t *file, uint32_t offset, void *buf, size_t len) {
+    if (file == NULL || buf == NULL || len == 0) {
+        return 0;
+    }
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    spi_arbiter_sd_begin();
+    const size_t n = read_locked(file, offset, (uint8_t *)buf, len);
+    spi_arbiter_sd_end();
+    xSemaphoreGive(s_io_lock);
+    return n;
+}
+
+void sd_io_get_stats(sd_io_stats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    *out = s_stats;
+    portEXIT_CRITICAL(&s_mux);
+}
@@ -0,0 +1,97 @@
+/**
+ * @file sd_io.h
+ * @brief SD 卡异步读取服务：排序合并的读请求 + FATFS 之前的小块缓存
+ *
+ * 字体、书籍、图片各自在所在任务里同步 fseek/fread，后台预读只能阻塞调用者。
+ * 这里的读请求（文件、偏移、长度、回调、优先级）进入队列，由后台作业（bg_jobs）
+ * 在低优先级任务中执行：
+ *   - 先服务最高优先级的请求，同级内按 (文件, 偏移) 单向扫描（电梯算法），
+ *     读完一处继续向后，扫到末尾再回到开头，减少来回定位
+ *   - 同一文件中重叠或相距不超过 SD_IO_COALESCE_GAP 的请求合并为一次连续读取
+ *   - 读到的块放进 SD_IO_CACHE_BLOCKS 个 SD_IO_BLOCK 字节的块缓存（LRU），
+ *     同步读取 sd_io_read 先查缓存，缺的部分直接读进调用者的缓冲区
+ * 预读者提交 buf 为 NULL 的请求只把块读进缓存，之后的同步读取就不用等 SD 卡。
+ *
+ * 块缓存在第一个文件打开时分配，最后一个文件关闭时释放。sd_io_read 与后台读取
+ * 共用一把互斥锁（优先级继承），可在任意任务调用
+ */
+
+#ifndef SD_IO_H
+#define SD_IO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SD_IO_BLOCK          2048   // 缓存块大小（与 TXT 读取窗口的块一致）
+#define SD_IO_CACHE_BLOCKS   4      // 8 KB
+#define SD_IO_MAX_REQUESTS   16     // 排队的读请求上限
+#define SD_IO_COALESCE_GAP   512    // 间隔不超过此值的请求合并读取
+
+typedef enum {
+    SD_IO_PRIO_HIGH = 0,
+    SD_IO_PRIO_NORMAL,
+    SD_IO_PRIO_LOW,
+    SD_IO_PRIO_COUNT
+} sd_io_prio_t;
+
+typedef struct sd_io_file sd_io_file_t;
+
+/**
+ * @brief 读请求完成（在后台任务中调用）
+ * @param ok 读满了请求的长度（到文件末尾的部分算作读满）
+ * @param len 实际读到的字节数
+ */
+typedef void (*sd_io_done_t)(void *user, bool ok, size_t len);
+
+typedef struct {
+    uint32_t requests;       // 提交的异步请求
+    uint32_t coalesced;      // 并入其它请求一起读取的请求
+    uint32_t block_hits;     // 从块缓存取到的块（同步与异步合计）
+    uint32_t block_reads;    // 从 SD 卡读入缓存的块
+    uint32_t direct_bytes;   // 不经缓存直接读进调用者缓冲区的字节数
+    uint32_t dropped;        // 队列已满被拒绝的请求
+} sd_io_stats_t;
+
+/**
+ * @brief 打开文件（只读，经 file_pool 共享 FATFS 文件槽）
+ * @return 句柄；文件不存在或内存不足时为 NULL
+ */
+sd_io_file_t *sd_io_open(const char *path);
+
+/**
+ * @brief 关闭文件：排队中的请求以 ok = false 完成，缓存中的块作废
+ */
+void sd_io_close(sd_io_file_t *file);
+
+/**
+ * @brief 文件大小
+ */
+uint32_t sd_io_size(const sd_io_file_t *file);
+
+/**
+ * @brief 提交异步读取
+ * @param buf 目标缓冲区（完成前保持有效）；NULL 表示只预读进块缓存
+ * @param done 完成回调，可为 NULL
+ * @return false 队列已满或参数无效（不调用 done）
+ */
+bool sd_io_read_async(sd_io_file_t *file, uint32_t offset, size_t len, void *buf,
+                      sd_io_prio_t prio, sd_io_done_t done, void *user);
+
+/**
+ * @brief 同步读取：缓存中的块直接复制，其余部分从 SD 卡读
+ * @return 读到的字节数（到文件末尾为止）
+ */
+size_t sd_io_read(sd_io_file_t *file, uint32_t offset, void *buf, size_t len);
+
+void sd_io_get_stats(sd_io_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SD_IO_H
@@ -0,0 +1,308 @@
+/**
+ * @file search_list.c
+ * @brief TXT 全文搜索浮层实现
+ */
+
+#include "search_list.h"
+#include "book_search.h"
+#include "page_index.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "SEARCH_LIST";
+
+#define LIST_MAX_ROWS     20   // 每页最多行数
+#define LIST_HEADER_H     40   // 标题栏高度（与阅读界面状态栏一致）
+#define LIST_ROW_PAD      6    // 行内上下留白
+
+typedef enum {
+    MODE_QUERIES,
+    MODE_HITS,
+} list_mode_t;
+
+static struct {
+    lv_obj_t *panel;
+    lv_obj_t *header;
+    lv_obj_t *rows[LIST_MAX_ROWS];
+    int rows_per_page;
+    list_mode_t mode;
+    int total;                 // 当前模式的条目数
+    int page_first;            // 当前页第一项的序号
+    int selected;
+    const char *message;       // 没有条目时显示的说明
+    char (*queries)[BOOK_SEARCH_MAX_QUERY + 1];
+    int query_count;
+    int query_selected;        // 返回查询词列表时恢复选中项
+    book_search_hit_t *hits;
+    int hit_count;
+    bool hits_truncated;
+} s_list;
+
+// 读入查询词：每行一个，忽略空行与首尾空白
+static void load_queries(void) {
+    s_list.query_count = 0;
+    FILE *f = fopen(SEARCH_LIST_QUERY_FILE, "r");
+    if (f == NULL) {
+        return;
+    }
+    char line[BOOK_SEARCH_MAX_QUERY + 8];
+    while (s_list.query_count < SEARCH_LIST_MAX_QUERIES && fgets(line, sizeof(line), f) != NULL) {
+        char *s = line;
+        if (s_list.query_count == 0 && memcmp(s, "\xEF\xBB\xBF", 3) == 0) {
+            s += 3;  // BOM
+        }
+        while (*s == ' ' || *s == '\t') s++;
+        size_t len = strcspn(s, "\r\n");
+        while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t')) len--;
+        if (len == 0 || len > BOOK_SEARCH_MAX_QUERY) {
+            continue;
+        }
+        memcpy(s_list.queries[s_list.query_count], s, len);
+        s_list.queries[s_list.query_count][len] = '\0';
+        s_list.query_count++;
+    }
+    fclose(f);
+}
+
+static void set_row_selected(int row, bool selected) {
+    lv_obj_t *label = s_list.rows[row];
+    lv_obj_set_style_bg_color(label, selected ? lv_color_black() : lv_color_white(), 0);
+    lv_obj_set_style_text_color(label, selected ? lv_color_white() : lv_color_black(), 0);
+}
+
+static void update_header(void) {
+    const int pages = s_list.total > 0 ? (s_list.total + s_list.rows_per_page - 1) / s_list.rows_per_page : 1;
+    const int page = s_list.page_first / s_list.rows_per_page + 1;
+    if (s_list.mode == MODE_HITS) {
+        lv_label_set_text_fmt(s_list.header, "“%s” %d%s 处  %d / %d", s_list.queries[s_list.query_selected],
+                              s_list.hit_count, s_list.hits_truncated ? "+" : "", page, pages);
+    } else if (!book_search_is_ready()) {
+        lv_label_set_text_fmt(s_list.header, "搜索（正在建立索引 %d%%）  %d / %d", book_search_progress(),
+                              page, pages);
+    } else {
+        lv_label_set_text_fmt(s_list.header, "搜索  %d / %d", page, pages);
+    }
+}
+
+static void set_row_text(lv_obj_t *label, int index) {
+    if (s_list.mode == MODE_QUERIES) {
+        lv_label_set_text(label, s_list.queries[index]);
+        return;
+    }
+    const book_search_hit_t *hit = &s_list.hits[index];
+    const int page = page_index_find_page(hit->offset);
+    if (page > 0) {
+        lv_label_set_text_fmt(label, "第 %d 页  %s", page, hit->snippet);
+    } else {
+        lv_label_set_text_fmt(label, "第 ? 页  %s", hit->snippet);
+    }
+}
+
+// 刷新 page_first 开始的一页
+static void load_page(void) {
+    for (int i = 0; i < s_list.rows_per_page; i++) {
+        lv_obj_t *label = s_list.rows[i];
+        const int index = s_list.page_first + i;
+        if (index < s_list.total) {
+            set_row_text(label, index);
+            lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+        } else if (s_list.total == 0 && i == 0 && s_list.message != NULL) {
+            lv_label_set_text(label, s_list.message);
+            lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        }
+        set_row_selected(i, s_list.total > 0 && index == s_list.selected);
+    }
+    update_header();
+}
+
+static void select_entry(int index) {
+    if (index >= s_list.total) index = s_list.total - 1;
+    if (index < 0) index = 0;
+    if (s_list.total == 0 || index == s_list.selected) {
+        return;
+    }
+    const int page_first = index / s_list.rows_per_page * s_list.rows_per_page;
+    if (page_first != s_list.page_first) {
+        s_list.selected = index;
+        s_list.page_first = page_first;
+        load_page();
+        return;
+    }
+    set_row_selected(s_list.selected - s_list.page_first, false);
+    set_row_selected(index - s_list.page_first, true);
+    s_list.selected = index;
+}
+
+static void show_queries(void) {
+    s_list.mode = MODE_QUERIES;
+    s_list.total = s_list.query_count;
+    s_list.message = "在 " SEARCH_LIST_QUERY_FILE " 中每行写一个查询词";
+    s_list.selected = s_list.query_selected < s_list.total ? s_list.query_selected : 0;
+    s_list.page_first = s_list.selected / s_list.rows_per_page * s_list.rows_per_page;
+    load_page();
+}
+
+// 搜索选中的查询词；索引未完成或查询词太短时留在查询词列表并给出说明
+static void run_query(void) {
+    if (s_list.hits == NULL) {
+        s_list.hits = malloc(SEARCH_LIST_MAX_HITS * sizeof(book_search_hit_t));
+        if (s_list.hits == NULL) {
+            ESP_LOGE(TAG, "No memory for search results");
+            return;
+        }
+    }
+    s_list.query_selected = s_list.selected;
+    const book_search_status_t status =
+        book_search_run(s_list.queries[s_list.selected], s_list.hits, SEARCH_LIST_MAX_HITS,
+                        &s_list.hit_count, &s_list.hits_truncated);
+    if (status == BOOK_SEARCH_BUILDING) {
+        update_header();
+        return;
+    }
+    s_list.mode = MODE_HITS;
+    s_list.total = status == BOOK_SEARCH_OK ? s_list.hit_count : 0;
+    s_list.message = status == BOOK_SEARCH_OK        ? "没有找到"
+                     : status == BOOK_SEARCH_TOO_SHORT ? "查询词至少要有两个相连的汉字或一个英文单词"
+                                                       : "搜索失败";
+    s_list.selected = 0;
+    s_list.page_first = 0;
+    load_page();
+}
+
+// 浮层随阅读界面一起销毁时也在这里释放
+static void panel_delete_cb(lv_event_t *e) {
+    (void)e;
+    free(s_list.queries);
+    free(s_list.hits);
+    memset(&s_list, 0, sizeof(s_list));
+}
+
+bool search_list_open(lv_obj_t *parent, const lv_font_t *font) {
+    if (parent == NULL || font == NULL) {
+        return false;
+    }
+    search_list_close();
+
+    s_list.queries = malloc(SEARCH_LIST_MAX_QUERIES * sizeof(*s_list.queries));
+    if (s_list.queries == NULL) {
+        ESP_LOGE(TAG, "No memory for search list");
+        return false;
+    }
+    load_queries();
+
+    lv_obj_update_layout(parent);
+    const int32_t height = lv_obj_get_height(parent);
+    const int32_t row_h = lv_font_get_line_height(font) + 2 * LIST_ROW_PAD;
+    int rows = (int)((height - LIST_HEADER_H) / row_h);
+    if (rows > LIST_MAX_ROWS) rows = LIST_MAX_ROWS;
+    if (rows < 1) rows = 1;
+    s_list.rows_per_page = rows;
+
+    s_list.panel = lv_obj_create(parent);
+    lv_obj_set_size(s_list.panel, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_pos(s_list.panel, 0, 0);
+    lv_obj_set_style_pad_all(s_list.panel, 0, 0);
+    lv_obj_set_style_bg_color(s_list.panel, lv_color_white(), 0);
+    lv_obj_set_style_border_width(s_list.panel, 0, 0);
+    lv_obj_set_scrollbar_mode(s_list.panel, LV_SCROLLBAR_MODE_OFF);
+    lv_obj_add_event_cb(s_list.panel, panel_delete_cb, LV_EVENT_DELETE, NULL);
+
+    lv_obj_t *header_bar = lv_obj_create(s_list.panel);
+    lv_obj_set_size(header_bar, LV_PCT(100), LIST_HEADER_H);
+    lv_obj_set_pos(header_bar, 0, 0);
+    lv_obj_set_style_pad_all(header_bar, 8, 0);
+    lv_obj_set_style_bg_color(header_bar, lv_color_black(), 0);
+    lv_obj_set_style_border_width(header_bar, 0, 0);
+
+    s_list.header = lv_label_create(header_bar);
+    lv_obj_set_style_text_font(s_list.header, font, 0);
+    lv_obj_set_style_text_color(s_list.header, lv_color_white(), 0);
+    lv_obj_align(s_list.header, LV_ALIGN_LEFT_MID, 5, 0);
+
+    for (int i = 0; i < rows; i++) {
+        lv_obj_t *label = lv_label_create(s_list.panel);
+        lv_obj_set_size(label, LV_PCT(100), row_h);
+        lv_obj_set_pos(label, 0, LIST_HEADER_H + i * row_h);
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_obj_set_style_pad_top(label, LIST_ROW_PAD, 0);
+        lv_obj_set_style_pad_left(label, 8, 0);
+        lv_obj_set_style_pad_right(label, 8, 0);
+        lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+        s_list.rows[i] = label;
+    }
+
+    show_queries();
+    ESP_LOGI(TAG, "Opened: %d queries", s_list.query_count);
+    return true;
+}
+
+bool search_list_is_open(void) {
+    return s_list.panel != NULL;
+}
+
+search_list_result_t search_list_handle_key(uint32_t key, long *offset) {
+    if (s_list.panel == NULL) {
+        return SEARCH_LIST_CLOSED;
+    }
+
+    switch (key) {
+        case LV_KEY_UP:
+        case LV_KEY_PREV:
+            select_entry(s_list.selected - 1);
+            break;
+
+        case LV_KEY_DOWN:
+        case LV_KEY_NEXT:
+            select_entry(s_list.selected + 1);
+            break;
+
+        case LV_KEY_LEFT:
+            select_entry(s_list.selected - s_list.rows_per_page);
+            break;
+
+        case LV_KEY_RIGHT:
+            select_entry(s_list.selected + s_list.rows_per_page);
+            break;
+
+        case LV_KEY_ENTER:
+            if (s_list.total == 0) {
+                break;
+            }
+            if (s_list.mode == MODE_QUERIES) {
+                run_query();
+                break;
+            }
+            if (offset != NULL) {
+                *offset = s_list.hits[s_list.selected].offset;
+            }
+            search_list_close();
+            return SEARCH_LIST_SELECTED;
+
+        case LV_KEY_ESC:
+            if (s_list.mode == MODE_HITS) {
+                show_queries();
+                break;
+            }
+            search_list_close();
+            return SEARCH_LIST_CLOSED;
+
+        default:
+            break;
+    }
+    return SEARCH_LIST_NONE;
+}
+
+void search_list_close(void) {
+    if (s_list.panel != NULL) {
+        lv_obj_delete(s_list.panel);  // 由 panel_delete_cb 释放
+    } else {
+        free(s_list.queries);
+        free(s_list.hits);
+        memset(&s_list, 0, sizeof(s_list));
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file search_list.h
+ * @brief TXT 全文搜索浮层 - 先选查询词，再列出命中的页码与摘要
+ *
+ * 阅读器只有按键，查询词预先写在 SEARCH_LIST_QUERY_FILE 中（UTF-8，每行一个，
+ * 可在电脑上编辑或经 Wi-Fi/BLE 上传）。选中后用 book_search 查询，结果按文件位置
+ * 排列，页码取自分页索引（尚未索引到的显示为 ?）
+ */
+
+#ifndef SEARCH_LIST_H
+#define SEARCH_LIST_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SEARCH_LIST_QUERY_FILE  "/sdcard/搜索.txt"
+#define SEARCH_LIST_MAX_QUERIES 32
+#define SEARCH_LIST_MAX_HITS    100
+
+// 按键处理结果
+typedef enum {
+    SEARCH_LIST_NONE,        // 列表内移动或切换，需要刷新屏幕
+    SEARCH_LIST_CLOSED,      // 浮层已关闭
+    SEARCH_LIST_SELECTED,    // 选中了命中位置，浮层已关闭
+} search_list_result_t;
+
+/**
+ * @brief 打开搜索浮层（查询词列表）
+ * @param parent 父对象（浮层铺满父对象）
+ * @param font 文字字体
+ * @return true 成功，false 内存不足
+ */
+bool search_list_open(lv_obj_t *parent, const lv_font_t *font);
+
+/**
+ * @brief 浮层是否打开
+ */
+bool search_list_is_open(void);
+
+/**
+ * @brief 处理按键：上/下移动，左/右翻页，确认搜索或跳转，返回回到查询词或关闭
+ * @param key LVGL 键值
+ * @param offset 输出：选中命中的文件偏移（SEARCH_LIST_SELECTED 时有效）
+ * @return 处理结果
+ */
+search_list_result_t search_list_handle_key(uint32_t key, long *offset);
+
+/**
+ * @brief 关闭搜索浮层
+ */
+void search_list_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SEARCH_LIST_H
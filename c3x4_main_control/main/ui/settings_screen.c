@@ -8,8 +8,18 @@
 #include "screen_manager.h"
 #include "font_manager.h"
 #include "font_loader.h"
+#include "../display_bench.h"
+#include "../text_bench.h"
+#include "../wifi_transfer.h"
+#include "../usb_transfer.h"
+#include "../ble_power.h"
+#include "../heap_stats.h"
+#include "../mem_pressure.h"
+#include "../stack_stats.h"
+#include "../turn_stats.h"
 #include "esp_log.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "SETTINGS_SCR";
@@ -20,6 +30,12 @@ typedef struct {
     lv_obj_t *font_buttons[21];       // 字体选择按钮（1个默认 + 20个SD卡字体）
     int font_button_count;            // 字体按钮数量
     int selected_font_index;          // 当前选中的字体索引
+    lv_obj_t *focused_btn;            // 当前焦点按钮（焦点移动时与新按钮一起局刷）
+
+    // 字体预览条（从扫描缓存读出，列表重建时释放）
+    uint8_t *preview_data;
+    lv_image_dsc_t preview_dsc[20];
+    int preview_count;
 
     lv_indev_t *indev;
     lv_group_t *group;
@@ -32,6 +48,89 @@ static void settings_font_button_event_cb(lv_event_t *e);
 static void settings_font_button_focused_cb(lv_event_t *e);
 static void settings_screen_destroy_cb(lv_event_t *e);
 static void settings_key_event_cb(lv_event_t *e);
+static void settings_bench_button_event_cb(lv_event_t *e);
+static void settings_text_bench_button_event_cb(lv_event_t *e);
+static void settings_wifi_button_event_cb(lv_event_t *e);
+static void settings_usb_button_event_cb(lv_event_t *e);
+static void settings_ble_button_event_cb(lv_event_t *e);
+static void settings_heap_button_event_cb(lv_event_t *e);
+static void settings_turn_button_event_cb(lv_event_t *e);
+
+// 内存读数：空闲/最低空闲/最大块，第二行为各子系统当前占用（KB）
+static void format_heap_text(char *buf, size_t len)
+{
+    heap_stats_t st;
+    heap_stats_get(&st);
+    int pos = snprintf(buf, len, "Memory: %u KB free (min %u), block %u KB\n",
+                       (unsigned)(st.free / 1024), (unsigned)(st.min_free / 1024),
+                       (unsigned)(st.largest / 1024));
+    for (int i = 0; i < HEAP_TAG_COUNT && pos > 0 && (size_t)pos < len; i++) {
+        pos += snprintf(buf + pos, len - pos, "%s%s %u", i ? ", " : "",
+                        heap_stats_tag_name((heap_tag_t)i), (unsigned)(st.tags[i].cur / 1024));
+    }
+}
+
+// 翻页延时：每个有样本的刷新模式一行，总延时分位数后是各阶段平均耗时（ms）
+static void format_turn_text(char *buf, size_t len)
+{
+    turn_stats_t st;
+    turn_stats_get(&st);
+    int pos = snprintf(buf, len, "Page turns (dropped %u)", (unsigned)st.dropped);
+    for (int i = 0; i < TURN_MODE_COUNT && pos > 0 && (size_t)pos < len; i++) {
+        const turn_mode_stats_t *m = &st.modes[i];
+        if (m->samples == 0) {
+            continue;
+        }
+        const turn_hist_t *total = &m->series[TURN_SERIES_TOTAL];
+        pos += snprintf(buf + pos, len - pos, "\n%s n=%u p50 %u p90 %u max %u:",
+                        turn_stats_mode_name((turn_mode_t)i), (unsigned)m->samples,
+                        (unsigned)turn_stats_percentile(total, 500),
+                        (unsigned)turn_stats_percentile(total, 900), (unsigned)total->max_ms);
+        for (int s = 0; s < TURN_STAGE_COUNT && pos > 0 && (size_t)pos < len; s++) {
+            pos += snprintf(buf + pos, len - pos, " %s %u", turn_stats_series_name(s),
+                            (unsigned)(m->series[s].sum_ms / m->samples));
+        }
+    }
+}
+
+// 释放字体预览条
+static void free_font_previews(void)
+{
+    for (int i = 0; i < g_settings.preview_count; i++) {
+        lv_image_cache_drop(&g_settings.preview_dsc[i]);
+    }
+    free(g_settings.preview_data);
+    g_settings.preview_data = NULL;
+    g_settings.preview_count = 0;
+}
+
+// 给字体按钮加上预览条（示例文字由字体本身渲染，扫描字体时生成）
+static void add_font_preview(lv_obj_t *btn, int font_index)
+{
+    if (g_settings.preview_data == NULL || g_settings.preview_count >= 20) {
+        return;
+    }
+    uint8_t *buf = g_settings.preview_data + g_settings.preview_count * FONT_PREVIEW_BYTES;
+    if (!font_loader_read_preview(font_index, buf)) {
+        return;
+    }
+
+    lv_image_dsc_t *dsc = &g_settings.preview_dsc[g_settings.preview_count++];
+    memset(dsc, 0, sizeof(*dsc));
+    dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc->header.cf = LV_COLOR_FORMAT_A1;
+    dsc->header.w = FONT_PREVIEW_W;
+    dsc->header.h = FONT_PREVIEW_H;
+    dsc->header.stride = FONT_PREVIEW_STRIDE;
+    dsc->data = buf;
+    dsc->data_size = FONT_PREVIEW_BYTES;
+
+    lv_obj_t *img = lv_image_create(btn);
+    lv_image_set_src(img, dsc);
+    lv_obj_add_flag(img, LV_OBJ_FLAG_USER_1);   // 标记为预览条，切换选中状态时改颜色
+    lv_obj_set_style_image_recolor(img, lv_color_black(), 0);
+    lv_obj_set_style_image_recolor_opa(img, LV_OPA_COVER, 0);
+}
 
 // 设置按钮选中状态
 static void set_font_button_selected(lv_obj_t *btn, bool selected)
@@ -54,6 +153,15 @@ static void set_font_button_selected(lv_obj_t *btn, bool selected)
         lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
         lv_obj_set_style_text_color(label, lv_color_black(), 0);
     }
+
+    // 预览条是 A1 图像，颜色取自 recolor
+    const uint32_t child_count = lv_obj_get_child_count(btn);
+    for (uint32_t i = 0; i < child_count; i++) {
+        lv_obj_t *child = lv_obj_get_child(btn, i);
+        if (lv_obj_has_flag(child, LV_OBJ_FLAG_USER_1)) {
+            lv_obj_set_style_image_recolor(child, selected ? lv_color_white() : lv_color_black(), 0);
+        }
+    }
 }
 
 // 刷新字体列表显示
@@ -74,8 +182,10 @@ static void update_font_list_display(void)
         lv_indev_set_group(g_settings.indev, g_settings.group);
     }
 
-    // 清空列表
+    // 清空列表（预览条图像先删掉再释放数据）
     lv_obj_clean(g_settings.font_list);
+    free_font_previews();
+    g_settings.focused_btn = NULL;
 
     g_settings.font_button_count = 0;
 
@@ -83,6 +193,14 @@ static void update_font_list_display(void)
     const font_info_t *font_list = font_manager_get_font_list();
     int font_count = font_manager_get_font_count();
 
+    int preview_rows = 0;
+    for (int i = 0; i < font_count && i < 20; i++) {
+        preview_rows += font_list[i].has_preview ? 1 : 0;
+    }
+    if (preview_rows > 0) {
+        g_settings.preview_data = (uint8_t *)malloc((size_t)preview_rows * FONT_PREVIEW_BYTES);
+    }
+
     // 添加默认字体选项
     lv_obj_t *btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_SETTINGS, "Default (Montserrat)");
     lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
@@ -110,7 +228,12 @@ static void update_font_list_display(void)
     // 添加所有字体选项（最多 MAX_FONTS 个）
     for (int i = 0; i < font_count && g_settings.font_button_count < 20; i++) {
         char btn_text[128];
-        snprintf(btn_text, sizeof(btn_text), "%s", font_list[i].name);
+        if (font_list[i].line_height > 0) {
+            snprintf(btn_text, sizeof(btn_text), "%s (%upx)", font_list[i].name,
+                     (unsigned)font_list[i].line_height);
+        } else {
+            snprintf(btn_text, sizeof(btn_text), "%s", font_list[i].name);
+        }
 
         // 记录原始文件名和显示文本
         ESP_LOGI(TAG, "Font [%d]: name='%s' (len=%zu), file_path='%s'",
@@ -136,6 +259,9 @@ static void update_font_list_display(void)
         if (icon) {
             lv_obj_set_style_text_color(icon, lv_color_black(), 0);
         }
+        if (font_list[i].has_preview) {
+            add_font_preview(btn, i);
+        }
 
         lv_obj_add_event_cb(btn, settings_font_button_event_cb, LV_EVENT_CLICKED, (void *)(uintptr_t)i);
         lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, (void *)(uintptr_t)i);
@@ -151,15 +277,148 @@ static void update_font_list_display(void)
         }
     }
 
+    // 工具：显示流水线基准测试（结果写入 /sdcard/bench）
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_REFRESH, "Display benchmark");
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_bench_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：文本流水线基准测试（语料与结果都在 /sdcard/bench）
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_FILE, "Text benchmark");
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_text_bench_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：Wi-Fi 传输模式（期间关闭蓝牙，浏览器上传/下载 SD 卡文件）
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_WIFI, "Wi-Fi transfer");
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_wifi_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：USB 传输模式（期间关闭蓝牙，电脑上用 tools/x4usb.py 批量同步）
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_USB, "USB transfer");
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_usb_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：蓝牙开关（开机不启动，空闲超时后自动关闭）
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_BLUETOOTH,
+                             ble_power_is_on() ? "Bluetooth: On" : "Bluetooth: Off");
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_ble_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：内存读数（点击重新采样并在串口打印完整统计）
+    char heap_text[128];
+    format_heap_text(heap_text, sizeof(heap_text));
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_LIST, heap_text);
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_heap_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
+    // 工具：翻页延时统计（跨重启累计，点击重新读取）
+    char turn_text[512];
+    format_turn_text(turn_text, sizeof(turn_text));
+    btn = lv_list_add_button(g_settings.font_list, LV_SYMBOL_LIST, turn_text);
+    lv_obj_set_style_bg_color(btn, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    label = lv_obj_get_child(btn, 0);
+    icon = lv_obj_get_child(btn, 1);
+    if (label) {
+        lv_obj_set_style_text_font(label, (lv_font_t *)&lv_font_montserrat_14, 0);
+        lv_obj_set_style_text_color(label, lv_color_black(), 0);
+    }
+    if (icon) {
+        lv_obj_set_style_text_color(icon, lv_color_black(), 0);
+    }
+    lv_obj_add_event_cb(btn, settings_turn_button_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(btn, settings_font_button_focused_cb, LV_EVENT_FOCUSED, NULL);
+    if (g_settings.group) {
+        lv_group_add_obj(g_settings.group, btn);
+    }
+
     // 如果选择的是默认字体，高亮默认选项
     if (g_settings.selected_font_index == -1 && g_settings.font_button_count > 0) {
         set_font_button_selected(g_settings.font_buttons[0], true);
     }
-
-    // 触发渲染
-    for (int i = 0; i < 3; i++) {
-        lvgl_trigger_render(NULL);
-    }
 }
 
 // 字体按钮点击事件
@@ -202,10 +461,103 @@ static void settings_font_button_event_cb(lv_event_t *e)
 
     // 刷新显示
     update_font_list_display();
+    screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+}
+
+// 基准测试按钮：测试在 LVGL 定时器中运行，完成后回到本页
+static void settings_bench_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    if (!display_bench_request()) {
+        ESP_LOGW(TAG, "Display benchmark already running");
+    }
+}
+
+// 文本基准测试按钮：在 LVGL 定时器中运行，结束后回到本页
+static void settings_text_bench_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    if (!text_bench_request()) {
+        ESP_LOGW(TAG, "A benchmark is already running");
+    }
+}
+
+// Wi-Fi 传输模式按钮：切换在 LVGL 定时器中进行，返回键退出后回到本页
+static void settings_wifi_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    if (!wifi_transfer_request()) {
+        ESP_LOGW(TAG, "Wi-Fi transfer mode unavailable or already active");
+    }
+}
+
+// USB 传输模式按钮：与 Wi-Fi 传输模式相同，返回键退出后回到本页
+static void settings_usb_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    if (!usb_transfer_request()) {
+        ESP_LOGW(TAG, "USB transfer mode unavailable or already active");
+    }
+}
+
+// 蓝牙开关按钮：启动/关闭协议栈要几百毫秒，完成后更新按钮文字
+static void settings_ble_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
 
-    // 触发 EPD 刷新
-    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-    lvgl_display_refresh();
+    if (!ble_power_set(!ble_power_is_on())) {
+        ESP_LOGW(TAG, "Bluetooth toggle failed (start error or transfer in progress)");
+    }
+
+    lv_obj_t *btn = lv_event_get_target(e);
+    lv_list_set_button_text(g_settings.font_list, btn,
+                            ble_power_is_on() ? "Bluetooth: On" : "Bluetooth: Off");
+    screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+}
+
+// 内存读数按钮：重新采样，完整统计打印到串口
+static void settings_heap_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    heap_stats_log();
+    mem_pressure_log();
+    stack_stats_log();
+    char heap_text[128];
+    format_heap_text(heap_text, sizeof(heap_text));
+    lv_obj_t *btn = lv_event_get_target(e);
+    lv_list_set_button_text(g_settings.font_list, btn, heap_text);
+    screen_manager_refresh(SCREEN_REFRESH_FOCUS);
+}
+
+// 翻页延时按钮：重新读取统计
+static void settings_turn_button_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) != LV_EVENT_CLICKED) {
+        return;
+    }
+
+    char turn_text[512];
+    format_turn_text(turn_text, sizeof(turn_text));
+    lv_obj_t *btn = lv_event_get_target(e);
+    lv_list_set_button_text(g_settings.font_list, btn, turn_text);
+    screen_manager_refresh(SCREEN_REFRESH_FOCUS);
 }
 
 // 字体按钮焦点事件
@@ -215,10 +567,19 @@ static void settings_font_button_focused_cb(lv_event_t *e)
         return;
     }
 
-    // 触发渲染
-    lvgl_trigger_render(NULL);
-    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
-    lvgl_display_refresh();
+    lv_obj_t *btn = lv_event_get_target(e);
+    lv_obj_t *from = g_settings.focused_btn;
+    g_settings.focused_btn = btn;
+
+    // 聚焦时 LVGL 已启动滚动动画：墨水屏上动画只会多刷几帧，直接滚到位。
+    // 列表滚动了就是整片内容更换，否则只局刷两个按钮
+    const int32_t scroll_y = lv_obj_get_scroll_y(g_settings.font_list);
+    lv_obj_scroll_to_view(btn, LV_ANIM_OFF);
+    if (lv_obj_get_scroll_y(g_settings.font_list) != scroll_y) {
+        screen_manager_refresh(SCREEN_REFRESH_CONTENT);
+    } else {
+        screen_manager_refresh_focus(from, btn);
+    }
 }
 
 // 按键事件（ESC 返回）
@@ -255,6 +616,7 @@ static void settings_screen_destroy_cb(lv_event_t *e)
         lv_group_del(g_settings.group);
         g_settings.group = NULL;
     }
+    free_font_previews();
 
     memset(&g_settings, 0, sizeof(settings_state_t));
 }
@@ -351,16 +713,8 @@ void settings_screen_create(lv_indev_t *indev)
     // 填充字体列表
     update_font_list_display();
 
-    // 刷新显示：先清空 framebuffer 为白色，确保旧数据被覆盖
-    lvgl_clear_framebuffer();
-
-    lv_obj_invalidate(screen);
-    for (int i = 0; i < 5; i++) {
-        lvgl_trigger_render(NULL);
-    }
-
-    // 初始刷新 EPD - 由 screen_manager 设置刷新模式（组件间切换用 FULL）
-    lvgl_display_refresh();
+    // 首次显示：刷新方式由 screen_manager 按画面变化量决定
+    screen_manager_refresh(SCREEN_REFRESH_TRANSITION);
 
     ESP_LOGI(TAG, "Settings screen created successfully");
 }
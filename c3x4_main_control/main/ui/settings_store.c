@@ -0,0 +1,204 @@
+/**
+ * @file settings_store.c
+ * @brief 设置存储实现
+ */
+
+#include "settings_store.h"
+#include "font_manager.h"
+#include "font_ttf.h"
+#include "page_index.h"
+#include "lvgl.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include <stddef.h>
+#include <string.h>
+
+static const char *TAG = "SETTINGS";
+
+#define NVS_NAMESPACE      "settings"
+#define NVS_SETTINGS_KEY   "values"
+#define NVS_LEGACY_FONT_NS "font_cfg"   // 旧版本的字体选择，只在第一次开机时迁移
+#define SETTINGS_MAGIC     0x5453       // "ST"
+#define SETTINGS_VERSION   1
+
+typedef struct {
+    int32_t def;
+    int32_t min;
+    int32_t max;
+} setting_desc_t;
+
+static const setting_desc_t s_desc[SETTING_COUNT] = {
+    [SETTING_FONT_INDEX]          = { -1, -2, 255 },
+    [SETTING_TTF_SIZE]            = { FONT_MANAGER_TTF_SIZE_DEFAULT, FONT_TTF_SIZE_MIN, FONT_TTF_SIZE_MAX },
+    [SETTING_READER_FONT_SIZE]    = { 14, 8, 48 },
+    [SETTING_READER_LINE_SPACING] = { 2, 0, 32 },
+    [SETTING_READER_MARGIN]       = { 10, 0, 100 },
+    [SETTING_READER_AUTO_REFRESH] = { 1, 0, 1 },
+    [SETTING_SCALED_FONT_SIZE]    = { 0, 0, FONT_TTF_SIZE_MAX },
+    [SETTING_READER_ORIENTATION]  = { 0, 0, 2 },
+};
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t count;                    // 写入时的设置项数
+    uint32_t checksum;                // page_index_hash(0, values, count * 4)
+    int32_t values[SETTING_COUNT];
+} settings_blob_t;
+
+static int32_t s_values[SETTING_COUNT];
+static bool s_loaded = false;
+static bool s_dirty = false;
+static lv_timer_t *s_flush_timer = NULL;
+
+static int32_t clamp_value(setting_key_t key, int32_t value) {
+    if (value < s_desc[key].min) {
+        return s_desc[key].min;
+    }
+    if (value > s_desc[key].max) {
+        return s_desc[key].max;
+    }
+    return value;
+}
+
+// 旧版本：字体选择存在 font_cfg 命名空间的两个 i32 中
+static bool migrate_legacy(void) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_LEGACY_FONT_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    int32_t v = 0;
+    bool found = false;
+    if (nvs_get_i32(nvs_handle, NVS_KEY_CURRENT_FONT, &v) == ESP_OK) {
+        s_values[SETTING_FONT_INDEX] = clamp_value(SETTING_FONT_INDEX, v);
+        found = true;
+    }
+    if (nvs_get_i32(nvs_handle, NVS_KEY_TTF_SIZE, &v) == ESP_OK) {
+        s_values[SETTING_TTF_SIZE] = clamp_value(SETTING_TTF_SIZE, v);
+        found = true;
+    }
+    nvs_close(nvs_handle);
+    return found;
+}
+
+static bool load_blob(void) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    settings_blob_t blob;
+    size_t len = sizeof(blob);
+    const esp_err_t err = nvs_get_blob(nvs_handle, NVS_SETTINGS_KEY, &blob, &len);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) {
+        return false;
+    }
+
+    // 旧版本写入的项较少，多出的项保持默认值
+    const size_t header = offsetof(settings_blob_t, values);
+    const unsigned stored = len >= header ? blob.count : 0;
+    if (len < header || blob.magic != SETTINGS_MAGIC || blob.version != SETTINGS_VERSION ||
+        stored > SETTING_COUNT || len != header + stored * sizeof(int32_t) ||
+        blob.checksum != page_index_hash(0, blob.values, stored * sizeof(int32_t))) {
+        ESP_LOGW(TAG, "Discarding invalid settings (%u bytes)", (unsigned)len);
+        return false;
+    }
+    for (unsigned i = 0; i < stored; i++) {
+        s_values[i] = clamp_value((setting_key_t)i, blob.values[i]);
+    }
+    ESP_LOGI(TAG, "Loaded %u settings", stored);
+    return true;
+}
+
+static void flush_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    s_flush_timer = NULL;  // 单次定时器，执行后自动删除
+    settings_flush();
+}
+
+static void schedule_flush(void) {
+    // 连续修改只推迟同一次写入
+    if (s_flush_timer == NULL) {
+        s_flush_timer = lv_timer_create(flush_timer_cb, SETTINGS_FLUSH_MS, NULL);
+        if (s_flush_timer != NULL) {
+            lv_timer_set_repeat_count(s_flush_timer, 1);
+        }
+    } else {
+        lv_timer_reset(s_flush_timer);
+    }
+}
+
+void settings_store_init(void) {
+    if (s_loaded) {
+        return;
+    }
+    s_loaded = true;
+    for (int i = 0; i < SETTING_COUNT; i++) {
+        s_values[i] = s_desc[i].def;
+    }
+    if (load_blob()) {
+        return;
+    }
+    if (migrate_legacy()) {
+        // 此时 LVGL 还没启动，直接写入
+        ESP_LOGI(TAG, "Migrating legacy font selection");
+        s_dirty = true;
+        settings_flush();
+    }
+}
+
+int32_t settings_get_int(setting_key_t key) {
+    settings_store_init();
+    return (unsigned)key < SETTING_COUNT ? s_values[key] : 0;
+}
+
+void settings_set_int(setting_key_t key, int32_t value) {
+    if ((unsigned)key >= SETTING_COUNT) {
+        return;
+    }
+    settings_store_init();
+    value = clamp_value(key, value);
+    if (s_values[key] == value) {
+        return;
+    }
+    s_values[key] = value;
+    s_dirty = true;
+    schedule_flush();
+}
+
+bool settings_flush(void) {
+    if (s_flush_timer != NULL) {
+        lv_timer_delete(s_flush_timer);
+        s_flush_timer = NULL;
+    }
+    if (!s_dirty) {
+        return true;
+    }
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %d", err);
+        return false;
+    }
+    settings_blob_t blob = {
+        .magic = SETTINGS_MAGIC,
+        .version = SETTINGS_VERSION,
+        .count = SETTING_COUNT,
+    };
+    memcpy(blob.values, s_values, sizeof(blob.values));
+    blob.checksum = page_index_hash(0, blob.values, sizeof(blob.values));
+    err = nvs_set_blob(nvs_handle, NVS_SETTINGS_KEY, &blob, sizeof(blob));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write settings: %d", err);
+        return false;
+    }
+    s_dirty = false;
+    ESP_LOGI(TAG, "Settings saved");
+    return true;
+}
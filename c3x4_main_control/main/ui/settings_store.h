@@ -0,0 +1,73 @@
+/**
+ * @file settings_store.h
+ * @brief 设置存储 - 开机一次读入内存，按键直接取值，修改合并后定时写入 NVS
+ *
+ * 所有设置项存在 NVS 命名空间 settings 的同一个 blob 中（头部 + 按键排列的 32 位值 +
+ * 校验和），开机时 settings_store_init() 读一次，之后读取只是数组下标访问。
+ * 修改只写内存；最后一次修改 SETTINGS_FLUSH_MS 后、进入浅睡眠或关机前一次性写入。
+ * NVS 写 blob 时先写新条目再删旧条目，掉电时读到的要么是旧值要么是新值。
+ * 新设置项只能追加在 setting_key_t 末尾：旧版本 blob 缺少的项取默认值。
+ *
+ * settings_store_init() 在 nvs_flash_init() 之后、LVGL 启动前调用（没调用时第一次
+ * 读取会补上）；其余函数都在 LVGL 任务中调用
+ */
+
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SETTINGS_FLUSH_MS 5000   // 最后一次修改后多久写入 NVS
+
+// 设置项（值即 blob 中的下标，只能在末尾追加）
+typedef enum {
+    SETTING_FONT_INDEX = 0,      // 选中的字体（font_manager 的索引，负数为内置字体）
+    SETTING_TTF_SIZE,            // TrueType 字体字号
+    SETTING_READER_FONT_SIZE,    // 阅读器字体大小
+    SETTING_READER_LINE_SPACING, // 阅读器行间距
+    SETTING_READER_MARGIN,       // 阅读器页边距
+    SETTING_READER_AUTO_REFRESH, // 阅读器自动刷新（0/1）
+    SETTING_SCALED_FONT_SIZE,    // 位图字体合成字号（0 为原始字号）
+    SETTING_READER_ORIENTATION,  // 阅读方向（reader_orientation_t）
+    SETTING_COUNT
+} setting_key_t;
+
+/**
+ * @brief 从 NVS 读入全部设置（没有 blob 时迁移旧版 font_cfg 中的字体选择），只执行一次
+ */
+void settings_store_init(void);
+
+/**
+ * @brief 读取整数设置
+ */
+int32_t settings_get_int(setting_key_t key);
+
+/**
+ * @brief 修改整数设置（限制在该项的取值范围内，只写内存，延迟写入 NVS）
+ */
+void settings_set_int(setting_key_t key, int32_t value);
+
+static inline bool settings_get_bool(setting_key_t key) {
+    return settings_get_int(key) != 0;
+}
+
+static inline void settings_set_bool(setting_key_t key, bool value) {
+    settings_set_int(key, value ? 1 : 0);
+}
+
+/**
+ * @brief 立即写入未保存的修改
+ * @return true 成功或没有需要写入的内容
+ */
+bool settings_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SETTINGS_STORE_H
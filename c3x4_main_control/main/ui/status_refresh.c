@@ -0,0 +1,113 @@
+/**
+ * @file status_refresh.c
+ * @brief 状态栏定时微刷新实现
+ */
+
+#include "status_refresh.h"
+#include "screen_manager.h"
+#include "../lvgl_driver.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <time.h>
+
+static const char *TAG = "STATUS_REFRESH";
+
+// 早于此时刻（2024-01-01）视为系统时间未设置，不显示时钟
+#define STATUS_CLOCK_VALID_EPOCH 1704067200
+
+static struct {
+    lv_obj_t *region;
+    status_refresh_update_cb_t update;
+    lv_timer_t *timer;
+    long minute;                // 上次绘制时的分钟数（-1 表示没有时钟）
+    bool battery_pending;       // 电量已变化，但因面板忙还没画上
+} s_status;
+
+static long current_minute(void) {
+    const time_t now = time(NULL);
+    return now >= STATUS_CLOCK_VALID_EPOCH ? (long)(now / 60) : -1;
+}
+
+bool status_refresh_format_clock(char *buf, size_t size) {
+    if (size == 0) {
+        return false;
+    }
+    buf[0] = '\0';
+    const time_t now = time(NULL);
+    if (now < STATUS_CLOCK_VALID_EPOCH) {
+        return false;
+    }
+    struct tm tm;
+    localtime_r(&now, &tm);
+    snprintf(buf, size, "%02d:%02d", tm.tm_hour, tm.tm_min);
+    return true;
+}
+
+static void status_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (s_status.region == NULL) {
+        return;
+    }
+    if (screen_manager_update_battery()) {
+        s_status.battery_pending = true;
+    }
+    const long minute = current_minute();
+    if (!s_status.battery_pending && minute == s_status.minute) {
+        return;
+    }
+    if (lvgl_is_refreshing()) {
+        return;  // 正在上传一帧：不和它抢，下次轮询再画
+    }
+
+    s_status.update(s_status.battery_pending);
+    s_status.battery_pending = false;
+    s_status.minute = minute;
+
+    // 只有状态区域进入脏区；deadline 内的翻页请求与它合并为一次刷新
+    lv_obj_invalidate(s_status.region);
+    lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    lvgl_trigger_render(NULL);
+    const lvgl_refresh_request_t req = {
+        .mode = EPD_REFRESH_PARTIAL,
+        .deadline_ms = STATUS_REFRESH_MERGE_MS,
+        .done_sem = NULL,
+    };
+    (void)lvgl_display_refresh_request(&req);
+}
+
+static void stop_timer(void) {
+    if (s_status.timer != NULL) {
+        lv_timer_delete(s_status.timer);
+    }
+    s_status.timer = NULL;
+    s_status.region = NULL;
+    s_status.update = NULL;
+}
+
+// 区域随屏幕一起删除：事件分发中不移除回调，只停止定时器
+static void region_delete_cb(lv_event_t *e) {
+    if (lv_event_get_target(e) == s_status.region) {
+        stop_timer();
+    }
+}
+
+void status_refresh_start(lv_obj_t *region, status_refresh_update_cb_t update) {
+    status_refresh_stop();
+    if (region == NULL || update == NULL) {
+        return;
+    }
+    s_status.region = region;
+    s_status.update = update;
+    s_status.minute = current_minute();
+    s_status.battery_pending = false;
+    lv_obj_add_event_cb(region, region_delete_cb, LV_EVENT_DELETE, NULL);
+    s_status.timer = lv_timer_create(status_timer_cb, STATUS_REFRESH_POLL_MS, NULL);
+    ESP_LOGD(TAG, "Watching status region %p", (void *)region);
+}
+
+void status_refresh_stop(void) {
+    if (s_status.region != NULL) {
+        lv_obj_remove_event_cb(s_status.region, region_delete_cb);
+    }
+    stop_timer();
+}
@@ -0,0 +1,53 @@
+/**
+ * @file status_refresh.h
+ * @brief 状态栏定时微刷新 - 时钟分钟变化或电池服务发布新值时只重绘状态区域
+ *
+ * 每个屏幕至多登记一块状态区域（阅读器的状态栏、首页的电量行）。定时器每
+ * STATUS_REFRESH_POLL_MS 比较一次分钟数与电池发布序号，有变化时调用屏幕的更新
+ * 回调改写标签，只让该区域失效并渲染，提交一个局刷请求：请求带 deadline，
+ * 与稍后到来的翻页刷新合并为一次；面板正在刷新时跳过，下次轮询再补
+ */
+
+#ifndef STATUS_REFRESH_H
+#define STATUS_REFRESH_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_REFRESH_POLL_MS   2000  // 轮询周期（只比较分钟数与序号，不访问 ADC）
+#define STATUS_REFRESH_MERGE_MS  300   // 局刷请求的 deadline，期间的页面刷新与之合并
+
+/**
+ * @brief 改写状态区域中的标签（在 LVGL 任务中调用，不需要自己刷新）
+ * @param battery_changed 电池服务发布了新值，上下文中的电量已更新
+ */
+typedef void (*status_refresh_update_cb_t)(bool battery_changed);
+
+/**
+ * @brief 登记状态区域并开始轮询（替换之前登记的区域；区域删除时自动停止）
+ * @param region 只有它失效并进入局刷窗口
+ * @param update 更新回调
+ */
+void status_refresh_start(lv_obj_t *region, status_refresh_update_cb_t update);
+
+/**
+ * @brief 停止轮询（屏幕挂起或关闭时调用）
+ */
+void status_refresh_stop(void);
+
+/**
+ * @brief 格式化当前时间为 "HH:MM"
+ * @return false 系统时间尚未设置（没有对过时），buf 置为空串
+ */
+bool status_refresh_format_clock(char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STATUS_REFRESH_H
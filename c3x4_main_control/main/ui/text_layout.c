@@ -0,0 +1,540 @@
+/**
+ * @file text_layout.c
+ * @brief 阅读页面排版引擎实现
+ */
+
+#include "text_layout.h"
+#include "esp_log.h"
+#include "font_manager.h"
+#include "font_stream.h"
+#include "line_break.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "TEXT_LAYOUT";
+
+#define ADV_UNKNOWN 0xFFFF
+#define ADV_PROBES  8
+#define PREFETCH_MAX 512   // 排版前一次交给流式字体预取的码点数上限
+#define SOFT_HYPHEN  0x00AD  // 软连字符：不绘制，在它之后断行时显示为连字符
+
+// 西文单词字符：断字时单词两侧必须是其它字符
+static bool is_word_char(uint32_t c) {
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+           c == '\'' || (c >= 0xC0 && c < 0x2000);
+}
+
+static bool is_ascii_letter(uint32_t c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+// 解码一个 UTF-8 字符；返回字节数，0 表示 len 内不完整。非法字节按单字节返回
+static uint32_t utf8_decode(const uint8_t *s, uint32_t len, uint32_t *cp) {
+    const uint8_t c = s[0];
+    uint32_t n;
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+        n = 2;
+        *cp = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+        *cp = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+        *cp = c & 0x07;
+    } else {
+        *cp = c;
+        return 1;
+    }
+    if (len < n) {
+        return 0;
+    }
+    for (uint32_t i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *cp = c;
+            return 1;
+        }
+        *cp = (*cp << 6) | (s[i] & 0x3F);
+    }
+    return n;
+}
+
+static uint16_t glyph_adv_uncached(const text_layout_t *layout, uint32_t letter) {
+    // 流式字体直接取前进宽度（不把整页字形的位图读进缓存）；缺字再走回退链
+    const int stream_adv = font_stream_get_advance(font_manager_get_primary_font(layout->font), letter);
+    if (stream_adv >= 0) {
+        return (uint16_t)stream_adv;
+    }
+    uint16_t adv = lv_font_get_glyph_width(layout->font, letter, 0);
+    if (adv == 0 && letter >= 0x20) {
+        // 缺字：按半个字高占位，保证断行总能前进
+        adv = (uint16_t)(lv_font_get_line_height(layout->font) / 2);
+    }
+    return adv;
+}
+
+static uint16_t glyph_adv(text_layout_t *layout, uint32_t letter) {
+    if (letter < 128) {
+        if (layout->ascii_adv[letter] == ADV_UNKNOWN) {
+            layout->ascii_adv[letter] = glyph_adv_uncached(layout, letter);
+        }
+        return layout->ascii_adv[letter];
+    }
+
+    const uint32_t mask = TEXT_LAYOUT_ADV_CACHE - 1;
+    const uint32_t home = (letter * 2654435761u) >> 24;
+    for (uint32_t p = 0; p < ADV_PROBES; p++) {
+        text_adv_entry_t *e = &layout->adv_cache[(home + p) & mask];
+        if (e->letter == letter) {
+            return e->adv;
+        }
+        if (e->letter == 0) {
+            e->letter = letter;
+            e->adv = glyph_adv_uncached(layout, letter);
+            return e->adv;
+        }
+    }
+    // 探测链已满：覆盖起始槽
+    text_adv_entry_t *e = &layout->adv_cache[home & mask];
+    e->letter = letter;
+    e->adv = glyph_adv_uncached(layout, letter);
+    return e->adv;
+}
+
+void text_layout_init(text_layout_t *layout, const lv_font_t *font, int32_t width,
+                      int32_t height, int32_t line_space) {
+    memset(layout, 0, sizeof(*layout));
+    for (int i = 0; i < 128; i++) {
+        layout->ascii_adv[i] = ADV_UNKNOWN;
+    }
+    layout->font = font;
+    layout->width = width;
+    layout->line_pitch = lv_font_get_line_height(font) + line_space;
+    int32_t lines = (height + line_space) / layout->line_pitch;
+    if (lines < 1) {
+        lines = 1;
+    } else if (lines > TEXT_LAYOUT_MAX_LINES) {
+        lines = TEXT_LAYOUT_MAX_LINES;
+    }
+    layout->max_lines = (uint16_t)lines;
+    ESP_LOGD(TAG, "Layout %dx%d, pitch=%d, lines=%d", (int)width, (int)height,
+             (int)layout->line_pitch, (int)lines);
+}
+
+void text_layout_set_columns(text_layout_t *layout, uint8_t columns) {
+    const int32_t lines = (int32_t)layout->max_lines * (columns > 0 ? columns : 1);
+    layout->max_lines = (uint16_t)(lines > TEXT_LAYOUT_MAX_LINES ? TEXT_LAYOUT_MAX_LINES : lines);
+}
+
+// 溢出发生在 ASCII 单词中间时找行内最后一个放得下的断字点（连同连字符），返回行尾位置，
+// 没有时返回 0。单词两侧必须是非单词字符：行首的单词残段和页末被截断的单词不再断字
+static uint32_t hyphen_break(text_layout_t *layout, const uint8_t *s, uint32_t len,
+                             uint32_t word_start, uint32_t overflow, int32_t word_x) {
+    uint32_t word_end = overflow;
+    while (word_end < len && is_ascii_letter(s[word_end])) {
+        word_end++;
+    }
+    if (word_end == len || is_word_char(s[word_end]) ||
+        (word_start > 0 && is_word_char(s[word_start - 1]))) {
+        return 0;
+    }
+    uint8_t points[HYPH_MAX_WORD];
+    if (hyphenate_word((const char *)s + word_start, word_end - word_start, points) == 0) {
+        return 0;
+    }
+    const int32_t limit = layout->width - glyph_adv(layout, '-');
+    int32_t x = word_x;
+    uint32_t best = 0;
+    for (uint32_t k = 0; word_start + k < overflow; k++) {
+        x += glyph_adv(layout, s[word_start + k]);
+        if (x > limit) {
+            break;
+        }
+        if (points[k]) {
+            best = word_start + k + 1;
+        }
+    }
+    return best;
+}
+
+// 排版前把本段文字的码点交给流式字体，一次合并读取未缓存的字形（其他字体直接返回）
+static void prefetch_glyphs(const text_layout_t *layout, const uint8_t *s, uint32_t len) {
+    static uint32_t codepoints[PREFETCH_MAX];
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < len && count < PREFETCH_MAX;) {
+        uint32_t cp;
+        const uint32_t n = utf8_decode(&s[i], len - i, &cp);
+        if (n == 0) {
+            break;
+        }
+        if (cp > ' ') {
+            codepoints[count++] = cp;
+        }
+        i += n;
+    }
+    font_stream_prefetch(font_manager_get_primary_font(layout->font), codepoints, count);
+}
+
+bool text_layout_paginate(text_layout_t *layout, const char *text, uint32_t len, bool at_eof,
+                          text_page_layout_t *out) {
+    const uint8_t *s = (const uint8_t *)text;
+    uint32_t pos = 0;
+    bool last_wrapped = false;
+
+    out->line_count = 0;
+    out->consumed = 0;
+
+    // 页内偏移用 16 位保存
+    if (len > UINT16_MAX) {
+        len = UINT16_MAX;
+        at_eof = false;
+    }
+    prefetch_glyphs(layout, s, len);
+
+    while (out->line_count < layout->max_lines && pos < len) {
+        const uint32_t line_start = pos;
+        uint32_t line_end = pos;
+        uint32_t next = pos;
+        uint32_t i = pos;
+        int32_t w = 0;
+        uint32_t last_brk = pos;     // 最近的断行机会（等于行首表示还没有）
+        uint32_t word_start = pos;   // 当前 ASCII 单词的起点
+        int32_t word_x = 0;          // 行首到 word_start 的宽度
+        bool in_word = false;
+        bool hyphen = false;
+        bool complete = false;
+        line_break_state_t lb;
+        line_break_reset(&lb);
+
+        while (i < len) {
+            uint32_t cp;
+            const uint32_t n = utf8_decode(&s[i], len - i, &cp);
+            if (n == 0) {
+                break;  // 末尾不完整的多字节字符
+            }
+            if (cp == '\n') {
+                line_end = i;
+                next = i + n;
+                complete = true;
+                last_wrapped = false;
+                break;
+            }
+
+            uint16_t adv = cp == '\t' ? (uint16_t)(glyph_adv(layout, ' ') * 4) : glyph_adv(layout, cp);
+            if (cp == '\r' || cp == SOFT_HYPHEN) {
+                adv = 0;
+            }
+            const bool can_break = line_break_step(&lb, cp);
+            if (is_ascii_letter(cp) && !in_word) {
+                word_start = i;
+                word_x = w;
+            }
+            in_word = is_ascii_letter(cp);
+
+            if ((w + adv > layout->width || i + n - line_start >= TEXT_LAYOUT_LINE_MAX) &&
+                i > line_start) {
+                uint32_t brk = i;  // 没有断行机会时在这个字符前强制断开
+                if (cp != ' ' && !can_break) {
+                    const uint32_t hyph = in_word ? hyphen_break(layout, s, len, word_start, i, word_x) : 0;
+                    if (hyph > 0) {
+                        brk = hyph;  // 单词按断字点拆开，行尾补连字符
+                        hyphen = true;
+                    } else if (last_brk > line_start) {
+                        brk = last_brk;  // 退回最近的断行机会（禁则字符随之移到下一行）
+                        hyphen = brk >= 2 && s[brk - 2] == 0xC2 && s[brk - 1] == 0xAD;
+                    }
+                }
+                line_end = brk;
+                next = brk;
+                // 折行处的空格不带到下一行
+                while (next < len && s[next] == ' ') {
+                    next++;
+                }
+                complete = true;
+                last_wrapped = true;
+                break;
+            }
+
+            if (can_break) {
+                last_brk = i;
+            }
+            w += adv;
+            i += n;
+        }
+
+        if (!complete) {
+            // 输入用完：文件未结束时最后半行留给下一页（除非这一页还是空的）
+            if (!at_eof && out->line_count > 0) {
+                break;
+            }
+            line_end = i;
+            next = i;
+            last_wrapped = false;
+            if (i == line_start) {
+                break;
+            }
+        }
+
+        // 行尾的 CR 与空格不参与绘制
+        while (line_end > line_start && (s[line_end - 1] == '\r' || s[line_end - 1] == ' ')) {
+            line_end--;
+        }
+        out->lines[out->line_count].start = (uint16_t)line_start;
+        out->lines[out->line_count].len = (uint16_t)(line_end - line_start);
+        out->lines[out->line_count].hyphen = hyphen;
+        out->line_count++;
+        pos = next;
+    }
+
+    // 最后一行恰好折满时，紧随的换行属于这一段，不要让下一页以空行开头
+    if (last_wrapped && pos < len) {
+        if (s[pos] == '\r' && pos + 1 < len) {
+            pos++;
+        }
+        if (s[pos] == '\n') {
+            pos++;
+        }
+    }
+
+    out->consumed = pos;
+    return pos > 0;
+}
+
+// ============================================================================
+// text_view 控件
+// ============================================================================
+
+typedef struct {
+    const char *text;
+    const text_page_layout_t *layout;
+    uint8_t columns;
+    int32_t gap;
+    uint16_t mark_start;     // 下划线标记的字节区间（mark_len 为 0 时没有）
+    uint16_t mark_len;
+} text_view_t;
+
+// 按控件样式算出的行位置
+typedef struct {
+    lv_area_t content;
+    const lv_font_t *font;
+    int32_t font_h;
+    int32_t pitch;
+    int32_t columns;
+    int32_t col_w;
+    int32_t per_col;
+} text_view_geom_t;
+
+static void text_view_geom(lv_obj_t *obj, const text_view_t *view, text_view_geom_t *g) {
+    lv_obj_get_content_coords(obj, &g->content);
+    g->font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    g->font_h = lv_font_get_line_height(g->font);
+    const int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    g->pitch = g->font_h + line_space;
+
+    // 分栏：第 i 行在第 i / per_col 栏的第 i % per_col 行
+    g->columns = view->columns > 1 ? view->columns : 1;
+    g->col_w = (lv_area_get_width(&g->content) - view->gap * (g->columns - 1)) / g->columns;
+    g->per_col = (lv_area_get_height(&g->content) + line_space) / g->pitch;
+    if (g->columns == 1 || g->per_col < 1) {
+        g->per_col = TEXT_LAYOUT_MAX_LINES;
+    }
+}
+
+// 第 i 行的绘制区域；超出栏数或控件高度时返回 false
+static bool text_view_line_area(const text_view_geom_t *g, const text_view_t *view, uint16_t i,
+                                lv_area_t *area) {
+    const int32_t col = i / g->per_col;
+    const int32_t row = i % g->per_col;
+    if (col >= g->columns) {
+        return false;
+    }
+    area->x1 = g->columns == 1 ? g->content.x1 : g->content.x1 + col * (g->col_w + view->gap);
+    area->x2 = g->columns == 1 ? g->content.x2 : area->x1 + g->col_w - 1;
+    area->y1 = g->content.y1 + row * g->pitch;
+    area->y2 = area->y1 + g->font_h - 1;
+    return area->y1 <= g->content.y2;
+}
+
+// 一段文本的绘制宽度（不计软连字符）
+static int32_t text_view_span_width(const lv_font_t *font, const char *s, uint32_t len) {
+    int32_t w = 0;
+    uint32_t pos = 0;
+    while (pos < len) {
+        uint32_t cp;
+        uint32_t n = utf8_decode((const uint8_t *)s + pos, len - pos, &cp);
+        if (n == 0) {
+            break;
+        }
+        if (cp != SOFT_HYPHEN) {
+            w += lv_font_get_glyph_width(font, cp, 0);
+        }
+        pos += n;
+    }
+    return w;
+}
+
+// 标记在第 i 行上的下划线区域；标记与这一行不相交时返回 false
+static bool text_view_mark_area(const text_view_geom_t *g, const text_view_t *view, uint16_t i,
+                                lv_area_t *area) {
+    const text_line_t *l = &view->layout->lines[i];
+    const uint32_t start = view->mark_start > l->start ? view->mark_start : l->start;
+    const uint32_t mark_end = (uint32_t)view->mark_start + view->mark_len;
+    const uint32_t end = mark_end < (uint32_t)l->start + l->len ? mark_end : (uint32_t)l->start + l->len;
+    if (view->mark_len == 0 || start >= end || !text_view_line_area(g, view, i, area)) {
+        return false;
+    }
+    area->x1 += text_view_span_width(g->font, view->text + l->start, start - l->start);
+    area->x2 = area->x1 + text_view_span_width(g->font, view->text + start, end - start) - 1;
+    area->y1 = area->y2 + 1;
+    area->y2 = area->y1 + TEXT_VIEW_MARK_H - 1;
+    return area->x2 >= area->x1;
+}
+
+static void text_view_draw_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    const text_view_t *view = lv_event_get_user_data(e);
+    if (view->text == NULL || view->layout == NULL) {
+        return;
+    }
+
+    lv_layer_t *layer = lv_event_get_layer(e);
+    text_view_geom_t g;
+    text_view_geom(obj, view, &g);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = g.font;
+    dsc.color = lv_obj_get_style_text_color(obj, LV_PART_MAIN);
+    dsc.flag = LV_TEXT_FLAG_EXPAND;  // 行表已断好，绘制时不再折行
+    dsc.text_local = 1;              // 绘制任务延后执行，文本由 LVGL 复制
+
+    lv_draw_rect_dsc_t mark_dsc;
+    lv_draw_rect_dsc_init(&mark_dsc);
+    mark_dsc.bg_color = dsc.color;
+    mark_dsc.bg_opa = LV_OPA_COVER;
+
+    char line[TEXT_LAYOUT_LINE_MAX];
+
+    for (uint16_t i = 0; i < view->layout->line_count; i++) {
+        const text_line_t *l = &view->layout->lines[i];
+        if (l->len == 0) {
+            continue;
+        }
+        lv_area_t area;
+        if (!text_view_line_area(&g, view, i, &area)) {
+            break;
+        }
+        // 软连字符不绘制；断字的行尾补连字符
+        const char *src = view->text + l->start;
+        size_t n = 0;
+        for (uint16_t k = 0; k < l->len && n < sizeof(line) - 2; k++) {
+            if ((uint8_t)src[k] == 0xC2 && k + 1 < l->len && (uint8_t)src[k + 1] == 0xAD) {
+                k++;
+                continue;
+            }
+            line[n++] = src[k];
+        }
+        if (l->hyphen) {
+            line[n++] = '-';
+        }
+        line[n] = '\0';
+        dsc.text = line;
+        lv_draw_label(layer, &dsc, &area);
+
+        lv_area_t mark;
+        if (text_view_mark_area(&g, view, i, &mark)) {
+            lv_draw_rect(layer, &mark_dsc, &mark);
+        }
+    }
+}
+
+// 只重绘标记的下划线（换一个词时局部刷新的范围很小）
+static void text_view_invalidate_mark(lv_obj_t *obj, const text_view_t *view) {
+    if (view->mark_len == 0 || view->text == NULL || view->layout == NULL) {
+        return;
+    }
+    text_view_geom_t g;
+    text_view_geom(obj, view, &g);
+    for (uint16_t i = 0; i < view->layout->line_count; i++) {
+        lv_area_t area;
+        if (text_view_mark_area(&g, view, i, &area)) {
+            lv_obj_invalidate_area(obj, &area);
+        }
+    }
+}
+
+static void text_view_delete_cb(lv_event_t *e) {
+    free(lv_event_get_user_data(e));
+}
+
+lv_obj_t *text_view_create(lv_obj_t *parent) {
+    text_view_t *view = calloc(1, sizeof(text_view_t));
+    if (view == NULL) {
+        return NULL;
+    }
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_user_data(obj, view);
+    lv_obj_add_event_cb(obj, text_view_draw_cb, LV_EVENT_DRAW_MAIN, view);
+    lv_obj_add_event_cb(obj, text_view_delete_cb, LV_EVENT_DELETE, view);
+    return obj;
+}
+
+void text_view_set_page(lv_obj_t *obj, const char *text, const text_page_layout_t *layout) {
+    text_view_t *view = lv_obj_get_user_data(obj);
+    if (view == NULL) {
+        return;
+    }
+    view->text = text;
+    view->layout = layout;
+    view->mark_len = 0;
+    lv_obj_invalidate(obj);
+}
+
+void text_view_set_columns(lv_obj_t *obj, uint8_t columns, int32_t gap) {
+    text_view_t *view = lv_obj_get_user_data(obj);
+    if (view == NULL) {
+        return;
+    }
+    view->columns = columns;
+    view->gap = gap;
+    lv_obj_invalidate(obj);
+}
+
+void text_view_get_page(lv_obj_t *obj, const char **text, const text_page_layout_t **layout) {
+    const text_view_t *view = lv_obj_get_user_data(obj);
+    *text = view != NULL ? view->text : NULL;
+    *layout = view != NULL ? view->layout : NULL;
+}
+
+void text_view_set_mark(lv_obj_t *obj, uint32_t start, uint32_t len) {
+    text_view_t *view = lv_obj_get_user_data(obj);
+    if (view == NULL || (view->mark_start == start && view->mark_len == len)) {
+        return;
+    }
+    text_view_invalidate_mark(obj, view);
+    view->mark_start = (uint16_t)start;
+    view->mark_len = (uint16_t)len;
+    text_view_invalidate_mark(obj, view);
+}
+
+bool text_view_get_mark_area(lv_obj_t *obj, lv_area_t *area) {
+    const text_view_t *view = lv_obj_get_user_data(obj);
+    if (view == NULL || view->mark_len == 0 || view->text == NULL || view->layout == NULL) {
+        return false;
+    }
+    text_view_geom_t g;
+    text_view_geom(obj, view, &g);
+    for (uint16_t i = 0; i < view->layout->line_count; i++) {
+        if (text_view_mark_area(&g, view, i, area)) {
+            // 返回整行高度：调用者据此避开被标记的词
+            area->y2 = area->y1 - 1;
+            area->y1 = area->y2 - g.font_h + 1;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file text_layout.h
+ * @brief 阅读页面排版引擎 - 分页、CJK 禁则断行与按行绘制
+ *
+ * 分页器对一段原始文本（UTF-8）一次性计算断行，得到恰好填满一页的行表与消耗的字节数，
+ * 页边界因此是精确的文件偏移。断行机会按 UAX #14 成对表逐字判断（含 CJK 禁则），
+ * 单词放不下时按英语断字点拆开（line_break.h）。字形宽度按码点缓存，翻页时不再逐字查询字体。
+ * text_view 控件按行表绘制，不像 lv_label 那样在每次 set_text 和重绘时重新测量整页
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEXT_LAYOUT_MAX_LINES     64    // 每页最多行数
+#define TEXT_LAYOUT_LINE_MAX      256   // 每行最多字节数（超出时强制断行）
+#define TEXT_LAYOUT_ADV_CACHE     256   // 非 ASCII 字形宽度缓存槽数（2 的幂）
+#define TEXT_LAYOUT_VERSION       2
+#define TEXT_VIEW_MARK_H          2     // 标记下划线的粗细（像素）     // 断行规则版本：改变断行结果时递增，旧的分页索引随之失效
+
+// 一行：页面文本中的字节区间
+typedef struct {
+    uint16_t start;
+    uint16_t len;
+    bool hyphen;            // 行尾在单词中间断开，绘制时补连字符
+} text_line_t;
+
+// 一页的排版结果
+typedef struct {
+    text_line_t lines[TEXT_LAYOUT_MAX_LINES];
+    uint16_t line_count;
+    uint32_t consumed;      // 本页消耗的输入字节数（下一页从这里开始）
+} text_page_layout_t;
+
+typedef struct {
+    uint32_t letter;
+    uint16_t adv;
+} text_adv_entry_t;
+
+// 排版参数与字形宽度缓存（约 2 KB，字体或尺寸改变时重新初始化）
+typedef struct {
+    const lv_font_t *font;
+    int32_t width;           // 可用宽度（像素）
+    int32_t line_pitch;      // 行高 + 行距
+    uint16_t max_lines;      // 每页行数
+    uint16_t ascii_adv[128];
+    text_adv_entry_t adv_cache[TEXT_LAYOUT_ADV_CACHE];
+} text_layout_t;
+
+/**
+ * @brief 初始化排版参数并清空宽度缓存
+ * @param layout 排版上下文
+ * @param font 正文字体
+ * @param width 可用宽度
+ * @param height 可用高度
+ * @param line_space 行距
+ */
+void text_layout_init(text_layout_t *layout, const lv_font_t *font, int32_t width,
+                      int32_t height, int32_t line_space);
+
+/**
+ * @brief 一页分成若干栏：每页行数乘以栏数（width 应为单栏宽度），各栏依次填满
+ * @param layout 已初始化的排版上下文
+ * @param columns 栏数
+ */
+void text_layout_set_columns(text_layout_t *layout, uint8_t columns);
+
+/**
+ * @brief 从 text 开头排出一页
+ * @param layout 排版上下文
+ * @param text 原始文本（不必以 NUL 结尾）
+ * @param len 文本字节数
+ * @param at_eof text 之后是否已到文件末尾（否则末尾不完整的字符/行留给下一页）
+ * @param out 排版结果
+ * @return true 至少排出一个字符
+ */
+bool text_layout_paginate(text_layout_t *layout, const char *text, uint32_t len, bool at_eof,
+                          text_page_layout_t *out);
+
+/**
+ * @brief 创建按行表绘制的正文控件（字体、颜色、行距取自控件样式）
+ * @param parent 父对象
+ * @return 控件对象
+ */
+lv_obj_t *text_view_create(lv_obj_t *parent);
+
+/**
+ * @brief 设置控件显示的页面
+ *
+ * 只保存指针，text 与 layout 需保持有效直到下一次调用
+ *
+ * @param obj text_view 控件
+ * @param text 页面文本
+ * @param layout 页面排版结果
+ */
+void text_view_set_page(lv_obj_t *obj, const char *text, const text_page_layout_t *layout);
+
+/**
+ * @brief 设置分栏绘制，与 text_layout_set_columns 配合使用
+ *
+ * 每栏行数按控件内容高度计算（与 text_layout_init 相同），行表中的行依次填入各栏
+ *
+ * @param obj text_view 控件
+ * @param columns 栏数（1 为不分栏）
+ * @param gap 栏间距（像素）
+ */
+void text_view_set_columns(lv_obj_t *obj, uint8_t columns, int32_t gap);
+
+/**
+ * @brief 取控件当前显示的页面（text_view_set_page 保存的指针，未设置时为 NULL）
+ */
+void text_view_get_page(lv_obj_t *obj, const char **text, const text_page_layout_t **layout);
+
+/**
+ * @brief 在页面文本的字节区间 [start, start + len) 下画下划线（查词时标出选中的词）
+ *
+ * 只重绘新旧下划线所在的小块区域；len 为 0 时去掉标记。换页时自动去掉
+ */
+void text_view_set_mark(lv_obj_t *obj, uint32_t start, uint32_t len);
+
+/**
+ * @brief 标记第一段（所在行）的屏幕区域
+ * @return false 没有标记或标记不在可见的行上
+ */
+bool text_view_get_mark_area(lv_obj_t *obj, lv_area_t *area);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEXT_LAYOUT_H
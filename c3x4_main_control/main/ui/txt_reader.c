@@ -4,74 +4,386 @@
  */
 
 #include "txt_reader.h"
+#include "gb18030.h"
+#include "page_index.h"
+#include "position_journal.h"
+#include "../spi_arbiter.h"
+#include "file_pool.h"
+#include "reader_arena.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "nvs.h"
 #include <string.h>
 #include <ctype.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 
 static const char *TAG = "TXT_READER";
 
-// NVS 命名空间
+// NVS 命名空间（编码检测缓存；阅读进度见 position_journal）
 #define NVS_NAMESPACE "reader_pos"
-#define NVS_KEY_PREFIX "txt_"
+#define NVS_ENCODING_PREFIX "enc_"
 
-// 读取缓冲区大小
-#define READ_BUFFER_SIZE 4096
+// 读取窗口：按 READ_BLOCK_SIZE 对齐整块 fread，翻页时只补读窗口外的块
+// （容量需容纳一次 8 KB 分页读取加上首尾未对齐的部分）
+#define READ_BLOCK_SIZE  2048
+#define READ_BUFFER_SIZE TXT_READER_BUFFER_SIZE
+
+// gzip 头部（RFC 1952）：固定 10 字节，之后按标志位跟可选字段；文件名与注释须在开头这么多字节内
+#define GZIP_HEADER_MAX  512
+#define GZIP_FHCRC       0x02
+#define GZIP_FEXTRA      0x04
+#define GZIP_FNAME       0x08
+#define GZIP_FCOMMENT    0x10
+#define GZIP_FRESERVED   0xE0
+// gzip 文件只在开头这么多解压后的字节内采样检测编码，不为采样解压全文
+#define GZIP_DETECT_SPAN (64 * 1024)
+
+static size_t file_read_at(txt_reader_t *reader, long pos, uint8_t *dst, size_t len);
 
 // BOM 检测
-static bool is_utf8_bom(FILE *file) {
-    unsigned char bom[3];
-    long pos = ftell(file);
-    if (fread(bom, 1, 3, file) == 3) {
-        fseek(file, pos, SEEK_SET);
-        return (bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF);
-    }
-    fseek(file, pos, SEEK_SET);
-    return false;
+static bool is_utf8_bom(txt_reader_t *reader) {
+    uint8_t bom[3];
+    return file_read_at(reader, 0, bom, sizeof(bom)) == sizeof(bom) &&
+           bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF;
 }
 
-// 简单编码检测（启发式）
-static txt_encoding_t detect_encoding_from_content(FILE *file) {
-    unsigned char buffer[4096];
-    long pos = ftell(file);
-    size_t n = fread(buffer, 1, sizeof(buffer), file);
-    fseek(file, pos, SEEK_SET);
+// ============================================================================
+// 编码检测
+// ============================================================================
+
+// 在文件开头、中间、末尾各取一段样本
+#define DETECT_SAMPLE_SIZE  4096
+#define DETECT_SAMPLE_COUNT 3
+
+typedef struct {
+    uint32_t high_bytes;     // >= 0x80 的字节数
+    uint32_t utf8_multi;     // 合法的 UTF-8 多字节字符
+    uint32_t utf8_invalid;   // 非法的 UTF-8 序列
+    int32_t gbk_score;
+    int32_t big5_score;
+} encoding_stats_t;
+
+// 严格的 UTF-8 状态机（拒绝过长编码与代理区）；样本首尾被截断的序列不计
+static void score_utf8(const uint8_t *s, size_t n, bool first, encoding_stats_t *st) {
+    size_t i = 0;
+    if (!first) {
+        while (i < n && (s[i] & 0xC0) == 0x80) {
+            i++;
+        }
+    }
+    while (i < n) {
+        const uint8_t c = s[i];
+        size_t len;
+        uint8_t lo = 0x80;
+        uint8_t hi = 0xBF;
+        if (c < 0x80) {
+            i++;
+            continue;
+        } else if (c >= 0xC2 && c <= 0xDF) {
+            len = 2;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            len = 3;
+            lo = c == 0xE0 ? 0xA0 : 0x80;
+            hi = c == 0xED ? 0x9F : 0xBF;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            len = 4;
+            lo = c == 0xF0 ? 0x90 : 0x80;
+            hi = c == 0xF4 ? 0x8F : 0xBF;
+        } else {
+            st->utf8_invalid++;
+            i++;
+            continue;
+        }
+        if (i + len > n) {
+            break;
+        }
+        bool ok = s[i + 1] >= lo && s[i + 1] <= hi;
+        for (size_t k = 2; k < len && ok; k++) {
+            ok = (s[i + k] & 0xC0) == 0x80;
+        }
+        if (ok) {
+            st->utf8_multi++;
+            i += len;
+        } else {
+            st->utf8_invalid++;
+            i++;
+        }
+    }
+}
 
-    if (n == 0) {
-        return TXT_ENCODING_ASCII;
+// GBK：GB2312 汉字区（B0-F7/A1-FE）与全角符号区（A1-A9/A1-FE）最常见，其余合法双字节次之
+static void score_gbk(const uint8_t *s, size_t n, encoding_stats_t *st) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        const uint8_t c = s[i];
+        if (c < 0x80) {
+            continue;
+        }
+        const uint8_t t = s[i + 1];
+        if (c >= 0x81 && c <= 0xFE && t >= 0x40 && t <= 0xFE && t != 0x7F) {
+            const bool common = t >= 0xA1 && ((c >= 0xB0 && c <= 0xF7) || (c >= 0xA1 && c <= 0xA9));
+            st->gbk_score += common ? 2 : 1;
+            i++;
+        } else {
+            st->gbk_score -= 4;
+        }
     }
+}
 
-    // 检查是否为纯 ASCII
-    bool is_ascii = true;
-    bool has_gb_pattern = false;
+// Big5：常用字区（A440-C67E）与符号区（A1-A3）最常见，次常用字区次之
+static void score_big5(const uint8_t *s, size_t n, encoding_stats_t *st) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        const uint8_t c = s[i];
+        if (c < 0x80) {
+            continue;
+        }
+        const uint8_t t = s[i + 1];
+        if (c >= 0xA1 && c <= 0xF9 && ((t >= 0x40 && t <= 0x7E) || (t >= 0xA1 && t <= 0xFE))) {
+            st->big5_score += c <= 0xC6 ? 2 : 1;
+            i++;
+        } else {
+            st->big5_score -= 4;
+        }
+    }
+}
 
-    for (size_t i = 0; i < n; i++) {
-        if (buffer[i] > 0x7F) {
-            is_ascii = false;
+// 从文件开头 span 字节内的多段样本检测编码；buf 至少 DETECT_SAMPLE_SIZE 字节
+static txt_encoding_t detect_encoding_sampled(txt_reader_t *reader, long span, uint8_t *buf) {
+    encoding_stats_t st = {0};
+    long offsets[DETECT_SAMPLE_COUNT] = {0, span / 2, span - DETECT_SAMPLE_SIZE};
+    const int samples = span > DETECT_SAMPLE_SIZE * DETECT_SAMPLE_COUNT ? DETECT_SAMPLE_COUNT : 1;
 
-            // GB18030/GBK 特征：第一个字节在 0x81-0xFE 之间
-            // 且第二个字节在 0x40-0xFE 之间
-            if (buffer[i] >= 0x81 && buffer[i] <= 0xFE && i + 1 < n) {
-                unsigned char next = buffer[i + 1];
-                if (next >= 0x40 && next <= 0xFE) {
-                    has_gb_pattern = true;
-                }
-            }
+    for (int k = 0; k < samples; k++) {
+        const size_t n = file_read_at(reader, offsets[k], buf, DETECT_SAMPLE_SIZE);
+        for (size_t i = 0; i < n; i++) {
+            st.high_bytes += buf[i] >= 0x80;
         }
+        score_utf8(buf, n, k == 0, &st);
+        score_gbk(buf, n, &st);
+        score_big5(buf, n, &st);
     }
 
-    if (is_ascii) {
+    ESP_LOGD(TAG, "Encoding stats: high=%u utf8=%u/%u gbk=%d big5=%d", (unsigned)st.high_bytes,
+             (unsigned)st.utf8_multi, (unsigned)st.utf8_invalid, (int)st.gbk_score,
+             (int)st.big5_score);
+
+    if (st.high_bytes == 0) {
         return TXT_ENCODING_ASCII;
     }
+    // 合法 UTF-8 多字节序列在 GBK 文本中几乎不会连续出现；容忍少量损坏
+    if (st.utf8_multi > 0 && st.utf8_invalid * 100 <= st.utf8_multi) {
+        return TXT_ENCODING_UTF8;
+    }
+    if (st.big5_score > st.gbk_score) {
+        ESP_LOGW(TAG, "Text looks like Big5, which is not supported; decoding as GB18030");
+    }
+    return TXT_ENCODING_GB18030;
+}
+
+// 检测结果按（路径、大小、修改时间）缓存在 NVS，再次打开时不再采样
+static void encoding_cache_key(const char *file_path, long file_size, char *key, size_t key_size) {
+    struct stat st;
+    const uint32_t mtime = stat(file_path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    uint32_t hash = page_index_hash(0, file_path, strlen(file_path));
+    hash = page_index_hash(hash, &file_size, sizeof(file_size));
+    hash = page_index_hash(hash, &mtime, sizeof(mtime));
+    snprintf(key, key_size, "%s%08x", NVS_ENCODING_PREFIX, (unsigned)hash);
+}
+
+static bool encoding_cache_get(const char *key, txt_encoding_t *encoding) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    uint32_t value = 0;
+    const esp_err_t err = nvs_get_u32(nvs_handle, key, &value);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK || value >= TXT_ENCODING_AUTO) {
+        return false;
+    }
+    *encoding = (txt_encoding_t)value;
+    return true;
+}
+
+static void encoding_cache_set(const char *key, txt_encoding_t encoding) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    if (nvs_set_u32(nvs_handle, key, (uint32_t)encoding) == ESP_OK) {
+        nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+}
+
+static const char *encoding_name(txt_encoding_t encoding) {
+    static const char *names[] = {"UTF-8", "GB18030", "ASCII", "AUTO"};
+    return encoding <= TXT_ENCODING_AUTO ? names[encoding] : "?";
+}
+
+// ============================================================================
+// 读取窗口
+// ============================================================================
+
+static long window_end(const txt_reader_t *reader) {
+    return reader->window_start + (long)reader->window_len;
+}
+
+// 从文件读取 [pos, pos + len) 到 dst，返回实际读到的字节数（预读过的块由 sd_io 直接复制；
+// gzip 文件的 pos 是解压后的偏移，由解压流从最近的检查点解压过去）
+static size_t file_read_at(txt_reader_t *reader, long pos, uint8_t *dst, size_t len) {
+    if (reader->gz != NULL) {
+        if (len == 0 || !epub_zip_stream_seek(reader->gz, (uint32_t)pos)) {
+            return 0;
+        }
+        const int n = epub_zip_stream_read(reader->gz, dst, len);
+        return n > 0 ? (size_t)n : 0;
+    }
+    if (reader->io != NULL) {
+        return len == 0 ? 0 : sd_io_read(reader->io, (uint32_t)pos, dst, len);
+    }
+    if (len == 0 || fseek(reader->file, pos, SEEK_SET) != 0) {
+        return 0;
+    }
+    spi_arbiter_sd_begin();
+    const size_t n = fread(dst, 1, len, reader->file);
+    spi_arbiter_sd_end();
+    return n;
+}
+
+// 保证窗口覆盖 [pos, pos + len)（受容量与文件大小限制）；
+// 与原窗口重叠的部分前后滑动复用，只读取缺少的块
+static bool window_ensure(txt_reader_t *reader, long pos, size_t len) {
+    const long file_size = reader->position.file_size;
+    if (pos < 0 || pos >= file_size) {
+        return false;
+    }
+
+    long lo = pos - pos % READ_BLOCK_SIZE;
+    long hi = pos + (long)len;
+    hi = hi > file_size ? file_size : hi;
+    hi = ((hi + READ_BLOCK_SIZE - 1) / READ_BLOCK_SIZE) * READ_BLOCK_SIZE;
+    if (hi - lo > (long)reader->buffer_size) {
+        hi = lo + (long)reader->buffer_size;
+    }
+    if (hi > file_size) {
+        hi = file_size;
+    }
 
-    // 如果有 GB 模式，优先认为是 GB18030
-    if (has_gb_pattern) {
-        return TXT_ENCODING_GB18030;
+    const long old_lo = reader->window_start;
+    const long old_hi = window_end(reader);
+    if (reader->window_len > 0 && lo >= old_lo && hi <= old_hi) {
+        return true;
     }
 
-    // 默认假设为 UTF-8
-    return TXT_ENCODING_UTF8;
+    uint8_t *buf = reader->buffer;
+    size_t got;
+    if (reader->window_len > 0 && lo >= old_lo && lo < old_hi) {
+        // 向后滑动：保留 [lo, old_hi)，补读尾部
+        const size_t keep = (size_t)(old_hi - lo);
+        memmove(buf, buf + (lo - old_lo), keep);
+        got = keep + file_read_at(reader, old_hi, buf + keep, (size_t)(hi - old_hi));
+    } else if (reader->window_len > 0 && hi > old_lo && hi <= old_hi) {
+        // 向前滑动（后退翻页）：保留 [old_lo, hi)，补读头部
+        const size_t head = (size_t)(old_lo - lo);
+        memmove(buf + head, buf, (size_t)(hi - old_lo));
+        got = file_read_at(reader, lo, buf, head);
+        got = got == head ? (size_t)(hi - lo) : got;
+    } else {
+        got = file_read_at(reader, lo, buf, (size_t)(hi - lo));
+    }
+
+    reader->window_start = lo;
+    reader->window_len = got;
+    if (got == 0 || pos >= window_end(reader)) {
+        ESP_LOGE(TAG, "Read failed at %ld", pos);
+        reader->window_len = 0;
+        return false;
+    }
+    return true;
+}
+
+// 复制 [pos, pos + len) 到 dst，返回复制的字节数（到文件末尾为止）
+static size_t window_copy(txt_reader_t *reader, long pos, uint8_t *dst, size_t len) {
+    size_t done = 0;
+    while (done < len && window_ensure(reader, pos, len - done)) {
+        size_t n = (size_t)(window_end(reader) - pos);
+        n = n < len - done ? n : len - done;
+        memcpy(dst + done, reader->buffer + (pos - reader->window_start), n);
+        done += n;
+        pos += (long)n;
+    }
+    return done;
+}
+
+// 读取 pos 处的字节；文件末尾返回 EOF
+static int window_byte(txt_reader_t *reader, long pos) {
+    if (pos < reader->window_start || pos >= window_end(reader)) {
+        if (!window_ensure(reader, pos, reader->buffer_size)) {
+            return EOF;
+        }
+    }
+    return reader->buffer[pos - reader->window_start];
+}
+
+// pos 处字符的字节数（按编码判断首字节，不完整的字符按实际剩余长度）
+static int char_length_at(txt_reader_t *reader, long pos) {
+    const int c = window_byte(reader, pos);
+    int n = 1;
+    if (c == EOF) {
+        return 0;
+    }
+    if (reader->encoding == TXT_ENCODING_GB18030) {
+        if (c >= 0x81 && c <= 0xFE) {
+            const int c2 = window_byte(reader, pos + 1);
+            n = (c2 >= 0x30 && c2 <= 0x39) ? 4 : 2;  // GB18030 四字节序列第二字节为数字
+        }
+    } else if ((c & 0xE0) == 0xC0) {
+        n = 2;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+    }
+    if (pos + n > reader->position.file_size) {
+        n = (int)(reader->position.file_size - pos);
+    }
+    return n;
+}
+
+// 输出文件 [pos, end) 的文本（GB18030 转为 UTF-8，其余原样），只输出完整字符；
+// 返回写入 dst 的字节数，*src_end 为实际读到的文件位置
+static size_t window_text(txt_reader_t *reader, long pos, long end, char *dst, size_t dst_size,
+                          long *src_end) {
+    size_t out = 0;
+
+    if (reader->encoding != TXT_ENCODING_GB18030) {
+        const size_t want = (size_t)(end - pos) < dst_size ? (size_t)(end - pos) : dst_size;
+        out = window_copy(reader, pos, (uint8_t *)dst, want);
+        pos += (long)out;
+    } else {
+        // 输出字节数不少于消耗的 GB18030 字节数，按剩余输出空间补读窗口即可
+        while (pos < end && out < dst_size && window_ensure(reader, pos, dst_size - out + 4)) {
+            const long avail_end = window_end(reader) < end ? window_end(reader) : end;
+            size_t used;
+            out += gb18030_to_utf8(reader->buffer + (pos - reader->window_start),
+                                   (size_t)(avail_end - pos), avail_end >= end, dst + out,
+                                   dst_size - out, &used);
+            if (used == 0) {
+                break;
+            }
+            pos += (long)used;
+        }
+    }
+
+    if (src_end != NULL) {
+        *src_end = pos;
+    }
+    return out;
+}
+
+static size_t utf8_length(uint32_t cp) {
+    return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
 }
 
 bool txt_reader_init(txt_reader_t *reader) {
@@ -83,7 +395,7 @@ bool txt_reader_init(txt_reader_t *reader) {
     memset(reader, 0, sizeof(txt_reader_t));
     reader->buffer_size = READ_BUFFER_SIZE;
 
-    reader->buffer = malloc(READ_BUFFER_SIZE);
+    reader->buffer = reader_arena_alloc(READ_BUFFER_SIZE);
     if (reader->buffer == NULL) {
         ESP_LOGE(TAG, "Failed to allocate read buffer");
         return false;
@@ -93,6 +405,55 @@ bool txt_reader_init(txt_reader_t *reader) {
     return true;
 }
 
+// gzip 压缩的 TXT：解析头部找到 deflate 数据，末尾的 ISIZE 即正文长度（只读第一个成员）。
+// 不是 gzip 时返回 true 且 reader->gz 保持 NULL；是 gzip 但打不开时返回 false
+static bool gzip_open(txt_reader_t *reader, long file_size) {
+    uint8_t *hdr = reader->buffer;
+    const size_t want = file_size < GZIP_HEADER_MAX ? (size_t)file_size : GZIP_HEADER_MAX;
+    const size_t n = file_read_at(reader, 0, hdr, want);
+    if (n < 10 || hdr[0] != 0x1F || hdr[1] != 0x8B || hdr[2] != 8) {
+        return true;
+    }
+    const uint8_t flags = hdr[3];
+    if (flags & GZIP_FRESERVED) {
+        ESP_LOGE(TAG, "Unsupported gzip flags 0x%02x", flags);
+        return false;
+    }
+
+    size_t pos = 10;
+    if (flags & GZIP_FEXTRA) {
+        pos += 2 + (pos + 2 <= n ? (hdr[pos] | (hdr[pos + 1] << 8)) : 0);
+    }
+    for (uint8_t f = GZIP_FNAME; f <= GZIP_FCOMMENT; f <<= 1) {
+        if (flags & f) {
+            while (pos < n && hdr[pos] != 0) {
+                pos++;
+            }
+            pos++;
+        }
+    }
+    if (flags & GZIP_FHCRC) {
+        pos += 2;
+    }
+
+    uint8_t trailer[4];
+    if (pos > n || (long)pos + 8 > file_size ||
+        file_read_at(reader, file_size - 4, trailer, sizeof(trailer)) != sizeof(trailer)) {
+        ESP_LOGE(TAG, "Truncated gzip header in %s", reader->file_path);
+        return false;
+    }
+    const uint32_t isize = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) |
+                           ((uint32_t)trailer[3] << 24);
+    reader->gz = epub_zip_stream_open_deflate(reader->file, reader->file_path, (uint32_t)pos,
+                                              (uint32_t)(file_size - (long)pos - 8), isize);
+    if (reader->gz == NULL) {
+        return false;
+    }
+    reader->position.file_size = (long)isize;
+    ESP_LOGI(TAG, "gzip: %ld compressed bytes, %u bytes of text", file_size, (unsigned)isize);
+    return true;
+}
+
 bool txt_reader_open(txt_reader_t *reader, const char *file_path, txt_encoding_t encoding) {
     if (reader == NULL || file_path == NULL) {
         ESP_LOGE(TAG, "Invalid parameters");
@@ -106,31 +467,55 @@ bool txt_reader_open(txt_reader_t *reader, const char *file_path, txt_encoding_t
     strncpy(reader->file_path, file_path, sizeof(reader->file_path) - 1);
     reader->file_path[sizeof(reader->file_path) - 1] = '\0';
 
-    reader->file = fopen(file_path, "r");
+    reader->file = file_pool_fopen(file_path);
     if (reader->file == NULL) {
         ESP_LOGE(TAG, "Failed to open file: %s", file_path);
         return false;
     }
-
-    // 检测编码
-    if (encoding == TXT_ENCODING_AUTO) {
-        reader->encoding = txt_reader_detect_encoding(file_path);
-    } else {
-        reader->encoding = encoding;
-    }
+    // 读取窗口已按块缓存，不再经过 stdio 缓冲
+    setvbuf(reader->file, NULL, _IONBF, 0);
+    reader->window_start = 0;
+    reader->window_len = 0;
+    reader->prefetch_end = 0;
 
     // 获取文件大小
     fseek(reader->file, 0, SEEK_END);
     reader->position.file_size = ftell(reader->file);
     fseek(reader->file, 0, SEEK_SET);
 
-    // 跳过 UTF-8 BOM
-    if (reader->encoding == TXT_ENCODING_UTF8 && is_utf8_bom(reader->file)) {
-        fseek(reader->file, 3, SEEK_SET);
+    // gzip 压缩的文件之后的文件位置都是解压后的偏移；块缓存与预读只对未压缩的文件有意义
+    if (!gzip_open(reader, reader->position.file_size)) {
+        txt_reader_close(reader);
+        return false;
+    }
+    reader->io = reader->gz == NULL ? sd_io_open(file_path) : NULL;
+
+    // 检测编码：优先用缓存的结果，否则在已打开的文件上采样（借用读取窗口作缓冲区）
+    if (encoding == TXT_ENCODING_AUTO) {
+        char key[16];
+        encoding_cache_key(file_path, reader->position.file_size, key, sizeof(key));
+        if (!encoding_cache_get(key, &reader->encoding)) {
+            const long span = reader->gz != NULL && reader->position.file_size > GZIP_DETECT_SPAN
+                                  ? GZIP_DETECT_SPAN
+                                  : reader->position.file_size;
+            reader->encoding = is_utf8_bom(reader)
+                                   ? TXT_ENCODING_UTF8
+                                   : detect_encoding_sampled(reader, span, reader->buffer);
+            encoding_cache_set(key, reader->encoding);
+            ESP_LOGI(TAG, "Detected encoding: %s for %s", encoding_name(reader->encoding), file_path);
+        }
+    } else {
+        reader->encoding = encoding;
+    }
+
+    // 跳过 UTF-8 BOM（file_position 始终是真实的文件偏移）
+    reader->content_start = 0;
+    if (reader->encoding == TXT_ENCODING_UTF8 && is_utf8_bom(reader)) {
+        reader->content_start = 3;
     }
 
     reader->is_open = true;
-    reader->position.file_position = 0;
+    reader->position.file_position = reader->content_start;
     reader->position.page_number = 0;
 
     ESP_LOGI(TAG, "Opened TXT file: %s (encoding=%d, size=%ld bytes)",
@@ -144,10 +529,14 @@ void txt_reader_close(txt_reader_t *reader) {
         return;
     }
 
+    epub_zip_stream_close(reader->gz);
+    reader->gz = NULL;
     if (reader->file != NULL) {
         fclose(reader->file);
         reader->file = NULL;
     }
+    sd_io_close(reader->io);
+    reader->io = NULL;
 
     reader->is_open = false;
     ESP_LOGI(TAG, "TXT reader closed");
@@ -167,57 +556,74 @@ int txt_reader_read_page(txt_reader_t *reader, char *text_buffer, size_t buffer_
     size_t bytes_read = 0;
     int chars_read = 0;
     bool in_newline = false;
+    long pos = reader->position.file_position;
 
     text_buffer[0] = '\0';
 
     while (chars_read < chars_per_page && bytes_read < buffer_size - 1) {
-        int c = fgetc(reader->file);
+        const int c = window_byte(reader, pos);
 
         if (c == EOF) {
             break;
         }
 
-        reader->position.file_position++;
-
         // 处理换行符
         if (c == '\r') {
+            pos++;
             continue; // 跳过 CR
         }
 
         if (c == '\n') {
             text_buffer[bytes_read++] = '\n';
-            text_buffer[bytes_read] = '\0';
             chars_read++;
             in_newline = true;
+            pos++;
             continue;
         }
 
         // 如果换行后第一个字符是空白符，可能是段落缩进
         if (in_newline && isspace(c)) {
-            // 保留一个空格作为缩进
+            // 保留一个空格作为缩进，跳过后续空白符
             text_buffer[bytes_read++] = ' ';
-            bytes_read = (bytes_read < buffer_size) ? bytes_read : buffer_size - 1;
-            text_buffer[bytes_read] = '\0';
             chars_read++;
             in_newline = false;
-
-            // 跳过后续空白符
-            while (isspace(c = fgetc(reader->file)) && c != '\n' && c != '\r') {
-                reader->position.file_position++;
+            pos++;
+            int next;
+            while ((next = window_byte(reader, pos)) != EOF && isspace(next) &&
+                   next != '\n' && next != '\r') {
+                pos++;
             }
-            ungetc(c, reader->file);
-            reader->position.file_position--;
             continue;
         }
 
+        // 多字节字符整体输出（GB18030 转为 UTF-8），放不下时留到下一页，页尾不会截断半个字符
+        const size_t room = buffer_size - 1 - bytes_read;
+        const long next = pos + char_length_at(reader, pos);
+        long done = pos;
+        if (reader->encoding == TXT_ENCODING_GB18030 || (size_t)(next - pos) <= room) {
+            bytes_read += window_text(reader, pos, next, &text_buffer[bytes_read], room, &done);
+        }
+        if (done == pos) {
+            break;
+        }
+        pos = done;
         in_newline = false;
-        text_buffer[bytes_read++] = (char)c;
-        text_buffer[bytes_read] = '\0';
         chars_read++;
     }
 
+    text_buffer[bytes_read] = '\0';
+    reader->position.file_position = pos;
     reader->position.page_number++;
 
+    // 窗口之后的两块交给后台预读进块缓存，下次补读窗口时不用等 SD 卡
+    const long ahead = window_end(reader);
+    if (reader->io != NULL && ahead > reader->prefetch_end && ahead < reader->position.file_size) {
+        if (sd_io_read_async(reader->io, (uint32_t)ahead, 2 * READ_BLOCK_SIZE, NULL, SD_IO_PRIO_LOW,
+                             NULL, NULL)) {
+            reader->prefetch_end = ahead;
+        }
+    }
+
     ESP_LOGD(TAG, "Read page %d: %d chars, pos=%ld",
              reader->position.page_number, chars_read, reader->position.file_position);
 
@@ -234,15 +640,10 @@ bool txt_reader_goto_page(txt_reader_t *reader, int page_number) {
         page_number = 1;
     }
 
-    // 如果目标页在当前页之前，回到文件开头
+    // 如果目标页在当前页之前，回到正文开头
     if (page_number < reader->position.page_number) {
-        fseek(reader->file, 0, SEEK_SET);
+        reader->position.file_position = reader->content_start;
         reader->position.page_number = 0;
-
-        // 跳过 UTF-8 BOM
-        if (reader->encoding == TXT_ENCODING_UTF8 && is_utf8_bom(reader->file)) {
-            fseek(reader->file, 3, SEEK_SET);
-        }
     }
 
     // 逐页读取直到目标页
@@ -269,15 +670,109 @@ bool txt_reader_seek(txt_reader_t *reader, long position) {
         position = reader->position.file_size;
     }
 
-    int result = fseek(reader->file, position, SEEK_SET);
-    if (result == 0) {
-        reader->position.file_position = position;
-        ESP_LOGI(TAG, "Seeked to position %ld", position);
-        return true;
+    // 位置是逻辑偏移，读取时由窗口按需定位
+    reader->position.file_position = position;
+    ESP_LOGI(TAG, "Seeked to position %ld", position);
+    return true;
+}
+
+int txt_reader_peek(txt_reader_t *reader, char *buffer, size_t buffer_size, bool *at_eof) {
+    if (reader == NULL || !reader->is_open || buffer == NULL || buffer_size < 2) {
+        return -1;
     }
 
-    ESP_LOGE(TAG, "Seek failed to position %ld", position);
-    return false;
+    long src_end;
+    const size_t n = window_text(reader, reader->position.file_position, reader->position.file_size,
+                                 buffer, buffer_size - 1, &src_end);
+    buffer[n] = '\0';
+    if (at_eof != NULL) {
+        *at_eof = src_end >= reader->position.file_size;
+    }
+    return (int)n;
+}
+
+long txt_reader_offset_after(txt_reader_t *reader, long start, size_t text_bytes) {
+    if (reader == NULL || !reader->is_open) {
+        return -1;
+    }
+    if (reader->encoding != TXT_ENCODING_GB18030) {
+        return start + (long)text_bytes;
+    }
+
+    // 按与 window_text 相同的规则逐字解码，累计 UTF-8 长度
+    long pos = start;
+    size_t out = 0;
+    while (out < text_bytes && window_ensure(reader, pos, text_bytes - out + 4)) {
+        const uint8_t *s = reader->buffer + (pos - reader->window_start);
+        const size_t avail = (size_t)(window_end(reader) - pos);
+        uint32_t cp;
+        int n = gb18030_decode(s, avail, &cp);
+        if (n == 0) {
+            if (window_end(reader) < reader->position.file_size) {
+                break;
+            }
+            n = (int)avail;  // 文件末尾不完整的字符（输出为 U+FFFD）
+            cp = 0xFFFD;
+        }
+        out += utf8_length(cp);
+        pos += n;
+    }
+    return pos;
+}
+
+int txt_reader_peek_before(txt_reader_t *reader, long end, char *buffer, size_t buffer_size,
+                           long *start) {
+    if (reader == NULL || !reader->is_open || buffer == NULL || buffer_size < 2 ||
+        end > reader->position.file_size) {
+        return -1;
+    }
+
+    // GB18030 转为 UTF-8 后最多膨胀 1.5 倍，按输出空间倒推读取的范围
+    const size_t span = reader->encoding == TXT_ENCODING_GB18030 ? (buffer_size - 1) * 2 / 3
+                                                                 : buffer_size - 1;
+    long from = end - (long)span;
+    if (from <= reader->content_start) {
+        from = reader->content_start;
+    }
+    if (from < end) {
+        window_ensure(reader, from, (size_t)(end - from));  // 一次补读，后面的逐字节判断都在窗口内
+    }
+    if (from == reader->content_start) {
+        // 正文开头就是字符边界
+    } else if (reader->encoding == TXT_ENCODING_GB18030) {
+        // GB18030 的尾字节与首字节范围重叠，无法从中间判断字符边界：从下一行开头开始
+        long p = from;
+        int c;
+        while (p < end && (c = window_byte(reader, p)) != EOF && c != '\n') {
+            p++;
+        }
+        if (p < end) {
+            from = p + 1;
+        }
+    } else {
+        // UTF-8：跳过续字节
+        while (from < end && (window_byte(reader, from) & 0xC0) == 0x80) {
+            from++;
+        }
+    }
+
+    const size_t n = from < end ? window_text(reader, from, end, buffer, buffer_size - 1, NULL) : 0;
+    buffer[n] = '\0';
+    if (start != NULL) {
+        *start = from;
+    }
+    return (int)n;
+}
+
+bool txt_reader_set_position(txt_reader_t *reader, long position, int page_number) {
+    if (reader == NULL || !reader->is_open || position < 0 ||
+        position > reader->position.file_size) {
+        return false;
+    }
+
+    reader->position.file_position = position;
+    reader->position.page_number = page_number;
+    return true;
 }
 
 txt_position_t txt_reader_get_position(const txt_reader_t *reader) {
@@ -308,42 +803,12 @@ bool txt_reader_save_position(const txt_reader_t *reader) {
         return false;
     }
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS: %d", err);
-        return false;
-    }
-
-    // 使用文件名（不含路径）作为 key，避免键过长
-    const char *filename = strrchr(reader->file_path, '/');
-    if (filename == NULL) {
-        filename = reader->file_path;
-    } else {
-        filename++;  // 跳过 '/'
-    }
-
-    char key[64];
-    int key_len = snprintf(key, sizeof(key), "%s%.50s", NVS_KEY_PREFIX, filename);
-    if (key_len >= (int)sizeof(key)) {
-        key[sizeof(key) - 1] = '\0';
-    }
-
-    // 保存位置
-    err = nvs_set_i32(nvs_handle, key, reader->position.file_position);
-    if (err == ESP_OK) {
-        err = nvs_commit(nvs_handle);
-    }
-
-    nvs_close(nvs_handle);
-
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Saved position for %s: %ld", filename, reader->position.file_position);
-        return true;
-    }
-
-    ESP_LOGE(TAG, "Failed to save position: %d", err);
-    return false;
+    // 只记入进度日志（内存），由日志合并后写入 NVS
+    position_journal_put(position_journal_key(reader->file_path),
+                         (int32_t)reader->position.file_position, reader->position.page_number);
+    ESP_LOGD(TAG, "Saved position: %ld (page %d)", reader->position.file_position,
+             reader->position.page_number);
+    return true;
 }
 
 bool txt_reader_load_position(txt_reader_t *reader) {
@@ -351,38 +816,21 @@ bool txt_reader_load_position(txt_reader_t *reader) {
         return false;
     }
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "No saved position found (NVS open failed: %d)", err);
-        return false;
-    }
-
-    // 使用文件名（不含路径）作为 key，与 save_position 保持一致
+    // 日志中没有时迁移旧版本的 "txt_<文件名>" 键（只有位置，没有页码；超过键长的当初没能写入）
+    const uint32_t key = position_journal_key(reader->file_path);
     const char *filename = strrchr(reader->file_path, '/');
-    if (filename == NULL) {
-        filename = reader->file_path;
-    } else {
-        filename++;  // 跳过 '/'
-    }
-
-    char key[64];
-    int key_len = snprintf(key, sizeof(key), "%s%.50s", NVS_KEY_PREFIX, filename);
-    if (key_len >= (int)sizeof(key)) {
-        key[sizeof(key) - 1] = '\0';
-    }
-
+    char legacy[24];
+    snprintf(legacy, sizeof(legacy), "txt_%.19s", filename != NULL ? filename + 1 : reader->file_path);
     int32_t saved_pos = 0;
-    err = nvs_get_i32(nvs_handle, key, &saved_pos);
-    nvs_close(nvs_handle);
-
-    if (err == ESP_OK && saved_pos > 0) {
-        txt_reader_seek(reader, saved_pos);
-        ESP_LOGI(TAG, "Loaded position for %s: %ld", filename, saved_pos);
+    int32_t saved_page = 0;
+    if ((position_journal_get(key, &saved_pos, &saved_page) ||
+         position_journal_migrate(key, legacy, NULL, &saved_pos, &saved_page)) &&
+        saved_pos > 0 && txt_reader_set_position(reader, saved_pos, saved_page >= 0 ? saved_page : 0)) {
+        ESP_LOGI(TAG, "Loaded position: %d (page %d)", (int)saved_pos, (int)saved_page);
         return true;
     }
 
-    ESP_LOGW(TAG, "No saved position found for %s", filename);
+    ESP_LOGW(TAG, "No saved position found for %s", reader->file_path);
     return false;
 }
 
@@ -393,19 +841,26 @@ txt_encoding_t txt_reader_detect_encoding(const char *file_path) {
         return TXT_ENCODING_UTF8;
     }
 
-    // 检查 BOM
-    if (is_utf8_bom(file)) {
+    // 检查 BOM（只经过 fread，不打开块缓存）
+    txt_reader_t probe = {.file = file};
+    if (is_utf8_bom(&probe)) {
         fclose(file);
         ESP_LOGI(TAG, "Detected UTF-8 with BOM: %s", file_path);
         return TXT_ENCODING_UTF8;
     }
 
     // 从内容检测
-    txt_encoding_t encoding = detect_encoding_from_content(file);
+    txt_encoding_t encoding = TXT_ENCODING_UTF8;
+    uint8_t *sample = malloc(DETECT_SAMPLE_SIZE);
+    if (sample != NULL) {
+        fseek(file, 0, SEEK_END);
+        const long file_size = ftell(file);
+        encoding = detect_encoding_sampled(&probe, file_size, sample);
+        free(sample);
+    }
     fclose(file);
 
-    const char *encoding_str[] = {"UTF-8", "GB18030", "ASCII", "AUTO"};
-    ESP_LOGI(TAG, "Detected encoding: %s for %s", encoding_str[encoding], file_path);
+    ESP_LOGI(TAG, "Detected encoding: %s for %s", encoding_name(encoding), file_path);
 
     return encoding;
 }
@@ -418,7 +873,7 @@ void txt_reader_cleanup(txt_reader_t *reader) {
     txt_reader_close(reader);
 
     if (reader->buffer != NULL) {
-        free(reader->buffer);
+        reader_arena_free(reader->buffer);
         reader->buffer = NULL;
     }
 
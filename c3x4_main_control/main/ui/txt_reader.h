@@ -9,11 +9,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include "sd_io.h"
+#include "epub_zip.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// 读取窗口容量（6 个 2 KB 块），阅读会话 arena 按它预留
+#define TXT_READER_BUFFER_SIZE (6 * 2048)
+
 // TXT 文件编码类型
 typedef enum {
     TXT_ENCODING_UTF8,      // UTF-8 编码
@@ -36,9 +41,15 @@ typedef struct {
     char file_path[256];     // 文件路径
     txt_encoding_t encoding; // 文件编码
     txt_position_t position; // 当前位置
+    long content_start;      // 正文起始位置（跳过 BOM 后）
     bool is_open;            // 是否已打开
-    uint8_t *buffer;         // 读取缓冲区
-    size_t buffer_size;      // 缓冲区大小
+    uint8_t *buffer;         // 读取窗口（按块对齐缓存文件的一段）
+    size_t buffer_size;      // 窗口容量
+    long window_start;       // 窗口对应的文件偏移（块对齐）
+    size_t window_len;       // 窗口中的有效字节数
+    sd_io_file_t *io;        // 窗口读取经过的 SD 读取服务（打开失败时为 NULL，直接 fread）
+    long prefetch_end;       // 已提交预读的位置，避免每页重复提交
+    epub_zip_stream_t *gz;   // gzip 压缩的文件经过的解压流（未压缩时为 NULL）
 } txt_reader_t;
 
 /**
@@ -50,6 +61,10 @@ bool txt_reader_init(txt_reader_t *reader);
 
 /**
  * @brief 打开 TXT 文件
+ *
+ * gzip 压缩的文件（.txt.gz）透明解压：文件位置与大小都按解压后的正文计，
+ * 解压检查点保存在 /sdcard/.x4cache，跳转最多从一个检查点间隔之前开始解压
+ *
  * @param reader 阅读器实例指针
  * @param file_path 文件路径
  * @param encoding 文件编码（TXT_ENCODING_AUTO 自动检测）
@@ -89,6 +104,54 @@ bool txt_reader_goto_page(txt_reader_t *reader, int page_number);
  */
 bool txt_reader_seek(txt_reader_t *reader, long position);
 
+/**
+ * @brief 从当前位置读取文本，读取后位置不变（供排版引擎分页）
+ *
+ * 输出始终是 UTF-8：GB18030 文件在读取窗口上流式转码
+ * @param reader 阅读器实例指针
+ * @param buffer 输出缓冲区（以 NUL 结尾）
+ * @param buffer_size 缓冲区大小（字节）
+ * @param at_eof 输出：读到的内容是否一直到文件末尾（可为 NULL）
+ * @return 读取的字节数，-1 表示失败
+ */
+int txt_reader_peek(txt_reader_t *reader, char *buffer, size_t buffer_size, bool *at_eof);
+
+/**
+ * @brief 把 peek 输出中的字节数换算为文件偏移
+ *
+ * GB18030 文件的 peek 输出已转为 UTF-8，与文件字节数不一一对应；其他编码直接相加
+ *
+ * @param reader 阅读器实例指针
+ * @param start peek 时的文件位置
+ * @param text_bytes 从 peek 输出开头计的字节数（须落在字符边界）
+ * @return 对应的文件位置，-1 表示失败
+ */
+long txt_reader_offset_after(txt_reader_t *reader, long start, size_t text_bytes);
+
+/**
+ * @brief 读取 end 之前的文本（供后退翻页），位置不变
+ *
+ * 起点对齐到字符边界（GB18030 对齐到行首），不会从多字节字符中间开始
+ *
+ * @param reader 阅读器实例指针
+ * @param end 结束位置（不含）
+ * @param buffer 输出缓冲区（以 NUL 结尾）
+ * @param buffer_size 缓冲区大小（字节）
+ * @param start 输出：读到的内容在文件中的起点（可为 NULL）
+ * @return 读取的字节数，-1 表示失败
+ */
+int txt_reader_peek_before(txt_reader_t *reader, long end, char *buffer, size_t buffer_size,
+                           long *start);
+
+/**
+ * @brief 直接恢复到已知的页首位置（页码一并设置，不逐页重读）
+ * @param reader 阅读器实例指针
+ * @param position 页首文件位置（之前由 txt_reader_get_position 得到）
+ * @param page_number 该位置之前已读完的页数（读取下一页后即为该页页码）
+ * @return true 成功，false 失败
+ */
+bool txt_reader_set_position(txt_reader_t *reader, long position, int page_number);
+
 /**
  * @brief 获取当前阅读位置
  * @param reader 阅读器实例指针
@@ -0,0 +1,652 @@
+/**
+ * @file txt_toc.c
+ * @brief TXT 章节目录实现
+ */
+
+#include "txt_toc.h"
+#include "page_index.h"
+#include "gb18030.h"
+#include "bg_jobs.h"
+#include "heap_stats.h"
+#include "esp_log.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "TXT_TOC";
+
+#define TOC_MAGIC       0x31434F54u  // "TOC1"
+#define TOC_READ_CHUNK  4096         // 每步读取的正文
+#define TOC_NUMERAL_MAX 10           // “第”与单位之间最多的数字个数
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;        // 写完全部记录后才写入，中断的文件不会被当成完整目录
+    uint32_t key;          // 书籍指纹（路径、大小、修改时间）
+    uint32_t file_size;
+    uint32_t count;
+    uint8_t encoding;
+    uint8_t volumes;       // 是否有卷、部、篇
+    uint8_t record_size;
+    uint8_t reserved;
+} toc_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t offset;
+    uint8_t level;
+    uint8_t reserved;
+    char title[TXT_TOC_TITLE_SIZE];
+} toc_record_t;
+
+_Static_assert(sizeof(toc_record_t) == 64, "TOC record must stay 64 bytes");
+
+// ---------------------------------------------------------------------------
+// 字符解码与标题识别
+// ---------------------------------------------------------------------------
+
+static int utf8_decode(const uint8_t *s, size_t len, uint32_t *cp) {
+    if (len == 0) {
+        return 0;
+    }
+    const uint8_t c = s[0];
+    int n;
+    uint32_t v;
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+        n = 2;
+        v = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+        n = 3;
+        v = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+        n = 4;
+        v = c & 0x07;
+    } else {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    if (len < (size_t)n) {
+        return 0;
+    }
+    for (int i = 1; i < n; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        v = (v << 6) | (s[i] & 0x3F);
+    }
+    *cp = v;
+    return n;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+// 返回消耗的字节数；0 表示 len 内字符不完整
+static int decode_char(txt_encoding_t encoding, const uint8_t *s, size_t len, uint32_t *cp) {
+    return encoding == TXT_ENCODING_GB18030 ? gb18030_decode(s, len, cp) : utf8_decode(s, len, cp);
+}
+
+static bool is_blank(uint32_t cp) {
+    return cp == ' ' || cp == '\t' || cp == '\f' || cp == '\v' || cp == 0x3000 || cp == 0xA0 ||
+           cp == 0xFEFF;
+}
+
+static bool in_list(uint32_t cp, const uint16_t *list, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (list[i] == cp) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_numeral(uint32_t cp) {
+    // 零〇一二两三四五六七八九十百千万 与大写数字
+    static const uint16_t cn[] = {
+        0x96F6, 0x3007, 0x4E00, 0x4E8C, 0x4E24, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03,
+        0x516B, 0x4E5D, 0x5341, 0x767E, 0x5343, 0x4E07, 0x58F9, 0x8D30, 0x53C1, 0x8086,
+        0x4F0D, 0x9646, 0x67D2, 0x634C, 0x7396, 0x62FE, 0x4F70, 0x4EDF,
+    };
+    return (cp >= '0' && cp <= '9') || (cp >= 0xFF10 && cp <= 0xFF19) ||
+           in_list(cp, cn, sizeof(cn) / sizeof(cn[0]));
+}
+
+// “第 N X”的单位 X：卷、部、篇为第一级，章、回、节、话、集（含繁体）为第二级；其他返回 -1
+static int unit_level(uint32_t cp) {
+    static const uint16_t volume[] = {0x5377, 0x90E8, 0x7BC7};                   // 卷部篇
+    static const uint16_t chapter[] = {0x7AE0, 0x56DE, 0x8282, 0x8BDD, 0x96C6,   // 章回节话集
+                                       0x7BC0, 0x8A71};                          // 節話
+    if (in_list(cp, volume, sizeof(volume) / sizeof(volume[0]))) {
+        return 0;
+    }
+    if (in_list(cp, chapter, sizeof(chapter) / sizeof(chapter[0]))) {
+        return 1;
+    }
+    return -1;
+}
+
+static uint32_t fold_case(uint32_t cp) {
+    return (cp >= 'A' && cp <= 'Z') ? cp + ('a' - 'A') : cp;
+}
+
+static bool is_letter(uint32_t cp) {
+    cp = fold_case(cp);
+    return cp >= 'a' && cp <= 'z';
+}
+
+// 第一章 / 第 12 回 / 第三卷：标题
+static int match_ordinal(const uint32_t *line, int len) {
+    if (line[0] != 0x7B2C) {   // 第
+        return -1;
+    }
+    int i = 1;
+    int digits = 0;
+    while (i < len && (is_numeral(line[i]) || line[i] == ' ')) {
+        digits += line[i] != ' ';
+        i++;
+    }
+    if (digits == 0 || digits > TOC_NUMERAL_MAX || i >= len) {
+        return -1;
+    }
+    return unit_level(line[i]);
+}
+
+static bool is_roman(uint32_t cp) {
+    cp = fold_case(cp);
+    return cp == 'i' || cp == 'v' || cp == 'x' || cp == 'l' || cp == 'c' || cp == 'd' || cp == 'm';
+}
+
+// Chapter 12 / CHAPTER IV
+static int match_chapter(const uint32_t *line, int len) {
+    static const char word[] = "chapter";
+    const int n = (int)sizeof(word) - 1;
+    if (len <= n + 1) {
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        if (fold_case(line[i]) != (uint32_t)word[i]) {
+            return -1;
+        }
+    }
+    int i = n;
+    while (i < len && line[i] == ' ') {
+        i++;
+    }
+    if (i == n) {
+        return -1;
+    }
+    const int first = i;
+    while (i < len && ((line[i] >= '0' && line[i] <= '9') || is_roman(line[i]))) {
+        i++;
+    }
+    // 数字之后不能紧跟字母（排除 “Chapter in ...” 这样的正文）
+    if (i == first || (i < len && is_letter(line[i]))) {
+        return -1;
+    }
+    return 1;
+}
+
+// 序章、楔子等：单独成行或后面跟空白、标点；番外后面可以直接接序号
+static int match_named(const uint32_t *line, int len) {
+    static const uint16_t names[][2] = {
+        {0x5E8F, 0x7AE0},  // 序章
+        {0x6954, 0x5B50},  // 楔子
+        {0x5F15, 0x5B50},  // 引子
+        {0x5E8F, 0x8A00},  // 序言
+        {0x524D, 0x8A00},  // 前言
+        {0x5C3E, 0x58F0},  // 尾声
+        {0x540E, 0x8BB0},  // 后记
+        {0x7EC8, 0x7AE0},  // 终章
+        {0x756A, 0x5916},  // 番外
+    };
+    if (len < 2) {
+        return -1;
+    }
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (line[0] != names[i][0] || line[1] != names[i][1]) {
+            continue;
+        }
+        if (len == 2 || names[i][0] == 0x756A || is_blank(line[2]) ||
+            line[2] == 0xFF1A || line[2] == ':' || line[2] == 0x3001) {   // ： : 、
+            return 1;
+        }
+    }
+    return -1;
+}
+
+// 标题行的级别，不是标题时返回 -1
+static int heading_level(const uint32_t *line, int len) {
+    int level = match_ordinal(line, len);
+    if (level < 0) {
+        level = match_chapter(line, len);
+    }
+    if (level < 0) {
+        level = match_named(line, len);
+    }
+    return level;
+}
+
+// ---------------------------------------------------------------------------
+// 后台识别
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t gen;
+    uint32_t key;
+    long file_size;
+    long content_start;
+    txt_encoding_t encoding;
+    char book_path[256];
+    char toc_path[64];
+    bool failed;
+    bool complete;
+
+    FILE *book;
+    FILE *out;
+    long pos;                        // 下一次读取的文件偏移
+    uint8_t in[TOC_READ_CHUNK + 4];  // 加上一个不完整字符的余量
+    size_t in_len;
+
+    // 当前行：行首空白之后最多 TXT_TOC_LINE_MAX 个字符
+    uint32_t line[TXT_TOC_LINE_MAX];
+    int line_len;                    // 超过上限时为 TXT_TOC_LINE_MAX + 1
+    long line_start;                 // 第一个非空白字符的偏移，-1 表示仍在行首空白中
+
+    // 还没遇到正文的标题（按级别），遇到正文才写入；期间又来同级或上级标题时
+    // 说明是书前的目录页，用新的替换
+    toc_record_t pending[2];
+    bool have_pending[2];
+    uint32_t count;
+    bool volumes;
+} build_t;
+
+static struct {
+    bool open;
+    volatile bool ready;
+    volatile int count;
+    volatile bool volumes;
+    uint32_t gen;
+    bg_job_id_t job;
+    uint32_t key;
+    long file_size;
+    txt_encoding_t encoding;
+    char toc_path[64];
+} s_toc;
+
+static void commit_pending(build_t *b) {
+    for (int level = 0; level < 2; level++) {
+        if (!b->have_pending[level]) {
+            continue;
+        }
+        b->have_pending[level] = false;
+        if (b->count >= TXT_TOC_MAX_ENTRIES) {
+            continue;
+        }
+        if (fwrite(&b->pending[level], sizeof(toc_record_t), 1, b->out) != 1) {
+            b->failed = true;
+            return;
+        }
+        b->count++;
+        b->volumes |= level == 0;
+    }
+}
+
+static void add_heading(build_t *b, int level) {
+    // 同级或更低一级的待定标题之后没有正文：丢弃
+    for (int l = level; l < 2; l++) {
+        b->have_pending[l] = false;
+    }
+    toc_record_t *rec = &b->pending[level];
+    memset(rec, 0, sizeof(*rec));
+    rec->offset = (uint32_t)b->line_start;
+    rec->level = (uint8_t)level;
+    size_t used = 0;
+    for (int i = 0; i < b->line_len; i++) {
+        char buf[4];
+        const size_t n = utf8_encode(b->line[i], buf);
+        if (used + n >= sizeof(rec->title)) {
+            break;
+        }
+        memcpy(rec->title + used, buf, n);
+        used += n;
+    }
+    b->have_pending[level] = true;
+}
+
+static void line_end(build_t *b) {
+    if (b->line_start >= 0) {
+        int len = b->line_len;
+        while (len > 0 && len <= TXT_TOC_LINE_MAX && is_blank(b->line[len - 1])) {
+            len--;
+        }
+        const int level = len <= TXT_TOC_LINE_MAX ? heading_level(b->line, len) : -1;
+        if (level >= 0) {
+            b->line_len = len;
+            add_heading(b, level);
+        } else {
+            commit_pending(b);
+        }
+    }
+    b->line_len = 0;
+    b->line_start = -1;
+}
+
+static void feed_char(build_t *b, uint32_t cp, long offset) {
+    if (cp == '\n' || cp == '\r') {
+        line_end(b);
+        return;
+    }
+    if (b->line_start < 0) {
+        if (is_blank(cp)) {
+            return;
+        }
+        b->line_start = offset;
+    }
+    if (b->line_len < TXT_TOC_LINE_MAX) {
+        b->line[b->line_len++] = cp;
+    } else {
+        b->line_len = TXT_TOC_LINE_MAX + 1;
+    }
+}
+
+static bool build_begin(build_t *b) {
+    b->book = fopen(b->book_path, "rb");
+    mkdir(PAGE_INDEX_DIR, 0775);
+    b->out = fopen(b->toc_path, "wb");
+    if (b->book == NULL || b->out == NULL || fseek(b->book, b->content_start, SEEK_SET) != 0) {
+        ESP_LOGW(TAG, "Cannot open files for the chapter index (errno=%d)", errno);
+        return false;
+    }
+    // 先占住文件头的位置，完成后再写入真正的文件头
+    const toc_header_t blank = {0};
+    if (fwrite(&blank, sizeof(blank), 1, b->out) != 1) {
+        return false;
+    }
+    b->pos = b->content_start;
+    b->line_start = -1;
+    return true;
+}
+
+static bool build_finish(build_t *b) {
+    line_end(b);
+    commit_pending(b);
+    if (b->failed) {
+        return false;
+    }
+    const toc_header_t hdr = {
+        .magic = TOC_MAGIC,
+        .key = b->key,
+        .file_size = (uint32_t)b->file_size,
+        .count = b->count,
+        .encoding = (uint8_t)b->encoding,
+        .volumes = b->volumes,
+        .record_size = sizeof(toc_record_t),
+    };
+    if (fseek(b->out, 0, SEEK_SET) != 0 || fwrite(&hdr, sizeof(hdr), 1, b->out) != 1) {
+        return false;
+    }
+    const bool ok = fclose(b->out) == 0;
+    b->out = NULL;
+    return ok;
+}
+
+// 读一块正文，逐字符送入行识别
+static bool build_step(bg_job_t *job, void *arg) {
+    build_t *b = (build_t *)arg;
+    if (bg_job_cancelled(job) || b->failed) {
+        return false;
+    }
+    if (b->book == NULL && !build_begin(b)) {
+        b->failed = true;
+        return false;
+    }
+
+    size_t want = TOC_READ_CHUNK;
+    if ((long)want > b->file_size - b->pos) {
+        want = (size_t)(b->file_size - b->pos);
+    }
+    const size_t n = want > 0 ? fread(b->in + b->in_len, 1, want, b->book) : 0;
+    if (n != want) {
+        ESP_LOGW(TAG, "Read failed at %ld", b->pos);
+        b->failed = true;
+        return false;
+    }
+    const long base = b->pos - (long)b->in_len;  // in[0] 的文件偏移
+    b->pos += (long)n;
+    const size_t len = b->in_len + n;
+    const bool at_eof = b->pos >= b->file_size;
+
+    size_t i = 0;
+    while (i < len) {
+        uint32_t cp;
+        int used = decode_char(b->encoding, b->in + i, len - i, &cp);
+        if (used == 0) {
+            if (!at_eof) {
+                break;      // 字符跨块，留到下一步
+            }
+            used = 1;
+            cp = 0xFFFD;
+        }
+        feed_char(b, cp, base + (long)i);
+        i += (size_t)used;
+    }
+    memmove(b->in, b->in + i, len - i);
+    b->in_len = len - i;
+    if (b->failed) {
+        return false;
+    }
+    if (!at_eof) {
+        return true;
+    }
+    if (!build_finish(b)) {
+        b->failed = true;
+        return false;
+    }
+    b->complete = true;
+    return false;
+}
+
+static void build_done(void *arg, bool finished) {
+    build_t *b = (build_t *)arg;
+    if (b->book != NULL) fclose(b->book);
+    if (b->out != NULL) fclose(b->out);
+    if (!b->complete) {
+        remove(b->toc_path);
+    }
+
+    if (b->gen == s_toc.gen) {
+        if (finished && b->complete) {
+            s_toc.count = (int)b->count;
+            s_toc.volumes = b->volumes;
+            s_toc.ready = true;
+            ESP_LOGI(TAG, "Found %u chapter(s)%s", (unsigned)b->count,
+                     b->count >= TXT_TOC_MAX_ENTRIES ? " (truncated)" : "");
+        } else if (!finished) {
+            ESP_LOGI(TAG, "Chapter scan cancelled");
+        } else {
+            ESP_LOGW(TAG, "Chapter scan failed");
+        }
+        s_toc.job = BG_JOB_NONE;
+    }
+    heap_stats_free(HEAP_TAG_SEARCH, b);
+}
+
+// ---------------------------------------------------------------------------
+// 打开、关闭与读取
+// ---------------------------------------------------------------------------
+
+static bool read_header(FILE *f, toc_header_t *hdr) {
+    return fseek(f, 0, SEEK_SET) == 0 && fread(hdr, sizeof(*hdr), 1, f) == 1 &&
+           hdr->magic == TOC_MAGIC && hdr->key == s_toc.key &&
+           hdr->file_size == (uint32_t)s_toc.file_size &&
+           hdr->encoding == (uint8_t)s_toc.encoding &&
+           hdr->record_size == sizeof(toc_record_t) && hdr->count <= TXT_TOC_MAX_ENTRIES;
+}
+
+void txt_toc_open(const txt_toc_config_t *cfg) {
+    txt_toc_close();
+    if (cfg == NULL || cfg->file_path == NULL || cfg->file_size <= 0) {
+        return;
+    }
+
+    struct stat st;
+    const uint32_t mtime = stat(cfg->file_path, &st) == 0 ? (uint32_t)st.st_mtime : 0;
+    uint32_t key = page_index_hash(0, cfg->file_path, strlen(cfg->file_path));
+    key = page_index_hash(key, &cfg->file_size, sizeof(cfg->file_size));
+    key = page_index_hash(key, &mtime, sizeof(mtime));
+
+    s_toc.open = true;
+    s_toc.key = key;
+    s_toc.file_size = cfg->file_size;
+    s_toc.encoding = cfg->encoding;
+    snprintf(s_toc.toc_path, sizeof(s_toc.toc_path), "%s/%08x.toc", PAGE_INDEX_DIR, (unsigned)key);
+
+    FILE *f = fopen(s_toc.toc_path, "rb");
+    if (f != NULL) {
+        toc_header_t hdr;
+        const bool valid = read_header(f, &hdr);
+        fclose(f);
+        if (valid) {
+            s_toc.count = (int)hdr.count;
+            s_toc.volumes = hdr.volumes != 0;
+            s_toc.ready = true;
+            ESP_LOGI(TAG, "Using %s (%u chapters)", s_toc.toc_path, (unsigned)hdr.count);
+            return;
+        }
+        ESP_LOGW(TAG, "Rebuilding stale chapter index %s", s_toc.toc_path);
+    }
+
+    build_t *b = heap_stats_calloc(HEAP_TAG_SEARCH, 1, sizeof(build_t));
+    if (b == NULL) {
+        return;
+    }
+    b->gen = s_toc.gen;
+    b->key = key;
+    b->file_size = cfg->file_size;
+    b->content_start = cfg->content_start;
+    b->encoding = cfg->encoding;
+    strncpy(b->book_path, cfg->file_path, sizeof(b->book_path) - 1);
+    strncpy(b->toc_path, s_toc.toc_path, sizeof(b->toc_path) - 1);
+
+    const bg_job_desc_t desc = {
+        .name = "txt_toc",
+        .prio = BG_JOB_PRIO_NORMAL,
+        .mem_budget = sizeof(build_t),
+        .step = build_step,
+        .done = build_done,
+        .arg = b,
+    };
+    s_toc.job = bg_jobs_submit(&desc);
+    if (s_toc.job == BG_JOB_NONE) {
+        heap_stats_free(HEAP_TAG_SEARCH, b);
+        ESP_LOGW(TAG, "Cannot submit chapter scan");
+        return;
+    }
+    ESP_LOGI(TAG, "Scanning chapters of %s", cfg->file_path);
+}
+
+void txt_toc_close(void) {
+    if (!s_toc.open) {
+        return;
+    }
+    if (s_toc.job != BG_JOB_NONE) {
+        bg_jobs_cancel(s_toc.job);
+    }
+    const uint32_t gen = s_toc.gen + 1;
+    memset(&s_toc, 0, sizeof(s_toc));
+    s_toc.gen = gen;  // 被取消的作业结束时不再改动这里的状态
+}
+
+bool txt_toc_is_ready(void) {
+    return s_toc.open && s_toc.ready;
+}
+
+int txt_toc_count(void) {
+    return txt_toc_is_ready() ? s_toc.count : 0;
+}
+
+bool txt_toc_has_volumes(void) {
+    return txt_toc_is_ready() && s_toc.volumes;
+}
+
+int txt_toc_read(int first, txt_toc_entry_t *entries, int count) {
+    const int total = txt_toc_count();
+    if (entries == NULL || first < 0 || first >= total || count <= 0) {
+        return 0;
+    }
+    if (count > total - first) {
+        count = total - first;
+    }
+    FILE *f = fopen(s_toc.toc_path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+    int n = 0;
+    if (fseek(f, (long)(sizeof(toc_header_t) + (size_t)first * sizeof(toc_record_t)), SEEK_SET) == 0) {
+        toc_record_t rec;
+        while (n < count && fread(&rec, sizeof(rec), 1, f) == 1) {
+            entries[n].offset = (long)rec.offset;
+            entries[n].level = rec.level;
+            memcpy(entries[n].title, rec.title, sizeof(entries[n].title));
+            entries[n].title[sizeof(entries[n].title) - 1] = '\0';
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+int txt_toc_find(long offset) {
+    const int total = txt_toc_count();
+    if (total <= 0) {
+        return 0;
+    }
+    FILE *f = fopen(s_toc.toc_path, "rb");
+    if (f == NULL) {
+        return 0;
+    }
+    // 二分查找起点不晚于 offset 的最后一项，每次只读一条记录的偏移
+    int lo = 0;
+    int hi = total - 1;
+    int found = 0;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        uint32_t start;
+        if (fseek(f, (long)(sizeof(toc_header_t) + (size_t)mid * sizeof(toc_record_t)), SEEK_SET) != 0 ||
+            fread(&start, sizeof(start), 1, f) != 1) {
+            break;
+        }
+        if ((long)start <= offset) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    fclose(f);
+    return found;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file txt_toc.h
+ * @brief TXT 章节目录 - 后台识别章节标题，保存为按文件偏移的目录表
+ *
+ * TXT 小说没有结构，章节只靠标题行区分。后台作业（bg_jobs）顺序读一遍书，逐行解码
+ * （UTF-8 或 GB18030），行首（跳过空白）符合下列形式且整行不超过 TXT_TOC_LINE_MAX
+ * 个字符的行记为章节：
+ *   - 第 + 数字（阿拉伯、全角或中文数字）+ 章/回/节/话/集/卷/部/篇，后面可接标题
+ *   - Chapter / CHAPTER + 阿拉伯或罗马数字
+ *   - 序章、楔子、引子、序言、前言、尾声、后记、番外 等单独成行的标题
+ * 卷、部、篇为第一级，其余为第二级。书前的目录页（一串标题之间没有正文）只保留最后
+ * 一项，避免目录页和正文各出现一遍。
+ *
+ * 目录保存在 /sdcard/.x4cache/<hash>.toc：文件头 + 定长记录，读任意一项只需一次 fseek，
+ * 跳到章节就是跳到记录里的文件偏移
+ */
+
+#ifndef TXT_TOC_H
+#define TXT_TOC_H
+
+#include "txt_reader.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TXT_TOC_LINE_MAX     40      // 标题行最多的字符数，更长的行视为正文
+#define TXT_TOC_MAX_ENTRIES  4096    // 最多记录的章节数
+#define TXT_TOC_TITLE_SIZE   58      // 标题的最大字节数（UTF-8，含结尾 NUL）
+
+typedef struct {
+    const char *file_path;       // 书籍路径
+    long file_size;
+    long content_start;          // 正文起点（跳过 BOM）
+    txt_encoding_t encoding;     // 文件编码（已检测，不是 AUTO）
+} txt_toc_config_t;
+
+// 目录项
+typedef struct {
+    long offset;                       // 标题行的文件偏移（行首空白之后）
+    uint8_t level;                     // 0：卷、部、篇；1：章节
+    char title[TXT_TOC_TITLE_SIZE];    // 标题行（UTF-8，过长时在字符边界截断）
+} txt_toc_entry_t;
+
+/**
+ * @brief 为书籍准备目录：已有目录时立即可用，否则提交后台识别作业
+ *
+ * 之前打开的书先关闭。在 LVGL 任务中调用
+ */
+void txt_toc_open(const txt_toc_config_t *cfg);
+
+/**
+ * @brief 关闭当前书籍，取消未完成的识别
+ */
+void txt_toc_close(void);
+
+/**
+ * @brief 目录是否已识别完成（完成后也可能没有任何章节）
+ */
+bool txt_toc_is_ready(void);
+
+/**
+ * @brief 章节数；尚未完成时为 0
+ */
+int txt_toc_count(void);
+
+/**
+ * @brief 目录中是否有卷、部、篇（有时章节缩进显示）
+ */
+bool txt_toc_has_volumes(void);
+
+/**
+ * @brief 读取一段连续的目录项
+ * @param first 第一项的序号
+ * @param entries 输出
+ * @param count 最多读取的项数
+ * @return 实际读取的项数，失败返回 0
+ */
+int txt_toc_read(int first, txt_toc_entry_t *entries, int count);
+
+/**
+ * @brief 查找 offset 所在的章节（起点不晚于 offset 的最后一项）
+ * @return 目录项序号；在第一章之前或目录为空时返回 0
+ */
+int txt_toc_find(long offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TXT_TOC_H
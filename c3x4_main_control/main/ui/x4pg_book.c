@@ -0,0 +1,156 @@
+/**
+ * @file x4pg_book.c
+ * @brief X4PG 预排版书籍读取实现
+ */
+
+#include "x4pg_book.h"
+#include "page_index.h"
+#include "../packbits.h"
+#include "../spi_arbiter.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "X4PG";
+
+#define X4PG_IO_BUF      1024   // 页数据顺序读取，一次 fread 取一段
+#define X4PG_PORTRAIT    0      // 竖屏：逻辑 480x800 旋转到面板布局（与 lvgl_fb_put_bitmap 相同）
+#define X4PG_LANDSCAPE   1      // 面板原生方向
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t bpp;                 // 1 或 2
+    uint8_t orientation;         // X4PG_PORTRAIT / X4PG_LANDSCAPE
+    uint16_t width;              // 面板物理尺寸
+    uint16_t height;
+    uint32_t page_count;
+    uint32_t table_offset;       // 页偏移表的位置
+    char title[X4PG_TITLE_MAX];  // UTF-8，不足时补 0
+    uint32_t check;              // 以上字段的 FNV-1a
+} x4pg_header_t;
+
+struct x4pg_book {
+    FILE *file;
+    x4pg_header_t header;
+    uint32_t file_size;
+    char title[X4PG_TITLE_MAX + 1];
+};
+
+x4pg_book_t *x4pg_book_open(const char *path, bool portrait) {
+    if (path == NULL) {
+        return NULL;
+    }
+    x4pg_book_t *book = calloc(1, sizeof(x4pg_book_t));
+    if (book == NULL) {
+        return NULL;
+    }
+    book->file = fopen(path, "rb");
+    if (book->file == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        free(book);
+        return NULL;
+    }
+    setvbuf(book->file, NULL, _IOFBF, X4PG_IO_BUF);
+
+    x4pg_header_t *hdr = &book->header;
+    spi_arbiter_sd_begin();
+    bool ok = fread(hdr, sizeof(*hdr), 1, book->file) == 1 && fseek(book->file, 0, SEEK_END) == 0;
+    const long size = ok ? ftell(book->file) : -1;
+    spi_arbiter_sd_end();
+
+    const uint64_t table_end = (uint64_t)hdr->table_offset + ((uint64_t)hdr->page_count + 1) * 4;
+    ok = ok && size > 0 && hdr->magic == X4PG_MAGIC && hdr->version == X4PG_VERSION &&
+         hdr->check == page_index_hash(0, hdr, offsetof(x4pg_header_t, check)) &&
+         (hdr->bpp == 1 || hdr->bpp == 2) && hdr->page_count > 0 &&
+         hdr->table_offset >= sizeof(*hdr) && table_end <= (uint64_t)size;
+    if (!ok) {
+        ESP_LOGW(TAG, "%s: not a valid X4PG v%d file", path, X4PG_VERSION);
+        x4pg_book_close(book);
+        return NULL;
+    }
+    if (hdr->orientation != (portrait ? X4PG_PORTRAIT : X4PG_LANDSCAPE)) {
+        ESP_LOGW(TAG, "%s was built for %s orientation", path,
+                 hdr->orientation == X4PG_PORTRAIT ? "portrait" : "landscape");
+        x4pg_book_close(book);
+        return NULL;
+    }
+    book->file_size = (uint32_t)size;
+    memcpy(book->title, hdr->title, X4PG_TITLE_MAX);
+    book->title[X4PG_TITLE_MAX] = '\0';
+    ESP_LOGI(TAG, "Opened %s: %lu pages, %ux%u %ubpp", path, (unsigned long)hdr->page_count,
+             hdr->width, hdr->height, hdr->bpp);
+    return book;
+}
+
+void x4pg_book_close(x4pg_book_t *book) {
+    if (book == NULL) {
+        return;
+    }
+    if (book->file != NULL) {
+        fclose(book->file);
+    }
+    free(book);
+}
+
+int x4pg_book_page_count(const x4pg_book_t *book) {
+    return book != NULL ? (int)book->header.page_count : 0;
+}
+
+const char *x4pg_book_title(const x4pg_book_t *book) {
+    return book != NULL ? book->title : "";
+}
+
+// 2bpp 页：边解压边二值化，每两个 2bpp 字节合成一个 framebuffer 字节
+static bool decode_2bpp(FILE *fp, uint8_t *fb, size_t fb_size) {
+    const size_t total = fb_size * 2;
+    size_t pos = 0;
+    uint8_t out = 0;
+    int c;
+    while (pos < total && (c = fgetc(fp)) != EOF) {
+        const bool literal = c < 128;
+        size_t n = literal ? (size_t)c + 1 : (size_t)c - 125;
+        int v = literal ? 0 : fgetc(fp);
+        if (v == EOF || pos + n > total) {
+            return false;
+        }
+        for (; n > 0; n--) {
+            if (literal && (v = fgetc(fp)) == EOF) {
+                return false;
+            }
+            // 4 个像素各取高位（>= 2 为白）
+            const uint8_t nibble = (uint8_t)(((v >> 4) & 0x08) | ((v >> 3) & 0x04) |
+                                             ((v >> 2) & 0x02) | ((v >> 1) & 0x01));
+            if ((pos & 1) == 0) {
+                out = (uint8_t)(nibble << 4);
+            } else {
+                fb[pos >> 1] = out | nibble;
+            }
+            pos++;
+        }
+    }
+    return pos == total;
+}
+
+bool x4pg_book_decode(x4pg_book_t *book, int page, uint8_t *fb, size_t fb_size) {
+    if (book == NULL || fb == NULL || page < 0 || (uint32_t)page >= book->header.page_count ||
+        fb_size != (size_t)book->header.width * book->header.height / 8) {
+        return false;
+    }
+    uint32_t span[2];
+    spi_arbiter_sd_begin();
+    bool ok = fseek(book->file, (long)(book->header.table_offset + (uint32_t)page * 4), SEEK_SET) == 0 &&
+              fread(span, sizeof(span), 1, book->file) == 1 &&
+              span[0] < span[1] && span[1] <= book->file_size &&
+              fseek(book->file, (long)span[0], SEEK_SET) == 0;
+    if (ok) {
+        ok = book->header.bpp == 1 ? packbits_read(book->file, fb, fb_size)
+                                   : decode_2bpp(book->file, fb, fb_size);
+    }
+    spi_arbiter_sd_end();
+    if (!ok) {
+        ESP_LOGW(TAG, "Page %d is damaged", page + 1);
+    }
+    return ok;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file x4pg_book.h
+ * @brief X4PG 预排版书籍：电脑上排好、抖动好的整页位图，翻页时直接解压进 framebuffer
+ *
+ * 文件布局（小端）：
+ *   - 文件头 x4pg_header_t（带 FNV-1a 校验）
+ *   - 页偏移表：page_count + 1 个 uint32，第 i 页的数据为 [offset[i], offset[i + 1])
+ *   - 每页一段 PackBits（与 packbits.h 相同），解压后是一整帧面板布局的位图：
+ *       1 bpp：与 framebuffer 完全相同（每行 100 字节，高位在左，1 为白色），48,000 字节
+ *       2 bpp：每字节 4 像素，高位在左，0 黑 ~ 3 白，96,000 字节；黑白显示时按 >= 2 为白
+ * 翻到任意页只需读两项偏移再顺序读一段数据，设备上没有排版和字形查找。
+ * 文件由 tools/x4pg.py 生成；所有函数都在 LVGL 任务中调用
+ */
+
+#ifndef X4PG_BOOK_H
+#define X4PG_BOOK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define X4PG_MAGIC    0x47503458u  // "X4PG"
+#define X4PG_VERSION  1
+#define X4PG_TITLE_MAX 64
+
+typedef struct x4pg_book x4pg_book_t;
+
+/**
+ * @brief 打开 X4PG 文件并校验文件头
+ * @param path 文件路径
+ * @param portrait 当前显示方向为竖屏（文件必须按同一方向生成）
+ * @return 句柄；文件无效、方向或尺寸不符、内存不足时为 NULL
+ */
+x4pg_book_t *x4pg_book_open(const char *path, bool portrait);
+
+void x4pg_book_close(x4pg_book_t *book);
+
+int x4pg_book_page_count(const x4pg_book_t *book);
+
+/**
+ * @brief 书名（文件头中的 UTF-8 字符串，没有时为空串）
+ */
+const char *x4pg_book_title(const x4pg_book_t *book);
+
+/**
+ * @brief 把第 page 页（从 0 开始）解压进整帧 framebuffer
+ * @param fb 面板布局的 1bpp framebuffer
+ * @param fb_size framebuffer 字节数（必须与文件的一帧相符）
+ * @return false 页码越界、数据不完整或读取失败（fb 内容未定义）
+ */
+bool x4pg_book_decode(x4pg_book_t *book, int page, uint8_t *fb, size_t fb_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // X4PG_BOOK_H
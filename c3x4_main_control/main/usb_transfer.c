@@ -0,0 +1,808 @@
+/**
+ * @file usb_transfer.c
+ * @brief USB 传输模式实现
+ *
+ * 进入和退出在 LVGL 任务中执行，外部请求和返回键只设置标志（与 wifi_transfer.c 相同）。
+ * 协议在专用任务中运行：从 USB 驱动的接收缓冲区读字节、拼帧、按帧处理；PUT 的数据经
+ * ble_writer 交给写入任务写卡，协议任务只在写入环形缓冲满时等待；GET 直接 fread。
+ * 数据块在 CRC 校验并确认偏移连续之后才放进写入队列，.part 的内容始终是已确认数据的前缀
+ */
+
+#include "usb_transfer.h"
+#include "ble_writer.h"
+#include "sd_path.h"
+#include "stack_stats.h"
+#include "wifi_transfer.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "ui/file_browser.h"
+#include "driver/usb_serial_jtag.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *TAG = "USB_XFER";
+
+#define UX_POLL_MS          200
+#define UX_STATUS_MIN_MS    1000     // 状态文字最多每秒刷新一次（批量同步时文件很多）
+#define UX_TASK_STACK       4096
+#define UX_TASK_PRIO        4
+#define UX_READ_WAIT_MS     20
+#define UX_WRITE_WAIT_MS    100
+#define UX_WRITE_RETRIES    20       // 主机不读时放弃发送（约 2 秒）
+#define UX_SESSION_IDLE_MS  5000     // PUT/GET 期间主机这么久没有任何帧就放弃
+#define UX_RESEND_MS        500      // GET：这么久没有新的 ACK 就从最近确认的偏移重发
+#define UX_RING_WAIT_MS     1000     // 写入环形缓冲满时等 SD 卡，超时回 NAK
+#define UX_FLUSH_MS         3000
+#define UX_STOP_WAIT_MS     5000     // 协议任务可能正在等写入任务把 .part 关掉
+#define UX_DRIVER_RX_BUF    (USB_XFER_BLOCK * 4)
+#define UX_DRIVER_TX_BUF    (USB_XFER_BLOCK * 2)
+#define UX_HDR              6        // 'X' '4' type 0 len16
+#define UX_CRC              4
+#define UX_PAYLOAD_MAX      (4 + USB_XFER_BLOCK)    // DATA：偏移 + 数据
+#define UX_FRAME_MAX        (UX_HDR + UX_PAYLOAD_MAX + UX_CRC)
+#define UX_NAME_MAX         40
+
+// 帧类型（见 usb_transfer.h）
+#define UX_OP_HELLO         0x01
+#define UX_OP_LIST          0x02
+#define UX_OP_PUT           0x03
+#define UX_OP_GET           0x04
+#define UX_OP_DEL           0x05
+#define UX_OP_ABORT         0x06
+#define UX_OP_DATA          0x10
+#define UX_OP_ACK           0x11
+#define UX_RE_STATUS        0x80
+#define UX_RE_HELLO         0x81
+#define UX_RE_ENTRY         0x82
+
+typedef enum {
+    UX_OK = 0,
+    UX_NAK = 1,              // 仅 ACK：从给出的偏移重发
+    UX_ERR_REQUEST = 2,      // 帧内容、路径不合法或没有对应的会话
+    UX_ERR_SD = 3,           // 打开、读写或改名失败
+    UX_ERR_CRC = 4,          // PUT 收齐后整个文件的 CRC32 不符
+    UX_ERR_NOT_FOUND = 5,
+} ux_status_t;
+
+typedef enum {
+    SESSION_NONE,
+    SESSION_PUT,
+    SESSION_GET,
+} ux_session_t;
+
+// 协议任务的缓冲区：进入模式时分配，退出时释放
+typedef struct {
+    uint8_t rx[UX_FRAME_MAX];
+    uint8_t tx[UX_FRAME_MAX];
+    char path[BLE_WRITER_PATH_MAX];           // 目录列表时拼条目路径（stat 经过 FATFS 时栈较深）
+} ux_buffers_t;
+
+static usb_transfer_config_t s_cfg;
+static lv_timer_t *s_timer = NULL;
+static volatile bool s_enter_requested = false;
+static volatile bool s_exit_requested = false;
+static bool s_active = false;
+static bool s_ble_stopped = false;
+static bool s_driver_installed = false;
+static vprintf_like_t s_prev_vprintf = NULL;
+
+// 协议任务
+static TaskHandle_t s_task = NULL;
+static volatile bool s_task_stop = false;
+static volatile bool s_task_running = false;
+static ux_buffers_t *s_buf = NULL;
+static size_t s_rx_fill = 0;
+static ux_session_t s_session = SESSION_NONE;
+static uint32_t s_size = 0;
+static uint32_t s_file_crc = 0;        // PUT：主机给出的整个文件的 CRC32
+static uint32_t s_crc = 0;             // PUT：已确认数据的 CRC32
+static uint32_t s_next = 0;            // PUT：期待的偏移；GET：下一次发送的偏移
+static uint32_t s_acked = 0;           // GET：主机确认到的偏移
+static uint32_t s_unacked = 0;         // PUT：上次 ACK 之后确认的块数
+static bool s_nak_sent = false;        // PUT：已为当前缺口发过 NAK
+static FILE *s_get_fp = NULL;
+static uint32_t s_get_pos = 0;         // GET：s_get_fp 的读位置
+static TickType_t s_last_rx = 0;
+static TickType_t s_last_ack = 0;
+static char s_final[BLE_WRITER_PATH_MAX];
+static char s_part[BLE_WRITER_PATH_MAX];
+
+// 状态显示（协议任务写，LVGL 任务读；只用于显示，不加锁）
+static volatile bool s_status_dirty = false;
+static volatile uint32_t s_files_in = 0;
+static volatile uint32_t s_files_out = 0;
+static volatile bool s_busy = false;
+static char s_current[UX_NAME_MAX];
+static bool s_connected = false;
+static uint32_t s_status_tick = 0;
+
+// 专用屏幕
+static lv_obj_t *s_screen = NULL;
+static lv_obj_t *s_status = NULL;
+static lv_obj_t *s_prev_screen = NULL;
+static lv_group_t *s_group = NULL;
+static lv_group_t *s_prev_group = NULL;
+static lv_indev_t *s_indev = NULL;
+
+// ============================================================================
+// 帧收发
+// ============================================================================
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 日志在模式期间丢弃：次控制台也在 USB Serial/JTAG 上，会插进数据帧
+static int quiet_vprintf(const char *fmt, va_list args) {
+    (void)fmt;
+    (void)args;
+    return 0;
+}
+
+static bool write_all(const uint8_t *data, size_t len) {
+    int retries = 0;
+    while (len > 0) {
+        const int n = usb_serial_jtag_write_bytes(data, len, pdMS_TO_TICKS(UX_WRITE_WAIT_MS));
+        if (n <= 0) {
+            if (++retries > UX_WRITE_RETRIES || s_task_stop) {
+                return false;
+            }
+            continue;
+        }
+        retries = 0;
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// 发送负载已在 s_buf->tx + UX_HDR 的帧
+static bool send_tx(uint8_t type, size_t len) {
+    uint8_t *f = s_buf->tx;
+    f[0] = 'X';
+    f[1] = '4';
+    f[2] = type;
+    f[3] = 0;
+    f[4] = (uint8_t)len;
+    f[5] = (uint8_t)(len >> 8);
+    put_le32(f + UX_HDR + len, esp_rom_crc32_le(0, f + 2, UX_HDR - 2 + len));
+    return write_all(f, UX_HDR + len + UX_CRC);
+}
+
+static bool send_frame(uint8_t type, const void *payload, size_t len) {
+    if (len > 0) {
+        memcpy(s_buf->tx + UX_HDR, payload, len);
+    }
+    return send_tx(type, len);
+}
+
+static void send_status(uint8_t op, ux_status_t status, uint32_t value) {
+    uint8_t msg[6] = { op, (uint8_t)status };
+    put_le32(msg + 2, value);
+    send_frame(UX_RE_STATUS, msg, sizeof(msg));
+}
+
+static void send_ack(ux_status_t status, uint32_t offset) {
+    uint8_t msg[5] = { (uint8_t)status };
+    put_le32(msg + 1, offset);
+    send_frame(UX_OP_ACK, msg, sizeof(msg));
+}
+
+// 取负载里的相对路径并拼成绝对路径；allow_root 时空路径表示 /sdcard 本身
+static bool get_path(const uint8_t *p, size_t len, char *full, size_t full_size, bool allow_root) {
+    char rel[SD_PATH_REL_MAX + 1];
+    if (len > SD_PATH_REL_MAX) {
+        return false;
+    }
+    memcpy(rel, p, len);
+    rel[len] = '\0';
+    if (rel[0] == '\0' && allow_root) {
+        snprintf(full, full_size, "%s", SD_PATH_ROOT);
+        return true;
+    }
+    if (!sd_path_is_safe(rel)) {
+        return false;
+    }
+    snprintf(full, full_size, SD_PATH_ROOT "%s", rel);
+    return true;
+}
+
+static void set_current(const char *verb, const char *path) {
+    const char *name = strrchr(path, '/');
+    snprintf(s_current, sizeof(s_current), "%s %s", verb, name != NULL ? name + 1 : path);
+    s_busy = true;
+    s_status_dirty = true;
+}
+
+// ============================================================================
+// 会话
+// ============================================================================
+
+static void end_session(void) {
+    if (s_session == SESSION_PUT) {
+        // 半个文件不留：链路不会中途断开，失败的上传由主机整个重来
+        ble_writer_close(BLE_WRITER_SLOT_FILE);
+        ble_writer_flush(UX_FLUSH_MS);
+        remove(s_part);
+    } else if (s_session == SESSION_GET && s_get_fp != NULL) {
+        fclose(s_get_fp);
+        s_get_fp = NULL;
+    }
+    if (s_session != SESSION_NONE) {
+        s_busy = false;
+        s_status_dirty = true;
+    }
+    s_session = SESSION_NONE;
+}
+
+static void finish_put(void) {
+    s_session = SESSION_NONE;
+    s_busy = false;
+    s_status_dirty = true;
+    if (s_crc != s_file_crc) {
+        ESP_LOGE(TAG, "CRC mismatch for %s", s_final);
+        ble_writer_close(BLE_WRITER_SLOT_FILE);
+        ble_writer_flush(UX_FLUSH_MS);
+        remove(s_part);
+        send_status(UX_OP_DATA, UX_ERR_CRC, s_size);
+        return;
+    }
+    const bool queued = ble_writer_commit(BLE_WRITER_SLOT_FILE, s_final);
+    const bool ok = queued && ble_writer_flush(UX_FLUSH_MS) && !ble_writer_take_error();
+    if (ok) {
+        file_browser_invalidate_cache();
+        s_files_in++;
+    } else {
+        remove(s_part);
+    }
+    send_status(UX_OP_DATA, ok ? UX_OK : UX_ERR_SD, s_size);
+}
+
+static void handle_put(const uint8_t *p, size_t len) {
+    end_session();
+    if (len < 9 || !get_path(p + 8, len - 8, s_final, sizeof(s_final), false)) {
+        send_status(UX_OP_PUT, UX_ERR_REQUEST, 0);
+        return;
+    }
+    s_size = get_le32(p);
+    s_file_crc = get_le32(p + 4);
+    snprintf(s_part, sizeof(s_part), "%s" SD_PATH_PART_SUFFIX, s_final);
+    sd_path_make_parents(s_final);
+    // 不续传，.part 可以按总长度预分配连续的簇
+    if (!ble_writer_open_reserved(BLE_WRITER_SLOT_FILE, s_part, s_size)) {
+        send_status(UX_OP_PUT, UX_ERR_SD, 0);
+        return;
+    }
+    s_session = SESSION_PUT;
+    s_crc = 0;
+    s_next = 0;
+    s_unacked = 0;
+    s_nak_sent = false;
+    set_current("Receiving", s_final);
+    send_status(UX_OP_PUT, UX_OK, 0);
+    if (s_size == 0) {
+        finish_put();
+    }
+}
+
+// 写入环形缓冲满时等写入任务腾出空间（SD 卡偶尔的长延迟）
+static bool queue_data(size_t n) {
+    for (uint32_t waited = 0; !ble_writer_write_begin(BLE_WRITER_SLOT_FILE, n); waited += 10) {
+        if (waited >= UX_RING_WAIT_MS || s_task_stop) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return true;
+}
+
+static void handle_put_data(const uint8_t *p, size_t len) {
+    if (s_session != SESSION_PUT || len < 4) {
+        return;
+    }
+    const uint32_t offset = get_le32(p);
+    if (offset < s_next) {
+        return;    // 重发窗口里已经收过的块
+    }
+    const size_t n = len - 4;
+    bool ok = offset == s_next && n > 0 && n <= USB_XFER_BLOCK && n <= s_size - s_next;
+    if (ok && !queue_data(n)) {
+        ok = false;
+    }
+    if (!ok) {
+        // 同一个缺口只发一次 NAK，之后在途的块全部丢弃，直到重发的块到达
+        if (!s_nak_sent) {
+            s_nak_sent = true;
+            send_ack(UX_NAK, s_next);
+        }
+        return;
+    }
+    ble_writer_append(p + 4, n);
+    s_crc = esp_rom_crc32_le(s_crc, p + 4, n);
+    s_next += (uint32_t)n;
+    s_nak_sent = false;
+
+    if (s_next == s_size) {
+        send_ack(UX_OK, s_next);
+        finish_put();
+    } else if (++s_unacked >= USB_XFER_ACK_EVERY) {
+        s_unacked = 0;
+        send_ack(UX_OK, s_next);
+    }
+}
+
+static void handle_get(const uint8_t *p, size_t len) {
+    end_session();
+    if (!get_path(p, len, s_final, sizeof(s_final), false)) {
+        send_status(UX_OP_GET, UX_ERR_REQUEST, 0);
+        return;
+    }
+    struct stat st;
+    s_get_fp = (stat(s_final, &st) == 0 && S_ISREG(st.st_mode)) ? fopen(s_final, "rb") : NULL;
+    if (s_get_fp == NULL) {
+        send_status(UX_OP_GET, UX_ERR_NOT_FOUND, 0);
+        return;
+    }
+    s_session = SESSION_GET;
+    s_size = (uint32_t)st.st_size;
+    s_next = 0;
+    s_acked = 0;
+    s_get_pos = 0;
+    s_last_ack = xTaskGetTickCount();
+    set_current("Sending", s_final);
+    send_status(UX_OP_GET, UX_OK, s_size);
+    if (s_size == 0) {
+        end_session();
+        s_files_out++;
+        send_status(UX_OP_DATA, UX_OK, 0);
+    }
+}
+
+static void handle_get_ack(const uint8_t *p, size_t len) {
+    if (s_session != SESSION_GET || len < 5) {
+        return;
+    }
+    const uint32_t offset = get_le32(p + 1);
+    if (offset > s_size || offset < s_acked) {
+        return;    // 过时或不合法的 ACK
+    }
+    if (offset > s_acked) {
+        s_acked = offset;
+        s_last_ack = xTaskGetTickCount();
+    }
+    if (s_next < s_acked) {
+        s_next = s_acked;    // 重发之前发出的块已经到达
+    }
+    if (p[0] == UX_NAK) {
+        s_next = s_acked;    // go-back-N
+    }
+    if (s_acked == s_size) {
+        end_session();
+        s_files_out++;
+        send_status(UX_OP_DATA, UX_OK, s_size);
+    }
+}
+
+// GET：窗口没满就继续发；超时没有新的 ACK 时从最近确认的偏移重发
+static void pump_get(void) {
+    if (s_session != SESSION_GET) {
+        return;
+    }
+    if (s_next > s_acked && xTaskGetTickCount() - s_last_ack > pdMS_TO_TICKS(UX_RESEND_MS)) {
+        s_next = s_acked;
+        s_last_ack = xTaskGetTickCount();
+    }
+    while (s_next < s_size && s_next - s_acked < USB_XFER_WINDOW * USB_XFER_BLOCK) {
+        const uint32_t n = s_size - s_next < USB_XFER_BLOCK ? s_size - s_next : USB_XFER_BLOCK;
+        uint8_t *payload = s_buf->tx + UX_HDR;
+        if ((s_get_pos != s_next && fseek(s_get_fp, (long)s_next, SEEK_SET) != 0) ||
+            fread(payload + 4, 1, n, s_get_fp) != n) {
+            ESP_LOGE(TAG, "Read of %s failed at %u", s_final, (unsigned)s_next);
+            end_session();
+            send_status(UX_OP_DATA, UX_ERR_SD, s_next);
+            return;
+        }
+        s_get_pos = s_next + n;
+        put_le32(payload, s_next);
+        if (!send_tx(UX_OP_DATA, 4 + n)) {
+            return;    // 主机没有在读：等 ACK 超时后重发
+        }
+        s_next += n;
+    }
+}
+
+static void handle_list(const uint8_t *p, size_t len) {
+    char dir_path[BLE_WRITER_PATH_MAX];
+    if (!get_path(p, len, dir_path, sizeof(dir_path), true)) {
+        send_status(UX_OP_LIST, UX_ERR_REQUEST, 0);
+        return;
+    }
+    DIR *dir = opendir(dir_path);
+    if (dir == NULL) {
+        send_status(UX_OP_LIST, UX_ERR_NOT_FOUND, 0);
+        return;
+    }
+    const size_t dir_len = strlen(dir_path);
+    uint32_t count = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (ent->d_name[0] == '.') {
+            continue;    // 隐藏目录（缓存）不列出
+        }
+        const size_t name_len = strnlen(ent->d_name, UX_PAYLOAD_MAX - 5);
+        snprintf(s_buf->path, sizeof(s_buf->path), "%s%s%s", dir_path,
+                 dir_path[dir_len - 1] == '/' ? "" : "/", ent->d_name);
+        struct stat st;
+        const bool is_dir = ent->d_type == DT_DIR;
+        const uint32_t size = (!is_dir && stat(s_buf->path, &st) == 0) ? (uint32_t)st.st_size : 0;
+        uint8_t *payload = s_buf->tx + UX_HDR;
+        put_le32(payload, size);
+        payload[4] = is_dir ? 1 : 0;
+        memcpy(payload + 5, ent->d_name, name_len);
+        if (!send_tx(UX_RE_ENTRY, 5 + name_len)) {
+            break;
+        }
+        count++;
+    }
+    closedir(dir);
+    send_status(UX_OP_LIST, UX_OK, count);
+}
+
+static void handle_del(const uint8_t *p, size_t len) {
+    end_session();
+    if (!get_path(p, len, s_final, sizeof(s_final), false)) {
+        send_status(UX_OP_DEL, UX_ERR_REQUEST, 0);
+        return;
+    }
+    struct stat st;
+    ux_status_t status = UX_ERR_NOT_FOUND;
+    if (stat(s_final, &st) == 0) {
+        const int rc = S_ISDIR(st.st_mode) ? rmdir(s_final) : remove(s_final);
+        status = rc == 0 ? UX_OK : UX_ERR_SD;
+    }
+    if (status == UX_OK) {
+        file_browser_invalidate_cache();
+    }
+    send_status(UX_OP_DEL, status, 0);
+}
+
+static void handle_frame(uint8_t type, const uint8_t *p, size_t len) {
+    switch (type) {
+    case UX_OP_HELLO: {
+        end_session();
+        const uint8_t msg[4] = { USB_XFER_PROTO_VERSION, USB_XFER_WINDOW,
+                                 (uint8_t)USB_XFER_BLOCK, (uint8_t)(USB_XFER_BLOCK >> 8) };
+        send_frame(UX_RE_HELLO, msg, sizeof(msg));
+        break;
+    }
+    case UX_OP_LIST:
+        handle_list(p, len);
+        break;
+    case UX_OP_PUT:
+        handle_put(p, len);
+        break;
+    case UX_OP_GET:
+        handle_get(p, len);
+        break;
+    case UX_OP_DEL:
+        handle_del(p, len);
+        break;
+    case UX_OP_ABORT:
+        end_session();
+        send_status(UX_OP_ABORT, UX_OK, 0);
+        break;
+    case UX_OP_DATA:
+        handle_put_data(p, len);
+        break;
+    case UX_OP_ACK:
+        handle_get_ack(p, len);
+        break;
+    default:
+        send_status(type, UX_ERR_REQUEST, 0);
+        break;
+    }
+}
+
+// 从接收缓冲区里取出所有完整的帧；魔数、长度或 CRC 不对时丢弃一个字节重新同步。
+// 损坏的 DATA 帧就此消失，接收方在下一块的偏移上发现缺口
+static void parse_frames(void) {
+    uint8_t *rx = s_buf->rx;
+    size_t pos = 0;
+    while (s_rx_fill - pos >= UX_HDR) {
+        const uint8_t *f = rx + pos;
+        if (f[0] != 'X') {
+            const uint8_t *next = memchr(f + 1, 'X', s_rx_fill - pos - 1);
+            pos = next != NULL ? (size_t)(next - rx) : s_rx_fill;
+            continue;
+        }
+        const size_t len = f[4] | ((size_t)f[5] << 8);
+        if (f[1] != '4' || len > UX_PAYLOAD_MAX) {
+            pos++;
+            continue;
+        }
+        const size_t total = UX_HDR + len + UX_CRC;
+        if (s_rx_fill - pos < total) {
+            break;
+        }
+        if (esp_rom_crc32_le(0, f + 2, UX_HDR - 2 + len) != get_le32(f + UX_HDR + len)) {
+            pos++;
+            continue;
+        }
+        handle_frame(f[2], f + UX_HDR, len);
+        pos += total;
+    }
+    memmove(rx, rx + pos, s_rx_fill - pos);
+    s_rx_fill -= pos;
+}
+
+static void usb_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("usb_xfer", UX_TASK_STACK);
+    s_rx_fill = 0;
+    s_last_rx = xTaskGetTickCount();
+    while (!s_task_stop) {
+        // GET 的窗口还能发时不等数据，只取已经到达的 ACK
+        const bool sending = s_session == SESSION_GET && s_next < s_size &&
+                             s_next - s_acked < USB_XFER_WINDOW * USB_XFER_BLOCK;
+        const int n = usb_serial_jtag_read_bytes(s_buf->rx + s_rx_fill, UX_FRAME_MAX - s_rx_fill,
+                                                 sending ? 0 : pdMS_TO_TICKS(UX_READ_WAIT_MS));
+        const TickType_t now = xTaskGetTickCount();
+        if (n > 0) {
+            s_rx_fill += (size_t)n;
+            s_last_rx = now;
+            parse_frames();
+        }
+        pump_get();
+        if (s_session != SESSION_NONE && now - s_last_rx > pdMS_TO_TICKS(UX_SESSION_IDLE_MS)) {
+            end_session();
+        }
+    }
+    end_session();
+    stack_stats_task_exit();
+    s_task_running = false;
+    vTaskDelete(NULL);
+}
+
+// ============================================================================
+// 专用屏幕与调度
+// ============================================================================
+
+static void show_status(const char *text) {
+    lv_label_set_text(s_status, text);
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh();
+}
+
+static void update_status(void) {
+    char text[128];
+    if (!s_driver_installed) {
+        return;
+    }
+    if (!s_connected) {
+        snprintf(text, sizeof(text), "Connect the USB cable and run\ntools/x4usb.py on the computer.");
+    } else {
+        snprintf(text, sizeof(text), "USB host connected\n\n%s\n\nReceived %u, sent %u files",
+                 s_busy ? s_current : "Idle", (unsigned)s_files_in, (unsigned)s_files_out);
+    }
+    s_status_tick = lv_tick_get();
+    show_status(text);
+}
+
+static void screen_key_event_cb(lv_event_t *e) {
+    if (lv_event_get_key(e) == LV_KEY_ESC) {
+        // 屏幕不能在自己的事件回调里删除，交给定时器
+        s_exit_requested = true;
+    }
+}
+
+static void create_screen(void) {
+    s_prev_screen = lv_screen_active();
+    s_indev = lv_indev_get_next(NULL);
+    s_prev_group = (s_indev != NULL) ? lv_indev_get_group(s_indev) : NULL;
+
+    s_screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(s_screen, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(s_screen, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(s_screen, 0, 0);
+    lv_obj_remove_flag(s_screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *title = lv_label_create(s_screen);
+    lv_label_set_text(title, "USB Transfer");
+    lv_obj_set_style_text_font(title, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(title, lv_color_black(), 0);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
+
+    s_status = lv_label_create(s_screen);
+    lv_obj_set_width(s_status, lv_pct(90));
+    lv_obj_set_style_text_font(s_status, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(s_status, lv_color_black(), 0);
+    lv_obj_set_style_text_align(s_status, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_align(s_status, LV_ALIGN_CENTER, 0, 0);
+
+    lv_obj_t *hint = lv_label_create(s_screen);
+    lv_label_set_text(hint, "Bluetooth and logging are off while transferring.\nPress Back to exit.");
+    lv_obj_set_style_text_font(hint, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(hint, lv_color_black(), 0);
+    lv_obj_set_style_text_align(hint, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -24);
+
+    lv_obj_add_event_cb(s_screen, screen_key_event_cb, LV_EVENT_KEY, NULL);
+    s_group = lv_group_create();
+    lv_group_add_obj(s_group, s_screen);
+    if (s_indev != NULL) {
+        lv_indev_set_group(s_indev, s_group);
+    }
+    lv_screen_load(s_screen);
+}
+
+static bool start_protocol(void) {
+    // BLE 没启动过时写入任务还不存在（流控回调由 BLE 启动时补上）
+    if (!ble_writer_init(NULL)) {
+        return false;
+    }
+    s_buf = malloc(sizeof(*s_buf));
+    if (s_buf == NULL) {
+        return false;
+    }
+    usb_serial_jtag_driver_config_t cfg = {
+        .tx_buffer_size = UX_DRIVER_TX_BUF,
+        .rx_buffer_size = UX_DRIVER_RX_BUF,
+    };
+    if (usb_serial_jtag_driver_install(&cfg) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to install USB Serial/JTAG driver");
+        free(s_buf);
+        s_buf = NULL;
+        return false;
+    }
+    s_driver_installed = true;
+    s_task_stop = false;
+    s_task_running = true;
+    if (xTaskCreate(usb_task, "usb_xfer", UX_TASK_STACK, NULL, UX_TASK_PRIO, &s_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create protocol task");
+        s_task_running = false;
+        return false;
+    }
+    ESP_LOGI(TAG, "Protocol running, logging paused until exit");
+    s_prev_vprintf = esp_log_set_vprintf(quiet_vprintf);
+    return true;
+}
+
+static void stop_protocol(void) {
+    if (s_task_running) {
+        s_task_stop = true;
+        for (uint32_t waited = 0; s_task_running && waited < UX_STOP_WAIT_MS; waited += 10) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+    s_task = NULL;
+    if (s_prev_vprintf != NULL) {
+        esp_log_set_vprintf(s_prev_vprintf);
+        s_prev_vprintf = NULL;
+    }
+    if (s_driver_installed && !s_task_running) {
+        usb_serial_jtag_driver_uninstall();
+        s_driver_installed = false;
+    }
+    if (!s_task_running) {
+        free(s_buf);
+        s_buf = NULL;
+    }
+    ESP_LOGI(TAG, "Received %u and sent %u files", (unsigned)s_files_in, (unsigned)s_files_out);
+}
+
+static void enter_mode(void) {
+    ESP_LOGI(TAG, "Entering USB transfer mode");
+    s_active = true;
+    s_exit_requested = false;
+    s_files_in = 0;
+    s_files_out = 0;
+    s_busy = false;
+    create_screen();
+    show_status("Stopping Bluetooth...");
+
+    s_ble_stopped = (s_cfg.ble_stop == NULL) || s_cfg.ble_stop();
+    if (!s_ble_stopped) {
+        show_status("Bluetooth is busy, try again later.");
+        return;
+    }
+    if (!start_protocol()) {
+        stop_protocol();
+        show_status("USB transfer failed to start.");
+        return;
+    }
+    s_connected = usb_serial_jtag_is_connected();
+    update_status();
+}
+
+static void exit_mode(void) {
+    ESP_LOGI(TAG, "Leaving USB transfer mode");
+    stop_protocol();
+    if (s_ble_stopped && s_cfg.ble_start != NULL) {
+        s_cfg.ble_start();
+    }
+    s_ble_stopped = false;
+
+    // 恢复原屏幕和按键分组，整屏全刷
+    if (s_indev != NULL) {
+        lv_indev_set_group(s_indev, s_prev_group);
+    }
+    if (s_prev_screen != NULL) {
+        lv_screen_load(s_prev_screen);
+    }
+    lv_obj_delete(s_screen);
+    lv_group_delete(s_group);
+    s_screen = NULL;
+    s_status = NULL;
+    s_group = NULL;
+    lvgl_reset_refresh_state();
+    lv_obj_invalidate(lv_screen_active());
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh_full();
+    power_manager_notify_activity();
+    s_active = false;
+}
+
+static void ux_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (s_enter_requested && !s_active) {
+        s_enter_requested = false;
+        enter_mode();
+        return;
+    }
+    if (!s_active) {
+        return;
+    }
+    if (s_exit_requested) {
+        s_exit_requested = false;
+        exit_mode();
+        return;
+    }
+    if (!s_driver_installed) {
+        return;
+    }
+    const bool connected = usb_serial_jtag_is_connected();
+    if (connected != s_connected) {
+        s_connected = connected;
+        s_status_dirty = true;
+    }
+    if (s_status_dirty && lv_tick_elaps(s_status_tick) >= UX_STATUS_MIN_MS) {
+        s_status_dirty = false;
+        update_status();
+    }
+}
+
+void usb_transfer_init(const usb_transfer_config_t *cfg) {
+    if (cfg != NULL) {
+        s_cfg = *cfg;
+    }
+    if (s_timer == NULL) {
+        s_timer = lv_timer_create(ux_timer_cb, UX_POLL_MS, NULL);
+    }
+}
+
+bool usb_transfer_request(void) {
+    if (s_timer == NULL || s_active || s_enter_requested || wifi_transfer_is_active()) {
+        return false;
+    }
+    s_enter_requested = true;
+    lvgl_timer_task_wake();
+    ESP_LOGI(TAG, "USB transfer mode requested");
+    return true;
+}
+
+bool usb_transfer_is_active(void) { return s_enter_requested || s_active; }
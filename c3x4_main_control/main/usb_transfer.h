@@ -0,0 +1,68 @@
+/**
+ * @file usb_transfer.h
+ * @brief USB 传输模式：通过芯片内置的 USB Serial/JTAG（CDC）批量读写 SD 卡文件
+ *
+ * USB 全速链路比 BLE 快一个数量级，同步整个书库不必再拔卡。进入模式时（与 Wi-Fi 传输模式相同）：
+ *   1. 切换到专用屏幕（显示主机连接状态与传输进度，返回键退出）
+ *   2. 关闭 NimBLE：接收的文件经 ble_writer.h 的异步写入任务写卡，它只允许一个生产者
+ *   3. 安装 USB Serial/JTAG 驱动，启动协议任务；日志在模式期间静默（次控制台同样走 USB，
+ *      会插进数据帧中间）
+ * 主机端脚本见 tools/x4usb.py
+ *
+ * 帧格式（两个方向相同，小端）：
+ *   'X' '4' | type u8 | 0 u8 | len u16 | payload[len] | crc32 u32
+ *   crc32 覆盖 type 到 payload 末尾（与 zlib.crc32 相同）；魔数不对或 CRC 错时丢弃一个字节重新同步
+ *
+ * 主机请求与设备回应：
+ *   HELLO 0x01 {}                         -> HELLO 0x81 {version u8, window u8, block u16}
+ *   LIST  0x02 {path}                     -> ENTRY 0x82 {size u32, dir u8, name}...，
+ *                                            最后 STATUS{LIST, 状态, 条目数}
+ *   PUT   0x03 {size u32, crc32 u32, path} -> STATUS{PUT, 状态, 0}，随后主机发 DATA
+ *   GET   0x04 {path}                     -> STATUS{GET, 状态, size}，随后设备发 DATA
+ *   DEL   0x05 {path}                     -> STATUS{DEL, 状态, 0}
+ *   ABORT 0x06 {}                         -> STATUS{ABORT, 0, 0}（放弃进行中的 PUT/GET）
+ *   DATA  0x10 {offset u32, data}           两个方向共用，data 最多 block 字节
+ *   ACK   0x11 {status u8, offset u32}      接收方的累计确认：offset 之前的数据都已收到
+ *   STATUS 0x80 {op u8, status u8, value u32}
+ *
+ * 数据方向都是滑动窗口 + go-back-N：发送方最多比最近一次 ACK 超前 window 块，
+ * 接收方按顺序收块、每 USB_XFER_ACK_EVERY 块回一次 ACK；偏移不连续或帧损坏时回
+ * 一次 NAK（status = 1，offset 为期待的偏移），发送方从那里重发；超时没有 ACK 时
+ * 发送方从最近确认的偏移重发。
+ * PUT 的数据写进 "<路径>.part"，收齐后比对整个文件的 CRC32、改名为正式文件，
+ * 设备回 STATUS{DATA, 状态, size}；GET 在主机确认全部数据后设备回 STATUS{DATA, 0, size}。
+ * 链路不像 BLE 会中途断开，失败的 PUT 直接删除 .part，不做续传
+ */
+
+#ifndef USB_TRANSFER_H
+#define USB_TRANSFER_H
+
+#include <stdbool.h>
+
+#define USB_XFER_PROTO_VERSION 1
+#define USB_XFER_BLOCK         2048     // DATA 帧的数据上限（SD 扇区的整数倍）
+#define USB_XFER_WINDOW        6        // 在途块数上限：6 x 2KB 不超过写入环形缓冲的 3/4
+#define USB_XFER_ACK_EVERY     2
+
+typedef struct {
+    bool (*ble_stop)(void);     // 关闭 BLE（LVGL 任务中调用），false 时放弃进入
+    void (*ble_start)(void);    // 退出时重新启动 BLE
+} usb_transfer_config_t;
+
+/**
+ * @brief 注册调度定时器（在 LVGL 初始化后调用）
+ */
+void usb_transfer_init(const usb_transfer_config_t *cfg);
+
+/**
+ * @brief 请求进入 USB 传输模式（任意任务中调用，不阻塞）
+ * @return false 未初始化、已在传输模式或 Wi-Fi 传输模式进行中
+ */
+bool usb_transfer_request(void);
+
+/**
+ * @brief 是否处于 USB 传输模式（含正在进入/退出）
+ */
+bool usb_transfer_is_active(void);
+
+#endif // USB_TRANSFER_H
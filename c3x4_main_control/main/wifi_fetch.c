@@ -0,0 +1,478 @@
+/**
+ * @file wifi_fetch.c
+ * @brief 内容服务器下载实现
+ *
+ * 每次下载一个文件，在专用任务中用 esp_http_client 顺序读取响应体并直接写卡；
+ * httpd 任务只负责提交，LVGL 任务在退出传输模式时停止。状态字段只用于显示，不加锁
+ */
+
+#include "wifi_fetch.h"
+#include "sd_path.h"
+#include "stack_stats.h"
+#include "ui/file_browser.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char *TAG = "WIFI_FETCH";
+
+#define FETCH_STATE_DIR     "/sdcard/.x4cache"
+#define FETCH_STATE_MAGIC   0x46463458u      // 'X4FF'
+#define FETCH_MOUNT_POINT   "/sdcard"
+#define FETCH_PATH_MAX      (sizeof(SD_PATH_ROOT) + SD_PATH_REL_MAX + sizeof(SD_PATH_PART_SUFFIX))
+#define FETCH_TASK_STACK    6144
+#define FETCH_TASK_PRIO     3
+#define FETCH_TIMEOUT_MS    10000            // 单次网络读写的超时
+#define FETCH_BACKOFF_MS    2000             // 第 n 次重试前等待 n 倍
+#define FETCH_STOP_WAIT_MS  (FETCH_TIMEOUT_MS + 2000)
+
+typedef enum {
+    FETCH_IDLE,
+    FETCH_RUNNING,
+    FETCH_DONE,
+    FETCH_FAILED,
+} fetch_phase_t;
+
+static const char *const phase_names[] = {"idle", "running", "done", "failed"};
+
+// 单次请求的结果
+typedef enum {
+    ATTEMPT_COMPLETE,    // 收齐了响应体
+    ATTEMPT_RETRY,       // 网络问题，可以续传
+    ATTEMPT_FATAL,       // 服务器拒绝、写卡失败或被停止，不再重试
+} attempt_t;
+
+// 续传记录：done 字节已 fsync 落盘，done_crc 是它们的 CRC32
+typedef struct {
+    uint32_t magic;
+    uint32_t size;           // 总长度，0 表示还不知道
+    uint32_t crc;            // 期望的整个文件的 CRC32
+    uint32_t done;
+    uint32_t done_crc;
+    char url[WIFI_FETCH_URL_MAX];
+    char path[SD_PATH_REL_MAX + 1];
+} fetch_state_t;
+
+static fetch_state_t s_job;
+static FILE *s_fp = NULL;
+static bool s_reserved = false;      // .part 已按 s_job.size 预分配
+static uint32_t s_checkpoint = 0;    // 上次写续传记录时的 done
+static uint8_t *s_buf = NULL;
+static char s_part[FETCH_PATH_MAX];
+static char s_final[FETCH_PATH_MAX];
+
+static volatile bool s_task_running = false;
+static volatile bool s_task_stop = false;
+static volatile fetch_phase_t s_phase = FETCH_IDLE;
+static volatile uint32_t s_retries = 0;
+
+static char s_completed[WIFI_FETCH_COMPLETED_MAX][FETCH_PATH_MAX];
+static int s_completed_count = 0;
+static portMUX_TYPE s_completed_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ============================================================================
+// 续传记录
+// ============================================================================
+
+static bool save_state(void) {
+    mkdir(FETCH_STATE_DIR, 0775);
+    FILE *fp = fopen(WIFI_FETCH_STATE_PATH, "wb");
+    if (fp == NULL) {
+        return false;
+    }
+    const bool ok = fwrite(&s_job, 1, sizeof(s_job), fp) == sizeof(s_job);
+    fclose(fp);
+    return ok;
+}
+
+static bool load_state(fetch_state_t *state) {
+    FILE *fp = fopen(WIFI_FETCH_STATE_PATH, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+    const bool ok = fread(state, 1, sizeof(*state), fp) == sizeof(*state) &&
+                    state->magic == FETCH_STATE_MAGIC;
+    fclose(fp);
+    state->url[sizeof(state->url) - 1] = '\0';
+    state->path[sizeof(state->path) - 1] = '\0';
+    return ok && sd_path_is_safe(state->path);
+}
+
+// 已写的数据落盘后再记下长度：断电时记录里的长度不会超过卡上真实的数据
+static bool checkpoint(void) {
+    if (fflush(s_fp) != 0 || fsync(fileno(s_fp)) != 0) {
+        return false;
+    }
+    s_checkpoint = s_job.done;
+    return save_state();
+}
+
+// ============================================================================
+// 写卡
+// ============================================================================
+
+static void close_part(void) {
+    if (s_fp != NULL) {
+        fclose(s_fp);
+        s_fp = NULL;
+    }
+}
+
+// 从 offset 开始写 .part；从头开始且知道总长度时先分配连续的簇
+static bool open_part(uint32_t offset, uint32_t reserve) {
+    close_part();
+    s_reserved = false;
+    if (offset == 0 && reserve > 0) {
+        remove(s_part);    // 目标不能已存在
+        const esp_err_t err = esp_vfs_fat_create_contiguous_file(FETCH_MOUNT_POINT, s_part, reserve, true);
+        if (err == ESP_OK) {
+            s_reserved = true;
+        } else {
+            ESP_LOGW(TAG, "No contiguous %u bytes for %s: %s", (unsigned)reserve, s_part, esp_err_to_name(err));
+        }
+    }
+    s_fp = fopen(s_part, offset > 0 || s_reserved ? "r+b" : "wb");
+    if (s_fp != NULL && fseek(s_fp, (long)offset, SEEK_SET) != 0) {
+        close_part();
+    }
+    if (s_fp == NULL) {
+        ESP_LOGE(TAG, "Failed to open %s at %u", s_part, (unsigned)offset);
+        return false;
+    }
+    // 每次都是整块写入，不需要 stdio 再缓冲一次
+    setvbuf(s_fp, NULL, _IONBF, 0);
+    return true;
+}
+
+// 丢掉已有的数据从头开始（服务器不支持 Range，或文件在服务器上变了）
+static bool restart_part(uint32_t size) {
+    s_job.size = size;
+    s_job.done = 0;
+    s_job.done_crc = 0;
+    s_checkpoint = 0;
+    return open_part(0, size) && save_state();
+}
+
+static bool write_chunk(const uint8_t *data, size_t n) {
+    if (fwrite(data, 1, n, s_fp) != n) {
+        return false;
+    }
+    s_job.done_crc = esp_rom_crc32_le(s_job.done_crc, data, n);
+    s_job.done += (uint32_t)n;
+    return s_job.done - s_checkpoint < WIFI_FETCH_CHECKPOINT || checkpoint();
+}
+
+// ============================================================================
+// HTTP
+// ============================================================================
+
+// Content-Range: bytes <first>-<last>/<total>
+static bool parse_content_range(const char *value, uint32_t *first, uint32_t *total) {
+    unsigned long a = 0, b = 0, t = 0;
+    if (value == NULL || sscanf(value, "bytes %lu-%lu/%lu", &a, &b, &t) != 3 || b < a || t <= b) {
+        return false;
+    }
+    *first = (uint32_t)a;
+    *total = (uint32_t)t;
+    return true;
+}
+
+// 处理响应头：决定从哪里接着写，必要时预分配或从头开始。ATTEMPT_COMPLETE 表示可以读响应体
+static attempt_t accept_response(esp_http_client_handle_t client, int64_t content_length) {
+    const int status = esp_http_client_get_status_code(client);
+    if (status == 206) {
+        char *range = NULL;
+        uint32_t first = 0, total = 0;
+        if (esp_http_client_get_header(client, "Content-Range", &range) != ESP_OK ||
+            !parse_content_range(range, &first, &total) || first != s_job.done) {
+            ESP_LOGE(TAG, "Bad Content-Range for offset %u", (unsigned)s_job.done);
+            return ATTEMPT_FATAL;
+        }
+        if (s_job.size != 0 && total != s_job.size) {
+            // 服务器上的文件换了：丢掉已下载的部分，下一次请求从头开始
+            ESP_LOGW(TAG, "Size changed on server (%u -> %u), restarting", (unsigned)s_job.size, (unsigned)total);
+            return restart_part(0) ? ATTEMPT_RETRY : ATTEMPT_FATAL;
+        }
+        s_job.size = total;
+        return ATTEMPT_COMPLETE;
+    }
+    if (status == 200) {
+        const uint32_t size = content_length > 0 ? (uint32_t)content_length : 0;
+        if (s_job.done > 0) {
+            ESP_LOGW(TAG, "Server ignored Range, restarting from 0");
+        }
+        return restart_part(size) ? ATTEMPT_COMPLETE : ATTEMPT_FATAL;
+    }
+    if (status == 416 && s_job.size != 0 && s_job.done == s_job.size) {
+        return ATTEMPT_COMPLETE;    // 上次已经收齐，只差校验和改名
+    }
+    ESP_LOGE(TAG, "HTTP %d for %s", status, s_job.url);
+    return status >= 500 ? ATTEMPT_RETRY : ATTEMPT_FATAL;
+}
+
+// 一次 GET（有已落盘的数据时带 Range），把响应体写进 .part
+static attempt_t fetch_once(void) {
+    const esp_http_client_config_t cfg = {
+        .url = s_job.url,
+        .timeout_ms = FETCH_TIMEOUT_MS,
+        .buffer_size = 1024,
+        .buffer_size_tx = 512,
+    };
+    esp_http_client_handle_t client = esp_http_client_init(&cfg);
+    if (client == NULL) {
+        return ATTEMPT_RETRY;
+    }
+    char range[32];
+    if (s_job.done > 0) {
+        snprintf(range, sizeof(range), "bytes=%u-", (unsigned)s_job.done);
+        esp_http_client_set_header(client, "Range", range);
+    }
+
+    if (esp_http_client_open(client, 0) != ESP_OK) {
+        ESP_LOGW(TAG, "Connect failed at %u", (unsigned)s_job.done);
+        esp_http_client_cleanup(client);
+        return ATTEMPT_RETRY;
+    }
+    // 分块传输的响应没有长度（同样返回负数）
+    const int64_t content_length = esp_http_client_fetch_headers(client);
+    if (content_length < 0 && !esp_http_client_is_chunked_response(client)) {
+        esp_http_client_cleanup(client);
+        return ATTEMPT_RETRY;
+    }
+    const uint32_t start = s_job.done;
+    attempt_t result = accept_response(client, content_length);
+    if (result == ATTEMPT_COMPLETE && (s_job.size == 0 || s_job.done < s_job.size)) {
+        result = ATTEMPT_RETRY;
+        while (!s_task_stop) {
+            const int n = esp_http_client_read(client, (char *)s_buf, WIFI_FETCH_CHUNK);
+            if (n < 0) {
+                break;
+            }
+            if (n == 0) {
+                if (esp_http_client_is_complete_data_received(client)) {
+                    result = ATTEMPT_COMPLETE;
+                }
+                break;
+            }
+            if (!write_chunk(s_buf, (size_t)n)) {
+                ESP_LOGE(TAG, "SD write failed at %u", (unsigned)s_job.done);
+                result = ATTEMPT_FATAL;
+                break;
+            }
+        }
+    }
+    if (s_task_stop) {
+        result = ATTEMPT_FATAL;
+    }
+    // 有进展就重新计算重试次数：慢而不稳的网络也能下完
+    if (s_job.done > start) {
+        s_retries = 0;
+    }
+    esp_http_client_cleanup(client);
+    return result;
+}
+
+// ============================================================================
+// 下载任务
+// ============================================================================
+
+static void push_completed(void) {
+    portENTER_CRITICAL(&s_completed_lock);
+    if (s_completed_count < WIFI_FETCH_COMPLETED_MAX) {
+        strcpy(s_completed[s_completed_count++], s_final);
+    }
+    portEXIT_CRITICAL(&s_completed_lock);
+}
+
+// 校验长度与 CRC，通过后改名为正式文件
+static bool finish_file(void) {
+    if (s_job.size != 0 && s_job.done != s_job.size) {
+        ESP_LOGE(TAG, "%s: got %u of %u bytes", s_final, (unsigned)s_job.done, (unsigned)s_job.size);
+        return false;
+    }
+    // 预分配的长度与服务器实际给出的不同时截到实际长度
+    if (fflush(s_fp) != 0 || (s_reserved && ftruncate(fileno(s_fp), (off_t)s_job.done) != 0)) {
+        return false;
+    }
+    close_part();
+    if (s_job.done_crc != s_job.crc) {
+        ESP_LOGE(TAG, "CRC mismatch for %s (%08x, expected %08x)", s_final,
+                 (unsigned)s_job.done_crc, (unsigned)s_job.crc);
+        return false;
+    }
+    // FAT 上 rename 的目标不能已存在
+    remove(s_final);
+    if (rename(s_part, s_final) != 0) {
+        return false;
+    }
+    file_browser_invalidate_cache();
+    push_completed();
+    ESP_LOGI(TAG, "Downloaded %s (%u bytes)", s_final, (unsigned)s_job.done);
+    return true;
+}
+
+static void fetch_task(void *arg) {
+    (void)arg;
+    stack_stats_register_self("wifi_fetch", FETCH_TASK_STACK);
+
+    // 续传：记录里的长度已落盘，之后可能不完整的尾部由新数据覆盖
+    struct stat st;
+    bool ok = s_job.done > 0 && stat(s_part, &st) == 0 && (uint32_t)st.st_size >= s_job.done
+                  ? open_part(s_job.done, 0)
+                  : restart_part(0);
+    attempt_t result = ok ? ATTEMPT_RETRY : ATTEMPT_FATAL;
+    if (ok && s_job.done > 0) {
+        ESP_LOGI(TAG, "Resuming %s at %u", s_final, (unsigned)s_job.done);
+    }
+    while (result == ATTEMPT_RETRY && !s_task_stop) {
+        result = fetch_once();
+        if (result != ATTEMPT_RETRY) {
+            break;
+        }
+        if (++s_retries > WIFI_FETCH_RETRIES) {
+            break;
+        }
+        for (uint32_t waited = 0; waited < FETCH_BACKOFF_MS * s_retries && !s_task_stop; waited += 100) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+    }
+
+    if (s_task_stop) {
+        // 退出传输模式：已写的数据落盘，下次进入时续传
+        if (s_fp != NULL && !checkpoint()) {
+            ESP_LOGW(TAG, "Failed to save resume point for %s", s_final);
+        }
+        close_part();
+        s_phase = FETCH_IDLE;
+        ESP_LOGI(TAG, "Stopped %s at %u, kept for resume", s_final, (unsigned)s_job.done);
+    } else if (result == ATTEMPT_COMPLETE && finish_file()) {
+        remove(WIFI_FETCH_STATE_PATH);
+        s_phase = FETCH_DONE;
+    } else if (result == ATTEMPT_RETRY) {
+        // 网络一直不通：保留已下载的部分，下次再续传
+        if (s_fp != NULL) {
+            checkpoint();
+        }
+        close_part();
+        s_phase = FETCH_FAILED;
+        ESP_LOGE(TAG, "Giving up on %s at %u after %u retries", s_final, (unsigned)s_job.done,
+                 (unsigned)WIFI_FETCH_RETRIES);
+    } else {
+        close_part();
+        remove(s_part);
+        remove(WIFI_FETCH_STATE_PATH);
+        s_phase = FETCH_FAILED;
+    }
+
+    free(s_buf);
+    s_buf = NULL;
+    stack_stats_task_exit();
+    s_task_running = false;
+    vTaskDelete(NULL);
+}
+
+static bool start_task(void) {
+    snprintf(s_final, sizeof(s_final), SD_PATH_ROOT "%s", s_job.path);
+    snprintf(s_part, sizeof(s_part), "%s" SD_PATH_PART_SUFFIX, s_final);
+    sd_path_make_parents(s_final);
+    s_buf = (uint8_t *)malloc(WIFI_FETCH_CHUNK);
+    if (s_buf == NULL) {
+        return false;
+    }
+    s_task_stop = false;
+    s_task_running = true;
+    s_retries = 0;
+    s_phase = FETCH_RUNNING;
+    if (xTaskCreate(fetch_task, "wifi_fetch", FETCH_TASK_STACK, NULL, FETCH_TASK_PRIO, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create download task");
+        free(s_buf);
+        s_buf = NULL;
+        s_task_running = false;
+        s_phase = FETCH_FAILED;
+        return false;
+    }
+    return true;
+}
+
+bool wifi_fetch_start(const char *url, const char *rel_path, uint32_t crc) {
+    if (s_task_running || url == NULL || strncmp(url, "http://", 7) != 0 ||
+        strlen(url) >= WIFI_FETCH_URL_MAX || !sd_path_is_safe(rel_path)) {
+        return false;
+    }
+    // 同一个文件（URL、路径、CRC 都相同）上次没下完时接着下
+    fetch_state_t state;
+    if (load_state(&state) && state.crc == crc && strcmp(state.url, url) == 0 &&
+        strcmp(state.path, rel_path) == 0) {
+        s_job = state;
+    } else {
+        memset(&s_job, 0, sizeof(s_job));
+        s_job.magic = FETCH_STATE_MAGIC;
+        s_job.crc = crc;
+        strncpy(s_job.url, url, sizeof(s_job.url) - 1);
+        strncpy(s_job.path, rel_path, sizeof(s_job.path) - 1);
+    }
+    ESP_LOGI(TAG, "Fetching %s -> %s", url, rel_path);
+    return start_task();
+}
+
+bool wifi_fetch_resume_pending(void) {
+    fetch_state_t state;
+    if (s_task_running || !load_state(&state)) {
+        return false;
+    }
+    s_job = state;
+    ESP_LOGI(TAG, "Resuming pending download of %s", s_job.path);
+    return start_task();
+}
+
+void wifi_fetch_stop(void) {
+    if (!s_task_running) {
+        return;
+    }
+    s_task_stop = true;
+    // 下载任务可能正阻塞在网络读取里，最多等一个超时
+    for (uint32_t waited = 0; s_task_running && waited < FETCH_STOP_WAIT_MS; waited += 10) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (s_task_running) {
+        ESP_LOGW(TAG, "Download task did not stop in time");
+    }
+}
+
+size_t wifi_fetch_format_json(char *buf, size_t len) {
+    // 路径里的引号和反斜杠转义，其它字符由 sd_path_is_safe 保证可以直接输出
+    char path[2 * SD_PATH_REL_MAX + 1];
+    size_t n = 0;
+    for (const char *p = s_job.path; *p != '\0' && n < sizeof(path) - 2; p++) {
+        if (*p == '"' || *p == '\\') {
+            path[n++] = '\\';
+        }
+        path[n++] = *p;
+    }
+    path[n] = '\0';
+    const int written = snprintf(buf, len, "{\"state\":\"%s\",\"path\":\"%s\",\"done\":%u,\"size\":%u,\"retries\":%u}",
+                                 phase_names[s_phase], path, (unsigned)s_job.done, (unsigned)s_job.size,
+                                 (unsigned)s_retries);
+    return written < 0 ? 0 : ((size_t)written < len ? (size_t)written : len - 1);
+}
+
+bool wifi_fetch_take_completed(char *path, size_t size) {
+    bool taken = false;
+    portENTER_CRITICAL(&s_completed_lock);
+    if (s_completed_count > 0) {
+        s_completed_count--;
+        strncpy(path, s_completed[s_completed_count], size - 1);
+        path[size - 1] = '\0';
+        taken = true;
+    }
+    portEXIT_CRITICAL(&s_completed_lock);
+    return taken;
+}
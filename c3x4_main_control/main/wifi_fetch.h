@@ -0,0 +1,64 @@
+/**
+ * @file wifi_fetch.h
+ * @brief Wi-Fi 传输模式下从内容服务器拉取文件：HTTP GET 直接流式写入 SD 卡，断线后按 Range 续传
+ *
+ * 网页（或其它客户端）通过 POST /api/fetch 给出 URL、卡上的相对路径和整个文件的 CRC32，
+ * 设备自己去下载：
+ *   - 响应体每收满 WIFI_FETCH_CHUNK 字节直接写进 <路径>.part，不在内存里攒整个文件
+ *   - 从头下载且服务器给出长度时，.part 先按总长度分配连续的簇
+ *   - 每写入 WIFI_FETCH_CHECKPOINT 字节 fsync 一次，并把已落盘的长度和 CRC 记进续传记录；
+ *     预分配后 .part 的长度不代表已写入的数据，续传只相信这条记录
+ *   - 连接中断时用 Range: bytes=<已落盘>- 重试，服务器不支持 Range（回 200）时从头开始
+ *   - 收齐后校验长度与 CRC32，通过才改名为正式文件；校验失败删除 .part
+ * 退出传输模式时下载停下，.part 与续传记录保留，下次进入传输模式、连上网络后自动继续。
+ * 下载完成的书由 wifi_transfer 在退出传输模式、Wi-Fi 释放内存之后登记进书库
+ */
+
+#ifndef WIFI_FETCH_H
+#define WIFI_FETCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define WIFI_FETCH_URL_MAX        256
+#define WIFI_FETCH_CHUNK          4096              // 每次写卡的块（FAT 簇 / SD 扇区对齐）
+#define WIFI_FETCH_CHECKPOINT     (256 * 1024)      // 更新续传记录的间隔
+#define WIFI_FETCH_RETRIES        8                 // 连续失败多少次后放弃（有进展时重新计数）
+#define WIFI_FETCH_COMPLETED_MAX  8                 // 等待登记进书库的文件数
+#define WIFI_FETCH_STATE_PATH     "/sdcard/.x4cache/fetch.bin"
+
+/**
+ * @brief 开始下载（任意任务中调用，不阻塞）
+ * @param url http:// 地址
+ * @param rel_path 相对于 /sdcard 的目标路径（已通过 sd_path_is_safe 检查）
+ * @param crc 整个文件的 CRC32（与 esp_rom_crc32_le(0, ...) 相同）
+ * @return false 已有下载在进行、参数不合法或无法创建下载任务
+ */
+bool wifi_fetch_start(const char *url, const char *rel_path, uint32_t crc);
+
+/**
+ * @brief 卡上留有上次没下完的文件时继续下载（网络连上后调用）
+ * @return true 已开始
+ */
+bool wifi_fetch_resume_pending(void);
+
+/**
+ * @brief 停止下载并等待下载任务退出，.part 与续传记录保留（LVGL 任务中调用）
+ */
+void wifi_fetch_stop(void);
+
+/**
+ * @brief 下载状态 JSON：{"state":..,"path":..,"done":..,"size":..,"retries":..}
+ * @return 写入的长度
+ */
+size_t wifi_fetch_format_json(char *buf, size_t len);
+
+/**
+ * @brief 取出一个已下载完成的文件（超出 WIFI_FETCH_COMPLETED_MAX 的不记录，由书库的下一次扫描发现）
+ * @param path 输出完整路径
+ * @return false 没有了
+ */
+bool wifi_fetch_take_completed(char *path, size_t size);
+
+#endif // WIFI_FETCH_H
@@ -0,0 +1,796 @@
+/**
+ * @file wifi_transfer.c
+ * @brief Wi-Fi 传输模式实现
+ *
+ * 进入和退出都在 LVGL 任务中执行（创建/删除屏幕、关闭 BLE 会阻塞一小段时间），
+ * 外部请求和返回键只设置标志，由 LVGL 定时器回调取走。Wi-Fi 事件在默认事件循环中
+ * 到达，只记录状态并唤醒 LVGL 任务；HTTP 请求在 httpd 任务中直接读写 SD 卡
+ */
+
+#include "wifi_transfer.h"
+#include "wifi_fetch.h"
+#include "usb_transfer.h"
+#include "sd_path.h"
+#include "boot_profile.h"
+#include "sd_health.h"
+#include "heap_stats.h"
+#include "lvgl_mem_pool.h"
+#include "turn_stats.h"
+#include "stack_stats.h"
+#include "trace.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "ui/file_browser.h"
+#include "ui/library_db.h"
+#include "ui/epub_prefetch.h"
+#include "esp_event.h"
+#include "esp_heap_caps.h"
+#include "esp_http_server.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "esp_netif.h"
+#include "esp_wifi.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "WIFI_XFER";
+
+#define WT_POLL_MS           200
+#define WT_IO_BUF            4096
+#define WT_ENTRY_PATH_MAX    512
+#define WT_HTTPD_STACK       6144       // 大的缓冲区都放在堆上，实际占用见 stack_stats
+#define WT_RECV_RETRIES      5          // 接收超时的重试次数（每次 recv_wait_timeout 秒）
+#define WT_DEFAULT_SSID      "foxwifi-plus"
+#define WT_DEFAULT_PASSWORD  "epdc1984"
+#define WT_INDEX_PATH        WIFI_TRANSFER_WEB_ROOT "/index.html"
+
+static wifi_transfer_config_t s_cfg;
+static lv_timer_t *s_timer = NULL;
+static volatile bool s_enter_requested = false;
+static volatile bool s_exit_requested = false;
+static bool s_active = false;
+static bool s_ble_stopped = false;
+
+// Wi-Fi 状态（事件循环任务写，LVGL 任务读）
+static volatile uint32_t s_ip = 0;
+static volatile bool s_status_dirty = false;
+static bool s_wifi_started = false;
+static esp_netif_t *s_netif = NULL;
+static esp_event_handler_instance_t s_wifi_handler = NULL;
+static esp_event_handler_instance_t s_ip_handler = NULL;
+static httpd_handle_t s_server = NULL;
+static char s_ssid[33];
+
+// 专用屏幕
+static lv_obj_t *s_screen = NULL;
+static lv_obj_t *s_status = NULL;
+static lv_obj_t *s_prev_screen = NULL;
+static lv_group_t *s_group = NULL;
+static lv_group_t *s_prev_group = NULL;
+static lv_indev_t *s_indev = NULL;
+
+// ============================================================================
+// HTTP 服务器
+// ============================================================================
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// 原地解码 URL 编码（%XX 与 '+'）
+static void url_decode(char *s) {
+    char *out = s;
+    for (char *p = s; *p != '\0'; p++) {
+        if (*p == '%' && hex_value(p[1]) >= 0 && hex_value(p[2]) >= 0) {
+            *out++ = (char)(hex_value(p[1]) * 16 + hex_value(p[2]));
+            p += 2;
+        } else {
+            *out++ = (*p == '+') ? ' ' : *p;
+        }
+    }
+    *out = '\0';
+}
+
+static bool get_query_arg(httpd_req_t *req, const char *key, char *val, size_t val_size) {
+    const size_t len = httpd_req_get_url_query_len(req);
+    if (len == 0) {
+        return false;
+    }
+    char *query = (char *)malloc(len + 1);
+    if (query == NULL) {
+        return false;
+    }
+    bool ok = httpd_req_get_url_query_str(req, query, len + 1) == ESP_OK &&
+              httpd_query_key_value(query, key, val, val_size) == ESP_OK;
+    free(query);
+    if (ok) {
+        url_decode(val);
+    }
+    return ok;
+}
+
+// 取 path 参数并拼成绝对路径；allow_root 时空路径表示 /sdcard 本身（目录列表用）
+static bool get_path_arg(httpd_req_t *req, char *full, size_t full_size, bool allow_root) {
+    char rel[SD_PATH_REL_MAX + 1] = {0};
+    if (!get_query_arg(req, "path", rel, sizeof(rel))) {
+        rel[0] = '\0';
+    }
+    if (rel[0] == '\0' && allow_root) {
+        snprintf(full, full_size, "%s", SD_PATH_ROOT);
+        return true;
+    }
+    if (!sd_path_is_safe(rel)) {
+        return false;
+    }
+    snprintf(full, full_size, SD_PATH_ROOT "%s", rel);
+    return true;
+}
+
+static esp_err_t send_file(httpd_req_t *req, const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found");
+    }
+    char *buf = (char *)malloc(WT_IO_BUF);
+    if (buf == NULL) {
+        fclose(fp);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+    esp_err_t err = ESP_OK;
+    size_t n;
+    while ((n = fread(buf, 1, WT_IO_BUF, fp)) > 0) {
+        err = httpd_resp_send_chunk(req, buf, n);
+        if (err != ESP_OK) {
+            break;
+        }
+    }
+    free(buf);
+    fclose(fp);
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
+
+static esp_err_t index_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "text/html");
+    return send_file(req, WT_INDEX_PATH);
+}
+
+// 写 JSON 字符串（转义引号、反斜杠和控制字符）
+static esp_err_t send_json_string(httpd_req_t *req, const char *s) {
+    char buf[96];
+    size_t n = 0;
+    buf[n++] = '"';
+    for (; *s != '\0'; s++) {
+        if (n > sizeof(buf) - 8) {
+            if (httpd_resp_send_chunk(req, buf, n) != ESP_OK) {
+                return ESP_FAIL;
+            }
+            n = 0;
+        }
+        const unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            buf[n++] = '\\';
+            buf[n++] = (char)c;
+        } else if (c < 0x20) {
+            n += (size_t)snprintf(buf + n, sizeof(buf) - n, "\\u%04x", c);
+        } else {
+            buf[n++] = (char)c;
+        }
+    }
+    buf[n++] = '"';
+    return httpd_resp_send_chunk(req, buf, n);
+}
+
+static esp_err_t list_handler(httpd_req_t *req) {
+    char dir_path[256];
+    if (!get_path_arg(req, dir_path, sizeof(dir_path), true)) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad path");
+    }
+    DIR *dir = opendir(dir_path);
+    if (dir == NULL) {
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found");
+    }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr_chunk(req, "[");
+
+    const size_t dir_len = strlen(dir_path);
+    // stat 经过 FATFS 时栈较深，路径缓冲区放在堆上
+    char *entry_path = malloc(WT_ENTRY_PATH_MAX);
+    if (entry_path == NULL) {
+        closedir(dir);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+    bool first = true;
+    struct dirent *ent;
+    esp_err_t err = ESP_OK;
+    while (err == ESP_OK && (ent = readdir(dir)) != NULL) {
+        if (ent->d_name[0] == '.') {
+            continue;    // 隐藏目录（缓存）不列出
+        }
+        snprintf(entry_path, WT_ENTRY_PATH_MAX, "%s%s%s", dir_path,
+                 dir_path[dir_len - 1] == '/' ? "" : "/", ent->d_name);
+        struct stat st;
+        const bool is_dir = ent->d_type == DT_DIR;
+        const long size = (!is_dir && stat(entry_path, &st) == 0) ? (long)st.st_size : 0;
+
+        char tail[48];
+        snprintf(tail, sizeof(tail), ",\"size\":%ld,\"dir\":%s}", size, is_dir ? "true" : "false");
+        err = httpd_resp_sendstr_chunk(req, first ? "{\"name\":" : ",{\"name\":");
+        if (err == ESP_OK) err = send_json_string(req, ent->d_name);
+        if (err == ESP_OK) err = httpd_resp_sendstr_chunk(req, tail);
+        first = false;
+    }
+    closedir(dir);
+    free(entry_path);
+    if (err == ESP_OK) {
+        httpd_resp_sendstr_chunk(req, "]");
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
+
+static esp_err_t download_handler(httpd_req_t *req) {
+    char path[256];
+    if (!get_path_arg(req, path, sizeof(path), false)) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad path");
+    }
+    httpd_resp_set_type(req, "application/octet-stream");
+    return send_file(req, path);
+}
+
+// 上传：请求体直接写进 <路径>.part，收齐 Content-Length 字节后改名
+static esp_err_t upload_handler(httpd_req_t *req) {
+    char path[256];
+    char part[256 + sizeof(SD_PATH_PART_SUFFIX)];
+    if (!get_path_arg(req, path, sizeof(path), false)) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad path");
+    }
+    snprintf(part, sizeof(part), "%s" SD_PATH_PART_SUFFIX, path);
+    sd_path_make_parents(path);
+
+    char *buf = (char *)malloc(WT_IO_BUF);
+    FILE *fp = (buf != NULL) ? fopen(part, "wb") : NULL;
+    if (fp == NULL) {
+        free(buf);
+        ESP_LOGE(TAG, "Failed to open %s", part);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Cannot create file");
+    }
+    // 每次都是整块写入，不需要 stdio 再缓冲一次
+    setvbuf(fp, NULL, _IONBF, 0);
+
+    size_t remaining = req->content_len;
+    int retries = 0;
+    bool ok = true;
+    while (remaining > 0) {
+        const int n = httpd_req_recv(req, buf, remaining < WT_IO_BUF ? remaining : WT_IO_BUF);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT && ++retries <= WT_RECV_RETRIES) {
+            continue;
+        }
+        if (n <= 0 || fwrite(buf, 1, (size_t)n, fp) != (size_t)n) {
+            ok = false;
+            break;
+        }
+        retries = 0;
+        remaining -= (size_t)n;
+    }
+    fclose(fp);
+    free(buf);
+
+    if (ok) {
+        // FAT 上 rename 的目标不能已存在
+        remove(path);
+        ok = rename(part, path) == 0;
+    }
+    if (!ok) {
+        remove(part);
+        ESP_LOGE(TAG, "Upload of %s failed with %u bytes left", path, (unsigned)remaining);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Upload failed");
+    }
+    file_browser_invalidate_cache();
+    ESP_LOGI(TAG, "Uploaded %s (%u bytes)", path, (unsigned)req->content_len);
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_sendstr(req, "{\"ok\":true}");
+}
+
+// 从内容服务器拉取：?url=<http 地址>&path=<相对路径>&crc=<十六进制 CRC32>，下载在后台进行
+static esp_err_t fetch_handler(httpd_req_t *req) {
+    char *url = (char *)malloc(WIFI_FETCH_URL_MAX);
+    char rel[SD_PATH_REL_MAX + 1] = {0};
+    char crc[12] = {0};
+    if (url == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+    const bool ok = get_query_arg(req, "url", url, WIFI_FETCH_URL_MAX) &&
+                    get_query_arg(req, "path", rel, sizeof(rel)) &&
+                    get_query_arg(req, "crc", crc, sizeof(crc)) &&
+                    wifi_fetch_start(url, rel, (uint32_t)strtoul(crc, NULL, 16));
+    free(url);
+    if (!ok) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_set_type(req, "application/json");
+        return httpd_resp_sendstr(req, "{\"ok\":false,\"error\":\"Bad request or a download is running\"}");
+    }
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_sendstr(req, "{\"ok\":true}");
+}
+
+static esp_err_t fetch_status_handler(httpd_req_t *req) {
+    char json[512];
+    wifi_fetch_format_json(json, sizeof(json));
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_sendstr(req, json);
+}
+
+// 最新的 BLE 布局 JSON（/sdcard/layout_<时间>.json，文件名按时间排序）
+static esp_err_t send_latest_layout(httpd_req_t *req) {
+    char latest[64] = {0};
+    DIR *dir = opendir(SD_PATH_ROOT);
+    if (dir != NULL) {
+        struct dirent *ent;
+        while ((ent = readdir(dir)) != NULL) {
+            const size_t len = strlen(ent->d_name);
+            if (strncmp(ent->d_name, "layout_", 7) == 0 && len > 5 && len < sizeof(latest) &&
+                strcmp(ent->d_name + len - 5, ".json") == 0 && strcmp(ent->d_name, latest) > 0) {
+                strcpy(latest, ent->d_name);
+            }
+        }
+        closedir(dir);
+    }
+    httpd_resp_set_type(req, "application/json");
+    if (latest[0] == '\0') {
+        return httpd_resp_send(req, "", 0);
+    }
+    char path[80];
+    snprintf(path, sizeof(path), SD_PATH_ROOT "%s", latest);
+    return send_file(req, path);
+}
+
+// 诊断 JSON 在堆上格式化后发送（httpd 任务栈较小）
+static esp_err_t send_json_from_heap(httpd_req_t *req, size_t size,
+                                     size_t (*format)(char *buf, size_t len)) {
+    char *json = malloc(size);
+    if (json == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+    format(json, size);
+    const esp_err_t err = httpd_resp_sendstr(req, json);
+    free(json);
+    return err;
+}
+
+static esp_err_t cmd_handler(httpd_req_t *req) {
+    stack_stats_register_self("httpd", WT_HTTPD_STACK);
+    char cmd[24] = {0};
+    if (!get_query_arg(req, "cmd", cmd, sizeof(cmd))) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing cmd");
+    }
+    if (strcmp(cmd, "get_layout") == 0) {
+        return send_latest_layout(req);
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    if (strcmp(cmd, "boot_profile") == 0) {
+        return send_json_from_heap(req, 768, boot_profile_format_json);
+    }
+
+    if (strcmp(cmd, "key_latency") == 0) {
+        // 按键到波形开始：快速通道（阅读器翻页）与 LVGL 输入设备路径分开统计
+        lvgl_key_latency_t fast, indev;
+        lvgl_get_key_latency(true, &fast);
+        lvgl_get_key_latency(false, &indev);
+        char latency[192];
+        snprintf(latency, sizeof(latency),
+                 "{\"fast\":{\"n\":%u,\"last_ms\":%u,\"avg_ms\":%u,\"max_ms\":%u},"
+                 "\"indev\":{\"n\":%u,\"last_ms\":%u,\"avg_ms\":%u,\"max_ms\":%u}}",
+                 (unsigned)fast.samples, (unsigned)fast.last_ms, (unsigned)fast.avg_ms,
+                 (unsigned)fast.max_ms, (unsigned)indev.samples, (unsigned)indev.last_ms,
+                 (unsigned)indev.avg_ms, (unsigned)indev.max_ms);
+        return httpd_resp_sendstr(req, latency);
+    }
+
+    if (strcmp(cmd, "heap") == 0) {
+        return send_json_from_heap(req, 512, heap_stats_format_json);
+    }
+
+    if (strcmp(cmd, "stacks") == 0) {
+        return send_json_from_heap(req, STACK_STATS_JSON_MAX, stack_stats_format_json);
+    }
+
+    if (strcmp(cmd, "turn_stats") == 0) {
+        return send_json_from_heap(req, TURN_STATS_JSON_MAX, turn_stats_format_json);
+    }
+    if (strcmp(cmd, "trace") == 0) {
+        return send_json_from_heap(req, TRACE_JSON_MAX, trace_format_json);
+    }
+
+    char json[96];
+    if (strcmp(cmd, "turn_stats_reset") == 0) {
+        turn_stats_reset();
+        return httpd_resp_sendstr(req, "{\"ok\":true}");
+    }
+    if (strcmp(cmd, "trace_dump") == 0) {
+        // 设备没有串口控制台：由网页触发，记录照常输出到串口日志
+        trace_dump_log();
+        return httpd_resp_sendstr(req, "{\"ok\":true}");
+    }
+    if (strcmp(cmd, "sd_health") == 0) {
+        sd_health_format_json(json, sizeof(json));
+        return httpd_resp_sendstr(req, json);
+    }
+    if (strcmp(cmd, "sd_selftest") == 0) {
+        // 诊断模式：写读校验一个临时文件（开机不再运行）
+        const bool ok = sd_health_selftest();
+        snprintf(json, sizeof(json), "{\"ok\":%s}", ok ? "true" : "false");
+        return httpd_resp_sendstr(req, json);
+    }
+    if (strcmp(cmd, "get_ble_mac") == 0) {
+        uint8_t mac[6] = {0};
+        esp_read_mac(mac, ESP_MAC_BT);
+        snprintf(json, sizeof(json), "{\"ble_mac\":\"%02x:%02x:%02x:%02x:%02x:%02x\"}",
+                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+        return httpd_resp_sendstr(req, json);
+    }
+    if (strcmp(cmd, "ble_status") == 0) {
+        // 传输模式下 BLE 已关闭
+        return httpd_resp_sendstr(req, "{\"ble_connected\":false,\"ble_advertising\":false,\"peer_addr\":\"\"}");
+    }
+    // prev/next/capture 通过 BLE 通知手机，传输模式下无法转发
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_sendstr(req, "{\"ok\":false,\"error\":\"BLE is off in transfer mode\"}");
+}
+
+static bool http_start(void) {
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.stack_size = WT_HTTPD_STACK;
+    config.max_open_sockets = 3;
+    config.lru_purge_enable = true;
+    config.recv_wait_timeout = 10;
+    if (httpd_start(&s_server, &config) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start HTTP server");
+        s_server = NULL;
+        return false;
+    }
+    const httpd_uri_t uris[] = {
+        { .uri = "/",         .method = HTTP_GET, .handler = index_handler },
+        { .uri = "/cmd",      .method = HTTP_GET, .handler = cmd_handler },
+        { .uri = "/api/list", .method = HTTP_GET, .handler = list_handler },
+        { .uri = "/api/file", .method = HTTP_GET, .handler = download_handler },
+        { .uri = "/api/file", .method = HTTP_PUT, .handler = upload_handler },
+        { .uri = "/api/fetch", .method = HTTP_POST, .handler = fetch_handler },
+        { .uri = "/api/fetch", .method = HTTP_GET, .handler = fetch_status_handler },
+    };
+    for (size_t i = 0; i < sizeof(uris) / sizeof(uris[0]); i++) {
+        httpd_register_uri_handler(s_server, &uris[i]);
+    }
+    return true;
+}
+
+// ============================================================================
+// Wi-Fi
+// ============================================================================
+
+static void wifi_event_handler(void *arg, esp_event_base_t base, int32_t id, void *data) {
+    (void)arg;
+    if (base == WIFI_EVENT && id == WIFI_EVENT_STA_START) {
+        esp_wifi_connect();
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
+        s_ip = 0;
+        s_status_dirty = true;
+        lvgl_timer_task_wake();
+        esp_wifi_connect();
+    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
+        const ip_event_got_ip_t *event = (const ip_event_got_ip_t *)data;
+        ESP_LOGI(TAG, "Got IP " IPSTR, IP2STR(&event->ip_info.ip));
+        s_ip = event->ip_info.ip.addr;
+        s_status_dirty = true;
+        lvgl_timer_task_wake();
+    }
+}
+
+// 读取 /sdcard/wifi.txt：第一行 SSID，第二行密码
+static void load_credentials(wifi_config_t *wifi_config) {
+    strncpy((char *)wifi_config->sta.ssid, WT_DEFAULT_SSID, sizeof(wifi_config->sta.ssid));
+    strncpy((char *)wifi_config->sta.password, WT_DEFAULT_PASSWORD, sizeof(wifi_config->sta.password));
+
+    FILE *fp = fopen(WIFI_TRANSFER_CONFIG_PATH, "r");
+    if (fp != NULL) {
+        char line[72];
+        if (fgets(line, sizeof(line), fp) != NULL) {
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[0] != '\0') {
+                memset(wifi_config->sta.ssid, 0, sizeof(wifi_config->sta.ssid));
+                memset(wifi_config->sta.password, 0, sizeof(wifi_config->sta.password));
+                strncpy((char *)wifi_config->sta.ssid, line, sizeof(wifi_config->sta.ssid));
+                if (fgets(line, sizeof(line), fp) != NULL) {
+                    line[strcspn(line, "\r\n")] = '\0';
+                    strncpy((char *)wifi_config->sta.password, line, sizeof(wifi_config->sta.password));
+                }
+            }
+        }
+        fclose(fp);
+    }
+    memcpy(s_ssid, wifi_config->sta.ssid, sizeof(wifi_config->sta.ssid));
+    s_ssid[sizeof(s_ssid) - 1] = '\0';
+}
+
+static void wifi_stop(void) {
+    if (s_wifi_started) {
+        esp_wifi_stop();
+        esp_wifi_deinit();
+        s_wifi_started = false;
+    }
+    lvgl_mem_pool_set_radio(LVGL_MEM_RADIO_WIFI, false);
+    if (s_ip_handler != NULL) {
+        esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, s_ip_handler);
+        s_ip_handler = NULL;
+    }
+    if (s_wifi_handler != NULL) {
+        esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID, s_wifi_handler);
+        s_wifi_handler = NULL;
+    }
+    if (s_netif != NULL) {
+        esp_netif_destroy_default_wifi(s_netif);
+        s_netif = NULL;
+    }
+    s_ip = 0;
+}
+
+static esp_err_t wifi_start(void) {
+    esp_err_t err = esp_netif_init();
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        return err;
+    }
+    err = esp_event_loop_create_default();
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        return err;
+    }
+    s_netif = esp_netif_create_default_wifi_sta();
+    if (s_netif == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // 缓冲区数量压到最低：传输模式下 BLE 已释放，但 LVGL framebuffer 仍然常驻
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    cfg.static_rx_buf_num = 4;
+    cfg.dynamic_rx_buf_num = 8;
+    cfg.dynamic_tx_buf_num = 8;
+    cfg.tx_buf_type = 1;
+    cfg.cache_tx_buf_num = 1;
+    err = esp_wifi_init(&cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+    s_wifi_started = true;
+
+    err = esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_event_handler,
+                                              NULL, &s_wifi_handler);
+    if (err == ESP_OK) {
+        err = esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, wifi_event_handler,
+                                                  NULL, &s_ip_handler);
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    wifi_config_t wifi_config;
+    memset(&wifi_config, 0, sizeof(wifi_config));
+    load_credentials(&wifi_config);
+    err = esp_wifi_set_mode(WIFI_MODE_STA);
+    if (err == ESP_OK) err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+    if (err == ESP_OK) err = esp_wifi_start();
+    return err;
+}
+
+// ============================================================================
+// 专用屏幕与调度
+// ============================================================================
+
+static void show_status(const char *text) {
+    lv_label_set_text(s_status, text);
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh();
+}
+
+static void update_status(void) {
+    char text[96];
+    const uint32_t ip = s_ip;
+    if (ip != 0) {
+        snprintf(text, sizeof(text), "Connected to %s\n\nhttp://%u.%u.%u.%u/", s_ssid,
+                 (unsigned)(ip & 0xFF), (unsigned)((ip >> 8) & 0xFF),
+                 (unsigned)((ip >> 16) & 0xFF), (unsigned)(ip >> 24));
+    } else {
+        snprintf(text, sizeof(text), "Connecting to %s...", s_ssid);
+    }
+    show_status(text);
+}
+
+static void screen_key_event_cb(lv_event_t *e) {
+    if (lv_event_get_key(e) == LV_KEY_ESC) {
+        // 屏幕不能在自己的事件回调里删除，交给定时器
+        s_exit_requested = true;
+    }
+}
+
+static void create_screen(void) {
+    s_prev_screen = lv_screen_active();
+    s_indev = lv_indev_get_next(NULL);
+    s_prev_group = (s_indev != NULL) ? lv_indev_get_group(s_indev) : NULL;
+
+    s_screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(s_screen, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(s_screen, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(s_screen, 0, 0);
+    lv_obj_remove_flag(s_screen, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *title = lv_label_create(s_screen);
+    lv_label_set_text(title, "Wi-Fi Transfer");
+    lv_obj_set_style_text_font(title, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(title, lv_color_black(), 0);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
+
+    s_status = lv_label_create(s_screen);
+    lv_obj_set_width(s_status, lv_pct(90));
+    lv_obj_set_style_text_font(s_status, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(s_status, lv_color_black(), 0);
+    lv_obj_set_style_text_align(s_status, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_align(s_status, LV_ALIGN_CENTER, 0, 0);
+
+    lv_obj_t *hint = lv_label_create(s_screen);
+    lv_label_set_text(hint, "Bluetooth is off while transferring.\nPress Back to exit.");
+    lv_obj_set_style_text_font(hint, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(hint, lv_color_black(), 0);
+    lv_obj_set_style_text_align(hint, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -24);
+
+    lv_obj_add_event_cb(s_screen, screen_key_event_cb, LV_EVENT_KEY, NULL);
+    s_group = lv_group_create();
+    lv_group_add_obj(s_group, s_screen);
+    if (s_indev != NULL) {
+        lv_indev_set_group(s_indev, s_group);
+    }
+    lv_screen_load(s_screen);
+}
+
+// 关掉阅读相关的常驻缓存，把堆留给 Wi-Fi 和 lwIP
+static void reclaim_memory(void) {
+    const size_t before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    epub_prefetch_cancel();
+    library_db_close();
+    lvgl_set_double_buffer(false);
+    lv_image_cache_drop(NULL);
+    ESP_LOGI(TAG, "Reclaimed %d bytes (free %u, largest block %u)",
+             (int)(heap_caps_get_free_size(MALLOC_CAP_8BIT) - before),
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT),
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
+
+static void enter_mode(void) {
+    ESP_LOGI(TAG, "Entering transfer mode");
+    s_active = true;
+    s_exit_requested = false;
+    create_screen();
+    show_status("Stopping Bluetooth...");
+
+    s_ble_stopped = (s_cfg.ble_stop == NULL) || s_cfg.ble_stop();
+    if (!s_ble_stopped) {
+        show_status("Bluetooth is busy, try again later.");
+        return;
+    }
+    lvgl_mem_pool_set_radio(LVGL_MEM_RADIO_WIFI, true);
+    reclaim_memory();
+
+    const esp_err_t err = wifi_start();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Wi-Fi start failed: %s", esp_err_to_name(err));
+        wifi_stop();
+        char text[64];
+        snprintf(text, sizeof(text), "Wi-Fi failed: %s", esp_err_to_name(err));
+        show_status(text);
+        return;
+    }
+    if (!http_start()) {
+        show_status("HTTP server failed to start.");
+        return;
+    }
+    update_status();
+}
+
+// 下载完成的书登记进书库（Wi-Fi 已释放内存，EPUB 解析放得下）
+static void register_downloads(void) {
+    char path[LIBRARY_PATH_MAX + 8];
+    while (wifi_fetch_take_completed(path, sizeof(path))) {
+        if (!library_db_update(path)) {
+            ESP_LOGW(TAG, "Library did not take %s", path);
+        }
+    }
+}
+
+static void exit_mode(void) {
+    ESP_LOGI(TAG, "Leaving transfer mode");
+    // 下载中的文件落盘后停下，下次进入时续传
+    wifi_fetch_stop();
+    if (s_server != NULL) {
+        stack_stats_release("httpd");
+        httpd_stop(s_server);
+        s_server = NULL;
+    }
+    wifi_stop();
+    if (s_ble_stopped && s_cfg.ble_start != NULL) {
+        s_cfg.ble_start();
+    }
+    s_ble_stopped = false;
+    register_downloads();
+
+    // 恢复原屏幕和按键分组，整屏全刷
+    if (s_indev != NULL) {
+        lv_indev_set_group(s_indev, s_prev_group);
+    }
+    if (s_prev_screen != NULL) {
+        lv_screen_load(s_prev_screen);
+    }
+    lv_obj_delete(s_screen);
+    lv_group_delete(s_group);
+    s_screen = NULL;
+    s_status = NULL;
+    s_group = NULL;
+    lvgl_reset_refresh_state();
+    lv_obj_invalidate(lv_screen_active());
+    lvgl_trigger_render(NULL);
+    lvgl_display_refresh_full();
+    power_manager_notify_activity();
+    s_active = false;
+}
+
+static void wt_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (s_enter_requested && !s_active) {
+        s_enter_requested = false;
+        enter_mode();
+        return;
+    }
+    if (!s_active) {
+        return;
+    }
+    if (s_exit_requested) {
+        s_exit_requested = false;
+        exit_mode();
+        return;
+    }
+    if (s_status_dirty && s_server != NULL) {
+        s_status_dirty = false;
+        // 连上网络后继续上次没下完的文件
+        if (s_ip != 0) {
+            wifi_fetch_resume_pending();
+        }
+        update_status();
+    }
+}
+
+void wifi_transfer_init(const wifi_transfer_config_t *cfg) {
+    if (cfg != NULL) {
+        s_cfg = *cfg;
+    }
+    if (s_timer == NULL) {
+        s_timer = lv_timer_create(wt_timer_cb, WT_POLL_MS, NULL);
+    }
+}
+
+bool wifi_transfer_request(void) {
+    if (s_timer == NULL || s_active || s_enter_requested || usb_transfer_is_active()) {
+        return false;
+    }
+    s_enter_requested = true;
+    lvgl_timer_task_wake();
+    ESP_LOGI(TAG, "Transfer mode requested");
+    return true;
+}
+
+bool wifi_transfer_is_active(void) { return s_enter_requested || s_active; }
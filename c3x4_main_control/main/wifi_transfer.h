@@ -0,0 +1,57 @@
+/**
+ * @file wifi_transfer.h
+ * @brief Wi-Fi 传输模式：独占内存的批量同步，浏览器通过 HTTP 上传/下载 SD 卡文件
+ *
+ * ESP32-C3 的内存放不下 Wi-Fi + BLE + SD + LVGL，所以平时不启动 Wi-Fi。进入传输模式时：
+ *   1. 切换到专用屏幕（显示连接状态与地址，返回键退出）
+ *   2. 关闭 NimBLE（nimble_port_stop/deinit，由 main.c 的 ble_stop 回调完成）
+ *   3. 释放阅读相关缓存：乒乓 framebuffer、LVGL 图片缓存、书库索引、EPUB 预取
+ *   4. 启动 Wi-Fi STA 和 HTTP 服务器
+ * 退出时按相反顺序停止 Wi-Fi、重新启动 BLE 并恢复原屏幕；缓存在需要时重新建立
+ *
+ * HTTP 接口（路径参数均相对于 /sdcard，URL 编码）：
+ *   GET  /                      sdcard/web_files/index.html
+ *   GET  /cmd?cmd=<命令>         网页控制命令（get_ble_mac、ble_status、get_layout、boot_profile、
+ *                               sd_health、sd_selftest 读写自检、key_latency 按键到波形延时、
+ *                               heap 堆遥测、trace 事件环 JSON、trace_dump 事件环输出到串口日志）
+ *   POST /api/fetch?url=<地址>&path=<文件>&crc=<CRC32 十六进制>
+ *                               设备从内容服务器下载文件，断线续传、收齐校验后登记进书库（wifi_fetch.h）
+ *   GET  /api/fetch             下载进度 JSON
+ *   GET  /api/list?path=<目录>   目录列表 JSON：[{"name":..,"size":..,"dir":..}]
+ *   GET  /api/file?path=<文件>   下载文件
+ *   PUT  /api/file?path=<文件>   上传文件（请求体为文件内容），先写 .part 收齐后改名
+ *
+ * Wi-Fi 账号从 /sdcard/wifi.txt 读取（第一行 SSID，第二行密码），没有该文件时
+ * 使用编译时的默认值
+ */
+
+#ifndef WIFI_TRANSFER_H
+#define WIFI_TRANSFER_H
+
+#include <stdbool.h>
+
+#define WIFI_TRANSFER_CONFIG_PATH "/sdcard/wifi.txt"
+#define WIFI_TRANSFER_WEB_ROOT    "/sdcard/web_files"
+
+typedef struct {
+    bool (*ble_stop)(void);     // 关闭 BLE 并释放协议栈内存（LVGL 任务中调用），false 时放弃进入
+    void (*ble_start)(void);    // 退出时重新启动 BLE
+} wifi_transfer_config_t;
+
+/**
+ * @brief 注册调度定时器（在 LVGL 初始化后、LVGL 定时器任务启动前调用）
+ */
+void wifi_transfer_init(const wifi_transfer_config_t *cfg);
+
+/**
+ * @brief 请求进入传输模式（任意任务中调用，不阻塞）
+ * @return false 未初始化、已在传输模式或 USB 传输模式进行中
+ */
+bool wifi_transfer_request(void);
+
+/**
+ * @brief 是否处于传输模式（含正在进入/退出）
+ */
+bool wifi_transfer_is_active(void);
+
+#endif // WIFI_TRANSFER_H
@@ -0,0 +1,174 @@
+/**
+ * @file x4im_frame.c
+ * @brief X4IM 紧凑帧流式解码
+ *
+ * 每个 BLE 写入到达时直接解码进帧缓冲区，不缓存编码数据：1bpp 直接拷贝，
+ * 2bpp 每两个输入字节合成一个输出字节，差分 RLE 把解出的字节异或到上一帧上
+ */
+
+#include "x4im_frame.h"
+#include "EPD_4in26.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "X4IM";
+
+#define FRAME_BYTES ((EPD_4in26_WIDTH * EPD_4in26_HEIGHT) / 8)
+
+// RLE 解码状态
+typedef enum {
+    RLE_CONTROL = 0,    // 等待控制字节
+    RLE_LITERAL,        // 正在复制 count 个原样字节
+    RLE_REPEAT,         // 等待要重复 count 次的字节
+} rle_state_t;
+
+static uint8_t *s_frame = NULL;     // 解码结果，兼作差分基准
+static uint8_t s_format = 0;
+static uint32_t s_out = 0;          // 已输出的字节数
+static bool s_failed = false;
+
+static rle_state_t s_rle_state = RLE_CONTROL;
+static uint32_t s_rle_count = 0;
+
+static uint8_t s_pack_acc = 0;      // 2bpp：正在拼的输出字节
+static uint8_t s_pack_pixels = 0;   // 2bpp：已拼入的像素数
+
+bool x4im_frame_is_packed(uint8_t format) {
+    return format == X4IM_FMT_1BPP || format == X4IM_FMT_2BPP || format == X4IM_FMT_RLE_DELTA;
+}
+
+bool x4im_frame_begin(uint8_t format, uint32_t payload_len) {
+    const uint32_t expected = (format == X4IM_FMT_1BPP) ? FRAME_BYTES :
+                              (format == X4IM_FMT_2BPP) ? FRAME_BYTES * 2 : 0;
+    if (!x4im_frame_is_packed(format) || (expected != 0 && payload_len != expected)) {
+        ESP_LOGW(TAG, "Bad packed frame: format=%u len=%u", format, (unsigned)payload_len);
+        return false;
+    }
+
+    if (s_frame == NULL) {
+        s_frame = (uint8_t *)heap_caps_malloc(FRAME_BYTES, MALLOC_CAP_8BIT);
+        if (s_frame == NULL) {
+            ESP_LOGE(TAG, "No memory for %u-byte frame", (unsigned)FRAME_BYTES);
+            return false;
+        }
+        memset(s_frame, 0xFF, FRAME_BYTES);
+    }
+
+    s_format = format;
+    s_out = 0;
+    s_failed = false;
+    s_rle_state = RLE_CONTROL;
+    s_rle_count = 0;
+    s_pack_acc = 0;
+    s_pack_pixels = 0;
+    return true;
+}
+
+static bool feed_2bpp(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        for (int shift = 6; shift >= 0; shift -= 2) {
+            const uint8_t level = (data[i] >> shift) & 0x03;
+            s_pack_acc = (uint8_t)((s_pack_acc << 1) | (level >= 2 ? 1 : 0));
+            s_pack_pixels++;
+        }
+        if (s_pack_pixels == 8) {
+            if (s_out >= FRAME_BYTES) {
+                return false;
+            }
+            s_frame[s_out++] = s_pack_acc;
+            s_pack_acc = 0;
+            s_pack_pixels = 0;
+        }
+    }
+    return true;
+}
+
+static bool feed_rle_delta(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        const uint8_t b = data[i];
+        switch (s_rle_state) {
+        case RLE_CONTROL:
+            if (b < 0x80) {
+                s_rle_count = (uint32_t)b + 1;
+                s_rle_state = RLE_LITERAL;
+            } else {
+                s_rle_count = (uint32_t)b - 0x7D;
+                s_rle_state = RLE_REPEAT;
+            }
+            break;
+        case RLE_LITERAL:
+            if (s_out >= FRAME_BYTES) {
+                return false;
+            }
+            s_frame[s_out++] ^= b;
+            if (--s_rle_count == 0) {
+                s_rle_state = RLE_CONTROL;
+            }
+            break;
+        case RLE_REPEAT:
+            if (s_rle_count > FRAME_BYTES - s_out) {
+                return false;
+            }
+            if (b != 0) {
+                for (uint32_t k = 0; k < s_rle_count; k++) {
+                    s_frame[s_out + k] ^= b;
+                }
+            }
+            s_out += s_rle_count;
+            s_rle_state = RLE_CONTROL;
+            break;
+        }
+    }
+    return true;
+}
+
+bool x4im_frame_feed(const uint8_t *data, size_t len) {
+    if (s_frame == NULL || s_failed) {
+        return false;
+    }
+
+    bool ok;
+    switch (s_format) {
+    case X4IM_FMT_1BPP:
+        ok = len <= FRAME_BYTES - s_out;
+        if (ok) {
+            memcpy(s_frame + s_out, data, len);
+            s_out += (uint32_t)len;
+        }
+        break;
+    case X4IM_FMT_2BPP:
+        ok = feed_2bpp(data, len);
+        break;
+    case X4IM_FMT_RLE_DELTA:
+        ok = feed_rle_delta(data, len);
+        break;
+    default:
+        ok = false;
+        break;
+    }
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Packed frame overrun or corrupt (format=%u, out=%u)",
+                 s_format, (unsigned)s_out);
+        s_failed = true;
+    }
+    return ok;
+}
+
+bool x4im_frame_complete(void) {
+    return s_frame != NULL && !s_failed && s_out == FRAME_BYTES &&
+           (s_format != X4IM_FMT_RLE_DELTA || s_rle_state == RLE_CONTROL);
+}
+
+const uint8_t *x4im_frame_data(void) {
+    return x4im_frame_complete() ? s_frame : NULL;
+}
+
+void x4im_frame_reset(void) {
+    heap_caps_free(s_frame);
+    s_frame = NULL;
+    s_format = 0;
+    s_out = 0;
+    s_failed = false;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file x4im_frame.h
+ * @brief X4IM 紧凑帧格式：BLE 接收时流式解码为 EPD framebuffer 布局
+ *
+ * X4IM 帧头第 5 字节为格式：
+ *   1 = RGB565 小端（原始格式，不解码，原样存文件）
+ *   2 = 1bpp 打包：与 framebuffer 完全相同（物理方向 800x480，每行 100 字节，
+ *       高位在左，1 为白色），48,000 字节
+ *   3 = 2bpp 打包：物理方向，每字节 4 像素，高位在左，0 黑 ~ 3 白，
+ *       解码时按 >= 2 为白二值化，96,000 字节
+ *   4 = 1bpp 差分 RLE：当前帧与上一帧（1bpp 布局）逐字节异或后按 PackBits 编码。
+ *       控制字节 c < 0x80：后面跟 c+1 个原样字节；c >= 0x80：下一个字节重复 c-0x7D 次
+ *       （3 ~ 130 次）。连接建立后的第一帧以全白帧为基准
+ * 帧头中的负载长度是编码后的字节数
+ *
+ * 解码帧保存在一块常驻的 framebuffer 大小的缓冲区里，兼作差分基准；断开连接时释放。
+ * 所有函数都在 NimBLE 主机任务中调用
+ */
+
+#ifndef X4IM_FRAME_H
+#define X4IM_FRAME_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define X4IM_FMT_RGB565     1
+#define X4IM_FMT_1BPP       2
+#define X4IM_FMT_2BPP       3
+#define X4IM_FMT_RLE_DELTA  4
+
+/**
+ * @brief 是否是需要解码的紧凑格式（2 ~ 4）
+ */
+bool x4im_frame_is_packed(uint8_t format);
+
+/**
+ * @brief 开始接收一帧（解码缓冲区不存在时分配并填为全白）
+ * @param format 帧格式（X4IM_FMT_1BPP / X4IM_FMT_2BPP / X4IM_FMT_RLE_DELTA）
+ * @param payload_len 编码后的负载长度
+ * @return false 格式/长度不符或内存不足
+ */
+bool x4im_frame_begin(uint8_t format, uint32_t payload_len);
+
+/**
+ * @brief 解码一段负载（可以任意切分）
+ * @return false 数据超出一帧或 RLE 格式错误（本帧作废，差分基准被破坏需重发完整帧）
+ */
+bool x4im_frame_feed(const uint8_t *data, size_t len);
+
+/**
+ * @brief 本帧是否已完整解码（输出刚好填满一帧）
+ */
+bool x4im_frame_complete(void);
+
+/**
+ * @brief 解码结果（framebuffer 布局，lvgl_fb_size() 字节），没有时返回 NULL
+ */
+const uint8_t *x4im_frame_data(void);
+
+/**
+ * @brief 释放解码缓冲区（断开连接时调用，差分基准随之失效）
+ */
+void x4im_frame_reset(void);
+
+#endif // X4IM_FRAME_H
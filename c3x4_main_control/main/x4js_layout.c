@@ -0,0 +1,1244 @@
+/**
+ * @file x4js_layout.c
+ * @brief X4JS 布局实现：流式 JSON 分词 -> 显示列表编译 -> 分带光栅化
+ *
+ * 主机任务一侧只累计内容哈希，收完后登记文件路径；LVGL 任务的定时器等 ble_writer
+ * 把文件写完，再查缓存或编译、光栅化并刷新
+ */
+
+#include "x4js_layout.h"
+#include "ble_writer.h"
+#include "lvgl_driver.h"
+#include "power_manager.h"
+#include "spi_arbiter.h"
+#include "ui/builtin_chinese_font.h"
+#include "ui/font_manager.h"
+#include "ui/image_cache.h"
+#include "ui/page_index.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "X4JS";
+
+extern const lv_font_t lv_font_montserrat_14;
+extern const lv_font_t lv_font_montserrat_16;
+extern const lv_font_t lv_font_montserrat_20;
+extern const lv_font_t lv_font_montserrat_24;
+
+#define LAYOUT_POLL_MS      200
+#define LAYOUT_LOCK_MS      1000
+#define LAYOUT_MAX_DIRTY    8        // 局部重画的区域数，超出时并入最后一个
+#define LAYOUT_PATH_MAX     64
+#define JSON_IO_BUF         512
+#define JSON_STR_MAX        512      // 单个字符串值的上限（超出部分丢弃）
+#define JSON_KEY_MAX        12
+
+#define DL_MAGIC            0x594C3458u  // "X4LY"
+#define DL_VERSION          1
+
+enum {
+    OP_NONE = 0,
+    OP_TEXT,
+    OP_RECT,
+    OP_LINE,
+    OP_IMAGE,
+};
+
+#define OP_FLAG_WHITE       0x01     // 白色（默认黑色）
+#define OP_FLAG_FILL        0x02     // 矩形实心
+#define OP_ALIGN_MASK       0x0C
+#define OP_ALIGN_CENTER     0x04
+#define OP_ALIGN_RIGHT      0x08
+
+enum {
+    FONT_UI = 0,                     // 界面当前字体（font_manager，含回退链）
+    FONT_BUILTIN,
+    FONT_M14,
+    FONT_M16,
+    FONT_M20,
+    FONT_M24,
+    FONT_COUNT,
+};
+
+enum {
+    REFRESH_AUTO = 0,
+    REFRESH_PARTIAL,
+    REFRESH_FULL,
+};
+
+// 一条绘制指令；线段的终点存在 w/h 中
+typedef struct __attribute__((packed)) {
+    uint8_t type;
+    uint8_t flags;
+    uint8_t font;
+    uint8_t stroke;
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t str;       // 文字 / 图片路径在字符串池中的偏移（以 '\0' 结尾）
+    uint16_t len;
+} dl_op_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t hash;      // JSON 内容的 FNV-1a
+    uint16_t version;
+    uint16_t op_count;
+    uint16_t pool_size;
+    uint8_t background; // 1 为黑底
+    uint8_t refresh;
+} dl_header_t;
+
+// 显示列表：文件头、op_count 条指令、字符串池，一块连续内存（也是 .xdl 文件的内容）
+typedef struct __attribute__((packed)) {
+    dl_header_t hdr;
+    dl_op_t ops[];
+} display_list_t;
+
+static inline const char *dl_pool(const display_list_t *dl) {
+    return (const char *)&dl->ops[dl->hdr.op_count];
+}
+
+static inline size_t dl_size(const dl_header_t *hdr) {
+    return sizeof(dl_header_t) + (size_t)hdr->op_count * sizeof(dl_op_t) + hdr->pool_size;
+}
+
+static display_list_t *s_cache[X4JS_CACHE_ENTRIES];   // 最近使用的在前
+static const display_list_t *s_shown = NULL;          // 屏上的布局；LVGL 重绘后失效
+
+// 主机任务与 LVGL 任务之间的交接
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_feed_hash = 0;
+static bool s_pending = false;
+static char s_pending_path[LAYOUT_PATH_MAX];
+static uint32_t s_pending_hash = 0;
+
+// ---------------------------------------------------------------------------
+// 流式 JSON 分词器：逐字节读文件，',' 与 ':' 当作分隔符跳过
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    TOK_ERROR = 0,
+    TOK_EOF,
+    TOK_OBJ_BEGIN,
+    TOK_OBJ_END,
+    TOK_ARR_BEGIN,
+    TOK_ARR_END,
+    TOK_STRING,
+    TOK_NUMBER,
+    TOK_TRUE,
+    TOK_FALSE,
+    TOK_NULL,
+} tok_t;
+
+typedef struct {
+    FILE *f;
+    uint8_t buf[JSON_IO_BUF];
+    size_t pos;
+    size_t len;
+    char str[JSON_STR_MAX];
+    size_t str_len;
+    int32_t num;
+} lexer_t;
+
+static int lex_getc(lexer_t *lx) {
+    if (lx->pos == lx->len) {
+        spi_arbiter_sd_begin();
+        lx->len = fread(lx->buf, 1, sizeof(lx->buf), lx->f);
+        spi_arbiter_sd_end();
+        lx->pos = 0;
+        if (lx->len == 0) {
+            return EOF;
+        }
+    }
+    return lx->buf[lx->pos++];
+}
+
+// 只在成功读到一个字节之后调用
+static void lex_ungetc(lexer_t *lx) {
+    lx->pos--;
+}
+
+static void lex_put_utf8(lexer_t *lx, uint32_t cp) {
+    uint8_t out[4];
+    size_t n;
+    if (cp < 0x80) {
+        out[0] = (uint8_t)cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        out[0] = (uint8_t)(0xC0 | (cp >> 6));
+        out[1] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        out[0] = (uint8_t)(0xE0 | (cp >> 12));
+        out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        out[0] = (uint8_t)(0xF0 | (cp >> 18));
+        out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    if (lx->str_len + n < sizeof(lx->str)) {
+        memcpy(lx->str + lx->str_len, out, n);
+        lx->str_len += n;
+    }
+}
+
+static int32_t lex_hex4(lexer_t *lx) {
+    int32_t v = 0;
+    for (int i = 0; i < 4; i++) {
+        const int c = lex_getc(lx);
+        int d;
+        if (c >= '0' && c <= '9') {
+            d = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            d = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            d = c - 'A' + 10;
+        } else {
+            return -1;
+        }
+        v = (v << 4) | d;
+    }
+    return v;
+}
+
+// 截断时去掉末尾不完整的 UTF-8 序列
+static void lex_trim_utf8(lexer_t *lx) {
+    size_t i = lx->str_len;
+    size_t back = 0;
+    while (i > 0 && back < 4 && ((uint8_t)lx->str[i - 1] & 0xC0) == 0x80) {
+        i--;
+        back++;
+    }
+    if (i == 0) {
+        return;
+    }
+    const uint8_t lead = (uint8_t)lx->str[i - 1];
+    const size_t need = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+    if (back < need) {
+        lx->str_len = i - 1;
+    }
+}
+
+static tok_t lex_string(lexer_t *lx) {
+    lx->str_len = 0;
+    bool truncated = false;
+    for (;;) {
+        int c = lex_getc(lx);
+        if (c == EOF) {
+            return TOK_ERROR;
+        }
+        if (c == '"') {
+            break;
+        }
+        if (c != '\\') {
+            // 原样复制（多字节 UTF-8 逐字节通过）
+            if (lx->str_len + 1 < sizeof(lx->str)) {
+                lx->str[lx->str_len++] = (char)c;
+            } else {
+                truncated = true;
+            }
+            continue;
+        }
+        c = lex_getc(lx);
+        int32_t cp;
+        switch (c) {
+            case 'n': cp = '\n'; break;
+            case 't': cp = '\t'; break;
+            case 'r': cp = '\r'; break;
+            case 'b': cp = '\b'; break;
+            case 'f': cp = '\f'; break;
+            case '"':
+            case '\\':
+            case '/': cp = c; break;
+            case 'u':
+                cp = lex_hex4(lx);
+                if (cp >= 0xD800 && cp < 0xDC00) {
+                    // 代理对
+                    if (lex_getc(lx) != '\\' || lex_getc(lx) != 'u') {
+                        return TOK_ERROR;
+                    }
+                    const int32_t low = lex_hex4(lx);
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        return TOK_ERROR;
+                    }
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                }
+                if (cp < 0) {
+                    return TOK_ERROR;
+                }
+                break;
+            default:
+                return TOK_ERROR;
+        }
+        lex_put_utf8(lx, (uint32_t)cp);
+    }
+    if (truncated) {
+        lex_trim_utf8(lx);
+    }
+    lx->str[lx->str_len] = '\0';
+    return TOK_STRING;
+}
+
+static tok_t lex_number(lexer_t *lx, int c) {
+    const bool neg = c == '-';
+    if (neg) {
+        c = lex_getc(lx);
+    }
+    if (c < '0' || c > '9') {
+        return TOK_ERROR;
+    }
+    int32_t v = 0;
+    while (c >= '0' && c <= '9') {
+        if (v < 1000000) {
+            v = v * 10 + (c - '0');
+        }
+        c = lex_getc(lx);
+    }
+    // 小数与指数部分忽略，坐标取整数部分
+    while (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-' || (c >= '0' && c <= '9')) {
+        c = lex_getc(lx);
+    }
+    if (c != EOF) {
+        lex_ungetc(lx);
+    }
+    lx->num = neg ? -v : v;
+    return TOK_NUMBER;
+}
+
+static tok_t lex_literal(lexer_t *lx, const char *rest, tok_t tok) {
+    for (; *rest != '\0'; rest++) {
+        if (lex_getc(lx) != *rest) {
+            return TOK_ERROR;
+        }
+    }
+    return tok;
+}
+
+static tok_t lex_next(lexer_t *lx) {
+    int c;
+    do {
+        c = lex_getc(lx);
+    } while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == ':');
+    switch (c) {
+        case EOF: return TOK_EOF;
+        case '{': return TOK_OBJ_BEGIN;
+        case '}': return TOK_OBJ_END;
+        case '[': return TOK_ARR_BEGIN;
+        case ']': return TOK_ARR_END;
+        case '"': return lex_string(lx);
+        case 't': return lex_literal(lx, "rue", TOK_TRUE);
+        case 'f': return lex_literal(lx, "alse", TOK_FALSE);
+        case 'n': return lex_literal(lx, "ull", TOK_NULL);
+        default:  return (c == '-' || (c >= '0' && c <= '9')) ? lex_number(lx, c) : TOK_ERROR;
+    }
+}
+
+// 跳过一个值（tok 为它的第一个记号），嵌套的对象与数组整体跳过
+static bool skip_value(lexer_t *lx, tok_t tok) {
+    int depth = 0;
+    for (;;) {
+        if (tok == TOK_OBJ_BEGIN || tok == TOK_ARR_BEGIN) {
+            depth++;
+        } else if (tok == TOK_OBJ_END || tok == TOK_ARR_END) {
+            depth--;
+        } else if (tok == TOK_ERROR || tok == TOK_EOF) {
+            return false;
+        }
+        if (depth <= 0) {
+            return depth == 0;
+        }
+        tok = lex_next(lx);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 编译
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    lexer_t lx;
+    dl_op_t ops[X4JS_MAX_OPS];
+    char pool[X4JS_POOL_SIZE];
+    uint16_t op_count;
+    uint16_t pool_size;
+    uint16_t dropped;
+    uint8_t background;
+    uint8_t refresh;
+} compiler_t;
+
+static bool pool_add(compiler_t *c, const char *s, size_t len, uint16_t *off) {
+    if ((size_t)c->pool_size + len + 1 > sizeof(c->pool)) {
+        return false;
+    }
+    *off = c->pool_size;
+    memcpy(c->pool + c->pool_size, s, len);
+    c->pool[c->pool_size + len] = '\0';
+    c->pool_size = (uint16_t)(c->pool_size + len + 1);
+    return true;
+}
+
+static int16_t clamp16(int32_t v) {
+    return (int16_t)(v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v);
+}
+
+static uint8_t parse_font(const char *s) {
+    static const char *const names[FONT_COUNT] = {"ui", "builtin", "m14", "m16", "m20", "m24"};
+    for (uint8_t i = 0; i < FONT_COUNT; i++) {
+        if (strcmp(s, names[i]) == 0) {
+            return i;
+        }
+    }
+    return FONT_UI;
+}
+
+static bool compile_element(compiler_t *c) {
+    lexer_t *lx = &c->lx;
+    dl_op_t op = {.stroke = 1};
+    uint16_t text = 0, text_len = 0, src = 0;
+    bool have_text = false, have_src = false, pool_full = false;
+
+    for (;;) {
+        tok_t tok = lex_next(lx);
+        if (tok == TOK_OBJ_END) {
+            break;
+        }
+        if (tok != TOK_STRING) {
+            return false;
+        }
+        char key[JSON_KEY_MAX];
+        strncpy(key, lx->str, sizeof(key) - 1);
+        key[sizeof(key) - 1] = '\0';
+
+        tok = lex_next(lx);
+        if (tok == TOK_NUMBER) {
+            const int16_t v = clamp16(lx->num);
+            if (strcmp(key, "x") == 0 || strcmp(key, "x1") == 0) {
+                op.x = v;
+            } else if (strcmp(key, "y") == 0 || strcmp(key, "y1") == 0) {
+                op.y = v;
+            } else if (strcmp(key, "w") == 0 || strcmp(key, "x2") == 0) {
+                op.w = v;
+            } else if (strcmp(key, "h") == 0 || strcmp(key, "y2") == 0) {
+                op.h = v;
+            } else if (strcmp(key, "stroke") == 0) {
+                op.stroke = (uint8_t)(v < 1 ? 1 : v > 255 ? 255 : v);
+            }
+        } else if (tok == TOK_STRING) {
+            const char *s = lx->str;
+            if (strcmp(key, "type") == 0) {
+                op.type = strcmp(s, "text") == 0 ? OP_TEXT : strcmp(s, "rect") == 0 ? OP_RECT
+                        : strcmp(s, "line") == 0 ? OP_LINE : strcmp(s, "image") == 0 ? OP_IMAGE
+                        : OP_NONE;
+            } else if (strcmp(key, "text") == 0) {
+                have_text = pool_add(c, s, lx->str_len, &text);
+                text_len = (uint16_t)lx->str_len;
+                pool_full |= !have_text;
+            } else if (strcmp(key, "src") == 0) {
+                have_src = pool_add(c, s, lx->str_len, &src);
+                pool_full |= !have_src;
+            } else if (strcmp(key, "font") == 0) {
+                op.font = parse_font(s);
+            } else if (strcmp(key, "color") == 0) {
+                op.flags = (uint8_t)((op.flags & ~OP_FLAG_WHITE) | (strcmp(s, "white") == 0 ? OP_FLAG_WHITE : 0));
+            } else if (strcmp(key, "align") == 0) {
+                op.flags = (uint8_t)((op.flags & ~OP_ALIGN_MASK) |
+                                     (strcmp(s, "center") == 0 ? OP_ALIGN_CENTER
+                                      : strcmp(s, "right") == 0 ? OP_ALIGN_RIGHT : 0));
+            }
+        } else if (tok == TOK_TRUE || tok == TOK_FALSE) {
+            if (strcmp(key, "fill") == 0) {
+                op.flags = (uint8_t)((op.flags & ~OP_FLAG_FILL) | (tok == TOK_TRUE ? OP_FLAG_FILL : 0));
+            }
+        } else if (!skip_value(lx, tok)) {
+            return false;
+        }
+    }
+
+    bool usable;
+    switch (op.type) {
+        case OP_TEXT:
+            usable = have_text;
+            op.str = text;
+            op.len = text_len;
+            op.w = op.w > 0 ? op.w : 0;
+            op.h = op.h > 0 ? op.h : 0;
+            break;
+        case OP_IMAGE:
+            usable = have_src && op.w > 0 && op.h > 0;
+            op.str = src;
+            break;
+        case OP_RECT:
+            usable = op.w > 0 && op.h > 0;
+            break;
+        case OP_LINE:
+            usable = true;
+            break;
+        default:
+            usable = false;
+            break;
+    }
+    if (!usable || c->op_count >= X4JS_MAX_OPS) {
+        c->dropped += (usable || pool_full) ? 1 : 0;
+        return true;
+    }
+    c->ops[c->op_count++] = op;
+    return true;
+}
+
+static bool compile_root(compiler_t *c) {
+    lexer_t *lx = &c->lx;
+    if (lex_next(lx) != TOK_OBJ_BEGIN) {
+        return false;
+    }
+    for (;;) {
+        tok_t tok = lex_next(lx);
+        if (tok == TOK_OBJ_END) {
+            return true;
+        }
+        if (tok != TOK_STRING) {
+            return false;
+        }
+        char key[JSON_KEY_MAX];
+        strncpy(key, lx->str, sizeof(key) - 1);
+        key[sizeof(key) - 1] = '\0';
+
+        tok = lex_next(lx);
+        if (strcmp(key, "elements") == 0 && tok == TOK_ARR_BEGIN) {
+            while ((tok = lex_next(lx)) != TOK_ARR_END) {
+                if (tok == TOK_OBJ_BEGIN ? !compile_element(c) : !skip_value(lx, tok)) {
+                    return false;
+                }
+            }
+        } else if (strcmp(key, "background") == 0 && tok == TOK_STRING) {
+            c->background = strcmp(lx->str, "black") == 0;
+        } else if (strcmp(key, "refresh") == 0 && tok == TOK_STRING) {
+            c->refresh = strcmp(lx->str, "full") == 0      ? REFRESH_FULL
+                         : strcmp(lx->str, "partial") == 0 ? REFRESH_PARTIAL
+                                                           : REFRESH_AUTO;
+        } else if (!skip_value(lx, tok)) {
+            return false;
+        }
+    }
+}
+
+static display_list_t *compile_file(const char *path, uint32_t hash) {
+    compiler_t *c = calloc(1, sizeof(compiler_t));
+    if (c == NULL) {
+        return NULL;
+    }
+    c->lx.f = fopen(path, "rb");
+    if (c->lx.f == NULL) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        free(c);
+        return NULL;
+    }
+    const bool ok = compile_root(c);
+    fclose(c->lx.f);
+
+    display_list_t *dl = NULL;
+    if (ok) {
+        const dl_header_t hdr = {
+            .magic = DL_MAGIC,
+            .hash = hash,
+            .version = DL_VERSION,
+            .op_count = c->op_count,
+            .pool_size = c->pool_size,
+            .background = c->background,
+            .refresh = c->refresh,
+        };
+        dl = malloc(dl_size(&hdr));
+        if (dl != NULL) {
+            dl->hdr = hdr;
+            memcpy(dl->ops, c->ops, (size_t)c->op_count * sizeof(dl_op_t));
+            memcpy((char *)dl_pool(dl), c->pool, c->pool_size);
+        }
+        ESP_LOGI(TAG, "Compiled %s: %u elements, %u string bytes%s", path, c->op_count,
+                 c->pool_size, c->dropped ? " (some dropped, limits reached)" : "");
+    } else {
+        ESP_LOGW(TAG, "%s: malformed layout JSON", path);
+    }
+    free(c);
+    return dl;
+}
+
+// ---------------------------------------------------------------------------
+// 显示列表缓存
+// ---------------------------------------------------------------------------
+
+static void cache_file(uint32_t hash, char *out, size_t out_size) {
+    snprintf(out, out_size, X4JS_CACHE_DIR "/%08lx.xdl", (unsigned long)hash);
+}
+
+static bool dl_valid(const display_list_t *dl) {
+    const char *pool = dl_pool(dl);
+    for (uint16_t i = 0; i < dl->hdr.op_count; i++) {
+        const dl_op_t *op = &dl->ops[i];
+        if (op->type == OP_NONE || op->type > OP_IMAGE || op->font >= FONT_COUNT) {
+            return false;
+        }
+        if ((op->type == OP_TEXT || op->type == OP_IMAGE) &&
+            ((uint32_t)op->str + op->len >= dl->hdr.pool_size || pool[op->str + op->len] != '\0')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static display_list_t *load_cached(uint32_t hash) {
+    char file[48];
+    cache_file(hash, file, sizeof(file));
+    FILE *f = fopen(file, "rb");
+    if (f == NULL) {
+        return NULL;
+    }
+    dl_header_t hdr;
+    display_list_t *dl = NULL;
+    spi_arbiter_sd_begin();
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == DL_MAGIC && hdr.version == DL_VERSION &&
+        hdr.hash == hash && hdr.op_count <= X4JS_MAX_OPS && hdr.pool_size <= X4JS_POOL_SIZE) {
+        dl = malloc(dl_size(&hdr));
+        if (dl != NULL) {
+            dl->hdr = hdr;
+            const size_t rest = dl_size(&hdr) - sizeof(hdr);
+            if (fread(dl->ops, 1, rest, f) != rest || !dl_valid(dl)) {
+                free(dl);
+                dl = NULL;
+            }
+        }
+    }
+    spi_arbiter_sd_end();
+    fclose(f);
+    return dl;
+}
+
+static void store_cached(const display_list_t *dl) {
+    char file[48];
+    cache_file(dl->hdr.hash, file, sizeof(file));
+    mkdir("/sdcard/.x4cache", 0775);
+    mkdir(X4JS_CACHE_DIR, 0775);
+    FILE *f = fopen(file, "wb");
+    if (f == NULL) {
+        ESP_LOGW(TAG, "Cannot create %s", file);
+        return;
+    }
+    spi_arbiter_sd_begin();
+    bool ok = fwrite(dl, dl_size(&dl->hdr), 1, f) == 1;
+    spi_arbiter_sd_end();
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        remove(file);
+    }
+}
+
+// 内存缓存：命中的移到最前，新的插到最前，挤出最旧的（屏上的布局总在最前，不会被挤出）
+static display_list_t *cache_find(uint32_t hash) {
+    for (int i = 0; i < X4JS_CACHE_ENTRIES; i++) {
+        display_list_t *dl = s_cache[i];
+        if (dl != NULL && dl->hdr.hash == hash) {
+            memmove(&s_cache[1], &s_cache[0], (size_t)i * sizeof(s_cache[0]));
+            s_cache[0] = dl;
+            return dl;
+        }
+    }
+    return NULL;
+}
+
+static void cache_insert(display_list_t *dl) {
+    display_list_t *oldest = s_cache[X4JS_CACHE_ENTRIES - 1];
+    if (oldest != NULL && oldest != s_shown) {
+        free(oldest);
+    }
+    memmove(&s_cache[1], &s_cache[0], (X4JS_CACHE_ENTRIES - 1) * sizeof(s_cache[0]));
+    s_cache[0] = dl;
+}
+
+static display_list_t *get_display_list(const char *path, uint32_t hash) {
+    display_list_t *dl = cache_find(hash);
+    if (dl != NULL) {
+        return dl;
+    }
+    dl = load_cached(hash);
+    if (dl == NULL) {
+        dl = compile_file(path, hash);
+        if (dl == NULL) {
+            return NULL;
+        }
+        store_cached(dl);
+    }
+    cache_insert(dl);
+    return dl;
+}
+
+// ---------------------------------------------------------------------------
+// 光栅化：逻辑方向的 1bpp 分带（1 为白色），写满一带交给 lvgl_fb_put_bitmap
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint8_t *bits;
+    uint16_t stride;
+    lv_area_t clip;     // 这一带覆盖的逻辑区域
+} canvas_t;
+
+typedef struct {
+    uint16_t op;
+    epub_image_t image;
+} loaded_image_t;
+
+static bool area_intersect(lv_area_t *out, const lv_area_t *a, const lv_area_t *b) {
+    out->x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+    out->y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+    out->x2 = a->x2 < b->x2 ? a->x2 : b->x2;
+    out->y2 = a->y2 < b->y2 ? a->y2 : b->y2;
+    return out->x1 <= out->x2 && out->y1 <= out->y2;
+}
+
+static inline void canvas_set(const canvas_t *c, int32_t x, int32_t y, bool white) {
+    if (x < c->clip.x1 || x > c->clip.x2 || y < c->clip.y1 || y > c->clip.y2) {
+        return;
+    }
+    const int32_t dx = x - c->clip.x1;
+    uint8_t *p = &c->bits[(uint32_t)(y - c->clip.y1) * c->stride + (dx >> 3)];
+    const uint8_t mask = (uint8_t)(0x80 >> (dx & 7));
+    *p = white ? (uint8_t)(*p | mask) : (uint8_t)(*p & ~mask);
+}
+
+static void canvas_fill(const canvas_t *c, const lv_area_t *area, bool white) {
+    lv_area_t a;
+    if (!area_intersect(&a, area, &c->clip)) {
+        return;
+    }
+    for (int32_t y = a.y1; y <= a.y2; y++) {
+        for (int32_t x = a.x1; x <= a.x2; x++) {
+            canvas_set(c, x, y, white);
+        }
+    }
+}
+
+static const lv_font_t *op_font(uint8_t id) {
+    switch (id) {
+        case FONT_BUILTIN: return &lv_font_builtin_chinese_16;
+        case FONT_M14:     return &lv_font_montserrat_14;
+        case FONT_M16:     return &lv_font_montserrat_16;
+        case FONT_M20:     return &lv_font_montserrat_20;
+        case FONT_M24:     return &lv_font_montserrat_24;
+        default: {
+            const lv_font_t *font = font_manager_get_font();
+            return font != NULL ? font : &lv_font_builtin_chinese_16;
+        }
+    }
+}
+
+static uint32_t utf8_next(const char **p, const char *end) {
+    const uint8_t *s = (const uint8_t *)*p;
+    uint32_t cp = *s++;
+    int extra = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+    if (extra > 0) {
+        cp &= 0x3F >> extra;
+        for (; extra > 0 && (const char *)s < end && (*s & 0xC0) == 0x80; extra--) {
+            cp = (cp << 6) | (*s++ & 0x3F);
+        }
+    }
+    *p = (const char *)s;
+    return cp;
+}
+
+typedef struct {
+    const char *s;
+    uint32_t len;
+    int32_t width;
+} text_line_t;
+
+// 取出下一行：遇到 '\n' 或宽度超过 max_width（> 0 时）结束，每行至少一个字符
+static bool next_line(const lv_font_t *font, const char **p, const char *end, int32_t max_width,
+                      text_line_t *line) {
+    if (*p >= end) {
+        return false;
+    }
+    const char *s = *p;
+    const char *q = s;
+    int32_t width = 0;
+    while (q < end && *q != '\n') {
+        const char *n = q;
+        const int32_t adv = lv_font_get_glyph_width(font, utf8_next(&n, end), 0);
+        if (max_width > 0 && width + adv > max_width && q > s) {
+            break;
+        }
+        width += adv;
+        q = n;
+    }
+    line->s = s;
+    line->len = (uint32_t)(q - s);
+    line->width = width;
+    *p = (q < end && *q == '\n') ? q + 1 : q;
+    return true;
+}
+
+static int32_t line_x(const dl_op_t *op, const text_line_t *line) {
+    if (op->w <= 0) {
+        return op->x;
+    }
+    switch (op->flags & OP_ALIGN_MASK) {
+        case OP_ALIGN_CENTER: return op->x + (op->w - line->width) / 2;
+        case OP_ALIGN_RIGHT:  return op->x + op->w - line->width;
+        default:              return op->x;
+    }
+}
+
+// 文字占据的区域：给了 w 和 h 时就是这个框，否则按排版结果
+static bool text_bounds(const dl_op_t *op, const char *pool, lv_area_t *out) {
+    const lv_font_t *font = op_font(op->font);
+    int32_t lines = 0, width = 0;
+    if (op->w <= 0 || op->h <= 0) {
+        const char *p = pool + op->str;
+        text_line_t line;
+        while (next_line(font, &p, pool + op->str + op->len, op->w, &line)) {
+            width = line.width > width ? line.width : width;
+            lines++;
+        }
+    }
+    out->x1 = op->x;
+    out->y1 = op->y;
+    out->x2 = op->x + (op->w > 0 ? op->w : width) - 1;
+    out->y2 = op->y + (op->h > 0 ? op->h : lines * lv_font_get_line_height(font)) - 1;
+    return out->x2 >= out->x1 && out->y2 >= out->y1;
+}
+
+static bool op_bounds(const dl_op_t *op, const char *pool, lv_area_t *out) {
+    switch (op->type) {
+        case OP_TEXT:
+            return text_bounds(op, pool, out);
+        case OP_LINE: {
+            const int32_t lo = (op->stroke - 1) / 2;
+            const int32_t hi = op->stroke - 1 - lo;
+            out->x1 = (op->x < op->w ? op->x : op->w) - lo;
+            out->y1 = (op->y < op->h ? op->y : op->h) - lo;
+            out->x2 = (op->x > op->w ? op->x : op->w) + hi;
+            out->y2 = (op->y > op->h ? op->y : op->h) + hi;
+            return true;
+        }
+        default:
+            out->x1 = op->x;
+            out->y1 = op->y;
+            out->x2 = op->x + op->w - 1;
+            out->y2 = op->y + op->h - 1;
+            return true;
+    }
+}
+
+static uint8_t glyph_bpp(lv_font_glyph_format_t format) {
+    switch (format) {
+        case LV_FONT_GLYPH_FORMAT_A1: return 1;
+        case LV_FONT_GLYPH_FORMAT_A2: return 2;
+        case LV_FONT_GLYPH_FORMAT_A4: return 4;
+        case LV_FONT_GLYPH_FORMAT_A8: return 8;
+        default:                      return 0;
+    }
+}
+
+// 字形位图像素；stride 为 0 时各行的位连续存放（LVGL 内置格式）
+static uint8_t glyph_pixel(const uint8_t *bitmap, uint32_t stride, uint32_t box_w, int32_t x,
+                           int32_t y, uint8_t bpp) {
+    const uint32_t bit = stride != 0 ? (uint32_t)y * stride * 8 + (uint32_t)x * bpp
+                                     : ((uint32_t)y * box_w + (uint32_t)x) * bpp;
+    return (uint8_t)((bitmap[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1u << bpp) - 1));
+}
+
+static void draw_glyphs(const canvas_t *c, const lv_font_t *font, const text_line_t *line,
+                        int32_t x, int32_t top, bool white) {
+    const int32_t baseline = top + lv_font_get_line_height(font) - font->base_line;
+    const char *end = line->s + line->len;
+    for (const char *p = line->s; p < end && x <= c->clip.x2;) {
+        const uint32_t cp = utf8_next(&p, end);
+        lv_font_glyph_dsc_t g;
+        memset(&g, 0, sizeof(g));
+        if (!lv_font_get_glyph_dsc(font, &g, cp, 0)) {
+            x += g.adv_w;
+            continue;
+        }
+        const uint8_t bpp = glyph_bpp(g.format);
+        const int32_t gx = x + g.ofs_x;
+        const int32_t gy = baseline - g.ofs_y - g.box_h;
+        if (bpp > 0 && g.box_w > 0 && g.box_h > 0 && gx <= c->clip.x2 && gx + g.box_w > c->clip.x1 &&
+            gy <= c->clip.y2 && gy + g.box_h > c->clip.y1) {
+            // 内置字体（未压缩的 fmt_txt）取原始位图，各行连续存放；流式字体直接给出带 stride 的 A1
+            const bool fmt_txt = g.resolved_font != NULL &&
+                                 g.resolved_font->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt;
+            g.req_raw_bitmap = 1;
+            const uint8_t *bitmap = (const uint8_t *)lv_font_get_glyph_bitmap(&g, NULL);
+            const uint32_t stride = fmt_txt ? 0 : g.stride;
+            if (bitmap != NULL) {
+                const uint8_t threshold = (uint8_t)(1u << (bpp - 1));  // 半灰度以上算着墨
+                for (int32_t y = 0; y < g.box_h; y++) {
+                    if (gy + y < c->clip.y1 || gy + y > c->clip.y2) {
+                        continue;
+                    }
+                    for (int32_t xx = 0; xx < g.box_w; xx++) {
+                        if (glyph_pixel(bitmap, stride, g.box_w, xx, y, bpp) >= threshold) {
+                            canvas_set(c, gx + xx, gy + y, white);
+                        }
+                    }
+                }
+            }
+            lv_font_glyph_release_draw_data(&g);
+        }
+        x += g.adv_w;
+    }
+}
+
+static void draw_text(const canvas_t *band, const dl_op_t *op, const char *pool) {
+    canvas_t c = *band;
+    if (op->w > 0 && op->h > 0) {
+        const lv_area_t box = {op->x, op->y, op->x + op->w - 1, op->y + op->h - 1};
+        if (!area_intersect(&c.clip, &band->clip, &box)) {
+            return;
+        }
+    }
+    const lv_font_t *font = op_font(op->font);
+    const int32_t line_height = lv_font_get_line_height(font);
+    const char *p = pool + op->str;
+    const char *end = p + op->len;
+    text_line_t line;
+    for (int32_t top = op->y; top <= c.clip.y2 && next_line(font, &p, end, op->w, &line);
+         top += line_height) {
+        if (top + line_height > c.clip.y1) {
+            draw_glyphs(&c, font, &line, line_x(op, &line), top, (op->flags & OP_FLAG_WHITE) != 0);
+        }
+    }
+}
+
+static void draw_line(const canvas_t *c, const dl_op_t *op) {
+    const bool white = (op->flags & OP_FLAG_WHITE) != 0;
+    const int32_t lo = (op->stroke - 1) / 2;
+    int32_t x = op->x, y = op->y;
+    const int32_t dx = abs(op->w - x), sx = x < op->w ? 1 : -1;
+    const int32_t dy = -abs(op->h - y), sy = y < op->h ? 1 : -1;
+    int32_t err = dx + dy;
+    for (;;) {
+        const lv_area_t dot = {x - lo, y - lo, x - lo + op->stroke - 1, y - lo + op->stroke - 1};
+        canvas_fill(c, &dot, white);
+        if (x == op->w && y == op->h) {
+            break;
+        }
+        const int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+static void draw_rect(const canvas_t *c, const dl_op_t *op) {
+    const bool white = (op->flags & OP_FLAG_WHITE) != 0;
+    const lv_area_t box = {op->x, op->y, op->x + op->w - 1, op->y + op->h - 1};
+    if (op->flags & OP_FLAG_FILL) {
+        canvas_fill(c, &box, white);
+        return;
+    }
+    const int32_t s = op->stroke;
+    const lv_area_t edges[4] = {
+        {box.x1, box.y1, box.x2, box.y1 + s - 1},
+        {box.x1, box.y2 - s + 1, box.x2, box.y2},
+        {box.x1, box.y1, box.x1 + s - 1, box.y2},
+        {box.x2 - s + 1, box.y1, box.x2, box.y2},
+    };
+    for (int i = 0; i < 4; i++) {
+        canvas_fill(c, &edges[i], white);
+    }
+}
+
+static void draw_image(const canvas_t *c, const dl_op_t *op, const epub_image_t *image) {
+    const int32_t ix = op->x + (op->w - image->width) / 2;
+    const int32_t iy = op->y + (op->h - image->height) / 2;
+    const lv_area_t box = {ix, iy, ix + image->width - 1, iy + image->height - 1};
+    lv_area_t a;
+    if (!area_intersect(&a, &box, &c->clip)) {
+        return;
+    }
+    for (int32_t y = a.y1; y <= a.y2; y++) {
+        const uint8_t *row = image->bits + (uint32_t)(y - iy) * image->stride;
+        for (int32_t x = a.x1; x <= a.x2; x++) {
+            const int32_t col = x - ix;
+            canvas_set(c, x, y, (row[col >> 3] & (0x80 >> (col & 7))) != 0);
+        }
+    }
+}
+
+static const epub_image_t *find_image(const loaded_image_t *images, int count, uint16_t op) {
+    for (int i = 0; i < count; i++) {
+        if (images[i].op == op) {
+            return &images[i].image;
+        }
+    }
+    return NULL;
+}
+
+// 把 area 内的布局按带画好写入 framebuffer（记为局刷脏区）
+static bool render_area(const display_list_t *dl, const lv_area_t *bounds, const lv_area_t *area,
+                        const loaded_image_t *images, int image_count) {
+    const int32_t width = lv_area_get_width(area);
+    canvas_t c = {.stride = (uint16_t)((width + 7) / 8)};
+    c.bits = malloc((size_t)c.stride * X4JS_BAND_ROWS);
+    if (c.bits == NULL) {
+        return false;
+    }
+    const char *pool = dl_pool(dl);
+    bool ok = true;
+    for (int32_t y = area->y1; y <= area->y2 && ok; y += X4JS_BAND_ROWS) {
+        c.clip = (lv_area_t){area->x1, y, area->x2,
+                             y + X4JS_BAND_ROWS - 1 < area->y2 ? y + X4JS_BAND_ROWS - 1 : area->y2};
+        const int32_t rows = lv_area_get_height(&c.clip);
+        memset(c.bits, dl->hdr.background ? 0x00 : 0xFF, (size_t)c.stride * rows);
+        for (uint16_t i = 0; i < dl->hdr.op_count; i++) {
+            const dl_op_t *op = &dl->ops[i];
+            lv_area_t hit;
+            if (!area_intersect(&hit, &bounds[i], &c.clip)) {
+                continue;
+            }
+            switch (op->type) {
+                case OP_TEXT: draw_text(&c, op, pool); break;
+                case OP_RECT: draw_rect(&c, op); break;
+                case OP_LINE: draw_line(&c, op); break;
+                case OP_IMAGE: {
+                    const epub_image_t *image = find_image(images, image_count, i);
+                    if (image != NULL) {
+                        draw_image(&c, op, image);
+                    }
+                    break;
+                }
+                default: break;
+            }
+        }
+        uint8_t *fb = lvgl_fb_write_begin(LAYOUT_LOCK_MS);
+        if (fb == NULL) {
+            ok = false;
+            break;
+        }
+        lvgl_fb_put_bitmap(fb, c.clip.x1, c.clip.y1, (uint16_t)width, (uint16_t)rows, c.bits, c.stride);
+        lvgl_fb_write_end(&c.clip);
+    }
+    free(c.bits);
+    return ok;
+}
+
+// 只有文字内容不同（其余字段与图片路径都一样）时可以局部重画
+static bool same_shape(const display_list_t *a, const display_list_t *b) {
+    if (a->hdr.op_count != b->hdr.op_count || a->hdr.background != b->hdr.background) {
+        return false;
+    }
+    for (uint16_t i = 0; i < a->hdr.op_count; i++) {
+        const dl_op_t *p = &a->ops[i];
+        const dl_op_t *q = &b->ops[i];
+        if (p->type != q->type || p->flags != q->flags || p->font != q->font ||
+            p->stroke != q->stroke || p->x != q->x || p->y != q->y || p->w != q->w || p->h != q->h) {
+            return false;
+        }
+        if (p->type == OP_IMAGE && strcmp(dl_pool(a) + p->str, dl_pool(b) + q->str) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool text_changed(const display_list_t *a, const display_list_t *b, uint16_t i) {
+    const dl_op_t *p = &a->ops[i];
+    const dl_op_t *q = &b->ops[i];
+    return p->type == OP_TEXT &&
+           (p->len != q->len || memcmp(dl_pool(a) + p->str, dl_pool(b) + q->str, p->len) != 0);
+}
+
+static bool show(const display_list_t *dl) {
+    if (dl == s_shown) {
+        ESP_LOGI(TAG, "Layout %08lx already on screen", (unsigned long)dl->hdr.hash);
+        return true;
+    }
+    const lv_area_t screen = {0, 0, lv_display_get_horizontal_resolution(NULL) - 1,
+                              lv_display_get_vertical_resolution(NULL) - 1};
+    lv_area_t dirty[LAYOUT_MAX_DIRTY];
+    int dirty_count = 0;
+    bool partial = false;
+
+    lv_area_t *bounds = malloc((dl->hdr.op_count + 1) * sizeof(lv_area_t));
+    if (bounds == NULL) {
+        return false;
+    }
+    for (uint16_t i = 0; i < dl->hdr.op_count; i++) {
+        if (!op_bounds(&dl->ops[i], dl_pool(dl), &bounds[i])) {
+            bounds[i] = (lv_area_t){0, 0, -1, -1};
+        }
+    }
+
+    // 与屏上的布局只差文字：每段变化的文字重画新旧两次排版的并集
+    if (s_shown != NULL && same_shape(s_shown, dl)) {
+        partial = true;
+        for (uint16_t i = 0; i < dl->hdr.op_count; i++) {
+            if (!text_changed(s_shown, dl, i)) {
+                continue;
+            }
+            lv_area_t old_area, area = bounds[i];
+            if (op_bounds(&s_shown->ops[i], dl_pool(s_shown), &old_area)) {
+                lv_area_join(&area, &area, &old_area);
+            }
+            if (!area_intersect(&area, &area, &screen)) {
+                continue;
+            }
+            if (dirty_count < LAYOUT_MAX_DIRTY) {
+                dirty[dirty_count++] = area;
+            } else {
+                lv_area_join(&dirty[dirty_count - 1], &dirty[dirty_count - 1], &area);
+            }
+        }
+    } else {
+        dirty[dirty_count++] = screen;
+    }
+
+    // 解码与重画区域相交的图片（解码在持有 framebuffer 之前完成）
+    loaded_image_t images[X4JS_MAX_IMAGES];
+    int image_count = 0;
+    for (uint16_t i = 0; i < dl->hdr.op_count; i++) {
+        const dl_op_t *op = &dl->ops[i];
+        bool needed = false;
+        for (int d = 0; d < dirty_count && !needed; d++) {
+            lv_area_t hit;
+            needed = area_intersect(&hit, &bounds[i], &dirty[d]);
+        }
+        if (op->type != OP_IMAGE || !needed) {
+            continue;
+        }
+        if (image_count == X4JS_MAX_IMAGES) {
+            ESP_LOGW(TAG, "More than %d images, the rest are skipped", X4JS_MAX_IMAGES);
+            break;
+        }
+        if (image_cache_load(dl_pool(dl) + op->str, op->w, op->h, 1, &images[image_count].image)) {
+            images[image_count++].op = i;
+        } else {
+            ESP_LOGW(TAG, "Cannot decode %s", dl_pool(dl) + op->str);
+        }
+    }
+
+    // 局刷只刷记录的脏区，脏区只在局刷模式下记录
+    const bool partial_refresh = dl->hdr.refresh == REFRESH_PARTIAL ||
+                                 (dl->hdr.refresh == REFRESH_AUTO && partial);
+    if (partial_refresh && lvgl_get_refresh_mode() != EPD_REFRESH_PARTIAL) {
+        lvgl_set_refresh_mode(EPD_REFRESH_PARTIAL);
+    }
+    bool ok = true;
+    for (int d = 0; d < dirty_count && ok; d++) {
+        ok = render_area(dl, bounds, &dirty[d], images, image_count);
+    }
+    for (int i = 0; i < image_count; i++) {
+        epub_image_free(&images[i].image);
+    }
+    free(bounds);
+    if (!ok) {
+        ESP_LOGW(TAG, "Framebuffer unavailable, layout dropped");
+        s_shown = NULL;
+        return false;
+    }
+
+    if (dl->hdr.refresh == REFRESH_FULL) {
+        lvgl_display_refresh_full();
+    } else if (dirty_count > 0) {
+        lvgl_display_refresh();
+    }
+    power_manager_notify_activity();
+    ESP_LOGI(TAG, "Layout %08lx shown (%s, %d region%s)", (unsigned long)dl->hdr.hash,
+             partial ? "text only" : "full", dirty_count, dirty_count == 1 ? "" : "s");
+    s_shown = dl;
+    return true;
+}
+
+static bool show_path(const char *path, uint32_t hash) {
+    const display_list_t *dl = get_display_list(path, hash);
+    return dl != NULL && show(dl);
+}
+
+// ---------------------------------------------------------------------------
+// LVGL 任务
+// ---------------------------------------------------------------------------
+
+// LVGL 重绘过屏幕：屏上已不是完整的布局，下一次必须整屏重画
+static void lvgl_render_cb(lv_event_t *e) {
+    (void)e;
+    s_shown = NULL;
+}
+
+static void layout_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    // 等写入任务把文件写完关闭
+    if (!s_pending || ble_writer_busy()) {
+        return;
+    }
+    char path[LAYOUT_PATH_MAX];
+    uint32_t hash;
+    portENTER_CRITICAL(&s_mux);
+    memcpy(path, s_pending_path, sizeof(path));
+    hash = s_pending_hash;
+    s_pending = false;
+    portEXIT_CRITICAL(&s_mux);
+    show_path(path, hash);
+}
+
+void x4js_layout_init(void) {
+    static bool initialized = false;
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+    lv_display_add_event_cb(lv_display_get_default(), lvgl_render_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_timer_create(layout_timer_cb, LAYOUT_POLL_MS, NULL);
+}
+
+bool x4js_layout_show_file(const char *path) {
+    FILE *f = path != NULL ? fopen(path, "rb") : NULL;
+    if (f == NULL) {
+        return false;
+    }
+    uint8_t buf[JSON_IO_BUF];
+    uint32_t hash = 0;
+    size_t n;
+    spi_arbiter_sd_begin();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        hash = page_index_hash(hash, buf, n);
+    }
+    spi_arbiter_sd_end();
+    fclose(f);
+    return show_path(path, hash);
+}
+
+// ---------------------------------------------------------------------------
+// NimBLE 主机任务
+// ---------------------------------------------------------------------------
+
+void x4js_layout_begin(void) {
+    s_feed_hash = 0;
+}
+
+void x4js_layout_feed(const uint8_t *data, size_t len) {
+    s_feed_hash = page_index_hash(s_feed_hash, data, len);
+}
+
+void x4js_layout_submit(const char *path) {
+    if (path == NULL || path[0] == '\0') {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    strncpy(s_pending_path, path, sizeof(s_pending_path) - 1);
+    s_pending_path[sizeof(s_pending_path) - 1] = '\0';
+    s_pending_hash = s_feed_hash;
+    s_pending = true;
+    portEXIT_CRITICAL(&s_mux);
+}
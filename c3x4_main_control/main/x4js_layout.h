@@ -0,0 +1,73 @@
+/**
+ * @file x4js_layout.h
+ * @brief X4JS 布局：BLE 收到的 JSON 布局编译成显示列表，直接画进 EPD framebuffer
+ *
+ * JSON 格式（坐标为逻辑方向，与 LVGL 相同；未知的键忽略）：
+ *   {
+ *     "background": "white" | "black",
+ *     "refresh": "auto" | "partial" | "full",
+ *     "elements": [
+ *       {"type": "text", "x": 20, "y": 40, "w": 440, "h": 48, "text": "12:30",
+ *        "font": "ui" | "builtin" | "m14" | "m16" | "m20" | "m24",
+ *        "align": "left" | "center" | "right", "color": "black" | "white"},
+ *       {"type": "rect", "x": 0, "y": 0, "w": 480, "h": 2, "fill": true, "stroke": 1},
+ *       {"type": "line", "x1": 0, "y1": 100, "x2": 479, "y2": 100, "stroke": 2},
+ *       {"type": "image", "x": 0, "y": 120, "w": 480, "h": 300, "src": "/sdcard/a.png"}
+ *     ]
+ *   }
+ * text 给出 w 时在宽度内折行（"\n" 强制换行），给出 w 和 h 时裁在框内；font 缺省为
+ * 界面当前字体（含中文回退）。image 等比缩小后居中放进框内，位图经 image_cache 缓存
+ *
+ * JSON 由流式分词器逐个记号读出（不建 DOM），直接编译成显示列表：定长绘制指令数组
+ * 加字符串池，整体一块内存。显示列表按 JSON 内容的 FNV-1a 缓存：内存中保留最近
+ * X4JS_CACHE_ENTRIES 个，同时写到 X4JS_CACHE_DIR/<哈希>.xdl，同一布局再次发来时不再解析。
+ * 哈希在 NimBLE 主机任务收数据时顺带算出，内存命中时连 SD 卡上的 JSON 都不用读
+ *
+ * 新列表与屏上的列表只有文字内容不同时（指令数、类型、几何、字体与图片都相同），
+ * 只重画变化的文字区域并局刷；否则整屏重画。光栅化按 X4JS_BAND_ROWS 行分带在小缓冲区
+ * 中完成再写入 framebuffer。与 ble_live 相同，写入的像素不属于任何控件，界面下次重绘时
+ * 被覆盖（之后的布局总是整屏重画）
+ */
+
+#ifndef X4JS_LAYOUT_H
+#define X4JS_LAYOUT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define X4JS_MAX_OPS        128      // 每个布局最多多少个元素
+#define X4JS_POOL_SIZE      4096     // 文字与图片路径的字符串池
+#define X4JS_MAX_IMAGES     4        // 一次重画中最多同时解码的图片
+#define X4JS_CACHE_ENTRIES  4
+#define X4JS_CACHE_DIR      "/sdcard/.x4cache/layout"
+#define X4JS_BAND_ROWS      32
+
+/**
+ * @brief 创建轮询定时器（在 LVGL 初始化后、LVGL 定时器任务启动前调用）
+ */
+void x4js_layout_init(void);
+
+/**
+ * @brief 开始接收一个新的 X4JS 负载（NimBLE 主机任务中调用）
+ */
+void x4js_layout_begin(void);
+
+/**
+ * @brief 送入一段负载（只用于计算内容哈希，数据照常由 ble_writer 写卡）
+ */
+void x4js_layout_feed(const uint8_t *data, size_t len);
+
+/**
+ * @brief 负载已收完并已请求关闭文件：SD 写入完成后在 LVGL 任务中显示
+ * @param path 负载保存的文件
+ */
+void x4js_layout_submit(const char *path);
+
+/**
+ * @brief 立即显示 SD 卡上的布局文件（LVGL 任务中调用）
+ * @return false 文件无法打开、格式错误或 framebuffer 不可用（灰阶模式）
+ */
+bool x4js_layout_show_file(const char *path);
+
+#endif // X4JS_LAYOUT_H
@@ -0,0 +1,64 @@
+# 精简的发布配置，叠加在 sdkconfig.defaults 之上：
+#   idf.py -B build_lean -D SDKCONFIG_DEFAULTS="sdkconfig.defaults;sdkconfig.defaults.lean" build
+# 用 idf.py size-report 对比默认配置的基线（见 CMakeLists.txt）。
+# 镜像变小后 OTA 补丁和烧录都更快，app 分区也能让出空间给字体、缓存分区
+
+# 按大小优化，断言只保留检查不保留文件名和表达式字符串
+CONFIG_COMPILER_OPTIMIZATION_SIZE=y
+CONFIG_COMPILER_OPTIMIZATION_ASSERTIONS_SILENT=y
+
+# 日志：编译期去掉 INFO 及以下的字符串（串口仍有警告和错误）
+CONFIG_LOG_DEFAULT_LEVEL_WARN=y
+CONFIG_BT_NIMBLE_LOG_LEVEL_WARNING=y
+# CONFIG_LV_USE_LOG is not set
+
+# 设备只作 BLE 外设：不扫描、不主动连接
+# CONFIG_BT_NIMBLE_ROLE_CENTRAL is not set
+# CONFIG_BT_NIMBLE_ROLE_OBSERVER is not set
+
+# LVGL 控件：界面只用 obj、label、line、list（button + label）和 image。
+# 默认主题为每个启用的控件引用样式和类，不关掉的控件即使不创建也会被链接
+# （LVGL 9 的 Kconfig 名称；sdkconfig.defaults 中 BTN/IMG/METER 等是旧名称）
+# CONFIG_LV_USE_ANIMIMAGE is not set
+# CONFIG_LV_USE_ARC is not set
+# CONFIG_LV_USE_BAR is not set
+# CONFIG_LV_USE_BUTTONMATRIX is not set
+# CONFIG_LV_USE_CALENDAR is not set
+# CONFIG_LV_USE_CANVAS is not set
+# CONFIG_LV_USE_CHART is not set
+# CONFIG_LV_USE_CHECKBOX is not set
+# CONFIG_LV_USE_DROPDOWN is not set
+# CONFIG_LV_USE_IMAGEBUTTON is not set
+# CONFIG_LV_USE_KEYBOARD is not set
+# CONFIG_LV_USE_LED is not set
+# CONFIG_LV_USE_MENU is not set
+# CONFIG_LV_USE_MSGBOX is not set
+# CONFIG_LV_USE_ROLLER is not set
+# CONFIG_LV_USE_SCALE is not set
+# CONFIG_LV_USE_SLIDER is not set
+# CONFIG_LV_USE_SPAN is not set
+# CONFIG_LV_USE_SPINBOX is not set
+# CONFIG_LV_USE_SPINNER is not set
+# CONFIG_LV_USE_SWITCH is not set
+# CONFIG_LV_USE_TEXTAREA is not set
+# CONFIG_LV_USE_TABLE is not set
+# CONFIG_LV_USE_TABVIEW is not set
+# CONFIG_LV_USE_TILEVIEW is not set
+# CONFIG_LV_USE_WIN is not set
+CONFIG_LV_USE_BUTTON=y
+CONFIG_LV_USE_IMAGE=y
+CONFIG_LV_USE_LABEL=y
+CONFIG_LV_USE_LINE=y
+CONFIG_LV_USE_LIST=y
+
+# Montserrat 只用 14/16/20/24（8、12 没有引用）
+# CONFIG_LV_FONT_MONTSERRAT_8 is not set
+# CONFIG_LV_FONT_MONTSERRAT_12 is not set
+
+# 图片解码：PNG/JPEG 由 epub_image.c 自带解码（TJpgDec + tinfl），LVGL 只负责 BMP。
+# lodepng 只用于隔行 PNG；LVGL 9 的 GIF 是独立控件，lv_image 本来就不解 GIF
+# CONFIG_LV_USE_LODEPNG is not set
+# CONFIG_LV_USE_PNG is not set
+# CONFIG_LV_USE_GIF is not set
+CONFIG_LV_USE_BMP=y
+CONFIG_LV_USE_TJPGD=y
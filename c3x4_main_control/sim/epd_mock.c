@@ -0,0 +1,484 @@
+/**
+ * @file epd_mock.c
+ * @brief 主机模拟器：EPD_4in26 驱动的模拟后端
+ *
+ * 实现 lvgl_driver.c 用到的 EPD_4in26.h 接口。不模拟 SSD1677 命令，只维护
+ * 两个 RAM 平面的内容，并记录每一次初始化、上传窗口与刷新：
+ *   - <out>/epd_log.csv  ：t_ms,event,type,x,y,w,h,bytes（流程标记 event=mark）
+ *   - <out>/frame_NNNN.pbm/.pgm：每次刷新后的面板内容（单色 / 4 灰阶）
+ * 波形时长按 REFRESH_STRATEGY.md 中的实测量级建模，realtime=false 时只计入统计
+ */
+
+#include "EPD_4in26.h"
+#include "EPD_Panel.h"
+#include "sim.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "EPD_SIM";
+
+#define FB_STRIDE (EPD_4in26_WIDTH / 8)
+#define FB_BYTES  (FB_STRIDE * EPD_4in26_HEIGHT)
+
+// 波形时长模型（ms）
+static const uint32_t s_wave_ms[SIM_EPD_UPDATE_COUNT] = {
+    [SIM_EPD_UPDATE_FULL] = 2000,
+    [SIM_EPD_UPDATE_FAST] = 1500,
+    [SIM_EPD_UPDATE_PARTIAL] = 400,
+    [SIM_EPD_UPDATE_GRAY] = 3000,
+    [SIM_EPD_UPDATE_GRAY_PARTIAL] = 1200,
+};
+
+static const char *const s_update_names[SIM_EPD_UPDATE_COUNT] = {
+    [SIM_EPD_UPDATE_FULL] = "full",
+    [SIM_EPD_UPDATE_FAST] = "fast",
+    [SIM_EPD_UPDATE_PARTIAL] = "partial",
+    [SIM_EPD_UPDATE_GRAY] = "gray",
+    [SIM_EPD_UPDATE_GRAY_PARTIAL] = "gray_partial",
+};
+
+static uint8_t s_ram24[FB_BYTES];
+static uint8_t s_ram26[FB_BYTES];
+static bool s_gray_content = false;
+static bool s_invert = false;       // 夜间模式：快照按控制器反相输出
+
+static sim_epd_config_t s_cfg;
+static FILE *s_log = NULL;
+static uint32_t s_frame_no = 0;
+static sim_epd_summary_t s_summary;
+static EPD_4in26_Stats s_stats;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static EPD_4in26_State s_state = EPD_4in26_STATE_COLD;
+static EPD_4in26_Mode s_mode = EPD_4in26_MODE_NONE;
+static bool s_async = false;
+static EPD_4in26_UpdateDoneCb s_done_cb = NULL;
+static void *s_done_arg = NULL;
+static EPD_4in26_SupersededCb s_superseded_cb = NULL;
+static void *s_superseded_arg = NULL;
+static int64_t s_busy_until_us = 0;
+static EPD_4in26_BusyWindowCb s_window_cb = NULL;
+static void *s_window_arg = NULL;
+static bool s_window_open = false;
+static int64_t s_last_update_us = 0;
+static TimerHandle_t s_done_timer = NULL;  // realtime 异步模式：波形结束时调用完成回调
+
+static void done_timer_cb(TimerHandle_t timer);
+
+const char *sim_epd_update_name(sim_epd_update_t type) {
+    return type < SIM_EPD_UPDATE_COUNT ? s_update_names[type] : "?";
+}
+
+static void log_event(const char *event, const char *type, int x, int y, int w, int h,
+                      uint32_t bytes) {
+    if (s_log == NULL) {
+        return;
+    }
+    fprintf(s_log, "%lld,%s,%s,%d,%d,%d,%d,%u\n", (long long)(esp_timer_get_time() / 1000),
+            event, type != NULL ? type : "", x, y, w, h, (unsigned)bytes);
+}
+
+void sim_epd_init(const sim_epd_config_t *cfg) {
+    memset(&s_cfg, 0, sizeof(s_cfg));
+    if (cfg != NULL) {
+        s_cfg = *cfg;
+    }
+    if (s_cfg.realtime && s_done_timer == NULL) {
+        s_done_timer = xTimerCreate("epd_done", 1, pdFALSE, NULL, done_timer_cb);
+    }
+    memset(s_ram24, 0xFF, sizeof(s_ram24));
+    memset(s_ram26, 0xFF, sizeof(s_ram26));
+    if (s_cfg.out_dir != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/epd_log.csv", s_cfg.out_dir);
+        s_log = fopen(path, "w");
+        if (s_log == NULL) {
+            ESP_LOGW(TAG, "Cannot open %s", path);
+        } else {
+            fprintf(s_log, "t_ms,event,type,x,y,w,h,bytes\n");
+        }
+    }
+}
+
+void sim_epd_mark(const char *label) {
+    pthread_mutex_lock(&s_lock);
+    log_event("mark", label, 0, 0, 0, 0, 0);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void sim_epd_get_summary(sim_epd_summary_t *out) {
+    pthread_mutex_lock(&s_lock);
+    *out = s_summary;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void sim_epd_close(void) {
+    if (s_log != NULL) {
+        fclose(s_log);
+        s_log = NULL;
+    }
+}
+
+// 面板内容快照：单色写 PBM（1 = 黑），灰阶写 PGM
+static void write_frame(void) {
+    if (!s_cfg.frames || s_cfg.out_dir == NULL) {
+        return;
+    }
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%04u.%s", s_cfg.out_dir, (unsigned)s_frame_no,
+             s_gray_content ? "pgm" : "pbm");
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return;
+    }
+    if (s_gray_content) {
+        // blit_gray：亮度 g（0 黑 ~ 3 白）的 bit0 清零 0x24 位、bit1 清零 0x26 位
+        fprintf(f, "P5\n%d %d\n255\n", EPD_4in26_WIDTH, EPD_4in26_HEIGHT);
+        for (uint32_t i = 0; i < FB_BYTES; i++) {
+            for (int b = 7; b >= 0; b--) {
+                const uint8_t g = (uint8_t)(((s_ram24[i] >> b) & 1 ? 0 : 1) |
+                                            ((s_ram26[i] >> b) & 1 ? 0 : 2));
+                fputc((s_invert ? 3 - g : g) * 85, f);
+            }
+        }
+    } else {
+        fprintf(f, "P4\n%d %d\n", EPD_4in26_WIDTH, EPD_4in26_HEIGHT);
+        for (uint32_t i = 0; i < FB_BYTES; i++) {
+            fputc((uint8_t)(s_invert ? s_ram24[i] : ~s_ram24[i]), f);
+        }
+    }
+    fclose(f);
+}
+
+// 0x24/0x26 窗口写入（物理坐标，x/w 按字节对齐）
+static uint32_t copy_window(uint8_t *dst, const uint8_t *src, int x, int y, int w, int h) {
+    const int xb = x / 8;
+    const int wb = (x + w + 7) / 8 - xb;
+    for (int r = 0; r < h; r++) {
+        memcpy(dst + (uint32_t)(y + r) * FB_STRIDE + xb, src + (uint32_t)(y + r) * FB_STRIDE + xb,
+               (size_t)wb);
+    }
+    return (uint32_t)wb * (uint32_t)h;
+}
+
+static void account_upload(uint32_t bytes, int64_t start_us) {
+    s_summary.bytes += bytes;
+    s_stats.upload_bytes += bytes;
+    s_stats.upload_us += (UDOUBLE)(esp_timer_get_time() - start_us);
+}
+
+// 整帧上传经 SPI 实际发送的字节数，与驱动一致：全白行足够多时
+// 先自动填充两个平面，只上传有内容的行段（相隔不足 FILL_GAP_ROWS 的并为一段）
+static uint32_t full_upload_bytes(const uint8_t *img) {
+    bool white[EPD_4in26_HEIGHT];
+    int white_rows = 0;
+    for (int y = 0; y < EPD_4in26_HEIGHT; y++) {
+        const uint8_t *row = img + (uint32_t)y * FB_STRIDE;
+        white[y] = true;
+        for (int i = 0; i < FB_STRIDE; i++) {
+            if (row[i] != 0xFF) {
+                white[y] = false;
+                break;
+            }
+        }
+        white_rows += white[y];
+    }
+    if (white_rows < EPD_4in26_FILL_MIN_ROWS) {
+        return 2 * FB_BYTES;
+    }
+    int uploaded = 0;
+    for (int y = 0; y < EPD_4in26_HEIGHT;) {
+        if (white[y]) {
+            y++;
+            continue;
+        }
+        int last = y;
+        for (int r = y + 1; r < EPD_4in26_HEIGHT && r - last <= EPD_4in26_FILL_GAP_ROWS; r++) {
+            if (!white[r]) {
+                last = r;
+            }
+        }
+        uploaded += last - y + 1;
+        y = last + 1;
+    }
+    s_stats.fill_bytes += (UDOUBLE)(EPD_4in26_HEIGHT - uploaded) * FB_STRIDE * 2;
+    return (uint32_t)uploaded * FB_STRIDE * 2;
+}
+
+// 波形窗口结束通知（波形结束或被等待时）
+static void window_end(void) {
+    if (s_window_open) {
+        s_window_open = false;
+        if (s_window_cb != NULL) {
+            s_window_cb(false, 0, s_window_arg);
+        }
+    }
+}
+
+// 等待上一次（模拟的）波形结束
+static void wait_busy(void) {
+    const int64_t now = esp_timer_get_time();
+    if (s_busy_until_us > now) {
+        vTaskDelay(pdMS_TO_TICKS((uint32_t)((s_busy_until_us - now + 999) / 1000)));
+    }
+    s_busy_until_us = 0;
+    window_end();
+}
+
+// 启动刷新：记录统计、写快照，按模型等待或立即完成
+static void start_update(sim_epd_update_t type, uint32_t windows) {
+    s_summary.updates[type]++;
+    s_summary.wave_ms += s_wave_ms[type];
+    s_stats.updates++;
+    s_stats.busy_us += s_wave_ms[type] * 1000;
+    s_last_update_us = esp_timer_get_time();
+    log_event("update", s_update_names[type], 0, 0, 0, 0, windows);
+    s_frame_no++;
+    write_frame();
+    s_window_open = true;
+    if (s_window_cb != NULL) {
+        s_window_cb(true, s_wave_ms[type] * 1000, s_window_arg);
+    }
+
+    if (!s_cfg.realtime) {
+        window_end();
+        if (s_async && s_done_cb != NULL) {
+            s_done_cb(s_done_arg);
+        }
+        return;
+    }
+    s_busy_until_us = esp_timer_get_time() + (int64_t)s_wave_ms[type] * 1000;
+    if (s_async && s_done_timer != NULL) {
+        xTimerChangePeriod(s_done_timer, pdMS_TO_TICKS(s_wave_ms[type]), 0);
+    } else {
+        wait_busy();
+    }
+}
+
+// 定时器服务线程中调用，相当于固件的 BUSY 中断
+static void done_timer_cb(TimerHandle_t timer) {
+    (void)timer;
+    window_end();
+    if (s_done_cb != NULL) {
+        s_done_cb(s_done_arg);
+    }
+}
+
+static void ensure_init(EPD_4in26_Mode mode) {
+    wait_busy();
+    if (s_state == EPD_4in26_STATE_READY && s_mode == mode) {
+        return;
+    }
+    s_summary.inits++;
+    log_event("init", mode == EPD_4in26_MODE_4GRAY ? "gray" : "mono", 0, 0, 0, 0, 0);
+    s_state = EPD_4in26_STATE_READY;
+    s_mode = mode;
+}
+
+// ============================================================================
+// EPD_4in26.h 接口
+// ============================================================================
+
+void EPD_4in26_Init(void) {
+    pthread_mutex_lock(&s_lock);
+    s_state = EPD_4in26_STATE_COLD;
+    ensure_init(EPD_4in26_MODE_MONO);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_Init_Fast(void) { EPD_4in26_Init(); }
+
+void EPD_4in26_Init_4GRAY(void) {
+    pthread_mutex_lock(&s_lock);
+    s_state = EPD_4in26_STATE_COLD;
+    ensure_init(EPD_4in26_MODE_4GRAY);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_EnsureMode(EPD_4in26_Mode mode) {
+    pthread_mutex_lock(&s_lock);
+    ensure_init(mode);
+    pthread_mutex_unlock(&s_lock);
+}
+
+EPD_4in26_State EPD_4in26_GetState(void) { return s_state; }
+
+EPD_4in26_Mode EPD_4in26_GetMode(void) { return s_mode; }
+
+// 上传取代检查：模拟的上传是瞬时的，只在发出 0x20 之前检查一次
+static bool superseded(void) {
+    if (s_superseded_cb == NULL || !s_superseded_cb(s_superseded_arg)) {
+        return false;
+    }
+    s_stats.superseded++;
+    log_event("superseded", NULL, 0, 0, 0, 0, 0);
+    return true;
+}
+
+static bool display_full(UBYTE *Image, sim_epd_update_t type) {
+    pthread_mutex_lock(&s_lock);
+    ensure_init(EPD_4in26_MODE_MONO);
+    const int64_t start_us = esp_timer_get_time();
+    memcpy(s_ram24, Image, FB_BYTES);
+    memcpy(s_ram26, Image, FB_BYTES);
+    const uint32_t bytes = full_upload_bytes(Image);
+    account_upload(bytes, start_us);
+    log_event("window", s_update_names[type], 0, 0, EPD_4in26_WIDTH, EPD_4in26_HEIGHT, bytes);
+    s_gray_content = false;
+    const bool shown = !superseded();
+    if (shown) {
+        start_update(type, 1);
+    }
+    pthread_mutex_unlock(&s_lock);
+    return shown;
+}
+
+bool EPD_4in26_Display(UBYTE *Image) { return display_full(Image, SIM_EPD_UPDATE_FULL); }
+
+void EPD_4in26_Display_Base(UBYTE *Image) { display_full(Image, SIM_EPD_UPDATE_FULL); }
+
+bool EPD_4in26_Display_Fast(UBYTE *Image) { return display_full(Image, SIM_EPD_UPDATE_FAST); }
+
+bool EPD_4in26_Display_PartialMulti(UBYTE *Image, const EPD_4in26_Rect *rects, UBYTE count) {
+    pthread_mutex_lock(&s_lock);
+    ensure_init(EPD_4in26_MODE_MONO);
+    const int64_t start_us = esp_timer_get_time();
+    uint32_t bytes = 0;
+    for (UBYTE i = 0; i < count; i++) {
+        const EPD_4in26_Rect *r = &rects[i];
+        if (r->x + r->w > EPD_4in26_WIDTH || r->y + r->h > EPD_4in26_HEIGHT) {
+            ESP_LOGW(TAG, "Partial window out of range: (%u,%u) %ux%u", r->x, r->y, r->w, r->h);
+            continue;
+        }
+        // 局刷上传 0x24（新）与 0x26（旧）两个平面
+        memcpy(s_ram26, s_ram24, FB_BYTES);
+        const uint32_t n = copy_window(s_ram24, Image, r->x, r->y, r->w, r->h);
+        bytes += 2 * n;
+        s_summary.windows++;
+        s_summary.window_pixels += (uint64_t)r->w * r->h;
+        log_event("window", "partial", r->x, r->y, r->w, r->h, 2 * n);
+    }
+    account_upload(bytes, start_us);
+    s_gray_content = false;
+    const bool shown = !superseded();
+    if (shown) {
+        start_update(SIM_EPD_UPDATE_PARTIAL, count);
+    }
+    pthread_mutex_unlock(&s_lock);
+    return shown;
+}
+
+void EPD_4in26_Display_Partial(UBYTE *Image, UWORD x, UWORD y, UWORD w, UWORD h) {
+    const EPD_4in26_Rect r = {x, y, w, h};
+    EPD_4in26_Display_PartialMulti(Image, &r, 1);
+}
+
+void EPD_4in26_4GrayDisplay_Planes(const UBYTE *Plane24, const UBYTE *Plane26) {
+    pthread_mutex_lock(&s_lock);
+    ensure_init(EPD_4in26_MODE_4GRAY);
+    const int64_t start_us = esp_timer_get_time();
+    memcpy(s_ram24, Plane24, FB_BYTES);
+    memcpy(s_ram26, Plane26, FB_BYTES);
+    account_upload(2 * FB_BYTES, start_us);
+    log_event("window", "gray", 0, 0, EPD_4in26_WIDTH, EPD_4in26_HEIGHT, 2 * FB_BYTES);
+    s_gray_content = true;
+    start_update(SIM_EPD_UPDATE_GRAY, 1);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_4GrayDisplay_PartPlanes(const UBYTE *Plane24, const UBYTE *Plane26,
+                                       UWORD x, UWORD y, UWORD w, UWORD h) {
+    pthread_mutex_lock(&s_lock);
+    ensure_init(EPD_4in26_MODE_4GRAY);
+    const int64_t start_us = esp_timer_get_time();
+    const uint32_t n = copy_window(s_ram24, Plane24, x, y, w, h);
+    copy_window(s_ram26, Plane26, x, y, w, h);
+    account_upload(2 * n, start_us);
+    s_summary.windows++;
+    s_summary.window_pixels += (uint64_t)w * h;
+    log_event("window", "gray_partial", x, y, w, h, 2 * n);
+    s_gray_content = true;
+    start_update(SIM_EPD_UPDATE_GRAY_PARTIAL, 1);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_Hibernate(void) {
+    pthread_mutex_lock(&s_lock);
+    wait_busy();
+    s_summary.hibernates++;
+    s_state = EPD_4in26_STATE_SLEEP;
+    log_event("hibernate", NULL, 0, 0, 0, 0, 0);
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_Sleep(void) {
+    EPD_4in26_Hibernate();
+    s_mode = EPD_4in26_MODE_NONE;
+}
+
+void EPD_4in26_SetAsyncUpdate(bool enable, EPD_4in26_UpdateDoneCb cb, void *arg) {
+    pthread_mutex_lock(&s_lock);
+    wait_busy();
+    s_async = enable;
+    s_done_cb = cb;
+    s_done_arg = arg;
+    pthread_mutex_unlock(&s_lock);
+}
+
+bool EPD_4in26_IsBusy(void) { return s_busy_until_us > esp_timer_get_time(); }
+
+void EPD_4in26_SetSupersedeCheck(EPD_4in26_SupersededCb cb, void *arg) {
+    s_superseded_cb = cb;
+    s_superseded_arg = arg;
+}
+
+void EPD_4in26_SetBusyWindowHook(EPD_4in26_BusyWindowCb cb, void *arg) {
+    s_window_cb = cb;
+    s_window_arg = arg;
+}
+
+UDOUBLE EPD_4in26_GetWaveBusyUs(EPD_4in26_Wave wave) {
+    static const sim_epd_update_t types[EPD_4in26_WAVE_COUNT] = {
+        [EPD_4in26_WAVE_FULL] = SIM_EPD_UPDATE_FULL,
+        [EPD_4in26_WAVE_FAST] = SIM_EPD_UPDATE_FAST,
+        [EPD_4in26_WAVE_PARTIAL] = SIM_EPD_UPDATE_PARTIAL,
+        [EPD_4in26_WAVE_4GRAY] = SIM_EPD_UPDATE_GRAY,
+    };
+    return wave < EPD_4in26_WAVE_COUNT ? s_wave_ms[types[wave]] * 1000 : 0;
+}
+
+void EPD_4in26_WaitIdle(void) {
+    pthread_mutex_lock(&s_lock);
+    wait_busy();
+    pthread_mutex_unlock(&s_lock);
+}
+
+void EPD_4in26_ReadBusy(void) { EPD_4in26_WaitIdle(); }
+
+int EPD_4in26_ReadTemperature(void) { return 25; }
+
+void EPD_4in26_SetWaveTemperature(int celsius) { (void)celsius; }
+
+void EPD_4in26_SetInvert(bool invert) { s_invert = invert; }
+
+bool EPD_4in26_GetInvert(void) { return s_invert; }
+
+bool EPD_4in26_HasCap(UBYTE cap) {
+    const UBYTE all = EPD_PANEL_CAP_PARTIAL | EPD_PANEL_CAP_FAST | EPD_PANEL_CAP_4GRAY;
+    return (cap & all) == cap;
+}
+
+void EPD_4in26_GetStats(EPD_4in26_Stats *out) {
+    if (out != NULL) {
+        *out = s_stats;
+    }
+}
+
+void EPD_4in26_ResetStats(void) { memset(&s_stats, 0, sizeof(s_stats)); }
+
+int64_t EPD_4in26_GetLastUpdateUs(void) { return s_last_update_us; }
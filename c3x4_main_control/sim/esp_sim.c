@@ -0,0 +1,483 @@
+/**
+ * @file esp_sim.c
+ * @brief 主机模拟器：ESP-IDF 子集（计时、日志、堆、NVS、分区）、Wi-Fi 传输模式空实现与 /sdcard 路径映射
+ *
+ * 固件代码里的 SD 卡路径都是绝对路径 "/sdcard/..."。链接时用 --wrap 拦截
+ * fopen/opendir/stat/mkdir/remove/rename/open，把前缀替换为 sim_set_sdcard_root()
+ * 设置的主机目录（默认仓库里的 sdcard/），其他路径原样传递
+ */
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+#include "sim.h"
+#include "wifi_transfer.h"
+#include "usb_transfer.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static esp_log_level_t s_log_level = ESP_LOG_INFO;
+static pthread_mutex_t s_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static size_t s_heap_limit = 0;
+static size_t s_heap_used = 0;
+static pthread_mutex_t s_heap_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static struct timespec s_clock_start;
+static pthread_once_t s_clock_once = PTHREAD_ONCE_INIT;
+
+static void clock_init(void) { clock_gettime(CLOCK_MONOTONIC, &s_clock_start); }
+
+// 与 ESP32 一致：从启动（进程开始后第一次调用）起的微秒数
+int64_t esp_timer_get_time(void) {
+    struct timespec now;
+    pthread_once(&s_clock_once, clock_init);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)(now.tv_sec - s_clock_start.tv_sec) * 1000000 +
+           (now.tv_nsec - s_clock_start.tv_nsec) / 1000;
+}
+
+void esp_rom_delay_us(uint32_t us) {
+    const int64_t end = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end) {
+    }
+}
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+    case ESP_OK:                return "ESP_OK";
+    case ESP_FAIL:              return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:  return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_TIMEOUT:       return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_NVS_NOT_FOUND: return "ESP_ERR_NVS_NOT_FOUND";
+    default:                    return "UNKNOWN";
+    }
+}
+
+// ============================================================================
+// 日志
+// ============================================================================
+
+void sim_set_log_level(esp_log_level_t level) { s_log_level = level; }
+
+void esp_log_level_set(const char *tag, esp_log_level_t level) {
+    (void)tag;
+    s_log_level = level;
+}
+
+void sim_log(esp_log_level_t level, const char *tag, const char *fmt, ...) {
+    static const char letters[] = "NEWIDV";
+    if (level > s_log_level) {
+        return;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    pthread_mutex_lock(&s_log_lock);
+    fprintf(stderr, "%c (%lld) %s: ", letters[level],
+            (long long)(esp_timer_get_time() / 1000), tag);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    pthread_mutex_unlock(&s_log_lock);
+    va_end(ap);
+}
+
+// ============================================================================
+// 堆：按块头记录大小，SIM_HEAP_LIMIT 模拟可用堆上限
+// ============================================================================
+
+typedef struct {
+    size_t size;
+    size_t pad;
+} heap_hdr_t;
+
+void sim_set_heap_limit(size_t bytes) { s_heap_limit = bytes; }
+
+size_t sim_heap_used(void) { return s_heap_used; }
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    pthread_mutex_lock(&s_heap_lock);
+    const bool over = s_heap_limit != 0 && s_heap_used + size > s_heap_limit;
+    pthread_mutex_unlock(&s_heap_lock);
+    if (over) {
+        return NULL;
+    }
+
+    heap_hdr_t *h = malloc(sizeof(heap_hdr_t) + size);
+    if (h == NULL) {
+        return NULL;
+    }
+    h->size = size;
+    pthread_mutex_lock(&s_heap_lock);
+    s_heap_used += size;
+    pthread_mutex_unlock(&s_heap_lock);
+    return h + 1;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void *p = heap_caps_malloc(n * size, caps);
+    if (p != NULL) {
+        memset(p, 0, n * size);
+    }
+    return p;
+}
+
+void heap_caps_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    heap_hdr_t *h = (heap_hdr_t *)ptr - 1;
+    pthread_mutex_lock(&s_heap_lock);
+    s_heap_used -= h->size;
+    pthread_mutex_unlock(&s_heap_lock);
+    free(h);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+    if (ptr == NULL) {
+        return heap_caps_malloc(size, caps);
+    }
+    const size_t old = ((heap_hdr_t *)ptr - 1)->size;
+    void *p = heap_caps_malloc(size, caps);
+    if (p != NULL) {
+        memcpy(p, ptr, old < size ? old : size);
+        heap_caps_free(ptr);
+    }
+    return p;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    if (s_heap_limit == 0) {
+        return 256 * 1024;
+    }
+    return s_heap_used < s_heap_limit ? s_heap_limit - s_heap_used : 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+// 固件里 malloc 直接落到主机堆（不计入 SIM_HEAP_LIMIT），块大小由 glibc 给出
+size_t heap_caps_get_allocated_size(void *ptr) { return ptr != NULL ? malloc_usable_size(ptr) : 0; }
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = heap_caps_get_free_size(caps);
+    info->largest_free_block = info->total_free_bytes;
+    info->minimum_free_bytes = info->total_free_bytes;
+    info->total_allocated_bytes = s_heap_used;
+}
+
+esp_err_t heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback) {
+    (void)callback;
+    return ESP_OK;
+}
+
+// ============================================================================
+// NVS：命名空间 + 键的线性表，存 32 位整数或小块 blob
+// ============================================================================
+
+#define SIM_NVS_MAX_NS      8
+#define SIM_NVS_MAX_ENTRIES 64
+
+typedef struct {
+    uint8_t ns;
+    char key[16];
+    uint32_t value;
+    uint8_t *blob;        // 非 NULL 表示 blob 条目
+    size_t blob_len;
+} nvs_entry_t;
+
+static char s_nvs_ns[SIM_NVS_MAX_NS][16];
+static nvs_entry_t s_nvs[SIM_NVS_MAX_ENTRIES];
+static int s_nvs_count = 0;
+static pthread_mutex_t s_nvs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+esp_err_t nvs_flash_init(void) { return ESP_OK; }
+
+esp_err_t nvs_open(const char *ns, nvs_open_mode_t mode, nvs_handle_t *out) {
+    (void)mode;
+    pthread_mutex_lock(&s_nvs_lock);
+    for (uint32_t i = 0; i < SIM_NVS_MAX_NS; i++) {
+        if (s_nvs_ns[i][0] == '\0') {
+            strncpy(s_nvs_ns[i], ns, sizeof(s_nvs_ns[i]) - 1);
+        }
+        if (strncmp(s_nvs_ns[i], ns, sizeof(s_nvs_ns[i]) - 1) == 0) {
+            *out = i + 1;
+            pthread_mutex_unlock(&s_nvs_lock);
+            return ESP_OK;
+        }
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return ESP_ERR_NO_MEM;
+}
+
+void nvs_close(nvs_handle_t handle) { (void)handle; }
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    (void)handle;
+    return ESP_OK;
+}
+
+static nvs_entry_t *nvs_find(nvs_handle_t handle, const char *key, bool create) {
+    for (int i = 0; i < s_nvs_count; i++) {
+        if (s_nvs[i].ns == handle && strncmp(s_nvs[i].key, key, sizeof(s_nvs[i].key) - 1) == 0) {
+            return &s_nvs[i];
+        }
+    }
+    if (!create || s_nvs_count >= SIM_NVS_MAX_ENTRIES) {
+        return NULL;
+    }
+    nvs_entry_t *e = &s_nvs[s_nvs_count++];
+    e->ns = (uint8_t)handle;
+    strncpy(e->key, key, sizeof(e->key) - 1);
+    return e;
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out) {
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_entry_t *e = nvs_find(handle, key, false);
+    if (e != NULL) {
+        *out = e->value;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return e != NULL ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value) {
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_entry_t *e = nvs_find(handle, key, true);
+    if (e != NULL) {
+        e->value = value;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return e != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *out) {
+    return nvs_get_u32(handle, key, (uint32_t *)out);
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value) {
+    return nvs_set_u32(handle, key, (uint32_t)value);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out, size_t *length) {
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_entry_t *e = nvs_find(handle, key, false);
+    if (e == NULL || e->blob == NULL) {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    } else if (out == NULL) {
+        *length = e->blob_len;
+    } else if (*length < e->blob_len) {
+        err = ESP_ERR_NVS_INVALID_LENGTH;
+    } else {
+        memcpy(out, e->blob, e->blob_len);
+        *length = e->blob_len;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return err;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    uint8_t *copy = malloc(length > 0 ? length : 1);
+    if (copy == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(copy, value, length);
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_entry_t *e = nvs_find(handle, key, true);
+    if (e != NULL) {
+        free(e->blob);
+        e->blob = copy;
+        e->blob_len = length;
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    if (e == NULL) {
+        free(copy);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key) {
+    pthread_mutex_lock(&s_nvs_lock);
+    nvs_entry_t *e = nvs_find(handle, key, false);
+    if (e != NULL) {
+        free(e->blob);
+        *e = s_nvs[--s_nvs_count];
+    }
+    pthread_mutex_unlock(&s_nvs_lock);
+    return e != NULL ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+// ============================================================================
+// 分区：模拟器没有 flash，查找总是失败
+// ============================================================================
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label) {
+    (void)type;
+    (void)subtype;
+    (void)label;
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst,
+                             size_t size) {
+    (void)partition;
+    (void)src_offset;
+    (void)dst;
+    (void)size;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset,
+                              const void *src, size_t size) {
+    (void)partition;
+    (void)dst_offset;
+    (void)src;
+    (void)size;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size) {
+    (void)partition;
+    (void)offset;
+    (void)size;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle) {
+    (void)partition;
+    (void)offset;
+    (void)size;
+    (void)memory;
+    (void)out_ptr;
+    (void)out_handle;
+    return ESP_ERR_NOT_FOUND;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) { (void)handle; }
+
+// ============================================================================
+// Wi-Fi 传输模式（esp_wifi / esp_http_server 没有模拟，设置页的入口直接失败）
+// ============================================================================
+
+bool wifi_transfer_request(void) {
+    ESP_LOGW("SIM", "Wi-Fi transfer mode is not available in the simulator");
+    return false;
+}
+
+bool wifi_transfer_is_active(void) { return false; }
+
+// USB 传输模式同样没有模拟（USB Serial/JTAG 驱动）
+bool usb_transfer_request(void) {
+    ESP_LOGW("SIM", "USB transfer mode is not available in the simulator");
+    return false;
+}
+
+bool usb_transfer_is_active(void) { return false; }
+
+// ============================================================================
+// /sdcard 路径映射（链接选项 -Wl,--wrap=<sym>）
+// ============================================================================
+
+#define SDCARD_PREFIX "/sdcard"
+
+static char s_sdcard_root[PATH_MAX] = SIM_DEFAULT_SDCARD;
+
+void sim_set_sdcard_root(const char *dir) {
+    if (dir != NULL) {
+        strncpy(s_sdcard_root, dir, sizeof(s_sdcard_root) - 1);
+    }
+}
+
+// 返回映射后的路径（不是 /sdcard 前缀时返回原指针）
+static const char *sim_map_path(const char *path, char *buf, size_t len) {
+    const size_t plen = sizeof(SDCARD_PREFIX) - 1;
+    if (path == NULL || strncmp(path, SDCARD_PREFIX, plen) != 0 ||
+        (path[plen] != '\0' && path[plen] != '/')) {
+        return path;
+    }
+    snprintf(buf, len, "%s%s", s_sdcard_root, path + plen);
+    return buf;
+}
+
+FILE *__real_fopen(const char *path, const char *mode);
+DIR *__real_opendir(const char *path);
+int __real_stat(const char *path, struct stat *st);
+int __real_mkdir(const char *path, mode_t mode);
+int __real_remove(const char *path);
+int __real_unlink(const char *path);
+int __real_rename(const char *from, const char *to);
+int __real_open(const char *path, int flags, ...);
+
+FILE *__wrap_fopen(const char *path, const char *mode) {
+    char buf[PATH_MAX];
+    return __real_fopen(sim_map_path(path, buf, sizeof(buf)), mode);
+}
+
+DIR *__wrap_opendir(const char *path) {
+    char buf[PATH_MAX];
+    return __real_opendir(sim_map_path(path, buf, sizeof(buf)));
+}
+
+int __wrap_stat(const char *path, struct stat *st) {
+    char buf[PATH_MAX];
+    return __real_stat(sim_map_path(path, buf, sizeof(buf)), st);
+}
+
+int __wrap_mkdir(const char *path, mode_t mode) {
+    char buf[PATH_MAX];
+    return __real_mkdir(sim_map_path(path, buf, sizeof(buf)), mode);
+}
+
+int __wrap_remove(const char *path) {
+    char buf[PATH_MAX];
+    return __real_remove(sim_map_path(path, buf, sizeof(buf)));
+}
+
+int __wrap_unlink(const char *path) {
+    char buf[PATH_MAX];
+    return __real_unlink(sim_map_path(path, buf, sizeof(buf)));
+}
+
+int __wrap_rename(const char *from, const char *to) {
+    char a[PATH_MAX];
+    char b[PATH_MAX];
+    return __real_rename(sim_map_path(from, a, sizeof(a)), sim_map_path(to, b, sizeof(b)));
+}
+
+int __wrap_open(const char *path, int flags, ...) {
+    char buf[PATH_MAX];
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = (mode_t)va_arg(ap, int);
+        va_end(ap);
+    }
+    return __real_open(sim_map_path(path, buf, sizeof(buf)), flags, mode);
+}
@@ -0,0 +1,539 @@
+/**
+ * @file freertos_sim.c
+ * @brief 主机模拟器：FreeRTOS 子集的 pthread 实现
+ *
+ * 每个任务对应一个分离的 pthread，任务句柄携带通知值；没有通过 xTaskCreate
+ * 创建的线程（主线程、定时器服务线程）在第一次需要句柄时自动登记。
+ * 优先级与栈深度被忽略：主机上只关心调用顺序与耗时，不模拟调度
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct sim_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    char name[16];
+    uint32_t stack_depth;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t value;
+    bool pending;
+};
+
+struct sim_sem {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max;
+    bool is_static;
+};
+
+struct sim_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+struct sim_timer {
+    struct sim_timer *next;
+    TimerCallbackFunction_t cb;
+    void *id;
+    TickType_t period;
+    bool auto_reload;
+    bool active;
+    int64_t due_us;
+};
+
+static pthread_mutex_t s_critical = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread struct sim_task *s_self = NULL;
+
+static pthread_mutex_t s_timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_timer_cond = PTHREAD_COND_INITIALIZER;
+static struct sim_timer *s_timers = NULL;
+static bool s_timer_thread_started = false;
+
+void sim_enter_critical(void) { pthread_mutex_lock(&s_critical); }
+
+void sim_exit_critical(void) { pthread_mutex_unlock(&s_critical); }
+
+// 超时（tick = 1 ms）换算为 pthread_cond_timedwait 的绝对时间
+static void deadline_from_ticks(TickType_t ticks, struct timespec *ts) {
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec += ticks / 1000;
+    ts->tv_nsec += (long)(ticks % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+static struct sim_task *task_alloc(const char *name) {
+    struct sim_task *t = calloc(1, sizeof(*t));
+    if (t == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&t->lock, NULL);
+    pthread_cond_init(&t->cond, NULL);
+    strncpy(t->name, name != NULL ? name : "task", sizeof(t->name) - 1);
+    return t;
+}
+
+static void *task_entry(void *p) {
+    struct sim_task *t = p;
+    s_self = t;
+    t->fn(t->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                       void *arg, UBaseType_t priority, TaskHandle_t *out) {
+    (void)priority;
+    struct sim_task *t = task_alloc(name);
+    if (t == NULL) {
+        return pdFAIL;
+    }
+    t->stack_depth = stack_depth;
+    t->fn = fn;
+    t->arg = arg;
+    if (out != NULL) {
+        *out = t;
+    }
+    if (pthread_create(&t->thread, NULL, task_entry, t) != 0) {
+        free(t);
+        return pdFAIL;
+    }
+    pthread_detach(t->thread);
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == NULL || task == s_self) {
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {.tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000L};
+    if (ticks == 0) {
+        sched_yield();
+        return;
+    }
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void) { return (TickType_t)(esp_timer_get_time() / 1000); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    if (s_self == NULL) {
+        s_self = task_alloc("main");
+        if (s_self != NULL) {
+            s_self->thread = pthread_self();
+        }
+    }
+    return s_self;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    struct sim_task *t = task != NULL ? task : xTaskGetCurrentTaskHandle();
+    return t != NULL ? t->stack_depth : 0;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&task->lock);
+    switch (action) {
+    case eSetBits:
+        task->value |= value;
+        break;
+    case eIncrement:
+        task->value++;
+        break;
+    case eSetValueWithOverwrite:
+        task->value = value;
+        break;
+    case eSetValueWithoutOverwrite:
+        if (!task->pending) {
+            task->value = value;
+        }
+        break;
+    case eNoAction:
+    default:
+        break;
+    }
+    task->pending = true;
+    pthread_cond_broadcast(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action,
+                              BaseType_t *woken) {
+    if (woken != NULL) {
+        *woken = pdFALSE;
+    }
+    return xTaskNotify(task, value, action);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+                           uint32_t *value, TickType_t timeout) {
+    struct sim_task *t = xTaskGetCurrentTaskHandle();
+    struct timespec ts;
+    deadline_from_ticks(timeout, &ts);
+
+    pthread_mutex_lock(&t->lock);
+    if (!t->pending) {
+        t->value &= ~clear_on_entry;
+    }
+    while (!t->pending && timeout != 0) {
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&t->cond, &t->lock);
+        } else if (pthread_cond_timedwait(&t->cond, &t->lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    const bool got = t->pending;
+    if (value != NULL) {
+        *value = t->value;
+    }
+    if (got) {
+        t->value &= ~clear_on_exit;
+        t->pending = false;
+    }
+    pthread_mutex_unlock(&t->lock);
+    return got ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) { return xTaskNotify(task, 0, eIncrement); }
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    if (woken != NULL) {
+        *woken = pdFALSE;
+    }
+    xTaskNotifyGive(task);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t timeout) {
+    struct sim_task *t = xTaskGetCurrentTaskHandle();
+    struct timespec ts;
+    deadline_from_ticks(timeout, &ts);
+
+    pthread_mutex_lock(&t->lock);
+    while (t->value == 0 && timeout != 0) {
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&t->cond, &t->lock);
+        } else if (pthread_cond_timedwait(&t->cond, &t->lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    const uint32_t value = t->value;
+    if (value != 0) {
+        t->value = clear_on_exit ? 0 : value - 1;
+    }
+    t->pending = t->value != 0;
+    pthread_mutex_unlock(&t->lock);
+    return value;
+}
+
+static struct sim_sem *sem_init(struct sim_sem *s, UBaseType_t max, UBaseType_t initial) {
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->cond, NULL);
+    s->max = max;
+    s->count = initial;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+    struct sim_sem *s = calloc(1, sizeof(*s));
+    return s != NULL ? sem_init(s, max, initial) : NULL;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return xSemaphoreCreateCounting(1, 1); }
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return xSemaphoreCreateCounting(1, 0); }
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buf) {
+    // 实现对象仍在堆上：StaticSemaphore_t 只保存指针，vSemaphoreDelete 统一释放
+    SemaphoreHandle_t s = xSemaphoreCreateBinary();
+    if (buf != NULL) {
+        buf->impl = s;
+    }
+    return s;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&sem->lock);
+    pthread_cond_destroy(&sem->cond);
+    free(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout) {
+    if (sem == NULL) {
+        return pdFALSE;
+    }
+    struct timespec ts;
+    deadline_from_ticks(timeout, &ts);
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0 && timeout != 0) {
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        } else if (pthread_cond_timedwait(&sem->cond, &sem->lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    const bool got = sem->count > 0;
+    if (got) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return got ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return pdFALSE;
+    }
+    pthread_mutex_lock(&sem->lock);
+    const bool ok = sem->count < sem->max;
+    if (ok) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ok ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken) {
+    if (woken != NULL) {
+        *woken = pdFALSE;
+    }
+    return xSemaphoreGive(sem);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return 0;
+    }
+    pthread_mutex_lock(&sem->lock);
+    const UBaseType_t count = sem->count;
+    pthread_mutex_unlock(&sem->lock);
+    return count;
+}
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    struct sim_event_group *g = calloc(1, sizeof(*g));
+    if (g != NULL) {
+        pthread_mutex_init(&g->lock, NULL);
+        pthread_cond_init(&g->cond, NULL);
+    }
+    return g;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group) {
+    if (group == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&group->lock);
+    pthread_cond_destroy(&group->cond);
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    const EventBits_t now = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, EventBits_t bits,
+                                     BaseType_t *woken) {
+    if (woken != NULL) {
+        *woken = pdFALSE;
+    }
+    xEventGroupSetBits(group, bits);
+    return pdTRUE;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    pthread_mutex_lock(&group->lock);
+    const EventBits_t before = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return before;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+    pthread_mutex_lock(&group->lock);
+    const EventBits_t now = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear_on_exit, BaseType_t wait_for_all,
+                                TickType_t timeout) {
+    struct timespec ts;
+    deadline_from_ticks(timeout, &ts);
+
+    pthread_mutex_lock(&group->lock);
+    for (;;) {
+        const EventBits_t hit = group->bits & bits;
+        if ((wait_for_all ? hit == bits : hit != 0) || timeout == 0) {
+            break;
+        }
+        if (timeout == portMAX_DELAY) {
+            pthread_cond_wait(&group->cond, &group->lock);
+        } else if (pthread_cond_timedwait(&group->cond, &group->lock, &ts) == ETIMEDOUT) {
+            break;
+        }
+    }
+    // 与 FreeRTOS 一致：返回等待结束时的位，满足条件时才清除
+    const EventBits_t now = group->bits;
+    const EventBits_t hit = now & bits;
+    if (clear_on_exit && (wait_for_all ? hit == bits : hit != 0)) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return now;
+}
+
+// 定时器服务线程：回调在该线程中执行，与 FreeRTOS 的 timer task 一致
+static void *timer_service(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&s_timer_lock);
+    while (1) {
+        const int64_t now = esp_timer_get_time();
+        int64_t next_due = now + 100000;
+        struct sim_timer *fire = NULL;
+
+        for (struct sim_timer *t = s_timers; t != NULL; t = t->next) {
+            if (!t->active) {
+                continue;
+            }
+            if (t->due_us <= now) {
+                fire = t;
+                break;
+            }
+            if (t->due_us < next_due) {
+                next_due = t->due_us;
+            }
+        }
+
+        if (fire != NULL) {
+            if (fire->auto_reload) {
+                fire->due_us = now + (int64_t)fire->period * 1000;
+            } else {
+                fire->active = false;
+            }
+            TimerCallbackFunction_t cb = fire->cb;
+            pthread_mutex_unlock(&s_timer_lock);
+            cb(fire);
+            pthread_mutex_lock(&s_timer_lock);
+            continue;
+        }
+
+        struct timespec ts;
+        deadline_from_ticks((TickType_t)((next_due - now + 999) / 1000), &ts);
+        pthread_cond_timedwait(&s_timer_cond, &s_timer_lock, &ts);
+    }
+    return NULL;
+}
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload,
+                           void *id, TimerCallbackFunction_t cb) {
+    (void)name;
+    struct sim_timer *t = calloc(1, sizeof(*t));
+    if (t == NULL) {
+        return NULL;
+    }
+    t->cb = cb;
+    t->id = id;
+    t->period = period;
+    t->auto_reload = auto_reload != 0;
+
+    pthread_mutex_lock(&s_timer_lock);
+    t->next = s_timers;
+    s_timers = t;
+    if (!s_timer_thread_started) {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, timer_service, NULL) == 0) {
+            pthread_detach(thread);
+            s_timer_thread_started = true;
+        }
+    }
+    pthread_mutex_unlock(&s_timer_lock);
+    return t;
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t wait) {
+    (void)wait;
+    if (timer == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&s_timer_lock);
+    timer->active = true;
+    timer->due_us = esp_timer_get_time() + (int64_t)timer->period * 1000;
+    pthread_cond_signal(&s_timer_cond);
+    pthread_mutex_unlock(&s_timer_lock);
+    return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait) {
+    (void)wait;
+    if (timer == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&s_timer_lock);
+    timer->active = false;
+    pthread_mutex_unlock(&s_timer_lock);
+    return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait) {
+    if (timer == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&s_timer_lock);
+    timer->period = period;
+    pthread_mutex_unlock(&s_timer_lock);
+    // 与 FreeRTOS 一致：修改周期同时启动定时器
+    return xTimerStart(timer, wait);
+}
+
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t wait) {
+    (void)wait;
+    if (timer == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&s_timer_lock);
+    for (struct sim_timer **pp = &s_timers; *pp != NULL; pp = &(*pp)->next) {
+        if (*pp == timer) {
+            *pp = timer->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_timer_lock);
+    free(timer);
+    return pdPASS;
+}
+
+void *pvTimerGetTimerID(TimerHandle_t timer) { return timer != NULL ? timer->id : NULL; }
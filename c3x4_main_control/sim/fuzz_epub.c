@@ -0,0 +1,305 @@
+/**
+ * @file fuzz_epub.c
+ * @brief EPUB 解析器的模糊测试入口：epub_zip（中心目录、解压、流内跳转）、
+ *        epub_xml（container.xml、OPF、NCX / nav）与 epub_html（文本块与序列化记录）
+ *
+ * 输入的第一个字节选择目标，其余为文档内容。XML / HTML 按随输入变化的块大小分段送入，
+ * 覆盖跨块边界的状态；ZIP 写入映射为 /sdcard 的临时目录后打开，解压每个条目并在流中跳转。
+ * 文本块的不变量（长度、样式区间、序列化往返）不成立时 abort()。
+ *
+ * 用 clang 配置 -DSIM_FUZZ=ON 时链接 libFuzzer：
+ *   ./build_sim/c3x4_fuzz_epub corpus/ -timeout=2 -rss_limit_mb=512
+ * 其他编译器生成回放程序，依次运行命令行给出的文件并报告最慢的输入：
+ *   ./build_sim/c3x4_fuzz_epub crash-xxxx corpus/0001 corpus/0002
+ */
+
+#include "sim.h"
+#include "lvgl.h"
+#include "ui/epub_xml.h"
+#include "ui/epub_html.h"
+#include "ui/epub_zip.h"
+#include "power_manager.h"
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FUZZ_ZIP_PATH     "/sdcard/fuzz.epub"
+#define FUZZ_MAX_ENTRIES  64
+#define FUZZ_EXTRACT_CAP  (4 * 1024 * 1024)   // 每个条目最多交出的字节数，超出即判为解压无界
+
+typedef enum {
+    FUZZ_CONTAINER,
+    FUZZ_OPF,
+    FUZZ_NCX,
+    FUZZ_NAV,
+    FUZZ_HTML,
+    FUZZ_ZIP,
+    FUZZ_MODE_COUNT
+} fuzz_mode_t;
+
+// epub_zip 在解压期间持有电源锁；主机上没有 power_manager.c
+void power_manager_lock(power_lock_t lock) { (void)lock; }
+void power_manager_unlock(power_lock_t lock) { (void)lock; }
+
+static volatile uint64_t s_sink;
+
+static void fuzz_init(void) {
+    static bool done;
+    if (done) {
+        return;
+    }
+    done = true;
+    static char root[] = "/tmp/c3x4_fuzz_XXXXXX";
+    if (mkdtemp(root) == NULL) {
+        perror("mkdtemp");
+        abort();
+    }
+    sim_set_sdcard_root(root);
+    sim_set_log_level(ESP_LOG_NONE);
+    lv_init();
+}
+
+// 块大小取决于输入长度，同一输入每次的切分相同
+static size_t chunk_size(size_t size) {
+    return 1 + size % 509;
+}
+
+static void feed_xml(const uint8_t *data, size_t size, const epub_xml_handler_t *handler) {
+    epub_xml_parser_t *xml = epub_xml_create(handler);
+    if (xml == NULL) {
+        return;
+    }
+    const size_t step = chunk_size(size);
+    for (size_t off = 0; off < size; off += step) {
+        const size_t n = size - off < step ? size - off : step;
+        if (!epub_xml_feed(xml, (const char *)data + off, n)) {
+            break;
+        }
+    }
+    epub_xml_finish(xml);
+    epub_xml_destroy(xml);
+}
+
+static void fuzz_opf(const uint8_t *data, size_t size) {
+    epub_xml_opf_t *opf = epub_xml_opf_create();
+    if (opf == NULL) {
+        return;
+    }
+    epub_xml_handler_t handler;
+    epub_xml_opf_handler(opf, &handler);
+    feed_xml(data, size, &handler);
+    const int count = epub_xml_opf_resolve(opf);
+    for (int i = 0; i < count; i++) {
+        const char *href = epub_xml_opf_spine_href(opf, i);
+        s_sink += href != NULL ? strlen(href) : 0;
+    }
+    bool is_nav = false;
+    const char *toc = epub_xml_opf_toc_href(opf, &is_nav);
+    const char *cover = epub_xml_opf_cover_href(opf);
+    s_sink += (toc ? strlen(toc) : 0) + (cover ? strlen(cover) : 0);
+    s_sink += strlen(epub_xml_opf_metadata(opf)->title);
+    epub_xml_opf_destroy(opf);
+}
+
+static void toc_entry(void *user, const char *href, const char *title, int depth) {
+    (void)user;
+    if (depth < 0) {
+        abort();
+    }
+    s_sink += strlen(href) + strlen(title);
+}
+
+static void fuzz_toc(const uint8_t *data, size_t size, bool nav) {
+    epub_xml_toc_t *toc = epub_xml_toc_create(nav, toc_entry, NULL);
+    if (toc == NULL) {
+        return;
+    }
+    epub_xml_handler_t handler;
+    epub_xml_toc_handler(toc, &handler);
+    feed_xml(data, size, &handler);
+    epub_xml_toc_finish(toc);
+    epub_xml_toc_destroy(toc);
+}
+
+static void fuzz_container(const uint8_t *data, size_t size) {
+    epub_xml_container_t container;
+    memset(&container, 0, sizeof(container));
+    epub_xml_handler_t handler;
+    epub_xml_container_handler(&handler, &container);
+    feed_xml(data, size, &handler);
+    s_sink += strnlen(container.rootfile, sizeof(container.rootfile));
+}
+
+// 文本块必须自洽，并且序列化后能原样读回
+static bool check_block(const epub_text_block_t *block, void *user) {
+    (void)user;
+    if (block->type == EPUB_TEXT_BLOCK_IMAGE) {
+        if (block->image_src == NULL) {
+            abort();
+        }
+    } else {
+        if (block->text == NULL || block->text_length < 0 ||
+            strlen(block->text) != (size_t)block->text_length) {
+            abort();
+        }
+        int prev = 0;
+        for (int i = 0; i < block->span_count; i++) {
+            const epub_style_span_t *sp = &block->spans[i];
+            if (sp->offset < prev || sp->offset + sp->length > block->text_length) {
+                abort();
+            }
+            prev = sp->offset;
+        }
+    }
+
+    static uint16_t record[EPUB_HTML_ARENA_SIZE + 256];   // 记录要求 2 字节对齐
+    const size_t size = epub_html_record_size(block);
+    if (size > sizeof(record) || epub_html_write_record(block, record) != size) {
+        abort();
+    }
+    epub_text_block_t back;
+    if (epub_html_read_record(record, size, &back) != size || back.type != block->type ||
+        back.span_count != block->span_count) {
+        abort();
+    }
+    if (block->type != EPUB_TEXT_BLOCK_IMAGE &&
+        (back.text_length != block->text_length || memcmp(back.text, block->text, block->text_length) != 0)) {
+        abort();
+    }
+    return true;
+}
+
+static void fuzz_html(const uint8_t *data, size_t size) {
+    epub_html_parser_t *html = epub_html_create(check_block, NULL);
+    if (html == NULL) {
+        return;
+    }
+    const size_t step = chunk_size(size);
+    bool more = true;
+    for (size_t off = 0; more && off < size; off += step) {
+        const size_t n = size - off < step ? size - off : step;
+        more = epub_html_feed(html, (const char *)data + off, n);
+    }
+    if (more) {
+        epub_html_finish(html);
+    }
+    epub_html_destroy(html);
+}
+
+typedef struct {
+    size_t bytes;
+} sink_state_t;
+
+static bool sink_output(const void *data, size_t len, void *user) {
+    sink_state_t *s = (sink_state_t *)user;
+    s->bytes += len;
+    s_sink += len > 0 ? ((const uint8_t *)data)[len - 1] : 0;
+    if (s->bytes > FUZZ_EXTRACT_CAP) {
+        abort();   // 中心目录的大小校验应当已经拒绝了这样的条目
+    }
+    return true;
+}
+
+static void fuzz_zip(const uint8_t *data, size_t size) {
+    FILE *f = fopen(FUZZ_ZIP_PATH, "wb");
+    if (f == NULL) {
+        return;
+    }
+    fwrite(data, 1, size, f);
+    fclose(f);
+
+    s_sink += epub_zip_probe(FUZZ_ZIP_PATH);
+    epub_zip_t *zip = epub_zip_open(FUZZ_ZIP_PATH);
+    if (zip == NULL) {
+        return;
+    }
+    static epub_zip_file_info_t files[FUZZ_MAX_ENTRIES];
+    const int count = epub_zip_list_files(zip, NULL, files, FUZZ_MAX_ENTRIES);
+    for (int i = 0; i < count; i++) {
+        if (files[i].uncompressed_size > FUZZ_EXTRACT_CAP) {
+            continue;
+        }
+        epub_zip_file_info_t found;
+        if (!epub_zip_find_file(zip, files[i].filename, &found)) {
+            abort();   // 列出的条目必须能按名字找到
+        }
+        sink_state_t s = {0};
+        const int n = epub_zip_extract_to_callback(zip, &files[i], sink_output, &s);
+        if (n >= 0 && (size_t)n != s.bytes) {
+            abort();
+        }
+
+        epub_zip_stream_t *stream = epub_zip_stream_open(zip, &files[i]);
+        if (stream != NULL) {
+            uint8_t buf[512];
+            const uint32_t mid = files[i].uncompressed_size / 2;
+            if (epub_zip_stream_seek(stream, mid) && epub_zip_stream_tell(stream) != mid) {
+                abort();
+            }
+            s_sink += (uint64_t)epub_zip_stream_read(stream, buf, sizeof(buf));
+            epub_zip_stream_seek(stream, 0);
+            s_sink += (uint64_t)epub_zip_stream_read(stream, buf, sizeof(buf));
+            epub_zip_stream_close(stream);
+        }
+    }
+    epub_zip_close(zip);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    fuzz_init();
+    if (size < 1) {
+        return 0;
+    }
+    const fuzz_mode_t mode = (fuzz_mode_t)(data[0] % FUZZ_MODE_COUNT);
+    data++;
+    size--;
+    switch (mode) {
+        case FUZZ_CONTAINER: fuzz_container(data, size); break;
+        case FUZZ_OPF:       fuzz_opf(data, size); break;
+        case FUZZ_NCX:       fuzz_toc(data, size, false); break;
+        case FUZZ_NAV:       fuzz_toc(data, size, true); break;
+        case FUZZ_HTML:      fuzz_html(data, size); break;
+        case FUZZ_ZIP:       fuzz_zip(data, size); break;
+        default: break;
+    }
+    return 0;
+}
+
+#ifndef SIM_FUZZ_LIBFUZZER
+// 回放：依次运行给出的文件，报告最慢的输入（libFuzzer 的 -timeout 对应这里的耗时）
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s INPUT...\n", argv[0]);
+        return 2;
+    }
+    int64_t worst_us = 0;
+    const char *worst = NULL;
+    for (int i = 1; i < argc; i++) {
+        FILE *f = fopen(argv[i], "rb");
+        if (f == NULL) {
+            fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+        fseek(f, 0, SEEK_END);
+        const long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        uint8_t *buf = malloc(size > 0 ? (size_t)size : 1);
+        const size_t n = buf != NULL ? fread(buf, 1, (size_t)(size > 0 ? size : 0), f) : 0;
+        fclose(f);
+
+        const int64_t t0 = esp_timer_get_time();
+        LLVMFuzzerTestOneInput(buf, n);
+        const int64_t us = esp_timer_get_time() - t0;
+        free(buf);
+        if (us > worst_us) {
+            worst_us = us;
+            worst = argv[i];
+        }
+    }
+    printf("%d inputs, slowest %s: %lld us\n", argc - 1, worst ? worst : "-", (long long)worst_us);
+    return 0;
+}
+#endif
@@ -0,0 +1,976 @@
+/**
+ * @file hostbench.c
+ * @brief 主机微基准：在桌面上测量 epub_xml / epub_html / epub_zip / txt_reader / gb18030 /
+ *        font_stream 的吞吐量，用于验证索引、流式解析等算法改动
+ *
+ * 用法：c3x4_hostbench [--filter SUBSTR] [--min-time SEC] [--csv FILE] [--label STR]
+ *                      [--font PATH] [--list]
+ *
+ * 输入数据在启动时生成到临时目录（映射为 /sdcard），每个基准先做一次结果校验
+ * （spine 数、文本块数、解压内容 CRC、转码长度等），校验失败时进程返回 1，
+ * 因此也可作为这些模块的回归检查。计时按 Google Benchmark 的方式自动加倍迭代次数，
+ * 直到总时间超过 --min-time（默认 0.5 s）且不少于基准自身的最少迭代次数。
+ * --csv 在文件末尾追加 version,label,benchmark,iterations,ns_per_op,mb_per_s,items_per_s，
+ * --label 通常传 git 提交号，便于跨提交对比。主机耗时不代表 ESP32-C3 上的耗时，只用于相对比较
+ */
+
+#include "sim.h"
+#include "lvgl.h"
+#include "version.h"
+#include "miniz.h"
+#include "ui/epub_xml.h"
+#include "ui/epub_html.h"
+#include "ui/epub_zip.h"
+#include "ui/txt_reader.h"
+#include "ui/gb18030.h"
+#include "ui/font_stream.h"
+#include "ui/file_pool.h"
+#include "power_manager.h"
+#include "esp_timer.h"
+
+#include <ftw.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FEED_CHUNK        4096      // 与 ZIP 解压回调的分块大小相当
+#define OPF_ITEMS         200
+#define NCX_POINTS        300
+#define XHTML_PARAGRAPHS  4000
+#define XHTML_HEADINGS    40
+#define XHTML_IMAGES      20
+#define TEXT_BYTES        (4 * 1024 * 1024)
+#define ZIP_CHAPTER_BYTES (1024 * 1024)
+#define ZIP_SMALL_ENTRIES 300
+#define PEEK_BYTES        2048      // 与阅读器一页的读取量相当
+#define GLYPH_SAMPLES     4096
+
+static const char *TAG = "HOSTBENCH";
+
+// epub_zip 在解压期间持有电源锁；主机上没有 power_manager.c
+void power_manager_lock(power_lock_t lock) { (void)lock; }
+void power_manager_unlock(power_lock_t lock) { (void)lock; }
+
+// ---------------------------------------------------------------------------
+// 通用工具
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} buf_t;
+
+static void buf_append(buf_t *b, const char *data, size_t len) {
+    if (b->len + len + 1 > b->cap) {
+        size_t cap = b->cap ? b->cap : 4096;
+        while (b->len + len + 1 > cap) {
+            cap *= 2;
+        }
+        b->data = realloc(b->data, cap);
+        if (b->data == NULL) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        b->cap = cap;
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+    b->data[b->len] = '\0';
+}
+
+static void buf_printf(buf_t *b, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void buf_printf(buf_t *b, const char *fmt, ...) {
+    char tmp[1024];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, ap);
+    va_end(ap);
+    if (n > 0) {
+        buf_append(b, tmp, (size_t)n < sizeof(tmp) ? (size_t)n : sizeof(tmp) - 1);
+    }
+}
+
+static bool write_file(const char *path, const void *data, size_t len) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    const bool ok = fwrite(data, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+}
+
+static uint32_t s_rand = 0x58344842u;
+
+static uint32_t next_rand(void) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand;
+}
+
+#define CHECK(cond, ...) do {                      \
+        if (!(cond)) {                             \
+            fprintf(stderr, "CHECK FAILED %s:%d: ", __func__, __LINE__); \
+            fprintf(stderr, __VA_ARGS__);          \
+            fprintf(stderr, "\n");                 \
+            return BENCH_FAIL;                     \
+        }                                          \
+    } while (0)
+
+// 防止编译器把结果当作无用代码删掉
+static volatile uint64_t s_sink;
+
+// ---------------------------------------------------------------------------
+// 基准登记
+// ---------------------------------------------------------------------------
+
+typedef enum {
+    BENCH_OK,
+    BENCH_SKIP,   // 缺少输入（如未给 --font）
+    BENCH_FAIL,   // 结果校验失败
+} bench_status_t;
+
+typedef struct {
+    const char *name;
+    bench_status_t (*setup)(void);  // 生成输入并校验一次结果
+    void (*run)(uint64_t iters);
+    uint64_t min_iters;
+    size_t bytes_per_iter;          // 0 表示不输出 MB/s
+    uint64_t items_per_iter;        // 0 表示不输出 items/s
+} bench_t;
+
+// ---------------------------------------------------------------------------
+// epub_xml：content.opf 与 toc.ncx
+// ---------------------------------------------------------------------------
+
+static buf_t s_opf;
+static buf_t s_ncx;
+
+static void build_opf(buf_t *b) {
+    buf_printf(b, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                  "<package xmlns=\"http://www.idpf.org/2007/opf\" version=\"3.0\" unique-identifier=\"uid\">\n"
+                  "<metadata xmlns:dc=\"http://purl.org/dc/elements/1.1/\">\n"
+                  "<dc:title>Tom &amp; Jerry &#x4E2D;</dc:title>\n"
+                  "<dc:creator opf:role=\"aut\">Host Bench</dc:creator>\n"
+                  "<dc:language>zh-CN</dc:language>\n"
+                  "<dc:identifier id=\"uid\">urn:uuid:00000000-0000-0000-0000-000000000099</dc:identifier>\n"
+                  "<meta name=\"cover\" content=\"cover-img\"/>\n"
+                  "</metadata>\n<manifest>\n"
+                  "<item id=\"ncx\" href=\"toc.ncx\" media-type=\"application/x-dtbncx+xml\"/>\n"
+                  "<item id=\"nav\" href=\"nav.xhtml\" media-type=\"application/xhtml+xml\" properties=\"nav\"/>\n"
+                  "<item id=\"cover-img\" href=\"Images/cover.jpg\" media-type=\"image/jpeg\"/>\n");
+    // manifest 与 spine 顺序相反，检验 id → href 查找而不是按位置对应
+    for (int i = OPF_ITEMS - 1; i >= 0; i--) {
+        buf_printf(b, "<item id=\"c%03d\" href=\"Text/chapter%03d.xhtml\" "
+                      "media-type=\"application/xhtml+xml\"/>\n", i, i);
+    }
+    buf_printf(b, "</manifest>\n<spine toc=\"ncx\">\n");
+    for (int i = 0; i < OPF_ITEMS; i++) {
+        buf_printf(b, "<itemref idref=\"c%03d\"/>\n", i);
+    }
+    buf_printf(b, "</spine>\n</package>\n");
+}
+
+static void build_ncx(buf_t *b) {
+    buf_printf(b, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                  "<ncx xmlns=\"http://www.daisy.org/z3986/2005/ncx/\" version=\"2005-1\">\n"
+                  "<docTitle><text>Bench</text></docTitle>\n<navMap>\n");
+    for (int i = 0; i < NCX_POINTS; i++) {
+        // 每 10 个为一组，组内第二层
+        const bool child = (i % 10) != 0;
+        buf_printf(b, "<navPoint id=\"p%d\" playOrder=\"%d\"><navLabel><text>第 %d 章</text></navLabel>"
+                      "<content src=\"Text/chapter%03d.xhtml#s%d\"/>%s\n",
+                   i, i + 1, i + 1, i % OPF_ITEMS, i, child ? "</navPoint>" : "");
+        if (i % 10 == 9) {
+            buf_printf(b, "</navPoint>\n");
+        }
+    }
+    buf_printf(b, "</navMap>\n</ncx>\n");
+}
+
+static bool feed_chunks(epub_xml_parser_t *xml, const buf_t *b) {
+    for (size_t off = 0; off < b->len; off += FEED_CHUNK) {
+        const size_t n = b->len - off < FEED_CHUNK ? b->len - off : FEED_CHUNK;
+        if (!epub_xml_feed(xml, b->data + off, n)) {
+            return false;
+        }
+    }
+    return epub_xml_finish(xml);
+}
+
+// 解析一次 OPF，返回 spine 数；keep 非 NULL 时交出句柄供校验
+static int parse_opf(epub_xml_opf_t **keep) {
+    epub_xml_opf_t *opf = epub_xml_opf_create();
+    if (opf == NULL) {
+        return -1;
+    }
+    epub_xml_handler_t handler;
+    epub_xml_opf_handler(opf, &handler);
+    epub_xml_parser_t *xml = epub_xml_create(&handler);
+    const bool ok = xml != NULL && feed_chunks(xml, &s_opf);
+    epub_xml_destroy(xml);
+    const int count = ok ? epub_xml_opf_resolve(opf) : -1;
+    if (keep != NULL) {
+        *keep = opf;
+    } else {
+        epub_xml_opf_destroy(opf);
+    }
+    return count;
+}
+
+static bench_status_t setup_opf(void) {
+    if (s_opf.len == 0) {
+        build_opf(&s_opf);
+    }
+    epub_xml_opf_t *opf = NULL;
+    const int count = parse_opf(&opf);
+    CHECK(count == OPF_ITEMS, "spine count %d, expected %d", count, OPF_ITEMS);
+
+    char expect[64];
+    for (int i = 0; i < OPF_ITEMS; i += 37) {
+        snprintf(expect, sizeof(expect), "Text/chapter%03d.xhtml", i);
+        const char *href = epub_xml_opf_spine_href(opf, i);
+        CHECK(href != NULL && strcmp(href, expect) == 0, "spine[%d] = %s", i, href ? href : "(null)");
+    }
+    const epub_xml_metadata_t *meta = epub_xml_opf_metadata(opf);
+    CHECK(strcmp(meta->title, "Tom & Jerry \xE4\xB8\xAD") == 0, "title '%s'", meta->title);
+    CHECK(strcmp(meta->author, "Host Bench") == 0, "author '%s'", meta->author);
+    bool is_nav = false;
+    const char *toc = epub_xml_opf_toc_href(opf, &is_nav);
+    CHECK(toc != NULL && strcmp(toc, "nav.xhtml") == 0 && is_nav, "toc %s nav=%d",
+          toc ? toc : "(null)", is_nav);
+    const char *cover = epub_xml_opf_cover_href(opf);
+    CHECK(cover != NULL && strcmp(cover, "Images/cover.jpg") == 0, "cover %s", cover ? cover : "(null)");
+    epub_xml_opf_destroy(opf);
+    return BENCH_OK;
+}
+
+static void run_opf(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sink += (uint64_t)parse_opf(NULL);
+    }
+}
+
+typedef struct {
+    int count;
+    int max_depth;
+    bool first_ok;
+} toc_count_t;
+
+static void count_toc(void *user, const char *href, const char *title, int depth) {
+    toc_count_t *c = (toc_count_t *)user;
+    if (c->count == 0) {
+        c->first_ok = strcmp(href, "Text/chapter000.xhtml#s0") == 0 &&
+                      strcmp(title, "第 1 章") == 0;
+    }
+    c->count++;
+    if (depth > c->max_depth) {
+        c->max_depth = depth;
+    }
+}
+
+static int parse_ncx(toc_count_t *c) {
+    memset(c, 0, sizeof(*c));
+    epub_xml_toc_t *toc = epub_xml_toc_create(false, count_toc, c);
+    if (toc == NULL) {
+        return -1;
+    }
+    epub_xml_handler_t handler;
+    epub_xml_toc_handler(toc, &handler);
+    epub_xml_parser_t *xml = epub_xml_create(&handler);
+    const bool ok = xml != NULL && feed_chunks(xml, &s_ncx);
+    epub_xml_destroy(xml);
+    epub_xml_toc_finish(toc);
+    epub_xml_toc_destroy(toc);
+    return ok ? c->count : -1;
+}
+
+static bench_status_t setup_ncx(void) {
+    if (s_ncx.len == 0) {
+        build_ncx(&s_ncx);
+    }
+    toc_count_t c;
+    const int count = parse_ncx(&c);
+    CHECK(count == NCX_POINTS, "toc entries %d, expected %d", count, NCX_POINTS);
+    CHECK(c.first_ok, "first entry mismatch");
+    CHECK(c.max_depth >= 1, "nested navPoint depth %d", c.max_depth);
+    return BENCH_OK;
+}
+
+static void run_ncx(uint64_t iters) {
+    toc_count_t c;
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sink += (uint64_t)parse_ncx(&c);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// epub_html：大章节分词与分块
+// ---------------------------------------------------------------------------
+
+static buf_t s_xhtml;
+
+typedef struct {
+    int text;
+    int headings;
+    int images;
+    size_t text_bytes;
+    bool entity_ok;
+} html_count_t;
+
+static bool count_block(const epub_text_block_t *block, void *user) {
+    html_count_t *c = (html_count_t *)user;
+    switch (block->type) {
+        case EPUB_TEXT_BLOCK_HEADING: c->headings++; break;
+        case EPUB_TEXT_BLOCK_IMAGE:   c->images++; break;
+        default:
+            if (c->text == 0) {
+                c->entity_ok = strstr(block->text, "A & B \xE4\xB8\xAD") != NULL;
+            }
+            c->text++;
+            break;
+    }
+    c->text_bytes += (size_t)block->text_length;
+    return true;
+}
+
+static void build_xhtml(buf_t *b) {
+    static const char *const words[] = {
+        "电子墨水屏", "阅读器", "的", "排版", "分页", "字形", "缓存", "章节",
+        "reader", "layout", "glyph", "cache", "page",
+    };
+    buf_printf(b, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+                  "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>Bench</title>\n"
+                  "<style>p { text-indent: 2em; } .c { text-align: center; }</style>\n"
+                  "<script>var x = \"<p>not text</p>\";</script></head>\n<body>\n");
+    const int per_heading = XHTML_PARAGRAPHS / XHTML_HEADINGS;
+    const int per_image = XHTML_PARAGRAPHS / XHTML_IMAGES;
+    for (int p = 0; p < XHTML_PARAGRAPHS; p++) {
+        if (p % per_heading == 0) {
+            buf_printf(b, "<h2 id=\"s%d\">第 %d 节</h2>\n", p / per_heading, p / per_heading + 1);
+        }
+        if (p % per_image == per_image / 2) {
+            buf_printf(b, "<div class=\"c\"><img src=\"../Images/i%d.jpg\" alt=\"\"/></div>\n", p);
+        }
+        buf_printf(b, "<p%s>", (p & 3) == 0 ? " style=\"text-indent:0\"" : "");
+        if (p == 0) {
+            buf_printf(b, "A &amp; B &#x4E2D; ");
+        }
+        const int n = 20 + (int)(next_rand() % 60);
+        for (int w = 0; w < n; w++) {
+            const char *word = words[next_rand() % (sizeof(words) / sizeof(words[0]))];
+            switch (next_rand() % 16) {
+                case 0:  buf_printf(b, "<b>%s</b>", word); break;
+                case 1:  buf_printf(b, "<i>%s</i> ", word); break;
+                case 2:  buf_printf(b, "<span class=\"x\">%s</span>", word); break;
+                case 3:  buf_printf(b, "%s&nbsp;", word); break;
+                default: buf_printf(b, "%s ", word); break;
+            }
+        }
+        buf_printf(b, "</p>\n");
+    }
+    buf_printf(b, "</body></html>\n");
+}
+
+static bool tokenize_xhtml(html_count_t *c) {
+    memset(c, 0, sizeof(*c));
+    epub_html_parser_t *html = epub_html_create(count_block, c);
+    if (html == NULL) {
+        return false;
+    }
+    bool ok = true;
+    for (size_t off = 0; ok && off < s_xhtml.len; off += FEED_CHUNK) {
+        const size_t n = s_xhtml.len - off < FEED_CHUNK ? s_xhtml.len - off : FEED_CHUNK;
+        ok = epub_html_feed(html, s_xhtml.data + off, n);
+    }
+    epub_html_finish(html);
+    epub_html_destroy(html);
+    return ok;
+}
+
+static bench_status_t setup_xhtml(void) {
+    html_count_t c;
+    CHECK(tokenize_xhtml(&c), "parser error");
+    CHECK(c.text == XHTML_PARAGRAPHS, "text blocks %d, expected %d", c.text, XHTML_PARAGRAPHS);
+    CHECK(c.headings == XHTML_HEADINGS, "headings %d, expected %d", c.headings, XHTML_HEADINGS);
+    CHECK(c.images == XHTML_IMAGES, "images %d, expected %d", c.images, XHTML_IMAGES);
+    CHECK(c.entity_ok, "entities not decoded in first paragraph");
+    return BENCH_OK;
+}
+
+static void run_xhtml(uint64_t iters) {
+    html_count_t c;
+    for (uint64_t i = 0; i < iters; i++) {
+        tokenize_xhtml(&c);
+        s_sink += c.text_bytes;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// gb18030：GBK 文本转 UTF-8
+// ---------------------------------------------------------------------------
+
+static uint8_t *s_gbk;
+static size_t s_gbk_len;
+static size_t s_gbk_expect;   // 期望的 UTF-8 字节数（GB2312 汉字区均为 3 字节）
+
+static void build_gbk(void) {
+    s_gbk = malloc(TEXT_BYTES);
+    size_t n = 0;
+    s_gbk_expect = 0;
+    while (n + 2 <= TEXT_BYTES) {
+        if (next_rand() % 8 == 0) {
+            s_gbk[n++] = (next_rand() % 5 == 0) ? '\n' : (uint8_t)('a' + next_rand() % 26);
+            s_gbk_expect += 1;
+        } else {
+            // GB2312 一级汉字区：0xB0A1-0xD7F9
+            s_gbk[n++] = (uint8_t)(0xB0 + next_rand() % 0x28);
+            s_gbk[n++] = (uint8_t)(0xA1 + next_rand() % 0x59);
+            s_gbk_expect += 3;
+        }
+    }
+    s_gbk_len = n;
+}
+
+static size_t convert_gbk(bool *replacement) {
+    static char out[FEED_CHUNK * 2];
+    size_t off = 0;
+    size_t total = 0;
+    while (off < s_gbk_len) {
+        const size_t chunk = s_gbk_len - off < FEED_CHUNK ? s_gbk_len - off : FEED_CHUNK;
+        size_t used = 0;
+        const size_t n = gb18030_to_utf8(s_gbk + off, chunk, off + chunk >= s_gbk_len,
+                                         out, sizeof(out), &used);
+        if (used == 0) {
+            break;
+        }
+        if (replacement != NULL && memmem(out, n, "\xEF\xBF\xBD", 3) != NULL) {
+            *replacement = true;
+        }
+        off += used;
+        total += n;
+    }
+    return total;
+}
+
+static bench_status_t setup_gbk(void) {
+    // 已知码点
+    static const struct { const char *in; uint32_t cp; int len; } vectors[] = {
+        {"\xB0\xA1", 0x554A, 2},              // 啊
+        {"\xD6\xD0", 0x4E2D, 2},              // 中
+        {"\x81\x30\x81\x30", 0x0080, 4},      // 四字节区起点
+        {"\xA1\xA1", 0x3000, 2},              // 全角空格
+        {"A", 0x41, 1},
+    };
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        uint32_t cp = 0;
+        const int used = gb18030_decode((const uint8_t *)vectors[i].in, strlen(vectors[i].in), &cp);
+        CHECK(used == vectors[i].len && cp == vectors[i].cp, "decode #%zu: %d bytes, U+%04X",
+              i, used, (unsigned)cp);
+    }
+    uint32_t cp = 0;
+    CHECK(gb18030_decode((const uint8_t *)"\xB0", 1, &cp) == 0, "truncated sequence not reported");
+
+    if (s_gbk == NULL) {
+        build_gbk();
+    }
+    bool replacement = false;
+    const size_t total = convert_gbk(&replacement);
+    CHECK(!replacement, "U+FFFD in output");
+    CHECK(total == s_gbk_expect, "UTF-8 bytes %zu, expected %zu", total, s_gbk_expect);
+    return BENCH_OK;
+}
+
+static void run_gbk(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sink += convert_gbk(NULL);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// txt_reader：按页顺序读取整个文件
+// ---------------------------------------------------------------------------
+
+#define TXT_UTF8_PATH "/sdcard/hostbench_utf8.txt"
+#define TXT_GBK_PATH  "/sdcard/hostbench_gbk.txt"
+
+// 从头到尾逐页 peek + offset_after，返回读过的文件字节数，pages 为页数
+static long walk_txt(const char *path, txt_encoding_t encoding, int *pages) {
+    txt_reader_t reader;
+    static char text[PEEK_BYTES + 1];
+    *pages = 0;
+    if (!txt_reader_init(&reader) || !txt_reader_open(&reader, path, encoding)) {
+        txt_reader_cleanup(&reader);
+        return -1;
+    }
+    long pos = reader.content_start;
+    txt_reader_seek(&reader, pos);
+    for (;;) {
+        bool at_eof = false;
+        const int n = txt_reader_peek(&reader, text, sizeof(text), &at_eof);
+        if (n <= 0) {
+            break;
+        }
+        // 在最后一个完整字符处断页（排版引擎同样不会拆开字符）
+        size_t take = (size_t)n;
+        if (!at_eof) {
+            while (take > 0 && ((uint8_t)text[take - 1] & 0xC0) == 0x80) {
+                take--;
+            }
+            if (take > 0) {
+                take--;
+            }
+        }
+        const long next = txt_reader_offset_after(&reader, pos, take);
+        if (next <= pos) {
+            break;
+        }
+        pos = next;
+        (*pages)++;
+        if (at_eof && take == (size_t)n) {
+            break;
+        }
+        txt_reader_seek(&reader, pos);
+    }
+    const long read = pos - reader.content_start;
+    txt_reader_cleanup(&reader);
+    return read;
+}
+
+static size_t s_utf8_len;
+
+static bench_status_t setup_txt_utf8(void) {
+    if (s_utf8_len == 0) {
+        buf_t b = {0};
+        static const char *const lines[] = {
+            "　　第一章　开端\n", "　　电子墨水屏阅读器把文本排成一页一页。\n",
+            "The quick brown fox jumps over the lazy dog.\n", "\n",
+            "　　“你好，”她说，“今天读到哪一章了？”\n",
+        };
+        while (b.len < TEXT_BYTES) {
+            const char *line = lines[next_rand() % (sizeof(lines) / sizeof(lines[0]))];
+            buf_append(&b, line, strlen(line));
+        }
+        const bool ok = write_file(TXT_UTF8_PATH, b.data, b.len);
+        s_utf8_len = b.len;
+        free(b.data);
+        CHECK(ok, "cannot write %s", TXT_UTF8_PATH);
+    }
+    CHECK(txt_reader_detect_encoding(TXT_UTF8_PATH) == TXT_ENCODING_UTF8, "encoding not detected as UTF-8");
+    int pages = 0;
+    const long read = walk_txt(TXT_UTF8_PATH, TXT_ENCODING_UTF8, &pages);
+    CHECK(read == (long)s_utf8_len, "read %ld of %zu bytes", read, s_utf8_len);
+    return BENCH_OK;
+}
+
+static void run_txt_utf8(uint64_t iters) {
+    int pages = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sink += (uint64_t)walk_txt(TXT_UTF8_PATH, TXT_ENCODING_UTF8, &pages);
+    }
+}
+
+static bench_status_t setup_txt_gbk(void) {
+    if (s_gbk == NULL) {
+        build_gbk();
+    }
+    CHECK(write_file(TXT_GBK_PATH, s_gbk, s_gbk_len), "cannot write %s", TXT_GBK_PATH);
+    CHECK(txt_reader_detect_encoding(TXT_GBK_PATH) == TXT_ENCODING_GB18030, "encoding not detected as GB18030");
+    int pages = 0;
+    const long read = walk_txt(TXT_GBK_PATH, TXT_ENCODING_GB18030, &pages);
+    CHECK(read == (long)s_gbk_len, "read %ld of %zu bytes", read, s_gbk_len);
+    return BENCH_OK;
+}
+
+static void run_txt_gbk(uint64_t iters) {
+    int pages = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        s_sink += (uint64_t)walk_txt(TXT_GBK_PATH, TXT_ENCODING_GB18030, &pages);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// epub_zip：打开（中心目录）与 stored / deflate 条目解压
+// ---------------------------------------------------------------------------
+
+#define EPUB_PATH "/sdcard/hostbench.epub"
+
+static mz_uint32 s_chapter_crc;
+static bool s_epub_ready;
+
+static bench_status_t build_epub(void) {
+    if (s_epub_ready) {
+        return BENCH_OK;
+    }
+    char *chapter = malloc(ZIP_CHAPTER_BYTES);
+    CHECK(chapter != NULL, "out of memory");
+    // 可压缩但不过分重复的正文
+    for (size_t i = 0; i < ZIP_CHAPTER_BYTES; i++) {
+        chapter[i] = (i % 64 == 63) ? '\n' : (char)('a' + (next_rand() % 4) + (i / 4096) % 20);
+    }
+    s_chapter_crc = (mz_uint32)mz_crc32(MZ_CRC32_INIT, (const unsigned char *)chapter, ZIP_CHAPTER_BYTES);
+
+    mz_zip_archive zip;
+    memset(&zip, 0, sizeof(zip));
+    bool ok = mz_zip_writer_init_file(&zip, EPUB_PATH, 0);
+    ok = ok && mz_zip_writer_add_mem(&zip, "mimetype", "application/epub+zip", 20, MZ_NO_COMPRESSION);
+    ok = ok && mz_zip_writer_add_mem(&zip, "OEBPS/content.opf", s_opf.data, s_opf.len, MZ_DEFAULT_LEVEL);
+    ok = ok && mz_zip_writer_add_mem(&zip, "OEBPS/Text/stored.xhtml", chapter, ZIP_CHAPTER_BYTES,
+                                     MZ_NO_COMPRESSION);
+    ok = ok && mz_zip_writer_add_mem(&zip, "OEBPS/Text/deflate.xhtml", chapter, ZIP_CHAPTER_BYTES,
+                                     MZ_DEFAULT_LEVEL);
+    char name[64];
+    for (int i = 0; ok && i < ZIP_SMALL_ENTRIES; i++) {
+        snprintf(name, sizeof(name), "OEBPS/Text/chapter%03d.xhtml", i);
+        ok = mz_zip_writer_add_mem(&zip, name, chapter + i * 256, 2048, MZ_DEFAULT_LEVEL);
+    }
+    ok = ok && mz_zip_writer_finalize_archive(&zip);
+    mz_zip_writer_end(&zip);
+    free(chapter);
+    CHECK(ok, "cannot write %s", EPUB_PATH);
+    s_epub_ready = true;
+    return BENCH_OK;
+}
+
+static bench_status_t setup_zip_open(void) {
+    if (s_opf.len == 0) {
+        build_opf(&s_opf);
+    }
+    bench_status_t st = build_epub();
+    if (st != BENCH_OK) {
+        return st;
+    }
+    CHECK(epub_zip_probe(EPUB_PATH) == EPUB_ZIP_PROBE_EPUB, "probe did not accept the container");
+    epub_zip_t *zip = epub_zip_open(EPUB_PATH);
+    CHECK(zip != NULL, "open failed");
+    const int count = epub_zip_get_file_count(zip);
+    epub_zip_file_info_t info;
+    const bool found = epub_zip_find_file(zip, "OEBPS/Text/chapter299.xhtml", &info);
+    epub_zip_close(zip);
+    CHECK(count == ZIP_SMALL_ENTRIES + 4, "entries %d, expected %d", count, ZIP_SMALL_ENTRIES + 4);
+    CHECK(found && info.uncompressed_size == 2048 && info.compression_method == 8,
+          "chapter299 lookup (found=%d size=%u method=%u)", found,
+          (unsigned)info.uncompressed_size, (unsigned)info.compression_method);
+    return BENCH_OK;
+}
+
+static void run_zip_open(uint64_t iters) {
+    epub_zip_file_info_t info;
+    for (uint64_t i = 0; i < iters; i++) {
+        epub_zip_t *zip = epub_zip_open(EPUB_PATH);
+        if (zip != NULL) {
+            s_sink += epub_zip_find_file(zip, "OEBPS/content.opf", &info);
+            epub_zip_close(zip);
+        }
+    }
+}
+
+typedef struct {
+    mz_uint32 crc;
+    size_t bytes;
+} crc_state_t;
+
+static bool crc_output(const void *data, size_t len, void *user) {
+    crc_state_t *s = (crc_state_t *)user;
+    s->crc = (mz_uint32)mz_crc32(s->crc, (const unsigned char *)data, len);
+    s->bytes += len;
+    return true;
+}
+
+static epub_zip_t *s_zip;
+static epub_zip_file_info_t s_zip_entry;
+
+static bench_status_t setup_zip_entry(const char *name, uint16_t method) {
+    if (s_opf.len == 0) {
+        build_opf(&s_opf);
+    }
+    bench_status_t st = build_epub();
+    if (st != BENCH_OK) {
+        return st;
+    }
+    if (s_zip != NULL) {
+        epub_zip_close(s_zip);
+    }
+    s_zip = epub_zip_open(EPUB_PATH);
+    CHECK(s_zip != NULL, "open failed");
+    CHECK(epub_zip_find_file(s_zip, name, &s_zip_entry), "%s not found", name);
+    CHECK(s_zip_entry.compression_method == method, "%s method %u", name,
+          (unsigned)s_zip_entry.compression_method);
+
+    crc_state_t s = {.crc = MZ_CRC32_INIT};
+    const int n = epub_zip_extract_to_callback(s_zip, &s_zip_entry, crc_output, &s);
+    CHECK(n == ZIP_CHAPTER_BYTES && s.bytes == ZIP_CHAPTER_BYTES, "extracted %d bytes", n);
+    CHECK(s.crc == s_chapter_crc, "CRC %08x, expected %08x", (unsigned)s.crc, (unsigned)s_chapter_crc);
+
+    // 按需读取：跳到中间读一段，与整段解压的内容一致
+    epub_zip_stream_t *stream = epub_zip_stream_open(s_zip, &s_zip_entry);
+    CHECK(stream != NULL, "stream open failed");
+    static uint8_t a[4096];
+    static uint8_t b[4096];
+    const uint32_t mid = ZIP_CHAPTER_BYTES / 2 + 123;
+    const bool seek_ok = epub_zip_stream_seek(stream, mid) && epub_zip_stream_tell(stream) == mid;
+    const int got = epub_zip_stream_read(stream, a, sizeof(a));
+    epub_zip_stream_close(stream);
+    CHECK(seek_ok && got == (int)sizeof(a), "stream seek/read (%d)", got);
+    stream = epub_zip_stream_open(s_zip, &s_zip_entry);
+    CHECK(stream != NULL, "stream reopen failed");
+    int skipped = 0;
+    while (skipped < (int)mid) {
+        const size_t want = mid - skipped < sizeof(b) ? mid - skipped : sizeof(b);
+        const int r = epub_zip_stream_read(stream, b, want);
+        if (r <= 0) {
+            break;
+        }
+        skipped += r;
+    }
+    const int got2 = epub_zip_stream_read(stream, b, sizeof(b));
+    epub_zip_stream_close(stream);
+    CHECK(skipped == (int)mid && got2 == got && memcmp(a, b, sizeof(a)) == 0,
+          "seek result differs from sequential read");
+    return BENCH_OK;
+}
+
+static bench_status_t setup_zip_stored(void) {
+    return setup_zip_entry("OEBPS/Text/stored.xhtml", 0);
+}
+
+static bench_status_t setup_zip_deflate(void) {
+    return setup_zip_entry("OEBPS/Text/deflate.xhtml", 8);
+}
+
+static void run_zip_extract(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        crc_state_t s = {.crc = MZ_CRC32_INIT};
+        s_sink += (uint64_t)epub_zip_extract_to_callback(s_zip, &s_zip_entry, crc_output, &s);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// font_stream：字形查询（需要 --font 指定固件格式的流式字体）
+// ---------------------------------------------------------------------------
+
+static const char *s_font_path;
+static lv_font_t *s_font;
+static uint32_t s_glyph_cps[GLYPH_SAMPLES];
+
+static bench_status_t setup_glyph(void) {
+    if (s_font_path == NULL) {
+        return BENCH_SKIP;
+    }
+    if (s_font == NULL) {
+        s_font = font_stream_create(s_font_path);
+        CHECK(s_font != NULL, "cannot open font %s", s_font_path);
+        // 正文的码点分布：少量常用字占大多数，ASCII 与标点穿插其中
+        for (int i = 0; i < GLYPH_SAMPLES; i++) {
+            const uint32_t r = next_rand() % 100;
+            if (r < 15) {
+                s_glyph_cps[i] = 0x20 + next_rand() % 0x5F;
+            } else if (r < 20) {
+                s_glyph_cps[i] = 0x3001 + next_rand() % 2;   // 、。
+            } else if (r < 85) {
+                s_glyph_cps[i] = 0x4E00 + (next_rand() % 500) * 7;
+            } else {
+                s_glyph_cps[i] = 0x4E00 + next_rand() % 0x51A6;
+            }
+        }
+    }
+    lv_font_glyph_dsc_t dsc;
+    CHECK(lv_font_get_glyph_dsc(s_font, &dsc, 'A', 0) && dsc.adv_w > 0, "no glyph for 'A'");
+    CHECK(font_stream_get_advance(s_font, 'A') == (int)dsc.adv_w, "advance mismatch for 'A'");
+    return BENCH_OK;
+}
+
+static void run_glyph(uint64_t iters) {
+    lv_font_glyph_dsc_t dsc;
+    for (uint64_t i = 0; i < iters; i++) {
+        for (int j = 0; j < GLYPH_SAMPLES; j++) {
+            s_sink += lv_font_get_glyph_dsc(s_font, &dsc, s_glyph_cps[j], 0) ? dsc.adv_w : 0;
+        }
+    }
+}
+
+static void run_advance(uint64_t iters) {
+    for (uint64_t i = 0; i < iters; i++) {
+        for (int j = 0; j < GLYPH_SAMPLES; j++) {
+            s_sink += (uint64_t)font_stream_get_advance(s_font, s_glyph_cps[j]);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 运行
+// ---------------------------------------------------------------------------
+
+static bench_t s_benches[] = {
+    {"opf_parse",        setup_opf,         run_opf,        1000, 0, 1},
+    {"ncx_parse",        setup_ncx,         run_ncx,        100,  0, NCX_POINTS},
+    {"xhtml_tokenize",   setup_xhtml,       run_xhtml,      3,    0, XHTML_PARAGRAPHS},
+    {"gb18030_to_utf8",  setup_gbk,         run_gbk,        3,    0, 0},
+    {"txt_walk_utf8",    setup_txt_utf8,    run_txt_utf8,   3,    0, 0},
+    {"txt_walk_gb18030", setup_txt_gbk,     run_txt_gbk,    3,    0, 0},
+    {"zip_open",         setup_zip_open,    run_zip_open,   100,  0, 1},
+    {"zip_extract_stored",  setup_zip_stored,  run_zip_extract, 3, ZIP_CHAPTER_BYTES, 0},
+    {"zip_extract_deflate", setup_zip_deflate, run_zip_extract, 3, ZIP_CHAPTER_BYTES, 0},
+    {"glyph_lookup",     setup_glyph,       run_glyph,      10,   0, GLYPH_SAMPLES},
+    {"glyph_advance",    setup_glyph,       run_advance,    10,   0, GLYPH_SAMPLES},
+};
+
+// 输入在 setup 后才确定大小的基准
+static size_t bench_bytes(const bench_t *b) {
+    if (b->run == run_xhtml) {
+        return s_xhtml.len;
+    }
+    if (b->run == run_opf) {
+        return s_opf.len;
+    }
+    if (b->run == run_ncx) {
+        return s_ncx.len;
+    }
+    if (b->run == run_gbk || b->run == run_txt_gbk) {
+        return s_gbk_len;
+    }
+    if (b->run == run_txt_utf8) {
+        return s_utf8_len;
+    }
+    return b->bytes_per_iter;
+}
+
+static int remove_entry(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+    (void)st;
+    (void)type;
+    (void)ftw;
+    return remove(path);
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--filter SUBSTR] [--min-time SEC] [--csv FILE] [--label STR]\n"
+            "          [--font PATH] [--list]\n", argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    const char *csv_path = NULL;
+    const char *label = "";
+    double min_time = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv_path = argv[++i];
+        } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+            label = argv[++i];
+        } else if (strcmp(argv[i], "--font") == 0 && i + 1 < argc) {
+            s_font_path = argv[++i];
+        } else if (strcmp(argv[i], "--list") == 0) {
+            for (size_t b = 0; b < sizeof(s_benches) / sizeof(s_benches[0]); b++) {
+                printf("%s\n", s_benches[b].name);
+            }
+            return 0;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    // 固件路径里的 /sdcard 指向临时目录，生成的输入随进程结束删除
+    char root[] = "/tmp/c3x4_hostbench_XXXXXX";
+    if (mkdtemp(root) == NULL) {
+        perror("mkdtemp");
+        return 1;
+    }
+    sim_set_sdcard_root(root);
+    sim_set_log_level(ESP_LOG_WARN);
+    lv_init();
+    // 不调用 file_pool_init：txt_reader 在文件句柄上设置 _IONBF，glibc 对无缓冲的
+    // fopencookie 流逐字节回调读取函数（newlib 直接整段读入），会让 TXT 基准失真
+    build_opf(&s_opf);
+    build_ncx(&s_ncx);
+    build_xhtml(&s_xhtml);
+
+    FILE *csv = NULL;
+    if (csv_path != NULL) {
+        csv = fopen(csv_path, "a");
+        if (csv != NULL && ftell(csv) == 0) {
+            fprintf(csv, "version,label,benchmark,iterations,ns_per_op,mb_per_s,items_per_s\n");
+        }
+    }
+
+    ESP_LOGW(TAG, "hostbench %s %s", VERSION_STRING, label);
+    printf("%-22s %14s %12s %10s %14s\n", "Benchmark", "Time(ns/op)", "Iterations", "MB/s", "items/s");
+
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(s_benches) / sizeof(s_benches[0]); i++) {
+        const bench_t *b = &s_benches[i];
+        if (filter != NULL && strstr(b->name, filter) == NULL) {
+            continue;
+        }
+        const bench_status_t st = b->setup();
+        if (st == BENCH_SKIP) {
+            printf("%-22s %14s\n", b->name, "skipped");
+            continue;
+        }
+        if (st == BENCH_FAIL) {
+            printf("%-22s %14s\n", b->name, "FAILED");
+            failed++;
+            continue;
+        }
+
+        // 预热一次后按 Google Benchmark 的方式加倍迭代次数
+        b->run(1);
+        uint64_t iters = 1;
+        int64_t elapsed = 0;
+        for (;;) {
+            const int64_t t0 = esp_timer_get_time();
+            b->run(iters);
+            elapsed = esp_timer_get_time() - t0;
+            if ((elapsed >= (int64_t)(min_time * 1e6) && iters >= b->min_iters) || iters >= (1ull << 40)) {
+                break;
+            }
+            iters *= 2;
+        }
+
+        const double ns = (double)elapsed * 1000.0 / (double)iters;
+        const double secs = (double)elapsed / 1e6;
+        const size_t bytes = bench_bytes(b);
+        const double mbps = bytes > 0 && secs > 0 ? (double)bytes * iters / secs / (1024.0 * 1024.0) : 0;
+        const double items = b->items_per_iter > 0 && secs > 0 ? (double)b->items_per_iter * iters / secs : 0;
+        printf("%-22s %14.0f %12llu %10.2f %14.0f\n", b->name, ns, (unsigned long long)iters, mbps, items);
+        if (csv != NULL) {
+            fprintf(csv, "%s,%s,%s,%llu,%.0f,%.2f,%.0f\n", VERSION_STRING, label, b->name,
+                    (unsigned long long)iters, ns, mbps, items);
+        }
+    }
+
+    if (s_font != NULL) {
+        font_stream_stats_t stats;
+        if (font_stream_get_stats(s_font, &stats)) {
+            printf("glyph cache: %u/%u hits, %u/%u glyphs, %u/%u bitmap bytes\n",
+                   (unsigned)stats.hits, (unsigned)stats.lookups, (unsigned)stats.glyph_count,
+                   (unsigned)stats.glyph_capacity, (unsigned)stats.bitmap_bytes,
+                   (unsigned)stats.bitmap_budget);
+            if (stats.block_cache_bytes > 0) {
+                printf("block cache: %u blocks loaded, %u bytes\n", (unsigned)stats.block_loads,
+                       (unsigned)stats.block_cache_bytes);
+            }
+        }
+        font_stream_destroy(s_font);
+    }
+    if (s_zip != NULL) {
+        epub_zip_close(s_zip);
+    }
+    if (csv != NULL) {
+        fclose(csv);
+    }
+
+    if (nftw(root, remove_entry, 8, FTW_DEPTH | FTW_PHYS) != 0) {
+        ESP_LOGW(TAG, "cannot remove %s", root);
+    }
+    return failed > 0 ? 1 : 0;
+}
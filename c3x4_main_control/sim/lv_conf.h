@@ -0,0 +1,99 @@
+/**
+ * @file lv_conf.h
+ * @brief 主机模拟器的 LVGL 配置，与 sdkconfig.defaults 中的 CONFIG_LV_* 保持一致
+ *
+ * 修改固件的 LVGL 配置时请同步本文件，否则模拟器的渲染结果与设备不一致
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+// 颜色与内存（CONFIG_LV_COLOR_DEPTH=1，CONFIG_LV_MEM_SIZE=51200）
+#define LV_COLOR_DEPTH              1
+#define LV_USE_STDLIB_MALLOC        LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_STRING        LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF       LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE                 (51200U)
+
+#define LV_DEF_REFR_PERIOD          30
+#define LV_DPI_DEF                  130
+
+#define LV_USE_OS                   LV_OS_NONE
+
+// 软件渲染：I1 单色与 L8 灰度（lvgl_set_content_hint）
+#define LV_USE_DRAW_SW              1
+#define LV_DRAW_SW_SUPPORT_RGB565   0
+#define LV_DRAW_SW_SUPPORT_RGB565A8 0
+#define LV_DRAW_SW_SUPPORT_RGB888   0
+#define LV_DRAW_SW_SUPPORT_XRGB8888 0
+#define LV_DRAW_SW_SUPPORT_ARGB8888 0
+#define LV_DRAW_SW_SUPPORT_L8       1
+#define LV_DRAW_SW_SUPPORT_AL88     0
+#define LV_DRAW_SW_SUPPORT_A8       1
+#define LV_DRAW_SW_SUPPORT_I1       1
+
+// 内存文件系统（lv_binfont_create_from_buffer 需要）
+#define LV_USE_FS_MEMFS             1
+#define LV_FS_MEMFS_LETTER          'M'
+
+// TrueType 字体（font_ttf.c 从文件光栅化字形）
+#define LV_USE_TINY_TTF             1
+#define LV_TINY_TTF_FILE_SUPPORT    1
+
+// 日志（CONFIG_LV_LOG_LEVEL_INFO）
+#define LV_USE_LOG                  1
+#define LV_LOG_LEVEL                LV_LOG_LEVEL_INFO
+#define LV_LOG_PRINTF               1
+
+#define LV_USE_ASSERT_NULL          1
+#define LV_USE_ASSERT_MALLOC        1
+
+// 字体
+#define LV_FONT_MONTSERRAT_8        1
+#define LV_FONT_MONTSERRAT_12       1
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_16       1
+#define LV_FONT_MONTSERRAT_20       1
+#define LV_FONT_MONTSERRAT_24       1
+#define LV_FONT_DEFAULT             &lv_font_montserrat_14
+
+// 控件
+#define LV_USE_ARC                  1
+#define LV_USE_ANIMIMG              1
+#define LV_USE_BAR                  1
+#define LV_USE_BUTTON               1
+#define LV_USE_BUTTONMATRIX         1
+#define LV_USE_CANVAS               1
+#define LV_USE_CHECKBOX             1
+#define LV_USE_DROPDOWN             1
+#define LV_USE_IMAGE                1
+#define LV_USE_LABEL                1
+#define LV_USE_LINE                 1
+#define LV_USE_LIST                 1
+#define LV_USE_MENU                 1
+#define LV_USE_MSGBOX               1
+#define LV_USE_ROLLER               1
+#define LV_USE_SLIDER               1
+#define LV_USE_SPAN                 1
+#define LV_USE_SPINBOX              1
+#define LV_USE_SPINNER              1
+#define LV_USE_SWITCH               1
+#define LV_USE_TEXTAREA             1
+#define LV_USE_TABLE                1
+#define LV_USE_TABVIEW              1
+#define LV_USE_TILEVIEW             1
+#define LV_USE_WIN                  1
+
+// 主题与布局
+// 默认主题不编译：lvgl_theme_eink.c 提供无过渡、无动画的墨水屏主题
+#define LV_USE_THEME_DEFAULT        0
+#define LV_USE_FLEX                 1
+#define LV_USE_GRID                 1
+
+// 图片解码（CONFIG_LV_USE_PNG/BMP/GIF/SJPG）
+#define LV_USE_LODEPNG              1
+#define LV_USE_BMP                  1
+#define LV_USE_GIF                  1
+#define LV_USE_TJPGD                1
+
+#endif // LV_CONF_H
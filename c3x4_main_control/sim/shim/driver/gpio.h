@@ -0,0 +1,25 @@
+/**
+ * @file gpio.h
+ * @brief 主机模拟器：只提供类型，引脚操作由 EPD 模拟后端替代
+ */
+
+#ifndef SIM_DRIVER_GPIO_H
+#define SIM_DRIVER_GPIO_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+#define GPIO_NUM_NC (-1)
+
+typedef enum {
+    GPIO_INTR_DISABLE = 0,
+    GPIO_INTR_POSEDGE,
+    GPIO_INTR_NEGEDGE,
+    GPIO_INTR_ANYEDGE,
+    GPIO_INTR_LOW_LEVEL,
+    GPIO_INTR_HIGH_LEVEL
+} gpio_int_type_t;
+
+#endif // SIM_DRIVER_GPIO_H
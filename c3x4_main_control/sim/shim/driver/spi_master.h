@@ -0,0 +1,11 @@
+/**
+ * @file spi_master.h
+ * @brief 主机模拟器：EPD 模拟后端不经过 SPI，仅为包含关系提供
+ */
+
+#ifndef SIM_DRIVER_SPI_MASTER_H
+#define SIM_DRIVER_SPI_MASTER_H
+
+#include "esp_err.h"
+
+#endif // SIM_DRIVER_SPI_MASTER_H
@@ -0,0 +1,16 @@
+/**
+ * @file esp_attr.h
+ * @brief 主机模拟器：链接段属性在主机上无意义
+ */
+
+#ifndef SIM_ESP_ATTR_H
+#define SIM_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define EXT_RAM_BSS_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
+
+#endif // SIM_ESP_ATTR_H
@@ -0,0 +1,25 @@
+/**
+ * @file esp_err.h
+ * @brief 主机模拟器：ESP-IDF 错误码
+ */
+
+#ifndef SIM_ESP_ERR_H
+#define SIM_ESP_ERR_H
+
+typedef int esp_err_t;
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+#define ESP_ERR_NO_MEM          0x101
+#define ESP_ERR_INVALID_ARG     0x102
+#define ESP_ERR_INVALID_STATE   0x103
+#define ESP_ERR_INVALID_SIZE    0x104
+#define ESP_ERR_NOT_FOUND       0x105
+#define ESP_ERR_TIMEOUT         0x107
+#define ESP_ERR_NVS_BASE        0x1100
+#define ESP_ERR_NVS_NOT_FOUND   (ESP_ERR_NVS_BASE + 0x02)
+#define ESP_ERR_NVS_INVALID_LENGTH (ESP_ERR_NVS_BASE + 0x0c)
+
+const char *esp_err_to_name(esp_err_t code);
+
+#endif // SIM_ESP_ERR_H
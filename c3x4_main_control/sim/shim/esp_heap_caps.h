@@ -0,0 +1,47 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief 主机模拟器：按能力分配退化为 malloc
+ *
+ * SIM_HEAP_LIMIT 非 0 时模拟 ESP32-C3 的可用堆上限，便于复现内存不足路径
+ */
+
+#ifndef SIM_ESP_HEAP_CAPS_H
+#define SIM_ESP_HEAP_CAPS_H
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_EXEC     (1 << 0)
+#define MALLOC_CAP_32BIT    (1 << 1)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+typedef struct {
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_allocated_size(void *ptr);   // 只用于 malloc 得到的块
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps);
+
+// 分配失败回调：模拟器只记下，不会调用（SIM_HEAP_LIMIT 下的失败由包装函数处理）
+typedef void (*esp_alloc_failed_hook_t)(size_t size, uint32_t caps, const char *function_name);
+esp_err_t heap_caps_register_failed_alloc_callback(esp_alloc_failed_hook_t callback);
+
+#endif // SIM_ESP_HEAP_CAPS_H
@@ -0,0 +1,33 @@
+/**
+ * @file esp_log.h
+ * @brief 主机模拟器：ESP_LOGx 输出到 stderr，级别由 SIM_LOG_LEVEL 控制
+ */
+
+#ifndef SIM_ESP_LOG_H
+#define SIM_ESP_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>   // ESP-IDF 的 esp_log.h 经 esp_rom_sys.h 等间接引入
+#include "esp_err.h"
+
+typedef enum {
+    ESP_LOG_NONE = 0,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+void sim_log(esp_log_level_t level, const char *tag, const char *fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+
+#define ESP_LOGE(tag, fmt, ...) sim_log(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) sim_log(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) sim_log(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) sim_log(ESP_LOG_DEBUG, tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) sim_log(ESP_LOG_VERBOSE, tag, fmt, ##__VA_ARGS__)
+
+#endif // SIM_ESP_LOG_H
@@ -0,0 +1,13 @@
+/**
+ * @file esp_rom_sys.h
+ * @brief 主机模拟器：忙等延时
+ */
+
+#ifndef SIM_ESP_ROM_SYS_H
+#define SIM_ESP_ROM_SYS_H
+
+#include <stdint.h>
+
+void esp_rom_delay_us(uint32_t us);
+
+#endif // SIM_ESP_ROM_SYS_H
@@ -0,0 +1,13 @@
+/**
+ * @file esp_timer.h
+ * @brief 主机模拟器：单调时钟（微秒）
+ */
+
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif // SIM_ESP_TIMER_H
@@ -0,0 +1,34 @@
+/**
+ * @file FreeRTOS.h
+ * @brief 主机模拟器：FreeRTOS 子集（pthread 实现，见 sim/freertos_sim.c）
+ *
+ * 只提供固件 lvgl_driver.c 与 ui/ 用到的 API。tick 固定为 1 ms
+ */
+
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>   // 与 ESP-IDF 一致：FreeRTOSConfig.h 间接包含
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY      0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define pdTICKS_TO_MS(t)   ((uint32_t)(t))
+
+#include "freertos/portmacro.h"
+
+#endif // SIM_FREERTOS_H
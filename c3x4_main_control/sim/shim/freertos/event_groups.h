@@ -0,0 +1,25 @@
+/**
+ * @file event_groups.h
+ * @brief 主机模拟器：事件组（等待任意/全部位，可选退出时清除）
+ */
+
+#ifndef SIM_EVENT_GROUPS_H
+#define SIM_EVENT_GROUPS_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_event_group *EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+void vEventGroupDelete(EventGroupHandle_t group);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, EventBits_t bits,
+                                     BaseType_t *woken);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear_on_exit, BaseType_t wait_for_all,
+                                TickType_t timeout);
+
+#endif // SIM_EVENT_GROUPS_H
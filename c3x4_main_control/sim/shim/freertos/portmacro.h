@@ -0,0 +1,24 @@
+/**
+ * @file portmacro.h
+ * @brief 主机模拟器：临界区映射到一把全局递归互斥锁
+ */
+
+#ifndef SIM_PORTMACRO_H
+#define SIM_PORTMACRO_H
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+
+void sim_enter_critical(void);
+void sim_exit_critical(void);
+
+#define portENTER_CRITICAL(mux)     do { (void)(mux); sim_enter_critical(); } while (0)
+#define portEXIT_CRITICAL(mux)      do { (void)(mux); sim_exit_critical(); } while (0)
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)  portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR()        do { } while (0)
+
+#endif // SIM_PORTMACRO_H
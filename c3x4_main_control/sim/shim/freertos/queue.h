@@ -0,0 +1,12 @@
+/**
+ * @file queue.h
+ * @brief 主机模拟器：固件未使用队列，仅为包含关系提供
+ */
+
+#ifndef SIM_QUEUE_H
+#define SIM_QUEUE_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#endif // SIM_QUEUE_H
@@ -0,0 +1,29 @@
+/**
+ * @file semphr.h
+ * @brief 主机模拟器：信号量（互斥锁按初值为 1 的二值信号量处理）
+ */
+
+#ifndef SIM_SEMPHR_H
+#define SIM_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef struct sim_sem *SemaphoreHandle_t;
+
+// 静态创建时由调用方提供存储，模拟器在其中放置实现对象的指针
+typedef struct {
+    void *impl;
+} StaticSemaphore_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buf);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken);
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem);
+
+#endif // SIM_SEMPHR_H
@@ -0,0 +1,40 @@
+/**
+ * @file task.h
+ * @brief 主机模拟器：任务与任务通知（每个任务一个 pthread）
+ */
+
+#ifndef SIM_TASK_H
+#define SIM_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                       void *arg, UBaseType_t priority, TaskHandle_t *out);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+// 主机线程的栈用量无从得知：返回整个栈大小（即从未使用）
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action,
+                              BaseType_t *woken);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+                           uint32_t *value, TickType_t timeout);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t timeout);
+
+#endif // SIM_TASK_H
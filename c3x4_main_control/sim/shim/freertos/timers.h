@@ -0,0 +1,23 @@
+/**
+ * @file timers.h
+ * @brief 主机模拟器：软件定时器（单个服务线程，1 ms 精度）
+ */
+
+#ifndef SIM_TIMERS_H
+#define SIM_TIMERS_H
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+typedef struct sim_timer *TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t timer);
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, UBaseType_t auto_reload,
+                           void *id, TimerCallbackFunction_t cb);
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t wait);
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait);
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait);
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t wait);
+void *pvTimerGetTimerID(TimerHandle_t timer);
+
+#endif // SIM_TIMERS_H
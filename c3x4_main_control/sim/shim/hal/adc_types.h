@@ -0,0 +1,17 @@
+/**
+ * @file adc_types.h
+ * @brief 主机模拟器：只提供 buttons.h 需要的通道类型，ADC 采样由脚本按键替代
+ */
+
+#ifndef SIM_HAL_ADC_TYPES_H
+#define SIM_HAL_ADC_TYPES_H
+
+typedef enum {
+    ADC_CHANNEL_0,
+    ADC_CHANNEL_1,
+    ADC_CHANNEL_2,
+    ADC_CHANNEL_3,
+    ADC_CHANNEL_4,
+} adc_channel_t;
+
+#endif // SIM_HAL_ADC_TYPES_H
@@ -0,0 +1,34 @@
+/**
+ * @file nvs.h
+ * @brief 主机模拟器：内存中的 NVS（进程退出后丢失）
+ */
+
+#ifndef SIM_NVS_H
+#define SIM_NVS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define NVS_KEY_NAME_MAX_SIZE 16   // 键名含结尾 NUL
+
+typedef uint32_t nvs_handle_t;
+typedef nvs_handle_t nvs_handle;
+
+typedef enum {
+    NVS_READONLY = 0,
+    NVS_READWRITE
+} nvs_open_mode_t;
+
+esp_err_t nvs_open(const char *ns, nvs_open_mode_t mode, nvs_handle_t *out);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *out);
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value);
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out);
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out, size_t *length);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key);
+
+#endif // SIM_NVS_H
@@ -0,0 +1,13 @@
+/**
+ * @file nvs_flash.h
+ * @brief 主机模拟器：NVS 分区初始化为空操作
+ */
+
+#ifndef SIM_NVS_FLASH_H
+#define SIM_NVS_FLASH_H
+
+#include "nvs.h"
+
+esp_err_t nvs_flash_init(void);
+
+#endif // SIM_NVS_FLASH_H
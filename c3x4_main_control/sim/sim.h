@@ -0,0 +1,70 @@
+/**
+ * @file sim.h
+ * @brief 主机模拟器内部接口：运行环境设置、EPD 模拟后端记录与按键脚本
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+#ifndef SIM_DEFAULT_SDCARD
+#define SIM_DEFAULT_SDCARD "sdcard"
+#endif
+
+// ---------------------------------------------------------------------------
+// 运行环境（esp_sim.c）
+// ---------------------------------------------------------------------------
+
+void sim_set_sdcard_root(const char *dir);
+void sim_set_log_level(esp_log_level_t level);
+void sim_set_heap_limit(size_t bytes);   // 0 = 不限制
+size_t sim_heap_used(void);
+
+// ---------------------------------------------------------------------------
+// EPD 模拟后端（epd_mock.c）
+// ---------------------------------------------------------------------------
+
+// 刷新类型（统计与日志使用）
+typedef enum {
+    SIM_EPD_UPDATE_FULL = 0,
+    SIM_EPD_UPDATE_FAST,
+    SIM_EPD_UPDATE_PARTIAL,
+    SIM_EPD_UPDATE_GRAY,
+    SIM_EPD_UPDATE_GRAY_PARTIAL,
+    SIM_EPD_UPDATE_COUNT
+} sim_epd_update_t;
+
+typedef struct {
+    uint32_t updates[SIM_EPD_UPDATE_COUNT];  // 各类刷新次数
+    uint32_t windows;                        // 局刷窗口数
+    uint64_t window_pixels;                  // 局刷窗口面积之和
+    uint64_t bytes;                          // 上传到控制器 RAM 的字节数
+    uint32_t inits;                          // 复位 + 初始化次数
+    uint32_t hibernates;
+    uint64_t wave_ms;                        // 按波形时长模型估算的面板时间
+} sim_epd_summary_t;
+
+typedef struct {
+    const char *out_dir;   // 日志与帧快照目录（NULL 表示不写文件）
+    bool frames;           // 每次刷新后写 PBM/PGM 快照
+    bool realtime;         // 按波形时长模型真实等待（默认立即完成）
+} sim_epd_config_t;
+
+void sim_epd_init(const sim_epd_config_t *cfg);
+void sim_epd_mark(const char *label);              // 在日志中插入流程标记
+void sim_epd_get_summary(sim_epd_summary_t *out);
+void sim_epd_close(void);
+const char *sim_epd_update_name(sim_epd_update_t type);
+
+// ---------------------------------------------------------------------------
+// 按键脚本（sim_main.c）
+// ---------------------------------------------------------------------------
+
+// 当前脚本按下的按键（get_pressed_button 读取）
+int sim_input_current(void);
+
+#endif // SIM_H
@@ -0,0 +1,347 @@
+/**
+ * @file sim_main.c
+ * @brief 主机模拟器入口：按固件 app_main 的顺序初始化 LVGL 与屏幕，按脚本驱动按键
+ *
+ * 用法：c3x4_sim [--script FILE] [--out DIR] [--sdcard DIR] [--frames] [--realtime]
+ *                 [--heap-limit BYTES] [--verbose]
+ *
+ * 脚本每行一条命令（# 开头为注释）：
+ *   key <right|left|confirm|back|up|down|power> [按住 ms]   按一次键（默认按住 80 ms）
+ *   wait <ms>                                               等待
+ *   mark <label>                                            结束上一段流程并记录统计
+ *   bench                                                   运行显示基准测试（display_bench）
+ *   idle                                                    等待刷新与面板全部空闲
+ * 每个 mark 在 <out>/flows.csv 追加一行该段流程的渲染与刷新统计
+ */
+
+#include "sim.h"
+#include "lvgl.h"
+#include "lvgl_driver.h"
+#include "EPD_4in26.h"
+#include "power_manager.h"
+#include "buttons.h"
+#include "display_bench.h"
+#include "text_bench.h"
+#include "turn_stats.h"
+#include "version.h"
+#include "ui/screen_manager.h"
+#include "ui/font_manager.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *TAG = "SIM";
+
+#define SIM_KEY_HOLD_MS   80
+#define SIM_KEY_GAP_MS    300
+#define SIM_IDLE_TIMEOUT  20000
+
+static volatile int s_pressed = BTN_NONE;
+static int s_reported = BTN_NONE;            // 已经作为事件交出去的状态
+static void (*s_btn_listener)(void) = NULL;
+
+typedef struct {
+    lvgl_display_stats_t disp;
+    sim_epd_summary_t epd;
+    int64_t t_us;
+} flow_snapshot_t;
+
+static FILE *s_flows = NULL;
+static flow_snapshot_t s_flow_start;
+
+// ============================================================================
+// 固件 main.c 提供的接口
+// ============================================================================
+
+button_t get_pressed_button(void) { return (button_t)s_pressed; }
+
+int sim_input_current(void) { return s_pressed; }
+
+// 按键子系统：脚本改变 s_pressed 后唤醒监听者，事件按固件的顺序（先释放旧键再按下新键）生成
+void buttons_set_listener(void (*listener)(void)) { s_btn_listener = listener; }
+
+bool buttons_get_event(button_event_t *ev, uint32_t wait_ms) {
+    (void)wait_ms;
+    const int now = s_pressed;
+    if (now == s_reported) {
+        return false;
+    }
+    if (s_reported != BTN_NONE) {
+        ev->button = (button_t)s_reported;
+        ev->pressed = false;
+        s_reported = BTN_NONE;
+    } else {
+        ev->button = (button_t)now;
+        ev->pressed = true;
+        s_reported = now;
+    }
+    ev->time_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    return true;
+}
+
+static void sim_set_pressed(int btn) {
+    s_pressed = btn;
+    if (s_btn_listener != NULL) {
+        s_btn_listener();
+    }
+}
+
+static uint32_t sim_battery_mv(void) { return 3900; }
+
+static uint8_t sim_battery_pct(void) { return 75; }
+
+static bool sim_is_charging(void) { return false; }
+
+// 模拟器不睡眠：power_manager 只保留接口
+void power_manager_init(const power_manager_config_t *cfg) { (void)cfg; }
+
+void power_manager_notify_activity(void) {}
+
+bool power_manager_idle_hook(void) { return false; }
+
+void power_manager_set_idle_hint(uint32_t ms) { (void)ms; }
+
+// 模拟器没有 BLE
+void ble_remote_set_reading(bool reading) { (void)reading; }
+
+void power_manager_lock(power_lock_t lock) { (void)lock; }
+
+void power_manager_unlock(power_lock_t lock) { (void)lock; }
+
+// ============================================================================
+// 流程统计
+// ============================================================================
+
+static void flow_snapshot(flow_snapshot_t *s) {
+    lvgl_display_get_stats(&s->disp);
+    sim_epd_get_summary(&s->epd);
+    s->t_us = esp_timer_get_time();
+}
+
+static void flow_write_header(FILE *f) {
+    fprintf(f, "flow,ms,renders,render_us,flush_us,flush_calls,refreshes,refresh_us");
+    for (int t = 0; t < SIM_EPD_UPDATE_COUNT; t++) {
+        fprintf(f, ",%s", sim_epd_update_name((sim_epd_update_t)t));
+    }
+    fprintf(f, ",windows,window_pct,bytes,inits,wave_ms\n");
+}
+
+// 相邻两个快照之差即一段流程；window_pct 为局刷窗口面积占整屏的平均比例
+static void flow_write(FILE *f, const char *label, const flow_snapshot_t *a,
+                       const flow_snapshot_t *b) {
+    const uint32_t partials = b->epd.updates[SIM_EPD_UPDATE_PARTIAL] -
+                              a->epd.updates[SIM_EPD_UPDATE_PARTIAL];
+    const uint64_t px = b->epd.window_pixels - a->epd.window_pixels;
+    const double pct = partials > 0
+        ? 100.0 * (double)px / ((double)partials * EPD_4in26_WIDTH * EPD_4in26_HEIGHT)
+        : 0.0;
+
+    fprintf(f, "%s,%lld,%u,%u,%u,%u,%u,%u", label, (long long)((b->t_us - a->t_us) / 1000),
+            b->disp.renders - a->disp.renders, b->disp.render_us - a->disp.render_us,
+            b->disp.flush_us - a->disp.flush_us, b->disp.flush_calls - a->disp.flush_calls,
+            b->disp.refreshes - a->disp.refreshes, b->disp.refresh_us - a->disp.refresh_us);
+    for (int t = 0; t < SIM_EPD_UPDATE_COUNT; t++) {
+        fprintf(f, ",%u", b->epd.updates[t] - a->epd.updates[t]);
+    }
+    fprintf(f, ",%u,%.1f,%llu,%u,%llu\n", b->epd.windows - a->epd.windows, pct,
+            (unsigned long long)(b->epd.bytes - a->epd.bytes), b->epd.inits - a->epd.inits,
+            (unsigned long long)(b->epd.wave_ms - a->epd.wave_ms));
+}
+
+static void flow_mark(const char *label) {
+    flow_snapshot_t now;
+    flow_snapshot(&now);
+    sim_epd_mark(label);
+    if (s_flows != NULL) {
+        flow_write(s_flows, label, &s_flow_start, &now);
+        fflush(s_flows);
+    }
+    flow_write(stdout, label, &s_flow_start, &now);
+    s_flow_start = now;
+}
+
+// ============================================================================
+// 脚本
+// ============================================================================
+
+static int parse_key(const char *name) {
+    static const struct {
+        const char *name;
+        button_t btn;
+    } keys[] = {
+        {"right", BTN_RIGHT},  {"left", BTN_LEFT},      {"confirm", BTN_CONFIRM},
+        {"back", BTN_BACK},    {"up", BTN_VOLUME_UP},   {"down", BTN_VOLUME_DOWN},
+        {"power", BTN_POWER},
+    };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        if (strcmp(name, keys[i].name) == 0) {
+            return keys[i].btn;
+        }
+    }
+    return BTN_NONE;
+}
+
+static void wait_idle(void) {
+    const int64_t deadline = esp_timer_get_time() + (int64_t)SIM_IDLE_TIMEOUT * 1000;
+    vTaskDelay(pdMS_TO_TICKS(50));
+    while ((lvgl_is_panel_busy() || display_bench_is_running()) &&
+           esp_timer_get_time() < deadline) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+static void run_script(FILE *in) {
+    char line[256];
+    int line_no = 0;
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_no++;
+        char *p = line;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        p[strcspn(p, "\r\n")] = '\0';
+
+        char cmd[16] = {0};
+        char arg[128] = {0};
+        int ms = 0;
+        const int n = sscanf(p, "%15s %127s %d", cmd, arg, &ms);
+
+        if (strcmp(cmd, "key") == 0 && n >= 2) {
+            const int btn = parse_key(arg);
+            if (btn == BTN_NONE) {
+                ESP_LOGW(TAG, "line %d: unknown key '%s'", line_no, arg);
+                continue;
+            }
+            sim_set_pressed(btn);
+            vTaskDelay(pdMS_TO_TICKS(n >= 3 && ms > 0 ? (uint32_t)ms : SIM_KEY_HOLD_MS));
+            sim_set_pressed(BTN_NONE);
+            vTaskDelay(pdMS_TO_TICKS(SIM_KEY_GAP_MS));
+        } else if (strcmp(cmd, "wait") == 0 && n >= 2) {
+            vTaskDelay(pdMS_TO_TICKS((uint32_t)atoi(arg)));
+        } else if (strcmp(cmd, "mark") == 0 && n >= 2) {
+            wait_idle();
+            flow_mark(arg);
+        } else if (strcmp(cmd, "bench") == 0) {
+            display_bench_request();
+            wait_idle();
+        } else if (strcmp(cmd, "idle") == 0) {
+            wait_idle();
+        } else {
+            ESP_LOGW(TAG, "line %d: cannot parse '%s'", line_no, p);
+        }
+    }
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--script FILE] [--out DIR] [--sdcard DIR] [--frames] [--realtime]\n"
+            "          [--heap-limit BYTES] [--verbose]\n", argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *script = NULL;
+    const char *out_dir = "sim_out";
+    sim_epd_config_t epd_cfg = {0};
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+            script = argv[++i];
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_dir = argv[++i];
+        } else if (strcmp(argv[i], "--sdcard") == 0 && i + 1 < argc) {
+            sim_set_sdcard_root(argv[++i]);
+        } else if (strcmp(argv[i], "--frames") == 0) {
+            epd_cfg.frames = true;
+        } else if (strcmp(argv[i], "--realtime") == 0) {
+            epd_cfg.realtime = true;
+        } else if (strcmp(argv[i], "--heap-limit") == 0 && i + 1 < argc) {
+            sim_set_heap_limit((size_t)strtoul(argv[++i], NULL, 0));
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            sim_set_log_level(ESP_LOG_DEBUG);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    mkdir(out_dir, 0775);
+    epd_cfg.out_dir = out_dir;
+    sim_epd_init(&epd_cfg);
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/flows.csv", out_dir);
+    s_flows = fopen(path, "w");
+    if (s_flows != NULL) {
+        flow_write_header(s_flows);
+    }
+    flow_write_header(stdout);
+
+    ESP_LOGI(TAG, "Simulator %s, output=%s", VERSION_STRING, out_dir);
+
+    // 与 app_main 相同的初始化顺序（SD 卡即 --sdcard 目录，无需挂载）
+    if (font_manager_init()) {
+        font_manager_load_selection();
+    }
+
+    lv_display_t *disp = lvgl_display_init();
+    lv_indev_t *indev = lvgl_input_init();
+    lvgl_fs_init();
+
+    static screen_context_t screen_ctx;
+    screen_ctx.battery_mv = sim_battery_mv();
+    screen_ctx.battery_pct = sim_battery_pct();
+    screen_ctx.charging = sim_is_charging();
+    screen_ctx.version_str = VERSION_FULL;
+    screen_ctx.indev = indev;
+    screen_ctx.read_battery_voltage_mv = sim_battery_mv;
+    screen_ctx.read_battery_percentage = sim_battery_pct;
+    screen_ctx.is_charging = sim_is_charging;
+    screen_manager_init(&screen_ctx);
+    screen_manager_show_index();
+
+    for (int i = 0; i < 6; i++) {
+        lvgl_trigger_render(disp);
+        vTaskDelay(30 / portTICK_PERIOD_MS);
+    }
+    lvgl_display_refresh();
+    display_bench_init();
+    text_bench_init();
+    turn_stats_init();
+    font_manager_start_background_scan();
+
+    flow_snapshot(&s_flow_start);
+    xTaskCreate(lvgl_timer_task, "lvgl_timer", 16384, NULL, 1, NULL);
+
+    wait_idle();
+    flow_mark("boot");
+
+    if (script != NULL) {
+        FILE *in = strcmp(script, "-") == 0 ? stdin : fopen(script, "r");
+        if (in == NULL) {
+            ESP_LOGE(TAG, "Cannot open script %s", script);
+        } else {
+            run_script(in);
+            if (in != stdin) {
+                fclose(in);
+            }
+        }
+    }
+
+    wait_idle();
+    flow_mark("end");
+    if (s_flows != NULL) {
+        fclose(s_flows);
+    }
+    sim_epd_close();
+    ESP_LOGI(TAG, "Simulation finished, heap in use %u bytes", (unsigned)sim_heap_used());
+    return 0;
+}
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+"""
+把流式字体（main/ui/font_stream.c 读取的格式）的位图表改写为分块压缩容器
+
+未分块的流式字体每个字形单独从 SD 卡读一次位图，常用字散落在整个文件里。这里把
+字形位图按字频顺序（字频表之外的非汉字在前，随后是字频表里的字，其余生僻字按码点）
+重新排进固定大小的块，字形不跨块，每块按 main/lz_block.c 的格式独立压缩，压缩后
+不更小的块原样保存。读取时解压整块并缓存，一次读取取到一批常用字。
+
+改动：
+  - 字体头 flags 置 FONT_STREAM_FLAG_BLOCKS（0x01）
+  - 描述符中的 bitmap_offset 改为解压后位图流中的偏移
+  - 位图表改为：font_block_header_t（raw_size u32、block_size u16、reserved u16、
+    block_count u32）、block_count + 1 个 uint32 偏移（相对位图表起点）、各块数据
+cmap 与字形序号不变。输出写完后会逐个字形解压比对。
+
+用法:
+  python font_blocks.py font.bin [--order 字频表.txt] [--block-size 4096] [-o 输出.bin]
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+DEFAULT_ORDER_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                  '..', 'main', 'ui', 'common_chinese_chars_full.txt')
+
+HEADER_FORMAT = '<IIHHBBHBBIII'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+FLAGS_INDEX = 8            # HEADER_FORMAT 中 flags 的位置
+FLAG_BLOCKS = 0x01
+
+GLYPH_DSC_SIZE = 24
+GLYPH_DSC_FORMAT = '<IHHHhhI'
+BITMAP_OFFSET_POS = 14     # 描述符内 bitmap_offset 的字节位置
+
+BLOCK_HEADER_FORMAT = '<IHHI'
+BLOCK_MAX_SIZE = 16384     # 与 FONT_BLOCK_MAX_SIZE 一致
+
+LZ_MIN_MATCH = 4
+LZ_LAST_LITERALS = 5
+LZ_MATCH_LIMIT = 12
+LZ_HASH_BITS = 10
+
+
+def lz_encode(src):
+    """按 lz_block_encode 的格式压缩一块（贪心匹配 + 单项哈希表，与固件相同）"""
+    out = bytearray()
+    table = {}
+    size = len(src)
+    anchor = 0
+    ip = 0
+    limit = size - LZ_MATCH_LIMIT if size > LZ_MATCH_LIMIT else 0
+    match_end = size - min(LZ_LAST_LITERALS, size)
+
+    def put_ext(n):
+        if n < 15:
+            return
+        n -= 15
+        while n >= 255:
+            out.append(255)
+            n -= 255
+        out.append(n)
+
+    def put_sequence(lit_end, offset, match_len):
+        lit_len = lit_end - anchor
+        m = match_len - LZ_MIN_MATCH if match_len else 0
+        out.append(min(lit_len, 15) << 4 | min(m, 15))
+        put_ext(lit_len)
+        out.extend(src[anchor:lit_end])
+        if match_len:
+            out.extend(struct.pack('<H', offset))
+            put_ext(m)
+
+    while ip < limit:
+        v = src[ip:ip + 4]
+        h = (struct.unpack('<I', v)[0] * 2654435761 & 0xFFFFFFFF) >> (32 - LZ_HASH_BITS)
+        ref = table.get(h)
+        table[h] = ip
+        if ref is None or src[ref:ref + 4] != v:
+            ip += 1
+            continue
+        length = LZ_MIN_MATCH
+        while ip + length < match_end and src[ref + length] == src[ip + length]:
+            length += 1
+        put_sequence(ip, ip - ref, length)
+        ip += length
+        anchor = ip
+    put_sequence(size, 0, 0)
+    return bytes(out)
+
+
+def lz_decode(src, size):
+    """按 lz_block_decode 解压，用于校验输出"""
+    out = bytearray()
+    ip = 0
+
+    def get_ext(n):
+        nonlocal ip
+        while True:
+            b = src[ip]
+            ip += 1
+            n += b
+            if b != 255:
+                return n
+
+    while ip < len(src):
+        token = src[ip]
+        ip += 1
+        lit = token >> 4
+        if lit == 15:
+            lit = get_ext(lit)
+        out += src[ip:ip + lit]
+        ip += lit
+        if ip == len(src):
+            break
+        offset = src[ip] | src[ip + 1] << 8
+        ip += 2
+        length = token & 0x0F
+        if length == 15:
+            length = get_ext(length)
+        length += LZ_MIN_MATCH
+        if offset == 0 or offset > len(out):
+            raise ValueError("bad match offset")
+        for _ in range(length):
+            out.append(out[-offset])
+    if len(out) != size:
+        raise ValueError("decoded size mismatch")
+    return bytes(out)
+
+
+def read_order(order_files):
+    """读字频表，返回 {字符: 名次}"""
+    rank = {}
+    for path in order_files:
+        with open(path, 'r', encoding='utf-8') as f:
+            for ch in ''.join(f.read().split()):
+                rank.setdefault(ord(ch), len(rank))
+    return rank
+
+
+def is_ideograph(code):
+    return (0x3400 <= code <= 0x9FFF or 0xF900 <= code <= 0xFAFF
+            or 0x20000 <= code <= 0x3FFFF)
+
+
+def glyph_size(box_w, box_h, bpp):
+    return ((box_w * bpp + 7) // 8) * box_h
+
+
+def read_cmap(data, cmap_offset, cmap_num):
+    """{码点: 字形序号}，布局与 font_stream.c 的 cmap 查找相同"""
+    mapping = {}
+    for idx in range(cmap_num):
+        base = cmap_offset + idx * 8
+        _, entries = struct.unpack_from('<II', data, base)
+        for i in range(entries):
+            code, gid = struct.unpack_from('<II', data, base + 8 + i * 8)
+            mapping.setdefault(code, gid)
+    return mapping
+
+
+def pack_font(data, rank, block_size):
+    """返回 (新字体数据, 块数, 解压后位图流长度)"""
+    header = list(struct.unpack_from(HEADER_FORMAT, data, 0))
+    bpp, cmap_num = header[4], header[5]
+    cmap_offset = header[9] or HEADER_SIZE
+    dsc_offset, bmp_offset = header[10], header[11]
+    if header[FLAGS_INDEX] & FLAG_BLOCKS:
+        raise ValueError("font is already block-compressed")
+    if not 0 < block_size <= BLOCK_MAX_SIZE:
+        raise ValueError(f"block size must be 1..{BLOCK_MAX_SIZE}")
+    if not dsc_offset < bmp_offset <= len(data):
+        raise ValueError("bad glyph table offsets")
+    count = (bmp_offset - dsc_offset) // GLYPH_DSC_SIZE
+
+    glyphs = []
+    for gid in range(count):
+        _, _, box_w, box_h, _, _, ofs = struct.unpack_from(
+            GLYPH_DSC_FORMAT, data, dsc_offset + gid * GLYPH_DSC_SIZE)
+        size = glyph_size(box_w, box_h, bpp)
+        if size > block_size:
+            raise ValueError(f"glyph {gid} ({size} bytes) is larger than a block")
+        start = bmp_offset + ofs
+        if size and start + size > len(data):
+            raise ValueError(f"glyph {gid} bitmap past end of file")
+        glyphs.append(data[start:start + size])
+
+    # 字形序号 -> 排序键；每个字形取它对应的码点里最靠前的名次
+    far = len(rank) + 1
+    keys = {}
+    for code, gid in read_cmap(data, cmap_offset, cmap_num).items():
+        if not 0 <= gid < count:
+            continue
+        if code in rank:
+            key = (1, rank[code], code)
+        elif not is_ideograph(code):
+            key = (0, 0, code)
+        else:
+            key = (2, far, code)
+        keys[gid] = min(keys.get(gid, key), key)
+    order = sorted(range(count), key=lambda g: keys.get(g, (3, far, g)))
+
+    # 按顺序排进块，放不下的字形从下一块开头放
+    stream = bytearray()
+    new_offset = [0] * count
+    for gid in order:
+        bitmap = glyphs[gid]
+        if not bitmap:
+            continue
+        if len(stream) % block_size + len(bitmap) > block_size:
+            stream += b'\0' * (-len(stream) % block_size)
+        new_offset[gid] = len(stream)
+        stream += bitmap
+    if not stream:
+        raise ValueError("font has no glyph bitmaps")
+
+    blocks = []
+    for start in range(0, len(stream), block_size):
+        raw = bytes(stream[start:start + block_size])
+        packed = lz_encode(raw)
+        blocks.append(packed if len(packed) < len(raw) else raw)
+
+    index = struct.pack(BLOCK_HEADER_FORMAT, len(stream), block_size, 0, len(blocks))
+    pos = len(index) + (len(blocks) + 1) * 4
+    offsets = []
+    for block in blocks:
+        offsets.append(pos)
+        pos += len(block)
+    offsets.append(pos)
+
+    header[FLAGS_INDEX] |= FLAG_BLOCKS
+    out = bytearray(data[:bmp_offset])
+    struct.pack_into(HEADER_FORMAT, out, 0, *header)
+    for gid in range(count):
+        struct.pack_into('<I', out, dsc_offset + gid * GLYPH_DSC_SIZE + BITMAP_OFFSET_POS,
+                         new_offset[gid])
+    out += index + struct.pack(f'<{len(offsets)}I', *offsets)
+    for block in blocks:
+        out += block
+
+    verify(bytes(out), glyphs, bmp_offset, new_offset, len(stream), block_size, offsets)
+    return bytes(out), len(blocks), len(stream)
+
+
+def verify(out, glyphs, bmp_offset, new_offset, raw_size, block_size, offsets):
+    """逐块解压，确认每个字形的位图与原来一致"""
+    stream = bytearray()
+    for i in range(len(offsets) - 1):
+        stored = out[bmp_offset + offsets[i]:bmp_offset + offsets[i + 1]]
+        raw = min(block_size, raw_size - i * block_size)
+        stream += stored if len(stored) == raw else lz_decode(stored, raw)
+    for gid, bitmap in enumerate(glyphs):
+        if bitmap and stream[new_offset[gid]:new_offset[gid] + len(bitmap)] != bitmap:
+            raise ValueError(f"verify failed at glyph {gid}")
+
+
+def pack_file(path, output=None, order_files=None, block_size=4096):
+    """就地（或写到 output）改写字体文件，成功返回 True"""
+    rank = read_order(order_files or [DEFAULT_ORDER_FILE])
+    with open(path, 'rb') as f:
+        data = f.read()
+    try:
+        new_data, blocks, raw_size = pack_font(data, rank, block_size)
+    except (ValueError, struct.error) as e:
+        print(f"Block packing skipped: {e}")
+        return False
+    with open(output or path, 'wb') as f:
+        f.write(new_data)
+    print(f"{blocks} blocks of {block_size}: bitmaps {raw_size} -> "
+          f"{len(new_data) - len(data) + raw_size} bytes, file {len(data)} -> {len(new_data)}")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack streamed font bitmaps into compressed blocks')
+    parser.add_argument('font', help='streamed font file (the format read by font_stream.c)')
+    parser.add_argument('--order', action='append',
+                        help='character frequency list, most common first '
+                             '(default: main/ui/common_chinese_chars_full.txt)')
+    parser.add_argument('--block-size', type=int, default=4096,
+                        help='uncompressed block size in bytes (default: 4096)')
+    parser.add_argument('--output', '-o', help='output file (default: rewrite in place)')
+    args = parser.parse_args()
+    return 0 if pack_file(args.font, args.output, args.order, args.block_size) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+按字频重排 LVGL 二进制字体（lv_font_conv --format bin）中的字形
+
+lv_font_conv 按码点顺序分配字形序号，位图也按序号存放，常用字散落在整个文件里，
+翻一页要碰很多 SD 扇区。这里把字形序号按字频重新分配：字频表
+（main/ui/common_chinese_chars_full.txt，最常用的在前）里的字排在最前面，
+字频表之外的非汉字（ASCII、标点）排在它们前面，其余生僻字按码点排在后面。
+于是最常用的约 3500 个汉字落在 glyf 表开头的一段连续区域，可以一次读进内存或
+映射到 Flash。
+
+只改序号，不改字形数据：
+  - cmap 改写为 SPARSE_FULL 子表（码点列表 + 字形序号偏移列表），可映射任意序号
+  - loca / glyf 按新序号重排；序号 0（保留）和原来的最后一个字形位置不变
+    （LVGL 用下一个字形的偏移推算位图长度，最后一个字形带着表尾的对齐填充）
+  - 有 kern 表的字体不处理（kern 按序号引用字形），生成时请加 --no-kerning
+
+用法:
+  python font_order.py chinese_font.bin [--order 字频表.txt] [-o 输出.bin]
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+DEFAULT_ORDER_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                  '..', 'main', 'ui', 'common_chinese_chars_full.txt')
+
+CMAP_FORMAT0_FULL = 0
+CMAP_SPARSE_FULL = 1
+CMAP_FORMAT0_TINY = 2
+CMAP_SPARSE_TINY = 3
+
+CMAP_SUBTABLE_SIZE = 16
+
+
+def read_tables(data):
+    """拆出各表：[(标签, 整表字节)]，每张表以 uint32 长度 + 4 字节标签开头"""
+    tables = []
+    pos = 0
+    while pos + 8 <= len(data):
+        size, = struct.unpack_from('<I', data, pos)
+        label = data[pos + 4:pos + 8].decode('ascii', 'replace')
+        if size < 8 or pos + size > len(data):
+            raise ValueError(f"bad table {label!r} at {pos}")
+        tables.append((label, data[pos:pos + size]))
+        pos += size
+    return tables
+
+
+def make_table(label, body):
+    """组装一张表（长度按 4 字节对齐）"""
+    body = bytes(body) + b'\0' * (-(len(body) + 8) % 4)
+    return struct.pack('<I', len(body) + 8) + label.encode('ascii') + body
+
+
+def parse_cmap(table):
+    """返回 {码点: 字形序号}"""
+    count, = struct.unpack_from('<I', table, 8)
+    mapping = {}
+    for i in range(count):
+        (data_offset, range_start, range_length, glyph_id_start,
+         entries, fmt) = struct.unpack_from('<IIHHHB', table, 12 + i * CMAP_SUBTABLE_SIZE)
+        if fmt == CMAP_FORMAT0_TINY:
+            for k in range(range_length):
+                mapping[range_start + k] = glyph_id_start + k
+        elif fmt == CMAP_FORMAT0_FULL:
+            for k in range(range_length):
+                ofs = table[data_offset + k]
+                if ofs or k == 0:
+                    mapping[range_start + k] = glyph_id_start + ofs
+        elif fmt in (CMAP_SPARSE_TINY, CMAP_SPARSE_FULL):
+            codes = struct.unpack_from(f'<{entries}H', table, data_offset)
+            if fmt == CMAP_SPARSE_FULL:
+                ids = struct.unpack_from(f'<{entries}H', table, data_offset + entries * 2)
+            else:
+                ids = range(entries)
+            for code, ofs in zip(codes, ids):
+                mapping[range_start + code] = glyph_id_start + ofs
+        else:
+            raise ValueError(f"unknown cmap format {fmt}")
+    return mapping
+
+
+def build_cmap(mapping):
+    """按码点分组（每组跨度不超过 uint16）写成 SPARSE_FULL 子表"""
+    codes = sorted(mapping)
+    groups = []
+    for code in codes:
+        if groups and code - groups[-1][0] <= 0xFFFF:
+            groups[-1].append(code)
+        else:
+            groups.append([code])
+
+    header = bytearray(struct.pack('<I', len(groups)))
+    payload = bytearray()
+    data_start = 12 + len(groups) * CMAP_SUBTABLE_SIZE
+    for group in groups:
+        range_start = group[0]
+        glyph_id_start = min(mapping[c] for c in group)
+        header += struct.pack('<IIHHHBx', data_start + len(payload), range_start,
+                              group[-1] - range_start + 1, glyph_id_start, len(group),
+                              CMAP_SPARSE_FULL)
+        payload += struct.pack(f'<{len(group)}H', *(c - range_start for c in group))
+        payload += struct.pack(f'<{len(group)}H', *(mapping[c] - glyph_id_start for c in group))
+        payload += b'\0' * (-len(payload) % 4)
+    return make_table('cmap', header + payload)
+
+
+def read_order(order_files):
+    """读字频表，返回 {字符: 名次}"""
+    rank = {}
+    for path in order_files:
+        with open(path, 'r', encoding='utf-8') as f:
+            for ch in ''.join(f.read().split()):
+                rank.setdefault(ord(ch), len(rank))
+    return rank
+
+
+def is_ideograph(code):
+    return (0x3400 <= code <= 0x9FFF or 0xF900 <= code <= 0xFAFF
+            or 0x20000 <= code <= 0x3FFFF)
+
+
+def reorder_font(data, rank):
+    """返回重排后的字体数据与热区字形数（字频表中出现的汉字与非汉字符号）"""
+    tables = read_tables(data)
+    labels = [t[0] for t in tables]
+    if 'kern' in labels:
+        raise ValueError("font has a kern table; regenerate with --no-kerning")
+    for need in ('cmap', 'loca', 'glyf'):
+        if need not in labels:
+            raise ValueError(f"missing {need} table")
+    table = dict(tables)
+
+    mapping = parse_cmap(table['cmap'])
+
+    loca = table['loca']
+    count, = struct.unpack_from('<I', loca, 8)
+    entry_size = 4 if len(loca) - 12 == count * 4 else 2
+    offsets = list(struct.unpack_from(f'<{count}{"I" if entry_size == 4 else "H"}', loca, 12))
+    glyf = table['glyf']
+    ends = offsets[1:] + [len(glyf)]
+    chunks = [glyf[offsets[i]:ends[i]] for i in range(count)]
+
+    # 旧序号 -> 排序键；每个字形取它对应的码点里最靠前的名次
+    far = len(rank) + 1
+    keys = {}
+    for code, gid in mapping.items():
+        if not 0 < gid < count - 1:
+            continue
+        if code in rank:
+            key = (1, rank[code], code)
+        elif not is_ideograph(code):
+            key = (0, 0, code)
+        else:
+            key = (2, far, code)
+        keys[gid] = min(keys.get(gid, key), key)
+    middle = sorted(range(1, count - 1), key=lambda g: keys.get(g, (3, far, g)))
+    order = [0] + middle + ([count - 1] if count > 1 else [])
+    new_id = {old: new for new, old in enumerate(order)}
+    hot = sum(1 for g in middle if keys.get(g, (3,))[0] < 2)
+
+    new_glyf = bytearray()
+    new_offsets = []
+    base = offsets[0]
+    for old in order:
+        new_offsets.append(base + len(new_glyf))
+        new_glyf += chunks[old]
+    glyf_body = glyf[8:base] + new_glyf
+    loca_body = struct.pack('<I', count) + struct.pack(
+        f'<{count}{"I" if entry_size == 4 else "H"}', *new_offsets)
+
+    rebuilt = {
+        'cmap': build_cmap({c: new_id[g] for c, g in mapping.items()}),
+        'loca': make_table('loca', loca_body),
+        # glyf 表不重新对齐，保证字形偏移和原来一样从表头起算
+        'glyf': struct.pack('<I', len(glyf_body) + 8) + b'glyf' + glyf_body,
+    }
+    out = bytearray()
+    for label, raw in tables:
+        out += rebuilt.get(label, raw)
+    return bytes(out), hot
+
+
+def reorder_file(path, output=None, order_files=None):
+    """就地（或写到 output）重排字体文件，成功返回 True"""
+    rank = read_order(order_files or [DEFAULT_ORDER_FILE])
+    with open(path, 'rb') as f:
+        data = f.read()
+    try:
+        new_data, hot = reorder_font(data, rank)
+    except (ValueError, struct.error) as e:
+        print(f"Reorder skipped: {e}")
+        return False
+    with open(output or path, 'wb') as f:
+        f.write(new_data)
+    print(f"Glyphs ordered by frequency: {hot} hot glyphs at the start of glyf")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Order LVGL binfont glyphs by character frequency')
+    parser.add_argument('font', help='LVGL binary font (lv_font_conv --format bin)')
+    parser.add_argument('--order', action='append',
+                        help='character frequency list, most common first '
+                             '(default: main/ui/common_chinese_chars_full.txt)')
+    parser.add_argument('--output', '-o', help='output file (default: rewrite in place)')
+    args = parser.parse_args()
+    return 0 if reorder_file(args.font, args.output, args.order) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -16,6 +16,8 @@ import sys
 import struct
 import urllib.request
 
+from font_order import reorder_file
+
 # 配置
 FONT_SIZE = 16           # 字体大小
 BPP = 1                  # 1位黑白 (适合电子墨水屏)
@@ -140,6 +142,7 @@ def generate_font_bin(font_path):
         "--bpp", str(BPP),
         "--format", "bin",
         "--no-compress",
+        "--no-kerning",  # kern 按字形序号引用，按字频重排时不能有
         "--symbols", chars_str,  # 直接传递字符
         "--output", OUTPUT_BIN
     ]
@@ -252,7 +255,10 @@ def main():
     if not generate_font_bin(font_path):
         return 1
 
-    # 3. 转换为 C 数组
+    # 3. 按字频重排字形，常用字集中在文件开头
+    reorder_file(OUTPUT_BIN)
+
+    # 4. 转换为 C 数组
     if not bin_to_c_array():
         return 1
 
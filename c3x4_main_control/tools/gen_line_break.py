@@ -0,0 +1,470 @@
+#!/usr/bin/env python3
+"""
+生成断行与断字表 main/ui/line_break_tables.h（line_break.c 引用，全部为 const，留在 Flash 中）
+
+断行类别按 UAX #14：
+  - 给出 LineBreak.txt 时直接使用其中的类别；没有时由 unicodedata（通用类别、东亚宽度）
+    加上标点的显式列表推出阅读文本会用到的类别
+  - 按 UAX #14 LB1 归并：AI/SG/XX/SA -> AL，CJ -> NS（严格禁则），CB/EB/EM -> ID，
+    ZWJ -> CM，CR/LF/NL -> BK
+  - 中文排版的定制（CLREQ）：弯引号 ‘“ 作开括号、’” 作闭括号，破折号 —、波浪号 ～、
+    间隔号 · 不在行首
+成对表由 LB8~LB31 的规则计算：直接相邻可断为 DIRECT，仅在中间有空格时可断为 INDIRECT，
+其余为 PROHIBITED。
+
+断字用 Liang 算法：模式文件（TeX .pat 格式）建成紧凑字典树，每个节点一个 32 位字：
+  位 0~4 字符（1~26 为 a~z，27 为词界 .），位 5 同层最后一个，
+  位 6~13 该节点的模式（0 为无，否则为分值向量序号 + 1），位 14~26 第一个子节点（0 为叶子）
+分值向量去掉开头的 0、与模式末尾对齐后只有一百多种，单独存放。例外词按去掉连字符后的
+拼写排序，供二分查找。
+
+用法:
+  python3 gen_line_break.py [--linebreak LineBreak.txt] [-o ../main/ui/line_break_tables.h]
+"""
+
+import argparse
+import os
+import re
+import sys
+import unicodedata
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT = os.path.join(HERE, '..', 'main', 'ui', 'line_break_tables.h')
+DEFAULT_PATTERNS = os.path.join(HERE, 'hyphen', 'hyph-en-us.pat.txt')
+DEFAULT_EXCEPTIONS = os.path.join(HERE, 'hyphen', 'hyph-en-us.hyp.txt')
+
+# 与 line_break.h 中 lb_class_t 的顺序一致；SP 与 BK 不进成对表
+CLASSES = ['OP', 'CL', 'CP', 'QU', 'GL', 'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU', 'AL', 'HL',
+           'ID', 'IN', 'HY', 'BA', 'BB', 'B2', 'ZW', 'CM', 'WJ', 'H2', 'H3', 'JL', 'JV', 'JT',
+           'RI', 'SP', 'BK']
+PAIR_CLASSES = CLASSES[:CLASSES.index('SP')]
+
+# LB1 归并
+RESOLVE = {'AI': 'AL', 'SG': 'AL', 'XX': 'AL', 'SA': 'AL', 'CJ': 'NS', 'CB': 'ID', 'EB': 'ID',
+           'EM': 'ID', 'ZWJ': 'CM', 'CR': 'BK', 'LF': 'BK', 'NL': 'BK', 'AK': 'AL', 'AP': 'AL',
+           'AS': 'AL', 'VF': 'CM', 'VI': 'CM'}
+
+# 中文排版定制
+TAILOR = {
+    0x2018: 'OP', 0x201C: 'OP', 0x2019: 'CL', 0x201D: 'CL',
+    0x2014: 'NS', 0x2015: 'NS', 0x2E3A: 'NS', 0x2E3B: 'NS',
+    0xFF5E: 'NS', 0x00B7: 'NS', 0x30FB: 'NS',
+}
+
+MAX_CODEPOINT = 0x10FFFF
+HYPH_BOUNDARY = 27
+
+
+# ----------------------------------------------------------------------------
+# 断行类别
+# ----------------------------------------------------------------------------
+
+def load_linebreak_txt(path):
+    classes = {}
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            rng, cls = [x.strip() for x in line.split(';')]
+            if '..' in rng:
+                a, b = rng.split('..')
+            else:
+                a = b = rng
+            for cp in range(int(a, 16), int(b, 16) + 1):
+                classes[cp] = cls
+    return lambda cp: classes.get(cp, default_class(cp))
+
+
+def default_class(cp):
+    # LineBreak.txt 中未列出的码点：表意文字区与图形符号区为 ID，其余为 XX
+    if (0x3400 <= cp <= 0x4DBF or 0x4E00 <= cp <= 0x9FFF or 0xF900 <= cp <= 0xFAFF or
+            0x20000 <= cp <= 0x2FFFD or 0x30000 <= cp <= 0x3FFFD or
+            0x1F000 <= cp <= 0x1FAFF or 0x1FC00 <= cp <= 0x1FFFD):
+        return 'ID'
+    return 'XX'
+
+
+ASCII_CLASSES = {
+    '\t': 'BA', ' ': 'SP', '!': 'EX', '"': 'QU', '#': 'AL', '$': 'PR', '%': 'PO', '&': 'AL',
+    "'": 'QU', '(': 'OP', ')': 'CP', '*': 'AL', '+': 'PR', ',': 'IS', '-': 'HY', '.': 'IS',
+    '/': 'SY', ':': 'IS', ';': 'IS', '<': 'AL', '=': 'AL', '>': 'AL', '?': 'EX', '@': 'AL',
+    '[': 'OP', '\\': 'PR', ']': 'CP', '^': 'AL', '_': 'AL', '`': 'AL', '{': 'OP', '|': 'BA',
+    '}': 'CL', '~': 'AL',
+}
+
+EXPLICIT = {
+    0x0A: 'LF', 0x0B: 'BK', 0x0C: 'BK', 0x0D: 'CR', 0x85: 'NL', 0x2028: 'BK', 0x2029: 'BK',
+    0x00A0: 'GL', 0x202F: 'GL', 0x2007: 'GL', 0x2011: 'GL', 0x034F: 'GL', 0x180E: 'GL',
+    0x0F08: 'GL', 0x0F0C: 'GL', 0x0F12: 'GL',
+    0x200B: 'ZW', 0x2060: 'WJ', 0xFEFF: 'WJ', 0x200D: 'ZWJ',
+    0x00A1: 'OP', 0x00BF: 'OP', 0x00AD: 'BA', 0x00B4: 'BB', 0x02C8: 'BB', 0x02CC: 'BB',
+    0x1FFD: 'BB', 0x00A2: 'PO', 0x00B0: 'PO', 0x2030: 'PO', 0x2031: 'PO', 0x2103: 'PO',
+    0x2109: 'PO', 0x20A7: 'PO', 0x20B6: 'PO', 0xFE6A: 'PO', 0xFF05: 'PO', 0xFFE0: 'PO',
+    0x2032: 'PO', 0x2033: 'PO', 0x2034: 'PO', 0x2035: 'PO', 0x2036: 'PO', 0x2037: 'PO',
+    0x00B1: 'PR', 0x2116: 'PR', 0x2212: 'PR', 0x2213: 'PR', 0xFE69: 'PR', 0xFF04: 'PR',
+    0xFFE1: 'PR', 0xFFE5: 'PR', 0xFFE6: 'PR',
+    0x2010: 'BA', 0x2012: 'BA', 0x2013: 'BA', 0x058A: 'BA', 0x1680: 'BA', 0x3000: 'BA',
+    0x2014: 'B2', 0x2E3A: 'B2', 0x2E3B: 'B2', 0x2024: 'IN', 0x2025: 'IN', 0x2026: 'IN',
+    0x22EF: 'IN', 0xFE19: 'IN', 0x2044: 'IS', 0x037E: 'IS', 0x0589: 'IS', 0xFE10: 'IS',
+    0xFE13: 'IS', 0xFE14: 'IS', 0x203C: 'NS', 0x203D: 'NS', 0x2047: 'NS', 0x2048: 'NS',
+    0x2049: 'NS', 0x3005: 'NS', 0x301C: 'NS', 0x303B: 'NS', 0x303C: 'NS', 0x309B: 'NS',
+    0x309C: 'NS', 0x309D: 'NS', 0x309E: 'NS', 0x30A0: 'NS', 0x30FC: 'NS', 0x30FD: 'NS',
+    0x30FE: 'NS', 0xA015: 'NS', 0xFE54: 'NS', 0xFE55: 'NS', 0xFF1A: 'NS', 0xFF1B: 'NS',
+    0xFF65: 'NS', 0xFF70: 'NS', 0xFF9E: 'NS', 0xFF9F: 'NS',
+    0x3001: 'CL', 0x3002: 'CL', 0xFE11: 'CL', 0xFE12: 'CL', 0xFE50: 'CL', 0xFE52: 'CL',
+    0xFF0C: 'CL', 0xFF0E: 'CL', 0xFF61: 'CL', 0xFF64: 'CL', 0xFF09: 'CP', 0xFF3D: 'CP',
+    0xFE56: 'EX', 0xFE57: 'EX', 0xFF01: 'EX', 0xFF1F: 'EX', 0x05C6: 'EX', 0x061F: 'EX',
+    0x2018: 'QU', 0x2019: 'QU', 0x201B: 'QU', 0x201C: 'QU', 0x201D: 'QU', 0x201F: 'QU',
+    0x2039: 'QU', 0x203A: 'QU', 0x00AB: 'QU', 0x00BB: 'QU', 0x201A: 'OP', 0x201E: 'OP',
+}
+
+# 小写假名（CJ）
+SMALL_KANA = (set(range(0x3041, 0x304A, 2)) | {0x3063, 0x3083, 0x3085, 0x3087, 0x308E, 0x3095,
+                                               0x3096} |
+              set(range(0x30A1, 0x30AA, 2)) | {0x30C3, 0x30E3, 0x30E5, 0x30E7, 0x30EE, 0x30F5,
+                                               0x30F6} |
+              set(range(0x31F0, 0x3200)) | set(range(0xFF67, 0xFF71)))
+
+
+def derived_class(cp):
+    if cp < 0x80 and chr(cp) in ASCII_CLASSES:
+        return ASCII_CLASSES[chr(cp)]
+    if cp in EXPLICIT:
+        return EXPLICIT[cp]
+    if cp in SMALL_KANA:
+        return 'CJ'
+    if 0x1F1E6 <= cp <= 0x1F1FF:
+        return 'RI'
+    if 0xAC00 <= cp <= 0xD7A3:
+        return 'H2' if (cp - 0xAC00) % 28 == 0 else 'H3'
+    if 0x1100 <= cp <= 0x115F or 0xA960 <= cp <= 0xA97C:
+        return 'JL'
+    if 0x1160 <= cp <= 0x11A7 or 0xD7B0 <= cp <= 0xD7C6:
+        return 'JV'
+    if 0x11A8 <= cp <= 0x11FF or 0xD7CB <= cp <= 0xD7FB:
+        return 'JT'
+    if 0xD800 <= cp <= 0xDFFF:
+        return 'SG'
+
+    ch = chr(cp)
+    cat = unicodedata.category(ch)
+    wide = unicodedata.east_asian_width(ch) in ('W', 'F')
+    if cat == 'Cn':
+        return default_class(cp)
+    if cat in ('Mn', 'Mc', 'Me') or cat == 'Cc' or (cat == 'Cf' and cp not in (0x00AD,)):
+        return 'CM'
+    if cat == 'Ps':
+        return 'OP'
+    if cat == 'Pe':
+        return 'CL'
+    if cat in ('Pi', 'Pf'):
+        return 'QU'
+    if cat == 'Zs':
+        return 'BA'
+    if cat == 'Pd':
+        return 'NS' if wide else 'BA'
+    if cat == 'Sc':
+        return 'ID' if wide else 'PR'
+    if cat == 'Nd':
+        return 'ID' if wide else 'NU'
+    if 0x0590 <= cp <= 0x05FF and cat == 'Lo' or 0xFB1D <= cp <= 0xFB4F and cat.startswith('L'):
+        return 'HL'
+    if 0x0E00 <= cp <= 0x0EFF or 0x1000 <= cp <= 0x109F or 0x1780 <= cp <= 0x17FF:
+        return 'SA'   # 东南亚文字没有词典，归并为 AL
+    if wide:
+        return 'ID'
+    return 'AL'
+
+
+def resolve(cls):
+    return RESOLVE.get(cls, cls)
+
+
+def build_class_runs(class_of):
+    runs = []
+    for cp in range(MAX_CODEPOINT + 1):
+        cls = TAILOR.get(cp) or resolve(class_of(cp))
+        if cls not in CLASSES:
+            cls = 'AL'
+        if not runs or runs[-1][1] != cls:
+            runs.append((cp, cls))
+    return runs
+
+
+# ----------------------------------------------------------------------------
+# 成对表（UAX #14 LB8~LB31）
+# ----------------------------------------------------------------------------
+
+def direct_break(a, b):
+    """a 与 b 直接相邻时能否在 b 前断行（CM、SP 已由运行时处理）"""
+    if a == 'ZW':
+        return True                               # LB8
+    if a == 'WJ' or b == 'WJ':
+        return False                              # LB11
+    if a == 'GL':
+        return False                              # LB12
+    if b == 'GL' and a not in ('BA', 'HY'):
+        return False                              # LB12a
+    if b in ('CL', 'CP', 'EX', 'IS', 'SY'):
+        return False                              # LB13
+    if a == 'OP':
+        return False                              # LB14
+    if a == 'QU' and b == 'OP':
+        return False                              # LB15
+    if a in ('CL', 'CP') and b == 'NS':
+        return False                              # LB16
+    if a == 'B2' and b == 'B2':
+        return False                              # LB17
+    if a == 'QU' or b == 'QU':
+        return False                              # LB19
+    if b in ('BA', 'HY', 'NS') or a == 'BB':
+        return False                              # LB21
+    if a == 'SY' and b == 'HL':
+        return False                              # LB21b
+    if b == 'IN':
+        return False                              # LB22
+    if (a in ('AL', 'HL') and b == 'NU') or (a == 'NU' and b in ('AL', 'HL')):
+        return False                              # LB23
+    if (a == 'PR' and b == 'ID') or (a == 'ID' and b == 'PO'):
+        return False                              # LB23a
+    if (a in ('PR', 'PO') and b in ('AL', 'HL')) or (a in ('AL', 'HL') and b in ('PR', 'PO')):
+        return False                              # LB24
+    if (a, b) in {('CL', 'PO'), ('CP', 'PO'), ('CL', 'PR'), ('CP', 'PR'), ('NU', 'PO'),
+                  ('NU', 'PR'), ('PO', 'OP'), ('PO', 'NU'), ('PR', 'OP'), ('PR', 'NU'),
+                  ('HY', 'NU'), ('IS', 'NU'), ('NU', 'NU'), ('SY', 'NU')}:
+        return False                              # LB25
+    if ((a == 'JL' and b in ('JL', 'JV', 'H2', 'H3')) or
+            (a in ('JV', 'H2') and b in ('JV', 'JT')) or (a in ('JT', 'H3') and b == 'JT')):
+        return False                              # LB26
+    if ((a in ('JL', 'JV', 'JT', 'H2', 'H3') and b == 'PO') or
+            (a == 'PR' and b in ('JL', 'JV', 'JT', 'H2', 'H3'))):
+        return False                              # LB27
+    if a in ('AL', 'HL') and b in ('AL', 'HL'):
+        return False                              # LB28
+    if a == 'IS' and b in ('AL', 'HL'):
+        return False                              # LB29
+    if (a in ('AL', 'HL', 'NU') and b == 'OP') or (a == 'CP' and b in ('AL', 'HL', 'NU')):
+        return False                              # LB30
+    if a == 'RI' and b == 'RI':
+        return False                              # LB30a（成对简化）
+    return True                                   # LB31
+
+
+def break_after_spaces(a, b):
+    """a SP+ b 时能否在 b 前断行"""
+    if a == 'ZW':
+        return True                               # LB8
+    if b in ('WJ', 'CL', 'CP', 'EX', 'IS', 'SY'):
+        return False                              # LB11、LB13
+    if a == 'OP':
+        return False                              # LB14
+    if a == 'QU' and b == 'OP':
+        return False                              # LB15
+    if a in ('CL', 'CP') and b == 'NS':
+        return False                              # LB16
+    if a == 'B2' and b == 'B2':
+        return False                              # LB17
+    return True                                   # LB18
+
+
+def build_pair_table():
+    table = []
+    for a in PAIR_CLASSES:
+        row = []
+        for b in PAIR_CLASSES:
+            if direct_break(a, b):
+                row.append(0)     # LB_DIRECT
+            elif break_after_spaces(a, b):
+                row.append(1)     # LB_INDIRECT
+            else:
+                row.append(2)     # LB_PROHIBITED
+        table.append(row)
+    return table
+
+
+# ----------------------------------------------------------------------------
+# 断字
+# ----------------------------------------------------------------------------
+
+def hyph_code(ch):
+    return HYPH_BOUNDARY if ch == '.' else ord(ch) - ord('a') + 1
+
+
+def load_patterns(path):
+    patterns = []
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('%', 1)[0].strip()
+            for pat in line.split():
+                letters = re.sub(r'\d', '', pat)
+                digits = [0] * (len(letters) + 1)
+                i = 0
+                for ch in pat:
+                    if ch.isdigit():
+                        digits[i] = int(ch)
+                    else:
+                        i += 1
+                if not re.fullmatch(r'\.?[a-z]+\.?', letters):
+                    sys.exit(f'unsupported pattern: {pat}')
+                while digits and digits[0] == 0:
+                    digits.pop(0)
+                patterns.append((letters, tuple(digits)))
+    return patterns
+
+
+def load_exceptions(path):
+    words = []
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            line = line.split('%', 1)[0].strip()
+            words.extend(w for w in line.split() if re.fullmatch(r'[a-z-]+', w))
+    return sorted(set(words), key=lambda w: w.replace('-', ''))
+
+
+def build_trie(patterns):
+    vectors = sorted({d for _, d in patterns})
+    vector_index = {v: i + 1 for i, v in enumerate(vectors)}
+
+    root = {}
+    for letters, digits in patterns:
+        node = root
+        for ch in letters:
+            node = node.setdefault(ch, {})
+        node[None] = vector_index[digits]
+
+    # 按层展开：每个节点的子节点连续存放，按字符码排序
+    entries = []
+    queue = [(root, None)]
+    while queue:
+        node, parent_slot = queue.pop(0)
+        kids = sorted((k for k in node if k is not None), key=hyph_code)
+        if not kids:
+            continue
+        first = len(entries)
+        if parent_slot is not None:
+            entries[parent_slot][3] = first
+        for k in kids:
+            entries.append([hyph_code(k), False, node[k].get(None, 0), 0])
+            queue.append((node[k], len(entries) - 1))
+        entries[-1][1] = True
+
+    if len(entries) >= 1 << 13 or len(vectors) >= 1 << 8:
+        sys.exit('hyphenation trie does not fit the 32-bit node format')
+    words = [c | (int(last) << 5) | (pat << 6) | (child << 14) for c, last, pat, child in entries]
+    return words, vectors
+
+
+# ----------------------------------------------------------------------------
+# 输出
+# ----------------------------------------------------------------------------
+
+def c_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ' '.join(fmt(v) + ',' for v in values[i:i + per_line]))
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='生成断行类别、成对表与断字字典树')
+    parser.add_argument('--linebreak', help='Unicode LineBreak.txt（缺省时由 unicodedata 推出）')
+    parser.add_argument('--patterns', default=DEFAULT_PATTERNS)
+    parser.add_argument('--exceptions', default=DEFAULT_EXCEPTIONS)
+    parser.add_argument('-o', '--output', default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    class_of = load_linebreak_txt(args.linebreak) if args.linebreak else derived_class
+    source = (os.path.basename(args.linebreak) if args.linebreak
+              else f'unicodedata {unicodedata.unidata_version}')
+    runs = build_class_runs(class_of)
+    ascii_classes = [CLASSES.index(TAILOR.get(cp) or resolve(class_of(cp))) for cp in range(128)]
+    pairs = build_pair_table()
+    trie, vectors = build_trie(load_patterns(args.patterns))
+    exceptions = load_exceptions(args.exceptions)
+
+    vector_bytes = []
+    vector_offsets = []
+    for v in vectors:
+        vector_offsets.append(len(vector_bytes))
+        vector_bytes.append(len(v))
+        vector_bytes.extend(v)
+    exception_offsets = []
+    exception_blob = ''
+    for w in exceptions:
+        exception_offsets.append(len(exception_blob))
+        exception_blob += w + '\0'
+
+    out = []
+    out.append('/**')
+    out.append(' * @file line_break_tables.h')
+    out.append(' * @brief 断行类别、UAX #14 成对表与英语断字字典树')
+    out.append(' *')
+    out.append(f' * 由 tools/gen_line_break.py 生成（类别来源：{source}），请勿手工修改。')
+    out.append(' * 只由 line_break.c 引用')
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef LINE_BREAK_TABLES_H')
+    out.append('#define LINE_BREAK_TABLES_H')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append(f'#define LB_RANGE_COUNT      {len(runs)}')
+    out.append(f'#define HYPH_TRIE_SIZE      {len(trie)}')
+    out.append(f'#define HYPH_VECTOR_COUNT   {len(vectors)}')
+    out.append(f'#define HYPH_EXCEPTION_COUNT {len(exceptions)}')
+    out.append('')
+    out.append('// ASCII 的断行类别')
+    out.append('static const uint8_t s_lb_ascii[128] = {')
+    out.append(c_array(ascii_classes, 16, lambda v: f'{v:2d}'))
+    out.append('};')
+    out.append('')
+    out.append('// 码点区间：(起点 << 8) | 类别，按起点升序，区间延续到下一项起点之前')
+    out.append('static const uint32_t s_lb_ranges[LB_RANGE_COUNT] = {')
+    out.append(c_array([(cp << 8) | CLASSES.index(c) for cp, c in runs], 6,
+                       lambda v: f'0x{v:08X}'))
+    out.append('};')
+    out.append('')
+    out.append('// 成对表：行为前一个字符的类别，列为后一个字符的类别；')
+    out.append('// 0 直接可断，1 中间有空格时可断，2 不可断')
+    out.append('static const uint8_t s_lb_pairs[LB_PAIR_CLASSES][LB_PAIR_CLASSES] = {')
+    for a, row in zip(PAIR_CLASSES, pairs):
+        out.append('    {' + ','.join(map(str, row)) + '},  // ' + a)
+    out.append('};')
+    out.append('')
+    out.append('// 断字字典树节点（格式见 tools/gen_line_break.py）')
+    out.append('static const uint32_t s_hyph_trie[HYPH_TRIE_SIZE] = {')
+    out.append(c_array(trie, 6, lambda v: f'0x{v:08X}'))
+    out.append('};')
+    out.append('')
+    out.append('// 分值向量：长度 + 分值，最后一个分值对应模式末尾之后的位置')
+    out.append(f'static const uint8_t s_hyph_vectors[{len(vector_bytes)}] = {{')
+    out.append(c_array(vector_bytes, 20, str))
+    out.append('};')
+    out.append('')
+    out.append('static const uint16_t s_hyph_vector_offsets[HYPH_VECTOR_COUNT] = {')
+    out.append(c_array(vector_offsets, 12, str))
+    out.append('};')
+    out.append('')
+    out.append('// 例外词（- 为断字点），按去掉连字符后的拼写排序')
+    out.append('static const char s_hyph_exceptions[] =')
+    for i in range(0, len(exceptions), 6):
+        out.append('    "' + ''.join(w + '\\0' for w in exceptions[i:i + 6]) + '"')
+    out[-1] += ';'
+    out.append('')
+    out.append('static const uint16_t s_hyph_exception_offsets[HYPH_EXCEPTION_COUNT] = {')
+    out.append(c_array(exception_offsets, 12, str))
+    out.append('};')
+    out.append('')
+    out.append('#endif // LINE_BREAK_TABLES_H')
+
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out) + '\n')
+    flash = (len(runs) * 4 + 128 + len(PAIR_CLASSES) ** 2 + len(trie) * 4 + len(vector_bytes) +
+             len(vectors) * 2 + len(exception_blob) + len(exceptions) * 2)
+    print(f'{args.output}: {len(runs)} class ranges, {len(trie)} trie nodes, '
+          f'{len(vectors)} vectors, {len(exceptions)} exceptions, {flash} bytes')
+
+
+if __name__ == '__main__':
+    main()
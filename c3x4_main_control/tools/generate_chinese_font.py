@@ -10,6 +10,8 @@ import struct
 import subprocess
 import argparse
 
+from font_order import reorder_file
+
 # 常用汉字列表（约 3500 字，够日常使用）
 COMMON_CHINESE = """的一是了我不在人有他这中大来上国个中
 和们地到以说时要就出会可下而你年生能子多去对
@@ -225,6 +227,7 @@ def generate_font_bin(font_path, output_path, font_size=16, bpp=1):
         '--bpp', str(bpp),
         '--symbols', symbols_str,
         '--format', 'bin',
+        '--no-kerning',  # kern 按字形序号引用，按字频重排时不能有
         '-o', output_path
     ]
 
@@ -294,6 +297,8 @@ def main():
                         help='Output bin file path')
     parser.add_argument('--no-c', action='store_true',
                         help='Skip C array generation')
+    parser.add_argument('--no-reorder', action='store_true',
+                        help='Keep glyphs in codepoint order instead of frequency order')
 
     args = parser.parse_args()
 
@@ -304,6 +309,9 @@ def main():
 
     # 生成 bin 文件
     if generate_font_bin(args.font, args.output, args.size, args.bpp):
+        # 常用字集中到文件开头，翻页时读的扇区更少
+        if not args.no_reorder:
+            reorder_file(args.output)
         # 生成 C 数组
         if not args.no_c:
             c_file = args.output.replace('.bin', '.h')
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""
+按组件、按符号统计固件镜像大小，并与保存的基线比较
+
+直接解析链接器的 map 文件（build/<工程名>.map）：每个输入段（-ffunction-sections /
+-fdata-sections 下即一个函数或变量）记作 (组件库, 目标文件, 符号)，按所在输出段
+归入 flash 代码、flash 只读数据、IRAM、DRAM 等类别。被 --gc-sections 丢弃的段
+不在内存映射部分，不计入。
+
+用法:
+  python size_report.py build/monster-c3x4.map                      # 组件与最大符号
+  python size_report.py build/monster-c3x4.map --save base.json     # 保存基线
+  python size_report.py build/monster-c3x4.map --diff base.json     # 与基线比较
+  python size_report.py build/monster-c3x4.map --component main     # 只看某个组件的符号
+
+工程的 CMakeLists.txt 提供 size-report / size-baseline 目标（idf.py size-report），
+基线默认放在 size_baseline.json（-DSIZE_BASELINE=... 可改）
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# 输出段 -> 类别；image 表示是否占用 flash 镜像（NOLOAD 段如 .flash.rodata_noload 不统计）
+CATEGORIES = [
+    ('flash_code', ('.flash.text',), True),
+    ('flash_rodata', ('.flash.rodata', '.flash.appdesc'), True),
+    ('iram', ('.iram0.text', '.iram0.vectors', '.iram0.text_end'), True),
+    ('dram_data', ('.dram0.data',), True),
+    ('dram_bss', ('.dram0.bss', '.noinit'), False),
+    ('rtc', ('.rtc.text', '.rtc.data', '.rtc.force_fast'), True),
+]
+
+SYMBOL_PREFIXES = ('.literal.', '.text.', '.iram1.', '.rodata.', '.srodata.', '.data.',
+                   '.sdata.', '.bss.', '.sbss.', '.dram1.', '.rtc.')
+
+RE_OUTPUT = re.compile(r'^(\.\S+)\s+0x[0-9a-f]+\s+0x[0-9a-f]+')
+RE_INPUT_FULL = re.compile(r'^ (\.\S+|COMMON)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.+)$')
+RE_INPUT_NAME = re.compile(r'^ (\.\S+|COMMON)$')
+RE_INPUT_REST = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.+)$')
+RE_ARCHIVE = re.compile(r'(?:.*/)?lib([^/]+)\.a\(([^)]+)\)$')
+
+
+def category_of(out_sec):
+    for name, prefixes, _ in CATEGORIES:
+        if out_sec in prefixes:
+            return name
+    return None
+
+
+def component_of(origin):
+    m = RE_ARCHIVE.match(origin.strip())
+    if m:
+        return m.group(1), m.group(2)
+    return '(linker)', os.path.basename(origin.strip())
+
+
+def symbol_of(in_sec):
+    for p in SYMBOL_PREFIXES:
+        if in_sec.startswith(p):
+            return in_sec[len(p):]
+    return in_sec
+
+
+def parse_map(path):
+    """返回 {(组件, 目标文件, 符号, 类别): 字节数}"""
+    sizes = {}
+    out_sec = None
+    pending = None
+    in_memory_map = False
+    with open(path, errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not in_memory_map:
+                in_memory_map = line.startswith('Linker script and memory map')
+                continue
+            m = RE_OUTPUT.match(line)
+            if m:
+                out_sec = m.group(1)
+                pending = None
+                continue
+            if line.startswith('/DISCARD/'):
+                out_sec = None
+                continue
+            cat = category_of(out_sec) if out_sec else None
+            if pending is not None:
+                m = RE_INPUT_REST.match(line)
+                in_sec, pending = pending, None
+                if m and cat:
+                    add(sizes, in_sec, int(m.group(2), 16), m.group(3), cat)
+                continue
+            m = RE_INPUT_FULL.match(line)
+            if m:
+                if cat:
+                    add(sizes, m.group(1), int(m.group(3), 16), m.group(4), cat)
+                continue
+            m = RE_INPUT_NAME.match(line)
+            if m:
+                pending = m.group(1)
+    if not in_memory_map:
+        sys.exit(f'{path}: no memory map section (not a GNU ld map file?)')
+    return sizes
+
+
+def add(sizes, in_sec, size, origin, cat):
+    if size == 0:
+        return
+    comp, obj = component_of(origin)
+    key = (comp, obj, symbol_of(in_sec), cat)
+    sizes[key] = sizes.get(key, 0) + size
+
+
+def image_size(by_cat):
+    return sum(by_cat.get(name, 0) for name, _, image in CATEGORIES if image)
+
+
+def by_component(sizes):
+    comps = {}
+    for (comp, _, _, cat), size in sizes.items():
+        c = comps.setdefault(comp, {})
+        c[cat] = c.get(cat, 0) + size
+    return comps
+
+
+def by_symbol(sizes, component=None):
+    syms = {}
+    for (comp, obj, sym, _), size in sizes.items():
+        if component is None or comp == component:
+            key = f'{comp}:{obj}:{sym}'
+            syms[key] = syms.get(key, 0) + size
+    return syms
+
+
+def fmt_delta(v):
+    return f'{v:+d}' if v else '0'
+
+
+def print_components(comps, base=None, top=30):
+    cats = [name for name, _, _ in CATEGORIES]
+    rows = []
+    names = set(comps) | set(base or {})
+    for name in names:
+        cur = comps.get(name, {})
+        old = (base or {}).get(name, {})
+        rows.append((name, image_size(cur), image_size(old), cur))
+    if base is None:
+        rows.sort(key=lambda r: -r[1])
+    else:
+        rows.sort(key=lambda r: -abs(r[1] - r[2]))
+    head = f'{"component":<28}{"image":>9}' + ''.join(f'{c:>14}' for c in cats)
+    print(head + (f'{"delta":>10}' if base is not None else ''))
+    for name, size, old, cur in rows[:top]:
+        line = f'{name:<28}{size:>9}' + ''.join(f'{cur.get(c, 0):>14}' for c in cats)
+        if base is not None:
+            line += f'{fmt_delta(size - old):>10}'
+        print(line)
+    total = sum(r[1] for r in rows)
+    print(f'{"total":<28}{total:>9}' +
+          (f'{"":>{14 * len(cats)}}{fmt_delta(total - sum(r[2] for r in rows)):>10}'
+           if base is not None else ''))
+
+
+def print_symbols(syms, base=None, top=30):
+    if base is None:
+        rows = sorted(syms.items(), key=lambda kv: -kv[1])[:top]
+        for name, size in rows:
+            print(f'{size:>9}  {name}')
+        return
+    names = set(syms) | set(base)
+    rows = [(n, syms.get(n, 0), base.get(n, 0)) for n in names]
+    rows = [r for r in rows if r[1] != r[2]]
+    rows.sort(key=lambda r: -abs(r[1] - r[2]))
+    for name, size, old in rows[:top]:
+        print(f'{fmt_delta(size - old):>9}  {size:>9}  {name}')
+    if not rows:
+        print('  (no symbol changes)')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Per-component and per-symbol firmware size report')
+    ap.add_argument('map')
+    ap.add_argument('--save', metavar='JSON', help='write the current sizes as a baseline')
+    ap.add_argument('--diff', metavar='JSON', help='compare against a saved baseline')
+    ap.add_argument('--component', help='only list symbols of this component (e.g. main)')
+    ap.add_argument('--top', type=int, default=30)
+    args = ap.parse_args()
+
+    sizes = parse_map(args.map)
+    comps = by_component(sizes)
+    syms = by_symbol(sizes)
+
+    if args.save:
+        with open(args.save, 'w') as f:
+            json.dump({'components': comps, 'symbols': syms}, f, indent=0, sort_keys=True)
+        print(f'{args.save}: baseline of {len(syms)} symbols')
+
+    base = None
+    if args.diff:
+        if os.path.exists(args.diff):
+            with open(args.diff) as f:
+                base = json.load(f)
+        else:
+            print(f'{args.diff}: no baseline yet (run size-baseline first)')
+
+    print('== components (bytes) ==')
+    print_components(comps, base and base['components'], args.top)
+    if args.component:
+        syms = by_symbol(sizes, args.component)
+        if base:
+            base['symbols'] = {k: v for k, v in base['symbols'].items()
+                               if k.startswith(args.component + ':')}
+    print(f'\n== symbols{" of " + args.component if args.component else ""}'
+          f'{" (delta, size)" if base else ""} ==')
+    print_symbols(syms, base and base['symbols'], args.top)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+测量设备 BLE 链路的吞吐、抖动与往返延迟（设备端协议见 main/ble_bench.h 与 main.c 中的说明）
+
+设备开机即广播 "ESP32-BLE"，不需要进入特别的界面。电脑上需要 bleak（pip install bleak）。
+可以先请设备按给定的连接间隔、从机延迟与 PHY 重新协商，再跑测试，比较不同参数的效果；
+实际生效的参数（MTU、间隔、PHY）由双方协商，每次测试前后都会打印。
+
+测试:
+  link    只打印当前链路参数
+  echo    往返延迟：控制特征写入令牌，等设备回显（--count 次）
+  sink    电脑 -> 设备：连续写入数据特征，设备只计数；报告吞吐、序号缺口与到达间隔
+  source  设备 -> 电脑：设备连续发通知；报告吞吐、到达抖动、相对延迟的波动与设备重试数
+  all     依次 link、echo、sink、source
+
+用法:
+  python x4blebench.py all
+  python x4blebench.py --itvl 6 12 --phy 2m sink --bytes 1000000
+  python x4blebench.py --address AA:BB:CC:DD:EE:FF source --bytes 2000000 --size 244
+  python x4blebench.py --itvl 24 40 --phy 1m all --csv results.csv
+"""
+
+import argparse
+import asyncio
+import csv
+import os
+import statistics
+import struct
+import sys
+import time
+
+DEVICE_NAME = 'ESP32-BLE'
+CTRL_UUID = '000056c0-0000-1000-8000-00805f9b34fb'
+DATA_UUID = '000056c1-0000-1000-8000-00805f9b34fb'
+
+OP_SINK_RESET = 0x01
+OP_SINK_REPORT = 0x02
+OP_SOURCE = 0x03
+OP_STOP = 0x04
+OP_ECHO = 0x05
+OP_LINK = 0x06
+OP_PARAMS = 0x07
+NT_SINK = 0xC2
+NT_BEGIN = 0xC3
+NT_END = 0xC4
+NT_ECHO = 0xC5
+NT_LINK = 0xC6
+NT_PARAMS = 0xC7
+
+STATUS = {0: 'ok', 1: 'busy', 2: 'bad request', 3: 'aborted', 4: 'data notifications off'}
+PHY_MASK = {'1m': 1, '2m': 2, 'coded': 4}
+PHY_NAME = {1: '1M', 2: '2M', 3: 'coded'}
+
+
+class Bench:
+    def __init__(self, client):
+        self.client = client
+        self.replies = asyncio.Queue()
+        self.arrivals = []      # (电脑时间, 序号, 设备时间, 字节数)
+
+    async def start(self):
+        await self.client.start_notify(CTRL_UUID, self._on_ctrl)
+        await self.client.start_notify(DATA_UUID, self._on_data)
+
+    def _on_ctrl(self, _, data):
+        self.replies.put_nowait(bytes(data))
+
+    def _on_data(self, _, data):
+        seq, dev_us = struct.unpack_from('<II', data)
+        self.arrivals.append((time.perf_counter(), seq, dev_us, len(data)))
+
+    async def request(self, payload, reply_op, timeout=5.0):
+        await self.client.write_gatt_char(CTRL_UUID, payload, response=True)
+        return await self.wait(reply_op, timeout)
+
+    async def wait(self, op, timeout):
+        deadline = time.monotonic() + timeout
+        while True:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                raise TimeoutError(f'no reply 0x{op:02X} from the device')
+            msg = await asyncio.wait_for(self.replies.get(), left)
+            if msg[0] == op:
+                return msg
+
+    async def link(self):
+        msg = await self.request(bytes([OP_LINK]), NT_LINK)
+        mtu, itvl, latency, timeout, tx, rx = struct.unpack_from('<HHHHBB', msg, 1)
+        return {'mtu': mtu, 'interval_ms': itvl * 1.25, 'latency': latency,
+                'timeout_ms': timeout * 10, 'tx_phy': PHY_NAME.get(tx, '?'),
+                'rx_phy': PHY_NAME.get(rx, '?')}
+
+    async def params(self, itvl, latency, phy):
+        lo, hi = itvl if itvl else (0, 0)
+        msg = await self.request(struct.pack('<BHHHB', OP_PARAMS, lo, hi, latency, phy), NT_PARAMS)
+        if msg[1] != 0:
+            print(f'parameter request rejected by the device stack: rc={msg[1]}', file=sys.stderr)
+        # 协商要几个连接事件，慢的间隔下需要更久
+        await asyncio.sleep(1.0)
+
+    async def echo(self, count):
+        rtts = []
+        for i in range(count):
+            token = struct.pack('<I', i)
+            t0 = time.perf_counter()
+            msg = await self.request(bytes([OP_ECHO]) + token, NT_ECHO)
+            if msg[1:5] == token:
+                rtts.append((time.perf_counter() - t0) * 1000)
+        return {'echo_count': len(rtts),
+                'rtt_min_ms': min(rtts), 'rtt_median_ms': statistics.median(rtts),
+                'rtt_max_ms': max(rtts),
+                'rtt_stdev_ms': statistics.stdev(rtts) if len(rtts) > 1 else 0.0}
+
+    async def sink(self, total, size, response):
+        if size <= 0:
+            size = self.client.mtu_size - 3
+        await self.client.write_gatt_char(CTRL_UUID, bytes([OP_SINK_RESET]), response=True)
+        filler = os.urandom(max(size - 4, 0))
+        sent = 0
+        seq = 0
+        t0 = time.perf_counter()
+        while sent < total:
+            pkt = struct.pack('<I', seq) + filler
+            await self.client.write_gatt_char(DATA_UUID, pkt, response=response)
+            sent += len(pkt)
+            seq += 1
+        host_s = time.perf_counter() - t0
+        # 无响应写入在电脑上返回时可能还在排队，报告以设备的统计为准
+        msg = await self.request(bytes([OP_SINK_REPORT]), NT_SINK, timeout=10.0)
+        packets, nbytes, missing, reordered, elapsed, max_gap, jitter = \
+            struct.unpack_from('<IIIIIII', msg, 1)
+        return {'sink_packets': packets, 'sink_bytes': nbytes, 'sink_size': size,
+                'sink_host_kbps': sent / host_s / 1024,
+                'sink_device_kbps': nbytes / (elapsed / 1e6) / 1024 if elapsed else 0.0,
+                'sink_missing': missing, 'sink_reordered': reordered,
+                'sink_max_gap_ms': max_gap / 1000, 'sink_jitter_ms': jitter / 1000,
+                'sink_lost_writes': seq - packets}
+
+    async def source(self, total, size):
+        self.arrivals = []
+        msg = await self.request(struct.pack('<BIH', OP_SOURCE, total, size), NT_BEGIN)
+        if msg[1] != 0:
+            raise RuntimeError(f'source refused: {STATUS.get(msg[1], msg[1])}')
+        size = struct.unpack_from('<H', msg, 2)[0]
+        end = await self.wait(NT_END, timeout=max(30.0, total / 2000))
+        status, packets, nbytes, elapsed, retries = struct.unpack_from('<BIIII', end, 1)
+        await asyncio.sleep(0.2)   # 最后几个通知可能晚于 END 处理
+        arr = sorted(self.arrivals, key=lambda a: a[1])
+        got = len(arr)
+        res = {'source_status': STATUS.get(status, status), 'source_size': size,
+               'source_packets': packets, 'source_received': got,
+               'source_missing': packets - got, 'source_retries': retries,
+               'source_device_kbps': nbytes / (elapsed / 1e6) / 1024 if elapsed else 0.0}
+        if got > 2:
+            host = [a[0] for a in self.arrivals]
+            span = host[-1] - host[0]
+            gaps = [(b - a) * 1000 for a, b in zip(host, host[1:])]
+            # 电脑到达时间减设备发出时间：时钟差不变，波动就是单程延迟的变化
+            offs = [a[0] * 1e6 - a[2] for a in self.arrivals]
+            base = min(offs)
+            res.update({
+                'source_host_kbps': sum(a[3] for a in self.arrivals) / span / 1024 if span else 0.0,
+                'source_jitter_ms': statistics.stdev(gaps),
+                'source_max_gap_ms': max(gaps),
+                'source_delay_spread_ms': (statistics.median(offs) - base) / 1000,
+                'source_delay_max_ms': (max(offs) - base) / 1000,
+            })
+        return res
+
+
+def show(title, res):
+    print(f'== {title}')
+    for k, v in res.items():
+        print(f'  {k:24} {v:.2f}' if isinstance(v, float) else f'  {k:24} {v}')
+
+
+async def find_address(args):
+    if args.address:
+        return args.address
+    from bleak import BleakScanner
+    print(f'scanning for {args.name} ...', file=sys.stderr)
+    dev = await BleakScanner.find_device_by_name(args.name, timeout=10.0)
+    if dev is None:
+        sys.exit(f'{args.name} not found')
+    return dev.address
+
+
+async def run(args):
+    from bleak import BleakClient
+    address = await find_address(args)
+    results = {'test': args.test}
+    async with BleakClient(address) as client:
+        bench = Bench(client)
+        await bench.start()
+        if args.itvl or args.phy:
+            await bench.params(args.itvl, args.latency, PHY_MASK.get(args.phy, 0))
+        link = await bench.link()
+        show('link', link)
+        results.update(link)
+        if args.test in ('echo', 'all'):
+            res = await bench.echo(args.count)
+            show('echo', res)
+            results.update(res)
+        if args.test in ('sink', 'all'):
+            res = await bench.sink(args.bytes, args.size, args.response)
+            show('sink (host -> device)', res)
+            results.update(res)
+        if args.test in ('source', 'all'):
+            res = await bench.source(args.bytes, args.size)
+            show('source (device -> host)', res)
+            results.update(res)
+    if args.csv:
+        new = not os.path.exists(args.csv)
+        with open(args.csv, 'a', newline='') as f:
+            w = csv.DictWriter(f, fieldnames=list(results))
+            if new:
+                w.writeheader()
+            w.writerow(results)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='BLE throughput and latency benchmark')
+    ap.add_argument('--address', help='device address (default: scan by name)')
+    ap.add_argument('--name', default=DEVICE_NAME, help='advertised name to scan for')
+    ap.add_argument('--itvl', type=int, nargs=2, metavar=('MIN', 'MAX'),
+                    help='ask for a connection interval in 1.25 ms units, e.g. 6 12')
+    ap.add_argument('--latency', type=int, default=0, help='peripheral latency with --itvl')
+    ap.add_argument('--phy', choices=sorted(PHY_MASK), help='ask for this PHY')
+    ap.add_argument('test', choices=['link', 'echo', 'sink', 'source', 'all'])
+    ap.add_argument('--bytes', type=int, default=500_000, help='bytes per transfer test')
+    ap.add_argument('--size', type=int, default=0,
+                    help='bytes per write/notification (default: fill the MTU)')
+    ap.add_argument('--count', type=int, default=50, help='echo round trips')
+    ap.add_argument('--response', action='store_true',
+                    help='sink with acknowledged writes instead of write-without-response')
+    ap.add_argument('--csv', help='append the results as one row to this CSV file')
+    args = ap.parse_args()
+    asyncio.run(run(args))
+
+
+if __name__ == '__main__':
+    main()
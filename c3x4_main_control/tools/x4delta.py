@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+"""
+生成、检查 X4DL 固件差分补丁（格式见 main/ota_delta.h）
+
+新镜像表示成 bsdiff 式的记录：旧镜像的一段加上逐字节差值（diff），再插入一段
+新字节（extra），之后旧镜像位置跳转 seek。两次构建之间大部分代码只是地址平移，
+差值几乎全是 0，每个字段单独用 PackBits 压缩。
+
+匹配：装了 bsdiff4（pip install bsdiff4）时直接用它的控制三元组，补丁最小；
+否则用内置的近似匹配（8 字节种子 + 允许少量不同字节的延伸），补丁稍大但不需要依赖。
+
+用法:
+  python x4delta.py diff 旧.bin 新.bin -o update.x4d [--engine auto|bsdiff4|simple]
+  python x4delta.py full 新.bin -o update.x4d        # 不依赖旧镜像的完整补丁
+  python x4delta.py apply 旧.bin update.x4d -o 新.bin  # 在电脑上验证补丁
+  python x4delta.py info update.x4d
+
+补丁用文件传输服务（0x1235）发到 SD 卡，再向 OTA 服务（0x1236）发 APPLY 命令，
+设备把解出的镜像写进空闲的 OTA 分区（见 main/ble_ota.h）。旧镜像必须是设备上
+正在运行的那个 .bin（build/<工程名>.bin）
+"""
+
+import argparse
+import bz2
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4C443458          # "X4DL"
+VERSION = 1
+HEADER = struct.Struct('<IHHIIII8x')
+RECORD = struct.Struct('<IIi')
+
+RUN_MIN = 3
+RUN_MAX = 130
+LIT_MAX = 128
+
+SEED = 8                    # 内置匹配的种子长度
+SEED_STEP = 4               # 旧镜像每隔几个字节建一个种子索引
+WINDOW = 16                 # 近似延伸的检查窗口
+WINDOW_MIN_EQUAL = 8        # 窗口内至少多少字节相同才继续延伸
+ANCHOR_MIN = 32             # 短于此的匹配不值得一条记录
+
+
+def packbits(data):
+    """与 main/packbits.c 相同的编码"""
+    out = bytearray()
+    i, n = 0, len(data)
+
+    def run_length(p):
+        r = 1
+        while p + r < n and r < RUN_MAX and data[p + r] == data[p]:
+            r += 1
+        return r
+
+    while i < n:
+        run = run_length(i)
+        if run >= RUN_MIN:
+            out += bytes((run + 125, data[i]))
+            i += run
+            continue
+        lit = run
+        while i + lit < n and lit < LIT_MAX and run_length(i + lit) < RUN_MIN:
+            lit += 1
+        out.append(lit - 1)
+        out += data[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def unpackbits(buf, pos, size):
+    out = bytearray()
+    while len(out) < size:
+        c = buf[pos]
+        pos += 1
+        if c < 128:
+            out += buf[pos:pos + c + 1]
+            pos += c + 1
+        else:
+            out += bytes((buf[pos],)) * (c - 125)
+            pos += 1
+    if len(out) != size:
+        raise ValueError('PackBits field overruns its length')
+    return bytes(out), pos
+
+
+def offtin(b):
+    v = int.from_bytes(b[:7] + bytes((b[7] & 0x7F,)), 'little')
+    return -v if b[7] & 0x80 else v
+
+
+def triples_bsdiff4(old, new):
+    """bsdiff4 的 BSDIFF40 输出拆成 (diff 字节, extra 字节, seek)"""
+    import bsdiff4
+    patch = bsdiff4.diff(old, new)
+    if patch[:8] != b'BSDIFF40':
+        raise ValueError('unexpected bsdiff4 output')
+    len_ctrl, len_diff = offtin(patch[8:16]), offtin(patch[16:24])
+    ctrl = bz2.decompress(patch[32:32 + len_ctrl])
+    diff = bz2.decompress(patch[32 + len_ctrl:32 + len_ctrl + len_diff])
+    extra = bz2.decompress(patch[32 + len_ctrl + len_diff:])
+    dpos = epos = 0
+    for k in range(0, len(ctrl), 24):
+        dl, el, seek = offtin(ctrl[k:k + 8]), offtin(ctrl[k + 8:k + 16]), offtin(ctrl[k + 16:k + 24])
+        yield diff[dpos:dpos + dl], extra[epos:epos + el], seek
+        dpos += dl
+        epos += el
+
+
+def find_anchors(old, new):
+    """近似匹配：(新位置, 旧位置, 长度)，按新位置递增且不重叠"""
+    index = {}
+    for j in range(0, len(old) - SEED + 1, SEED_STEP):
+        index.setdefault(old[j:j + SEED], j)
+
+    anchors = []
+    i, n, m = 0, len(new), len(old)
+    delta = 0
+    while i + SEED <= n:
+        key = new[i:i + SEED]
+        # 优先沿用上一段的对齐（seek 为 0，记录更少）
+        j = i + delta
+        if not (0 <= j <= m - SEED and old[j:j + SEED] == key):
+            j = index.get(key)
+            if j is None:
+                i += 1
+                continue
+        p = i
+        while p < n and j + (p - i) < m:
+            w = min(WINDOW, n - p, m - (j + p - i))
+            o = j + (p - i)
+            equal = sum(1 for a, b in zip(new[p:p + w], old[o:o + w]) if a == b)
+            if equal < min(WINDOW_MIN_EQUAL, w):
+                break
+            p += w
+        # 去掉末尾不同的字节，留给 extra
+        while p > i and new[p - 1] != old[j + (p - i) - 1]:
+            p -= 1
+        if p - i >= ANCHOR_MIN:
+            anchors.append((i, j, p - i))
+            delta = j - i
+            i = p
+        else:
+            i += 1
+    return anchors
+
+
+def triples_simple(old, new):
+    anchors = find_anchors(old, new)
+    old_pos, new_pos = 0, 0
+    if not anchors or anchors[0][0] > 0 or anchors[0][1] > 0:
+        first_old = anchors[0][1] if anchors else 0
+        end = anchors[0][0] if anchors else len(new)
+        yield b'', new[:end], first_old
+        old_pos, new_pos = first_old, end
+    for k, (ns, os_, ln) in enumerate(anchors):
+        assert ns == new_pos and os_ == old_pos
+        diff = bytes((a - b) & 0xFF for a, b in zip(new[ns:ns + ln], old[os_:os_ + ln]))
+        nxt = anchors[k + 1] if k + 1 < len(anchors) else (len(new), os_ + ln, 0)
+        yield diff, new[ns + ln:nxt[0]], nxt[1] - (os_ + ln)
+        old_pos, new_pos = nxt[1], nxt[0]
+
+
+def build(old, new, triples):
+    out = bytearray(HEADER.pack(MAGIC, VERSION, 0, len(old), zlib.crc32(old), len(new),
+                                zlib.crc32(new)))
+    for diff, extra, seek in triples:
+        out += RECORD.pack(len(diff), len(extra), seek)
+        out += packbits(diff)
+        out += packbits(extra)
+    return bytes(out)
+
+
+def apply(old, patch):
+    magic, version, flags, old_size, old_crc, new_size, new_crc = HEADER.unpack_from(patch)
+    if magic != MAGIC or version != VERSION or flags != 0:
+        raise ValueError('not an X4DL v1 patch')
+    if len(old) < old_size or zlib.crc32(old[:old_size]) != old_crc:
+        raise ValueError('base image does not match the patch')
+    pos, old_pos = HEADER.size, 0
+    new = bytearray()
+    while len(new) < new_size:
+        dl, el, seek = RECORD.unpack_from(patch, pos)
+        pos += RECORD.size
+        diff, pos = unpackbits(patch, pos, dl)
+        new += bytes((a + b) & 0xFF for a, b in zip(diff, old[old_pos:old_pos + dl]))
+        extra, pos = unpackbits(patch, pos, el)
+        new += extra
+        old_pos += dl + seek
+    if len(new) != new_size or zlib.crc32(new) != new_crc:
+        raise ValueError('patched image CRC mismatch')
+    return bytes(new)
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def main():
+    ap = argparse.ArgumentParser(description='X4DL firmware delta patches')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    p = sub.add_parser('diff')
+    p.add_argument('old')
+    p.add_argument('new')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('--engine', choices=('auto', 'bsdiff4', 'simple'), default='auto')
+    p = sub.add_parser('full')
+    p.add_argument('new')
+    p.add_argument('-o', '--output', required=True)
+    p = sub.add_parser('apply')
+    p.add_argument('old')
+    p.add_argument('patch')
+    p.add_argument('-o', '--output', required=True)
+    p = sub.add_parser('info')
+    p.add_argument('patch')
+    args = ap.parse_args()
+
+    if args.cmd in ('diff', 'full'):
+        new = read(args.new)
+        old = read(args.old) if args.cmd == 'diff' else b''
+        engine = getattr(args, 'engine', 'simple')
+        if engine == 'auto':
+            try:
+                import bsdiff4  # noqa: F401
+                engine = 'bsdiff4'
+            except ImportError:
+                engine = 'simple'
+        if not old:
+            triples = [(b'', new, 0)]
+        elif engine == 'bsdiff4':
+            triples = triples_bsdiff4(old, new)
+        else:
+            triples = triples_simple(old, new)
+        patch = build(old, new, triples)
+        if old and apply(old, patch) != new:
+            sys.exit('internal error: patch does not reproduce the new image')
+        with open(args.output, 'wb') as f:
+            f.write(patch)
+        print(f'{args.output}: {len(patch)} bytes for a {len(new)}-byte image '
+              f'({100.0 * len(patch) / len(new):.1f}%, engine {engine if old else "full"})')
+    elif args.cmd == 'apply':
+        new = apply(read(args.old), read(args.patch))
+        with open(args.output, 'wb') as f:
+            f.write(new)
+        print(f'{args.output}: {len(new)} bytes, CRC OK')
+    else:
+        patch = read(args.patch)
+        magic, version, flags, old_size, old_crc, new_size, new_crc = HEADER.unpack_from(patch)
+        if magic != MAGIC:
+            sys.exit('not an X4DL patch')
+        print(f'version {version}, base {old_size} bytes (CRC {old_crc:08x}), '
+              f'new {new_size} bytes (CRC {new_crc:08x}), patch {len(patch)} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""
+生成阅读器查词用的离线词典（格式见 main/ui/dict.h），复制到 SD 卡根目录的 词典.x4d
+
+输入：
+  - 制表符分隔的文本（UTF-8）：每行 词<TAB>释义，释义中的 \\n 表示换行
+  - StarDict 词典：给出 .ifo 文件，同目录下的 .idx 与 .dict（或 .dict.dz）一起读入
+键按 ASCII 小写化后按字节排序，重复的词合并释义。词条依次装进约 4 KB 的块，块内与块目录
+都对键做前缀压缩，块按 main/lz_block.c 的格式压缩（压缩后不更小的原样保存）。
+写完后逐块解压校验，并可用 --lookup 按固件的查找步骤查几个词。
+
+用法:
+  python x4dict.py words.tsv -o 词典.x4d
+  python x4dict.py stardict-langdao-ec/langdao-ec-gb.ifo -o 词典.x4d
+  python x4dict.py words.tsv -o 词典.x4d --lookup hello 你好
+"""
+
+import argparse
+import gzip
+import os
+import re
+import struct
+import sys
+
+from font_blocks import lz_decode, lz_encode
+
+MAGIC = 0x43443458          # "X4DC"，与 DICT_MAGIC 一致
+VERSION = 1
+HEADER_FORMAT = '<IHHIIIIII'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+KEY_MAX = 64                # DICT_KEY_MAX
+DEF_MAX = 4000              # DICT_DEF_MAX
+DIR_ENTRY_FORMAT = '<BBHHI'
+BLOCK_ENTRY_FORMAT = '<BBH'
+
+
+def normalize_key(word):
+    word = word.strip()
+    return ''.join(c.lower() if c < '\x80' else c for c in word).encode('utf-8')
+
+
+def clip_definition(text):
+    data = text.strip().encode('utf-8')
+    if len(data) <= DEF_MAX:
+        return data
+    return data[:DEF_MAX].decode('utf-8', 'ignore').encode('utf-8')
+
+
+def read_tsv(path):
+    with open(path, encoding='utf-8-sig') as f:
+        for line in f:
+            word, sep, definition = line.rstrip('\r\n').partition('\t')
+            if sep:
+                yield word, definition.replace('\\n', '\n')
+
+
+def read_stardict(ifo_path):
+    info = {}
+    with open(ifo_path, encoding='utf-8') as f:
+        for line in f:
+            key, sep, value = line.strip().partition('=')
+            if sep:
+                info[key] = value
+    base = ifo_path[:-4]
+    dict_path = base + '.dict' if os.path.exists(base + '.dict') else base + '.dict.dz'
+    opener = gzip.open if dict_path.endswith('.dz') else open
+    with opener(dict_path, 'rb') as f:
+        data = f.read()
+    with open(base + '.idx', 'rb') as f:
+        idx = f.read()
+    # 只支持文本类型：h/x（HTML/XDXF）去掉标签
+    markup = info.get('sametypesequence', 'm') in ('h', 'x', 'g')
+    offset_format = '>Q' if info.get('idxoffsetbits') == '64' else '>I'
+    offset_size = struct.calcsize(offset_format)
+    pos = 0
+    while pos < len(idx):
+        end = idx.index(b'\0', pos)
+        word = idx[pos:end].decode('utf-8', 'ignore')
+        pos = end + 1
+        offset = struct.unpack_from(offset_format, idx, pos)[0]
+        size = struct.unpack_from('>I', idx, pos + offset_size)[0]
+        pos += offset_size + 4
+        text = data[offset:offset + size].decode('utf-8', 'ignore')
+        if markup:
+            text = re.sub(r'<br\s*/?>', '\n', text)
+            text = re.sub(r'<[^>]+>', '', text)
+        yield word, text
+
+
+def collect(inputs):
+    entries = {}
+    for path in inputs:
+        reader = read_stardict if path.endswith('.ifo') else read_tsv
+        for word, definition in reader(path):
+            key = normalize_key(word)
+            if not key or len(key) > KEY_MAX or not definition.strip():
+                continue
+            if key in entries:
+                entries[key] += '\n' + definition.strip()
+            else:
+                entries[key] = definition.strip()
+    return sorted((k, clip_definition(v)) for k, v in entries.items())
+
+
+def shared_prefix(a, b):
+    n = 0
+    limit = min(len(a), len(b))
+    while n < limit and a[n] == b[n]:
+        n += 1
+    return n
+
+
+def pack_blocks(entries, block_size):
+    """返回 [(首键, 原始字节)]"""
+    blocks = []
+    raw = bytearray()
+    first = prev = None
+    for key, definition in entries:
+        size = 4 + len(key) + len(definition)
+        if raw and len(raw) + size > block_size:
+            blocks.append((first, bytes(raw)))
+            raw = bytearray()
+        if not raw:
+            first = key
+            shared = 0
+        else:
+            shared = shared_prefix(prev, key)
+        suffix = key[shared:]
+        raw += struct.pack(BLOCK_ENTRY_FORMAT, shared, len(suffix), len(definition))
+        raw += suffix + definition
+        prev = key
+    if raw:
+        blocks.append((first, bytes(raw)))
+    return blocks
+
+
+def build(entries, block_size, restart):
+    blocks = pack_blocks(entries, block_size)
+    body = bytearray()
+    placed = []                    # (首键, 原始长度, 存储长度, 文件偏移)
+    for first, raw in blocks:
+        packed = lz_encode(raw)
+        stored = packed if len(packed) < len(raw) else raw
+        placed.append((first, len(raw), len(stored), HEADER_SIZE + len(body)))
+        body += stored
+
+    directory = bytearray()
+    restarts = []
+    prev = b''
+    for i, (first, raw_len, stored_len, offset) in enumerate(placed):
+        if i % restart == 0:
+            restarts.append(len(directory))
+            shared = 0
+        else:
+            shared = shared_prefix(prev, first)
+        suffix = first[shared:]
+        directory += struct.pack(DIR_ENTRY_FORMAT, shared, len(suffix), raw_len, stored_len, offset)
+        directory += suffix
+        prev = first
+    for r in restarts:
+        directory += struct.pack('<I', r)
+
+    header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, restart, len(entries), len(blocks),
+                         max(len(raw) for _, raw in blocks), HEADER_SIZE + len(body),
+                         len(directory), len(restarts))
+    return header + bytes(body) + bytes(directory)
+
+
+class Reader:
+    """按固件（main/ui/dict.c）的步骤查找，用于校验"""
+
+    def __init__(self, data):
+        self.data = data
+        (magic, version, self.restart, self.entry_count, self.block_count, self.block_max,
+         self.dir_offset, self.dir_size, self.restart_count) = struct.unpack_from(HEADER_FORMAT, data)
+        if magic != MAGIC or version != VERSION:
+            raise ValueError('not a dictionary file')
+        self.table = self.dir_offset + self.dir_size - self.restart_count * 4
+
+    def dir_entry(self, pos, key):
+        shared, suffix, raw, stored, offset = struct.unpack_from(DIR_ENTRY_FORMAT, self.data, pos)
+        pos += struct.calcsize(DIR_ENTRY_FORMAT)
+        key = key[:shared] + self.data[pos:pos + suffix]
+        return pos + suffix, key, (raw, stored, offset)
+
+    def restart_pos(self, r):
+        return self.dir_offset + struct.unpack_from('<I', self.data, self.table + r * 4)[0]
+
+    def blocks(self):
+        pos = self.dir_offset
+        key = b''
+        for _ in range(self.block_count):
+            pos, key, blk = self.dir_entry(pos, key)
+            yield key, blk
+
+    def block(self, blk):
+        raw, stored, offset = blk
+        data = self.data[offset:offset + stored]
+        return data if stored == raw else lz_decode(data, raw)
+
+    def entries(self, raw):
+        pos = 0
+        key = b''
+        while pos < len(raw):
+            shared, suffix, dlen = struct.unpack_from(BLOCK_ENTRY_FORMAT, raw, pos)
+            pos += 4
+            key = key[:shared] + raw[pos:pos + suffix]
+            pos += suffix
+            yield key, raw[pos:pos + dlen]
+            pos += dlen
+
+    def lookup(self, word):
+        key = normalize_key(word)
+        lo, hi = 0, self.restart_count
+        while lo < hi:
+            mid = (lo + hi) // 2
+            _, first, _ = self.dir_entry(self.restart_pos(mid), b'')
+            if first <= key:
+                lo = mid + 1
+            else:
+                hi = mid
+        if lo == 0:
+            return None
+        index = (lo - 1) * self.restart
+        pos, first, found = self.dir_entry(self.restart_pos(lo - 1), b'')
+        for _ in range(1, self.restart):
+            index += 1
+            if index >= self.block_count:
+                break
+            pos, first, blk = self.dir_entry(pos, first)
+            if first > key:
+                break
+            found = blk
+        for k, definition in self.entries(self.block(found)):
+            if k == key:
+                return definition.decode('utf-8')
+            if k > key:
+                break
+        return None
+
+
+def verify(out, entries):
+    reader = Reader(out)
+    got = []
+    for _, blk in reader.blocks():
+        got.extend(reader.entries(reader.block(blk)))
+    if got != entries:
+        raise ValueError('blocks do not decode to the input entries')
+    for key, definition in entries[::max(1, len(entries) // 200)]:
+        if reader.lookup(key.decode('utf-8')) != definition.decode('utf-8'):
+            raise ValueError(f'lookup failed for {key!r}')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build an X4 offline dictionary (.x4d)')
+    ap.add_argument('inputs', nargs='+', help='word<TAB>definition text files or StarDict .ifo files')
+    ap.add_argument('-o', '--output', default='词典.x4d', help='output file')
+    ap.add_argument('--block-size', type=int, default=4096,
+                    help='target uncompressed block size in bytes')
+    ap.add_argument('--restart', type=int, default=16,
+                    help='directory entries between full (uncompressed) keys')
+    ap.add_argument('--lookup', nargs='*', default=[], help='look these words up in the output')
+    args = ap.parse_args()
+    if not 256 <= args.block_size <= 16384 or not 1 <= args.restart <= 1024:
+        sys.exit('block size must be 256..16384 and restart 1..1024')
+
+    entries = collect(args.inputs)
+    if not entries:
+        sys.exit('no entries found')
+    out = build(entries, args.block_size, args.restart)
+    verify(out, entries)
+    with open(args.output, 'wb') as f:
+        f.write(out)
+    reader = Reader(out)
+    print(f'{args.output}: {len(entries)} entries, {reader.block_count} blocks, '
+          f'{reader.dir_size} byte directory, {len(out)} bytes')
+    for word in args.lookup:
+        definition = reader.lookup(word)
+        print(f'{word}: {definition if definition is not None else "(not found)"}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,376 @@
+#!/usr/bin/env python3
+"""
+在电脑上生成、检查 X4PG 预排版书籍（格式见 main/ui/x4pg_book.h）
+
+排版、字体光栅化和抖动都在电脑上完成，每页存一整帧面板布局的位图（PackBits 压缩），
+前面是页偏移表：设备翻到任意一页都是读两项偏移、顺序读一段数据再解压进 framebuffer，
+与书的长度和字体无关。文件按显示方向生成（默认竖屏，--landscape 为面板原生横屏），
+设备上方向不符时拒绝打开。
+
+用法:
+  python x4pg.py text 小说.txt -o 小说.x4pg --font NotoSerifCJK.ttc --size 26
+  python x4pg.py images 漫画/*.png -o 漫画.x4pg --bpp 2 --title 漫画
+  python x4pg.py info 小说.x4pg
+  python x4pg.py extract 小说.x4pg 12 -o page12.pbm   # 按逻辑方向导出一页检查
+
+text / images 需要 Pillow（pip install pillow）；info / extract 不需要。
+2bpp 文件保留四级灰度，当前设备以黑白显示（按 >= 2 为白二值化），
+多数情况下 1bpp 的 Floyd-Steinberg 抖动效果更好、文件也只有一半大
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+try:
+    from PIL import Image, ImageDraw, ImageFont
+except ImportError:
+    Image = None
+
+MAGIC = 0x47503458          # "X4PG"
+VERSION = 1
+TITLE_MAX = 64
+HEADER = struct.Struct('<IHBBHHII64sI')
+PORTRAIT, LANDSCAPE = 0, 1
+
+PANEL_WIDTH = 800           # 面板物理尺寸（framebuffer 每行 100 字节）
+PANEL_HEIGHT = 480
+
+RUN_MIN = 3
+RUN_MAX = 130
+LIT_MAX = 128
+
+
+def fnv1a(data, h=2166136261):
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def packbits(data):
+    """与 main/packbits.c 相同的编码"""
+    out = bytearray()
+    i, n = 0, len(data)
+
+    def run_length(p):
+        r = 1
+        while p + r < n and r < RUN_MAX and data[p + r] == data[p]:
+            r += 1
+        return r
+
+    while i < n:
+        run = run_length(i)
+        if run >= RUN_MIN:
+            out += bytes((run + 125, data[i]))
+            i += run
+            continue
+        lit = run
+        while i + lit < n and lit < LIT_MAX and run_length(i + lit) < RUN_MIN:
+            lit += 1
+        out.append(lit - 1)
+        out += data[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def unpackbits(buf, pos, size):
+    out = bytearray()
+    while len(out) < size:
+        c = buf[pos]
+        pos += 1
+        if c < 128:
+            out += buf[pos:pos + c + 1]
+            pos += c + 1
+        else:
+            out += bytes((buf[pos],)) * (c - 125)
+            pos += 1
+    if len(out) != size:
+        raise ValueError('page data overruns the frame')
+    return bytes(out), pos
+
+
+def frame_size(bpp):
+    return PANEL_WIDTH * PANEL_HEIGHT * bpp // 8
+
+
+def logical_size(orientation):
+    """逻辑页面尺寸（宽, 高）"""
+    return (PANEL_HEIGHT, PANEL_WIDTH) if orientation == PORTRAIT else (PANEL_WIDTH, PANEL_HEIGHT)
+
+
+def write_book(path, frames, bpp, orientation, title):
+    """frames：面板布局的整帧位图（bytes）；先写临时文件再改名，半截文件不会留在卡上"""
+    title_raw = title.encode('utf-8')[:TITLE_MAX]
+    while title_raw:
+        try:
+            title_raw.decode('utf-8')
+            break
+        except UnicodeDecodeError:
+            title_raw = title_raw[:-1]    # 截断时不留半个字符
+    table_offset = HEADER.size
+    offsets = [table_offset + 4 * (len(frames) + 1)]
+    pages = []
+    for frame in frames:
+        if len(frame) != frame_size(bpp):
+            raise ValueError('frame has the wrong size')
+        pages.append(packbits(frame))
+        offsets.append(offsets[-1] + len(pages[-1]))
+    head = HEADER.pack(MAGIC, VERSION, bpp, orientation, PANEL_WIDTH, PANEL_HEIGHT, len(frames),
+                       table_offset, title_raw, 0)[:-4]
+    tmp = path + '.tmp'
+    with open(tmp, 'wb') as f:
+        f.write(head + struct.pack('<I', fnv1a(head)))
+        f.write(struct.pack(f'<{len(offsets)}I', *offsets))
+        for page in pages:
+            f.write(page)
+    os.replace(tmp, path)
+    return offsets[-1]
+
+
+def read_book(path):
+    """返回 (文件头字段, 偏移表, 文件内容)；格式不对时抛出 ValueError"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        raise ValueError('file too short')
+    magic, version, bpp, orientation, width, height, count, table, title, check = \
+        HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('not an X4PG v%d file' % VERSION)
+    if check != fnv1a(data[:HEADER.size - 4]):
+        raise ValueError('header checksum mismatch')
+    if bpp not in (1, 2) or (width, height) != (PANEL_WIDTH, PANEL_HEIGHT) or count == 0:
+        raise ValueError('unsupported geometry %dx%d %dbpp' % (width, height, bpp))
+    if table + 4 * (count + 1) > len(data):
+        raise ValueError('page table truncated')
+    offsets = struct.unpack_from(f'<{count + 1}I', data, table)
+    header = {
+        'bpp': bpp,
+        'orientation': orientation,
+        'pages': count,
+        'title': title.rstrip(b'\0').decode('utf-8', 'replace'),
+    }
+    return header, offsets, data
+
+
+def decode_page(header, offsets, data, page):
+    start, end = offsets[page], offsets[page + 1]
+    if not start < end <= len(data):
+        raise ValueError('page %d has a bad offset' % (page + 1))
+    frame, pos = unpackbits(data, start, frame_size(header['bpp']))
+    if pos > end:
+        raise ValueError('page %d overruns its slot' % (page + 1))
+    return frame
+
+
+def frame_pixel(frame, bpp, orientation, x, y):
+    """逻辑坐标的像素亮度：1bpp 为 0/1，2bpp 为 0..3"""
+    if orientation == PORTRAIT:
+        x, y = y, PANEL_HEIGHT - 1 - x    # 与 lvgl_fb_put_bitmap 的竖屏映射相同
+    i = y * PANEL_WIDTH + x
+    if bpp == 1:
+        return (frame[i >> 3] >> (7 - (i & 7))) & 1
+    return (frame[i >> 2] >> (6 - 2 * (i & 3))) & 3
+
+
+# ---------------------------------------------------------------------------
+# 生成页面（Pillow）
+# ---------------------------------------------------------------------------
+
+def require_pillow():
+    if Image is None:
+        sys.exit('Pillow is required for this command: pip install pillow')
+
+
+def to_frame(page, bpp, orientation):
+    """逻辑方向的 L 模式页面抖动、旋转成面板布局的一帧"""
+    if orientation == PORTRAIT:
+        page = page.transpose(Image.Transpose.ROTATE_90)
+    if bpp == 1:
+        return page.convert('1', dither=Image.Dither.FLOYDSTEINBERG).tobytes()
+    palette = Image.new('P', (1, 1))
+    palette.putpalette([v for level in range(4) for v in (level * 85,) * 3] + [0] * 3 * 252)
+    levels = page.convert('RGB').quantize(palette=palette, dither=Image.Dither.FLOYDSTEINBERG)
+    px = levels.tobytes()
+    out = bytearray(len(px) // 4)
+    for i in range(len(out)):
+        a, b, c, d = px[4 * i:4 * i + 4]
+        out[i] = (a << 6) | (b << 4) | (c << 2) | d
+    return bytes(out)
+
+
+def image_pages(paths, orientation):
+    width, height = logical_size(orientation)
+    for path in paths:
+        with Image.open(path) as src:
+            src = src.convert('L')
+            scale = min(width / src.width, height / src.height)
+            size = (max(1, round(src.width * scale)), max(1, round(src.height * scale)))
+            page = Image.new('L', (width, height), 255)
+            page.paste(src.resize(size, Image.Resampling.LANCZOS),
+                       ((width - size[0]) // 2, (height - size[1]) // 2))
+            yield page
+
+
+def wrap_paragraph(draw, font, text, width):
+    """逐字折行（中文没有词间空格；西文在空格处断开更好，但按字符也不会出错）"""
+    lines, line = [], ''
+    for ch in text:
+        if line and draw.textlength(line + ch, font=font) > width:
+            cut = line.rfind(' ') if ch != ' ' and ch.isascii() and ch.isalnum() else -1
+            if cut > 0 and line[cut + 1:].isascii():
+                lines.append(line[:cut])
+                line = line[cut + 1:]
+            else:
+                lines.append(line)
+                line = ''
+            if ch == ' ':
+                continue
+        line += ch
+    lines.append(line)
+    return lines
+
+
+def text_pages(text, orientation, font, margin, line_spacing, show_number):
+    width, height = logical_size(orientation)
+    probe = ImageDraw.Draw(Image.new('L', (1, 1)))
+    ascent, descent = font.getmetrics()
+    pitch = ascent + descent + line_spacing
+    footer = pitch if show_number else 0
+    per_page = max(1, (height - 2 * margin - footer) // pitch)
+    lines = []
+    for para in text.replace('\r\n', '\n').replace('\r', '\n').split('\n'):
+        lines += wrap_paragraph(probe, font, para.rstrip(), width - 2 * margin)
+    total = (len(lines) + per_page - 1) // per_page
+    for n in range(total):
+        page = Image.new('L', (width, height), 255)
+        draw = ImageDraw.Draw(page)
+        for i, line in enumerate(lines[n * per_page:(n + 1) * per_page]):
+            draw.text((margin, margin + i * pitch), line, font=font, fill=0)
+        if show_number:
+            label = f'{n + 1} / {total}'
+            draw.text(((width - draw.textlength(label, font=font)) // 2, height - margin - pitch),
+                      label, font=font, fill=0)
+        yield page
+
+
+def read_text(path, encoding):
+    raw = open(path, 'rb').read()
+    for enc in ([encoding] if encoding else ['utf-8-sig', 'gb18030']):
+        try:
+            return raw.decode(enc)
+        except UnicodeDecodeError:
+            continue
+    sys.exit(f'{path}: cannot decode as UTF-8 or GB18030, pass --encoding')
+
+
+def build(args, pages):
+    orientation = LANDSCAPE if args.landscape else PORTRAIT
+    frames = [to_frame(page, args.bpp, orientation) for page in pages]
+    if not frames:
+        sys.exit('nothing to write')
+    size = write_book(args.output, frames, args.bpp, orientation, args.title or '')
+    print(f'{args.output}: {len(frames)} pages, {size} bytes '
+          f'({size / len(frames) / 1024:.1f} KiB per page)')
+
+
+def cmd_text(args):
+    require_pillow()
+    font = ImageFont.truetype(args.font, args.size)
+    if args.title is None:
+        args.title = os.path.splitext(os.path.basename(args.input))[0]
+    orientation = LANDSCAPE if args.landscape else PORTRAIT
+    build(args, text_pages(read_text(args.input, args.encoding), orientation, font, args.margin,
+                           args.line_spacing, not args.no_page_numbers))
+
+
+def cmd_images(args):
+    require_pillow()
+    build(args, image_pages(args.inputs, LANDSCAPE if args.landscape else PORTRAIT))
+
+
+def cmd_info(args):
+    try:
+        header, offsets, data = read_book(args.input)
+        for page in range(header['pages']):
+            decode_page(header, offsets, data, page)
+    except ValueError as e:
+        sys.exit(f'{args.input}: {e}')
+    sizes = [offsets[i + 1] - offsets[i] for i in range(header['pages'])]
+    print(f"title:       {header['title'] or '(none)'}")
+    print(f"orientation: {'portrait' if header['orientation'] == PORTRAIT else 'landscape'}")
+    print(f"pages:       {header['pages']} x {header['bpp']}bpp")
+    print(f'file size:   {len(data)} bytes')
+    print(f'page data:   min {min(sizes)} / avg {sum(sizes) // len(sizes)} / max {max(sizes)} bytes '
+          f"(frame {frame_size(header['bpp'])})")
+
+
+def cmd_extract(args):
+    try:
+        header, offsets, data = read_book(args.input)
+        if not 1 <= args.page <= header['pages']:
+            raise ValueError(f"page must be 1..{header['pages']}")
+        frame = decode_page(header, offsets, data, args.page - 1)
+    except ValueError as e:
+        sys.exit(f'{args.input}: {e}')
+    bpp, orientation = header['bpp'], header['orientation']
+    width, height = logical_size(orientation)
+    with open(args.output, 'wb') as f:
+        if bpp == 1:
+            # PBM 的 1 为黑色，与 framebuffer 相反
+            f.write(b'P4\n%d %d\n' % (width, height))
+            for y in range(height):
+                row = bytearray((width + 7) // 8)
+                for x in range(width):
+                    if not frame_pixel(frame, 1, orientation, x, y):
+                        row[x >> 3] |= 0x80 >> (x & 7)
+                f.write(row)
+        else:
+            f.write(b'P5\n%d %d\n255\n' % (width, height))
+            for y in range(height):
+                f.write(bytes(frame_pixel(frame, 2, orientation, x, y) * 85 for x in range(width)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='生成、检查 X4PG 预排版书籍')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+
+    def output_options(p):
+        p.add_argument('-o', '--output', required=True)
+        p.add_argument('--title', help='书名（最多 64 字节 UTF-8）')
+        p.add_argument('--bpp', type=int, choices=(1, 2), default=1)
+        p.add_argument('--landscape', action='store_true', help='按面板原生横屏生成（默认竖屏）')
+
+    p = sub.add_parser('text', help='用 TrueType 字体排版 TXT')
+    p.add_argument('input')
+    p.add_argument('--font', required=True, help='.ttf / .otf / .ttc 字体')
+    p.add_argument('--size', type=int, default=24, help='字号（像素）')
+    p.add_argument('--margin', type=int, default=20)
+    p.add_argument('--line-spacing', type=int, default=6)
+    p.add_argument('--encoding', help='默认先试 UTF-8 再试 GB18030')
+    p.add_argument('--no-page-numbers', action='store_true')
+    output_options(p)
+    p.set_defaults(func=cmd_text)
+
+    p = sub.add_parser('images', help='每张图片一页（等比缩放居中）')
+    p.add_argument('inputs', nargs='+')
+    output_options(p)
+    p.set_defaults(func=cmd_images)
+
+    p = sub.add_parser('info', help='校验文件并显示概况')
+    p.add_argument('input')
+    p.set_defaults(func=cmd_info)
+
+    p = sub.add_parser('extract', help='按逻辑方向导出一页为 PBM / PGM')
+    p.add_argument('input')
+    p.add_argument('page', type=int, help='页码（从 1 开始）')
+    p.add_argument('-o', '--output', required=True)
+    p.set_defaults(func=cmd_extract)
+
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
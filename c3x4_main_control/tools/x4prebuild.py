@@ -0,0 +1,583 @@
+#!/usr/bin/env python3
+"""
+在电脑上为 SD 卡预先生成设备缓存，新放进去的书和图片第一次打开就是热缓存的速度
+
+生成的文件与固件写出的完全同一格式，放在卡上的 .x4cache/ 下：
+  - library.db          书库数据库（main/ui/library_db.c）：EPUB 的书名、作者、语言与
+                        48x64 封面缩略图，TXT 的文件名书名
+  - img/<哈希>.xic       图片浏览器的缩略图位图（main/ui/image_cache.c），PackBits 压缩
+
+设备照常校验：数据库的版本号与记录长度、每条记录的 FNV-1a 校验，以及每个文件的大小与
+修改时间；对不上的条目会被当作不存在并在设备上重新生成，所以预生成的缓存只会省时间，
+不会显示过期的内容。缩放与 Floyd-Steinberg 抖动按固件的整数算法实现（main/ui/epub_image.c），
+JPEG 的 DCT 缩放由 Pillow 完成，个别像素可能与设备解出的略有不同。
+
+分页索引（.pgi）取决于设备上的字体度量与排版参数，EPUB 章节缓存取决于固件内部的
+解析结果，这两类仍在设备上生成。
+
+修改时间：FAT 记录的是本地时间，设备（未设置时区，按 UTC）把它直接当作 UTC 读出。
+Windows / macOS 挂载的卡用默认的 --mtime local；Linux 按 UTC 挂载 vfat 时用 --mtime utc。
+
+用法:
+  python x4prebuild.py /media/sdcard                 # 卡的根目录（对应设备上的 /sdcard）
+  python x4prebuild.py /media/sdcard --bpp 2         # 设备开启了灰阶显示
+  python x4prebuild.py /media/sdcard --no-images -v
+
+需要 Pillow（pip install pillow）才能生成缩略图和封面；没有时只写书名等元数据
+"""
+
+import argparse
+import calendar
+import io
+import os
+import posixpath
+import struct
+import sys
+import time
+import urllib.parse
+import xml.etree.ElementTree as ET
+import zipfile
+
+try:
+    from PIL import Image
+except ImportError:
+    Image = None
+
+DEVICE_ROOT = '/sdcard'
+CACHE_DIR = '.x4cache'
+
+# library_db.c
+DB_MAGIC = 0x4244424C            # "LBDB"
+DB_VERSION = 1
+DB_MAX_BOOKS = 512
+DB_HEADER = struct.Struct('<IHHII')
+DB_KEY = struct.Struct('<IIII')
+PATH_MAX = 128
+BOOK = struct.Struct('<128s96s64s16sIBBBB')
+THUMB_WIDTH = 48
+THUMB_HEIGHT = 64
+THUMB_STRIDE = (THUMB_WIDTH + 7) // 8
+THUMB_BYTES = THUMB_STRIDE * THUMB_HEIGHT
+RECORD_SIZE = BOOK.size + THUMB_BYTES
+DB_KEYS_OFFSET = DB_HEADER.size
+DB_RECORDS_OFFSET = DB_KEYS_OFFSET + DB_MAX_BOOKS * DB_KEY.size
+INDEX_MAX_DEPTH = 6
+BOOK_TXT = 1
+BOOK_EPUB = 2
+
+# image_cache.c / image_cache.h
+XIC_MAGIC = 0x32434958           # "XIC2"
+XIC_HEADER = struct.Struct('<IIIIHHHHB3x')
+IMAGE_THUMB_WIDTH = 144
+IMAGE_THUMB_HEIGHT = 176
+IMAGE_EXTS = ('.jpg', '.jpeg', '.png')
+
+# epub_image.c 照片色调（只用于 2bpp）
+PHOTO_SAMPLE_SIZE = 64
+PHOTO_CLIP_PERMILLE = 10
+PHOTO_MIN_RANGE = 64
+PHOTO_MIDTONE_LIFT = 64
+
+RUN_MIN = 3
+RUN_MAX = 130
+LIT_MAX = 128
+
+
+def fnv1a(data, h=0):
+    """与 page_index_hash 相同：h 为 0 时从 FNV 偏移基数开始"""
+    if h == 0:
+        h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def path_key(device_path):
+    h = fnv1a(device_path.encode('utf-8'))
+    return h if h != 0 else 1
+
+
+def cstr(text, size):
+    """strncpy(dst, src, size - 1)：按字节截断（与设备一样可能截在字符中间）"""
+    return text.encode('utf-8')[:size - 1]
+
+
+def tdiv(a, b):
+    """C 的整数除法（向零取整）"""
+    q = abs(a) // b
+    return q if a >= 0 else -q
+
+
+def device_mtime(st, mode):
+    mtime = int(st.st_mtime)
+    if mode == 'local':
+        mtime = calendar.timegm(time.localtime(mtime))
+    return (mtime & ~1) & 0xFFFFFFFF   # FAT 时间戳精度 2 秒
+
+
+def packbits(data):
+    """与 main/packbits.c 相同的编码"""
+    out = bytearray()
+    i, n = 0, len(data)
+
+    def run_length(p):
+        r = 1
+        while p + r < n and r < RUN_MAX and data[p + r] == data[p]:
+            r += 1
+        return r
+
+    while i < n:
+        run = run_length(i)
+        if run >= RUN_MIN:
+            out += bytes((run + 125, data[i]))
+            i += run
+            continue
+        lit = run
+        while i + lit < n and lit < LIT_MAX and run_length(i + lit) < RUN_MIN:
+            lit += 1
+        out.append(lit - 1)
+        out += data[i:i + lit]
+        i += lit
+    return bytes(out)
+
+
+def write_atomic(path, data):
+    tmp = path + '.tmp'
+    with open(tmp, 'wb') as f:
+        f.write(data)
+    os.replace(tmp, path)
+
+
+# ---------------------------------------------------------------------------
+# 缩放与抖动（epub_image.c 的 fit_size / image_sink_t）
+# ---------------------------------------------------------------------------
+
+def fit_size(width, height, max_width, max_height):
+    if width <= max_width and height <= max_height:
+        w, h = width, height
+    elif width * max_height > height * max_width:
+        w, h = max_width, height * max_width // width
+    else:
+        w, h = width * max_height // height, max_height
+    return max(w, 1), max(h, 1)
+
+
+def gray_rows(image):
+    """按设备的方法取灰度：luma = (77R + 150G + 29B) >> 8，透明部分合成到白色上"""
+    if image.mode == 'L':
+        w = image.width
+        data = image.tobytes()
+        return [data[y * w:(y + 1) * w] for y in range(image.height)]
+    rgba = image.convert('RGBA')
+    w = rgba.width
+    data = rgba.tobytes()
+    rows = []
+    for y in range(rgba.height):
+        row = bytearray(w)
+        base = y * w * 4
+        for x in range(w):
+            r, g, b, a = data[base + 4 * x:base + 4 * x + 4]
+            v = (r * 77 + g * 150 + b * 29) >> 8
+            if a != 255:
+                v = (v * a + 255 * (255 - a) + 127) // 255
+            row[x] = v
+        rows.append(row)
+    return rows
+
+
+def column_counts(src_width, dst_width):
+    cols = [0] * src_width
+    counts = [0] * dst_width
+    acc = col = 0
+    for x in range(src_width):
+        cols[x] = col
+        counts[col] += 1
+        acc += dst_width
+        if acc >= src_width:
+            acc -= src_width
+            col += 1
+    return cols, counts
+
+
+def box_reduce(rows, src_width, dst_width, dst_height):
+    """盒式缩小，返回每个目标像素的平均灰度（与 sink_push_row / sink_emit_row 相同的映射）"""
+    src_height = len(rows)
+    cols, counts = column_counts(src_width, dst_width)
+    out = []
+    sums = [0] * dst_width
+    nrows = v_acc = 0
+    for row in rows:
+        for x in range(src_width):
+            sums[cols[x]] += row[x]
+        nrows += 1
+        v_acc += dst_height
+        if v_acc >= src_height:
+            v_acc -= src_height
+            line = bytearray(dst_width)
+            for j in range(dst_width):
+                n = counts[j] * nrows
+                line[j] = (sums[j] + n // 2) // n
+            out.append(line)
+            sums = [0] * dst_width
+            nrows = 0
+        if len(out) == dst_height:
+            break
+    return out
+
+
+def dither(avg_rows, width, bpp, tone=None):
+    stride = (width * bpp + 7) // 8
+    bits = bytearray(b'\xff' * (stride * len(avg_rows)))
+    cur = [0] * (width + 2)
+    nxt = [0] * (width + 2)
+    for y, line in enumerate(avg_rows):
+        base = y * stride
+        for j in range(width):
+            avg = line[j]
+            v = (tone[avg] if tone is not None else avg) + cur[j + 1]
+            if bpp == 2:
+                level = 0 if v <= 0 else 3 if v >= 255 else (v * 3 + 127) // 255
+                q = level * 85
+                shift = 6 - 2 * (j & 3)
+                i = base + (j >> 2)
+                bits[i] = (bits[i] & ~(3 << shift) & 0xFF) | (level << shift)
+            else:
+                q = 255 if v >= 128 else 0
+                if q == 0:
+                    bits[base + (j >> 3)] &= ~(0x80 >> (j & 7)) & 0xFF
+            d = v - q
+            cur[j + 2] += tdiv(d * 7, 16)
+            nxt[j] += tdiv(d * 3, 16)
+            nxt[j + 1] += tdiv(d * 5, 16)
+            nxt[j + 2] += tdiv(d, 16)
+        cur, nxt = nxt, [0] * (width + 2)
+    return stride, bytes(bits)
+
+
+def open_image(source, dst_width, dst_height):
+    """打开图片，JPEG 用 DCT 缩放直接解到不小于目标尺寸（设备上 TJpgDec 的 1/2..1/8）"""
+    image = Image.open(source)
+    if image.format == 'JPEG':
+        image.draft('L', (dst_width, dst_height))
+    # 大 PNG 先按整数倍缩小到目标的 4 倍以内，避免纯 Python 的盒式缩小太慢
+    factor = min(image.width // max(dst_width * 4, 1), image.height // max(dst_height * 4, 1))
+    image.load()
+    if factor > 1:
+        image = image.reduce(factor)
+    return image
+
+
+def photo_tone(image):
+    """照片色调表（epub_image.c 的 photo_tone）"""
+    w, h = fit_size(image.width, image.height, PHOTO_SAMPLE_SIZE, PHOTO_SAMPLE_SIZE)
+    hist = [0] * 256
+    for line in box_reduce(gray_rows(image), image.width, w, h):
+        for v in line:
+            hist[v] += 1
+    total = sum(hist)
+    clip = total * PHOTO_CLIP_PERMILLE // 1000
+    lo = acc = 0
+    while lo < 255 and acc + hist[lo] <= clip:
+        acc += hist[lo]
+        lo += 1
+    hi, acc = 255, 0
+    while hi > lo and acc + hist[hi] <= clip:
+        acc += hist[hi]
+        hi -= 1
+    if hi - lo < PHOTO_MIN_RANGE:
+        mid = (lo + hi) // 2
+        lo, hi = mid - PHOTO_MIN_RANGE // 2, mid + PHOTO_MIN_RANGE // 2
+        if lo < 0:
+            hi, lo = hi - lo, 0
+        if hi > 255:
+            lo, hi = lo - (hi - 255), 255
+    tone = []
+    for x in range(256):
+        v = 0 if x <= lo else 255 if x >= hi else (x - lo) * 255 // (hi - lo)
+        v += PHOTO_MIDTONE_LIFT * v * (255 - v) // (255 * 256)
+        tone.append(min(v, 255))
+    return tone
+
+
+def render(source, orig_size, max_width, max_height, bpp, photo=False):
+    """返回 (width, height, stride, bits)；orig_size 是原图尺寸（决定目标尺寸）"""
+    dst_w, dst_h = fit_size(orig_size[0], orig_size[1], max_width, max_height)
+    image = open_image(source, dst_w, dst_h)
+    tone = photo_tone(image) if photo else None
+    avg = box_reduce(gray_rows(image), image.width, dst_w, dst_h)
+    stride, bits = dither(avg, dst_w, bpp, tone)
+    return dst_w, dst_h, stride, bits
+
+
+# ---------------------------------------------------------------------------
+# EPUB 元数据（epub_parser.c / epub_xml.c 的取值规则）
+# ---------------------------------------------------------------------------
+
+def local_name(tag):
+    return tag.rsplit('}', 1)[-1].rsplit(':', 1)[-1]
+
+
+def capture_text(elem, size):
+    """空白折叠为一个空格、去掉首尾空白，按 size - 1 字节截断且不留半个 UTF-8 字符"""
+    raw = ' '.join(''.join(elem.itertext()).split()).encode('utf-8')[:size - 1]
+    return raw.decode('utf-8', 'ignore').rstrip(' ')
+
+
+def resolve_href(opf_path, href):
+    href = href.split('#', 1)[0]
+    if href.startswith('/'):
+        path = href[1:]
+    else:
+        path = posixpath.dirname(opf_path) + '/' + href if '/' in opf_path else href
+    path = posixpath.normpath(urllib.parse.unquote(path))
+    return path if path != '.' else ''
+
+
+def read_epub(path):
+    """返回 (title, author, language, cover 在 ZIP 内的路径或 None)"""
+    with zipfile.ZipFile(path) as z:
+        container = ET.fromstring(z.read('META-INF/container.xml'))
+        opf_path = None
+        for elem in container.iter():
+            if local_name(elem.tag) == 'rootfile' and elem.get('full-path'):
+                opf_path = elem.get('full-path')
+                break
+        if opf_path is None:
+            raise ValueError('no rootfile in container.xml')
+        opf = ET.fromstring(z.read(opf_path))
+
+        fields = {'title': '', 'creator': '', 'language': ''}
+        cover_id = None
+        cover_href = cover_guess = None
+        items = {}
+        for elem in opf.iter():
+            name = local_name(elem.tag)
+            if name == 'metadata':
+                for meta in elem.iter():
+                    mname = local_name(meta.tag)
+                    if mname in fields and not fields[mname]:
+                        fields[mname] = capture_text(meta, 16 if mname == 'language' else 128)
+                    elif mname == 'meta' and meta.get('name') == 'cover' and cover_id is None:
+                        cover_id = meta.get('content')
+            elif name == 'item':
+                item_id, href = elem.get('id'), elem.get('href')
+                if item_id is None or href is None:
+                    continue
+                items.setdefault(item_id, href)
+                if (elem.get('media-type') or '').startswith('image/'):
+                    if cover_href is None and 'cover-image' in (elem.get('properties') or '').split():
+                        cover_href = href
+                    if cover_guess is None and ('cover' in item_id or 'cover' in href):
+                        cover_guess = href
+
+        cover = cover_href or (items.get(cover_id) if cover_id else None) or cover_guess
+        cover_path = resolve_href(opf_path, cover) if cover else None
+        if cover_path and len(cover_path.encode('utf-8')) >= 128:
+            cover_path = None
+        return fields['title'], fields['creator'], fields['language'], cover_path
+
+
+# ---------------------------------------------------------------------------
+# library.db
+# ---------------------------------------------------------------------------
+
+def title_from_filename(device_path):
+    name = device_path.rsplit('/', 1)[-1].encode('utf-8')[:95]
+    dot = name.rfind(b'.')
+    return name[:dot] if dot > 0 else name
+
+
+def make_record(local_path, device_path, book_type, st, args):
+    title = author = language = b''
+    thumb = bytearray(b'\xff' * THUMB_BYTES)
+    thumb_w = thumb_h = 0
+    if book_type == BOOK_EPUB:
+        try:
+            t, a, lang, cover = read_epub(local_path)
+            if not t:
+                t = device_path.rsplit('/', 1)[-1]
+                t = t[:t.rfind('.')] if '.' in t else t
+            title, author, language = cstr(t, 96), cstr(a or 'Unknown', 64), cstr(lang, 16)
+            if cover and Image is not None:
+                with zipfile.ZipFile(local_path) as z:
+                    data = io.BytesIO(z.read(cover))
+                size = Image.open(data).size
+                data.seek(0)
+                thumb_w, thumb_h, stride, bits = render(data, size, THUMB_WIDTH, THUMB_HEIGHT, 1)
+                for y in range(thumb_h):
+                    thumb[y * THUMB_STRIDE:y * THUMB_STRIDE + stride] = bits[y * stride:(y + 1) * stride]
+        except (zipfile.BadZipFile, KeyError, ET.ParseError, ValueError, OSError) as e:
+            print(f'  {device_path}: {e}, listed by file name', file=sys.stderr)
+    if not title:
+        title = title_from_filename(device_path)
+    book = BOOK.pack(cstr(device_path, PATH_MAX), title, author, language,
+                     st.st_size & 0xFFFFFFFF, book_type, thumb_w, thumb_h, 0)
+    return book + bytes(thumb)
+
+
+def load_db(path):
+    """读出已有数据库的 {path_hash: (key, record)}；无效时返回空表"""
+    try:
+        with open(path, 'rb') as f:
+            data = f.read()
+    except OSError:
+        return {}
+    if len(data) < DB_RECORDS_OFFSET:
+        return {}
+    magic, version, record_size, count, _ = DB_HEADER.unpack_from(data, 0)
+    if magic != DB_MAGIC or version != DB_VERSION or record_size != RECORD_SIZE or count > DB_MAX_BOOKS:
+        return {}
+    books = {}
+    for i in range(count):
+        key = DB_KEY.unpack_from(data, DB_KEYS_OFFSET + i * DB_KEY.size)
+        record = data[DB_RECORDS_OFFSET + i * RECORD_SIZE:DB_RECORDS_OFFSET + (i + 1) * RECORD_SIZE]
+        if key[0] != 0 and len(record) == RECORD_SIZE and fnv1a(record) == key[3]:
+            books[key[0]] = (key, record)
+    return books
+
+
+def walk_books(root):
+    """与设备扫描相同的范围：跳过 . 开头的名字，最多进入 INDEX_MAX_DEPTH 层目录"""
+    stack = [(root, '', 0)]
+    while stack:
+        local, rel, depth = stack.pop()
+        try:
+            entries = sorted(os.scandir(local), key=lambda e: e.name)
+        except OSError:
+            continue
+        for entry in entries:
+            if entry.name.startswith('.'):
+                continue
+            sub = rel + '/' + entry.name
+            if entry.is_dir(follow_symlinks=False):
+                if depth + 1 < INDEX_MAX_DEPTH:
+                    stack.append((entry.path, sub, depth + 1))
+                continue
+            ext = os.path.splitext(entry.name)[1].lower()
+            if ext in ('.epub', '.txt') or ext in IMAGE_EXTS:
+                yield entry.path, DEVICE_ROOT + sub, ext
+
+
+def build_library(root, cache, files, args):
+    db_path = os.path.join(cache, 'library.db')
+    existing = load_db(db_path)
+    keys, records = [], []
+    reused = built = 0
+    for local, device, ext in files:
+        if ext not in ('.epub', '.txt') or len(device.encode('utf-8')) >= PATH_MAX:
+            continue
+        if len(keys) >= DB_MAX_BOOKS:
+            print(f'library is full ({DB_MAX_BOOKS}), {device} and later books skipped',
+                  file=sys.stderr)
+            break
+        st = os.stat(local)
+        h = path_key(device)
+        mtime = device_mtime(st, args.mtime)
+        old = existing.get(h)
+        if old and old[0][1] == (st.st_size & 0xFFFFFFFF) and old[0][2] == mtime:
+            keys.append(old[0])
+            records.append(old[1])
+            reused += 1
+            continue
+        record = make_record(local, device, BOOK_EPUB if ext == '.epub' else BOOK_TXT, st, args)
+        keys.append((h, st.st_size & 0xFFFFFFFF, mtime, fnv1a(record)))
+        records.append(record)
+        built += 1
+        if args.verbose:
+            print(f'  book {device}')
+
+    out = bytearray(DB_HEADER.pack(DB_MAGIC, DB_VERSION, RECORD_SIZE, len(keys), 0))
+    for key in keys:
+        out += DB_KEY.pack(*key)
+    out += bytes(DB_MAX_BOOKS * DB_KEY.size - len(keys) * DB_KEY.size)
+    for record in records:
+        out += record
+    if not args.dry_run:
+        write_atomic(db_path, bytes(out))
+    print(f'library.db: {len(keys)} books ({built} indexed, {reused} unchanged)')
+
+
+# ---------------------------------------------------------------------------
+# 图片缩略图
+# ---------------------------------------------------------------------------
+
+def xic_name(path_hash, max_width, max_height, bpp):
+    return '%08x.xic' % fnv1a(struct.pack('<HHH', max_width, max_height, bpp), path_hash)
+
+
+def xic_current(path, header):
+    try:
+        with open(path, 'rb') as f:
+            old = f.read(XIC_HEADER.size)
+    except OSError:
+        return False
+    return len(old) == XIC_HEADER.size and XIC_HEADER.unpack(old)[:6] == header[:6]
+
+
+def build_images(cache, files, args, max_width, max_height):
+    img_dir = os.path.join(cache, 'img')
+    if not args.dry_run:
+        os.makedirs(img_dir, exist_ok=True)
+    built = reused = failed = 0
+    for local, device, ext in files:
+        if ext not in IMAGE_EXTS:
+            continue
+        st = os.stat(local)
+        path_hash = fnv1a(device.encode('utf-8'))
+        key = (XIC_MAGIC, path_hash, st.st_size & 0xFFFFFFFF, device_mtime(st, args.mtime),
+               max_width, max_height)
+        target = os.path.join(img_dir, xic_name(path_hash, max_width, max_height, args.bpp))
+        if xic_current(target, key + (0, 0, args.bpp)) and not args.force:
+            reused += 1
+            continue
+        try:
+            with Image.open(local) as probe:
+                size = probe.size
+            w, h, stride, bits = render(local, size, max_width, max_height, args.bpp,
+                                        photo=args.bpp == 2)
+        except (OSError, ValueError) as e:
+            print(f'  {device}: {e}', file=sys.stderr)
+            failed += 1
+            continue
+        data = XIC_HEADER.pack(*key, w, h, args.bpp) + packbits(bits)
+        if not args.dry_run:
+            write_atomic(target, data)
+        built += 1
+        if args.verbose:
+            print(f'  image {device}: {w}x{h}, {len(data)} bytes')
+    print(f'img/ {max_width}x{max_height} {args.bpp}bpp: {built} built, {reused} unchanged'
+          + (f', {failed} failed' if failed else ''))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='在电脑上预先生成 SD 卡的设备缓存')
+    ap.add_argument('root', help='SD 卡根目录（设备上的 /sdcard）')
+    ap.add_argument('--bpp', type=int, choices=(1, 2), default=1,
+                    help='图片位深：1 黑白（默认），2 设备开启了灰阶显示')
+    ap.add_argument('--mtime', choices=('local', 'utc'), default='local',
+                    help='卡上 FAT 时间的解释方式，见文件开头的说明')
+    ap.add_argument('--no-library', action='store_true', help='不生成 library.db')
+    ap.add_argument('--no-images', action='store_true', help='不生成图片缩略图')
+    ap.add_argument('--force', action='store_true', help='图片缓存即使没变也重新生成')
+    ap.add_argument('-n', '--dry-run', action='store_true', help='只统计，不写文件')
+    ap.add_argument('-v', '--verbose', action='store_true')
+    args = ap.parse_args()
+
+    root = os.path.abspath(args.root)
+    if not os.path.isdir(root):
+        sys.exit(f'{root} is not a directory')
+    cache = os.path.join(root, CACHE_DIR)
+    if not args.dry_run:
+        os.makedirs(cache, exist_ok=True)
+    if Image is None:
+        print('Pillow not installed: covers and image thumbnails are skipped', file=sys.stderr)
+
+    files = list(walk_books(root))
+    if not args.no_library:
+        build_library(root, cache, files, args)
+    if not args.no_images and Image is not None:
+        build_images(cache, files, args, IMAGE_THUMB_WIDTH, IMAGE_THUMB_HEIGHT)
+
+
+if __name__ == '__main__':
+    main()
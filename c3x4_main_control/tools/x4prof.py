@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+汇总设备上的采样剖析报告（格式见 main/profiler.h），用固件 ELF 的符号表把 PC 换成函数名
+
+报告来源：
+  - SD 卡上的 /sdcard/prof/prof_<时间>.txt
+  - 串口日志（idf.py monitor 的输出存成文件；以 "X4PROF " 开头的行）
+  - 直接读串口：--port /dev/ttyUSB0（需要 pyserial），收到 end 行为止
+  - BLE 读取特征 0x567B 得到的文本存成文件
+
+用法:
+  python x4prof.py prof_20260101_120000.txt -e build/monster-c3x4.elf
+  python x4prof.py monitor.log -e build/monster-c3x4.elf --task epd_refresh
+  python x4prof.py --port /dev/ttyUSB0 -e build/monster-c3x4.elf --lines
+
+符号表用 riscv32-esp-elf-nm（ESP-IDF 工具链，找不到时用系统 nm，可用 --nm 指定）；
+--lines 时再用 addr2line 给出最热 PC 的源码行
+"""
+
+import argparse
+import bisect
+import collections
+import shutil
+import subprocess
+import sys
+
+PREFIX = 'X4PROF '
+
+
+def read_lines(args):
+    if args.port:
+        import serial
+        with serial.Serial(args.port, args.baud, timeout=1) as port:
+            print(f'waiting for a report on {args.port} ...', file=sys.stderr)
+            while True:
+                raw = port.readline().decode('utf-8', 'replace')
+                if PREFIX in raw:
+                    line = raw.split(PREFIX, 1)[1].strip()
+                    yield line
+                    if line == 'end':
+                        return
+    with open(args.report, errors='replace') as f:
+        for raw in f:
+            if PREFIX in raw:
+                raw = raw.split(PREFIX, 1)[1]
+            yield raw.strip()
+
+
+def parse(lines):
+    rep = {'tasks': [], 'pcs': [], 'session': None, 'version': '?', 'complete': False}
+    started = False
+    for line in lines:
+        if line == 'x4prof 1':
+            # 日志里可能有多份报告，取最后一份
+            rep = {'tasks': [], 'pcs': [], 'session': None, 'version': '?', 'complete': False}
+            started = True
+            continue
+        if not started or not line:
+            continue
+        kind, _, rest = line.partition(' ')
+        if kind == 'version':
+            rep['version'] = rest
+        elif kind == 'session':
+            rate, dur, count, dropped = (int(v) for v in rest.split())
+            rep['session'] = (rate, dur, count, dropped)
+        elif kind == 'task':
+            # 任务名可能含空格（如 "Tmr Svc"），数值在最后两列
+            name, rt, permille = rest.rsplit(' ', 2)
+            rep['tasks'].append((name, int(rt), int(permille)))
+        elif kind == 'pc':
+            addr, rest = rest.split(' ', 1)
+            name, count = rest.rsplit(' ', 1)
+            rep['pcs'].append((int(addr, 16), name, int(count)))
+        elif kind == 'end':
+            rep['complete'] = True
+    if not started:
+        sys.exit('no x4prof report found')
+    return rep
+
+
+def find_tool(explicit, names):
+    if explicit:
+        return explicit
+    for n in names:
+        if shutil.which(n):
+            return n
+    return None
+
+
+class Symbols:
+    def __init__(self, elf, nm):
+        self.starts, self.names, self.ends = [], [], []
+        if not elf:
+            return
+        tool = find_tool(nm, ('riscv32-esp-elf-nm', 'nm'))
+        if tool is None:
+            sys.exit('nm not found (use --nm)')
+        out = subprocess.run([tool, '-n', '-S', '--defined-only', elf], check=True,
+                             capture_output=True, text=True).stdout
+        for line in out.splitlines():
+            parts = line.split()
+            if len(parts) == 4 and parts[2] in 'tTwW':
+                start, size = int(parts[0], 16), int(parts[1], 16)
+                self.starts.append(start)
+                self.ends.append(start + size)
+                self.names.append(parts[3])
+
+    def lookup(self, pc):
+        i = bisect.bisect_right(self.starts, pc) - 1
+        if i >= 0 and pc < max(self.ends[i], self.starts[i] + 1):
+            return self.names[i]
+        return f'0x{pc:08x}'
+
+
+def addr2line(elf, tool, pcs):
+    tool = find_tool(tool, ('riscv32-esp-elf-addr2line', 'addr2line'))
+    if tool is None or not pcs:
+        return {}
+    out = subprocess.run([tool, '-e', elf] + [f'0x{pc:x}' for pc in pcs], check=True,
+                         capture_output=True, text=True).stdout.splitlines()
+    return dict(zip(pcs, out))
+
+
+def table(title, rows, total, top):
+    print(f'\n== {title} ==')
+    for name, count in rows[:top]:
+        print(f'{count:>7} {100.0 * count / total:6.1f}%  {name}')
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Symbolize x4prof sampling reports')
+    ap.add_argument('report', nargs='?', help='report file or serial log')
+    ap.add_argument('-e', '--elf', help='firmware ELF (build/<project>.elf)')
+    ap.add_argument('--port', help='read the report from this serial port')
+    ap.add_argument('--baud', type=int, default=115200)
+    ap.add_argument('--task', help='only count samples from this task')
+    ap.add_argument('--top', type=int, default=25)
+    ap.add_argument('--lines', action='store_true', help='source lines of the hottest PCs')
+    ap.add_argument('--nm')
+    ap.add_argument('--addr2line')
+    args = ap.parse_args()
+    if not args.report and not args.port:
+        ap.error('give a report file or --port')
+
+    rep = parse(read_lines(args))
+    print(f'firmware {rep["version"]}')
+    if rep['session']:
+        rate, dur, count, dropped = rep['session']
+        print(f'{count} samples at {rate} Hz over {dur / 1e6:.2f} s'
+              + (f', {dropped} dropped (buffer full)' if dropped else ''))
+    if not rep['complete']:
+        print('warning: report truncated (no end line)')
+
+    if rep['tasks']:
+        print('\n== CPU by task (run-time stats) ==')
+        for name, rt, permille in sorted(rep['tasks'], key=lambda t: -t[1]):
+            print(f'{permille / 10:6.1f}%  {rt / 1000:10.1f} ms  {name}')
+
+    syms = Symbols(args.elf, args.nm)
+    pcs = [p for p in rep['pcs'] if args.task is None or p[1] == args.task]
+    total = sum(p[2] for p in pcs)
+    if total == 0:
+        print('\nno samples')
+        return
+
+    by_func = collections.Counter()
+    by_task = collections.Counter()
+    by_task_func = collections.defaultdict(collections.Counter)
+    for pc, task, count in pcs:
+        func = syms.lookup(pc)
+        by_func[func] += count
+        by_task[task] += count
+        by_task_func[task][func] += count
+
+    table('samples by task', by_task.most_common(), total, args.top)
+    table('flat profile' + (f' ({args.task})' if args.task else ''), by_func.most_common(),
+          total, args.top)
+    if args.task is None:
+        for task, _ in by_task.most_common(4):
+            table(f'top functions in {task}', by_task_func[task].most_common(),
+                  sum(by_task_func[task].values()), min(args.top, 10))
+
+    if args.lines and args.elf:
+        hot = sorted(pcs, key=lambda p: -p[2])[:args.top]
+        where = addr2line(args.elf, args.addr2line, [p[0] for p in hot])
+        print('\n== hottest PCs ==')
+        for pc, task, count in hot:
+            print(f'{count:>7}  0x{pc:08x}  {syms.lookup(pc):<32} {where.get(pc, "")}  [{task}]')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+"""
+通过 USB 线批量读写设备 SD 卡上的文件（设备端协议见 main/usb_transfer.h）
+
+设备上先进入 设置 -> USB transfer（期间蓝牙关闭），电脑上用芯片内置的 USB Serial/JTAG
+串口（Linux 一般是 /dev/ttyACM0，Windows 是 COMx）。需要 pyserial。
+
+用法:
+  python x4usb.py --port /dev/ttyACM0 ls [目录]
+  python x4usb.py --port /dev/ttyACM0 put 本地文件 [远程路径]
+  python x4usb.py --port /dev/ttyACM0 get 远程路径 [本地文件]
+  python x4usb.py --port /dev/ttyACM0 rm 远程路径
+  python x4usb.py --port /dev/ttyACM0 sync 本地目录 [远程目录]   # 只上传缺少或大小不同的文件
+
+远程路径都相对于 /sdcard，用 '/' 分隔，不能进入以 '.' 开头的目录
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = b'X4'
+HDR = struct.Struct('<2sBBH')
+
+OP_HELLO = 0x01
+OP_LIST = 0x02
+OP_PUT = 0x03
+OP_GET = 0x04
+OP_DEL = 0x05
+OP_ABORT = 0x06
+OP_DATA = 0x10
+OP_ACK = 0x11
+RE_STATUS = 0x80
+RE_HELLO = 0x81
+RE_ENTRY = 0x82
+
+OK = 0
+NAK = 1
+ERRORS = {2: 'bad request', 3: 'SD card error', 4: 'CRC mismatch', 5: 'not found'}
+
+ACK_EVERY = 2           # 与 USB_XFER_ACK_EVERY 相同
+ACK_TIMEOUT = 1.0       # 这么久没有 ACK 就从最近确认的偏移重发
+MAX_RETRIES = 10
+
+
+class TransferError(Exception):
+    pass
+
+
+class Link:
+    def __init__(self, port):
+        import serial
+        # USB CDC 的波特率没有意义，只是 pyserial 需要一个值
+        self.port = serial.Serial(port, 115200, timeout=0.05)
+        self.buf = bytearray()
+        self.window = 1
+        self.block = 512
+
+    def send(self, ftype, payload=b''):
+        head = HDR.pack(MAGIC, ftype, 0, len(payload))
+        crc = zlib.crc32(head[2:] + payload)
+        self.port.write(head + payload + struct.pack('<I', crc))
+
+    def recv(self, timeout):
+        """下一个完整的帧 (type, payload)；魔数或 CRC 不对时丢一个字节重新同步"""
+        deadline = time.monotonic() + timeout
+        while True:
+            while len(self.buf) >= HDR.size:
+                start = self.buf.find(MAGIC)
+                if start < 0:
+                    del self.buf[:-1]
+                    break
+                del self.buf[:start]
+                if len(self.buf) < HDR.size:
+                    break
+                _, ftype, _, length = HDR.unpack_from(self.buf)
+                total = HDR.size + length + 4
+                if len(self.buf) < total:
+                    break
+                body = bytes(self.buf[2:HDR.size + length])
+                (crc,) = struct.unpack_from('<I', self.buf, HDR.size + length)
+                if zlib.crc32(body) != crc:
+                    del self.buf[:1]
+                    continue
+                del self.buf[:total]
+                return ftype, body[HDR.size - 2:]
+            if time.monotonic() >= deadline:
+                return None
+            self.buf += self.port.read(max(1, self.port.in_waiting))
+
+    def wait_status(self, op, timeout=5.0):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            frame = self.recv(deadline - time.monotonic())
+            if frame and frame[0] == RE_STATUS and frame[1][0] == op:
+                _, status, value = struct.unpack('<BBI', frame[1][:6])
+                return status, value
+        raise TransferError(f'no reply to 0x{op:02x}')
+
+    def hello(self):
+        # 进入模式之前的日志可能还在缓冲区里
+        self.port.reset_input_buffer()
+        for _ in range(3):
+            self.send(OP_HELLO)
+            deadline = time.monotonic() + 1.0
+            while time.monotonic() < deadline:
+                frame = self.recv(deadline - time.monotonic())
+                if frame and frame[0] == RE_HELLO:
+                    version, self.window, self.block = struct.unpack('<BBH', frame[1][:4])
+                    return version
+        raise TransferError('device not answering: is it in USB transfer mode?')
+
+
+def check(status, what):
+    if status != OK:
+        raise TransferError(f'{what}: {ERRORS.get(status, status)}')
+
+
+def list_dir(link, remote):
+    link.send(OP_LIST, remote.encode())
+    entries = []
+    while True:
+        frame = link.recv(5.0)
+        if frame is None:
+            raise TransferError(f'listing {remote} timed out')
+        ftype, payload = frame
+        if ftype == RE_ENTRY:
+            size, is_dir = struct.unpack_from('<IB', payload)
+            entries.append((payload[5:].decode('utf-8', 'replace'), size, bool(is_dir)))
+        elif ftype == RE_STATUS and payload[0] == OP_LIST:
+            check(payload[1], f'list {remote or "/"}')
+            return entries
+
+
+def put(link, local, remote):
+    size = os.path.getsize(local)
+    crc = 0
+    with open(local, 'rb') as f:
+        for chunk in iter(lambda: f.read(1 << 16), b''):
+            crc = zlib.crc32(chunk, crc)
+    link.send(OP_PUT, struct.pack('<II', size, crc) + remote.encode())
+    status, _ = link.wait_status(OP_PUT)
+    check(status, f'put {remote}')
+
+    window = link.window * link.block
+    acked = sent = 0
+    retries = 0
+    with open(local, 'rb') as f:
+        while True:
+            # 窗口没满就继续发；NAK 或超时时从最近确认的偏移重发（go-back-N）
+            while sent < size and sent - acked < window:
+                f.seek(sent)
+                data = f.read(link.block)
+                link.send(OP_DATA, struct.pack('<I', sent) + data)
+                sent += len(data)
+            frame = link.recv(ACK_TIMEOUT)
+            if frame is None:
+                retries += 1
+                if retries > MAX_RETRIES:
+                    link.send(OP_ABORT)
+                    raise TransferError(f'put {remote}: no ACK at {acked}/{size}')
+                sent = acked
+                continue
+            ftype, payload = frame
+            if ftype == OP_ACK:
+                status, offset = struct.unpack('<BI', payload[:5])
+                if offset > acked:
+                    acked = offset
+                    retries = 0
+                if status == NAK:
+                    sent = acked
+            elif ftype == RE_STATUS and payload[0] == OP_DATA:
+                check(payload[1], f'put {remote}')
+                return size
+
+
+def get(link, remote, local):
+    link.send(OP_GET, remote.encode())
+    status, size = link.wait_status(OP_GET)
+    check(status, f'get {remote}')
+    part = local + '.part'
+    expected = 0
+    unacked = 0
+    nak_sent = False
+    retries = 0
+    with open(part, 'wb') as f:
+        while True:
+            frame = link.recv(ACK_TIMEOUT)
+            if frame is None:
+                retries += 1
+                if retries > MAX_RETRIES:
+                    link.send(OP_ABORT)
+                    raise TransferError(f'get {remote}: stalled at {expected}/{size}')
+                link.send(OP_ACK, struct.pack('<BI', OK, expected))
+                continue
+            ftype, payload = frame
+            if ftype == OP_DATA:
+                (offset,) = struct.unpack_from('<I', payload)
+                if offset == expected:
+                    f.write(payload[4:])
+                    expected += len(payload) - 4
+                    retries = 0
+                    nak_sent = False
+                    unacked += 1
+                    if unacked >= ACK_EVERY or expected == size:
+                        link.send(OP_ACK, struct.pack('<BI', OK, expected))
+                        unacked = 0
+                elif offset > expected and not nak_sent:
+                    link.send(OP_ACK, struct.pack('<BI', NAK, expected))
+                    nak_sent = True
+            elif ftype == RE_STATUS and payload[0] == OP_DATA:
+                check(payload[1], f'get {remote}')
+                break
+    os.replace(part, local)
+    return size
+
+
+def remove(link, remote):
+    link.send(OP_DEL, remote.encode())
+    status, _ = link.wait_status(OP_DEL)
+    check(status, f'rm {remote}')
+
+
+def join(*parts):
+    return '/'.join(p.strip('/') for p in parts if p.strip('/'))
+
+
+def sync(link, local_dir, remote_dir):
+    listings = {}
+    total = 0
+    count = 0
+    for root, dirs, files in os.walk(local_dir):
+        dirs[:] = sorted(d for d in dirs if not d.startswith('.'))
+        rel_root = os.path.relpath(root, local_dir).replace(os.sep, '/')
+        remote_root = join(remote_dir, '' if rel_root == '.' else rel_root)
+        if remote_root not in listings:
+            try:
+                listings[remote_root] = {name: size for name, size, _ in list_dir(link, remote_root)}
+            except TransferError:
+                listings[remote_root] = {}    # 目录还不存在：PUT 会建好父目录
+        for name in sorted(files):
+            if name.startswith('.'):
+                continue
+            path = os.path.join(root, name)
+            size = os.path.getsize(path)
+            if listings[remote_root].get(name) == size:
+                continue
+            total += transfer(lambda: put(link, path, join(remote_root, name)), join(remote_root, name))
+            count += 1
+    print(f'{count} files uploaded, {total} bytes')
+
+
+def transfer(fn, name):
+    t0 = time.monotonic()
+    size = fn()
+    dt = max(time.monotonic() - t0, 1e-3)
+    print(f'{name}: {size} bytes in {dt:.2f} s ({size / dt / 1024:.0f} KB/s)')
+    return size
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Bulk file transfer to the SD card over USB')
+    ap.add_argument('--port', required=True, help='USB Serial/JTAG port, e.g. /dev/ttyACM0')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    p = sub.add_parser('ls')
+    p.add_argument('remote', nargs='?', default='')
+    p = sub.add_parser('put')
+    p.add_argument('local')
+    p.add_argument('remote', nargs='?')
+    p = sub.add_parser('get')
+    p.add_argument('remote')
+    p.add_argument('local', nargs='?')
+    p = sub.add_parser('rm')
+    p.add_argument('remote')
+    p = sub.add_parser('sync')
+    p.add_argument('local')
+    p.add_argument('remote', nargs='?', default='')
+    args = ap.parse_args()
+
+    link = Link(args.port)
+    try:
+        version = link.hello()
+        print(f'protocol {version}, window {link.window} x {link.block} bytes', file=sys.stderr)
+        if args.cmd == 'ls':
+            for name, size, is_dir in list_dir(link, args.remote):
+                print(f'{"<dir>" if is_dir else size:>10}  {name}')
+        elif args.cmd == 'put':
+            remote = args.remote or os.path.basename(args.local)
+            transfer(lambda: put(link, args.local, remote), remote)
+        elif args.cmd == 'get':
+            local = args.local or os.path.basename(args.remote)
+            transfer(lambda: get(link, args.remote, local), args.remote)
+        elif args.cmd == 'rm':
+            remove(link, args.remote)
+        elif args.cmd == 'sync':
+            sync(link, args.local, args.remote)
+    except TransferError as e:
+        sys.exit(f'error: {e}')
+
+
+if __name__ == '__main__':
+    main()
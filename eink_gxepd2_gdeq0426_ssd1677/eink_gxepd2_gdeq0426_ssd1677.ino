@@ -16,7 +16,15 @@
     RST  = 3
     BUSY = 4
 
+  分页绘制：
+  - display 只带 EPD_PAGE_ROWS 行的页缓冲（800 x 48 行 = 4.8 KB，整帧需 48 KB），
+    drawScene() 对每一页重跑一遍，GxEPD2 把每页写进控制器 RAM 的对应窗口。
+  - 局部刷新：markDirty() 记录变化区域，合并规则与主固件 lvgl_driver.c 相同
+    （最多 DIRTY_RECT_MAX 个矩形，合并后多出的面积小于 DIRTY_MERGE_COST_PX 就合并，
+    列表满时并入代价最小的矩形）；flushDirty() 对每个矩形 setPartialWindow 后分页重画。
+
   使用：替换模板 -> 编译 -> 上传 -> 观察串口/显示。
+  串口发任意字符：计数加一，只局刷计数与进度条两个区域。
 */
 
 #include <Arduino.h>
@@ -34,10 +42,36 @@
 #define EPD_RST   3
 #define EPD_BUSY  4
 
+// 页缓冲行数：第二个模板参数为 HEIGHT 时是整帧缓冲，更小时按页绘制
+#define EPD_PAGE_ROWS 48
+
 // 使用 GxEPD2 库中提供的 GDEQ0426T82 模板并实例化
-using EpdType = GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT>;
+using EpdType = GxEPD2_BW<GxEPD2_426_GDEQ0426T82, EPD_PAGE_ROWS>;
 EpdType display(GxEPD2_426_GDEQ0426T82(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
 
+// 脏矩形（屏幕坐标，闭区间，X 扩展到字节边界），规则同主固件
+#define DIRTY_RECT_MAX 4
+#define DIRTY_MERGE_COST_PX 4096
+
+struct DirtyRect {
+  int16_t x1, y1, x2, y2;
+};
+
+static DirtyRect s_dirty[DIRTY_RECT_MAX];
+static uint8_t s_dirtyCount = 0;
+
+// 演示内容的状态
+static int s_counter = 0;
+
+#define COUNTER_X 20
+#define COUNTER_Y 160
+#define COUNTER_W 300
+#define COUNTER_H 40
+#define BAR_X 20
+#define BAR_Y 220
+#define BAR_W 440
+#define BAR_H 24
+
 SPIClass spi = SPI;
 
 void setup_spi_pins()
@@ -69,21 +103,114 @@ void waitBusy(unsigned long timeout_ms = 5000)
   }
 }
 
-void demoDraw()
+static int32_t rectArea(const DirtyRect &r)
 {
-  display.setRotation(0);
+  return (int32_t)(r.x2 - r.x1 + 1) * (r.y2 - r.y1 + 1);
+}
+
+static DirtyRect rectJoin(const DirtyRect &a, const DirtyRect &b)
+{
+  DirtyRect u = { min(a.x1, b.x1), min(a.y1, b.y1), max(a.x2, b.x2), max(a.y2, b.y2) };
+  return u;
+}
+
+// 合并代价：包围盒比两个矩形多出的面积（重叠时为负）
+static int32_t mergeCost(const DirtyRect &a, const DirtyRect &b)
+{
+  return rectArea(rectJoin(a, b)) - rectArea(a) - rectArea(b);
+}
+
+void markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  DirtyRect rect = { x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+  if (rect.x1 < 0) rect.x1 = 0;
+  if (rect.y1 < 0) rect.y1 = 0;
+  if (rect.x2 > display.width() - 1) rect.x2 = display.width() - 1;
+  if (rect.y2 > display.height() - 1) rect.y2 = display.height() - 1;
+  if (rect.x1 > rect.x2 || rect.y1 > rect.y2) {
+    return;
+  }
+  // 控制器 RAM 窗口的 X 以字节为单位
+  rect.x1 &= ~7;
+  rect.x2 |= 7;
+
+  // 与已有矩形反复合并，直到没有代价足够低的组合
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < s_dirtyCount; i++) {
+      if (mergeCost(rect, s_dirty[i]) < DIRTY_MERGE_COST_PX) {
+        rect = rectJoin(rect, s_dirty[i]);
+        s_dirty[i] = s_dirty[--s_dirtyCount];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (s_dirtyCount < DIRTY_RECT_MAX) {
+    s_dirty[s_dirtyCount++] = rect;
+    return;
+  }
+  // 列表已满：并入代价最小的矩形
+  uint8_t best = 0;
+  int32_t bestCost = INT32_MAX;
+  for (uint8_t i = 0; i < s_dirtyCount; i++) {
+    const int32_t cost = mergeCost(rect, s_dirty[i]);
+    if (cost < bestCost) {
+      bestCost = cost;
+      best = i;
+    }
+  }
+  s_dirty[best] = rectJoin(s_dirty[best], rect);
+}
+
+// 整个画面；分页时每页调用一次，页外的绘制由 GxEPD2 裁掉
+void drawScene()
+{
+  display.fillScreen(GxEPD_WHITE);
   display.setTextColor(GxEPD_BLACK);
   display.setTextSize(2);
+  display.setCursor(20, 40);
+  display.println("Hello GDEQ0426T82");
+  display.setCursor(20, 80);
+  display.println("SSD1677 800x480 demo");
+  display.drawRect(10, 20, 460, 100, GxEPD_BLACK);
+
+  display.setTextSize(3);
+  display.setCursor(COUNTER_X, COUNTER_Y + 8);
+  display.print("Count: ");
+  display.print(s_counter);
+
+  display.drawRect(BAR_X, BAR_Y, BAR_W, BAR_H, GxEPD_BLACK);
+  display.fillRect(BAR_X + 2, BAR_Y + 2, (BAR_W - 4) * (s_counter % 11) / 10, BAR_H - 4, GxEPD_BLACK);
+}
 
+// 整屏分页绘制
+void demoDraw()
+{
+  display.setRotation(0);
+  display.setFullWindow();
   display.firstPage();
   do {
-    display.fillScreen(GxEPD_WHITE);
-    display.setCursor(20, 40);
-    display.println("Hello GDEQ0426T82");
-    display.setCursor(20, 80);
-    display.println("SSD1677 800x480 demo");
-    display.drawRect(10, 20, 460, 100, GxEPD_BLACK);
+    drawScene();
   } while (display.nextPage());
+  s_dirtyCount = 0;
+}
+
+// 只重画脏矩形：每个矩形一个局刷窗口，窗口内同样按页绘制
+void flushDirty()
+{
+  for (uint8_t i = 0; i < s_dirtyCount; i++) {
+    const DirtyRect &r = s_dirty[i];
+    display.setPartialWindow(r.x1, r.y1, r.x2 - r.x1 + 1, r.y2 - r.y1 + 1);
+    display.firstPage();
+    do {
+      drawScene();
+    } while (display.nextPage());
+    Serial.printf("局刷窗口 (%d,%d)-(%d,%d)\n", r.x1, r.y1, r.x2, r.y2);
+  }
+  s_dirtyCount = 0;
 }
 
 void setup() {
@@ -109,8 +236,10 @@ void setup() {
 void loop() {
   if (Serial.available()) {
     while (Serial.available()) Serial.read();
-    Serial.println("触发演示绘制（占位，需要已实例化 display）");
-    demoDraw();
+    s_counter++;
+    markDirty(COUNTER_X, COUNTER_Y, COUNTER_W, COUNTER_H);
+    markDirty(BAR_X, BAR_Y, BAR_W, BAR_H);
+    flushDirty();
   }
   delay(200);
 }